@@ -1,6 +1,7 @@
 {
   "variables": {
-    "with_secp256k1%": "true"
+    "with_secp256k1%": "true",
+    "with_tables%": "true"
   },
   "targets": [
     {
@@ -74,6 +75,11 @@
           "defines": [
             "TORSION_HAVE_PTHREAD"
           ]
+        }],
+        ["with_tables == 'true'", {
+          "defines": [
+            "TORSION_USE_TABLES"
+          ]
         }]
       ]
     },
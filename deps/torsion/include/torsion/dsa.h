@@ -20,6 +20,7 @@ extern "C" {
 
 #define dsa_params_create torsion_dsa_params_create
 #define dsa_params_generate torsion_dsa_params_generate
+#define dsa_params_search torsion_dsa_params_search
 #define dsa_params_bits torsion_dsa_params_bits
 #define dsa_params_qbits torsion_dsa_params_qbits
 #define dsa_params_verify torsion_dsa_params_verify
@@ -102,6 +103,13 @@ dsa_params_generate(unsigned char *out,
                     size_t bits,
                     const unsigned char *entropy);
 
+TORSION_EXTERN int
+dsa_params_search(unsigned char *out,
+                  size_t *out_len,
+                  size_t bits,
+                  const unsigned char *entropy,
+                  const volatile int *stop);
+
 TORSION_EXTERN size_t
 dsa_params_bits(const unsigned char *params, size_t params_len);
 
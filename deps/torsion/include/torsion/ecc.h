@@ -26,7 +26,9 @@ extern "C" {
 #define wei_curve_field_size torsion_wei_curve_field_size
 #define wei_curve_field_bits torsion_wei_curve_field_bits
 #define wei_curve_randomize torsion_wei_curve_randomize
+#define wei_curve_precompute torsion_wei_curve_precompute
 #define wei_scratch_create torsion_wei_scratch_create
+#define wei_pubkey_destroy torsion_wei_pubkey_destroy
 
 #define mont_curve_create torsion_mont_curve_create
 #define mont_curve_destroy torsion_mont_curve_destroy
@@ -38,12 +40,15 @@ extern "C" {
 #define edwards_curve_create torsion_edwards_curve_create
 #define edwards_curve_destroy torsion_edwards_curve_destroy
 #define edwards_curve_randomize torsion_edwards_curve_randomize
+#define edwards_curve_precompute torsion_edwards_curve_precompute
 #define edwards_curve_scalar_size torsion_edwards_curve_scalar_size
 #define edwards_curve_scalar_bits torsion_edwards_curve_scalar_bits
 #define edwards_curve_field_size torsion_edwards_curve_field_size
 #define edwards_curve_field_bits torsion_edwards_curve_field_bits
 #define edwards_scratch_create torsion_edwards_scratch_create
 #define edwards_scratch_destroy torsion_edwards_scratch_destroy
+#define edwards_pubkey_destroy torsion_edwards_pubkey_destroy
+#define edwards_mul_multi torsion_edwards_mul_multi
 
 #define ecdsa_privkey_size torsion_ecdsa_privkey_size
 #define ecdsa_pubkey_size torsion_ecdsa_pubkey_size
@@ -78,6 +83,8 @@ extern "C" {
 #define ecdsa_sign torsion_ecdsa_sign
 #define ecdsa_sign_internal torsion_ecdsa_sign_internal
 #define ecdsa_verify torsion_ecdsa_verify
+#define ecdsa_pubkey_parse torsion_ecdsa_pubkey_parse
+#define ecdsa_verify_parsed torsion_ecdsa_verify_parsed
 #define ecdsa_recover torsion_ecdsa_recover
 #define ecdsa_derive torsion_ecdsa_derive
 
@@ -113,6 +120,8 @@ extern "C" {
 #define schnorr_pubkey_combine torsion_schnorr_pubkey_combine
 #define schnorr_sign torsion_schnorr_sign
 #define schnorr_verify torsion_schnorr_verify
+#define schnorr_pubkey_parse torsion_schnorr_pubkey_parse
+#define schnorr_verify_parsed torsion_schnorr_verify_parsed
 #define schnorr_verify_batch torsion_schnorr_verify_batch
 #define schnorr_derive torsion_schnorr_derive
 
@@ -175,6 +184,8 @@ extern "C" {
 #define eddsa_sign_tweak_add torsion_eddsa_sign_tweak_add
 #define eddsa_sign_tweak_mul torsion_eddsa_sign_tweak_mul
 #define eddsa_verify torsion_eddsa_verify
+#define eddsa_pubkey_parse torsion_eddsa_pubkey_parse
+#define eddsa_verify_parsed torsion_eddsa_verify_parsed
 #define eddsa_verify_single torsion_eddsa_verify_single
 #define eddsa_verify_batch torsion_eddsa_verify_batch
 #define eddsa_derive_with_scalar torsion_eddsa_derive_with_scalar
@@ -248,6 +259,8 @@ typedef struct wei_scratch_s wei_scratch_t;
 typedef struct mont_s mont_curve_t;
 typedef struct edwards_s edwards_curve_t;
 typedef struct edwards_scratch_s edwards_scratch_t;
+typedef struct wei_pubkey_s wei_pubkey_t;
+typedef struct edwards_pubkey_s edwards_pubkey_t;
 
 typedef void ecdsa_redefine_f(void *, size_t);
 
@@ -264,6 +277,9 @@ wei_curve_destroy(wei_curve_t *ec);
 TORSION_EXTERN void
 wei_curve_randomize(wei_curve_t *ec, const unsigned char *entropy);
 
+TORSION_EXTERN int
+wei_curve_precompute(wei_curve_t *ec, unsigned int width);
+
 TORSION_EXTERN size_t
 wei_curve_scalar_size(const wei_curve_t *ec);
 
@@ -282,6 +298,9 @@ wei_scratch_create(const wei_curve_t *ec, size_t size);
 TORSION_EXTERN void
 wei_scratch_destroy(const wei_curve_t *ec, wei_scratch_t *scratch);
 
+TORSION_EXTERN void
+wei_pubkey_destroy(wei_pubkey_t *key);
+
 /*
  * Montgomery Curve
  */
@@ -317,6 +336,9 @@ edwards_curve_destroy(edwards_curve_t *ec);
 TORSION_EXTERN void
 edwards_curve_randomize(edwards_curve_t *ec, const unsigned char *entropy);
 
+TORSION_EXTERN int
+edwards_curve_precompute(edwards_curve_t *ec, unsigned int width);
+
 TORSION_EXTERN size_t
 edwards_curve_scalar_size(const edwards_curve_t *ec);
 
@@ -335,6 +357,18 @@ edwards_scratch_create(const edwards_curve_t *ec, size_t size);
 TORSION_EXTERN void
 edwards_scratch_destroy(const edwards_curve_t *ec, edwards_scratch_t *scratch);
 
+TORSION_EXTERN void
+edwards_pubkey_destroy(edwards_pubkey_t *key);
+
+TORSION_EXTERN int
+edwards_mul_multi(const edwards_curve_t *ec,
+                  unsigned char *out,
+                  const unsigned char *scalar,
+                  const unsigned char *const *points,
+                  const unsigned char *const *scalars,
+                  size_t len,
+                  edwards_scratch_t *scratch);
+
 /*
  * ECDSA
  */
@@ -548,6 +582,18 @@ ecdsa_verify(const wei_curve_t *ec,
              const unsigned char *pub,
              size_t pub_len);
 
+TORSION_EXTERN wei_pubkey_t *
+ecdsa_pubkey_parse(const wei_curve_t *ec,
+                   const unsigned char *pub,
+                   size_t pub_len);
+
+TORSION_EXTERN int
+ecdsa_verify_parsed(const wei_curve_t *ec,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const unsigned char *sig,
+                    const wei_pubkey_t *key);
+
 TORSION_EXTERN int
 ecdsa_recover(const wei_curve_t *ec,
               unsigned char *pub,
@@ -776,6 +822,16 @@ schnorr_verify(const wei_curve_t *ec,
                const unsigned char *sig,
                const unsigned char *pub);
 
+TORSION_EXTERN wei_pubkey_t *
+schnorr_pubkey_parse(const wei_curve_t *ec, const unsigned char *pub);
+
+TORSION_EXTERN int
+schnorr_verify_parsed(const wei_curve_t *ec,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *sig,
+                      const wei_pubkey_t *key);
+
 TORSION_EXTERN int
 schnorr_verify_batch(const wei_curve_t *ec,
                      const unsigned char *const *msgs,
@@ -1112,6 +1168,19 @@ eddsa_verify(const edwards_curve_t *ec,
              const unsigned char *ctx,
              size_t ctx_len);
 
+TORSION_EXTERN edwards_pubkey_t *
+eddsa_pubkey_parse(const edwards_curve_t *ec, const unsigned char *pub);
+
+TORSION_EXTERN int
+eddsa_verify_parsed(const edwards_curve_t *ec,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const unsigned char *sig,
+                    const edwards_pubkey_t *key,
+                    int ph,
+                    const unsigned char *ctx,
+                    size_t ctx_len);
+
 TORSION_EXTERN int
 eddsa_verify_single(const edwards_curve_t *ec,
                     const unsigned char *msg,
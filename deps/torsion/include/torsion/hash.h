@@ -58,6 +58,7 @@ extern "C" {
 #define hash256_init torsion_hash256_init
 #define hash256_update torsion_hash256_update
 #define hash256_final torsion_hash256_final
+#define hash256_multi torsion_hash256_multi
 #define keccak_init torsion_keccak_init
 #define keccak_update torsion_keccak_update
 #define keccak_final torsion_keccak_final
@@ -97,12 +98,16 @@ extern "C" {
 #define sha256_init torsion_sha256_init
 #define sha256_update torsion_sha256_update
 #define sha256_final torsion_sha256_final
+#define sha256_multi torsion_sha256_multi
+#define sha256_compress torsion_sha256_compress
+#define sha256_compress_multi torsion_sha256_compress_multi
 #define sha384_init torsion_sha384_init
 #define sha384_update torsion_sha384_update
 #define sha384_final torsion_sha384_final
 #define sha512_init torsion_sha512_init
 #define sha512_update torsion_sha512_update
 #define sha512_final torsion_sha512_final
+#define sha512_compress torsion_sha512_compress
 #define sha3_224_init torsion_sha3_224_init
 #define sha3_224_update torsion_sha3_224_update
 #define sha3_224_final torsion_sha3_224_final
@@ -389,6 +394,12 @@ hash256_update(hash256_t *ctx, const void *data, size_t len);
 TORSION_EXTERN void
 hash256_final(hash256_t *ctx, unsigned char *out);
 
+TORSION_EXTERN void
+hash256_multi(unsigned char *out,
+              const unsigned char *const *items,
+              const size_t *lens,
+              size_t len);
+
 /*
  * Keccak
  */
@@ -525,6 +536,20 @@ sha256_update(sha256_t *ctx, const void *data, size_t len);
 TORSION_EXTERN void
 sha256_final(sha256_t *ctx, unsigned char *out);
 
+TORSION_EXTERN void
+sha256_multi(unsigned char *out,
+             const unsigned char *const *items,
+             const size_t *lens,
+             size_t len);
+
+TORSION_EXTERN void
+sha256_compress(sha256_t *ctx, const unsigned char *blocks, size_t len);
+
+TORSION_EXTERN void
+sha256_compress_multi(sha256_t *ctxs,
+                      const unsigned char *const *blocks,
+                      size_t len);
+
 /*
  * SHA384
  */
@@ -551,6 +576,9 @@ sha512_update(sha512_t *ctx, const void *data, size_t len);
 TORSION_EXTERN void
 sha512_final(sha512_t *ctx, unsigned char *out);
 
+TORSION_EXTERN void
+sha512_compress(sha512_t *ctx, const unsigned char *blocks, size_t len);
+
 /*
  * SHA3-{224,256,384,512}
  */
@@ -30,9 +30,13 @@ extern "C" {
 #define hkdf_extract torsion_hkdf_extract
 #define hkdf_expand torsion_hkdf_expand
 #define pbkdf2_derive torsion_pbkdf2_derive
+#define pbkdf2_derive_multi torsion_pbkdf2_derive_multi
 #define pgpdf_derive_simple torsion_pgpdf_derive_simple
 #define pgpdf_derive_salted torsion_pgpdf_derive_salted
 #define pgpdf_derive_iterated torsion_pgpdf_derive_iterated
+#define scrypt_init torsion_scrypt_init
+#define scrypt_mix torsion_scrypt_mix
+#define scrypt_final torsion_scrypt_final
 #define scrypt_derive torsion_scrypt_derive
 
 /*
@@ -126,6 +130,17 @@ pbkdf2_derive(unsigned char *out,
               uint32_t iter,
               size_t len);
 
+TORSION_EXTERN int
+pbkdf2_derive_multi(unsigned char *out,
+                    int type,
+                    const unsigned char *const *passes,
+                    const size_t *pass_lens,
+                    const unsigned char *const *salts,
+                    const size_t *salt_lens,
+                    size_t count,
+                    uint32_t iter,
+                    size_t len);
+
 /*
  * PGPDF
  */
@@ -160,6 +175,28 @@ pgpdf_derive_iterated(unsigned char *out,
  * Scrypt
  */
 
+TORSION_EXTERN int
+scrypt_init(unsigned char *B,
+            const unsigned char *pass,
+            size_t pass_len,
+            const unsigned char *salt,
+            size_t salt_len,
+            uint64_t N,
+            uint32_t r,
+            uint32_t p);
+
+TORSION_EXTERN int
+scrypt_mix(unsigned char *B, uint64_t N, uint32_t r, uint32_t lanes);
+
+TORSION_EXTERN int
+scrypt_final(unsigned char *out,
+             const unsigned char *pass,
+             size_t pass_len,
+             const unsigned char *B,
+             uint32_t r,
+             uint32_t p,
+             size_t len);
+
 TORSION_EXTERN int
 scrypt_derive(unsigned char *out,
               const unsigned char *pass,
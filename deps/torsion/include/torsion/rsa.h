@@ -20,6 +20,8 @@ extern "C" {
  */
 
 #define rsa_privkey_generate torsion_rsa_privkey_generate
+#define rsa_prime_generate torsion_rsa_prime_generate
+#define rsa_privkey_from_primes torsion_rsa_privkey_from_primes
 #define rsa_privkey_bits torsion_rsa_privkey_bits
 #define rsa_privkey_verify torsion_rsa_privkey_verify
 #define rsa_privkey_import torsion_rsa_privkey_import
@@ -41,6 +43,19 @@ extern "C" {
 #define rsa_decrypt_raw torsion_rsa_decrypt_raw
 #define rsa_veil torsion_rsa_veil
 #define rsa_unveil torsion_rsa_unveil
+#define rsa_privkey_parse torsion_rsa_privkey_parse
+#define rsa_privkey_destroy torsion_rsa_privkey_destroy
+#define rsa_privkey_parsed_bits torsion_rsa_privkey_parsed_bits
+#define rsa_sign_parsed torsion_rsa_sign_parsed
+#define rsa_decrypt_parsed torsion_rsa_decrypt_parsed
+#define rsa_sign_pss_parsed torsion_rsa_sign_pss_parsed
+#define rsa_decrypt_oaep_parsed torsion_rsa_decrypt_oaep_parsed
+
+/*
+ * Types
+ */
+
+typedef struct rsa_privkey_s rsa_privkey_t;
 
 /*
  * Defs
@@ -103,6 +118,25 @@ rsa_privkey_generate(unsigned char *out,
                      uint64_t exp,
                      const unsigned char *entropy);
 
+TORSION_EXTERN int
+rsa_prime_generate(unsigned char *out,
+                   size_t *out_len,
+                   unsigned long bits,
+                   uint64_t exp,
+                   const unsigned char *entropy,
+                   const volatile int *stop);
+
+TORSION_EXTERN int
+rsa_privkey_from_primes(unsigned char *out,
+                        size_t *out_len,
+                        unsigned long bits,
+                        uint64_t exp,
+                        const unsigned char *p,
+                        size_t p_len,
+                        const unsigned char *q,
+                        size_t q_len,
+                        const unsigned char *entropy);
+
 TORSION_EXTERN size_t
 rsa_privkey_bits(const unsigned char *key, size_t key_len);
 
@@ -247,6 +281,55 @@ rsa_unveil(unsigned char *out,
            const unsigned char *key,
            size_t key_len);
 
+/*
+ * Parsed Keys
+ */
+
+TORSION_EXTERN rsa_privkey_t *
+rsa_privkey_parse(const unsigned char *key,
+                  size_t key_len,
+                  const unsigned char *entropy);
+
+TORSION_EXTERN void
+rsa_privkey_destroy(rsa_privkey_t *key);
+
+TORSION_EXTERN size_t
+rsa_privkey_parsed_bits(const rsa_privkey_t *key);
+
+TORSION_EXTERN int
+rsa_sign_parsed(unsigned char *out,
+                size_t *out_len,
+                int type,
+                const unsigned char *msg,
+                size_t msg_len,
+                rsa_privkey_t *key);
+
+TORSION_EXTERN int
+rsa_decrypt_parsed(unsigned char *out,
+                   size_t *out_len,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   rsa_privkey_t *key);
+
+TORSION_EXTERN int
+rsa_sign_pss_parsed(unsigned char *out,
+                    size_t *out_len,
+                    int type,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    rsa_privkey_t *key,
+                    int salt_len);
+
+TORSION_EXTERN int
+rsa_decrypt_oaep_parsed(unsigned char *out,
+                        size_t *out_len,
+                        int type,
+                        const unsigned char *msg,
+                        size_t msg_len,
+                        rsa_privkey_t *key,
+                        const unsigned char *label,
+                        size_t label_len);
+
 #ifdef __cplusplus
 }
 #endif
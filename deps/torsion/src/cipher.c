@@ -34,11 +34,15 @@
 #include <torsion/cipher.h>
 #include <torsion/util.h>
 #include "bio.h"
+#include "entropy/entropy.h"
 
 /*
  * Constants
  */
 
+/* Bulk modes work on this many bytes at a time. */
+#define CIPHER_CHUNK_SIZE 256
+
 static const unsigned char zero64[64] = {0};
 
 /* Shifted by four. */
@@ -61,6 +65,7 @@ static const uint32_t poly_table[9] = {
  *   https://en.wikipedia.org/wiki/Advanced_Encryption_Standard
  *   http://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.197.pdf
  *   https://github.com/openssl/openssl/blob/master/crypto/aes/aes_core.c
+ *   https://www.intel.com/content/dam/doc/white-paper/advanced-encryption-standard-new-instructions-set-paper.pdf
  */
 
 #define TE0 aes_TE0
@@ -833,8 +838,10 @@ aes_init_decrypt(aes_t *ctx) {
   }
 }
 
-void
-aes_encrypt(const aes_t *ctx, unsigned char *dst, const unsigned char *src) {
+static void
+aes_encrypt_tables(const aes_t *ctx,
+                   unsigned char *dst,
+                   const unsigned char *src) {
   const uint32_t *K = ctx->enckey;
   uint32_t s0 = read32be(src +  0) ^ K[0];
   uint32_t s1 = read32be(src +  4) ^ K[1];
@@ -930,8 +937,10 @@ aes_encrypt(const aes_t *ctx, unsigned char *dst, const unsigned char *src) {
   write32be(dst + 12, s3);
 }
 
-void
-aes_decrypt(const aes_t *ctx, unsigned char *dst, const unsigned char *src) {
+static void
+aes_decrypt_tables(const aes_t *ctx,
+                   unsigned char *dst,
+                   const unsigned char *src) {
   const uint32_t *K = ctx->deckey;
   uint32_t s0 = read32be(src +  0) ^ K[0];
   uint32_t s1 = read32be(src +  4) ^ K[1];
@@ -1027,6 +1036,334 @@ aes_decrypt(const aes_t *ctx, unsigned char *dst, const unsigned char *src) {
   write32be(dst + 12, s3);
 }
 
+#if defined(TORSION_HAVE_ASM_X64)
+static const unsigned char aes_ni_bswap[16] = {
+  0x03, 0x02, 0x01, 0x00, 0x07, 0x06, 0x05, 0x04,
+  0x0b, 0x0a, 0x09, 0x08, 0x0f, 0x0e, 0x0d, 0x0c
+};
+
+static int
+aes_has_ni(void) {
+  return torsion_cpu_has(TORSION_CPU_AES | TORSION_CPU_SSSE3);
+}
+
+static void
+aes_ni_encrypt(const aes_t *ctx,
+               unsigned char *dst,
+               const unsigned char *src,
+               size_t blocks) {
+  /* AES-NI with 8-way interleaving. The round keys are
+   * stored as big-endian words for the table code, so
+   * each one is byte-swapped with pshufb as it is loaded.
+   *
+   * Registers:
+   *
+   *   %[k] = round key pointer (ctx->enckey)
+   *   %[r] = round counter (ctx->rounds - 1)
+   *   %[d] = dst pointer
+   *   %[s] = src pointer
+   *   %[m] = byte swap mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-9]
+   */
+  const uint32_t *k;
+  uint64_t r;
+
+  while (blocks >= 8) {
+    k = ctx->enckey;
+    r = ctx->rounds - 1;
+
+    __asm__ __volatile__(
+      "movups (%[m]), %%xmm9\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "movups (%[s]), %%xmm0\n"
+      "movups 16(%[s]), %%xmm1\n"
+      "movups 32(%[s]), %%xmm2\n"
+      "movups 48(%[s]), %%xmm3\n"
+      "movups 64(%[s]), %%xmm4\n"
+      "movups 80(%[s]), %%xmm5\n"
+      "movups 96(%[s]), %%xmm6\n"
+      "movups 112(%[s]), %%xmm7\n"
+      "pxor %%xmm8, %%xmm0\n"
+      "pxor %%xmm8, %%xmm1\n"
+      "pxor %%xmm8, %%xmm2\n"
+      "pxor %%xmm8, %%xmm3\n"
+      "pxor %%xmm8, %%xmm4\n"
+      "pxor %%xmm8, %%xmm5\n"
+      "pxor %%xmm8, %%xmm6\n"
+      "pxor %%xmm8, %%xmm7\n"
+
+      "1:\n"
+      "addq $16, %[k]\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesenc %%xmm8, %%xmm0\n"
+      "aesenc %%xmm8, %%xmm1\n"
+      "aesenc %%xmm8, %%xmm2\n"
+      "aesenc %%xmm8, %%xmm3\n"
+      "aesenc %%xmm8, %%xmm4\n"
+      "aesenc %%xmm8, %%xmm5\n"
+      "aesenc %%xmm8, %%xmm6\n"
+      "aesenc %%xmm8, %%xmm7\n"
+      "decq %[r]\n"
+      "jnz 1b\n"
+
+      "movups 16(%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesenclast %%xmm8, %%xmm0\n"
+      "aesenclast %%xmm8, %%xmm1\n"
+      "aesenclast %%xmm8, %%xmm2\n"
+      "aesenclast %%xmm8, %%xmm3\n"
+      "aesenclast %%xmm8, %%xmm4\n"
+      "aesenclast %%xmm8, %%xmm5\n"
+      "aesenclast %%xmm8, %%xmm6\n"
+      "aesenclast %%xmm8, %%xmm7\n"
+      "movups %%xmm0, (%[d])\n"
+      "movups %%xmm1, 16(%[d])\n"
+      "movups %%xmm2, 32(%[d])\n"
+      "movups %%xmm3, 48(%[d])\n"
+      "movups %%xmm4, 64(%[d])\n"
+      "movups %%xmm5, 80(%[d])\n"
+      "movups %%xmm6, 96(%[d])\n"
+      "movups %%xmm7, 112(%[d])\n"
+      : [k] "+r" (k), [r] "+r" (r)
+      : [d] "r" (dst), [s] "r" (src), [m] "r" (aes_ni_bswap)
+      : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+        "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "cc", "memory"
+    );
+
+    dst += 128;
+    src += 128;
+    blocks -= 8;
+  }
+
+  while (blocks > 0) {
+    k = ctx->enckey;
+    r = ctx->rounds - 1;
+
+    __asm__ __volatile__(
+      "movups (%[m]), %%xmm9\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "movups (%[s]), %%xmm0\n"
+      "pxor %%xmm8, %%xmm0\n"
+
+      "1:\n"
+      "addq $16, %[k]\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesenc %%xmm8, %%xmm0\n"
+      "decq %[r]\n"
+      "jnz 1b\n"
+
+      "movups 16(%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesenclast %%xmm8, %%xmm0\n"
+      "movups %%xmm0, (%[d])\n"
+      : [k] "+r" (k), [r] "+r" (r)
+      : [d] "r" (dst), [s] "r" (src), [m] "r" (aes_ni_bswap)
+      : "xmm0", "xmm8", "xmm9", "cc", "memory"
+    );
+
+    dst += 16;
+    src += 16;
+    blocks -= 1;
+  }
+}
+
+static void
+aes_ni_decrypt(const aes_t *ctx,
+               unsigned char *dst,
+               const unsigned char *src,
+               size_t blocks) {
+  /* AES-NI with 8-way interleaving. The round keys are
+   * stored as big-endian words for the table code, so
+   * each one is byte-swapped with pshufb as it is loaded.
+   *
+   * Registers:
+   *
+   *   %[k] = round key pointer (ctx->deckey)
+   *   %[r] = round counter (ctx->rounds - 1)
+   *   %[d] = dst pointer
+   *   %[s] = src pointer
+   *   %[m] = byte swap mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-9]
+   */
+  const uint32_t *k;
+  uint64_t r;
+
+  while (blocks >= 8) {
+    k = ctx->deckey;
+    r = ctx->rounds - 1;
+
+    __asm__ __volatile__(
+      "movups (%[m]), %%xmm9\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "movups (%[s]), %%xmm0\n"
+      "movups 16(%[s]), %%xmm1\n"
+      "movups 32(%[s]), %%xmm2\n"
+      "movups 48(%[s]), %%xmm3\n"
+      "movups 64(%[s]), %%xmm4\n"
+      "movups 80(%[s]), %%xmm5\n"
+      "movups 96(%[s]), %%xmm6\n"
+      "movups 112(%[s]), %%xmm7\n"
+      "pxor %%xmm8, %%xmm0\n"
+      "pxor %%xmm8, %%xmm1\n"
+      "pxor %%xmm8, %%xmm2\n"
+      "pxor %%xmm8, %%xmm3\n"
+      "pxor %%xmm8, %%xmm4\n"
+      "pxor %%xmm8, %%xmm5\n"
+      "pxor %%xmm8, %%xmm6\n"
+      "pxor %%xmm8, %%xmm7\n"
+
+      "1:\n"
+      "addq $16, %[k]\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesdec %%xmm8, %%xmm0\n"
+      "aesdec %%xmm8, %%xmm1\n"
+      "aesdec %%xmm8, %%xmm2\n"
+      "aesdec %%xmm8, %%xmm3\n"
+      "aesdec %%xmm8, %%xmm4\n"
+      "aesdec %%xmm8, %%xmm5\n"
+      "aesdec %%xmm8, %%xmm6\n"
+      "aesdec %%xmm8, %%xmm7\n"
+      "decq %[r]\n"
+      "jnz 1b\n"
+
+      "movups 16(%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesdeclast %%xmm8, %%xmm0\n"
+      "aesdeclast %%xmm8, %%xmm1\n"
+      "aesdeclast %%xmm8, %%xmm2\n"
+      "aesdeclast %%xmm8, %%xmm3\n"
+      "aesdeclast %%xmm8, %%xmm4\n"
+      "aesdeclast %%xmm8, %%xmm5\n"
+      "aesdeclast %%xmm8, %%xmm6\n"
+      "aesdeclast %%xmm8, %%xmm7\n"
+      "movups %%xmm0, (%[d])\n"
+      "movups %%xmm1, 16(%[d])\n"
+      "movups %%xmm2, 32(%[d])\n"
+      "movups %%xmm3, 48(%[d])\n"
+      "movups %%xmm4, 64(%[d])\n"
+      "movups %%xmm5, 80(%[d])\n"
+      "movups %%xmm6, 96(%[d])\n"
+      "movups %%xmm7, 112(%[d])\n"
+      : [k] "+r" (k), [r] "+r" (r)
+      : [d] "r" (dst), [s] "r" (src), [m] "r" (aes_ni_bswap)
+      : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+        "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "cc", "memory"
+    );
+
+    dst += 128;
+    src += 128;
+    blocks -= 8;
+  }
+
+  while (blocks > 0) {
+    k = ctx->deckey;
+    r = ctx->rounds - 1;
+
+    __asm__ __volatile__(
+      "movups (%[m]), %%xmm9\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "movups (%[s]), %%xmm0\n"
+      "pxor %%xmm8, %%xmm0\n"
+
+      "1:\n"
+      "addq $16, %[k]\n"
+      "movups (%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesdec %%xmm8, %%xmm0\n"
+      "decq %[r]\n"
+      "jnz 1b\n"
+
+      "movups 16(%[k]), %%xmm8\n"
+      "pshufb %%xmm9, %%xmm8\n"
+      "aesdeclast %%xmm8, %%xmm0\n"
+      "movups %%xmm0, (%[d])\n"
+      : [k] "+r" (k), [r] "+r" (r)
+      : [d] "r" (dst), [s] "r" (src), [m] "r" (aes_ni_bswap)
+      : "xmm0", "xmm8", "xmm9", "cc", "memory"
+    );
+
+    dst += 16;
+    src += 16;
+    blocks -= 1;
+  }
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
+void
+aes_encrypt(const aes_t *ctx, unsigned char *dst, const unsigned char *src) {
+#if defined(TORSION_HAVE_ASM_X64)
+  if (aes_has_ni()) {
+    aes_ni_encrypt(ctx, dst, src, 1);
+    return;
+  }
+#endif
+
+  aes_encrypt_tables(ctx, dst, src);
+}
+
+void
+aes_decrypt(const aes_t *ctx, unsigned char *dst, const unsigned char *src) {
+#if defined(TORSION_HAVE_ASM_X64)
+  if (aes_has_ni()) {
+    aes_ni_decrypt(ctx, dst, src, 1);
+    return;
+  }
+#endif
+
+  aes_decrypt_tables(ctx, dst, src);
+}
+
+static void
+aes_encrypt_blocks(const aes_t *ctx,
+                   unsigned char *dst,
+                   const unsigned char *src,
+                   size_t blocks) {
+#if defined(TORSION_HAVE_ASM_X64)
+  if (aes_has_ni()) {
+    aes_ni_encrypt(ctx, dst, src, blocks);
+    return;
+  }
+#endif
+
+  while (blocks--) {
+    aes_encrypt_tables(ctx, dst, src);
+    dst += 16;
+    src += 16;
+  }
+}
+
+static void
+aes_decrypt_blocks(const aes_t *ctx,
+                   unsigned char *dst,
+                   const unsigned char *src,
+                   size_t blocks) {
+#if defined(TORSION_HAVE_ASM_X64)
+  if (aes_has_ni()) {
+    aes_ni_decrypt(ctx, dst, src, blocks);
+    return;
+  }
+#endif
+
+  while (blocks--) {
+    aes_decrypt_tables(ctx, dst, src);
+    dst += 16;
+    src += 16;
+  }
+}
+
 #undef TE0
 #undef TE1
 #undef TE2
@@ -5893,6 +6230,54 @@ cipher_decrypt(const cipher_t *ctx,
   }
 }
 
+static void
+cipher_encrypt_blocks(const cipher_t *ctx,
+                      unsigned char *dst,
+                      const unsigned char *src,
+                      size_t len) {
+  /* Multi-block encryption for the bulk modes. AES
+     pipelines several blocks at once when it can. */
+  switch (ctx->type) {
+    case CIPHER_AES128:
+    case CIPHER_AES192:
+    case CIPHER_AES256:
+      aes_encrypt_blocks(&ctx->ctx.aes, dst, src, len >> 4);
+      break;
+    default:
+      while (len > 0) {
+        cipher_encrypt(ctx, dst, src);
+
+        dst += ctx->size;
+        src += ctx->size;
+        len -= ctx->size;
+      }
+      break;
+  }
+}
+
+static void
+cipher_decrypt_blocks(const cipher_t *ctx,
+                      unsigned char *dst,
+                      const unsigned char *src,
+                      size_t len) {
+  switch (ctx->type) {
+    case CIPHER_AES128:
+    case CIPHER_AES192:
+    case CIPHER_AES256:
+      aes_decrypt_blocks(&ctx->ctx.aes, dst, src, len >> 4);
+      break;
+    default:
+      while (len > 0) {
+        cipher_decrypt(ctx, dst, src);
+
+        dst += ctx->size;
+        src += ctx->size;
+        len -= ctx->size;
+      }
+      break;
+  }
+}
+
 /*
  * ECB
  */
@@ -5902,13 +6287,7 @@ ecb_encrypt(const cipher_t *cipher, unsigned char *dst,
             const unsigned char *src, size_t len) {
   CHECK((len % cipher->size) == 0);
 
-  while (len > 0) {
-    cipher_encrypt(cipher, dst, src);
-
-    dst += cipher->size;
-    src += cipher->size;
-    len -= cipher->size;
-  }
+  cipher_encrypt_blocks(cipher, dst, src, len);
 }
 
 void
@@ -5916,13 +6295,7 @@ ecb_decrypt(const cipher_t *cipher, unsigned char *dst,
             const unsigned char *src, size_t len) {
   CHECK((len % cipher->size) == 0);
 
-  while (len > 0) {
-    cipher_decrypt(cipher, dst, src);
-
-    dst += cipher->size;
-    src += cipher->size;
-    len -= cipher->size;
-  }
+  cipher_decrypt_blocks(cipher, dst, src, len);
 }
 
 void
@@ -5996,39 +6369,33 @@ cbc_encrypt(cbc_t *mode, const cipher_t *cipher,
 void
 cbc_decrypt(cbc_t *mode, const cipher_t *cipher,
             unsigned char *dst, const unsigned char *src, size_t len) {
-  size_t i;
+  /* Unlike encryption, CBC decryption can be done
+     several blocks at a time. We keep a copy of the
+     ciphertext in case the operation is in-place. */
+  unsigned char tmp[CIPHER_CHUNK_SIZE];
+  size_t size = cipher->size;
+  size_t i, n;
 
-  CHECK((len % cipher->size) == 0);
+  CHECK((len % size) == 0);
 
-  if (dst == src) {
-    unsigned char prev[CIPHER_MAX_BLOCK_SIZE];
+  while (len > 0) {
+    n = len < sizeof(tmp) ? len : sizeof(tmp);
 
-    while (len > 0) {
-      memcpy(prev, mode->prev, cipher->size);
-      memcpy(mode->prev, src, cipher->size);
+    memcpy(tmp, src, n);
 
-      cipher_decrypt(cipher, dst, src);
+    cipher_decrypt_blocks(cipher, dst, src, n);
 
-      for (i = 0; i < cipher->size; i++)
-        dst[i] ^= prev[i];
+    for (i = 0; i < size; i++)
+      dst[i] ^= mode->prev[i];
 
-      dst += cipher->size;
-      src += cipher->size;
-      len -= cipher->size;
-    }
-  } else {
-    while (len > 0) {
-      cipher_decrypt(cipher, dst, src);
-
-      for (i = 0; i < cipher->size; i++)
-        dst[i] ^= mode->prev[i];
+    for (i = size; i < n; i++)
+      dst[i] ^= tmp[i - size];
 
-      memcpy(mode->prev, src, cipher->size);
+    memcpy(mode->prev, tmp + n - size, size);
 
-      dst += cipher->size;
-      src += cipher->size;
-      len -= cipher->size;
-    }
+    dst += n;
+    src += n;
+    len -= n;
   }
 }
 
@@ -6129,55 +6496,76 @@ xts_shift(uint8_t *dst, const uint8_t *src, size_t size) {
   dst[0] ^= (uint8_t)(poly >>  0) & -cy;
 }
 
+static size_t
+xts_tweaks(xts_t *mode, const cipher_t *cipher,
+           unsigned char *tweaks, size_t len) {
+  /* Compute the tweaks for up to one chunk. */
+  size_t n = len < CIPHER_CHUNK_SIZE ? len : CIPHER_CHUNK_SIZE;
+  size_t i;
+
+  for (i = 0; i < n; i += cipher->size) {
+    memcpy(tweaks + i, mode->tweak, cipher->size);
+    xts_shift(mode->tweak, mode->tweak, cipher->size);
+  }
+
+  return n;
+}
+
 void
 xts_encrypt(xts_t *mode, const cipher_t *cipher,
             unsigned char *dst, const unsigned char *src, size_t len) {
-  size_t i;
+  unsigned char tweaks[CIPHER_CHUNK_SIZE];
+  size_t i, n;
 
   CHECK((len % cipher->size) == 0);
 
   while (len > 0) {
-    for (i = 0; i < cipher->size; i++)
-      dst[i] = src[i] ^ mode->tweak[i];
+    n = xts_tweaks(mode, cipher, tweaks, len);
 
-    cipher_encrypt(cipher, dst, dst);
+    for (i = 0; i < n; i++)
+      dst[i] = src[i] ^ tweaks[i];
 
-    for (i = 0; i < cipher->size; i++)
-      dst[i] ^= mode->tweak[i];
+    cipher_encrypt_blocks(cipher, dst, dst, n);
 
-    xts_shift(mode->tweak, mode->tweak, cipher->size);
+    for (i = 0; i < n; i++)
+      dst[i] ^= tweaks[i];
 
-    dst += cipher->size;
-    src += cipher->size;
-    len -= cipher->size;
+    dst += n;
+    src += n;
+    len -= n;
   }
+
+  torsion_cleanse(tweaks, sizeof(tweaks));
 }
 
 void
 xts_decrypt(xts_t *mode, const cipher_t *cipher,
             unsigned char *dst, const unsigned char *src, size_t len) {
-  size_t i;
+  unsigned char tweaks[CIPHER_CHUNK_SIZE];
+  size_t i, n;
 
   CHECK((len % cipher->size) == 0);
 
   while (len > 0) {
-    if (len == cipher->size)
-      memcpy(mode->prev, mode->tweak, cipher->size);
+    n = xts_tweaks(mode, cipher, tweaks, len);
 
-    for (i = 0; i < cipher->size; i++)
-      dst[i] = src[i] ^ mode->tweak[i];
+    if (n == len)
+      memcpy(mode->prev, tweaks + n - cipher->size, cipher->size);
 
-    cipher_decrypt(cipher, dst, dst);
+    for (i = 0; i < n; i++)
+      dst[i] = src[i] ^ tweaks[i];
 
-    for (i = 0; i < cipher->size; i++)
-      dst[i] ^= mode->tweak[i];
+    cipher_decrypt_blocks(cipher, dst, dst, n);
 
-    xts_shift(mode->tweak, mode->tweak, cipher->size);
+    for (i = 0; i < n; i++)
+      dst[i] ^= tweaks[i];
 
-    dst += cipher->size;
-    src += cipher->size;
-    len -= cipher->size;
+    dst += n;
+    src += n;
+    len -= n;
   }
+
+  torsion_cleanse(tweaks, sizeof(tweaks));
 }
 
 void
@@ -6273,23 +6661,54 @@ ctr_init(ctr_t *mode, const cipher_t *cipher, const unsigned char *iv) {
   mode->pos = 0;
 }
 
+static void
+ctr_increment(uint8_t *ctr, size_t size) {
+  while (size--) {
+    if (++ctr[size] != 0x00)
+      break;
+  }
+}
+
 void
 ctr_crypt(ctr_t *mode, const cipher_t *cipher,
           unsigned char *dst, const unsigned char *src, size_t len) {
-  size_t mask = cipher->size - 1;
-  size_t i, j;
+  unsigned char tmp[CIPHER_CHUNK_SIZE];
+  size_t size = cipher->size;
+  size_t mask = size - 1;
+  size_t i, n;
+
+  /* Encrypt whole counter blocks in bulk. */
+  if ((mode->pos & mask) == 0 && len >= size) {
+    while (len >= size) {
+      n = len < sizeof(tmp) ? len : sizeof(tmp);
+      n -= n & mask;
+
+      for (i = 0; i < n; i += size) {
+        memcpy(tmp + i, mode->ctr, size);
+        ctr_increment(mode->ctr, size);
+      }
 
-  for (i = 0; i < len; i++) {
-    if ((mode->pos & mask) == 0) {
-      cipher_encrypt(cipher, mode->state, mode->ctr);
+      cipher_encrypt_blocks(cipher, tmp, tmp, n);
 
-      j = cipher->size;
+      for (i = 0; i < n; i++)
+        dst[i] = src[i] ^ tmp[i];
 
-      while (j--) {
-        if (++mode->ctr[j] != 0x00)
-          break;
-      }
+      memcpy(mode->state, tmp + n - size, size);
+
+      mode->pos = size;
 
+      dst += n;
+      src += n;
+      len -= n;
+    }
+
+    torsion_cleanse(tmp, sizeof(tmp));
+  }
+
+  for (i = 0; i < len; i++) {
+    if ((mode->pos & mask) == 0) {
+      cipher_encrypt(cipher, mode->state, mode->ctr);
+      ctr_increment(mode->ctr, size);
       mode->pos = 0;
     }
 
@@ -6384,6 +6803,7 @@ ofb_crypt(ofb_t *mode, const cipher_t *cipher,
  *   https://github.com/golang/go/blob/master/src/crypto/cipher/gcm.go
  *   https://github.com/golang/go/blob/master/src/crypto/cipher/gcm_test.go
  *   https://github.com/DaGenix/rust-crypto/blob/master/src/ghash.rs
+ *   https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/carry-less-multiplication-instruction-in-gcm-mode-paper.pdf
  */
 
 typedef struct __ghash_s ghash_t;
@@ -6452,12 +6872,174 @@ gfe_mul(gfe_t *r, const gfe_t *x, const gfe_t *table) {
   *r = z;
 }
 
+#if defined(TORSION_HAVE_ASM_X64)
+static const unsigned char ghash_bswap[16] = {
+  0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00
+};
+
+static int
+ghash_has_clmul(void) {
+  return torsion_cpu_has(TORSION_CPU_PCLMUL | TORSION_CPU_SSSE3);
+}
+
 static void
-ghash_transform(ghash_t *ctx, const unsigned char *block) {
-  ctx->state.lo ^= read64be(block + 0);
-  ctx->state.hi ^= read64be(block + 8);
+ghash_clmul(gfe_t *state,
+            const gfe_t *powers,
+            const unsigned char *blocks,
+            size_t len) {
+  /* Absorb 1-8 blocks with a single reduction:
+   *
+   *   S = (S + X[0]) * H^n + X[1] * H^(n-1) + ... + X[n-1] * H
+   *
+   * Field elements are kept byte-reflected as in the
+   * Intel paper (Algorithms 1 and 5, Figure 5). Each
+   * product is done with four carry-less multiplies
+   * and the sum of the 256 bit products is reduced
+   * once at the end.
+   *
+   * Registers:
+   *
+   *   %[s] = state pointer
+   *   %[h] = powers pointer (starts at H^n, descends)
+   *   %[x] = blocks pointer
+   *   %[n] = block counter
+   *   %[m] = byte swap mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-9]
+   */
+  const gfe_t *h = &powers[len - 1];
+  uint64_t n = len;
+
+  ASSERT(len >= 1 && len <= 8);
+
+  __asm__ __volatile__(
+    "movups (%[m]), %%xmm1\n"
+    "movups (%[s]), %%xmm0\n"
+    "pshufd $0x4e, %%xmm0, %%xmm0\n"
+    "pxor %%xmm2, %%xmm2\n"
+    "pxor %%xmm3, %%xmm3\n"
+    "pxor %%xmm4, %%xmm4\n"
+
+    "movups (%[x]), %%xmm5\n"
+    "pshufb %%xmm1, %%xmm5\n"
+    "pxor %%xmm0, %%xmm5\n"
+    "jmp 2f\n"
+
+    "1:\n"
+    "movups (%[x]), %%xmm5\n"
+    "pshufb %%xmm1, %%xmm5\n"
+
+    "2:\n"
+    "movups (%[h]), %%xmm6\n"
+    "movdqa %%xmm5, %%xmm7\n"
+    "pclmulqdq $0x00, %%xmm6, %%xmm7\n"
+    "pxor %%xmm7, %%xmm2\n"
+    "movdqa %%xmm5, %%xmm7\n"
+    "pclmulqdq $0x11, %%xmm6, %%xmm7\n"
+    "pxor %%xmm7, %%xmm4\n"
+    "movdqa %%xmm5, %%xmm7\n"
+    "pclmulqdq $0x10, %%xmm6, %%xmm7\n"
+    "pxor %%xmm7, %%xmm3\n"
+    "pclmulqdq $0x01, %%xmm6, %%xmm5\n"
+    "pxor %%xmm5, %%xmm3\n"
+
+    "addq $16, %[x]\n"
+    "subq $16, %[h]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+
+    /* Fold the middle product into the 256 bit sum. */
+    "movdqa %%xmm3, %%xmm7\n"
+    "pslldq $8, %%xmm7\n"
+    "psrldq $8, %%xmm3\n"
+    "pxor %%xmm7, %%xmm2\n"
+    "pxor %%xmm3, %%xmm4\n"
+
+    /* Shift left by one (bit reflection). */
+    "movdqa %%xmm2, %%xmm7\n"
+    "psrld $31, %%xmm7\n"
+    "movdqa %%xmm4, %%xmm8\n"
+    "psrld $31, %%xmm8\n"
+    "pslld $1, %%xmm2\n"
+    "pslld $1, %%xmm4\n"
+    "movdqa %%xmm7, %%xmm9\n"
+    "psrldq $12, %%xmm9\n"
+    "pslldq $4, %%xmm8\n"
+    "pslldq $4, %%xmm7\n"
+    "por %%xmm7, %%xmm2\n"
+    "por %%xmm8, %%xmm4\n"
+    "por %%xmm9, %%xmm4\n"
+
+    /* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+    "movdqa %%xmm2, %%xmm7\n"
+    "pslld $31, %%xmm7\n"
+    "movdqa %%xmm2, %%xmm8\n"
+    "pslld $30, %%xmm8\n"
+    "movdqa %%xmm2, %%xmm9\n"
+    "pslld $25, %%xmm9\n"
+    "pxor %%xmm8, %%xmm7\n"
+    "pxor %%xmm9, %%xmm7\n"
+    "movdqa %%xmm7, %%xmm8\n"
+    "psrldq $4, %%xmm8\n"
+    "pslldq $12, %%xmm7\n"
+    "pxor %%xmm7, %%xmm2\n"
+
+    "movdqa %%xmm2, %%xmm5\n"
+    "psrld $1, %%xmm5\n"
+    "movdqa %%xmm2, %%xmm6\n"
+    "psrld $2, %%xmm6\n"
+    "movdqa %%xmm2, %%xmm7\n"
+    "psrld $7, %%xmm7\n"
+    "pxor %%xmm6, %%xmm5\n"
+    "pxor %%xmm7, %%xmm5\n"
+    "pxor %%xmm8, %%xmm5\n"
+    "pxor %%xmm5, %%xmm2\n"
+    "pxor %%xmm2, %%xmm4\n"
+
+    "pshufd $0x4e, %%xmm4, %%xmm4\n"
+    "movups %%xmm4, (%[s])\n"
+    : [h] "+r" (h), [x] "+r" (blocks), [n] "+r" (n)
+    : [s] "r" (state), [m] "r" (ghash_bswap)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+      "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "cc", "memory"
+  );
+}
+#endif /* TORSION_HAVE_ASM_X64 */
 
-  gfe_mul(&ctx->state, &ctx->state, ctx->table);
+static void
+ghash_blocks(ghash_t *ctx, const unsigned char *blocks, size_t len) {
+#if defined(TORSION_HAVE_ASM_X64)
+  if (ghash_has_clmul()) {
+    while (len > 0) {
+      size_t n = len < 8 ? len : 8;
+
+      ghash_clmul(&ctx->state, ctx->table, blocks, n);
+
+      blocks += n * 16;
+      len -= n;
+    }
+
+    return;
+  }
+#endif
+
+  while (len > 0) {
+    ctx->state.lo ^= read64be(blocks + 0);
+    ctx->state.hi ^= read64be(blocks + 8);
+
+    gfe_mul(&ctx->state, &ctx->state, ctx->table);
+
+    blocks += 16;
+    len -= 1;
+  }
+}
+
+static void
+ghash_transform(ghash_t *ctx, const unsigned char *block) {
+  ghash_blocks(ctx, block, 1);
 }
 
 static void
@@ -6488,10 +7070,10 @@ ghash_absorb(ghash_t *ctx, const unsigned char *data, size_t len) {
     ghash_transform(ctx, ctx->block);
   }
 
-  while (len >= 16) {
-    ghash_transform(ctx, data + off);
-    off += 16;
-    len -= 16;
+  if (len >= 16) {
+    ghash_blocks(ctx, data + off, len >> 4);
+    off += len & ~15;
+    len &= 15;
   }
 
   if (len > 0)
@@ -6524,6 +7106,24 @@ ghash_init(ghash_t *ctx, const unsigned char *key) {
     gfe_add(&ctx->table[revbits(i + 1)], &ctx->table[revbits(i)], &x);
   }
 
+#if defined(TORSION_HAVE_ASM_X64)
+  /* With PCLMULQDQ, the table holds H^1..H^8 in
+     reflected form (qwords swapped) instead. */
+  if (ghash_has_clmul()) {
+    gfe_t y = x;
+
+    ctx->table[0].lo = x.hi;
+    ctx->table[0].hi = x.lo;
+
+    for (i = 1; i < 8; i++) {
+      ghash_clmul(&y, ctx->table, zero64, 1);
+
+      ctx->table[i].lo = y.hi;
+      ctx->table[i].hi = y.lo;
+    }
+  }
+#endif
+
   /* Defensive memset. */
   memset(ctx->block, 0, 16);
 
@@ -6558,7 +7158,7 @@ ghash_final(ghash_t *ctx, unsigned char *out) {
   ctx->state.lo ^= ctx->adlen << 3;
   ctx->state.hi ^= ctx->ctlen << 3;
 
-  gfe_mul(&ctx->state, &ctx->state, ctx->table);
+  ghash_transform(ctx, zero64);
 
   write64be(out + 0, ctx->state.lo);
   write64be(out + 8, ctx->state.hi);
@@ -6568,28 +7168,59 @@ ghash_final(ghash_t *ctx, unsigned char *out) {
  * GCM
  */
 
+static void
+gcm_increment(uint8_t *ctr) {
+  unsigned int cy = 1;
+  size_t i = 4;
+
+  while (i--) {
+    cy += (unsigned int)ctr[12 + i];
+    ctr[12 + i] = cy;
+    cy >>= 8;
+  }
+}
+
 static void
 gcm_crypt(gcm_t *mode,
           const cipher_t *cipher,
           unsigned char *dst,
           const unsigned char *src,
           size_t len) {
-  unsigned int cy;
-  size_t i, j;
+  unsigned char tmp[CIPHER_CHUNK_SIZE];
+  size_t i, n;
+
+  /* Encrypt whole counter blocks in bulk. */
+  if ((mode->pos & 15) == 0 && len >= 16) {
+    while (len >= 16) {
+      n = len < sizeof(tmp) ? len : sizeof(tmp);
+      n -= n & 15;
+
+      for (i = 0; i < n; i += 16) {
+        memcpy(tmp + i, mode->ctr, 16);
+        gcm_increment(mode->ctr);
+      }
 
-  for (i = 0; i < len; i++) {
-    if ((mode->pos & 15) == 0) {
-      cipher_encrypt(cipher, mode->state, mode->ctr);
+      cipher_encrypt_blocks(cipher, tmp, tmp, n);
 
-      cy = 1;
-      j = 4;
+      for (i = 0; i < n; i++)
+        dst[i] = src[i] ^ tmp[i];
 
-      while (j--) {
-        cy += (unsigned int)mode->ctr[12 + j];
-        mode->ctr[12 + j] = cy;
-        cy >>= 8;
-      }
+      memcpy(mode->state, tmp + n - 16, 16);
+
+      mode->pos = 16;
+
+      dst += n;
+      src += n;
+      len -= n;
+    }
 
+    torsion_cleanse(tmp, sizeof(tmp));
+  }
+
+  for (i = 0; i < len; i++) {
+    if ((mode->pos & 15) == 0) {
+      cipher_encrypt(cipher, mode->state, mode->ctr);
+      gcm_increment(mode->ctr);
       mode->pos = 0;
     }
 
@@ -6639,15 +7270,33 @@ gcm_aad(gcm_t *mode, const unsigned char *aad, size_t len) {
 void
 gcm_encrypt(gcm_t *mode, const cipher_t *cipher,
             unsigned char *dst, const unsigned char *src, size_t len) {
-  gcm_crypt(mode, cipher, dst, src, len);
-  ghash_update(&mode->hash, dst, len);
+  /* Interleave the keystream and hash per chunk so
+     the ciphertext is hashed while still in cache. */
+  while (len > 0) {
+    size_t n = len < CIPHER_CHUNK_SIZE ? len : CIPHER_CHUNK_SIZE;
+
+    gcm_crypt(mode, cipher, dst, src, n);
+    ghash_update(&mode->hash, dst, n);
+
+    dst += n;
+    src += n;
+    len -= n;
+  }
 }
 
 void
 gcm_decrypt(gcm_t *mode, const cipher_t *cipher,
             unsigned char *dst, const unsigned char *src, size_t len) {
-  ghash_update(&mode->hash, src, len);
-  gcm_crypt(mode, cipher, dst, src, len);
+  while (len > 0) {
+    size_t n = len < CIPHER_CHUNK_SIZE ? len : CIPHER_CHUNK_SIZE;
+
+    ghash_update(&mode->hash, src, n);
+    gcm_crypt(mode, cipher, dst, src, n);
+
+    dst += n;
+    src += n;
+    len -= n;
+  }
 }
 
 void
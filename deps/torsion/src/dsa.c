@@ -167,16 +167,27 @@ dsa_group_export_dumb(unsigned char *out,
 static int
 dsa_group_generate(dsa_group_t *group,
                    size_t bits,
-                   const unsigned char *entropy) {
+                   const unsigned char *entropy,
+                   const volatile int *stop) {
   /* [FIPS186] Page 31, Appendix A.1.
    *           Page 41, Appendix A.2.
    * [DSA] "Parameter generation".
+   *
+   * Rather than drawing a fresh random `p`
+   * for every candidate, we walk the sequence
+   * p = X - (X mod 2q) + 1 + k * 2q and let
+   * mpz_sieve_prime discard candidates with
+   * small factors before testing primality.
+   *
+   * `stop` is polled here and passed through
+   * to mpz_sieve_prime (see "Prime Sieving" in
+   * mpi.c).
    */
   mpz_t q, p, t, h, pm1, e, g;
   size_t L = bits;
   size_t N = bits < 2048 ? 160 : 256;
   drbg_t rng;
-  size_t i;
+  int r = 0;
 
   if (!(L == 1024 && N == 160)
       && !(L == 2048 && N == 224)
@@ -196,6 +207,9 @@ dsa_group_generate(dsa_group_t *group,
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
   for (;;) {
+    if (stop != NULL && torsion_atomic_load(stop))
+      goto fail;
+
     mpz_random_bits(q, N, drbg_rng, &rng);
     mpz_set_bit(q, 0);
     mpz_set_bit(q, N - 1);
@@ -203,28 +217,26 @@ dsa_group_generate(dsa_group_t *group,
     if (!mpz_is_prime(q, 64, drbg_rng, &rng))
       continue;
 
-    for (i = 0; i < 4 * L; i++) {
-      mpz_random_bits(p, L, drbg_rng, &rng);
-      mpz_set_bit(p, 0);
-      mpz_set_bit(p, L - 1);
+    mpz_random_bits(p, L, drbg_rng, &rng);
+    mpz_set_bit(p, L - 1);
 
-      mpz_mod(t, p, q);
-      mpz_sub_ui(t, t, 1);
-      mpz_sub(p, p, t);
+    /* p = 1 mod 2q */
+    mpz_lshift(t, q, 1);
+    mpz_mod(h, p, t);
+    mpz_sub(p, p, h);
+    mpz_add_ui(p, p, 1);
 
-      bits = mpz_bitlen(p);
+    if (!mpz_sieve_prime(p, t, 4 * L, 64, drbg_rng, &rng, stop))
+      continue;
 
-      if (bits < L || bits > DSA_MAX_BITS)
-        continue;
+    bits = mpz_bitlen(p);
 
-      if (!mpz_is_prime(p, 64, drbg_rng, &rng))
-        continue;
+    if (bits < L || bits > DSA_MAX_BITS)
+      continue;
 
-      goto out;
-    }
+    break;
   }
 
-out:
   mpz_set_ui(h, 2);
   mpz_sub_ui(pm1, p, 1);
   mpz_quo(e, pm1, q);
@@ -244,6 +256,8 @@ out:
   mpz_set(group->q, q);
   mpz_set(group->g, g);
 
+  r = 1;
+fail:
   mpz_cleanse(q);
   mpz_cleanse(p);
   mpz_cleanse(t);
@@ -254,7 +268,7 @@ out:
 
   torsion_cleanse(&rng, sizeof(rng));
 
-  return 1;
+  return r;
 }
 
 static int
@@ -638,7 +652,7 @@ dsa_priv_generate(dsa_priv_t *k, size_t bits, const unsigned char *entropy) {
   drbg_generate(&rng, entropy2, ENTROPY_SIZE);
   drbg_generate(&rng, entropy1, ENTROPY_SIZE);
 
-  if (!dsa_group_generate(&group, bits, entropy1))
+  if (!dsa_group_generate(&group, bits, entropy1, NULL))
     goto fail;
 
   dsa_priv_create(k, &group, entropy2);
@@ -801,7 +815,28 @@ dsa_params_generate(unsigned char *out,
 
   dsa_group_init(&group);
 
-  if (!dsa_group_generate(&group, bits, entropy))
+  if (!dsa_group_generate(&group, bits, entropy, NULL))
+    goto fail;
+
+  dsa_group_export(out, out_len, &group);
+  r = 1;
+fail:
+  dsa_group_clear(&group);
+  return r;
+}
+
+int
+dsa_params_search(unsigned char *out,
+                  size_t *out_len,
+                  size_t bits,
+                  const unsigned char *entropy,
+                  const volatile int *stop) {
+  dsa_group_t group;
+  int r = 0;
+
+  dsa_group_init(&group);
+
+  if (!dsa_group_generate(&group, bits, entropy, stop))
     goto fail;
 
   dsa_group_export(out, out_len, &group);
@@ -135,6 +135,22 @@
  *
  *   [ECPM] Elliptic Curve Point Multiplication (wikipedia)
  *     https://en.wikipedia.org/wiki/Elliptic_curve_point_multiplication
+ *
+ *   [PIPPENGER] On the Evaluation of Powers and Monomials
+ *     N. Pippenger
+ *     https://doi.org/10.1137/0209022
+ *
+ *   [BOS] Faster batch forgery identification
+ *     D. J. Bernstein, J. Doumen, T. Lange, J. Oosterwijk
+ *     https://eprint.iacr.org/2012/549.pdf
+ *
+ *   [LIMLEE] More Flexible Exponentiation with Precomputation
+ *     C. H. Lim, P. J. Lee
+ *     https://doi.org/10.1007/3-540-48658-5_11
+ *
+ *   [SDMC] Fast and compact elliptic-curve cryptography
+ *     M. Hamburg
+ *     https://eprint.iacr.org/2012/309.pdf
  */
 
 #include <limits.h>
@@ -204,6 +220,19 @@ TORSION_BARRIER(fe_word_t, fiat)
 #define NAF_WIDTH_PRE 12
 #define NAF_SIZE_PRE (1 << (NAF_WIDTH_PRE - 2)) /* 1024 */
 
+#define NAF_WIDTH_PUB 7
+#define NAF_SIZE_PUB (1 << (NAF_WIDTH_PUB - 2)) /* 32 */
+
+#define COMB_MIN_WIDTH 5
+#define COMB_MAX_WIDTH 8
+#define COMB_SPACING 4
+#define COMB_SIZE(teeth) ((size_t)1 << ((teeth) - 1)) /* 128 */
+#define COMB_BLOCKS(bits, teeth) \
+  (((bits) + (teeth) * COMB_SPACING - 1) / ((teeth) * COMB_SPACING)) /* 8 */
+
+#define PIPPENGER_MIN 128
+#define PIPPENGER_MAX_WIDTH 12
+
 #define ECC_MIN(a, b) ((a) < (b) ? (a) : (b))
 #define ECC_MAX(a, b) ((a) > (b) ? (a) : (b))
 
@@ -388,8 +417,8 @@ typedef struct wei_s {
   wge_t g;
   sc_t blind;
   jge_t unblind;
-  wge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 311.2kb */
-  wge_t wnd_naf[NAF_SIZE_PRE]; /* 152kb */
+  const wge_t *wnd_fixed; /* 311.2kb */
+  const wge_t *wnd_naf; /* 152kb */
   wge_t torsion[8];
   int endo;
   fe_t beta;
@@ -398,9 +427,21 @@ typedef struct wei_s {
   sc_t b2;
   sc_t g1;
   sc_t g2;
-  wge_t wnd_endo[NAF_SIZE_PRE]; /* 19kb */
+  const wge_t *wnd_endo; /* 152kb (same length as wnd_naf) */
+  wge_t *wnds;
+  size_t comb_teeth;
+  size_t comb_blocks;
+  sc_t comb_half;
+  sc_t comb_adj;
+  fe_word_t *wnd_comb; /* 306kb */
 } wei_t;
 
+typedef struct wei_tables_s {
+  const wge_t *fixed;
+  const wge_t *naf;
+  const wge_t *endo;
+} wei_tables_t;
+
 typedef struct wei_def_s {
   int hash;
   const prime_def_t *fe;
@@ -414,6 +455,7 @@ typedef struct wei_def_s {
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
   const endo_def_t *endo;
+  const wei_tables_t *tables;
 } wei_def_t;
 
 struct wei_scratch_s {
@@ -422,10 +464,18 @@ struct wei_scratch_s {
   jge_t **wnds;
   int *naf;
   int **nafs;
+  jge_t *buckets;
+  int *digits;
   wge_t *points;
   sc_t *coeffs;
 };
 
+struct wei_pubkey_s {
+  wge_t point;
+  wge_t wnd[NAF_SIZE_PUB]; /* 4864 bytes */
+  unsigned char raw[MAX_FIELD_SIZE];
+};
+
 /*
  * Montgomery
  */
@@ -515,11 +565,22 @@ typedef struct edwards_s {
   xge_t g;
   sc_t blind;
   xge_t unblind;
-  xge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 589.5kb */
-  xge_t wnd_naf[NAF_SIZE_PRE]; /* 288kb */
+  const xge_t *wnd_fixed; /* 589.5kb */
+  const xge_t *wnd_naf; /* 288kb */
   xge_t torsion[8];
+  xge_t *wnds;
+  size_t comb_teeth;
+  size_t comb_blocks;
+  sc_t comb_half;
+  sc_t comb_adj;
+  fe_word_t *wnd_comb; /* 336kb */
 } edwards_t;
 
+typedef struct edwards_tables_s {
+  const xge_t *fixed;
+  const xge_t *naf;
+} edwards_tables_t;
+
 typedef struct edwards_def_s {
   int hash;
   int context;
@@ -535,6 +596,7 @@ typedef struct edwards_def_s {
   const unsigned char y[MAX_FIELD_SIZE];
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
+  const edwards_tables_t *tables;
 } edwards_def_t;
 
 struct edwards_scratch_s {
@@ -543,10 +605,17 @@ struct edwards_scratch_s {
   xge_t **wnds;
   int *naf;
   int **nafs;
+  xge_t *buckets;
+  int *digits;
   xge_t *points;
   sc_t *coeffs;
 };
 
+struct edwards_pubkey_s {
+  xge_t wnd[NAF_SIZE_PUB]; /* 9216 bytes */
+  unsigned char raw[MAX_FIELD_SIZE + 1];
+};
+
 /*
  * Helpers
  */
@@ -1241,6 +1310,58 @@ sc_jsf_endo_var(const scalar_field_t *sc, int *naf,
   return sc_jsf_var0(sc, naf, c1, s1, c2, s2, sc->endo_bits + 1);
 }
 
+static size_t
+pippenger_width(size_t len) {
+  /* Bucket width for `len` points. Each window costs
+   * `len` additions plus `2^width` to sum the buckets,
+   * so the optimum grows with roughly log2(len).
+   */
+  size_t width = 0;
+
+  while (len >>= 1)
+    width += 1;
+
+  if (width < 6)
+    return 3;
+
+  return ECC_MIN(width - 3, PIPPENGER_MAX_WIDTH);
+}
+
+static size_t
+pippenger_windows(size_t bits, size_t width) {
+  /* One extra window for the final carry. */
+  return (bits + width - 1) / width + 1;
+}
+
+static void
+sc_pippenger_var(const scalar_field_t *sc, int *digits,
+                 const sc_t k, size_t width, size_t windows) {
+  /* Signed fixed-window recoding for the bucket method.
+   *
+   * Produces digits in [-2^(w-1), 2^(w-1)] such that
+   * k = sum(digits[i] * 2^(w * i)). The scalar is
+   * minimized first so the digits carry its sign.
+   */
+  int half = 1 << (width - 1);
+  int carry = 0;
+  size_t i;
+  sc_t c;
+  int s;
+
+  s = -sc_minimize_var(sc, c, k) | 1;
+
+  for (i = 0; i < windows; i++) {
+    int word = (int)sc_get_bits(sc, c, i * width, width) + carry;
+
+    carry = word > half;
+    word -= carry << width;
+
+    digits[i] = s * word;
+  }
+
+  ASSERT(carry == 0);
+}
+
 static void
 sc_random(const scalar_field_t *sc, sc_t k, drbg_t *rng) {
   unsigned char bytes[MAX_SCALAR_SIZE];
@@ -1364,6 +1485,34 @@ fe_select(const prime_field_t *fe,
   fe->selectznz(r, flag != 0, a, b);
 }
 
+static void
+fe_lookup(const prime_field_t *fe,
+          fe_word_t *r,
+          const fe_word_t *table,
+          size_t count,
+          size_t size,
+          size_t index) {
+  /* Constant-time lookup of `count` packed field
+   * elements. Every entry is read regardless of
+   * the index.
+   */
+  size_t words = count * fe->words;
+  size_t i, j;
+
+  for (j = 0; j < words; j++)
+    r[j] = 0;
+
+  for (i = 0; i < size; i++) {
+    fe_word_t cond = (i == index);
+    fe_word_t mask = fiat_barrier(-cond);
+
+    for (j = 0; j < words; j++)
+      r[j] |= table[j] & mask;
+
+    table += words;
+  }
+}
+
 static void
 fe_set(const prime_field_t *fe, fe_t r, const fe_t a) {
   size_t i = fe->words;
@@ -1924,6 +2073,9 @@ jge_zero(const wei_t *ec, jge_t *r);
 static void
 jge_set(const wei_t *ec, jge_t *r, const jge_t *a);
 
+static void
+jge_neg(const wei_t *ec, jge_t *r, const jge_t *a);
+
 static void
 jge_dbl_var(const wei_t *ec, jge_t *r, const jge_t *p);
 
@@ -2521,7 +2673,7 @@ wge_fixed_points_var(const wei_t *ec, wge_t *out, const wge_t *p) {
 static void
 wge_naf_points_var(const wei_t *ec, wge_t *out,
                    const wge_t *p, size_t width) {
-  /* NOTE: Only called on initialization. */
+  /* NOTE: Only called on initialization and key parsing. */
   size_t size = 1 << (width - 2);
   jge_t *wnd = checked_malloc(size * sizeof(jge_t)); /* 216kb */
   jge_t j, dbl;
@@ -2539,6 +2691,82 @@ wge_naf_points_var(const wei_t *ec, wge_t *out,
   free(wnd);
 }
 
+static int
+wge_comb_points_var(const wei_t *ec, fe_word_t *out,
+                    const wge_t *p, size_t teeth) {
+  /* Signed-digit comb table.
+   *
+   * Each block covers `teeth * COMB_SPACING` bits
+   * and stores every combination of +-2^(tooth*spacing)
+   * whose top tooth is positive. The other half of
+   * the combinations are the negations of these.
+   *
+   * Entries are packed as (x, y) to keep the table
+   * (and the constant-time scan over it) small.
+   *
+   * NOTE: Only called on precomputation.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t size = COMB_SIZE(teeth);
+  size_t length = COMB_BLOCKS(sc->bits, teeth) * size;
+  jge_t *wnds = checked_malloc(length * sizeof(jge_t)); /* 459kb */
+  wge_t *points = checked_malloc(length * sizeof(wge_t)); /* 323kb */
+  jge_t dbls[COMB_MAX_WIDTH];
+  size_t i, j, m;
+  jge_t g, sum;
+  int ret = 1;
+
+  wge_to_jge(ec, &g, p);
+
+  for (i = 0; i < length; i += size) {
+    jge_t *wnd = &wnds[i];
+
+    jge_zero(ec, &sum);
+
+    for (j = 0; j < teeth; j++) {
+      if (j == teeth - 1) {
+        jge_neg(ec, &sum, &sum);
+        jge_add_var(ec, &wnd[0], &g, &sum);
+      } else {
+        jge_add_var(ec, &sum, &sum, &g);
+        jge_dbl_var(ec, &dbls[j], &g);
+      }
+
+      for (m = 0; m < COMB_SPACING; m++)
+        jge_dbl_var(ec, &g, &g);
+    }
+
+    for (m = 1; m < size; m++) {
+      /* Flip the lowest set bit from -1 to +1. */
+      j = 0;
+
+      while (((m >> j) & 1) == 0)
+        j++;
+
+      jge_add_var(ec, &wnd[m], &wnd[m & (m - 1)], &dbls[j]);
+    }
+  }
+
+  jge_to_wge_all_var(ec, points, wnds, length);
+
+  for (i = 0; i < length; i++) {
+    /* Packed entries cannot represent infinity. */
+    ret &= points[i].inf ^ 1;
+
+    fe_set(fe, out, points[i].x);
+    out += fe->words;
+
+    fe_set(fe, out, points[i].y);
+    out += fe->words;
+  }
+
+  free(points);
+  free(wnds);
+
+  return ret;
+}
+
 static void
 wge_jsf_points_var(const wei_t *ec, jge_t *out,
                    const wge_t *p1, const wge_t *p2) {
@@ -3658,6 +3886,9 @@ wei_has_high_order(const wei_t *ec);
 static int
 wei_has_small_gap(const wei_t *ec);
 
+static void
+wei_init_tables(wei_t *ec);
+
 static void
 wei_init(wei_t *ec, const wei_def_t *def) {
   prime_field_t *fe = &ec->fe;
@@ -3706,9 +3937,6 @@ wei_init(wei_t *ec, const wei_def_t *def) {
   sc_zero(sc, ec->blind);
   jge_zero(ec, &ec->unblind);
 
-  wge_fixed_points_var(ec, ec->wnd_fixed, &ec->g);
-  wge_naf_points_var(ec, ec->wnd_naf, &ec->g, NAF_WIDTH_PRE);
-
   for (i = 0; i < ec->h; i++) {
     fe_import(fe, ec->torsion[i].x, def->torsion[i].x);
     fe_import(fe, ec->torsion[i].y, def->torsion[i].y);
@@ -3725,9 +3953,49 @@ wei_init(wei_t *ec, const wei_def_t *def) {
     sc_import(sc, ec->b2, def->endo->b2);
     sc_import(sc, ec->g1, def->endo->g1);
     sc_import(sc, ec->g2, def->endo->g2);
+  }
+
+  if (def->tables != NULL) {
+    ec->wnd_fixed = def->tables->fixed;
+    ec->wnd_naf = def->tables->naf;
+    ec->wnd_endo = def->tables->endo;
+  } else {
+    wei_init_tables(ec);
+  }
+}
+
+static void
+wei_init_tables(wei_t *ec) {
+  /* No precomputed tables for this curve
+   * (or this word size). Compute them now.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  size_t fixed = FIXED_LENGTH(sc->bits);
+  size_t total = fixed + NAF_SIZE_PRE;
+  wge_t *wnd_fixed, *wnd_naf;
+  size_t i;
+
+  if (ec->endo)
+    total += NAF_SIZE_PRE;
+
+  ec->wnds = checked_malloc(total * sizeof(wge_t));
+
+  wnd_fixed = &ec->wnds[0];
+  wnd_naf = &ec->wnds[fixed];
+
+  wge_fixed_points_var(ec, wnd_fixed, &ec->g);
+  wge_naf_points_var(ec, wnd_naf, &ec->g, NAF_WIDTH_PRE);
+
+  ec->wnd_fixed = wnd_fixed;
+  ec->wnd_naf = wnd_naf;
+
+  if (ec->endo) {
+    wge_t *wnd_endo = &ec->wnds[fixed + NAF_SIZE_PRE];
 
     for (i = 0; i < NAF_SIZE_PRE; i++)
-      wge_endo_beta(ec, &ec->wnd_endo[i], &ec->wnd_naf[i]);
+      wge_endo_beta(ec, &wnd_endo[i], &wnd_naf[i]);
+
+    ec->wnd_endo = wnd_endo;
   }
 }
 
@@ -3885,6 +4153,74 @@ wei_endo_split(const wei_t *ec, sc_t k1, sc_t k2, const sc_t k) {
   sc_add(sc, k1, k1, k);
 }
 
+static void
+wei_jmul_comb(const wei_t *ec, jge_t *r, const sc_t k) {
+  /* Signed-digit multi-comb method for point multiplication.
+   *
+   * [LIMLEE] Section 3.
+   * [SDMC] Page 8, Section 3.3.
+   *
+   * We recode the scalar as d = (k + 2^c - 1) / 2 such
+   * that every bit of `d` represents a digit of +1 (set)
+   * or -1 (unset). A 256 bit multiplication requires 32
+   * additions and 3 doublings with 8 teeth.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t teeth = ec->comb_teeth;
+  size_t blocks = ec->comb_blocks;
+  size_t size = COMB_SIZE(teeth);
+  size_t stride = size * 2 * fe->words;
+  size_t i, j, pos, bits, sign, index;
+  fe_word_t entry[2 * MAX_FIELD_WORDS];
+  sc_t d;
+  wge_t t;
+
+  /* Blind if available. */
+  sc_add(sc, d, k, ec->blind);
+
+  /* Recode. */
+  sc_add(sc, d, d, ec->comb_adj);
+  sc_mul(sc, d, d, ec->comb_half);
+
+  /* Multiply in constant time. */
+  jge_zero(ec, r);
+
+  for (pos = COMB_SPACING; pos-- > 0;) {
+    if (pos != COMB_SPACING - 1)
+      jge_dbl(ec, r, r);
+
+    for (i = 0; i < blocks; i++) {
+      bits = 0;
+
+      for (j = 0; j < teeth; j++)
+        bits |= sc_get_bit(sc, d, (i * teeth + j) * COMB_SPACING + pos) << j;
+
+      sign = bits >> (teeth - 1);
+      index = (bits ^ (sign - 1)) & (size - 1);
+
+      fe_lookup(fe, entry, &ec->wnd_comb[i * stride], 2, size, index);
+
+      fe_set(fe, t.x, &entry[0 * fe->words]);
+      fe_neg_cond(fe, t.y, &entry[1 * fe->words], sign ^ 1);
+
+      t.inf = 0;
+
+      jge_mixed_add(ec, r, r, &t);
+    }
+  }
+
+  jge_add(ec, r, r, &ec->unblind);
+
+  /* Cleanse. */
+  sc_cleanse(sc, d);
+
+  cleanse(entry, sizeof(entry));
+  cleanse(&bits, sizeof(bits));
+  cleanse(&sign, sizeof(sign));
+  cleanse(&index, sizeof(index));
+}
+
 static void
 wei_jmul_g(const wei_t *ec, jge_t *r, const sc_t k) {
   /* Fixed-base method for point multiplication.
@@ -3902,6 +4238,11 @@ wei_jmul_g(const wei_t *ec, jge_t *r, const sc_t k) {
   sc_t k0;
   wge_t t;
 
+  if (ec->wnd_comb != NULL) {
+    wei_jmul_comb(ec, r, k);
+    return;
+  }
+
   /* Blind if available. */
   sc_add(sc, k0, k, ec->blind);
 
@@ -4212,6 +4553,130 @@ wei_mul_double_var(const wei_t *ec,
   jge_to_wge_var(ec, r, &j);
 }
 
+static void
+wei_jmul_double_pub_normal_var(const wei_t *ec,
+                               jge_t *r,
+                               const sc_t k1,
+                               const wge_t *wnd2,
+                               const sc_t k2) {
+  /* Same as above, but with a precomputed affine
+   * window for the second point (see wei_pubkey_s).
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd1 = ec->wnd_naf;
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  size_t i, max, max1, max2;
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, NAF_WIDTH_PRE);
+  max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH_PUB);
+  max = ECC_MAX(max1, max2);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      jge_dbl_var(ec, r, r);
+
+    if (z1 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+  }
+}
+
+static void
+wei_jmul_double_pub_endo_var(const wei_t *ec,
+                             jge_t *r,
+                             const sc_t k1,
+                             const wge_t *wnd3,
+                             const sc_t k2) {
+  /* Same as above, but with a precomputed affine
+   * window for the second point. The endomorphism
+   * of each window entry is computed as needed
+   * (one multiplication) rather than stored.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd1 = ec->wnd_naf;
+  const wge_t *wnd2 = ec->wnd_endo;
+  int naf1[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf2[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf3[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf4[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  sc_t c1, c2, c3, c4; /* 288 bytes */
+  size_t i, max, max1, max2;
+  wge_t t;
+
+  ASSERT(ec->endo == 1);
+
+  /* Split scalars. */
+  wei_endo_split(ec, c1, c2, k1);
+  wei_endo_split(ec, c3, c4, k2);
+
+  /* Compute NAFs. */
+  max1 = sc_naf_endo_var(sc, naf1, naf2, c1, c2, NAF_WIDTH_PRE);
+  max2 = sc_naf_endo_var(sc, naf3, naf4, c3, c4, NAF_WIDTH_PUB);
+  max = ECC_MAX(max1, max2);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+    int z3 = naf3[i];
+    int z4 = naf4[i];
+
+    if (i != max - 1)
+      jge_dbl_var(ec, r, r);
+
+    if (z1 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+
+    if (z3 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd3[(z3 - 1) >> 1]);
+    else if (z3 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd3[(-z3 - 1) >> 1]);
+
+    if (z4 > 0) {
+      wge_endo_beta(ec, &t, &wnd3[(z4 - 1) >> 1]);
+      jge_mixed_add_var(ec, r, r, &t);
+    } else if (z4 < 0) {
+      wge_endo_beta(ec, &t, &wnd3[(-z4 - 1) >> 1]);
+      jge_mixed_sub_var(ec, r, r, &t);
+    }
+  }
+}
+
+static void
+wei_jmul_double_pub_var(const wei_t *ec,
+                        jge_t *r,
+                        const sc_t k1,
+                        const wge_t *wnd2,
+                        const sc_t k2) {
+  if (ec->endo)
+    wei_jmul_double_pub_endo_var(ec, r, k1, wnd2, k2);
+  else
+    wei_jmul_double_pub_normal_var(ec, r, k1, wnd2, k2);
+}
+
 static void
 wei_jmul_multi_normal_var(const wei_t *ec,
                           jge_t *r,
@@ -4235,6 +4700,7 @@ wei_jmul_multi_normal_var(const wei_t *ec,
   int **nafs = scratch->nafs;
   size_t i, j, max, size;
 
+  ASSERT(len < PIPPENGER_MIN);
   ASSERT(len <= scratch->size);
 
   /* Compute fixed NAF. */
@@ -4323,6 +4789,7 @@ wei_jmul_multi_endo_var(const wei_t *ec,
   sc_t k1, k2;
 
   ASSERT(ec->endo == 1);
+  ASSERT(len < PIPPENGER_MIN);
   ASSERT(len <= scratch->size);
 
   /* Split scalar. */
@@ -4376,6 +4843,79 @@ wei_jmul_multi_endo_var(const wei_t *ec,
   }
 }
 
+static void
+wei_jmul_multi_pippenger_var(const wei_t *ec,
+                             jge_t *r,
+                             const sc_t k0,
+                             const wge_t *points,
+                             const sc_t *coeffs,
+                             size_t len,
+                             struct wei_scratch_s *scratch) {
+  /* Multiple point multiplication using
+   * Pippenger's bucket method.
+   *
+   * [PIPPENGER] Page 3, Section 2.
+   * [BOS] Page 5, Section 4.
+   *
+   * Every point is added to a single bucket per
+   * window. The buckets are then summed with a
+   * running total such that bucket `i` is counted
+   * `i + 1` times. Unlike the interleaved NAF
+   * method, the per-point cost keeps falling as
+   * `len` grows.
+   *
+   * The first point is folded into the fixed
+   * generator multiplication instead.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  size_t width = pippenger_width(len);
+  size_t windows = pippenger_windows(sc->bits, width);
+  size_t size = (size_t)1 << (width - 1);
+  jge_t *buckets = scratch->buckets;
+  int *digits = scratch->digits;
+  jge_t acc, sum, run;
+  size_t i, j, k;
+
+  ASSERT(len >= PIPPENGER_MIN);
+  ASSERT(len <= scratch->size);
+
+  for (i = 1; i < len; i++)
+    sc_pippenger_var(sc, &digits[i * windows], coeffs[i], width, windows);
+
+  jge_zero(ec, &acc);
+
+  for (j = windows; j-- > 0;) {
+    for (k = 0; k < width; k++)
+      jge_dbl_var(ec, &acc, &acc);
+
+    for (k = 0; k < size; k++)
+      jge_zero(ec, &buckets[k]);
+
+    for (i = 1; i < len; i++) {
+      int z = digits[i * windows + j];
+
+      if (z > 0)
+        jge_mixed_add_var(ec, &buckets[z - 1], &buckets[z - 1], &points[i]);
+      else if (z < 0)
+        jge_mixed_sub_var(ec, &buckets[-z - 1], &buckets[-z - 1], &points[i]);
+    }
+
+    jge_zero(ec, &sum);
+    jge_zero(ec, &run);
+
+    for (k = size; k-- > 0;) {
+      jge_add_var(ec, &run, &run, &buckets[k]);
+      jge_add_var(ec, &sum, &sum, &run);
+    }
+
+    jge_add_var(ec, &acc, &acc, &sum);
+  }
+
+  wei_jmul_double_var(ec, r, k0, &points[0], coeffs[0]);
+
+  jge_add_var(ec, r, r, &acc);
+}
+
 static void
 wei_jmul_multi_var(const wei_t *ec,
                    jge_t *r,
@@ -4384,7 +4924,9 @@ wei_jmul_multi_var(const wei_t *ec,
                    const sc_t *coeffs,
                    size_t len,
                    struct wei_scratch_s *scratch) {
-  if (ec->endo)
+  if (len >= PIPPENGER_MIN)
+    wei_jmul_multi_pippenger_var(ec, r, k0, points, coeffs, len, scratch);
+  else if (ec->endo)
     wei_jmul_multi_endo_var(ec, r, k0, points, coeffs, len, scratch);
   else
     wei_jmul_multi_normal_var(ec, r, k0, points, coeffs, len, scratch);
@@ -4424,6 +4966,58 @@ wei_randomize(wei_t *ec, const unsigned char *entropy) {
   cleanse(&rng, sizeof(rng));
 }
 
+static int
+wei_precompute(wei_t *ec, unsigned int width) {
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t blocks, bits, i;
+  sc_t one;
+
+  if (width != 0 && (width < COMB_MIN_WIDTH || width > COMB_MAX_WIDTH))
+    return 0;
+
+  if (ec->wnd_comb != NULL) {
+    free(ec->wnd_comb);
+
+    ec->comb_teeth = 0;
+    ec->comb_blocks = 0;
+    ec->wnd_comb = NULL;
+  }
+
+  if (width == 0)
+    return 1;
+
+  blocks = COMB_BLOCKS(sc->bits, width);
+  bits = blocks * width * COMB_SPACING;
+
+  /* half = 1 / 2 mod n */
+  sc_set_word(sc, one, 1);
+  sc_add(sc, ec->comb_half, one, one);
+  sc_invert_var(sc, ec->comb_half, ec->comb_half);
+
+  /* adj = 2^c - 1 mod n */
+  sc_set(sc, ec->comb_adj, one);
+
+  for (i = 0; i < bits; i++)
+    sc_add(sc, ec->comb_adj, ec->comb_adj, ec->comb_adj);
+
+  sc_sub(sc, ec->comb_adj, ec->comb_adj, one);
+
+  ec->wnd_comb = checked_malloc(blocks * COMB_SIZE(width) * 2
+                                * fe->words * sizeof(fe_word_t));
+
+  if (!wge_comb_points_var(ec, ec->wnd_comb, &ec->g, width)) {
+    free(ec->wnd_comb);
+    ec->wnd_comb = NULL;
+    return 0;
+  }
+
+  ec->comb_teeth = width;
+  ec->comb_blocks = blocks;
+
+  return 1;
+}
+
 static void
 wei_sswu(const wei_t *ec, wge_t *p, const fe_t u) {
   /* Simplified Shallue-Woestijne-Ulas Method.
@@ -6474,6 +7068,67 @@ xge_naf_points(const edwards_t *ec, xge_t *out,
     xge_add(ec, &out[i], &out[i - 1], &dbl);
 }
 
+static void
+xge_comb_points_var(const edwards_t *ec, fe_word_t *out,
+                    const xge_t *p, size_t teeth) {
+  /* See wge_comb_points_var. Entries are
+   * normalized and packed as (x, y, t).
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t size = COMB_SIZE(teeth);
+  size_t length = COMB_BLOCKS(sc->bits, teeth) * size;
+  xge_t *wnds = checked_malloc(length * sizeof(xge_t)); /* 504kb */
+  xge_t dbls[COMB_MAX_WIDTH];
+  size_t i, j, m;
+  xge_t g, sum;
+  fe_t zi;
+
+  xge_set(ec, &g, p);
+
+  for (i = 0; i < length; i += size) {
+    xge_t *wnd = &wnds[i];
+
+    xge_zero(ec, &sum);
+
+    for (j = 0; j < teeth; j++) {
+      if (j == teeth - 1) {
+        xge_sub(ec, &wnd[0], &g, &sum);
+      } else {
+        xge_add(ec, &sum, &sum, &g);
+        xge_dbl(ec, &dbls[j], &g);
+      }
+
+      for (m = 0; m < COMB_SPACING; m++)
+        xge_dbl(ec, &g, &g);
+    }
+
+    for (m = 1; m < size; m++) {
+      j = 0;
+
+      while (((m >> j) & 1) == 0)
+        j++;
+
+      xge_add(ec, &wnd[m], &wnd[m & (m - 1)], &dbls[j]);
+    }
+  }
+
+  for (i = 0; i < length; i++) {
+    fe_word_t *x = &out[0 * fe->words];
+    fe_word_t *y = &out[1 * fe->words];
+    fe_word_t *t = &out[2 * fe->words];
+
+    fe_invert_var(fe, zi, wnds[i].z);
+    fe_mul(fe, x, wnds[i].x, zi);
+    fe_mul(fe, y, wnds[i].y, zi);
+    fe_mul(fe, t, x, y);
+
+    out += 3 * fe->words;
+  }
+
+  free(wnds);
+}
+
 static void
 xge_jsf_points(const edwards_t *ec, xge_t *out,
                const xge_t *p1, const xge_t *p2) {
@@ -6496,6 +7151,9 @@ xge_to_mge(const edwards_t *ec, mge_t *r, const xge_t *p) {
 static void
 edwards_init_isomorphism(edwards_t *ec, const edwards_def_t *def);
 
+static void
+edwards_init_tables(edwards_t *ec);
+
 static void
 edwards_init(edwards_t *ec, const edwards_def_t *def) {
   prime_field_t *fe = &ec->fe;
@@ -6538,9 +7196,6 @@ edwards_init(edwards_t *ec, const edwards_def_t *def) {
   sc_zero(sc, ec->blind);
   xge_zero(ec, &ec->unblind);
 
-  xge_fixed_points(ec, ec->wnd_fixed, &ec->g);
-  xge_naf_points(ec, ec->wnd_naf, &ec->g, NAF_WIDTH_PRE);
-
   for (i = 0; i < ec->h; i++) {
     fe_import_be(fe, ec->torsion[i].x, def->torsion[i].x);
     fe_import_be(fe, ec->torsion[i].y, def->torsion[i].y);
@@ -6548,6 +7203,31 @@ edwards_init(edwards_t *ec, const edwards_def_t *def) {
     fe_set(fe, ec->torsion[i].z, fe->one);
     fe_mul(fe, ec->torsion[i].t, ec->torsion[i].x, ec->torsion[i].y);
   }
+
+  if (def->tables != NULL) {
+    ec->wnd_fixed = def->tables->fixed;
+    ec->wnd_naf = def->tables->naf;
+  } else {
+    edwards_init_tables(ec);
+  }
+}
+
+static void
+edwards_init_tables(edwards_t *ec) {
+  const scalar_field_t *sc = &ec->sc;
+  size_t fixed = FIXED_LENGTH(sc->bits);
+  xge_t *wnd_fixed, *wnd_naf;
+
+  ec->wnds = checked_malloc((fixed + NAF_SIZE_PRE) * sizeof(xge_t));
+
+  wnd_fixed = &ec->wnds[0];
+  wnd_naf = &ec->wnds[fixed];
+
+  xge_fixed_points(ec, wnd_fixed, &ec->g);
+  xge_naf_points(ec, wnd_naf, &ec->g, NAF_WIDTH_PRE);
+
+  ec->wnd_fixed = wnd_fixed;
+  ec->wnd_naf = wnd_naf;
 }
 
 static void
@@ -6669,6 +7349,68 @@ edwards_validate_xy(const edwards_t *ec, const fe_t x, const fe_t y) {
   return fe_equal(fe, lhs, rhs);
 }
 
+static void
+edwards_mul_comb(const edwards_t *ec, xge_t *r, const sc_t k) {
+  /* Signed-digit multi-comb method for point multiplication.
+   *
+   * See wei_jmul_comb.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t teeth = ec->comb_teeth;
+  size_t blocks = ec->comb_blocks;
+  size_t size = COMB_SIZE(teeth);
+  size_t stride = size * 3 * fe->words;
+  size_t i, j, pos, bits, sign, index;
+  fe_word_t entry[3 * MAX_FIELD_WORDS];
+  sc_t d;
+  xge_t t;
+
+  /* Blind if available. */
+  sc_add(sc, d, k, ec->blind);
+
+  /* Recode. */
+  sc_add(sc, d, d, ec->comb_adj);
+  sc_mul(sc, d, d, ec->comb_half);
+
+  /* Multiply in constant time. */
+  xge_zero(ec, r);
+
+  for (pos = COMB_SPACING; pos-- > 0;) {
+    if (pos != COMB_SPACING - 1)
+      xge_dbl(ec, r, r);
+
+    for (i = 0; i < blocks; i++) {
+      bits = 0;
+
+      for (j = 0; j < teeth; j++)
+        bits |= sc_get_bit(sc, d, (i * teeth + j) * COMB_SPACING + pos) << j;
+
+      sign = bits >> (teeth - 1);
+      index = (bits ^ (sign - 1)) & (size - 1);
+
+      fe_lookup(fe, entry, &ec->wnd_comb[i * stride], 3, size, index);
+
+      fe_neg_cond(fe, t.x, &entry[0 * fe->words], sign ^ 1);
+      fe_set(fe, t.y, &entry[1 * fe->words]);
+      fe_set(fe, t.z, fe->one);
+      fe_neg_cond(fe, t.t, &entry[2 * fe->words], sign ^ 1);
+
+      xge_add(ec, r, r, &t);
+    }
+  }
+
+  xge_add(ec, r, r, &ec->unblind);
+
+  /* Cleanse. */
+  sc_cleanse(sc, d);
+
+  cleanse(entry, sizeof(entry));
+  cleanse(&bits, sizeof(bits));
+  cleanse(&sign, sizeof(sign));
+  cleanse(&index, sizeof(index));
+}
+
 static void
 edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k) {
   /* Fixed-base method for point multiplication.
@@ -6686,6 +7428,11 @@ edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k) {
   sc_t k0;
   xge_t t;
 
+  if (ec->wnd_comb != NULL) {
+    edwards_mul_comb(ec, r, k);
+    return;
+  }
+
   /* Blind if available. */
   sc_add(sc, k0, k, ec->blind);
 
@@ -6804,13 +7551,55 @@ edwards_mul_double_var(const edwards_t *ec,
 }
 
 static void
-edwards_mul_multi_var(const edwards_t *ec,
-                      xge_t *r,
-                      const sc_t k0,
-                      const xge_t *points,
-                      const sc_t *coeffs,
-                      size_t len,
-                      struct edwards_scratch_s *scratch) {
+edwards_mul_double_pub_var(const edwards_t *ec,
+                           xge_t *r,
+                           const sc_t k1,
+                           const xge_t *wnd2,
+                           const sc_t k2) {
+  /* Same as above, but with a precomputed
+   * window for the second point.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd1 = ec->wnd_naf;
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  size_t i, max, max1, max2;
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, NAF_WIDTH_PRE);
+  max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH_PUB);
+  max = ECC_MAX(max1, max2);
+
+  /* Multiply and add. */
+  xge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      xge_dbl(ec, r, r);
+
+    if (z1 > 0)
+      xge_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      xge_add(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      xge_sub(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+  }
+}
+
+static void
+edwards_mul_multi_normal_var(const edwards_t *ec,
+                             xge_t *r,
+                             const sc_t k0,
+                             const xge_t *points,
+                             const sc_t *coeffs,
+                             size_t len,
+                             struct edwards_scratch_s *scratch) {
   /* Multiple point multiplication, also known
    * as "Shamir's trick" (with interleaved NAFs).
    *
@@ -6826,6 +7615,7 @@ edwards_mul_multi_var(const edwards_t *ec,
   int **nafs = scratch->nafs;
   size_t i, j, max, size;
 
+  ASSERT(len < PIPPENGER_MIN);
   ASSERT(len <= scratch->size);
 
   /* Compute fixed NAF. */
@@ -6887,27 +7677,154 @@ edwards_mul_multi_var(const edwards_t *ec,
     else if (z1 < 0)
       xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
   }
-}
+}
+
+static void
+edwards_mul_multi_pippenger_var(const edwards_t *ec,
+                                xge_t *r,
+                                const sc_t k0,
+                                const xge_t *points,
+                                const sc_t *coeffs,
+                                size_t len,
+                                struct edwards_scratch_s *scratch) {
+  /* Multiple point multiplication using
+   * Pippenger's bucket method.
+   *
+   * [PIPPENGER] Page 3, Section 2.
+   * [BOS] Page 5, Section 4.
+   *
+   * See wei_jmul_multi_pippenger_var.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  size_t width = pippenger_width(len);
+  size_t windows = pippenger_windows(sc->bits, width);
+  size_t size = (size_t)1 << (width - 1);
+  xge_t *buckets = scratch->buckets;
+  int *digits = scratch->digits;
+  xge_t acc, sum, run;
+  size_t i, j, k;
+
+  ASSERT(len >= PIPPENGER_MIN);
+  ASSERT(len <= scratch->size);
+
+  for (i = 1; i < len; i++)
+    sc_pippenger_var(sc, &digits[i * windows], coeffs[i], width, windows);
+
+  xge_zero(ec, &acc);
+
+  for (j = windows; j-- > 0;) {
+    for (k = 0; k < width; k++)
+      xge_dbl(ec, &acc, &acc);
+
+    for (k = 0; k < size; k++)
+      xge_zero(ec, &buckets[k]);
+
+    for (i = 1; i < len; i++) {
+      int z = digits[i * windows + j];
+
+      if (z > 0)
+        xge_add(ec, &buckets[z - 1], &buckets[z - 1], &points[i]);
+      else if (z < 0)
+        xge_sub(ec, &buckets[-z - 1], &buckets[-z - 1], &points[i]);
+    }
+
+    xge_zero(ec, &sum);
+    xge_zero(ec, &run);
+
+    for (k = size; k-- > 0;) {
+      xge_add(ec, &run, &run, &buckets[k]);
+      xge_add(ec, &sum, &sum, &run);
+    }
+
+    xge_add(ec, &acc, &acc, &sum);
+  }
+
+  edwards_mul_double_var(ec, r, k0, &points[0], coeffs[0]);
+
+  xge_add(ec, r, r, &acc);
+}
+
+static void
+edwards_mul_multi_var(const edwards_t *ec,
+                      xge_t *r,
+                      const sc_t k0,
+                      const xge_t *points,
+                      const sc_t *coeffs,
+                      size_t len,
+                      struct edwards_scratch_s *scratch) {
+  if (len >= PIPPENGER_MIN)
+    edwards_mul_multi_pippenger_var(ec, r, k0, points, coeffs, len, scratch);
+  else
+    edwards_mul_multi_normal_var(ec, r, k0, points, coeffs, len, scratch);
+}
+
+static void
+edwards_randomize(edwards_t *ec, const unsigned char *entropy) {
+  const scalar_field_t *sc = &ec->sc;
+  sc_t blind;
+  xge_t unblind;
+  drbg_t rng;
+
+  drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+
+  sc_random(sc, blind, &rng);
+
+  edwards_mul_g(ec, &unblind, blind);
+
+  sc_neg(sc, ec->blind, blind);
+  xge_set(ec, &ec->unblind, &unblind);
+
+  sc_cleanse(sc, blind);
+  xge_cleanse(ec, &unblind);
+  cleanse(&rng, sizeof(rng));
+}
+
+static int
+edwards_precompute(edwards_t *ec, unsigned int width) {
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t blocks, bits, i;
+  sc_t one;
+
+  if (width != 0 && (width < COMB_MIN_WIDTH || width > COMB_MAX_WIDTH))
+    return 0;
+
+  if (ec->wnd_comb != NULL) {
+    free(ec->wnd_comb);
+
+    ec->comb_teeth = 0;
+    ec->comb_blocks = 0;
+    ec->wnd_comb = NULL;
+  }
 
-static void
-edwards_randomize(edwards_t *ec, const unsigned char *entropy) {
-  const scalar_field_t *sc = &ec->sc;
-  sc_t blind;
-  xge_t unblind;
-  drbg_t rng;
+  if (width == 0)
+    return 1;
 
-  drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+  blocks = COMB_BLOCKS(sc->bits, width);
+  bits = blocks * width * COMB_SPACING;
 
-  sc_random(sc, blind, &rng);
+  /* half = 1 / 2 mod n */
+  sc_set_word(sc, one, 1);
+  sc_add(sc, ec->comb_half, one, one);
+  sc_invert_var(sc, ec->comb_half, ec->comb_half);
 
-  edwards_mul_g(ec, &unblind, blind);
+  /* adj = 2^c - 1 mod n */
+  sc_set(sc, ec->comb_adj, one);
 
-  sc_neg(sc, ec->blind, blind);
-  xge_set(ec, &ec->unblind, &unblind);
+  for (i = 0; i < bits; i++)
+    sc_add(sc, ec->comb_adj, ec->comb_adj, ec->comb_adj);
 
-  sc_cleanse(sc, blind);
-  xge_cleanse(ec, &unblind);
-  cleanse(&rng, sizeof(rng));
+  sc_sub(sc, ec->comb_adj, ec->comb_adj, one);
+
+  ec->wnd_comb = checked_malloc(blocks * COMB_SIZE(width) * 3
+                                * fe->words * sizeof(fe_word_t));
+
+  xge_comb_points_var(ec, ec->wnd_comb, &ec->g, width);
+
+  ec->comb_teeth = width;
+  ec->comb_blocks = blocks;
+
+  return 1;
 }
 
 static void
@@ -7847,6 +8764,30 @@ static const endo_def_t endo_secp256k1 = {
 
 #include "subgroups.h"
 
+/*
+ * Precomputed Tables
+ */
+
+#if defined(TORSION_USE_TABLES) && defined(TORSION_HAVE_INT128)
+/* Generated by scripts/gen-tables.c with these window sizes. */
+#if FIXED_WIDTH != 4 || NAF_WIDTH_PRE != 12
+#error "Precomputed tables must be regenerated."
+#endif
+#include "tables/p192_64.h"
+#include "tables/p224_64.h"
+#include "tables/p256_64.h"
+#include "tables/p384_64.h"
+#include "tables/p521_64.h"
+#ifndef TORSION_USE_LIBSECP256K1
+#include "tables/secp256k1_64.h"
+#endif
+#include "tables/ed25519_64.h"
+#include "tables/ed448_64.h"
+#define TABLES(name) (&tables_ ## name)
+#else
+#define TABLES(name) NULL
+#endif
+
 /*
  * Short Weierstrass Curves
  */
@@ -7882,7 +8823,8 @@ static const wei_def_t curve_p192 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  TABLES(p192)
 };
 
 static const wei_def_t curve_p224 = {
@@ -7920,7 +8862,8 @@ static const wei_def_t curve_p224 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  TABLES(p224)
 };
 
 static const wei_def_t curve_p256 = {
@@ -7958,7 +8901,8 @@ static const wei_def_t curve_p256 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  TABLES(p256)
 };
 
 static const wei_def_t curve_p384 = {
@@ -8004,7 +8948,8 @@ static const wei_def_t curve_p384 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  TABLES(p384)
 };
 
 static const wei_def_t curve_p521 = {
@@ -8062,7 +9007,8 @@ static const wei_def_t curve_p521 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  TABLES(p521)
 };
 
 static const wei_def_t curve_secp256k1 = {
@@ -8106,7 +9052,12 @@ static const wei_def_t curve_secp256k1 = {
     0x7d, 0x8d, 0x27, 0xae, 0x1c, 0xd5, 0xf8, 0x52
   },
   subgroups_prime,
-  &endo_secp256k1
+  &endo_secp256k1,
+#ifdef TORSION_USE_LIBSECP256K1
+  NULL
+#else
+  TABLES(secp256k1)
+#endif
 };
 
 /*
@@ -8269,7 +9220,8 @@ static const edwards_def_t curve_ed25519 = {
     0xc5, 0xa1, 0xd3, 0xd1, 0x4b, 0x7d, 0x1a, 0x82,
     0xcc, 0x6e, 0x04, 0xaa, 0xff, 0x45, 0x7e, 0x06
   },
-  subgroups_ed25519
+  subgroups_ed25519,
+  TABLES(ed25519)
 };
 
 static const edwards_def_t curve_ed448 = {
@@ -8332,7 +9284,8 @@ static const edwards_def_t curve_ed448 = {
     0xc3, 0xd1, 0x12, 0x0f, 0x0e, 0xfa, 0x59, 0xf5,
     0x4b, 0xf3, 0x8e, 0x82, 0xb0, 0xe1, 0xe0, 0x28
   },
-  subgroups_ed448
+  subgroups_ed448,
+  TABLES(ed448)
 };
 
 static const edwards_def_t curve_ed1174 = {
@@ -8380,7 +9333,8 @@ static const edwards_def_t curve_ed1174 = {
     0x6f, 0x8f, 0xfb, 0xe8, 0x35, 0x95, 0x48, 0xba,
     0x82, 0x76, 0xac, 0xe6, 0xbb, 0xe7, 0xdf, 0xd2
   },
-  subgroups_ed1174
+  subgroups_ed1174,
+  NULL
 };
 
 /*
@@ -8430,6 +9384,13 @@ wei_curve_destroy(wei_t *ec) {
   if (ec != NULL) {
     sc_cleanse(&ec->sc, ec->blind);
     jge_cleanse(ec, &ec->unblind);
+
+    if (ec->wnds != NULL)
+      free(ec->wnds);
+
+    if (ec->wnd_comb != NULL)
+      free(ec->wnd_comb);
+
     free(ec);
   }
 }
@@ -8439,6 +9400,11 @@ wei_curve_randomize(wei_t *ec, const unsigned char *entropy) {
   wei_randomize(ec, entropy);
 }
 
+int
+wei_curve_precompute(wei_t *ec, unsigned int width) {
+  return wei_precompute(ec, width);
+}
+
 size_t
 wei_curve_scalar_size(const wei_t *ec) {
   return ec->sc.size;
@@ -8461,8 +9427,11 @@ wei_curve_field_bits(const wei_t *ec) {
 
 struct wei_scratch_s *
 wei_scratch_create(const wei_t *ec, size_t size) {
+  /* The JSF tables are only used below the Pippenger
+     threshold, so they stop growing at that point. */
   struct wei_scratch_s *scratch = checked_malloc(sizeof(struct wei_scratch_s));
-  size_t length = ec->endo ? size : size / 2;
+  size_t small = ECC_MIN(size, PIPPENGER_MIN - 1);
+  size_t length = ec->endo ? small : small / 2;
   size_t bits = ec->endo ? ec->sc.endo_bits : ec->sc.bits;
   size_t i;
 
@@ -8477,6 +9446,19 @@ wei_scratch_create(const wei_t *ec, size_t size) {
     scratch->nafs[i] = &scratch->naf[i * (bits + 1)];
   }
 
+  scratch->buckets = NULL;
+  scratch->digits = NULL;
+
+  if (size >= PIPPENGER_MIN) {
+    size_t width = pippenger_width(size);
+    size_t windows = pippenger_windows(ec->sc.bits,
+                                       pippenger_width(PIPPENGER_MIN));
+
+    scratch->buckets = checked_malloc(((size_t)1 << (width - 1))
+                                      * sizeof(jge_t));
+    scratch->digits = checked_malloc(size * windows * sizeof(int));
+  }
+
   scratch->points = checked_malloc(size * sizeof(wge_t));
   scratch->coeffs = checked_malloc(size * sizeof(sc_t));
 
@@ -8492,12 +9474,35 @@ wei_scratch_destroy(const wei_t *ec, struct wei_scratch_s *scratch) {
     free(scratch->wnds);
     free(scratch->naf);
     free(scratch->nafs);
+    free(scratch->buckets);
+    free(scratch->digits);
     free(scratch->points);
     free(scratch->coeffs);
     free(scratch);
   }
 }
 
+static struct wei_pubkey_s *
+wei_pubkey_create(const wei_t *ec, const wge_t *p) {
+  /* A parsed public key holds the decompressed
+     point along with an affine window of its odd
+     multiples. This removes the square root and
+     window computation from repeated verifications. */
+  struct wei_pubkey_s *key = checked_malloc(sizeof(struct wei_pubkey_s));
+
+  wge_set(ec, &key->point, p);
+  wge_naf_points_var(ec, key->wnd, p, NAF_WIDTH_PUB);
+  fe_export(&ec->fe, key->raw, p->x);
+
+  return key;
+}
+
+void
+wei_pubkey_destroy(struct wei_pubkey_s *key) {
+  if (key != NULL)
+    free(key);
+}
+
 /*
  * Montgomery API
  */
@@ -8565,6 +9570,13 @@ edwards_curve_destroy(edwards_t *ec) {
   if (ec != NULL) {
     sc_cleanse(&ec->sc, ec->blind);
     xge_cleanse(ec, &ec->unblind);
+
+    if (ec->wnds != NULL)
+      free(ec->wnds);
+
+    if (ec->wnd_comb != NULL)
+      free(ec->wnd_comb);
+
     free(ec);
   }
 }
@@ -8574,6 +9586,11 @@ edwards_curve_randomize(edwards_t *ec, const unsigned char *entropy) {
   edwards_randomize(ec, entropy);
 }
 
+int
+edwards_curve_precompute(edwards_t *ec, unsigned int width) {
+  return edwards_precompute(ec, width);
+}
+
 size_t
 edwards_curve_scalar_size(const edwards_t *ec) {
   return ec->sc.size;
@@ -8598,7 +9615,7 @@ struct edwards_scratch_s *
 edwards_scratch_create(const edwards_t *ec, size_t size) {
   struct edwards_scratch_s *scratch =
     checked_malloc(sizeof(struct edwards_scratch_s));
-  size_t length = size / 2;
+  size_t length = ECC_MIN(size, PIPPENGER_MIN - 1) / 2;
   size_t bits = ec->sc.bits;
   size_t i;
 
@@ -8613,6 +9630,19 @@ edwards_scratch_create(const edwards_t *ec, size_t size) {
     scratch->nafs[i] = &scratch->naf[i * (bits + 1)];
   }
 
+  scratch->buckets = NULL;
+  scratch->digits = NULL;
+
+  if (size >= PIPPENGER_MIN) {
+    size_t width = pippenger_width(size);
+    size_t windows = pippenger_windows(ec->sc.bits,
+                                       pippenger_width(PIPPENGER_MIN));
+
+    scratch->buckets = checked_malloc(((size_t)1 << (width - 1))
+                                      * sizeof(xge_t));
+    scratch->digits = checked_malloc(size * windows * sizeof(int));
+  }
+
   scratch->points = checked_malloc(size * sizeof(xge_t));
   scratch->coeffs = checked_malloc(size * sizeof(sc_t));
 
@@ -8629,12 +9659,95 @@ edwards_scratch_destroy(const edwards_t *ec,
     free(scratch->wnds);
     free(scratch->naf);
     free(scratch->nafs);
+    free(scratch->buckets);
+    free(scratch->digits);
     free(scratch->points);
     free(scratch->coeffs);
     free(scratch);
   }
 }
 
+static struct edwards_pubkey_s *
+edwards_pubkey_create(const edwards_t *ec,
+                      const xge_t *p,
+                      const unsigned char *raw) {
+  /* The window holds odd multiples of the negated
+     point, as verification computes G * s - A * e. */
+  struct edwards_pubkey_s *key;
+  xge_t t;
+
+  key = checked_malloc(sizeof(struct edwards_pubkey_s));
+
+  xge_neg(ec, &t, p);
+  xge_naf_points(ec, key->wnd, &t, NAF_WIDTH_PUB);
+
+  memcpy(key->raw, raw, ec->fe.adj_size);
+
+  return key;
+}
+
+void
+edwards_pubkey_destroy(struct edwards_pubkey_s *key) {
+  if (key != NULL)
+    free(key);
+}
+
+int
+edwards_mul_multi(const edwards_t *ec,
+                  unsigned char *out,
+                  const unsigned char *scalar,
+                  const unsigned char *const *points,
+                  const unsigned char *const *scalars,
+                  size_t len,
+                  struct edwards_scratch_s *scratch) {
+  /* Computes G * scalar + sum(points[i] * scalars[i])
+   * in variable time. Scalars are reduced modulo the
+   * group order. A null base scalar is treated as zero.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  xge_t *pts = scratch->points;
+  sc_t *coeffs = scratch->coeffs;
+  xge_t R, T;
+  sc_t k0;
+  size_t i, j;
+  int ret = 1;
+
+  CHECK(scratch->size >= 2);
+
+  sc_zero(sc, k0);
+
+  if (scalar != NULL)
+    sc_import_reduce(sc, k0, scalar);
+
+  xge_zero(ec, &R);
+
+  for (i = 0, j = 0; i < len; i++) {
+    ret &= xge_import(ec, &pts[j], points[i]);
+
+    sc_import_reduce(sc, coeffs[j], scalars[i]);
+
+    j += 1;
+
+    if (j == scratch->size) {
+      edwards_mul_multi_var(ec, &T, k0, pts, (const sc_t *)coeffs, j, scratch);
+
+      xge_add(ec, &R, &R, &T);
+
+      sc_zero(sc, k0);
+
+      j = 0;
+    }
+  }
+
+  edwards_mul_multi_var(ec, &T, k0, pts, (const sc_t *)coeffs, j, scratch);
+
+  xge_add(ec, &R, &R, &T);
+
+  xge_export(ec, out, &R);
+
+  return ret;
+}
+
 /*
  * ECDSA
  */
@@ -9462,13 +10575,13 @@ ecdsa_sign_internal(const wei_t *ec,
   return ret;
 }
 
-int
-ecdsa_verify(const wei_t *ec,
-             const unsigned char *msg,
-             size_t msg_len,
-             const unsigned char *sig,
-             const unsigned char *pub,
-             size_t pub_len) {
+static int
+ecdsa_verify_point(const wei_t *ec,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   const unsigned char *sig,
+                   const wge_t *A,
+                   const wge_t *wnd) {
   /* ECDSA Verification.
    *
    * [SEC1] Page 46, Section 4.1.4.
@@ -9503,7 +10616,7 @@ ecdsa_verify(const wei_t *ec,
   const prime_field_t *fe = &ec->fe;
   const scalar_field_t *sc = &ec->sc;
   sc_t m, r, s, u1, u2;
-  wge_t A, R;
+  wge_t R;
   jge_t J;
   sc_t x;
 
@@ -9519,22 +10632,21 @@ ecdsa_verify(const wei_t *ec,
   if (sc_is_high_var(sc, s))
     return 0;
 
-  if (!wge_import(ec, &A, pub, pub_len))
-    return 0;
-
   ecdsa_reduce(ec, m, msg, msg_len);
 
   ASSERT(sc_invert_var(sc, s, s));
   sc_mul(sc, u1, m, s);
   sc_mul(sc, u2, r, s);
 
-  if (ec->small_gap) {
-    wei_jmul_double_var(ec, &J, u1, &A, u2);
+  if (wnd != NULL)
+    wei_jmul_double_pub_var(ec, &J, u1, wnd, u2);
+  else
+    wei_jmul_double_var(ec, &J, u1, A, u2);
 
+  if (ec->small_gap)
     return jge_equal_r_var(ec, &J, r);
-  }
 
-  wei_mul_double_var(ec, &R, u1, &A, u2);
+  jge_to_wge_var(ec, &R, &J);
 
   if (wge_is_zero(ec, &R))
     return 0;
@@ -9544,6 +10656,42 @@ ecdsa_verify(const wei_t *ec,
   return sc_equal(sc, x, r);
 }
 
+int
+ecdsa_verify(const wei_t *ec,
+             const unsigned char *msg,
+             size_t msg_len,
+             const unsigned char *sig,
+             const unsigned char *pub,
+             size_t pub_len) {
+  wge_t A;
+
+  if (!wge_import(ec, &A, pub, pub_len))
+    return 0;
+
+  return ecdsa_verify_point(ec, msg, msg_len, sig, &A, NULL);
+}
+
+struct wei_pubkey_s *
+ecdsa_pubkey_parse(const wei_t *ec,
+                   const unsigned char *pub,
+                   size_t pub_len) {
+  wge_t A;
+
+  if (!wge_import(ec, &A, pub, pub_len))
+    return NULL;
+
+  return wei_pubkey_create(ec, &A);
+}
+
+int
+ecdsa_verify_parsed(const wei_t *ec,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const unsigned char *sig,
+                    const struct wei_pubkey_s *key) {
+  return ecdsa_verify_point(ec, msg, msg_len, sig, &key->point, key->wnd);
+}
+
 int
 ecdsa_recover(const wei_t *ec,
               unsigned char *pub,
@@ -10672,12 +11820,14 @@ schnorr_sign(const wei_t *ec,
   return ret;
 }
 
-int
-schnorr_verify(const wei_t *ec,
-               const unsigned char *msg,
-               size_t msg_len,
-               const unsigned char *sig,
-               const unsigned char *pub) {
+static int
+schnorr_verify_point(const wei_t *ec,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     const unsigned char *sig,
+                     const unsigned char *pub,
+                     const wge_t *A,
+                     const wge_t *wnd) {
   /* Schnorr Verification.
    *
    * [BIP340] "Verification".
@@ -10723,7 +11873,6 @@ schnorr_verify(const wei_t *ec,
   const unsigned char *sraw = sig + fe->size;
   fe_t r;
   sc_t s, e;
-  wge_t A;
   jge_t R;
 
   if (!fe_import(fe, r, Rraw))
@@ -10732,14 +11881,14 @@ schnorr_verify(const wei_t *ec,
   if (!sc_import(sc, s, sraw))
     return 0;
 
-  if (!wge_import_even(ec, &A, pub))
-    return 0;
-
   schnorr_hash_challenge(ec, e, Rraw, pub, msg, msg_len);
 
   sc_neg(sc, e, e);
 
-  wei_jmul_double_var(ec, &R, s, &A, e);
+  if (wnd != NULL)
+    wei_jmul_double_pub_var(ec, &R, s, wnd, e);
+  else
+    wei_jmul_double_var(ec, &R, s, A, e);
 
   if (!jge_is_square_var(ec, &R))
     return 0;
@@ -10750,6 +11899,44 @@ schnorr_verify(const wei_t *ec,
   return 1;
 }
 
+int
+schnorr_verify(const wei_t *ec,
+               const unsigned char *msg,
+               size_t msg_len,
+               const unsigned char *sig,
+               const unsigned char *pub) {
+  wge_t A;
+
+  if (!wge_import_even(ec, &A, pub))
+    return 0;
+
+  return schnorr_verify_point(ec, msg, msg_len, sig, pub, &A, NULL);
+}
+
+struct wei_pubkey_s *
+schnorr_pubkey_parse(const wei_t *ec, const unsigned char *pub) {
+  wge_t A;
+
+  if (!wge_import_even(ec, &A, pub))
+    return NULL;
+
+  return wei_pubkey_create(ec, &A);
+}
+
+int
+schnorr_verify_parsed(const wei_t *ec,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *sig,
+                      const struct wei_pubkey_s *key) {
+  /* Keys parsed as ECDSA keys may have an odd Y. */
+  if (fe_is_odd(&ec->fe, key->point.y))
+    return 0;
+
+  return schnorr_verify_point(ec, msg, msg_len, sig,
+                              key->raw, &key->point, key->wnd);
+}
+
 int
 schnorr_verify_batch(const wei_t *ec,
                      const unsigned char *const *msgs,
@@ -12040,15 +13227,17 @@ eddsa_sign_tweak_mul(const edwards_t *ec,
   cleanse(prefix, sizeof(prefix));
 }
 
-int
-eddsa_verify(const edwards_t *ec,
-             const unsigned char *msg,
-             size_t msg_len,
-             const unsigned char *sig,
-             const unsigned char *pub,
-             int ph,
-             const unsigned char *ctx,
-             size_t ctx_len) {
+static int
+eddsa_verify_point(const edwards_t *ec,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   const unsigned char *sig,
+                   const unsigned char *pub,
+                   const xge_t *A,
+                   const xge_t *wnd,
+                   int ph,
+                   const unsigned char *ctx,
+                   size_t ctx_len) {
   /* EdDSA Verification.
    *
    * [EDDSA] Page 15, Section 5.
@@ -12078,15 +13267,12 @@ eddsa_verify(const edwards_t *ec,
   const scalar_field_t *sc = &ec->sc;
   const unsigned char *Rraw = sig;
   const unsigned char *sraw = sig + fe->adj_size;
-  xge_t R, A, Re;
+  xge_t R, Re, T;
   sc_t s, e;
 
   if (!xge_import(ec, &R, Rraw))
     return 0;
 
-  if (!xge_import(ec, &A, pub))
-    return 0;
-
   if (!sc_import(sc, s, sraw))
     return 0;
 
@@ -12097,13 +13283,57 @@ eddsa_verify(const edwards_t *ec,
 
   eddsa_hash_challenge(ec, e, Rraw, pub, msg, msg_len, ph, ctx, ctx_len);
 
-  xge_neg(ec, &A, &A);
-
-  edwards_mul_double_var(ec, &Re, s, &A, e);
+  if (wnd != NULL) {
+    edwards_mul_double_pub_var(ec, &Re, s, wnd, e);
+  } else {
+    xge_neg(ec, &T, A);
+    edwards_mul_double_var(ec, &Re, s, &T, e);
+  }
 
   return xge_equal(ec, &R, &Re);
 }
 
+int
+eddsa_verify(const edwards_t *ec,
+             const unsigned char *msg,
+             size_t msg_len,
+             const unsigned char *sig,
+             const unsigned char *pub,
+             int ph,
+             const unsigned char *ctx,
+             size_t ctx_len) {
+  xge_t A;
+
+  if (!xge_import(ec, &A, pub))
+    return 0;
+
+  return eddsa_verify_point(ec, msg, msg_len, sig, pub,
+                            &A, NULL, ph, ctx, ctx_len);
+}
+
+struct edwards_pubkey_s *
+eddsa_pubkey_parse(const edwards_t *ec, const unsigned char *pub) {
+  xge_t A;
+
+  if (!xge_import(ec, &A, pub))
+    return NULL;
+
+  return edwards_pubkey_create(ec, &A, pub);
+}
+
+int
+eddsa_verify_parsed(const edwards_t *ec,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const unsigned char *sig,
+                    const struct edwards_pubkey_s *key,
+                    int ph,
+                    const unsigned char *ctx,
+                    size_t ctx_len) {
+  return eddsa_verify_point(ec, msg, msg_len, sig, key->raw,
+                            NULL, key->wnd, ph, ctx, ctx_len);
+}
+
 int
 eddsa_verify_single(const edwards_t *ec,
                     const unsigned char *msg,
@@ -23,6 +23,7 @@
 #include <string.h>
 #include <torsion/encoding.h>
 #include "internal.h"
+#include "entropy/entropy.h"
 
 /*
  * Base16 Engine
@@ -68,6 +69,348 @@ static const int8_t base16_table[256] = {
   -1, -1, -1, -1, -1, -1, -1, -1
 };
 
+#if defined(TORSION_HAVE_ASM_X64)
+static const unsigned char base16_simd_lut[16] = {
+  '0', '1', '2', '3', '4', '5', '6', '7',
+  '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+/* Biases which move each class of valid
+   characters to the bottom of the signed
+   byte range, allowing a single pcmpgtb
+   per class for range checking. */
+static const unsigned char base16_simd_consts[8][16] = {
+  /* Nibble mask. */
+  {0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+   0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f},
+  /* 0x80 - '0' */
+  {0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+   0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50},
+  /* Lowercase bit. */
+  {0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20},
+  /* 0x80 - 'a' */
+  {0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+   0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f},
+  /* Digit bound (0x80 + 10), letter offset (10 - 0x80). */
+  {0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
+   0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a},
+  /* Letter bound (0x80 + 6). */
+  {0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+   0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86},
+  /* Sign bit. */
+  {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+  /* Nibble weights for pmaddubsw. */
+  {0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+   0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01}
+};
+
+static void
+base16_encode_ssse3(char *dst, const uint8_t *src, size_t blocks) {
+  /* 16 bytes in, 32 characters out.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-5]
+   */
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "movdqu (%[t]), %%xmm4\n"
+    "movdqu (%[k]), %%xmm5\n"
+    "1:\n"
+    "movdqu (%[s]), %%xmm0\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "psrlw $4, %%xmm1\n"
+    "pand %%xmm5, %%xmm0\n"
+    "pand %%xmm5, %%xmm1\n"
+    "movdqa %%xmm4, %%xmm2\n"
+    "movdqa %%xmm4, %%xmm3\n"
+    "pshufb %%xmm0, %%xmm2\n"
+    "pshufb %%xmm1, %%xmm3\n"
+    "movdqa %%xmm3, %%xmm0\n"
+    "punpcklbw %%xmm2, %%xmm3\n"
+    "punpckhbw %%xmm2, %%xmm0\n"
+    "movdqu %%xmm3, (%[d])\n"
+    "movdqu %%xmm0, 16(%[d])\n"
+    "addq $16, %[s]\n"
+    "addq $32, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks)
+    : [t] "r" (base16_simd_lut), [k] "r" (base16_simd_consts[0])
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "cc", "memory"
+  );
+}
+
+static void
+base16_encode_avx2(char *dst, const uint8_t *src, size_t blocks) {
+  /* 32 bytes in, 64 characters out. The unpacks
+   * work within 128-bit lanes, so the halves are
+   * reassembled with vperm2i128 before storing.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-5]
+   */
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "vbroadcasti128 (%[t]), %%ymm4\n"
+    "vbroadcasti128 (%[k]), %%ymm5\n"
+    "1:\n"
+    "vmovdqu (%[s]), %%ymm0\n"
+    "vpsrlw $4, %%ymm0, %%ymm1\n"
+    "vpand %%ymm5, %%ymm0, %%ymm0\n"
+    "vpand %%ymm5, %%ymm1, %%ymm1\n"
+    "vpshufb %%ymm0, %%ymm4, %%ymm2\n"
+    "vpshufb %%ymm1, %%ymm4, %%ymm3\n"
+    "vpunpcklbw %%ymm2, %%ymm3, %%ymm0\n"
+    "vpunpckhbw %%ymm2, %%ymm3, %%ymm1\n"
+    "vperm2i128 $0x20, %%ymm1, %%ymm0, %%ymm2\n"
+    "vperm2i128 $0x31, %%ymm1, %%ymm0, %%ymm3\n"
+    "vmovdqu %%ymm2, (%[d])\n"
+    "vmovdqu %%ymm3, 32(%[d])\n"
+    "addq $32, %[s]\n"
+    "addq $64, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "vzeroupper\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks)
+    : [t] "r" (base16_simd_lut), [k] "r" (base16_simd_consts[0])
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "cc", "memory"
+  );
+}
+
+static int
+base16_decode_ssse3(uint8_t *dst, const char *src, size_t blocks) {
+  /* 32 characters in, 16 bytes out. Digits and
+   * letters are range-checked separately and
+   * the nibbles are joined with pmaddubsw.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *   %[k] = constants
+   *   %[r] = validity mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-15]
+   */
+  uint32_t mask;
+
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "movdqu 16(%[k]), %%xmm8\n"
+    "movdqu 32(%[k]), %%xmm9\n"
+    "movdqu 48(%[k]), %%xmm10\n"
+    "movdqu 64(%[k]), %%xmm11\n"
+    "movdqu 80(%[k]), %%xmm12\n"
+    "movdqu 96(%[k]), %%xmm13\n"
+    "movdqu 112(%[k]), %%xmm14\n"
+    "pcmpeqb %%xmm15, %%xmm15\n"
+    "1:\n"
+    "movdqu (%[s]), %%xmm0\n"
+    "movdqu 16(%[s]), %%xmm4\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "movdqa %%xmm4, %%xmm5\n"
+    "paddb %%xmm8, %%xmm1\n"
+    "paddb %%xmm8, %%xmm5\n"
+    "por %%xmm9, %%xmm0\n"
+    "por %%xmm9, %%xmm4\n"
+    "paddb %%xmm10, %%xmm0\n"
+    "paddb %%xmm10, %%xmm4\n"
+    "movdqa %%xmm11, %%xmm2\n"
+    "movdqa %%xmm11, %%xmm6\n"
+    "pcmpgtb %%xmm1, %%xmm2\n"
+    "pcmpgtb %%xmm5, %%xmm6\n"
+    "movdqa %%xmm12, %%xmm3\n"
+    "movdqa %%xmm12, %%xmm7\n"
+    "pcmpgtb %%xmm0, %%xmm3\n"
+    "pcmpgtb %%xmm4, %%xmm7\n"
+    "pxor %%xmm13, %%xmm1\n"
+    "pxor %%xmm13, %%xmm5\n"
+    "paddb %%xmm11, %%xmm0\n"
+    "paddb %%xmm11, %%xmm4\n"
+    "pand %%xmm2, %%xmm1\n"
+    "pand %%xmm6, %%xmm5\n"
+    "pand %%xmm3, %%xmm0\n"
+    "pand %%xmm7, %%xmm4\n"
+    "por %%xmm1, %%xmm0\n"
+    "por %%xmm5, %%xmm4\n"
+    "por %%xmm3, %%xmm2\n"
+    "por %%xmm7, %%xmm6\n"
+    "pand %%xmm2, %%xmm15\n"
+    "pand %%xmm6, %%xmm15\n"
+    "pmaddubsw %%xmm14, %%xmm0\n"
+    "pmaddubsw %%xmm14, %%xmm4\n"
+    "packuswb %%xmm4, %%xmm0\n"
+    "movdqu %%xmm0, (%[d])\n"
+    "addq $32, %[s]\n"
+    "addq $16, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "pmovmskb %%xmm15, %[r]\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks), [r] "=r" (mask)
+    : [k] "r" (base16_simd_consts[0])
+    : "xmm0", "xmm1", "xmm2", "xmm3",
+      "xmm4", "xmm5", "xmm6", "xmm7",
+      "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15",
+      "cc", "memory"
+  );
+
+  return mask == 0xffff;
+}
+
+static int
+base16_decode_avx2(uint8_t *dst, const char *src, size_t blocks) {
+  /* 64 characters in, 32 bytes out. The pack
+   * interleaves 128-bit lanes; vpermq restores
+   * the byte order.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *   %[k] = constants
+   *   %[r] = validity mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-15]
+   */
+  uint32_t mask;
+
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "vbroadcasti128 16(%[k]), %%ymm8\n"
+    "vbroadcasti128 32(%[k]), %%ymm9\n"
+    "vbroadcasti128 48(%[k]), %%ymm10\n"
+    "vbroadcasti128 64(%[k]), %%ymm11\n"
+    "vbroadcasti128 80(%[k]), %%ymm12\n"
+    "vbroadcasti128 96(%[k]), %%ymm13\n"
+    "vbroadcasti128 112(%[k]), %%ymm14\n"
+    "vpcmpeqb %%ymm15, %%ymm15, %%ymm15\n"
+    "1:\n"
+    "vmovdqu (%[s]), %%ymm0\n"
+    "vmovdqu 32(%[s]), %%ymm4\n"
+    "vpaddb %%ymm8, %%ymm0, %%ymm1\n"
+    "vpaddb %%ymm8, %%ymm4, %%ymm5\n"
+    "vpor %%ymm9, %%ymm0, %%ymm0\n"
+    "vpor %%ymm9, %%ymm4, %%ymm4\n"
+    "vpaddb %%ymm10, %%ymm0, %%ymm0\n"
+    "vpaddb %%ymm10, %%ymm4, %%ymm4\n"
+    "vpcmpgtb %%ymm1, %%ymm11, %%ymm2\n"
+    "vpcmpgtb %%ymm5, %%ymm11, %%ymm6\n"
+    "vpcmpgtb %%ymm0, %%ymm12, %%ymm3\n"
+    "vpcmpgtb %%ymm4, %%ymm12, %%ymm7\n"
+    "vpxor %%ymm13, %%ymm1, %%ymm1\n"
+    "vpxor %%ymm13, %%ymm5, %%ymm5\n"
+    "vpaddb %%ymm11, %%ymm0, %%ymm0\n"
+    "vpaddb %%ymm11, %%ymm4, %%ymm4\n"
+    "vpand %%ymm2, %%ymm1, %%ymm1\n"
+    "vpand %%ymm6, %%ymm5, %%ymm5\n"
+    "vpand %%ymm3, %%ymm0, %%ymm0\n"
+    "vpand %%ymm7, %%ymm4, %%ymm4\n"
+    "vpor %%ymm1, %%ymm0, %%ymm0\n"
+    "vpor %%ymm5, %%ymm4, %%ymm4\n"
+    "vpor %%ymm3, %%ymm2, %%ymm2\n"
+    "vpor %%ymm7, %%ymm6, %%ymm6\n"
+    "vpand %%ymm2, %%ymm15, %%ymm15\n"
+    "vpand %%ymm6, %%ymm15, %%ymm15\n"
+    "vpmaddubsw %%ymm14, %%ymm0, %%ymm0\n"
+    "vpmaddubsw %%ymm14, %%ymm4, %%ymm4\n"
+    "vpackuswb %%ymm4, %%ymm0, %%ymm0\n"
+    "vpermq $0xd8, %%ymm0, %%ymm0\n"
+    "vmovdqu %%ymm0, (%[d])\n"
+    "addq $64, %[s]\n"
+    "addq $32, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "vpmovmskb %%ymm15, %[r]\n"
+    "vzeroupper\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks), [r] "=r" (mask)
+    : [k] "r" (base16_simd_consts[0])
+    : "xmm0", "xmm1", "xmm2", "xmm3",
+      "xmm4", "xmm5", "xmm6", "xmm7",
+      "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15",
+      "cc", "memory"
+  );
+
+  return mask == 0xffffffff;
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
+static size_t
+base16_encode_fast(char *dst, const uint8_t *src, size_t len) {
+  /* Returns the number of bytes consumed. */
+  size_t n = 0;
+#if defined(TORSION_HAVE_ASM_X64)
+  if (len >= 64 && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    n = len & ~(size_t)31;
+    base16_encode_avx2(dst, src, n / 32);
+  } else if (len >= 32 && torsion_cpu_has(TORSION_CPU_SSSE3)) {
+    n = len & ~(size_t)15;
+    base16_encode_ssse3(dst, src, n / 16);
+  }
+#else
+  (void)dst;
+  (void)src;
+  (void)len;
+#endif
+  return n;
+}
+
+static size_t
+base16_decode_fast(uint8_t *dst, const char *src, size_t len, uint8_t *z) {
+  /* Returns the number of characters consumed.
+     Invalid input sets the high bit of `z`. */
+  size_t n = 0;
+#if defined(TORSION_HAVE_ASM_X64)
+  int ok = 1;
+
+  if (len >= 128 && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    n = len & ~(size_t)63;
+    ok = base16_decode_avx2(dst, src, n / 64);
+  } else if (len >= 64 && torsion_cpu_has(TORSION_CPU_SSSE3)) {
+    n = len & ~(size_t)31;
+    ok = base16_decode_ssse3(dst, src, n / 32);
+  }
+
+  if (!ok)
+    *z |= 0x80;
+#else
+  (void)dst;
+  (void)src;
+  (void)len;
+  (void)z;
+#endif
+  return n;
+}
+
 static size_t
 base16_encode_size0(size_t len) {
   return len * 2;
@@ -80,6 +423,12 @@ base16_encode0(char *dst, size_t *dstlen,
   size_t i = endian < 0 ? srclen - 1 : 0;
   size_t j = 0;
 
+  if (endian > 0) {
+    i = base16_encode_fast(dst, src, srclen);
+    j = i * 2;
+    srclen -= i;
+  }
+
   while (srclen--) {
     dst[j++] = base16_charset[src[i] >> 4];
     dst[j++] = base16_charset[src[i] & 15];
@@ -109,6 +458,12 @@ base16_decode0(uint8_t *dst, size_t *dstlen,
   if (srclen & 1)
     return 0;
 
+  if (endian > 0) {
+    i = base16_decode_fast(dst, src, srclen, &z);
+    j = i / 2;
+    srclen -= i;
+  }
+
   srclen /= 2;
   endian *= 2;
 
@@ -135,9 +490,27 @@ base16_decode0(uint8_t *dst, size_t *dstlen,
 
 static int
 base16_test0(const char *str, size_t len) {
+  uint8_t tmp[256];
+  uint8_t z = 0;
+  size_t n;
+
   if (len & 1)
     return 0;
 
+  /* Validate in bulk, discarding the output. */
+  while (len >= 64) {
+    n = base16_decode_fast(tmp, str, len < 512 ? len : 512, &z);
+
+    if (n == 0)
+      break;
+
+    if (z & 0x80)
+      return 0;
+
+    str += n;
+    len -= n;
+  }
+
   while (len--) {
     if (base16_table[(uint8_t)str[len]] == -1)
       return 0;
@@ -634,68 +1007,102 @@ static const int8_t base58_table[256] = {
   -1, -1, -1, -1, -1, -1, -1, -1
 };
 
+/* Conversion is done in limbs of 58^5, the
+   largest power of 58 below 2^32. Each step
+   folds 32 bits of input (or five digits of
+   output) into every limb with a single 64
+   bit multiply-accumulate, doing roughly a
+   twentieth of the work of a byte-at-a-time
+   carry loop. */
+#define BASE58_LIMB UINT32_C(656356768)
+
+static const uint32_t base58_pow[6] = {
+  1, 58, 3364, 195112, 11316496, 656356768
+};
+
 int
 base58_encode(char *dst, size_t *dstlen,
               const uint8_t *src, size_t srclen) {
   size_t zeroes = 0;
   size_t length = 0;
-  size_t i, j, k, size;
-  unsigned long carry;
-  uint8_t *b58;
+  size_t i, j, k, n, size;
+  uint32_t *limbs;
+  uint64_t carry;
+  uint32_t word;
+  uint8_t tmp[5];
 
   if (srclen > 0x7fffffff)
     return 0;
 
-  for (i = 0; i < srclen; i++) {
-    if (src[i] != 0)
-      break;
-
+  while (zeroes < srclen && src[zeroes] == 0)
     zeroes += 1;
-  }
 
-  size = (uint64_t)(srclen - zeroes) * 138 / 100 + 1;
-  b58 = malloc(size);
+  src += zeroes;
+  srclen -= zeroes;
+
+  /* log(256) / log(58^5) ~= 0.2731 */
+  size = (uint64_t)srclen * 138 / 500 + 1;
+  limbs = malloc(size * sizeof(uint32_t));
 
-  if (b58 == NULL)
+  if (limbs == NULL)
     return 0;
 
-  memset(b58, 0, size);
+  for (i = 0; i < srclen; i += n) {
+    n = (i == 0 && (srclen & 3) != 0) ? (srclen & 3) : 4;
+    word = 0;
 
-  for (; i < srclen; i++) {
-    carry = src[i];
+    for (j = 0; j < n; j++)
+      word = (word << 8) | src[i + j];
 
-    for (j = 0, k = size - 1; j < size; j++, k--) {
-      if (carry == 0 && j >= length)
-        break;
+    carry = word;
 
-      carry += (unsigned long)b58[k] << 8;
-      b58[k] = carry % 58;
-      carry /= 58;
+    for (j = 0; j < length; j++) {
+      carry += (uint64_t)limbs[j] << (n * 8);
+      limbs[j] = (uint32_t)(carry % BASE58_LIMB);
+      carry /= BASE58_LIMB;
     }
 
-    ASSERT(carry == 0);
-
-    length = j;
+    while (carry != 0) {
+      ASSERT(length < size);
+      limbs[length++] = (uint32_t)(carry % BASE58_LIMB);
+      carry /= BASE58_LIMB;
+    }
   }
 
-  i = size - length;
-
-  while (i < size && b58[i] == 0)
-    i += 1;
-
-  /* Assumes sizeof(dst) >= zeroes + (size - i) + 1. */
+  /* Assumes sizeof(dst) >= zeroes + srclen * 138 / 100 + 2. */
   for (j = 0; j < zeroes; j++)
     dst[j] = '1';
 
-  while (i < size)
-    dst[j++] = base58_charset[b58[i++]];
+  if (length > 0) {
+    word = limbs[length - 1];
+    n = 0;
+
+    while (word != 0) {
+      tmp[n++] = word % 58;
+      word /= 58;
+    }
+
+    while (n--)
+      dst[j++] = base58_charset[tmp[n]];
+
+    for (i = length - 1; i-- > 0;) {
+      word = limbs[i];
+
+      for (k = 5; k-- > 0;) {
+        dst[j + k] = base58_charset[word % 58];
+        word /= 58;
+      }
+
+      j += 5;
+    }
+  }
 
   dst[j] = '\0';
 
   if (dstlen)
     *dstlen = j;
 
-  free(b58);
+  free(limbs);
 
   return 1;
 }
@@ -705,67 +1112,85 @@ base58_decode(uint8_t *dst, size_t *dstlen,
               const char *src, size_t srclen) {
   size_t zeroes = 0;
   size_t length = 0;
-  size_t i, j, k, size;
-  unsigned long carry;
-  uint8_t *b256;
-  uint8_t val;
+  size_t i, j, n, size;
+  uint32_t *limbs;
+  uint64_t carry;
+  uint32_t word;
+  int8_t val;
 
   if (srclen > 0xffffffff)
     return 0;
 
-  for (i = 0; i < srclen; i++) {
-    if (src[i] != '1')
-      break;
-
+  while (zeroes < srclen && src[zeroes] == '1')
     zeroes += 1;
-  }
 
-  size = (uint64_t)srclen * 733 / 1000 + 1;
-  b256 = malloc(size);
+  src += zeroes;
+  srclen -= zeroes;
+
+  /* log(58) / log(2^32) ~= 0.1831 */
+  size = (uint64_t)srclen * 184 / 1000 + 1;
+  limbs = malloc(size * sizeof(uint32_t));
 
-  if (b256 == NULL)
+  if (limbs == NULL)
     return 0;
 
-  memset(b256, 0, size);
+  for (i = 0; i < srclen; i += n) {
+    n = (i == 0 && srclen % 5 != 0) ? srclen % 5 : 5;
+    word = 0;
 
-  for (; i < srclen; i++) {
-    val = base58_table[(uint8_t)src[i]];
+    for (j = 0; j < n; j++) {
+      val = base58_table[(uint8_t)src[i + j]];
 
-    if (val & 0x80) {
-      free(b256);
-      return 0;
-    }
+      if (val < 0) {
+        free(limbs);
+        return 0;
+      }
 
-    carry = val;
+      word = word * 58 + val;
+    }
 
-    for (j = 0, k = size - 1; j < size; j++, k--) {
-      if (carry == 0 && j >= length)
-        break;
+    carry = word;
 
-      carry += (unsigned long)b256[k] * 58;
-      b256[k] = carry;
-      carry >>= 8;
+    for (j = 0; j < length; j++) {
+      carry += (uint64_t)limbs[j] * base58_pow[n];
+      limbs[j] = (uint32_t)carry;
+      carry >>= 32;
     }
 
-    ASSERT(carry == 0);
-
-    length = j;
+    if (carry != 0) {
+      ASSERT(length < size);
+      limbs[length++] = (uint32_t)carry;
+    }
   }
 
-  /* See: https://github.com/bitcoin/bitcoin/commit/2bcf1fc4 */
-  i = size - length;
-
-  /* Assumes sizeof(dst) >= zeroes + (size - i). */
+  /* Assumes sizeof(dst) >= zeroes + srclen. */
   for (j = 0; j < zeroes; j++)
     dst[j] = 0;
 
-  while (i < size)
-    dst[j++] = b256[i++];
+  if (length > 0) {
+    word = limbs[length - 1];
+    n = 0;
+
+    while (n < 4 && (word >> (n * 8)) != 0)
+      n += 1;
+
+    while (n--)
+      dst[j++] = word >> (n * 8);
+
+    for (i = length - 1; i-- > 0;) {
+      word = limbs[i];
+
+      dst[j++] = word >> 24;
+      dst[j++] = word >> 16;
+      dst[j++] = word >> 8;
+      dst[j++] = word;
+    }
+  }
 
   if (dstlen)
     *dstlen = j;
 
-  free(b256);
+  free(limbs);
 
   return 1;
 }
@@ -863,6 +1288,394 @@ static const int8_t base64url_table[256] = {
   -1, -1, -1, -1, -1, -1, -1, -1
 };
 
+#if defined(TORSION_HAVE_ASM_X64)
+/* Vectorized codecs for the standard alphabet,
+ * after Muła and Lemire[1][2]. Decoding validates
+ * with two nibble lookups in the same pass.
+ *
+ * [1] http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+ * [2] https://arxiv.org/abs/1704.00605
+ */
+static const unsigned char base64_simd_enc[7][16] = {
+  /* Gather three bytes into each dword. */
+  {0x01, 0x00, 0x02, 0x01, 0x04, 0x03, 0x05, 0x04,
+   0x07, 0x06, 0x08, 0x07, 0x0a, 0x09, 0x0b, 0x0a},
+  /* 0x0fc0fc00 */
+  {0x00, 0xfc, 0xc0, 0x0f, 0x00, 0xfc, 0xc0, 0x0f,
+   0x00, 0xfc, 0xc0, 0x0f, 0x00, 0xfc, 0xc0, 0x0f},
+  /* 0x04000040 */
+  {0x40, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x04,
+   0x40, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x04},
+  /* 0x003f03f0 */
+  {0xf0, 0x03, 0x3f, 0x00, 0xf0, 0x03, 0x3f, 0x00,
+   0xf0, 0x03, 0x3f, 0x00, 0xf0, 0x03, 0x3f, 0x00},
+  /* 0x01000010 */
+  {0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01,
+   0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01},
+  /* 51 (last lowercase letter). */
+  {0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+   0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33},
+  /* 25 (last uppercase letter). */
+  {0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+   0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19}
+};
+
+/* Offsets from a 6-bit value to its character. */
+static const unsigned char base64_simd_std[16] = {
+  0x41, 0x47, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xfc, 0xed, 0xf0, 0x00, 0x00
+};
+
+static const unsigned char base64_simd_url[16] = {
+  0x41, 0x47, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xfc, 0xef, 0x20, 0x00, 0x00
+};
+
+static const unsigned char base64_simd_dec[7][16] = {
+  /* Low nibble classes. */
+  {0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+   0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a},
+  /* High nibble classes. */
+  {0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+   0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+  /* Offsets from a character to its 6-bit value. */
+  {0x00, 0x10, 0x13, 0x04, 0xbf, 0xbf, 0xb9, 0xb9,
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+  /* '/' */
+  {0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+   0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f},
+  /* 0x01400140 */
+  {0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01,
+   0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01},
+  /* 0x00011000 */
+  {0x00, 0x10, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00,
+   0x00, 0x10, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00},
+  /* Pack three bytes from each dword. */
+  {0x02, 0x01, 0x00, 0x06, 0x05, 0x04, 0x0a, 0x09,
+   0x08, 0x0e, 0x0d, 0x0c, 0x80, 0x80, 0x80, 0x80}
+};
+
+static const uint32_t base64_simd_perm[8] = {
+  0, 1, 2, 4, 5, 6, 3, 7
+};
+
+static void
+base64_encode_ssse3(char *dst,
+                    const uint8_t *src,
+                    size_t blocks,
+                    const unsigned char *lut) {
+  /* 12 bytes in (16 read), 16 characters out.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *   %[k] = constants
+   *   %[t] = character offsets
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-3], %xmm[8-15]
+   */
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "movdqu (%[k]), %%xmm8\n"
+    "movdqu 16(%[k]), %%xmm9\n"
+    "movdqu 32(%[k]), %%xmm10\n"
+    "movdqu 48(%[k]), %%xmm11\n"
+    "movdqu 64(%[k]), %%xmm12\n"
+    "movdqu 80(%[k]), %%xmm14\n"
+    "movdqu 96(%[k]), %%xmm13\n"
+    "movdqu (%[t]), %%xmm15\n"
+    "1:\n"
+    "movdqu (%[s]), %%xmm0\n"
+    "pshufb %%xmm8, %%xmm0\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "pand %%xmm9, %%xmm0\n"
+    "pmulhuw %%xmm10, %%xmm0\n"
+    "pand %%xmm11, %%xmm1\n"
+    "pmullw %%xmm12, %%xmm1\n"
+    "por %%xmm1, %%xmm0\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "psubusb %%xmm14, %%xmm1\n"
+    "movdqa %%xmm0, %%xmm2\n"
+    "pcmpgtb %%xmm13, %%xmm2\n"
+    "psubb %%xmm2, %%xmm1\n"
+    "movdqa %%xmm15, %%xmm3\n"
+    "pshufb %%xmm1, %%xmm3\n"
+    "paddb %%xmm3, %%xmm0\n"
+    "movdqu %%xmm0, (%[d])\n"
+    "addq $12, %[s]\n"
+    "addq $16, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks)
+    : [k] "r" (base64_simd_enc[0]), [t] "r" (lut)
+    : "xmm0", "xmm1", "xmm2", "xmm3",
+      "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15",
+      "cc", "memory"
+  );
+}
+
+static void
+base64_encode_avx2(char *dst,
+                   const uint8_t *src,
+                   size_t blocks,
+                   const unsigned char *lut) {
+  /* 24 bytes in (28 read), 32 characters out. Each
+   * 128-bit lane takes 12 bytes, the upper lane's
+   * bytes being loaded from an offset of 12.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *   %[k] = constants
+   *   %[t] = character offsets
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-3], %ymm[8-15]
+   */
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "vbroadcasti128 (%[k]), %%ymm8\n"
+    "vbroadcasti128 16(%[k]), %%ymm9\n"
+    "vbroadcasti128 32(%[k]), %%ymm10\n"
+    "vbroadcasti128 48(%[k]), %%ymm11\n"
+    "vbroadcasti128 64(%[k]), %%ymm12\n"
+    "vbroadcasti128 80(%[k]), %%ymm14\n"
+    "vbroadcasti128 96(%[k]), %%ymm13\n"
+    "vbroadcasti128 (%[t]), %%ymm15\n"
+    "1:\n"
+    "vmovdqu (%[s]), %%xmm0\n"
+    "vinserti128 $1, 12(%[s]), %%ymm0, %%ymm0\n"
+    "vpshufb %%ymm8, %%ymm0, %%ymm0\n"
+    "vpand %%ymm9, %%ymm0, %%ymm1\n"
+    "vpmulhuw %%ymm10, %%ymm1, %%ymm1\n"
+    "vpand %%ymm11, %%ymm0, %%ymm0\n"
+    "vpmullw %%ymm12, %%ymm0, %%ymm0\n"
+    "vpor %%ymm1, %%ymm0, %%ymm0\n"
+    "vpsubusb %%ymm14, %%ymm0, %%ymm1\n"
+    "vpcmpgtb %%ymm13, %%ymm0, %%ymm2\n"
+    "vpsubb %%ymm2, %%ymm1, %%ymm1\n"
+    "vpshufb %%ymm1, %%ymm15, %%ymm3\n"
+    "vpaddb %%ymm3, %%ymm0, %%ymm0\n"
+    "vmovdqu %%ymm0, (%[d])\n"
+    "addq $24, %[s]\n"
+    "addq $32, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "vzeroupper\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks)
+    : [k] "r" (base64_simd_enc[0]), [t] "r" (lut)
+    : "xmm0", "xmm1", "xmm2", "xmm3",
+      "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15",
+      "cc", "memory"
+  );
+}
+
+static int
+base64_decode_ssse3(uint8_t *dst, const char *src, size_t blocks) {
+  /* 16 characters in, 12 bytes out. A character
+   * is valid when the classes of its two nibbles
+   * do not intersect.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *   %[k] = constants
+   *   %[r] = validity mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-4], %xmm[8-15]
+   */
+  uint32_t mask;
+
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "movdqu (%[k]), %%xmm8\n"
+    "movdqu 16(%[k]), %%xmm9\n"
+    "movdqu 32(%[k]), %%xmm10\n"
+    "movdqu 48(%[k]), %%xmm11\n"
+    "movdqu 64(%[k]), %%xmm12\n"
+    "movdqu 80(%[k]), %%xmm13\n"
+    "movdqu 96(%[k]), %%xmm14\n"
+    "pxor %%xmm15, %%xmm15\n"
+    "1:\n"
+    "movdqu (%[s]), %%xmm0\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "psrld $4, %%xmm1\n"
+    "pand %%xmm11, %%xmm1\n"
+    "movdqa %%xmm0, %%xmm2\n"
+    "pand %%xmm11, %%xmm2\n"
+    "movdqa %%xmm8, %%xmm3\n"
+    "pshufb %%xmm2, %%xmm3\n"
+    "movdqa %%xmm9, %%xmm4\n"
+    "pshufb %%xmm1, %%xmm4\n"
+    "pand %%xmm3, %%xmm4\n"
+    "por %%xmm4, %%xmm15\n"
+    "movdqa %%xmm0, %%xmm2\n"
+    "pcmpeqb %%xmm11, %%xmm2\n"
+    "paddb %%xmm2, %%xmm1\n"
+    "movdqa %%xmm10, %%xmm3\n"
+    "pshufb %%xmm1, %%xmm3\n"
+    "paddb %%xmm3, %%xmm0\n"
+    "pmaddubsw %%xmm12, %%xmm0\n"
+    "pmaddwd %%xmm13, %%xmm0\n"
+    "pshufb %%xmm14, %%xmm0\n"
+    "movq %%xmm0, (%[d])\n"
+    "psrldq $8, %%xmm0\n"
+    "movd %%xmm0, 8(%[d])\n"
+    "addq $16, %[s]\n"
+    "addq $12, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "pxor %%xmm0, %%xmm0\n"
+    "pcmpeqb %%xmm0, %%xmm15\n"
+    "pmovmskb %%xmm15, %[r]\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks), [r] "=r" (mask)
+    : [k] "r" (base64_simd_dec[0])
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+      "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15",
+      "cc", "memory"
+  );
+
+  return mask == 0xffff;
+}
+
+static int
+base64_decode_avx2(uint8_t *dst, const char *src, size_t blocks) {
+  /* 32 characters in, 24 bytes out. Each lane
+   * packs 12 bytes; vpermd joins them.
+   *
+   * Registers:
+   *
+   *   %[d] = output pointer
+   *   %[s] = input pointer
+   *   %[n] = block counter
+   *   %[k] = constants
+   *   %[p] = lane permutation
+   *   %[r] = validity mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-4], %ymm[7-15]
+   */
+  uint32_t mask;
+
+  ASSERT(blocks > 0);
+
+  __asm__ __volatile__(
+    "vbroadcasti128 (%[k]), %%ymm8\n"
+    "vbroadcasti128 16(%[k]), %%ymm9\n"
+    "vbroadcasti128 32(%[k]), %%ymm10\n"
+    "vbroadcasti128 48(%[k]), %%ymm11\n"
+    "vbroadcasti128 64(%[k]), %%ymm12\n"
+    "vbroadcasti128 80(%[k]), %%ymm13\n"
+    "vbroadcasti128 96(%[k]), %%ymm14\n"
+    "vmovdqu (%[p]), %%ymm7\n"
+    "vpxor %%ymm15, %%ymm15, %%ymm15\n"
+    "1:\n"
+    "vmovdqu (%[s]), %%ymm0\n"
+    "vpsrld $4, %%ymm0, %%ymm1\n"
+    "vpand %%ymm11, %%ymm1, %%ymm1\n"
+    "vpand %%ymm11, %%ymm0, %%ymm2\n"
+    "vpshufb %%ymm2, %%ymm8, %%ymm3\n"
+    "vpshufb %%ymm1, %%ymm9, %%ymm4\n"
+    "vpand %%ymm3, %%ymm4, %%ymm4\n"
+    "vpor %%ymm4, %%ymm15, %%ymm15\n"
+    "vpcmpeqb %%ymm11, %%ymm0, %%ymm2\n"
+    "vpaddb %%ymm2, %%ymm1, %%ymm1\n"
+    "vpshufb %%ymm1, %%ymm10, %%ymm3\n"
+    "vpaddb %%ymm3, %%ymm0, %%ymm0\n"
+    "vpmaddubsw %%ymm12, %%ymm0, %%ymm0\n"
+    "vpmaddwd %%ymm13, %%ymm0, %%ymm0\n"
+    "vpshufb %%ymm14, %%ymm0, %%ymm0\n"
+    "vpermd %%ymm0, %%ymm7, %%ymm0\n"
+    "vmovdqu %%xmm0, (%[d])\n"
+    "vextracti128 $1, %%ymm0, %%xmm1\n"
+    "vmovq %%xmm1, 16(%[d])\n"
+    "addq $32, %[s]\n"
+    "addq $24, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "vpxor %%ymm0, %%ymm0, %%ymm0\n"
+    "vpcmpeqb %%ymm0, %%ymm15, %%ymm15\n"
+    "vpmovmskb %%ymm15, %[r]\n"
+    "vzeroupper\n"
+    : [d] "+r" (dst), [s] "+r" (src), [n] "+r" (blocks), [r] "=r" (mask)
+    : [k] "r" (base64_simd_dec[0]), [p] "r" (base64_simd_perm)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+      "xmm7", "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15",
+      "cc", "memory"
+  );
+
+  return mask == 0xffffffff;
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
+static size_t
+base64_encode_fast(char *dst, const uint8_t *src, size_t len,
+                   const char *charset) {
+  /* Returns the number of bytes consumed. The
+     kernels read 4 bytes past each block. */
+  size_t n = 0;
+#if defined(TORSION_HAVE_ASM_X64)
+  const unsigned char *lut = charset == base64url_charset
+                           ? base64_simd_url
+                           : base64_simd_std;
+
+  if (len >= 52 && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    n = ((len - 4) / 24) * 24;
+    base64_encode_avx2(dst, src, n / 24, lut);
+  } else if (len >= 28 && torsion_cpu_has(TORSION_CPU_SSSE3)) {
+    n = ((len - 4) / 12) * 12;
+    base64_encode_ssse3(dst, src, n / 12, lut);
+  }
+#else
+  (void)dst;
+  (void)src;
+  (void)len;
+  (void)charset;
+#endif
+  return n;
+}
+
+static size_t
+base64_decode_fast(uint8_t *dst, const char *src, size_t len, int *ok) {
+  /* Returns the number of characters consumed
+     (standard alphabet only, padding removed). */
+  size_t n = 0;
+#if defined(TORSION_HAVE_ASM_X64)
+  if (len >= 64 && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    n = len & ~(size_t)31;
+    *ok = base64_decode_avx2(dst, src, n / 32);
+  } else if (len >= 32 && torsion_cpu_has(TORSION_CPU_SSSE3)) {
+    n = len & ~(size_t)15;
+    *ok = base64_decode_ssse3(dst, src, n / 16);
+  }
+#else
+  (void)dst;
+  (void)src;
+  (void)len;
+  (void)ok;
+#endif
+  return n;
+}
+
 static size_t
 base64_encode_size0(size_t len, int pad) {
   size_t size = (len / 3) * 4;
@@ -887,9 +1700,9 @@ static void
 base64_encode0(char *dst, size_t *dstlen,
                const uint8_t *src, size_t srclen,
                const char *charset, int pad) {
-  size_t left = srclen;
-  size_t i = 0;
-  size_t j = 0;
+  size_t i = base64_encode_fast(dst, src, srclen, charset);
+  size_t j = (i / 3) * 4;
+  size_t left = srclen - i;
 
   while (left >= 3) {
     uint8_t c1 = src[i++];
@@ -976,6 +1789,17 @@ base64_decode0(uint8_t *dst, size_t *dstlen,
   if ((left & 3) == 1) /* Fail early. */
     return 0;
 
+  if (table == base64_table) {
+    int ok = 1;
+
+    i = base64_decode_fast(dst, src, left, &ok);
+    j = (i / 4) * 3;
+    left -= i;
+
+    if (!ok)
+      return 0;
+  }
+
   while (left >= 4) {
     uint8_t t1 = table[(uint8_t)src[i++]];
     uint8_t t2 = table[(uint8_t)src[i++]];
@@ -1038,7 +1862,9 @@ base64_decode0(uint8_t *dst, size_t *dstlen,
 
 static int
 base64_test0(const char *str, size_t len, const int8_t *table) {
-  size_t i;
+  uint8_t tmp[192];
+  size_t i, n;
+  int ok = 1;
 
   if (len > 0 && str[len - 1] == '=')
     len -= 1;
@@ -1049,6 +1875,20 @@ base64_test0(const char *str, size_t len, const int8_t *table) {
   if ((len & 3) == 1) /* Fail early. */
     return 0;
 
+  /* Validate in bulk, discarding the output. */
+  while (table == base64_table && len >= 32) {
+    n = base64_decode_fast(tmp, str, len < 256 ? len : 256, &ok);
+
+    if (n == 0)
+      break;
+
+    if (!ok)
+      return 0;
+
+    str += n;
+    len -= n;
+  }
+
   for (i = 0; i < len; i++) {
     if (table[(uint8_t)str[i]] == -1)
       return 0;
@@ -21,12 +21,28 @@
 #define torsion_cpuid __torsion_cpuid
 #define torsion_has_rdrand __torsion_has_rdrand
 #define torsion_has_rdseed __torsion_has_rdseed
+#define torsion_has_ssse3 __torsion_has_ssse3
+#define torsion_has_avx2 __torsion_has_avx2
+#define torsion_has_shani __torsion_has_shani
+#define torsion_cpu_features __torsion_cpu_features
+#define torsion_cpu_has __torsion_cpu_has
 #define torsion_rdrand __torsion_rdrand
 #define torsion_rdseed __torsion_rdseed
 #define torsion_hwrand __torsion_hwrand
 #define torsion_getpid __torsion_getpid
 #define torsion_sysrand __torsion_sysrand
 
+/*
+ * CPU Features
+ */
+
+#define TORSION_CPU_SSSE3 (1 << 0)
+#define TORSION_CPU_AVX2 (1 << 1)
+#define TORSION_CPU_SHANI (1 << 2)
+#define TORSION_CPU_AES (1 << 3)
+#define TORSION_CPU_PCLMUL (1 << 4)
+#define TORSION_CPU_DETECTED (1 << 30)
+
 /*
  * Entropy
  */
@@ -57,6 +73,21 @@ torsion_has_rdrand(void);
 int
 torsion_has_rdseed(void);
 
+int
+torsion_has_ssse3(void);
+
+int
+torsion_has_avx2(void);
+
+int
+torsion_has_shani(void);
+
+int
+torsion_cpu_features(void);
+
+int
+torsion_cpu_has(int mask);
+
 uint64_t
 torsion_rdrand(void);
 
@@ -105,6 +105,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <torsion/util.h>
+#include "../internal.h"
 #include "entropy.h"
 
 #undef HAVE_QPC
@@ -450,6 +452,211 @@ torsion_has_rdseed(void) {
 #endif
 }
 
+/*
+ * SSSE3
+ */
+
+int
+torsion_has_ssse3(void) {
+#if defined(HAVE_CPUIDEX) || defined(HAVE_CPUID)
+  uint32_t eax, ebx, ecx, edx;
+
+  if (!torsion_has_cpuid())
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 1)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 1, 0);
+
+  /* SSSE3 (bit 9). */
+  return (ecx >> 9) & 1;
+#else
+  return 0;
+#endif
+}
+
+/*
+ * AVX2
+ */
+
+int
+torsion_has_avx2(void) {
+#if defined(HAVE_CPUIDEX) || defined(HAVE_CPUID)
+  uint32_t eax, ebx, ecx, edx;
+  uint64_t xcr0;
+
+  if (!torsion_has_cpuid())
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 7)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 1, 0);
+
+  /* OSXSAVE (bit 27) and AVX (bit 28). */
+  if (((ecx >> 27) & 1) == 0 || ((ecx >> 28) & 1) == 0)
+    return 0;
+
+  /* The OS must save the XMM and YMM registers. */
+#if defined(HAVE_CPUIDEX)
+  xcr0 = _xgetbv(0);
+#else
+  __asm__ __volatile__(
+    ".byte 0x0f, 0x01, 0xd0\n" /* xgetbv */
+    : "=a" (eax), "=d" (edx)
+    : "c" (0)
+  );
+
+  xcr0 = ((uint64_t)edx << 32) | eax;
+#endif
+
+  if ((xcr0 & 6) != 6)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 7, 0);
+
+  return (ebx >> 5) & 1;
+#else
+  return 0;
+#endif
+}
+
+/*
+ * SHA-NI
+ */
+
+int
+torsion_has_shani(void) {
+#if defined(HAVE_CPUIDEX) || defined(HAVE_CPUID)
+  uint32_t eax, ebx, ecx, edx;
+
+  if (!torsion_has_cpuid())
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 7)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 1, 0);
+
+  /* SSSE3 (bit 9) and SSE4.1 (bit 19). */
+  if (((ecx >> 9) & 1) == 0 || ((ecx >> 19) & 1) == 0)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 7, 0);
+
+  /* SHA (bit 29). */
+  return (ebx >> 29) & 1;
+#else
+  return 0;
+#endif
+}
+
+/*
+ * CPU Features
+ */
+
+static int
+torsion_cpu_disabled(void) {
+  /* Testing aid: TORSION_CPU_DISABLE=avx2,shani (for example)
+     masks features out so that the paths they would otherwise
+     preempt can be exercised on a fully featured host. Only
+     features whose fallbacks are also constant-time may be
+     listed here. SSSE3, AES-NI and PCLMULQDQ stand in for
+     table lookups in AES and GHASH and cannot be masked. */
+  static const struct {
+    const char *name;
+    int flag;
+  } names[] = {
+    { "avx2", TORSION_CPU_AVX2 },
+    { "shani", TORSION_CPU_SHANI }
+  };
+  const char *env = getenv("TORSION_CPU_DISABLE");
+  int flags = 0;
+  size_t i, len;
+
+  if (env == NULL)
+    return 0;
+
+  while (*env != '\0') {
+    len = strcspn(env, ",");
+
+    for (i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+      if (strlen(names[i].name) == len
+          && memcmp(env, names[i].name, len) == 0) {
+        flags |= names[i].flag;
+      }
+    }
+
+    env += len;
+
+    if (*env == ',')
+      env++;
+  }
+
+  return flags;
+}
+
+static int
+torsion_cpu_detect(void) {
+  int flags = TORSION_CPU_DETECTED;
+#if defined(HAVE_CPUIDEX) || defined(HAVE_CPUID)
+  uint32_t eax, ebx, ecx, edx;
+
+  if (torsion_has_cpuid()) {
+    torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+    if (eax >= 1) {
+      torsion_cpuid(&eax, &ebx, &ecx, &edx, 1, 0);
+
+      /* PCLMULQDQ (bit 1) and AES-NI (bit 25). */
+      if ((ecx >> 1) & 1)
+        flags |= TORSION_CPU_PCLMUL;
+
+      if ((ecx >> 25) & 1)
+        flags |= TORSION_CPU_AES;
+    }
+  }
+#endif
+
+  if (torsion_has_ssse3())
+    flags |= TORSION_CPU_SSSE3;
+
+  if (torsion_has_avx2())
+    flags |= TORSION_CPU_AVX2;
+
+  if (torsion_has_shani())
+    flags |= TORSION_CPU_SHANI;
+
+  return flags & ~torsion_cpu_disabled();
+}
+
+int
+torsion_cpu_features(void) {
+  /* Detected on first use. Racing threads may both
+     run the detection, but they store the same value. */
+  static volatile int features = 0;
+  int flags = torsion_atomic_load(&features);
+
+  if (flags == 0) {
+    flags = torsion_cpu_detect();
+    torsion_atomic_store(&features, flags);
+  }
+
+  return flags;
+}
+
+int
+torsion_cpu_has(int mask) {
+  return (torsion_cpu_features() & mask) == mask;
+}
+
 uint64_t
 torsion_rdrand(void) {
 #if defined(HAVE_CPUIDEX)
@@ -19,6 +19,7 @@
 #include <torsion/util.h>
 #include "bio.h"
 #include "internal.h"
+#include "entropy/entropy.h"
 
 /*
  * Macros
@@ -3820,6 +3821,643 @@ sha256_transform(sha256_t *ctx, const unsigned char *chunk) {
 #endif
 }
 
+#if defined(TORSION_HAVE_ASM_X64)
+static const unsigned char sha256_bswap[16] = {
+  0x03, 0x02, 0x01, 0x00, 0x07, 0x06, 0x05, 0x04,
+  0x0b, 0x0a, 0x09, 0x08, 0x0f, 0x0e, 0x0d, 0x0c
+};
+
+static void
+sha256_transform_ni(uint32_t *state, const unsigned char *blocks, size_t len) {
+  /* Intel SHA extensions[1]. The state is kept in the
+   * ABEF/CDGH order expected by sha256rnds2.
+   *
+   * Registers:
+   *
+   *   %[s] = state pointer
+   *   %[x] = input pointer
+   *   %[n] = block counter
+   *   %[k] = round constants
+   *   %[m] = byte swap mask
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-11]
+   *
+   * [1] https://www.intel.com/content/dam/develop/external/us/en/documents/intel-sha-extensions-white-paper-402097.pdf
+   */
+  uint64_t n = len;
+
+  ASSERT(len > 0);
+
+  __asm__ __volatile__(
+    "movdqu (%[m]), %%xmm8\n"
+    "movdqu (%[s]), %%xmm1\n"
+    "movdqu 16(%[s]), %%xmm2\n"
+    "pshufd $0xb1, %%xmm1, %%xmm1\n"
+    "pshufd $0x1b, %%xmm2, %%xmm2\n"
+    "movdqa %%xmm1, %%xmm7\n"
+    "palignr $8, %%xmm2, %%xmm1\n"
+    "pblendw $0xf0, %%xmm7, %%xmm2\n"
+    "1:\n"
+    "movdqa %%xmm1, %%xmm9\n"
+    "movdqa %%xmm2, %%xmm10\n"
+    "movdqu 0(%[x]), %%xmm0\n"
+    "pshufb %%xmm8, %%xmm0\n"
+    "movdqa %%xmm0, %%xmm3\n"
+    "movdqu 0(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "movdqu 16(%[x]), %%xmm0\n"
+    "pshufb %%xmm8, %%xmm0\n"
+    "movdqa %%xmm0, %%xmm4\n"
+    "movdqu 16(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm4, %%xmm3\n"
+    "movdqu 32(%[x]), %%xmm0\n"
+    "pshufb %%xmm8, %%xmm0\n"
+    "movdqa %%xmm0, %%xmm5\n"
+    "movdqu 32(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm5, %%xmm4\n"
+    "movdqu 48(%[x]), %%xmm0\n"
+    "pshufb %%xmm8, %%xmm0\n"
+    "movdqa %%xmm0, %%xmm6\n"
+    "movdqu 48(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm6, %%xmm7\n"
+    "palignr $4, %%xmm5, %%xmm7\n"
+    "paddd %%xmm7, %%xmm3\n"
+    "sha256msg2 %%xmm6, %%xmm3\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm6, %%xmm5\n"
+    "movdqa %%xmm3, %%xmm0\n"
+    "movdqu 64(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm3, %%xmm7\n"
+    "palignr $4, %%xmm6, %%xmm7\n"
+    "paddd %%xmm7, %%xmm4\n"
+    "sha256msg2 %%xmm3, %%xmm4\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm3, %%xmm6\n"
+    "movdqa %%xmm4, %%xmm0\n"
+    "movdqu 80(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm4, %%xmm7\n"
+    "palignr $4, %%xmm3, %%xmm7\n"
+    "paddd %%xmm7, %%xmm5\n"
+    "sha256msg2 %%xmm4, %%xmm5\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm4, %%xmm3\n"
+    "movdqa %%xmm5, %%xmm0\n"
+    "movdqu 96(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm5, %%xmm7\n"
+    "palignr $4, %%xmm4, %%xmm7\n"
+    "paddd %%xmm7, %%xmm6\n"
+    "sha256msg2 %%xmm5, %%xmm6\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm5, %%xmm4\n"
+    "movdqa %%xmm6, %%xmm0\n"
+    "movdqu 112(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm6, %%xmm7\n"
+    "palignr $4, %%xmm5, %%xmm7\n"
+    "paddd %%xmm7, %%xmm3\n"
+    "sha256msg2 %%xmm6, %%xmm3\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm6, %%xmm5\n"
+    "movdqa %%xmm3, %%xmm0\n"
+    "movdqu 128(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm3, %%xmm7\n"
+    "palignr $4, %%xmm6, %%xmm7\n"
+    "paddd %%xmm7, %%xmm4\n"
+    "sha256msg2 %%xmm3, %%xmm4\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm3, %%xmm6\n"
+    "movdqa %%xmm4, %%xmm0\n"
+    "movdqu 144(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm4, %%xmm7\n"
+    "palignr $4, %%xmm3, %%xmm7\n"
+    "paddd %%xmm7, %%xmm5\n"
+    "sha256msg2 %%xmm4, %%xmm5\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm4, %%xmm3\n"
+    "movdqa %%xmm5, %%xmm0\n"
+    "movdqu 160(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm5, %%xmm7\n"
+    "palignr $4, %%xmm4, %%xmm7\n"
+    "paddd %%xmm7, %%xmm6\n"
+    "sha256msg2 %%xmm5, %%xmm6\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm5, %%xmm4\n"
+    "movdqa %%xmm6, %%xmm0\n"
+    "movdqu 176(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm6, %%xmm7\n"
+    "palignr $4, %%xmm5, %%xmm7\n"
+    "paddd %%xmm7, %%xmm3\n"
+    "sha256msg2 %%xmm6, %%xmm3\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm6, %%xmm5\n"
+    "movdqa %%xmm3, %%xmm0\n"
+    "movdqu 192(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm3, %%xmm7\n"
+    "palignr $4, %%xmm6, %%xmm7\n"
+    "paddd %%xmm7, %%xmm4\n"
+    "sha256msg2 %%xmm3, %%xmm4\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "sha256msg1 %%xmm3, %%xmm6\n"
+    "movdqa %%xmm4, %%xmm0\n"
+    "movdqu 208(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm4, %%xmm7\n"
+    "palignr $4, %%xmm3, %%xmm7\n"
+    "paddd %%xmm7, %%xmm5\n"
+    "sha256msg2 %%xmm4, %%xmm5\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "movdqa %%xmm5, %%xmm0\n"
+    "movdqu 224(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "movdqa %%xmm5, %%xmm7\n"
+    "palignr $4, %%xmm4, %%xmm7\n"
+    "paddd %%xmm7, %%xmm6\n"
+    "sha256msg2 %%xmm5, %%xmm6\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "movdqa %%xmm6, %%xmm0\n"
+    "movdqu 240(%[k]), %%xmm11\n"
+    "paddd %%xmm11, %%xmm0\n"
+    "sha256rnds2 %%xmm1, %%xmm2\n"
+    "pshufd $0x0e, %%xmm0, %%xmm0\n"
+    "sha256rnds2 %%xmm2, %%xmm1\n"
+    "paddd %%xmm9, %%xmm1\n"
+    "paddd %%xmm10, %%xmm2\n"
+    "addq $64, %[x]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "pshufd $0x1b, %%xmm1, %%xmm1\n"
+    "pshufd $0xb1, %%xmm2, %%xmm2\n"
+    "movdqa %%xmm1, %%xmm7\n"
+    "pblendw $0xf0, %%xmm2, %%xmm1\n"
+    "palignr $8, %%xmm7, %%xmm2\n"
+    "movdqu %%xmm1, (%[s])\n"
+    "movdqu %%xmm2, 16(%[s])\n"
+    : [x] "+r" (blocks), [n] "+r" (n)
+    : [s] "r" (state), [k] "r" (sha256_K), [m] "r" (sha256_bswap)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11",
+      "cc", "memory"
+  );
+}
+
+static void
+sha256_transform_x8(uint32_t *state, const unsigned char **blocks) {
+  /* Eight independent blocks with AVX2. The state is
+   * transposed (word i of lane j is at state[i * 8 + j])
+   * and the message schedule is expanded in memory.
+   *
+   * Registers:
+   *
+   *   %[s] = state pointer
+   *   %[w] = schedule pointer (rounds)
+   *   %[p] = schedule pointer (expansion)
+   *   %[k] = round constants
+   *   %[n] = loop counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-11]
+   */
+  uint32_t w[64 * 8];
+  uint32_t *p = w + 16 * 8;
+  uint32_t *q = w;
+  const uint32_t *k = sha256_K;
+  uint32_t n;
+  int i, j;
+
+  for (i = 0; i < 16; i++) {
+    for (j = 0; j < 8; j++)
+      w[i * 8 + j] = read32be(blocks[j] + i * 4);
+  }
+
+  __asm__ __volatile__(
+    "movl $48, %k[n]\n"
+    "1:\n"
+    "vmovdqu -64(%[p]), %%ymm8\n"
+    "vpsrld $17, %%ymm8, %%ymm9\n"
+    "vpslld $15, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm9, %%ymm9\n"
+    "vpsrld $19, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm9, %%ymm9\n"
+    "vpslld $13, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm9, %%ymm9\n"
+    "vpsrld $10, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm9, %%ymm9\n"
+    "vmovdqu -480(%[p]), %%ymm8\n"
+    "vpsrld $7, %%ymm8, %%ymm11\n"
+    "vpslld $25, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm11, %%ymm11\n"
+    "vpsrld $18, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm11, %%ymm11\n"
+    "vpslld $14, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm11, %%ymm11\n"
+    "vpsrld $3, %%ymm8, %%ymm10\n"
+    "vpxor %%ymm10, %%ymm11, %%ymm11\n"
+    "vpaddd %%ymm11, %%ymm9, %%ymm9\n"
+    "vpaddd -224(%[p]), %%ymm9, %%ymm9\n"
+    "vpaddd -512(%[p]), %%ymm9, %%ymm9\n"
+    "vmovdqu %%ymm9, (%[p])\n"
+    "addq $32, %[p]\n"
+    "decl %k[n]\n"
+    "jnz 1b\n"
+    "vmovdqu 0(%[s]), %%ymm0\n"
+    "vmovdqu 32(%[s]), %%ymm1\n"
+    "vmovdqu 64(%[s]), %%ymm2\n"
+    "vmovdqu 96(%[s]), %%ymm3\n"
+    "vmovdqu 128(%[s]), %%ymm4\n"
+    "vmovdqu 160(%[s]), %%ymm5\n"
+    "vmovdqu 192(%[s]), %%ymm6\n"
+    "vmovdqu 224(%[s]), %%ymm7\n"
+    "movl $8, %k[n]\n"
+    "2:\n"
+    "vpbroadcastd 0(%[k]), %%ymm8\n"
+    "vpaddd 0(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm7, %%ymm7\n"
+    "vpsrld $6, %%ymm4, %%ymm8\n"
+    "vpslld $26, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm7, %%ymm7\n"
+    "vpand %%ymm5, %%ymm4, %%ymm8\n"
+    "vpandn %%ymm6, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm7, %%ymm7\n"
+    "vpaddd %%ymm7, %%ymm3, %%ymm3\n"
+    "vpsrld $2, %%ymm0, %%ymm8\n"
+    "vpslld $30, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm7, %%ymm7\n"
+    "vpxor %%ymm1, %%ymm0, %%ymm8\n"
+    "vpand %%ymm2, %%ymm8, %%ymm8\n"
+    "vpand %%ymm1, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm7, %%ymm7\n"
+    "vpbroadcastd 4(%[k]), %%ymm8\n"
+    "vpaddd 32(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm6, %%ymm6\n"
+    "vpsrld $6, %%ymm3, %%ymm8\n"
+    "vpslld $26, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm6, %%ymm6\n"
+    "vpand %%ymm4, %%ymm3, %%ymm8\n"
+    "vpandn %%ymm5, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm6, %%ymm6\n"
+    "vpaddd %%ymm6, %%ymm2, %%ymm2\n"
+    "vpsrld $2, %%ymm7, %%ymm8\n"
+    "vpslld $30, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm6, %%ymm6\n"
+    "vpxor %%ymm0, %%ymm7, %%ymm8\n"
+    "vpand %%ymm1, %%ymm8, %%ymm8\n"
+    "vpand %%ymm0, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm6, %%ymm6\n"
+    "vpbroadcastd 8(%[k]), %%ymm8\n"
+    "vpaddd 64(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm5, %%ymm5\n"
+    "vpsrld $6, %%ymm2, %%ymm8\n"
+    "vpslld $26, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm5, %%ymm5\n"
+    "vpand %%ymm3, %%ymm2, %%ymm8\n"
+    "vpandn %%ymm4, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm5, %%ymm5\n"
+    "vpaddd %%ymm5, %%ymm1, %%ymm1\n"
+    "vpsrld $2, %%ymm6, %%ymm8\n"
+    "vpslld $30, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm5, %%ymm5\n"
+    "vpxor %%ymm7, %%ymm6, %%ymm8\n"
+    "vpand %%ymm0, %%ymm8, %%ymm8\n"
+    "vpand %%ymm7, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm5, %%ymm5\n"
+    "vpbroadcastd 12(%[k]), %%ymm8\n"
+    "vpaddd 96(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm4, %%ymm4\n"
+    "vpsrld $6, %%ymm1, %%ymm8\n"
+    "vpslld $26, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm4, %%ymm4\n"
+    "vpand %%ymm2, %%ymm1, %%ymm8\n"
+    "vpandn %%ymm3, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm4, %%ymm4\n"
+    "vpaddd %%ymm4, %%ymm0, %%ymm0\n"
+    "vpsrld $2, %%ymm5, %%ymm8\n"
+    "vpslld $30, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm4, %%ymm4\n"
+    "vpxor %%ymm6, %%ymm5, %%ymm8\n"
+    "vpand %%ymm7, %%ymm8, %%ymm8\n"
+    "vpand %%ymm6, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm4, %%ymm4\n"
+    "vpbroadcastd 16(%[k]), %%ymm8\n"
+    "vpaddd 128(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm3, %%ymm3\n"
+    "vpsrld $6, %%ymm0, %%ymm8\n"
+    "vpslld $26, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm3, %%ymm3\n"
+    "vpand %%ymm1, %%ymm0, %%ymm8\n"
+    "vpandn %%ymm2, %%ymm0, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm3, %%ymm3\n"
+    "vpaddd %%ymm3, %%ymm7, %%ymm7\n"
+    "vpsrld $2, %%ymm4, %%ymm8\n"
+    "vpslld $30, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm3, %%ymm3\n"
+    "vpxor %%ymm5, %%ymm4, %%ymm8\n"
+    "vpand %%ymm6, %%ymm8, %%ymm8\n"
+    "vpand %%ymm5, %%ymm4, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm3, %%ymm3\n"
+    "vpbroadcastd 20(%[k]), %%ymm8\n"
+    "vpaddd 160(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm2, %%ymm2\n"
+    "vpsrld $6, %%ymm7, %%ymm8\n"
+    "vpslld $26, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm2, %%ymm2\n"
+    "vpand %%ymm0, %%ymm7, %%ymm8\n"
+    "vpandn %%ymm1, %%ymm7, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm2, %%ymm2\n"
+    "vpaddd %%ymm2, %%ymm6, %%ymm6\n"
+    "vpsrld $2, %%ymm3, %%ymm8\n"
+    "vpslld $30, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm2, %%ymm2\n"
+    "vpxor %%ymm4, %%ymm3, %%ymm8\n"
+    "vpand %%ymm5, %%ymm8, %%ymm8\n"
+    "vpand %%ymm4, %%ymm3, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm2, %%ymm2\n"
+    "vpbroadcastd 24(%[k]), %%ymm8\n"
+    "vpaddd 192(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm1, %%ymm1\n"
+    "vpsrld $6, %%ymm6, %%ymm8\n"
+    "vpslld $26, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm1, %%ymm1\n"
+    "vpand %%ymm7, %%ymm6, %%ymm8\n"
+    "vpandn %%ymm0, %%ymm6, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm1, %%ymm1\n"
+    "vpaddd %%ymm1, %%ymm5, %%ymm5\n"
+    "vpsrld $2, %%ymm2, %%ymm8\n"
+    "vpslld $30, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm1, %%ymm1\n"
+    "vpxor %%ymm3, %%ymm2, %%ymm8\n"
+    "vpand %%ymm4, %%ymm8, %%ymm8\n"
+    "vpand %%ymm3, %%ymm2, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm1, %%ymm1\n"
+    "vpbroadcastd 28(%[k]), %%ymm8\n"
+    "vpaddd 224(%[w]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm0, %%ymm0\n"
+    "vpsrld $6, %%ymm5, %%ymm8\n"
+    "vpslld $26, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $11, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $21, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $25, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $7, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm0, %%ymm0\n"
+    "vpand %%ymm6, %%ymm5, %%ymm8\n"
+    "vpandn %%ymm7, %%ymm5, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm0, %%ymm0\n"
+    "vpaddd %%ymm0, %%ymm4, %%ymm4\n"
+    "vpsrld $2, %%ymm1, %%ymm8\n"
+    "vpslld $30, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $13, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $19, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpsrld $22, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpslld $10, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm0, %%ymm0\n"
+    "vpxor %%ymm2, %%ymm1, %%ymm8\n"
+    "vpand %%ymm3, %%ymm8, %%ymm8\n"
+    "vpand %%ymm2, %%ymm1, %%ymm9\n"
+    "vpxor %%ymm9, %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm8, %%ymm0, %%ymm0\n"
+    "addq $256, %[w]\n"
+    "addq $32, %[k]\n"
+    "decl %k[n]\n"
+    "jnz 2b\n"
+    "vpaddd 0(%[s]), %%ymm0, %%ymm0\n"
+    "vmovdqu %%ymm0, 0(%[s])\n"
+    "vpaddd 32(%[s]), %%ymm1, %%ymm1\n"
+    "vmovdqu %%ymm1, 32(%[s])\n"
+    "vpaddd 64(%[s]), %%ymm2, %%ymm2\n"
+    "vmovdqu %%ymm2, 64(%[s])\n"
+    "vpaddd 96(%[s]), %%ymm3, %%ymm3\n"
+    "vmovdqu %%ymm3, 96(%[s])\n"
+    "vpaddd 128(%[s]), %%ymm4, %%ymm4\n"
+    "vmovdqu %%ymm4, 128(%[s])\n"
+    "vpaddd 160(%[s]), %%ymm5, %%ymm5\n"
+    "vmovdqu %%ymm5, 160(%[s])\n"
+    "vpaddd 192(%[s]), %%ymm6, %%ymm6\n"
+    "vmovdqu %%ymm6, 192(%[s])\n"
+    "vpaddd 224(%[s]), %%ymm7, %%ymm7\n"
+    "vmovdqu %%ymm7, 224(%[s])\n"
+    "vzeroupper\n"
+    : [p] "+r" (p), [w] "+r" (q), [k] "+r" (k), [n] "=&r" (n)
+    : [s] "r" (state)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11",
+      "cc", "memory"
+  );
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
+static void
+sha256_blocks(sha256_t *ctx, const unsigned char *blocks, size_t len) {
+#if defined(TORSION_HAVE_ASM_X64)
+  if (torsion_cpu_has(TORSION_CPU_SHANI)) {
+    sha256_transform_ni(ctx->state, blocks, len);
+    return;
+  }
+#endif
+
+  while (len > 0) {
+    sha256_transform(ctx, blocks);
+    blocks += 64;
+    len -= 1;
+  }
+}
+
 void
 sha256_update(sha256_t *ctx, const void *data, size_t len) {
   const unsigned char *bytes = (const unsigned char *)data;
@@ -3846,13 +4484,13 @@ sha256_update(sha256_t *ctx, const void *data, size_t len) {
     if (pos < 64)
       return;
 
-    sha256_transform(ctx, ctx->block);
+    sha256_blocks(ctx, ctx->block, 1);
   }
 
-  while (len >= 64) {
-    sha256_transform(ctx, bytes + off);
-    off += 64;
-    len -= 64;
+  if (len >= 64) {
+    sha256_blocks(ctx, bytes + off, len >> 6);
+    off += len & ~63;
+    len &= 63;
   }
 
   if (len > 0)
@@ -3875,6 +4513,269 @@ sha256_final(sha256_t *ctx, unsigned char *out) {
     write32be(out + i * 4, ctx->state[i]);
 }
 
+void
+sha256_compress(sha256_t *ctx, const unsigned char *blocks, size_t len) {
+  /* Raw compression; ctx->size is left untouched. */
+  sha256_blocks(ctx, blocks, len);
+}
+
+/*
+ * SHA256 (multi-buffer)
+ *
+ * Hashes independent messages in parallel, one per
+ * vector lane. Lanes are refilled as soon as their
+ * message is done, so inputs of mixed sizes keep
+ * all lanes busy. Also backs hash256_multi (each
+ * lane hashes its own digest once more).
+ *
+ * Resources:
+ *   https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/communications-ia-multi-buffer-paper.pdf
+ */
+
+#if defined(TORSION_HAVE_ASM_X64)
+#define SHA256_LANES 8
+
+typedef struct sha256_lane_s {
+  const unsigned char *data;
+  size_t blocks;
+  const unsigned char *tail;
+  size_t tails;
+  unsigned char buf[128];
+  size_t index;
+  int rounds;
+  int busy;
+} sha256_lane_t;
+
+static void
+sha256_lane_init(sha256_lane_t *lane,
+                 const unsigned char *data,
+                 size_t len,
+                 size_t index,
+                 int rounds) {
+  size_t pos = len & 63;
+  size_t size = pos < 56 ? 64 : 128;
+
+  memset(lane->buf, 0, size);
+  memcpy(lane->buf, data + len - pos, pos);
+
+  lane->buf[pos] = 0x80;
+
+  write64be(lane->buf + size - 8, (uint64_t)len << 3);
+
+  lane->data = data;
+  lane->blocks = len >> 6;
+  lane->tail = lane->buf;
+  lane->tails = size >> 6;
+  lane->index = index;
+  lane->rounds = rounds;
+  lane->busy = 1;
+}
+
+static const unsigned char *
+sha256_lane_next(sha256_lane_t *lane) {
+  const unsigned char *block;
+
+  if (lane->blocks > 0) {
+    block = lane->data;
+    lane->data += 64;
+    lane->blocks -= 1;
+  } else {
+    block = lane->tail;
+    lane->tail += 64;
+    lane->tails -= 1;
+  }
+
+  return block;
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
+static void
+sha256_many(unsigned char *out,
+            const unsigned char *const *items,
+            const size_t *lens,
+            size_t len,
+            int rounds) {
+  sha256_t ctx;
+  size_t i;
+  int r;
+
+#if defined(TORSION_HAVE_ASM_X64)
+  /* SHA-NI beats eight AVX2 lanes. */
+  if (len >= SHA256_LANES / 2
+      && !torsion_cpu_has(TORSION_CPU_SHANI)
+      && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    sha256_lane_t lanes[SHA256_LANES];
+    const unsigned char *blocks[SHA256_LANES];
+    uint32_t state[8 * SHA256_LANES];
+    size_t next = 0;
+    size_t active = 0;
+    unsigned char *dst;
+    int j;
+
+    for (j = 0; j < SHA256_LANES; j++)
+      lanes[j].busy = 0;
+
+    for (;;) {
+      for (j = 0; j < SHA256_LANES && next < len; j++) {
+        if (lanes[j].busy)
+          continue;
+
+        sha256_lane_init(&lanes[j], items[next], lens[next], next, rounds);
+
+        sha256_init(&ctx);
+
+        for (i = 0; i < 8; i++)
+          state[i * SHA256_LANES + j] = ctx.state[i];
+
+        next += 1;
+        active += 1;
+      }
+
+      /* Finish the stragglers one at a time. */
+      if (active <= SHA256_LANES / 4 && next == len)
+        break;
+
+      for (j = 0; j < SHA256_LANES; j++) {
+        if (lanes[j].busy)
+          blocks[j] = sha256_lane_next(&lanes[j]);
+        else
+          blocks[j] = sha256_P;
+      }
+
+      sha256_transform_x8(state, blocks);
+
+      for (j = 0; j < SHA256_LANES; j++) {
+        sha256_lane_t *lane = &lanes[j];
+
+        if (!lane->busy || lane->blocks + lane->tails > 0)
+          continue;
+
+        dst = out + lane->index * 32;
+
+        for (i = 0; i < 8; i++)
+          write32be(dst + i * 4, state[i * SHA256_LANES + j]);
+
+        if (lane->rounds > 1) {
+          sha256_lane_init(lane, dst, 32, lane->index, lane->rounds - 1);
+
+          sha256_init(&ctx);
+
+          for (i = 0; i < 8; i++)
+            state[i * SHA256_LANES + j] = ctx.state[i];
+        } else {
+          lane->busy = 0;
+          active -= 1;
+        }
+      }
+    }
+
+    for (j = 0; j < SHA256_LANES; j++) {
+      sha256_lane_t *lane = &lanes[j];
+
+      if (!lane->busy)
+        continue;
+
+      for (i = 0; i < 8; i++)
+        ctx.state[i] = state[i * SHA256_LANES + j];
+
+      if (lane->blocks > 0)
+        sha256_blocks(&ctx, lane->data, lane->blocks);
+
+      sha256_blocks(&ctx, lane->tail, lane->tails);
+
+      dst = out + lane->index * 32;
+
+      for (i = 0; i < 8; i++)
+        write32be(dst + i * 4, ctx.state[i]);
+
+      for (r = 1; r < lane->rounds; r++) {
+        sha256_init(&ctx);
+        sha256_update(&ctx, dst, 32);
+        sha256_final(&ctx, dst);
+      }
+    }
+
+    torsion_cleanse(lanes, sizeof(lanes));
+    torsion_cleanse(state, sizeof(state));
+
+    return;
+  }
+#endif
+
+  for (i = 0; i < len; i++) {
+    sha256_init(&ctx);
+    sha256_update(&ctx, items[i], lens[i]);
+    sha256_final(&ctx, out + i * 32);
+
+    for (r = 1; r < rounds; r++) {
+      sha256_init(&ctx);
+      sha256_update(&ctx, out + i * 32, 32);
+      sha256_final(&ctx, out + i * 32);
+    }
+  }
+}
+
+void
+sha256_multi(unsigned char *out,
+             const unsigned char *const *items,
+             const size_t *lens,
+             size_t len) {
+  sha256_many(out, items, lens, len, 1);
+}
+
+void
+hash256_multi(unsigned char *out,
+              const unsigned char *const *items,
+              const size_t *lens,
+              size_t len) {
+  sha256_many(out, items, lens, len, 2);
+}
+
+void
+sha256_compress_multi(sha256_t *ctxs,
+                      const unsigned char *const *blocks,
+                      size_t len) {
+  /* Compresses blocks[i] into ctxs[i]. */
+  size_t i;
+
+#if defined(TORSION_HAVE_ASM_X64)
+  if (len >= SHA256_LANES / 2
+      && !torsion_cpu_has(TORSION_CPU_SHANI)
+      && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    const unsigned char *ptrs[SHA256_LANES];
+    uint32_t state[8 * SHA256_LANES];
+    size_t j, n;
+
+    while (len >= SHA256_LANES / 2) {
+      n = len < SHA256_LANES ? len : SHA256_LANES;
+
+      for (j = 0; j < SHA256_LANES; j++) {
+        ptrs[j] = j < n ? blocks[j] : sha256_P;
+
+        for (i = 0; i < 8; i++)
+          state[i * SHA256_LANES + j] = j < n ? ctxs[j].state[i] : 0;
+      }
+
+      sha256_transform_x8(state, ptrs);
+
+      for (j = 0; j < n; j++) {
+        for (i = 0; i < 8; i++)
+          ctxs[j].state[i] = state[i * SHA256_LANES + j];
+      }
+
+      ctxs += n;
+      blocks += n;
+      len -= n;
+    }
+
+    torsion_cleanse(state, sizeof(state));
+  }
+#endif
+
+  for (i = 0; i < len; i++)
+    sha256_blocks(&ctxs[i], blocks[i], 1);
+}
+
 /*
  * SHA384
  *
@@ -5346,6 +6247,16 @@ sha512_final(sha512_t *ctx, unsigned char *out) {
     write64be(out + i * 8, ctx->state[i]);
 }
 
+void
+sha512_compress(sha512_t *ctx, const unsigned char *blocks, size_t len) {
+  /* Raw compression; ctx->size is left untouched. */
+  while (len > 0) {
+    sha512_transform(ctx, blocks);
+    blocks += 128;
+    len -= 1;
+  }
+}
+
 /*
  * SHA3-{224,256,384,512}
  */
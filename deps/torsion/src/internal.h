@@ -277,4 +277,14 @@ __torsion_assert_fail(const char *file, int line, const char *expr);
 TORSION_NORETURN void
 __torsion_abort(void);
 
+/*
+ * Atomics
+ */
+
+int
+torsion_atomic_load(const volatile int *ptr);
+
+void
+torsion_atomic_store(volatile int *ptr, int val);
+
 #endif /* _TORSION_INTERNAL_H */
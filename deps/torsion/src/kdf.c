@@ -657,6 +657,251 @@ hkdf_expand(unsigned char *out,
  *   http://nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-132.pdf
  */
 
+/* Output blocks computed side by side. */
+#define PBKDF2_LANES 8
+
+typedef struct pbkdf2_256_s {
+  uint32_t istate[8];
+  uint32_t ostate[8];
+  uint32_t acc[8];
+  unsigned char ublk[64];
+  unsigned char oblk[64];
+} pbkdf2_256_t;
+
+typedef struct pbkdf2_512_s {
+  uint64_t istate[8];
+  uint64_t ostate[8];
+  uint64_t acc[8];
+  unsigned char ublk[128];
+  unsigned char oblk[128];
+} pbkdf2_512_t;
+
+static void
+pbkdf2_256_init(pbkdf2_256_t *lane,
+                const hmac_t *pmac,
+                const unsigned char *u,
+                size_t size) {
+  /* The HMAC key is absorbed once: every iteration
+   * after the first is then exactly two compressions
+   * of single, pre-padded blocks. Only the digest
+   * bytes of those blocks change between rounds.
+   */
+  size_t i;
+
+  for (i = 0; i < 8; i++) {
+    lane->istate[i] = pmac->inner.ctx.sha256.state[i];
+    lane->ostate[i] = pmac->outer.ctx.sha256.state[i];
+    lane->acc[i] = 0;
+  }
+
+  for (i = 0; i < size / 4; i++)
+    lane->acc[i] = read32be(u + i * 4);
+
+  memset(lane->ublk, 0, 64);
+  memcpy(lane->ublk, u, size);
+
+  lane->ublk[size] = 0x80;
+
+  write64be(lane->ublk + 56, (64 + size) * 8);
+
+  memcpy(lane->oblk, lane->ublk, 64);
+}
+
+static void
+pbkdf2_256_iterate(pbkdf2_256_t *lanes,
+                   size_t count,
+                   size_t size,
+                   uint32_t iter) {
+  const unsigned char *blocks[PBKDF2_LANES];
+  sha256_t ctx[PBKDF2_LANES];
+  size_t words = size / 4;
+  size_t i, k;
+  uint32_t j;
+
+  for (j = 1; j < iter; j++) {
+    for (i = 0; i < count; i++) {
+      memcpy(ctx[i].state, lanes[i].istate, 32);
+      blocks[i] = lanes[i].ublk;
+    }
+
+    sha256_compress_multi(ctx, blocks, count);
+
+    for (i = 0; i < count; i++) {
+      for (k = 0; k < words; k++)
+        write32be(lanes[i].oblk + k * 4, ctx[i].state[k]);
+
+      memcpy(ctx[i].state, lanes[i].ostate, 32);
+      blocks[i] = lanes[i].oblk;
+    }
+
+    sha256_compress_multi(ctx, blocks, count);
+
+    for (i = 0; i < count; i++) {
+      for (k = 0; k < words; k++) {
+        write32be(lanes[i].ublk + k * 4, ctx[i].state[k]);
+        lanes[i].acc[k] ^= ctx[i].state[k];
+      }
+    }
+  }
+
+  torsion_cleanse(ctx, sizeof(ctx));
+}
+
+static void
+pbkdf2_512_init(pbkdf2_512_t *lane,
+                const hmac_t *pmac,
+                const unsigned char *u,
+                size_t size) {
+  size_t i;
+
+  for (i = 0; i < 8; i++) {
+    lane->istate[i] = pmac->inner.ctx.sha512.state[i];
+    lane->ostate[i] = pmac->outer.ctx.sha512.state[i];
+    lane->acc[i] = 0;
+  }
+
+  for (i = 0; i < size / 8; i++)
+    lane->acc[i] = read64be(u + i * 8);
+
+  memset(lane->ublk, 0, 128);
+  memcpy(lane->ublk, u, size);
+
+  lane->ublk[size] = 0x80;
+
+  write64be(lane->ublk + 120, (128 + size) * 8);
+
+  memcpy(lane->oblk, lane->ublk, 128);
+}
+
+static void
+pbkdf2_512_iterate(pbkdf2_512_t *lanes,
+                   size_t count,
+                   size_t size,
+                   uint32_t iter) {
+  size_t words = size / 8;
+  sha512_t ctx;
+  size_t i, k;
+  uint32_t j;
+
+  for (i = 0; i < count; i++) {
+    pbkdf2_512_t *lane = &lanes[i];
+
+    for (j = 1; j < iter; j++) {
+      memcpy(ctx.state, lane->istate, 64);
+
+      sha512_compress(&ctx, lane->ublk, 1);
+
+      for (k = 0; k < words; k++)
+        write64be(lane->oblk + k * 8, ctx.state[k]);
+
+      memcpy(ctx.state, lane->ostate, 64);
+
+      sha512_compress(&ctx, lane->oblk, 1);
+
+      for (k = 0; k < words; k++) {
+        write64be(lane->ublk + k * 8, ctx.state[k]);
+        lane->acc[k] ^= ctx.state[k];
+      }
+    }
+  }
+
+  torsion_cleanse(&ctx, sizeof(ctx));
+}
+
+static int
+pbkdf2_has_fast(int type) {
+  return type == HASH_SHA224 || type == HASH_SHA256
+      || type == HASH_SHA384 || type == HASH_SHA512;
+}
+
+static void
+pbkdf2_derive_fast(unsigned char *out,
+                   int type,
+                   const unsigned char *const *passes,
+                   const size_t *pass_lens,
+                   const unsigned char *const *salts,
+                   const size_t *salt_lens,
+                   size_t count,
+                   uint32_t iter,
+                   size_t len) {
+  /* Lanes are filled with output blocks of
+   * consecutive items, so that a batch of short
+   * keys keeps the lanes as busy as one long key.
+   */
+  size_t hash_size = hash_output_size(type);
+  size_t blocks = (len + hash_size - 1) / hash_size;
+  size_t total = count * blocks;
+  int wide = (type == HASH_SHA384 || type == HASH_SHA512);
+  pbkdf2_256_t lanes256[PBKDF2_LANES];
+  pbkdf2_512_t lanes512[PBKDF2_LANES];
+  unsigned char block[HASH_MAX_OUTPUT_SIZE];
+  unsigned char ctr[4];
+  size_t i, k, w, t, n, item, off, size;
+  size_t cur = count;
+  hmac_t pmac, smac, hmac;
+
+  for (t = 0; t < total; t += n) {
+    n = total - t;
+
+    if (n > PBKDF2_LANES)
+      n = PBKDF2_LANES;
+
+    for (i = 0; i < n; i++) {
+      item = (t + i) / blocks;
+
+      if (item != cur) {
+        hmac_init(&pmac, type, passes[item], pass_lens[item]);
+
+        smac = pmac;
+
+        hmac_update(&smac, salts[item], salt_lens[item]);
+
+        cur = item;
+      }
+
+      write32be(ctr, (t + i) % blocks + 1);
+
+      hmac = smac;
+      hmac_update(&hmac, ctr, 4);
+      hmac_final(&hmac, block);
+
+      if (wide)
+        pbkdf2_512_init(&lanes512[i], &pmac, block, hash_size);
+      else
+        pbkdf2_256_init(&lanes256[i], &pmac, block, hash_size);
+    }
+
+    if (wide)
+      pbkdf2_512_iterate(lanes512, n, hash_size, iter);
+    else
+      pbkdf2_256_iterate(lanes256, n, hash_size, iter);
+
+    for (i = 0; i < n; i++) {
+      if (wide) {
+        for (w = 0; w < hash_size / 8; w++)
+          write64be(block + w * 8, lanes512[i].acc[w]);
+      } else {
+        for (w = 0; w < hash_size / 4; w++)
+          write32be(block + w * 4, lanes256[i].acc[w]);
+      }
+
+      item = (t + i) / blocks;
+      off = ((t + i) % blocks) * hash_size;
+      size = len - off < hash_size ? len - off : hash_size;
+
+      for (k = 0; k < size; k++)
+        out[item * len + off + k] = block[k];
+    }
+  }
+
+  torsion_cleanse(lanes256, sizeof(lanes256));
+  torsion_cleanse(lanes512, sizeof(lanes512));
+  torsion_cleanse(block, sizeof(block));
+  torsion_cleanse(&pmac, sizeof(pmac));
+  torsion_cleanse(&smac, sizeof(smac));
+  torsion_cleanse(&hmac, sizeof(hmac));
+}
+
 int
 pbkdf2_derive(unsigned char *out,
               int type,
@@ -688,6 +933,12 @@ pbkdf2_derive(unsigned char *out,
   if (len == 0)
     return 1;
 
+  if (pbkdf2_has_fast(type)) {
+    pbkdf2_derive_fast(out, type, &pass, &pass_len,
+                       &salt, &salt_len, 1, iter, len);
+    return 1;
+  }
+
   hmac_init(&pmac, type, pass, pass_len);
 
   smac = pmac;
@@ -730,6 +981,48 @@ pbkdf2_derive(unsigned char *out,
   return 1;
 }
 
+int
+pbkdf2_derive_multi(unsigned char *out,
+                    int type,
+                    const unsigned char *const *passes,
+                    const size_t *pass_lens,
+                    const unsigned char *const *salts,
+                    const size_t *salt_lens,
+                    size_t count,
+                    uint32_t iter,
+                    size_t len) {
+  /* Derives `len` bytes for each of `count` items. */
+  size_t hash_size = hash_output_size(type);
+  size_t i;
+
+  if (!hash_has_backend(type))
+    return 0;
+
+  if (len + hash_size - 1 < len)
+    return 0;
+
+  if ((len + hash_size - 1) / hash_size > UINT32_MAX)
+    return 0;
+
+  if (len == 0 || count == 0)
+    return 1;
+
+  if (pbkdf2_has_fast(type)) {
+    pbkdf2_derive_fast(out, type, passes, pass_lens,
+                       salts, salt_lens, count, iter, len);
+    return 1;
+  }
+
+  for (i = 0; i < count; i++) {
+    if (!pbkdf2_derive(out + i * len, type, passes[i], pass_lens[i],
+                       salts[i], salt_lens[i], iter, len)) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
 /*
  * PGPDF
  *
@@ -885,23 +1178,8 @@ static void blockmix_salsa8(uint8_t *, uint8_t *, size_t);
 static uint64_t integerify(uint8_t *, size_t);
 static void smix(uint8_t *, size_t, uint64_t, uint8_t *, uint8_t *);
 
-int
-scrypt_derive(unsigned char *out,
-              const unsigned char *pass,
-              size_t pass_len,
-              const unsigned char *salt,
-              size_t salt_len,
-              uint64_t N,
-              uint32_t r,
-              uint32_t p,
-              size_t len) {
-  int t = HASH_SHA256;
-  uint8_t *B = NULL;
-  uint8_t *V = NULL;
-  uint8_t *XY = NULL;
-  uint32_t i;
-  int ret = 0;
-
+static int
+scrypt_check(uint64_t N, uint32_t r, uint32_t p) {
   if (r == 0 || p == 0 || N == 0)
     return 0;
 
@@ -920,32 +1198,53 @@ scrypt_derive(unsigned char *out,
   if ((N & (N - 1)) != 0)
     return 0;
 
-  if (len == 0)
-    return 1;
+  return 1;
+}
+
+int
+scrypt_init(unsigned char *B,
+            const unsigned char *pass,
+            size_t pass_len,
+            const unsigned char *salt,
+            size_t salt_len,
+            uint64_t N,
+            uint32_t r,
+            uint32_t p) {
+  /* B must be `128 * r * p` bytes in size. */
+  int t = HASH_SHA256;
+
+  if (!scrypt_check(N, r, p))
+    return 0;
+
+  return pbkdf2_derive(B, t, pass, pass_len, salt, salt_len, 1, p * 128 * r);
+}
+
+int
+scrypt_mix(unsigned char *B, uint64_t N, uint32_t r, uint32_t lanes) {
+  /* Mix `lanes` consecutive blocks of `128 * r` bytes.
+   *
+   * Each call owns its V and XY scratch, so disjoint
+   * ranges of B can be mixed on separate threads.
+   */
+  uint8_t *V = NULL;
+  uint8_t *XY = NULL;
+  uint32_t i;
+  int ret = 0;
+
+  if (!scrypt_check(N, r, lanes))
+    return 0;
 
-  B = malloc(128 * r * p);
   XY = malloc(256 * r);
   V = malloc(128 * r * N);
 
-  if (B == NULL || XY == NULL || V == NULL)
-    goto fail;
-
-  if (!pbkdf2_derive(B, t, pass, pass_len, salt, salt_len, 1, p * 128 * r))
+  if (XY == NULL || V == NULL)
     goto fail;
 
-  for (i = 0; i < p; i++)
+  for (i = 0; i < lanes; i++)
     smix(&B[i * 128 * r], r, N, V, XY);
 
-  if (!pbkdf2_derive(out, t, pass, pass_len, B, p * 128 * r, 1, len))
-    goto fail;
-
   ret = 1;
 fail:
-  if (B != NULL) {
-    torsion_cleanse(B, 128 * r * p);
-    free(B);
-  }
-
   if (XY != NULL) {
     torsion_cleanse(XY, 256 * r);
     free(XY);
@@ -959,12 +1258,65 @@ fail:
   return ret;
 }
 
+int
+scrypt_final(unsigned char *out,
+             const unsigned char *pass,
+             size_t pass_len,
+             const unsigned char *B,
+             uint32_t r,
+             uint32_t p,
+             size_t len) {
+  int t = HASH_SHA256;
+
+  return pbkdf2_derive(out, t, pass, pass_len, B, p * 128 * r, 1, len);
+}
+
+int
+scrypt_derive(unsigned char *out,
+              const unsigned char *pass,
+              size_t pass_len,
+              const unsigned char *salt,
+              size_t salt_len,
+              uint64_t N,
+              uint32_t r,
+              uint32_t p,
+              size_t len) {
+  uint8_t *B = NULL;
+  int ret = 0;
+
+  if (!scrypt_check(N, r, p))
+    return 0;
+
+  if (len == 0)
+    return 1;
+
+  B = malloc(128 * r * p);
+
+  if (B == NULL)
+    goto fail;
+
+  if (!scrypt_init(B, pass, pass_len, salt, salt_len, N, r, p))
+    goto fail;
+
+  if (!scrypt_mix(B, N, r, p))
+    goto fail;
+
+  if (!scrypt_final(out, pass, pass_len, B, r, p, len))
+    goto fail;
+
+  ret = 1;
+fail:
+  if (B != NULL) {
+    torsion_cleanse(B, 128 * r * p);
+    free(B);
+  }
+
+  return ret;
+}
+
 static void
 blkcpy(uint8_t *dest, uint8_t *src, size_t len) {
-  size_t i;
-
-  for (i = 0; i < len; i++)
-    dest[i] = src[i];
+  memcpy(dest, src, len);
 }
 
 static void
@@ -1077,6 +1429,227 @@ integerify(uint8_t *B, size_t r) {
   return read64le(X);
 }
 
+#if defined(TORSION_HAVE_ASM_X64)
+static void
+salsa8_mix_sse2(uint8_t *dst, const uint8_t *src, const uint8_t *v, size_t r) {
+  /* BlockMix with SSE2, optionally fused with the
+   * XOR against V_j. Blocks are kept in the shuffled
+   * layout used by Tarsnap's SSE2 code[1], in which
+   * each register holds one diagonal of the state,
+   * so that a round needs only three dword shuffles.
+   *
+   * The V_j block is prefetched up front: its address
+   * is only known once the previous mix completes and
+   * the loads would otherwise stall the first rounds.
+   *
+   * Registers:
+   *
+   *   %[d] = even output pointer
+   *   %[e] = odd output pointer
+   *   %[s] = src pointer
+   *   %[v] = V_j pointer (NULL if not mixing)
+   *   %[m] = block size (128 * r)
+   *   %[n] = sub-block counter
+   *   %[r] = round counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-9]
+   *
+   * [1] https://github.com/Tarsnap/scrypt/blob/master/lib/crypto/crypto_scrypt_smix_sse2.c
+   */
+  uint8_t *odd = dst + 64 * r;
+  uint64_t m = 128 * r;
+  uint64_t n = 2 * r;
+  uint64_t k;
+
+  __asm__ __volatile__(
+    "movdqu -64(%[s],%[m]), %%xmm0\n"
+    "movdqu -48(%[s],%[m]), %%xmm1\n"
+    "movdqu -32(%[s],%[m]), %%xmm2\n"
+    "movdqu -16(%[s],%[m]), %%xmm3\n"
+    "test %[v], %[v]\n"
+    "jz 1f\n"
+    "movdqu -64(%[v],%[m]), %%xmm4\n"
+    "movdqu -48(%[v],%[m]), %%xmm5\n"
+    "movdqu -32(%[v],%[m]), %%xmm6\n"
+    "movdqu -16(%[v],%[m]), %%xmm7\n"
+    "pxor %%xmm4, %%xmm0\n"
+    "pxor %%xmm5, %%xmm1\n"
+    "pxor %%xmm6, %%xmm2\n"
+    "pxor %%xmm7, %%xmm3\n"
+    "xor %[r], %[r]\n"
+    "4:\n"
+    "prefetcht0 (%[v],%[r])\n"
+    "add $64, %[r]\n"
+    "cmp %[m], %[r]\n"
+    "jb 4b\n"
+    "1:\n"
+    "3:\n"
+    "movdqu 0(%[s]), %%xmm4\n"
+    "movdqu 16(%[s]), %%xmm5\n"
+    "movdqu 32(%[s]), %%xmm6\n"
+    "movdqu 48(%[s]), %%xmm7\n"
+    "pxor %%xmm4, %%xmm0\n"
+    "pxor %%xmm5, %%xmm1\n"
+    "pxor %%xmm6, %%xmm2\n"
+    "pxor %%xmm7, %%xmm3\n"
+    "test %[v], %[v]\n"
+    "jz 5f\n"
+    "movdqu 0(%[v]), %%xmm4\n"
+    "movdqu 16(%[v]), %%xmm5\n"
+    "movdqu 32(%[v]), %%xmm6\n"
+    "movdqu 48(%[v]), %%xmm7\n"
+    "pxor %%xmm4, %%xmm0\n"
+    "pxor %%xmm5, %%xmm1\n"
+    "pxor %%xmm6, %%xmm2\n"
+    "pxor %%xmm7, %%xmm3\n"
+    "add $64, %[v]\n"
+    "5:\n"
+    "movdqa %%xmm0, %%xmm4\n"
+    "movdqa %%xmm1, %%xmm5\n"
+    "movdqa %%xmm2, %%xmm6\n"
+    "movdqa %%xmm3, %%xmm7\n"
+    "mov $4, %k[r]\n"
+    "2:\n"
+    "movdqa %%xmm0, %%xmm8\n"
+    "paddd %%xmm3, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $7, %%xmm8\n"
+    "psrld $25, %%xmm9\n"
+    "pxor %%xmm8, %%xmm1\n"
+    "pxor %%xmm9, %%xmm1\n"
+    "movdqa %%xmm1, %%xmm8\n"
+    "paddd %%xmm0, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $9, %%xmm8\n"
+    "psrld $23, %%xmm9\n"
+    "pxor %%xmm8, %%xmm2\n"
+    "pxor %%xmm9, %%xmm2\n"
+    "movdqa %%xmm2, %%xmm8\n"
+    "paddd %%xmm1, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $13, %%xmm8\n"
+    "psrld $19, %%xmm9\n"
+    "pxor %%xmm8, %%xmm3\n"
+    "pxor %%xmm9, %%xmm3\n"
+    "movdqa %%xmm3, %%xmm8\n"
+    "paddd %%xmm2, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $18, %%xmm8\n"
+    "psrld $14, %%xmm9\n"
+    "pxor %%xmm8, %%xmm0\n"
+    "pxor %%xmm9, %%xmm0\n"
+    "pshufd $0x93, %%xmm1, %%xmm1\n"
+    "pshufd $0x4e, %%xmm2, %%xmm2\n"
+    "pshufd $0x39, %%xmm3, %%xmm3\n"
+    "movdqa %%xmm0, %%xmm8\n"
+    "paddd %%xmm1, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $7, %%xmm8\n"
+    "psrld $25, %%xmm9\n"
+    "pxor %%xmm8, %%xmm3\n"
+    "pxor %%xmm9, %%xmm3\n"
+    "movdqa %%xmm3, %%xmm8\n"
+    "paddd %%xmm0, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $9, %%xmm8\n"
+    "psrld $23, %%xmm9\n"
+    "pxor %%xmm8, %%xmm2\n"
+    "pxor %%xmm9, %%xmm2\n"
+    "movdqa %%xmm2, %%xmm8\n"
+    "paddd %%xmm3, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $13, %%xmm8\n"
+    "psrld $19, %%xmm9\n"
+    "pxor %%xmm8, %%xmm1\n"
+    "pxor %%xmm9, %%xmm1\n"
+    "movdqa %%xmm1, %%xmm8\n"
+    "paddd %%xmm2, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "pslld $18, %%xmm8\n"
+    "psrld $14, %%xmm9\n"
+    "pxor %%xmm8, %%xmm0\n"
+    "pxor %%xmm9, %%xmm0\n"
+    "pshufd $0x39, %%xmm1, %%xmm1\n"
+    "pshufd $0x4e, %%xmm2, %%xmm2\n"
+    "pshufd $0x93, %%xmm3, %%xmm3\n"
+    "dec %k[r]\n"
+    "jnz 2b\n"
+    "paddd %%xmm4, %%xmm0\n"
+    "paddd %%xmm5, %%xmm1\n"
+    "paddd %%xmm6, %%xmm2\n"
+    "paddd %%xmm7, %%xmm3\n"
+    "movdqu %%xmm0, 0(%[d])\n"
+    "movdqu %%xmm1, 16(%[d])\n"
+    "movdqu %%xmm2, 32(%[d])\n"
+    "movdqu %%xmm3, 48(%[d])\n"
+    "add $64, %[d]\n"
+    "add $64, %[s]\n"
+    "xchg %[d], %[e]\n"
+    "dec %[n]\n"
+    "jnz 3b\n"
+    : [d] "+r" (dst), [e] "+r" (odd), [s] "+r" (src),
+      [v] "+r" (v), [n] "+r" (n), [r] "=&r" (k)
+    : [m] "r" (m)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+      "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "cc", "memory"
+  );
+}
+
+static void
+smix_sse2(uint8_t *B, size_t r, uint64_t N, uint8_t *V, uint8_t *XY) {
+  /* Same as below, two steps at a time to avoid copies.
+   * Word `i` of each sub-block is stored at position
+   * `i * 13 mod 16` (the inverse of `i * 5 mod 16`).
+   */
+  uint8_t *X = XY;
+  uint8_t *Y = &XY[128 * r];
+  size_t m = 128 * r;
+  uint64_t i;
+  uint64_t j;
+  size_t k, w;
+
+  /* 1: X <-- B */
+  for (k = 0; k < 2 * r; k++) {
+    for (w = 0; w < 16; w++)
+      memcpy(&X[(k * 16 + w) * 4], &B[(k * 16 + (w * 5) % 16) * 4], 4);
+  }
+
+  /* 2: for i = 0 to N - 1 do */
+  for (i = 0; i < N; i += 2) {
+    /* 3: V_i <-- X */
+    memcpy(&V[i * m], X, m);
+
+    /* 4: X <-- H(X) */
+    salsa8_mix_sse2(Y, X, NULL, r);
+
+    memcpy(&V[(i + 1) * m], Y, m);
+
+    salsa8_mix_sse2(X, Y, NULL, r);
+  }
+
+  /* 6: for i = 0 to N - 1 do */
+  for (i = 0; i < N; i += 2) {
+    /* 7: j <-- Integerify(X) mod N */
+    j = read32le(&X[(2 * r - 1) * 64]) & (N - 1);
+
+    /* 8: X <-- H(X \xor V_j) */
+    salsa8_mix_sse2(Y, X, &V[j * m], r);
+
+    j = read32le(&Y[(2 * r - 1) * 64]) & (N - 1);
+
+    salsa8_mix_sse2(X, Y, &V[j * m], r);
+  }
+
+  /* 10: B' <-- X */
+  for (k = 0; k < 2 * r; k++) {
+    for (w = 0; w < 16; w++)
+      memcpy(&B[(k * 16 + (w * 5) % 16) * 4], &X[(k * 16 + w) * 4], 4);
+  }
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
 static void
 smix(uint8_t *B, size_t r, uint64_t N, uint8_t *V, uint8_t *XY) {
   uint8_t *X = XY;
@@ -1084,6 +1657,14 @@ smix(uint8_t *B, size_t r, uint64_t N, uint8_t *V, uint8_t *XY) {
   uint64_t i;
   uint64_t j;
 
+#if defined(TORSION_HAVE_ASM_X64)
+  /* N is a power of two and N <= 2^31. */
+  if (N >= 2) {
+    smix_sse2(B, r, N, V, XY);
+    return;
+  }
+#endif
+
   /* 1: X <-- B */
   blkcpy(X, B, 128 * r);
 
@@ -17,8 +17,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <torsion/mac.h>
+#include <torsion/util.h>
 #include "bio.h"
 #include "internal.h"
+#include "entropy/entropy.h"
 
 /*
  * Poly1305
@@ -28,6 +30,7 @@
  *   https://cr.yp.to/mac.html
  *   https://tools.ietf.org/html/rfc7539#section-2.5
  *   https://github.com/floodyberry/poly1305-donna/blob/master/poly1305-donna-64.h
+ *   https://eprint.iacr.org/2013/538.pdf
  */
 
 void
@@ -246,6 +249,298 @@ poly1305_blocks(poly1305_t *ctx,
 #endif /* !TORSION_HAVE_INT128 */
 }
 
+#if defined(TORSION_HAVE_ASM_X64) && defined(TORSION_HAVE_INT128)
+/* Minimum input for the vector code to pay for its setup. */
+#define POLY1305_VECTOR_MIN 256
+
+static void
+poly1305_mul26(uint64_t *z, const uint64_t *x, const uint64_t *y) {
+  uint64_t d0, d1, d2, d3, d4, c;
+
+  d0 = x[0] * y[0] + x[1] * y[4] * 5 + x[2] * y[3] * 5
+     + x[3] * y[2] * 5 + x[4] * y[1] * 5;
+
+  d1 = x[0] * y[1] + x[1] * y[0] + x[2] * y[4] * 5
+     + x[3] * y[3] * 5 + x[4] * y[2] * 5;
+
+  d2 = x[0] * y[2] + x[1] * y[1] + x[2] * y[0]
+     + x[3] * y[4] * 5 + x[4] * y[3] * 5;
+
+  d3 = x[0] * y[3] + x[1] * y[2] + x[2] * y[1]
+     + x[3] * y[0] + x[4] * y[4] * 5;
+
+  d4 = x[0] * y[4] + x[1] * y[3] + x[2] * y[2]
+     + x[3] * y[1] + x[4] * y[0];
+
+  c = d0 >> 26; z[0] = d0 & 0x3ffffff; d1 += c;
+  c = d1 >> 26; z[1] = d1 & 0x3ffffff; d2 += c;
+  c = d2 >> 26; z[2] = d2 & 0x3ffffff; d3 += c;
+  c = d3 >> 26; z[3] = d3 & 0x3ffffff; d4 += c;
+  c = d4 >> 26; z[4] = d4 & 0x3ffffff;
+
+  z[0] += c * 5;
+  c = z[0] >> 26;
+  z[0] &= 0x3ffffff;
+  z[1] += c;
+}
+
+static void
+poly1305_table26(uint64_t *tab, const uint64_t (*r)[5]) {
+  /* Table layout (each entry one ymm word per lane):
+   *
+   *   0-4 = r
+   *   5-8 = r[1..4] * 5
+   *   9 = limb mask
+   *   10 = 2^128 (the padding bit)
+   */
+  int i, j;
+
+  for (j = 0; j < 4; j++) {
+    for (i = 0; i < 5; i++)
+      tab[i * 4 + j] = r[j][i];
+
+    for (i = 1; i < 5; i++)
+      tab[(4 + i) * 4 + j] = r[j][i] * 5;
+
+    tab[9 * 4 + j] = 0x3ffffff;
+    tab[10 * 4 + j] = 1 << 24;
+  }
+}
+
+static void
+poly1305_blocks_avx2(uint64_t *hv,
+                     const uint64_t *tab,
+                     const unsigned char *data,
+                     size_t groups) {
+  /* Four 26 bit limb accumulators, one per 64 bit
+   * lane. Each lane absorbs every fourth block and
+   * is multiplied by its own power of r[1].
+   *
+   * Registers:
+   *
+   *   %[h] = accumulator pointer (5 ymm words)
+   *   %[t] = table pointer (see poly1305_table26)
+   *   %[s] = message pointer
+   *   %[n] = group counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-11], %ymm15
+   *
+   * [1] https://eprint.iacr.org/2013/538.pdf
+   */
+  uint64_t n = groups;
+
+  __asm__ __volatile__(
+    "vmovdqu 288(%[t]), %%ymm15\n"
+    "vmovdqu 0(%[h]), %%ymm0\n"
+    "vmovdqu 32(%[h]), %%ymm1\n"
+    "vmovdqu 64(%[h]), %%ymm2\n"
+    "vmovdqu 96(%[h]), %%ymm3\n"
+    "vmovdqu 128(%[h]), %%ymm4\n"
+    "1:\n"
+    "vmovdqu (%[s]), %%ymm5\n"
+    "vmovdqu 32(%[s]), %%ymm6\n"
+    "vpunpcklqdq %%ymm6, %%ymm5, %%ymm7\n"
+    "vpunpckhqdq %%ymm6, %%ymm5, %%ymm8\n"
+    "vpermq $0xd8, %%ymm7, %%ymm7\n"
+    "vpermq $0xd8, %%ymm8, %%ymm8\n"
+    "vpand %%ymm15, %%ymm7, %%ymm5\n"
+    "vpaddq %%ymm5, %%ymm0, %%ymm0\n"
+    "vpsrlq $26, %%ymm7, %%ymm5\n"
+    "vpand %%ymm15, %%ymm5, %%ymm5\n"
+    "vpaddq %%ymm5, %%ymm1, %%ymm1\n"
+    "vpsrlq $52, %%ymm7, %%ymm5\n"
+    "vpsllq $12, %%ymm8, %%ymm6\n"
+    "vpor %%ymm6, %%ymm5, %%ymm5\n"
+    "vpand %%ymm15, %%ymm5, %%ymm5\n"
+    "vpaddq %%ymm5, %%ymm2, %%ymm2\n"
+    "vpsrlq $14, %%ymm8, %%ymm5\n"
+    "vpand %%ymm15, %%ymm5, %%ymm5\n"
+    "vpaddq %%ymm5, %%ymm3, %%ymm3\n"
+    "vpsrlq $40, %%ymm8, %%ymm5\n"
+    "vpor 320(%[t]), %%ymm5, %%ymm5\n"
+    "vpaddq %%ymm5, %%ymm4, %%ymm4\n"
+    "vpmuludq 0(%[t]), %%ymm0, %%ymm5\n"
+    "vpmuludq 256(%[t]), %%ymm1, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm5, %%ymm5\n"
+    "vpmuludq 224(%[t]), %%ymm2, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm5, %%ymm5\n"
+    "vpmuludq 192(%[t]), %%ymm3, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm5, %%ymm5\n"
+    "vpmuludq 160(%[t]), %%ymm4, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm5, %%ymm5\n"
+    "vpmuludq 32(%[t]), %%ymm0, %%ymm6\n"
+    "vpmuludq 0(%[t]), %%ymm1, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm6, %%ymm6\n"
+    "vpmuludq 256(%[t]), %%ymm2, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm6, %%ymm6\n"
+    "vpmuludq 224(%[t]), %%ymm3, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm6, %%ymm6\n"
+    "vpmuludq 192(%[t]), %%ymm4, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm6, %%ymm6\n"
+    "vpmuludq 64(%[t]), %%ymm0, %%ymm7\n"
+    "vpmuludq 32(%[t]), %%ymm1, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm7, %%ymm7\n"
+    "vpmuludq 0(%[t]), %%ymm2, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm7, %%ymm7\n"
+    "vpmuludq 256(%[t]), %%ymm3, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm7, %%ymm7\n"
+    "vpmuludq 224(%[t]), %%ymm4, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm7, %%ymm7\n"
+    "vpmuludq 96(%[t]), %%ymm0, %%ymm8\n"
+    "vpmuludq 64(%[t]), %%ymm1, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm8, %%ymm8\n"
+    "vpmuludq 32(%[t]), %%ymm2, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm8, %%ymm8\n"
+    "vpmuludq 0(%[t]), %%ymm3, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm8, %%ymm8\n"
+    "vpmuludq 256(%[t]), %%ymm4, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm8, %%ymm8\n"
+    "vpmuludq 128(%[t]), %%ymm0, %%ymm9\n"
+    "vpmuludq 96(%[t]), %%ymm1, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm9, %%ymm9\n"
+    "vpmuludq 64(%[t]), %%ymm2, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm9, %%ymm9\n"
+    "vpmuludq 32(%[t]), %%ymm3, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm9, %%ymm9\n"
+    "vpmuludq 0(%[t]), %%ymm4, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm9, %%ymm9\n"
+    "vpsrlq $26, %%ymm5, %%ymm10\n"
+    "vpand %%ymm15, %%ymm5, %%ymm0\n"
+    "vpaddq %%ymm10, %%ymm6, %%ymm6\n"
+    "vpsrlq $26, %%ymm6, %%ymm10\n"
+    "vpand %%ymm15, %%ymm6, %%ymm1\n"
+    "vpaddq %%ymm10, %%ymm7, %%ymm7\n"
+    "vpsrlq $26, %%ymm7, %%ymm10\n"
+    "vpand %%ymm15, %%ymm7, %%ymm2\n"
+    "vpaddq %%ymm10, %%ymm8, %%ymm8\n"
+    "vpsrlq $26, %%ymm8, %%ymm10\n"
+    "vpand %%ymm15, %%ymm8, %%ymm3\n"
+    "vpaddq %%ymm10, %%ymm9, %%ymm9\n"
+    "vpsrlq $26, %%ymm9, %%ymm10\n"
+    "vpand %%ymm15, %%ymm9, %%ymm4\n"
+    "vpsllq $2, %%ymm10, %%ymm11\n"
+    "vpaddq %%ymm11, %%ymm10, %%ymm10\n"
+    "vpaddq %%ymm10, %%ymm0, %%ymm0\n"
+    "vpsrlq $26, %%ymm0, %%ymm10\n"
+    "vpand %%ymm15, %%ymm0, %%ymm0\n"
+    "vpaddq %%ymm10, %%ymm1, %%ymm1\n"
+    "addq $64, %[s]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "vmovdqu %%ymm0, 0(%[h])\n"
+    "vmovdqu %%ymm1, 32(%[h])\n"
+    "vmovdqu %%ymm2, 64(%[h])\n"
+    "vmovdqu %%ymm3, 96(%[h])\n"
+    "vmovdqu %%ymm4, 128(%[h])\n"
+    "vzeroupper\n"
+    : [s] "+r" (data), [n] "+r" (n)
+    : [h] "r" (hv), [t] "r" (tab)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm15", "cc", "memory"
+  );
+}
+
+static void
+poly1305_vector(poly1305_t *ctx, const unsigned char *data, size_t len) {
+  /* Absorb 64 bytes per iteration using the powers
+   * r^1..r^4 (computed here since the scalar state
+   * keeps r in 44 bit limbs). Lane j holds blocks
+   * j, j + 4, j + 8, ... and is multiplied by r^4
+   * each round, except for the last round where it
+   * is multiplied by r^(4 - j). Summing the lanes
+   * gives the sequential result.
+   */
+  struct poly1305_64_s *st = &ctx->state.u64;
+  size_t groups = len >> 6;
+  uint64_t r[4][5], t[4][5];
+  uint64_t tab[44], hv[20];
+  uint64_t h0, h1, h2, c;
+  torsion_uint128_t d;
+  int i, j;
+
+  ASSERT(groups >= 1);
+
+  /* r in 26 bit limbs. */
+  r[0][0] = st->r[0] & 0x3ffffff;
+  r[0][1] = ((st->r[0] >> 26) | (st->r[1] << 18)) & 0x3ffffff;
+  r[0][2] = (st->r[1] >> 8) & 0x3ffffff;
+  r[0][3] = ((st->r[1] >> 34) | (st->r[2] << 10)) & 0x3ffffff;
+  r[0][4] = st->r[2] >> 16;
+
+  /* r[i] = r^(i + 1) */
+  for (i = 1; i < 4; i++)
+    poly1305_mul26(r[i], r[i - 1], r[0]);
+
+  /* h in 26 bit limbs. */
+  h0 = st->h[0];
+  h1 = st->h[1];
+  h2 = st->h[2];
+
+  c = h0 >> 44; h0 &= UINT64_C(0xfffffffffff); h1 += c;
+  c = h1 >> 44; h1 &= UINT64_C(0xfffffffffff); h2 += c;
+
+  memset(hv, 0, sizeof(hv));
+
+  hv[0 * 4] = h0 & 0x3ffffff;
+  hv[1 * 4] = ((h0 >> 26) | (h1 << 18)) & 0x3ffffff;
+  hv[2 * 4] = (h1 >> 8) & 0x3ffffff;
+  hv[3 * 4] = ((h1 >> 34) | (h2 << 10)) & 0x3ffffff;
+  hv[4 * 4] = h2 >> 16;
+
+  if (groups > 1) {
+    for (j = 0; j < 4; j++)
+      memcpy(t[j], r[3], sizeof(r[3]));
+
+    poly1305_table26(tab, (const uint64_t (*)[5])t);
+    poly1305_blocks_avx2(hv, tab, data, groups - 1);
+
+    data += (groups - 1) << 6;
+  }
+
+  for (j = 0; j < 4; j++)
+    memcpy(t[j], r[3 - j], sizeof(r[0]));
+
+  poly1305_table26(tab, (const uint64_t (*)[5])t);
+  poly1305_blocks_avx2(hv, tab, data, 1);
+
+  /* Sum the lanes and convert back to 44 bit limbs. */
+  for (i = 0; i < 5; i++)
+    hv[i] = hv[i * 4 + 0] + hv[i * 4 + 1] + hv[i * 4 + 2] + hv[i * 4 + 3];
+
+  d = (torsion_uint128_t)hv[0]
+    + ((torsion_uint128_t)hv[1] << 26)
+    + ((torsion_uint128_t)hv[2] << 52);
+
+  h0 = (uint64_t)d & UINT64_C(0xfffffffffff);
+  d >>= 44;
+
+  d += ((torsion_uint128_t)hv[3] << 34)
+     + ((torsion_uint128_t)hv[4] << 60);
+
+  h1 = (uint64_t)d & UINT64_C(0xfffffffffff);
+  h2 = (uint64_t)(d >> 44);
+
+  c = h2 >> 42;
+  h2 &= UINT64_C(0x3ffffffffff);
+  h0 += c * 5;
+  c = h0 >> 44;
+  h0 &= UINT64_C(0xfffffffffff);
+  h1 += c;
+
+  st->h[0] = h0;
+  st->h[1] = h1;
+  st->h[2] = h2;
+
+  torsion_cleanse(r, sizeof(r));
+  torsion_cleanse(t, sizeof(t));
+  torsion_cleanse(tab, sizeof(tab));
+  torsion_cleanse(hv, sizeof(hv));
+}
+#endif /* TORSION_HAVE_ASM_X64 && TORSION_HAVE_INT128 */
+
 void
 poly1305_update(poly1305_t *ctx, const unsigned char *data, size_t len) {
   size_t i;
@@ -273,6 +568,18 @@ poly1305_update(poly1305_t *ctx, const unsigned char *data, size_t len) {
     ctx->size = 0;
   }
 
+#if defined(TORSION_HAVE_ASM_X64) && defined(TORSION_HAVE_INT128)
+  /* Process 64 byte groups. */
+  if (len >= POLY1305_VECTOR_MIN && torsion_cpu_has(TORSION_CPU_AVX2)) {
+    size_t want = len & ~63;
+
+    poly1305_vector(ctx, data, want);
+
+    data += want;
+    len -= want;
+  }
+#endif
+
   /* Process full blocks. */
   if (len >= 16) {
     size_t want = len & ~15;
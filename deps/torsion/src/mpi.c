@@ -95,6 +95,8 @@ enum mpz_div_round_mode { MP_DIV_FLOOR, MP_DIV_CEIL, MP_DIV_TRUNC };
 
 #define MP_CMP(a, b) (((a) > (b)) - ((a) < (b)))
 
+#define MP_SIEVE_SIZE 171
+
 #define MPN_OVERLAP_P(xp, xn, yp, yn) \
   ((xp) + (xn) > (yp) && (yp) + (yn) > (xp))
 
@@ -1237,8 +1239,9 @@ mpn_submul_1(mp_ptr rp, mp_srcptr up, mp_size_t n, mp_limb_t vl) {
 #endif
 }
 
-mp_limb_t
-mpn_mul(mp_ptr rp, mp_srcptr up, mp_size_t un, mp_srcptr vp, mp_size_t vn) {
+static void
+mpn_mul_basecase(mp_ptr rp, mp_srcptr up, mp_size_t un,
+                            mp_srcptr vp, mp_size_t vn) {
   ASSERT(un >= vn);
   ASSERT(vn >= 1);
   ASSERT(!MPN_OVERLAP_P(rp, un + vn, up, un));
@@ -1258,13 +1261,6 @@ mpn_mul(mp_ptr rp, mp_srcptr up, mp_size_t un, mp_srcptr vp, mp_size_t vn) {
     rp += 1, vp += 1;
     rp[un] = mpn_addmul_1(rp, up, un, vp[0]);
   }
-
-  return rp[un];
-}
-
-void
-mpn_mul_n(mp_ptr rp, mp_srcptr ap, mp_srcptr bp, mp_size_t n) {
-  mpn_mul(rp, ap, n, bp, n);
 }
 
 #ifdef MPI_USE_ASM
@@ -1332,8 +1328,8 @@ mpn_sqr_diag_addlsh1(mp_ptr rp, mp_srcptr tp, mp_srcptr up, mp_size_t n) {
 }
 #endif
 
-void
-mpn_sqr(mp_ptr rp, mp_srcptr up, mp_size_t n) {
+static void
+mpn_sqr_basecase(mp_ptr rp, mp_srcptr up, mp_size_t n) {
 #if defined(MPI_USE_ASM)
   /* https://gmplib.org/repo/gmp-6.2/file/tip/mpn/generic/sqr_basecase.c */
   ASSERT(n >= 1);
@@ -1361,8 +1357,438 @@ mpn_sqr(mp_ptr rp, mp_srcptr up, mp_size_t n) {
     mpn_sqr_diag_addlsh1(xp, xp + 1, up - n + 2, n);
   }
 #else
-  mpn_mul_n(rp, up, up, n);
+  mpn_mul_basecase(rp, up, n, up, n);
+#endif
+}
+
+/*
+ * Karatsuba/Toom-3 Multiplication
+ *
+ * Resources:
+ *   https://gmplib.org/manual/Karatsuba-Multiplication
+ *   https://gmplib.org/manual/Toom-3_002dWay-Multiplication
+ *   https://gmplib.org/repo/gmp-6.2/file/tip/mpn/generic/toom_interpolate_5pts.c
+ *
+ * The balanced routines below recurse on themselves
+ * with a caller-provided scratch area sized by
+ * MPN_TOOM_ITCH(). Squaring is detected by passing
+ * the same pointer for both operands, in which case
+ * the second evaluation is skipped and the recursion
+ * bottoms out in the squaring basecase.
+ *
+ * Note that the subtractive Karatsuba branches on
+ * the sign of a0 - a1. None of this is suitable for
+ * secret operands, so only the variable-time
+ * mpn_mul_var and mpn_sqr_var dispatch here. The
+ * public mpn_mul, mpn_mul_n and mpn_sqr stay on the
+ * basecase and are safe to use with secrets.
+ *
+ * The thresholds are measured in limbs and were tuned
+ * with scripts/bench-mul.c on x86-64. They can be
+ * overridden at compile time for re-tuning.
+ */
+
+#ifndef MPN_MUL_TOOM22_THRESHOLD
+#define MPN_MUL_TOOM22_THRESHOLD 28
+#endif
+
+#ifndef MPN_MUL_TOOM33_THRESHOLD
+#define MPN_MUL_TOOM33_THRESHOLD 112
+#endif
+
+#ifndef MPN_SQR_TOOM22_THRESHOLD
+#define MPN_SQR_TOOM22_THRESHOLD 56
+#endif
+
+#ifndef MPN_SQR_TOOM33_THRESHOLD
+#define MPN_SQR_TOOM33_THRESHOLD 160
 #endif
+
+#if MPN_MUL_TOOM22_THRESHOLD < 8 || MPN_SQR_TOOM22_THRESHOLD < 8
+#error "Toom-2 thresholds must be at least 8 limbs."
+#endif
+
+#if MPN_MUL_TOOM33_THRESHOLD < 32 || MPN_SQR_TOOM33_THRESHOLD < 32
+#error "Toom-3 thresholds must be at least 32 limbs."
+#endif
+
+static int
+mpn_sub_abs(mp_ptr rp, mp_srcptr ap, mp_size_t an,
+                       mp_srcptr bp, mp_size_t bn) {
+  /* rp = |ap - bp|, returns 1 if ap < bp. */
+  mp_size_t i;
+
+  ASSERT(an >= bn);
+
+  for (i = an - 1; i >= bn; i--) {
+    if (ap[i] != 0) {
+      mpn_sub(rp, ap, an, bp, bn);
+      return 0;
+    }
+  }
+
+  if (mpn_cmp(ap, bp, bn) < 0) {
+    mpn_sub_n(rp, bp, ap, bn);
+    mpn_zero(rp + bn, an - bn);
+    return 1;
+  }
+
+  mpn_sub(rp, ap, an, bp, bn);
+
+  return 0;
+}
+
+static void
+mpn_toom_mul_n(mp_ptr, mp_srcptr, mp_srcptr, mp_size_t, mp_ptr);
+
+static void
+mpn_toom22_mul_n(mp_ptr rp, mp_srcptr ap, mp_srcptr bp,
+                 mp_size_t n, mp_ptr tp) {
+  /* Karatsuba multiplication.
+   *
+   * With a = a1 * B^l + a0 and b = b1 * B^l + b0:
+   *
+   *   a * b = z2 * B^(2 * l)
+   *         + (z0 + z2 - (a0 - a1) * (b0 - b1)) * B^l
+   *         + z0
+   *
+   * where z0 = a0 * b0 and z2 = a1 * b1.
+   *
+   * Scratch layout (4 * l + max(2 * l + 1, itch(l))):
+   *
+   *   zp = |a0 - a1| * |b0 - b1| (2 * l)
+   *   xp = |a0 - a1| (l)
+   *   yp = |b0 - b1| (l)
+   *   sp = recursion scratch, then the middle term
+   */
+  mp_size_t h = n / 2;
+  mp_size_t l = n - h;
+  mp_ptr zp = tp;
+  mp_ptr xp = tp + 2 * l;
+  mp_ptr yp = tp + 3 * l;
+  mp_ptr sp = tp + 4 * l;
+  mp_limb_t cy;
+  int neg;
+
+  ASSERT(h >= 2);
+
+  neg = mpn_sub_abs(xp, ap, l, ap + l, h);
+
+  if (bp != ap) {
+    neg ^= mpn_sub_abs(yp, bp, l, bp + l, h);
+  } else {
+    yp = xp;
+    neg = 0;
+  }
+
+  mpn_toom_mul_n(rp, ap, bp, l, sp);
+  mpn_toom_mul_n(rp + 2 * l, ap + l, bp + l, h, sp);
+  mpn_toom_mul_n(zp, xp, yp, l, sp);
+
+  /* sp = z0 + z2 -/+ zp */
+  cy = mpn_add(sp, rp, 2 * l, rp + 2 * l, 2 * h);
+
+  if (neg)
+    cy += mpn_add_n(sp, sp, zp, 2 * l);
+  else
+    cy -= mpn_sub_n(sp, sp, zp, 2 * l);
+
+  sp[2 * l] = cy;
+
+  cy = mpn_add(rp + l, rp + l, 2 * n - l, sp, 2 * l + 1);
+
+  ASSERT_NOCARRY(cy);
+}
+
+static int
+mpn_toom3_eval(mp_ptr p1, mp_ptr pm1, mp_ptr p2,
+               mp_srcptr ap, mp_size_t k, mp_size_t m) {
+  /* Evaluate a2 * x^2 + a1 * x + a0 at 1, -1 and 2.
+     Every output is k + 1 limbs. Returns the sign
+     of a(-1), which is stored as an absolute value. */
+  mp_srcptr a0 = ap;
+  mp_srcptr a1 = ap + k;
+  mp_srcptr a2 = ap + 2 * k;
+  int neg;
+
+  /* p1 = a0 + a2 */
+  p1[k] = mpn_add(p1, a0, k, a2, m);
+
+  /* pm1 = |a0 + a2 - a1| */
+  neg = mpn_sub_abs(pm1, p1, k + 1, a1, k);
+
+  /* p1 = a0 + a1 + a2 */
+  p1[k] += mpn_add_n(p1, p1, a1, k);
+
+  /* p2 = ((a2 * 2) + a1) * 2 + a0 */
+  p2[k] = mpn_add(p2, a1, k, a2, m);
+  p2[k] += mpn_add(p2, p2, k, a2, m);
+
+  mpn_lshift(p2, p2, k + 1, 1);
+
+  p2[k] += mpn_add_n(p2, p2, a0, k);
+
+  return neg;
+}
+
+static void
+mpn_divexact_by3(mp_ptr rp, mp_srcptr ap, mp_size_t n) {
+  /* Exact division by 3 using the inverse of
+     3 mod 2^MP_LIMB_BITS (0xaa...ab). */
+  static const mp_limb_t inv = (MP_LIMB_MAX / 3) * 2 + 1;
+  static const mp_limb_t one_third = MP_LIMB_MAX / 3;
+  static const mp_limb_t two_thirds = (MP_LIMB_MAX / 3) * 2;
+  mp_limb_t c = 0;
+  mp_limb_t s, l, q;
+  mp_size_t i;
+
+  for (i = 0; i < n; i++) {
+    s = ap[i];
+    l = s - c;
+    c = l > s;
+    q = l * inv;
+    rp[i] = q;
+    c += (q > one_third) + (q > two_thirds);
+  }
+
+  ASSERT(c == 0);
+}
+
+static void
+mpn_toom33_mul_n(mp_ptr rp, mp_srcptr ap, mp_srcptr bp,
+                 mp_size_t n, mp_ptr tp) {
+  /* Toom-3 multiplication.
+   *
+   * The operands are split into three pieces of
+   * k limbs (the top piece has m <= k limbs) and
+   * evaluated at 0, 1, -1, 2 and infinity. The five
+   * products are interpolated as follows:
+   *
+   *   c0 = v0
+   *   c4 = vinf
+   *   c2 = (v1 + vm1) / 2 - v0 - vinf
+   *   s  = (v1 - vm1) / 2 = c1 + c3
+   *   c3 = ((v2 - v0 - 4 * c2 - 16 * vinf) / 2 - s) / 3
+   *   c1 = s - c3
+   *
+   * v0 and vinf are written directly to rp. The
+   * scratch area holds v1, vm1 and v2 (2 * k + 2
+   * limbs each), the six evaluations (k + 1 limbs
+   * each) and the recursion scratch.
+   */
+  mp_size_t k = (n + 2) / 3;
+  mp_size_t m = n - 2 * k;
+  mp_size_t L = 2 * k + 2;
+  mp_ptr v1 = tp;
+  mp_ptr vm1 = tp + L;
+  mp_ptr v2 = tp + 2 * L;
+  mp_ptr a1 = tp + 3 * L;
+  mp_ptr am1 = a1 + (k + 1);
+  mp_ptr a2 = am1 + (k + 1);
+  mp_ptr b1 = a2 + (k + 1);
+  mp_ptr bm1 = b1 + (k + 1);
+  mp_ptr b2 = bm1 + (k + 1);
+  mp_ptr sp = b2 + (k + 1);
+  mp_ptr c1, c2, c3, wp;
+  mp_size_t cn;
+  mp_limb_t cy;
+  int neg;
+
+  ASSERT(m >= 1);
+
+  neg = mpn_toom3_eval(a1, am1, a2, ap, k, m);
+
+  if (bp != ap) {
+    neg ^= mpn_toom3_eval(b1, bm1, b2, bp, k, m);
+  } else {
+    neg = 0;
+    b1 = a1;
+    bm1 = am1;
+    b2 = a2;
+  }
+
+  mpn_toom_mul_n(rp, ap, bp, k, sp);
+  mpn_toom_mul_n(rp + 4 * k, ap + 2 * k, bp + 2 * k, m, sp);
+  mpn_toom_mul_n(v1, a1, b1, k + 1, sp);
+  mpn_toom_mul_n(vm1, am1, bm1, k + 1, sp);
+  mpn_toom_mul_n(v2, a2, b2, k + 1, sp);
+
+  /* The evaluations are no longer needed. */
+  wp = a1;
+
+  /* wp = v1 + |vm1|, vm1 = v1 - |vm1| */
+  cy = mpn_add_n(wp, v1, vm1, L);
+  ASSERT_NOCARRY(cy);
+  cy = mpn_sub_n(vm1, v1, vm1, L);
+  ASSERT_NOCARRY(cy);
+
+  if (neg) {
+    c1 = wp;
+    c2 = vm1;
+  } else {
+    c1 = vm1;
+    c2 = wp;
+  }
+
+  /* c1 = s, c2 = (v1 + vm1) / 2 */
+  mpn_rshift(c1, c1, L, 1);
+  mpn_rshift(c2, c2, L, 1);
+
+  /* c2 -= v0 + vinf */
+  mpn_sub(c2, c2, L, rp, 2 * k);
+  mpn_sub(c2, c2, L, rp + 4 * k, 2 * m);
+
+  /* v2 -= v0 + 16 * vinf + 4 * c2 */
+  mpn_sub(v2, v2, L, rp, 2 * k);
+
+  v1[2 * m] = mpn_lshift(v1, rp + 4 * k, 2 * m, 4);
+  mpn_sub(v2, v2, L, v1, 2 * m + 1);
+
+  cy = mpn_lshift(v1, c2, L, 2);
+  ASSERT_NOCARRY(cy);
+  mpn_sub_n(v2, v2, v1, L);
+
+  /* c3 = (v2 / 2 - s) / 3 */
+  c3 = v2;
+
+  mpn_rshift(c3, c3, L, 1);
+  mpn_sub_n(c3, c3, c1, L);
+  mpn_divexact_by3(c3, c3, L);
+
+  /* c1 = s - c3 */
+  mpn_sub_n(c1, c1, c3, L);
+
+  /* Recompose. */
+  mpn_zero(rp + 2 * k, 2 * k);
+
+  cn = mpn_normalized_size(c1, L);
+
+  if (cn > 0)
+    mpn_add(rp + k, rp + k, 2 * n - k, c1, cn);
+
+  cn = mpn_normalized_size(c2, L);
+
+  if (cn > 0)
+    mpn_add(rp + 2 * k, rp + 2 * k, 2 * n - 2 * k, c2, cn);
+
+  cn = mpn_normalized_size(c3, L);
+
+  if (cn > 0)
+    mpn_add(rp + 3 * k, rp + 3 * k, 2 * n - 3 * k, c3, cn);
+}
+
+static void
+mpn_toom_mul_n(mp_ptr rp, mp_srcptr ap, mp_srcptr bp,
+               mp_size_t n, mp_ptr tp) {
+  if (ap == bp) {
+    if (n < MPN_SQR_TOOM22_THRESHOLD)
+      mpn_sqr_basecase(rp, ap, n);
+    else if (n < MPN_SQR_TOOM33_THRESHOLD)
+      mpn_toom22_mul_n(rp, ap, ap, n, tp);
+    else
+      mpn_toom33_mul_n(rp, ap, ap, n, tp);
+  } else {
+    if (n < MPN_MUL_TOOM22_THRESHOLD)
+      mpn_mul_basecase(rp, ap, n, bp, n);
+    else if (n < MPN_MUL_TOOM33_THRESHOLD)
+      mpn_toom22_mul_n(rp, ap, bp, n, tp);
+    else
+      mpn_toom33_mul_n(rp, ap, bp, n, tp);
+  }
+}
+
+static void
+mpn_mul_var(mp_ptr rp, mp_srcptr up, mp_size_t un,
+                       mp_srcptr vp, mp_size_t vn,
+                       mp_ptr scratch) {
+  /* MPN_MUL_VAR_ITCH(vn) limbs are required at scratch. */
+  mp_ptr xp = scratch;
+  mp_ptr tp = scratch + 2 * vn;
+  mp_size_t off;
+  mp_limb_t cy;
+
+  ASSERT(un >= vn);
+  ASSERT(vn >= 1);
+  ASSERT(!MPN_OVERLAP_P(rp, un + vn, up, un));
+  ASSERT(!MPN_OVERLAP_P(rp, un + vn, vp, vn));
+
+  if (vn < MPN_MUL_TOOM22_THRESHOLD) {
+    mpn_mul_basecase(rp, up, un, vp, vn);
+    return;
+  }
+
+  if (un == vn) {
+    mpn_toom_mul_n(rp, up, vp, vn, scratch);
+    return;
+  }
+
+  /* Unbalanced operands: multiply vn-sized
+     chunks of up[] by vp[] and accumulate. */
+  mpn_toom_mul_n(rp, up, vp, vn, tp);
+
+  for (off = vn; off + vn <= un; off += vn) {
+    mpn_toom_mul_n(xp, up + off, vp, vn, tp);
+
+    cy = mpn_add_n(rp + off, rp + off, xp, vn);
+
+    mpn_copyi(rp + off + vn, xp + vn, vn);
+    mpn_add_1(rp + off + vn, rp + off + vn, vn, cy);
+  }
+
+  if (off < un) {
+    mp_size_t rn = un - off;
+
+    /* The leftover sizes follow a Euclidean
+       remainder sequence, which sums to less
+       than 4 * vn over all recursion levels. */
+    mpn_mul_var(xp, vp, vn, up + off, rn, tp);
+
+    cy = mpn_add_n(rp + off, rp + off, xp, vn);
+
+    mpn_copyi(rp + off + vn, xp + vn, rn);
+    mpn_add_1(rp + off + vn, rp + off + vn, rn, cy);
+  }
+}
+
+static void
+mpn_sqr_var(mp_ptr rp, mp_srcptr up, mp_size_t n, mp_ptr scratch) {
+  /* MPN_TOOM_ITCH(n) limbs are required at scratch. */
+  ASSERT(n >= 1);
+  ASSERT(!MPN_OVERLAP_P(rp, 2 * n, up, n));
+
+  if (n < MPN_SQR_TOOM22_THRESHOLD)
+    mpn_sqr_basecase(rp, up, n);
+  else
+    mpn_toom_mul_n(rp, up, up, n, scratch);
+}
+
+/*
+ * Multiplication
+ */
+
+mp_limb_t
+mpn_mul(mp_ptr rp, mp_srcptr up, mp_size_t un, mp_srcptr vp, mp_size_t vn) {
+  ASSERT(un >= vn);
+  ASSERT(vn >= 1);
+  ASSERT(!MPN_OVERLAP_P(rp, un + vn, up, un));
+  ASSERT(!MPN_OVERLAP_P(rp, un + vn, vp, vn));
+
+  mpn_mul_basecase(rp, up, un, vp, vn);
+
+  return rp[un + vn - 1];
+}
+
+void
+mpn_mul_n(mp_ptr rp, mp_srcptr ap, mp_srcptr bp, mp_size_t n) {
+  mpn_mul(rp, ap, n, bp, n);
+}
+
+void
+mpn_sqr(mp_ptr rp, mp_srcptr up, mp_size_t n) {
+  ASSERT(n >= 1);
+  ASSERT(!MPN_OVERLAP_P(rp, 2 * n, up, n));
+
+  mpn_sqr_basecase(rp, up, n);
 }
 
 /*
@@ -2446,12 +2872,13 @@ mpn_jacobi_n(mp_srcptr xp, mp_srcptr yp, mp_size_t n, mp_ptr scratch) {
   return mpn_jacobi(xp, xn, yp, n, scratch);
 }
 
-void
-mpn_powm_sec(mp_ptr zp,
-             mp_srcptr xp, mp_size_t xs,
-             mp_srcptr yp, mp_size_t ys,
-             mp_srcptr mp, mp_size_t ms,
-             mp_ptr scratch) {
+static void
+mpn_powm_sec_mont(mp_ptr zp,
+                  mp_srcptr xp, mp_size_t xs,
+                  mp_srcptr yp, mp_size_t ys,
+                  mp_srcptr mp, mp_size_t ms,
+                  mp_limb_t k, mp_srcptr rr,
+                  mp_ptr scratch) {
   /* Scratch Layout:
    *
    *   up = mod_limbs
@@ -2462,12 +2889,10 @@ mpn_powm_sec(mp_ptr zp,
    *   wnds = ((1 << 4) + 1) * mod_limbs
    *   total = 24 * mod_limbs
    *
-   * Precomputation:
-   *
-   *   k = -m^-1 mod 2^limb_width
-   *   rr = 2^(2 * mod_limbs) mod m
-   *
-   * We assume the modulus is not secret.
+   * The Montgomery parameters (k, rr) are
+   * passed in by the caller. `rr` may live
+   * at the end of the window table as it is
+   * consumed before those windows are built.
    */
   mp_size_t xn = MP_ABS(xs);
   mp_size_t yn = MP_ABS(ys);
@@ -2478,21 +2903,15 @@ mpn_powm_sec(mp_ptr zp,
   mp_ptr one = &scratch[5 * mn];
   mp_ptr tmp = &scratch[6 * mn];
   mp_ptr wnds = &scratch[7 * mn];
-  mp_ptr rr = &wnds[3 * mn];
   mp_ptr wnd[1 << 4];
   mp_size_t yb = yn * MP_LIMB_BITS;
   mp_size_t start = (yb + MP_WND_WIDTH - 1) / MP_WND_WIDTH - 1;
-  mp_limb_t k, b, j;
+  mp_limb_t b, j;
   mp_size_t i, un;
 
-  if (mn == 0 || (mp[0] & 1) == 0)
-    torsion_abort(); /* LCOV_EXCL_LINE */
-
   MPN_COPY_MOD(up, un, xp, xn, mp, mn, xs);
   mpn_zero(up + un, mn - un);
 
-  mpn_mont(&k, rr, mp, mn);
-
   one[0] = 1;
   mpn_zero(one + 1, mn - 1);
 
@@ -2536,6 +2955,218 @@ mpn_powm_sec(mp_ptr zp,
   mpn_copyi(zp, z2, mn);
 }
 
+void
+mpn_powm_sec(mp_ptr zp,
+             mp_srcptr xp, mp_size_t xs,
+             mp_srcptr yp, mp_size_t ys,
+             mp_srcptr mp, mp_size_t ms,
+             mp_ptr scratch) {
+  /* Precomputation:
+   *
+   *   k = -m^-1 mod 2^limb_width
+   *   rr = 2^(2 * mod_limbs) mod m
+   *
+   * We assume the modulus is not secret.
+   */
+  mp_size_t mn = MP_ABS(ms);
+  mp_ptr rr = &scratch[10 * mn];
+  mp_limb_t k;
+
+  if (mn == 0 || (mp[0] & 1) == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  mpn_mont(&k, rr, mp, mn);
+
+  mpn_powm_sec_mont(zp, xp, xs, yp, ys, mp, ms, k, rr, scratch);
+}
+
+/*
+ * Variable-time Exponentiation
+ *
+ * Resources:
+ *   https://gmplib.org/repo/gmp-6.2/file/tip/mpn/generic/powm.c
+ *   https://gmplib.org/repo/gmp-6.2/file/tip/mpn/generic/redc_1.c
+ *
+ * Left-to-right sliding window exponentiation
+ * over Montgomery representatives. Products go
+ * through mpn_mul_n and mpn_sqr (and therefore
+ * Karatsuba/Toom-3 for large moduli) followed
+ * by a separate reduction. The running time
+ * depends on the exponent and the operands.
+ * Use mpn_powm_sec for secret exponents.
+ */
+
+static void
+mpn_redc(mp_ptr zp, mp_ptr tp, mp_srcptr mp, mp_size_t n, mp_limb_t k) {
+  /* Montgomery reduction of 2 * n limbs at tp. */
+  /* Clobbers tp. Input must be less than m * B^n. */
+  mp_limb_t cy;
+  mp_size_t i;
+
+  /* Each carry belongs at tp[i + n]. Stash it in the
+     (now zero) limb at tp[i] and add them all at once. */
+  for (i = 0; i < n; i++)
+    tp[i] = mpn_addmul_1(tp + i, mp, n, tp[i] * k);
+
+  cy = mpn_add_n(zp, tp + n, tp, n);
+
+  if (cy != 0 || mpn_cmp(zp, mp, n) >= 0)
+    mpn_sub_n(zp, zp, mp, n);
+}
+
+static void
+mpn_montmul_var(mp_ptr zp,
+                mp_srcptr xp,
+                mp_srcptr yp,
+                mp_srcptr mp,
+                mp_limb_t k,
+                mp_size_t n,
+                mp_ptr tp) {
+  /* 2 * n + MPN_TOOM_ITCH(n) limbs are required at tp. */
+  if (xp == yp)
+    mpn_sqr_var(tp, xp, n, tp + 2 * n);
+  else
+    mpn_mul_var(tp, xp, n, yp, n, tp + 2 * n);
+
+  mpn_redc(zp, tp, mp, n, k);
+}
+
+static int
+mpn_powm_width(mp_bitcnt_t bits) {
+  /* Window width by exponent length, minimizing
+     the table size plus expected multiplications. */
+  static const mp_bitcnt_t limits[MP_SLIDE_WIDTH - 1] = {
+    7, 25, 81, 241, 673, 1793
+  };
+  int w = 1;
+
+  while (w < MP_SLIDE_WIDTH && bits > limits[w - 1])
+    w++;
+
+  return w;
+}
+
+void
+mpn_powm(mp_ptr zp,
+         mp_srcptr xp, mp_size_t xs,
+         mp_srcptr yp, mp_size_t yn,
+         mp_srcptr mp, mp_size_t mn,
+         mp_ptr scratch) {
+  /* Scratch Layout:
+   *
+   *   rr = 2 * mod_limbs + 1
+   *   up = mod_limbs
+   *   z = mod_limbs
+   *   wnds = (1 << (MP_SLIDE_WIDTH - 1)) * mod_limbs
+   *   tp = 2 * mod_limbs + MPN_TOOM_ITCH(mod_limbs)
+   *   total = (6 + (1 << (MP_SLIDE_WIDTH - 1))) * mod_limbs + 1
+   *         + MPN_TOOM_ITCH(mod_limbs)
+   *
+   * The modulus must be odd and the exponent
+   * must be normalized and non-zero.
+   */
+  mp_size_t xn = MP_ABS(xs);
+  mp_ptr rr = &scratch[0];
+  mp_ptr up = &scratch[2 * mn + 1];
+  mp_ptr z = &scratch[3 * mn + 1];
+  mp_ptr wnds = &scratch[4 * mn + 1];
+  mp_ptr tp = &scratch[(4 + MP_SLIDE_SIZE) * mn + 1];
+  mp_ptr wnd[MP_SLIDE_SIZE];
+  mp_bitcnt_t bits;
+  mp_size_t i, j, un;
+  mp_limb_t k, b;
+  int w, size;
+
+  if (mn == 0 || (mp[0] & 1) == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  ASSERT(yn > 0 && yp[yn - 1] != 0);
+
+  bits = mpn_bitlen(yp, yn);
+  w = mpn_powm_width(bits);
+
+  /* Small exponents such as 65537 are sparse enough
+     that the table costs more than it saves. Fall
+     back to plain square-and-multiply for those. */
+  if (yn == 1 && w > 1) {
+    mp_limb_t t = yp[0];
+    mp_bitcnt_t weight = 0;
+
+    for (; t != 0; t &= t - 1)
+      weight++;
+
+    if (weight - 1 <= ((mp_bitcnt_t)1 << (w - 1)) + bits / (w + 1))
+      w = 1;
+  }
+
+  size = 1 << (w - 1);
+
+  for (i = 0; i < size; i++)
+    wnd[i] = &wnds[i * mn];
+
+  mpn_mont(&k, rr, mp, mn);
+
+  MPN_COPY_MOD(up, un, xp, xn, mp, mn, xs);
+  mpn_zero(up + un, mn - un);
+
+  /* wnd[i] = x^(2 * i + 1) * R mod m */
+  mpn_montmul_var(wnd[0], up, rr, mp, k, mn, tp);
+
+  if (size > 1) {
+    mpn_montmul_var(z, wnd[0], wnd[0], mp, k, mn, tp);
+
+    for (i = 1; i < size; i++)
+      mpn_montmul_var(wnd[i], wnd[i - 1], z, mp, k, mn, tp);
+  }
+
+  /* The top bit is always set, so the first
+     window initializes the accumulator. */
+  i = bits - 1;
+  j = i + 1 - w;
+
+  if (j < 0)
+    j = 0;
+
+  while (mpn_get_bit(yp, yn, j) == 0)
+    j++;
+
+  b = mpn_get_bits(yp, yn, j, i - j + 1);
+
+  mpn_copyi(z, wnd[b >> 1], mn);
+
+  i = j - 1;
+
+  while (i >= 0) {
+    if (mpn_get_bit(yp, yn, i) == 0) {
+      mpn_montmul_var(z, z, z, mp, k, mn, tp);
+      i--;
+      continue;
+    }
+
+    j = i + 1 - w;
+
+    if (j < 0)
+      j = 0;
+
+    while (mpn_get_bit(yp, yn, j) == 0)
+      j++;
+
+    b = mpn_get_bits(yp, yn, j, i - j + 1);
+
+    for (; i >= j; i--)
+      mpn_montmul_var(z, z, z, mp, k, mn, tp);
+
+    mpn_montmul_var(z, z, wnd[b >> 1], mp, k, mn, tp);
+  }
+
+  /* Convert out of the Montgomery domain. */
+  mpn_copyi(tp, z, mn);
+  mpn_zero(tp + mn, mn);
+  mpn_redc(z, tp, mp, mn, k);
+
+  mpn_copyi(zp, z, mn);
+}
+
 /*
  * Helpers
  */
@@ -4084,106 +4715,157 @@ mpz_jacobi(const mpz_t x, const mpz_t y) {
   return j;
 }
 
-void
-mpz_powm(mpz_t r, const mpz_t b, const mpz_t e, const mpz_t m) {
-  mpz_t tr;
-  mpz_t base;
-  mp_size_t en, mn;
-  mp_srcptr mp;
+static void
+mpz_powm_div(mpz_t r, const mpz_t b, const mpz_t e, const mpz_t m) {
+  /* Left-to-right binary exponentiation with
+     division-based reduction, for even moduli. */
+  mp_size_t en = MP_ABS(e->_mp_size);
+  mp_size_t mn = MP_ABS(m->_mp_size);
   struct mp_div_inverse minv;
+  mp_size_t bn, zn, tn;
+  mp_ptr scratch, zp, tp, sp, np;
+  mp_srcptr mp;
+  mp_bitcnt_t i;
   unsigned int shift;
-  mp_ptr tp = NULL;
-
-  en = MP_ABS(e->_mp_size);
-  mn = MP_ABS(m->_mp_size);
-
-  if (mn == 0)
-    torsion_abort(); /* LCOV_EXCL_LINE */
-
-  if (en == 0) {
-    mpz_set_ui(r, 1);
-    return;
-  }
+  mpz_t base;
 
   mp = m->_mp_d;
   mpn_div_qr_invert(&minv, mp, mn);
 
   shift = minv.shift;
+  np = NULL;
 
   if (shift > 0) {
     /* To avoid shifts, we do all our reductions, except
        the final one, using a *normalized* m. */
     minv.shift = 0;
 
-    tp = mp_alloc_limbs(mn);
-    ASSERT_NOCARRY(mpn_lshift(tp, mp, mn, shift));
-    mp = tp;
+    np = mp_alloc_limbs(mn);
+    ASSERT_NOCARRY(mpn_lshift(np, mp, mn, shift));
+    mp = np;
   }
 
   mpz_init(base);
+  mpz_abs(base, b);
 
-  if (e->_mp_size < 0) {
-    if (!mpz_invert(base, b, m))
-      torsion_abort(); /* LCOV_EXCL_LINE */
-  } else {
-    mp_size_t bn;
+  bn = base->_mp_size;
 
-    mpz_abs(base, b);
+  if (bn >= mn) {
+    mpn_div_qr_preinv(NULL, base->_mp_d, base->_mp_size, mp, mn, &minv);
+    bn = mn;
+  }
 
-    bn = base->_mp_size;
+  /* We have reduced the absolute value. Now take
+     care of the sign. Note that we get zero represented
+     non-canonically as m. */
+  if (b->_mp_size < 0) {
+    mp_ptr bp = MPZ_REALLOC(base, mn);
+    ASSERT_NOCARRY(mpn_sub(bp, mp, mn, bp, bn));
+    bn = mn;
+  }
 
-    if (bn >= mn) {
-      mpn_div_qr_preinv(NULL, base->_mp_d, base->_mp_size, mp, mn, &minv);
-      bn = mn;
-    }
+  bn = mpn_normalized_size(base->_mp_d, bn);
 
-    /* We have reduced the absolute value. Now take
-       care of the sign. Note that we get zero represented
-       non-canonically as m. */
-    if (b->_mp_size < 0) {
-      mp_ptr bp = MPZ_REALLOC(base, mn);
-      ASSERT_NOCARRY(mpn_sub(bp, mp, mn, bp, bn));
-      bn = mn;
-    }
+  scratch = mp_alloc_limbs(4 * mn + MPN_MUL_VAR_ITCH(mn));
+  zp = scratch;
+  tp = scratch + 2 * mn;
+  sp = scratch + 4 * mn;
+  zn = bn;
 
-    base->_mp_size = mpn_normalized_size(base->_mp_d, bn);
-  }
+  mpn_copyi(zp, base->_mp_d, bn);
+
+  i = mpn_bitlen(e->_mp_d, en) - 1;
 
-  mpz_init_set_ui(tr, 1);
+  while (i-- > 0 && zn > 0) {
+    mpn_sqr_var(tp, zp, zn, sp);
 
-  while (--en >= 0) {
-    mp_limb_t w = e->_mp_d[en];
-    mp_limb_t bit;
+    tn = mpn_normalized_size(tp, 2 * zn);
 
-    bit = MP_LIMB_HIGHBIT;
+    if (tn > mn) {
+      mpn_div_qr_preinv(NULL, tp, tn, mp, mn, &minv);
+      tn = mpn_normalized_size(tp, mn);
+    }
 
-    do {
-      mpz_mul(tr, tr, tr);
+    MP_PTR_SWAP(zp, tp);
+    zn = tn;
 
-      if (w & bit)
-        mpz_mul(tr, tr, base);
+    if (zn > 0 && mpn_get_bit(e->_mp_d, en, i)) {
+      if (zn >= bn)
+        mpn_mul_var(tp, zp, zn, base->_mp_d, bn, sp);
+      else
+        mpn_mul_var(tp, base->_mp_d, bn, zp, zn, sp);
 
-      if (tr->_mp_size > mn) {
-        mpn_div_qr_preinv(NULL, tr->_mp_d, tr->_mp_size, mp, mn, &minv);
-        tr->_mp_size = mpn_normalized_size(tr->_mp_d, mn);
+      tn = mpn_normalized_size(tp, zn + bn);
+
+      if (tn > mn) {
+        mpn_div_qr_preinv(NULL, tp, tn, mp, mn, &minv);
+        tn = mpn_normalized_size(tp, mn);
       }
 
-      bit >>= 1;
-    } while (bit > 0);
+      MP_PTR_SWAP(zp, tp);
+      zn = tn;
+    }
   }
 
   /* Final reduction */
-  if (tr->_mp_size >= mn) {
+  if (zn >= mn) {
     minv.shift = shift;
-    mpn_div_qr_preinv(NULL, tr->_mp_d, tr->_mp_size, mp, mn, &minv);
-    tr->_mp_size = mpn_normalized_size(tr->_mp_d, mn);
+    mpn_div_qr_preinv(NULL, zp, zn, mp, mn, &minv);
+    zn = mpn_normalized_size(zp, mn);
   }
 
-  if (tp)
-    mp_free_limbs(tp);
+  mpn_copyi(MPZ_REALLOC(r, mn), zp, zn);
+
+  r->_mp_size = zn;
+
+  mp_free_limbs(scratch);
+
+  if (np != NULL)
+    mp_free_limbs(np);
+
+  mpz_clear(base);
+}
+
+void
+mpz_powm(mpz_t r, const mpz_t b, const mpz_t e, const mpz_t m) {
+  mp_size_t en = MP_ABS(e->_mp_size);
+  mp_size_t mn = MP_ABS(m->_mp_size);
+  mp_ptr rp, scratch;
+  mpz_t base;
+
+  if (mn == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  if (en == 0) {
+    mpz_set_ui(r, 1);
+    return;
+  }
+
+  mpz_init(base);
+
+  if (e->_mp_size < 0) {
+    if (!mpz_invert(base, b, m))
+      torsion_abort(); /* LCOV_EXCL_LINE */
+  } else {
+    mpz_set(base, b);
+  }
+
+  if ((m->_mp_d[0] & 1) == 0) {
+    mpz_powm_div(r, base, e, m);
+  } else {
+    scratch = mp_alloc_limbs(MPN_POWM_ITCH(mn));
+    rp = MPZ_REALLOC(r, mn);
+
+    mpn_powm(rp, base->_mp_d, base->_mp_size,
+                 e->_mp_d, en,
+                 m->_mp_d, mn,
+                 scratch);
+
+    r->_mp_size = mpn_normalized_size(rp, mn);
+
+    mp_free_limbs(scratch);
+  }
 
-  mpz_swap(r, tr);
-  mpz_clear(tr);
   mpz_clear(base);
 }
 
@@ -4219,6 +4901,70 @@ mpz_powm_sec(mpz_ptr r, mpz_srcptr b, mpz_srcptr e, mpz_srcptr m) {
   mp_free_limbs(scratch);
 }
 
+/*
+ * Montgomery Context
+ */
+
+void
+mpz_mont_init(mpz_mont_t *ctx, mpz_srcptr m) {
+  mp_size_t mn = MP_ABS(m->_mp_size);
+  mp_ptr rp;
+
+  if (mn == 0 || (m->_mp_d[0] & 1) == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  rp = mp_alloc_limbs(mn * 2 + 1);
+
+  mpn_mont(&ctx->k, rp, m->_mp_d, mn);
+
+  ctx->rr = mp_realloc_limbs(rp, mn);
+  ctx->size = mn;
+}
+
+void
+mpz_mont_clear(mpz_mont_t *ctx) {
+  mp_free_limbs(ctx->rr);
+
+  ctx->k = 0;
+  ctx->rr = NULL;
+  ctx->size = 0;
+}
+
+void
+mpz_powm_sec_mont(mpz_ptr r,
+                  mpz_srcptr b,
+                  mpz_srcptr e,
+                  mpz_srcptr m,
+                  const mpz_mont_t *ctx) {
+  /* Identical to mpz_powm_sec, but skips
+     the Montgomery setup for a modulus
+     which is used repeatedly. */
+  mp_ptr rp, scratch;
+  mp_size_t mn, itch;
+
+  if (e->_mp_size <= 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  mn = MP_ABS(m->_mp_size);
+
+  if (mn == 0 || mn != ctx->size)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  itch = MPN_POWM_SEC_ITCH(mn);
+  scratch = mp_alloc_limbs(itch);
+  rp = MPZ_REALLOC(r, mn);
+
+  mpn_powm_sec_mont(rp, b->_mp_d, b->_mp_size,
+                        e->_mp_d, e->_mp_size,
+                        m->_mp_d, m->_mp_size,
+                        ctx->k, ctx->rr,
+                        scratch);
+
+  r->_mp_size = mpn_normalized_size(rp, mn);
+
+  mp_free_limbs(scratch);
+}
+
 /*
  * Primality Testing
  */
@@ -4536,71 +5282,147 @@ mpz_is_prime(const mpz_t p, unsigned long rounds, mp_rng_f *rng, void *arg) {
   return 1;
 }
 
-void
-mpz_random_prime(mpz_t ret, mp_bitcnt_t bits, mp_rng_f *rng, void *arg) {
-  static const uint64_t primes[15] =
-    { 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53 };
-#if MP_LIMB_BITS == 32
-  static const mp_limb_t limbs[2] = {MP_LIMB_C(0x30e94e1d),
-                                     MP_LIMB_C(0xe221f97c)};
-  static const mpz_t product = {{0, 2, (mp_ptr)limbs}};
-  mpz_t tmp;
-#else
-  /* Primes Product: 16294579238595022365 */
-  static const mp_limb_t product = MP_LIMB_C(0xe221f97c30e94e1d);
-#endif
-  uint64_t mod, delta, m, p;
+/*
+ * Prime Sieving
+ *
+ * Both searches accept an optional `stop` flag so
+ * that several threads can race for one result. The
+ * flag is read with torsion_atomic_load before every
+ * primality test; once it is non-zero the search
+ * gives up and returns zero. A NULL flag searches
+ * until a prime is found (or, for mpz_sieve_prime,
+ * until `limit` runs out).
+ */
+
+/* Odd primes below 1024. */
+static const uint16_t mp_sieve_primes[MP_SIEVE_SIZE] = {
+  3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41,
+  43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97,
+  101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157,
+  163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227,
+  229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283,
+  293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367,
+  373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439,
+  443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509,
+  521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599,
+  601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661,
+  673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751,
+  757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829,
+  839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919,
+  929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009,
+  1013, 1019, 1021
+};
+
+int
+mpz_sieve_prime(mpz_t x,
+                const mpz_t step,
+                unsigned long limit,
+                unsigned long rounds,
+                mp_rng_f *rng,
+                void *arg,
+                const volatile int *stop) {
+  /* Search x, x + step, x + 2 * step, ... (up to `limit`
+     candidates) for a probable prime. The residues of the
+     candidate modulo every prime in the sieve are updated
+     incrementally, so only candidates without a factor
+     below 1024 are handed to the primality test.
+
+     x must be odd and larger than the sieve primes. step
+     must be even. Returns zero if no prime was found or
+     if `stop` was raised. */
+  uint16_t res[MP_SIEVE_SIZE];
+  uint16_t inc[MP_SIEVE_SIZE];
+  unsigned long k, last;
+  mpz_t t;
+  int r = 0;
   size_t i;
 
-  ASSERT(bits > 1);
+  ASSERT(mpz_odd_p(x) && mpz_bitlen(x) > 10);
+  ASSERT(mpz_even_p(step) && mpz_sgn(step) > 0);
 
-#if MP_LIMB_BITS == 32
-  mpz_init(tmp);
-#endif
+  for (i = 0; i < MP_SIEVE_SIZE; i++) {
+    res[i] = (uint16_t)mpz_rem_ui(x, mp_sieve_primes[i]);
+    inc[i] = (uint16_t)mpz_rem_ui(step, mp_sieve_primes[i]);
+  }
 
-  for (;;) {
-    mpz_random_bits(ret, bits, rng, arg);
+  mpz_init(t);
 
-    mpz_set_bit(ret, bits - 1);
-    mpz_set_bit(ret, bits - 2);
-    mpz_set_bit(ret, 0);
+  for (k = 0, last = 0; k < limit; k++) {
+    for (i = 0; i < MP_SIEVE_SIZE; i++) {
+      if (res[i] == 0)
+        break;
+    }
 
-#if MP_LIMB_BITS == 32
-    mpz_rem(tmp, ret, product);
-    mod = mpz_get_u64(tmp);
-#else
-    mod = mpz_rem_ui(ret, product);
-#endif
+    if (i == MP_SIEVE_SIZE) {
+      if (stop != NULL && torsion_atomic_load(stop))
+        break;
 
-    for (delta = 0; delta < (UINT64_C(1) << 20); delta += 2) {
-      m = mod + delta;
+      mpz_mul_ui(t, step, k - last);
+      mpz_add(x, x, t);
 
-      for (i = 0; i < sizeof(primes) / sizeof(primes[0]); i++) {
-        p = primes[i];
+      last = k;
 
-        if ((m % p) == 0 && (bits > 6 || m != p))
-          goto next;
+      if (mpz_is_prime(x, rounds, rng, arg)) {
+        r = 1;
+        break;
       }
+    }
+
+    for (i = 0; i < MP_SIEVE_SIZE; i++) {
+      res[i] += inc[i];
+
+      if (res[i] >= mp_sieve_primes[i])
+        res[i] -= mp_sieve_primes[i];
+    }
+  }
+
+  mpz_clear(t);
+
+  return r;
+}
+
+int
+mpz_random_prime(mpz_t ret,
+                 mp_bitcnt_t bits,
+                 mp_rng_f *rng,
+                 void *arg,
+                 const volatile int *stop) {
+  mpz_t step;
+  int r = 0;
+
+  ASSERT(bits > 1);
+
+  mpz_init_set_ui(step, 2);
+
+  while (stop == NULL || !torsion_atomic_load(stop)) {
+    mpz_random_bits(ret, bits, rng, arg);
+
+    mpz_set_bit(ret, bits - 1);
+    mpz_set_bit(ret, bits - 2);
+    mpz_set_bit(ret, 0);
 
-      mpz_add_ui(ret, ret, (mp_limb_t)delta);
+    /* Too small to sieve. */
+    if (bits <= 10) {
+      if (!mpz_is_prime(ret, 20, rng, arg))
+        continue;
 
+      r = 1;
       break;
-next:
-      ;
     }
 
-    if (mpz_bitlen(ret) != bits)
+    if (!mpz_sieve_prime(ret, step, 1UL << 19, 20, rng, arg, stop))
       continue;
 
-    if (!mpz_is_prime(ret, 20, rng, arg))
+    if (mpz_bitlen(ret) != bits)
       continue;
 
+    r = 1;
     break;
   }
 
-#if MP_LIMB_BITS == 32
-  mpz_clear(tmp);
-#endif
+  mpz_clear(step);
+
+  return r;
 }
 
 /*
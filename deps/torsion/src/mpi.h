@@ -89,6 +89,7 @@ extern "C" {
 #define mpn_jacobi __torsion_mpn_jacobi
 #define mpn_jacobi_n __torsion_mpn_jacobi_n
 #define mpn_powm_sec __torsion_mpn_powm_sec
+#define mpn_powm __torsion_mpn_powm
 #define mpn_normalized_size __torsion_mpn_normalized_size
 #define mpn_bitlen __torsion_mpn_bitlen
 #define mpn_ctz __torsion_mpn_ctz
@@ -163,9 +164,13 @@ extern "C" {
 #define mpz_powm __torsion_mpz_powm
 #define mpz_powm_ui __torsion_mpz_powm_ui
 #define mpz_powm_sec __torsion_mpz_powm_sec
+#define mpz_mont_init __torsion_mpz_mont_init
+#define mpz_mont_clear __torsion_mpz_mont_clear
+#define mpz_powm_sec_mont __torsion_mpz_powm_sec_mont
 #define mpz_is_prime_mr __torsion_mpz_is_prime_mr
 #define mpz_is_prime_lucas __torsion_mpz_is_prime_lucas
 #define mpz_is_prime __torsion_mpz_is_prime
+#define mpz_sieve_prime __torsion_mpz_sieve_prime
 #define mpz_random_prime __torsion_mpz_random_prime
 #define mpz_odd_p __torsion_mpz_odd_p
 #define mpz_even_p __torsion_mpz_even_p
@@ -230,6 +235,12 @@ typedef __mpz_struct mpz_t[1];
 typedef __mpz_struct *mpz_ptr;
 typedef const __mpz_struct *mpz_srcptr;
 
+typedef struct mpz_mont_s {
+  mp_limb_t k;   /* -m^-1 mod 2^limb_width */
+  mp_limb_t *rr; /* 2^(2 * mod_limbs) mod m */
+  mp_size_t size;
+} mpz_mont_t;
+
 typedef void mp_rng_f(void *out, size_t size, void *arg);
 
 /*
@@ -239,6 +250,9 @@ typedef void mp_rng_f(void *out, size_t size, void *arg);
 #define MP_WND_WIDTH 4
 #define MP_WND_SIZE (1 << MP_WND_WIDTH)
 
+#define MP_SLIDE_WIDTH 7
+#define MP_SLIDE_SIZE (1 << (MP_SLIDE_WIDTH - 1))
+
 /*
  * Itches
  */
@@ -246,6 +260,15 @@ typedef void mp_rng_f(void *out, size_t size, void *arg);
 #define MPN_INVERT_ITCH(n) (4 * ((n) + 1))
 #define MPN_JACOBI_ITCH(n) (2 * (n))
 #define MPN_POWM_SEC_ITCH(n) (7 * (n) + (MP_WND_SIZE + 1) * (n))
+#define MPN_POWM_ITCH(n) ((6 + MP_SLIDE_SIZE) * (n) + 1 + MPN_TOOM_ITCH(n))
+
+/* Toom-2 needs 4 * l + max(2 * l + 1, itch(l)) limbs
+   and Toom-3 needs 12 * (k + 1) + itch(k + 1) limbs,
+   both of which fit for n >= 32. Unbalanced products
+   need another 2 * vn for the chunk and less than
+   8 * vn for the leftover recursion. */
+#define MPN_TOOM_ITCH(n) (8 * (n) + 64)
+#define MPN_MUL_VAR_ITCH(n) (10 * (n) + MPN_TOOM_ITCH(n))
 
 /*
  * MPN Interface
@@ -355,6 +378,11 @@ void mpn_powm_sec(mp_ptr,
                   mp_srcptr, mp_size_t,
                   mp_srcptr, mp_size_t,
                   mp_ptr);
+void mpn_powm(mp_ptr,
+              mp_srcptr, mp_size_t,
+              mp_srcptr, mp_size_t,
+              mp_srcptr, mp_size_t,
+              mp_ptr);
 
 /*
  * Helpers
@@ -544,6 +572,15 @@ void mpz_powm(mpz_t, const mpz_t, const mpz_t, const mpz_t);
 void mpz_powm_ui(mpz_t, const mpz_t, mp_limb_t, const mpz_t);
 void mpz_powm_sec(mpz_ptr, mpz_srcptr, mpz_srcptr, mpz_srcptr);
 
+/*
+ * Montgomery Context
+ */
+
+void mpz_mont_init(mpz_mont_t *, mpz_srcptr);
+void mpz_mont_clear(mpz_mont_t *);
+void mpz_powm_sec_mont(mpz_ptr, mpz_srcptr, mpz_srcptr,
+                       mpz_srcptr, const mpz_mont_t *);
+
 /*
  * Primality Testing
  */
@@ -552,7 +589,10 @@ int mpz_is_prime_mr(const mpz_t, unsigned long,
                     int, mp_rng_f *, void *);
 int mpz_is_prime_lucas(const mpz_t, unsigned long);
 int mpz_is_prime(const mpz_t, unsigned long, mp_rng_f *, void *);
-void mpz_random_prime(mpz_t, mp_bitcnt_t, mp_rng_f *, void *);
+int mpz_sieve_prime(mpz_t, const mpz_t, unsigned long, unsigned long,
+                    mp_rng_f *, void *, const volatile int *);
+int mpz_random_prime(mpz_t, mp_bitcnt_t, mp_rng_f *, void *,
+                     const volatile int *);
 
 /*
  * Helpers
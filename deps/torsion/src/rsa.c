@@ -33,6 +33,10 @@
  * Constants
  */
 
+/* Number of operations a blinding pair is
+   squared for before it is regenerated. */
+#define RSA_BLIND_LIMIT 32
+
 static const unsigned char digest_info[32][24] = {
   { /* BLAKE2B160 */
     0x15, 0x30, 0x27, 0x30, 0x0f, 0x06, 0x0b, 0x2b,
@@ -218,6 +222,24 @@ typedef struct _rsa_priv_s {
   mpz_t qi;
 } rsa_priv_t;
 
+typedef struct _rsa_mont_s {
+  mpz_mont_t p;
+  mpz_mont_t q;
+} rsa_mont_t;
+
+typedef struct _rsa_blind_s {
+  drbg_t rng;
+  mpz_t b;
+  mpz_t bi;
+  unsigned int uses;
+} rsa_blind_t;
+
+struct rsa_privkey_s {
+  rsa_priv_t key;
+  rsa_mont_t mont;
+  rsa_blind_t blind;
+};
+
 /*
  * Helpers
  */
@@ -400,6 +422,74 @@ rsa_priv_export_dumb(unsigned char *out, size_t *out_len, const rsa_priv_t *k) {
   *out_len = pos;
 }
 
+static int
+rsa_priv_complete(rsa_priv_t *k, size_t bits) {
+  /* Derive the remaining key components
+   * from the primes `p` and `q` and the
+   * public exponent `e`. Fails if the pair
+   * does not satisfy our key requirements.
+   */
+  mpz_t pm1, qm1, phi, lam, tmp;
+  int r = 0;
+
+  mpz_init(pm1);
+  mpz_init(qm1);
+  mpz_init(phi);
+  mpz_init(lam);
+  mpz_init(tmp);
+
+  if (mpz_cmp(k->p, k->q) == 0)
+    goto fail;
+
+  if (mpz_cmp(k->p, k->q) < 0)
+    mpz_swap(k->p, k->q);
+
+  mpz_sub(tmp, k->p, k->q);
+
+  if (mpz_bitlen(tmp) <= (bits >> 1) - 99)
+    goto fail;
+
+  mpz_mul(k->n, k->p, k->q);
+
+  if (mpz_bitlen(k->n) != bits)
+    goto fail;
+
+  /* Euler's totient: (p - 1) * (q - 1). */
+  mpz_sub_ui(pm1, k->p, 1);
+  mpz_sub_ui(qm1, k->q, 1);
+  mpz_mul(phi, pm1, qm1);
+
+  mpz_gcd(tmp, k->e, phi);
+
+  if (mpz_cmp_ui(tmp, 1) != 0)
+    goto fail;
+
+  /* Carmichael's function: lcm(p - 1, q - 1). */
+  mpz_gcd(tmp, pm1, qm1);
+  mpz_divexact(lam, phi, tmp);
+
+  if (!mpz_invert(k->d, k->e, lam))
+    goto fail;
+
+  if (mpz_bitlen(k->d) <= ((bits + 1) >> 1))
+    goto fail;
+
+  mpz_mod(k->dp, k->d, pm1);
+  mpz_mod(k->dq, k->d, qm1);
+
+  if (!mpz_invert(k->qi, k->q, k->p))
+    goto fail;
+
+  r = 1;
+fail:
+  mpz_cleanse(pm1);
+  mpz_cleanse(qm1);
+  mpz_cleanse(phi);
+  mpz_cleanse(lam);
+  mpz_cleanse(tmp);
+  return r;
+}
+
 static int
 rsa_priv_generate(rsa_priv_t *k,
                   size_t bits, uint64_t exp,
@@ -423,7 +513,6 @@ rsa_priv_generate(rsa_priv_t *k,
    *
    * [1] https://crypto.stackexchange.com/a/29595
    */
-  mpz_t pm1, qm1, phi, lam, tmp;
   drbg_t rng;
 
   if (bits < RSA_MIN_MOD_BITS
@@ -436,70 +525,18 @@ rsa_priv_generate(rsa_priv_t *k,
 
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
-  mpz_init(pm1);
-  mpz_init(qm1);
-  mpz_init(phi);
-  mpz_init(lam);
-  mpz_init(tmp);
-
   mpz_set_u64(k->e, exp);
 
   for (;;) {
-    mpz_random_prime(k->p, (bits >> 1) + (bits & 1), drbg_rng, &rng);
-    mpz_random_prime(k->q, bits >> 1, drbg_rng, &rng);
-
-    if (mpz_cmp(k->p, k->q) == 0)
-      continue;
-
-    if (mpz_cmp(k->p, k->q) < 0)
-      mpz_swap(k->p, k->q);
+    mpz_random_prime(k->p, (bits >> 1) + (bits & 1), drbg_rng, &rng, NULL);
+    mpz_random_prime(k->q, bits >> 1, drbg_rng, &rng, NULL);
 
-    mpz_sub(tmp, k->p, k->q);
-
-    if (mpz_bitlen(tmp) <= (bits >> 1) - 99)
-      continue;
-
-    mpz_mul(k->n, k->p, k->q);
-
-    if (mpz_bitlen(k->n) != bits)
-      continue;
-
-    /* Euler's totient: (p - 1) * (q - 1). */
-    mpz_sub_ui(pm1, k->p, 1);
-    mpz_sub_ui(qm1, k->q, 1);
-    mpz_mul(phi, pm1, qm1);
-
-    mpz_gcd(tmp, k->e, phi);
-
-    if (mpz_cmp_ui(tmp, 1) != 0)
-      continue;
-
-    /* Carmichael's function: lcm(p - 1, q - 1). */
-    mpz_gcd(tmp, pm1, qm1);
-    mpz_divexact(lam, phi, tmp);
-
-    if (!mpz_invert(k->d, k->e, lam))
-      continue;
-
-    if (mpz_bitlen(k->d) <= ((bits + 1) >> 1))
-      continue;
-
-    mpz_mod(k->dp, k->d, pm1);
-    mpz_mod(k->dq, k->d, qm1);
-
-    ASSERT(mpz_invert(k->qi, k->q, k->p));
-
-    break;
+    if (rsa_priv_complete(k, bits))
+      break;
   }
 
   torsion_cleanse(&rng, sizeof(rng));
 
-  mpz_cleanse(pm1);
-  mpz_cleanse(qm1);
-  mpz_cleanse(phi);
-  mpz_cleanse(lam);
-  mpz_cleanse(tmp);
-
   return 1;
 }
 
@@ -817,8 +854,8 @@ rsa_priv_from_ned(rsa_priv_t *out,
     mpz_random_int(a, nm3, drbg_rng, &rng);
     mpz_add_ui(a, a, 2);
 
-    /* b = a^g mod n */
-    mpz_powm(b, a, g, n);
+    /* b = a^g mod n (g is derived from d) */
+    mpz_powm_sec(b, a, g, n);
 
     if (mpz_cmp_ui(b, 1) == 0 || mpz_cmp(b, nm1) == 0)
       continue;
@@ -864,130 +901,210 @@ done:
   return r;
 }
 
-static int
-rsa_priv_decrypt(const rsa_priv_t *k,
-                 unsigned char *out,
-                 const unsigned char *msg,
-                 size_t msg_len,
-                 const unsigned char *entropy) {
-  /* [RFC8017] Page 13, Section 5.1.2.
-   *           Page 15, Section 5.2.1.
+static void
+rsa_priv_crt(mpz_t m,
+             const mpz_t c,
+             const rsa_priv_t *k,
+             const rsa_mont_t *mont) {
+  /* Leverage Chinese Remainder Theorem.
+   *
+   * Computation:
+   *
+   *   mp = c^(d mod p-1) mod p
+   *   mq = c^(d mod q-1) mod q
+   *   md = (mp - mq) / q mod p
+   *   m = (md * q + mq) mod n
    */
-  mpz_t t, s, b, bi, c, m;
-#ifdef TORSION_USE_CRT
   mpz_t mp, mq, md;
-#endif
-  drbg_t rng;
-  int r = 0;
-
-  drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
-  mpz_init(t);
-  mpz_init(s);
-  mpz_init(b);
-  mpz_init(bi);
-  mpz_init(c);
-  mpz_init(m);
-#ifdef TORSION_USE_CRT
   mpz_init(mp);
   mpz_init(mq);
   mpz_init(md);
-#endif
 
-  if (mpz_sgn(k->n) <= 0 || mpz_sgn(k->d) <= 0)
-    goto fail;
+  if (mont != NULL) {
+    mpz_powm_sec_mont(mp, c, k->dp, k->p, &mont->p);
+    mpz_powm_sec_mont(mq, c, k->dq, k->q, &mont->q);
+  } else {
+    mpz_powm_sec(mp, c, k->dp, k->p);
+    mpz_powm_sec(mq, c, k->dq, k->q);
+  }
 
-  /* Ensure mpz_powm_sec works. */
-  if (mpz_sgn(k->d) <= 0 || !mpz_odd_p(k->n))
-    goto fail;
+  mpz_sub(md, mp, mq);
+  mpz_mul(md, md, k->qi);
+  mpz_mod(md, md, k->p);
 
-#ifdef TORSION_USE_CRT
-  if (mpz_sgn(k->dp) <= 0 || !mpz_odd_p(k->p))
-    goto fail;
+  mpz_mul(m, md, k->q);
+  mpz_add(m, m, mq);
+  mpz_mod(m, m, k->n);
 
-  if (mpz_sgn(k->dq) <= 0 || !mpz_odd_p(k->q))
-    goto fail;
-#endif
+  mpz_cleanse(mp);
+  mpz_cleanse(mq);
+  mpz_cleanse(md);
+}
 
-  mpz_import(c, msg, msg_len, 1);
+static void
+rsa_blind_init(rsa_blind_t *blind, const unsigned char *entropy) {
+  drbg_init(&blind->rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+  mpz_init(blind->b);
+  mpz_init(blind->bi);
+  blind->uses = 0;
+}
 
-  if (mpz_cmp(c, k->n) >= 0)
-    goto fail;
+static void
+rsa_blind_clear(rsa_blind_t *blind) {
+  torsion_cleanse(&blind->rng, sizeof(blind->rng));
+  mpz_cleanse(blind->b);
+  mpz_cleanse(blind->bi);
+  blind->uses = 0;
+}
+
+static void
+rsa_blind_generate(rsa_blind_t *blind, const rsa_priv_t *k) {
+  mpz_t t, s;
+
+  mpz_init(t);
+  mpz_init(s);
 
   /* t = n - 1 */
   mpz_sub_ui(t, k->n, 1);
 
-  /* Generate blinding factor. */
   for (;;) {
     /* s = random integer in [1,n-1] */
-    mpz_random_int(s, t, drbg_rng, &rng);
+    mpz_random_int(s, t, drbg_rng, &blind->rng);
     mpz_add_ui(s, s, 1);
 
     /* bi = s^-1 mod n */
-    if (!mpz_invert(bi, s, k->n))
+    if (!mpz_invert(blind->bi, s, k->n))
       continue;
 
-    /* b = s^e mod n */
-    mpz_powm(b, s, k->e, k->n);
+    /* b = s^e mod n (s is secret) */
+    mpz_powm_sec(blind->b, s, k->e, k->n);
 
     break;
   }
 
-  /* c = c * b mod n (blind) */
-  mpz_mul(c, c, b);
-  mpz_mod(c, c, k->n);
+  blind->uses = 0;
 
-#if defined(TORSION_USE_CRT)
-  /* Leverage Chinese Remainder Theorem.
+  mpz_cleanse(t);
+  mpz_cleanse(s);
+}
+
+static void
+rsa_blind_update(rsa_blind_t *blind, const rsa_priv_t *k) {
+  /* A blinding pair is only generated from
+   * scratch every RSA_BLIND_LIMIT uses. In
+   * between, both halves are squared:
    *
-   * Computation:
+   *   b = b^2 = (s^2)^e mod n
+   *   bi = bi^2 = (s^2)^-1 mod n
    *
-   *   mp = c^(d mod p-1) mod p
-   *   mq = c^(d mod q-1) mod q
-   *   md = (mp - mq) / q mod p
-   *   m = (md * q + mq) mod n
+   * This is the same strategy as OpenSSL's
+   * BN_BLINDING_update and saves an inversion
+   * and an exponentiation on most operations.
    */
-  mpz_powm_sec(mp, c, k->dp, k->p);
-  mpz_powm_sec(mq, c, k->dq, k->q);
-
-  mpz_sub(md, mp, mq);
-  mpz_mul(md, md, k->qi);
-  mpz_mod(md, md, k->p);
+  if (mpz_sgn(blind->b) == 0 || blind->uses >= RSA_BLIND_LIMIT) {
+    rsa_blind_generate(blind, k);
+  } else {
+    mpz_mul(blind->b, blind->b, blind->b);
+    mpz_mod(blind->b, blind->b, k->n);
 
-  mpz_mul(m, md, k->q);
-  mpz_add(m, m, mq);
-  mpz_mod(m, m, k->n);
+    mpz_mul(blind->bi, blind->bi, blind->bi);
+    mpz_mod(blind->bi, blind->bi, k->n);
+  }
 
-  mpz_powm(mp, m, k->e, k->n);
+  blind->uses += 1;
+}
 
-  if (mpz_cmp(mp, c) != 0)
-    goto fail;
+static int
+rsa_priv_decrypt(const rsa_priv_t *k,
+                 const rsa_mont_t *mont,
+                 rsa_blind_t *blind,
+                 unsigned char *out,
+                 const unsigned char *msg,
+                 size_t msg_len) {
+  /* [RFC8017] Page 13, Section 5.1.2.
+   *           Page 15, Section 5.2.1.
+   *
+   * Parsed keys carry Montgomery parameters
+   * for p and q and always take the CRT path.
+   */
+  mpz_t t, c, m;
+#ifdef TORSION_USE_CRT
+  int crt = 1;
 #else
-  /* m = c^d mod n */
-  mpz_powm_sec(m, c, k->d, k->n);
+  int crt = (mont != NULL);
 #endif
+  int r = 0;
+
+  mpz_init(t);
+  mpz_init(c);
+  mpz_init(m);
+
+  if (mpz_sgn(k->n) <= 0 || mpz_sgn(k->d) <= 0)
+    goto fail;
+
+  /* Ensure mpz_powm_sec works. */
+  if (mpz_sgn(k->d) <= 0 || !mpz_odd_p(k->n))
+    goto fail;
+
+  if (crt) {
+    if (mpz_sgn(k->dp) <= 0 || !mpz_odd_p(k->p))
+      goto fail;
+
+    if (mpz_sgn(k->dq) <= 0 || !mpz_odd_p(k->q))
+      goto fail;
+  }
+
+  mpz_import(c, msg, msg_len, 1);
+
+  if (mpz_cmp(c, k->n) >= 0)
+    goto fail;
+
+  /* Generate or refresh blinding factor. */
+  rsa_blind_update(blind, k);
+
+  /* c = c * b mod n (blind) */
+  mpz_mul(c, c, blind->b);
+  mpz_mod(c, c, k->n);
+
+  if (crt) {
+    rsa_priv_crt(m, c, k, mont);
+
+    /* Check for faults (c = m^e mod n). */
+    mpz_powm_sec(t, m, k->e, k->n);
+
+    if (mpz_cmp(t, c) != 0)
+      goto fail;
+  } else {
+    /* m = c^d mod n */
+    mpz_powm_sec(m, c, k->d, k->n);
+  }
 
   /* m = m * bi mod n (unblind) */
-  mpz_mul(m, m, bi);
+  mpz_mul(m, m, blind->bi);
   mpz_mod(m, m, k->n);
   mpz_export(out, m, mpz_bytelen(k->n), 1);
 
   r = 1;
 fail:
   mpz_cleanse(t);
-  mpz_cleanse(s);
-  mpz_cleanse(b);
-  mpz_cleanse(bi);
   mpz_cleanse(c);
   mpz_cleanse(m);
-#ifdef TORSION_USE_CRT
-  mpz_cleanse(mp);
-  mpz_cleanse(mq);
-  mpz_cleanse(md);
-#endif
   return r;
 }
 
+static void
+rsa_mont_init(rsa_mont_t *mont, const rsa_priv_t *k) {
+  mpz_mont_init(&mont->p, k->p);
+  mpz_mont_init(&mont->q, k->q);
+}
+
+static void
+rsa_mont_clear(rsa_mont_t *mont) {
+  mpz_mont_clear(&mont->p);
+  mpz_mont_clear(&mont->q);
+}
+
 /*
  * Public Key
  */
@@ -1441,23 +1558,150 @@ fail:
   return r;
 }
 
-size_t
-rsa_privkey_bits(const unsigned char *key, size_t key_len) {
-  rsa_priv_t k;
-  size_t r = 0;
+int
+rsa_prime_generate(unsigned char *out,
+                   size_t *out_len,
+                   unsigned long bits,
+                   uint64_t exp,
+                   const unsigned char *entropy,
+                   const volatile int *stop) {
+  /* Generate a single prime suitable for use
+   * as `p` or `q` with exponent `exp`. This is
+   * one half of rsa_privkey_generate, split out
+   * so the two primes can be searched for in
+   * parallel. `stop` is passed through to
+   * mpz_random_prime (see "Prime Sieving" in
+   * mpi.c).
+   */
+  mpz_t p, e, t;
+  drbg_t rng;
+  int r = 0;
 
-  rsa_priv_init(&k);
+  if (bits < (RSA_MIN_MOD_BITS >> 1)
+      || bits > ((RSA_MAX_MOD_BITS + 1) >> 1)
+      || exp < RSA_MIN_EXP
+      || exp > RSA_MAX_EXP
+      || (exp & 1) == 0) {
+    return 0;
+  }
 
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
+  drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
-  if (!rsa_priv_verify(&k))
-    goto fail;
+  mpz_init(p);
+  mpz_init(e);
+  mpz_init(t);
 
-  r = mpz_bitlen(k.n);
-fail:
-  rsa_priv_clear(&k);
-  return r;
+  mpz_set_u64(e, exp);
+
+  for (;;) {
+    if (!mpz_random_prime(p, bits, drbg_rng, &rng, stop))
+      goto fail;
+
+    /* Require gcd(e, p - 1) = 1 up front. */
+    mpz_sub_ui(t, p, 1);
+    mpz_gcd(t, t, e);
+
+    if (mpz_cmp_ui(t, 1) == 0)
+      break;
+  }
+
+  *out_len = mpz_bytelen(p);
+
+  mpz_export(out, p, *out_len, 1);
+
+  r = 1;
+fail:
+  torsion_cleanse(&rng, sizeof(rng));
+  mpz_cleanse(p);
+  mpz_cleanse(e);
+  mpz_cleanse(t);
+  return r;
+}
+
+int
+rsa_privkey_from_primes(unsigned char *out,
+                        size_t *out_len,
+                        unsigned long bits,
+                        uint64_t exp,
+                        const unsigned char *p,
+                        size_t p_len,
+                        const unsigned char *q,
+                        size_t q_len,
+                        const unsigned char *entropy) {
+  /* Assemble a private key from primes produced
+   * by rsa_prime_generate. The inputs come from
+   * the caller, so both are primality tested
+   * again before use, and the pair is subject to
+   * the same requirements as rsa_privkey_generate.
+   */
+  size_t pbits = (bits >> 1) + (bits & 1);
+  size_t qbits = bits >> 1;
+  rsa_priv_t k;
+  drbg_t rng;
+  int r = 0;
+
+  if (bits < RSA_MIN_MOD_BITS
+      || bits > RSA_MAX_MOD_BITS
+      || exp < RSA_MIN_EXP
+      || exp > RSA_MAX_EXP
+      || (exp & 1) == 0) {
+    return 0;
+  }
+
+  if (p_len > RSA_MAX_MOD_SIZE || q_len > RSA_MAX_MOD_SIZE)
+    return 0;
+
+  rsa_priv_init(&k);
+
+  mpz_import(k.p, p, p_len, 1);
+  mpz_import(k.q, q, q_len, 1);
+  mpz_set_u64(k.e, exp);
+
+  if (mpz_even_p(k.p) || mpz_even_p(k.q))
+    goto fail;
+
+  if (mpz_cmp(k.p, k.q) < 0)
+    mpz_swap(k.p, k.q);
+
+  if (mpz_bitlen(k.p) != pbits || mpz_bitlen(k.q) != qbits)
+    goto fail;
+
+  drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+
+  if (!mpz_is_prime(k.p, 20, drbg_rng, &rng))
+    goto fail;
+
+  if (!mpz_is_prime(k.q, 20, drbg_rng, &rng))
+    goto fail;
+
+  if (!rsa_priv_complete(&k, bits))
+    goto fail;
+
+  rsa_priv_export(out, out_len, &k);
+  r = 1;
+fail:
+  torsion_cleanse(&rng, sizeof(rng));
+  rsa_priv_clear(&k);
+  return r;
+}
+
+size_t
+rsa_privkey_bits(const unsigned char *key, size_t key_len) {
+  rsa_priv_t k;
+  size_t r = 0;
+
+  rsa_priv_init(&k);
+
+  if (!rsa_priv_import(&k, key, key_len))
+    goto fail;
+
+  if (!rsa_priv_verify(&k))
+    goto fail;
+
+  r = mpz_bitlen(k.n);
+fail:
+  rsa_priv_clear(&k);
+  return r;
 }
 
 int
@@ -1648,15 +1892,15 @@ fail:
   return r;
 }
 
-int
-rsa_sign(unsigned char *out,
-         size_t *out_len,
-         int type,
-         const unsigned char *msg,
-         size_t msg_len,
-         const unsigned char *key,
-         size_t key_len,
-         const unsigned char *entropy) {
+static int
+rsa_priv_sign(const rsa_priv_t *k,
+              const rsa_mont_t *mont,
+              rsa_blind_t *blind,
+              unsigned char *out,
+              size_t *out_len,
+              int type,
+              const unsigned char *msg,
+              size_t msg_len) {
   /* [RFC8017] Page 36, Section 8.2.1.
    *           Page 45, Section 9.2.
    */
@@ -1664,11 +1908,8 @@ rsa_sign(unsigned char *out,
   size_t i, prefix_len, tlen, klen;
   const unsigned char *prefix;
   unsigned char *em = out;
-  rsa_priv_t k;
   int r = 0;
 
-  rsa_priv_init(&k);
-
   if (!get_digest_info(&prefix, &prefix_len, type))
     goto fail;
 
@@ -1678,14 +1919,8 @@ rsa_sign(unsigned char *out,
   if (msg_len != hlen)
     goto fail;
 
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
   tlen = prefix_len + hlen;
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (klen < tlen + 11)
     goto fail;
@@ -1705,12 +1940,40 @@ rsa_sign(unsigned char *out,
   if (msg_len > 0)
     memcpy(em + klen - hlen, msg, msg_len);
 
-  if (!rsa_priv_decrypt(&k, out, em, klen, entropy))
+  if (!rsa_priv_decrypt(k, mont, blind, out, em, klen))
     goto fail;
 
   *out_len = klen;
   r = 1;
 fail:
+  return r;
+}
+
+int
+rsa_sign(unsigned char *out,
+         size_t *out_len,
+         int type,
+         const unsigned char *msg,
+         size_t msg_len,
+         const unsigned char *key,
+         size_t key_len,
+         const unsigned char *entropy) {
+  rsa_blind_t blind;
+  rsa_priv_t k;
+  int r = 0;
+
+  rsa_blind_init(&blind, entropy);
+  rsa_priv_init(&k);
+
+  if (!rsa_priv_import(&k, key, key_len))
+    goto fail;
+
+  if (!rsa_priv_verify(&k))
+    goto fail;
+
+  r = rsa_priv_sign(&k, NULL, &blind, out, out_len, type, msg, msg_len);
+fail:
+  rsa_blind_clear(&blind);
   rsa_priv_clear(&k);
   return r;
 }
@@ -1854,31 +2117,22 @@ fail:
   return r;
 }
 
-int
-rsa_decrypt(unsigned char *out,
-            size_t *out_len,
-            const unsigned char *msg,
-            size_t msg_len,
-            const unsigned char *key,
-            size_t key_len,
-            const unsigned char *entropy) {
+static int
+rsa_priv_decrypt_pkcs1(const rsa_priv_t *k,
+                       const rsa_mont_t *mont,
+                       rsa_blind_t *blind,
+                       unsigned char *out,
+                       size_t *out_len,
+                       const unsigned char *msg,
+                       size_t msg_len) {
   /* [RFC8017] Page 29, Section 7.2.2. */
   unsigned char *em = out;
   uint32_t i, zero, two, index, looking;
   uint32_t equals0, validps, valid, offset;
   size_t klen = 0;
-  rsa_priv_t k;
   int r = 0;
 
-  rsa_priv_init(&k);
-
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (msg_len != klen)
     goto fail;
@@ -1886,7 +2140,7 @@ rsa_decrypt(unsigned char *out,
   if (klen < 11)
     goto fail;
 
-  if (!rsa_priv_decrypt(&k, em, msg, msg_len, entropy))
+  if (!rsa_priv_decrypt(k, mont, blind, em, msg, msg_len))
     goto fail;
 
   /* EM = 0x00 || 0x02 || PS || 0x00 || M */
@@ -1913,46 +2167,63 @@ rsa_decrypt(unsigned char *out,
 
   r = 1;
 fail:
-  rsa_priv_clear(&k);
   if (r == 0) torsion_cleanse(out, klen);
   return r;
 }
 
 int
-rsa_sign_pss(unsigned char *out,
-             size_t *out_len,
-             int type,
-             const unsigned char *msg,
-             size_t msg_len,
-             const unsigned char *key,
-             size_t key_len,
-             int salt_len,
-             const unsigned char *entropy) {
+rsa_decrypt(unsigned char *out,
+            size_t *out_len,
+            const unsigned char *msg,
+            size_t msg_len,
+            const unsigned char *key,
+            size_t key_len,
+            const unsigned char *entropy) {
+  rsa_blind_t blind;
+  rsa_priv_t k;
+  int r = 0;
+
+  rsa_blind_init(&blind, entropy);
+  rsa_priv_init(&k);
+
+  if (!rsa_priv_import(&k, key, key_len))
+    goto fail;
+
+  if (!rsa_priv_verify(&k))
+    goto fail;
+
+  r = rsa_priv_decrypt_pkcs1(&k, NULL, &blind, out, out_len, msg, msg_len);
+fail:
+  rsa_blind_clear(&blind);
+  rsa_priv_clear(&k);
+  return r;
+}
+
+static int
+rsa_priv_sign_pss(const rsa_priv_t *k,
+                  const rsa_mont_t *mont,
+                  rsa_blind_t *blind,
+                  unsigned char *out,
+                  size_t *out_len,
+                  int type,
+                  const unsigned char *msg,
+                  size_t msg_len,
+                  int salt_len) {
   /* [RFC8017] Page 33, Section 8.1.1. */
   size_t hlen = hash_output_size(type);
   unsigned char *salt = NULL;
   unsigned char *em = out;
   size_t emlen, bits;
   size_t klen = 0;
-  rsa_priv_t k;
-  drbg_t rng;
   int r = 0;
 
-  rsa_priv_init(&k);
-
   if (!hash_has_backend(type))
     goto fail;
 
   if (msg_len != hlen)
     goto fail;
 
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
-  bits = mpz_bitlen(k.n);
+  bits = mpz_bitlen(k->n);
   klen = (bits + 7) / 8;
   emlen = (bits + 6) / 8;
 
@@ -1975,8 +2246,7 @@ rsa_sign_pss(unsigned char *out,
       goto fail;
   }
 
-  drbg_init(&rng, HASH_SHA512, entropy, ENTROPY_SIZE);
-  drbg_generate(&rng, salt, salt_len);
+  drbg_generate(&blind->rng, salt, salt_len);
 
   if (!pss_encode(em, &emlen, type, msg, msg_len, bits - 1, salt, salt_len))
     goto fail;
@@ -1985,19 +2255,48 @@ rsa_sign_pss(unsigned char *out,
    * than the modulus size in the case
    * of (bits - 1) mod 8 == 0.
    */
-  if (!rsa_priv_decrypt(&k, out, em, emlen, entropy))
+  if (!rsa_priv_decrypt(k, mont, blind, out, em, emlen))
     goto fail;
 
   *out_len = klen;
   r = 1;
 fail:
-  rsa_priv_clear(&k);
-  torsion_cleanse(&rng, sizeof(rng));
   if (salt != NULL) free(salt);
   if (r == 0) torsion_cleanse(out, klen);
   return r;
 }
 
+int
+rsa_sign_pss(unsigned char *out,
+             size_t *out_len,
+             int type,
+             const unsigned char *msg,
+             size_t msg_len,
+             const unsigned char *key,
+             size_t key_len,
+             int salt_len,
+             const unsigned char *entropy) {
+  rsa_blind_t blind;
+  rsa_priv_t k;
+  int r = 0;
+
+  rsa_blind_init(&blind, entropy);
+  rsa_priv_init(&k);
+
+  if (!rsa_priv_import(&k, key, key_len))
+    goto fail;
+
+  if (!rsa_priv_verify(&k))
+    goto fail;
+
+  r = rsa_priv_sign_pss(&k, NULL, &blind, out, out_len, type,
+                        msg, msg_len, salt_len);
+fail:
+  rsa_blind_clear(&blind);
+  rsa_priv_clear(&k);
+  return r;
+}
+
 int
 rsa_verify_pss(int type,
                const unsigned char *msg,
@@ -2157,17 +2456,17 @@ fail:
   return r;
 }
 
-int
-rsa_decrypt_oaep(unsigned char *out,
-                 size_t *out_len,
-                 int type,
-                 const unsigned char *msg,
-                 size_t msg_len,
-                 const unsigned char *key,
-                 size_t key_len,
-                 const unsigned char *label,
-                 size_t label_len,
-                 const unsigned char *entropy) {
+static int
+rsa_priv_decrypt_oaep(const rsa_priv_t *k,
+                      const rsa_mont_t *mont,
+                      rsa_blind_t *blind,
+                      unsigned char *out,
+                      size_t *out_len,
+                      int type,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *label,
+                      size_t label_len) {
   /* [RFC8017] Page 25, Section 7.1.2. */
   unsigned char *em = out;
   unsigned char *seed, *db, *rest, *lhash;
@@ -2177,22 +2476,13 @@ rsa_decrypt_oaep(unsigned char *out,
   uint32_t zero, lvalid, looking, index;
   uint32_t invalid, valid, equals0, equals1;
   unsigned char expect[HASH_MAX_OUTPUT_SIZE];
-  rsa_priv_t k;
   hash_t hash;
   int r = 0;
 
-  rsa_priv_init(&k);
-
   if (!hash_has_backend(type))
     goto fail;
 
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (msg_len != klen)
     goto fail;
@@ -2200,7 +2490,7 @@ rsa_decrypt_oaep(unsigned char *out,
   if (klen < hlen * 2 + 2)
     goto fail;
 
-  if (!rsa_priv_decrypt(&k, em, msg, msg_len, entropy))
+  if (!rsa_priv_decrypt(k, mont, blind, em, msg, msg_len))
     goto fail;
 
   hash_init(&hash, type);
@@ -2244,12 +2534,43 @@ rsa_decrypt_oaep(unsigned char *out,
 
   r = 1;
 fail:
-  rsa_priv_clear(&k);
   torsion_cleanse(&hash, sizeof(hash));
   if (r == 0) torsion_cleanse(out, klen);
   return r;
 }
 
+int
+rsa_decrypt_oaep(unsigned char *out,
+                 size_t *out_len,
+                 int type,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 const unsigned char *key,
+                 size_t key_len,
+                 const unsigned char *label,
+                 size_t label_len,
+                 const unsigned char *entropy) {
+  rsa_blind_t blind;
+  rsa_priv_t k;
+  int r = 0;
+
+  rsa_blind_init(&blind, entropy);
+  rsa_priv_init(&k);
+
+  if (!rsa_priv_import(&k, key, key_len))
+    goto fail;
+
+  if (!rsa_priv_verify(&k))
+    goto fail;
+
+  r = rsa_priv_decrypt_oaep(&k, NULL, &blind, out, out_len, type,
+                            msg, msg_len, label, label_len);
+fail:
+  rsa_blind_clear(&blind);
+  rsa_priv_clear(&k);
+  return r;
+}
+
 int
 rsa_veil(unsigned char *out,
          size_t *out_len,
@@ -2319,3 +2640,107 @@ fail:
   rsa_pub_clear(&k);
   return r;
 }
+
+/*
+ * Parsed Keys
+ */
+
+rsa_privkey_t *
+rsa_privkey_parse(const unsigned char *key,
+                  size_t key_len,
+                  const unsigned char *entropy) {
+  /* A parsed key is imported and verified once
+   * and holds the Montgomery parameters for both
+   * primes. Operations on it always use the CRT.
+   *
+   * It also owns a DRBG and a blinding pair which
+   * is refreshed by squaring between operations.
+   * As a result, a parsed key must not be used by
+   * more than one thread at a time.
+   */
+  rsa_privkey_t *ctx = malloc(sizeof(rsa_privkey_t));
+
+  if (ctx == NULL)
+    return NULL;
+
+  rsa_priv_init(&ctx->key);
+  rsa_blind_init(&ctx->blind, entropy);
+
+  if (!rsa_priv_import(&ctx->key, key, key_len))
+    goto fail;
+
+  if (!rsa_priv_verify(&ctx->key))
+    goto fail;
+
+  rsa_mont_init(&ctx->mont, &ctx->key);
+  rsa_blind_generate(&ctx->blind, &ctx->key);
+
+  return ctx;
+fail:
+  rsa_blind_clear(&ctx->blind);
+  rsa_priv_clear(&ctx->key);
+  free(ctx);
+  return NULL;
+}
+
+void
+rsa_privkey_destroy(rsa_privkey_t *key) {
+  if (key != NULL) {
+    rsa_blind_clear(&key->blind);
+    rsa_mont_clear(&key->mont);
+    rsa_priv_clear(&key->key);
+    free(key);
+  }
+}
+
+size_t
+rsa_privkey_parsed_bits(const rsa_privkey_t *key) {
+  return mpz_bitlen(key->key.n);
+}
+
+int
+rsa_sign_parsed(unsigned char *out,
+                size_t *out_len,
+                int type,
+                const unsigned char *msg,
+                size_t msg_len,
+                rsa_privkey_t *key) {
+  return rsa_priv_sign(&key->key, &key->mont, &key->blind,
+                       out, out_len, type, msg, msg_len);
+}
+
+int
+rsa_decrypt_parsed(unsigned char *out,
+                   size_t *out_len,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   rsa_privkey_t *key) {
+  return rsa_priv_decrypt_pkcs1(&key->key, &key->mont, &key->blind,
+                                out, out_len, msg, msg_len);
+}
+
+int
+rsa_sign_pss_parsed(unsigned char *out,
+                    size_t *out_len,
+                    int type,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    rsa_privkey_t *key,
+                    int salt_len) {
+  return rsa_priv_sign_pss(&key->key, &key->mont, &key->blind,
+                           out, out_len, type, msg, msg_len, salt_len);
+}
+
+int
+rsa_decrypt_oaep_parsed(unsigned char *out,
+                        size_t *out_len,
+                        int type,
+                        const unsigned char *msg,
+                        size_t msg_len,
+                        rsa_privkey_t *key,
+                        const unsigned char *label,
+                        size_t label_len) {
+  return rsa_priv_decrypt_oaep(&key->key, &key->mont, &key->blind,
+                               out, out_len, type, msg, msg_len,
+                               label, label_len);
+}
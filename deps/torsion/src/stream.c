@@ -11,6 +11,7 @@
 #include <torsion/util.h>
 #include "bio.h"
 #include "internal.h"
+#include "entropy/entropy.h"
 
 /*
  * ARC4
@@ -86,6 +87,7 @@ arc4_crypt(arc4_t *ctx,
  *   https://en.wikipedia.org/wiki/Chacha20
  *   https://tools.ietf.org/html/rfc7539#section-2
  *   https://cr.yp.to/chacha.html
+ *   https://eprint.iacr.org/2013/759.pdf
  */
 
 #define ROTL32(x, y) ((x) << (y)) | ((x) >> (32 - (y)))
@@ -299,15 +301,802 @@ chacha20_block(chacha20_t *ctx, uint32_t *stream) {
 #endif
 }
 
+#if defined(TORSION_HAVE_ASM_X64)
+static void
+chacha20_blocks4(chacha20_t *ctx,
+                 unsigned char *dst,
+                 const unsigned char *src,
+                 size_t groups) {
+  /* Four blocks at a time with SSE2. Every register
+   * holds one state word for all four blocks[1]. The
+   * third row is kept in memory as we are otherwise
+   * short on registers.
+   *
+   * Buffer layout:
+   *
+   *   0-255 = initial state (each word broadcast)
+   *   256-319 = third row
+   *   320-335 = counter increment
+   *
+   * Registers:
+   *
+   *   %[b] = buffer pointer
+   *   %[s] = src pointer
+   *   %[d] = dst pointer
+   *   %[n] = group counter
+   *   %[r] = round counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %xmm[0-15]
+   *
+   * [1] https://eprint.iacr.org/2013/759.pdf
+   */
+  uint32_t buf[84];
+  uint64_t n = groups;
+  uint32_t r;
+  int i, j;
+
+  for (i = 0; i < 16; i++) {
+    for (j = 0; j < 4; j++)
+      buf[i * 4 + j] = ctx->state[i] + (i == 12 ? j : 0);
+  }
+
+  for (j = 0; j < 4; j++)
+    buf[80 + j] = 4;
+
+  __asm__ __volatile__(
+    "1:\n"
+    "movdqu 0(%[b]), %%xmm0\n"
+    "movdqu 16(%[b]), %%xmm1\n"
+    "movdqu 32(%[b]), %%xmm2\n"
+    "movdqu 48(%[b]), %%xmm3\n"
+    "movdqu 64(%[b]), %%xmm4\n"
+    "movdqu 80(%[b]), %%xmm5\n"
+    "movdqu 96(%[b]), %%xmm6\n"
+    "movdqu 112(%[b]), %%xmm7\n"
+    "movdqu 192(%[b]), %%xmm8\n"
+    "movdqu 208(%[b]), %%xmm9\n"
+    "movdqu 224(%[b]), %%xmm10\n"
+    "movdqu 240(%[b]), %%xmm11\n"
+    "movdqu 128(%[b]), %%xmm12\n"
+    "movdqu %%xmm12, 256(%[b])\n"
+    "movdqu 144(%[b]), %%xmm12\n"
+    "movdqu %%xmm12, 272(%[b])\n"
+    "movdqu 160(%[b]), %%xmm12\n"
+    "movdqu %%xmm12, 288(%[b])\n"
+    "movdqu 176(%[b]), %%xmm12\n"
+    "movdqu %%xmm12, 304(%[b])\n"
+    "movl $10, %k[r]\n"
+    "2:\n"
+    "movdqu 256(%[b]), %%xmm12\n"
+    "movdqu 272(%[b]), %%xmm13\n"
+    "paddd %%xmm4, %%xmm0\n"
+    "pxor %%xmm0, %%xmm8\n"
+    "pshuflw $0xb1, %%xmm8, %%xmm8\n"
+    "pshufhw $0xb1, %%xmm8, %%xmm8\n"
+    "paddd %%xmm5, %%xmm1\n"
+    "pxor %%xmm1, %%xmm9\n"
+    "pshuflw $0xb1, %%xmm9, %%xmm9\n"
+    "pshufhw $0xb1, %%xmm9, %%xmm9\n"
+    "paddd %%xmm8, %%xmm12\n"
+    "pxor %%xmm12, %%xmm4\n"
+    "movdqa %%xmm4, %%xmm14\n"
+    "pslld $12, %%xmm4\n"
+    "psrld $20, %%xmm14\n"
+    "por %%xmm14, %%xmm4\n"
+    "paddd %%xmm9, %%xmm13\n"
+    "pxor %%xmm13, %%xmm5\n"
+    "movdqa %%xmm5, %%xmm15\n"
+    "pslld $12, %%xmm5\n"
+    "psrld $20, %%xmm15\n"
+    "por %%xmm15, %%xmm5\n"
+    "paddd %%xmm4, %%xmm0\n"
+    "pxor %%xmm0, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm14\n"
+    "pslld $8, %%xmm8\n"
+    "psrld $24, %%xmm14\n"
+    "por %%xmm14, %%xmm8\n"
+    "paddd %%xmm5, %%xmm1\n"
+    "pxor %%xmm1, %%xmm9\n"
+    "movdqa %%xmm9, %%xmm15\n"
+    "pslld $8, %%xmm9\n"
+    "psrld $24, %%xmm15\n"
+    "por %%xmm15, %%xmm9\n"
+    "paddd %%xmm8, %%xmm12\n"
+    "pxor %%xmm12, %%xmm4\n"
+    "movdqa %%xmm4, %%xmm14\n"
+    "pslld $7, %%xmm4\n"
+    "psrld $25, %%xmm14\n"
+    "por %%xmm14, %%xmm4\n"
+    "paddd %%xmm9, %%xmm13\n"
+    "pxor %%xmm13, %%xmm5\n"
+    "movdqa %%xmm5, %%xmm15\n"
+    "pslld $7, %%xmm5\n"
+    "psrld $25, %%xmm15\n"
+    "por %%xmm15, %%xmm5\n"
+    "movdqu %%xmm12, 256(%[b])\n"
+    "movdqu %%xmm13, 272(%[b])\n"
+    "movdqu 288(%[b]), %%xmm12\n"
+    "movdqu 304(%[b]), %%xmm13\n"
+    "paddd %%xmm6, %%xmm2\n"
+    "pxor %%xmm2, %%xmm10\n"
+    "pshuflw $0xb1, %%xmm10, %%xmm10\n"
+    "pshufhw $0xb1, %%xmm10, %%xmm10\n"
+    "paddd %%xmm7, %%xmm3\n"
+    "pxor %%xmm3, %%xmm11\n"
+    "pshuflw $0xb1, %%xmm11, %%xmm11\n"
+    "pshufhw $0xb1, %%xmm11, %%xmm11\n"
+    "paddd %%xmm10, %%xmm12\n"
+    "pxor %%xmm12, %%xmm6\n"
+    "movdqa %%xmm6, %%xmm14\n"
+    "pslld $12, %%xmm6\n"
+    "psrld $20, %%xmm14\n"
+    "por %%xmm14, %%xmm6\n"
+    "paddd %%xmm11, %%xmm13\n"
+    "pxor %%xmm13, %%xmm7\n"
+    "movdqa %%xmm7, %%xmm15\n"
+    "pslld $12, %%xmm7\n"
+    "psrld $20, %%xmm15\n"
+    "por %%xmm15, %%xmm7\n"
+    "paddd %%xmm6, %%xmm2\n"
+    "pxor %%xmm2, %%xmm10\n"
+    "movdqa %%xmm10, %%xmm14\n"
+    "pslld $8, %%xmm10\n"
+    "psrld $24, %%xmm14\n"
+    "por %%xmm14, %%xmm10\n"
+    "paddd %%xmm7, %%xmm3\n"
+    "pxor %%xmm3, %%xmm11\n"
+    "movdqa %%xmm11, %%xmm15\n"
+    "pslld $8, %%xmm11\n"
+    "psrld $24, %%xmm15\n"
+    "por %%xmm15, %%xmm11\n"
+    "paddd %%xmm10, %%xmm12\n"
+    "pxor %%xmm12, %%xmm6\n"
+    "movdqa %%xmm6, %%xmm14\n"
+    "pslld $7, %%xmm6\n"
+    "psrld $25, %%xmm14\n"
+    "por %%xmm14, %%xmm6\n"
+    "paddd %%xmm11, %%xmm13\n"
+    "pxor %%xmm13, %%xmm7\n"
+    "movdqa %%xmm7, %%xmm15\n"
+    "pslld $7, %%xmm7\n"
+    "psrld $25, %%xmm15\n"
+    "por %%xmm15, %%xmm7\n"
+    "movdqu %%xmm12, 288(%[b])\n"
+    "movdqu %%xmm13, 304(%[b])\n"
+    "movdqu 288(%[b]), %%xmm12\n"
+    "movdqu 304(%[b]), %%xmm13\n"
+    "paddd %%xmm5, %%xmm0\n"
+    "pxor %%xmm0, %%xmm11\n"
+    "pshuflw $0xb1, %%xmm11, %%xmm11\n"
+    "pshufhw $0xb1, %%xmm11, %%xmm11\n"
+    "paddd %%xmm6, %%xmm1\n"
+    "pxor %%xmm1, %%xmm8\n"
+    "pshuflw $0xb1, %%xmm8, %%xmm8\n"
+    "pshufhw $0xb1, %%xmm8, %%xmm8\n"
+    "paddd %%xmm11, %%xmm12\n"
+    "pxor %%xmm12, %%xmm5\n"
+    "movdqa %%xmm5, %%xmm14\n"
+    "pslld $12, %%xmm5\n"
+    "psrld $20, %%xmm14\n"
+    "por %%xmm14, %%xmm5\n"
+    "paddd %%xmm8, %%xmm13\n"
+    "pxor %%xmm13, %%xmm6\n"
+    "movdqa %%xmm6, %%xmm15\n"
+    "pslld $12, %%xmm6\n"
+    "psrld $20, %%xmm15\n"
+    "por %%xmm15, %%xmm6\n"
+    "paddd %%xmm5, %%xmm0\n"
+    "pxor %%xmm0, %%xmm11\n"
+    "movdqa %%xmm11, %%xmm14\n"
+    "pslld $8, %%xmm11\n"
+    "psrld $24, %%xmm14\n"
+    "por %%xmm14, %%xmm11\n"
+    "paddd %%xmm6, %%xmm1\n"
+    "pxor %%xmm1, %%xmm8\n"
+    "movdqa %%xmm8, %%xmm15\n"
+    "pslld $8, %%xmm8\n"
+    "psrld $24, %%xmm15\n"
+    "por %%xmm15, %%xmm8\n"
+    "paddd %%xmm11, %%xmm12\n"
+    "pxor %%xmm12, %%xmm5\n"
+    "movdqa %%xmm5, %%xmm14\n"
+    "pslld $7, %%xmm5\n"
+    "psrld $25, %%xmm14\n"
+    "por %%xmm14, %%xmm5\n"
+    "paddd %%xmm8, %%xmm13\n"
+    "pxor %%xmm13, %%xmm6\n"
+    "movdqa %%xmm6, %%xmm15\n"
+    "pslld $7, %%xmm6\n"
+    "psrld $25, %%xmm15\n"
+    "por %%xmm15, %%xmm6\n"
+    "movdqu %%xmm12, 288(%[b])\n"
+    "movdqu %%xmm13, 304(%[b])\n"
+    "movdqu 256(%[b]), %%xmm12\n"
+    "movdqu 272(%[b]), %%xmm13\n"
+    "paddd %%xmm7, %%xmm2\n"
+    "pxor %%xmm2, %%xmm9\n"
+    "pshuflw $0xb1, %%xmm9, %%xmm9\n"
+    "pshufhw $0xb1, %%xmm9, %%xmm9\n"
+    "paddd %%xmm4, %%xmm3\n"
+    "pxor %%xmm3, %%xmm10\n"
+    "pshuflw $0xb1, %%xmm10, %%xmm10\n"
+    "pshufhw $0xb1, %%xmm10, %%xmm10\n"
+    "paddd %%xmm9, %%xmm12\n"
+    "pxor %%xmm12, %%xmm7\n"
+    "movdqa %%xmm7, %%xmm14\n"
+    "pslld $12, %%xmm7\n"
+    "psrld $20, %%xmm14\n"
+    "por %%xmm14, %%xmm7\n"
+    "paddd %%xmm10, %%xmm13\n"
+    "pxor %%xmm13, %%xmm4\n"
+    "movdqa %%xmm4, %%xmm15\n"
+    "pslld $12, %%xmm4\n"
+    "psrld $20, %%xmm15\n"
+    "por %%xmm15, %%xmm4\n"
+    "paddd %%xmm7, %%xmm2\n"
+    "pxor %%xmm2, %%xmm9\n"
+    "movdqa %%xmm9, %%xmm14\n"
+    "pslld $8, %%xmm9\n"
+    "psrld $24, %%xmm14\n"
+    "por %%xmm14, %%xmm9\n"
+    "paddd %%xmm4, %%xmm3\n"
+    "pxor %%xmm3, %%xmm10\n"
+    "movdqa %%xmm10, %%xmm15\n"
+    "pslld $8, %%xmm10\n"
+    "psrld $24, %%xmm15\n"
+    "por %%xmm15, %%xmm10\n"
+    "paddd %%xmm9, %%xmm12\n"
+    "pxor %%xmm12, %%xmm7\n"
+    "movdqa %%xmm7, %%xmm14\n"
+    "pslld $7, %%xmm7\n"
+    "psrld $25, %%xmm14\n"
+    "por %%xmm14, %%xmm7\n"
+    "paddd %%xmm10, %%xmm13\n"
+    "pxor %%xmm13, %%xmm4\n"
+    "movdqa %%xmm4, %%xmm15\n"
+    "pslld $7, %%xmm4\n"
+    "psrld $25, %%xmm15\n"
+    "por %%xmm15, %%xmm4\n"
+    "movdqu %%xmm12, 256(%[b])\n"
+    "movdqu %%xmm13, 272(%[b])\n"
+    "decl %k[r]\n"
+    "jnz 2b\n"
+    "movdqu 0(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm0\n"
+    "movdqu 16(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm1\n"
+    "movdqu 32(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm2\n"
+    "movdqu 48(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm3\n"
+    "movdqu 64(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm4\n"
+    "movdqu 80(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm5\n"
+    "movdqu 96(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm6\n"
+    "movdqu 112(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm7\n"
+    "movdqu 192(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm8\n"
+    "movdqu 208(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm9\n"
+    "movdqu 224(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm10\n"
+    "movdqu 240(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm11\n"
+    "movdqa %%xmm0, %%xmm14\n"
+    "punpckldq %%xmm1, %%xmm0\n"
+    "punpckhdq %%xmm1, %%xmm14\n"
+    "movdqa %%xmm2, %%xmm15\n"
+    "punpckldq %%xmm3, %%xmm2\n"
+    "punpckhdq %%xmm3, %%xmm15\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "punpcklqdq %%xmm2, %%xmm0\n"
+    "punpckhqdq %%xmm2, %%xmm1\n"
+    "movdqa %%xmm14, %%xmm3\n"
+    "punpcklqdq %%xmm15, %%xmm14\n"
+    "punpckhqdq %%xmm15, %%xmm3\n"
+    "movdqu 0(%[s]), %%xmm2\n"
+    "pxor %%xmm0, %%xmm2\n"
+    "movdqu %%xmm2, 0(%[d])\n"
+    "movdqu 64(%[s]), %%xmm2\n"
+    "pxor %%xmm1, %%xmm2\n"
+    "movdqu %%xmm2, 64(%[d])\n"
+    "movdqu 128(%[s]), %%xmm2\n"
+    "pxor %%xmm14, %%xmm2\n"
+    "movdqu %%xmm2, 128(%[d])\n"
+    "movdqu 192(%[s]), %%xmm2\n"
+    "pxor %%xmm3, %%xmm2\n"
+    "movdqu %%xmm2, 192(%[d])\n"
+    "movdqa %%xmm4, %%xmm14\n"
+    "punpckldq %%xmm5, %%xmm4\n"
+    "punpckhdq %%xmm5, %%xmm14\n"
+    "movdqa %%xmm6, %%xmm15\n"
+    "punpckldq %%xmm7, %%xmm6\n"
+    "punpckhdq %%xmm7, %%xmm15\n"
+    "movdqa %%xmm4, %%xmm5\n"
+    "punpcklqdq %%xmm6, %%xmm4\n"
+    "punpckhqdq %%xmm6, %%xmm5\n"
+    "movdqa %%xmm14, %%xmm7\n"
+    "punpcklqdq %%xmm15, %%xmm14\n"
+    "punpckhqdq %%xmm15, %%xmm7\n"
+    "movdqu 16(%[s]), %%xmm6\n"
+    "pxor %%xmm4, %%xmm6\n"
+    "movdqu %%xmm6, 16(%[d])\n"
+    "movdqu 80(%[s]), %%xmm6\n"
+    "pxor %%xmm5, %%xmm6\n"
+    "movdqu %%xmm6, 80(%[d])\n"
+    "movdqu 144(%[s]), %%xmm6\n"
+    "pxor %%xmm14, %%xmm6\n"
+    "movdqu %%xmm6, 144(%[d])\n"
+    "movdqu 208(%[s]), %%xmm6\n"
+    "pxor %%xmm7, %%xmm6\n"
+    "movdqu %%xmm6, 208(%[d])\n"
+    "movdqa %%xmm8, %%xmm14\n"
+    "punpckldq %%xmm9, %%xmm8\n"
+    "punpckhdq %%xmm9, %%xmm14\n"
+    "movdqa %%xmm10, %%xmm15\n"
+    "punpckldq %%xmm11, %%xmm10\n"
+    "punpckhdq %%xmm11, %%xmm15\n"
+    "movdqa %%xmm8, %%xmm9\n"
+    "punpcklqdq %%xmm10, %%xmm8\n"
+    "punpckhqdq %%xmm10, %%xmm9\n"
+    "movdqa %%xmm14, %%xmm11\n"
+    "punpcklqdq %%xmm15, %%xmm14\n"
+    "punpckhqdq %%xmm15, %%xmm11\n"
+    "movdqu 48(%[s]), %%xmm10\n"
+    "pxor %%xmm8, %%xmm10\n"
+    "movdqu %%xmm10, 48(%[d])\n"
+    "movdqu 112(%[s]), %%xmm10\n"
+    "pxor %%xmm9, %%xmm10\n"
+    "movdqu %%xmm10, 112(%[d])\n"
+    "movdqu 176(%[s]), %%xmm10\n"
+    "pxor %%xmm14, %%xmm10\n"
+    "movdqu %%xmm10, 176(%[d])\n"
+    "movdqu 240(%[s]), %%xmm10\n"
+    "pxor %%xmm11, %%xmm10\n"
+    "movdqu %%xmm10, 240(%[d])\n"
+    "movdqu 256(%[b]), %%xmm0\n"
+    "movdqu 128(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm0\n"
+    "movdqu 272(%[b]), %%xmm1\n"
+    "movdqu 144(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm1\n"
+    "movdqu 288(%[b]), %%xmm2\n"
+    "movdqu 160(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm2\n"
+    "movdqu 304(%[b]), %%xmm3\n"
+    "movdqu 176(%[b]), %%xmm12\n"
+    "paddd %%xmm12, %%xmm3\n"
+    "movdqa %%xmm0, %%xmm14\n"
+    "punpckldq %%xmm1, %%xmm0\n"
+    "punpckhdq %%xmm1, %%xmm14\n"
+    "movdqa %%xmm2, %%xmm15\n"
+    "punpckldq %%xmm3, %%xmm2\n"
+    "punpckhdq %%xmm3, %%xmm15\n"
+    "movdqa %%xmm0, %%xmm1\n"
+    "punpcklqdq %%xmm2, %%xmm0\n"
+    "punpckhqdq %%xmm2, %%xmm1\n"
+    "movdqa %%xmm14, %%xmm3\n"
+    "punpcklqdq %%xmm15, %%xmm14\n"
+    "punpckhqdq %%xmm15, %%xmm3\n"
+    "movdqu 32(%[s]), %%xmm2\n"
+    "pxor %%xmm0, %%xmm2\n"
+    "movdqu %%xmm2, 32(%[d])\n"
+    "movdqu 96(%[s]), %%xmm2\n"
+    "pxor %%xmm1, %%xmm2\n"
+    "movdqu %%xmm2, 96(%[d])\n"
+    "movdqu 160(%[s]), %%xmm2\n"
+    "pxor %%xmm14, %%xmm2\n"
+    "movdqu %%xmm2, 160(%[d])\n"
+    "movdqu 224(%[s]), %%xmm2\n"
+    "pxor %%xmm3, %%xmm2\n"
+    "movdqu %%xmm2, 224(%[d])\n"
+    "movdqu 192(%[b]), %%xmm0\n"
+    "movdqu 320(%[b]), %%xmm1\n"
+    "paddd %%xmm1, %%xmm0\n"
+    "movdqu %%xmm0, 192(%[b])\n"
+    "addq $256, %[s]\n"
+    "addq $256, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    : [s] "+r" (src), [d] "+r" (dst), [n] "+r" (n), [r] "=&r" (r)
+    : [b] "r" (buf)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15", "cc", "memory"
+  );
+
+  ctx->state[12] += groups * 4;
+
+  torsion_cleanse(buf, sizeof(buf));
+}
+
+static void
+chacha20_blocks8(chacha20_t *ctx,
+                 unsigned char *dst,
+                 const unsigned char *src,
+                 size_t groups) {
+  /* Eight blocks at a time with AVX2. Same layout as
+   * the SSE2 code with the words twice as wide. The
+   * 16 and 8 bit rotations are done with byte shuffles.
+   *
+   * Buffer layout:
+   *
+   *   0-511 = initial state (each word broadcast)
+   *   512-639 = third row
+   *   640-671 = rotate-16 shuffle mask
+   *   672-703 = rotate-8 shuffle mask
+   *   704-735 = counter increment
+   *
+   * Registers:
+   *
+   *   %[b] = buffer pointer
+   *   %[s] = src pointer
+   *   %[d] = dst pointer
+   *   %[n] = group counter
+   *   %[r] = round counter
+   *
+   * For reference, our full range of clobbered registers:
+   *
+   *   %ymm[0-15]
+   */
+  uint32_t buf[184];
+  uint64_t n = groups;
+  uint32_t r;
+  int i, j;
+
+  for (i = 0; i < 16; i++) {
+    for (j = 0; j < 8; j++)
+      buf[i * 8 + j] = ctx->state[i] + (i == 12 ? j : 0);
+  }
+
+  for (j = 0; j < 8; j++) {
+    buf[160 + j] = UINT32_C(0x01000302) + UINT32_C(0x04040404) * (j & 3);
+    buf[168 + j] = UINT32_C(0x02010003) + UINT32_C(0x04040404) * (j & 3);
+    buf[176 + j] = 8;
+  }
+
+  __asm__ __volatile__(
+    "1:\n"
+    "vmovdqu 0(%[b]), %%ymm0\n"
+    "vmovdqu 32(%[b]), %%ymm1\n"
+    "vmovdqu 64(%[b]), %%ymm2\n"
+    "vmovdqu 96(%[b]), %%ymm3\n"
+    "vmovdqu 128(%[b]), %%ymm4\n"
+    "vmovdqu 160(%[b]), %%ymm5\n"
+    "vmovdqu 192(%[b]), %%ymm6\n"
+    "vmovdqu 224(%[b]), %%ymm7\n"
+    "vmovdqu 384(%[b]), %%ymm8\n"
+    "vmovdqu 416(%[b]), %%ymm9\n"
+    "vmovdqu 448(%[b]), %%ymm10\n"
+    "vmovdqu 480(%[b]), %%ymm11\n"
+    "vmovdqu 256(%[b]), %%ymm12\n"
+    "vmovdqu %%ymm12, 512(%[b])\n"
+    "vmovdqu 288(%[b]), %%ymm12\n"
+    "vmovdqu %%ymm12, 544(%[b])\n"
+    "vmovdqu 320(%[b]), %%ymm12\n"
+    "vmovdqu %%ymm12, 576(%[b])\n"
+    "vmovdqu 352(%[b]), %%ymm12\n"
+    "vmovdqu %%ymm12, 608(%[b])\n"
+    "movl $10, %k[r]\n"
+    "2:\n"
+    "vmovdqu 512(%[b]), %%ymm12\n"
+    "vmovdqu 544(%[b]), %%ymm13\n"
+    "vpaddd %%ymm4, %%ymm0, %%ymm0\n"
+    "vpxor %%ymm0, %%ymm8, %%ymm8\n"
+    "vpshufb 640(%[b]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm5, %%ymm1, %%ymm1\n"
+    "vpxor %%ymm1, %%ymm9, %%ymm9\n"
+    "vpshufb 640(%[b]), %%ymm9, %%ymm9\n"
+    "vpaddd %%ymm8, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm4, %%ymm4\n"
+    "vpslld $12, %%ymm4, %%ymm14\n"
+    "vpsrld $20, %%ymm4, %%ymm4\n"
+    "vpor %%ymm14, %%ymm4, %%ymm4\n"
+    "vpaddd %%ymm9, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm5, %%ymm5\n"
+    "vpslld $12, %%ymm5, %%ymm15\n"
+    "vpsrld $20, %%ymm5, %%ymm5\n"
+    "vpor %%ymm15, %%ymm5, %%ymm5\n"
+    "vpaddd %%ymm4, %%ymm0, %%ymm0\n"
+    "vpxor %%ymm0, %%ymm8, %%ymm8\n"
+    "vpshufb 672(%[b]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm5, %%ymm1, %%ymm1\n"
+    "vpxor %%ymm1, %%ymm9, %%ymm9\n"
+    "vpshufb 672(%[b]), %%ymm9, %%ymm9\n"
+    "vpaddd %%ymm8, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm4, %%ymm4\n"
+    "vpslld $7, %%ymm4, %%ymm14\n"
+    "vpsrld $25, %%ymm4, %%ymm4\n"
+    "vpor %%ymm14, %%ymm4, %%ymm4\n"
+    "vpaddd %%ymm9, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm5, %%ymm5\n"
+    "vpslld $7, %%ymm5, %%ymm15\n"
+    "vpsrld $25, %%ymm5, %%ymm5\n"
+    "vpor %%ymm15, %%ymm5, %%ymm5\n"
+    "vmovdqu %%ymm12, 512(%[b])\n"
+    "vmovdqu %%ymm13, 544(%[b])\n"
+    "vmovdqu 576(%[b]), %%ymm12\n"
+    "vmovdqu 608(%[b]), %%ymm13\n"
+    "vpaddd %%ymm6, %%ymm2, %%ymm2\n"
+    "vpxor %%ymm2, %%ymm10, %%ymm10\n"
+    "vpshufb 640(%[b]), %%ymm10, %%ymm10\n"
+    "vpaddd %%ymm7, %%ymm3, %%ymm3\n"
+    "vpxor %%ymm3, %%ymm11, %%ymm11\n"
+    "vpshufb 640(%[b]), %%ymm11, %%ymm11\n"
+    "vpaddd %%ymm10, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm6, %%ymm6\n"
+    "vpslld $12, %%ymm6, %%ymm14\n"
+    "vpsrld $20, %%ymm6, %%ymm6\n"
+    "vpor %%ymm14, %%ymm6, %%ymm6\n"
+    "vpaddd %%ymm11, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm7, %%ymm7\n"
+    "vpslld $12, %%ymm7, %%ymm15\n"
+    "vpsrld $20, %%ymm7, %%ymm7\n"
+    "vpor %%ymm15, %%ymm7, %%ymm7\n"
+    "vpaddd %%ymm6, %%ymm2, %%ymm2\n"
+    "vpxor %%ymm2, %%ymm10, %%ymm10\n"
+    "vpshufb 672(%[b]), %%ymm10, %%ymm10\n"
+    "vpaddd %%ymm7, %%ymm3, %%ymm3\n"
+    "vpxor %%ymm3, %%ymm11, %%ymm11\n"
+    "vpshufb 672(%[b]), %%ymm11, %%ymm11\n"
+    "vpaddd %%ymm10, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm6, %%ymm6\n"
+    "vpslld $7, %%ymm6, %%ymm14\n"
+    "vpsrld $25, %%ymm6, %%ymm6\n"
+    "vpor %%ymm14, %%ymm6, %%ymm6\n"
+    "vpaddd %%ymm11, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm7, %%ymm7\n"
+    "vpslld $7, %%ymm7, %%ymm15\n"
+    "vpsrld $25, %%ymm7, %%ymm7\n"
+    "vpor %%ymm15, %%ymm7, %%ymm7\n"
+    "vmovdqu %%ymm12, 576(%[b])\n"
+    "vmovdqu %%ymm13, 608(%[b])\n"
+    "vmovdqu 576(%[b]), %%ymm12\n"
+    "vmovdqu 608(%[b]), %%ymm13\n"
+    "vpaddd %%ymm5, %%ymm0, %%ymm0\n"
+    "vpxor %%ymm0, %%ymm11, %%ymm11\n"
+    "vpshufb 640(%[b]), %%ymm11, %%ymm11\n"
+    "vpaddd %%ymm6, %%ymm1, %%ymm1\n"
+    "vpxor %%ymm1, %%ymm8, %%ymm8\n"
+    "vpshufb 640(%[b]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm11, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm5, %%ymm5\n"
+    "vpslld $12, %%ymm5, %%ymm14\n"
+    "vpsrld $20, %%ymm5, %%ymm5\n"
+    "vpor %%ymm14, %%ymm5, %%ymm5\n"
+    "vpaddd %%ymm8, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm6, %%ymm6\n"
+    "vpslld $12, %%ymm6, %%ymm15\n"
+    "vpsrld $20, %%ymm6, %%ymm6\n"
+    "vpor %%ymm15, %%ymm6, %%ymm6\n"
+    "vpaddd %%ymm5, %%ymm0, %%ymm0\n"
+    "vpxor %%ymm0, %%ymm11, %%ymm11\n"
+    "vpshufb 672(%[b]), %%ymm11, %%ymm11\n"
+    "vpaddd %%ymm6, %%ymm1, %%ymm1\n"
+    "vpxor %%ymm1, %%ymm8, %%ymm8\n"
+    "vpshufb 672(%[b]), %%ymm8, %%ymm8\n"
+    "vpaddd %%ymm11, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm5, %%ymm5\n"
+    "vpslld $7, %%ymm5, %%ymm14\n"
+    "vpsrld $25, %%ymm5, %%ymm5\n"
+    "vpor %%ymm14, %%ymm5, %%ymm5\n"
+    "vpaddd %%ymm8, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm6, %%ymm6\n"
+    "vpslld $7, %%ymm6, %%ymm15\n"
+    "vpsrld $25, %%ymm6, %%ymm6\n"
+    "vpor %%ymm15, %%ymm6, %%ymm6\n"
+    "vmovdqu %%ymm12, 576(%[b])\n"
+    "vmovdqu %%ymm13, 608(%[b])\n"
+    "vmovdqu 512(%[b]), %%ymm12\n"
+    "vmovdqu 544(%[b]), %%ymm13\n"
+    "vpaddd %%ymm7, %%ymm2, %%ymm2\n"
+    "vpxor %%ymm2, %%ymm9, %%ymm9\n"
+    "vpshufb 640(%[b]), %%ymm9, %%ymm9\n"
+    "vpaddd %%ymm4, %%ymm3, %%ymm3\n"
+    "vpxor %%ymm3, %%ymm10, %%ymm10\n"
+    "vpshufb 640(%[b]), %%ymm10, %%ymm10\n"
+    "vpaddd %%ymm9, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm7, %%ymm7\n"
+    "vpslld $12, %%ymm7, %%ymm14\n"
+    "vpsrld $20, %%ymm7, %%ymm7\n"
+    "vpor %%ymm14, %%ymm7, %%ymm7\n"
+    "vpaddd %%ymm10, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm4, %%ymm4\n"
+    "vpslld $12, %%ymm4, %%ymm15\n"
+    "vpsrld $20, %%ymm4, %%ymm4\n"
+    "vpor %%ymm15, %%ymm4, %%ymm4\n"
+    "vpaddd %%ymm7, %%ymm2, %%ymm2\n"
+    "vpxor %%ymm2, %%ymm9, %%ymm9\n"
+    "vpshufb 672(%[b]), %%ymm9, %%ymm9\n"
+    "vpaddd %%ymm4, %%ymm3, %%ymm3\n"
+    "vpxor %%ymm3, %%ymm10, %%ymm10\n"
+    "vpshufb 672(%[b]), %%ymm10, %%ymm10\n"
+    "vpaddd %%ymm9, %%ymm12, %%ymm12\n"
+    "vpxor %%ymm12, %%ymm7, %%ymm7\n"
+    "vpslld $7, %%ymm7, %%ymm14\n"
+    "vpsrld $25, %%ymm7, %%ymm7\n"
+    "vpor %%ymm14, %%ymm7, %%ymm7\n"
+    "vpaddd %%ymm10, %%ymm13, %%ymm13\n"
+    "vpxor %%ymm13, %%ymm4, %%ymm4\n"
+    "vpslld $7, %%ymm4, %%ymm15\n"
+    "vpsrld $25, %%ymm4, %%ymm4\n"
+    "vpor %%ymm15, %%ymm4, %%ymm4\n"
+    "vmovdqu %%ymm12, 512(%[b])\n"
+    "vmovdqu %%ymm13, 544(%[b])\n"
+    "decl %k[r]\n"
+    "jnz 2b\n"
+    "vpaddd 0(%[b]), %%ymm0, %%ymm0\n"
+    "vpaddd 32(%[b]), %%ymm1, %%ymm1\n"
+    "vpaddd 64(%[b]), %%ymm2, %%ymm2\n"
+    "vpaddd 96(%[b]), %%ymm3, %%ymm3\n"
+    "vpaddd 128(%[b]), %%ymm4, %%ymm4\n"
+    "vpaddd 160(%[b]), %%ymm5, %%ymm5\n"
+    "vpaddd 192(%[b]), %%ymm6, %%ymm6\n"
+    "vpaddd 224(%[b]), %%ymm7, %%ymm7\n"
+    "vpaddd 384(%[b]), %%ymm8, %%ymm8\n"
+    "vpaddd 416(%[b]), %%ymm9, %%ymm9\n"
+    "vpaddd 448(%[b]), %%ymm10, %%ymm10\n"
+    "vpaddd 480(%[b]), %%ymm11, %%ymm11\n"
+    "vpunpckldq %%ymm1, %%ymm0, %%ymm12\n"
+    "vpunpckhdq %%ymm1, %%ymm0, %%ymm13\n"
+    "vpunpckldq %%ymm3, %%ymm2, %%ymm0\n"
+    "vpunpckhdq %%ymm3, %%ymm2, %%ymm1\n"
+    "vpunpcklqdq %%ymm0, %%ymm12, %%ymm2\n"
+    "vpunpckhqdq %%ymm0, %%ymm12, %%ymm3\n"
+    "vpunpcklqdq %%ymm1, %%ymm13, %%ymm0\n"
+    "vpunpckhqdq %%ymm1, %%ymm13, %%ymm12\n"
+    "vpunpckldq %%ymm5, %%ymm4, %%ymm1\n"
+    "vpunpckhdq %%ymm5, %%ymm4, %%ymm13\n"
+    "vpunpckldq %%ymm7, %%ymm6, %%ymm4\n"
+    "vpunpckhdq %%ymm7, %%ymm6, %%ymm5\n"
+    "vpunpcklqdq %%ymm4, %%ymm1, %%ymm6\n"
+    "vpunpckhqdq %%ymm4, %%ymm1, %%ymm7\n"
+    "vpunpcklqdq %%ymm5, %%ymm13, %%ymm4\n"
+    "vpunpckhqdq %%ymm5, %%ymm13, %%ymm1\n"
+    "vperm2i128 $0x20, %%ymm6, %%ymm2, %%ymm5\n"
+    "vperm2i128 $0x31, %%ymm6, %%ymm2, %%ymm13\n"
+    "vpxor 0(%[s]), %%ymm5, %%ymm5\n"
+    "vpxor 256(%[s]), %%ymm13, %%ymm13\n"
+    "vmovdqu %%ymm5, 0(%[d])\n"
+    "vmovdqu %%ymm13, 256(%[d])\n"
+    "vperm2i128 $0x20, %%ymm7, %%ymm3, %%ymm5\n"
+    "vperm2i128 $0x31, %%ymm7, %%ymm3, %%ymm13\n"
+    "vpxor 64(%[s]), %%ymm5, %%ymm5\n"
+    "vpxor 320(%[s]), %%ymm13, %%ymm13\n"
+    "vmovdqu %%ymm5, 64(%[d])\n"
+    "vmovdqu %%ymm13, 320(%[d])\n"
+    "vperm2i128 $0x20, %%ymm4, %%ymm0, %%ymm5\n"
+    "vperm2i128 $0x31, %%ymm4, %%ymm0, %%ymm13\n"
+    "vpxor 128(%[s]), %%ymm5, %%ymm5\n"
+    "vpxor 384(%[s]), %%ymm13, %%ymm13\n"
+    "vmovdqu %%ymm5, 128(%[d])\n"
+    "vmovdqu %%ymm13, 384(%[d])\n"
+    "vperm2i128 $0x20, %%ymm1, %%ymm12, %%ymm5\n"
+    "vperm2i128 $0x31, %%ymm1, %%ymm12, %%ymm13\n"
+    "vpxor 192(%[s]), %%ymm5, %%ymm5\n"
+    "vpxor 448(%[s]), %%ymm13, %%ymm13\n"
+    "vmovdqu %%ymm5, 192(%[d])\n"
+    "vmovdqu %%ymm13, 448(%[d])\n"
+    "vmovdqu 512(%[b]), %%ymm0\n"
+    "vpaddd 256(%[b]), %%ymm0, %%ymm0\n"
+    "vmovdqu 544(%[b]), %%ymm1\n"
+    "vpaddd 288(%[b]), %%ymm1, %%ymm1\n"
+    "vmovdqu 576(%[b]), %%ymm2\n"
+    "vpaddd 320(%[b]), %%ymm2, %%ymm2\n"
+    "vmovdqu 608(%[b]), %%ymm3\n"
+    "vpaddd 352(%[b]), %%ymm3, %%ymm3\n"
+    "vpunpckldq %%ymm1, %%ymm0, %%ymm12\n"
+    "vpunpckhdq %%ymm1, %%ymm0, %%ymm13\n"
+    "vpunpckldq %%ymm3, %%ymm2, %%ymm0\n"
+    "vpunpckhdq %%ymm3, %%ymm2, %%ymm1\n"
+    "vpunpcklqdq %%ymm0, %%ymm12, %%ymm2\n"
+    "vpunpckhqdq %%ymm0, %%ymm12, %%ymm3\n"
+    "vpunpcklqdq %%ymm1, %%ymm13, %%ymm0\n"
+    "vpunpckhqdq %%ymm1, %%ymm13, %%ymm12\n"
+    "vpunpckldq %%ymm9, %%ymm8, %%ymm1\n"
+    "vpunpckhdq %%ymm9, %%ymm8, %%ymm13\n"
+    "vpunpckldq %%ymm11, %%ymm10, %%ymm8\n"
+    "vpunpckhdq %%ymm11, %%ymm10, %%ymm9\n"
+    "vpunpcklqdq %%ymm8, %%ymm1, %%ymm10\n"
+    "vpunpckhqdq %%ymm8, %%ymm1, %%ymm11\n"
+    "vpunpcklqdq %%ymm9, %%ymm13, %%ymm8\n"
+    "vpunpckhqdq %%ymm9, %%ymm13, %%ymm1\n"
+    "vperm2i128 $0x20, %%ymm10, %%ymm2, %%ymm4\n"
+    "vperm2i128 $0x31, %%ymm10, %%ymm2, %%ymm5\n"
+    "vpxor 32(%[s]), %%ymm4, %%ymm4\n"
+    "vpxor 288(%[s]), %%ymm5, %%ymm5\n"
+    "vmovdqu %%ymm4, 32(%[d])\n"
+    "vmovdqu %%ymm5, 288(%[d])\n"
+    "vperm2i128 $0x20, %%ymm11, %%ymm3, %%ymm4\n"
+    "vperm2i128 $0x31, %%ymm11, %%ymm3, %%ymm5\n"
+    "vpxor 96(%[s]), %%ymm4, %%ymm4\n"
+    "vpxor 352(%[s]), %%ymm5, %%ymm5\n"
+    "vmovdqu %%ymm4, 96(%[d])\n"
+    "vmovdqu %%ymm5, 352(%[d])\n"
+    "vperm2i128 $0x20, %%ymm8, %%ymm0, %%ymm4\n"
+    "vperm2i128 $0x31, %%ymm8, %%ymm0, %%ymm5\n"
+    "vpxor 160(%[s]), %%ymm4, %%ymm4\n"
+    "vpxor 416(%[s]), %%ymm5, %%ymm5\n"
+    "vmovdqu %%ymm4, 160(%[d])\n"
+    "vmovdqu %%ymm5, 416(%[d])\n"
+    "vperm2i128 $0x20, %%ymm1, %%ymm12, %%ymm4\n"
+    "vperm2i128 $0x31, %%ymm1, %%ymm12, %%ymm5\n"
+    "vpxor 224(%[s]), %%ymm4, %%ymm4\n"
+    "vpxor 480(%[s]), %%ymm5, %%ymm5\n"
+    "vmovdqu %%ymm4, 224(%[d])\n"
+    "vmovdqu %%ymm5, 480(%[d])\n"
+    "vmovdqu 384(%[b]), %%ymm0\n"
+    "vpaddd 704(%[b]), %%ymm0, %%ymm0\n"
+    "vmovdqu %%ymm0, 384(%[b])\n"
+    "addq $512, %[s]\n"
+    "addq $512, %[d]\n"
+    "decq %[n]\n"
+    "jnz 1b\n"
+    "vzeroupper\n"
+    : [s] "+r" (src), [d] "+r" (dst), [n] "+r" (n), [r] "=&r" (r)
+    : [b] "r" (buf)
+    : "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+      "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11",
+      "xmm12", "xmm13", "xmm14", "xmm15", "cc", "memory"
+  );
+
+  ctx->state[12] += groups * 8;
+
+  torsion_cleanse(buf, sizeof(buf));
+}
+#endif /* TORSION_HAVE_ASM_X64 */
+
 void
 chacha20_crypt(chacha20_t *ctx,
                unsigned char *out,
                const unsigned char *data,
                size_t len) {
   unsigned char *bytes = (unsigned char *)ctx->stream;
-  size_t i;
+  size_t i = 0;
 
-  for (i = 0; i < len; i++) {
+#if defined(TORSION_HAVE_ASM_X64)
+  while (i < len && (ctx->pos & 63) != 0) {
+    out[i] = data[i] ^ bytes[ctx->pos++];
+    i += 1;
+  }
+
+  if (len - i >= 256) {
+    /* Stop short of a 32 bit counter overflow and
+       let the single block code handle the carry. */
+    size_t blocks = (len - i) >> 6;
+    size_t room = 0xffffffff - ctx->state[12];
+    size_t groups;
+
+    if (blocks > room)
+      blocks = room;
+
+    if (blocks >= 8 && torsion_cpu_has(TORSION_CPU_AVX2)) {
+      groups = blocks >> 3;
+
+      chacha20_blocks8(ctx, out + i, data + i, groups);
+
+      blocks -= groups << 3;
+      i += groups << 9;
+    }
+
+    if (blocks >= 4) {
+      groups = blocks >> 2;
+
+      chacha20_blocks4(ctx, out + i, data + i, groups);
+
+      i += groups << 8;
+    }
+
+    ctx->pos = 0;
+  }
+#endif
+
+  for (; i < len; i++) {
     if ((ctx->pos & 63) == 0) {
       chacha20_block(ctx, ctx->stream);
       ctx->pos = 0;
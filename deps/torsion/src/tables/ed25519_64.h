@@ -0,0 +1,18258 @@
+/* Autogenerated: scripts/gen-tables.c ed25519 */
+/* machine_wordsize = 64 */
+/* fixed window = 4, naf window = 12 */
+
+#define W UINT64_C
+
+static const xge_t ed25519_wnd_fixed[1024] = {
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00062d608f25d51a), W(0x000412a4b4f6592a), W(0x00075b7171a4b31d),
+     W(0x0001ff60527118fe), W(0x000216936d3cd6e5)},
+    {W(0x0006666666666658), W(0x0004cccccccccccc), W(0x0001999999999999),
+     W(0x0003333333333333), W(0x0006666666666666)},
+    {W(0x0000000000000001)},
+    {W(0x00068ab3a5b7dda3), W(0x00000eea2a5eadbb), W(0x0002af8df483c27e),
+     W(0x000332b375274732), W(0x00067875f0fd78b7)}
+  },
+  {
+    {W(0x0005a14e2843ce0e), W(0x0000a2baf48bf078), W(0x0000cf9eb0203639),
+     W(0x0002361e821dbe8c), W(0x00036ab384c9f5a0)},
+    {W(0x000746ae6af8a3c9), W(0x00022c870a2ac1cb), W(0x0006887d5a5ce43d),
+     W(0x0004e10ed12f7464), W(0x0002260cdf309232)},
+    {W(0x0000000000000001)},
+    {W(0x00023f556d69b401), W(0x0001383ee48056e3), W(0x00040ed04d75e6b3),
+     W(0x00046e0ef2af8439), W(0x0002498a7850b2f6)}
+  },
+  {
+    {W(0x0002485fd3f8e25c), W(0x0003302c4910d58c), W(0x00036b20e98d0e60),
+     W(0x0007a48ffa573a1f), W(0x00067ae9c4a22928)},
+    {W(0x0003684878f5b4d4), W(0x0002ece480608058), W(0x00009a7bde7c5bb0),
+     W(0x0004d5d09350c730), W(0x0001267b1d177ee6)},
+    {W(0x0000000000000001)},
+    {W(0x000108fa78b3a41a), W(0x00017f62df8959bf), W(0x0006e4549d709cd6),
+     W(0x00028875f79bc1d6), W(0x0002a4d025cb1dd9)}
+  },
+  {
+    {W(0x0002a657c4c9f870), W(0x00003279c2a8e927), W(0x0000d483e469ce7b),
+     W(0x0000a34192ea5c3d), W(0x000203da8db56cff)},
+    {W(0x0000ab61ca32112f), W(0x00065d45e1fe1be7), W(0x000355c5b133c8a0),
+     W(0x0002f0a3875c42c0), W(0x00047d0e827cb159)},
+    {W(0x0000000000000001)},
+    {W(0x000722f6728a1358), W(0x0003d6dba0f94bf1), W(0x0001f0a581c6578c),
+     W(0x000306390a5d3563), W(0x00022783cd8d8732)}
+  },
+  {
+    {W(0x00009cc0322ef233), W(0x000727c37c34b228), W(0x0004b6977970a067),
+     W(0x00043dfe77be7be8), W(0x00049fda73eade35)},
+    {W(0x00021f83d676c8ed), W(0x00015128616ba21a), W(0x0006491998c4a0bb),
+     W(0x000737f016370a44), W(0x0005f4825b298fea)},
+    {W(0x0000000000000001)},
+    {W(0x000150bcf3e801d0), W(0x0000a00124d7ec83), W(0x0004db1fe6bee53a),
+     W(0x0006a618b0752843), W(0x000745c562c9c593)}
+  },
+  {
+    {W(0x0002741a7dcbf23d), W(0x00004d8f6884ef07), W(0x000428a6fa879666),
+     W(0x00000e315756606e), W(0x0004c9797ba7a456)},
+    {W(0x00027ad0f9497ef4), W(0x0000d289ad6c183a), W(0x00053df5dfe505f0),
+     W(0x0004508edb84d3fe), W(0x000054de3fc2886d)},
+    {W(0x0000000000000001)},
+    {W(0x0006d6c8b44ef1d2), W(0x00028f8fb91378f9), W(0x00079f73102ebe48),
+     W(0x000027c142ad4ca7), W(0x0003c32efd109aa6)}
+  },
+  {
+    {W(0x0005981af50e4107), W(0x0006777e39d2ab0a), W(0x000476041e0fa027),
+     W(0x0006a774f1f70ca5), W(0x00014568685fcf4b)},
+    {W(0x0004c4b59f4062b8), W(0x0000def57e47a258), W(0x0004dab507c220ad),
+     W(0x000297c3e732346e), W(0x00031c563e32b47d)},
+    {W(0x0000000000000001)},
+    {W(0x000545565587ed1b), W(0x000543d3549c8217), W(0x000756ead14a518c),
+     W(0x00070dcdf416e2c4), W(0x000119e77b11d165)}
+  },
+  {
+    {W(0x0007fdbc08a584c8), W(0x0007700d31732770), W(0x00013b3e4faceb19),
+     W(0x0000db214316ae7c), W(0x0006742e15f97d77)},
+    {W(0x00075ba9fc37b9b4), W(0x00078c43dc9263c5), W(0x00022bce3e05e0f3),
+     W(0x0001bcb756b784b3), W(0x00021d30600c9e57)},
+    {W(0x0000000000000001)},
+    {W(0x0006f41ad41a51bf), W(0x0005a689857eadf7), W(0x0002cf664d17c339),
+     W(0x0005708b04614d9c), W(0x0002c4f59ecedf7e)}
+  },
+  {
+    {W(0x000023065185715c), W(0x000385c9c0529a7c), W(0x0006508ae21b6039),
+     W(0x0000b28df99b7037), W(0x000357cc970c8007)},
+    {W(0x000644845522f1c0), W(0x0002646dc88618e9), W(0x0003cb4bf47de240),
+     W(0x0006fa595f7e74ab), W(0x0007f3d23c2c2dd0)},
+    {W(0x0000000000000001)},
+    {W(0x0003386f88b2f465), W(0x00041eee064fcb87), W(0x00051f35d05ecf52),
+     W(0x0005fcedb33b56fb), W(0x0005c70fc48ea87c)}
+  },
+  {
+    {W(0x00051f224877f94f), W(0x0001db06df028892), W(0x0002f219dc81fa39),
+     W(0x0006baa2385b0769), W(0x000602c797e30ca6)},
+    {W(0x000074b06ae87b2c), W(0x0000a7bc1d087751), W(0x000262ff3c95da9a),
+     W(0x00023be47226aa64), W(0x000637ffcaa7a1b2)},
+    {W(0x0000000000000001)},
+    {W(0x00074c95035bc63e), W(0x0006967724a4a87c), W(0x0006d15dfdd3d6a7),
+     W(0x000149445fe88184), W(0x00036e05f3266735)}
+  },
+  {
+    {W(0x0007d2c1207cf3cb), W(0x000658b27aaa5fe5), W(0x0001c490e34e0696),
+     W(0x00020bdb6783c6eb), W(0x00014e528b1154be)},
+    {W(0x00072dc36a033713), W(0x000387938b1a8611), W(0x0003fc3f38496164),
+     W(0x0005cbad37be71a0), W(0x0002d9082313f21a)},
+    {W(0x0000000000000001)},
+    {W(0x0005cf2edb5beed4), W(0x0003bc31f906fd70), W(0x00005ab6fd640007),
+     W(0x0004511ce5535f79), W(0x0005ae6a565800f2)}
+  },
+  {
+    {W(0x0002fe6678f0902d), W(0x000470b8276855cc), W(0x000289276cca56fc),
+     W(0x00069aaf67b87006), W(0x0004719e17e016e5)},
+    {W(0x000281dc2e2de4f9), W(0x00068a4e72cce67a), W(0x0005e096e15921fa),
+     W(0x000011738eb62731), W(0x0004070ce608bce8)},
+    {W(0x0000000000000001)},
+    {W(0x0004c3128e4b1ccb), W(0x0000918b62757abd), W(0x00073401bc3c7bc3),
+     W(0x0004509033e9d418), W(0x0002b344e203a485)}
+  },
+  {
+    {W(0x0000e073b7c05fed), W(0x000511a456f706f0), W(0x0000b4c13e210f8f),
+     W(0x0003666d99d6f814), W(0x000107427e0d5f36)},
+    {W(0x0007e1aeea401f80), W(0x0006451344e470fd), W(0x00036a26e0dd033e),
+     W(0x0005ba3c23301169), W(0x00012dbb00ded538)},
+    {W(0x0000000000000001)},
+    {W(0x0004dccde8de2f53), W(0x00023d65d1df8a45), W(0x0005588ce16c52a9),
+     W(0x00023062e06eb0e6), W(0x000412806b917be6)}
+  },
+  {
+    {W(0x00067353b58515b9), W(0x000307c730655471), W(0x00032aec57637b9b),
+     W(0x00055782463d44ae), W(0x000205f3b42f5884)},
+    {W(0x0001fd98899c2839), W(0x00050336c4cb906d), W(0x0006dc0afe9d2263),
+     W(0x0005c08add68bd65), W(0x0004e50256f50c4c)},
+    {W(0x0000000000000001)},
+    {W(0x00033d2ca271c2e0), W(0x0007fccc88bc1122), W(0x0002ff91e5c79d0d),
+     W(0x000707c753055f9e), W(0x00066432d1463a87)}
+  },
+  {
+    {W(0x00017f3e66a18dc1), W(0x00068ee03139720c), W(0x000481067b658c4d),
+     W(0x00021aee2d637cae), W(0x0004f162deaec2ec)},
+    {W(0x00054cc4ad2e5cdf), W(0x000314335354328d), W(0x00034a4cc6b396bc),
+     W(0x00017aa8b17b80b2), W(0x00012cbfb2d04ff2)},
+    {W(0x0000000000000001)},
+    {W(0x00057f335c92bf29), W(0x0001fc815cbea281), W(0x0005d8378be98eda),
+     W(0x000248d5927e9120), W(0x0005e33f00e36b77)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002596d6c28f9f8), W(0x00067cf7e46e8b36), W(0x0000927244255e34),
+     W(0x0005775c71158a84), W(0x00023a4860627e53)},
+    {W(0x0002ab37c16727eb), W(0x0007f1c0f384fb0f), W(0x0002b5b9e2c1a847),
+     W(0x0001b94fcc07971d), W(0x000709696f2827fc)},
+    {W(0x0000000000000001)},
+    {W(0x00079a1dceff9bd6), W(0x00058322326d4c89), W(0x0004d39166bf20e7),
+     W(0x0005a0ad0fc5358a), W(0x00011f641409f6a6)}
+  },
+  {
+    {W(0x000540f6977e4f26), W(0x00021f2f0a5f89fb), W(0x0004e559f7980cc6),
+     W(0x00057cc2c12b0e85), W(0x00039cf6c6917421)},
+    {W(0x0005394f3a06d269), W(0x0004e99188071f25), W(0x0003e22de2d04817),
+     W(0x000735bd6f49f660), W(0x0004434a90ee12cc)},
+    {W(0x0000000000000001)},
+    {W(0x0001747f59e2c69f), W(0x00002ed714d6a478), W(0x00051e9655c5395b),
+     W(0x000636e9d1c22a36), W(0x0006df8117912746)}
+  },
+  {
+    {W(0x00050f6f7ba4d779), W(0x0005c4f7a1eb19e5), W(0x0005dc114cba2906),
+     W(0x0003e84f8a454989), W(0x0004d6204a526dec)},
+    {W(0x0005ea7ba206df11), W(0x0000f105689470e8), W(0x00007f486a2f99ce),
+     W(0x000552544bc2710a), W(0x000654330726d32a)},
+    {W(0x0000000000000001)},
+    {W(0x000103da7785b6ea), W(0x000178561ff7d9cf), W(0x0002a46b78bf15aa),
+     W(0x0002abaa717fc4aa), W(0x00020e8321e21e97)}
+  },
+  {
+    {W(0x00017a0fb03ca40b), W(0x0007ad5b3acf1e2a), W(0x000475e6a2e3a11b),
+     W(0x000489ce79487cc3), W(0x00005fa64200bf82)},
+    {W(0x000695af17da0926), W(0x0003cdc1a32d5f7a), W(0x0006a2a93267c449),
+     W(0x000014397a433cb7), W(0x0003d199eeaf9260)},
+    {W(0x0000000000000001)},
+    {W(0x0007a9d4ba7b0f68), W(0x00055baf4a5847c7), W(0x0005b764d178695f),
+     W(0x000670e8ef5ee152), W(0x000321126b374048)}
+  },
+  {
+    {W(0x0007e8d7f6425311), W(0x0002a0522a54279b), W(0x000695b868644b18),
+     W(0x000709a8a76e90f2), W(0x00078b43cc5bc020)},
+    {W(0x00008d0cd2fb4db9), W(0x00024de4fad58fc3), W(0x000485591a807ef2),
+     W(0x0001b717c3b14b07), W(0x00075358a782e64b)},
+    {W(0x0000000000000001)},
+    {W(0x0003f728a791c23d), W(0x00007268905deb98), W(0x0003dd2b40df4468),
+     W(0x0000ed59b3dd338c), W(0x0001e7db2ec5749d)}
+  },
+  {
+    {W(0x00056d4fc15b1416), W(0x0002ffb6fcc6599e), W(0x0002fce3c056702d),
+     W(0x00065ce5ee96d10f), W(0x000003b5c6a2e0d4)},
+    {W(0x00049fbafc243d1e), W(0x00035c8379027268), W(0x00036611cdabb6f7),
+     W(0x0002be09a431cbb4), W(0x0001bd9006846acb)},
+    {W(0x0000000000000001)},
+    {W(0x00004160f8fe4df9), W(0x0001906820d1f9cc), W(0x000048713b868418),
+     W(0x0004ba68ca06ca28), W(0x0005a70296b80830)}
+  },
+  {
+    {W(0x0003380b3e48f8ea), W(0x00065b23d9f47afc), W(0x00059f4cda19ec93),
+     W(0x00065cee3ed599c7), W(0x000384bd69ca7d69)},
+    {W(0x000124b6dec0a6e5), W(0x0003fe6141082e06), W(0x0002f2ab2afaea72),
+     W(0x00039a52350b58dc), W(0x000121351d79352d)},
+    {W(0x0000000000000001)},
+    {W(0x0003bcf9b66567e4), W(0x000107c3357f299d), W(0x00031d835e1245b1),
+     W(0x0004d04e682e2967), W(0x0003e267de37a9a4)}
+  },
+  {
+    {W(0x0002495bf0cfdd87), W(0x000484c46f480bb4), W(0x00034a2ede2a0dea),
+     W(0x0007841201755f8d), W(0x000379dbeb1a97b5)},
+    {W(0x0000e7ee084b86fc), W(0x0000268128a43fb4), W(0x0001566ff08cc987),
+     W(0x0004e831fbcca9a4), W(0x00028eb9fe001ce9)},
+    {W(0x0000000000000001)},
+    {W(0x0002d0080df08ac6), W(0x000760678796028c), W(0x0001dbb97dcd5bc0),
+     W(0x000177e13674d3ca), W(0x0003e784aba748f6)}
+  },
+  {
+    {W(0x00022c8f853166d0), W(0x0002afb0de5f63fc), W(0x000502d7184c2480),
+     W(0x00005b2d22ee4092), W(0x0002a15b6f03f69a)},
+    {W(0x0004b2e4ec89df9c), W(0x0005361149ca428e), W(0x0002fca71216afdc),
+     W(0x00054c16e180a316), W(0x000721c3cbbccbec)},
+    {W(0x0000000000000001)},
+    {W(0x000115d58b6bb52d), W(0x000334a60ada78b3), W(0x00015b11150d4259),
+     W(0x0003bdec6840ed1e), W(0x0001e3687df6c6f9)}
+  },
+  {
+    {W(0x00042cadf5e111e0), W(0x000094e008d607c2), W(0x00037e75190ce294),
+     W(0x0001ad1b1009ab77), W(0x0003609e119217bd)},
+    {W(0x00051e78bca36be2), W(0x0002099a1c384ea3), W(0x00023366cf76f714),
+     W(0x000606aa56cbf7aa), W(0x0005b7a741136519)},
+    {W(0x0000000000000001)},
+    {W(0x0006ef114ef8eaf3), W(0x000352ea4a6303c7), W(0x0002cf65fbb83e00),
+     W(0x0003d2e091b1cfe1), W(0x0000fe9109437754)}
+  },
+  {
+    {W(0x0002a78eed7fda0d), W(0x000390247727d460), W(0x00021b01380e57e8),
+     W(0x000735aab9713b2c), W(0x0001624fefec7dfa)},
+    {W(0x0002d581bba393cb), W(0x000205a898dd3920), W(0x00018696854bb62a),
+     W(0x00029ed6c40423a2), W(0x00060e4e54d6057a)},
+    {W(0x0000000000000001)},
+    {W(0x0003f8d9878c79ec), W(0x00009ed544c6bdd4), W(0x0001c4078fda3735),
+     W(0x0000520e759b8ecb), W(0x0006de8fcda57bf9)}
+  },
+  {
+    {W(0x0005f0175aabfc47), W(0x00050410c6074ad0), W(0x0001b8e9d112392c),
+     W(0x00041fcfc7997881), W(0x0006e5f16cae9350)},
+    {W(0x0004345d651c591c), W(0x0007ae138279a134), W(0x00002ebe2314aac5),
+     W(0x0003eb469a4fe3b0), W(0x000778d6578ea7fb)},
+    {W(0x0000000000000001)},
+    {W(0x0004cab1cdedf788), W(0x000564fbcc7cae7f), W(0x0002a9b630eb26ce),
+     W(0x0001fa40e69c8cb0), W(0x0000be9e35c7afbd)}
+  },
+  {
+    {W(0x0007083f741b790c), W(0x00018f4bbf3e42c6), W(0x0000deca69db3132),
+     W(0x0002cacb79883fc8), W(0x0001d19e9b78ddda)},
+    {W(0x00062b43a0c1537b), W(0x00020952efc2509f), W(0x0007e4b54049c44e),
+     W(0x00067be5c5882e32), W(0x0005cbac182ca0fa)},
+    {W(0x0000000000000001)},
+    {W(0x0006ac1672c43f43), W(0x0003af08ca317f94), W(0x0001efd2b3a76981),
+     W(0x00068e56f7081477), W(0x0004bbf416375aba)}
+  },
+  {
+    {W(0x00030f061dd31544), W(0x00006caa4a38e85e), W(0x0006513536525e78),
+     W(0x0001bc7eaa8bed34), W(0x00063c9614779664)},
+    {W(0x0005a019b9730bb4), W(0x000054ba7fdb8d44), W(0x0001506b1da3dcd5),
+     W(0x0001f6be78fa63c8), W(0x00077472dca8c252)},
+    {W(0x0000000000000001)},
+    {W(0x0000cb67508b56f1), W(0x00038c87cafb8402), W(0x0001812b7181a274),
+     W(0x0003834c15f4be00), W(0x0000b9d6c7d145a2)}
+  },
+  {
+    {W(0x0004ba159304bcd0), W(0x0003e4d8c4adaecf), W(0x00048dc6b9cc3929),
+     W(0x00019d06d8e00683), W(0x0003187537480714)},
+    {W(0x0007a11a28a2274b), W(0x0004dff418b602b3), W(0x0005e138e96c9420),
+     W(0x0006962f7767b4a8), W(0x0003e65ac8d4140a)},
+    {W(0x0000000000000001)},
+    {W(0x00057f3967c0534f), W(0x0004ad7a8751e4df), W(0x00063a9eee69d85b),
+     W(0x000327c4073dd33e), W(0x000390b2cab35e9f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0000bcdd0cc2a556), W(0x000776ac2aeda417), W(0x000241512752d5e3),
+     W(0x00065ff374e5e093), W(0x0005e7e07ed4e1de)},
+    {W(0x00042031566cf6c7), W(0x00035824fb3501c2), W(0x00074c9839f46cf6),
+     W(0x00013cb5faf5d540), W(0x0000f55755c51f10)},
+    {W(0x0000000000000001)},
+    {W(0x000365fc2857a27e), W(0x0000c67e5bfbeb5e), W(0x00053a86b67936b6),
+     W(0x00033d215a262b04), W(0x00063e8ae2c1ead5)}
+  },
+  {
+    {W(0x0001333c82cd340a), W(0x000366072c3a4a81), W(0x0001c3509887bff6),
+     W(0x0002399998fcf77d), W(0x0002eecbf81b3d08)},
+    {W(0x0004f764008b93e8), W(0x0001093cdc0e9713), W(0x00028466d9213535),
+     W(0x00013e20996cdba0), W(0x00054d2dc2da1378)},
+    {W(0x0000000000000001)},
+    {W(0x000522be2496053a), W(0x000765bc6fd72749), W(0x000118733aa74460),
+     W(0x0001e7789e2b953a), W(0x000752941df7a968)}
+  },
+  {
+    {W(0x0006cef314cc93bb), W(0x000554a7aa3728ac), W(0x00073636f95fab74),
+     W(0x00071452d53d8c3c), W(0x00070b225147463b)},
+    {W(0x00067392b18d9c02), W(0x000009bb22c14b73), W(0x000535826851e4d0),
+     W(0x000200e1303393fc), W(0x000244980ded32ff)},
+    {W(0x0000000000000001)},
+    {W(0x0006afe18eca4bf4), W(0x000602cb44b77956), W(0x00020dcf3889df68),
+     W(0x0006d30f3dedd7c0), W(0x000075c542741675)}
+  },
+  {
+    {W(0x0001c7d55b4a2b68), W(0x000089655c23b22a), W(0x00032ecdeaf3c51f),
+     W(0x000682c8563e5b64), W(0x0006b113a52f9f3f)},
+    {W(0x00054359f327c13d), W(0x00069eaf32d8b212), W(0x0005467018a59657),
+     W(0x00073c975c6d0c02), W(0x0001aeb017159697)},
+    {W(0x0000000000000001)},
+    {W(0x0003c3e94b3a3fac), W(0x0002ccd21ea35241), W(0x0006c78dddc2e59b),
+     W(0x00036d2ae0442c71), W(0x00066cb63a6e6c7c)}
+  },
+  {
+    {W(0x0002fde6e9a95bd2), W(0x000507fcc850e338), W(0x00064101647815fb),
+     W(0x0000bcd6b508ee9c), W(0x000661b75757abbc)},
+    {W(0x000597e42a7b09be), W(0x0002fadb6255c92f), W(0x000601f01f443255),
+     W(0x00058978670117a7), W(0x00005da1ae1b5d4b)},
+    {W(0x0000000000000001)},
+    {W(0x0005ee00d9cd9f73), W(0x00013aaa1f36bd93), W(0x000330207ec4e730),
+     W(0x00027c157104cbb8), W(0x000519beaf530bc7)}
+  },
+  {
+    {W(0x00023c8ab6490615), W(0x00055862840685fd), W(0x000196f4f8b2bf5a),
+     W(0x0007f59da5a6f110), W(0x000603ba4adc34a9)},
+    {W(0x00022a95c0e658bc), W(0x0000da5e6f535025), W(0x00011b1432f122f8),
+     W(0x00066c87d66a3570), W(0x0001fdbaf2c3482c)},
+    {W(0x0000000000000001)},
+    {W(0x00067887503d5f1b), W(0x000421680e2c21e1), W(0x0004b0d895cfc0f8),
+     W(0x00066564e8b18189), W(0x000629fa3ac3078e)}
+  },
+  {
+    {W(0x000540310b391d99), W(0x00037a2582d266d3), W(0x0003e78cc3af5aa1),
+     W(0x0001d22e8f0ad79d), W(0x0003d718e644bf2d)},
+    {W(0x00063bf5a23600f9), W(0x0000efe3ee501511), W(0x00008aa2497e40ab),
+     W(0x00020a179144089d), W(0x000320d055dbba3f)},
+    {W(0x0000000000000001)},
+    {W(0x000067099540a656), W(0x0003eec9958b0c58), W(0x000192110f13a743),
+     W(0x0007d383c5d267d0), W(0x0000e52bc37ff3fd)}
+  },
+  {
+    {W(0x0002bcfbbd1317f7), W(0x00052622b668bd9a), W(0x000318a0f6120abf),
+     W(0x0001c5daa0fa88fe), W(0x0003c1ae7527612d)},
+    {W(0x000015a20711364e), W(0x00016c5865588a24), W(0x000517e43e99fd7a),
+     W(0x0002bf5bc308b642), W(0x000051c91c3f9d7e)},
+    {W(0x0000000000000001)},
+    {W(0x0007b066bece2184), W(0x0002a57f92c42568), W(0x0002a85941a787b1),
+     W(0x00029e44311e8f82), W(0x0000daa1438fdd28)}
+  },
+  {
+    {W(0x0001ff823a67a694), W(0x00023b846fda8a52), W(0x0000654bba6d7276),
+     W(0x0004d69756d52b1b), W(0x0001afdaf17e93c5)},
+    {W(0x0006e70a2b212fcb), W(0x0005e5d29ee5e7d1), W(0x00044db00659e72e),
+     W(0x0005cee0b5ede38e), W(0x00036f6ead753596)},
+    {W(0x0000000000000001)},
+    {W(0x00046d97a9bedb26), W(0x00059747d26fbad9), W(0x0001da4d57662d33),
+     W(0x00039453a8047cf0), W(0x0001bdd47424afbd)}
+  },
+  {
+    {W(0x00022da2a3f91fc6), W(0x00044a0dde2705cc), W(0x000455ba8a898343),
+     W(0x0003865a0d9bc6fe), W(0x0005602e63d7c5f7)},
+    {W(0x00015a7b1643df95), W(0x0003c2777fffd0f7), W(0x0001fbf60f716d1f),
+     W(0x0002b9f6af26f085), W(0x0000aeba9f74b202)},
+    {W(0x0000000000000001)},
+    {W(0x0000af4636700d36), W(0x00077a86b0e7f1ef), W(0x00070c83458460cd),
+     W(0x0004776b991a687b), W(0x0002e1cbcad5b9b4)}
+  },
+  {
+    {W(0x00037923a6d0c442), W(0x0002286eaf622f4a), W(0x0006c88309fd6ead),
+     W(0x0000f15dd0f2dec4), W(0x0001ef44c94cca04)},
+    {W(0x0000a2301c34f176), W(0x0002bda0fda12a64), W(0x00040de1677693be),
+     W(0x0001adf81fbe54e8), W(0x00047ab50af859ec)},
+    {W(0x0000000000000001)},
+    {W(0x0004982197224578), W(0x0000791eea163ccd), W(0x0007e67a335dd787),
+     W(0x0006a54f25e06be0), W(0x0003277872277dbb)}
+  },
+  {
+    {W(0x000123c4aecdd56a), W(0x00063a77067ea56b), W(0x000009da449499ce),
+     W(0x00056a85c1f9cacb), W(0x00041191323015dd)},
+    {W(0x000184a57c8c2739), W(0x0001ba0572ff34dd), W(0x00011b7045e19b24),
+     W(0x0003fb111c70bf49), W(0x000084879c0a1f3f)},
+    {W(0x0000000000000001)},
+    {W(0x000133dc8d02d551), W(0x000532939ce64a0c), W(0x0003a109ac170df9),
+     W(0x00025e18f2c6b473), W(0x0001575832d0eb86)}
+  },
+  {
+    {W(0x00037e2a0cfd34b9), W(0x0005fb9270933f89), W(0x0006fb7ef243b3d8),
+     W(0x00032b9214c6eb82), W(0x00019ecfb1e13c33)},
+    {W(0x0005e1fa2917be45), W(0x00021365b1113674), W(0x0004b252597a6a2a),
+     W(0x0001723d00ee283f), W(0x0001b54f5a460666)},
+    {W(0x0000000000000001)},
+    {W(0x0003e6370481836a), W(0x0000e37e554ce3b2), W(0x000100a4928e23f5),
+     W(0x000560a9d0c0d463), W(0x00029e15d64f9413)}
+  },
+  {
+    {W(0x0007d5502cd2b480), W(0x0006a5d3c3b9787e), W(0x00050dd1cf17ac2c),
+     W(0x000676f65f527246), W(0x0003eb39148bab8b)},
+    {W(0x00061d50448c6526), W(0x00010a83eb013a21), W(0x000311c09d77de8a),
+     W(0x000590918df9c446), W(0x00023e1322072ebc)},
+    {W(0x0000000000000001)},
+    {W(0x0004957120d2285b), W(0x0006819a3fc2a853), W(0x0007cf0f3d5540ee),
+     W(0x0007de6f1581e303), W(0x000407d832d50624)}
+  },
+  {
+    {W(0x00022cc884818ddc), W(0x0000b8ac82e3ca2b), W(0x0001b6bbd2973414),
+     W(0x00067ff3df571a42), W(0x00023ebab94a5d28)},
+    {W(0x0003f0426c2982c2), W(0x00021e0027355c19), W(0x000401b3397df46c),
+     W(0x00079b391f37be36), W(0x000114c9f62955f2)},
+    {W(0x0000000000000001)},
+    {W(0x0002eb660cd86b48), W(0x00011e6a73967eca), W(0x000498d46303ee7b),
+     W(0x0000a38bb021e143), W(0x00012f797f053c62)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0001003a29ded6ea), W(0x00075884d96b2057), W(0x00000238be5ec666),
+     W(0x0005a3f5a9279349), W(0x0007d13c0248b891)},
+    {W(0x000080a6805b20d5), W(0x0000f1d3fd3872a4), W(0x0007331dea787a7a),
+     W(0x00040d48f8d2b63a), W(0x00059a976ab2c01a)},
+    {W(0x0000000000000001)},
+    {W(0x0003dbe86af68fa4), W(0x0004e327a7139366), W(0x0001ec06f378f05c),
+     W(0x0002db1ad1deaa1b), W(0x0006971f543937b6)}
+  },
+  {
+    {W(0x0002161031b1c9de), W(0x000696ba8d4286b5), W(0x000669752b49c608),
+     W(0x0006c7729e13298f), W(0x00017d5a9ff7f338)},
+    {W(0x0000d564a4f6af89), W(0x0007a89df5a3bc02), W(0x0003c2a1eab20f6a),
+     W(0x0007b621e1fc838e), W(0x00073022287d3b73)},
+    {W(0x0000000000000001)},
+    {W(0x0005fefcb68a1b7c), W(0x000758d237691f45), W(0x00044d4bf198af2c),
+     W(0x00052c43e2dd6557), W(0x00030f90cd2f6316)}
+  },
+  {
+    {W(0x0004712f13491d64), W(0x00027dc85a10ed3d), W(0x0006fded5bb78fb0),
+     W(0x00044ebdbe97c65e), W(0x000086f2f768eec2)},
+    {W(0x0004ef154d5ff522), W(0x00061126c06ae9df), W(0x00072b8b5a456faf),
+     W(0x0006507629775280), W(0x00072945a90338f3)},
+    {W(0x0000000000000001)},
+    {W(0x00045bc60f5dff2e), W(0x0002d950f616e065), W(0x000506194821be49),
+     W(0x0004eebdb0925847), W(0x000178ab0c52dde3)}
+  },
+  {
+    {W(0x0002dabc38e74b8a), W(0x0005bfc95c30b618), W(0x0004b5ac832e1110),
+     W(0x000769df6bce08df), W(0x00007a8bc68bf5f3)},
+    {W(0x0002786a22288901), W(0x000072ae99006535), W(0x0002a04c1ef770f8),
+     W(0x0001380c59969051), W(0x0007249d7c47afd4)},
+    {W(0x0000000000000001)},
+    {W(0x00060a2492795d03), W(0x00045636d7a71839), W(0x0002bf2b70ad072b),
+     W(0x0001764d60ec4324), W(0x0001b702c43159b7)}
+  },
+  {
+    {W(0x00057eb877d92bc3), W(0x0004a9c8919c47f3), W(0x000521cc8b02fc95),
+     W(0x000642848ce2dd76), W(0x0004026046d777a6)},
+    {W(0x0002253c1eda97c1), W(0x000668213309fb4d), W(0x0000b2a335443e12),
+     W(0x00060dba3d698d5d), W(0x00059c711b1d9136)},
+    {W(0x0000000000000001)},
+    {W(0x0004038aaae56811), W(0x000423ede3ab6c90), W(0x0006e4a91b27d579),
+     W(0x0002a752753b8e8b), W(0x0002066a2228d322)}
+  },
+  {
+    {W(0x00039efb16d2c34d), W(0x00055c22b4affdc5), W(0x0005192bcee3b265),
+     W(0x00019ef8bbf6be72), W(0x00034f4c8c35f887)},
+    {W(0x0003ae0f9e07bd96), W(0x000362e35b4c1d14), W(0x0004a54ac3256e93),
+     W(0x00021e09c4327664), W(0x000677b89cd3d6f1)},
+    {W(0x0000000000000001)},
+    {W(0x000776be3aba9967), W(0x00025794aa53c048), W(0x000442d9e72cc306),
+     W(0x000431134b6ffa6d), W(0x000329808bdb5506)}
+  },
+  {
+    {W(0x0003ad74ccfef7f9), W(0x000179595432fee2), W(0x00022c582e4088a0),
+     W(0x0003294abe3f819c), W(0x00043aee427724e5)},
+    {W(0x00037244f18d16bc), W(0x0005a307ec1d5299), W(0x000384e581c262ff),
+     W(0x0007dbd9f38d0d3a), W(0x0004356a646eba89)},
+    {W(0x0000000000000001)},
+    {W(0x0002c9ea4e070ca1), W(0x0005cfdd75ad7f49), W(0x00030ba0d5a8ea5c),
+     W(0x00072dd13d70fb4d), W(0x000755e34db37956)}
+  },
+  {
+    {W(0x0004935c2b32ff02), W(0x0001634a8afd064a), W(0x0006919f4d9580ce),
+     W(0x00058f9a52621360), W(0x0005b4fd9f4a9a79)},
+    {W(0x0003265433b08d46), W(0x00005d98b77bed0b), W(0x00063b04dd68f3e7),
+     W(0x0005fc2d24d52393), W(0x00040ebd1230468f)},
+    {W(0x0000000000000001)},
+    {W(0x0007733052b2381f), W(0x00036078e1e4b827), W(0x0003f2c9390cfbc8),
+     W(0x0002f5d7dd346b07), W(0x0003f2517a732677)}
+  },
+  {
+    {W(0x0005572a86ed4487), W(0x000575f1b2af2f0c), W(0x00013df22360ad0c),
+     W(0x0003ab9e632e1549), W(0x00046ccc8cab65fe)},
+    {W(0x0000675e0333635d), W(0x000414bfd89c6e30), W(0x000416c7ef0eaeca),
+     W(0x00053ad09929ef0e), W(0x0004aa14888f317d)},
+    {W(0x0000000000000001)},
+    {W(0x00037d41c2226cb4), W(0x00016925ce50f3e7), W(0x00026ddddcd25a9e),
+     W(0x0000f7770902b5a4), W(0x00043e5cc560bbf4)}
+  },
+  {
+    {W(0x000191558a9b4a11), W(0x00067ad73f8384a7), W(0x00055c31c1f1c8d4),
+     W(0x00021a0423e84a35), W(0x0007fe40f213e2a8)},
+    {W(0x0005add47227c0ed), W(0x0004d4f112d84ea2), W(0x0001ae82bb9cbdb2),
+     W(0x00027e7e8396375f), W(0x0000abbd1ff54b3e)},
+    {W(0x0000000000000001)},
+    {W(0x000391e0d612ca79), W(0x0005382d68d212ee), W(0x000006bf03293998),
+     W(0x0006472fc29a9d1e), W(0x0001c6d03ad72a8e)}
+  },
+  {
+    {W(0x0000e02b3482e958), W(0x0004c2a546ffeed2), W(0x0007696f139f1090),
+     W(0x000231564580038c), W(0x000742f517d0cd82)},
+    {W(0x00077d2295de6c32), W(0x0002d1fef047e180), W(0x0005e74c47c27178),
+     W(0x00018a335b64ff9e), W(0x000545f1fcf0704a)},
+    {W(0x0000000000000001)},
+    {W(0x0004442810b19967), W(0x0005dcb123272c45), W(0x00005d618572d43a),
+     W(0x0000b82a6ca38b66), W(0x00020cd354e3dfc6)}
+  },
+  {
+    {W(0x00008bf519baff46), W(0x000438d488469553), W(0x0003d978097dcf27),
+     W(0x0006e4d6f21044a4), W(0x0002cce4c9ce91ee)},
+    {W(0x0002d4b1c52ce82a), W(0x00061d0291eda54b), W(0x0005b73653800d8a),
+     W(0x00028e547732a025), W(0x0000acc6900ecf63)},
+    {W(0x0000000000000001)},
+    {W(0x0003434af0579234), W(0x0004ef2d5a719029), W(0x00014222d8a29013),
+     W(0x0000b1fb1a01f7f0), W(0x0002faef67007082)}
+  },
+  {
+    {W(0x000753f975b00db4), W(0x00071abb311f1e77), W(0x0000014ddb4cbb46),
+     W(0x00077141535d8944), W(0x0003c5617fffeddb)},
+    {W(0x0007300cb65186e0), W(0x000230c9de9cbdd8), W(0x0002c022708c954c),
+     W(0x00041d8ad38c9ffc), W(0x00056bec6f641c6f)},
+    {W(0x0000000000000001)},
+    {W(0x00026796acd99c3f), W(0x0006c64f65376d9f), W(0x0002d318cc3cfa62),
+     W(0x000667035066304d), W(0x0002866bc93f4669)}
+  },
+  {
+    {W(0x0002db38c2cda20d), W(0x0007cb148c1481ea), W(0x00056e02f7931eef),
+     W(0x0000825ec15d5f27), W(0x000681ea6f8c748e)},
+    {W(0x00075de8de114af5), W(0x0007d7e802eff816), W(0x0005f8376ee91f0c),
+     W(0x000476ba41443ef9), W(0x00027c5342d0eb2c)},
+    {W(0x0000000000000001)},
+    {W(0x000359c8e5ab2345), W(0x00028f133067bc30), W(0x0000411391bc231c),
+     W(0x00071bc1ffc43617), W(0x0003b34059e6d095)}
+  },
+  {
+    {W(0x000011c5f1fb86db), W(0x0001ad51b2699669), W(0x000371e25290772a),
+     W(0x00055955e7c75b40), W(0x00069e487655a6d3)},
+    {W(0x000714127d0dc78f), W(0x00025994c363853d), W(0x0005f5f1c7705c5e),
+     W(0x0003fdaec7af5fbd), W(0x0001d17eceeef55f)},
+    {W(0x0000000000000001)},
+    {W(0x00061a3ea7bdcf3e), W(0x000142cb03d8bdf6), W(0x0000b2b3aee22037),
+     W(0x000021916ea10635), W(0x0006a52a824e456f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0005678a8411a565), W(0x00068f4d089a33d3), W(0x00001f35528e7f84),
+     W(0x00000997aa0fbce5), W(0x0005de7faa2ee4e7)},
+    {W(0x0005e4cef854ec36), W(0x00011203adfedbf0), W(0x00050cb64b03a2f0),
+     W(0x00070555c754c935), W(0x0002c9f23641e1c2)},
+    {W(0x0000000000000001)},
+    {W(0x00032c178a3d4aa1), W(0x0004894ca1aab2e6), W(0x0007ea31aedea51c),
+     W(0x00044276483e390d), W(0x0001e35c1316b640)}
+  },
+  {
+    {W(0x000411b172d04f27), W(0x0007d0291282a4e2), W(0x0000474754cb61d1),
+     W(0x00029b991b31b014), W(0x00074e337a01c13b)},
+    {W(0x00066796114e25f1), W(0x00035c4a7658439c), W(0x0003cd667ecbba17),
+     W(0x00057cb767fd5edd), W(0x00008648f02b3a4d)},
+    {W(0x0000000000000001)},
+    {W(0x00052c87b4b311cf), W(0x000173e079bb48ba), W(0x0005f2251be4a1bd),
+     W(0x00058b581d945a8d), W(0x00050076a3f864d7)}
+  },
+  {
+    {W(0x00014e4390d7c290), W(0x0007c926f3dd69bb), W(0x0007ff2072205381),
+     W(0x00017950cbd3d0b7), W(0x00073ce78c748a87)},
+    {W(0x0005e13a0a0cb2ca), W(0x0007a7f77532928f), W(0x00058381c33ab994),
+     W(0x0007637f1cb1e5fc), W(0x00033c172e606062)},
+    {W(0x0000000000000001)},
+    {W(0x00066cd87ae85547), W(0x0007aae0a6e28abb), W(0x0004604552facc80),
+     W(0x0003018448ffe42e), W(0x0000ef5ed13f5f0b)}
+  },
+  {
+    {W(0x0007475464f29434), W(0x00015744114800e6), W(0x000496e91cff5d55),
+     W(0x00042af416580a11), W(0x0006a6fbd51efa6a)},
+    {W(0x000206b27616d671), W(0x0007ca58789eaf3d), W(0x0005e1c2b7874585),
+     W(0x000615be7c088b0e), W(0x00016f5f8529f55f)},
+    {W(0x0000000000000001)},
+    {W(0x00027228c0c839c2), W(0x000673aed26d706b), W(0x0002aee5b39ea2fd),
+     W(0x0005a176b2bce933), W(0x000653efe2ea6c90)}
+  },
+  {
+    {W(0x0005532a8f320ca8), W(0x0001bf5987794688), W(0x00075dd2cb15d929),
+     W(0x0005affba5f75d88), W(0x000455d905f52d04)},
+    {W(0x000460470fe6a8b5), W(0x000594d8050a8cae), W(0x00031e44ec7bbe6e),
+     W(0x000395b4de113dd8), W(0x000033dbf271d5fc)},
+    {W(0x0000000000000001)},
+    {W(0x0006f0ce50a3817d), W(0x000398e2405b459f), W(0x0000f32156bd7ac4),
+     W(0x000563c1ca0296ce), W(0x00001314a3c06ce1)}
+  },
+  {
+    {W(0x0004643dca20439a), W(0x0003c0923d355e4c), W(0x0001b6ad9d5c1952),
+     W(0x0000b9bfb82f8d48), W(0x000584e7f2a5e367)},
+    {W(0x0000fe4e547c1381), W(0x0001d81ecbb2c45f), W(0x0003a6e210cd1cc8),
+     W(0x0007f4091979ede0), W(0x0002e5327982a30d)},
+    {W(0x0000000000000001)},
+    {W(0x000257c90b8df0e8), W(0x0007655c2fcd0fc7), W(0x0004861fb552d5fc),
+     W(0x0004825d267c852d), W(0x00000276f25e64b1)}
+  },
+  {
+    {W(0x000657c725de8fce), W(0x0005ad57b534cccd), W(0x00078821744738bf),
+     W(0x0005ea70641cec63), W(0x0007783d619f52f8)},
+    {W(0x0005cfc4600c5c4d), W(0x00034201b0471600), W(0x0007a7aff5114eb0),
+     W(0x0004ff41a1091ecc), W(0x0007b87c33701d60)},
+    {W(0x0000000000000001)},
+    {W(0x0006ea66aad8faf4), W(0x0001efd79b351b86), W(0x0005435537abd786),
+     W(0x000631b68dd0b077), W(0x00006d4ffaede82c)}
+  },
+  {
+    {W(0x0004e0c5f69a9634), W(0x0003d5a981c48062), W(0x0003c6ca588dc26a),
+     W(0x0002aa4d9961ce97), W(0x000243eb188de73a)},
+    {W(0x0007b25b1f4ce2f6), W(0x0000821039f4b055), W(0x0002c893328b6fbc),
+     W(0x00016c00f5bd05bf), W(0x0003779298951f45)},
+    {W(0x0000000000000001)},
+    {W(0x0001089e775b3f98), W(0x0004bcb86a15e4dc), W(0x0007bde0969b12c3),
+     W(0x0000275592385f1d), W(0x00047f8fa73cd9a1)}
+  },
+  {
+    {W(0x0006c976ffeb3df8), W(0x0006179b5f196e1e), W(0x000448e770653b05),
+     W(0x00073e6de2ada235), W(0x000592c21fae5dbf)},
+    {W(0x000029bfdccf78a7), W(0x000442e060b640f2), W(0x0002e2773b82f812),
+     W(0x00071dcebf52827a), W(0x000695e57c701008)},
+    {W(0x0000000000000001)},
+    {W(0x000359ad103719b4), W(0x000355e53fea5076), W(0x00047b9904c72769),
+     W(0x00043881c6be08dd), W(0x000582ea811b2f19)}
+  },
+  {
+    {W(0x00037302985fb5aa), W(0x000596f46ba0ac71), W(0x0007876c8d2b4bdf),
+     W(0x000252b36922a401), W(0x00026891e271e465)},
+    {W(0x00043c27ff1cb45e), W(0x000397f8e86e7e8c), W(0x0002c9999133232f),
+     W(0x0004e80b03cfcf9b), W(0x000499f5f05649eb)},
+    {W(0x0000000000000001)},
+    {W(0x0002e14d408e3f59), W(0x0001e416dc6a2f36), W(0x0007ead8aad938d3),
+     W(0x0007d772b6abd21e), W(0x0004744056539022)}
+  },
+  {
+    {W(0x00058f395b48a215), W(0x0000d04cdf163f06), W(0x0005943001a4b1dd),
+     W(0x000407284e7dd96d), W(0x0006f45a5099fa30)},
+    {W(0x0003527c86be91a7), W(0x0005c80901ddb66e), W(0x00048d335e8238e9),
+     W(0x00014474074f27a2), W(0x00052d29f70b2d1f)},
+    {W(0x0000000000000001)},
+    {W(0x0004bb881ec4750d), W(0x000666f2357c21ad), W(0x000210a90d11b343),
+     W(0x000167c27150b277), W(0x0006e94c47573654)}
+  },
+  {
+    {W(0x0006b768f312de74), W(0x0006b03b8d1dd86c), W(0x00058ca366ae6556),
+     W(0x0006b63ab4a045b6), W(0x000297b327e2a5cc)},
+    {W(0x0007194d7422cc02), W(0x00054a2ed6bb5800), W(0x000350997c2a9aa8),
+     W(0x0006013fc42457de), W(0x00015dde9cfe1f2b)},
+    {W(0x0000000000000001)},
+    {W(0x0002ced071986816), W(0x00014402eeaf954b), W(0x000726151770c3e5),
+     W(0x00076e087850d9a5), W(0x0003da68a9af06c8)}
+  },
+  {
+    {W(0x0001bb9fdb8d7911), W(0x0004baee82d6a3bf), W(0x0005a2d342f8ecff),
+     W(0x0006e2f7354394e2), W(0x0002cb62bbfe415f)},
+    {W(0x0002e818dd4f3a28), W(0x0007e96a181a2320), W(0x00060084b995ad2c),
+     W(0x0005627c9abd1e33), W(0x0001db9c5f1c6b42)},
+    {W(0x0000000000000001)},
+    {W(0x0003097ac6361f66), W(0x0002d60b4cd54ad4), W(0x0004d5b03cb514a8),
+     W(0x0006f556ed94651a), W(0x00066ecda75bfcd2)}
+  },
+  {
+    {W(0x00029877bf3ecc82), W(0x00024f1e238c9c17), W(0x00075b693a610ed1),
+     W(0x00018591c021a993), W(0x0006c64811fe59e4)},
+    {W(0x0000dbe7462cdd83), W(0x00044439089d1eee), W(0x00024de89997c32c),
+     W(0x00063f27009dd570), W(0x0004a0e9574d2dfd)},
+    {W(0x0000000000000001)},
+    {W(0x00008a7276350765), W(0x0003712493dfddb0), W(0x00069f4c6d9bc295),
+     W(0x0001e8ba5a67e7d7), W(0x00022f6b30058c0d)}
+  },
+  {
+    {W(0x0006acd570dda681), W(0x0001bf70f4c33182), W(0x0005a6b5adcfeb4a),
+     W(0x00034a6fa86cb4c1), W(0x0005ba4273504da0)},
+    {W(0x00075e2bb156b168), W(0x00000fa11fce44be), W(0x00039631f39e073b),
+     W(0x0004c6e055387742), W(0x0007bd8e7dbaf92c)},
+    {W(0x0000000000000001)},
+    {W(0x0005bd5a12e51445), W(0x000450101afd4b2a), W(0x0003c22b5a8b08b5),
+     W(0x0002cb040cf94d1e), W(0x0005052c1899e786)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0007dd9a8c9ab5ed), W(0x0004ea5b28effe84), W(0x0003b488c6959736),
+     W(0x0006d6a5402db1d3), W(0x00006b349eebfed4)},
+    {W(0x0006e990608b64f8), W(0x000646c0f72ee89b), W(0x0001237d97d54308),
+     W(0x0007cd55b4551ba6), W(0x00007a09289ff3e1)},
+    {W(0x0000000000000001)},
+    {W(0x000365248a70d6c6), W(0x00056bbc86877936), W(0x0005f571df47f37d),
+     W(0x00038b28160f422c), W(0x00001da3df9e7259)}
+  },
+  {
+    {W(0x00014ac0199c4f7d), W(0x0002d65d755f3d86), W(0x000753457d9a8e70),
+     W(0x00056d558e495c76), W(0x000482a4cdf57d9e)},
+    {W(0x00013b116e4eb04b), W(0x0004a4bc9fad57aa), W(0x0001464a60fc457e),
+     W(0x0003d4059e2fe30a), W(0x0007391de4381c2f)},
+    {W(0x0000000000000001)},
+    {W(0x000565b6e1547588), W(0x0005a0761d70df32), W(0x0001b0668b9699ad),
+     W(0x00035710fde6f6af), W(0x00063dfba77de9f1)}
+  },
+  {
+    {W(0x000665bf751e85a7), W(0x0006249d017d5015), W(0x0004060769c386a6),
+     W(0x00011289c2870df8), W(0x0003010b9cf57738)},
+    {W(0x0007cc63e268da41), W(0x00077a2277f49742), W(0x0004a8d119a3cd2c),
+     W(0x0006dbbd34bb3ba3), W(0x00020b530d1f5061)},
+    {W(0x0000000000000001)},
+    {W(0x0001d633fb12ed88), W(0x0005db8a35f05f52), W(0x0006047869758507),
+     W(0x0007933c507f4335), W(0x00001839a75b9196)}
+  },
+  {
+    {W(0x00031f2a339f8f3c), W(0x0007a3ffed11e668), W(0x0005f731a2fdadcc),
+     W(0x000226e625923609), W(0x0003bad86defe0d2)},
+    {W(0x000373dc01815179), W(0x0007ed1d536ddc0a), W(0x00012e354e105170),
+     W(0x00054615c4cfcfe0), W(0x0002de3cdf2fa86b)},
+    {W(0x0000000000000001)},
+    {W(0x0000abe641df59b3), W(0x0007c15b5b2f2e52), W(0x0004885ae36ed45b),
+     W(0x0000d47dbd3da29b), W(0x000631e75b5a2913)}
+  },
+  {
+    {W(0x0002d2ccc866b208), W(0x000070725a2a78b3), W(0x000489fa8b2a8d29),
+     W(0x000170a47927906e), W(0x0005c08c8a6bce54)},
+    {W(0x000520c62bdc8c2b), W(0x0003b37873389533), W(0x0002bd5efd0dd9bd),
+     W(0x000335ec8eb434a1), W(0x0005a2179b1e69c8)},
+    {W(0x0000000000000001)},
+    {W(0x0003563ef7c8f4d4), W(0x0004e37acf7a0792), W(0x0004688c4d608c45),
+     W(0x0003bdc18550f162), W(0x0003c3c79b17ebcd)}
+  },
+  {
+    {W(0x00043ddb5a29f906), W(0x0003ac0d79956a50), W(0x0006458cd8392ade),
+     W(0x000744cbd84ad056), W(0x000287ce53c7dcf4)},
+    {W(0x0004bdc6fd98692e), W(0x0003afc8935bf959), W(0x0003089efdb6272a),
+     W(0x00045a95802366fc), W(0x0002de90989b74e5)},
+    {W(0x0000000000000001)},
+    {W(0x00025fd610c2eb80), W(0x0003f5b3aae256f4), W(0x0006c24fdbf5f1c7),
+     W(0x0001ae83d823d858), W(0x00071f50c46588a8)}
+  },
+  {
+    {W(0x00073a8d2b1ebf8c), W(0x00022200ac694cb2), W(0x0003a6cff6836a87),
+     W(0x000154e76762905a), W(0x00067833164294b3)},
+    {W(0x00056eb7eb9e72ea), W(0x00032627941bb746), W(0x0006eea5928ecb0f),
+     W(0x000517457a7948b0), W(0x0006215fb622515f)},
+    {W(0x0000000000000001)},
+    {W(0x000477fb1dc1e953), W(0x00018d4f223a43ef), W(0x0005b00ec2c2615e),
+     W(0x0004da103fe95b06), W(0x00061791a2bc00ef)}
+  },
+  {
+    {W(0x0004b005cb75be54), W(0x00078950c4dcf6ea), W(0x00008b51189f3c67),
+     W(0x00068deaf408ad4b), W(0x00045afc85dc571e)},
+    {W(0x00009e4957777b40), W(0x000441703dc46730), W(0x0006e050bdeb6f3c),
+     W(0x00063b8f1cd0c7ab), W(0x0006c0c8abfa60bf)},
+    {W(0x0000000000000001)},
+    {W(0x000028f0232c3a91), W(0x0007cef11cae1db7), W(0x00005452942a8181),
+     W(0x000003044405b77a), W(0x000238ff7fce50e0)}
+  },
+  {
+    {W(0x0004ae4d1f4c31bb), W(0x0006aee7dfceb7ae), W(0x00059827327316af),
+     W(0x0005612fcab7625c), W(0x0005420b7d059ada)},
+    {W(0x000472669b2294ed), W(0x0006b6071334d380), W(0x00060579b158b398),
+     W(0x000316297990b42a), W(0x0002baf3e3def017)},
+    {W(0x0000000000000001)},
+    {W(0x0001ee1dab902192), W(0x000612423685c742), W(0x00055cfe3c3b06c6),
+     W(0x00010ec4ed92561b), W(0x0007487b733899a5)}
+  },
+  {
+    {W(0x00070c8326ef47e6), W(0x0004aa9a129abb48), W(0x000492e0719074ba),
+     W(0x0006f4d0b8e88f80), W(0x00004d719519b229)},
+    {W(0x0006ce638a11d500), W(0x000632d95120e2b4), W(0x00015b4fd4d2038b),
+     W(0x0006934a2ab7d2ba), W(0x00064f3fadca465e)},
+    {W(0x0000000000000001)},
+    {W(0x0000205cde0ea2bc), W(0x000691cfec5f501e), W(0x00066487cf965fa8),
+     W(0x0004fe290250936b), W(0x0001d21a988ae0b5)}
+  },
+  {
+    {W(0x000137f7d5a775b2), W(0x0004352800ae9bfe), W(0x0002e27f1e754b8b),
+     W(0x0004647ff6b0e319), W(0x0000880e9e4f5954)},
+    {W(0x0002f68991be401b), W(0x0000d1c33030f221), W(0x00033c6b28450eca),
+     W(0x00071725be0d5652), W(0x00053dfe2e0fb3d5)},
+    {W(0x0000000000000001)},
+    {W(0x00074470b6a0021c), W(0x0005b238c4273934), W(0x0004d60d43ced5b8),
+     W(0x00014c1b2654f07c), W(0x0004805d068e8447)}
+  },
+  {
+    {W(0x0004e37449c364a7), W(0x00059391d5f0897a), W(0x0002743bc213175d),
+     W(0x0006b74afc3a4b94), W(0x000543d9b2ce0a62)},
+    {W(0x00005bd586f21021), W(0x0002ab8200382327), W(0x00002ac9bb426afd),
+     W(0x000565d6de60909f), W(0x00021052643f10d5)},
+    {W(0x0000000000000001)},
+    {W(0x00014fad34813eb5), W(0x00071850ecd34ed3), W(0x000679bbe48ba522),
+     W(0x00055fb8fcb52328), W(0x0002102bdc287787)}
+  },
+  {
+    {W(0x00052f2520697f7a), W(0x00076564b5091908), W(0x0006761ebeee6a78),
+     W(0x000416954d1932b5), W(0x0001815a9c6e0eca)},
+    {W(0x0003a388669e8e0b), W(0x0005732b571af9b8), W(0x0003b19ab834718b),
+     W(0x00037f8bbda41135), W(0x00009cefc2ccfeb3)},
+    {W(0x0000000000000001)},
+    {W(0x0001f66ac25db534), W(0x0005f2f6b31a130b), W(0x0002592b8e6f9518),
+     W(0x00015306319a4017), W(0x00053a1b024bdd16)}
+  },
+  {
+    {W(0x0001e0d52fb84c81), W(0x0002ce1e9398d993), W(0x0001774a61079efb),
+     W(0x00026b0fa7016aba), W(0x0002b34ae69b4706)},
+    {W(0x000419a66651e0c9), W(0x00069d620699c72d), W(0x0001f6b259821f13),
+     W(0x00045e83743bf20c), W(0x00032453b12df5be)},
+    {W(0x0000000000000001)},
+    {W(0x00040977cbfee923), W(0x0006b34e4b683215), W(0x00061075c693c3a7),
+     W(0x000271cec1e77836), W(0x00042fe055426da2)}
+  },
+  {
+    {W(0x000625e5294b17ad), W(0x000236ec925bff70), W(0x0006b0877ebdd2c7),
+     W(0x00059acd51e57852), W(0x00051073ed947634)},
+    {W(0x000461b44cdaa183), W(0x0001bb04b5624c73), W(0x0001bb65aa1f520f),
+     W(0x0001aef0d334b40f), W(0x000209630312336a)},
+    {W(0x0000000000000001)},
+    {W(0x000238066f2f2671), W(0x00049a3ccb0708b6), W(0x0000d792f7de38b0),
+     W(0x00045f9c945f823b), W(0x0005ed6704b0cf9b)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0000cf27d8d43a77), W(0x0001bbb953ae543d), W(0x0005095bb5e76a58),
+     W(0x000013358e63b00a), W(0x0000af367956af63)},
+    {W(0x0001bd2f2ba408c5), W(0x00001c96d4c55026), W(0x00025ac2c8f76a44),
+     W(0x0001d9b846e94567), W(0x00021108d900134d)},
+    {W(0x0000000000000001)},
+    {W(0x000190d2c605c7af), W(0x000227606de89978), W(0x00020b9b6aaf6f8f),
+     W(0x0005eb00b32efe6e), W(0x0004f6109bb8d7db)}
+  },
+  {
+    {W(0x0007074fbae70d33), W(0x0002d8b40fbd51bb), W(0x00056c6d5f96c2c7),
+     W(0x0005ad320a09a2fa), W(0x0002b760154fc5ce)},
+    {W(0x00063696afc20c02), W(0x00056d440a9c495f), W(0x00068b3b5d8a7ecb),
+     W(0x0001701b9a08901f), W(0x0007dc81af96fed4)},
+    {W(0x0000000000000001)},
+    {W(0x00060c53f3fb22e0), W(0x0004c4757a160430), W(0x0001b2bd2a8d9f2a),
+     W(0x0005137080fab145), W(0x0000a00274f89820)}
+  },
+  {
+    {W(0x00023f36e811b9d8), W(0x00011e3a7b995828), W(0x000675ed453cf48f),
+     W(0x000279d550726c46), W(0x0004535c89311d60)},
+    {W(0x0007bf9008d63661), W(0x0002b081ed92ef54), W(0x000201ab24dcb4cf),
+     W(0x000470d551051ec8), W(0x00069dd3661ba84b)},
+    {W(0x0000000000000001)},
+    {W(0x000479b938c463d8), W(0x00049e7dd1f8a50d), W(0x0006f9746e0e0364),
+     W(0x0000328a0865cb2b), W(0x000753a822295546)}
+  },
+  {
+    {W(0x000492c69c5bdb6b), W(0x00070eb718b5e477), W(0x00065212db5be90b),
+     W(0x00069c3c2449cc31), W(0x00067dbc33418bbc)},
+    {W(0x0007b056093af396), W(0x0001072363ca2f8d), W(0x0001ea88943327a9),
+     W(0x0001982cfe4973e5), W(0x00038436fdf8589a)},
+    {W(0x0000000000000001)},
+    {W(0x00077f71f1a14956), W(0x00011fe538475b39), W(0x0001c4f8360bd73c),
+     W(0x0000b8041409a633), W(0x0001ce557a72a788)}
+  },
+  {
+    {W(0x000249b3ebdd1011), W(0x00012f437b17b475), W(0x0007173f5d884de5),
+     W(0x000586375e7b19c4), W(0x00069f0b68125b9a)},
+    {W(0x00037a47dc3669d6), W(0x0002ec78aa467a8d), W(0x00078cb7f911386b),
+     W(0x0003a3487665627d), W(0x0000d2a89a19c281)},
+    {W(0x0000000000000001)},
+    {W(0x00019491957c0200), W(0x0005f3d6003062ad), W(0x0003edb5aeb1f1c6),
+     W(0x0007bd15a3e2bac2), W(0x0003d3e549f6c4cc)}
+  },
+  {
+    {W(0x00055ffa5112f8eb), W(0x0002a063fd4ce313), W(0x00027e3d4f7f2a35),
+     W(0x0002166846366960), W(0x00034d9729a3945d)},
+    {W(0x0003cf404c6279b1), W(0x00066c9cec06e1b6), W(0x000385a1c1f00554),
+     W(0x0001275a30aa7728), W(0x00065efef05bd03d)},
+    {W(0x0000000000000001)},
+    {W(0x00013dda03194fd0), W(0x0006747301b7f7f5), W(0x0003843f078a3173),
+     W(0x00032e845d8c7ff1), W(0x0001ffbd466cadac)}
+  },
+  {
+    {W(0x00030403c96f4e4c), W(0x0000f2fcc2114b1c), W(0x0007219fd127c222),
+     W(0x0001414193b15434), W(0x000271b64006d3d0)},
+    {W(0x000045df50bdd7d9), W(0x0007207dbd956650), W(0x0007600ec14fbcb9),
+     W(0x0000e17e3247881c), W(0x0006e0746310b9c0)},
+    {W(0x0000000000000001)},
+    {W(0x000030f02644f45d), W(0x0007860d4d4d2a40), W(0x000173d1dbdd7b98),
+     W(0x0005aed7e7ea0f4f), W(0x00048121f27758f0)}
+  },
+  {
+    {W(0x0004e9bd19448479), W(0x000515054dd8188a), W(0x00017c89c7550e6e),
+     W(0x0003dc59effd00ee), W(0x00029ea44a50a4b4)},
+    {W(0x00055f63af509005), W(0x0003f2e713bc33d3), W(0x0005aac918c2b1b0),
+     W(0x0005465deda5e88c), W(0x0006c775ac8ab2ed)},
+    {W(0x0000000000000001)},
+    {W(0x00052966d7e75326), W(0x00030bc2394d7728), W(0x0006a165894871ea),
+     W(0x0005f0f88de506b2), W(0x0006ad4ec136213f)}
+  },
+  {
+    {W(0x000235ddf59cc125), W(0x0001e341e1171281), W(0x0007c82b838189a4),
+     W(0x0001b9558bed279a), W(0x00061876581d168c)},
+    {W(0x00012851c3d0b7ef), W(0x00037cc93bdfcbf2), W(0x00067d55c5f7bf66),
+     W(0x0000ff36eca4f681), W(0x0002081dd6763c0b)},
+    {W(0x0000000000000001)},
+    {W(0x0000c6100c2507c5), W(0x000654708dd8bc52), W(0x0001ca8a5b0eb07f),
+     W(0x0004334b78c528c9), W(0x000632ec4cbee33a)}
+  },
+  {
+    {W(0x0000702c9b3915bf), W(0x0001c3912bc46fdd), W(0x00046e4a71f4abb9),
+     W(0x0005aabdcb3d9bd4), W(0x0000b5da3103feb3)},
+    {W(0x0004ae2f22fc2965), W(0x0007e43b94613257), W(0x0005b38aa9f0200c),
+     W(0x00065ff9e1800d53), W(0x00046fcfccdd73cf)},
+    {W(0x0000000000000001)},
+    {W(0x0003c1cb849563ef), W(0x0007f7f39ff90952), W(0x000109f80906799d),
+     W(0x000363a88f99901f), W(0x0004a2fc936b4f74)}
+  },
+  {
+    {W(0x0001e252a225d5a9), W(0x000595ab432422c4), W(0x0007f6af7340a8bb),
+     W(0x0004531599a8c937), W(0x0003a621b61867fd)},
+    {W(0x000402996579254e), W(0x00061d434ddfcc07), W(0x0005cfd9f8933214),
+     W(0x0001105dffbc246f), W(0x0006252a37636565)},
+    {W(0x0000000000000001)},
+    {W(0x00014aca914175c9), W(0x00025c250a7c52e0), W(0x0005c46e2818a0ae),
+     W(0x0004f66dff96d5eb), W(0x000015e558b95573)}
+  },
+  {
+    {W(0x0006f809f699256c), W(0x0003540aa55e5a24), W(0x0000a0053f761de6),
+     W(0x0006fa9bec2b0a67), W(0x0006021ac0eaecc0)},
+    {W(0x00076a9c57e8afeb), W(0x0006cecb1b01be5c), W(0x00027b3fc22d1b04),
+     W(0x0003026aad212743), W(0x0004de9ab9762047)},
+    {W(0x0000000000000001)},
+    {W(0x000562ec974396f8), W(0x0002478c1e254bc5), W(0x0002bb5c98ea2a83),
+     W(0x000437a494c1ffc0), W(0x00039c51f9b4d9e0)}
+  },
+  {
+    {W(0x0004b12f984eb091), W(0x00033134eb0ef60e), W(0x0006d6aad58f6f68),
+     W(0x00062a146359b4d9), W(0x0004692a0cda9621)},
+    {W(0x00074601bff8fc64), W(0x00036e414684d9b5), W(0x00005b961618fa19),
+     W(0x00019a03e7ac3b61), W(0x00068950b4c70b62)},
+    {W(0x0000000000000001)},
+    {W(0x000028dd880d2f21), W(0x000656d262651e25), W(0x0004887df11da171),
+     W(0x0006c6e7a565fd91), W(0x0003000ee0b567e7)}
+  },
+  {
+    {W(0x00058ce1b80f5dc1), W(0x00045f079874f5ef), W(0x0005bef1d2699a34),
+     W(0x0007017192dca8c8), W(0x0001f070df6f21f5)},
+    {W(0x0005df2a42aadb7c), W(0x0002b2a236034a4c), W(0x00027cfa000695e3),
+     W(0x00005c65f0ffe0c4), W(0x0000e0947b667869)},
+    {W(0x0000000000000001)},
+    {W(0x00058c00f42314d7), W(0x0007c04e49619484), W(0x00037822c13a770c),
+     W(0x0000b5c7986b630b), W(0x000126aa8dbd1e4b)}
+  },
+  {
+    {W(0x000653a8cb4f6116), W(0x000490d144ead5f6), W(0x00055665048e9881),
+     W(0x0007ab618b4c8d07), W(0x0003a135b6f2dc60)},
+    {W(0x000066ae313ce7d6), W(0x0005b950d9056adf), W(0x0001b9d2cbaa1bd5),
+     W(0x000197682f41dcc2), W(0x00034a352b673dcd)},
+    {W(0x0000000000000001)},
+    {W(0x000002fe0b7e9422), W(0x00057db6916248a1), W(0x0003420f21095ebf),
+     W(0x00024e9ce066379e), W(0x0004d803ea3022ac)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00032f6da1afbe2b), W(0x0001a71c1c71f621), W(0x00041c55286d042f),
+     W(0x00016f74dc6e37f9), W(0x0001e45a60140a3b)},
+    {W(0x0007072c8dda0a76), W(0x00020875a08fb127), W(0x00079a2b2d1f49b9),
+     W(0x0006b06979920d42), W(0x0000e730da473dff)},
+    {W(0x0000000000000001)},
+    {W(0x00075527bea1547b), W(0x0000ad796f293235), W(0x00023af6363eddff),
+     W(0x0003c69c13ea4de5), W(0x00021eb8f5b3f0b8)}
+  },
+  {
+    {W(0x000590aabec9935d), W(0x0004960fce7f7379), W(0x0006c50509115e61),
+     W(0x00007f9161e0f557), W(0x00061708161cb466)},
+    {W(0x0004cd21feb9820d), W(0x0005ce49c1931eb8), W(0x00077e5687e1261f),
+     W(0x0002be0310de96c7), W(0x00038d6936d12e81)},
+    {W(0x0000000000000001)},
+    {W(0x0000fa90dfd66a3e), W(0x0006b2fe33280a60), W(0x0001953d0cea5fbd),
+     W(0x0003bf206e396ca1), W(0x0007c653a1fb241c)}
+  },
+  {
+    {W(0x00004ee3d2a0a1cf), W(0x0007639c4cf95b1f), W(0x0006b5e048560ac8),
+     W(0x00065d214774c63a), W(0x0001dd4f67ca8332)},
+    {W(0x0004c5131bd34cf1), W(0x00064985d47cd41e), W(0x00015837ea410e80),
+     W(0x00069dd0fd1f9b88), W(0x00054551dca553d2)},
+    {W(0x0000000000000001)},
+    {W(0x0005065be3abde74), W(0x0002c4338d6c85d9), W(0x0004b88c4a16051f),
+     W(0x000368675af90504), W(0x000242aa4c29b051)}
+  },
+  {
+    {W(0x00027defd951f791), W(0x0004cff71d226028), W(0x00020e0085905d26),
+     W(0x0000ac84b0263196), W(0x00048f4513977929)},
+    {W(0x00072f088322d560), W(0x0003510dad27d33f), W(0x0004a8c499496f9f),
+     W(0x00015b48346f44f2), W(0x000315385d3bd5a2)},
+    {W(0x0000000000000001)},
+    {W(0x0002b3b25b51c5c5), W(0x00055aadfdf67653), W(0x00031aa59653c706),
+     W(0x0003cd65565ab105), W(0x0000f5fb0963fe9f)}
+  },
+  {
+    {W(0x00008ed3387d5650), W(0x0006650051f66be1), W(0x00059f1b62fc555c),
+     W(0x0002335c4da78fd3), W(0x00070e7d5a62d4e8)},
+    {W(0x000706dd036d3d67), W(0x000421622383fd02), W(0x000059e28918f602),
+     W(0x0003c3027c10e19d), W(0x0000a2a397784bfd)},
+    {W(0x0000000000000001)},
+    {W(0x0002adb25ae867b5), W(0x000291574c7fa918), W(0x0005cb0a8e06b9af),
+     W(0x00022d6b9f202003), W(0x00024e7d4c5729d2)}
+  },
+  {
+    {W(0x000513f842fcce62), W(0x000603eadb1930ee), W(0x0003985292eb7ca0),
+     W(0x0007667c291f5607), W(0x000048040d8dc65a)},
+    {W(0x00002826ba79535f), W(0x0006e49ff32583e0), W(0x0003309db2bb8631),
+     W(0x0004804f6689e3fb), W(0x00033fb866f75431)},
+    {W(0x0000000000000001)},
+    {W(0x0003041a6ef4719f), W(0x00046e7623e05012), W(0x0006202601eb0f5c),
+     W(0x000647a7ea9ffd33), W(0x0001a26beac678ad)}
+  },
+  {
+    {W(0x00070f9fc17f2e7c), W(0x00000d4f8b946111), W(0x000379b3ecc08e0e),
+     W(0x00062433a1dd7c8a), W(0x0006e9bb2b90bc98)},
+    {W(0x00062ea053103aae), W(0x0004254de7b9e6e3), W(0x0005c384cf540b4d),
+     W(0x0002a16405088201), W(0x00051d3daf8b8b95)},
+    {W(0x0000000000000001)},
+    {W(0x0004b4a209d03495), W(0x0006d7c79e64a645), W(0x000030e5c46decbf),
+     W(0x0001a15e6f4d0216), W(0x00079b5edae10e2d)}
+  },
+  {
+    {W(0x00024b3cf9dcced8), W(0x000757c6c5e583b4), W(0x0004c3e772f337f1),
+     W(0x0003c7726382ffde), W(0x0007956a04df8621)},
+    {W(0x00028453baf6e782), W(0x000554679fe69461), W(0x000656db77a8de85),
+     W(0x0007aa8f3b0cbc59), W(0x0005eeac17f2e772)},
+    {W(0x0000000000000001)},
+    {W(0x00055ba7dead3579), W(0x00030bed58f65970), W(0x000024ed62ffabf8),
+     W(0x00077aa3821ef78c), W(0x00028749be1e95f4)}
+  },
+  {
+    {W(0x0005b3de40625ea7), W(0x0001c9984be06669), W(0x0006deeab1c29116),
+     W(0x000001515cf5f006), W(0x0001903f688d9c89)},
+    {W(0x00056451ee9f6714), W(0x000250231da1fb45), W(0x00047d91b1a3ecc0),
+     W(0x0007dbf2ac5feb5b), W(0x000704a75d260a3e)},
+    {W(0x0000000000000001)},
+    {W(0x00059e2487cdfe74), W(0x0004650f52ab9aa5), W(0x0000b0bcb9e55c64),
+     W(0x00067b9dd0b0616f), W(0x00054e6bd3387935)}
+  },
+  {
+    {W(0x000030922937ec7f), W(0x00044a6f93a4888f), W(0x00025b5915bac357),
+     W(0x0007a1564ee1b9dc), W(0x0003180d146193e5)},
+    {W(0x0004692d771314cf), W(0x0002508a274ada9b), W(0x0007aef4bc08cc86),
+     W(0x0002067bfe3af9c0), W(0x00015cc11661d2e7)},
+    {W(0x0000000000000001)},
+    {W(0x0003642c7f6d4c59), W(0x00002fffffbeb2ac), W(0x000488074d5fc306),
+     W(0x0004a2db6cdf21bf), W(0x0003b2627c50a2da)}
+  },
+  {
+    {W(0x0000dc97e627161f), W(0x00028ca557d6f264), W(0x000121b6fbe4450d),
+     W(0x000769cc3d63abab), W(0x00060e4ac7c44a0d)},
+    {W(0x00006614b3e0a24f), W(0x0007f85d4c3b9d93), W(0x00017d048b13d647),
+     W(0x0001495757505a1a), W(0x0002a03ff91c3ff5)},
+    {W(0x0000000000000001)},
+    {W(0x0001f17a81f30ec3), W(0x00056250f816a7a3), W(0x0001d27c584be0c8),
+     W(0x0000ac5f5229e751), W(0x0002126de32cc5ee)}
+  },
+  {
+    {W(0x00063307a96ee183), W(0x000633e3997ff067), W(0x00065c1f8726d28e),
+     W(0x0006a0674791fc7f), W(0x0002d4316db5e2ef)},
+    {W(0x00034381f70238ba), W(0x0001476029e41470), W(0x0007203f18c4e012),
+     W(0x00061fc417fd6bef), W(0x0007245a6c4760cf)},
+    {W(0x0000000000000001)},
+    {W(0x0001ae9dc394a841), W(0x0003881bb11514be), W(0x000177005e7e263c),
+     W(0x0003234b945d202c), W(0x0007244165ae2d55)}
+  },
+  {
+    {W(0x0006c181fb03b0ca), W(0x00022185900bb30e), W(0x0000c38dfd97fd3c),
+     W(0x000242153e79953c), W(0x0005c01485fda983)},
+    {W(0x0001c5cfcb188724), W(0x0000df29dea62375), W(0x0005519cbcddb46f),
+     W(0x0003232888214c8e), W(0x00018856eef44928)},
+    {W(0x0000000000000001)},
+    {W(0x00037595ef55bec1), W(0x0004a15dc7e5551c), W(0x00041acfcac155cb),
+     W(0x0001b3e3b50a3cdb), W(0x0005493818437a3d)}
+  },
+  {
+    {W(0x00052f429fd8a5ce), W(0x000486ff16431125), W(0x0002e9f134c6bd80),
+     W(0x00021050d27e13ca), W(0x000335cc77df6495)},
+    {W(0x0007e01bd858cde7), W(0x0005b7af51cbc5e4), W(0x0005fa969a574e8c),
+     W(0x0003c3d18a9736db), W(0x0007742524925042)},
+    {W(0x0000000000000001)},
+    {W(0x00064019741a7e11), W(0x0002a2bf10e8597e), W(0x00078150ee0363c1),
+     W(0x0002d1b670d24fb8), W(0x0004d54cca720f9b)}
+  },
+  {
+    {W(0x0003243785836b50), W(0x00007d53b6b0adc0), W(0x00028c55ee0f43f1),
+     W(0x00037468cfa31539), W(0x00069c3a2b23af72)},
+    {W(0x00008549aa0a8d15), W(0x0007025cb3fc3538), W(0x00027acf131dd450),
+     W(0x00072006d171c7f2), W(0x00006ea70f9c8d8d)},
+    {W(0x0000000000000001)},
+    {W(0x0002e724bb190e08), W(0x0007749108c82eb0), W(0x000325abe6164da0),
+     W(0x0007a36f086cdbe5), W(0x0007b7e8c7960f7b)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000797a46abc0cbb), W(0x00020e5bcde5b262), W(0x0000ca003cb02070),
+     W(0x000462eed5ea13b4), W(0x0004d1e116d13615)},
+    {W(0x00061efb10c9b91a), W(0x00076bd149709e89), W(0x0004023e310fa12d),
+     W(0x0002db2e6289aa5a), W(0x0006d415be49d4e3)},
+    {W(0x0000000000000001)},
+    {W(0x000248db5682ed71), W(0x0001dc7ba9000cae), W(0x0000b9e21607af00),
+     W(0x0004617ff4f77aba), W(0x0007a979779ff7fa)}
+  },
+  {
+    {W(0x0002148248127d15), W(0x000658297a8659a8), W(0x0003e38bb230a985),
+     W(0x0003eedf71ca2292), W(0x0004b5bae5a77a86)},
+    {W(0x0003b8de209a77cb), W(0x0004af7181f41b24), W(0x00019d0bb2dabb2e),
+     W(0x000090cc3ad22c07), W(0x000739476e0b3847)},
+    {W(0x0000000000000001)},
+    {W(0x0003e04a58ec63f8), W(0x00049886fc039f4e), W(0x00072644b443e4a6),
+     W(0x0005c6fbbeafb010), W(0x0000e40895ab3ae5)}
+  },
+  {
+    {W(0x00067e5a18ecc8f9), W(0x0000f8e7374be3e2), W(0x00020b53c6b986ae),
+     W(0x000278281c2d3acc), W(0x00028e01e9eebe62)},
+    {W(0x000682a0a58a68c1), W(0x0006d36c8bc54f6e), W(0x0005c412374e86d3),
+     W(0x00014db149d3e0d5), W(0x00034a3ef2080894)},
+    {W(0x0000000000000001)},
+    {W(0x00001a664f9bdbe3), W(0x00050e898f4410b9), W(0x00003891d92af558),
+     W(0x000510a4698251c0), W(0x0002d139c373b6ee)}
+  },
+  {
+    {W(0x00033f232869fcdf), W(0x0003be66e4877f0b), W(0x0002a26341ac8b54),
+     W(0x000789f0837fe7b6), W(0x00033bfa90cc1b9d)},
+    {W(0x0005824fb2da81d9), W(0x00003a5e21302873), W(0x000405f4b7d2b3bc),
+     W(0x000572cfd2fff884), W(0x00053b120db6327c)},
+    {W(0x0000000000000001)},
+    {W(0x000155c029d95cab), W(0x0000a35c7db915d2), W(0x00065d0832d6eb84),
+     W(0x00053e0ac979473d), W(0x00046dae663fdc68)}
+  },
+  {
+    {W(0x00070b4a1110cc99), W(0x00077b444058d29e), W(0x00029aecabcdb38a),
+     W(0x00064388b7fb4166), W(0x0006759a4f961d6a)},
+    {W(0x00043f61ecf8af35), W(0x0004c0b7c2cc6794), W(0x000000db52c40468),
+     W(0x000263d92c8908b0), W(0x0007e6c7c2dca5f4)},
+    {W(0x0000000000000001)},
+    {W(0x0005c433c7226b49), W(0x000534aa6c709c4c), W(0x00041912f8d4f5cc),
+     W(0x000398016e32b8a2), W(0x00065404dba63722)}
+  },
+  {
+    {W(0x000434a9ade80267), W(0x0001b8f55022be1a), W(0x0001339dd7aa521d),
+     W(0x0000f3c3b487024a), W(0x00056bec70310915)},
+    {W(0x00066b33ec86fb32), W(0x00060d9f59056a25), W(0x0005c4301739f91d),
+     W(0x0004666e532b5a79), W(0x0006ab2ddd075077)},
+    {W(0x0000000000000001)},
+    {W(0x0007e484bad1600c), W(0x00014a6bf4cf32e5), W(0x00050382a526b5e6),
+     W(0x00032df147b9286c), W(0x0006eb24d5673c2d)}
+  },
+  {
+    {W(0x0003d6530a7c82bc), W(0x0004f6bd651a0841), W(0x0000a7158c176b82),
+     W(0x00033ed6f9d40bd0), W(0x0004bbefbdc2c608)},
+    {W(0x00063f6849538107), W(0x000420e11412a081), W(0x0000f9d3deb0d51f),
+     W(0x0006e4bce8e72ee6), W(0x0006eb85cc89c0c2)},
+    {W(0x0000000000000001)},
+    {W(0x00077c70029190e4), W(0x0004142f892544ad), W(0x000399a4c7024240),
+     W(0x0005dac7acd41b67), W(0x0001e8df616d6e54)}
+  },
+  {
+    {W(0x0000222bc0b9efc6), W(0x000386b66e0e23c1), W(0x0003da69124805ea),
+     W(0x0006814de0caac58), W(0x000444929347c2de)},
+    {W(0x00042aff2e1d6245), W(0x000181af64b48423), W(0x000695f23ff0e456),
+     W(0x0005eb22d1928f3e), W(0x00077785ec5cbbda)},
+    {W(0x0000000000000001)},
+    {W(0x0004690b8284e8a9), W(0x0001b4407c48eaca), W(0x0002e02a7762575b),
+     W(0x0006f6b2e2755896), W(0x00076a162d1abff7)}
+  },
+  {
+    {W(0x00024e593f606509), W(0x00044d3e18db34d4), W(0x0002999844d3431b),
+     W(0x00019a2a9d7ae2f4), W(0x000339185c73bca1)},
+    {W(0x00046cbd05215527), W(0x0007eadcc6223b50), W(0x0007a6fec5940e11),
+     W(0x000099c9eb051b8a), W(0x00039c09763c6a72)},
+    {W(0x0000000000000001)},
+    {W(0x000183ff4c65ddd0), W(0x0001bd56e1d04c0a), W(0x0000ad59394500bb),
+     W(0x0007b2fa15d9f055), W(0x0007c6c6b9d789bb)}
+  },
+  {
+    {W(0x00039487a468b353), W(0x0002917b1b153b3f), W(0x0000524b8eb0fbb5),
+     W(0x0002b8d219eefc0a), W(0x0000c876499ab182)},
+    {W(0x0000156bb4fb4e67), W(0x00072d4fd66f4024), W(0x00045298acb97bae),
+     W(0x00006ddf4a4e6dfe), W(0x00005c85b02aa88f)},
+    {W(0x0000000000000001)},
+    {W(0x00057c23bd7c2c00), W(0x00001371f598b5ef), W(0x0002867dbdeb46f2),
+     W(0x0001d605c4002d78), W(0x000555aaf945b305)}
+  },
+  {
+    {W(0x000019a53b1b5f1d), W(0x00078f41cbf6331e), W(0x0002159e0c2fb98a),
+     W(0x0000b5f371d6bfb3), W(0x0007db8c58747e30)},
+    {W(0x0004432368827d35), W(0x00051bbf8cae9692), W(0x0007f463e1940c9c),
+     W(0x0000e046811567e3), W(0x000383ce7df788e1)},
+    {W(0x0000000000000001)},
+    {W(0x000670f253f02446), W(0x00021525e7e1aa01), W(0x0000aa6ee4e5d389),
+     W(0x0005bbe70eb64bce), W(0x00047836999e2b1e)}
+  },
+  {
+    {W(0x0001ba770810af46), W(0x0003e5df018c0836), W(0x00001b13215bc55d),
+     W(0x0001491c1ae3ee44), W(0x0001472b1f182032)},
+    {W(0x000020ec8a819103), W(0x0004d24f6d9e75fc), W(0x00065538a425af39),
+     W(0x000512f0e2ac892a), W(0x00008bd6d7490e27)},
+    {W(0x0000000000000001)},
+    {W(0x0002660ab276e514), W(0x000774768b544a5a), W(0x00038876d0ca4bda),
+     W(0x0003c5d5ca0a7fdd), W(0x000149eefc4aeeec)}
+  },
+  {
+    {W(0x00075a235f0f9985), W(0x0003ed148be1a94f), W(0x000248927c9a17bc),
+     W(0x00026e4d7dd91614), W(0x0003584513a2d4fc)},
+    {W(0x0004c483fb768738), W(0x00016d303f761128), W(0x0005f966f7541ea5),
+     W(0x0001d14df06a7a3a), W(0x0006b522b93ae70d)},
+    {W(0x0000000000000001)},
+    {W(0x00076d035560c5a5), W(0x000423626f9704fe), W(0x0001cfe089a8f5da),
+     W(0x0003b652c28341e6), W(0x0001866b1084a45d)}
+  },
+  {
+    {W(0x0002547f4ed663ce), W(0x00017098f2c5997a), W(0x0005625ae8f81de1),
+     W(0x0004fe1409f36ab9), W(0x0000f7ba98997a14)},
+    {W(0x00069ff9f989e197), W(0x0002b28f527dbb9c), W(0x000475c9c588c9fd),
+     W(0x0006685d1a0a6d47), W(0x0000cc813fbf5b21)},
+    {W(0x0000000000000001)},
+    {W(0x0007ae26d1eb7dcf), W(0x0007bd9f37026404), W(0x0005bfb385a032b6),
+     W(0x0002f824c86aff6c), W(0x0000313315660cb3)}
+  },
+  {
+    {W(0x000781926e7018be), W(0x000689963dcc8205), W(0x00014b964c0e45eb),
+     W(0x00046f649409d757), W(0x0006ca87fab97e65)},
+    {W(0x00010cbffdbd54c1), W(0x0003c340a7941939), W(0x0006c5a7398622ea),
+     W(0x0000c11305c2e9fb), W(0x00028691e86228b5)},
+    {W(0x0000000000000001)},
+    {W(0x0004cc95b125a56f), W(0x00024f543bd618a5), W(0x0001fa3dae66e886),
+     W(0x0006a1cab0d98c66), W(0x0007e01478c252e6)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0004001ded42d3d0), W(0x0002502ef38582a7), W(0x0001ff13541b45cf),
+     W(0x0002a59616c95dca), W(0x0002b6b892ae94b4)},
+    {W(0x00024d48c5880cd2), W(0x00042d4a592941bd), W(0x00014a17cddba5e5),
+     W(0x0007e26b70960dae), W(0x0007f1cf64e0e180)},
+    {W(0x0000000000000001)},
+    {W(0x0002cfad175ffe58), W(0x000722ad645dbf8c), W(0x000093b3579649d2),
+     W(0x0000ccdd6619d4f8), W(0x00006e7091f1b3ee)}
+  },
+  {
+    {W(0x00031fcb422e04b4), W(0x000555810f6a2225), W(0x00070add814a78fa),
+     W(0x00030c6ac2462bb0), W(0x0001b9175b7fc19a)},
+    {W(0x000038c844ca68e8), W(0x000186a6414a7987), W(0x00039f17dc3b2d4b),
+     W(0x0003f12c66429ef6), W(0x0001730a59fff471)},
+    {W(0x0000000000000001)},
+    {W(0x0004a861f6607027), W(0x0007af381ed82036), W(0x0006097c9da26baa),
+     W(0x0007a3683c561737), W(0x00049e02856ea74f)}
+  },
+  {
+    {W(0x00017571c1c8aee3), W(0x000721cb8826e006), W(0x0000da5f1e81cf68),
+     W(0x0006853277792db6), W(0x000378c491d1e893)},
+    {W(0x00022aa5c1b0e64c), W(0x0002d38f35a10130), W(0x0004e5f35f07e7d9),
+     W(0x0003dfaa88e549bf), W(0x0005c956929821b0)},
+    {W(0x0000000000000001)},
+    {W(0x00032e498a79ad53), W(0x0007ef8bc0be7f1a), W(0x0004131c132a97f6),
+     W(0x00072f0387ed0e5e), W(0x00063461adf62227)}
+  },
+  {
+    {W(0x0002c29e56a6ee87), W(0x000309b0a8448ad3), W(0x0002161d358078c6),
+     W(0x0007c77c89235702), W(0x00001371cf67fe47)},
+    {W(0x0004e9c4c5b64c73), W(0x0003358b494910ad), W(0x0003b96d8be10c7f),
+     W(0x0000e73cc719954c), W(0x00071cad7d835066)},
+    {W(0x0000000000000001)},
+    {W(0x00068a8e5d248848), W(0x000723dc35f9a0fb), W(0x000793a7fcc37112),
+     W(0x0003a779e8accf4a), W(0x0003297b6f60ec0d)}
+  },
+  {
+    {W(0x0002bb87f45e696e), W(0x00060f19b4656afc), W(0x0002d58edd2ce4b0),
+     W(0x0001c2e40b3d78e1), W(0x000627108c7e3189)},
+    {W(0x000049c3ae93a88a), W(0x0007c706fcd18ffb), W(0x00042e281e5e0289),
+     W(0x0003f1bbe91feb98), W(0x0006a4c37ae8dfa3)},
+    {W(0x0000000000000001)},
+    {W(0x0005d47fb26b9031), W(0x00010f545eb1ecef), W(0x00052d7d33d65676),
+     W(0x00017d172cc7b947), W(0x0000dbca040ca922)}
+  },
+  {
+    {W(0x0002527c67b2f758), W(0x0001dde5125094e3), W(0x000384c975ff227c),
+     W(0x000281f9310a700f), W(0x0003e3382852761e)},
+    {W(0x000492f49485741b), W(0x00065d623f48517c), W(0x0006d543f16b0988),
+     W(0x0001a8d27ef41554), W(0x00030b4871c89d0c)},
+    {W(0x0000000000000001)},
+    {W(0x0000396fc8785693), W(0x00044ad70fcd26db), W(0x0004d43129c9d695),
+     W(0x00025e89e3a91de7), W(0x00055096277516ab)}
+  },
+  {
+    {W(0x0002347b5a4cbda3), W(0x00059ed7c99984f1), W(0x0006fe982e9a05da),
+     W(0x0002c33dd01debed), W(0x0006e73d4734f240)},
+    {W(0x00058153c3ae076b), W(0x00008f12def07f56), W(0x00074746822f6aba),
+     W(0x00079b43b5ae7fc4), W(0x000305c444300649)},
+    {W(0x0000000000000001)},
+    {W(0x0006c5eaa6babce6), W(0x0001305f8eb955e9), W(0x0003ec99c8a2862c),
+     W(0x0001af8dcb9821ce), W(0x00029a0949701265)}
+  },
+  {
+    {W(0x00058fcaa6aed372), W(0x0004e9a331cf1999), W(0x000458f293a49f4a),
+     W(0x000566687cc0422d), W(0x00063bd671eca1e6)},
+    {W(0x00074887d22a6e7b), W(0x000390a2bd39543f), W(0x0002a64448e4b36f),
+     W(0x00050afa14a7d510), W(0x0000460cc32f5d27)},
+    {W(0x0000000000000001)},
+    {W(0x0005c880d5edcbba), W(0x0006f94c712cb861), W(0x0001e2cb2dc454b3),
+     W(0x0002ddda765179f4), W(0x0005dfe4ffcc8525)}
+  },
+  {
+    {W(0x0003d1b062e0742b), W(0x00029d95fc8c961d), W(0x00021b1a8d1125df),
+     W(0x00055edb74e84141), W(0x00009701c899af81)},
+    {W(0x0000612ab9a284a4), W(0x00017e681a11ea79), W(0x00076c82ac951422),
+     W(0x0002a8d3bd653f03), W(0x000351bb6bdca702)},
+    {W(0x0000000000000001)},
+    {W(0x000700e214956209), W(0x00035102bbc21374), W(0x00026ba547076620),
+     W(0x00057620eb0c1583), W(0x00001f9f59afa5df)}
+  },
+  {
+    {W(0x00057a4998e6257a), W(0x000492142b390922), W(0x0000d445fcae0e5e),
+     W(0x0006d0a65a06a50e), W(0x0006cc6acf01e600)},
+    {W(0x00067406a4b83d58), W(0x0002c960ca37568d), W(0x00068c86f17a1b9f),
+     W(0x0002779d4e68c7f2), W(0x00036a85f81ebb62)},
+    {W(0x0000000000000001)},
+    {W(0x00034066e9b65e83), W(0x0000c6a7864a0c8d), W(0x00045d42428bdf7b),
+     W(0x00065623792d4d09), W(0x0002bb5a071e7ae4)}
+  },
+  {
+    {W(0x00054d0573713c17), W(0x000195f3c880d41e), W(0x00040ad246bb9a6d),
+     W(0x00032d88c9904f8b), W(0x0004aa4f4c7c4e80)},
+    {W(0x0006cb4930e39780), W(0x000138f0fe53ecc5), W(0x00037b6412877467),
+     W(0x000307bbb5bf8bd0), W(0x000395ac3f4ef94c)},
+    {W(0x0000000000000001)},
+    {W(0x00034ace9c916579), W(0x00072ea56411b251), W(0x000250c5dab184b4),
+     W(0x00017a9e2b05959d), W(0x0004c37ba8bd39e4)}
+  },
+  {
+    {W(0x000384be5b944748), W(0x0007e50f900f5f37), W(0x0003be55c53bb4b5),
+     W(0x0003c53195310045), W(0x0006a4483351be18)},
+    {W(0x0005ccf9c3e0e0f4), W(0x0004511a1d9903e6), W(0x0002339b39de8b9e),
+     W(0x00032c5c197202f6), W(0x000274b203ac263f)},
+    {W(0x0000000000000001)},
+    {W(0x00019de968de4892), W(0x0000ccba910b1dbe), W(0x00038840ae40dc13),
+     W(0x0002d474ca12ac8a), W(0x00001d23c78a82b7)}
+  },
+  {
+    {W(0x000261b4a3d0c341), W(0x0005d09c8adaca22), W(0x00019f686c21ea89),
+     W(0x0002fedd26cc13b3), W(0x0002c5d61d595752)},
+    {W(0x00009d1f43cdabce), W(0x00010aa9c7b0489e), W(0x000185163a643489),
+     W(0x0001d3093944baca), W(0x000540e5fe7d65d0)},
+    {W(0x0000000000000001)},
+    {W(0x0007bd5d09bcf8c8), W(0x0003ef6ea1385b42), W(0x0003861e363957cd),
+     W(0x0003196a615139a3), W(0x0003fcd0e9bde061)}
+  },
+  {
+    {W(0x00053795caf5b269), W(0x0004535c28b7b68c), W(0x0003031c40236037),
+     W(0x0004ce26ff52e0af), W(0x000642091eb87c52)},
+    {W(0x0006e4fc8b92eb1b), W(0x000223fa9a338bee), W(0x000596c872c3cc2c),
+     W(0x0006b489e2a208ab), W(0x0006fb9f9f62e750)},
+    {W(0x0000000000000001)},
+    {W(0x0003cca34c962dac), W(0x0002ae57b05e757f), W(0x0001ed589edbae73),
+     W(0x0005022d569a9199), W(0x0001bd4f31165e5f)}
+  },
+  {
+    {W(0x0000dfdce860acad), W(0x00067c36d1056bad), W(0x0006a00306a77e03),
+     W(0x00020502aefec9bb), W(0x0001255777df1b2c)},
+    {W(0x00060757d08cee2d), W(0x0003c872dfa5ea11), W(0x00037441bc74b53a),
+     W(0x0001d1be739b1ec0), W(0x0001ef7344b073d0)},
+    {W(0x0000000000000001)},
+    {W(0x000250ce681a03bf), W(0x0006deb2adcb5234), W(0x00057354c33f58a0),
+     W(0x00015484d6f9a370), W(0x0007a70f6622eef3)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000490fa3b4710e5), W(0x0001eacdfd56a61f), W(0x0006cb20ee9c3bee),
+     W(0x000549ca19bd017f), W(0x0000f6c3a96e0032)},
+    {W(0x0000479be167635a), W(0x0004d2f58f2713ef), W(0x00010893b9457875),
+     W(0x00033a81c525ac74), W(0x0003d4e97e286378)},
+    {W(0x0000000000000001)},
+    {W(0x0004e485e1daff38), W(0x000527a746002890), W(0x00051c8d4c76f176),
+     W(0x00004310b39066de), W(0x00028b2ebb173415)}
+  },
+  {
+    {W(0x00069fade6abb440), W(0x00055551d6694d28), W(0x0006317458822a73),
+     W(0x000692628efb5e89), W(0x0003b13c71c2a90b)},
+    {W(0x0005be180d16dc54), W(0x0005f0004a4c2c86), W(0x00023f4d0a9bdc16),
+     W(0x0003d95dd4133c97), W(0x00014890a7ab2481)},
+    {W(0x0000000000000001)},
+    {W(0x0004ba7562e7208a), W(0x0004b9091e470f22), W(0x00043809ef3818c1),
+     W(0x0006ef5f3a007fec), W(0x0005124d8bf03ce2)}
+  },
+  {
+    {W(0x000320f5fd1d642b), W(0x000298630e9dbbe6), W(0x00054627423f3186),
+     W(0x0006bc3fb34ab459), W(0x0007983fccb8fdff)},
+    {W(0x000163226a436855), W(0x0004aaf356b5777b), W(0x0002e94120f7867b),
+     W(0x0006661493ab8ed7), W(0x0003c0fcdb8f1b0c)},
+    {W(0x0000000000000001)},
+    {W(0x0001d87c4e9b20d8), W(0x000234f6214e9262), W(0x000694396c46d896),
+     W(0x0000f7a5029fbe0d), W(0x0004ac845e2b5904)}
+  },
+  {
+    {W(0x0006c091e388a820), W(0x00006a3044f1576d), W(0x00069bae0ea4a2ca),
+     W(0x00002a112c8ba6d4), W(0x000184b48cb45500)},
+    {W(0x00024dba26e77c33), W(0x0004707f5e8a7fc6), W(0x000603bdcd99e697),
+     W(0x0001d4eeb0613411), W(0x0003ee0e07a03dc3)},
+    {W(0x0000000000000001)},
+    {W(0x00004e3d85fb1c87), W(0x00000fccecd2b73d), W(0x0001ec19981a14b9),
+     W(0x0006bf8c0b3a434a), W(0x00041cf3c80d1ba5)}
+  },
+  {
+    {W(0x00062364b859c113), W(0x0002a53f9591e9b0), W(0x0006861d4b0ffd5a),
+     W(0x0007f8ec47a30758), W(0x0005d17bc7ae6348)},
+    {W(0x0007f1ed5765a23d), W(0x000614aa29e2f0b9), W(0x00067865bd10140e),
+     W(0x00017b0b1984d6ea), W(0x00053daa8c1f0668)},
+    {W(0x0000000000000001)},
+    {W(0x0006fc078b3ece5d), W(0x00046bbc9edf9999), W(0x000284f8519822d4),
+     W(0x000773955883eed9), W(0x00076244798c6270)}
+  },
+  {
+    {W(0x000747ad656376ce), W(0x00014a7699747e90), W(0x0001cda466130882),
+     W(0x000364aa3e07070d), W(0x0002d86e1368ab54)},
+    {W(0x00014429f04394f2), W(0x000353c3eee86778), W(0x000797e122085254),
+     W(0x00005dcb2acc4850), W(0x0000b2538616310b)},
+    {W(0x0000000000000001)},
+    {W(0x000278b9b2f84b25), W(0x0001adbf057e54a4), W(0x0001fb426070d50f),
+     W(0x000228a4a3cdf9b3), W(0x000342f399de1a30)}
+  },
+  {
+    {W(0x00004369a69769d1), W(0x0000d259eb635c91), W(0x0003966e2502aaa9),
+     W(0x0000aaba846341f8), W(0x0005260385be8429)},
+    {W(0x0004164a69a476bd), W(0x0004c7f153c9ce4c), W(0x000440c6a3b8e442),
+     W(0x00018e8239f60811), W(0x0003d894f1c3c8b5)},
+    {W(0x0000000000000001)},
+    {W(0x0005f63423c3e178), W(0x0000e7c04e05509d), W(0x0000bdaf9c85e5e9),
+     W(0x0004e103a76fab14), W(0x0005228fdb597f48)}
+  },
+  {
+    {W(0x0000e3c0fb135c34), W(0x0006d3644b0a856f), W(0x0000f096724dfe05),
+     W(0x0002841310cb74e9), W(0x0005a04ae1195edf)},
+    {W(0x00031f9712c5e8b9), W(0x0005ba933287dfd0), W(0x00029a0971654be4),
+     W(0x00066676743f3af8), W(0x000676667092118a)},
+    {W(0x0000000000000001)},
+    {W(0x00042d3860af76b1), W(0x0001182ca41f6c5e), W(0x0001aa49ae2734f6),
+     W(0x00045206bc977d0d), W(0x0003c714137c974f)}
+  },
+  {
+    {W(0x000319bb68ed195d), W(0x0007ac80c5bdb0c2), W(0x0003a757da099264),
+     W(0x000558f3b41ef6fc), W(0x00002b340d4938f1)},
+    {W(0x0005cf58131ff81a), W(0x0002ec6acb6b1293), W(0x00026e773f6cc456),
+     W(0x0000d527c7771888), W(0x00066a2e797de77c)},
+    {W(0x0000000000000001)},
+    {W(0x0003acd4428e5e0d), W(0x0003023889a1a041), W(0x0001024abea3359b),
+     W(0x0002dd5212d6e216), W(0x000694be99ddfb4e)}
+  },
+  {
+    {W(0x0001dee5d674060d), W(0x0003fa5d1682ebf7), W(0x00049d7ff68763ad),
+     W(0x000689596987e076), W(0x0005484dddf1b054)},
+    {W(0x00043b039bc1c711), W(0x000732bbf3654258), W(0x0002265534b5466d),
+     W(0x00077f424291b71c), W(0x0002b4a0f7a9f30a)},
+    {W(0x0000000000000001)},
+    {W(0x0006e6cfd41fa5de), W(0x000081f265aca6c9), W(0x000100d29da5cb09),
+     W(0x000195f9adc66b55), W(0x00076bce05f4dfaa)}
+  },
+  {
+    {W(0x0007be40653e4b99), W(0x0001b8632c36f739), W(0x00061b77739140f0),
+     W(0x000375918f76a6ad), W(0x000288330d306913)},
+    {W(0x00055722f0886187), W(0x000528198ae55bfc), W(0x000527e218629243),
+     W(0x0006c22b15a71af0), W(0x00032398bc4611dc)},
+    {W(0x0000000000000001)},
+    {W(0x000338de0bac8328), W(0x00037f433f69c356), W(0x00062dddec638188),
+     W(0x0002b530f448d592), W(0x0004e6114f39d574)}
+  },
+  {
+    {W(0x00001bcbd12940b3), W(0x0007772a76f393c1), W(0x000560684a5421c4),
+     W(0x0000a7a1a9413f57), W(0x00005261a93f4391)},
+    {W(0x0007af64f9a3446e), W(0x00009583dbefadbc), W(0x000493a26d7cefa8),
+     W(0x0004ef9f1772874e), W(0x00078f07150d4f7a)},
+    {W(0x0000000000000001)},
+    {W(0x000741868bcf2c55), W(0x000520ca1cd2c661), W(0x0003d02611befeea),
+     W(0x0006cadae0d9658c), W(0x00044e7489049caf)}
+  },
+  {
+    {W(0x000307e5c7abeffe), W(0x00009ff39bf65bb2), W(0x0006eaa5620898d4),
+     W(0x0001ff846cefde14), W(0x00066fc9443820ed)},
+    {W(0x00014c4a636e9abc), W(0x0003b7d0795e8720), W(0x0007d36436ed7620),
+     W(0x00063398b01007be), W(0x00028da22d984d16)},
+    {W(0x0000000000000001)},
+    {W(0x000082b4f9081801), W(0x00079ce2b4959afd), W(0x000411144ac56bfd),
+     W(0x000090bffaef735b), W(0x0006c85d0699d8ee)}
+  },
+  {
+    {W(0x0000ad39b464da88), W(0x000104de39ec8926), W(0x0007a4fce39229dd),
+     W(0x0000af9e9b42e2a5), W(0x00008481929756a0)},
+    {W(0x000047a5dc5c1c84), W(0x0005117620d40508), W(0x00033abd53f55636),
+     W(0x00073ae04b4641ad), W(0x00078f404eb5e1c6)},
+    {W(0x0000000000000001)},
+    {W(0x00031f2ba49a12cf), W(0x00007d53d90fdb6b), W(0x000771146bb6bdc5),
+     W(0x00076a9f2fba60a5), W(0x000785db146a591d)}
+  },
+  {
+    {W(0x00051786d9d3b9a0), W(0x0001b3f9b712950f), W(0x0001f3ff066d8e2b),
+     W(0x000795d249633a9f), W(0x000373c1e150a179)},
+    {W(0x000511228b0281ba), W(0x0007822a4bddbd97), W(0x0000c05b41d9963e),
+     W(0x0007e3afa58d74e3), W(0x000619d56cb323ce)},
+    {W(0x0000000000000001)},
+    {W(0x0004e9bd981881d9), W(0x000111da9b25593b), W(0x0006302688b4af06),
+     W(0x0002034b99e71f70), W(0x000375602676e837)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00025657c238a83e), W(0x000548bf1c563348), W(0x000553105d7d2046),
+     W(0x000620eed52eee13), W(0x00052ee53b981dfb)},
+    {W(0x00025fb36da7f1c3), W(0x0000b2b712398df2), W(0x000584e55d90f37c),
+     W(0x0007643d9c4656a8), W(0x0007eb0a1be3400d)},
+    {W(0x0000000000000001)},
+    {W(0x0000d7480590d5b7), W(0x0003c2b07582c297), W(0x0006cb1d33aaba77),
+     W(0x00074198cb5c6f88), W(0x0001047622c0d66f)}
+  },
+  {
+    {W(0x000620678a1d2425), W(0x0001617da71d685d), W(0x000079ad7a751b36),
+     W(0x0002e60d02894e92), W(0x000501fe138924e0)},
+    {W(0x000511e6911cee4e), W(0x0004cea3034ab1d7), W(0x0005b6b83ded36bd),
+     W(0x00044e10ac416542), W(0x0002f8022ecede01)},
+    {W(0x0000000000000001)},
+    {W(0x0000deb9b2adb103), W(0x0007b227e005328d), W(0x0002f8ae950b70d2),
+     W(0x0003e3f31c4d8ad7), W(0x00073ab483e22125)}
+  },
+  {
+    {W(0x000613f381f3dd9d), W(0x000306b69488ddaa), W(0x0007e1290e447979),
+     W(0x00067d5c4552917c), W(0x000055004f7d6a76)},
+    {W(0x0006aa6f20596340), W(0x000719d3c5fb2055), W(0x0002afdfc4a39fec),
+     W(0x0004fa649cdcdf34), W(0x000476824e0cb7af)},
+    {W(0x0000000000000001)},
+    {W(0x0001e39fecb65729), W(0x0004f93cbda2b7d5), W(0x0001617025d7f7e1),
+     W(0x0005a810d7f4485c), W(0x0002c8bf92274133)}
+  },
+  {
+    {W(0x00056a1d390a3b68), W(0x00036a8c7e1f8ae2), W(0x0003fd9173a36ce7),
+     W(0x0000195b9da784d0), W(0x0002d8294fd94996)},
+    {W(0x000455f1445af624), W(0x00002f908f9d5b65), W(0x0003049f27f78eb0),
+     W(0x0006c82d27ef5cad), W(0x0003a8a6faa67c6d)},
+    {W(0x0000000000000001)},
+    {W(0x0005a179d433b626), W(0x000104d37fdfc88b), W(0x000718d4e8682245),
+     W(0x0002aad2307a7435), W(0x0007445e9376c43c)}
+  },
+  {
+    {W(0x000777b793aba7fd), W(0x00029632454b67f0), W(0x00063fd8e8ed39b8),
+     W(0x000153959b8b7944), W(0x0007d63770ba4e4f)},
+    {W(0x000179a9a452c416), W(0x000074aa3b4f9d79), W(0x000318a4c696d13b),
+     W(0x0004f4f3bced2761), W(0x000544e04bd2b43f)},
+    {W(0x0000000000000001)},
+    {W(0x0001c5959d96141f), W(0x000574209c3b3a93), W(0x00036eb9c6cb5490),
+     W(0x0005d9d9f4de34bb), W(0x00040b480d982c5e)}
+  },
+  {
+    {W(0x00016397c9875278), W(0x00063f182bea9bb6), W(0x00020a228ea2981b),
+     W(0x0000e8ee8cd365ea), W(0x0002a374c1708871)},
+    {W(0x0004d94308f30ca1), W(0x0001523bf4f063c4), W(0x0007886e351da6f7),
+     W(0x000659bb70daa75c), W(0x0005ab35fce03931)},
+    {W(0x0000000000000001)},
+    {W(0x0000b3fb9e23cc5d), W(0x00015c384945fc0a), W(0x00004212edf232ff),
+     W(0x000141f02c33d532), W(0x0002adbb3ec60261)}
+  },
+  {
+    {W(0x00051c85cc105e02), W(0x00064a114784f8e1), W(0x0002927cf66ab961),
+     W(0x000763c0cceb6fea), W(0x0003dea4b8a91a1b)},
+    {W(0x0001e1e5bdc88cca), W(0x0003f234dd4f3949), W(0x00028130453024ef),
+     W(0x0002739ded467cb2), W(0x0003479286be4d04)},
+    {W(0x0000000000000001)},
+    {W(0x0002e17d97e2c895), W(0x0004b520eb49b3fa), W(0x000761320ccb96ce),
+     W(0x0004c1106c80bf1d), W(0x00067ce7d0102ab3)}
+  },
+  {
+    {W(0x0001500361e4da1d), W(0x0003965de30d1175), W(0x00028e551288ee10),
+     W(0x000357804ceb1d82), W(0x00056857d0267427)},
+    {W(0x0005b284290e72ce), W(0x0005a0caf7c8ba4f), W(0x000067bf37b73dff),
+     W(0x000469323c8ade6b), W(0x0000b543a6720e31)},
+    {W(0x0000000000000001)},
+    {W(0x0004fc47afec78c3), W(0x0002804064182fd5), W(0x000283a2f42b5ae6),
+     W(0x00009f96cc6a562c), W(0x000275ec4b0a359b)}
+  },
+  {
+    {W(0x0001519549f83c5b), W(0x0001864f6dc0b833), W(0x000526ca9a8825cc),
+     W(0x00078be190999219), W(0x00049e5586ebece9)},
+    {W(0x0005ad31e59c6339), W(0x000568175d03a19f), W(0x00040ee6173550f0),
+     W(0x000600db8adf94c0), W(0x0004b124ad6b52af)},
+    {W(0x0000000000000001)},
+    {W(0x0004a7bbf46c58ab), W(0x0000b7644973b004), W(0x0007d1cf997c5877),
+     W(0x00021179a41e3f33), W(0x00015e4f84b72973)}
+  },
+  {
+    {W(0x000138a0c224cc20), W(0x00071e1597348374), W(0x0004b2e281d786cc),
+     W(0x00043c0ab3daae57), W(0x00041d1512473c2b)},
+    {W(0x0004f0459ae3a2c0), W(0x00035036fdfa43ad), W(0x0000f3f4373946e4),
+     W(0x0007016d7331890e), W(0x0005656a17e94d4c)},
+    {W(0x0000000000000001)},
+    {W(0x00062c58a731f319), W(0x000761686b93d2ec), W(0x0005af353c7718a9),
+     W(0x0005faf7d91eb194), W(0x0006169a5da0d4be)}
+  },
+  {
+    {W(0x000391810dd0adee), W(0x00033c24975f6f8d), W(0x000565253665d27b),
+     W(0x0006cc7797cddd48), W(0x0005a5efce033728)},
+    {W(0x0002962b6b77b32e), W(0x0003650b259aa458), W(0x00049eea773bb906),
+     W(0x00041fff48126b94), W(0x000435cf09cf0ae4)},
+    {W(0x0000000000000001)},
+    {W(0x0007aa9254023502), W(0x00079fbffff5c251), W(0x00025da9e0122322),
+     W(0x00012aaad2c17f62), W(0x000116b5fe221213)}
+  },
+  {
+    {W(0x00031fe23c939bb8), W(0x0001b1657efd71ad), W(0x0000b2fd2a44d1f8),
+     W(0x000403686710a392), W(0x0002478c57a1aa4e)},
+    {W(0x0000e15efbadbeb8), W(0x0002915451b0120c), W(0x0003bc9271bcd411),
+     W(0x00029fda9503ef9a), W(0x0000fa817d441004)},
+    {W(0x0000000000000001)},
+    {W(0x00044d5e1a1065ea), W(0x0000a0198bc0208a), W(0x0004fd26d977c49e),
+     W(0x0003d0166bf52a98), W(0x0003ae5ea75a8359)}
+  },
+  {
+    {W(0x0003aa8eb26eb3d5), W(0x00037ef812db0214), W(0x00079021717b7f7a),
+     W(0x0006e695d34865d1), W(0x00056bb957bdface)},
+    {W(0x000283680f9db34d), W(0x00078f837f2ee063), W(0x00033296ef104c5b),
+     W(0x00063ee60b5c96cc), W(0x0003262570faf634)},
+    {W(0x0000000000000001)},
+    {W(0x000117dab679923d), W(0x0006cdb7e82349d4), W(0x0005b93d49c4ec03),
+     W(0x000435691619d430), W(0x0004eb78dd1e511f)}
+  },
+  {
+    {W(0x000488a9c63328a5), W(0x00001789214a934c), W(0x00000b9a9ad2d52c),
+     W(0x0004d4f9dd61cba0), W(0x000743858136a603)},
+    {W(0x00061cba3db0564a), W(0x000180fff6099a2f), W(0x0007c303146946ba),
+     W(0x00066365628d4a56), W(0x00025963ddde5984)},
+    {W(0x0000000000000001)},
+    {W(0x0004cfb05455b829), W(0x0006c65f214f8e4e), W(0x0005aa24586e4401),
+     W(0x00002fbc2777fc1e), W(0x000557c05f8e3465)}
+  },
+  {
+    {W(0x0003beb165096921), W(0x00025eb535087c16), W(0x00011d6a490113be),
+     W(0x0000a57ce49d8d84), W(0x000481712ef5eeb9)},
+    {W(0x0005af2fd4a1449e), W(0x0007d47530bb0dbd), W(0x0005138d5df6d60b),
+     W(0x0002a0f991db5520), W(0x0002235521cd7405)},
+    {W(0x0000000000000001)},
+    {W(0x0007a05ef1598c60), W(0x0005aefd2bf4d154), W(0x000354122c4d6a3a),
+     W(0x000586491e7656d1), W(0x00038d3eb54c317d)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000799fbc504fd52), W(0x0000685c319f7d1c), W(0x0003dd367b6677bc),
+     W(0x0004a2cde61767c0), W(0x00052a837bc7a7bc)},
+    {W(0x000691478a411196), W(0x00022c6a8f5b56df), W(0x0002a6321814d453),
+     W(0x0001272a42f91f9b), W(0x00050d6460185d89)},
+    {W(0x0000000000000001)},
+    {W(0x000107b74acdb012), W(0x00061abba8e471b4), W(0x00023270f5447242),
+     W(0x0007a21d2357bdfd), W(0x0007d1965c77671f)}
+  },
+  {
+    {W(0x0001e64086f3cd53), W(0x000348b97ad2a847), W(0x0001a4c92d172080),
+     W(0x0005e3a31057d882), W(0x0003f30ee695b236)},
+    {W(0x000055dbc0478370), W(0x00009eada30f7501), W(0x0001823128308168),
+     W(0x00072aaab207d757), W(0x000414231531dd52)},
+    {W(0x0000000000000001)},
+    {W(0x000764617391058f), W(0x00004c54348ee07c), W(0x0004d57770c3157c),
+     W(0x00072705c5a46a13), W(0x00068a3708fe7912)}
+  },
+  {
+    {W(0x000278966b88fcca), W(0x000015f79b907161), W(0x000746d3bdfe36d9),
+     W(0x00016164ba51661f), W(0x0004fbfdbab00559)},
+    {W(0x000265662d061c93), W(0x0004e01fa312f480), W(0x0006ff073bb00eaf),
+     W(0x000672d2a989fc1b), W(0x00068ffb955a83a0)},
+    {W(0x0000000000000001)},
+    {W(0x0003cb9885777938), W(0x0006baed3382a74d), W(0x00000e670fa94a30),
+     W(0x00046f8434c68cfe), W(0x0004047938508e64)}
+  },
+  {
+    {W(0x0005307d306de6e4), W(0x00057f9f30ef1846), W(0x0004bb6196df0d69),
+     W(0x0005096e630652e3), W(0x0000ebc38c54fd6a)},
+    {W(0x0003f23886763ce2), W(0x00049eb1af02c58f), W(0x000282149b6f6856),
+     W(0x00007ed9f18eeeab), W(0x00004b3a1d9f2ef4)},
+    {W(0x0000000000000001)},
+    {W(0x0002bffe721fe54b), W(0x0007b8a10d45dd14), W(0x0003a91e1fff0ce2),
+     W(0x00061f7cea74ef44), W(0x0006aea2a856fa0e)}
+  },
+  {
+    {W(0x000185647241a6ac), W(0x0001dfa014c2f526), W(0x0004e2b92c1faa0c),
+     W(0x00059a456a15db2b), W(0x00014c053b040dfe)},
+    {W(0x0000eb9cd0eed3c0), W(0x0001f8ef9fc8fe85), W(0x0005673222a1e56e),
+     W(0x00039bcbf3e94e33), W(0x0007ec77091bc605)},
+    {W(0x0000000000000001)},
+    {W(0x0003f42495822383), W(0x0001e3bac426f911), W(0x0002a1f1bd257e82),
+     W(0x0001c1a5d09f6c20), W(0x00048fc0507690a9)}
+  },
+  {
+    {W(0x000743240d99fd8b), W(0x00009f4fac3d7fcd), W(0x0006acd80f4e86b9),
+     W(0x000023e152fe96eb), W(0x0006518baedfba8e)},
+    {W(0x000674b4a4f04a46), W(0x0002239e6860b4f3), W(0x0000ca1d534c759a),
+     W(0x0001d108fdfdb2be), W(0x00007388f7538996)},
+    {W(0x0000000000000001)},
+    {W(0x00007bca976c72c5), W(0x00057aa3241160ba), W(0x00005b2a72d22ff1),
+     W(0x00027d0377ec46f0), W(0x0007de8b6c2630d9)}
+  },
+  {
+    {W(0x0005c77bb5d37d53), W(0x00018c108d565a62), W(0x000488bfbbe1f5a9),
+     W(0x0003aca7117c6198), W(0x00078ad307ea1d91)},
+    {W(0x000055e212791a2d), W(0x0002f1d7a2ea683c), W(0x0005011ef683123e),
+     W(0x0001283fe95fe601), W(0x000601b077b6cb16)},
+    {W(0x0000000000000001)},
+    {W(0x00076cb6b24ae3b4), W(0x00006e228726ebd9), W(0x0002406e0ddac8fc),
+     W(0x00055e8daed3e58b), W(0x00003d178feb4f27)}
+  },
+  {
+    {W(0x00021058e60e49db), W(0x000546efb6bb4a4f), W(0x0000731f39e284f9),
+     W(0x0006c67dbeed9192), W(0x0003b75696730dc8)},
+    {W(0x00046016166deaa9), W(0x000151888330ec1e), W(0x000000005becfa2d),
+     W(0x0004e7f7cfcf532a), W(0x00034d031744cd2d)},
+    {W(0x0000000000000001)},
+    {W(0x000146254758179b), W(0x0005731e56b6f739), W(0x00005b4f28e9ae5e),
+     W(0x0002f91383a4c25e), W(0x0000e843c13fb394)}
+  },
+  {
+    {W(0x0007bc72c1396d30), W(0x0001c6af008d343f), W(0x000619c7fb45661c),
+     W(0x000388bc61cce592), W(0x000175b27cd23889)},
+    {W(0x00063bfecd97c06d), W(0x0003f3f30f6c41f3), W(0x000455c14ffc84dc),
+     W(0x0002fdb54284eea3), W(0x000060a95bc2713e)},
+    {W(0x0000000000000001)},
+    {W(0x0002fce1238a98a0), W(0x00071db7010c9e34), W(0x0005ae54b317ad2f),
+     W(0x0007d563ecde4e13), W(0x00008cdcafda5ce2)}
+  },
+  {
+    {W(0x0002cfdc08a6c80d), W(0x0000f5d726d9a7fd), W(0x00022dd23a058cf1),
+     W(0x000229dc750b147b), W(0x0007234c1dd63a4c)},
+    {W(0x0006e85fcf9d2760), W(0x00068f3277ab4d8d), W(0x00073e60f0c48c34),
+     W(0x0004bf3ebb4ff120), W(0x00031c9b3872166f)},
+    {W(0x0000000000000001)},
+    {W(0x000738b5b377312a), W(0x0000ea2a27d69f43), W(0x00010045169940bb),
+     W(0x0005a5047ed9f3c3), W(0x0000f40b502084b3)}
+  },
+  {
+    {W(0x0007ae2be22ee527), W(0x0000727050b9ec46), W(0x00006214fe446278),
+     W(0x00009baa10fd765a), W(0x00007a9702e59e99)},
+    {W(0x00004e52d35af2b1), W(0x000051c5be3649a4), W(0x0003568b6c1fbb5b),
+     W(0x0004542a7e85e766), W(0x00026c68938311f8)},
+    {W(0x0000000000000001)},
+    {W(0x00019766c9624cd3), W(0x0000162e71b90a4b), W(0x00017d6fa23aab11),
+     W(0x0003ce2dfcede567), W(0x00046a2789c03400)}
+  },
+  {
+    {W(0x000002d25e523375), W(0x000498874d9ec766), W(0x000380ea66609929),
+     W(0x00064dca8a7ac759), W(0x000582097e99fa3c)},
+    {W(0x0007d231c5333c0c), W(0x000691dee957e655), W(0x000534c7c2db6bbb),
+     W(0x0005146d5dcf475b), W(0x0004c01b0be8cc0d)},
+    {W(0x0000000000000001)},
+    {W(0x00071134406dde1d), W(0x00021751577899e2), W(0x0000f58ccf14d0c7),
+     W(0x0002842155551b34), W(0x00018e470bca1ac4)}
+  },
+  {
+    {W(0x00014f134d1312ed), W(0x0007168b95dc7ece), W(0x0007efe76f701e9a),
+     W(0x0005d9f5b7e3f506), W(0x0003e0aa8dde671a)},
+    {W(0x00036ada6ed892ec), W(0x0001211eadee130b), W(0x000624e6b144af17),
+     W(0x00025573ec451b02), W(0x0005e9b1a8a05b9b)},
+    {W(0x0000000000000001)},
+    {W(0x000172c861aa3197), W(0x00007d6e62ea6aa4), W(0x0002f70327d68126),
+     W(0x0007b9d61ea8a297), W(0x0002622382d5db20)}
+  },
+  {
+    {W(0x0005e725c85c2de6), W(0x0007d34fe3335d9a), W(0x0004344683f0c924),
+     W(0x0003ea22bf9f04fa), W(0x00032a20952afb7c)},
+    {W(0x0007c0dcadae9318), W(0x0000c29c7cb7b5b9), W(0x0001e42be8e2c0d7),
+     W(0x00023fded1d1619c), W(0x000108e782d12744)},
+    {W(0x0000000000000001)},
+    {W(0x0002c6b7076cf66a), W(0x00008ecd7b132577), W(0x0003dda69294cfd0),
+     W(0x00030bfa8fc44d2a), W(0x0002f3dff8f18504)}
+  },
+  {
+    {W(0x0006cd55fa179fc8), W(0x0002603062be41c0), W(0x00019bf44d91991c),
+     W(0x0003cfe3451aa99e), W(0x0002e5a27e1269b6)},
+    {W(0x0005ff4c39a9cc8a), W(0x00056f44684ea6b4), W(0x0004ac9972c8d32f),
+     W(0x0004ea5cd46c6a09), W(0x0007d76beaf1b45c)},
+    {W(0x0000000000000001)},
+    {W(0x00073e0d03b12472), W(0x000218bc63bb30ea), W(0x0000d000aa808d99),
+     W(0x0001cde0ef464a9c), W(0x0001455ad6f10a3d)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00018f8ca404eba4), W(0x00016aabb0b2a4ee), W(0x0005aabb20989ac5),
+     W(0x00059c676510d13e), W(0x000006b2bd5d00fa)},
+    {W(0x00029a3af10c67e5), W(0x0007861a3de7213d), W(0x00009f15aac6e8ce),
+     W(0x0003559ec02a3f84), W(0x000727340c27a15f)},
+    {W(0x0000000000000001)},
+    {W(0x0000bc5fb7aec1c2), W(0x0001d45d57c1be24), W(0x0007f4e462606d36),
+     W(0x000498257d12ea2d), W(0x0005369858905878)}
+  },
+  {
+    {W(0x000120ea165b2bd8), W(0x00020b75d1ed1a7e), W(0x0007ecdaa0646aa7),
+     W(0x00036ac83ec42b95), W(0x0001f4e8938dcf3a)},
+    {W(0x0000433b9bda19cc), W(0x0005c7a9a465c429), W(0x0005d29b77f233e2),
+     W(0x00070c8d7765329b), W(0x0005a8b0c6f649f8)},
+    {W(0x0000000000000001)},
+    {W(0x0004e1612eaca667), W(0x0003c5520c94b5cc), W(0x00011b97d2ae0e68),
+     W(0x00050ce1fe47111f), W(0x0004ebcda4c86be9)}
+  },
+  {
+    {W(0x00078757d0de3126), W(0x0002d3d227340ff5), W(0x00036bbda0bc72d1),
+     W(0x0001011165ddb29a), W(0x0003a2cf75ff2e2a)},
+    {W(0x00024fa044601692), W(0x0007aec2378d76aa), W(0x00020a96ee2232cb),
+     W(0x000443f73196a888), W(0x0001435ac618e304)},
+    {W(0x0000000000000001)},
+    {W(0x0002c8241c6cc00d), W(0x00007ad64be4e31e), W(0x0006f3c06ec02f39),
+     W(0x00041cab8eb27d5d), W(0x0001385a28ad4cc8)}
+  },
+  {
+    {W(0x0005b872f0c2b925), W(0x0004ade791b982c2), W(0x00058030b91bd3b4),
+     W(0x0004c4aa9a427107), W(0x00008fe8df51b345)},
+    {W(0x0003ba44bc93abf8), W(0x00029a0de9296ea3), W(0x0003b7aad6e98cb9),
+     W(0x000762ec4a648a19), W(0x0002738e06810f4c)},
+    {W(0x0000000000000001)},
+    {W(0x0005b23d372aed45), W(0x000255c761b097a5), W(0x00033f9664847238),
+     W(0x00054eddf19ae3ad), W(0x00067c90257ca26d)}
+  },
+  {
+    {W(0x0006f7f5f4322aed), W(0x0000611ed43594cd), W(0x0000c988f5beed76),
+     W(0x0001d19f0b7c6596), W(0x00026cd260bddcd5)},
+    {W(0x000633cd90fad2c3), W(0x00024a1c096bde62), W(0x0004a180f6f41744),
+     W(0x00057b197174fa37), W(0x000286e66059b8c5)},
+    {W(0x0000000000000001)},
+    {W(0x0007c9e43f774904), W(0x000241449f5258f5), W(0x0007cc77b517a1e7),
+     W(0x000412df24556a93), W(0x0007364c47197ff4)}
+  },
+  {
+    {W(0x00048d54b75b3021), W(0x000601d0b0c99021), W(0x0001b3049d931b84),
+     W(0x000283ec589ea975), W(0x0002953a3c30b742)},
+    {W(0x0000af774377cd9d), W(0x0004e524174b82cc), W(0x00032027f99b0689),
+     W(0x000411ab9f67653e), W(0x0007d4c51196d280)},
+    {W(0x0000000000000001)},
+    {W(0x0001665efd754ba0), W(0x00027a36e3c0bcb1), W(0x0007228155ca8fcb),
+     W(0x000081960777e367), W(0x0004a991ea3e7b9a)}
+  },
+  {
+    {W(0x000729ed536ee0fa), W(0x00006fe62fd9d66a), W(0x00022e3dfeeab7c9),
+     W(0x00000451c5a6fb51), W(0x0003bdcef7307883)},
+    {W(0x000308188749d491), W(0x0003a91af470458b), W(0x00079b36622eb3e1),
+     W(0x0003e496d43990fb), W(0x000674a478f5a68e)},
+    {W(0x0000000000000001)},
+    {W(0x0001c098ecbf77ed), W(0x0006b4a382581623), W(0x00077eb87a4d59b2),
+     W(0x000567f6f6dcf6db), W(0x0000661dbf7b8260)}
+  },
+  {
+    {W(0x000164d49b141c74), W(0x0001e66436cb4e2c), W(0x0006692296ea3bdd),
+     W(0x0006b15a784d7d63), W(0x0001a2403cc5ef2a)},
+    {W(0x0003b9afe4fd76f5), W(0x0003e77a4c79cb20), W(0x00069512b4308734),
+     W(0x00064d8108c0564b), W(0x0007779fbcd8be50)},
+    {W(0x0000000000000001)},
+    {W(0x00040e157b472205), W(0x0004b30eecb0189e), W(0x0003f3217f9f35a3),
+     W(0x0002d93b165a7795), W(0x0000ffb62c2d6cb9)}
+  },
+  {
+    {W(0x0007bd90e9b2fb97), W(0x00025dbf53fc37c7), W(0x00021db5d57d9aee),
+     W(0x0007535a0fa1855f), W(0x000253876dd5a74c)},
+    {W(0x00067f19fde6c0e1), W(0x0001e6f732bb74be), W(0x00034ee6ed4d6530),
+     W(0x0000c09a92bf6943), W(0x00053e04d0faef53)},
+    {W(0x0000000000000001)},
+    {W(0x00025adda8815143), W(0x0006548f8ff17039), W(0x00069e7095898631),
+     W(0x0005ccaf63db46bf), W(0x00036128d089c1d1)}
+  },
+  {
+    {W(0x0002addd39ab161f), W(0x000699d16ce79771), W(0x00063c6e023f8d6c),
+     W(0x0007dbf7e647e5fc), W(0x00050a0f7ae318c8)},
+    {W(0x00076cf44ac97260), W(0x0004367caca1c8a7), W(0x000795b61a8a6419),
+     W(0x0005a4cfb3d090ef), W(0x00063dc084ebd53b)},
+    {W(0x0000000000000001)},
+    {W(0x000706ed422001de), W(0x0005b81eefc88d38), W(0x00075109054a86c6),
+     W(0x00019bc27a48c4bf), W(0x0004f28f36767715)}
+  },
+  {
+    {W(0x0006e285e132cf13), W(0x000591ec45c9d9c2), W(0x0005c09133f93d8a),
+     W(0x0006b0f93a128b4f), W(0x00042b74045837e6)},
+    {W(0x00058e7156004845), W(0x0005129c048d2e3c), W(0x0001514694e3dea0),
+     W(0x000527c4a17122a9), W(0x0007cebd845c8302)},
+    {W(0x0000000000000001)},
+    {W(0x0003b926ed70c90b), W(0x0004fbde3f82e4fa), W(0x0001da551ce0dc3f),
+     W(0x0000c0efabb02b03), W(0x00006f61912f4ad3)}
+  },
+  {
+    {W(0x000238ba0d9abe15), W(0x00026b37deb1440e), W(0x0004e031abdadde6),
+     W(0x00059dc37a300d13), W(0x0007d21cea0005aa)},
+    {W(0x000612eac514ba6c), W(0x00015379cc7045d3), W(0x000144bbc7b0779d),
+     W(0x0006a10ab4e87a0e), W(0x0005ce9bf0e3fa39)},
+    {W(0x0000000000000001)},
+    {W(0x0004a67018786864), W(0x0005e65d298a463f), W(0x00031f9bda7e68b5),
+     W(0x0000a855b47d45dc), W(0x0002f27c42c89d11)}
+  },
+  {
+    {W(0x000066487ae49594), W(0x00074da9ae79908b), W(0x000446d20dc42d89),
+     W(0x000337bcf0875e3b), W(0x0006ecd7ae474494)},
+    {W(0x0003b76bab1d866e), W(0x00009bd05f084f51), W(0x00036f4903b97021),
+     W(0x0000a5369ee4b566), W(0x000342f497b391eb)},
+    {W(0x0000000000000001)},
+    {W(0x0001c0ade56507a0), W(0x00075b9d0aaa979a), W(0x00052600326c6f37),
+     W(0x00024f1a565e574f), W(0x000694f55b3e2447)}
+  },
+  {
+    {W(0x000606dfe02b1cdc), W(0x0007ef09ab68b301), W(0x000638f37802cc97),
+     W(0x0006dd1fcda96040), W(0x0000d41bc59dbe63)},
+    {W(0x00003a0e7fe28213), W(0x0005c3bc82b3cef0), W(0x00040031937c59b5),
+     W(0x0004b24a9611de8c), W(0x00018e2dd3418bfb)},
+    {W(0x0000000000000001)},
+    {W(0x0004e893545e4686), W(0x00074d58ab003551), W(0x0000bd50ff6e0fe3),
+     W(0x00042ea4de54adcb), W(0x0001ba16b97a6d20)}
+  },
+  {
+    {W(0x00027739e9784c1e), W(0x00052c12e4b76dc9), W(0x0001ad6faac0b054),
+     W(0x0000226861465a00), W(0x00000bbb1d1aa823)},
+    {W(0x00007210a7aed097), W(0x0002b2cfca426bd0), W(0x00067f7d8627f343),
+     W(0x00029b0ffe327b0b), W(0x000495cf8f9e9fdd)},
+    {W(0x0000000000000001)},
+    {W(0x0007ca18e3ecf21b), W(0x0006ea28431cc9f3), W(0x0003181c27ab553d),
+     W(0x000608e58db0cafd), W(0x00053c73bac8d44f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000031eebdf40de4), W(0x000295b0c2597da2), W(0x00042f0cc8de40bf),
+     W(0x000600d242cbf639), W(0x00071dd75fe35761)},
+    {W(0x0001533e9f88a411), W(0x0003775efc03676d), W(0x000172d57e053ab6),
+     W(0x00071a1bc333df57), W(0x00039674a4532078)},
+    {W(0x0000000000000001)},
+    {W(0x00064f036287034f), W(0x0003ba3e77409488), W(0x0006a99bc552d193),
+     W(0x000486151c8cefa2), W(0x00054b7045971642)}
+  },
+  {
+    {W(0x00071e0320587090), W(0x000638ab1379164c), W(0x0002320b7928b7ae),
+     W(0x000730b85c0a6979), W(0x000300d6b0bd6734)},
+    {W(0x0004a7bf5c55fc81), W(0x000531e97e1c57b8), W(0x0006f2af4fea65f7),
+     W(0x0004863f8215c1e3), W(0x00040ca073d03431)},
+    {W(0x0000000000000001)},
+    {W(0x00045c14f2aa29f6), W(0x0001b442f65d18b4), W(0x00016008e95533a5),
+     W(0x000107e6cbe0e7b1), W(0x00019c5a9c3bddea)}
+  },
+  {
+    {W(0x0003b7ed36905232), W(0x0004e227f866e886), W(0x00026e92fe50d60f),
+     W(0x0006b46c251a6794), W(0x0000ceb59a95601d)},
+    {W(0x0003582b61615a85), W(0x0006f604bf141f32), W(0x000415753f2693e5),
+     W(0x000676bc22136673), W(0x0001a781b6de1c34)},
+    {W(0x0000000000000001)},
+    {W(0x00075ddb29fb2429), W(0x0003ae6942942869), W(0x0007a4ef3a1b0b45),
+     W(0x00065d4a43dabe3c), W(0x00035071f8ce9984)}
+  },
+  {
+    {W(0x000181168cbec8f9), W(0x0006190b02fed2c7), W(0x000349140f0bed60),
+     W(0x0006141335703b29), W(0x00042545a6a59885)},
+    {W(0x000315672c2eb507), W(0x000341e3cd307f73), W(0x0002cb8182c4a75b),
+     W(0x00005edecf5134dd), W(0x000706406cdbd1ce)},
+    {W(0x0000000000000001)},
+    {W(0x0006f77cd5e9c03a), W(0x0002f7ebd2c0f379), W(0x0003fc958e272ff1),
+     W(0x0001d35be483e063), W(0x0000a2d533a5de8d)}
+  },
+  {
+    {W(0x0006cf68a8476ff2), W(0x000730dca3a6c583), W(0x0005996a3a3fe7e7),
+     W(0x000143d193ccfb02), W(0x00060fba0618ab41)},
+    {W(0x0007645080245d2f), W(0x000799d71734d711), W(0x0001b4ce449fd612),
+     W(0x0007ff4231bd14d7), W(0x00050fee504978da)},
+    {W(0x0000000000000001)},
+    {W(0x0004a76a3f64184e), W(0x0003e6fb7578d61e), W(0x000176243bf95955),
+     W(0x0002dbb3a80252a7), W(0x0003aac54a8c82be)}
+  },
+  {
+    {W(0x00078f89e18cfa41), W(0x0002abedf1e4b904), W(0x0001d4bdb6577be1),
+     W(0x0007437ea227158b), W(0x0007e97763970e96)},
+    {W(0x00007ca1146b6217), W(0x0005b4b15b0dcf3a), W(0x000513b0ff4a4e31),
+     W(0x000747c600c8b746), W(0x0000e85b4c08f01e)},
+    {W(0x0000000000000001)},
+    {W(0x000055dd63945053), W(0x000405ccafceeafa), W(0x0007f497501028ab),
+     W(0x00048d11b66b928e), W(0x0000239371214f23)}
+  },
+  {
+    {W(0x00052a0b25764cb8), W(0x00076bb5eda60567), W(0x00011ebd9a6336e8),
+     W(0x0004fdb604eb7a63), W(0x0000208622a2f72f)},
+    {W(0x00049cba531169f5), W(0x0006403c323153c3), W(0x0003ed1677f04f91),
+     W(0x000682556c3bb6ee), W(0x00014467120e8a31)},
+    {W(0x0000000000000001)},
+    {W(0x0003cd1e140aa179), W(0x0000f041ceb99950), W(0x00033767c28a68a1),
+     W(0x0000113bbda0667b), W(0x0000f638ca79d2e9)}
+  },
+  {
+    {W(0x000711e441703a02), W(0x0007ca9f9cd5846a), W(0x00027ddb2c8b5f35),
+     W(0x0005a8bb39d06710), W(0x0006c1262e3f8a43)},
+    {W(0x00006f0d269c007f), W(0x0002d8bda0274fe9), W(0x0005880aa13c7ec2),
+     W(0x000145cd46a84513), W(0x000193841cf1e0f5)},
+    {W(0x0000000000000001)},
+    {W(0x0001299d9bbc1909), W(0x00071629c472bf67), W(0x00032c7f6728296c),
+     W(0x00005164a2d3a866), W(0x000677401a6f8778)}
+  },
+  {
+    {W(0x0001e973eb7a1caf), W(0x0001b23c03db5383), W(0x00066c1d4985a218),
+     W(0x0003e03ee6e4ae0b), W(0x0003ee51e47dc07a)},
+    {W(0x0005e00d8a0dc492), W(0x000030f2afeb9cf6), W(0x000460731ed22fa6),
+     W(0x0000f45ced8fd1d7), W(0x00074d918b58132b)},
+    {W(0x0000000000000001)},
+    {W(0x0006926dc9a5f790), W(0x00075298d70db9c7), W(0x00040d72979b7646),
+     W(0x000289c0c1e2dddf), W(0x0004869960c846da)}
+  },
+  {
+    {W(0x00047d7fee55429d), W(0x000247abb9f08947), W(0x0000c919b8602979),
+     W(0x0002df3fa6118b00), W(0x000229877ba0bf9e)},
+    {W(0x0006e79f2c35cec5), W(0x00010b5894e59bc5), W(0x0001cec8b8c4a329),
+     W(0x0002c236d7c02eb1), W(0x0006744df1ed5734)},
+    {W(0x0000000000000001)},
+    {W(0x000292e232e38f1a), W(0x0007003296e7e4a2), W(0x0007df7a4df0b1e0),
+     W(0x00011d6932a4d7f7), W(0x0003b5f8eabe329b)}
+  },
+  {
+    {W(0x0000552f7b1efa5b), W(0x0007e935f0b27531), W(0x00060139b842849f),
+     W(0x0002f6a656658c27), W(0x000721fc3ae505b7)},
+    {W(0x0001f318420821bc), W(0x00035b8f70d76dcc), W(0x0000048b4601dba6),
+     W(0x0007d6bea2059bca), W(0x0004cfdd571ad7c4)},
+    {W(0x0000000000000001)},
+    {W(0x00007f925b9d703d), W(0x0007dde5f537ea2d), W(0x000644f5114cf8de),
+     W(0x00014f75cc6edf22), W(0x0007df4590cc2b45)}
+  },
+  {
+    {W(0x00071591c16b22cd), W(0x0003b9418b030bd9), W(0x00079a3fd2dfe24a),
+     W(0x00075b28baba5de6), W(0x0006ad206ad7d2ab)},
+    {W(0x0004cadc386d2308), W(0x000364588f2f7b49), W(0x0003e940136ec9b5),
+     W(0x000501414affa509), W(0x00022c51cb99ae54)},
+    {W(0x0000000000000001)},
+    {W(0x0004f2461361c0fe), W(0x00041e11c0cf51bc), W(0x0005b64cdd39a44a),
+     W(0x00018cd1cfd0d6b0), W(0x0003281330a95096)}
+  },
+  {
+    {W(0x00076016d1d594be), W(0x00018ddced2f96d2), W(0x0003f7ecb3e5f886),
+     W(0x0000bc484277994b), W(0x0005117b43764d4a)},
+    {W(0x00012023df39026d), W(0x0001553edcda93ce), W(0x0001b6ed018405ac),
+     W(0x00000706374fadf9), W(0x000009165bb03b16)},
+    {W(0x0000000000000001)},
+    {W(0x000467d3cfed2943), W(0x00056a97bc75fb77), W(0x0005417a39a58b20),
+     W(0x0006296585141280), W(0x0003987226eb4a89)}
+  },
+  {
+    {W(0x0004fc88d2448bcf), W(0x000337b0ae0ceffe), W(0x0003b9dd6a606aac),
+     W(0x0007302ccdeb8d41), W(0x00013fc4b4b64cdb)},
+    {W(0x0004c5458c4574ae), W(0x0004f9025541a4d2), W(0x000686ab801c04fd),
+     W(0x00075a549e9b8a1c), W(0x0001151178439d12)},
+    {W(0x0000000000000001)},
+    {W(0x0006d8f08d33fcdb), W(0x00021c90d5ec9e67), W(0x000358cd126f96e8),
+     W(0x000283a9e95d53b4), W(0x00014b9046a48006)}
+  },
+  {
+    {W(0x000531f47e19b5b2), W(0x0003018ca2dc5096), W(0x000679820faebfd8),
+     W(0x00013c8577b5cefc), W(0x0002b1351bef71ff)},
+    {W(0x000323e3d6f8c3de), W(0x000098b402c39977), W(0x0000e0cee32f7033),
+     W(0x00044dc4f93c9cd3), W(0x00027b39d0f59e89)},
+    {W(0x0000000000000001)},
+    {W(0x00020e181fea11f1), W(0x0001eab1ec98a51c), W(0x0005834bb4b383a9),
+     W(0x00049d4f99badec5), W(0x0007ac57c6b4c108)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0007690f2fd46cf5), W(0x0006a3ccac27f0e1), W(0x0006b0c00aea14d0),
+     W(0x0004e678b1711e92), W(0x00057426aefc21be)},
+    {W(0x0004c7d1ac2e1f34), W(0x000666764cc64a40), W(0x0003b5c7dd50d085),
+     W(0x000537acd37fd803), W(0x0006b45b002fb4e8)},
+    {W(0x0000000000000001)},
+    {W(0x00069c6f1fba2398), W(0x0007d3d1fc249f5f), W(0x00041859bf9fd944),
+     W(0x000342886b503ba1), W(0x00015d366db67d51)}
+  },
+  {
+    {W(0x000522c5030b48f5), W(0x0006265fca61100f), W(0x0004fef5bdd22a86),
+     W(0x0000d7b07ae7fa42), W(0x000205aa3463e7e4)},
+    {W(0x00076663448735aa), W(0x0007c0818aaddf12), W(0x000749a64efd40d4),
+     W(0x0001f15f4caa82c5), W(0x000320b08e8ec615)},
+    {W(0x0000000000000001)},
+    {W(0x000057250feb45af), W(0x0000767d55b0fc05), W(0x000319248a6ee57a),
+     W(0x00052c29b981afa3), W(0x000232dceb6f8f59)}
+  },
+  {
+    {W(0x00065969024510b3), W(0x0004bb7f0c9b32e5), W(0x0004f18b57137200),
+     W(0x0000abe8d6c8b2f6), W(0x00068fc29a1aa948)},
+    {W(0x0001215aab7db5dd), W(0x000221af22f76a68), W(0x00042620803032a3),
+     W(0x0005338892f44274), W(0x0005de15de41a8b7)},
+    {W(0x0000000000000001)},
+    {W(0x000526a010f6f35f), W(0x0006b7408494485a), W(0x0004c3e3efec2a87),
+     W(0x0004a99b04f60425), W(0x000343271327f27c)}
+  },
+  {
+    {W(0x0000253b65feea37), W(0x0007d48058b85c3d), W(0x00026f0584ac2a62),
+     W(0x0007becf73496af1), W(0x000592c8b8843ca1)},
+    {W(0x00076f2a1d00b5e0), W(0x00026b54c5f0cf35), W(0x00036fb8eabbfb46),
+     W(0x00077c80be5f30be), W(0x00042a352d8dc52f)},
+    {W(0x0000000000000001)},
+    {W(0x0005d561a786cb17), W(0x000597e9b08ed9d2), W(0x0005f8ef96209a5d),
+     W(0x0003e084820bf369), W(0x00018be78b2d7ed2)}
+  },
+  {
+    {W(0x000319a89ab8a220), W(0x000792acb7330cc2), W(0x0003c82c5ae36699),
+     W(0x0000e208e55c60f0), W(0x0005171a309062d4)},
+    {W(0x0005a559f10f60e3), W(0x0006dc9662ac552d), W(0x0000eb2e32c751c0),
+     W(0x0003f365be98c2fb), W(0x0001022927feebff)},
+    {W(0x0000000000000001)},
+    {W(0x0007bac0c0a6d1f8), W(0x0005cdb3618189b7), W(0x00032ba2d267bf6c),
+     W(0x0001d0d63fbe86b5), W(0x00039473ee6cb705)}
+  },
+  {
+    {W(0x0006f01847b02103), W(0x0002088aea7297db), W(0x00071df60099ee31),
+     W(0x0003ff228b0cf48f), W(0x000548cd2fd1081f)},
+    {W(0x00041b76e84fbfd6), W(0x0007ff4f5f849fcf), W(0x0002829111109b1e),
+     W(0x0005b5f2d8dee9c9), W(0x0000bce664e505aa)},
+    {W(0x0000000000000001)},
+    {W(0x0002368d418db19e), W(0x00079f3e1a4d6c75), W(0x000220d99023219f),
+     W(0x00041782a4e26c92), W(0x000515d29084988b)}
+  },
+  {
+    {W(0x0001781f55b9202e), W(0x0006de2898240f9e), W(0x00024090cb2af8c5),
+     W(0x0006955f0ee47a57), W(0x000634d610a2ac90)},
+    {W(0x0003b481522131fc), W(0x0007ea6ac825f5cc), W(0x0000a5ee199dca06),
+     W(0x00067c1a537e63fb), W(0x00017df063f2d3e3)},
+    {W(0x0000000000000001)},
+    {W(0x00024fda21d45546), W(0x0006ccb13aaf1fc2), W(0x000529ee8ad79a0a),
+     W(0x00075d745cfa7492), W(0x0001e892cb6e808c)}
+  },
+  {
+    {W(0x000137bd3713af22), W(0x0004958c68c0958e), W(0x00005780e097b5de),
+     W(0x0000a8e706803254), W(0x000041c030fbca90)},
+    {W(0x00033fcf0780f989), W(0x000547a888bcfd36), W(0x000579705b93a5f0),
+     W(0x0005bd633ee38e32), W(0x00072467625ee43f)},
+    {W(0x0000000000000001)},
+    {W(0x00049e15490c2cee), W(0x00057c3ebe131242), W(0x000780d490d7e166),
+     W(0x00005cd497840bde), W(0x0000c261b889ca28)}
+  },
+  {
+    {W(0x000789b39e1cc09a), W(0x000592be48dfe9bc), W(0x0002435f595ffaca),
+     W(0x00002c08252fe99e), W(0x000742c70ae72dbb)},
+    {W(0x00070bfa8d0b47ad), W(0x0007fa1d08b55bd3), W(0x00042704d8005f1f),
+     W(0x0005544520704e6b), W(0x00061a0d88aa9c1b)},
+    {W(0x0000000000000001)},
+    {W(0x000432993d3b52fd), W(0x00079ad7d83512fb), W(0x000771eca7fe46c8),
+     W(0x0007873f362bcbb7), W(0x0007dc39f6a2ff1a)}
+  },
+  {
+    {W(0x0001c3ca4aec2278), W(0x000434468fb6e732), W(0x000227c0158c4fe8),
+     W(0x00002265e1053eb8), W(0x00034bfde80ebf60)},
+    {W(0x0007c21e9d3e9f8e), W(0x0006e624995b5f79), W(0x0006a848868c71fa),
+     W(0x000184436efb88e8), W(0x0000c25d2657cda6)},
+    {W(0x0000000000000001)},
+    {W(0x000503f933c90531), W(0x0000f57630e24a58), W(0x0003d9af3b9b9d11),
+     W(0x000014c565812239), W(0x00077d763b1a39a3)}
+  },
+  {
+    {W(0x0002c43eefe9c9b3), W(0x0005aa5e098b9552), W(0x0001d5e675bc5f8e),
+     W(0x0004858d16a5cbfc), W(0x00067e8f66f23978)},
+    {W(0x0003a95b1a0a5d54), W(0x0002a58aa315c80c), W(0x0006ba837775c6ea),
+     W(0x00000cbc02ccd8b6), W(0x00066a041636d0d5)},
+    {W(0x0000000000000001)},
+    {W(0x00021e80da51b1ae), W(0x0003bb91ebb6834b), W(0x0000f4619ad44f15),
+     W(0x0003a0ffd3b86aec), W(0x0002d4688abff5aa)}
+  },
+  {
+    {W(0x0004042d19bc7280), W(0x0004a7a22321df10), W(0x00046765e906e47b),
+     W(0x0000d046dc1bd434), W(0x00045bb7b28a493f)},
+    {W(0x0007b61312cc7920), W(0x0004db8062301b59), W(0x000536e6a757be95),
+     W(0x000738afd4e73b0c), W(0x00062acb28cc1ff7)},
+    {W(0x0000000000000001)},
+    {W(0x0003834f27190fec), W(0x000418b2a9e35d4f), W(0x000456285017eacb),
+     W(0x000502ac4ac9e566), W(0x0004c8fef5b00076)}
+  },
+  {
+    {W(0x0006a7898c2a627d), W(0x000104084bef142e), W(0x000297b3c6c13099),
+     W(0x0002ef4234113647), W(0x00012cc327c8da5e)},
+    {W(0x000349fd4355442e), W(0x00061933d849019e), W(0x00016e3b708efaad),
+     W(0x00058cfb8adb3231), W(0x00012f7eaa555b30)},
+    {W(0x0000000000000001)},
+    {W(0x00018800ce1c9b94), W(0x0001c07f48d42e0c), W(0x000234b3fe3ec9d0),
+     W(0x0000edba33f75cdc), W(0x0006fb36bb1c405f)}
+  },
+  {
+    {W(0x0002f84ef6b81983), W(0x00014de9513b77f6), W(0x000278dd50ca5042),
+     W(0x00032f07944fbb1e), W(0x00053631e7682ee8)},
+    {W(0x0005fb50e8577df7), W(0x0002b80308345d79), W(0x0005c7d42d265bc5),
+     W(0x0002b779aa2e2016), W(0x0004c25f20de4f73)},
+    {W(0x0000000000000001)},
+    {W(0x000746d43ac98d99), W(0x00008f8197a6e9ab), W(0x00078382fe5a92c9),
+     W(0x00005638d35012a9), W(0x000765d05da2fb27)}
+  },
+  {
+    {W(0x000586aa31927011), W(0x0006e8812449c618), W(0x0005ab898701399c),
+     W(0x00059f02e25e1bca), W(0x0002b1ae6105d662)},
+    {W(0x0001752f52a191ad), W(0x00047611cb920eac), W(0x00078dc16d30f3a6),
+     W(0x0006afad93aef46c), W(0x00043f2a168592bb)},
+    {W(0x0000000000000001)},
+    {W(0x0006f981b2c80170), W(0x0006e603b4709f6d), W(0x0004e015730cd64a),
+     W(0x0007b0c0988adc78), W(0x0007d58623d0cdae)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00036b8ff4eda202), W(0x0007daa346bd67c1), W(0x0002822a5801e36d),
+     W(0x0004eaea25b067da), W(0x0006222bd88bf2df)},
+    {W(0x0006fa5782e45313), W(0x000117520560d1e3), W(0x00006df13d5042d8),
+     W(0x000012eeb5ed7693), W(0x0000325bb42ea4ed)},
+    {W(0x0000000000000001)},
+    {W(0x000592e9b6740859), W(0x0001d39897f0c5bf), W(0x0000251580ec2af8),
+     W(0x00070563ccc07320), W(0x000628b09e2c7d3a)}
+  },
+  {
+    {W(0x0002aa2d8bdba597), W(0x000337727e412228), W(0x000682a0453a101b),
+     W(0x000262572fd31592), W(0x000023bc7abc84cb)},
+    {W(0x000511df0f29c9ee), W(0x0001e58c41b9ddb0), W(0x0005c81ba413e52e),
+     W(0x00058a64a8101b8e), W(0x0004d2b97a739ece)},
+    {W(0x0000000000000001)},
+    {W(0x000320ab2c14539a), W(0x000137b00f01661f), W(0x0005b6edcf358ad2),
+     W(0x0004243cb28d0446), W(0x0002be24dbdd7a46)}
+  },
+  {
+    {W(0x0007640e33263467), W(0x0004d99d421b1000), W(0x000229877cb2a32a),
+     W(0x000020e2cd45a4e5), W(0x000132a065edb5c4)},
+    {W(0x0005fa3e1dd7de2f), W(0x0003863fd1d4b30c), W(0x0007973f46ce42c3),
+     W(0x0003c03b16b5bdc2), W(0x000534ef70a3532f)},
+    {W(0x0000000000000001)},
+    {W(0x00025b0e72ecf407), W(0x0005e9b86d31f29e), W(0x000717e3d7ee0972),
+     W(0x0002d2ea94ab733a), W(0x00013de9f98824e0)}
+  },
+  {
+    {W(0x000633fbbd39d169), W(0x0002de1deb9e1897), W(0x0001cb211e5ff1a1),
+     W(0x000252cc055229db), W(0x0006d5066cf7137b)},
+    {W(0x000347115219a417), W(0x00068445d52b6b96), W(0x0002e0615fe54802),
+     W(0x0003e441d5f1ad5f), W(0x00054bb8cd82a0a8)},
+    {W(0x0000000000000001)},
+    {W(0x0000ead868ab7c70), W(0x00037519f2944719), W(0x000239bc7c2a540b),
+     W(0x0007330e4f203f15), W(0x000609142e130e7f)}
+  },
+  {
+    {W(0x0002429c7b04c2cd), W(0x0001f7334164ea0e), W(0x0002e82a3d8f00c4),
+     W(0x00049a3fac10ad3a), W(0x00035ff8f7cdb086)},
+    {W(0x00049cbaa6ce8b8a), W(0x0002fbfc351521f8), W(0x0006ed81ad386d5c),
+     W(0x000782aa34f434a9), W(0x00050e1cc6871155)},
+    {W(0x0000000000000001)},
+    {W(0x000289b38c30e3d7), W(0x0000a98bfd31710b), W(0x0006dec6dcfff0ed),
+     W(0x0004a8cc50bd6ec3), W(0x000330c0a7ed1b12)}
+  },
+  {
+    {W(0x0002120a622e0213), W(0x0004928e70b4255e), W(0x00020ca395004af1),
+     W(0x000137b5a74383cd), W(0x0006c6365c17f4bb)},
+    {W(0x0001499e5494c782), W(0x00054c171a7d6061), W(0x0002a7b2382370cc),
+     W(0x0004b4641905002b), W(0x0001c5703a9d3d1a)},
+    {W(0x0000000000000001)},
+    {W(0x0002125c8b8f0450), W(0x00068a693333f97e), W(0x0004db1dc8b06120),
+     W(0x0001547ff45b5efe), W(0x000397f5db80e233)}
+  },
+  {
+    {W(0x00044c675bd887d1), W(0x000309183c31e772), W(0x0001f3aa0d1e7794),
+     W(0x0002965c1800a0df), W(0x00068b818a50b31d)},
+    {W(0x0000e4dfed398826), W(0x0002a6b5bb8ee8e5), W(0x0005b63d0e5a1659),
+     W(0x00035914773a6ba9), W(0x0001e8b233ec0076)},
+    {W(0x0000000000000001)},
+    {W(0x000795099c995b42), W(0x000350ab19851e94), W(0x0004657c36d323bf),
+     W(0x00014e89c4af4304), W(0x00076724d74dba8e)}
+  },
+  {
+    {W(0x0003e8be859362a9), W(0x000285b6b601c94e), W(0x000277aacb4ea942),
+     W(0x0006a71a039dbb31), W(0x0006b66159ac8702)},
+    {W(0x00061a22c8ca96c5), W(0x0000644c063cebfd), W(0x000110cae7398c22),
+     W(0x000282724d9d2eac), W(0x00019dd4bef38efd)},
+    {W(0x0000000000000001)},
+    {W(0x00000356e7c4fdc3), W(0x0006cce9df96746a), W(0x000231226afcf26f),
+     W(0x0000e6a709a55008), W(0x000667fbacce0dc3)}
+  },
+  {
+    {W(0x000050334a9d159a), W(0x0005ce33ce0e9334), W(0x000334c4d2f28074),
+     W(0x000352820028e76f), W(0x0001d3b69c19baa7)},
+    {W(0x0007fbf1373fd0b9), W(0x0007c4663d51a8e7), W(0x0003b378c1ccc439),
+     W(0x000281e507cf1be7), W(0x00068d73077fa5e3)},
+    {W(0x0000000000000001)},
+    {W(0x000375c055e14773), W(0x0005bff2ad6e8f26), W(0x0001d069a22c054f),
+     W(0x0007b510676d36c9), W(0x0000492034611c74)}
+  },
+  {
+    {W(0x0002e27609a42401), W(0x0002309b257e2d42), W(0x0003da7c8d0cb2c7),
+     W(0x00067eb1a5a486fb), W(0x0001a12237794fd0)},
+    {W(0x000684b7d2ba4f29), W(0x00023e115d6e7ea6), W(0x00055638174762b3),
+     W(0x0007797572f6eab2), W(0x0001d079c642f577)},
+    {W(0x0000000000000001)},
+    {W(0x000536d1e398a5dd), W(0x0004b74cc9f3766a), W(0x000578e721630175),
+     W(0x00018a9e40238fad), W(0x000533594b8b7e22)}
+  },
+  {
+    {W(0x000673b0f96c0677), W(0x0002b01cac525d87), W(0x0000b716b8b91d3a),
+     W(0x0000e236c66fa7c8), W(0x00017ffc4a242bfc)},
+    {W(0x000555f000269875), W(0x00033d877c0c651d), W(0x000608cf36b7dccb),
+     W(0x0005244ca9423174), W(0x00069b87fc7d5aef)},
+    {W(0x0000000000000001)},
+    {W(0x0004c59dd4aa431b), W(0x0007464e76380fc5), W(0x000714b55fc458fd),
+     W(0x0000b6246313a047), W(0x000573e2870fd086)}
+  },
+  {
+    {W(0x000568a17517c24d), W(0x00071c688078d879), W(0x0003903cfd1e4425),
+     W(0x0002100fbefd2c49), W(0x0006f0219bc5e589)},
+    {W(0x0003a75491d8d620), W(0x00061f40c689641e), W(0x0005d1944051bf20),
+     W(0x0007e71334f82709), W(0x00064c8c5d0f490c)},
+    {W(0x0000000000000001)},
+    {W(0x00042f04bce66fc8), W(0x0005dec0dc5fbd5f), W(0x0001226e1387aaa0),
+     W(0x0005e9ec008c01be), W(0x0000c8e43546e18c)}
+  },
+  {
+    {W(0x0004b72109a85cc5), W(0x000761ee0187ec1c), W(0x0001c9a0cbd9bb4a),
+     W(0x000116b7bdb3030b), W(0x0004a52307dc395e)},
+    {W(0x0003da3eb734947d), W(0x00012913b4a5f390), W(0x00018967261e0095),
+     W(0x0006aaa501f214de), W(0x0006a83e11cb340f)},
+    {W(0x0000000000000001)},
+    {W(0x000256370cb5a454), W(0x0003a5a52e73f7ab), W(0x00060902a84204b9),
+     W(0x000349e23f6ad1e9), W(0x00038ca9f6f16e0c)}
+  },
+  {
+    {W(0x00008dc7b4d7e206), W(0x000422442e9ca98d), W(0x000681e8c56e3a74),
+     W(0x00004c8fb148d15e), W(0x0007d664177da027)},
+    {W(0x00035d0e82761ae9), W(0x0003b0bd222bd613), W(0x00000b8cac3dfeab),
+     W(0x0005cf0f8a5d92b9), W(0x0002e680498e9582)},
+    {W(0x0000000000000001)},
+    {W(0x0000bd35dde74c3d), W(0x000314202fcaf86e), W(0x0001f392acaa2ee8),
+     W(0x000257d726bfdd59), W(0x000419480e62aa87)}
+  },
+  {
+    {W(0x00061c7c797779d5), W(0x0004bfbfd0827c0b), W(0x0001ba5951da73d0),
+     W(0x0006b19d7cc847c7), W(0x0002ae19cea663d4)},
+    {W(0x000377e5bfcf9334), W(0x0005a6a3140242ba), W(0x00077e504b59af89),
+     W(0x000763f53b5953d0), W(0x0006fc4bdd1912e5)},
+    {W(0x0000000000000001)},
+    {W(0x0004d5bc000fc6b3), W(0x0002cce6c31c323b), W(0x00017384421af80c),
+     W(0x0003f52db867971e), W(0x0003e305c53bc3be)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000172240250a226), W(0x00011ab265a9de1e), W(0x00029463dce2bb9c),
+     W(0x0004f65378611a19), W(0x00071ac99647b61b)},
+    {W(0x0001aa1b5574cf25), W(0x0002b2baa8082715), W(0x0001f906f17872ae),
+     W(0x0002fa4489df180a), W(0x0003a96c2c028ebe)},
+    {W(0x0000000000000001)},
+    {W(0x000702b76ba4a485), W(0x00062510334bd978), W(0x0003884023008565),
+     W(0x00059bf586754cbb), W(0x000433bc26907a52)}
+  },
+  {
+    {W(0x00027667ec45772b), W(0x00056644bbf72986), W(0x0003b90d84539f2d),
+     W(0x0002a46977b8cddd), W(0x000221b138a1bbb6)},
+    {W(0x00025a38180cad84), W(0x000606f7eb331a17), W(0x00066ecc81825d3e),
+     W(0x0005ffd236047b4b), W(0x0007951b295fab7f)},
+    {W(0x0000000000000001)},
+    {W(0x0001383cfa91bd03), W(0x0006960080f49c81), W(0x00023cf485740a10),
+     W(0x00038d4d33779168), W(0x0002561b4449718d)}
+  },
+  {
+    {W(0x0004cf3d3659ce9e), W(0x0000c27fabd6f503), W(0x0006e5c97d7d9cfb),
+     W(0x000394f19e47d4c3), W(0x00029773ddf76138)},
+    {W(0x0000ef909bf19006), W(0x0000d599fcc82f2f), W(0x000044b1fbfb6acb),
+     W(0x00031efdf5bbcd5d), W(0x0005d8ffdb97d47f)},
+    {W(0x0000000000000001)},
+    {W(0x000051ddff1a3d60), W(0x0003d14772d1fb89), W(0x0002144bf06f1ebc),
+     W(0x00042df7bcf167be), W(0x00052213a80ed287)}
+  },
+  {
+    {W(0x0003186bdb3f5c28), W(0x0000bbc5009a2b87), W(0x0006a7daeed4c54a),
+     W(0x0002bf59a7945f76), W(0x0001c1b0d95db6a0)},
+    {W(0x0001d00a9ac3c5d5), W(0x00015811c6c0e7c6), W(0x0004783b5b2ac58a),
+     W(0x00065da6cc55f7ce), W(0x00057bd5de4e0056)},
+    {W(0x0000000000000001)},
+    {W(0x00018c009965102d), W(0x0002d15af2364fbd), W(0x00076a8a61072674),
+     W(0x0006b901636b4488), W(0x0005555c1cdea869)}
+  },
+  {
+    {W(0x00000d015fea2b34), W(0x00077dbf92980594), W(0x0005da54da062061),
+     W(0x0006bb4080bddf91), W(0x00032f5c53b3313b)},
+    {W(0x0004bd55932b52f5), W(0x00068e1f127cb89e), W(0x00063c1216479473),
+     W(0x00033bae25b9dc33), W(0x0004a5ead73f1e47)},
+    {W(0x0000000000000001)},
+    {W(0x00060dcf3726b320), W(0x000738ffb84089fe), W(0x0000b2662e987500),
+     W(0x00016e58da7b3fb6), W(0x0004611e91bcbc0e)}
+  },
+  {
+    {W(0x0004a9fdce2721cc), W(0x0000dc09357c31d2), W(0x0006668632a28499),
+     W(0x0004e416b693da0e), W(0x0006ec452375e303)},
+    {W(0x000315b0e7f485a9), W(0x0003204342837086), W(0x0003a9b10c3eb4ef),
+     W(0x000635eeed3f079f), W(0x0000fbf6bd46e7f4)},
+    {W(0x0000000000000001)},
+    {W(0x0005750305d47a95), W(0x000245d2af68a6de), W(0x000513a0019f9730),
+     W(0x0001cd1edfa4c76c), W(0x0002f11d89be89f9)}
+  },
+  {
+    {W(0x0005526fee661cd3), W(0x0001a532b4ff0c92), W(0x00045debb2f37165),
+     W(0x0005ed67b54d80d7), W(0x0006f4bc341e22f0)},
+    {W(0x00009f3163c8a3cd), W(0x0004a01bf7ae9bb6), W(0x000628e34e62acb1),
+     W(0x00026226eedf91cc), W(0x0007149db8af360d)},
+    {W(0x0000000000000001)},
+    {W(0x00009f1d1d581854), W(0x000260c62363d05d), W(0x0004d0714a8d978e),
+     W(0x0002b3743d41e5fa), W(0x0007d0bb382fbe4e)}
+  },
+  {
+    {W(0x0001437c567c9f47), W(0x000487ce49d76392), W(0x000762d37e8282ad),
+     W(0x000464a4545e9d43), W(0x0004f846fad2eefb)},
+    {W(0x00042a7e1bf02d2d), W(0x00033e1c2d553f0d), W(0x0003284f52699e86),
+     W(0x0006d0d54913dd65), W(0x0000a2640ccde505)},
+    {W(0x0000000000000001)},
+    {W(0x0002c1c56ad35ce3), W(0x0000e487a2f4aa26), W(0x00079d8ae6087173),
+     W(0x00010a712e146058), W(0x0003b50fa995c4e8)}
+  },
+  {
+    {W(0x000787c409b14b5e), W(0x00026b68e370a856), W(0x0001fd7619004f5f),
+     W(0x0007270c62b93676), W(0x0007a8948b7f7000)},
+    {W(0x00063402603b2c72), W(0x000515621df44e6f), W(0x00046ac6d6621c3b),
+     W(0x0002116c101d9117), W(0x000798d31822c16b)},
+    {W(0x0000000000000001)},
+    {W(0x00069eca0ba1d798), W(0x0001a25950225fbf), W(0x0000bbc907e2ac57),
+     W(0x00072dcf61d826d2), W(0x0000dc168fd25ae2)}
+  },
+  {
+    {W(0x000428637346bed4), W(0x00021afe6037808c), W(0x0004caa361526a1f),
+     W(0x00008a896bc741f3), W(0x0000f83554862ac8)},
+    {W(0x000361c9aaeab352), W(0x0003e2e55d3d2d9b), W(0x0007f865fcc50c40),
+     W(0x0002d1f064429510), W(0x000710dd18275194)},
+    {W(0x0000000000000001)},
+    {W(0x00003769e2edc810), W(0x00064f8e1030e7ea), W(0x00077384deab4908),
+     W(0x00060f893c81b1f5), W(0x0005ce037f2027c0)}
+  },
+  {
+    {W(0x0001844f60761dbc), W(0x00075f140bdd7594), W(0x0003780c1ea0b4c4),
+     W(0x00023c6db530a037), W(0x0006fcce2712b351)},
+    {W(0x0000f8122bda7714), W(0x00028285315d8602), W(0x00027183766c27af),
+     W(0x000553f11e0732de), W(0x00036b6308486a9a)},
+    {W(0x0000000000000001)},
+    {W(0x00062bba0382f272), W(0x0002518cfe325c08), W(0x0003a4837a4b3596),
+     W(0x00067187b8f4cdd6), W(0x00063aaa7e1692f1)}
+  },
+  {
+    {W(0x00073cfa56c68afb), W(0x0007013ce8951957), W(0x0001d4fcd8aec94c),
+     W(0x000285f64bcdb500), W(0x0003a8167fce9210)},
+    {W(0x000094e07fdb2b4a), W(0x0001f06c5279b710), W(0x0007b1f7e112e4f0),
+     W(0x0004ad5fba90eb43), W(0x0001e538bc527a21)},
+    {W(0x0000000000000001)},
+    {W(0x000565079b91b17f), W(0x000686f7abe606f3), W(0x0005b84596cc3e08),
+     W(0x0003beff0afaed1a), W(0x00069476bd5004e7)}
+  },
+  {
+    {W(0x000219b59cdbb57d), W(0x000715a21ba774a1), W(0x000456faa3b61025),
+     W(0x0002debd3ae83456), W(0x00044611766e5e7e)},
+    {W(0x0007f08224046d54), W(0x0002a64786110530), W(0x00019e6a50827dfc),
+     W(0x0003fe9446ee8b21), W(0x0006ef80b05bba1c)},
+    {W(0x0000000000000001)},
+    {W(0x0005e59579eed073), W(0x0002d0b180049775), W(0x0004731b8c13610e),
+     W(0x0002608f183ba153), W(0x00034fbb50b000a5)}
+  },
+  {
+    {W(0x00022ee14d3b8dbb), W(0x00019107fb243748), W(0x0006f9ed9759e457),
+     W(0x0004216a92efadaf), W(0x00033c83a0df8cb5)},
+    {W(0x0006a8cfbc24a691), W(0x0004d3cdde3fc117), W(0x0003b9a572300500),
+     W(0x000734e3e0389890), W(0x00016e05dfaa227b)},
+    {W(0x0000000000000001)},
+    {W(0x00059ed896ba6871), W(0x00044ef38d1122f4), W(0x0005f01a2415c7ee),
+     W(0x00038a1b12811eaf), W(0x0004660add304a19)}
+  },
+  {
+    {W(0x00019d6262b579b8), W(0x00038b2d8173a067), W(0x00039d03333b6f1d),
+     W(0x0001d97bc28afa13), W(0x0004fa56e03a907a)},
+    {W(0x00041ed497b15996), W(0x00021d71e7b7c915), W(0x0003c5148478cc31),
+     W(0x00022df386ff825b), W(0x00072034a04ed517)},
+    {W(0x0000000000000001)},
+    {W(0x0005f3b3fd330b15), W(0x000225082bd0a3a7), W(0x00024eff922d66c8),
+     W(0x00078cb734a568c7), W(0x00019571e3503398)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0003ce90b2f23e9f), W(0x0006c6fba067cc9b), W(0x0005a6d491d9c150),
+     W(0x0002d93a15d07e01), W(0x0001f6a1fd8cc0e0)},
+    {W(0x0000865869605e19), W(0x0003859d2657a634), W(0x0002a19102ea1749),
+     W(0x0004d4d98e077c3a), W(0x000779964401ee86)},
+    {W(0x0000000000000001)},
+    {W(0x00063a6ddb180345), W(0x0005678db00bad68), W(0x0004ecad44b3ff9e),
+     W(0x0003dd942354571e), W(0x0000b0009de53cee)}
+  },
+  {
+    {W(0x00035cbbfd4f326c), W(0x0003ee294ccc91b7), W(0x000353e636b68de4),
+     W(0x000502fd3833e7f6), W(0x0006f0a87af6e0f4)},
+    {W(0x0001248c6c6e36c6), W(0x0003c99a44d7cc01), W(0x00021f30757f285d),
+     W(0x00013ee5e5b52174), W(0x0006b60138135059)},
+    {W(0x0000000000000001)},
+    {W(0x0007cba818f0a0c8), W(0x000119e553f5d8a3), W(0x0006f59b8911d495),
+     W(0x00030ec7963d2395), W(0x000277e75c04a57f)}
+  },
+  {
+    {W(0x0006af0a0fcd15f4), W(0x0005d8829faa2d69), W(0x00059b2d11d2184c),
+     W(0x0006192b3a4edb35), W(0x000398c8c8c8e8da)},
+    {W(0x0005ef111a7459ca), W(0x000743e76b873eed), W(0x0007da788d05038f),
+     W(0x000132d6dfd110e8), W(0x0007fc5e88a596b4)},
+    {W(0x0000000000000001)},
+    {W(0x00025850d4b94340), W(0x000337829774ea07), W(0x0007aa4baa035b01),
+     W(0x0006a9c59d10e369), W(0x0006a01ead173188)}
+  },
+  {
+    {W(0x0003134a847a0564), W(0x00026d734dd61ed8), W(0x0001d5d36768c9ad),
+     W(0x0006841d9eb25d62), W(0x0001f90c7ef4610d)},
+    {W(0x0001a1c8ce3a2f7b), W(0x0006c5088246078f), W(0x00025f03d3f7fef3),
+     W(0x00055cbd09e1e658), W(0x00063344ccbe4169)},
+    {W(0x0000000000000001)},
+    {W(0x0007c14da9611f84), W(0x000535a758351a36), W(0x0006a07769f19f8f),
+     W(0x00039918ae86d2dd), W(0x0005b58e9a13a3cc)}
+  },
+  {
+    {W(0x00059fd686603f08), W(0x0005ae148dbd3c5e), W(0x000768558f36db1a),
+     W(0x00048da4f4ae0be3), W(0x0003d22b58c663ea)},
+    {W(0x0002b63fb03b0eb2), W(0x00073e96f8ef32e8), W(0x00045daaf6a02597),
+     W(0x00039399ec5ff106), W(0x0007240c7e82ba83)},
+    {W(0x0000000000000001)},
+    {W(0x0003bad00a4ed035), W(0x00066b25aeb67183), W(0x0007837743c8e4c2),
+     W(0x0004b9b4513da086), W(0x00017d0a611501eb)}
+  },
+  {
+    {W(0x00045e86f1900608), W(0x0001fbe96f3948ec), W(0x0006f302c3bdfd3d),
+     W(0x000799f280c2de8d), W(0x0006e6c09db77eed)},
+    {W(0x0000eceb9c916f07), W(0x00049ea727e1b83c), W(0x0006273e2eeb6666),
+     W(0x000171f72b4fc831), W(0x0005640b667ac2d7)},
+    {W(0x0000000000000001)},
+    {W(0x0002c01148e1f3e4), W(0x00051c425711432a), W(0x0006c182e4447f6f),
+     W(0x0002b27cc4cc22e9), W(0x0007f4eec076f3b8)}
+  },
+  {
+    {W(0x00009339d2475746), W(0x00064fafff9a96a0), W(0x00064bc3ddbb71e1),
+     W(0x000401aa64372298), W(0x0000a8728e5d7851)},
+    {W(0x0007d41cded490c8), W(0x000612647ee1199d), W(0x0004195596834dfe),
+     W(0x00038151f531081c), W(0x0007ef39552f5076)},
+    {W(0x0000000000000001)},
+    {W(0x0002c8f1e0cf253d), W(0x0000b5f94d24808f), W(0x00056b1d1d6e8785),
+     W(0x0005aefaf367ab15), W(0x00076ef0d6c063d5)}
+  },
+  {
+    {W(0x000633092dd34e07), W(0x00049ce7d7c1ba41), W(0x0002b7a22c02deab),
+     W(0x0000d4941a46bd55), W(0x00047ac42e7c5948)},
+    {W(0x00009bb58f7a8924), W(0x0006a3da0c80785e), W(0x00006ba5d3ceca93),
+     W(0x000075f50ae5fe8b), W(0x00028a6c1d1356c1)},
+    {W(0x0000000000000001)},
+    {W(0x0004637d0c8db427), W(0x0000710c2f2b88ba), W(0x000331ebb992a859),
+     W(0x000059a89c85de81), W(0x00075614a27f57db)}
+  },
+  {
+    {W(0x0002b7910ced945c), W(0x00002f43c8943e03), W(0x0001bb23c0c158a2),
+     W(0x0001c7b543ea8a56), W(0x000780ababce39ad)},
+    {W(0x00014fc07df0cd00), W(0x0001973e5dd79a86), W(0x00041dda9fb99045),
+     W(0x00063fb036fe837c), W(0x000100d3f8b5bfb9)},
+    {W(0x0000000000000001)},
+    {W(0x000290ce109af6e3), W(0x0001402cbcf4f231), W(0x00044c806d95f031),
+     W(0x000499299e1bf198), W(0x00031ae8072ec01b)}
+  },
+  {
+    {W(0x00074c3fba74f4a2), W(0x00028fa8b6f8b328), W(0x000284c59aa18c8a),
+     W(0x000683066e3ea30f), W(0x0005a4d2968dc018)},
+    {W(0x0001c0a8907b8a1e), W(0x00031f6eef9a4af5), W(0x0003c2b6c733025a),
+     W(0x0004aac81fde93b3), W(0x000308c037fb48cd)},
+    {W(0x0000000000000001)},
+    {W(0x0000c6bbb0b82937), W(0x00017036fbd8e2a0), W(0x0002806c36ba58ee),
+     W(0x0003903a2c37c350), W(0x0006a4dc390270a2)}
+  },
+  {
+    {W(0x0005eef281a99a0a), W(0x000011646dcde532), W(0x0003815236770f1a),
+     W(0x0004c1fd9038179d), W(0x0005ecf7a21bc84c)},
+    {W(0x00044d5135b0053c), W(0x0001149c6903f139), W(0x0004fea7db0a6cea),
+     W(0x0004c3a775c93163), W(0x00017ccf5f8e8cff)},
+    {W(0x0000000000000001)},
+    {W(0x0005ca3f28d94841), W(0x0002b4f1b24a4127), W(0x0002fad32f20cd17),
+     W(0x000228a2c5be376d), W(0x0005e14f9765e8d5)}
+  },
+  {
+    {W(0x0007f34a4f975ad6), W(0x000215cfae399833), W(0x0006e14a1e8a1abd),
+     W(0x0001608b1f9c0256), W(0x0002fc05ee10f062)},
+    {W(0x0005e2f6f24b5973), W(0x0000e35f8735583f), W(0x00075b3be2d794ed),
+     W(0x0002ca58b54d3c80), W(0x0006798715c0688e)},
+    {W(0x0000000000000001)},
+    {W(0x00052058f931b9d4), W(0x00003ad67d2ac25e), W(0x0005a3dfa25faca8),
+     W(0x0007d39f5335e854), W(0x000252be4a529f82)}
+  },
+  {
+    {W(0x0000e88748b6b7c8), W(0x00026e687b075012), W(0x00018ee4b7af401d),
+     W(0x000530a3f654d466), W(0x00009304517883bc)},
+    {W(0x000787ba627deeb0), W(0x000596907a4f10e1), W(0x00023266f43015d4),
+     W(0x0004ea0b18d124a5), W(0x00045a2112a3aefd)},
+    {W(0x0000000000000001)},
+    {W(0x00008491538d3b03), W(0x00057cf539924ff6), W(0x00040a85d116904b),
+     W(0x00049581dee5e619), W(0x00063b814e9cd3fa)}
+  },
+  {
+    {W(0x0002fec151d07243), W(0x000273fa09c60fa8), W(0x00004230133fc88a),
+     W(0x0001feab4a1f25fc), W(0x000249985c52a922)},
+    {W(0x0005ff916e4a3142), W(0x00049bd2761f8caa), W(0x00008cd55b1cc879),
+     W(0x000198cce67d2f4a), W(0x00027a0dd06e1e78)},
+    {W(0x0000000000000001)},
+    {W(0x00063cc873f2e728), W(0x0001fd666891aeba), W(0x00056f867a529b70),
+     W(0x00044fe91334459a), W(0x00055f90754bc459)}
+  },
+  {
+    {W(0x00033d9053688e56), W(0x0002c078313e07b3), W(0x0000b86c9ab7fdfd),
+     W(0x0003b6d77f84f8bc), W(0x0006d498ab335167)},
+    {W(0x0003c3c9923499bf), W(0x0003865208cd4362), W(0x000057b6471d7d39),
+     W(0x000147b2d65987e1), W(0x00059f8ccf31bacf)},
+    {W(0x0000000000000001)},
+    {W(0x00050a416cfb77f9), W(0x00065884b2597185), W(0x00077c6a0a824940),
+     W(0x000312ca04a385a0), W(0x00060f28061c9e17)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0005a4a5fc39d5cc), W(0x00069d0339c2a655), W(0x000417f2458070ac),
+     W(0x00006214c06e59d4), W(0x00022e2c03906792)},
+    {W(0x0000577089e1a8bb), W(0x00025041bec78a83), W(0x00038ce41a5a1c14),
+     W(0x0007936bf2cad9fc), W(0x000631cf9945a09b)},
+    {W(0x0000000000000001)},
+    {W(0x000569f70c321dcd), W(0x0004fa330fbed31d), W(0x00067484e4eddcee),
+     W(0x00011a605d4ba66c), W(0x0002cb238a03d0f0)}
+  },
+  {
+    {W(0x00013673649ad53d), W(0x000147e85310dad6), W(0x000272a10bd71fc6),
+     W(0x00051f927cee5429), W(0x0001a62e85ba4a14)},
+    {W(0x00030dd514c8bdc5), W(0x000122307cd4bc3d), W(0x0005f9460d547400),
+     W(0x0002ec65dcc0803a), W(0x0001f6d17d9a1e5c)},
+    {W(0x0000000000000001)},
+    {W(0x0000672fd519912a), W(0x0006b771be598590), W(0x0002babbca90173b),
+     W(0x00008867b4e8a5a3), W(0x00065c7c788cd240)}
+  },
+  {
+    {W(0x0003fa47eea2dcf9), W(0x000126e056ec5f2d), W(0x00062db743fefa5f),
+     W(0x00040550d667d295), W(0x00045d50507f0c28)},
+    {W(0x000046057297ebe8), W(0x00045872a5f935a5), W(0x00010d50fd413691),
+     W(0x000071f2ca1a967a), W(0x000554b5aab95422)},
+    {W(0x0000000000000001)},
+    {W(0x00049c1b599b7b14), W(0x0002cd47be471c9f), W(0x00001ea3ceb02c79),
+     W(0x000597d3a1602039), W(0x0007ab2c2c41d7d7)}
+  },
+  {
+    {W(0x000752e1e9e4f9ea), W(0x0003bb3ba1a32a27), W(0x000754248e1cc64e),
+     W(0x0001b73b04c975c1), W(0x00036b566a2c0f8e)},
+    {W(0x00070232ed39bb3a), W(0x00047082870f487c), W(0x0005e376517b4913),
+     W(0x000270cf39a62ac4), W(0x0001bde4ad0433ee)},
+    {W(0x0000000000000001)},
+    {W(0x0003692c693885f0), W(0x0003d1ab4e7eff59), W(0x0005f869940ed2c3),
+     W(0x000127977500c60b), W(0x0001a8228abcd640)}
+  },
+  {
+    {W(0x00008263fe52730c), W(0x00047b0447a31ac2), W(0x000635e33e0ff139),
+     W(0x000377b1cd102faf), W(0x00041eaa719e14d9)},
+    {W(0x0000ebed4d735d76), W(0x0006a49088663617), W(0x000265c639b843c8),
+     W(0x0001efe1ce0e9534), W(0x00077df8f3c75cc3)},
+    {W(0x0000000000000001)},
+    {W(0x00016bf8db3493e5), W(0x00079cbd6365c639), W(0x0000a8ab0b01b4b1),
+     W(0x00071eed146b9295), W(0x00078ea84b00a89c)}
+  },
+  {
+    {W(0x00047f66f297f048), W(0x0003ffcfe6cebe8a), W(0x00001705caf8c048),
+     W(0x0002e1bc483cd361), W(0x00017475a442c175)},
+    {W(0x000620e47c0b4d5a), W(0x0006bc9c3e0ceb17), W(0x0000fc5fd2667ce7),
+     W(0x0002748c2e0e6796), W(0x0004d82da48fe810)},
+    {W(0x0000000000000001)},
+    {W(0x00051eff58f9d515), W(0x0006891de8bfc8be), W(0x0002adcbfae0cd8b),
+     W(0x0000ac05525286fb), W(0x0006afe532d81f83)}
+  },
+  {
+    {W(0x00036f87f3ee8d61), W(0x00067700ddb56e97), W(0x0001739a24927fbf),
+     W(0x0003cd167f4cf40e), W(0x000465583d6ebd73)},
+    {W(0x000550d94e6593b5), W(0x000760d0cdbca5ba), W(0x00013c5e4b390b4a),
+     W(0x000792d112df79ad), W(0x0003bbff70797fee)},
+    {W(0x0000000000000001)},
+    {W(0x0003738124be1a26), W(0x00033de4b52ec1af), W(0x00007eaa1ee26429),
+     W(0x000442135cce9c8c), W(0x0003771efb1f81b2)}
+  },
+  {
+    {W(0x0003c5a3e38fe7b2), W(0x0003ff082f3dce59), W(0x00009ddd171597bb),
+     W(0x0002713ae9ac5e9e), W(0x0000fc8f365bb4b0)},
+    {W(0x0004e2b534937b24), W(0x0002f2417419a90e), W(0x0005778ac3d0e59a),
+     W(0x00073c0ba2adb51c), W(0x00016f91c8191db1)},
+    {W(0x0000000000000001)},
+    {W(0x0003f53e0248f8c9), W(0x00049be7ff297779), W(0x00072b9f5bf8afaf),
+     W(0x0004dc4d7c4da035), W(0x000449f2a098fc69)}
+  },
+  {
+    {W(0x0004ce55d9cb3307), W(0x00018a74307121d6), W(0x0001c5afd7e52324),
+     W(0x0003314d8862510b), W(0x0005a65b40a115ce)},
+    {W(0x00000ea0c1be18ea), W(0x00008a17a2843d3b), W(0x00062efc4d85150e),
+     W(0x0007e84a001c3f95), W(0x0004b4cb2279ca0f)},
+    {W(0x0000000000000001)},
+    {W(0x00039f2067f4d952), W(0x0005a95bb002ac45), W(0x00076e1b748aeba2),
+     W(0x0000ce707a15c82c), W(0x000275b4c5df81e4)}
+  },
+  {
+    {W(0x000692f10eae3d6e), W(0x00070611eac26232), W(0x000393fa3e3b5bc3),
+     W(0x000597fc33d4af35), W(0x0002ca7632e41646)},
+    {W(0x000168e43c4a4c1e), W(0x00063d2b5c447b8d), W(0x0001e69367fbd39a),
+     W(0x000784a1d04207e7), W(0x0006c1215140aa70)},
+    {W(0x0000000000000001)},
+    {W(0x0005dc989d5cd6bb), W(0x00009ffdb5189543), W(0x00035c4bcb87a6c9),
+     W(0x00004666ce10b9c5), W(0x0006d5837e43dbf2)}
+  },
+  {
+    {W(0x0002ae0fe3d20262), W(0x0006678b43221323), W(0x00032a908d8f50be),
+     W(0x00064f97c0220198), W(0x0004b0549007a7ef)},
+    {W(0x0005926e00508ab1), W(0x00058ca24aff626c), W(0x0000b0a2cbcd6498),
+     W(0x00018b9c3e450685), W(0x0005067bb90a12b3)},
+    {W(0x0000000000000001)},
+    {W(0x0000cbe048f44a5d), W(0x000324834a2cdcd3), W(0x0003e24b54409341),
+     W(0x0004fded6c4acd49), W(0x00001339adcadf75)}
+  },
+  {
+    {W(0x0006e9d55ad1df16), W(0x00012a2bf272ab09), W(0x000521575324ab0c),
+     W(0x00053161d951d23c), W(0x0001b3947ade88ca)},
+    {W(0x0001e63a519eda46), W(0x0007c10f69b774da), W(0x0003dff4ffcf5632),
+     W(0x0003e825a996c022), W(0x00007f7d8b5c1688)},
+    {W(0x0000000000000001)},
+    {W(0x0001ba4aa5dbcb40), W(0x0001ee8422e9b531), W(0x00078861bbdc68ec),
+     W(0x00057d278b89cc4a), W(0x00018c2212a43598)}
+  },
+  {
+    {W(0x0005845edf6f3aa5), W(0x0006b72ce1274eed), W(0x0002f6d8ea424d06),
+     W(0x000649950663c58c), W(0x000638297477e772)},
+    {W(0x000095cba07fb9ad), W(0x000626d3f28bfd45), W(0x000682c339772024),
+     W(0x0004796a07b7017e), W(0x00025badfe12f69a)},
+    {W(0x0000000000000001)},
+    {W(0x0002f0c788744e77), W(0x00049c0643b3cb0d), W(0x000061c666636e52),
+     W(0x0002a499911da3c7), W(0x000189c4bb6307c9)}
+  },
+  {
+    {W(0x000548c9ba376507), W(0x0003b00e6d58a1ed), W(0x000383adfbb5f512),
+     W(0x000328aa3e022226), W(0x0005aa5735d0f93d)},
+    {W(0x000426e4772bde5c), W(0x0006e32e01b7d14d), W(0x0000e32d9b2f61c2),
+     W(0x00025d69b748f671), W(0x0001e844dce46a77)},
+    {W(0x0000000000000001)},
+    {W(0x0006bbf4d59bc343), W(0x0007e4f27c45da7b), W(0x00013253fa23f75a),
+     W(0x0006784f81fc17e6), W(0x000011b03fa6b7c9)}
+  },
+  {
+    {W(0x0001ccddd740ab75), W(0x00050ccee5651eb2), W(0x0003e70b64385b7f),
+     W(0x0007820d7b1016c5), W(0x0003e6efe3595ef9)},
+    {W(0x0007ce0ae3202a65), W(0x0001ead43090bc42), W(0x0007701a24ca66b3),
+     W(0x0007a04ade6e6892), W(0x0004d236a89d7536)},
+    {W(0x0000000000000001)},
+    {W(0x000185840854935c), W(0x0003b9006df98e0d), W(0x0006804b87d023dd),
+     W(0x00012564bbec168c), W(0x00020a309664e78a)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0001d2b7be4610f4), W(0x00007af44ecbd9da), W(0x0000f3d96a079370),
+     W(0x00029a10cebd576f), W(0x000608de273a9f6a)},
+    {W(0x0006d841f67144fa), W(0x0001f09d66e26b18), W(0x0005eaa723731e58),
+     W(0x00040d589897d941), W(0x0003b31d0113f98d)},
+    {W(0x0000000000000001)},
+    {W(0x0004ceecee1b44a8), W(0x000563b7af463258), W(0x0002e04fb6ecdb7e),
+     W(0x000720002f0a3d51), W(0x00041a571f633073)}
+  },
+  {
+    {W(0x0003a3011634d581), W(0x0006f27d928a5d52), W(0x0002d7e560b44606),
+     W(0x00031f977b27d505), W(0x00008d1e75a33bf3)},
+    {W(0x0007b5ccae42cf1a), W(0x0004da0b6b78872e), W(0x000449c557409d64),
+     W(0x000520f54e1ec44e), W(0x00047dd939350f06)},
+    {W(0x0000000000000001)},
+    {W(0x000434b14fbeb6f9), W(0x0002db91535249cd), W(0x0003dcb0cbf75061),
+     W(0x00057c401033942d), W(0x000302853df2cba5)}
+  },
+  {
+    {W(0x00043f0dfd1da83e), W(0x00004113b0ddf4e1), W(0x00053381c4548146),
+     W(0x0006514dd84675fb), W(0x0004b55df555ef78)},
+    {W(0x00066e8cdcd6194d), W(0x0005ab028755a609), W(0x00003cb9a10526f5),
+     W(0x0005a95174bf6017), W(0x0002faebe97416b3)},
+    {W(0x0000000000000001)},
+    {W(0x000027445acc6496), W(0x0006782f693655e9), W(0x0006a8cd5b9861b0),
+     W(0x000578cccecb3c25), W(0x000348119c5c585e)}
+  },
+  {
+    {W(0x0005aa1c6d51c96f), W(0x0005dc4287f214be), W(0x00013b82b3f59239),
+     W(0x00050514de60f291), W(0x0000b2fcb60a19e6)},
+    {W(0x000144a1f33239dc), W(0x0000f2bf6f1878bd), W(0x00077897a0d0d4d1),
+     W(0x0001c336bb5a6349), W(0x0006301b568e9c61)},
+    {W(0x0000000000000001)},
+    {W(0x0001767ba9159506), W(0x00057df5fa7ac109), W(0x000214b365c4017e),
+     W(0x000765dd92ee632b), W(0x0002b763e30bf6e3)}
+  },
+  {
+    {W(0x0000028dd62ec76e), W(0x00000b1d7e690987), W(0x0006c62c01be597e),
+     W(0x00038a7726f51b21), W(0x0006d187e11aedfd)},
+    {W(0x0000464f0c1ce745), W(0x0002ac3a1782fc5c), W(0x0004f978c41c144b),
+     W(0x000620513ea91bfc), W(0x0003607198a1819d)},
+    {W(0x0000000000000001)},
+    {W(0x00010f47c2129fd3), W(0x00000a02acd47d87), W(0x0002715b707968c5),
+     W(0x000495a74165e473), W(0x00016affe7f532c6)}
+  },
+  {
+    {W(0x0004d99764529a1f), W(0x000553a4cdea2103), W(0x0003a5dfe90cce4e),
+     W(0x000475ba8c2ecdb1), W(0x0004db4418f87f77)},
+    {W(0x000513e93e82a813), W(0x0001bb59f9403d75), W(0x00007b71eb1db3df),
+     W(0x000540312aa76437), W(0x0005140b9860c78e)},
+    {W(0x0000000000000001)},
+    {W(0x00033a1308112a6c), W(0x00069766b0bf7e89), W(0x0001918274226d47),
+     W(0x0004d45c52d519cb), W(0x0000fe52219a0cae)}
+  },
+  {
+    {W(0x00031dda40465406), W(0x000650beb1c1a888), W(0x000123a5c9259b42),
+     W(0x0006c6ccb8df73b6), W(0x0006e1a9bb685ada)},
+    {W(0x00039e6aca5e83e8), W(0x0006a3e7c5796320), W(0x0005007541e92105),
+     W(0x000546cf963e1f5f), W(0x00031ef82c7b281a)},
+    {W(0x0000000000000001)},
+    {W(0x0000f393dba889fd), W(0x0001fe546e404461), W(0x0003354b7213155d),
+     W(0x0006d454e42d3aa6), W(0x00013efddc558a2a)}
+  },
+  {
+    {W(0x00048f4c0dd3ae27), W(0x0001f15ca78fbd46), W(0x0006d058c362496f),
+     W(0x00066413f5ffbad1), W(0x0000b216ceec26c5)},
+    {W(0x0007aa2a5312bac3), W(0x0005d14aaf0335ae), W(0x0004e245bb0a1d80),
+     W(0x0000c79262bd1fc8), W(0x000563053b0dec55)},
+    {W(0x0000000000000001)},
+    {W(0x0006b7e7fe7e3222), W(0x0005099deb290a51), W(0x0007f3db2e46de32),
+     W(0x0003a4fb628f12b0), W(0x00069755a4fb685c)}
+  },
+  {
+    {W(0x0000242e9e60c764), W(0x0000fa743de4b534), W(0x00002bb1ed982196),
+     W(0x00044b9e0f139291), W(0x0001c51748deaa9e)},
+    {W(0x0001658e8ca337f5), W(0x00000e000ffc0d57), W(0x00020effc06aff85),
+     W(0x0006a28b146690b5), W(0x0001b8cb118a38f3)},
+    {W(0x0000000000000001)},
+    {W(0x0003850d63eb2bde), W(0x0007aa5607a023c9), W(0x0001edcabfda6277),
+     W(0x0005df1a79145e03), W(0x0007746c017c6eda)}
+  },
+  {
+    {W(0x0000913b18810291), W(0x0001e5e8ea0b2b44), W(0x0004bf7a78270efc),
+     W(0x00017a6024b86523), W(0x0001a3021f54227a)},
+    {W(0x00059ede3b9a584b), W(0x000559ecb6d01136), W(0x0006c8a1d8b3a30a),
+     W(0x0004be1023048161), W(0x0002f164821a5822)},
+    {W(0x0000000000000001)},
+    {W(0x0003020a4e3fc82f), W(0x00040b5f3c0e6e2e), W(0x00031d70e9f76056),
+     W(0x0004c3e455be7146), W(0x0004b8af26b9b8e4)}
+  },
+  {
+    {W(0x00029a29a81b27c5), W(0x0006b35c223ed5f2), W(0x00036a340b8f1a78),
+     W(0x0002ed37c98bd8ec), W(0x00035a374fd866f6)},
+    {W(0x000478a057243ed4), W(0x000455f326f3aa7e), W(0x00011dd2630d4cc0),
+     W(0x0002333a3d85e3fc), W(0x0002c5e1d98e6fc7)},
+    {W(0x0000000000000001)},
+    {W(0x0002bd418602d092), W(0x0000cc494a7b2d3c), W(0x00022f2b359afb52),
+     W(0x00025a56a2863c35), W(0x0000a5de245ea973)}
+  },
+  {
+    {W(0x000431e203ba4aa0), W(0x0000bf44a6ee9c92), W(0x0004b169d6a01cd1),
+     W(0x0003c742fbddbdea), W(0x00011f15dd58c2b3)},
+    {W(0x0001b2423a8542a3), W(0x00048fd850d0e991), W(0x0002222fa22b70d4),
+     W(0x00070e23980f366c), W(0x0007ac2b06fe00ba)},
+    {W(0x0000000000000001)},
+    {W(0x00030eaa50c29625), W(0x0003f926bb6159a9), W(0x0007495f032ca19f),
+     W(0x00064563f89f1b54), W(0x0004b9e57405be42)}
+  },
+  {
+    {W(0x0005d9b555985f22), W(0x00023d41c1f40df6), W(0x0002dd376e06ee14),
+     W(0x0000b17e6a02e874), W(0x0000f4684254b1ee)},
+    {W(0x000204ea13f80f57), W(0x0004db0f7dde98ee), W(0x000192d940187bf6),
+     W(0x0000f584c496cdc9), W(0x0003a3caac325e36)},
+    {W(0x0000000000000001)},
+    {W(0x000305dff3eaabdf), W(0x00016e6d21fa72e3), W(0x00076721a4ea3d69),
+     W(0x00062381a655b45d), W(0x00065242baf72cb8)}
+  },
+  {
+    {W(0x0002056d7d4980d9), W(0x00060716355667ee), W(0x00069a7d359ecaf9),
+     W(0x000074490f042fb8), W(0x000347a5ba72a9db)},
+    {W(0x00005198f69b1a2c), W(0x00072e50d4ad6e16), W(0x000672d3e4293c90),
+     W(0x00071c8b5cdd3b9e), W(0x0001d8d53e99b38c)},
+    {W(0x0000000000000001)},
+    {W(0x000344f9758e40b9), W(0x000238f84c6564cc), W(0x0000ce2ff8dfe171),
+     W(0x0005fa32523b401e), W(0x00015180b04ff778)}
+  },
+  {
+    {W(0x0000c3d3cd63306a), W(0x000571843e116d0e), W(0x0001047c0cbaf2ab),
+     W(0x00012084cdb29d2f), W(0x000287e8b33b4dc5)},
+    {W(0x00067b05c4d45ef2), W(0x00055e358f226a52), W(0x0003d4b7e27e2328),
+     W(0x0002897223746b11), W(0x000175d8254f2244)},
+    {W(0x0000000000000001)},
+    {W(0x0003482446bcfeb3), W(0x0004a28100e8aa2c), W(0x00067aa18641775c),
+     W(0x00013715342fc997), W(0x0000053f6abdd129)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0005ca181254fe02), W(0x00028db4686d14af), W(0x00079cca3a95a8a8),
+     W(0x00059f226371a7b1), W(0x0003f748617ca63a)},
+    {W(0x0003dc527dc1641e), W(0x00033dc9d3942b42), W(0x0006a6b3b932eca2),
+     W(0x00023d9c9c51448d), W(0x0000fed89e6420fc)},
+    {W(0x0000000000000001)},
+    {W(0x00062b3f3527dcae), W(0x000184bf3b743f45), W(0x00038f904ff6726c),
+     W(0x00016116e331cede), W(0x00022fed019d0a10)}
+  },
+  {
+    {W(0x00021083808c3cf3), W(0x0007fbf6938a06f1), W(0x0003ff581c8fde30),
+     W(0x0002f21dbab64150), W(0x00008f050e6e4bbb)},
+    {W(0x000233924875ee62), W(0x0000342f42b5be9e), W(0x0002da2018caa518),
+     W(0x0002a15a5c9aa39b), W(0x00038900048f0768)},
+    {W(0x0000000000000001)},
+    {W(0x0001e442561a5cb4), W(0x0007551c35503df6), W(0x0001da83cfdc7e80),
+     W(0x0006c36aacfa869f), W(0x00030a98264d642c)}
+  },
+  {
+    {W(0x0001d195c39d1551), W(0x00003022b3ac9767), W(0x0001f4b292db41a3),
+     W(0x00021df0001c812f), W(0x0001024811dcacca)},
+    {W(0x000246d937f929e7), W(0x0007eb69bfce19ab), W(0x0003bbbfd2473e96),
+     W(0x000112e273e814c5), W(0x00049e4fc36ff8a9)},
+    {W(0x0000000000000001)},
+    {W(0x0001e927263af7c5), W(0x0002c9f4ebc217e6), W(0x000794d2bed5c01a),
+     W(0x00001bc9207689d8), W(0x0007b1f142d4c5b6)}
+  },
+  {
+    {W(0x0004357d04b900bd), W(0x00024640a17a1d7f), W(0x00078541d49225e9),
+     W(0x000642f3c7410131), W(0x0002583374456f20)},
+    {W(0x0002da60cbcea18f), W(0x000065472523c042), W(0x000727a901dfaedc),
+     W(0x0003963f3eea9615), W(0x00062d1c4fffd5ac)},
+    {W(0x0000000000000001)},
+    {W(0x00043a7d396c834f), W(0x000475f304ccdeac), W(0x0006529eecb82c20),
+     W(0x00064025dffb91d1), W(0x00018af050169c27)}
+  },
+  {
+    {W(0x00005e1a4073a50e), W(0x0002f9fc62ba46cc), W(0x00030d6b4d732f68),
+     W(0x0000056b3920e645), W(0x0006101527121229)},
+    {W(0x00017b261703b175), W(0x00008d9ec7811cf5), W(0x0007e61a72481531),
+     W(0x0004f51215b52f4a), W(0x0002e7e246fc7adf)},
+    {W(0x0000000000000001)},
+    {W(0x00032ac6b77241a7), W(0x0004b08c4ff1a810), W(0x00061298267df7af),
+     W(0x00079bfecae605d1), W(0x00048f7bbf54f4b3)}
+  },
+  {
+    {W(0x00032215421c92ba), W(0x0006b3f65a2ad01c), W(0x0002b4f70b8b7660),
+     W(0x00013c00253a74f5), W(0x0002fba67cbc177c)},
+    {W(0x0000f2d6e8ea91d7), W(0x000170fe9ca0a2b8), W(0x00077434b4e35225),
+     W(0x0001f3b66eea37c1), W(0x000363948c10bafb)},
+    {W(0x0000000000000001)},
+    {W(0x0001e8e37a66fe0f), W(0x0000fb56947bedbe), W(0x0005314d50335983),
+     W(0x0005bf2f94253aba), W(0x00016a0e2b7171a4)}
+  },
+  {
+    {W(0x00033db0b011b907), W(0x0004ec6f6a844c90), W(0x0003034db39bacd5),
+     W(0x000687c350e0602b), W(0x0004d0892a3b61ec)},
+    {W(0x0005aaaa819fab6f), W(0x00020efeb6fb1612), W(0x0002283b32a2fe9d),
+     W(0x0001d8d9877e9a25), W(0x00038ec39469a1e5)},
+    {W(0x0000000000000001)},
+    {W(0x0006b5f9559ef274), W(0x00069ec6fb3b7c92), W(0x0000e8861cb17d65),
+     W(0x00056f0008491ec5), W(0x0006aefc5caa4e0f)}
+  },
+  {
+    {W(0x0001fc4e5b98881d), W(0x0005c56a1cc0a488), W(0x0006c9c9af65465a),
+     W(0x0005085db44c2119), W(0x00005b4079d8c7a5)},
+    {W(0x00033fa8d79f612f), W(0x0001fcd20d221190), W(0x0005f953928d8f4b),
+     W(0x00052bc80e09b4f2), W(0x0002329432253e9a)},
+    {W(0x0000000000000001)},
+    {W(0x00072bc0bf01782a), W(0x000605c00bfef2e1), W(0x0003b0c446b6f848),
+     W(0x00009b9309a9cf18), W(0x000703fd452f1281)}
+  },
+  {
+    {W(0x000276c192ee52b7), W(0x0006d5d669add8a4), W(0x0007799f1ce79f79),
+     W(0x000277ec4ef5170c), W(0x00000f511b29c147)},
+    {W(0x00055fcd0d9c2abf), W(0x00037fb30d2ea1ba), W(0x00003babcaf1ab2c),
+     W(0x000735a92e9e6068), W(0x0001558f86c57b18)},
+    {W(0x0000000000000001)},
+    {W(0x000216517b1e2613), W(0x0001330533d7829a), W(0x0004b56cae123c29),
+     W(0x0002df2d270fa1df), W(0x0003b6ae03a91983)}
+  },
+  {
+    {W(0x0001f1e288b27130), W(0x00007a3fc456849e), W(0x00054e1fb7fcbc47),
+     W(0x00046ab4ccad9737), W(0x00023f84917faf2e)},
+    {W(0x0005cf2317892c5c), W(0x0002d08c94ba20ab), W(0x00049c1deef26512),
+     W(0x0004918a58ed0d94), W(0x000121f0f8eb4212)},
+    {W(0x0000000000000001)},
+    {W(0x0003667c46aa0501), W(0x0005f64d9a18d7f0), W(0x0006014b93ff72c1),
+     W(0x00046a1d0a212c30), W(0x0007e1d7e31cd546)}
+  },
+  {
+    {W(0x0000ad0133167494), W(0x000092b85c3c2af0), W(0x0000dc4b5bd4d59f),
+     W(0x0001c58f16a0edd2), W(0x0001a7a38e86128a)},
+    {W(0x0005eb1b2f80d869), W(0x0002f1003a683562), W(0x00071210debf3f41),
+     W(0x000023dd8f3998a0), W(0x000685feb877cd33)},
+    {W(0x0000000000000001)},
+    {W(0x0005d07eeeceb2d3), W(0x000282acb9347325), W(0x000795148e3e3093),
+     W(0x00044d97fa9a1efe), W(0x0001cf4700624c85)}
+  },
+  {
+    {W(0x0006d73d900afc44), W(0x0007296e5d677ac4), W(0x0006b41da2843ee9),
+     W(0x0007d35aeda19992), W(0x0004082957ec9b70)},
+    {W(0x0007ac800628aa9c), W(0x000160d567e27702), W(0x000534feda9cd9c3),
+     W(0x0002c493f98b1ce2), W(0x000486f39d784129)},
+    {W(0x0000000000000001)},
+    {W(0x0004ce0e79b8a5c7), W(0x0001dda1323b2087), W(0x0007972bae5645f0),
+     W(0x000440042316d7c2), W(0x0007a8f4fa1392e6)}
+  },
+  {
+    {W(0x00047ca08cb73a08), W(0x00046d471be644a5), W(0x0005747564725f33),
+     W(0x00023bcd1ef3ce68), W(0x000428e2ccc7d204)},
+    {W(0x0003731e8de87698), W(0x00071dc0c28b0995), W(0x0004158e6fe558c2),
+     W(0x0006b3e06458d23d), W(0x0005b8038cf395d8)},
+    {W(0x0000000000000001)},
+    {W(0x00071289d70a924d), W(0x00004357cbfc1379), W(0x0006e7364e28c8f1),
+     W(0x00018b4b5a9fecad), W(0x00018d56bccff6bd)}
+  },
+  {
+    {W(0x00040667672a48af), W(0x000410e882a9df4c), W(0x0004c6211962cb07),
+     W(0x000461f50e108b30), W(0x000223426c577ac9)},
+    {W(0x00055dcddca418b7), W(0x0000daeb47e805f6), W(0x0007ebce6967f1f9),
+     W(0x0004b107210a9ebc), W(0x0007313dc235bcc2)},
+    {W(0x0000000000000001)},
+    {W(0x0006102d408653b1), W(0x0000c206ae82129a), W(0x000122198fd0d909),
+     W(0x000252a5d240850a), W(0x0006983916f3da25)}
+  },
+  {
+    {W(0x0005750f8606ba91), W(0x0006b46e20d76a77), W(0x00056186a73b9066),
+     W(0x0007cebc01e955a3), W(0x00012479bedc9137)},
+    {W(0x00040846aeff2040), W(0x000433a7373be4f9), W(0x00005b6a5b79514c),
+     W(0x00025a898ee1f3ba), W(0x0002ab5c781be0a2)},
+    {W(0x0000000000000001)},
+    {W(0x000772d1a2499a0c), W(0x00019c9ea59384a3), W(0x00035c60da9b81c3),
+     W(0x0002458bc6a86bcd), W(0x00039bde47cbc1d5)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00062dfd0af81ce5), W(0x0005682fae1ebeaf), W(0x0005574666fbf845),
+     W(0x0002b64be05f9894), W(0x00069d98b5ecc35d)},
+    {W(0x000481f8259f4e8e), W(0x0003702a9aa1c5aa), W(0x00023fa52f3a4a9a),
+     W(0x000355a270651d92), W(0x0003e26d487fbfe3)},
+    {W(0x0000000000000001)},
+    {W(0x00051d536d8afbbf), W(0x00006f48eafebc18), W(0x00071e6450da9ce3),
+     W(0x0005959108dacc6d), W(0x0005854c9f58054a)}
+  },
+  {
+    {W(0x00076ad49dd4b6d9), W(0x0007b3c20580ee15), W(0x0001c0cc9b92b446),
+     W(0x00003acfba0e3c49), W(0x00062a8a839f4566)},
+    {W(0x00048b613555bf3b), W(0x0001182aa75d12e8), W(0x00018044a657f4ef),
+     W(0x0001e14e88e58f4b), W(0x0003d45d6c61b8a0)},
+    {W(0x0000000000000001)},
+    {W(0x000008b31465ba1b), W(0x00002af6b660fe67), W(0x000795f0095038a9),
+     W(0x0002d524f77c957b), W(0x000145a41a23df0d)}
+  },
+  {
+    {W(0x0005144ba1ee3347), W(0x000338d704ba14ab), W(0x000790cd10cc448a),
+     W(0x0004d146bf59d4bf), W(0x0005ff031a9e8f4a)},
+    {W(0x00027f6f65c163f9), W(0x0006aedfe81ae652), W(0x00009bae0494b6b8),
+     W(0x0005582075728af7), W(0x00067c7ce2874df5)},
+    {W(0x0000000000000001)},
+    {W(0x0003cb55b5673259), W(0x000019b53291712b), W(0x00024dc0e3139b3c),
+     W(0x000338f72b3aae0a), W(0x00075ecf07c0c77d)}
+  },
+  {
+    {W(0x00030dccb2500e7e), W(0x0007bda84b6e34cd), W(0x0006884bf3c2b2be),
+     W(0x0001f988f46d271f), W(0x0004e1c036204e12)},
+    {W(0x000561736f1bb1c8), W(0x0003e4af4fa1a4e7), W(0x000093da4cbc39cd),
+     W(0x00053151564827ec), W(0x0006a5908d961f00)},
+    {W(0x0000000000000001)},
+    {W(0x00068512b3bc9322), W(0x0000c7707ae616b2), W(0x000065f13e8ce8b4),
+     W(0x0003bc8eb8780eb0), W(0x0004357ac2eb50fe)}
+  },
+  {
+    {W(0x0002db65174136b3), W(0x000781add46ba081), W(0x0000a50b0787eacd),
+     W(0x000238301afa0ea1), W(0x0002ec3414992964)},
+    {W(0x00033c31999aba40), W(0x0007ba81c7c73674), W(0x00060583c9cb93f0),
+     W(0x00051662ae1e2a53), W(0x0002ecb17530e69e)},
+    {W(0x0000000000000001)},
+    {W(0x0007799847a8a270), W(0x00015720dc40f8dd), W(0x0005e1d36cc21d76),
+     W(0x00011f994a867b01), W(0x00070c567bd1568a)}
+  },
+  {
+    {W(0x0002520ab77d56f3), W(0x0000aa1c5c41aa31), W(0x0000a4e157873e5b),
+     W(0x000226534ec05356), W(0x0001216d39000ebe)},
+    {W(0x0000f4fa151fd1d4), W(0x000334c93c7047cf), W(0x0000c93b40ed2f43),
+     W(0x0001deb821d55c89), W(0x000374132be82d97)},
+    {W(0x0000000000000001)},
+    {W(0x000625c4973427fa), W(0x00077e8270d2b056), W(0x00063d7c03dfb1a9),
+     W(0x000692b60e7ac998), W(0x0001ce35e30d78b5)}
+  },
+  {
+    {W(0x0007f0362dedb022), W(0x0004f58fd7218c8c), W(0x0004160a0bb8284a),
+     W(0x0003f301cb4c06e8), W(0x0003cbe5d79f358c)},
+    {W(0x0006dd1a92e82034), W(0x0000c1d093c5ed2d), W(0x0002f9b316b3b557),
+     W(0x0001731c87ed1911), W(0x0002aaa635d3e22c)},
+    {W(0x0000000000000001)},
+    {W(0x0003c085e0b9d040), W(0x000706958b0f90a6), W(0x0006cc9b195f148a),
+     W(0x0004576b3a357fd3), W(0x0006f33204b9f2ba)}
+  },
+  {
+    {W(0x00008e2ff8552d6f), W(0x000644dbbd47631e), W(0x00079ae397fbd745),
+     W(0x00079d24a3240869), W(0x0007fe8906b455e9)},
+    {W(0x0000b97b336976d3), W(0x0003ad6534ddce08), W(0x000128fb06357743),
+     W(0x0002818101d89bf5), W(0x0001300ff9d28f13)},
+    {W(0x0000000000000001)},
+    {W(0x0001824581edecde), W(0x00007c07f152c58f), W(0x000566be162abb24),
+     W(0x0007da48c4660f60), W(0x0001d90390cbd518)}
+  },
+  {
+    {W(0x0000c65452fb3635), W(0x0001da3c15521aac), W(0x000619e0b2aa464a),
+     W(0x0007258430a1169f), W(0x00025f05eb63d8f5)},
+    {W(0x0005b8970c67d00a), W(0x0007d990eb57f0f0), W(0x0003e17f10497494),
+     W(0x00048c8151b98414), W(0x00050a04b8059568)},
+    {W(0x0000000000000001)},
+    {W(0x0006e0943efc2356), W(0x0001858b5371a723), W(0x00068eadd15d6c93),
+     W(0x00014f7c926283e2), W(0x0005bb43a8233690)}
+  },
+  {
+    {W(0x000107df25c73894), W(0x0004c9a0ca765019), W(0x0006dc8af7f650d6),
+     W(0x0007fd4bac3bcb94), W(0x0003b46ea4c62e97)},
+    {W(0x0005eef3561241cd), W(0x0005dbff90467ff1), W(0x00011d85a677a4dc),
+     W(0x0007d5d540033408), W(0x00003d44394309e4)},
+    {W(0x0000000000000001)},
+    {W(0x0002e51c171edad5), W(0x0001181c95d6b1bc), W(0x00013cd3422a7fd8),
+     W(0x0001174afe19d5e4), W(0x0005bb0a26f6daa8)}
+  },
+  {
+    {W(0x000201eae4cab6ee), W(0x0004e9fc4e4801e2), W(0x0002bcfadee9e086),
+     W(0x0006a091c38036cd), W(0x000372250b26d48b)},
+    {W(0x0003f068e7ecf595), W(0x0006a6bf71a1959d), W(0x00070bc1227e4737),
+     W(0x0003ebc09fb5c78e), W(0x000527027885baf3)},
+    {W(0x0000000000000001)},
+    {W(0x00057a777818dd64), W(0x0006b853b22a5848), W(0x00028a0232e126ad),
+     W(0x0004b841b34e47d4), W(0x0006762803125307)}
+  },
+  {
+    {W(0x0003828ad212db7a), W(0x0003897f35e3c360), W(0x0004aa5391f2bafa),
+     W(0x0001fef3c3315991), W(0x0006c112bbd99aa2)},
+    {W(0x0000cc9dacd5a68d), W(0x0003a969b86feead), W(0x000795816846edb3),
+     W(0x0002da6d4593bede), W(0x0003f92a42703f69)},
+    {W(0x0000000000000001)},
+    {W(0x0007628374261a14), W(0x00015ce9e60fd5f5), W(0x0006dc9f184c8c30),
+     W(0x00041637c168fbb2), W(0x0000d7ff9740842c)}
+  },
+  {
+    {W(0x00050b786a54fb7d), W(0x00076b0a8fefb299), W(0x0003ce632e20bd2e),
+     W(0x000791cefb1b6cf0), W(0x00017bf94a4f6544)},
+    {W(0x0004c590125697c2), W(0x0006ddb2b9c4d186), W(0x000760485bad0140),
+     W(0x00002aceb6e0ff06), W(0x0007445b60461f6e)},
+    {W(0x0000000000000001)},
+    {W(0x0002c421f766d741), W(0x0002523a2ccadcb7), W(0x0004395de699a1b6),
+     W(0x0004967b95e622f6), W(0x0007fc223a96d67d)}
+  },
+  {
+    {W(0x000775fd47042765), W(0x000086c0ea9e79a9), W(0x000580fac68a1be0),
+     W(0x00064be14a4abc79), W(0x0007933689ad5d56)},
+    {W(0x000290dd3735b235), W(0x0001a1e444078e1d), W(0x0004a5b637f0d7c6),
+     W(0x0002185da2ca7dfa), W(0x00043ff2b76bc244)},
+    {W(0x0000000000000001)},
+    {W(0x00075cd60ba7ed46), W(0x0001e0a5c4ca11eb), W(0x0005370240c4f93f),
+     W(0x0002485626b309e8), W(0x0002ff102cf53795)}
+  },
+  {
+    {W(0x000243764d739706), W(0x000457b4364176bf), W(0x000386c52ee32920),
+     W(0x00074fcf8bb742e8), W(0x0006751cd6d857c9)},
+    {W(0x000355dc59e6b356), W(0x00068dc2b0281fa3), W(0x00055c53cdc7e57e),
+     W(0x00079621eeda3e77), W(0x0005397f05089259)},
+    {W(0x0000000000000001)},
+    {W(0x00041ca1c6e9801d), W(0x0001b2b07fc46e83), W(0x00066ed3fb378655),
+     W(0x000384b38dd14ba4), W(0x0001c35b3ed9a258)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002bf8417b5d622), W(0x00029be942847982), W(0x0002adbab286f0c4),
+     W(0x000313d9a988abfd), W(0x0001e34443347f9e)},
+    {W(0x0000350bb4a6fc79), W(0x000538908449b924), W(0x00019aea5227b082),
+     W(0x0007653fc3dca42b), W(0x000295955a5ed061)},
+    {W(0x0000000000000001)},
+    {W(0x0003f84afb54a1d4), W(0x0002d1e74e7a0200), W(0x00039b1d51f8e872),
+     W(0x00071e1d0ce4b5e6), W(0x0002933f59bd53e2)}
+  },
+  {
+    {W(0x0000abd5f1f5e156), W(0x0002d9fe7135c575), W(0x000462f0c52fca7d),
+     W(0x000430da5f2d8354), W(0x0004cab819c06b2f)},
+    {W(0x000338160176681f), W(0x0001ccf252eee1e5), W(0x000433a3962daa19),
+     W(0x0007f319da9c9b7b), W(0x0001f10fb18bd5ec)},
+    {W(0x0000000000000001)},
+    {W(0x0003341bf6e09f6e), W(0x0002aa35610dd1e4), W(0x0007e76432cd6476),
+     W(0x000277d8bff2169c), W(0x0000164ee02ae667)}
+  },
+  {
+    {W(0x00051cdc21d5601b), W(0x0001f91c7182bc98), W(0x0003755807008c66),
+     W(0x0004dd952e794277), W(0x0007fbd4f7bf2d73)},
+    {W(0x0006cfa94aa0696e), W(0x000606fff61bdc98), W(0x0006cc80cc9079ac),
+     W(0x00000df0053c8b65), W(0x00066e0dd397f1c4)},
+    {W(0x0000000000000001)},
+    {W(0x0001e354f5ed03f8), W(0x0003ffc4c0360fc9), W(0x00063854eeecc66c),
+     W(0x00060978009f9015), W(0x000191994e3511c0)}
+  },
+  {
+    {W(0x000353ef630df083), W(0x0003d9f07f2d76ad), W(0x00078028b26c8813),
+     W(0x000351d2ce63ec52), W(0x0007c686b90cf6ff)},
+    {W(0x0001d51a7fd71533), W(0x00019e14a3188b04), W(0x00074463ebf6a1cf),
+     W(0x000251e92946c881), W(0x000000f1deab1d3a)},
+    {W(0x0000000000000001)},
+    {W(0x000308209d8d2b4e), W(0x0003ab2369a63e5e), W(0x0007caad3bad0f0e),
+     W(0x00035773a38743e3), W(0x000397ba38beb15c)}
+  },
+  {
+    {W(0x000292dc72b60244), W(0x00062e2788b6d4b2), W(0x0001cd72b938d341),
+     W(0x00007d109cea5dcb), W(0x0007ca24ff711cd6)},
+    {W(0x00062b56427e1418), W(0x000655126563ca45), W(0x0003912aab66c7e7),
+     W(0x0000d8390a118e09), W(0x0005a5ef6269a116)},
+    {W(0x0000000000000001)},
+    {W(0x0000e8bad89fbe0d), W(0x0000c8b0a6d9dd81), W(0x000162ccb212833a),
+     W(0x0005b510f892130f), W(0x0003b0fb9c0149cb)}
+  },
+  {
+    {W(0x0007fde5908348cc), W(0x000330517f355087), W(0x00048c713da0d091),
+     W(0x0007c63ff0b8e66c), W(0x00077a0b600eef1a)},
+    {W(0x00009d37f7611af5), W(0x0000296ded3e5e80), W(0x000009fd35146614),
+     W(0x00008fb62382b53e), W(0x000722750e8d4208)},
+    {W(0x0000000000000001)},
+    {W(0x0007a9bb97898137), W(0x0001a0dbae0ce640), W(0x00000554d7d60fb5),
+     W(0x000590b27139b47c), W(0x000610e89a422968)}
+  },
+  {
+    {W(0x0001eca8227777fb), W(0x0006812b37cc156f), W(0x0002eedad29cf502),
+     W(0x000319966bfa722d), W(0x000072e29e297885)},
+    {W(0x0003b08198a36cd9), W(0x00026613f2d17d99), W(0x00077e5226bdf210),
+     W(0x0000abab27a78933), W(0x0001abc6445012e3)},
+    {W(0x0000000000000001)},
+    {W(0x0005aa5599c8a649), W(0x000363db51a1577c), W(0x0003a14bbc1e1104),
+     W(0x000754d95e8ef81c), W(0x00075bc5e9e1a137)}
+  },
+  {
+    {W(0x0005ddf4ade53a2c), W(0x00042b76a88b9ee5), W(0x00072916597e268c),
+     W(0x00026d384c90d226), W(0x0000aecf4e5a0c4c)},
+    {W(0x000008e965216807), W(0x000016b7494d4174), W(0x00052fd7146f42be),
+     W(0x0000b4b896b02839), W(0x00019304020c00e6)},
+    {W(0x0000000000000001)},
+    {W(0x00047341ba965f38), W(0x00072d3fadaf70de), W(0x000233efc6661137),
+     W(0x0005cf307823589c), W(0x00034d1ad609c671)}
+  },
+  {
+    {W(0x0001e498abe62fc0), W(0x000124494aaec208), W(0x0003cda855e7ce67),
+     W(0x0007d3b39a37486c), W(0x0007ffef4dcfce21)},
+    {W(0x0005afd14efcc57d), W(0x000392cf921a21bd), W(0x0002e8b6bcbc13ce),
+     W(0x0000fb0738826cb8), W(0x00065f1b922f7257)},
+    {W(0x0000000000000001)},
+    {W(0x00043f4eb93cf847), W(0x00014598cc6244ae), W(0x0006f9d680bc3426),
+     W(0x00006df384675a9c), W(0x00041e611cdf6e4d)}
+  },
+  {
+    {W(0x0003bceaac541748), W(0x0006d7896250df9a), W(0x0007ac68e98d64b1),
+     W(0x0003ca7f85d34e4a), W(0x0004407eb5124d84)},
+    {W(0x0006eb3bac523b4e), W(0x000435a6f80e340c), W(0x00003ec2481dbd4e),
+     W(0x0006288fe0290934), W(0x0003a7091f2b79f2)},
+    {W(0x0000000000000001)},
+    {W(0x00063e51d8ddca63), W(0x0006d537320e8f99), W(0x0007ab278ad7b0bc),
+     W(0x00054e8d655bb645), W(0x0002dd802e71d090)}
+  },
+  {
+    {W(0x000672a4a1815882), W(0x000365174b405800), W(0x0001eed9b3f8a923),
+     W(0x0005b409d0276d93), W(0x0003b0b114bf98e1)},
+    {W(0x000325cde2b8466f), W(0x00065a1626cc9f90), W(0x000502292ff5e4fc),
+     W(0x0000d262d4e63701), W(0x0006d5b84f1eaf5c)},
+    {W(0x0000000000000001)},
+    {W(0x0002011d76efe62f), W(0x00044ea150f5c876), W(0x0003fa8e00fd673c),
+     W(0x0007a077a048d96b), W(0x00064b0c7f3eaf04)}
+  },
+  {
+    {W(0x000532de07640df9), W(0x0007f8ed41a13024), W(0x0001a0eb4b00ac9e),
+     W(0x0000932f525a1e2c), W(0x000798d7853144e7)},
+    {W(0x0002f08bb008a6d6), W(0x0005608d21b19136), W(0x0001265fead6b9eb),
+     W(0x00065deb07369b2d), W(0x000098a5ac934772)},
+    {W(0x0000000000000001)},
+    {W(0x000676283c7ab4fd), W(0x00077e9e93256c32), W(0x0004bc32e9f0a4c5),
+     W(0x0005d0c55181f692), W(0x0007743685757948)}
+  },
+  {
+    {W(0x00008db6bc54f46a), W(0x0004e5f6bab52280), W(0x00048dec90e1d176),
+     W(0x0000180929982d4d), W(0x00002d2e21319fa4)},
+    {W(0x0004376a3dbbedbf), W(0x00023512fecfa281), W(0x00032635a9d86c82),
+     W(0x0002535aecacca45), W(0x0004228c6f6e74df)},
+    {W(0x0000000000000001)},
+    {W(0x00066c1d7c5f1f92), W(0x0004d7210675a1c8), W(0x000362de5521a426),
+     W(0x0004cbf79a37e151), W(0x0001275dc18fe120)}
+  },
+  {
+    {W(0x000284c1055af9bf), W(0x0001ac59e4af6227), W(0x0007ecdad22a520c),
+     W(0x00015f96b69e8d5f), W(0x0000abbac3693379)},
+    {W(0x00018d6dcc2abd4e), W(0x000228b25951adae), W(0x0002d0049a42917c),
+     W(0x00045b54b9a68f56), W(0x0007961981d9fb58)},
+    {W(0x0000000000000001)},
+    {W(0x00068780f6ba0c13), W(0x00052144e08b39cf), W(0x0003caf8182b8fa3),
+     W(0x00011e3545241194), W(0x000019e9011b850a)}
+  },
+  {
+    {W(0x000006c637d04eb0), W(0x0000f4f63ded7684), W(0x000347a1c8f9773a),
+     W(0x00058e7e6c3ef429), W(0x0004c5b2a35f7710)},
+    {W(0x00053b7c7dc0f906), W(0x00065799914653f4), W(0x0007bb9aee204728),
+     W(0x00054cd4c71ba2b8), W(0x00001da9b56e2b24)},
+    {W(0x0000000000000001)},
+    {W(0x0001f6416aebaf8d), W(0x0000e8319c4752a6), W(0x0004d67bec5d0cdd),
+     W(0x000222f225c9b7e3), W(0x00053bd7475e1df2)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00045ceb3b5775d0), W(0x00071709f92a0ac2), W(0x0002a7d6afd28c7a),
+     W(0x00064b6d414a0a90), W(0x00051f4ff8c599b1)},
+    {W(0x000406b0d7863ac1), W(0x000700fa97a36ff0), W(0x00014bbad2c4ba01),
+     W(0x0000f9fb7ccd771c), W(0x00035ac9588d46e4)},
+    {W(0x0000000000000001)},
+    {W(0x0003720708d6c911), W(0x0002b202ee9611fb), W(0x0000959bfc3200c5),
+     W(0x0001757dc4a338d9), W(0x0004da02f54da58f)}
+  },
+  {
+    {W(0x00029b6a71bf9741), W(0x0001dccd7f1e7d8e), W(0x000149a0be95a5b0),
+     W(0x00031fb1e040b0ec), W(0x000568de690133ca)},
+    {W(0x0005b123773039e8), W(0x0007e9ae87c7a37f), W(0x00003996d0e96eb9),
+     W(0x000323a0ee6e219d), W(0x0004c48220992e8e)},
+    {W(0x0000000000000001)},
+    {W(0x0007dbc4170a98ef), W(0x0000490c233d200d), W(0x000278c99ed09838),
+     W(0x0001fbc3bdd9dc86), W(0x0004090f6ebf75e7)}
+  },
+  {
+    {W(0x000206c8b59f5785), W(0x0004df5e07e8f3f6), W(0x0005f659be6ec6a7),
+     W(0x0003193a84b2d27c), W(0x0004f2f4b477f6ca)},
+    {W(0x0000269d9359e934), W(0x0004b847999e4a90), W(0x0004118b05ab8e14),
+     W(0x00021cd0b6990453), W(0x00013115f873b8a8)},
+    {W(0x0000000000000001)},
+    {W(0x0007361dbbb4a6a6), W(0x0005de82b4cb21fa), W(0x00002507ccd64a55),
+     W(0x00078a18d4b37b64), W(0x000602c6bf1bc222)}
+  },
+  {
+    {W(0x00030cc4663403da), W(0x00061f36a4978dce), W(0x00048df3d3a54a05),
+     W(0x00010ef7a35c4fee), W(0x0003342c4717d552)},
+    {W(0x0005c6a85b6937c5), W(0x0000cd0dcc3f9493), W(0x0001f7499c735fa9),
+     W(0x00029b46aa6678fd), W(0x00050676cdf00c93)},
+    {W(0x0000000000000001)},
+    {W(0x0002b47afd50b8bb), W(0x0006e87341ba7247), W(0x0000411974b578a0),
+     W(0x0007ee4de1829600), W(0x0002d3c40a10b4a4)}
+  },
+  {
+    {W(0x00030fb8f1eccccb), W(0x000283e91bedd33f), W(0x0002235667e8bf41),
+     W(0x0007685498387edd), W(0x000282a400973b64)},
+    {W(0x00062dd27aa84686), W(0x00023c1862a18fea), W(0x00031aff366b3a83),
+     W(0x000549acae4ff00d), W(0x0005a8a95d8ceddb)},
+    {W(0x0000000000000001)},
+    {W(0x0004bded88f6988a), W(0x00053b47817f7390), W(0x00043a187ebc4d1b),
+     W(0x000585f14a833db9), W(0x0007cfc2fe7c8d4e)}
+  },
+  {
+    {W(0x00029d9ed297dbd3), W(0x0001d030c6eca418), W(0x0007c356254aecce),
+     W(0x000106a1f2de6054), W(0x0007aaf48f59f15c)},
+    {W(0x0001896bf1a58d6e), W(0x00011d1c1269b58d), W(0x000798b78e2a3c2b),
+     W(0x0001c61b0a4e31df), W(0x0002765ba6a9e766)},
+    {W(0x0000000000000001)},
+    {W(0x000086d5b16ac088), W(0x0003194de2e85fba), W(0x000706e16ece3444),
+     W(0x000510dbf955a7d1), W(0x0003e86b7756eccd)}
+  },
+  {
+    {W(0x0005979baa2329b4), W(0x00019a93ef8737a9), W(0x00046e5644cdd17d),
+     W(0x0001aae72fc62ac4), W(0x0000336498fbd2b4)},
+    {W(0x00008a7c5dd5cbd8), W(0x00025ffe91b3543c), W(0x00026c427ebf83f5),
+     W(0x000673f2258e1bcb), W(0x000653338b616279)},
+    {W(0x0000000000000001)},
+    {W(0x000718dd49593f4b), W(0x0005e7c15c7bdd1e), W(0x000040921f0d3724),
+     W(0x00021c89d7c8cf85), W(0x0002dfe0c21696c0)}
+  },
+  {
+    {W(0x0003a45d29424d9a), W(0x00077229b1550ded), W(0x00048807bcdb7f49),
+     W(0x00019eac75c6e662), W(0x0003396978bfc50b)},
+    {W(0x0000ca4ac8073393), W(0x000794fbb7b5763a), W(0x00041f332d14fab1),
+     W(0x00013ee5ce9adfc8), W(0x0005ccf1359113c1)},
+    {W(0x0000000000000001)},
+    {W(0x000730edb0eb0649), W(0x000702e81737ef11), W(0x00024014668a61ec),
+     W(0x00025cd14e2b9c26), W(0x0005c6b84dc5ed5a)}
+  },
+  {
+    {W(0x00038e94f2057aed), W(0x0000de8ed1e4cade), W(0x0003e055af994f6c),
+     W(0x00014b97120bd66e), W(0x00049a2da214bb5b)},
+    {W(0x0000e3c69a05fd00), W(0x00065e9d78175bf7), W(0x000048d96e5edb23),
+     W(0x00040c14bcccda35), W(0x0002494275072981)},
+    {W(0x0000000000000001)},
+    {W(0x00021e96324a28e6), W(0x000343d4b50b4042), W(0x0003c3e5ab130610),
+     W(0x0001f1ace5411b05), W(0x00066fa41ae0aeb4)}
+  },
+  {
+    {W(0x00060887288f7072), W(0x00060b33c106a68b), W(0x00049ced2db4fb86),
+     W(0x0007486e8a8dcfc2), W(0x0006e20394362cc4)},
+    {W(0x00074d4cbd0e92d9), W(0x0004bf1d03b398ca), W(0x000644f764632f10),
+     W(0x0003421e464dc62d), W(0x00019a965cc82a0e)},
+    {W(0x0000000000000001)},
+    {W(0x00066c79d4d97e66), W(0x0006c22654efca52), W(0x0005adfa9ceb3b4f),
+     W(0x00051125d8fda199), W(0x0004efdebb3e4741)}
+  },
+  {
+    {W(0x0007906988e1d567), W(0x000026427d0ec1ef), W(0x00069e9303179e5e),
+     W(0x00037cebe01fec4c), W(0x0002943b47266d09)},
+    {W(0x0006304d505c196a), W(0x000080295c5b5891), W(0x00070c3fdf3b6255),
+     W(0x0000f0a00d490bbe), W(0x0000daa4ed1a9932)},
+    {W(0x0000000000000001)},
+    {W(0x0000987b708146b2), W(0x000176bf91d2f562), W(0x0004cd8e2ba142e6),
+     W(0x0004a437a4d8cb5c), W(0x00019f009df88712)}
+  },
+  {
+    {W(0x0001fe0af78db270), W(0x0000a5a8dbdb902e), W(0x0002510a60041b6b),
+     W(0x0007169a85069433), W(0x00026e6ed0619c6e)},
+    {W(0x000537d239fd1e06), W(0x000146c0b0abcf21), W(0x0006cbc7b5cae465),
+     W(0x00041af3e901cf9d), W(0x0007289630e8ad21)},
+    {W(0x0000000000000001)},
+    {W(0x0003b1c77541fce0), W(0x000339cca35293f8), W(0x00062b67abc41684),
+     W(0x0007c9dc1417b5f7), W(0x0001f63c5864876a)}
+  },
+  {
+    {W(0x00020b4bb9843c96), W(0x0005e363e421e5a0), W(0x00067deb64f8ddcc),
+     W(0x0006f68f64977b34), W(0x0002a8c21349f1fb)},
+    {W(0x0001c31d93900da0), W(0x0000e5df14bb5287), W(0x00006380f876c713),
+     W(0x00058e5aca919c80), W(0x0005b6170f9d9b3f)},
+    {W(0x0000000000000001)},
+    {W(0x0001d65d15707f2a), W(0x00071041189ec3f1), W(0x0002c3081addedcc),
+     W(0x00072bd7e38c0480), W(0x00015fc31df94d90)}
+  },
+  {
+    {W(0x0000d3de9891e920), W(0x00015c7e03b80012), W(0x000700bae1cb7541),
+     W(0x000062efc545a32e), W(0x00074a874e699c51)},
+    {W(0x00003868c3174129), W(0x000642a3eb668499), W(0x0004cb5c86e653d4),
+     W(0x0007bb37a411a273), W(0x0003b00ab9d86c87)},
+    {W(0x0000000000000001)},
+    {W(0x0000444f92788022), W(0x000041a180e2c74d), W(0x0000e55149209295),
+     W(0x0001d6059a8d30ab), W(0x0006beb4b36a611c)}
+  },
+  {
+    {W(0x0006c0b8a4b117b8), W(0x0001de5530693919), W(0x000088f99b744ba2),
+     W(0x0006a6edfab89c5e), W(0x0003f731df448e23)},
+    {W(0x000272fb43a6ff54), W(0x0001b9849c585db9), W(0x0002e0efc3bad91d),
+     W(0x0006d158b718d66c), W(0x00041cc9f53399d8)},
+    {W(0x0000000000000001)},
+    {W(0x00021e548c7121b8), W(0x0005dc1766d3d191), W(0x00001848416b2079),
+     W(0x00050a66db92e52c), W(0x0000e27ce05f5697)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000507abd741b845), W(0x0000765bf9d1c002), W(0x00054407d3700571),
+     W(0x000012127b2d084a), W(0x0003faa2a093a19a)},
+    {W(0x0001ddbfc6eb8edc), W(0x0004f9dcc8fcef62), W(0x00052f722ba316db),
+     W(0x0001c4e5331d8aab), W(0x0007a1de10dacfda)},
+    {W(0x0000000000000001)},
+    {W(0x0003852490fab02b), W(0x0003f5b0a57a4226), W(0x00019619f786af13),
+     W(0x00003b28fc155873), W(0x0004d1680b62ef7a)}
+  },
+  {
+    {W(0x00032717aee8e3c5), W(0x00004528ee2c0c9c), W(0x0003224c4176483c),
+     W(0x00064b54dd76d087), W(0x00030f9cd3076c51)},
+    {W(0x0007a7bc8cbdb095), W(0x0003f7e749dfafc9), W(0x00067d68ae01e411),
+     W(0x000063388c90b427), W(0x0002caedfaa42012)},
+    {W(0x0000000000000001)},
+    {W(0x000691e50093da2b), W(0x00071697c5b44887), W(0x00013055968a3b54),
+     W(0x0001e33db8796a2f), W(0x00053930e795761c)}
+  },
+  {
+    {W(0x0006496b1083bc71), W(0x0004b95cc8713bf0), W(0x0002e7d3cf78f242),
+     W(0x0005712c800cdeb3), W(0x0000044cf64898ed)},
+    {W(0x0006b1529fc7e51d), W(0x0002ce1eef2db40c), W(0x00030078a3caffad),
+     W(0x0007bfa58e97584f), W(0x00063d5742d68935)},
+    {W(0x0000000000000001)},
+    {W(0x000340e0c2ad890c), W(0x0005d954b1ced487), W(0x0003bbd9bde3e1d8),
+     W(0x000498b4294b0f4f), W(0x0006a31c2333abb1)}
+  },
+  {
+    {W(0x000093714b7e6e90), W(0x0002e48e3d7dae58), W(0x000564fb2ffa709a),
+     W(0x00045f3eba87d40c), W(0x0006070951e96e61)},
+    {W(0x00065f4c1d3e6689), W(0x0003289ac860981f), W(0x0001c7708b1eb6d4),
+     W(0x0007939c20ef3214), W(0x0007bb8b8086b2c8)},
+    {W(0x0000000000000001)},
+    {W(0x00013daea24b2df1), W(0x0006a0b2a8275871), W(0x0001a3ce21ab41ce),
+     W(0x00035cca7c240678), W(0x000285f6bd7a8c08)}
+  },
+  {
+    {W(0x00019f7c2b60d152), W(0x0002341b96d1ff32), W(0x000641c76ed33938),
+     W(0x00037d9e514e9638), W(0x0001c59139bc853c)},
+    {W(0x00031f01ded37e33), W(0x00075ce2aeb502c0), W(0x000543f4d0d98571),
+     W(0x000377b01fa518ee), W(0x000278d3ab8504cc)},
+    {W(0x0000000000000001)},
+    {W(0x0006e325b7864126), W(0x0001298cf435c9a8), W(0x0000b8ff9e42867d),
+     W(0x00030ebe7fb3c205), W(0x00046b54cf10323e)}
+  },
+  {
+    {W(0x00026628aad1112f), W(0x0007bbcc5bcc003d), W(0x00043dabb4ec360c),
+     W(0x00060a5cfae35a2e), W(0x0000e8e013676831)},
+    {W(0x0001568e739f6ac7), W(0x0001d285d9205e3b), W(0x00071cbd17e84061),
+     W(0x000235232d33dd3e), W(0x00043a150e8a8456)},
+    {W(0x0000000000000001)},
+    {W(0x0006e5e6cdb06cb8), W(0x0007aaed4c18b1ff), W(0x0005d198c39247ff),
+     W(0x00067f071463aa23), W(0x0004aa260da35afe)}
+  },
+  {
+    {W(0x0001aa4c2565b695), W(0x000667bfb03e7e62), W(0x0003204a978b753a),
+     W(0x00063b12a01758cd), W(0x000256553a8f6110)},
+    {W(0x000797a0ca1e74d6), W(0x00028b35cc9a36ad), W(0x0002c0f561cc298a),
+     W(0x000220b39a3072b4), W(0x00035eb4e4eb9bbf)},
+    {W(0x0000000000000001)},
+    {W(0x00051ac9adf0f322), W(0x0005cc0e29554f36), W(0x0001df080e1054a7),
+     W(0x0002dd7ad2f5fe0f), W(0x0000fbf2de10d554)}
+  },
+  {
+    {W(0x0001afd99d27703d), W(0x000743cbbc75e4f6), W(0x00030fa1818550c0),
+     W(0x0006c0fabf5e1d13), W(0x0001ec0eb040164d)},
+    {W(0x0004c3a1d1a42cda), W(0x0001d703e0e64dcb), W(0x000268cca6667864),
+     W(0x000634a13476bd57), W(0x0003df62c38b3077)},
+    {W(0x0000000000000001)},
+    {W(0x00014ae71e7bf6a4), W(0x000450b8fae6d291), W(0x0006faf7377b0ab0),
+     W(0x00039a176f945be2), W(0x0007d7d69fb22eed)}
+  },
+  {
+    {W(0x0001cce450fe9332), W(0x0007e23d8d30582c), W(0x0005a601134d3170),
+     W(0x0003985f98ef9482), W(0x000695ccccffc914)},
+    {W(0x00014c92c90aafbf), W(0x0003bb477cc96285), W(0x00024c0f2701c38d),
+     W(0x000398c4907d149d), W(0x0003b6a0ef6edef6)},
+    {W(0x0000000000000001)},
+    {W(0x000449aadb0337c4), W(0x0001c96a9e1f97c7), W(0x000503f58bab8e0e),
+     W(0x0007ad86e2069095), W(0x000012d4cff1b4d9)}
+  },
+  {
+    {W(0x0004522d71830c05), W(0x0005c17a3ec28b2b), W(0x0005a580a9d568e4),
+     W(0x0001cc050d1acbdf), W(0x000324e656a17f97)},
+    {W(0x000516b0d1aee260), W(0x00075b53663d2a05), W(0x0001c09c08e5f85d),
+     W(0x0007508d9d73599c), W(0x0001a3c0d04aba46)},
+    {W(0x0000000000000001)},
+    {W(0x0003a2c3e348c5f9), W(0x000705bb64ca6f95), W(0x00063c05f6fca71f),
+     W(0x00061b702747983c), W(0x00029eadc29bc129)}
+  },
+  {
+    {W(0x0003caf63c4afaa5), W(0x00033b9a6d7fd51b), W(0x00061abd8f5dd400),
+     W(0x0005564631b846f8), W(0x00013eb27bd4358b)},
+    {W(0x0002a2148340903c), W(0x0006878262cd61b0), W(0x00078e8b87860d94),
+     W(0x00017fabb6a7f135), W(0x0006cd2c9612b0e9)},
+    {W(0x0000000000000001)},
+    {W(0x00040f575b585bc8), W(0x00054f937179ce05), W(0x00067e5116170d4a),
+     W(0x00011ff37b4e993e), W(0x00075f430921fe3d)}
+  },
+  {
+    {W(0x0000657988b5aa64), W(0x0007a6ec5ad29187), W(0x0007a3ffaceb3591),
+     W(0x000684a8356384c0), W(0x0000a939a0d03280)},
+    {W(0x00000fb4c5f1a342), W(0x000717a622b1b91b), W(0x0003ee2823362c1f),
+     W(0x0007c329477f038c), W(0x00008995249ecbee)},
+    {W(0x0000000000000001)},
+    {W(0x000425a7899cf887), W(0x00007669a732d283), W(0x0006af341fb75311),
+     W(0x0003fcdb0c4590c5), W(0x000656d4099882a4)}
+  },
+  {
+    {W(0x00021e3879a57604), W(0x0007690c41bc17cd), W(0x0002885251c7d9a2),
+     W(0x0000fa3397e0590f), W(0x00033ab541b3a27e)},
+    {W(0x0006bd79fe25ee98), W(0x0001580536b4082e), W(0x000455d2e229238f),
+     W(0x0005b3f5c4f8ac5c), W(0x00055c60069fdb22)},
+    {W(0x0000000000000001)},
+    {W(0x00065bcafe74574e), W(0x0004a4f415a4c425), W(0x0004a30e79ff9ab2),
+     W(0x0002e83198200eb3), W(0x0006e22c6f58b1e2)}
+  },
+  {
+    {W(0x00063eca4cc7a4b3), W(0x0003c4537e2ae58d), W(0x0007b4bb003b580b),
+     W(0x00077e28725d2cfa), W(0x0006b13d60b13a1d)},
+    {W(0x000627f6aff825fa), W(0x0005e833fa0ad267), W(0x00070225d0a7258a),
+     W(0x0001d6c82cfea248), W(0x000679a7b01ef671)},
+    {W(0x0000000000000001)},
+    {W(0x0004f0a081ebc596), W(0x00067808333d9803), W(0x0006d9a59c10a260),
+     W(0x0003ff6f07388f96), W(0x0004ec932959b139)}
+  },
+  {
+    {W(0x00060cf91c95300a), W(0x0005389007816da0), W(0x00062014b8fb3261),
+     W(0x00036c156829de39), W(0x000414311bad932f)},
+    {W(0x0005173937cf6953), W(0x000621cd43b5212f), W(0x0002466b5869ecb1),
+     W(0x00000dc2028aad32), W(0x000356eb169e50f1)},
+    {W(0x0000000000000001)},
+    {W(0x00019832e14f1593), W(0x000304dd916b7477), W(0x00078f66bd65fa99),
+     W(0x0001106ceac4ec60), W(0x00014ff0841473e9)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000748aa01d5a90f), W(0x00079743464cc509), W(0x00026c605e0047a9),
+     W(0x000609348312c42b), W(0x0001924416956ea2)},
+    {W(0x0001fb8adaf021de), W(0x0003304d5919b716), W(0x0003ae233f1f6dcc),
+     W(0x0006e9037db7f74b), W(0x0000c8e28127b7dc)},
+    {W(0x0000000000000001)},
+    {W(0x00007c2c14e41f85), W(0x000243784111782a), W(0x00040193b41abdb3),
+     W(0x0005f56376f7186d), W(0x000543fd67342ded)}
+  },
+  {
+    {W(0x0002ff28ce974493), W(0x0006937edeb88807), W(0x00036263ee101daf),
+     W(0x0006a4f62b81c676), W(0x0002898ffaab663e)},
+    {W(0x0003bc46f335163d), W(0x00069f49f6d8de96), W(0x00064d155f984e83),
+     W(0x00023bf3aceb5e5c), W(0x000094f3b96ab6c9)},
+    {W(0x0000000000000001)},
+    {W(0x00046e0b1dbc48d2), W(0x00018ad36309efa0), W(0x0004214c0c701979),
+     W(0x0003e838aa567cea), W(0x0003537a8c91eeeb)}
+  },
+  {
+    {W(0x0006d2e98c19a76a), W(0x0007097054a99d7f), W(0x00049d1cf2973b62),
+     W(0x0003d7b6d0bb4e8d), W(0x00059de4b2305d8b)},
+    {W(0x0007e2f9f1dbe4d5), W(0x0004b382e4dd288e), W(0x0007b29b90c5af84),
+     W(0x0004c227f0d32316), W(0x0004078b0875ce14)},
+    {W(0x0000000000000001)},
+    {W(0x0003ff69c641eebf), W(0x000549ae14a1f12f), W(0x0003f8f145c40bc2),
+     W(0x0001881cf88a2479), W(0x00056531dfed4c46)}
+  },
+  {
+    {W(0x00014f12016bf75a), W(0x000648f2908e182a), W(0x00005f335dc5b006),
+     W(0x0000882eaeac87b3), W(0x00034e2ddf511570)},
+    {W(0x0003ac585c1fd926), W(0x000741f0b87a4071), W(0x0003361a39b5ff0c),
+     W(0x00038bbbaac7ba29), W(0x0001bdaea88b78eb)},
+    {W(0x0000000000000001)},
+    {W(0x0003fa9cb6a6dfe4), W(0x0003cf1f30103d3d), W(0x0006df170acf388b),
+     W(0x00029d0691074edd), W(0x0001bfbbb0b5ccc2)}
+  },
+  {
+    {W(0x0001b303eaac5b05), W(0x0004d791447cb32f), W(0x00058b15e1815afe),
+     W(0x0004a7e15c91a795), W(0x00055eaf5fea101c)},
+    {W(0x000632fc1e0e6d82), W(0x000565caf3ff6523), W(0x000213481073d8a9),
+     W(0x00063f189534493a), W(0x000644f4f10c2a13)},
+    {W(0x0000000000000001)},
+    {W(0x000365fd747a90e7), W(0x0000a09245f7cbe5), W(0x00073e92b6f00499),
+     W(0x00007ca44025bb30), W(0x00017be9e863ebba)}
+  },
+  {
+    {W(0x00012093400eeab6), W(0x0000eb508c2d46af), W(0x0001a7b5bddfe5b4),
+     W(0x0005f8663b12868e), W(0x0005726e2adc5bbd)},
+    {W(0x00057d966b0ee8cf), W(0x00021b35279a24fd), W(0x0003be197a1262a5),
+     W(0x000782c4877c786b), W(0x00079735f155fd92)},
+    {W(0x0000000000000001)},
+    {W(0x00030f24bbba4be5), W(0x00022dc1aeffa9ef), W(0x0001e72e1c8150dc),
+     W(0x000262061299dbaa), W(0x000519995d0c8177)}
+  },
+  {
+    {W(0x0007c6b674fd1963), W(0x0003d72f92ba5324), W(0x0002606b6ff7387d),
+     W(0x0007d0a2401f886f), W(0x0002fab7584f9eba)},
+    {W(0x0001da2698c7f981), W(0x000531652ca579eb), W(0x0002c8dd914863b9),
+     W(0x0002246d7a27ad58), W(0x00027b70248f415f)},
+    {W(0x0000000000000001)},
+    {W(0x00073c1ff6c5290e), W(0x0005aef91950bc60), W(0x000754f622235617),
+     W(0x000773127b360383), W(0x00077c85c2671ce5)}
+  },
+  {
+    {W(0x00069fedfe165cc8), W(0x000154f3e97ecac4), W(0x0003761e3297fa14),
+     W(0x00012aac61a7674c), W(0x0004cb56bd83d7bb)},
+    {W(0x0004a7fa15a03865), W(0x00061370d89d71f6), W(0x00066a2ba9357a94),
+     W(0x00048a29adec0d4f), W(0x0005d1f6fb463251)},
+    {W(0x0000000000000001)},
+    {W(0x00079e2ed8660ad9), W(0x0005b69da44e189b), W(0x00042f2d70bc34fe),
+     W(0x000269bc6168b537), W(0x0002f554ee36c10a)}
+  },
+  {
+    {W(0x0000b7e3c3f874f0), W(0x00064f13420caf18), W(0x0007c5374cf12f7e),
+     W(0x000571b65b0fbf7e), W(0x0006b6c499022b09)},
+    {W(0x00025216be14b317), W(0x000277a4eab3dc52), W(0x0007fd5bc080c95d),
+     W(0x0000c9a1533cf6ea), W(0x0007e56e0e2478ef)},
+    {W(0x0000000000000001)},
+    {W(0x0006a5b6254c6fc4), W(0x00052f6b66adb545), W(0x00046cf23255db13),
+     W(0x0007f16a1977d045), W(0x00006d2728418682)}
+  },
+  {
+    {W(0x00002693d52351fa), W(0x0005e501908ceee5), W(0x00052df09e36cecb),
+     W(0x000025df28653186), W(0x00046c990b3a43ef)},
+    {W(0x000518e77f22df12), W(0x000580a219511d72), W(0x0004427604c79283),
+     W(0x0002c89acaa6bec8), W(0x0005766937669b0f)},
+    {W(0x0000000000000001)},
+    {W(0x00055edae7631acc), W(0x0001669a9c525f4b), W(0x0007251c3e77bd6c),
+     W(0x00052f60508a0981), W(0x000470eb73cd316d)}
+  },
+  {
+    {W(0x00028b03768d988e), W(0x0000efdecb03496d), W(0x0002e0fb4ea3fd68),
+     W(0x000313602dfc0719), W(0x0004f6ad78324475)},
+    {W(0x000520cb6e396619), W(0x000305d00ca362a3), W(0x0004681dd865a782),
+     W(0x0005ff49eeea1404), W(0x00053fb69effed63)},
+    {W(0x0000000000000001)},
+    {W(0x00051875e2e593e3), W(0x0005a1130de63400), W(0x00027b45e6608778),
+     W(0x000022201deeeb11), W(0x0004030b2e079883)}
+  },
+  {
+    {W(0x0006e774c7d5ac25), W(0x000245dfd986dead), W(0x00070a6ba7c8d3c2),
+     W(0x00018af99d2c72fa), W(0x00003699a2da043b)},
+    {W(0x00029c0e76ca92a0), W(0x000023855dd60751), W(0x00060f4f075183d9),
+     W(0x0005895938b6de12), W(0x00021ceadbaed7f3)},
+    {W(0x0000000000000001)},
+    {W(0x00058bd6ab265df7), W(0x00000d9cdc32c4d6), W(0x0005240f68bc6ff1),
+     W(0x0004b00d0aeef8d4), W(0x00008da9e07c3d7a)}
+  },
+  {
+    {W(0x0004c18e6571ec9a), W(0x00050ebda09c5215), W(0x00008f010133a86c),
+     W(0x000005b919291443), W(0x0000cb918da4f18e)},
+    {W(0x00041467e47dee7d), W(0x00032b692a2911b6), W(0x0003be03ec255896),
+     W(0x0003bb4a2c35abec), W(0x0001faffb83550de)},
+    {W(0x0000000000000001)},
+    {W(0x000242b98843918c), W(0x0004bba2979a430f), W(0x0003c30681ac5901),
+     W(0x00068634bf4a2775), W(0x00031ebd027a91e2)}
+  },
+  {
+    {W(0x0001d0bedc3f5990), W(0x0003ff86fd10aa43), W(0x00048ed90bf67f99),
+     W(0x000566270521a2f1), W(0x000411c3b913a888)},
+    {W(0x0007adcd80b819e3), W(0x0007880e102a06e9), W(0x00003795a4b18a3d),
+     W(0x0001d720b25c0f6c), W(0x000583e1c2ba7aac)},
+    {W(0x0000000000000001)},
+    {W(0x0004dfc94ab40909), W(0x00027e42fa2e0c2b), W(0x0002c78971a207d9),
+     W(0x00019f18599e05e2), W(0x000375767817d4d6)}
+  },
+  {
+    {W(0x0002e72c6804c731), W(0x0005eb9d934ad2f6), W(0x0006f43530efa9ac),
+     W(0x0001f1c76aee427c), W(0x000667395e286848)},
+    {W(0x00027e945d0955f2), W(0x0007acdccdb85259), W(0x000115521bfa7a6f),
+     W(0x0002fb1ec730703e), W(0x00051bc27b58e06f)},
+    {W(0x0000000000000001)},
+    {W(0x0003e4f0fbe9cf0a), W(0x0006a5159498f5fd), W(0x000144085110a1ac),
+     W(0x00019ea921271b20), W(0x0007f0ebd78d3fcc)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00028b7d1ebc8fac), W(0x000625ced5f1a16b), W(0x0000f8bd4dbcef8d),
+     W(0x0006278a1aea4ac8), W(0x00049761c57ce3c8)},
+    {W(0x0005576b61e150a8), W(0x00072dc181689d66), W(0x0001be3fc9d20097),
+     W(0x0004a77996bf9f3d), W(0x0003225035e10650)},
+    {W(0x0000000000000001)},
+    {W(0x00071bfdd5e7cda1), W(0x000108e0ae658fa4), W(0x00063bdcbc085d15),
+     W(0x00063787a1168ece), W(0x000671abcc018b00)}
+  },
+  {
+    {W(0x0005e5640fdc60a9), W(0x0001c5ef29f1bc43), W(0x00050ddc14000890),
+     W(0x00025fdbe3b51e92), W(0x000654b39f465080)},
+    {W(0x0003b76a6b121996), W(0x0005169b7368bb9c), W(0x0001951052a372ba),
+     W(0x00010c424d1a6731), W(0x00050ce7be2f1011)},
+    {W(0x0000000000000001)},
+    {W(0x0005d8f8a95bd02a), W(0x00016848e792073a), W(0x0001af7913903e6c),
+     W(0x0007b9de41fe259c), W(0x0002f521be693977)}
+  },
+  {
+    {W(0x0001471b53302141), W(0x0007aaf05b0316e0), W(0x00016fd8cbc1828e),
+     W(0x00007eacc8c41878), W(0x00034219355b9a29)},
+    {W(0x0006f96aeb9e6797), W(0x0005852d7d0e7acd), W(0x00047266a002098f),
+     W(0x000348294864180e), W(0x000514bff4e806ab)},
+    {W(0x0000000000000001)},
+    {W(0x0003ffd0eb3d345e), W(0x0002a4fc92fa7846), W(0x0006dfeb63b3a73b),
+     W(0x000650ab34bcf025), W(0x0007af605f53ccdf)}
+  },
+  {
+    {W(0x00065c6e8c637d0f), W(0x000605df4cbbe61b), W(0x000096f55014968e),
+     W(0x0005ecc5efd7035d), W(0x000091605b338ea1)},
+    {W(0x0000ad2864bf8cc7), W(0x0002b7592deb54bf), W(0x0004bd9af75b55ff),
+     W(0x0001195d7b2a551e), W(0x0001df405521e9a2)},
+    {W(0x0000000000000001)},
+    {W(0x0002259b92fefac6), W(0x00043903fa2d8d30), W(0x0003d52cf8d7d6f8),
+     W(0x000394c48057bac1), W(0x0000e8ade3b74c8f)}
+  },
+  {
+    {W(0x0003f174cfe85241), W(0x0002eb02a68fda52), W(0x0004dca9e201f76d),
+     W(0x000050ad80aefc99), W(0x00010fbdc33aff0a)},
+    {W(0x00031869f08e725e), W(0x000364e523eeedc6), W(0x0005a4612f93f87e),
+     W(0x00073172b2629c5c), W(0x00003b79914cec43)},
+    {W(0x0000000000000001)},
+    {W(0x0005ec714da2e7b3), W(0x0003b1b921db6e7d), W(0x00006b04425d7648),
+     W(0x0000c65c3a4e25f3), W(0x0003d46d7a15957d)}
+  },
+  {
+    {W(0x00065d2274ccc819), W(0x0007292ad2dae988), W(0x0004f5c1ef53bb2b),
+     W(0x000277f837bfca64), W(0x0006f2f3269991f1)},
+    {W(0x0006c4aa4ce61a13), W(0x0000ff7cebca65b6), W(0x00004f5fbdd7e3de),
+     W(0x0000226bd3d79a84), W(0x000797cb6daa4eb6)},
+    {W(0x0000000000000001)},
+    {W(0x00055fa1456c785c), W(0x000221a07172d8cc), W(0x0004987e08cc54ba),
+     W(0x00009de9addd0870), W(0x00036d1ea0ab8b75)}
+  },
+  {
+    {W(0x000029498e895b32), W(0x0004ff6a6c3b8a1a), W(0x0004b3675a1f93f0),
+     W(0x0005435fc3f34478), W(0x000495fc2c075bd1)},
+    {W(0x0005a38bab5b91ad), W(0x0000a1404b1b2a76), W(0x000144795b4afbde),
+     W(0x0006dc2a6b26d851), W(0x00048d8f25d9c570)},
+    {W(0x0000000000000001)},
+    {W(0x0007e449c4719c69), W(0x0007669e06f26661), W(0x0003896436e6cc97),
+     W(0x0004016f17b1da95), W(0x0001d05cb595755e)}
+  },
+  {
+    {W(0x0007e4feebbb1faa), W(0x00069116e5963f90), W(0x0007c91893d6e71b),
+     W(0x0004b849c547cfd2), W(0x0004606fdec56d46)},
+    {W(0x0004ce344ecf664e), W(0x0002abdaca14db21), W(0x00026fbbe963a6be),
+     W(0x000121f01a87d2dc), W(0x0000f00d9e6656d8)},
+    {W(0x0000000000000001)},
+    {W(0x0001ddfba4b68643), W(0x00069ee52ea34339), W(0x000278129f9fda1f),
+     W(0x00004e4935d34d21), W(0x0002ee62d9a720e9)}
+  },
+  {
+    {W(0x000044f57ad4caf0), W(0x00050f8ca4fc052a), W(0x00030e678146342b),
+     W(0x00032ac5fbade0bf), W(0x0002af4c0a41cdf7)},
+    {W(0x0000a71848227caf), W(0x000602b72f91e51b), W(0x0002782b824539ad),
+     W(0x00046fb8b16b2429), W(0x0000febf73d9ed70)},
+    {W(0x0000000000000001)},
+    {W(0x00079a03e1e0368d), W(0x00007b3cf11a14cc), W(0x000530d4bd6847c1),
+     W(0x000640dac19daea9), W(0x00041674c775f5f2)}
+  },
+  {
+    {W(0x0006a9263666c00e), W(0x0003582209e753d3), W(0x00038812d63d9fc2),
+     W(0x000180b2d45094e7), W(0x00014030656f441e)},
+    {W(0x00056677d1337974), W(0x0007fec7711021fa), W(0x0003e0f243daa0c6),
+     W(0x0006f949fe47bcb6), W(0x00002b4b94d359ff)},
+    {W(0x0000000000000001)},
+    {W(0x0005fc7ae47a2dad), W(0x0001e1f6ef94fe4d), W(0x000031f1b55dfab3),
+     W(0x0003229af0d2c33b), W(0x0003a82d21543d7f)}
+  },
+  {
+    {W(0x0002b431ec20db18), W(0x000630bca93f81c3), W(0x000477c79e5515e6),
+     W(0x0003577f344ada22), W(0x000181fa104f2ba1)},
+    {W(0x000669c8d6f3cf3e), W(0x0007ea6780d95a6b), W(0x0004c347d3d713f1),
+     W(0x00049e7b912b7dec), W(0x00078fba96402b24)},
+    {W(0x0000000000000001)},
+    {W(0x00060d447652316a), W(0x0007f13344400dc7), W(0x00077043f7638809),
+     W(0x00027bf8ecae8548), W(0x0002773335236574)}
+  },
+  {
+    {W(0x0006801a9c986c3a), W(0x000406039aced9f5), W(0x00020337bfdae45a),
+     W(0x00037eb7b713fed1), W(0x00007d2cddcd2f44)},
+    {W(0x00019361c6732890), W(0x00005266259c4a80), W(0x00039e0aeea13271),
+     W(0x0003b076710faa9e), W(0x0004643920ab0204)},
+    {W(0x0000000000000001)},
+    {W(0x0001667ad563f078), W(0x00049dd995006f9a), W(0x00019b7d971467ae),
+     W(0x000606eaacffb449), W(0x0007b9dcce6b4765)}
+  },
+  {
+    {W(0x0000e491cd51faeb), W(0x000464f28d646944), W(0x00000f4673617935),
+     W(0x0007aa07a2375f1f), W(0x00029a2f1c05efcf)},
+    {W(0x0007188973dd93e7), W(0x00005d08960e0b0d), W(0x0002ac2951d93053),
+     W(0x0003c3f5eb824e79), W(0x00037e64bc9d6e37)},
+    {W(0x0000000000000001)},
+    {W(0x00002fd9bf67bc39), W(0x0007b454b707c03e), W(0x000758ba0d162b9a),
+     W(0x0000acfd877cd24b), W(0x000216a91a7d568b)}
+  },
+  {
+    {W(0x0002e81e6acb7e48), W(0x00056d54c8bbe745), W(0x00071ba9d372170c),
+     W(0x0005b9ce228ad521), W(0x0001d765c622be95)},
+    {W(0x0005ae3a9091cbeb), W(0x000248469802ab33), W(0x00056456d630301e),
+     W(0x000579a006304d45), W(0x0000a9327b8ea002)},
+    {W(0x0000000000000001)},
+    {W(0x00043d840a73859a), W(0x000641083cb992c1), W(0x0002ffc28a67095e),
+     W(0x000574c7f2e48c84), W(0x0006fb6479df6c4c)}
+  },
+  {
+    {W(0x000084c082674b86), W(0x0001701b41053e9b), W(0x00003edc74eb9dd4),
+     W(0x0005d7420c5ff7ff), W(0x0001cda607b580c0)},
+    {W(0x00003ffd4c9bc434), W(0x0003bba6a5cb2ece), W(0x0002b2a3d0ad285c),
+     W(0x0001ea702c8cd75d), W(0x000785f76a96ff0c)},
+    {W(0x0000000000000001)},
+    {W(0x00063c1fada93ab1), W(0x00078cbd9650b46d), W(0x00047a74c946a8b8),
+     W(0x00000ac47871a48c), W(0x000110b26f2a5624)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0001d364fc3a757b), W(0x00026b33493bafc5), W(0x000416cd4a9ed2fd),
+     W(0x0001428d0b57e1d5), W(0x0004339fa86a2324)},
+    {W(0x0005fe8a63a34b0e), W(0x000553b7a27e2b14), W(0x00044205c101d9fe),
+     W(0x00048b05df5dccba), W(0x0006d07cc3462bae)},
+    {W(0x0000000000000001)},
+    {W(0x00000bf15e84849d), W(0x00072b86554f4523), W(0x00018ddba2455778),
+     W(0x00006a2af02f7dac), W(0x0004dcb635e79d0b)}
+  },
+  {
+    {W(0x00064e9736c701eb), W(0x0004f74581abf576), W(0x00029bfef3795591),
+     W(0x00072b1cc6e98276), W(0x00062332ee4f8ee5)},
+    {W(0x00074bc89fb8ef65), W(0x0006b25369243fb4), W(0x0005e7ca6c2b5a08),
+     W(0x0007cfbf3517a3f8), W(0x0003e1bfb3c0218c)},
+    {W(0x0000000000000001)},
+    {W(0x0000d3dc0daa12e8), W(0x0003992e6be0b7e4), W(0x00078d0ffdc532fe),
+     W(0x0006422166d53332), W(0x0006b4c0d91dcf57)}
+  },
+  {
+    {W(0x0002396aef810769), W(0x0003272ba4e64da3), W(0x0005df47a5a5db18),
+     W(0x0006e6a42ff580c8), W(0x00033287cd3c57f3)},
+    {W(0x00046fea1c371cde), W(0x0001eac66533d582), W(0x0004b3dd317dc0d6),
+     W(0x00044d98937f95fb), W(0x00070f3e2be18824)},
+    {W(0x0000000000000001)},
+    {W(0x0007dca6a6e7b2b3), W(0x00060cb1a6504b48), W(0x0000713ed3813e50),
+     W(0x00036d03e28c21fa), W(0x00067ec78897c972)}
+  },
+  {
+    {W(0x0004d15140c88b2f), W(0x000054553c816355), W(0x0006fe5decbc6485),
+     W(0x0007a79e9fb6abfb), W(0x0007b9e0081b2e20)},
+    {W(0x0003f1fcc42b858c), W(0x0002f098844f3d15), W(0x0007e5f69a1be8e8),
+     W(0x0004a6902b81b7f9), W(0x000093854716ef97)},
+    {W(0x0000000000000001)},
+    {W(0x0006f6b57e400f15), W(0x0006af23bf13fe34), W(0x00040a70989fcce3),
+     W(0x0006630f507a1d7c), W(0x0003b80b63b1d3e2)}
+  },
+  {
+    {W(0x00064d47a7c2e55b), W(0x0003c06252c62301), W(0x0003531bc0abc846),
+     W(0x00057ac3e1e537e1), W(0x0001c70927aa306e)},
+    {W(0x0005654a077444f0), W(0x00024dcdd6382196), W(0x0006d36009a3a1c3),
+     W(0x00019f2ae05d7a61), W(0x0002e259ec780da0)},
+    {W(0x0000000000000001)},
+    {W(0x0000c542f4cb893d), W(0x0001f237c749902e), W(0x0004ae0d47bec2ee),
+     W(0x0004daa47b6d570c), W(0x0001241a6e46e774)}
+  },
+  {
+    {W(0x00014989f13c72ec), W(0x0003937f6987889c), W(0x00030225657ad7fe),
+     W(0x0007541db44db135), W(0x0001e22f8e8551ea)},
+    {W(0x000117e4d3609883), W(0x000665de1adb5d80), W(0x0006ab19361681c7),
+     W(0x00004786c1529cc3), W(0x000121fd5fd0c3ab)},
+    {W(0x0000000000000001)},
+    {W(0x000165b168a61530), W(0x0003be5e0df7208a), W(0x00071c062fcb9b5b),
+     W(0x0005964763b529b7), W(0x0006a243e5c6fd01)}
+  },
+  {
+    {W(0x000062a41118f91a), W(0x0000e4448cc3464c), W(0x0005aab3a49c1610),
+     W(0x0003c20812138b8f), W(0x0006237e93647e5e)},
+    {W(0x0005165245f5b2fb), W(0x000560ada6d8f2eb), W(0x0000c39412f9561c),
+     W(0x0007862aec0bca41), W(0x000438c3caf8e404)},
+    {W(0x0000000000000001)},
+    {W(0x0004e46d8c498822), W(0x0001d970cbe58918), W(0x000157bc8b6af02d),
+     W(0x00050585711b59f6), W(0x000027639bb44bc3)}
+  },
+  {
+    {W(0x00015e2fa8742940), W(0x0007b727de748f3f), W(0x000221a66ab0c4cf),
+     W(0x000148f99690bb8f), W(0x0007ecfa6b215265)},
+    {W(0x00037da46c4720c6), W(0x0007dbe06b7d4c79), W(0x0001081f39b60620),
+     W(0x00057f2abdbf300c), W(0x00010958b5cdaf36)},
+    {W(0x0000000000000001)},
+    {W(0x00054f14b851a6be), W(0x000401fc18eff580), W(0x0002b09d8d578e28),
+     W(0x00075d9ef0d6a641), W(0x0004f731b6407452)}
+  },
+  {
+    {W(0x00029baca59b817d), W(0x0007a9a0efc715b8), W(0x000458c07204d1d6),
+     W(0x00039b6f1b30cd81), W(0x0002e33fed8a22eb)},
+    {W(0x00014a0417fea5f7), W(0x0005e50c531c2f03), W(0x000019ea1aea45af),
+     W(0x0000b9c9f7ed3685), W(0x0000f200e1e95557)},
+    {W(0x0000000000000001)},
+    {W(0x0004ab338c0c4b8a), W(0x0004e25cf04eed59), W(0x000316ca2140b3f3),
+     W(0x0007c6e8de85fe1d), W(0x00029755219eb9a3)}
+  },
+  {
+    {W(0x00045160496b769c), W(0x0000cd406236760d), W(0x00026d416ac0abdb),
+     W(0x0006281b4db6b668), W(0x000005b8773f2787)},
+    {W(0x00053720e1e2dc0a), W(0x00046c0e6cae25b6), W(0x0000269e50a5a649),
+     W(0x00057791dcb418d6), W(0x000451fdf5ec7f4d)},
+    {W(0x0000000000000001)},
+    {W(0x00009e91aa147b3b), W(0x00018e5f3cd61f4a), W(0x000104ac9e20364c),
+     W(0x000116ae97430e6a), W(0x00012195b5b72aa7)}
+  },
+  {
+    {W(0x000430f18f2a9f33), W(0x0000b76cead0ecf9), W(0x0000675657a5bf3c),
+     W(0x0007f84aad6ebb9e), W(0x0003038a1d346cfe)},
+    {W(0x0000cdaded5f70aa), W(0x0001e870f475761c), W(0x00010408cacdb007),
+     W(0x000362127c3712ed), W(0x0003f1d0359151c4)},
+    {W(0x0000000000000001)},
+    {W(0x00023f2384c3847f), W(0x0003cdc48fbe6fe8), W(0x00011a4fbccf285c),
+     W(0x000623b95f9ac9f1), W(0x0004333ccfe1e26a)}
+  },
+  {
+    {W(0x0005d7b4030de462), W(0x0006327be8d7bf59), W(0x000426d8eea0b041),
+     W(0x0004d414a1c23802), W(0x00020d7e4108ef55)},
+    {W(0x000062bfab1c8257), W(0x0005c51e19f89d0e), W(0x00021625e020f059),
+     W(0x000765e7bffb07a3), W(0x00003fa5ae925b87)},
+    {W(0x0000000000000001)},
+    {W(0x00028670f3e489b5), W(0x0002fec24d83136b), W(0x0001141d11ad54bb),
+     W(0x0006f11e4b528f99), W(0x00008bd2647617b9)}
+  },
+  {
+    {W(0x0007f2bf5d2afad9), W(0x00009fca6e721b3b), W(0x0002224f3f0232fa),
+     W(0x0005d02d5b68be94), W(0x00000a0dba41acfe)},
+    {W(0x0001b58d1a63e168), W(0x000269f4c9e9106e), W(0x0004274bfff164c6),
+     W(0x000667bded7fba3f), W(0x0004324ce7c98743)},
+    {W(0x0000000000000001)},
+    {W(0x000042a272d3daaa), W(0x0004ca141f2a7b78), W(0x0004c0670c50a338),
+     W(0x00003cc41bcbe5ef), W(0x0002ada002329677)}
+  },
+  {
+    {W(0x000218b05c8035c4), W(0x00003b389af013ab), W(0x0006b2b1d40f1de8),
+     W(0x0006a293454c76fb), W(0x0004b4f244b4a68d)},
+    {W(0x0002f6f4acb743b6), W(0x000103260d791c62), W(0x0007241595687419),
+     W(0x0004465226049422), W(0x00072ea09d57d74b)},
+    {W(0x0000000000000001)},
+    {W(0x0006d1a0acc60e2f), W(0x0006f6d0dddd83e6), W(0x0003547646f4e143),
+     W(0x0007358e8bbe58bc), W(0x0003458dd44c819c)}
+  },
+  {
+    {W(0x000264480badc469), W(0x00025cb69eee02bc), W(0x0001e615a7a10339),
+     W(0x0006b80d86ea5c40), W(0x000427e264cd94a3)},
+    {W(0x0005328829a7b75a), W(0x00002bd20b5edd66), W(0x000508a47d90f618),
+     W(0x0006acf8bf2dd990), W(0x000253ca4d08d1bf)},
+    {W(0x0000000000000001)},
+    {W(0x0000559caf03a79f), W(0x0004f20def8e9555), W(0x000273c5659a53d5),
+     W(0x00031304bfdbed1a), W(0x000219274c855d9f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002fc50639295fb), W(0x000043118bd49e0c), W(0x0006a709e2dc905f),
+     W(0x0007c294eb193573), W(0x0006bda13918dcba)},
+    {W(0x0005a54bb6c20a36), W(0x00044be62822e0eb), W(0x0005219be64be119),
+     W(0x0007443e86cbd339), W(0x0002c3fa803b162e)},
+    {W(0x0000000000000001)},
+    {W(0x00018cf309a8fc68), W(0x0004c05d53317464), W(0x00006a18d24176d8),
+     W(0x000482de09a5934d), W(0x000241793f4c0da0)}
+  },
+  {
+    {W(0x0003e8a98a70b14a), W(0x000142c4bc400f2c), W(0x000466b59a903d2f),
+     W(0x000561458633c44f), W(0x00019af956d2b5b4)},
+    {W(0x0002b460ccb69d8b), W(0x0005094b4d22e9ee), W(0x0004f0c91686acd1),
+     W(0x00043baa183943c1), W(0x0005e228bb5fbae6)},
+    {W(0x0000000000000001)},
+    {W(0x0004193983c69da2), W(0x000067d8b4e58659), W(0x000239c30f691867),
+     W(0x0001258a53c7e464), W(0x0005d3fa16b54385)}
+  },
+  {
+    {W(0x0005bed74d873fa2), W(0x0007815bd95391a6), W(0x0002060047ca1612),
+     W(0x00027c860f995322), W(0x0007dc0f940a4ca8)},
+    {W(0x0003cc6337ffb90a), W(0x0007581a598a81a3), W(0x0006db7382b18658),
+     W(0x0001ec4ef379a02e), W(0x000202a2836390d4)},
+    {W(0x0000000000000001)},
+    {W(0x00013e984e5cfe2d), W(0x00000f84ef13b1b7), W(0x00017a3aaeec9bc1),
+     W(0x00052801ced04cb9), W(0x0001ddd9f49d6903)}
+  },
+  {
+    {W(0x0001bbc53587b9f1), W(0x00019ab9badeb9f7), W(0x0007ecd2439839f0),
+     W(0x00034d56368f2128), W(0x00045bf322997c44)},
+    {W(0x0005edc024c69e66), W(0x0002ee7e1a910bb4), W(0x000087fd09ffa9ee),
+     W(0x0003a9fecd17cdd0), W(0x000529d884884075)},
+    {W(0x0000000000000001)},
+    {W(0x0000cbcfab15e9e2), W(0x0000f34be7f08881), W(0x0001a431b696d565),
+     W(0x00038acd2330783d), W(0x0000986f62b22a9f)}
+  },
+  {
+    {W(0x00079c2ddc90ecc1), W(0x00013105d1cf8f10), W(0x00001be23bf0c76d),
+     W(0x0002e68f51637c01), W(0x0003330669d9c50d)},
+    {W(0x00059389d412536e), W(0x00004e676cc572e4), W(0x0007c7c85d28be0e),
+     W(0x000164ec517ae861), W(0x000472f41dbae441)},
+    {W(0x0000000000000001)},
+    {W(0x000577bd98d394c8), W(0x0006114fdd198f6c), W(0x000238c14d5c8f4b),
+     W(0x0003eac0910e80ce), W(0x0004343d3b2f70ff)}
+  },
+  {
+    {W(0x0007062a344896c6), W(0x000659e35e87b295), W(0x000721790b088703),
+     W(0x00067d149f511a97), W(0x000067c7289e5840)},
+    {W(0x0006a689e5036532), W(0x0007dd7951cb766d), W(0x00052c51762d588b),
+     W(0x0006737adadf7ca6), W(0x000341113f48b7b5)},
+    {W(0x0000000000000001)},
+    {W(0x0000181a9454e713), W(0x000432003df7dd89), W(0x000629daefdd0952),
+     W(0x000390407df2f650), W(0x00074ee65e9834ba)}
+  },
+  {
+    {W(0x00015026c359e253), W(0x000311684f57974b), W(0x0000c38218a7478c),
+     W(0x00033807d246507c), W(0x00011429e2f0b19d)},
+    {W(0x00026d85a4f1ab90), W(0x0006f690f18b790c), W(0x0001972889e48b92),
+     W(0x00068311ed832d74), W(0x0000ecaaf5d583e9)},
+    {W(0x0000000000000001)},
+    {W(0x0002fe50920ed6b5), W(0x0003b57e26d9db0a), W(0x000405b1e8bdf22b),
+     W(0x0002827f1e090071), W(0x0001f578ce79d779)}
+  },
+  {
+    {W(0x00009ce21522c607), W(0x0006f5c4fb23344c), W(0x0006469a03269938),
+     W(0x00038c0072a48947), W(0x00039632228d7d14)},
+    {W(0x00069ef27e00e2e8), W(0x0003d7a092a73323), W(0x00039ab09ac9ed9c),
+     W(0x000374726aa37155), W(0x0006f59557cabbd8)},
+    {W(0x0000000000000001)},
+    {W(0x00002f4bdc689dcd), W(0x0006a715d3caeb07), W(0x000475e24ba7976b),
+     W(0x00004956a2c6ce0c), W(0x00068f1981806f27)}
+  },
+  {
+    {W(0x00001f89f448b0f0), W(0x0006b1eeebd90da1), W(0x0001648ee244211f),
+     W(0x0001786bfe5d3d87), W(0x000734d45f6361bd)},
+    {W(0x0001eaee7a886fa6), W(0x0000db0ae5c89678), W(0x0000a2597ae0a332),
+     W(0x0003c6055fb0642d), W(0x000251604314f805)},
+    {W(0x0000000000000001)},
+    {W(0x0001b82166bcc24f), W(0x000733925ecb4725), W(0x0004d2c3b66e1f0e),
+     W(0x0005e943cfaa3c81), W(0x000473d253bcbf71)}
+  },
+  {
+    {W(0x00032e58c6d8d17d), W(0x00022aee8f9a0fd0), W(0x000471dfd50df1d6),
+     W(0x000611f9e305ed6f), W(0x0003b6816319bb88)},
+    {W(0x00048f49c2188ed4), W(0x0007c3036706163e), W(0x0003de387d68ea2e),
+     W(0x000450b27e6dd64d), W(0x00027cfcb4d9e5eb)},
+    {W(0x0000000000000001)},
+    {W(0x0004fc33806156dd), W(0x0000b22448736e81), W(0x000064404ef7cbb6),
+     W(0x0007dea152628d8f), W(0x00046995f7f1f51a)}
+  },
+  {
+    {W(0x00002cce5cf7ef9e), W(0x0002b5a9c0629535), W(0x00023079dae2a85f),
+     W(0x000236167c07649f), W(0x00003b87527be794)},
+    {W(0x00070e4414f5c448), W(0x00070b47e7bbf0aa), W(0x00072a11ca1c2c9b),
+     W(0x0006bd9aec4a5185), W(0x000247aca823f466)},
+    {W(0x0000000000000001)},
+    {W(0x0007d9ac15dd8e37), W(0x0004bc3870012e2e), W(0x0007a2a6c3acd976),
+     W(0x0005e7ed20d39aef), W(0x000662418ef4be5b)}
+  },
+  {
+    {W(0x0005366f27d3f8da), W(0x0006de30153195ab), W(0x00068a99fa107c30),
+     W(0x00055975e6e0f34e), W(0x0004daf6da076931)},
+    {W(0x00013dd86884e8b7), W(0x0000ff1834fb5e48), W(0x0002d3eaa833a253),
+     W(0x00059e94a1753a2b), W(0x000539ced4581cba)},
+    {W(0x0000000000000001)},
+    {W(0x000537b9e9a7ec6c), W(0x0003911cb362fa0e), W(0x00027bc77dbb6009),
+     W(0x0003a567a570e12d), W(0x000713c36235a1e3)}
+  },
+  {
+    {W(0x00079ff17ca25265), W(0x00048159dddd4b0a), W(0x000690788443d7a3),
+     W(0x0003c7cb58d2b7f4), W(0x0004997362d43c85)},
+    {W(0x0004eab1ef4644ad), W(0x0000d0e13e01a06c), W(0x0006018bf95e0f89),
+     W(0x0001488a4d235711), W(0x00071931b20599fe)},
+    {W(0x0000000000000001)},
+    {W(0x000340698ff224a4), W(0x0000719175d06d21), W(0x00063c7eab783874),
+     W(0x000633d75426c4ea), W(0x0007a541074a9c56)}
+  },
+  {
+    {W(0x0003032b5fc70be5), W(0x00021743125c5e7b), W(0x0002289cb70cb2b5),
+     W(0x00075e2242e87fea), W(0x0000f1c7a5e53286)},
+    {W(0x00056d6c76c4f68f), W(0x0000ea34b6fdbc21), W(0x0002cfb81a750050),
+     W(0x00005fb0b500dad4), W(0x000035ed60eb4f76)},
+    {W(0x0000000000000001)},
+    {W(0x000758856f9dcd62), W(0x000162a1c9b4b06b), W(0x00054bd6a16940e9),
+     W(0x0000f9bc4f1229d8), W(0x0002ac3b6d9a1706)}
+  },
+  {
+    {W(0x0003113508840502), W(0x0004450d54ef4f5c), W(0x0006a9a2b41cc5c8),
+     W(0x00055cf549521a32), W(0x0005b9e1fdbd2b33)},
+    {W(0x0001a4176d61ef91), W(0x00065a476e6eb8ca), W(0x0001ea1172b33e13),
+     W(0x0001372f1d1f48cc), W(0x0006745c9c17a135)},
+    {W(0x0000000000000001)},
+    {W(0x00008b3a95297ce6), W(0x00033857cc19c6df), W(0x0004af433f021cca),
+     W(0x0007607199fd2f97), W(0x000479e561aa74e7)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000071359b6e6424), W(0x0006c664206679cf), W(0x00022c56e66dcfc4),
+     W(0x0006a7f6a6e7b496), W(0x0004da4821314574)},
+    {W(0x00070759a40a6e65), W(0x0006cdc3e94d7e42), W(0x00036adb918af2d7),
+     W(0x0001690294de49d1), W(0x000314016034673d)},
+    {W(0x0000000000000001)},
+    {W(0x00017bf6701aef73), W(0x0005e0da0cd2d24d), W(0x00038034c6b548c7),
+     W(0x000439f71a0d5572), W(0x00010616d6cef8e9)}
+  },
+  {
+    {W(0x0005a1bd156d734c), W(0x000300c481626b89), W(0x0000607fad6c71e2),
+     W(0x0004ed332aeca1aa), W(0x00022423cb8e8212)},
+    {W(0x000223156f08cdb4), W(0x0004fe3a3da44163), W(0x00033a7bcd15cf1e),
+     W(0x0004c75b1cfb5bbb), W(0x000627dcf9be9be7)},
+    {W(0x0000000000000001)},
+    {W(0x000158b82405747f), W(0x0005f1fd7400d8de), W(0x0001e443263a7ecd),
+     W(0x00056106b700df9e), W(0x00066ec04859b42e)}
+  },
+  {
+    {W(0x0001bafd72fc5b92), W(0x00043c72af94dfbe), W(0x000350af500fa4fd),
+     W(0x00029f1926edec90), W(0x00032beb4e36411f)},
+    {W(0x00001fc9e7901786), W(0x00077a0725ad54a2), W(0x0003684d67a69b10),
+     W(0x0004281e5cd0730d), W(0x000425a36157c40b)},
+    {W(0x0000000000000001)},
+    {W(0x0005cc7474c2127b), W(0x0001c03850cda86a), W(0x0006ee01b252b7a9),
+     W(0x000508e65ca67598), W(0x0005698b7e0062ef)}
+  },
+  {
+    {W(0x000104dcab320bb4), W(0x00032ea163c42aaa), W(0x0000ae44e8d5ce26),
+     W(0x0004e0bb7524f3ff), W(0x00004230253b946f)},
+    {W(0x000558741d1e5afc), W(0x0002e7d2ef71f4d2), W(0x0007bd5e98b5e4ec),
+     W(0x0001cf3726858122), W(0x00004db9dd92f8d9)},
+    {W(0x0000000000000001)},
+    {W(0x0000334af45d936a), W(0x0007e966dcb661b9), W(0x00079899e7910541),
+     W(0x00035a64a089f906), W(0x0005dc5794033b13)}
+  },
+  {
+    {W(0x00033c62b35f9f4f), W(0x000763ca1ca9ea10), W(0x0007328952fd0e0b),
+     W(0x000336f7f1a11b08), W(0x00065f711807e588)},
+    {W(0x000616d7f9d9637a), W(0x00027a164e67fa6a), W(0x000052357e95fd6b),
+     W(0x00069112a118ad5f), W(0x000066f79ccc68c4)},
+    {W(0x0000000000000001)},
+    {W(0x000194b14e70e84b), W(0x0000bd3b7d9c53c5), W(0x0007e18472bbfd67),
+     W(0x00059b2995d25c76), W(0x00044d6deeeca512)}
+  },
+  {
+    {W(0x0002a4052f89d69a), W(0x000649357afed0a3), W(0x000458a2dac848a9),
+     W(0x000123f4425ee350), W(0x000115b217ea5058)},
+    {W(0x00004137e9279f1a), W(0x0004f53cd9217a50), W(0x00076434fad97c1b),
+     W(0x0003a3cde89779be), W(0x0000d6e86f3a086b)},
+    {W(0x0000000000000001)},
+    {W(0x00002833aa49e326), W(0x0000a016265371f7), W(0x0002d45f9e70d625),
+     W(0x00076a896974bf81), W(0x0002289c3bda5c99)}
+  },
+  {
+    {W(0x0004a0b1d181a9aa), W(0x0002b698a3a2fda3), W(0x00007f3967193c8c),
+     W(0x00022ae5f667f08d), W(0x0001e90739a6bbf8)},
+    {W(0x0005f82287b7869c), W(0x00005566279a9314), W(0x00035a7f8324bc4a),
+     W(0x000165289fe924ec), W(0x00043299d9738472)},
+    {W(0x0000000000000001)},
+    {W(0x00033fa160bd0c08), W(0x00020d603755d35d), W(0x000450c442bf68f5),
+     W(0x0005b782496b15a5), W(0x0006435675cc362d)}
+  },
+  {
+    {W(0x000691589756d7c0), W(0x00060c77d3e9e13b), W(0x000782f1750e1a0e),
+     W(0x00054745dfbae079), W(0x00063b06e648bf7a)},
+    {W(0x0000249be08bae16), W(0x0006e11a18488b8d), W(0x00075361fff589ee),
+     W(0x0000df8d967ea85b), W(0x0001b17d88ed9954)},
+    {W(0x0000000000000001)},
+    {W(0x00058c5961a52582), W(0x000349612b4b1c83), W(0x0005f62cc80cb364),
+     W(0x00030ec527e5fb90), W(0x0006771b61006b51)}
+  },
+  {
+    {W(0x00051d3f019271ae), W(0x00041149ef55ac91), W(0x0007badeee06ed53),
+     W(0x000639cc9bc5bb54), W(0x0004be0d44e9e75e)},
+    {W(0x00043d9821c553b9), W(0x00045d3b2d3babfe), W(0x000749649495b3b3),
+     W(0x00065285e35757fc), W(0x0006d1b70c8fafe0)},
+    {W(0x0000000000000001)},
+    {W(0x0002f101cc871fad), W(0x0001fcb7a0156cca), W(0x0001050dc04d194c),
+     W(0x0000f0b13c0851ae), W(0x0001c38941f2190f)}
+  },
+  {
+    {W(0x000433ae729964bc), W(0x00032530489ec601), W(0x0003ab900c1d8bcb),
+     W(0x00017e49991599c1), W(0x00052d270337c469)},
+    {W(0x000603e31b1f9cb0), W(0x00061fc17c090e8c), W(0x0007c647aef4efe0),
+     W(0x00033bee469edf7f), W(0x0001523eeafdf7fa)},
+    {W(0x0000000000000001)},
+    {W(0x000061ed76415019), W(0x00055c71aa565c2e), W(0x0006a8aa04a328ec),
+     W(0x00039c46cf310048), W(0x00008f5914ca9878)}
+  },
+  {
+    {W(0x0005852212890c42), W(0x00075f96cee1efe6), W(0x0006e6c5e2ad7e76),
+     W(0x0006701f6b2ed667), W(0x0004b5d58b34a638)},
+    {W(0x0004cc3f2f17cfe8), W(0x0007c98e7cd7aa25), W(0x00002f10b43cf7d9),
+     W(0x000147f5648f7827), W(0x00056e6a7453022d)},
+    {W(0x0000000000000001)},
+    {W(0x0000df2074480cac), W(0x000647d75b4639f5), W(0x000250ecd3d35007),
+     W(0x0001d14c21b554f2), W(0x0005046413445d68)}
+  },
+  {
+    {W(0x00024462ffa30916), W(0x000477c2bcb795b6), W(0x0004a0cf8a733a7f),
+     W(0x000134e1f139ac8b), W(0x000759a6a885940e)},
+    {W(0x00007131b6b91926), W(0x000550880d0f36be), W(0x00072773d1400759),
+     W(0x0000aa3a9bd3998e), W(0x00038802ad324546)},
+    {W(0x0000000000000001)},
+    {W(0x0001a233f963d0b8), W(0x0007c36d173ec88f), W(0x0007998a4656b43b),
+     W(0x0006a9ebfba1ae3e), W(0x000753329c2e1742)}
+  },
+  {
+    {W(0x0000ed2007f61cd8), W(0x0005d427276b2478), W(0x00068fd144ce7369),
+     W(0x0006824c441265c5), W(0x0002e6afc1818e79)},
+    {W(0x0005940f7b90420d), W(0x0007c57eb088fc35), W(0x0007473da1930ef4),
+     W(0x00056ad81e0e40ba), W(0x0005940ae2defecd)},
+    {W(0x0000000000000001)},
+    {W(0x00074b52d6b56371), W(0x0002cad861303953), W(0x00055cc51c38a8d7),
+     W(0x0003dc0f711f7d11), W(0x0003aef2d74a5ba7)}
+  },
+  {
+    {W(0x0001051e90c7f543), W(0x000429eaae760006), W(0x000007a93cfec13e),
+     W(0x00064aaed59f03ff), W(0x0002367af2f60af2)},
+    {W(0x000383d00e0be5ce), W(0x0004d08c1b020f34), W(0x0003fc377361fdce),
+     W(0x000642b8bd98c243), W(0x0005779eb44c5b39)},
+    {W(0x0000000000000001)},
+    {W(0x0005a2008ee8dd0a), W(0x000614ff389f8428), W(0x0005314c0ce635ca),
+     W(0x0003ed67581850cd), W(0x0007c3049a9e7a83)}
+  },
+  {
+    {W(0x0006062ff11b4c3b), W(0x0000fd58ba21b3d1), W(0x0004164b5bf56207),
+     W(0x000192ba6c9f53fa), W(0x0001e2de6930a6c7)},
+    {W(0x0002ac4c932f3c08), W(0x0001237d441e9fb1), W(0x0006db664aa4bab7),
+     W(0x0002af9e3ae4df52), W(0x0002f1d9b84d4d7f)},
+    {W(0x0000000000000001)},
+    {W(0x0000b14a7151cde6), W(0x000678ee20898990), W(0x00001e04adfff6db),
+     W(0x0006d4d77be34887), W(0x000363e57dd2e67f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000038c38e375586), W(0x000294fa52f6a289), W(0x000678e110d7c515),
+     W(0x00031e001a5b0df8), W(0x0000b2cea0029ee9)},
+    {W(0x000683199e99daea), W(0x00022a10eedd2dac), W(0x0005071a1d80f3f7),
+     W(0x0005556f2f6dc76c), W(0x00047ea95da28d39)},
+    {W(0x0000000000000001)},
+    {W(0x0000c918da43c40c), W(0x0003de9635332ca8), W(0x0002a4f3ebb16cfd),
+     W(0x0000bb9623ba01b3), W(0x0006a170160f1811)}
+  },
+  {
+    {W(0x000245cde613aabd), W(0x0003162c814b3489), W(0x00025f98104cd35a),
+     W(0x00035da76a65834a), W(0x00006e3d157d1cd9)},
+    {W(0x000793c427456c7a), W(0x0007470a0c4f8faf), W(0x0003c7671a22d5ac),
+     W(0x00049ec99cdc8cbc), W(0x00072f5ce3c9ce0c)},
+    {W(0x0000000000000001)},
+    {W(0x00014b0d854b6e46), W(0x0005be3053bedfe1), W(0x0006e4ee00173ee4),
+     W(0x0005f0a5b1ae03e1), W(0x000046b279f2371d)}
+  },
+  {
+    {W(0x0003dc6bc1c4350b), W(0x000766559cfc52f2), W(0x0006a9086f6ccf3a),
+     W(0x0001b4ecb0eefa46), W(0x0007c65b0ae1e629)},
+    {W(0x0004ddfc793e6b29), W(0x0003798859dcb00c), W(0x0006b22719d3b547),
+     W(0x0006f8cb58def6c3), W(0x00023d893f2ff35f)},
+    {W(0x0000000000000001)},
+    {W(0x0001e0104f4f137f), W(0x0002c22937ae1509), W(0x0002f8b73dd935d9),
+     W(0x0002be763fa5f44f), W(0x0003e31dbd6f5b2c)}
+  },
+  {
+    {W(0x00022c567d23ea24), W(0x0001008c10a1cb3c), W(0x00004fbd2c79d16a),
+     W(0x0007c2a2c1ffa66d), W(0x0001f13202c95083)},
+    {W(0x0002025c90275f48), W(0x0007d6ab88ef15a8), W(0x0007f5ffe8021421),
+     W(0x0005bf790884f3fe), W(0x00066336d356c381)},
+    {W(0x0000000000000001)},
+    {W(0x00018564b1c35b4d), W(0x0007e436bbed8835), W(0x0000253b45153643),
+     W(0x0003c29806a11a66), W(0x00058f25481ba473)}
+  },
+  {
+    {W(0x000126508a9cff07), W(0x000780c0f7947d8b), W(0x0001fcb59300fe37),
+     W(0x00056d7eb3e1d21f), W(0x00011899251cda7e)},
+    {W(0x0003471afb7de672), W(0x00029e14dda71803), W(0x000698ff9dc5ade1),
+     W(0x000581935ad13680), W(0x0001dbecc336f79b)},
+    {W(0x0000000000000001)},
+    {W(0x0000ba940bf559a3), W(0x00049facf1d5f2c2), W(0x0000c8ce15d7a4a4),
+     W(0x0002d3bb07c727b9), W(0x0004940985cbf8b8)}
+  },
+  {
+    {W(0x000137b252316e5c), W(0x00028798ee727e5b), W(0x000612b461f27a92),
+     W(0x00020ad85497a0d8), W(0x000714ca9e746b2d)},
+    {W(0x0001676984d77fd0), W(0x00062e33928791dd), W(0x00047cfa3d84b2d5),
+     W(0x00020df382c94b10), W(0x0002443a8334b223)},
+    {W(0x0000000000000001)},
+    {W(0x00074cc1da182a55), W(0x00009b4c2bc845b5), W(0x0007defca91cfe2a),
+     W(0x0006bdb6169bc5f7), W(0x00053b4e1a88d789)}
+  },
+  {
+    {W(0x000649a28c30925c), W(0x000148afe8f4be58), W(0x0004536887f7c4c9),
+     W(0x0005bffcde000993), W(0x0007c76ec6277377)},
+    {W(0x000022f34005e20d), W(0x000124b18f6cfb93), W(0x0005928338ad433c),
+     W(0x000424a5bf6334e3), W(0x00062377e50b3543)},
+    {W(0x0000000000000001)},
+    {W(0x00070ea5113943b4), W(0x000367a82ffb617d), W(0x000224876f394982),
+     W(0x0005bc8bb365562e), W(0x0004bd9e338b376d)}
+  },
+  {
+    {W(0x0000e4ac81360393), W(0x0003d648a986a124), W(0x00062ba798845130),
+     W(0x00009f630f7f46bd), W(0x0001d4e70e7fa35c)},
+    {W(0x00015795ddc22e61), W(0x0006a2ec7d10157a), W(0x0001ca78462b9122),
+     W(0x0007f90528c6c2df), W(0x0007b2807a91ce09)},
+    {W(0x0000000000000001)},
+    {W(0x00073389c7a3e513), W(0x00063e4a41a4c466), W(0x00023e46c561a3fd),
+     W(0x0001ba61d921c972), W(0x000273cbe1835d36)}
+  },
+  {
+    {W(0x0002c0d2cb38ec54), W(0x0002b5254fd5d3fe), W(0x0005ba1f98e7560b),
+     W(0x0000e182501591b5), W(0x000564d4b8e94faa)},
+    {W(0x0006f5920cecc2fa), W(0x0007be06f2cb51f8), W(0x000299d8f3aea47d),
+     W(0x000015f6c0ae9d4c), W(0x0006ef0da5f715fa)},
+    {W(0x0000000000000001)},
+    {W(0x00072d27ae2bd82a), W(0x000026ca8c7e704f), W(0x00067af51915c2bf),
+     W(0x0007003ed2b7004d), W(0x0002058df94ebbcb)}
+  },
+  {
+    {W(0x00069bce8cae22f9), W(0x0006158d887e057e), W(0x00033df7456af30b),
+     W(0x000103bab0999904), W(0x000454ecf75ded89)},
+    {W(0x0006d163b9c5852d), W(0x0002e928117bb956), W(0x000094ec852a4285),
+     W(0x00074e0962533b96), W(0x0002e7bf7059392b)},
+    {W(0x0000000000000001)},
+    {W(0x000422163a44929d), W(0x0006fe5563c37f86), W(0x000018813057cac8),
+     W(0x0006937ff7a2a4b3), W(0x0000d2b77b4166a1)}
+  },
+  {
+    {W(0x000235d50c4478c1), W(0x000207f64c9b353d), W(0x00070299264785ba),
+     W(0x000076c0548cee42), W(0x0004ef5f6881a866)},
+    {W(0x00018d419d0e4689), W(0x00056b3f9b43ede2), W(0x0003b6b26d751c0d),
+     W(0x000422bc379126af), W(0x00057c1071afae3c)},
+    {W(0x0000000000000001)},
+    {W(0x000667708a26446f), W(0x0003545e58b90083), W(0x0004b5f90c6c3c79),
+     W(0x00071b79e1200039), W(0x00062eca98ae9ed6)}
+  },
+  {
+    {W(0x00058c265e1471bb), W(0x00023ada6f9d3907), W(0x0007ef7f99b41cbf),
+     W(0x0000244b2ccceb3c), W(0x00072a0b27b3a0f4)},
+    {W(0x00017543c8693b4e), W(0x0006f97c8acf2d8a), W(0x00002d08b309469b),
+     W(0x000304008e10416a), W(0x00002fc5604bfd76)},
+    {W(0x0000000000000001)},
+    {W(0x0003c932803ea8b5), W(0x0000bb387a0ed272), W(0x00057a73364150fa),
+     W(0x0003751022dbf748), W(0x00061b5a270a657b)}
+  },
+  {
+    {W(0x0001b1e53c795b78), W(0x00072795d91c5c21), W(0x0003235cd31b6108),
+     W(0x0004f653bdf8abd2), W(0x00016abf3957607a)},
+    {W(0x00063c0f3e982d12), W(0x00013497159346a6), W(0x0001b2f4066b17c0),
+     W(0x00073f375eafaf9f), W(0x0000c2e28b3c5d72)},
+    {W(0x0000000000000001)},
+    {W(0x0006e87496261e0e), W(0x00076742d602690d), W(0x00009eff84126b05),
+     W(0x0001836f0213cf90), W(0x000771ad3f78289c)}
+  },
+  {
+    {W(0x0000ee960eda643e), W(0x0003ae97e90bd902), W(0x00037b7b4b059938),
+     W(0x0003297aa7b53abf), W(0x000044323f065868)},
+    {W(0x000045f49290d903), W(0x000292436046ac6f), W(0x00056f7aecbdb84d),
+     W(0x000009dc3ecd00fd), W(0x0004a4098a2d2c0a)},
+    {W(0x0000000000000001)},
+    {W(0x0005abbe54adfcaf), W(0x000606b2616c20cb), W(0x0000c9cddca18fb6),
+     W(0x00016f3aa62e26e4), W(0x0006d5f667b0b521)}
+  },
+  {
+    {W(0x000107f5f8b45e3f), W(0x0004fb41d4440e36), W(0x00068da4eb189484),
+     W(0x0004fc057750c887), W(0x0006f2756b4c2114)},
+    {W(0x0000bcf404624e85), W(0x000072a079db9048), W(0x000466b1bc161039),
+     W(0x0005158e492ae029), W(0x00002ca7a4884add)},
+    {W(0x0000000000000001)},
+    {W(0x0002d68c53bb07ef), W(0x00063d72501812d8), W(0x0004a802f59aaf43),
+     W(0x0007b2495ec52d9d), W(0x0007b1e5d444e044)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000047ae60b7e824), W(0x0001385ce47cbf90), W(0x000538a682639a17),
+     W(0x0001964a969cc270), W(0x0004c27afff3c45f)},
+    {W(0x0002bd114bf5a66b), W(0x0003ca349893cb77), W(0x00030a70ea4342f8),
+     W(0x00043ecaf88f5b13), W(0x0005f2c99e6526dc)},
+    {W(0x0000000000000001)},
+    {W(0x000731c946f1338a), W(0x00004ccc75b53d3c), W(0x0006492da851e192),
+     W(0x000017ea70ab0003), W(0x00005a164fd0bf46)}
+  },
+  {
+    {W(0x0007d1b43224e085), W(0x000651f7f44d3f9d), W(0x0001f5bb93da54b1),
+     W(0x00057bd040abfbc8), W(0x000786be30733efd)},
+    {W(0x00030712c63e2736), W(0x0007d673ad37c9d5), W(0x0003f4211ca9f022),
+     W(0x00042d9a138766ea), W(0x000653a5f772f349)},
+    {W(0x0000000000000001)},
+    {W(0x0004e817719f64c8), W(0x0002aaf757adc018), W(0x00074f63b25b13b9),
+     W(0x00074586c8334d2d), W(0x00012c73ed34d313)}
+  },
+  {
+    {W(0x0005ca89f193c7c7), W(0x000190eadb296624), W(0x000613c26eba92eb),
+     W(0x00028e517e9d52c5), W(0x00009c186afb8339)},
+    {W(0x00049a357f7b062f), W(0x000577daa9fe2346), W(0x00061928780aa0a9),
+     W(0x0001a9c9a34ad8a4), W(0x0006137b0746027b)},
+    {W(0x0000000000000001)},
+    {W(0x000562410e8ef362), W(0x00007e7115a47163), W(0x00063082b8bba0ed),
+     W(0x0006c576f02a36f1), W(0x000572c78d37f263)}
+  },
+  {
+    {W(0x000022f04c2eaa13), W(0x00057d69a3366d97), W(0x00072376731a9341),
+     W(0x000499efc4abc0ad), W(0x00021fee4804968a)},
+    {W(0x0000d3e930901700), W(0x0007512e5846260c), W(0x0002160ce6f694d9),
+     W(0x00028ea0b62ed0a8), W(0x000500b7740072cb)},
+    {W(0x0000000000000001)},
+    {W(0x0000a584e1b381f8), W(0x0002dc40f2fe1bb0), W(0x0007a252afa919c4),
+     W(0x0007f8344713f782), W(0x000198588f68c188)}
+  },
+  {
+    {W(0x0001e3a2b12d4f17), W(0x0004b2e7932aa923), W(0x00022727a3b68433),
+     W(0x0000415c09f01b2e), W(0x0004a2e1f96eee4e)},
+    {W(0x0004b832ac846fc4), W(0x00022e66b4cc889a), W(0x00077c36a3708a79),
+     W(0x00062dc64a88c45f), W(0x0006c3f24822e185)},
+    {W(0x0000000000000001)},
+    {W(0x0000b2d34c797678), W(0x0006b7b48f082a56), W(0x000320892791968a),
+     W(0x000130d94db67890), W(0x0002ddebaccef8dd)}
+  },
+  {
+    {W(0x0001449ec0ec3464), W(0x00054da0a6d415e8), W(0x00027490d51894c3),
+     W(0x0003a33578cadec3), W(0x0005dbd3bf95494d)},
+    {W(0x0004e1c737e25b77), W(0x00054f6f73f1826f), W(0x000264aae68d0b38),
+     W(0x0005d8431e6c6054), W(0x00056f5f77776e9f)},
+    {W(0x0000000000000001)},
+    {W(0x0004643a2e2f2569), W(0x0000611669774e72), W(0x0006e17d81aef50e),
+     W(0x00060a92020f5168), W(0x0005844f533bb02b)}
+  },
+  {
+    {W(0x0000badc76ed5685), W(0x00035fa4ebc2326e), W(0x0005dc73aed63804),
+     W(0x0001e078f96abefc), W(0x0004b3702044575d)},
+    {W(0x000027acd289b820), W(0x0001f5f99c524904), W(0x000581aabf8db72c),
+     W(0x00017a97a13d4072), W(0x00054333c50acf33)},
+    {W(0x0000000000000001)},
+    {W(0x000271da3c1535e8), W(0x00050808b29d87a9), W(0x000011653cf3c08e),
+     W(0x0000ee45253cfdc0), W(0x0001d1cecdf260f8)}
+  },
+  {
+    {W(0x0007136e1146b3df), W(0x00059e3baac9c516), W(0x00025223e30d62b6),
+     W(0x0005b57250cc032f), W(0x00077fe8a5d490af)},
+    {W(0x0005c5afa5f50246), W(0x0007c146a8b74dae), W(0x00048636448ab327),
+     W(0x00018b45600199ca), W(0x0003c530f01e039f)},
+    {W(0x0000000000000001)},
+    {W(0x000566861b52ad2c), W(0x000752b00120dfc5), W(0x00073bad60eb6373),
+     W(0x00040fc2927931ff), W(0x00025a2c58c77260)}
+  },
+  {
+    {W(0x00035c8de42dce20), W(0x0004f3903f2d597f), W(0x0003dd85b13817fd),
+     W(0x00019ccf62218b91), W(0x0003df71993fb635)},
+    {W(0x000722692a09fa98), W(0x0005439e0021cf78), W(0x000051c729edb2aa),
+     W(0x00069ce48b27d832), W(0x0007dcf8776aa205)},
+    {W(0x0000000000000001)},
+    {W(0x0000cb8d6970e9b5), W(0x0001e291b140584a), W(0x000607784546a446),
+     W(0x0000f74fa2c522be), W(0x00046c49dfefb5be)}
+  },
+  {
+    {W(0x0000cddd479736b0), W(0x000216ab397f0497), W(0x0001e1f35503332a),
+     W(0x0006f3f6da3a0cf9), W(0x00008f8726bcbbde)},
+    {W(0x0002aefea8b4c884), W(0x0005d470b1df666f), W(0x00025d20223888c0),
+     W(0x000003dc111cc068), W(0x00011f808ca3d11f)},
+    {W(0x0000000000000001)},
+    {W(0x000181684b2460b6), W(0x0004e00bfc81618c), W(0x000615fe58d16190),
+     W(0x0003d554d029d535), W(0x000308a2fc2d525b)}
+  },
+  {
+    {W(0x0002e9ccb983430c), W(0x0004c8d99999422d), W(0x0007549b92767f0c),
+     W(0x00068f157021163b), W(0x0004cf0cb74c7099)},
+    {W(0x000507c5e74f9735), W(0x0001c5016a149617), W(0x0007ca26a562ea69),
+     W(0x00030dc2fa516024), W(0x000005df4e013e64)},
+    {W(0x0000000000000001)},
+    {W(0x00068bbe81be9cc8), W(0x0006d87286f756c8), W(0x00003f807a456a8f),
+     W(0x000701ac2b9e248e), W(0x00025e0b22e23b82)}
+  },
+  {
+    {W(0x00005f4ed0d8b6ab), W(0x000371a4b0a6056c), W(0x000570359ac26890),
+     W(0x00061f05be0bd307), W(0x00054d6778da5f0f)},
+    {W(0x0002806f9009c619), W(0x000675cf4e8fcfd1), W(0x00048df9ce5e08e4),
+     W(0x0004ecc62b32ac58), W(0x0005f988a1f2c959)},
+    {W(0x0000000000000001)},
+    {W(0x00047545bc03c212), W(0x00063a742f44ee6b), W(0x0005735298f03895),
+     W(0x00025e3cda9e8ca9), W(0x00028ae8803cb684)}
+  },
+  {
+    {W(0x00014382c7d59993), W(0x0007ae9d998c6fb0), W(0x0002599ebd8e7a64),
+     W(0x000006a67d4c5972), W(0x000390414491821b)},
+    {W(0x0003facbdff0df5a), W(0x0002b4be0de64279), W(0x0006de9ff12603a1),
+     W(0x00078ebbb820348b), W(0x00069710b1edcd36)},
+    {W(0x0000000000000001)},
+    {W(0x00004e273fb7ae6b), W(0x000349abbea2b788), W(0x00024a4e6a4b330d),
+     W(0x0000c75513396fe7), W(0x0007eb4c6c7e9177)}
+  },
+  {
+    {W(0x000682e2c99e70f0), W(0x000404469b48712c), W(0x000064667988eeef),
+     W(0x00040539d99c51bd), W(0x0001432670aad334)},
+    {W(0x0002cfced8a71cd3), W(0x0003a90088ba560b), W(0x000321b83e07ecea),
+     W(0x000597b7bd55183e), W(0x0006ef2e391ba981)},
+    {W(0x0000000000000001)},
+    {W(0x0007120e749c98ba), W(0x0002064fa141e024), W(0x00034fe13bbecea0),
+     W(0x0000169b35efc6ba), W(0x0004a7b37baf1f65)}
+  },
+  {
+    {W(0x0007d1ff333057e4), W(0x0005576fdf5ab79f), W(0x0006b385a10d53e8),
+     W(0x00040892bfbfb2d6), W(0x00029b0c323e8469)},
+    {W(0x000060930c75ce1c), W(0x0005cd42b095b8ef), W(0x00066c89b07042b5),
+     W(0x0002e5c6e0a952e8), W(0x00039a797181bd8a)},
+    {W(0x0000000000000001)},
+    {W(0x00025af544a9a94b), W(0x0007578b03b6c66c), W(0x000052bd498306d8),
+     W(0x000154bac09b10d1), W(0x0004446f2c6af923)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00014e341f377534), W(0x0003093f0ced03b5), W(0x0003de5d9533f25a),
+     W(0x00045e80b6292501), W(0x00053e2a4ed1bbb4)},
+    {W(0x000390a25a9bd559), W(0x0005104aa986f71a), W(0x00019606a9fc3c20),
+     W(0x00039951e4a90670), W(0x0005a2334fdda642)},
+    {W(0x0000000000000001)},
+    {W(0x0006e7675ae65b12), W(0x0003bccdcb79beef), W(0x00074e08ca912175),
+     W(0x0000ada4aedbb74f), W(0x00042bc7057bf550)}
+  },
+  {
+    {W(0x00037bb34d0cb0b5), W(0x0004ccc73143f904), W(0x00027328dc4132eb),
+     W(0x00077c607fcf02be), W(0x0002618676f8fb18)},
+    {W(0x00041a235413414b), W(0x00078963d17529d4), W(0x0002db2dfaec9057),
+     W(0x00062b64797a8d8f), W(0x0002aa05b60a232e)},
+    {W(0x0000000000000001)},
+    {W(0x00027c09f9bab8a1), W(0x0006dd5d6ed4d0f7), W(0x00043dde2f0950d7),
+     W(0x0003e8f211c0c2db), W(0x00041f61ac497dab)}
+  },
+  {
+    {W(0x0007922e864729a4), W(0x0002ab965e69e229), W(0x0004cf8b22e698fb),
+     W(0x0003cdd847808f88), W(0x000281e0f83ffa5c)},
+    {W(0x00058eeca17a291d), W(0x00068c0d005d55b6), W(0x0004ef233e9470a5),
+     W(0x00005256be15c5be), W(0x0005d2e7c5951174)},
+    {W(0x0000000000000001)},
+    {W(0x0007d0ef3cea8220), W(0x0007bdfa9daba988), W(0x0006b5e8f5e1f990),
+     W(0x00003a7f736357a6), W(0x0002e3044d65122d)}
+  },
+  {
+    {W(0x0007323ebc4f6c0a), W(0x000709382263495c), W(0x0005ae3f4f0bdefc),
+     W(0x000593de67fba956), W(0x000566dcd766740c)},
+    {W(0x00029bbead27b0e5), W(0x0002a4675bcc76be), W(0x0005167bcdf82ade),
+     W(0x00069cc7ba9c8cb7), W(0x00051e9f19fc00f3)},
+    {W(0x0000000000000001)},
+    {W(0x00067a6290200cf6), W(0x000264c29c99e954), W(0x0004f7dc51e4a39c),
+     W(0x00011bfe15193b94), W(0x0001d21c9fb13e63)}
+  },
+  {
+    {W(0x00014a661a498fb2), W(0x0007597e8a4fa7f7), W(0x00074bb582780ed3),
+     W(0x000555203c2254eb), W(0x0000fe1bde10f994)},
+    {W(0x00027e21acc131ac), W(0x0003a5f1ac969c9f), W(0x0006977aec4bbfc1),
+     W(0x0002722d5a4cc306), W(0x0003d162f25f41c0)},
+    {W(0x0000000000000001)},
+    {W(0x00055ede618e2a91), W(0x000473a3e7d1f37a), W(0x0000146302152261),
+     W(0x00074c153e7733d0), W(0x0002e6edba459f98)}
+  },
+  {
+    {W(0x00042e08cb1e63bd), W(0x0000c5c77d7a93d9), W(0x0001e5ce074253f6),
+     W(0x00078d5804d1cb06), W(0x0005be3378416605)},
+    {W(0x0007996b167182f0), W(0x000294b190d20f2c), W(0x000274fc084cbdce),
+     W(0x00074ec5f9cc5c7a), W(0x0003d724fda9e6ce)},
+    {W(0x0000000000000001)},
+    {W(0x00069b8cb7da4d89), W(0x0006c0f28d8ffe77), W(0x0007022a36e9e9c3),
+     W(0x0000602844009a50), W(0x000781fef6446399)}
+  },
+  {
+    {W(0x00072237b02cd3d0), W(0x00068c85319f9346), W(0x00008bdaf8e4b46b),
+     W(0x0007162d7d8804ee), W(0x0006158e3c0da573)},
+    {W(0x0002ed43e2190e45), W(0x00072eac5017e40c), W(0x0007f6e58ae8ed18),
+     W(0x000056e9c4ea610a), W(0x0000a504c288881d)},
+    {W(0x0000000000000001)},
+    {W(0x000380b934f8ea94), W(0x00001b08191ea84b), W(0x0004a70cbe65463b),
+     W(0x00034b577ab4c6b7), W(0x00043c13ebf9f9fd)}
+  },
+  {
+    {W(0x000194862414aa88), W(0x00077996a347c242), W(0x0002e9b673567382),
+     W(0x0007bd917dc6b92c), W(0x0002151b330947c9)},
+    {W(0x0006d0aff23d74f6), W(0x0007992d646f8063), W(0x0006926b7241c097),
+     W(0x00041a851efe24fd), W(0x0002a01507ee46f3)},
+    {W(0x0000000000000001)},
+    {W(0x0002c8e83a650b36), W(0x00030628343f6478), W(0x000244bef2bebcbe),
+     W(0x000457b029cae05b), W(0x0001532318b05391)}
+  },
+  {
+    {W(0x0004fbf40ffde125), W(0x0007d087b446e24a), W(0x000096250fa0dd7d),
+     W(0x0001e91dfe9f31f5), W(0x0001391509815023)},
+    {W(0x00076b156e9210a8), W(0x000148171e10f9fe), W(0x00023cc4bbe4c44a),
+     W(0x0003889d395dfc54), W(0x0000fbfd53043822)},
+    {W(0x0000000000000001)},
+    {W(0x000421f254c9b67a), W(0x0000b2d3a43d3ca2), W(0x0002ab8181a3276b),
+     W(0x00018ec0991ac415), W(0x000027b2041e5627)}
+  },
+  {
+    {W(0x0006394de05364da), W(0x00067df9fc9a218b), W(0x00040ea19fa15d80),
+     W(0x0001f3c827facc32), W(0x000392431d409069)},
+    {W(0x000786815f958834), W(0x00044fe26a965562), W(0x00044b85dd832c90),
+     W(0x0001ed0e902024b0), W(0x00013ed8382a8e8d)},
+    {W(0x0000000000000001)},
+    {W(0x0003842850822582), W(0x00000bf192ac8893), W(0x000755ec42bd8577),
+     W(0x0004504576f69eed), W(0x0003b94ccfbf6496)}
+  },
+  {
+    {W(0x000220d7a2a5f7f7), W(0x0001b875e5deecf0), W(0x0004eefb18d5dc32),
+     W(0x0001203c151ea563), W(0x000373c74c879bce)},
+    {W(0x0007ee58626cc57b), W(0x000434c37ba603e5), W(0x00064cd207649543),
+     W(0x00028633eef3b84d), W(0x0003bf318f5f9db4)},
+    {W(0x0000000000000001)},
+    {W(0x000244df5bfd0097), W(0x0000b4ca877bfefa), W(0x00019ac8425d6785),
+     W(0x00013f1d27af6646), W(0x000522065236810d)}
+  },
+  {
+    {W(0x00041d3a0aa3e4c8), W(0x000520cda11fb801), W(0x0005b708d2888cb1),
+     W(0x00014f361aee7c3d), W(0x00024b7e7223286a)},
+    {W(0x0004a61852612944), W(0x00031822b26ee540), W(0x0003411ca2ef0954),
+     W(0x00018d5584db9df6), W(0x000237d50103d59c)},
+    {W(0x0000000000000001)},
+    {W(0x0001a2f3eb3b53be), W(0x00022e7388053819), W(0x00068f34a9835c45),
+     W(0x00041211b96ab863), W(0x000469f7047d8498)}
+  },
+  {
+    {W(0x000099d53948fa5c), W(0x00001eefb09b2d0c), W(0x0005c13ace1cc33c),
+     W(0x0006bf61ff35093b), W(0x0006705157aa8c9f)},
+    {W(0x00071c72ce9a0e07), W(0x0003a50944d1a7c3), W(0x0000b793ad9c2084),
+     W(0x0004b54d8d7446a5), W(0x0004d9de9c6b6a65)},
+    {W(0x0000000000000001)},
+    {W(0x00050a559cce667e), W(0x0000fc26a5c588fb), W(0x0002680600ae0250),
+     W(0x00008c81a0835bf5), W(0x0007af5ba5228b66)}
+  },
+  {
+    {W(0x0003ec124da162e0), W(0x000350391f4ccc06), W(0x0006d73d98c0cbae),
+     W(0x0002ab6835df964a), W(0x00073748bc0f2a5f)},
+    {W(0x0002fa8cc3a39f7f), W(0x00010eb2b76277b6), W(0x0003a3e94e05ba07),
+     W(0x0002a0cf9200cfa0), W(0x00006db480a1009f)},
+    {W(0x0000000000000001)},
+    {W(0x000229286a77ce30), W(0x00041ef07fdd52b8), W(0x000746259f0763c0),
+     W(0x0005362e7e1b8e3c), W(0x000098229c5918c9)}
+  },
+  {
+    {W(0x0003a6b388cd96ab), W(0x00061fa9d0550806), W(0x00067782e5b8cefa),
+     W(0x00013d5abd212b94), W(0x0004c33e15d1253c)},
+    {W(0x0000d3af31ca1505), W(0x00021e8be17b938c), W(0x00053087adb0c827),
+     W(0x0003ed633361edd1), W(0x0006af9b77f1092e)},
+    {W(0x0000000000000001)},
+    {W(0x0003ed2055232d01), W(0x000776d0f1535d6d), W(0x000284735501a871),
+     W(0x000212c23133fa30), W(0x0005a1b91d24c467)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0007fd3a6196e3d6), W(0x000284949203f37d), W(0x000476c5437b216c),
+     W(0x000706c3c52af457), W(0x0007b8d2c823baaf)},
+    {W(0x00014483f8af0c85), W(0x0003291ef9e8bb29), W(0x0007868197c6d14f),
+     W(0x0007cdc4f68ad9e1), W(0x0001c45a557b3624)},
+    {W(0x0000000000000001)},
+    {W(0x000243e17f2697b6), W(0x0005193306c619f8), W(0x00052ca05f976318),
+     W(0x00061a001a75b2f3), W(0x0005247683ea1bdc)}
+  },
+  {
+    {W(0x00051c3cd099c188), W(0x00073201e27df68b), W(0x0003731a5654bcda),
+     W(0x000679c6f128856f), W(0x0005fa2b1dfec51b)},
+    {W(0x00009b7d23a1682e), W(0x000217e84f70ad28), W(0x00014b5cbd03592e),
+     W(0x00045eb26f10d929), W(0x0003f81faa56dc38)},
+    {W(0x0000000000000001)},
+    {W(0x00079648b1b75f99), W(0x000398a8defa7801), W(0x000594ba852306a8),
+     W(0x0004d5b971c1fdc1), W(0x00059fa62b248848)}
+  },
+  {
+    {W(0x0002c70bc7009528), W(0x000063ed4991c551), W(0x0001696a5aa08d84),
+     W(0x00064cd2d131eacb), W(0x0003780a1d4b6b5a)},
+    {W(0x00015fea238825fe), W(0x0002cca59dedb077), W(0x00003bcee6378c63),
+     W(0x0002c65b7e4f9b48), W(0x0003aa8dc131e632)},
+    {W(0x0000000000000001)},
+    {W(0x000061e216a70b5f), W(0x0006de776b42af80), W(0x000162b5d5bdf418),
+     W(0x0003ff30994d6a3a), W(0x0000671d58200407)}
+  },
+  {
+    {W(0x0006668a7b47fdfb), W(0x0006fdf04c85cf33), W(0x0004261b63dbb087),
+     W(0x00002c3501eebe18), W(0x0001f878c9bb777a)},
+    {W(0x0001553da8e44755), W(0x00069c15c3b56684), W(0x0002fd62e7176fab),
+     W(0x0006fa0d18c49562), W(0x00059479937cae12)},
+    {W(0x0000000000000001)},
+    {W(0x0001347979dbcdc4), W(0x0004f87f8d2d6662), W(0x00037ac81a8ace57),
+     W(0x0002f7aa336b752a), W(0x0000659e12450355)}
+  },
+  {
+    {W(0x0005571a8e1c47ff), W(0x00033ab17ab47cbe), W(0x00074678e2fb0c24),
+     W(0x00052b1f350c7eae), W(0x00058458308ef6c0)},
+    {W(0x000626fc2bb1c02e), W(0x00064d7ddcd0c1fa), W(0x00008c25c9d513a0),
+     W(0x0005bc4b24a96867), W(0x000259d664d2b336)},
+    {W(0x0000000000000001)},
+    {W(0x00029edb737d6b6c), W(0x000348b34e92504f), W(0x0004a5a9867c7d3a),
+     W(0x0000ae6be2f31c97), W(0x000123678f80408d)}
+  },
+  {
+    {W(0x0003ff13e0665cb0), W(0x000294f79a7ca0ec), W(0x000401440d01f5e6),
+     W(0x0000afc7b8ce2b99), W(0x000333f8eef2b1f7)},
+    {W(0x0007f4107b4c7b5a), W(0x000650ff8676ce10), W(0x0007b888c25eca86),
+     W(0x0007d51b6b254d8c), W(0x000131883d8fc4ca)},
+    {W(0x0000000000000001)},
+    {W(0x00035495a3d912e4), W(0x0004a2321ff009c2), W(0x000280aacd6385d5),
+     W(0x00059fd85f0a9f8d), W(0x0000c03c46e2dff7)}
+  },
+  {
+    {W(0x000622afd443ec39), W(0x000423d5404492f3), W(0x0004239477208a1b),
+     W(0x000251f6c0eb46ad), W(0x0007b10e1d26d95f)},
+    {W(0x0006817ca6919549), W(0x0001a4913e350c0b), W(0x00040ac9fda7c686),
+     W(0x00019ee4a0633fec), W(0x00036663875e8dd1)},
+    {W(0x0000000000000001)},
+    {W(0x0004e8a91edf58a4), W(0x0002913d9526ec6c), W(0x000739cd949695b3),
+     W(0x000028507c07998a), W(0x00057d9ebf8c914a)}
+  },
+  {
+    {W(0x0005a949c163cac7), W(0x00064c9b4fcaa8a6), W(0x00077ab0cbdd401c),
+     W(0x00079d5908cdac3a), W(0x00008e60479f7f51)},
+    {W(0x0006e1fa4b22fa46), W(0x0002ecf74cff92df), W(0x00017e42186f9f12),
+     W(0x0006e6d908adfa77), W(0x0001b2b6c48c2eea)},
+    {W(0x0000000000000001)},
+    {W(0x00028f0f792833c8), W(0x00074137e0a79a43), W(0x0005b18fa591cade),
+     W(0x0004c3bc9aab89dd), W(0x0000d0f6b8d10c3e)}
+  },
+  {
+    {W(0x0003e75848c5976f), W(0x00031e8d95e44461), W(0x000746931c037a32),
+     W(0x0007526bcc486a01), W(0x0000198568b0656c)},
+    {W(0x00023ab4fc97bf01), W(0x00045ed31fab1a8e), W(0x000582f9b3c3721d),
+     W(0x0006319727384608), W(0x0002881d1f15ec4b)},
+    {W(0x0000000000000001)},
+    {W(0x000559bd925947d4), W(0x0007e1c42ed3cf9c), W(0x0002601f9b1aa753),
+     W(0x0006c154a854f2b5), W(0x00000e1edc4de706)}
+  },
+  {
+    {W(0x00007f8be723be3c), W(0x0005b7d7969523cd), W(0x00000aa6c80d60c5),
+     W(0x0001b9838ebadf09), W(0x0003cd3b17bf71c0)},
+    {W(0x0004bc76969edc83), W(0x0000db2dceb3271c), W(0x0001f27e036ec723),
+     W(0x0005f6ab1d22681d), W(0x0006254c36ae7a9e)},
+    {W(0x0000000000000001)},
+    {W(0x00016dc57976a822), W(0x0003e28ebac6a7ac), W(0x00062ec0ee8a6cb7),
+     W(0x0003679d3ee45cf1), W(0x0006384c9031c279)}
+  },
+  {
+    {W(0x00022c3189533983), W(0x0005d7402a65c321), W(0x00004ac0e9690f2e),
+     W(0x0001595cdb1e73de), W(0x00028f84803b2fc7)},
+    {W(0x0004f79fe345af44), W(0x00068f083e2063e9), W(0x0000b000051dfac5),
+     W(0x000335f28ead7bde), W(0x0004a3bafedb9bf4)},
+    {W(0x0000000000000001)},
+    {W(0x0003dedaf0361fff), W(0x0002e9e33430e9c9), W(0x00074464c7e12d49),
+     W(0x0005112c3d6360dd), W(0x0005000311067cad)}
+  },
+  {
+    {W(0x0004314fb46239e3), W(0x0002ea2e7abb5920), W(0x0001c10e8fcee315),
+     W(0x0007ddf14240b0f2), W(0x00006745ea49e4fb)},
+    {W(0x000659e027ffac29), W(0x00021af061b38737), W(0x0000b30b86dc542c),
+     W(0x0005aebe9d403998), W(0x00022f4f0c16b58a)},
+    {W(0x0000000000000001)},
+    {W(0x0004621857bb6c1a), W(0x00073c7b78dae3fb), W(0x0001448282a29d52),
+     W(0x0005ac4a6efa3fdc), W(0x0006bd4b00dd4549)}
+  },
+  {
+    {W(0x00075db9bfccc802), W(0x0006fbf2b6b65053), W(0x0002cbc8928bcae3),
+     W(0x0004093ae9e25009), W(0x0004c4724502fbff)},
+    {W(0x00050bfba7a4bd7f), W(0x0005b440132401ef), W(0x000689b836737cae),
+     W(0x00033d16af9aaa98), W(0x000161311bb8af3a)},
+    {W(0x0000000000000001)},
+    {W(0x00023108f4cda1e0), W(0x00049345153c4024), W(0x00022bdc49be73dc),
+     W(0x000665a7fdce8168), W(0x0003b6bf847eb675)}
+  },
+  {
+    {W(0x0004b3dd669137db), W(0x0005ce8bef1742ee), W(0x0000e1062590838e),
+     W(0x00067411f1a2dd15), W(0x0001f864ab0f962e)},
+    {W(0x0007c97d04aea995), W(0x0001dd57979a9d5d), W(0x0002e1756c4271f0),
+     W(0x000423f80c2b848c), W(0x0002cac3b01ac77a)},
+    {W(0x0000000000000001)},
+    {W(0x0006bf04a91bcda6), W(0x00074747e8f01422), W(0x0007a5c855f56007),
+     W(0x00025bf720c00266), W(0x0001565c72f2b246)}
+  },
+  {
+    {W(0x00036be7e0b3a058), W(0x0003c9f56e0d6865), W(0x0001b98589e47ac8),
+     W(0x0006f17611589c99), W(0x0004cc3b7d26ede6)},
+    {W(0x00064b9356bd04e5), W(0x0001d47d889ef682), W(0x0004634a5388ae1e),
+     W(0x0007d7cf904558e6), W(0x00037cc9762a1411)},
+    {W(0x0000000000000001)},
+    {W(0x00071b38cb49a458), W(0x0006282fcf902c72), W(0x000371017a7b3dfb),
+     W(0x0007ce32e6d73772), W(0x000286bb061a7ecf)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0001c67d35fb7ffe), W(0x0003f58058850460), W(0x00065003f276d108),
+     W(0x000084cbed657752), W(0x00078877b5d87774)},
+    {W(0x000619812d90fbf5), W(0x0000119110ada5f3), W(0x000064053505dd71),
+     W(0x0001f2242674303b), W(0x0000341b46c32833)},
+    {W(0x0000000000000001)},
+    {W(0x000178322091ae38), W(0x0007fc7f1c1ad6d4), W(0x0002e6ae20295074),
+     W(0x0004c8adc9906179), W(0x000410ac23903896)}
+  },
+  {
+    {W(0x00046e4f09c210ff), W(0x00038f794fdbfa5e), W(0x00059f6ada8ee874),
+     W(0x000008a59b43ea19), W(0x0001787c129a6052)},
+    {W(0x000738da2fca96f6), W(0x00011fcfb95f8374), W(0x000575a8ad1f8a24),
+     W(0x00015b6f5a50fd25), W(0x0000ba4e0f55131c)},
+    {W(0x0000000000000001)},
+    {W(0x00068f831fac2dd7), W(0x00029e596c258af2), W(0x0000be45423eb94b),
+     W(0x000081ef784d5498), W(0x00052fa5bc6eb223)}
+  },
+  {
+    {W(0x0006cfcdf3065acc), W(0x0006d67b98e49832), W(0x000344c97bbb875c),
+     W(0x0005be1c392e857b), W(0x00052f8c9eec853a)},
+    {W(0x0004d444ad682027), W(0x0001cf160bc76dac), W(0x0006a57da09616b8),
+     W(0x00013bd3925b706f), W(0x0005f8a40d84d2b0)},
+    {W(0x0000000000000001)},
+    {W(0x00067a3302d4c072), W(0x00077eca94b27157), W(0x0002dfb6a869a884),
+     W(0x000590b37ac9c985), W(0x00001585247ddffb)}
+  },
+  {
+    {W(0x00072b8e04c6e55c), W(0x0006f96470a717ca), W(0x000049bb4ea53efa),
+     W(0x000514c997596ad5), W(0x00001f54318884a9)},
+    {W(0x00052159a2dbfc50), W(0x0000e5f5c66fd7b1), W(0x000534371e5f406a),
+     W(0x0000764202f780b1), W(0x0000b704f0aa8dd4)},
+    {W(0x0000000000000001)},
+    {W(0x0007aa66b5e06cc2), W(0x00016cbaba625735), W(0x00017f3b60aefe85),
+     W(0x000145c96d370f78), W(0x000668fdfd11bb8f)}
+  },
+  {
+    {W(0x0007765bbe902c82), W(0x0000b1802b45ac11), W(0x0006102c22f588c4),
+     W(0x0000a4e56690379f), W(0x00043a8478c1726d)},
+    {W(0x00006859ddec85bb), W(0x000478e4dcc42c93), W(0x00052c85c75fc581),
+     W(0x00046405bb39091e), W(0x0002941361fe0b22)},
+    {W(0x0000000000000001)},
+    {W(0x0001641d4442c32b), W(0x0004d8fa538b3b89), W(0x0006c70bd1cf2ffa),
+     W(0x00052ba0230cc022), W(0x0003cf8e7b6c7eb6)}
+  },
+  {
+    {W(0x0002d35c67016941), W(0x00022afa27f9f8b1), W(0x00072ed4e404f99f),
+     W(0x0003e15b134b2b40), W(0x00006589763fb5ce)},
+    {W(0x0002e5f0baf30e0c), W(0x00036418ceeaf657), W(0x00022a73caf89226),
+     W(0x000527d878e0b4dd), W(0x000367e10ee9a052)},
+    {W(0x0000000000000001)},
+    {W(0x000382c692170a56), W(0x000045af58289a2e), W(0x00031497dd1b9439),
+     W(0x0006164ecd5080c9), W(0x00052a5804a821f9)}
+  },
+  {
+    {W(0x00070d85e258626d), W(0x00042af53a299926), W(0x0002b78d75085011),
+     W(0x00024415ce67f168), W(0x00052886c0879393)},
+    {W(0x0001b2140c6bb446), W(0x0006ca4524a49924), W(0x0000c30539a9d92e),
+     W(0x0000709b7c3ce423), W(0x00033487c541fcfe)},
+    {W(0x0000000000000001)},
+    {W(0x0007fb6ffa817fb5), W(0x00007d1c6f358185), W(0x00037baed091d857),
+     W(0x0007e60c7254f3d1), W(0x00067a9cabbeebd0)}
+  },
+  {
+    {W(0x000503e940e9263f), W(0x00013a3c122d20d5), W(0x0001b49f79e61182),
+     W(0x00045773755ebb73), W(0x0002fcd57c067c34)},
+    {W(0x0006bcc7b9dcc17f), W(0x00076f45096aa7b0), W(0x0000a99ef3e31d37),
+     W(0x00038d0583c7a6b0), W(0x0001a3da7acfabf1)},
+    {W(0x0000000000000001)},
+    {W(0x00068929a9c22634), W(0x0005b09150f635ba), W(0x000700fbc69faa74),
+     W(0x0006c3cb170f142d), W(0x00034125ade17ec8)}
+  },
+  {
+    {W(0x0007c10f803491de), W(0x00000f1f04848ef7), W(0x000368c9cba085b6),
+     W(0x00021ac5a98bd42c), W(0x0005134f039b7e56)},
+    {W(0x000316f68ba9486a), W(0x0007f17d89e31bf4), W(0x00053cfee3fbe953),
+     W(0x0007641f6dfe332b), W(0x00042c01b10d9b65)},
+    {W(0x0000000000000001)},
+    {W(0x00033f4e05fa471a), W(0x000294db664174b9), W(0x00074028fa000f07),
+     W(0x00004116e8712f6e), W(0x000097339c63c2b4)}
+  },
+  {
+    {W(0x0001398f7be0b868), W(0x0000ce815acff23b), W(0x0003e6b4a165e16b),
+     W(0x000195794c1f745c), W(0x0000876f1150e6cc)},
+    {W(0x00036b6e045d1aed), W(0x0001fae327db4c82), W(0x0002364ed212496e),
+     W(0x0005358dc2b62dba), W(0x0006aa18e92b75b0)},
+    {W(0x0000000000000001)},
+    {W(0x00074e7a1b497f56), W(0x0007d6e8360eed82), W(0x000621d2cd0db00b),
+     W(0x00051478deadcc61), W(0x0006bed68b802731)}
+  },
+  {
+    {W(0x0004cd9a21bf92b3), W(0x0004a8239d3d107d), W(0x00061a3332449913),
+     W(0x0004da93bc316b94), W(0x0005d57b07fd3a19)},
+    {W(0x0005d9c9231208d7), W(0x0002a78ada430d78), W(0x000432f33c27ee4b),
+     W(0x00008b1df9a5a583), W(0x0000b5dde12396e6)},
+    {W(0x0000000000000001)},
+    {W(0x0004def11f3453fa), W(0x0001f333bcb74c97), W(0x000210a7e1620afb),
+     W(0x0006f19fb2695584), W(0x0003dd6c075c8a9e)}
+  },
+  {
+    {W(0x00055df7524c709c), W(0x000036dc46adff86), W(0x000025ce85801140),
+     W(0x0007a43e37f0b150), W(0x0005b95b1ffb239c)},
+    {W(0x0005b694f195e1e3), W(0x0004d1404b26f82a), W(0x0004addf095162de),
+     W(0x0006a0ec175b0007), W(0x0007b9201f293f49)},
+    {W(0x0000000000000001)},
+    {W(0x00055139890cf0db), W(0x0000df69ab810841), W(0x0005e36ee7b7209a),
+     W(0x00013076d93ba58f), W(0x00061c0e33dd5356)}
+  },
+  {
+    {W(0x0006ad8df7e905ea), W(0x0004fbac59d2b6e9), W(0x0005de15b24e309b),
+     W(0x00019cdfa9117eea), W(0x0004f843f718e7d7)},
+    {W(0x000132514e01950f), W(0x0001b4f253561c3b), W(0x0006c513289b1479),
+     W(0x0006f6e0370db0d8), W(0x0005c20fb33100a8)},
+    {W(0x0000000000000001)},
+    {W(0x0004de3bd475dba3), W(0x0005a01c245e1467), W(0x0003821354f5797c),
+     W(0x0006f72d0f1ce09a), W(0x000561ce3765df56)}
+  },
+  {
+    {W(0x00013202f62d2c0d), W(0x00064e07885ac7be), W(0x000604d7f66fbd60),
+     W(0x0004f29abe5bc1fe), W(0x000289986bfe407b)},
+    {W(0x000286cf9e1c1c1a), W(0x00054ea39a5a8686), W(0x0001d1e43eae05c2),
+     W(0x00010ce2560fa59b), W(0x00036372ec433cfe)},
+    {W(0x0000000000000001)},
+    {W(0x0001d0ea64ac7717), W(0x0007f15cd7a031e6), W(0x00070cf35a1274ca),
+     W(0x00073366e667b8b1), W(0x0006d42e86cf440c)}
+  },
+  {
+    {W(0x0005abc31ef4b270), W(0x00009177a4d47808), W(0x00003d52498e9c55),
+     W(0x0005160a3367181b), W(0x0003c2abc7c0ec45)},
+    {W(0x00069ea1c143907a), W(0x0003993fafebe2b8), W(0x00072d646734d015),
+     W(0x0007beac2c3188d5), W(0x0004260bab46a01e)},
+    {W(0x0000000000000001)},
+    {W(0x00075d3a7c89cee8), W(0x0001c14df0c16bea), W(0x00005fd3e0a313e5),
+     W(0x00031d3a52c3283d), W(0x0003fe4b367e033a)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000778185eed3f91), W(0x0000089181a58467), W(0x0003475a3ba7efa0),
+     W(0x000625d74f2bac1b), W(0x0002b556bbc070b5)},
+    {W(0x000184e1d7174d6f), W(0x000665dfb2162f1b), W(0x000303e86cfc66d6),
+     W(0x0006c497006ed9b4), W(0x0007ba01332807eb)},
+    {W(0x0000000000000001)},
+    {W(0x0000f3cadc018c2c), W(0x0005f48a8b4c4768), W(0x0004c710a53d128e),
+     W(0x0006abe689eb3600), W(0x00058366c2ab7fc9)}
+  },
+  {
+    {W(0x00004444af406f1a), W(0x000083da01b1e876), W(0x000707fa3974642f),
+     W(0x0007027c48ae62f9), W(0x0003f5c47b490be4)},
+    {W(0x000132fef32c3bb0), W(0x000408b75547e0ee), W(0x0000e72d53aa36a1),
+     W(0x00010a6945f95a08), W(0x000537ce98e07428)},
+    {W(0x0000000000000001)},
+    {W(0x000020eb873b0fd8), W(0x0007677ab4ecad6b), W(0x0001001554fc9ae9),
+     W(0x00045c599ecd05e9), W(0x0005ed1f70065a08)}
+  },
+  {
+    {W(0x00018fc98dc1aeb0), W(0x00040f375deeef57), W(0x0004ff89abd6a0f2),
+     W(0x00059222a5f1802e), W(0x0001e2b1d5578437)},
+    {W(0x0005a06716d6b801), W(0x000634f48b1c3722), W(0x00027c4a2cbddcdc),
+     W(0x000469331b639ffa), W(0x00041c6747ff756a)},
+    {W(0x0000000000000001)},
+    {W(0x00066f1efc5aca5e), W(0x000721b7d41dd01b), W(0x0004a13209b9bf80),
+     W(0x0003bc157b813d96), W(0x0006c387efacf3de)}
+  },
+  {
+    {W(0x0004dd30a8b4f85d), W(0x00023b195a74a719), W(0x0005cb5244c6cbe3),
+     W(0x000325411da52b82), W(0x000614118e22068c)},
+    {W(0x00051229478dd419), W(0x000176a8ef02360c), W(0x0005521417ea968f),
+     W(0x00076115c6cb99d4), W(0x00063ebe5283599f)},
+    {W(0x0000000000000001)},
+    {W(0x0007ffe019722993), W(0x0006b4a1cce303f7), W(0x000204ca468545d1),
+     W(0x0006c6a640a0f9c4), W(0x00057fc742e19edb)}
+  },
+  {
+    {W(0x00012e2aef773c8a), W(0x0001842ec3c8d6fd), W(0x0003cc4861ad5071),
+     W(0x0001d842a007882b), W(0x000233475488522f)},
+    {W(0x00056b97a812b288), W(0x0004b7bc1f58e553), W(0x0007597adf006ac4),
+     W(0x00038a9f01dca3ca), W(0x00037e8d773be2a4)},
+    {W(0x0000000000000001)},
+    {W(0x00065a51e2aec609), W(0x0001d72b27e9ee13), W(0x0002a8b02d22be1c),
+     W(0x0005baa71c0629f8), W(0x0007c131b100a061)}
+  },
+  {
+    {W(0x0007037bcd22844c), W(0x000471b3dc4be217), W(0x0006a69cf343bc94),
+     W(0x000696cd252f3afc), W(0x000318ac05007ad4)},
+    {W(0x0003aac8823222a2), W(0x0001a3859eafe3aa), W(0x000766da90b03c67),
+     W(0x0004139a3a954bbd), W(0x0006bf5a299dfb3f)},
+    {W(0x0000000000000001)},
+    {W(0x000619a7c8248798), W(0x0006a38c51002e89), W(0x0000492498bccf13),
+     W(0x0002dc27769df231), W(0x000718c9556422ec)}
+  },
+  {
+    {W(0x0003fccb0d152c96), W(0x0000992ba098058e), W(0x000521be0be8427d),
+     W(0x0004d5af7f7c5351), W(0x0001b76bf6bdb257)},
+    {W(0x0006761efd0c3948), W(0x0005e84e4ea6cae0), W(0x0007c0fbb51669a1),
+     W(0x000718798b9f1069), W(0x000502f67ac28825)},
+    {W(0x0000000000000001)},
+    {W(0x0001eb427b959a4a), W(0x0003e180dbdf5523), W(0x0002646638863a38),
+     W(0x0000eec95786aae3), W(0x000640721e47d66d)}
+  },
+  {
+    {W(0x0004f4d8ef3f3fb1), W(0x000560ca0c14167f), W(0x0000902c55c148a4),
+     W(0x0007e60c3caffc12), W(0x00013aea1849989f)},
+    {W(0x0000c101c2b81f44), W(0x0004820c00aaa326), W(0x00049795c19cb5b2),
+     W(0x0005b87deedff90d), W(0x0000884949c8ca12)},
+    {W(0x0000000000000001)},
+    {W(0x0007dd4f765a027e), W(0x00015cf50eb4a496), W(0x00025d216199ac4b),
+     W(0x000100a56c3e63b0), W(0x0002260a9cbdfb5e)}
+  },
+  {
+    {W(0x0001aa838c102bf9), W(0x0007b19186ad752b), W(0x0004f445a2497316),
+     W(0x00042804cbdbb02b), W(0x000359e130689bbf)},
+    {W(0x000002b36189df35), W(0x00024e7d52ada367), W(0x0007e84811b12841),
+     W(0x0001fc0887329c02), W(0x0007efbb54d8c070)},
+    {W(0x0000000000000001)},
+    {W(0x00014eda64e556d2), W(0x0001dd174eee47a5), W(0x00035b92882abc44),
+     W(0x00052aa946c8627a), W(0x00052f40e1066e22)}
+  },
+  {
+    {W(0x00074f92161e6c95), W(0x0001fbbc2125ae22), W(0x00011d98405bb64f),
+     W(0x0004a03b6cacc679), W(0x00044d4065745c26)},
+    {W(0x0001be5d6052be24), W(0x00077976a3996002), W(0x00064d9441687651),
+     W(0x0003a8b151e95746), W(0x00058b1277f393b5)},
+    {W(0x0000000000000001)},
+    {W(0x0005880cf0546a3f), W(0x0002012af63cea7d), W(0x0002b14785513a7b),
+     W(0x000110ce83afe00c), W(0x0001c047ffa59166)}
+  },
+  {
+    {W(0x0006c7d215aef752), W(0x0005330dce3fe391), W(0x00029e1ccbe329af),
+     W(0x0005de1f733f8976), W(0x0000077da9565e26)},
+    {W(0x0000b84dcb279ced), W(0x000160fe3d8ad17f), W(0x0004762075e699d0),
+     W(0x000193a89d86bc99), W(0x00044c8406546acb)},
+    {W(0x0000000000000001)},
+    {W(0x0000676c0d39f832), W(0x00017b7260f637e1), W(0x0002d8e445a83e69),
+     W(0x00036741d17d5ae7), W(0x00022e55f0c615cf)}
+  },
+  {
+    {W(0x0005ead4544a65a5), W(0x0002193331674a2e), W(0x00027add41bee3bb),
+     W(0x000197243c13582e), W(0x0000fc0e04248da3)},
+    {W(0x0007651f2523f1ab), W(0x00034dec6e9790f3), W(0x000332e21639870e),
+     W(0x00044987bea2eb3e), W(0x000091fe7868c3ab)},
+    {W(0x0000000000000001)},
+    {W(0x0003f8ac8031b371), W(0x0001a61c39963282), W(0x0004e97602ccbcfb),
+     W(0x0001f0520d36b3df), W(0x0003b5e7fbd1fe84)}
+  },
+  {
+    {W(0x000053b2690ab941), W(0x000257b826731a0a), W(0x0005191f30556ca6),
+     W(0x0002a5ca3738bd2b), W(0x00024dbcfac1e309)},
+    {W(0x00008a791c281f86), W(0x0004c3881c127f93), W(0x00076122200cdb11),
+     W(0x0004742070a1e581), W(0x00052e9d442ccfa9)},
+    {W(0x0000000000000001)},
+    {W(0x00069ad2208f8d10), W(0x000632d240530dfa), W(0x0006268efaa7e7c3),
+     W(0x0002743c1ddfeeff), W(0x000579905a3c62fb)}
+  },
+  {
+    {W(0x0006a23defdb689d), W(0x0005cdb65c705bb1), W(0x0007dde6959d8197),
+     W(0x0003b200c5def64b), W(0x000742d185d88bc0)},
+    {W(0x0001d5bc4c21a5e1), W(0x00044e417e278167), W(0x00036da1fa0f487c),
+     W(0x00040d9db30f3371), W(0x000725917bd18558)},
+    {W(0x0000000000000001)},
+    {W(0x0007f0511ee5ec0a), W(0x000326313f68bf54), W(0x00073f2d5e95d507),
+     W(0x00017f2bd6efb53e), W(0x000351a69e4f5dac)}
+  },
+  {
+    {W(0x0002a125e8ec7588), W(0x0001b0d9a892775b), W(0x0001ac6207b90f49),
+     W(0x0001d797bbea4912), W(0x000090912109be04)},
+    {W(0x000437777590931d), W(0x0004842ad41f4728), W(0x0003f8896e502406),
+     W(0x0001fc79b4673a7a), W(0x0003986e0d598800)},
+    {W(0x0000000000000001)},
+    {W(0x00021e7568de84d5), W(0x000396d9b0982385), W(0x0003c1d809af75d8),
+     W(0x00064ba98db05d44), W(0x00066719804e89f5)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00012bc94d43c4e7), W(0x00007775e783abad), W(0x000437b4f66138e1),
+     W(0x000223ccf87e8190), W(0x0000f72556998b00)},
+    {W(0x0000863b5315df5e), W(0x0004d1ed0e1e3610), W(0x0001af60692439f1),
+     W(0x0001ea23e577a77f), W(0x00016c19c5037c10)},
+    {W(0x0000000000000001)},
+    {W(0x0001a0ca0377990d), W(0x0007c04ad43e32f4), W(0x0005fba81b7c625d),
+     W(0x0007c72ea74a0267), W(0x000618d9dc27e79a)}
+  },
+  {
+    {W(0x00029ef5e347371b), W(0x000686d05ce5459d), W(0x0001a52e491e047f),
+     W(0x0000ada9aec60887), W(0x00025aea0bc08278)},
+    {W(0x0000421105a13269), W(0x00016c49b58b3a40), W(0x000676817543884e),
+     W(0x0000baa0895dfecd), W(0x0005ddcc7dccc9e4)},
+    {W(0x0000000000000001)},
+    {W(0x0000bdd2fd7dc1cd), W(0x0001a9d79f8e0a2e), W(0x0006d2cef9b46202),
+     W(0x0004c1c333d4c7e1), W(0x000294c91801ff60)}
+  },
+  {
+    {W(0x0001fd66106414f0), W(0x0002f9774cc8d2e9), W(0x00003187bc20025c),
+     W(0x00042003474fb1ed), W(0x0003c56aee69cb88)},
+    {W(0x0003389adfa46a20), W(0x000441d85e27b787), W(0x00004c19c5111605),
+     W(0x000056b232323d6d), W(0x0004de567df25c39)},
+    {W(0x0000000000000001)},
+    {W(0x0002a57b4d3f30d8), W(0x00014458d08fd560), W(0x00075abd8df110b4),
+     W(0x00003ddfa59a355b), W(0x0005f4b1f6a720d8)}
+  },
+  {
+    {W(0x000270460638e3d9), W(0x0004bfef29250bd0), W(0x0006c01a34a53b48),
+     W(0x00003ef2334dd711), W(0x0004eecfca39170c)},
+    {W(0x0006f6306a371262), W(0x0006e1c1ab829f63), W(0x0002b014239daa06),
+     W(0x0005f539f1231c55), W(0x0005e9e7c4381074)},
+    {W(0x0000000000000001)},
+    {W(0x0005c698e856753b), W(0x00022e8cfeecf2e4), W(0x000217ec8c06aae8),
+     W(0x000663c2a2a70adc), W(0x0003d838bbba56f5)}
+  },
+  {
+    {W(0x0000bb3baf72d4b7), W(0x00038e24da991554), W(0x0000865c496a0019),
+     W(0x0007ba84184459a3), W(0x0007cab69a181869)},
+    {W(0x0002d465fdbfdd06), W(0x0007ee2a16cb6cc1), W(0x00047147f63cb39a),
+     W(0x000510d02a718678), W(0x0006a47f43c5c1e9)},
+    {W(0x0000000000000001)},
+    {W(0x0002722c36f16ebc), W(0x0003f91c0d67e302), W(0x00058c658279844f),
+     W(0x00054b277caabca0), W(0x0007e63b8cc357be)}
+  },
+  {
+    {W(0x000415afc8304b4f), W(0x00024f0b91dfbaa6), W(0x00061df2d4a11c1b),
+     W(0x00003959df5974e5), W(0x0000056cbd312f96)},
+    {W(0x00059c651e83911c), W(0x000466a4140cfb3a), W(0x00020a9bec5cb9b3),
+     W(0x0002c28e2d934f22), W(0x00038d497d27862d)},
+    {W(0x0000000000000001)},
+    {W(0x00052e9afea0a05c), W(0x000360e5dbf87a8c), W(0x00052c4b6df7a4cc),
+     W(0x00077d04d23a9e6b), W(0x0007253cd40d3cc5)}
+  },
+  {
+    {W(0x0006e7ab4a86e33d), W(0x0000bbc6fe660d69), W(0x0002ea25e5a6db12),
+     W(0x00028bc599080083), W(0x0004e02ccb947e56)},
+    {W(0x000192aa37442aff), W(0x00001f618ac72d6c), W(0x0000894296fd64ae),
+     W(0x0004a0be9afdb488), W(0x000076605fe12217)},
+    {W(0x0000000000000001)},
+    {W(0x0006943b9a7019c2), W(0x00002bfa4de4042e), W(0x0005b725206a87ee),
+     W(0x00038d8a2c604f9f), W(0x0007d879b52a3196)}
+  },
+  {
+    {W(0x0003762e4f21f9fc), W(0x0006486eec0503f3), W(0x000318a8c05efa74),
+     W(0x00004c183133490c), W(0x0002884187fa6114)},
+    {W(0x0001768af4d3ab3f), W(0x0005586925b94794), W(0x00030ca85e142c23),
+     W(0x00079ecfabfe8436), W(0x0003200426867df5)},
+    {W(0x0000000000000001)},
+    {W(0x00079c699da5e47b), W(0x00066a8d67d52513), W(0x0002996eb52c4b8f),
+     W(0x00060e1c92d7b358), W(0x0001c495332dbadf)}
+  },
+  {
+    {W(0x0006958fc64d337a), W(0x0007678ac0a154b1), W(0x00033735c3b93dd3),
+     W(0x000455cdb5d3c2ca), W(0x00021ed9f92f7930)},
+    {W(0x0002cb34f22087be), W(0x00046a4cb0930c6a), W(0x0002c14f6bae3178),
+     W(0x0002e455926e974f), W(0x0000719172cc9a26)},
+    {W(0x0000000000000001)},
+    {W(0x0003f89b75a0f5bd), W(0x0000711ed4b03933), W(0x0002726bda7742fe),
+     W(0x0002dc96a43fa62c), W(0x0003d91ef128e39a)}
+  },
+  {
+    {W(0x00001c7696f9b5d3), W(0x00051fdce24bbcd1), W(0x000466722bfa2af8),
+     W(0x00042c589cc4f592), W(0x00007add203f3331)},
+    {W(0x00062605bb446e0f), W(0x0000da3ac45a031a), W(0x000042a458260e0a),
+     W(0x0003c226050d03b1), W(0x0000c5edde036935)},
+    {W(0x0000000000000001)},
+    {W(0x0005a08ea548eb97), W(0x00021d29b93ce1c1), W(0x00059f13d222c54f),
+     W(0x00026515828d4e9d), W(0x000131e9138d541e)}
+  },
+  {
+    {W(0x000197535b1632e3), W(0x0002dd5911221624), W(0x0007606a904a608c),
+     W(0x0006868950dc0f3e), W(0x00002d0ddf77de4b)},
+    {W(0x00011197c9c733d4), W(0x0007177bcd666dec), W(0x000052e015f2e917),
+     W(0x00063246f4c10019), W(0x0005bb748d2a96f9)},
+    {W(0x0000000000000001)},
+    {W(0x0007ed161041f35d), W(0x00027a94e4fcb9e2), W(0x0006149636b3d4e7),
+     W(0x00034b6da4f08079), W(0x0007a253bc40c7e6)}
+  },
+  {
+    {W(0x00018a4f061b6051), W(0x00001ad755071744), W(0x00055935da6fa7d9),
+     W(0x0006a7974d852d90), W(0x0005b979f0832813)},
+    {W(0x0001909d06ec44e5), W(0x0001f5ef3c1a73ef), W(0x00049eb81377f442),
+     W(0x00075c753c99a34b), W(0x0000ee157595aca4)},
+    {W(0x0000000000000001)},
+    {W(0x0004252b87a66da4), W(0x0003d79b0efc38d2), W(0x0000ae2bd33b57e9),
+     W(0x000075502d01aca1), W(0x00042dfa164f4efa)}
+  },
+  {
+    {W(0x0006a18cf9673ea1), W(0x00001137f8a36119), W(0x000308be801e10f6),
+     W(0x0003efb6c49e3f16), W(0x00059203c5a69c1e)},
+    {W(0x0003b1ec5f5b1dc0), W(0x0001d8f25b7f5be6), W(0x0007a5a359065ef8),
+     W(0x0005a901b65179e1), W(0x0000bc266f6e2b06)},
+    {W(0x0000000000000001)},
+    {W(0x0001b2554b2c4ef8), W(0x00019422dba669f5), W(0x00067856239d4df4),
+     W(0x0007d2bd19c7b981), W(0x0001775128363fd0)}
+  },
+  {
+    {W(0x000582dd29af9d73), W(0x000059a42e632d8b), W(0x000241251818a2af),
+     W(0x00059c57be10c109), W(0x00045b836db320f7)},
+    {W(0x0004afaa3145e1f6), W(0x0002afdeeae24d26), W(0x0001ebb6479db4f0),
+     W(0x00022bcbaa1d5195), W(0x00053609649c8381)},
+    {W(0x0000000000000001)},
+    {W(0x00078ab695d9c3f6), W(0x0004c4537541ba42), W(0x0003cb5a2df405c1),
+     W(0x0000ba24acf8d1d2), W(0x000487c54b82b7ac)}
+  },
+  {
+    {W(0x00077654657a81c6), W(0x0001843547ff147c), W(0x0005be8546549de4),
+     W(0x0002a182b0aec61d), W(0x0005e7b03b427a95)},
+    {W(0x0007ef583579ae36), W(0x00050eb5e2b2fa10), W(0x00072513452726f1),
+     W(0x0000a201674f05ac), W(0x0006152bef546204)},
+    {W(0x0000000000000001)},
+    {W(0x0000d86df848ce0d), W(0x0000d02e80efd8d4), W(0x000472f86af5b478),
+     W(0x0006864199962a16), W(0x000125c73dc58344)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00004341a5f3da1a), W(0x0000dd4e3cefdf85), W(0x0001034cbb3164ef),
+     W(0x0001e6a23789d9f6), W(0x0001cd96ef237b21)},
+    {W(0x00004a5ccd60dbe3), W(0x00018e26ce7de1e3), W(0x00005f3b62d047da),
+     W(0x0005afcbbb9327af), W(0x0007a626aeb91efc)},
+    {W(0x0000000000000001)},
+    {W(0x0001dda75a4ca750), W(0x00077e45bd12177d), W(0x0006233d9f3c7b1a),
+     W(0x00005604ea5dd5c4), W(0x0006e769cd81a091)}
+  },
+  {
+    {W(0x0005810897a24a18), W(0x0007d07e19989065), W(0x0003ed6d325437b1),
+     W(0x00062b3325404c7d), W(0x000275d04f2b3510)},
+    {W(0x00062e5a06b8b93b), W(0x0002347386f0587f), W(0x0005218f6a9a707c),
+     W(0x00075e5316ef56cd), W(0x00057dd6527da326)},
+    {W(0x0000000000000001)},
+    {W(0x000137c301aa4eeb), W(0x0005b2038466db08), W(0x00018838c156af50),
+     W(0x000246f9615799a5), W(0x0004dfc3c993e8af)}
+  },
+  {
+    {W(0x0005a501bb5309c5), W(0x0001a75986e32bc5), W(0x0007614d69097315),
+     W(0x00045c3cca33a9b8), W(0x0005dc17a1192ddf)},
+    {W(0x0006f21cad653d78), W(0x000385731096c7d0), W(0x000487b74578e2b3),
+     W(0x000090717cbfe980), W(0x00068538e31bee79)},
+    {W(0x0000000000000001)},
+    {W(0x000639f1d4b39be1), W(0x00070d539b3960ce), W(0x0004879ec602fd75),
+     W(0x00005379a90dca8a), W(0x0005fb9b0051910c)}
+  },
+  {
+    {W(0x00042e7d31374f84), W(0x0006ed6540f0f5b7), W(0x0000d5d53bad7ff0),
+     W(0x00039d0c8555ef53), W(0x0003c3b6a92efb1b)},
+    {W(0x000460396d94b23b), W(0x0006c763503cfdd5), W(0x000514aa5015721d),
+     W(0x000583d89174c05c), W(0x000126d49709e40c)},
+    {W(0x0000000000000001)},
+    {W(0x00074f6271dda548), W(0x000054645a74df59), W(0x0002af69c87b26eb),
+     W(0x0002eef1181154a0), W(0x00030c7cce660084)}
+  },
+  {
+    {W(0x0003883000762536), W(0x00058d8af1db21fe), W(0x00040c920c3a655c),
+     W(0x0002cd4c1a16f7fd), W(0x0004962227254243)},
+    {W(0x00041925fd7ce64f), W(0x0004393bf3f965fb), W(0x00063f4f071176fd),
+     W(0x0006730d561b7734), W(0x0000b370634de2b0)},
+    {W(0x0000000000000001)},
+    {W(0x000714d5e69e0071), W(0x0005acdb88bba00b), W(0x000478d6b7fd4a85),
+     W(0x00029c11e1973ec7), W(0x000284468a4a7e91)}
+  },
+  {
+    {W(0x00054ca8847818fd), W(0x00062e9cb4cb2dcf), W(0x00070544ba129867),
+     W(0x0001aeb58a790994), W(0x0002201bfeff7515)},
+    {W(0x0002fde64c624ba4), W(0x0007be5f903e40ee), W(0x0006e8a9d9a1f04a),
+     W(0x0004050b8fd8b2fa), W(0x0002af4f8c0bfb03)},
+    {W(0x0000000000000001)},
+    {W(0x0006c890063b1743), W(0x0001e9f9667e2276), W(0x00058041a1f70529),
+     W(0x0005411d31d96f03), W(0x00005b5181462933)}
+  },
+  {
+    {W(0x00069e8a4550bbb3), W(0x00055bc5555266d1), W(0x00009571894ea475),
+     W(0x0003285919343bbf), W(0x00013e4b9507e542)},
+    {W(0x0002d4bb274a03d8), W(0x00022d5abfbda6db), W(0x0002a96fb7475a56),
+     W(0x0003853cbd45cda5), W(0x00079cf2e8f8e6b9)},
+    {W(0x0000000000000001)},
+    {W(0x000444cca031d743), W(0x0004330aaebadeff), W(0x0001c6046ce2d3a1),
+     W(0x0000599c55e84480), W(0x0001059bc969038b)}
+  },
+  {
+    {W(0x00011de45b556055), W(0x0004ce13eb73a98e), W(0x0000cb8a80b26a16),
+     W(0x000583d2954f6724), W(0x0003cde77866cc73)},
+    {W(0x0007437e967a18f7), W(0x000656c9df8ab52a), W(0x00074d4b5f93c801),
+     W(0x000263b8fb42db69), W(0x00079f2b3d77f3f4)},
+    {W(0x0000000000000001)},
+    {W(0x0002a84b4b9ccfca), W(0x0005e5d0832c9459), W(0x0002f99b1500f926),
+     W(0x00032daff8575fef), W(0x000273f1c9748bee)}
+  },
+  {
+    {W(0x0002a499868f8808), W(0x00058e03707334d2), W(0x00072dcc3de957f9),
+     W(0x0000b90183d9e6fb), W(0x0005e06d1c52e29c)},
+    {W(0x0000d53fba648024), W(0x0000db974e7d6c84), W(0x000321a1a965bd42),
+     W(0x00066ca6976a5d00), W(0x0005089c64e7ab5c)},
+    {W(0x0000000000000001)},
+    {W(0x0000ca4bd6aeda79), W(0x000473ea42dc9531), W(0x0007fe7f80a57f38),
+     W(0x0004d76a3a81423d), W(0x00059039b92c22ef)}
+  },
+  {
+    {W(0x0002f23e6c2cf260), W(0x00073a5b6f786f59), W(0x0006aa7b5412f9dc),
+     W(0x00071c35503256dd), W(0x0002ef4c98d92f26)},
+    {W(0x0002ee18a98fb484), W(0x0001996de27e0e48), W(0x0002a50613af1050),
+     W(0x00025fc74b022929), W(0x0005964328484161)},
+    {W(0x0000000000000001)},
+    {W(0x0004a7021d543abe), W(0x000152d9b4a250e7), W(0x0003a82d3ad6200b),
+     W(0x00005ab5d88a4941), W(0x0001bbbbde9440ff)}
+  },
+  {
+    {W(0x0001069364eb531e), W(0x0004916d7fa8eae2), W(0x00031212de2e49b9),
+     W(0x0007213df83009eb), W(0x00034800b0888e4b)},
+    {W(0x0001bf66033cdd3b), W(0x0007870ba5dd8621), W(0x0003f96a98696401),
+     W(0x00058e1f48c64ee4), W(0x0000372c04b3331c)},
+    {W(0x0000000000000001)},
+    {W(0x0003c6b06757cbfb), W(0x0006915fcbdebcd3), W(0x0004b7c5f73f10f0),
+     W(0x0006d4b1ea9693f3), W(0x0007b989cabfb06c)}
+  },
+  {
+    {W(0x00076d7c12498925), W(0x0007cf4c76b841b7), W(0x0005e6d69c0b2e1d),
+     W(0x0001c735084f8006), W(0x0000a7e1054ee35c)},
+    {W(0x0002fffa3ed9ec88), W(0x00065d4bae43b328), W(0x0005d848cb246f59),
+     W(0x0006a84a08acf90f), W(0x0006149784eab7b3)},
+    {W(0x0000000000000001)},
+    {W(0x0006a820690960ed), W(0x00035f1369c17a92), W(0x000389b9afc5e436),
+     W(0x000536ecfcc55496), W(0x000112cdfe95685a)}
+  },
+  {
+    {W(0x00026bae1a3e1bef), W(0x000129d513684ac7), W(0x000211baa1ce6b6b),
+     W(0x000780b49d9373f8), W(0x00052bbc9e782459)},
+    {W(0x0007424ef9074d2e), W(0x0002916cb9615497), W(0x00065a15af492169),
+     W(0x00026b62b54dabe7), W(0x0004a299f2a80fb4)},
+    {W(0x0000000000000001)},
+    {W(0x0005fc6aa48f664e), W(0x0002f835b72a47fb), W(0x0007c6f39746c3d8),
+     W(0x000552b231b37aa5), W(0x0006ef0b9170f909)}
+  },
+  {
+    {W(0x000623ca0523cf9e), W(0x0001c6db1946fc86), W(0x00042ad9216027fd),
+     W(0x00068e3caee525e6), W(0x0001a450816fa233)},
+    {W(0x0000a38c0abacef5), W(0x0006ff6e7a303e3e), W(0x0001752e24e875f3),
+     W(0x0005aca9fc18167c), W(0x00007ced088df2fb)},
+    {W(0x0000000000000001)},
+    {W(0x0005eba888822210), W(0x000352c97b662fed), W(0x0007468b66e3faef),
+     W(0x000759fc7969d67c), W(0x0003448ead5b270a)}
+  },
+  {
+    {W(0x0002ba6ec42b7ffa), W(0x0004a5e3e9f2e117), W(0x0003d51db1a4857e),
+     W(0x00001c7e51259296), W(0x00027f63e2743def)},
+    {W(0x0001da026bb079d4), W(0x0005541f86d3f1eb), W(0x000216d4f9086952),
+     W(0x00039ffaf7a28c64), W(0x0003a12c4565ba23)},
+    {W(0x0000000000000001)},
+    {W(0x000639d5ce1a296f), W(0x0002bffbac8f3e4e), W(0x0003d6d3e784f626),
+     W(0x00037a92f41f8aad), W(0x0000c3f088e7c7f2)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0003797b55a7ca46), W(0x00021dbeccab595e), W(0x000194ab1391ec51),
+     W(0x00031153e57cf14f), W(0x00031a75b21cb532)},
+    {W(0x0000bd0826c5d790), W(0x0003c6386b0c6a76), W(0x0007e29a445519d5),
+     W(0x000417c432840d17), W(0x00077006e7cf1049)},
+    {W(0x0000000000000001)},
+    {W(0x000677785ffcd825), W(0x00041d31d7166a32), W(0x00057e0f9b0e08ad),
+     W(0x0004a014e571dbe8), W(0x0002deec17b9e934)}
+  },
+  {
+    {W(0x00014ef609612181), W(0x0000ee6c2c7dd25e), W(0x0007252d0839531e),
+     W(0x0003bac8bf5c68a3), W(0x000507fddb828993)},
+    {W(0x0007d65dbec08f89), W(0x000759d033be1413), W(0x0001e35eed6261ec),
+     W(0x00078cba78899fe4), W(0x0005ffa5d8998f8d)},
+    {W(0x0000000000000001)},
+    {W(0x00022ce0dbc03aca), W(0x0001c2b10bada2a1), W(0x000784e3e955066e),
+     W(0x000742bf83c84c4e), W(0x00014bbe3854441c)}
+  },
+  {
+    {W(0x00001f479485359e), W(0x00015db09a04c2b2), W(0x00049e19098fde02),
+     W(0x00004e6e2c3afa6b), W(0x0001ffd35207e22c)},
+    {W(0x000370ba976f0e68), W(0x000682417ca1d477), W(0x0007439be11f728b),
+     W(0x0007234cd419b611), W(0x0000f4876ba440f6)},
+    {W(0x0000000000000001)},
+    {W(0x00042ca48cdf2d86), W(0x0004b59d46c09287), W(0x0004822f53846cd7),
+     W(0x0003719ef3ad230b), W(0x000120ea52e02ce2)}
+  },
+  {
+    {W(0x000259e237612aa3), W(0x0005c86c9744e1c2), W(0x00047a91e5a50b02),
+     W(0x000257fc758ac594), W(0x000247ab53368a2d)},
+    {W(0x0004ab1bdd33192c), W(0x0005685f0476003d), W(0x000000b4f7aa2018),
+     W(0x0007769c26a2bc15), W(0x00033cbed49442e2)},
+    {W(0x0000000000000001)},
+    {W(0x000196c6586061c3), W(0x00027de3ec745ebb), W(0x000324c11aaa0ddc),
+     W(0x0007b7c04b2ffaeb), W(0x00028f1e38e971f0)}
+  },
+  {
+    {W(0x0000f416161e29e6), W(0x0001d19c460b6b1d), W(0x0006f05a107d75da),
+     W(0x00004908a344d958), W(0x00074482eecc00ce)},
+    {W(0x0007767c132c9fef), W(0x0006e90e62ec6513), W(0x0006d50bfc0ee2d2),
+     W(0x0001b7c1c49948a8), W(0x0005ca360ee533ee)},
+    {W(0x0000000000000001)},
+    {W(0x0005723597c13d6c), W(0x0003d4fc4e308dab), W(0x0004824860e8cd76),
+     W(0x0004dc603bae8306), W(0x0002a4ceab74b425)}
+  },
+  {
+    {W(0x0002dd3f90947ae0), W(0x0006afbab52cf849), W(0x000594d4e9b5abd2),
+     W(0x0001bae5ab766a84), W(0x0001cbd5594baa90)},
+    {W(0x000623ff0adf2a82), W(0x00043962cfaf2e30), W(0x0007852c7893c7ea),
+     W(0x0000616e52fc9fe9), W(0x0005bf3a53f63f1a)},
+    {W(0x0000000000000001)},
+    {W(0x0005e115376519a1), W(0x0001b1c5d721da4c), W(0x0003e34d63e359bb),
+     W(0x00029991d86b871e), W(0x00032d52c4a5616b)}
+  },
+  {
+    {W(0x00024a3f95df4705), W(0x0003dcceb8bfe598), W(0x0004bc247d421159),
+     W(0x0003d0fa803fbe4f), W(0x00042db47ab34faa)},
+    {W(0x0002c23e3959a2fc), W(0x000439837696df6e), W(0x000105e760afa215),
+     W(0x00051f5bf3a820f3), W(0x0000a4cfe006ddef)},
+    {W(0x0000000000000001)},
+    {W(0x000545bbb0345811), W(0x0004c9691d6ff42c), W(0x000516426db0f2b6),
+     W(0x00027d78668cceec), W(0x00037677af5195cf)}
+  },
+  {
+    {W(0x0000918f41e868a0), W(0x000574e5d202623f), W(0x0000018682b7bcc2),
+     W(0x0005ae2de76df7c4), W(0x0007300f956c862b)},
+    {W(0x0000a32d82c1603f), W(0x00061c73f3c48b05), W(0x000444fc69382731),
+     W(0x000020d21e038a88), W(0x000116d410aa365e)},
+    {W(0x0000000000000001)},
+    {W(0x000447fe40a5d760), W(0x0007f8324935accf), W(0x000103e698ed04ab),
+     W(0x0000001cd9226179), W(0x0005a1b51ee20ebf)}
+  },
+  {
+    {W(0x0006d8a5b5056475), W(0x00004db3ab457ff4), W(0x00023703f0a4be64),
+     W(0x0005de5e91755f0a), W(0x000330572fe042cd)},
+    {W(0x00079f1e20b1e587), W(0x0003d9b999f7e102), W(0x0004eaa60fbce169),
+     W(0x000328ac747b207f), W(0x00077f99fa910c33)},
+    {W(0x0000000000000001)},
+    {W(0x000483e4131af6ee), W(0x0005e74ca8ef0f2d), W(0x000519db4e19f45d),
+     W(0x00000b48127dfab7), W(0x000290aecfa34e37)}
+  },
+  {
+    {W(0x000674f769e36950), W(0x0001e262284d63a0), W(0x0004a60f16e501c5),
+     W(0x000599f28b49de62), W(0x00021e1292cd4b69)},
+    {W(0x0002b97c7421ae95), W(0x0000050a3cd8f5c4), W(0x000251fc69372deb),
+     W(0x0004b0010081176a), W(0x0005069aae17ecb9)},
+    {W(0x0000000000000001)},
+    {W(0x00067d7277833350), W(0x00022637cb45d97a), W(0x00077a9d6bf638db),
+     W(0x000614e565416081), W(0x00009d92f14c5934)}
+  },
+  {
+    {W(0x000733a2d66cef8d), W(0x0002873b1fd1954a), W(0x0006615121ed32a0),
+     W(0x0000f91fc1b47354), W(0x0005b1c88f64ef88)},
+    {W(0x0006986226cad287), W(0x00050fe9b8adcf63), W(0x00024490ba0e9ba1),
+     W(0x00008d36589afdd9), W(0x0001affab5e2a302)},
+    {W(0x0000000000000001)},
+    {W(0x00026f8d5ee6915e), W(0x0006008ae4ea966d), W(0x0004e99691c7ee68),
+     W(0x0007efa166a71508), W(0x0000f383360a0731)}
+  },
+  {
+    {W(0x0004b3dec7f48081), W(0x000285942b207bb0), W(0x0001f514bf77540f),
+     W(0x0007eb4415ad7d5b), W(0x0000d86076d63e73)},
+    {W(0x0007e3cc333b6aea), W(0x0003f00b2cd0039c), W(0x00043ed02ee759b9),
+     W(0x00070fb78b7e4220), W(0x0005e12a0ee31931)},
+    {W(0x0000000000000001)},
+    {W(0x00035f91681c962c), W(0x0000066ef6e969cc), W(0x0000bfeadf101a5c),
+     W(0x00054556cd5c2536), W(0x000229f4c64d9127)}
+  },
+  {
+    {W(0x0005308c6643273a), W(0x000456bd68f6969a), W(0x0003165a3dca9213),
+     W(0x00044ae143c800fe), W(0x0003da85ae41f0b9)},
+    {W(0x00008be533573edc), W(0x00016e09e4dcd3e3), W(0x0005e1f17fb45b85),
+     W(0x000493a6b326e498), W(0x0003059af8bdca9c)},
+    {W(0x0000000000000001)},
+    {W(0x0006b3d84edf734f), W(0x0006ea5de904449e), W(0x0007b87ba73c24d3),
+     W(0x0002dd57ed530d77), W(0x00065db5a6987e89)}
+  },
+  {
+    {W(0x0001b872f53d130a), W(0x0005a22e6f2308bf), W(0x0000887fcf7f52ac),
+     W(0x000490efa7836bc0), W(0x00020f104973b956)},
+    {W(0x00002ea571be2244), W(0x00008a83c58fd94d), W(0x0001f53699401cef),
+     W(0x000197ff20d746c8), W(0x0005865ba9d82427)},
+    {W(0x0000000000000001)},
+    {W(0x00015946335290be), W(0x00034b70ad292034), W(0x000605aecf4827bb),
+     W(0x00007dd820e11bac), W(0x00000de7103b9e11)}
+  },
+  {
+    {W(0x0007fb147ee07dea), W(0x0001b308e7fb9132), W(0x0007c6ab248a9aa9),
+     W(0x0002f2c3ceecf956), W(0x000669dd7a155fc0)},
+    {W(0x0002457ba29ae0b6), W(0x000736a87b707a66), W(0x0005094d94c6887e),
+     W(0x0005cf6c628d6c7c), W(0x0000155b46439d9e)},
+    {W(0x0000000000000001)},
+    {W(0x0004bc7f24e4e522), W(0x0002610b31c9fe61), W(0x0003da4a27361009),
+     W(0x000068a8f167fa71), W(0x0001d4252a33f43c)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0003945652014031), W(0x00031dca5551450b), W(0x0002aad73634142b),
+     W(0x0005fbc3dbd51c17), W(0x000543d84cb04fb2)},
+    {W(0x00032ba4de59ef20), W(0x000293485d85cdd2), W(0x0000ac9d611bd0b7),
+     W(0x00024f349ec1c78c), W(0x0000358fdc5b63ed)},
+    {W(0x0000000000000001)},
+    {W(0x0007264a03982220), W(0x0003bbe31ab4fcb8), W(0x0003803239a9578a),
+     W(0x0001361e4d03539e), W(0x000045a56cc3f4b7)}
+  },
+  {
+    {W(0x0000e1fb4f605ea1), W(0x00068129eaa3ed4e), W(0x0000060718d8ce56),
+     W(0x00025a521392830c), W(0x00002ac4c0386a42)},
+    {W(0x00074860d7de3877), W(0x0004aa9ff50e9e00), W(0x000487eddffd0cc3),
+     W(0x0002f23583d97f83), W(0x00001a36c19fc30e)},
+    {W(0x0000000000000001)},
+    {W(0x0005551a500be480), W(0x000636985d007050), W(0x00059c2be51d679d),
+     W(0x0002349ed6864d33), W(0x000234e14931e343)}
+  },
+  {
+    {W(0x0003a6db62a039e9), W(0x0007947312005e76), W(0x0000b93d668de230),
+     W(0x00074f0a829607a2), W(0x0002d2dd667a240f)},
+    {W(0x0000791506554dd1), W(0x00022b97071b6edd), W(0x0006fc323592bbf4),
+     W(0x00042913dd36a31c), W(0x000377bd9db79c5d)},
+    {W(0x0000000000000001)},
+    {W(0x00000c4b30e63981), W(0x0004b76b2079ba8c), W(0x00025d24e32a5d8d),
+     W(0x000702584d356bf5), W(0x0004c799521ae006)}
+  },
+  {
+    {W(0x000283d3ac2cc513), W(0x000014a0bee52f90), W(0x00075bd156187ed8),
+     W(0x0005cdb2e84c8617), W(0x0002816f8430d466)},
+    {W(0x0001b17e74b47f1e), W(0x0000cc956b4309f1), W(0x000319ab821d177c),
+     W(0x00051c1a92648778), W(0x0005452c4b45430e)},
+    {W(0x0000000000000001)},
+    {W(0x0004039e4bb35752), W(0x00043d10ed4a847d), W(0x0000f3a80964e003),
+     W(0x000435d9272dbac6), W(0x000464a3c75fd0d8)}
+  },
+  {
+    {W(0x00046a6fba4bbef3), W(0x0007f7379b4035b8), W(0x000582fec791fd1e),
+     W(0x0002d67d8ac3c282), W(0x0001caeba6f06a2c)},
+    {W(0x00056a7be98d85b8), W(0x000018d77ab3a72c), W(0x0000977146a47b06),
+     W(0x0002bba507e77aa1), W(0x00065fcdc11e7ea7)},
+    {W(0x0000000000000001)},
+    {W(0x0006f393ba689749), W(0x00053abe60e56f32), W(0x0003453c96232737),
+     W(0x0003d9c16193ea5b), W(0x0002176013a4fcc3)}
+  },
+  {
+    {W(0x0000f5d51935a5c7), W(0x00004a699191958a), W(0x000374259f1ae7a4),
+     W(0x00077a6462756390), W(0x000060c2952bf5ad)},
+    {W(0x00004b4205427f5b), W(0x000636039548e695), W(0x00007ef77cacb315),
+     W(0x000124bbe329edd8), W(0x00010ef5d4944825)},
+    {W(0x0000000000000001)},
+    {W(0x0000db40cfce84b6), W(0x0001f3c964781cfd), W(0x000197fada71d8c4),
+     W(0x0006ce479e17af52), W(0x0006db3fc3417d36)}
+  },
+  {
+    {W(0x000537b4701f0c00), W(0x00022b2dd12588b4), W(0x0001d947e640b8d6),
+     W(0x0004aa8b50afee60), W(0x0005d41698923f4e)},
+    {W(0x00064780eef8bc11), W(0x00064fba820ef8a6), W(0x00060a63f7922bb8),
+     W(0x0001745f6d6f5785), W(0x0002d92794a28e9f)},
+    {W(0x0000000000000001)},
+    {W(0x0003a9406d690b66), W(0x00010a8a9ffa469b), W(0x0000d7c767e1e086),
+     W(0x000642ef970f976d), W(0x000035d5103f2785)}
+  },
+  {
+    {W(0x000489c13fdc9fe9), W(0x0007f2183c84ee88), W(0x0007d337b8f29d2b),
+     W(0x00040b31bfca128e), W(0x0000cc495fe64bc4)},
+    {W(0x000606036e75198b), W(0x00027c71834ded4b), W(0x00050deae783c8a3),
+     W(0x0003bf7f6069f334), W(0x00042138e7b6cab9)},
+    {W(0x0000000000000001)},
+    {W(0x000464e4dbb7e189), W(0x000153c4db078639), W(0x0001c441fd6d5b5c),
+     W(0x000083c104268acd), W(0x0003d0ac8da66332)}
+  },
+  {
+    {W(0x0000a6163eb04ed1), W(0x0000baa8012fbdbc), W(0x00052bd00b542f37),
+     W(0x000027cd7a34bef3), W(0x0007cba22b2bde74)},
+    {W(0x0007e22988898da2), W(0x0002830bc1aa97a4), W(0x0004c4c011fb6736),
+     W(0x0004d3079172cdf9), W(0x00020c0b2c840b27)},
+    {W(0x0000000000000001)},
+    {W(0x00038da5f1cbc052), W(0x000021c307d9db9e), W(0x0000568ae5228119),
+     W(0x0002a88dfde007a5), W(0x0004536d78764a1c)}
+  },
+  {
+    {W(0x0000c5d409763edc), W(0x0004d8c661a6e5eb), W(0x000621641e06b2b2),
+     W(0x000415219ad02995), W(0x0006f07828ad18b3)},
+    {W(0x00005809beba5303), W(0x0000aeae98f6faa1), W(0x000605729649e707),
+     W(0x00025cd87a9e2cf5), W(0x0006cb9340e9e966)},
+    {W(0x0000000000000001)},
+    {W(0x0004a85c80f83630), W(0x00038926599d2d9f), W(0x000696a687947b3c),
+     W(0x0007d996ea6c435a), W(0x0006e728c3deb381)}
+  },
+  {
+    {W(0x0006a168b3cdf6e8), W(0x0003b3b163685a32), W(0x00024020197fc54a),
+     W(0x0001480704f15c6e), W(0x00056aa5b95d76a8)},
+    {W(0x00049614e6e2fbba), W(0x0003b672af00c357), W(0x00038f01f0ee5ddd),
+     W(0x0004b54403f16508), W(0x00062e87e66ad785)},
+    {W(0x0000000000000001)},
+    {W(0x000032c815bcc6c1), W(0x0001a23eb53dfbeb), W(0x00063a8d544f40b5),
+     W(0x00039f731e6fb095), W(0x0003d72968f73a98)}
+  },
+  {
+    {W(0x0007fbab3d70cad4), W(0x00044ef981800bcb), W(0x0004d58ab955e3e0),
+     W(0x0007067201e34d7d), W(0x000548789c0c7abe)},
+    {W(0x0000435885aead32), W(0x0007138007dcd637), W(0x0001e7f2736d5a21),
+     W(0x0000de5bafa0fcfb), W(0x0002b531c3620f91)},
+    {W(0x0000000000000001)},
+    {W(0x0005ccf6811a2496), W(0x00020a75e43f905d), W(0x0006ba782097d57e),
+     W(0x00003832345a8b8f), W(0x0006d9bacf960118)}
+  },
+  {
+    {W(0x000096d553dde112), W(0x0001e4b3cfeda9ac), W(0x0003915d8eadced1),
+     W(0x00014e9fc49d24d0), W(0x00058dafce890fa9)},
+    {W(0x0001b8d813aa4ea9), W(0x000228daf70881ed), W(0x00011eb446d8e0a9),
+     W(0x00075f7858fa5f4e), W(0x0001e1851baa6750)},
+    {W(0x0000000000000001)},
+    {W(0x0007510521fbab3d), W(0x000721cff0c95924), W(0x000164ee27d29314),
+     W(0x0007ab53e0bae683), W(0x0000dc58316ad480)}
+  },
+  {
+    {W(0x000303260742656e), W(0x00049b7a3e743d1a), W(0x000253ce3d080fb4),
+     W(0x00019fc466c01fce), W(0x0001e9c3d54fccb4)},
+    {W(0x00002af483c57be7), W(0x00039ab151096787), W(0x0002678e500903a7),
+     W(0x00038050afbec7a5), W(0x000196656ba6f341)},
+    {W(0x0000000000000001)},
+    {W(0x0007fa1d707314a3), W(0x0004913da1fd2c1c), W(0x00074fc3c6661d2f),
+     W(0x0007ac108e919835), W(0x000116f7e99283fe)}
+  },
+  {
+    {W(0x0001555a0fc15d8b), W(0x000549425bc36f02), W(0x00042ff7c78d7a27),
+     W(0x00054e457d0c0d8b), W(0x0002a662719fafbc)},
+    {W(0x0002f10161ef428b), W(0x0004f50e67375b39), W(0x00012bb1586860d6),
+     W(0x00079eb77c844f66), W(0x000254937e925315)},
+    {W(0x0000000000000001)},
+    {W(0x00046f121a666e62), W(0x000697a20fc88c9d), W(0x0005b12093a2f9da),
+     W(0x00021514fa486a12), W(0x00027be670b6a57b)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000144a5a15b205a), W(0x00070c824c604492), W(0x00011f6cb37bd956),
+     W(0x0001bc006185635c), W(0x0000a2818f5f5d89)},
+    {W(0x000246e56c9a1bd6), W(0x00024549d1b2ce1d), W(0x00003eeec52c9885),
+     W(0x000428dd824dd4be), W(0x000187c76a49af10)},
+    {W(0x0000000000000001)},
+    {W(0x00027507fb6b74f0), W(0x00055f1d20834793), W(0x00013724e962aad8),
+     W(0x0007383573521f30), W(0x00066192af262d22)}
+  },
+  {
+    {W(0x0003d7d040f794fa), W(0x000722baa6d0553d), W(0x00018fca2afde8ce),
+     W(0x0005ded62cfa9bd5), W(0x000389973be3632b)},
+    {W(0x00013dd87adab32c), W(0x0001d33b5e9a5953), W(0x0004fabbd2de613e),
+     W(0x000299d2301ac74f), W(0x0004d6bb19304a47)},
+    {W(0x0000000000000001)},
+    {W(0x00044a7574525f3d), W(0x000619b3706be6c2), W(0x00073dfc14fcc57f),
+     W(0x0006e7de5d02a746), W(0x00042e1ea260ad58)}
+  },
+  {
+    {W(0x00065891da49cb23), W(0x0007db1d4a0e7833), W(0x000006bc2664c0ff),
+     W(0x000672c37e449aec), W(0x00055742e80787a6)},
+    {W(0x000231752836ce32), W(0x0005664b2e63bded), W(0x0000135f8eaa08cf),
+     W(0x00040421cf6f3c93), W(0x0000aeabe3f0abb8)},
+    {W(0x0000000000000001)},
+    {W(0x0002c0489ec6975c), W(0x0002f863f9dd5278), W(0x0007b74d1251d746),
+     W(0x0005d1dd17721f07), W(0x00044dedd7c2e083)}
+  },
+  {
+    {W(0x00057b97cda89d97), W(0x00051fbdf4bcf733), W(0x0005f5918b0dad0a),
+     W(0x0004a2e94f648dd2), W(0x00068c0bfb003eeb)},
+    {W(0x0001d3f62c84b7ed), W(0x0002ead0eda48d74), W(0x0007b6b27d89e566),
+     W(0x0001821710c4e4f9), W(0x0004b0ad6be2fccb)},
+    {W(0x0000000000000001)},
+    {W(0x000016baf5cb7bf7), W(0x00036d8f200c0167), W(0x0002406cb0c161e4),
+     W(0x0002a094d05b8323), W(0x00041bca861b52ab)}
+  },
+  {
+    {W(0x00002dfc5cea409d), W(0x00077f09cf714656), W(0x0004ac1d61851875),
+     W(0x000656c9a084061f), W(0x0002be51a50ea193)},
+    {W(0x000069bfe420ee72), W(0x000577b025975950), W(0x0000b30c72416900),
+     W(0x00062a66f3c908d8), W(0x00078798748d168d)},
+    {W(0x0000000000000001)},
+    {W(0x00073e941b982574), W(0x0003910548136b07), W(0x000463e296528799),
+     W(0x0003d3d5abd51a2f), W(0x0007b0862bf9093c)}
+  },
+  {
+    {W(0x00038925ed056139), W(0x00068aa199636bb1), W(0x00007ba11a2801ab),
+     W(0x00066dbb2d6441e3), W(0x0000b4667cc7a19c)},
+    {W(0x00036aada1c2cf53), W(0x0007039bd931f9be), W(0x00039d09dbe23db3),
+     W(0x0002330510b9597f), W(0x000016fe4ebb78f7)},
+    {W(0x0000000000000001)},
+    {W(0x000284c9a6c0b3ee), W(0x000133f7a9a84dd6), W(0x0000f64969ed36ae),
+     W(0x0006e337b0e6b463), W(0x0002f1f7acc9b825)}
+  },
+  {
+    {W(0x0002f681c76f9427), W(0x00027cbd57e3e18a), W(0x0007d9f598dd4d9b),
+     W(0x00026eb6bd4ced0f), W(0x000437e75b0c2e7b)},
+    {W(0x00068f7c552f9074), W(0x000037670e6e8ddc), W(0x0003a33ff0620d30),
+     W(0x000017b09c55dcfd), W(0x000260989be91463)},
+    {W(0x0000000000000001)},
+    {W(0x00076d9b7d773511), W(0x0002978f887ed601), W(0x000788205eb6a410),
+     W(0x0001c57484cd228a), W(0x0003558b1560191f)}
+  },
+  {
+    {W(0x00004dfcbe6b8c22), W(0x0001132eea4dcc4e), W(0x0003f835e95dedfa),
+     W(0x00038eb478c9396e), W(0x0003710538d7cd79)},
+    {W(0x000027ca02778853), W(0x000549151c48bcb5), W(0x0000a8b7ab2862ac),
+     W(0x00006e04991b8baa), W(0x0007d10827db74ae)},
+    {W(0x0000000000000001)},
+    {W(0x00024e1617653ef3), W(0x0003e1955e82fd00), W(0x0006aecca947567c),
+     W(0x0000f030cd2f1ae2), W(0x00032238a57782af)}
+  },
+  {
+    {W(0x000336ae540e17c1), W(0x0002e8aebec7ba87), W(0x0004bf5190e5e551),
+     W(0x0006cc3280341bfe), W(0x0004edfee92956ea)},
+    {W(0x000330cfbe5b5c81), W(0x000209c9c3bc7364), W(0x0000915df179e335),
+     W(0x00016aabf0503305), W(0x0007a5224741218e)},
+    {W(0x0000000000000001)},
+    {W(0x0007224b31342f07), W(0x00003c5bd0eba6e6), W(0x0002b8e887487651),
+     W(0x0002fba2751066aa), W(0x000501d603144dfd)}
+  },
+  {
+    {W(0x0000d962361627da), W(0x0007c242370096b7), W(0x00065092a6fad1ca),
+     W(0x000009dc23947c96), W(0x00037922285a4804)},
+    {W(0x0006d40086ded753), W(0x0001339b4c15e348), W(0x000275b84b1cfc32),
+     W(0x00010adc0dbc21b6), W(0x000185dd60e2fbee)},
+    {W(0x0000000000000001)},
+    {W(0x0005607d2cf6b96c), W(0x00044002d228216e), W(0x000727d941fa1eb2),
+     W(0x00067bfa85a23aa8), W(0x0000a53f8120c715)}
+  },
+  {
+    {W(0x000478a943a0c5ca), W(0x0003ee8965e36ed3), W(0x0001cfd9e3279f1d),
+     W(0x0007763cd57cc0c7), W(0x000200b802a44370)},
+    {W(0x0005b4a9a52eedcc), W(0x000041fdaa7e7465), W(0x000056c01777cc23),
+     W(0x00001c2fc5254e7a), W(0x000461eb4a2b72f2)},
+    {W(0x0000000000000001)},
+    {W(0x0005402fa502b451), W(0x000668e126e87479), W(0x00072303a04f3373),
+     W(0x00008c5d65f24a79), W(0x0003889343f6eee0)}
+  },
+  {
+    {W(0x0003babb9cbd3502), W(0x000184aeeb50cdb2), W(0x000270ab91b63d08),
+     W(0x00001c823ab77946), W(0x000786f29530a34b)},
+    {W(0x000285aeb79fc1d5), W(0x000463feb6c444f1), W(0x0005c6b6dc3e2baf),
+     W(0x000139b9033fb45e), W(0x0003d4b369f74ece)},
+    {W(0x0000000000000001)},
+    {W(0x0000e8167f7765fa), W(0x0007cf7df160c4a5), W(0x0005347e3ddaf3eb),
+     W(0x0007611cbcefc9d5), W(0x00036f49b75c69f6)}
+  },
+  {
+    {W(0x0007b15bb141b7e2), W(0x000198c756a20120), W(0x00063f94a7649113),
+     W(0x0007bf918800fe6c), W(0x00065d027d809aec)},
+    {W(0x00044db018b35ef5), W(0x000211fe9e6daabe), W(0x00011a3a8b64ee27),
+     W(0x00025c6dc9cdc92a), W(0x0002e6886016f272)},
+    {W(0x0000000000000001)},
+    {W(0x00030b03ac361627), W(0x0007744b2b0d3863), W(0x00016b794556897c),
+     W(0x000500ee69dd730e), W(0x00055e165f747f8c)}
+  },
+  {
+    {W(0x00040e1a30520f25), W(0x000498859896b3fd), W(0x0002b1ba56230ca2),
+     W(0x00030d0e98781bf6), W(0x00013bf50a15a582)},
+    {W(0x0003ac0f8121b1e7), W(0x000733b1917c4279), W(0x00015df125cd0cce),
+     W(0x0002652943e3af67), W(0x0007d6129c9209c3)},
+    {W(0x0000000000000001)},
+    {W(0x000185e5d2c47292), W(0x0007c57885e0a4ba), W(0x0005fbdf803dd3dc),
+     W(0x0006e713cd8a0fd8), W(0x00078fbbc2be217b)}
+  },
+  {
+    {W(0x0001cb49632e6fc4), W(0x00078c48b8ec6ebe), W(0x00013cdeb964e5e6),
+     W(0x000396e51a790517), W(0x0000df481a9db3e4)},
+    {W(0x000358b3e94dbad9), W(0x00049f819524e1cd), W(0x0005c6211a4178c1),
+     W(0x0002d4db6c4256b2), W(0x0002241b3791d08b)},
+    {W(0x0000000000000001)},
+    {W(0x00074bbf3a03985c), W(0x0001e2630571b3f2), W(0x00057ec4bce0b330),
+     W(0x0006c701171dd3e9), W(0x000769247176e07e)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0004570a141e648a), W(0x0001803372cb9b5a), W(0x000423f8c22efd9d),
+     W(0x000084ebd46a86ed), W(0x0007efb45d3a2851)},
+    {W(0x000018acd0c28cda), W(0x0003b4643a86ca5d), W(0x0005c7e2dde4895f),
+     W(0x0007ab433848e34e), W(0x0000fe1198b11a1b)},
+    {W(0x0000000000000001)},
+    {W(0x00016b61e8ac6200), W(0x000114bd44f6ac84), W(0x0006074058795c06),
+     W(0x0005d1eaf5ca51ce), W(0x000437eeafeefe29)}
+  },
+  {
+    {W(0x0006918f2c983218), W(0x00079e7d519e0255), W(0x0006cbb5a79176e4),
+     W(0x0006290b675e8c23), W(0x0005d5225a5e2235)},
+    {W(0x0006bc4e5de7b1b9), W(0x0003304ef028177d), W(0x00056eafbb1ad6ac),
+     W(0x0006c69a454931b5), W(0x0007ec9e5494feec)},
+    {W(0x0000000000000001)},
+    {W(0x0001a128ca0e3484), W(0x0001dda2fbc04a39), W(0x000683602f169a70),
+     W(0x0004790972a8ffe7), W(0x0000ab9bfbedf022)}
+  },
+  {
+    {W(0x0002c3cd228bac21), W(0x00075bd7af0bdd33), W(0x00042505d6feaeb6),
+     W(0x0007d8493ed22c62), W(0x0006db3c0d1a1f27)},
+    {W(0x0006ba7775d04f62), W(0x0005f25b171aeeee), W(0x0004713b58f4d261),
+     W(0x0006d9f89747f807), W(0x00007b499ecb9b1b)},
+    {W(0x0000000000000001)},
+    {W(0x0006100faa8dbbe4), W(0x000145934997b839), W(0x000471b9cc9e8582),
+     W(0x0007a9d8806c2c83), W(0x00057ad664a77ea9)}
+  },
+  {
+    {W(0x00031d729a2e5760), W(0x00011184866b0dcd), W(0x000621aa263918e5),
+     W(0x000304995ab111a8), W(0x0006fde98f557e33)},
+    {W(0x0003f94a48002c8b), W(0x00022b7caa4d30eb), W(0x00027380949796c7),
+     W(0x0000055cf42209e1), W(0x0006994510fbdad7)},
+    {W(0x0000000000000001)},
+    {W(0x0007085430611bf2), W(0x00028f3a485ecef5), W(0x00073205d7a748e7),
+     W(0x0007cef1244339b0), W(0x0003c86b1f74ef30)}
+  },
+  {
+    {W(0x00007c406ee8b4d5), W(0x00063523e0ec80f6), W(0x000351753f66f657),
+     W(0x0007defd1a2bfc27), W(0x00073d4d9f5b9708)},
+    {W(0x0007c7fcc669e516), W(0x000566599c6e6d42), W(0x000340dc5ac83e94),
+     W(0x000705432ef8d351), W(0x000256e14cee7d41)},
+    {W(0x0000000000000001)},
+    {W(0x0006384331e497c9), W(0x000750d2955b3177), W(0x0007b0f693890621),
+     W(0x0002763a46b78f53), W(0x0000109cb575a611)}
+  },
+  {
+    {W(0x000743a6a211a8a9), W(0x0002642651606a17), W(0x0006efee68a8553b),
+     W(0x00030981d95b51e5), W(0x0005c3370c184b6f)},
+    {W(0x0006d7269a0ad07e), W(0x0003272066270fce), W(0x000446ac441625b7),
+     W(0x0002002e9ad522ee), W(0x000292a52d9e9332)},
+    {W(0x0000000000000001)},
+    {W(0x0005c324ca268214), W(0x0002d3ed16ae3a37), W(0x0000564333fcb486),
+     W(0x00061d2ce2338a0e), W(0x0002fe5b430cbe27)}
+  },
+  {
+    {W(0x000709f014389c99), W(0x0006e87f6da81f17), W(0x00068bd2434ed7c8),
+     W(0x00055b78a638645e), W(0x0000f9df8eef9562)},
+    {W(0x0002674eb33be730), W(0x00000e86052ddbb3), W(0x0003d3210ad427b9),
+     W(0x0007f21ba8dbad29), W(0x00042ddc05b73970)},
+    {W(0x0000000000000001)},
+    {W(0x00052b9dff864991), W(0x0003193d8834bda7), W(0x00037dbe599cd6eb),
+     W(0x0007c573ad249584), W(0x0006afb9ba912798)}
+  },
+  {
+    {W(0x00042d25a9abdca2), W(0x0007dce106606bf5), W(0x0004e96cf0da57f9),
+     W(0x000416ca8e4102e9), W(0x000705bd9027e77d)},
+    {W(0x0006cd670c1bfec2), W(0x00073c0591ca3c1a), W(0x0006b529073fc221),
+     W(0x0001d0ca65236a11), W(0x0001417fa0628ebc)},
+    {W(0x0000000000000001)},
+    {W(0x0002140e4ba65833), W(0x0005335fd8491ac4), W(0x000659254d4e1667),
+     W(0x0006a76673fb4e07), W(0x0004b41a2671f969)}
+  },
+  {
+    {W(0x0002af6608614287), W(0x00041d435b5898f2), W(0x0002c8c46393545b),
+     W(0x00001601bde877eb), W(0x0001736346816a90)},
+    {W(0x000008a35d9f366f), W(0x0002db8c5f65ce25), W(0x0000caf8da13ca52),
+     W(0x0001e3c942a065e8), W(0x0000631dad7ace47)},
+    {W(0x0000000000000001)},
+    {W(0x00046e7ba58d7abe), W(0x000315e827f8172f), W(0x0003f40f297a8dd4),
+     W(0x00030b4c552b5979), W(0x000372662d9dd450)}
+  },
+  {
+    {W(0x000251d639207673), W(0x0002ad170852a86e), W(0x0005db0dcc3038d1),
+     W(0x0003640abcea3801), W(0x0001c4f1cfa7b49b)},
+    {W(0x00007c8af8a4de24), W(0x0001a84c0f94c11c), W(0x000638a0b6b58309),
+     W(0x0001b0c28fe8220d), W(0x00064618811c799c)},
+    {W(0x0000000000000001)},
+    {W(0x00013d7eb0556e8b), W(0x0005bec496e78576), W(0x0001a43227ea3371),
+     W(0x0003bfe40fc6823e), W(0x0004ae807d932a11)}
+  },
+  {
+    {W(0x000467b908ffc1e4), W(0x00067fcbc71d7dd3), W(0x000243cafbe3cbec),
+     W(0x000086c727b2da05), W(0x0002bebb8aa5c37d)},
+    {W(0x0004708cee929e56), W(0x0003b13e9a554a16), W(0x000729563dd14db6),
+     W(0x00023cef992960a7), W(0x00078b36c8347230)},
+    {W(0x0000000000000001)},
+    {W(0x000547d4cd96c52f), W(0x000531d438240ad0), W(0x0003c10e2c0973ea),
+     W(0x000303f14f720e61), W(0x00033a0643eaae72)}
+  },
+  {
+    {W(0x00056575b54d63a2), W(0x0003d15924fa72a6), W(0x0005e65cf3095e2e),
+     W(0x0001fede28096c62), W(0x0003a3656f3ddbf7)},
+    {W(0x0005f1746b495738), W(0x000216ce92f03ee7), W(0x0007c6f27f95ef60),
+     W(0x0000e7a13b955b26), W(0x0003d59d19719ea7)},
+    {W(0x0000000000000001)},
+    {W(0x0006f93a494a6d47), W(0x0004640c79c9bc38), W(0x000013e15f265616),
+     W(0x00018606c0781939), W(0x0000e0c4b744953a)}
+  },
+  {
+    {W(0x000777b24a7d17a1), W(0x00022aa3d715a007), W(0x000402c4a5c34835),
+     W(0x00078b9d8919f81f), W(0x000632b5cb00a8d2)},
+    {W(0x0007a35378eccdd1), W(0x000342a76667421b), W(0x00010541ee0cd530),
+     W(0x0001b4bb087ebfec), W(0x00039cc3ac1990db)},
+    {W(0x0000000000000001)},
+    {W(0x000555f2614c5a4e), W(0x000773f213c69ebf), W(0x00067c09d38fde99),
+     W(0x00073e4e22a3b198), W(0x00074d49618755a4)}
+  },
+  {
+    {W(0x00036f263b8ae47a), W(0x0002946d84aa3bf3), W(0x0001064fefcc1504),
+     W(0x000199a6c0e36492), W(0x00040e4a53c9fa12)},
+    {W(0x0007638073f796a1), W(0x000117e10571f404), W(0x000410bb4be191df),
+     W(0x000068937888f95d), W(0x000139c62f94da47)},
+    {W(0x0000000000000001)},
+    {W(0x0006c3702c0eafe1), W(0x000365c01fcf17e0), W(0x0004e2d75cdb3b56),
+     W(0x000199226489275a), W(0x00046c05b4b6cfe7)}
+  },
+  {
+    {W(0x000070b5b3ebf0e8), W(0x00002626141adf5e), W(0x0006bc25d9b8a775),
+     W(0x0006b48fab876f56), W(0x00050bd05cd155f3)},
+    {W(0x0003a31affa6b287), W(0x00079be1e8f94312), W(0x000689fd56cec92a),
+     W(0x0005a4186f41513e), W(0x0000d70e267684db)},
+    {W(0x0000000000000001)},
+    {W(0x0007c3e32616fc18), W(0x000202168ca3d963), W(0x000434b606b5d272),
+     W(0x0007fc2ed4817a6a), W(0x00073a0fe31f9875)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0005fb4b0a70aa7b), W(0x00074119f8b017fe), W(0x0005415277d28775),
+     W(0x00029a7a91bb91a9), W(0x000472e960dd122a)},
+    {W(0x0000d0578932b7cc), W(0x0005153326fc8eb3), W(0x00053f1faeebb6eb),
+     W(0x0007f7a60603bb0a), W(0x00010585d04fc529)},
+    {W(0x0000000000000001)},
+    {W(0x000104158e981460), W(0x0006443f1914a265), W(0x0003977326a4b676),
+     W(0x0003e663099eb33a), W(0x0001014714dd02b5)}
+  },
+  {
+    {W(0x0001a6693dccc58b), W(0x0006eee9b7888314), W(0x00035b2433b21b1c),
+     W(0x000201dc9391d4a2), W(0x0003734c7d50aa73)},
+    {W(0x0001f9ee663e7ef9), W(0x00045b0235bfe513), W(0x00002c343f37159b),
+     W(0x000427d4123e7e35), W(0x000416c8b45805ea)},
+    {W(0x0000000000000001)},
+    {W(0x00048cb67324986d), W(0x000785c81c1848f9), W(0x00050a11fa217cd8),
+     W(0x0007801362f0203e), W(0x0001a50119242a83)}
+  },
+  {
+    {W(0x000502add60372dd), W(0x0002456dd9c3983c), W(0x0006d14eb2a92665),
+     W(0x000755e40e87a9d5), W(0x0003795778e98038)},
+    {W(0x000390e390fed8d3), W(0x000363bc2c37c030), W(0x0002abddf39080e0),
+     W(0x00068c9a6aee749c), W(0x0004ec9ef100bb13)},
+    {W(0x0000000000000001)},
+    {W(0x0002c0caf66c33f5), W(0x0006545c79ea7b2b), W(0x00051bc6ca66f962),
+     W(0x00050bc665f175b8), W(0x0005c71ea464dd11)}
+  },
+  {
+    {W(0x0002778df7ec1eef), W(0x000004206c1b7d5e), W(0x00042dc70d9d7bff),
+     W(0x00031c345020da10), W(0x0003c3c51d3a301c)},
+    {W(0x000342ef4bd6f892), W(0x0007ee45d8895642), W(0x00043809d2f44724),
+     W(0x00028d8d41ce89fa), W(0x0006c161ec4de54d)},
+    {W(0x0000000000000001)},
+    {W(0x0005a93a047050ec), W(0x0002261e013c43cf), W(0x00033a2ee53adc13),
+     W(0x0000c22b7b29d3d1), W(0x000225e47160789a)}
+  },
+  {
+    {W(0x0005c91a2695838d), W(0x000505e5b0a39235), W(0x00074e8d0b890266),
+     W(0x000276edd66cba33), W(0x00048cfac0adf54f)},
+    {W(0x000483c97b40461f), W(0x00029c3a3be89ade), W(0x0007fdccaf64dc26),
+     W(0x0006a699ecfa67de), W(0x0000d80cffe71646)},
+    {W(0x0000000000000001)},
+    {W(0x00064253db766a9c), W(0x00020b844cdd36c4), W(0x00052616f6a09631),
+     W(0x000696a13b8dd160), W(0x00056eb7c2ad58f4)}
+  },
+  {
+    {W(0x000112f3491ad290), W(0x0005b2993e858762), W(0x00047dcd3edcd947),
+     W(0x000593b2f25fe0be), W(0x00026ec5992dbb02)},
+    {W(0x0006a96e9eb37304), W(0x00078462664a4038), W(0x00011def6058d38e),
+     W(0x0005f51d4df60363), W(0x00047db6adc7e176)},
+    {W(0x0000000000000001)},
+    {W(0x00053ee8c954ac0e), W(0x000720597044e4b3), W(0x0000b6f9da3fd769),
+     W(0x0006e4ad493ffb8f), W(0x00033d9dd8fc2263)}
+  },
+  {
+    {W(0x0005fedc27b91f2b), W(0x0006fd608b819282), W(0x000780e1cdad4496),
+     W(0x000142666edf2373), W(0x0006a4fbbed3e29c)},
+    {W(0x0003ee5933f74286), W(0x0006f522f55e7737), W(0x000697ee6b5e2b9c),
+     W(0x0000df4a294fbd8a), W(0x0006c6310a5d02be)},
+    {W(0x0000000000000001)},
+    {W(0x0005c8649d84e6f6), W(0x00000ec187cb6a81), W(0x000488440d21bc86),
+     W(0x00054c6e1e3e10e0), W(0x0004708bb846c7b7)}
+  },
+  {
+    {W(0x000694aa63e45227), W(0x00058ad8d385187c), W(0x0001db338af6dbea),
+     W(0x0005bc47511393e3), W(0x0002a4ebd1072842)},
+    {W(0x00006104ef23a7ea), W(0x000232d4add92a10), W(0x0004b75c630f2347),
+     W(0x0000c93de5de937e), W(0x00049b857654a0e5)},
+    {W(0x0000000000000001)},
+    {W(0x000197123ce0b614), W(0x0004680928f871e6), W(0x0000f1367ccbccf5),
+     W(0x0005714ac792d36e), W(0x0005683295decb04)}
+  },
+  {
+    {W(0x0004708d9e3e6610), W(0x00009ad63fb31d57), W(0x00013046260e0226),
+     W(0x0001cddf770ec8e0), W(0x000457e5abac96bc)},
+    {W(0x000371e6fdee3a33), W(0x000364d741d3586b), W(0x000230bab125ee66),
+     W(0x000037391baf4b5b), W(0x0000ad1799accb78)},
+    {W(0x0000000000000001)},
+    {W(0x0003bceab533f127), W(0x00079b316a215eaf), W(0x00039370cf0f9587),
+     W(0x0003ed1ba7358e5f), W(0x00070f8f609accf0)}
+  },
+  {
+    {W(0x000061f357df36fa), W(0x0005cff723a482a1), W(0x0004bfeee6ff8bbb),
+     W(0x00067a5446b2644f), W(0x00026ec56e936e6f)},
+    {W(0x00001fa73c3728c7), W(0x00069044f6a75805), W(0x00010d628fe64a32),
+     W(0x0003895fa5439d19), W(0x0001d3a254b2134d)},
+    {W(0x0000000000000001)},
+    {W(0x0001de8768481653), W(0x0001da50e1d86115), W(0x0002c244b826ba97),
+     W(0x00009bd529cddc62), W(0x00009c5168eaa691)}
+  },
+  {
+    {W(0x0001ba7386374d3b), W(0x0007e12601baf6f1), W(0x0000bb2fb4ae7e54),
+     W(0x000716c9feef643b), W(0x0001587e3773164d)},
+    {W(0x000192363ddb182f), W(0x0006b893e29f7893), W(0x0002c873d18af2ac),
+     W(0x0002c20a63c79712), W(0x0004d5a9dd239a22)},
+    {W(0x0000000000000001)},
+    {W(0x0007ebe3858f731f), W(0x00017f3d53f7cfd5), W(0x0006ca74bf89135e),
+     W(0x0002f814234688af), W(0x000473618271ee2a)}
+  },
+  {
+    {W(0x000563ecc33655ab), W(0x000038f4becaa22a), W(0x0007dc2b61e7f97c),
+     W(0x0000687acccc6c01), W(0x00025f528666b540)},
+    {W(0x00015d705da18d7a), W(0x0002aacca61dc4ea), W(0x0006d1d40ef7791a),
+     W(0x00064f0175c4acab), W(0x0006717cba71989c)},
+    {W(0x0000000000000001)},
+    {W(0x0000c2f360fdabea), W(0x000144675220874e), W(0x0004e813d0041a85),
+     W(0x0007f41b42e7b071), W(0x0000692a8d22b896)}
+  },
+  {
+    {W(0x0005261ce975afe5), W(0x0003774213b2a194), W(0x0002f8e7bb55681c),
+     W(0x0007d7c88ddd1aed), W(0x000517c7fab96eca)},
+    {W(0x0005d84f718e3fb3), W(0x00008cd05586c0c5), W(0x000012f6143a2024),
+     W(0x0002453198c64a1f), W(0x000201245ccb7922)},
+    {W(0x0000000000000001)},
+    {W(0x0004abd9cac6ffe0), W(0x00023d2dc3f99844), W(0x000208466468fc91),
+     W(0x00073c8dbebed06f), W(0x00073854100b5f90)}
+  },
+  {
+    {W(0x000398921fad4e13), W(0x00041e2e5e4b2b88), W(0x00059ae15d10a120),
+     W(0x000312122c1a2e75), W(0x0005be5ff9341f84)},
+    {W(0x000061809d71dfcc), W(0x0007db38a2617d14), W(0x0002387f5506605b),
+     W(0x00065239d076b0b1), W(0x00033b7098912710)},
+    {W(0x0000000000000001)},
+    {W(0x000062aacb9c7b1d), W(0x0005ba10d91b9244), W(0x00011ab1a11374e5),
+     W(0x0005297ca9b49ddd), W(0x0000814ed52dfb57)}
+  },
+  {
+    {W(0x0000a7c2b5d1f62d), W(0x0006a690952d3897), W(0x000613c522c5d4bc),
+     W(0x00039319e8b8a8b4), W(0x0000d50aeb2d3025)},
+    {W(0x00032f67cdfe2b5a), W(0x0003afe6e7866794), W(0x0006af5a9c2f30ba),
+     W(0x0006762d21a52aa2), W(0x0007b97e0e869c80)},
+    {W(0x0000000000000001)},
+    {W(0x0006ea6edb01ed83), W(0x00017c2f53ecf89c), W(0x0004055bec5e5fba),
+     W(0x0003405b5d096218), W(0x00049d4a1d8db025)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0006109a9afceb6a), W(0x0003ad4783875b79), W(0x0006b12516f11baa),
+     W(0x0007fbf83e0920f1), W(0x00004892cfff7f94)},
+    {W(0x0006ca461a543130), W(0x000178387c5978dc), W(0x00068fe3bafa05d6),
+     W(0x00009ad3d1928e08), W(0x0003ae2aa25e2555)},
+    {W(0x0000000000000001)},
+    {W(0x0005c188dde15ed8), W(0x0003089ef25d6896), W(0x0005ca4a72d4e1e7),
+     W(0x0001986a5506e3ab), W(0x0002bfc1ba4bfb99)}
+  },
+  {
+    {W(0x0006098a9f1048b4), W(0x0006ee160f5e1f4e), W(0x000098ae114a020f),
+     W(0x000458dd27aee251), W(0x00060c497780d40c)},
+    {W(0x000040c7086cb1d4), W(0x0003aede616bee67), W(0x00041d5d5cbe96c9),
+     W(0x00010427b6510476), W(0x00022fa44ee0eb50)},
+    {W(0x0000000000000001)},
+    {W(0x000301c5ade24705), W(0x000193a9c19b16a4), W(0x00070db2ca405f4c),
+     W(0x00073fe73844395a), W(0x00068203f466ea10)}
+  },
+  {
+    {W(0x00014d528a5f7598), W(0x0005d859b80803a1), W(0x00008cbc81e7f544),
+     W(0x0001dacfa9ef2851), W(0x0007d7225dafd9c4)},
+    {W(0x0005b18d4eebfb4e), W(0x00045fe5df3dbc33), W(0x000431f1a5dccdbc),
+     W(0x00057fd4977b16ee), W(0x00063e030388d50a)},
+    {W(0x0000000000000001)},
+    {W(0x00047689b7199d9f), W(0x0004473240470af6), W(0x0000aaa265615fd6),
+     W(0x00039df009dd14e9), W(0x0002e2823213d484)}
+  },
+  {
+    {W(0x00061904a63f000f), W(0x0001bd716fe62caa), W(0x00014c5a5e251f84),
+     W(0x0003dfd95553c0fd), W(0x000480d816072eb6)},
+    {W(0x000684a8cd33137e), W(0x0005886d75ece3ca), W(0x0006654b005abc5e),
+     W(0x0001dabf39c3ada4), W(0x000552d0f1d6bda4)},
+    {W(0x0000000000000001)},
+    {W(0x00029f4e5b9c675f), W(0x00050c1e7bb68929), W(0x000731f3c382d066),
+     W(0x0005954b8c17982a), W(0x0007be59978e85b5)}
+  },
+  {
+    {W(0x00033f7e95221da8), W(0x0004e0a7caf97d67), W(0x0007d63278c8fd1d),
+     W(0x00061125b15491dc), W(0x000148a7d88b200d)},
+    {W(0x0002dfead4e889b4), W(0x0006aa628cb3c563), W(0x00020f683e3e00ab),
+     W(0x000201e3231a2df0), W(0x0004f4f0b1a20843)},
+    {W(0x0000000000000001)},
+    {W(0x00024320ce9a185d), W(0x0001607a82cb7418), W(0x000767446415985f),
+     W(0x000113a780508ae4), W(0x00071e22f24aa305)}
+  },
+  {
+    {W(0x00033f84ff1f58e9), W(0x0004ad261c396392), W(0x0003e17c51f865d6),
+     W(0x00054ebc546e84fe), W(0x000130130d18b59c)},
+    {W(0x0001894bc50376ff), W(0x0002b38e0b200e13), W(0x0007f9196a244767),
+     W(0x0003a295aaecee77), W(0x00029c224fb2db0a)},
+    {W(0x0000000000000001)},
+    {W(0x0005cfcc804b5636), W(0x0004daa371dc3b5c), W(0x000245b2050b5d52),
+     W(0x000239ac84c87c2f), W(0x0005594399156930)}
+  },
+  {
+    {W(0x000038d46484879b), W(0x0002976e11fab93f), W(0x0007d53cbbd946f5),
+     W(0x0001bfe5c9fdf184), W(0x00036c2e3fa23db3)},
+    {W(0x00013ce53eeb864d), W(0x0004e4f0eeaf8fbc), W(0x0003bc3ac9f0bc22),
+     W(0x00069ac3e8c9a214), W(0x0000c5c488542844)},
+    {W(0x0000000000000001)},
+    {W(0x00036b8f43d81685), W(0x0006656aa9137ae5), W(0x0001b16ac3306b17),
+     W(0x0005fa99c8159b38), W(0x0004fcfa1f7f8382)}
+  },
+  {
+    {W(0x000482ac0bf80638), W(0x00051efc120572f8), W(0x0002419a0021b2ae),
+     W(0x000278fc16937ba3), W(0x000378e98824a6bc)},
+    {W(0x00023fd4b8eeb48e), W(0x00068ea7a15c0376), W(0x0001ee4b123a88a0),
+     W(0x000698dc36b7307f), W(0x000114214780d621)},
+    {W(0x0000000000000001)},
+    {W(0x00059fd157be00a9), W(0x000045eaf2ac0d10), W(0x0002c235eb610b2e),
+     W(0x00079e6ada8ee73a), W(0x00043beea412351a)}
+  },
+  {
+    {W(0x000460d8da54f6be), W(0x0006b9402e9543e2), W(0x000779c34faaf43a),
+     W(0x0003d47fa843d1c6), W(0x0003b25a392072fb)},
+    {W(0x0006a2e535311a95), W(0x0006b4b2cb19fc32), W(0x000390d07dd0278c),
+     W(0x0000598ea3d1824d), W(0x0005147c779a2db1)},
+    {W(0x0000000000000001)},
+    {W(0x00060bbd17787a41), W(0x0007a5c6f117cebd), W(0x0005d8fcc1c7f018),
+     W(0x000716c273b4a77e), W(0x00057c5ec994c869)}
+  },
+  {
+    {W(0x00020c9a36629983), W(0x0007579bc4e66c48), W(0x000420aea0af0576),
+     W(0x0005d5e2e5b4350b), W(0x0007f3b4e6a9cb47)},
+    {W(0x00040f8536cfee5a), W(0x000682f17629ffb2), W(0x000087bc5157b07e),
+     W(0x00003e3d0e805c28), W(0x00027ac6725aa02e)},
+    {W(0x0000000000000001)},
+    {W(0x0006e16b52148129), W(0x0003048db1439dfd), W(0x0005cf9c7ed0f22b),
+     W(0x0007e83dd230258a), W(0x0002eb3f00f19dfe)}
+  },
+  {
+    {W(0x000575ddff9e415b), W(0x00065067ffeb12f7), W(0x00014bd68a0b9d96),
+     W(0x0007d1fe00f5a445), W(0x0001892461e490ab)},
+    {W(0x000441ef5d1baacf), W(0x00047a151c914832), W(0x000138d93496fded),
+     W(0x00042c7a26000ab6), W(0x000713e476b399bb)},
+    {W(0x0000000000000001)},
+    {W(0x0002110b5c5010b0), W(0x000556a2ffb3cfe8), W(0x0003ec9f79632cc7),
+     W(0x00072ff96eb39374), W(0x00038680fc4f4496)}
+  },
+  {
+    {W(0x000514fa0ddf3ec6), W(0x00000fe52e488af0), W(0x0006ae3200ab9e46),
+     W(0x0001a55cd9577f37), W(0x0006c3908b1a69e7)},
+    {W(0x0001cfea3785e2cc), W(0x0007c4ce6d2d453f), W(0x00026a00390eb0f5),
+     W(0x0002c30ac4fff964), W(0x00046dac0936683c)},
+    {W(0x0000000000000001)},
+    {W(0x000621c59ce6322c), W(0x0002fc5222532352), W(0x0007c24d5f933f03),
+     W(0x00071dbff0a1fc91), W(0x00077cba1a2b6e47)}
+  },
+  {
+    {W(0x00013ff1b9f8ee3e), W(0x0001f8b2ecb83c4f), W(0x0007c5c457c39367),
+     W(0x0001df7bdfcea376), W(0x00065fab20906a03)},
+    {W(0x00079d98399dfd2c), W(0x0007037e23c351e0), W(0x00036d072d6039a8),
+     W(0x0007bd4cd2cc8508), W(0x0006f92cc6af8c19)},
+    {W(0x0000000000000001)},
+    {W(0x000770cb145beb66), W(0x000695f8bbd579ec), W(0x0006551f35529fe5),
+     W(0x00034661fa74032d), W(0x0001bf75c4e358f5)}
+  },
+  {
+    {W(0x0001cc0547191540), W(0x0002a2c03b5b53ed), W(0x000237f6d3bbe8fe),
+     W(0x000538923f9d3d07), W(0x000318cba0299b51)},
+    {W(0x0001a67bc9776c54), W(0x0003e86f4e0ac776), W(0x000085ab8da8a143),
+     W(0x00056bbe7d83e785), W(0x0001cfd9d75b106d)},
+    {W(0x0000000000000001)},
+    {W(0x00000696e853c62c), W(0x00040346f4d17fff), W(0x00017510dd02e646),
+     W(0x0004808d1d056d76), W(0x0001b099bbcafe7d)}
+  },
+  {
+    {W(0x00047689366d5319), W(0x0004489ddd4dce34), W(0x00004340bd8c6ea9),
+     W(0x0006150f8f7c44d1), W(0x00041bc0ff1e1a3f)},
+    {W(0x0005fde75f335abc), W(0x0004e011b16bd668), W(0x0001ac2ec8c5f21c),
+     W(0x00047d527dfa77a1), W(0x000359e4e16c7649)},
+    {W(0x0000000000000001)},
+    {W(0x000255d620f1d326), W(0x0007725b291ef1f9), W(0x0001c657d8c0d804),
+     W(0x0007a6dfa1fcdcf1), W(0x0006d8771649af9f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0001739b04d8a85e), W(0x000157ee61bb9939), W(0x0006707c63fdcc28),
+     W(0x000692c1f8e35528), W(0x0002401d311a3abf)},
+    {W(0x00045e62387ee34d), W(0x00050076aa65776c), W(0x0004c80d68afcb11),
+     W(0x00070d70cd20a54c), W(0x000653224f3488ca)},
+    {W(0x0000000000000001)},
+    {W(0x0000bd597f354d2a), W(0x0005e60d2d335c61), W(0x0003a48ddff0dafc),
+     W(0x0000a50379951b20), W(0x00073f53ff77b5b4)}
+  },
+  {
+    {W(0x0004ea8c3aaddde8), W(0x0005be4e7cb6567e), W(0x00043032c7b6fe2f),
+     W(0x0003742400f895fd), W(0x00072964d278e032)},
+    {W(0x000526c9603b09c8), W(0x0007743a939e4f89), W(0x0001d910cc130898),
+     W(0x0001062108dd811e), W(0x0000eb4ace1c6b72)},
+    {W(0x0000000000000001)},
+    {W(0x0001e01b80f8db61), W(0x000607db81e32f77), W(0x0006e98724b6e7ac),
+     W(0x0000d824226cc202), W(0x0005806cb6deff2d)}
+  },
+  {
+    {W(0x000067deefe7856f), W(0x00074f7c0b57ff86), W(0x0006158975ad50a9),
+     W(0x0004b0f6440b7c50), W(0x0004d432defb596b)},
+    {W(0x0004cfe4cc33317c), W(0x00031a2ee8f01fed), W(0x000481fe625da7a7),
+     W(0x00041384278e8eab), W(0x0000c21c6405735c)},
+    {W(0x0000000000000001)},
+    {W(0x0000591bddffc8db), W(0x00066c29814eb3ef), W(0x0002dc634def2bcc),
+     W(0x00035dcc0101229b), W(0x0007869cc72082a2)}
+  },
+  {
+    {W(0x00078e42fa9b8ed2), W(0x0001549f30d8f1fb), W(0x0007b2fc867401c3),
+     W(0x000286c62c18312b), W(0x0005aa06a8b5ddb3)},
+    {W(0x0001dd200d7c58c1), W(0x000312e7712be4c2), W(0x000388cb7f8e2fe1),
+     W(0x00071bd2f933ec7e), W(0x0007920277cec6d1)},
+    {W(0x0000000000000001)},
+    {W(0x0005bc011d2e532d), W(0x0005c951037f91cb), W(0x0007832d2c4f3965),
+     W(0x000039ff81da2a66), W(0x00042cea208453d9)}
+  },
+  {
+    {W(0x000550489174f306), W(0x0003b2146a89ac6a), W(0x0003c577d97c7d2e),
+     W(0x0003aa9d38a72ba3), W(0x00028939b072bd79)},
+    {W(0x0004a3a6d0464739), W(0x0000f3c2b89e28fc), W(0x00073f05f8be52d3),
+     W(0x0006a53db6903a78), W(0x0003cb9e38efb1c2)},
+    {W(0x0000000000000001)},
+    {W(0x0000753a84347b96), W(0x000525d6714caa71), W(0x0005e59add07d90e),
+     W(0x000439b335015b94), W(0x0002ee1ad7c29432)}
+  },
+  {
+    {W(0x00024785586ed548), W(0x0007d0bbf01c3a56), W(0x0000ad60aaed1402),
+     W(0x0003c46f811c225c), W(0x000019016d685cef)},
+    {W(0x00007350de91d3e0), W(0x0002aa93025229b3), W(0x00043d7b7c0aec8c),
+     W(0x000644fcae6580d5), W(0x0007eb956ee0ab30)},
+    {W(0x0000000000000001)},
+    {W(0x0006b3dbe7b8c58c), W(0x0002fa999dd632ca), W(0x000150cc73ebf055),
+     W(0x000278637a24f4f2), W(0x0002d192f6f09cad)}
+  },
+  {
+    {W(0x0003316c55e0f8df), W(0x0005fdc304ca80f7), W(0x000064c9680702ea),
+     W(0x0002c912a13eeb5d), W(0x00035c57daf7d769)},
+    {W(0x000435c18d436fbc), W(0x0007b8af9065b9b6), W(0x00053e764f406740),
+     W(0x00062b5c1c6d93eb), W(0x000471cc91dcfe02)},
+    {W(0x0000000000000001)},
+    {W(0x00006fed33cd0dd4), W(0x00014e10fb8a7a36), W(0x000390b6940f261c),
+     W(0x0007654930e9aca7), W(0x0002f42ed2999b2b)}
+  },
+  {
+    {W(0x00034595fac0e9d0), W(0x000284af259e32c4), W(0x0000d8b110510338),
+     W(0x0005ab5bab31eca8), W(0x0000ebb89efa79e3)},
+    {W(0x000482cc0adc7fce), W(0x0001ae9d0e2f0143), W(0x000530469c3cc006),
+     W(0x00047c06d3eb9c6f), W(0x0000e5f7b8000524)},
+    {W(0x0000000000000001)},
+    {W(0x00049ad374b38ad4), W(0x0002e130e6d1729c), W(0x00034ee7de2619c0),
+     W(0x0001f91fe14695e7), W(0x00015c8463dc7e6c)}
+  },
+  {
+    {W(0x000789e19a2fc176), W(0x0005a8510329402d), W(0x00027612890e7877),
+     W(0x0002d8936e358704), W(0x00029580e796d161)},
+    {W(0x000027990a9fe532), W(0x000118477bf061c4), W(0x00013e4916b5b008),
+     W(0x00044f3b5afacf17), W(0x0003d984c81b5a95)},
+    {W(0x0000000000000001)},
+    {W(0x000367a20d6c6089), W(0x0001c8c6367c3fc1), W(0x00038965ce0fa41d),
+     W(0x0007a4059799897d), W(0x0000350015cd2b38)}
+  },
+  {
+    {W(0x00025010ea3a1236), W(0x00029bf9af7ad84b), W(0x0003b67d5db743e2),
+     W(0x0005ed113389b7e6), W(0x0001ec114526faf1)},
+    {W(0x000570e39297d728), W(0x0001b4b71e563035), W(0x0000fc712a55c74b),
+     W(0x0006e4faa9430964), W(0x000157daa79cc4bb)},
+    {W(0x0000000000000001)},
+    {W(0x00058d50ce363911), W(0x00042f29424fb161), W(0x0006968fb05ca257),
+     W(0x00041d96e826381a), W(0x0001c1f45e2fbe7b)}
+  },
+  {
+    {W(0x00059a941f5c14a9), W(0x0002913cceed0484), W(0x0007cf683cad13df),
+     W(0x000510be6f70a146), W(0x0002a0b26c66bc6e)},
+    {W(0x00052dab8a300d93), W(0x000685bfe195cd17), W(0x00004464ad5a6348),
+     W(0x00034da74519473b), W(0x00037cf08532239c)},
+    {W(0x0000000000000001)},
+    {W(0x0007df0e76ab129e), W(0x00013651781f0112), W(0x0002571bce9248c7),
+     W(0x00014104e1c8c253), W(0x00034169c0ab0f97)}
+  },
+  {
+    {W(0x0005a4c8934697de), W(0x0001534833d6987f), W(0x0000b0cc92cfd0d5),
+     W(0x0005832400f8cc57), W(0x0006b9e608b370fc)},
+    {W(0x0005c3d1701d8455), W(0x0000fb61fa843093), W(0x00018ec456e5be1e),
+     W(0x0005edfbb003b099), W(0x000744c4dc27fc96)},
+    {W(0x0000000000000001)},
+    {W(0x00064bac67eab391), W(0x000058ef64ec53f9), W(0x0003cd84b4e5ebea),
+     W(0x0004cd0fe54f1425), W(0x0004982225f11a50)}
+  },
+  {
+    {W(0x00062bea2eee131f), W(0x00045b417d1c2847), W(0x0006ea4e7da53361),
+     W(0x0003971bdd5a89d5), W(0x0004a5cc407e7aa1)},
+    {W(0x0004270d6e67d0ca), W(0x0006f15b6f408855), W(0x0006e0093bdd6924),
+     W(0x0002275f0cbe2330), W(0x00027c6872c03ffe)},
+    {W(0x0000000000000001)},
+    {W(0x00071e6ab6ce5315), W(0x00049f7fcbe2c6d9), W(0x0004d3ca47c1e1aa),
+     W(0x0005d718204ae933), W(0x000031d165f5883d)}
+  },
+  {
+    {W(0x0006bba89feb520f), W(0x0002b873ecf181eb), W(0x000540c6f5ba2bc7),
+     W(0x0004eb41d92303b8), W(0x00033a68176757a9)},
+    {W(0x00034afb6999e79c), W(0x00017148e930418b), W(0x0004cf0896dbb11e),
+     W(0x000755e768ece43c), W(0x00018b44cdce7fd7)},
+    {W(0x0000000000000001)},
+    {W(0x000204b9eea7bb61), W(0x000743bbbc4c9533), W(0x000045a2aff5432d),
+     W(0x0007881ae68967fb), W(0x0004f1fbd1a5b1d4)}
+  },
+  {
+    {W(0x00076d0c0cc60f5d), W(0x000071d71ab6868a), W(0x0002a1c1033a4cc0),
+     W(0x0002e7f5396cc427), W(0x0004101ac46d9aa4)},
+    {W(0x00037892d634beb6), W(0x00043d866c71d4a5), W(0x00006c5b647fb16f),
+     W(0x000707de175fb9c5), W(0x0000a5011ab5ec34)},
+    {W(0x0000000000000001)},
+    {W(0x00051213825ffb6e), W(0x0002ad80a22323ab), W(0x0001f185f3e670a2),
+     W(0x0005857558915a0d), W(0x000591161e0f6f03)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002817b94e68325), W(0x00047920a1d5d236), W(0x000064962364b5a2),
+     W(0x00008acb90b0b095), W(0x0000ea2c846a535a)},
+    {W(0x00071b5a8b0d031b), W(0x0003e7a622de4972), W(0x0006f860e94280cc),
+     W(0x00008ddd60bb5089), W(0x0003b82a8337b05f)},
+    {W(0x0000000000000001)},
+    {W(0x000298ad5efd8f96), W(0x00063408aadfa799), W(0x0006b044c3ba8848),
+     W(0x000343a5a91bd506), W(0x0003cdde28b0d964)}
+  },
+  {
+    {W(0x00077dbcd25c5f3d), W(0x000088a44da541ce), W(0x00071a9b1b77101a),
+     W(0x000748c3b6d6a4eb), W(0x000561d2c1d673a0)},
+    {W(0x0005d2d4cf747afe), W(0x00046e1b7a1bc33c), W(0x000733b3b1b799a4),
+     W(0x000135ee3bb51984), W(0x0002dac09925d762)},
+    {W(0x0000000000000001)},
+    {W(0x0000d72c3f3b533f), W(0x0002efd85f1c7133), W(0x00049d463afbf4c3),
+     W(0x0007aa95b26d208b), W(0x00024d703f5ab01c)}
+  },
+  {
+    {W(0x000033c6e4ad2af6), W(0x00073dfbca7e8058), W(0x0000a61f4acb4073),
+     W(0x000063dc8371bd9d), W(0x00070231a092565f)},
+    {W(0x00010642c985a6c2), W(0x0004aa22eddc348c), W(0x0007d48d59716dab),
+     W(0x0005cb2953e0a5d6), W(0x0001df8dc634575b)},
+    {W(0x0000000000000001)},
+    {W(0x0000a15b45f63107), W(0x0003045dd03e226b), W(0x000383766cf6ffb4),
+     W(0x0003e5b2d56e549b), W(0x0005448b030c625d)}
+  },
+  {
+    {W(0x0002dbd3eb171523), W(0x000595723e002bc2), W(0x00052c6fb6b33904),
+     W(0x000344b30bedde16), W(0x000140b6f1e4bad4)},
+    {W(0x00002d77b6bfce11), W(0x00014bb469e30449), W(0x00035d50f849c2c1),
+     W(0x0007a9ee1395876c), W(0x000444eb3598ccaf)},
+    {W(0x0000000000000001)},
+    {W(0x0004b8fbeb124cbd), W(0x0005fc76b816dc24), W(0x0001e74a83a69dd8),
+     W(0x0002a435836410fb), W(0x00030a00d3edde95)}
+  },
+  {
+    {W(0x000652250ab38365), W(0x0003a020ea8eaa8a), W(0x000458f7fd3d3e51),
+     W(0x0003dc086535d721), W(0x00034bd49edfa2dd)},
+    {W(0x0002217edfd34c25), W(0x000340c1c16cf1a3), W(0x0001b5323bacf59d),
+     W(0x00072f1bc4be26f7), W(0x00073feaa96bbe61)},
+    {W(0x0000000000000001)},
+    {W(0x00017db9c8f437a8), W(0x000627a48d281b6c), W(0x0007e7ad719e4786),
+     W(0x000422b5fa79c32e), W(0x000362b4a8723182)}
+  },
+  {
+    {W(0x00028e8a83744eb5), W(0x000442affcde176b), W(0x0002968dd2043343),
+     W(0x0006b0d71cc909b2), W(0x00070d99008ffcb5)},
+    {W(0x0006c54e726c32b9), W(0x00044283befd1791), W(0x00067e09c40e60ed),
+     W(0x0002c997194d7c90), W(0x00056b125243a069)},
+    {W(0x0000000000000001)},
+    {W(0x00076258a82248f1), W(0x0002a05aea316ca8), W(0x00052360c81e6f37),
+     W(0x0007ae136b92181e), W(0x0002bf17b9d14788)}
+  },
+  {
+    {W(0x0003abc449a3d1a4), W(0x0000a2263753947e), W(0x0007dfc5b0b50798),
+     W(0x00004dfc6e993065), W(0x0007b50476b0a337)},
+    {W(0x00012a1e8baa33cc), W(0x000243b17bebcaf6), W(0x0003c6188ed37727),
+     W(0x0006a1284ec80951), W(0x0002448c3ec7026f)},
+    {W(0x0000000000000001)},
+    {W(0x0002053d66c73bfd), W(0x00002bdd1bd082a1), W(0x0006dd4c1ae4b145),
+     W(0x000533f5e1101c3b), W(0x0006868a751465a0)}
+  },
+  {
+    {W(0x0001b2660f617607), W(0x000508bd980fc724), W(0x0004d510c8a68608),
+     W(0x000665aa2f30af09), W(0x0000a9fcf41f6ef7)},
+    {W(0x0002e6c384daf9dd), W(0x00072bb2da4493f1), W(0x00064d5b063161bc),
+     W(0x0001d4691dbcdad5), W(0x000732fb4faed167)},
+    {W(0x0000000000000001)},
+    {W(0x000107cad2e01c24), W(0x0000d6938aff729a), W(0x00027197db446e19),
+     W(0x0006db52acb6b175), W(0x0003e4d21b936593)}
+  },
+  {
+    {W(0x0000f97820edb2ef), W(0x00009e3b98ed4c56), W(0x00002fa2eb235127),
+     W(0x0001a6e70129149e), W(0x0004aab40c4766e7)},
+    {W(0x00074ca7efb43b80), W(0x0000be5345d8e303), W(0x0002eb3d60374af2),
+     W(0x00027ef2f5b382de), W(0x0001cbd3e8302400)},
+    {W(0x0000000000000001)},
+    {W(0x000495ed0bfd8705), W(0x00006b2089b1c0ea), W(0x00079928577d9939),
+     W(0x00012f53f8d0fd16), W(0x00011cb1c893de0c)}
+  },
+  {
+    {W(0x0000d46c923229ca), W(0x000344bf03314441), W(0x000253f2d065a770),
+     W(0x00011ed23cd09f2b), W(0x0003125e0c28be98)},
+    {W(0x000154e119941b47), W(0x000220b1fad93574), W(0x000682a6248c4c88),
+     W(0x0003e231b019aa79), W(0x000158170702464e)},
+    {W(0x0000000000000001)},
+    {W(0x0002e0c55a0dbf32), W(0x0004b293377f51db), W(0x0005837a34c1a6d9),
+     W(0x0000dd2b2c1f66ba), W(0x0006c28238fe2c7a)}
+  },
+  {
+    {W(0x00034773e2552f74), W(0x00029f1f29896737), W(0x0001ad1cc385f764),
+     W(0x00057055ee1db7be), W(0x000425bef091c281)},
+    {W(0x0001945c40e47d37), W(0x0004849a5afb49f9), W(0x0007c6d3e07c42a9),
+     W(0x000408418c8869a3), W(0x0007d17205a04ab9)},
+    {W(0x0000000000000001)},
+    {W(0x00075b9f19c1e854), W(0x00074d7f742f5258), W(0x0002280d5df05649),
+     W(0x0000ff8d87e7e403), W(0x00021f98b7070078)}
+  },
+  {
+    {W(0x00055092e595b18b), W(0x000489be958ec226), W(0x0004b3fbaf98cb0c),
+     W(0x00023ae22b78e243), W(0x000133a5a85567a2)},
+    {W(0x0006584a3cac160d), W(0x0002546d8fe8c750), W(0x0003a6725b90ddb9),
+     W(0x0004fdf233a0b32e), W(0x0007cd564f6050c7)},
+    {W(0x0000000000000001)},
+    {W(0x000359a8ba78b9d6), W(0x00046ee80098481a), W(0x000100f079c45924),
+     W(0x0002c28db1a57d38), W(0x0003499d6dadf603)}
+  },
+  {
+    {W(0x0000366e8afe5219), W(0x000505c0ea55d87c), W(0x000587f921bbec43),
+     W(0x0001dde0dba02821), W(0x0002336551d032fc)},
+    {W(0x000365549f49000e), W(0x0002b2f173fca27b), W(0x0001a3603a4b7b72),
+     W(0x0000cb4af3c9dea4), W(0x00000a0d15d61875)},
+    {W(0x0000000000000001)},
+    {W(0x000074c93b507e60), W(0x0004c228bbe0b7e9), W(0x00007bf759abf83b),
+     W(0x0006ae64e42b6d21), W(0x00070b5da1cd67db)}
+  },
+  {
+    {W(0x0002018b796daeae), W(0x0001c6534fffba91), W(0x0005b300a298a2c8),
+     W(0x0002a72347c62479), W(0x000221aa75a737d3)},
+    {W(0x000327e5f8ee99f1), W(0x00027eb9feb9a774), W(0x00029456af069d39),
+     W(0x0007ad5380a8463b), W(0x00053834fbd3b373)},
+    {W(0x0000000000000001)},
+    {W(0x00076cf8d5b9772f), W(0x00077d16f83c0cae), W(0x0007171ba2f3dbff),
+     W(0x00067e409853e60e), W(0x00014fed5853e8ea)}
+  },
+  {
+    {W(0x000285d0ea51bdca), W(0x00029574dc2a3310), W(0x0005a8753e759e0f),
+     W(0x0005a8a5ad452953), W(0x00037bbe61a26fab)},
+    {W(0x00015be0f57933e8), W(0x0001b1531d61215e), W(0x000268cb00f2b7f1),
+     W(0x000312f4c85dca08), W(0x000532bda818198e)},
+    {W(0x0000000000000001)},
+    {W(0x0006b87052b15667), W(0x00004e14b769cfb7), W(0x0006e08421e23294),
+     W(0x0000d771f16be3e6), W(0x0007f06e2db41bbf)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0007f27354e1c128), W(0x00048363232e8ed7), W(0x0007cdcd951aa2e7),
+     W(0x0004e32dba14cdbb), W(0x0000fb3f87c2c6c8)},
+    {W(0x0005b85d74e9d5f7), W(0x0000b0978616a2c4), W(0x0006f0a04b2ab7c3),
+     W(0x0007f1f3417d6a4e), W(0x0001034d42c15a2b)},
+    {W(0x0000000000000001)},
+    {W(0x000235994983e634), W(0x000545a905b52156), W(0x0004ea77d7e76b86),
+     W(0x0004b9c44380131e), W(0x000186a0dc7ec095)}
+  },
+  {
+    {W(0x0005310eba46b161), W(0x0004fb3acfed8cf4), W(0x0005b32051e43e14),
+     W(0x00041e9ace2daf97), W(0x0007b6a556577863)},
+    {W(0x00031b60663ab0d3), W(0x0001e1332b04de28), W(0x00076e15c4528cb6),
+     W(0x0001cd30ea937b76), W(0x0000cb7acea0eac7)},
+    {W(0x0000000000000001)},
+    {W(0x0006ad2a0109fb93), W(0x0007fa0fc95e91cb), W(0x0007d41533e3044b),
+     W(0x0002158a37153292), W(0x00019370e1fdeb6d)}
+  },
+  {
+    {W(0x0002b4666ba7daeb), W(0x0001581e041ead31), W(0x00023bf5cde9c72b),
+     W(0x0003851a7df5d938), W(0x00005ff834d7f1a7)},
+    {W(0x00053206a44223e8), W(0x0006ab6d0b0286dc), W(0x0005aa2f80b805bd),
+     W(0x0005a6fdeab0e6ce), W(0x0003bced52948988)},
+    {W(0x0000000000000001)},
+    {W(0x00070f67a99fe5d5), W(0x0001188ea3fc6cbf), W(0x0002f876388b9f0d),
+     W(0x0006f21cb3ebfc76), W(0x0006d8b1f7808a2b)}
+  },
+  {
+    {W(0x0007100e17e5f45e), W(0x00058b8cebe87cf3), W(0x0002ff490453952e),
+     W(0x0000e338d80a7aa4), W(0x0005ad25870b2c16)},
+    {W(0x000494920716ba2d), W(0x00004ff9256a17bb), W(0x00050fe3b586e801),
+     W(0x00005930207cfaf6), W(0x00065c775edcb82b)},
+    {W(0x0000000000000001)},
+    {W(0x00048143ee0a7cf1), W(0x00079b34cd35aa30), W(0x0000dfdcd2201fe3),
+     W(0x000453ed176a7a63), W(0x000242450ddefd75)}
+  },
+  {
+    {W(0x00014a75a86d88bc), W(0x0005c2426cacd266), W(0x00065f0c5ccd80d2),
+     W(0x0003699f33a90d39), W(0x00032354220db572)},
+    {W(0x00076c6a80d95267), W(0x00058d223aaa234e), W(0x000516150fa2b2c1),
+     W(0x00020622f0bb1ff9), W(0x0004cea7e04f5103)},
+    {W(0x0000000000000001)},
+    {W(0x0004e2bdb45fff27), W(0x000746bc40050b67), W(0x0006206c922cc7d1),
+     W(0x000356a5278cc775), W(0x0004fa16f6e1adee)}
+  },
+  {
+    {W(0x0001a740090dba80), W(0x0007cccfc68cf4c7), W(0x00011b11e14fed5a),
+     W(0x0004673fb63476f4), W(0x000535864a2ce9fe)},
+    {W(0x0001597bc2a9c1e8), W(0x0005856e687c4664), W(0x00078854ee2704b6),
+     W(0x000337fec54be06a), W(0x0000988c3b9b7333)},
+    {W(0x0000000000000001)},
+    {W(0x0004bed72d733b18), W(0x00079fe16d39861d), W(0x0003cf48b3152f69),
+     W(0x00055f67d490b3aa), W(0x000502b6bd31534f)}
+  },
+  {
+    {W(0x0003b949cdb61d31), W(0x0003d4406cd1a358), W(0x00013b46f4c78dc6),
+     W(0x00006f85daccc42c), W(0x00010421296cc4b0)},
+    {W(0x0007633d293e2c8b), W(0x00056fa0e9ca01d2), W(0x0000fe0d807f3dda),
+     W(0x0002c1da2618d429), W(0x00059e6c0c278a93)},
+    {W(0x0000000000000001)},
+    {W(0x0004ad2d260415e7), W(0x00041ef71a5d67ea), W(0x0005ae6a8ebb7042),
+     W(0x00044170530c5eb1), W(0x00008eeebb708eb3)}
+  },
+  {
+    {W(0x0003ae5c3056b6d0), W(0x0005ca3074888eb6), W(0x000799d917bd9405),
+     W(0x00041d8b6a06d17a), W(0x0003f18362ff22f5)},
+    {W(0x00058c1e9be02ffd), W(0x0006a57a99552318), W(0x0003edfa7c2a56d8),
+     W(0x00062191bdc477e2), W(0x0005cfc7a0f0d2fe)},
+    {W(0x0000000000000001)},
+    {W(0x0004842d468aa744), W(0x0003923d908e4a99), W(0x0005d724b0c24e04),
+     W(0x0000685c90f1bd42), W(0x00053dd2b6547442)}
+  },
+  {
+    {W(0x00032bf8fbd33f5c), W(0x0005d0a1788ab3ea), W(0x0004812bd36ba83c),
+     W(0x0002d73d44c14cd6), W(0x00071b085534e87e)},
+    {W(0x0001070f7605a4d6), W(0x00003b9a7a339a6a), W(0x0001ba9f3277aa1d),
+     W(0x0000f54e7ec32334), W(0x0005ea57b2bc401b)},
+    {W(0x0000000000000001)},
+    {W(0x00003fa83fb850b2), W(0x000598a21e0feac8), W(0x0006be8f2eb58fdf),
+     W(0x0004bedda835778c), W(0x00021b636595d450)}
+  },
+  {
+    {W(0x00028901579349aa), W(0x0003398bc1f7a7e4), W(0x0003c93d87cf23f1),
+     W(0x000242786fda7f63), W(0x00008045ac8cf966)},
+    {W(0x0004fe0911e0dd73), W(0x0003a968d301f8a0), W(0x00076f8402ed047a),
+     W(0x0006fdcc92e5a856), W(0x00063403669b4d6d)},
+    {W(0x0000000000000001)},
+    {W(0x00062edffa38e055), W(0x000437679c2a6daf), W(0x0007667617bd7de7),
+     W(0x0000d9829824b01d), W(0x0000abc1049d7238)}
+  },
+  {
+    {W(0x000522af3af237e2), W(0x000096bb196d328f), W(0x000624adc9892791),
+     W(0x0000b6cbbb077bfb), W(0x0005b7c7db841a9e)},
+    {W(0x0006c43f2d0fb7fb), W(0x00013cd2f44f7dc4), W(0x00004924d6a7264c),
+     W(0x00041d486f5289ae), W(0x00028aea328f54e8)},
+    {W(0x0000000000000001)},
+    {W(0x00019f5a5e6191e1), W(0x0001d5104dd15c9b), W(0x0007cdeef2a3566a),
+     W(0x0007a1744e2afb8a), W(0x00027ffc498220b1)}
+  },
+  {
+    {W(0x0003e9abcd6dfbf6), W(0x0001e4b014362a2d), W(0x0005a35b97ca24a7),
+     W(0x0001f629b9c302dd), W(0x00020c360d68b038)},
+    {W(0x000476636d74bbd5), W(0x0003ca51e8c11fea), W(0x00007bebb5084906),
+     W(0x000371782109daba), W(0x00025f3832c5b699)},
+    {W(0x0000000000000001)},
+    {W(0x0004229f9ce61c2e), W(0x00056603ccd4414a), W(0x0000e795a461dacc),
+     W(0x00018d7c0abdadef), W(0x00022a7c6ff3a347)}
+  },
+  {
+    {W(0x000523eb74fa3329), W(0x0005c1bcf0920369), W(0x00068ec5dee83bbf),
+     W(0x00053f2f34e4ac88), W(0x000140863450fa76)},
+    {W(0x0005044c4857d675), W(0x0007a774d5dc4680), W(0x000435d53b4fff65),
+     W(0x00076f5e27566593), W(0x0006d1f8afd132d5)},
+    {W(0x0000000000000001)},
+    {W(0x00062823dd8f9601), W(0x0006884e4819f353), W(0x00054c53298bf7b2),
+     W(0x0003b8abaed81aa1), W(0x00074375cbeb8e69)}
+  },
+  {
+    {W(0x0003597881401f03), W(0x0005acc6ba572c07), W(0x0005f32748c3c9f2),
+     W(0x0003bf3bee27344b), W(0x000168c5fb41d957)},
+    {W(0x00010f0730427c4b), W(0x0006c6f5d3c15443), W(0x00021de02172c4e7),
+     W(0x00007d4a0a5cb892), W(0x000316a05bc3bef8)},
+    {W(0x0000000000000001)},
+    {W(0x00003d79112d0837), W(0x0000aadc1e4b67e1), W(0x0001f0dba2e80077),
+     W(0x00046fb1a921bcca), W(0x00051750f5518720)}
+  },
+  {
+    {W(0x0007de191692a8d5), W(0x000740bafe4887ec), W(0x0001619bada6ac10),
+     W(0x000456dec480fa54), W(0x00038359eb08bc0c)},
+    {W(0x0007aaf7c9efae5c), W(0x0004c61a124ee3d5), W(0x0003512da3b42d89),
+     W(0x0001dc31600bf0bd), W(0x0005341df6e234d3)},
+    {W(0x0000000000000001)},
+    {W(0x000733b7c9202ca1), W(0x0001d3b40762478c), W(0x00075fb34ce6fc7a),
+     W(0x0005323fff6c4d41), W(0x0006f93e6d13612a)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002d644c7dad28d), W(0x00043703afa4db6f), W(0x0001f85df5ea777b),
+     W(0x00073e16c6821b8e), W(0x0001bc7af1e38185)},
+    {W(0x0002f65900314833), W(0x00024c6364e1f95e), W(0x00057701247409f8),
+     W(0x000797bd2f77c3bc), W(0x00061d909d855661)},
+    {W(0x0000000000000001)},
+    {W(0x000045216636c2c7), W(0x0006cadbcfdf0a37), W(0x00047c3ef66ee3c8),
+     W(0x000522665b326f25), W(0x0001a340b8054b8f)}
+  },
+  {
+    {W(0x0001938218028354), W(0x0006bb1b54fa00f3), W(0x0006e28f67cbea25),
+     W(0x0004b5e9141aad35), W(0x00006bce245f8c25)},
+    {W(0x0004955188a3c065), W(0x000161bd0f1292df), W(0x0001d521630b2506),
+     W(0x0006d06495669788), W(0x0003d26989cdd0f6)},
+    {W(0x0000000000000001)},
+    {W(0x000365eb8eb94b17), W(0x000018452cd8dbe9), W(0x0000d790b46bf270),
+     W(0x00078813093349c2), W(0x0007a9f6260e653a)}
+  },
+  {
+    {W(0x000589041b29662f), W(0x0001d6fbadddcfd7), W(0x0001fff2d032c3bc),
+     W(0x0002f7b21e1d64e1), W(0x0007665908aaf444)},
+    {W(0x0003a00e4b704ca1), W(0x00071715f4826e10), W(0x00040ad025948864),
+     W(0x0002a3670bfc0327), W(0x0004ed18a7c50da4)},
+    {W(0x0000000000000001)},
+    {W(0x00054343b9ec13bb), W(0x00015437f0d48d06), W(0x000366c6c241874b),
+     W(0x0006e66e4600d1c1), W(0x0006bb9cf0f2d4db)}
+  },
+  {
+    {W(0x0005954e6c16d4f7), W(0x0007ca457221ebb3), W(0x00069398c394d173),
+     W(0x000554841a79f99d), W(0x0000a09b36eb5a04)},
+    {W(0x0002eb0fa35ed926), W(0x00049a86e7641e74), W(0x0003b54cf41b3a7b),
+     W(0x000085125b7595d7), W(0x0003aa47fd60fa31)},
+    {W(0x0000000000000001)},
+    {W(0x0003b1cc6b04c053), W(0x00013e65c5705fc4), W(0x0007f81640bc9a65),
+     W(0x0006ac534fc04217), W(0x0003bd5dfb4b4648)}
+  },
+  {
+    {W(0x0004d5451113735e), W(0x0002574dcfa41233), W(0x00055926182e858b),
+     W(0x0006b540645ad45f), W(0x0001c71ce37638e6)},
+    {W(0x0000fee129e406cb), W(0x0007e88f52e59c7d), W(0x0002833edf503460),
+     W(0x000166921edd6bcd), W(0x0007880cc1c2003b)},
+    {W(0x0000000000000001)},
+    {W(0x00030eaefc5832ac), W(0x000007bb8bc02f05), W(0x00010ee994d38e57),
+     W(0x0000c32dd003212e), W(0x00079030a4774645)}
+  },
+  {
+    {W(0x00039e7f74cbc8d6), W(0x00008d90a5963263), W(0x00070b3f944839e5),
+     W(0x0007bec4bd417c4a), W(0x0003c607a84c1df2)},
+    {W(0x00079a86ba3cea68), W(0x00042e6340c19d4e), W(0x00076fb861261f82),
+     W(0x00051d11c25d5a44), W(0x00034518ad109941)},
+    {W(0x0000000000000001)},
+    {W(0x00003c6c9e37345d), W(0x0007081214e622b1), W(0x00060ece5ba974a8),
+     W(0x000179f8768deed4), W(0x0000727055e32e57)}
+  },
+  {
+    {W(0x0002f417ffbe2da0), W(0x0004d4c71c738621), W(0x0005bbdfc4e85ff1),
+     W(0x0006331ffc9c6eb0), W(0x000089b6cd02000b)},
+    {W(0x000016f13e8ceb88), W(0x0004f9b762547cf1), W(0x00072995f90f2f92),
+     W(0x0007ec5a1c6f7e88), W(0x00066ef7206aa36d)},
+    {W(0x0000000000000001)},
+    {W(0x000478374da76d28), W(0x0005344ef62175f4), W(0x00078f681d66e834),
+     W(0x0001fda3b879848d), W(0x0000d2c585f51161)}
+  },
+  {
+    {W(0x0006b2d6fc2c9fdb), W(0x0005b0e0cf4a45c3), W(0x0001de41b4adca18),
+     W(0x0006b07c3d5aa1a3), W(0x000079e9d5b60917)},
+    {W(0x0001381c04c78797), W(0x00079470b8eb0720), W(0x0002fe8895900193),
+     W(0x0005229893654a28), W(0x00016512951d2240)},
+    {W(0x0000000000000001)},
+    {W(0x0001b9bb33b94e2a), W(0x000471701c32b888), W(0x0007201f9f3e4791),
+     W(0x00009c9665f45f28), W(0x00018a2cd789580b)}
+  },
+  {
+    {W(0x00054ba615e7bacf), W(0x0004e5177009b7b9), W(0x000735e62946071d),
+     W(0x00006115696f90ea), W(0x00014445439305d0)},
+    {W(0x000200515d0477bc), W(0x000157fafd10b1dd), W(0x0002e35626b9af26),
+     W(0x0006a69f71b080cf), W(0x0002ab36d724a6ec)},
+    {W(0x0000000000000001)},
+    {W(0x00046e2ce7ceecab), W(0x0005b697fb2f2e3a), W(0x00043723380b355b),
+     W(0x0001594187a6aa3a), W(0x0003768f1d146014)}
+  },
+  {
+    {W(0x000087787e2dd7b8), W(0x00007bb442643ef2), W(0x00070221dc40c4e7),
+     W(0x00010e30d662465a), W(0x0007b23a7dce9a09)},
+    {W(0x0002040bc9616570), W(0x00039cf90f92e9c2), W(0x0002edbe7e0547ab),
+     W(0x00030189d6ee99fb), W(0x00077a7fbafce1bc)},
+    {W(0x0000000000000001)},
+    {W(0x00025b1a1380ed31), W(0x00070dbb6d788f3d), W(0x000510ca8a63cb2d),
+     W(0x0000fec9668bc1dd), W(0x000678006f65af05)}
+  },
+  {
+    {W(0x00013e2d3b4b1d5c), W(0x00008985fcb81ee5), W(0x0001988a1a828025),
+     W(0x0000a01a7d870114), W(0x000488953fd41867)},
+    {W(0x0000399223384410), W(0x000014223f9006be), W(0x00050f09050a657d),
+     W(0x000292378430245d), W(0x0007bd340fdf6e04)},
+    {W(0x0000000000000001)},
+    {W(0x0000ec1fcde050f2), W(0x0004898e6bcf3408), W(0x0004c6e0a7708771),
+     W(0x00068b1dcb7e3c7f), W(0x000602833b0f078b)}
+  },
+  {
+    {W(0x0003403b4621d719), W(0x0003015b2e7b4c3e), W(0x0005115565bbd38b),
+     W(0x0003f631614c3f31), W(0x0002396f9d65dc6b)},
+    {W(0x0006d8b42d583dde), W(0x000777423d7bfc3b), W(0x00048c1559a710a7),
+     W(0x000698034ab91fab), W(0x000675952b2e020e)},
+    {W(0x0000000000000001)},
+    {W(0x00072ab1e3bcf96b), W(0x0006f4bde8068edb), W(0x0004f5b5bada9c40),
+     W(0x000485bc50a03394), W(0x000415d255a9d532)}
+  },
+  {
+    {W(0x000657b3ace3c6f8), W(0x000366a7ba42314d), W(0x00029eb30543f7f7),
+     W(0x0001b6c2a1d320d3), W(0x000229f80407ae62)},
+    {W(0x0003f16fe3db85b0), W(0x0007cd85cb93b208), W(0x0007a019da637748),
+     W(0x0004f4880eb525e0), W(0x0001d44ec76d45e6)},
+    {W(0x0000000000000001)},
+    {W(0x0005f8864731bfcb), W(0x0007ab32c19376cd), W(0x000339acb66b1bde),
+     W(0x00028a92de1eb77a), W(0x00076a4d6aa450eb)}
+  },
+  {
+    {W(0x0000cc1a47ce93c4), W(0x0003393627feb977), W(0x0001eb4e9e334c2c),
+     W(0x000496d2855b1681), W(0x0004c7cb3e8f525a)},
+    {W(0x00018cd592e65741), W(0x000296915f5154fd), W(0x0000e85466180265),
+     W(0x0002ee9f744c36ab), W(0x0004c957905c63cb)},
+    {W(0x0000000000000001)},
+    {W(0x0003578a80d634db), W(0x0006b064354f9c85), W(0x0000fb9d2c116f8f),
+     W(0x0005c1966ac524c7), W(0x0007ed22b364f0d8)}
+  },
+  {
+    {W(0x0000dc27e0016faa), W(0x0005c13389191dad), W(0x000440264d63e1c5),
+     W(0x0000e2d56486f232), W(0x0002a4b994aa61f7)},
+    {W(0x00057486d74dda9a), W(0x0007984da5d06098), W(0x0005f05e86ec0601),
+     W(0x00061bbb3c0adce8), W(0x00013a4a860954e7)},
+    {W(0x0000000000000001)},
+    {W(0x00003af37d41878b), W(0x00021320c8533a02), W(0x0004f99d4d5b0067),
+     W(0x0006dc96bcafbb01), W(0x00055f69782ed38b)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0004577198d74a4d), W(0x0007ec77a6f16fb5), W(0x0005f0825526c61f),
+     W(0x0007ce48e22cbe67), W(0x000469d0960dbd0e)},
+    {W(0x000345e4909478cb), W(0x0002ae8afedb3ed6), W(0x0002f724e53e0fe3),
+     W(0x0001120f90abe144), W(0x0000b5f21c7f8683)},
+    {W(0x0000000000000001)},
+    {W(0x00041d382ef6d297), W(0x0000b2dd5eb0a997), W(0x00078f876f584e3b),
+     W(0x000637cbdb0b1315), W(0x0000e28548e5eea2)}
+  },
+  {
+    {W(0x0004ffa156776792), W(0x0001475c7e12b8b8), W(0x0004f5fa79365328),
+     W(0x00005267585b375c), W(0x0005911ade999893)},
+    {W(0x00075f6fa19548f6), W(0x00024380061774b6), W(0x0006c86c98975a2b),
+     W(0x00074efa02b51b86), W(0x000063ad2432a173)},
+    {W(0x0000000000000001)},
+    {W(0x00019b9482c93b8e), W(0x00056ee491413ebc), W(0x0000c3691c1541de),
+     W(0x00012f6cdc28ac1a), W(0x000255b19b78d67b)}
+  },
+  {
+    {W(0x0002a903e00bfddd), W(0x0006a5d885b59737), W(0x0007b719000280fb),
+     W(0x00015b02ccc16835), W(0x000783b5405bd8fc)},
+    {W(0x00034ac5ebbe068d), W(0x0002d8b22037e6de), W(0x000216654e048dcf),
+     W(0x0000eb6520472e6c), W(0x00026e84cc1c0904)},
+    {W(0x0000000000000001)},
+    {W(0x000407d4dfd97efb), W(0x0005e201ea8a7456), W(0x00014d8377df11c1),
+     W(0x0006309d81d5f364), W(0x0001c0c8773499fd)}
+  },
+  {
+    {W(0x0003729ad1939932), W(0x0003a99697a2d53e), W(0x00074e6992cb53e7),
+     W(0x0007658e39d1f202), W(0x00010b304ff67577)},
+    {W(0x00016dd0ada44bb9), W(0x0005552695f6846c), W(0x0006178da767b196),
+     W(0x0000a0cdd873e666), W(0x00013b7faa0f91cc)},
+    {W(0x0000000000000001)},
+    {W(0x000011813d6b943b), W(0x0004b7e41999dfcf), W(0x000447bc6868d1be),
+     W(0x000478e1ebdcc387), W(0x000447af9f6be4fd)}
+  },
+  {
+    {W(0x00069b70253d502f), W(0x0006abda857418ee), W(0x0007d02bd7a33739),
+     W(0x0006a6784c324884), W(0x00044f735aafd475)},
+    {W(0x0000cab9141566a0), W(0x0003154bff5b5af3), W(0x000057cf992c363e),
+     W(0x0001be8756604d66), W(0x00041c6db4ac7bf8)},
+    {W(0x0000000000000001)},
+    {W(0x0000b33c3a6260f4), W(0x00051adde6bfbc9a), W(0x0003df8b3c8e7767),
+     W(0x0004aeb0164bf88c), W(0x0002e3c1d5ce0239)}
+  },
+  {
+    {W(0x00004b434a55190c), W(0x0006ac072a7efb2c), W(0x00033a5a9297602c),
+     W(0x00053b0207daafe2), W(0x000117d2478926a8)},
+    {W(0x00029cc6f7de8368), W(0x000628f8d4ddc1d4), W(0x0005c7d82638fd18),
+     W(0x0005bc183b53dfab), W(0x0001b4d73b3cdf13)},
+    {W(0x0000000000000001)},
+    {W(0x0002a51ba5fcfce9), W(0x0001638c2e521385), W(0x0002014cf59e426a),
+     W(0x0006170492f58678), W(0x00032e51b78bf769)}
+  },
+  {
+    {W(0x0005e1a2d65e04b1), W(0x00047519ea1351c9), W(0x0003421afc6b0622),
+     W(0x000338f10e54627a), W(0x0006e8641bc34bbf)},
+    {W(0x00049b5ea7cc02a6), W(0x00076dacdf188bd0), W(0x000306b49af31b7f),
+     W(0x0003f93844b915ce), W(0x0003bc15c3546f5b)},
+    {W(0x0000000000000001)},
+    {W(0x00075bb6b8f2d148), W(0x00020fbc9584190d), W(0x00014eeda088ea95),
+     W(0x0006ec443b942c30), W(0x00013ad50e3aa982)}
+  },
+  {
+    {W(0x0001d00c3c88fd04), W(0x00018320c9ea2a41), W(0x0000cf16037aef0f),
+     W(0x00036e9b0bf9fcde), W(0x0001b795d9be8dec)},
+    {W(0x0000ad5751be0a65), W(0x0002a0f36e210f2a), W(0x0006e8e12ebbee3e),
+     W(0x0000600f431529e7), W(0x0006c87f61b675c5)},
+    {W(0x0000000000000001)},
+    {W(0x0002cec4dcff9c7a), W(0x0000cb06efa7efbf), W(0x00058d71fa0ee0de),
+     W(0x000382c5e9d51f6b), W(0x0003fc0a1e738f2a)}
+  },
+  {
+    {W(0x0004dc31a3692dd7), W(0x00052e7e967263fd), W(0x00059116d29f3294),
+     W(0x0007ea4493c54695), W(0x0002cfbf1f944a19)},
+    {W(0x0003a4eb123fe1f7), W(0x000534928f1766dc), W(0x0006ae67b732c29c),
+     W(0x0005c6a1239fb754), W(0x00077de38577a6ce)},
+    {W(0x0000000000000001)},
+    {W(0x0003f71ecaac1bd4), W(0x0003ae6b593eacff), W(0x0002fbe3ac0f3252),
+     W(0x0004f7dcdaee10f4), W(0x0000f907c8e4bcec)}
+  },
+  {
+    {W(0x0002874809851897), W(0x0007ba2f7459c7d0), W(0x00078807a4fe5760),
+     W(0x000545953d3f442a), W(0x00004baf99a0a31d)},
+    {W(0x00063dfcb22a117d), W(0x00070cf00d3ef637), W(0x00064eb448c26af6),
+     W(0x0003267c07143ea3), W(0x00010168d1619d46)},
+    {W(0x0000000000000001)},
+    {W(0x0003f1828ed49564), W(0x00073f7dc52c74e2), W(0x00012cb6b4d46589),
+     W(0x0000d222331ca139), W(0x0002355d3514851f)}
+  },
+  {
+    {W(0x00000c212a6017c0), W(0x00026856a4e85c41), W(0x0003032bda9b3d2b),
+     W(0x0006c8eec6c45ad8), W(0x00023780cc809814)},
+    {W(0x00078a540f9deb3b), W(0x000194aabab7c974), W(0x000044c93d423d7e),
+     W(0x000360f775979faa), W(0x00049d0ce9b5a630)},
+    {W(0x0000000000000001)},
+    {W(0x00070b1683564fe6), W(0x000652d4c466c056), W(0x00030a0c595b0310),
+     W(0x00011ac264f5a212), W(0x0001577705fd8a9b)}
+  },
+  {
+    {W(0x0002ed5566b2004f), W(0x0006430cdc31bda9), W(0x0004d86bf635d052),
+     W(0x0005f9c4c5ae1307), W(0x00070fd6724f3f2a)},
+    {W(0x0007ca3ac12a4efd), W(0x0005ecee9d9b0011), W(0x0003d25b40a38187),
+     W(0x00056e77f1c0ef24), W(0x00065a655b6f37da)},
+    {W(0x0000000000000001)},
+    {W(0x0001825d873da975), W(0x0006233be45d0f7f), W(0x0004fb2cd08821d9),
+     W(0x0005eff749bb0443), W(0x000075cb08feb322)}
+  },
+  {
+    {W(0x00050d015bba0498), W(0x00006a8a3c08c15d), W(0x0005d580577622d0),
+     W(0x0006783189ac8863), W(0x0005c0602d8e5ea0)},
+    {W(0x00002d65f8898598), W(0x000304fe38a47edf), W(0x0007acdf521dc1ec),
+     W(0x0007c1f7c59545a1), W(0x00017100f311e3db)},
+    {W(0x0000000000000001)},
+    {W(0x00025f5c1298b9cd), W(0x00028203e240ff3b), W(0x00049e404ec43cf5),
+     W(0x00057f09dd33fa48), W(0x000747279c2257ea)}
+  },
+  {
+    {W(0x0001e1019c75c3dd), W(0x0007e32a4f2223fe), W(0x0001a0b19df1af91),
+     W(0x00049024da94f7ef), W(0x0007b994e37fa39d)},
+    {W(0x0005e3dbde8833b8), W(0x0006fa06497cc2c7), W(0x0007e2eed4deb873),
+     W(0x0005ac19647b5cb0), W(0x0006e3ec55694fe2)},
+    {W(0x0000000000000001)},
+    {W(0x0000ac9c47ce684a), W(0x0006933763b2ce10), W(0x0006b127fe58e8ff),
+     W(0x000281a60ad1aff7), W(0x0002a7edea81fd53)}
+  },
+  {
+    {W(0x00040b795ed2bb5c), W(0x0004147d99eb7f40), W(0x000289c86c774e54),
+     W(0x0005b56467939574), W(0x0005e7942038cd76)},
+    {W(0x0003e861eeec4831), W(0x0006f899dd347613), W(0x000524cfe5d1d967),
+     W(0x0002888e2001b082), W(0x000236a099a65551)},
+    {W(0x0000000000000001)},
+    {W(0x0001b20a946ce130), W(0x0001102dbe334308), W(0x00013440e2e42ba9),
+     W(0x00024aab91eea5ec), W(0x00041c8b5f52473f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0000319170c5cbeb), W(0x00045dfa1901b262), W(0x0004f5a78e09bfa1),
+     W(0x00061a937098bfc8), W(0x0005e9ac4ab2f4a3)},
+    {W(0x0006c32be5b51bab), W(0x0001fcce7a160521), W(0x0003879392f3c991),
+     W(0x0001e65e9799a94d), W(0x000505f00fa8aee0)},
+    {W(0x0000000000000001)},
+    {W(0x00006ddebed72a48), W(0x00045d47b79da83b), W(0x00067c366538c980),
+     W(0x00075e2f5b863d40), W(0x0004c143172068ca)}
+  },
+  {
+    {W(0x0004b53d220ddbf6), W(0x00073c503e062ea2), W(0x0006684612a688de),
+     W(0x000054bc44a9da83), W(0x0002e5c4ef1a1273)},
+    {W(0x0003dc4dfb54008b), W(0x000196ffe806a2f9), W(0x00013a653b912bfa),
+     W(0x0001cb2e2eaa3a54), W(0x0005c1731365512a)},
+    {W(0x0000000000000001)},
+    {W(0x00053c542e8e408c), W(0x00008e571f36624e), W(0x00044a6ce3831e3a),
+     W(0x0002147a6c5ddfdd), W(0x0007a288f7dc1bdb)}
+  },
+  {
+    {W(0x00041f5395c68f4b), W(0x00021527553fa46d), W(0x000449133ccc4dae),
+     W(0x00020ad573c8d918), W(0x0000e2606a00097a)},
+    {W(0x000150dbc87749c3), W(0x00010772f531215a), W(0x0004ed926dacae76),
+     W(0x00078e59c7d6a1e8), W(0x0002dda446c4a628)},
+    {W(0x0000000000000001)},
+    {W(0x0005323f588ad35d), W(0x0006234537298972), W(0x0007b77f428399fd),
+     W(0x00000214cb090c49), W(0x00066ec4f3b562da)}
+  },
+  {
+    {W(0x0007f2867bef24ce), W(0x000710efab9d0ee1), W(0x0001ca33cabfbcb4),
+     W(0x0000b725aadb7597), W(0x0004c6c9a0e8a4ef)},
+    {W(0x00074fd1c286ea25), W(0x00002cd1ab9507d6), W(0x0002e4153317b496),
+     W(0x00044139df386b6c), W(0x00026d5711ee5a1e)},
+    {W(0x0000000000000001)},
+    {W(0x0005abb79c0fde35), W(0x0005907a27bbca26), W(0x0005933ae4579161),
+     W(0x0006befe0e507701), W(0x0007537838147422)}
+  },
+  {
+    {W(0x00055142c59d25f5), W(0x0001105332feb39d), W(0x0005a3b10bc1a673),
+     W(0x0002fef4bf5b0200), W(0x0006a73b1e2a603e)},
+    {W(0x00043f6ebcfaffcd), W(0x0007d7801e33722b), W(0x00041d7ad7f6053a),
+     W(0x00028882b8c39aa5), W(0x0006ea5ccc1efdb4)},
+    {W(0x0000000000000001)},
+    {W(0x0006b40e7b7d3aaa), W(0x0002ed80f45ab6d0), W(0x0001fc8596940ff7),
+     W(0x0007a1f8de11d710), W(0x00073db626767879)}
+  },
+  {
+    {W(0x0005224fa7c36d4e), W(0x0006fee2cfd444c8), W(0x0001c4a8061b718f),
+     W(0x000798676199ae1c), W(0x000728a71912cf9f)},
+    {W(0x000123d52809448c), W(0x000358c8b09e71f9), W(0x00064d5f1f4bfd7a),
+     W(0x000507b16eb4e0d1), W(0x0004ce95d59305cd)},
+    {W(0x0000000000000001)},
+    {W(0x0003326f0aab6e52), W(0x0004e7f20bc2b131), W(0x0004bc3e54dc55b8),
+     W(0x0005060e1db16a64), W(0x0005ed6fa57f0d44)}
+  },
+  {
+    {W(0x000544cb218af30c), W(0x000348d6ce5b8f28), W(0x000316d36d34d1d9),
+     W(0x0001985a3b2895e8), W(0x0005ca076f131f17)},
+    {W(0x00044971a4ebf223), W(0x000717a30b3a1a67), W(0x000533a8b44436d8),
+     W(0x0000441bc8bdcf71), W(0x000314d831f8052d)},
+    {W(0x0000000000000001)},
+    {W(0x00005a95bdbf4473), W(0x000161fc5e8eeceb), W(0x000451683a613716),
+     W(0x00038db78ff1b047), W(0x0003de3ac6441cf3)}
+  },
+  {
+    {W(0x0004d77227507e92), W(0x000086b032cd3ac1), W(0x00018aa9b22cd652),
+     W(0x0001b6798a8e3743), W(0x000599ba21b65ffb)},
+    {W(0x000250c48865a9e2), W(0x0000288bedc7777f), W(0x000737db77525f28),
+     W(0x000615b3cbf29f9f), W(0x00007f59b350f668)},
+    {W(0x0000000000000001)},
+    {W(0x000315c7ec09c488), W(0x00077b82b784940a), W(0x00025b1912c493d2),
+     W(0x00044e6d968654d0), W(0x00065d3b1c67481e)}
+  },
+  {
+    {W(0x000547b3e90fd924), W(0x0007ddcfda38cc36), W(0x0000e79dac9fc929),
+     W(0x00021ad1eb535548), W(0x00038e8656a191ee)},
+    {W(0x000514dbb2cd81b9), W(0x0000753c7497e180), W(0x0004c91f3cd6e3b8),
+     W(0x000428c12d6fb691), W(0x0006108f826d4e35)},
+    {W(0x0000000000000001)},
+    {W(0x0004b15c909f191d), W(0x00021477a3099621), W(0x0000837a2b04ba3b),
+     W(0x0000043574e36a9a), W(0x0000c102fc20d52f)}
+  },
+  {
+    {W(0x00014f2e5ac39b0a), W(0x0006028a707ce424), W(0x0006d0f0de9719a4),
+     W(0x00008e63e9a61f3c), W(0x000489994a7020b5)},
+    {W(0x000250dc9014efd6), W(0x00079d1c04181866), W(0x00016f91248ab8ba),
+     W(0x0002fb6ba98f2086), W(0x00063edfd90d25a0)},
+    {W(0x0000000000000001)},
+    {W(0x00059de38b3049b6), W(0x00049a097c8001a7), W(0x00066abb01eaa220),
+     W(0x00003fd248767c06), W(0x00027b0c9cbeed96)}
+  },
+  {
+    {W(0x00058fd4ba102ae2), W(0x0005a4ac9b89ea8c), W(0x0005345996607c1f),
+     W(0x00044093c9d1431a), W(0x000370ea71e862be)},
+    {W(0x000327c38694ebd9), W(0x00075adc83303a3d), W(0x00025fa52f724eaa),
+     W(0x000604ff04ba9383), W(0x000062a56b367413)},
+    {W(0x0000000000000001)},
+    {W(0x000721cf0140b26a), W(0x0006a09875c80ef8), W(0x000464bf4611ad36),
+     W(0x000377ddcd018544), W(0x00017b74fbf9c41d)}
+  },
+  {
+    {W(0x00065ee960076e98), W(0x00048ec7db186602), W(0x000545aaa9f6ad49),
+     W(0x00074fe7b8cea593), W(0x00054d4f4689f026)},
+    {W(0x00061ac91ebf3f1c), W(0x0003c2fa57e63210), W(0x000577e5eb3f0ef5),
+     W(0x000752b71f001f73), W(0x00002d067e10736a)},
+    {W(0x0000000000000001)},
+    {W(0x0005ae958be4a3aa), W(0x00021f563a55c8ce), W(0x0005fcc3ffa663aa),
+     W(0x00075b0093ff956d), W(0x00062e78bb35683a)}
+  },
+  {
+    {W(0x00049abc3d24f85b), W(0x00066fb0bd9b725f), W(0x0004f3f31d285f71),
+     W(0x00031b214bb49c24), W(0x0003e3fdb378d650)},
+    {W(0x000378b0ca5d124c), W(0x00051f98a8200430), W(0x000037c1c8fce5a4),
+     W(0x0002f01e1fabf61a), W(0x0003325dcc0b27de)},
+    {W(0x0000000000000001)},
+    {W(0x0007f18e0c8806e0), W(0x0004a37f6951e24f), W(0x0001c7e5f54754b0),
+     W(0x00058f08f56031ad), W(0x0004cad1a4d2fd60)}
+  },
+  {
+    {W(0x0005521993e486b7), W(0x0003d63b479b5f43), W(0x000218ba8d4156bf),
+     W(0x000511a3cfadcb38), W(0x00007df4e9107181)},
+    {W(0x0005527f64347f88), W(0x0007337ffb163b0b), W(0x00078ff5ec171897),
+     W(0x00068b532771b012), W(0x0003854a89f1b19e)},
+    {W(0x0000000000000001)},
+    {W(0x0001555a6a24feaa), W(0x000133b4808733cb), W(0x0003b1a55d37dea6),
+     W(0x0004747e772af1d5), W(0x0004daee63b85734)}
+  },
+  {
+    {W(0x00014976f6b8dde4), W(0x000194cd769cfc2e), W(0x0001c3799866d418),
+     W(0x00056199e96286ff), W(0x00001b57ba3e4b29)},
+    {W(0x0006c67e907acdd6), W(0x000534f4dc81e5ed), W(0x000090341735e84b),
+     W(0x0004c534364320b1), W(0x0002e7c5c5b7fb97)},
+    {W(0x0000000000000001)},
+    {W(0x0007312561b9ba98), W(0x00039edcd40f6859), W(0x0005e36fa26a9a6c),
+     W(0x0005424e36fb1e35), W(0x0002f9ad1ebf519e)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00015adbd82759f1), W(0x00039fe71e704bc2), W(0x0004fd5190fffbb4),
+     W(0x0002b2f7f6c0e8bf), W(0x00011cd80e1fdcbc)},
+    {W(0x0001ffe62822dbe0), W(0x0004c765a28833ac), W(0x0007a604d3c77c88),
+     W(0x0007d345cc07f722), W(0x00043f11943f7ef3)},
+    {W(0x0000000000000001)},
+    {W(0x000331c0057d0c78), W(0x0004c38c057bbc53), W(0x0004ac8d4395aa2d),
+     W(0x0007f75f6af8ad21), W(0x000040d7a188a549)}
+  },
+  {
+    {W(0x0000de50a100f3ee), W(0x0001a7919c6036d8), W(0x0003b73562c348c5),
+     W(0x0004d4c077bd2508), W(0x000068c33d8f3321)},
+    {W(0x0002d830ff4f7dcb), W(0x00019f20c3872762), W(0x0006505ad5c4d4d1),
+     W(0x0006d26f08f76fb3), W(0x0001032a93593881)},
+    {W(0x0000000000000001)},
+    {W(0x0004c4de2b12db52), W(0x000302a637ba0b32), W(0x0003cfc21c94c1fa),
+     W(0x0006c72869372176), W(0x0001bb2dd101993f)}
+  },
+  {
+    {W(0x0002fc5c7bbcc3e9), W(0x0007575ca5f93f36), W(0x00056dbce192ac2c),
+     W(0x0006a6f6326d49a5), W(0x0004847babbf5a03)},
+    {W(0x0003a2231f45bc60), W(0x0001f332fccece07), W(0x00039e68c19d51dd),
+     W(0x000612289766eb33), W(0x0007e6ffe114a422)},
+    {W(0x0000000000000001)},
+    {W(0x0005c5ac20c32aa8), W(0x00022573eeb686ee), W(0x0001445078f4d272),
+     W(0x000391bc03e7a203), W(0x00035524ad9c30be)}
+  },
+  {
+    {W(0x00046fa3f0b1c087), W(0x00039dee41553261), W(0x000139aa9cd596f9),
+     W(0x000397f41190df96), W(0x0001eac17c83ec79)},
+    {W(0x0006cc40e521ef7b), W(0x00078f52f7badb83), W(0x0001b96895ea19d5),
+     W(0x00012d8d9e28f2be), W(0x0000419a160079a8)},
+    {W(0x0000000000000001)},
+    {W(0x00036e8cbcb0af55), W(0x00006f9903ca4fc3), W(0x00066468b9027c57),
+     W(0x00062d47ff8a65d7), W(0x00041499652bcd97)}
+  },
+  {
+    {W(0x000085b7d9bd4f36), W(0x00002a6ca95846fe), W(0x0000a666b5c41e6e),
+     W(0x0002829e329b9921), W(0x0007ddaf40ada2c8)},
+    {W(0x00073dc222370568), W(0x0005f3c7ed95eafd), W(0x0002a6fd9f527837),
+     W(0x000646b81673e2bc), W(0x00044f594d1cdef9)},
+    {W(0x0000000000000001)},
+    {W(0x0000f1b8150eb819), W(0x000068944ee659a1), W(0x0007ac3002cf374f),
+     W(0x000577c18f8aa455), W(0x0004be9ca5bb2488)}
+  },
+  {
+    {W(0x0007be1da7af1f38), W(0x0007a08766e58d54), W(0x00014f33d9fca89c),
+     W(0x0004c3212b2b3178), W(0x00039d5a04586d73)},
+    {W(0x0005affc5b1121f7), W(0x0000dae3b63a45b0), W(0x000176fb28474095),
+     W(0x00016fdfb64facf6), W(0x0002e986c4a9a938)},
+    {W(0x0000000000000001)},
+    {W(0x00046e07a79206e2), W(0x000657d7f281b7cf), W(0x00068461fe27f68c),
+     W(0x000527978893ed69), W(0x0002a0432c399829)}
+  },
+  {
+    {W(0x000079b0706d2ac3), W(0x0001c6ef26a74806), W(0x00031033314eed0f),
+     W(0x0000988345ada795), W(0x0001b595d7292017)},
+    {W(0x000363cfaa41c09c), W(0x0003913b0a66e721), W(0x000174a79eb39d73),
+     W(0x0006f4710c0c29fa), W(0x0002d515b166a907)},
+    {W(0x0000000000000001)},
+    {W(0x0001791a7f8256cb), W(0x0002e911a15966fe), W(0x0001cc48aa5bd1aa),
+     W(0x0000cad699dba01e), W(0x0004379466dcac8f)}
+  },
+  {
+    {W(0x0002e38faba68896), W(0x00055ce69fdf0927), W(0x00015dd09903fac9),
+     W(0x0005aee74cea7b26), W(0x0004ee45ad6672f7)},
+    {W(0x00062555bdb3825c), W(0x0007b8c054926d5e), W(0x0003effd6caec571),
+     W(0x000363482080fc2b), W(0x0007041a7fe4facb)},
+    {W(0x0000000000000001)},
+    {W(0x0002a29d41f84299), W(0x000469c835c78123), W(0x0006e3abf9dc9005),
+     W(0x00033f9d20e9824e), W(0x00045418e232c860)}
+  },
+  {
+    {W(0x00032245759448aa), W(0x000390253ae3311f), W(0x000396d8fb2ddb8e),
+     W(0x00064f2ddb5d98ae), W(0x00003da16b34e00d)},
+    {W(0x000521d2de5a18d9), W(0x0002269fb0e2135f), W(0x00040fa17d987db1),
+     W(0x00018f0c527483c4), W(0x000760d116d1e644)},
+    {W(0x0000000000000001)},
+    {W(0x0006cdbbfeef3fb4), W(0x0002a7e7ed1de054), W(0x0007b5354df10768),
+     W(0x0004b085ba7258a1), W(0x0001764521ab536c)}
+  },
+  {
+    {W(0x0001a3be98e102ee), W(0x000321625b97c1f8), W(0x00065fbd6c8e3fd8),
+     W(0x00057c8fff5058ae), W(0x000517701be8bc34)},
+    {W(0x0003553a5cd63228), W(0x00029394479c8bef), W(0x0003dd4a223b9838),
+     W(0x0003959d1fd26058), W(0x0007167afef1dd45)},
+    {W(0x0000000000000001)},
+    {W(0x0000b064ec7680e2), W(0x000014b8c5de54e6), W(0x0004a04f20a0cda1),
+     W(0x0005161b663cf766), W(0x00045ed5264bf0d9)}
+  },
+  {
+    {W(0x0004cacd5265597b), W(0x0007677041013931), W(0x0005fc631c95457c),
+     W(0x0003df398161b69e), W(0x000770a5ea609fcf)},
+    {W(0x00001b07b9910659), W(0x00041a2404b899ce), W(0x000420d04dbf5778),
+     W(0x000720f7bb84328d), W(0x00061a06d94c975c)},
+    {W(0x0000000000000001)},
+    {W(0x0003f4cec43ffee1), W(0x00019d07ee505db8), W(0x00014258df493d0d),
+     W(0x00060bc96604f1bb), W(0x0001d5d10cedf17e)}
+  },
+  {
+    {W(0x0007231b9a0ce0d1), W(0x0004070c32acecda), W(0x00032ed8ff729a11),
+     W(0x0000ef27fb9bee62), W(0x00006909d09bdb25)},
+    {W(0x0000d53640ea84cf), W(0x00078dc3f08c15c7), W(0x00039d14fe8f6b07),
+     W(0x0001bdb62557bd92), W(0x0006f607d6928e47)},
+    {W(0x0000000000000001)},
+    {W(0x000313cbf10157d0), W(0x00016ff2f14bd36e), W(0x0000652cb99f689b),
+     W(0x0002b774582d29b9), W(0x0003803ec452b606)}
+  },
+  {
+    {W(0x0002cba9c9323b2b), W(0x0005995d7076d59c), W(0x00058c4645cc26b4),
+     W(0x0004d74100597b5e), W(0x0002e788360367ee)},
+    {W(0x0005309ef1ab0690), W(0x0004490386f0d5e5), W(0x0002aa945c96c13c),
+     W(0x000120f0cdd2dc9a), W(0x0002be9e2d49d15d)},
+    {W(0x0000000000000001)},
+    {W(0x00067c13575b46e4), W(0x0004260529aeaf34), W(0x00063e9986fb2957),
+     W(0x000443b22c6a78af), W(0x0007d580bff9f24f)}
+  },
+  {
+    {W(0x00045f111a05a4cd), W(0x0005983a3e786c23), W(0x0005dc0455a106e7),
+     W(0x00059bf0ff33326a), W(0x000015d4d9568be6)},
+    {W(0x0002540cff69dfde), W(0x000739b3c49cb71d), W(0x0007a84c5976abcc),
+     W(0x0007a87999843d1c), W(0x0000e99c2ba1f380)},
+    {W(0x0000000000000001)},
+    {W(0x00010f275ad8a77d), W(0x0004662f7d41a70c), W(0x0002d47bf8bca0ae),
+     W(0x000289edef82bdc8), W(0x000411190b14f5c9)}
+  },
+  {
+    {W(0x00005ec1ef438549), W(0x0006f95212ef0a95), W(0x0002d657c2b133d9),
+     W(0x0007c7e33b70b0b9), W(0x0002c3c572e2f4d1)},
+    {W(0x00041d931adfbd7a), W(0x00024de9ca79e0f0), W(0x00014f0f971b777f),
+     W(0x00076f46ddf043df), W(0x000003a0641895de)},
+    {W(0x0000000000000001)},
+    {W(0x000259d3fe99f25d), W(0x0002c0ce34d15779), W(0x0005e13cccc6a18d),
+     W(0x0006b6982c73f661), W(0x00030c6a4c77e2b1)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000723d42c9bfadb), W(0x0004c0ed8c71458c), W(0x00014f480f093d20),
+     W(0x0004a3b8b2f69410), W(0x0003328bc121616a)},
+    {W(0x000333cdfafac039), W(0x000232736ed2f8e8), W(0x0005319c6317adca),
+     W(0x00065939f2fa7808), W(0x0002bbf3f26c21b5)},
+    {W(0x0000000000000001)},
+    {W(0x0007f32b5f405db1), W(0x00079e8dbb6f6071), W(0x0005199bc11bff31),
+     W(0x0006aa290ba1ea39), W(0x00052e3fbc9dca56)}
+  },
+  {
+    {W(0x00076fc37c90a733), W(0x000542ee4cf414a2), W(0x0007077a0c518dfb),
+     W(0x0000f9bd192096b8), W(0x0003646a62ad82bd)},
+    {W(0x0003b8f97c6bccac), W(0x000671efba0b8111), W(0x0004032a1b6883a9),
+     W(0x0004f474a6b9d6e3), W(0x00024dd06031fdaa)},
+    {W(0x0000000000000001)},
+    {W(0x0000a317e4b38b2a), W(0x000723df163376a4), W(0x0000b19cd35f74d9),
+     W(0x000076c5c5bcac72), W(0x000421e4b4b514c2)}
+  },
+  {
+    {W(0x0003143712372646), W(0x0005066f24482e5e), W(0x000715c90f9b9e3e),
+     W(0x0005bb5858157a21), W(0x00065a10ff6a067c)},
+    {W(0x000669777c684d1b), W(0x000213883cbaabd4), W(0x0005fbb31ae52c4d),
+     W(0x00065f0e5e478f14), W(0x0003607014f6a64e)},
+    {W(0x0000000000000001)},
+    {W(0x0001ed4f0d4ed2c6), W(0x00018298a22c6bf6), W(0x00028b06939ac749),
+     W(0x00040aecd9d24195), W(0x00024394e3f3b716)}
+  },
+  {
+    {W(0x00052a980a61b29c), W(0x00016cb5953ddaf4), W(0x00061772fb88782b),
+     W(0x00029a2bd34e07ac), W(0x0003c0c1e7beb87a)},
+    {W(0x0000b50d6384bd2f), W(0x000698d273c97e14), W(0x0000bc65cffcd268),
+     W(0x000318c91622aa37), W(0x00074e826b2f1347)},
+    {W(0x0000000000000001)},
+    {W(0x0003e242a23dd94e), W(0x0006cdbd4e18ed9f), W(0x00052cf7bbecde42),
+     W(0x0000c4d1cae2dca9), W(0x0003a488c40b771a)}
+  },
+  {
+    {W(0x000748fe1a825c77), W(0x00021514a7862c84), W(0x00034c40dc979953),
+     W(0x000052999cbd4a7a), W(0x000579ac4b521848)},
+    {W(0x0002b413d28a281d), W(0x00060c9f45a12b5c), W(0x0003f1dd08f82872),
+     W(0x00057e772b88cc31), W(0x00062bfb93d6971c)},
+    {W(0x0000000000000001)},
+    {W(0x0001c0980b1c3325), W(0x0003e203a0927754), W(0x0005d686e2df38fa),
+     W(0x000787a7756ab550), W(0x0000445bd53058b9)}
+  },
+  {
+    {W(0x00019eaf801c2154), W(0x0001be0322c74e42), W(0x00053201cb48f8a9),
+     W(0x00042e4f4ad023a1), W(0x00061eee376f0dc8)},
+    {W(0x00017efbf8b38931), W(0x0003251e4b970675), W(0x000517806e2abde0),
+     W(0x000629fa3a1464e3), W(0x0001f2abf8d3ed6e)},
+    {W(0x0000000000000001)},
+    {W(0x0004cad2bbbb2831), W(0x0003c99140b4a150), W(0x0000f14bcceff186),
+     W(0x00066a23d657c527), W(0x0002d1acf2194ccf)}
+  },
+  {
+    {W(0x0007114d8a25906c), W(0x0004caf6d59c324a), W(0x000390d2cfa230c3),
+     W(0x000601e8430d6319), W(0x0003d12191c75243)},
+    {W(0x00044e5e9acdfe83), W(0x00030c658bfb78b8), W(0x0007ad78f301fee4),
+     W(0x0003c5e4cda71e2b), W(0x000467965880e34c)},
+    {W(0x0000000000000001)},
+    {W(0x0000d9fc7e9e4f36), W(0x0005293e1510e25e), W(0x0007b555bfa2bc47),
+     W(0x0005dbfe61ffd5c2), W(0x00013dd2778b6c11)}
+  },
+  {
+    {W(0x00044c0c6d90670a), W(0x0002abd4f7bcd819), W(0x000688466d633631),
+     W(0x00029e0221d8a5dd), W(0x00053b1cdfe23ed5)},
+    {W(0x0000af01f575fb05), W(0x000685209f8b0e47), W(0x0001b94022899de8),
+     W(0x0000725c6ab995e8), W(0x0005ca6df45ad963)},
+    {W(0x0000000000000001)},
+    {W(0x0002ec86a5d5f373), W(0x00074658c955ef7a), W(0x0004bb8db4c45551),
+     W(0x0004245dd12f621c), W(0x0004ce669e485bee)}
+  },
+  {
+    {W(0x00023b3b8fba928e), W(0x0006e0ec61863ac0), W(0x00023abb8a112195),
+     W(0x0007dc87ee3d60b7), W(0x0003502139244be2)},
+    {W(0x0004e1333016a2a5), W(0x00066d4e82452eb9), W(0x0004ad96584466f1),
+     W(0x0005a4f105698ce3), W(0x0003eab188f99c4a)},
+    {W(0x0000000000000001)},
+    {W(0x000408065d71edac), W(0x000271d02dcb79c2), W(0x0007190748f2d58a),
+     W(0x000470f935774350), W(0x0004bef626f858f2)}
+  },
+  {
+    {W(0x0007c07b0e8a5724), W(0x00053b3579132376), W(0x00018f17f33e0049),
+     W(0x0000047f6bc4f27c), W(0x0001a90f3fe15c79)},
+    {W(0x00054fa122363207), W(0x000470528fdeded8), W(0x00055ddd122e78b6),
+     W(0x00074f5228f7c54f), W(0x0004d85c3585e4ab)},
+    {W(0x0000000000000001)},
+    {W(0x00009f95ca744f9c), W(0x000040b07a5bb335), W(0x00041e63603698cf),
+     W(0x000555873d84a14d), W(0x00009bca518a5eb6)}
+  },
+  {
+    {W(0x000100fd6869912f), W(0x0002c1f36bdb8180), W(0x00030209ec3d9ba7),
+     W(0x000558aec62f32a5), W(0x000194a99204d571)},
+    {W(0x0004fcdd701e2f03), W(0x0007a74e8971000f), W(0x0005f850e0925330),
+     W(0x000154a1a4620cdd), W(0x000701398f4cbed0)},
+    {W(0x0000000000000001)},
+    {W(0x000123efb0bf3abc), W(0x0003485a0162d990), W(0x00060b8e2c300050),
+     W(0x0006f1ace6b202b2), W(0x00018b62c4455d61)}
+  },
+  {
+    {W(0x0000dc7e901a880d), W(0x0005cceba5f83fdb), W(0x00050d55bfb4bd9f),
+     W(0x0002e9a11a8a43af), W(0x000761a85d3d5ae7)},
+    {W(0x0005b0e16ea0c887), W(0x00079dae26894d55), W(0x00017129940d1359),
+     W(0x0003581f927a822e), W(0x00020c5d2b28c5e1)},
+    {W(0x0000000000000001)},
+    {W(0x0003b26d1c2b3a59), W(0x0005e3767be0d75a), W(0x0004c96b29fa087b),
+     W(0x000671893b01c73c), W(0x0005ceac254ad607)}
+  },
+  {
+    {W(0x0000afa906f45e4c), W(0x0007c1f4b529c3ff), W(0x0006e461b50fb2b5),
+     W(0x0001e562f36ce205), W(0x0000cd539845ab8b)},
+    {W(0x000343e36773fffe), W(0x00050b9ccf6c1553), W(0x0003c86ac4bbfa44),
+     W(0x0003eb2070161066), W(0x0005fc99a2f11f43)},
+    {W(0x0000000000000001)},
+    {W(0x0002ec4fa74a7e9d), W(0x0004582550163cf2), W(0x000589d03b9c5af9),
+     W(0x0002769c0d39a10f), W(0x00062ba4b407cdd4)}
+  },
+  {
+    {W(0x0006ea943b224571), W(0x0007df5ce1b8c314), W(0x0005aa7a733968b9),
+     W(0x0004a1d7fb1d4a65), W(0x0006393158968788)},
+    {W(0x0001b868240e5674), W(0x0005d28acc492227), W(0x0005f691bcb63560),
+     W(0x00076678741cab2a), W(0x00073229cd84e78f)},
+    {W(0x0000000000000001)},
+    {W(0x0007a3528d3f7104), W(0x00028cd10c0e9701), W(0x000180080f1bc269),
+     W(0x00027aea1fd5cdda), W(0x00042cd5ab0c5bfb)}
+  },
+  {
+    {W(0x00079444ef4d5b8e), W(0x00075b8bf7e20850), W(0x00056f51967b89cf),
+     W(0x0004ff6ade9060e0), W(0x0000a969921a01e3)},
+    {W(0x00050e10e1de14a5), W(0x0006e693885e3799), W(0x0004b4c1f21a8020),
+     W(0x0001bd5ce05eb148), W(0x0001aa01b368c786)},
+    {W(0x0000000000000001)},
+    {W(0x0000897dad6227e5), W(0x00043c9fc8b223fa), W(0x0005a32fbd4e9005),
+     W(0x0002f846e2cf6d7f), W(0x00019ee691563388)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000041a037c28398), W(0x00075917ebeb8915), W(0x0007daf4b1678093),
+     W(0x0004026573443f40), W(0x0000ba774bb605dd)},
+    {W(0x00037a77bf911321), W(0x0003a14720fd3786), W(0x00051fba684019f7),
+     W(0x0006e6fdad0a8db9), W(0x00054ba013ad2d04)},
+    {W(0x0000000000000001)},
+    {W(0x000221c0eb482e60), W(0x00035b9b18a359ff), W(0x0004eca6d2899428),
+     W(0x00022e0fedad0479), W(0x0005742418ee3cc5)}
+  },
+  {
+    {W(0x0002200b4a39d548), W(0x00012bd040f4086d), W(0x0004ddf3c51f25f1),
+     W(0x000622a335f791dc), W(0x0006e6b14df76458)},
+    {W(0x0007764c29cac942), W(0x0003074f85b15b46), W(0x00046ae6d6d00fc9),
+     W(0x00054eb5afef1689), W(0x00030f3b35dc952b)},
+    {W(0x0000000000000001)},
+    {W(0x000230bbc85c27a7), W(0x0005ca08f446639f), W(0x00018ad3c9e81a19),
+     W(0x0001246d641f076f), W(0x0006153e59b1034f)}
+  },
+  {
+    {W(0x000237215a89114e), W(0x0004ae8bdb7a454c), W(0x0005bba3a9ac295c),
+     W(0x0000d5bcb36ea31d), W(0x0006801c75b1a97e)},
+    {W(0x0000c57907f7aa57), W(0x0005aff49f86ea89), W(0x00023690d6de72df),
+     W(0x0001215c33b1ba70), W(0x00043c48edace257)},
+    {W(0x0000000000000001)},
+    {W(0x00000ff9bccf6656), W(0x000566a2dbdfe913), W(0x00018e187d2ca2cb),
+     W(0x00053696c3bbdc0c), W(0x0001c5188455cd26)}
+  },
+  {
+    {W(0x0007620c6bfe6f4c), W(0x000730b63dee291a), W(0x00024c22c493b701),
+     W(0x000775c71c7bc73b), W(0x000496490af4080f)},
+    {W(0x00044498c1da884a), W(0x000257297b69ca67), W(0x0005d7bc1023357c),
+     W(0x00057d03f29d58f3), W(0x0007f6410727b65c)},
+    {W(0x0000000000000001)},
+    {W(0x00003cc5022a31b8), W(0x0007ff2852a7d4aa), W(0x000663a020e9f653),
+     W(0x0002806ded5f588a), W(0x000200285c50cca1)}
+  },
+  {
+    {W(0x00013ab1d4233b6b), W(0x000747f3ca5055b4), W(0x0002614701c587f3),
+     W(0x00070525e100c869), W(0x0002aa4bc7d1d25f)},
+    {W(0x00034e95bf1a6a51), W(0x0002906964ed3f80), W(0x0005356a2f63da54),
+     W(0x00019ea58b3f37a0), W(0x0001a91d65a2e22b)},
+    {W(0x0000000000000001)},
+    {W(0x0003059d1449261c), W(0x00064e9d6dea0183), W(0x0003c64905f33d70),
+     W(0x0006a313be8b20b4), W(0x0002cdffc2636f02)}
+  },
+  {
+    {W(0x0000fd16ebf0813d), W(0x00041f634f91a66b), W(0x0004ceee43ba28b0),
+     W(0x0000c2ccc774a2b6), W(0x00046b5f1c51f08e)},
+    {W(0x00033fa04b43e7e4), W(0x0004c7b5c2f740c5), W(0x000445d3b6e2f73b),
+     W(0x00077198ff4b761a), W(0x00020cb1dc94e7a0)},
+    {W(0x0000000000000001)},
+    {W(0x00043de37ad7a95a), W(0x0005e2285ebd4c3c), W(0x00022ade3a49a174),
+     W(0x00036a372f09f371), W(0x0006adc2a3bbe54d)}
+  },
+  {
+    {W(0x000559f33df34b15), W(0x000796f265a2727a), W(0x0002a3ec238f1dd6),
+     W(0x0006d75fb58f4884), W(0x0006a39b751f1562)},
+    {W(0x00069ce7aa3009a3), W(0x0005bfd87dab4329), W(0x000394f322166b69),
+     W(0x0001c06dfcfbd2ed), W(0x000727298b3e04d0)},
+    {W(0x0000000000000001)},
+    {W(0x000039afde043815), W(0x0001cac0a739e5fa), W(0x0002bea775e92936),
+     W(0x0000a22b4be56faf), W(0x00023f2de82a1f2d)}
+  },
+  {
+    {W(0x000496db7be967e0), W(0x0002062b3a06560b), W(0x0004e026b25e4b72),
+     W(0x0003682eeb3f0798), W(0x000075bf0ea1fb60)},
+    {W(0x0002416bdec79f81), W(0x000207ceece286a4), W(0x000729321766c206),
+     W(0x0003d56b2c821fcd), W(0x00043ba373488c31)},
+    {W(0x0000000000000001)},
+    {W(0x000387415c090bb2), W(0x0006f02c4dda94c2), W(0x000715d27a87147f),
+     W(0x000762813ff7fdcf), W(0x0000cb7376fc49fb)}
+  },
+  {
+    {W(0x000748407caf22cb), W(0x000446835ed5532d), W(0x000532443429bdaa),
+     W(0x0005798fa62b94ba), W(0x000256b5c55ee53d)},
+    {W(0x000679081f2f0d70), W(0x0001fe5371c7b82e), W(0x0005104c950eb8f0),
+     W(0x00027f4f75da01f4), W(0x0000c23f56c71e70)},
+    {W(0x0000000000000001)},
+    {W(0x00009e514bbb7ac0), W(0x000170100559584f), W(0x00018faed9ecfd3a),
+     W(0x00003dbd1d8a6f9e), W(0x0007963042b5be01)}
+  },
+  {
+    {W(0x0001e959b9b6ef91), W(0x0007ea3176fd9295), W(0x00030877193f36b3),
+     W(0x00071858f0197d92), W(0x00006c33ccbd8934)},
+    {W(0x000799b48b38b7d7), W(0x00044c97947844fd), W(0x00020711069c02d1),
+     W(0x00055e14b44b20f8), W(0x0005be325cb78206)},
+    {W(0x0000000000000001)},
+    {W(0x0007ab2abebecec3), W(0x00047f9e3ebee981), W(0x0003cd727af13079),
+     W(0x0003fc45337af941), W(0x000380cdf776bb94)}
+  },
+  {
+    {W(0x0003eabe2c033dc5), W(0x00035a09425956db), W(0x00057d917f145bd9),
+     W(0x0002159f55710e9d), W(0x0006d013f779f44b)},
+    {W(0x000156e68a3108c6), W(0x0004cc651e8a22e9), W(0x0007be257e515ab6),
+     W(0x0003cae7a7cc9840), W(0x0003e9b91aa59476)},
+    {W(0x0000000000000001)},
+    {W(0x00067a36377d6af8), W(0x000240a127a74fda), W(0x00037daa0eb45696),
+     W(0x0003182d24316cd9), W(0x00048634bcb5c8ac)}
+  },
+  {
+    {W(0x00021e09f622c4ce), W(0x00005f379bc00feb), W(0x00046d7bef365271),
+     W(0x0000ddf7e90d34c5), W(0x0005210d05a04e13)},
+    {W(0x0002e76737331956), W(0x0007a0f85a35fba0), W(0x0000c0a3b93c0eeb),
+     W(0x00051255496dc82f), W(0x000141765c5cb7bd)},
+    {W(0x0000000000000001)},
+    {W(0x0007efe21355859e), W(0x00050595fd6c9106), W(0x00007306a6808520),
+     W(0x00017d4c97a0fe64), W(0x000791a58bd78b67)}
+  },
+  {
+    {W(0x0005eaf955eeb7a8), W(0x0002ca25729f35df), W(0x00037077d49e3c23),
+     W(0x00006218f094bc6a), W(0x00048ec78732e271)},
+    {W(0x00029971cd923502), W(0x0001b24fd476a602), W(0x00059cd384b9f3c9),
+     W(0x0007dd53efb85098), W(0x00029f69b5d8d17b)},
+    {W(0x0000000000000001)},
+    {W(0x0002e5781d415b77), W(0x0006832fbf8b2d49), W(0x000019b85b5a8934),
+     W(0x000752ed5441561c), W(0x0005f55381ff9710)}
+  },
+  {
+    {W(0x00025741e82d3b78), W(0x000303b49d63c3df), W(0x0003a6aaa19d5575),
+     W(0x0000f3ced36f9217), W(0x0005007f2448bd89)},
+    {W(0x0000387e522214d1), W(0x00071a4c0e3ffb5c), W(0x00073569c05e45a7),
+     W(0x00078d43bd847dda), W(0x00075125f9ca896d)},
+    {W(0x0000000000000001)},
+    {W(0x000348b1dd597af3), W(0x000421caba824ba8), W(0x0007e4ebfc25fefa),
+     W(0x000089b7a3124b4d), W(0x0007d5349c4926a7)}
+  },
+  {
+    {W(0x0005479b62a40b60), W(0x00039fdd4db3e303), W(0x00030649d75bfacf),
+     W(0x0003d61d06744338), W(0x0004ea61e5985e0a)},
+    {W(0x00017ab6111f7e45), W(0x0000a6085d4ad66e), W(0x000617399320ef64),
+     W(0x0006e7b8883f55a9), W(0x0005f445a99804ac)},
+    {W(0x0000000000000001)},
+    {W(0x0004ab76260371db), W(0x00050812e0cc6d4d), W(0x00004b2a8a320647),
+     W(0x0005dfe307f5cabc), W(0x000093763071e4d1)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00049581c869b64c), W(0x0000879d26924672), W(0x00008a70dd68f436),
+     W(0x0006e15a6732d550), W(0x0001074ff0267662)},
+    {W(0x0001efc7e6d5b022), W(0x0000168c1b4274f6), W(0x00025dc041f50b06),
+     W(0x0007614491ed2682), W(0x000299be0decb680)},
+    {W(0x0000000000000001)},
+    {W(0x00026cf566ba49ff), W(0x00076d195c2798ee), W(0x000524546781cec2),
+     W(0x0002ad0a0b1ea1f6), W(0x00072cdb0f5241f7)}
+  },
+  {
+    {W(0x00062b362a42fe33), W(0x000039916b8c86c5), W(0x0007a09e842055aa),
+     W(0x0004ac79473c72ab), W(0x0003e63c4ae42121)},
+    {W(0x000680caa79c9678), W(0x0003808f9630a055), W(0x0007b6eb04996f05),
+     W(0x0004464642b82cd2), W(0x0003599286aac87e)},
+    {W(0x0000000000000001)},
+    {W(0x0003c232529483e8), W(0x00006366c466c9a3), W(0x00079fe2de6f62ba),
+     W(0x0002b9bb2d49e4f4), W(0x0007231c6668b931)}
+  },
+  {
+    {W(0x000287be2808049f), W(0x0001b3fbc705101b), W(0x000518bbed8b8f93),
+     W(0x0004ea28835980c6), W(0x0001eade2fa113b1)},
+    {W(0x0003ae0a699920a0), W(0x0000b6f00c89ce14), W(0x0001550d0d521e72),
+     W(0x00053254be46b6c0), W(0x0006cc8d8212e6cc)},
+    {W(0x0000000000000001)},
+    {W(0x0004751a911b11e4), W(0x000295d0471399ba), W(0x00035b4f1cf85c19),
+     W(0x0001931a42a79935), W(0x0001d502ac295870)}
+  },
+  {
+    {W(0x00017508ad074a91), W(0x0000cdf8765489f8), W(0x00059ead4b3ac4f9),
+     W(0x0006ebb635a42a04), W(0x00031ddffcb76711)},
+    {W(0x000736f0fdfa8836), W(0x0002ba0a110e80ed), W(0x0005901cb92128e2),
+     W(0x0006938d00bb08cb), W(0x000221c9b9a258e4)},
+    {W(0x0000000000000001)},
+    {W(0x0002f18301cb23d6), W(0x0003fcc1df2263c2), W(0x0003a9691492e47a),
+     W(0x0000604b4b2b0c9d), W(0x0005075eca6a23ba)}
+  },
+  {
+    {W(0x0005d57ccf82cd76), W(0x000191ac38152a73), W(0x000527db82fb2d30),
+     W(0x000298d4ffa67db4), W(0x0004af6009911d4f)},
+    {W(0x0001a6e40365167c), W(0x0002746419610dfd), W(0x000153e95df1a57a),
+     W(0x000022bf1f6cf605), W(0x0001ea69bf6f0ee1)},
+    {W(0x0000000000000001)},
+    {W(0x0007ef2931f0190a), W(0x000080a30905d02a), W(0x0002b8d51e4bc042),
+     W(0x0003ca1c517dfac4), W(0x0003d4b830fd200f)}
+  },
+  {
+    {W(0x0007a92bd11bba55), W(0x0006c23a2371bcd6), W(0x00035bcff65a49e6),
+     W(0x0002fbfd0c597d5f), W(0x0001ed4bfcc333a7)},
+    {W(0x0003506e47909a5f), W(0x0004d66972f03198), W(0x0000286327e683fc),
+     W(0x0001d118b8849c47), W(0x00073d969f556be7)},
+    {W(0x0000000000000001)},
+    {W(0x00033eac59de6037), W(0x000255e3d531c012), W(0x000688883dd7d2bc),
+     W(0x000131534f09ff2d), W(0x00063f3615389d11)}
+  },
+  {
+    {W(0x0003683fcba71031), W(0x000202c546ccb866), W(0x00007e7b4570962d),
+     W(0x000715e4d1647212), W(0x0003a4ba693d760a)},
+    {W(0x0007961ef3ecbb5d), W(0x0000241543ff2f21), W(0x00008a085d8ae874),
+     W(0x00017e8ba6de5d32), W(0x000438b99022fc52)},
+    {W(0x0000000000000001)},
+    {W(0x000423c9a1f4d50e), W(0x00023a5096d52e41), W(0x00076a86a9de64d9),
+     W(0x0006bcb921c38224), W(0x00064b52040fc598)}
+  },
+  {
+    {W(0x0006ac0f0ebd57be), W(0x00020575ae346ecb), W(0x0005775567b00914),
+     W(0x000659a612e62254), W(0x0006b265507695b3)},
+    {W(0x00032951a7d46b30), W(0x0005f0454eaf5f3c), W(0x00075600ae647758),
+     W(0x0005fee54e8a8f33), W(0x0003f7f093597ace)},
+    {W(0x0000000000000001)},
+    {W(0x0005802e669e434b), W(0x0004c30a012877cf), W(0x000219a698b0a420),
+     W(0x00079267db8cc90f), W(0x0007eb2b724d0599)}
+  },
+  {
+    {W(0x000053d894fdae96), W(0x0004ef5624d8a008), W(0x00007013bdaecddb),
+     W(0x00030892f6dc73a2), W(0x000768aca6f0ceb8)},
+    {W(0x00033eddb66e3333), W(0x00011e3da99f8f73), W(0x000406f700a23337),
+     W(0x00017dbe53472d45), W(0x00075a45a1187ece)},
+    {W(0x0000000000000001)},
+    {W(0x0003cb83bada7f17), W(0x0003aa9eb759d12f), W(0x0006a1025ac0133d),
+     W(0x000563c52db09402), W(0x0005b3d55205e635)}
+  },
+  {
+    {W(0x00044eb7e46b10cc), W(0x00046d43d0a2ef92), W(0x00013b2463212780),
+     W(0x000428f8434ed9fd), W(0x00023c3c285be8f1)},
+    {W(0x00070db357dfd26c), W(0x000512348c1f48e3), W(0x00070ac4a5cfd086),
+     W(0x000187ae6167b1f8), W(0x000071e0956f4753)},
+    {W(0x0000000000000001)},
+    {W(0x0007083d3c627cb3), W(0x0001bca54dce3f54), W(0x00067b6983554c45),
+     W(0x000277f4810d298a), W(0x0007723d28b45c71)}
+  },
+  {
+    {W(0x00058c65cf82138f), W(0x0004b48e0f57ffab), W(0x00034bcf9306105f),
+     W(0x00032c2c3c4f79c8), W(0x0006d9b1211e4baa)},
+    {W(0x0002d5c80357e838), W(0x000510e9c1cdc0f7), W(0x00022015e394adc4),
+     W(0x0002c26f23136cf6), W(0x0001156c4d28d23e)},
+    {W(0x0000000000000001)},
+    {W(0x000337fe35e87988), W(0x00075f4c310d4e51), W(0x000121d3453ce1ef),
+     W(0x00031fd865ac689d), W(0x0005abf9237aad52)}
+  },
+  {
+    {W(0x000320ecb7130f29), W(0x0000fc381c3fb975), W(0x00070f14f466e200),
+     W(0x0001f5fdea6a1b20), W(0x000020f1d4998554)},
+    {W(0x0003c332fe4ccb11), W(0x000655c37547bed1), W(0x000188384cc9983a),
+     W(0x000408f64eef4cee), W(0x0000b5d0fa001250)},
+    {W(0x0000000000000001)},
+    {W(0x00068e99a1c4b9a0), W(0x000033593ec5c1a5), W(0x0003df479118b201),
+     W(0x0003e8198d62e30d), W(0x00025efcf35d1e5d)}
+  },
+  {
+    {W(0x00059d28118d71e5), W(0x00058654a9d235ff), W(0x0003dbc77e6d5d82),
+     W(0x0005b54d1b022c96), W(0x000067d5270d7d74)},
+    {W(0x0006a8c338bace9b), W(0x00027daa0fce5980), W(0x0006516aef21b263),
+     W(0x0001e04e805da2d7), W(0x00035070ad4e8f16)},
+    {W(0x0000000000000001)},
+    {W(0x000156af2e95564b), W(0x0001ae5f15bdf9d1), W(0x0006b4bc845682cd),
+     W(0x00038d86f5deb39d), W(0x000053abd130ed2d)}
+  },
+  {
+    {W(0x00002c1e62166848), W(0x000664d14f8305d4), W(0x00055e3cc9c54923),
+     W(0x0002de1999787366), W(0x0006eea049783720)},
+    {W(0x00040cd6c181dab3), W(0x00065c230178e6e6), W(0x0000f6a85ba77ff1),
+     W(0x0004ca11ac78089e), W(0x000427c81011fde7)},
+    {W(0x0000000000000001)},
+    {W(0x000424f0c3d77bf1), W(0x000113b853c8251e), W(0x00064e379f08f761),
+     W(0x00009705ad597b03), W(0x0002268ce66f33b0)}
+  },
+  {
+    {W(0x000152a06c3c422a), W(0x00052fd92c488c1d), W(0x0007ea8aa5d58002),
+     W(0x00068cd8e62001a1), W(0x000031609d35c27e)},
+    {W(0x0005990957cffa52), W(0x0002854186a2f3b4), W(0x0000d58bd58b0870),
+     W(0x0004ebd905d657f5), W(0x0001edbc4534efa5)},
+    {W(0x0000000000000001)},
+    {W(0x0001c90065186068), W(0x0004749d8b55e828), W(0x00050e29fb4370cd),
+     W(0x00004b9445c12716), W(0x00064ebde32a162f)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000667b80a340d35), W(0x00044be33e64052a), W(0x000316a14dcd0a0f),
+     W(0x0001deb25a198c81), W(0x00025ed76d78c87c)},
+    {W(0x00041d0d76373947), W(0x000331086dab5ea1), W(0x0002cca83d4ad056),
+     W(0x0003d99359d31fd8), W(0x000179b5f92f545c)},
+    {W(0x0000000000000001)},
+    {W(0x0004ad46fbfa748b), W(0x000520b949fe4d0a), W(0x0004e4d6b4c2ec2c),
+     W(0x00002908a0608581), W(0x0000e3ddad88a9e5)}
+  },
+  {
+    {W(0x00023bafa442b92c), W(0x00007d5e41f841c8), W(0x0006f6c05c4e6abe),
+     W(0x00030765b9718bc4), W(0x00071880463417e7)},
+    {W(0x0007dd5786387875), W(0x000637ecae0a9dd3), W(0x0006278c34e780b3),
+     W(0x0002ee21a7c9c77e), W(0x0007be598f9de5bd)},
+    {W(0x0000000000000001)},
+    {W(0x0001a96adb700d36), W(0x0003ede8cf358a48), W(0x000341dc8ab297f4),
+     W(0x0005c03d26358106), W(0x00060c36bc1c1e7c)}
+  },
+  {
+    {W(0x000660090cbf61d9), W(0x0001b57f1bc86f74), W(0x00061990119e6060),
+     W(0x0004f3ea415f23b0), W(0x0005a74ca175153c)},
+    {W(0x00060271196229a1), W(0x00024375e5c3b702), W(0x0006e0eb8a0ba268),
+     W(0x000338dfeaf971da), W(0x0002ced7da6bcdb6)},
+    {W(0x0000000000000001)},
+    {W(0x0003b3aabf7b843d), W(0x0001234b52c6f995), W(0x0004282a946219fb),
+     W(0x0001340c9e98bb87), W(0x000085b910e4f325)}
+  },
+  {
+    {W(0x0002b2df11653be7), W(0x0003cb8de2528c7e), W(0x000162af62db05de),
+     W(0x0001f3eeb9ca8ebd), W(0x00076db1d03f26fe)},
+    {W(0x00041b522c4e06ae), W(0x0007a4f7d4ab4b57), W(0x000499a05c5387ae),
+     W(0x0000ef858c688183), W(0x00024b91ba65c06f)},
+    {W(0x0000000000000001)},
+    {W(0x0005c274d0b862d8), W(0x0003b43b6b6fce70), W(0x00049ab1992f8884),
+     W(0x0006102476c0bd9b), W(0x000207868c44be1a)}
+  },
+  {
+    {W(0x00075519106a1039), W(0x0002571f520a6aa1), W(0x000203f811b5ed6b),
+     W(0x0003e6e5fb7bef6d), W(0x00018c4298efda7a)},
+    {W(0x00006e423860ce08), W(0x00019f26fe43b2fa), W(0x00007c7597f433b1),
+     W(0x0003add409a922b3), W(0x0002e5a2e070293b)},
+    {W(0x0000000000000001)},
+    {W(0x00055b9bf227f64c), W(0x00043ed908921763), W(0x000459c593260d11),
+     W(0x0004cc60e00f2f56), W(0x0005019e2886ff6f)}
+  },
+  {
+    {W(0x00006ecdecb75b26), W(0x00074098cfd25c61), W(0x0004dbebc60b9946),
+     W(0x000593d4c3ec65c3), W(0x0002d456c2a45f5c)},
+    {W(0x00052e112e7a5e3e), W(0x000170fbd38c1d9c), W(0x000554924dc6815f),
+     W(0x00006c3580cccd31), W(0x0004b04e7b34d350)},
+    {W(0x0000000000000001)},
+    {W(0x000020804f999dab), W(0x00016db758677530), W(0x00002b71d13d9023),
+     W(0x00078c0e64b75856), W(0x000304b1ea39d28a)}
+  },
+  {
+    {W(0x000415b46dee3d70), W(0x00055b7a5ac1d692), W(0x0007b5c0f7300511),
+     W(0x0003192759179527), W(0x0001918186a5f3d7)},
+    {W(0x0007fd1d0bf30bf5), W(0x00011c03252a06c2), W(0x0001d977a8ce43ee),
+     W(0x0007e67e221a5cdb), W(0x00076bb693db2687)},
+    {W(0x0000000000000001)},
+    {W(0x0000e59538bac196), W(0x0005458600c29a66), W(0x0000b22a17ff5924),
+     W(0x00003cc03a4c7a17), W(0x0004291dd453b010)}
+  },
+  {
+    {W(0x0004480e138066c5), W(0x0005ac16908630f1), W(0x0004cc1716dbb317),
+     W(0x0006995b203e97af), W(0x0003d09f11b74381)},
+    {W(0x0004f88dbc8269d4), W(0x00030aa30aaea6c6), W(0x0006ae009abde4f1),
+     W(0x0000ed65f8804acd), W(0x00045f4a22ff69fc)},
+    {W(0x0000000000000001)},
+    {W(0x0001add4a3685838), W(0x000466043bf278ef), W(0x0007fbf4c25ecaa6),
+     W(0x0000fdc0b6d9c619), W(0x00045b27ffa34298)}
+  },
+  {
+    {W(0x0002b6330370b118), W(0x0006ecdd3fbbd055), W(0x0002ab107e5a34ff),
+     W(0x00022abc32a41552), W(0x0006bc2f13c92074)},
+    {W(0x0006658dd2b77022), W(0x0004f43ae759c828), W(0x00055b81d789b860),
+     W(0x0002c7e2fd7da378), W(0x00064eff12af6b1c)},
+    {W(0x0000000000000001)},
+    {W(0x0004384d99abaaf6), W(0x000667325c18a016), W(0x00050ed491a7f330),
+     W(0x00033d6dd0b76877), W(0x000731fc070855b7)}
+  },
+  {
+    {W(0x0006baa207598ea4), W(0x0006262d1518c906), W(0x00042fca464154d8),
+     W(0x000772f0b4bf6372), W(0x0000d86c8745ea60)},
+    {W(0x00061c7be8724f51), W(0x0007b27ac9d01115), W(0x0005cdb41b8ed496),
+     W(0x00030ff8dff6ef35), W(0x00078d8009c384fd)},
+    {W(0x0000000000000001)},
+    {W(0x0007f017df1de25e), W(0x0006b7590c1b4420), W(0x000306616950e02e),
+     W(0x0003a5759fde1060), W(0x000020967b2dd772)}
+  },
+  {
+    {W(0x0001cb006eeb3c4b), W(0x000440f9016cf0d0), W(0x0002659fa7e44d07),
+     W(0x00063fc0ad2e977d), W(0x00039c47f4878c3a)},
+    {W(0x000262ae02374b82), W(0x0002799f4a7436ab), W(0x00040af4d4b2bc1c),
+     W(0x000713cb2878f121), W(0x00048658bcc6a194)},
+    {W(0x0000000000000001)},
+    {W(0x00065e435c062784), W(0x0005ceab2a965bb1), W(0x0001263f1475e9e8),
+     W(0x000630223597f0d8), W(0x0000e98aaabe4dcf)}
+  },
+  {
+    {W(0x00059eed85ebbe17), W(0x00068848a2feaad9), W(0x000455d01531107e),
+     W(0x0004921eb5630023), W(0x00004d742b1580d0)},
+    {W(0x00079b06c4a3bd8d), W(0x0000164e8c0b1203), W(0x0002ee0b6b48f0ec),
+     W(0x00005a54c934c808), W(0x0004589a87ce3813)},
+    {W(0x0000000000000001)},
+    {W(0x0005585985ff90e3), W(0x00027b2f55786fcf), W(0x000012c8f4dcc2a5),
+     W(0x0000f0f160813f61), W(0x00004d2df3699100)}
+  },
+  {
+    {W(0x0007cc7aafbd8d6a), W(0x00072b369daeaa82), W(0x000367c42209a743),
+     W(0x0003b5612a5ae5d0), W(0x00039e38fea6d542)},
+    {W(0x00045e364561e3da), W(0x0001d244bc021675), W(0x0007f8cd403d90d0),
+     W(0x0002ed1fb496886e), W(0x00003709eeffadd8)},
+    {W(0x0000000000000001)},
+    {W(0x0000297f7c16e309), W(0x0000716b27c64863), W(0x00001ad783305f94),
+     W(0x00050abf9c7978b0), W(0x0007d852cf8b6b5c)}
+  },
+  {
+    {W(0x0004698d4aa5acd1), W(0x0006c6dc27fa71f0), W(0x0000c0ba33fb731a),
+     W(0x0000f3acc9b5ef62), W(0x000128d7d56660c1)},
+    {W(0x000133978a0e4f52), W(0x00049f057216d4da), W(0x00000aeeb9d75e33),
+     W(0x00010e41eeee2a0e), W(0x00068c831961f051)},
+    {W(0x0000000000000001)},
+    {W(0x00046af63c1177d0), W(0x00071d004137695d), W(0x0002187a0683bdce),
+     W(0x00039097a32ac3f8), W(0x00000c6de3240c61)}
+  },
+  {
+    {W(0x000098574c4c9d63), W(0x000288a8f23f67d7), W(0x0002b6c49344e45a),
+     W(0x0004273bb2e589c4), W(0x00046eb97e740185)},
+    {W(0x00042e2c1f33a180), W(0x000130fa34926530), W(0x0004359a3a27f124),
+     W(0x0006c366322807af), W(0x000169a8041301be)},
+    {W(0x0000000000000001)},
+    {W(0x00046a3650ef0b20), W(0x00042b80b6d6583b), W(0x00007e0128ffc732),
+     W(0x0002c9c361a8aaca), W(0x0003edb63f14694a)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x00003c41cb05dc3f), W(0x0004732705808479), W(0x00071ccb4fe555a3),
+     W(0x00066f2e8dea7d5f), W(0x00075d942c04210d)},
+    {W(0x0005c4874e35ab2d), W(0x0005a8f4848cf2ec), W(0x00045cc72fce38fe),
+     W(0x00009e47ebf162bb), W(0x000696cc14856cdc)},
+    {W(0x0000000000000001)},
+    {W(0x0001588c9993c204), W(0x000310b07abc62b0), W(0x0007dd0ce1a13228),
+     W(0x0004db508b69bfe2), W(0x0006875393b8686c)}
+  },
+  {
+    {W(0x0000a57b885fae14), W(0x00048bd176421bf2), W(0x0006483f528f0c5c),
+     W(0x0006bb56ad0c8d30), W(0x0006d12e0dd1cd8b)},
+    {W(0x0004a3028f70bd8e), W(0x0006fb588ceb49a4), W(0x000015e96e043c83),
+     W(0x0003c01505c1b392), W(0x0000d5c9e4b74fde)},
+    {W(0x0000000000000001)},
+    {W(0x00066fd9da4da844), W(0x00036bcc17efb8ba), W(0x00067c9966e620bb),
+     W(0x0002e8b510b2d23f), W(0x0003211cabda755b)}
+  },
+  {
+    {W(0x00039f2d199b0017), W(0x000689cd6da39047), W(0x00004ee67cfea426),
+     W(0x00044f62eac8c288), W(0x0007d04264e36e88)},
+    {W(0x0003319ae930f866), W(0x0002b7f27fb1bc34), W(0x00068ccfeaf09e3c),
+     W(0x00013fce3bbcbc54), W(0x0006cc9f269424b8)},
+    {W(0x0000000000000001)},
+    {W(0x000622632f5cf734), W(0x00041b729f82a329), W(0x00010c6c2b8eaa2d),
+     W(0x0006bed58531e5ce), W(0x0003770c16884960)}
+  },
+  {
+    {W(0x0003fba21f5fd594), W(0x0005a41f0680fc3d), W(0x00060684b418c206),
+     W(0x0000d78588e79b4a), W(0x00016c1556c9a2bc)},
+    {W(0x000335745ef14f36), W(0x0003d719e23ae502), W(0x0005ced6e016ce4f),
+     W(0x0007c48f0cd6f5f4), W(0x00023e38cd5158b0)},
+    {W(0x0000000000000001)},
+    {W(0x0004c62395a6a828), W(0x00046c4d62fbe1c3), W(0x00079e89f4bc2231),
+     W(0x0003fec90ae2a81f), W(0x00029b8d1dc2095b)}
+  },
+  {
+    {W(0x00011af2b10518f5), W(0x0001b54232605b64), W(0x00063b6355b3ae8c),
+     W(0x0000634abcb5fe74), W(0x0001723bcb3e1d15)},
+    {W(0x000689807682b3ea), W(0x000769004a1eaadc), W(0x0001faf5e2abddd7),
+     W(0x000591a01cc06d86), W(0x0005d4ba682e08eb)},
+    {W(0x0000000000000001)},
+    {W(0x00068fd67e2023de), W(0x0002e9ed9bc7b243), W(0x0007f1df90e7267b),
+     W(0x000157278332427a), W(0x00020cae63fed27a)}
+  },
+  {
+    {W(0x00070fe618e77933), W(0x00009554f402b26a), W(0x00057a55d0c13eff),
+     W(0x0005807222ada534), W(0x000456bdf4c7423e)},
+    {W(0x00050b42c46c2997), W(0x0002e6936b85381b), W(0x0001d18e01e71f42),
+     W(0x00043e15d81bc772), W(0x000579782c36c68e)},
+    {W(0x0000000000000001)},
+    {W(0x0003e5303a1908ed), W(0x000223ca96fd7b4b), W(0x0003cbb225620e5f),
+     W(0x0001edb635aaf657), W(0x00005dacf0f0de7c)}
+  },
+  {
+    {W(0x0006a339f4412193), W(0x00050756eb9eb0a5), W(0x0001767916351622),
+     W(0x0001089da2b5dd8b), W(0x0002269a46cdf0aa)},
+    {W(0x00068f85514c514e), W(0x0007083ffbf804f6), W(0x0000b87e873a8780),
+     W(0x0003f90dc508ecec), W(0x000489cf3771fa99)},
+    {W(0x0000000000000001)},
+    {W(0x0007104537cc4644), W(0x0003e2bd1ee75986), W(0x00017237036bf469),
+     W(0x0007531eb776369d), W(0x00066a9b0dab2743)}
+  },
+  {
+    {W(0x0003804bb683be22), W(0x0003733debc4886d), W(0x00000cee3497f2a2),
+     W(0x0005bb4af39f15ca), W(0x00066e632db15cc9)},
+    {W(0x0002d6a6134af084), W(0x00038fdec0e8d27f), W(0x0001239e9bd979b5),
+     W(0x000660c87ff50378), W(0x000534e3c9c194cc)},
+    {W(0x0000000000000001)},
+    {W(0x00004ddf8800db95), W(0x000087757b94c4a7), W(0x0001ee594a87a541),
+     W(0x0006e1e26ab17c47), W(0x0007a4def7f4f0cc)}
+  },
+  {
+    {W(0x0004cc847014c3c4), W(0x000539435a1bc1c3), W(0x0004c8c47c781cfc),
+     W(0x0006f3286311bdc6), W(0x000231f1c4fbfcff)},
+    {W(0x00027a42cc1b3ef5), W(0x000277559be12a7b), W(0x00024683998b2d2c),
+     W(0x000633cffe89a2d4), W(0x00023d6dee4490fb)},
+    {W(0x0000000000000001)},
+    {W(0x0006cbaaf9cc7838), W(0x00015557fc9c4a6e), W(0x00027986afcf1153),
+     W(0x0004436d7434a05b), W(0x0005245e8f9e1490)}
+  },
+  {
+    {W(0x000532dca446b0be), W(0x0003c2243d4d6552), W(0x00004f844a022a60),
+     W(0x000239272c9a4385), W(0x0000dbdb65777b3b)},
+    {W(0x0004255f589e0792), W(0x0003879adecba193), W(0x000748e21d6abec7),
+     W(0x0007f4afaa6a6f75), W(0x0006e6286cccc17f)},
+    {W(0x0000000000000001)},
+    {W(0x00025dc3ca535a09), W(0x0006e05c2c12c035), W(0x00000816196e06e5),
+     W(0x00027e1a0e430b7b), W(0x00053409a6d89975)}
+  },
+  {
+    {W(0x0001e74e0c80eddd), W(0x000544f13c0ad78b), W(0x000141654f7b6868),
+     W(0x0005d0d506555498), W(0x00046b927be2a5fe)},
+    {W(0x0002f07b9e4408d4), W(0x0001e7da507c58e6), W(0x000112ae05d5c6b6),
+     W(0x0004406d89f89bee), W(0x0003e66ae9582c74)},
+    {W(0x0000000000000001)},
+    {W(0x0001f9d6f8715c8b), W(0x00071802aa40789b), W(0x0001c0072aa1bd09),
+     W(0x0006b9484f01f6c9), W(0x00056ee94e761a25)}
+  },
+  {
+    {W(0x000307beceff6385), W(0x0000c88a5b90876f), W(0x000328ee42d0b63c),
+     W(0x00013469d4258c60), W(0x00070b90ffd3226d)},
+    {W(0x000022a668dc7732), W(0x0000fd1a7e41ed63), W(0x0007969c1c5ae666),
+     W(0x00011cfc4063a9a1), W(0x0005040d483f9688)},
+    {W(0x0000000000000001)},
+    {W(0x0004826be24d629c), W(0x0000195255979a82), W(0x00013b409c535e66),
+     W(0x0005b339cbec6e88), W(0x00067a1cc2d972a6)}
+  },
+  {
+    {W(0x0006e3566ba9d1c6), W(0x000645a98bdc18bd), W(0x00062cc379f77930),
+     W(0x00077edc5f68a533), W(0x0004a3fddbca6efa)},
+    {W(0x0001c82b0a11eb16), W(0x0007e416c59dfdd1), W(0x0002a0fbaf358eca),
+     W(0x0003443bb4beb73d), W(0x00000f34799c40c3)},
+    {W(0x0000000000000001)},
+    {W(0x0005e1d18424caf5), W(0x00003341a5144d2f), W(0x00019c37734fc122),
+     W(0x0007ca614784f4a6), W(0x000500636436457f)}
+  },
+  {
+    {W(0x0000eb014ac4f9ac), W(0x0001196748869d3e), W(0x000245478d6cc277),
+     W(0x000224b36352ac17), W(0x000451e21e3df970)},
+    {W(0x000145abefadbfad), W(0x000049f17fdcb666), W(0x0002788d8ee10487),
+     W(0x0005116b97f76df4), W(0x0005ad31b148827f)},
+    {W(0x0000000000000001)},
+    {W(0x000545555503011f), W(0x00017e29b41858f9), W(0x0003a56418adf4ce),
+     W(0x0005d0f0a6ba76ba), W(0x0005dec5078ab2b2)}
+  },
+  {
+    {W(0x00076f0d038a745a), W(0x00017deb0c8fe04b), W(0x000063b658b47120),
+     W(0x0003d1ae97caa0ac), W(0x00071553bd41ec8a)},
+    {W(0x000611a1d732b671), W(0x0003e0057b71f02c), W(0x0007ccb31625cdbd),
+     W(0x000029639b984a5b), W(0x0002abeadc402c2a)},
+    {W(0x0000000000000001)},
+    {W(0x000539c83fb11750), W(0x000034ddf1df23c4), W(0x00063ae2f81689e9),
+     W(0x0006a3c3fa6f539e), W(0x0004ef3df2aea154)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002591507e3502a), W(0x00059a7e7e50317e), W(0x000333b19dc23265),
+     W(0x0003beaca2accf77), W(0x0005d9324f569754)},
+    {W(0x0007306bbe1b4f6a), W(0x000793af7c68ceb9), W(0x000322d07d736337),
+     W(0x000102940d761271), W(0x00010985a3cfd573)},
+    {W(0x0000000000000001)},
+    {W(0x0002e4d553c6e887), W(0x0000fd4dc3a1354c), W(0x00039d01c9093bc2),
+     W(0x0001fab9d7df6fbf), W(0x00019f8602a33a60)}
+  },
+  {
+    {W(0x0002c2d830f7dba3), W(0x00001ca459da7c33), W(0x000702ac7f93647a),
+     W(0x0005cc9387430d38), W(0x0003c08b09976fa5)},
+    {W(0x00056a1b85d2932a), W(0x0007a67a3a3dd4cb), W(0x000110e8ddccd9aa),
+     W(0x000041ef3d54f65a), W(0x00030a2ba28dfd74)},
+    {W(0x0000000000000001)},
+    {W(0x0007b79981cea3aa), W(0x0005281e35102f14), W(0x0007630ad2065cd7),
+     W(0x00043e27d2667cb4), W(0x00005d63ae789603)}
+  },
+  {
+    {W(0x00039f3f056db5d3), W(0x000799394f91a2be), W(0x0004d98ec251f22b),
+     W(0x0004498fc8e8bc4d), W(0x00043a376de4357d)},
+    {W(0x0006323da9e2359b), W(0x0000bd2e0502d763), W(0x0005f821fdc23cbd),
+     W(0x000270fbdfbd6229), W(0x000111b64acd86aa)},
+    {W(0x0000000000000001)},
+    {W(0x0003bcf064664a50), W(0x0007a6e8583a7a73), W(0x00049b77af84c6e8),
+     W(0x00032a2c9d887df3), W(0x0007e0111bdab750)}
+  },
+  {
+    {W(0x00073e184647ebb2), W(0x0004059e39819323), W(0x000195f807823f9f),
+     W(0x00005ce47de8065c), W(0x00027d83b6133989)},
+    {W(0x00044b503a72bea0), W(0x000498b27900356e), W(0x0007bb2ad1b0231f),
+     W(0x0006e313276bc775), W(0x0002aa089af71e21)},
+    {W(0x0000000000000001)},
+    {W(0x0006ff3ca965a758), W(0x000662d3dc4eed97), W(0x000132ee765df3dd),
+     W(0x0005956a8e4c4d31), W(0x00059c21c31920da)}
+  },
+  {
+    {W(0x0000915f917975d6), W(0x0002db3e2c1ceeae), W(0x0006d899f6d0a72f),
+     W(0x000572759bd0257d), W(0x000218babbf360a8)},
+    {W(0x0007a390ac68e6ed), W(0x0002ff91fe75e93c), W(0x00032f08541177f3),
+     W(0x00025732e6c0e7cc), W(0x00045d5415ac167b)},
+    {W(0x0000000000000001)},
+    {W(0x0005e482699aada0), W(0x00010bdd756e8fa2), W(0x0005a5f7124020dc),
+     W(0x0001002c5e07ce47), W(0x0001b6910f58986e)}
+  },
+  {
+    {W(0x00063b1cab57ec26), W(0x0007ec1f2a7cf7eb), W(0x0005d70a17cc2b36),
+     W(0x0000db87d9da160e), W(0x0005004cc1a512b7)},
+    {W(0x0006f994211d19bb), W(0x000696b93fd41e4e), W(0x0007b4005cff08c9),
+     W(0x000520ddc178a9f4), W(0x0000bf99d9ed24e9)},
+    {W(0x0000000000000001)},
+    {W(0x0000b9cee4a663fc), W(0x0004ed3d6511415c), W(0x00042d773ad5f98c),
+     W(0x000664561235b1c8), W(0x0007ad0348a2ccb4)}
+  },
+  {
+    {W(0x0007290d430ca902), W(0x0005821a25199967), W(0x00048cc5cc169af8),
+     W(0x0005c28268fdaf26), W(0x0004342c43b3cc06)},
+    {W(0x0005e05aa49d4fed), W(0x000207d143b63186), W(0x000152234c9a44ff),
+     W(0x0003d356c7b56df2), W(0x00076f49a3d9f6ce)},
+    {W(0x0000000000000001)},
+    {W(0x0004e1f4fbc9d472), W(0x0001cc8d466b5901), W(0x0001dc7a7ea9e09b),
+     W(0x0000703a6b74d668), W(0x0006b652c8bf8ade)}
+  },
+  {
+    {W(0x0002a8dbdee40b98), W(0x00010daa40ce905f), W(0x0001ab158bfe2948),
+     W(0x0003370fc62887a2), W(0x0004676d3812cc6b)},
+    {W(0x0002a7802e7429f4), W(0x0007f1dad7bed1e3), W(0x0005fe83acaa5706),
+     W(0x0003d8828a285022), W(0x0007d89e2b7744c5)},
+    {W(0x0000000000000001)},
+    {W(0x00034d62079ca483), W(0x0000d55e6e7796d7), W(0x0002f676f53fbf29),
+     W(0x00012ee8ca7e3382), W(0x0000cc1c2627114d)}
+  },
+  {
+    {W(0x00061f33cffcd49d), W(0x00056565cdc3b891), W(0x0001ab82d3e0a7e7),
+     W(0x00010a7257bc1a4e), W(0x0006e4888852a6a0)},
+    {W(0x0001b5d2611a98c9), W(0x0001dc7ff3daad4a), W(0x0006f1f4c38a813f),
+     W(0x0003fd878fa24099), W(0x0002839058a35e3c)},
+    {W(0x0000000000000001)},
+    {W(0x0006744724c195dc), W(0x0004b1ad3a7b8b4c), W(0x0007d0bc14270d95),
+     W(0x0002fdc8e78a31ac), W(0x0003697b9448098f)}
+  },
+  {
+    {W(0x0000def8975a2c54), W(0x00042a7923e39e4a), W(0x0004c4bfaec2fa89),
+     W(0x000789d6f3040493), W(0x00074c4853445e61)},
+    {W(0x000501793340c810), W(0x000472bba564f505), W(0x0002c20023f1294c),
+     W(0x0001e7b11659047b), W(0x00049b8b7ee26c31)},
+    {W(0x0000000000000001)},
+    {W(0x0007f1265980f6a9), W(0x0003ca0ae191ff48), W(0x0006e44b1227b5db),
+     W(0x0001b89fb81f2644), W(0x00076f8d94e7f8f6)}
+  },
+  {
+    {W(0x0002c743508b9127), W(0x0004cc7fdc73fe5c), W(0x0005d33f9dc2063d),
+     W(0x0001bd30f20fd35a), W(0x000355a44d8cc9fc)},
+    {W(0x000017a9902e6e84), W(0x000108f4e4bcff49), W(0x000071c9abc89ef3),
+     W(0x000403b3e56f4510), W(0x00073883d177b6f8)},
+    {W(0x0000000000000001)},
+    {W(0x0005196efe939185), W(0x000331c3172c514a), W(0x00041d8b560e894e),
+     W(0x000743551521640f), W(0x00075f6883fc92b2)}
+  },
+  {
+    {W(0x0005bab8864df6f1), W(0x00045c2a089bd4f3), W(0x00017b91fb17ed32),
+     W(0x000648cdfbcb01e3), W(0x00053aa6dafc3280)},
+    {W(0x00079ff5ba2ebead), W(0x0003b288333356a7), W(0x00011894759a4a55),
+     W(0x00018b5e114f9684), W(0x000099ba5ddbe9f8)},
+    {W(0x0000000000000001)},
+    {W(0x0006293cab52017a), W(0x00019e9a2f2f8bae), W(0x0002142aaa8992e8),
+     W(0x0004841ef60536c7), W(0x0006ad9fbba42194)}
+  },
+  {
+    {W(0x000740ab2ddf37de), W(0x0002c18185a11612), W(0x0004cd9b958a62c4),
+     W(0x0004fadf9bc4a866), W(0x0007e32beb0e67bb)},
+    {W(0x000449959d01b545), W(0x000226054607a5a0), W(0x00018f027dfecba4),
+     W(0x00079b3787fb4e07), W(0x000193783f25b95a)},
+    {W(0x0000000000000001)},
+    {W(0x00040964950c2aaa), W(0x0007aa4a9eb0a6ac), W(0x00072f7f772060d5),
+     W(0x000421ca97001948), W(0x000358c57b2b5468)}
+  },
+  {
+    {W(0x0003328330ed1868), W(0x0005dfe381675845), W(0x000379d217fd6c7b),
+     W(0x00064833b1a2bf95), W(0x0005b92b65a67c2d)},
+    {W(0x0006da931fae308a), W(0x00062a51c7b381d1), W(0x0005a76fdc19d0c8),
+     W(0x00034d9959142600), W(0x0001f6e645a8d364)},
+    {W(0x0000000000000001)},
+    {W(0x00039ccdfd65d77c), W(0x0006f945e08f0099), W(0x0005360a2f50a14e),
+     W(0x0004e0c926fe1c1f), W(0x00042c9ffc35a655)}
+  },
+  {
+    {W(0x0003b649aa1cba5d), W(0x000323d7fc777d7b), W(0x00020996568c400c),
+     W(0x0004c27569a2fb7a), W(0x00075fd0a82a5dae)},
+    {W(0x0003e5f81a599c19), W(0x0007768b774e6b38), W(0x00079e3041c9b846),
+     W(0x0003115d16fd94c2), W(0x00005ace6b4189d9)},
+    {W(0x0000000000000001)},
+    {W(0x0005beef2236e455), W(0x0005da8ae84c7e20), W(0x0005d4e1bf2783c6),
+     W(0x0004d3344bad93af), W(0x0004df7ec7729765)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000309b7ada7ee07), W(0x00043cb957e9c921), W(0x0003cd9f56bf9b98),
+     W(0x00002d3dc9be3f67), W(0x0007511066c0e121)},
+    {W(0x0006a33ba386fcd5), W(0x000626dee17f6147), W(0x00029c02ddc3696e),
+     W(0x00065e544247c46d), W(0x000604df365b8391)},
+    {W(0x0000000000000001)},
+    {W(0x0003a94bd5bcbc2f), W(0x000619fac8d6ace9), W(0x00049513fcb27238),
+     W(0x000185cdb43c881f), W(0x0003bcd60e9533cb)}
+  },
+  {
+    {W(0x0001d26ae8619807), W(0x0000e30b7aa4a930), W(0x0002b51a914548d7),
+     W(0x0005c88c2fe4868c), W(0x000668d5960c0b43)},
+    {W(0x0006246e53791b03), W(0x000110a12b1b2af5), W(0x000045378ad74e89),
+     W(0x000058f49e437341), W(0x0007a66f757c2190)},
+    {W(0x0000000000000001)},
+    {W(0x00013d7c92bd0558), W(0x00046d4010b9a2af), W(0x00050fa079405f35),
+     W(0x000400a8cd97a6fc), W(0x0005f3e6d4330674)}
+  },
+  {
+    {W(0x0002d8352e175264), W(0x000601e11692d66c), W(0x00004aa7039c9423),
+     W(0x000107f06a461a90), W(0x000158af2b748828)},
+    {W(0x0002530bd1561746), W(0x000519a6f2a4a98e), W(0x0004ebbb5934b808),
+     W(0x00040ebebae7fd41), W(0x000627e7cd734b03)},
+    {W(0x0000000000000001)},
+    {W(0x0007dc5669f01ddd), W(0x0002cb0b0cafa1e3), W(0x0003d720fe91031a),
+     W(0x000067e8ed1ec00a), W(0x000797150adf0663)}
+  },
+  {
+    {W(0x000522d70389e30f), W(0x0005b3d1b69953f2), W(0x00041d648637fe5d),
+     W(0x0003227c2f1681f7), W(0x0005089c58085e74)},
+    {W(0x000186248653d88b), W(0x0001d8641f402a45), W(0x000250d1eeb72e55),
+     W(0x000020cb7d3d5b98), W(0x00050cab959cb2b6)},
+    {W(0x0000000000000001)},
+    {W(0x00030b59df367e13), W(0x00044c9fa894c6d2), W(0x00001d73bb2b6a8e),
+     W(0x0001dd0759ea2ed3), W(0x00039c2a209ade34)}
+  },
+  {
+    {W(0x000140abde7555f6), W(0x0004ad61ed9ff36b), W(0x0007923661b7033a),
+     W(0x0001ca1d9b3e7636), W(0x0007d5f6473e7c2f)},
+    {W(0x0001179993df2540), W(0x0002aef6937c200c), W(0x0005418fd61513e1),
+     W(0x00017312d93ebeac), W(0x0003c49c73bc2ba8)},
+    {W(0x0000000000000001)},
+    {W(0x00074f00b58a53f6), W(0x0002bbf59bc314c4), W(0x00017bda068eb061),
+     W(0x00020a0e33fcf9d5), W(0x0005e228e1b1e1ab)}
+  },
+  {
+    {W(0x00024e97e3f868a1), W(0x000621f1173b4625), W(0x000507b0c7fb94ce),
+     W(0x00029e4c0eedfc23), W(0x0005dde3f530354c)},
+    {W(0x000484800427a7c8), W(0x00026e9045f15da5), W(0x00033841231904d2),
+     W(0x00079b14e162e6f5), W(0x000759527498e0c4)},
+    {W(0x0000000000000001)},
+    {W(0x00066a81ef8b10e8), W(0x0002c5c7978b126d), W(0x0007122ca7a7e681),
+     W(0x00040d8d008623a1), W(0x00041294922881ba)}
+  },
+  {
+    {W(0x0007f4fbb4aa85b4), W(0x0000c579767ffb50), W(0x00008213dfcd1205),
+     W(0x00068281deb8486d), W(0x0003d5a995a523d9)},
+    {W(0x0004b566edf58220), W(0x00055894c276321d), W(0x0007ad74afff357d),
+     W(0x0000d3a9a539d392), W(0x000706663d330b1d)},
+    {W(0x0000000000000001)},
+    {W(0x000133a22f640de1), W(0x00065cc9588f9859), W(0x00045a43b2a1c67e),
+     W(0x00053b020b63f8ad), W(0x000790215a917eba)}
+  },
+  {
+    {W(0x00021b23789b5bc2), W(0x000313614bf29107), W(0x0003ffd8454db8ae),
+     W(0x0000400166213ee3), W(0x0000761affb1e0d4)},
+    {W(0x0006a170812fe6b0), W(0x0000e5988f808725), W(0x0006b25da56d2916),
+     W(0x00029dbe21081636), W(0x0003a6d110e60701)},
+    {W(0x0000000000000001)},
+    {W(0x00016b9b1b499715), W(0x0004ff57aba1c1f5), W(0x000385b66acef2fb),
+     W(0x000435281d6122c2), W(0x0005d6c9bb1ec4a5)}
+  },
+  {
+    {W(0x0007505c3afb2c82), W(0x000343fbd5dcc000), W(0x0000fce301c5b774),
+     W(0x0006dc9b4c1a1ad3), W(0x0006dfdba0cd724c)},
+    {W(0x0001c4b663766b88), W(0x0002775c3f454b0e), W(0x0003fee0951ae922),
+     W(0x00017b32368fba90), W(0x000585d5949e7399)},
+    {W(0x0000000000000001)},
+    {W(0x0000b93f5584f3d2), W(0x00064f5a7420264d), W(0x00013134ba006435),
+     W(0x0006080569d63599), W(0x00006371b9d116b2)}
+  },
+  {
+    {W(0x0003d4c5384c78fe), W(0x0001536e66c9520a), W(0x00006cfe20461acd),
+     W(0x00049d9b94f67872), W(0x00079e1ded8e3fe8)},
+    {W(0x000569d5b031be85), W(0x00023d0b36bda237), W(0x000071558746bfdf),
+     W(0x0004401ab7d947ff), W(0x00036f3421461858)},
+    {W(0x0000000000000001)},
+    {W(0x000531cf6eb63cf9), W(0x0005bb222dafb968), W(0x000328bf2f7ed147),
+     W(0x0006d689913ce264), W(0x0004f93140322002)}
+  },
+  {
+    {W(0x00023cd14a882bab), W(0x0004723b8a07583e), W(0x0002d7f2feaef8bd),
+     W(0x0002147c390726db), W(0x0000d9099e4c5f41)},
+    {W(0x0006e88b151eb7ad), W(0x0001c068e4fe0ad2), W(0x00048d7257994593),
+     W(0x0002615e800d5a39), W(0x0004c365ca39ea38)},
+    {W(0x0000000000000001)},
+    {W(0x00052e1c88aa2930), W(0x000090ec98033ebd), W(0x00003a775fd16f6c),
+     W(0x0000e2d04adb1626), W(0x0001f2d3c528cb16)}
+  },
+  {
+    {W(0x000505db5e80189b), W(0x0001a8184796f8d7), W(0x000454d22a5f3975),
+     W(0x00061bf8082e9455), W(0x0000d331ffa16cc0)},
+    {W(0x00041a59aa35f919), W(0x0002e16d5f80cb81), W(0x00056a94abf0d94e),
+     W(0x00069cd791f7984d), W(0x0000b4857756b9a5)},
+    {W(0x0000000000000001)},
+    {W(0x0000e1945c410332), W(0x0002e33b93a69432), W(0x0001405bbf53524e),
+     W(0x0003966b6eb1965e), W(0x0004f4e0c67bb5cd)}
+  },
+  {
+    {W(0x00007ca13f100b54), W(0x0007c9ad14a7e296), W(0x00071f655d2a3aab),
+     W(0x0003f2a1c06c81eb), W(0x0004d1eeb7001ca2)},
+    {W(0x00007dd54ffd9e4e), W(0x0004a6f318f191ce), W(0x00027c720c048afa),
+     W(0x000158236db3795b), W(0x0007dfb37638b7d4)},
+    {W(0x0000000000000001)},
+    {W(0x00003b447a559fd5), W(0x0005f0a5dd58e01a), W(0x0001b95268b004a1),
+     W(0x0006f27bcb1d0dcc), W(0x00076e6055353037)}
+  },
+  {
+    {W(0x00046b386198c951), W(0x00007f889febb2b0), W(0x00052df8f7fcd603),
+     W(0x000042106da54b05), W(0x00018f1afce37734)},
+    {W(0x0002ff7d5e69b65f), W(0x0007744d18c4f9da), W(0x0002639f12746e40),
+     W(0x0006743a0da7b26e), W(0x000611770c9f5aa5)},
+    {W(0x0000000000000001)},
+    {W(0x0000fe04c2eca6bc), W(0x000249a18628b1c6), W(0x000014d490379039),
+     W(0x0004242e368b6456), W(0x0006d867dfc940fe)}
+  },
+  {
+    {W(0x0003d3a1493a8ef0), W(0x00051e541dc7244a), W(0x0004afc0dbd0511d),
+     W(0x00059d5c77e056c7), W(0x0003c6eb2fc35834)},
+    {W(0x0004588905cec012), W(0x0000508050ef54db), W(0x0007bf90e9b314f2),
+     W(0x00076782c64f6969), W(0x00077f89f42fa3b9)},
+    {W(0x0000000000000001)},
+    {W(0x0003879a3ef0a11d), W(0x0007d82b84374cc7), W(0x0004cea43829fcbc),
+     W(0x000314f4329d25f9), W(0x0005d32c2a5a17d6)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0004f9fc3b76dc26), W(0x0005ea6c417127f3), W(0x000719aaf0b8060e),
+     W(0x00027306953a8681), W(0x0002596e5b3cf549)},
+    {W(0x00078a3174b182fe), W(0x00041e91b7aacdf4), W(0x000168b379654653),
+     W(0x000049c42535c27a), W(0x00068a0a7ac9a0cc)},
+    {W(0x0000000000000001)},
+    {W(0x0002713dcfd34731), W(0x000534436effa1c1), W(0x0007ef41db54d9e9),
+     W(0x00018ba5ea99f598), W(0x000054e93a9ff23e)}
+  },
+  {
+    {W(0x00004723c7d60d25), W(0x0000f0eb8118f5a2), W(0x0002734ee062624e),
+     W(0x0004fc3ae29ead56), W(0x000249651cc14324)},
+    {W(0x00000437f05d9c65), W(0x000494be054d269e), W(0x000040556caf7b29),
+     W(0x000358626e8355e9), W(0x000028fdf17c15bb)},
+    {W(0x0000000000000001)},
+    {W(0x0005e35787e7fdda), W(0x00031ce633e1e96d), W(0x00001244331a653a),
+     W(0x000482479b1a0d4a), W(0x000702c4e44b98ce)}
+  },
+  {
+    {W(0x00034dd5c616e085), W(0x0002f5c7ec33187a), W(0x0006f751998a257c),
+     W(0x0006b97b4e27363e), W(0x0000a12deab65219)},
+    {W(0x000114c509531518), W(0x0006e5e36b4b852a), W(0x0003d408531f02f6),
+     W(0x00035d1f4cbdd96c), W(0x00053798a24de901)},
+    {W(0x0000000000000001)},
+    {W(0x00014d87a91a712c), W(0x00038c28aed24d36), W(0x00068db137a7b49d),
+     W(0x00070ed9054f4aeb), W(0x0004b63a8c4c67a7)}
+  },
+  {
+    {W(0x0004315cbf3d59bd), W(0x00008c0092864588), W(0x0007263ed802b43e),
+     W(0x00000724d12e660e), W(0x0000555439a08915)},
+    {W(0x0001129bdf55935d), W(0x0004d3c850b27d83), W(0x00049abe66be743d),
+     W(0x0005e77ffeb0de44), W(0x0005835c99533f44)},
+    {W(0x0000000000000001)},
+    {W(0x0003f0298fd0ba66), W(0x00051ee2b2e453df), W(0x0000b220ebf15aed),
+     W(0x00032c0da1e5eba3), W(0x00023c62c164cd2c)}
+  },
+  {
+    {W(0x0005bf775b972b6b), W(0x0000eacd573e1bf0), W(0x00058590cf6d8490),
+     W(0x0004910a68667984), W(0x0006047670868765)},
+    {W(0x00031d363feb732e), W(0x00042bf157fbfb92), W(0x00075b77fd213564),
+     W(0x0001b3d73aa29baf), W(0x0003a19a9aa7f5e5)},
+    {W(0x0000000000000001)},
+    {W(0x00064417a38c0635), W(0x00021b0e0d8806da), W(0x0000543cd48699d6),
+     W(0x0004c1b06a792200), W(0x0003a25fc45fce16)}
+  },
+  {
+    {W(0x000744cbdaf95512), W(0x0004d35f3c4afb94), W(0x0004e69d51808c1f),
+     W(0x0005d5372b424dd2), W(0x00067af872cb08f8)},
+    {W(0x0002f812b24ca900), W(0x00064929600f5506), W(0x0001123911747ee8),
+     W(0x0003841cfd88ee3d), W(0x0000e934212a5875)},
+    {W(0x0000000000000001)},
+    {W(0x0006d7f408d946a3), W(0x0004d857c7798a53), W(0x0002a83e97450772),
+     W(0x0003c4dcee69b7b1), W(0x000177fff828ad3f)}
+  },
+  {
+    {W(0x00023dc35c20750e), W(0x000615160be27378), W(0x0004483ab5238a79),
+     W(0x00013d3c926b50b0), W(0x0002fc81859c8e7f)},
+    {W(0x000581ec1d9fc534), W(0x000294815f776e4f), W(0x0000af53c79e5442),
+     W(0x00043eae503dd23d), W(0x000519650677e825)},
+    {W(0x0000000000000001)},
+    {W(0x00053da4e5809e60), W(0x00043e2d97d182bd), W(0x0007555b6db6107d),
+     W(0x0000ca9365a2d5be), W(0x0003a614e6b7f98c)}
+  },
+  {
+    {W(0x0002d05972aeb417), W(0x0006622c7162d515), W(0x0002dea03368110e),
+     W(0x0006d7f3aa276eb4), W(0x0000dec3676055d5)},
+    {W(0x0007553832827c6d), W(0x000778986fab6e8a), W(0x000151544fc0a41b),
+     W(0x0004cc4fa66e53e3), W(0x00048fa8dc3a8204)},
+    {W(0x0000000000000001)},
+    {W(0x0006b8b93fa6a6a9), W(0x000674e1d97e28e2), W(0x0005f692fd8699c3),
+     W(0x000099fa8f285c71), W(0x0005c9975ba51058)}
+  },
+  {
+    {W(0x00057d7ece17311d), W(0x000049c3f1bf2c3b), W(0x000540acb5a32752),
+     W(0x00011873076b97eb), W(0x00011a7a526a3174)},
+    {W(0x00007a462b566add), W(0x0004c09bb067fe3b), W(0x0006e559897a26f3),
+     W(0x00071025a766c213), W(0x000642aa3e6ff7bb)},
+    {W(0x0000000000000001)},
+    {W(0x000430227cc9d460), W(0x0000a59e056323b7), W(0x0000978cc35c0842),
+     W(0x0003b0622761a4f0), W(0x00048e86265e046a)}
+  },
+  {
+    {W(0x00063037c7e889ec), W(0x0007f133c8038196), W(0x0000c7718abd770e),
+     W(0x0004e6df9f11c8df), W(0x0005e7cc7672fd21)},
+    {W(0x00057a824521aca0), W(0x0007e6b2778c19f6), W(0x00028fa77abced7c),
+     W(0x00012833778fefd6), W(0x000156cfb7281388)},
+    {W(0x0000000000000001)},
+    {W(0x00074a5b3aac5409), W(0x00026bb5c9587c18), W(0x0003bfa47f1b8f0f),
+     W(0x00047abf1dedda1d), W(0x000215ff6d2d8924)}
+  },
+  {
+    {W(0x0004ec2dc3f33a38), W(0x0004d35c6807e9e6), W(0x0007191e48ec21dc),
+     W(0x00053ca8ef2841cf), W(0x0006ba4648f95f8d)},
+    {W(0x0002321941c2ee46), W(0x000056e3b7f071ef), W(0x0007b83f3ba22445),
+     W(0x0002916c6ada7759), W(0x000595b96eb900c5)},
+    {W(0x0000000000000001)},
+    {W(0x00001195ee693be1), W(0x0003b7e79068a99b), W(0x0003440a5bc78613),
+     W(0x00049edd36596bb2), W(0x0002e40973942cea)}
+  },
+  {
+    {W(0x00008838f7079760), W(0x00077c1d887af06f), W(0x000760e9bf5684a0),
+     W(0x0000606bfabef23f), W(0x00042d5a956176ce)},
+    {W(0x0006e61f574d708d), W(0x000763f025851d8b), W(0x0005c049fcd65d3a),
+     W(0x00044f1ba245294d), W(0x0006f4921008de78)},
+    {W(0x0000000000000001)},
+    {W(0x0000972ebfd1b90f), W(0x0003daff0bc7cff7), W(0x00028c0876e26d17),
+     W(0x00010cebc9f6ecd0), W(0x000533dcbba052dc)}
+  },
+  {
+    {W(0x00045553cca455eb), W(0x0001396f643c1905), W(0x00026b27ee7d1849),
+     W(0x0007561491985e2d), W(0x0005df29a359911e)},
+    {W(0x00007cc6e79c889c), W(0x0006322ea50bc653), W(0x000518f86c894718),
+     W(0x0007021233b8fc4c), W(0x00038da4bf813cb1)},
+    {W(0x0000000000000001)},
+    {W(0x00024bc642512e45), W(0x00069a1dd00a2157), W(0x0000aed118d17270),
+     W(0x000351beccd72e86), W(0x0002eeafb7e476dc)}
+  },
+  {
+    {W(0x00035a8538cc33ff), W(0x0003ee69b3ac6d94), W(0x0007218a55b64002),
+     W(0x0007a4479c80ce67), W(0x00016d9afa75c0f9)},
+    {W(0x00007006c76e5b7e), W(0x0006500fd6d80dd7), W(0x0000172ab247c537),
+     W(0x00067056f38b3b48), W(0x0002c72605778efc)},
+    {W(0x0000000000000001)},
+    {W(0x000443c642653027), W(0x0005d36e3a30b74d), W(0x0000e11c264d8166),
+     W(0x0005f321caff3c16), W(0x0003d81551b134fa)}
+  },
+  {
+    {W(0x00031c88caa67c0a), W(0x0005b17cc1c292b3), W(0x0004589f65fb6cb3),
+     W(0x0005fcd56c38f88f), W(0x0004a9fdf157ebcf)},
+    {W(0x000209dadae87cc9), W(0x00053d53c3cca8f2), W(0x00033d67cb3c0f49),
+     W(0x0005adee26ff3332), W(0x00028866658373bc)},
+    {W(0x0000000000000001)},
+    {W(0x00011c59988c5d58), W(0x000731ff8274b622), W(0x0003756da544bee1),
+     W(0x000480b2ddb005ce), W(0x0004ff75d495e704)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0003d525e99d4787), W(0x0000b4f0bbef08fc), W(0x000469e57d31e97a),
+     W(0x0006ce5014595179), W(0x00028bd38d44030d)},
+    {W(0x00041d6d78d5bbfc), W(0x000748889556933a), W(0x0002e666d3fb606d),
+     W(0x0001b99d69e273e6), W(0x000552dd7405c418)},
+    {W(0x0000000000000001)},
+    {W(0x00035f5b89a6dbe4), W(0x0006851f5995c8f8), W(0x000412fc66d6f9e4),
+     W(0x0007ae43f5941e7b), W(0x0006cc234a1107dc)}
+  },
+  {
+    {W(0x0007dce55f7be126), W(0x00044884d4f42fa7), W(0x0006d7c5f63f008c),
+     W(0x0007baea0cbda388), W(0x0000ec8fe27a51e6)},
+    {W(0x00052cefab3d11d3), W(0x000570264f87b63d), W(0x000701ecf073e3f9),
+     W(0x00053fbb3adc6fb0), W(0x0003de83daf93d8a)},
+    {W(0x0000000000000001)},
+    {W(0x000791aa0e554129), W(0x0006a23907baf00d), W(0x0003295c90831a9c),
+     W(0x000663e9b22448c5), W(0x00014ae37c7970d0)}
+  },
+  {
+    {W(0x00027eb68d4e5bfd), W(0x00022d2099ddf370), W(0x0006d54a83bffd49),
+     W(0x00066b6f17af0bbc), W(0x000190bb443a02d3)},
+    {W(0x0006f417484861c0), W(0x000645fd45aa2313), W(0x00022edc528f83cb),
+     W(0x0000aee0c0fa981d), W(0x0005a601f5562397)},
+    {W(0x0000000000000001)},
+    {W(0x00024c246b2456da), W(0x0006519c7abc393c), W(0x0002fbe77b018afc),
+     W(0x00056c474318798a), W(0x00047f03cc04f3dc)}
+  },
+  {
+    {W(0x0005db6c768a89e5), W(0x0005cb33ae4b6149), W(0x0003eb8df0618d8d),
+     W(0x0003d2fa46d0edf1), W(0x000393fb3d0b216d)},
+    {W(0x000776f56c0960ce), W(0x000298f2c7500482), W(0x000016d7bdafdcba),
+     W(0x0002ed28bde9f7cb), W(0x0004e2107bc67440)},
+    {W(0x0000000000000001)},
+    {W(0x0004d19e16c81fe1), W(0x0006ab74970cb7f4), W(0x000614fc7f5308e3),
+     W(0x0000f885f239268e), W(0x00051637af036999)}
+  },
+  {
+    {W(0x00069d00957c9907), W(0x0002660e070fd1e1), W(0x0006793524f516a2),
+     W(0x0005777daf72d122), W(0x00030d3831392a57)},
+    {W(0x0005cc64cff559b9), W(0x00064453c75f705d), W(0x0005800bb22610fe),
+     W(0x00040e73ee010047), W(0x00050e644a29bc85)},
+    {W(0x0000000000000001)},
+    {W(0x000658955f472291), W(0x0002545234028e4c), W(0x00046d3baa2e2872),
+     W(0x00015bfdb99cdddd), W(0x0007c10011013479)}
+  },
+  {
+    {W(0x00073d7b00d6838c), W(0x000372af3f3d7ba3), W(0x0005fe45b35dbf2e),
+     W(0x0002f823d692b6e4), W(0x00018b612324ccfb)},
+    {W(0x0003d75788f5a8bf), W(0x0006c1a1a3b440aa), W(0x0002cf4d85d1d3c5),
+     W(0x00063ee89401b498), W(0x0004b6dafa36309c)},
+    {W(0x0000000000000001)},
+    {W(0x0005cdfc76d8c498), W(0x0002766f17b412b6), W(0x0000be288bb8c62b),
+     W(0x0000ebd14fb32a68), W(0x00074b32dd64306f)}
+  },
+  {
+    {W(0x0007b2eca0b600c4), W(0x0007cc0e78963ab0), W(0x000184246ccec92f),
+     W(0x0003b54e750110bb), W(0x0006e847af3ae326)},
+    {W(0x000199f7a2182148), W(0x0001bd722e8edc1b), W(0x0006eed3a0e99d47),
+     W(0x00034de4aad941b2), W(0x000362ea253baea2)},
+    {W(0x0000000000000001)},
+    {W(0x00004438a7c1156f), W(0x0005450a615813ba), W(0x00068fa854ea3797),
+     W(0x00009b968038e14a), W(0x00027ed44b7ad467)}
+  },
+  {
+    {W(0x0002deb9216f73e9), W(0x0004620632fd6fa4), W(0x00063facdf1b87aa),
+     W(0x0007073220ef2c21), W(0x0001edff13d99073)},
+    {W(0x00020617c243adf8), W(0x0002e319b0d53c9c), W(0x0000274999d321e3),
+     W(0x000131536578d28c), W(0x0002e42eb00cbc19)},
+    {W(0x0000000000000001)},
+    {W(0x0004c98f03983180), W(0x000114ba79bd01eb), W(0x0003879f2c9bbdf0),
+     W(0x00024c51112c9655), W(0x000017c80741add0)}
+  },
+  {
+    {W(0x0006b2a9ed80dfa4), W(0x0004f9d00bd2ee4d), W(0x00009c6fc2abefc6),
+     W(0x0000e688bc82fe4a), W(0x0007cfc4f58bc416)},
+    {W(0x000673224a940c68), W(0x0002329ba407ac7e), W(0x00025f200c8732c8),
+     W(0x00027d2a3e185fee), W(0x000257448f9a0838)},
+    {W(0x0000000000000001)},
+    {W(0x0006048f3583a7ae), W(0x0007f3c9f9c5519c), W(0x0002d530d81dcc77),
+     W(0x000419b07673b3a5), W(0x0004928facf73f39)}
+  },
+  {
+    {W(0x000733caa80677c9), W(0x000299e828035553), W(0x0000ee98ffb4ec5b),
+     W(0x00027cf7e7ee6ca8), W(0x0003a8e92557689b)},
+    {W(0x0005fd60a0b2fada), W(0x000377bcafcdd90f), W(0x0004302705f270e1),
+     W(0x00051bdeba53f181), W(0x00042ffb7e01177d)},
+    {W(0x0000000000000001)},
+    {W(0x0005fe1df8e609de), W(0x0006ff6051e5afee), W(0x00043b24c2c0a41a),
+     W(0x00074e497df7026c), W(0x00001cc508cd4732)}
+  },
+  {
+    {W(0x0007d1a71ebc2db5), W(0x00066e91138568f2), W(0x0004608c9fef49db),
+     W(0x000281a49a7daaf2), W(0x0000a440b09c2b8e)},
+    {W(0x00009259ed88de24), W(0x00077eb991f88277), W(0x0001ebc4a8891881),
+     W(0x000544fe41a8a13a), W(0x00065d9265ea866b)},
+    {W(0x0000000000000001)},
+    {W(0x0004c184f20c76eb), W(0x00010d6b9b6a9f9f), W(0x00036a7a420cd6ce),
+     W(0x00066b1eff60351f), W(0x00006bba607946a7)}
+  },
+  {
+    {W(0x0000ea38f0689869), W(0x000406ada404c4ec), W(0x0005b4750f5cd99a),
+     W(0x000052361d4b7dfc), W(0x0006183a364160dd)},
+    {W(0x0005cb449843c51f), W(0x000781f1c4039263), W(0x000192fc10cdf00d),
+     W(0x00012a4f7473714b), W(0x0001a15638479def)},
+    {W(0x0000000000000001)},
+    {W(0x00000006272205d5), W(0x00014e5a3fa6814c), W(0x00046f6bcb56e4c7),
+     W(0x00002f6481908590), W(0x000091cd419bfd2b)}
+  },
+  {
+    {W(0x0006d00272ff6cb5), W(0x00021c320db32d15), W(0x000355aa61196019),
+     W(0x00047e24b8c8c5f0), W(0x0000b1245de8166d)},
+    {W(0x0002aced7f241661), W(0x00074f91bbd2d48f), W(0x0004c88c4f1058c0),
+     W(0x00036c0927338850), W(0x0004825ed60a9c33)},
+    {W(0x0000000000000001)},
+    {W(0x00028d1e35c65636), W(0x00063000f10754d8), W(0x000421a399cd0019),
+     W(0x0001a58dae05bd21), W(0x0003745414c74006)}
+  },
+  {
+    {W(0x0007ed6fe2c2226c), W(0x0003a5d8cf40aac8), W(0x0002eef2bc6fce4c),
+     W(0x0007fafb7bd209df), W(0x0000d6512e03a75b)},
+    {W(0x000149bc5d0c9416), W(0x0004e98c54616194), W(0x0004714a692afa3c),
+     W(0x0007bf7172e7fe22), W(0x0005d7876bba1da7)},
+    {W(0x0000000000000001)},
+    {W(0x0006d762bca92412), W(0x00019336671c2788), W(0x00042741b09bf4d3),
+     W(0x0007b953721245b7), W(0x00058d1c12269719)}
+  },
+  {
+    {W(0x00011cd01fcd12f4), W(0x0004618521f6e796), W(0x0001c21ae4c388c1),
+     W(0x00061c4fbbd5fb59), W(0x00026b1be517152c)},
+    {W(0x0000ac1e45613b47), W(0x00031dda00a029dd), W(0x00073a9d0a57f547),
+     W(0x0003b87b48619b71), W(0x0005e6b8e69fdda4)},
+    {W(0x0000000000000001)},
+    {W(0x00059b00dbfc21ae), W(0x000789d6c4fbb62f), W(0x00035d65adc20df7),
+     W(0x0000eb1f9ddd6443), W(0x0002109a0d58a857)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x000538cf4c24347b), W(0x0001644580214d9c), W(0x000065f892b4e090),
+     W(0x00009afa18fcb678), W(0x00059233a3346f61)},
+    {W(0x0001ad1908a10b20), W(0x0006c12467dd4a87), W(0x000273f136f34b8a),
+     W(0x00015c9f910b09f8), W(0x0003cce55908611d)},
+    {W(0x0000000000000001)},
+    {W(0x000211c0b42a55b2), W(0x0004ed0427e178e3), W(0x0004c9356b1516a5),
+     W(0x00069d1dce3e6891), W(0x0005148348079e4a)}
+  },
+  {
+    {W(0x00063c4afdbfea1a), W(0x00024eeeefc53d91), W(0x0005fd57e6135e64),
+     W(0x0006d1cae95a45f8), W(0x0004b82eba78af08)},
+    {W(0x0002def63af4282c), W(0x0007ff0468883c01), W(0x000131570e7d900c),
+     W(0x0007ae920e4a60e3), W(0x0001437579645925)},
+    {W(0x0000000000000001)},
+    {W(0x0000246584eef2ac), W(0x0007eed383625d50), W(0x0007a81d324dba5d),
+     W(0x0003cc605cc4a45d), W(0x0004f0712645e823)}
+  },
+  {
+    {W(0x000632622635e33b), W(0x00052e9cd69c0fe0), W(0x00006e410a82df82),
+     W(0x0000ed3f688ec67f), W(0x00021ebcdaffd7c5)},
+    {W(0x00014201c30a5427), W(0x0000a322c29d1ea9), W(0x000724f6855b8ab5),
+     W(0x00012d4bb4a384ab), W(0x0001975aaddb508a)},
+    {W(0x0000000000000001)},
+    {W(0x0005c1a1e9bd6d3c), W(0x0005d279ddcd60f5), W(0x000588acdb667659),
+     W(0x00071248b7dc1adb), W(0x0000e10bc5cdf63f)}
+  },
+  {
+    {W(0x000076b96690cdc1), W(0x0007246eb0b4ab74), W(0x0006c5beca0a9627),
+     W(0x0006ad0c37b4e275), W(0x0001a2cd99d3d94e)},
+    {W(0x0007b70673e6b035), W(0x00025d04561f1c06), W(0x00056b1b9bbc2fb7),
+     W(0x00024b824f8d4f4c), W(0x0004044babe0b4de)},
+    {W(0x0000000000000001)},
+    {W(0x0007a2a1e5b2c2cd), W(0x0002749d5846f999), W(0x00031627bdc9b0f0),
+     W(0x0006c4f36c3824d0), W(0x0000baf6990ab6cf)}
+  },
+  {
+    {W(0x0000dde3348bad11), W(0x0006a1297aa6dd2b), W(0x0005ed699471a1c4),
+     W(0x0006b999e741daec), W(0x0000ea21d015e547)},
+    {W(0x000535acb84325b9), W(0x0003dc294ccc7340), W(0x00026ad105c0d8f7),
+     W(0x00058fcac89e056c), W(0x00048bc49f24f32f)},
+    {W(0x0000000000000001)},
+    {W(0x0003f6009c5ff416), W(0x000758bb815b8642), W(0x000002f2d71e22f5),
+     W(0x0001bcb6104cc12d), W(0x0006976859aec89b)}
+  },
+  {
+    {W(0x0003a35f87c57eeb), W(0x0001839c949ba652), W(0x0005b1579d900db8),
+     W(0x00006edf501dcddd), W(0x000731c295bf389b)},
+    {W(0x00068626e1c49ae2), W(0x0002aafe5cb2875d), W(0x00057b2581e252cf),
+     W(0x0005b9c18411cb1d), W(0x000420af866c950e)},
+    {W(0x0000000000000001)},
+    {W(0x00051e43d487daae), W(0x000246bdec2e96b9), W(0x00034840fc581a7a),
+     W(0x0001a7a308bd85f3), W(0x0002d64cdd65c362)}
+  },
+  {
+    {W(0x0003f2b196cb731e), W(0x00075a27ea4b75be), W(0x00058a18d8c62e26),
+     W(0x00058a9af375fa1f), W(0x0007dca830010795)},
+    {W(0x0003de8b829f5202), W(0x000641482d79f618), W(0x00064c9fb8179aac),
+     W(0x0000ebd5aef2041e), W(0x000545c39f9b3c85)},
+    {W(0x0000000000000001)},
+    {W(0x0006fdcc17cd3042), W(0x0006c97265d15ebf), W(0x00078721934bf588),
+     W(0x00046bf530339a92), W(0x0002f6e044ad5cd3)}
+  },
+  {
+    {W(0x00031f5f919656c1), W(0x00064151310dea97), W(0x0003ba09a909075a),
+     W(0x000387b2983b550a), W(0x00024497c51a6396)},
+    {W(0x00050f11d178a335), W(0x0002241b68ce1a6e), W(0x0001d04152024b2d),
+     W(0x00040451ebd4c31b), W(0x0003b80f82901f17)},
+    {W(0x0000000000000001)},
+    {W(0x0001bc4f34205c2c), W(0x0001b9a280d2fe88), W(0x000535336c76786d),
+     W(0x0004abadf3a8d5c9), W(0x0004ba9ed6bc3802)}
+  },
+  {
+    {W(0x000166c520ccc1d8), W(0x000284df90601a33), W(0x00029cc610cfab20),
+     W(0x000286c8183377eb), W(0x00007203c87321fe)},
+    {W(0x00030c864050d2a6), W(0x0000c6037060b24b), W(0x0000560e42f7e1a9),
+     W(0x0001d576bf59d5bc), W(0x0002fb4d95c51f7b)},
+    {W(0x0000000000000001)},
+    {W(0x00048574f9522030), W(0x000506155a290616), W(0x000327b56ed876b1),
+     W(0x00058f453ef22397), W(0x000183bf50e06e8d)}
+  },
+  {
+    {W(0x00076def871246e0), W(0x0001e75239d87a81), W(0x00059fc630171be1),
+     W(0x0002a29a269e0ee0), W(0x00038fbb4d21fe6f)},
+    {W(0x000300750c768373), W(0x00041eb326d5acef), W(0x0004f045012ba2e2),
+     W(0x000348e5c3b1864d), W(0x000458d9494e76e4)},
+    {W(0x0000000000000001)},
+    {W(0x0000899dff190414), W(0x0004896de7df2b8b), W(0x0007d9a18ae243e3),
+     W(0x0003264dcf63adb5), W(0x000390216ed34528)}
+  },
+  {
+    {W(0x000072da08dbb3c6), W(0x000192129cf27d8b), W(0x0004fd3ef0a24b2a),
+     W(0x0000b08d1ae8b1d6), W(0x0003679e1e351dce)},
+    {W(0x0005c2170152bfa3), W(0x000285a6fa3c71aa), W(0x00042d228f22d26b),
+     W(0x0007560533dbc50f), W(0x0000849dd93e82ce)},
+    {W(0x0000000000000001)},
+    {W(0x0000333fe4593cae), W(0x000583719b1a3903), W(0x0001b565a1cd69f3),
+     W(0x000699d74b04676a), W(0x0003999138564223)}
+  },
+  {
+    {W(0x0004a0bf9d9da7db), W(0x00072334544a7db9), W(0x00034560dc660d20),
+     W(0x000461457ba01402), W(0x0004c53cf42a5b70)},
+    {W(0x0007ddad8ef6bba7), W(0x0005d1326bfbb21e), W(0x0003a2de6b98dc12),
+     W(0x0005625f950b6fe0), W(0x0005a7289d5413c3)},
+    {W(0x0000000000000001)},
+    {W(0x0003ba489f800147), W(0x0000d0ebef6400ab), W(0x00022a0fa0d341c4),
+     W(0x000056128fd48cb9), W(0x0000a1566d154e27)}
+  },
+  {
+    {W(0x00075e3e56be1087), W(0x00059ed7f652e2a5), W(0x00055cbfd4397aee),
+     W(0x0007ffced608c9ed), W(0x000612699cfec584)},
+    {W(0x0003f5358d29247d), W(0x000485e98fdaccee), W(0x0003266ebd849b35),
+     W(0x00042c6df6a5aefa), W(0x00012e7495631a1e)},
+    {W(0x0000000000000001)},
+    {W(0x000312a7178b4400), W(0x00053562c36a1ec9), W(0x0006df4ca313e4c5),
+     W(0x00035fe12d83d7a1), W(0x00012cfc4f3c9ba2)}
+  },
+  {
+    {W(0x00013d8c76a1aeb7), W(0x0005dfc2cbe3f4c2), W(0x000206f8e4afb6f1),
+     W(0x0000edfccbe46ff4), W(0x00042fd325f39afb)},
+    {W(0x0005195396af4565), W(0x0002116a1604465a), W(0x00052b093f4ecf65),
+     W(0x0006d8cab8e14909), W(0x00074ca5bbb5feaf)},
+    {W(0x0000000000000001)},
+    {W(0x000183fc48da7074), W(0x0007d3a174036856), W(0x00057f9b1fc54162),
+     W(0x00006faba53d5c0e), W(0x00036980378f0d92)}
+  },
+  {
+    {W(0x00061811bd5222c9), W(0x0000192680bef868), W(0x00044537b4ee4555),
+     W(0x0007df5b5db2c5ee), W(0x000068ecdd3ef969)},
+    {W(0x00032810b98df4bd), W(0x0001eb6cf329d968), W(0x000706fb314fdefe),
+     W(0x0001a19cafa398e6), W(0x000081ebb1d126d2)},
+    {W(0x0000000000000001)},
+    {W(0x0000777578d389e6), W(0x0002b615b0aa8d33), W(0x0000a02fafef8a1b),
+     W(0x00053ef0a860a2d9), W(0x000181463998807c)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0001132c34ff961f), W(0x000677d0b1215964), W(0x0002be5f787a79c2),
+     W(0x0006a044a47b984b), W(0x0005830f025f1078)},
+    {W(0x000717e25793d41e), W(0x0000406aa79573bc), W(0x0000c0795b6cacbe),
+     W(0x0001fff337239217), W(0x00067d451752c243)},
+    {W(0x0000000000000001)},
+    {W(0x000133e47f92480b), W(0x0005e16ced41ff62), W(0x00011ec3f2ddabc7),
+     W(0x000084089dba2c67), W(0x0007ccd179cfce91)}
+  },
+  {
+    {W(0x0004e15da1d9062b), W(0x000538d34783da3e), W(0x00036301e04c4cac),
+     W(0x0004e4d4cf168b8b), W(0x00019929124ab577)},
+    {W(0x000175a69ca1fb69), W(0x000088480e6c0fa9), W(0x00041079e654284f),
+     W(0x0004060f4dccca41), W(0x00052c0cbef541fe)},
+    {W(0x0000000000000001)},
+    {W(0x0001919dd037f7f0), W(0x00046c95f539afae), W(0x00079a2fafff96a5),
+     W(0x000590caa3a860bb), W(0x00064ab933fc626a)}
+  },
+  {
+    {W(0x0003720f2c76158f), W(0x00054598b784e873), W(0x0001658af745782b),
+     W(0x0005929eccd5cb86), W(0x000633198a5af64e)},
+    {W(0x00040de64a7b0c18), W(0x0007a060f97789b8), W(0x00030a09a3c7b09c),
+     W(0x00073b47904223a0), W(0x0000888e9e9da049)},
+    {W(0x0000000000000001)},
+    {W(0x00030eda28e403f4), W(0x00027d41a639ac6b), W(0x0007b21047331706),
+     W(0x00041991129c809d), W(0x00040316e927f1b8)}
+  },
+  {
+    {W(0x00028737a1738914), W(0x000345db23b9ef4d), W(0x000673c301d3b59c),
+     W(0x0000bddf846fee99), W(0x0000849c9e6da66d)},
+    {W(0x00060ab0555edde9), W(0x00001a85cb49843b), W(0x000313c5ea495cea),
+     W(0x0001c96497d7a016), W(0x00009f4dcbc5ae50)},
+    {W(0x0000000000000001)},
+    {W(0x0005a0c66de39ef7), W(0x0003f84d9b86cb39), W(0x0005f0d5cf58fd2a),
+     W(0x00065c28aa2d1993), W(0x0007d767b87e11e7)}
+  },
+  {
+    {W(0x0005cd31fd1e41bf), W(0x00059b5fd0d0b914), W(0x000340e41ce5965b),
+     W(0x00066ef688d92dc4), W(0x0001deb18e4d05b2)},
+    {W(0x00020912f604fd5f), W(0x00042b3fcd320750), W(0x00002a01c840d23c),
+     W(0x000220cb51fa5db5), W(0x0004ac1d5c8cb78e)},
+    {W(0x0000000000000001)},
+    {W(0x00010862f0c3836d), W(0x00007ca3d95f5deb), W(0x00042905ccbf2747),
+     W(0x0004ab664f3492fc), W(0x0005f2104dbe6c22)}
+  },
+  {
+    {W(0x000086057c2be1f3), W(0x0007d1f695a95270), W(0x000747bf37f43265),
+     W(0x000220899a34967f), W(0x0001e0990d03bcf6)},
+    {W(0x000245e680d6459d), W(0x0000e68b9542be95), W(0x00058a109a328a66),
+     W(0x0002f5296014db3e), W(0x0000ea9350f1881f)},
+    {W(0x0000000000000001)},
+    {W(0x000097da145ad9c1), W(0x0005065ee1575abf), W(0x0003a70f66e81394),
+     W(0x0007ea568c2acdfe), W(0x00004162601f4748)}
+  },
+  {
+    {W(0x0003d3fb9791b943), W(0x0003d4aae98c1e45), W(0x0001b7a57195d8e8),
+     W(0x0004622b7eac6924), W(0x0001cb7a40c1d8d4)},
+    {W(0x0006dbaec67ef776), W(0x0002493599c90707), W(0x000733b30c4de9a5),
+     W(0x00008e9020d152b0), W(0x0002835019689be9)},
+    {W(0x0000000000000001)},
+    {W(0x00041f9a96aec874), W(0x0003d04dd051341f), W(0x0007feac979bfac7),
+     W(0x0003568e249fb3d5), W(0x000013108548efa2)}
+  },
+  {
+    {W(0x0007946d7c7220e7), W(0x00065e3c6a888a4b), W(0x00024ab83d18dac2),
+     W(0x0006d8bcb74eb874), W(0x00003dec05fa937a)},
+    {W(0x0004271cc6375515), W(0x0000949949e28da3), W(0x00056bf0e5189623),
+     W(0x00017ab48894ff72), W(0x00015949f784d847)},
+    {W(0x0000000000000001)},
+    {W(0x0001e510afad0049), W(0x00000e7730c1d7b1), W(0x000402be75347c23),
+     W(0x00038a03b8b74596), W(0x00070d685f68f859)}
+  },
+  {
+    {W(0x0005d2e7762f52c7), W(0x00066782c66732d7), W(0x0007556dd6a911e7),
+     W(0x0006372b8ea7e013), W(0x000759eead8ef453)},
+    {W(0x0003f61309b19ca0), W(0x0001ae1306836489), W(0x0003b2fe309046a1),
+     W(0x0003b7848de607cd), W(0x000580c0ccf483b9)},
+    {W(0x0000000000000001)},
+    {W(0x0007db7d9fccc7db), W(0x00044bb0687ff3d5), W(0x00046c5ff60348bc),
+     W(0x000520434d147aff), W(0x0003cb2819c463dc)}
+  },
+  {
+    {W(0x0007e8e3869c3b2e), W(0x00057777e962e203), W(0x000429acb98f800f),
+     W(0x00032ee7ae430bd9), W(0x00064de090cd3d65)},
+    {W(0x0001958ea07eb4fe), W(0x0001c6cd23f44350), W(0x000782a1d354e620),
+     W(0x00071f1a295a018c), W(0x0000b9840bc88b67)},
+    {W(0x0000000000000001)},
+    {W(0x00032e401e2c88ec), W(0x0003f8ded14e2917), W(0x0004142f95d84a71),
+     W(0x000541a6c7ee8b92), W(0x00019867aa6f979a)}
+  },
+  {
+    {W(0x00023645176913e9), W(0x0004f52c8483b7d7), W(0x0003cd049fcb5bea),
+     W(0x0004240c4d564c2a), W(0x0002901dec124254)},
+    {W(0x0000b2a283dbfde2), W(0x00027619fe552343), W(0x000294a5d842f808),
+     W(0x0000caf9a5a9f983), W(0x0007df3164c85cc7)},
+    {W(0x0000000000000001)},
+    {W(0x0006b20cc502db4c), W(0x0001b6ac66075000), W(0x0002a691e8ad848c),
+     W(0x0002bf215be73082), W(0x0000df03660f6192)}
+  },
+  {
+    {W(0x0007b44f1d730313), W(0x0006eac1adab6f0f), W(0x00060cd9e5c65f6d),
+     W(0x0006f639bad24b14), W(0x00071009a1ab1ae9)},
+    {W(0x00076c5debcc0328), W(0x0006716163e75bfa), W(0x00055721785e6f2b),
+     W(0x0007909d83c0d55a), W(0x0003a2f80633383e)},
+    {W(0x0000000000000001)},
+    {W(0x0000d51e2cb283cb), W(0x0007727b04464145), W(0x0004926fd87a2a60),
+     W(0x0005dffbd3dbf238), W(0x00010f65c4fa1613)}
+  },
+  {
+    {W(0x000575a585f1909f), W(0x00065d9f00598bad), W(0x00030290763b584d),
+     W(0x00074c6a04183b00), W(0x000335cbd0fd4f5a)},
+    {W(0x00047387c73d2a3a), W(0x0007fb7776e93ce0), W(0x0003095029d8f436),
+     W(0x0002bc028c2bf29b), W(0x000551a44b0243ab)},
+    {W(0x0000000000000001)},
+    {W(0x00015a836e20bac9), W(0x000347f3264635bc), W(0x00077b5c1d22e349),
+     W(0x00047709f3e17ad1), W(0x00072b780aad7a36)}
+  },
+  {
+    {W(0x00050832686327a1), W(0x0006df06cadb4660), W(0x0006c5292c228763),
+     W(0x0001a8b191935027), W(0x0002c5187883c2ae)},
+    {W(0x000063cf6d0a2a6f), W(0x00040a17c0455f76), W(0x0001722cfebeaadf),
+     W(0x0006de8a50c97f9a), W(0x0004a9df2b1d17ad)},
+    {W(0x0000000000000001)},
+    {W(0x00034a9438159741), W(0x00066377ffd4f375), W(0x00052275940c1bad),
+     W(0x00025dda06df826d), W(0x00062876c7ab5f21)}
+  },
+  {
+    {W(0x0000f79316bb308a), W(0x000797712ec34493), W(0x0006669dfc9e8208),
+     W(0x00029e7b3a179f81), W(0x0000838c5d46f9d0)},
+    {W(0x0005644bed72268d), W(0x00003b46d8a61605), W(0x00031ef07f9b69e7),
+     W(0x000380685a4fe6a5), W(0x0001852a83ff5864)},
+    {W(0x0000000000000001)},
+    {W(0x000004493ca66890), W(0x0006f8daeffa45d6), W(0x0001b61f7ca97907),
+     W(0x00040dd8357e1ce6), W(0x0002b6b969469179)}
+  },
+  {
+    {0},
+    {W(0x0000000000000001)},
+    {W(0x0000000000000001)},
+    {0}
+  },
+  {
+    {W(0x0002b00b57ffd3ec), W(0x0002a25c49ff1b96), W(0x0005b50c25aef8db),
+     W(0x00043a5c16c826d1), W(0x0006a0c8b194571e)},
+    {W(0x00032cad031c42b8), W(0x000265331af591c0), W(0x00079f52d4a40b18),
+     W(0x00039af641c5e667), W(0x0005f85adb7749cc)},
+    {W(0x0000000000000001)},
+    {W(0x0005aa483b5ff43d), W(0x0004d1c96ff95f78), W(0x000607f8ca0b681b),
+     W(0x0007f503e83fe467), W(0x000534805d4e6ee6)}
+  },
+  {
+    {W(0x0000694556e18478), W(0x0007e5363709eb4d), W(0x00065b2edcc40ccf),
+     W(0x00058d4c20f37312), W(0x0003491b2f25603b)},
+    {W(0x000362a466f76c2c), W(0x00039a6cb756672d), W(0x00060372faa847e0),
+     W(0x0001f1f2bdfac3ac), W(0x0000988beda393eb)},
+    {W(0x0000000000000001)},
+    {W(0x00017ecaad3c6c3b), W(0x0004b32b487df8f0), W(0x0000d90e5c8fc087),
+     W(0x000479500aa884df), W(0x0002beadf44f6cbe)}
+  },
+  {
+    {W(0x000429dcf5a0f18b), W(0x0002000f58c0fc56), W(0x000352ef51445e27),
+     W(0x0005123e3ebf7511), W(0x00006951222e8f2e)},
+    {W(0x0006baf40ca47cda), W(0x0006394b36b13c2d), W(0x0007891024d8a703),
+     W(0x0002f54c8ab1e8bf), W(0x0006f44c09d0ccf2)},
+    {W(0x0000000000000001)},
+    {W(0x000082504afcb43c), W(0x00049a7fd096e603), W(0x00003b7f076c4ee5),
+     W(0x00065481369d1796), W(0x0002570665628e37)}
+  },
+  {
+    {W(0x000037f7cf4e861d), W(0x0007633f6251e4a2), W(0x0007d78b2043b783),
+     W(0x000586cb6019d8ba), W(0x000055f070d6c15f)},
+    {W(0x0002af2c97473e69), W(0x00072375b06f0f8a), W(0x00036d1dbc08be08),
+     W(0x00042accc8f0d815), W(0x000511144a03a99b)},
+    {W(0x0000000000000001)},
+    {W(0x0007c3b88ff2e4ae), W(0x00061bc2461febf5), W(0x000124a1c215793f),
+     W(0x0000de39718151a4), W(0x0001253c19e53dbe)}
+  },
+  {
+    {W(0x00004555f71f1ccc), W(0x000282c726c836f8), W(0x0007be904a457ce3),
+     W(0x00024ec29d2f26d8), W(0x0001c1d4afdd9000)},
+    {W(0x0000c4cdc7e0eb8f), W(0x00015a1fb9274f78), W(0x000165fb0879bd66),
+     W(0x0000bedc13441198), W(0x00075b1537376960)},
+    {W(0x0000000000000001)},
+    {W(0x00001c77a71f8e81), W(0x0006b8df2f72b9ee), W(0x000389f9a8eb4ab6),
+     W(0x0001f8757673b488), W(0x0000416f4d7b3410)}
+  },
+  {
+    {W(0x0003908dcbc71630), W(0x000772cf8ddf4891), W(0x00001c206593c434),
+     W(0x0005e238035fbc94), W(0x00053135b15e38b5)},
+    {W(0x00024387c822ebfe), W(0x0004cf0a8ffb7f4d), W(0x0004c491cbdf2ed1),
+     W(0x0002f48fe5c7aaef), W(0x0001c90d397234d8)},
+    {W(0x0000000000000001)},
+    {W(0x0001855ea03298d7), W(0x0004619257d41140), W(0x0002345f2438c55e),
+     W(0x000583f26a20fa9e), W(0x000086a868a1c21d)}
+  },
+  {
+    {W(0x0002424d7d28174c), W(0x0002b41bddeec84a), W(0x00009e32e544f640),
+     W(0x000666e95cab16cf), W(0x0001f5e67574686e)},
+    {W(0x0002004ae0296477), W(0x000641b0c8e03896), W(0x0000cbaaa8663f1a),
+     W(0x0004ae96f491aafd), W(0x000320988a39e8b7)},
+    {W(0x0000000000000001)},
+    {W(0x0001fd798108a5ee), W(0x000211c4464ff00e), W(0x0001ba6e9d248e62),
+     W(0x0002bc9848ae4525), W(0x00061c77325226c6)}
+  },
+  {
+    {W(0x0003b3837cfadf6c), W(0x0002e52c2a277ddd), W(0x0005ed59938680e4),
+     W(0x0003e8eed6f035b5), W(0x00011f540171499d)},
+    {W(0x0005a81ca4944b6e), W(0x00060135cd11d197), W(0x00052e0a8bb94fa5),
+     W(0x0003417e963480f5), W(0x000418b827fe0251)},
+    {W(0x0000000000000001)},
+    {W(0x00008e6937d457d1), W(0x0006a5bf6698cd77), W(0x000397decfbb947f),
+     W(0x00059689ea5627a2), W(0x00001d3377fa140d)}
+  },
+  {
+    {W(0x0001e1a35362b889), W(0x000430c6dea5150e), W(0x00054a029ba10622),
+     W(0x000329b81e9d8089), W(0x0007e80126fc8017)},
+    {W(0x00006ef3f7bf47e8), W(0x0004cc95a82980a8), W(0x0005d0a01a41a2d2),
+     W(0x0003b7bcb7c1b148), W(0x0006666a33b28f90)},
+    {W(0x0000000000000001)},
+    {W(0x0005b20128475538), W(0x00013c86451d9f83), W(0x0007230e27db4ecf),
+     W(0x00061b08846298de), W(0x0003e99b14885b43)}
+  },
+  {
+    {W(0x00015ff8ef3cb304), W(0x0003c041b626c8b5), W(0x0005445f06c26564),
+     W(0x0002603ea644a431), W(0x0001d5f21c46cf32)},
+    {W(0x000657b04dfb39b6), W(0x000559bfcc0d49b9), W(0x0007d682933861ba),
+     W(0x0006850251b10b6b), W(0x000606d9cb7cf2be)},
+    {W(0x0000000000000001)},
+    {W(0x000608c1da8bd069), W(0x00056147de131ebd), W(0x0003f32eec0f7f3e),
+     W(0x0000dbb162ef8724), W(0x00044f35e3a32c6b)}
+  },
+  {
+    {W(0x00077aab609415c1), W(0x0006a52ea3e2a3fb), W(0x0000fa66e7bdd958),
+     W(0x00002570dd029bc3), W(0x00042626609d0079)},
+    {W(0x000461b0e138f8c9), W(0x00040905d4ff372a), W(0x0003d2517d3b518a),
+     W(0x0003109eb9e5f141), W(0x0007086d6c39c77e)},
+    {W(0x0000000000000001)},
+    {W(0x0006d921d1d44a62), W(0x0003a83f8669f1b7), W(0x000696115b46c907),
+     W(0x0000dcb1d96d8530), W(0x000489e5b385bca8)}
+  },
+  {
+    {W(0x0005cad1d5587862), W(0x00046fe747004ad2), W(0x00071dd86af3cf32),
+     W(0x0004bba403b94589), W(0x0004f571bfccf71c)},
+    {W(0x0004c22f28fff766), W(0x0000e98c50bb68f9), W(0x0002e095d5aaadfd),
+     W(0x000063ef5f626b6d), W(0x0004e73bd13e0e16)},
+    {W(0x0000000000000001)},
+    {W(0x0003f1f8ab34fb18), W(0x0003079163b0ccae), W(0x000026348ab8e551),
+     W(0x000251977fadd5d5), W(0x00078c4ac8a9db16)}
+  },
+  {
+    {W(0x000703cf11bfc2fd), W(0x00070ac0189c26ea), W(0x00079c2827d53966),
+     W(0x00034c697f021248), W(0x00027795476fccd8)},
+    {W(0x000012e142cd2c6a), W(0x0003e9f0fa078e55), W(0x00040ac2c88b6891),
+     W(0x000164e1b0088dad), W(0x0006d7045b6dccf6)},
+    {W(0x0000000000000001)},
+    {W(0x0007989a064331b2), W(0x0007022b45ce1df0), W(0x00045d0df18925bb),
+     W(0x0003686113d6faab), W(0x0002434c9e764bdd)}
+  },
+  {
+    {W(0x0007783959c595c1), W(0x0006db370c056d11), W(0x00032316d1f8f4bf),
+     W(0x0001bd93a6c6ebe3), W(0x000445f44b573e62)},
+    {W(0x0007cce46faa2636), W(0x00025d92dd2c73ee), W(0x00060969a0b00178),
+     W(0x00065fa9fa72e2d1), W(0x0005f620162ba5df)},
+    {W(0x0000000000000001)},
+    {W(0x00066387c4f643fd), W(0x000419285594244f), W(0x0001f990565cde56),
+     W(0x0000b5c08ab29dbc), W(0x0007c9a95312af88)}
+  },
+  {
+    {W(0x0003c891b5ff6500), W(0x0005210addb68645), W(0x000366aa56d43ef0),
+     W(0x0001709bd54818fd), W(0x00060de407e37d57)},
+    {W(0x00060530835fd1e5), W(0x00077701be64f18a), W(0x00051a650ea34cd9),
+     W(0x0004e881d57161a7), W(0x00042c8c4c1f6855)},
+    {W(0x0000000000000001)},
+    {W(0x0001751f50b14887), W(0x0006257ebf1e952d), W(0x0004f9906281f1c2),
+     W(0x0003df942440b260), W(0x000319bdbcbb0b9e)}
+  }
+};
+
+static const xge_t ed25519_wnd_naf[1024] = {
+  {
+    {W(0x00062d608f25d51a), W(0x000412a4b4f6592a), W(0x00075b7171a4b31d),
+     W(0x0001ff60527118fe), W(0x000216936d3cd6e5)},
+    {W(0x0006666666666658), W(0x0004cccccccccccc), W(0x0001999999999999),
+     W(0x0003333333333333), W(0x0006666666666666)},
+    {W(0x0000000000000001)},
+    {W(0x00068ab3a5b7dda3), W(0x00000eea2a5eadbb), W(0x0002af8df483c27e),
+     W(0x000332b375274732), W(0x00067875f0fd78b7)}
+  },
+  {
+    {W(0x0002485fd3f8e25c), W(0x0003302c4910d58c), W(0x00036b20e98d0e60),
+     W(0x0007a48ffa573a1f), W(0x00067ae9c4a22928)},
+    {W(0x0003684878f5b4d4), W(0x0002ece480608058), W(0x00009a7bde7c5bb0),
+     W(0x0004d5d09350c730), W(0x0001267b1d177ee6)},
+    {W(0x0000000000000001)},
+    {W(0x000108fa78b3a41a), W(0x00017f62df8959bf), W(0x0006e4549d709cd6),
+     W(0x00028875f79bc1d6), W(0x0002a4d025cb1dd9)}
+  },
+  {
+    {W(0x00009cc0322ef233), W(0x000727c37c34b228), W(0x0004b6977970a067),
+     W(0x00043dfe77be7be8), W(0x00049fda73eade35)},
+    {W(0x00021f83d676c8ed), W(0x00015128616ba21a), W(0x0006491998c4a0bb),
+     W(0x000737f016370a44), W(0x0005f4825b298fea)},
+    {W(0x0000000000000001)},
+    {W(0x000150bcf3e801d0), W(0x0000a00124d7ec83), W(0x0004db1fe6bee53a),
+     W(0x0006a618b0752843), W(0x000745c562c9c593)}
+  },
+  {
+    {W(0x0005981af50e4107), W(0x0006777e39d2ab0a), W(0x000476041e0fa027),
+     W(0x0006a774f1f70ca5), W(0x00014568685fcf4b)},
+    {W(0x0004c4b59f4062b8), W(0x0000def57e47a258), W(0x0004dab507c220ad),
+     W(0x000297c3e732346e), W(0x00031c563e32b47d)},
+    {W(0x0000000000000001)},
+    {W(0x000545565587ed1b), W(0x000543d3549c8217), W(0x000756ead14a518c),
+     W(0x00070dcdf416e2c4), W(0x000119e77b11d165)}
+  },
+  {
+    {W(0x000023065185715c), W(0x000385c9c0529a7c), W(0x0006508ae21b6039),
+     W(0x0000b28df99b7037), W(0x000357cc970c8007)},
+    {W(0x000644845522f1c0), W(0x0002646dc88618e9), W(0x0003cb4bf47de240),
+     W(0x0006fa595f7e74ab), W(0x0007f3d23c2c2dd0)},
+    {W(0x0000000000000001)},
+    {W(0x0003386f88b2f465), W(0x00041eee064fcb87), W(0x00051f35d05ecf52),
+     W(0x0005fcedb33b56fb), W(0x0005c70fc48ea87c)}
+  },
+  {
+    {W(0x0007d2c1207cf3cb), W(0x000658b27aaa5fe5), W(0x0001c490e34e0696),
+     W(0x00020bdb6783c6eb), W(0x00014e528b1154be)},
+    {W(0x00072dc36a033713), W(0x000387938b1a8611), W(0x0003fc3f38496164),
+     W(0x0005cbad37be71a0), W(0x0002d9082313f21a)},
+    {W(0x0000000000000001)},
+    {W(0x0005cf2edb5beed4), W(0x0003bc31f906fd70), W(0x00005ab6fd640007),
+     W(0x0004511ce5535f79), W(0x0005ae6a565800f2)}
+  },
+  {
+    {W(0x0000e073b7c05fed), W(0x000511a456f706f0), W(0x0000b4c13e210f8f),
+     W(0x0003666d99d6f814), W(0x000107427e0d5f36)},
+    {W(0x0007e1aeea401f80), W(0x0006451344e470fd), W(0x00036a26e0dd033e),
+     W(0x0005ba3c23301169), W(0x00012dbb00ded538)},
+    {W(0x0000000000000001)},
+    {W(0x0004dccde8de2f53), W(0x00023d65d1df8a45), W(0x0005588ce16c52a9),
+     W(0x00023062e06eb0e6), W(0x000412806b917be6)}
+  },
+  {
+    {W(0x00017f3e66a18dc1), W(0x00068ee03139720c), W(0x000481067b658c4d),
+     W(0x00021aee2d637cae), W(0x0004f162deaec2ec)},
+    {W(0x00054cc4ad2e5cdf), W(0x000314335354328d), W(0x00034a4cc6b396bc),
+     W(0x00017aa8b17b80b2), W(0x00012cbfb2d04ff2)},
+    {W(0x0000000000000001)},
+    {W(0x00057f335c92bf29), W(0x0001fc815cbea281), W(0x0005d8378be98eda),
+     W(0x000248d5927e9120), W(0x0005e33f00e36b77)}
+  },
+  {
+    {W(0x00017853a876df6a), W(0x000370b44169b8ab), W(0x0003f5ca46365261),
+     W(0x000374dc283a0f51), W(0x0007dc52d5a7db81)},
+    {W(0x0004fe9bec97be04), W(0x000647669f2039ad), W(0x0002467edc5ec621),
+     W(0x00077cf9256122e6), W(0x0006f6d2bca60003)},
+    {W(0x0000000000000001)},
+    {W(0x0003b596c3b3053f), W(0x0004417537ed1fb7), W(0x0001dbac02dcff6a),
+     W(0x000253a2ac865570), W(0x00025031aba502c0)}
+  },
+  {
+    {W(0x00011a3a04a94472), W(0x0004a608d2dce9ef), W(0x00058ee706c38a06),
+     W(0x000638117460a06b), W(0x0001d81f74a5ba45)},
+    {W(0x00066102691d55b9), W(0x000047e86be6107f), W(0x00075973d0b860c2),
+     W(0x0001a3913e2ddb6e), W(0x0003f185a93d95a4)},
+    {W(0x0000000000000001)},
+    {W(0x00040427c5001131), W(0x0004a37ca6aa5178), W(0x000453fbe507cc27),
+     W(0x00006f3fd2467682), W(0x00066fd9c161a725)}
+  },
+  {
+    {W(0x00063e7ef9365716), W(0x0003bbc7a0e7988b), W(0x0001d507b7c94b2c),
+     W(0x000743cac2c47cea), W(0x0006f0ac78e5eb90)},
+    {W(0x00066051336d289e), W(0x0000b8fb14addff8), W(0x0003e330d6b81b57),
+     W(0x000572f991f2eefa), W(0x0006628d116b7975)},
+    {W(0x0000000000000001)},
+    {W(0x0003f0b078fc0a26), W(0x0003042e7e1aa93d), W(0x0006e7e56d0ffce7),
+     W(0x0001704eee838b66), W(0x000471fb40987791)}
+  },
+  {
+    {W(0x000798b2d2e14d95), W(0x0000bb36f985956a), W(0x0000a8e46f2be47c),
+     W(0x0005ab12c8af0291), W(0x0002188ac423c67d)},
+    {W(0x000579782b33c0ee), W(0x0003f4926d356cc7), W(0x00011b9414109dec),
+     W(0x0003cd26fb4d11fe), W(0x00023240c559c57b)},
+    {W(0x0000000000000001)},
+    {W(0x0000fdc89f9d12db), W(0x0007411c616236bc), W(0x0004160dd48c981a),
+     W(0x00053580a228db95), W(0x000494b54f636077)}
+  },
+  {
+    {W(0x0001362c36353455), W(0x0005d97045b80d63), W(0x0002e1e43f2a6154),
+     W(0x000758049c259b86), W(0x000794241471ed9c)},
+    {W(0x0002bc68d311dcd0), W(0x0001507e6f12246c), W(0x0003ba3e764b5e68),
+     W(0x00053903bb97468c), W(0x00071e918c03cdfc)},
+    {W(0x0000000000000001)},
+    {W(0x0000f270b57a6218), W(0x0004b17b69eb6bd2), W(0x0006d7b3298eb9db),
+     W(0x0004fc647ae378b3), W(0x000484e314e6003c)}
+  },
+  {
+    {W(0x00011d8f5a7f8079), W(0x0006c1543a9ce52c), W(0x00041eeea4ea22d0),
+     W(0x00062ed11e2e0290), W(0x000163bc180c22df)},
+    {W(0x0001498677501939), W(0x00035f000709b75c), W(0x00002953d8e32883),
+     W(0x0003a2c0ca5cbb35), W(0x000631107a6ba83f)},
+    {W(0x0000000000000001)},
+    {W(0x0002d774fa728050), W(0x000365b131cce157), W(0x00066ac51bb93766),
+     W(0x000230de42f41dde), W(0x000337ed9cc25bea)}
+  },
+  {
+    {W(0x000663b5db0f7a5d), W(0x00016c34753cf3b6), W(0x0002b38f68e242c9),
+     W(0x0006d075bf1c81dc), W(0x00039a32a30f3eb1)},
+    {W(0x000203715d67c491), W(0x0005e68b04626dba), W(0x000401177200f05a),
+     W(0x0000e4d0d7ce5000), W(0x0004d4c54675dc1f)},
+    {W(0x0000000000000001)},
+    {W(0x000558acfa92d128), W(0x000107215c854b23), W(0x0002f3639c43bf13),
+     W(0x0002d6c1130ed133), W(0x0001dc74666facd2)}
+  },
+  {
+    {W(0x0000e4658efac0e9), W(0x000324be23ff2b1c), W(0x0005645455e134d6),
+     W(0x00018face19fe673), W(0x00038085391a0e28)},
+    {W(0x000431944a19e62a), W(0x00040cd3db232ab9), W(0x0007eb086cc38919),
+     W(0x00024dab1a71a55b), W(0x00042918001a829f)},
+    {W(0x0000000000000001)},
+    {W(0x00052629d89d6076), W(0x00038360ad400d86), W(0x00024e085750534d),
+     W(0x00046109213da288), W(0x0001d832bc1670dd)}
+  },
+  {
+    {W(0x000153eeb75a32a1), W(0x000694b23ee33d22), W(0x0000185d0d3c9156),
+     W(0x0001affddddecd24), W(0x0005e3573b049d61)},
+    {W(0x0006e21a85892871), W(0x0005219b366facac), W(0x00070683f0cef309),
+     W(0x0004ed0882ea9cc1), W(0x00054bc665420c78)},
+    {W(0x0000000000000001)},
+    {W(0x00016889c88cea3b), W(0x00076fd9a9f0d136), W(0x0005e60338a701f1),
+     W(0x00023e55f21446d7), W(0x00064f20e09f4af1)}
+  },
+  {
+    {W(0x0004e5b28270f6eb), W(0x0000772661791a8e), W(0x00028d5fceb34bd7),
+     W(0x00002fee07235ec0), W(0x0007ed068b25b82c)},
+    {W(0x0007b1db6a21b7d3), W(0x0007f2874d038772), W(0x000691895475c37d),
+     W(0x00066653826a32ab), W(0x00001da83a187da8)},
+    {W(0x0000000000000001)},
+    {W(0x0004c643ad2709ba), W(0x00052a681266a47d), W(0x00015892f4b4159a),
+     W(0x0001b1af17c37f60), W(0x000001c84c65d03b)}
+  },
+  {
+    {W(0x000151c6a14a0aa3), W(0x0007e296a2b5bc07), W(0x00042aad31521101),
+     W(0x0007b343088db932), W(0x00005ca3370e7516)},
+    {W(0x00023611834c6903), W(0x0005dc1239dcc023), W(0x000192e1a412fdee),
+     W(0x00013bcb373f87af), W(0x0006f407fc537b95)},
+    {W(0x0000000000000001)},
+    {W(0x00018fcee019d84a), W(0x0005f0cb020d5cc3), W(0x000709772349ee3b),
+     W(0x000772c8defe9df4), W(0x00032a375ad5f1ae)}
+  },
+  {
+    {W(0x0000211f095ab9c3), W(0x0006783260dd0f83), W(0x0002d4f2d762ceac),
+     W(0x0005eb6de53cdc69), W(0x000624cb312b698b)},
+    {W(0x0005d0e5200bd8a3), W(0x0002177d4d6c3272), W(0x00068890ed88a7db),
+     W(0x0003e3c9b98d64dc), W(0x0005b3336b2751e9)},
+    {W(0x0000000000000001)},
+    {W(0x00055793aa0222e8), W(0x000358452f60ba2d), W(0x000149ee37906584),
+     W(0x0004b9700fda440e), W(0x0003e32cc8618b44)}
+  },
+  {
+    {W(0x00011a31a051b5f9), W(0x0005278e09b02436), W(0x0001f3f2dd7a51f8),
+     W(0x0001480d9a5bf27a), W(0x0001ddf6ece608fe)},
+    {W(0x00052b52112ea94e), W(0x0005048da5d3089a), W(0x00073ecd3e5a851e),
+     W(0x0003a4e7294b6914), W(0x0005e2dc58e9a48a)},
+    {W(0x0000000000000001)},
+    {W(0x00002594a910f33d), W(0x000038688f495c36), W(0x0003cd245933f80e),
+     W(0x000250b51cadb19f), W(0x0002cdadf05da1a6)}
+  },
+  {
+    {W(0x0005625f48c0e101), W(0x0003357b0262dc11), W(0x0002507af250638b),
+     W(0x0007e0301847dd8e), W(0x000396b384f3d61c)},
+    {W(0x000261107e7ad644), W(0x0001714c95106fc0), W(0x00069ea998633183),
+     W(0x00065124b15d6139), W(0x0007223e5f7b66d1)},
+    {W(0x0000000000000001)},
+    {W(0x0007f8a3afb74473), W(0x00056794f99d1b14), W(0x00033741f951d026),
+     W(0x0002680ac69cf0c9), W(0x0002e0677353c70d)}
+  },
+  {
+    {W(0x0004ffe7890fbd50), W(0x00002e2e1b792d2d), W(0x0000377a39dea672),
+     W(0x0003bfd9c6baf256), W(0x00053cc3dca34102)},
+    {W(0x00037d23ececbbe1), W(0x0001411ec941481c), W(0x0005756a866117d7),
+     W(0x0006be34fa6f2346), W(0x0002592a3aafce64)},
+    {W(0x0000000000000001)},
+    {W(0x0001523837c2d716), W(0x0003a69f1bcfc1c2), W(0x000706d09d269474),
+     W(0x00063c07f97014b5), W(0x00036517fc908a70)}
+  },
+  {
+    {W(0x00037fc889cc1368), W(0x00002ada87b8aa17), W(0x0007ff3517621a41),
+     W(0x00076bbd94e9f566), W(0x00034705fe600f5a)},
+    {W(0x0002e158dbe3b01e), W(0x0000ec401ba959e8), W(0x000264f990be8e69),
+     W(0x000287fde64749a9), W(0x000299153c141a89)},
+    {W(0x0000000000000001)},
+    {W(0x0002d276a889d46a), W(0x0005b508d4ffecbd), W(0x00039b22aeaeb968),
+     W(0x00068e6ce44ed65c), W(0x0001822eb03d3b54)}
+  },
+  {
+    {W(0x0001c336b8504618), W(0x00014160c3f02319), W(0x0005e4ae8cc2853e),
+     W(0x00040dcc8fe74b58), W(0x0005969255bd0891)},
+    {W(0x00021575bbb4d7a4), W(0x0007c9563153ad94), W(0x0007ec451f4d5551),
+     W(0x0001e150958c9a8b), W(0x000680a805fa0ae9)},
+    {W(0x0000000000000001)},
+    {W(0x0003aef5c8008dbd), W(0x00004346970d9be8), W(0x0000f56d107e42df),
+     W(0x00077aa71bd3f905), W(0x00050db591778c21)}
+  },
+  {
+    {W(0x0002456c59918ecb), W(0x00042c763fa93352), W(0x00010922cde409d4),
+     W(0x00069ea296f8a5ed), W(0x00027d1d57fa8808)},
+    {W(0x00009c7a1dff09c3), W(0x0005b7155b3b15c0), W(0x00053fd8e6234c7f),
+     W(0x0003ef4f41482785), W(0x0000a42f1c0f4c5d)},
+    {W(0x0000000000000001)},
+    {W(0x0003b0f9dc4062c9), W(0x0005bc7e7d9280da), W(0x0001bac024ab8c00),
+     W(0x00034d57d246a17c), W(0x000203614db4c547)}
+  },
+  {
+    {W(0x000187ad703d9b8a), W(0x0005d87d59155505), W(0x0006f39612a6e85e),
+     W(0x000790a276ece7aa), W(0x0000811d14bfdfdc)},
+    {W(0x000746b68306376e), W(0x0004082b2408e188), W(0x00015257a95ab68b),
+     W(0x000706f8763be926), W(0x00042bea70d46f3e)},
+    {W(0x0000000000000001)},
+    {W(0x0000758e51e81332), W(0x0002a2de1b93cb50), W(0x00000e509f7850eb),
+     W(0x000141231a0feca8), W(0x00006ed6a79fb4c3)}
+  },
+  {
+    {W(0x00003d905d527a4a), W(0x000233871cbba0a6), W(0x000552a399b40314),
+     W(0x0006587832814bf8), W(0x0004de090761b863)},
+    {W(0x0006057b9772baa8), W(0x0000313cc794d19e), W(0x0001f9fb7fef8f5c),
+     W(0x0000e70cc518704f), W(0x0005eef0efd10536)},
+    {W(0x0000000000000001)},
+    {W(0x000079019d237bcf), W(0x0000c9fe10ac5d91), W(0x0001bb5d3b5fcc86),
+     W(0x00005e69749deed8), W(0x0007b42c369ac06a)}
+  },
+  {
+    {W(0x000676bfb4fc4817), W(0x00046e815daae1e7), W(0x0006adf83bcf726b),
+     W(0x0002aab557702b75), W(0x0001d45517858ce4)},
+    {W(0x000044f0d4c5c699), W(0x000270c09d60bd07), W(0x0006628fb1b86f04),
+     W(0x00065826052f7bbb), W(0x0000b5a9d8fe8b7c)},
+    {W(0x0000000000000001)},
+    {W(0x00040bc9f10663af), W(0x0003b9e4ca0afd00), W(0x000055bf03462e7c),
+     W(0x00034e8283ff73e9), W(0x0007bbb9318495c3)}
+  },
+  {
+    {W(0x000639324b0eeafc), W(0x000567afe79c6e03), W(0x00067ac751c841b1),
+     W(0x000185570f7af720), W(0x0004285edbe9117f)},
+    {W(0x0007173eae04bdbd), W(0x0001fdb1b70fbdb8), W(0x0005308ad42c32a8),
+     W(0x0005e79605306427), W(0x000503aa6104a682)},
+    {W(0x0000000000000001)},
+    {W(0x0007b451d87b7b35), W(0x0006d4cc073d052f), W(0x0004809ba361df91),
+     W(0x0004587d21ffc4ba), W(0x0001f4082e0455a5)}
+  },
+  {
+    {W(0x000480351f8687d6), W(0x00011b2372e07d43), W(0x0006d4aef3e95b40),
+     W(0x0003c81cd8db5ecd), W(0x0003ef830cbeff9b)},
+    {W(0x00047553dc8ee4c8), W(0x0002481ddac47325), W(0x000054bbe5cd2faa),
+     W(0x00010b543a3b4f76), W(0x00062349ff5d8dbd)},
+    {W(0x0000000000000001)},
+    {W(0x0000ed129cf5e85d), W(0x00022f4ba4bb2215), W(0x00063c2ede271c07),
+     W(0x0004d0ed6e1db602), W(0x0007223d44476a62)}
+  },
+  {
+    {W(0x0002fa9830822c1a), W(0x00007c5fa8c91d54), W(0x0003624a44d041f8),
+     W(0x0005b0665a9349cf), W(0x000649a996e6d4d3)},
+    {W(0x00064cd1acedee9c), W(0x000206da48eb9912), W(0x000148d706baa183),
+     W(0x0004aea4950d672f), W(0x0001648311b942fe)},
+    {W(0x0000000000000001)},
+    {W(0x0005182f16609f9e), W(0x000529be8eb485b7), W(0x0007fc27e8cf7f8c),
+     W(0x0004cf43b0c22f92), W(0x0004b4959d9c3ac5)}
+  },
+  {
+    {W(0x00022c8be73f9d56), W(0x00070444e80a6974), W(0x0005629d3d7f9ad2),
+     W(0x000682868f6603ae), W(0x0003a95596d97770)},
+    {W(0x0004161a34c98fd7), W(0x000414f2ff07680b), W(0x000779aeb04da64f),
+     W(0x0003d4187d253a30), W(0x00015a80cdcc0331)},
+    {W(0x0000000000000001)},
+    {W(0x000747fa8c0f0d02), W(0x0000874f075f5e8c), W(0x0006680e59550d33),
+     W(0x0004f609255c08bb), W(0x000216a2e847090b)}
+  },
+  {
+    {W(0x0001d831cbb76ce1), W(0x00057e1b3fb67e93), W(0x00050637bb16be21),
+     W(0x000481e549b42904), W(0x0002d265d3fe1c88)},
+    {W(0x0002e60a84210b3c), W(0x0004c4562b460bf6), W(0x000466bd29a87e55),
+     W(0x000551104a43095a), W(0x00008376fb0663d3)},
+    {W(0x0000000000000001)},
+    {W(0x00067f96cc1061dd), W(0x000268e794db69ec), W(0x0006fbe6aba96768),
+     W(0x0007793adb64bf15), W(0x00048cfd55b628f4)}
+  },
+  {
+    {W(0x00010ed5babb9385), W(0x0001197d56bd614c), W(0x0006638ba8616b20),
+     W(0x0003592c01f9f2b5), W(0x000642cb15498d8c)},
+    {W(0x0004b239abeaeb3e), W(0x00047ff4dc3b27be), W(0x000464fa85b24265),
+     W(0x0002d119a605f70a), W(0x00021b5ca5020a9e)},
+    {W(0x0000000000000001)},
+    {W(0x00018ca77a2c3d14), W(0x00066cbc4247ba0a), W(0x0000222b83b5a36c),
+     W(0x0003a92995f59e54), W(0x0006231758c43d13)}
+  },
+  {
+    {W(0x00020f68c6e79bef), W(0x000575b5207576c4), W(0x00004351174e59f8),
+     W(0x0006e841150ce36b), W(0x00038e576301ff6c)},
+    {W(0x0000389eeb60eac0), W(0x000662d33f46d89f), W(0x0000d2442706c9bb),
+     W(0x00024a96940beed2), W(0x000458fe689e31a2)},
+    {W(0x0000000000000001)},
+    {W(0x0002b7b38a165294), W(0x0004f9e398b3110b), W(0x0005d3df9a647935),
+     W(0x0007ad3662317803), W(0x000250df0cb741d8)}
+  },
+  {
+    {W(0x00052678641780db), W(0x0003c74f19591acc), W(0x0001e429fc5707b0),
+     W(0x0000d0779119e684), W(0x000372bec78d7501)},
+    {W(0x0006c97abdb538e8), W(0x0002c555119df6cf), W(0x0003a8303211db4d),
+     W(0x000309769f161003), W(0x00032e9e47cf2f48)},
+    {W(0x0000000000000001)},
+    {W(0x000518030cb981d2), W(0x0000b2e6f28c6148), W(0x0002f9e999668e86),
+     W(0x000422ef1fc3dd62), W(0x0007fbe85454d956)}
+  },
+  {
+    {W(0x00023ca9ec4d1c77), W(0x000333d6263e998d), W(0x000057759efee7ec),
+     W(0x00075b2d7f71a705), W(0x0001aa3756aabcc3)},
+    {W(0x0005be03a49159ae), W(0x00008eb012ddc7b7), W(0x0004d1f18f09b75a),
+     W(0x0006b75a4d7c070b), W(0x00042333e27831ad)},
+    {W(0x0000000000000001)},
+    {W(0x0005248180ebc809), W(0x000650e99570621a), W(0x0000c9898e3227ce),
+     W(0x00066d29e5d2a65d), W(0x00004a62d3684e33)}
+  },
+  {
+    {W(0x0007975ac0537dc5), W(0x00049dda5cbcfba9), W(0x00021afab7eeba46),
+     W(0x0001ac86251b7101), W(0x00038db16447d79d)},
+    {W(0x0000a0f714f96daa), W(0x0000bbe550afe9de), W(0x00016ee9f7c5ce61),
+     W(0x000096743175388b), W(0x0001c48ccaed60ec)},
+    {W(0x0000000000000001)},
+    {W(0x000206b44d20fdde), W(0x00002950de17e9cc), W(0x00027b787e39f272),
+     W(0x00026480108da889), W(0x0007ade2d06a404d)}
+  },
+  {
+    {W(0x000676b273212fb7), W(0x00058fad5e4315cf), W(0x0001aa63a547669e),
+     W(0x0006ef7c85d730ce), W(0x000176b78984cddf)},
+    {W(0x00043f777db85852), W(0x0004ecfd838b0c22), W(0x000784884aab614d),
+     W(0x0001f9b3715093d5), W(0x0007b5b93eda7744)},
+    {W(0x0000000000000001)},
+    {W(0x00021742f577c701), W(0x00046477248bc3fc), W(0x00040a11d3490cb6),
+     W(0x000588027dd624ec), W(0x00057ea0e4a71ce9)}
+  },
+  {
+    {W(0x0002d3e9d38bb0f6), W(0x00069f0213d1c80a), W(0x00031af154ba9635),
+     W(0x0003deb9c4bd7294), W(0x000042d154bf7b4a)},
+    {W(0x0002de120a71fc90), W(0x0000bd94bb1ff430), W(0x0002e88329fb70c9),
+     W(0x0004fcfbf74f1a38), W(0x00042d1831323e27)},
+    {W(0x0000000000000001)},
+    {W(0x00015eb884d1bb80), W(0x00016ca7d667a6ed), W(0x0001f8188b26f96f),
+     W(0x0000ed0eda6573fc), W(0x00063a01f5ae7054)}
+  },
+  {
+    {W(0x00016490c154e108), W(0x000152aa1adc6ea2), W(0x000048110d2fd61d),
+     W(0x0005468343db1358), W(0x0001f8d28dd4f286)},
+    {W(0x0005a9c43da98bb8), W(0x0001227288d6136a), W(0x00048e7e6f0b1858),
+     W(0x0007037a0babfea2), W(0x0001ce82e2360367)},
+    {W(0x0000000000000001)},
+    {W(0x00005739dc41d103), W(0x00059e03f52c6b96), W(0x00010dc7202995fa),
+     W(0x000310b2129859d1), W(0x0007180d571f3d3d)}
+  },
+  {
+    {W(0x00006362e248e5e5), W(0x0000fb3c4a8dedc8), W(0x0004230a27942c72),
+     W(0x0003b74d741ab5fa), W(0x000613eb914c0150)},
+    {W(0x000149e920b97353), W(0x0001945100e2ad79), W(0x0005f48068bbc329),
+     W(0x00077a550c592a09), W(0x0003edbaafcd8c41)},
+    {W(0x0000000000000001)},
+    {W(0x000372de96e93ed8), W(0x000107e7efa316f8), W(0x00032706e3f36478),
+     W(0x00047d0fb2a87946), W(0x0006df1fdaf7b562)}
+  },
+  {
+    {W(0x0007f8e193cb03a9), W(0x00029160912248d9), W(0x0003fde42875dea3),
+     W(0x000085a59f1d202f), W(0x00027bf43826bf03)},
+    {W(0x000467037514f2ea), W(0x0002db615f4f69a9), W(0x0005e0b0eaa961a7),
+     W(0x00011a7df457ce7e), W(0x00016a24d749cc1d)},
+    {W(0x0000000000000001)},
+    {W(0x0000f4d5153e9a29), W(0x0006bacb1f20c130), W(0x00056230fb0c2b41),
+     W(0x000750aaafd58ac7), W(0x0000639572e01bdc)}
+  },
+  {
+    {W(0x0007714f57a675c2), W(0x0000107ffb3d11be), W(0x0006d7d6b876f649),
+     W(0x0005f56a0bdeece1), W(0x000769a6a59746d7)},
+    {W(0x000748335ec5da25), W(0x00020843e57bf6a0), W(0x00077d15866bda23),
+     W(0x00020e2c855dbee1), W(0x00022dc1267cfb2b)},
+    {W(0x0000000000000001)},
+    {W(0x0002fecae053b13b), W(0x0003b9579f9b29e8), W(0x000780157bea4c4d),
+     W(0x000097b35a90ac7c), W(0x0000077f066a9ea2)}
+  },
+  {
+    {W(0x0007f0b158c7224d), W(0x0006cb091d3bec77), W(0x00068a22736e50bd),
+     W(0x00020ca10ce92ea0), W(0x000795734ee4fcc2)},
+    {W(0x000376f7100669b5), W(0x00007c10909d49af), W(0x00058d285debc392),
+     W(0x00013e9ce973cc83), W(0x000756420ab5c711)},
+    {W(0x0000000000000001)},
+    {W(0x00027ee06554f6a3), W(0x00005ddb0818d746), W(0x000745cd0385ed48),
+     W(0x0000f27bedb99383), W(0x0003793198bc4c4c)}
+  },
+  {
+    {W(0x00066896aefbcf46), W(0x0007ba5207e8d2b1), W(0x0001025c6a67f167),
+     W(0x000562d75ac88ec1), W(0x000644d12fc5e7fc)},
+    {W(0x0004b572175216dc), W(0x0007f51f8a413991), W(0x0005bdebb6b4bb84),
+     W(0x00000b9740927f52), W(0x000173450789fcd4)},
+    {W(0x0000000000000001)},
+    {W(0x0006bfe5a984463d), W(0x00072f0e8c8db050), W(0x0001e97289d7289a),
+     W(0x00029042b8b396fd), W(0x0006f42d1c40d5e5)}
+  },
+  {
+    {W(0x00010679fd6c1110), W(0x0005dad0ea2d7ea4), W(0x0002b47f3143a5e8),
+     W(0x0004f46a79a8fae4), W(0x0005deca767ef17b)},
+    {W(0x00019d67898aa396), W(0x00064393c4f92a4b), W(0x0006805bccc1f395),
+     W(0x000380384044cc4e), W(0x0004ddf2207da12f)},
+    {W(0x0000000000000001)},
+    {W(0x0005ef380f6cd654), W(0x0002814739c8d92f), W(0x0006410307b13d12),
+     W(0x0007f6460c2c6905), W(0x0004e5f035a58983)}
+  },
+  {
+    {W(0x00054a689d9d2848), W(0x0000a17508e5b4b3), W(0x000725f2b3427f1c),
+     W(0x0002e81bd4a5f7c9), W(0x000296dcb24cb318)},
+    {W(0x0003e1dd8b060f7b), W(0x0003caf2eb7b32da), W(0x00056af32b25f342),
+     W(0x00039c19fd5b9478), W(0x0000b17dc85a4acf)},
+    {W(0x0000000000000001)},
+    {W(0x000529b40066f882), W(0x00027964d8393582), W(0x0001b3e5ffb9b495),
+     W(0x00062ac3f61cc4af), W(0x00030c5bad4740fd)}
+  },
+  {
+    {W(0x00061c1a6cf1b93f), W(0x00005b6f79e2bfbc), W(0x000037f051aaec40),
+     W(0x0006ff4a7c7112da), W(0x000408a3f1af2e77)},
+    {W(0x0000fbcc0954e1c8), W(0x0003e094c281116d), W(0x00041238bb254773),
+     W(0x0002d43cf3e3c927), W(0x0004f01ec38854c1)},
+    {W(0x0000000000000001)},
+    {W(0x0006a1fb1668d299), W(0x0002189188d6a438), W(0x00029f25cd28c862),
+     W(0x0006e9407a083377), W(0x0001f3721d5a7831)}
+  },
+  {
+    {W(0x000790b8fafbbf07), W(0x0001c1532743cc49), W(0x000314b1241df110),
+     W(0x0006e4a41f053e2f), W(0x00007d2d9234970c)},
+    {W(0x0004511f703f2295), W(0x0000cddcf0634ac9), W(0x0005bb9ebfee898e),
+     W(0x0000571f03dc91cf), W(0x0006ac2190030c21)},
+    {W(0x0000000000000001)},
+    {W(0x0003ff2b5daaa417), W(0x0000a453722962c9), W(0x000489a9a623ecb3),
+     W(0x0007a6a71f2a2a39), W(0x0006a8917ad98392)}
+  },
+  {
+    {W(0x0005d93d58452873), W(0x0000d1f5262d12f2), W(0x000221f9037b7c46),
+     W(0x00011905544cdcdb), W(0x0002982d55300208)},
+    {W(0x00026e980dc349b6), W(0x000084bdc4ebb654), W(0x000516ab693b2a45),
+     W(0x000431265687535f), W(0x000215e16ca44797)},
+    {W(0x0000000000000001)},
+    {W(0x0004de8802a6dec8), W(0x0004441cae1598e9), W(0x00064c0628064c4f),
+     W(0x0005642bf4c75b0f), W(0x000759ee3cd9be57)}
+  },
+  {
+    {W(0x0002a8d0e7b42d1a), W(0x00034687dd6b47b5), W(0x000595a7971c47f8),
+     W(0x000709b6944adb13), W(0x0001d8649515cb49)},
+    {W(0x0006c26c1bb7fb6c), W(0x000695f4bf87f97e), W(0x000370446bced57c),
+     W(0x00021d1f4f6198b6), W(0x0005b21e2f2978f3)},
+    {W(0x0000000000000001)},
+    {W(0x0004083c2e827437), W(0x0007ba30a9399cd3), W(0x0003c2473577ebc5),
+     W(0x0006c41cb943907f), W(0x000171d8d681ab45)}
+  },
+  {
+    {W(0x00013a23ee724a97), W(0x0007baa036a14ce4), W(0x00072f7ff4df17ab),
+     W(0x0003c9ce6de026de), W(0x0005460df4d60714)},
+    {W(0x000416d71b9abcd8), W(0x00067332e739739b), W(0x0004d2e02ecc0c09),
+     W(0x00065a9243e9a558), W(0x00069dfc7004263c)},
+    {W(0x0000000000000001)},
+    {W(0x00038bb4cf5474e5), W(0x0006a94853984d2f), W(0x0001e8ed2b668b61),
+     W(0x0001becd03d9d80b), W(0x000208b54aebd496)}
+  },
+  {
+    {W(0x00075486598125bb), W(0x000389a5689efd02), W(0x000348eafabd7b67),
+     W(0x0007a1650ad034bd), W(0x00024623476f0af9)},
+    {W(0x0001849b8c042687), W(0x000384565d975265), W(0x0004ffcebddf7685),
+     W(0x0007188ca6e6f369), W(0x0006aebe4a1a22d9)},
+    {W(0x0000000000000001)},
+    {W(0x000705c8ae4f1e03), W(0x0007bcfe8bb6a6b2), W(0x0003e37fc5e076e8),
+     W(0x0001166546ace9a3), W(0x00028bdae94f16c1)}
+  },
+  {
+    {W(0x0000de6a651dd538), W(0x000503d780f925b4), W(0x0004ec5fe52ca445),
+     W(0x0005420988bdd612), W(0x00064e507a02bfd8)},
+    {W(0x0007ab2d1caa03a4), W(0x00040a0fb08bdd2b), W(0x0003eeb8d9640922),
+     W(0x00031ed08857db09), W(0x000513ac992d72b4)},
+    {W(0x0000000000000001)},
+    {W(0x0007493a9c6166ad), W(0x0007bc2becea4534), W(0x0002899011e485fd),
+     W(0x0007ca0e25981190), W(0x0000aaec80320e9f)}
+  },
+  {
+    {W(0x0006f894a654bf0e), W(0x000677020d13df5d), W(0x00041a8f3376f011),
+     W(0x0005f711851152dd), W(0x00047f3bd11324f6)},
+    {W(0x00060e4285c492be), W(0x0006461cf8eac300), W(0x000453aaa478b8bb),
+     W(0x00035f993046fe46), W(0x0007e05db9b3ff88)},
+    {W(0x0000000000000001)},
+    {W(0x0001d712f0d1de7e), W(0x00025cab1d3f605d), W(0x0006b3fb9542da6e),
+     W(0x00061f2990200cd2), W(0x0004e1825367e1f1)}
+  },
+  {
+    {W(0x000587b3e55c5e0f), W(0x000474e73512bc9f), W(0x0000b45a0e1750a5),
+     W(0x0002e816b2b00af5), W(0x0004a6d22703a704)},
+    {W(0x0000d8cccf61776d), W(0x0004bbdf6233750d), W(0x0003fe96d8dea1ea),
+     W(0x0000228bcc728f8b), W(0x0004c58d7a8c6ded)},
+    {W(0x0000000000000001)},
+    {W(0x000795e9f69bf873), W(0x00064f72584d5d19), W(0x00005cf1e45220d8),
+     W(0x000423a7ac23c2c2), W(0x00026e271016b418)}
+  },
+  {
+    {W(0x0002f283ba368eb5), W(0x0007098b36099d4f), W(0x00016605caa40e47),
+     W(0x0004b9226bbcc4b2), W(0x0003e22af70a5480)},
+    {W(0x0002b5b6519a2968), W(0x00046d98507b7c52), W(0x0006eef607752d66),
+     W(0x00046f50cbe288cf), W(0x000689d8b7cda23b)},
+    {W(0x0000000000000001)},
+    {W(0x00045806fe512f61), W(0x0007971267618ca9), W(0x0000f31d8d5e9837),
+     W(0x0004ac5283ff8ec7), W(0x00017b031d3e5587)}
+  },
+  {
+    {W(0x0001a302bc065a10), W(0x000325a63fec6e86), W(0x0001f06e2ee3f100),
+     W(0x0006aabd9d17f843), W(0x00061a6ba2ca42d9)},
+    {W(0x000325579b63721d), W(0x000425437a7910a5), W(0x00042a32acb80954),
+     W(0x00022f5148ad12e7), W(0x00063d805f5a79f8)},
+    {W(0x0000000000000001)},
+    {W(0x000199507e152816), W(0x00066b7b32817519), W(0x00027b81ee55c900),
+     W(0x000590e934f3ebce), W(0x0006f20c04f509db)}
+  },
+  {
+    {W(0x0006c8621e8cb414), W(0x00068d737430b109), W(0x0001e3bf3f485a30),
+     W(0x0002b744182fc8e2), W(0x00003d963eeae485)},
+    {W(0x00047a9ec1e7e183), W(0x0005e4990c67d57d), W(0x00003f6752348267),
+     W(0x000256c631cb8ce9), W(0x00074b75cc839a94)},
+    {W(0x0000000000000001)},
+    {W(0x000602ce8d1e424d), W(0x000647b1aee599e0), W(0x00065c18a8f2e9b0),
+     W(0x00057667ac242f32), W(0x00008596a58821d7)}
+  },
+  {
+    {W(0x00052d6b93a58ae9), W(0x00023fdb62fcfe42), W(0x0002237826816665),
+     W(0x0007bda262c5881e), W(0x0000f04da69e0202)},
+    {W(0x00011070c800b8c4), W(0x0000fd5bc07068df), W(0x00077afe1ba00d96),
+     W(0x00067ea37474800c), W(0x0001fbc1c9cd03c4)},
+    {W(0x0000000000000001)},
+    {W(0x000557e493cef8fe), W(0x0001982593dac0a4), W(0x00055cce97a79475),
+     W(0x0000c9ba5c65b4fc), W(0x00041d7a80b34727)}
+  },
+  {
+    {W(0x00068cbc671a9cfe), W(0x000066ecdd013654), W(0x000644eccef80642),
+     W(0x0007686333357f88), W(0x000797899e488353)},
+    {W(0x0005ce424b8909cc), W(0x00008cd124cb7f30), W(0x00043985e7a1ad72),
+     W(0x0004259ff3307b83), W(0x0005dd70a33ff94a)},
+    {W(0x0000000000000001)},
+    {W(0x0007e6e320b1beb0), W(0x0002700aae7eca6e), W(0x0001199f051877a8),
+     W(0x0005d0d59b2a8504), W(0x00048ea70d558697)}
+  },
+  {
+    {W(0x0003e68379f77cdd), W(0x000375448487300d), W(0x0004fadfff712a83),
+     W(0x00032887273eabc1), W(0x000735b64bb87260)},
+    {W(0x000287bc1a2bce2c), W(0x00015e23befaeefa), W(0x0002167297b0c304),
+     W(0x0005121b7e5b2c88), W(0x000384aaaee3ca7b)},
+    {W(0x0000000000000001)},
+    {W(0x000325052953d265), W(0x0004b171655a5142), W(0x00017e6e8e2fcb2e),
+     W(0x000585732799aa14), W(0x000169ea362ca1eb)}
+  },
+  {
+    {W(0x0001e122f99dc1ac), W(0x0006651dd297f84e), W(0x00021ad579cffa74),
+     W(0x00023b37aad05395), W(0x0006f6ea532a62cf)},
+    {W(0x00036ce8b113ac10), W(0x0001a9e4da22eec4), W(0x0004c71fd6185f3e),
+     W(0x000685ac22a0e011), W(0x00061d8203ef6da5)},
+    {W(0x0000000000000001)},
+    {W(0x000619125ecd9b1c), W(0x0004be7ea321a410), W(0x0003a35597377efb),
+     W(0x0006f8702ea670eb), W(0x000048f23c82c60a)}
+  },
+  {
+    {W(0x0002d6cd85748773), W(0x0007727f5e8ad303), W(0x0000daa644373939),
+     W(0x0003985c13db476c), W(0x0005d99a2a3d4aed)},
+    {W(0x0005af5a79474b9e), W(0x0001c2f846c8d2d0), W(0x0005c4d1910446c2),
+     W(0x000084545bf6da2f), W(0x0007eeacf5680fb6)},
+    {W(0x0000000000000001)},
+    {W(0x0000dd36242f5125), W(0x00028de8df3800b8), W(0x000127f5ff5b6e9a),
+     W(0x0004df2e48000a2c), W(0x00049465b61678c8)}
+  },
+  {
+    {W(0x00053d99fd8382e8), W(0x00079850fcf660b3), W(0x0006fcf0ee75d8d6),
+     W(0x0005b49b1e032524), W(0x00031d0b4bb57bd7)},
+    {W(0x0004219a22aba2c0), W(0x000237d1f63d007e), W(0x00054d6425f9948e),
+     W(0x0001ea3e815c4b37), W(0x0001592e581034e1)},
+    {W(0x0000000000000001)},
+    {W(0x00062d36a6d33967), W(0x000222ba118de2a4), W(0x00064f2355cb2420),
+     W(0x00071cfd9fe50a9c), W(0x0004ea01e22ff4de)}
+  },
+  {
+    {W(0x0006c84b60a84aa0), W(0x0001cbe7188946d4), W(0x00012730fd1651b4),
+     W(0x000747d3f2e19238), W(0x000424cf5c498bbb)},
+    {W(0x0002a5ab4a0fcb43), W(0x000144e701403110), W(0x000726df1727ca6f),
+     W(0x000118aee47e8062), W(0x00034acd712d334a)},
+    {W(0x0000000000000001)},
+    {W(0x0006a294f9c5858d), W(0x0001b5a20b4c1c7e), W(0x00029a451be259d4),
+     W(0x0003e2cca0a4f2dd), W(0x0007da0badb70f27)}
+  },
+  {
+    {W(0x00066595598be247), W(0x0006055d09900737), W(0x000665cbe60138fb),
+     W(0x0005d3ba41bd53ca), W(0x00033a6ae0522936)},
+    {W(0x0002fb48135a6602), W(0x00026eb95bea2f2e), W(0x000418aace898207),
+     W(0x00074da6f69a60e2), W(0x00037022798cc08b)},
+    {W(0x0000000000000001)},
+    {W(0x0003e8650a87e4a3), W(0x0001171931fa618d), W(0x0006de44d555ea07),
+     W(0x0007be7f7df5582e), W(0x00000d7caf0bead1)}
+  },
+  {
+    {W(0x0007b8bcc47cc3cb), W(0x00027569a14f564c), W(0x0004468f81f52c45),
+     W(0x00052cadafb71bb6), W(0x0005939635b72aeb)},
+    {W(0x00025ef4293a6c27), W(0x0003f5f022d4c50e), W(0x0001344dc82db63b),
+     W(0x00019165f00d1c7d), W(0x000382162eb33db2)},
+    {W(0x0000000000000001)},
+    {W(0x000372b90dfa716c), W(0x00007db57b13f3e3), W(0x00034a25bbc43f4c),
+     W(0x000024651a2963d6), W(0x000357a8ae4526d9)}
+  },
+  {
+    {W(0x000559c2e85c4036), W(0x00006f21c79fdc57), W(0x0004e1bbf393cf8e),
+     W(0x0005877435b48e13), W(0x0003649e78d2ae9f)},
+    {W(0x000142b22f5d5be4), W(0x0005690624b891ef), W(0x00003450438a0448),
+     W(0x00034bdcdf4eb0e7), W(0x00009b0d9e0dd82e)},
+    {W(0x0000000000000001)},
+    {W(0x00039f79a404c5a0), W(0x000799cdf572af01), W(0x000577c42d252992),
+     W(0x0006dd2a8fc4eadf), W(0x00066796a09effc4)}
+  },
+  {
+    {W(0x000165934e96a973), W(0x00031fbe0206e61a), W(0x00051bb26446105b),
+     W(0x0003b0cec1000ba9), W(0x00062c7585d1677b)},
+    {W(0x00069080094044de), W(0x000561177d19a0d0), W(0x0001a35a37b13b3d),
+     W(0x00002214ccaa19d2), W(0x0005fef7955ee073)},
+    {W(0x0000000000000001)},
+    {W(0x0000c63107c1b43b), W(0x00012994bdf74f33), W(0x0002ef8d3e07dee4),
+     W(0x0002eada866bee62), W(0x0004b49126283d66)}
+  },
+  {
+    {W(0x00007a713f77f6d3), W(0x00015180e943d376), W(0x0006f9f903222e5e),
+     W(0x0003fad862c4c4da), W(0x0000c94537d311e1)},
+    {W(0x00054587ed33c4e2), W(0x000078280b084ff5), W(0x0003dc10b39d3efe),
+     W(0x0005df4d721b7f21), W(0x0006deaaa5001bcb)},
+    {W(0x0000000000000001)},
+    {W(0x0004acf23d60e74d), W(0x000441f76c645656), W(0x00010c39624a8cd3),
+     W(0x00014ffd1181b36f), W(0x00012e02412bf648)}
+  },
+  {
+    {W(0x0007c810533e1b3e), W(0x0006aa2e2212b919), W(0x0000270577ffb0f7),
+     W(0x0003b9897304608c), W(0x0006f5c6894a8d38)},
+    {W(0x000630d23477af7b), W(0x0003deec2eea3840), W(0x0004cf58a33b582a),
+     W(0x00006b5636606b71), W(0x00074eadab9389b4)},
+    {W(0x0000000000000001)},
+    {W(0x00062e6fc73430b4), W(0x000719990fabf690), W(0x000057510f2f88ca),
+     W(0x0006e528a06a693a), W(0x0000198c0ec98512)}
+  },
+  {
+    {W(0x0005ed47fbcee08f), W(0x00064aa6875f6666), W(0x0001703f9520d407),
+     W(0x000503f08fcbddd3), W(0x0004e16e88e171f9)},
+    {W(0x0004f9ad2cf47d4c), W(0x0001f625cbf65e4c), W(0x0002f4b86587a52c),
+     W(0x0000923e5bccade3), W(0x00041bcd7dd32887)},
+    {W(0x0000000000000001)},
+    {W(0x0004b55b5e3585d5), W(0x0005a4ccaa63ab0a), W(0x00057f516777b69c),
+     W(0x0002a4be70840847), W(0x00079652ab8be8ae)}
+  },
+  {
+    {W(0x0002a5c74982c741), W(0x00019d84dfede071), W(0x0002b2080294b18f),
+     W(0x0007361197d93161), W(0x00065d8484cef146)},
+    {W(0x0003c30a92c74235), W(0x0007a77036381e56), W(0x00072a38e8dbc0d8),
+     W(0x0001c8ca958a0f2b), W(0x00067283346bbae9)},
+    {W(0x0000000000000001)},
+    {W(0x0007e22dc50c5879), W(0x00005dae5b95624c), W(0x00046485aa5e0b6a),
+     W(0x00004ceef0b5f4ac), W(0x00024a472c4d45d0)}
+  },
+  {
+    {W(0x0005354e9cf729f8), W(0x000406b75216c6e8), W(0x00079d6a084e3a8b),
+     W(0x000465ccdfcbf832), W(0x0001c588485b64be)},
+    {W(0x00007c6b157a0d77), W(0x00068d88e1158083), W(0x0006d6ca99a9500b),
+     W(0x00032d0cbcc4e7dc), W(0x0007c9a18d6ebf54)},
+    {W(0x0000000000000001)},
+    {W(0x0000748207230731), W(0x0000002a0f2e8b7e), W(0x000407b77a1d5ea9),
+     W(0x0004a980ecb8e610), W(0x00076d11b3aeaf4d)}
+  },
+  {
+    {W(0x0003c0204d6dce71), W(0x000396d6359d8e80), W(0x0000ca7e2871f7c8),
+     W(0x00057d5bf4e928cd), W(0x0002c80c4ad0aebc)},
+    {W(0x0001fb760b4db36f), W(0x000686e532f94e95), W(0x00051119f98871c9),
+     W(0x0002b71a9ab6fcae), W(0x0007f8e629831607)},
+    {W(0x0000000000000001)},
+    {W(0x0003bb156934b860), W(0x00065b6dae2b2ef7), W(0x0007c3b4267f59cc),
+     W(0x0005ac580317c870), W(0x00035a83e8d790d4)}
+  },
+  {
+    {W(0x0003d9004291b9c6), W(0x00015826e8ca4101), W(0x0000f5cf1cea4699),
+     W(0x00024f16226ab8c7), W(0x0001e1e5fc87fa2c)},
+    {W(0x0003c5d98872e597), W(0x0005ac58699b3e5b), W(0x000332cc41cf34a7),
+     W(0x0004a607c37075aa), W(0x000153828e90ed8d)},
+    {W(0x0000000000000001)},
+    {W(0x00046e98cc88d896), W(0x00025a0c8fd65e2b), W(0x0005e7aef5608c2b),
+     W(0x000479043242cbcc), W(0x0001040f9e2d826f)}
+  },
+  {
+    {W(0x0000e0849ad57129), W(0x000271cc727781cb), W(0x00006e8cbb0f4175),
+     W(0x000236a22f7d8de9), W(0x0000ce0488a30ed4)},
+    {W(0x0003d4015d12b5a1), W(0x00041f931a26fc7b), W(0x00052c9d8cd9177a),
+     W(0x0003bc89b7a6b519), W(0x0007278074ac66ac)},
+    {W(0x0000000000000001)},
+    {W(0x0005f14dfc6188ab), W(0x00031ac40b2040a7), W(0x0003e90b2c80795a),
+     W(0x0004a627f35f4650), W(0x00072e12cb6f6bd5)}
+  },
+  {
+    {W(0x0007fb0bbfa6dea4), W(0x0000b5e85f5723d0), W(0x000026bb60a0338a),
+     W(0x000149f8cdd00cd8), W(0x00001a6b81f7285f)},
+    {W(0x0001a43b0c19b4dc), W(0x00017e4d6528b678), W(0x0001fb09ae6eafea),
+     W(0x000173c1b79b567f), W(0x00060f910dc7c9a8)},
+    {W(0x0000000000000001)},
+    {W(0x00064038ca2da5ea), W(0x00022636b5ca24a4), W(0x0001568a1cf437ee),
+     W(0x000421f51b3651ee), W(0x000207f0d90ee7c8)}
+  },
+  {
+    {W(0x0004a032dbde7150), W(0x0001f4355affe69d), W(0x0007aa0005d240ab),
+     W(0x00011c2cb2334864), W(0x00079b4ce3c69900)},
+    {W(0x0003e74f012ba45b), W(0x000752c794cc37ff), W(0x0003ce4b427ea146),
+     W(0x0003a4dfc549442a), W(0x00053a1053d3fc6c)},
+    {W(0x0000000000000001)},
+    {W(0x0007c24581b713ad), W(0x0007c6f3c52dde3e), W(0x0006d921a3cf2ca2),
+     W(0x0000e0949bf6ffd0), W(0x00003db91ea8240f)}
+  },
+  {
+    {W(0x0006514ffe333498), W(0x0001ae4b35c2cf82), W(0x00043ddde2b46fb7),
+     W(0x00060c80f69a607a), W(0x000220ee355b5c39)},
+    {W(0x0005af1256d6aa2a), W(0x00026a84c5e564d2), W(0x000045c0d6e5ac56),
+     W(0x00070301aedfd6d0), W(0x00005fd9374986e1)},
+    {W(0x0000000000000001)},
+    {W(0x00027b00b4221fec), W(0x0003eeb47b4b08a7), W(0x00014c0a55316173),
+     W(0x0005ea77f60a920a), W(0x000128698d5da765)}
+  },
+  {
+    {W(0x0006a9db8b4a3a18), W(0x0000ccb1284cfc78), W(0x00014f69c7d974b5),
+     W(0x0004e520201d9b21), W(0x0001e2f97d2cb4a1)},
+    {W(0x00045a37dea3466d), W(0x0004ef266f1369ba), W(0x0006a5d29c97625a),
+     W(0x00028c9087fccf6b), W(0x00022804fb035acb)},
+    {W(0x0000000000000001)},
+    {W(0x00056aa35760b7ec), W(0x00035e94008f80fb), W(0x0005c7d11a990e1a),
+     W(0x00011add0d4bd947), W(0x0001389dc15b8335)}
+  },
+  {
+    {W(0x00068ac96e24ed5b), W(0x0002e39568bc02f8), W(0x000596c17e332027),
+     W(0x0003c3b561d98434), W(0x00035b8699fa2098)},
+    {W(0x00042f4e3cce3e39), W(0x00067d76e990cdf6), W(0x0004b1a99659e868),
+     W(0x0003bc6e21c1a9df), W(0x000155079de21981)},
+    {W(0x0000000000000001)},
+    {W(0x0003383f6eb5ca81), W(0x000623c8a3794ea9), W(0x0003c1804efde751),
+     W(0x0003929078cd9e74), W(0x00032957d1499384)}
+  },
+  {
+    {W(0x00058d1fc6b6a6bd), W(0x000672e36450da7c), W(0x000671166c74c9a2),
+     W(0x0006294ac7462766), W(0x0003cb40c55f5f19)},
+    {W(0x0004cc6dd1b75921), W(0x0003bb8d0e75107a), W(0x0005106e9880fc33),
+     W(0x0002e3a242b0adc3), W(0x000379e1f1f59df0)},
+    {W(0x0000000000000001)},
+    {W(0x0000985c1211220e), W(0x0001e9bbbe45e0bf), W(0x0006e212111fba41),
+     W(0x0005e6781ca35838), W(0x00079a041676a153)}
+  },
+  {
+    {W(0x00056852031803bf), W(0x00013af96e518c1e), W(0x0005ddc13735da16),
+     W(0x00001e72e4b0b3cf), W(0x0006ad916290e0d0)},
+    {W(0x000089925f2ccbea), W(0x0006ab7ddf206a92), W(0x0001313e17de6446),
+     W(0x0001952b4a211a7c), W(0x0001e602b4a67258)},
+    {W(0x0000000000000001)},
+    {W(0x0007fe367411ce96), W(0x00025986f296e61d), W(0x00031005156cee28),
+     W(0x0003400b9a0300b1), W(0x0001648d48ba3811)}
+  },
+  {
+    {W(0x000362dead5de123), W(0x0006ea1a4447986e), W(0x0002f50fb0221557),
+     W(0x00040b0552b53074), W(0x0007c0162492ae66)},
+    {W(0x000568fa4cbf118f), W(0x0006b52061452144), W(0x0000b932956515fe),
+     W(0x000006a61d5e3658), W(0x00034e60b446eae1)},
+    {W(0x0000000000000001)},
+    {W(0x0003e0d145a57a7f), W(0x0005f824d7907c5b), W(0x00054b0944cc349d),
+     W(0x0006b9d399821657), W(0x00010bbfdacdcb23)}
+  },
+  {
+    {W(0x0004d6a016caacdf), W(0x0006ec680ad82123), W(0x0000b8d59fb7ad4c),
+     W(0x0001ee862f0f9cdc), W(0x000354c25bf7b3e8)},
+    {W(0x00001de46770fc3a), W(0x00026766f4e27710), W(0x0004eb5e356e227d),
+     W(0x000187c2d4d0824d), W(0x0007abb271ef1216)},
+    {W(0x0000000000000001)},
+    {W(0x000404d5434fae85), W(0x00024e644601465d), W(0x00001834fafb1036),
+     W(0x00063e788544a0d6), W(0x000658c24d79f9d8)}
+  },
+  {
+    {W(0x0001242209862850), W(0x0004fe8f214d9bbc), W(0x0005d41344fe6d68),
+     W(0x0002799fa1a15904), W(0x0001e581a4bcf750)},
+    {W(0x000774625fc39e07), W(0x00076c165e432d85), W(0x0003bc4116ad1230),
+     W(0x0007e95aedd17963), W(0x0002164d56564360)},
+    {W(0x0000000000000001)},
+    {W(0x000637630650b4d0), W(0x000519a4ec010936), W(0x000068d448f3af20),
+     W(0x0001a8fcaffc3e85), W(0x000202431c98b875)}
+  },
+  {
+    {W(0x00055688e694bc3d), W(0x0004df47df2ff961), W(0x00070a62586f66aa),
+     W(0x00073cdcd0c05c43), W(0x000533b56f18283e)},
+    {W(0x00055b49e0026764), W(0x0007b7f352ff4363), W(0x0004b6eb0637473f),
+     W(0x0006f95e741b1a54), W(0x0006011366753812)},
+    {W(0x0000000000000001)},
+    {W(0x00044ca60a1609ef), W(0x0006ff16ed45d28c), W(0x00047f8894c0c0e5),
+     W(0x00048483c3c22ad1), W(0x00029923e124f6dc)}
+  },
+  {
+    {W(0x00060d20cdc6627b), W(0x00076c7d7d04c065), W(0x00029f5c9eb48161),
+     W(0x0003669305103327), W(0x0004b508b94e6e2e)},
+    {W(0x0001de726df2a6c4), W(0x000675eb15f4e809), W(0x00041e9404e64b44),
+     W(0x000573c0b95010a6), W(0x0001e8ecd6ff5aab)},
+    {W(0x0000000000000001)},
+    {W(0x0006c5b1db60d0b5), W(0x0001cf1aa06a60bc), W(0x00009fa7632b87b3),
+     W(0x0002e3d54f89a9ac), W(0x000488dc81877beb)}
+  },
+  {
+    {W(0x00030c194fed4265), W(0x00027ea46396ec20), W(0x0005ee24c4744829),
+     W(0x0005643d4639fe68), W(0x0003398c0c0219f5)},
+    {W(0x00067b13599142d9), W(0x000475cc9cbdb7ec), W(0x00064e70bde7cfde),
+     W(0x000316034625d481), W(0x000025b234a1dc86)},
+    {W(0x0000000000000001)},
+    {W(0x00032babccfee824), W(0x0003a7d83bc20289), W(0x0003761c272fde4a),
+     W(0x0003000f550a2641), W(0x00038601ebca14f6)}
+  },
+  {
+    {W(0x00037ae8e89c78e6), W(0x0001a714dd065e2c), W(0x0002e53bb49387fe),
+     W(0x000232818e5b3a2e), W(0x0005941a17b04cd3)},
+    {W(0x000678faa2ee02ee), W(0x0006baa9494c2046), W(0x0005dd8ed6b6d754),
+     W(0x00066d22c5f198ca), W(0x0005309792c546b6)},
+    {W(0x0000000000000001)},
+    {W(0x000333e21f099b66), W(0x0006ad056e17e93f), W(0x000195475543e205),
+     W(0x00053c0e36db7154), W(0x00027525e68e43b9)}
+  },
+  {
+    {W(0x0006ce9d124a20c9), W(0x0006dfd922687ac0), W(0x000102fb9cf0562b),
+     W(0x0007e5d7ff0ef933), W(0x0002cb490d2c0047)},
+    {W(0x00026de1b446a964), W(0x0007d7b83d40db3a), W(0x0001078bfa15e5eb),
+     W(0x00000575fd1ca3f9), W(0x0002e2952ebf0892)},
+    {W(0x0000000000000001)},
+    {W(0x00035f9d4fedac34), W(0x000566c22a56478d), W(0x0000adeda68f58c6),
+     W(0x0006bcbb2dc83a1a), W(0x0004a7691bc329b5)}
+  },
+  {
+    {W(0x0001ae398212bde1), W(0x000623c9ada4af87), W(0x00028dd42f9fb885),
+     W(0x00019548e31e3ece), W(0x00079305236b5832)},
+    {W(0x00068dba7d01053b), W(0x0000559a2bd2726d), W(0x000101792f83520c),
+     W(0x000016100a7ec289), W(0x0006f9ecdfa953e3)},
+    {W(0x0000000000000001)},
+    {W(0x00056c5a339367fc), W(0x0005ece8180836d2), W(0x00048aa0d15e6b50),
+     W(0x0007cca979f8215a), W(0x0003268e10c7e94d)}
+  },
+  {
+    {W(0x000299c3c653ee63), W(0x00021b009aee82dd), W(0x000197366f204dbe),
+     W(0x00033279a9c3fd33), W(0x00057d9fcb884b94)},
+    {W(0x0007b9bac88d0fbc), W(0x00048af6b3f6e19c), W(0x00057eee4d60346c),
+     W(0x0004ce05cfe77bad), W(0x00014197e65f0a35)},
+    {W(0x0000000000000001)},
+    {W(0x00046259067c2a4c), W(0x000191dddbfb0f6f), W(0x00050eea7af8f768),
+     W(0x00052805393cf916), W(0x0000f7032e62e866)}
+  },
+  {
+    {W(0x000126bdacdd6523), W(0x0000e7e66606ef53), W(0x0007824c442450f6),
+     W(0x00050f1c566ef7e9), W(0x0006d99df2c28c9f)},
+    {W(0x0007b2e68d07c150), W(0x00008c22c4fc4a02), W(0x00034c06879abe8f),
+     W(0x0003f8497e2b62e6), W(0x0002f21987905f39)},
+    {W(0x0000000000000001)},
+    {W(0x0001a5f2c7aa2323), W(0x0006316f13da6220), W(0x000055adb26ea2ae),
+     W(0x00010ac5ea88a919), W(0x0001e41f69e86b44)}
+  },
+  {
+    {W(0x000265116269ceb9), W(0x0004a9918aa272b6), W(0x0002059aab10a445),
+     W(0x0002dea40fd09514), W(0x000749d19591f175)},
+    {W(0x00030c274213688d), W(0x00064f50d43983e5), W(0x00024cf2dbcdc5f9),
+     W(0x00001a166c3d8ba8), W(0x0007ec145aa7558d)},
+    {W(0x0000000000000001)},
+    {W(0x00060998d337354e), W(0x0003bb48d9a8b1cf), W(0x0006ad646e6340d3),
+     W(0x000558bf07a063b6), W(0x000153131178d47b)}
+  },
+  {
+    {W(0x0001e32b8c4073f1), W(0x00066495ceb3b4a0), W(0x00061b453e8e00da),
+     W(0x00014abc8131ad2b), W(0x000340f7f5ae1929)},
+    {W(0x000071964b40a0ea), W(0x000292ae3a78d851), W(0x0007e47f8b336195),
+     W(0x0003cd137a74111f), W(0x00064e231a413f13)},
+    {W(0x0000000000000001)},
+    {W(0x00077288112c36d9), W(0x0002bbcc228c2590), W(0x0001c17289a9b9f9),
+     W(0x0005303ac5192019), W(0x00058e7041ac0245)}
+  },
+  {
+    {W(0x0000afeb94b08109), W(0x00075faba49a6af5), W(0x00077781c9ce508c),
+     W(0x000165627421c272), W(0x0004aa33e00bf6e9)},
+    {W(0x00010c6c56ec7e21), W(0x000038a659ea442e), W(0x00041889e9953f5b),
+     W(0x00049bf700db38ea), W(0x0003385bb4fbc441)},
+    {W(0x0000000000000001)},
+    {W(0x00021ad8ed73e605), W(0x00014bbbfefa774b), W(0x000324826ae80cab),
+     W(0x00012c886393ddff), W(0x0000a1e73e614097)}
+  },
+  {
+    {W(0x00058565afc0e4eb), W(0x0001d562d252ee9c), W(0x000730489987a4c2),
+     W(0x0000446f13318362), W(0x00034b2ffca05f01)},
+    {W(0x0002982cf62fa605), W(0x0001700c23ff4dde), W(0x0001b68cd4f4f2c8),
+     W(0x00016031615c1afe), W(0x0007662faf0f70e8)},
+    {W(0x0000000000000001)},
+    {W(0x000684bb60a210d7), W(0x00010be90463f1eb), W(0x000697939ed4f10e),
+     W(0x00028a15ddf7a001), W(0x00067198d2103499)}
+  },
+  {
+    {W(0x000515f8f9d3715e), W(0x000491e5903cecc9), W(0x00014aa866101b1f),
+     W(0x00078a9b6edc6e08), W(0x00000820fcb51326)},
+    {W(0x00041bcec8c262d9), W(0x00054b9aa7e68281), W(0x0000ea3fcbd6e5fa),
+     W(0x0000b85cbecfd0b3), W(0x000756574c23bb01)},
+    {W(0x0000000000000001)},
+    {W(0x0002c17bd49eecb3), W(0x0004a39a5b0bbc72), W(0x000063e7e7f582f6),
+     W(0x000220c39fb953bd), W(0x00007408e9a7901f)}
+  },
+  {
+    {W(0x000002499caf05d3), W(0x00072f013bb84327), W(0x0001480bf03a4581),
+     W(0x0006b719b20ffb64), W(0x0000861d7e84cec6)},
+    {W(0x00048abdd399c59f), W(0x0002cb211409fab2), W(0x0006307181fee2cd),
+     W(0x00015310bea3afdd), W(0x00034936e0a5dc7e)},
+    {W(0x0000000000000001)},
+    {W(0x0004eea5e249c048), W(0x00078d1c56ab688b), W(0x0000cee4b9721fbe),
+     W(0x0003f13b3ff7b781), W(0x0004c31024d49ad7)}
+  },
+  {
+    {W(0x0004a097e33b8f2b), W(0x00020b26b5e2bd96), W(0x0002b2dc210a8be8),
+     W(0x000426bda58b2db8), W(0x0005b4a1dc887ef6)},
+    {W(0x0002620b68aa652c), W(0x0003916b86d177fb), W(0x00060a27a756711b),
+     W(0x0002f294c5391b95), W(0x00054d21511c0580)},
+    {W(0x0000000000000001)},
+    {W(0x0003efd131b70eca), W(0x00059b1c83f7023a), W(0x00045aee8d60b501),
+     W(0x0000f296406967d8), W(0x00031ec4ee27fc32)}
+  },
+  {
+    {W(0x00036a312cd20cfc), W(0x0003ad22dc4ae563), W(0x00016bdcfed2610b),
+     W(0x000781fce00c9b15), W(0x000755493ed60b13)},
+    {W(0x0004d54bb444e9a9), W(0x0007754f03a62b8e), W(0x000522786c5df536),
+     W(0x0006762115c9d670), W(0x0000750bcbf7e449)},
+    {W(0x0000000000000001)},
+    {W(0x00036e5fc42b0826), W(0x00041f2dec9bde55), W(0x00070ce2482bd569),
+     W(0x000660286a0de9a9), W(0x0002f4a927292ce4)}
+  },
+  {
+    {W(0x000406eb2c5b4b4b), W(0x00040b1cb75427c2), W(0x0002ea06d30b8ff8),
+     W(0x00040f6976db5e1c), W(0x0005f1c341065b6a)},
+    {W(0x0002a836119e06ba), W(0x0004ce5af39d4b60), W(0x0000be5306f866f2),
+     W(0x00037934107e4ce5), W(0x0006179ebfa7f808)},
+    {W(0x0000000000000001)},
+    {W(0x0006d72935d275bd), W(0x00019fed1efd37c1), W(0x000303a2780add3f),
+     W(0x0002d33d42248b56), W(0x0006b6e5ea90a063)}
+  },
+  {
+    {W(0x0003fcf0bf0ded46), W(0x0005f6388c737e76), W(0x0001d48465c65459),
+     W(0x0007dd1fb0e76cb8), W(0x0001915024ee86ac)},
+    {W(0x00041a81461b6d92), W(0x0005e050dd416065), W(0x000116438f642407),
+     W(0x0000e958049be7a9), W(0x0005f2e054703222)},
+    {W(0x0000000000000001)},
+    {W(0x0002c527eec58f7c), W(0x0006527be9cde0a7), W(0x000643a29e99edd8),
+     W(0x00033100c7d0476f), W(0x0000922ca14b200b)}
+  },
+  {
+    {W(0x0005006ba0624f5d), W(0x00075fc3fff239b4), W(0x0005db9e8a7edd89),
+     W(0x0004643c37fa5472), W(0x0004e942d95930f3)},
+    {W(0x0006d5e138e0217b), W(0x00029a52c165f9e5), W(0x00030018225ae538),
+     W(0x0006b867260f0290), W(0x00045902f695d512)},
+    {W(0x0000000000000001)},
+    {W(0x00023d351204c70e), W(0x00011b1d85593a7d), W(0x000009dc697768d5),
+     W(0x00038f3305bb89bd), W(0x00030f1d7a2bf806)}
+  },
+  {
+    {W(0x00035041c5116a91), W(0x0000eff7f54d7cfa), W(0x0004749278685114),
+     W(0x0000aea095dd50be), W(0x00063e45f3d91ab9)},
+    {W(0x0007cd20708003da), W(0x0000a26ec91610a4), W(0x0004700ed4ed983f),
+     W(0x00005c349c7af04f), W(0x00046dad5a4ec2ad)},
+    {W(0x0000000000000001)},
+    {W(0x00016cabe6b6c679), W(0x000505918e23c2d5), W(0x00078cabc9326026),
+     W(0x0002c4b20576f608), W(0x0001a242161b53a1)}
+  },
+  {
+    {W(0x0004512886f3cc87), W(0x0005173a83f996d4), W(0x000316b7e53b447c),
+     W(0x0007b964cb16281d), W(0x0005e2ddd2175417)},
+    {W(0x0007d11bc55323aa), W(0x00056dc55bc78f6c), W(0x0007adf6c281019b),
+     W(0x00008a2d78ee218f), W(0x0003523b21847891)},
+    {W(0x0000000000000001)},
+    {W(0x0006dfa84aa5b028), W(0x0007e43edbc02c6c), W(0x00004c9198e090d0),
+     W(0x0004a6d2f66469ec), W(0x000449084a464839)}
+  },
+  {
+    {W(0x0002623889aa05ec), W(0x00045eed453e4075), W(0x0002cebcca27975c),
+     W(0x0001373923d41896), W(0x00062ff30a6b179a)},
+    {W(0x00044997b797d066), W(0x00058396206fecb8), W(0x0006e57585387fe5),
+     W(0x0001a35f55406fea), W(0x000562beb7999019)},
+    {W(0x0000000000000001)},
+    {W(0x000546b76105c0c4), W(0x0000fd969bd1ff77), W(0x00054aaf53eca158),
+     W(0x0000bc33a8bb07f8), W(0x0002851a66fadcf2)}
+  },
+  {
+    {W(0x00070a0bb588a556), W(0x00039dbf9ce27feb), W(0x00037b7706d8d2c2),
+     W(0x0007dc19ae17930e), W(0x00014988b5d62084)},
+    {W(0x0006b0f4c3b0cab3), W(0x00011e0b5590ee00), W(0x000523cb4722fa8c),
+     W(0x0007410dc7209d9d), W(0x000447068731fb98)},
+    {W(0x0000000000000001)},
+    {W(0x0003dfaa9a99503c), W(0x00043f019656b2f0), W(0x0000b78b029fac3e),
+     W(0x00060fc15a2c5edc), W(0x00041aef07acd5ef)}
+  },
+  {
+    {W(0x0002a7082b37a5b6), W(0x0000140cece244ab), W(0x0003a0b331abe483),
+     W(0x000216621a11b490), W(0x0001ac777f708a59)},
+    {W(0x000347e8335ce317), W(0x0006e95dfa82de45), W(0x0000ea205a68a0c6),
+     W(0x000443e3c0a80e37), W(0x00052a6f88d92af1)},
+    {W(0x0000000000000001)},
+    {W(0x0002fce52583d152), W(0x0000fe43e124ad45), W(0x0005d41db3b236c0),
+     W(0x0005281bb661124f), W(0x00067c1055ffa610)}
+  },
+  {
+    {W(0x0005cec8140e4bb3), W(0x000411d5fb19bbc5), W(0x00004abd9c7d7e1e),
+     W(0x0005ea8215bc7211), W(0x0005959792833b71)},
+    {W(0x0002d6a5bf5b7b64), W(0x0005e6ab1c3ecb0d), W(0x00058a65fb63278a),
+     W(0x000450d847d6337b), W(0x00041ce94633eabb)},
+    {W(0x0000000000000001)},
+    {W(0x00072f4d628b7507), W(0x0005d36c67bbca91), W(0x0005333ae4569c50),
+     W(0x000289af32932936), W(0x0002741a16cb281a)}
+  },
+  {
+    {W(0x00065fa7688a0607), W(0x00073d125d20253c), W(0x000245d96c7fc5e3),
+     W(0x00015a2b99b7f4c6), W(0x0004464a7962e672)},
+    {W(0x0001117013f891fe), W(0x0006dc9e09053a64), W(0x0002f77b7c6e0fe6),
+     W(0x0006280f82c53d43), W(0x0003d1510b92fd33)},
+    {W(0x0000000000000001)},
+    {W(0x0001ee023b932698), W(0x00019ceba2cc0396), W(0x0005bcf861c3cddb),
+     W(0x000077054b5f6a3e), W(0x00013430afddb9e2)}
+  },
+  {
+    {W(0x0004d09efe721c08), W(0x000438e53dda7ce8), W(0x0002ad322ab065d9),
+     W(0x0000733128cfa192), W(0x00062906d81e7f80)},
+    {W(0x0004d8cdc6c0f7d8), W(0x0000094c9d9efc6b), W(0x0002fba1ee81e1d7),
+     W(0x0004d5c371929eb8), W(0x0004b68efb5b1b70)},
+    {W(0x0000000000000001)},
+    {W(0x00007a067416c501), W(0x0006ed8a362cb07f), W(0x00030c0cca058c6a),
+     W(0x00053188c3d5d76c), W(0x0005a12942224926)}
+  },
+  {
+    {W(0x00057f23fc326757), W(0x0003fc4cb6741274), W(0x0005ccb3ddb3424a),
+     W(0x000779b72c773e86), W(0x0004300ff025ac78)},
+    {W(0x00063b623e4b3c01), W(0x000002398a861228), W(0x000738dc17270f2a),
+     W(0x0007f97486c8f8b5), W(0x0002f92880570846)},
+    {W(0x0000000000000001)},
+    {W(0x0000ad7edda51a36), W(0x00045ea4a0fd688e), W(0x0004ce9618cdf5e1),
+     W(0x0003b16565209c15), W(0x0002e4adbfb2b97c)}
+  },
+  {
+    {W(0x0007f66ffb1524e3), W(0x0005979144903be2), W(0x0005e914791af701),
+     W(0x0001293d4d863b7a), W(0x0005427ba28d9465)},
+    {W(0x000628721537d722), W(0x000181672d6426d0), W(0x000493da11cbd627),
+     W(0x0000fba52ea8fbf2), W(0x000547a97c4afc8d)},
+    {W(0x0000000000000001)},
+    {W(0x00066e0cd86cc0ef), W(0x00023e1216f65a9d), W(0x0001fb1614625b9f),
+     W(0x0004ccd8a8a3507e), W(0x000259e68073c714)}
+  },
+  {
+    {W(0x00053f74e5ce1015), W(0x0004e8a09af45b6b), W(0x00049b63fd8afe3f),
+     W(0x0006af1ffd10bbb1), W(0x000424c4493810bf)},
+    {W(0x00035b1a55046f32), W(0x0002c461adaf957d), W(0x0004cc3ff16af54d),
+     W(0x000202e80aa8d2c5), W(0x00074d0daa832d40)},
+    {W(0x0000000000000001)},
+    {W(0x0006b936d7136197), W(0x0000bde1fd3b9ae5), W(0x000570dc6325383d),
+     W(0x00060ebbfef6fedc), W(0x0000e963c090b45b)}
+  },
+  {
+    {W(0x000265383507b3cd), W(0x0002d1d8544dc361), W(0x000257e97151d7a3),
+     W(0x0005743bc44b3421), W(0x00054e10980d81b4)},
+    {W(0x00040eeb553c0676), W(0x00061c32875f4634), W(0x0007722c363146a3),
+     W(0x000626c467539074), W(0x0006b1eb48da6886)},
+    {W(0x0000000000000001)},
+    {W(0x000135225bf86e65), W(0x000574543533548a), W(0x0006e043f8b3911a),
+     W(0x0004d15dd4165640), W(0x0002bcdc809f1119)}
+  },
+  {
+    {W(0x0003575c1db71ddb), W(0x0007a00bead04255), W(0x000599ce3d1c1ec3),
+     W(0x000374f81262aba0), W(0x000732eb9e9ebb55)},
+    {W(0x00056bead2cea165), W(0x0005611be28f7b76), W(0x0002831e024e653c),
+     W(0x00008a6b589ecc90), W(0x0001fc6b00c89e48)},
+    {W(0x0000000000000001)},
+    {W(0x0002dc8a6f594ce5), W(0x00008713a5e59f28), W(0x00022f553b2539d2),
+     W(0x0003576f12182d8f), W(0x0001b268707e0048)}
+  },
+  {
+    {W(0x00028a97733d96fb), W(0x0005e77ef9fec532), W(0x0000134377f7ae4b),
+     W(0x000798a42aff7215), W(0x00074029c04b34b7)},
+    {W(0x0000cdc5a5625014), W(0x000339c7a5ad81bd), W(0x0002ff823e072450),
+     W(0x0006048399dad104), W(0x000501f63a252dfb)},
+    {W(0x0000000000000001)},
+    {W(0x0004515333d780ab), W(0x0002e2cceb23952b), W(0x0003a1048023df20),
+     W(0x00048a72908c60bb), W(0x00032b8b849a946f)}
+  },
+  {
+    {W(0x0005d7b718a6edd7), W(0x0006225ca1baecd9), W(0x00000080e9b5245f),
+     W(0x0005305f882a8008), W(0x00004524402ebb71)},
+    {W(0x000059365d5bf338), W(0x0002f5bc277344a8), W(0x0001549dd5c24c3b),
+     W(0x0003e2b2d34b7fdf), W(0x00071c9e2d15cdc4)},
+    {W(0x0000000000000001)},
+    {W(0x000674ad52a54e3f), W(0x000261e68d3bd481), W(0x00025d36393c3721),
+     W(0x000012afb3f6cda3), W(0x0006f70b310de338)}
+  },
+  {
+    {W(0x0003578ed7c12794), W(0x0004c0e10aa662c2), W(0x0002a5a507e9ccea),
+     W(0x0005df7565633114), W(0x0002555c620a50f2)},
+    {W(0x000618b7e71597e5), W(0x00026aa6460c674b), W(0x0005c88deb10efc0),
+     W(0x000499212b0edfba), W(0x0002b3c1bc5cda7f)},
+    {W(0x0000000000000001)},
+    {W(0x0000df7041b3b1bc), W(0x00048740065a961b), W(0x000235ba22555fea),
+     W(0x00051796315e4c0e), W(0x00064c06e2789a8a)}
+  },
+  {
+    {W(0x0006ca97bf3211a6), W(0x0004795a7c4ef104), W(0x00050f5ffed6e20e),
+     W(0x000457d7b86ba282), W(0x000555ea607b0ad1)},
+    {W(0x000349be58eddf5f), W(0x0001aa92abfb4e94), W(0x000583e2b433a641),
+     W(0x00052986a08b9053), W(0x0006df903158f51a)},
+    {W(0x0000000000000001)},
+    {W(0x00009116dd12ec6f), W(0x0000ece846fd61fd), W(0x000091f4a03ca52e),
+     W(0x000528c341507845), W(0x00062d66e7d60953)}
+  },
+  {
+    {W(0x00052bcb92e6fca6), W(0x0003b4b0dfe5854f), W(0x000301fa0135c019),
+     W(0x000512854e41f0ff), W(0x0004db3cfa284207)},
+    {W(0x0004e8503fa07154), W(0x00061911916e75c7), W(0x0006f4d70b591891),
+     W(0x0005953bc1ed95f1), W(0x0002a4fbf1c51dc0)},
+    {W(0x0000000000000001)},
+    {W(0x0002722607d5e83d), W(0x00012ec8749a9cf1), W(0x0006aeb0b16ee018),
+     W(0x0007afdf02dd6d4e), W(0x000602126644f1e6)}
+  },
+  {
+    {W(0x0006eae8c5050b16), W(0x0005852752194fc3), W(0x000760872ea8ee22),
+     W(0x0005438c2526b213), W(0x0005174e33ffdf28)},
+    {W(0x00018ccd403561cc), W(0x0007dd1cc8e8df53), W(0x000455d6c5865e58),
+     W(0x000251e837c4f0ed), W(0x000315ca6bc8e35e)},
+    {W(0x0000000000000001)},
+    {W(0x0004b927db243dee), W(0x00077937c1b7962e), W(0x00075eca476318e8),
+     W(0x0006db89b6d3bc1d), W(0x0004159f038a86e8)}
+  },
+  {
+    {W(0x00066f3f24c4d7ce), W(0x000139a9d2906efd), W(0x00025bdee7768c60),
+     W(0x0007bc7ecacdcab0), W(0x0006e8ce4ff435b7)},
+    {W(0x0003c8e4eaba452c), W(0x0003fe17de165995), W(0x0000bc5897ee0792),
+     W(0x000442bd05065851), W(0x00020ab65593c0c6)},
+    {W(0x0000000000000001)},
+    {W(0x00022afd6604dba5), W(0x000602047263d8a9), W(0x00033265ec871ddc),
+     W(0x000239a4cf3b30bd), W(0x000662a9238ba3ad)}
+  },
+  {
+    {W(0x00020e5a1e2beb3b), W(0x0006ccf473ce2d1a), W(0x00077b8cae6e9c27),
+     W(0x0004d7a645a6eacf), W(0x0004250fb17258f2)},
+    {W(0x0002ae05ca04b42c), W(0x0001a3f88a4327c6), W(0x000405860e882979),
+     W(0x000483c809d95d60), W(0x00001eaeab26460b)},
+    {W(0x0000000000000001)},
+    {W(0x0001ed0f8a343842), W(0x0002855383490ca7), W(0x000734bca831bad5),
+     W(0x0005447ecd256ab7), W(0x0002c4e48cc9d994)}
+  },
+  {
+    {W(0x000274a65cef4972), W(0x0001e817b6ac11e8), W(0x0002dd2a13e609aa),
+     W(0x000717d8d8e3d342), W(0x0004f66888b34279)},
+    {W(0x0001169e77f28de4), W(0x000503862cce5b9e), W(0x00022c32d9f2ddc0),
+     W(0x000543a84d9d138d), W(0x0007236db5046d96)},
+    {W(0x0000000000000001)},
+    {W(0x00063a238b30df53), W(0x0002e5ea6a8baf9d), W(0x00012e76f8588a81),
+     W(0x0007f55fbedd1983), W(0x00068206e921839d)}
+  },
+  {
+    {W(0x000596b697cfe7d5), W(0x0004a0fbdef76d42), W(0x00022dd5c35dfad4),
+     W(0x000292621ad2cfff), W(0x0006d4d4504110de)},
+    {W(0x000177b647c5f96c), W(0x0001602c3c63c496), W(0x0005f3f6cf0713d1),
+     W(0x0005591b0f229aa8), W(0x0004716501651820)},
+    {W(0x0000000000000001)},
+    {W(0x0005476053307960), W(0x00022e7104c4a530), W(0x0001c513ce5e717a),
+     W(0x00068bf57b9e16e8), W(0x000335b0d0773d76)}
+  },
+  {
+    {W(0x000307eb8ddebe80), W(0x0004dd7c7673b2ee), W(0x00052e17e55bca6c),
+     W(0x0000151168cb2bbf), W(0x0006657d1f832997)},
+    {W(0x0001aa243571dce5), W(0x000448b2a0370f86), W(0x0001f9274d274759),
+     W(0x0004ef19663c64e7), W(0x0006633a0e9b15e4)},
+    {W(0x0000000000000001)},
+    {W(0x00044ba8e73b9cd7), W(0x000608a8f0b1abaf), W(0x00037482a9fbd0d8),
+     W(0x000625c08e4e7b8f), W(0x000648dbd5c6b0fc)}
+  },
+  {
+    {W(0x0004254a956ad2a5), W(0x0001062b97509dc1), W(0x0007f53cbd0520a5),
+     W(0x0007c193c91d7e87), W(0x000799a065c3b5fe)},
+    {W(0x000531956463da88), W(0x00078754adf12265), W(0x000097b5081daeac),
+     W(0x0002d45351169e6a), W(0x000183e6517633cf)},
+    {W(0x0000000000000001)},
+    {W(0x0005820ebf2343ff), W(0x00020a34f274ae73), W(0x0003fa3e539eac9a),
+     W(0x00050c5e37df5001), W(0x000747634f287eef)}
+  },
+  {
+    {W(0x000427aabaa614db), W(0x0001737b3a5d800c), W(0x0005044bf9d8230a),
+     W(0x0001dae9be5389bb), W(0x0000ea3069d39e3c)},
+    {W(0x0000d261518f6cb4), W(0x0004fb6cde8b1fec), W(0x0006dc35e4db6719),
+     W(0x0006a2dd7d954ef3), W(0x00074e800aa5bb0b)},
+    {W(0x0000000000000001)},
+    {W(0x0001fca8363e5105), W(0x0003b22e4578d2da), W(0x0007e6fb7b83924f),
+     W(0x0004e1d0e5f63108), W(0x0000ea906784853a)}
+  },
+  {
+    {W(0x0002bbc049e73653), W(0x0002e6fed8836aa9), W(0x0005baf8367fa96f),
+     W(0x000577c2a596919f), W(0x000087378259b6f5)},
+    {W(0x0000755d6f870245), W(0x000257ba748eb390), W(0x0002d12ff94876f5),
+     W(0x0001cd2cf5df2a9d), W(0x00056aaf06f833ec)},
+    {W(0x0000000000000001)},
+    {W(0x00048d59f602f547), W(0x0007215e7c391cfa), W(0x0005d30676f39f46),
+     W(0x0000cbe2836b54e9), W(0x0001c09d64b1d490)}
+  },
+  {
+    {W(0x0004068561fa8f32), W(0x000669cdea2299c5), W(0x0003533a4787f861),
+     W(0x0007bfc6ecdd2271), W(0x00011a1f76ea5aae)},
+    {W(0x0004a084743f1d62), W(0x0003ba38e06b54d3), W(0x0004d5f796e39c0a),
+     W(0x0003a145572eb4d3), W(0x00079ad4349e3f39)},
+    {W(0x0000000000000001)},
+    {W(0x00016c1e4908f457), W(0x00063109a82103b7), W(0x00034946a0022bb3),
+     W(0x0006e104f71900b6), W(0x000350ec59df15d8)}
+  },
+  {
+    {W(0x00007eceb311cb00), W(0x0006210d5cb3b421), W(0x0007f757c8b66a67),
+     W(0x000279b548aa5204), W(0x0006ab2f1efacd86)},
+    {W(0x00068348fdf83719), W(0x0002e9169de02bce), W(0x00012fb8c5661786),
+     W(0x0007771641bdf143), W(0x0004ed69c61dac79)},
+    {W(0x0000000000000001)},
+    {W(0x000440eb51167358), W(0x000452f166cf86ef), W(0x0007ab6924bcec62),
+     W(0x0005d710e48dc69f), W(0x0005dab222ee6b0a)}
+  },
+  {
+    {W(0x00035bc21fd0c500), W(0x0005f78273673a09), W(0x0004aef17dd4d8e0),
+     W(0x0007b579d0c4ba0d), W(0x00005a2f037f5242)},
+    {W(0x00042da9a16b37ec), W(0x000435b2cb7676a2), W(0x00077a035c5a167c),
+     W(0x000268816d232846), W(0x0007c88548712f1a)},
+    {W(0x0000000000000001)},
+    {W(0x0006b7e05f9e2445), W(0x0000ffaa391559ee), W(0x000593b754835960),
+     W(0x0005d3db82f6de2e), W(0x0005cfa31a82dd91)}
+  },
+  {
+    {W(0x0001a60c3ba9aad5), W(0x00000c2ef9cd96e3), W(0x0005fe02f5c600b9),
+     W(0x00031a7014251fec), W(0x000267b47b3ae1aa)},
+    {W(0x0004d080d945ccf2), W(0x0000cddb071f1836), W(0x000451cbfd3ba66c),
+     W(0x000142329f346a10), W(0x00075165decda59f)},
+    {W(0x0000000000000001)},
+    {W(0x000114d300c3f9fa), W(0x000707999df33df3), W(0x0002e2b2cf86e859),
+     W(0x00030e62319ccfb5), W(0x00053203d4e409ac)}
+  },
+  {
+    {W(0x000784d0cf55f6cc), W(0x00007e53ee95610d), W(0x0003066961d6211f),
+     W(0x0005c39d7b374514), W(0x0007b8341474f38f)},
+    {W(0x0004536604bbd092), W(0x0007b30d1db412a5), W(0x000004d14c6055b6),
+     W(0x000351afe2cd3e48), W(0x00050b004b742668)},
+    {W(0x0000000000000001)},
+    {W(0x0005822f5f3bece5), W(0x000509d3e696b5a1), W(0x00076a0391b4a986),
+     W(0x0004f5430318f4a3), W(0x00001de14dda1803)}
+  },
+  {
+    {W(0x0001fbf1eeb028d6), W(0x0006402ec4fc78dc), W(0x000445e4a8897e2d),
+     W(0x0001a36e50a2dbd6), W(0x0006b52fc1f93794)},
+    {W(0x00023e92007f16de), W(0x0003172e1aa2b7f8), W(0x0003d08fefa41802),
+     W(0x00053f02f2570e8a), W(0x00018ffbef50c105)},
+    {W(0x0000000000000001)},
+    {W(0x000617957a49e3e9), W(0x0006fd5dd1bbebb0), W(0x0004ab220a0b0756),
+     W(0x0002b24518da0103), W(0x0007e9004c1ba3b9)}
+  },
+  {
+    {W(0x0005cd95261edc0c), W(0x000774eedbc21032), W(0x00070857b1f41c15),
+     W(0x000241a408cf90c6), W(0x00026bbf07dd431a)},
+    {W(0x00076014f54813ea), W(0x0006a24c67b51d30), W(0x0006494a345b2366),
+     W(0x0001311e7f8bb180), W(0x0002fce75baf11a1)},
+    {W(0x0000000000000001)},
+    {W(0x0004385290a839da), W(0x00010be6d570f5d2), W(0x0001ba9a41b0333b),
+     W(0x000494c745a6560b), W(0x0003e1d774614685)}
+  },
+  {
+    {W(0x0005262b14130936), W(0x0000ef877103a65a), W(0x00006b5e2797d95f),
+     W(0x000442c9a5f81f8f), W(0x0005ee6a05213bfa)},
+    {W(0x0004ae305bf6a335), W(0x0003c83bbb6edf19), W(0x00000da7bd2305b4),
+     W(0x000353f114b14590), W(0x0003cbf8c36b5dc0)},
+    {W(0x0000000000000001)},
+    {W(0x0004598272e7e8ce), W(0x0003f9024be3783e), W(0x0003b5afa285eaa2),
+     W(0x00022e04fac68ae6), W(0x0005aa186cec4929)}
+  },
+  {
+    {W(0x0003686f21d01dc1), W(0x0006b24cd88c7765), W(0x000508b1303c8089),
+     W(0x00021c712b0ddd45), W(0x0007bad3c55c8be4)},
+    {W(0x00012dee313fb99a), W(0x00013df9e7ba8985), W(0x00061fff7d05c4ea),
+     W(0x000240c5754f4c32), W(0x00013904df71433a)},
+    {W(0x0000000000000001)},
+    {W(0x00006b5df88fe310), W(0x00042afa8460cc54), W(0x00015fda1150094d),
+     W(0x0004b02ad4e73e65), W(0x000528bc482b412b)}
+  },
+  {
+    {W(0x0000cbeb39a41191), W(0x00079add6b5fc19e), W(0x00051979474bc85c),
+     W(0x0000fb99c18e32cf), W(0x0001cc77f113b955)},
+    {W(0x00007954c0565b5e), W(0x00000ecccfb0255a), W(0x0001ab25ff374d65),
+     W(0x0000224775e9dc9b), W(0x0004b2ee65201e20)},
+    {W(0x0000000000000001)},
+    {W(0x00026d37d1807d96), W(0x0006fb19e3da90b7), W(0x0001ec9f648b516b),
+     W(0x0000584e946ef55f), W(0x0001e45e5c17d207)}
+  },
+  {
+    {W(0x000722ab2dad606f), W(0x00029f2d406b83c9), W(0x00036786fa9505b4),
+     W(0x0007371d65e1b7a7), W(0x00037d0d30f69749)},
+    {W(0x0002b64d04727c40), W(0x0004afae206d5325), W(0x00017e1b008e78ac),
+     W(0x0001385efdae2b6a), W(0x00069e1730dc8f89)},
+    {W(0x0000000000000001)},
+    {W(0x00055d04e811dcda), W(0x00044b1c2414b060), W(0x000435b518e17062),
+     W(0x00070f234d16cfe4), W(0x0006aafd71289d7a)}
+  },
+  {
+    {W(0x0006cd7e70002277), W(0x000671b66a6aff7c), W(0x0004e39959d1dd1b),
+     W(0x000094f2c9c0fc9e), W(0x0004970696edc00e)},
+    {W(0x0005ccbd85b8138c), W(0x0000a85bed50ff97), W(0x00027e7675e12cd6),
+     W(0x00016d18d8e180cd), W(0x00004b252e2d2625)},
+    {W(0x0000000000000001)},
+    {W(0x000157677b958d36), W(0x0002c9cd312c019a), W(0x00020364bda7a426),
+     W(0x000141231b923451), W(0x0003b18455f904a1)}
+  },
+  {
+    {W(0x0004f58fdb3395ad), W(0x0001d99f82462290), W(0x000669304c749674),
+     W(0x0006d8d80439909c), W(0x00019b848f4a29e0)},
+    {W(0x0006531f53e060d9), W(0x0004d5914724962e), W(0x0002ce2f00f22220),
+     W(0x00053b65afb2b242), W(0x00011b89d71a9a42)},
+    {W(0x0000000000000001)},
+    {W(0x00051af49bc1622a), W(0x00020970d800351d), W(0x00034ff7c1bcac03),
+     W(0x0001645ce783a185), W(0x0004cf05b65c9867)}
+  },
+  {
+    {W(0x00074e70cc6f13e9), W(0x00044819265cfd3b), W(0x0003187c24f81ff8),
+     W(0x0004c1f82f45ef54), W(0x00053ea3d68baf61)},
+    {W(0x0002a8b5ddee8f49), W(0x00053f2f9ebd8647), W(0x000598608006f568),
+     W(0x000364abc1029307), W(0x0005a711d3edf837)},
+    {W(0x0000000000000001)},
+    {W(0x0007648d6c17e6d0), W(0x0007590c41cc86b0), W(0x00052a8fc2bcd255),
+     W(0x000451df6f5583f6), W(0x0002c691ea6e5a06)}
+  },
+  {
+    {W(0x0001b3c974b32122), W(0x000398564a6ffdc5), W(0x0001d7d062b062b4),
+     W(0x000455f0359396d3), W(0x0006ad9880b46063)},
+    {W(0x0001e164db7a9077), W(0x0004e578f34119ed), W(0x0007fcb75814dba4),
+     W(0x00028da5f11f46c8), W(0x0000cc43f190fa92)},
+    {W(0x0000000000000001)},
+    {W(0x0001bb403d70d582), W(0x00024bb2a4d1ba20), W(0x00041ce43fcc76b2),
+     W(0x00036e641b18732e), W(0x0003eb1e6aa6266c)}
+  },
+  {
+    {W(0x0005f2580b940320), W(0x000052c71b2c3169), W(0x0001d4de8435a3dc),
+     W(0x0006bc374df5bef1), W(0x0000c7c7d16010cf)},
+    {W(0x00025dd094cd4d1d), W(0x0000643dfdee11e5), W(0x00019909e981823b),
+     W(0x0004ed0ad889606c), W(0x0004f20b9b4c9628)},
+    {W(0x0000000000000001)},
+    {W(0x00041dd3ce35eb7a), W(0x00018c800e2d5ab6), W(0x00044efae41d7000),
+     W(0x0000513c74adda41), W(0x0002f9cfffe7722d)}
+  },
+  {
+    {W(0x00066b8c41b2c571), W(0x0000bf3bf418bb67), W(0x0006f055f262a441),
+     W(0x0004e67deb6b0ad9), W(0x0003059e553e39f8)},
+    {W(0x00059826eb7de139), W(0x00020dc883d90c0b), W(0x000219b47e2c2dc1),
+     W(0x000115a563ff03d0), W(0x0003616d6865b027)},
+    {W(0x0000000000000001)},
+    {W(0x0002d8c9c4b33d01), W(0x0006e6844e8d97a6), W(0x00057711272fd403),
+     W(0x0002607fb04f5478), W(0x0006c9ceb6532df0)}
+  },
+  {
+    {W(0x0004089443b48842), W(0x0003eea9f581ff01), W(0x000255c464c3f291),
+     W(0x0002a9a5ebfa42cb), W(0x000713363bc28f3a)},
+    {W(0x0002aa345c27a815), W(0x00041fdd23f05d41), W(0x0005cda370292ae7),
+     W(0x00026fa8f5216471), W(0x00033c1613ecb4c4)},
+    {W(0x0000000000000001)},
+    {W(0x00065ad95c747d7b), W(0x0003bcece66f8616), W(0x0001b74f677004b1),
+     W(0x00029a0f60549f35), W(0x0006c929c83c64f4)}
+  },
+  {
+    {W(0x0001433dee6d53fe), W(0x00036f98d2cb9247), W(0x0006e02c11e07cce),
+     W(0x0001e66d5fbece3a), W(0x0002927a4add0111)},
+    {W(0x000604ca136b0ecb), W(0x00055bf77fa46769), W(0x000137f1ca96c484),
+     W(0x00075e48ba8cff3c), W(0x00064a2f80647c31)},
+    {W(0x0000000000000001)},
+    {W(0x00073b4e22964387), W(0x0006015106401bf1), W(0x0002cd857d448aa2),
+     W(0x0005f4372023a995), W(0x0002de85b832540c)}
+  },
+  {
+    {W(0x0007853efd13c5a3), W(0x0005d40f0929e563), W(0x0005c0f6af5d370d),
+     W(0x0007fad3d539940c), W(0x0005dc7e345c4813)},
+    {W(0x0007c1950a7466eb), W(0x000294416bfe8508), W(0x00077ccbbe021472),
+     W(0x0003fc977f4a2c66), W(0x000207fd98396933)},
+    {W(0x0000000000000001)},
+    {W(0x0001dd8f6b6f5d16), W(0x00036f37ee5789da), W(0x0000e849f0e7709a),
+     W(0x00044bfbeb566a96), W(0x0007a042ae999278)}
+  },
+  {
+    {W(0x0001f39c689c8fba), W(0x0003f5cec4dc9370), W(0x000291470cd326af),
+     W(0x0000838531f78733), W(0x0001937d869b1fc5)},
+    {W(0x0004d5097c7eac29), W(0x0005ad2899a6427e), W(0x0003d04f50be233e),
+     W(0x0006fd0d4e80b0ff), W(0x00079c917849e0e6)},
+    {W(0x0000000000000001)},
+    {W(0x0003110678e31527), W(0x00064515d5dede64), W(0x000549248b5d0b6b),
+     W(0x00017c614fda0fe4), W(0x0005a0faa09f93e1)}
+  },
+  {
+    {W(0x0003554259e390f3), W(0x0002b5187e0a62eb), W(0x00059bb0930fbaba),
+     W(0x0000e1aeab5e0b4d), W(0x0005d68b8af6f6f6)},
+    {W(0x00057bc78af70f6c), W(0x0006ebad17bb6e93), W(0x00041091c2a0c88e),
+     W(0x0002017f18c309e5), W(0x000099f135cad79d)},
+    {W(0x0000000000000001)},
+    {W(0x0000bf73ca977076), W(0x0006e7b74f3be3af), W(0x0002b04e3e92046b),
+     W(0x0003b67e4a3d7234), W(0x0004c2b6da76c94f)}
+  },
+  {
+    {W(0x00027706c0fea9c9), W(0x00000d1d95dcc2df), W(0x0000015dd1715f4e),
+     W(0x000194a7bad28d58), W(0x0002a3a220ef2d95)},
+    {W(0x00073db65cd0727d), W(0x00062c73da8ea458), W(0x000060267fdedd5c),
+     W(0x000332418c88fbbf), W(0x000369bd48c9507c)},
+    {W(0x0000000000000001)},
+    {W(0x0004c7bd25b380b6), W(0x00037e80195a3358), W(0x00075a1a2bca06ed),
+     W(0x0007210b92c86a77), W(0x00044314f147901a)}
+  },
+  {
+    {W(0x0002c392232af3c9), W(0x0007a7c7a4b0ade3), W(0x0005d7d28971b3f4),
+     W(0x0002560c7d098643), W(0x000503c51fd46f90)},
+    {W(0x000278b111ff3d8b), W(0x00030c5f58416edc), W(0x0000c735a3a2f54f),
+     W(0x0003755b5cbf18a5), W(0x000741ab31a98f6f)},
+    {W(0x0000000000000001)},
+    {W(0x00013af71c0cf45a), W(0x0003db265107175c), W(0x0000f8a1c57331a2),
+     W(0x00003ab8f43c31c1), W(0x0003ff13d58d3a8f)}
+  },
+  {
+    {W(0x00023bf5d82c371f), W(0x0000f02571eb4c03), W(0x00000fbe4c994f7d),
+     W(0x00062ba0e51685e1), W(0x000415204ccb6618)},
+    {W(0x00055f24a2bd4ea7), W(0x0007e96c252b8329), W(0x000776ef70f534ce),
+     W(0x00025ccd982b63ef), W(0x00011dfda8f782ff)},
+    {W(0x0000000000000001)},
+    {W(0x00014bba69fdbde9), W(0x0001e479495863e4), W(0x0007cfca3a94365d),
+     W(0x0000eaa70f142128), W(0x000354ed0e6c7ed4)}
+  },
+  {
+    {W(0x000042091b0e8f87), W(0x0001260bd6b7e99f), W(0x000216b16397c966),
+     W(0x00063542913281ed), W(0x0000b00ff26f0ec6)},
+    {W(0x000039bac8ae83da), W(0x00020d40a8f965e8), W(0x000164ecae2ec9ee),
+     W(0x0002ddfeaac76ec4), W(0x00064867cea0bbb0)},
+    {W(0x0000000000000001)},
+    {W(0x0005b24bf9f94b22), W(0x0002a504ca2ddb5e), W(0x0005d76b99596c1f),
+     W(0x0005df47bf72ea62), W(0x0002ca33a1fcc6c3)}
+  },
+  {
+    {W(0x000641d07bc01332), W(0x000487f7e1f978d2), W(0x0005054784833da1),
+     W(0x0000894a09d8d86e), W(0x00041745c098c1df)},
+    {W(0x00063a552e72ba66), W(0x0007510dcc01cdcc), W(0x0005d8fa60049d3d),
+     W(0x0007bae5acf90499), W(0x00063bbe508d7e29)},
+    {W(0x0000000000000001)},
+    {W(0x0006eb79516043c2), W(0x0002b48e25bd4555), W(0x00028f7ca731b52a),
+     W(0x00071da8c3d4b456), W(0x00040dc425e505be)}
+  },
+  {
+    {W(0x0005a8ee6f229a2c), W(0x000452c935cddb25), W(0x0006c24b7910035e),
+     W(0x00065445528d802f), W(0x0002f36bb8ddaaa7)},
+    {W(0x0004888ea98da281), W(0x000321f798c45862), W(0x00078bb42ca64c9a),
+     W(0x000015087bd6a0ee), W(0x0007d421097901e3)},
+    {W(0x0000000000000001)},
+    {W(0x00072b1f042c287b), W(0x0003fb06e505d949), W(0x00010175d5f2d093),
+     W(0x000236e0d58dcc83), W(0x0003dc5cc6845ee8)}
+  },
+  {
+    {W(0x0005dad9a2e0d293), W(0x00017c814cb9aae5), W(0x000188f3c85d17b6),
+     W(0x0003b7e2cd2e155e), W(0x00022ad92a4e2038)},
+    {W(0x00052a904e848541), W(0x00069b04db284dfb), W(0x0001a648f1e03f3d),
+     W(0x0002b49ff21269a8), W(0x00042edec13ab335)},
+    {W(0x0000000000000001)},
+    {W(0x0005c7e5a52d33c8), W(0x000067f6dc107d83), W(0x0003b18edc1a6c8a),
+     W(0x00070c6b6cb4867b), W(0x0006563d17a0891b)}
+  },
+  {
+    {W(0x00034f3e26b4b5c2), W(0x0003174e41a57c12), W(0x000023e0bbaa05fb),
+     W(0x000379ca5009ebe1), W(0x00051ecfc646340b)},
+    {W(0x00022cac7c35aa9c), W(0x00050866f921b5c9), W(0x0004ffa9e4909e08),
+     W(0x00066be3a8b0f01b), W(0x0003dadbb892c397)},
+    {W(0x0000000000000001)},
+    {W(0x00032ba61d5b3d1a), W(0x0007654c3259e1b5), W(0x000090347b2fff9e),
+     W(0x0006995de9b02137), W(0x00046a6f0920c817)}
+  },
+  {
+    {W(0x000256742fc40607), W(0x0007634630e65da2), W(0x0000c7b2fa80737d),
+     W(0x0003583ea51f904b), W(0x000428093a643659)},
+    {W(0x0000d340441cd95a), W(0x00041e93fe87bd14), W(0x0007b3cbb684f492),
+     W(0x0005752c76bb4996), W(0x000645a749dbcc67)},
+    {W(0x0000000000000001)},
+    {W(0x000651ba9e933f2d), W(0x000182b87207f6ba), W(0x000249f8a7f9a0e8),
+     W(0x00050b73a4a4f4be), W(0x000282ea2962ce46)}
+  },
+  {
+    {W(0x00012f86b13fac48), W(0x0007150dc7778c44), W(0x00016b6ff774de55),
+     W(0x0002f94cc1373b64), W(0x0002dad41ee31d77)},
+    {W(0x000458a8b66ed722), W(0x000194677cb6ade3), W(0x000587af0310071c),
+     W(0x0006a9a8743b4975), W(0x00079790864db95d)},
+    {W(0x0000000000000001)},
+    {W(0x0003c41b195f9b00), W(0x0003811230cfbecf), W(0x00069664a48c4262),
+     W(0x00078129bf02f5f3), W(0x0001e886d5073f09)}
+  },
+  {
+    {W(0x0005fa0ed8aec548), W(0x0006809c9f3224c9), W(0x00007eb5eb7905be),
+     W(0x000485f2819ab8f0), W(0x00060fa5a6e47110)},
+    {W(0x0007f675feca725e), W(0x000175f488753247), W(0x000661d2417d84fe),
+     W(0x00004fef6a0450fe), W(0x0003445b933cdd42)},
+    {W(0x0000000000000001)},
+    {W(0x00015acc1a8979cc), W(0x0003ec2b0089b0bc), W(0x0004caa405546b27),
+     W(0x0007b60676e6ae4d), W(0x0000a0eb63ce6e86)}
+  },
+  {
+    {W(0x00008fb34c6afeec), W(0x00005da33b3ef762), W(0x0005c3561339f9c1),
+     W(0x00001e9e9e7acce0), W(0x0002173535a88c03)},
+    {W(0x000029c5bc1e96dd), W(0x00061a214057eb46), W(0x0005f72042ca962e),
+     W(0x0001c06cfe687cec), W(0x00041bd601f481f6)},
+    {W(0x0000000000000001)},
+    {W(0x0007b37e612a00a3), W(0x0002032206da3820), W(0x0007b482ffee311f),
+     W(0x0007c6d264c6f951), W(0x0003f476b178f0d7)}
+  },
+  {
+    {W(0x0005ffb58a6a42f6), W(0x00027938f63b4698), W(0x000675a89cfbf339),
+     W(0x00015b19cfe8d3d4), W(0x0005119eacaa5a40)},
+    {W(0x00057591cb7ce237), W(0x000280ea2749a6e2), W(0x00007ffae2f54b4e),
+     W(0x0004a188288fb1b2), W(0x0004031bd9e2e6be)},
+    {W(0x0000000000000001)},
+    {W(0x0001432099de2271), W(0x00043ff4b9e97d7c), W(0x0003b427dbd37ac2),
+     W(0x00076d367c9ac218), W(0x0007c0dc4c5b35cd)}
+  },
+  {
+    {W(0x0004c35e45006795), W(0x00038ecb9ca2bb4f), W(0x0003b166fc76af7a),
+     W(0x0002030647769257), W(0x000223fb079fcbdb)},
+    {W(0x00005a2eedc22ff1), W(0x0007e5058f57f2cc), W(0x000417ea46774b53),
+     W(0x00061e66a37631e0), W(0x0003cca088c665de)},
+    {W(0x0000000000000001)},
+    {W(0x0002da9d21777a1b), W(0x0005b0abbefc22df), W(0x000787491d7a0628),
+     W(0x00030d5735c93434), W(0x00068079b33a604f)}
+  },
+  {
+    {W(0x000780094dd9bab1), W(0x0002a2bc66b2f542), W(0x00068edf52776416),
+     W(0x0003b7d386202086), W(0x0001d6b03dafa4f8)},
+    {W(0x0007f2813569c488), W(0x0007625bbd664815), W(0x00072be22611efa8),
+     W(0x00070d572b8cce45), W(0x0001602f28a95939)},
+    {W(0x0000000000000001)},
+    {W(0x0007c019d354b2fe), W(0x000352a95914e130), W(0x000092f5864c7a74),
+     W(0x0006bd4219c36523), W(0x00063c3aa25b7282)}
+  },
+  {
+    {W(0x000776bd05a19ceb), W(0x0005f1b51885022e), W(0x00055ac6d8abcb97),
+     W(0x0003036b52385cf9), W(0x0001c3c71f7eb9d5)},
+    {W(0x0005d9ca1e605cac), W(0x00010c1d2858b3b3), W(0x0002ed1417c5e41d),
+     W(0x0004891a768fddae), W(0x00066a7d0187c666)},
+    {W(0x0000000000000001)},
+    {W(0x00024a4b368e6e11), W(0x000515625c48f385), W(0x000726498c6feeed),
+     W(0x000481c97be70ec5), W(0x00009909197a6f98)}
+  },
+  {
+    {W(0x0003746820513cff), W(0x0003340dd835bc21), W(0x00050a2392b6b89d),
+     W(0x0003d2a64e8d55ae), W(0x0004ae6e93c685a1)},
+    {W(0x00025c4222a56b39), W(0x0003b69e31821108), W(0x0003b6f145c76f33),
+     W(0x000202e92dd9e089), W(0x00064d3e1d08dfa2)},
+    {W(0x0000000000000001)},
+    {W(0x0000886209a3e327), W(0x0001466dd860fdfd), W(0x00063abbb90fca9f),
+     W(0x0001d1624804dbe0), W(0x0000658c0ddb97dc)}
+  },
+  {
+    {W(0x00022ea6f7017ba2), W(0x00048ce7d6d4f729), W(0x0003259691ca61be),
+     W(0x000258113d5aa93f), W(0x00025014b8f9e403)},
+    {W(0x0000916f83d7fa65), W(0x0007a0cf3be536f3), W(0x0004f6db3e3091ce),
+     W(0x00012e96c6a0e92b), W(0x000140479af99dff)},
+    {W(0x0000000000000001)},
+    {W(0x00008fe3b5ca3f65), W(0x0001248b618c6f3a), W(0x00064719fd361092),
+     W(0x0000f06f30c7be6d), W(0x0007c3a7db21a8f4)}
+  },
+  {
+    {W(0x000639d7a79eec39), W(0x000514baa1287f4e), W(0x0007a3bf2e6381ed),
+     W(0x0003ad015417c7fc), W(0x0001384970d11d0d)},
+    {W(0x00050f907f91df76), W(0x0003d0d118411543), W(0x0004f2c63edcf21d),
+     W(0x00042157d6c2a0a4), W(0x00041fcf4d9dc525)},
+    {W(0x0000000000000001)},
+    {W(0x0006a2dc8810d113), W(0x00061ac4e5a6523f), W(0x00072e7a7edbd8c7),
+     W(0x0004c455305782c5), W(0x0003bcec6e0eef96)}
+  },
+  {
+    {W(0x00062c5a77cd2b15), W(0x0004361cdede2e17), W(0x000375c665fc1e17),
+     W(0x0006908e158231fc), W(0x00015ff1e140828e)},
+    {W(0x00074900f9aecbff), W(0x0000544c31b59f8d), W(0x0007ea93b6f7b02b),
+     W(0x0003267fff77534d), W(0x000523bf8e3e47f1)},
+    {W(0x0000000000000001)},
+    {W(0x0004bcc632f0512c), W(0x00019767980bdbab), W(0x000078acc3861443),
+     W(0x0000e48cba36638c), W(0x00065c01d86b9da5)}
+  },
+  {
+    {W(0x00021569b7627a5e), W(0x00047cb0275605fe), W(0x0001ec7b93bd8ef0),
+     W(0x0000637dc74a342a), W(0x000361abee487c37)},
+    {W(0x000228747a6368a5), W(0x00050afdb7564a88), W(0x0007b4a8b1601447),
+     W(0x000249c9f0cbec9e), W(0x00059395b5dbfa46)},
+    {W(0x0000000000000001)},
+    {W(0x00065b0b4f2a4558), W(0x0007e8b07cd7dfce), W(0x0005686b218c9466),
+     W(0x00054776cd84f9b4), W(0x00012b4410ae9da3)}
+  },
+  {
+    {W(0x0000586948cccf15), W(0x0004b334a84db29b), W(0x0000b9147ad1d792),
+     W(0x0007431557b3f1a4), W(0x0002d63ce5778496)},
+    {W(0x00022da181403fa5), W(0x0001202a16b2ba07), W(0x00044a36108a8761),
+     W(0x0006c3d71ed9872f), W(0x0001c7a0dc6a5ea7)},
+    {W(0x0000000000000001)},
+    {W(0x0000283731a0572f), W(0x000315e0977414f1), W(0x0005578d608b3390),
+     W(0x00042e059fab9a95), W(0x0007e478578fd21d)}
+  },
+  {
+    {W(0x000071dddab600a0), W(0x0006cceb3ded1815), W(0x0003e4617b394350),
+     W(0x0004fadbf6679300), W(0x0005d41e43873aad)},
+    {W(0x000557c8879cf742), W(0x00010c6c8635a072), W(0x00025ec78a714a63),
+     W(0x0006ac13b9cceb0d), W(0x0002d805422b9423)},
+    {W(0x0000000000000001)},
+    {W(0x0005f280f5535594), W(0x000544949ad2b128), W(0x0007f672c0f4285b),
+     W(0x00058dbfd2c50bba), W(0x0002e3e36f1e0f58)}
+  },
+  {
+    {W(0x0000f65a80f72313), W(0x00010936725b208f), W(0x00019af9077536a9),
+     W(0x00050dc3e5c15326), W(0x00036fd686c22d85)},
+    {W(0x000311a3e16a9639), W(0x00039713bb647c63), W(0x0006c611f3e2dcaa),
+     W(0x0002a63f531a1506), W(0x000088d2690f57fd)},
+    {W(0x0000000000000001)},
+    {W(0x0007f8fd9515c1fd), W(0x0006311f9c38ad92), W(0x0005594cd54cc226),
+     W(0x000407cf4055226e), W(0x00078e62d5273fec)}
+  },
+  {
+    {W(0x0005e59bda1c54ab), W(0x0006abe36146fe28), W(0x00044811a38b16b1),
+     W(0x00060f487629b021), W(0x00010c59e8c0cead)},
+    {W(0x0005fea60ac6d302), W(0x00033364b360a106), W(0x0002c7692ef199cf),
+     W(0x0001062b97162548), W(0x000661cbbea984da)},
+    {W(0x0000000000000001)},
+    {W(0x00002283890b9a27), W(0x00007d5c98fce015), W(0x00014407beb4a394),
+     W(0x000443840440e886), W(0x0001f74063f9fc61)}
+  },
+  {
+    {W(0x0007e6aed46dbe92), W(0x0001c615184e2cec), W(0x000130d9b4886f42),
+     W(0x000474519a7fe4cd), W(0x0006c289e1a46402)},
+    {W(0x000256b3bda68141), W(0x0007aba6578fc4d7), W(0x000728e43317449f),
+     W(0x0007e266477041c7), W(0x0002fde05bda0b2f)},
+    {W(0x0000000000000001)},
+    {W(0x0004e1da262769ff), W(0x0002265d60552ed9), W(0x00047212d99939d7),
+     W(0x00043df24a3cbab0), W(0x0002e7c6cd844755)}
+  },
+  {
+    {W(0x0000ca20dcaac44d), W(0x0001639dd42b790e), W(0x0004608a2e6ff38b),
+     W(0x00031f11ba1b3218), W(0x0003f2d617357cf9)},
+    {W(0x00069ee592db9e6b), W(0x000359183a98d26b), W(0x0000acabc1659a11),
+     W(0x0002466bc79e998e), W(0x000218cf3a58c83e)},
+    {W(0x0000000000000001)},
+    {W(0x000741cce75bc32b), W(0x00078c97aa883d91), W(0x0005f75a466e2d5c),
+     W(0x000502472b721d4a), W(0x00034ee7d609b737)}
+  },
+  {
+    {W(0x000022ab7aff4ce8), W(0x00031b3b80fdb32b), W(0x0001ca004a5660b3),
+     W(0x00034ecacaa8c97c), W(0x00046c427aceb6ed)},
+    {W(0x0005a56851ca0850), W(0x00007c93b723b4d8), W(0x000313ec1dc25f93),
+     W(0x0000de6b838dbb6d), W(0x00016177f3315fd5)},
+    {W(0x0000000000000001)},
+    {W(0x0002962be4f704bd), W(0x00066893d1def91b), W(0x0007274bc3dd1521),
+     W(0x00015b569ed0718d), W(0x00046720148e36b8)}
+  },
+  {
+    {W(0x000044e2cd379252), W(0x00078506ac635649), W(0x0004eeed9b6b5a7a),
+     W(0x000747e8d1dd3050), W(0x00010135d3c155f4)},
+    {W(0x000661b75cf0db56), W(0x0007025084611070), W(0x00000395bd920d6f),
+     W(0x00014fad8c0f64f3), W(0x000521b9718a2dd1)},
+    {W(0x0000000000000001)},
+    {W(0x00019d49d686634e), W(0x0007d6ae7d248ab1), W(0x0003179a32792541),
+     W(0x00019c1ce60e17b0), W(0x000372599ec1f4c6)}
+  },
+  {
+    {W(0x0002711280be7259), W(0x0007431a40b10a6c), W(0x00044cb27fed7e36),
+     W(0x0003a490a118f36d), W(0x0005102ee4455c40)},
+    {W(0x00029771602c1a3b), W(0x00049a4c420ab1b2), W(0x0004390127941cd1),
+     W(0x00011365259917f2), W(0x00038f1a0e1940df)},
+    {W(0x0000000000000001)},
+    {W(0x0003c55855b60689), W(0x00034579701b8ed7), W(0x0004d76a4caf1b16),
+     W(0x00023aff0093f9f2), W(0x000534daed743e9a)}
+  },
+  {
+    {W(0x0007c5c8658cf248), W(0x000628570e8708a7), W(0x00032295f7868f24),
+     W(0x0004d12c66fe5b3b), W(0x0001ac8ac23c1d79)},
+    {W(0x000097e960ee3e67), W(0x0000433bf09ae2f3), W(0x0006703a675a0513),
+     W(0x00000b203b8773e3), W(0x0000b315142874e5)},
+    {W(0x0000000000000001)},
+    {W(0x00023c0429241e26), W(0x00003cc92b305da8), W(0x000716686b15309a),
+     W(0x0005e09c38cd44dd), W(0x0003cb5967338025)}
+  },
+  {
+    {W(0x00053491fd271191), W(0x0000b0639351d548), W(0x0005faae76a4278a),
+     W(0x0005694c22423d10), W(0x000209a9281ee4dd)},
+    {W(0x000519998c586546), W(0x000606a684b4496e), W(0x00041e33d99c339d),
+     W(0x0002b23f18d3b907), W(0x0005ec36dd89cf70)},
+    {W(0x0000000000000001)},
+    {W(0x0001e041f6254423), W(0x00024630b971ee2c), W(0x0007a6e82e4f864f),
+     W(0x0001eba1b6fa9897), W(0x00055d0a89b789e1)}
+  },
+  {
+    {W(0x000040ec603380a5), W(0x000071aa758eaa2c), W(0x000533f3149f0e28),
+     W(0x0003f33657fecafb), W(0x0003486108600285)},
+    {W(0x000677f3ba781533), W(0x000401fefdee0a81), W(0x0001e7fbe99a04e1),
+     W(0x0000f90430830999), W(0x0002d19967964cb9)},
+    {W(0x0000000000000001)},
+    {W(0x00035ffef9aaf898), W(0x00033b6be3a87e09), W(0x00052c396118da27),
+     W(0x00048aa18c23a480), W(0x0004858d3665c232)}
+  },
+  {
+    {W(0x00065579bb6f3df6), W(0x0007f847277ad4ce), W(0x0001298e6d8527e8),
+     W(0x00023e53fb5b3383), W(0x0004f728faeb9ca1)},
+    {W(0x0007767ab41df75a), W(0x0002c76cb51f6103), W(0x00069c9569d4f12e),
+     W(0x000452cceaae3333), W(0x0004dfbcc801a49d)},
+    {W(0x0000000000000001)},
+    {W(0x000772ddcaed28b8), W(0x00034baea8e7b730), W(0x00025f27161846ae),
+     W(0x000512d73cd57579), W(0x000300f9fb705ce3)}
+  },
+  {
+    {W(0x0007bee032ec3992), W(0x0006a01d85e7e227), W(0x0003ad5b04144094),
+     W(0x0004b367a5038ce6), W(0x0001254fe80b8bc9)},
+    {W(0x0001ddc4cbae3c02), W(0x0002df7badeb1d74), W(0x00027e6f4a283bbb),
+     W(0x00049e5eaf223bbc), W(0x0001d1fe9b9626c8)},
+    {W(0x0000000000000001)},
+    {W(0x0006ce48d4a60407), W(0x0007ec3b1f738b7a), W(0x000106a23a9117d9),
+     W(0x0004909229107817), W(0x0007a01db94b5a90)}
+  },
+  {
+    {W(0x0000f0267b70aee4), W(0x000524ea1a5e2ae0), W(0x0007b0d0b25b09d3),
+     W(0x00050d6f3d879325), W(0x00014bb7ca2f1307)},
+    {W(0x0003267d2e1a2ae3), W(0x0007e8d9b904f11d), W(0x000179afe6e842d3),
+     W(0x0001f1c4d3cbefbd), W(0x00057328e3c79541)},
+    {W(0x0000000000000001)},
+    {W(0x000502c0881bb5f4), W(0x000629623e89bfac), W(0x0001bd0a586a1486),
+     W(0x00059d68ad529866), W(0x00060a39e6632d3e)}
+  },
+  {
+    {W(0x0002ad323974a0fd), W(0x0003740f108143fa), W(0x000323880e684dbc),
+     W(0x00043f465b6009bf), W(0x0001eb6cee3fa15e)},
+    {W(0x0007ccc21ef5a099), W(0x0007f8a68c3989f3), W(0x00007b34ba5fe1c2),
+     W(0x0002c16344a3e5e3), W(0x0001b70e4ef91f9b)},
+    {W(0x0000000000000001)},
+    {W(0x00067d6b351a0cfa), W(0x0006afde5466edd8), W(0x000561788937074f),
+     W(0x0001c5998b0c4465), W(0x00025ee8fac0a598)}
+  },
+  {
+    {W(0x00059b09e76e6757), W(0x0003d5ef0b0755b9), W(0x00079065dbb2a56f),
+     W(0x0005712e7b42d8af), W(0x00078b32ebebc865)},
+    {W(0x0004e6775041aa9a), W(0x000179d847573cee), W(0x000132b402d805ef),
+     W(0x00010811a34fb63a), W(0x0001f3d7c35e6015)},
+    {W(0x0000000000000001)},
+    {W(0x0002a9220e5ccacf), W(0x0004efc5d5d6118d), W(0x00077c699b07ac3d),
+     W(0x00065601e65f1be6), W(0x000387e852a6c8cf)}
+  },
+  {
+    {W(0x0006cc333cb39375), W(0x000567021659e7cd), W(0x000133ff49005c22),
+     W(0x000288a1fc5920cd), W(0x00069aa4285fb459)},
+    {W(0x0007ddfd4005581d), W(0x0004482afd55e22c), W(0x000503caf4ed1246),
+     W(0x00005e3112d9bafa), W(0x0001ae53b7c42fb5)},
+    {W(0x0000000000000001)},
+    {W(0x000068b9a647a6ef), W(0x000642e6d544febd), W(0x0003f0d5a2045aee),
+     W(0x0001fbc47ee6fada), W(0x00037e01f295c9bc)}
+  },
+  {
+    {W(0x0007f0d60cf8e925), W(0x0002b827a45ef9d0), W(0x000309602e611eb5),
+     W(0x0006e870fef16ce7), W(0x0006b1de2d617077)},
+    {W(0x00036dab22e2fa88), W(0x0006ac2c9627b236), W(0x00073a92a05ca393),
+     W(0x0001d4874171b35d), W(0x000744a9109964e5)},
+    {W(0x0000000000000001)},
+    {W(0x0007c976d54deac8), W(0x000696afb6c20f0b), W(0x00046d5a6762c307),
+     W(0x0003d4c5db0c306b), W(0x00074b0f64fd8626)}
+  },
+  {
+    {W(0x00005cbe91f85b04), W(0x00071182e3e3d013), W(0x000227203da39095),
+     W(0x0001b00bdbc5443a), W(0x00013343db20e0cc)},
+    {W(0x0007d83b7c4b7547), W(0x0003e8470b34aa3e), W(0x0003987fb550d68d),
+     W(0x0007426edfcc8c82), W(0x000305d5dd7aff53)},
+    {W(0x0000000000000001)},
+    {W(0x0003936392090d32), W(0x00015cadce2daf36), W(0x0006d31d5eef8b13),
+     W(0x0005c89672bc6c1f), W(0x000352a2f01c805e)}
+  },
+  {
+    {W(0x000235140781fa2b), W(0x00057a93eacbde6b), W(0x00063a9e7b14a1a7),
+     W(0x0007ae796a4e2bc7), W(0x00005c98760e8aa9)},
+    {W(0x00016addb20c0ac6), W(0x00062b797b1fe989), W(0x000788ecdddcbf8f),
+     W(0x0006ec2c59c54469), W(0x0005f500b3ca13f9)},
+    {W(0x0000000000000001)},
+    {W(0x0004ba2d34abe8e7), W(0x000660f27968b47e), W(0x0004e483bcfc1136),
+     W(0x0002aac4e64c0d8c), W(0x00040dd54e5fd62f)}
+  },
+  {
+    {W(0x00020636eb559096), W(0x0006c048fe408dd9), W(0x00011b15bcce2579),
+     W(0x0003378516b5de09), W(0x00009369cef8ced7)},
+    {W(0x0006d19bc5f9b291), W(0x0001f8b1ac188ca2), W(0x0007736b62488f25),
+     W(0x000019f493ebd214), W(0x0002e593210101ec)},
+    {W(0x0000000000000001)},
+    {W(0x0000c53fbc450bd5), W(0x00029e957e89d18e), W(0x00075a9214326f78),
+     W(0x000617963d2f805e), W(0x00054f559c02fb6c)}
+  },
+  {
+    {W(0x0001c906ccce202c), W(0x0003d94044e9e12d), W(0x0007f521534cd840),
+     W(0x0003349a30c26456), W(0x00062cddbe2c489f)},
+    {W(0x00068289b2bcebc6), W(0x0007692509164cc4), W(0x00079497988aabbd),
+     W(0x0002a2a692cab0f6), W(0x00027f3b2a72bd11)},
+    {W(0x0000000000000001)},
+    {W(0x0000401f45d52c5e), W(0x00014c7d8102a1da), W(0x0002c4d53d93b6bf),
+     W(0x0000a21c96eeabaa), W(0x0002256b144a6337)}
+  },
+  {
+    {W(0x0007dbf230ed619d), W(0x000040553931113a), W(0x00038b1d22f34228),
+     W(0x0007a09beccaddd6), W(0x00079db8d361ad46)},
+    {W(0x00034b83d2edf77a), W(0x0005a2379e782732), W(0x00034d38902e4fa1),
+     W(0x00015afc459ed013), W(0x0006902743d0f4e5)},
+    {W(0x0000000000000001)},
+    {W(0x0003dc7a4620906b), W(0x0005d91f62204b34), W(0x0004f3c1c6754ec3),
+     W(0x00038224d75d456b), W(0x0003519d62a96721)}
+  },
+  {
+    {W(0x0006a7c5adf68a65), W(0x0003a6e31ce4dbee), W(0x00036b3777a53115),
+     W(0x0000697fc55754d5), W(0x00065d642b00bb66)},
+    {W(0x0002fe9aced57501), W(0x0006ffeb7d72db7e), W(0x00058cf3a038347a),
+     W(0x0007166b1a90a2d4), W(0x0005dd6a994a52e8)},
+    {W(0x0000000000000001)},
+    {W(0x00057eb6478d9dab), W(0x00013128f6c2a219), W(0x0000782e2f4ab0f5),
+     W(0x0007aa2de5d3f5f7), W(0x00019cd43ab55a07)}
+  },
+  {
+    {W(0x00071ffed84f4f54), W(0x000123c114bb22a7), W(0x000155be381eb3ed),
+     W(0x0005948d079a2c9a), W(0x0001f7bba9076b4b)},
+    {W(0x00070b7a2b729e32), W(0x00078385daf2cd22), W(0x00076e81e577dcbf),
+     W(0x00026124bd4f42aa), W(0x00043ec3b2d420bc)},
+    {W(0x0000000000000001)},
+    {W(0x0000107779f7179b), W(0x0000fa834404bc85), W(0x0006cb44d9687d9f),
+     W(0x000111e1bb0b7bfb), W(0x00008010abf43671)}
+  },
+  {
+    {W(0x00065d9e747c3b73), W(0x000521d98e663a27), W(0x0007c6e3167f7828),
+     W(0x00058a548e47e6ed), W(0x00029830057cdf1e)},
+    {W(0x0007001ba0d88c0e), W(0x0000c789edb71b2e), W(0x000118c99738af90),
+     W(0x000135da14cbf3ac), W(0x0002636fc1ea36e6)},
+    {W(0x0000000000000001)},
+    {W(0x0006d16205b84c9c), W(0x000612722921e2df), W(0x0001427ea3afe74a),
+     W(0x00019b59f79b8627), W(0x00019eceaa81545e)}
+  },
+  {
+    {W(0x0006c0e67b8fe03e), W(0x000287c02db1c2c5), W(0x0006b9c15f05870c),
+     W(0x0004204082cf74de), W(0x0007d9f4827d7379)},
+    {W(0x00005580052c7eb6), W(0x0001f52a0d228221), W(0x000570590814f515),
+     W(0x000610728741a349), W(0x0004b67e34af0f88)},
+    {W(0x0000000000000001)},
+    {W(0x0004ac601658e0d9), W(0x0006c551dce9b594), W(0x00050e097e5da749),
+     W(0x00061b95decce1b6), W(0x0001c41cabe756be)}
+  },
+  {
+    {W(0x000628814239bdae), W(0x0006042454f99139), W(0x0004ee02fa449fb2),
+     W(0x0004a32066004b7e), W(0x00022412f5b9b348)},
+    {W(0x0005188bf936c6cb), W(0x0006e4e7ae847f94), W(0x0006ad21d18bb830),
+     W(0x0005f127e885762c), W(0x000445d1a0e813c0)},
+    {W(0x0000000000000001)},
+    {W(0x0003a1fc8e24b6b8), W(0x0004615110592e67), W(0x0005e969eaf46e02),
+     W(0x0002e3636c6592b8), W(0x0003cd1c589f4ac2)}
+  },
+  {
+    {W(0x000176eae392c34d), W(0x000722599e9b267f), W(0x0003718ef6d36804),
+     W(0x000617c90c1a52bd), W(0x0002cc084f9206f7)},
+    {W(0x0000b1c30d7a8165), W(0x00022c2f2793e67c), W(0x000421c5546f6fa4),
+     W(0x0004292d0481aea4), W(0x00016420684ab6d7)},
+    {W(0x0000000000000001)},
+    {W(0x00043db10692c60c), W(0x0003f565e5bece98), W(0x0005120f62d831d2),
+     W(0x00015ad358480455), W(0x0006db2e4194af02)}
+  },
+  {
+    {W(0x0002086c2ae3cb84), W(0x0001b92a92c21bed), W(0x0005e2ce2a1e93ac),
+     W(0x0005ec6e06aa51b0), W(0x00016446f0a72776)},
+    {W(0x0006638da5dca11c), W(0x000439c073b6d0d1), W(0x0007f4b36fdaa7e3),
+     W(0x0006be9323773f3a), W(0x000580de994cc4a5)},
+    {W(0x0000000000000001)},
+    {W(0x000385d0fbaab9a3), W(0x0002e3e30c98e4b8), W(0x0002386f4368cb18),
+     W(0x00020305b3a354be), W(0x0007b9281610268b)}
+  },
+  {
+    {W(0x0002768736750a20), W(0x0002ff964efee432), W(0x0007362203c59640),
+     W(0x00068bfcbadf3678), W(0x00052af1743b86e3)},
+    {W(0x0001b7d551feb797), W(0x0002b640494514fd), W(0x0005921eafef8852),
+     W(0x0002d2814505fedb), W(0x000477d58d8a7d9a)},
+    {W(0x0000000000000001)},
+    {W(0x00067b4614dfc7e0), W(0x0002118e3b23b0a3), W(0x00062bddbffa1e03),
+     W(0x00025c59e3972bcb), W(0x0004db104326d79f)}
+  },
+  {
+    {W(0x00075186db5286bf), W(0x00016be839cb46bd), W(0x0005d9f2ca1afdb5),
+     W(0x0005a09aedf671f5), W(0x0003e5ce21e7da3a)},
+    {W(0x0001459a52a06562), W(0x00066aafd96ac85b), W(0x00037167c5d886ce),
+     W(0x0004739a2d60553f), W(0x000523029705df5c)},
+    {W(0x0000000000000001)},
+    {W(0x0004c9285582fa10), W(0x0007d649655b52a5), W(0x0006e824b55473e0),
+     W(0x0003c2a2ccc6a2f0), W(0x00008c9022f7e6ad)}
+  },
+  {
+    {W(0x000500d4fa675b14), W(0x00054fb4216a58e7), W(0x0000f3e4a234fa42),
+     W(0x0006f065b6443b30), W(0x00049960d6223d87)},
+    {W(0x0006681d1120194d), W(0x00063a62dc14c87e), W(0x0004f9efae2721fc),
+     W(0x0000a67a3b7e0ea2), W(0x0004c09260311ad1)},
+    {W(0x0000000000000001)},
+    {W(0x0007c90301ef2a24), W(0x000684cbcb2a0190), W(0x0005392f848bd9d3),
+     W(0x000357453c115def), W(0x000200cab3786067)}
+  },
+  {
+    {W(0x0007147ef0c7e6bb), W(0x0003b2e8c9082bb8), W(0x00045dcac03ffbf6),
+     W(0x0000308fdaee52e2), W(0x0007075911872b68)},
+    {W(0x0000032115a1f120), W(0x0001efebc1b81eba), W(0x0005d93143daaee1),
+     W(0x0006e72f37ef007e), W(0x00023b6f7b92b3e7)},
+    {W(0x0000000000000001)},
+    {W(0x0002dfd269e84280), W(0x000414a1acd25c63), W(0x0003d5a4c1f7a258),
+     W(0x0005de5efb5d0e26), W(0x0004d6aa246bd2a2)}
+  },
+  {
+    {W(0x0000e41fb81d70ee), W(0x000324ca03100ac4), W(0x0007f3eba0ededc8),
+     W(0x0000271ea108625f), W(0x0006a5c1244a1509)},
+    {W(0x000117dc0d8852aa), W(0x0003eab435c87013), W(0x0000c7182488fbeb),
+     W(0x00015f1d45572587), W(0x0007a1f791b9e0fe)},
+    {W(0x0000000000000001)},
+    {W(0x000773a06b9ba193), W(0x0004e2b16e767eee), W(0x0001d5a963c3816b),
+     W(0x000122fc08e2eeb4), W(0x00059e5fbad7ea8d)}
+  },
+  {
+    {W(0x0006170b666f55c5), W(0x000355a2078a849a), W(0x00061bb98eb121da),
+     W(0x0005ca26f1b1e45e), W(0x00051aff4505befc)},
+    {W(0x00028f178a444b93), W(0x000176f8fe0bbfe8), W(0x0002d66f6b0038a3),
+     W(0x00036893ddbfd5c7), W(0x0004db47927f30da)},
+    {W(0x0000000000000001)},
+    {W(0x0003bf328e27a39e), W(0x00055078804d5ef0), W(0x0005e2a2d21e881a),
+     W(0x0004ec7e04a26572), W(0x0006dad1c8f25bc7)}
+  },
+  {
+    {W(0x000023fa59b03b29), W(0x0005196449b30801), W(0x0003e3c368913a20),
+     W(0x0003204fbdd7d2e7), W(0x00056e5275b97779)},
+    {W(0x0003ec77a5626252), W(0x0004fb6b2fae1f4e), W(0x00032b6d4b2989b2),
+     W(0x00049e05df8d3f46), W(0x0004aa592efb59e7)},
+    {W(0x0000000000000001)},
+    {W(0x0005b3f55f0aa81f), W(0x000134253e95e48a), W(0x000355cef316b406),
+     W(0x0004a6dca0c4f93c), W(0x0005d28bececef71)}
+  },
+  {
+    {W(0x0007e9b06cb30fed), W(0x000766bd35c3b58d), W(0x00012d4f2f86a7a5),
+     W(0x0003d95e97575554), W(0x00058d86a25d240c)},
+    {W(0x00030c3a255002db), W(0x0003b4b0f589a5fc), W(0x0002701c6d87f61a),
+     W(0x00028ca70adf2868), W(0x000054cdd4d77fc8)},
+    {W(0x0000000000000001)},
+    {W(0x0001ea924f8b4479), W(0x0000768082f684fc), W(0x0001ce065e510ecb),
+     W(0x00001e0dd01cf497), W(0x000592aebfbbb253)}
+  },
+  {
+    {W(0x0002475096ccfb98), W(0x0005abc78bc48578), W(0x000028b5c1e94d1c),
+     W(0x0000da445663ec47), W(0x00068b4b787a3249)},
+    {W(0x00047514ee6b1ad1), W(0x0000c165abe725a5), W(0x00005edb4918c171),
+     W(0x0003f5b1eb09fbdd), W(0x0002f783cffcb85e)},
+    {W(0x0000000000000001)},
+    {W(0x0006ae603c153560), W(0x0004e563fb9c9005), W(0x0006d3c0d850dabe),
+     W(0x00028782aab2985b), W(0x0000aad7006a077b)}
+  },
+  {
+    {W(0x00017a4fa1d00c55), W(0x000501376592534e), W(0x0003c1e824b9da8e),
+     W(0x00057d9865045aa1), W(0x000291cc4f6b8975)},
+    {W(0x0000f1dc24152c9f), W(0x00030aebc64d6c75), W(0x0006e58f3cda40fe),
+     W(0x0003ee9c0f6ed3b6), W(0x0006250b9415ce13)},
+    {W(0x0000000000000001)},
+    {W(0x00067ec6ff1d7082), W(0x0007a018675bcb02), W(0x0004f2cbe90ecd42),
+     W(0x0004a678f62bec1a), W(0x00070962b558e660)}
+  },
+  {
+    {W(0x0006c73a402db127), W(0x00077f59c0ff60b3), W(0x0002ce36a2b37313),
+     W(0x0003933f432b496b), W(0x0000e39aca3dd3ff)},
+    {W(0x00073817155a64bd), W(0x0002de09d219fac8), W(0x0004d8f57ed90a03),
+     W(0x0006dafa5c5cb863), W(0x0007f35c75ad87d1)},
+    {W(0x0000000000000001)},
+    {W(0x0002e95576e1d1ba), W(0x0003cea527eac0a2), W(0x0001a21606ff6082),
+     W(0x00070cb3a4e667d8), W(0x00032395c563865f)}
+  },
+  {
+    {W(0x00069eab69091a30), W(0x0005ae5216b24b09), W(0x00068cc05784e97c),
+     W(0x00021a1c6d3228f9), W(0x0007eeb84fee4830)},
+    {W(0x00028cedb4d209d7), W(0x000223d988b36528), W(0x0000c04d99a95957),
+     W(0x00024d1c7259f1d7), W(0x0002f07ff406b58e)},
+    {W(0x0000000000000001)},
+    {W(0x0004f0673cf4ec61), W(0x00012e08d292851d), W(0x0003502521232883),
+     W(0x0004d5ed405f5ff7), W(0x0006d213d8967edf)}
+  },
+  {
+    {W(0x0007af0d2b986050), W(0x000504251649c915), W(0x0002421336d1ae2c),
+     W(0x0007d62895acc858), W(0x0004f6bf06b632af)},
+    {W(0x00076a3818b5a659), W(0x0000f9ef222e8293), W(0x0007c37b2152650f),
+     W(0x0002af2708023016), W(0x0005021650e557c6)},
+    {W(0x0000000000000001)},
+    {W(0x0007d6c9bbe97e79), W(0x0004c9886841929c), W(0x0005f2748a1d90a2),
+     W(0x000510a37365dc35), W(0x000683d88f4e6e5f)}
+  },
+  {
+    {W(0x000687876c11a7e5), W(0x00002958010aae2c), W(0x000613d427d7a65f),
+     W(0x0004cac414b2c7af), W(0x00056ce4f996ff9b)},
+    {W(0x000454640e129109), W(0x0004691337baa860), W(0x00069de274cb8b9d),
+     W(0x0005e8c87f677508), W(0x0007dcee12d62c98)},
+    {W(0x0000000000000001)},
+    {W(0x0005febbbcae58a3), W(0x0001f5c09055ec97), W(0x0000eb0e2b0bde9e),
+     W(0x0006248d78ae65f3), W(0x000433e1aff4efbe)}
+  },
+  {
+    {W(0x0000b5b19129431f), W(0x0006c244770ba2b5), W(0x00038a792aa1a0e2),
+     W(0x00065141f38ae7b7), W(0x0003883ba700ba2b)},
+    {W(0x0006ed4a6c9f272c), W(0x0007c8d24bc4ef70), W(0x00030c3bce2badae),
+     W(0x0006178df9107cec), W(0x000213b1dbb4688b)},
+    {W(0x0000000000000001)},
+    {W(0x0003c2d30e2e980c), W(0x00076b2353fcb0d1), W(0x0001413775c83c0e),
+     W(0x0001d41d9a06947b), W(0x00029580e03cbdfd)}
+  },
+  {
+    {W(0x0005b885c44fd4e5), W(0x00013cc916a3d8cc), W(0x00027f1b5b777f98),
+     W(0x000658bc6c4767ca), W(0x0007833d5b192b75)},
+    {W(0x0001cd45944b5e93), W(0x000717668c565f1c), W(0x0004e5107251b835),
+     W(0x0000a4c3b51904d2), W(0x00013a4100a27c27)},
+    {W(0x0000000000000001)},
+    {W(0x0001b794313e2cdb), W(0x0002dc097f6302d4), W(0x000002c28b3c1d7a),
+     W(0x000204d682d898b0), W(0x0000e295d60d4563)}
+  },
+  {
+    {W(0x00027ca22ba0636b), W(0x0005efc91bf80eb1), W(0x000360693fcf6379),
+     W(0x0002902a6e0e2dd3), W(0x000474ef17c5df56)},
+    {W(0x00024a61d4bcd666), W(0x0005f42c427b0cc9), W(0x0004adfb6452d427),
+     W(0x00022df1340a1b03), W(0x0000a6fd84785d6c)},
+    {W(0x0000000000000001)},
+    {W(0x0001f10742d81c32), W(0x00015383aaa059fd), W(0x00024647d2348e54),
+     W(0x0004261bff363548), W(0x00069568daa58651)}
+  },
+  {
+    {W(0x0002efef11c361b4), W(0x0007b50db5a788f5), W(0x0004b7d038e4bcd5),
+     W(0x000549a6226d3f63), W(0x000681cc67835f29)},
+    {W(0x00072dfcff9050be), W(0x0004fa45a96d434a), W(0x0006a00e06905b1a),
+     W(0x0006c3fe9792ba56), W(0x0006ae7ff27fbf6f)},
+    {W(0x0000000000000001)},
+    {W(0x000467f5f182f01d), W(0x00037888ae500988), W(0x00045f87e76c7571),
+     W(0x00048e5782d248f1), W(0x00033b697470c8aa)}
+  },
+  {
+    {W(0x00009d22f0987342), W(0x0005d35f01a13d02), W(0x0005d5d638ceaf82),
+     W(0x00051c7915342fae), W(0x00023a9aaa560722)},
+    {W(0x0007c3baf4145003), W(0x0003290cc69b3620), W(0x0006e6169d196686),
+     W(0x00060d2a7403f3df), W(0x0007f35394e0ad8d)},
+    {W(0x0000000000000001)},
+    {W(0x00016ab636ec0018), W(0x0000dfe5085dd111), W(0x0003632637a20785),
+     W(0x0002e339be079f4c), W(0x0005721eab4baf4e)}
+  },
+  {
+    {W(0x0006fe8d7cfdad34), W(0x00024201605b7c73), W(0x0003326decbcee3b),
+     W(0x000679681af5c35a), W(0x00038f0da841b2a6)},
+    {W(0x0005cad4b79f7958), W(0x0001a6a710eefa8c), W(0x0002281ca98ee528),
+     W(0x0003c4bf4f2a1cb5), W(0x00007bf151a32e59)},
+    {W(0x0000000000000001)},
+    {W(0x000000d5d1dd2092), W(0x0007d1c4daab3c2c), W(0x0000b114b3f6f2bd),
+     W(0x0007b94ddb73b580), W(0x0006bcc97cf15a3e)}
+  },
+  {
+    {W(0x0001fab30c27774b), W(0x00061685bbe55f67), W(0x000218868d595612),
+     W(0x00020e2c70774f23), W(0x00005a4bcc20a6da)},
+    {W(0x0006f8e62b2e31f9), W(0x0005f77ebf5d7940), W(0x00064ed09c9f0aed),
+     W(0x0007f48cc42cf920), W(0x000314f97dd80045)},
+    {W(0x0000000000000001)},
+    {W(0x0006afee8c463b02), W(0x00001156c1933ae8), W(0x0004428ab7dc0777),
+     W(0x000473eb8b7e35f7), W(0x00012d82e6c2eec9)}
+  },
+  {
+    {W(0x0001d6fd413283d5), W(0x00058656bac1943d), W(0x00028d3f4f0db9c0),
+     W(0x0000744802ca3a54), W(0x00002df6760144b4)},
+    {W(0x0004b11adb12328f), W(0x0002341180108fd8), W(0x0001c305748382b0),
+     W(0x0003a5fd4fbbaa58), W(0x0007f395267bb23f)},
+    {W(0x0000000000000001)},
+    {W(0x00036121ccd28044), W(0x000729ed6c2046ac), W(0x0006067db06c1859),
+     W(0x00042ca2b81be7df), W(0x0004e449d1944e41)}
+  },
+  {
+    {W(0x0005cf483896297c), W(0x0002b4716b772345), W(0x0007a254485f7986),
+     W(0x0006856db9213f39), W(0x000436eab769ceb9)},
+    {W(0x00011c634ec00662), W(0x00002fbe55f71f0c), W(0x00002aa4e7cc88ae),
+     W(0x00074c1eca5f7ea8), W(0x0007cf74a7399df1)},
+    {W(0x0000000000000001)},
+    {W(0x0007016a9342dec3), W(0x00052f8edf0d0eb6), W(0x00026806dad82590),
+     W(0x0005fd63a5d66734), W(0x00054414ae1e1393)}
+  },
+  {
+    {W(0x00078c0b29560f48), W(0x000348648e07205c), W(0x0005213168517d3c),
+     W(0x0001b6af0fe6c357), W(0x00012051e9fce5f8)},
+    {W(0x0002b3d77408a446), W(0x00060c02b1d76179), W(0x000752489d86a376),
+     W(0x0001c6307bd7e025), W(0x0000f407d0434019)},
+    {W(0x0000000000000001)},
+    {W(0x000408361f48fc63), W(0x0000b3ecbffc7a3e), W(0x00067fb57681f0cb),
+     W(0x00039264e8396380), W(0x00050b909e1f7b74)}
+  },
+  {
+    {W(0x000620c0b239285c), W(0x0005ddb3b0df3c49), W(0x0003f5dd2a499d7e),
+     W(0x00073111eb4e80fc), W(0x0002271b9bbda630)},
+    {W(0x0003e08222473161), W(0x00053cbcc773b9c2), W(0x0001364a43fe4f32),
+     W(0x0006afd4a29dfc24), W(0x000253ed8aa1d2eb)},
+    {W(0x0000000000000001)},
+    {W(0x0005261ba4820bd0), W(0x0000d104ca3e0acc), W(0x00008f12a83548c3),
+     W(0x00012bbbd682e4a1), W(0x0002f6e8816f9c47)}
+  },
+  {
+    {W(0x00016bc0df69514d), W(0x00009f40fcd31b28), W(0x0004f87a406c3607),
+     W(0x00050809846c36df), W(0x000635c9b1ed13d2)},
+    {W(0x00069dedb64983a8), W(0x00015f3160e2264e), W(0x000023ba4be55dd7),
+     W(0x0001446a5a83b27a), W(0x00053e499170b097)},
+    {W(0x0000000000000001)},
+    {W(0x0003cee9779a1d58), W(0x0002968d09702386), W(0x0003994f891ffe8e),
+     W(0x00064033cae65933), W(0x0003ae5d79d5b7a2)}
+  },
+  {
+    {W(0x0006a82dc55c4700), W(0x0007fb22646a03a9), W(0x00001c475989639b),
+     W(0x00066169674db0fd), W(0x00073d7aae51b0f1)},
+    {W(0x0000f858d6f0b46b), W(0x000648b4dedb3089), W(0x00049cbffa112154),
+     W(0x000160270377a15f), W(0x00022a58bd3fd226)},
+    {W(0x0000000000000001)},
+    {W(0x0006e21c6179d89f), W(0x0007c5a74af848ad), W(0x00039dcc46ef4f2e),
+     W(0x0003f8a99f7100b3), W(0x0007b10bf2ce6e1a)}
+  },
+  {
+    {W(0x0003ee6c88a9c5d1), W(0x0007e4f751a7a505), W(0x0003a955c2e23240),
+     W(0x0000171e0ab1a9f1), W(0x0006222ac763ea4a)},
+    {W(0x00037e409514dfab), W(0x00041573e4f1b1f7), W(0x000138f7e5e2357b),
+     W(0x0007d5b80b45ddf9), W(0x0002fc639678c458)},
+    {W(0x0000000000000001)},
+    {W(0x000409c499250122), W(0x0004ffd30c234ca4), W(0x0001cbd88bb24e8e),
+     W(0x0006df4aa68cbe66), W(0x0005c2329de1fa91)}
+  },
+  {
+    {W(0x0004be36539250d2), W(0x00058f01f305977a), W(0x0003f63b31358468),
+     W(0x00075e25b51e9353), W(0x0000c937e44df313)},
+    {W(0x0004d039c2306828), W(0x0007d93db5e0b323), W(0x0006b72dbf66bc15),
+     W(0x00054c956548ded7), W(0x0003badafed6119e)},
+    {W(0x0000000000000001)},
+    {W(0x0003c7d49a28144c), W(0x00000b3d45d6dafc), W(0x0005619ce48e2bb0),
+     W(0x00065e7dfad7e042), W(0x000176bd38862905)}
+  },
+  {
+    {W(0x000165dfb63e8875), W(0x00049e503687e05e), W(0x000422edc2226ab5),
+     W(0x0002fa4e2a290216), W(0x0000cbc83d380b73)},
+    {W(0x0006c427e9d13c88), W(0x0000852fd707f9bf), W(0x000425a8355cc2ca),
+     W(0x0002f26bd8443e7c), W(0x0006ec90d255d846)},
+    {W(0x0000000000000001)},
+    {W(0x0003456ba4d554b4), W(0x0003f67cf4ee37d2), W(0x00012e0f7497abb9),
+     W(0x00062eda4fabe75a), W(0x0000ac4c1e4a3476)}
+  },
+  {
+    {W(0x000123de4ec4d1cf), W(0x0000cdd190df220f), W(0x0001eeb719fc8566),
+     W(0x0005e4fc38329ab0), W(0x000421d88d9628b1)},
+    {W(0x000512debe0febe0), W(0x00015b52e40b62be), W(0x0000e23641133b96),
+     W(0x0005b0e7c3b170ba), W(0x0006377757c12773)},
+    {W(0x0000000000000001)},
+    {W(0x000282510f8ff62e), W(0x0002f22599d90084), W(0x0007a61ab1ba2344),
+     W(0x000644a243a222c9), W(0x0004e87a55ea4d4c)}
+  },
+  {
+    {W(0x0002e1f53a80b348), W(0x0003181890937712), W(0x0004d48223a4f625),
+     W(0x000774360894fdfe), W(0x00061433cfdbd3ba)},
+    {W(0x00015e50029d1022), W(0x00042897c6b35e72), W(0x00033f9bef3914f2),
+     W(0x000043e990dceef4), W(0x0003dbd49aa3d051)},
+    {W(0x0000000000000001)},
+    {W(0x000094fef3aa1429), W(0x000318ae01bc2605), W(0x00052d89a64aa002),
+     W(0x0002b5e0c05233da), W(0x000472524c6944d5)}
+  },
+  {
+    {W(0x0002479c3499451b), W(0x0000ae5255043521), W(0x00057aa564841261),
+     W(0x0000d4bdbcf22571), W(0x000462f746a5dce6)},
+    {W(0x0005ab271cd0305e), W(0x0000c93a365e0d6b), W(0x00036bd9db2e4122),
+     W(0x000233417798cb91), W(0x0004b60305fc76bf)},
+    {W(0x0000000000000001)},
+    {W(0x0007dfc90ed0e08a), W(0x00045253082aff42), W(0x00021ec9cced034b),
+     W(0x0005bfee1de0bc21), W(0x00010c74b0da0890)}
+  },
+  {
+    {W(0x000539056afe4c35), W(0x00050be969be28ab), W(0x0000515061541f76),
+     W(0x00013634330856be), W(0x0003236be915fe56)},
+    {W(0x0003c166394f99d0), W(0x00046ce7414239a3), W(0x000439ea3cb143fb),
+     W(0x000091029e6d20b1), W(0x0007c359817e89a8)},
+    {W(0x0000000000000001)},
+    {W(0x0006a5b0775d8bdc), W(0x000212639e2c6fea), W(0x0003c91d9766252d),
+     W(0x0004f4d93068b876), W(0x000084125e0d2062)}
+  },
+  {
+    {W(0x00013ee6c169a85c), W(0x0005bc66a19a1177), W(0x0001a81923e4461a),
+     W(0x0000801313cf4f02), W(0x0000c91974871d74)},
+    {W(0x00077d17bd27b730), W(0x00067e0e256c5eda), W(0x0007e1b42b942c30),
+     W(0x00049bea8ad41604), W(0x0000fbc963036298)},
+    {W(0x0000000000000001)},
+    {W(0x0002aa7ab5de95b0), W(0x0005cbd521ea1a01), W(0x0007febfbc4005f9),
+     W(0x0006ab9b1faac073), W(0x0004565c69999c1b)}
+  },
+  {
+    {W(0x0007d4abb470aed3), W(0x00009d41a8695a5c), W(0x0004967ea5919a6b),
+     W(0x0003223cc177020b), W(0x0002328943b564d4)},
+    {W(0x00053ef7668917cb), W(0x0003ca9579fdef59), W(0x00060aa0f13193d0),
+     W(0x0003553e6aac57ec), W(0x0004776061620e4b)},
+    {W(0x0000000000000001)},
+    {W(0x0000df757b7803d8), W(0x0005ee2652ffb766), W(0x0005e0e7227b9979),
+     W(0x00021978da652337), W(0x0005cc2db09022f2)}
+  },
+  {
+    {W(0x0006e74ad80417a6), W(0x0004cac4e9fc87ce), W(0x0001b73e6a8d41c1),
+     W(0x0004952b465262f6), W(0x0001425296bb84d0)},
+    {W(0x0006f3e825d140a5), W(0x0000f5c0f3f98914), W(0x0004560b2e83fa9a),
+     W(0x0007025915e1e52e), W(0x0004cd43b4e74ff6)},
+    {W(0x0000000000000001)},
+    {W(0x0005eb446a22e4fc), W(0x0006e68113d3c773), W(0x0004a178aa84221f),
+     W(0x000340ab06230432), W(0x00036887000666c8)}
+  },
+  {
+    {W(0x0005ffdeebc91f0c), W(0x0002799a6211c6a8), W(0x000199b05cb8847d),
+     W(0x00021a55b7c9706c), W(0x000466e94ff9b76d)},
+    {W(0x00064fa5f62ce6e5), W(0x0000362b8dcce8aa), W(0x00065f3506cc3190),
+     W(0x000642a8903675d8), W(0x00028647935c52cd)},
+    {W(0x0000000000000001)},
+    {W(0x00063c1e7a8a8223), W(0x00038b8e91e0bf46), W(0x0004e9996777bd61),
+     W(0x0000a49fd068db43), W(0x00066b154d88f799)}
+  },
+  {
+    {W(0x000636e9db032e35), W(0x000585fe0bb6baaa), W(0x0007e456c7c0b076),
+     W(0x000641ff1d71a1c2), W(0x000153c6502188a2)},
+    {W(0x0000aa1242ef8a80), W(0x00018ed94140b9e8), W(0x00021e51a21809c7),
+     W(0x00049a5e6a37bc9a), W(0x0000647caf8c4568)},
+    {W(0x0000000000000001)},
+    {W(0x000706bb6a85e01d), W(0x0007f751ca16b272), W(0x0000b9a3d21a8fe0),
+     W(0x0001b9ff91d627fe), W(0x000144b568468b48)}
+  },
+  {
+    {W(0x000018e659cb247a), W(0x0000d9c9c087c4b8), W(0x0000afa0e911a6ff),
+     W(0x0003171919e9509b), W(0x00056154c9ef883c)},
+    {W(0x00077385d97e52a6), W(0x0002816632749572), W(0x00044b7da4444207),
+     W(0x00054ee7756bca91), W(0x000344b730b93e50)},
+    {W(0x0000000000000001)},
+    {W(0x0007d3978891cbe6), W(0x0002bbd92158109d), W(0x00023ad5d19673c2),
+     W(0x00035ec2238663d6), W(0x0006aaa2844695e7)}
+  },
+  {
+    {W(0x0000dbc51a2ef8fc), W(0x00028d082c612cb9), W(0x00034040eaa1eb3b),
+     W(0x00006f7edc9a7665), W(0x0001e4339a9852d9)},
+    {W(0x0006ea3a4dcd974b), W(0x0007ca9676409b5f), W(0x00074d51a6db99ec),
+     W(0x0007052091f6e0e1), W(0x00055b6cce5a6b68)},
+    {W(0x0000000000000001)},
+    {W(0x000100e215414b2a), W(0x00059dcb48ae4e31), W(0x0005c62b72b825f9),
+     W(0x0002479d09876a9f), W(0x000285a1b6c2fe29)}
+  },
+  {
+    {W(0x00015dd01b58565c), W(0x0000045633c332ef), W(0x0007d2ff7fd05572),
+     W(0x0001bcbb45c670a8), W(0x0005c16b6be79f4b)},
+    {W(0x000169ef3ef34eab), W(0x00076fe7f3d3dcba), W(0x00024ec86bac03b5),
+     W(0x0001243cf6c7db56), W(0x00031f8528fe4abe)},
+    {W(0x0000000000000001)},
+    {W(0x00012a3390e85704), W(0x000201b355ac6a99), W(0x0006f04b572529cc),
+     W(0x000275c412cd28d4), W(0x0002bb2466600606)}
+  },
+  {
+    {W(0x0000a2a6b0e2716c), W(0x0006d2b2d7b07387), W(0x00050f5557abcf97),
+     W(0x0004cc8b8aae8879), W(0x000048406faca549)},
+    {W(0x00044eba10fbbf71), W(0x0005aca6ab18cd1a), W(0x000543f693107dd7),
+     W(0x00038f649690b544), W(0x00028e1cf0ea8355)},
+    {W(0x0000000000000001)},
+    {W(0x0001071ead548dd3), W(0x0005684a0c280298), W(0x00062f2ba2e89d1c),
+     W(0x0000e45a0f14b71f), W(0x000213951a9b05a1)}
+  },
+  {
+    {W(0x00043ebd1c40e53a), W(0x0000c61ef52075b0), W(0x0003ee3832c4bdb9),
+     W(0x0000020c61f706b3), W(0x0003b602a59f4731)},
+    {W(0x0001d229cbfebbd1), W(0x00029cda4bde32c2), W(0x000523b832539a5a),
+     W(0x000767f07ae3904b), W(0x00040101cf8e94f2)},
+    {W(0x0000000000000001)},
+    {W(0x0004acb4e4748fde), W(0x000393c468c82a9b), W(0x00075c9bfc0499c9),
+     W(0x0006b6fbb4e4dd36), W(0x0000449a5242936c)}
+  },
+  {
+    {W(0x00012a03235fc762), W(0x0002e4fdc7c00696), W(0x0000eea61dcafd21),
+     W(0x0001bc13480c67d2), W(0x00069d7fb81fdcba)},
+    {W(0x00019a30b46d9c1a), W(0x0003d87db1667b0c), W(0x000247e1a035617f),
+     W(0x0001d55ffb303b7b), W(0x0002e3b4262e2eea)},
+    {W(0x0000000000000001)},
+    {W(0x00017cf2e8d19180), W(0x000791c9aa80f068), W(0x0001ec755fff725e),
+     W(0x0003161fc3b663ad), W(0x00068c64c3e6fe94)}
+  },
+  {
+    {W(0x00050539bb2d7770), W(0x0006221c303f867b), W(0x00046fdce56be374),
+     W(0x0003cda7d884f5c2), W(0x0004194f28d8e8b3)},
+    {W(0x00079d0c4c93077a), W(0x00029b7ea54c6c01), W(0x0005d84f00b06e65),
+     W(0x0004fcc983ac4b56), W(0x0002b0e6ccbd7a16)},
+    {W(0x0000000000000001)},
+    {W(0x0007bf1648fa978e), W(0x000421b438e149d6), W(0x00048aab40463142),
+     W(0x00017d6071fd3f62), W(0x00067bac49f1eab3)}
+  },
+  {
+    {W(0x00051f2f26debb03), W(0x00007f387503015a), W(0x00069f18870b9118),
+     W(0x000579c0e745e63c), W(0x0002edf3c6add2ca)},
+    {W(0x0000b7cbae682184), W(0x000687a295b54044), W(0x00072b8b43385c23),
+     W(0x000380badf997683), W(0x0005b4f52b185efd)},
+    {W(0x0000000000000001)},
+    {W(0x000595fc34b9f80a), W(0x00037bca4748b806), W(0x0007be9e73b47878),
+     W(0x000205feb40e4b05), W(0x0007cbb24c495d03)}
+  },
+  {
+    {W(0x00016ba99f4a60eb), W(0x00075fd8368f97e9), W(0x0005957466c12306),
+     W(0x0003748205f872e5), W(0x0005e5625b1e1b9c)},
+    {W(0x0007747f4933fa19), W(0x000696b35f9c8fa5), W(0x000416abdd4928f0),
+     W(0x0007f68396870e2f), W(0x000269efe2f8e700)},
+    {W(0x0000000000000001)},
+    {W(0x0007afc36ca61046), W(0x0001059319098136), W(0x000094ae13de8d7f),
+     W(0x0004a94fd4649739), W(0x00018f61fa2f4ec5)}
+  },
+  {
+    {W(0x0007b99889755bfa), W(0x00057fc9a165b4c3), W(0x00055717d988f288),
+     W(0x0002bba3184e4f6e), W(0x00022751fc5891ee)},
+    {W(0x0003582a34b73cc7), W(0x0006b1846214a204), W(0x0001260e53a156fd),
+     W(0x00006dc4b09adee1), W(0x00078c914bbfa4a7)},
+    {W(0x0000000000000001)},
+    {W(0x0000386a41908fbd), W(0x0001c4c0e919da1b), W(0x0002b48b532c3729),
+     W(0x000232082157de1c), W(0x00004299aa81b89d)}
+  },
+  {
+    {W(0x000106772b943f10), W(0x0005da0af7f4e3d1), W(0x00020454ed97f543),
+     W(0x0006d395f0bb01b2), W(0x0007a74d95c26d27)},
+    {W(0x0003a3493c8def93), W(0x0001f9de6373f065), W(0x00054f5d6f901e19),
+     W(0x0002b0da47fbe055), W(0x000008f512473b4a)},
+    {W(0x0000000000000001)},
+    {W(0x0006ccbc1141dd0b), W(0x0001978735862096), W(0x000142499f8f9c4e),
+     W(0x0002d23cf357314e), W(0x00052f2f1f9bb8d4)}
+  },
+  {
+    {W(0x0002e127332b1c92), W(0x000217b3a81ecb7a), W(0x00065234b5a60e35),
+     W(0x00061afa12c78a56), W(0x00038f28eafc56f4)},
+    {W(0x00020c988aa92fc2), W(0x00032881beb4f17e), W(0x0000adf8934f683e),
+     W(0x00049f01b675f0b5), W(0x0004400f072bc182)},
+    {W(0x0000000000000001)},
+    {W(0x0006fad3fb3af96d), W(0x0004ba66f1a1d34c), W(0x0005c62ffbc19ce6),
+     W(0x000532ae78352ac7), W(0x0002d2c901504992)}
+  },
+  {
+    {W(0x0003d00327006389), W(0x0004f9d03aaf105d), W(0x0006126b5e6f9120),
+     W(0x0002bc431151552c), W(0x00046f592deb4474)},
+    {W(0x00033d3f91ac02df), W(0x00000f8dfbc984b6), W(0x00057db41b3c7bbe),
+     W(0x00018aa0d3fe4be3), W(0x00062d27311d92ab)},
+    {W(0x0000000000000001)},
+    {W(0x000524730bce61ef), W(0x0004d09d95079991), W(0x0004d8dce049564f),
+     W(0x00057c2092a8aac4), W(0x00039a2944cafdf2)}
+  },
+  {
+    {W(0x0002beda2d7ff3a4), W(0x00077800e4c4985e), W(0x0003308e7491a5a7),
+     W(0x00071cbc7b55efac), W(0x00044827a470a03f)},
+    {W(0x00045d58121002d4), W(0x000724bcff6b8201), W(0x000012e29c5974ab),
+     W(0x00054981ee4308e7), W(0x0007e3a65c92762a)},
+    {W(0x0000000000000001)},
+    {W(0x0004951c5586aa13), W(0x000328a77ab96575), W(0x00077a6155a3d83d),
+     W(0x0002f14512c5528e), W(0x00053fbc015e10fa)}
+  },
+  {
+    {W(0x0003b78cbb8fde80), W(0x0007759dbf08e45d), W(0x000707ab5908d1ca),
+     W(0x0000d702739a2105), W(0x0005e0847f63a93a)},
+    {W(0x000142c3efa1782d), W(0x000452249f004cdf), W(0x000216be65bd258e),
+     W(0x0001de55f061b342), W(0x000238cfa790ec98)},
+    {W(0x0000000000000001)},
+    {W(0x00054960b076e78d), W(0x0006721dd01ac43b), W(0x000630394eeab3ba),
+     W(0x0000b9d0c18cd182), W(0x000770708f545e7d)}
+  },
+  {
+    {W(0x00037969a545f6ad), W(0x0007ce843b7f6572), W(0x000363c16c848b9f),
+     W(0x00044e456eadf2c6), W(0x0000a7b144d1c7ab)},
+    {W(0x00036cf95aaff74b), W(0x00062633dcda8a8f), W(0x0001cd1651d0c3d9),
+     W(0x00064aff0b0084fd), W(0x0003a9b0623d71d1)},
+    {W(0x0000000000000001)},
+    {W(0x00010272e54ca262), W(0x00029474f60db01e), W(0x0001e23e5e9bcb51),
+     W(0x00008943eb0a6f9a), W(0x000162f6b805e248)}
+  },
+  {
+    {W(0x0004ef42c3e54cfb), W(0x0004114cdb3046c6), W(0x0007f441aca366af),
+     W(0x00003ce6e8065003), W(0x0000563fde302130)},
+    {W(0x000312f8b5a5e9fa), W(0x000162c4b6bcdc0a), W(0x0005f32bd6f42513),
+     W(0x00070d8bd5cab2e0), W(0x000271485b9a78f1)},
+    {W(0x0000000000000001)},
+    {W(0x0000fc79c22da778), W(0x00000215ed03f950), W(0x0006a1a49605e8c3),
+     W(0x0006973e4c3d96e1), W(0x0005a7f52e58188b)}
+  },
+  {
+    {W(0x0003ba08fc6f348b), W(0x000191adc123974a), W(0x000609c37f27394e),
+     W(0x000417a290dd9b5b), W(0x0000a189797e9965)},
+    {W(0x0005a8fe2888ab9f), W(0x0000a4f2f6335bec), W(0x00054b2a59f3900d),
+     W(0x00060cef4df756d7), W(0x0006d441d05f29c7)},
+    {W(0x0000000000000001)},
+    {W(0x0006b38ef88f08d5), W(0x0000ad5e760384d1), W(0x00070a2b778995e7),
+     W(0x000032aa28b8f025), W(0x00010aa8d5fbbc3f)}
+  },
+  {
+    {W(0x00060895c8275d55), W(0x0002552b5179f110), W(0x0005a39b1d8fa864),
+     W(0x00049f68abc99020), W(0x0004bd86baa4043a)},
+    {W(0x00075dffbf19c5c7), W(0x000664678c818fc8), W(0x00061a9903c205c0),
+     W(0x00021b4a3656ae13), W(0x0004a5792811be0e)},
+    {W(0x0000000000000001)},
+    {W(0x000097c406b4b8fe), W(0x000170185545c504), W(0x000594971a29f420),
+     W(0x0002eb80a79c4223), W(0x00026f0c5802d6f3)}
+  },
+  {
+    {W(0x000467b9ee85e8bb), W(0x00069b327e7b6818), W(0x00048a6a5dbefe81),
+     W(0x00050b53580e2b3e), W(0x0001c7c050671860)},
+    {W(0x0005ae18cd4827c7), W(0x0005d45c33b0e80e), W(0x0002ebffa0f42338),
+     W(0x0000b0685d2d99fd), W(0x0001fc98a7e17910)},
+    {W(0x0000000000000001)},
+    {W(0x00023f8ecbe8f026), W(0x000714cd3b8df039), W(0x000295a0b407a88a),
+     W(0x0000baae056ba778), W(0x000041bd4595d51c)}
+  },
+  {
+    {W(0x000377e4ff4b1ba5), W(0x0002adff312490d5), W(0x0004479db29e7cba),
+     W(0x00063dedf18d5673), W(0x000352fa00edba25)},
+    {W(0x00053250750d9e89), W(0x0000d9054575c91a), W(0x0002b5be4eaa3f73),
+     W(0x00025d5c5d44a6f3), W(0x0007611bc8d3a3fe)},
+    {W(0x0000000000000001)},
+    {W(0x00027eb7e5b42b36), W(0x0005eceed6465f51), W(0x00020c9e547666ba),
+     W(0x0000ab303906581a), W(0x0005edcafd03c375)}
+  },
+  {
+    {W(0x0004e66ab6071b4d), W(0x00011f3d36caa8b7), W(0x0003cc3d2a0809a3),
+     W(0x0005a2f4824b5af9), W(0x00029e7f7bb7a175)},
+    {W(0x00052cea6032c8fc), W(0x0007cc3e3966cf01), W(0x0000469e06e9427a),
+     W(0x0003a5d8050caf71), W(0x00023c44f1f925f3)},
+    {W(0x0000000000000001)},
+    {W(0x0004a6aa41c2071f), W(0x000605385af049b0), W(0x00020cbd612d8d73),
+     W(0x000546e1e6f46445), W(0x00040eb0742b1811)}
+  },
+  {
+    {W(0x00055093c31951af), W(0x00047ddd9e22d096), W(0x0003c276a6677d13),
+     W(0x000777dbaa9f3faa), W(0x0000aebf6c07f5ca)},
+    {W(0x00053516fad3835e), W(0x00042cc3e28bb81e), W(0x00022af9832abff0),
+     W(0x00074e8273bde8da), W(0x0005079040608ac9)},
+    {W(0x0000000000000001)},
+    {W(0x0007520a570f715f), W(0x0002c88f3dddfc09), W(0x00054f67c83a4c56),
+     W(0x0001faf4026b5bd4), W(0x0005d771bd91df82)}
+  },
+  {
+    {W(0x0006c8e410d62338), W(0x0007fa18154e3db9), W(0x0003a5fbf8bb48b5),
+     W(0x0001fe6f9a9d216d), W(0x0007e3fb933510f7)},
+    {W(0x0007a6e199a5ca67), W(0x000582a6a36344fc), W(0x0002e841590badaa),
+     W(0x0001fa595e7865b5), W(0x0001232c040c8de7)},
+    {W(0x0000000000000001)},
+    {W(0x00017e9ed1fba46d), W(0x0000aa9b7faba2b7), W(0x0006b0d5d5514bdb),
+     W(0x0001458764ded138), W(0x0000e032c6371134)}
+  },
+  {
+    {W(0x0007c9a1da8a36d8), W(0x0006271303698e2d), W(0x000267682f8d0ed7),
+     W(0x0002c22ef42b166e), W(0x0005fc2fba721d24)},
+    {W(0x0007f777e93afef6), W(0x000451b88c80f978), W(0x000070f0483b3788),
+     W(0x0003f0595ea0a313), W(0x0004ebd9dca89a1e)},
+    {W(0x0000000000000001)},
+    {W(0x000766cd2d8973b7), W(0x0001368136132b5f), W(0x0006385e1730cc51),
+     W(0x00068c35c5d0926d), W(0x0007e928d7e1fb25)}
+  },
+  {
+    {W(0x000363984e67f276), W(0x0005ac47976ef8b7), W(0x0005ea60d96d5fc3),
+     W(0x000730fc1722a995), W(0x0005355fc056289d)},
+    {W(0x0000e83f72e14009), W(0x0006d739d64abbad), W(0x000798cf9a8b467d),
+     W(0x0007089325fc7f88), W(0x00079c47a0e8b477)},
+    {W(0x0000000000000001)},
+    {W(0x000153455d2841ff), W(0x00068d3e5417b4a8), W(0x00028e9596554729),
+     W(0x0003d384c38731e8), W(0x0003ec7ae46c2190)}
+  },
+  {
+    {W(0x00017485df6c9279), W(0x0004b922c5ff24a9), W(0x000078140111b3bf),
+     W(0x00042312ef6d14a5), W(0x00046e312923aa73)},
+    {W(0x000177abe4356c4c), W(0x0005d66afcf56fc1), W(0x000629fbd78efc94),
+     W(0x0001fd1653cf8d72), W(0x0003667f53bf93f0)},
+    {W(0x0000000000000001)},
+    {W(0x000425d9f486b411), W(0x000767c17a15ca3d), W(0x000650f2b47bd60b),
+     W(0x00059bdaa61b3b37), W(0x00067113e440e73b)}
+  },
+  {
+    {W(0x000325cf318cfecf), W(0x0001fa74a49c88a7), W(0x0007defb06dce5a8),
+     W(0x00030bb3c7ef557a), W(0x00035bee51df563f)},
+    {W(0x0006010fae2fa581), W(0x0004f98702964a2a), W(0x0001d5009dc31021),
+     W(0x000741a8134cc8df), W(0x0001da009eafe1f0)},
+    {W(0x0000000000000001)},
+    {W(0x0001a134583f22fe), W(0x00070da2c119aca7), W(0x00032b2f49e2577c),
+     W(0x0004cdd7cf4c5825), W(0x0002760f5311b60f)}
+  },
+  {
+    {W(0x0003ea6e53c13fe6), W(0x000078a6619984cc), W(0x000121cc59b76920),
+     W(0x00034682a3234106), W(0x0004cc346053d4df)},
+    {W(0x0004b4a8dcaf4e12), W(0x0000e7c1a7720ab2), W(0x00014253e04f32d8),
+     W(0x0002b6bdbde6539c), W(0x0001d93fd304e3ab)},
+    {W(0x0000000000000001)},
+    {W(0x00025fcf5f59084a), W(0x0005ef24b4d6eaa2), W(0x000331808338f6cf),
+     W(0x0001474ced2fa7fa), W(0x0001a0b6dbcfdb4f)}
+  },
+  {
+    {W(0x0004792e3ad71d7c), W(0x0004d3b755d6bb9e), W(0x0000708d7e03d54c),
+     W(0x0006a98236aa4327), W(0x000782aeac886662)},
+    {W(0x00051c9b33edb184), W(0x0007661e5a372c18), W(0x000115dcd66f0301),
+     W(0x0002b98a1fe578f6), W(0x00078e564addb5e9)},
+    {W(0x0000000000000001)},
+    {W(0x0004de24844f6f6e), W(0x0005ff07f853d03e), W(0x000171b81942e104),
+     W(0x0002f09dc4e0ab53), W(0x0001470ef32df434)}
+  },
+  {
+    {W(0x0006ede7afee5320), W(0x0002903fe6f84c35), W(0x0000804e2d13e286),
+     W(0x000618907b73c763), W(0x0002e18282ff8247)},
+    {W(0x0001d00f9386cdcd), W(0x0004e526cb173ef7), W(0x0002ef1ae3ab669f),
+     W(0x0007035e1731be72), W(0x0002a5876844eeb9)},
+    {W(0x0000000000000001)},
+    {W(0x000600372f567155), W(0x00038dd72b1b282d), W(0x00035083e23f31a4),
+     W(0x00069d2e857750ca), W(0x0000112dc63c1410)}
+  },
+  {
+    {W(0x0004194d26fb43b8), W(0x000346fc270ea586), W(0x0004a7914ea61d60),
+     W(0x000478b6aeec262c), W(0x0003c8795fa0bd79)},
+    {W(0x00007e1a3f91b1b7), W(0x0007670d276fe0d4), W(0x000398248691ff76),
+     W(0x0006771ed2c55e02), W(0x000539a31a7b195f)},
+    {W(0x0000000000000001)},
+    {W(0x0003333ceb37eccf), W(0x0004e05d91ed3507), W(0x000786277720ff41),
+     W(0x00000bc1caf4b382), W(0x000419ae7ece460c)}
+  },
+  {
+    {W(0x0004bfe67949c7ac), W(0x0006f812e3dfa3be), W(0x000276571fd400d5),
+     W(0x0000e46e501cb7cc), W(0x00066e3d29dbabc6)},
+    {W(0x000226c02ea1d50e), W(0x0001df43c77718e5), W(0x0002314d062b4e32),
+     W(0x000106faf9196eb9), W(0x0005ca4b5d4ced9b)},
+    {W(0x0000000000000001)},
+    {W(0x000577fde7196d02), W(0x0001cefb7afcedf9), W(0x0001e4c1a40f4ff0),
+     W(0x000191238872e5e7), W(0x0004db7e1170bdb6)}
+  },
+  {
+    {W(0x000477960200a87f), W(0x00051abdd14e249e), W(0x0001045e9a2b0666),
+     W(0x0005d0d1fdd3ed2f), W(0x0000dc22924f61e9)},
+    {W(0x0005781935791d0b), W(0x0005dc489a420365), W(0x0002425ae33301cd),
+     W(0x0006ccde42bf97d9), W(0x0001fcc932f77c84)},
+    {W(0x0000000000000001)},
+    {W(0x000421f169f8ebfa), W(0x0001e3c771b1efd5), W(0x00016920a6315dfb),
+     W(0x000055e92b3d4ffd), W(0x000434dcd429ff86)}
+  },
+  {
+    {W(0x00047f64c8090a58), W(0x00058446bbb798cb), W(0x00074174b2b7c13c),
+     W(0x00003105ca240640), W(0x0002c18cbe57bd09)},
+    {W(0x00004afd38611077), W(0x0006b445d8a40f5a), W(0x00031c588d156626),
+     W(0x0005a54da1893367), W(0x0000df556f0c7a1f)},
+    {W(0x0000000000000001)},
+    {W(0x0003506c74189e2a), W(0x0002039dd3f0e243), W(0x00039bdf48bf97d7),
+     W(0x0007735044add536), W(0x0005b6d2f14c87b6)}
+  },
+  {
+    {W(0x0004e0276e5d10c4), W(0x00068d1884dfc434), W(0x0000f925e6a85b63),
+     W(0x0000ca1e0df85856), W(0x0002081f8bbd8724)},
+    {W(0x0006afadbd307b00), W(0x0007e7de7207e3d5), W(0x000219c1fc521f1a),
+     W(0x0007a9662fcef822), W(0x00034f57a8da1b0c)},
+    {W(0x0000000000000001)},
+    {W(0x000640cfebb82d08), W(0x0001e32b47876e12), W(0x00043870010bb287),
+     W(0x0007bb5f8449e818), W(0x00022aed00987af8)}
+  },
+  {
+    {W(0x000444eee4a09876), W(0x0001e8837888e31b), W(0x0002e8317be5a71e),
+     W(0x0005f1d052550bb3), W(0x0004e9f895fa886a)},
+    {W(0x0001d69569a6489c), W(0x0001dfd4e17845f5), W(0x0006c52f28062056),
+     W(0x0003ec67ef7334ff), W(0x000478c343c0f6dd)},
+    {W(0x0000000000000001)},
+    {W(0x0000ca3b8277b00c), W(0x00031b508f2a5efd), W(0x00042e11566de7d7),
+     W(0x00052371547699f6), W(0x0002415f0673b536)}
+  },
+  {
+    {W(0x0001d8d09e7ad813), W(0x00014afcabaf0d8f), W(0x0000b2a0f569d1c1),
+     W(0x00028e20e901181a), W(0x00029d22c77071f2)},
+    {W(0x0006012a8b38416a), W(0x0003cb13e84717c7), W(0x00026db1086ec6cd),
+     W(0x000278f701ea8151), W(0x0003943c6ee76b7b)},
+    {W(0x0000000000000001)},
+    {W(0x000020460c6fb8b6), W(0x000285a183096a91), W(0x00015222a20acda9),
+     W(0x0003837088aef337), W(0x0007282b7e05db05)}
+  },
+  {
+    {W(0x0000851b2ffbc90f), W(0x0003a50ff829ffc0), W(0x000337c1b0011f02),
+     W(0x00003cf6a1466792), W(0x0004881dfb778020)},
+    {W(0x00044e1650dc089a), W(0x00041a6a359d54d0), W(0x00072094da6dedbd),
+     W(0x0004e15567bf03c0), W(0x000054dc64243f7a)},
+    {W(0x0000000000000001)},
+    {W(0x00066bac32afaf9e), W(0x0001ff20d02e9416), W(0x0000f7af305310c4),
+     W(0x00025e894ac20323), W(0x0005c653db48bf0e)}
+  },
+  {
+    {W(0x0004d4a1b3c46911), W(0x000163f1687e0384), W(0x0003a78c4ecfa622),
+     W(0x00027f24c1e5b464), W(0x000582c46435c832)},
+    {W(0x0003fd0804d70473), W(0x00078baf9c660e87), W(0x0004301f16ac313f),
+     W(0x0006eabe70ab760b), W(0x0002c363037e8eb7)},
+    {W(0x0000000000000001)},
+    {W(0x000390627fe6ac6d), W(0x0002bc2978a94f92), W(0x00005f0a85c365cc),
+     W(0x0003ee17d0c22612), W(0x000256fa45054b7a)}
+  },
+  {
+    {W(0x0007154237388360), W(0x00013d0a3f6877d6), W(0x00039ed3ae466e0b),
+     W(0x000448471d39ea83), W(0x0004283373c2311e)},
+    {W(0x00062246c4451295), W(0x0004fc116ed34f67), W(0x000268005ed50d7f),
+     W(0x0003f05185949ac8), W(0x0004cc961aa56cd0)},
+    {W(0x0000000000000001)},
+    {W(0x000247b2e449586d), W(0x00049107bba15f11), W(0x0007e043accaf6c2),
+     W(0x0000f9fd50beebcd), W(0x0005d57f47544e37)}
+  },
+  {
+    {W(0x0004bfcf8406d912), W(0x0006e955ed4eb194), W(0x0004b3160aa64c23),
+     W(0x0002195079e333f0), W(0x0007bb41ed320761)},
+    {W(0x0000c8bb9311273d), W(0x0007ff876b0edf99), W(0x00069371f807155a),
+     W(0x000518590da7587f), W(0x0002360281808fad)},
+    {W(0x0000000000000001)},
+    {W(0x0001c0d8c0c45a5a), W(0x0007fa826f8caf4e), W(0x0003d61443a3f51e),
+     W(0x000504c2bf4934b8), W(0x0003e6f4122c7e1e)}
+  },
+  {
+    {W(0x0002aa56619cad68), W(0x0000b7739a0be058), W(0x000332668e31912f),
+     W(0x00051f00e4b3a1a0), W(0x0005e8d07036e6a8)},
+    {W(0x0000085f7b5980b9), W(0x0006caa5cb7006c6), W(0x000640cfc9b22a12),
+     W(0x0005246b6d7862a7), W(0x0001d45594714f49)},
+    {W(0x0000000000000001)},
+    {W(0x00045a9c6cd21526), W(0x0000435eb04dd1e7), W(0x0004d5c803537673),
+     W(0x0007f63ca5d38e88), W(0x00038a04debb2830)}
+  },
+  {
+    {W(0x000685ea31d50424), W(0x0006162199d1c3d3), W(0x000000946c376980),
+     W(0x00029901e6ba78b1), W(0x000448ccd4f205cf)},
+    {W(0x00028e2e7d608393), W(0x0007fab973f59b77), W(0x000736a2600b73b5),
+     W(0x0000ace84c2f555d), W(0x0002916e4eb2babd)},
+    {W(0x0000000000000001)},
+    {W(0x0005fe56a2167f57), W(0x0007685187255258), W(0x000429a0e21024df),
+     W(0x00062cf2b936bc08), W(0x000067ab540f3b89)}
+  },
+  {
+    {W(0x00041066df287dbb), W(0x0002d0e47547daaa), W(0x0005250028a85724),
+     W(0x0004cb46b1829f24), W(0x0000e524503c6eff)},
+    {W(0x0003bba216de421d), W(0x0002aaffdd0dc0c1), W(0x0005c63fe9380c28),
+     W(0x0007b42a61d6e46e), W(0x0005e6da91195a4c)},
+    {W(0x0000000000000001)},
+    {W(0x0007a455a033efa3), W(0x000370ecb9332f38), W(0x0000e22f756741ce),
+     W(0x0007dca788afd027), W(0x00007217beffb1c8)}
+  },
+  {
+    {W(0x0007e49983efdc9d), W(0x0006367bce993e31), W(0x0007d7818aadb7de),
+     W(0x000186775d5a248e), W(0x0004101e3292b270)},
+    {W(0x00058984090a2a53), W(0x0006673e2ae5001a), W(0x0001b2d49e725a20),
+     W(0x0004ce0e53cc6423), W(0x0006ae16e6021011)},
+    {W(0x0000000000000001)},
+    {W(0x0001ea8262c82828), W(0x00029194727afcbc), W(0x0002361ab96189e1),
+     W(0x00056131ac2d4625), W(0x00010f29b1595c4f)}
+  },
+  {
+    {W(0x0006cdb6d8d89e5e), W(0x0001682bb8a142b6), W(0x00065a278009ab67),
+     W(0x00034b702893071d), W(0x00078fec55ccf7c5)},
+    {W(0x000010b966590675), W(0x0004e54cc7a405e7), W(0x00037fb6148b4571),
+     W(0x00065d6a7d95c81d), W(0x0005a8c7265cf13d)},
+    {W(0x0000000000000001)},
+    {W(0x00025f4b3570ef78), W(0x00051a5672ac13d0), W(0x000062619e5cf7c3),
+     W(0x0006ab28420d1def), W(0x0007f54b0017f90a)}
+  },
+  {
+    {W(0x0002f2ab7200c787), W(0x0004348f91885e73), W(0x0002860ccf987ecf),
+     W(0x0006a3e4bb633a9f), W(0x0005706fa7c07596)},
+    {W(0x00078d19d34904cd), W(0x0005893c7be18e9b), W(0x000426f22435ae8f),
+     W(0x0000e94e4f3f8466), W(0x00009440f7578e15)},
+    {W(0x0000000000000001)},
+    {W(0x000659f48817e8c9), W(0x000255b69c23c44c), W(0x0003eca5284b3e33),
+     W(0x0003bc1b0a9eefad), W(0x000205308e5b4657)}
+  },
+  {
+    {W(0x0001969886216fed), W(0x00017a1bcbca64ec), W(0x00053ff8cc8d3e6c),
+     W(0x00040951baa0b0ef), W(0x00006091eb986c95)},
+    {W(0x0002240b511ced38), W(0x000002f4528a84df), W(0x000366ad91d7f111),
+     W(0x0000950df0b087b0), W(0x0003ba5f318ede80)},
+    {W(0x0000000000000001)},
+    {W(0x000659301f5f106d), W(0x0005dcf6e21f46a1), W(0x000433ba38d3c3df),
+     W(0x00024528dc92f497), W(0x00045bad4b1de4a0)}
+  },
+  {
+    {W(0x0000f7a0b4f71aa0), W(0x0003120dd4eca922), W(0x0006c23d9ca22042),
+     W(0x0007e5070b3f7102), W(0x0001693fceb3873a)},
+    {W(0x0003a3b0b9b210c0), W(0x000325b16bbff383), W(0x0007cac9fc678720),
+     W(0x00036f60df21c333), W(0x0000195e46f57dec)},
+    {W(0x0000000000000001)},
+    {W(0x0001b89f70ccf61a), W(0x000753b8f1f34eb5), W(0x00047f66b95d2fc2),
+     W(0x00050f0eb6227c22), W(0x0001162e6f29c549)}
+  },
+  {
+    {W(0x00073c5952bb3a3e), W(0x00069eb558c9675a), W(0x00007e13c1cac63c),
+     W(0x0002c0a7a9c6ba14), W(0x0002705d9dd6219e)},
+    {W(0x00073a4c454dbb13), W(0x00035747b16e7d33), W(0x000795be08994bc7),
+     W(0x0002109f1f4c42bf), W(0x000681dc94b4136e)},
+    {W(0x0000000000000001)},
+    {W(0x00061d730f5008a5), W(0x000156b4259e2ec7), W(0x00058b0ed3092c24),
+     W(0x000155077e7574d4), W(0x000437b0114b0e19)}
+  },
+  {
+    {W(0x000057f7e04663db), W(0x00029db7a7fe3765), W(0x0001ded3e786b33d),
+     W(0x00030fc332267a89), W(0x0005b052bbb33752)},
+    {W(0x000421508eb6494b), W(0x000580429f5ee2a8), W(0x0001e41dedd3e9fc),
+     W(0x0000a53e67e9f360), W(0x0004b6c0a4fb8a71)},
+    {W(0x0000000000000001)},
+    {W(0x000386fa171a36c8), W(0x000728c394f92ec8), W(0x000307f8e0064ebf),
+     W(0x000268182cf46e07), W(0x0004cd19f3650038)}
+  },
+  {
+    {W(0x00047e98f1768d21), W(0x0000af556033a267), W(0x0007b93c304c86f7),
+     W(0x00066155eaedd803), W(0x0000545eb79fb646)},
+    {W(0x0004f3b47f6e30df), W(0x0001b2fff0be0505), W(0x0003ea8cfc679492),
+     W(0x00059dd9fc652e28), W(0x00035bb7dd5b7813)},
+    {W(0x0000000000000001)},
+    {W(0x000055eb61f49755), W(0x0007be032e7aa630), W(0x0006235c7cda52ea),
+     W(0x00064855e59a5680), W(0x0003e34e691ddaea)}
+  },
+  {
+    {W(0x00044b12120a12b7), W(0x0001ffe72a0b46e8), W(0x000281210a818ffd),
+     W(0x000550d1299b8c17), W(0x000687f99b8c6802)},
+    {W(0x0002707729054d0b), W(0x00012b77dfb3d92f), W(0x0007ef2a91eac0de),
+     W(0x0005583b4c56aa6f), W(0x0002684ace5a6c93)},
+    {W(0x0000000000000001)},
+    {W(0x0002f25fc89019cb), W(0x0001ab92ff837243), W(0x0002331918e7135a),
+     W(0x00050a1168a33003), W(0x0006163828ef7496)}
+  },
+  {
+    {W(0x00035842099f830d), W(0x000243f9fddad680), W(0x0000308571a6fd11),
+     W(0x0007de82fe01fe95), W(0x0004950d3c90e5f3)},
+    {W(0x0006be8b91b67023), W(0x0005a4948d9acda9), W(0x00021df9d412c342),
+     W(0x0003ceeeb49a62d0), W(0x0002835a54c5ae11)},
+    {W(0x0000000000000001)},
+    {W(0x0005604526c5499d), W(0x00063c9d4d696da4), W(0x00005c263fdc1e8e),
+     W(0x00039ec9a64852d6), W(0x0003c9e532501c8e)}
+  },
+  {
+    {W(0x0006ff1f9e1cae77), W(0x0001d67676e980c5), W(0x0000309f662a69e6),
+     W(0x0007574eb0cc0803), W(0x0001c69b0930b7ef)},
+    {W(0x00005634c1181f9b), W(0x0007d3b4d9282282), W(0x00003112f962f930),
+     W(0x0000dc5c64790825), W(0x00044e86af1e2ea4)},
+    {W(0x0000000000000001)},
+    {W(0x0004c62b13806c33), W(0x000413020281d237), W(0x0003d61f746bfb05),
+     W(0x000351cb209e9475), W(0x0004b3261f686691)}
+  },
+  {
+    {W(0x000332a785c87229), W(0x0004d423253d902d), W(0x0001aa424808a8c5),
+     W(0x00031cc372c19092), W(0x0000fce0364f2e34)},
+    {W(0x00000294cc65ae89), W(0x000027fe9caa2672), W(0x0007dc1160634aa8),
+     W(0x0000a19decb8ae81), W(0x000337afdb4154b3)},
+    {W(0x0000000000000001)},
+    {W(0x0000de12a9f94c32), W(0x000364fc6f6744aa), W(0x0007b1ba45e8451e),
+     W(0x00041fa7f3f26643), W(0x0005cfc8fe9e1549)}
+  },
+  {
+    {W(0x00071361811b2e18), W(0x0003b8a6af5c4399), W(0x000406c0c6f50030),
+     W(0x0000d758ca25c105), W(0x000485c0bc88c505)},
+    {W(0x0002565e1eb7a1c9), W(0x0004d96f9bc3ec58), W(0x00013b5318b63960),
+     W(0x0002f5fb2c8daf65), W(0x0007809ddcee0bf7)},
+    {W(0x0000000000000001)},
+    {W(0x0001e03c0edecbe2), W(0x00035f2ab89b955c), W(0x000118127b761512),
+     W(0x0003890c5411d34d), W(0x0002a3d47aea9d1f)}
+  },
+  {
+    {W(0x000598bb41398856), W(0x0006f71ba5bfd50a), W(0x00028748b2bf603d),
+     W(0x000626dca6ecd1f7), W(0x0001b8047454d757)},
+    {W(0x00003eb4f777a0ae), W(0x0004ee05c4dcd36f), W(0x0001c5c7cfb26330),
+     W(0x000337d4a4ee3dbe), W(0x000223c41d49c139)},
+    {W(0x0000000000000001)},
+    {W(0x0007d5e51357541d), W(0x0000547271d9aba9), W(0x00064a9f6e269dd0),
+     W(0x00046647e811dc31), W(0x000202cc95b8478c)}
+  },
+  {
+    {W(0x000682d815533a4b), W(0x000289f5729e3adc), W(0x00065269f38cd323),
+     W(0x0002defcc607862e), W(0x0003cbc5e1fe1564)},
+    {W(0x00026d9680cd52e5), W(0x0003713ca278970a), W(0x000195d412702afa),
+     W(0x00060d3f65a20aea), W(0x0002516dc948b7a1)},
+    {W(0x0000000000000001)},
+    {W(0x000258f7f789f856), W(0x0005fb335031c1e1), W(0x0004498fe62fc2ed),
+     W(0x00020363bdac14c0), W(0x000759b6427c2d48)}
+  },
+  {
+    {W(0x0007345a8d593934), W(0x00032b6fbb21dace), W(0x0005e12c40cd8cb6),
+     W(0x0005c79a001fd47f), W(0x00061b515be52f70)},
+    {W(0x0000ad3a6abd5375), W(0x0001b191c944ca16), W(0x0002ae9faa28d177),
+     W(0x000576cb125a181e), W(0x0001a7066e74417b)},
+    {W(0x0000000000000001)},
+    {W(0x00013eb71d490744), W(0x000512ca5f8c88b2), W(0x0002f4e1d4ebe919),
+     W(0x0005b562e254ab1a), W(0x0003179a62adad0d)}
+  },
+  {
+    {W(0x000597b8cb125e22), W(0x0004f05d715df504), W(0x0007ec3fe7ed3071),
+     W(0x0007be421e15499a), W(0x0001cfe66a75cc98)},
+    {W(0x0003e2aaa30de26a), W(0x00021568134e4e2e), W(0x00014086979bd5d6),
+     W(0x00050e35ae3dd314), W(0x00051cf49389253b)},
+    {W(0x0000000000000001)},
+    {W(0x00028deb5bd421b5), W(0x00013e985c6c1b00), W(0x00053c29da7a8df0),
+     W(0x00041e512dc9fc3c), W(0x000141a6472df2eb)}
+  },
+  {
+    {W(0x0002f940f5af017d), W(0x00028c0869e2c5f2), W(0x00070fa64761c420),
+     W(0x00078e9b7c922ace), W(0x00040ec9765558f5)},
+    {W(0x0002ea02a299bff9), W(0x0007376ebcc8edbe), W(0x0007f8f97989a7ef),
+     W(0x00035d946182eb02), W(0x0007691bafd3a95c)},
+    {W(0x0000000000000001)},
+    {W(0x00038d42c2e2403e), W(0x00037a70139b0c28), W(0x000350318a366b25),
+     W(0x0007df6f5e75d810), W(0x0001a0bdab540722)}
+  },
+  {
+    {W(0x0004c315ec2ecc9b), W(0x000745abc38016bf), W(0x00031d5dd0590f36),
+     W(0x0003a3ea027a6bc2), W(0x0003257649592310)},
+    {W(0x000734c83a50633d), W(0x0006976013c0a56b), W(0x00025e19a4435f99),
+     W(0x0006d2ed4585b504), W(0x0003c4cf409a8b79)},
+    {W(0x0000000000000001)},
+    {W(0x00041661ac3c44ba), W(0x00066d94136d346d), W(0x000161b94446f418),
+     W(0x0000e3502239b895), W(0x000765fea2f4a87e)}
+  },
+  {
+    {W(0x0002440f90517404), W(0x0000504e84ae8bb1), W(0x00047c09181ebc41),
+     W(0x00013c3636de9896), W(0x0006c0a0cf843424)},
+    {W(0x0003dd6a59275b70), W(0x0002b151859fbe1c), W(0x000714ca13a58de2),
+     W(0x0001c56a3a58f299), W(0x0007daa0be2c66b7)},
+    {W(0x0000000000000001)},
+    {W(0x0005162dd293875e), W(0x0003021782d7ab66), W(0x00007fc5bfff9490),
+     W(0x000204c672696b43), W(0x0007781dd139b4d3)}
+  },
+  {
+    {W(0x00046fb562aed4ab), W(0x000031f7824f5c12), W(0x0007cd0474ba406a),
+     W(0x00063b74922180f0), W(0x00000e006c3da925)},
+    {W(0x0000682623d77858), W(0x0004c5e5fbe2b8db), W(0x00070943b08e44df),
+     W(0x0005a99ee00d4a01), W(0x0006b4b50d7cf106)},
+    {W(0x0000000000000001)},
+    {W(0x0007ac287281b16b), W(0x0007f720abdb1fc2), W(0x0005a9e62d8cce5f),
+     W(0x0003ad93485870a7), W(0x00067a435a0e2c41)}
+  },
+  {
+    {W(0x0007f6e89afde0cc), W(0x00013a0e82f0414f), W(0x00043c8353d7a86f),
+     W(0x0001bc1e5ac2a51a), W(0x000039fe789bfa18)},
+    {W(0x00079c8351c4b9b7), W(0x000565529684c923), W(0x000002bc65c8918c),
+     W(0x0004db01fe1f2de3), W(0x0002651be068b360)},
+    {W(0x0000000000000001)},
+    {W(0x0006799d5fa5133b), W(0x00003a14296d56ff), W(0x0007e22f2b36357f),
+     W(0x00027053778b92e0), W(0x0003155616cba984)}
+  },
+  {
+    {W(0x00066d9a1b96364a), W(0x00012d474699ca1e), W(0x0003b8bd933f4b84),
+     W(0x0004639d50dd484f), W(0x0005852d1ed562d0)},
+    {W(0x0004ebd48d853be1), W(0x00016f230ba542b6), W(0x00002aff370879be),
+     W(0x0004df05b5e45efc), W(0x00069ee09409ff60)},
+    {W(0x0000000000000001)},
+    {W(0x00007a107effc2e0), W(0x000415922e511b5e), W(0x0005c3e767bd23e6),
+     W(0x0004c82497f707a4), W(0x0002d5c5f5056567)}
+  },
+  {
+    {W(0x0006f453c71ec214), W(0x00078ed0ef8a30b7), W(0x00060b91a9a6e193),
+     W(0x000285e5dc53fcf4), W(0x000024c8972edb24)},
+    {W(0x00034ceecbf65d4a), W(0x0006a5d880feab8b), W(0x000359ac0421625d),
+     W(0x000164aeb9135d37), W(0x00058da5bda0cba3)},
+    {W(0x0000000000000001)},
+    {W(0x000669ab64767869), W(0x0000769ac3dc14e3), W(0x00056dfc07e46abe),
+     W(0x0001ff1889844e14), W(0x00046bd6d1e06086)}
+  },
+  {
+    {W(0x0000f269384aaa0e), W(0x0002021a3c4af0f0), W(0x0006a6ae6d009ce9),
+     W(0x0002bd03a75b2be6), W(0x00054f1c6046a87e)},
+    {W(0x0002cd334428e0ee), W(0x0002b6681df0a66c), W(0x000701b20ad947d3),
+     W(0x0006b671a1f6e98f), W(0x0002f357e76c1f26)},
+    {W(0x0000000000000001)},
+    {W(0x0000aff166940501), W(0x000450d712019991), W(0x0007ad868fa059da),
+     W(0x00039d26e6869eea), W(0x000085d38f0eb299)}
+  },
+  {
+    {W(0x0002b735419e1184), W(0x000681514eabf2ba), W(0x000198adc6cf4cb8),
+     W(0x0006b9d498b62e23), W(0x0003980f2da7d831)},
+    {W(0x0004f1455e668f7b), W(0x0000abea7e752a76), W(0x0004c17dca9fcc43),
+     W(0x0002a6035921c85f), W(0x0007200e1b076bed)},
+    {W(0x0000000000000001)},
+    {W(0x000214f2113ab66b), W(0x0004c674cce52601), W(0x0006b351bbaffd9f),
+     W(0x0002963b6cdd88d5), W(0x0007869c3b49944d)}
+  },
+  {
+    {W(0x0001a1cc4a3c2aaa), W(0x00032ea998b2a424), W(0x0003b11e60b42a5f),
+     W(0x0005f6bc121257be), W(0x0001a2f01aeea5c7)},
+    {W(0x0006b9722d71a25a), W(0x00039bd75e630d04), W(0x00075d6a73c822f8),
+     W(0x00040dfcd5a3b333), W(0x00003f69b8e3871b)},
+    {W(0x0000000000000001)},
+    {W(0x00066d7d560f2963), W(0x0007681e8764b5b0), W(0x00058af28bffb02b),
+     W(0x00075df7c8920322), W(0x0003744500e3dcaf)}
+  },
+  {
+    {W(0x000225f030d02633), W(0x0007e0771f0420ba), W(0x0007ba0ce02f5d9f),
+     W(0x0005f62402fd5914), W(0x00012dbd0ee3874c)},
+    {W(0x0003afc4c8e1748e), W(0x00054f77e9942269), W(0x0004eb7a62340352),
+     W(0x00047133b34ae743), W(0x00026d9742b49a2b)},
+    {W(0x0000000000000001)},
+    {W(0x0003f206c93badcc), W(0x0007980bf8ddf9d0), W(0x000478c6e1cfc07c),
+     W(0x0003dd13e5140a5f), W(0x00058d916d2c914a)}
+  },
+  {
+    {W(0x00027eecd0bdc20f), W(0x000051d2a9f5e5a9), W(0x0000ce4d97ba6576),
+     W(0x000629ac126aedca), W(0x00073ce5da28cf79)},
+    {W(0x000562ab9f9f3084), W(0x0003fc23e033d387), W(0x0007d4d2c617f346),
+     W(0x0007001edabf0da0), W(0x0004b23dad8dde3e)},
+    {W(0x0000000000000001)},
+    {W(0x00010070b1b64f00), W(0x0006f3d42d436fad), W(0x00011e1ecf75bda9),
+     W(0x0002e10720b66e80), W(0x000726d9d44b5c1d)}
+  },
+  {
+    {W(0x0000ba7cf572571a), W(0x00050453d96b39cf), W(0x000603c616ae54ac),
+     W(0x000214c18db4fb28), W(0x00005d1f2432ce5b)},
+    {W(0x00079ae8e09a0a1c), W(0x0006f4ae5b22f614), W(0x00041aa037535a59),
+     W(0x0003eec3ed65adc1), W(0x0004f881a1a820d6)},
+    {W(0x0000000000000001)},
+    {W(0x000250bad50d51e8), W(0x0004a10f97ec5110), W(0x0000d585c9846f79),
+     W(0x0000a73cf000ab09), W(0x000098168f3c69c2)}
+  },
+  {
+    {W(0x0002964490f7cb9d), W(0x0004867baad839e4), W(0x000472dfadb68871),
+     W(0x00056e3b52647470), W(0x0000ccb6070d9fbd)},
+    {W(0x0005ecf7002366dd), W(0x0001ddd4fbabded1), W(0x00067b5880534f39),
+     W(0x000114e9d9872c06), W(0x0001af1a2f959bb4)},
+    {W(0x0000000000000001)},
+    {W(0x00011cf21f09a4d6), W(0x0004d28f520b1a92), W(0x00064f1fe51e030c),
+     W(0x000502ce15969227), W(0x0003a4851e957dcb)}
+  },
+  {
+    {W(0x000284564593d159), W(0x0002a9dffd3bb90d), W(0x00002e1c71dff2e9),
+     W(0x0001fcdd549576b3), W(0x000254c0a392629f)},
+    {W(0x00067cc75ff0f4bb), W(0x000711cfea4e49ec), W(0x0001696ece950213),
+     W(0x0002b934a007236e), W(0x0004cd1020bf949e)},
+    {W(0x0000000000000001)},
+    {W(0x0004fc75c0b4fd70), W(0x0005f03768feeaa3), W(0x0007ce8f176802a5),
+     W(0x0007012a70bb2690), W(0x00063eba71a113a6)}
+  },
+  {
+    {W(0x000371fae8a36dcd), W(0x0006ac894abf1e80), W(0x0000348bc98e7829),
+     W(0x0005798587884246), W(0x0000bdc89b1b6891)},
+    {W(0x0003dd15ce856496), W(0x0004740c448d1921), W(0x00038616ec7b02d7),
+     W(0x0003f0a7a2a2b913), W(0x0002f8c04fdd100c)},
+    {W(0x0000000000000001)},
+    {W(0x0007010aa8591c30), W(0x0001808d009b6b9f), W(0x0002dea9d68a0acf),
+     W(0x0006aa7e5a960f3b), W(0x000789fdfbe31043)}
+  },
+  {
+    {W(0x00048dd8faea96e2), W(0x000660f4c3eb88ef), W(0x0007fa3e2e6f88c3),
+     W(0x0002adac5fc32486), W(0x00008114ebfb955c)},
+    {W(0x0003162d8942540a), W(0x0001a085ab343fa3), W(0x0003a1ad5e501406),
+     W(0x00031fad23106b67), W(0x00036470ffbd79be)},
+    {W(0x0000000000000001)},
+    {W(0x0003c376f4b3c12c), W(0x0005a16202b74e6c), W(0x0007dd1b24e3111f),
+     W(0x000096a18ccc5061), W(0x0000fed44291d98c)}
+  },
+  {
+    {W(0x0007f2507312ca7f), W(0x0001513a45e3c3d7), W(0x00077127d6300119),
+     W(0x00073061122494f3), W(0x0006098000703e7d)},
+    {W(0x0004dac2ab34cad1), W(0x0002888e36f2a36b), W(0x0007bbae4d88aaee),
+     W(0x0007924ad6f12ef1), W(0x0004a97168ef65a2)},
+    {W(0x0000000000000001)},
+    {W(0x000290e2614de3b1), W(0x00048f77967e5719), W(0x0006273d7864bf84),
+     W(0x00005d50ef768e98), W(0x00063326126b2955)}
+  },
+  {
+    {W(0x00031fe9b4c371b1), W(0x0002f7cc06ff3657), W(0x000630782a7466e0),
+     W(0x0004ff881f45c829), W(0x000109f83fdd28c3)},
+    {W(0x000784202940aa39), W(0x0007e7446a5cc328), W(0x0000adce11877020),
+     W(0x000737a7a92970cd), W(0x00061e34e7d8d87e)},
+    {W(0x0000000000000001)},
+    {W(0x0005e05a2435d29c), W(0x00046803aee69724), W(0x000564f442d6ce33),
+     W(0x00073ae4809f27ec), W(0x0001f007b5945f5d)}
+  },
+  {
+    {W(0x0000353372ca93ba), W(0x0004cea2388275ce), W(0x0005d7357f2fd387),
+     W(0x000263fa30e0601a), W(0x00064a3e03743582)},
+    {W(0x0006bba4e93f0415), W(0x0007699ef8f36a19), W(0x0000fd848cfea5df),
+     W(0x00032eb544726ced), W(0x00011307ad9855ef)},
+    {W(0x0000000000000001)},
+    {W(0x000755e241c12562), W(0x00000e06ca580f57), W(0x000439fd3c229642),
+     W(0x00037cd31428778f), W(0x000773d2420caa59)}
+  },
+  {
+    {W(0x00035f08e30c9c41), W(0x0005cafbd4886e9a), W(0x0006cf9e182510d3),
+     W(0x00010a34edece937), W(0x00064969eb3b1227)},
+    {W(0x0003cbba1f08385f), W(0x00054452e1dcd32e), W(0x000767e2ddbafd39),
+     W(0x0000d08c4715b30a), W(0x0006c6009c415009)},
+    {W(0x0000000000000001)},
+    {W(0x0006cd52507d3fbc), W(0x000721e8f09fa14e), W(0x0007b039349c0408),
+     W(0x0007f2f8f54c6fa8), W(0x0006b070d80845c8)}
+  },
+  {
+    {W(0x00032f994b204630), W(0x000547aef268bc52), W(0x00034843e447d2ec),
+     W(0x00067e268b5d996b), W(0x0000ac981df060b5)},
+    {W(0x0002df4187302f8e), W(0x00076ba243daf95d), W(0x00029824fc89548d),
+     W(0x0001a4b046b801f7), W(0x000465701c66b851)},
+    {W(0x0000000000000001)},
+    {W(0x0006f19d7d5d4ebc), W(0x0001d9f6d90e9b2e), W(0x000753bbaacdc8fb),
+     W(0x0001d937396241d1), W(0x000224911b01cd6d)}
+  },
+  {
+    {W(0x00063c88d4a229ef), W(0x000288b48608ffb1), W(0x000477a73a722d8a),
+     W(0x0000499d6d3537be), W(0x00005f42e9c55b71)},
+    {W(0x0005ed0677a94ab6), W(0x00077777dcaa090e), W(0x000069f79a825ab9),
+     W(0x0001345605852438), W(0x0000babaf37ab5a9)},
+    {W(0x0000000000000001)},
+    {W(0x00060c8761a8e1b4), W(0x0004c42d59e3fc63), W(0x00078cc71fbecc96),
+     W(0x0004fc3a421bc081), W(0x00033b49609e5080)}
+  },
+  {
+    {W(0x00053611e7f61c43), W(0x0000497f9d7bffb9), W(0x0005b0c3cca95c4a),
+     W(0x00005a74bf863cff), W(0x0001859d4416d044)},
+    {W(0x0001d0fdbff310d0), W(0x0002057f94ad8876), W(0x000226c737929d6e),
+     W(0x0003565fa612e13c), W(0x0000881c597ec760)},
+    {W(0x0000000000000001)},
+    {W(0x000153bde162f163), W(0x0004d4761371c3ee), W(0x00057a0865220bc1),
+     W(0x0006a3c14eb69924), W(0x000130ab429f285f)}
+  },
+  {
+    {W(0x0002b4a0013a87a6), W(0x0004a665523357e1), W(0x000405e6699efbe4),
+     W(0x00043d2dde907e13), W(0x0005d64ac4b4f1b6)},
+    {W(0x0004c65c010d9d64), W(0x00030edb469a6553), W(0x0003adeb60ed9b84),
+     W(0x0004765a63520e35), W(0x00011763af85cdf6)},
+    {W(0x0000000000000001)},
+    {W(0x00042d161a0dc31e), W(0x0002d1fbe80f7489), W(0x00076e12e651e1f2),
+     W(0x00043227610f9b94), W(0x0002b5e16765bcf4)}
+  },
+  {
+    {W(0x000071d9f02742e7), W(0x000352440861644e), W(0x000068f1eba6ce89),
+     W(0x000206478fd1bf16), W(0x00077715654f66b9)},
+    {W(0x0007d246242d67bb), W(0x0003f601092d974f), W(0x0003fce6455391c9),
+     W(0x00022ec9dc0c6f96), W(0x000455a2d4d1f1ae)},
+    {W(0x0000000000000001)},
+    {W(0x000026fbfb00c79c), W(0x0000b6b1bd30583a), W(0x000761b4e9c1fe0a),
+     W(0x0002dcad4928a252), W(0x0000d7c0f2d8b76f)}
+  },
+  {
+    {W(0x0000cbce4894c053), W(0x0004a6d616a609a9), W(0x00072c791820baea),
+     W(0x0005fc2a2e1a6acc), W(0x000591392afe36aa)},
+    {W(0x0004c5cf684345cc), W(0x00023b9f31398ec3), W(0x0002c7f8d393929d),
+     W(0x0001b389353ec570), W(0x00030e1ef6dd035e)},
+    {W(0x0000000000000001)},
+    {W(0x00067b0b942dd8d3), W(0x0000a0c486715fa4), W(0x00074f0dcbd75a7e),
+     W(0x0000fb9a66cef51f), W(0x00009556b06b89e2)}
+  },
+  {
+    {W(0x0006d22d059af0e0), W(0x0000b2f51a1eceba), W(0x00072b9ff86ca8f6),
+     W(0x00065b7b0cf9f8a7), W(0x0004fa7a89ecbd33)},
+    {W(0x0002def4d98380d9), W(0x0000e7651d3147b5), W(0x000443c1d6cad2f7),
+     W(0x00033b8837e7fa24), W(0x000796da7d98d837)},
+    {W(0x0000000000000001)},
+    {W(0x00054501ad6a75f8), W(0x000593971518af18), W(0x00062d9549487966),
+     W(0x000671a925147445), W(0x00049615e3a5a661)}
+  },
+  {
+    {W(0x00022deeac1a228a), W(0x0006278125cc46f9), W(0x0000f0886c366b70),
+     W(0x0007fb6aaba4b4f8), W(0x0000764833265e1e)},
+    {W(0x00037aab8d0cfe75), W(0x0006ca136c3a6746), W(0x0001aac218cfc892),
+     W(0x0002f3274c35d596), W(0x0007950ba459ed6f)},
+    {W(0x0000000000000001)},
+    {W(0x0001fda1348c410b), W(0x0000ff72799c40cf), W(0x0002b467c7ddce59),
+     W(0x00066e53fb38acee), W(0x0002de37bf3e0965)}
+  },
+  {
+    {W(0x0006656168403575), W(0x00048051dd74b092), W(0x000555e0d7b62114),
+     W(0x000617613ee1f346), W(0x0002533ebe91b257)},
+    {W(0x0004d634ea19a6bc), W(0x0001f4357158efd4), W(0x000798a80297c0ae),
+     W(0x0004ef8d17a4ee04), W(0x0000c916ee7df2a5)},
+    {W(0x0000000000000001)},
+    {W(0x0002d7def68b8dc9), W(0x000263ace9bfa3fa), W(0x0007d4e789d4ef72),
+     W(0x00056c4f50c47831), W(0x00056ea7580af6bf)}
+  },
+  {
+    {W(0x00055d2d25e794cc), W(0x00065bb8174cab07), W(0x00061264703349bd),
+     W(0x00034ff6e925c8e7), W(0x000476ed20840e2e)},
+    {W(0x0005522014431860), W(0x0001b34a56bd27ed), W(0x000535dc03a03c96),
+     W(0x00009665e10b2375), W(0x00066dfd27187654)},
+    {W(0x0000000000000001)},
+    {W(0x0004fc3570553515), W(0x0006f6907ea32082), W(0x0002f0ec59bf4b01),
+     W(0x0000644ba79ecea7), W(0x00052563560f796c)}
+  },
+  {
+    {W(0x00051bf7761eba68), W(0x0007ee9b22b9216b), W(0x000520723eec0f49),
+     W(0x00063e89e37290aa), W(0x000343bb65072521)},
+    {W(0x0003f34b4b34d371), W(0x000264051f61dbd2), W(0x0004b3ce48d062c7),
+     W(0x000140232cde7b70), W(0x000563211b4aa902)},
+    {W(0x0000000000000001)},
+    {W(0x0004f0bf210af1c0), W(0x0007cce4dfcfcfa3), W(0x00045ba437c22a40),
+     W(0x00072be01bbacd9a), W(0x0001c47c8493e4d6)}
+  },
+  {
+    {W(0x0002387f02175ec7), W(0x0002c011d52029aa), W(0x00031c46ca38f12d),
+     W(0x000472d118b10a94), W(0x000197d23d87d2e2)},
+    {W(0x0005ed7085360d43), W(0x00019ff5d7e46657), W(0x00017cba3111e85e),
+     W(0x0007ecac9a43c80a), W(0x00041024c7b17c45)},
+    {W(0x0000000000000001)},
+    {W(0x0004b17404bc49d4), W(0x0003e2cee0f0c06f), W(0x0002935a0e7d8104),
+     W(0x00068474ad986ef7), W(0x0006cc1d89c3329e)}
+  },
+  {
+    {W(0x0003fc6b30c63295), W(0x000312f50d4d0ac6), W(0x0006a8bea75f4cb4),
+     W(0x000203fa9a8c5ccc), W(0x0007f2e8b946cb1b)},
+    {W(0x0007a52b384a4db0), W(0x00022a53a8de0828), W(0x0002de383359fda2),
+     W(0x0000d172840dc709), W(0x00013bed878b7c63)},
+    {W(0x0000000000000001)},
+    {W(0x00031f903e278e28), W(0x0004be2c26305358), W(0x0006210d7dd482e6),
+     W(0x000652a37e3566dc), W(0x000131e81e981148)}
+  },
+  {
+    {W(0x000079a6f0aaeda8), W(0x0007ca15f94ce900), W(0x00065757fc379f6c),
+     W(0x0002d63008da146f), W(0x00010954c6aaf5ea)},
+    {W(0x0000c0f650f6ce38), W(0x0007f6dc18002142), W(0x0005970996c546be),
+     W(0x0004fa4ec646b68d), W(0x0001e7b1450b82a1)},
+    {W(0x0000000000000001)},
+    {W(0x0000629e919f1fa5), W(0x00055ea7b6a43e43), W(0x0000286a88bb64f9),
+     W(0x00026c7ce89b53fa), W(0x000189eb4edd95e5)}
+  },
+  {
+    {W(0x00021150a52c2220), W(0x0005ee246f96519e), W(0x0004bac743fa5b3c),
+     W(0x0000762ebbe209c6), W(0x0004aa6fb4005ef2)},
+    {W(0x0007c1e177086319), W(0x0003d0d4a2abb0ae), W(0x000594e33c4e5d18),
+     W(0x0000b5660250529e), W(0x000338f872501afc)},
+    {W(0x0000000000000001)},
+    {W(0x00032f00e4ccb4e0), W(0x0006ca97ce0ab138), W(0x000312fd963ac4c1),
+     W(0x00057f9f6253f13e), W(0x00039878bd57ac6c)}
+  },
+  {
+    {W(0x000233ff38b259bb), W(0x0001739ab88f9eec), W(0x000797a8c73b89af),
+     W(0x000105559c0aefc2), W(0x00067f16661a904c)},
+    {W(0x0002555554347e1d), W(0x0004c1977ab5bf92), W(0x0007cd12f8d371f2),
+     W(0x0006214630d7674f), W(0x000457999d27e804)},
+    {W(0x0000000000000001)},
+    {W(0x00050f32bcf1db7b), W(0x000571182ce3eb9f), W(0x0004c44c57f2cdf4),
+     W(0x00055ee83a304994), W(0x0001ac30a518519d)}
+  },
+  {
+    {W(0x0001aa034c9ef00d), W(0x0000d01176151a3e), W(0x0001159c0d1f4f4e),
+     W(0x00069d9a8fb5131c), W(0x000241e6bf44af71)},
+    {W(0x00072cdb6072ded2), W(0x0006aa86f641d2a6), W(0x00010905041a1ad8),
+     W(0x0003a17636f68786), W(0x0002cda1a45c62cd)},
+    {W(0x0000000000000001)},
+    {W(0x0007d73b549d9c0f), W(0x00004ce88a6f51e3), W(0x0004b5d03139038f),
+     W(0x000441f940291c36), W(0x0006dc2e83db95e6)}
+  },
+  {
+    {W(0x000632af3525f3aa), W(0x000632364cb63b2d), W(0x0002633636616f5c),
+     W(0x0004691bf3edcfa5), W(0x000674602af29698)},
+    {W(0x000578f0f5dd70a3), W(0x0003ebd32e2de05a), W(0x000258d2f29ea396),
+     W(0x00051ee9f2e63cbd), W(0x00018b52aba13175)},
+    {W(0x0000000000000001)},
+    {W(0x00002b981c6081b8), W(0x0001a0beef38358d), W(0x0001c95cea9fb062),
+     W(0x00026918d4023373), W(0x00035bd1eef5f999)}
+  },
+  {
+    {W(0x00050994c47c9e06), W(0x0001c428a14e0dcd), W(0x0000f483a7b363bf),
+     W(0x0001cb57417e945f), W(0x0004466461a7887d)},
+    {W(0x000748db66cbc051), W(0x0007aaa5605d303e), W(0x0006c47bbd76ce4f),
+     W(0x000393cc38101bad), W(0x00035b48ad04bed6)},
+    {W(0x0000000000000001)},
+    {W(0x0004d64ca29782de), W(0x000677db1cdd185f), W(0x0006311d54ec10a7),
+     W(0x0005945321c13008), W(0x0000ea8b3664b8af)}
+  },
+  {
+    {W(0x0004ec1a7e7722be), W(0x0002e1615ff7336f), W(0x000150458ae35dc4),
+     W(0x0007493988c717aa), W(0x0001912c2129becd)},
+    {W(0x00026c4cb1e17cb1), W(0x000797d63e5df37a), W(0x0001d3b84a870e3d),
+     W(0x0004afe298251e55), W(0x0006890762550f6f)},
+    {W(0x0000000000000001)},
+    {W(0x000683c21100cae4), W(0x00031c58697c15c2), W(0x000674b045fab0dc),
+     W(0x0003cba3a4a2725d), W(0x0001d6c77c3371ef)}
+  },
+  {
+    {W(0x0005307bde1a0112), W(0x0005ad2818f3a7c1), W(0x00072d85906a9b0f),
+     W(0x00071d6c578cfe25), W(0x0001ee7a68777f28)},
+    {W(0x0007302f79f85587), W(0x000031641b1f8c20), W(0x000733edf2a07843),
+     W(0x000180163a33109f), W(0x000545d5348e4b3b)},
+    {W(0x0000000000000001)},
+    {W(0x00010b0b3d95bffc), W(0x00011dac0acd29e4), W(0x0003dc66801c2267),
+     W(0x000561a27c04adab), W(0x0007737a478780d2)}
+  },
+  {
+    {W(0x00052e41a7301790), W(0x0007c0115aafdc2b), W(0x0007322ef9d0f067),
+     W(0x0000a42bd2629f74), W(0x000463fe97573fa8)},
+    {W(0x00069077bc8fa762), W(0x0004a6b23a06b94d), W(0x0006730d07189b00),
+     W(0x0004460a5f2c4b4e), W(0x0003de56f2052623)},
+    {W(0x0000000000000001)},
+    {W(0x00018dfa3f1846b8), W(0x00018305b5bfa8ea), W(0x0007a7c0694431eb),
+     W(0x0001de26aa44207b), W(0x0000fd42003265a6)}
+  },
+  {
+    {W(0x00009e8fcd1bc64b), W(0x00062c86c9f4d115), W(0x0005243854e003ff),
+     W(0x000030333a1ff572), W(0x0007d4f0af554f5c)},
+    {W(0x0000ec1482c02d43), W(0x0000d45b0a34b921), W(0x0006d90639bef4b5),
+     W(0x00070ab1247bb3c0), W(0x00030627e5d4e566)},
+    {W(0x0000000000000001)},
+    {W(0x00061062c51b08e3), W(0x0001ff9018af0565), W(0x00056dc4b2c0c309),
+     W(0x0006dfe195a50189), W(0x0001d3f5c25571d3)}
+  },
+  {
+    {W(0x00001b549fd36d46), W(0x0007697c51cefba4), W(0x00032128dad35f67),
+     W(0x0004a05efa5b9060), W(0x000273408834bab6)},
+    {W(0x00064fda17775718), W(0x00078d568b16e847), W(0x00062461733b0de6),
+     W(0x0005fd22112d3aa4), W(0x000264a6bdad3216)},
+    {W(0x0000000000000001)},
+    {W(0x00007eb174279904), W(0x0004413da8a92110), W(0x0003533461fe6712),
+     W(0x0003e34441221ec0), W(0x0003d67380549547)}
+  },
+  {
+    {W(0x0002f887965ea66c), W(0x00050f18f5803a2b), W(0x000524ad839011d3),
+     W(0x000697495198b1bb), W(0x0002bd65fa4db309)},
+    {W(0x0006deca71f14e88), W(0x000253afda511ab3), W(0x0003049174a234be),
+     W(0x0007731fa5a88a40), W(0x0007ff261b889c2e)},
+    {W(0x0000000000000001)},
+    {W(0x0004dab6ed2c775b), W(0x00019a2bd40d0d4e), W(0x00055a054f662bf7),
+     W(0x0001e4de4e0904ba), W(0x0004ef18734d1ebc)}
+  },
+  {
+    {W(0x0006f8cf188e7a38), W(0x0005812f3f47dfbd), W(0x0005c3ba99630401),
+     W(0x000783f3849f3dda), W(0x00006403659360ac)},
+    {W(0x00066c79fb7aef83), W(0x0000f97ea14a6419), W(0x0006317a07fba7f5),
+     W(0x000338c88d427e4f), W(0x000341986a42bf54)},
+    {W(0x0000000000000001)},
+    {W(0x0002f9527a545c37), W(0x0004e454309a39bd), W(0x00040f15998d71c7),
+     W(0x00025041c512ba92), W(0x0006fbd74f0c6525)}
+  },
+  {
+    {W(0x0002ab861e445643), W(0x000079457c255710), W(0x0006f2ebf5f18954),
+     W(0x000602a3a48d9e48), W(0x0000b60028e559ab)},
+    {W(0x0003122efc28c24f), W(0x000529b1806f459e), W(0x00012cf8f0804016),
+     W(0x00010427014e785d), W(0x0001c333aaf28273)},
+    {W(0x0000000000000001)},
+    {W(0x00064f1130af0886), W(0x00034e374d1ade19), W(0x0000158765697735),
+     W(0x00004dfd83d2cc03), W(0x0000d9d37107213c)}
+  },
+  {
+    {W(0x0001ba197c5491d4), W(0x0000ea4505535836), W(0x0004d0bbdb22185a),
+     W(0x0000cdc14d786125), W(0x0002fb775fe12985)},
+    {W(0x000081c17af56d39), W(0x0006db598d23cd03), W(0x00010a56b040556c),
+     W(0x00040b9210a179e1), W(0x000394545bc3cd57)},
+    {W(0x0000000000000001)},
+    {W(0x0002a3e8c640ca87), W(0x00059fee0879feae), W(0x00047ca0ebcb1154),
+     W(0x0000fca59eea1179), W(0x000225787ddbde3c)}
+  },
+  {
+    {W(0x0004f91f1600e7a6), W(0x00018c1ef64e4b34), W(0x0006ac29f43d87a5),
+     W(0x00036a491ea17469), W(0x00074b7f694bc8fa)},
+    {W(0x0006a9c3b43c682f), W(0x0002d061f5383ce6), W(0x0003b114d073a9ed),
+     W(0x00075d9de7d422c4), W(0x000145406733c799)},
+    {W(0x0000000000000001)},
+    {W(0x000145769002863a), W(0x000244c49df618d9), W(0x00049dc90c3b1130),
+     W(0x0000f5adfdfb2db5), W(0x00066d91f1fbdf1a)}
+  },
+  {
+    {W(0x00026dd3570e25a1), W(0x0006a4983bc4aed6), W(0x000564f5a0625f6c),
+     W(0x0007cf834949b6df), W(0x00075f603a4a84c6)},
+    {W(0x00078b399614c789), W(0x0006b2940f6436d0), W(0x00015352dbef4ebb),
+     W(0x00011ccf9e0fe7f0), W(0x000723c1c4aa2aee)},
+    {W(0x0000000000000001)},
+    {W(0x00043683d695ccf6), W(0x0000b70785ec1c61), W(0x0000b5a932478433),
+     W(0x00074736ac559280), W(0x0006af7e3123755c)}
+  },
+  {
+    {W(0x0001db5132c08e46), W(0x0002018f2abfa568), W(0x0003a32c740e51ab),
+     W(0x000010706451ad29), W(0x000115539ce7cc02)},
+    {W(0x0006525d5ffc21a0), W(0x0001987fac9f0bd7), W(0x000539624b6578c4),
+     W(0x00030316f0064361), W(0x00074f8e2c23b1ad)},
+    {W(0x0000000000000001)},
+    {W(0x00024949af76ac7c), W(0x0006ed8b414c0b56), W(0x000094eac5a72a95),
+     W(0x00045e58f9e1184b), W(0x00062677dc5e2570)}
+  },
+  {
+    {W(0x0001499869caf692), W(0x0000a97756a97967), W(0x00039df48d2141a8),
+     W(0x0007ed47627290b2), W(0x00029153374de27f)},
+    {W(0x0002c8c49ae51452), W(0x00066636abe2d163), W(0x000677b0c068ef55),
+     W(0x0005d52107c462f4), W(0x000258f16eebe76d)},
+    {W(0x0000000000000001)},
+    {W(0x00067e45d57e1409), W(0x0002cb7bbbe81473), W(0x0000a827abe9f864),
+     W(0x000680936d355723), W(0x0006abea57066d46)}
+  },
+  {
+    {W(0x0003c6952aa84f61), W(0x0002e9246dcfbc44), W(0x000012c4d2fa413f),
+     W(0x0001e37907c159bd), W(0x00031b63398fc165)},
+    {W(0x0002b2ee7df488a1), W(0x0004ab873a6bfc45), W(0x0006b43726575e24),
+     W(0x00053b60387fe9ab), W(0x000236dc99f7325b)},
+    {W(0x0000000000000001)},
+    {W(0x00025a4d5d070c41), W(0x0001b42e0cff0b70), W(0x00061b6ca7a87b0b),
+     W(0x0005133e49e617e8), W(0x00024fede55a0495)}
+  },
+  {
+    {W(0x00037caf1620fcf5), W(0x00068b27d6198a30), W(0x00038408c0a3d86c),
+     W(0x000016ed6e375ab7), W(0x0004d359688bb6fe)},
+    {W(0x0003bc76efb40d10), W(0x0002cda2ee05cf25), W(0x00029b34c6734041),
+     W(0x00045b21e90bfcfd), W(0x00054d242cb42043)},
+    {W(0x0000000000000001)},
+    {W(0x00068bc70bbbb81c), W(0x00030c7734237168), W(0x000675ceba8a6c6e),
+     W(0x000503b1260f9148), W(0x0007e4ade5aac66e)}
+  },
+  {
+    {W(0x0003a74dd82f62af), W(0x00079f1acc10fbf3), W(0x0005bfe618b467f8),
+     W(0x000738b842084cee), W(0x0005f3c3d7cb229b)},
+    {W(0x000127899874e343), W(0x0005d0cac2c3c779), W(0x00007c07d62223ae),
+     W(0x00065cb9338792fc), W(0x0006ec4d698a6021)},
+    {W(0x0000000000000001)},
+    {W(0x00034fa5c9e4de3e), W(0x0004a026d1ee361a), W(0x0001f62be02e30d1),
+     W(0x00062b4856b4e639), W(0x000221958c984e7d)}
+  },
+  {
+    {W(0x00014ba922c08825), W(0x000614a6f83926fa), W(0x0000912d7676b48b),
+     W(0x000028770553969a), W(0x00079b53661b5f12)},
+    {W(0x0003ce45b9e58b08), W(0x00026429350e3d1e), W(0x0006de5b8421bd13),
+     W(0x00037f4c99c042bf), W(0x0004e58444d20e06)},
+    {W(0x0000000000000001)},
+    {W(0x0000a5fec5bbe3b1), W(0x00057bc6b1a3198e), W(0x000788735b2de309),
+     W(0x00078177729e3436), W(0x0001b5860e88fc32)}
+  },
+  {
+    {W(0x00066bae88fc1c38), W(0x0004b1714d996290), W(0x0006321b492a763f),
+     W(0x0007e98b5d21cb7a), W(0x0005fa7de4150312)},
+    {W(0x000677aab69f84a9), W(0x0000fd2cd73cd210), W(0x00009c7cd9bb8339),
+     W(0x0004a16feb4a5363), W(0x000690132c493418)},
+    {W(0x0000000000000001)},
+    {W(0x000720efd77c5c9e), W(0x0001a8ea442dcabd), W(0x0005c2c7fc2af870),
+     W(0x00054e3027f90c41), W(0x00060563598d360b)}
+  },
+  {
+    {W(0x00024b9860486f35), W(0x00021ee01bfeb9c9), W(0x000380ac67b697e8),
+     W(0x0000e74540901376), W(0x00071469e4283785)},
+    {W(0x0003a4b77221221e), W(0x000503fde7407f4b), W(0x0000192b146052d2),
+     W(0x0003f1262458e831), W(0x00058753c455dbec)},
+    {W(0x0000000000000001)},
+    {W(0x0006f6f30e0939e1), W(0x000342bf454ecd34), W(0x000456fa2051d312),
+     W(0x00066d604d07ec32), W(0x000118baad8b66a8)}
+  },
+  {
+    {W(0x00059ebce8e46fb7), W(0x0003576aab019ff6), W(0x0001b91c821ade90),
+     W(0x00046a86d6cc246b), W(0x0001a0620060cbd9)},
+    {W(0x000112b1cd95e5b0), W(0x0006c9326ba71914), W(0x000017b4641b0f83),
+     W(0x000211d3a2bd1c64), W(0x00057957e816f11b)},
+    {W(0x0000000000000001)},
+    {W(0x00000ca360ee179b), W(0x00011880413851d8), W(0x0005043d5bba004e),
+     W(0x0004c040408dbcf8), W(0x000601593d2fb98d)}
+  },
+  {
+    {W(0x000426ff8c9f7a8f), W(0x000647a56b8665a8), W(0x00079b1f06646abd),
+     W(0x0005474595739cf4), W(0x0000bb96cc51c037)},
+    {W(0x000414e75c6e48b3), W(0x0001644c21bb45d7), W(0x00062f8c9a48822c),
+     W(0x0007c55c29a56d37), W(0x0003a8d61c1de732)},
+    {W(0x0000000000000001)},
+    {W(0x00004cfb1a798fe3), W(0x00010804ace35ddc), W(0x0000cce7065b28d9),
+     W(0x0007597a2a8440d6), W(0x0001659591346fcd)}
+  },
+  {
+    {W(0x0006e439f556d90c), W(0x000380cf4e416d6b), W(0x000527ba26a1f704),
+     W(0x0006a473f89660e3), W(0x00001398cec6e900)},
+    {W(0x00037276a178cfcc), W(0x0007b226555a174a), W(0x0001ccd7d8f604e2),
+     W(0x00064e6840f22b48), W(0x00076e48dffb16f8)},
+    {W(0x0000000000000001)},
+    {W(0x00028b007c360c41), W(0x0005223686f8bd14), W(0x00056952a4d87476),
+     W(0x00038e1fb036fad6), W(0x0007cd447b4b0968)}
+  },
+  {
+    {W(0x0001d1a36a19c473), W(0x00016756f4f8b9ef), W(0x0000778412a0976b),
+     W(0x0007e3f2081f3809), W(0x000547846d8dc91c)},
+    {W(0x000052cac41c293d), W(0x00059c05f806f87c), W(0x0002a581bbcbf0b6),
+     W(0x0007667f0d6908cb), W(0x0005116196958166)},
+    {W(0x0000000000000001)},
+    {W(0x00031bb0f65dfc8c), W(0x0001faf266dc345e), W(0x00050ccc13a5a679),
+     W(0x0005e5ca7a03b575), W(0x0007d65c1f18dbf5)}
+  },
+  {
+    {W(0x0002fffb7cf0eb61), W(0x0002195165585877), W(0x0001823f9e3d9776),
+     W(0x0005115d47621eab), W(0x00024a061aab3473)},
+    {W(0x0005413953672711), W(0x00067a8615876da8), W(0x0002c16ca03bcc79),
+     W(0x0000956a18a9d991), W(0x0002f754df145094)},
+    {W(0x0000000000000001)},
+    {W(0x00021fa0c54d6b13), W(0x000345c7e9d6e665), W(0x0003841c9db0bc76),
+     W(0x000496b69afd4cb3), W(0x0001738697d77926)}
+  },
+  {
+    {W(0x0003b3f9db8a2c0f), W(0x0000899c4adec638), W(0x0005bbdd95e8bbfa),
+     W(0x00014875622ee6b8), W(0x00076b253e8bc8b4)},
+    {W(0x0002966f667620eb), W(0x00061ee72ef05629), W(0x0001192cb0c883c1),
+     W(0x00029aace91b738b), W(0x0006d00dee37736a)},
+    {W(0x0000000000000001)},
+    {W(0x000183193ec75f55), W(0x00057da6476dca5c), W(0x0001e9c05d8444ec),
+     W(0x00024c25bc8e68b4), W(0x0002884fa2af8d70)}
+  },
+  {
+    {W(0x0001cbc30f5d99b5), W(0x0000c0937fce0f26), W(0x00050df56cfc37b4),
+     W(0x000422c43aa76ff4), W(0x0004a4e2586cc342)},
+    {W(0x000614eabe981301), W(0x0006768a093c1d6a), W(0x0007cae0047befcc),
+     W(0x0006f9b85f5cf277), W(0x00073202ad666697)},
+    {W(0x0000000000000001)},
+    {W(0x000573049b8ebe30), W(0x000621893395c744), W(0x000096d7d51387ba),
+     W(0x0007169c34423080), W(0x0003a0638c48b8ba)}
+  },
+  {
+    {W(0x00028feec332affb), W(0x000235ca79197b36), W(0x0007fe576e8f82e2),
+     W(0x0000b5a6220a93bf), W(0x00007fc93705f5f1)},
+    {W(0x00058a1debdfa0a0), W(0x0006714b9bfff1b9), W(0x000183c32384fe41),
+     W(0x0000d6c46aad6965), W(0x0001cbc06bd8298c)},
+    {W(0x0000000000000001)},
+    {W(0x0004d6b80485d204), W(0x0004ffd68918e25a), W(0x0000bceafe496a1b),
+     W(0x0006c5cc5c49d690), W(0x000268a1855a8f0e)}
+  },
+  {
+    {W(0x0007a4366cb250b6), W(0x000008ceeb632a13), W(0x00065447a9422148),
+     W(0x00036916b7d5b447), W(0x0000ea57a6ea9167)},
+    {W(0x0003f23960c92a28), W(0x000119307b8b127b), W(0x00079bac1972da79),
+     W(0x0004c21c5c8bac96), W(0x00012d23088e41fc)},
+    {W(0x0000000000000001)},
+    {W(0x000590577fb64a6b), W(0x00063b4cd4720de4), W(0x00019c4c6419be12),
+     W(0x0000d27d4aac16f5), W(0x0007653e05a7e505)}
+  },
+  {
+    {W(0x00044a998030a648), W(0x000238f888b7f068), W(0x00049b16d3eb7b03),
+     W(0x0000a88c1190f0f7), W(0x0007fde392d6dac0)},
+    {W(0x0000c020acd8be37), W(0x00004a3cd8e78a26), W(0x0001064c3ec42f47),
+     W(0x000091a05a278406), W(0x0003825e2da468c7)},
+    {W(0x0000000000000001)},
+    {W(0x0006177b8bddf594), W(0x0002dcf79fe3293c), W(0x00019abb014935a1),
+     W(0x0006a3e8d4fbe8b6), W(0x0003de9fa92a3b9e)}
+  },
+  {
+    {W(0x0002ff94786b2f2e), W(0x0005961fa213494f), W(0x0001e3cef751f320),
+     W(0x00025fea3909d602), W(0x0006d684ee69822a)},
+    {W(0x00071f822e4baae2), W(0x000534361e2a957f), W(0x000111f435458c04),
+     W(0x000388d68b1abbac), W(0x0000c1724b09bcad)},
+    {W(0x0000000000000001)},
+    {W(0x0006906c4bb21b4b), W(0x0000debf48d0801a), W(0x0005ef7ffc805607),
+     W(0x0004070c0fdf4997), W(0x0005c088f7ec02da)}
+  },
+  {
+    {W(0x0007cde3fa7535bc), W(0x0002a47b9be3525d), W(0x0002634052ada460),
+     W(0x000551ebd4294575), W(0x0002a4e5199e8c12)},
+    {W(0x0005b46ef991ff26), W(0x000223102ce5c7e7), W(0x0001258574884859),
+     W(0x0005f16279a86254), W(0x00063df27d1b78d3)},
+    {W(0x0000000000000001)},
+    {W(0x000436909e081da2), W(0x000128506378dd9f), W(0x00020997fc968507),
+     W(0x00015702b6f8ebb2), W(0x0006e755310163ce)}
+  },
+  {
+    {W(0x000049b2db9e7b7e), W(0x0004a688aaaf64aa), W(0x000196182d24a93d),
+     W(0x00064dc1318628b1), W(0x000457aa3fd253c2)},
+    {W(0x00058d78a931f395), W(0x0002949bd1bc7e22), W(0x000332a0d6c131cc),
+     W(0x00037d181cfb429f), W(0x00011776c2c0a104)},
+    {W(0x0000000000000001)},
+    {W(0x0006f2e3096fa8ab), W(0x00027352a087a271), W(0x0002ab5375e72c9f),
+     W(0x0007c766b1a0e9e2), W(0x000027c40d7c505e)}
+  },
+  {
+    {W(0x0005469914d7bd22), W(0x0003b64cf1a46541), W(0x0003da209d3ad921),
+     W(0x0000d9d82048b894), W(0x00035fdc0c0523d0)},
+    {W(0x0004c8fc15aa820d), W(0x00058570e4be7226), W(0x000050345aba4083),
+     W(0x0003897462590084), W(0x0000521361dfce28)},
+    {W(0x0000000000000001)},
+    {W(0x000229fde6067cd5), W(0x0007d7c98d13a2a5), W(0x00078ca49bcdf604),
+     W(0x0003dced4cbac8a6), W(0x0001b29746510404)}
+  },
+  {
+    {W(0x000324942fc46b58), W(0x00047162af360843), W(0x00077473587ebadc),
+     W(0x00028baa95322a6d), W(0x00028800ce1a5ec3)},
+    {W(0x0002a650120f666e), W(0x00056878c72dfc8d), W(0x0002ec87911fe49d),
+     W(0x0001c35ebccd2e3f), W(0x0005d0d5b42093c0)},
+    {W(0x0000000000000001)},
+    {W(0x000504c317a9d9cc), W(0x0005b1cdb30a233e), W(0x00019065d39058d3),
+     W(0x000233a6418909fb), W(0x00003f19bb54957e)}
+  },
+  {
+    {W(0x000535b7d6fa3b7d), W(0x000184a21249c02d), W(0x0003052a6c29807e),
+     W(0x000148f24e549669), W(0x0002b4ebb62a9ab3)},
+    {W(0x000775612789d060), W(0x000006dffe9237a9), W(0x0001427e0137e318),
+     W(0x0002c0c454925074), W(0x00055a08917c3626)},
+    {W(0x0000000000000001)},
+    {W(0x00047af00c2bac88), W(0x0007bd2570c8edcc), W(0x0003ed24ded1ac53),
+     W(0x0001c1ffe4e573db), W(0x00049c7630bf7e6d)}
+  },
+  {
+    {W(0x0002df5505ff401c), W(0x000280ba78bb6aab), W(0x0007f21bfb1e9a73),
+     W(0x00013e9e46ad77ff), W(0x000798e304c7676d)},
+    {W(0x00068ddefae07e62), W(0x00066bda36757382), W(0x0003c7acd37677e4),
+     W(0x000476c1ac1be1ad), W(0x000532c3e5a8ca74)},
+    {W(0x0000000000000001)},
+    {W(0x000740b41a60c9f9), W(0x0000cdb6e739a550), W(0x00048b83f924f877),
+     W(0x0004961721e5a022), W(0x0000d6aa00d42527)}
+  },
+  {
+    {W(0x000438a00b18fca1), W(0x000079bb5bbb14d5), W(0x00003286fcfcb89f),
+     W(0x00037066e86ec5dc), W(0x0001f102ba8ad04c)},
+    {W(0x0000f254a150fdd7), W(0x000601451a8ccf65), W(0x0001741179ad14df),
+     W(0x000798d156a59898), W(0x0001a9eecb18b12b)},
+    {W(0x0000000000000001)},
+    {W(0x0007611a97913da9), W(0x00000d9787c14ffd), W(0x0006094d6b6fe279),
+     W(0x0000eb25059932f7), W(0x0005bede8f2a1ccd)}
+  },
+  {
+    {W(0x00002e74967fbb52), W(0x000189eb850eb267), W(0x00024d61c8e654c7),
+     W(0x00057ff21c68d306), W(0x00020b526800ee28)},
+    {W(0x00065b919cc0841d), W(0x0002b666082be6a3), W(0x0004dc2c9d519c3e),
+     W(0x0006e55b789b37b4), W(0x0006088f44c9b4a5)},
+    {W(0x0000000000000001)},
+    {W(0x0001fe88da9fb744), W(0x000242270ffd0e17), W(0x00046ae58ae64a5e),
+     W(0x00043d922785efe6), W(0x0001e607757320a1)}
+  },
+  {
+    {W(0x00023d54a6bdbde1), W(0x0003b59ed9b4be98), W(0x000170492142f926),
+     W(0x00048e9492c6d76e), W(0x00022e199eee3d70)},
+    {W(0x0003d48b1b7e16b3), W(0x000783ff0b130fb5), W(0x000753dbc1833ea8),
+     W(0x000765295f48a7c9), W(0x0000d4ddf8528a74)},
+    {W(0x0000000000000001)},
+    {W(0x00022d2c8b5b8f26), W(0x0007a5f0f701bc9d), W(0x0004174c5454760e),
+     W(0x00020a103a18fdad), W(0x0001505529ccfb21)}
+  },
+  {
+    {W(0x0007a3a33e198104), W(0x0006fd798eea49ab), W(0x0006ec815bdcd41c),
+     W(0x00039f053f52ca28), W(0x00048fe2913993c0)},
+    {W(0x0005a7c3c44f8478), W(0x000256bbd920e893), W(0x00068806d438c7c8),
+     W(0x0007e02fd23fa434), W(0x000134e824d39c07)},
+    {W(0x0000000000000001)},
+    {W(0x00056d4fecc4a44a), W(0x00071e624ac0159b), W(0x0003b7b782dfc8bb),
+     W(0x0006e69303522b18), W(0x0005942a1b315302)}
+  },
+  {
+    {W(0x0000d1b18762ba80), W(0x00028c0ccc5a06fe), W(0x0000b5f7656c35ea),
+     W(0x0006df0ee5ab3bf1), W(0x0005949b089f7ce3)},
+    {W(0x0006c106e49e301a), W(0x0003f5bf21e5cee4), W(0x00035e9b9a11885d),
+     W(0x00071e54abc5da59), W(0x0001c22871fd94dd)},
+    {W(0x0000000000000001)},
+    {W(0x00066075a5a24060), W(0x00069f05610a22f7), W(0x0000946da4dd8613),
+     W(0x00057794f155e7b1), W(0x000787ffabc4c799)}
+  },
+  {
+    {W(0x000428756d5a9ba6), W(0x00033a4720aa096d), W(0x0001bd15efd2b01f),
+     W(0x0000855f83e0e23c), W(0x0000e96fa75cf5ce)},
+    {W(0x00042d1738a499e4), W(0x0004f2943f41676e), W(0x0003e29311332928),
+     W(0x0004f334e2a2240d), W(0x00007269a199df76)},
+    {W(0x0000000000000001)},
+    {W(0x0004b126069f5ea5), W(0x0004e2283ba94123), W(0x00059c491e277e36),
+     W(0x000392ead1945e74), W(0x00058083fe1b541c)}
+  },
+  {
+    {W(0x00006180a3318a8a), W(0x0003eb1979014108), W(0x00032be96ca188b2),
+     W(0x00059b04605e303c), W(0x00049179f96f2740)},
+    {W(0x0007a85932952278), W(0x00053f1269de5fee), W(0x00029fae8a4f5851),
+     W(0x0005605cfdc92d56), W(0x00013350c28c5d91)},
+    {W(0x0000000000000001)},
+    {W(0x00078320f66ec9a4), W(0x00020fb779f05f8e), W(0x000165913dd6b006),
+     W(0x00048f8d1549d9bb), W(0x0007d74665be0044)}
+  },
+  {
+    {W(0x0005f0b0ee4512b4), W(0x00051dba2022016a), W(0x000620a80de529ca),
+     W(0x0004da9dacbe529c), W(0x000058a2de9ac0b9)},
+    {W(0x0004287a61608a0c), W(0x0000a961088bf201), W(0x0000961183207359),
+     W(0x0004056a5af0019f), W(0x000293b019ef5bd6)},
+    {W(0x0000000000000001)},
+    {W(0x0003b49cd60ddf6c), W(0x00061cef033bc697), W(0x00007f56e65dc57b),
+     W(0x0002de7cb16ead1d), W(0x0003acf8bacdbf02)}
+  },
+  {
+    {W(0x000178735feb043f), W(0x00016b6d43426dee), W(0x0005641dd72f3cad),
+     W(0x00079591b1234fda), W(0x000442bf40550b02)},
+    {W(0x00009885d81208dc), W(0x000120bacbf083d2), W(0x0004a895eb3ac227),
+     W(0x00058fbc0598c433), W(0x00005c7dfb2900e9)},
+    {W(0x0000000000000001)},
+    {W(0x00057c7d10837e93), W(0x0002c2dd1f4dfc3f), W(0x000779e830b5fb76),
+     W(0x000498051b728459), W(0x0007db0257eccb1e)}
+  },
+  {
+    {W(0x00041619d94a6284), W(0x000291a7e58d3eaf), W(0x00060a8959cae771),
+     W(0x0007352d3618efc0), W(0x0000f30571ca3fed)},
+    {W(0x0005f1ba5cfaca98), W(0x0006998e76c9bed2), W(0x00020ebe4f46e15e),
+     W(0x0005118682ddac18), W(0x000604fa17497ec2)},
+    {W(0x0000000000000001)},
+    {W(0x00058198884f286d), W(0x0002ef1547ef9ca6), W(0x0007c17c6fe2dcdf),
+     W(0x00038a7dce4138ff), W(0x0001e08fa1125a63)}
+  },
+  {
+    {W(0x00054913a41a2066), W(0x00051362d443c1a4), W(0x0004f100f5538a71),
+     W(0x000318f7c37366dc), W(0x0005e675e21180eb)},
+    {W(0x00006f3580629add), W(0x00002ce725e85dbb), W(0x00049704f3ef8abc),
+     W(0x0001291503871540), W(0x0006eaa767325c24)},
+    {W(0x0000000000000001)},
+    {W(0x0007cfc8b170da6a), W(0x0005f43325da189d), W(0x00058c6703421eb0),
+     W(0x00028f01d1163825), W(0x00050e7e4a00ff92)}
+  },
+  {
+    {W(0x0004a1d6cff756d5), W(0x000369f85b197b2c), W(0x00016183ff80c1ca),
+     W(0x000593c98b7b2574), W(0x00022fba5097ba88)},
+    {W(0x0001e47ebc3c872d), W(0x0001e3f56a2573ba), W(0x000482b5d822407e),
+     W(0x00056da0dc846ecb), W(0x0000f49705d30236)},
+    {W(0x0000000000000001)},
+    {W(0x0001673221c06790), W(0x000709aeb7a57c0a), W(0x000553fb5b93dfa2),
+     W(0x00040784b6c17dba), W(0x00031dee20c81596)}
+  },
+  {
+    {W(0x0005ed41e9295fb6), W(0x000088ad6af59dfd), W(0x00001315e3fc4f73),
+     W(0x0004628f438626ef), W(0x0003787e2c09548d)},
+    {W(0x00061864955a4aa0), W(0x0000d64fcd89b1e0), W(0x0007c8dcae24d400),
+     W(0x000676ef5e41ff09), W(0x00036e4f2f1f8d34)},
+    {W(0x0000000000000001)},
+    {W(0x000146b987a51f38), W(0x0005ee112cbec0b8), W(0x0004c7f4ba2d1f39),
+     W(0x0003adcc54107de3), W(0x000067eaa201cb5b)}
+  },
+  {
+    {W(0x0005915e2eb04756), W(0x00034defa0b22068), W(0x00016bd609ec0a2d),
+     W(0x000323f3bb540ee6), W(0x000251340fec6824)},
+    {W(0x000404b21914aa7e), W(0x000134db919c16f3), W(0x0000d6746857acce),
+     W(0x0007282bc1e12438), W(0x000690ac7f880dd0)},
+    {W(0x0000000000000001)},
+    {W(0x0003b86aee7eadd1), W(0x00054d500952dabc), W(0x000661ea8ab9a2fd),
+     W(0x000190e0b15c81b6), W(0x0003e25580a43fe4)}
+  },
+  {
+    {W(0x0003f930180f9639), W(0x0004c9e586692957), W(0x000755fac88ae6a7),
+     W(0x00006ff745f210ba), W(0x0004188cc29a9480)},
+    {W(0x0006c1d0a8ebe955), W(0x0003ceb18b66e4b5), W(0x0002903d7f063557),
+     W(0x00072e8e12153bed), W(0x000782a4f4a05b53)},
+    {W(0x0000000000000001)},
+    {W(0x0003f1f960badb33), W(0x00061c5b655d8a60), W(0x00000fc4c2fb6309),
+     W(0x00003628d99540ab), W(0x0007dbde726aabab)}
+  },
+  {
+    {W(0x00059670f2e3b4a2), W(0x000115aee19cfb0c), W(0x00036341a2921545),
+     W(0x000758d67643278c), W(0x0007ff17c97f2fc5)},
+    {W(0x0004330971f57b8e), W(0x00052dab1af5299d), W(0x0006c3c80fe950d9),
+     W(0x000363c8e89d3133), W(0x0003b13038837d7f)},
+    {W(0x0000000000000001)},
+    {W(0x0007cafa4f3c8577), W(0x000442496e4121ed), W(0x0003e47f0f7e7251),
+     W(0x000309d25e6af040), W(0x000670fd57db28d1)}
+  },
+  {
+    {W(0x00025e970abc61dd), W(0x0004658fc7ebff46), W(0x000600ff3761377d),
+     W(0x0005a68a8c2e6a73), W(0x00042449fd1b1370)},
+    {W(0x00027c07a862ddaa), W(0x0002b7a163fb7d2d), W(0x000040cf23bdb50f),
+     W(0x00068bfb28e1a851), W(0x00056159261cd23a)},
+    {W(0x0000000000000001)},
+    {W(0x000655c3fa5ab1fc), W(0x0004da7ebcc1786a), W(0x00017a57ba255ee6),
+     W(0x00039d43a4e6bbde), W(0x0002159ec72315d6)}
+  },
+  {
+    {W(0x0006ceeb43205432), W(0x000285ff2301a950), W(0x00017afc2870cd02),
+     W(0x00045e5b95e08cb1), W(0x000176ff20810dde)},
+    {W(0x0004a543bee5141f), W(0x0006c20b270a02b4), W(0x0002d23ac428beb9),
+     W(0x0000eb402a717325), W(0x0007c9ffadf86fec)},
+    {W(0x0000000000000001)},
+    {W(0x0005159a5eef3be6), W(0x0004edfcc61fb55d), W(0x0006ef16c6851e71),
+     W(0x000732b11ca66fbe), W(0x0002ccb3444fd1c9)}
+  },
+  {
+    {W(0x00037378d4694f0a), W(0x0007476981d54d29), W(0x000006ca5ec2f234),
+     W(0x00066594edb32c96), W(0x000074f588083305)},
+    {W(0x0003b71e8821ee28), W(0x000685d43e87225a), W(0x000685b772c24e45),
+     W(0x00001b1b7c358b44), W(0x0006d6518095d78c)},
+    {W(0x0000000000000001)},
+    {W(0x00067c24ed4b19b2), W(0x0004c4fe8bbf0dd0), W(0x0006139cd07b96c0),
+     W(0x0003dacaabeba6df), W(0x0001ed33960da033)}
+  },
+  {
+    {W(0x0002e1beb02f3ba9), W(0x00032df8a15a316e), W(0x00058cbb9da715c3),
+     W(0x00030eb01c10a935), W(0x0005f7ba7875b96b)},
+    {W(0x0005763cb6834715), W(0x00023e39911b24b2), W(0x0003b960a3cb95de),
+     W(0x000407da99e97753), W(0x0000d272c6b72cc0)},
+    {W(0x0000000000000001)},
+    {W(0x0007bc107f58c717), W(0x00011b998b2e4941), W(0x00043624a39f7b29),
+     W(0x0000849d465a88ea), W(0x000515073f933db9)}
+  },
+  {
+    {W(0x0001b4fcb290473f), W(0x0000bc5e9c78df03), W(0x0007447cf76d2f68),
+     W(0x000027d283e9cd85), W(0x0001e8333bb94672)},
+    {W(0x0000a6e1498b57fc), W(0x0003cf86b47eaf56), W(0x00045be382803831),
+     W(0x0007d076401b7f35), W(0x0004c17a8f459f1f)},
+    {W(0x0000000000000001)},
+    {W(0x0007a9b0f6bc574d), W(0x00047d1945541e23), W(0x0005ecf3fd566054),
+     W(0x0007a7dc04052ea4), W(0x00076b14e31a743a)}
+  },
+  {
+    {W(0x00016d4a3cfed684), W(0x0002cc800bf4f438), W(0x000388a3f59927da),
+     W(0x000505744c43a389), W(0x00015c0b9bf25f49)},
+    {W(0x0000bcc143dcacaf), W(0x0001ed95268f2038), W(0x0003752ae3e30f46),
+     W(0x00022637a19b5878), W(0x00008fcecc50220f)},
+    {W(0x0000000000000001)},
+    {W(0x0002b1f605fa99c8), W(0x00035ef8da59e96b), W(0x0007e915976b9f86),
+     W(0x000310b8e105b715), W(0x000225da7d77aefe)}
+  },
+  {
+    {W(0x00078618a0f08617), W(0x0004592108255adc), W(0x00043e07e82cd7a3),
+     W(0x000449463cb160d8), W(0x0005f7537f8f26f9)},
+    {W(0x0002f3c171f7533a), W(0x000526ecbc0c0465), W(0x0000888b1e5ab813),
+     W(0x000365afcc5ccda8), W(0x000325a060bfcd21)},
+    {W(0x0000000000000001)},
+    {W(0x0003ccc1c6e206e0), W(0x0002daec3c96ad0c), W(0x00033ad58bb362c3),
+     W(0x00026fbf54161e87), W(0x0007bfeee5c30cf4)}
+  },
+  {
+    {W(0x0002aa629d432c28), W(0x0003323c1f4d1dbf), W(0x0006a169369aa94d),
+     W(0x0000007862a3b086), W(0x00018422d95ce31b)},
+    {W(0x00052b76ce9c2770), W(0x000573ff47d718f4), W(0x0005fee09247d914),
+     W(0x0001c6b27e76776b), W(0x00032f166b6f52a4)},
+    {W(0x0000000000000001)},
+    {W(0x0004dafd4650d2a2), W(0x0004bd4a19946cdb), W(0x0000c544c561910c),
+     W(0x0002ed8c81a245d5), W(0x000712b462e50787)}
+  },
+  {
+    {W(0x0007256dc4d02f86), W(0x000165a5f6829c77), W(0x0002282534a1fd25),
+     W(0x00018c289003873d), W(0x00055b6b6752a430)},
+    {W(0x00010f6a9cd38618), W(0x0005ddca3e04b375), W(0x00069666e70113f2),
+     W(0x0007d682efe96ae9), W(0x0005bd229197d0e9)},
+    {W(0x0000000000000001)},
+    {W(0x0004c383c10f18ac), W(0x0001d50444e966f4), W(0x00076e4ec7b42aef),
+     W(0x0002404468eaf8e4), W(0x00028d550e80ec70)}
+  },
+  {
+    {W(0x0005a589d51e96d8), W(0x0006e2f31cd4a7b6), W(0x00051196219ed33c),
+     W(0x0007a88d59798649), W(0x0004b525929cd169)},
+    {W(0x0000074b54189182), W(0x0003fdeb2b7b7c92), W(0x0005c16e3f304525),
+     W(0x00063e50372c4c3a), W(0x00049623cb154dfc)},
+    {W(0x0000000000000001)},
+    {W(0x00000aa4c106d68d), W(0x00010cd70e7ef1e8), W(0x0006da8fe6abd0c4),
+     W(0x00030c3fd3b00ee0), W(0x0006c087f71102a2)}
+  },
+  {
+    {W(0x0003e969a6370af9), W(0x0003a37a47f0dadf), W(0x0005deb5240c5c61),
+     W(0x0001573e63c3a997), W(0x0000689315d56f9d)},
+    {W(0x0003e6237a5fc661), W(0x0001a6d54651ab13), W(0x00012cabc1b69b90),
+     W(0x0002c00338ac79fb), W(0x0006066401c7769d)},
+    {W(0x0000000000000001)},
+    {W(0x00053cbd74cd6778), W(0x0005a88fb12904f6), W(0x00040650f7cfbb5c),
+     W(0x000077890f84427b), W(0x0007ec3ebe00f4b6)}
+  },
+  {
+    {W(0x000085fd961650d6), W(0x0007983ea034da1f), W(0x0005c36e61854c29),
+     W(0x0003f4847ea31bd6), W(0x0003bbb62c8e9896)},
+    {W(0x0003d47b555209d7), W(0x0001c7d4800bf99d), W(0x0000230f85a96300),
+     W(0x000641df9fc1038f), W(0x00075f39ca44769d)},
+    {W(0x0000000000000001)},
+    {W(0x0006644388bf3b22), W(0x0002e97fe391c36c), W(0x0005457ecd46a34e),
+     W(0x00061af254118fa8), W(0x00031ab79aecde2d)}
+  },
+  {
+    {W(0x000017a6b27afc7d), W(0x0001e59f51ec5a3a), W(0x000270ec8510f61e),
+     W(0x0000a5d6693ef0ef), W(0x00023a5f0c0748f9)},
+    {W(0x0000cfc085b66153), W(0x0004d7de6d7eef53), W(0x000520be0f453fea),
+     W(0x0001584acf7d99be), W(0x000137a1a4e21b0f)},
+    {W(0x0000000000000001)},
+    {W(0x00040fc70b0c18db), W(0x00005658a3032c01), W(0x0006611ae9b6093f),
+     W(0x0002f0b7fbcc3a35), W(0x00013349dff2ef52)}
+  },
+  {
+    {W(0x000557b9f2c4f676), W(0x00068518bd574477), W(0x0001d4d9c7aa703b),
+     W(0x0001ddcd970d268b), W(0x000297f347fa2955)},
+    {W(0x00013d1b08eb6755), W(0x0004e45994d148e4), W(0x00060051fead29a8),
+     W(0x0003b6a061e79015), W(0x00013bf902d15f8f)},
+    {W(0x0000000000000001)},
+    {W(0x0003812ea86c9192), W(0x0002ee0785ed2733), W(0x0003794ed0ec24c0),
+     W(0x0001c5c9d695c0df), W(0x00079ea3ca376b88)}
+  },
+  {
+    {W(0x00050d154b897148), W(0x0001d04d9fd81664), W(0x00078c3f7773f719),
+     W(0x0001b8626b043aeb), W(0x0007a753da0b81a8)},
+    {W(0x000007760a37112b), W(0x0002f70942e6c93b), W(0x0006d81a605db3d6),
+     W(0x00029012297325ab), W(0x000666c405ce7302)},
+    {W(0x0000000000000001)},
+    {W(0x00051b6e78888782), W(0x0005773c6118cbb7), W(0x00068ec570ffe5ec),
+     W(0x0000f8e92f701c5f), W(0x000050b3ac986250)}
+  },
+  {
+    {W(0x0006de2c39d9074a), W(0x0000fbce53f99479), W(0x00077d5c94812432),
+     W(0x0006e43cb6b237c9), W(0x000535b743923a41)},
+    {W(0x000511cce1e98722), W(0x0006bfbf8bd6199e), W(0x00029a1d36507d2d),
+     W(0x0002bfab890dff44), W(0x0007d9959c997086)},
+    {W(0x0000000000000001)},
+    {W(0x00007d43554ca100), W(0x00079aedbac3a2cd), W(0x0006b54cf7678be2),
+     W(0x0006143ae8ae0641), W(0x000217ea3242bd72)}
+  },
+  {
+    {W(0x0002ea5ad905ecbd), W(0x0005bceb6adf77a7), W(0x0006ea4b943c5049),
+     W(0x0006b308de57f7ea), W(0x0005e1112de6bfe6)},
+    {W(0x0007663101a12d10), W(0x000025488038051e), W(0x0003ad5528068f90),
+     W(0x0001434f03c78bcf), W(0x00059a98a4f19f54)},
+    {W(0x0000000000000001)},
+    {W(0x000760cb17389c88), W(0x0000996f278648dc), W(0x00034cd5de2917f2),
+     W(0x000008bc1ea0aab3), W(0x0007b4ca01f23f4d)}
+  },
+  {
+    {W(0x0000449f4bd77da3), W(0x0001d89e2ba4b872), W(0x000192a6e47eed83),
+     W(0x000041ecfd448e77), W(0x0006e4fed6a3c979)},
+    {W(0x0002e0c9d0571833), W(0x0003e8e8a424069c), W(0x000799f722b34cdb),
+     W(0x0002da319bb8ea4e), W(0x000104ab87e21b43)},
+    {W(0x0000000000000001)},
+    {W(0x0001e1e7d34b1836), W(0x000463ffdc6e0b04), W(0x0003333c8ba3fb95),
+     W(0x00018c1b1fa8096d), W(0x0007290fa46e83dd)}
+  },
+  {
+    {W(0x00069bed477b765d), W(0x00040e9ec5dec7fe), W(0x00044c9a6edc393f),
+     W(0x0002f3dfe8db2b7b), W(0x0006a88a661aff19)},
+    {W(0x00070242d0b7e70e), W(0x0001bf33c063fe44), W(0x0004fbeb54f58551),
+     W(0x0005f45702c0366b), W(0x0007720735c97281)},
+    {W(0x0000000000000001)},
+    {W(0x000265161bef656a), W(0x00014994a0b8cf69), W(0x0007e4c90f0752fe),
+     W(0x000733c3b0768f1e), W(0x00070581078795f3)}
+  },
+  {
+    {W(0x00062ef9eea5300e), W(0x0003b7d176bff513), W(0x0001c460a344179b),
+     W(0x000210d4a6bfda32), W(0x0001db25cca9bdfe)},
+    {W(0x00068baa718f6c1a), W(0x0003626bcde14e01), W(0x0006e5c702ef73e2),
+     W(0x0004f3d97b9fe417), W(0x00018d90bbf7f4ac)},
+    {W(0x0000000000000001)},
+    {W(0x00010507c2fc8412), W(0x000601eb1a43c13a), W(0x0000a47ab20e069f),
+     W(0x00009e0c3e81948e), W(0x00053ceab243f633)}
+  },
+  {
+    {W(0x00032e8c5b9c44cb), W(0x0004b62cb8442645), W(0x0003ab6261f5c4be),
+     W(0x0006831c3e79a318), W(0x0007c55963511997)},
+    {W(0x00042d9f4d3776a6), W(0x000649809923d8fc), W(0x00028d925067ef32),
+     W(0x0002f30a08df28c8), W(0x00039cab023c172f)},
+    {W(0x0000000000000001)},
+    {W(0x0006eb187d37b458), W(0x000012c418b14ecf), W(0x0005769704df6b96),
+     W(0x00055de436f3e091), W(0x000253223c91a9d6)}
+  },
+  {
+    {W(0x0003c904df0ef767), W(0x00046e5c934b95f2), W(0x00058f714eca115d),
+     W(0x0003db529eb45b4a), W(0x00031bdb0eb67ffa)},
+    {W(0x0002c5276aa8e928), W(0x0007274523a689ec), W(0x00042207d8b4794d),
+     W(0x00022cf6aaefb3ec), W(0x00047aba75653065)},
+    {W(0x0000000000000001)},
+    {W(0x00052c82b008e102), W(0x0006b6e30a2b1c03), W(0x0007ea37a57c402c),
+     W(0x0002ff28134c373f), W(0x00069021d92fad25)}
+  },
+  {
+    {W(0x0005eb5b6bff4d68), W(0x00012ccbe7fb60ac), W(0x0002e4784dc2f475),
+     W(0x00050293c67377b4), W(0x0002f951ea295cfd)},
+    {W(0x0006ba985d4b3a17), W(0x0000e0301aa38447), W(0x00014751d1172647),
+     W(0x0001b980c43ff6a5), W(0x000524a4e1c5dbe1)},
+    {W(0x0000000000000001)},
+    {W(0x00073fbfa8bc66e6), W(0x0001aa94153aa6dd), W(0x000512fe1df7bfb2),
+     W(0x00011974085463d4), W(0x0000d175c59c7217)}
+  },
+  {
+    {W(0x00018ce98c2f17cb), W(0x0001b8bf6604bc8d), W(0x00041bb7b43e6d19),
+     W(0x0000ed101cf609f4), W(0x0002cc7c00e838da)},
+    {W(0x0005e0e1bafcc7d5), W(0x0000c6c0d1f914c1), W(0x000240392e9b754f),
+     W(0x00006e02bcb4bff9), W(0x0003f3503dbd1d24)},
+    {W(0x0000000000000001)},
+    {W(0x0001bbf05b0805c7), W(0x0005223cd44e48c6), W(0x0001f453950d6385),
+     W(0x0002e6dd693b6882), W(0x000041e7490fdb75)}
+  },
+  {
+    {W(0x000795c93b000e30), W(0x0007de95ee16c595), W(0x0006030dfeb86d42),
+     W(0x0002d3554a2c3aeb), W(0x00053280bec209cc)},
+    {W(0x0007c8e3323a102a), W(0x0002d60be3515bba), W(0x000587d608e1b555),
+     W(0x0002d313776852a6), W(0x00062047781a7f70)},
+    {W(0x0000000000000001)},
+    {W(0x0006ec56bbed0bdc), W(0x000675a40e936003), W(0x0005e4dbf5a7ebc6),
+     W(0x0001db52915660a6), W(0x0005cbb84b13e0d5)}
+  },
+  {
+    {W(0x00045fc6bfa3db4c), W(0x00061a2069bcf6ac), W(0x0004b9ba8608dca0),
+     W(0x0004ca3c3f04a988), W(0x0007fdf1f02c95c6)},
+    {W(0x0000a20e9d08fe57), W(0x0005e9cd4c2c1d65), W(0x0003c94937a6bfd0),
+     W(0x0004edd4ceb289b6), W(0x0000f14d92cf7412)},
+    {W(0x0000000000000001)},
+    {W(0x0007a9c5c934b0cf), W(0x0002cf949f3690e3), W(0x0005ae0db5998a13),
+     W(0x00056e15fec70884), W(0x000489ac66931c98)}
+  },
+  {
+    {W(0x0006e3592fd5367d), W(0x000480e55e8e9f18), W(0x00030424f1628893),
+     W(0x0002c60985f634d2), W(0x0003a240690acfbc)},
+    {W(0x0005910c73787650), W(0x0006a9811d8be451), W(0x0007c7b5890aee48),
+     W(0x00029bda42e32195), W(0x000717226328f610)},
+    {W(0x0000000000000001)},
+    {W(0x00017c8676c6fc9e), W(0x00064615d1598192), W(0x00068cc1f860d943),
+     W(0x00062e18f7d06a5f), W(0x000402c32a5b321c)}
+  },
+  {
+    {W(0x000144db045d1c69), W(0x000125da38721a08), W(0x0000cf1d126e27a2),
+     W(0x00010f6249e43395), W(0x000730e38639cefb)},
+    {W(0x000057583e4a4d92), W(0x00028aa2c3c7874b), W(0x0001779ea9ec45ed),
+     W(0x00076af9c80eb7e2), W(0x00046bd23ee7c658)},
+    {W(0x0000000000000001)},
+    {W(0x0000d0edda1f251c), W(0x0002c4f96b6c07e1), W(0x00022ed4335fce91),
+     W(0x0007403833508bea), W(0x000665f92e8f55c6)}
+  },
+  {
+    {W(0x00016ae3c0c38380), W(0x000081034d8e3a03), W(0x0003eac6c18b240c),
+     W(0x0003c7d81f15f71e), W(0x00005736a77918f1)},
+    {W(0x000646b76cb36eda), W(0x0007b41994f602d3), W(0x0001dbf2390843c0),
+     W(0x000782b3344baef0), W(0x0005e9f6a47207f9)},
+    {W(0x0000000000000001)},
+    {W(0x000739ea490516aa), W(0x000314dc1d129fbf), W(0x0006233a21c9a427),
+     W(0x0000c1b87a1a21d4), W(0x000359b32b694971)}
+  },
+  {
+    {W(0x0005f952f833ff4c), W(0x0002c588c51604fa), W(0x000587e23cacec67),
+     W(0x0007521f3cbdac62), W(0x0000445095e1d170)},
+    {W(0x0000e443ceede3f5), W(0x00068b69d806fe6e), W(0x000134b6ea4fc987),
+     W(0x0000722abccd28e2), W(0x0004a00f1e1dcfb6)},
+    {W(0x0000000000000001)},
+    {W(0x000677cf04185eec), W(0x0007d2c5f69dafc8), W(0x0002199e190859ca),
+     W(0x000410f47ca7e0f7), W(0x000784ee45165961)}
+  },
+  {
+    {W(0x00064b40946b9091), W(0x00022cd6a272b609), W(0x0004aededdcce75b),
+     W(0x00062091a293571d), W(0x00023e6fd768d2c6)},
+    {W(0x0003a2e18f842fda), W(0x000696c125e533fe), W(0x0004389e8cc9a9e0),
+     W(0x0007b77de5d421d7), W(0x0004e70cae97aefc)},
+    {W(0x0000000000000001)},
+    {W(0x0000db34aec68d08), W(0x0001079fc7ffc95e), W(0x0004b8e23a0645fd),
+     W(0x00048a54cac5bc66), W(0x0007a4f93d8854fe)}
+  },
+  {
+    {W(0x0001dfd252b84847), W(0x00065a4e5bf013ec), W(0x0002094f5ed6a7b6),
+     W(0x0004f894abeca3e2), W(0x000037d54d23e9fb)},
+    {W(0x0006d640ccb7a129), W(0x0004f89c955d5e62), W(0x000743f601d07044),
+     W(0x0007638252ecdaa5), W(0x000017d43589cd78)},
+    {W(0x0000000000000001)},
+    {W(0x0007cbdaaae5e38c), W(0x00044b12d30babf5), W(0x0000c07d3ebc2445),
+     W(0x0002782f6ecc877e), W(0x0004d1bc5043d4aa)}
+  },
+  {
+    {W(0x00019132e92c582c), W(0x0004b47bc514e3c2), W(0x000509e731446e99),
+     W(0x000761d8b4c4288f), W(0x00034c615f5746b6)},
+    {W(0x0006be0b3699d76e), W(0x0006ee65e9e30c88), W(0x000752f6d050fe5e),
+     W(0x0006764c100dd4f6), W(0x0004eff00e01cacc)},
+    {W(0x0000000000000001)},
+    {W(0x0004f6440e0c7eea), W(0x00035ae8ecbe7dcd), W(0x00018eac436e3668),
+     W(0x00038d6e6975a80a), W(0x000563de17822c8f)}
+  },
+  {
+    {W(0x0001d0e2c68035ff), W(0x0005d4cc80482922), W(0x000485a8fcf96fba),
+     W(0x00053d3adf0086b6), W(0x00068aa8b24c37cb)},
+    {W(0x0006f7698aab11fd), W(0x0001780515b3d2a7), W(0x000507b8627ba7d7),
+     W(0x0001ea6db3f960da), W(0x0000fd286dd789e8)},
+    {W(0x0000000000000001)},
+    {W(0x0000c69312dd3f44), W(0x0007121014c4e75b), W(0x00058438c73e2feb),
+     W(0x0005d35ec9f32983), W(0x000338ea9d19a0ec)}
+  },
+  {
+    {W(0x0004dc0faa433a37), W(0x0005a5cc4b37a0c0), W(0x0001cb5f735255c9),
+     W(0x00041b0a4e0aab1c), W(0x00069ea71b57ad3f)},
+    {W(0x0002a2d70729ec5d), W(0x0002a7a2a99724ad), W(0x0002d43e07e1b1ea),
+     W(0x0002da07c868293a), W(0x00031633c2554c8f)},
+    {W(0x0000000000000001)},
+    {W(0x0003127073688120), W(0x0001f7e56379b8f2), W(0x00016c6e4826a547),
+     W(0x000015e2c31ead89), W(0x0003ae5182725bba)}
+  },
+  {
+    {W(0x00070fa96c4a7d4d), W(0x0003651d17d924ae), W(0x00009a56a241edb0),
+     W(0x00034ff62797cbba), W(0x0004e9ce1827b99a)},
+    {W(0x0000f92bd4aea274), W(0x000779dd4294e758), W(0x000189e3780dd0c0),
+     W(0x00075cb14af13ef2), W(0x00040482b741552a)},
+    {W(0x0000000000000001)},
+    {W(0x000546530233badc), W(0x00022a04be54ff93), W(0x0005960cb2462ab3),
+     W(0x00008d7bc70c04a2), W(0x00046eddfcfbc36a)}
+  },
+  {
+    {W(0x00001e24954cc2ce), W(0x000138ab97fbeadd), W(0x0005fa0eb2b77b75),
+     W(0x0004a649c5051199), W(0x000155e1e3031758)},
+    {W(0x000716618065e07a), W(0x00043f17ac68dd9d), W(0x00058e9cdd4d579f),
+     W(0x0002337864c6d581), W(0x00035411cf70e440)},
+    {W(0x0000000000000001)},
+    {W(0x000720d0f96fa272), W(0x0006598d92805329), W(0x000620b5ea6619b5),
+     W(0x0002454c3222a879), W(0x0003311ec85d6d7d)}
+  },
+  {
+    {W(0x0006131b81667d08), W(0x0000f08294004fd9), W(0x0002b6abe72c716d),
+     W(0x0004f69e483c808d), W(0x00044b22f9211551)},
+    {W(0x000342a7ec611223), W(0x00057938c73f4088), W(0x00022633525149c2),
+     W(0x000626073d6d811e), W(0x00058804e028671a)},
+    {W(0x0000000000000001)},
+    {W(0x000249b63923ad58), W(0x00032f7850143925), W(0x00040783794a56ab),
+     W(0x0007eadb082109a7), W(0x0006f5fd88e24dbc)}
+  },
+  {
+    {W(0x0006d7d35ff26f28), W(0x00035c3bda327bc7), W(0x00034232c2563522),
+     W(0x0000180779449ce7), W(0x000641103ab77657)},
+    {W(0x00064566af4f8056), W(0x00029adf6227a714), W(0x000440f793db905f),
+     W(0x00055dfba6b558d4), W(0x0005ff23e9a9943e)},
+    {W(0x0000000000000001)},
+    {W(0x0001fcc8c9909454), W(0x0004add488107b44), W(0x0006edb5d71c343c),
+     W(0x000440fe29747f14), W(0x00079327bf1e2107)}
+  },
+  {
+    {W(0x0002671fdf13b30d), W(0x00007b6fdcf41523), W(0x0001ca22742804b5),
+     W(0x000673d149afe36f), W(0x00043d17933d6d7a)},
+    {W(0x00047523edecf7f8), W(0x0001049b084155a1), W(0x000480dd3fbcc1a6),
+     W(0x00078821cde12c97), W(0x0005ea02ed1e0312)},
+    {W(0x0000000000000001)},
+    {W(0x00017c8a228cfab3), W(0x0005617a6cb7d844), W(0x0000e3c5593ade3d),
+     W(0x000266ba981e2c14), W(0x00072dc94ecec70e)}
+  },
+  {
+    {W(0x00034a1b2058a301), W(0x0001752b75447e7a), W(0x0002b4ae278e5f42),
+     W(0x0003f692e3ddb869), W(0x00038e23128c9dc9)},
+    {W(0x00039abeebe2e46a), W(0x0004c4be9ad0fd5d), W(0x00007d25c99666c2),
+     W(0x0002f9650b163501), W(0x00033f44d88d3f5a)},
+    {W(0x0000000000000001)},
+    {W(0x0004bbbe245b02bc), W(0x0006ddcec37a3d53), W(0x0002df289e6243dc),
+     W(0x00028d556c7fdd12), W(0x0007661cee725bf8)}
+  },
+  {
+    {W(0x000222e3a51d9774), W(0x0001109b4f3eb194), W(0x00079dfb9b2bdd98),
+     W(0x00077cb63a9e67d9), W(0x000416b14fe444d7)},
+    {W(0x000046f2f536b523), W(0x00018e1b6b12e9c3), W(0x00004a810c5d0864),
+     W(0x000205c4c667803a), W(0x0004a2749fbbe751)},
+    {W(0x0000000000000001)},
+    {W(0x000525fc522dbbf5), W(0x00015dc47b3a4b0d), W(0x0002704c29a53c84),
+     W(0x000173ac8aaac634), W(0x000230573966ffd8)}
+  },
+  {
+    {W(0x0000668ad229ebbd), W(0x0002c8a8ee45d830), W(0x0004b1f6b431c86a),
+     W(0x000712bbbaee6207), W(0x0006c6a06fb775c1)},
+    {W(0x0001e08dd7a3dfb6), W(0x0004061127bb134f), W(0x00030e9097b70bf9),
+     W(0x00030fd50d99b88b), W(0x0007915a5e34819b)},
+    {W(0x0000000000000001)},
+    {W(0x0003e6e40af333ef), W(0x000642908e918fdc), W(0x0006ce214adad72c),
+     W(0x0002c23f8acc19fc), W(0x0002a53e2022f30b)}
+  },
+  {
+    {W(0x00042aed5f8268fa), W(0x0007aba2c15798e6), W(0x0005143f4c12208a),
+     W(0x0001fa32bf16dd51), W(0x0006ae424fcf82f1)},
+    {W(0x000531f5845e29ff), W(0x00064fb5297c3258), W(0x0000e650647518a7),
+     W(0x00000bfbcf5e8d7a), W(0x000040233528185a)},
+    {W(0x0000000000000001)},
+    {W(0x00048d54779509e0), W(0x00050bb0b4aa4009), W(0x0000fa800a640bff),
+     W(0x0001d604afe4b1ac), W(0x0004079316ab0743)}
+  },
+  {
+    {W(0x000075a41f4ab778), W(0x0003b4b06fee997d), W(0x0004cfde0f9b5d32),
+     W(0x0007fb55ed8932b9), W(0x0001921c5ea67fb8)},
+    {W(0x00039195bd317104), W(0x0007ae2c6d1a7a3b), W(0x00041d9f63ad19ea),
+     W(0x0002b369575bbc8e), W(0x0003a0b7ea5a6781)},
+    {W(0x0000000000000001)},
+    {W(0x00032a9c6228cc17), W(0x000453c5653c5e85), W(0x000010e10f713f68),
+     W(0x0004bafd6c4ddbe4), W(0x0002b54b5a367b79)}
+  },
+  {
+    {W(0x0001db75e1cd7f40), W(0x0003291df6f4789b), W(0x000585596c6ef3d7),
+     W(0x0007a9f215360ba6), W(0x000472d236949c06)},
+    {W(0x0007f03213acf912), W(0x0000eaf7f9624a82), W(0x0000900606ce2240),
+     W(0x00045a4f1a13cde1), W(0x0001fdb8d919596d)},
+    {W(0x0000000000000001)},
+    {W(0x000420ef2bca91d1), W(0x000437a214e17ab4), W(0x0007669875e87c16),
+     W(0x000576f8ee2679e5), W(0x0007e257b3d78bc1)}
+  },
+  {
+    {W(0x00077adcb0fcfb7e), W(0x0000762f84bc422b), W(0x0005a94f35912f2f),
+     W(0x00045d693077eb25), W(0x0006c96d84dac55a)},
+    {W(0x0007a2c563bd2e41), W(0x00029bc6c7463d6c), W(0x0002059bb3bc0396),
+     W(0x00079ded2d686172), W(0x0002b7ae645cb08b)},
+    {W(0x0000000000000001)},
+    {W(0x00052dbba69f4152), W(0x0002d9dcd6ed6c22), W(0x0006f5fc0089bfa6),
+     W(0x000559366a2046de), W(0x0006384f66ab7da9)}
+  },
+  {
+    {W(0x000557b8bcb1f3f5), W(0x0000fc4bc8f540d7), W(0x00027cbb81fd2537),
+     W(0x00062b8f57334500), W(0x000110a1a6a41be0)},
+    {W(0x0006aadbf9cf7369), W(0x0006cfcd513afb78), W(0x0005d930c2cb8a49),
+     W(0x000449ab97d174db), W(0x00026af30f1bff77)},
+    {W(0x0000000000000001)},
+    {W(0x000556dfa6fb69c3), W(0x0000cad2c57fae1b), W(0x0005a19432c3009d),
+     W(0x0001c26d78e6dab6), W(0x00065c90776f9dc8)}
+  },
+  {
+    {W(0x0003c41c34ec4da8), W(0x0007cc3e7417ce2e), W(0x0000f60f62af7968),
+     W(0x0000b078dfc11117), W(0x000170512e817fdb)},
+    {W(0x000032a516d5f4e3), W(0x0007ec324c597818), W(0x0007002a8f5640f2),
+     W(0x000481db2b6417c6), W(0x0002a3e758097e7f)},
+    {W(0x0000000000000001)},
+    {W(0x00025b153a2463c4), W(0x0004236d0920e815), W(0x000737fcb9f94683),
+     W(0x0002972efa25dfd5), W(0x0000177867d9cc2c)}
+  },
+  {
+    {W(0x00024e17c3d2b515), W(0x00061fe6f200408d), W(0x0006d28113dbc935),
+     W(0x00034e6ad5b46207), W(0x00059590ad3e20e8)},
+    {W(0x00015c32699186ea), W(0x0006fab737d87868), W(0x0004c16c20b0d5a7),
+     W(0x00026d860c55e317), W(0x00034ccd8be02efc)},
+    {W(0x0000000000000001)},
+    {W(0x0004f7f4b568cc0a), W(0x0005a592c4b4de3a), W(0x0006cda7e50824f7),
+     W(0x0003247d728f0083), W(0x00050b65b07bb797)}
+  },
+  {
+    {W(0x0004fbf9c6d9e1fb), W(0x0001dc9f8179ff44), W(0x0004a8df3f8caff1),
+     W(0x0006e80533bc3702), W(0x000479068d29c3a9)},
+    {W(0x0006c5ecebdb29fd), W(0x0001fe4c5dbda214), W(0x00018db21d184a75),
+     W(0x0003c8d6d469a895), W(0x000011fb20ab891a)},
+    {W(0x0000000000000001)},
+    {W(0x00041a93ed77146f), W(0x00056920196ebf77), W(0x00065d72bf0a1578),
+     W(0x0004782020510261), W(0x0002ed0720de1fbf)}
+  },
+  {
+    {W(0x0003e270ef52b99e), W(0x00020dd6835ed9c7), W(0x0004ed9c0b6f805c),
+     W(0x0004acd9b6282356), W(0x00069851be48ae83)},
+    {W(0x000481392a55b6c7), W(0x00060f378bc05344), W(0x00010168e2ffaa91),
+     W(0x0006e1d2f6c15942), W(0x00021607e75005a1)},
+    {W(0x0000000000000001)},
+    {W(0x0004df763ef03e50), W(0x0001924c03fc8c9c), W(0x0007bc95edc5b580),
+     W(0x0006b526b67e0b97), W(0x0003cb3173240fe1)}
+  },
+  {
+    {W(0x00052e6ff7921d58), W(0x00046fbf0db9afb2), W(0x00050786623298c6),
+     W(0x00043712975ab31f), W(0x000205315c42de19)},
+    {W(0x0003b7b73465d70a), W(0x0007b79eb260076e), W(0x00048b4ebc1e7e51),
+     W(0x00074efbe35599ba), W(0x0000a7c26749d034)},
+    {W(0x0000000000000001)},
+    {W(0x00020b9d67fe0a94), W(0x000415ac0d64c43c), W(0x0007fc2dd440b415),
+     W(0x00066352d0386353), W(0x0003f343b4347ab7)}
+  },
+  {
+    {W(0x000614b1ecd3a640), W(0x0005149e0fb46b2f), W(0x0001c8b0a716383d),
+     W(0x00064b399f90e932), W(0x000646b87adeadda)},
+    {W(0x0006aeb61b840fc9), W(0x0003e773f07bc9dc), W(0x00038c4265e195f0),
+     W(0x00069d100db900fd), W(0x00008d35c8ef0cfb)},
+    {W(0x0000000000000001)},
+    {W(0x00005eca6db2786e), W(0x00016ff9fcfd5bed), W(0x0007e1867a9d2ead),
+     W(0x000452473b026f60), W(0x00047697b970618f)}
+  },
+  {
+    {W(0x00061a7cd17c4bfc), W(0x0005799bc77c455a), W(0x0000e3b68f628f8f),
+     W(0x00030310be66e76c), W(0x0005088d433884e5)},
+    {W(0x0001a361d9dc790b), W(0x000389dcc109a589), W(0x0001edfe4ba1a893),
+     W(0x0003aa59cc3b1d7d), W(0x00061b5cb2c97e31)},
+    {W(0x0000000000000001)},
+    {W(0x0001f907f0e1c733), W(0x00033c0480a0545b), W(0x00050d290c9a4462),
+     W(0x0002d499b5106294), W(0x00051fa913556269)}
+  },
+  {
+    {W(0x0001a4d377ebbd3a), W(0x0005dd1e2488f418), W(0x0007641d4e448c14),
+     W(0x0001f195f9f7c511), W(0x0002eb4f8d0459ba)},
+    {W(0x00010b49d7520ca9), W(0x00049d16f2c90b54), W(0x0002ccccd34b6abb),
+     W(0x00030c8120bfb621), W(0x000403ff447ac71c)},
+    {W(0x0000000000000001)},
+    {W(0x0003877a6abebd5a), W(0x00043a561bc74c40), W(0x00010c98b65c6d14),
+     W(0x0004fd77f2af2ee9), W(0x00041ae2c09ec187)}
+  },
+  {
+    {W(0x0007786ea91c12d3), W(0x0002cc7047cf9862), W(0x00034cbac51cfab4),
+     W(0x0000e7ece2eb3830), W(0x000589631d5b233c)},
+    {W(0x00076b1b354c29c6), W(0x00073d28dd4a96c8), W(0x00018023cd1fc12a),
+     W(0x000547aa685e172e), W(0x0001043d9e36085f)},
+    {W(0x0000000000000001)},
+    {W(0x0000d5692b3d38e4), W(0x0004d3e0083046e8), W(0x0007444086cb87be),
+     W(0x0005bb24ed296d42), W(0x00029941088b99ee)}
+  },
+  {
+    {W(0x000764f9063546c5), W(0x0003cefc2004d90c), W(0x000669dcd053035f),
+     W(0x0005403116ea286a), W(0x0001ead03d93ac6f)},
+    {W(0x0005f678e1738457), W(0x00037043e1328be6), W(0x00025e1cdee540f2),
+     W(0x0004764d4916f804), W(0x000266a891a72ac7)},
+    {W(0x0000000000000001)},
+    {W(0x0003117296684dc1), W(0x0005e05a97be80e3), W(0x000379b59a3db011),
+     W(0x00024cc37805bff9), W(0x000355c12bb9668c)}
+  },
+  {
+    {W(0x0001809499ad9167), W(0x000078e332fc835f), W(0x0006c2b26be15368),
+     W(0x0002714472685f73), W(0x0000c84237daca07)},
+    {W(0x0000dcabdb8ad2b6), W(0x0003dc460efb7c36), W(0x0004e7dc5507251c),
+     W(0x00031e7aa1385679), W(0x000712f424def14e)},
+    {W(0x0000000000000001)},
+    {W(0x0001356b5c1d6b8d), W(0x00000be5fe3450a3), W(0x000710bacf3b0fcc),
+     W(0x0001fdc90e96f16d), W(0x00046f604fc3a118)}
+  },
+  {
+    {W(0x00012952c3837eec), W(0x0006c0fc45d2dfa1), W(0x000356566177a7a9),
+     W(0x000077a1dcf0c1f0), W(0x00027e16f2eddb14)},
+    {W(0x0007629bb5c71f89), W(0x0000446a8b77617d), W(0x0003027101b40127),
+     W(0x000629cbc8ca703a), W(0x0002529d86881e0c)},
+    {W(0x0000000000000001)},
+    {W(0x0005bbf3cde51314), W(0x000576365dc97e53), W(0x0001f00e2f2bb992),
+     W(0x0003f7700645c752), W(0x0004269e3c341931)}
+  },
+  {
+    {W(0x00008d0bddf743ee), W(0x0004aac152305a91), W(0x00041c0b6452f5a4),
+     W(0x00001d9ac0dae583), W(0x000740519100f339)},
+    {W(0x00003bd553395132), W(0x00062ee492f21b0c), W(0x0005cbcc2197f73f),
+     W(0x00066a6c6af179bc), W(0x00006ff912b012bb)},
+    {W(0x0000000000000001)},
+    {W(0x0005117b392fc0f6), W(0x0001af216f69f657), W(0x00061987f2024357),
+     W(0x00031292bfdb60d9), W(0x0005e5e76f843bb0)}
+  },
+  {
+    {W(0x00030e04fc66a771), W(0x0000316d99f0a030), W(0x000216bde17bff3f),
+     W(0x0002be8bafadf45c), W(0x00078e8c2e1841a7)},
+    {W(0x000428f378e6fc1d), W(0x0002faad770c110b), W(0x0001c90c29e4edd5),
+     W(0x00006be5a594c667), W(0x00047a29e0c98ab2)},
+    {W(0x0000000000000001)},
+    {W(0x0000c4790379f9a4), W(0x000082721e298516), W(0x0002badf27148c3c),
+     W(0x0001f5fcedf2800b), W(0x0002a7895cc5511e)}
+  },
+  {
+    {W(0x00037df5ade09705), W(0x00018cac2f348e38), W(0x0000f7d8fbc0d1a2),
+     W(0x0002b44705e3b514), W(0x00014998ee84bd97)},
+    {W(0x0007c32d7d5cac37), W(0x0001969466851815), W(0x000493d3a9c93371),
+     W(0x000044a4e237f254), W(0x0001dca5fceedb11)},
+    {W(0x0000000000000001)},
+    {W(0x0007aec1966cb8a7), W(0x0003a93dec6e5ffa), W(0x000647000111eb04),
+     W(0x0006cdc32927b295), W(0x0000557c668683ae)}
+  },
+  {
+    {W(0x0006333e25f79154), W(0x0007decf7df8f898), W(0x0003ec46af736ce0),
+     W(0x000438cc7714a261), W(0x000337acda170757)},
+    {W(0x00061f6b8f9f89ce), W(0x0001315cf2143158), W(0x00007ea880134caa),
+     W(0x0002cffe58cc0490), W(0x0006902feca5d85f)},
+    {W(0x0000000000000001)},
+    {W(0x00058308e0a49e15), W(0x00035eba3d3c9406), W(0x0007b2fd8116e53c),
+     W(0x000662b47a5d565b), W(0x0005c0c5f6fd6406)}
+  },
+  {
+    {W(0x000457bf37692036), W(0x0004d23d8fb173ec), W(0x000106537644c4c0),
+     W(0x0000993d23d6e841), W(0x0004f486ec0c1bf7)},
+    {W(0x00064ea1030f3e39), W(0x00050a5d2ad03baf), W(0x000135b5c8a114c6),
+     W(0x00029d3a852b68ca), W(0x00032e5b22a38315)},
+    {W(0x0000000000000001)},
+    {W(0x000321b583d2924a), W(0x0002e420536f29e9), W(0x00002637af08a23a),
+     W(0x0003db5437a88be8), W(0x0007d333b1a1fca2)}
+  },
+  {
+    {W(0x0000f8a0894ceec2), W(0x000732f3cc72b69c), W(0x00016ff330e6034f),
+     W(0x00003847795f327b), W(0x000071f33c339eac)},
+    {W(0x00048e5126ca4b4e), W(0x00074ad956c03c7a), W(0x000219bf66c98676),
+     W(0x00000e5a4110da68), W(0x00069fdce2041dcb)},
+    {W(0x0000000000000001)},
+    {W(0x00059495480fd882), W(0x00065c797cae5729), W(0x00079b0bcecb5c28),
+     W(0x0000100f17a87fb4), W(0x00072818b12ade32)}
+  },
+  {
+    {W(0x0001fe57cd8bdae9), W(0x0000e0ffbb409f81), W(0x000242de209979e8),
+     W(0x0006fa5ed163dc23), W(0x0004b4298adeafcf)},
+    {W(0x0004c38bb1b51b71), W(0x00060ec5bc6ec1c1), W(0x000513bf2789dd89),
+     W(0x0006e4cb4cae99dc), W(0x0000b597defa0ad4)},
+    {W(0x0000000000000001)},
+    {W(0x00000087c73d8ad0), W(0x00016414e51d6273), W(0x0003ea079be9d554),
+     W(0x00038a7240419291), W(0x00069f2dd78179e2)}
+  },
+  {
+    {W(0x0004d743052d0c0e), W(0x00064babb9da5f53), W(0x00042596b5ca92ea),
+     W(0x0006415899883146), W(0x00003dce7512d40c)},
+    {W(0x0007dddb6666bfc0), W(0x00073fc90e6b062f), W(0x0001e0887ad4a955),
+     W(0x0004ba89a3096839), W(0x000271dba6622517)},
+    {W(0x0000000000000001)},
+    {W(0x000423456f870513), W(0x0007e66c5af35e82), W(0x00069e3bdc6ff8ff),
+     W(0x0005137ab1443998), W(0x0002a07dbb9e5517)}
+  },
+  {
+    {W(0x0006250ca5f388b9), W(0x00075306a1661328), W(0x00058e7d5486c3f5),
+     W(0x000119e2ef7bd131), W(0x00047ca34f96dc82)},
+    {W(0x0005496a16a1e9e8), W(0x00018a94a7687e4f), W(0x0000b358640cef49),
+     W(0x00006242acab492a), W(0x000069b908386dc0)},
+    {W(0x0000000000000001)},
+    {W(0x000532b7adf29aaf), W(0x000704b8249e027c), W(0x0002f113396fa604),
+     W(0x0005600f49b906b7), W(0x00070d518b4cf286)}
+  },
+  {
+    {W(0x00037033a7ec14b4), W(0x0004cc2324f4a010), W(0x0001d8194c2ea565),
+     W(0x000758bba2eb2fe3), W(0x0005c3fb5ae5a2db)},
+    {W(0x000189c5dc600976), W(0x0004da81c868a479), W(0x000610a81d7aa1c3),
+     W(0x0004f0d9223c3ec1), W(0x0000a48fe10dedc8)},
+    {W(0x0000000000000001)},
+    {W(0x0001608db4da7fe5), W(0x0003643d09efc764), W(0x0005ff965ec57341),
+     W(0x0002dc367dc54a4b), W(0x00054cbdcdabba38)}
+  },
+  {
+    {W(0x000002e04b1e18b5), W(0x0000bc809d91e22a), W(0x0001eccf7d62dead),
+     W(0x00033a263be30fa3), W(0x00003beb4625998b)},
+    {W(0x0005539e22aaa06a), W(0x0005c02641b06a16), W(0x0000bd8390c061ad),
+     W(0x00051632bce56e22), W(0x0002b74fc9af001d)},
+    {W(0x0000000000000001)},
+    {W(0x0002594a0bcdca76), W(0x00062ed8059f459d), W(0x0003c3426eb4474b),
+     W(0x0005e526250554cf), W(0x000310583f95d9c6)}
+  },
+  {
+    {W(0x000010cb5935b31f), W(0x0002a0caf2f83cda), W(0x000556edd1d70668),
+     W(0x0002fbfb24ce5ac2), W(0x0003f728cfbdcff3)},
+    {W(0x0000ba936efa99da), W(0x0006693bcf823e18), W(0x0001436498c66f4d),
+     W(0x0002ad0ae5ca62e9), W(0x000095febb28e7c0)},
+    {W(0x0000000000000001)},
+    {W(0x000570ac42805d7f), W(0x000634ce8397b21e), W(0x000636fd66d1181c),
+     W(0x0006dce04df1cbe9), W(0x0004b9daff786896)}
+  },
+  {
+    {W(0x0004e08b9be186be), W(0x0007d7182466e605), W(0x0005d618e620c493),
+     W(0x0000a9852d6d2622), W(0x0006e7f1f56d7204)},
+    {W(0x000729a77fbb7057), W(0x00049a3e6982eb93), W(0x00032ca14d93048d),
+     W(0x0007981aabb21a88), W(0x000423aec2a0ef08)},
+    {W(0x0000000000000001)},
+    {W(0x00052ffb71b00645), W(0x00041a0d46116565), W(0x000508069b6acafa),
+     W(0x00065b24c5d654ec), W(0x000784ea186017b3)}
+  },
+  {
+    {W(0x0005e8c08e1f1ce3), W(0x0003f1213fc046c9), W(0x0005de0ea410c18e),
+     W(0x00016462039001bd), W(0x00064dbbdae2ca61)},
+    {W(0x00041278ee030a3f), W(0x0002b987a11f88db), W(0x0004f5e6e1c54d60),
+     W(0x00048a775a204c7d), W(0x000208124757dd56)},
+    {W(0x0000000000000001)},
+    {W(0x0003cc43c8daf29e), W(0x000398a9ff70b694), W(0x000387b66cb36cab),
+     W(0x0001a5a2d2f2a405), W(0x0006474fbf0e77c3)}
+  },
+  {
+    {W(0x0001aa077d837d6f), W(0x0002f604c5f7143b), W(0x000529af41264b10),
+     W(0x000371ac66ed37c3), W(0x0005382ce55f75c4)},
+    {W(0x0006b64a082deca4), W(0x00046d8f8a4efbaa), W(0x000634daf1ed5446),
+     W(0x0001ef42123b0872), W(0x0005712cda97a29a)},
+    {W(0x0000000000000001)},
+    {W(0x0002d7b98284c9e9), W(0x0003427c9f2c051b), W(0x0002da45a67569db),
+     W(0x0002e0ed57e24c3a), W(0x0001ecb560e09e14)}
+  },
+  {
+    {W(0x00022ee2759def49), W(0x00063f38d9f38704), W(0x0005765828ca3910),
+     W(0x00007f23faff06c5), W(0x00034f02ea59a76c)},
+    {W(0x00057650f3dda4d1), W(0x00046176dd5c9f33), W(0x00070c198c791739),
+     W(0x0004e6afbc8a257d), W(0x00013795f78f0c4f)},
+    {W(0x0000000000000001)},
+    {W(0x0005ed83fa722907), W(0x00051aee86e9d2b2), W(0x00038d3e29e289ec),
+     W(0x000155f201c8960f), W(0x0002501eb0652f37)}
+  },
+  {
+    {W(0x00008ba25fc17270), W(0x0005f879ceae68c4), W(0x000426674772a4db),
+     W(0x0006b82db89ef8c2), W(0x000610840a8f4e81)},
+    {W(0x00060ef321a34662), W(0x0004d01b8e189c59), W(0x0002973e7aef6a0a),
+     W(0x00040cb954a24757), W(0x0007a8f5e1476cd5)},
+    {W(0x0000000000000001)},
+    {W(0x00063fc5fcac3c5c), W(0x0000a7d313ffce4d), W(0x000791be3d2b4e8c),
+     W(0x000111095f1d7497), W(0x0007aff2122b5a15)}
+  },
+  {
+    {W(0x000796fd3afdfae1), W(0x00062b2ca87e7433), W(0x00046867d8d68e04),
+     W(0x00074c9a25b96342), W(0x0003e0b92949e6e4)},
+    {W(0x0007cfd5e90e13de), W(0x00056ea0d9012e72), W(0x0004b7e993f0fb28),
+     W(0x000255d059c0bab9), W(0x00012cc5c3bffab9)},
+    {W(0x0000000000000001)},
+    {W(0x0005ac2ec68bec51), W(0x0006c7ab2452981d), W(0x00007c630e1d034f),
+     W(0x0001c74fc823b29b), W(0x0003936c8c56c812)}
+  },
+  {
+    {W(0x000195812fc16770), W(0x0001ce7ed3c60b81), W(0x0000acc3c9d1aefb),
+     W(0x0000882f20eb7aa2), W(0x0001df8dbe94e6fd)},
+    {W(0x0006f970db3f23e4), W(0x0006741fc2203743), W(0x0000c274439a6ac8),
+     W(0x00056da00c62103a), W(0x000185460b8d7dc7)},
+    {W(0x0000000000000001)},
+    {W(0x0003ae020829c17f), W(0x00021c1f051223ad), W(0x0003b8e29841cddf),
+     W(0x0002f9ce1a65d3b1), W(0x0007e51ff53daafb)}
+  },
+  {
+    {W(0x0002c3f2f626b7e7), W(0x00018f73212f0481), W(0x000507a14931fdc5),
+     W(0x00036778d8b291fa), W(0x0007c80385911754)},
+    {W(0x00031444f2e04f64), W(0x0006da88936e5f3e), W(0x0006f1db77ac0a58),
+     W(0x0007df39e9f33341), W(0x0003e6552c858152)},
+    {W(0x0000000000000001)},
+    {W(0x0000c3bef4a2e020), W(0x0003071866e4ae45), W(0x0001ef1408003259),
+     W(0x000056fb71bd3e5f), W(0x000102a116fce721)}
+  },
+  {
+    {W(0x0007ae694511e612), W(0x00020a54afc3febb), W(0x00001d2ed3026524),
+     W(0x0004f352d2679858), W(0x0001e1495263bbf8)},
+    {W(0x0007666c22786d5a), W(0x0003286bd17d6500), W(0x000565b2d9f77f41),
+     W(0x00024415d981b6c0), W(0x0003ea2e28ec5014)},
+    {W(0x0000000000000001)},
+    {W(0x00040707608b574e), W(0x00028970860ef434), W(0x000730506b067248),
+     W(0x0002679d4e9d752f), W(0x0002458e5c17e308)}
+  },
+  {
+    {W(0x000118eb2f579d41), W(0x0005d99e0fff260b), W(0x000553aa70b65970),
+     W(0x0003302d5e9fb36a), W(0x0003f605f6b8aec8)},
+    {W(0x0000512a5fe9a612), W(0x000676a842eb0c26), W(0x00011d6399c16864),
+     W(0x0001871755a7e593), W(0x0007252ef52b377b)},
+    {W(0x0000000000000001)},
+    {W(0x00076412af5ab5d6), W(0x0003cb46255e6931), W(0x000075f49a091802),
+     W(0x0001855d2554a347), W(0x0007a0f0e29fed8a)}
+  },
+  {
+    {W(0x0004045f8a022ca0), W(0x0003d6a33a54483f), W(0x00079fa41c48306e),
+     W(0x0002abd319c2734b), W(0x00013186d72ed654)},
+    {W(0x0004cbeca3a20f8b), W(0x00059fe13034a4e5), W(0x0005117eed4d024f),
+     W(0x0004cf6adc51f905), W(0x00022cfe4d080219)},
+    {W(0x0000000000000001)},
+    {W(0x00067ce87b95c612), W(0x00005e8a81034a86), W(0x0006e9dd4656b435),
+     W(0x0002306b19c96c09), W(0x00032380b53bc9f7)}
+  },
+  {
+    {W(0x000155ae187af922), W(0x0005d7a9245dd664), W(0x00051aca72628832),
+     W(0x000252dad1364ddd), W(0x0003e4be357ae097)},
+    {W(0x000393aa365c9a3a), W(0x0007c06b507916d8), W(0x0005f9bc59adf377),
+     W(0x0004de7eff2e4e9e), W(0x00038363d156cd26)},
+    {W(0x0000000000000001)},
+    {W(0x00023b2062e813f5), W(0x00057024530ab789), W(0x0007e3d4b9b4d7b3),
+     W(0x0003c499ec466595), W(0x0006f2e08b96c20f)}
+  },
+  {
+    {W(0x00065ad306fa7880), W(0x0004200f48b7a6d6), W(0x00063619912d45c0),
+     W(0x0004db2888320aea), W(0x00012c4371c9c829)},
+    {W(0x0002ef6bdaba6ca8), W(0x0004ec0a6a52a4a5), W(0x00053de530c66ea8),
+     W(0x0004c95449f8f3a9), W(0x00015cd6f55db85a)},
+    {W(0x0000000000000001)},
+    {W(0x0003e0d0961699fb), W(0x000382b50acf4523), W(0x0003e36482c48e3b),
+     W(0x00010f8a2cf4249a), W(0x0006cc55b6254c10)}
+  },
+  {
+    {W(0x0002aacdb8e57212), W(0x0003cc881d3e92c4), W(0x0000a57c47e99bcb),
+     W(0x000133a0a17628f4), W(0x00060bb05bc0fd57)},
+    {W(0x00070b061ffc9657), W(0x0001d80ee1e9ec6e), W(0x00025bb63ac33537),
+     W(0x000145b3ccdb0c8e), W(0x00065e26a93cd4ab)},
+    {W(0x0000000000000001)},
+    {W(0x00057bf7a4c5f682), W(0x00068db9812edbb9), W(0x00030908d298519e),
+     W(0x0007d4140a93bb57), W(0x0000e9a6be2d2be0)}
+  },
+  {
+    {W(0x0004bad380d3e270), W(0x0000788157a2e986), W(0x0004f2d89036bed2),
+     W(0x0005e55944eee450), W(0x00053ce391c79e34)},
+    {W(0x00040021dbfbfb17), W(0x0005dac1bdd5bee6), W(0x0000e9b181acce8a),
+     W(0x0001df380dc36a60), W(0x0001dd67b47527c8)},
+    {W(0x0000000000000001)},
+    {W(0x00063c1f6abcad1f), W(0x000743461efc2f43), W(0x00009e3f60009ed7),
+     W(0x0006d68403644a2f), W(0x000409e72848f040)}
+  },
+  {
+    {W(0x00049d5dcd9b0d4f), W(0x0002e8acf6b3c706), W(0x0003af7216021014),
+     W(0x00026ddaa26e03c7), W(0x0005ed8b84ea7ff3)},
+    {W(0x0001cd52b22af1b0), W(0x0005eefabb490644), W(0x0004335706e1b376),
+     W(0x00058225529eaecf), W(0x0000e7b1eb8602ec)},
+    {W(0x0000000000000001)},
+    {W(0x0007e9bc284c44de), W(0x0005225b2aee45dd), W(0x0004872615c85fdc),
+     W(0x000692b2d940b5eb), W(0x0003950eb17f6479)}
+  },
+  {
+    {W(0x00027acbc39c93b3), W(0x0003d8d6a30432ca), W(0x000286937563b674),
+     W(0x0002706b46fc95b2), W(0x0002cb9d23f0cabb)},
+    {W(0x000247b9d4b90974), W(0x0001adae213de979), W(0x000432d988b02857),
+     W(0x00012ffe4c87fb37), W(0x00072b984bb16442)},
+    {W(0x0000000000000001)},
+    {W(0x00005456212d9c24), W(0x000608c9249a48a5), W(0x0006c6153d6bce99),
+     W(0x0000459141cda2ef), W(0x0000a83110174f94)}
+  },
+  {
+    {W(0x00009572c2eef67a), W(0x000674241fddb0f4), W(0x00040980da9238c5),
+     W(0x00026a974ff105c5), W(0x00050ee2856c89ff)},
+    {W(0x0000bf34ec8ae936), W(0x000588fad5354d89), W(0x0006b67e250bab84),
+     W(0x000065bad5b54bf5), W(0x00016c9e0b432873)},
+    {W(0x0000000000000001)},
+    {W(0x000660d00e689393), W(0x0007260a6f6f3d17), W(0x0000777007ed9d8c),
+     W(0x000115f8c8fe3dae), W(0x00041214d77c46c5)}
+  },
+  {
+    {W(0x000794cd3e70f34a), W(0x0006dc93a5b70c34), W(0x00057a228083ed29),
+     W(0x0000817a1a0fd7ea), W(0x0006913b26c33f95)},
+    {W(0x0000ca8472ddb1b8), W(0x00012c4ffacfd648), W(0x0005769a6e131ea0),
+     W(0x00010145b9d574be), W(0x00035a5873059cca)},
+    {W(0x0000000000000001)},
+    {W(0x00009b00680a6029), W(0x0002391e2d0ab724), W(0x0006ed83237708bf),
+     W(0x000183d76c086f85), W(0x00053c76c12a6a5c)}
+  },
+  {
+    {W(0x00062469e23c1435), W(0x0003b9a68d427786), W(0x0003e631f93ec4f0),
+     W(0x000657de5a91cbd5), W(0x0007d509c9da9a1a)},
+    {W(0x0002e4ec443acaf9), W(0x0004951c622fb186), W(0x000023ff85d44ec5),
+     W(0x0003ee796fa9b8b7), W(0x00054a3fe37c9790)},
+    {W(0x0000000000000001)},
+    {W(0x00052bf363bc2c24), W(0x0000e0460ff0e731), W(0x000456e04afe3d7f),
+     W(0x0007addd4bc1f6bd), W(0x00066c85b96204b3)}
+  },
+  {
+    {W(0x000433e22485160d), W(0x0006208a3b3441c4), W(0x0001d411e4760231),
+     W(0x000206d053e82691), W(0x000504c5708a2734)},
+    {W(0x00040c7e04e585b5), W(0x0003085473749fd6), W(0x000693539aef3b68),
+     W(0x00007066f8cc433e), W(0x0004f637ceaaeacc)},
+    {W(0x0000000000000001)},
+    {W(0x0000176c66311a60), W(0x00077a5082463e8d), W(0x00033daa0d23f9f1),
+     W(0x0006397f1b68530e), W(0x00070fc9c9ba4076)}
+  },
+  {
+    {W(0x0004ba587ba8b046), W(0x0003e49e855c7bc2), W(0x000387da7bfe2232),
+     W(0x0007ee3030a2e4ac), W(0x00070a72bc16ef24)},
+    {W(0x000001b2f26869d6), W(0x00058a45906649a1), W(0x00003b467e55407c),
+     W(0x0006166055ee1c19), W(0x0007e743a2ba82fb)},
+    {W(0x0000000000000001)},
+    {W(0x0007dc98c11d83b2), W(0x00020de78b8553a6), W(0x00065a0a23acd734),
+     W(0x00060238cd519b4c), W(0x00040a71c3daa511)}
+  },
+  {
+    {W(0x000244405225ee58), W(0x0003a315205b2034), W(0x0005c47beef4a07e),
+     W(0x0006b683526e3049), W(0x00036198459f70ce)},
+    {W(0x0000ba023ec61391), W(0x00019147bc2eeed1), W(0x00002f107482ff94),
+     W(0x00012b4f1737a1ad), W(0x0005c9f45b3cdc71)},
+    {W(0x0000000000000001)},
+    {W(0x0002079d2acad11a), W(0x0001dea6f63849e5), W(0x000664affa4a3737),
+     W(0x00013e604187583b), W(0x0004e86d20e475d2)}
+  },
+  {
+    {W(0x00004a4a4c891e42), W(0x000058de892fc1d5), W(0x0005d216cf451d59),
+     W(0x000567e1f64ed453), W(0x00075edd0fbe95a7)},
+    {W(0x0004d18e99e4b0c2), W(0x0005de5485865bf3), W(0x0006dd1cc304c044),
+     W(0x00019a7ae5ca6ed9), W(0x00076f4ddea19ed3)},
+    {W(0x0000000000000001)},
+    {W(0x000230b1cb838f3c), W(0x0000a5da2ea7fb30), W(0x0006dc9f3f928436),
+     W(0x0006bfe3c26cddfd), W(0x0000bde530fa8a5b)}
+  },
+  {
+    {W(0x0000156dc72396eb), W(0x00077364314626a6), W(0x0003678a2db23657),
+     W(0x000665d961c37129), W(0x0004bb03689121d4)},
+    {W(0x00049479530f5b20), W(0x00040adaad294ebc), W(0x000186f3e97da087),
+     W(0x00076d935ba3f628), W(0x0003d7de56e7f0ac)},
+    {W(0x0000000000000001)},
+    {W(0x00048e3e2ab13740), W(0x0003f393661817c0), W(0x00020728598ad0b6),
+     W(0x0007ceaa8df02129), W(0x0005657643122975)}
+  },
+  {
+    {W(0x000575d4d8e4d103), W(0x00059fd75c726526), W(0x0006c7c7bbf1b12a),
+     W(0x00048f8b4d7c72ac), W(0x0007c5d0bda815f9)},
+    {W(0x0005ee22f50d05e6), W(0x0007d2e920557265), W(0x0005b53028017782),
+     W(0x0003b646659d17e7), W(0x0005b2294ed9994c)},
+    {W(0x0000000000000001)},
+    {W(0x0007f0a4882fa9e6), W(0x0001b7fa377b71ef), W(0x0003f437db9ceb3b),
+     W(0x00010e6da77803bc), W(0x0004efbcdf415ef9)}
+  },
+  {
+    {W(0x0002ac61be56f45a), W(0x0004c9b796353cf7), W(0x0003f244538676fe),
+     W(0x00042c9e9bb63235), W(0x00015f1dfca32167)},
+    {W(0x000669158784400e), W(0x0001c655306e894d), W(0x00032a01b3023b90),
+     W(0x0003b35ca408b64a), W(0x00017bc95cd3763e)},
+    {W(0x0000000000000001)},
+    {W(0x0000cacb4d7f8213), W(0x000585bd0de7ed1c), W(0x00060aa713a90c0f),
+     W(0x00059b3640344a55), W(0x00004c0c14fbb746)}
+  },
+  {
+    {W(0x0002f63de548aeb0), W(0x0007a327c3c9a469), W(0x0005883fcb6f554d),
+     W(0x00009b2901e2de5e), W(0x0005d69eeac90ac3)},
+    {W(0x000179006282fd90), W(0x000154d83b4062ab), W(0x00044e9534fc8fc9),
+     W(0x000368c9f7a31970), W(0x0002d5cb2534bba4)},
+    {W(0x0000000000000001)},
+    {W(0x00074d7424060816), W(0x00060af99d8966a8), W(0x000603b9aba35c12),
+     W(0x0005a7d45879cd12), W(0x00023b1d433050fc)}
+  },
+  {
+    {W(0x0004721a5648fc31), W(0x00039d7e2285549d), W(0x000353865056b056),
+     W(0x0007f7aa1a3115ef), W(0x00003a124078dd86)},
+    {W(0x00077e9ea86a1adb), W(0x00076ae77a11685c), W(0x0004ddd93d96ed7a),
+     W(0x0006ce8e15cd4a54), W(0x0002e5aea3bc7f8d)},
+    {W(0x0000000000000001)},
+    {W(0x000092ac73a206f5), W(0x0000755dae9c311f), W(0x0006bc4012d934bc),
+     W(0x00024a2c3a07186b), W(0x0003e0c2f99fb0a0)}
+  },
+  {
+    {W(0x0006a0c06bf90641), W(0x00025bcb73761556), W(0x0003d96a68e2c535),
+     W(0x00013f5322c127e1), W(0x0007a7aed567f85f)},
+    {W(0x00067c225fe7fe60), W(0x00047560809c28f0), W(0x0003a059b3c28a5c),
+     W(0x00017b9c733bda10), W(0x0000f9575c1419a6)},
+    {W(0x0000000000000001)},
+    {W(0x0001f60d765f707e), W(0x00004b04b827bd1d), W(0x000199cd4a991457),
+     W(0x0005be30e8e7bb2c), W(0x00070f0444c8a1f9)}
+  },
+  {
+    {W(0x0004ab05e38a6af7), W(0x0005376c371ebcc9), W(0x0007be41112367f3),
+     W(0x00040aa6247fcc31), W(0x000114eabb375a7c)},
+    {W(0x0001708dfc008f67), W(0x0003a0ba99076081), W(0x0002942f1e22006b),
+     W(0x0005f154521ca86c), W(0x0001c92d219a74af)},
+    {W(0x0000000000000001)},
+    {W(0x00045afaccafde44), W(0x0004489728c521d9), W(0x0000b480f4ed4815),
+     W(0x000692ef262193dd), W(0x00021ba4372d5027)}
+  },
+  {
+    {W(0x0005326f88dcec2b), W(0x0003e8e64735bf61), W(0x00066675f7dba108),
+     W(0x00062075cf6cf56f), W(0x00009760654c5e8d)},
+    {W(0x000636ff05f2ac9f), W(0x00068921e73600a0), W(0x0006a2b8209dfdf7),
+     W(0x0001efa0fb9728b3), W(0x0002f6c08e39d596)},
+    {W(0x0000000000000001)},
+    {W(0x0006d229ecfa6952), W(0x00078c4f96fe766c), W(0x00012f4a3756e3de),
+     W(0x0007e6bd39f3c198), W(0x00043bb1c50008b5)}
+  },
+  {
+    {W(0x00077ba7231e0186), W(0x00049a095bb7f80f), W(0x0005c8a4d741dc7d),
+     W(0x0004e8a0a5ba844f), W(0x000663fcc8e0cc79)},
+    {W(0x000388722c6d52dd), W(0x0005229076324f57), W(0x000296b49b73d037),
+     W(0x0004ab85bc1788e4), W(0x0002a295265a966e)},
+    {W(0x0000000000000001)},
+    {W(0x0004d3858f5fdb67), W(0x00074d91fd69415d), W(0x000280d20ce671d2),
+     W(0x0001a2281cb4f18a), W(0x00063e43ae39d090)}
+  },
+  {
+    {W(0x0001b0631e951f4e), W(0x0006fce9b0e384b6), W(0x000666f8a4c0f006),
+     W(0x00003ff3681dcf49), W(0x0004b92e800b62ba)},
+    {W(0x0000ee315d7f7274), W(0x000004450b3fe03d), W(0x000322974a0e4abb),
+     W(0x0006e968481f72eb), W(0x0006a163ca6f5885)},
+    {W(0x0000000000000001)},
+    {W(0x000359bb3b98662e), W(0x0003e0e70d9f7f1b), W(0x0004a974c3906219),
+     W(0x0005c7a029a0a1eb), W(0x0002185fe7d2f64f)}
+  },
+  {
+    {W(0x0004a8a89315f3d7), W(0x000345dd100f3428), W(0x000165d1737956d3),
+     W(0x0003b34d2c7fcd5a), W(0x0006776bfbeeb7bd)},
+    {W(0x0001ce2aa7827319), W(0x00000e61f4b6c74e), W(0x0001cbf4de67c6d8),
+     W(0x000578f86bb511c4), W(0x0002c1a3366898f0)},
+    {W(0x0000000000000001)},
+    {W(0x0002cddd060e258e), W(0x00035343a394114a), W(0x00049b87491985e5),
+     W(0x00003f9fe22bcb1d), W(0x0007b78a3bfe1b31)}
+  },
+  {
+    {W(0x00065a36678672b8), W(0x000700940af5b23b), W(0x0006f833221f6963),
+     W(0x0007a9bba0f256ef), W(0x0005103747dceabe)},
+    {W(0x00005b8516d7dcc0), W(0x00023895d474f904), W(0x0005ff67691ed6da),
+     W(0x0004d914410c25a7), W(0x00041b81f86b9149)},
+    {W(0x0000000000000001)},
+    {W(0x00002712fb0452a9), W(0x00047ac6fb5efea8), W(0x0005b7b561317b24),
+     W(0x00072abd79c8dcdf), W(0x0002cbcf8c4616ee)}
+  },
+  {
+    {W(0x00061da4697178f3), W(0x00066a749159252a), W(0x000326c6d72299d5),
+     W(0x0006bd4356f64caf), W(0x0000e81b2357c194)},
+    {W(0x000412852db8cb80), W(0x000104cbfab52f48), W(0x00027fbf5ee556b9),
+     W(0x00001772f7f9c5cd), W(0x0007c952184102a5)},
+    {W(0x0000000000000001)},
+    {W(0x0007377b40f8574a), W(0x00071c7d00f28951), W(0x000482b59ab8d164),
+     W(0x0002599cf0e24c70), W(0x00019a15ad6c4d11)}
+  },
+  {
+    {W(0x0004963d7025715f), W(0x00037af5d6513e75), W(0x000502eb266e0b7d),
+     W(0x000632e35231f01d), W(0x0006f7dd099eb424)},
+    {W(0x00019a7b95a6b84c), W(0x0003abb5a408e39f), W(0x0001349b004ccebf),
+     W(0x00026a792dcdaf13), W(0x000565d05821174f)},
+    {W(0x0000000000000001)},
+    {W(0x0004f8b91a90df82), W(0x000305c755360042), W(0x000521333037d822),
+     W(0x0004c3c2ab4a6a2b), W(0x0006ef4f19558f01)}
+  },
+  {
+    {W(0x0007d63dd6eef579), W(0x00036ea3eaaf05f2), W(0x0004a4565bedbc44),
+     W(0x000131da56331cbe), W(0x00031d62da4b2f5c)},
+    {W(0x000322f18d0433fa), W(0x00052ab6d550da90), W(0x0004f0c3ce240ce4),
+     W(0x00025690dd3f447f), W(0x00036a71cdf0854e)},
+    {W(0x0000000000000001)},
+    {W(0x00073a77d4c30440), W(0x0006a823ebfa6715), W(0x0001d4bb2afb741b),
+     W(0x0000984c1209cb7d), W(0x0004a0b74764e167)}
+  },
+  {
+    {W(0x000062ad012cae10), W(0x0007943fd9d5c3a7), W(0x00059fd1ace9924f),
+     W(0x0001d7abae632142), W(0x0006380f7220ca06)},
+    {W(0x0003eb4806af523e), W(0x0003bd763665ba62), W(0x0005cbd7e77102ee),
+     W(0x00000da273e73e78), W(0x0005f03008ffa054)},
+    {W(0x0000000000000001)},
+    {W(0x0007ec569633d856), W(0x000378e47686c083), W(0x00041655d4ce356f),
+     W(0x00041cfa8071bbf1), W(0x0006cf62ccbdea19)}
+  },
+  {
+    {W(0x0002b7e18906ce50), W(0x00038da7e1f68a93), W(0x0005e75960942c68),
+     W(0x0004962e3c34cc3f), W(0x0002f170c23b36a8)},
+    {W(0x000767bc13d015fb), W(0x000362e5bdad3539), W(0x0007c269e04f56a1),
+     W(0x000462decd86364f), W(0x0007f4f3902c29a3)},
+    {W(0x0000000000000001)},
+    {W(0x0007180fa063338b), W(0x000590dad5368049), W(0x0006d099dcf4ba3b),
+     W(0x0003cc9ead4c1c7c), W(0x0007a7c6efac4837)}
+  },
+  {
+    {W(0x00040f5d3ef62623), W(0x0000f2f44e9d1996), W(0x0000dae10de22438),
+     W(0x00000209f8c71113), W(0x00028e59b991a9c8)},
+    {W(0x0000a60c76ebf636), W(0x00064d9d3ae3cbc7), W(0x0004c9e5c4a0dc59),
+     W(0x0002c2165abd9076), W(0x0005fa0686ef8c4d)},
+    {W(0x0000000000000001)},
+    {W(0x00038d867e186c2b), W(0x00046b5ed925dfbc), W(0x00042811d3802817),
+     W(0x00061bada6f32b81), W(0x00043a5e6fffdbf8)}
+  },
+  {
+    {W(0x0005d226381e7478), W(0x0003f4cebd9741f3), W(0x0006b35f4117a0d3),
+     W(0x00029ba398b1cce3), W(0x0004315103b20f1d)},
+    {W(0x00070956c11f8549), W(0x0004c5650bd5e769), W(0x0003153b7b00a0c4),
+     W(0x0003a4726a874dcd), W(0x0002c11352ebd14d)},
+    {W(0x0000000000000001)},
+    {W(0x0005a7848767f4f8), W(0x0006eae58078878f), W(0x0005197eef08b03f),
+     W(0x0004926885022f16), W(0x0001be9308b81f46)}
+  },
+  {
+    {W(0x0003f5b09b64a8f1), W(0x0002ad20d15a12e5), W(0x00021e40e76a6671),
+     W(0x0000614135237f00), W(0x000616d148cfb8aa)},
+    {W(0x0003f59301a01420), W(0x0000b4ba3ae8a8eb), W(0x0007e79b8e031eef),
+     W(0x00033ed0a2a89b8b), W(0x00043d3705cbecd3)},
+    {W(0x0000000000000001)},
+    {W(0x00023f0cdbb98ef1), W(0x000523d242c4460f), W(0x0004b3300af61f26),
+     W(0x0004c8b6c6a4fe75), W(0x00019784f24a99eb)}
+  },
+  {
+    {W(0x000764c33c3a8f53), W(0x000264624641a32d), W(0x00012a354792a96d),
+     W(0x0006e03a36cd827b), W(0x00032d4271f05d94)},
+    {W(0x0006fa734b5aeabd), W(0x0002da07fd5cbf86), W(0x0001b45547a6110d),
+     W(0x0001c5ce327ad470), W(0x00025cf8af389b97)},
+    {W(0x0000000000000001)},
+    {W(0x0004651a01087d8a), W(0x0005479c029ffa9f), W(0x0006d2b654a5a962),
+     W(0x0005b97bbb0053c8), W(0x000737470c03eb90)}
+  },
+  {
+    {W(0x0001cfd2c7dec83c), W(0x0000d39f06ae2374), W(0x0007b25c5195f1c6),
+     W(0x00019fbec83b9344), W(0x0001a884d28f512b)},
+    {W(0x000031435274dc6c), W(0x00015d1c1ae4c513), W(0x0000d48fdaaa10c2),
+     W(0x00065c3f282e0b21), W(0x000430c49cad246d)},
+    {W(0x0000000000000001)},
+    {W(0x00021ac558ed94e9), W(0x0000f5822dd33774), W(0x0004cd43909c0b50),
+     W(0x00034cdbf1789c9e), W(0x0001891d6f0ef0f5)}
+  },
+  {
+    {W(0x0005f1d58fd36ffe), W(0x0001945347f54fdb), W(0x000097cabcd499d1),
+     W(0x0005c5945709e112), W(0x0006049fec228ab5)},
+    {W(0x00044ae33f2d648c), W(0x0002dde62ce67cae), W(0x00071f3390ef4828),
+     W(0x000675da2118eeb0), W(0x0000f134d618bb26)},
+    {W(0x0000000000000001)},
+    {W(0x00076518962390a1), W(0x00013632c4f361a6), W(0x00071f3838c61d80),
+     W(0x0002f5ffa1bf82de), W(0x000584ed04042a55)}
+  },
+  {
+    {W(0x0003b6810ceb954b), W(0x0003c18466531099), W(0x0005481c0e88fcdb),
+     W(0x00063febae613cdd), W(0x0003e5819f6412e5)},
+    {W(0x0003121121bd1be2), W(0x0002f8e9f1d9facd), W(0x0000056d8ef161c4),
+     W(0x000015e26866d24a), W(0x0002c02db3866dc8)},
+    {W(0x0000000000000001)},
+    {W(0x00031d47757b92a5), W(0x0007ecd331d972df), W(0x0000c410d2364ba0),
+     W(0x0000873ffe00eac8), W(0x00047d3383d70cab)}
+  },
+  {
+    {W(0x0007675f1fa4a05c), W(0x0003614f8613cc71), W(0x0001b106f050190d),
+     W(0x0007d7e668403d06), W(0x0005a6252d71086a)},
+    {W(0x0004cee4a81956e9), W(0x000295a1521e0054), W(0x0007ef05bacf71a3),
+     W(0x0003f5ad534e61ba), W(0x00004ca92a869234)},
+    {W(0x0000000000000001)},
+    {W(0x000382f2135a086d), W(0x0001adc9b1d90a2c), W(0x0005c2b8a5c473fa),
+     W(0x00048473e286b08d), W(0x00023b8bd82503c8)}
+  },
+  {
+    {W(0x00058bcb49148e4d), W(0x00010ab25b67da53), W(0x00049710e75ce202),
+     W(0x0007fb6fb0efbff6), W(0x0002176b977fa937)},
+    {W(0x0000778bf39755ac), W(0x00030b3c206b2622), W(0x0003e63f9ac841aa),
+     W(0x0004e8b02c2e61b7), W(0x0005e35be3c28738)},
+    {W(0x0000000000000001)},
+    {W(0x0002edc4e1003e8b), W(0x0000737d06a92d91), W(0x0003434e8c9ffc20),
+     W(0x0001a3c5a1cfd5ee), W(0x0005fde2bf963f2a)}
+  },
+  {
+    {W(0x0000207b2b471916), W(0x0005602e1992b22e), W(0x0006b92c2237d2c9),
+     W(0x0006d4519a6c805f), W(0x0005e6612507d9e4)},
+    {W(0x000152a653edec52), W(0x00071c4f690bc7e7), W(0x000238e22fb53f09),
+     W(0x00061436be02bb25), W(0x0005acc965b58898)},
+    {W(0x0000000000000001)},
+    {W(0x00070d47d974dc4b), W(0x0007a5a5a8769ace), W(0x00077628650f8acd),
+     W(0x0001c13eddb3c556), W(0x000369a8d60daf44)}
+  },
+  {
+    {W(0x0000c4d1dbd6d1aa), W(0x0003454d69e8806d), W(0x0002199112a71313),
+     W(0x00022d92387a454f), W(0x000402543c013ec3)},
+    {W(0x00000870f1284396), W(0x00060229a0b62dac), W(0x0000dd868dda2cc4),
+     W(0x00056200c3f1e2f7), W(0x0006402a21b7cf54)},
+    {W(0x0000000000000001)},
+    {W(0x00073655377f8268), W(0x0006e926a23108b0), W(0x000087fdbe7de2e1),
+     W(0x0000b894b40347e3), W(0x0006a4e4612223fd)}
+  },
+  {
+    {W(0x0005e4bc512511d5), W(0x0006872aba6126f3), W(0x0007d1e7498dce5a),
+     W(0x0000550680eb510e), W(0x00034fd0b9ba467b)},
+    {W(0x0007ed5d3934f379), W(0x00017e6776ac1219), W(0x0006e539ce86113f),
+     W(0x00034b5ee5ec29c0), W(0x0006ecedee13f535)},
+    {W(0x0000000000000001)},
+    {W(0x0006a8f801909e84), W(0x00068ae124f4de0e), W(0x0001c3617e1f1d42),
+     W(0x0003ee19afe3b8bd), W(0x0007a37992706a15)}
+  },
+  {
+    {W(0x00044c85587cd36d), W(0x000042deae9d439e), W(0x0007be8e9defc613),
+     W(0x00005c4efa68d50d), W(0x0006bfe1cf9b7350)},
+    {W(0x0006ec7bcb05e011), W(0x000340444f59b67a), W(0x0006028f0639b10f),
+     W(0x0001643bfd833fc9), W(0x0000520c24d6ceb3)},
+    {W(0x0000000000000001)},
+    {W(0x0005f25892a7ede7), W(0x0001a202db2aa519), W(0x00045b7e1a6b75b2),
+     W(0x0003ea5b7dbb2891), W(0x00009daf74abaa54)}
+  },
+  {
+    {W(0x0003e57f36b10e37), W(0x000205b581f3e6be), W(0x000205c95673d55b),
+     W(0x00079d202648589b), W(0x00034f2e6dbf9973)},
+    {W(0x00029a37c290eb15), W(0x00078e56d3774703), W(0x00056491e2638c70),
+     W(0x0001b5189e54d96e), W(0x0006f56921a95d91)},
+    {W(0x0000000000000001)},
+    {W(0x0000011f277ca416), W(0x00060bd1853e4580), W(0x00029bff9af4dd9a),
+     W(0x0006b51231a2af1c), W(0x000329d9412851a0)}
+  },
+  {
+    {W(0x0005cf84e8c43d71), W(0x000637f668700125), W(0x0001ac30a4545d11),
+     W(0x00037b1931989efc), W(0x00003e18d6084154)},
+    {W(0x0001b1958b2e9c1d), W(0x000331a293247a09), W(0x00008455810b2038),
+     W(0x00007019f092bf63), W(0x000445dfa1044c1e)},
+    {W(0x0000000000000001)},
+    {W(0x0006404a2ef91a71), W(0x0000599269bc3237), W(0x00013d0f8e5874f4),
+     W(0x000683be66d34a17), W(0x0002bad69e5b39fd)}
+  },
+  {
+    {W(0x0001c8e06edc7ffa), W(0x0002ea9cf53f83b4), W(0x0001e1e8ed6d3727),
+     W(0x00027f14806b0805), W(0x000200025dbf76c9)},
+    {W(0x00041f8b8bbf28e4), W(0x000736becee4adea), W(0x000143833b289420),
+     W(0x0002cde748ad1f49), W(0x00030f58d7a45c7b)},
+    {W(0x0000000000000001)},
+    {W(0x0004df283b3ce87d), W(0x00021e50076bd5e3), W(0x0001e1c4b22860bf),
+     W(0x0001bac7585deaf0), W(0x0005588bb9e14e75)}
+  },
+  {
+    {W(0x000659ce80e9352c), W(0x000368f9a4a95566), W(0x00004f940ae87642),
+     W(0x0007c6a763e10c2b), W(0x0001b79c99d0e78e)},
+    {W(0x000212d4660cad9f), W(0x00032bf2b17ac46f), W(0x0005cb0490ddef6b),
+     W(0x00027af15050a1f5), W(0x0007c642518c5673)},
+    {W(0x0000000000000001)},
+    {W(0x000021ac8cf18614), W(0x000049841807dc37), W(0x0005aacdbfbebf0c),
+     W(0x0006b5c322d440dc), W(0x0006f939c31f3e98)}
+  },
+  {
+    {W(0x0006afbc4ec828bd), W(0x000516cea9912f27), W(0x0007f4b4c933e035),
+     W(0x00074517ecb355ea), W(0x0005802ff7fb4a23)},
+    {W(0x00015c882f4775bf), W(0x0002f7f30eae0fb3), W(0x0006a5668f9d1231),
+     W(0x00054bb2fbfcd448), W(0x0002d574863be1af)},
+    {W(0x0000000000000001)},
+    {W(0x00043a6245d0e3b9), W(0x0005cac2d1f4d66a), W(0x0005a4837a1d5f35),
+     W(0x00014ffc962dba28), W(0x0004c18dec8c0c79)}
+  },
+  {
+    {W(0x0003ae3a2addf0a2), W(0x0001fea40317f2ec), W(0x00036c63c51f2872),
+     W(0x000379f6f73051c5), W(0x0007b72882bd45ae)},
+    {W(0x000280607f48c0c3), W(0x0001995e79f62b39), W(0x000344e193b4f165),
+     W(0x00031e311b3a413d), W(0x000757ce440e8df4)},
+    {W(0x0000000000000001)},
+    {W(0x0002b232b8f4d206), W(0x00072308a69de489), W(0x0003308b4def2069),
+     W(0x0004bbfd9bd94ae9), W(0x0001d6067a2e84c8)}
+  },
+  {
+    {W(0x00075a3be8e12174), W(0x000326b8159369e3), W(0x0006d9612189074a),
+     W(0x00059ceb71b1a768), W(0x000703177cd84bbc)},
+    {W(0x000152a9943bf6fc), W(0x0000d320350bbd87), W(0x0001ee9045e717ab),
+     W(0x00002c67635477a1), W(0x000134d6608b4580)},
+    {W(0x0000000000000001)},
+    {W(0x000316dbe2ce3d0c), W(0x000778a6bc6d3001), W(0x0005b59d92a4f88c),
+     W(0x000389350834853d), W(0x00047c8bfa95baa3)}
+  },
+  {
+    {W(0x0003f7875aea87fa), W(0x0005f4ed4c9fe988), W(0x0005c9d83b720bd0),
+     W(0x00057377584b5e25), W(0x000726835ee6ea5c)},
+    {W(0x000101497fb32cab), W(0x000608b2ec2dc1b4), W(0x00044ce77f38a598),
+     W(0x00047d31d599d0bb), W(0x0003800fb6d96551)},
+    {W(0x0000000000000001)},
+    {W(0x00075ceddffea1ec), W(0x0007263011c36fbd), W(0x0006f34812a8d045),
+     W(0x0005a212ba331a37), W(0x000378874a45334a)}
+  },
+  {
+    {W(0x00025626b04c884e), W(0x0005b39dc86919ca), W(0x00021bcd8ef83589),
+     W(0x0002146de4e9e77e), W(0x0005f2d1fdb747a1)},
+    {W(0x0002db222fbc5c2d), W(0x000236114f807131), W(0x00007d3b18ecd7fb),
+     W(0x00035e2706ba64ac), W(0x0004b3115ced4cf9)},
+    {W(0x0000000000000001)},
+    {W(0x000665fdaecc8bcf), W(0x00072becb4183230), W(0x000592b2e64bf09c),
+     W(0x000218b1f3ef0d1e), W(0x0002b30df85f1b99)}
+  },
+  {
+    {W(0x00057389927c5190), W(0x000622f7f6c06809), W(0x0002057d57196603),
+     W(0x0002497646d1bfe8), W(0x00025801a452e4b0)},
+    {W(0x0003ae6df97b25c2), W(0x000662e98462f842), W(0x0002f1fe6b0afc83),
+     W(0x00068c8b600b2125), W(0x0001a32933a2df01)},
+    {W(0x0000000000000001)},
+    {W(0x0000ac73990879cb), W(0x000547e422978a46), W(0x000192ab8981093c),
+     W(0x00071034a67712d1), W(0x000533ac9d9bf961)}
+  },
+  {
+    {W(0x00016e1230ce84dc), W(0x000285fea24cf605), W(0x00022c3eeceea00d),
+     W(0x0004f79511b63f2c), W(0x0007d1306320e08a)},
+    {W(0x0007f18cf4f2d5e2), W(0x00058e7a0a0b442b), W(0x000065748a94abd8),
+     W(0x00012d488c4471c2), W(0x00054c3f870fdaaa)},
+    {W(0x0000000000000001)},
+    {W(0x00003defe49645a4), W(0x000547cc97428883), W(0x0006dda947702f22),
+     W(0x00031daec0cf2d35), W(0x000797ba223a6d7a)}
+  },
+  {
+    {W(0x00061b1f5b2731bf), W(0x00071f2ebdf6397e), W(0x00056f71b24e2647),
+     W(0x000075790bb93641), W(0x00042dd3269e0206)},
+    {W(0x0003ed4006eea8a2), W(0x0006f6e7bfac205f), W(0x00006b807adcb1b0),
+     W(0x00025e64d232ed5c), W(0x000253a2ebf324b7)},
+    {W(0x0000000000000001)},
+    {W(0x00022aba2dd01108), W(0x000038a012870d45), W(0x0002bc5688b86a96),
+     W(0x0004ade434a784a9), W(0x00032d1aef2e639d)}
+  },
+  {
+    {W(0x00003a9b943265ef), W(0x00032714dd544aa9), W(0x000577c526570412),
+     W(0x000471dd328999a7), W(0x0001b5f181a1f730)},
+    {W(0x000741a454abf277), W(0x000495c72dee1b22), W(0x0003daaa22d82c51),
+     W(0x000709e929d50bab), W(0x0007a6ddcf121ca4)},
+    {W(0x0000000000000001)},
+    {W(0x0001d95a6f4becac), W(0x0000686b48c94b11), W(0x00074d1a73ffe76f),
+     W(0x0004e208ce175936), W(0x00005d3e84829812)}
+  },
+  {
+    {W(0x0002b91c084c1491), W(0x00066cff01d32c5c), W(0x0001ce8967a76ed9),
+     W(0x00045fa0a889468b), W(0x00010b5849e50afc)},
+    {W(0x00042de3ad69b1f4), W(0x000207609043f80f), W(0x0000c9eeee2ea4dc),
+     W(0x0005b9d581197397), W(0x000114c5f610057e)},
+    {W(0x0000000000000001)},
+    {W(0x000613a58b8e6d12), W(0x0001dc8d032f5a56), W(0x0003b2e9bc7c0f0a),
+     W(0x00047acfd78a72ee), W(0x000650795d1477f2)}
+  },
+  {
+    {W(0x00069571b2a77074), W(0x00048b298495fd2f), W(0x0002f8ee6fda4525),
+     W(0x0005b7ad94a1a8ea), W(0x0001fe1a9d063b68)},
+    {W(0x00032e2e1689ed13), W(0x0003ce817e942529), W(0x00057d6fda329a96),
+     W(0x0004a03fb6827f73), W(0x00018ca9057c1cd7)},
+    {W(0x0000000000000001)},
+    {W(0x0006e21716bb63bd), W(0x000703981c41e9a8), W(0x0001e04aec931cdd),
+     W(0x00069172d98c6aa6), W(0x000105d16fc113ef)}
+  },
+  {
+    {W(0x000724d2bbc0edb3), W(0x00046d7d08b5b656), W(0x0006fa1c6b4a73fb),
+     W(0x0000e3ce3ee050ec), W(0x0001705eca320fff)},
+    {W(0x00048e2cb1e86902), W(0x000252423b27a995), W(0x00073e0852f36dfa),
+     W(0x0003b27f631b1da3), W(0x0003e347a47a7cdc)},
+    {W(0x0000000000000001)},
+    {W(0x00058f5102ed8364), W(0x000704a9e0836c8e), W(0x00057b19167d9ea2),
+     W(0x0004053c1ad7b08a), W(0x00079ec84834f1ad)}
+  },
+  {
+    {W(0x000400be94d62c00), W(0x0005bae5bd8e903d), W(0x00033b3685ee07ab),
+     W(0x000273264f47c2aa), W(0x00020477b055cd3f)},
+    {W(0x000306f9c149fa67), W(0x0005484176a4cf8c), W(0x0001fd94397d0281),
+     W(0x000050e1878bb5ec), W(0x0002d84570295ab4)},
+    {W(0x0000000000000001)},
+    {W(0x0001e2be8944a31b), W(0x00039bc4ebc73f14), W(0x000466ca56ef56f4),
+     W(0x0001b4aa619a9aed), W(0x0002c44aecc3a412)}
+  },
+  {
+    {W(0x00019f27bdc5b6d2), W(0x0004629473520840), W(0x0000c3a2268a44f1),
+     W(0x00065c173db6111e), W(0x0003b4d7d1b58877)},
+    {W(0x0005cb772bc23089), W(0x000287ec9de8be20), W(0x0002830c65bec8b2),
+     W(0x00077603ecc0e6fd), W(0x00010b3e62595a87)},
+    {W(0x0000000000000001)},
+    {W(0x00075448577e06a5), W(0x0003b57c3d9c8a65), W(0x0003dd63387ab42a),
+     W(0x000235892fcf7e52), W(0x00051e3ee9136c7c)}
+  },
+  {
+    {W(0x000407e7adb42d55), W(0x000710221d3d931d), W(0x00067b9e03211e76),
+     W(0x0001d7f234225ed0), W(0x00071fa230afac52)},
+    {W(0x00063a5e9d19fbed), W(0x000143ef0e0d7fc1), W(0x0005828ff1253e20),
+     W(0x00050fd79cfbf42c), W(0x0001373c931df585)},
+    {W(0x0000000000000001)},
+    {W(0x000399bb2bdc849d), W(0x000302a178aea5a0), W(0x0005f77db3e17bab),
+     W(0x0007f31edaf0edc5), W(0x00026936f44c9870)}
+  },
+  {
+    {W(0x00031674877f3a11), W(0x000226060c7a2a80), W(0x0003eeea7ea8c673),
+     W(0x0001baa1611990c7), W(0x0001cea0a39ff661)},
+    {W(0x000534de52a9977b), W(0x0000e1aa9369e23e), W(0x0002812e77f9910e),
+     W(0x0000598ee30a732d), W(0x00035802626b3444)},
+    {W(0x0000000000000001)},
+    {W(0x0002dacc252b20b7), W(0x000671293df7a6d4), W(0x000409f2e54c5767),
+     W(0x000594e32c8f9d6a), W(0x0000486bae1ece3c)}
+  },
+  {
+    {W(0x000564b2c5066e84), W(0x000312df25279bd8), W(0x00075e1de17d1b5f),
+     W(0x0000285db4dc911b), W(0x000638c4387dd9d4)},
+    {W(0x000517a51947803c), W(0x00022e865b26f616), W(0x0004446d30b93f5b),
+     W(0x0000515678d8937b), W(0x0002fc6c1b62d740)},
+    {W(0x0000000000000001)},
+    {W(0x00078592967b40c2), W(0x00053f24ee0c1d99), W(0x00073f5fe07431b1),
+     W(0x00020ccf51756b76), W(0x00005f3cf922acab)}
+  },
+  {
+    {W(0x00050cbe8a9dcab6), W(0x000392eccfd2b640), W(0x0005fba13a777560),
+     W(0x0002520ae86b0692), W(0x0007bcfb7235b709)},
+    {W(0x0004edd3d9593c09), W(0x00068efe2144c4d6), W(0x00061e82ac6282ac),
+     W(0x00022bd340397373), W(0x0001ad7c4126d9b2)},
+    {W(0x0000000000000001)},
+    {W(0x0000f89a0b0af18c), W(0x0001f7156c329802), W(0x0007e042df4ed15a),
+     W(0x00059bbe4c6c062a), W(0x00072cf027f434a0)}
+  },
+  {
+    {W(0x0001f5bee665f259), W(0x0000d374d8de7af2), W(0x00067668be4506a1),
+     W(0x00032f4d2c8a3937), W(0x000712278aeea2b7)},
+    {W(0x0004ef99f80e5e82), W(0x000115bd1654ed3c), W(0x00013126db276141),
+     W(0x0005a20f097d0110), W(0x0002c08dcccfe8fa)},
+    {W(0x0000000000000001)},
+    {W(0x0000cc806a1b9ba6), W(0x0004c812b4044aea), W(0x0006c7f5129c7a03),
+     W(0x0007a59fb45ac90c), W(0x00050746151363c5)}
+  },
+  {
+    {W(0x0005b23ea132dbc2), W(0x000620e39fc36224), W(0x0006c7f0e07c27b9),
+     W(0x0004baba45ed40b2), W(0x0002437df3f5e4c2)},
+    {W(0x00021070f0c430bd), W(0x0000c3b546124577), W(0x000553daed63aa34),
+     W(0x0002a808c5142693), W(0x0001e3a5c028dd92)},
+    {W(0x0000000000000001)},
+    {W(0x000037193ce7ff74), W(0x0004b5220fabf572), W(0x00035b9fe9592a50),
+     W(0x00070d6747232903), W(0x000520c77add807a)}
+  },
+  {
+    {W(0x00007ba67e12de0d), W(0x0007e79f89bf2e1c), W(0x0004717deaf3c01e),
+     W(0x000230cf93bb2828), W(0x0002e90887d9fd7f)},
+    {W(0x0000179b10ba99d3), W(0x0005eb63ae935cb1), W(0x0006f3973968bd64),
+     W(0x0000b99ecad8aad0), W(0x00074f234514ea0b)},
+    {W(0x0000000000000001)},
+    {W(0x0005663e524de782), W(0x0005caa74798190f), W(0x000322ae0305668d),
+     W(0x000591749c25014c), W(0x00074ad1aae5331b)}
+  },
+  {
+    {W(0x0003c314676431f9), W(0x0005a2bf582c28df), W(0x000533dbf19cc0da),
+     W(0x0006f01869cca9e1), W(0x0000cb4f3a19b79f)},
+    {W(0x000217f28d0b86fb), W(0x000413f77f24b093), W(0x00008851dcc781fa),
+     W(0x00039e18a8428d07), W(0x0003b23a10b23380)},
+    {W(0x0000000000000001)},
+    {W(0x0002f82c6a6f140b), W(0x0007a9217288f66f), W(0x00044b4c647c40ce),
+     W(0x000270aefa97454d), W(0x00049388fdee8d7a)}
+  },
+  {
+    {W(0x000690713ad0134a), W(0x00009ee01668d297), W(0x000670107934ba6d),
+     W(0x00059885269f7adc), W(0x0004abbdc2757697)},
+    {W(0x00002b4483eaac67), W(0x0000b4fdd7a06c01), W(0x0002de8883514ceb),
+     W(0x00006c63767ed6c3), W(0x000737a465928865)},
+    {W(0x0000000000000001)},
+    {W(0x0004f385c0b6e682), W(0x00062efa4185a5e5), W(0x000086d0e897b405),
+     W(0x000634fb6a81b343), W(0x00041ab6f61b1178)}
+  },
+  {
+    {W(0x00049f0985504c31), W(0x00074cf340d95560), W(0x0006ef7aef331630),
+     W(0x0000533fb02ba90a), W(0x00017240bc1a8852)},
+    {W(0x00031e2e73eb087c), W(0x000042fc7a5c4f7c), W(0x000676a6788fa3ee),
+     W(0x00023e8d768b101a), W(0x0007f22f93e96336)},
+    {W(0x0000000000000001)},
+    {W(0x0006194e5bd4f182), W(0x00050076b617080f), W(0x0003b49fa075ef59),
+     W(0x0002801346880fba), W(0x0000a0a981874bc3)}
+  },
+  {
+    {W(0x00043b97a5002449), W(0x00062760335f632a), W(0x0007bd1f06f5f075),
+     W(0x0004032d0724aecd), W(0x000161c8b869e118)},
+    {W(0x000036a860b8fd21), W(0x000745e33d41459b), W(0x0000e188e4cc031b),
+     W(0x00065c18b640020b), W(0x0002e14c14eea780)},
+    {W(0x0000000000000001)},
+    {W(0x00061c7d5bf40760), W(0x00045e14d1548184), W(0x0004efea7c2b75ca),
+     W(0x0001b9d0ce904eb3), W(0x0002893c17a5fbe2)}
+  },
+  {
+    {W(0x00066f8a4c960182), W(0x0007acf817a539d9), W(0x0002b3f99abe98af),
+     W(0x0007379b8d654fcb), W(0x00016d94dee0a07c)},
+    {W(0x0003d5e4ec6728ce), W(0x0000ba19baaf82c1), W(0x00035baa5e3b8ea6),
+     W(0x00062fef51e30588), W(0x0002835ee0036a04)},
+    {W(0x0000000000000001)},
+    {W(0x00015d72d07357eb), W(0x0001e745585ea894), W(0x000481fb16d37ef2),
+     W(0x0003e16957e44ac9), W(0x0004a78b4c35273e)}
+  },
+  {
+    {W(0x00014e697e1ac6ca), W(0x0007878755ff148b), W(0x000428c21120b653),
+     W(0x0006bea087ff48fd), W(0x00073a1700ab27a6)},
+    {W(0x0006114bd20d67f3), W(0x00015f15fae5a773), W(0x0006bb5387ab93a8),
+     W(0x000099bbc255ab7a), W(0x0006df067d7aeac9)},
+    {W(0x0000000000000001)},
+    {W(0x00040574948c82e0), W(0x0000196d4a541f08), W(0x0002641387aa1878),
+     W(0x0002b3e86e82834f), W(0x00052d9322aedc51)}
+  },
+  {
+    {W(0x00073783b9f42b9e), W(0x00049fb35aff35c3), W(0x0003eac77887478b),
+     W(0x0003246182468b29), W(0x0007c09f68e13e5d)},
+    {W(0x000070c99c5bdb3e), W(0x0006fab2932a1386), W(0x0002d898825b05e7),
+     W(0x0007be4aad5bf174), W(0x00021070c4a02110)},
+    {W(0x0000000000000001)},
+    {W(0x00001e3df0d0bdd6), W(0x0004d8b38a8787f2), W(0x0000a24765c296e0),
+     W(0x00005763040fb258), W(0x00024f3d6825a80d)}
+  },
+  {
+    {W(0x000761f499d436f0), W(0x0000e88efd04587e), W(0x00027dc30ffe50f3),
+     W(0x00071d2c679012d5), W(0x00074ba8d23760c2)},
+    {W(0x00060a9c265482e6), W(0x0004b3fbf922b6c4), W(0x0007e48f85799e4d),
+     W(0x0002a57948677e7e), W(0x00069eef20a5e1d9)},
+    {W(0x0000000000000001)},
+    {W(0x0002ca5969bd7eed), W(0x0006810261c3b7aa), W(0x00033c96f34fe580),
+     W(0x00016ee4b64ad1aa), W(0x000111d8c72a99f9)}
+  },
+  {
+    {W(0x0007d0a1d3b760ce), W(0x00020164702cdb97), W(0x0007f21dac95f8b9),
+     W(0x0002e6cee9fe1897), W(0x0000f5e9110aed65)},
+    {W(0x0007bbadb42efe87), W(0x00061b43e937eb41), W(0x00051d4991ba2ffd),
+     W(0x00022a9d170a5e70), W(0x0001e324e68e81e6)},
+    {W(0x0000000000000001)},
+    {W(0x00031cf42711f16d), W(0x000190b997a33e31), W(0x000710c0a4166bbb),
+     W(0x0001fee5ea516d2b), W(0x0004a44645ced228)}
+  },
+  {
+    {W(0x0002bedcbdfe6853), W(0x0004d9d1428df106), W(0x0005190ccb2c6695),
+     W(0x0003a440d1f0c474), W(0x0001ced843c43c50)},
+    {W(0x0004d1c09a3197a4), W(0x00071521d3c303d0), W(0x0002ab2546511d40),
+     W(0x0002850c12e43a13), W(0x0005bc33777f3975)},
+    {W(0x0000000000000001)},
+    {W(0x000524e525b825b8), W(0x0007b624fb49a9aa), W(0x00025c9b01dfd60e),
+     W(0x000734a2f3821f38), W(0x00043d4bb80beb73)}
+  },
+  {
+    {W(0x0000c8fb7f735881), W(0x0000d417e08a8716), W(0x000638864ae820e9),
+     W(0x0002b79a790f2356), W(0x000748e18529c6fb)},
+    {W(0x0005fcce81e1d628), W(0x000379d7bed1e789), W(0x0006859f18689763),
+     W(0x0005dcd74c9305a3), W(0x00039cea9e0c6e4a)},
+    {W(0x0000000000000001)},
+    {W(0x000375e7d6bf0b23), W(0x000028293a41b577), W(0x000408d0f2984464),
+     W(0x0007e3f32767c11a), W(0x00033e6fa59f104f)}
+  },
+  {
+    {W(0x0006a2d611d966a5), W(0x0004b511190e51ba), W(0x0001be8a2fb61969),
+     W(0x0003ddbe47292f45), W(0x0007201bd70d103f)},
+    {W(0x0007aa5c5bb9efae), W(0x0006e87ab34ba26e), W(0x0006052dce95c1f5),
+     W(0x0001809fd14ebf64), W(0x00069fd5aac48fab)},
+    {W(0x0000000000000001)},
+    {W(0x00046e824a1e0357), W(0x0006ad8de2c3654d), W(0x00040a0572608980),
+     W(0x00034958aed91313), W(0x0007398cb97958c8)}
+  },
+  {
+    {W(0x0007b8995eeb7f5d), W(0x0007d17893671364), W(0x0001ad3839ad4cd6),
+     W(0x000601e1319f41b5), W(0x00060651b8629260)},
+    {W(0x0005a67c4455db4d), W(0x00000871f9484553), W(0x00041a95d693186c),
+     W(0x0003cc267f790827), W(0x0002762550c1c5bf)},
+    {W(0x0000000000000001)},
+    {W(0x0005e0b04d316ea7), W(0x000219e15617b4fc), W(0x0001f59317d54d8f),
+     W(0x0001a2eee7aa0bf5), W(0x00045bb447de9738)}
+  },
+  {
+    {W(0x0003dbb004f53c39), W(0x0000b4ad57b1779c), W(0x0005f3505718c055),
+     W(0x000233910103cefc), W(0x0000ebcc5de2c72f)},
+    {W(0x00042a878bd02a10), W(0x000396b1fa0385e7), W(0x00072f1b94703928),
+     W(0x00075556da481dc6), W(0x00002b78a3fe0647)},
+    {W(0x0000000000000001)},
+    {W(0x0001099e41fbaa3a), W(0x0002133b94d6e42c), W(0x000747ec215b8fbd),
+     W(0x0001abaf967b8eba), W(0x00066e1f7aefee26)}
+  },
+  {
+    {W(0x0005ba980aa63d82), W(0x0006243a72d68a64), W(0x0002d9a735793120),
+     W(0x0004f12b4e2d0ba6), W(0x000309fbc1113c3a)},
+    {W(0x00047895ee284f67), W(0x0004cfd51b4fb1fc), W(0x0003d14e059c9065),
+     W(0x0007c5c38de65ba2), W(0x000432d8cd68da66)},
+    {W(0x0000000000000001)},
+    {W(0x0004f23e31c3dc8b), W(0x00064305e6cfcec6), W(0x0002ccd8417360ad),
+     W(0x0004c306b0d39b41), W(0x00027cdef0b82823)}
+  },
+  {
+    {W(0x0005cbbb2b8d9e52), W(0x0003490273d6ceac), W(0x0002359023eb45b3),
+     W(0x0003313324e69abc), W(0x0006a3e5a6746ddd)},
+    {W(0x0002337a73384499), W(0x0001b74e95e136a7), W(0x00056b1c37167f36),
+     W(0x00075876ab6d0ad2), W(0x0002dde3c711d392)},
+    {W(0x0000000000000001)},
+    {W(0x0002a618f7c43f2f), W(0x0001882eb52f56e0), W(0x00035e3b27f8e75c),
+     W(0x00027afdb6efe118), W(0x0003e7e2e26b6774)}
+  },
+  {
+    {W(0x0006dc806f3fcebe), W(0x000449444eacdfc3), W(0x00001048eed0fe5d),
+     W(0x00071ca259b87d47), W(0x0000e114a02edcaa)},
+    {W(0x0000bf23cd96a31f), W(0x000212f7e7bf560d), W(0x00070a6a9bbd166c),
+     W(0x00015bf380355f10), W(0x000181635e8add93)},
+    {W(0x0000000000000001)},
+    {W(0x00069c8ac0bca60c), W(0x0001c972a204bfe8), W(0x00053ff095cdae66),
+     W(0x0003328ecc4b3267), W(0x0002b5640c5fe9a6)}
+  },
+  {
+    {W(0x00049f8950011e19), W(0x000642291f37e0dd), W(0x0006e2e9833ba8da),
+     W(0x000470a97f16c1fa), W(0x000151249c1871c7)},
+    {W(0x00009d2a0c0baceb), W(0x00076c14463e7d32), W(0x000782ada7e355ae),
+     W(0x0003c9e381c0de3e), W(0x0002fd3450d3c927)},
+    {W(0x0000000000000001)},
+    {W(0x0001d8071a0ffd21), W(0x0007b085f9d8bb3b), W(0x0001016738449d9e),
+     W(0x000395c3f84e0482), W(0x00056e99dffff67c)}
+  },
+  {
+    {W(0x000669f1a5f1d4c3), W(0x00020139e3c45caf), W(0x00033588ecd25575),
+     W(0x0001b9003a05539c), W(0x0003a2eb49cc15ad)},
+    {W(0x0002765e635ecdb1), W(0x0006a700557ebdd6), W(0x0002f4580acf882d),
+     W(0x0000aace357f159f), W(0x000054d0b29845f7)},
+    {W(0x0000000000000001)},
+    {W(0x0002ef1f9367b6c9), W(0x0000277c46c45232), W(0x00067d768157e10b),
+     W(0x00015c8aaf6f68d4), W(0x00039b4d91341e4c)}
+  },
+  {
+    {W(0x000179eca82fadfe), W(0x0006898ca38661c5), W(0x0001a4891d0497b3),
+     W(0x00064505ff2d1aa4), W(0x00066d51883395bd)},
+    {W(0x000638d87887f0d0), W(0x00001698da33d37a), W(0x000783e8b28c58fc),
+     W(0x000012861a15d686), W(0x00060246c9776c99)},
+    {W(0x0000000000000001)},
+    {W(0x0006dfd3d33825ac), W(0x0000ec0bf555a9dc), W(0x0005a97568340414),
+     W(0x000741b8e3a475b6), W(0x00057c3d384fe562)}
+  },
+  {
+    {W(0x0001ee3deaacd8cd), W(0x00027fca03fffd8d), W(0x0007c118aa6f0f5d),
+     W(0x0003bee2cc34f3fb), W(0x00069a68e3a3a5c4)},
+    {W(0x0002286ad1d6bf0a), W(0x00021f0fe3214598), W(0x0004ea06bea05c1d),
+     W(0x0002219dc8bf033d), W(0x00044ff1e8ce0dbf)},
+    {W(0x0000000000000001)},
+    {W(0x0003c6586c4f3e7a), W(0x00035064c51ba015), W(0x00078e6e7fb9f3f1),
+     W(0x00035d7b9395dda2), W(0x0003e292debaeea8)}
+  },
+  {
+    {W(0x00078b8dd97469bc), W(0x0003c3d6109808e8), W(0x0000ea1504235b79),
+     W(0x00006ec6d0e6bab8), W(0x00048f2289b1142c)},
+    {W(0x000378859f05dca4), W(0x00047fa8e2323387), W(0x000249a513e2528b),
+     W(0x0000965f6dcda0ff), W(0x0002a9bc2717ff4e)},
+    {W(0x0000000000000001)},
+    {W(0x000177df826f2c0c), W(0x0004ee87571a5766), W(0x00059734732ef632),
+     W(0x0005a85247025781), W(0x000431ba8c7980df)}
+  },
+  {
+    {W(0x0004d9dcecf82dd6), W(0x0004a8224b1e471c), W(0x0002ef528c315ee4),
+     W(0x0000371f17c583ea), W(0x0004a112404fecf1)},
+    {W(0x0002da5d6bdcd74c), W(0x00032a251a296cc1), W(0x0006818d52690881),
+     W(0x0002175e4fef77b1), W(0x0005a7872a88a071)},
+    {W(0x0000000000000001)},
+    {W(0x0002b344eeed2e44), W(0x0004b92dfb2677de), W(0x00018bf4f7b54856),
+     W(0x0000001159b99265), W(0x000223c607b09571)}
+  },
+  {
+    {W(0x0005c5f0bfe29ea1), W(0x00019689aac88f8e), W(0x00067faaf3f7979e),
+     W(0x000025ae2442de71), W(0x0004da099a6c789f)},
+    {W(0x00060845ddfc61e7), W(0x000294be60a00e1a), W(0x00057e46580fb466),
+     W(0x0006b5df754cf1cb), W(0x000169833c1fc0ce)},
+    {W(0x0000000000000001)},
+    {W(0x000703cbc4ddafd4), W(0x0007b67a8669074d), W(0x0002b9400cfaa153),
+     W(0x00023abacb3bb492), W(0x00045242dc1137b1)}
+  },
+  {
+    {W(0x00058b9d49c6bc74), W(0x00013b5154034599), W(0x0001594b0720a28b),
+     W(0x00006fb46a3fb766), W(0x0001e7180ef59f2f)},
+    {W(0x0002bad0432b403e), W(0x0003518a368dce98), W(0x0007e6b0261f4dd8),
+     W(0x000631eacb5eda5c), W(0x00026aa572b870b4)},
+    {W(0x0000000000000001)},
+    {W(0x00076c2f4628ed58), W(0x0002d8ea85f150f5), W(0x0007c67e09a09a9c),
+     W(0x000428ceff55285a), W(0x00022b425f57de9c)}
+  },
+  {
+    {W(0x0007935ac81a615d), W(0x0002176221610662), W(0x0005adb5f462fc1a),
+     W(0x0002b72c704023e4), W(0x0004121a8fa6cae5)},
+    {W(0x000416c27d882c67), W(0x0004c60d036fb577), W(0x0003ed77374755e6),
+     W(0x00018b56d34d8eef), W(0x000485079c511c72)},
+    {W(0x0000000000000001)},
+    {W(0x0000eaa846a23105), W(0x0006cea99efb27e1), W(0x00047b498024a3dc),
+     W(0x0002e847d86edb57), W(0x00067cd86a7ba2fc)}
+  },
+  {
+    {W(0x00024338dd682e4b), W(0x000157c20f4084fb), W(0x0001d4c19b426d78),
+     W(0x00048832a2b2ef20), W(0x0004d7e7ff740623)},
+    {W(0x000068424d9a9613), W(0x00079933560596e8), W(0x0005318d6d71e638),
+     W(0x00064c6b6a07320c), W(0x0002b2e3f3fdfbc8)},
+    {W(0x0000000000000001)},
+    {W(0x00052bfe947b3e4d), W(0x0002f59b8448b4fd), W(0x0003f90a7e4117f9),
+     W(0x00046d2290e0873a), W(0x00052066d06c8066)}
+  },
+  {
+    {W(0x0007f0aab4f63a4c), W(0x000738644d75b2e4), W(0x00079c4e738184df),
+     W(0x00004c84521783b7), W(0x000250a2b9f911e3)},
+    {W(0x0006ca724414338c), W(0x000460cedc1ab276), W(0x000775b44bd3ea85),
+     W(0x00063205ef0ac449), W(0x0006275aacf45f83)},
+    {W(0x0000000000000001)},
+    {W(0x00076fb8b32cb894), W(0x0000c2a7a413f8b0), W(0x00057675b6a1d7d5),
+     W(0x0007266481053df2), W(0x00068e769349f4f0)}
+  },
+  {
+    {W(0x000512449b2819a5), W(0x00068bb92f6b57e2), W(0x000188336251b083),
+     W(0x00018da4c426d99c), W(0x0005e192d577360b)},
+    {W(0x00044b6d5ce131e5), W(0x00052293c87915cd), W(0x00048a3e59a4166e),
+     W(0x0006758413e02e30), W(0x000794d3184ce120)},
+    {W(0x0000000000000001)},
+    {W(0x0001271c9c1eaa79), W(0x00071db63ac5f57e), W(0x00055881fee53d9f),
+     W(0x000795312753ab30), W(0x0003efc764641988)}
+  },
+  {
+    {W(0x000757ccc82992d9), W(0x0007a476ef19936d), W(0x000410ce43fbb1de),
+     W(0x00077f6627330880), W(0x0005616c729febf7)},
+    {W(0x0006c97d50ac6233), W(0x0004ea3841784099), W(0x0002b3b3a851226a),
+     W(0x000429b0d6002cc6), W(0x00072ac248c31637)},
+    {W(0x0000000000000001)},
+    {W(0x000533347d9e0172), W(0x00041a9f2c420f0d), W(0x0006b1fc02e41235),
+     W(0x000603d5e481cc38), W(0x0003c1f4c378fd04)}
+  },
+  {
+    {W(0x000707d6046deda2), W(0x000255eee0d0c107), W(0x00058d5f3845c4f5),
+     W(0x0004fb3ed4ff05b2), W(0x00041ef0456c7481)},
+    {W(0x0006e7dd7cd5c65f), W(0x0006ca66948669f5), W(0x00031366af7cf47d),
+     W(0x000533ceeec4e421), W(0x00054b85c495da69)},
+    {W(0x0000000000000001)},
+    {W(0x00059fb23105f139), W(0x00000a1860bcaf48), W(0x0004b3b9d0671e1f),
+     W(0x000192c633ec15f6), W(0x00040800c8cfb2c7)}
+  },
+  {
+    {W(0x0003b69f9ba5fac4), W(0x000125cde1763c00), W(0x0004e73b15424ff2),
+     W(0x0003785d7e824478), W(0x0006105fada79227)},
+    {W(0x000286df00ce15a3), W(0x0007da4357621998), W(0x00075fb93a693d4e),
+     W(0x000050969ff9f874), W(0x0006c1a1b14d6c43)},
+    {W(0x0000000000000001)},
+    {W(0x00018bf2383d7988), W(0x00028012bb31a61d), W(0x000071094499aa27),
+     W(0x0001fc1b6f40f093), W(0x00020e88d920f290)}
+  },
+  {
+    {W(0x00061da329fa3170), W(0x0003d3eae5f6c311), W(0x0005f1a37e3823be),
+     W(0x000276593438c166), W(0x00032f594620c81d)},
+    {W(0x000126fd4fee722b), W(0x0007b68a58f99223), W(0x000644886f190931),
+     W(0x000372abfa3131c6), W(0x0006ae6781c3a852)},
+    {W(0x0000000000000001)},
+    {W(0x0004ab047da000d0), W(0x000294885b69bbe3), W(0x0006d440e90f6c32),
+     W(0x00055397ce11f4f5), W(0x0005f7deee23304d)}
+  },
+  {
+    {W(0x00075eb38d03e858), W(0x0006afd3803e8388), W(0x0002697613dc0f64),
+     W(0x0005477593f58aca), W(0x0005b66482a97a77)},
+    {W(0x0006a547052f12ca), W(0x000099a078e4d870), W(0x0007889f10eff7ee),
+     W(0x00067ef460595783), W(0x000039815ebf86f3)},
+    {W(0x0000000000000001)},
+    {W(0x00037d881ac26259), W(0x00028ef35194f56f), W(0x00045dc0793230a5),
+     W(0x000128a8d487b7d2), W(0x0002fc3bcdc7e238)}
+  },
+  {
+    {W(0x0005d3c04b4533df), W(0x0007f98b473c0996), W(0x0005ebfba4c307eb),
+     W(0x0006e0133f73c2d1), W(0x00009d6631272da1)},
+    {W(0x0003cea029b40cba), W(0x0005104b488c3a82), W(0x0004aca9a972b0f7),
+     W(0x00033a83e2904503), W(0x00007a3ddee6024e)},
+    {W(0x0000000000000001)},
+    {W(0x0004167917e7a0a7), W(0x000686c6ebf9788b), W(0x0000ba1ccccc44cc),
+     W(0x00018580ad12bec6), W(0x0007faab0f24ec7e)}
+  },
+  {
+    {W(0x000510c96f328566), W(0x0007161cd7f7d7e6), W(0x000489250489b63a),
+     W(0x000238a03d80ae4e), W(0x0005929a5271dae4)},
+    {W(0x00071fa302ac3d1f), W(0x0000a43dd3679017), W(0x000685f0dfac8468),
+     W(0x0004765ec0c04cb6), W(0x0003fb401fee5446)},
+    {W(0x0000000000000001)},
+    {W(0x00018f2d1b336f11), W(0x0001015a7866e49a), W(0x00004492a89d4335),
+     W(0x00048e5445e723f5), W(0x0005b6b431d947e2)}
+  },
+  {
+    {W(0x000583fcc18998f4), W(0x0006679be43217bf), W(0x0007139be2dfa446),
+     W(0x00026e74c46d91ae), W(0x0005538a4aaebf97)},
+    {W(0x0004b48d0a1b08fd), W(0x00066cf61ba2311e), W(0x00038beae120d029),
+     W(0x0000e442f9abac29), W(0x0005a937fb871101)},
+    {W(0x0000000000000001)},
+    {W(0x00052f0674502395), W(0x0001f224b945abfc), W(0x00007046e3d409bb),
+     W(0x00013b4d28281b1b), W(0x0000d0de59517ba7)}
+  },
+  {
+    {W(0x000022a3893a85b1), W(0x00004b4effd02a01), W(0x00063e6561177b01),
+     W(0x0002e5659bdd2f9f), W(0x0003fc398bf7a3b3)},
+    {W(0x0006b29579ce3d2d), W(0x0002f5d4a7e674d8), W(0x0001b1b90249d217),
+     W(0x00029e759730d043), W(0x0000ae9ebb1fc3e4)},
+    {W(0x0000000000000001)},
+    {W(0x00044716f08171c0), W(0x00034a732a6c1c35), W(0x000750e7b18c3f21),
+     W(0x000581ba0962c8ae), W(0x0006916bd35d852b)}
+  },
+  {
+    {W(0x0004fe90ed827f01), W(0x0007e75758431762), W(0x0007139194f0b71d),
+     W(0x0006fdd8e9ef7637), W(0x00010e6da39b04dd)},
+    {W(0x0002ce1654b78a76), W(0x0007fee346204f05), W(0x00065f4ed0301602),
+     W(0x000012c688d386c9), W(0x000176f2b89a3b03)},
+    {W(0x0000000000000001)},
+    {W(0x00019f6c09c82d1f), W(0x0006e6cc7844782e), W(0x0001e8803e7481be),
+     W(0x0007f87def951e84), W(0x000665f8e79b62ab)}
+  },
+  {
+    {W(0x0007583312cb9ae1), W(0x0006118a59f02a0c), W(0x0005acd2a57a8b81),
+     W(0x0005d57b057338d8), W(0x0005b75ad46ccde0)},
+    {W(0x00053d08e77bec9f), W(0x000511d783d463c4), W(0x00022b4565f053a8),
+     W(0x000245d19c7d65be), W(0x0000e981a556a702)},
+    {W(0x0000000000000001)},
+    {W(0x000234fb936b488e), W(0x00035c3b2b0f01c6), W(0x000643b894eba1fe),
+     W(0x0004e372d52ea305), W(0x00030c406c32f7a5)}
+  },
+  {
+    {W(0x000296404577d24d), W(0x000615d7c819a557), W(0x0002e97022fb73d6),
+     W(0x00053cbb9834f42e), W(0x0002428ea2e1324b)},
+    {W(0x0005badbc49f3649), W(0x0003365c9a7e63d0), W(0x000362834b83e8ca),
+     W(0x00032b7f13a0f9ea), W(0x000237b002089993)},
+    {W(0x0000000000000001)},
+    {W(0x0007aa6884b873d6), W(0x000716c334bfa1b2), W(0x00034ab568c768de),
+     W(0x0002e8970d65a90e), W(0x0006a8e76da66725)}
+  },
+  {
+    {W(0x0002ed47d5fe5d3e), W(0x000082248c272a2e), W(0x0004fe0f74961dc1),
+     W(0x00001bc19d456ad3), W(0x0005987c9d8eccae)},
+    {W(0x00074466e607bdd5), W(0x00050f0bd0484e43), W(0x00069ae2e109e543),
+     W(0x0000f3b78473ef20), W(0x0000fa9013b0403a)},
+    {W(0x0000000000000001)},
+    {W(0x0006471f6f2f4749), W(0x0007a7f421c65e4d), W(0x0005821d513645de),
+     W(0x00076593e2401dcd), W(0x0002eb3dbec11f0d)}
+  },
+  {
+    {W(0x000236f66ebc63e9), W(0x0001ddbb2c116c85), W(0x000337fe1335e661),
+     W(0x000661215525ef04), W(0x00005cdc9de87134)},
+    {W(0x00067dc360acab9e), W(0x00045308d569966c), W(0x0000e59d614fe616),
+     W(0x0002fcce5339024a), W(0x00065f58258c3997)},
+    {W(0x0000000000000001)},
+    {W(0x00045fe0d1a3d158), W(0x000600d130fa407c), W(0x00011ea3d359a5f4),
+     W(0x0003dbb48688286d), W(0x0003663de8493200)}
+  },
+  {
+    {W(0x0000f84fea3c28f3), W(0x0001abccb5b8bc3a), W(0x0000bc1db78667d6),
+     W(0x00001727fd1edde4), W(0x0005aef03010d29d)},
+    {W(0x0000ba3108a533c0), W(0x000151ed3c6a8cd0), W(0x00075c1308a6d77c),
+     W(0x00025a2f0dc388a0), W(0x00061505bde881bc)},
+    {W(0x0000000000000001)},
+    {W(0x000749e6d260488d), W(0x00022693dc9a44d7), W(0x0002f2f2d755f36e),
+     W(0x0003efdd0b3ba8ed), W(0x000018bfe97e67a2)}
+  },
+  {
+    {W(0x0005608e63c554c2), W(0x0002f24db9c3e986), W(0x0007e72262661fd7),
+     W(0x0007580a6975bdd3), W(0x00036608288b6b98)},
+    {W(0x000316e33b39292f), W(0x000486eb696685d8), W(0x00018062923d72de),
+     W(0x0006b5736b862408), W(0x0001d655dca57966)},
+    {W(0x0000000000000001)},
+    {W(0x0007f661f2a44f86), W(0x00017e0334c015fb), W(0x00054d4cf8833505),
+     W(0x00034b35299d9979), W(0x0006f07de00bec03)}
+  },
+  {
+    {W(0x0001a459a1cabf7d), W(0x0000643617e1b6db), W(0x0006a375db957b0b),
+     W(0x0005d687abafc90a), W(0x000700f0ea0efb0e)},
+    {W(0x00043c31826e2aa4), W(0x0007d56ffba8eb1e), W(0x0003d6b735db2241),
+     W(0x00044beecf0e46e8), W(0x0006af3283646e9a)},
+    {W(0x0000000000000001)},
+    {W(0x0005d590d05d97a4), W(0x0002d4b205227053), W(0x0001ffd8a797466f),
+     W(0x00073db8e778a953), W(0x00038c1e6dfa00db)}
+  },
+  {
+    {W(0x00027815450f2087), W(0x00008a59e5f42c62), W(0x0007f3ef95b97556),
+     W(0x00063a53037ed386), W(0x0002fd006b399308)},
+    {W(0x00016ef4d25f3dd3), W(0x00010e35478933fd), W(0x0002ac14c9e0b558),
+     W(0x0007f90e7c281700), W(0x0003cebb4458f119)},
+    {W(0x0000000000000001)},
+    {W(0x0006013716f1da7e), W(0x000638d5cdb3614a), W(0x0007a1af4e0717ab),
+     W(0x0002302bd975d988), W(0x00032459612e7525)}
+  },
+  {
+    {W(0x0007fd3703654dce), W(0x00056c0b8ea54356), W(0x000294183a79fd81),
+     W(0x00000166046d17e0), W(0x0007ef0e921bb1cf)},
+    {W(0x00058d60222fba76), W(0x000087186d3a94fe), W(0x000579365d7cfda4),
+     W(0x0006eec7b43a7fbd), W(0x00028334f1b18dde)},
+    {W(0x0000000000000001)},
+    {W(0x0005a731dc43c597), W(0x00026e590b9bac74), W(0x000232fcc8665a2b),
+     W(0x0002567547302089), W(0x00005798f57dcc6d)}
+  },
+  {
+    {W(0x0006bfb63e6aa598), W(0x0005f7a8701bd7a4), W(0x0001b90c47fe9377),
+     W(0x0007c5b3198df0bf), W(0x000613ba76d3a0c4)},
+    {W(0x0000a659eb4a3f9d), W(0x00011811ce943c84), W(0x0003ad11110f4476),
+     W(0x00007a53fc0809f9), W(0x000321580e51d823)},
+    {W(0x0000000000000001)},
+    {W(0x000211065f45e853), W(0x000384ed2a816257), W(0x0003bfeb20af6b89),
+     W(0x000032df40a04d69), W(0x00025652379ead5d)}
+  },
+  {
+    {W(0x0001cd4a707f9162), W(0x000468be6fe6f0c6), W(0x0002c402e736d10c),
+     W(0x0001b6124ef35554), W(0x0000ac39902ae506)},
+    {W(0x0000a172ca2ab147), W(0x0001f910cdc103ff), W(0x00079b839fa1655c),
+     W(0x0001205e21840f38), W(0x0001f67f7a165cad)},
+    {W(0x0000000000000001)},
+    {W(0x000119734977db46), W(0x0004609cdb515deb), W(0x00044cc17edde6e2),
+     W(0x0007731a39d43555), W(0x00006ff23949cd7c)}
+  },
+  {
+    {W(0x0005330c0554f99f), W(0x0002d21619f3ba92), W(0x0006adfe299a1961),
+     W(0x0001fd45234bd127), W(0x0002ac5c38448ef5)},
+    {W(0x0005d63d3658d5c4), W(0x00026ca0397a1106), W(0x00075f5608801a59),
+     W(0x0002f7219f6ab2be), W(0x0007093a0e113fc5)},
+    {W(0x0000000000000001)},
+    {W(0x0004525689717e3d), W(0x0001f1b6813453a8), W(0x00022ee1c2792375),
+     W(0x000093ccdf30e742), W(0x00049a2ce77902ec)}
+  },
+  {
+    {W(0x000475f6ac25aae4), W(0x000017aa3644c488), W(0x0002f9e757b415e1),
+     W(0x00012e1d191a7088), W(0x0002d3ecf12055bb)},
+    {W(0x0003861bafd012c3), W(0x0002eb78686674c9), W(0x000559800048d53f),
+     W(0x0003c42bf60d47b0), W(0x0003b65eb0a186eb)},
+    {W(0x0000000000000001)},
+    {W(0x000404fcb8dec632), W(0x00075e89fb419b64), W(0x0000f9ddb4c7ec58),
+     W(0x000417e5bb5033c7), W(0x00042165fc17f93c)}
+  },
+  {
+    {W(0x0002459c8282e16c), W(0x0003ae6b1e9d148f), W(0x00016cc8db41bae5),
+     W(0x00062dc3294cfa3e), W(0x0000b701776adeb2)},
+    {W(0x00048c83f4223e27), W(0x00062d6520768b0c), W(0x0005418da0ad7abb),
+     W(0x0004851741484571), W(0x00034ce40c98a5c5)},
+    {W(0x0000000000000001)},
+    {W(0x00048fc1979a6710), W(0x0001982af61dbefd), W(0x00008778fd70fe5e),
+     W(0x0004685588748549), W(0x00057c2b2c4c4469)}
+  },
+  {
+    {W(0x00026230456db097), W(0x00056d11faaa4fdc), W(0x000175ea78c5effd),
+     W(0x00078c61d63de79d), W(0x0002dd2088254ea1)},
+    {W(0x0000eb6461b7ff63), W(0x0006aa69b9fd676d), W(0x0007e6bcd68af04a),
+     W(0x00057abd02a3817a), W(0x00011522ad3df238)},
+    {W(0x0000000000000001)},
+    {W(0x0001b3d155477820), W(0x00044c9c44dc2411), W(0x0000f486f03db022),
+     W(0x0005d9224e5de92b), W(0x000798024545a17a)}
+  },
+  {
+    {W(0x0006513d3910f105), W(0x000788f3f3b4fd7c), W(0x00042f398c9a6ae2),
+     W(0x000375fba0f59f6e), W(0x0005f7f6a0166f96)},
+    {W(0x00057fb644773af0), W(0x0006ee8bd19405cd), W(0x0000ea66b05b65e3),
+     W(0x000349767eb418cd), W(0x000686ef2e36daa4)},
+    {W(0x0000000000000001)},
+    {W(0x00044214a77ec68a), W(0x000263bb9100924f), W(0x00017ef09128cf4c),
+     W(0x00001cd4683117f6), W(0x0002360ca0dcd1e1)}
+  },
+  {
+    {W(0x00013965dd1e90ba), W(0x00017948a573cdac), W(0x00051a003751f680),
+     W(0x0002f92c199282ba), W(0x000790236a9db164)},
+    {W(0x0003016ec410f130), W(0x00062ef0b79d4d3f), W(0x0004cef5935d326a),
+     W(0x0005f896a0f21d4a), W(0x00037bfbe46b051d)},
+    {W(0x0000000000000001)},
+    {W(0x0000b32148821a07), W(0x00001652d8ed4903), W(0x00047a2f3e4c5bf1),
+     W(0x000321d100b127a3), W(0x0003491f34de7149)}
+  },
+  {
+    {W(0x00055458f129f8f9), W(0x0005ee25d62dc674), W(0x0000bb28bb01af61),
+     W(0x0004428a0ecd8f01), W(0x0004861dbd59e7f6)},
+    {W(0x0004eb760d20ca37), W(0x000641bcb22cf286), W(0x0006cad2f3c5d901),
+     W(0x0001f93a068d26c6), W(0x0000bb657235d453)},
+    {W(0x0000000000000001)},
+    {W(0x00069846948e8ce5), W(0x00058df9181a8d8c), W(0x0002509bb2b76d64),
+     W(0x0002df99c0ef165d), W(0x00044885cf3f5d06)}
+  },
+  {
+    {W(0x00010ea4e6c90b89), W(0x0006c8bf29173fc6), W(0x0003a631252e67a9),
+     W(0x0002646c11864bbb), W(0x00067c24ce7bbdc4)},
+    {W(0x0004dac4ecd1c8ed), W(0x0007f5813d238fd9), W(0x000063a2bd5280d5),
+     W(0x00045d980cbeb662), W(0x00007bfe60eb6e8b)},
+    {W(0x0000000000000001)},
+    {W(0x00052003ab73a02c), W(0x0001c2a90f05e917), W(0x000314dbcbeb4917),
+     W(0x000213a50b7adac5), W(0x00016ae947776a37)}
+  },
+  {
+    {W(0x000329afc347452a), W(0x0002d2fe697fb88a), W(0x000265890741b637),
+     W(0x000262f0f151e75b), W(0x00000812ba0ffaf3)},
+    {W(0x00024b0a6c1bf47c), W(0x00004d30f25d0420), W(0x00063512f6258632),
+     W(0x0000540ff5e2c79a), W(0x000067092431c272)},
+    {W(0x0000000000000001)},
+    {W(0x000641f6040ed2b2), W(0x00058e9d47425f1b), W(0x0004a13cef3061ed),
+     W(0x0005b6bdeedc3878), W(0x0003cfab7e2db8be)}
+  },
+  {
+    {W(0x0007028e1f5dbcc8), W(0x00050bdf60cf5835), W(0x00017c2299235bb2),
+     W(0x000588fba5139085), W(0x0000a0729d09359c)},
+    {W(0x0001414ac78a0ba9), W(0x0007068d2197bee7), W(0x00062848f91fd81c),
+     W(0x000086c52ede8c25), W(0x0000c9b3a4051975)},
+    {W(0x0000000000000001)},
+    {W(0x00069911cf628f35), W(0x0004ce07643c1bcf), W(0x0004308ae84791d6),
+     W(0x000280757b7d017d), W(0x00012fc1ff8ba22c)}
+  },
+  {
+    {W(0x0006dce328243e37), W(0x000366a96f307127), W(0x00034bf932179dcb),
+     W(0x000373378fb986c3), W(0x00047be4e9ba273c)},
+    {W(0x000083f313d4982f), W(0x0000f3a7225db82a), W(0x0001aa14298a1377),
+     W(0x0006ac7e6d0b620f), W(0x00076f230f2a2f87)},
+    {W(0x0000000000000001)},
+    {W(0x000716ea7f98c808), W(0x0002ac01e5485bbc), W(0x0002f2f29efb8881),
+     W(0x000177fca22f55ab), W(0x00070cc17d9c8a83)}
+  },
+  {
+    {W(0x000451f8a5c1e34f), W(0x0005f237062adddb), W(0x000332d4b0331e93),
+     W(0x00075e9afe4d8fd1), W(0x000492585f007495)},
+    {W(0x0004a09561ade7f9), W(0x0006150c69ff20c7), W(0x00059b167488218f),
+     W(0x00057870bf2b5d78), W(0x0002c4ecaed342e8)},
+    {W(0x0000000000000001)},
+    {W(0x0004bb7415f9a200), W(0x00034e30647e8312), W(0x0000f19ba0ebe464),
+     W(0x000025af64a51729), W(0x00078c1ee9df18e3)}
+  },
+  {
+    {W(0x000367403955f5ca), W(0x000415403bbbeaca), W(0x0004675a4d6c6087),
+     W(0x0004ae4c9a114d4e), W(0x000306f3c22c8e0e)},
+    {W(0x0006c83d3474d222), W(0x0003b0424d836b2b), W(0x00056a8982a9dd7b),
+     W(0x000634b9aed7d59f), W(0x0007fe001e8d2c37)},
+    {W(0x0000000000000001)},
+    {W(0x0004f4803902ec9f), W(0x000341d4bb5244a5), W(0x00024dec9ee51ddf),
+     W(0x000436f26b401b2a), W(0x00074f3c191eb729)}
+  },
+  {
+    {W(0x00011988ab97d743), W(0x00053c632cbd1ab0), W(0x000378d59f1b4e0a),
+     W(0x0003edb8d6d24dd1), W(0x00061a9bec90777f)},
+    {W(0x0000369db4c4bf08), W(0x0004bde254a46be2), W(0x00069c65ffbab7fa),
+     W(0x00009005f3bf7426), W(0x000522f1d36f86d4)},
+    {W(0x0000000000000001)},
+    {W(0x0006a43c986067cd), W(0x0001b7fb73339425), W(0x0002daf744d4d680),
+     W(0x000599116c518e41), W(0x00073057e1641662)}
+  },
+  {
+    {W(0x000359f89d9637d6), W(0x000268309aa5afae), W(0x0001c9fc69ac64b2),
+     W(0x00076eeb97967547), W(0x0007cb093c16a428)},
+    {W(0x0003990c110f9cfb), W(0x00060dca450be216), W(0x00044ebdef86c88e),
+     W(0x0005037360778479), W(0x00036c4b1833da2b)},
+    {W(0x0000000000000001)},
+    {W(0x000755d87855b9b0), W(0x000106d44187ca71), W(0x000146fa379da67f),
+     W(0x000304a5212a441c), W(0x0004cb961a5e2484)}
+  },
+  {
+    {W(0x0001b641ad098d90), W(0x0003a363f90853c1), W(0x00020c5ec030d883),
+     W(0x00022f5d145f008a), W(0x0001c4535943117b)},
+    {W(0x000459bdc8b05ead), W(0x00054615ca98d105), W(0x00050e9d0853173e),
+     W(0x0005653a663f4761), W(0x000322107e5941e1)},
+    {W(0x0000000000000001)},
+    {W(0x0001a65bfe21e8d6), W(0x00000b23eb0385bb), W(0x0006361350769dbf),
+     W(0x0005a97bfee41cf8), W(0x0006f3284b071450)}
+  },
+  {
+    {W(0x00042b2f13d139df), W(0x000203795408dc6d), W(0x0005a008c09a70c8),
+     W(0x00055f3215265ff5), W(0x0004c32605305b76)},
+    {W(0x0002460b2399ecca), W(0x00002b66dd13610e), W(0x000790c30385c989),
+     W(0x00012e79fb24a4d7), W(0x000655d76922c1ee)},
+    {W(0x0000000000000001)},
+    {W(0x0003257a3d5ae038), W(0x00077162a665a383), W(0x00056c09572536a5),
+     W(0x0005ae625bb7485c), W(0x00017a794a0ce7f0)}
+  },
+  {
+    {W(0x0003c54afda21fa2), W(0x000399026b594524), W(0x00029607c69ca0fa),
+     W(0x00061e48f942728a), W(0x0003093f82dfd701)},
+    {W(0x00074c26b8afbb1b), W(0x0002a9180a37e588), W(0x0004bd5beb139e3e),
+     W(0x00065e72a9ebdb54), W(0x0005ed51b0aea1ad)},
+    {W(0x0000000000000001)},
+    {W(0x0000163c81648440), W(0x000366f2ae808b48), W(0x00077d24bce3155a),
+     W(0x0000c9de368443f0), W(0x000120ec0e74398b)}
+  },
+  {
+    {W(0x0006c84221bcc8b2), W(0x000184d384ac6c42), W(0x00077db34115f4bf),
+     W(0x000008f9555f1ce2), W(0x0001c722b1c4816a)},
+    {W(0x0002e6afadc24cbf), W(0x000423bb11d11f06), W(0x0005ea02ebeff590),
+     W(0x00052faf6d5791c6), W(0x0004c61af8fe2463)},
+    {W(0x0000000000000001)},
+    {W(0x0000408e107228cf), W(0x0001d536f9c616c8), W(0x00030607e563210f),
+     W(0x0000648592fa609a), W(0x00040ea8db7de437)}
+  },
+  {
+    {W(0x00039e271278fc7c), W(0x000746776c488eed), W(0x0000723802c502a7),
+     W(0x0006b28703daedf0), W(0x000655201ac61a1e)},
+    {W(0x0006c79b4c5bda5f), W(0x00073378a0d229a3), W(0x0005d745c7627e88),
+     W(0x00026b6e8b555880), W(0x000261245372f29b)},
+    {W(0x0000000000000001)},
+    {W(0x0001ecd899e29463), W(0x0007797199a9efbd), W(0x000135d95ef89cba),
+     W(0x000373d825e464c8), W(0x000474e2c29911e6)}
+  },
+  {
+    {W(0x00064908eeea9138), W(0x0000b15bdd9a749a), W(0x00062ac4f706f903),
+     W(0x000722e024f19dbd), W(0x0005d0f915570e0b)},
+    {W(0x00050f6942a77bc9), W(0x0000e336ae9fb5a1), W(0x00060dffca86f137),
+     W(0x0005a8386788f269), W(0x000128181e95f419)},
+    {W(0x0000000000000001)},
+    {W(0x00070914b11d7850), W(0x000378470798ed21), W(0x00052f54048016d2),
+     W(0x0004db9e349fc6ed), W(0x00054d136716ff19)}
+  },
+  {
+    {W(0x0004140beac7fab2), W(0x0007c4059d8009be), W(0x00069a04b9ff7214),
+     W(0x00044d4ae7443907), W(0x000755f19acf8ed9)},
+    {W(0x0002331eb9d1e303), W(0x00060cbadf2f4435), W(0x000454cce7b0f708),
+     W(0x00002318d4526e5e), W(0x000184aaf6f5deff)},
+    {W(0x0000000000000001)},
+    {W(0x00008775f9b2f26f), W(0x000069bfb587d256), W(0x00057538be763189),
+     W(0x0005bb23acc5964d), W(0x000170af0b488f2c)}
+  },
+  {
+    {W(0x00006acd29a9b4b1), W(0x00035a2b4d31d66e), W(0x000473e0a0dcab58),
+     W(0x000016076a450440), W(0x00074f7eb7a765a8)},
+    {W(0x0003427be6ad0161), W(0x000308cdeace0bac), W(0x0004c59e8ba67b83),
+     W(0x0002f864d300a0f2), W(0x0000b1aa6b1696bf)},
+    {W(0x0000000000000001)},
+    {W(0x00026ff1c32a4ff2), W(0x00030f087d0a7cf6), W(0x00000aae1892e310),
+     W(0x00060563811a0009), W(0x0001a06944bcc758)}
+  },
+  {
+    {W(0x0000498d7f554baa), W(0x0003d61277ad9c5c), W(0x00023f264a89d04e),
+     W(0x0001bce5ad3dcb38), W(0x000449c7dbd87c58)},
+    {W(0x00038463ae92fa9d), W(0x000442a882ca351f), W(0x0000665e45dbd07b),
+     W(0x0006f36fddea11cb), W(0x0006694e04b0efc8)},
+    {W(0x0000000000000001)},
+    {W(0x0004f2d8e2cf5c21), W(0x0003450734585c07), W(0x0003b335a39819c6),
+     W(0x0004dd344db36df5), W(0x0006ed3bb159b610)}
+  },
+  {
+    {W(0x00070af0f7784339), W(0x0003c67fbee0c5cb), W(0x00028f8b3336af34),
+     W(0x00011444b783d667), W(0x000316ac68f402e7)},
+    {W(0x0006700ac7bbc198), W(0x0005d61061d35bda), W(0x0001aa3995e3d38b),
+     W(0x000053613c0fc8a8), W(0x00027fce1db0766d)},
+    {W(0x0000000000000001)},
+    {W(0x0005f932440a5d44), W(0x0005b834c562ec67), W(0x0000bd477464ba95),
+     W(0x0004426c91554df1), W(0x00038276c62fdbfd)}
+  },
+  {
+    {W(0x0002de9046e9b1f9), W(0x0006b3b9241ccc9c), W(0x0007a86f52d1cacf),
+     W(0x0003406334f8b033), W(0x0002842706cf88ca)},
+    {W(0x0002e62aa4fc3d14), W(0x0001266b2ed1d0c0), W(0x0004d55c86b4b721),
+     W(0x00009449be14223c), W(0x0003f7762d3e7d6d)},
+    {W(0x0000000000000001)},
+    {W(0x0003568c5060b874), W(0x0000baa36b98a33f), W(0x00052678aeba4ac1),
+     W(0x0005ffbf742a9074), W(0x000420fbd6919b64)}
+  },
+  {
+    {W(0x0001d36eb470ffc5), W(0x00074cfa5952493b), W(0x0000a696d8706d3f),
+     W(0x0006dda5bb62507f), W(0x000566c15074e6fa)},
+    {W(0x00077c23770de574), W(0x00038716050cbe16), W(0x0005b7a1db9e11bc),
+     W(0x000398c30649fad1), W(0x000283b4af2d6943)},
+    {W(0x0000000000000001)},
+    {W(0x0006a323f2ad53e7), W(0x000528c61ef63204), W(0x00032979dbb7a8c6),
+     W(0x000558f9e8b5760b), W(0x0001fc7368188804)}
+  },
+  {
+    {W(0x00048c1ff600fe64), W(0x0007d3c89ee0a5e6), W(0x0000c4009653a796),
+     W(0x0002e0fc3395e56b), W(0x0006c0034a355ce6)},
+    {W(0x00058e97dc0ede97), W(0x00045442a16210eb), W(0x00048220c30b3b29),
+     W(0x0005c983330eca02), W(0x0002df4fcea0b6b8)},
+    {W(0x0000000000000001)},
+    {W(0x000152db899c4a4e), W(0x0004b3a54f75c118), W(0x000118874d57511e),
+     W(0x0004615e49f342ba), W(0x00076fd429573875)}
+  },
+  {
+    {W(0x0000c61733c60a83), W(0x0004eaf2cbe24eaa), W(0x0002787949fb6110),
+     W(0x00073747f0bfa96a), W(0x0002af55421972b2)},
+    {W(0x00040e1430e5e156), W(0x0000ff52dc0fdf66), W(0x00028562f25f344c),
+     W(0x000175af9c5b7232), W(0x0006a8ba90f2d70d)},
+    {W(0x0000000000000001)},
+    {W(0x0007f25f32fd4ce8), W(0x0000c432b7bfc30a), W(0x00024dafad92b10e),
+     W(0x00018f7efef5221f), W(0x00013783f033938a)}
+  },
+  {
+    {W(0x0003b92bf5d14e66), W(0x00021c0f26fa2375), W(0x0001e8d26f925884),
+     W(0x00043b4ca8bd32f8), W(0x000301543d10e593)},
+    {W(0x0001421e1fe6e51d), W(0x0002860b6adedf06), W(0x0005835fb197347d),
+     W(0x00012520ddb8a197), W(0x00039c4acd5e52eb)},
+    {W(0x0000000000000001)},
+    {W(0x0002aaa8555b680f), W(0x0007cbaf7cf4654d), W(0x00027f80d19b1f71),
+     W(0x00070efa9f2327a6), W(0x000305c41b8eddc2)}
+  },
+  {
+    {W(0x00040f586ef89977), W(0x0001e012318dbf8b), W(0x00043573e042ef56),
+     W(0x0007263bd188bc8a), W(0x000711977a5abe25)},
+    {W(0x0007aee6d589a0e1), W(0x0004199d2790e3d9), W(0x0003d0f7954502d9),
+     W(0x00007e14e0749bb4), W(0x000771003dd33c9d)},
+    {W(0x0000000000000001)},
+    {W(0x00038eda7234991e), W(0x0000d19c431c22de), W(0x00026c85ea346bd8),
+     W(0x00015d341980f474), W(0x0003a66193699c1d)}
+  },
+  {
+    {W(0x0003339d566e3395), W(0x000583015922bf66), W(0x0006eca67dbf2985),
+     W(0x000442b29f427143), W(0x0005a5e2befd064d)},
+    {W(0x0005c3d2f8559e0e), W(0x00058a8306e13ac1), W(0x000039283fc8731d),
+     W(0x00042f1ab43ef7a6), W(0x00026af5cf608860)},
+    {W(0x0000000000000001)},
+    {W(0x00050c8765ade870), W(0x0005c9982c28b281), W(0x0006790fd6aae429),
+     W(0x0001425093733200), W(0x0004cba33be5a52b)}
+  },
+  {
+    {W(0x0007aa1098703709), W(0x0004246d8ba6616e), W(0x00016bb0f34c901c),
+     W(0x0004cd968008119f), W(0x0005db92baac5c3f)},
+    {W(0x0006c0c3d602313a), W(0x0001cbdd97cd764c), W(0x00049a1ae029a0b5),
+     W(0x0002645c09e5e147), W(0x000004f535fdde69)},
+    {W(0x0000000000000001)},
+    {W(0x00013ab18317d5a1), W(0x0000a3bac0a65d89), W(0x0001486f7ccf1d29),
+     W(0x00029335a5b5c7da), W(0x000056a7e8bbafc7)}
+  },
+  {
+    {W(0x0003292c63fd15b3), W(0x0003ba2e5212b245), W(0x00070020ab6bd00b),
+     W(0x0006e0fd8296ba08), W(0x0006d7fe8146ca69)},
+    {W(0x0003379daf73e21d), W(0x000035b38b99bb89), W(0x000311b1424ef5a9),
+     W(0x000383070a6084d7), W(0x0001f7759878ade8)},
+    {W(0x0000000000000001)},
+    {W(0x0007e536dfd8eb77), W(0x00005376ec21b438), W(0x00042dd86915d5ff),
+     W(0x00002f6533cab4b7), W(0x000634cb32629d32)}
+  },
+  {
+    {W(0x00026e5002cf649c), W(0x0001622cd5458b47), W(0x0004c59c5e383929),
+     W(0x000045631b3bf069), W(0x0000108fd1f56bc1)},
+    {W(0x0002bc0c3a1b9b16), W(0x0001e049216a13fb), W(0x000589366f59a67b),
+     W(0x0005e3cc7345cfd2), W(0x0004aa9e9a062fa3)},
+    {W(0x0000000000000001)},
+    {W(0x0006ec92d7b55334), W(0x0004e2dd9efa3364), W(0x0007e1f550ea363a),
+     W(0x0004fd6621fc9d07), W(0x0002e6397fb3064d)}
+  },
+  {
+    {W(0x00070fb37f57eadd), W(0x000234f542a94313), W(0x0004dc6341565d0e),
+     W(0x00058766f066df5b), W(0x0005665c6757871e)},
+    {W(0x00035b822d642fbc), W(0x000284edf9581010), W(0x00021ce5df0a188e),
+     W(0x00042d015492c697), W(0x00011c79dc64217f)},
+    {W(0x0000000000000001)},
+    {W(0x0000642c7aa32859), W(0x0001450955771ba2), W(0x0007697d9d38ce2c),
+     W(0x0002889fd0d3a13d), W(0x00056f5f00e0349d)}
+  },
+  {
+    {W(0x0001484ecc2fc91b), W(0x00056116d7249f73), W(0x0001950750dfcbba),
+     W(0x00069fb5646b9514), W(0x0002d37e6c75d665)},
+    {W(0x000499c9ce3c053c), W(0x0001f0e5a2c2c8a7), W(0x0006cb446986d4fb),
+     W(0x0002d0508f4782f6), W(0x0005191c4bdb0e22)},
+    {W(0x0000000000000001)},
+    {W(0x0003dad0ade7a72c), W(0x0007729bde0879f7), W(0x0004f7acbb69b942),
+     W(0x0003a6e94f5e01af), W(0x0002012fe79c3393)}
+  },
+  {
+    {W(0x00031fd6fc07c9b8), W(0x000649e7095547a3), W(0x0003727577c97d5f),
+     W(0x0006a3c98f989960), W(0x00073ab02650e057)},
+    {W(0x000599965a50d23d), W(0x0007494e7fe3fbcb), W(0x0000e73fee03ead1),
+     W(0x00030562167251f6), W(0x00050dc6a7b30990)},
+    {W(0x0000000000000001)},
+    {W(0x0003b97eef70fded), W(0x0005b345784aefa6), W(0x0007c0a1ef3b73f2),
+     W(0x0002955b7372769e), W(0x0006e2f8d8d76073)}
+  },
+  {
+    {W(0x0000d5ebf1153625), W(0x0001afef1a683370), W(0x00052f658389d5d8),
+     W(0x0000a1d1c377ab0c), W(0x000661b010d99952)},
+    {W(0x000059cbc5b18a67), W(0x0006b44ed2785daa), W(0x0004daea14638f01),
+     W(0x00027ad24e79bc9a), W(0x0007755d3fec4bf2)},
+    {W(0x0000000000000001)},
+    {W(0x0004af858bffe943), W(0x0005b594e13b2ed4), W(0x000267462983f9f6),
+     W(0x000333430332bef7), W(0x0007a7e74ee9e05f)}
+  },
+  {
+    {W(0x0002290ff477629b), W(0x000243fd3a787a8d), W(0x0000c0632c6f4a35),
+     W(0x0003a3fde1240002), W(0x000320af4b74247c)},
+    {W(0x00055f2da89e8d8a), W(0x000020b7dd3c957a), W(0x0007d113a028420c),
+     W(0x000341126cd8daf2), W(0x0006ac113d0e3179)},
+    {W(0x0000000000000001)},
+    {W(0x00035be04cef82ef), W(0x00040e02c8ee725e), W(0x0007dc29eb98ecc2),
+     W(0x00004a963b26ae0f), W(0x0002d5bdd285bc70)}
+  },
+  {
+    {W(0x00000ee3be061d23), W(0x000190309a5b4a6b), W(0x0002a63da59e1bf7),
+     W(0x0006bebab49c6c4e), W(0x00045de289c05317)},
+    {W(0x0002647f85966d1e), W(0x0005f62da3619053), W(0x00060c2f6d20506b),
+     W(0x00060eb084bd4d10), W(0x000499888d365362)},
+    {W(0x0000000000000001)},
+    {W(0x0000251e529f8364), W(0x0001375738a0032a), W(0x0003c8458721ac5e),
+     W(0x0004ffb20a9e7900), W(0x0004a4704e4e4163)}
+  },
+  {
+    {W(0x0003924507bb69ac), W(0x00079c0aab5b973c), W(0x0007fffb3615fc77),
+     W(0x00022908039c2e81), W(0x00030c34964dec0d)},
+    {W(0x00027d386d94f4ef), W(0x00058fbf0f5a7cff), W(0x0003e9472b3e140c),
+     W(0x00055957c576d087), W(0x00017d6de81e3932)},
+    {W(0x0000000000000001)},
+    {W(0x00034484c05c8763), W(0x00046c5e8d4f9567), W(0x0004905fb3f26967),
+     W(0x00050b2a985623a0), W(0x0000b77f46a7214e)}
+  },
+  {
+    {W(0x0003282c9db1a65e), W(0x0007e60010439929), W(0x00063ffbd6695b81),
+     W(0x00044fb5a8f7d2be), W(0x0001c42b154f115f)},
+    {W(0x0005352b2acbcfae), W(0x0003dfb08e09a056), W(0x00029b8e7fb6e71d),
+     W(0x000523b970680a19), W(0x00022197fca7efdb)},
+    {W(0x0000000000000001)},
+    {W(0x000464d2b06f653b), W(0x0007417486d25067), W(0x000069e9f39a4bd2),
+     W(0x00036d920a229608), W(0x00041d33540d4041)}
+  },
+  {
+    {W(0x00007eb594b00b11), W(0x000172736eea9a1a), W(0x000311cf712cb971),
+     W(0x0007688ad2b52f52), W(0x0004dd3a4a7c1e67)},
+    {W(0x0000170da493e56a), W(0x00012c9f05222d5c), W(0x00039a3b97a6c897),
+     W(0x000634e75e50995d), W(0x000699b643a54c18)},
+    {W(0x0000000000000001)},
+    {W(0x0003787d95410202), W(0x0004dc7be68a413a), W(0x00007ae6ee848de7),
+     W(0x0000b64ff0766642), W(0x00061b0aa9cabada)}
+  },
+  {
+    {W(0x00062742c9d0718a), W(0x0006600b67c2dfb7), W(0x000389a6d9b494cf),
+     W(0x000334f4119b072a), W(0x00017d0f1daedbc3)},
+    {W(0x00069d72da5d36fd), W(0x0001df4fcf8666af), W(0x0004937409583bf4),
+     W(0x0007b4d907a51a2b), W(0x0007101c1072bab5)},
+    {W(0x0000000000000001)},
+    {W(0x0000b08a5746fa59), W(0x000397b1ac3ccbad), W(0x000684101104a907),
+     W(0x00003721d55dbf6d), W(0x0005e9c0e5b33c29)}
+  },
+  {
+    {W(0x00078051a365cc88), W(0x0007fd2e28356113), W(0x0006b9a2a43eec82),
+     W(0x0004dc0ee459aaa3), W(0x000524bd1774592c)},
+    {W(0x00001d63b517cf1b), W(0x0003590057ed4eec), W(0x00025acf075f944c),
+     W(0x000580cd02a0e713), W(0x00063ea1cbe3fe98)},
+    {W(0x0000000000000001)},
+    {W(0x000732d04cdc64f8), W(0x0004f79b98e055d3), W(0x0001c7a4a1be2514),
+     W(0x00006ae6fec9bfcf), W(0x00039462fe55b38d)}
+  },
+  {
+    {W(0x000525facf992d8c), W(0x0007131c580f04a3), W(0x00065400486dd99a),
+     W(0x000737143aad1e65), W(0x00043642f23c06c8)},
+    {W(0x0007f009ba74efb3), W(0x00074e085661eeca), W(0x00056b7a897aa8e2),
+     W(0x0000b3de06899eae), W(0x00026b867c4db2b0)},
+    {W(0x0000000000000001)},
+    {W(0x00020e13c7ebc706), W(0x00064ef44c2e7766), W(0x0002dc633bee83f5),
+     W(0x00070fe3c4c8e810), W(0x00047de2611fa3a8)}
+  },
+  {
+    {W(0x0004fd0b89aba809), W(0x00048a4447ee4e60), W(0x0000c18f2b331b42),
+     W(0x00010987ec7ce262), W(0x000049eb071373bd)},
+    {W(0x00058bca15c73593), W(0x00024c98fe770274), W(0x0005dfc6d0e9501b),
+     W(0x0007b6db9c4e3b05), W(0x000637b25c95d8c4)},
+    {W(0x0000000000000001)},
+    {W(0x0003bb97d6aa2e59), W(0x00032b1196278c8d), W(0x0006ff212ecef6a5),
+     W(0x000039df8775e441), W(0x0000b7cf6f093a9d)}
+  },
+  {
+    {W(0x0007caf840a5e2d8), W(0x00022ee4744d35df), W(0x0005aaecb997f2c6),
+     W(0x000174c3c18972b8), W(0x0001792a49dda29b)},
+    {W(0x0004584f719be6e0), W(0x0006561d6b69313a), W(0x0001ed7966b2d36b),
+     W(0x0002fc0d7441438d), W(0x0004b39ea3277d31)},
+    {W(0x0000000000000001)},
+    {W(0x0006ff5c321c9dd0), W(0x00042253542f9aae), W(0x00047b1186b30f2a),
+     W(0x0006974b614dc46b), W(0x0002e87d0b9c671a)}
+  },
+  {
+    {W(0x00063bb4d0a2c8f8), W(0x0004aab3ba4f3d8a), W(0x00040160acf4415a),
+     W(0x0005b27e1f3a5322), W(0x00073fa27f1f8324)},
+    {W(0x00004deb4aefbd70), W(0x00019175478c3511), W(0x0006f4e08fff49b6),
+     W(0x0001a8c2e70660e8), W(0x0000a938b5b9a098)},
+    {W(0x0000000000000001)},
+    {W(0x0006ce22ca86a34f), W(0x0006f3a594c8c12a), W(0x0007bddb504fb0a3),
+     W(0x000482d0653aa4a3), W(0x0005693af7e2ef3a)}
+  },
+  {
+    {W(0x00024f33d57214f0), W(0x0005bc4bcbadb0a8), W(0x0004228c1dcd25ae),
+     W(0x00011754c8c2cbdd), W(0x0003d08ee30d5a5e)},
+    {W(0x0006e3ef798f5a65), W(0x00033fbb027361ba), W(0x0006360515293812),
+     W(0x0007dbadefaf444c), W(0x00058ec8d7f962ee)},
+    {W(0x0000000000000001)},
+    {W(0x000307d2643fc344), W(0x0007bd3273172fd3), W(0x0003703e11ffe4f0),
+     W(0x00037c94b64cb62f), W(0x00032d2c14e05284)}
+  },
+  {
+    {W(0x000558e61db020c1), W(0x0000ac7a6eb2557d), W(0x0001105d6456b10e),
+     W(0x00047c862b2b84ae), W(0x000094e25ed0b0dd)},
+    {W(0x000084c1141d6945), W(0x00020cbda7c8432e), W(0x0006ae3db7568bd3),
+     W(0x0001ad2ce8aebe83), W(0x00041c15bf887b66)},
+    {W(0x0000000000000001)},
+    {W(0x00039691d492447f), W(0x00072b46691f4d1f), W(0x0002a30064ef44d4),
+     W(0x0004d77e84f6a4ff), W(0x0002a3f74f819b53)}
+  },
+  {
+    {W(0x0006f58b6354f35d), W(0x0004df8784b33c26), W(0x000397d2301b6aa7),
+     W(0x00056ea31ff9b49a), W(0x0005b20e1eb8c9e3)},
+    {W(0x000365c443782211), W(0x0002eee589c68b97), W(0x0002178afb4dd8f6),
+     W(0x0007544568f5d82e), W(0x000194c2fb23dadc)},
+    {W(0x0000000000000001)},
+    {W(0x00022b8fa2a6544f), W(0x00050193993aaaf5), W(0x0002839426c15320),
+     W(0x000499bc00e03b48), W(0x000607c9491acaaf)}
+  },
+  {
+    {W(0x00075c0e033e4a7b), W(0x000765aa07153804), W(0x0007764c773e7840),
+     W(0x00037709b965ae9e), W(0x0000ff412ab699e8)},
+    {W(0x0003d0295b99f1e4), W(0x000741cac0673df8), W(0x000131d5cd666223),
+     W(0x0003e2348b905a88), W(0x0002418b064d282b)},
+    {W(0x0000000000000001)},
+    {W(0x00037538c8ba9fd1), W(0x0004b4f707ce1621), W(0x00055ae696de044a),
+     W(0x000538654ba8c057), W(0x000457ca0b2e9093)}
+  },
+  {
+    {W(0x00001879c728e1cf), W(0x00077f33c1e97713), W(0x00068e627ef9fb5f),
+     W(0x0002f8a4d9f39388), W(0x00038fc7d6f68ee1)},
+    {W(0x00043c8f2da30e8c), W(0x00063e60c59baa90), W(0x0004e02c956fc810),
+     W(0x0000b3be544dca7c), W(0x0001edbd77ef4359)},
+    {W(0x0000000000000001)},
+    {W(0x0004b40a3a2dd695), W(0x00066ee395138b68), W(0x00070ed7784fc693),
+     W(0x0004efadbca6f384), W(0x0004569ebff8b596)}
+  },
+  {
+    {W(0x000629c9907908a3), W(0x000391e86cde0165), W(0x0002fdb8bc564221),
+     W(0x0004958fe86b0c90), W(0x0001b6f1f45415b2)},
+    {W(0x0001f3c69e8b3852), W(0x00047400334f2c65), W(0x0002a26b522e7e01),
+     W(0x00028d389959555c), W(0x0004dd5b6fec8f09)},
+    {W(0x0000000000000001)},
+    {W(0x00068f7fb27dd12e), W(0x00062c19d9cac6cc), W(0x00020dc528780b03),
+     W(0x00072228839255d3), W(0x000218df2590f224)}
+  },
+  {
+    {W(0x0002a8ce9d2ca8c5), W(0x00048404a92f7226), W(0x0001a7c058bbe057),
+     W(0x00055a615fd87167), W(0x0002867d04bf6982)},
+    {W(0x000649d1e4ae5bfc), W(0x000188f0153a0f2c), W(0x00042f5e938bf447),
+     W(0x0007dbb2b2ebdeeb), W(0x00009818f7f87817)},
+    {W(0x0000000000000001)},
+    {W(0x00032551fd37a11e), W(0x000195d49d26e857), W(0x000331c64fc5dd89),
+     W(0x00051fe540a4d51d), W(0x00065f4194da07e3)}
+  },
+  {
+    {W(0x0002892fb128a9ae), W(0x00072981b723668c), W(0x0006a9a754fc54e1),
+     W(0x000543560950d632), W(0x00071e258c0122dc)},
+    {W(0x0002bf394d3b01df), W(0x00065b62cdb15bec), W(0x0002eab8649623db),
+     W(0x0006c67e001d22eb), W(0x0003759048bb3982)},
+    {W(0x0000000000000001)},
+    {W(0x00054e3ba8ab0ed4), W(0x00016f4c6d8fb324), W(0x0003008d357df1ae),
+     W(0x00039fad5dc23ada), W(0x0005d46a7dc4b98f)}
+  },
+  {
+    {W(0x0005c834b0e2eb6e), W(0x000345344210eeed), W(0x0002c8fef80d94b0),
+     W(0x00050fd4559899a5), W(0x0004e9ca8faaf069)},
+    {W(0x000773e5e81d1e8b), W(0x00054793641a3582), W(0x000021542c7ec832),
+     W(0x0006035acaf39178), W(0x00034e21a72a1276)},
+    {W(0x0000000000000001)},
+    {W(0x0002914e04036e14), W(0x0003d3c0aefff211), W(0x000432a70b5649d3),
+     W(0x000112c952ecfd93), W(0x0003095373f7e3a0)}
+  },
+  {
+    {W(0x00077c15f8f05f09), W(0x00076ef9974dd533), W(0x00079622ee2112e8),
+     W(0x0003799c093d8603), W(0x0003c6485f41f65f)},
+    {W(0x00035a4382ee9d62), W(0x0002142b9dcc34d6), W(0x0002fe534dcf024b),
+     W(0x00065fa69132f93a), W(0x00078bb2beae9683)},
+    {W(0x0000000000000001)},
+    {W(0x0001ca69ca716fb4), W(0x00053ad4dfb5e15c), W(0x0002cd6f7383272c),
+     W(0x00065cd7352d5e5e), W(0x0002f61545c2eae1)}
+  },
+  {
+    {W(0x0007f668b3c95f53), W(0x000242ebed545022), W(0x00022dd716961518),
+     W(0x0006e144080c9b95), W(0x00013e3082b9df11)},
+    {W(0x0005d9fd8e799c63), W(0x000669acbd33a1f4), W(0x0000987b7b34a092),
+     W(0x0005bda2eeb18661), W(0x00038563ef958258)},
+    {W(0x0000000000000001)},
+    {W(0x000139c11c9ea5e5), W(0x0002688f22d52369), W(0x000203c6226cdea0),
+     W(0x00063da12114a04f), W(0x0000c1cb005768e3)}
+  },
+  {
+    {W(0x0002ff46bb03eb5f), W(0x0007bfb5960fdb98), W(0x0006a9de8c4c6188),
+     W(0x000708930b09cda0), W(0x0003d308d1aeb5f9)},
+    {W(0x0000f65a1d5d3656), W(0x0001b09c6b546c35), W(0x00006ca00375e1d8),
+     W(0x000206558aeea4ae), W(0x000085820df16253)},
+    {W(0x0000000000000001)},
+    {W(0x000037a6a96319df), W(0x0007394e12598616), W(0x000331a4f4422a30),
+     W(0x0002473533b65520), W(0x0004603afb6075ef)}
+  },
+  {
+    {W(0x0002523c5a93bcba), W(0x0002f4d5762abbbc), W(0x00057ba65d59a30c),
+     W(0x0003b436d1085e79), W(0x000049b7b0fa8c79)},
+    {W(0x0004433254ad540c), W(0x00079acccd9ab7ad), W(0x00042ab066796c5a),
+     W(0x00042fd634f37239), W(0x0004b847153346c5)},
+    {W(0x0000000000000001)},
+    {W(0x0005763702881912), W(0x00032151f7d68884), W(0x000768c0f9ff7693),
+     W(0x0001a5bb6b961580), W(0x0001b4827b577991)}
+  },
+  {
+    {W(0x0002a9d3eb5ba182), W(0x0004ae05b79d7832), W(0x0006efab51e51255),
+     W(0x000544cfc4d3aa11), W(0x0004360561cc624e)},
+    {W(0x00055b8a53844090), W(0x0003be42d05dcce6), W(0x0005465395f06798),
+     W(0x00025e1336245bd9), W(0x0005e25c9e882a5c)},
+    {W(0x0000000000000001)},
+    {W(0x00056fd75e2045ae), W(0x0002ca233972b12f), W(0x0006e5225898d814),
+     W(0x00077c1764cc7c6c), W(0x00008cc65fcc4a14)}
+  },
+  {
+    {W(0x00014907a83d0eaa), W(0x000427bb9bdc73cd), W(0x000068c4170d6fa6),
+     W(0x0000416b9595a332), W(0x0001dd187a2fbaac)},
+    {W(0x000289af867acdbe), W(0x00051563fa3ffe76), W(0x000735d02e0b7a5f),
+     W(0x000750a3f0632b14), W(0x0007de1ad90d0354)},
+    {W(0x0000000000000001)},
+    {W(0x000798e630e0921d), W(0x0002e3b0c74828ed), W(0x000085235242f3b3),
+     W(0x0003858521244c53), W(0x000023009ec2be91)}
+  },
+  {
+    {W(0x0001ba3a433995cb), W(0x0005e4cc1e52bbfb), W(0x0005433a8e91b17b),
+     W(0x0000fb223c2b5101), W(0x0006b87995765f26)},
+    {W(0x0002b43bd56fd834), W(0x0000d60306271feb), W(0x0003ad946fef73f6),
+     W(0x00053bdf5b451c3e), W(0x00030fc18a407376)},
+    {W(0x0000000000000001)},
+    {W(0x00074e5265a75387), W(0x000149f66181349d), W(0x0002de5d7ffc8fd7),
+     W(0x00075ceb8f90b4d3), W(0x0000bdf84d15697a)}
+  },
+  {
+    {W(0x000600f9e28f202d), W(0x0000f7904340b187), W(0x00028450c1f786ab),
+     W(0x0002dae6f60545c9), W(0x00008cf45ffd5aae)},
+    {W(0x0006f6eb10620456), W(0x0007b09ee5e8cbc9), W(0x0003a300b1200eb9),
+     W(0x00061eea6b4a4fa9), W(0x0007e43e47e80b82)},
+    {W(0x0000000000000001)},
+    {W(0x000318f79ed1d7aa), W(0x0000ac99a4b4aa8f), W(0x0003f766c03e326d),
+     W(0x0001bb2808d1e089), W(0x0000571538de4bc5)}
+  },
+  {
+    {W(0x0006881eb5c4a16c), W(0x00018d587c74aa92), W(0x00046256573d5a12),
+     W(0x00025cb7468ef546), W(0x00020b2e3debc55c)},
+    {W(0x0004f1ee19ab3a2e), W(0x00026a73f3dcfecd), W(0x00052678dc57ca26),
+     W(0x0007a5e0a8a2674c), W(0x00072ebc914e09ea)},
+    {W(0x0000000000000001)},
+    {W(0x0005a145fa5c7345), W(0x0003a6ee0c88fb7d), W(0x0005e9e07ae1b52e),
+     W(0x0003e85b25365a48), W(0x0001df9ef47be063)}
+  },
+  {
+    {W(0x0003aedc56ac8bbb), W(0x00066f8d16f5c06f), W(0x00007c459808d3a6),
+     W(0x0000ae031405bfb1), W(0x0001c3fce5adfea8)},
+    {W(0x0001fc0710fea999), W(0x0006ddef66841650), W(0x000186fb8ce5f87c),
+     W(0x0004d4f7461c4f20), W(0x0007ed6c1b495da0)},
+    {W(0x0000000000000001)},
+    {W(0x00035df2e209c2c4), W(0x000705a835b1d42e), W(0x0007e806037256f6),
+     W(0x0003b4d0de6171ab), W(0x00076da30ce7752a)}
+  },
+  {
+    {W(0x00009f4467d245b4), W(0x0007f76cab8e9fab), W(0x00068a6484a7fd38),
+     W(0x0007d3f65398a34b), W(0x0003c537e03e0b38)},
+    {W(0x0007f3c6981f42ce), W(0x00038830b1cda6c7), W(0x000372df4f7b7f81),
+     W(0x0001b1fcdf16717b), W(0x00007821bdcabb26)},
+    {W(0x0000000000000001)},
+    {W(0x0002b46eca673e46), W(0x000521846bf6257d), W(0x0004bb6f74348b1c),
+     W(0x000523632c6ed11a), W(0x0001dc5562992ec0)}
+  },
+  {
+    {W(0x0000673812cd442f), W(0x0002336fd278ddb2), W(0x0001c8032efba43a),
+     W(0x00017a7d5888f76a), W(0x0001d8dc509f044c)},
+    {W(0x00059db06db0069f), W(0x0006bb1ae8ccea20), W(0x0001d02811884aca),
+     W(0x00007fa3f5a63acf), W(0x00006b7d5b45aa65)},
+    {W(0x0000000000000001)},
+    {W(0x0006324111dbde74), W(0x0005aed90b570b11), W(0x0006a0a90f8e8a5d),
+     W(0x0002c8b3ccf626b3), W(0x00053dbf5294f735)}
+  },
+  {
+    {W(0x000052da196ac851), W(0x0006a23dc93e11c3), W(0x00064bbfabded3ea),
+     W(0x0002b1035dab1ddb), W(0x0005889b5f5c244c)},
+    {W(0x00033dd9d79a7b54), W(0x00054ff30459f53e), W(0x00031ea02839402e),
+     W(0x0001971d057694e3), W(0x00050c342f5d9080)},
+    {W(0x0000000000000001)},
+    {W(0x0005b067d2bc1103), W(0x00077dd6f59a383e), W(0x0001ec90366f29c1),
+     W(0x0002768248b5538a), W(0x00051d1bb84a91b1)}
+  },
+  {
+    {W(0x0007f3d8f4670588), W(0x0005b5b157ea7014), W(0x00010f164526fe47),
+     W(0x000081014239ed4c), W(0x0006f02dbec58176)},
+    {W(0x0000df784808a3e4), W(0x0000a44d0dd65626), W(0x0004a1ba159f8876),
+     W(0x0000450070904626), W(0x00051bab0781b689)},
+    {W(0x0000000000000001)},
+    {W(0x000045464fbabc8a), W(0x000405b7b9281f78), W(0x00043b4137fe5bbe),
+     W(0x0000e181a6764b7d), W(0x0007cc4eed995a76)}
+  },
+  {
+    {W(0x0006e5801d6987a3), W(0x0006fe574338acd0), W(0x00000f31757ab418),
+     W(0x0005a5b4380ae301), W(0x00027489b197275e)},
+    {W(0x0002564fe1c9061a), W(0x0006c8852937c598), W(0x0004c9692b1fc7bf),
+     W(0x00015e8f7d7057df), W(0x0006548fa83a9727)},
+    {W(0x0000000000000001)},
+    {W(0x00012ab383c1da55), W(0x0003a91cb847d99b), W(0x0003079a5add93dd),
+     W(0x0004a7850aced62f), W(0x0002da73ffbe556e)}
+  },
+  {
+    {W(0x000101eb4e79d6a0), W(0x0002f81ace4887a9), W(0x0002504aefa5ffd5),
+     W(0x00009c9a02c4c35a), W(0x00078d17a27f29cf)},
+    {W(0x0006542fe9000c9d), W(0x0000dbf59af10c26), W(0x0000d22afde188c4),
+     W(0x000775ac14b094a1), W(0x0003e9bf7a19fa84)},
+    {W(0x0000000000000001)},
+    {W(0x0006206f4ef15600), W(0x0007d52939328e67), W(0x000739c14d843b07),
+     W(0x000090e3fb068d04), W(0x0002d85daf792911)}
+  },
+  {
+    {W(0x000279841e29227e), W(0x0007041c70c0b9e0), W(0x0007b81f19ea13e8),
+     W(0x000595ac5b1466d0), W(0x0007a150457358f4)},
+    {W(0x000676e9441da914), W(0x00028c9d1ec3988e), W(0x000026100cf6db00),
+     W(0x0002a386b2886432), W(0x00027474c3c42aef)},
+    {W(0x0000000000000001)},
+    {W(0x0001cb94a2831f69), W(0x00009b89079814a8), W(0x0007379e417ee784),
+     W(0x0001135135eff7ac), W(0x000508d0beef17d9)}
+  },
+  {
+    {W(0x0007dc83aa5e9fa9), W(0x00076f8cdd61487c), W(0x0002b534c2bb13a8),
+     W(0x0006873fc949acda), W(0x0000b146d3645dc0)},
+    {W(0x0000f63d0457b1da), W(0x00071c69eb6f63aa), W(0x000272f77548dffe),
+     W(0x0001c989100b61a5), W(0x0004266afa48e348)},
+    {W(0x0000000000000001)},
+    {W(0x00017c5d86cad28e), W(0x0007dca29691ec6e), W(0x00063b0b907a8f88),
+     W(0x0006a0f8b593e693), W(0x000374d379e41609)}
+  },
+  {
+    {W(0x00038434db88db8d), W(0x0001b51d8abf2454), W(0x0002d25f6df1687a),
+     W(0x00002b2ce07a070b), W(0x000513f27e077e32)},
+    {W(0x0000a52b426d828d), W(0x0002fa346ebff250), W(0x000143b45a46dba3),
+     W(0x0005a5aafd9cf633), W(0x0000bee14d1d5110)},
+    {W(0x0000000000000001)},
+    {W(0x0001907333a8eadb), W(0x0000bc0f5bd1fadc), W(0x0003846faaed2645),
+     W(0x0001df608f548f28), W(0x0002ae0b4ca6ce43)}
+  },
+  {
+    {W(0x00054aa1f8d5bd1c), W(0x0007a1c576d929a0), W(0x0001d6178a0153da),
+     W(0x0004947421778ef4), W(0x000100684d193710)},
+    {W(0x0001ac8199ac7eea), W(0x0003e57014de6a6d), W(0x00062c35a0cf4dda),
+     W(0x0000958bf347a23e), W(0x0000f8277c8d5687)},
+    {W(0x0000000000000001)},
+    {W(0x000720882292b396), W(0x000474454b48a095), W(0x000310548b303d97),
+     W(0x000062159060bf69), W(0x0003dc7f79bd7e34)}
+  },
+  {
+    {W(0x000677a90400045f), W(0x00050d192beaa9d6), W(0x00054418466670de),
+     W(0x000318f12de477c0), W(0x00056032bd4fa2e7)},
+    {W(0x0003d78ac1ead909), W(0x0001fbe23afc9f0f), W(0x000733b857707f2a),
+     W(0x0001d5763d6048c4), W(0x0001d29ecc5dbcc6)},
+    {W(0x0000000000000001)},
+    {W(0x000559ec77cb7ad4), W(0x000132977a860960), W(0x0005b90b2f17b975),
+     W(0x0006562c1ec6b8d0), W(0x00015207635e81c3)}
+  },
+  {
+    {W(0x00022ce46240add4), W(0x000550680ba1466d), W(0x0006e41224b324b7),
+     W(0x00076ff98159c820), W(0x0000fc2eac415078)},
+    {W(0x0004232162d1871d), W(0x000543adeb45571d), W(0x00017103efbac605),
+     W(0x000619dbf61773ba), W(0x00054d6d818a2501)},
+    {W(0x0000000000000001)},
+    {W(0x0003c22720f316ab), W(0x0005d3859d9177a2), W(0x0006022fc57ba3ac),
+     W(0x0001af2e552a53db), W(0x000390f80ba4e9eb)}
+  },
+  {
+    {W(0x0002b3f7b01f7970), W(0x00036c44a3d53cda), W(0x0005c62fb2b13770),
+     W(0x0006d941707caef3), W(0x00014da2d8f54744)},
+    {W(0x0003116ae3c9da8c), W(0x0006a0be1f1267d3), W(0x00005cea189fdf0f),
+     W(0x00064191bd27dfe5), W(0x00026124530dae4c)},
+    {W(0x0000000000000001)},
+    {W(0x0000b573c9ec2519), W(0x00006497054d4b69), W(0x0002c0cfe1ee38b1),
+     W(0x000102080f469868), W(0x000622ac231116ce)}
+  },
+  {
+    {W(0x000194d37f21f6cb), W(0x0000b9b7bbf92f64), W(0x00043d331769fb79),
+     W(0x000690fc88bfd3d5), W(0x00040d7ea03f00a4)},
+    {W(0x0005ee4da712bf3d), W(0x0007a054b32c287b), W(0x00050c0762b91b74),
+     W(0x0007b10fd42111b3), W(0x0003c6ba1ea36487)},
+    {W(0x0000000000000001)},
+    {W(0x00066772c1de076e), W(0x000098890f0173b2), W(0x000366358ef5f5f5),
+     W(0x0004d14cd96ff802), W(0x000767d341742707)}
+  },
+  {
+    {W(0x0006dee533a999e0), W(0x00055c06ee602a14), W(0x0007fa669c358829),
+     W(0x0007290ed2fc4d86), W(0x00045426db65421f)},
+    {W(0x0000cd2ec99853bd), W(0x0002c272d4249112), W(0x000629bfc6765560),
+     W(0x00039cf5e36a89e1), W(0x0002a5a0a1b9edbe)},
+    {W(0x0000000000000001)},
+    {W(0x0006786e3cb253e1), W(0x00019b0736d3c309), W(0x000589ca28a9161f),
+     W(0x0004a87a40c5f17b), W(0x0002cb7ba2928bcd)}
+  },
+  {
+    {W(0x0006c38e3f56f07d), W(0x0005435b44797455), W(0x0003f4c5a2aabb9a),
+     W(0x0005b39644ab6479), W(0x00068f1cc3bf852e)},
+    {W(0x00026068b71cb4d1), W(0x0000df68eee78b5d), W(0x00069a0ee7140a35),
+     W(0x00003d7a1a288e9a), W(0x0006f65c5f1a6e40)},
+    {W(0x0000000000000001)},
+    {W(0x000543d43678dc9c), W(0x0006452f2f7e2e2b), W(0x0002007348c1b149),
+     W(0x000380c56c010649), W(0x0006675803fbb486)}
+  },
+  {
+    {W(0x0005790b09b3bb89), W(0x0004b47103daf963), W(0x0007070560bfe853),
+     W(0x000244e1d7227480), W(0x00008f9f1e2be3ae)},
+    {W(0x000658466699aee3), W(0x0004a9c02dcfd73e), W(0x00038bb772565a48),
+     W(0x000388aef83b08de), W(0x00045b4d10125686)},
+    {W(0x0000000000000001)},
+    {W(0x00025e3881e20fb4), W(0x0003076a1985b447), W(0x00057887e2b67ed0),
+     W(0x0007da0886ff3cbe), W(0x0004b7cf942122d1)}
+  },
+  {
+    {W(0x00072d3a93eee7ff), W(0x0003a6c40ec9b594), W(0x0005edc22798d4d1),
+     W(0x0006b7edaa64f45f), W(0x000512a3e32f8e12)},
+    {W(0x0003de266473cf81), W(0x00058194b9866271), W(0x0003566d37b3c3ed),
+     W(0x0007e6508c547d4c), W(0x0000dfd9f1c63ccb)},
+    {W(0x0000000000000001)},
+    {W(0x00005238bca752d4), W(0x0002c85db78c9c4c), W(0x0004f9b4e40ed828),
+     W(0x0007e4591345efd8), W(0x000457b20442a89d)}
+  },
+  {
+    {W(0x000212d5f03de3a6), W(0x000783cfee011fec), W(0x0000aecea465ef42),
+     W(0x0003b958a64131c2), W(0x000184d36cdeb5d3)},
+    {W(0x00025402a5acb7e6), W(0x0004c7635726cd47), W(0x00006849f02fd935),
+     W(0x00016ed9d3637465), W(0x00048b579c762646)},
+    {W(0x0000000000000001)},
+    {W(0x00053dbe3fddda12), W(0x0000c861cb1b6793), W(0x0001adcd5531edfb),
+     W(0x0001b1c05e81014f), W(0x00066075df6644d2)}
+  },
+  {
+    {W(0x00036df755a9ebf4), W(0x0001d3bf1a1b3391), W(0x0007e745bade3dc5),
+     W(0x0003495184b7d4ec), W(0x000562225111b558)},
+    {W(0x000625af2b0a786d), W(0x0005f003d1c53978), W(0x0002a1f2583840cf),
+     W(0x0007f49bf2ad6e09), W(0x0001a30b133bf8a5)},
+    {W(0x0000000000000001)},
+    {W(0x00040dd723da5291), W(0x0000586a7a2edc81), W(0x000304ab4b143a3f),
+     W(0x0000e015253a56c6), W(0x00052c1ecedccb50)}
+  },
+  {
+    {W(0x00024c4eec336d37), W(0x000027e2f11f464c), W(0x000265b5e004b973),
+     W(0x00010d07b392b253), W(0x0005a5920b40c75d)},
+    {W(0x0001de12dd63d1d5), W(0x000112485a778d69), W(0x000430af4ce03e8f),
+     W(0x000117558b34deae), W(0x00006c5b9a45d685)},
+    {W(0x0000000000000001)},
+    {W(0x00042bb82704ebda), W(0x00046a48ca59a38b), W(0x00020d1f26133e57),
+     W(0x000545498f5e015d), W(0x0001175342203dec)}
+  },
+  {
+    {W(0x0003834103ab8617), W(0x00006406235e9647), W(0x0002b9f94471aaf2),
+     W(0x0003b0f35663fd39), W(0x00002e7b52f54f92)},
+    {W(0x00013e1e2da0be6c), W(0x0007ba4428bf7c1a), W(0x00028e733e8e6e9f),
+     W(0x000480027c6db19d), W(0x000556c861abf825)},
+    {W(0x0000000000000001)},
+    {W(0x000264d868279943), W(0x0002434d18fc383f), W(0x00073ac3125a7a95),
+     W(0x0004f84cb5f626f2), W(0x00022596b021d654)}
+  },
+  {
+    {W(0x0002f983f1d24060), W(0x0002fbb5deea24dc), W(0x0004d45c0e96891c),
+     W(0x000405590d8e70e0), W(0x0002836624a06bdf)},
+    {W(0x0001d94e3be0a639), W(0x00064f9f03c8196e), W(0x000094ea8987cb5f),
+     W(0x000505dd7c0530c5), W(0x00030dcabd3d228f)},
+    {W(0x0000000000000001)},
+    {W(0x0003bef33a4de7b9), W(0x0004b902e5338847), W(0x0006152a46c6041d),
+     W(0x0005dca2a98573c8), W(0x00019dcadceff3f3)}
+  },
+  {
+    {W(0x000501b94c99a1fd), W(0x00067df96bde4ea5), W(0x0005bbea644ee170),
+     W(0x00073b02bb688138), W(0x00063744c1a6c7d8)},
+    {W(0x0004feef03f2759b), W(0x0002e663f0b6ca2c), W(0x00026eac58737e1b),
+     W(0x0004acf3d85184b6), W(0x00076729c318b6b7)},
+    {W(0x0000000000000001)},
+    {W(0x00052aabbdc3abfb), W(0x0001f611e90567bf), W(0x000217b1e8e96eb6),
+     W(0x0007f9f158bff854), W(0x00009a3e92c82dd2)}
+  },
+  {
+    {W(0x00073476f464e261), W(0x0000f4e1a664e8ed), W(0x0002dc977626e991),
+     W(0x00020264b4f0f556), W(0x0006b0db7e0181fa)},
+    {W(0x0007c2bf31f4d50c), W(0x00007fa79d3016da), W(0x0004eb3b4ea90d6a),
+     W(0x000606fd9692cecc), W(0x0004f69b680690fb)},
+    {W(0x0000000000000001)},
+    {W(0x0006f2203e2b42b8), W(0x000707f6fe399f60), W(0x0007bb464d165988),
+     W(0x00063e5310e3b753), W(0x00027fef34404cf8)}
+  },
+  {
+    {W(0x0003e99de340aeb1), W(0x0001c2f2b678d7a6), W(0x0004a76b8c07b791),
+     W(0x0001f866d717a3ca), W(0x00061235214018d8)},
+    {W(0x0001fdecf1cb5685), W(0x0006c7067623979d), W(0x000094d5b856adae),
+     W(0x0005af1250d8757f), W(0x00048b90de0c267b)},
+    {W(0x0000000000000001)},
+    {W(0x000053c6b62daaed), W(0x00014b3028fefb6b), W(0x0002c87e53e9737b),
+     W(0x000707eb1fb55a5c), W(0x0002d9a06101e670)}
+  },
+  {
+    {W(0x0003aa3bd5db9182), W(0x00054e65a432b7d7), W(0x0005ccd06edbbf77),
+     W(0x000428df9f2b0bee), W(0x000485d6e221359a)},
+    {W(0x0005f6438db12b24), W(0x0002fe98cc695a2d), W(0x0006ee9073adcaf9),
+     W(0x0004cde8e3947e85), W(0x0005799cb6102419)},
+    {W(0x0000000000000001)},
+    {W(0x000190ac8584d7bf), W(0x000715ec493d9d4e), W(0x000761756a28f636),
+     W(0x00048f9ac29482d1), W(0x0006c0045389355e)}
+  },
+  {
+    {W(0x0004ce8a33931a4b), W(0x00046f736b130510), W(0x0005757b1facc300),
+     W(0x000147e42dd4d8b1), W(0x0007deaaec78680a)},
+    {W(0x0001b37198bd42c4), W(0x0003da9c3cdca770), W(0x000197721c4cca9c),
+     W(0x0003187258992ce7), W(0x0002b1637a76810b)},
+    {W(0x0000000000000001)},
+    {W(0x000288169881f3a3), W(0x0002a52e460d7ae9), W(0x0006522c6b2e16b0),
+     W(0x00011e4230e26d61), W(0x0007d8109982e7d6)}
+  },
+  {
+    {W(0x00060aa37c9e7b25), W(0x0001050d4be80c5b), W(0x0004a2e9fc037400),
+     W(0x0007797c848105d8), W(0x00060290fa64e2ea)},
+    {W(0x0007a137d4ef8c23), W(0x00017d67274f43a9), W(0x000343ca5b7c9107),
+     W(0x00067503dd6df194), W(0x0005da944a85b16b)},
+    {W(0x0000000000000001)},
+    {W(0x0000290b766528e3), W(0x00053a126ad8be73), W(0x0005e5b11028e50f),
+     W(0x000644fd064fdedb), W(0x0000397451d03796)}
+  },
+  {
+    {W(0x00028250e6593f19), W(0x00070a7010cae66e), W(0x0007c79f927d449a),
+     W(0x0002f5badc7d177e), W(0x0004288b90182490)},
+    {W(0x0007c7596a2fb374), W(0x00045b97d4194bc0), W(0x0001b739b9e50cd5),
+     W(0x00071da197097949), W(0x000185b0b5242790)},
+    {W(0x0000000000000001)},
+    {W(0x00003c395e4017a9), W(0x0001df426c941784), W(0x0004a52f82a1c4a5),
+     W(0x0006dbf402c11107), W(0x0005572987a7bda3)}
+  },
+  {
+    {W(0x0007a919d216e52e), W(0x000043985bad6d5b), W(0x0004d85a57fe9f30),
+     W(0x0000730d66c5ff64), W(0x00072b249c308d76)},
+    {W(0x0007f66c2a101968), W(0x000023e74c313ac3), W(0x000505278b0d8d98),
+     W(0x0005d3bde43f1a2b), W(0x00045f543e502522)},
+    {W(0x0000000000000001)},
+    {W(0x0003fa214f77ea15), W(0x0005469d4caf38a6), W(0x00028db237e8c51f),
+     W(0x0007dbf449241e47), W(0x00063d10f5cd2c31)}
+  },
+  {
+    {W(0x0003af418be77dca), W(0x0005ce2c20d6fbec), W(0x00072d490e322049),
+     W(0x0003e6aeb0e7a478), W(0x0001f5e228713237)},
+    {W(0x00024fe6f287da76), W(0x0005243a0ab62517), W(0x00047dc16d7902e2),
+     W(0x00027e10bd783065), W(0x00002a7bb09c75ce)},
+    {W(0x0000000000000001)},
+    {W(0x000125612efbba6f), W(0x0000cbc99351b844), W(0x0002ea8648341f98),
+     W(0x00051d8d0ecc41bd), W(0x00045fba174978d8)}
+  },
+  {
+    {W(0x000797942933dbcd), W(0x0005bcb0858452d3), W(0x000355c05e082102),
+     W(0x00010a6e2b1d9851), W(0x00052315207aee6a)},
+    {W(0x0007ac283b102343), W(0x0002d996d5c66972), W(0x0007505f77c07825),
+     W(0x00002085e2fb849d), W(0x00029f407ac838e5)},
+    {W(0x0000000000000001)},
+    {W(0x0001ae5fcf862256), W(0x0007544afe513d85), W(0x00032b4ae9911f9b),
+     W(0x0006b42021ab12b8), W(0x0007f28e99560b72)}
+  },
+  {
+    {W(0x000476116a24b90f), W(0x0004fb86210f88f4), W(0x0006980b2ccf0e37),
+     W(0x00032e7bf4d53bcb), W(0x00019231f7885dc0)},
+    {W(0x0002ceaadcf8501e), W(0x000085df1d73065c), W(0x00069cfdc5a31de4),
+     W(0x00030459ff525c95), W(0x0005c3063f2c24bc)},
+    {W(0x0000000000000001)},
+    {W(0x00053fc6821e7f22), W(0x000151bc3c1c98cf), W(0x0006b62c70d762fe),
+     W(0x000476b8ceac32fa), W(0x00020859562e6e5a)}
+  },
+  {
+    {W(0x0003b6f0a0f04aa0), W(0x00030d37af1e50c8), W(0x000279ce5218f9ae),
+     W(0x00048e863ba3d763), W(0x00011c7c31a79785)},
+    {W(0x00048856815e3af2), W(0x0001ecff41b8f963), W(0x00024fc94de843c3),
+     W(0x0007a3b8ff673b00), W(0x0005055107b613a1)},
+    {W(0x0000000000000001)},
+    {W(0x000104f2ec6b6f98), W(0x00042fd9d29ff4a0), W(0x000502eac180be56),
+     W(0x0006bc8ed455a661), W(0x0006135c2c541e1f)}
+  },
+  {
+    {W(0x0002627dc9f7f21e), W(0x0000d37349140d29), W(0x0006f8b90b630e03),
+     W(0x000285f903ec1033), W(0x000240af1ec73d83)},
+    {W(0x0005f6b3397d704b), W(0x0000251565318b3d), W(0x00077c4461af48b0),
+     W(0x00044af846941618), W(0x0002ea2c88da0d65)},
+    {W(0x0000000000000001)},
+    {W(0x000193104b445c7a), W(0x0002a144d5161b4e), W(0x00010eeb9eb72102),
+     W(0x0005e0f1dfaea3a2), W(0x0003ce0655e2983e)}
+  },
+  {
+    {W(0x000313c93dd6608f), W(0x00033bc20ed4e6c1), W(0x00071312aec803a9),
+     W(0x0004e6e050618489), W(0x00034fc6dbfa8035)},
+    {W(0x0000fed58e095e27), W(0x00032b2e495a9c8e), W(0x00058dbd4777576e),
+     W(0x0001e1a0086cb3f3), W(0x000740161376b472)},
+    {W(0x0000000000000001)},
+    {W(0x000284086211cf1d), W(0x00050d873c9e6537), W(0x0001e3fad4c3ab82),
+     W(0x0000ae37287d444f), W(0x000128af05932cc6)}
+  },
+  {
+    {W(0x00037bff3861756d), W(0x0005f10ea243fec9), W(0x00059f9690773a2b),
+     W(0x00079647433b150d), W(0x0005cb32d7e5943b)},
+    {W(0x0005d1ca8069a95f), W(0x000696c38a3c5061), W(0x0002b1309a6d236e),
+     W(0x0002e8ddf244cf06), W(0x00013879e3c80c5b)},
+    {W(0x0000000000000001)},
+    {W(0x00009b28d8eae9ea), W(0x0002a0550b30d748), W(0x0006da474976314b),
+     W(0x0006fee54a033462), W(0x0002f94982e7e3ea)}
+  },
+  {
+    {W(0x0003fef6b91e0cef), W(0x0002b57627afa8fd), W(0x00007e931d09aea3),
+     W(0x0005b10b7cdd85a3), W(0x00013d5be06716ca)},
+    {W(0x0002f1096539806f), W(0x0005d550532b0ee5), W(0x00071f35bd616413),
+     W(0x00048eadad9fb792), W(0x00009ad1fdae47c2)},
+    {W(0x0000000000000001)},
+    {W(0x00069e2c05596372), W(0x00015e4499b4211a), W(0x000548b0b061faf2),
+     W(0x00059616011cf71e), W(0x00037ce6a5d0013c)}
+  },
+  {
+    {W(0x0006ef893a2d427d), W(0x000562a6aa103963), W(0x00070ae360c687bf),
+     W(0x00068dc7ff4877b4), W(0x0004e8723472d645)},
+    {W(0x00025b479afb8862), W(0x00012fa7327d9a75), W(0x0002f890097175cf),
+     W(0x0004f704a32c56b7), W(0x0000829dd7379a66)},
+    {W(0x0000000000000001)},
+    {W(0x00047161ad1af309), W(0x00006a41c0d0e1fd), W(0x0004863f54311591),
+     W(0x0004e0e3f44c165a), W(0x00056f507b09d904)}
+  },
+  {
+    {W(0x000283e0d59ada8f), W(0x0007dab9d1b6ade3), W(0x00010314361547db),
+     W(0x00007f5717e12674), W(0x00072855531117bc)},
+    {W(0x0003c392228d995a), W(0x000219d808582181), W(0x0005978a37d728c2),
+     W(0x0000a949d1dbe78e), W(0x0005f1d81a8681ac)},
+    {W(0x0000000000000001)},
+    {W(0x000220a5e9e363a2), W(0x0005362cea4c1df4), W(0x0003653f60d63d0e),
+     W(0x0001f4601206e829), W(0x000071a676bf50d9)}
+  },
+  {
+    {W(0x0005992fdc70f45c), W(0x0002ed87b17a7786), W(0x00035c31a6624a74),
+     W(0x0003f88aa8a2da07), W(0x00023588a8f88e67)},
+    {W(0x0006d3cd93675f3d), W(0x0005cbd97817f8da), W(0x000080f38884f4a1),
+     W(0x00035d796a1d7143), W(0x00056f688f7ecc47)},
+    {W(0x0000000000000001)},
+    {W(0x00049af2e7e4ddac), W(0x0004de09a1cd1f4a), W(0x0006d428a9a911ff),
+     W(0x000412b2281dc6b6), W(0x000039e893347a5c)}
+  },
+  {
+    {W(0x0004fdd7e8cbc332), W(0x000652cecba16cea), W(0x0000f988c7509c72),
+     W(0x000343e2cb983da8), W(0x00044339af4ece56)},
+    {W(0x0006d924df687ecc), W(0x0005904518af3862), W(0x0004392f2bdc598c),
+     W(0x0001969b185ca2ec), W(0x000433a23664f416)},
+    {W(0x0000000000000001)},
+    {W(0x000303898000fba3), W(0x000289450b88ff82), W(0x000504332f27ca1c),
+     W(0x00053807c8bceac2), W(0x0005c428e49a9bd0)}
+  },
+  {
+    {W(0x00055e3092a47bb1), W(0x00064bcba1baed28), W(0x0006378fdbd19ea9),
+     W(0x0005770143736081), W(0x000654bdbd5037f8)},
+    {W(0x0007f5ede019cf6e), W(0x0006f12d2fcde968), W(0x0004d6d9084c7059),
+     W(0x0004912571e66705), W(0x0004b6403c4604cc)},
+    {W(0x0000000000000001)},
+    {W(0x0003257ca1fd2509), W(0x00021e4884c30667), W(0x00003fe1392b57d2),
+     W(0x0007c4ca528b591c), W(0x00048814d501b9ba)}
+  },
+  {
+    {W(0x0001cf9d9f892dbd), W(0x000794873ab9d573), W(0x0003a7534914d1ad),
+     W(0x0003208972de32b9), W(0x0000997f733a1167)},
+    {W(0x00032d734c21ba69), W(0x000536bd66c49494), W(0x0006d5729bd2a6d8),
+     W(0x0000cf57db810d25), W(0x000595adb57f3248)},
+    {W(0x0000000000000001)},
+    {W(0x000065f9a9f2f3a2), W(0x0001a24ffed73286), W(0x000690faefdd4784),
+     W(0x0007b1799832b989), W(0x0003bcf27c67297e)}
+  },
+  {
+    {W(0x0001e3dee148110d), W(0x0002169eee90904a), W(0x0007268e4529326a),
+     W(0x00019aeb89f1cf26), W(0x0007f437d85a6885)},
+    {W(0x000449494f4331f0), W(0x0007e9ad366d254b), W(0x0001b189cd938863),
+     W(0x0007728b8ec1b55d), W(0x00069c48d521b0ad)},
+    {W(0x0000000000000001)},
+    {W(0x0005591dd5e9502b), W(0x0003cc9576545a69), W(0x0003567603622d99),
+     W(0x0000f531805e7df1), W(0x0004fb7665702383)}
+  },
+  {
+    {W(0x00039f82214711d9), W(0x0006ef25af834f7d), W(0x0002062c3e05d50e),
+     W(0x0006573033521ffb), W(0x00030c79762b4977)},
+    {W(0x00076117ce8db358), W(0x00011444563a6119), W(0x00000dc4b4d11533),
+     W(0x0004e5963bdf5333), W(0x0002e0aa595232d1)},
+    {W(0x0000000000000001)},
+    {W(0x0000087da7bfcac7), W(0x000470b73cef02b0), W(0x00028d9560b0d81f),
+     W(0x0003c7a4bcd3d845), W(0x0002b55b9ed17006)}
+  },
+  {
+    {W(0x00038d4cfa5e7557), W(0x0006ec0620d97a45), W(0x00030cec875d2376),
+     W(0x000499fab0e44f8c), W(0x0001849405d7c0ac)},
+    {W(0x0000ebdb790dc381), W(0x0000a75bce6cdb7d), W(0x0005cc5e9b461b6a),
+     W(0x000351174fe5b36e), W(0x0000d37b6b8e8e7b)},
+    {W(0x0000000000000001)},
+    {W(0x000796d6dcdab3e2), W(0x0004d28b7feee455), W(0x0004c7a67e1293d7),
+     W(0x00051c77f137bf75), W(0x000730e3cf6a42e0)}
+  },
+  {
+    {W(0x000077a0d8827890), W(0x00029ac3fdb87457), W(0x0002e3dcfba9bf51),
+     W(0x0000d373eda06005), W(0x000773757425ecbf)},
+    {W(0x00061af2e8cbaf52), W(0x00002f4724381ac1), W(0x0005c98d40f8ba48),
+     W(0x0002e9224db57470), W(0x00004c219a16ab99)},
+    {W(0x0000000000000001)},
+    {W(0x0006f60909b53f70), W(0x0003b5e405c8a6c6), W(0x00017c55b7308d61),
+     W(0x0000b3d2bd007f3d), W(0x00046bdf480e6b7f)}
+  },
+  {
+    {W(0x000714a94e15db9b), W(0x0003d8da2c6d3ab5), W(0x0006cda61c1dde85),
+     W(0x00036f1882d8e0db), W(0x000417263bcf6ccb)},
+    {W(0x000036787340d975), W(0x0004e1e055d750e7), W(0x0003a6a9121360bf),
+     W(0x00007c8323b19cc9), W(0x00066fed7b5e0cfe)},
+    {W(0x0000000000000001)},
+    {W(0x0007fa70d1eb8dfe), W(0x0000d0cb8865f36a), W(0x0003d96323a28c36),
+     W(0x0000b762ccdd100b), W(0x0007b10b792eb205)}
+  },
+  {
+    {W(0x0005c3aa92c823e1), W(0x00073a6b718dcc8d), W(0x0007a3a76fc9aa1b),
+     W(0x0005e9bd0d48e4f3), W(0x000615cf8d3830bd)},
+    {W(0x00079f7dea7ba738), W(0x0003aa3402df8a2e), W(0x00021b0fb2454a19),
+     W(0x000562e364044027), W(0x0000bf2a133aab2e)},
+    {W(0x0000000000000001)},
+    {W(0x00054704e35ab2a3), W(0x0000bf001ec757a2), W(0x00071d8be9def692),
+     W(0x00004c2bcecbfba3), W(0x0003fd3630263a56)}
+  },
+  {
+    {W(0x0003d1c950f974ef), W(0x00071a16f17fb138), W(0x0005b5aea28acd8b),
+     W(0x00050b597a1f18fc), W(0x0003bbab77f061d9)},
+    {W(0x0001a6bde093a941), W(0x000223f6e232b47c), W(0x00038e94578c772f),
+     W(0x0005cd4fe1f856b4), W(0x0004305c084b63e3)},
+    {W(0x0000000000000001)},
+    {W(0x0005f7bcb065abc6), W(0x0001e92cd8b5fafe), W(0x00015ecae836d02a),
+     W(0x000717ebab195ff1), W(0x00005605b4e3422d)}
+  },
+  {
+    {W(0x0003cfca62bc812e), W(0x0005742d69493310), W(0x0004e5f29eebb096),
+     W(0x00033de1d533aa57), W(0x0001b3fe5306682e)},
+    {W(0x00034bf97f807255), W(0x0004dff9c8630f5a), W(0x00017e3fbf2231e4),
+     W(0x0002de05c5039f10), W(0x00062766d249cca9)},
+    {W(0x0000000000000001)},
+    {W(0x0005e5d6dbef38bf), W(0x00078e2d32988a8f), W(0x0007a09133e1f1f5),
+     W(0x0006ebe78d298ef9), W(0x000678d0713d61b1)}
+  },
+  {
+    {W(0x000467f56109e2a7), W(0x0006b0057ac3fe63), W(0x0007de42ced9738a),
+     W(0x0001a794edd24a6b), W(0x00029bfecfa5a653)},
+    {W(0x000796c379152507), W(0x0003a61a14e3d1c5), W(0x00015f700ee8e1d6),
+     W(0x00061f2879cf412e), W(0x0002df4382d6246a)},
+    {W(0x0000000000000001)},
+    {W(0x000345ce4f316093), W(0x0001d6d6a275f4fe), W(0x000323ef6cf00549),
+     W(0x0000f34dc392f3b1), W(0x0006c96b0cab17a8)}
+  },
+  {
+    {W(0x0006f2e09def3891), W(0x0000b1ed3efcd18b), W(0x00063a6bf535aead),
+     W(0x00029329808320eb), W(0x0006758a49924711)},
+    {W(0x0004407bdceaa192), W(0x0002042173a2ec46), W(0x00060951c016ee7d),
+     W(0x00072d04287dc10c), W(0x0001495e8767a3eb)},
+    {W(0x0000000000000001)},
+    {W(0x0006275467295ecf), W(0x000098552a084aac), W(0x0001d47c787829cc),
+     W(0x0003a8d88c47cdc7), W(0x0000f6c03aec42eb)}
+  },
+  {
+    {W(0x000341ebf237d902), W(0x000745fa3a8af3d8), W(0x000708c6fb898694),
+     W(0x0000bc6f808d957f), W(0x0006122fd7bd1cae)},
+    {W(0x0004108f603ccf8c), W(0x000567a795f598f2), W(0x0000a128a60a6f99),
+     W(0x00053d5bae54bdbd), W(0x0000734fd4397517)},
+    {W(0x0000000000000001)},
+    {W(0x0006502b87a5d506), W(0x00003e2cdaabae36), W(0x00024fdb0384f622),
+     W(0x00041633c6d40ab0), W(0x00065d2f18fea71a)}
+  },
+  {
+    {W(0x00059de12055b85d), W(0x000381c74b1adbdb), W(0x0006c0177c8980d8),
+     W(0x00069203e2789ca7), W(0x00068416b00da344)},
+    {W(0x000567ae5c97a868), W(0x0001487ef58c6d4e), W(0x00008d0f09b6031b),
+     W(0x00044f76dfa4d913), W(0x000285b44e8fc6bb)},
+    {W(0x0000000000000001)},
+    {W(0x00076054724508cf), W(0x0004fd6c5435178a), W(0x00031f6f2055cdea),
+     W(0x00055eb794c626a3), W(0x0004effe4488bb82)}
+  },
+  {
+    {W(0x00066d2a5044e7a7), W(0x0002beedee24b00d), W(0x000469e1c8950ab0),
+     W(0x000201206412f1d6), W(0x00075c144f191ff4)},
+    {W(0x00048552a11b2765), W(0x0007a36a68600fdf), W(0x0003011d9dca78b5),
+     W(0x000549c5f2a46b77), W(0x000258f85998128e)},
+    {W(0x0000000000000001)},
+    {W(0x000196bb885d003d), W(0x000448ed47cb6e90), W(0x000103e1ccafaf26),
+     W(0x0002c1f3971944ed), W(0x000394eaffea25cc)}
+  },
+  {
+    {W(0x0003efafeee1279e), W(0x0004691e67e1c836), W(0x0002113f83548b40),
+     W(0x0006137c705d6ee4), W(0x0002734cd39f32ae)},
+    {W(0x0000d91e7491bfb1), W(0x0001ffa68cea64ce), W(0x0000a4e865c0361b),
+     W(0x0004d999eeab4229), W(0x000291290cc44103)},
+    {W(0x0000000000000001)},
+    {W(0x0002f9e7e1eb5a3f), W(0x00037c542c13d694), W(0x0005cf737ba06ba5),
+     W(0x000185c1f4516985), W(0x0003d9c08155b1e1)}
+  },
+  {
+    {W(0x0007c205c9c890b5), W(0x0006ad201839178d), W(0x0003084bf11c512c),
+     W(0x00048ca7de7ceab5), W(0x00042fb9ddcf141c)},
+    {W(0x0004d7c1a075abcd), W(0x0004d25a55dc83f9), W(0x0002aa6f6656eab5),
+     W(0x000643b88bebbb89), W(0x000325254322186d)},
+    {W(0x0000000000000001)},
+    {W(0x000746f3bdb64c0d), W(0x0005c73b18e836bc), W(0x000268152e75275c),
+     W(0x000024081a2f3881), W(0x000207d419075acd)}
+  },
+  {
+    {W(0x00001a601fcdd9eb), W(0x000074e7b47d2025), W(0x0004796353eb7390),
+     W(0x00010d2a1dc925c6), W(0x00070340f4b5a7fb)},
+    {W(0x000332c31abf91f1), W(0x0003022c61502e81), W(0x00000e81c9c8ee1d),
+     W(0x0004906ff246ed05), W(0x000371832b72dd66)},
+    {W(0x0000000000000001)},
+    {W(0x0004e9956b623c9e), W(0x0005f4576d1cc315), W(0x000589f36ea62265),
+     W(0x0004848c5977b2f6), W(0x00036b58e8b394ed)}
+  },
+  {
+    {W(0x00053f3b97709170), W(0x00077d91b20c7e96), W(0x000389fd351126a7),
+     W(0x0003618e8d3b4e3c), W(0x0005ce3a623f64ef)},
+    {W(0x000224c19aa02d9e), W(0x0000f783a0a05a8a), W(0x000174e7179d354f),
+     W(0x00044b03b744da2f), W(0x0005b3ed14d51a91)},
+    {W(0x0000000000000001)},
+    {W(0x00057264aa15122e), W(0x0001cf048d83b53b), W(0x0001df1fd1002e4a),
+     W(0x000176b072501997), W(0x0002efc93cb50343)}
+  },
+  {
+    {W(0x00005b583e89edfa), W(0x00044123feab557a), W(0x000328c833746621),
+     W(0x0002b3e3abc63fa3), W(0x0005c5895e190c45)},
+    {W(0x00061fef0481bce8), W(0x000372ccce1aed67), W(0x0003531b2d7e0008),
+     W(0x000457b1ad4de151), W(0x00032153132deeb7)},
+    {W(0x0000000000000001)},
+    {W(0x0001689a3812825d), W(0x0005a47473114c54), W(0x00070fcf920ff6c5),
+     W(0x0000673d09ebb354), W(0x0002e881d642e520)}
+  },
+  {
+    {W(0x00005c989ea07499), W(0x0003c8ff2a31069f), W(0x000447dcacf3020c),
+     W(0x000603a9b5bfb4d2), W(0x000133a76c17d5b5)},
+    {W(0x00008db894b97420), W(0x00019aebc6bd9b96), W(0x00012919cbff17bb),
+     W(0x0007f007058aebf0), W(0x00002772884cab53)},
+    {W(0x0000000000000001)},
+    {W(0x0002ce349599834e), W(0x00053d8957f05c48), W(0x00044620f30143ca),
+     W(0x0000e738b21ccb70), W(0x00055b780d6ad775)}
+  },
+  {
+    {W(0x00068a1d8cdf64e7), W(0x0002dadf0ceb0f6d), W(0x0000317c675501e1),
+     W(0x0006cd3bea36f31e), W(0x0005a0c3788edcde)},
+    {W(0x0006159a34add870), W(0x000287a512cf9c56), W(0x000116aa2b9332f9),
+     W(0x000590209e52baa0), W(0x00019c45951e2890)},
+    {W(0x0000000000000001)},
+    {W(0x00032b9318ca654c), W(0x00044d7d8e688016), W(0x00046cf6aa680dbf),
+     W(0x00001e65e5d9efea), W(0x00007bced9448a15)}
+  },
+  {
+    {W(0x00077bf4aadef286), W(0x000058fb064f7da5), W(0x0001ec23df8ed354),
+     W(0x0007a5b721f0dd8c), W(0x00060ccd9471ca90)},
+    {W(0x00026e30ad7db92f), W(0x00029eb33341b8b3), W(0x0000523e17e2cda6),
+     W(0x0006c4f8634dd6af), W(0x00069ba1ae10f4b0)},
+    {W(0x0000000000000001)},
+    {W(0x000414abc0f24097), W(0x0002da6081997375), W(0x0002701f31e0ae4b),
+     W(0x0002e848648fdfc1), W(0x0003958dbb673736)}
+  },
+  {
+    {W(0x00008c47ac72bd98), W(0x000535dce73dc0e0), W(0x0000f0232710fc64),
+     W(0x000044d23fda5af3), W(0x0001041cfc28c047)},
+    {W(0x00034c7f4a141d12), W(0x0000f13506976bc5), W(0x0007f961e5f7f962),
+     W(0x000785edca5c0db2), W(0x0006effc26f0e9ff)},
+    {W(0x0000000000000001)},
+    {W(0x00010de7dd770bba), W(0x0005cf114dc04904), W(0x0004f9fab2c4ec66),
+     W(0x0002a63ae8bc2df1), W(0x0000f176d62dafc7)}
+  },
+  {
+    {W(0x00005345ab6c1c71), W(0x0004c9b05a500313), W(0x00072c037d2cce90),
+     W(0x0000d5bc6c8b6eb8), W(0x000505a3cd626b0c)},
+    {W(0x000581bdfda0ab0e), W(0x0007125ea200b9f6), W(0x0005757eac48f562),
+     W(0x0000cd49feb0333e), W(0x00063ae622867209)},
+    {W(0x0000000000000001)},
+    {W(0x0005a12821897faf), W(0x000751b17e9e6ef1), W(0x000240022ea5e95f),
+     W(0x0001d665b3cd53a3), W(0x00040d644a30dbf3)}
+  },
+  {
+    {W(0x0003b2188f93fd3e), W(0x0006021c0bb150bc), W(0x0005bf50b4d58dbb),
+     W(0x00025985f5e5e12b), W(0x0004270b86e03294)},
+    {W(0x0000757720cd0944), W(0x0002e41494bc81ba), W(0x0002a7b486b60d99),
+     W(0x00076c2e249b8ec8), W(0x000267b86af0e155)},
+    {W(0x0000000000000001)},
+    {W(0x0006783c3aa03a32), W(0x00069b36e3076c20), W(0x0003909eeff8b6d4),
+     W(0x0002ed80bf0b1f7d), W(0x00064235fc8f2408)}
+  },
+  {
+    {W(0x0002949c0dbf897b), W(0x00043676defc6a7d), W(0x0002de30d102e1b7),
+     W(0x000720fd415af697), W(0x0000babb94dc1eca)},
+    {W(0x00034c20fae6de1a), W(0x00057bd4b3992235), W(0x0006ab3d020457dd),
+     W(0x0006df83b1fc1e2f), W(0x000360faf8ba9501)},
+    {W(0x0000000000000001)},
+    {W(0x00039aaf56393dbc), W(0x0007270fc19926c9), W(0x0007d3ed5864a2d7),
+     W(0x0006ded146188376), W(0x0006e75fc0580ecc)}
+  },
+  {
+    {W(0x0003632c48e9b577), W(0x0003c5e5d53d66e4), W(0x00066bb7c66f333d),
+     W(0x00021b96c6a6483d), W(0x0003e94882b16d80)},
+    {W(0x0006c95aea7e8216), W(0x000487e18bf55de9), W(0x0001440a3fcd3d94),
+     W(0x0000af67177dcc99), W(0x0006e4d6c387b0ee)},
+    {W(0x0000000000000001)},
+    {W(0x0003e781441bba78), W(0x00033d519261cf74), W(0x0007972c1ba44d7c),
+     W(0x0006d28250f21c88), W(0x0007503a9b430ab5)}
+  },
+  {
+    {W(0x0004a82c811d9242), W(0x000795fa5e035ee4), W(0x000636ee40769086),
+     W(0x0003855725c12347), W(0x00077d60ef3369f6)},
+    {W(0x0002bf7f8bcb6e16), W(0x00013d9cf57d8f37), W(0x0007e4db60fe4f96),
+     W(0x0002686e848164ac), W(0x0007cc8154195782)},
+    {W(0x0000000000000001)},
+    {W(0x0005ad0cde09bfb7), W(0x000128cc91570844), W(0x0002d1230bbb3630),
+     W(0x00034d259f142e4a), W(0x00063f53023ecbea)}
+  },
+  {
+    {W(0x00022e99350610a5), W(0x0006e58af57b5e06), W(0x0005b2fdb15c0a54),
+     W(0x000465b1dde7542d), W(0x000175bcf991b98e)},
+    {W(0x00038660ef4e327e), W(0x0007c752b4371954), W(0x00040d624943075b),
+     W(0x000096dbd2c01cf0), W(0x0002faecae22cc01)},
+    {W(0x0000000000000001)},
+    {W(0x000259e445b07226), W(0x0002703193723385), W(0x000015abe779f4eb),
+     W(0x00019d9f1fc09fde), W(0x000258891a862767)}
+  },
+  {
+    {W(0x00052c6b35f171ee), W(0x00008debedb19aaa), W(0x00018103bc835c7f),
+     W(0x000671d0525dcce3), W(0x000680d56ac68dd9)},
+    {W(0x0003a544f289cc0a), W(0x0004909b4b2f7d7f), W(0x00056a930e307907),
+     W(0x0000af650eba77f2), W(0x0005623c5adc5e8b)},
+    {W(0x0000000000000001)},
+    {W(0x00043fce95f73fd5), W(0x00066ebb3a579e33), W(0x00052d487cbf0de4),
+     W(0x000245d4896390c2), W(0x00074d1c46962c1d)}
+  },
+  {
+    {W(0x000060c714a25975), W(0x00053d8f5bd5946c), W(0x0003acc323320e67),
+     W(0x0002e8f82770b95b), W(0x00024dd818093f41)},
+    {W(0x000561f79c47a2cc), W(0x0006276d27941a4c), W(0x00058a4f798130f5),
+     W(0x0005dd884dd4cab7), W(0x000337308166b316)},
+    {W(0x0000000000000001)},
+    {W(0x0001c94d3e5c7072), W(0x000270b0d6d65846), W(0x000762afd180edd0),
+     W(0x00067e2de4eb337e), W(0x000765e6d8516cb8)}
+  },
+  {
+    {W(0x0002582c05fd8dbc), W(0x000188d4bb1dab10), W(0x0001ea9de6087ba4),
+     W(0x00056cf5439aa99a), W(0x000401e637edbe1d)},
+    {W(0x000474613d679b0e), W(0x0005e879ea4f0fa5), W(0x0003034ee410cc62),
+     W(0x00077a7775ce4c6a), W(0x00017883842dd11f)},
+    {W(0x0000000000000001)},
+    {W(0x00036cdbc5b3bc80), W(0x0002a31485f9f04c), W(0x0000382f11ea33e8),
+     W(0x0004327dd175b2ef), W(0x0007e4c9fe4be094)}
+  },
+  {
+    {W(0x00033ceca68817f1), W(0x0004fcb2793dc6f9), W(0x00050ab502a285f8),
+     W(0x00006d4c86115878), W(0x000567be3e28d3cf)},
+    {W(0x0006d2804815a480), W(0x00030cd7fb0f87e1), W(0x000488cc429580bb),
+     W(0x000646d93e9269f3), W(0x0004d58e34ec4f3f)},
+    {W(0x0000000000000001)},
+    {W(0x000676f009cc447e), W(0x000315f1072da7a5), W(0x00044f4ecc60ef40),
+     W(0x0007eb924f0da286), W(0x000120cc36985551)}
+  },
+  {
+    {W(0x00012a62b3a83797), W(0x0001d37d5e2bab69), W(0x000134e9710254ed),
+     W(0x0004908cd5bd62fb), W(0x000442023decb4f8)},
+    {W(0x0001c83acf8d1902), W(0x0002d2c6afb4fb0c), W(0x00017df2f691d616),
+     W(0x0000d9af3ea53248), W(0x00040da071580420)},
+    {W(0x0000000000000001)},
+    {W(0x0002dc3443bfa35a), W(0x00047017f26768ff), W(0x00052a6176fa6b5c),
+     W(0x00011f3c5d41f21a), W(0x000492abd274af9e)}
+  },
+  {
+    {W(0x0003a0c55cbb6c51), W(0x000419b6476cab2d), W(0x00061981992a2299),
+     W(0x00010ac78177ea48), W(0x00002a498aab9e1e)},
+    {W(0x00045e94982b26d8), W(0x000171319746d8eb), W(0x0006bbf6cf51c33c),
+     W(0x000500d6e9187936), W(0x0004bc1f9396188f)},
+    {W(0x0000000000000001)},
+    {W(0x0005472762451995), W(0x0004416da855b29e), W(0x000520b322888148),
+     W(0x000612f75091e9d0), W(0x0003d1ff3dc5596c)}
+  },
+  {
+    {W(0x00067655a2f66e16), W(0x0001fe7a6bb8e481), W(0x0006132563211174),
+     W(0x0003d3002f0907be), W(0x0006fb473409a2ce)},
+    {W(0x0003b08905140acb), W(0x000246ad784498c3), W(0x0003112b9f6235e4),
+     W(0x0002f174ea8ef852), W(0x0004efc107502cf7)},
+    {W(0x0000000000000001)},
+    {W(0x0000aaf346bc428a), W(0x0002bc3e660d373d), W(0x000073e227cb078a),
+     W(0x0007bf531e465b6a), W(0x00031f82a9eeba7d)}
+  },
+  {
+    {W(0x0001bcc083960b11), W(0x0005a8ad69646262), W(0x00079b0ca9c78e01),
+     W(0x00067cf169e1ffa7), W(0x00019ee319082fdf)},
+    {W(0x0003cb1d2b166e16), W(0x0002c32cd3dc05b3), W(0x000590dee02afee7),
+     W(0x000117ca5be13f1e), W(0x00038f536c94c4a1)},
+    {W(0x0000000000000001)},
+    {W(0x000436291d1232c0), W(0x000480060fd347cd), W(0x00051b430f76524d),
+     W(0x0003e8de6a617247), W(0x00077a58cd1b9fd2)}
+  },
+  {
+    {W(0x0006a8f1e645857b), W(0x000062c63f4faa7b), W(0x0002450368e2e380),
+     W(0x0007943720f81f72), W(0x0003c39c5a2e7914)},
+    {W(0x00001c45073c589c), W(0x00012be06c327493), W(0x00062db8a838be10),
+     W(0x00060fae70767ca1), W(0x0004afac8a8f5b27)},
+    {W(0x0000000000000001)},
+    {W(0x0003aa4692d5aecf), W(0x0000b3091a579feb), W(0x0003e0f57038f71a),
+     W(0x0007a39ebdbc9cf3), W(0x00044601f7bf800c)}
+  },
+  {
+    {W(0x00044c75236e9c6b), W(0x0000d9aac9d70637), W(0x00017490ba8be7f3),
+     W(0x0000738893b5b930), W(0x00027277035cc699)},
+    {W(0x00028eca8e1152d1), W(0x00032e4686a7ae59), W(0x00042924b07058af),
+     W(0x000413ede131edd1), W(0x0004a2909873bcee)},
+    {W(0x0000000000000001)},
+    {W(0x000791a47952c4de), W(0x00048b4999ead455), W(0x0001c3d623f2961a),
+     W(0x0007ebc39a2e6b8a), W(0x00004b9fa5e041d5)}
+  },
+  {
+    {W(0x0006fedf862fa72e), W(0x0001cf7ca86c501a), W(0x000242b28d20b1fc),
+     W(0x00010cf082aaed8b), W(0x000191eabe0090f9)},
+    {W(0x00007428542247b3), W(0x0007484264a4b0d0), W(0x00018231985a86bf),
+     W(0x0000e3691c6c20ff), W(0x000610f932d075b0)},
+    {W(0x0000000000000001)},
+    {W(0x000453bfb3a9c4e5), W(0x00018f8d3cfccb1d), W(0x0007055f49b84e7d),
+     W(0x0004647aa93e71c2), W(0x00001e9b3a41ad36)}
+  },
+  {
+    {W(0x00049a1355f81af5), W(0x00071285496e5602), W(0x0005194c4b38d5ae),
+     W(0x0004da8d536b08c9), W(0x00045fd864753b5a)},
+    {W(0x0006fc48dfc2b56a), W(0x000265973dc910f6), W(0x0007f08a02e3d6ff),
+     W(0x0000c05ef67b0b3f), W(0x00045185403314da)},
+    {W(0x0000000000000001)},
+    {W(0x0007fe7e9d4dd880), W(0x0000356bded2d420), W(0x0007e6a1b17d1037),
+     W(0x000276870ee0e550), W(0x000120f0847a32bb)}
+  },
+  {
+    {W(0x0000b1779fd948fa), W(0x0004bec4af6941f6), W(0x0005145e00106663),
+     W(0x000640b5af4b526b), W(0x0003ff592d96a595)},
+    {W(0x0000383483e670e1), W(0x0003ce98ae52f153), W(0x0002c76756de21ab),
+     W(0x00043c35b83b1cc6), W(0x000341fdec21b044)},
+    {W(0x0000000000000001)},
+    {W(0x0004a1c5f93834ea), W(0x0007148327d9cfce), W(0x0004db98eebfebe3),
+     W(0x00037f5c3efeca9a), W(0x00026fff75eea4f9)}
+  },
+  {
+    {W(0x00024c3649aa08d0), W(0x0003529aebf41b61), W(0x0007cc868868639e),
+     W(0x000445e313339014), W(0x0000d059db159ae2)},
+    {W(0x0004eba55deb0c7b), W(0x00039fa25b7ca941), W(0x00030820b8fd1ac5),
+     W(0x00077c72b68c666b), W(0x0000876350072e2b)},
+    {W(0x0000000000000001)},
+    {W(0x00008bf3db506dbb), W(0x000384327b3acf84), W(0x00033aadacdd4c57),
+     W(0x0002e08fd2cf94f0), W(0x00052100ef009da5)}
+  },
+  {
+    {W(0x00034bf66e33cdcb), W(0x00020d171a3ddf24), W(0x00005417a85984c9),
+     W(0x0004eff1e47a361b), W(0x00039c520a5ddc05)},
+    {W(0x000759a933e9ad54), W(0x0001e32f2b66ba1d), W(0x0002e4ff92c7c297),
+     W(0x0003d8e3c262a72a), W(0x0006465eeb22105d)},
+    {W(0x0000000000000001)},
+    {W(0x00013db102edfce7), W(0x0005f49a34fa9f7a), W(0x00006aa046f25bf5),
+     W(0x0006d0a18a611f03), W(0x00065a0994f15568)}
+  },
+  {
+    {W(0x000158716bcbfcfe), W(0x000450cfb8b04bf0), W(0x0001b49328b78fb7),
+     W(0x0003271bbde10625), W(0x0003434a7d853a79)},
+    {W(0x0002b3dfe6f71a2d), W(0x0000c58dcc44075c), W(0x0005875992ed8782),
+     W(0x00047165987e9641), W(0x00002e9fe53d64f7)},
+    {W(0x0000000000000001)},
+    {W(0x0003842bfa1435be), W(0x0002a85d2d5d1c9a), W(0x0000aa9603f98d8a),
+     W(0x000246f92116492c), W(0x0003f5dffdc1eab6)}
+  },
+  {
+    {W(0x00047fa1dada0977), W(0x000269ff1ffb29d3), W(0x000087dae4f966e3),
+     W(0x000595797ad5aa28), W(0x0005e323357d22c5)},
+    {W(0x0004a15b45f7b4f4), W(0x0006097add7e7058), W(0x0006088e33b3f656),
+     W(0x0001ae2d0f9e2797), W(0x0001939a74724bb6)},
+    {W(0x0000000000000001)},
+    {W(0x000064a814e21212), W(0x0006ef4bd9d2fd65), W(0x0005a46ac1333864),
+     W(0x00070fc222f4ff15), W(0x0004327b7cb334f0)}
+  },
+  {
+    {W(0x000236cd7b7c8ce1), W(0x0002981222ad02dc), W(0x000395816cc1008f),
+     W(0x0001d903ceb35284), W(0x0006a492e830ab1a)},
+    {W(0x00040db32b2f57af), W(0x000044201f4972c2), W(0x00059a2e19b60ab8),
+     W(0x000162c7970026e3), W(0x0007fb19947d2eea)},
+    {W(0x0000000000000001)},
+    {W(0x0001d7ae381244af), W(0x00007c02903dfb7b), W(0x000710a6d6f2a6c6),
+     W(0x0004b364e3c434df), W(0x00020d2bf393fb25)}
+  },
+  {
+    {W(0x0007242169c910b4), W(0x000073840ff5123d), W(0x0000203f7d5d5339),
+     W(0x000482c34ab7e16f), W(0x00046553d3a67868)},
+    {W(0x0000d546ce40e1b5), W(0x0004f7641d227873), W(0x0002d15d3a12e65a),
+     W(0x0003b4bd1bfea788), W(0x000041e19683fbb1)},
+    {W(0x0000000000000001)},
+    {W(0x00038754a6b5422b), W(0x0002c2f2944b6326), W(0x00046f506b2e25cd),
+     W(0x00068f704c4dd5a3), W(0x0000446a50287af0)}
+  },
+  {
+    {W(0x0004517e3a401b25), W(0x0000d409ae534fc4), W(0x0003d59328d7739d),
+     W(0x00022008089c9659), W(0x0000250f3c037215)},
+    {W(0x0006d74ada086fb6), W(0x000593ed6fb64c06), W(0x00029233c8ee6a93),
+     W(0x00037e93055e7af5), W(0x000184f60cb554cc)},
+    {W(0x0000000000000001)},
+    {W(0x00000882433e02fb), W(0x0001b92dd7deced7), W(0x0000d0093c11e1e1),
+     W(0x0006ab157ecd0a8e), W(0x000095653163eafa)}
+  },
+  {
+    {W(0x0002016f2eff8417), W(0x00019cd6a4053cb3), W(0x000796a5cdc6f85c),
+     W(0x0000763428ea85f6), W(0x00031f0175fda429)},
+    {W(0x000381c5bf1abcea), W(0x000441bcfc75b98d), W(0x00061c511e498193),
+     W(0x000509c57eb3c181), W(0x0004761d11c6c078)},
+    {W(0x0000000000000001)},
+    {W(0x0006f821bb616527), W(0x000518b6cadfd51d), W(0x00023b846a1e7715),
+     W(0x00013e62e71cb1bd), W(0x0001615e1543ac54)}
+  },
+  {
+    {W(0x0000a715e16866cb), W(0x00022a534e16b10c), W(0x00013775b77419da),
+     W(0x0005f4d70094b7d7), W(0x00077561ffdf8432)},
+    {W(0x0000bcdb1dd7ede9), W(0x0001b45fe79baa3e), W(0x00002f9e61faf17d),
+     W(0x0005a780f0b11f66), W(0x0001277e241be302)},
+    {W(0x0000000000000001)},
+    {W(0x000655388335da76), W(0x000450930247a484), W(0x0004f42fc43d40ea),
+     W(0x00055db6d376a5a9), W(0x0003a2af22a0f56e)}
+  },
+  {
+    {W(0x00016499c3b7a37f), W(0x00074ae3f42f09f2), W(0x000300295ce27f19),
+     W(0x0000b65da07ac63b), W(0x0006a77df039fd5d)},
+    {W(0x0005c84426c74028), W(0x0002b3ec620568af), W(0x0000d88b7d168b55),
+     W(0x000483c1042c68fe), W(0x0003d1c2a96e1fb0)},
+    {W(0x0000000000000001)},
+    {W(0x0004ea2f0c1d4902), W(0x0004e775331fd3cb), W(0x000484149cb1a15f),
+     W(0x0006586a1ef8eede), W(0x0005123271b192ca)}
+  },
+  {
+    {W(0x0003ec0a7d04cab7), W(0x00018e932599393a), W(0x000636765ef13bda),
+     W(0x0007323145f1b738), W(0x000534a6863f851d)},
+    {W(0x000097c43e90ca9c), W(0x00035ac759107cd0), W(0x00053171879a8628),
+     W(0x00018aa6d1463084), W(0x0005d0738a0db88f)},
+    {W(0x0000000000000001)},
+    {W(0x0007538a6dba8b85), W(0x0007804f514854b4), W(0x0004123168401b25),
+     W(0x00031561c0904b0b), W(0x000338914a9cf604)}
+  },
+  {
+    {W(0x0005d96d10e1b3a0), W(0x0004dab6690d9822), W(0x00002424f61fc992),
+     W(0x0000a3963cae10e1), W(0x0001547b990ec7d6)},
+    {W(0x0006e922c851d21a), W(0x00052ec26c13e06d), W(0x0001d3000365a929),
+     W(0x0004634b12680ad6), W(0x00074602f408e3b8)},
+    {W(0x0000000000000001)},
+    {W(0x0002cd9cafb41fc7), W(0x000756b5f82d30e6), W(0x00052d1c5608c3c1),
+     W(0x000757e892edb617), W(0x00068ef816608f89)}
+  },
+  {
+    {W(0x000086558893a0ad), W(0x0002b436e1197c1f), W(0x0006d9ea50e940c9),
+     W(0x000564183e99a511), W(0x000332b9db1cd22c)},
+    {W(0x0002c5ad2d596192), W(0x0001a90d9ab1cd10), W(0x00017c78bbff5cbb),
+     W(0x0002afb7414c1954), W(0x00045b83b37db6d3)},
+    {W(0x0000000000000001)},
+    {W(0x000172125dcaed03), W(0x0006674920e04e87), W(0x0005d8a9c6e77208),
+     W(0x000388d93576699c), W(0x00077e9f5e4e7d80)}
+  },
+  {
+    {W(0x00049eb25f2b5b92), W(0x00000df08b59d5c1), W(0x00069d621e28fd9a),
+     W(0x00074e1dde4d69b5), W(0x0001860476d7f3d8)},
+    {W(0x00017773deae8626), W(0x00079d158beac6e9), W(0x00038b0e7fd3da04),
+     W(0x00024e7462b45235), W(0x00035491bc789e74)},
+    {W(0x0000000000000001)},
+    {W(0x0003ae3b2eabc64d), W(0x00006fc63d2bdef7), W(0x000692a177c5ca61),
+     W(0x0007c91b1dc53e59), W(0x000740ac82c38c07)}
+  },
+  {
+    {W(0x000097e14837fa41), W(0x000731466e86e6ca), W(0x0002438d99cf2f41),
+     W(0x0002300996dd3d27), W(0x0003ad03f85cecc6)},
+    {W(0x000088e65f17b492), W(0x00033d70367a1ff7), W(0x00008883412fd059),
+     W(0x00027a034c480aab), W(0x0004c2faf95b582d)},
+    {W(0x0000000000000001)},
+    {W(0x0000c989f671a703), W(0x0005e8d76819018a), W(0x00064611eda5c323),
+     W(0x0002732a4f9a838a), W(0x00015b912e3fd044)}
+  },
+  {
+    {W(0x0000873d21f1bc77), W(0x00024bd1851545f5), W(0x0004026f685d217e),
+     W(0x00074746737f9a1c), W(0x00050aff26b89897)},
+    {W(0x000498524e4229f5), W(0x0000b731e0f923b3), W(0x000593f63d680356),
+     W(0x0004d27d5e09a3c8), W(0x0001ac946b46a8f9)},
+    {W(0x0000000000000001)},
+    {W(0x0006a6d1f151da1e), W(0x0003c8f35d207b44), W(0x0001ba23fe864b47),
+     W(0x0006bed4ba0d09c8), W(0x00000829a75a85f7)}
+  },
+  {
+    {W(0x00077b73fc788184), W(0x0003b476cb936638), W(0x0007ec91fa8e6243),
+     W(0x00062241097d21b9), W(0x00036c2d9c93f8bc)},
+    {W(0x0007c47f78d07382), W(0x000261d547b98a70), W(0x00042ea13d0d65dc),
+     W(0x0007fa5f437cec5b), W(0x000248e067332b6e)},
+    {W(0x0000000000000001)},
+    {W(0x0005cb01a1a1a9ab), W(0x00078c3b6415f46d), W(0x0001465783ba3c82),
+     W(0x0006dd962b7931bd), W(0x0002ff90776a34b1)}
+  },
+  {
+    {W(0x0004bb5d93cc3fbf), W(0x0004305b553f670c), W(0x00059c7e3d567cd4),
+     W(0x000127ff9e3b40aa), W(0x0000a291a475c222)},
+    {W(0x0002840165713895), W(0x0004eaaf37356a0c), W(0x00000e7b5b228321),
+     W(0x0004f84aa4e3c445), W(0x0006143276e288ea)},
+    {W(0x0000000000000001)},
+    {W(0x00026a4f72691e7b), W(0x000631bd44f5a4f9), W(0x0004346dea3d9613),
+     W(0x00049513d11853a1), W(0x00065b7899478a6a)}
+  },
+  {
+    {W(0x0004ba15aed0a2fa), W(0x0003ffe52b93f680), W(0x0001c76386149d64),
+     W(0x0000278a48cd2373), W(0x0005cccd25dde888)},
+    {W(0x0003f24dab712b0a), W(0x00034c8d898a9af2), W(0x000127187f279b25),
+     W(0x00079a5cc5c55dcf), W(0x0005b1d242c5cdfd)},
+    {W(0x0000000000000001)},
+    {W(0x0003e84f1022dbcc), W(0x000608940f6a3196), W(0x000679a32790c5fc),
+     W(0x0004898347a63b43), W(0x00007a40076c6be4)}
+  },
+  {
+    {W(0x0004755ed2778a81), W(0x00059227d6422747), W(0x000146d4127223e2),
+     W(0x0003566ff0cdb58c), W(0x0005d6eb841c2d6a)},
+    {W(0x0004f5e1fd9e63ff), W(0x0001876049a8b408), W(0x00030cf5f35f21bd),
+     W(0x0004c4e1afc83e0c), W(0x000722f0a0febf1a)},
+    {W(0x0000000000000001)},
+    {W(0x0004c8f3fe6e89a9), W(0x000236cf8feb8a28), W(0x000670463f5e032a),
+     W(0x0005f8be08ac1b93), W(0x0002e770c6eb9efa)}
+  },
+  {
+    {W(0x000082d759749fa2), W(0x000318f3279e3b09), W(0x00043761fc4c488a),
+     W(0x0007f57faed13674), W(0x0004fe0d309295e4)},
+    {W(0x000285556f395f13), W(0x00013063bbcb85e7), W(0x00039470e194e3dd),
+     W(0x0003291fa871efdd), W(0x0004d2929a90e358)},
+    {W(0x0000000000000001)},
+    {W(0x0002d4a318c46823), W(0x0003833a0fa964d1), W(0x0003f82906c4b955),
+     W(0x00051ec4a8b7a141), W(0x0005489891bbc311)}
+  },
+  {
+    {W(0x0002a98cffa60f62), W(0x000248eadefa07e2), W(0x000229361079f584),
+     W(0x0000d193a3cf453e), W(0x00037e2b8dfa0143)},
+    {W(0x00048396fd7e5126), W(0x000480180c227e0b), W(0x00053fcb7f2efd43),
+     W(0x00002d86965af023), W(0x000570f6e22c2dc6)},
+    {W(0x0000000000000001)},
+    {W(0x0007e9e393930d8e), W(0x0007775999b5534c), W(0x0007959cd0570e62),
+     W(0x0004d40eca889f2b), W(0x00025f57ea8171ff)}
+  },
+  {
+    {W(0x000461abbe372550), W(0x0001a8ccd766026c), W(0x0003f613e555aecc),
+     W(0x00071cdf54fc2fed), W(0x000205aae500f746)},
+    {W(0x00016180a95983c9), W(0x000612c04991dd35), W(0x0001f8a4c3de5e34),
+     W(0x000429f1c02a5a7d), W(0x0004e3bd65f9bf8e)},
+    {W(0x0000000000000001)},
+    {W(0x0002407e4a15d5f0), W(0x0005ef36ccf5ef02), W(0x0007525c3e268065),
+     W(0x00038fc9301c6f27), W(0x00039df6b56a361e)}
+  },
+  {
+    {W(0x00032e23faf4a18a), W(0x0002627c9ef180bd), W(0x0003945090b64f12),
+     W(0x000096a102da3530), W(0x0004769b32b74909)},
+    {W(0x0003ed5dc9568eef), W(0x00076da1067c263b), W(0x000091dcbaaf9b98),
+     W(0x00078acaddddacc6), W(0x0002bae4d948afa2)},
+    {W(0x0000000000000001)},
+    {W(0x0004cfe6cc5084a2), W(0x000454848918675a), W(0x0000fc71c550eff1),
+     W(0x0001fb4ba91b2bc3), W(0x0002a8133577a25a)}
+  },
+  {
+    {W(0x000606861247b4a6), W(0x0003edd2a861ec45), W(0x00034f7ffe820c06),
+     W(0x0000088ccd955778), W(0x0003064850e46bf2)},
+    {W(0x0000591caf7be590), W(0x0000c5db4a87fb9a), W(0x000286b7bf82e4b3),
+     W(0x00075d7dd6e0b77e), W(0x0003065104fa5a61)},
+    {W(0x0000000000000001)},
+    {W(0x0002b3c058bbd95e), W(0x0003bdaf73f91ff5), W(0x000490026b212903),
+     W(0x000738ab4220bfbe), W(0x00007122a3acc737)}
+  },
+  {
+    {W(0x000064ed4aca50c5), W(0x0006f8f902c5b8a3), W(0x0001de2d99ac48c8),
+     W(0x00024e92e21d6a34), W(0x00072a3a1c1c9d4b)},
+    {W(0x000747a6e1818ec5), W(0x000092f66d1bfe64), W(0x0004fabad77f0647),
+     W(0x0004bb14cb238d5f), W(0x0007c26b3532a87b)},
+    {W(0x0000000000000001)},
+    {W(0x0001383a8b1b4aeb), W(0x0003ff820d450de0), W(0x00061c50339d0562),
+     W(0x0000acc2fc5b497b), W(0x0005f662502afaf8)}
+  },
+  {
+    {W(0x00037d807f2be5c7), W(0x0007b4f77c71f67c), W(0x0005622c7bd4ddc1),
+     W(0x0005fe31b97f14e4), W(0x0005bff78e36a23f)},
+    {W(0x0002ac19cb45948b), W(0x0007bb93582e3a0e), W(0x0000e5d6fb8b731a),
+     W(0x00036bb86ad3d963), W(0x0001380fa1e491a4)},
+    {W(0x0000000000000001)},
+    {W(0x000569253627af0c), W(0x0006511d949a3266), W(0x0001286163560ba3),
+     W(0x0001cc57db5edfc4), W(0x000695d31c978f64)}
+  },
+  {
+    {W(0x00017de9af29a352), W(0x00075da38f25d680), W(0x0001835433c33eab),
+     W(0x0003a30662bf85f1), W(0x0003af315f0dbf31)},
+    {W(0x00063cda3aa75f78), W(0x0005402f0d96cd00), W(0x0006e30fc8428ba1),
+     W(0x0007b4ed66192719), W(0x00006b8aa275d097)},
+    {W(0x0000000000000001)},
+    {W(0x00051076e0b13bfb), W(0x00063ab8c5c7270e), W(0x0002257426fdfd73),
+     W(0x0004b65026b2dfac), W(0x0003bab511ae8146)}
+  },
+  {
+    {W(0x0002fa58c1562d08), W(0x0001c3b486c89cda), W(0x0006b669230d10c8),
+     W(0x0001bdd1c7822342), W(0x0005332c333317a6)},
+    {W(0x000379def16c023a), W(0x000076fb5d376c07), W(0x0000ba72f0ce84c7),
+     W(0x000411d9b2d60719), W(0x00046619b2eb0712)},
+    {W(0x0000000000000001)},
+    {W(0x0001aaeb6baf2cc7), W(0x0004fb96f230ea87), W(0x00046a1f1bc5839c),
+     W(0x00010c35fdfd9fea), W(0x000778cec6416897)}
+  },
+  {
+    {W(0x0003008a96ac4d69), W(0x0004afcd1b55d1b2), W(0x000135026bc9d4a0),
+     W(0x00067a484ca62dc6), W(0x00059c5105e73fe0)},
+    {W(0x00074aa4c92a3250), W(0x00049364e0582ef2), W(0x0003ed4e7b0e4f89),
+     W(0x00062c7f7c004ef6), W(0x0000c7c11283be37)},
+    {W(0x0000000000000001)},
+    {W(0x00014b0821f2895e), W(0x0005c3572b365af8), W(0x0001858222c23be5),
+     W(0x000358c277339d6c), W(0x000516e1e0091ccc)}
+  },
+  {
+    {W(0x0004f9ba286fdc28), W(0x0000265495ed1e82), W(0x00067c9b7906da5f),
+     W(0x00043228d5f1b0b8), W(0x0000f30f2bbb5f29)},
+    {W(0x00019b56bc70cd0b), W(0x00052cc7cd2de0d9), W(0x0005b774f1fdcc3e),
+     W(0x0004085518b35c99), W(0x0000a491e16f19f3)},
+    {W(0x0000000000000001)},
+    {W(0x0004859b63286da5), W(0x000733be8eb530ed), W(0x0002a2cd553c6fb3),
+     W(0x0006e7eb219dcb8f), W(0x00018fab43d21671)}
+  },
+  {
+    {W(0x00038e995905b32c), W(0x00038f5bfdbe55ea), W(0x00053e398d19edd0),
+     W(0x0000fbe1dc1b606c), W(0x00070eea42455736)},
+    {W(0x0007a765195a2693), W(0x000021af6ba48324), W(0x0007083578f9d928),
+     W(0x00019716ae43aec8), W(0x0003997e2d429426)},
+    {W(0x0000000000000001)},
+    {W(0x0007b3c8c98c5da4), W(0x0007fe9725319b9f), W(0x000446a9967a9c6d),
+     W(0x0003aad0b656cea0), W(0x000021f4c6b0fd7a)}
+  },
+  {
+    {W(0x00028fce624de69c), W(0x0000e73fe3c0f869), W(0x000680b634d1fa1a),
+     W(0x000245cf0c02c977), W(0x0005e1ecd7b60ec6)},
+    {W(0x0000a74f1258211f), W(0x0006525747805587), W(0x00045d2b945ddb0e),
+     W(0x00056346304ca203), W(0x00052473b9baa450)},
+    {W(0x0000000000000001)},
+    {W(0x0005255e76b66bd5), W(0x0006fdb7cd1bb21f), W(0x0006f805025544c1),
+     W(0x0003278d1a97ed15), W(0x0007b0abda58c9ed)}
+  },
+  {
+    {W(0x0003703d1c1787dc), W(0x00074dce479e8e9c), W(0x0003e5090dc02c64),
+     W(0x000712bbc91643bc), W(0x0004179e1d98859f)},
+    {W(0x0001e3b7e40a8d41), W(0x00026fc5be517b06), W(0x0001b53201e00c24),
+     W(0x00022250f4581635), W(0x0000a1685df678b0)},
+    {W(0x0000000000000001)},
+    {W(0x0007c3d6a213bc8f), W(0x0001c8802ac0aa6e), W(0x0004ef5e2b94c7ae),
+     W(0x0005dd65ba807315), W(0x00050e77ee7ed1f2)}
+  },
+  {
+    {W(0x0006aa6d4f06204a), W(0x0006052d157299f2), W(0x0001b941e700d617),
+     W(0x000068c2a4febb16), W(0x0003395fe91bf7d8)},
+    {W(0x00019cc2ab91d968), W(0x00016cd40f2cd6c1), W(0x0006471545461a30),
+     W(0x0004761a3f183fa7), W(0x00019e58e0d436e8)},
+    {W(0x0000000000000001)},
+    {W(0x0003dbee2030e251), W(0x0002c863a2552bac), W(0x0000a1435ac61f7d),
+     W(0x0003700ae2b3d329), W(0x0000e2c8d8e345d6)}
+  },
+  {
+    {W(0x00027e23a226f169), W(0x00033a6e1c981690), W(0x0000abb9027b25d7),
+     W(0x0002804b52e0105f), W(0x000707b91d8dd5c5)},
+    {W(0x0004da7fb879957a), W(0x000391cb92d55070), W(0x0000f59f7b7d362f),
+     W(0x00068d1a34af85f9), W(0x0000d3e4467af1f6)},
+    {W(0x0000000000000001)},
+    {W(0x0001a64a2883fe18), W(0x00038c6562c53d44), W(0x000695ac97aaddb3),
+     W(0x0001d73d1c3c0626), W(0x0006eae160356943)}
+  },
+  {
+    {W(0x0002cbd765f56af0), W(0x00019cdca4a63c27), W(0x0005616a982c076f),
+     W(0x00000322fddbdfd4), W(0x00015218bfd5b36b)},
+    {W(0x0005c23ba37e8d5a), W(0x0005640f18f5e124), W(0x0007ff1ab9333924),
+     W(0x00050e855acf0ada), W(0x000009bc79cb50bb)},
+    {W(0x0000000000000001)},
+    {W(0x000131491908ce1e), W(0x000343391ecdb3b8), W(0x00037bab1ddf9dcf),
+     W(0x0002449a97da02a3), W(0x00004f7ddad076cb)}
+  },
+  {
+    {W(0x000171b5d8382097), W(0x0000b235156d45d4), W(0x00027b4ce5b2e7b9),
+     W(0x0000e39eff9213f9), W(0x0004e8a6bf075d45)},
+    {W(0x0002db3d66f4e01b), W(0x00030ef41f53a362), W(0x000335e4941b112f),
+     W(0x000332d83cf4adab), W(0x0003081933062fee)},
+    {W(0x0000000000000001)},
+    {W(0x00050fc70e3fdec4), W(0x0007adbf0064d57a), W(0x0002cfdc179807d4),
+     W(0x00006bc3c35fa164), W(0x0006573611eba985)}
+  },
+  {
+    {W(0x00026a7f673f137d), W(0x00022ca9871605ff), W(0x0000a2fc87a0c56c),
+     W(0x0003c12fbe549be3), W(0x0002c3c67e07a8f0)},
+    {W(0x00066e88aa82f03b), W(0x000228deb78f0e33), W(0x0001a25984adc810),
+     W(0x000487de3fb2ba77), W(0x000413070550def4)},
+    {W(0x0000000000000001)},
+    {W(0x0002e779031137a7), W(0x00064f555c533317), W(0x00079eb897b0d5fa),
+     W(0x0004ea75ad2b235c), W(0x0001b995e9ada914)}
+  },
+  {
+    {W(0x0007366f5b328fb1), W(0x0002037104d9507f), W(0x0006900101d0f96c),
+     W(0x0005de01f8c1ed0c), W(0x00018fc6fa2b094c)},
+    {W(0x0000d32ce4805a09), W(0x0002ff85cfbe50c1), W(0x0000e377c9390c59),
+     W(0x00025ef195d7e284), W(0x00032628f9115056)},
+    {W(0x0000000000000001)},
+    {W(0x00015ee1e539364e), W(0x0007efefd55cc71f), W(0x0000977e0a243100),
+     W(0x00026eee6dd07a05), W(0x000327eaf61d4613)}
+  },
+  {
+    {W(0x0002fc96c88ff40c), W(0x0007db1f0a8c6626), W(0x00060e418fbbd65f),
+     W(0x0005d06992ac543b), W(0x000054f45d58c057)},
+    {W(0x0001b57cdb2306d9), W(0x00002f21eef5898d), W(0x00067f004edff777),
+     W(0x000335b6878558f9), W(0x00052d319918d656)},
+    {W(0x0000000000000001)},
+    {W(0x000794fecca3c6f4), W(0x000044190d63b9dd), W(0x0000a7aa31c7936f),
+     W(0x00070ef04d051670), W(0x0003843ae4d762c6)}
+  },
+  {
+    {W(0x00046cdc13e52e62), W(0x0004fa8b1a16d82d), W(0x00044e4d2f56cb0b),
+     W(0x00059d85c1b3ff25), W(0x0000b55d5995b7c5)},
+    {W(0x0007d21728a26b93), W(0x0002383cbc01ee14), W(0x000740aa9ca45a93),
+     W(0x00076f327efe6ef7), W(0x000122e4f827118a)},
+    {W(0x0000000000000001)},
+    {W(0x0002f521550dacae), W(0x0003c262b4082c06), W(0x00076b11b5e59340),
+     W(0x0003891c39c65380), W(0x0000024575e26fce)}
+  },
+  {
+    {W(0x00034fc4a864ba3b), W(0x0006acb8dc3fce37), W(0x000315bffce2ae55),
+     W(0x000270937cc1307a), W(0x0004a09395b97e35)},
+    {W(0x000087b44cc8d714), W(0x000551f497af22e9), W(0x000188c34bc348d7),
+     W(0x00014c1e927c1209), W(0x0003b22905e561b2)},
+    {W(0x0000000000000001)},
+    {W(0x0001e2373c721c08), W(0x0004bb828239722e), W(0x00041b9b24ee7054),
+     W(0x00013949dbf240d7), W(0x000245ff1e4202f3)}
+  },
+  {
+    {W(0x00064bac83b1aed0), W(0x00067454435d3e67), W(0x00052c96ab4dd530),
+     W(0x00050ee84580c650), W(0x0005e0845c4f883b)},
+    {W(0x0004462369586523), W(0x000521e9e144c253), W(0x00055f61b5940ad1),
+     W(0x0002a9a58d4e5255), W(0x0000b5a2f89c658b)},
+    {W(0x0000000000000001)},
+    {W(0x0005280cbbfbc114), W(0x0006ca98b27ad893), W(0x0003ea82419c3c52),
+     W(0x0001ef376fd729a2), W(0x00048f4214b64e4a)}
+  },
+  {
+    {W(0x0003b39ef44cdf01), W(0x000591a8afab947b), W(0x00014be1c3f72237),
+     W(0x0006455660a5f4f0), W(0x0003ff1ac2ef442c)},
+    {W(0x00057adfa747f99a), W(0x0007c5e4161a1503), W(0x0007bd7b2789be39),
+     W(0x000214b07a16f253), W(0x000202554397a89f)},
+    {W(0x0000000000000001)},
+    {W(0x000030339f306885), W(0x0003fc002dfd37e0), W(0x000467bd343023eb),
+     W(0x0002052811d21544), W(0x00072fcf06184d83)}
+  },
+  {
+    {W(0x0004b4700f2a3ce7), W(0x00016703b59a0fe6), W(0x00028a0bf93e5e09),
+     W(0x000615e4837f28e0), W(0x0005c838a1829d43)},
+    {W(0x0007bc4deae8025a), W(0x00035c3dd4295e28), W(0x0007ab09c5c36f05),
+     W(0x00055f5e9178cfae), W(0x0005601d6de1b4da)},
+    {W(0x0000000000000001)},
+    {W(0x0004c8293ea24aa3), W(0x00012fa2c53f6d06), W(0x000636095a549069),
+     W(0x00029c8d561f09e0), W(0x00073acf32e85230)}
+  },
+  {
+    {W(0x0000d86a91eee8ba), W(0x0004f07c6d159798), W(0x00009a2ec2e8586e),
+     W(0x0005ad1036f3d9ad), W(0x00025f9255ac8e76)},
+    {W(0x0003e30e8ef44320), W(0x0004b409038f7e19), W(0x0003ebda722e5179),
+     W(0x00051c439f53c54c), W(0x000492327da87b4d)},
+    {W(0x0000000000000001)},
+    {W(0x00039df83f7d0f0e), W(0x00020a97f32b7afa), W(0x0003e71e03884000),
+     W(0x00048909ec07ff46), W(0x00008620ebeaf532)}
+  },
+  {
+    {W(0x0004ba08ff7b864b), W(0x00012ed394fbf193), W(0x000798cf075303f8),
+     W(0x0001c3c392d2f98d), W(0x00004f046bd3fce3)},
+    {W(0x00076641ec0b8e3b), W(0x000587f2abc17de4), W(0x0007bb769fda10c3),
+     W(0x000608f02c141f76), W(0x0005da496d422d25)},
+    {W(0x0000000000000001)},
+    {W(0x00023b68cbcc9cef), W(0x0007b3318e7220a9), W(0x00025bc0c4300c09),
+     W(0x00040f3d285d124b), W(0x000569bff513c282)}
+  },
+  {
+    {W(0x00044822216d9563), W(0x000047ac74bd16f3), W(0x00074b8bec29cd35),
+     W(0x000493efef40c742), W(0x00007e3ea2c4e290)},
+    {W(0x000450bc1b185bf0), W(0x0004bc647c46b392), W(0x0004d3eac59d5e35),
+     W(0x00073551cce012a7), W(0x0004b410b060c688)},
+    {W(0x0000000000000001)},
+    {W(0x0000f05351933526), W(0x0004b98c6dc8df03), W(0x0003a1843c12b833),
+     W(0x0000ad5e6497cb3d), W(0x0001aeab5175af85)}
+  },
+  {
+    {W(0x0002c8da02af1552), W(0x0005d0b9a7734f4b), W(0x00024d7540c8ea5d),
+     W(0x0003461c6dab2692), W(0x000000b07075cdb4)},
+    {W(0x00035f1cbb2512ec), W(0x0002e132dd9099f6), W(0x00005a965e4ded27),
+     W(0x00035619c930c2e9), W(0x0005b43801f6f59b)},
+    {W(0x0000000000000001)},
+    {W(0x00053522b6d26d0f), W(0x00069183eaeaca65), W(0x000746266929a7ba),
+     W(0x000715d1333a778b), W(0x0002f613a419c971)}
+  },
+  {
+    {W(0x0002c75b77ffb8d8), W(0x00053b1045963464), W(0x0002a5ce03505911),
+     W(0x0000872ee199bb82), W(0x0006cd0fbfc06cf3)},
+    {W(0x00005a6246221cda), W(0x000097a9ee11864f), W(0x0000921049f7bc3c),
+     W(0x0000f78d4c895c76), W(0x00074518b6bacdf8)},
+    {W(0x0000000000000001)},
+    {W(0x00014fdefe69fe74), W(0x0000aafbf1c2f747), W(0x000641cc99ab2ba0),
+     W(0x0001f06c6e5f6396), W(0x000138ec40b69f97)}
+  },
+  {
+    {W(0x0006e9e2379633da), W(0x00038af2bcdc0310), W(0x00008bec81a0f0f6),
+     W(0x000302e93a8c4b45), W(0x00030a9087dcd3b1)},
+    {W(0x0002c604a5ac8502), W(0x00078cd25567a95e), W(0x0005a74c2e534b59),
+     W(0x0007661fa4c4d1f0), W(0x000124fba021d4be)},
+    {W(0x0000000000000001)},
+    {W(0x0000225d24095e47), W(0x0000e186da978e20), W(0x0004a17587816852),
+     W(0x0006e638122c595b), W(0x0007713d3437f3c0)}
+  },
+  {
+    {W(0x00067b44f088d455), W(0x000751c6acb58843), W(0x0005ac8445d67964),
+     W(0x00005c7ecb881f5d), W(0x0000889ce795540e)},
+    {W(0x0006d5d1b4bc8e0b), W(0x00071a70c6189bff), W(0x000356877b54315f),
+     W(0x0004a93b911bc08d), W(0x000144fe652f1610)},
+    {W(0x0000000000000001)},
+    {W(0x000269ca9c10ef74), W(0x0001eb8ca70460a6), W(0x00068e51eb91b617),
+     W(0x0003238b74efbfbc), W(0x00041ca92f824fd5)}
+  },
+  {
+    {W(0x000346ddfad363c8), W(0x000388637ef63210), W(0x0006fa1ed25715fe),
+     W(0x0006cee6fd6aa96a), W(0x000513717b630b33)},
+    {W(0x00058c03b119167e), W(0x0004b276ddc9aa16), W(0x0004ec3dab5f8f22),
+     W(0x0000706eb87aec7f), W(0x0007c51b832a1405)},
+    {W(0x0000000000000001)},
+    {W(0x000452830577cea6), W(0x0005673822a7fe56), W(0x0002679f5a2abeff),
+     W(0x0003fa8c7e1f629d), W(0x00029f2166b12d2d)}
+  },
+  {
+    {W(0x000187a815d73365), W(0x00024a6bad36bb33), W(0x0005c52fe7ebca98),
+     W(0x0000fa2e9cf27f8a), W(0x00010b380039d878)},
+    {W(0x0007d04ad76c321f), W(0x0007f9cbea53b6a9), W(0x0006800ae60cb4b1),
+     W(0x000009e954b589cf), W(0x00013a509aca89be)},
+    {W(0x0000000000000001)},
+    {W(0x000511120bf26b5e), W(0x0007511ba2f6b682), W(0x00009a401151a157),
+     W(0x00011f74d282ff57), W(0x00012f946cb9b149)}
+  },
+  {
+    {W(0x00037817ed27e348), W(0x000074b56bf425ed), W(0x000012b9eaa5d7f5),
+     W(0x000528e58727a1ba), W(0x00068071b4907f77)},
+    {W(0x0006438b0f5f7840), W(0x00078d93ff8a3c54), W(0x0006bc3442195c1e),
+     W(0x0003ffe1f4c818a7), W(0x00060b24ac15eaa3)},
+    {W(0x0000000000000001)},
+    {W(0x000782af43cc81fd), W(0x0000750fa9147c43), W(0x000537073e7ce639),
+     W(0x000134e88473e463), W(0x00045a1d24dbadbd)}
+  },
+  {
+    {W(0x0006d483c6fec730), W(0x0001967cebd06877), W(0x0006375720fbfbdd),
+     W(0x0007a9edd8599c8e), W(0x0004705d80986704)},
+    {W(0x000477e86150a8d8), W(0x0004ce7c90be5dee), W(0x0003e2476b781cee),
+     W(0x00052798d62c595b), W(0x0006dad0c4c7ec5f)},
+    {W(0x0000000000000001)},
+    {W(0x0006bb38e0541201), W(0x000792d53de38cc1), W(0x000510a859d3ee82),
+     W(0x00069669a81ab1d2), W(0x000695ffde707c1c)}
+  },
+  {
+    {W(0x0000d17e3f895343), W(0x0004d61214883c75), W(0x0003045b62f78d61),
+     W(0x0004e5dcd56732de), W(0x000161fff5690390)},
+    {W(0x00026697b66b774c), W(0x000226a64dd7b5c5), W(0x0005e7533f2fc9ef),
+     W(0x000256b01b70b24c), W(0x000445e502631de3)},
+    {W(0x0000000000000001)},
+    {W(0x0005a9b704bca001), W(0x0005eef331788902), W(0x0004ffebea256dcf),
+     W(0x0001ff50d5317824), W(0x0003ff251d5f04ba)}
+  },
+  {
+    {W(0x0004df6205dfb02d), W(0x00058b0fff2c6205), W(0x00019a013e868451),
+     W(0x000054ab5f434b9c), W(0x00060acae80b8785)},
+    {W(0x0005009971d6f92a), W(0x000660b68c069ae9), W(0x00011d4d1104a94f),
+     W(0x0006970ec3f43d48), W(0x00015248b90358d4)},
+    {W(0x0000000000000001)},
+    {W(0x00021516e1193d37), W(0x0005a042ffe9b65f), W(0x000746bf1d8d79a1),
+     W(0x0006a242219a7649), W(0x0003b5beb3fe5192)}
+  },
+  {
+    {W(0x000244f31c8fbc7b), W(0x000441c7f9f121a5), W(0x0003c69ec1713720),
+     W(0x0005b0aa92702ea2), W(0x00041f33a07f47e4)},
+    {W(0x0004e035bedb0718), W(0x00060f1d83275727), W(0x00066c5ce4915d74),
+     W(0x000514a485c6f068), W(0x0007c45f4e26c192)},
+    {W(0x0000000000000001)},
+    {W(0x00066b23799a3b70), W(0x000631aaa4eaea69), W(0x00070f4f4565c581),
+     W(0x0006275eca340177), W(0x0004747453586244)}
+  },
+  {
+    {W(0x0003b769409753e5), W(0x0000638852e2f63c), W(0x0006bffb49565fd9),
+     W(0x0000901173757fc6), W(0x0002520662103de3)},
+    {W(0x0000770df66a5038), W(0x00003abdf433be76), W(0x0000be48e04e72d5),
+     W(0x00066043322e63d9), W(0x00059a889d46d6a7)},
+    {W(0x0000000000000001)},
+    {W(0x00032991b5a2c42a), W(0x00067f164b430df3), W(0x0004584ace014629),
+     W(0x0000bcc7909e2dc5), W(0x0001b64a6a737d7c)}
+  },
+  {
+    {W(0x0002ff24aa91c56e), W(0x0003445d784cb254), W(0x00011445f3a0036a),
+     W(0x0006650f8f275951), W(0x000536d335ed68b7)},
+    {W(0x0006636d0d2c0b9e), W(0x0004364670e75841), W(0x0007c3e3001c5295),
+     W(0x00048cbf041d6859), W(0x000216c246484432)},
+    {W(0x0000000000000001)},
+    {W(0x0004dc0977b6f513), W(0x000031f18d8b525d), W(0x0005b5f3af583b22),
+     W(0x0004110c91972404), W(0x000090447dfc3aaf)}
+  },
+  {
+    {W(0x000474e14f80f4c6), W(0x000622ae9b5744b3), W(0x0000f7265b8fb703),
+     W(0x000695dda57d243e), W(0x00049913e478467d)},
+    {W(0x0003ea4073d08776), W(0x0007028604df9d09), W(0x0000f7034d298c3f),
+     W(0x0003d27af07d9096), W(0x000638277e910b89)},
+    {W(0x0000000000000001)},
+    {W(0x0000e5f1ba4155a3), W(0x0001efe0e3f29f39), W(0x0001b1fbfbc1d16e),
+     W(0x000542375d25aec0), W(0x00030d95083f7caf)}
+  },
+  {
+    {W(0x0005a31c685d4e3a), W(0x00016e9a4edc8ef3), W(0x00005628475db99d),
+     W(0x00048e8da4981e7b), W(0x00074f073b0c9b48)},
+    {W(0x0004dfaf947529d4), W(0x0004dab0d85df3f9), W(0x000775d2e62c9626),
+     W(0x00076604b341ae19), W(0x0003b68d574f21b5)},
+    {W(0x0000000000000001)},
+    {W(0x00051c96c5aa5a51), W(0x000629d59fbaf168), W(0x00038d0ef99e00ce),
+     W(0x0002debd1be3119b), W(0x0006c0c6c01b927f)}
+  },
+  {
+    {W(0x0002f16f3773cde7), W(0x00063571de9065fc), W(0x0000141ac4ee213c),
+     W(0x0003e1e4257c5365), W(0x0002d66d5fc7cc6a)},
+    {W(0x0000b80022f93af6), W(0x0001fe8a44402064), W(0x000540c39969671d),
+     W(0x0002e126847a95e3), W(0x0005c9119968e03b)},
+    {W(0x0000000000000001)},
+    {W(0x0003341c02da36ae), W(0x0004e59e497d07c6), W(0x000651ad282fffd6),
+     W(0x0001022888958ace), W(0x000288bc7e9de9f3)}
+  },
+  {
+    {W(0x00079841b90d1ae7), W(0x0005ba221d9b92a4), W(0x0003b943a9ce07fb),
+     W(0x000725c41d89e06d), W(0x0006567046e66f23)},
+    {W(0x00045e49a852aed8), W(0x000174cb989c5457), W(0x0002b1509b4c3667),
+     W(0x0003c3942b5aae55), W(0x0007b20aa135a561)},
+    {W(0x0000000000000001)},
+    {W(0x00074de0d4f4fe81), W(0x0004b37457a317c8), W(0x000047e7b3438152),
+     W(0x0004de3a42918b41), W(0x00078b61a92114ba)}
+  },
+  {
+    {W(0x0000f0113877fa54), W(0x00017ec7d9052317), W(0x0004325cb761e96b),
+     W(0x00056156ce00c449), W(0x00048f082922c068)},
+    {W(0x0003db61e187989b), W(0x000421ffc67ffc5d), W(0x00040b900d57747c),
+     W(0x0004ddaf1953d5b1), W(0x000572534961d9a8)},
+    {W(0x0000000000000001)},
+    {W(0x00028a27c4d824cd), W(0x0005826ab514c76b), W(0x00075787388ac808),
+     W(0x0004e1fc4555770f), W(0x0000b27c4f43db9b)}
+  },
+  {
+    {W(0x00050769e38fdf5a), W(0x0007bcef85fc1ff9), W(0x0002569b6edac331),
+     W(0x00049827a13c8085), W(0x0003eec8d8a6c54a)},
+    {W(0x000093db04a079f6), W(0x0004a05ac5be88d2), W(0x0007b197986d4491),
+     W(0x0006a87cea6cb0d5), W(0x0000ebda05227839)},
+    {W(0x0000000000000001)},
+    {W(0x000263ace8bd1dd3), W(0x0004343b968c40a5), W(0x00038c82e818f5d6),
+     W(0x00079af2bcd3201e), W(0x00064fb735b12a62)}
+  },
+  {
+    {W(0x0004df11008316c3), W(0x0004a7ae9e74da45), W(0x0004847aaf72bf14),
+     W(0x00053aa8097eab3c), W(0x0002a4d0ac82b3ee)},
+    {W(0x000638e3e7d10e6e), W(0x0004c8a026a51287), W(0x00034389c018681f),
+     W(0x00046b49a306ad62), W(0x0004e20d9536839f)},
+    {W(0x0000000000000001)},
+    {W(0x000167e450236c73), W(0x0006df5596cda1d1), W(0x0007f9543195511b),
+     W(0x0006f7b7f14483d8), W(0x00036ec7a589091b)}
+  },
+  {
+    {W(0x0001e121663f283e), W(0x00053121786bad68), W(0x0005de42f1c168e8),
+     W(0x0002ab5a26558c20), W(0x00036222c3e7c804)},
+    {W(0x0003f9be7ed633f7), W(0x00058d99ae230cdc), W(0x00023d7d7c1b9c9f),
+     W(0x00016f5e83a624c6), W(0x00002c7abb045700)},
+    {W(0x0000000000000001)},
+    {W(0x000227338502a044), W(0x0007b3a1e24bf9da), W(0x0003f2804a8dc87f),
+     W(0x000258c35b65ad13), W(0x0002b8fb81c58475)}
+  },
+  {
+    {W(0x00033986f273f2a0), W(0x0007137cec1990d7), W(0x0007f80ada0d3dc9),
+     W(0x0002297c447a0c20), W(0x000634f1f264c0cc)},
+    {W(0x000613a96256af6d), W(0x00066f13529a9795), W(0x0006522ebf8ee4df),
+     W(0x0003d7aa7e7d87c2), W(0x00073a6310f56a2b)},
+    {W(0x0000000000000001)},
+    {W(0x00016a5df56dd6a6), W(0x0006633465466af4), W(0x0002535a1da5567e),
+     W(0x0004f52a09350c01), W(0x0004ce40bc36f326)}
+  },
+  {
+    {W(0x00077c7612eda512), W(0x000234e04ae41790), W(0x00039bff6455e2cc),
+     W(0x00007e726a693f7a), W(0x0004656a3590d066)},
+    {W(0x0001c573421161cf), W(0x00058937f8b966c7), W(0x00031e2cd5201a9e),
+     W(0x0002571abd1fde80), W(0x0003c2158e050ab0)},
+    {W(0x0000000000000001)},
+    {W(0x0007cdcc31a1ea71), W(0x00053bcae641fb9d), W(0x000177916406292b),
+     W(0x0004ba40b12ab7bf), W(0x00053340b2c38c42)}
+  },
+  {
+    {W(0x0007f21443b224f0), W(0x0003b6baa077b33d), W(0x0005429a3d61aaed),
+     W(0x0005c83edb2f8d97), W(0x000788a169bed258)},
+    {W(0x000281438821cb1e), W(0x00034051b55d3b55), W(0x000527238f3fa6dc),
+     W(0x0001540b89d534c5), W(0x000756ad7bb321ca)},
+    {W(0x0000000000000001)},
+    {W(0x00060926089ceb38), W(0x000763faa5f77d1b), W(0x0005f2ee53a42b49),
+     W(0x0001c5be02245b9e), W(0x00027cc01da9927c)}
+  },
+  {
+    {W(0x00016a671d039849), W(0x0002e5704b44265a), W(0x00077864e67694d3),
+     W(0x000687e97cbd66ca), W(0x000696d441caa3a4)},
+    {W(0x00038d388a88ac0d), W(0x00024164f5cd6d4f), W(0x0005089731c4a86c),
+     W(0x00073f89321bb3a3), W(0x0001ddc42bd755af)},
+    {W(0x0000000000000001)},
+    {W(0x000327ac7d18ca5e), W(0x00012a7cff799052), W(0x0007547469a8b2db),
+     W(0x0001d94d6fd2dd4d), W(0x000575ee80124c6b)}
+  },
+  {
+    {W(0x00047777bb21f073), W(0x0005b7936e2525fb), W(0x0007d6923f7aca03),
+     W(0x0001504eaf5ee597), W(0x0000e07c72f407f4)},
+    {W(0x0004f8687dae62a1), W(0x00061a527c4afc90), W(0x0001075c7fa753e8),
+     W(0x00062532c10a74f5), W(0x000528f6997a986a)},
+    {W(0x0000000000000001)},
+    {W(0x00025502ccb8bacb), W(0x00020e707f0b3a69), W(0x0004ab5f22335148),
+     W(0x00007d72edecd2cb), W(0x00020211a9fc8853)}
+  },
+  {
+    {W(0x0003b272819bafa7), W(0x00019fe1677c9644), W(0x000007c9fd6ae844),
+     W(0x00073cea74540a1f), W(0x00065f14f9de0781)},
+    {W(0x000246b09676251a), W(0x00052eb5ec071190), W(0x00054e52934f31eb),
+     W(0x0004b7f0c1d3ea0c), W(0x0001d50b86c64e90)},
+    {W(0x0000000000000001)},
+    {W(0x0000cd5bb38280dd), W(0x0000a7498b7c8e08), W(0x00026a23bb1b3d44),
+     W(0x000718f40cf98000), W(0x0002eb229011827a)}
+  },
+  {
+    {W(0x00014a0f6242b22c), W(0x0007780b28f63cac), W(0x000740ce967e334d),
+     W(0x0004dd9ea67b2afc), W(0x000641e64ff31055)},
+    {W(0x0007700993c26e4c), W(0x0006cb658a6445ca), W(0x0006720f29a5c8a9),
+     W(0x0000db3975262eab), W(0x0007e25701c8b754)},
+    {W(0x0000000000000001)},
+    {W(0x0000b43cc9173025), W(0x000422b36a0b7d54), W(0x00010b08b25061de),
+     W(0x000603405fad61db), W(0x000729bca2bf1c20)}
+  },
+  {
+    {W(0x0002b31f5baeab86), W(0x00032a8853cd8e84), W(0x00032b3f236e2b31),
+     W(0x00076e4775ffba29), W(0x0004ad8bf802998c)},
+    {W(0x00078db01bf4e2e8), W(0x0001ecffae297439), W(0x0003c1b88101a6cd),
+     W(0x0003d72ac802116a), W(0x0006b8d00c63cff8)},
+    {W(0x0000000000000001)},
+    {W(0x0006340572234360), W(0x00025cc94f22beab), W(0x000066fcac379b5b),
+     W(0x00075a3ab1c4ac5b), W(0x0001db10eb34060f)}
+  },
+  {
+    {W(0x00030eb60bf0ad7e), W(0x0007790a8ce9dda9), W(0x0006fa25852548d6),
+     W(0x0006827816493de3), W(0x00011d73d590f3d8)},
+    {W(0x0002cd4a70a2a071), W(0x00005e057fdcc199), W(0x0000af0fe136127a),
+     W(0x00041aa0ad791bde), W(0x000364c5d902f42c)},
+    {W(0x0000000000000001)},
+    {W(0x00051588c765a2a1), W(0x0001a7fb214c363d), W(0x00054b78837ec6ad),
+     W(0x0004b7ebbadbddfb), W(0x000353bff1b83d7a)}
+  },
+  {
+    {W(0x0004d5f6810a3c12), W(0x0001dcb2e592fac5), W(0x0006e3a675f05278),
+     W(0x00072d62cb5c5943), W(0x0002a427efef0a2c)},
+    {W(0x0000d85614b8ac83), W(0x0000c6564763dec6), W(0x0003672cdd23add1),
+     W(0x000415dacd6106b3), W(0x0002b7c7d22dc0f7)},
+    {W(0x0000000000000001)},
+    {W(0x00059d1864a449c6), W(0x0007b00d14a8e609), W(0x0006090bfa91c9f4),
+     W(0x0005b36a7bf0ebfa), W(0x000754e65bcfc520)}
+  },
+  {
+    {W(0x000688b7c0c2a57b), W(0x0006abc310c9abe5), W(0x000583c7eb0bee13),
+     W(0x0000cfb649b82b5c), W(0x0002f60b5628b9e7)},
+    {W(0x0004979bd7114d74), W(0x00019b0d8a98fe86), W(0x0007e018e36362a4),
+     W(0x0007f4c7cc731138), W(0x0001d17640350732)},
+    {W(0x0000000000000001)},
+    {W(0x000154a2b667bba4), W(0x0000c82d2ccbce5a), W(0x000034f7560ff825),
+     W(0x00072863661ff58c), W(0x0003a0e09a3716d2)}
+  },
+  {
+    {W(0x00036fdf295af17d), W(0x000577eed018210c), W(0x00056c9e56039fdf),
+     W(0x0002f6d4c6c64d03), W(0x0002119d4bffdd41)},
+    {W(0x0005135487e3711a), W(0x000135f9dcd0d81c), W(0x00057877202f8db3),
+     W(0x00028f5f6afe5dac), W(0x000463fe2b4ca7ce)},
+    {W(0x0000000000000001)},
+    {W(0x0003097d4e081d7a), W(0x00022ac0e2e7a73d), W(0x0001a5ddfcb3de55),
+     W(0x0000495438fc766d), W(0x0001276496da9983)}
+  },
+  {
+    {W(0x000669a7c96c6ef9), W(0x00023e2d345f2118), W(0x0000a7d9106949d4),
+     W(0x0005d08cdbcacca4), W(0x000574d38880077a)},
+    {W(0x0001d0bc3d44a17a), W(0x000715218039f7e5), W(0x00056fd4afbd142e),
+     W(0x0004e097704a4449), W(0x0000b31d0e0ac475)},
+    {W(0x0000000000000001)},
+    {W(0x0003ac77b12ce413), W(0x000126c5847ffa1e), W(0x000195d31f3411ab),
+     W(0x000418fa49d22785), W(0x0001a1abe56b9462)}
+  },
+  {
+    {W(0x0001dc05630e2a44), W(0x00043eb878d1745d), W(0x00070cb9898cb529),
+     W(0x00022f6d6a9d6e1b), W(0x00050a3600f20471)},
+    {W(0x0004245b68bc1c60), W(0x0007fec299927cee), W(0x0001296f622a43df),
+     W(0x000555950ceafb98), W(0x00055f2be0b38593)},
+    {W(0x0000000000000001)},
+    {W(0x000199f095b2abd1), W(0x00013a64cd6058fc), W(0x000243a8bf157613),
+     W(0x000619537624e3e9), W(0x00020d2319175f5a)}
+  },
+  {
+    {W(0x00000e40c383d192), W(0x0004c657c825ccf7), W(0x0003dc4007486310),
+     W(0x00024b779fc46623), W(0x0003e6c976a41f5d)},
+    {W(0x0000222f67ce6418), W(0x0006e3a5a8f87b7b), W(0x00055ba1cc2fb3f1),
+     W(0x0007bab4118803cf), W(0x0004261f832fe925)},
+    {W(0x0000000000000001)},
+    {W(0x00018f12ea26e02a), W(0x000590c35987ba5c), W(0x0000e8e05eee953e),
+     W(0x000118e2b97b6e5b), W(0x00019ddb873026ed)}
+  },
+  {
+    {W(0x000628570ce2297e), W(0x0001cb9f8200c6f9), W(0x000028c16b53038f),
+     W(0x00051d197abc362a), W(0x0003067f43801766)},
+    {W(0x0007fb9177ddb143), W(0x0001eabbfa5aadca), W(0x00031affb63a5698),
+     W(0x00035482f74116da), W(0x00056624e4b80cbf)},
+    {W(0x0000000000000001)},
+    {W(0x0003525192b54694), W(0x00003e0e8607a712), W(0x00061766cc0105d6),
+     W(0x00012e3244f6ba94), W(0x000721c960835145)}
+  },
+  {
+    {W(0x00045d00cca0211a), W(0x0003aad10b265bf5), W(0x00000e80c147e5eb),
+     W(0x0007e175c14d932c), W(0x0001b0cb0041ebd1)},
+    {W(0x0001e9a46682ef77), W(0x0004fec7c26a1c62), W(0x0000a212c4bca738),
+     W(0x000666244c21d0e1), W(0x0007531a31ef629d)},
+    {W(0x0000000000000001)},
+    {W(0x00011e990e332bb8), W(0x000098aad154fd29), W(0x00065b68e160a3d7),
+     W(0x0007201dcf92882f), W(0x0006c7654a826b91)}
+  },
+  {
+    {W(0x000540d5bae9e912), W(0x000498f9061f2651), W(0x0000c7935ee1ea5f),
+     W(0x0007ba3fcc3c5738), W(0x000007ec519b5a14)},
+    {W(0x0001cf41a149b24f), W(0x00057925fca40da5), W(0x0002a85aaff2507e),
+     W(0x0003488a55234a73), W(0x0000def27ed8bd19)},
+    {W(0x0000000000000001)},
+    {W(0x0003094b862ac3a1), W(0x00076252b43b9f42), W(0x00051957945308c7),
+     W(0x00058994874e3244), W(0x0001c2bdda898334)}
+  },
+  {
+    {W(0x0000b3f9b977929f), W(0x000561ca310c3811), W(0x0003568fd13763aa),
+     W(0x0007a870112c8e79), W(0x0000031e5ba74e1b)},
+    {W(0x00052948725ad86e), W(0x00061f05b43dcce9), W(0x00051240cd700fe0),
+     W(0x00053ebd4a905244), W(0x0000388ec4923dd2)},
+    {W(0x0000000000000001)},
+    {W(0x00000c19b771798b), W(0x000106802548837f), W(0x0002cd3cd1edf0dd),
+     W(0x000484ef86d9e9b9), W(0x0000ad7b5743841b)}
+  },
+  {
+    {W(0x000370cf2b793ceb), W(0x0001ed76f60c50c5), W(0x0000d717f044b83f),
+     W(0x0006c23d6b9c5f3c), W(0x00012d23c32a5fc7)},
+    {W(0x0005f9a29e6e9584), W(0x00050d63bd75a41c), W(0x00058e3cbb80513a),
+     W(0x00033c574d1cd9ad), W(0x0007ae272811b2ec)},
+    {W(0x0000000000000001)},
+    {W(0x000290e6a2f41926), W(0x0000cf71a6b45667), W(0x0005d470bf2f13a5),
+     W(0x00077a763db90cee), W(0x00025447f7f768ca)}
+  },
+  {
+    {W(0x0005e64e10de5cc7), W(0x000311190dd0fcb4), W(0x000676b401700a85),
+     W(0x0002ae1b10ac3ab0), W(0x00051385c6c9f243)},
+    {W(0x00034e52a96a1456), W(0x0005584353974646), W(0x0007be2d3824e521),
+     W(0x000242af9937fa9b), W(0x00046926a46f5b39)},
+    {W(0x0000000000000001)},
+    {W(0x000230ab9a507360), W(0x000300c6ccb5ad80), W(0x0005590013ed1258),
+     W(0x000527b5ece4ccc2), W(0x00070d46cf42f7d7)}
+  },
+  {
+    {W(0x00031c520a3d0fbe), W(0x0007f8c9e4ea1f43), W(0x000508b47f01bcb2),
+     W(0x0003b0cc4af079c8), W(0x0007b9eff490f468)},
+    {W(0x0003ef984157257f), W(0x0004c92c74827168), W(0x0000d641e94fb4cd),
+     W(0x0005e5aa9c89bf73), W(0x00037743e674e7d6)},
+    {W(0x0000000000000001)},
+    {W(0x00021d068492a0f8), W(0x0005be15e635418a), W(0x00038ba7b34d8be9),
+     W(0x0005843ae53f1503), W(0x0001daca67b37a2b)}
+  },
+  {
+    {W(0x00010477be487b1e), W(0x0000160d564f2640), W(0x000493019e265394),
+     W(0x00053545f869533d), W(0x0001b24b1c360445)},
+    {W(0x0007f674c258a773), W(0x0001e7974301f71f), W(0x00062d26889880c6),
+     W(0x0004629e85958fd4), W(0x0007184bac5ac946)},
+    {W(0x0000000000000001)},
+    {W(0x000379727e8f97c6), W(0x000019248ec1d0e0), W(0x00026f5746f5a8d8),
+     W(0x00009f99cfe76b43), W(0x00002a7f687a3155)}
+  },
+  {
+    {W(0x00046f70f7e5ed2d), W(0x0006e685e1452760), W(0x0007f3a02dbfb056),
+     W(0x0001a9852d2d0f38), W(0x00067f4065844aa5)},
+    {W(0x0006e0d87084e5a3), W(0x0000e42068c48fda), W(0x00059d15edbc2d47),
+     W(0x00076d367a34e2be), W(0x000095292bef25c4)},
+    {W(0x0000000000000001)},
+    {W(0x000357988a3bc839), W(0x000225ecc3a58606), W(0x0005bf2e032607ba),
+     W(0x000747067e83968c), W(0x0005f0f5a4dfc70f)}
+  },
+  {
+    {W(0x0007d647e29dc37a), W(0x0002e7e047e0f5e4), W(0x0002be7d1d77a24a),
+     W(0x00010c3a75c923b7), W(0x00072e8284561a3c)},
+    {W(0x00038c6295fdc9b8), W(0x00031473afe1eb3f), W(0x00035b23df97f4b3),
+     W(0x0004452203f48b17), W(0x00047fa68af4d6df)},
+    {W(0x0000000000000001)},
+    {W(0x0000f3081e7f7f12), W(0x0006c4f9471faa44), W(0x0002b09386df9d98),
+     W(0x000778b0ef038e31), W(0x0002cfb364d2f29d)}
+  },
+  {
+    {W(0x00064ef9c51d0507), W(0x0005249a4be24a3b), W(0x0006236bb8738b95),
+     W(0x000367f9de25622d), W(0x000167a02d223b2b)},
+    {W(0x00009adbe8b71894), W(0x0006ad3f3d4e02c0), W(0x00039aaba51a61fe),
+     W(0x000598f38332d4d4), W(0x00053a302dd3436a)},
+    {W(0x0000000000000001)},
+    {W(0x00047ba25dce712c), W(0x0002cecfea4f00ce), W(0x000467fb33fbaf20),
+     W(0x0000b4d6ed25cb9d), W(0x0002bde1d4b95ad2)}
+  },
+  {
+    {W(0x0002bda3329989e5), W(0x00058221dcdc5377), W(0x000598682ef4c13b),
+     W(0x00063d540492d4e2), W(0x00042574d0a6894f)},
+    {W(0x0003d54b8ceb3200), W(0x000506324af67f83), W(0x00017dd4c3205522),
+     W(0x0001db298eb941a2), W(0x000144da6199d10f)},
+    {W(0x0000000000000001)},
+    {W(0x00066c11528d547d), W(0x0005ae01bf0d33f3), W(0x0003c91f2d256dea),
+     W(0x00075580ff0414e2), W(0x0002bd9203e1243b)}
+  },
+  {
+    {W(0x00015b535aa2a102), W(0x000100ee8bbfa3ea), W(0x0003d0a9afb267d4),
+     W(0x000290f758ccbc8d), W(0x0002a83207bfd090)},
+    {W(0x0002f6624e75fcb6), W(0x0004aec43350a7f0), W(0x00057d214c4a76d9),
+     W(0x00000a793bac263c), W(0x0006024097ea621a)},
+    {W(0x0000000000000001)},
+    {W(0x0002a1942b673cbb), W(0x0001a0f03c24cea7), W(0x0003c97596659ac5),
+     W(0x0005db597f5dc1c2), W(0x0005157873bba0b0)}
+  },
+  {
+    {W(0x0001ec302a9edcce), W(0x000307e5c67659d3), W(0x0007560c683396c5),
+     W(0x0004c5373bcbee1d), W(0x000682c05564f840)},
+    {W(0x00012cc8cce598fe), W(0x0002ee9834e955e4), W(0x00047c4e25ca02a4),
+     W(0x000288c830ab15f4), W(0x0000a7e7a7245f89)},
+    {W(0x0000000000000001)},
+    {W(0x000162d78a259539), W(0x0005970a37bc8b5e), W(0x00001e7d99ad589e),
+     W(0x000117e57ccb4f65), W(0x0001eb070a435323)}
+  },
+  {
+    {W(0x00036f70889b5ab4), W(0x00011be81183f7f3), W(0x0000bc8765c8f5f0),
+     W(0x00021959ad79c6e5), W(0x0005415c3e9796e7)},
+    {W(0x00064fad4d33eee5), W(0x00009421754de46f), W(0x0002e03826fd5136),
+     W(0x00000a21cb0d3359), W(0x0006859d7bc8eef5)},
+    {W(0x0000000000000001)},
+    {W(0x00007488b05091f3), W(0x000067c005451a74), W(0x000784ab03213208),
+     W(0x0003fd4ee2b1bdee), W(0x0003571d3f572bdd)}
+  },
+  {
+    {W(0x000039aebeac2828), W(0x00012b814e776131), W(0x0007b442e23b2555),
+     W(0x00015c836c188347), W(0x00077ac5bd674c38)},
+    {W(0x0003c3befc6f991d), W(0x000013017f67dd23), W(0x0007ba221ff1ebf5),
+     W(0x0000676b947bcff3), W(0x0007a088431f6230)},
+    {W(0x0000000000000001)},
+    {W(0x00049e0baaf95404), W(0x0001bdd90ba13feb), W(0x0000188c1e77f06d),
+     W(0x00071219b9784dd8), W(0x0007dc92ccc3f413)}
+  },
+  {
+    {W(0x00029dfc8021fd7a), W(0x0001fe5bb3f16777), W(0x00008bafd1a55510),
+     W(0x0003b8f9726cd258), W(0x00009c881b9c9146)},
+    {W(0x00072deb9ec4b44c), W(0x00050a373090e680), W(0x000092212f85f93e),
+     W(0x0005ed9bc6e8c93a), W(0x00036055ef3315b5)},
+    {W(0x0000000000000001)},
+    {W(0x0001e8034e554d36), W(0x0002375c38409d46), W(0x00068460bc5b1b95),
+     W(0x00023b6299b53f1c), W(0x000048edf8f70838)}
+  },
+  {
+    {W(0x00062e5be4c6f1eb), W(0x0002fab66ad6d26e), W(0x00010ffd38c308a6),
+     W(0x0006f7614f755b0d), W(0x000683f516ea165a)},
+    {W(0x0000d6cde9c68d83), W(0x00001576ab5a4fc0), W(0x000029a46e280e86),
+     W(0x0000fe3d28d24f05), W(0x0000bef9c873945f)},
+    {W(0x0000000000000001)},
+    {W(0x0005da19569343f7), W(0x000001661c883340), W(0x0000b57044f454a4),
+     W(0x0005b7604b32d8be), W(0x000467737e7d7bbd)}
+  },
+  {
+    {W(0x000541b8d953a5bd), W(0x00054d98174369ac), W(0x0002d0c28649a2f0),
+     W(0x00043b822e90bb4f), W(0x0004330896b38f94)},
+    {W(0x00067af8cd039a31), W(0x0007ac33d70d9cf4), W(0x00039e0912bba0f0),
+     W(0x0005cf00f14ed6e7), W(0x00001a8661649636)},
+    {W(0x0000000000000001)},
+    {W(0x0002d81d556048e1), W(0x000750c56747aa07), W(0x000277df5423557d),
+     W(0x0003ba932eebb3ca), W(0x0001c17c585b1d0e)}
+  },
+  {
+    {W(0x0006874ba6aad36e), W(0x0003e53e9e0a1afb), W(0x0006e3f5973ccc31),
+     W(0x0002d8d78eb88e82), W(0x00067bbcaf0c2d16)},
+    {W(0x00044dca561b1b76), W(0x0004057fd3d90981), W(0x00012d4050b129b5),
+     W(0x0002acebd30a7030), W(0x0007c041a090222c)},
+    {W(0x0000000000000001)},
+    {W(0x0005bdd87a946b29), W(0x0004209a1947a52a), W(0x000093bfb33fd107),
+     W(0x00066258fd2306d8), W(0x0007fb5e3adacae8)}
+  },
+  {
+    {W(0x0007136fe0cd6234), W(0x000077bb9c44909c), W(0x0000b9c82710f0fa),
+     W(0x000484f07c352b2e), W(0x000592694fab4d6f)},
+    {W(0x00034154704d7438), W(0x0004ce4af2022f8d), W(0x0006c6d8a853792f),
+     W(0x00003c9d3b14fead), W(0x000574c11b374f85)},
+    {W(0x0000000000000001)},
+    {W(0x0004f9138303ea6f), W(0x0000a41962a49f8b), W(0x00029929bf4e22c1),
+     W(0x000074c0e8f3cd64), W(0x00071afba03f83c2)}
+  },
+  {
+    {W(0x0005a16fc014fb76), W(0x0007e21de186edff), W(0x00026c874281e737),
+     W(0x000021b18dc46231), W(0x00019f4398f01265)},
+    {W(0x0007c8ebcf8d7d40), W(0x00006bec7db5ca08), W(0x000673db4f5272ea),
+     W(0x0005184fdfc7a554), W(0x00076a6d060fae84)},
+    {W(0x0000000000000001)},
+    {W(0x00042283328e03c3), W(0x0001c33b070f7bef), W(0x00016bdc71b6deed),
+     W(0x00077813ebd50480), W(0x0004dea93e6f5e28)}
+  },
+  {
+    {W(0x0005cb8c3e0843ad), W(0x0005ddeae4d02858), W(0x0005c2a6d21c80b5),
+     W(0x00040bcce4641a11), W(0x00024cf0d1c14d92)},
+    {W(0x00058b3707628b92), W(0x00071784a9ff6a93), W(0x000701a20cc85881),
+     W(0x00008971639d1404), W(0x000188934d0a1282)},
+    {W(0x0000000000000001)},
+    {W(0x000608932f2fb596), W(0x0006daba598dee42), W(0x00023591f1294961),
+     W(0x0005bb4dc6725004), W(0x0000a7eecb266ee0)}
+  },
+  {
+    {W(0x00070fce3810d5f6), W(0x0006cc697ffd392b), W(0x0002d40842a5a96b),
+     W(0x0001b24e0697ef88), W(0x000022c818a3f7b0)},
+    {W(0x0005bdf1372bc38e), W(0x0005c14b12586a6f), W(0x00062664efb572c7),
+     W(0x0007dd02f0cd086d), W(0x0004186b34fd1fba)},
+    {W(0x0000000000000001)},
+    {W(0x00011a9a89b3d4ee), W(0x000033ada84409db), W(0x00071d75e1b7669b),
+     W(0x00077d2db1286329), W(0x00011cc68ae33357)}
+  },
+  {
+    {W(0x0006d39cf2ea398b), W(0x00042f5b5b8e9733), W(0x0004db46b3030f26),
+     W(0x0006acc756f00281), W(0x0006d88ee60aff14)},
+    {W(0x000606db13da83a9), W(0x00013a1ae977aed4), W(0x00032d078096b8fd),
+     W(0x0007baba8eca8fcb), W(0x000275962a446f79)},
+    {W(0x0000000000000001)},
+    {W(0x000492c48bbe4d04), W(0x00056f065f1d2a9e), W(0x0000740fd1162d89),
+     W(0x0001a15dcaf03dcb), W(0x00008a7484508bad)}
+  },
+  {
+    {W(0x00046c3f11041a82), W(0x00012e61384a2d43), W(0x00038f9a12226779),
+     W(0x00051e37a40e1f33), W(0x0004df2595aaf63e)},
+    {W(0x00033fe8f8c96e18), W(0x000788d0dce88199), W(0x000573b3960a98c1),
+     W(0x0000226a42dc0af0), W(0x0005d53ff4551eb0)},
+    {W(0x0000000000000001)},
+    {W(0x0004247489065c55), W(0x0005494cda4798b1), W(0x000067e8e31179a8),
+     W(0x00061e97732205fc), W(0x00068ed244d0ade0)}
+  },
+  {
+    {W(0x0006a34d085ad253), W(0x0006b9af0d392b68), W(0x0005ae6d68f63762),
+     W(0x0006a05c21a11adc), W(0x0004a77202d9b69f)},
+    {W(0x000375c3bcd2f4a9), W(0x0002e4d0e0db118d), W(0x0000d23f103ebb3b),
+     W(0x0006690320613577), W(0x0006f6b652bdce2f)},
+    {W(0x0000000000000001)},
+    {W(0x0000291ce6c70b69), W(0x0002645936dfaa2f), W(0x0002897f2b7b656d),
+     W(0x0006c2f6e46e70e6), W(0x000661e9c85ea17a)}
+  },
+  {
+    {W(0x0003cee47e8e162e), W(0x00060dd55e6d413c), W(0x00033366c8e0aa5a),
+     W(0x0003f476f7ce414e), W(0x0002471096c015b5)},
+    {W(0x00077ecbc3fedb3a), W(0x0000174af66ee4c4), W(0x00051bf4320c10fd),
+     W(0x0007110fd4eb9ff1), W(0x0001b12fc066aac3)},
+    {W(0x0000000000000001)},
+    {W(0x000197b0503d1641), W(0x0003de15ad3bc7ae), W(0x00028d63f28fd16e),
+     W(0x000738a37f6335d5), W(0x00025f054ea9f049)}
+  },
+  {
+    {W(0x0001147e55cb8fc4), W(0x00055223e14a74b1), W(0x0003dba30aa4b515),
+     W(0x00046e74e3eb24d9), W(0x00006d0ab091edbe)},
+    {W(0x00047131ddcc8c2e), W(0x000234db0bdab427), W(0x0006046809bc8f80),
+     W(0x00041045262e68d1), W(0x00041aa7c66efdce)},
+    {W(0x0000000000000001)},
+    {W(0x00050d794b18a0a1), W(0x0002969c5d023b3b), W(0x0004c7153334be97),
+     W(0x00039e2ffc0b7628), W(0x0006f29562f528c1)}
+  },
+  {
+    {W(0x000147a46a1922b5), W(0x000322e8a357199a), W(0x00023b4229b98f6c),
+     W(0x0004ed7c644aeaea), W(0x000397beaa52a5a5)},
+    {W(0x00033a395445f2f2), W(0x0001b7816336f3ff), W(0x0007256f22e53879),
+     W(0x0004c76bfc532510), W(0x000680d8dfcd3c9e)},
+    {W(0x0000000000000001)},
+    {W(0x00017eb2c4de2aaf), W(0x0004636a1ae114fa), W(0x0002de18058a2ed2),
+     W(0x00014ee485aedcd6), W(0x0001762c314dfe26)}
+  },
+  {
+    {W(0x0000141b408ddf09), W(0x0007129ede2a3ae0), W(0x000593fbdead83fa),
+     W(0x00073481bd79c6ff), W(0x00063babe92eec29)},
+    {W(0x0005f7bfa5f9dd59), W(0x00015ec5680b9fc3), W(0x000163e8543d4771),
+     W(0x000714496d547e24), W(0x00036737112a1bee)},
+    {W(0x0000000000000001)},
+    {W(0x00043cd259eb522f), W(0x000128b3cea272d2), W(0x00065e27b092b430),
+     W(0x0004c71df43e8c2c), W(0x0006793617d995fd)}
+  },
+  {
+    {W(0x000166692553b7ff), W(0x00045936799f24f5), W(0x00009541c509edf0),
+     W(0x0002b2154f760184), W(0x000412653c3df721)},
+    {W(0x0004252db3a2cdfc), W(0x0001b095239f2977), W(0x000354e617499a9f),
+     W(0x0007f4eec2fe7de9), W(0x0005527aa74d0359)},
+    {W(0x0000000000000001)},
+    {W(0x00008fe91be8afe8), W(0x0001657969f9bc87), W(0x000234a02cfee141),
+     W(0x0003397791a17153), W(0x0003317f27a95eba)}
+  },
+  {
+    {W(0x000135d18efc08ed), W(0x00041f2671481c48), W(0x0000885b44714d6e),
+     W(0x0002c8fb0d7d7fe2), W(0x00075d2a8f82339a)},
+    {W(0x00067e10464f6bdd), W(0x0006637b68a8557d), W(0x00033ae79b6b7caf),
+     W(0x00044d7455ee5df9), W(0x0004a7b1c4e4c221)},
+    {W(0x0000000000000001)},
+    {W(0x00071f63251d46b2), W(0x0002752d9140ebc5), W(0x0004c99265df2b4f),
+     W(0x0001391251e7ac48), W(0x0002f4e245d21fcc)}
+  },
+  {
+    {W(0x00009eaf3da844fc), W(0x000745168fca64b7), W(0x000384e78e0e6350),
+     W(0x0006a1f408754592), W(0x000436ebaa64e71f)},
+    {W(0x0007a9e9b1aca043), W(0x00055b6ddb4027b4), W(0x00036615913695a4),
+     W(0x0000e1e3318da351), W(0x0007d0f8f9275a2b)},
+    {W(0x0000000000000001)},
+    {W(0x00060d47c68a2f50), W(0x0002227e18ee5aee), W(0x0001a3a50a41b18b),
+     W(0x0007462988324e1c), W(0x00071b37d695bc83)}
+  },
+  {
+    {W(0x000360011d63aa3a), W(0x00079fcabb03507b), W(0x00057a4178ea9613),
+     W(0x0004abee921bce28), W(0x0002b8874fb1de57)},
+    {W(0x0007d8f385412e53), W(0x0000f289ffbdf0ec), W(0x0004dbbe029fe61f),
+     W(0x0005d5a8f29c962e), W(0x000008c8c933fd9b)},
+    {W(0x0000000000000001)},
+    {W(0x000538e3a56cee93), W(0x000175aa4d45fed6), W(0x000463a81708a6f5),
+     W(0x00019d55f0b8847b), W(0x0000bbf5d03ea86a)}
+  },
+  {
+    {W(0x0001c876465bf9a2), W(0x000434ae10ad3fdd), W(0x0003dac1690cffa8),
+     W(0x000678ad3e8bb60b), W(0x000361cb8db8d491)},
+    {W(0x0000b41cdb147d23), W(0x000015a5aed5304c), W(0x0000b4374194a2b7),
+     W(0x0007fb6c7e6a395f), W(0x0000521d37c5b1cd)},
+    {W(0x0000000000000001)},
+    {W(0x00028b574dc0f592), W(0x000717c5a910fb7c), W(0x0005f05a3297ba77),
+     W(0x00041d7de8aa2ff3), W(0x00035e5d034a5fe5)}
+  },
+  {
+    {W(0x00071ea334e16010), W(0x000495b2568003d8), W(0x0007d3e5530dd2f3),
+     W(0x000229b8fd098456), W(0x00067c0666a3ea49)},
+    {W(0x0007eb55357439b2), W(0x000291a7a149ebc6), W(0x000615c2efb8f4aa),
+     W(0x000162bb04e92adc), W(0x0007de519cd0e741)},
+    {W(0x0000000000000001)},
+    {W(0x00007d551849b345), W(0x00054d44948ce08e), W(0x0000f297ff730fee),
+     W(0x00048a8bf3333ae8), W(0x000427b38bd7cc7d)}
+  },
+  {
+    {W(0x00012c7fcf4209c0), W(0x0001476c625360da), W(0x00069204b342bf05),
+     W(0x0003aa23b8f1ab64), W(0x00050ecef133698c)},
+    {W(0x0007513ef430c11e), W(0x0005c2e1edd01a99), W(0x0005e8aba9821a71),
+     W(0x00047d056a844071), W(0x0003a84a6a72940e)},
+    {W(0x0000000000000001)},
+    {W(0x000017bebcfc460f), W(0x0007e99682fa0bca), W(0x000701c2861601d0),
+     W(0x00010a2e225abe38), W(0x00054d5bbfc75faa)}
+  },
+  {
+    {W(0x00051de461e4df15), W(0x00018a0a3ccc84ca), W(0x000697f7fb66f6aa),
+     W(0x0006abbeec8f15db), W(0x0003d28609f0e20e)},
+    {W(0x0006c4cad97bfc09), W(0x00073ffaf9b74dd8), W(0x000658f40982da1b),
+     W(0x0007a4d36295f70f), W(0x00063f045a03d185)},
+    {W(0x0000000000000001)},
+    {W(0x0000ab6579d3c89d), W(0x0000b0303a419b13), W(0x00042aa2df32a2f2),
+     W(0x00070f6665279463), W(0x000673489cffe9fc)}
+  },
+  {
+    {W(0x00014fea06c809c0), W(0x000567b10f637b56), W(0x00058f67387ba69e),
+     W(0x00034e73975cf8cb), W(0x000279423e929af2)},
+    {W(0x000724aafa5f86ba), W(0x0006faa58830daa0), W(0x0001d0d5596eb112),
+     W(0x00039580f8f19e03), W(0x0004c0ddc01e2141)},
+    {W(0x0000000000000001)},
+    {W(0x0001ad8e26e3bbf4), W(0x0001e2c47bcc3f76), W(0x0007c76c1232e7b6),
+     W(0x00064ba1e50fcc1f), W(0x0004f55d424b8cfc)}
+  },
+  {
+    {W(0x000006035760056c), W(0x00040e348fd1eda3), W(0x00057e010d2ba95c),
+     W(0x0003985227d4a933), W(0x00003893f4695aa2)},
+    {W(0x00009dfe4017666c), W(0x0005ea71996c828a), W(0x0001b67e641e021f),
+     W(0x000162941815e78e), W(0x0005437237593e38)},
+    {W(0x0000000000000001)},
+    {W(0x0006d6339e7685bf), W(0x00055d9157e80964), W(0x0006035983559734),
+     W(0x0006ac22729d80e4), W(0x000468cd3bbb719f)}
+  },
+  {
+    {W(0x00001a709eaf6744), W(0x000798d012e0564e), W(0x000145aebf7cecd7),
+     W(0x00010b5911e4d109), W(0x00038375e426b4dc)},
+    {W(0x0004d79007bc5f21), W(0x0002dd03c27b7295), W(0x0001cfbf77c88ca2),
+     W(0x0005a7e1e396ac88), W(0x0003c2dc0fa1f63d)},
+    {W(0x0000000000000001)},
+    {W(0x00039f5fc407476d), W(0x0003df713ce5e399), W(0x00078afec8faa581),
+     W(0x000185bede9e7fd7), W(0x000002a9d3665f03)}
+  },
+  {
+    {W(0x00010a1611045657), W(0x0004ce91da62c468), W(0x0000db739e2028e9),
+     W(0x000616f11a8b1cb0), W(0x0007a3d56334d797)},
+    {W(0x0002c38dcd823a5a), W(0x0003fdae113d84a4), W(0x00015f04f6226ad1),
+     W(0x00042932760d049a), W(0x00035b1967e7b21f)},
+    {W(0x0000000000000001)},
+    {W(0x0004b101ee28fc1e), W(0x0007a8413b535e34), W(0x0000b237df1fc63b),
+     W(0x0001c540781d7986), W(0x000471650f83af67)}
+  },
+  {
+    {W(0x0005a3b778eb0f2d), W(0x00023281446a3849), W(0x0007b93e875f537e),
+     W(0x000380b906e9ff92), W(0x0006ff537c21138c)},
+    {W(0x000029de46e6a656), W(0x00075c9e2a89c546), W(0x0003bb6b2bf1e26e),
+     W(0x0002ce61ec03d850), W(0x00029d7b78ba02a4)},
+    {W(0x0000000000000001)},
+    {W(0x000129e060cb98b9), W(0x00071dfbe6a08d13), W(0x0006648af5a6aea9),
+     W(0x00065d4157df0972), W(0x000370882d8e21c6)}
+  },
+  {
+    {W(0x0002637280f4522f), W(0x0004d2fd9a6b1d2c), W(0x0005110eb1ca29cc),
+     W(0x0004e783a8c7f5f7), W(0x000068f5bfa2b1fe)},
+    {W(0x000703bfbc91b875), W(0x0000fc0d4f95e41b), W(0x0004e11d3902d63d),
+     W(0x000333ecdc92c263), W(0x00019a7f33474fb9)},
+    {W(0x0000000000000001)},
+    {W(0x0004320c8289104d), W(0x0006f6e25b39a696), W(0x0001932aaa2575b5),
+     W(0x0003fdb1353853e9), W(0x00070da66a74d3b1)}
+  },
+  {
+    {W(0x0000637c532a2c27), W(0x0001ad3a682a89e6), W(0x0002390e9fde2283),
+     W(0x000096b45d220c50), W(0x000418f0a4bed53a)},
+    {W(0x00057cd23ca39ba4), W(0x00021aff80a9c66f), W(0x000135e3a6d47c24),
+     W(0x00018bf76b437b24), W(0x00077d64e1dd8541)},
+    {W(0x0000000000000001)},
+    {W(0x00005c0367c36f3f), W(0x00066d69243c5226), W(0x0000ff3af2d0c6fc),
+     W(0x0005613182b0fe3a), W(0x0007e9e415a4590e)}
+  },
+  {
+    {W(0x0005ba686f328725), W(0x00022f1d7f1cccd3), W(0x00002706fa25fe08),
+     W(0x00076c8dfe1af390), W(0x0006132edf760067)},
+    {W(0x0004c35521369064), W(0x0001e221b124baed), W(0x0005f0ef7bb46dd1),
+     W(0x0000b655a84b496e), W(0x00079ce0b4a1f4de)},
+    {W(0x0000000000000001)},
+    {W(0x0003750717a98302), W(0x00052fef38bdf4aa), W(0x0002f3d2297f6b6e),
+     W(0x00008bf31ced3598), W(0x0004abd6833f6979)}
+  },
+  {
+    {W(0x000754d32230874c), W(0x0007330e97e7e5ea), W(0x0001ee48f3f198fa),
+     W(0x0003f7bbd9858d03), W(0x0002f46bc16d3918)},
+    {W(0x0003443bba25695a), W(0x0002ea968af4333d), W(0x0007338123c001fa),
+     W(0x00043f6a6be57f0d), W(0x00020b0bcb605286)},
+    {W(0x0000000000000001)},
+    {W(0x0001da3996a3f32d), W(0x00023fb3cc314ab8), W(0x0004c64776b0a774),
+     W(0x000575f5c228289d), W(0x0005d93492f76723)}
+  },
+  {
+    {W(0x000371270f6a60d0), W(0x0005e02e9b055673), W(0x0003690be5762ef5),
+     W(0x0006248ec6e98139), W(0x0005e8d140c9f5ef)},
+    {W(0x0004b983987f6617), W(0x00007f2945723561), W(0x00051ac7bd67d170),
+     W(0x0006d967e8b49153), W(0x00000889e65a927e)},
+    {W(0x0000000000000001)},
+    {W(0x0002dc84e5bbf70f), W(0x00079bb35f5b8544), W(0x00071e2efe6da176),
+     W(0x000285423d0c46cf), W(0x0000e58197b2d034)}
+  },
+  {
+    {W(0x0002aa30aae5fb06), W(0x0001a8022906e04c), W(0x0003429642cfc01e),
+     W(0x0003d431d9acb5b8), W(0x00044cdfebfd54ba)},
+    {W(0x000514d6c2c19158), W(0x0003deca537c6413), W(0x0002b12bc8ff808e),
+     W(0x000261047cd6140c), W(0x00002cfcdb23a6f4)},
+    {W(0x0000000000000001)},
+    {W(0x000307288cdda909), W(0x00017d60a7e70ad7), W(0x0002a0a85a8c622e),
+     W(0x0006ac91fbb0d2fd), W(0x00032d2e9c76a0b9)}
+  },
+  {
+    {W(0x00069b0ce4bd2f89), W(0x00074b1acdab1f60), W(0x000781471daeafdd),
+     W(0x0003fda23a81571c), W(0x00002483180f40d3)},
+    {W(0x0002de6a2176ff66), W(0x0002b35099cdc9eb), W(0x0006b478717199ec),
+     W(0x0007b7d5b6441f5d), W(0x0000e4d252228812)},
+    {W(0x0000000000000001)},
+    {W(0x00038aaa71d49383), W(0x0000f42836d3110f), W(0x000622db2ec7cfc0),
+     W(0x000168a55944af09), W(0x0004e9fcff9dcd06)}
+  },
+  {
+    {W(0x0000ecc52d60d24a), W(0x00011caa01968774), W(0x00019344f6874b3a),
+     W(0x000202b36fc09a5b), W(0x0007cc9cada92034)},
+    {W(0x0004933499679d4d), W(0x000145aabd320d1b), W(0x0006b484a4b84f83),
+     W(0x0002a8d9b08a7716), W(0x00031d248fe7276a)},
+    {W(0x0000000000000001)},
+    {W(0x00012792502422c1), W(0x0003007bd522f5c7), W(0x0007c2d47354fdfc),
+     W(0x0005a4b0f3c1a48e), W(0x0007a9fe48e6d190)}
+  },
+  {
+    {W(0x0000934243448ce5), W(0x0007e9e2338db65b), W(0x0003aae195345e20),
+     W(0x0001cfc530c022d3), W(0x0003fc1272289eb6)},
+    {W(0x0003a2840aea2f17), W(0x0000b279dd4e0019), W(0x0005c7f48c496468),
+     W(0x0007d85d9ab81fc3), W(0x000211421fb585e3)},
+    {W(0x0000000000000001)},
+    {W(0x000655e3781c06e7), W(0x00066825922b40b2), W(0x0001d44b27a8b9a6),
+     W(0x0002b78aa27ab8f0), W(0x0003bb3a7a8fb00e)}
+  },
+  {
+    {W(0x0002ccf9e71bab1b), W(0x0007a6a7e1904c43), W(0x0000f95413886b93),
+     W(0x000009101eb30302), W(0x0000c45a01d1482f)},
+    {W(0x0000d3d921807d89), W(0x00050fc7c193f55a), W(0x0003564b6a745611),
+     W(0x00046a339c5af4a3), W(0x0005755dc7d04f80)},
+    {W(0x0000000000000001)},
+    {W(0x0001a4e841518010), W(0x0000795240785b78), W(0x0007b3090ccdc25c),
+     W(0x000237e5275a8fea), W(0x000582ed19009e62)}
+  },
+  {
+    {W(0x000064fae1e7e35d), W(0x0002ce114cd0a835), W(0x00066d0a0a9ad045),
+     W(0x0001308899306afa), W(0x000449d0a9600dea)},
+    {W(0x0001cdd6280f2559), W(0x00003f209c151b05), W(0x0000205db4f79316),
+     W(0x000256176aa9f81f), W(0x00036a46c68af624)},
+    {W(0x0000000000000001)},
+    {W(0x0002afa1ac7e9d5f), W(0x0004174d4577c1f0), W(0x00023ffd1f2cf88d),
+     W(0x0003ed176a76aad0), W(0x0006d45da789464d)}
+  },
+  {
+    {W(0x0004884ccc2a480e), W(0x0000966c26afec20), W(0x000431a78e73484c),
+     W(0x0005adc7460016e2), W(0x0002576e659583e1)},
+    {W(0x0001944363281c46), W(0x00018ff1edddd9fe), W(0x000093ce40bcbabf),
+     W(0x0007d7efc3122aeb), W(0x00034a12ffe577cb)},
+    {W(0x0000000000000001)},
+    {W(0x0000189576c6435e), W(0x0001e57c13d56f0c), W(0x000471f47cf0a31e),
+     W(0x000308aa1e276d8e), W(0x00042b1d3a310280)}
+  },
+  {
+    {W(0x0005c0b962ce5493), W(0x00039fdf94356ece), W(0x0005da9ab50ddafd),
+     W(0x000485e3f482df91), W(0x0002be1624a002ec)},
+    {W(0x0006cda4a08ca1b0), W(0x0003b26325eba136), W(0x000579f57c7a60bf),
+     W(0x0004380d14f18880), W(0x0002f47b2fcbc726)},
+    {W(0x0000000000000001)},
+    {W(0x0003585fef62efaa), W(0x000419a88655f108), W(0x000329ae971e88b2),
+     W(0x00075fdc251c85a5), W(0x000221b38f6631f7)}
+  },
+  {
+    {W(0x00031fabed9c3b4d), W(0x0003272261a1e0a7), W(0x0000aea919ca8350),
+     W(0x00023af0985b7961), W(0x000639bcdbd9eac5)},
+    {W(0x0003b4783631a823), W(0x0002aff19d47bfbc), W(0x000139c40812a2c6),
+     W(0x0002e2ccb95b9505), W(0x00041b7f4ebe16aa)},
+    {W(0x0000000000000001)},
+    {W(0x000296bd7964651f), W(0x00055cc79cda29b1), W(0x0001867ed79efb6c),
+     W(0x000695767ed944a7), W(0x0004916d703a3034)}
+  },
+  {
+    {W(0x000209d7d9ef2919), W(0x000061285d684838), W(0x00070a8e6f2770e1),
+     W(0x0001d6541948ddb3), W(0x00075b4a9688bf48)},
+    {W(0x0004057ad1d24a1a), W(0x0003c1d8d1d7c19d), W(0x000795df9ef1bf23),
+     W(0x0001e31812983afd), W(0x00035566f4c4bb07)},
+    {W(0x0000000000000001)},
+    {W(0x0003487211883f2d), W(0x0001a39c6ebbbfb7), W(0x00022bc98653cf7b),
+     W(0x000115040e37a3ca), W(0x0000343e8147c1b7)}
+  },
+  {
+    {W(0x0004ad871201f2d7), W(0x0005c47102f065d4), W(0x0002e7833efdb77c),
+     W(0x00068c2d3b4cc340), W(0x00075dbd2c8609e2)},
+    {W(0x0003af6ba582bfcf), W(0x0001e8688f0f5edf), W(0x0003ce83bb632e2d),
+     W(0x0000cc73bdf4149c), W(0x00077b42ca982362)},
+    {W(0x0000000000000001)},
+    {W(0x00015104a29f3ce4), W(0x00073ce783ecc2fc), W(0x0000cbcd023ab5b2),
+     W(0x0001a5a3c403b568), W(0x0007ef2e1168e658)}
+  },
+  {
+    {W(0x0006e716fd3a6919), W(0x0006c55cac13316b), W(0x0007027699a0b116),
+     W(0x0004a5a8e61e5125), W(0x00029acb70cbb204)},
+    {W(0x00022c1d9e200292), W(0x0005fcdc64b55dfa), W(0x000636c123b8474a),
+     W(0x00012abae2b9d966), W(0x0004f842c3a34292)},
+    {W(0x0000000000000001)},
+    {W(0x0006097c48bed355), W(0x0001188766108bf1), W(0x0002eb6aee4ff7c9),
+     W(0x00068059164a6b96), W(0x0001be0592fc5388)}
+  },
+  {
+    {W(0x00008f41f0d8e9fd), W(0x0000336915c69955), W(0x0007878d7fcd080a),
+     W(0x0005995e08741700), W(0x0006b60e9d5db24e)},
+    {W(0x0003ce1b81a682e3), W(0x0004681536c1a0b2), W(0x0005dbab81e6f5fd),
+     W(0x0000ffc0ea083c4c), W(0x0006c79fffec68a8)},
+    {W(0x0000000000000001)},
+    {W(0x0002b985642dfe8d), W(0x000051a58a24bb48), W(0x0003cf01842a74a3),
+     W(0x00056a1e18fcc5eb), W(0x00030ab706890595)}
+  },
+  {
+    {W(0x000358ad0ef64202), W(0x0003caab14c30f1d), W(0x00077b5722b8c10e),
+     W(0x00047d5c64e7965e), W(0x00016d6ab9fd3d8d)},
+    {W(0x00059ff2cded9ce7), W(0x00047414d57044df), W(0x00049f8dc5dfee1c),
+     W(0x0004388fbf83d152), W(0x0000f3ac9403d39c)},
+    {W(0x0000000000000001)},
+    {W(0x00061b9a0f76b72f), W(0x0007d8b82682e035), W(0x00039a308a2b74b5),
+     W(0x00029f22132fef76), W(0x0001de58b9f61f94)}
+  },
+  {
+    {W(0x0005c279db7093f6), W(0x0005d27ba036e6db), W(0x0002a12fff52ddda),
+     W(0x00071db20930c0ed), W(0x000055c7f8abcfae)},
+    {W(0x0006f4eb35601880), W(0x0000ce5191ef9ffc), W(0x00000f33aeb4f6ac),
+     W(0x0006f370727c6482), W(0x000717fb079e0bee)},
+    {W(0x0000000000000001)},
+    {W(0x00031aaa1ec480f3), W(0x0006e1fed25b64e4), W(0x000257cac89578f5),
+     W(0x000185467163f327), W(0x0004eb9d2c5144c8)}
+  },
+  {
+    {W(0x00034e46a88300c9), W(0x00019fd08534a7ad), W(0x00050de486e8a01c),
+     W(0x000076f5df2016a1), W(0x0006203533022a3c)},
+    {W(0x0005cac789b56fa4), W(0x0003e2cd66b97b92), W(0x0007c86c7375b5bc),
+     W(0x00017bd50477af28), W(0x00054a29ad7cf1ba)},
+    {W(0x0000000000000001)},
+    {W(0x000559682bde2c74), W(0x00021bd1e015a0bb), W(0x00048cadb51054e2),
+     W(0x00071eff6f7419cb), W(0x0003512f3de7ef15)}
+  },
+  {
+    {W(0x0000688a95475deb), W(0x0003e03cb7508a28), W(0x0006ddd36f9791f4),
+     W(0x000291eb3612358f), W(0x000637e464e5ba37)},
+    {W(0x0003554e3b16b97d), W(0x000702f021f682f0), W(0x000439667b790605),
+     W(0x0002aa8f9fef35a3), W(0x0007bf943dc10e49)},
+    {W(0x0000000000000001)},
+    {W(0x00046de263c4c46d), W(0x0004e4c737880b46), W(0x0001630ed0e9f913),
+     W(0x000000c9ef958870), W(0x0005afc1283c11e4)}
+  },
+  {
+    {W(0x0001e9af7ffc6ffc), W(0x00035b8482e947d3), W(0x000226004d98a517),
+     W(0x0006270e02719f7e), W(0x0001e2fdb8378fda)},
+    {W(0x0005f18c6423cc2a), W(0x0004a3a03770ad6e), W(0x00041e55d18d7d58),
+     W(0x00033a13b31b8080), W(0x0000aca8b50b14c1)},
+    {W(0x0000000000000001)},
+    {W(0x0007dbee3ebbe855), W(0x0001fc6071ab1985), W(0x00062c42f8d4e494),
+     W(0x0001cda055a69923), W(0x000402020bad9ce6)}
+  },
+  {
+    {W(0x0003e95fef7a1269), W(0x0006b2aac7a5efe7), W(0x000608f6460c41df),
+     W(0x0000c807e3d7a0fd), W(0x0007f10e63bb101a)},
+    {W(0x0004147ad742afcc), W(0x000599f76c650936), W(0x0004dbd419ba40ba),
+     W(0x00015ee90b10cad8), W(0x0007c68141c5cd86)},
+    {W(0x0000000000000001)},
+    {W(0x0007c85aea7e8225), W(0x00001cbca9069638), W(0x000253498063cf3d),
+     W(0x00031228f1f41a26), W(0x0003da6dfe572e10)}
+  },
+  {
+    {W(0x0002e15778935057), W(0x0000804ae0fb5726), W(0x00017a7454ef43ba),
+     W(0x00064b0faf99e5a7), W(0x00031eed95fdd0b7)},
+    {W(0x0005fb916ad91e1a), W(0x000540101f5634f0), W(0x0007dadf872ea10f),
+     W(0x0002a6f009b54be7), W(0x0005df412fcb4af7)},
+    {W(0x0000000000000001)},
+    {W(0x00052c7a8bf74755), W(0x00065239014cd695), W(0x0005d02397eb584c),
+     W(0x0001e988d37dfe4c), W(0x00037398ca06e9e1)}
+  },
+  {
+    {W(0x00027099536b3eb5), W(0x0007bc947b623c23), W(0x000216cadbdd5ac8),
+     W(0x0002cc1d33a89d0d), W(0x0000c60a73d4425a)},
+    {W(0x00067a32fc9628c5), W(0x0001144db8ee6227), W(0x00007b07c3b4eedb),
+     W(0x000674211805b4e7), W(0x00074814b9c9777e)},
+    {W(0x0000000000000001)},
+    {W(0x0007408a3cd9741e), W(0x000460dfaaa7514a), W(0x000288598728dc83),
+     W(0x00041eefe6c662c4), W(0x0006f5c308dcaf22)}
+  },
+  {
+    {W(0x00027d030389069c), W(0x00064ea088f332cc), W(0x0002b45c3e9dedd8),
+     W(0x000101e18b90e5f5), W(0x000781cbfc51de70)},
+    {W(0x0003b18a430bcb5a), W(0x000420cf68842baa), W(0x0001e235caf8b203),
+     W(0x000719795c429abc), W(0x00000b4e0fe0d22e)},
+    {W(0x0000000000000001)},
+    {W(0x0007e58c33e14457), W(0x0002bb455d51786b), W(0x00001ab4fe118ecc),
+     W(0x0004fccaaf48a8a6), W(0x00070da601086c2d)}
+  },
+  {
+    {W(0x0002716c923c0a07), W(0x00026301756b260b), W(0x0006a3b4c8074227),
+     W(0x000222c8d915eb2c), W(0x000033c5bb185b7b)},
+    {W(0x0003cb8b92127d45), W(0x00031d6af46f01c2), W(0x0004393dda7b3ca0),
+     W(0x00012d71eaae9b0e), W(0x0007e5f625dcb4ad)},
+    {W(0x0000000000000001)},
+    {W(0x0006507f94767aee), W(0x00033d5530c292dc), W(0x0003aa2dfdd76c9a),
+     W(0x0001244032785880), W(0x0000b7d167654940)}
+  },
+  {
+    {W(0x0005730475228116), W(0x000442bb8f61acd7), W(0x00056456a3a5d5d6),
+     W(0x0004f534e9f5b5e2), W(0x0007aa59d176efea)},
+    {W(0x000541cebb868923), W(0x00005c81c4071d27), W(0x00077ca0c0f66154),
+     W(0x0002399ccce7a588), W(0x0004775334ca0eba)},
+    {W(0x0000000000000001)},
+    {W(0x000382a07c36d35b), W(0x0002d45d5409aa44), W(0x00050d84b152b8e5),
+     W(0x00057c1410604944), W(0x000129865dda0c70)}
+  },
+  {
+    {W(0x00044c5afef09fa1), W(0x000092f5dda0299b), W(0x0001f7557d4720db),
+     W(0x000011b00d58bf26), W(0x00008d139bc2c3d0)},
+    {W(0x00044a75016af001), W(0x0001ddce099bfb95), W(0x00044cdfe3d0a22a),
+     W(0x000610e0f9acc735), W(0x0005896a0f7d732c)},
+    {W(0x0000000000000001)},
+    {W(0x000410fba30b95c9), W(0x0001509ca984ee2d), W(0x0006661ab7f2446b),
+     W(0x0001560d5da9106a), W(0x00032f18c5621347)}
+  },
+  {
+    {W(0x0006e3539cd5f12b), W(0x0006e47c10cd5962), W(0x00014431d35446dc),
+     W(0x00027b4ad7f8d37b), W(0x00026cc8b0c65c2b)},
+    {W(0x0007e3dee8bd53b0), W(0x0007a5e3b0be60ab), W(0x00067c238df482f7),
+     W(0x000141c843076d91), W(0x000611bc0826984c)},
+    {W(0x0000000000000001)},
+    {W(0x000246e50012381c), W(0x0004f843eb62dbff), W(0x00072548b4dbf0e1),
+     W(0x000605b158403806), W(0x0002757a59fce1a6)}
+  },
+  {
+    {W(0x0001d287689ffdb9), W(0x0005d3119e313e67), W(0x000137ec9b7c40d1),
+     W(0x0003718396d1f9c3), W(0x0001d194d8626dd9)},
+    {W(0x00021e6130351589), W(0x0004d0369d4fbdcb), W(0x00046d348bda3f8b),
+     W(0x0003dfad7e0ba318), W(0x0007a2fc29949b84)},
+    {W(0x0000000000000001)},
+    {W(0x000290b8b601ccba), W(0x0002b1d8333e593c), W(0x0006037b729fb6bc),
+     W(0x00058fc54b237a50), W(0x00060a29deed7242)}
+  },
+  {
+    {W(0x00063178159b050a), W(0x0003aa26902397fb), W(0x0000c5849b883694),
+     W(0x00036a3b1fae314a), W(0x00016b850addce02)},
+    {W(0x000408172277d0d9), W(0x000734c12fd6f06b), W(0x000073256ff53241),
+     W(0x000254d6498d24e9), W(0x0004a1bad274b708)},
+    {W(0x0000000000000001)},
+    {W(0x0006ad26ed8c3117), W(0x0005f69afddedeef), W(0x000694cc91fd5761),
+     W(0x0004ca817b45713d), W(0x0003b4b125f892e6)}
+  },
+  {
+    {W(0x0000554c030307c4), W(0x00078f8d872c46ba), W(0x0003190c74cb6b74),
+     W(0x0002bd093584ae12), W(0x000638e9344ab0ec)},
+    {W(0x0003db8996c454e6), W(0x0005f5ff73094ea6), W(0x00040ff75ea7e26c),
+     W(0x000608a45b77e363), W(0x00020c192b977fe2)},
+    {W(0x0000000000000001)},
+    {W(0x00004fd0d2b44b72), W(0x0007b77b895f2781), W(0x00037166925b48d9),
+     W(0x00001d2b2f686236), W(0x000758e60a0ea471)}
+  },
+  {
+    {W(0x00015e1841e6375c), W(0x000632bccdb73ba6), W(0x000162b39bb7f96e),
+     W(0x0005daa33d87c119), W(0x0006bf9122dd4089)},
+    {W(0x0004bef4e385f4d7), W(0x0004d38b09b688b8), W(0x0006e4c0fa530e79),
+     W(0x00034f0d1376ff38), W(0x00015b67aed29fd5)},
+    {W(0x0000000000000001)},
+    {W(0x0003497064c6a084), W(0x00021b6b01d0c057), W(0x0000ce1ddb8f8d8d),
+     W(0x0004c23baa711d73), W(0x0001e21ad416bc84)}
+  },
+  {
+    {W(0x0004ffb10be2bd4f), W(0x0006e5c96b5cd5d3), W(0x0006fa7dc92f177b),
+     W(0x000065f7d87a7953), W(0x0005640194a8c0fa)},
+    {W(0x000380342134700f), W(0x00015c66c306df24), W(0x0003990cb385dd4a),
+     W(0x0000c6f1e66308ba), W(0x0001de74810477d5)},
+    {W(0x0000000000000001)},
+    {W(0x00033ebd9fde1fe4), W(0x0002292a74ae33e2), W(0x00030b2808fbbcff),
+     W(0x0004c98ff5af1a54), W(0x0000d6fbb17e49ec)}
+  },
+  {
+    {W(0x0005d3237979037a), W(0x0001edea5aae9c3c), W(0x000456bbc4a6054a),
+     W(0x0000f2db1b4dcfe2), W(0x00077529117569e1)},
+    {W(0x0006cc0604a7f9e8), W(0x0005c0b4c143a9cb), W(0x0003e56a3eb1cf85),
+     W(0x0004a1fde023a051), W(0x0001e815dfde63bf)},
+    {W(0x0000000000000001)},
+    {W(0x0003c6a37e08a9b5), W(0x0001e4c23a7dc4ad), W(0x0004cc401c93ab0e),
+     W(0x0003e878a7addbf1), W(0x000431ef9e199424)}
+  },
+  {
+    {W(0x0007acd6cf456838), W(0x0004ce8b6942ffb0), W(0x00019c5683f15e2a),
+     W(0x0002b3861416546a), W(0x0005f905536c92fc)},
+    {W(0x0007ee2caf0ac458), W(0x0007ba933a9b51cf), W(0x0003b72504bf0b14),
+     W(0x0007f349448cabad), W(0x00030486c52188f2)},
+    {W(0x0000000000000001)},
+    {W(0x000428f28c82ea7c), W(0x000661af80d0ae4c), W(0x000182f533d3463f),
+     W(0x00009ad8992005bd), W(0x0003c574efb4ab29)}
+  },
+  {
+    {W(0x0003aef587eb80c1), W(0x00015305401021f5), W(0x00016aa050e0ec03),
+     W(0x0007c2d635bc662a), W(0x0003e90b384c50fc)},
+    {W(0x0002db5809da1f96), W(0x00069ab43335a275), W(0x0002b7f089e858c1),
+     W(0x0004c799abcef9bd), W(0x0003bc1bfb1a8018)},
+    {W(0x0000000000000001)},
+    {W(0x00023df5411c1684), W(0x0002f4589f77ae20), W(0x00015354c2cb6b78),
+     W(0x00064d18bb7ad420), W(0x0004cee4f046c7c0)}
+  },
+  {
+    {W(0x0003fcda5d446506), W(0x0005a86a978272d0), W(0x00052c86e8a6f9c0),
+     W(0x0006b753be970abd), W(0x0003907d0eb88574)},
+    {W(0x0005c605e398c69c), W(0x0002f4725a2ff67a), W(0x00053b8b859825db),
+     W(0x00051035fc09cf63), W(0x00032b97d37e4422)},
+    {W(0x0000000000000001)},
+    {W(0x0001384200465084), W(0x000659202c5c8e59), W(0x00056cc9a58731ed),
+     W(0x0002edc0a6b49e8d), W(0x0004bf597f6586c3)}
+  },
+  {
+    {W(0x0003fd71d352b4d4), W(0x00007fb28bce49d5), W(0x0006977dc93a272b),
+     W(0x00049ba9ad5f9b77), W(0x0006615b37cb068f)},
+    {W(0x000666f8a05c259e), W(0x0000bf06441f2cf9), W(0x00019d37a643a175),
+     W(0x00034f88faec38bf), W(0x000543094df65a02)},
+    {W(0x0000000000000001)},
+    {W(0x0005fb8932dcad21), W(0x00023218200bf79c), W(0x0003d668c73acc45),
+     W(0x00050c4151124644), W(0x0005a0ee497d1445)}
+  },
+  {
+    {W(0x000519e8e64eaacc), W(0x0000307fd21c0590), W(0x00044be0e98653f8),
+     W(0x0002c1c2a4e70ebf), W(0x0004d167eed0702c)},
+    {W(0x00041ee852a320e3), W(0x0000a01d9fb7309c), W(0x0007f5306ba9c415),
+     W(0x000734165f1070a0), W(0x00007c2314f511fe)},
+    {W(0x0000000000000001)},
+    {W(0x000643f7b784f7c1), W(0x00073cf0868710a4), W(0x0003077def3ac512),
+     W(0x0007f9b0c134a6ff), W(0x00039a8e99969bc3)}
+  },
+  {
+    {W(0x0007f1224429fda2), W(0x00072180be77287a), W(0x00048ee7f56ebf24),
+     W(0x0001e0915c3ba7b6), W(0x0006deefa2240a5b)},
+    {W(0x0007b10a78dfa391), W(0x0001e2cb9c891546), W(0x0000bd2c6bef0a58),
+     W(0x0002b42674874b89), W(0x0000a99cc3f293b8)},
+    {W(0x0000000000000001)},
+    {W(0x00030137ec1277aa), W(0x0005d76bb6ce8e90), W(0x000413622a91532c),
+     W(0x00056c11c746f21d), W(0x0006de56ecf5dbb1)}
+  },
+  {
+    {W(0x0001772531d5150c), W(0x00051a24be13dbdb), W(0x0002b8006f0daeb2),
+     W(0x000188352d63d3da), W(0x00072db447174140)},
+    {W(0x000789d3def1cf4c), W(0x00066d629661fb7b), W(0x0002e75e2b407019),
+     W(0x0004c64b6fe89e94), W(0x000675a27104c2e3)},
+    {W(0x0000000000000001)},
+    {W(0x0007f20d7cba1e8a), W(0x0000a229504b606d), W(0x000762dcbee1900c),
+     W(0x0002817add52ffa8), W(0x00060c05f685ac29)}
+  },
+  {
+    {W(0x0000393b08e92c14), W(0x00039796c5803c66), W(0x0007bfb7b278bba8),
+     W(0x00011c2cf43b361f), W(0x0000e93d72b464b9)},
+    {W(0x000582f57f59fc8b), W(0x0002bae3cc2c4c7b), W(0x0002713947b6562f),
+     W(0x0005f110d0e220f1), W(0x0005085a41c2ee64)},
+    {W(0x0000000000000001)},
+    {W(0x0007c860ad801a2c), W(0x000720ee83310caf), W(0x0003e01e1e817cbd),
+     W(0x00032cd9c06e29b0), W(0x000464336d086feb)}
+  },
+  {
+    {W(0x0001bf2d303fe2e6), W(0x0007e6bbfd644050), W(0x00010b44f24c7f86),
+     W(0x00048549239e9c64), W(0x0000086bde0fe74a)},
+    {W(0x0005d0261827267d), W(0x00018f229398662e), W(0x0002ec09d325d2b2),
+     W(0x00051ceeb0c0f94f), W(0x0007924ebab931a9)},
+    {W(0x0000000000000001)},
+    {W(0x00079e81db57e753), W(0x00020c77dd3ac480), W(0x000474ff2fa2756f),
+     W(0x0005be71144a2786), W(0x00066a5fab906ee7)}
+  },
+  {
+    {W(0x00057cd9f6e1d639), W(0x0004a0754636981b), W(0x0007da7caa5b8d49),
+     W(0x0003691b90293098), W(0x0000fa222566acdc)},
+    {W(0x000309b60e075f1b), W(0x0000f010d0cc9dbc), W(0x0001f85b3ed259d0),
+     W(0x0007f60ca4140c15), W(0x0002b33d9563d715)},
+    {W(0x0000000000000001)},
+    {W(0x0005c8dc75dde801), W(0x00021840a9f68db1), W(0x00036f83d179cc15),
+     W(0x0007ab69778c1b7b), W(0x0005681dfdc0e94b)}
+  },
+  {
+    {W(0x000252b85cd3afae), W(0x00073de2dc0d335a), W(0x000205fcd6cd9100),
+     W(0x0000b6a74be98604), W(0x0007bf60eb17fb77)},
+    {W(0x0001355aa211bf5f), W(0x000634297419979a), W(0x0001865529ef1aa5),
+     W(0x000712dfc93567bf), W(0x000683140ba3af1d)},
+    {W(0x0000000000000001)},
+    {W(0x000491e66a351f0e), W(0x0002fc155e313a3c), W(0x000797ab41a9d128),
+     W(0x0000df7f224b0948), W(0x00031876a7f4fac4)}
+  },
+  {
+    {W(0x00053ff7d0dc7ffe), W(0x00025b31e1e7546e), W(0x0006869b74c5f345),
+     W(0x0000744cceaeae1d), W(0x000766a94fb10f85)},
+    {W(0x000019da0b7f16fa), W(0x0004bdee74aa95bd), W(0x0007b750b0afebfd),
+     W(0x0000e868f53240e7), W(0x0005d11d3be61fee)},
+    {W(0x0000000000000001)},
+    {W(0x0005ca4867bcd82e), W(0x0006ecf1cdefe417), W(0x0002cbfcbce8f2d4),
+     W(0x00077e814a7a0e60), W(0x000574c8bf517a0a)}
+  },
+  {
+    {W(0x000200921e01bba9), W(0x000122bcbb9addbb), W(0x00001fc0f6896eff),
+     W(0x0000faf311d45f22), W(0x0003d28ce3dcb995)},
+    {W(0x0002175b0b5ec691), W(0x000246ac9ad6fe61), W(0x00046dab702b86c4),
+     W(0x00030d04fa6af987), W(0x0005e3526ca68d12)},
+    {W(0x0000000000000001)},
+    {W(0x000182972664b7e0), W(0x000517007d69aba9), W(0x000577f2808d2ca4),
+     W(0x000789b9530aebe4), W(0x0007030625949d52)}
+  },
+  {
+    {W(0x000521a73c21b137), W(0x0005eccbe836e498), W(0x0000d0fc541e944c),
+     W(0x0006df58cf8b0e76), W(0x000713f52a69e5e7)},
+    {W(0x0006c2c515d26d3a), W(0x0003b4f37cfd1d09), W(0x000419e373a085c8),
+     W(0x0002040ba2df8f25), W(0x0002907f2de71e19)},
+    {W(0x0000000000000001)},
+    {W(0x00079d3e0fa4558c), W(0x00004e2de2d077e8), W(0x00018d411da0fcaa),
+     W(0x0006cfa19f635245), W(0x0000e9954b3a259c)}
+  },
+  {
+    {W(0x0001d84c2a983a78), W(0x00020889a1b02b08), W(0x000617249def419d),
+     W(0x000271419326bd7d), W(0x00062376b816f545)},
+    {W(0x000458d67f9766c1), W(0x0000abf121ba767e), W(0x000673399e96a8bb),
+     W(0x0007d21f34973736), W(0x00006f1009d493e5)},
+    {W(0x0000000000000001)},
+    {W(0x000594aefd5d99ae), W(0x00019dffd98e10b3), W(0x0006b0c2655fda37),
+     W(0x0007360f10cf3f83), W(0x00003bfa4b124bd8)}
+  },
+  {
+    {W(0x00039f415aa39ffd), W(0x0000ca06ccb4c4a0), W(0x0007d16768dcb756),
+     W(0x0001cf2df863fc2d), W(0x00070f95bbb0276c)},
+    {W(0x0007b824e3e696aa), W(0x0003823ea9679d0a), W(0x00007a15ef3dbf2a),
+     W(0x0002b4c575e11299), W(0x0002e2ff05c05c58)},
+    {W(0x0000000000000001)},
+    {W(0x0005a4be8bb1a3da), W(0x0003a96120b9ed6b), W(0x00008c5062022df8),
+     W(0x0007b3e715f7a5ee), W(0x000459df97866587)}
+  },
+  {
+    {W(0x000232d4fec92032), W(0x0004b2225f84102e), W(0x00073cfe5a16c1bf),
+     W(0x0003a978054152ee), W(0x00017e2238164b2c)},
+    {W(0x00001e4c0842c06f), W(0x00056e108f4a460c), W(0x0006a50aa99f6551),
+     W(0x0002f873f018df28), W(0x0001157ce93ca1f8)},
+    {W(0x0000000000000001)},
+    {W(0x000228d5efb005d3), W(0x0003a69a78f0f3e7), W(0x00051b1dc7c412eb),
+     W(0x0006938164c2b77a), W(0x000610889b4e638c)}
+  },
+  {
+    {W(0x0006c7c0160e576c), W(0x00001506f383cf25), W(0x00068fd69f6853f4),
+     W(0x0001b4c533b22097), W(0x0005e4b8b507a48e)},
+    {W(0x0002880029cf871b), W(0x0006592416d12fdf), W(0x00015a680dca05cc),
+     W(0x00032a7b82f3bd19), W(0x0005db313f771c52)},
+    {W(0x0000000000000001)},
+    {W(0x00057fa2aaa574b5), W(0x0001af6111ef91d6), W(0x0007661f37997a66),
+     W(0x0003749120158936), W(0x0007ca25e33d86e0)}
+  },
+  {
+    {W(0x0006d99393bc4934), W(0x0005835417134deb), W(0x00015c82af501f68),
+     W(0x00016812a54d3396), W(0x0001ff6869dfb813)},
+    {W(0x000259b0e9ec0cbe), W(0x0003ab94140ae4f1), W(0x0007549b53eaf2ee),
+     W(0x0006a57252340e8b), W(0x00079bcf149b731f)},
+    {W(0x0000000000000001)},
+    {W(0x0002bbde343afcd2), W(0x000141ff8ba76baf), W(0x0004318539cf2a7d),
+     W(0x00020b884bb3aa5e), W(0x0000200716f98cbf)}
+  },
+  {
+    {W(0x0007fbc6703dd503), W(0x0005c9d1d861cd40), W(0x00051d9a3e2c65c1),
+     W(0x00027e000ed5d005), W(0x000530aa777f8f39)},
+    {W(0x000359bb8aaf71de), W(0x00007a58c77a94a5), W(0x00057e147c49a98d),
+     W(0x0006031a4d4b02ac), W(0x000740e461f76962)},
+    {W(0x0000000000000001)},
+    {W(0x0005d12e82737372), W(0x000673f9f52be6a0), W(0x000108b63882d497),
+     W(0x0007a1e1eac4e796), W(0x000762df3e84662f)}
+  },
+  {
+    {W(0x0006c3baa7b937d7), W(0x00043f63771cdfcd), W(0x0006aa4b86449b0e),
+     W(0x0004605856230e48), W(0x000084a68d4fd62d)},
+    {W(0x0004796e19c455ca), W(0x00046d6323df09e9), W(0x0004c61770aaa3f1),
+     W(0x0006da3d3162f953), W(0x0007327b40d6b730)},
+    {W(0x0000000000000001)},
+    {W(0x000707fc7f8ac4d5), W(0x00014aa918515123), W(0x0007173200ddda5d),
+     W(0x0003235022b2c315), W(0x00068013e10ff301)}
+  },
+  {
+    {W(0x000555424c73f45c), W(0x0004f4dd9940a069), W(0x0005a548e2e6be0e),
+     W(0x000242cb6832e738), W(0x00076cc4932a6808)},
+    {W(0x0001199e6dc02742), W(0x000688caca2f766f), W(0x00019a04081cb1ff),
+     W(0x00064d6e0daf656f), W(0x0005493075e480c7)},
+    {W(0x0000000000000001)},
+    {W(0x00047d3c51bfd1d2), W(0x0004d91f685ee119), W(0x0003c71890722946),
+     W(0x0004f574d14bb773), W(0x00051d1889962d4a)}
+  },
+  {
+    {W(0x000026defe8855a6), W(0x00028331b735fdd7), W(0x0002130042da45b5),
+     W(0x00015aed3d8e8266), W(0x0003ab6d6e7caf58)},
+    {W(0x00076c557778e463), W(0x00001da92bc8231a), W(0x000663bc10a046a3),
+     W(0x0006625c1ccb116d), W(0x00010b7083acc5ac)},
+    {W(0x0000000000000001)},
+    {W(0x0003938893db6db1), W(0x00068f02166c1e6b), W(0x00064b89e3c91a5c),
+     W(0x0006d44ca1f158c8), W(0x0004773af77a1ca1)}
+  },
+  {
+    {W(0x00070b40984dfb6a), W(0x0007369e234cda2d), W(0x000209cdba8fd96b),
+     W(0x0007fc02298e1671), W(0x0001c8bcc550c458)},
+    {W(0x000748a28d43f3e4), W(0x0002a4387e8a8f61), W(0x0006e743ca6cbc44),
+     W(0x0005b6986c0c53c3), W(0x0002ce0c529295e8)},
+    {W(0x0000000000000001)},
+    {W(0x0002cba32eb7b54b), W(0x000317d2fd2e3a14), W(0x0005a6ba0726459e),
+     W(0x000470ac10106a99), W(0x00040e483af6b490)}
+  },
+  {
+    {W(0x00026d51a3073e27), W(0x0007c064c5e2e35b), W(0x00041441176414c9),
+     W(0x0006eb7ced1c64d3), W(0x0004428f11c665ee)},
+    {W(0x000472324a4c209e), W(0x0007794d3373877d), W(0x0004eeb63a885ee6),
+     W(0x000432a4c79a678c), W(0x000151103a24c560)},
+    {W(0x0000000000000001)},
+    {W(0x0004cad9fabc6bdb), W(0x00066022730a8497), W(0x0003b5901a925161),
+     W(0x00060f55a0efac12), W(0x0007a642d3f1edae)}
+  },
+  {
+    {W(0x00069db60f1f6a60), W(0x0006f16194dbc2e1), W(0x0005ecfb7ce343a6),
+     W(0x0005068fe4e4e398), W(0x0000823e1dc8f276)},
+    {W(0x000643dcaa0316f9), W(0x00061e6d844b8150), W(0x00049e88033b3980),
+     W(0x00014bc587d6cf33), W(0x0006eb9a681630c5)},
+    {W(0x0000000000000001)},
+    {W(0x0007820d2bcf54c1), W(0x00076106e89251d1), W(0x000501b46e700244),
+     W(0x0001ad6bee9b02c0), W(0x0003873c9d9b3e76)}
+  },
+  {
+    {W(0x0003adfe12eedad8), W(0x0005a8575944382b), W(0x00004ae56f5d7085),
+     W(0x0006529f73415cff), W(0x00060fb998be6932)},
+    {W(0x0005f4d1561306b1), W(0x00049cad5b5936ef), W(0x00038eccbcc68cd5),
+     W(0x00079997bf57b673), W(0x0002f6f6199e2915)},
+    {W(0x0000000000000001)},
+    {W(0x0007edd6b1e2f480), W(0x000137f3ba67d485), W(0x00040cfd432160c6),
+     W(0x00072ea8c63229a1), W(0x000689c5ed52bb49)}
+  },
+  {
+    {W(0x00016c20e349b743), W(0x00015518ddc1e3ab), W(0x0007570cec516a23),
+     W(0x0003d8b583ebbd89), W(0x00030ed5ad7f577e)},
+    {W(0x000732a3117daafb), W(0x00073b6f8d82ef98), W(0x00070ac88750e0e8),
+     W(0x0005d22baa69ffcc), W(0x0006568166f5868a)},
+    {W(0x0000000000000001)},
+    {W(0x00059c4cf1165139), W(0x00063695b713247a), W(0x0001ea852e8dc85e),
+     W(0x00040310d4dbbfbc), W(0x00034e5019f2c1ef)}
+  },
+  {
+    {W(0x0007d56f831e51d9), W(0x000572a276415a46), W(0x000754b44817041a),
+     W(0x0004308fb7f31e4f), W(0x0004f10feeaea176)},
+    {W(0x000324c864e35b56), W(0x00007b6dc0b78a2f), W(0x00026654a28cc742),
+     W(0x000171940f78056c), W(0x0003062371fb6891)},
+    {W(0x0000000000000001)},
+    {W(0x00022187fe5d6dff), W(0x0002e1a44fb5719e), W(0x000663d7e3c9f010),
+     W(0x0007ba6206025d0f), W(0x0006eadd1b1e9eb4)}
+  },
+  {
+    {W(0x00037b1e0a9f1779), W(0x00006d86f271f5d5), W(0x0000cad6ad3f6baa),
+     W(0x00038f88e74f3f6a), W(0x00029c6276ff0393)},
+    {W(0x00060beccd9f6b0e), W(0x0001a4ce9866ddc5), W(0x00035ceeed6e0189),
+     W(0x0007f96f82b24d16), W(0x00077964b59f1d31)},
+    {W(0x0000000000000001)},
+    {W(0x00074f67bea829b7), W(0x000084f70e6f4df1), W(0x0005c294601f396f),
+     W(0x00078ba2171bbf8b), W(0x00036f21d7095d96)}
+  },
+  {
+    {W(0x0000a7693a8f9050), W(0x00075ee5a23af760), W(0x00009ac09a5277ce),
+     W(0x0001ea0d255c4852), W(0x0006499d55c075bf)},
+    {W(0x0001a41dc6b9b67a), W(0x00037ea997e9f2aa), W(0x00012d7bede0588c),
+     W(0x000032524027ebbe), W(0x0002d14f3cf297ff)},
+    {W(0x0000000000000001)},
+    {W(0x00062c4d733fa96c), W(0x000289943c52f8e2), W(0x00061cbf4c6c1ca0),
+     W(0x000504e9747caf58), W(0x000605ca68383787)}
+  },
+  {
+    {W(0x0007c733c4ca3d5f), W(0x00000a03355a56ad), W(0x000465c846ffb7d0),
+     W(0x0000c59f76a54574), W(0x0002b3c3a58a2c34)},
+    {W(0x0005cff282fb82cd), W(0x0006fd4e00af83de), W(0x0007ac0978fcb1c7),
+     W(0x0007c8e9a86d6d5d), W(0x0002c893ab8ce9df)},
+    {W(0x0000000000000001)},
+    {W(0x000775dfe9d8200d), W(0x0005fc546fd8dfa7), W(0x0000900e668fdcba),
+     W(0x00060a0d13808797), W(0x0002c9aada1257c5)}
+  },
+  {
+    {W(0x0006412843471652), W(0x00031e4f417d6503), W(0x000279e8040428ec),
+     W(0x000697cd88a00bf7), W(0x0007c2e0f4d329e2)},
+    {W(0x00000b7b1ef633bd), W(0x0002cf961ec3f955), W(0x0003d9f72d14e2e8),
+     W(0x00000a6ed1a68cee), W(0x000051dfe253a5ea)},
+    {W(0x0000000000000001)},
+    {W(0x0002746d5af62c1c), W(0x00001a81b9dc1a67), W(0x0005944124b6c5e7),
+     W(0x0002b9e83cbc02d0), W(0x0006f83eec8e89a1)}
+  },
+  {
+    {W(0x00056d28a488960c), W(0x000758c72b904073), W(0x00020329b664cba6),
+     W(0x00054336d997af83), W(0x000365463ea8502a)},
+    {W(0x000243a9e58f30d8), W(0x00040b9e6255e462), W(0x00000079f8b1fb7d),
+     W(0x0007c1d7f2e0d6e6), W(0x0001dc15cb5fcf2c)},
+    {W(0x0000000000000001)},
+    {W(0x0001611fd5daef52), W(0x00056a34c3f2d398), W(0x00064c735029246c),
+     W(0x00063e1666f9d641), W(0x000256bc40baab31)}
+  },
+  {
+    {W(0x0006c7d3c177dadd), W(0x00024a1c4d35503f), W(0x000086474c761c0b),
+     W(0x0003379f7258a310), W(0x000763b70b5720bf)},
+    {W(0x0000c4d9065cb647), W(0x000340c86d886db3), W(0x000397b33fe3498d),
+     W(0x000258b4507fac70), W(0x0001ff0886bf6a87)},
+    {W(0x0000000000000001)},
+    {W(0x000123adb881731c), W(0x0005968be1b78a30), W(0x00053d8785e31a95),
+     W(0x00031c65e6bb8d6e), W(0x0005faef9635d005)}
+  },
+  {
+    {W(0x0005af5bc1935f60), W(0x0002106d48550ff1), W(0x00007d03598129a6),
+     W(0x00031f7f8877a245), W(0x0000078890ff158b)},
+    {W(0x000363dda6248293), W(0x0003650acf67c867), W(0x0003a0aafddbb4f3),
+     W(0x000359010d491323), W(0x00019ef6aa779579)},
+    {W(0x0000000000000001)},
+    {W(0x000187f19d2ca748), W(0x0000feff7e22ec96), W(0x0004b5fb5f4aeb2e),
+     W(0x0003da361f350478), W(0x00061fc4bb5b7456)}
+  },
+  {
+    {W(0x000119b9149c5c98), W(0x0000d90fd1622252), W(0x0004c1dfdab8429c),
+     W(0x0003fa83397ca173), W(0x00077c86fffc20b5)},
+    {W(0x000336d596a92d2b), W(0x0002183be56194fd), W(0x000572720f4e40c1),
+     W(0x000271f7a6963fce), W(0x0001069dbbc468e9)},
+    {W(0x0000000000000001)},
+    {W(0x0003d8824975954e), W(0x0001a2c08be7d437), W(0x00057ab16170f010),
+     W(0x0003c732bd032be0), W(0x000049d0741a73a4)}
+  },
+  {
+    {W(0x00062ad3be1d97ca), W(0x00000f56a0f1fac7), W(0x00056354f5a1390f),
+     W(0x00070065f4d821c8), W(0x0001ceb63e847e74)},
+    {W(0x00010908289b90b3), W(0x0006f828cee78ddc), W(0x000758d0d9f5f2b9),
+     W(0x0007032c56a4eceb), W(0x0002132b073b95a2)},
+    {W(0x0000000000000001)},
+    {W(0x000046f608672a36), W(0x000568d41fc297db), W(0x0000b488906390b7),
+     W(0x0003349d2b5e4c5a), W(0x00018e3e11c5493e)}
+  },
+  {
+    {W(0x00050a4659af4f62), W(0x0005cb9cfe5f7efe), W(0x0006050edb28e82e),
+     W(0x000387b25ff201cc), W(0x000624749052753e)},
+    {W(0x0004b7f360be4c09), W(0x0003f22bae42e7c4), W(0x00063e1cffa0feb3),
+     W(0x000507ecee2de8a5), W(0x00028ebdaa400fee)},
+    {W(0x0000000000000001)},
+    {W(0x00007cf91cab768a), W(0x0001b791b6fce6f7), W(0x0004e486113ceb8d),
+     W(0x0000c148723c21c1), W(0x0002d6b83f4d6b5f)}
+  },
+  {
+    {W(0x000625084858caad), W(0x0001621c6018db3e), W(0x000748adb4b2ee0c),
+     W(0x0005ebf5a9cc24d4), W(0x0005e6d762b6146c)},
+    {W(0x0004d78aa21b41d3), W(0x0007701671d4dcc5), W(0x0006398de33e7e65),
+     W(0x00006da297ef72b1), W(0x0006821ee3fbd5f9)},
+    {W(0x0000000000000001)},
+    {W(0x00042aff8104fa76), W(0x000203ac42c7fe50), W(0x000370a8daf9e5c4),
+     W(0x0004123b1f7f395c), W(0x000128a6a2f86b2e)}
+  },
+  {
+    {W(0x00039a51bbe41fd9), W(0x00035c95f0ae68f3), W(0x00034d8b7c0f29cb),
+     W(0x0001da6a9e798498), W(0x0002bb879557e55f)},
+    {W(0x0000ea81add05727), W(0x0003b9442809c7b1), W(0x0007b433760e7b27),
+     W(0x00006644905cf6e8), W(0x0000cd6d5488bd11)},
+    {W(0x0000000000000001)},
+    {W(0x0005c696f547c4b5), W(0x00002d6dbc785512), W(0x0007f26d24369b63),
+     W(0x0005c1f4f5b9077a), W(0x00033cd2a9a7b79b)}
+  },
+  {
+    {W(0x0000129d86fa5ccb), W(0x0002f3f5dbd4d6fd), W(0x0002927b2b8bec2a),
+     W(0x000279a3b7d78dda), W(0x000256218724b35f)},
+    {W(0x000467067fe59fcb), W(0x0007ab5d0d0d1092), W(0x000108bde4c5e5fb),
+     W(0x0003bb12b11cad71), W(0x00064b9cf28bd50c)},
+    {W(0x0000000000000001)},
+    {W(0x0000a5615acdaf30), W(0x00064153e7cf88dd), W(0x0001242b44bb4ed2),
+     W(0x0003758d9f241ab2), W(0x000255a9feba756e)}
+  },
+  {
+    {W(0x0004ebba30acec8d), W(0x0004c383cb335992), W(0x0003793fda7cd31d),
+     W(0x00059b7d50791207), W(0x0005a3f7430bec8c)},
+    {W(0x0005849093e775b5), W(0x0006e9f54000bc2c), W(0x0000830817fb1ef5),
+     W(0x00015738fc51eaf8), W(0x00005d33fe453d5f)},
+    {W(0x0000000000000001)},
+    {W(0x0007e2f591188692), W(0x000720409797ad2d), W(0x0007e5c3fc5027ae),
+     W(0x0000373d669dc45a), W(0x00013fcefcb84bf0)}
+  },
+  {
+    {W(0x0004e342e197f3d4), W(0x00042abee7d895c1), W(0x000416f3f801738a),
+     W(0x000786db2946f6cf), W(0x00016a6c8bf90138)},
+    {W(0x0003b4ccac80849f), W(0x0004f6535670ac8e), W(0x0007f56680733a39),
+     W(0x00024d22102d3f3f), W(0x0002dc9a57628ca5)},
+    {W(0x0000000000000001)},
+    {W(0x00076f8db5c97186), W(0x0006760de1418e7c), W(0x0006847dd8af193b),
+     W(0x0004e32b2ec21157), W(0x00030e76ad3df90f)}
+  },
+  {
+    {W(0x00004cb12763018f), W(0x00037742acfd290c), W(0x0001c020c303ca04),
+     W(0x00078791c5e2a5c1), W(0x0007b65008c45020)},
+    {W(0x00058916c913d829), W(0x00078a690df62690), W(0x0000160fb81fc342),
+     W(0x00046ea019cff28b), W(0x000099b26016ad08)},
+    {W(0x0000000000000001)},
+    {W(0x00032f3c5e669491), W(0x0005f5cda829320c), W(0x00054a172f7d134a),
+     W(0x00078ed5d5479d69), W(0x00008c10198c9044)}
+  },
+  {
+    {W(0x0003c150b7227feb), W(0x00004908bf74d0d8), W(0x000399b81e1788d7),
+     W(0x00070e274ad470be), W(0x000623f912e8678c)},
+    {W(0x000514d17f3b44e6), W(0x00066e7b8741becb), W(0x000470ad31998e7a),
+     W(0x0005febf86f94b69), W(0x000742a2f550adbf)},
+    {W(0x0000000000000001)},
+    {W(0x000546d88a07249f), W(0x0002474ad149020f), W(0x0000dd7551f57053),
+     W(0x0005e343adecbeda), W(0x00070b1247f77ac9)}
+  },
+  {
+    {W(0x00019d7568bb871b), W(0x00066e66532c604d), W(0x00051edf4881e626),
+     W(0x00037bc47666bf4b), W(0x0002458344367d7d)},
+    {W(0x00041a390b5d82cf), W(0x00040df5b4dfee89), W(0x000783be85f91abc),
+     W(0x00022259ee6f9112), W(0x000491c9df3437d1)},
+    {W(0x0000000000000001)},
+    {W(0x00001ec752e85d27), W(0x00033c0ec9e59ded), W(0x00039e089728ebc8),
+     W(0x0004a0558a0675a0), W(0x00016acd515dfebc)}
+  },
+  {
+    {W(0x000237a35b4b7171), W(0x0000245bc7cd7b89), W(0x00032bfb0b778120),
+     W(0x0007771c2f37ac1f), W(0x0005ec106faaf749)},
+    {W(0x000017205ac5757f), W(0x0000eb7797e0b604), W(0x00012c83c5707c9f),
+     W(0x00016c0208c02f26), W(0x00041b7395e85db8)},
+    {W(0x0000000000000001)},
+    {W(0x000659aa0236c89e), W(0x0007e0501a73516b), W(0x000243ea51b8ed4f),
+     W(0x0000f6c618a7499c), W(0x0006e3f014f89880)}
+  },
+  {
+    {W(0x00013153621485dd), W(0x0002128ff197c8f9), W(0x000607173c64a785),
+     W(0x000396dce3a6e1b8), W(0x00039a0c6b4c0568)},
+    {W(0x000580e9eb00b01a), W(0x000675edc51b460e), W(0x00030d4d2314b299),
+     W(0x00003ec4be669c22), W(0x00049f49e0486728)},
+    {W(0x0000000000000001)},
+    {W(0x0005b5ab75a704a9), W(0x0002d5499e8ee85c), W(0x00006f86e96d446f),
+     W(0x0002ad1453ffb0c8), W(0x00033f66da72ba1f)}
+  },
+  {
+    {W(0x0001431eb7c1511b), W(0x0007e88f835a4af1), W(0x00049d358afde60e),
+     W(0x00032e006a5a852d), W(0x0001073af2c87196)},
+    {W(0x000111eb88fde133), W(0x00055f689d24b050), W(0x0000cbd4fa0e2a6f),
+     W(0x00072e08d09a6fd6), W(0x0005bd0c7d5869f0)},
+    {W(0x0000000000000001)},
+    {W(0x0001afd55653e8a0), W(0x000010674fec99be), W(0x0006819d83298566),
+     W(0x0004c49a7be2f394), W(0x0006e2adf947fccf)}
+  },
+  {
+    {W(0x000219652b46a697), W(0x00064d6723020ea5), W(0x0003eda17eba6dad),
+     W(0x00020fc0e2b3313e), W(0x0006763494dcb9c1)},
+    {W(0x00043942c38c8921), W(0x00033c144ce2d591), W(0x00031df9138d507d),
+     W(0x00006ca6fb150ff0), W(0x0007607e495cb71f)},
+    {W(0x0000000000000001)},
+    {W(0x000769d21719e419), W(0x00035c309972efa4), W(0x0000e2125eddd836),
+     W(0x0002f4618c3557d3), W(0x0004138c1d6ecd0f)}
+  },
+  {
+    {W(0x0004e6078402a2d8), W(0x000267d4a4f6c214), W(0x0002e968f2e5bc52),
+     W(0x00020920a9b1cd83), W(0x0000722b59a1adfd)},
+    {W(0x000557a9c723e9a8), W(0x000091f5b2d837bb), W(0x0001623760ae2f68),
+     W(0x00055e1814571861), W(0x0004453fd67e8f19)},
+    {W(0x0000000000000001)},
+    {W(0x0004dcd4e18d0bb1), W(0x0003b59c0a00b52b), W(0x00035782954df801),
+     W(0x0007faab411804c9), W(0x0005cb9928907bd9)}
+  },
+  {
+    {W(0x0002e2cf34154ec5), W(0x00033c7b1a025b51), W(0x00021b95dc90b966),
+     W(0x0005d7f71074cc0a), W(0x000298bfd052837e)},
+    {W(0x0001d017c722ba70), W(0x0002ed80f6a23847), W(0x0000848f16c4c750),
+     W(0x0005e8fcb486669c), W(0x00073949aa43566c)},
+    {W(0x0000000000000001)},
+    {W(0x00044f502ec7916a), W(0x00075a21e72d6908), W(0x0004c0f2a840442c),
+     W(0x0003e9721c1a5bde), W(0x00057e0d2f40ab07)}
+  },
+  {
+    {W(0x0005e12261cf6def), W(0x00029b903033a069), W(0x00062c342940015d),
+     W(0x0007461bdc5ea7bb), W(0x0007b2cab6e5e824)},
+    {W(0x000062cd6104f990), W(0x0000c875c2279413), W(0x0003fa5d443f68af),
+     W(0x00078700551b3c5e), W(0x0005e8ca4591fada)},
+    {W(0x0000000000000001)},
+    {W(0x0004f113ca38f3ff), W(0x00006908a980ba5b), W(0x00072ee6c80a6bd4),
+     W(0x0002a35d7ef148f3), W(0x0005e89c1da2c35d)}
+  },
+  {
+    {W(0x0006910ac92aa7c1), W(0x0005225e03531749), W(0x0002b14cc93092df),
+     W(0x0007b38912d2cd67), W(0x000169457bfbb97b)},
+    {W(0x0003bf6bf1bd5758), W(0x00024a2f724c24c7), W(0x0007f44c555bbef3),
+     W(0x00034ded48a01ee6), W(0x0006f9f1c51e1946)},
+    {W(0x0000000000000001)},
+    {W(0x000491ee8dc04112), W(0x0003a7afd0314303), W(0x0004c51c80d954ab),
+     W(0x00052010970d274c), W(0x0002a8bb06df30d6)}
+  },
+  {
+    {W(0x0002f525a0f80ba8), W(0x0001f0eefa5cb97d), W(0x000450b89c8c11dd),
+     W(0x00026ab498c89cbb), W(0x0000bcf353f6397c)},
+    {W(0x0003bd4a8ac70a26), W(0x0005878ad1d59d08), W(0x0006651b98ef2c14),
+     W(0x00052c9d25ae32d5), W(0x0005f42cb13c79ab)},
+    {W(0x0000000000000001)},
+    {W(0x0001ed55a9bc41b1), W(0x0003c794b910c3a9), W(0x0003a12ffad74416),
+     W(0x0004d473602100f4), W(0x000017b3cf4c95c7)}
+  },
+  {
+    {W(0x00045b574cbe3703), W(0x000546785e7412e8), W(0x00024a9e309fdf12),
+     W(0x00079b43c7f88593), W(0x000183771d85fea0)},
+    {W(0x00011164b20f4608), W(0x0002dbb7a7519fc3), W(0x000134723f98db4c),
+     W(0x0003ed59435fac74), W(0x00029821e99c41ea)},
+    {W(0x0000000000000001)},
+    {W(0x00016f0fbf3d1ec1), W(0x0005ad15ffd838f8), W(0x00010ac57128a302),
+     W(0x0006080911e6ce5d), W(0x0004735d4600f8b2)}
+  },
+  {
+    {W(0x000075b8d982ff25), W(0x000124b0802f6577), W(0x0001a1fc22076838),
+     W(0x000745b26678f58a), W(0x0007a4b03f0ef59d)},
+    {W(0x0003b315862c5712), W(0x0003ac1c45f897a2), W(0x0005fb39d5dc2b2c),
+     W(0x00049e5f60cf9f5d), W(0x000062beac8ba48f)},
+    {W(0x0000000000000001)},
+    {W(0x0000bdeb2da3e192), W(0x00014520fc9bfdde), W(0x000729189834f7f8),
+     W(0x00016f7deb82110b), W(0x00051734fb992ca1)}
+  },
+  {
+    {W(0x000634c88ad32c6b), W(0x0001bc9de9b340bb), W(0x0003d105d0ba9472),
+     W(0x000121404536d4be), W(0x0003e7b4319a4e35)},
+    {W(0x0002bf474b7c25a7), W(0x000577676d194ffb), W(0x0002793f01765251),
+     W(0x000402994bbc1cdf), W(0x0006edf497505454)},
+    {W(0x0000000000000001)},
+    {W(0x0000046cfba6be2d), W(0x000652e133bd5033), W(0x0005098c838c40ec),
+     W(0x000436e23328c309), W(0x0002b3b5adc70412)}
+  },
+  {
+    {W(0x0007977a89056657), W(0x0001073adece5519), W(0x00057b996cfa23af),
+     W(0x000682d06955f5df), W(0x00077c62ec6c1281)},
+    {W(0x00012168cf259ecb), W(0x0001884b75a83431), W(0x000309db117038be),
+     W(0x00015553c82b2be6), W(0x00020d39e9b87213)},
+    {W(0x0000000000000001)},
+    {W(0x0002867b08718ae5), W(0x00079d694f3e0c14), W(0x00039bc3f435a547),
+     W(0x0007d5f2ccb92f61), W(0x00025a50811e001c)}
+  },
+  {
+    {W(0x0000780f54725c45), W(0x00036b56aefc10ce), W(0x0005665687130ca8),
+     W(0x0006123e25f79ce1), W(0x00004ed3b5e9ec50)},
+    {W(0x00046088fc52b24b), W(0x00027160df2c1f48), W(0x00059189ef7a6c3a),
+     W(0x0004f5e20f8cd1ed), W(0x00040bb48294f42b)},
+    {W(0x0000000000000001)},
+    {W(0x00012d242b50b22c), W(0x00026d317c9839ad), W(0x000506493be29fdd),
+     W(0x0001c6a032c9faf6), W(0x0006e09ca2cf0d68)}
+  },
+  {
+    {W(0x00005f8a4a4399ac), W(0x000705a02fa5eda8), W(0x00075115715422ab),
+     W(0x0007fdedf7b4ad8b), W(0x00028448b2f7768e)},
+    {W(0x0001e2f624183190), W(0x0003480b521f3a8a), W(0x0007899cd85bd186),
+     W(0x00002b3196aa92b0), W(0x0006f94c35f2ed68)},
+    {W(0x0000000000000001)},
+    {W(0x000379233690cdec), W(0x0001b6473070f460), W(0x0006c16b75e703c9),
+     W(0x00016db6ab47420a), W(0x000035b040d4d9ad)}
+  },
+  {
+    {W(0x00060f18ec9bb919), W(0x00061439f39a76aa), W(0x00058854ec020ccd),
+     W(0x0003cfddecc97765), W(0x0002ec244de4fd4f)},
+    {W(0x000502707b13703d), W(0x000681910660753d), W(0x0005dbc4f13ffa4f),
+     W(0x00075819f91e6b3a), W(0x0006a34131348c69)},
+    {W(0x0000000000000001)},
+    {W(0x0005bc25f81c83f3), W(0x0007b5e6d7c63d12), W(0x0001cf3b69da3205),
+     W(0x00021b6e5aab20be), W(0x0002c493a6d1bc84)}
+  },
+  {
+    {W(0x00038588f3164723), W(0x0000dc92290d68a1), W(0x0005eec83dae862d),
+     W(0x0001d15b89ef86db), W(0x000224e769b920e4)},
+    {W(0x000736b8d2fa3cc8), W(0x0002a8b56b9f0703), W(0x0002719b4a0aebcd),
+     W(0x00036ab431e9e6de), W(0x0001558590936f5e)},
+    {W(0x0000000000000001)},
+    {W(0x000433149f49a113), W(0x00014f4ff34af3a1), W(0x0006789f71ebbaa1),
+     W(0x0007a2164847583d), W(0x0001bd9b7962cdab)}
+  },
+  {
+    {W(0x0004d51d1bd6c867), W(0x00069e9d319df128), W(0x00077fd7f655aa9e),
+     W(0x0004f317d1b6cfca), W(0x00054f6a96268acd)},
+    {W(0x000245bd6042e2c6), W(0x0000a8f1851ef55f), W(0x0001f3656b8fbf81),
+     W(0x0002795228e7dac6), W(0x000192f21a5b0a22)},
+    {W(0x0000000000000001)},
+    {W(0x000079aa54bdc524), W(0x0003637416a970dc), W(0x0000a26d083b67f9),
+     W(0x000473cc7f07fd95), W(0x0005da548ce76d67)}
+  },
+  {
+    {W(0x0007039ff3c04390), W(0x0003763c8646a0f2), W(0x000266deb0574f84),
+     W(0x000136662ff59aac), W(0x0003c7ead5ffba5c)},
+    {W(0x0004e902d568c7fd), W(0x0006980ecc4e7e1e), W(0x0004f2f3602c8520),
+     W(0x00066393df1ea231), W(0x0003f227ffa72da3)},
+    {W(0x0000000000000001)},
+    {W(0x00016d6602c8e97e), W(0x00023ed55c094290), W(0x00060405b36cd472),
+     W(0x000795da74b49637), W(0x0000ed95d23936bd)}
+  },
+  {
+    {W(0x0004211d7ee9176a), W(0x000660f59e72355b), W(0x0007ba60eb8618d1),
+     W(0x00007cbea3b932ad), W(0x0000518686706ad6)},
+    {W(0x00023482caa27165), W(0x000621528ccbfe36), W(0x0006f0124377b825),
+     W(0x0006d9f345acf02a), W(0x000280c59badc0d7)},
+    {W(0x0000000000000001)},
+    {W(0x00057bfb6bbcc7b2), W(0x00011711b642898b), W(0x00064260291554cc),
+     W(0x0004e5f07dcfcc72), W(0x000111032135fab2)}
+  },
+  {
+    {W(0x00054bc4f2cc0a3f), W(0x00063bbf1791f4ca), W(0x00001b67163050ef),
+     W(0x0004a023d9646464), W(0x0006db67e01c640d)},
+    {W(0x0006591a529afdea), W(0x0007b365bf6fa249), W(0x0001b1155463a7a9),
+     W(0x000504d29798fac4), W(0x00021296369921d7)},
+    {W(0x0000000000000001)},
+    {W(0x0000130e0c3cf12f), W(0x0004a97c31831a7e), W(0x000000bf3eb2c29f),
+     W(0x0007a0e495b4be0b), W(0x0007ac98f492ab46)}
+  },
+  {
+    {W(0x00034cb7828636a3), W(0x00063813287450bf), W(0x00073d9a09272559),
+     W(0x00077782f7ab58c0), W(0x0004f6b856b751d0)},
+    {W(0x00056dfd4f4a5110), W(0x0006a963c2a96025), W(0x00057d8a001f012e),
+     W(0x0005c9385a230c1a), W(0x0001584cd91028ac)},
+    {W(0x0000000000000001)},
+    {W(0x0006347160cf2cfd), W(0x0000ac2d5174a5cf), W(0x000226e394f7f562),
+     W(0x00003583a00e8d8f), W(0x00009eae9f1ef978)}
+  },
+  {
+    {W(0x000004b728b9f4ec), W(0x0000b734b7c8b084), W(0x0001c90e5a1358e7),
+     W(0x00069cb237711587), W(0x0006b643156e99f3)},
+    {W(0x0007a4577c6df670), W(0x0004d666e00d2c15), W(0x0002bd4bf8014a00),
+     W(0x00050cce608c59fd), W(0x0000475b21e76192)},
+    {W(0x0000000000000001)},
+    {W(0x0001174843914c76), W(0x0005cbf83714cbcc), W(0x00071b6d72bec5c5),
+     W(0x00028c19215e9510), W(0x0002336e31060b96)}
+  },
+  {
+    {W(0x0006058c4754a82c), W(0x000508f94d5c34c3), W(0x0002964dbbd41c24),
+     W(0x000038be66f760b9), W(0x00027ce4fcf8327d)},
+    {W(0x000568d2ae097a77), W(0x0006f228c85e0305), W(0x0002b245c772658d),
+     W(0x0004387efb2546f5), W(0x0001412fc04bb818)},
+    {W(0x0000000000000001)},
+    {W(0x0004460774187052), W(0x00039c72e7c21012), W(0x000202c68b7cdfcb),
+     W(0x00055c7f5fefc924), W(0x000667e9d07ce3e2)}
+  },
+  {
+    {W(0x0003a1194acfaf1f), W(0x000374c61e42d7fa), W(0x000098755943874b),
+     W(0x00067e32df0005c5), W(0x0001068c0fcfe213)},
+    {W(0x0004055f9d182ecb), W(0x0001f06c19680e90), W(0x0004cd9d3a15308c),
+     W(0x00025c08b3957d0f), W(0x000681874ea29b32)},
+    {W(0x0000000000000001)},
+    {W(0x0005b297d5446c84), W(0x0003dad048371083), W(0x000584e0f1e7f834),
+     W(0x000790820e74c7ed), W(0x0006689ecc8690c8)}
+  },
+  {
+    {W(0x0006b4e7433e6e90), W(0x000716711e9d8624), W(0x0006ee748ff04d25),
+     W(0x0000de114f1497c7), W(0x000371143631a731)},
+    {W(0x0004030e355a949c), W(0x0006a833259967d6), W(0x0006df5d253415ee),
+     W(0x00009639a568a08e), W(0x0006006c19c9673f)},
+    {W(0x0000000000000001)},
+    {W(0x00073be28960dfda), W(0x0002d94b72a7c4e6), W(0x000241f749e93b6a),
+     W(0x000297dfa58fb284), W(0x0007ce7556e02284)}
+  },
+  {
+    {W(0x00062e288ba39877), W(0x0005acb7a5b04f6a), W(0x0007ba70d1621b54),
+     W(0x0005504bbcb1f43c), W(0x0006ae3f70c45ba4)},
+    {W(0x000483b9ff6bb0a5), W(0x00006735054d42d0), W(0x0005edfad21993fa),
+     W(0x00076eee9c0398d7), W(0x0004cead6f6064f2)},
+    {W(0x0000000000000001)},
+    {W(0x0007c30dcbd5af05), W(0x0000f62a2adf9b1e), W(0x00001794663701b8),
+     W(0x00073efd1b2b7e13), W(0x0007c1caac53c6b8)}
+  },
+  {
+    {W(0x00015e2a27378002), W(0x0005355ee97e915b), W(0x0003ad8c5c6ecf26),
+     W(0x0006d45ae37ba7cf), W(0x0003f81f9ba22fd5)},
+    {W(0x00017a0d20dad101), W(0x0004c4ca1cf446de), W(0x00052819c5134568),
+     W(0x0000cf852e47ad9e), W(0x000670301b47a549)},
+    {W(0x0000000000000001)},
+    {W(0x0005a0005e29983f), W(0x0005affd09b54443), W(0x0002b6918db8bc7f),
+     W(0x00043883c1ba5084), W(0x000457a60d2174ab)}
+  },
+  {
+    {W(0x0002369e9f6aca89), W(0x00068ee05b31886a), W(0x0005b2b5e0181c6f),
+     W(0x000533deb18478fd), W(0x0002663e4199b630)},
+    {W(0x000408e54b42fad5), W(0x00054d55855cabb0), W(0x00064873308cfdc6),
+     W(0x000171faddbd7c97), W(0x0007bbacd2d63618)},
+    {W(0x0000000000000001)},
+    {W(0x00041828d6710eff), W(0x00049284eeb058b6), W(0x0003cdcdf1d48fe0),
+     W(0x0001394be8adda3b), W(0x00044574c9bb4fb1)}
+  },
+  {
+    {W(0x000004e635fb7b22), W(0x0001e3317eb7a514), W(0x00003c41b030660d),
+     W(0x0000b5e26eb373e3), W(0x0002e32046aa6e51)},
+    {W(0x000324f0872320b7), W(0x00070a10c3493d5c), W(0x0004838b41a4048a),
+     W(0x0007068b487fb683), W(0x0001086ef1c3560e)},
+    {W(0x0000000000000001)},
+    {W(0x0006cb405ef06862), W(0x00048e00cbd0d856), W(0x0007585d5cc66e61),
+     W(0x0002cc897b053202), W(0x00025127dfe90d49)}
+  },
+  {
+    {W(0x0004d4d14caf8d10), W(0x00071c5963e3a3ab), W(0x0003521fb4e1c890),
+     W(0x000117780005f4a7), W(0x0002e667cc4eb1d1)},
+    {W(0x00073d2a2f32a65e), W(0x000406e0bf4ef16f), W(0x00042a3633bd82f6),
+     W(0x0003c880fe9829ef), W(0x00054856b2d3e9da)},
+    {W(0x0000000000000001)},
+    {W(0x0005d3ecffed4d39), W(0x0006054fad5cb090), W(0x00052331d7387f6c),
+     W(0x0007418f47d702d7), W(0x0005932338538962)}
+  },
+  {
+    {W(0x0000aa3082891629), W(0x00037a8e5dfb155c), W(0x0006abd986c13eb2),
+     W(0x0005039505fb28fd), W(0x0003b1fa91bf7658)},
+    {W(0x0002af21658b27ff), W(0x0005bf7a4cc695d3), W(0x0002be06fbdc6dd9),
+     W(0x0002b1b7d5aca478), W(0x0001cd644bff3109)},
+    {W(0x0000000000000001)},
+    {W(0x00016de2b260273b), W(0x0003c2ca03e0d12a), W(0x000119d29b964b8f),
+     W(0x0005ff6da064a187), W(0x0000181232c076a5)}
+  },
+  {
+    {W(0x00027eb5afa46ce7), W(0x0004f8af4e5c1007), W(0x0005dcb01bb51589),
+     W(0x0007b077cb23d5e7), W(0x0002772b3bc4faa0)},
+    {W(0x0002cc02c740087e), W(0x0003b34675abb363), W(0x0005c211dc814d8b),
+     W(0x00047e4ef430d8b8), W(0x0002f6252fadee95)},
+    {W(0x0000000000000001)},
+    {W(0x0006e1c4fcc8a182), W(0x00076593d700aea2), W(0x0007864b78dbddd2),
+     W(0x00072511071e2e9a), W(0x0000a44c996790a4)}
+  },
+  {
+    {W(0x00026dc3d6902554), W(0x000134c17d94c4fd), W(0x000431485b7d6c2c),
+     W(0x00039bb88cffced7), W(0x000099b0aac3e9c9)},
+    {W(0x00012c418011a344), W(0x0002cb5f375dd421), W(0x00062c943d95c6bc),
+     W(0x0002cc91b81f7b2e), W(0x0003837fd1952114)},
+    {W(0x0000000000000001)},
+    {W(0x0003b66c85a7d9f1), W(0x000421f019d5f4b3), W(0x0003e26d452b4bd8),
+     W(0x0000f75d964d22ce), W(0x0000ac1fc83656a9)}
+  },
+  {
+    {W(0x0002d9fa81b65950), W(0x00004ec21f09dc95), W(0x0002daa1e7357db6),
+     W(0x0002765d4fd3343f), W(0x0005b6eae06f4b52)},
+    {W(0x00026df58a83494a), W(0x0003ffe07421ecd5), W(0x00044fb5f381b0a0),
+     W(0x000209d47b6d77f0), W(0x000325730e63e319)},
+    {W(0x0000000000000001)},
+    {W(0x0007321cdd8e3d40), W(0x0000a99c5a89c249), W(0x0007877482cb55c2),
+     W(0x0002c8bbd0fec3b3), W(0x0000dfcb39ad6f02)}
+  },
+  {
+    {W(0x0001d1036207066d), W(0x0006d891e56f5bd7), W(0x000495340d337649),
+     W(0x0005c044b0990173), W(0x0003c955b428c337)},
+    {W(0x0007fdb000ea74af), W(0x000535e8dfd564b9), W(0x0002b853659f5f8d),
+     W(0x00028543ea607db4), W(0x00074ac08f511635)},
+    {W(0x0000000000000001)},
+    {W(0x000574515655271b), W(0x0007e3451844e937), W(0x000045fe9e5e0198),
+     W(0x000394417e58f9bf), W(0x0006c0669a3c44e3)}
+  },
+  {
+    {W(0x00000ce0a01cfb7b), W(0x0006c1441fc6e29a), W(0x00019f2ecd29f7d8),
+     W(0x0004f627ac682c04), W(0x000364b83287d017)},
+    {W(0x0002c3248ae94a40), W(0x0003cac0b34a622e), W(0x000294ff354600ec),
+     W(0x000144ec2f6f404c), W(0x00007b4f7397da92)},
+    {W(0x0000000000000001)},
+    {W(0x0006064ed78df0aa), W(0x0005b029ab76766a), W(0x0000ee60c4aa6a7b),
+     W(0x0002ae00c195cfaa), W(0x0007cd91877a9b5c)}
+  },
+  {
+    {W(0x00051e21d6a460d4), W(0x00056c4067a13070), W(0x00006aedd3f5ae53),
+     W(0x0006896990c7c5dd), W(0x00037f03bc01070e)},
+    {W(0x000705c5b3a30fd0), W(0x00005354278312c0), W(0x0001c57f1d5a04ec),
+     W(0x0006c711eb0a691b), W(0x0007858f9e76774e)},
+    {W(0x0000000000000001)},
+    {W(0x0001df4cd969a96c), W(0x0001633cf6c21c11), W(0x0002771c85e4e55d),
+     W(0x000225199a244d9c), W(0x00078450cea0ca1a)}
+  },
+  {
+    {W(0x0007fd5a0a4b2cd3), W(0x0000085c0e03a620), W(0x0004a8fe2d7c3b5e),
+     W(0x0003bff43fa6997e), W(0x0001f8c6833c2708)},
+    {W(0x00058c628f8d5f82), W(0x0005e04d06672ab6), W(0x000659ae359da1bb),
+     W(0x0002fbf99bee2869), W(0x0004520ad3141b0c)},
+    {W(0x0000000000000001)},
+    {W(0x0004e563b6611058), W(0x000061e97813b68e), W(0x0001005e500c3565),
+     W(0x0000deb18015e448), W(0x00015b6c077b2371)}
+  },
+  {
+    {W(0x000404a342a89351), W(0x0006bb34ccde5e59), W(0x0003a61f51eb85dd),
+     W(0x0004c6fc6aab066a), W(0x00021e4c8e17dc19)},
+    {W(0x000011302a4e72d4), W(0x0002c06af81d90ac), W(0x0001c76596fd3705),
+     W(0x0006796b3ef47b70), W(0x0003197e803663be)},
+    {W(0x0000000000000001)},
+    {W(0x0000dac37dec1a72), W(0x00013a67dbb1de6a), W(0x0005260fd5e0ea34),
+     W(0x00013d4dc56ee5fa), W(0x0001555045b726b1)}
+  },
+  {
+    {W(0x00010afdbb29fabc), W(0x00059016b5aaecef), W(0x0005c44a32f4fb2f),
+     W(0x000425afbaee5046), W(0x0001985bd313923e)},
+    {W(0x0001d9c4a02f448b), W(0x0006378053d296a3), W(0x00013c3ae4d48a3c),
+     W(0x0003bed543e2bbde), W(0x0001010ed18ce513)},
+    {W(0x0000000000000001)},
+    {W(0x00002e91a61b8331), W(0x0000e9df96b62331), W(0x00047325085fc4d0),
+     W(0x0002f677653585c6), W(0x00014e59f4e13549)}
+  },
+  {
+    {W(0x000481cf0786a0dd), W(0x00015baa730d80d1), W(0x00067b59a5601e78),
+     W(0x000270a4e0994fde), W(0x0006dacefe747f4c)},
+    {W(0x0007f40929449047), W(0x0004d25caad842ea), W(0x000349865928267c),
+     W(0x0003882f44eb3180), W(0x0003bbfa9f109ee0)},
+    {W(0x0000000000000001)},
+    {W(0x00023923cf45b289), W(0x0005e922a8a83c06), W(0x0000fd644c3f36f6),
+     W(0x0006b361432e7536), W(0x0002579179b9ef00)}
+  },
+  {
+    {W(0x0005462397ce96f1), W(0x00015142271c641a), W(0x0000761eddf18f2f),
+     W(0x0001d1c7e27f18fb), W(0x00019a1289f6470e)},
+    {W(0x00049cf684ef8aa5), W(0x0004c16d172e626c), W(0x000314a1680684f4),
+     W(0x000429a75d443131), W(0x0007f7c36de1c226)},
+    {W(0x0000000000000001)},
+    {W(0x00067ebaa040a1a9), W(0x0000ac7a617f36ba), W(0x000735a693d5c2c5),
+     W(0x00013952ab6a8688), W(0x0005ff910593c0aa)}
+  },
+  {
+    {W(0x0003eb6ca822e735), W(0x00078f396f5e64f0), W(0x0003a163c2b16cf9),
+     W(0x000211d8b9165a75), W(0x0007fcba491a64e7)},
+    {W(0x00043d45b6fc0b09), W(0x00019fe5c9e75279), W(0x0006cf65126432c3),
+     W(0x0005e7a53d530316), W(0x00056ab25a0c6d11)},
+    {W(0x0000000000000001)},
+    {W(0x00034161175d1965), W(0x00065c0aa0d3b99f), W(0x000665aa66a0aeb4),
+     W(0x00033c7c39f6b372), W(0x0004024e37659ecb)}
+  },
+  {
+    {W(0x0001a02c2ae387ff), W(0x0005f21d2b343dac), W(0x00033d0a850b37ab),
+     W(0x0003e9a523151da1), W(0x0001c793d7060fb6)},
+    {W(0x0007ce6a49b44ce3), W(0x000574be3943f8c9), W(0x00014c6a519712fc),
+     W(0x00072b7dc33e0763), W(0x0005291c27bf81c4)},
+    {W(0x0000000000000001)},
+    {W(0x0004658e4feba1f8), W(0x00064b1174ac5472), W(0x00033ca891709e36),
+     W(0x000297d1ac37f3cf), W(0x0003dd7d72ddf2b3)}
+  },
+  {
+    {W(0x0006f167984853dc), W(0x00056d138e80d7cf), W(0x00021012ac75ffe5),
+     W(0x00047cd14b3f2b27), W(0x000047b977706a6f)},
+    {W(0x0003f5f1d885baaa), W(0x0002ecf0a096029d), W(0x000153f0a1bac922),
+     W(0x0005d4e63b67ef3f), W(0x0006c111d28e3923)},
+    {W(0x0000000000000001)},
+    {W(0x000110a282fb7708), W(0x0007d67d60028832), W(0x0000ba9a77d1ec91),
+     W(0x0004a6bf5f36777d), W(0x00048203a9ee549d)}
+  },
+  {
+    {W(0x0003b82e2a296fbb), W(0x0005d3c0a88b5712), W(0x000357690a64d5dd),
+     W(0x0007c56b0aa78a9d), W(0x00009e6267f74925)},
+    {W(0x0000a6956ca0d526), W(0x0007a630f338cb42), W(0x0007cdd4b184fc53),
+     W(0x00051e609feb6104), W(0x0000f5788e8df1d7)},
+    {W(0x0000000000000001)},
+    {W(0x00018baa48e4e415), W(0x0000608c7996b9f3), W(0x0000f8d5ebb604c5),
+     W(0x0004ae942038b223), W(0x0001674f426dbd9c)}
+  },
+  {
+    {W(0x0005000cc7f1512d), W(0x00043217166438ef), W(0x00005fdd984421a4),
+     W(0x000217e8b61bc457), W(0x000718a406a32147)},
+    {W(0x0005dcd33b9e7f06), W(0x000484a0f6047f01), W(0x00010d244c922f04),
+     W(0x0004b24f27a24965), W(0x000199ca11835c6d)},
+    {W(0x0000000000000001)},
+    {W(0x0003dccc0f7d9d52), W(0x00037c3ee431acd3), W(0x0007bc43c0e390b4),
+     W(0x00065acf835cebb7), W(0x0001ad01ba584cfd)}
+  },
+  {
+    {W(0x00079629af525081), W(0x0007de21bfeb8263), W(0x00039267e73a8def),
+     W(0x0002965f24f1f36b), W(0x0000c1f42ed1e08f)},
+    {W(0x00022d47e01152f2), W(0x0003c3078dfa93e7), W(0x0007d74548533fab),
+     W(0x000289aa174a0c2e), W(0x0004b788acd315ca)},
+    {W(0x0000000000000001)},
+    {W(0x00060f2f3d460e13), W(0x0005d9d86fdf3b05), W(0x00052925014bc400),
+     W(0x0004202e02cef1c0), W(0x0006b76931b3c1e1)}
+  },
+  {
+    {W(0x000361e21b219cf0), W(0x000253c3692d33ba), W(0x0005ebe007ea4805),
+     W(0x000786e513851f4e), W(0x000569200b39fef8)},
+    {W(0x0002b78156b082ce), W(0x00051f947f483e87), W(0x00058b965239c047),
+     W(0x00010b356102cdde), W(0x00027e946b27a027)},
+    {W(0x0000000000000001)},
+    {W(0x0003636141421086), W(0x0004b116795ff7f3), W(0x0000383e5b70c2ab),
+     W(0x000427ba0d702afb), W(0x00062bdabf3285fd)}
+  },
+  {
+    {W(0x00033d3c952b8edd), W(0x00026f1336a4dd24), W(0x0004f07d1ad20d78),
+     W(0x00026a227f6844a1), W(0x00070bd82c73e98e)},
+    {W(0x00069383eb739a8b), W(0x00013209312289b0), W(0x0000af488a932b3e),
+     W(0x000102c1ec36f518), W(0x0002ac93292cbedd)},
+    {W(0x0000000000000001)},
+    {W(0x0000a50edf939a12), W(0x0004eb0804805d12), W(0x0005e35cde503bbe),
+     W(0x0006271bd78313ed), W(0x000723d6f634ba5f)}
+  },
+  {
+    {W(0x0000f0a4e35aaeeb), W(0x0007dc31a3814f00), W(0x0001601aa758e5a7),
+     W(0x0004c58debe72262), W(0x00023d1ffa6e3ca9)},
+    {W(0x000058c7576a3464), W(0x0001503ce759b53c), W(0x000364e29490f13c),
+     W(0x0000c77a2d35b42d), W(0x0002ca4a3b074e95)},
+    {W(0x0000000000000001)},
+    {W(0x0004523c0aa73fe7), W(0x0003942fd680829a), W(0x0001b743100edab0),
+     W(0x0000c2cce35fae72), W(0x0006bd868dc0fa94)}
+  }
+};
+
+static const edwards_tables_t tables_ed25519 = {
+  ed25519_wnd_fixed,
+  ed25519_wnd_naf
+};
+
+#undef W
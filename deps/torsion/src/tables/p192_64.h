@@ -0,0 +1,12467 @@
+/* Autogenerated: scripts/gen-tables.c p192 */
+/* machine_wordsize = 64 */
+/* fixed window = 4, naf window = 12 */
+
+#define W UINT64_C
+
+static const wge_t p192_wnd_fixed[768] = {
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00000afd82ff1012), W(0x000043a18800f4ff), W(0x000090f67cbf20eb),
+     W(0x0000188da80eb030)},
+    {W(0x000077a11e794811), W(0x00006b24cdd573f9), W(0x0000da78631011ed),
+     W(0x000007192b95ffc8)},
+    0
+  },
+  {
+    {W(0x00000fb16982a888), W(0x00001588a3f629a7), W(0x00003f2ad3553463),
+     W(0x0000dafebf582878)},
+    {W(0x00001afa5c7e93ab), W(0x0000141b868f5933), W(0x0000a0fa46b27bbc),
+     W(0x0000dd6bda0d993d)},
+    0
+  },
+  {
+    {W(0x0000d359cbb263da), W(0x00001fb2b9aadfd0), W(0x00009e6edcd28320),
+     W(0x000076e32a255759)},
+    {W(0x000043660cfd05fd), W(0x0000d121d49ef3b5), W(0x00004520aa62e0fe),
+     W(0x0000782c37e372ba)},
+    0
+  },
+  {
+    {W(0x000046647084e4ba), W(0x0000374729d7a4fe), W(0x0000c378b0015703),
+     W(0x000035433907297c)},
+    {W(0x00009b311db3be32), W(0x0000776cd4f12538), W(0x00005c301ea3acb0),
+     W(0x0000a2649984f213)},
+    0
+  },
+  {
+    {W(0x000018ebdd7ff590), W(0x0000300e16055901), W(0x00009b183e078d9c),
+     W(0x000010bb8e984004)},
+    {W(0x000072543cceaea1), W(0x0000e62762be312b), W(0x0000917badc9f836),
+     W(0x000031361008476f)},
+    0
+  },
+  {
+    {W(0x00008ecb93d23f2a), W(0x0000aa6678320ace), W(0x00009ac398bf5bd1),
+     W(0x0000a37abc6c431f)},
+    {W(0x00007c5710bc68f0), W(0x00001bbda90e081f), W(0x000008dbfed7040a),
+     W(0x0000851b3caec999)},
+    0
+  },
+  {
+    {W(0x00007f007011fcfd), W(0x00003060edce5de3), W(0x0000cd7660f92324),
+     W(0x00008da75a1f75dd)},
+    {W(0x000002f96409ffb5), W(0x0000fdb3c01dd4b7), W(0x0000b35418240db8),
+     W(0x000057cb5fcf6860)},
+    0
+  },
+  {
+    {W(0x000077883397edde), W(0x0000cc14899d4b59), W(0x0000e92014771993),
+     W(0x00002fa1f92d1ecc)},
+    {W(0x00008a8e9738f6c0), W(0x000078ef733ff2dd), W(0x00007214273b8b59),
+     W(0x0000a338afdef78b)},
+    0
+  },
+  {
+    {W(0x0000375ab980388f), W(0x0000a8d27c9e1d9d), W(0x0000abb74e9e8f2b),
+     W(0x0000818a4d308b1c)},
+    {W(0x0000542176c8e739), W(0x0000bb457cdf30ea), W(0x000087cd7c292f7c),
+     W(0x000001d1aa5e208d)},
+    0
+  },
+  {
+    {W(0x0000b150d1fe9d85), W(0x0000d9238842859b), W(0x00003e96d1aede2b),
+     W(0x0000aa7c4f9ef99e)},
+    {W(0x00005eb2491397b0), W(0x0000b2f4859460eb), W(0x0000c62901ee3658),
+     W(0x00003212a36547ed)},
+    0
+  },
+  {
+    {W(0x000040370628a2aa), W(0x00004d22b6522809), W(0x0000324f1844f716),
+     W(0x00001c995995eb76)},
+    {W(0x0000b8611aaa9c04), W(0x000000fa77bdb34c), W(0x0000eb73029f5564),
+     W(0x0000ef1765ce37e9)},
+    0
+  },
+  {
+    {W(0x0000dcda67eeb8ab), W(0x0000f8c9e7b28fcc), W(0x00006d0eca013877),
+     W(0x00001061343f3d45)},
+    {W(0x0000ac020b27293f), W(0x0000e7a48648681e), W(0x0000b03798fef8e3),
+     W(0x00005a064caa2ea6)},
+    0
+  },
+  {
+    {W(0x00004a363c4a090a), W(0x0000051e4ea00414), W(0x0000fb9f2f68821e),
+     W(0x0000112af141d33e)},
+    {W(0x0000a094432b1c1e), W(0x0000e081e09e7f10), W(0x000093f72a2c1726),
+     W(0x00006e0cbe3bfc52)},
+    0
+  },
+  {
+    {W(0x00008843de1081c1), W(0x0000f7c64e05dee0), W(0x0000c93b591746b3),
+     W(0x000013b9310646eb)},
+    {W(0x0000ca95e186e6b4), W(0x0000ec41a1ec4fba), W(0x000042dd15f3b427),
+     W(0x00001edcea63b441)},
+    0
+  },
+  {
+    {W(0x00004a9e7578b1e7), W(0x0000b5414de736de), W(0x0000b633ba3546b2),
+     W(0x00008c9595e63b56)},
+    {W(0x000037cdd98fc7b1), W(0x00003aa566b6ad75), W(0x000000c17cf38799),
+     W(0x0000266b762a934f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000073733048afdf), W(0x0000a5355bfcd994), W(0x0000fdbd29005092),
+     W(0x0000b7310b4548fb)},
+    {W(0x0000c56629cf2290), W(0x00004546d9491845), W(0x00007c1e42d8585c),
+     W(0x0000ff9eae9edcd2)},
+    0
+  },
+  {
+    {W(0x00008448420880a2), W(0x000050e5ad979fb9), W(0x00005918b48023ea),
+     W(0x0000c5a5972d9c05)},
+    {W(0x0000f86384188c55), W(0x000096cfa1b8b320), W(0x00000f5396ce0edb),
+     W(0x00006038fb784a78)},
+    0
+  },
+  {
+    {W(0x00000f841bd46d2e), W(0x00003a31e5f415ee), W(0x0000b6da23af6c39),
+     W(0x0000000fec9c6d15)},
+    {W(0x000035b8ab1fa9d0), W(0x00009dc2b6db1d88), W(0x0000b79c4512d675),
+     W(0x0000027beb2ec2d4)},
+    0
+  },
+  {
+    {W(0x00009f7eb97fa434), W(0x0000ba1b61aeb4a3), W(0x00009e8d09827de8),
+     W(0x0000e73b3792bfc5)},
+    {W(0x000076cfae20fb95), W(0x0000d7efb0d8ec1a), W(0x0000f8f9f28b2b5d),
+     W(0x00005ccc1df588a0)},
+    0
+  },
+  {
+    {W(0x00003343a7ce7d90), W(0x00007efdef93ea88), W(0x0000a13e52209200),
+     W(0x00006abaa3f9f2f0)},
+    {W(0x000029087cfebb2c), W(0x000029892807f9b5), W(0x0000e78bdc9bfe3c),
+     W(0x0000e204f6707634)},
+    0
+  },
+  {
+    {W(0x0000988610547bb0), W(0x00002bec8b53e7c9), W(0x0000acf9988e3155),
+     W(0x00006dafba723abc)},
+    {W(0x0000f6d950b3925b), W(0x0000c38438dec446), W(0x000030c7eb564774),
+     W(0x0000f7affc1f65e5)},
+    0
+  },
+  {
+    {W(0x0000a6af010e090c), W(0x0000c56d831058bb), W(0x0000ea8678ce00a2),
+     W(0x0000fdeb16b05d0c)},
+    {W(0x0000e2257451d256), W(0x00001817c2086e6d), W(0x0000267dbefb5aeb),
+     W(0x0000da7919324a4f)},
+    0
+  },
+  {
+    {W(0x000077f2a3f770d0), W(0x0000d87cf00befc3), W(0x0000dcccf8bff138),
+     W(0x0000aced16c30fe2)},
+    {W(0x00007122caff09f1), W(0x000042db1eed9cbb), W(0x0000e9881ca4cccb),
+     W(0x0000c07fdf90ab9b)},
+    0
+  },
+  {
+    {W(0x0000b74cb3c046e8), W(0x0000a7569961b436), W(0x0000cd46d7160437),
+     W(0x0000537e1f27a832)},
+    {W(0x0000d73fa11980c9), W(0x0000981b80ee44b6), W(0x0000bf80f19463eb),
+     W(0x00002f0785a417a8)},
+    0
+  },
+  {
+    {W(0x000065212e0c42ce), W(0x00004537b96e7a24), W(0x00008de45351ef83),
+     W(0x000000ef4f59cc5c)},
+    {W(0x0000c8e077fe2dc5), W(0x00008c3cab8792e7), W(0x000040501e8a1af1),
+     W(0x00003629b1285199)},
+    0
+  },
+  {
+    {W(0x0000e3d109a45e64), W(0x00008d3beece93ea), W(0x0000f7121970f6ca),
+     W(0x00008517cffdbb31)},
+    {W(0x00003b57f9a1a995), W(0x0000f580e0f0bbf2), W(0x0000903df1d56970),
+     W(0x0000659d0f3d69cb)},
+    0
+  },
+  {
+    {W(0x0000908d387618c0), W(0x0000e312dbff06fb), W(0x0000c3def023d6fb),
+     W(0x00002e6ee8681c98)},
+    {W(0x0000ee6f1f7483a9), W(0x0000276ade00b031), W(0x0000d78e1f99500f),
+     W(0x000033e840dd2cbc)},
+    0
+  },
+  {
+    {W(0x0000c686ee211024), W(0x0000c457da7d7fb2), W(0x00009a990245038e),
+     W(0x00004377d9b864b1)},
+    {W(0x0000150d90785768), W(0x0000a698b0eb76cb), W(0x0000d35b6fec4087),
+     W(0x000043610b382da3)},
+    0
+  },
+  {
+    {W(0x0000efcc18e8dd17), W(0x00009521d23340d3), W(0x00007267474fc2be),
+     W(0x0000c3876ad779b8)},
+    {W(0x00003421b0cd24d7), W(0x00005be09fb53648), W(0x0000d05235c062e9),
+     W(0x0000780a80f905c9)},
+    0
+  },
+  {
+    {W(0x00005604511b4a3d), W(0x0000f326be63c628), W(0x00004372b0ac8ac0),
+     W(0x00005f74855f345e)},
+    {W(0x00003aeeaba98768), W(0x0000770271d50aa1), W(0x000011fea7468b66),
+     W(0x0000d89b07371451)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000efff0dcb2eaa), W(0x000022355286d812), W(0x0000edd21fa5302b),
+     W(0x00009ff5229d3b61)},
+    {W(0x0000ccfc026164f6), W(0x0000d13b7b8cffdf), W(0x0000b4d16e8bd096),
+     W(0x0000a8a8b331e844)},
+    0
+  },
+  {
+    {W(0x00000f1b5c04b276), W(0x0000df6e8f6250ad), W(0x00000c57538bccb5),
+     W(0x0000319b54bf674e)},
+    {W(0x00006781dcc394aa), W(0x0000db2da3617ead), W(0x0000912fd41a42cb),
+     W(0x0000f73e1f13cdd6)},
+    0
+  },
+  {
+    {W(0x0000fc11e280db6a), W(0x00000c03f2058d41), W(0x00003ffe1df10a59),
+     W(0x000032660047eed7)},
+    {W(0x000097470b9f1695), W(0x00001d4361385b93), W(0x00009a30f1171031),
+     W(0x0000a6d7e9cda668)},
+    0
+  },
+  {
+    {W(0x000023145c9ae29f), W(0x0000114b0da95146), W(0x00009109a387348d),
+     W(0x0000ba24ee605281)},
+    {W(0x0000081f07da2e76), W(0x000052e9b2707773), W(0x0000498a62b4ddaf),
+     W(0x000008ed5f359918)},
+    0
+  },
+  {
+    {W(0x0000b84f3090806f), W(0x0000175eae5308a6), W(0x0000b296999b3407),
+     W(0x000032135c30fbf4)},
+    {W(0x0000025e36a00b6a), W(0x00007849cfd62584), W(0x0000b98630ea7bf3),
+     W(0x0000c34f02ed3783)},
+    0
+  },
+  {
+    {W(0x0000c7dc0b68d959), W(0x000072f1433534b5), W(0x00009ad3e73ea263),
+     W(0x000058522e336f46)},
+    {W(0x0000b4e1cae48092), W(0x0000c72bf9337a55), W(0x000034cb3ccdd27b),
+     W(0x0000ed3f80f229f4)},
+    0
+  },
+  {
+    {W(0x0000351807cf4890), W(0x00009aff561037bb), W(0x00001e4990910135),
+     W(0x00002c42fa4cd464)},
+    {W(0x0000ffb0bb3ca116), W(0x000084fa7e559b1a), W(0x0000bd989463fe98),
+     W(0x0000d2805c9aede8)},
+    0
+  },
+  {
+    {W(0x000011f8668593f1), W(0x0000c68ade81ff4d), W(0x00002683fa0720ab),
+     W(0x000078c2c6fddce7)},
+    {W(0x0000421c55fa0969), W(0x00000aa3638d9e24), W(0x000093be918897b8),
+     W(0x0000d4a79ae5a497)},
+    0
+  },
+  {
+    {W(0x000055a92c287e30), W(0x000012926af5ebeb), W(0x00007b852676ca3a),
+     W(0x0000085c2a0d5cc7)},
+    {W(0x000083fda4a8c6a9), W(0x00003b6b66606996), W(0x0000c356936bd6a0),
+     W(0x000007af884fb4df)},
+    0
+  },
+  {
+    {W(0x0000af5447e05f3b), W(0x000076f74b1850b6), W(0x0000d6b8a11a7141),
+     W(0x000070acca106f8f)},
+    {W(0x0000f289afc19c90), W(0x0000655bc6ad240f), W(0x000004e7628a829f),
+     W(0x0000dca6d5062e15)},
+    0
+  },
+  {
+    {W(0x0000f7f2663c4c0e), W(0x0000fc9f12eec435), W(0x0000694079d572a1),
+     W(0x0000c1b1a5c6f2c5)},
+    {W(0x000051ff22eec2f3), W(0x00009dddc1423b5a), W(0x00001a9751304b8f),
+     W(0x00001f4f1647f5e0)},
+    0
+  },
+  {
+    {W(0x00003ea74c7f2194), W(0x000008291289fb79), W(0x00002bdd6584d423),
+     W(0x0000ae360c4b2948)},
+    {W(0x0000dceb3b85950d), W(0x0000c4797c33faf9), W(0x00004eb2413238d1),
+     W(0x0000c3b889349d5c)},
+    0
+  },
+  {
+    {W(0x000024913e741570), W(0x0000709fc0031010), W(0x0000892ad4cd8136),
+     W(0x0000e408379d4a84)},
+    {W(0x00005a22d005b409), W(0x00004b85b30bef27), W(0x0000ccce09ec66e9),
+     W(0x0000be52484f3fa5)},
+    0
+  },
+  {
+    {W(0x0000e5a4967d6ea1), W(0x0000e070fd3fa266), W(0x0000617d3b6aa045),
+     W(0x0000d32a27fd3773)},
+    {W(0x0000ce4dcec67a29), W(0x000035c01fd6f430), W(0x0000d2009faab91f),
+     W(0x0000ed0a4e5fa3cd)},
+    0
+  },
+  {
+    {W(0x0000ca25265ffd55), W(0x0000b3593a0aeeef), W(0x0000e03ae196138c),
+     W(0x000018fb5e4d5338)},
+    {W(0x0000ff1bf56f23a8), W(0x0000b7c9d1a4f9be), W(0x0000f466791b1b7b),
+     W(0x0000bf01487bd9e8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000003e9ce1d0db6), W(0x0000e187c91af1c8), W(0x00002603fad7710d),
+     W(0x0000ee355e9c6a39)},
+    {W(0x0000412321d2cfda), W(0x0000e93fbf85b1fa), W(0x00009f7b862f7135),
+     W(0x00004f71b1c6a029)},
+    0
+  },
+  {
+    {W(0x000055491b64893b), W(0x000019492f60ad8d), W(0x000002f953a0a39f),
+     W(0x000065a227c5877b)},
+    {W(0x0000be70ea781017), W(0x0000a5b536af4397), W(0x00001d23d9ab8fda),
+     W(0x0000058b0b001d30)},
+    0
+  },
+  {
+    {W(0x00009c1c09b4633d), W(0x000049aa4601b109), W(0x0000228b2536c18a),
+     W(0x0000a852f218ef18)},
+    {W(0x00000fdc3c54e5ba), W(0x0000e5b95f53d817), W(0x00006decf718f9f0),
+     W(0x000063d83583d51c)},
+    0
+  },
+  {
+    {W(0x0000f54571892f02), W(0x000006550acf363e), W(0x0000224418c5cb3e),
+     W(0x000040f41c5e37e3)},
+    {W(0x00003b415e45fa71), W(0x0000903c0d84e629), W(0x00005ab939a312be),
+     W(0x000028a8b5ecdfc4)},
+    0
+  },
+  {
+    {W(0x000028f6f2473b2b), W(0x0000cf6c916b4ce0), W(0x0000e4b3ccce941b),
+     W(0x000095a89be533ea)},
+    {W(0x00006cb4d1d7a918), W(0x00000f04c59bdd4b), W(0x00005f6a2fbdd4f2),
+     W(0x000058270a24f9e0)},
+    0
+  },
+  {
+    {W(0x0000cc980d9e8d49), W(0x0000c2e4a3788d44), W(0x0000048858015c45),
+     W(0x00004c7447de0f31)},
+    {W(0x000092f75c115b37), W(0x0000dd7b12311384), W(0x0000bb5df988caa0),
+     W(0x0000fced104f0054)},
+    0
+  },
+  {
+    {W(0x0000a1ddd5942149), W(0x0000065012da3a1e), W(0x0000f73c7ccc43f3),
+     W(0x0000c9497465b3db)},
+    {W(0x00006b29d779d28a), W(0x0000b12ab0c370c9), W(0x00001be6f96f9e61),
+     W(0x0000ee0f64000dcc)},
+    0
+  },
+  {
+    {W(0x0000d9d915b0f1af), W(0x0000f0626eefd8b2), W(0x000062fc95646970),
+     W(0x0000814cd305431a)},
+    {W(0x000043f88b35db84), W(0x0000d16cff052efd), W(0x0000691d665781a6),
+     W(0x0000ef22efaebc94)},
+    0
+  },
+  {
+    {W(0x0000815a80c3be7d), W(0x00000ad25536f348), W(0x0000819119d5dcb5),
+     W(0x0000d32eecbfd724)},
+    {W(0x000094f3985fd5b5), W(0x0000d43b21083cf4), W(0x00009811acc53109),
+     W(0x00003eb824ffb409)},
+    0
+  },
+  {
+    {W(0x0000cc47eb043c12), W(0x0000a94373954178), W(0x00002c0c09c8f389),
+     W(0x0000bd6d47b5cdcb)},
+    {W(0x0000ad5f80600c27), W(0x0000c5ba2705f5eb), W(0x000047db85c00822),
+     W(0x000064b900adf992)},
+    0
+  },
+  {
+    {W(0x0000c4be01173a78), W(0x00007263f65313a7), W(0x0000ee583dc5e75a),
+     W(0x0000a2b2c94556b3)},
+    {W(0x0000e91882e66e81), W(0x000064a44ed9f580), W(0x0000f934598b3789),
+     W(0x0000085d0ac79d4b)},
+    0
+  },
+  {
+    {W(0x000029d6a6567546), W(0x0000667f9646c0ef), W(0x0000c3ccaa332c20),
+     W(0x0000d5e3ca4fb751)},
+    {W(0x00009383b87019a8), W(0x00000766d6d445ec), W(0x0000f433747b10ea),
+     W(0x000066eaef04c013)},
+    0
+  },
+  {
+    {W(0x00008ab945a62d4e), W(0x000013c098001c17), W(0x00007ab14572d489),
+     W(0x0000500b8427e534)},
+    {W(0x0000e212fbe5e2d4), W(0x0000af9e2e6fb831), W(0x0000ab96ccbebd89),
+     W(0x000072c54226026e)},
+    0
+  },
+  {
+    {W(0x000039da38db3675), W(0x0000025488ee3baf), W(0x0000af7df3e7cb96),
+     W(0x00004629a680a698)},
+    {W(0x000032b012553481), W(0x0000f2a97244c2ed), W(0x0000e46c059c026c),
+     W(0x0000be821ae401c8)},
+    0
+  },
+  {
+    {W(0x00000d82c646ea31), W(0x0000e972cc7cf91e), W(0x000062d94a9d9523),
+     W(0x0000e6078768da7d)},
+    {W(0x0000ea26a828dbce), W(0x0000b247a0cad61d), W(0x0000210a6762c658),
+     W(0x0000b9d11b9caa40)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00007b9f131406ad), W(0x00001fa93ae2a6ac), W(0x000010cd2cba22f7),
+     W(0x00007d23ed578c0b)},
+    {W(0x00003b0bf2525d64), W(0x0000ec8bec0d262a), W(0x0000df183e989364),
+     W(0x00008b8311dcbca5)},
+    0
+  },
+  {
+    {W(0x0000b9a38c69cbdf), W(0x0000e9c519bc0613), W(0x0000186452edac84),
+     W(0x0000d1b67325e76e)},
+    {W(0x0000163e1910ea26), W(0x0000b5858dd8b479), W(0x000028545986dd64),
+     W(0x0000e86d14f45216)},
+    0
+  },
+  {
+    {W(0x00005aa6807967ed), W(0x0000eaecae86760e), W(0x0000385806f89b5f),
+     W(0x00008e6d83354ce0)},
+    {W(0x00009591a49a1616), W(0x00006c97416e596e), W(0x00005acdf3831126),
+     W(0x0000c762bdca5797)},
+    0
+  },
+  {
+    {W(0x0000c00030fedd08), W(0x0000c694b9035f40), W(0x00001d514e02a647),
+     W(0x000052fbe4131e10)},
+    {W(0x0000cbd0511be925), W(0x0000cef6d4d95d36), W(0x00007e8a5676af1f),
+     W(0x0000a70dae1c4d38)},
+    0
+  },
+  {
+    {W(0x0000a27a12fff4e6), W(0x0000f005e906cde6), W(0x00000702488ae5ec),
+     W(0x0000e2ce138a7d86)},
+    {W(0x0000b13cca9ccf32), W(0x0000fc3f765d108c), W(0x0000c03983c4c275),
+     W(0x0000f18334ae0b7b)},
+    0
+  },
+  {
+    {W(0x0000f1c3ba1bc3db), W(0x0000b39982ae96d2), W(0x00002719b5ad4681),
+     W(0x0000e9f096cef3fc)},
+    {W(0x0000d817dba4df2d), W(0x0000a44860fc75d3), W(0x0000d0d1581b8b68),
+     W(0x0000f94469bf36b0)},
+    0
+  },
+  {
+    {W(0x00005530b167ebbf), W(0x0000a118098001c5), W(0x00000267d3b87c8f),
+     W(0x0000e2d75a3af2e1)},
+    {W(0x0000006e370a4a04), W(0x0000ea1767d03ab9), W(0x00004fcd5ecb35d3),
+     W(0x000080cccf5be81a)},
+    0
+  },
+  {
+    {W(0x00009ae07e8d5397), W(0x00003de9664355aa), W(0x000099d0edb2763a),
+     W(0x0000b6bb074be06f)},
+    {W(0x0000c376cc7fed97), W(0x0000393c60ca8457), W(0x00006944e3e8fcf9),
+     W(0x0000e57a7163fb16)},
+    0
+  },
+  {
+    {W(0x000064bb198745d1), W(0x00008321b1348768), W(0x00000c3432014779),
+     W(0x0000d9e9814bf712)},
+    {W(0x0000431848d85123), W(0x000009881c248496), W(0x000046a2f68d2dfb),
+     W(0x0000eaef92d4b2b7)},
+    0
+  },
+  {
+    {W(0x0000e25afa0174e5), W(0x0000ff56abe6cab9), W(0x0000be32ab641f97),
+     W(0x0000799980c6c761)},
+    {W(0x00006ef48b5e2012), W(0x00009959cc67c31f), W(0x000033481971136d),
+     W(0x0000f740a4436d0a)},
+    0
+  },
+  {
+    {W(0x0000ed5c755c7177), W(0x00002e4ad53e8ac7), W(0x000078237362bbf3),
+     W(0x00006739dc01ac12)},
+    {W(0x000044e396862335), W(0x0000ebfef688b22a), W(0x00004e1400807616),
+     W(0x000048b9da4ad425)},
+    0
+  },
+  {
+    {W(0x0000429700dfdde1), W(0x0000d9d116d3ca04), W(0x00008df4120eefe3),
+     W(0x00003e8481509c74)},
+    {W(0x00002df6c1e336b5), W(0x000073b5e1cbc8db), W(0x0000de63e7604008),
+     W(0x0000a7fc473cd206)},
+    0
+  },
+  {
+    {W(0x00001c2d6c54de01), W(0x0000b2654d917c0a), W(0x000085f25f6573b3),
+     W(0x0000845dd214dbfe)},
+    {W(0x00002a8f77835b08), W(0x0000bf3a557eb16c), W(0x0000fa16e9fbdaa4),
+     W(0x0000cf1845e3ac7b)},
+    0
+  },
+  {
+    {W(0x00006c8673f1d938), W(0x00009bf3b60f18ec), W(0x000076e6754a31de),
+     W(0x00005255a2b75449)},
+    {W(0x000087a96e1e4688), W(0x0000c27d7fb75a37), W(0x000023fb102bea82),
+     W(0x0000c74d72c89905)},
+    0
+  },
+  {
+    {W(0x00009e30a9a469d6), W(0x0000fd32cc565fe0), W(0x0000a70872f960ce),
+     W(0x000032bbe97fb854)},
+    {W(0x00002c7a71427f11), W(0x0000b2845c2de95c), W(0x00009a4b42f7d3fb),
+     W(0x0000ba5f8b10f97d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000d8b820ac893b), W(0x0000a3e36a89bf6c), W(0x0000e06347789236),
+     W(0x0000c7580802affe)},
+    {W(0x00002d9ec1857578), W(0x0000a122527aefaf), W(0x000073751bf320f4),
+     W(0x00001b14a0068c31)},
+    0
+  },
+  {
+    {W(0x0000ef4c24451fed), W(0x00003d80ff0df57d), W(0x0000834719354e48),
+     W(0x00005f1817849f76)},
+    {W(0x0000782a27397c84), W(0x0000343993ff09ee), W(0x0000ea91b7f05dea),
+     W(0x000069e265e2b49d)},
+    0
+  },
+  {
+    {W(0x0000548741f9ad5a), W(0x0000b21670a45ac8), W(0x0000a5b5f408e47b),
+     W(0x00001bc1bceb23c9)},
+    {W(0x0000501abba08a1f), W(0x0000ff66051f3160), W(0x00007416f5d9b90c),
+     W(0x00007194cd0a1810)},
+    0
+  },
+  {
+    {W(0x0000d26504327af0), W(0x0000d2dd9e4d0ff5), W(0x000057ae3afcc0de),
+     W(0x0000e8f9d4479f64)},
+    {W(0x0000c91f4f79077c), W(0x0000ca8c19011abc), W(0x00009de3fe281c03),
+     W(0x0000b576c4df832b)},
+    0
+  },
+  {
+    {W(0x0000e9d9638b372a), W(0x00003d3aa3d80bdf), W(0x0000ceba045b3a3b),
+     W(0x00001d46c5eb3fdf)},
+    {W(0x00004dcbeea63256), W(0x000030150fbb7cd4), W(0x000020a79a9cac98),
+     W(0x000045e7b5bac89e)},
+    0
+  },
+  {
+    {W(0x00008737d951f018), W(0x0000ea313ad14552), W(0x0000e7d6690cede8),
+     W(0x00004e5b6bcf6916)},
+    {W(0x00009cab8ccaa84a), W(0x0000d73c9110a19b), W(0x0000153a06462170),
+     W(0x0000099c96a16c97)},
+    0
+  },
+  {
+    {W(0x000056600e4f0319), W(0x00001738cd8e8f0c), W(0x000053cf24205a74),
+     W(0x0000cc34ea6c5330)},
+    {W(0x0000bb1aec7468be), W(0x000004f402d8ea79), W(0x0000b83f399d0e31),
+     W(0x0000a20efdccb6b1)},
+    0
+  },
+  {
+    {W(0x00002ef33128c0ac), W(0x00003d5b5848646f), W(0x0000282d519b2093),
+     W(0x00007d0516ae644f)},
+    {W(0x0000494d254e16c3), W(0x0000e360962bf212), W(0x0000e67b46304edb),
+     W(0x00000bcb5db2d7ac)},
+    0
+  },
+  {
+    {W(0x000089cac2cf5f36), W(0x000093e11fc1ce64), W(0x000008c4083decf0),
+     W(0x000008f5d351ee73)},
+    {W(0x00001777b14c7881), W(0x000039913ac18c6b), W(0x0000fb6b5cb0fc66),
+     W(0x0000cd723bd31a4b)},
+    0
+  },
+  {
+    {W(0x00001f0cf526501f), W(0x0000cf745d93b427), W(0x00007dff058df535),
+     W(0x00007de3adb0d48e)},
+    {W(0x0000c528c19099f9), W(0x0000bdb49c220c3f), W(0x0000e4235f03b807),
+     W(0x0000652b2cfea43f)},
+    0
+  },
+  {
+    {W(0x000022a9d1c4ef5e), W(0x00008a0ffcfcf5a5), W(0x00007417b2f8b558),
+     W(0x00004fc1d1e36b32)},
+    {W(0x00000e84a5388d23), W(0x0000c24fa1b45f55), W(0x0000a64598f163a2),
+     W(0x0000ffc1ff8cb82f)},
+    0
+  },
+  {
+    {W(0x0000b257664a4ebe), W(0x00009096a7fbcbdd), W(0x000051d5f8d5a1fe),
+     W(0x000087b1cb6e5dc3)},
+    {W(0x0000f5f2390c9d8d), W(0x0000beb56f389d38), W(0x00000ecc8549e44b),
+     W(0x00001032097c2dbc)},
+    0
+  },
+  {
+    {W(0x0000751002ad1f43), W(0x0000ab190c969070), W(0x0000a5b4f38b3976),
+     W(0x000099751a33d4e4)},
+    {W(0x0000cf451cf78637), W(0x000059f408cf8194), W(0x000078ab70869b9d),
+     W(0x0000455725d784fe)},
+    0
+  },
+  {
+    {W(0x00006944cd94d405), W(0x0000ba9ce39210e5), W(0x0000e7f85959f542),
+     W(0x0000d36cad76a6c4)},
+    {W(0x00007ed6813e41d8), W(0x00003966a0ce587e), W(0x0000a1db05ffaef2),
+     W(0x0000eeb0132775a9)},
+    0
+  },
+  {
+    {W(0x00003db3d09cea6b), W(0x0000d5a8b92e608e), W(0x0000e0e544489230),
+     W(0x0000a5aac129984c)},
+    {W(0x00000a043a77b517), W(0x00003ab6364ffb95), W(0x0000fc6f9226d41f),
+     W(0x0000e0f2dde0e500)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000d792ca732037), W(0x000018b038fdf60b), W(0x000063b56b80ec5b),
+     W(0x000009b95f940bd2)},
+    {W(0x000093700aec1acd), W(0x0000043f87f319ec), W(0x0000d561fbc3c982),
+     W(0x00007d80d527355e)},
+    0
+  },
+  {
+    {W(0x00009dee44bb5883), W(0x000060b4f22443e2), W(0x0000929699c69288),
+     W(0x0000c657d599a0af)},
+    {W(0x000089f2c1c7b573), W(0x00009a4b323d9832), W(0x00002e758bdb577b),
+     W(0x0000460dab0f42f4)},
+    0
+  },
+  {
+    {W(0x0000222bafd0811b), W(0x0000645b8e815448), W(0x000080fab811d9e0),
+     W(0x000000c186f8cdd7)},
+    {W(0x00001ed0166c40bc), W(0x0000da8897941fd9), W(0x0000b0c8d9eb097b),
+     W(0x00006b9234ba6fff)},
+    0
+  },
+  {
+    {W(0x000001739c0d66f2), W(0x0000c2062026a41a), W(0x0000e16dd086d495),
+     W(0x00002c4a0cd42e6e)},
+    {W(0x00001da70558e4ce), W(0x0000f75b4bf7f6e2), W(0x00006c47e47ec48c),
+     W(0x00000de74846db06)},
+    0
+  },
+  {
+    {W(0x00005cdce1b8913e), W(0x00006220d8fd9396), W(0x00008acfc1822956),
+     W(0x000035d84edf31a8)},
+    {W(0x0000915f9e577b48), W(0x0000876e0ea9978c), W(0x00002d3b44bb5980),
+     W(0x00001fbbded0f209)},
+    0
+  },
+  {
+    {W(0x000054d7ea021afd), W(0x00000b11fc58a12f), W(0x000036fd8197168e),
+     W(0x0000502c50afd8b8)},
+    {W(0x0000596e55d963a1), W(0x00006dc6bc6a47d8), W(0x0000fd8c9ef9a73d),
+     W(0x000063e77881da4e)},
+    0
+  },
+  {
+    {W(0x000078d97ae00fef), W(0x000076702602c843), W(0x00002f817ed79b0b),
+     W(0x000060b8005fa9e4)},
+    {W(0x00008674ff860dae), W(0x000022f0fb2e0546), W(0x000006c90df48a43),
+     W(0x00004effc48e8b15)},
+    0
+  },
+  {
+    {W(0x00002b10615f9c89), W(0x0000dfe7f4fceaf3), W(0x0000a7d3247a2995),
+     W(0x00003a66ab8275fc)},
+    {W(0x00007839926c5af7), W(0x0000ff045d1a343d), W(0x0000c075cc0cdc15),
+     W(0x0000d8706f25a14e)},
+    0
+  },
+  {
+    {W(0x00002d8cec17ed83), W(0x00004c1d742701eb), W(0x00000151d40d44ed),
+     W(0x000032e64d3f6e8f)},
+    {W(0x0000ba5ed0eedd02), W(0x0000e914f09e7197), W(0x00008b20115b5a38),
+     W(0x000061c29b601d9a)},
+    0
+  },
+  {
+    {W(0x000068c34a19a2ee), W(0x0000c910d1d0c91f), W(0x0000c3158624edfa),
+     W(0x0000bf6a7920e8d3)},
+    {W(0x00006eae6b1e3ed6), W(0x0000a347b386f854), W(0x000021611d555838),
+     W(0x0000f18e54bdabb8)},
+    0
+  },
+  {
+    {W(0x0000c2d0fa4afef0), W(0x00005f37b83cc222), W(0x00005693c67e9f31),
+     W(0x0000a48f284939ef)},
+    {W(0x0000d1829812f270), W(0x000021f63249ce63), W(0x0000c723377b1ffa),
+     W(0x0000a29087f0e0cd)},
+    0
+  },
+  {
+    {W(0x0000a960255b10a0), W(0x00005acadb135d74), W(0x000032ef90e60438),
+     W(0x0000c3607dfdd5e1)},
+    {W(0x00002cf6b408b6e2), W(0x0000738182b2ed35), W(0x0000643ab5808def),
+     W(0x0000bc495eaba475)},
+    0
+  },
+  {
+    {W(0x0000b82e1865b87b), W(0x0000a3ae16eeab94), W(0x0000271ecdc86389),
+     W(0x0000122aff0bdfab)},
+    {W(0x0000e2875fafade0), W(0x0000c8724ac4dd02), W(0x00006bbbf53614cb),
+     W(0x0000350f5d61b76d)},
+    0
+  },
+  {
+    {W(0x0000995a6ad37b07), W(0x00005fd9856ee8e0), W(0x000022f722a593ad),
+     W(0x0000aa1b7dd98a0e)},
+    {W(0x000038db3ed67330), W(0x0000e5e49ea7e17d), W(0x0000be5d6663316e),
+     W(0x000098172a537d72)},
+    0
+  },
+  {
+    {W(0x0000157cbc21f2bc), W(0x0000ef6fa452623d), W(0x0000c82fc256d234),
+     W(0x00007531f699921b)},
+    {W(0x000052de17180d18), W(0x0000f2662b8c929f), W(0x0000f4bf70c8c4ae),
+     W(0x00004f924343f1ff)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000b9e044093861), W(0x00001a5368439683), W(0x00001c3d65574a0c),
+     W(0x0000f1998a3514cc)},
+    {W(0x00004068d06c577a), W(0x000091337355ae65), W(0x000044b145a6b4e9),
+     W(0x0000c69a45f531b0)},
+    0
+  },
+  {
+    {W(0x0000c2c3a2adb426), W(0x0000ea87acac230f), W(0x000046acb984a4d2),
+     W(0x00004c840e5cf2bb)},
+    {W(0x00000ad28efec962), W(0x0000a149d343f174), W(0x0000d0234d060923),
+     W(0x00000d711806d550)},
+    0
+  },
+  {
+    {W(0x0000e1db163bbba0), W(0x00001a806473d0af), W(0x0000b36666e049c4),
+     W(0x0000c5e59dee3a0e)},
+    {W(0x0000113e655a3c6f), W(0x00009d912d4e8b1f), W(0x0000726d1b36949f),
+     W(0x0000787c751f1685)},
+    0
+  },
+  {
+    {W(0x0000ab4a5ac40309), W(0x0000b61a879a876a), W(0x0000b70a1850af73),
+     W(0x000042a4045368af)},
+    {W(0x000005120dab5744), W(0x000058ae3b27f027), W(0x00004546a1ba0816),
+     W(0x0000579581df9490)},
+    0
+  },
+  {
+    {W(0x0000557f04147f43), W(0x00007f4d6598d133), W(0x0000cd2ffdce52a8),
+     W(0x000072c525b3e0dd)},
+    {W(0x0000ecb28630c4fb), W(0x000032e740ef99b3), W(0x0000fcf65af9074e),
+     W(0x000045e985951b0c)},
+    0
+  },
+  {
+    {W(0x00007bebb7dfb45d), W(0x0000222a5cf4fddf), W(0x0000e1ccabf26fb2),
+     W(0x0000f521a4143d5d)},
+    {W(0x000044f229a9b043), W(0x0000f328650b37eb), W(0x000098d4464d2342),
+     W(0x00004c4cf141228a)},
+    0
+  },
+  {
+    {W(0x0000c1daf8f9a745), W(0x0000b3a3ecc7f631), W(0x000066d80c88e354),
+     W(0x00006262a53dd402)},
+    {W(0x00007164dbea2f0c), W(0x0000057983ce40be), W(0x0000ba59916a9c29),
+     W(0x0000eb8dcaf08c97)},
+    0
+  },
+  {
+    {W(0x0000870044aa66a1), W(0x00004955e4a26fa8), W(0x00008b4adc162925),
+     W(0x0000f4a96ce31d59)},
+    {W(0x000089a9fa6e10e2), W(0x00009c854ff95273), W(0x0000a5c406cf66d2),
+     W(0x00000b7ec075c776)},
+    0
+  },
+  {
+    {W(0x00006fdaa81e363b), W(0x00001a6b2b3c4cb1), W(0x000010669f188dc9),
+     W(0x00009a1a80e545d3)},
+    {W(0x000054df164e777d), W(0x0000edbe5c3f941e), W(0x0000ce928538f9a7),
+     W(0x000028bba43351f2)},
+    0
+  },
+  {
+    {W(0x0000f2bd5891f062), W(0x00000d070efc68e6), W(0x0000ef4452cc4e9d),
+     W(0x0000921b1d815525)},
+    {W(0x00002631a20a4bfd), W(0x0000e71bc24918ee), W(0x0000920e2baf8955),
+     W(0x000018a06702bb22)},
+    0
+  },
+  {
+    {W(0x000086c36062418b), W(0x0000cbd99a45a679), W(0x0000fe2cc0ce6fa5),
+     W(0x00005f88848847a5)},
+    {W(0x0000eaee981e6a70), W(0x0000e6c885ee4731), W(0x000030a7f9940565),
+     W(0x000017b12c69ba1d)},
+    0
+  },
+  {
+    {W(0x0000a0eb13e58a96), W(0x0000e420ac193dc7), W(0x0000c8307ecf71fb),
+     W(0x000067273ba576af)},
+    {W(0x0000b1e9d885daa1), W(0x00000b26ceb17b3f), W(0x0000fc527e6b5baf),
+     W(0x0000bbfa98b47421)},
+    0
+  },
+  {
+    {W(0x000055da56c9c70c), W(0x00000c823601abc6), W(0x0000e82b24358c13),
+     W(0x0000c78a15a57170)},
+    {W(0x000014c5fa1140b9), W(0x00001c767ad3a8db), W(0x0000a9bbf7459680),
+     W(0x0000928bb1eddb91)},
+    0
+  },
+  {
+    {W(0x0000798397783d8a), W(0x00003f42e983ec3c), W(0x000035ec46ce33d7),
+     W(0x0000d48672966286)},
+    {W(0x00006e63e568cd58), W(0x00000d14131b9bdd), W(0x0000caf8e11b64c4),
+     W(0x00008d86fc3aef8c)},
+    0
+  },
+  {
+    {W(0x00009bcd05d6ee96), W(0x0000796a2c38a3d4), W(0x00003374a2dd0e9c),
+     W(0x00002c52538059f5)},
+    {W(0x00001f5a5fb527a8), W(0x0000f8b93477e6c2), W(0x0000824e42d4863b),
+     W(0x00008772451c7484)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000499084ce428f), W(0x00003c134d75deca), W(0x00005374aa4e5b31),
+     W(0x0000e9d583639917)},
+    {W(0x0000e41fde99f1f0), W(0x00004cfbb12f875a), W(0x000002c84a2eaee1),
+     W(0x00002f288d463277)},
+    0
+  },
+  {
+    {W(0x00008452b571aa75), W(0x0000f02fd6b060da), W(0x0000795c59a32fd9),
+     W(0x000072cd2a800968)},
+    {W(0x0000a63d16f6f0ac), W(0x000089a07aaede93), W(0x00003898d03582de),
+     W(0x00005032cbcc80bf)},
+    0
+  },
+  {
+    {W(0x00004c4656cc50a9), W(0x00007aed2bcca160), W(0x0000cc99ba2b52e5),
+     W(0x0000923d1d03a3f9)},
+    {W(0x000075faab9d6b4d), W(0x0000048888d1ff8c), W(0x0000cb4127cbc4b5),
+     W(0x00009c37ecc4b364)},
+    0
+  },
+  {
+    {W(0x00003de8cf6862eb), W(0x00008e53c43067dc), W(0x0000aa0341cd1ce3),
+     W(0x0000fc8ef8111f98)},
+    {W(0x0000c9104eafbe3e), W(0x0000296152ab0805), W(0x0000f9a7dbdcd7cb),
+     W(0x0000fafca79a7444)},
+    0
+  },
+  {
+    {W(0x00007d920d8e7449), W(0x0000a21ca20405af), W(0x000041ff40eee583),
+     W(0x000010f04015748f)},
+    {W(0x000004a7e3406e6b), W(0x0000248822f7fe96), W(0x0000596a80703c94),
+     W(0x00000710d94ba99f)},
+    0
+  },
+  {
+    {W(0x0000ca779e51d11e), W(0x0000547fafe84099), W(0x000046a441cfe2f2),
+     W(0x00003db6db76b09a)},
+    {W(0x00009b897d666723), W(0x000082c119bb9c66), W(0x0000d0ed5a05bbf4),
+     W(0x0000d7b8d18ea426)},
+    0
+  },
+  {
+    {W(0x0000fa2860ea7273), W(0x0000dca6648486f3), W(0x00000fde050f71fe),
+     W(0x000092b34b20ff6e)},
+    {W(0x0000bca75fec7b21), W(0x0000d10867e49751), W(0x0000538ae0873d12),
+     W(0x0000a806822449de)},
+    0
+  },
+  {
+    {W(0x00003db8a9b9caf7), W(0x000086a7fa697a17), W(0x0000eb775fc87902),
+     W(0x00009e5e09cf69cc)},
+    {W(0x00009e715e11dc4e), W(0x0000a1b0baf23ac9), W(0x0000196a81788b4f),
+     W(0x00007be1d8256de3)},
+    0
+  },
+  {
+    {W(0x000061b786a62374), W(0x000093ee485d3bc9), W(0x00007a4cc21e1cc8),
+     W(0x00009238ffa990e8)},
+    {W(0x0000119bd20f9069), W(0x00005df2ad3294ce), W(0x00001e9ec96e11f9),
+     W(0x00003b2e4e2a3a47)},
+    0
+  },
+  {
+    {W(0x000095cd1f90142d), W(0x0000692fe6dd483a), W(0x0000ffc41581a62a),
+     W(0x0000912389ab802a)},
+    {W(0x000026ad794e6d44), W(0x00007dd3e021482c), W(0x0000efd6de727bc3),
+     W(0x00002508854ef8bd)},
+    0
+  },
+  {
+    {W(0x0000d878404993d4), W(0x00007405cd9d1f46), W(0x0000ece3684fed8f),
+     W(0x000050e346a60e90)},
+    {W(0x00005cec119d979e), W(0x0000180c91d83621), W(0x00008ea730d9a69e),
+     W(0x0000430704a1ec11)},
+    0
+  },
+  {
+    {W(0x0000680f84b0fd00), W(0x00006d12290e2c01), W(0x0000028173b27b3b),
+     W(0x00002c35b1a599e0)},
+    {W(0x0000f177acfaf99d), W(0x0000c8debd84c713), W(0x0000930175d687da),
+     W(0x0000f1e1a27b5782)},
+    0
+  },
+  {
+    {W(0x0000beb89616ac66), W(0x000055756dcc9ff7), W(0x0000e30578c23704),
+     W(0x00005a3b2f6c9c21)},
+    {W(0x0000186e45ef67fa), W(0x0000a83b4073cb53), W(0x0000e2b69acac4bb),
+     W(0x0000c2e7f604bbc2)},
+    0
+  },
+  {
+    {W(0x0000c6c5b82fc79f), W(0x000062342e691e2c), W(0x0000f1592e300102),
+     W(0x00001915bc41c865)},
+    {W(0x0000079bdb563ae1), W(0x0000fe33deb2f720), W(0x00005680bec04b5e),
+     W(0x00008c6f60cf4c44)},
+    0
+  },
+  {
+    {W(0x0000e58bb4cc2d8d), W(0x00001be47cebfeea), W(0x00006b16d5bf1023),
+     W(0x000000f59e233de9)},
+    {W(0x0000e84bdc444e98), W(0x00005160149d07e4), W(0x00000dcc4a50e48f),
+     W(0x00001cd0667c2d51)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000034c349d986be), W(0x0000a90bd1ba7821), W(0x00004abfe4146387),
+     W(0x0000d9b3e2f52616)},
+    {W(0x00004fb9c8d1d414), W(0x000079639fe47be5), W(0x00000d07f9b74f7d),
+     W(0x00003e7ae645d5dd)},
+    0
+  },
+  {
+    {W(0x0000673bd4e149ed), W(0x00000ded601caf08), W(0x00009ae53b1d6c9c),
+     W(0x0000a7a7a99a3ac6)},
+    {W(0x0000dfa75c6e9246), W(0x00002fee1295503a), W(0x0000f676ce10b3d7),
+     W(0x0000520927c20bc6)},
+    0
+  },
+  {
+    {W(0x00005599944adae4), W(0x0000b5308c87ede6), W(0x0000c6547bcf4fcb),
+     W(0x0000037780324827)},
+    {W(0x0000ae55474ed933), W(0x0000c9c86395d06b), W(0x00005d18bdbed9d0),
+     W(0x000009bb603990c8)},
+    0
+  },
+  {
+    {W(0x0000940cbf06e0be), W(0x00001b692374fe19), W(0x0000d7c94b592e5a),
+     W(0x0000b870d62d5671)},
+    {W(0x000050f8a79ef27f), W(0x0000ee290c0c5c9b), W(0x00002d2c35e14993),
+     W(0x000019f5547f5085)},
+    0
+  },
+  {
+    {W(0x00005359879a1c14), W(0x00008bbbc20c72cb), W(0x0000d0716459ea7e),
+     W(0x00009d1a135b6287)},
+    {W(0x00000f5159aa2623), W(0x000005af3c3cee4c), W(0x000073ad81a7fdc6),
+     W(0x0000fafd101d3190)},
+    0
+  },
+  {
+    {W(0x00007e0910d7bed7), W(0x0000513964f73547), W(0x0000862398278de5),
+     W(0x0000a9c78b8af05e)},
+    {W(0x000014faf965e870), W(0x00009511eb623519), W(0x00007ccd18fc3326),
+     W(0x000046dbaa052965)},
+    0
+  },
+  {
+    {W(0x00003c44c98ee67a), W(0x00000a1f402a9e5f), W(0x0000acc826492066),
+     W(0x0000dfee07bf55ee)},
+    {W(0x0000520b83751f73), W(0x000012bf0f400051), W(0x0000e6871ccf10e5),
+     W(0x0000e14a0e918549)},
+    0
+  },
+  {
+    {W(0x000016496e30b1af), W(0x0000db8b22ef00df), W(0x0000b05c4f6fcb52),
+     W(0x0000d729224c94cd)},
+    {W(0x00001e31546151ca), W(0x0000ff4a3fc1f387), W(0x00008af934b1703a),
+     W(0x00000d32a2a26880)},
+    0
+  },
+  {
+    {W(0x0000c47d6cedd400), W(0x0000342face8b83f), W(0x0000bd4475d55f54),
+     W(0x000049c9f91c189a)},
+    {W(0x0000ab24735c189e), W(0x0000b5511e18a5ea), W(0x000076486c8f89d7),
+     W(0x0000866485e9c23b)},
+    0
+  },
+  {
+    {W(0x0000f7e6c4d1e626), W(0x000088fb4796378f), W(0x0000fac4df95e462),
+     W(0x00007a949abb77d5)},
+    {W(0x000006c653f2e253), W(0x0000caadd142d85a), W(0x00000c5ac379ac0c),
+     W(0x000092bbcf596817)},
+    0
+  },
+  {
+    {W(0x00008162279fdda6), W(0x0000f3e376413b1d), W(0x0000cbb37a513402),
+     W(0x0000daab5c585023)},
+    {W(0x00006ffb357c8212), W(0x00007da3a85d94e7), W(0x00000ba1f0e129dd),
+     W(0x0000b6839fcabbb9)},
+    0
+  },
+  {
+    {W(0x00007aa755c9f977), W(0x00000998a8bd0883), W(0x00006fe2bb76028d),
+     W(0x0000ccd94be087e4)},
+    {W(0x000013d6dd652de2), W(0x00008e4a15a9a646), W(0x0000e3f71cd99b5a),
+     W(0x00002c4108a696e7)},
+    0
+  },
+  {
+    {W(0x00003c44001da3a3), W(0x0000892650b1074a), W(0x00003592d4c25c91),
+     W(0x00002e60c6bef5aa)},
+    {W(0x0000a805904228b6), W(0x00002a70709c8284), W(0x00005aa01e48d32b),
+     W(0x0000cdcbbca0dce8)},
+    0
+  },
+  {
+    {W(0x0000b62e0ec27d11), W(0x0000058016a6aad7), W(0x00001a3b89922b5f),
+     W(0x0000c6a30a5be2dc)},
+    {W(0x0000a88068f72904), W(0x0000a0e24d70a80a), W(0x000007e9ed5910ba),
+     W(0x00005ddac8b29e2a)},
+    0
+  },
+  {
+    {W(0x00002ef49b05925c), W(0x00004de07c81403c), W(0x000086ea98b899e7),
+     W(0x00000ef63723c530)},
+    {W(0x0000f66f731df129), W(0x000057ce1efc1afd), W(0x0000ee7e7ef13ec3),
+     W(0x000053ba28022b94)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00001e3b0d9979a9), W(0x0000042cb2e2c788), W(0x00007f0796a582ba),
+     W(0x00004191fb96f78a)},
+    {W(0x000068754beda193), W(0x0000030ebd69f530), W(0x0000c67f94e8b959),
+     W(0x0000ee884d47ccc4)},
+    0
+  },
+  {
+    {W(0x0000aeee0ecaaa0d), W(0x0000d2c284ab02b4), W(0x0000e2e9ea6921d8),
+     W(0x0000c9144151e671)},
+    {W(0x00007b461727e17c), W(0x0000375d5034d1c4), W(0x0000a228d98fa421),
+     W(0x0000ea6066d39856)},
+    0
+  },
+  {
+    {W(0x0000307aac77d7af), W(0x0000712a3c51c796), W(0x0000620287f042c0),
+     W(0x00008fd30b60dcc0)},
+    {W(0x00000feb3ae5e569), W(0x000046d3e89afe0d), W(0x0000ecce67200a58),
+     W(0x0000d9a10fbc2b48)},
+    0
+  },
+  {
+    {W(0x0000d191fa3b41f0), W(0x0000063c12ed6759), W(0x00002c03c1807f71),
+     W(0x00001920a4df0f40)},
+    {W(0x0000d2ec1f571f2d), W(0x0000da869c53f9f7), W(0x0000ecf6a3fb9e2e),
+     W(0x000037df506ab873)},
+    0
+  },
+  {
+    {W(0x0000eed1b1957968), W(0x0000f8a50bdc7844), W(0x0000fbc726cfb0fe),
+     W(0x0000c9b20a7dc452)},
+    {W(0x00009c5cb46c899e), W(0x0000dfba7ab3b569), W(0x0000caf70dbd827d),
+     W(0x00007711f2051321)},
+    0
+  },
+  {
+    {W(0x000036da5805eda3), W(0x000043054934344f), W(0x00005ea2c5cb6841),
+     W(0x000038f3ecfa8e42)},
+    {W(0x0000313dc1076628), W(0x0000e813d2a25309), W(0x00008a65762d5941),
+     W(0x0000020ac42e87fc)},
+    0
+  },
+  {
+    {W(0x00001ebd8e2fa06f), W(0x0000b7bb0c1c9549), W(0x0000323ef39628b6),
+     W(0x00007f01b36d6be4)},
+    {W(0x0000611fed7bba8f), W(0x000051cc116c47f0), W(0x0000da0a266b761f),
+     W(0x00002842f30c540c)},
+    0
+  },
+  {
+    {W(0x0000a1bb2c8f0b4f), W(0x000097fd281ab947), W(0x000041969fc1c1d9),
+     W(0x0000cc99e6476be1)},
+    {W(0x00002ae4f335d7aa), W(0x0000fb53086f665b), W(0x0000b89343e69772),
+     W(0x00003977aa4ed0cd)},
+    0
+  },
+  {
+    {W(0x0000af48c8635c1f), W(0x00001cf47afcbe42), W(0x0000d9d3e20a6e93),
+     W(0x000052230a5cc6fc)},
+    {W(0x0000f4c16b031d15), W(0x00008858461c07fa), W(0x00007d8550af0218),
+     W(0x00002c9d33ef0c2e)},
+    0
+  },
+  {
+    {W(0x000092af3c296c81), W(0x0000ab0e9d8c9141), W(0x0000d8962f851db1),
+     W(0x000081d5cb29252b)},
+    {W(0x000010f3807eae58), W(0x00005701bc285f04), W(0x00009955f8382bab),
+     W(0x0000bfafdd208cba)},
+    0
+  },
+  {
+    {W(0x000041d1aa822704), W(0x0000f2a5a3388e25), W(0x00009f6df23da93a),
+     W(0x0000437e3a8ab713)},
+    {W(0x0000466400c2c925), W(0x000011408c2b3773), W(0x000020b992cbe927),
+     W(0x0000efea818d0faf)},
+    0
+  },
+  {
+    {W(0x0000abff4c1a763b), W(0x000020998a276dd9), W(0x000019a0daa3e3e4),
+     W(0x0000ff69a1d1806e)},
+    {W(0x0000d6df93b1e41e), W(0x0000aca15bca9e44), W(0x00007fb1d545e202),
+     W(0x0000aa52a9c8583f)},
+    0
+  },
+  {
+    {W(0x00005979f6511650), W(0x00005cd55bca8aa5), W(0x0000970e00ac892d),
+     W(0x00004ecefdc0c059)},
+    {W(0x0000cfa17c18cb58), W(0x000031c888de60cd), W(0x00009a1f02704458),
+     W(0x0000887d664634b2)},
+    0
+  },
+  {
+    {W(0x0000c323e47ea40f), W(0x00001fcbc1e69633), W(0x0000fe913021d1ce),
+     W(0x0000b80d3ee6f776)},
+    {W(0x0000e7a4be4e3aec), W(0x00004031d83b79e4), W(0x00004fa87b3e392f),
+     W(0x0000d5d911312d50)},
+    0
+  },
+  {
+    {W(0x000094c9a824da67), W(0x00006222416ff2e6), W(0x0000222656fc1618),
+     W(0x00007c54f2fb0824)},
+    {W(0x00009e28d493d2c7), W(0x0000caf14956828d), W(0x0000ed2eed1d04cd),
+     W(0x00003f0d11be5f23)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000035a0ba5d1b22), W(0x000074e7f4b6e5da), W(0x00008eda1b716c5b),
+     W(0x0000cf81def62a35)},
+    {W(0x00001b3dba572d36), W(0x0000f3b9cbd2bac7), W(0x0000598dd97bf620),
+     W(0x0000c720af12bdfb)},
+    0
+  },
+  {
+    {W(0x0000e20d9f0f4410), W(0x0000b4684b3b6ca2), W(0x0000057af83515d5),
+     W(0x000033ea57cb2e84)},
+    {W(0x0000c87aa5276f35), W(0x0000fcb2fd66f558), W(0x0000f7c50db72c53),
+     W(0x0000a15d3a0acb0b)},
+    0
+  },
+  {
+    {W(0x0000e02b24cd4ce7), W(0x0000fac7093105ce), W(0x0000cf92a6bd13ef),
+     W(0x00008e521a90a9c9)},
+    {W(0x00004d4660815af5), W(0x0000a6d12388205c), W(0x000058b12b666b54),
+     W(0x0000870bb78ddeed)},
+    0
+  },
+  {
+    {W(0x000039ea9f29990e), W(0x0000914191d3ce0f), W(0x0000f89f7967d3b9),
+     W(0x0000ed68fc779960)},
+    {W(0x000012bc278a8105), W(0x000051ecf20b5a85), W(0x000001671bf6794e),
+     W(0x00000187aeeb4835)},
+    0
+  },
+  {
+    {W(0x0000182c1462fb1e), W(0x00003de792b4b928), W(0x0000d1d24d658aec),
+     W(0x0000a00873e4f781)},
+    {W(0x0000247412aa84d0), W(0x000094f2bf15dfab), W(0x0000498f5579b50b),
+     W(0x0000ff475a0303ad)},
+    0
+  },
+  {
+    {W(0x000088bbb04137c3), W(0x000038255d2097a2), W(0x0000bb0803afb8f8),
+     W(0x000049fe5b2100cc)},
+    {W(0x00008671da8cb102), W(0x00003f6f42f28219), W(0x0000e2fe818067a3),
+     W(0x00001112dc800ea3)},
+    0
+  },
+  {
+    {W(0x000000363aadaa1f), W(0x00000fd3794eeaa8), W(0x00009f6d61e908d2),
+     W(0x0000abf90f5eb5b7)},
+    {W(0x000040867f3dff7e), W(0x000016351c37dda6), W(0x0000a7e03d71ea6f),
+     W(0x0000eac7dd4e1b1f)},
+    0
+  },
+  {
+    {W(0x0000b959cd36a12b), W(0x0000627cad09027a), W(0x00000a9ed7b36007),
+     W(0x0000205759c95e28)},
+    {W(0x00002bdd44fddc5a), W(0x0000e95d96061f44), W(0x0000d4502e82d1ca),
+     W(0x0000c5c1c42daae3)},
+    0
+  },
+  {
+    {W(0x00002f05b92f4605), W(0x0000e504d4e18ad5), W(0x00006ed935bf6372),
+     W(0x0000f9631bf928c4)},
+    {W(0x00006349eb433215), W(0x0000a6f40fb6a98a), W(0x000001541ca13a4b),
+     W(0x00002e1c69b3ae0b)},
+    0
+  },
+  {
+    {W(0x000048c59a4ab23b), W(0x000014f5e349ad2b), W(0x00002bdfbc7b2089),
+     W(0x00002ce8f60db075)},
+    {W(0x00003cb2aac8f50a), W(0x000001302583709c), W(0x000075d13018bade),
+     W(0x00005a11a79a95ad)},
+    0
+  },
+  {
+    {W(0x00002a7697de2c7b), W(0x00008ef27ab7c7cd), W(0x0000563e2b66fd2e),
+     W(0x00000b98b2b7a55c)},
+    {W(0x000007d1479df028), W(0x0000bd55f84d3d53), W(0x0000a97a77ab2b91),
+     W(0x000055f78125bd10)},
+    0
+  },
+  {
+    {W(0x000071f00d3afc1a), W(0x0000004bd034617e), W(0x000091e52ab95684),
+     W(0x0000a847d7297ff8)},
+    {W(0x0000c3f6669f39d8), W(0x0000badd0a52fe3f), W(0x0000363b5a566141),
+     W(0x000046e05d14c093)},
+    0
+  },
+  {
+    {W(0x0000b3b97ba7a901), W(0x0000dba69be4231e), W(0x0000c83552708ce7),
+     W(0x0000bb3a2cefb55d)},
+    {W(0x000077fdf467e9d1), W(0x000077a61d669604), W(0x00007cbd70c9e94f),
+     W(0x0000089cdefe2b68)},
+    0
+  },
+  {
+    {W(0x00003c2d2692b3e3), W(0x00006b46bc23626c), W(0x0000041ef98e1895),
+     W(0x0000e8313561874c)},
+    {W(0x0000a74c387b07b3), W(0x0000c3fb441cb607), W(0x000009e7aff46688),
+     W(0x0000223f4e0ebba5)},
+    0
+  },
+  {
+    {W(0x0000a2e375965fb1), W(0x0000ffa51e3d6576), W(0x00008b37d61fc20b),
+     W(0x0000ac95a1369238)},
+    {W(0x0000692b1d44679b), W(0x00008a49de38af07), W(0x0000e3c3f911927f),
+     W(0x0000adc37442cb4b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000049c55d7c48d8), W(0x00005a927c35c396), W(0x000071fbeb2cdfae),
+     W(0x000067e30cbdcba6)},
+    {W(0x0000cee1ecbfbe7d), W(0x0000063015777a83), W(0x0000f5c3ce32d03c),
+     W(0x0000a93549c45810)},
+    0
+  },
+  {
+    {W(0x00001a7257b5f01d), W(0x00001c31929af745), W(0x0000c45cb37d3fce),
+     W(0x00002b6cacb0c600)},
+    {W(0x00002b4547a577b6), W(0x0000145056430824), W(0x000009dd294c91bf),
+     W(0x0000e065afcc4df1)},
+    0
+  },
+  {
+    {W(0x0000721f210f2fa9), W(0x0000e33817efda03), W(0x0000683be9fb7447),
+     W(0x00008692bf5b6368)},
+    {W(0x00005ae8165f5ee4), W(0x00009aa4bf8e4833), W(0x00008686906ea509),
+     W(0x0000464960b006d9)},
+    0
+  },
+  {
+    {W(0x0000e9d2491151e4), W(0x000008d1bd3349ba), W(0x000004740c0fafe5),
+     W(0x0000c22c1ba321ce)},
+    {W(0x00006cb35ce56672), W(0x00009a61c88104ec), W(0x0000b2c33a93332d),
+     W(0x000049f33c3ba43b)},
+    0
+  },
+  {
+    {W(0x0000aceb29947a39), W(0x00006734770b1a2a), W(0x000036daa5cf650c),
+     W(0x0000fa74864525ae)},
+    {W(0x00005478ab2aff35), W(0x000022c244ac7232), W(0x0000998c68846918),
+     W(0x000019778820b3b4)},
+    0
+  },
+  {
+    {W(0x00008a139f3e9e19), W(0x0000275a01f41e10), W(0x00002831bdc0117f),
+     W(0x0000211d192d2fa5)},
+    {W(0x00003f941d91c028), W(0x0000a6ef7f16bb68), W(0x0000a2d63b21c8c1),
+     W(0x0000dff2b56b0775)},
+    0
+  },
+  {
+    {W(0x0000fa2b5d0562d6), W(0x0000bf6c5f3d72c4), W(0x00001baa0e9e212f),
+     W(0x00002bf3ff0bc309)},
+    {W(0x00007ce2608c109b), W(0x00007e4b106da4d5), W(0x00000098136e5985),
+     W(0x0000886d5bb90fee)},
+    0
+  },
+  {
+    {W(0x00003d35587135ed), W(0x00004a9d51a48fa0), W(0x0000d317d37c29ea),
+     W(0x0000c37599b97759)},
+    {W(0x00000b48b42f8489), W(0x000009af5cf3ecf6), W(0x00002f9bc5535ad4),
+     W(0x00004d2d0cc97bf6)},
+    0
+  },
+  {
+    {W(0x00006173547ed581), W(0x00000403b4b19204), W(0x0000b5cf21a24714),
+     W(0x0000486c355580b8)},
+    {W(0x0000415fe277c059), W(0x00009e59f54f9f74), W(0x0000b2c0c51e00d9),
+     W(0x0000f27621c78ac6)},
+    0
+  },
+  {
+    {W(0x00003c4db97be16d), W(0x000047b120de0568), W(0x0000e07b71f10468),
+     W(0x0000da9cb5756568)},
+    {W(0x0000370ce51e86cb), W(0x0000da2196ff1db3), W(0x00006380e4c970d8),
+     W(0x0000f66731391c57)},
+    0
+  },
+  {
+    {W(0x0000b5959ed40d03), W(0x000028068c160e78), W(0x0000b6ff4882eeff),
+     W(0x00003d50197efc72)},
+    {W(0x0000a3b45787b1c4), W(0x0000a6ac383b3ac6), W(0x0000b3804f2a405e),
+     W(0x000054deafea5238)},
+    0
+  },
+  {
+    {W(0x0000a06c20e93bd5), W(0x00008b88a910d01a), W(0x0000bd1263d86df6),
+     W(0x00009dee44dbe962)},
+    {W(0x0000368230d8ed6f), W(0x0000ec5cd90ecd41), W(0x0000ac4a73d4106b),
+     W(0x0000d0fc98ad2772)},
+    0
+  },
+  {
+    {W(0x000005fc041569f5), W(0x000082d182ccfd23), W(0x0000eb8aa1b62b06),
+     W(0x00008bd5971c104c)},
+    {W(0x00009bc541b97033), W(0x00000c8ad0ccef31), W(0x0000ae2e4838f58f),
+     W(0x000093ed1513426e)},
+    0
+  },
+  {
+    {W(0x0000b9bb4b3037e2), W(0x00008ef822d9953d), W(0x00006b47ffc815b3),
+     W(0x0000d35cd4062f41)},
+    {W(0x00005a8a35fb1531), W(0x0000a992cf53d86a), W(0x0000e92f84922f1a),
+     W(0x0000490b657ac889)},
+    0
+  },
+  {
+    {W(0x0000cde94e13ced5), W(0x000084e4460fd0b2), W(0x00005edad4e22e0f),
+     W(0x00007ac22657f14c)},
+    {W(0x0000e8bec0d60a7b), W(0x00007204587ec2f6), W(0x00003fc9af41250d),
+     W(0x0000acfaeb7a567e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000a451ca59bd50), W(0x0000bab866b5cfae), W(0x000031bd0d024d62),
+     W(0x00007fe01aa66fdd)},
+    {W(0x0000f3d8f51b2da1), W(0x0000caf3195e5ffb), W(0x00003cf4e4aeaa59),
+     W(0x00006217317f4252)},
+    0
+  },
+  {
+    {W(0x00004c06c03ad7d9), W(0x000094b4f1164951), W(0x0000905c38cf94b0),
+     W(0x0000ebf2ba007acc)},
+    {W(0x0000b248bb8f859d), W(0x0000d38ea7a232d7), W(0x00001501dcae9f7c),
+     W(0x0000f3e0cbe190ae)},
+    0
+  },
+  {
+    {W(0x00007c7da70738fa), W(0x0000ced1c7842baa), W(0x000030299ec7fd08),
+     W(0x0000abaceb0dd4b9)},
+    {W(0x000019737c79e7a2), W(0x00009fec18f90920), W(0x00007a64f4f0a4b7),
+     W(0x00005397c839d8db)},
+    0
+  },
+  {
+    {W(0x000001f6a71f9805), W(0x000075c58e004aad), W(0x0000f1f71c9a5604),
+     W(0x00000c342f52391d)},
+    {W(0x0000815b4d730078), W(0x0000720a70b5e998), W(0x00000244effb6bd3),
+     W(0x00003810771b128d)},
+    0
+  },
+  {
+    {W(0x00006b093e57f95f), W(0x0000d3721d7974ea), W(0x00004470c75db8c1),
+     W(0x0000033ed4f99c15)},
+    {W(0x0000f1da21e59cc3), W(0x000087c58f00b46e), W(0x0000b80c27b8a3d4),
+     W(0x0000b8dcf19f9387)},
+    0
+  },
+  {
+    {W(0x0000fa5d5cd2812a), W(0x00003406200efee0), W(0x0000fd2945c29112),
+     W(0x00003e64dc569af1)},
+    {W(0x0000e17b5b9c1478), W(0x0000de43d235c143), W(0x000097b2f079f1c5),
+     W(0x00009f8e46517094)},
+    0
+  },
+  {
+    {W(0x000075a3a60fba00), W(0x00006ee47d18cb3f), W(0x0000098409627264),
+     W(0x0000b2ace628a0d4)},
+    {W(0x0000f70bd762f5f9), W(0x0000cec6f4ee627e), W(0x000094d8dda57c29),
+     W(0x0000af45e2518e75)},
+    0
+  },
+  {
+    {W(0x00008d16accfc179), W(0x00007d071fb84faf), W(0x000005952c35c396),
+     W(0x0000c6e8dfab2911)},
+    {W(0x000072894e201b7e), W(0x00002b61657e3db6), W(0x0000ccaa9073ead1),
+     W(0x000071698f4b5ffa)},
+    0
+  },
+  {
+    {W(0x0000e8666391f7a5), W(0x000056b0f3677985), W(0x00008db5524b62c7),
+     W(0x000018279a8d4db7)},
+    {W(0x0000859cf8b50c5b), W(0x0000f53666729fd4), W(0x00009c3a9e8082ce),
+     W(0x0000fb5d610fd8a9)},
+    0
+  },
+  {
+    {W(0x0000478802d415af), W(0x0000f7fe5609ef1d), W(0x0000382a1296ae08),
+     W(0x000092e9ec5f8876)},
+    {W(0x00001e30221a5335), W(0x0000df6c701d7aab), W(0x0000084c17465fdb),
+     W(0x00000cb5184fbb4e)},
+    0
+  },
+  {
+    {W(0x0000464e76941fec), W(0x000044ad56190470), W(0x0000771489544bef),
+     W(0x0000ec1e669dcac2)},
+    {W(0x00003f7cb7faacec), W(0x0000354f10fd72e4), W(0x0000700e2adacc0b),
+     W(0x0000c94585048219)},
+    0
+  },
+  {
+    {W(0x00006e2c0c49328d), W(0x000010e2f5da20d9), W(0x00004fb839641730),
+     W(0x0000a6b52add62af)},
+    {W(0x0000bcf7af3afedb), W(0x000089048a94e674), W(0x0000597e52621c65),
+     W(0x00006825da746db5)},
+    0
+  },
+  {
+    {W(0x00003995347ee720), W(0x00000c916d0e6d85), W(0x000020f8aacb580e),
+     W(0x000046eb6fe541e2)},
+    {W(0x0000dad6adde1d72), W(0x0000a4a723dc1ed0), W(0x00000691cd09a01b),
+     W(0x00005bb5a89c1edd)},
+    0
+  },
+  {
+    {W(0x00001a7674423da1), W(0x0000243b9b5e99f1), W(0x0000d03af43786f9),
+     W(0x000020a65d0bd9d1)},
+    {W(0x00008bb7aa81d72f), W(0x000042e8e4ce237a), W(0x0000e19e53df9e1f),
+     W(0x0000df00b15ccdad)},
+    0
+  },
+  {
+    {W(0x000004396dc73836), W(0x0000f84f73b966b9), W(0x0000f8a564b293c0),
+     W(0x00008912dc4fcd99)},
+    {W(0x0000cc9c58d932eb), W(0x00005e5fa4d2aac2), W(0x000049267708e716),
+     W(0x0000f552d7b1134e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000c0ea0e32b059), W(0x000074101902fe75), W(0x000084c4e51a10db),
+     W(0x00006e02e109fe37)},
+    {W(0x0000921c9eb4b13b), W(0x00005a0b4169ad73), W(0x00008a2987913c97),
+     W(0x0000cb80564276d1)},
+    0
+  },
+  {
+    {W(0x000004624a9463a6), W(0x0000423b6b22628c), W(0x000044496c8d4b39),
+     W(0x00009549ca0c79fc)},
+    {W(0x000022eef6c86187), W(0x000082ef7f0fc98e), W(0x00005f0eaa3a1364),
+     W(0x0000c8795c7b886a)},
+    0
+  },
+  {
+    {W(0x0000b910333d50d5), W(0x000051ef96da8c15), W(0x0000ddcd2852cea9),
+     W(0x0000e0b41d98badb)},
+    {W(0x00006ed946775f59), W(0x00009b40d5ce4b07), W(0x00003640c9b4f0b2),
+     W(0x000035bd5237c36c)},
+    0
+  },
+  {
+    {W(0x000096ff2dda9bd5), W(0x000033772d271907), W(0x0000e0b7ab760879),
+     W(0x000078312bcec4fe)},
+    {W(0x0000ef68edf17418), W(0x00000aa585c3c345), W(0x0000112dbb321555),
+     W(0x00005b7916b0d3e8)},
+    0
+  },
+  {
+    {W(0x00004c32ea5cbf3b), W(0x0000f1af191b4c0d), W(0x0000ea5202f14c84),
+     W(0x0000c1c66515059f)},
+    {W(0x0000c6c2d13c489c), W(0x00000449ab0d151a), W(0x00008c76a790f976),
+     W(0x0000589f0ee9a1c5)},
+    0
+  },
+  {
+    {W(0x00004564a7cf17d2), W(0x0000e1ea480e1ecd), W(0x0000d1a35e082a11),
+     W(0x00004ca62f36ddce)},
+    {W(0x00009382727a7e69), W(0x000072357e8249c6), W(0x000012c3ea4871c1),
+     W(0x000037898518834e)},
+    0
+  },
+  {
+    {W(0x0000228a232a3877), W(0x000079d4289259f2), W(0x000019895474b6ad),
+     W(0x0000559a09bf8039)},
+    {W(0x000007887fc8bc3a), W(0x00005c4954c34c62), W(0x0000dd410efbf774),
+     W(0x000021da33e08b44)},
+    0
+  },
+  {
+    {W(0x0000bc5ba655c365), W(0x0000c782178a5347), W(0x000009c5be26adaf),
+     W(0x00007816616fab1f)},
+    {W(0x0000b4f8eba0796b), W(0x00006dcca4d08df3), W(0x0000781094d5c4be),
+     W(0x000027cfad79e0c2)},
+    0
+  },
+  {
+    {W(0x0000b44b6900760b), W(0x0000eeef4ac7fc72), W(0x0000cd6016331057),
+     W(0x0000e35cc8d29619)},
+    {W(0x00005a716af727a6), W(0x0000834f304cddc7), W(0x0000f0f0f8340505),
+     W(0x00007597275221c7)},
+    0
+  },
+  {
+    {W(0x000040ab11332bd9), W(0x0000f7aff590938e), W(0x0000c5ada3ef6c0e),
+     W(0x00008828e6dba31e)},
+    {W(0x00006e2ef4caf24f), W(0x00003e2965b2f42c), W(0x000009f2076fd433),
+     W(0x00006a822ff1e8e1)},
+    0
+  },
+  {
+    {W(0x0000a9dc370aad0d), W(0x00009fa8ea2e798e), W(0x000089d4ce41d5d0),
+     W(0x00009c1d336b5f05)},
+    {W(0x000029f8b7f661e4), W(0x000024ca6176af4c), W(0x00003555c4eb9182),
+     W(0x00009c7e0b225d9f)},
+    0
+  },
+  {
+    {W(0x0000301af2a5fb55), W(0x00002e3cc7ac8ae5), W(0x0000bc1bd1cf695c),
+     W(0x000064aae4348617)},
+    {W(0x0000573911428a5d), W(0x00008d3bb2c0b95a), W(0x0000c0bcfbec233a),
+     W(0x00007bca9ae265c8)},
+    0
+  },
+  {
+    {W(0x000063d18db38ba1), W(0x0000664e5d7d2ed6), W(0x000009c028b4cc1c),
+     W(0x000008f22c4d1e2b)},
+    {W(0x0000c4b99483055e), W(0x00007c9fbb6ae088), W(0x000071e195760740),
+     W(0x00003b40440e5d5c)},
+    0
+  },
+  {
+    {W(0x00004834dd20776f), W(0x000056c3151da3f2), W(0x000072b364574e4e),
+     W(0x0000a81a093c1618)},
+    {W(0x000071db957605c9), W(0x00009e61676c1674), W(0x0000dfdf8f142579),
+     W(0x0000539b3a92c78a)},
+    0
+  },
+  {
+    {W(0x0000ddaacb385143), W(0x0000de43535cb581), W(0x0000afa90ee9fa18),
+     W(0x0000e11f0b5c3fc1)},
+    {W(0x0000347646d784ba), W(0x000003181e213e12), W(0x00008fbd3706b8c6),
+     W(0x0000f75eae468764)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000debd4228c31b), W(0x0000dba105b87ebb), W(0x00003ad2dddf4fd3),
+     W(0x0000f994d7cb0067)},
+    {W(0x0000b43e282eff65), W(0x0000044815a88336), W(0x00000c662c4bae88),
+     W(0x00000212e0524680)},
+    0
+  },
+  {
+    {W(0x000011d31f646d84), W(0x00002379966adfe6), W(0x00007a51284e737c),
+     W(0x0000c3cd6e74f809)},
+    {W(0x00008660c82ee6cd), W(0x0000eb9577c83875), W(0x00006e7e1a97a130),
+     W(0x00008553f062e887)},
+    0
+  },
+  {
+    {W(0x0000a1b205459c08), W(0x00000147ac1158de), W(0x0000512321005e4e),
+     W(0x000031df3890fc38)},
+    {W(0x0000cd27bf45bbcf), W(0x0000e57cff3b0ecc), W(0x0000e2bd21eea9b1),
+     W(0x00005d80cae518a2)},
+    0
+  },
+  {
+    {W(0x00001cd99d233c50), W(0x0000393ac154ddb7), W(0x000040341a075402),
+     W(0x0000eddf82259d0a)},
+    {W(0x0000cb1a4669424b), W(0x000085d8b3bde4bd), W(0x000053aa896b4de1),
+     W(0x0000f91d18111549)},
+    0
+  },
+  {
+    {W(0x0000e2137411881f), W(0x00008fd51e9c73e1), W(0x00006c10467c08ce),
+     W(0x00008845b9f9f1b6)},
+    {W(0x00005673062f53b5), W(0x00003e32a58e23f6), W(0x00005fd696b17138),
+     W(0x0000b8f89a657090)},
+    0
+  },
+  {
+    {W(0x00009e2d741a3e48), W(0x000002b8c76690b0), W(0x0000d6f7d5762aeb),
+     W(0x00006a25f074d5d5)},
+    {W(0x000044143dd9c1e0), W(0x000024d8e026e334), W(0x000035ac8da4cdc6),
+     W(0x0000c803a74e6ae6)},
+    0
+  },
+  {
+    {W(0x0000de9487a3013e), W(0x0000364da319d9d6), W(0x0000b92fd3a0f59c),
+     W(0x00003637ca2a261c)},
+    {W(0x0000fcfd4e50999d), W(0x0000f3ebba160d3a), W(0x00005538b0aa9e52),
+     W(0x0000727592b7a686)},
+    0
+  },
+  {
+    {W(0x000025506a3f653c), W(0x000015d99f9956d3), W(0x0000a61f933c526e),
+     W(0x00001f60284e9be9)},
+    {W(0x000091cde9e6ec71), W(0x00004d0681376b32), W(0x000012717ab1da3a),
+     W(0x0000267f5804f197)},
+    0
+  },
+  {
+    {W(0x00007dfcaef597f4), W(0x0000a42a6b8399b2), W(0x00002a1c188a6ceb),
+     W(0x00009f393733d2a6)},
+    {W(0x00008c6dfe25fff5), W(0x000073f8c406d661), W(0x000055d600873d5f),
+     W(0x0000ef825283c51c)},
+    0
+  },
+  {
+    {W(0x0000efdae4cf53a2), W(0x000041355f91e4f5), W(0x0000c24c9ae5fdb5),
+     W(0x0000c88c4b44cad3)},
+    {W(0x0000dc26588b6994), W(0x00002b0a1d683cc6), W(0x00000cb4050be19d),
+     W(0x000025e53e88cf5e)},
+    0
+  },
+  {
+    {W(0x000075996af81218), W(0x000030ab23085330), W(0x0000289bf321016e),
+     W(0x0000c389f26cf1b1)},
+    {W(0x0000fc53d6b13d93), W(0x00008b6d8919d063), W(0x00006717543bd2fc),
+     W(0x00003b206d4fd779)},
+    0
+  },
+  {
+    {W(0x000030185fa3d0f9), W(0x00008c54f2f69d0f), W(0x000092743e7cba4b),
+     W(0x0000658198869255)},
+    {W(0x0000a1f7f81769a8), W(0x0000ef89c2627251), W(0x00003ccbd8e18265),
+     W(0x0000fd015d28318e)},
+    0
+  },
+  {
+    {W(0x0000d98954675313), W(0x0000f6af574d7abc), W(0x0000ef8230b52f48),
+     W(0x00001c2b2bf1c1f1)},
+    {W(0x0000e33af4a6f1e4), W(0x000027f7f71d21a4), W(0x0000c49ee2a1ece1),
+     W(0x0000355cb9bb73e7)},
+    0
+  },
+  {
+    {W(0x0000e10bbe49408e), W(0x00008041917c25e2), W(0x00009ea71ed8c6bb),
+     W(0x00000657c5e8ce96)},
+    {W(0x000066c57e282025), W(0x00006997891acdc2), W(0x0000adac7a526621),
+     W(0x0000256a09449ce6)},
+    0
+  },
+  {
+    {W(0x00003f35ec9c5947), W(0x0000973d1f71b6a9), W(0x0000964a167b6f9b),
+     W(0x00001cbf362ec4b7)},
+    {W(0x0000119c34720e2f), W(0x00008dad1502f90d), W(0x00006dd27932c738),
+     W(0x000070325a14eb23)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000bf020388e2d9), W(0x00003ae1e678bae1), W(0x0000d6e91e7a93b5),
+     W(0x00005e542b93edb5)},
+    {W(0x000039f4bf1c2b2b), W(0x00006c2b0a126d32), W(0x0000640934647992),
+     W(0x0000f9ebb891eeec)},
+    0
+  },
+  {
+    {W(0x00000654ef79bc72), W(0x0000d981966c029c), W(0x0000fd600d0de608),
+     W(0x000054f8b7f059f7)},
+    {W(0x00004428facca1f6), W(0x0000b570fa8d2116), W(0x0000086f274ebd8a),
+     W(0x000094927a689229)},
+    0
+  },
+  {
+    {W(0x0000f271f7b52f93), W(0x0000065766c52170), W(0x0000070e4f770e38),
+     W(0x000039f5b193aca1)},
+    {W(0x0000dfc11b0f7d62), W(0x0000912da5f36fcb), W(0x000024ae644abae8),
+     W(0x0000920d0713c08d)},
+    0
+  },
+  {
+    {W(0x00002f156963a2da), W(0x0000981b9ffdc528), W(0x00008024e2248348),
+     W(0x0000d0b43280b121)},
+    {W(0x0000417e41031f4f), W(0x00009ab00aa40ee6), W(0x00004553c1f7ac33),
+     W(0x00001d73193872d2)},
+    0
+  },
+  {
+    {W(0x0000e18371deb61f), W(0x00008b1a55e4a963), W(0x0000a1cd1fd46a3d),
+     W(0x000032476bc6de08)},
+    {W(0x0000f9c87e144541), W(0x000032ad5de50403), W(0x0000084d5b700c7c),
+     W(0x0000482d7859ed85)},
+    0
+  },
+  {
+    {W(0x000036bcc85269c2), W(0x0000e61283395d73), W(0x0000babf6e950ebc),
+     W(0x000071e6e01b1d1c)},
+    {W(0x000019143296d025), W(0x000080218ee95de8), W(0x0000d7125e3fdf0d),
+     W(0x00004d2ef00690d2)},
+    0
+  },
+  {
+    {W(0x0000e57768702eb5), W(0x0000a8b46e80c5d0), W(0x00005cc16b7d4b53),
+     W(0x00007fd97ca4203e)},
+    {W(0x0000b3884a3b935f), W(0x00002dc5ab23a470), W(0x000097b403b59984),
+     W(0x0000c708e045839f)},
+    0
+  },
+  {
+    {W(0x00000cc8231935ec), W(0x0000213a102b5384), W(0x000078af11558b5b),
+     W(0x00004f2581091d73)},
+    {W(0x00007ab8a8bf3b75), W(0x00000ac140deae01), W(0x0000071b0b6510f5),
+     W(0x000052387e2dba59)},
+    0
+  },
+  {
+    {W(0x0000a3d4fcbb55cd), W(0x0000c0e4f57d217c), W(0x00003d9ba7a5125c),
+     W(0x0000aa65d1878949)},
+    {W(0x0000e5848f148b38), W(0x00009a0b8162cba0), W(0x00007d5e988acf98),
+     W(0x00002c43594a0419)},
+    0
+  },
+  {
+    {W(0x000003a6b7433ed8), W(0x0000fff663813e1f), W(0x0000ef868f4984af),
+     W(0x00000c9be3bdcad2)},
+    {W(0x00005ce6c9ef1256), W(0x000087f710a9f78c), W(0x0000bbcaa6de9f26),
+     W(0x00009603b3b74f37)},
+    0
+  },
+  {
+    {W(0x0000662c0d933855), W(0x000023754cc35b6e), W(0x0000b10cb49431f5),
+     W(0x00004321b72f1892)},
+    {W(0x0000aa89e28b95b8), W(0x000010eff119b681), W(0x00006712ef45b536),
+     W(0x0000a799c32ee629)},
+    0
+  },
+  {
+    {W(0x000080b2027e8338), W(0x0000e9101aa73c9b), W(0x00005f140fb2876e),
+     W(0x0000eeade2575ddd)},
+    {W(0x0000a74bbb334225), W(0x000089ca842a2ac2), W(0x00007455b21dfbe4),
+     W(0x000011fc0be5f248)},
+    0
+  },
+  {
+    {W(0x00005e444dae14a1), W(0x0000b84c092fe4b8), W(0x0000c76d8821e3dc),
+     W(0x000018e17cdd5189)},
+    {W(0x0000c58ff7eb219f), W(0x00003c7e650c7510), W(0x000076976ebb4b3f),
+     W(0x00009dd8a20e44d5)},
+    0
+  },
+  {
+    {W(0x0000147f1332afac), W(0x0000b8851a84ca0e), W(0x000046ba616e4e08),
+     W(0x00003726c2c7b081)},
+    {W(0x00002c3dea036e80), W(0x00000f988cb614b7), W(0x000090268640c72b),
+     W(0x00009183be98fd58)},
+    0
+  },
+  {
+    {W(0x000007fed172f4e7), W(0x0000c08623b44180), W(0x0000af899ce85f3a),
+     W(0x0000cde1837db183)},
+    {W(0x0000b7b37a94282a), W(0x0000c2288b2a5905), W(0x00005d4417cbdfc6),
+     W(0x0000bb7fc36e26cd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00000470a386a9c6), W(0x0000953a4c5b7493), W(0x00005f8a92e85f81),
+     W(0x000073cadca6be97)},
+    {W(0x000040a9eec70948), W(0x00002320739d0082), W(0x0000b9879cef856c),
+     W(0x000008d99bcac671)},
+    0
+  },
+  {
+    {W(0x0000cee4013010da), W(0x000038db569517e4), W(0x00005e21b0cef520),
+     W(0x0000db4daf19fa96)},
+    {W(0x0000ba87ee625f7e), W(0x0000160d03d30489), W(0x00003934257f4493),
+     W(0x00007ec9d95463ff)},
+    0
+  },
+  {
+    {W(0x0000e4cc9aef79c0), W(0x0000d0a00cd89219), W(0x00009a92f833ba05),
+     W(0x0000946f79c09f63)},
+    {W(0x0000fbea97b90abb), W(0x0000e15810d6c00e), W(0x000018d6ac784764),
+     W(0x000060a05ed44119)},
+    0
+  },
+  {
+    {W(0x00001b6bbb362996), W(0x00002009c502ef7f), W(0x000002023646bafe),
+     W(0x0000898ef4a17565)},
+    {W(0x00008b99945f30a1), W(0x0000b0b7ef6afc88), W(0x0000525465794634),
+     W(0x00004a0a158ba74c)},
+    0
+  },
+  {
+    {W(0x0000be977260c990), W(0x00001aeb621ce485), W(0x00000487b81c6d18),
+     W(0x0000377b5472150a)},
+    {W(0x000076fa27f36b80), W(0x0000d986e63feeaf), W(0x000001bdb842e2fe),
+     W(0x0000eddaa37aa63f)},
+    0
+  },
+  {
+    {W(0x000019f638b60f64), W(0x00004e7360474362), W(0x000056a41ad163e2),
+     W(0x000039d54a275477)},
+    {W(0x0000667e26bd858e), W(0x00006d4547ce24f4), W(0x0000997e4f987aa3),
+     W(0x000099fb27ab5127)},
+    0
+  },
+  {
+    {W(0x00006339faee3902), W(0x000021a415fbe7c1), W(0x00007de58467a423),
+     W(0x000023508e015043)},
+    {W(0x00001448be6396ed), W(0x0000ef822dc4a884), W(0x0000f91491e81eb5),
+     W(0x0000b4b94ec110dd)},
+    0
+  },
+  {
+    {W(0x000005cdd0920ec8), W(0x000026aa0b607608), W(0x00003074b916b12e),
+     W(0x00000aa38ed480aa)},
+    {W(0x00009ac2c68b7610), W(0x0000a094ea2fa8b4), W(0x00003c1417a778fc),
+     W(0x0000bda447fab821)},
+    0
+  },
+  {
+    {W(0x000018a7bccd64d6), W(0x000074b6a3bbf2a2), W(0x0000cf2a2e66b39e),
+     W(0x0000e2cb08ca8c53)},
+    {W(0x0000c0d2153ca21f), W(0x0000a802ec1b287d), W(0x000080a2683f17eb),
+     W(0x0000ee5a67ca111f)},
+    0
+  },
+  {
+    {W(0x0000a74efe23c952), W(0x00001df38a564068), W(0x00002f75940ff097),
+     W(0x000035ea86c76b06)},
+    {W(0x00005137968e6ed1), W(0x0000749411d1d71c), W(0x0000b172d1e32869),
+     W(0x000049be18f1043d)},
+    0
+  },
+  {
+    {W(0x00002753792f7585), W(0x0000da986234de04), W(0x00006d6a9dec1b52),
+     W(0x000029178ec79d71)},
+    {W(0x00008dc581b40b92), W(0x00002dc3ce916e69), W(0x000074a21f3ad14f),
+     W(0x00003e322b94ded0)},
+    0
+  },
+  {
+    {W(0x0000544fdb6ac5f9), W(0x0000045c72301bef), W(0x0000071a2817e1a2),
+     W(0x0000402cf1cdb62a)},
+    {W(0x0000183f8b153805), W(0x0000663475c663fd), W(0x00000c35fc06b4c5),
+     W(0x00002ce8aaf4ae29)},
+    0
+  },
+  {
+    {W(0x00009d106abdce40), W(0x0000acc6032c6016), W(0x0000a8c7d1511724),
+     W(0x00001d6a7bf9c58a)},
+    {W(0x0000a3bc6a1f99e2), W(0x0000136ae99a1b3b), W(0x0000052ea1607690),
+     W(0x0000ddeaf6a4a115)},
+    0
+  },
+  {
+    {W(0x00005f88356df40a), W(0x00001b68ace04845), W(0x0000600dec103718),
+     W(0x0000714e45f81199)},
+    {W(0x000006aef707cb28), W(0x0000e118bbbea444), W(0x0000027a1c48ab11),
+     W(0x0000f2bc024c332e)},
+    0
+  },
+  {
+    {W(0x000031d875929cdd), W(0x0000b14b4c6e17c9), W(0x0000f5976530f37e),
+     W(0x0000dfb1d58093e4)},
+    {W(0x00000636275e3c4d), W(0x0000ab53a1775fa8), W(0x0000ac1de65f572a),
+     W(0x0000a5d7d393b1d0)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000045f1b2b87be3), W(0x000000914a56e9a0), W(0x00004d508bee2c1d),
+     W(0x0000bd12ebd12ae5)},
+    {W(0x0000a79315349181), W(0x0000e7ce8f40b283), W(0x000057b3ecc58faf),
+     W(0x0000ac2bd78d9e7d)},
+    0
+  },
+  {
+    {W(0x00007e46f5566c97), W(0x0000d5b5c0cc6ebd), W(0x00006b114ffe7680),
+     W(0x0000e49aa20224fd)},
+    {W(0x0000b826c1a909da), W(0x00007e9c550007bb), W(0x0000d5694f904e19),
+     W(0x00009f28c9eecee9)},
+    0
+  },
+  {
+    {W(0x00005a810aa562f8), W(0x0000e179c2ebf686), W(0x0000695d8816d60a),
+     W(0x0000bb9b59e08072)},
+    {W(0x00006afab504451e), W(0x00009d25cc11306a), W(0x00004da5e06c6caf),
+     W(0x0000eec78c312884)},
+    0
+  },
+  {
+    {W(0x0000cae42d7e1827), W(0x0000590267c84516), W(0x00004207e9accf64),
+     W(0x0000e7897f12b5ad)},
+    {W(0x00000c93be19e9d6), W(0x0000d7f7c0111ef2), W(0x0000df2b7c5d3fcb),
+     W(0x000068b64d8b9ba0)},
+    0
+  },
+  {
+    {W(0x00006215b9e6caca), W(0x00005bac3c18a0a6), W(0x0000d99ad9f86801),
+     W(0x000006e70282a8bd)},
+    {W(0x000071d29cfc5d54), W(0x0000272e1d1f5555), W(0x000012c300ffe76a),
+     W(0x0000ea67be121478)},
+    0
+  },
+  {
+    {W(0x0000b4a2115a4c6e), W(0x0000e0789ec9ea9e), W(0x0000e4b654342d68),
+     W(0x00000f1c638730f2)},
+    {W(0x0000d80a51b07c07), W(0x0000ddc2d171a24a), W(0x000006c7b0611b09),
+     W(0x000039ebd2ec9c15)},
+    0
+  },
+  {
+    {W(0x0000e196623d69b2), W(0x00000d6f4aae5757), W(0x000058f0b856b044),
+     W(0x0000b6f9a966732f)},
+    {W(0x00008561e6ee255b), W(0x0000d420d6eb4f09), W(0x000096f1f362282f),
+     W(0x0000452f88604033)},
+    0
+  },
+  {
+    {W(0x0000b9e65eefc057), W(0x0000b74f277ab15c), W(0x0000c7e5508d4ef8),
+     W(0x0000f927fac539c4)},
+    {W(0x0000411877798eaa), W(0x0000ff5c961f488d), W(0x00009830f5958a09),
+     W(0x00007017f3d2caa0)},
+    0
+  },
+  {
+    {W(0x000035a8be51d048), W(0x0000c0a46c6503c5), W(0x0000736bc7da40a6),
+     W(0x0000b99dc69265d8)},
+    {W(0x0000dffa45c72650), W(0x0000abcbc295b6ea), W(0x0000210b92f4e365),
+     W(0x0000aa01d68d570f)},
+    0
+  },
+  {
+    {W(0x0000ca6bdfeba481), W(0x00005b1b208697e8), W(0x00009bf3198045f8),
+     W(0x00001a345c1b2be3)},
+    {W(0x00003b8b57024721), W(0x0000c7a0e81207ae), W(0x0000d4d0e79a5122),
+     W(0x000064afe51144b4)},
+    0
+  },
+  {
+    {W(0x0000fd86d7c24f9f), W(0x00007472fd0743bc), W(0x0000fcf86c487c4d),
+     W(0x0000e825ab6c7b78)},
+    {W(0x0000c63a830ebb0d), W(0x0000a64b087c395a), W(0x0000186a860f8040),
+     W(0x00007c77ce920cff)},
+    0
+  },
+  {
+    {W(0x000066c0e46415a6), W(0x00005fabff857127), W(0x0000bbf3a0f8791d),
+     W(0x00009cbbdf886426)},
+    {W(0x000090dcf53f419a), W(0x00002dff0239a38f), W(0x0000f921b2b4ed83),
+     W(0x00000186905dfc72)},
+    0
+  },
+  {
+    {W(0x0000d747c917e2e5), W(0x00001375a92a984c), W(0x0000acff08d8dba6),
+     W(0x0000aa7db09f8100)},
+    {W(0x0000cb3f6f996bb4), W(0x00003258a5daf2f4), W(0x0000011057ceee93),
+     W(0x0000194d9b409c71)},
+    0
+  },
+  {
+    {W(0x000091c97387b47d), W(0x00009fe19deab5bb), W(0x0000c94038b865b9),
+     W(0x000007aabbe2c604)},
+    {W(0x000020a97878c5ef), W(0x0000b46c6ca855e3), W(0x0000e1ec7fcfa0b5),
+     W(0x0000f5c9927d1405)},
+    0
+  },
+  {
+    {W(0x0000900ad583a005), W(0x0000d48cd837ab3b), W(0x000054a32a0769fe),
+     W(0x00001045243ad884)},
+    {W(0x00005dc7c1c0ad1b), W(0x000012bc93519136), W(0x00001a14a1e01f40),
+     W(0x000013fdafc67418)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000b3d1e27e65d0), W(0x00009fc34c4032b8), W(0x000070766dcf6c82),
+     W(0x0000e0e10bb5accc)},
+    {W(0x0000f0e6d10dcb2b), W(0x0000a66edee3fd0f), W(0x0000845ac2df611d),
+     W(0x0000de1f95461279)},
+    0
+  },
+  {
+    {W(0x00009e56b539aa2a), W(0x00008a591e38dc7b), W(0x0000c3fb8e17a471),
+     W(0x000059ad268ea431)},
+    {W(0x0000cb31acc2acc7), W(0x000048de3d968c25), W(0x00008f40221e688c),
+     W(0x000014f763a18211)},
+    0
+  },
+  {
+    {W(0x000020dc550c6ffb), W(0x0000904ec1f32135), W(0x000000b28639cad6),
+     W(0x00003152789e963e)},
+    {W(0x00004a00c637a903), W(0x00009186750a517c), W(0x0000541eeca7dc5c),
+     W(0x00009cf826ce1710)},
+    0
+  },
+  {
+    {W(0x000073c3ac0984b7), W(0x0000aea3eec06aff), W(0x00007d2d616790be),
+     W(0x00002de636397d9e)},
+    {W(0x00005297094a4fe7), W(0x0000162bdc4b0166), W(0x0000a045896945cb),
+     W(0x00009c8699151239)},
+    0
+  },
+  {
+    {W(0x0000b750a5d63cba), W(0x0000bc1c3e66b2b3), W(0x000014bcede351fb),
+     W(0x0000f52cc12ef846)},
+    {W(0x00004fefd501603b), W(0x000078afead9e1e9), W(0x00008bc9ee7227bb),
+     W(0x00004861d7e3ed5d)},
+    0
+  },
+  {
+    {W(0x000019349c8b25d2), W(0x0000f449c4198d80), W(0x0000b0848d711085),
+     W(0x0000b7773e467433)},
+    {W(0x0000a1fc26d63b19), W(0x0000677edf7477fb), W(0x00000cda01babfce),
+     W(0x000073ae0f100928)},
+    0
+  },
+  {
+    {W(0x0000a1d282a09cb0), W(0x0000a005e2e13edb), W(0x000034558ed0c13e),
+     W(0x00003d0a03c42a0a)},
+    {W(0x0000dda50c9a57cf), W(0x000032def3949121), W(0x0000d0edc30736d1),
+     W(0x00000d80a43f906d)},
+    0
+  },
+  {
+    {W(0x000018cc302f6565), W(0x0000f5345034828d), W(0x0000e5fd24723cfe),
+     W(0x000031529dc52fac)},
+    {W(0x00005c47ea155539), W(0x0000067856690f7e), W(0x0000766df561acc0),
+     W(0x0000034a1cd0c618)},
+    0
+  },
+  {
+    {W(0x000015bee7723716), W(0x0000ec3dcb0685df), W(0x0000437cc332d1bb),
+     W(0x0000fd47f0d6eb1d)},
+    {W(0x0000b9841ebc75ec), W(0x00002057f10c9c40), W(0x000020106962cd20),
+     W(0x000000ccd997b95b)},
+    0
+  },
+  {
+    {W(0x00002e305cd6e8d6), W(0x0000f4cf83bade1e), W(0x0000a8dc79a7d457),
+     W(0x0000117780da57f3)},
+    {W(0x00004ebaa1f34ef4), W(0x000017f3a0e3d368), W(0x000038bb70bb909e),
+     W(0x00002bdbd4854f7b)},
+    0
+  },
+  {
+    {W(0x0000c954d88196cb), W(0x000027d8768f8caa), W(0x0000b7e91ca95d30),
+     W(0x000000135a1209d9)},
+    {W(0x00003e6dd22eaf5e), W(0x0000d60eeb15927e), W(0x0000f5d34c7fd53c),
+     W(0x00001b47650219eb)},
+    0
+  },
+  {
+    {W(0x000020e38880b7ab), W(0x0000cece195fd4bc), W(0x0000796ce02a0c6a),
+     W(0x000073a454ce9169)},
+    {W(0x0000461a83e76d04), W(0x0000e2c0a60980ca), W(0x0000c3160a365ec4),
+     W(0x00004b73b577491a)},
+    0
+  },
+  {
+    {W(0x000064c962262848), W(0x0000199e4ac0d3e6), W(0x000001be93cce00f),
+     W(0x000043c54956fd3c)},
+    {W(0x000001ae9af9938e), W(0x0000173d7d5dca94), W(0x00001131fef97fca),
+     W(0x00005199261464cd)},
+    0
+  },
+  {
+    {W(0x00007a6b1025a916), W(0x0000f239c766b1e6), W(0x00004cca9f3d7150),
+     W(0x0000ff1e6b1f28b8)},
+    {W(0x0000e42693a8b8e4), W(0x0000362d7f1a35a5), W(0x0000c929cd89fbd3),
+     W(0x000011dc4f8fa2a6)},
+    0
+  },
+  {
+    {W(0x000069a67605136e), W(0x0000ece55d1e40df), W(0x0000dca844b13264),
+     W(0x00008b0eb13d837b)},
+    {W(0x000010640f472cbd), W(0x000051c509b9d97b), W(0x00003e64f9030333),
+     W(0x0000951b3718adae)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00005c3ac5e3f559), W(0x0000ae78cfa169c0), W(0x0000cc19d5416d4b),
+     W(0x0000f4110d1d500d)},
+    {W(0x00005adce0710102), W(0x00003f6038c433b4), W(0x0000cab1c75e9ca7),
+     W(0x00003aaaa4f1165a)},
+    0
+  },
+  {
+    {W(0x000017296b27ca48), W(0x0000b476f6d7e885), W(0x0000d5b73ef555d2),
+     W(0x00008d344c1bd4bb)},
+    {W(0x0000cfd5291775a9), W(0x000041ca40ab0b36), W(0x00009f188bbb5059),
+     W(0x0000c5faae2a3f0d)},
+    0
+  },
+  {
+    {W(0x0000d61fa9867f1e), W(0x0000de94b4b9c4c0), W(0x0000b753b36bb8b2),
+     W(0x0000e7228c15c3d9)},
+    {W(0x0000462c679575f2), W(0x0000607a85fe5711), W(0x0000cbe0acca3bcf),
+     W(0x0000b2338dd4aee5)},
+    0
+  },
+  {
+    {W(0x0000bc7c2d551d25), W(0x0000b8b3df8d5365), W(0x000029d4aa9fc0c0),
+     W(0x0000ee7b16ae89a1)},
+    {W(0x000015a3efca6fd8), W(0x0000fb9c559e462f), W(0x0000aaa745d51123),
+     W(0x000087129a55179d)},
+    0
+  },
+  {
+    {W(0x00006b82c5098f7f), W(0x00000fbc4af3dfd7), W(0x00009cb0d9d0e617),
+     W(0x0000569dc3262ab8)},
+    {W(0x00007740183fa8ee), W(0x00000c80bc2d7799), W(0x0000e9ac2a982b84),
+     W(0x000036bb871c03db)},
+    0
+  },
+  {
+    {W(0x00009130f9633421), W(0x0000169ed0dc2e70), W(0x00009b882a621378),
+     W(0x00006e2113d7509c)},
+    {W(0x00003d8c3c37fd2a), W(0x0000d69bfdd933ca), W(0x000004236127d6e9),
+     W(0x00000776940046ca)},
+    0
+  },
+  {
+    {W(0x0000d4f0249d4e4e), W(0x0000b16f835fbc95), W(0x0000f5f5a409128b),
+     W(0x00002fcf27a9199e)},
+    {W(0x000076d3027d63a0), W(0x0000c4fad056a1a6), W(0x00008dd90d004f8a),
+     W(0x0000f187ccee2584)},
+    0
+  },
+  {
+    {W(0x00000444ab31905b), W(0x0000b6e3a425ca74), W(0x00001a69d7b5e9fd),
+     W(0x00000cec4a7043ad)},
+    {W(0x00008600b2b0def8), W(0x0000806f00ae1b22), W(0x00001c2586e7a638),
+     W(0x0000a22083797d54)},
+    0
+  },
+  {
+    {W(0x0000012a6bbfb792), W(0x00007b7ab7a60a2b), W(0x00004acd258a4ce1),
+     W(0x0000248f76494e46)},
+    {W(0x00008977282fba84), W(0x0000cb4899253f1c), W(0x0000481dcf9caf5b),
+     W(0x00001f99fd6f8df1)},
+    0
+  },
+  {
+    {W(0x0000f99737b28aee), W(0x0000f7bbe9ec5721), W(0x0000df958c02b3c2),
+     W(0x0000a6d9e878ec8e)},
+    {W(0x00001cbfb719dcba), W(0x000018b9453b6039), W(0x000072b978e7f509),
+     W(0x00005b38a1b14e4b)},
+    0
+  },
+  {
+    {W(0x00004256816caca7), W(0x000043dbc5f7533c), W(0x00008775b32506c8),
+     W(0x000067020c585300)},
+    {W(0x0000ae2aa73b3e15), W(0x000073899a14128f), W(0x0000f14563a32b64),
+     W(0x0000ebd7827e53c9)},
+    0
+  },
+  {
+    {W(0x00006ad6c0fa9c40), W(0x0000776f2ed6c5fe), W(0x0000cf7be5c1c56d),
+     W(0x0000ab1f958b83e4)},
+    {W(0x00002a98f36909db), W(0x00007d04d0b25d1a), W(0x00001af224dee7a1),
+     W(0x00005197406e09f0)},
+    0
+  },
+  {
+    {W(0x00008e397c144db9), W(0x0000bc2e2194ac6c), W(0x00003592b92153cd),
+     W(0x0000a02b9e887950)},
+    {W(0x00007f7a76cf8ab5), W(0x0000feb878d1004c), W(0x0000110e6b97035b),
+     W(0x0000ff565cafe49b)},
+    0
+  },
+  {
+    {W(0x0000d1113ec9af06), W(0x0000e01206a67702), W(0x0000b5718a17d7bc),
+     W(0x00009129e8a9b591)},
+    {W(0x0000f4e607d8e7f7), W(0x0000841c18f8dd95), W(0x0000c54d604cb82e),
+     W(0x000016b9e9cf1eb6)},
+    0
+  },
+  {
+    {W(0x0000ef731ea596f6), W(0x000015cb7707d7d5), W(0x00009225cbe5f2bc),
+     W(0x00002ab04bbe3234)},
+    {W(0x0000a3af7a6502a4), W(0x00005e5499b2715e), W(0x0000048543db1d87),
+     W(0x0000d79019cf7ceb)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000cb8dbd4ffff4), W(0x0000f34a3da65f99), W(0x000078a449b33356),
+     W(0x0000893db51f93fa)},
+    {W(0x000009278ddc5c18), W(0x0000f3f1f4c9243f), W(0x0000696d98e7f7a2),
+     W(0x00009931dd2476d6)},
+    0
+  },
+  {
+    {W(0x000034c085a6a538), W(0x0000969d463799a8), W(0x00008e9906a4a063),
+     W(0x0000626d65dc241c)},
+    {W(0x00008882e410e93c), W(0x0000bae3ba6344fa), W(0x00009783ba8db8af),
+     W(0x0000db6fc744fba2)},
+    0
+  },
+  {
+    {W(0x00008bd0990b467b), W(0x00001a42f2807c0d), W(0x0000e62f47140b37),
+     W(0x00009c8092424f6d)},
+    {W(0x0000b5bcf8a5b41c), W(0x000069b62bad7664), W(0x000070ce01b102ea),
+     W(0x000007220b8428c2)},
+    0
+  },
+  {
+    {W(0x000082de6ef001ea), W(0x0000f11e414f2bf5), W(0x00009d58b9afcf09),
+     W(0x0000dbda1d4232ff)},
+    {W(0x000001d4d829d4c8), W(0x000024673485cabd), W(0x00003be0bf4e20f7),
+     W(0x000032dae1de1b9b)},
+    0
+  },
+  {
+    {W(0x000015981c5268e2), W(0x0000bf85f90dbb87), W(0x000068b773d35396),
+     W(0x000009dd2c811641)},
+    {W(0x00001a0b7777a843), W(0x0000f17764e7841d), W(0x00009d0955a8f387),
+     W(0x000009610578c0db)},
+    0
+  },
+  {
+    {W(0x0000dab7571599c1), W(0x00008241b7391eca), W(0x0000fc3a6a97d21b),
+     W(0x0000d9b1d42af776)},
+    {W(0x0000e4f944e5ff8e), W(0x00002d2934428277), W(0x000086aff0509c69),
+     W(0x00009c7522ce8f2d)},
+    0
+  },
+  {
+    {W(0x00008ff7c8e4ac76), W(0x0000f73b03ecd0e0), W(0x0000a8f2ca3e8514),
+     W(0x000044dae527a74c)},
+    {W(0x0000e86dda47fe37), W(0x0000b9e943881549), W(0x00009637b320df46),
+     W(0x00009630dac316d9)},
+    0
+  },
+  {
+    {W(0x000060865b85901f), W(0x0000bb248a447ee6), W(0x0000bfef44682525),
+     W(0x0000a3d8b375434b)},
+    {W(0x00000f8749ed7bf5), W(0x00004e4a845650ac), W(0x0000a3ae0562b286),
+     W(0x000064241d40905d)},
+    0
+  },
+  {
+    {W(0x0000d36ddad95773), W(0x00004b0449e3a907), W(0x0000d0fdfbcecf28),
+     W(0x00003c6613f282c8)},
+    {W(0x00003fdd1470caed), W(0x00000a91ed5bd037), W(0x00000bebccf3994d),
+     W(0x0000cc31a6c6dd1f)},
+    0
+  },
+  {
+    {W(0x0000b4ae7478d70d), W(0x00003727300a0e3d), W(0x0000045d8bf528c8),
+     W(0x000014621c00773b)},
+    {W(0x0000ecc6070c11b9), W(0x0000db66f9f25d3f), W(0x0000b65ffe1aa216),
+     W(0x0000de7d0f1c7e4a)},
+    0
+  },
+  {
+    {W(0x0000126c09f6ec44), W(0x0000ccae059d5b2c), W(0x0000020c34d494ac),
+     W(0x000044442004cae0)},
+    {W(0x0000d30039ed746a), W(0x00004623719bf2a1), W(0x0000132780f278a0),
+     W(0x0000a46190af82a0)},
+    0
+  },
+  {
+    {W(0x0000de846cf9a5d5), W(0x0000fb1559d39bc5), W(0x0000ac5fdfa3f34d),
+     W(0x0000fa71d41dbfd3)},
+    {W(0x0000ad19c5733bb1), W(0x000048ae56a9d685), W(0x000060dc5df7f103),
+     W(0x0000d1b1954e1e19)},
+    0
+  },
+  {
+    {W(0x0000c44905dbfc3d), W(0x00005a3041dcb4f4), W(0x0000c76f81192c05),
+     W(0x00000dac131b025b)},
+    {W(0x00008be1af595245), W(0x000046fde60a686e), W(0x00004cf677900874),
+     W(0x0000a7872bd9aecf)},
+    0
+  },
+  {
+    {W(0x00000a1846b24f91), W(0x0000830d47ed71f3), W(0x000093d35d4c93ef),
+     W(0x0000197e09071bb7)},
+    {W(0x0000a766401a8bda), W(0x0000204d21932906), W(0x00008f89f317e612),
+     W(0x0000bdf211ce2aee)},
+    0
+  },
+  {
+    {W(0x00004c369a37f22d), W(0x0000904eb777e9bb), W(0x0000eac73ab3a1d5),
+     W(0x00000fc02cf971b5)},
+    {W(0x000042f74bf04366), W(0x00005e1b53e567be), W(0x000079bfdaa32529),
+     W(0x0000ae3919da97bd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000985cbe00f5ae), W(0x0000b9b4155f5ed4), W(0x0000aeef30b40d03),
+     W(0x0000372fe994ce95)},
+    {W(0x0000724d4ebd40a7), W(0x000078d5fb20e08a), W(0x000071ed04ff3443),
+     W(0x0000517c12ca0a99)},
+    0
+  },
+  {
+    {W(0x000044739c1b3e6c), W(0x00001a19851b07ec), W(0x0000d5ad310fc095),
+     W(0x000008d8f3bf13de)},
+    {W(0x00008cdf23a2b3b9), W(0x00001f751ca2e7be), W(0x00003a3f4c988f43),
+     W(0x0000a4da5afa5fbc)},
+    0
+  },
+  {
+    {W(0x00003af0297a183b), W(0x0000565054e8f906), W(0x0000c3fdebb3552c),
+     W(0x00009802568435d7)},
+    {W(0x000019eaf1c88fed), W(0x0000a1ba17de6de2), W(0x0000c4e73f4a6cdc),
+     W(0x0000b626042fc81d)},
+    0
+  },
+  {
+    {W(0x000048bb2977245f), W(0x0000c80d95b0e485), W(0x00000f44a8d146e8),
+     W(0x0000653a2052b3f1)},
+    {W(0x0000dc9654f0af32), W(0x00002da129ab1a5f), W(0x000030f9822cbafc),
+     W(0x0000254234643969)},
+    0
+  },
+  {
+    {W(0x000020a03e6d3322), W(0x000073cecf284ec7), W(0x0000e0a09483b452),
+     W(0x00003e79de31f1b1)},
+    {W(0x000053938ae2a88e), W(0x00001ed8781f7bdc), W(0x00002fd9674a021c),
+     W(0x000052c637a8f347)},
+    0
+  },
+  {
+    {W(0x0000cf822502688a), W(0x000025c389d4a95a), W(0x0000e7723af39758),
+     W(0x0000d7f168b7772c)},
+    {W(0x00007f7dff2108a6), W(0x00009b5cba8d8c88), W(0x00008c1f2e960da6),
+     W(0x00002e5b1b88652f)},
+    0
+  },
+  {
+    {W(0x0000d247d77224a0), W(0x0000aada5f2ad6de), W(0x00009767fd230e18),
+     W(0x0000dc9c49b18732)},
+    {W(0x0000d52466010259), W(0x0000cded948735a0), W(0x00008986e87ad8c8),
+     W(0x00001372d8c4bc96)},
+    0
+  },
+  {
+    {W(0x00007559aff0fd3c), W(0x000078484e06f53a), W(0x00006f6c80768a43),
+     W(0x0000ac0f167451cf)},
+    {W(0x0000799e4cf51546), W(0x000036b0eee0f05b), W(0x0000e23455b8676b),
+     W(0x00008b34b7c3eadb)},
+    0
+  },
+  {
+    {W(0x0000592e4871fd4b), W(0x0000d6fe11c16528), W(0x00002cc52bcfa72c),
+     W(0x0000cff17ad82553)},
+    {W(0x0000c6db4dc6e580), W(0x000031edffea93a0), W(0x000010a745766f6d),
+     W(0x000009f576ef7762)},
+    0
+  },
+  {
+    {W(0x00003027e829c85e), W(0x00004ca1bceea192), W(0x000043b674ac0953),
+     W(0x0000da9f87ffd8d1)},
+    {W(0x0000bf26118ddce5), W(0x000010cfd8e49745), W(0x00007c431cce7564),
+     W(0x000028a74d633291)},
+    0
+  },
+  {
+    {W(0x000070f848ecf086), W(0x0000895399f83d06), W(0x00005e33833bb7e5),
+     W(0x000062e93ec60204)},
+    {W(0x00006715dceb7b42), W(0x0000c89710cdda57), W(0x000053e772def93d),
+     W(0x000022a3d001969e)},
+    0
+  },
+  {
+    {W(0x000078104c9c1a36), W(0x000033d1d322528f), W(0x0000c0e42842c688),
+     W(0x000046ff938e82ef)},
+    {W(0x000070c745c0e333), W(0x0000a5ba1188bc00), W(0x000047227ac72bd9),
+     W(0x0000349332da1c91)},
+    0
+  },
+  {
+    {W(0x0000096fccd2dc4f), W(0x00008f12c7997c8e), W(0x00004020fe54afa6),
+     W(0x0000a7b3b0c3be74)},
+    {W(0x0000a75dbd79d800), W(0x00008e76110a27ec), W(0x000087eee0bda4bd),
+     W(0x000099ba71d1c5f4)},
+    0
+  },
+  {
+    {W(0x0000242cf45e81fe), W(0x00006d17bf8aed6c), W(0x000069c219a8773c),
+     W(0x000096b27965de85)},
+    {W(0x0000aca2015fb4f1), W(0x0000b4e8c1709ea5), W(0x00000567ff823c71),
+     W(0x000036396bb13137)},
+    0
+  },
+  {
+    {W(0x0000ecf4763162d1), W(0x0000b6ccfbc4a2c3), W(0x0000caa923d5be0b),
+     W(0x00000c56c42f8c27)},
+    {W(0x00002f6612cbaa7d), W(0x00000dffdb266e03), W(0x000067176a2f14c9),
+     W(0x0000872aedf2f929)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00002c931bec5470), W(0x000066098f5d254e), W(0x00007f7675706c67),
+     W(0x000053789c99fb45)},
+    {W(0x00009382ae620385), W(0x000030319e38502b), W(0x0000f30832ee805b),
+     W(0x00004da9b7c8b9ab)},
+    0
+  },
+  {
+    {W(0x0000c54481f272bc), W(0x0000690a89544205), W(0x000090bd05e65f94),
+     W(0x0000306170f4c90e)},
+    {W(0x000075b1b6bf202a), W(0x0000db26bcda4a63), W(0x0000223428d7cef4),
+     W(0x0000c91fbda9ccee)},
+    0
+  },
+  {
+    {W(0x0000e465aa5abe53), W(0x000027bd170ef4e1), W(0x0000fea068c850ac),
+     W(0x00004d54934c652e)},
+    {W(0x00008c72db3cf601), W(0x000066ea374258d3), W(0x000037d2d95e6bf9),
+     W(0x00001d4549cc8063)},
+    0
+  },
+  {
+    {W(0x00002ee0325c0888), W(0x00000adca3ed9228), W(0x0000259cc41575ae),
+     W(0x0000f12b3fdb77ad)},
+    {W(0x00004d29180cd95e), W(0x000050ff33921116), W(0x00002bd35fc6b9c7),
+     W(0x000023f42116efff)},
+    0
+  },
+  {
+    {W(0x0000238987293bb3), W(0x0000506f96db49cc), W(0x000057690baa5786),
+     W(0x0000961dc035967f)},
+    {W(0x0000e238a76e05e3), W(0x000052a1bfefb33d), W(0x00005f75ca286f1d),
+     W(0x00005c4749f7a86f)},
+    0
+  },
+  {
+    {W(0x0000777aedb89fdb), W(0x00003069a6c1cbad), W(0x0000ef24c2f8779a),
+     W(0x0000d5161216c6ba)},
+    {W(0x00006fd0640cf982), W(0x0000bd957af922cd), W(0x0000745580a6b3c2),
+     W(0x00009262b55c04a0)},
+    0
+  },
+  {
+    {W(0x0000fd18778814a0), W(0x00000f42a248ef22), W(0x0000fd4bf410a82f),
+     W(0x0000589bfd8b0a13)},
+    {W(0x00001bc400b4e719), W(0x0000259cad45b6f2), W(0x00006c94c1d33937),
+     W(0x00000586e14bd3cf)},
+    0
+  },
+  {
+    {W(0x000039e8c0cf597d), W(0x000084bea06decc7), W(0x000082ed9231f074),
+     W(0x000046722e1bd682)},
+    {W(0x000062f28d7663b8), W(0x0000437f70e2e5d9), W(0x0000b26d6f05e9de),
+     W(0x0000c37cb198a820)},
+    0
+  },
+  {
+    {W(0x0000395628f6d953), W(0x00001cd04b2a225a), W(0x0000189f8c8b235b),
+     W(0x0000b74a13f09465)},
+    {W(0x0000e9f8b1a6255e), W(0x000040a601b8e089), W(0x0000c133a2071e00),
+     W(0x0000aec0e6541a26)},
+    0
+  },
+  {
+    {W(0x00005097115dd30e), W(0x00004fb0dd6e393f), W(0x00000e334efb684e),
+     W(0x0000ec3f5d955945)},
+    {W(0x0000c8e8204505e4), W(0x00008381678ed294), W(0x00006c268a6d785a),
+     W(0x000099da1eb296b5)},
+    0
+  },
+  {
+    {W(0x0000d2cff1a8fed6), W(0x00009ce769672d5b), W(0x0000011c31892610),
+     W(0x0000dcc348e3b0d3)},
+    {W(0x00000a5a28a5576b), W(0x0000b21c7615e395), W(0x0000d29df638c33f),
+     W(0x0000feeee8c79e32)},
+    0
+  },
+  {
+    {W(0x00004f2ed7da1038), W(0x000019e8a090ed5b), W(0x0000c7972b30eba7),
+     W(0x0000d4915795f25e)},
+    {W(0x00001580fc20c155), W(0x00001be04f4fa8c9), W(0x0000cc047b9b3e85),
+     W(0x0000459c9198f4a0)},
+    0
+  },
+  {
+    {W(0x00004e3c29220237), W(0x00005964b2032c95), W(0x00002380355b50d6),
+     W(0x0000e16d208ba918)},
+    {W(0x00001854d30106ca), W(0x0000a75202805dec), W(0x000066e9e8f44bc9),
+     W(0x000045bf44d104f4)},
+    0
+  },
+  {
+    {W(0x00001d7b4bb0a302), W(0x00000ec65d53548d), W(0x00009a56385a1854),
+     W(0x000098376dfb088d)},
+    {W(0x00008466622a022a), W(0x0000346da3790404), W(0x0000f00d606d6bf1),
+     W(0x00000bce4d497430)},
+    0
+  },
+  {
+    {W(0x0000e441afc8978e), W(0x00001354988d8fa3), W(0x0000a8daed5aa2c8),
+     W(0x00009f670ea3447c)},
+    {W(0x0000978d9d65e6fa), W(0x000064cfc43c8fec), W(0x00002041de0b3aeb),
+     W(0x0000df0d08eac8a4)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000063d8c0a1e340), W(0x000080d1090bb199), W(0x0000c7374730d4f4),
+     W(0x000051a581d9184a)},
+    {W(0x00006731e69912a5), W(0x00002f683f16ecc5), W(0x00009f6e7cdfcea0),
+     W(0x00005bd81ee2e0bb)},
+    0
+  },
+  {
+    {W(0x000085fd874589a5), W(0x0000da777dfde720), W(0x0000f61d50a47329),
+     W(0x00004b6ee95d7776)},
+    {W(0x0000e138cd63119e), W(0x0000b41231a600b1), W(0x0000287c3911a508),
+     W(0x000084b57f85c32f)},
+    0
+  },
+  {
+    {W(0x0000e37c874b8cb5), W(0x0000c337984c4e41), W(0x00005f6033c63e54),
+     W(0x00004a2fb8438d64)},
+    {W(0x00003f12a3ff1803), W(0x00000d299cda22df), W(0x0000f8b05127af16),
+     W(0x0000512114cbfa7d)},
+    0
+  },
+  {
+    {W(0x000016e0eb97690a), W(0x0000d31d3e88dcb4), W(0x000057507cd89b6e),
+     W(0x0000f4d5251beaaf)},
+    {W(0x0000e3dee685e484), W(0x00002914dd60af4f), W(0x0000086d7b0738a1),
+     W(0x000093a49e0af8d8)},
+    0
+  },
+  {
+    {W(0x0000d346885d5421), W(0x0000c7dc315f2dd0), W(0x00000d4bfecaa15d),
+     W(0x00003b4862eee5ef)},
+    {W(0x00003b7162824ed9), W(0x0000fed42dc5e115), W(0x00002285ee8bf7d8),
+     W(0x000065d8875a78ea)},
+    0
+  },
+  {
+    {W(0x0000606db7eb4b8d), W(0x000027df93c82fd8), W(0x000001d574e697bb),
+     W(0x00009024ee7f4ce8)},
+    {W(0x00006b27428a521e), W(0x00002022643f3a5d), W(0x00006ab19833806b),
+     W(0x00001002c381fc61)},
+    0
+  },
+  {
+    {W(0x0000be679db566c4), W(0x0000a09e92b0bd26), W(0x00009a0f3fe3bc7b),
+     W(0x00006090a2ec31ac)},
+    {W(0x0000b9484a695d7e), W(0x0000f479a5787a80), W(0x00000d201b8b4886),
+     W(0x000070afbcb3f973)},
+    0
+  },
+  {
+    {W(0x00009c2c86404738), W(0x00002ff6e05fa9c3), W(0x0000b4cafedf3dca),
+     W(0x00000872e3b6bf94)},
+    {W(0x00000c8e56aef1cd), W(0x00008ac75bd10c1e), W(0x0000d28fcbc1f92e),
+     W(0x0000b4267bd6a674)},
+    0
+  },
+  {
+    {W(0x000003b209152063), W(0x0000a646ccc310b2), W(0x00007673c78d009f),
+     W(0x00008c93614f1956)},
+    {W(0x0000ecbe9f1a3e16), W(0x00001b8624b8a4b4), W(0x000026d6375aa74b),
+     W(0x0000855b2efa2128)},
+    0
+  },
+  {
+    {W(0x0000aef48d097503), W(0x0000341522cb0419), W(0x0000c0c6bce0f859),
+     W(0x000028c86e6ce4b0)},
+    {W(0x00007af91e7efb7b), W(0x00003dfacaa55a48), W(0x0000065e1e4b906b),
+     W(0x00001ebdf467a0fe)},
+    0
+  },
+  {
+    {W(0x00007a4818b1e4cd), W(0x000013b9a3f0bfeb), W(0x00007d8272f4ebd1),
+     W(0x0000956499a145e8)},
+    {W(0x000008b97fb77dd5), W(0x00001d1c0c6615f1), W(0x0000b69d8d2087ba),
+     W(0x0000ab986aaf5aab)},
+    0
+  },
+  {
+    {W(0x0000350f89e13bbc), W(0x0000a0dccf454d40), W(0x0000ac93e466ef0a),
+     W(0x000072636043690c)},
+    {W(0x000079dd93d05e45), W(0x00004bd5f10a56ab), W(0x00005a05b053ff9f),
+     W(0x0000c9cea49438ed)},
+    0
+  },
+  {
+    {W(0x000062db8d4f256a), W(0x0000beb5c4b70573), W(0x0000f6cf2e96764b),
+     W(0x00000fc9acc2b83b)},
+    {W(0x0000437be2577413), W(0x0000865104b12ac5), W(0x0000efff01cdaeef),
+     W(0x00009d922daeae7e)},
+    0
+  },
+  {
+    {W(0x00000dd3db6e05e1), W(0x000060309dcc12a6), W(0x0000ec5e81cb402d),
+     W(0x00006833621ef5ac)},
+    {W(0x0000602f8f5e2109), W(0x0000a750d1ef2e48), W(0x000047bab24b01c7),
+     W(0x0000c64745e1fc7e)},
+    0
+  },
+  {
+    {W(0x00003457b583f01d), W(0x00007ec4eedb6ab2), W(0x000030efc5cf73d3),
+     W(0x00008d8fa1f04a6e)},
+    {W(0x000075b56ff37ccb), W(0x00002d52a1890c67), W(0x00001145ef7f53e2),
+     W(0x0000ee80a5ed46d5)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000030706e1bb384), W(0x000011d1deba5dab), W(0x0000a4ea587757c3),
+     W(0x0000eb139afa75e8)},
+    {W(0x0000f0b44a7e64bd), W(0x00006348c2e91304), W(0x0000f542733b4c08),
+     W(0x000024026e2aaa65)},
+    0
+  },
+  {
+    {W(0x0000c44c33e373c8), W(0x0000619248e50758), W(0x00008b57c662303a),
+     W(0x0000bb321c30238c)},
+    {W(0x000013025f0e1d6a), W(0x0000e983a0f5bea5), W(0x00002c6305c3b75d),
+     W(0x000072741c84b677)},
+    0
+  },
+  {
+    {W(0x000096d39d9a4418), W(0x00005827ce454643), W(0x0000d9a752591c89),
+     W(0x00003df21df462ad)},
+    {W(0x00002de42cbf538f), W(0x0000797618a531f2), W(0x0000060c2741f6cf),
+     W(0x000028ce98ab489b)},
+    0
+  },
+  {
+    {W(0x0000c49e64f996d8), W(0x00009c397cb9c929), W(0x000015047fa8f5c5),
+     W(0x00005206ee0c3b92)},
+    {W(0x0000520660334948), W(0x00008555e8d1a066), W(0x0000ec6c672dbea5),
+     W(0x00007f1d39feea21)},
+    0
+  },
+  {
+    {W(0x00002857a89a2d12), W(0x000014e2604fd1b6), W(0x0000f59ff018fb77),
+     W(0x00009e612e2345c7)},
+    {W(0x0000bbeea7aeba83), W(0x00000b75124955bc), W(0x000072325d3caa66),
+     W(0x0000148733171e6e)},
+    0
+  },
+  {
+    {W(0x0000d7e475c625ef), W(0x0000bffa6fb07898), W(0x0000dc1441ea24d4),
+     W(0x000097679498c078)},
+    {W(0x0000e89cb2935adc), W(0x00004142039e93bb), W(0x000066332b700b82),
+     W(0x0000895a5eb3d714)},
+    0
+  },
+  {
+    {W(0x0000a0446658e7c3), W(0x00008a51b77283c5), W(0x0000a9c0ce1738e0),
+     W(0x0000194ed5e70c3d)},
+    {W(0x00008ebc4a1a243f), W(0x00006c82198a5a5b), W(0x00005d5fee89c2cb),
+     W(0x00006c92d728387f)},
+    0
+  },
+  {
+    {W(0x0000173f43152986), W(0x0000f6c1ec6b392b), W(0x00003f520973031c),
+     W(0x00006a10a409acb8)},
+    {W(0x0000986af06a37a2), W(0x0000248b9be68aaf), W(0x00001e2429a3942d),
+     W(0x0000d28ef431869b)},
+    0
+  },
+  {
+    {W(0x0000b156d8ac1482), W(0x0000269c310d0c66), W(0x0000d1ba63af4a6e),
+     W(0x0000c5958aa0db07)},
+    {W(0x00005cffc7bb5c3f), W(0x000033c8e12d937d), W(0x000081bd98927bc8),
+     W(0x000026f860db856b)},
+    0
+  },
+  {
+    {W(0x000022822cfd8361), W(0x0000d5f102e82e7e), W(0x00002dbec89893d4),
+     W(0x00002e198c797f1c)},
+    {W(0x00008018df4af48b), W(0x00000c412b11f16a), W(0x0000f8321c6f630d),
+     W(0x0000af27361cc7b7)},
+    0
+  },
+  {
+    {W(0x00007357288c29f9), W(0x00002ad97d8ed01e), W(0x0000ae12baa5ddf3),
+     W(0x0000845404129dcf)},
+    {W(0x00000f9aff21c11f), W(0x0000aafb0a24de55), W(0x0000f7514354ef71),
+     W(0x000054a46d2ef5c2)},
+    0
+  },
+  {
+    {W(0x0000f8f350ce942f), W(0x000005296861fbb8), W(0x0000153121381014),
+     W(0x0000b72898d69f7c)},
+    {W(0x0000b5e6f47c04d8), W(0x0000ccd4f6c36634), W(0x00002ee2a28bc00e),
+     W(0x0000e9cc6d25cd78)},
+    0
+  },
+  {
+    {W(0x0000f8b69c9bbae1), W(0x0000db797e70b84b), W(0x0000ede71bc95e79),
+     W(0x00008eabc44d8e29)},
+    {W(0x0000f668a6f1a4eb), W(0x0000d861dcee8199), W(0x00003a796be87138),
+     W(0x0000e87705775fb3)},
+    0
+  },
+  {
+    {W(0x0000b7a7c557d7db), W(0x00002e50129e5f77), W(0x0000c760a50bc48c),
+     W(0x00004317b583a718)},
+    {W(0x0000505c0ac0b0fd), W(0x000075a2b59929bd), W(0x0000e65cdc75be5d),
+     W(0x00003ed8512bfabf)},
+    0
+  },
+  {
+    {W(0x0000128693b3b292), W(0x0000061851b1c380), W(0x0000c9484397e99a),
+     W(0x0000497ee748c1e8)},
+    {W(0x00005f78a37421e6), W(0x00003cbb0a2f63f6), W(0x0000ee0cd6c5279f),
+     W(0x0000442049464ee6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00007aa37d5102e2), W(0x00000d703e65e1ce), W(0x0000a8b9958325c1),
+     W(0x000085cb370ff441)},
+    {W(0x0000824f4b59b603), W(0x000073c25219b495), W(0x000003f5bb46e9e2),
+     W(0x0000fc068662c86b)},
+    0
+  },
+  {
+    {W(0x0000fe41f1a23b65), W(0x00005d215b23fccd), W(0x0000cfacb361e0fe),
+     W(0x0000983316748a7c)},
+    {W(0x0000ac570c4dcc70), W(0x0000fd4c9619025b), W(0x000035dc4ad1af1f),
+     W(0x000025e243e41514)},
+    0
+  },
+  {
+    {W(0x0000f44da591a265), W(0x0000d8551cfdf2a2), W(0x0000e8d7beb9d996),
+     W(0x00003695305ffdad)},
+    {W(0x0000b89e55c4c3bd), W(0x0000017cce21f427), W(0x000092f6b06795c4),
+     W(0x0000aef40b4c09c8)},
+    0
+  },
+  {
+    {W(0x00004fb1e0e389a6), W(0x0000742669ce68e1), W(0x0000e563b1959872),
+     W(0x00001c298e1e0088)},
+    {W(0x000017c216fa3ff2), W(0x0000b649c4d245d4), W(0x0000ad7f989943d2),
+     W(0x0000ae7e30cddc5a)},
+    0
+  },
+  {
+    {W(0x0000c71ddec72939), W(0x00007bc4c81cd618), W(0x00006eaf98ea6023),
+     W(0x000080ed653f1032)},
+    {W(0x0000b294ea34bf06), W(0x00007bbb2ecdc9e7), W(0x00000e9da834a464),
+     W(0x0000ee712bef859d)},
+    0
+  },
+  {
+    {W(0x00005d70099195e4), W(0x00005893d0cdc5da), W(0x00001a4cba4047c8),
+     W(0x0000014df597efa7)},
+    {W(0x00003a62f79a07d2), W(0x00008a421cd72206), W(0x00001acad0f0d36e),
+     W(0x00004be619f08aec)},
+    0
+  },
+  {
+    {W(0x0000bee57427b5ff), W(0x0000fb4fff28793e), W(0x000057f2503cefc6),
+     W(0x000068b31908185d)},
+    {W(0x0000c9a3e83e2b8e), W(0x000086fd9f58c8b9), W(0x00009420477c8415),
+     W(0x00001ee197a95cc3)},
+    0
+  },
+  {
+    {W(0x00004794bb051a01), W(0x0000bf4424b0fbf8), W(0x0000a2e3dfc51c09),
+     W(0x00005779fd171872)},
+    {W(0x00006fcbc432c863), W(0x000096833b3b6125), W(0x00009fc1425d2afd),
+     W(0x00007166cc59f568)},
+    0
+  },
+  {
+    {W(0x0000d0ad544d1775), W(0x0000f1adc100ba43), W(0x0000128d0aa9b836),
+     W(0x00002e67e3443d3f)},
+    {W(0x0000ea896c3af666), W(0x000097f37da16fe9), W(0x0000b37d5de114f1),
+     W(0x00009a33b531f27f)},
+    0
+  },
+  {
+    {W(0x0000d5218fced749), W(0x00002d2eb1122c38), W(0x0000331aa44c650e),
+     W(0x00001e2f3005485b)},
+    {W(0x0000993b52f1dda9), W(0x00000324ed49d873), W(0x00009cdd0c97586b),
+     W(0x0000d6e6eeb10634)},
+    0
+  },
+  {
+    {W(0x0000d7d74c4472fb), W(0x00003837fc8c096e), W(0x00001553d7458802),
+     W(0x00002221f573525a)},
+    {W(0x00004096d3e7b57c), W(0x0000c05b97fb3b87), W(0x0000fd55ac8f4b97),
+     W(0x0000c0ec71498172)},
+    0
+  },
+  {
+    {W(0x00007e02d5bb753b), W(0x0000a77700e2a205), W(0x0000db10af95dac2),
+     W(0x0000e7457bca54b5)},
+    {W(0x0000ac8f5510fb77), W(0x000071d36293d4f2), W(0x0000f71bc701c67f),
+     W(0x0000bc2ccefe95b1)},
+    0
+  },
+  {
+    {W(0x00009c2c62dc05ab), W(0x00004908ac7552c8), W(0x00008699425948d7),
+     W(0x0000284492abf4fe)},
+    {W(0x000075a89ed8c82f), W(0x0000b025da1b13a8), W(0x00006f20564af4b4),
+     W(0x00000b5ef114ebcb)},
+    0
+  },
+  {
+    {W(0x00008b89cc9e5cba), W(0x0000d62232878d35), W(0x0000e36ed9cc5ac4),
+     W(0x000071dbb7df2f59)},
+    {W(0x00001def3a33fc70), W(0x00000e86b4d4cd8d), W(0x0000781d8094b271),
+     W(0x0000c9dfdac62ac6)},
+    0
+  },
+  {
+    {W(0x000059a69dd46e6e), W(0x00008e6438118fd2), W(0x00006ab8763635f8),
+     W(0x0000e5d245c2165f)},
+    {W(0x000040533e9a0b06), W(0x0000fcb6965b8fb7), W(0x0000c78cc29c116c),
+     W(0x0000e537b52eb9de)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00004e5cad26617c), W(0x0000d08aac4c51c3), W(0x000055f1d4f8ae6d),
+     W(0x0000195ff9410bd9)},
+    {W(0x0000f9ccfe0ec672), W(0x0000f087647d2dbe), W(0x0000dd41ef51700a),
+     W(0x0000a4c9d1126e61)},
+    0
+  },
+  {
+    {W(0x000060180f6f3208), W(0x000047d7bd48e3de), W(0x000043f5256a66c9),
+     W(0x000019d38ccb0a66)},
+    {W(0x0000a10936ebbe6d), W(0x0000c7aaf743fc4e), W(0x0000fb103f0ff1ca),
+     W(0x000028fb88163ad7)},
+    0
+  },
+  {
+    {W(0x0000f03fa80c10a0), W(0x00000dea463f28cf), W(0x00005f88962ee5fc),
+     W(0x00001ff34a560285)},
+    {W(0x0000ec3905d92487), W(0x000053add36de271), W(0x0000b25c4377a184),
+     W(0x00002fd72718635b)},
+    0
+  },
+  {
+    {W(0x0000275adeed2838), W(0x0000d8ca1e7c14b7), W(0x00007930a0518ce0),
+     W(0x00005c8f6b335a2f)},
+    {W(0x0000f8574dca7112), W(0x00001b6643e1c6a5), W(0x000060f02c5d9c93),
+     W(0x0000b64b96829a92)},
+    0
+  },
+  {
+    {W(0x000037031ca4a761), W(0x00005048a827134b), W(0x00007e141bcf9f35),
+     W(0x0000226090dfde9d)},
+    {W(0x00004f484b3cf614), W(0x000023b9493c9a47), W(0x0000fe5bb16409ed),
+     W(0x0000b78174f82856)},
+    0
+  },
+  {
+    {W(0x00008704f42cf8e6), W(0x00006e0a9445a977), W(0x000023a9554219b2),
+     W(0x0000b2a1ee567caa)},
+    {W(0x000026714bad9200), W(0x00003020c1358811), W(0x0000fec5ff22e305),
+     W(0x0000173dfff423fc)},
+    0
+  },
+  {
+    {W(0x0000ee0cc6cc0a36), W(0x0000c001df62dce9), W(0x0000d42cd64e9f61),
+     W(0x0000f63e5c36e755)},
+    {W(0x0000b09f32cac2f9), W(0x0000b6463aeddc1c), W(0x0000bce4fdf82d7c),
+     W(0x0000824d6a41719e)},
+    0
+  },
+  {
+    {W(0x00002536a3f66cd1), W(0x0000c42695b7a8c7), W(0x00008effddaee26a),
+     W(0x0000c3c2ab71c95a)},
+    {W(0x000011be45a3dbd9), W(0x0000531215131da0), W(0x0000d6f77a94ab55),
+     W(0x00003b547992c85e)},
+    0
+  },
+  {
+    {W(0x000019e97fed2c2e), W(0x0000cf69aa6893d6), W(0x0000c371445a7beb),
+     W(0x00007abe7df61886)},
+    {W(0x000024c5515cc93f), W(0x0000ae2da438b362), W(0x000087167b28b01d),
+     W(0x0000a71ec4f9f2c0)},
+    0
+  },
+  {
+    {W(0x000055cedda1cbb9), W(0x00008253307c89d2), W(0x0000d620bb7fb3f1),
+     W(0x0000bae934272166)},
+    {W(0x0000f370a352af73), W(0x00001e656efee155), W(0x0000083eb9a7252d),
+     W(0x000077301aa9b645)},
+    0
+  },
+  {
+    {W(0x0000a17e847f2eb9), W(0x00000187be5e0964), W(0x0000dcb72775ba50),
+     W(0x000066af47b5a0b7)},
+    {W(0x0000fe5b2bb6374f), W(0x0000d9a092f0b9cc), W(0x0000a9f0b28ef0f3),
+     W(0x00006a113bb99252)},
+    0
+  },
+  {
+    {W(0x0000f18a6e280462), W(0x000046ea8eb3069d), W(0x000074282c84a671),
+     W(0x0000c836b7da9aa5)},
+    {W(0x00008b6b8e9160a2), W(0x00008faca0095a20), W(0x000076a462743c1f),
+     W(0x0000ca45cc301add)},
+    0
+  },
+  {
+    {W(0x00009de2e82a0ed7), W(0x000040b4e67d8b66), W(0x0000c3f8105025ee),
+     W(0x0000435d3e89c6be)},
+    {W(0x000020e4fb2f38f1), W(0x0000332a2ba93f8e), W(0x00009bb55cb90305),
+     W(0x0000674a0d82b441)},
+    0
+  },
+  {
+    {W(0x0000f9775942f468), W(0x00004452ba3e6bdb), W(0x000078582f05d075),
+     W(0x0000a86d3c46b02e)},
+    {W(0x0000d8c95c8e8072), W(0x00007e688bcff265), W(0x0000756eb4a6812e),
+     W(0x000015a58c0f0f2f)},
+    0
+  },
+  {
+    {W(0x000061b8b196c240), W(0x0000742ab6c1c7cb), W(0x000036f5d81c6a14),
+     W(0x0000183c6ef85ccc)},
+    {W(0x00002de7ddfa0bd3), W(0x00009ba7ee788842), W(0x00001c12ff0ea32b),
+     W(0x0000c3f9c78ed08a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00007e772fb8ff2a), W(0x000043382fcfd562), W(0x0000aa48557d20bb),
+     W(0x0000f9e1f291ef8e)},
+    {W(0x0000c62dc85ab986), W(0x0000808e1e3310a9), W(0x0000acf7cb26beee),
+     W(0x00000ae91fcbd4ad)},
+    0
+  },
+  {
+    {W(0x0000aabcaf467cd5), W(0x00001b69acd50da1), W(0x0000adfddfa8d985),
+     W(0x0000766dcbe49785)},
+    {W(0x000040afe125be3d), W(0x000074dde4a3c9cb), W(0x0000806938e778b5),
+     W(0x0000d68b258ae2ca)},
+    0
+  },
+  {
+    {W(0x000025e5f6f949df), W(0x0000d2082d4f997b), W(0x00004be24f602fe6),
+     W(0x000081c851903f0c)},
+    {W(0x00007a28d8415f6a), W(0x0000f3c1303ad50c), W(0x0000bd1ef153655b),
+     W(0x0000b788c5d3b1e2)},
+    0
+  },
+  {
+    {W(0x00004e0c69bfd368), W(0x000037f9ef4a5c1f), W(0x00000fdbbe655c79),
+     W(0x00009a95e8459e8f)},
+    {W(0x000017fb955c42ce), W(0x0000acae4a273d73), W(0x00006535deacf268),
+     W(0x0000d5f76555fceb)},
+    0
+  },
+  {
+    {W(0x0000bfdba1f1c5da), W(0x00002898d99e3334), W(0x0000b3edcd642f55),
+     W(0x0000819ac481504d)},
+    {W(0x000094bfaa4d7b7d), W(0x000053564a609478), W(0x0000189f28f08e10),
+     W(0x000083395391787a)},
+    0
+  },
+  {
+    {W(0x00006670c4527205), W(0x0000df0f706c740f), W(0x0000fe02bf87aa85),
+     W(0x00008b39601f489a)},
+    {W(0x00006637bc79ecd3), W(0x0000ef5b9039647a), W(0x00009160af092af7),
+     W(0x000011d8857ba1fd)},
+    0
+  },
+  {
+    {W(0x00005eaf76275ea7), W(0x0000facdb0b9a925), W(0x00008782d53e1374),
+     W(0x0000c40a6457760b)},
+    {W(0x0000e60f7dea3f98), W(0x0000da01988f761d), W(0x00008a873f519d47),
+     W(0x000015a9772b5227)},
+    0
+  },
+  {
+    {W(0x0000c4e94bb7374d), W(0x000038b36e9cc027), W(0x0000d483890f9609),
+     W(0x00008582b36b40ba)},
+    {W(0x0000a6edab018c91), W(0x0000e3e89cd21c28), W(0x000036b9cbb7f32b),
+     W(0x0000d6a56cd9db6e)},
+    0
+  },
+  {
+    {W(0x000031776a332e10), W(0x0000fc8780191b26), W(0x00007306b9ca4beb),
+     W(0x0000790c1ed55387)},
+    {W(0x00002802895056c3), W(0x00008d2ff1d35d73), W(0x00007e5b23f19333),
+     W(0x0000bcc5811d7d29)},
+    0
+  },
+  {
+    {W(0x000023726d8d19c3), W(0x0000fdc2055f0163), W(0x0000b1406384600b),
+     W(0x00000380e507df62)},
+    {W(0x0000e4da9936e85b), W(0x00003042997a7a0c), W(0x0000767f723ca2bb),
+     W(0x0000a7c91a7e0f67)},
+    0
+  },
+  {
+    {W(0x00008057c50fa1cc), W(0x00003d5e4eb409d7), W(0x0000988b4ab77b5d),
+     W(0x0000e4536c3a4ef3)},
+    {W(0x0000ed31a5a1fc65), W(0x0000daefd522119f), W(0x00008ab7821ba3ee),
+     W(0x00005b81567b44b5)},
+    0
+  },
+  {
+    {W(0x0000daa3a65ef775), W(0x0000a7ef1b1d8dad), W(0x00006e73b94fd260),
+     W(0x0000dd3314ec9aca)},
+    {W(0x0000df09b5a2bd9a), W(0x0000605bbd8e3bae), W(0x00000f163a13b0ac),
+     W(0x0000f4e5d4390096)},
+    0
+  },
+  {
+    {W(0x000051dd0fb3952b), W(0x0000c2f2b232314a), W(0x0000ebc9043b1011),
+     W(0x00001836817e5996)},
+    {W(0x00008468d50a7a80), W(0x0000bca3f57a6330), W(0x000005b1e4185664),
+     W(0x000033ce38401489)},
+    0
+  },
+  {
+    {W(0x0000c41c60fd0304), W(0x000085ccc9077bc3), W(0x00009f0bd2c4774e),
+     W(0x0000754ddf139ceb)},
+    {W(0x0000ccd3c63b7315), W(0x0000274c84d5f58d), W(0x0000228a6a8ae8fa),
+     W(0x0000285162c57ad1)},
+    0
+  },
+  {
+    {W(0x0000884a3baa61ce), W(0x00002be539941f5e), W(0x0000bab37d9efb26),
+     W(0x000083722fa87e0c)},
+    {W(0x0000b00a16fcb69b), W(0x0000bc55c397a822), W(0x00008b5e26562a29),
+     W(0x0000144c3059bd06)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000eaacf057bbab), W(0x000099c99026f3e2), W(0x0000a6e9144989d3),
+     W(0x0000643e184504a9)},
+    {W(0x0000349e8ffbb15b), W(0x00006cb3bbc82b6c), W(0x0000824129a0d0d2),
+     W(0x0000ed7df7a2f2de)},
+    0
+  },
+  {
+    {W(0x0000d94aa8e2d2db), W(0x0000738d4b902ef5), W(0x0000b9ad91885184),
+     W(0x0000fb486b721ab4)},
+    {W(0x00002ac1acd7f551), W(0x00009fe6481ef90a), W(0x00002b0ad1905711),
+     W(0x0000a17abdb63f01)},
+    0
+  },
+  {
+    {W(0x0000f013d2d66cb4), W(0x00000a39950fa7f8), W(0x0000cc4819f602fb),
+     W(0x00001266d6d1533d)},
+    {W(0x0000bcbb9bde116b), W(0x000046fd4deec3ad), W(0x0000f2f95dda3b96),
+     W(0x000067280f82bc21)},
+    0
+  },
+  {
+    {W(0x000048a2de01de91), W(0x0000dbcc71dba242), W(0x0000d7c2da32a87d),
+     W(0x0000d02011628698)},
+    {W(0x000031f974bbae39), W(0x0000cb1c2a568cf2), W(0x000016d5b02a6867),
+     W(0x0000f5d0680129a5)},
+    0
+  },
+  {
+    {W(0x0000fb0b08a9cfdc), W(0x0000f7bac7701a11), W(0x0000100e91398677),
+     W(0x0000dc888e41e37e)},
+    {W(0x0000588b92b7cda3), W(0x00000a619e24bf72), W(0x00001f7e4755b9d2),
+     W(0x000078e0ca0564d1)},
+    0
+  },
+  {
+    {W(0x000093087ac0a4ab), W(0x000032bacba6e8aa), W(0x0000c14be3a2c943),
+     W(0x0000c1ff45014aab)},
+    {W(0x00001b59a9acc416), W(0x0000bb39d9e35049), W(0x00005be0ef7d8284),
+     W(0x00003c8dbf23b4e8)},
+    0
+  },
+  {
+    {W(0x00001ba648cd3363), W(0x00006811a770237d), W(0x0000be8c50f111b1),
+     W(0x0000e4e8c76983b6)},
+    {W(0x00009c02737582f5), W(0x0000086941e503cb), W(0x0000785a26313c0e),
+     W(0x000015669b3e6fe4)},
+    0
+  },
+  {
+    {W(0x0000f8c9e8f51025), W(0x00009027cf2963ae), W(0x0000001d534f5c15),
+     W(0x0000fa06f9e2b828)},
+    {W(0x0000d23c4ad5cf24), W(0x0000843ae6b31d16), W(0x00004901218c906c),
+     W(0x0000e939fd9f52e5)},
+    0
+  },
+  {
+    {W(0x0000ff4e88c30a88), W(0x0000cdee711044da), W(0x0000f265e09e374a),
+     W(0x00002dce0502810c)},
+    {W(0x0000c0f2c1d94ceb), W(0x0000c346667ea381), W(0x00006982bca64add),
+     W(0x00002c01410df9a3)},
+    0
+  },
+  {
+    {W(0x0000c5eb1304b5cd), W(0x000050fc5cdfb334), W(0x0000fcf3fc70c3e1),
+     W(0x00000380f8a7f2aa)},
+    {W(0x0000d1eb3f4caee3), W(0x0000faa9440dd9e7), W(0x000030ed4555c0b9),
+     W(0x000073bc4c4e0ea1)},
+    0
+  },
+  {
+    {W(0x000046c750741bad), W(0x0000d16caf0ba6f2), W(0x0000f4ff1dcea598),
+     W(0x0000498e57d63fa7)},
+    {W(0x0000819a8a7342f6), W(0x0000c7dcf6fcb7fb), W(0x000067b65953c90d),
+     W(0x00002372e21e44b9)},
+    0
+  },
+  {
+    {W(0x000084a3ec474b53), W(0x0000939c5df5223a), W(0x0000986f54094582),
+     W(0x00003412a6462baa)},
+    {W(0x00007c7e75b8fcab), W(0x00003f32d298e2b5), W(0x0000b22c6bfc3fdd),
+     W(0x00002d1d5d5361a7)},
+    0
+  },
+  {
+    {W(0x00000b7ee0df6988), W(0x0000611f76909b64), W(0x00002928b466ae28),
+     W(0x00001e400e4065e0)},
+    {W(0x00003c8000348caa), W(0x000057e57ef83679), W(0x0000d3bdf6270ed8),
+     W(0x0000ebe98fb88572)},
+    0
+  },
+  {
+    {W(0x00004c4d3f632961), W(0x00003303f4ac2da9), W(0x00004628668001a2),
+     W(0x000005a6f24b4faa)},
+    {W(0x0000d98596934b82), W(0x0000d1c8dce39939), W(0x0000654d953247d6),
+     W(0x00008c107181467c)},
+    0
+  },
+  {
+    {W(0x000045af2a43c700), W(0x000012529b89e0fe), W(0x0000eaaf278d0c0f),
+     W(0x0000d065daf90655)},
+    {W(0x0000c37cbfe41124), W(0x0000ca6863395d88), W(0x00002f63c52547f1),
+     W(0x00001ebd040394dd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000b6b77e09a7bf), W(0x0000e2035aee792f), W(0x0000c819ebedd123),
+     W(0x00004af48c159cea)},
+    {W(0x0000e942a287bce4), W(0x0000b3fcec631b22), W(0x0000e821d0be4cdb),
+     W(0x0000b0d449d8752b)},
+    0
+  },
+  {
+    {W(0x0000ca58022b686a), W(0x00000b1fc4eb7eeb), W(0x0000f6327e83d684),
+     W(0x0000d328f6871549)},
+    {W(0x0000979d89333986), W(0x0000d1535b161319), W(0x0000973795580900),
+     W(0x0000d5e5ffec609a)},
+    0
+  },
+  {
+    {W(0x0000c091c5d454cf), W(0x00007e459f7d1c43), W(0x00001429f31dc52f),
+     W(0x00003b78a92c0df6)},
+    {W(0x0000288b01801550), W(0x000081672d71c97a), W(0x0000840d52ca8a92),
+     W(0x00008702b6bddff7)},
+    0
+  },
+  {
+    {W(0x0000590095fbbd19), W(0x00004aa705fe2516), W(0x000019bbe2a65c2a),
+     W(0x00008f7ca3cc664b)},
+    {W(0x0000af3eacff51e6), W(0x00005b635f928086), W(0x0000a032e4a20f1b),
+     W(0x00000e2b2be194f1)},
+    0
+  },
+  {
+    {W(0x00007605b7c8cca7), W(0x0000ed15b4cef421), W(0x00005d67123e6f3b),
+     W(0x0000cd08c01201fa)},
+    {W(0x00009e522a639c33), W(0x00001b58b28fcf75), W(0x0000b51b9e753e6c),
+     W(0x00000746baae7ce5)},
+    0
+  },
+  {
+    {W(0x00008d6739fa6e71), W(0x0000e783e1bb8ec6), W(0x0000a422ee362537),
+     W(0x0000e2d5d2fdeda7)},
+    {W(0x0000e51a07d7ba16), W(0x0000b6e50d1413c2), W(0x0000d9a9e2c4954c),
+     W(0x0000933a43173906)},
+    0
+  },
+  {
+    {W(0x0000af116a8790b4), W(0x0000c6d183d89def), W(0x00002d01f7d7cbf9),
+     W(0x000037e644c2ad21)},
+    {W(0x0000ac13df747e3c), W(0x000034de93ba4f20), W(0x000014fdb102e4fa),
+     W(0x00007d22bb6ffdb7)},
+    0
+  },
+  {
+    {W(0x00007fa426984cef), W(0x0000911e7d812c53), W(0x0000554baafa4f23),
+     W(0x0000028d15e275e3)},
+    {W(0x0000a72999913442), W(0x00006cf3e2424a23), W(0x000016700eba886e),
+     W(0x00006fc74bcf9c45)},
+    0
+  },
+  {
+    {W(0x0000bb2afe0c1b51), W(0x0000f2165a088879), W(0x0000dbc371aabdb4),
+     W(0x00003b3096652e64)},
+    {W(0x00006604f98174b0), W(0x00007fb337ddc61a), W(0x0000996e2499d7a3),
+     W(0x0000102acb36e442)},
+    0
+  },
+  {
+    {W(0x000000f8932a2cbd), W(0x00007340e786ee2a), W(0x00005e0bf1592335),
+     W(0x000095c7a47f8fb7)},
+    {W(0x000046ef3a9f0903), W(0x0000b1e8093fc527), W(0x0000f8764fb887fa),
+     W(0x0000f958eddf25d7)},
+    0
+  },
+  {
+    {W(0x0000ef61178dcd37), W(0x00003e9a30ad977c), W(0x0000d1f160c03508),
+     W(0x00002f414f283011)},
+    {W(0x000077a334eb6d98), W(0x00009fcdfe535348), W(0x000029574371b6ce),
+     W(0x00008ba363f597d7)},
+    0
+  },
+  {
+    {W(0x00006cc7bfcd83e9), W(0x0000068e741abf84), W(0x0000b8371806d872),
+     W(0x000017578470a0b9)},
+    {W(0x0000548309198112), W(0x0000126f4f93127e), W(0x00009120e05f82b2),
+     W(0x000080000b2fbac3)},
+    0
+  },
+  {
+    {W(0x000080efede89cc3), W(0x000080436cc01b77), W(0x0000657fbc2f00f2),
+     W(0x0000e6df418d3414)},
+    {W(0x000072269f10330d), W(0x00008469a31cd9ad), W(0x0000dba9ac81ae7c),
+     W(0x0000721b77e89c39)},
+    0
+  },
+  {
+    {W(0x00007cc98e9b81f6), W(0x00007f3b07900532), W(0x00000641a62ffe21),
+     W(0x00006eb09fad36ac)},
+    {W(0x00006b23a33d5da3), W(0x0000109b99fe72a6), W(0x00007f8e89854b98),
+     W(0x000040dabb7fa735)},
+    0
+  },
+  {
+    {W(0x00008a5ad8a0b69c), W(0x000087b33725eeb0), W(0x0000a300488a77b2),
+     W(0x0000d24a89e95cfa)},
+    {W(0x00007424fc0a01d6), W(0x00004c940a211c3a), W(0x0000909ea2d1fe4a),
+     W(0x00008be82994e5fc)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000182323c6424b), W(0x0000b858fe9005b2), W(0x00003b9ad165b0ca),
+     W(0x00004258dc2e44ce)},
+    {W(0x0000b734ef38bea4), W(0x0000223ec75790bd), W(0x0000f371c3752d96),
+     W(0x000049ebe894ef06)},
+    0
+  },
+  {
+    {W(0x00004f65123bf12c), W(0x0000c5dde74d773b), W(0x0000678960ed3b18),
+     W(0x0000ca647c9f6a23)},
+    {W(0x00009b89e84e1e28), W(0x0000e609b1ff5731), W(0x0000e9fbf4414508),
+     W(0x0000faa14bc03642)},
+    0
+  },
+  {
+    {W(0x00004680d6138c60), W(0x0000251a21c92080), W(0x000043f6a0d3d2e0),
+     W(0x0000330882a9b36e)},
+    {W(0x0000f0aae8f22047), W(0x00004217b66f6b51), W(0x0000d2c5f2926cc6),
+     W(0x0000e4b0482efce1)},
+    0
+  },
+  {
+    {W(0x00000f542e671714), W(0x000061bd118c6df7), W(0x0000a3422a2482a1),
+     W(0x0000a63bb6c90f17)},
+    {W(0x000079deb7df6a15), W(0x0000b6ba2ebd13dd), W(0x000053fb111d310a),
+     W(0x00004917635c1d8d)},
+    0
+  },
+  {
+    {W(0x000097bc5497692d), W(0x0000a9021ccf7eec), W(0x000090772102ce0f),
+     W(0x00003412cb08b2d6)},
+    {W(0x00009a6bf775fe21), W(0x00002fdc96e61d11), W(0x0000c73f0c56b956),
+     W(0x0000c4dc37d11175)},
+    0
+  },
+  {
+    {W(0x000076e9af038643), W(0x0000f987a3e4b24d), W(0x0000c0df191ed3e6),
+     W(0x00002da0ee27eba2)},
+    {W(0x0000b9cb3646477d), W(0x0000d675b90ea05b), W(0x0000d9a4fb258677),
+     W(0x000007915524e6dc)},
+    0
+  },
+  {
+    {W(0x0000460a53e77d3f), W(0x000024dbf94da4f0), W(0x00006ed303178e22),
+     W(0x0000c9559c1a4ed2)},
+    {W(0x0000ca276121b6e2), W(0x0000e3fbe61b30ea), W(0x000054f34503826e),
+     W(0x0000c03ede43de2f)},
+    0
+  },
+  {
+    {W(0x000011789704b5aa), W(0x000085df5accce39), W(0x0000d78a5040f753),
+     W(0x00003c6d858c55df)},
+    {W(0x0000a56ab2e16b7d), W(0x0000df03242c5ce7), W(0x000067c504f75c2d),
+     W(0x0000224c3b02fa70)},
+    0
+  },
+  {
+    {W(0x0000062c1f6511fe), W(0x00008943244d12fb), W(0x0000305c87c7ab71),
+     W(0x0000bae5f7bbb010)},
+    {W(0x00008933240a696b), W(0x00007fb8e369016c), W(0x0000fca6b0643527),
+     W(0x0000b9a067cc8f5c)},
+    0
+  },
+  {
+    {W(0x0000c1b37eb339b0), W(0x0000e9c7c77c1083), W(0x0000c181680a2b24),
+     W(0x000096120db86389)},
+    {W(0x00005b6f13e50543), W(0x0000a86027b9660a), W(0x00000cdc7bd6dafa),
+     W(0x00003591ccc0525b)},
+    0
+  },
+  {
+    {W(0x0000332ef89af52b), W(0x000062e94dc8d8ba), W(0x00003700c3784d5b),
+     W(0x0000ff625ef03e8a)},
+    {W(0x00003ed315b4e2de), W(0x0000929842fea31c), W(0x000051007860058d),
+     W(0x000094e43077941d)},
+    0
+  },
+  {
+    {W(0x0000956d277a9f1d), W(0x0000ba2a16f98682), W(0x000033cf1ff84595),
+     W(0x0000d9eb38866618)},
+    {W(0x0000e891e672eb0c), W(0x000007e1cdcf175a), W(0x00001db77e7201d3),
+     W(0x00009ccc356636d0)},
+    0
+  },
+  {
+    {W(0x00003e01c1e44e27), W(0x00000c14b4cbe4af), W(0x0000d8582b8d25e7),
+     W(0x0000e7084f50c438)},
+    {W(0x0000bc4ce90397fd), W(0x00006f72e10ae5af), W(0x000013926084d6f7),
+     W(0x00002c05789c9237)},
+    0
+  },
+  {
+    {W(0x00004c253d43367f), W(0x00002bd063dc89b5), W(0x0000892c376a2b6a),
+     W(0x00006aac87862279)},
+    {W(0x0000838d36981cb2), W(0x000026f56d42e7a3), W(0x0000c16c4501d677),
+     W(0x000029966d6e17b5)},
+    0
+  },
+  {
+    {W(0x0000669901d3d8c3), W(0x00001273ac2f2947), W(0x0000bcb729cf4a3c),
+     W(0x0000c1a16ec6d21c)},
+    {W(0x00004d9b430697d3), W(0x0000e67828a839f5), W(0x000086833d709103),
+     W(0x000071174c9d3e5c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000001cf4b81c09c), W(0x000062a2ed791d86), W(0x0000cbcae8a735bf),
+     W(0x0000f5e0f31b649b)},
+    {W(0x0000908b52279a24), W(0x0000eafac9af1139), W(0x0000ab05ff64549d),
+     W(0x00000aa9f937fd8f)},
+    0
+  },
+  {
+    {W(0x00003da137d96fe7), W(0x000017c1a6098344), W(0x0000bee39b6510d1),
+     W(0x00008f7b7d4492de)},
+    {W(0x00000e9bd24c0bcb), W(0x00004a81b4cec0f0), W(0x00008929816da568),
+     W(0x00002404cb5c32e5)},
+    0
+  },
+  {
+    {W(0x0000fa6258e83c67), W(0x00001a455517e897), W(0x0000f80e1d713ce1),
+     W(0x0000348cf2829005)},
+    {W(0x0000dc6420572168), W(0x0000a80ea215560f), W(0x0000ee293a744066),
+     W(0x00000f61541424ed)},
+    0
+  },
+  {
+    {W(0x000004038bae5818), W(0x0000fca526f2e3ff), W(0x0000d86e94b2effc),
+     W(0x0000b5610c9cfedd)},
+    {W(0x00003f5c10fbd66e), W(0x00001da3012081d5), W(0x0000ff747e1dbf50),
+     W(0x000081b33df94403)},
+    0
+  },
+  {
+    {W(0x00007654656760e5), W(0x0000ea9648f4fe6d), W(0x000043390c9eb9bf),
+     W(0x0000ed8fa7d77400)},
+    {W(0x000057269c4e0201), W(0x0000af627d490da2), W(0x00001e5fd26164a9),
+     W(0x0000683e5dda3636)},
+    0
+  },
+  {
+    {W(0x00007d93cee922d5), W(0x0000e2e6ef974f64), W(0x0000b51c68a08a7a),
+     W(0x00005d911ba852e7)},
+    {W(0x0000a0f92cc173be), W(0x0000a78bab21cb1e), W(0x0000d5bacc861e14),
+     W(0x0000fc31bfd80a34)},
+    0
+  },
+  {
+    {W(0x0000a1b4a2021e16), W(0x000006808b51da72), W(0x00008dbd405db16c),
+     W(0x0000adba3cd8a189)},
+    {W(0x00003b304909dffd), W(0x0000ce6aaa36d852), W(0x000062f6764cc4ed),
+     W(0x000077e13f37680a)},
+    0
+  },
+  {
+    {W(0x000004dbf084d78d), W(0x0000203e36021a2c), W(0x0000a2f0879cbe61),
+     W(0x0000db8e227e82d8)},
+    {W(0x0000aad12ab010f7), W(0x00007c643243fdb0), W(0x0000316d795505d5),
+     W(0x0000b3be62d219d3)},
+    0
+  },
+  {
+    {W(0x0000f0e5627ee41d), W(0x0000cc28247d9db3), W(0x000025f9fe9ac51a),
+     W(0x000084a8638fb199)},
+    {W(0x0000eca5f4c7b1f4), W(0x00006c8a3aa46aeb), W(0x0000b2b5c756d023),
+     W(0x00008f080d33fb40)},
+    0
+  },
+  {
+    {W(0x0000470adceae7ab), W(0x0000481b8b935271), W(0x00004a75610300de),
+     W(0x000077cf84f5a96c)},
+    {W(0x00007e2abf5646f0), W(0x00000f83dbe8e697), W(0x0000c4ef4184982e),
+     W(0x0000b0c5d7590c62)},
+    0
+  },
+  {
+    {W(0x000031af89631846), W(0x0000bfabaeca333d), W(0x0000ed53271d0811),
+     W(0x0000a55e847eec7f)},
+    {W(0x0000109c1eb23e14), W(0x0000dffaa18426fe), W(0x0000393238519a3f),
+     W(0x0000ed095f319fe4)},
+    0
+  },
+  {
+    {W(0x0000c1898c241d0d), W(0x0000f836d0b55646), W(0x0000d6a35188df55),
+     W(0x00008c3f033059b3)},
+    {W(0x0000f6e06b7755a6), W(0x00006fd951f91c23), W(0x0000c33bbbbc3308),
+     W(0x000020fba2c8bea9)},
+    0
+  },
+  {
+    {W(0x0000d01a46b4da94), W(0x000038f164b25bf4), W(0x00006d8996a81b95),
+     W(0x0000a0ce0bb16917)},
+    {W(0x0000d9f2957a0fc1), W(0x0000ef408bba3de2), W(0x0000eb7bd03e7a4d),
+     W(0x00003e4faf9b39d2)},
+    0
+  },
+  {
+    {W(0x00005c8fddb50060), W(0x000065a3ab23eb87), W(0x0000d1ed5a777422),
+     W(0x000012dffef1d89c)},
+    {W(0x0000541b9899b5dd), W(0x0000124c74875fda), W(0x0000306e9df03e1a),
+     W(0x00003935b6382aca)},
+    0
+  },
+  {
+    {W(0x00005692180669b0), W(0x00001cc5c2a810f1), W(0x00008c23adabd00a),
+     W(0x0000716bca3a531c)},
+    {W(0x00004663af2c8887), W(0x000024c082edf1b5), W(0x0000306ce253c51f),
+     W(0x00005403295d8806)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000c532dac10960), W(0x000035a44cc16100), W(0x000079d71d72bbba),
+     W(0x0000f1e3d414faf3)},
+    {W(0x00006acbbfbc0308), W(0x000040041000ca8a), W(0x00003c49522e41e3),
+     W(0x00006feda53e6eff)},
+    0
+  },
+  {
+    {W(0x000001af44115e22), W(0x0000b766e7e641ce), W(0x00007d63f34ece5b),
+     W(0x0000efbfff927028)},
+    {W(0x0000121e4862cc1d), W(0x00003348282688cd), W(0x000003b475ff7920),
+     W(0x0000b286da6d8434)},
+    0
+  },
+  {
+    {W(0x0000509b1fea59c2), W(0x0000879ad0f5f04f), W(0x0000d2673a39a014),
+     W(0x00009919345b467c)},
+    {W(0x0000814989cdecee), W(0x0000941be7633c02), W(0x00006182896f3504),
+     W(0x000059f32f96392e)},
+    0
+  },
+  {
+    {W(0x00004b3e4137d017), W(0x00000370bdb69b60), W(0x0000035c94435ee4),
+     W(0x00007b5e81829c36)},
+    {W(0x000037ec48b29979), W(0x0000884d8e6e93b3), W(0x000058dc4b451303),
+     W(0x0000127bfc540d50)},
+    0
+  },
+  {
+    {W(0x000052758f3a9ec2), W(0x0000f81c6baa32df), W(0x00008e241ea41b5e),
+     W(0x00002d77172a6d31)},
+    {W(0x0000fd6b0079218e), W(0x000051c5f241b828), W(0x00002b777334a759),
+     W(0x0000cb556d3dbe85)},
+    0
+  },
+  {
+    {W(0x0000ac20b500cab1), W(0x0000a6bb751b020e), W(0x00000a5784cf4b02),
+     W(0x00003ddb9ddf7bbc)},
+    {W(0x0000fc2bc7a03143), W(0x00007111941c7b8e), W(0x00008126f8296a80),
+     W(0x00008e09b0abef98)},
+    0
+  },
+  {
+    {W(0x00000564926731fb), W(0x0000a9ba7bed0dfe), W(0x000047ce614c4be2),
+     W(0x00005aadbe474a1f)},
+    {W(0x0000f573109133a8), W(0x000009b5e9747807), W(0x0000c8e4d97b2fb0),
+     W(0x00007e3fffd4d155)},
+    0
+  },
+  {
+    {W(0x00005ab52ecc41da), W(0x0000b77ca7ce74e0), W(0x0000c0ea3c822475),
+     W(0x00003c58917ad57c)},
+    {W(0x000006baf0e88d0a), W(0x00001ffcbf864e16), W(0x000020e762902086),
+     W(0x0000770ca392649a)},
+    0
+  },
+  {
+    {W(0x000024a7c79a921c), W(0x00000bf5dbe6a366), W(0x0000e6f3715d0f72),
+     W(0x0000da949a359f02)},
+    {W(0x00003ab27be25a61), W(0x0000a594ec9ebc23), W(0x000001850cc09020),
+     W(0x00004287945f0090)},
+    0
+  },
+  {
+    {W(0x0000c48c798d416c), W(0x0000c167d8c124a7), W(0x0000cdffd8c95d04),
+     W(0x000010923f1c9b23)},
+    {W(0x000069f4ef8ec60c), W(0x00009a5e4f8d2d11), W(0x0000ddfa0f0ea42e),
+     W(0x000014fe6503b31d)},
+    0
+  },
+  {
+    {W(0x00004918feecbda6), W(0x0000eee96924e820), W(0x00007a296cd45b07),
+     W(0x00007fcea681f3e0)},
+    {W(0x00006fadaa57080c), W(0x000009362036cbc1), W(0x0000c8077fd09887),
+     W(0x000017467bc9ea8e)},
+    0
+  },
+  {
+    {W(0x00005dc0b4b01680), W(0x00003199b6cef466), W(0x0000df9e6dfc5c12),
+     W(0x00007e560a224f81)},
+    {W(0x0000c175db9b2a11), W(0x0000feb69e7fd503), W(0x000076e983ceaffc),
+     W(0x0000c44ad3f81221)},
+    0
+  },
+  {
+    {W(0x0000e59a3b80f8a8), W(0x0000b211bad2be8e), W(0x00003cd1dad6f5eb),
+     W(0x00002284bd7f1586)},
+    {W(0x000033b7245dc68d), W(0x0000b8a1f3117180), W(0x00002c91a7694b49),
+     W(0x00008fc0bdd816fc)},
+    0
+  },
+  {
+    {W(0x0000b932463c6c22), W(0x00003e0973e46963), W(0x000075becad22797),
+     W(0x0000c3e87da7df77)},
+    {W(0x000047888dc05769), W(0x0000fafadefb60ed), W(0x00000dfeccdb4386),
+     W(0x00008075830dcf6b)},
+    0
+  },
+  {
+    {W(0x000037777ee8b15a), W(0x0000e5129362d4c4), W(0x0000032a962f0982),
+     W(0x0000cb5d0ceb89dc)},
+    {W(0x00004c31b53ba58b), W(0x00008c1a5c0d975c), W(0x0000615d316c3179),
+     W(0x0000cf9346a25c5e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000059f4043b4a90), W(0x000080e90a17d8d6), W(0x0000d34e4c273ce3),
+     W(0x0000c4e5af0326d1)},
+    {W(0x000098417b4295a9), W(0x0000500a6acb41d2), W(0x0000984683f184dd),
+     W(0x00003e82f0fccd2d)},
+    0
+  },
+  {
+    {W(0x00009169e26d7d77), W(0x000025996e10a9cd), W(0x00000f85325b0389),
+     W(0x00002faa52ba8f1e)},
+    {W(0x00009518384362f8), W(0x00003638bd5387ed), W(0x0000d85a798bd7ef),
+     W(0x000023fa3c96bb75)},
+    0
+  },
+  {
+    {W(0x000073d99b484ef4), W(0x0000323fd5738384), W(0x000059040b2056e4),
+     W(0x000059e5ea303ce8)},
+    {W(0x00009bc06277e879), W(0x00009dbf6cc6f3fb), W(0x000023a47a9cb6a9),
+     W(0x00007f2fa39ea2eb)},
+    0
+  },
+  {
+    {W(0x000002d8455dc2da), W(0x0000d167985a6ed2), W(0x000070280d2cff42),
+     W(0x00009d59d2435438)},
+    {W(0x000016fd3c95d6fb), W(0x0000d9513b1464c4), W(0x0000d4e3209dd8cd),
+     W(0x0000afc11522aa6f)},
+    0
+  },
+  {
+    {W(0x000034139c45fcde), W(0x0000c0e77c40cb8e), W(0x0000066476b017da),
+     W(0x0000f4083468753e)},
+    {W(0x00004fa9158c66a4), W(0x00009c78c3ed871d), W(0x000032d5bf42e4a8),
+     W(0x0000b49a542267b7)},
+    0
+  },
+  {
+    {W(0x00009d21bc3005d0), W(0x00000c214d0f7e37), W(0x0000f80777fc644f),
+     W(0x0000a96409023aea)},
+    {W(0x000015356aebbbac), W(0x000010ab7c86ca54), W(0x0000392f198711cb),
+     W(0x0000a2c385727633)},
+    0
+  },
+  {
+    {W(0x0000d767058bf8e8), W(0x0000c09da43e13af), W(0x0000b7155011c1f6),
+     W(0x00006382879b3953)},
+    {W(0x0000c124882937df), W(0x0000308b4baeeb03), W(0x0000ca74e8ae3f92),
+     W(0x00009b91d32f8282)},
+    0
+  },
+  {
+    {W(0x000004b12978dbe6), W(0x00007fcad74c05f1), W(0x000086409370a975),
+     W(0x000092103426dcd8)},
+    {W(0x00006cc84731fce1), W(0x0000dfccbf9c2921), W(0x000008ccb74379dd),
+     W(0x0000832c83e1156a)},
+    0
+  },
+  {
+    {W(0x00006a0bc225d84b), W(0x00001f0744690af5), W(0x000055165d570142),
+     W(0x000015254c225fb1)},
+    {W(0x00006eafda60d59e), W(0x000064eb8beafe42), W(0x000046746e179002),
+     W(0x00007d8c1d08c927)},
+    0
+  },
+  {
+    {W(0x0000a1626241ed92), W(0x00001f978e7be904), W(0x000056876b1537d2),
+     W(0x0000b0991f6387a5)},
+    {W(0x0000f39ea12d9a31), W(0x00002d2feb641a6a), W(0x0000bb293e0cb67d),
+     W(0x000024cdf76c05ee)},
+    0
+  },
+  {
+    {W(0x0000ddd742abbade), W(0x0000832fae512062), W(0x00002d4a9499127f),
+     W(0x00003b1ca2d9b69f)},
+    {W(0x0000bf0732c4759e), W(0x0000e4631537d78d), W(0x0000a0b549a6246a),
+     W(0x00006e4bc3277b73)},
+    0
+  },
+  {
+    {W(0x00007a8bbb66b0d1), W(0x0000ecaac7389681), W(0x0000c8b73900dd39),
+     W(0x00003beda6d40992)},
+    {W(0x0000b07a34f8b210), W(0x000025dc86e1a3f5), W(0x000099b7f186cd98),
+     W(0x0000ccb3ceb81d3a)},
+    0
+  },
+  {
+    {W(0x00009b2046794cc8), W(0x00002dc59725f3b4), W(0x0000fc1a846df40c),
+     W(0x00004bf7929df016)},
+    {W(0x0000650d726d8eaf), W(0x0000f6e7195360c6), W(0x00001889b776caf4),
+     W(0x0000e4ee8fe92fe2)},
+    0
+  },
+  {
+    {W(0x0000098fc4b4442f), W(0x0000a24828e54e37), W(0x0000e8f067e7643f),
+     W(0x0000133909a58777)},
+    {W(0x000075c011df0020), W(0x00005f54545ea23c), W(0x0000242a3626413f),
+     W(0x0000d43e007a66ca)},
+    0
+  },
+  {
+    {W(0x00001265feff1483), W(0x00003c9d22972b37), W(0x000077ce384b695b),
+     W(0x0000ed00a5ad56d5)},
+    {W(0x0000f1d14503b59c), W(0x00000bffb71530d4), W(0x0000bec2226933a8),
+     W(0x0000bdbea2884ac0)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000d5d5decbec87), W(0x00002adf763fee4e), W(0x0000a5dd3f7f0447),
+     W(0x000021c40e400aff)},
+    {W(0x00005c0b4b2691c9), W(0x0000c7c22324d540), W(0x0000f00dde0160bc),
+     W(0x0000e69326449c6b)},
+    0
+  },
+  {
+    {W(0x000057f2b3195cb1), W(0x0000398254ed7828), W(0x0000870c65b43366),
+     W(0x00007116824c07cf)},
+    {W(0x00009d2fa6c82dd3), W(0x0000b0ba5f303580), W(0x0000d38d778cd874),
+     W(0x0000cf7c8de52893)},
+    0
+  },
+  {
+    {W(0x0000b3917ee9d1cf), W(0x0000fa8fa9936afc), W(0x0000e6a4523040cf),
+     W(0x00008d023721e26c)},
+    {W(0x0000ef08ceb9600b), W(0x000015975b0b7e24), W(0x00000fa98ad4d601),
+     W(0x00001cf2186e231d)},
+    0
+  },
+  {
+    {W(0x000081beeceab9c6), W(0x00003517e153fa5d), W(0x0000eb39eeaa4fd1),
+     W(0x0000529ec5c68d06)},
+    {W(0x0000e177c1c0bbd4), W(0x00001ea33701878c), W(0x000051beba436be2),
+     W(0x0000c1f5e6c94ace)},
+    0
+  },
+  {
+    {W(0x00003ba3dad1be93), W(0x000052eaa9f54adc), W(0x00000fba1fa38cd1),
+     W(0x00009c94b8bb7be8)},
+    {W(0x00002d323e3232e7), W(0x000017f27b40499e), W(0x0000424ca9145d69),
+     W(0x000074b62eadc64b)},
+    0
+  },
+  {
+    {W(0x00004d4bbf9ee1cc), W(0x0000851e1a7ec88a), W(0x0000e9f7c2f4d0fb),
+     W(0x00003dac81b10c9c)},
+    {W(0x000060b06ae38b48), W(0x000021f85602cec3), W(0x00001ac5283b7696),
+     W(0x00007105199cd7fb)},
+    0
+  },
+  {
+    {W(0x0000896b0350de7f), W(0x0000fcf0f10068dd), W(0x00001ef42b33eed0),
+     W(0x00005d83dff554d6)},
+    {W(0x0000b4e130d3e6ba), W(0x0000048b659f8310), W(0x00001d88f88f9532),
+     W(0x00002d77d5bd0599)},
+    0
+  },
+  {
+    {W(0x0000cdfe76e3aeb5), W(0x00001c3052df5a88), W(0x0000e0c2f365e54a),
+     W(0x000052cb0b3c4409)},
+    {W(0x00003cf92cbacfe3), W(0x0000b52dd7fe7df3), W(0x00000066a6d0ac52),
+     W(0x0000dd5126928c57)},
+    0
+  },
+  {
+    {W(0x0000011edd40f731), W(0x00006aa2bfc593c3), W(0x00007df48d8b168b),
+     W(0x0000be927b940848)},
+    {W(0x0000bb580b56a977), W(0x0000538ee0811ccd), W(0x0000f875ad7939c6),
+     W(0x0000fcbbb742b9cd)},
+    0
+  },
+  {
+    {W(0x0000e862a28aad39), W(0x000074dceb726fd2), W(0x0000e8573c6bf47d),
+     W(0x0000751c749757d5)},
+    {W(0x0000e99813cd8d26), W(0x0000217f24800a05), W(0x0000b80d5f5729ef),
+     W(0x0000c39ba76c51ba)},
+    0
+  },
+  {
+    {W(0x0000d378e0ef5dcc), W(0x0000d9c3cc56bd46), W(0x0000b302ef03b33a),
+     W(0x00007882ee0140b8)},
+    {W(0x00009989a248a08c), W(0x0000a3f93bcedba2), W(0x0000693881639a78),
+     W(0x000010dbb22ddf2d)},
+    0
+  },
+  {
+    {W(0x000077a68e2687c1), W(0x000063bd0cf1a640), W(0x000024762f427b27),
+     W(0x000018384cfa2799)},
+    {W(0x0000f9b062c2bb2d), W(0x000081abee9e6756), W(0x0000383370e7f9f1),
+     W(0x0000097445346f62)},
+    0
+  },
+  {
+    {W(0x0000cbb9b21536e6), W(0x0000520849d18a11), W(0x0000d1839ff746b6),
+     W(0x000026b5b8b4c249)},
+    {W(0x00001d20195fdd49), W(0x000081cb6379189e), W(0x00005f20add53479),
+     W(0x0000584f683bf2ea)},
+    0
+  },
+  {
+    {W(0x0000b671306cc125), W(0x00004db419a8b910), W(0x0000bfb346e4d8eb),
+     W(0x0000562a78f3fd64)},
+    {W(0x00000478628438c9), W(0x0000bb37e72596b5), W(0x0000f0e68d74161c),
+     W(0x00005177e25b0c86)},
+    0
+  },
+  {
+    {W(0x00006a5f19482152), W(0x00004171c9ca4c1c), W(0x00005f7de9ea56cf),
+     W(0x000082f1009b4b89)},
+    {W(0x000038e101c58a37), W(0x0000c7b5643fe556), W(0x00002efcda987307),
+     W(0x00000801bc998476)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000071930c5d8f50), W(0x0000b904b596b6eb), W(0x000075131c245c02),
+     W(0x000004bc1f71951f)},
+    {W(0x0000916ebe34803d), W(0x00008c21962aa4d0), W(0x0000f8d08bec948a),
+     W(0x0000150096e7fd69)},
+    0
+  },
+  {
+    {W(0x00003393a8a36790), W(0x0000db801dc732d5), W(0x0000187879a98650),
+     W(0x0000c0851e20f001)},
+    {W(0x0000ae77fa3a3097), W(0x000006c991ac4e5e), W(0x00008996ed444b8b),
+     W(0x0000a5ae1f069576)},
+    0
+  },
+  {
+    {W(0x0000ab420acbc1f9), W(0x0000b67d501b3869), W(0x0000c44e3d97555a),
+     W(0x0000b862ed02544a)},
+    {W(0x0000cfc50581a1ec), W(0x000028fbb82dcd5a), W(0x00001c776c37f036),
+     W(0x00009a9642d4c8f5)},
+    0
+  },
+  {
+    {W(0x0000cffb8ee49f58), W(0x0000b2efd6f378e0), W(0x0000c2b31664450c),
+     W(0x000098502ff0e116)},
+    {W(0x00006a702400754c), W(0x000062b864b59205), W(0x000091d0237d7dfc),
+     W(0x0000a12d31802884)},
+    0
+  },
+  {
+    {W(0x0000be6f8eef0da6), W(0x0000a70bb552edc1), W(0x0000e39a17ac7e43),
+     W(0x0000124209bd29b1)},
+    {W(0x00008b4967ab9de1), W(0x0000b5173aaa1433), W(0x00009fb08f259dac),
+     W(0x0000d805927fd131)},
+    0
+  },
+  {
+    {W(0x00000ba056d6df9e), W(0x0000153450c48f36), W(0x0000a551708748c8),
+     W(0x0000fc37594434bd)},
+    {W(0x000024fabe85b10f), W(0x0000c18156aab92a), W(0x0000549ce77fc718),
+     W(0x0000c4cfc764f88e)},
+    0
+  },
+  {
+    {W(0x000053baaf2e6f03), W(0x0000eae1ecec7d7b), W(0x00009671975e8dd4),
+     W(0x00002377d1ff3bcc)},
+    {W(0x00006cbde11d9840), W(0x0000bbcb6a8b930a), W(0x00007a5a02ee3ade),
+     W(0x0000af1edd09a71d)},
+    0
+  },
+  {
+    {W(0x0000ee34bfe7d0fe), W(0x0000ef99905494cc), W(0x0000f6c08aeb7640),
+     W(0x0000f357f34aec46)},
+    {W(0x000078e215141fce), W(0x0000d0bdd15004cc), W(0x00009ac7dc220529),
+     W(0x00003de0e1ce967f)},
+    0
+  },
+  {
+    {W(0x00008e8e8ed9e000), W(0x0000faae2426e4cb), W(0x0000eca175dbf6f0),
+     W(0x00003422c1f77116)},
+    {W(0x0000f19d5ae8ac17), W(0x0000b7613e892d8a), W(0x00007cfcf2dec680),
+     W(0x000094ed4befa25c)},
+    0
+  },
+  {
+    {W(0x00009fd515f129d3), W(0x000006ae2c167454), W(0x0000523d54a198f6),
+     W(0x0000510a85d1c29c)},
+    {W(0x0000809a0f79cdab), W(0x00005bd1b0ae70b0), W(0x0000c90a3b08ab96),
+     W(0x00006483dc949e9b)},
+    0
+  },
+  {
+    {W(0x00005a586e4cf9c0), W(0x00005236bfe05487), W(0x00008079229f93c0),
+     W(0x00000d22d1ee4664)},
+    {W(0x0000135118316092), W(0x00003593ff77de24), W(0x00007dba9917e5e3),
+     W(0x00002d8467a4eaa5)},
+    0
+  },
+  {
+    {W(0x0000957dcd012201), W(0x0000c8eef558441f), W(0x0000f7513fad6de9),
+     W(0x0000e66d6393d206)},
+    {W(0x00004f3e98df5aa4), W(0x0000fe623a2de1a9), W(0x00007a4637899750),
+     W(0x00009bb6d7eed490)},
+    0
+  },
+  {
+    {W(0x0000519b1b6c6840), W(0x0000f15ef480b9af), W(0x00004c08c735782d),
+     W(0x000094d6f7e3150c)},
+    {W(0x0000ed5cdcd53d01), W(0x00009f06adb2d5cd), W(0x0000e256d5ade700),
+     W(0x000041e3ef08ca43)},
+    0
+  },
+  {
+    {W(0x00005b3916454d8c), W(0x00001dcbe62c2f83), W(0x0000171f41db0cb0),
+     W(0x000046cd4ca2fe5c)},
+    {W(0x0000cac17f9b0d08), W(0x000036aa0fa1c4ce), W(0x00009724abaf4209),
+     W(0x0000fe21879277ed)},
+    0
+  },
+  {
+    {W(0x0000f5c1788563fc), W(0x00001e795ca63667), W(0x0000457be2c4dd47),
+     W(0x0000943f14497794)},
+    {W(0x0000a7161dd70035), W(0x000024e530dd8677), W(0x00007cc9f1e2940f),
+     W(0x0000d9103e949010)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000f439f8049d70), W(0x00007fcd617dadbe), W(0x00009f7ed259bca0),
+     W(0x0000115095a0bb4b)},
+    {W(0x0000a84fc37ec132), W(0x0000da2d243be809), W(0x0000e4403dcd955d),
+     W(0x0000c63bfece7b94)},
+    0
+  },
+  {
+    {W(0x00000ef702fba1bc), W(0x00005b4f5f8b5d68), W(0x0000194fa319aac7),
+     W(0x0000ba208f9c55b8)},
+    {W(0x0000fac9904f8006), W(0x0000cf299965d81e), W(0x0000939753f2d25b),
+     W(0x000057b5490eff2c)},
+    0
+  },
+  {
+    {W(0x0000b36cd8a81005), W(0x0000a6afa411555b), W(0x0000b027a0fa040c),
+     W(0x0000ce0ad4ca5ec7)},
+    {W(0x0000b66c3fffa73f), W(0x00002bb58f777491), W(0x0000ab63b6f05cd9),
+     W(0x00003e9df04fcf54)},
+    0
+  },
+  {
+    {W(0x00003f67a6777fa3), W(0x00004b65c2109aad), W(0x0000880ff911438a),
+     W(0x0000c1ab67999885)},
+    {W(0x0000f96ee55dfbe6), W(0x0000f6f924950a8a), W(0x00003afebc8a1557),
+     W(0x0000947abd1d497b)},
+    0
+  },
+  {
+    {W(0x00006b6ac800ae8e), W(0x0000f5f02f5471b5), W(0x00005049ffc81782),
+     W(0x00007eba76a24b7e)},
+    {W(0x00000f2fa91cc0cf), W(0x0000a370ca033f98), W(0x000068fd28af6ad4),
+     W(0x0000796e5db02855)},
+    0
+  },
+  {
+    {W(0x000059d5a106bffd), W(0x00007413b134b412), W(0x0000abb971e0c247),
+     W(0x0000927d1a462d24)},
+    {W(0x0000ab452b7da0bc), W(0x0000efef6306c4d6), W(0x00001b75e0c05e2a),
+     W(0x0000368b114c6f9d)},
+    0
+  },
+  {
+    {W(0x000043d206ff078c), W(0x00002b095b5e9b9c), W(0x0000b02568c0228e),
+     W(0x0000d7b43804a574)},
+    {W(0x0000550ec414b4c8), W(0x0000f0bae08229f0), W(0x000035a8fc74701c),
+     W(0x000056b2088426d2)},
+    0
+  },
+  {
+    {W(0x0000c1558d8eddcf), W(0x0000585965af5ca7), W(0x0000d17823f6d5f8),
+     W(0x00005a4a278f9158)},
+    {W(0x00001465e7081da5), W(0x00009ea0b535fa60), W(0x0000ec0ed03975b7),
+     W(0x00006d19ecde6702)},
+    0
+  },
+  {
+    {W(0x00003c70615b8baf), W(0x0000a7518a627244), W(0x0000c27f1a5e9f85),
+     W(0x00009fc13cb0de56)},
+    {W(0x00009db930dc3c62), W(0x0000f6f3b5d8c9d0), W(0x00006313f9305761),
+     W(0x00004bf10034a6ba)},
+    0
+  },
+  {
+    {W(0x000000ec79e48772), W(0x0000c296285e45c4), W(0x0000d7ba1372f65c),
+     W(0x0000a8ff837573d8)},
+    {W(0x0000775d633dfddd), W(0x00009858d5e42b1e), W(0x0000f315421fbcc5),
+     W(0x00000d1c8d48d5d9)},
+    0
+  },
+  {
+    {W(0x0000a515cfe8db02), W(0x0000ac62c81c9dd1), W(0x0000523d1e4afaf3),
+     W(0x000078543fde9876)},
+    {W(0x0000d3a13bac01d9), W(0x0000d3516a183adf), W(0x0000437482b460ef),
+     W(0x00002f7c15bd6384)},
+    0
+  },
+  {
+    {W(0x000086ac13dfe9f6), W(0x0000f9b3b5b39e52), W(0x0000641e95a47f83),
+     W(0x00008a9c952327ef)},
+    {W(0x0000360100b70adf), W(0x00006e7c98eee2cb), W(0x0000ccc957fb8b30),
+     W(0x000042d3a2f9a9ca)},
+    0
+  },
+  {
+    {W(0x0000dc289336d203), W(0x0000e5ccb14087e7), W(0x00009e85705bab72),
+     W(0x00008ee85dea38c1)},
+    {W(0x0000caf57d22a321), W(0x0000310b35c77404), W(0x0000de3c375445a7),
+     W(0x000033e1f17edf0f)},
+    0
+  },
+  {
+    {W(0x000080ec9b86d069), W(0x000039e5c28e758e), W(0x00006a4c56daf393),
+     W(0x0000b55390c491b0)},
+    {W(0x0000fcfcb14d390b), W(0x000068e8650fe5f2), W(0x000055b1a4c98d1a),
+     W(0x00007307812cb381)},
+    0
+  },
+  {
+    {W(0x00002c512ba81391), W(0x000012f0e5c33f5c), W(0x0000dffec4b1456f),
+     W(0x00000af7266f14a7)},
+    {W(0x0000d8bac6325ed7), W(0x00003820796bccd4), W(0x0000b2af6915b750),
+     W(0x00004de3d8e3ceaa)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000098509d36c05b), W(0x000072ac06d71431), W(0x00008df93c2072c0),
+     W(0x00008f55220b94ab)},
+    {W(0x0000bafda6977ddc), W(0x0000bb93ca1099f2), W(0x000048f2719d3aa1),
+     W(0x00000b3813b564a6)},
+    0
+  },
+  {
+    {W(0x00005c4e62ecdb81), W(0x0000fa3cdb820f68), W(0x00007613842b7059),
+     W(0x0000a301e58f619c)},
+    {W(0x0000e6b8432b8b11), W(0x00001bb29db89cd5), W(0x0000554e003ed0ca),
+     W(0x00002e8fb6a0468a)},
+    0
+  },
+  {
+    {W(0x000037a8b9d22c6a), W(0x0000f92bd5c28739), W(0x0000f77e1dfdd35d),
+     W(0x000038ade2a930e8)},
+    {W(0x000087a80ac642ed), W(0x00008793d64fccab), W(0x0000e0f7b549acb6),
+     W(0x0000002d3c30cc32)},
+    0
+  },
+  {
+    {W(0x00003e60bdbd1c0d), W(0x00009b7f25c9de6d), W(0x00001ff510aafc50),
+     W(0x0000f2fde7431079)},
+    {W(0x0000c2a32591ee41), W(0x00000366ccb29739), W(0x0000578316dc4592),
+     W(0x00005f5096e62033)},
+    0
+  },
+  {
+    {W(0x0000d2afcad52787), W(0x0000126483175dd0), W(0x000005955a678e09),
+     W(0x0000b37d09efbacf)},
+    {W(0x00003e1945f61086), W(0x0000c9f52380756b), W(0x0000b84c9e3b4d9f),
+     W(0x00005662b6e702fe)},
+    0
+  },
+  {
+    {W(0x000093dec56a7405), W(0x0000a08d5c3be3b7), W(0x000032b10512be58),
+     W(0x0000fcddc1beb8c4)},
+    {W(0x00006213e4e2083e), W(0x00008d5f97f69dc3), W(0x0000fd3471dc1423),
+     W(0x0000280faff5e2c6)},
+    0
+  },
+  {
+    {W(0x0000d6056bb2f252), W(0x000096f91b07fba3), W(0x0000300b4ff952d3),
+     W(0x0000c6dd4bafe3ac)},
+    {W(0x0000207374b1ed75), W(0x0000c77afb3640d1), W(0x0000fcf13cca6077),
+     W(0x00003a4bb8761b54)},
+    0
+  },
+  {
+    {W(0x0000f71ecdbdc149), W(0x0000c23ff89fe1fb), W(0x00009012c80b7c16),
+     W(0x000050e9ad8e8075)},
+    {W(0x0000b2b5b2ed7f6f), W(0x00004fa79185ca29), W(0x000070a42a60bdb9),
+     W(0x000089860cb4fa54)},
+    0
+  },
+  {
+    {W(0x000072d6f741a3bb), W(0x0000a7e630c11221), W(0x0000338c2bef2bfa),
+     W(0x00003677cb91a3ee)},
+    {W(0x0000681dbaad9aaf), W(0x000026b05fcfbd84), W(0x000074573a1a85e9),
+     W(0x0000f6082efd92bd)},
+    0
+  },
+  {
+    {W(0x00008641fe1eac09), W(0x0000966581a40b21), W(0x00007a601aee76b2),
+     W(0x00004a677e240ef5)},
+    {W(0x000015bb35e4da7d), W(0x000088fc709731bf), W(0x00001b875787e973),
+     W(0x000028da8dbf3fa6)},
+    0
+  },
+  {
+    {W(0x000011b59b56ca15), W(0x00002793caf4d2a4), W(0x00006481bc3a080e),
+     W(0x00007be27b2a996b)},
+    {W(0x00006f371e9da5ae), W(0x0000ec925414c1de), W(0x0000e96a031b0a59),
+     W(0x000065b03cc06f11)},
+    0
+  },
+  {
+    {W(0x0000d0222a0d36e1), W(0x00004822ac920d6b), W(0x00002ceeffd7f5cb),
+     W(0x000021a3d13dca2f)},
+    {W(0x00005baa451961ac), W(0x00001f2fde1e9ea6), W(0x000094ceba7023d8),
+     W(0x0000e7f669560a2b)},
+    0
+  },
+  {
+    {W(0x000054dbee0d3c9d), W(0x00009c35bb822897), W(0x000025fb15690cc3),
+     W(0x0000ba5eedee020c)},
+    {W(0x0000083121b89a4c), W(0x000057c81d3a03ae), W(0x00003817f709167a),
+     W(0x0000978b6b726d97)},
+    0
+  },
+  {
+    {W(0x000087d91e422bf9), W(0x0000b7389c4e890e), W(0x0000f847ee1bc0ac),
+     W(0x00005194fa41835c)},
+    {W(0x0000bb0b534ef0e4), W(0x0000f3a3ae7f509f), W(0x0000d258b157aa7f),
+     W(0x000094357ed86509)},
+    0
+  },
+  {
+    {W(0x0000d365383eab35), W(0x0000ae4d0919c558), W(0x00008355b3c7f95d),
+     W(0x0000d176a8612774)},
+    {W(0x00003c06e2e53d57), W(0x000070aec5050712), W(0x0000737e1e156042),
+     W(0x0000dff340707a56)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000094bfd8e6f7f7), W(0x00002d4d87c23332), W(0x0000b3a58d572c7c),
+     W(0x0000044a87d6e9fa)},
+    {W(0x0000bd16ca6efaa2), W(0x0000fc02933ef163), W(0x0000f29301d5af79),
+     W(0x0000e7183dee3fc6)},
+    0
+  },
+  {
+    {W(0x000066b324efffef), W(0x0000a501d1f36bf2), W(0x0000265f3e3f4ecf),
+     W(0x00003ad45bddac9c)},
+    {W(0x000008f436492211), W(0x0000ddeda6ee450f), W(0x000031ded52de291),
+     W(0x00001c867c6fc029)},
+    0
+  },
+  {
+    {W(0x0000b710262da536), W(0x0000d5aee83f7a74), W(0x0000f047f6cbd191),
+     W(0x000072bc792ca1e7)},
+    {W(0x0000c0ac6a762f86), W(0x00008e6dcccdab67), W(0x0000e9e2e0947ae8),
+     W(0x0000b382ff752709)},
+    0
+  },
+  {
+    {W(0x00006ea8c55e14cd), W(0x0000cc8deb425675), W(0x0000e2cf9919b05f),
+     W(0x0000028e539b4ad4)},
+    {W(0x00008a69ccea5098), W(0x0000d57a0e0997a6), W(0x000094a0d76d10f1),
+     W(0x0000df3c910afd70)},
+    0
+  },
+  {
+    {W(0x0000e2409233517c), W(0x000019a5c832bcc0), W(0x0000576993fe2202),
+     W(0x0000c70368c7b678)},
+    {W(0x00002f7fea1cc902), W(0x0000141859bd8396), W(0x000006e286cd12df),
+     W(0x0000c001cde3ffd3)},
+    0
+  },
+  {
+    {W(0x000034302e1fbd63), W(0x0000f506683901f7), W(0x00007525a08d9cfa),
+     W(0x00000262e01553a6)},
+    {W(0x0000a70958a65dc5), W(0x00008dd2af4d91fd), W(0x0000c04f186fa141),
+     W(0x0000fec6b7564a11)},
+    0
+  },
+  {
+    {W(0x0000ddc9529a4162), W(0x000080c30962f331), W(0x0000911478e7acbd),
+     W(0x00009cf92578c795)},
+    {W(0x0000fb635e3cfdf0), W(0x0000ccce0a9e2b75), W(0x0000348e90dd295c),
+     W(0x0000cd3d5caec166)},
+    0
+  },
+  {
+    {W(0x0000da57cd7ca7be), W(0x0000781b7b3a2bb6), W(0x0000dabd431b6902),
+     W(0x0000abbdf27deb2a)},
+    {W(0x0000316d7d55c5d1), W(0x0000733ff9bab7ba), W(0x0000eaeb746e9bc7),
+     W(0x00000afccf52d95a)},
+    0
+  },
+  {
+    {W(0x0000744d60eb0509), W(0x0000e40835848392), W(0x0000c51fa7297a56),
+     W(0x0000d92a2038a04f)},
+    {W(0x0000ca9dd40ae3a9), W(0x0000bef44921b77c), W(0x0000d009202e1e53),
+     W(0x00003426ca138f4a)},
+    0
+  },
+  {
+    {W(0x000037aa6da12542), W(0x000096a9b49a72aa), W(0x000046dd0be5a5a1),
+     W(0x0000a8b786ac5671)},
+    {W(0x0000adda44d67a82), W(0x0000c1fdf5fea9e8), W(0x0000b3e071ef1ce7),
+     W(0x000071f6070ff91e)},
+    0
+  },
+  {
+    {W(0x0000ed61dcfa5954), W(0x00000040c54fcf6f), W(0x0000482aa96925d7),
+     W(0x0000679b3df3786a)},
+    {W(0x0000dbcd936fbc50), W(0x00003f0f54db4cbc), W(0x0000a4a5aae77aac),
+     W(0x0000a319e6c8c9b4)},
+    0
+  },
+  {
+    {W(0x0000167685d8d32c), W(0x0000a9c8a1ef1e5d), W(0x00007fd9f4142a37),
+     W(0x000076b41b4b3cd2)},
+    {W(0x00005292c8321421), W(0x00006e9acb54a18b), W(0x0000c8bf265a6d73),
+     W(0x00005ffff71c4287)},
+    0
+  },
+  {
+    {W(0x00000aa1919f6faa), W(0x000032dab2b6ad6c), W(0x0000ca4ce2645717),
+     W(0x0000af9bc4ef9879)},
+    {W(0x00003c621df217d8), W(0x00008be8515a6464), W(0x000032f8394713ac),
+     W(0x0000dd11c2f0c185)},
+    0
+  },
+  {
+    {W(0x00002ac6801ab2dd), W(0x0000095ccbac126d), W(0x0000dd89106ea01c),
+     W(0x0000aa0d50929a63)},
+    {W(0x00005341809bb3bf), W(0x00002ed0fa2cb893), W(0x0000a59cc5a33568),
+     W(0x0000acac11655987)},
+    0
+  },
+  {
+    {W(0x000000a2ebed6ce4), W(0x00005a672c9dfc73), W(0x00006c93fae818ee),
+     W(0x0000158230effb01)},
+    {W(0x000098d01ae005f2), W(0x00003af88450759f), W(0x0000dd97407d3fd5),
+     W(0x0000045e1dae8cb1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000ac9f6470ab57), W(0x0000db4bc046ab8e), W(0x0000805f575da7c2),
+     W(0x00001cd4eca7c3bf)},
+    {W(0x0000b64177b7090d), W(0x0000ab2d8df19473), W(0x0000ebdb033af8cb),
+     W(0x00006b21afa068b3)},
+    0
+  },
+  {
+    {W(0x000063c743c0c3b7), W(0x00003ef1d5db0ee3), W(0x0000fa3f78d03db4),
+     W(0x000050f0882201c3)},
+    {W(0x00005f2ccabb4895), W(0x000045651680edd0), W(0x000056456ddf7fab),
+     W(0x000082e4b336703f)},
+    0
+  },
+  {
+    {W(0x00005a2696719e76), W(0x0000a9bf40b8bf8f), W(0x000029f6ce8a9985),
+     W(0x0000c85eaea6d44d)},
+    {W(0x0000bf6e01ece786), W(0x00003cac6af80b2e), W(0x00008981999d05f2),
+     W(0x0000361e52310669)},
+    0
+  },
+  {
+    {W(0x00004a187996bf80), W(0x00004362c82b854e), W(0x0000ef5b987aa877),
+     W(0x000087923b857d45)},
+    {W(0x00007c5dc51af18f), W(0x0000cf05ccd94d8c), W(0x0000ec1f4bc4a696),
+     W(0x000050831b247760)},
+    0
+  },
+  {
+    {W(0x00007e3b913a9b2b), W(0x00006857a24147d2), W(0x0000c476630bd455),
+     W(0x000070b62cfeff03)},
+    {W(0x0000f5ffd1d89de4), W(0x0000a7d0f2ac9139), W(0x0000b979bf6372da),
+     W(0x00005da423dd6123)},
+    0
+  },
+  {
+    {W(0x0000835a99d871fc), W(0x00009d95ca7ee1f3), W(0x000062317907b8f2),
+     W(0x0000c7ce199488b6)},
+    {W(0x0000e4b475ca07fa), W(0x00001c593a1047ef), W(0x0000050b809567f2),
+     W(0x0000fa1e726f2e3d)},
+    0
+  },
+  {
+    {W(0x000002bfbbfc60a0), W(0x0000b4d60b15e90a), W(0x00009f15cbc0c714),
+     W(0x0000b4d6e83956a2)},
+    {W(0x0000a210639927fb), W(0x00009bc37d45d14b), W(0x00006a25cecacd45),
+     W(0x0000a74a334d688a)},
+    0
+  },
+  {
+    {W(0x0000b855047b2664), W(0x0000f4d79286cfb0), W(0x0000bf9840bf20ae),
+     W(0x0000a3ea96e2d605)},
+    {W(0x00009cc39c906678), W(0x0000d87accf59d7d), W(0x0000c3a388693fa4),
+     W(0x00008a64163cbac5)},
+    0
+  },
+  {
+    {W(0x0000a95e445278e0), W(0x0000f42577dcc4ce), W(0x0000a34b03f0b806),
+     W(0x0000ec904aa16b4a)},
+    {W(0x0000409c996c2c6b), W(0x0000c32ca33f452a), W(0x0000218f20fe98e5),
+     W(0x000078b277bc3166)},
+    0
+  },
+  {
+    {W(0x00000e8cb2ff34dd), W(0x0000b872b2c01085), W(0x0000f70f6d941290),
+     W(0x0000d493ce02fa7c)},
+    {W(0x00007731faed42c4), W(0x0000b28d126af2f8), W(0x000047bca5450310),
+     W(0x000098842cfb9ed6)},
+    0
+  },
+  {
+    {W(0x000007c273f0f76b), W(0x0000c415d8c84474), W(0x00008efe3c443501),
+     W(0x0000bd1f4602c78c)},
+    {W(0x00005ea73cac164d), W(0x000014e17c37a8eb), W(0x0000840f8b61a821),
+     W(0x0000a0e8e98274f3)},
+    0
+  },
+  {
+    {W(0x0000bdd9882ac7bf), W(0x0000da9d62196850), W(0x00007d6cadae2ee5),
+     W(0x00002a852c63be93)},
+    {W(0x0000c46d7f138123), W(0x0000cddfb1b3bf98), W(0x000005681125e2a8),
+     W(0x000053418f4513b1)},
+    0
+  },
+  {
+    {W(0x00001857fd63513f), W(0x00009cddc0287d36), W(0x000081ab78d07f09),
+     W(0x00001e079d4da1e8)},
+    {W(0x0000b5a7b1b84e73), W(0x0000db923c3d7a7b), W(0x00007ab31931d514),
+     W(0x0000154ec40de6e4)},
+    0
+  },
+  {
+    {W(0x0000b23067d62687), W(0x0000a2bd72896e90), W(0x000061567c483f3d),
+     W(0x0000c25090958970)},
+    {W(0x000065867ef58857), W(0x00006dff8ea0eafb), W(0x0000fd1de5633cb5),
+     W(0x0000f747007bdcde)},
+    0
+  },
+  {
+    {W(0x00005de1ff65df9c), W(0x0000545c180c9c5b), W(0x0000a6b2aba781ce),
+     W(0x000026739d965f8e)},
+    {W(0x0000f7f985b16ecb), W(0x000050f06c7c82f5), W(0x0000eba8371c18cc),
+     W(0x00000b22b5004ce0)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00009f70b325c960), W(0x00009b56331e4c80), W(0x0000469f5f66e407),
+     W(0x00006bf88b97ac45)},
+    {W(0x000090aa5cb03cf8), W(0x0000327c62243c17), W(0x00006193aa7f2ae9),
+     W(0x000083d52c5dd614)},
+    0
+  },
+  {
+    {W(0x000015643518e143), W(0x00007d7ba6cb3303), W(0x0000f11fcd2a4a44),
+     W(0x000009daa2048fbc)},
+    {W(0x00009d8c0c40eca7), W(0x0000e5f15c378673), W(0x0000ce46fafb5774),
+     W(0x000087a037689050)},
+    0
+  },
+  {
+    {W(0x0000b34cc32cdde9), W(0x0000449c65c9c38f), W(0x0000442280b38c36),
+     W(0x000082c73728f8e7)},
+    {W(0x000086d3cf0d491d), W(0x0000a19e1bb51d99), W(0x00001b7cb17c0582),
+     W(0x0000db585940dbb4)},
+    0
+  },
+  {
+    {W(0x0000f054a442dcbc), W(0x00001ec105b5edd9), W(0x00002d7ac9c61aec),
+     W(0x0000c113fc92dc9c)},
+    {W(0x0000c44d08e1786f), W(0x00009c0018c77404), W(0x0000ee2af08d0922),
+     W(0x00003121a1bf8211)},
+    0
+  },
+  {
+    {W(0x0000679da6fc802f), W(0x000026864fb43763), W(0x0000864aedec42a1),
+     W(0x0000ab62f0a318e3)},
+    {W(0x00000135fd0541ff), W(0x0000b3b8eb9249f3), W(0x00001025e8ea0c26),
+     W(0x0000fea253d6b686)},
+    0
+  },
+  {
+    {W(0x0000820b4df24b8d), W(0x000006cc665f6d13), W(0x000089f4f703afe2),
+     W(0x0000578c3ba4d215)},
+    {W(0x0000f2a22b587b55), W(0x0000c62ca58e8048), W(0x000015aaac2272d1),
+     W(0x0000ad315c0fb40f)},
+    0
+  },
+  {
+    {W(0x0000aebd14cdf574), W(0x000048d23e658cb0), W(0x0000bc4bc8984e2b),
+     W(0x0000f6af0a533fc7)},
+    {W(0x0000ea07bf6993fd), W(0x0000ade68d477487), W(0x0000a185308c84a7),
+     W(0x0000e8b57665c2c6)},
+    0
+  },
+  {
+    {W(0x000064a674c1064c), W(0x00005b1e7b576b6b), W(0x000017569f821ded),
+     W(0x0000f00b2d82b916)},
+    {W(0x0000e148ff9713b6), W(0x00000a198642f090), W(0x0000ac88c3e09477),
+     W(0x0000b76504ce9712)},
+    0
+  },
+  {
+    {W(0x000082ee59f7259b), W(0x0000c580d6d46c2f), W(0x000051f47fc263d1),
+     W(0x000032c0dfe4a994)},
+    {W(0x0000727f3c5c91ff), W(0x00003136eda40850), W(0x000026134a34020d),
+     W(0x0000f296627e4c24)},
+    0
+  },
+  {
+    {W(0x00008d3f67cdcd2e), W(0x0000566de06b8bc7), W(0x0000095fbbdf3374),
+     W(0x00004219c430d1dd)},
+    {W(0x00006fb6eaf14f4a), W(0x00000b453c9d78dd), W(0x000076fda0735290),
+     W(0x0000e1a0480f034d)},
+    0
+  },
+  {
+    {W(0x0000dde07203c866), W(0x0000e830717ee574), W(0x00009f3a4663311c),
+     W(0x00004fd3fbf2a354)},
+    {W(0x0000543d2dd57cfb), W(0x000049e1352ab3ac), W(0x000052edeb6965fe),
+     W(0x000095b0e9581e43)},
+    0
+  },
+  {
+    {W(0x00000d6ef17dca54), W(0x000077235fc55634), W(0x0000ba35461281db),
+     W(0x000072321243fc0a)},
+    {W(0x0000ecaa76889f83), W(0x00009984d90fe8d1), W(0x0000ef9fe324044b),
+     W(0x00003cd4dbf87768)},
+    0
+  },
+  {
+    {W(0x000075f9d8960434), W(0x0000f3e19d18807c), W(0x0000f4666aa529b8),
+     W(0x0000e4c6a543aa99)},
+    {W(0x00006180e441eec4), W(0x0000f4529f522883), W(0x00004f8bf889c360),
+     W(0x00008f635174ec99)},
+    0
+  },
+  {
+    {W(0x0000a1730c5baa8a), W(0x0000d665826578b4), W(0x0000c9e00dca1891),
+     W(0x000048c2d7a7767b)},
+    {W(0x0000cc29f04552fe), W(0x00007a46b2c4c54c), W(0x0000e94b36b432bc),
+     W(0x00007f5c44090db5)},
+    0
+  },
+  {
+    {W(0x00008ca6a83cec88), W(0x0000348ca876ebe5), W(0x0000ad86243cf30c),
+     W(0x0000580cd66fe6be)},
+    {W(0x000095b338e6cff4), W(0x0000de839d3393ce), W(0x0000cf0aee16d2d4),
+     W(0x00001dcc39cacc77)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000066990dd81268), W(0x0000a1a0d1ce7205), W(0x00005379f7a98167),
+     W(0x00008eb0322c4216)},
+    {W(0x000057dd7aa1c0a5), W(0x0000b830d8d3b58f), W(0x0000cca60b7e8cc2),
+     W(0x000089f9b030eecc)},
+    0
+  },
+  {
+    {W(0x000095fb5413f880), W(0x000097144f9358fc), W(0x000023374e0de738),
+     W(0x00007b81262d58df)},
+    {W(0x0000dafe9f27ff03), W(0x0000aefbdc886aca), W(0x0000ec704e5a9f66),
+     W(0x0000084cba254e51)},
+    0
+  },
+  {
+    {W(0x0000ae14b4a07a8d), W(0x000048d73c3bd509), W(0x0000df16c7ecee08),
+     W(0x0000845adb5eac7d)},
+    {W(0x0000c08f3d6d9ff9), W(0x00007b4c5ab079e3), W(0x000003d98ea9b8be),
+     W(0x0000882e9313fc05)},
+    0
+  },
+  {
+    {W(0x00007cb8aa28bb84), W(0x0000109240a9459d), W(0x000052128396bcbb),
+     W(0x000016979175eacb)},
+    {W(0x00002557c29a6d06), W(0x0000a62b80794636), W(0x0000adb7ce3bef86),
+     W(0x00009387bec9818d)},
+    0
+  },
+  {
+    {W(0x000056978f9ac470), W(0x00004313d3ff96ef), W(0x0000ac39519a5cfa),
+     W(0x00008b558bc1630f)},
+    {W(0x00004f00daa026ac), W(0x000040d1c1cf79ef), W(0x000070f7278b749c),
+     W(0x0000c091cc6d09d4)},
+    0
+  },
+  {
+    {W(0x0000c74ac976f5ac), W(0x00001aace4c02707), W(0x00003e186b87a210),
+     W(0x000022817bdcb82e)},
+    {W(0x0000d34efbd7f039), W(0x00000f112bebe39a), W(0x0000a1e29398feda),
+     W(0x0000006db07c253a)},
+    0
+  },
+  {
+    {W(0x0000a97cb2a90c95), W(0x0000a2720ddac2bd), W(0x000005af42030928),
+     W(0x0000ee0a3068acb2)},
+    {W(0x0000695330066ed9), W(0x00002e7d7ff9ef4a), W(0x0000f78e6a7e4e07),
+     W(0x0000c25941ccb5e4)},
+    0
+  },
+  {
+    {W(0x0000c081e5536e4f), W(0x0000e7b48ff1edf4), W(0x0000e9b8ad54b251),
+     W(0x00007dc4774cbcf3)},
+    {W(0x00007b539cd12f25), W(0x000041f35acaedd9), W(0x00005e5f8eb0c7cc),
+     W(0x0000e2b23d5f6614)},
+    0
+  },
+  {
+    {W(0x000062b444fe56a8), W(0x0000c4e34df7dce9), W(0x000071b17aa120ce),
+     W(0x000056fa9903ac3b)},
+    {W(0x000013f579c3e6b9), W(0x00007b91e59f8d92), W(0x0000883ea41504b5),
+     W(0x0000775919f73191)},
+    0
+  },
+  {
+    {W(0x00005f4274562dd2), W(0x0000d151efd3fe9a), W(0x000036500a7bacd5),
+     W(0x000047467211fe5d)},
+    {W(0x00006f8d56a2b3ca), W(0x00003285130332e0), W(0x000068abbf10dd52),
+     W(0x0000f5ef3576980a)},
+    0
+  },
+  {
+    {W(0x0000de6266a71d00), W(0x0000318de830476f), W(0x00001882368e7759),
+     W(0x0000f757d88fa7e4)},
+    {W(0x0000b3036348c381), W(0x0000990b1e928938), W(0x0000a403cf2ed262),
+     W(0x000006fd2d2f042d)},
+    0
+  },
+  {
+    {W(0x00003d8cdf3040ce), W(0x00008991cb0be64c), W(0x000099b7680de2a1),
+     W(0x0000db774fef41b7)},
+    {W(0x000059c5cc2f177a), W(0x000082b8f6692a21), W(0x0000efc97ddd1feb),
+     W(0x0000eb5b3062895d)},
+    0
+  },
+  {
+    {W(0x0000d48e4c8faea2), W(0x000076b3e4b41ea7), W(0x000000f9da23a789),
+     W(0x000056a9fcf2e3ab)},
+    {W(0x000016d692d81103), W(0x0000ebbe1785125c), W(0x0000c9645e43911d),
+     W(0x00004a90a7c03816)},
+    0
+  },
+  {
+    {W(0x00009da366030374), W(0x0000b3a93663d967), W(0x0000ecfe6857b144),
+     W(0x00000a59d729efb8)},
+    {W(0x0000ba764de473f0), W(0x0000a5775b858d34), W(0x0000be34420f3a57),
+     W(0x00006cca7a35eac8)},
+    0
+  },
+  {
+    {W(0x000028a4a1f27213), W(0x00008465cd5980c2), W(0x0000bdd32a0067b1),
+     W(0x00000ad0f5584959)},
+    {W(0x00002bcca77cbde8), W(0x0000365af2e30a49), W(0x0000403efcf50c7c),
+     W(0x00002b0689f0a8a1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000007ffcbdf060c), W(0x00006541f6f415b0), W(0x0000d3c63b20e563),
+     W(0x0000920f9a3c0c56)},
+    {W(0x000077d00d0028d3), W(0x00005192d915dd7b), W(0x0000b3b6cee00dda),
+     W(0x0000cd7902f781f6)},
+    0
+  },
+  {
+    {W(0x000019a2bb1c44f1), W(0x000040d93a1fec14), W(0x0000d5757cbcf8fc),
+     W(0x000055ffa4ffa4ec)},
+    {W(0x00000caea01a33eb), W(0x00008c061d7e3aae), W(0x00001f4d747db3b0),
+     W(0x00003ff34d269ccc)},
+    0
+  },
+  {
+    {W(0x0000a90d5512e749), W(0x0000353b9ac45f31), W(0x0000828165fbeea5),
+     W(0x000057653a6cd3c5)},
+    {W(0x000033f4cbdc56d8), W(0x00007d6b32d75b46), W(0x00008c5d82fc537e),
+     W(0x0000e70d7e8e6871)},
+    0
+  },
+  {
+    {W(0x000026a5aa7c2b03), W(0x00008ea240f4cc2d), W(0x0000f673a5efdb59),
+     W(0x0000f8e73bf3f447)},
+    {W(0x00004b22f885ffbc), W(0x00002fc3f64926e6), W(0x0000394679cf938f),
+     W(0x0000d20b40c8a51a)},
+    0
+  },
+  {
+    {W(0x00005fba7679f804), W(0x00001bba53b79f6e), W(0x00003359df757386),
+     W(0x0000ad72c18614b5)},
+    {W(0x0000c527436ce813), W(0x00005100e46b6321), W(0x00005f4a3f5e2c72),
+     W(0x00002157c9dec9e5)},
+    0
+  },
+  {
+    {W(0x0000bcc520eab710), W(0x00002df5cfa5dfe3), W(0x0000d31e384c4b7e),
+     W(0x00002c4790e45b0f)},
+    {W(0x0000d97fb74009aa), W(0x00003aea8876ce47), W(0x0000bea2f9324e77),
+     W(0x0000a96c19e19edf)},
+    0
+  },
+  {
+    {W(0x00008ec0b515e105), W(0x0000f4f21b931098), W(0x0000bd5748c29b73),
+     W(0x0000c0dd25a0651b)},
+    {W(0x00006bf3392d0daf), W(0x00008967bf7c707a), W(0x00001598376e8c32),
+     W(0x00007cf3e74e67d4)},
+    0
+  },
+  {
+    {W(0x000017a5d99de2d0), W(0x0000dd7a674e6e00), W(0x00006e3d37f0346f),
+     W(0x0000e840ee697f35)},
+    {W(0x0000cd2717048b3b), W(0x00009b281b88f122), W(0x0000bd66e2653567),
+     W(0x00000678bfb8b5b3)},
+    0
+  },
+  {
+    {W(0x00001386e3135544), W(0x0000ac719f770df0), W(0x000067ecbc49153e),
+     W(0x00007e9653b2963b)},
+    {W(0x000012f9b0f73354), W(0x000087c52ca2398a), W(0x0000e587656ce71b),
+     W(0x0000cdc3a99febb8)},
+    0
+  },
+  {
+    {W(0x000072c02efe4cec), W(0x0000192645c46df8), W(0x00007d0844f3dbb3),
+     W(0x0000d1cf44ae8349)},
+    {W(0x000057e5db6b4462), W(0x00001752f46b21ca), W(0x000096db46e76f9d),
+     W(0x0000a271cfac0508)},
+    0
+  },
+  {
+    {W(0x000044d80a297e8e), W(0x00005c97113da502), W(0x00005c55836e4891),
+     W(0x0000ca63f3a0d2d5)},
+    {W(0x000082bcc9e3a394), W(0x0000449e92fe9a1b), W(0x00003a23aba9c6d0),
+     W(0x0000a14819238cdd)},
+    0
+  },
+  {
+    {W(0x0000c95f0b2fcbf3), W(0x0000227ed478d46d), W(0x0000f010356d55e5),
+     W(0x0000f3993fc38b5f)},
+    {W(0x000034326f0ee810), W(0x0000f2523d769dfb), W(0x0000163d43d5b0e4),
+     W(0x0000f9b7e4bdb090)},
+    0
+  },
+  {
+    {W(0x0000c17dff5e71cf), W(0x0000e84d0ddd2392), W(0x0000b8f97a2f14e9),
+     W(0x00008e2a006ce7f1)},
+    {W(0x0000b6f0c832c77e), W(0x0000db943ac58868), W(0x00002f284fe757a3),
+     W(0x0000497a3bf48ce0)},
+    0
+  },
+  {
+    {W(0x0000965d474747da), W(0x000054add85c2c6c), W(0x00008c13b9d3574d),
+     W(0x000030655c30fd14)},
+    {W(0x0000e44df86d62e3), W(0x0000947536c2c5e7), W(0x0000cbf995972c2c),
+     W(0x0000ef474f059f22)},
+    0
+  },
+  {
+    {W(0x00005ade40b2ef02), W(0x0000626df665b648), W(0x00002111e4333751),
+     W(0x00003cd3f155777c)},
+    {W(0x0000749912819188), W(0x0000ef236721bd61), W(0x00003e55e24b91f6),
+     W(0x000030b05df07ee3)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x00004469d5d13bb1), W(0x00004bc45596793d), W(0x000078ee88ebc216),
+     W(0x00009a77925cfa9c)},
+    {W(0x00006812236e3720), W(0x000021ce9fae073b), W(0x0000237d0dde6d5f),
+     W(0x0000c450746d4d7a)},
+    0
+  },
+  {
+    {W(0x00000779aeedfecc), W(0x0000707ee92e024b), W(0x000085779459da1f),
+     W(0x0000ef80170af5a8)},
+    {W(0x0000aee6ecfe2150), W(0x0000cb82fcb004a6), W(0x000089576eeb2ad2),
+     W(0x0000ccb1d4eb4e2a)},
+    0
+  },
+  {
+    {W(0x0000911af2c79390), W(0x0000e0ea2a9e7dbd), W(0x000007bdb32e0cb5),
+     W(0x0000a291ac2526bb)},
+    {W(0x0000644e5e83a3f7), W(0x0000c8ab5a606a0d), W(0x00005be7e0e9f99e),
+     W(0x0000ca8f2eb71db9)},
+    0
+  },
+  {
+    {W(0x0000b582a153d1f5), W(0x00006c22be731c9c), W(0x00000a22b18ea808),
+     W(0x00005fde76f173dc)},
+    {W(0x00005ce1f76f9967), W(0x0000f6c2e3823041), W(0x00006e17692507ff),
+     W(0x000014473502a734)},
+    0
+  },
+  {
+    {W(0x00008dfef90f12c8), W(0x00006f790cb281e8), W(0x0000e52557ffb0a8),
+     W(0x0000744e9b66c57b)},
+    {W(0x000021ee57526311), W(0x0000bfa2bdfdc79c), W(0x0000d9d38141c7a6),
+     W(0x000050be5eebe129)},
+    0
+  },
+  {
+    {W(0x000038b2d4988e7c), W(0x0000d79bd578877b), W(0x0000b715ab4a8dd1),
+     W(0x0000cea169ff9071)},
+    {W(0x000072684082122d), W(0x000063f3c96c5c40), W(0x00009bfca8777fe1),
+     W(0x0000d78ce9a18194)},
+    0
+  },
+  {
+    {W(0x00002de570783da2), W(0x0000385cba702262), W(0x00009ea636746843),
+     W(0x000090a2e35c7872)},
+    {W(0x0000f00605bf1fbb), W(0x00006a8c8f51ca9a), W(0x000049bf631d7eca),
+     W(0x00000240012a7658)},
+    0
+  },
+  {
+    {W(0x000025ca8d2be095), W(0x000041ea4c3ac742), W(0x0000ae222aa054c1),
+     W(0x00001e64ba2d0e51)},
+    {W(0x00000077b0a89cb1), W(0x00008f2344ecae44), W(0x0000c4e3fa168187),
+     W(0x0000f4fe23fa988e)},
+    0
+  },
+  {
+    {W(0x00003b4627c407b8), W(0x00006cb27ee61287), W(0x00009f1d13e4b793),
+     W(0x00000426b22b7453)},
+    {W(0x0000af30aa33b53d), W(0x00000fcd32b653aa), W(0x0000ca814b925bb9),
+     W(0x0000599439ac2be7)},
+    0
+  },
+  {
+    {W(0x00000aea3507b278), W(0x0000fa2dcd27b3c0), W(0x0000bf553156b88c),
+     W(0x0000c4de3052e162)},
+    {W(0x0000bb3b388d5406), W(0x0000fcb897c9ea43), W(0x0000824c2be70437),
+     W(0x00001931fb614905)},
+    0
+  },
+  {
+    {W(0x0000a5e2e179ea91), W(0x000070468320e016), W(0x0000a030f81ddc83),
+     W(0x000037cb0f04e4c2)},
+    {W(0x0000f4ec3f49dfed), W(0x000021c0131f3c5b), W(0x00008ae868a7ed54),
+     W(0x00004f165f1f9165)},
+    0
+  },
+  {
+    {W(0x00009e09253e1635), W(0x0000f98f47a667b8), W(0x000031c3612a855e),
+     W(0x0000870498c909bf)},
+    {W(0x00001a726aea823a), W(0x000000104a87f85a), W(0x00000fefcc68dc5b),
+     W(0x0000da01e80785fe)},
+    0
+  },
+  {
+    {W(0x0000870ef242b09a), W(0x00002956855566f4), W(0x0000186b1c07bb72),
+     W(0x000045627a554107)},
+    {W(0x0000c3ef571af5f3), W(0x0000f0a41bd3cdb4), W(0x00008b9adc8bcb95),
+     W(0x00002e19a4a611b7)},
+    0
+  },
+  {
+    {W(0x0000ca90c833fdba), W(0x0000b756515af172), W(0x0000c73c6df2fe87),
+     W(0x0000ff78077861b5)},
+    {W(0x0000ec00654163b2), W(0x0000f82a3cc004ce), W(0x000030606cf6c24a),
+     W(0x0000715cf59e8a22)},
+    0
+  },
+  {
+    {W(0x000067f3d03268b6), W(0x000070ce8c2f9ed8), W(0x0000035240fc06b7),
+     W(0x000032ff6b6090db)},
+    {W(0x0000446f868711e2), W(0x000033cafecdc74b), W(0x0000558402ec1ea4),
+     W(0x0000aab338f421df)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x000083f2ddf64a97), W(0x0000b7bef219b17b), W(0x0000df7b620ffeed),
+     W(0x0000eb7c10329b58)},
+    {W(0x00008c4e2989f0b5), W(0x00003b5ed8620d8e), W(0x0000e4b667dece59),
+     W(0x0000fff6bcd5cce6)},
+    0
+  },
+  {
+    {W(0x0000aac2f1b43c83), W(0x0000c250b3ebc2fd), W(0x00000edcef4caa1a),
+     W(0x0000a27e0f76a7ef)},
+    {W(0x00007b09cd6fcc1a), W(0x0000058537ed59c9), W(0x0000a566edfdb9d5),
+     W(0x000053722fafd023)},
+    0
+  },
+  {
+    {W(0x0000d358ea05b108), W(0x0000de58fddc99d7), W(0x0000f3cf25fa0dd0),
+     W(0x00006a0903af6af0)},
+    {W(0x00004fa0f1d45fe8), W(0x000011ac8f6e0e2e), W(0x000080115a4ff530),
+     W(0x0000dcb6ff7965e9)},
+    0
+  },
+  {
+    {W(0x00002739302c8b4e), W(0x000015954fae7e3c), W(0x000011f89c99f773),
+     W(0x00002796acc2e0bc)},
+    {W(0x0000be6ed5084e93), W(0x00000cfddb37742f), W(0x0000ba5a368f390b),
+     W(0x00007efe916a70f6)},
+    0
+  },
+  {
+    {W(0x0000c7f2cc2b5547), W(0x000062de59b4bdf1), W(0x0000df1ada8da4ee),
+     W(0x000024a2b6366baf)},
+    {W(0x0000397451c1a436), W(0x0000ec326ba457b3), W(0x0000483c3cd8b68a),
+     W(0x0000aedfd3a0606d)},
+    0
+  },
+  {
+    {W(0x00004e98079da46e), W(0x000025f828f9f6dc), W(0x0000407104d8010c),
+     W(0x0000a9610689a003)},
+    {W(0x0000e70fc98720f0), W(0x00004aaa2b5f02ae), W(0x00007656398225bc),
+     W(0x0000f7e363fa140e)},
+    0
+  },
+  {
+    {W(0x0000a9370baa8cc4), W(0x000006ab99476a27), W(0x000064bfdc647173),
+     W(0x000093bbd2367d4f)},
+    {W(0x000032139fdb6c1b), W(0x000065a2d776de36), W(0x0000a533912351c0),
+     W(0x0000aa79563ed71c)},
+    0
+  },
+  {
+    {W(0x00006731ad6b6b49), W(0x000097c0cf03a1e0), W(0x0000d00625231677),
+     W(0x000066d2846b807a)},
+    {W(0x00001ba1c217b952), W(0x000088fa3c1ad058), W(0x0000a5185e2710f6),
+     W(0x000042259594e2bf)},
+    0
+  },
+  {
+    {W(0x000090109e086226), W(0x0000cdbaa3435aa5), W(0x0000c89ab153b9be),
+     W(0x0000c2c3448a04f5)},
+    {W(0x00006394b78f4bd1), W(0x0000102072af2fff), W(0x0000555e91c018e6),
+     W(0x00006c2b187749da)},
+    0
+  },
+  {
+    {W(0x0000c6ad03202e75), W(0x0000769541a7a6ea), W(0x00007fb5897d0816),
+     W(0x000069b4c9beddd6)},
+    {W(0x0000d9bbf78fa55a), W(0x00005c142271ccf9), W(0x00008d4571d25e93),
+     W(0x000051e4ac7e1964)},
+    0
+  },
+  {
+    {W(0x000005b4551ae431), W(0x00007eee7ce2c1e5), W(0x0000ab5878f6b420),
+     W(0x0000310f345a2cc8)},
+    {W(0x0000e758ad3cddd9), W(0x000097cb08e9987d), W(0x0000d82950f4866c),
+     W(0x0000928a96aec728)},
+    0
+  },
+  {
+    {W(0x00007962b60f0a54), W(0x0000ae65f67f1aeb), W(0x0000b689b7db0f86),
+     W(0x0000613415f167fb)},
+    {W(0x0000c0b7ae9ed9f6), W(0x000010c01788b46f), W(0x00002ba3c63cc73a),
+     W(0x00001462d8821810)},
+    0
+  },
+  {
+    {W(0x000031355cd913d1), W(0x000012808fffe861), W(0x00004e12657c7926),
+     W(0x0000e22cd821223d)},
+    {W(0x0000f296411916c7), W(0x000002773f584381), W(0x0000a0fc08fe48c2),
+     W(0x0000d9e016c7ceb6)},
+    0
+  },
+  {
+    {W(0x00005e9641e0396b), W(0x00009eaa05c90cb0), W(0x00003e5d0068de89),
+     W(0x000033c7ce189729)},
+    {W(0x00009d8832c7b85f), W(0x0000fd08951892a3), W(0x000037cc1f345bd8),
+     W(0x00004e0e87de1b12)},
+    0
+  },
+  {
+    {W(0x0000d945ab997cd6), W(0x00002cfa3a18d444), W(0x00005ff51a03e0fd),
+     W(0x00000e5455e3af9a)},
+    {W(0x0000fcf7cb536035), W(0x00002e0a46913a27), W(0x0000e167c00801c6),
+     W(0x0000e2732bc82463)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000eb42966fa680), W(0x00002eacbd34ce01), W(0x0000511cda359fa0),
+     W(0x0000d93af9b205f6)},
+    {W(0x0000a555bb419bf9), W(0x000040bfb04034e7), W(0x00004548cd51acc8),
+     W(0x0000fffe73b0111a)},
+    0
+  },
+  {
+    {W(0x00002941da96572e), W(0x0000303f64f4c35f), W(0x0000dabc467ebf35),
+     W(0x000099cae8204f0b)},
+    {W(0x00005d98d3eb5a4d), W(0x0000cc4d416cc6ea), W(0x000012db756884d1),
+     W(0x00009350229af246)},
+    0
+  },
+  {
+    {W(0x0000bac919d1ad6a), W(0x000087a9138f9449), W(0x00005e43620fe156),
+     W(0x00001950c5d5e354)},
+    {W(0x0000bfe0b777f68a), W(0x000073835d0afff5), W(0x00004bf0edefc1c2),
+     W(0x00006803ca411a85)},
+    0
+  },
+  {
+    {W(0x0000ca40f7d404ed), W(0x00003699a8a44fe5), W(0x00002acea50e2949),
+     W(0x0000054593395f7b)},
+    {W(0x0000ccca517991dd), W(0x00001e10cc08f2bd), W(0x0000af1c92834eea),
+     W(0x00001e5b1a9f7415)},
+    0
+  },
+  {
+    {W(0x00008d7e579e1c72), W(0x0000dde1afe0690a), W(0x0000b4d216a9cc03),
+     W(0x0000d2261fd6e0f6)},
+    {W(0x0000cb63a17466e4), W(0x0000ebdbd210891c), W(0x000015cf3962ea48),
+     W(0x0000c08cbdc1e1c7)},
+    0
+  },
+  {
+    {W(0x0000c0802caa90f4), W(0x000006f9242112d2), W(0x00007e8d62525814),
+     W(0x0000b6b45610f532)},
+    {W(0x0000771800c858e3), W(0x0000d90752dafdd8), W(0x0000cca32048d133),
+     W(0x00002d7683af1e20)},
+    0
+  },
+  {
+    {W(0x0000903d0a8eb094), W(0x0000cbf993ee4327), W(0x00006ed3e422b404),
+     W(0x000016af40dd22fc)},
+    {W(0x000018edcc052bae), W(0x0000ec3eec6c6ec8), W(0x00008783aa6ae382),
+     W(0x0000fd3fe43d51ef)},
+    0
+  },
+  {
+    {W(0x00007b4cae642f3b), W(0x0000d22ccb1a984d), W(0x0000cf356e96b2d8),
+     W(0x0000cc774188771a)},
+    {W(0x0000b1b1794ead23), W(0x0000f02286f76167), W(0x0000496b28d2a318),
+     W(0x00001942387692b3)},
+    0
+  },
+  {
+    {W(0x00006f753ab388f8), W(0x0000cf06d273b075), W(0x0000cfbd35193b18),
+     W(0x0000124692491036)},
+    {W(0x0000f0bfb7733b8a), W(0x00001f51476fd7fb), W(0x0000c78cc6885780),
+     W(0x00001341e6825225)},
+    0
+  },
+  {
+    {W(0x0000ab6516f65e2a), W(0x00008782690d5dbc), W(0x0000c479ac98885d),
+     W(0x0000aad94a6b5914)},
+    {W(0x0000b544ed2baf2a), W(0x000082c602aaf9fa), W(0x0000b9aacc955517),
+     W(0x00004b1d5fcfb952)},
+    0
+  },
+  {
+    {W(0x0000280d01c4ab49), W(0x0000eebef7482340), W(0x0000c46da1e65e31),
+     W(0x0000d9e19f387e35)},
+    {W(0x000018828af43cd6), W(0x00002da3839c90dc), W(0x0000418a8ce2d735),
+     W(0x0000711fa64322ba)},
+    0
+  },
+  {
+    {W(0x0000eb24c8ec70de), W(0x000082f8cbfc917c), W(0x00002ac9e5c26c52),
+     W(0x0000b22d86a5a189)},
+    {W(0x0000b57e7db94ee8), W(0x00003279f6e9aebb), W(0x0000a3296f206e03),
+     W(0x00008260d4597092)},
+    0
+  },
+  {
+    {W(0x0000525540031e0b), W(0x0000c92b0043e9e0), W(0x00007e067af60d03),
+     W(0x0000ef0252a0055f)},
+    {W(0x000020f3838619a0), W(0x00003fd8894da43a), W(0x00002ce86743f07e),
+     W(0x0000d4a93d10cc9d)},
+    0
+  },
+  {
+    {W(0x0000158ba4252e10), W(0x00001dba0e17da53), W(0x0000e1ed65d4e124),
+     W(0x00001352f8f1afc5)},
+    {W(0x00005721c2079dfd), W(0x000053ca0535d6e8), W(0x0000a2141a5bd6eb),
+     W(0x00008aa98bbe35e8)},
+    0
+  },
+  {
+    {W(0x00008cfb603246be), W(0x0000834c9f895201), W(0x0000378bd2834c0c),
+     W(0x00005f6dc923c0a9)},
+    {W(0x0000adbf88669237), W(0x0000d75ebb09f3a4), W(0x000002fb2d319fed),
+     W(0x0000c798197e9239)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0000ac4bfc1d3a93), W(0x0000b49c16313b76), W(0x0000a75f2b9caa3b),
+     W(0x000033626d7d4a62)},
+    {W(0x00005693c20604cd), W(0x0000d30238242b2f), W(0x0000319b66d49d6f),
+     W(0x00007d8796e39014)},
+    0
+  },
+  {
+    {W(0x0000aaf599c5365b), W(0x000032d5b39e18e2), W(0x0000e2dfdf1ad6a5),
+     W(0x00002b54b8edcc37)},
+    {W(0x00008c650d8de581), W(0x0000bcb87b96775d), W(0x0000ce2edbe9e459),
+     W(0x00009b065802f30f)},
+    0
+  },
+  {
+    {W(0x000034b2a6c88f71), W(0x0000a03ac3015ca5), W(0x000004afa49040c9),
+     W(0x00005c79cd8f2a7b)},
+    {W(0x0000acf9bbe94f37), W(0x00005eda2bb806bf), W(0x0000ee8677c7ba98),
+     W(0x00004258d79a2608)},
+    0
+  },
+  {
+    {W(0x0000dd933ab8c0d1), W(0x0000bf2fab619dbd), W(0x0000db2c24031980),
+     W(0x0000efd98e935f04)},
+    {W(0x000020b1bc1f6b74), W(0x00003b02c4b6df75), W(0x0000021680af8222),
+     W(0x000025f91ffb98ad)},
+    0
+  },
+  {
+    {W(0x0000b2844924c823), W(0x0000a2e57cbfc230), W(0x0000fc4cfbf5c530),
+     W(0x00002f4e8113f534)},
+    {W(0x00007c78529fdbc9), W(0x00005947750b1e69), W(0x0000973a988a82b0),
+     W(0x00009f41491ec238)},
+    0
+  },
+  {
+    {W(0x00007b3df00e2287), W(0x00000f30e6c3ab56), W(0x000021a51e85a564),
+     W(0x00003b9832ff8b69)},
+    {W(0x00006fbcbb5b5da0), W(0x000005b9791abee8), W(0x0000b7deadabd7f7),
+     W(0x000056cadaa3c816)},
+    0
+  },
+  {
+    {W(0x0000ecefb8f84e43), W(0x0000e1bf6ac1a80f), W(0x0000600ef3898100),
+     W(0x0000866419ccd5d1)},
+    {W(0x0000b2d35e620e63), W(0x00004326a0df68e1), W(0x0000a7a2b7bfc87d),
+     W(0x00006ba022266eb5)},
+    0
+  },
+  {
+    {W(0x00005c315acf7b93), W(0x000024301bc4fdc4), W(0x0000c851f04f1927),
+     W(0x0000219dde87ee3b)},
+    {W(0x0000c349888ac912), W(0x000086831fbe4e2d), W(0x000083c8ce648410),
+     W(0x0000772acc9a7149)},
+    0
+  },
+  {
+    {W(0x000027e489c99fb1), W(0x000093acd633e501), W(0x0000c54b526d46e6),
+     W(0x0000106113763342)},
+    {W(0x00002975f00bc231), W(0x000042f3e4a3578f), W(0x0000623afe7550a5),
+     W(0x0000750ef9028194)},
+    0
+  },
+  {
+    {W(0x0000d8caed1403de), W(0x00000cbdf524b340), W(0x0000d9a870ee355d),
+     W(0x0000809fab4418b6)},
+    {W(0x0000133cf4b43e46), W(0x000066d9f4044af8), W(0x000023ef9502f58a),
+     W(0x000066f6b81bc8ac)},
+    0
+  },
+  {
+    {W(0x00000f49d2748cec), W(0x0000c69140c157d9), W(0x000000961c57b693),
+     W(0x0000c3fec64946a9)},
+    {W(0x0000b22079755f49), W(0x000046cf25a6c92c), W(0x0000947865200035),
+     W(0x000012c6843dd05e)},
+    0
+  },
+  {
+    {W(0x0000ef1ef4bcdc8e), W(0x00007eb70cf6e84d), W(0x000061fbbff58d7c),
+     W(0x000041299d180906)},
+    {W(0x0000ec26076d57ec), W(0x0000f336b0225298), W(0x000089db86d632e4),
+     W(0x000085b2176273c9)},
+    0
+  },
+  {
+    {W(0x00003a8cf1a5a4ad), W(0x0000d82941673425), W(0x00006fa154e44b32),
+     W(0x0000e1320a3bd1c3)},
+    {W(0x0000da2af4c9262c), W(0x00007ae201ff5c11), W(0x00007b1d3003cd17),
+     W(0x0000b7cfd49cf53b)},
+    0
+  },
+  {
+    {W(0x00000194719016d8), W(0x00002ddf3c6786d7), W(0x0000d06bd6347391),
+     W(0x0000591a9c46e2f5)},
+    {W(0x00001bc304578908), W(0x00002fe0580d6a2d), W(0x0000ca47abc40de5),
+     W(0x0000f3cfff081fba)},
+    0
+  },
+  {
+    {W(0x00008f2599631539), W(0x0000047426292815), W(0x00000cdb0e527e5c),
+     W(0x000016647fdeb56e)},
+    {W(0x000022d4c4002226), W(0x000092f2ada264cc), W(0x0000df9e48ea04f6),
+     W(0x00006434f1d09ef1)},
+    0
+  }
+};
+
+static const wge_t p192_wnd_naf[1024] = {
+  {
+    {W(0x00000afd82ff1012), W(0x000043a18800f4ff), W(0x000090f67cbf20eb),
+     W(0x0000188da80eb030)},
+    {W(0x000077a11e794811), W(0x00006b24cdd573f9), W(0x0000da78631011ed),
+     W(0x000007192b95ffc8)},
+    0
+  },
+  {
+    {W(0x0000d359cbb263da), W(0x00001fb2b9aadfd0), W(0x00009e6edcd28320),
+     W(0x000076e32a255759)},
+    {W(0x000043660cfd05fd), W(0x0000d121d49ef3b5), W(0x00004520aa62e0fe),
+     W(0x0000782c37e372ba)},
+    0
+  },
+  {
+    {W(0x000018ebdd7ff590), W(0x0000300e16055901), W(0x00009b183e078d9c),
+     W(0x000010bb8e984004)},
+    {W(0x000072543cceaea1), W(0x0000e62762be312b), W(0x0000917badc9f836),
+     W(0x000031361008476f)},
+    0
+  },
+  {
+    {W(0x00007f007011fcfd), W(0x00003060edce5de3), W(0x0000cd7660f92324),
+     W(0x00008da75a1f75dd)},
+    {W(0x000002f96409ffb5), W(0x0000fdb3c01dd4b7), W(0x0000b35418240db8),
+     W(0x000057cb5fcf6860)},
+    0
+  },
+  {
+    {W(0x0000375ab980388f), W(0x0000a8d27c9e1d9d), W(0x0000abb74e9e8f2b),
+     W(0x0000818a4d308b1c)},
+    {W(0x0000542176c8e739), W(0x0000bb457cdf30ea), W(0x000087cd7c292f7c),
+     W(0x000001d1aa5e208d)},
+    0
+  },
+  {
+    {W(0x000040370628a2aa), W(0x00004d22b6522809), W(0x0000324f1844f716),
+     W(0x00001c995995eb76)},
+    {W(0x0000b8611aaa9c04), W(0x000000fa77bdb34c), W(0x0000eb73029f5564),
+     W(0x0000ef1765ce37e9)},
+    0
+  },
+  {
+    {W(0x00004a363c4a090a), W(0x0000051e4ea00414), W(0x0000fb9f2f68821e),
+     W(0x0000112af141d33e)},
+    {W(0x0000a094432b1c1e), W(0x0000e081e09e7f10), W(0x000093f72a2c1726),
+     W(0x00006e0cbe3bfc52)},
+    0
+  },
+  {
+    {W(0x00004a9e7578b1e7), W(0x0000b5414de736de), W(0x0000b633ba3546b2),
+     W(0x00008c9595e63b56)},
+    {W(0x000037cdd98fc7b1), W(0x00003aa566b6ad75), W(0x000000c17cf38799),
+     W(0x0000266b762a934f)},
+    0
+  },
+  {
+    {W(0x000045930510ff8a), W(0x0000c2b4213b8bb4), W(0x00006dc3f9f57636),
+     W(0x000044275cd2e1f4)},
+    {W(0x0000a67ad25ddfd0), W(0x0000a818e98d9b76), W(0x00000c87de438612),
+     W(0x0000efad8348fde3)},
+    0
+  },
+  {
+    {W(0x0000c97a1cf8ad1b), W(0x000038d72688774f), W(0x0000e5d307fd8392),
+     W(0x0000c0626bcf247d)},
+    {W(0x00006b4e71faa20a), W(0x0000e829c804ec1a), W(0x00003dc197e12778),
+     W(0x00009cdc99d75397)},
+    0
+  },
+  {
+    {W(0x00009b3dbc50e857), W(0x00003cf5e52c2920), W(0x00003a4867fe6887),
+     W(0x0000e080b24c0b65)},
+    {W(0x0000e60097125604), W(0x000082865eaa58f4), W(0x0000ef97fd38e0c4),
+     W(0x00000d0fcb856066)},
+    0
+  },
+  {
+    {W(0x0000559f4ba764ce), W(0x0000184faa9ee980), W(0x0000588aed22d19c),
+     W(0x00008f9d61c041cf)},
+    {W(0x000082a3ca2251d4), W(0x000009f23eada33e), W(0x0000c92f1fad57ab),
+     W(0x00000875de0ff4e0)},
+    0
+  },
+  {
+    {W(0x000098e355390164), W(0x0000be0f11fe9cfa), W(0x0000723da40c6670),
+     W(0x0000a530c1366aa0)},
+    {W(0x000049e6c5e66e62), W(0x00007c9a8b37ca8b), W(0x000088a6f46ac407),
+     W(0x00003baa652f61ea)},
+    0
+  },
+  {
+    {W(0x00000bc9958d3288), W(0x0000730e9f58ce96), W(0x00002fe7c5d7274a),
+     W(0x00001c0a55854916)},
+    {W(0x00003488f2fcd59a), W(0x000012490cdbfa0f), W(0x0000796f0fa9ba33),
+     W(0x0000618aeecd7c6d)},
+    0
+  },
+  {
+    {W(0x0000cfa0f05b46f3), W(0x0000e0ae9eeef53c), W(0x0000f4482f9e82fd),
+     W(0x0000c013b8cb3620)},
+    {W(0x0000cb2c717d0efb), W(0x0000217afb4fc778), W(0x00005de2879b6240),
+     W(0x00002d1b8f0891e0)},
+    0
+  },
+  {
+    {W(0x00005aa0df5af1f8), W(0x0000461cdc697a54), W(0x00004b79445e2e3c),
+     W(0x00002b003cb1e24d)},
+    {W(0x0000402ce619c94c), W(0x00003ec5deaf9a71), W(0x0000a4877efae76a),
+     W(0x0000ff5d8e6096e2)},
+    0
+  },
+  {
+    {W(0x000056b734fd70b5), W(0x00003b7c65268af1), W(0x00008a360119d94c),
+     W(0x0000b61807df1ac2)},
+    {W(0x00000cb9431d5065), W(0x0000dd1ffc217e8a), W(0x000077247ae71b75),
+     W(0x0000000aff247d5f)},
+    0
+  },
+  {
+    {W(0x000070fcc07e40fd), W(0x0000d6ea5f2237a2), W(0x000027455011a2ad),
+     W(0x00007bb95eb35585)},
+    {W(0x00009b7e45cad35c), W(0x0000c6e4de271a94), W(0x0000e8be07e48ddf),
+     W(0x0000e8b45b9ad539)},
+    0
+  },
+  {
+    {W(0x0000d750a61b987b), W(0x0000dee7e8a73feb), W(0x00002849e8d4cf58),
+     W(0x00005d9825b0815a)},
+    {W(0x00006e6fd224dd86), W(0x00002b7b2c064727), W(0x00009784d4e8e1c7),
+     W(0x0000952613c816d7)},
+    0
+  },
+  {
+    {W(0x00002ee5cfca5da3), W(0x00001ba48c43d815), W(0x0000dbbcfbd55d33),
+     W(0x0000719c8c3cfad8)},
+    {W(0x00000ff929dc0f77), W(0x0000700e747b8a03), W(0x00003fa80bf49031),
+     W(0x000031e7d38d789a)},
+    0
+  },
+  {
+    {W(0x0000928d0e36cec3), W(0x0000c39a677d18a1), W(0x00002f48c2053372),
+     W(0x0000ac1c2c2558d3)},
+    {W(0x000080f0f503a3b7), W(0x0000f246a297812f), W(0x0000259acea6d1f1),
+     W(0x0000b9e0a16423fd)},
+    0
+  },
+  {
+    {W(0x0000043a916b96c8), W(0x00000dc5c9a48e6a), W(0x0000c1c34e5e0e36),
+     W(0x000082b3907c7d7c)},
+    {W(0x0000e7a76c68ac61), W(0x000054ee03b27261), W(0x0000712876550dd4),
+     W(0x0000e86544425927)},
+    0
+  },
+  {
+    {W(0x0000a8606d86338b), W(0x00002ec18e2d7851), W(0x00005f772511d22e),
+     W(0x00004361d8269faf)},
+    {W(0x0000f49265144b39), W(0x00002f4f98bc1065), W(0x00008bc5a069a9c0),
+     W(0x000032850fe48bc8)},
+    0
+  },
+  {
+    {W(0x00008b6fec6f2727), W(0x0000b5eab6f5caba), W(0x0000b52c9863bc9b),
+     W(0x00006369e3c69cea)},
+    {W(0x0000adf6bba1a9bf), W(0x0000f1a1a2bd281d), W(0x00006af7cadd9da8),
+     W(0x000086f777c547da)},
+    0
+  },
+  {
+    {W(0x0000135d01ca849d), W(0x00008b7ddf51bc65), W(0x0000b4c4e463c0ee),
+     W(0x00007c9053a72b97)},
+    {W(0x0000d390ad85a61d), W(0x0000dd27e3cd0f7f), W(0x0000f5eb5e5dda40),
+     W(0x000095b131fe3994)},
+    0
+  },
+  {
+    {W(0x0000f58de9c9d543), W(0x0000de10adc1c16d), W(0x00007ca5ca663695),
+     W(0x0000fad2c55237b8)},
+    {W(0x0000272bcae2decc), W(0x00006a50fa814ec3), W(0x0000272e897380e1),
+     W(0x000045ed10ba03ab)},
+    0
+  },
+  {
+    {W(0x000062fdc16af318), W(0x0000a40ae85c1189), W(0x00007f0a0dbba543),
+     W(0x00005add497e4645)},
+    {W(0x00009fac6fc1f7f9), W(0x0000a92b1d4c9093), W(0x000008c953800d41),
+     W(0x0000fe53d43c9cbf)},
+    0
+  },
+  {
+    {W(0x0000aeab73298078), W(0x0000934c7ca7f99c), W(0x0000a41dccd2737a),
+     W(0x0000e72e282537e2)},
+    {W(0x000005617f3820b9), W(0x00006a145630c8f4), W(0x00002bd93269bd46),
+     W(0x00002c92a8497c98)},
+    0
+  },
+  {
+    {W(0x00004bbbdef8360a), W(0x000081cc7fb8fe3d), W(0x0000dc76f314879b),
+     W(0x0000d234b4a06618)},
+    {W(0x0000364a0a4f3ffd), W(0x000048333549f4c0), W(0x00008af5b587c29b),
+     W(0x0000d3416a93142c)},
+    0
+  },
+  {
+    {W(0x00003b201261cf13), W(0x00002379ac47e12b), W(0x0000a9c095b0a6e6),
+     W(0x00009402a9163633)},
+    {W(0x0000ecb575c12c5f), W(0x00006133cb7396e2), W(0x00005aabe2ca5ebd),
+     W(0x00003dccaf410fbb)},
+    0
+  },
+  {
+    {W(0x000075bbcdd5f5f4), W(0x000011de3b0ad0b9), W(0x00009b8ef94d78ff),
+     W(0x00007a3e92d5469c)},
+    {W(0x0000324b4a766456), W(0x0000a05eadd9d014), W(0x00005191a2b4f9a8),
+     W(0x00000aa43eefa54e)},
+    0
+  },
+  {
+    {W(0x000039f0157c5a0f), W(0x00007a6344604b7b), W(0x0000d26dfcd56707),
+     W(0x0000809b3ae58fd7)},
+    {W(0x00004d0594299335), W(0x0000cf62fc22d36a), W(0x000021fef99b2f64),
+     W(0x0000d3e53442d434)},
+    0
+  },
+  {
+    {W(0x0000f7f51839a9ca), W(0x0000a237b89c7017), W(0x0000d896045e2234),
+     W(0x0000313214207bf5)},
+    {W(0x00003be32db295f6), W(0x0000078ef8e1bea2), W(0x0000678682999f34),
+     W(0x0000e730110646c3)},
+    0
+  },
+  {
+    {W(0x00007cc7ca07cf08), W(0x000095b9ce50b26c), W(0x0000d6010b8ddec8),
+     W(0x000063a606a955d2)},
+    {W(0x000015de06197459), W(0x000072126b799c0c), W(0x00009d82b93ab0ba),
+     W(0x00000b607aeef1f1)},
+    0
+  },
+  {
+    {W(0x00003f7d960b175d), W(0x0000e2c481f31787), W(0x00001f3618281440),
+     W(0x000024397ecbef82)},
+    {W(0x000060d11cbbbd41), W(0x0000bf7cc123aea6), W(0x000065476da23711),
+     W(0x0000120f55cfce50)},
+    0
+  },
+  {
+    {W(0x00006c686db322ce), W(0x00003d4695f694e2), W(0x000006d6a4fbc869),
+     W(0x0000263274de8f97)},
+    {W(0x00000de12d500bfd), W(0x00005cb4d869ad1b), W(0x000015b3d8c3bc17),
+     W(0x0000800bd37f17c6)},
+    0
+  },
+  {
+    {W(0x0000bff6e72831c1), W(0x000085272d5a7c30), W(0x00002a0179359bb0),
+     W(0x0000a710c55e5558)},
+    {W(0x00009ca0e3cac5b5), W(0x00006a35a72cc2c4), W(0x000070ceae75ed8c),
+     W(0x0000af7970c6043e)},
+    0
+  },
+  {
+    {W(0x0000e334ce37f907), W(0x00001ed30d2b262b), W(0x00009cd9763de0d6),
+     W(0x0000edd42ebc4812)},
+    {W(0x0000d67eb44822e9), W(0x00006c7644f3bdd6), W(0x000074d8d7906dc0),
+     W(0x0000bee681c5f8ca)},
+    0
+  },
+  {
+    {W(0x00006ebc262785c6), W(0x00006bb26c0dae4f), W(0x0000635497a1ddae),
+     W(0x000096db2171069c)},
+    {W(0x00001dfa676c5f38), W(0x0000f189da04b7b0), W(0x00004bc50f77145f),
+     W(0x0000ae05b1bbf868)},
+    0
+  },
+  {
+    {W(0x00000eef5455b560), W(0x00000ec64085ec00), W(0x00002bfd8ab2a915),
+     W(0x0000180110659a0f)},
+    {W(0x000074e6232c54d3), W(0x00008aa5b9141bd8), W(0x0000a69fe59fd9a2),
+     W(0x000084d88661fb1a)},
+    0
+  },
+  {
+    {W(0x000080c645f2d928), W(0x0000f0372820c818), W(0x0000065133ad79bc),
+     W(0x000046aff85827c9)},
+    {W(0x0000970f34a103e2), W(0x00009bcbda59194f), W(0x0000cff14b4222e1),
+     W(0x00001b8911d44f06)},
+    0
+  },
+  {
+    {W(0x000088ce7bc3443a), W(0x0000cc3d751d3cee), W(0x0000914dd3d002ff),
+     W(0x000053827e793c7e)},
+    {W(0x0000ec714df69829), W(0x0000f21729162bec), W(0x0000c4c6185b24da),
+     W(0x00003ebcba06ad62)},
+    0
+  },
+  {
+    {W(0x0000800fd0e84b1d), W(0x0000faefbc6359fe), W(0x0000bc07fd49d3e1),
+     W(0x0000e7618e1d4050)},
+    {W(0x0000e25e0b52c14b), W(0x0000fc49027575b5), W(0x0000ad388ededf42),
+     W(0x00005ad94aa7ecf9)},
+    0
+  },
+  {
+    {W(0x00004c1bfb705cd6), W(0x000021cfa08f9ea9), W(0x0000e7c6fcb71124),
+     W(0x00006d8b936238ce)},
+    {W(0x0000d2711ff73c93), W(0x00009ad41dd755ab), W(0x000032e40fadfcfb),
+     W(0x000071f57ff25dc1)},
+    0
+  },
+  {
+    {W(0x0000861949a44bf6), W(0x0000b9c2c106877d), W(0x00003457515962d1),
+     W(0x000045afde81ce04)},
+    {W(0x000006baf36649eb), W(0x00008aad1325a04a), W(0x00009f3414abd0bd),
+     W(0x0000b8ac6b4f561c)},
+    0
+  },
+  {
+    {W(0x000039756663fb65), W(0x0000fc25bb0daa79), W(0x000095ef0ff6107a),
+     W(0x0000346b6ac8ad19)},
+    {W(0x0000558fca606603), W(0x0000b1811306cc74), W(0x0000adfba9ce09e3),
+     W(0x000086cee8649d2e)},
+    0
+  },
+  {
+    {W(0x000025b70ac8170d), W(0x000069db261b88e8), W(0x0000053ffe8fb868),
+     W(0x00004516c8552e20)},
+    {W(0x0000c002f6e355ba), W(0x00009fd6adae302c), W(0x000055ae3c7cc7aa),
+     W(0x000001d9653a30c4)},
+    0
+  },
+  {
+    {W(0x000030c8bbb28d37), W(0x00003bd2846b2a11), W(0x0000938fe37111fd),
+     W(0x0000e9e896433e6a)},
+    {W(0x0000a4bc7be08241), W(0x00003dbf81736579), W(0x00001db3d327911a),
+     W(0x0000d952ae8e6ada)},
+    0
+  },
+  {
+    {W(0x000065051ae65dbf), W(0x0000bc24304ff360), W(0x00003e46776d86e2),
+     W(0x000089184a8f8cbd)},
+    {W(0x0000f1b2a831e082), W(0x000047b900a6815d), W(0x0000931b039b7be5),
+     W(0x00008fd0d2846501)},
+    0
+  },
+  {
+    {W(0x000047157b8e20cb), W(0x0000a12ee4e4038a), W(0x0000e44bef205ac5),
+     W(0x0000683aa3c655d1)},
+    {W(0x0000765036f47d2d), W(0x000056c7c1864f15), W(0x00007684f622132d),
+     W(0x00007743c31bc67b)},
+    0
+  },
+  {
+    {W(0x0000c2680b8941c1), W(0x0000fdbba5d9b456), W(0x000053433a58e47a),
+     W(0x000019cea4d3a4e1)},
+    {W(0x00002e74c3cc58d6), W(0x0000aa9f008e0ccd), W(0x0000b82e1f42db32),
+     W(0x0000aa649b062593)},
+    0
+  },
+  {
+    {W(0x0000858e7a44e6a6), W(0x00007ae1a928c115), W(0x00005c8c04c95f57),
+     W(0x000019d888cbf3f4)},
+    {W(0x0000b328939bf92d), W(0x00003e172f2d7b54), W(0x00005f877fabb9df),
+     W(0x0000ab6ca87db627)},
+    0
+  },
+  {
+    {W(0x0000c9400bfd585e), W(0x0000f917912c3ea0), W(0x0000ae7b55084942),
+     W(0x0000dae3467542c6)},
+    {W(0x0000d21278cff93f), W(0x00009531a81f3598), W(0x0000da102c458b6c),
+     W(0x000061d8f04b2341)},
+    0
+  },
+  {
+    {W(0x0000053e41954ee2), W(0x0000770514d0ddac), W(0x000031071785e6dd),
+     W(0x000089dbaf434ea3)},
+    {W(0x0000f694943da9c7), W(0x0000f71d4272bfbc), W(0x0000942409f0797b),
+     W(0x00009be6f86c2933)},
+    0
+  },
+  {
+    {W(0x0000c12764575bdb), W(0x0000e3a585d61f2a), W(0x000075809544c2b8),
+     W(0x0000915420c5bc6b)},
+    {W(0x0000a396baacfc55), W(0x000041e9744ab997), W(0x000053c376a82bbc),
+     W(0x00001a48c3faaca0)},
+    0
+  },
+  {
+    {W(0x000093ee7e296d3e), W(0x00000d647b9fe2d9), W(0x0000942b36829afe),
+     W(0x000053e206440b96)},
+    {W(0x0000c2f374dbe010), W(0x0000c2b68f86c304), W(0x0000dc3cbb3c0505),
+     W(0x00008317e53bc1fb)},
+    0
+  },
+  {
+    {W(0x0000405a2aa3c601), W(0x0000c433a04b0d65), W(0x000066131a28a907),
+     W(0x00001f95f150c4b6)},
+    {W(0x0000e0db776ab785), W(0x00004638b2abcc02), W(0x0000680c7e31c559),
+     W(0x0000e633ccebe298)},
+    0
+  },
+  {
+    {W(0x00005a5bb74273d2), W(0x00008c62bb99cfed), W(0x00001d621e38578e),
+     W(0x000046fb7770fb19)},
+    {W(0x0000aab641e461a5), W(0x00005a76cfbdc789), W(0x00003462721e1c8e),
+     W(0x0000a2cb5d089d30)},
+    0
+  },
+  {
+    {W(0x0000bfce3103fca1), W(0x000002ffeb6412a9), W(0x0000b2d25b42954a),
+     W(0x00003e4cb499b746)},
+    {W(0x0000e0a6427c5e5f), W(0x0000cfa805a655ac), W(0x000035d175bc2886),
+     W(0x0000c7939f2e758b)},
+    0
+  },
+  {
+    {W(0x000061b5f29a8912), W(0x00007d97af37d5d5), W(0x00009dd3c9e593db),
+     W(0x0000d3deb9c045c4)},
+    {W(0x000044e0a66149c7), W(0x0000eb825b481c01), W(0x000001f1f8e4bdcb),
+     W(0x0000932b0cd99873)},
+    0
+  },
+  {
+    {W(0x000024e76dd38ab8), W(0x0000022c86db9289), W(0x0000fb5617b4f63d),
+     W(0x0000c4697db6db93)},
+    {W(0x0000c44980f320f1), W(0x000001b73c27f031), W(0x00001d0c842edcdf),
+     W(0x0000c4bfeb631dbb)},
+    0
+  },
+  {
+    {W(0x0000c540fb484a43), W(0x00008b1c185b988f), W(0x0000144ec225b0d4),
+     W(0x00002ce39c9d28b4)},
+    {W(0x000020534f2a9196), W(0x000009be5d4dfac3), W(0x0000d7351cb32d9e),
+     W(0x00008854b75840eb)},
+    0
+  },
+  {
+    {W(0x0000bc5192dec046), W(0x000051d9ffb5c79b), W(0x000004976033f150),
+     W(0x0000371e33f911cc)},
+    {W(0x0000658de158f89e), W(0x000018157d9b5e33), W(0x00008c34aca13939),
+     W(0x0000d24b7b1a8d3a)},
+    0
+  },
+  {
+    {W(0x00009d3b0663fed3), W(0x000003a7dd9d0b17), W(0x0000eb1dbec71504),
+     W(0x000062bf33c175b5)},
+    {W(0x0000e838ca39f2e1), W(0x00002738233292cf), W(0x0000b5998ae18581),
+     W(0x0000d4e94e4d894d)},
+    0
+  },
+  {
+    {W(0x0000b77dcaa8e2cf), W(0x000021762480225a), W(0x0000dda6a210525b),
+     W(0x000048ff81eec6aa)},
+    {W(0x00004453207383b8), W(0x0000b49320ebbfa8), W(0x0000bbd244469b5f),
+     W(0x00002d0c5b17f9f8)},
+    0
+  },
+  {
+    {W(0x0000fd585783085b), W(0x00008f1342a63a80), W(0x0000cd05a8522c2b),
+     W(0x000071a1f675d275)},
+    {W(0x0000da9b344b9f66), W(0x00008d85cce87818), W(0x0000452daa70b28d),
+     W(0x00002d6df288993f)},
+    0
+  },
+  {
+    {W(0x0000bfb61aef9bf6), W(0x0000df2524c8749d), W(0x0000243e0ad5a049),
+     W(0x0000defb71789bf0)},
+    {W(0x0000bf63fa7b15d5), W(0x00002e9731cf5d5d), W(0x00002518253b1637),
+     W(0x00003fc75900213a)},
+    0
+  },
+  {
+    {W(0x000059164dfed5d8), W(0x00002fbb1c86aa9f), W(0x0000277813a93646),
+     W(0x000035bd41265936)},
+    {W(0x0000d273d5824568), W(0x000096a38bf098b1), W(0x0000557ab0263a3c),
+     W(0x00008c1cde52c68e)},
+    0
+  },
+  {
+    {W(0x0000fdaf3a6844e3), W(0x000094baf57a072d), W(0x00001c40f6bf7790),
+     W(0x0000a9ddb4291382)},
+    {W(0x000096c9a9995db2), W(0x0000d006a103b8f8), W(0x00008406e42911ec),
+     W(0x0000eb46d5d39f6a)},
+    0
+  },
+  {
+    {W(0x00005b176c3eb06f), W(0x0000baa286d84697), W(0x000085f8e0ef369c),
+     W(0x00002efd998c510a)},
+    {W(0x000052e9705efac0), W(0x00004d56ee9df88d), W(0x0000d956a7225319),
+     W(0x0000cd8bfcd34d23)},
+    0
+  },
+  {
+    {W(0x00003b5f38088521), W(0x0000b2564ca02d24), W(0x0000fb7be632973f),
+     W(0x0000ea64638f90c6)},
+    {W(0x0000ce34de116c1e), W(0x0000a04530ccec66), W(0x0000fd9de6aa1681),
+     W(0x00007ef0b28513d6)},
+    0
+  },
+  {
+    {W(0x0000d2e1b970a5c9), W(0x000055b7df8f2639), W(0x0000d5480c38dfc1),
+     W(0x00001e29ac0a785e)},
+    {W(0x0000a1581d036d62), W(0x000015b735f99935), W(0x0000c320dd1b5002),
+     W(0x00000e4905ea24ac)},
+    0
+  },
+  {
+    {W(0x0000254533001b27), W(0x00001d472c596138), W(0x00002dbb085fe0e5),
+     W(0x00008422b0d2fb78)},
+    {W(0x00005d351ce49df8), W(0x0000e13ed40cfa21), W(0x0000b93e05a05669),
+     W(0x0000192f2400d60a)},
+    0
+  },
+  {
+    {W(0x00002c89f0f24bc6), W(0x0000e2f828756377), W(0x00004b5b232e27d2),
+     W(0x00005fa29af921e7)},
+    {W(0x000027506c82435b), W(0x00000ac3d90aa9dc), W(0x00001d3b5a0a669c),
+     W(0x00009240f6be35fb)},
+    0
+  },
+  {
+    {W(0x0000ed05dd7345b5), W(0x00009291e18e6cef), W(0x000029c4a5f6e613),
+     W(0x000005b71ecb9b2d)},
+    {W(0x0000714df9988329), W(0x00006e1fa979d6cf), W(0x0000cae23b436552),
+     W(0x0000ff189a9f7fa8)},
+    0
+  },
+  {
+    {W(0x0000cddd585aee6d), W(0x000084f102fc9f94), W(0x0000bec6fdd86e7e),
+     W(0x00006057366c9e05)},
+    {W(0x000013e3df84b40f), W(0x0000b4e14699a854), W(0x0000e9e2ac96edf9),
+     W(0x000031390623b850)},
+    0
+  },
+  {
+    {W(0x0000cce90d21d7ed), W(0x000040fa9abf34be), W(0x0000fd0120b711fd),
+     W(0x00008e405b6b9f89)},
+    {W(0x0000eae2f74c9a2d), W(0x00006d68c73ad790), W(0x00002b8eac5765c6),
+     W(0x0000ba4f214cc6d6)},
+    0
+  },
+  {
+    {W(0x00007b51bbf50f75), W(0x0000ca35c1e27765), W(0x0000ccbeabe480e3),
+     W(0x0000ace69335b494)},
+    {W(0x0000322bc50042d7), W(0x00006962228d83ae), W(0x0000651c1b9453e7),
+     W(0x0000a6121a9cad7f)},
+    0
+  },
+  {
+    {W(0x000099090884b237), W(0x00004143f61fc48f), W(0x0000dfc865551636),
+     W(0x0000d04849e00397)},
+    {W(0x0000d93b7e2e1e1f), W(0x00003858a1749eaa), W(0x00004fe3133a84db),
+     W(0x00002b92cf3cc733)},
+    0
+  },
+  {
+    {W(0x0000eefc32db373b), W(0x000064577eb0c860), W(0x00009a2f6be9c915),
+     W(0x0000d7b28f828f9e)},
+    {W(0x0000429c07e805de), W(0x0000fd9138145cfa), W(0x00007a13d36c6df8),
+     W(0x00001418c32ee728)},
+    0
+  },
+  {
+    {W(0x0000daac6503745c), W(0x000031b845802422), W(0x0000bca69042c508),
+     W(0x00001b62515f80ec)},
+    {W(0x00005243b87a2c70), W(0x0000bfa2bb83feca), W(0x00004216741ad949),
+     W(0x0000e66fb5760309)},
+    0
+  },
+  {
+    {W(0x000062787540ef5f), W(0x0000f09ea5da291e), W(0x0000ee3a2ecdb94a),
+     W(0x000071ab32b92361)},
+    {W(0x00009f2477db500b), W(0x0000bbd37dae75a0), W(0x000098dab167ea19),
+     W(0x00002d506d94d6ca)},
+    0
+  },
+  {
+    {W(0x0000486c9ae53a19), W(0x00006b8eabbb44b6), W(0x0000292f56b12621),
+     W(0x0000553cb4197eac)},
+    {W(0x0000b0bea81eb069), W(0x0000a733de59f67c), W(0x00000396cd602f0b),
+     W(0x000093e272ce12fc)},
+    0
+  },
+  {
+    {W(0x000068c8c6e37d7f), W(0x00004af642c4ae2c), W(0x000006e3604dfe84),
+     W(0x0000ba6a8bee95f7)},
+    {W(0x00008673831d8f9a), W(0x00003fdd414be5bb), W(0x000092e2deb21dc3),
+     W(0x0000934cbad27676)},
+    0
+  },
+  {
+    {W(0x00003296940af7ca), W(0x0000e26555898be9), W(0x000076899f4c1c68),
+     W(0x0000343a2147bebe)},
+    {W(0x00006689d6930bf5), W(0x00006cb54ba4cfde), W(0x0000e42ca21e5840),
+     W(0x0000fde71e2f28d3)},
+    0
+  },
+  {
+    {W(0x0000d97d5675e99e), W(0x000099cc31b70373), W(0x0000cbaf3119719d),
+     W(0x0000732368b7c7d4)},
+    {W(0x0000f4f8fef0c359), W(0x0000992ec8b73e78), W(0x000097f3a95ac554),
+     W(0x0000f4562b71ff88)},
+    0
+  },
+  {
+    {W(0x00006ab4cc7f7630), W(0x0000094c8c040162), W(0x00009e9ae13f6cfd),
+     W(0x00006401c6ec371c)},
+    {W(0x00006fe7179b7852), W(0x00008a340ee49f56), W(0x0000a1021193a545),
+     W(0x000080cf88ee51eb)},
+    0
+  },
+  {
+    {W(0x00008344f738b1de), W(0x0000c3c6b68b3149), W(0x000082f86ebaf639),
+     W(0x0000265ebd415fa2)},
+    {W(0x00002e0c3cd1679b), W(0x00001a815d0b4d21), W(0x0000754d7a53edae),
+     W(0x0000e3dd10ec7c01)},
+    0
+  },
+  {
+    {W(0x00006e836af19a73), W(0x0000fcb886c29fbd), W(0x0000c29c5af3b155),
+     W(0x0000efb18d0b15a2)},
+    {W(0x00007f7ddca808b8), W(0x00003af895b43e6f), W(0x00009ca2166200bf),
+     W(0x0000399fb3ec2026)},
+    0
+  },
+  {
+    {W(0x000024e5e1d37c7c), W(0x0000cc55f2a7df03), W(0x00009ff95f333b83),
+     W(0x0000a8576a9b9a3d)},
+    {W(0x00003885475ad3f9), W(0x0000d61f01ba85b0), W(0x0000bf132aae124e),
+     W(0x000032dcd870cf22)},
+    0
+  },
+  {
+    {W(0x000071d19c892634), W(0x0000507b7474d3b1), W(0x000077803ee60a3a),
+     W(0x0000c09f7f668d90)},
+    {W(0x000080ead1a84ea0), W(0x0000521f022b1bcc), W(0x00001c9afe0cd8d5),
+     W(0x00006cfca440ed7d)},
+    0
+  },
+  {
+    {W(0x000046f87988c091), W(0x0000d3ed7447de91), W(0x0000e053eaa3669d),
+     W(0x0000fda73796d064)},
+    {W(0x000023053819112d), W(0x0000f449cf02abc9), W(0x0000bde05926de77),
+     W(0x0000807b43fee188)},
+    0
+  },
+  {
+    {W(0x0000342bc7be3bf8), W(0x0000f36b1456cfd0), W(0x00001502c4046043),
+     W(0x000079b315275c4f)},
+    {W(0x00009eda07a13d00), W(0x00008440e4813d06), W(0x0000f6f9da1f3502),
+     W(0x00006bba5cbda9fc)},
+    0
+  },
+  {
+    {W(0x00001c2364a6ab1a), W(0x00008fa7e52d3e91), W(0x00008db13170dff6),
+     W(0x0000d0941057e8a3)},
+    {W(0x0000cf9c192ef51d), W(0x00001be5f8618eb1), W(0x0000c3bc0c90b327),
+     W(0x0000bc7fd69227fb)},
+    0
+  },
+  {
+    {W(0x00004cec503236a6), W(0x0000de7f6c240cee), W(0x00005629de0d150e),
+     W(0x00009e0bf1d5434f)},
+    {W(0x0000f2b9a3cd7af3), W(0x00008308e0fd15d6), W(0x00009ce3e21b59ad),
+     W(0x0000c83127b0ec31)},
+    0
+  },
+  {
+    {W(0x000099ff027ea235), W(0x0000bdc19f35302c), W(0x00007b90b8867b4a),
+     W(0x0000447e0ac8dc48)},
+    {W(0x0000033b740db541), W(0x0000868e4e2f01eb), W(0x000042c1cd5b9166),
+     W(0x000048adac71d3e8)},
+    0
+  },
+  {
+    {W(0x000086347019e3d7), W(0x000066330bf10a47), W(0x0000f4fb1447c535),
+     W(0x000056d8af508f83)},
+    {W(0x00008429916d8944), W(0x000040d064324b5b), W(0x0000561174d1720e),
+     W(0x0000f400cf655e8c)},
+    0
+  },
+  {
+    {W(0x0000402347681f06), W(0x000044acc76b5265), W(0x0000817120769813),
+     W(0x00005430ec4cd7a8)},
+    {W(0x00008d366f65e23b), W(0x000000b589753e67), W(0x00008e17f1453a15),
+     W(0x00002a8d3e169095)},
+    0
+  },
+  {
+    {W(0x0000dbf6f0c08780), W(0x00005485a8e27750), W(0x000003496bd555f2),
+     W(0x00008be9c3627ec2)},
+    {W(0x00004d4630f3a4a8), W(0x00000c4b3670d76a), W(0x00009c0bacd3a11b),
+     W(0x0000d99433e02614)},
+    0
+  },
+  {
+    {W(0x0000557cdd99b0e8), W(0x0000eec043fa551a), W(0x00007ad2b42f7a51),
+     W(0x000010785a169cdf)},
+    {W(0x00001ad3897ef119), W(0x00001245c46f8379), W(0x0000d38701af310b),
+     W(0x0000e20ffb3134e2)},
+    0
+  },
+  {
+    {W(0x00000ab7e791ac85), W(0x000059abb395fed7), W(0x0000fe4b9472eaa6),
+     W(0x0000913f06b9f3ce)},
+    {W(0x00007802f1f9fe22), W(0x0000086d608fa44e), W(0x0000eb8187d97ce9),
+     W(0x00006a4babfd8c8c)},
+    0
+  },
+  {
+    {W(0x00004bae50d1c9fa), W(0x00001e4cab81f8bc), W(0x000005031f1e3a3e),
+     W(0x00001a4a762652f6)},
+    {W(0x0000738906676fcd), W(0x0000ede9b51022da), W(0x0000f5d6e7d453b4),
+     W(0x00007f2c07e23d95)},
+    0
+  },
+  {
+    {W(0x0000416473d34161), W(0x0000b790b6633236), W(0x0000edc969424f5b),
+     W(0x0000b87e1e0d814e)},
+    {W(0x0000a74d45219ea9), W(0x000001f0234087b4), W(0x00006cc1b6a1b088),
+     W(0x0000ed99a7d1f5b2)},
+    0
+  },
+  {
+    {W(0x0000b25f64485880), W(0x0000d371d3666c97), W(0x0000121a8c06634b),
+     W(0x00009689b4c61316)},
+    {W(0x000035f678f252c7), W(0x0000276fdf10e44c), W(0x0000d989392162c0),
+     W(0x000009a80a797b59)},
+    0
+  },
+  {
+    {W(0x0000776d04a7c4dd), W(0x0000b57390339de3), W(0x000094e9c819c538),
+     W(0x0000899dcb3bb3ff)},
+    {W(0x000029f1bc548a8c), W(0x000092d0146a4198), W(0x0000bae9bc0dcddc),
+     W(0x0000ddb5344b02d5)},
+    0
+  },
+  {
+    {W(0x000043a67732ceb5), W(0x0000d50aea616b01), W(0x0000c2d81787f8b3),
+     W(0x0000b3fec07aa99b)},
+    {W(0x00008c317919de92), W(0x000057acfffa5d1b), W(0x0000e7ea66831d17),
+     W(0x00006c0e82cbc12c)},
+    0
+  },
+  {
+    {W(0x0000c82622014e34), W(0x0000b80955236fa0), W(0x00007abce8058302),
+     W(0x00007b66ad440d85)},
+    {W(0x0000315dd054edb6), W(0x0000b2e62921a34f), W(0x000081554010520c),
+     W(0x000068251c511b30)},
+    0
+  },
+  {
+    {W(0x0000a7acfe4b6e90), W(0x000014e2e954feda), W(0x0000ca6de7e61c9d),
+     W(0x00008e9680ebc29d)},
+    {W(0x000073b0272842f5), W(0x00000ba63d6635ba), W(0x000016d0c8e0a12a),
+     W(0x000097a584d4603f)},
+    0
+  },
+  {
+    {W(0x0000ca34d491da65), W(0x0000f04ad9d547a4), W(0x00006dc23be2e675),
+     W(0x0000668e97d776a1)},
+    {W(0x0000bc6b0420c860), W(0x0000a86bf4f2f516), W(0x0000375de23956e4),
+     W(0x0000a8db0543b89c)},
+    0
+  },
+  {
+    {W(0x00003cead4c89287), W(0x00005a1c7a4bd826), W(0x00003599eab2f807),
+     W(0x000080c45a99fc85)},
+    {W(0x000020bc04989555), W(0x0000d454a9688395), W(0x000087cd4bccc55b),
+     W(0x00005f315e0a0489)},
+    0
+  },
+  {
+    {W(0x000039b031abf342), W(0x00001475c21da4bf), W(0x00003193fbc42d62),
+     W(0x00004fe33428de84)},
+    {W(0x00006aa1957ad5db), W(0x00007b9f54969f2c), W(0x00006dbcd8138624),
+     W(0x000039e2484f22cf)},
+    0
+  },
+  {
+    {W(0x0000bacb65194df2), W(0x0000b0ef1e59a2a8), W(0x00005a85ed52e2cf),
+     W(0x0000e257334cf224)},
+    {W(0x00007c8f09491d31), W(0x0000f021f1b2f0a4), W(0x00009e3d08b45f87),
+     W(0x000064576f65a461)},
+    0
+  },
+  {
+    {W(0x000060970fbbe0ee), W(0x0000dbdf4db89417), W(0x0000c884aeee3195),
+     W(0x000021b32c4d6b86)},
+    {W(0x0000f8e89711b1e0), W(0x0000a680fecdadc9), W(0x00005fb404b12512),
+     W(0x00003e368609c78e)},
+    0
+  },
+  {
+    {W(0x0000af82e416f3d0), W(0x0000531a003ea238), W(0x0000db083bc82f6a),
+     W(0x0000cd13c385dc1e)},
+    {W(0x0000cad4f512fb2c), W(0x0000ab89a1feb927), W(0x00007d298f3dfae6),
+     W(0x00008a10a73e8b16)},
+    0
+  },
+  {
+    {W(0x00006dc98cb3d82e), W(0x00001f4238f06597), W(0x000018cc4b69c147),
+     W(0x000099be2520dc75)},
+    {W(0x0000a0c594f16a07), W(0x0000abcb7527b132), W(0x00001d250e841356),
+     W(0x0000a1f28718b1aa)},
+    0
+  },
+  {
+    {W(0x0000c737c0da8329), W(0x00009bef754f14c1), W(0x00005a90c0309a87),
+     W(0x00007a2c6d1292dd)},
+    {W(0x0000c9d5f94edc25), W(0x0000199d2ece1d0d), W(0x000063fe6e13b5ce),
+     W(0x0000a9cc7e3afe0c)},
+    0
+  },
+  {
+    {W(0x00008c9c4fc05ac6), W(0x000028e44876fffa), W(0x00005596d1f5d941),
+     W(0x00000f4f34917e6d)},
+    {W(0x0000b880e2c69aab), W(0x0000e9eb8508db66), W(0x00008be440ba63b3),
+     W(0x000049582460ba9f)},
+    0
+  },
+  {
+    {W(0x00004ee8061674d6), W(0x0000ba0c203bb0de), W(0x0000d016d74db95e),
+     W(0x000004c93bb39d74)},
+    {W(0x000070808425c612), W(0x00002c4c35252abd), W(0x0000aa158bae8f16),
+     W(0x000015ea92b1f3ed)},
+    0
+  },
+  {
+    {W(0x000079e9b9b49e4d), W(0x0000457ff3d9c336), W(0x000098411d62345b),
+     W(0x000062ef71e48f34)},
+    {W(0x0000e5e142c90a44), W(0x0000b81fbb45f98b), W(0x0000c60573a2254b),
+     W(0x0000fbbd71dd4746)},
+    0
+  },
+  {
+    {W(0x000056fdc5d75764), W(0x0000feafaae85d5a), W(0x0000893c1deac689),
+     W(0x000034891ce864b8)},
+    {W(0x000044b95d68e69d), W(0x000016232fbc728e), W(0x0000b942da298cb8),
+     W(0x000043a999dadc9b)},
+    0
+  },
+  {
+    {W(0x0000c1e0a9134f03), W(0x000097675ea79871), W(0x00001301f8280c6c),
+     W(0x000036b62bc5a095)},
+    {W(0x00007787c58696ae), W(0x0000bb1ea879a96b), W(0x000051601340569b),
+     W(0x0000329ea3c6a0a8)},
+    0
+  },
+  {
+    {W(0x0000aaa2f33d97d0), W(0x0000ae2e86708edc), W(0x0000d5a87475e04f),
+     W(0x00001c142c97c6cd)},
+    {W(0x0000827109c02b69), W(0x000031d2d72f6774), W(0x0000bb2e8d4163c1),
+     W(0x000067793727b60f)},
+    0
+  },
+  {
+    {W(0x00004e7a6ebb8336), W(0x00007d9b70eefeb7), W(0x00007aeec3f8aa14),
+     W(0x0000c84020876c69)},
+    {W(0x000054cefb917206), W(0x000011fc862d869e), W(0x0000dc031e16a281),
+     W(0x0000be7dfa62ce98)},
+    0
+  },
+  {
+    {W(0x0000aaf2c2991a19), W(0x0000e220649abab6), W(0x0000ffaffa363109),
+     W(0x0000fe8b973ab467)},
+    {W(0x0000b0d54a1387ee), W(0x000086b1ff5adeb7), W(0x0000329bc04c62f7),
+     W(0x000060e8942a529d)},
+    0
+  },
+  {
+    {W(0x0000c155a12e8ed8), W(0x0000c39d9aa993da), W(0x0000a976d7429a00),
+     W(0x0000a60dbd08e61e)},
+    {W(0x0000bba745856675), W(0x0000b2ba63448ff4), W(0x000066e7b37ac3aa),
+     W(0x0000d4115e1f4ed4)},
+    0
+  },
+  {
+    {W(0x0000c6bd430935c9), W(0x0000f2faec77fb55), W(0x0000f68b4c108f93),
+     W(0x00004d695d4988f4)},
+    {W(0x00003e1bc73d3958), W(0x0000e2e63cf15370), W(0x0000162d2075b1ff),
+     W(0x0000b50669f145df)},
+    0
+  },
+  {
+    {W(0x00006a1a522a5c79), W(0x0000546d98087d67), W(0x00001a70333f317b),
+     W(0x000062a5492abf0b)},
+    {W(0x0000dce0dde57c60), W(0x000095183fa8c7b0), W(0x0000f845508dcde9),
+     W(0x00008b32384f4e4c)},
+    0
+  },
+  {
+    {W(0x0000863f3b1694a7), W(0x0000494a966594a0), W(0x0000c3c5454e708e),
+     W(0x00003fe0068ba0d4)},
+    {W(0x00006e22e3c943c5), W(0x0000e777a3e0871d), W(0x0000770fef3a78f9),
+     W(0x0000eb1646a29177)},
+    0
+  },
+  {
+    {W(0x0000078871170284), W(0x00005238dd29e203), W(0x0000b0cf0ef6cb20),
+     W(0x00004af58a9ec9c6)},
+    {W(0x0000195e34332c9a), W(0x0000c482eb187cda), W(0x00009f941b4a8449),
+     W(0x0000689e0537b141)},
+    0
+  },
+  {
+    {W(0x000076aba80b7dce), W(0x0000b36a61a30d54), W(0x00007d9296e96e8d),
+     W(0x00008d1bfacfd227)},
+    {W(0x00004f4f817fac2b), W(0x0000410c970033ef), W(0x000084c261527dd1),
+     W(0x00002fbd2513e9ff)},
+    0
+  },
+  {
+    {W(0x0000c513e6a55801), W(0x0000345f1f14c3e0), W(0x00000df92a8aa165),
+     W(0x0000117eb7d98a1e)},
+    {W(0x0000ac9f0f6cb11d), W(0x00004ce154e47890), W(0x000085289987bd1f),
+     W(0x000002d0e991747f)},
+    0
+  },
+  {
+    {W(0x000088f1de735965), W(0x0000554c098c333a), W(0x000056b6129b5a35),
+     W(0x0000a449686a565d)},
+    {W(0x0000a29c78600ee8), W(0x000073d75d69fcb4), W(0x00000c0bda37e732),
+     W(0x0000a266ce0fbc4c)},
+    0
+  },
+  {
+    {W(0x00005e9f82645e19), W(0x000024b861d85c49), W(0x0000673ae1375457),
+     W(0x00000b460ddb6cf1)},
+    {W(0x0000c604de4512ab), W(0x00003819777b8fe6), W(0x00009730c334f7c3),
+     W(0x00008e70c9d397a4)},
+    0
+  },
+  {
+    {W(0x000051d4c5d2c4e3), W(0x0000e25ee842d3f4), W(0x00003931923f201f),
+     W(0x00009ba26094ed1c)},
+    {W(0x00002012a4012db2), W(0x000078161aaabbf0), W(0x000069dc14719c11),
+     W(0x00000bb610888c43)},
+    0
+  },
+  {
+    {W(0x0000d2a57f1eccd7), W(0x0000f4c209750dd6), W(0x00009d2841a89afc),
+     W(0x0000b24666630038)},
+    {W(0x0000e06e04c0ae5a), W(0x0000891b82f12171), W(0x00006822aff12d09),
+     W(0x00006e0e71432ffa)},
+    0
+  },
+  {
+    {W(0x0000bcb8d7beb961), W(0x0000131ed970a9e2), W(0x00006296209d1dde),
+     W(0x00006eff60c93530)},
+    {W(0x00004f37b49e4c3c), W(0x00004d0da98a669b), W(0x000007c01f18b092),
+     W(0x00009879d7db3b79)},
+    0
+  },
+  {
+    {W(0x0000f0af898fd9f1), W(0x00004fe0f91cb9d6), W(0x000041970adfd0e5),
+     W(0x0000b6fb0cb5d596)},
+    {W(0x0000a382b6d76673), W(0x0000112e91ff5f31), W(0x000046276edb2d52),
+     W(0x000045f5d1f799f9)},
+    0
+  },
+  {
+    {W(0x0000125abed8a42a), W(0x00003d04626cc202), W(0x0000c7a0ee0b2b25),
+     W(0x0000d1ea74787122)},
+    {W(0x00002172bc5b9d3e), W(0x000089b3c22139f2), W(0x00000b327f758c63),
+     W(0x0000821519501501)},
+    0
+  },
+  {
+    {W(0x000031a3c4a642f9), W(0x0000325cf5673a8c), W(0x0000dd75cac7fcb4),
+     W(0x000055dff7e9334b)},
+    {W(0x00004c0c3c280153), W(0x0000e8e523ee96a0), W(0x0000be7efc7f4e17),
+     W(0x0000bd3c8bfb38a5)},
+    0
+  },
+  {
+    {W(0x0000e548eb7de873), W(0x00004dcbc6bcdc8e), W(0x0000ac97e47542b4),
+     W(0x00003d2a4520879f)},
+    {W(0x0000d3c73145f548), W(0x00001c8fca54497d), W(0x00002e32c6118f47),
+     W(0x00009465a5d388ca)},
+    0
+  },
+  {
+    {W(0x000048f1aa840d60), W(0x000012754cef2572), W(0x000000fca2d29a5d),
+     W(0x000071a00e50f6ba)},
+    {W(0x00004661c9136cab), W(0x0000d58a03ff66fd), W(0x0000db3d18abd53c),
+     W(0x0000799cb89c959e)},
+    0
+  },
+  {
+    {W(0x00006c8fd5ebba48), W(0x00007a725dc55938), W(0x00004508d65b8363),
+     W(0x00000cb88c015f84)},
+    {W(0x000065505e6fc0bc), W(0x000064e89240c167), W(0x000009a871586797),
+     W(0x000087ba14a99907)},
+    0
+  },
+  {
+    {W(0x0000e858fb93d138), W(0x0000be868d5ac5b5), W(0x000024934455c46d),
+     W(0x00000f7d1549c808)},
+    {W(0x0000dce3b48e81c0), W(0x000015cd890ce08b), W(0x0000814a6dcaa671),
+     W(0x0000ea0000538528)},
+    0
+  },
+  {
+    {W(0x00005191533a3360), W(0x0000383abab57e45), W(0x00006dbeb3d6f826),
+     W(0x000055c4e6766484)},
+    {W(0x00003968d7fc4fc8), W(0x0000184b1776a23d), W(0x0000b4d26f6a4c0a),
+     W(0x0000e345b9bac912)},
+    0
+  },
+  {
+    {W(0x00006515bcb69fe3), W(0x0000b575ef1b0079), W(0x0000ad7ce24a29f3),
+     W(0x00000906d175f435)},
+    {W(0x0000be1202799492), W(0x000040240fe13453), W(0x0000662e082e95e3),
+     W(0x000024684aadabef)},
+    0
+  },
+  {
+    {W(0x0000b8d39d85223d), W(0x0000fe9bde87f8eb), W(0x0000d8dc481cd17c),
+     W(0x0000c11532044ca5)},
+    {W(0x000012d1780269a4), W(0x0000a291fd3bfed8), W(0x0000a22b90620099),
+     W(0x000059694b6e843a)},
+    0
+  },
+  {
+    {W(0x00005040f98c9508), W(0x0000c5ddc52eaa51), W(0x00000aa822df87b8),
+     W(0x0000866cf20f930a)},
+    {W(0x00000eb00cb85de5), W(0x0000762f89abd117), W(0x00002125e4b9e6eb),
+     W(0x00009c568c8fc44d)},
+    0
+  },
+  {
+    {W(0x000003d4b4d47438), W(0x00009bd647a65bfc), W(0x0000f79f11f0f07d),
+     W(0x00008e421685b794)},
+    {W(0x00008c7266536b91), W(0x000059ded7795725), W(0x00000ace9523ce60),
+     W(0x00000cdbbb9e8307)},
+    0
+  },
+  {
+    {W(0x0000eebcfd522dc9), W(0x00001ddc75321ce2), W(0x0000d1e7b4f37edf),
+     W(0x000077e6e9595739)},
+    {W(0x0000c175b3f315b0), W(0x00006ce9fa396f60), W(0x0000ab783a01fac2),
+     W(0x0000558ed3e42f07)},
+    0
+  },
+  {
+    {W(0x0000cc15a91d597b), W(0x0000f93f403c0791), W(0x00006f31bdf48bc3),
+     W(0x00006532b1433411)},
+    {W(0x00000dc0f959dcd2), W(0x00004cae0a17325b), W(0x00005a4471343fd3),
+     W(0x00001f8b64c10f86)},
+    0
+  },
+  {
+    {W(0x0000989c4bff9d7f), W(0x0000d3d2e3b114bd), W(0x0000b87d65431ee0),
+     W(0x00008e6cea390f23)},
+    {W(0x00006780cf77cb57), W(0x000011553f5637fe), W(0x0000cbb264f35ed8),
+     W(0x0000e2aa4d7de4c2)},
+    0
+  },
+  {
+    {W(0x0000de3663dbb375), W(0x000067a316271975), W(0x00003d61a69b24dd),
+     W(0x0000ad635b43d5c9)},
+    {W(0x0000adc57cc57463), W(0x0000c7a1ba76bccd), W(0x00004b6e595e8eb0),
+     W(0x0000e17b874227ff)},
+    0
+  },
+  {
+    {W(0x0000833d2b2fdb6e), W(0x0000bd49575c0b42), W(0x00004fe1dd925e7a),
+     W(0x00004e4df17c428e)},
+    {W(0x00006ba471d1fe16), W(0x0000bf04ac291807), W(0x00004bf60c4aefb8),
+     W(0x00003bc0d0d38058)},
+    0
+  },
+  {
+    {W(0x0000763854679737), W(0x0000ae71eab9ceef), W(0x0000d7abdee50066),
+     W(0x0000aca369c19b77)},
+    {W(0x0000ae4b5a94decc), W(0x00004766f6818819), W(0x00004126cf5044d6),
+     W(0x000099bbb04f0f9c)},
+    0
+  },
+  {
+    {W(0x00009fcf821ec388), W(0x0000ae386e78ec01), W(0x00001c7996b19bca),
+     W(0x0000aa1060a5e452)},
+    {W(0x0000f085c8548bb8), W(0x0000a36aa3fee06a), W(0x00007b1bd6c3a8a2),
+     W(0x000015c7b7e32124)},
+    0
+  },
+  {
+    {W(0x00000ea0000b5a3e), W(0x0000b03d436c5184), W(0x0000433a6ddc5ee4),
+     W(0x00003b832f65b0f6)},
+    {W(0x00007f31d50c4e46), W(0x00002ddf2749e22a), W(0x00001d1646c8c973),
+     W(0x000053951977a727)},
+    0
+  },
+  {
+    {W(0x00002c7646ff1cf7), W(0x0000d360a2c545fa), W(0x0000d7ce851e9daa),
+     W(0x00002769a0783f7c)},
+    {W(0x0000a0dd89348bbe), W(0x000045741495bd02), W(0x00004ce5a9fd9342),
+     W(0x000038c5c5522234)},
+    0
+  },
+  {
+    {W(0x00007a09f87c24e8), W(0x000026d20d0ac142), W(0x00004fe9882e2ca2),
+     W(0x00004385c203b45e)},
+    {W(0x00007de1a74000db), W(0x00004b8c862aec7f), W(0x0000a02a093f2669),
+     W(0x000035efb0de87fb)},
+    0
+  },
+  {
+    {W(0x0000e0f31379b581), W(0x0000b706ef83cf5d), W(0x000082d2ee737729),
+     W(0x0000e47af79698b4)},
+    {W(0x0000536a82c927b5), W(0x0000b416d0c5642b), W(0x0000fb2a7088349a),
+     W(0x00002f8d24738846)},
+    0
+  },
+  {
+    {W(0x00007472d3d1f459), W(0x00007efb6f8fe892), W(0x00007dabb9d89a7a),
+     W(0x00003a6221d0e3a2)},
+    {W(0x0000c0520e5d47dd), W(0x0000200e36da0b83), W(0x0000917c91e01cc5),
+     W(0x0000bb5848885573)},
+    0
+  },
+  {
+    {W(0x0000c4bef324e554), W(0x00004e524bab47e5), W(0x000013438a86a166),
+     W(0x0000705261e758c4)},
+    {W(0x00008d2fdb28c244), W(0x0000d907cb091004), W(0x0000919153e80dae),
+     W(0x00002fd915b8fa74)},
+    0
+  },
+  {
+    {W(0x000089b5f0fa853c), W(0x0000785b4873e2fb), W(0x0000bdd0be014bf6),
+     W(0x0000cfc4da9a7942)},
+    {W(0x0000f9ba36db2c30), W(0x0000d61bc488f782), W(0x00008ab351b9ec49),
+     W(0x0000947b985baa58)},
+    0
+  },
+  {
+    {W(0x0000c8f562edfdd8), W(0x000043a1cb2d38c2), W(0x000062c91c9e77d4),
+     W(0x000082571f9a117f)},
+    {W(0x0000197747e5c4e6), W(0x000071049c1703e4), W(0x000059d4e42f18a4),
+     W(0x000085f1a1615f26)},
+    0
+  },
+  {
+    {W(0x0000cb6e80fa1c46), W(0x0000438c4e149abb), W(0x0000273954e217d1),
+     W(0x0000549e3a86c641)},
+    {W(0x0000a6e2fb0ff08e), W(0x00006208d398f507), W(0x0000a8fef196ef94),
+     W(0x000043f7bf3b6c96)},
+    0
+  },
+  {
+    {W(0x0000f61e09f00f74), W(0x0000d0b037b92a3e), W(0x0000c23c857ba2c4),
+     W(0x00008d201f64cc7e)},
+    {W(0x0000720b58c41629), W(0x0000b70e26e2ca4e), W(0x0000acda357afbe2),
+     W(0x00004079755e2f03)},
+    0
+  },
+  {
+    {W(0x00009a175d854b19), W(0x00003c4883c19dce), W(0x000076bccc024b1d),
+     W(0x0000e342299978f6)},
+    {W(0x0000e7db2339107c), W(0x000054d51dbb6f90), W(0x00001d40f052064c),
+     W(0x0000202db7f3d6d6)},
+    0
+  },
+  {
+    {W(0x000085663da20e3f), W(0x00005043b611d92b), W(0x00002eed43530f5e),
+     W(0x00003afb65febcfb)},
+    {W(0x000081b6c44c2054), W(0x0000e18485dbf5e0), W(0x0000407e863cb14f),
+     W(0x0000e8b1afc3ad03)},
+    0
+  },
+  {
+    {W(0x0000356d0ab423fe), W(0x000011c5b9f01530), W(0x0000f95f43b1bd2a),
+     W(0x000012cbe87242e9)},
+    {W(0x0000bd683e2c59c9), W(0x0000b3708d9502a9), W(0x00000e8cc3b23ffe),
+     W(0x000027618e0e1c62)},
+    0
+  },
+  {
+    {W(0x0000eb67b3712b00), W(0x0000ecaa3443b40b), W(0x0000cd5ed52a1048),
+     W(0x00002bcfb13823b2)},
+    {W(0x00006346ec9def29), W(0x0000625947243afe), W(0x00002348102cb7f7),
+     W(0x000019237f7ce2d5)},
+    0
+  },
+  {
+    {W(0x0000fb81ced418d1), W(0x00001c06e3987b18), W(0x000009bada1ca26a),
+     W(0x0000f16e71b99430)},
+    {W(0x0000b4bb626c3cbb), W(0x0000ca584ad735d1), W(0x0000f70ac30a7e0f),
+     W(0x00000d3500f7c428)},
+    0
+  },
+  {
+    {W(0x0000ecfa37b1280c), W(0x000076c6b1f19224), W(0x0000b111adfaf516),
+     W(0x0000f00888c11cb5)},
+    {W(0x000099c3349b2490), W(0x0000dfdbd65c0371), W(0x0000bb8851d1eb5f),
+     W(0x0000f48f44fee553)},
+    0
+  },
+  {
+    {W(0x0000628ae4f698a5), W(0x0000aa916fd02486), W(0x00003e9293e44821),
+     W(0x00007052d78ace88)},
+    {W(0x000007304a2f2dab), W(0x0000d425b3dddd96), W(0x0000f1d1a2197757),
+     W(0x0000c6d5f1dc3d9e)},
+    0
+  },
+  {
+    {W(0x0000f1739ae29d67), W(0x0000ee086611681d), W(0x0000160ca3e975fd),
+     W(0x000067a603321473)},
+    {W(0x0000a776d2edd2b3), W(0x0000dde8f71c9b14), W(0x0000f995029d0a9c),
+     W(0x0000ca12dd153ed7)},
+    0
+  },
+  {
+    {W(0x0000f4f6510c1276), W(0x0000b4aac4826d04), W(0x00005beafba6384c),
+     W(0x0000cd3607cfd101)},
+    {W(0x0000fef2c04c0182), W(0x000070afc448fd1e), W(0x0000a1ff0a990697),
+     W(0x000087681c3b8875)},
+    0
+  },
+  {
+    {W(0x0000c0353f7095c5), W(0x0000c7eeea48fd5b), W(0x0000caaf6476316e),
+     W(0x0000f0f10f0293bd)},
+    {W(0x0000bdd8f4ae4684), W(0x0000e20f0bb7c322), W(0x00002e09dcadb6cb),
+     W(0x00001bfa46493e81)},
+    0
+  },
+  {
+    {W(0x0000e2c6426f3115), W(0x000006f296e36b91), W(0x0000afaa5f5c2cca),
+     W(0x0000f3a251ac9e9a)},
+    {W(0x000042f220e1ccb8), W(0x00004fa06861869e), W(0x000052528812f092),
+     W(0x000016b38639d025)},
+    0
+  },
+  {
+    {W(0x0000520361f570b9), W(0x0000cd7f99bc57ae), W(0x0000d455e2529898),
+     W(0x00008fcd9ebd4f19)},
+    {W(0x0000aaf8d44a141e), W(0x0000feb458719247), W(0x00008d00023ecc75),
+     W(0x0000978f3dca4677)},
+    0
+  },
+  {
+    {W(0x00002400dcb16f73), W(0x00000e1ff03c46bc), W(0x000022df0da2652d),
+     W(0x00003f5019b49d54)},
+    {W(0x0000b32807a73776), W(0x00003ce17b292a38), W(0x00008c52302824a1),
+     W(0x00007ed330600489)},
+    0
+  },
+  {
+    {W(0x000038d01ba77933), W(0x000071a1b7187ef9), W(0x0000091931f282c8),
+     W(0x0000fe7c93c1a1f4)},
+    {W(0x0000639bdab1b0a1), W(0x000012b0abf5f3d5), W(0x000076d1bb928d46),
+     W(0x000079ba017f0c19)},
+    0
+  },
+  {
+    {W(0x0000a9d65ce0e5a6), W(0x0000809aa7e6ebc5), W(0x00007846756b0e33),
+     W(0x0000e1bc6cf65b5b)},
+    {W(0x0000e20922ba4385), W(0x0000e38daa7166e4), W(0x000069f25189acbf),
+     W(0x0000c84541ed8217)},
+    0
+  },
+  {
+    {W(0x0000d756c4f40ca6), W(0x00000c2933435c77), W(0x000010844f8eeb32),
+     W(0x00008e75e6aebe61)},
+    {W(0x0000b1efc5d1dfb9), W(0x0000e6ffb063bbec), W(0x00001ca81ca4d826),
+     W(0x0000943750969d4b)},
+    0
+  },
+  {
+    {W(0x00009aaf642e578e), W(0x00000580c278c072), W(0x0000b6f46d41b632),
+     W(0x00009a7570150e64)},
+    {W(0x00001402d0b325f4), W(0x00001d9fe575039a), W(0x0000a553254986a6),
+     W(0x00002172f46a7e1b)},
+    0
+  },
+  {
+    {W(0x000035bdc1c9d428), W(0x0000fc9f376b75ae), W(0x000039c06baf659c),
+     W(0x0000a0744bed8f79)},
+    {W(0x00001cb8080e2b9f), W(0x0000ce29c3b78e5a), W(0x000049809a82ccd2),
+     W(0x0000f49a6a9f7e59)},
+    0
+  },
+  {
+    {W(0x0000f836e71b79d7), W(0x0000c8175da5ffe6), W(0x0000fe7ba1e5d038),
+     W(0x000055f6fc4e77ff)},
+    {W(0x00007a5b7c5707e3), W(0x0000869be5a4bf5c), W(0x00000d8b777db75e),
+     W(0x0000e9b09d9faca8)},
+    0
+  },
+  {
+    {W(0x00001c5135356364), W(0x0000dfc5a33e4cae), W(0x0000492055e5ba59),
+     W(0x0000dd7973cefcc4)},
+    {W(0x0000a04c2fb6b718), W(0x0000ea1544b9e010), W(0x00009da3f4deea6d),
+     W(0x000092745ff3baf1)},
+    0
+  },
+  {
+    {W(0x0000318edab75f32), W(0x0000206d70209ef7), W(0x0000487dc2b9e0f0),
+     W(0x0000dab21fe6d35d)},
+    {W(0x0000fc88f6d0f9fa), W(0x000045c8d75b672a), W(0x0000add5a67c6e1a),
+     W(0x0000e421dea58f61)},
+    0
+  },
+  {
+    {W(0x00005aede2603ea5), W(0x0000e0715624bc33), W(0x000071686a9813f3),
+     W(0x0000087c83b45f39)},
+    {W(0x000003c47da3c2c5), W(0x00001e3e68a1e9eb), W(0x00006049d0d43fbf),
+     W(0x00002497f4a750f5)},
+    0
+  },
+  {
+    {W(0x00000c6106af745a), W(0x0000a3faf35b7769), W(0x0000ae6f63b78346),
+     W(0x00003bf7ce9824cb)},
+    {W(0x00003b621372d165), W(0x000032cc080dc805), W(0x0000a0e8e80669b7),
+     W(0x000056625fbf27d4)},
+    0
+  },
+  {
+    {W(0x000069a8de555d7a), W(0x000065941f54ca46), W(0x00008e5e784d477d),
+     W(0x0000f9e83a219d88)},
+    {W(0x00006a55cae9f6ef), W(0x0000aae5dd8468c4), W(0x0000b871abb55185),
+     W(0x0000d7ad02a525ae)},
+    0
+  },
+  {
+    {W(0x0000da0584e3e22e), W(0x000062d8d463db48), W(0x00009ceaf3231442),
+     W(0x0000c4f8d3dc553f)},
+    {W(0x0000fa3699cd4dca), W(0x000085b0d53f912b), W(0x00004ebaeccf9c37),
+     W(0x0000cb9475b78422)},
+    0
+  },
+  {
+    {W(0x000025046b3040e5), W(0x00009d6be4a8a0de), W(0x000041a9d23ec593),
+     W(0x0000e4a47c5e47db)},
+    {W(0x000017167d9b1213), W(0x00004175d786cf56), W(0x00003844febbbb0a),
+     W(0x000050e90a694945)},
+    0
+  },
+  {
+    {W(0x0000faf1da4fd3d5), W(0x0000c6b050281fa1), W(0x00007a15aab6ae04),
+     W(0x0000223871b9b915)},
+    {W(0x00008f11e3f28f5f), W(0x000024a26b72f6e3), W(0x0000d17dd0e451f2),
+     W(0x0000f4607ed0b846)},
+    0
+  },
+  {
+    {W(0x00005e2816e9c6c4), W(0x0000ca1a0a324dab), W(0x00006ec13c6850db),
+     W(0x0000160746d41a6a)},
+    {W(0x0000a3d1c55f00b5), W(0x00002f19967595a4), W(0x0000d5aef51fd24c),
+     W(0x0000acef6f584911)},
+    0
+  },
+  {
+    {W(0x00007b1f770fe6be), W(0x000012218cec2e3e), W(0x00007b59e3f9505c),
+     W(0x0000e66d61c1405f)},
+    {W(0x000015267d5f8e15), W(0x00009308c439ad27), W(0x00001b5352811307),
+     W(0x0000467f6e6ef0d4)},
+    0
+  },
+  {
+    {W(0x00008457b8e515de), W(0x0000261482d8a18e), W(0x0000859a9042a55c),
+     W(0x0000398c193d2683)},
+    {W(0x0000d013cb6654f5), W(0x0000ed0ff93f6e92), W(0x00003735c08937b0),
+     W(0x000001d3ba40a925)},
+    0
+  },
+  {
+    {W(0x00002277f40f102b), W(0x0000978c96690f98), W(0x0000d2b1a2914cc6),
+     W(0x0000f354e4caee56)},
+    {W(0x0000b3320eb09565), W(0x00001f2b66fd382b), W(0x0000dfa3a7181e69),
+     W(0x00002dbdb684ea59)},
+    0
+  },
+  {
+    {W(0x0000d8fe52e6552e), W(0x0000bff5c3d1c31b), W(0x00006a78fa68526e),
+     W(0x0000e73715452f73)},
+    {W(0x000008e8825915cb), W(0x000079aae016ac1d), W(0x0000cbafec5dfdfe),
+     W(0x0000886412d34e98)},
+    0
+  },
+  {
+    {W(0x000049d7457e25d6), W(0x0000400234a32557), W(0x000038d47fbbe49f),
+     W(0x000047bd4a875fa0)},
+    {W(0x00003506b061ada9), W(0x000058c6cbe6b33a), W(0x0000c1a9c0623967),
+     W(0x00008502aa1f8648)},
+    0
+  },
+  {
+    {W(0x00007cdb2ed6de1c), W(0x000087ca2aaaa036), W(0x00002b4b2f3fdc4f),
+     W(0x0000c3723b2df1bc)},
+    {W(0x0000442f7d7ed3ce), W(0x0000f61548cfd6da), W(0x00000ca4e9bcc42f),
+     W(0x0000589e5737a344)},
+    0
+  },
+  {
+    {W(0x0000a3b5d5a268f8), W(0x000053dad0a2556b), W(0x000027a434184299),
+     W(0x0000877dd628edde)},
+    {W(0x000076a75ef529e3), W(0x0000d8825df88a15), W(0x00003add4959915d),
+     W(0x0000825898fbd0b7)},
+    0
+  },
+  {
+    {W(0x00009f36cb743c68), W(0x00003c04184ce739), W(0x000078ed04dacfde),
+     W(0x0000929aeb37dbd6)},
+    {W(0x00004b42f46b6b78), W(0x0000a2e4abfe519c), W(0x00002325af0af24e),
+     W(0x00000ddb2b9fa394)},
+    0
+  },
+  {
+    {W(0x0000a2322813c102), W(0x00000738fe7214c1), W(0x000062b95d851c40),
+     W(0x0000e9afc1263726)},
+    {W(0x0000eaa6210aa2a2), W(0x00006bce52b72f71), W(0x0000833c6ce2d6e6),
+     W(0x00004631cb433662)},
+    0
+  },
+  {
+    {W(0x00006c3620b1fc2b), W(0x000028e36151ee51), W(0x00007e336b0ae1a6),
+     W(0x0000cd4a22bc6b6c)},
+    {W(0x00004bfc560f3e32), W(0x00002c2d5e581476), W(0x00004ac35d36f599),
+     W(0x0000a796fbeee9df)},
+    0
+  },
+  {
+    {W(0x0000ec86c0cda8e1), W(0x000045e0790ebaf6), W(0x0000e73c8439912b),
+     W(0x00008af43d88613f)},
+    {W(0x00004b03569058fe), W(0x000024a6c9c43042), W(0x00005fe9beed5454),
+     W(0x0000d3ed98ed608e)},
+    0
+  },
+  {
+    {W(0x0000510f251bab0d), W(0x00003a5cb70cc0bb), W(0x00008ce6fb003bf2),
+     W(0x0000bbb7aeb7a348)},
+    {W(0x00007b19ab88c47a), W(0x0000ac7fdbcaf434), W(0x00009ffb86db9c8f),
+     W(0x0000436c3c94691a)},
+    0
+  },
+  {
+    {W(0x00008658cdec3460), W(0x00006c2d6fac189e), W(0x00004e75a989257a),
+     W(0x000040adeb460dfa)},
+    {W(0x0000acfc3d52bf04), W(0x00006ff71a6c0c8b), W(0x0000732a618ecb55),
+     W(0x0000e74c16589c81)},
+    0
+  },
+  {
+    {W(0x0000b98c6655fa12), W(0x0000ecb0e032fb8a), W(0x00008aa8de582f14),
+     W(0x0000f3c31ef27e41)},
+    {W(0x000082284176c3cb), W(0x0000b6f487b26134), W(0x00004e0b3cfde64a),
+     W(0x0000f8f414970742)},
+    0
+  },
+  {
+    {W(0x0000443009ffa964), W(0x000015af2b1254d0), W(0x0000618f5600c5f4),
+     W(0x00004123bb02164a)},
+    {W(0x000096ba5f0a7398), W(0x0000f99b4e4fb9e3), W(0x0000a4075b58be66),
+     W(0x0000223249eb519d)},
+    0
+  },
+  {
+    {W(0x00009ede36485406), W(0x0000c5cc90f928b4), W(0x000017d9b866d0fe),
+     W(0x0000aff5764aedbc)},
+    {W(0x000020632a4eefbc), W(0x000017244e26d6f7), W(0x000089f2b9b30863),
+     W(0x0000659527060a2e)},
+    0
+  },
+  {
+    {W(0x0000ab1934af8200), W(0x0000ca42e035482f), W(0x0000aade33804618),
+     W(0x0000729cd8f0c915)},
+    {W(0x00006f860d3a561c), W(0x0000cc74e2644a65), W(0x0000e03a8b1c60ce),
+     W(0x000029d4bc9424a6)},
+    0
+  },
+  {
+    {W(0x0000ded5444cc0e0), W(0x0000db63af15dfd3), W(0x00001ecbfa628cac),
+     W(0x0000b8c99299fd7d)},
+    {W(0x00000f81609c6778), W(0x0000482d6d38b44d), W(0x000010bf8ebe3c51),
+     W(0x00001bdb95a64431)},
+    0
+  },
+  {
+    {W(0x00000bfc1d4ee383), W(0x000068f549a5a254), W(0x0000a619d83466d4),
+     W(0x0000a525dfbe8f8c)},
+    {W(0x0000718618d24937), W(0x0000ed75433ca1d8), W(0x0000a678a3e9b968),
+     W(0x00004c4bd1143b27)},
+    0
+  },
+  {
+    {W(0x00001d3a96f7dde3), W(0x00003cda872b94b5), W(0x0000a4afba7deaf6),
+     W(0x000072de94ed19c0)},
+    {W(0x000034241adcd1a9), W(0x000092967685c87b), W(0x000039e5fb8cbd62),
+     W(0x0000c534a59bb62b)},
+    0
+  },
+  {
+    {W(0x00007770d78f784f), W(0x00007291993709ed), W(0x00009e3009278ec2),
+     W(0x000069834a60464a)},
+    {W(0x00000f524018bfe1), W(0x000021531f63e0cb), W(0x00000be2914ec39e),
+     W(0x00003489e9eac0f2)},
+    0
+  },
+  {
+    {W(0x00006c7e2ca7a839), W(0x0000efcefd0cd80b), W(0x0000b879bf87eb0c),
+     W(0x0000481e03fae257)},
+    {W(0x00005e0dff072abe), W(0x0000037a3dfa3054), W(0x0000a528cbcec189),
+     W(0x0000ebf153e50415)},
+    0
+  },
+  {
+    {W(0x000043a28ae3f6ac), W(0x000001c8a513f3b0), W(0x000046ff42323218),
+     W(0x00005adf0b2e4db3)},
+    {W(0x0000b696265d2e47), W(0x000060b2ef86abec), W(0x00004b5b45d65665),
+     W(0x000045d6f19423b9)},
+    0
+  },
+  {
+    {W(0x0000ac9547bef8ff), W(0x0000a62a69b0ebf2), W(0x000010e1e70a3cee),
+     W(0x0000a33201786edf)},
+    {W(0x0000f48723c0943d), W(0x00003134c9b86504), W(0x0000e7f68f11a3ad),
+     W(0x000049c96cdb01dd)},
+    0
+  },
+  {
+    {W(0x000046ed640ed68a), W(0x0000265cf00df1a8), W(0x0000804904326379),
+     W(0x0000204f56e27c72)},
+    {W(0x0000df829dca082e), W(0x0000d010c0cce19a), W(0x00002dd0381ec59b),
+     W(0x0000a194459285b2)},
+    0
+  },
+  {
+    {W(0x00002ea1c55f6fcb), W(0x00005fb4c0c30dbe), W(0x0000e7428d025480),
+     W(0x0000689e2b41fff7)},
+    {W(0x0000ea0b19062c46), W(0x0000b57bbbcd67dc), W(0x00001b0358261361),
+     W(0x0000cc464e119b4c)},
+    0
+  },
+  {
+    {W(0x0000f6601b0685d5), W(0x00005af39e499acc), W(0x000016c422ebc061),
+     W(0x00000fecff954475)},
+    {W(0x0000db9c8dd38d68), W(0x0000b8bde3ef6447), W(0x000027dfb239b928),
+     W(0x000067e9b5c157df)},
+    0
+  },
+  {
+    {W(0x00005610e0fe92c9), W(0x0000969aebd21691), W(0x000096833d713c1b),
+     W(0x0000fd713deceb57)},
+    {W(0x000065955b4342c5), W(0x0000e3238849d81a), W(0x0000d53f1db8be37),
+     W(0x00007d165d5db833)},
+    0
+  },
+  {
+    {W(0x0000c1907bdbacca), W(0x0000b52bba9a03c3), W(0x0000f4a3e1a37ff5),
+     W(0x000000a7baed6344)},
+    {W(0x0000d82418b66d58), W(0x00001d23f88f54db), W(0x00005da3dbf05894),
+     W(0x00002608066a34bd)},
+    0
+  },
+  {
+    {W(0x00003df4b0dc5dfb), W(0x00007a38e5a25983), W(0x0000c05c52fdb9ed),
+     W(0x0000f9f617165ce2)},
+    {W(0x00009379adfd8a02), W(0x0000a5ed8b7447a5), W(0x000048ac36ac5139),
+     W(0x000056bcf999337e)},
+    0
+  },
+  {
+    {W(0x0000a974edabe0b0), W(0x0000941fe9ffbe63), W(0x0000f2dbb87d568c),
+     W(0x0000e72d1315f9cf)},
+    {W(0x0000af9b7b8a5fa7), W(0x00009cd81be0c691), W(0x00003dcaa54c56d5),
+     W(0x0000f7d40a3e7005)},
+    0
+  },
+  {
+    {W(0x00002f74cf12bb57), W(0x00007aa17085d7e3), W(0x00000ce668e88069),
+     W(0x00000e255ca590f8)},
+    {W(0x0000c0f9068dc2cc), W(0x000050579894a3a9), W(0x00006b531cab64d9),
+     W(0x00002cd9870b3e4d)},
+    0
+  },
+  {
+    {W(0x00006d5dca7aaa89), W(0x0000f03dfc3f386f), W(0x0000f5eeb84f7d56),
+     W(0x00007b8f3cf84fa8)},
+    {W(0x0000c57596f4bd52), W(0x000013f287d684ee), W(0x0000d2573d93f529),
+     W(0x00009be4d5d57e8b)},
+    0
+  },
+  {
+    {W(0x0000d4f4636e562c), W(0x00004d1a48a790c3), W(0x000053fa559ee320),
+     W(0x000087f300284cc9)},
+    {W(0x000005a15aa86023), W(0x0000bfa6016c4b13), W(0x0000b0fe2f6fb4cf),
+     W(0x00008aaf61b8a803)},
+    0
+  },
+  {
+    {W(0x0000fad62d093d2b), W(0x00002cfce2c9ac6e), W(0x0000266edcf6a833),
+     W(0x000062b7929a40d8)},
+    {W(0x0000beca2e4fc9c3), W(0x000080ee7d455c62), W(0x000048b1b40f8403),
+     W(0x0000264ce9e3e180)},
+    0
+  },
+  {
+    {W(0x000027d903519062), W(0x0000604fee2928cb), W(0x0000fd5a1e08f987),
+     W(0x0000114d8b9975b7)},
+    {W(0x00000fe48b817d8b), W(0x0000eb5fe7a2a654), W(0x00003b345de6c5a5),
+     W(0x000010e4284cdd56)},
+    0
+  },
+  {
+    {W(0x0000e2d253cf8987), W(0x00002a781a373e1c), W(0x00000baaf04336e2),
+     W(0x00006ccf9ab0c8a2)},
+    {W(0x0000c865a41e155d), W(0x0000bce7a9b6cb63), W(0x000010740575d003),
+     W(0x0000430ba93d8318)},
+    0
+  },
+  {
+    {W(0x000091ef601a41f5), W(0x0000394bf4625c63), W(0x000074e80b838497),
+     W(0x000019c88582e315)},
+    {W(0x0000f1b8d53b7728), W(0x0000bf56dff9a03e), W(0x0000b16d9472924d),
+     W(0x00007777673887d6)},
+    0
+  },
+  {
+    {W(0x0000b17ae1dc93b3), W(0x000079be6c30ddbe), W(0x00007172be374498),
+     W(0x0000c52a40d37497)},
+    {W(0x00006f98e9c049b5), W(0x00006b309a27a560), W(0x00000cf7cfbee30a),
+     W(0x0000f93c59ddd0d9)},
+    0
+  },
+  {
+    {W(0x0000e8ace81bd0b8), W(0x000012d8eb59db80), W(0x00000addf5221f20),
+     W(0x0000e6bfdd0e8a90)},
+    {W(0x0000105afad08acf), W(0x0000c1db18b2e28c), W(0x0000e998124b3f0a),
+     W(0x00009f7b95bd5abe)},
+    0
+  },
+  {
+    {W(0x000030b3e8ea85c4), W(0x00008ab4c1581a63), W(0x0000e280eda08897),
+     W(0x000019a8b62b54e3)},
+    {W(0x00006fb0109b1f4a), W(0x000006ffe3813bb3), W(0x000031dc7c0e3996),
+     W(0x0000a08c4d3fb4f9)},
+    0
+  },
+  {
+    {W(0x0000597132b243ea), W(0x00008618e7842f3f), W(0x0000272d8147129a),
+     W(0x0000d31fc7ddfb0a)},
+    {W(0x0000a17d3e6a1e6a), W(0x00002efbbcc65b85), W(0x0000ed0965d3abc8),
+     W(0x0000d679c8898af1)},
+    0
+  },
+  {
+    {W(0x0000295cce152404), W(0x00008d372f08ad07), W(0x00003aed2ab6ef1d),
+     W(0x0000c0a0ddd26702)},
+    {W(0x000023edf309e845), W(0x00002e07e50856a1), W(0x0000e41964062141),
+     W(0x00006e04c75bb1a0)},
+    0
+  },
+  {
+    {W(0x0000a59342784109), W(0x0000622d9838bdeb), W(0x0000bed19f861f42),
+     W(0x00001108a83d95f7)},
+    {W(0x0000704e929c5b11), W(0x0000ffbbf02d17e6), W(0x0000734dbbff2137),
+     W(0x00005144cc4f9007)},
+    0
+  },
+  {
+    {W(0x000007f11680895a), W(0x0000e2be5fe8bc85), W(0x0000eb3ececbc215),
+     W(0x00000733a861140e)},
+    {W(0x0000783b13e7adb4), W(0x0000c5f4922c51be), W(0x000015816125f3bd),
+     W(0x00009efd286020a9)},
+    0
+  },
+  {
+    {W(0x00000acbfcb3ad65), W(0x000000482cd5d3e0), W(0x0000e67d53dd0ea0),
+     W(0x0000b233a70d0452)},
+    {W(0x0000e4c76053e934), W(0x0000169cdf24a34a), W(0x0000cdde1ebf8082),
+     W(0x0000831b286f477a)},
+    0
+  },
+  {
+    {W(0x00001d5aa1e18723), W(0x0000f183d9d91741), W(0x0000f66b96a76d81),
+     W(0x0000680384841623)},
+    {W(0x00004060f60b766e), W(0x000073383ae9a5c2), W(0x0000f6612904337d),
+     W(0x00002a87094df082)},
+    0
+  },
+  {
+    {W(0x0000e231c674c807), W(0x0000b3a25c1a1f8e), W(0x00003724ba66c575),
+     W(0x0000177ab91c944f)},
+    {W(0x000005a9cd329c7a), W(0x0000dd0093e0d46d), W(0x000023745f5778fd),
+     W(0x00002c5a2a7550a0)},
+    0
+  },
+  {
+    {W(0x00006cd44851340c), W(0x000088bb1ce18c3d), W(0x00009cd403ae6519),
+     W(0x0000933fa3048500)},
+    {W(0x0000b33f6ad8a151), W(0x00007dfed5fd06da), W(0x000051bdc5af5aa4),
+     W(0x0000417ffc99d44a)},
+    0
+  },
+  {
+    {W(0x00009e653ee9b458), W(0x0000abb6e8943cbc), W(0x00003609ae0a9e07),
+     W(0x0000eb7e57256c0c)},
+    {W(0x0000556b12d7836b), W(0x000010ca12d1c324), W(0x000049223a19bf1a),
+     W(0x0000fc3fda582686)},
+    0
+  },
+  {
+    {W(0x0000ed323e50393d), W(0x000086e08714b378), W(0x000087dc0163fe7d),
+     W(0x000078855db5fd07)},
+    {W(0x00003d7336d7cc26), W(0x000006262ce4c274), W(0x000046e33a79c82e),
+     W(0x0000859a14109e5e)},
+    0
+  },
+  {
+    {W(0x0000b09fba82d3bc), W(0x00006990a8a0d647), W(0x0000ab4a78c8c3d0),
+     W(0x0000d75cc4feb971)},
+    {W(0x000085ea722c913d), W(0x0000a93624a6da86), W(0x00009f33f92a2eb6),
+     W(0x0000ae35e9be995f)},
+    0
+  },
+  {
+    {W(0x00007aa91542f9e6), W(0x0000bd76823bfcfe), W(0x0000689aad3ca9ef),
+     W(0x000048e2f7705a06)},
+    {W(0x00006bdc53cf7c6a), W(0x000003546863a641), W(0x0000db2970c2fd01),
+     W(0x0000e6aff5c4b795)},
+    0
+  },
+  {
+    {W(0x000099778ffe273b), W(0x00004f1694666069), W(0x00000ab2169b1ef5),
+     W(0x00009353a155a12f)},
+    {W(0x0000552850a00d89), W(0x0000e891b886d812), W(0x00007300370ae5f1),
+     W(0x0000d8b773521cb5)},
+    0
+  },
+  {
+    {W(0x0000423ec1b1b190), W(0x000063c19f0b222c), W(0x0000ce4ece1aff52),
+     W(0x0000be04f4c46132)},
+    {W(0x0000f72e15d05c2e), W(0x0000c580fcd605d3), W(0x00006f5f0b203c1a),
+     W(0x0000bd7db3ca8f00)},
+    0
+  },
+  {
+    {W(0x000091bf260e1ffa), W(0x0000a0f52b0a6851), W(0x0000c5f718d1c462),
+     W(0x00000ffdde596822)},
+    {W(0x0000f9923d3c915f), W(0x0000b7f7ff94da89), W(0x0000499bacb4db6d),
+     W(0x0000e5237d3a3d30)},
+    0
+  },
+  {
+    {W(0x0000fc19e9bf5f50), W(0x0000168fbf8ee983), W(0x0000b26b6ea31c18),
+     W(0x00005ebaa60629f9)},
+    {W(0x00000912edef5f2f), W(0x0000f19d90fc6c42), W(0x0000c64a50d98b55),
+     W(0x0000d7e6383a5233)},
+    0
+  },
+  {
+    {W(0x0000bd920a22d0fd), W(0x000081bb217c963a), W(0x0000c1b702cd83fd),
+     W(0x00008d0a5583b3c6)},
+    {W(0x00004d4b6d8296b8), W(0x000042d0effca2c0), W(0x0000c4d0906f7697),
+     W(0x00002dd904a18390)},
+    0
+  },
+  {
+    {W(0x000028d934eeb45c), W(0x00000495adb1be99), W(0x00004755d6780346),
+     W(0x00005e564132a78a)},
+    {W(0x000011baab92769d), W(0x0000839c89f29154), W(0x000097d930dad5a9),
+     W(0x0000bff944cc6a2f)},
+    0
+  },
+  {
+    {W(0x000005c5f5e147ce), W(0x000070235303b003), W(0x0000ab885393bdcc),
+     W(0x00002a907e520a0c)},
+    {W(0x0000b8ba1ab4fae8), W(0x000044297131b887), W(0x00000cd18fd10473),
+     W(0x00002665854134b1)},
+    0
+  },
+  {
+    {W(0x0000171e44ab15d8), W(0x0000263f240bf988), W(0x00009e61adc3b26d),
+     W(0x0000cc913fedbb5a)},
+    {W(0x00002b91a43c7790), W(0x000034f1ce3946ce), W(0x00009d33ad3bd36f),
+     W(0x00006e54fc2c7e4b)},
+    0
+  },
+  {
+    {W(0x00002469a5a75205), W(0x0000d7ac05cbbcaf), W(0x0000e544a4a002a8),
+     W(0x0000074decbd684d)},
+    {W(0x0000fb69d962349a), W(0x0000fa254104b084), W(0x00000d14cc47f863),
+     W(0x00008d4aa0c7aaba)},
+    0
+  },
+  {
+    {W(0x00003c904f9e7832), W(0x0000e88ff9218b5c), W(0x00009c0c3a39ebe9),
+     W(0x000071a1abb2577d)},
+    {W(0x0000dc6fc3d735d7), W(0x00002390db771312), W(0x0000fb8da3aaf236),
+     W(0x0000cc12d87ba950)},
+    0
+  },
+  {
+    {W(0x00005d73f0507de8), W(0x0000cb10e36838f9), W(0x0000fbaacb0225ac),
+     W(0x0000952bcd582c78)},
+    {W(0x000098158a965a94), W(0x000087bd3ec69aad), W(0x0000e2515db3dc14),
+     W(0x0000582bbe5bdd18)},
+    0
+  },
+  {
+    {W(0x000063a537e57f67), W(0x00007b0750169bdc), W(0x00007a979a119545),
+     W(0x0000c9b26021dd86)},
+    {W(0x0000f77887c7696d), W(0x000091ed76033e08), W(0x0000f7240899f275),
+     W(0x00007f04a924cf03)},
+    0
+  },
+  {
+    {W(0x0000715ad7898148), W(0x000064d8c7e630fa), W(0x000077e526fe0fe6),
+     W(0x000065492a75cf57)},
+    {W(0x00007826a4c3b553), W(0x0000d5ac4ab024f0), W(0x0000f41d0bf2ebbd),
+     W(0x00006f8441a14137)},
+    0
+  },
+  {
+    {W(0x000054148c7a3897), W(0x00007f1c7a0e9b21), W(0x00009ab5c1a7d560),
+     W(0x00007666cdf8dc28)},
+    {W(0x000000f79f87ae1f), W(0x0000a53e20bf2ecc), W(0x0000068d962eb7de),
+     W(0x0000f91b1394eb78)},
+    0
+  },
+  {
+    {W(0x0000ff97157ed7c0), W(0x00000a6fe8f4c311), W(0x000044dbeb999f96),
+     W(0x0000a513482a71fd)},
+    {W(0x0000d2669c17bee1), W(0x00009b1111997181), W(0x000011a92d05d1ff),
+     W(0x00006330ba2333a4)},
+    0
+  },
+  {
+    {W(0x00009dcf6d4f810d), W(0x0000a7c94d446a45), W(0x0000f3c2d93277a8),
+     W(0x0000c15b91aa0438)},
+    {W(0x0000169ef9a20a8f), W(0x00000a750e893698), W(0x000035245b4e5924),
+     W(0x0000a8efd8f15205)},
+    0
+  },
+  {
+    {W(0x0000545e0f36c641), W(0x0000572e114f60fb), W(0x00004862801fca09),
+     W(0x000076bace6f8ea2)},
+    {W(0x000014bee22a70f5), W(0x0000335d3c9e0d47), W(0x000000f0ce481ff5),
+     W(0x00000a315714776b)},
+    0
+  },
+  {
+    {W(0x000025fc47946b51), W(0x0000aafa6b98dd65), W(0x000092b5304efb9b),
+     W(0x000061a51d0899b4)},
+    {W(0x00007a1b2a3234d4), W(0x0000f84eadc5ddf5), W(0x0000f0fcfecd393b),
+     W(0x0000fc64b2e3cba4)},
+    0
+  },
+  {
+    {W(0x000059b20dcd6db9), W(0x0000cabde57001ad), W(0x0000067d1527dc96),
+     W(0x0000accf1d20bd99)},
+    {W(0x000093fcee3da138), W(0x000058005623324d), W(0x0000d69a09ad2a22),
+     W(0x00007418549b7c2d)},
+    0
+  },
+  {
+    {W(0x000039559f5e07bd), W(0x000047abaf91f2af), W(0x000093245793a687),
+     W(0x000082027e71ad52)},
+    {W(0x0000b16fcd4ecff8), W(0x0000c63d84735cdd), W(0x0000a7bfa5047a13),
+     W(0x000081e206dcbf14)},
+    0
+  },
+  {
+    {W(0x000090f67f74d6dd), W(0x0000e5faa5cdb5bf), W(0x00004f17164ab822),
+     W(0x00008fc984aac051)},
+    {W(0x000099ae34a71dd2), W(0x0000249d14329788), W(0x0000d6512ebb6bd8),
+     W(0x0000613e38c6fb62)},
+    0
+  },
+  {
+    {W(0x000002600eca4312), W(0x0000eda978f5b51a), W(0x00002395c9204c3f),
+     W(0x00004cf11c38a30f)},
+    {W(0x000023002b9b40fb), W(0x000038851d745d43), W(0x0000ba0630395fd2),
+     W(0x0000727664543cd2)},
+    0
+  },
+  {
+    {W(0x00001d49524dda2b), W(0x00002714eb021599), W(0x00002b0186722ad6),
+     W(0x0000ddbedbf9acac)},
+    {W(0x0000815adc6e5903), W(0x0000bcc6af79735b), W(0x00001b453e66eb2d),
+     W(0x0000f317fe6b6b87)},
+    0
+  },
+  {
+    {W(0x00007f44fb1a5fa4), W(0x00001d3ad713ff05), W(0x000087717523b4cc),
+     W(0x00007690d774dcfc)},
+    {W(0x0000f1e090ac5e50), W(0x000076edd6ce0b50), W(0x00002d9eb8d3a523),
+     W(0x0000029d5622ea2f)},
+    0
+  },
+  {
+    {W(0x00008b2c11680627), W(0x0000c8391ce95138), W(0x0000e306f159df62),
+     W(0x0000478e898c71a8)},
+    {W(0x0000800e50b76e8f), W(0x00004ff224758955), W(0x0000387b3b79eea2),
+     W(0x0000a68f0aeb8195)},
+    0
+  },
+  {
+    {W(0x0000d4c425a18d8a), W(0x00002c081c0bb6a8), W(0x0000a740da00297c),
+     W(0x000021b5c61351e4)},
+    {W(0x0000e6bc89719cfd), W(0x00007d410d32b10f), W(0x00006c0def77299f),
+     W(0x0000bed7836d0284)},
+    0
+  },
+  {
+    {W(0x0000153a21121823), W(0x0000a8a06461a33e), W(0x00009e67ff9f4419),
+     W(0x000041869a7cd25e)},
+    {W(0x0000a2c595edead9), W(0x00003f0cf42348b7), W(0x0000a51e434758bf),
+     W(0x0000a49f7d18f923)},
+    0
+  },
+  {
+    {W(0x00006f79663938df), W(0x0000365ac33b6262), W(0x000092bc78ba6bcf),
+     W(0x0000946dee1cba03)},
+    {W(0x0000eeffed7c847d), W(0x00003fbc6859979b), W(0x00004f2443c24eaa),
+     W(0x0000457dc834e881)},
+    0
+  },
+  {
+    {W(0x0000be4fc8bbe992), W(0x000003be71eb202c), W(0x0000ad2dd5cab4b2),
+     W(0x00007b0101f8f39e)},
+    {W(0x0000bb00b52bdd11), W(0x000037e3f4cfb968), W(0x000010955deba491),
+     W(0x0000fe72a12f9c82)},
+    0
+  },
+  {
+    {W(0x0000c4ed73b42bed), W(0x00004fd0c4e64b8a), W(0x00002492127d0d10),
+     W(0x0000182cef9a42e1)},
+    {W(0x00003d98afb9ae1b), W(0x0000af8ef9f641f7), W(0x00002d995bab18ac),
+     W(0x0000979f2c9e5f24)},
+    0
+  },
+  {
+    {W(0x0000a359502cb37d), W(0x000086530aa8de19), W(0x0000a04dda796210),
+     W(0x00003599ec4e0b57)},
+    {W(0x00007e9564abd5e6), W(0x0000ad670881ec31), W(0x000000e5e8c268c5),
+     W(0x0000204e6fddffd4)},
+    0
+  },
+  {
+    {W(0x00001681f96422bb), W(0x0000d6e987b1abf2), W(0x0000bcf52c138e57),
+     W(0x00002074876cd483)},
+    {W(0x0000f7f9a45fb204), W(0x0000530654ebba5f), W(0x00004674ebfa7894),
+     W(0x0000c6bf6f727561)},
+    0
+  },
+  {
+    {W(0x0000494325fb94c4), W(0x000051ec0c1230a6), W(0x00005f5ff3d55c68),
+     W(0x0000fd5da9f2e923)},
+    {W(0x000004b2215bb4b6), W(0x0000488f149aa0cc), W(0x0000f4a8886bc9e9),
+     W(0x0000ac16dd98d3a0)},
+    0
+  },
+  {
+    {W(0x0000980fee199d6e), W(0x0000bdca851cc15b), W(0x0000b149e23adb39),
+     W(0x0000c6807def457b)},
+    {W(0x00006855765eeba1), W(0x0000568d1d334b5c), W(0x0000679b68edef33),
+     W(0x00003ea0b480319e)},
+    0
+  },
+  {
+    {W(0x00008349027399dd), W(0x0000d96b99b4e87e), W(0x0000f77f563d7c50),
+     W(0x0000350342859ac4)},
+    {W(0x0000db0c46013850), W(0x00008c88a7ca1894), W(0x0000cf71d4c655db),
+     W(0x0000b419054e9b59)},
+    0
+  },
+  {
+    {W(0x0000982b80bc906e), W(0x0000d7d6d731d440), W(0x00006ab686aeb09c),
+     W(0x0000c6d2a25c6896)},
+    {W(0x000026a07ee324ae), W(0x0000602f5794a84c), W(0x0000d8ab0fc1bbac),
+     W(0x0000d52a9966d7a4)},
+    0
+  },
+  {
+    {W(0x0000ab05a511746a), W(0x000055d91bc88ecd), W(0x0000c41bedc720a5),
+     W(0x00009ef17d42132f)},
+    {W(0x000034bdf29b923e), W(0x0000c37d4006ccbe), W(0x00003e5fa35b911f),
+     W(0x000071e257d23fb1)},
+    0
+  },
+  {
+    {W(0x0000fce895c63031), W(0x00007b4bc82d5f21), W(0x0000896bae63024e),
+     W(0x0000d8cc9b2d2bb6)},
+    {W(0x0000b817724f295b), W(0x000015b447acf03a), W(0x0000bd24c607cc6e),
+     W(0x0000bfa7b2ef59f8)},
+    0
+  },
+  {
+    {W(0x0000f16ea4100aa7), W(0x0000e85cda28c0d6), W(0x0000a8fb35ee94bc),
+     W(0x000064615fbe142d)},
+    {W(0x00003ff57a7b27fe), W(0x000044f8de9c8636), W(0x00004d840c298c27),
+     W(0x00002d88708f9542)},
+    0
+  },
+  {
+    {W(0x0000c3f98590488e), W(0x00003f9b606dbce4), W(0x00007787c792a042),
+     W(0x00005a927b465426)},
+    {W(0x0000437561cff01b), W(0x00000b899a6eb2e8), W(0x00002841b7807456),
+     W(0x00001a4c05bc57cb)},
+    0
+  },
+  {
+    {W(0x0000945abf7303ca), W(0x0000dd898bb19c88), W(0x0000c7a325a7d60b),
+     W(0x00007617d66ecafb)},
+    {W(0x0000f6b0589ea502), W(0x00007d23e1428641), W(0x0000fada4b419fa2),
+     W(0x0000a280c23b61bd)},
+    0
+  },
+  {
+    {W(0x0000df2d9c125ed9), W(0x000077a495f4c8de), W(0x00009cbe6fc945ae),
+     W(0x0000769edd9ed446)},
+    {W(0x00002a4838ae9a67), W(0x0000f3955af60f31), W(0x000006b6c85cc6c4),
+     W(0x0000a8cccbd1426c)},
+    0
+  },
+  {
+    {W(0x0000fb6ea0fbb46a), W(0x0000b89143d69dae), W(0x000017fd097feba3),
+     W(0x00007eb5b155604e)},
+    {W(0x000093700451a61a), W(0x0000d2579444153f), W(0x00007b4366e7fad4),
+     W(0x0000204fcc22ae1e)},
+    0
+  },
+  {
+    {W(0x0000a7dab7d644a7), W(0x00002de7c70e28a8), W(0x0000c0ea42148018),
+     W(0x00002acbf03c113f)},
+    {W(0x0000f10bfe5b15fd), W(0x0000962c5a64bd98), W(0x00000f3949b7c931),
+     W(0x0000eb55048a9365)},
+    0
+  },
+  {
+    {W(0x0000cf443e112b00), W(0x0000155cf2dd9af0), W(0x0000beee6e3bc189),
+     W(0x000058dfdbe80719)},
+    {W(0x000002fef427d154), W(0x0000bc3203f27457), W(0x00009061274d7ab4),
+     W(0x00008b023fccc99e)},
+    0
+  },
+  {
+    {W(0x0000477212a1c283), W(0x0000bda0ce95d0ef), W(0x00003f3b2be95745),
+     W(0x00005c18c94a1da8)},
+    {W(0x00003a66c8be2b9a), W(0x0000a0f5e7d885d3), W(0x00001bd8ddacfada),
+     W(0x0000feaa68772a88)},
+    0
+  },
+  {
+    {W(0x0000ade357bc7d14), W(0x0000d954f8a6c8cd), W(0x000080c832a4a06a),
+     W(0x0000c16ad8dc0991)},
+    {W(0x000004444f20b4c9), W(0x0000a24423d471c4), W(0x0000c0d961ea9705),
+     W(0x00003a112c04a9bf)},
+    0
+  },
+  {
+    {W(0x000043e9cfe5780b), W(0x0000552bf3effa3b), W(0x000008bdcfb0ab51),
+     W(0x00008d768ca6bbf7)},
+    {W(0x000036136cd7237f), W(0x000039514e63ccbe), W(0x0000243245bc43e1),
+     W(0x00000d240be3c89c)},
+    0
+  },
+  {
+    {W(0x0000dee91c6f01ba), W(0x0000adb6bedfbdac), W(0x000010169319d5e1),
+     W(0x0000bc0f9c9ad5a2)},
+    {W(0x000071b83770dcc3), W(0x00006ae106ab3042), W(0x0000afad3484da80),
+     W(0x00009707a5cd01bc)},
+    0
+  },
+  {
+    {W(0x0000beff0b4952bb), W(0x0000148ceafbd0c1), W(0x0000c63f2f2b0c57),
+     W(0x0000564c5c1a0170)},
+    {W(0x00001a145ffdbde0), W(0x000003dacd425021), W(0x00006ab73b21cce6),
+     W(0x0000085389118f97)},
+    0
+  },
+  {
+    {W(0x00001d590e9ba5c0), W(0x0000892b30cbc738), W(0x0000d831f940a1b4),
+     W(0x0000f9e1d3ab7ced)},
+    {W(0x0000bdf3f8fd90ac), W(0x0000c623270b9aaa), W(0x0000407648d9f240),
+     W(0x000036574b09018f)},
+    0
+  },
+  {
+    {W(0x00000f0f41e850b5), W(0x0000a56567e51f15), W(0x000095eafb427d03),
+     W(0x0000b71e043f4fef)},
+    {W(0x00003bbf8bf60108), W(0x00000a6e8c7d01d5), W(0x0000cb446419bdc3),
+     W(0x0000ed6ecfdbc1cd)},
+    0
+  },
+  {
+    {W(0x00004aeb6b940315), W(0x000020760e9e0570), W(0x0000160574209ce5),
+     W(0x00006bd637ef6c9b)},
+    {W(0x0000e59f476f256c), W(0x000034c490ee99ed), W(0x00009d787b4983d8),
+     W(0x0000b23b69b61848)},
+    0
+  },
+  {
+    {W(0x00005058e55a94b8), W(0x0000ca17202cdfe9), W(0x00007729d59d941e),
+     W(0x0000924d931d0975)},
+    {W(0x0000d544d527c142), W(0x00006f4310bb8288), W(0x000004e14decbe67),
+     W(0x0000ec79190d2f3c)},
+    0
+  },
+  {
+    {W(0x0000834212fb13fc), W(0x00004f31fb55c2c3), W(0x0000221b5444649c),
+     W(0x0000d5a6ce2e009e)},
+    {W(0x00005c262be4e450), W(0x0000d808672af300), W(0x0000e93ee38a9236),
+     W(0x0000a3cc022a429c)},
+    0
+  },
+  {
+    {W(0x0000d36edd9167f5), W(0x0000efabf2d22997), W(0x0000fdf68ba9f813),
+     W(0x0000bbd1b58d879e)},
+    {W(0x00002784afc7f7eb), W(0x00009bf5897fc946), W(0x00005b247f57c499),
+     W(0x0000c419c5f095bd)},
+    0
+  },
+  {
+    {W(0x00004061d52bdd90), W(0x00005f7d8b5118c3), W(0x0000435bd930cf55),
+     W(0x0000790d17ecbba1)},
+    {W(0x0000dba0b9fd6d40), W(0x000010c54efa3240), W(0x0000e24d1637b62a),
+     W(0x0000cd6f05458ce6)},
+    0
+  },
+  {
+    {W(0x00007be63f0e7129), W(0x0000aaf35358b46d), W(0x00005ee8a743a6b2),
+     W(0x00006151372aa28c)},
+    {W(0x0000c4b1a90f4dd3), W(0x000033f847a67511), W(0x0000e4c84ceb8743),
+     W(0x00005cd10fb35617)},
+    0
+  },
+  {
+    {W(0x0000c22fbf341ed0), W(0x0000ed96810cb032), W(0x00006025c7e06cb7),
+     W(0x0000c964fe9b372e)},
+    {W(0x0000bbdba3cd8b16), W(0x00008647f200f5c3), W(0x00009f3c9175fdd9),
+     W(0x0000e4e0d2390c7a)},
+    0
+  },
+  {
+    {W(0x0000e0643e4a358c), W(0x0000c3af95571b2b), W(0x000070848d3ff948),
+     W(0x00002795f1be9f7f)},
+    {W(0x0000d239e9186a9e), W(0x00009c40b1b3b6e2), W(0x00005cc3c6dec3e4),
+     W(0x0000209b3f7f79e7)},
+    0
+  },
+  {
+    {W(0x000001b4aa14cd23), W(0x00005e51c2406bc2), W(0x00007c6dbb0aae60),
+     W(0x00003bfb05fa4776)},
+    {W(0x000090a816ff63d6), W(0x0000cf12955714e7), W(0x0000ecf8d9977e16),
+     W(0x00009a0d6db12960)},
+    0
+  },
+  {
+    {W(0x00006292c4892d58), W(0x0000cb69ccbc49da), W(0x0000b25841a97da9),
+     W(0x00004234e1506fe0)},
+    {W(0x00006f3e048481e9), W(0x0000c51594b78874), W(0x000003642b175ff0),
+     W(0x000017e7a7b70408)},
+    0
+  },
+  {
+    {W(0x0000cf21bdae6145), W(0x00001bca134b4978), W(0x00001cb0876008e6),
+     W(0x0000ca97729f04c1)},
+    {W(0x0000cea2ed698a0a), W(0x00009dd936ba123e), W(0x00000bf7e7189d69),
+     W(0x00009b4cd758eb2e)},
+    0
+  },
+  {
+    {W(0x00008fc802c45458), W(0x000050879b2fb0b2), W(0x000087c26d0cb600),
+     W(0x0000cba3562c7fb2)},
+    {W(0x0000fff9ed7ad891), W(0x000049f749730c90), W(0x0000c844b969eee1),
+     W(0x0000b152a76fd643)},
+    0
+  },
+  {
+    {W(0x00003a5f156419d5), W(0x0000576c9b0c86b3), W(0x0000d5378f08e490),
+     W(0x0000836eff3d6e7c)},
+    {W(0x000055f0f9008b25), W(0x0000c52e466faef5), W(0x00003901dafbcf72),
+     W(0x00006520b1b7b755)},
+    0
+  },
+  {
+    {W(0x0000e9e16d94681f), W(0x000011d0baed2477), W(0x000059e556fe6ad6),
+     W(0x0000ea4eb241dd42)},
+    {W(0x000076d927e8dc5a), W(0x00005fc878443f4d), W(0x0000095773f87926),
+     W(0x0000db8991cdf52c)},
+    0
+  },
+  {
+    {W(0x00002aa6acfbd477), W(0x0000b134511d360e), W(0x000096078811d439),
+     W(0x00001ecdf6f4f425)},
+    {W(0x0000df0c82d8f71f), W(0x0000d5744a8e1283), W(0x00008ddb7e3b86ee),
+     W(0x00001d3067e79ccf)},
+    0
+  },
+  {
+    {W(0x000090c815451cba), W(0x00008f323a30cf92), W(0x00005429d391bc01),
+     W(0x00000709c633136c)},
+    {W(0x0000336aa3b09108), W(0x00002496cad4d519), W(0x0000b17236f0eb08),
+     W(0x000034d239af2a36)},
+    0
+  },
+  {
+    {W(0x0000cbc53c460bdc), W(0x00008ccfcc110c99), W(0x0000de03976caceb),
+     W(0x00002b7f5e82cf24)},
+    {W(0x00006be27f92cc32), W(0x000091b5fe4b7748), W(0x0000e9d41f12d46b),
+     W(0x00001f65789dc6e9)},
+    0
+  },
+  {
+    {W(0x00002903f4dc0a23), W(0x00008389d4dfee59), W(0x0000f9b2619477d5),
+     W(0x00003dff63a060b8)},
+    {W(0x0000ec0fb0ea4281), W(0x00008ad3f56d2f54), W(0x0000ff205d31d0d0),
+     W(0x000030d6f439961d)},
+    0
+  },
+  {
+    {W(0x000090daa8a95ec7), W(0x0000658af0edd192), W(0x0000e685dacd7acd),
+     W(0x0000bdfeaf1d01b8)},
+    {W(0x0000e8af1c784df0), W(0x000099c52784175e), W(0x0000c3a1c7bc331c),
+     W(0x0000b482cf9122fa)},
+    0
+  },
+  {
+    {W(0x0000ef2aeba1662e), W(0x00007297106669cb), W(0x000010e03f654b3d),
+     W(0x00008cdfae20543f)},
+    {W(0x00009878d58c4a96), W(0x00003d51b92da1d3), W(0x000078f1539645da),
+     W(0x000096cde3bcea6c)},
+    0
+  },
+  {
+    {W(0x0000b0fc05ee26ef), W(0x00006b93d7ce5167), W(0x00007a4309345229),
+     W(0x00002f54b5f50ff1)},
+    {W(0x00009d9e3ad159b8), W(0x00002061246fbe6c), W(0x0000742ba86dbe99),
+     W(0x0000992d33c83c32)},
+    0
+  },
+  {
+    {W(0x00007ae84394d243), W(0x0000b127ba840b40), W(0x0000c9655cad47f6),
+     W(0x0000915f144ef2b8)},
+    {W(0x000056e61ebbe55b), W(0x000058018d0fce12), W(0x0000277d7d377216),
+     W(0x00008737744032d7)},
+    0
+  },
+  {
+    {W(0x0000d1d4d0c19f03), W(0x000060c0bc052130), W(0x0000238f51103d03),
+     W(0x0000e7d640894254)},
+    {W(0x0000818c1a56da7a), W(0x0000f074c7d8d960), W(0x0000121649e6e03f),
+     W(0x0000bfdba093ef91)},
+    0
+  },
+  {
+    {W(0x0000c7cdd901c8d7), W(0x0000cd0b39f0923b), W(0x0000e1eeb6d0d8ec),
+     W(0x0000047cec93449d)},
+    {W(0x0000e27a8a5b790c), W(0x0000bbef9c913f3d), W(0x0000c6de846c0aa3),
+     W(0x00007e152f261ab4)},
+    0
+  },
+  {
+    {W(0x0000ca1cfd9fd6e1), W(0x0000d0aff5232f9a), W(0x000032302b28a170),
+     W(0x0000092760b58bb9)},
+    {W(0x00001f0895f4e4fc), W(0x0000d6eb76cf68a5), W(0x0000ece732290513),
+     W(0x0000c2f2df57206b)},
+    0
+  },
+  {
+    {W(0x00006ba83231beb7), W(0x0000f8e6857b9c18), W(0x00004bba273dee5d),
+     W(0x0000bca2c1135baa)},
+    {W(0x00002571e292a185), W(0x0000a750b5d7b549), W(0x00008da75e1e6b1c),
+     W(0x0000ce913e17db49)},
+    0
+  },
+  {
+    {W(0x000038c5e829c808), W(0x0000b4ed66ba4975), W(0x0000958669a72ffb),
+     W(0x000066ed1f7afdd0)},
+    {W(0x0000189c217e79e1), W(0x0000b2d28b2b8aad), W(0x0000bc81060a8af5),
+     W(0x00004bbb024e3d28)},
+    0
+  },
+  {
+    {W(0x00004f30674b8d62), W(0x000046f777c2ee98), W(0x00009fa6d2bb2ae6),
+     W(0x0000b2813fb68d60)},
+    {W(0x0000e27b90c7040a), W(0x0000556ea85aebaf), W(0x0000b69f07a0fdd7),
+     W(0x0000a624bc7567af)},
+    0
+  },
+  {
+    {W(0x0000fe6b0f690c0d), W(0x000032ce509f03dc), W(0x0000f9a8ace7075e),
+     W(0x00007d4a62e49547)},
+    {W(0x000035f82c42fd94), W(0x000078fc1b4bd2d3), W(0x0000ba82ddf91cee),
+     W(0x0000dd8ab3373ac3)},
+    0
+  },
+  {
+    {W(0x00006e9acac0f817), W(0x0000ec0fdcf8b786), W(0x0000ea835c70a198),
+     W(0x0000de570a22fbca)},
+    {W(0x0000b7e5bdf24760), W(0x000019e40c34bd27), W(0x000097a733f7c5bb),
+     W(0x000027c52a577d0b)},
+    0
+  },
+  {
+    {W(0x0000eb6e0cc5b7b5), W(0x0000b50f4e8683e7), W(0x0000b3804a54a465),
+     W(0x0000ae86b92e91ca)},
+    {W(0x0000045b8a0f01c5), W(0x0000b94397d46cef), W(0x00008e935754a6d5),
+     W(0x00009e95603a9b55)},
+    0
+  },
+  {
+    {W(0x0000db331f9aa36f), W(0x000064be2784bedb), W(0x000052a8589925dc),
+     W(0x0000a50f349ada25)},
+    {W(0x0000707fd99576a7), W(0x0000ace1f4c374ea), W(0x000018c442f2559c),
+     W(0x00008d14ea1c2a56)},
+    0
+  },
+  {
+    {W(0x00005bd0d605ac80), W(0x0000fe763c6e33a4), W(0x00001e9fbf5b954c),
+     W(0x0000e82029ade745)},
+    {W(0x000053bb5a4b76c3), W(0x000052b7077af704), W(0x00006aeef52926d4),
+     W(0x000025ff11eb6d17)},
+    0
+  },
+  {
+    {W(0x0000d1521fd93e47), W(0x0000b2feb290067c), W(0x000058ae3398f6bb),
+     W(0x0000e204e3e4a7ac)},
+    {W(0x00001684d22672f9), W(0x0000bb843266dc2f), W(0x0000f6cdb7dceeb8),
+     W(0x00007dd55dbe3de8)},
+    0
+  },
+  {
+    {W(0x00002251f54b4392), W(0x0000b46bcf23356b), W(0x0000c3f4b231317b),
+     W(0x00005130b4c175da)},
+    {W(0x00001f313c2d6e8b), W(0x000093c3ad9da52f), W(0x00005322baf1a4fa),
+     W(0x00000eff00350669)},
+    0
+  },
+  {
+    {W(0x0000882a4511f7ba), W(0x0000547327ce92b6), W(0x0000e90deee2584d),
+     W(0x0000701d240c3a6f)},
+    {W(0x0000d4e1084c74c1), W(0x00000ed4d2e0662b), W(0x00001ad6ac1134d2),
+     W(0x0000da924d1e36b7)},
+    0
+  },
+  {
+    {W(0x00000dc2399a337a), W(0x0000c8c8d347f730), W(0x000074db4421bdfc),
+     W(0x0000f864ddf295da)},
+    {W(0x000038f9dad16c05), W(0x000067f698bb41c5), W(0x00007d076838d944),
+     W(0x00007539a45dab18)},
+    0
+  },
+  {
+    {W(0x0000bbbb4fdbe729), W(0x0000352100555289), W(0x00005d38b16d273e),
+     W(0x00003d7213a53fef)},
+    {W(0x0000c795ae40dc46), W(0x0000de5eb7d5e270), W(0x000018f0b16d8943),
+     W(0x000088ed5a3c0ce5)},
+    0
+  },
+  {
+    {W(0x0000851924b64508), W(0x00001505f68aec16), W(0x0000cebba3c4f408),
+     W(0x0000f8688603efcf)},
+    {W(0x00003fd7b7c66435), W(0x00000ccea13df3d0), W(0x0000dc29490a8e7a),
+     W(0x0000a9ebcedb15a0)},
+    0
+  },
+  {
+    {W(0x0000d3ffc402b6f9), W(0x0000f7167e64196d), W(0x0000deffb7b63c89),
+     W(0x00009ffc4d82dbdc)},
+    {W(0x00009458135644ac), W(0x00005534f057ff39), W(0x0000e0fba673bccb),
+     W(0x0000e8f18ebd7924)},
+    0
+  },
+  {
+    {W(0x00004b9b74ea03d5), W(0x0000ebc8b71388bc), W(0x0000ad015c737de4),
+     W(0x0000b71a29c95c69)},
+    {W(0x0000b4638c4e2450), W(0x0000853a5e23dd73), W(0x00001024d0012341),
+     W(0x0000b748ea385cbc)},
+    0
+  },
+  {
+    {W(0x0000ae4e756ba54f), W(0x000092df1715e7dc), W(0x0000d90f7be50e0a),
+     W(0x000015d7eef6f832)},
+    {W(0x0000f5da99cc37b5), W(0x00005508bc857585), W(0x0000713150701871),
+     W(0x0000e74368cd7e9d)},
+    0
+  },
+  {
+    {W(0x00009b4d7ac20107), W(0x0000efb9cf52ce6a), W(0x00001daca1e5efa3),
+     W(0x0000106c062b2236)},
+    {W(0x000050748c10f450), W(0x0000c4b0e16ebda0), W(0x00006cbeb7fc15ac),
+     W(0x0000ca5986929ce2)},
+    0
+  },
+  {
+    {W(0x0000e38f110c6000), W(0x0000dca55d8cd4c7), W(0x0000226578be446c),
+     W(0x0000c4a8a58a18b5)},
+    {W(0x0000105683fcb714), W(0x000074484994029e), W(0x000063bedfae583e),
+     W(0x000088705ae78350)},
+    0
+  },
+  {
+    {W(0x0000aa3d957b68dd), W(0x0000c8a225633d72), W(0x0000f695fb24861d),
+     W(0x0000b315e4f3778d)},
+    {W(0x00002197705ab58f), W(0x0000aba658651948), W(0x000093a423124283),
+     W(0x000004486ff05fdd)},
+    0
+  },
+  {
+    {W(0x00007fec552f1a8d), W(0x000037fbc1094cc8), W(0x000042b58d525bfb),
+     W(0x0000b884f0ac0e92)},
+    {W(0x0000db00c537f37a), W(0x0000b9907899a999), W(0x00008b4ce0913f15),
+     W(0x00003aec02ec69d5)},
+    0
+  },
+  {
+    {W(0x0000f0dc17b3000d), W(0x0000bba27f37da22), W(0x0000b1f98a246d30),
+     W(0x00004574ebbd1fcb)},
+    {W(0x0000932e5b1315c6), W(0x0000edffbbe46bf7), W(0x0000ab456b294739),
+     W(0x00003854ff1a8431)},
+    0
+  },
+  {
+    {W(0x0000eaac87a91601), W(0x0000c9cd0a847c54), W(0x0000daee27a6ce8f),
+     W(0x000058cc828b8786)},
+    {W(0x0000942bc7657a73), W(0x00006e3e3938b14a), W(0x0000731ef3dc39a5),
+     W(0x00009acd0a4f2eb7)},
+    0
+  },
+  {
+    {W(0x00001b6cda1cd184), W(0x0000e05ecbfc48a4), W(0x000050e78d9a1629),
+     W(0x00001bd702155ba5)},
+    {W(0x00001708d037d078), W(0x0000c649576ed88b), W(0x00005d0e84612952),
+     W(0x0000861bfc777454)},
+    0
+  },
+  {
+    {W(0x0000beb49d06e5de), W(0x0000e46b2e75d9a2), W(0x00000c11b546e644),
+     W(0x0000d1113331106b)},
+    {W(0x0000491bd58059b5), W(0x00003766c4fc281c), W(0x0000a822608e8d7f),
+     W(0x00003de4b62347a1)},
+    0
+  },
+  {
+    {W(0x00003c485a06cb4a), W(0x0000ba0bc41ff6b7), W(0x0000d241b4b987fa),
+     W(0x0000e5daab8489b1)},
+    {W(0x0000c9f53f78995a), W(0x00000ae8126c034f), W(0x0000497d343bdebb),
+     W(0x0000f5c5b28128c3)},
+    0
+  },
+  {
+    {W(0x0000f9a20f3fc0be), W(0x00006da01197b329), W(0x0000a17d220c090f),
+     W(0x000028870d3e6eb0)},
+    {W(0x0000600efa6adde7), W(0x0000d85d4ab7e6a6), W(0x0000912de0bcd023),
+     W(0x0000276c7b0cb42a)},
+    0
+  },
+  {
+    {W(0x0000e377137b0128), W(0x0000af9d46bef9e9), W(0x00009aa52b44ef78),
+     W(0x00006eb5479bbc26)},
+    {W(0x00007b3228119883), W(0x00005c42f6b70698), W(0x0000078a6cdfdda4),
+     W(0x00001c409fd19f35)},
+    0
+  },
+  {
+    {W(0x000074a005fd8f51), W(0x00002e300ca20659), W(0x00005044c0151df3),
+     W(0x0000022fb86731f7)},
+    {W(0x00006c58bacc9ea9), W(0x0000f656af5e5cca), W(0x00001216c6639c4f),
+     W(0x0000293b444f24bd)},
+    0
+  },
+  {
+    {W(0x0000fa6ebf4188b6), W(0x000083ef95a02326), W(0x0000442322c0b93d),
+     W(0x00004f2f46306ad8)},
+    {W(0x0000a88dce7e2ea4), W(0x0000833e200bd4e9), W(0x0000ec4a79446c1a),
+     W(0x00001f2625db465a)},
+    0
+  },
+  {
+    {W(0x0000de04bcf782df), W(0x00007e1fe4ee5189), W(0x000010fa26748ea9),
+     W(0x0000100b04d9c71a)},
+    {W(0x0000e2f0321bd623), W(0x00009305ff07f337), W(0x000010d7b45ea999),
+     W(0x0000121e9decd013)},
+    0
+  },
+  {
+    {W(0x0000b4a3bb8827b9), W(0x000023fbcd76d520), W(0x00005db6c13746f0),
+     W(0x0000d333bf83795d)},
+    {W(0x0000e89ae243fc0b), W(0x0000d5e07c60d252), W(0x00003c3264a34ccf),
+     W(0x000086eea444cc1b)},
+    0
+  },
+  {
+    {W(0x00000f1fdb5b45f8), W(0x00006555fe31109e), W(0x0000ab4c639d3262),
+     W(0x0000e8c91a1a768c)},
+    {W(0x0000dfe708b38a19), W(0x00000935a081675c), W(0x0000584d0c390b5c),
+     W(0x0000685cb98b83e4)},
+    0
+  },
+  {
+    {W(0x0000896ba492d3d1), W(0x0000f3e30038b956), W(0x00008153f0c6b357),
+     W(0x0000c9215d7c7623)},
+    {W(0x0000b466785587ba), W(0x0000f19cf3d2c3bd), W(0x00008c8fe29df654),
+     W(0x0000561a5a8f9eda)},
+    0
+  },
+  {
+    {W(0x000039dd8e85d923), W(0x0000240331ab49d6), W(0x00001880e5e2f2d2),
+     W(0x0000752ba5f9af91)},
+    {W(0x00008b362eb0064c), W(0x0000788ea9b31877), W(0x00007b3f7f1ceed2),
+     W(0x0000365aef8951c2)},
+    0
+  },
+  {
+    {W(0x0000d0e3280392c1), W(0x00001428a44a577b), W(0x000005f695473994),
+     W(0x0000dd54217a4b3a)},
+    {W(0x00002884e0619ceb), W(0x00007c4fe23ab06a), W(0x00003ed8088223c2),
+     W(0x0000c0a5c92c2c95)},
+    0
+  },
+  {
+    {W(0x00009bdfa2490d37), W(0x00009930340d4def), W(0x00008969e7d237e6),
+     W(0x0000783445f33e28)},
+    {W(0x0000d19a03a2690f), W(0x0000ef6110d10143), W(0x00001b9355636a91),
+     W(0x0000808e968f5118)},
+    0
+  },
+  {
+    {W(0x00008d02ecb4b588), W(0x00002c718faad2c1), W(0x0000a47b46a9f332),
+     W(0x00004417eb42a8af)},
+    {W(0x0000bb2bcee5ed43), W(0x0000bd7b342b2366), W(0x000025ee3176de8d),
+     W(0x0000eea91657d880)},
+    0
+  },
+  {
+    {W(0x0000f00bb143d0c5), W(0x0000760717953ad8), W(0x0000bdea7bba5616),
+     W(0x0000172ef3227c7f)},
+    {W(0x000003b6e155d4c0), W(0x00004ac058722a3e), W(0x00000f0de5e9426b),
+     W(0x0000381a5c8b2b38)},
+    0
+  },
+  {
+    {W(0x0000672649105fb4), W(0x0000f138f01d499a), W(0x0000138b8e87e9fa),
+     W(0x0000c001c432ffdb)},
+    {W(0x0000c03394f4ff09), W(0x00005873247bc5ec), W(0x00001c4854a13ba8),
+     W(0x0000bef474df5437)},
+    0
+  },
+  {
+    {W(0x0000588a1a35514b), W(0x00001eba19477577), W(0x00006092e8642d40),
+     W(0x000052e05693cbe5)},
+    {W(0x0000446d8d023a9e), W(0x0000676f64e41223), W(0x0000d69937f1ce14),
+     W(0x00002105efd0f818)},
+    0
+  },
+  {
+    {W(0x0000fd474b9b02b2), W(0x000057dd68f88160), W(0x00008b8e53fb60ac),
+     W(0x00006157465770d0)},
+    {W(0x0000a9fb3202b49c), W(0x0000e07cd713c2f7), W(0x0000de95b507eaf4),
+     W(0x0000bcf67cf4003c)},
+    0
+  },
+  {
+    {W(0x0000f2d2632d1208), W(0x000072cb9e32be5f), W(0x0000ed6c743ecc7b),
+     W(0x00006c029604fe2a)},
+    {W(0x0000012dbabca1bd), W(0x0000d83c21c4d055), W(0x0000084e83f3ee35),
+     W(0x0000d4ac26b2b027)},
+    0
+  },
+  {
+    {W(0x000001257a4cb9bf), W(0x0000889ea3877aef), W(0x00005c05619fe2c3),
+     W(0x0000c90d6d63d77f)},
+    {W(0x0000220325320425), W(0x0000806af3e3cec7), W(0x0000eb413bed2122),
+     W(0x000041dca2372695)},
+    0
+  },
+  {
+    {W(0x000085eada931f17), W(0x0000ac4373a35751), W(0x0000d2c509530e7b),
+     W(0x0000fa0dae65432b)},
+    {W(0x00009be307c10c85), W(0x0000aa5eb3de7416), W(0x0000cb8f45292bbc),
+     W(0x0000cb0e3119178a)},
+    0
+  },
+  {
+    {W(0x00002dffb05b4bf5), W(0x0000e7bdefc36dea), W(0x0000521a62747e38),
+     W(0x000009e4ab89952f)},
+    {W(0x0000a7e1f35deb61), W(0x0000e0616ce236be), W(0x0000ced9a7216436),
+     W(0x00006f627036d1f5)},
+    0
+  },
+  {
+    {W(0x00007e5f1026906f), W(0x0000c3e52b275d53), W(0x0000a063bdd36abf),
+     W(0x00001b5de23e1e7b)},
+    {W(0x000038d8d6de82f6), W(0x000034b01650af54), W(0x00005bce552f3ea2),
+     W(0x0000ed80ef8989fe)},
+    0
+  },
+  {
+    {W(0x0000bd02a5f6ce18), W(0x0000a5eb0b5948b5), W(0x0000985822b0f696),
+     W(0x00003b7dd8d6aeb4)},
+    {W(0x0000402bd0fa0cff), W(0x00000843c8ca8479), W(0x00000f7350bd0434),
+     W(0x00008143ae15d3ee)},
+    0
+  },
+  {
+    {W(0x000023295b675ff4), W(0x00003e384a12422f), W(0x0000ffda388cb2ee),
+     W(0x0000fa5d89acba09)},
+    {W(0x00008592cff0d6a5), W(0x0000218cca82fe93), W(0x0000b5e52853856e),
+     W(0x00006452cdb5f9c1)},
+    0
+  },
+  {
+    {W(0x0000ba2741a086b4), W(0x0000ce6713c83d20), W(0x0000f813514b410a),
+     W(0x00001ef91ed46390)},
+    {W(0x00008b4788e4b5e7), W(0x00004051533988b4), W(0x000085bf5efd06f7),
+     W(0x0000bc7176f196b8)},
+    0
+  },
+  {
+    {W(0x000080d9484bf60e), W(0x00009423c9bae1ba), W(0x000050d7475caffd),
+     W(0x00003da2522bcff8)},
+    {W(0x00002467464ed7c7), W(0x00005e3256826ace), W(0x0000da7d2be59772),
+     W(0x0000452e30c9cf92)},
+    0
+  },
+  {
+    {W(0x0000fca98a89de9f), W(0x0000e58a999f4ea5), W(0x000005b1983ae6ff),
+     W(0x0000d488fbb425ed)},
+    {W(0x0000c289287bf36b), W(0x0000e26ddabab9e3), W(0x0000e808717fccdb),
+     W(0x00009eeced538987)},
+    0
+  },
+  {
+    {W(0x00003c2cb1913407), W(0x0000cb51bf598151), W(0x0000d82fab5116ab),
+     W(0x000078cc09f497e2)},
+    {W(0x0000962bcc51e710), W(0x000090c2079f4d29), W(0x0000937b7e234d43),
+     W(0x0000ae9967c79d24)},
+    0
+  },
+  {
+    {W(0x00004f79e42b9172), W(0x00002d60ddc0f1cb), W(0x0000ef8315f228c1),
+     W(0x00005e01e2851ec7)},
+    {W(0x000013f0bbd3e634), W(0x0000ee08fa293a41), W(0x00008579cd71ed10),
+     W(0x0000f33d0f8757db)},
+    0
+  },
+  {
+    {W(0x0000b66fb5b2974d), W(0x0000ff536bdac7cd), W(0x000010a64ac55725),
+     W(0x0000c0a15a586342)},
+    {W(0x00007651cb1e2e2a), W(0x00003282d3bc6373), W(0x00008536aed8f42a),
+     W(0x0000a478c4544a66)},
+    0
+  },
+  {
+    {W(0x0000f34c154a9064), W(0x000009c819be3370), W(0x0000ea1d121d5290),
+     W(0x00001fced1b2e1e0)},
+    {W(0x00004b747fc9d734), W(0x0000a2a00968f337), W(0x0000cdc8fd61660a),
+     W(0x00001282954658a8)},
+    0
+  },
+  {
+    {W(0x00002702d1c80be0), W(0x0000cf13797a7bb9), W(0x00002778f0a1b8a6),
+     W(0x0000fcd5c929b643)},
+    {W(0x0000b42ed75ba7e9), W(0x000058de7c9ef160), W(0x0000579429aef92f),
+     W(0x0000d6f26a52a622)},
+    0
+  },
+  {
+    {W(0x0000eabb4094c0a5), W(0x0000a17e785a16c8), W(0x00001cd0c296316c),
+     W(0x0000c3f52ab1f56e)},
+    {W(0x000093d5340e4bde), W(0x00002aaa73ce55e2), W(0x000011a2418c3837),
+     W(0x00002101ba830a2e)},
+    0
+  },
+  {
+    {W(0x000075d0cc1a0ebf), W(0x0000ca84614fe551), W(0x0000f639b29261e2),
+     W(0x000011a5b7b30b1d)},
+    {W(0x0000034eba3ac39a), W(0x0000f60a7927d8a8), W(0x0000085c150c718c),
+     W(0x0000a33bef3df832)},
+    0
+  },
+  {
+    {W(0x0000e42788273e1d), W(0x000079011553f96e), W(0x000029449360e079),
+     W(0x0000e41c0600bc88)},
+    {W(0x0000e7a97866ddbc), W(0x0000b3fdf786c18c), W(0x000034fd0377817d),
+     W(0x0000ece8be6aecbf)},
+    0
+  },
+  {
+    {W(0x000028f9a42c7dbb), W(0x0000e91405f1ab76), W(0x0000ccaa3c484e05),
+     W(0x00001b04c6dfa1ae)},
+    {W(0x0000f26fb4ab7ec6), W(0x0000eab2226247cb), W(0x0000277807ca9741),
+     W(0x000025a56c79f1de)},
+    0
+  },
+  {
+    {W(0x00004e591bdfb1ad), W(0x0000ac7186667861), W(0x0000959b9d3d742d),
+     W(0x000062649623df28)},
+    {W(0x0000d0d876c3491e), W(0x00001b7f85d006ec), W(0x000021016e4923b8),
+     W(0x000059c7984092d3)},
+    0
+  },
+  {
+    {W(0x00007453575cc848), W(0x0000d9b37021a1f6), W(0x00002f4fab487c02),
+     W(0x00006068a6d77fc3)},
+    {W(0x000091ef59a9b75b), W(0x000005ad1c79c06b), W(0x00004106dee52d6e),
+     W(0x0000b3a640d2d6db)},
+    0
+  },
+  {
+    {W(0x000093ec429a1673), W(0x00001bcd992954d3), W(0x0000429e120a8b34),
+     W(0x0000b04d7978cd04)},
+    {W(0x000052fcdb84d25d), W(0x00009d698584c346), W(0x0000a3083a2a6d81),
+     W(0x0000475de3caf44c)},
+    0
+  },
+  {
+    {W(0x0000680f6a077b8e), W(0x00007fd760430044), W(0x00009b1f120e2cfd),
+     W(0x0000572bfe8eb6d3)},
+    {W(0x0000f9db6deef8d4), W(0x0000883fc4d71576), W(0x00005439e007c589),
+     W(0x000030fe631b19ef)},
+    0
+  },
+  {
+    {W(0x0000dcbeda1cbb99), W(0x0000cba4823ce82a), W(0x0000d3596455ef60),
+     W(0x00005c244c077e02)},
+    {W(0x0000821ae9a17fdf), W(0x0000417a0e4913c0), W(0x0000c074358ae1bf),
+     W(0x00004272919ab9ef)},
+    0
+  },
+  {
+    {W(0x0000044ea09cbbea), W(0x0000c377c8d24e6e), W(0x0000c918864cabc3),
+     W(0x000073cd9a23f86e)},
+    {W(0x0000d4e24758b189), W(0x00002adf3f3e0422), W(0x0000360d5bdcc6b8),
+     W(0x0000f4872e36b125)},
+    0
+  },
+  {
+    {W(0x000048f6c6ba9ec9), W(0x0000c57815a4ae2b), W(0x00003894d99b7020),
+     W(0x00003e688ab17a31)},
+    {W(0x0000e7a5a7e1da02), W(0x00000eb4024e6eab), W(0x0000e51bb04c7c6d),
+     W(0x000023a5a1357d47)},
+    0
+  },
+  {
+    {W(0x00001e86df8a5a26), W(0x0000776fa557f5ec), W(0x0000542d02c54f81),
+     W(0x0000f4cebd2a2329)},
+    {W(0x0000f1ecd145b1c1), W(0x000004e464ccfbdb), W(0x00002f669d2657fd),
+     W(0x0000e69dc3687b71)},
+    0
+  },
+  {
+    {W(0x0000dc7ee2bf3af7), W(0x0000aaccb6180e35), W(0x0000a811e6e6ec4a),
+     W(0x0000371a33c35cfe)},
+    {W(0x0000d2ed05a87bc5), W(0x00005070d1d2195f), W(0x00001d8b38a7d8a1),
+     W(0x0000e3381c0abbc8)},
+    0
+  },
+  {
+    {W(0x0000afae83cee5bc), W(0x00009c7dffa80d05), W(0x000075ad10fcaf3e),
+     W(0x0000282ed5bd45e1)},
+    {W(0x0000052828853ff9), W(0x000023218b72e4d6), W(0x0000448361e779b0),
+     W(0x00002bd06879a0c3)},
+    0
+  },
+  {
+    {W(0x0000ba4a93834af6), W(0x0000658a7ec4e917), W(0x0000745d7a76cae4),
+     W(0x0000d2e05b7ca53b)},
+    {W(0x0000433cba10be08), W(0x00007340ccd4844b), W(0x00007cc349fe7f7e),
+     W(0x0000faf5058cb0fa)},
+    0
+  },
+  {
+    {W(0x0000cde2fbd46343), W(0x0000a8446f1c8828), W(0x00005f897ee47fc7),
+     W(0x000049e5c894b932)},
+    {W(0x00002743bb7c4c5c), W(0x0000563604450bf6), W(0x000021ad1c2d3d1b),
+     W(0x0000f472190d2ad1)},
+    0
+  },
+  {
+    {W(0x00007efbf780b21f), W(0x00007fc5b1a60c8c), W(0x0000f11dcf6a6d2c),
+     W(0x000094d43299405f)},
+    {W(0x00002191333e5c0a), W(0x00002257515e29cc), W(0x0000c305a06a9ef8),
+     W(0x00007e20f7dbe3d6)},
+    0
+  },
+  {
+    {W(0x000050f2d786f0cf), W(0x00006694c229358a), W(0x0000cf54ffe97f75),
+     W(0x0000258ae20be878)},
+    {W(0x0000e04727082a8a), W(0x00003664754ea0be), W(0x0000e8abcb15810a),
+     W(0x0000328f8dde8354)},
+    0
+  },
+  {
+    {W(0x0000ad0d21b70a07), W(0x0000994f4bf7ad7c), W(0x0000a3725269c33b),
+     W(0x0000da80df76f657)},
+    {W(0x00008fc50aff62f9), W(0x0000a4e9c79981ad), W(0x0000c27eccf3cc02),
+     W(0x0000659ac4a4d4cf)},
+    0
+  },
+  {
+    {W(0x0000f330fc751bc8), W(0x000020c017afd527), W(0x0000e6df1ec72767),
+     W(0x000038e0356af383)},
+    {W(0x0000c9d61524a04c), W(0x000005f226fb5cbd), W(0x000025c86990ab65),
+     W(0x0000e9de92500135)},
+    0
+  },
+  {
+    {W(0x0000833158bb5c0b), W(0x0000d374cb61c070), W(0x00001d380474b3b9),
+     W(0x00006e135e7d4312)},
+    {W(0x00006bd5cbe40a61), W(0x0000e351f101c5d8), W(0x0000b0a2f3a033de),
+     W(0x000080a632aa6739)},
+    0
+  },
+  {
+    {W(0x0000cc24e4aea2f8), W(0x000041f2ec482c96), W(0x0000f6ca8e19c0a9),
+     W(0x0000684953606ef3)},
+    {W(0x00008b28e95da361), W(0x00005a92444e3268), W(0x0000584414f7bf6e),
+     W(0x000018611ec606c6)},
+    0
+  },
+  {
+    {W(0x0000222db0e43808), W(0x00008d2d435d8c40), W(0x0000a2f0d70f3fbb),
+     W(0x0000cc8f0107ac0d)},
+    {W(0x00001640da4bfa90), W(0x0000ab87cb87357e), W(0x000078bf52784285),
+     W(0x00007e4c739400e3)},
+    0
+  },
+  {
+    {W(0x00009b727b6b6de9), W(0x0000362a86d0e93c), W(0x00008e380695a4d9),
+     W(0x000069f80a9b8e20)},
+    {W(0x000082fba0e66237), W(0x0000c3688fec3333), W(0x0000952e73194518),
+     W(0x000023c7266e3e6f)},
+    0
+  },
+  {
+    {W(0x0000eb8110ac1ca9), W(0x00007a2a030075ce), W(0x00005534deb2a2a8),
+     W(0x0000eb572069bd05)},
+    {W(0x0000736690a33c6c), W(0x0000759fbfc5115a), W(0x00000cef5eff7b30),
+     W(0x00009f106c4874f4)},
+    0
+  },
+  {
+    {W(0x00008e98b9602a86), W(0x000063a37259adc6), W(0x0000a4dcfa87459c),
+     W(0x0000a51579efeca6)},
+    {W(0x0000679c8dd55b59), W(0x0000a019a7e06e25), W(0x00003928025ce99c),
+     W(0x0000cc6f87a32194)},
+    0
+  },
+  {
+    {W(0x0000a23cc0a06779), W(0x000006d3c8b56951), W(0x000020e859d4bcfe),
+     W(0x00001777fc75f8e2)},
+    {W(0x00004075d41a7e14), W(0x0000290f8131e569), W(0x0000cf4bcb0214ce),
+     W(0x00008ada2ad7164c)},
+    0
+  },
+  {
+    {W(0x0000347941ff660b), W(0x0000108cb99e823d), W(0x00007270ba602fee),
+     W(0x0000b6246b3173c2)},
+    {W(0x000093041ec5312e), W(0x0000aee3ed875ff4), W(0x000053b7852f9d1f),
+     W(0x0000ebe0374a30f1)},
+    0
+  },
+  {
+    {W(0x00004784ae1c47a0), W(0x000011ca1b933128), W(0x0000c02a69f560b7),
+     W(0x00009c48744e720f)},
+    {W(0x000011fc505efe06), W(0x0000494f3624b36e), W(0x0000833a21c88770),
+     W(0x000046c78b6cb2c9)},
+    0
+  },
+  {
+    {W(0x0000d75794312b99), W(0x0000ac842dfdfe98), W(0x0000f8df5d100143),
+     W(0x0000b2f98e857834)},
+    {W(0x000017833c9f50b9), W(0x00006d58d16ee149), W(0x0000e1703c5d78bb),
+     W(0x0000dd2fd09bb1e4)},
+    0
+  },
+  {
+    {W(0x0000c1b78e1544b2), W(0x0000bdf19694968b), W(0x0000d86095af4cce),
+     W(0x00001b1e5ff24977)},
+    {W(0x00009cdc1da98fbf), W(0x0000b0625b6913e8), W(0x0000b63a515fbd02),
+     W(0x0000b74517645712)},
+    0
+  },
+  {
+    {W(0x000011d95699c557), W(0x00000a7a6ddd0627), W(0x000049479ed11111),
+     W(0x0000b6fbd439a7c4)},
+    {W(0x0000b22a6a96091e), W(0x0000b27f9c4b114e), W(0x0000da63e976d678),
+     W(0x0000d5be7ea5bf34)},
+    0
+  },
+  {
+    {W(0x0000912fa5d264d2), W(0x000083f4feb2a75a), W(0x00002f8ca27ffac3),
+     W(0x00004f5062977214)},
+    {W(0x0000a46e22f1cbdd), W(0x0000bcb81f298a16), W(0x0000c4ca69d4e5c9),
+     W(0x00008d8e28b5ff5e)},
+    0
+  },
+  {
+    {W(0x0000cdf9c6bdb279), W(0x0000b7fa150355a2), W(0x00007ab4ddf7d996),
+     W(0x0000c2cc29bed20c)},
+    {W(0x000011dd1cf439f2), W(0x000068083b6a60f5), W(0x0000b049f843a8d7),
+     W(0x00001ba7ff510752)},
+    0
+  },
+  {
+    {W(0x00008563c2b00f98), W(0x00005cf739114616), W(0x0000de28fcaa1964),
+     W(0x0000222f30b50922)},
+    {W(0x000055801a2770f1), W(0x0000a9a251ea0fd2), W(0x0000dc67b5889274),
+     W(0x0000b36f9154d489)},
+    0
+  },
+  {
+    {W(0x0000dae2c7fec3a0), W(0x00001995268341b8), W(0x0000870030f79df7),
+     W(0x0000d3bf008a4d4c)},
+    {W(0x0000021ed98e129c), W(0x00002c8bdb6a4414), W(0x0000e8f20fab9f93),
+     W(0x00004d3dcfcc9508)},
+    0
+  },
+  {
+    {W(0x00008da3bda74541), W(0x000050a5984e99f8), W(0x000048fb03af182d),
+     W(0x00002cd197a260ab)},
+    {W(0x00007f05f12e7d76), W(0x0000b1b6baecc789), W(0x0000df2026d5e681),
+     W(0x000003e63801ecd0)},
+    0
+  },
+  {
+    {W(0x0000a8facc190756), W(0x0000f209725162e1), W(0x00002ab3d84ca990),
+     W(0x0000ae712ae14e49)},
+    {W(0x00000a2d1a23763d), W(0x000027f4c2f28899), W(0x00007c477c5e409b),
+     W(0x000080a1ebb08b04)},
+    0
+  },
+  {
+    {W(0x0000b2353d490b86), W(0x0000a781896b1cbe), W(0x0000a31c6f3bdf6c),
+     W(0x00000e42558f71e0)},
+    {W(0x0000ec562a614e77), W(0x00001cf102b21a5a), W(0x0000cad336f23b7d),
+     W(0x0000d274bc026379)},
+    0
+  },
+  {
+    {W(0x0000fe3ee29cbd83), W(0x00002aa2044cfda6), W(0x00001cc36281f900),
+     W(0x000055d97ca242fb)},
+    {W(0x00002dbffd4d68a1), W(0x0000678f7cbedca5), W(0x00006f9daefca1d0),
+     W(0x0000c704ed9913e2)},
+    0
+  },
+  {
+    {W(0x00007f20cfacf354), W(0x00008a8eba3e9996), W(0x000009908d54dfaf),
+     W(0x0000b302538192c3)},
+    {W(0x0000f7f59725f34a), W(0x00008a151305ec01), W(0x0000cf0eec5a1bdd),
+     W(0x0000dd8c5199ee98)},
+    0
+  },
+  {
+    {W(0x0000b835fda31a5a), W(0x0000afd111fd6793), W(0x0000c7e06e0c7ae6),
+     W(0x00008d468e51d315)},
+    {W(0x0000a8c8f2de051d), W(0x000092020794f1e3), W(0x0000e3f77827340d),
+     W(0x0000eb88edbd193d)},
+    0
+  },
+  {
+    {W(0x0000c66db52e64f7), W(0x00001e2c558b1ec4), W(0x0000cb2b40394071),
+     W(0x00001e37dca3ec9a)},
+    {W(0x0000c32672dbf56d), W(0x00009857ee5a8a29), W(0x00008bb292449d76),
+     W(0x0000876ab094c0ba)},
+    0
+  },
+  {
+    {W(0x000029cdac285c3b), W(0x00006ba878f007a3), W(0x00005e927b91e3a4),
+     W(0x0000f5f142567e37)},
+    {W(0x0000bdf25b00bb03), W(0x0000d0e0c16b5fb8), W(0x000098a9b2ac0f63),
+     W(0x00001a0ca21a8229)},
+    0
+  },
+  {
+    {W(0x0000b8d8cf36a447), W(0x00009253ef6365a0), W(0x0000d8ce96f57eb4),
+     W(0x00004ac77b317d56)},
+    {W(0x0000dd5e5775bb62), W(0x000049cf26a2c59f), W(0x0000b68d3ed5b130),
+     W(0x0000eb68ba994765)},
+    0
+  },
+  {
+    {W(0x0000f9674ef475ff), W(0x00009c6bd05edd79), W(0x0000507c65d74b57),
+     W(0x00002668e60916e6)},
+    {W(0x0000479e32575a20), W(0x0000b8b2a19bd970), W(0x000004a3f16a99e6),
+     W(0x0000161373cc7670)},
+    0
+  },
+  {
+    {W(0x000081837cd39a32), W(0x0000e6d225aa5861), W(0x000081b712c0da50),
+     W(0x0000618beee5324a)},
+    {W(0x0000c9d82d3f99e7), W(0x0000515768c739e8), W(0x000079dfed795fa4),
+     W(0x00006a1ee5a4335f)},
+    0
+  },
+  {
+    {W(0x0000bcc4e157e1ed), W(0x0000e628ca5ba9b4), W(0x0000458dec266d62),
+     W(0x0000cba1c4316d09)},
+    {W(0x0000a33a4d73cbaa), W(0x0000a2a3996d654c), W(0x0000b853c1870689),
+     W(0x0000e5e6df4e9f6d)},
+    0
+  },
+  {
+    {W(0x00008ef6bd208d92), W(0x000071ea5b461e33), W(0x0000ce0f84d23d74),
+     W(0x0000da95182dc00a)},
+    {W(0x00000f7de4be4db1), W(0x000064f934ac7001), W(0x00002c5910dcbc69),
+     W(0x0000ecf22a144038)},
+    0
+  },
+  {
+    {W(0x0000c589fd704bbf), W(0x000089a0d789dc7a), W(0x0000004b18430833),
+     W(0x00005d640e2f1b91)},
+    {W(0x00000d53dbab6fc8), W(0x0000fcdbd0524a9b), W(0x0000a1453c7f0088),
+     W(0x0000e05e133294cf)},
+    0
+  },
+  {
+    {W(0x0000075e7b99d298), W(0x00002dc82f14d9cd), W(0x0000469d7e54dbd5),
+     W(0x00005a75e3074fdf)},
+    {W(0x0000433b4b29b7bf), W(0x00000ffc56a23f75), W(0x00002ac4bc806568),
+     W(0x0000cd285db2bc4f)},
+    0
+  },
+  {
+    {W(0x0000fb5181222e8b), W(0x00000946ac6db2ba), W(0x0000a80c5e55087d),
+     W(0x00007e250b468f19)},
+    {W(0x0000fa82e0f367ae), W(0x00008c5271ccea27), W(0x0000d3e318a080df),
+     W(0x00002a94ad38719a)},
+    0
+  },
+  {
+    {W(0x0000532bd1a025f7), W(0x000068dbd2486551), W(0x00000ca5b5692cf2),
+     W(0x0000dd0ac25d5eea)},
+    {W(0x0000efcc5217d93f), W(0x00002fcbb7950ac7), W(0x00005224e1a792f2),
+     W(0x0000f6ba64c0232e)},
+    0
+  },
+  {
+    {W(0x0000c1631db4851c), W(0x0000ecc0c1e426e4), W(0x0000563fd42180a5),
+     W(0x0000903a1e6f1484)},
+    {W(0x000054e972e1b9fc), W(0x00003afb29ffced4), W(0x000064423dd2a631),
+     W(0x00003c172e720417)},
+    0
+  },
+  {
+    {W(0x000051e3868a751e), W(0x0000465f24921327), W(0x0000be61f4c7b67f),
+     W(0x0000ec7bcf5cb2c8)},
+    {W(0x0000d7095a0ab10e), W(0x0000a0b32ca0b4d0), W(0x00008533a02768a4),
+     W(0x0000fa0249c4a552)},
+    0
+  },
+  {
+    {W(0x0000d3e18f4003cf), W(0x0000cd15f416cd8b), W(0x00003c40558632b3),
+     W(0x00004709cecfdb54)},
+    {W(0x0000c8bdd61eeaf5), W(0x000077bb08936b64), W(0x00006c303e42272a),
+     W(0x0000e0d73af432e9)},
+    0
+  },
+  {
+    {W(0x0000b7c39839c9c7), W(0x0000464f5d2e6fd7), W(0x00004ecd7e6aba20),
+     W(0x0000e84c00de891e)},
+    {W(0x0000cab59ece0678), W(0x0000c9ef53c87c24), W(0x000082f708eaa80f),
+     W(0x0000b813d83954b9)},
+    0
+  },
+  {
+    {W(0x00008fbd93f286bd), W(0x0000d0b05fdde813), W(0x000037c3813d4f7c),
+     W(0x0000b52e525b4634)},
+    {W(0x000018f1a6b9e6f8), W(0x0000f5a92bdc7a7b), W(0x00004e8da8ec7013),
+     W(0x0000efee89a950fc)},
+    0
+  },
+  {
+    {W(0x0000055796b21cb4), W(0x0000431a51a5be72), W(0x0000ef9c911dfef4),
+     W(0x0000d88e9f18f361)},
+    {W(0x00003b5ca61f1983), W(0x000092e6c4282da0), W(0x0000c1054630c521),
+     W(0x000078ad1d8a4715)},
+    0
+  },
+  {
+    {W(0x00000ad3ff4a1715), W(0x000064199bd11ead), W(0x0000c7de58151373),
+     W(0x0000250804931446)},
+    {W(0x0000460716af7120), W(0x000083379918ecf9), W(0x0000141a55bcd834),
+     W(0x000012335695677b)},
+    0
+  },
+  {
+    {W(0x0000dce66f7acd00), W(0x0000246d02ac5ffd), W(0x00005c0795e249cb),
+     W(0x00002410497e1a64)},
+    {W(0x0000c8706f136a46), W(0x00003cf436b73f8e), W(0x000027fcfb4d1d98),
+     W(0x000031c708439135)},
+    0
+  },
+  {
+    {W(0x00009554731cd18e), W(0x000094bf3d7bfca8), W(0x00008c3f8de86151),
+     W(0x0000b9210bca0164)},
+    {W(0x0000544bdff610d0), W(0x0000cac03fa99ee5), W(0x000014fcf4af445c),
+     W(0x000044881687cdae)},
+    0
+  },
+  {
+    {W(0x00001e7304d60da7), W(0x0000e411dff5ec47), W(0x00005c2eca4f0a0e),
+     W(0x000073cf74491ce4)},
+    {W(0x0000395658e443e3), W(0x0000ccd69737dc63), W(0x000085baa2fb42de),
+     W(0x000074f49aa6295c)},
+    0
+  },
+  {
+    {W(0x0000be4ede2a1112), W(0x00006dc2d4226700), W(0x00007b15b94d2461),
+     W(0x00009150dec346c2)},
+    {W(0x0000d7d98535d8a9), W(0x00006489a90a896f), W(0x00007f5b81978e3e),
+     W(0x000076a192e39728)},
+    0
+  },
+  {
+    {W(0x0000cb6b9c0f8397), W(0x00000f29bc648707), W(0x0000045c6c9b602f),
+     W(0x000058fe02704543)},
+    {W(0x0000d2ed762c70a3), W(0x0000fc98fdce67f6), W(0x000087529728bd26),
+     W(0x0000695ca902a803)},
+    0
+  },
+  {
+    {W(0x0000d99b05a12421), W(0x0000eda3e80aa919), W(0x000043dc66071756),
+     W(0x00003aff5fa8ceca)},
+    {W(0x000017f923bd61f2), W(0x0000d2e098b2ff5c), W(0x0000141e377acfb3),
+     W(0x00003790fe2c143d)},
+    0
+  },
+  {
+    {W(0x00006fd0b72d081c), W(0x0000ff6b0ce53fe3), W(0x0000b52731caf053),
+     W(0x0000c6e499aabd64)},
+    {W(0x000084ee1c7fc3c9), W(0x00002d377cf9e11c), W(0x00006345c6a064c5),
+     W(0x0000864fc1389c0d)},
+    0
+  },
+  {
+    {W(0x0000e41989be4099), W(0x0000a77a06806e75), W(0x0000a740e4eb1346),
+     W(0x0000b08097f6a59b)},
+    {W(0x0000f83ca639f75f), W(0x0000430f6819f47f), W(0x0000a533eb580571),
+     W(0x000039298b576dea)},
+    0
+  },
+  {
+    {W(0x0000c419472a6868), W(0x000075ffb277dcdd), W(0x0000ffc819093bc6),
+     W(0x00003f78ff4f3379)},
+    {W(0x00000f277f20334a), W(0x000032e1dbc967fe), W(0x000008f518af8447),
+     W(0x000046a745fd0a16)},
+    0
+  },
+  {
+    {W(0x0000f3adcc8cb265), W(0x0000d347446de0bd), W(0x00004be66215783a),
+     W(0x000078e55db6e741)},
+    {W(0x00004c4fa9fa612c), W(0x0000ed494295529e), W(0x0000857e30f735c6),
+     W(0x0000f5edc504d902)},
+    0
+  },
+  {
+    {W(0x0000d33a282da712), W(0x000090103b04fcb6), W(0x00001277fd44c41e),
+     W(0x00001ad4f9797b05)},
+    {W(0x0000ac74ac192c1d), W(0x0000907deeb9994d), W(0x00007fc7c38df453),
+     W(0x00000c25a4988997)},
+    0
+  },
+  {
+    {W(0x0000ee1c422af0e6), W(0x0000873ab67ea944), W(0x0000a9b822994264),
+     W(0x0000bf0a11858e2b)},
+    {W(0x0000e8cd2dc94a21), W(0x00006d69e728567b), W(0x000017b24dd18515),
+     W(0x000048f84e9d8f0f)},
+    0
+  },
+  {
+    {W(0x0000c6454be0fe3f), W(0x0000bf07316033d5), W(0x0000db2062c5fb8a),
+     W(0x000065f782c0b306)},
+    {W(0x0000fb414c3b58b4), W(0x0000436f1c7e0a27), W(0x0000bc69444eaa1f),
+     W(0x000029f6825cb042)},
+    0
+  },
+  {
+    {W(0x00000f81bf04881a), W(0x00007c2b5a9a2ee9), W(0x0000554779557868),
+     W(0x0000f74f4063933a)},
+    {W(0x0000d6611240e4b3), W(0x0000975a70d9d5fb), W(0x0000de59acf94162),
+     W(0x0000a4626c4ccfe0)},
+    0
+  },
+  {
+    {W(0x00005bf5c165994c), W(0x0000cd8ac9dcb3e2), W(0x0000c4f13df1c7b6),
+     W(0x0000d026ca615ea8)},
+    {W(0x00006dd98b8a4b44), W(0x000098e366bf40b8), W(0x0000d633deae2183),
+     W(0x00000d6cddaf5090)},
+    0
+  },
+  {
+    {W(0x0000243eee9ca33a), W(0x00006648842ddabd), W(0x000050b1a42698c1),
+     W(0x0000066d3a26e854)},
+    {W(0x0000ef06e6fb029b), W(0x0000020ea22e9af7), W(0x00008485e5665e7b),
+     W(0x00009be472c726d2)},
+    0
+  },
+  {
+    {W(0x00003eca8e20b08f), W(0x000018c9914f3e3b), W(0x0000106f9556133c),
+     W(0x00009996dffbae90)},
+    {W(0x0000c20912a07e59), W(0x0000de8266c644e1), W(0x00008c2399afb403),
+     W(0x00009c5bc378bf18)},
+    0
+  },
+  {
+    {W(0x0000499c805ffc0b), W(0x0000306046726005), W(0x0000803ecb33b158),
+     W(0x0000e986552a29b9)},
+    {W(0x00003b1e14dd7b41), W(0x0000fd67f677e88c), W(0x0000443f4583969d),
+     W(0x000011aea34e610c)},
+    0
+  },
+  {
+    {W(0x0000409c7ab25d13), W(0x000089e725ddfc15), W(0x00007aed18dec18e),
+     W(0x00002c986bda9766)},
+    {W(0x00002983259f587b), W(0x00002ecea1436d80), W(0x00005015c658c776),
+     W(0x000023d7969d4006)},
+    0
+  },
+  {
+    {W(0x0000bcf9146324a7), W(0x0000c15a1f83c02f), W(0x000095809663b3a7),
+     W(0x0000554abc5319b7)},
+    {W(0x00002f9e45a26c41), W(0x0000c8e365f6c3d5), W(0x0000c184a4935225),
+     W(0x0000eb0482bb338a)},
+    0
+  },
+  {
+    {W(0x0000fa567eb2da76), W(0x00003bb5d3e4d90a), W(0x000089733d498546),
+     W(0x00003d1af1c73663)},
+    {W(0x0000a1645fcbb193), W(0x0000355b59760281), W(0x0000a06799e7af94),
+     W(0x00003ed1a9f333c3)},
+    0
+  },
+  {
+    {W(0x0000412a3d88d1c8), W(0x000019e1358bbf15), W(0x00009e1d52b850f8),
+     W(0x00001842760fe112)},
+    {W(0x0000da96d9c1396d), W(0x0000590c75844430), W(0x0000d3bc9885040a),
+     W(0x00001f7755c27b11)},
+    0
+  },
+  {
+    {W(0x0000615d88db426e), W(0x0000fa89c852c6a2), W(0x0000699171cfd855),
+     W(0x0000b63d8d512557)},
+    {W(0x000056c688de0f7e), W(0x0000ae6592619aef), W(0x0000d70520e932c7),
+     W(0x0000f54a047751ec)},
+    0
+  },
+  {
+    {W(0x00004beca68172e3), W(0x0000e7d8071d38b3), W(0x0000ee7fb465fd7d),
+     W(0x0000e63f7c7de4b5)},
+    {W(0x000046c3a4468aec), W(0x0000c53ee5a50c5e), W(0x000070d5476e493b),
+     W(0x000033a6008fd38a)},
+    0
+  },
+  {
+    {W(0x0000bd187697053d), W(0x00007a1b319387b4), W(0x0000f3bc22141700),
+     W(0x000057459ff35a52)},
+    {W(0x00002b50f422d3fa), W(0x0000ff1e564f1031), W(0x000035186d8bc09e),
+     W(0x000082d20b57545b)},
+    0
+  },
+  {
+    {W(0x000095095b87617b), W(0x0000bdd4fb4ac844), W(0x000065b1c5982982),
+     W(0x0000d0da0998e3f3)},
+    {W(0x00001096e3b706dd), W(0x0000512b24e11136), W(0x00006bcfe93b9d3a),
+     W(0x0000b29b7f992c15)},
+    0
+  },
+  {
+    {W(0x000086cfc0ed5000), W(0x000084fa5646222c), W(0x0000527d9ca0f162),
+     W(0x00008d1d39b2ce0c)},
+    {W(0x00008f210ac806b2), W(0x000007d1eeef93fd), W(0x00000be3f0cf01a2),
+     W(0x000065a97a04f6a2)},
+    0
+  },
+  {
+    {W(0x0000a155e01ade7d), W(0x0000e8ec28fb3986), W(0x0000d2eb1c919db3),
+     W(0x0000be01b97cc9e4)},
+    {W(0x0000f1aa9e8e6966), W(0x00004baa811d2e6f), W(0x0000775cb4c682d6),
+     W(0x0000c03e1b261226)},
+    0
+  },
+  {
+    {W(0x00004b0bddeff4d9), W(0x000075d945b80eda), W(0x0000b7074971fdec),
+     W(0x00000289f2d02f4f)},
+    {W(0x0000c48030375335), W(0x00006e08d0eb260e), W(0x000073346d973a33),
+     W(0x0000f868a6a234e5)},
+    0
+  },
+  {
+    {W(0x0000799d26c6455e), W(0x0000abe4f5039da3), W(0x000024acc4270e01),
+     W(0x0000493bd0769211)},
+    {W(0x00008b74774b5c36), W(0x0000a2ea7cf01ec4), W(0x0000a10f4c9f1bbf),
+     W(0x0000ca93572be1c3)},
+    0
+  },
+  {
+    {W(0x0000f009c05e624b), W(0x0000e0466c1fefa0), W(0x000071341000b408),
+     W(0x00001cc377e44e12)},
+    {W(0x0000cf87ce28b420), W(0x00006f47c00647c0), W(0x00002e9fb643ea5f),
+     W(0x00004a58f365761f)},
+    0
+  },
+  {
+    {W(0x0000b8a89c285cf7), W(0x00000792d1f42066), W(0x000002fe72f0c086),
+     W(0x0000bd3383eac19b)},
+    {W(0x0000f077b3304a4d), W(0x0000eb26c3ec8315), W(0x0000543dbb525c0b),
+     W(0x000038c418eead57)},
+    0
+  },
+  {
+    {W(0x0000b492b7f08463), W(0x00007d21e1a67ecc), W(0x00002f9faf1fe554),
+     W(0x0000fe2a52f1acc1)},
+    {W(0x0000bd60b8954001), W(0x00005f4ebd1998c3), W(0x0000c76d3777f485),
+     W(0x0000fd2e37734887)},
+    0
+  },
+  {
+    {W(0x00004bdaf81e6570), W(0x0000f75aa3bc95fc), W(0x00005424b61d3eb5),
+     W(0x0000146d3ec4983b)},
+    {W(0x0000be655d5ace11), W(0x000016e9642295ff), W(0x0000bb507d0308d4),
+     W(0x0000565e70751519)},
+    0
+  },
+  {
+    {W(0x000066ac4a69cafa), W(0x00007c9794c826cb), W(0x0000a011a406859d),
+     W(0x000043a983591e01)},
+    {W(0x00006bff93a323e9), W(0x0000be773bb4fa88), W(0x00001049de57e87b),
+     W(0x0000e7771eadb147)},
+    0
+  },
+  {
+    {W(0x00002991df51d721), W(0x00004c752ccc3dc7), W(0x0000f9d5bcf9d607),
+     W(0x000004abd90ddcf7)},
+    {W(0x00005c12d2ca5e44), W(0x0000ce89f2dd3bcb), W(0x0000258977c3d05b),
+     W(0x00005f3039212cb6)},
+    0
+  },
+  {
+    {W(0x000026c3a5e2b835), W(0x00001a18cb66a2e1), W(0x0000428887bd37e0),
+     W(0x00002fba84ec9e3e)},
+    {W(0x00005c90fbe3a9a8), W(0x00001cf1081597b0), W(0x0000886f30337560),
+     W(0x00008cef3e7fa259)},
+    0
+  },
+  {
+    {W(0x00002f8e63361e17), W(0x000093b0dc283e24), W(0x000091a7986acc43),
+     W(0x00000e1d8b7b13fd)},
+    {W(0x0000a43ee57871a8), W(0x00004abec638539e), W(0x000038fd1cead55a),
+     W(0x00005e9945924298)},
+    0
+  },
+  {
+    {W(0x000010bffdb80044), W(0x0000fd2bf0d7e016), W(0x0000f5107be120b3),
+     W(0x000057f69db2ea60)},
+    {W(0x0000ac2c64b07819), W(0x0000a88d3a03e859), W(0x0000d02dc2cd7ec9),
+     W(0x00004176871403fc)},
+    0
+  },
+  {
+    {W(0x000064a1015e062a), W(0x00009a493f4ec55f), W(0x00006217df202eed),
+     W(0x0000c35eaa903750)},
+    {W(0x0000a0d709619640), W(0x0000418b8ac86803), W(0x0000c4645a7e6a72),
+     W(0x000023f48d4d98ce)},
+    0
+  },
+  {
+    {W(0x0000047be4b5a1e7), W(0x0000a3e201b6382d), W(0x0000e8614f42d8d7),
+     W(0x00000a4d5703876d)},
+    {W(0x0000ff1b2df83bb7), W(0x000031901ef0f560), W(0x0000fc8c237725af),
+     W(0x000072bfd159ad10)},
+    0
+  },
+  {
+    {W(0x0000122ce1d79f7a), W(0x000062075c79916c), W(0x0000e7140e10f2fa),
+     W(0x000049b0715f0b50)},
+    {W(0x000065f7352e2a7c), W(0x000012fff8796df7), W(0x000061508f788d6f),
+     W(0x0000dba2fd54a608)},
+    0
+  },
+  {
+    {W(0x000002ac0f7f2c18), W(0x000070b6f6ebd332), W(0x0000856ef54c0f69),
+     W(0x0000398b116828f4)},
+    {W(0x0000f1d7baa3d16d), W(0x000092f697fbf15c), W(0x0000808cb1b498f2),
+     W(0x00004c90aa9900c0)},
+    0
+  },
+  {
+    {W(0x0000cba2bf4ef182), W(0x000009d94ec7e032), W(0x000025abe4a06afe),
+     W(0x000059c582ea8db1)},
+    {W(0x0000859c6842a2e5), W(0x0000486e3aacb5ba), W(0x0000c17f869b49ac),
+     W(0x00009539febe219d)},
+    0
+  },
+  {
+    {W(0x0000f66b65291445), W(0x0000cdb34786537d), W(0x000089d56a9f4480),
+     W(0x000038c7d7aa2b49)},
+    {W(0x00003238f4b70bc4), W(0x000030aaf1322ba4), W(0x0000759e721b6519),
+     W(0x00005225727ef58e)},
+    0
+  },
+  {
+    {W(0x00003229305d2b25), W(0x0000df9462465efa), W(0x00004021721d94a4),
+     W(0x0000e79c2ffb1472)},
+    {W(0x0000b9e2f5df9172), W(0x0000f066771d8ae9), W(0x0000dad4c286aa31),
+     W(0x0000bbc190d73a82)},
+    0
+  },
+  {
+    {W(0x000045fa9d2eb019), W(0x0000bfb0721de854), W(0x00005d7e0c2936c2),
+     W(0x00004130c1f1dad9)},
+    {W(0x0000c18ed8e423f9), W(0x0000da00d141893b), W(0x00000e7db765a995),
+     W(0x0000d65501c28036)},
+    0
+  },
+  {
+    {W(0x0000e0ab469d1568), W(0x0000b0c90731b8bf), W(0x00005529d6143507),
+     W(0x00004ee8c7db6af0)},
+    {W(0x0000d6fa53e5ab02), W(0x00005bcaaf8dd9dc), W(0x0000cf43ee62be7f),
+     W(0x00008739cf7c3018)},
+    0
+  },
+  {
+    {W(0x000081b5fa573dd1), W(0x00007b95aa120794), W(0x00002fcc413f5a27),
+     W(0x0000031418c55789)},
+    {W(0x0000a03e281f48b8), W(0x0000db10c42ab4b0), W(0x0000aae1c9674c58),
+     W(0x000081b5c599afdf)},
+    0
+  },
+  {
+    {W(0x000085d6bf8a3091), W(0x0000a59da1c74bfd), W(0x0000170ef649bfe9),
+     W(0x0000a4d197c04914)},
+    {W(0x0000e860bc2f1b50), W(0x00006c89c1f28c6f), W(0x0000095fe396dcc7),
+     W(0x0000a608efacd857)},
+    0
+  },
+  {
+    {W(0x000018a02b597460), W(0x00005d0b12335fd6), W(0x0000c32107140d47),
+     W(0x0000bc4db5ea023f)},
+    {W(0x0000a2676fdeb5a6), W(0x0000741f117cc7ee), W(0x0000d8aa9d61343e),
+     W(0x0000fb885260b9e5)},
+    0
+  },
+  {
+    {W(0x000067700c57db2d), W(0x000082efebccbcb8), W(0x00008764ce90b55a),
+     W(0x0000e657d9f22c3e)},
+    {W(0x00005881a88c1121), W(0x0000d40c6d1d33b7), W(0x00006a1c1e1f41ce),
+     W(0x0000c262e0caae19)},
+    0
+  },
+  {
+    {W(0x0000e75de0809466), W(0x0000faf69b01796e), W(0x0000cfb139de710e),
+     W(0x0000adff858e6df4)},
+    {W(0x00000ad078f76212), W(0x0000933078846680), W(0x0000917e3d741f46),
+     W(0x0000fffb0518a4f1)},
+    0
+  },
+  {
+    {W(0x0000f8aa78a4ce45), W(0x000064fe4ef70622), W(0x0000ab269bb87616),
+     W(0x00002cce07d2ab9b)},
+    {W(0x0000f1b6fd2283c4), W(0x0000c1d2f149439b), W(0x00001a9a420d8bb7),
+     W(0x0000832f23687a58)},
+    0
+  },
+  {
+    {W(0x0000503a1d8f9720), W(0x0000eba570f9538f), W(0x00002a04b7b64ee5),
+     W(0x000006ccc1de1422)},
+    {W(0x000098a847a43dea), W(0x0000eed446e2d115), W(0x0000ede0413b2a9e),
+     W(0x0000ff3c5503f367)},
+    0
+  },
+  {
+    {W(0x0000ec96ba5d0af5), W(0x0000bbe1ae107f98), W(0x000073de45a3e13b),
+     W(0x00008feca22ec447)},
+    {W(0x000056a7fb8122b3), W(0x00000e7a0eaeb402), W(0x00005de943d5ac2a),
+     W(0x00006f1b405ef8e2)},
+    0
+  },
+  {
+    {W(0x0000245c2a59cb4f), W(0x0000ab8bfe952e2f), W(0x00004e5d682c4593),
+     W(0x00002f24edad24b9)},
+    {W(0x00009abdecad5bab), W(0x0000c76053940c13), W(0x00005c4f782506d4),
+     W(0x000024fc34a7581f)},
+    0
+  },
+  {
+    {W(0x0000b6eb6fd5e719), W(0x0000e2c8f34412ae), W(0x00009754eb657ea9),
+     W(0x000053990d75c05d)},
+    {W(0x0000baa2bdc2d133), W(0x00004d09873c959f), W(0x00005f55d688bc0c),
+     W(0x000069b7457ad391)},
+    0
+  },
+  {
+    {W(0x00006c5c1ffc6e60), W(0x0000512a417a35ea), W(0x00009bb51dcd39dd),
+     W(0x0000a69458f71a3d)},
+    {W(0x0000e0d22dc5a74e), W(0x000075daf4f48e25), W(0x0000ef02c4708fc8),
+     W(0x000049f9e760b133)},
+    0
+  },
+  {
+    {W(0x0000b52c8607a431), W(0x0000331648341e15), W(0x000069f39b2cf8ba),
+     W(0x0000cdbe9b1764b0)},
+    {W(0x000068f37dc14559), W(0x00009a5e70357d66), W(0x00003933bacf53e0),
+     W(0x0000436e4477f01f)},
+    0
+  },
+  {
+    {W(0x00007c4ea061c98b), W(0x0000dc10dad314f9), W(0x00008f7b28d74dd5),
+     W(0x0000f3699e054ec9)},
+    {W(0x0000c5c63429f707), W(0x000083a042ad5c6a), W(0x0000605d1623a6e4),
+     W(0x00005035e9c4de30)},
+    0
+  },
+  {
+    {W(0x0000fb8c58f66951), W(0x0000ce82ddcb25e8), W(0x00003a4ef9c01d09),
+     W(0x00003698a0d6ba5b)},
+    {W(0x000057e334ca215e), W(0x0000538f131ca3da), W(0x0000d76d39fd471b),
+     W(0x00008c415d941a6c)},
+    0
+  },
+  {
+    {W(0x00004f9320331190), W(0x000085978dc11c92), W(0x000075ebe484421e),
+     W(0x00009ccfca20f675)},
+    {W(0x0000ddce99056289), W(0x000030b6af566b76), W(0x00004387352a8e70),
+     W(0x000015b3f630a7e5)},
+    0
+  },
+  {
+    {W(0x0000d1e0540e9469), W(0x00009426a0c86707), W(0x00009e5c6f7b56a4),
+     W(0x000063066df219b6)},
+    {W(0x0000367ede6b9630), W(0x000077a358ab1b48), W(0x00005948629ccd68),
+     W(0x00005950b397e97f)},
+    0
+  },
+  {
+    {W(0x000092915edcc3ec), W(0x000014ee83e3000a), W(0x00001514921e76fa),
+     W(0x00008d90ba321b40)},
+    {W(0x000072b65546eec9), W(0x00003711208c6d17), W(0x00002be44e96e4e8),
+     W(0x00003ff0e2ab9e83)},
+    0
+  },
+  {
+    {W(0x00001af4f766a976), W(0x0000e1c7df0a1154), W(0x00003b792e7bf0ad),
+     W(0x000076b0e48b338b)},
+    {W(0x0000a5007408a882), W(0x0000bebc05f2e88e), W(0x0000b00fc5c9ad99),
+     W(0x00008f51b4ae4d38)},
+    0
+  },
+  {
+    {W(0x0000adbeeb400c48), W(0x00000f88975c4e7b), W(0x000020bd10560783),
+     W(0x000078b73b4abc9e)},
+    {W(0x0000c9cc3c144607), W(0x000042cfe9f81322), W(0x0000c483c92b9da6),
+     W(0x00008ff8ef947cde)},
+    0
+  },
+  {
+    {W(0x000061ddbbec891b), W(0x0000aef3ddecc218), W(0x0000f0dcb174dac4),
+     W(0x0000b763021fdbc0)},
+    {W(0x000057fa2a62dd22), W(0x0000e814adee06a1), W(0x000091834f06bf61),
+     W(0x000044789247f6c2)},
+    0
+  },
+  {
+    {W(0x000048b8e04777c8), W(0x00007b07b13a82f4), W(0x00001e343e832aad),
+     W(0x0000355e28b65652)},
+    {W(0x0000326190c260a4), W(0x00009b6cffa17953), W(0x00009471671f75e9),
+     W(0x00009317ca0a4d67)},
+    0
+  },
+  {
+    {W(0x00002e486194964d), W(0x00007e88d61c5fad), W(0x00005278cc9d75e6),
+     W(0x0000b9a73d9e6d52)},
+    {W(0x00008acf0070fe7f), W(0x0000a908fae212dd), W(0x00001c804c8fffa9),
+     W(0x0000b941f348d22d)},
+    0
+  },
+  {
+    {W(0x0000bcdaf8410da5), W(0x000063f22701d8bc), W(0x0000add8df37fe2d),
+     W(0x000069f41f26ab98)},
+    {W(0x000007b68b730830), W(0x00002f0dbcbcbb61), W(0x000053093a4b3a45),
+     W(0x0000924877143c14)},
+    0
+  },
+  {
+    {W(0x0000ea17362aa382), W(0x0000f91cb3f87945), W(0x0000700940202284),
+     W(0x00006565df046ff8)},
+    {W(0x00005138c11709d9), W(0x00005d7e7ac14249), W(0x000028c3a01c53e4),
+     W(0x00006628f31e95a0)},
+    0
+  },
+  {
+    {W(0x000034aee5583dc7), W(0x00009975e4668c41), W(0x000086aac45f31ba),
+     W(0x0000105edbce6672)},
+    {W(0x0000c9305e17d099), W(0x0000ce60f4221638), W(0x0000c42717822efd),
+     W(0x000093830a9c6cb6)},
+    0
+  },
+  {
+    {W(0x00003607f9aa8fae), W(0x0000e065722429ba), W(0x000010194141f33a),
+     W(0x00003321c2669d62)},
+    {W(0x00002ff6d0af528c), W(0x0000076165fbd77f), W(0x0000eb942d1292eb),
+     W(0x0000ce2a55601741)},
+    0
+  },
+  {
+    {W(0x0000cb7603e4e216), W(0x000075ddb7d744d5), W(0x0000abe82aac2061),
+     W(0x000073854d3e632d)},
+    {W(0x00001e4845e54978), W(0x000055ee1828b848), W(0x00003cc88aa6b311),
+     W(0x0000da8ed2f82435)},
+    0
+  },
+  {
+    {W(0x00006338cc786426), W(0x0000d28803ec02c0), W(0x000098e9a39aaa16),
+     W(0x000083d53f0e7891)},
+    {W(0x00001afeef1feab7), W(0x00001f503ca05af9), W(0x0000c77a2ad7cdbb),
+     W(0x0000415279a9faa6)},
+    0
+  },
+  {
+    {W(0x00006dd8bda73fd5), W(0x00003aaf9a0d9fc4), W(0x000020c46c56bd2e),
+     W(0x0000616e89137ed8)},
+    {W(0x00000905ec184a4e), W(0x0000ba68f371cc0e), W(0x0000aa599ac9a37c),
+     W(0x0000e0d2e11800d1)},
+    0
+  },
+  {
+    {W(0x0000c59bb0ce5c03), W(0x000095c13d3a6243), W(0x000006d2e52621da),
+     W(0x0000d12d45d8efc9)},
+    {W(0x0000217e754b7b1b), W(0x00001ca203e5f5cd), W(0x000087f45f075bce),
+     W(0x00005024aeeff74d)},
+    0
+  },
+  {
+    {W(0x00008c4894e3066a), W(0x0000d03bed3f031e), W(0x000071feb22b6979),
+     W(0x000084e7c7441932)},
+    {W(0x0000f7cd7795b06f), W(0x000021f9119ed3b6), W(0x00006d610f8f4744),
+     W(0x000011c2286a109b)},
+    0
+  },
+  {
+    {W(0x0000005b5b2f7d86), W(0x0000fae97c0f53ab), W(0x00007826ae5b170e),
+     W(0x00009b27960bf615)},
+    {W(0x0000f1e3f838d60f), W(0x00001d6015d05268), W(0x0000c63343e8d495),
+     W(0x000019cb3251ad56)},
+    0
+  },
+  {
+    {W(0x000025da36ac5c6f), W(0x00003ce2d6fa49a5), W(0x000022053cae9d34),
+     W(0x0000aba9623c8ec9)},
+    {W(0x000050c8195d94db), W(0x0000da4cc09e7d9e), W(0x0000ab369032f26a),
+     W(0x0000ee83bef43ba5)},
+    0
+  },
+  {
+    {W(0x000066453752a302), W(0x0000fad2deadaf65), W(0x000018069ad8f36f),
+     W(0x000068fd63aa24a3)},
+    {W(0x00009ba1309fba5e), W(0x00007bc5cfb2022a), W(0x0000e7ee09a6ca4f),
+     W(0x0000c761dbe9abf1)},
+    0
+  },
+  {
+    {W(0x0000f665cee8c7b2), W(0x00006379193ae9a4), W(0x0000b8bf2107e637),
+     W(0x00001a7bfbb1b9c9)},
+    {W(0x0000863103adab5f), W(0x000039db969dca41), W(0x0000b60feac81957),
+     W(0x00002807f6d17c4a)},
+    0
+  },
+  {
+    {W(0x0000dcd9612709f7), W(0x0000622b7a12db46), W(0x000038a9f3b2d9f2),
+     W(0x0000f047db0786ca)},
+    {W(0x000087bfcf3d7c70), W(0x000014f1ad7f25e5), W(0x0000b70970b0e86e),
+     W(0x0000dbc761296e41)},
+    0
+  },
+  {
+    {W(0x0000a2ad3cf685ae), W(0x00006e835e62e498), W(0x000027e379e1316c),
+     W(0x0000af55b02fd918)},
+    {W(0x00002a68495ab009), W(0x00008a8b96627a42), W(0x00006fa59770c6be),
+     W(0x00008f54f9c9aa50)},
+    0
+  },
+  {
+    {W(0x0000a11e152306e2), W(0x0000c87e3602297a), W(0x000008938244fd5a),
+     W(0x0000e9ae18188245)},
+    {W(0x00006c65f0ac5c0e), W(0x000085e9428ba35c), W(0x0000a1654f8f6c3b),
+     W(0x000052a5229ae6a6)},
+    0
+  },
+  {
+    {W(0x0000cf1bef9d8cbd), W(0x0000b4579e844e0f), W(0x000012898a94ff03),
+     W(0x00006f2e3eaea2d0)},
+    {W(0x0000c93284f7546c), W(0x0000398aa8f68d20), W(0x000020684d2f6826),
+     W(0x00002855d60647ed)},
+    0
+  },
+  {
+    {W(0x00009d40578c78e0), W(0x00005bafc8557d90), W(0x000062406cb44610),
+     W(0x0000846a8143a6c5)},
+    {W(0x0000a490e0b19096), W(0x000026a19e71feda), W(0x0000ecfbc8ff54ed),
+     W(0x00002abd9abbc210)},
+    0
+  },
+  {
+    {W(0x0000e6cb2aa1a83a), W(0x0000a6d6f293caf7), W(0x0000125ded215510),
+     W(0x00003919ba43210f)},
+    {W(0x00002b0c4c31fef1), W(0x000006e1d872b865), W(0x000072d227e6a06f),
+     W(0x00004ba80f4bf393)},
+    0
+  },
+  {
+    {W(0x000094925f56f0df), W(0x000080401305aedc), W(0x0000e6aff346664b),
+     W(0x0000b79d2efc8967)},
+    {W(0x0000cf44258d5366), W(0x00005364a1f3b6ab), W(0x000043fbe00fe929),
+     W(0x0000b156fb923a53)},
+    0
+  },
+  {
+    {W(0x00002eeabe446535), W(0x0000fa377831360b), W(0x000070cd43e0b147),
+     W(0x0000d24d3ae05e23)},
+    {W(0x0000eb3236ee5004), W(0x0000a92de6fba690), W(0x0000f3a84ad8d00d),
+     W(0x0000f6ea3d29b09a)},
+    0
+  },
+  {
+    {W(0x0000c355f4c6bb33), W(0x00004ee4a2f1029b), W(0x00002c2bdbf6043f),
+     W(0x0000bf91fe309c94)},
+    {W(0x00001c64579aa0a8), W(0x00004e4b617d39a4), W(0x00009e87540f41d8),
+     W(0x00009239326a6200)},
+    0
+  },
+  {
+    {W(0x000085b3a23d89b2), W(0x0000e32c5c5d1abc), W(0x000061bc9fd28ad1),
+     W(0x000097ee6b1a1d59)},
+    {W(0x0000183fab9f9a12), W(0x00005e3637b91d76), W(0x0000bb71515a3e0d),
+     W(0x00003b2c9313837a)},
+    0
+  },
+  {
+    {W(0x00000787aa79d563), W(0x000025c939011364), W(0x000051c00540be58),
+     W(0x0000a85feb1ae1b0)},
+    {W(0x0000696f807a3adb), W(0x00007557a468745f), W(0x0000e288c5041410),
+     W(0x0000193e99bb16cb)},
+    0
+  },
+  {
+    {W(0x0000f0c7ed6bcd8d), W(0x000008c69f220fa3), W(0x0000ac6742bddd84),
+     W(0x000057d1d909e547)},
+    {W(0x00004bc4fd571b00), W(0x000021595daad701), W(0x000036584775ca08),
+     W(0x0000fc599f93aba1)},
+    0
+  },
+  {
+    {W(0x000087dae2733642), W(0x0000283691ebb8c7), W(0x00002892738568c0),
+     W(0x0000fef2cabc599b)},
+    {W(0x0000d95c937cdada), W(0x00000618ac28f10d), W(0x0000cd253f472255),
+     W(0x00005e70c38d7247)},
+    0
+  },
+  {
+    {W(0x0000195e17ab800c), W(0x00009ce76646255c), W(0x0000558c7cd15727),
+     W(0x0000e04cc60a631d)},
+    {W(0x0000d57a3309855b), W(0x0000519002512cd6), W(0x0000c170fe9fea8f),
+     W(0x0000e30ac7e0c253)},
+    0
+  },
+  {
+    {W(0x0000d2b650086b80), W(0x0000b1b977615051), W(0x00009dba3ccd7682),
+     W(0x0000827a0d7a1ac6)},
+    {W(0x000006a2077e066d), W(0x0000c8de9984beec), W(0x00002bfaef19c443),
+     W(0x0000e2f862e097a5)},
+    0
+  },
+  {
+    {W(0x00008a40bfb16eb0), W(0x00008c4a87d07761), W(0x0000e8180d09bff3),
+     W(0x00002dfc007d4435)},
+    {W(0x000023c3244f35c8), W(0x00002ab7c037c50b), W(0x000078363005e085),
+     W(0x0000efdbe6d07fe3)},
+    0
+  },
+  {
+    {W(0x00007fc64ea49106), W(0x000042b64fe51830), W(0x0000638052513673),
+     W(0x00000b00e7f75d40)},
+    {W(0x000092d671c9edd2), W(0x00003941b30062c3), W(0x00007670a59b2129),
+     W(0x0000604ef3983e60)},
+    0
+  },
+  {
+    {W(0x0000db10e3d440ab), W(0x00000afd4c559ef2), W(0x0000203fa7b5cb18),
+     W(0x00007150d4c8cf7f)},
+    {W(0x00008c039e40e119), W(0x0000d1f9a3a2413b), W(0x00002fc10ae01ddf),
+     W(0x00002c34f7ec0407)},
+    0
+  },
+  {
+    {W(0x00001542993553af), W(0x0000fc88d832975d), W(0x0000e023e7394a8e),
+     W(0x00007a8b04b275cc)},
+    {W(0x000001561a71d436), W(0x00000ce904a8507a), W(0x0000cc7cb2c2b9b0),
+     W(0x00001331e523c955)},
+    0
+  },
+  {
+    {W(0x0000250212d9197b), W(0x00006782a2b3c6ee), W(0x0000805146305043),
+     W(0x000073ca67fd83fe)},
+    {W(0x000049ceff8a6f56), W(0x0000551df54a0f0c), W(0x00000db4c109b9f1),
+     W(0x000024bb1d6cc68b)},
+    0
+  },
+  {
+    {W(0x000055d76ab64654), W(0x0000a2f5e678f279), W(0x00001cc5b3593f52),
+     W(0x00003c34c1124112)},
+    {W(0x0000a0be1b8049c4), W(0x0000c9b2204caa66), W(0x0000d0f3d6902c1d),
+     W(0x0000397fffcdb2d1)},
+    0
+  },
+  {
+    {W(0x00007974fa81d66d), W(0x00009fc1dec1ce72), W(0x0000f76f30ee1f45),
+     W(0x00005853b46c0655)},
+    {W(0x0000ec913843a7ee), W(0x0000cecb53a014be), W(0x000075e499d8fcc0),
+     W(0x000014e0a38d7c3f)},
+    0
+  },
+  {
+    {W(0x000058f6c602e250), W(0x000069956d903af5), W(0x00000d84edd21c1e),
+     W(0x0000a3cccb56cd06)},
+    {W(0x0000aa1fe8c9f6c4), W(0x0000e0c260ca7079), W(0x0000b68d6abb5a4d),
+     W(0x000073355edbcd9e)},
+    0
+  },
+  {
+    {W(0x00003a10fc5f6240), W(0x000049d7db16a9d4), W(0x0000604c4c169ce6),
+     W(0x0000c2878735a5d1)},
+    {W(0x0000c79d02f467e3), W(0x0000d47ae99d5ede), W(0x00002c43055764c0),
+     W(0x000061b4bec08bfb)},
+    0
+  },
+  {
+    {W(0x00000bcb9256333d), W(0x0000cb3f362e66e0), W(0x00007200dc60b8d2),
+     W(0x00006a2724adf352)},
+    {W(0x00001895f811654d), W(0x00001b524f510b9b), W(0x000061b5d99a5c09),
+     W(0x0000da432f8c4900)},
+    0
+  },
+  {
+    {W(0x0000b2bdd4dfe9d9), W(0x00001fddb1dc0027), W(0x00002a18cf6dc37e),
+     W(0x0000719d0a455058)},
+    {W(0x00002543167d0e2f), W(0x0000c1ee7bd4ddb8), W(0x000016cba53bd4f8),
+     W(0x0000e607c85c96e0)},
+    0
+  },
+  {
+    {W(0x00009d86c2f4c7c5), W(0x0000e701db4bab99), W(0x0000246c66ead75f),
+     W(0x00004f4886b8ecea)},
+    {W(0x0000911fb80a177a), W(0x0000e071198b3268), W(0x0000ff9156e3b0f9),
+     W(0x000070a09f8afc62)},
+    0
+  },
+  {
+    {W(0x0000a6abb0f7cc46), W(0x00002034ef496e3c), W(0x00005d31b2c67ac2),
+     W(0x000046cca2e9183a)},
+    {W(0x0000a7305123426f), W(0x0000b8aa4ae78b4d), W(0x00001c38396d1d23),
+     W(0x0000991529c0a074)},
+    0
+  },
+  {
+    {W(0x000028061932b7e3), W(0x0000aa1418b0676f), W(0x00004f1366faeded),
+     W(0x00008400cb0ea288)},
+    {W(0x000061d86bbd4833), W(0x00007679487f19a1), W(0x0000e25f9c4556bc),
+     W(0x00006e9b81c0b2d2)},
+    0
+  },
+  {
+    {W(0x00000758f24da9ee), W(0x00001631f134c251), W(0x000021620d84e1b8),
+     W(0x00008060b6710aa7)},
+    {W(0x000009dcc6b70494), W(0x0000a91a79d176d1), W(0x0000a8e4593695c6),
+     W(0x00006c429df3c0d9)},
+    0
+  },
+  {
+    {W(0x000040fcc2420286), W(0x00005d5a9bd4ddc6), W(0x000005e3ae313613),
+     W(0x0000ee88fcc974ba)},
+    {W(0x00007aa02ca3eb32), W(0x00009999399d7804), W(0x000092122d68a1fb),
+     W(0x00005c5f44ba1935)},
+    0
+  },
+  {
+    {W(0x0000af1486f08661), W(0x0000af4d4951439b), W(0x000090a78e0dc38c),
+     W(0x00006236d638b0e6)},
+    {W(0x000013bd96fd6c6f), W(0x000017f052293815), W(0x000013ff509c7869),
+     W(0x0000dcb7343f7f0f)},
+    0
+  },
+  {
+    {W(0x0000296a1aa691c0), W(0x000089da4e0d0a58), W(0x000022dc6d7d0cf8),
+     W(0x000022b8aea9c4c3)},
+    {W(0x000085819038bcf5), W(0x00004556b0220b78), W(0x00000a4516929e00),
+     W(0x0000ffcedd162457)},
+    0
+  },
+  {
+    {W(0x0000be1ecad91f65), W(0x0000592e6977e9dd), W(0x00005818a8276a4c),
+     W(0x0000db2e5b7e8821)},
+    {W(0x0000776d8c5b8c98), W(0x0000ee42a3840ea0), W(0x00001c19958aef6e),
+     W(0x000065800d80e90c)},
+    0
+  },
+  {
+    {W(0x0000c3ef0ff6b0eb), W(0x0000caadd5ac8d52), W(0x0000713ea3293f34),
+     W(0x00006268a112b9da)},
+    {W(0x0000f6892eb9ba1c), W(0x00006142107055ef), W(0x000065400751f130),
+     W(0x000013577c4d9506)},
+    0
+  },
+  {
+    {W(0x0000115b7a8ab978), W(0x0000c670027b0cc4), W(0x000067fdc1f6fa26),
+     W(0x0000be35f44cd53f)},
+    {W(0x0000db4ebcfb2bcb), W(0x00008f29e265d9c5), W(0x0000d8458cd223d1),
+     W(0x0000df306ea23d83)},
+    0
+  },
+  {
+    {W(0x0000914ae6413ee8), W(0x0000fc95821aa340), W(0x00002456efe99d95),
+     W(0x00004c13916f9b97)},
+    {W(0x0000e2b9de7568a4), W(0x00006e5a6b771cad), W(0x0000eee76a4900a3),
+     W(0x00007a69f732f897)},
+    0
+  },
+  {
+    {W(0x0000a33465db033c), W(0x0000be0849116975), W(0x0000082f7cee3a87),
+     W(0x0000bcbcf56369d4)},
+    {W(0x00007a04f4f8438d), W(0x0000218c9523611f), W(0x0000a4bbe3de7c1f),
+     W(0x00007e270faf7a25)},
+    0
+  },
+  {
+    {W(0x0000d4103c4ccf56), W(0x00005b8e1197951a), W(0x00005ab530380e66),
+     W(0x00000c018d271805)},
+    {W(0x000066b4dce0aaa3), W(0x0000b137194ff20c), W(0x0000180a5424aee0),
+     W(0x0000270a24e91778)},
+    0
+  },
+  {
+    {W(0x00000f77923c3096), W(0x00002b13bfdc980d), W(0x0000a54c4735269f),
+     W(0x00008393e969f8da)},
+    {W(0x0000ef9becf2351f), W(0x00003dd9b2c89e67), W(0x0000872828ef83f1),
+     W(0x000030d20093e495)},
+    0
+  },
+  {
+    {W(0x0000263a08dd37a9), W(0x0000ad8c8a942e37), W(0x0000cb26230fddf4),
+     W(0x0000996d05b22902)},
+    {W(0x0000fe4f4dd10627), W(0x0000d99275df8935), W(0x0000683342735237),
+     W(0x000088e8078af6e4)},
+    0
+  },
+  {
+    {W(0x0000fa1638b50cd7), W(0x0000c0deca9db4e8), W(0x0000445621705360),
+     W(0x00002a11d310dac1)},
+    {W(0x00001f5494781e9c), W(0x0000e926a6bd1f68), W(0x00006e50571653d1),
+     W(0x000068d2ac8cf118)},
+    0
+  },
+  {
+    {W(0x0000a27c220f4555), W(0x0000f74cd03cb44c), W(0x0000a2212a804b42),
+     W(0x00000ca05593b4b2)},
+    {W(0x0000e0f524cec69d), W(0x0000dfbdd47c297f), W(0x00003c2bcd21bec2),
+     W(0x00002f1c8501ba54)},
+    0
+  },
+  {
+    {W(0x00004c79cac4e581), W(0x000079ff6d5dd019), W(0x000098dd8ad4c5bf),
+     W(0x00009d43f94d142a)},
+    {W(0x000042abdcbb3fe9), W(0x000083dc7b97d52d), W(0x000032593dc70faf),
+     W(0x00008a1d6f85021f)},
+    0
+  },
+  {
+    {W(0x0000b93023d43298), W(0x00005c23bf1d2c82), W(0x00003240499c3035),
+     W(0x000034e50e46af77)},
+    {W(0x000070d2459ed389), W(0x00001cd15d00405d), W(0x0000f6d489dbc49d),
+     W(0x0000ce5b12a591fb)},
+    0
+  },
+  {
+    {W(0x000045924c93ad19), W(0x00000911e6f4b7a6), W(0x00009b6b0905eba2),
+     W(0x0000e5af8d7c6aad)},
+    {W(0x000010c4bc446842), W(0x0000fb87d3733dcb), W(0x00006115caf2878f),
+     W(0x0000eb7d9bf7b50b)},
+    0
+  },
+  {
+    {W(0x0000334e24c2b391), W(0x000032424fd56b31), W(0x000040f0caeb8b83),
+     W(0x0000eb5a3aeb7531)},
+    {W(0x000032a598c319f6), W(0x00001da2652daad2), W(0x00005fba05deaec0),
+     W(0x0000555a9880fb35)},
+    0
+  },
+  {
+    {W(0x000043c39d5c2c57), W(0x000038d45bbe2c2d), W(0x0000a1d5166b8428),
+     W(0x000001e66eb3c6ae)},
+    {W(0x00001b3fb2553443), W(0x00008eae351b346a), W(0x00002f1bdac0379c),
+     W(0x00008313571e2cbd)},
+    0
+  },
+  {
+    {W(0x0000c38b0e572813), W(0x0000ac67bd821d98), W(0x00004f36fb3a6937),
+     W(0x0000961328f76e33)},
+    {W(0x0000bd035246a795), W(0x000031ba927f497f), W(0x000049f6b048c560),
+     W(0x000072617fd0da63)},
+    0
+  },
+  {
+    {W(0x00002d62a545e479), W(0x0000cb99a93e3344), W(0x0000eed4bbfb513b),
+     W(0x0000098f9cc05b0c)},
+    {W(0x0000952596670f1d), W(0x0000660ffa5ea31a), W(0x000043ca0215c584),
+     W(0x00008bf755baf3b7)},
+    0
+  },
+  {
+    {W(0x00001e5e95cfd2fa), W(0x0000721a16dcb1b2), W(0x00003814361b9c3d),
+     W(0x00000e4f4bf1c2d5)},
+    {W(0x00007472c1864fcd), W(0x0000f4ffc37e940c), W(0x0000b7a4b09bf3db),
+     W(0x00000c29ac0c2a5e)},
+    0
+  },
+  {
+    {W(0x0000b4a9ebf74c89), W(0x0000187cf6431159), W(0x00002202837d9a73),
+     W(0x0000295e7547a74f)},
+    {W(0x000077500f6bf9f7), W(0x00002cc4beb23e39), W(0x00007b99df0de99a),
+     W(0x000028c70a91d474)},
+    0
+  },
+  {
+    {W(0x0000270caa34ee2e), W(0x000081e322498a8c), W(0x0000b24b97a07d1c),
+     W(0x00008d2633288f02)},
+    {W(0x0000b26feda5a3c4), W(0x000016aec2ca6023), W(0x00003fa239eeb837),
+     W(0x000064051ec75701)},
+    0
+  },
+  {
+    {W(0x0000397426de7e9e), W(0x0000fbbc773f551b), W(0x000008ddc726c064),
+     W(0x0000b6ddaf1bb70c)},
+    {W(0x00004bb1d12ecc2e), W(0x0000dc0f7f719b41), W(0x000093cec75e6fec),
+     W(0x00006d6cb09c3bc8)},
+    0
+  },
+  {
+    {W(0x00003ff28b63db88), W(0x0000ebae96ffd1a2), W(0x000086b6fa967e14),
+     W(0x0000b50475b54e5d)},
+    {W(0x00006356d4cd0420), W(0x00006ab57313b4ef), W(0x0000ff5fb21a810b),
+     W(0x00003279b2cb4d62)},
+    0
+  },
+  {
+    {W(0x0000abf4f538c19f), W(0x0000fe6c44807fa5), W(0x0000066ba141525f),
+     W(0x0000974e7ed29eb8)},
+    {W(0x00008a2289069c79), W(0x0000d03865fe1325), W(0x0000f7dc0c699adc),
+     W(0x000001eff418b0be)},
+    0
+  },
+  {
+    {W(0x00009b802fdd3d30), W(0x00005d16b854302b), W(0x00001e3b4ed53b17),
+     W(0x0000760488977f95)},
+    {W(0x00003b560d022dd3), W(0x0000c648e2f6c8a5), W(0x000029e69cb9f8ab),
+     W(0x0000e6ac0cfb1b7e)},
+    0
+  },
+  {
+    {W(0x0000c79ecab2476f), W(0x0000f602e6ebcabb), W(0x0000e7659217321e),
+     W(0x0000b256cdf216c9)},
+    {W(0x00000f7bda674718), W(0x0000e0a5bd81c611), W(0x00009caf0c46ccdb),
+     W(0x00007c679c9a6a79)},
+    0
+  },
+  {
+    {W(0x000089f3ab1f6b15), W(0x0000a233ad52aca8), W(0x0000a4f6862a6dc9),
+     W(0x000031c498dfe28e)},
+    {W(0x0000896a80f3f59d), W(0x0000ad0b179e4dd2), W(0x0000443f36ba89de),
+     W(0x00007302c5f70fe3)},
+    0
+  },
+  {
+    {W(0x00004b4e26a46b8c), W(0x00006789de416f1b), W(0x00008f79c6ca9c2e),
+     W(0x00000e5c10b2b3cf)},
+    {W(0x0000e56cbcea6bbe), W(0x0000d5ab8ecc946c), W(0x0000b61f516e0b4f),
+     W(0x000031959bd67a9c)},
+    0
+  },
+  {
+    {W(0x000042cced8f95f9), W(0x000015d53870e589), W(0x0000ff67470a8090),
+     W(0x0000b4c8c3673b70)},
+    {W(0x0000bfc064711afe), W(0x0000553281bc93d7), W(0x000016f57a583f4e),
+     W(0x0000ec890eddfbda)},
+    0
+  },
+  {
+    {W(0x000044ba6c1732a6), W(0x0000eb1776cbc2e4), W(0x00006fdc09d85086),
+     W(0x0000a6f3ff60eef2)},
+    {W(0x0000c6d32e0df65d), W(0x0000c9c945dadbdc), W(0x00004ed2e31b5e0e),
+     W(0x000098230f828f2f)},
+    0
+  },
+  {
+    {W(0x00004f834bc6fc37), W(0x0000b512b3768e28), W(0x00006251a6323af4),
+     W(0x0000af9568513c8a)},
+    {W(0x00006c705de8c542), W(0x0000083dea39c8d1), W(0x00006358d9ab8404),
+     W(0x0000e8eca5c60134)},
+    0
+  },
+  {
+    {W(0x00003c358c151f5b), W(0x0000cfa44d0b774f), W(0x000083a679867a79),
+     W(0x00009716fbd96d42)},
+    {W(0x0000d896090f6262), W(0x0000d0ed7e86dc7e), W(0x0000222b9b79481a),
+     W(0x000010cc13536a24)},
+    0
+  },
+  {
+    {W(0x0000eaf85bfa5cd0), W(0x00006a697ecec274), W(0x0000bdb811ab12b3),
+     W(0x0000c486eace883d)},
+    {W(0x00003c5a65114c91), W(0x00004490266e32a9), W(0x00004badb5108e85),
+     W(0x000020b8ce02540b)},
+    0
+  },
+  {
+    {W(0x000004cc46e0d3fe), W(0x0000306a9bd74602), W(0x0000eba96cee0756),
+     W(0x0000d1b0844ad4f4)},
+    {W(0x0000eef703bfe945), W(0x0000e77ba1cf7130), W(0x00008af027e09d37),
+     W(0x00007befc1793183)},
+    0
+  },
+  {
+    {W(0x00003ed347f858a6), W(0x000019fb7d2788a8), W(0x00004c783db9592f),
+     W(0x00005753614ce2b6)},
+    {W(0x00006ccdab7193c2), W(0x0000efb84469b24a), W(0x00004f1f2aa69fe4),
+     W(0x000082fa2490fc2d)},
+    0
+  },
+  {
+    {W(0x000064b1320658b7), W(0x0000668d675d40d0), W(0x000079cf66b17818),
+     W(0x00003161849e504a)},
+    {W(0x00005a3a1c1e53d9), W(0x000031ede6484260), W(0x0000fb3d1724885a),
+     W(0x0000692558b1abff)},
+    0
+  },
+  {
+    {W(0x0000c5a7b01c2e92), W(0x00009ea3ba2a23ee), W(0x00000bdd7f05e886),
+     W(0x0000c2cb881ff3e8)},
+    {W(0x0000f6b9ebd988d0), W(0x0000c4a12628c51e), W(0x000050898285d7c2),
+     W(0x0000ba5ad20a774a)},
+    0
+  },
+  {
+    {W(0x00008f800d57dd38), W(0x0000e861e62891c2), W(0x00002f4e3dfe883e),
+     W(0x00006c30fe24e747)},
+    {W(0x0000267c88247d6b), W(0x0000522de1419473), W(0x0000ad76f3356dc4),
+     W(0x000079eda500c573)},
+    0
+  },
+  {
+    {W(0x00005a048041beb2), W(0x0000d3b48c506009), W(0x00008b26cca27d21),
+     W(0x00001ce04a55815e)},
+    {W(0x0000fa940a88ec64), W(0x0000a721bf8aae4e), W(0x00008f2da49306c1),
+     W(0x00006c2d94865512)},
+    0
+  },
+  {
+    {W(0x0000967ce80fe8e2), W(0x00004fff1a2eca33), W(0x000099d8051e3729),
+     W(0x0000649d3e26a02b)},
+    {W(0x00004b3b7f5fbb8f), W(0x00008983c8178416), W(0x000093fb5ff324c4),
+     W(0x000098663a5c010c)},
+    0
+  },
+  {
+    {W(0x0000134e7ae999e5), W(0x000087060af403b5), W(0x0000bba76cb48cbb),
+     W(0x00005f5623e7aef3)},
+    {W(0x00004395775a3d47), W(0x0000316fa2ea9af4), W(0x00006698b058122d),
+     W(0x000020286d2ebc50)},
+    0
+  },
+  {
+    {W(0x0000297037f13477), W(0x00008fdb7f20d2e5), W(0x0000cc2b0319a61c),
+     W(0x0000f0226469f789)},
+    {W(0x000004e45e740a7b), W(0x0000297e6f008c2e), W(0x000093d34c0cff85),
+     W(0x0000fe4d3704266d)},
+    0
+  },
+  {
+    {W(0x000036f358b40684), W(0x0000f15224d1bbf5), W(0x000056c6ec5b656f),
+     W(0x00006767aadcf76d)},
+    {W(0x0000ec9b1e41365b), W(0x00009361d4b0c216), W(0x000051df073cc11e),
+     W(0x0000c221ca18f70b)},
+    0
+  },
+  {
+    {W(0x00007bc7421a99da), W(0x0000b559f8310524), W(0x0000e2ecd4ee199a),
+     W(0x00003f13efc31f72)},
+    {W(0x000094452ad5a822), W(0x0000737c960324d5), W(0x0000fc81e7469909),
+     W(0x0000dcc524783da8)},
+    0
+  },
+  {
+    {W(0x000004157526fa27), W(0x0000d2af78366375), W(0x0000a68807e2fb9f),
+     W(0x000083cc4d704d7e)},
+    {W(0x00007c9e0fb14063), W(0x0000739e311e9233), W(0x0000e530a113d4cb),
+     W(0x0000df2fdc084c5f)},
+    0
+  },
+  {
+    {W(0x00001f7e923c68d5), W(0x0000c2a9919df0fb), W(0x00009b3d7818aed4),
+     W(0x0000b00995b09399)},
+    {W(0x0000ec737c54d05d), W(0x000087783473d9f6), W(0x0000e4231dda5b8f),
+     W(0x000066ffb1c3d0b9)},
+    0
+  },
+  {
+    {W(0x00004932e508b19e), W(0x00002232d525804f), W(0x00007ea1736c8fcc),
+     W(0x000064459949bd11)},
+    {W(0x00007f5b27329d76), W(0x0000f4910795e2e2), W(0x00005507f59f16fc),
+     W(0x0000a9a14c753658)},
+    0
+  },
+  {
+    {W(0x00008be5c5883e6b), W(0x0000109ae323bf8d), W(0x0000e34aef9b5c40),
+     W(0x00001a2ac4774e51)},
+    {W(0x0000e55abd41eeba), W(0x000034a4e2a6678c), W(0x00008c4398f6d360),
+     W(0x000050397c81ee6b)},
+    0
+  },
+  {
+    {W(0x0000a563d485d099), W(0x0000447f27fa6ae8), W(0x00008766863e1157),
+     W(0x0000d74145b907fe)},
+    {W(0x00002e4a369eb1d3), W(0x0000af49f1ef5426), W(0x0000fe9d94c0949f),
+     W(0x0000489970a9081b)},
+    0
+  },
+  {
+    {W(0x000064a6164ca10b), W(0x000032c8e9482bf4), W(0x0000c1d21cc94eb6),
+     W(0x0000ceb65a5f3cc5)},
+    {W(0x000041f336cc6f0f), W(0x00009ee63975f5fa), W(0x0000a9702eb732a2),
+     W(0x0000fca1b74fbea6)},
+    0
+  },
+  {
+    {W(0x0000774fd8b10511), W(0x00009c0e7a887018), W(0x000014618bddb84c),
+     W(0x0000f836166dafc3)},
+    {W(0x000030963bc4f555), W(0x00008f174e4193c0), W(0x0000dae37d654f1f),
+     W(0x0000023c6fec241e)},
+    0
+  },
+  {
+    {W(0x0000a0d45bd1fa37), W(0x0000180390d8d1c0), W(0x000038d20c713a35),
+     W(0x00002c290c01575d)},
+    {W(0x000039e332695786), W(0x0000a431bdbc542b), W(0x0000e0adaa6b9c56),
+     W(0x0000ac719924d353)},
+    0
+  },
+  {
+    {W(0x00004f4bb78644f7), W(0x0000d0095327f413), W(0x00006aa5091860b7),
+     W(0x000027265ee1e298)},
+    {W(0x0000ad5c2e276cca), W(0x00005e050936664d), W(0x0000dc61ee793c59),
+     W(0x0000ef7fe1f29e2f)},
+    0
+  },
+  {
+    {W(0x00002e65168eceb2), W(0x000028e27ed15f0d), W(0x00000010d621fa68),
+     W(0x000004a59aae2391)},
+    {W(0x00007bd86f943599), W(0x00002986eb45a7f8), W(0x00005a43a1c234ea),
+     W(0x000027f65c7d47de)},
+    0
+  },
+  {
+    {W(0x00009113d5aef88e), W(0x0000c84d8b4ad299), W(0x0000022f0fdba751),
+     W(0x000003c243201bfe)},
+    {W(0x000049d0ac5c6be2), W(0x00000e2e09d508f8), W(0x000097a6e01b480f),
+     W(0x00008f33d8d63dcf)},
+    0
+  },
+  {
+    {W(0x00004f6c583d02b6), W(0x00007825b96c9a11), W(0x0000147295577f6b),
+     W(0x000043867e2c8e79)},
+    {W(0x00008a647190170e), W(0x0000fc07d43e95e9), W(0x000011a6142e4583),
+     W(0x0000b0115e931d95)},
+    0
+  },
+  {
+    {W(0x0000a533c81f79fd), W(0x0000dd78ffdca4bc), W(0x000014c83ae501b4),
+     W(0x00006b4d9629b8b4)},
+    {W(0x0000c739c30efc3d), W(0x0000162883be8b42), W(0x0000ca108a0b209f),
+     W(0x00006d5692bfc998)},
+    0
+  },
+  {
+    {W(0x00004b0f1dc23c06), W(0x00005e095ed0aae6), W(0x0000149d0d40723b),
+     W(0x00003196a460f168)},
+    {W(0x00000b6ae0dad173), W(0x0000f95d20273e43), W(0x0000c3674ae2163b),
+     W(0x0000322beb933ddb)},
+    0
+  },
+  {
+    {W(0x00009b43075c7645), W(0x0000e4593944d51a), W(0x000059a84b7b934a),
+     W(0x0000c6731ffac226)},
+    {W(0x00008a8e7401a592), W(0x00008f0589bc1367), W(0x000033efdfba40fe),
+     W(0x000092e2b6605653)},
+    0
+  },
+  {
+    {W(0x00006a211c8254cd), W(0x0000af67c193320c), W(0x00005511e0a00953),
+     W(0x0000457cbd2a32d5)},
+    {W(0x00008e9a04f6ba3f), W(0x0000c6d15712e097), W(0x0000395329019ff8),
+     W(0x0000be44b3cec396)},
+    0
+  },
+  {
+    {W(0x0000387a195e1acd), W(0x0000b7e04a480598), W(0x0000e796dc7a6a8e),
+     W(0x0000d24047247118)},
+    {W(0x000097fb0365b69d), W(0x000006991dcb64c8), W(0x000053bad629e2e8),
+     W(0x0000b3a67a4b6dc5)},
+    0
+  },
+  {
+    {W(0x00006c6df045f94f), W(0x00000eebcf56f8ac), W(0x0000ac172a61312c),
+     W(0x0000f585d8c14e0b)},
+    {W(0x00009cb6255ce48a), W(0x000074dfb34c92eb), W(0x0000ce2dcae988e8),
+     W(0x0000ea4a666bcd3c)},
+    0
+  },
+  {
+    {W(0x00009e8f43fd09dd), W(0x00004768904e28d5), W(0x00005e0a98a3b483),
+     W(0x0000e652ad170115)},
+    {W(0x0000aa6cd1e150ec), W(0x00000f433020884f), W(0x0000600844de756a),
+     W(0x00006d7d7d73889f)},
+    0
+  },
+  {
+    {W(0x0000116179d17026), W(0x0000561344f30cc4), W(0x00004906b5a5c983),
+     W(0x0000046c72c18b8d)},
+    {W(0x00004d71f0ff7e39), W(0x00004ec75f97fbef), W(0x000047bbb24f7e47),
+     W(0x0000a506ba62be1a)},
+    0
+  },
+  {
+    {W(0x000069dea1c7ed45), W(0x0000741fd16b992f), W(0x00001ebbfe0600a2),
+     W(0x0000ec55bfd67d0c)},
+    {W(0x000000730f19ed05), W(0x0000a9d43510ef20), W(0x0000f54b2364911a),
+     W(0x0000097d97acb414)},
+    0
+  },
+  {
+    {W(0x000087547e4c5df5), W(0x00004ddc316a52e5), W(0x000083c7b2825cb7),
+     W(0x0000957fe0a2f4b1)},
+    {W(0x0000c1a8e11b2620), W(0x0000f90131947adf), W(0x0000102dbaa07f1e),
+     W(0x000056ef1d8f66f5)},
+    0
+  },
+  {
+    {W(0x00009694243b0f60), W(0x000047a8290819d6), W(0x00005fdc8ed87c99),
+     W(0x00001db6d9b4fa42)},
+    {W(0x000046da347bd454), W(0x0000998863da9da7), W(0x0000bea070d5dd4a),
+     W(0x0000a8186f1413de)},
+    0
+  },
+  {
+    {W(0x00002b61ed8d739d), W(0x00003ee09252ac1f), W(0x00004d02a4178d5c),
+     W(0x000081f1df844a3e)},
+    {W(0x00001be944083485), W(0x0000c46dbf6d4069), W(0x0000f2b4f3185c60),
+     W(0x0000e3057d5f33ad)},
+    0
+  },
+  {
+    {W(0x00007b9f4b08877b), W(0x0000ba538f04448d), W(0x0000116a4b850b8a),
+     W(0x0000f49f96350e5f)},
+    {W(0x0000e1e8b5ee97e2), W(0x00008e5307db98d7), W(0x00000082536aefe4),
+     W(0x0000686b9a10c528)},
+    0
+  },
+  {
+    {W(0x000012862b1ed23e), W(0x00001b2ca11a17cc), W(0x0000ab69acbc1bd1),
+     W(0x00000df48a3fe5e9)},
+    {W(0x00006ac6cb103c5a), W(0x00000c7a777e7ca3), W(0x0000586af1fb6b02),
+     W(0x0000fc529f02d89b)},
+    0
+  },
+  {
+    {W(0x00008073560ddc06), W(0x0000a7f5c72e9fd0), W(0x0000a80194baf4ca),
+     W(0x00003d50910e5c71)},
+    {W(0x00007b6fd971edb6), W(0x0000f18848f512b9), W(0x000065bfdf92770b),
+     W(0x0000e0f00bdcc7b0)},
+    0
+  },
+  {
+    {W(0x0000a890e71b245d), W(0x0000752867fe7163), W(0x00004d73e4438c37),
+     W(0x0000b78885be0aa5)},
+    {W(0x00006f12ea08acae), W(0x00002e948909c2e2), W(0x00005e9c56133840),
+     W(0x00003ea6417ef184)},
+    0
+  },
+  {
+    {W(0x0000527a3b12cabe), W(0x000043f8de64490c), W(0x0000943ede5fd7c8),
+     W(0x00004364701adb18)},
+    {W(0x0000377aa3973102), W(0x0000a41548425a6c), W(0x00005dcb2be9a5a9),
+     W(0x0000960105c5c144)},
+    0
+  },
+  {
+    {W(0x00004be69df21e36), W(0x00008f193f96a387), W(0x00004df9400aa69e),
+     W(0x0000f7b64cc2c939)},
+    {W(0x0000ece8b6a2c2cb), W(0x0000347b01e5fadf), W(0x0000798c891f57b3),
+     W(0x0000fe2d93a42817)},
+    0
+  },
+  {
+    {W(0x00001425b7f5e7c5), W(0x0000c58b2d1e522e), W(0x000084c598648be1),
+     W(0x00002c298f0fdf25)},
+    {W(0x0000c44002e7a718), W(0x0000a5fdfb9085af), W(0x0000374610e613d5),
+     W(0x0000b8c3092ab132)},
+    0
+  },
+  {
+    {W(0x00004dad71a92f98), W(0x00008c2e3328e671), W(0x000008b7fa7c12b9),
+     W(0x00001eeee11b22b4)},
+    {W(0x0000a37cf8680b08), W(0x000093d938cc6848), W(0x00008883a4665fb9),
+     W(0x0000e37c89ab6e25)},
+    0
+  },
+  {
+    {W(0x000017489f2682aa), W(0x0000465974b4d310), W(0x0000c8a9d6fcab36),
+     W(0x00004251e6ce85e0)},
+    {W(0x00006bb150f28066), W(0x0000b41f2e29f86f), W(0x0000543a2fdb398e),
+     W(0x0000fd0d464b8d49)},
+    0
+  },
+  {
+    {W(0x0000d5c30040dce5), W(0x00004c5166558205), W(0x00009573a61f1703),
+     W(0x0000ec17889680bb)},
+    {W(0x00006b4f38752d9f), W(0x00002717475cedf6), W(0x0000a2083115415d),
+     W(0x0000f789643c6d57)},
+    0
+  },
+  {
+    {W(0x0000c95ce3224c3c), W(0x0000e6cc29b0dd5b), W(0x00009c450b20dfd4),
+     W(0x0000485b57cf9157)},
+    {W(0x0000a0398174c7de), W(0x000094b0c9adc76f), W(0x000083a0ed948102),
+     W(0x000027455d52b872)},
+    0
+  },
+  {
+    {W(0x00009e455006b6a6), W(0x0000482714ca8eb4), W(0x0000f9ca90240f8b),
+     W(0x00002d2f80bbbcc0)},
+    {W(0x00004768bc5e02f1), W(0x0000c86bd027a103), W(0x000047f10d29da28),
+     W(0x0000aa49b7de15a8)},
+    0
+  },
+  {
+    {W(0x0000fa7c53951b9f), W(0x00003fb29f04a89a), W(0x0000d5e0b0ae8297),
+     W(0x0000cf2e9c0e936f)},
+    {W(0x0000bfdfcd8c77cd), W(0x0000d45069c7438c), W(0x0000a5d25641b373),
+     W(0x0000af9b5c570376)},
+    0
+  },
+  {
+    {W(0x0000600a4b2840f2), W(0x000094fa2ae00a24), W(0x000096bf9c2f7214),
+     W(0x0000295c885f42c6)},
+    {W(0x000099e50f4bd733), W(0x0000a0195995dd08), W(0x0000e09248396381),
+     W(0x00006fc0ed3c9e78)},
+    0
+  },
+  {
+    {W(0x00001f8a56a23dbc), W(0x00007932d118f1d7), W(0x0000ed386b7e20b6),
+     W(0x0000f8acd6eb924b)},
+    {W(0x000062c5e5dfcbdf), W(0x0000338c6d8dee50), W(0x0000152baf0ad0dd),
+     W(0x00003faa93afcc56)},
+    0
+  },
+  {
+    {W(0x00005112f4e809b3), W(0x000043c8b7973889), W(0x0000a1cfb9fcc163),
+     W(0x000053d1a8ac94fc)},
+    {W(0x00001404b2e199eb), W(0x0000826491d1e431), W(0x00003d5d4c9106bd),
+     W(0x0000a9842a7d1619)},
+    0
+  },
+  {
+    {W(0x0000208fc12a7f30), W(0x00005ac9d3c7a566), W(0x00001105906965cb),
+     W(0x0000c6913ccba2c1)},
+    {W(0x0000000633e5b827), W(0x0000a3b2a2d06cba), W(0x0000f3f4cf250738),
+     W(0x00009e1fa92a6fe7)},
+    0
+  },
+  {
+    {W(0x000063970354faec), W(0x0000a40b0aceb8f8), W(0x00000f982d92e81b),
+     W(0x00009e9f3868c519)},
+    {W(0x0000fe0db85b7f9b), W(0x000094302ded5cd9), W(0x0000bc40ee5755ba),
+     W(0x0000f203902d6a63)},
+    0
+  },
+  {
+    {W(0x00001b7a0d31040c), W(0x0000684488045dd5), W(0x0000c094619664be),
+     W(0x0000f0c33788072c)},
+    {W(0x0000ed8ae4f72338), W(0x0000d0ae2a8823ba), W(0x000036015848ca52),
+     W(0x0000e4814e92a252)},
+    0
+  },
+  {
+    {W(0x0000971c76b975f7), W(0x0000809eba8ed6ea), W(0x0000e1dbd3474e49),
+     W(0x00001d5ae7b63485)},
+    {W(0x0000322bf8fbfd09), W(0x000087f230d6cd20), W(0x0000aa4a4d5e2ec6),
+     W(0x00004cfd4a8e5c04)},
+    0
+  },
+  {
+    {W(0x00002f9c62e8141a), W(0x000055d7ed2ed3af), W(0x000040627249974f),
+     W(0x000090142976204e)},
+    {W(0x00004802447e4ac4), W(0x0000456e9a167809), W(0x0000522f749ba71d),
+     W(0x00006feac3914809)},
+    0
+  },
+  {
+    {W(0x0000937246cf5e1d), W(0x0000508206cfb63f), W(0x000071cad6a90e93),
+     W(0x0000221989c46e42)},
+    {W(0x000040c762753c28), W(0x00001e2106a6f2d5), W(0x0000b12e537f3440),
+     W(0x00001a00dfe599c5)},
+    0
+  },
+  {
+    {W(0x00001b1036bc3c4d), W(0x0000c99139356d7f), W(0x0000c3fbcb3ca4cd),
+     W(0x0000a4d5ac6a4e42)},
+    {W(0x00004474058a1b57), W(0x00008bacad272fc7), W(0x00006d0673f699c9),
+     W(0x0000210ca10b4979)},
+    0
+  },
+  {
+    {W(0x00005c53c28d1ea2), W(0x00000d1b3cdfe2ad), W(0x00001cf662c4be99),
+     W(0x0000547706f1d68e)},
+    {W(0x00008424aaf4a4f5), W(0x00009d2bdf798a6a), W(0x00005ae5510e131c),
+     W(0x00007d392ddf5606)},
+    0
+  },
+  {
+    {W(0x0000a8941c382428), W(0x00008b0df34275fd), W(0x0000726d1828d4f9),
+     W(0x000002af3fadb773)},
+    {W(0x0000cc2ec5f679ca), W(0x000073acfde7f2a9), W(0x00001ecc03d8a369),
+     W(0x0000cab804e53d1e)},
+    0
+  },
+  {
+    {W(0x00002c0bac229e89), W(0x00003405da8a8fcf), W(0x0000269fb5b4edab),
+     W(0x0000b1fa4dd667bd)},
+    {W(0x0000d8570c8d0754), W(0x0000076e215427ae), W(0x00001b0a55ecb264),
+     W(0x0000dda8a37fdcb1)},
+    0
+  },
+  {
+    {W(0x0000581afc97ae96), W(0x00005d04c32d5361), W(0x00000f53de170db7),
+     W(0x0000e2a71b120c1e)},
+    {W(0x00001c73a6011f26), W(0x00007eeb989aa176), W(0x000041c1c18c587b),
+     W(0x0000fb2d76498000)},
+    0
+  },
+  {
+    {W(0x000004d54904adfd), W(0x0000cc7481278caa), W(0x0000b028c2886f81),
+     W(0x000047277b2d561d)},
+    {W(0x0000126651c527cd), W(0x0000c602d9375625), W(0x0000ea42ff3fe849),
+     W(0x00002590e7f3f0d9)},
+    0
+  },
+  {
+    {W(0x000053512b630c72), W(0x000015fccfa8f3ba), W(0x0000c09967d2cc99),
+     W(0x000029845b1f163a)},
+    {W(0x0000c66007e9da4c), W(0x0000233144088dc6), W(0x000074e313feb088),
+     W(0x000051b4d617b95e)},
+    0
+  },
+  {
+    {W(0x0000d70636f2d05f), W(0x00005e57ae6b4782), W(0x00004a16f41f419e),
+     W(0x00005998321727f7)},
+    {W(0x0000423890a73746), W(0x00001cf7ebefb380), W(0x00009459365bb82a),
+     W(0x00006edab555be4a)},
+    0
+  },
+  {
+    {W(0x000047cedcf3786e), W(0x0000a9b8e813b234), W(0x000031ca81a0a3a9),
+     W(0x0000789e8efbdea1)},
+    {W(0x0000491be635f45a), W(0x00005a84a538cbfe), W(0x00008953ea5192d8),
+     W(0x0000a678663701d8)},
+    0
+  },
+  {
+    {W(0x0000d66dfb01f8d6), W(0x00009d8a75278f62), W(0x0000519e9f15536d),
+     W(0x0000fbb4c2927fe8)},
+    {W(0x0000cceb64413163), W(0x00000b497ec6a6bd), W(0x0000394832266c99),
+     W(0x00002bd5db1fb6ba)},
+    0
+  },
+  {
+    {W(0x0000cf58e92572f5), W(0x0000f6bdd165f1bd), W(0x000000a9b902265b),
+     W(0x00008838197276d1)},
+    {W(0x0000fa8ff4a3a9e6), W(0x0000fbab29b9acbf), W(0x00008036b1165ffd),
+     W(0x00001f2f2d0e5e42)},
+    0
+  },
+  {
+    {W(0x00007ea09e16b5bc), W(0x0000e902dc7b98fd), W(0x000026a87a7ad0ea),
+     W(0x00004babb1a0e802)},
+    {W(0x00003b94d21aceb5), W(0x0000e0c7b9fd9ffd), W(0x0000d54ad1f83d7c),
+     W(0x000065393d994146)},
+    0
+  },
+  {
+    {W(0x0000ef28bd901e73), W(0x0000cf1b1d5b81cc), W(0x00009e02f857edae),
+     W(0x00005133f4b5b7d8)},
+    {W(0x0000860430c7b790), W(0x00008f732478e572), W(0x0000304d090ec783),
+     W(0x00008178db710f94)},
+    0
+  },
+  {
+    {W(0x000036e2baf0dab6), W(0x0000369b70dbe721), W(0x000081e67d51ca59),
+     W(0x0000184f26bfe549)},
+    {W(0x000094490309cba0), W(0x0000d3a1b5a99465), W(0x0000e2075616d5a8),
+     W(0x000039dcd9fe5893)},
+    0
+  },
+  {
+    {W(0x0000b178a7b1357f), W(0x0000f9fa5de7bfa9), W(0x0000e4566bfaa4a1),
+     W(0x00005751e4533b5a)},
+    {W(0x00000a7a29fcc65c), W(0x0000d78c041b17da), W(0x00005d9db527accd),
+     W(0x00004d8cd114c994)},
+    0
+  },
+  {
+    {W(0x00008692830c9f0c), W(0x0000338ee69c8b41), W(0x0000991a79a45d1f),
+     W(0x000049cb7567e5d3)},
+    {W(0x0000091eb8d0f74b), W(0x00006b8442d44e29), W(0x000017d74ad824c1),
+     W(0x0000f0dff8ceae5f)},
+    0
+  },
+  {
+    {W(0x0000dab39ee151ea), W(0x0000f24189ef4297), W(0x0000832534e96ee7),
+     W(0x0000560d313213ec)},
+    {W(0x0000f9b789076af7), W(0x00003584da61446c), W(0x0000e37be7045f79),
+     W(0x0000573422855bb7)},
+    0
+  },
+  {
+    {W(0x0000ac62d50b6a90), W(0x0000191b88c93904), W(0x0000ad0bfd553d3a),
+     W(0x00001d324c1c0bdd)},
+    {W(0x00002965c46ed623), W(0x0000d4488265deab), W(0x00000ee932d1f76e),
+     W(0x00000704a218efb7)},
+    0
+  },
+  {
+    {W(0x00007bdccd933efa), W(0x0000973012bc3c94), W(0x0000b7ad68a09c18),
+     W(0x0000e52387b1a224)},
+    {W(0x0000b255073e89ac), W(0x00000e552c63efeb), W(0x00006237796783b8),
+     W(0x00005f0dd5fcf3ce)},
+    0
+  },
+  {
+    {W(0x00000754a6c24d90), W(0x0000b0bc452ccf77), W(0x0000370322ed8f33),
+     W(0x0000b68ea3cefcfd)},
+    {W(0x0000e808f581f6c3), W(0x00006064d32f67a0), W(0x00000962d4f30dfd),
+     W(0x000083fd738816f0)},
+    0
+  },
+  {
+    {W(0x0000893916c52886), W(0x00008fc892a4efa5), W(0x00001dbe7c9255fe),
+     W(0x0000285a4a977cb8)},
+    {W(0x00007de055f9ed66), W(0x00007b80068c6ec3), W(0x00001c496e9cc909),
+     W(0x000032f1f2938896)},
+    0
+  },
+  {
+    {W(0x0000931059117da2), W(0x0000b225c836117b), W(0x0000ab3fe8e6a137),
+     W(0x00004ce22b8668fd)},
+    {W(0x000023129fc24af0), W(0x0000622bfe1f79bc), W(0x00006367c5fa356d),
+     W(0x000016dd62609031)},
+    0
+  },
+  {
+    {W(0x000023182a1edbfe), W(0x0000396681e3382c), W(0x000095bfecdf4739),
+     W(0x00003b9d47316b90)},
+    {W(0x0000c3b23c3c1052), W(0x00000cfdf5069bf7), W(0x00005d75ffd92a96),
+     W(0x00002c8e7f381b58)},
+    0
+  },
+  {
+    {W(0x000018931a02b601), W(0x0000424ab55871ca), W(0x00009609b5a439c4),
+     W(0x00005914ce06bef6)},
+    {W(0x0000d74e97a5a53d), W(0x000005431c94028d), W(0x00000e93ab81d4f0),
+     W(0x0000796a095f2fe3)},
+    0
+  },
+  {
+    {W(0x0000a47264f9b3ad), W(0x0000785131126f28), W(0x00001db2e13ae595),
+     W(0x000048096de9ac3f)},
+    {W(0x0000216d95d774b1), W(0x0000ef4b6baf6d87), W(0x0000cc1683132b36),
+     W(0x000093bd92a5d434)},
+    0
+  },
+  {
+    {W(0x00000fc64c7d7895), W(0x0000caf67fc3b889), W(0x0000954e10e329e2),
+     W(0x00000852b9715598)},
+    {W(0x0000ab833e140a8d), W(0x00000320144b1bca), W(0x0000a8704473edf8),
+     W(0x000004e16fda12f3)},
+    0
+  },
+  {
+    {W(0x000028cf033ca35c), W(0x000073300832b652), W(0x0000068b09325402),
+     W(0x0000bd18914a4990)},
+    {W(0x00005950079f8780), W(0x00000c609a1c08a5), W(0x0000f81a07b2fa8f),
+     W(0x00009b1c88206a61)},
+    0
+  },
+  {
+    {W(0x000011a20c22baaa), W(0x0000dc41bb6f56a4), W(0x0000af7e0d4abb8c),
+     W(0x0000987174c53706)},
+    {W(0x0000203c1e4b86e1), W(0x00006b670288c5b7), W(0x0000014ccf3faf09),
+     W(0x0000dfb4949c75d5)},
+    0
+  },
+  {
+    {W(0x0000bc6297f8e77a), W(0x0000723ba3352d3b), W(0x000056be4a4b927d),
+     W(0x00007a466fb8dad4)},
+    {W(0x0000e585ab8940a6), W(0x000071ccb2670a44), W(0x0000c1ba646d4e40),
+     W(0x00002c17bb76cd49)},
+    0
+  },
+  {
+    {W(0x00006e923e0e6bfc), W(0x0000bb7df8b07afa), W(0x000050eb3db028cb),
+     W(0x0000ebe21bd33fb9)},
+    {W(0x0000ac36a659395a), W(0x00000785eb596b73), W(0x00007edafb875744),
+     W(0x00001bc17d63fe48)},
+    0
+  },
+  {
+    {W(0x00001a429909cd35), W(0x0000f1105e56ac9f), W(0x00002f18412fe748),
+     W(0x0000514a19149547)},
+    {W(0x00006bdfcf1a8bb7), W(0x00000eba2e8b36f9), W(0x00005412ba8723f5),
+     W(0x00002b5ee0229e28)},
+    0
+  },
+  {
+    {W(0x00009c262aac6247), W(0x0000fd294c446162), W(0x0000b647d5fbc50c),
+     W(0x0000420b83ad602e)},
+    {W(0x0000bbc7962333d8), W(0x00009b70d2015bbc), W(0x0000eabf25e7e8e6),
+     W(0x000053ea88e0c9ae)},
+    0
+  },
+  {
+    {W(0x0000f2011e8416e7), W(0x000083599a14f819), W(0x000029dbba1e8dbf),
+     W(0x00006a097337fd4d)},
+    {W(0x0000f6579347a428), W(0x0000424cbf30f537), W(0x000055c2f9818bd6),
+     W(0x000064550fb146f7)},
+    0
+  },
+  {
+    {W(0x0000bfb58075c1e0), W(0x00009bc49c9387a4), W(0x0000c49d80f54892),
+     W(0x0000967ff7def0b4)},
+    {W(0x000083dcb0d009e8), W(0x0000049e54b550b2), W(0x00004f23d1d53a0b),
+     W(0x000040a38e15b770)},
+    0
+  },
+  {
+    {W(0x0000a1c163906aba), W(0x0000d9c588b853cd), W(0x0000ff4412ad861a),
+     W(0x000054a042cd4e6f)},
+    {W(0x0000d75b4563051e), W(0x0000e70bf6650785), W(0x00002fc1e4d18eff),
+     W(0x0000ea19ff02231b)},
+    0
+  },
+  {
+    {W(0x00007b87e61660a2), W(0x0000b421faf1e98e), W(0x0000a2c2fb0421c3),
+     W(0x0000639db0bf2f44)},
+    {W(0x0000640f7c8f8b93), W(0x0000f41f2d92dea7), W(0x0000fb8496e20227),
+     W(0x00008b787efdb255)},
+    0
+  },
+  {
+    {W(0x000089a1075ce9d0), W(0x00003c9cf8b28ff3), W(0x0000003be41eecb0),
+     W(0x000058b4f4986c37)},
+    {W(0x000089f30f5789b6), W(0x0000a4afe3fdc287), W(0x0000320ee8c9dfa6),
+     W(0x0000770c216b9dab)},
+    0
+  },
+  {
+    {W(0x00004f4cfab50ff5), W(0x0000749065f8b49e), W(0x0000774d13d2952a),
+     W(0x0000a4cd1cf98a06)},
+    {W(0x000050c74e8dc777), W(0x00002f1162ad7a9b), W(0x0000f0baf6c86aef),
+     W(0x00003f8e8af22806)},
+    0
+  },
+  {
+    {W(0x0000d30ae9c127e4), W(0x000036ac192c84cc), W(0x000007f8acf8bea9),
+     W(0x000018d27c1e9fa0)},
+    {W(0x0000a5ab0c18c233), W(0x00007985909d9f37), W(0x000020393209678c),
+     W(0x0000ac450d053adb)},
+    0
+  },
+  {
+    {W(0x0000112df159c5ce), W(0x000069044ab20707), W(0x000093280fe4e6cf),
+     W(0x000028dfcc120c7d)},
+    {W(0x0000bc0761d7ac31), W(0x0000034af416421f), W(0x0000160a03f78d10),
+     W(0x0000b2a80876c17f)},
+    0
+  },
+  {
+    {W(0x0000fce4a8a762b1), W(0x0000469239fbd610), W(0x0000892acab4d5ca),
+     W(0x000002bec25e02f3)},
+    {W(0x00007772a09d5bfb), W(0x0000c07702ea57be), W(0x000036d519b2573d),
+     W(0x0000d33258911f40)},
+    0
+  },
+  {
+    {W(0x0000cdcfe976fc76), W(0x000018e4aa8dae72), W(0x0000dfbf79455ab1),
+     W(0x0000d87e77cbbf24)},
+    {W(0x00007a9b53ef0429), W(0x0000c7f379b761af), W(0x0000528c9e40e434),
+     W(0x00005dda3f944f82)},
+    0
+  },
+  {
+    {W(0x0000d5f885ac388f), W(0x00003771fc144f14), W(0x0000b1b7583bb906),
+     W(0x00000f599a8db697)},
+    {W(0x00002084e73a8cef), W(0x0000d685054a5e6e), W(0x00002f74bec48aaf),
+     W(0x00006107f82445e9)},
+    0
+  },
+  {
+    {W(0x000063bcc3026e66), W(0x000089ba8cd726c0), W(0x00007c39b0ee3794),
+     W(0x000061c603601c34)},
+    {W(0x000031a738fce625), W(0x00008c48234e2892), W(0x0000fb8cefce53e3),
+     W(0x0000a3362c3d98df)},
+    0
+  },
+  {
+    {W(0x0000fef924b5bd70), W(0x00008db8066479a4), W(0x0000d8b3308b883e),
+     W(0x00009314fb805b99)},
+    {W(0x0000e839ef93d7f5), W(0x0000abca6c79aec9), W(0x0000405d8805893c),
+     W(0x000016ae9bd9dbc5)},
+    0
+  },
+  {
+    {W(0x0000723f9d0d8bbf), W(0x0000071202af00ae), W(0x000004f9c3be28dc),
+     W(0x00008eeeab393736)},
+    {W(0x0000a27c5fc53e5f), W(0x0000cd7604ce8d5c), W(0x0000a8e91f93747e),
+     W(0x0000e68b05f4eb79)},
+    0
+  },
+  {
+    {W(0x00009041860b31d5), W(0x0000e5611f57a284), W(0x00003d4a933fd3bf),
+     W(0x0000239ab2cdc7a7)},
+    {W(0x00001e6dbbdeedfd), W(0x0000258b3eeb4de5), W(0x0000129b92b0e0eb),
+     W(0x00008ee2b4632172)},
+    0
+  },
+  {
+    {W(0x0000f51375c1c6b9), W(0x00009a3435f177f1), W(0x0000661d49a2e6ca),
+     W(0x0000c7ae51de2aad)},
+    {W(0x00006e1bc47f31d1), W(0x000095a38d15e962), W(0x0000a1863a80671c),
+     W(0x0000522a9ddfb473)},
+    0
+  },
+  {
+    {W(0x0000e709230bb69a), W(0x000056a61fa3d40f), W(0x0000f128b1eb5147),
+     W(0x0000c61baba00f92)},
+    {W(0x0000cc718b09f359), W(0x0000f6e8987f61c6), W(0x000081a1d593efac),
+     W(0x0000dd51f759979f)},
+    0
+  },
+  {
+    {W(0x0000203d8a00a0ba), W(0x000028f48d421ca6), W(0x0000334db030f807),
+     W(0x0000afd31e6949f0)},
+    {W(0x0000474aa2643aad), W(0x00007b33f4bbe27a), W(0x000018a0bd63e91f),
+     W(0x0000d2860827148f)},
+    0
+  },
+  {
+    {W(0x0000adb9a8176bc6), W(0x0000b54465ae5667), W(0x000043d5ef9ac41e),
+     W(0x0000001d9976d34f)},
+    {W(0x0000df7f900332bc), W(0x0000135dd7843d77), W(0x0000e553a4daef55),
+     W(0x00000a357ef15e61)},
+    0
+  },
+  {
+    {W(0x0000133e606ff3ea), W(0x0000530b8e52aacf), W(0x0000b49e783d9eb9),
+     W(0x00005c435516f4b2)},
+    {W(0x0000627f26c8dc1c), W(0x0000617513771357), W(0x0000adac2fedd7e9),
+     W(0x0000309071b4405b)},
+    0
+  },
+  {
+    {W(0x00003c1ad17bc529), W(0x0000dd4d50fdd4ca), W(0x00006de34636be9b),
+     W(0x0000214ed7e107a3)},
+    {W(0x00004f690e326df4), W(0x0000f76f79daf411), W(0x000077b3ff413bfa),
+     W(0x0000e859d1f18850)},
+    0
+  },
+  {
+    {W(0x00004c59cdf4457d), W(0x0000da0b6899c291), W(0x0000d858e461d782),
+     W(0x000019f054cebf7d)},
+    {W(0x000092f041e342e7), W(0x00005c1763c86eac), W(0x00009f57b8c8bccb),
+     W(0x0000270d43d03403)},
+    0
+  },
+  {
+    {W(0x0000cfa41a4f72d8), W(0x00003fa1cf22150a), W(0x0000c62a4f6e2965),
+     W(0x000098ac5a193ec2)},
+    {W(0x00008eb27ef601c6), W(0x000031a11825181c), W(0x000037b330dd034f),
+     W(0x00007d78e80e9f03)},
+    0
+  },
+  {
+    {W(0x00004ba06657e1c2), W(0x0000aa176a7fab70), W(0x0000947436bc7e63),
+     W(0x0000cbf80ac920de)},
+    {W(0x0000932ff70a80e8), W(0x0000413ab01aee72), W(0x00001826ba7292f5),
+     W(0x0000c85aebc45195)},
+    0
+  },
+  {
+    {W(0x0000085b570680c4), W(0x0000fa128e8df85f), W(0x00005df8b286520e),
+     W(0x0000a55eccc8d1e6)},
+    {W(0x0000627eef27eaa6), W(0x000016cdcac606d6), W(0x000011fceb5361b8),
+     W(0x000009a76ced2629)},
+    0
+  },
+  {
+    {W(0x000037ae28e56be4), W(0x000073d697c7b61f), W(0x0000276e12b7539f),
+     W(0x000006ca1b1e16a6)},
+    {W(0x000082c09ea79db9), W(0x00009925d15e53b9), W(0x00006d4786d995f1),
+     W(0x000026905e23703e)},
+    0
+  },
+  {
+    {W(0x00008d47b4a21ee4), W(0x0000a02f41910cd7), W(0x000091b88353c131),
+     W(0x0000748ce2a046bd)},
+    {W(0x0000034a6dff03c9), W(0x00003dcd06f54411), W(0x00001e3dd720f616),
+     W(0x0000c57536f0df5e)},
+    0
+  },
+  {
+    {W(0x000054e1f2d70135), W(0x0000184bc5935d2a), W(0x00007fd8961bbb1f),
+     W(0x0000d8e30dbf522f)},
+    {W(0x000099949a8a6c39), W(0x0000223b4ddc941c), W(0x00005361dd452ac5),
+     W(0x00002600ba427af7)},
+    0
+  },
+  {
+    {W(0x0000706e9ccb8b26), W(0x00002c61b3b06875), W(0x0000f8d26f2ca236),
+     W(0x00006c753d9afcaa)},
+    {W(0x000044da1a116066), W(0x000011e1bdf356b3), W(0x000043face5541d0),
+     W(0x00004166061db2d4)},
+    0
+  },
+  {
+    {W(0x0000df834eb18778), W(0x0000e987068e4d5c), W(0x000087cbea60b93d),
+     W(0x0000d6d04b83f386)},
+    {W(0x000047db61c38a8c), W(0x000088aa108a5e6d), W(0x0000667533935bf4),
+     W(0x0000244d5d5a0eb2)},
+    0
+  },
+  {
+    {W(0x0000a1f64bdfb149), W(0x00003298b1c138aa), W(0x0000801d18f0973d),
+     W(0x0000d25a8e1497fe)},
+    {W(0x0000139cf6791b25), W(0x0000eca1dd943768), W(0x000062cd26454432),
+     W(0x0000bbf5a73668bf)},
+    0
+  },
+  {
+    {W(0x0000a745c2fb1650), W(0x000078314bf10c78), W(0x0000cddc0b782b66),
+     W(0x00007f50594b5535)},
+    {W(0x0000f013129d581f), W(0x0000cb0c080aaaa2), W(0x0000ad6d1330bbe9),
+     W(0x0000eaad5aabebdd)},
+    0
+  },
+  {
+    {W(0x000038f1201bd51d), W(0x00003536d4d06860), W(0x0000d33928f0bdae),
+     W(0x000055d7cc8cdd8e)},
+    {W(0x0000881e694173bb), W(0x0000a7d12de896ff), W(0x0000ddb7edbaf498),
+     W(0x000079a563a4192c)},
+    0
+  },
+  {
+    {W(0x0000f8d84c159ce8), W(0x0000174ae3c33590), W(0x00004caf2f0a0292),
+     W(0x00004f382f85de2e)},
+    {W(0x0000193709f0fa26), W(0x0000852a0fdd3934), W(0x000086a70c1ab8be),
+     W(0x0000a1e520d7be83)},
+    0
+  },
+  {
+    {W(0x00009b73a9449e36), W(0x0000862cbdaa4f7f), W(0x00009f68126f624f),
+     W(0x00006c847fbc9c2f)},
+    {W(0x000020b19d080704), W(0x0000bce3487ba57e), W(0x00007853cd2b7fcf),
+     W(0x00004a0122b387b7)},
+    0
+  },
+  {
+    {W(0x0000d375ede723ac), W(0x0000b9d98980ff8c), W(0x00003e6571b08da4),
+     W(0x0000b4bda10754ce)},
+    {W(0x00009922ea299b50), W(0x0000579f17c00f80), W(0x0000c6ff01bb2a05),
+     W(0x0000d9154472bd22)},
+    0
+  },
+  {
+    {W(0x00005d6be89ee468), W(0x00004c4996ec5744), W(0x000073c352eae236),
+     W(0x000080914befcf14)},
+    {W(0x000049d2962a45a4), W(0x0000aad84b7a31ab), W(0x000038487c00b697),
+     W(0x0000c0e6e10fa300)},
+    0
+  },
+  {
+    {W(0x0000081682ed9a46), W(0x000078a61991ef4b), W(0x00004af57dcf8dfa),
+     W(0x0000230f5f9a64e3)},
+    {W(0x0000d7bb9ffea507), W(0x000052359cdd14af), W(0x0000e72f56e76a85),
+     W(0x0000622051707eeb)},
+    0
+  },
+  {
+    {W(0x000023fa9f9efb7b), W(0x0000e981e32b7387), W(0x0000139b16ff3278),
+     W(0x0000edbd3a0c5c61)},
+    {W(0x0000b9ca36323dee), W(0x0000a85202675a1d), W(0x000003e90b7f4b0b),
+     W(0x00005a36f56e51cc)},
+    0
+  },
+  {
+    {W(0x00008d234fc44c4a), W(0x0000c3b43772b27f), W(0x0000ce8ecd116bc9),
+     W(0x00005ed8f7486b1c)},
+    {W(0x0000a37bf179e3a4), W(0x0000e316961245f5), W(0x0000d09c729d9cba),
+     W(0x0000c506eb7bea24)},
+    0
+  },
+  {
+    {W(0x0000c9bf589c37cf), W(0x0000f703acd104c0), W(0x00000c72a9f1082a),
+     W(0x000061a4731f7018)},
+    {W(0x00008468d4049b07), W(0x0000f3c5d0a81542), W(0x00005502e5aa650b),
+     W(0x00008f59eea176d9)},
+    0
+  },
+  {
+    {W(0x00001c79621ccff8), W(0x000077e25dc7aa0a), W(0x00003effb62b4d5b),
+     W(0x000021c3ac88e281)},
+    {W(0x000055c2f09bdae9), W(0x0000107e8d5593c3), W(0x0000e0f051408836),
+     W(0x000019946ad9dee2)},
+    0
+  },
+  {
+    {W(0x0000078f093dfbc4), W(0x0000adef05df7b6d), W(0x0000d6df7345c44a),
+     W(0x0000e30bff45e8af)},
+    {W(0x00003831769a0a1f), W(0x00004d7a40300b82), W(0x00004bfd075ef1f1),
+     W(0x00005ec1ff1b7644)},
+    0
+  },
+  {
+    {W(0x000012c78a9c51ac), W(0x0000674b2e69a538), W(0x00008bb6385d4933),
+     W(0x00004a6f57c1ee84)},
+    {W(0x00002526bbc9ba57), W(0x0000571aae8e6c3c), W(0x00007512266b7794),
+     W(0x0000f970fa529bab)},
+    0
+  },
+  {
+    {W(0x000093e8f9e0bf57), W(0x0000ffd6ca989f8b), W(0x0000d7614751a638),
+     W(0x0000bda31181dd35)},
+    {W(0x0000810a06e38495), W(0x00009fdc6d0a66b4), W(0x0000ad692a77e231),
+     W(0x00001415967bbb8f)},
+    0
+  },
+  {
+    {W(0x00005d27fd2bed28), W(0x000027ab7aa1d1a5), W(0x00009ba0f82cddef),
+     W(0x0000f4e73e0daab1)},
+    {W(0x0000c015c0303ee1), W(0x0000927257f9b2dc), W(0x00009e5bddc992e0),
+     W(0x0000dbccd2a32859)},
+    0
+  },
+  {
+    {W(0x0000877f2bb984d5), W(0x0000a5729da785fd), W(0x0000461b6b388c8a),
+     W(0x000001490d73b173)},
+    {W(0x0000c2dab66db5e7), W(0x0000704d4e001d13), W(0x0000a88bf62bac76),
+     W(0x0000cb73d1577343)},
+    0
+  },
+  {
+    {W(0x00008ad502d80173), W(0x0000e71371d6e7b7), W(0x00000afa4a9a1da1),
+     W(0x0000b9924b372fb0)},
+    {W(0x000007aae17eae3b), W(0x00004832678a5fa3), W(0x0000435e436264d2),
+     W(0x00003db8ba21e764)},
+    0
+  },
+  {
+    {W(0x0000174c6da93dab), W(0x0000a244192af7a6), W(0x00000691f143403f),
+     W(0x0000e926a18e467d)},
+    {W(0x00008a956afe628c), W(0x000077d563a35166), W(0x00006d3382f0657e),
+     W(0x0000bd0e4fbba144)},
+    0
+  },
+  {
+    {W(0x00004c1e555ed50f), W(0x0000ad3097a40f6d), W(0x0000994e799d9252),
+     W(0x00004747aa8439dc)},
+    {W(0x0000e9c481c49e00), W(0x0000f96dbd0a9cb0), W(0x0000082f9b577b48),
+     W(0x0000eaec081a2f6c)},
+    0
+  },
+  {
+    {W(0x0000f76c5e3398ee), W(0x000088c4384e9162), W(0x00007dbdee836161),
+     W(0x000084e57ed428b3)},
+    {W(0x00006da9701d1e05), W(0x0000a291239a53ec), W(0x000021f50e5dc83a),
+     W(0x0000af3116bb7213)},
+    0
+  },
+  {
+    {W(0x00003d139728a497), W(0x000001fe78a97b36), W(0x0000d49fa1459127),
+     W(0x00000d6244b9b7ff)},
+    {W(0x00009b757939c3b9), W(0x0000d0bb5b6975f1), W(0x0000f12108a6f06c),
+     W(0x00004fc86fde481d)},
+    0
+  },
+  {
+    {W(0x00001f3a7a07d58e), W(0x000059f02d284a8a), W(0x000060a147854a23),
+     W(0x0000aba442a2c318)},
+    {W(0x00004e0cd868c01e), W(0x0000fb8844ca316a), W(0x000051775a3020dd),
+     W(0x000096327f6837d4)},
+    0
+  },
+  {
+    {W(0x0000b00bb24c9678), W(0x0000e2ebac8eb73b), W(0x0000e511478d04cf),
+     W(0x00001677ae7f0931)},
+    {W(0x0000236bfc1924d9), W(0x00002c3050d04660), W(0x0000270bdea9986a),
+     W(0x0000899b9920a3fa)},
+    0
+  },
+  {
+    {W(0x00009c76502b7ad2), W(0x0000e9dc13fb9047), W(0x00009c3eb0030a3a),
+     W(0x0000c6053eca415e)},
+    {W(0x0000414d6bf85529), W(0x0000ae4d429ac328), W(0x0000b81d40ef4ae5),
+     W(0x00004970343b9937)},
+    0
+  },
+  {
+    {W(0x0000212a67b60834), W(0x00009639f4d152db), W(0x000078ca712770fc),
+     W(0x0000f02cdce76fc2)},
+    {W(0x0000688305f89408), W(0x000009140cee6cf7), W(0x0000e41170f3a8a6),
+     W(0x000064f6841d6ad4)},
+    0
+  },
+  {
+    {W(0x00006532b71f7842), W(0x00005213ea14faa1), W(0x0000d7d4af20d29f),
+     W(0x0000460fd60bea18)},
+    {W(0x0000e6a604f1be62), W(0x000019e83a254f19), W(0x00002bb8cc5e03a4),
+     W(0x000067d1166d8ff9)},
+    0
+  },
+  {
+    {W(0x00004e1b3aefbd4c), W(0x0000d92c29a08f93), W(0x0000d32678f4f43f),
+     W(0x000075de62e515a2)},
+    {W(0x0000e505d50dc153), W(0x00003993edb8cb06), W(0x00008e25be20cce6),
+     W(0x0000d95806fee7b2)},
+    0
+  },
+  {
+    {W(0x00003e2160b9625b), W(0x0000dfc26c12cd7e), W(0x0000011bdccca86f),
+     W(0x0000c1299ae7d15f)},
+    {W(0x00003a8d05de0d87), W(0x0000b0e89b6b6769), W(0x00001a17e5b4ef0d),
+     W(0x000061fd190cebd3)},
+    0
+  },
+  {
+    {W(0x0000cc7ac017377c), W(0x0000ac3140de9db6), W(0x00004650dc6e2045),
+     W(0x000038167cd52436)},
+    {W(0x0000c6a009ab397b), W(0x0000f3d7e5e9de81), W(0x0000d7ff87083dbb),
+     W(0x00001d78a75fc2b2)},
+    0
+  },
+  {
+    {W(0x00000b46f9c84557), W(0x00001bd4b1c086d5), W(0x0000bb515e4db617),
+     W(0x0000fcde9cd76744)},
+    {W(0x0000106c76f3061b), W(0x0000a59418f72462), W(0x0000608737031845),
+     W(0x0000851ed27988da)},
+    0
+  },
+  {
+    {W(0x0000723543dab5d8), W(0x0000bf12c71adbe1), W(0x00004424ba31ffd5),
+     W(0x00009e93403d5e5b)},
+    {W(0x0000a5cb037c695f), W(0x0000640e5b92c809), W(0x0000ab805b2a9274),
+     W(0x00000ca40fa873b7)},
+    0
+  },
+  {
+    {W(0x0000022d4e2d5440), W(0x0000b2f90c885b70), W(0x00007e9e45afef90),
+     W(0x000031f927374add)},
+    {W(0x00007fa5a1a7596c), W(0x000017a1ef56e7ef), W(0x0000b31998250f4f),
+     W(0x0000fc3d3ffed3e3)},
+    0
+  },
+  {
+    {W(0x0000a75d09534e82), W(0x000038330e84ce07), W(0x00001678caaf26dc),
+     W(0x0000c9f26fbde1b4)},
+    {W(0x00005149dd1965a2), W(0x0000fa38f192cd30), W(0x0000770433661863),
+     W(0x0000e7632ccfca56)},
+    0
+  },
+  {
+    {W(0x0000b62aaaea0d4d), W(0x0000a9ef0c4b178b), W(0x000050a6c72c20f7),
+     W(0x00003979c0bf4bb8)},
+    {W(0x0000c082fb5b4cef), W(0x0000658b4a9dcfea), W(0x0000e511e1e611ac),
+     W(0x0000dfeb265b47c1)},
+    0
+  },
+  {
+    {W(0x00009a4019e71bd9), W(0x0000830d370a8068), W(0x0000a6aacfeed26e),
+     W(0x00004ee3d830f1f9)},
+    {W(0x00006dc7b6150db8), W(0x0000dd8ed39e6308), W(0x000086b899c9d89a),
+     W(0x0000049cfff49102)},
+    0
+  },
+  {
+    {W(0x0000c5a6a5d247a7), W(0x0000e32180213745), W(0x0000860d7d6b5d6c),
+     W(0x0000ac7381a03094)},
+    {W(0x0000705803099555), W(0x0000d9ece0224d93), W(0x0000e6eedb907377),
+     W(0x0000a5755add181f)},
+    0
+  },
+  {
+    {W(0x0000cbfb2ec05929), W(0x0000254543541a81), W(0x0000b5365a2b30e3),
+     W(0x0000ab7573bc4a96)},
+    {W(0x000026543a698a6c), W(0x0000795eeba2e51b), W(0x00006686a33c2377),
+     W(0x0000b2da4464c879)},
+    0
+  },
+  {
+    {W(0x00007a85df32cb55), W(0x0000243c266fd38f), W(0x0000e1c2a2b565df),
+     W(0x00004a09b35ed7df)},
+    {W(0x0000c6ff64ef382b), W(0x00009bd026f6092a), W(0x0000defd98d67daf),
+     W(0x000098e08ed9a7c2)},
+    0
+  },
+  {
+    {W(0x0000f7e9d821e22e), W(0x0000aed7902d97af), W(0x00002cd5949aa9ed),
+     W(0x00003ad9fa399f06)},
+    {W(0x0000f4179116432e), W(0x000026246c56c35f), W(0x0000aa0ab3305990),
+     W(0x000028ac8db91f5d)},
+    0
+  },
+  {
+    {W(0x00005e8e5c4fb2ca), W(0x00003df564094085), W(0x0000069f47616704),
+     W(0x0000621fbd2b0206)},
+    {W(0x000003468c61f21c), W(0x0000da1bcee2ec07), W(0x0000d92ef7e6c93f),
+     W(0x00005e30d70c3fd8)},
+    0
+  },
+  {
+    {W(0x00003bdef001e95d), W(0x000022515394517f), W(0x000040d80edd7852),
+     W(0x000000a057fc3a49)},
+    {W(0x00001f633e73c4ac), W(0x000084d3612beaa6), W(0x000004a03e5c6392),
+     W(0x000041a5f901a14d)},
+    0
+  },
+  {
+    {W(0x00008c9c109d2e3d), W(0x00006b9ffa86a9f4), W(0x0000d3629f8accc2),
+     W(0x0000462ecc1040cb)},
+    {W(0x00006ad5258127a2), W(0x00008902507eb9bc), W(0x000051614fe9206b),
+     W(0x00000f1f7d30d781)},
+    0
+  },
+  {
+    {W(0x0000b4c1febae73d), W(0x0000b02d09e7bed2), W(0x000045279f8ad175),
+     W(0x0000027642c4640a)},
+    {W(0x00004f568b18b23b), W(0x000078c18adeaac3), W(0x0000bfef5a558374),
+     W(0x000072cd73f6a189)},
+    0
+  },
+  {
+    {W(0x00001f3b051c392b), W(0x0000f08e68c662ce), W(0x00006cd695270c96),
+     W(0x00007f13ee0b49a9)},
+    {W(0x000034b59d9e1358), W(0x00000ca17dc4c0f7), W(0x0000565126ad1b79),
+     W(0x0000595d39197cc8)},
+    0
+  },
+  {
+    {W(0x000045e8b435b710), W(0x0000f661fefb4224), W(0x00005e45cd9edf1c),
+     W(0x0000819cf0723893)},
+    {W(0x0000725c4c91194d), W(0x0000b7f1804fe060), W(0x00003d108ce723d4),
+     W(0x000088372dd42077)},
+    0
+  },
+  {
+    {W(0x000038ac4c61d974), W(0x0000ef43245485cc), W(0x0000660e346b42dc),
+     W(0x0000ab38a446a57b)},
+    {W(0x000072d731ddfae4), W(0x00004acf13b80f07), W(0x00007f928c4e8f4e),
+     W(0x00001473a05cfa82)},
+    0
+  },
+  {
+    {W(0x0000cb68f825e6ba), W(0x000080db778f9222), W(0x00008ab8ad46ea26),
+     W(0x0000262674f35256)},
+    {W(0x0000fe35e6dc15b8), W(0x00004533d23dd5ca), W(0x0000e0dd9e47a05d),
+     W(0x0000c5906e956a16)},
+    0
+  },
+  {
+    {W(0x00008a4efa7472c2), W(0x00007867001242cf), W(0x0000dbf78825ed19),
+     W(0x000001843c2bef8e)},
+    {W(0x00006f256878438c), W(0x0000671dcd5871d3), W(0x0000b443a3b59e19),
+     W(0x0000a3f8572cb94d)},
+    0
+  },
+  {
+    {W(0x0000f3296bfa3ed4), W(0x0000dfe2737ab9d9), W(0x0000e2d799fcc2f1),
+     W(0x0000cd488eb3e4fd)},
+    {W(0x0000f28ba0547123), W(0x0000c00a11bbfaed), W(0x000060dc15bb892e),
+     W(0x0000161913e4051a)},
+    0
+  },
+  {
+    {W(0x00000281b398ab97), W(0x00004e4f7e18b8ca), W(0x000029f268d3f086),
+     W(0x00008994f0b8f09f)},
+    {W(0x0000dde62efefe3d), W(0x0000d8ccf12bb0ac), W(0x0000dcf5902fe8e5),
+     W(0x0000b19a792f1a3a)},
+    0
+  },
+  {
+    {W(0x0000c9f583f3d842), W(0x000076b70eeb8ac5), W(0x0000ddc03ed96cfb),
+     W(0x00003042d3fe4acd)},
+    {W(0x000024db7f6630f4), W(0x0000bf90fa36ceef), W(0x0000914d8c4972af),
+     W(0x00007d8df4d0ca19)},
+    0
+  },
+  {
+    {W(0x0000e4269ec49780), W(0x0000582a7e8b38e9), W(0x00004eea332388f7),
+     W(0x000044a856450820)},
+    {W(0x00005289a61789e8), W(0x0000ed0af74af21e), W(0x000067591d3b28ee),
+     W(0x00002ef370702d1c)},
+    0
+  },
+  {
+    {W(0x000066b49ba2ce5c), W(0x000057155a06db57), W(0x0000a87ff3c11e7c),
+     W(0x00001b9c60ad422c)},
+    {W(0x00004b9d02cc2ecc), W(0x0000b78ff98f9a19), W(0x0000718ecd31b9e2),
+     W(0x0000213968fd3888)},
+    0
+  },
+  {
+    {W(0x0000a231a9d400e1), W(0x000001edf4785728), W(0x0000e7ba97b862cd),
+     W(0x00009d0a00776afc)},
+    {W(0x0000682989c73207), W(0x0000c6e9ff5c651e), W(0x0000caa0ef7083fd),
+     W(0x0000802f3560e843)},
+    0
+  },
+  {
+    {W(0x00001eb76b30f45c), W(0x000063c4ec111d7a), W(0x0000954fcf6dd910),
+     W(0x00004e9da21d09e3)},
+    {W(0x00006dd73ed16a72), W(0x00000cfee11daf65), W(0x000075f8b9a2961e),
+     W(0x000083b57059d3ef)},
+    0
+  },
+  {
+    {W(0x0000f15bbee4d3b7), W(0x00000f701d02a256), W(0x0000d48e0ac5a910),
+     W(0x0000d3bbdfada0ac)},
+    {W(0x000032d636d9bc24), W(0x0000d76c5cc23c48), W(0x00005d69bbc96565),
+     W(0x00006bcba919a870)},
+    0
+  },
+  {
+    {W(0x000050decfaed835), W(0x00007afe602debae), W(0x00003e1344ce35c3),
+     W(0x0000cf62495c5219)},
+    {W(0x000040035efcf270), W(0x000097b9c8e07622), W(0x000071f51e0a362c),
+     W(0x0000e7efdd6aa4c7)},
+    0
+  },
+  {
+    {W(0x000027a4d44d877a), W(0x0000e512e16fccf0), W(0x0000f02009fea760),
+     W(0x0000c14027009064)},
+    {W(0x00004ba1c33e74d5), W(0x000020a341f1253c), W(0x00007bb5018ffe99),
+     W(0x00000b2bea49db53)},
+    0
+  },
+  {
+    {W(0x0000bb73c329cea0), W(0x00005f211ff131bf), W(0x000042f8a8eb03dc),
+     W(0x0000f744cf55b8fb)},
+    {W(0x0000d780221925d7), W(0x0000a3b9e8325f8f), W(0x0000cb4d6757a929),
+     W(0x000003de62cd5a5a)},
+    0
+  },
+  {
+    {W(0x0000041fc4def9fc), W(0x0000ad9e56cddc58), W(0x000067eedc3950ec),
+     W(0x0000f6e8e2027256)},
+    {W(0x0000c14f6b2212fa), W(0x00007f3379a28494), W(0x0000ecafb395db34),
+     W(0x00008581c257c35c)},
+    0
+  },
+  {
+    {W(0x0000a9ef2e117b46), W(0x00001e8d51c8bb3b), W(0x00003faceaed1131),
+     W(0x000091c5f99f22cd)},
+    {W(0x0000401fb9558435), W(0x0000894f4dc8d28b), W(0x00005494ee57e3c4),
+     W(0x0000ed865bfbd48b)},
+    0
+  },
+  {
+    {W(0x000097d2550f02ae), W(0x0000b7e65b9e4f6f), W(0x00001363ae6ba7c5),
+     W(0x00001289aaa65609)},
+    {W(0x0000f9cbb845a786), W(0x000042d6c1066d98), W(0x0000517b449218ce),
+     W(0x0000cf00fa17e85a)},
+    0
+  },
+  {
+    {W(0x0000ac8c9dd15529), W(0x0000eaedc770a956), W(0x000010710eedee4e),
+     W(0x00008339d16f9a25)},
+    {W(0x0000072d674908c8), W(0x0000a4999a64fafa), W(0x0000d74647784461),
+     W(0x0000892fc1507862)},
+    0
+  },
+  {
+    {W(0x00008244264ebd04), W(0x0000ed580618a13a), W(0x0000bd0092afc119),
+     W(0x0000bc2444379694)},
+    {W(0x0000010d862dfa71), W(0x000012d37430e7ec), W(0x000038f2cf1198e8),
+     W(0x0000e292c4d976a5)},
+    0
+  },
+  {
+    {W(0x00005060d7769d3d), W(0x00007e0790fa384a), W(0x0000c99128a9f4df),
+     W(0x0000889bc5da689a)},
+    {W(0x0000e273dff08199), W(0x0000b59cbfbafda2), W(0x0000b1d87fbfd98a),
+     W(0x0000b86ae06c051b)},
+    0
+  },
+  {
+    {W(0x000092cf7786dd47), W(0x0000c43638b07efb), W(0x000070a418e1c28f),
+     W(0x00002e9798fb06a6)},
+    {W(0x00001983d0d21341), W(0x0000b570f144c559), W(0x0000552f45440ae2),
+     W(0x0000646c157f5a99)},
+    0
+  },
+  {
+    {W(0x0000ff7bccb0e145), W(0x0000e136dec95c10), W(0x0000a35ae58461ce),
+     W(0x00003379cabf169a)},
+    {W(0x0000f5580189f340), W(0x00005f2bdd721e19), W(0x0000744d3a502813),
+     W(0x00007965730fa238)},
+    0
+  },
+  {
+    {W(0x000048e98dc396ed), W(0x0000ff80bac648b8), W(0x000042be3c7eb629),
+     W(0x000038e4f24edbae)},
+    {W(0x00004e5e852e0eb6), W(0x000087b619185f7d), W(0x0000d22cf38e3433),
+     W(0x00007f48d871f1cc)},
+    0
+  },
+  {
+    {W(0x00004c56afdf63d2), W(0x000046990ba15d22), W(0x000071b35af82093),
+     W(0x000019e470a18e40)},
+    {W(0x0000eb8824c85506), W(0x0000b1fca5b3d097), W(0x000032d496bce9df),
+     W(0x00007c4c4e47f798)},
+    0
+  },
+  {
+    {W(0x00007bc92e5449e1), W(0x00001c87a45e3da5), W(0x0000969de9d57915),
+     W(0x000095d4d7aaee9f)},
+    {W(0x000094d65915dc2b), W(0x00009484c06c5254), W(0x00004726b7207779),
+     W(0x0000109e7a0d7401)},
+    0
+  },
+  {
+    {W(0x00007ed2b15323af), W(0x0000b2208e828940), W(0x0000b598112fa691),
+     W(0x0000ce60c7b2b7b6)},
+    {W(0x0000081394689ca9), W(0x0000ba0ce99b293c), W(0x0000fcfc87c9ec17),
+     W(0x0000ceef4d0d0188)},
+    0
+  },
+  {
+    {W(0x0000712ab3a27eb3), W(0x00001c87f863efd1), W(0x0000c4eaf828af34),
+     W(0x0000afef7894d51a)},
+    {W(0x00007ae0e77c7692), W(0x00005c4383a99dff), W(0x000077dd3240f1bf),
+     W(0x0000f018918cd2e8)},
+    0
+  },
+  {
+    {W(0x00007dfdc4a5dc93), W(0x00001491dbc67f93), W(0x00004426b2ddc429),
+     W(0x000036996cdf4bad)},
+    {W(0x000096d77f91d38a), W(0x0000113c01226221), W(0x00004c89986c8525),
+     W(0x0000e8e37e4bee56)},
+    0
+  },
+  {
+    {W(0x0000e86e38036ddf), W(0x0000344b164786bb), W(0x0000d4fa26a51a70),
+     W(0x000097f5198ac6f1)},
+    {W(0x00005a3b0cb0f929), W(0x000004e0e4e5bab1), W(0x000065ae0ba19ba2),
+     W(0x0000545dd48a616c)},
+    0
+  },
+  {
+    {W(0x0000b4e387e267dc), W(0x0000f856973d2909), W(0x0000968db3a6786f),
+     W(0x0000c1a4d0f2cb4f)},
+    {W(0x0000733b00f97807), W(0x0000cdf1480895bf), W(0x00002e2fb544ed7e),
+     W(0x0000998b85da3e2c)},
+    0
+  },
+  {
+    {W(0x00001c1f81b3186f), W(0x00006091b157d9ba), W(0x0000259d1fb40223),
+     W(0x0000479a95a24124)},
+    {W(0x0000f1ab65bcb9de), W(0x0000d33daf3a1128), W(0x000077d4b2cb9d8c),
+     W(0x00009d6fc5518576)},
+    0
+  },
+  {
+    {W(0x0000b323a76eb5ba), W(0x00004f9cb4503b50), W(0x0000db1d9d1250a7),
+     W(0x0000e9ef70eafa3f)},
+    {W(0x000004873b7ffaab), W(0x00001060c173beea), W(0x00002c0932916a43),
+     W(0x0000f6bf6e86407b)},
+    0
+  },
+  {
+    {W(0x00001bdb987616bc), W(0x0000a36b08b330c8), W(0x0000fafd5a3e750c),
+     W(0x00003834f6fb58f1)},
+    {W(0x000015b80d5af5c6), W(0x0000b5cd779326fd), W(0x0000f100c1d59e5a),
+     W(0x0000be09418fdd27)},
+    0
+  },
+  {
+    {W(0x0000741f93ed60cd), W(0x0000c9bbd3c6d73e), W(0x0000c6ea8a00c508),
+     W(0x00008151f4bcac5a)},
+    {W(0x000087dfb31ffb2b), W(0x0000f022f6ca2413), W(0x0000629ea83e176c),
+     W(0x0000c54e495af7a2)},
+    0
+  },
+  {
+    {W(0x000020c07bc19cd6), W(0x00001335f3258263), W(0x00001f665d806589),
+     W(0x0000e5cfd698a6f7)},
+    {W(0x00006af878bcda5a), W(0x0000de5d5bca087a), W(0x00006f11e524420e),
+     W(0x00007035d5bda959)},
+    0
+  },
+  {
+    {W(0x0000770bd351e6bb), W(0x00008815850fb178), W(0x00009af7cb1860d1),
+     W(0x000096becfbf5a61)},
+    {W(0x000037ba62a9a25a), W(0x0000d9320ff6f08c), W(0x0000abf2792ace61),
+     W(0x0000ad09912d8d22)},
+    0
+  },
+  {
+    {W(0x0000f0843197d1ff), W(0x000068fcced193ed), W(0x000060240a46ad70),
+     W(0x0000c10031ef3ce9)},
+    {W(0x000073f355bbd35d), W(0x0000f7ad4f0d3f4e), W(0x0000976cabebb35c),
+     W(0x0000f3af43933e5c)},
+    0
+  },
+  {
+    {W(0x000057f55847a465), W(0x00003b6120262685), W(0x0000df8443c5de1a),
+     W(0x0000a85181623bee)},
+    {W(0x0000fbf2444b8d98), W(0x00009abf920313f5), W(0x0000c5a285c07d9a),
+     W(0x0000756a78d123f3)},
+    0
+  },
+  {
+    {W(0x00001dfd6f714bb9), W(0x0000395234c2d124), W(0x00005f40b4717b42),
+     W(0x000015067cab17d2)},
+    {W(0x0000594a55db4fcb), W(0x0000ceda1cc35180), W(0x00005acdb7e29c99),
+     W(0x000005f509d692af)},
+    0
+  },
+  {
+    {W(0x0000d013d270c462), W(0x0000f47c82b3a4db), W(0x0000c705afe56c21),
+     W(0x00003c4d64d1e1c1)},
+    {W(0x00008aa00ada5e19), W(0x000097c9d9092383), W(0x00003a7de9942cd6),
+     W(0x0000376606048458)},
+    0
+  },
+  {
+    {W(0x0000a4009150bd83), W(0x000073ca49a451e3), W(0x000076b26e978a78),
+     W(0x0000f9415a5d56ea)},
+    {W(0x0000bbe7181e85a9), W(0x0000d17d22a209ba), W(0x0000dcc0f65b4c74),
+     W(0x0000286b43781d9e)},
+    0
+  },
+  {
+    {W(0x00007e4f2a962a55), W(0x00004acb05376717), W(0x00004099a4683756),
+     W(0x0000817fdd09f64b)},
+    {W(0x00003920d5ec8275), W(0x00000b2b1b16a370), W(0x0000f22314ab37e2),
+     W(0x0000011ad654ee8f)},
+    0
+  },
+  {
+    {W(0x00003e39087aaf5f), W(0x00006e5bc4343293), W(0x0000926c8975dd0e),
+     W(0x00009c06e6e0ec81)},
+    {W(0x00003bca693adda0), W(0x000020ace4888535), W(0x000023b8569c147a),
+     W(0x00002b150a9bbc36)},
+    0
+  },
+  {
+    {W(0x0000168a78f91c89), W(0x0000110709390423), W(0x00004cf5e9f2b499),
+     W(0x0000ca77b7e289d0)},
+    {W(0x00007e4efefe9ee6), W(0x0000326423078e10), W(0x000091667bf96c8e),
+     W(0x0000336cdc107273)},
+    0
+  },
+  {
+    {W(0x0000b34c00bacd1b), W(0x000021f505815933), W(0x0000fb3442411b7d),
+     W(0x000020477423e0c6)},
+    {W(0x00003c8aaeabee57), W(0x00000d2df6184daf), W(0x000035e8de6e7668),
+     W(0x0000c95081a9fb04)},
+    0
+  },
+  {
+    {W(0x000021d02eefebc2), W(0x00001039ee2e3df9), W(0x0000f45892e3cc20),
+     W(0x0000eb6ccf4ab453)},
+    {W(0x0000058e1b7eac29), W(0x0000023069cb6d33), W(0x00001d0c5d4bb2e8),
+     W(0x0000e23c80583237)},
+    0
+  },
+  {
+    {W(0x0000f3d00ba1a1ff), W(0x0000eecd83a2cb6a), W(0x0000fd64670e070a),
+     W(0x0000ccedfcc05bc5)},
+    {W(0x00008f2de17780ae), W(0x000037ab85d7052a), W(0x000054da82cb09bd),
+     W(0x000046a210a4e3ed)},
+    0
+  },
+  {
+    {W(0x00000e7246ccba40), W(0x00003e0726dc07f4), W(0x0000a85268ac4ac0),
+     W(0x0000fd1720111343)},
+    {W(0x00004ba1990946a6), W(0x0000f432ddd882e6), W(0x000046ce4a6b3f98),
+     W(0x0000c19c3a93d919)},
+    0
+  },
+  {
+    {W(0x0000907bf35fa0e4), W(0x000006570599fd76), W(0x0000950c348c890a),
+     W(0x0000693af1975608)},
+    {W(0x0000f26e3a1bb99d), W(0x00003189e43f2afa), W(0x0000d7363b507081),
+     W(0x0000ac3fd1070aa1)},
+    0
+  },
+  {
+    {W(0x0000e57caeccec30), W(0x000047e5a0f2baf6), W(0x000009b7d2517963),
+     W(0x0000eb74e8ccf89b)},
+    {W(0x00005ab36a5b91e7), W(0x00003d37016820a3), W(0x000087fab061bcfd),
+     W(0x0000dfc6f0d949bc)},
+    0
+  },
+  {
+    {W(0x0000d9d57f8cd9fa), W(0x000023894fd3b944), W(0x00006398bab5b4a0),
+     W(0x000028ec17122b55)},
+    {W(0x000064e990e251e8), W(0x00003c5370a503f9), W(0x0000794339cd4fda),
+     W(0x00009c6b4c4c33a6)},
+    0
+  },
+  {
+    {W(0x00002b78115aa8b5), W(0x0000b7b235cc8784), W(0x0000f22c677bc481),
+     W(0x00008f6209c9a016)},
+    {W(0x000049a8409761f3), W(0x0000a09d2f8a6a8e), W(0x000033fa1a2c68b7),
+     W(0x000075bf2425c80f)},
+    0
+  },
+  {
+    {W(0x0000a6d72b1be39c), W(0x0000843f13897ea2), W(0x00001f73c28283ea),
+     W(0x00002f9d6c80dd24)},
+    {W(0x0000662307769370), W(0x000055f2663d4551), W(0x000020e62f3021c6),
+     W(0x00008ea94998b24b)},
+    0
+  },
+  {
+    {W(0x0000a00933cc48d3), W(0x00005bafda087dd7), W(0x0000d3166bf4b982),
+     W(0x00005a5ff1176db0)},
+    {W(0x0000f978061d6bb6), W(0x0000ea41921f4c6f), W(0x000066ad504c317b),
+     W(0x00007b6bffd9f314)},
+    0
+  },
+  {
+    {W(0x00000c91e1992d65), W(0x000098b548a6e54b), W(0x00000a55763fb4cb),
+     W(0x0000d87c92c8a0d2)},
+    {W(0x0000efefcac87fe8), W(0x0000ef3f9e8d5fd1), W(0x00002212472e5174),
+     W(0x0000378daa0ae4bb)},
+    0
+  },
+  {
+    {W(0x000026fd6a81a9df), W(0x0000c4b9185087d7), W(0x0000189da2850ae7),
+     W(0x000010da01698d05)},
+    {W(0x00000fe27350d6bc), W(0x00003cee72664f23), W(0x0000412624c125dc),
+     W(0x00002033adbfd61c)},
+    0
+  },
+  {
+    {W(0x0000306ffb29827e), W(0x00002ace4a053b02), W(0x0000ad81f32fb1ea),
+     W(0x000056112afbe0db)},
+    {W(0x0000288163f25ac5), W(0x000009d42821e260), W(0x0000bd036f6028ff),
+     W(0x000010453ad99d61)},
+    0
+  },
+  {
+    {W(0x0000f1be4fb2278d), W(0x0000f46311276859), W(0x000001f8b9e0d374),
+     W(0x00005aa408533acc)},
+    {W(0x0000ed94b7a6e80f), W(0x000077244aac6342), W(0x000035630cc9bc13),
+     W(0x0000f3cda9e87d89)},
+    0
+  },
+  {
+    {W(0x00005898c0fccb23), W(0x000092996c7022cf), W(0x000014a9afa70f12),
+     W(0x00004c22fc365fc7)},
+    {W(0x00002b0a4ac20490), W(0x0000919e766d1d2e), W(0x0000ede13876568b),
+     W(0x0000357b11b62556)},
+    0
+  },
+  {
+    {W(0x000029478799a171), W(0x0000d711ccae652e), W(0x00002508aff7a08b),
+     W(0x00001dc5605df2c3)},
+    {W(0x00002e9788ea2d30), W(0x0000729d1c71fadf), W(0x00001df3c71a25b4),
+     W(0x0000b3488371751b)},
+    0
+  },
+  {
+    {W(0x0000a616e8d14cb0), W(0x0000fdeba511c43f), W(0x00000dc3c8395628),
+     W(0x00005cf09b3ab744)},
+    {W(0x0000750189fa0e23), W(0x0000a8939c1eabe3), W(0x0000c9433dcb08cd),
+     W(0x0000f48c43f68600)},
+    0
+  },
+  {
+    {W(0x0000e7363d4d2b85), W(0x000090fa77b10710), W(0x000035a0adf01fb6),
+     W(0x000057d9c4bdfb88)},
+    {W(0x0000b870ae562c6d), W(0x0000e4a735fdfd31), W(0x0000779d6a4d5e45),
+     W(0x0000a19dfe12d079)},
+    0
+  },
+  {
+    {W(0x00007e8cc99ca31e), W(0x00008181d70aadff), W(0x0000826668c766c7),
+     W(0x0000690227113976)},
+    {W(0x00004edbf7f49cb3), W(0x00006889cfa35cd0), W(0x0000d587a5b0a406),
+     W(0x000054370573a566)},
+    0
+  },
+  {
+    {W(0x0000bb886f0af1b5), W(0x0000f9a63baed562), W(0x0000511235d8394f),
+     W(0x00001f99233474d7)},
+    {W(0x00009cf1f71604e3), W(0x00007dd2c77d00fd), W(0x0000b0bd567fa4cb),
+     W(0x000008216a858c75)},
+    0
+  },
+  {
+    {W(0x00007bbf35123a03), W(0x0000e721f8980f00), W(0x00009d4bd7fb1d23),
+     W(0x00007ac56d19001a)},
+    {W(0x000096a09dc184d4), W(0x0000ceb2f145b0cc), W(0x0000225ab5acd1c9),
+     W(0x000069b1dcc56fa9)},
+    0
+  },
+  {
+    {W(0x00004a02fccaed13), W(0x000061c71d08328f), W(0x00006ce9fd4fc0bb),
+     W(0x0000a0831ab4b648)},
+    {W(0x0000e7a74be6e116), W(0x00007726d4b765a1), W(0x000052261a601bef),
+     W(0x000023ea35d4d8c9)},
+    0
+  },
+  {
+    {W(0x00001a61b5a701de), W(0x00007af992041c87), W(0x0000bda9504e1cbd),
+     W(0x00004a1430828b46)},
+    {W(0x00004a9e0cb64710), W(0x00007cc9857e7172), W(0x0000f10fee6607bf),
+     W(0x00003c38c771e594)},
+    0
+  },
+  {
+    {W(0x000014721d3288e7), W(0x000079cf311b4ed2), W(0x000040a92d911c02),
+     W(0x00001ddb41a8206d)},
+    {W(0x000024f36b3033c1), W(0x00005ac5e34cb923), W(0x0000ad988c775a61),
+     W(0x00000fd74ed6965c)},
+    0
+  },
+  {
+    {W(0x0000adf693f2dc2b), W(0x000095b327efbaae), W(0x0000c71583f9e369),
+     W(0x0000c66460322cbe)},
+    {W(0x0000de6bf27563d1), W(0x0000b20bb41f7302), W(0x000083fdb170b360),
+     W(0x00005c259b727323)},
+    0
+  },
+  {
+    {W(0x0000d22bdfb92ec1), W(0x0000a22a8b603a98), W(0x00008b6a139ec2f8),
+     W(0x0000b70d2df8ddfc)},
+    {W(0x00002e1dbef70a22), W(0x0000f0c170f42871), W(0x00001888b6d33d89),
+     W(0x0000b828739e4d5b)},
+    0
+  },
+  {
+    {W(0x0000e36d79cbf875), W(0x0000366267602048), W(0x0000e7fc63d87db1),
+     W(0x0000ed7e2ad81454)},
+    {W(0x00008fb575a5d8ab), W(0x00009ce5eaac9ebf), W(0x00000e064fd9045e),
+     W(0x000012063968ab0f)},
+    0
+  },
+  {
+    {W(0x0000f8879ee06c07), W(0x000049b3ddd2e805), W(0x00001fd4c4ae6aae),
+     W(0x00001cddbd929e4b)},
+    {W(0x0000da9372c03019), W(0x00006303a490a79d), W(0x0000c41a6b302a77),
+     W(0x0000dbe0806ccbae)},
+    0
+  },
+  {
+    {W(0x0000f64d701687e4), W(0x000013f037fe90e6), W(0x0000fa7b2ba5bf24),
+     W(0x000023d555c27a11)},
+    {W(0x0000abdf8ed03f1e), W(0x0000120cd046008d), W(0x000056ccc6c53be5),
+     W(0x0000192d4c0a4d2b)},
+    0
+  },
+  {
+    {W(0x00008ef7700c38cc), W(0x00006063659e0145), W(0x000010c6368244b6),
+     W(0x00005b7420598351)},
+    {W(0x00009f42e7ed5ba5), W(0x0000ce41845d07a0), W(0x0000605da342dc9a),
+     W(0x00006c7310cd156f)},
+    0
+  },
+  {
+    {W(0x000097744c4145be), W(0x0000c9ea148c0f10), W(0x00003966c93b100e),
+     W(0x00003dc75e594280)},
+    {W(0x00005b3b1d95ea3b), W(0x000087953c339608), W(0x0000801f9a3ea918),
+     W(0x00001fb6cf53139e)},
+    0
+  },
+  {
+    {W(0x00008c0abf90ca8c), W(0x00002c09d769ec58), W(0x0000fad0b5b74afa),
+     W(0x00003cbe2c7da3bb)},
+    {W(0x0000ac903a773bd6), W(0x00000f7981e584da), W(0x00004d05e07982f4),
+     W(0x0000fb511824bb4b)},
+    0
+  },
+  {
+    {W(0x0000c13fe080a556), W(0x00008f401f31fcc3), W(0x0000f3d53ac736b6),
+     W(0x0000acc0a82ab498)},
+    {W(0x0000922c7c428512), W(0x00004458cf5d1bbc), W(0x000041d225a88b7d),
+     W(0x0000e5344360ef88)},
+    0
+  },
+  {
+    {W(0x00000ba85a7fc94b), W(0x0000803af5f70d92), W(0x0000cc9f93c0085a),
+     W(0x0000cf29abc17d20)},
+    {W(0x00000fd4504a4328), W(0x0000d7af09d5111f), W(0x00009e6323fea584),
+     W(0x0000be7db308fc0f)},
+    0
+  },
+  {
+    {W(0x000032c5e650c59b), W(0x00004187e1e9cb20), W(0x000028a576dbbe8e),
+     W(0x0000a677c81c9cb8)},
+    {W(0x0000ba9e40f822b1), W(0x000042be543ec137), W(0x00009104926bae02),
+     W(0x00002db50d42d4c6)},
+    0
+  },
+  {
+    {W(0x00008887a17143a4), W(0x00005cc7700f0d69), W(0x000080a260a2c290),
+     W(0x0000183a7bdafad9)},
+    {W(0x0000b14818a99c0d), W(0x0000b800c14c1fd9), W(0x0000ba4959ab0d05),
+     W(0x0000ce7266065d3f)},
+    0
+  },
+  {
+    {W(0x00003a0ab767f2aa), W(0x0000dd2b69b47130), W(0x00008b10fce3efff),
+     W(0x000089085c1df282)},
+    {W(0x00001e0c1a9c49c5), W(0x000010cbbd8b1853), W(0x0000af637007d56b),
+     W(0x0000bdadc9118ae9)},
+    0
+  },
+  {
+    {W(0x0000887489ee48ff), W(0x00001102ed3de4e3), W(0x00002dfdee5a1a76),
+     W(0x00004a591addce61)},
+    {W(0x0000ccc7854f26fc), W(0x000056488e127b5a), W(0x0000af474a4cb8f9),
+     W(0x0000b0c3f9b01776)},
+    0
+  },
+  {
+    {W(0x0000598bdbfb2812), W(0x0000b5bd5cbfdaca), W(0x0000219fa5b45ce7),
+     W(0x0000c9a0b4fdaa8d)},
+    {W(0x0000b408ea4aa474), W(0x000076accaed3be7), W(0x0000c34174973994),
+     W(0x0000ef7f9fda31e4)},
+    0
+  },
+  {
+    {W(0x000024b59184bcd8), W(0x00005058f9cf7127), W(0x0000b5f1be43ce56),
+     W(0x000022b50f737942)},
+    {W(0x000039a86e66680d), W(0x0000784aef5d6cdb), W(0x0000b05c1b476f01),
+     W(0x000036358e544abe)},
+    0
+  },
+  {
+    {W(0x00000b1d1412798c), W(0x00002a12c970b2db), W(0x0000e6e7220dac2d),
+     W(0x00008fc22b81c5d0)},
+    {W(0x0000604271f6480d), W(0x0000640861d90d91), W(0x00009d1a94fc1fc3),
+     W(0x0000d789898db609)},
+    0
+  },
+  {
+    {W(0x00006386d94739fd), W(0x00003957977f9790), W(0x0000ebe40790abac),
+     W(0x0000e1c9cef40637)},
+    {W(0x000098c3b3a5f191), W(0x00004432d2b97daf), W(0x0000d346c27e7ba8),
+     W(0x0000e78577b62bf0)},
+    0
+  },
+  {
+    {W(0x000077e69bb1990e), W(0x00006e0c05155a1c), W(0x0000e446e023d070),
+     W(0x000082f8bd47860c)},
+    {W(0x00004208058ed86a), W(0x0000ff923e7d539e), W(0x0000f9668f58876b),
+     W(0x0000a3b82dc72319)},
+    0
+  },
+  {
+    {W(0x00003d2b1e477c96), W(0x0000ca31d11d3d0a), W(0x0000ba9a9d2e17c7),
+     W(0x00006dfb5a1b73db)},
+    {W(0x0000ed233b106e93), W(0x0000ce40aba5ed76), W(0x0000e39877179cab),
+     W(0x000042affeccca8d)},
+    0
+  },
+  {
+    {W(0x0000cbe98c36a1d3), W(0x00007ba1dfb4db0e), W(0x0000ae6d0ae007d9),
+     W(0x0000fc1746aaeb9a)},
+    {W(0x000056b541aa53a2), W(0x0000e3fca24c8ae3), W(0x00000618168f8827),
+     W(0x0000d7f673614413)},
+    0
+  },
+  {
+    {W(0x0000c0466b091edc), W(0x0000e6e22ebed9f8), W(0x0000c3a72d41ab2a),
+     W(0x0000be373e333c39)},
+    {W(0x000095a5db8cc575), W(0x00002d408e545d91), W(0x000004f99eb34922),
+     W(0x0000f795d390501f)},
+    0
+  },
+  {
+    {W(0x00001a0970237587), W(0x0000931d9d03b3f9), W(0x000026c835caeebe),
+     W(0x00008c169f493b70)},
+    {W(0x00006c869d9cde75), W(0x00003f63d84b2a6a), W(0x0000ecdcde0e8604),
+     W(0x0000444c20e21cb3)},
+    0
+  },
+  {
+    {W(0x000029307cde78e7), W(0x0000acae19a484a5), W(0x00005503b6d82044),
+     W(0x0000748bc66c6397)},
+    {W(0x000078d56e32ad1b), W(0x00001a954389a2db), W(0x0000a60c0bd1047f),
+     W(0x00007312a15fa6a3)},
+    0
+  },
+  {
+    {W(0x00001be3aee7a3d0), W(0x0000d974a00ef62c), W(0x0000d890ace99c1a),
+     W(0x00002282592226a2)},
+    {W(0x00006b713f00835c), W(0x0000790770f4a4e5), W(0x000014e5f85618ed),
+     W(0x00006d6d4f720717)},
+    0
+  },
+  {
+    {W(0x00007f6d41739e1f), W(0x0000b0e34a6729ec), W(0x0000b56000cbb1c5),
+     W(0x0000f12ba593a89d)},
+    {W(0x0000b98338f62cb4), W(0x0000a9a20a601abb), W(0x0000a9001aad4d7d),
+     W(0x0000b56aae1ebdd6)},
+    0
+  },
+  {
+    {W(0x0000d771b9ee84cc), W(0x0000b2370e99a750), W(0x00007639f917ef24),
+     W(0x0000689e964235b3)},
+    {W(0x0000814fd9a8bbc0), W(0x0000b3fab56dfd1a), W(0x00007260c7ad55e8),
+     W(0x00000bc49de92792)},
+    0
+  },
+  {
+    {W(0x00003c7ed336dd32), W(0x00006c7b2bcec680), W(0x0000df4a91dee559),
+     W(0x000033bcdc03aca2)},
+    {W(0x000071fe6a641db4), W(0x000061878f767a47), W(0x000051d7d6709c76),
+     W(0x0000c2a16aed4c89)},
+    0
+  },
+  {
+    {W(0x0000037066f61a93), W(0x00004a665eb2fa9c), W(0x00006a3f68429cee),
+     W(0x000041649e5efee7)},
+    {W(0x0000f0ac30c7d809), W(0x0000f9ab8cc09c26), W(0x0000e4c6238ef70f),
+     W(0x0000641ba136bc4a)},
+    0
+  },
+  {
+    {W(0x000000ee5c28858e), W(0x0000af35acbe24cf), W(0x0000a8ed1c4ae1c3),
+     W(0x0000b391ecf39177)},
+    {W(0x0000e1962a9068fd), W(0x000065d301b52288), W(0x000048ab78157ede),
+     W(0x00007917382d262a)},
+    0
+  },
+  {
+    {W(0x0000a35771205d54), W(0x0000e8a1b5fa1726), W(0x00002dd0dc38d7e8),
+     W(0x0000dacfab2fa935)},
+    {W(0x000049b4cdd9850b), W(0x00004626dac7ab2f), W(0x0000904bac43019a),
+     W(0x000098973a15889d)},
+    0
+  },
+  {
+    {W(0x000086f5650c7605), W(0x0000144fc4979af7), W(0x000042b79cc2bd57),
+     W(0x0000b2dcbe9bb4c7)},
+    {W(0x00002aebc7a0247f), W(0x0000e5fd7a3eda23), W(0x0000604df1685b20),
+     W(0x0000792487639c65)},
+    0
+  },
+  {
+    {W(0x00001bb3bbca45b2), W(0x00002f261e9d344d), W(0x000089568498ff28),
+     W(0x0000c4e09819ed38)},
+    {W(0x000069b496ce4435), W(0x0000db535d2e7b69), W(0x0000a96c77be6040),
+     W(0x0000a168e990f334)},
+    0
+  },
+  {
+    {W(0x00004a1fcab55cf9), W(0x00000d94d44c30f1), W(0x0000d20c7b32d773),
+     W(0x0000da65a6208c95)},
+    {W(0x0000c9e77dea647c), W(0x0000cd0d2bd487bd), W(0x0000bb9f52e097b2),
+     W(0x0000334907fd1b2d)},
+    0
+  },
+  {
+    {W(0x0000569f8749f186), W(0x00001a78b94d05f1), W(0x0000169fc6613a22),
+     W(0x0000e448eb2fd7bb)},
+    {W(0x000045e5815b974c), W(0x00004ffd25bd4489), W(0x00005872d1d81388),
+     W(0x0000e97158da8acf)},
+    0
+  },
+  {
+    {W(0x000006fe02580a70), W(0x0000a91c67146838), W(0x0000d537f67071b8),
+     W(0x0000cb72dc6ef110)},
+    {W(0x0000f3aa6cf0d362), W(0x0000e7ab9c33c2b9), W(0x0000c743af79f25f),
+     W(0x00002401b9aaa32d)},
+    0
+  },
+  {
+    {W(0x0000067ff3e6336d), W(0x000061bb8d5ea524), W(0x000083f9c98e6efb),
+     W(0x0000822b3138e558)},
+    {W(0x0000fe4e15f63841), W(0x0000273eb4396761), W(0x0000bcb499268d52),
+     W(0x00009567068c339a)},
+    0
+  },
+  {
+    {W(0x0000ef1a47e27d19), W(0x0000c72662859401), W(0x00003902b74c155f),
+     W(0x00001bd8d703f534)},
+    {W(0x0000f95498eea477), W(0x0000d58d96423a06), W(0x0000f5cbceaadda2),
+     W(0x000062c71dc36105)},
+    0
+  },
+  {
+    {W(0x0000148e93a690da), W(0x0000fd3193bc36dc), W(0x0000d5aa6d0d35f8),
+     W(0x000090604cad682f)},
+    {W(0x0000a7e7977ddc94), W(0x0000dd0140528076), W(0x00005298396d6098),
+     W(0x000076db8c1d211c)},
+    0
+  },
+  {
+    {W(0x0000f015772bf844), W(0x00000bea606613ad), W(0x00006d81d6c5fccf),
+     W(0x0000621a4c8711bf)},
+    {W(0x00004d6257c839cf), W(0x00001b5920298e5e), W(0x0000ce95cc75a592),
+     W(0x0000ab2e67bf10e1)},
+    0
+  },
+  {
+    {W(0x000098427102c391), W(0x000037e58419b0ea), W(0x0000b23282ff5aa4),
+     W(0x00003515b6145ccc)},
+    {W(0x0000021223d1c34f), W(0x00006c1b96444a6b), W(0x0000a8ce2c5fc33a),
+     W(0x0000d6ab83f151dd)},
+    0
+  },
+  {
+    {W(0x0000ac72f5f65685), W(0x00008f75758d8255), W(0x00007b50bc7955e8),
+     W(0x000036800e27be46)},
+    {W(0x00009e89cc1a712b), W(0x0000447a4e777b3d), W(0x0000a7108c51a19a),
+     W(0x0000f00ae0215eb6)},
+    0
+  },
+  {
+    {W(0x00009bd9e0e7a9b8), W(0x0000c352cdeeec94), W(0x00005ef0d924b4dc),
+     W(0x000020ed05f730bc)},
+    {W(0x000014bd3bfd8c8d), W(0x0000427720a839ad), W(0x0000b3cb135aa8fe),
+     W(0x0000ebdc20b1df6a)},
+    0
+  },
+  {
+    {W(0x0000eb1599ca5683), W(0x00003df956d2ad3d), W(0x0000436c7ec2ae39),
+     W(0x0000d7285a35a944)},
+    {W(0x0000ecf94f98561b), W(0x00001bb8d5fafda8), W(0x0000bb636c5a18b6),
+     W(0x0000b2442d888f89)},
+    0
+  },
+  {
+    {W(0x0000ecd2ebec87db), W(0x00006271414db891), W(0x0000ec1a9201ae54),
+     W(0x00006413be9dd828)},
+    {W(0x0000f1acb91cf42f), W(0x00009d2bcdc08b71), W(0x0000541831e56fd3),
+     W(0x000021c1e80ab550)},
+    0
+  },
+  {
+    {W(0x0000a87c84539035), W(0x000075455fa73ea3), W(0x0000229c367d0a99),
+     W(0x00002256d54027f4)},
+    {W(0x0000f45bbd1376d7), W(0x0000a2b6309cf769), W(0x00006c9953c5b06b),
+     W(0x000092d27e8d2f16)},
+    0
+  },
+  {
+    {W(0x000076b42ceeb2f2), W(0x0000a8a9ba9cb6aa), W(0x000054d07bd803fe),
+     W(0x000091268d61b1ca)},
+    {W(0x0000399661f8c6a4), W(0x0000e49db410f28a), W(0x0000307367be30bd),
+     W(0x00000e7179806abb)},
+    0
+  },
+  {
+    {W(0x00001c1806436abf), W(0x0000eaf1ce59916e), W(0x00004bbe66eb7372),
+     W(0x0000ca16f1f64d83)},
+    {W(0x0000fa5f4c2a99ef), W(0x00006d278ab4bda4), W(0x000051351608cfb5),
+     W(0x0000a30f620aef6d)},
+    0
+  },
+  {
+    {W(0x0000d31a4686de70), W(0x0000a30ffb79bb40), W(0x00009ab1fb3215f2),
+     W(0x00001d8e784746d5)},
+    {W(0x0000d061c5e87310), W(0x0000fb0adc85ab4c), W(0x0000345368450f88),
+     W(0x0000a46768295ea5)},
+    0
+  },
+  {
+    {W(0x0000e347c1ec451f), W(0x000084e3dc809494), W(0x000028d0a14fc7ac),
+     W(0x00009ad7e6d0d840)},
+    {W(0x0000e641b6129c3f), W(0x00000dfffb84e5b7), W(0x0000170799385d36),
+     W(0x000095d74ad2d59a)},
+    0
+  },
+  {
+    {W(0x000057222d737ae1), W(0x00006aec7d7dd934), W(0x0000b8379d5b278c),
+     W(0x0000636374168bb9)},
+    {W(0x00009ddbb307fb3f), W(0x000035c3c817f07b), W(0x00004d1da8ddc642),
+     W(0x0000d3e4b309ea4a)},
+    0
+  },
+  {
+    {W(0x0000da4b003087de), W(0x0000962c853eb7a6), W(0x000031c7bea02b2e),
+     W(0x0000f4949c969f49)},
+    {W(0x00008a39beb1f1a1), W(0x0000e9011d4dc8f7), W(0x00007e88be9a4271),
+     W(0x0000dc0154664e79)},
+    0
+  },
+  {
+    {W(0x0000c92bdee110c6), W(0x0000c6eb7d8576d8), W(0x000084380b201e8b),
+     W(0x00007245ab6553b6)},
+    {W(0x00002e02b1fe97b3), W(0x000094bddc262a44), W(0x000007ae26550d54),
+     W(0x0000f6987d44897b)},
+    0
+  },
+  {
+    {W(0x000051eba53f456d), W(0x00007bc59f07d9ff), W(0x0000b69f1cf7e157),
+     W(0x00008c71d9de7097)},
+    {W(0x0000b4e469c6494a), W(0x000023817cf8f8e6), W(0x0000e8b7bbf16ceb),
+     W(0x0000d632b4e28422)},
+    0
+  },
+  {
+    {W(0x0000bd341cd8fa5f), W(0x0000a1ee52fce998), W(0x00007e962b970f3b),
+     W(0x0000fa6ed2bd9f83)},
+    {W(0x0000ede40c03f406), W(0x00004545e7ceec8f), W(0x0000853c1f701006),
+     W(0x000099f9cda715cf)},
+    0
+  },
+  {
+    {W(0x00000cc70d28d810), W(0x0000ee71493b63a0), W(0x00007ce166a5dfbb),
+     W(0x00004e392122b40d)},
+    {W(0x0000bbc27d878bb7), W(0x000032be4d77fa5c), W(0x0000be68e70f00c5),
+     W(0x0000d76dbdffc929)},
+    0
+  },
+  {
+    {W(0x00008ef7add7abd8), W(0x000043b8a4bf01dd), W(0x00008df36ff8fa48),
+     W(0x0000531e1ce60978)},
+    {W(0x0000276457a32710), W(0x00000a2995d6e224), W(0x0000232a776df205),
+     W(0x0000782d04e270b1)},
+    0
+  },
+  {
+    {W(0x0000040d762032c8), W(0x00002a16dd12e821), W(0x00008ca0704cc49a),
+     W(0x0000f69d2d0779d1)},
+    {W(0x000022805f5ac65c), W(0x0000bf05af072cb5), W(0x0000661bb9a7dd54),
+     W(0x0000e2f8afb6ac44)},
+    0
+  },
+  {
+    {W(0x0000c073ba95fa80), W(0x0000656ddd62e26f), W(0x00006e67832773e1),
+     W(0x00006c0875c4e53c)},
+    {W(0x0000fb394d56383a), W(0x0000e6ae6629d807), W(0x00007fcb94b82b8e),
+     W(0x00005960b922956d)},
+    0
+  },
+  {
+    {W(0x0000e6559bae3b4b), W(0x000076aa4a015a37), W(0x0000bfac78851615),
+     W(0x00000c9d6686b4de)},
+    {W(0x0000030cff652ea1), W(0x00001bae39f36ffb), W(0x00006cb367bf525c),
+     W(0x000063705cb252c5)},
+    0
+  },
+  {
+    {W(0x00009cb3b586e304), W(0x0000a1c7a2d5578a), W(0x000006513b96a1c3),
+     W(0x00005c126ebc8e83)},
+    {W(0x0000b7b5330ab1bc), W(0x0000cc3f0813fdf6), W(0x0000bd553e0b5038),
+     W(0x0000951137b74e24)},
+    0
+  },
+  {
+    {W(0x0000e0fd3c47b44c), W(0x00009bd6ad77f4aa), W(0x00006eb3d3ca0024),
+     W(0x00009435da95e5ed)},
+    {W(0x000060664acefa10), W(0x0000e329cbe3510a), W(0x00007d1646c6e5f5),
+     W(0x0000ffeb7701393a)},
+    0
+  },
+  {
+    {W(0x0000c55305578840), W(0x0000b68fcb112593), W(0x00001aa582d25fdc),
+     W(0x0000cd4a1a038545)},
+    {W(0x00008d036fe5e610), W(0x0000368fcfac2906), W(0x000037f3d32ed31e),
+     W(0x00007906698c55a1)},
+    0
+  },
+  {
+    {W(0x0000b7b5915903d8), W(0x000096a63bc878e9), W(0x00002fc4876e570d),
+     W(0x00000035415e12cb)},
+    {W(0x00007fea216c3a35), W(0x0000a3e2b3fcdc8a), W(0x0000859bc77dacc4),
+     W(0x0000d620f43075fa)},
+    0
+  },
+  {
+    {W(0x0000bb0d67a4581c), W(0x00001fe3004c4e94), W(0x0000c469242d7533),
+     W(0x000090159533b1fe)},
+    {W(0x00009f49dbb279d1), W(0x00009a418dfcf7d2), W(0x0000ae5e179ab624),
+     W(0x0000174a01edbc02)},
+    0
+  },
+  {
+    {W(0x0000a2905a1121ed), W(0x0000341adf5daa1b), W(0x0000bd6a8d1c2ec8),
+     W(0x000084d1534f7983)},
+    {W(0x000035e8fa155039), W(0x00002fabc9720867), W(0x00005a1fce69d224),
+     W(0x0000b327600a349b)},
+    0
+  },
+  {
+    {W(0x00009fa04373424b), W(0x00009946fc855448), W(0x0000b522b1f99dc6),
+     W(0x0000f6ca8d65ba89)},
+    {W(0x00001d68e3ec6eff), W(0x0000ef7b95c97159), W(0x0000e48305c9fda7),
+     W(0x000091cf29ee84dd)},
+    0
+  },
+  {
+    {W(0x0000fb958a78c50c), W(0x0000978db30f0de2), W(0x00009b5c039600f6),
+     W(0x0000a454ae578b79)},
+    {W(0x00001aac00269298), W(0x0000336bb7ee0b91), W(0x00008299114ec4f8),
+     W(0x0000aeec00cb02e3)},
+    0
+  },
+  {
+    {W(0x000059e4d0a04676), W(0x0000a0dd7586ead2), W(0x000042040dccb23e),
+     W(0x000083a4ab72a755)},
+    {W(0x0000d9ff58ab78a5), W(0x000027adc88ff899), W(0x000020c859258c4b),
+     W(0x0000b805b4c78f66)},
+    0
+  },
+  {
+    {W(0x0000f502c633c5b0), W(0x000079a15b909295), W(0x00006624a7ad985a),
+     W(0x00008e914a61ea59)},
+    {W(0x0000a7ee39f25f42), W(0x000025612420172a), W(0x0000ca67b86340ef),
+     W(0x000095dcef3dd030)},
+    0
+  },
+  {
+    {W(0x00003f26b1f5d117), W(0x000044d7c69d52ce), W(0x000060b05b38da09),
+     W(0x00003b48c588010c)},
+    {W(0x0000d496cc32ab2c), W(0x0000f988195c99f5), W(0x0000f5be9a0b99a4),
+     W(0x0000758e78aeff70)},
+    0
+  },
+  {
+    {W(0x000040310fc6dc3c), W(0x00005572cfd428c9), W(0x000048e435d9070a),
+     W(0x0000632c82b5108f)},
+    {W(0x0000be07f40c306a), W(0x000096d92bd1820f), W(0x00002402428f4af6),
+     W(0x0000955e75494715)},
+    0
+  },
+  {
+    {W(0x0000da584b190684), W(0x000075cba14d6245), W(0x0000e66208a065df),
+     W(0x00004c79e8b9f883)},
+    {W(0x0000f52bdcc4da2b), W(0x00000753494daca1), W(0x00004f84a5847408),
+     W(0x00005c0525f24ca0)},
+    0
+  },
+  {
+    {W(0x000050d5eca5fcef), W(0x00002556d361535b), W(0x000045a1e6d8ac28),
+     W(0x00000623b7cb3b08)},
+    {W(0x0000a34c91a7ffd3), W(0x0000538bca7d5367), W(0x000000b97f49fe47),
+     W(0x0000687f9154857d)},
+    0
+  },
+  {
+    {W(0x00006049069a8439), W(0x00006ef1eee72e8b), W(0x0000d9eefb49ee85),
+     W(0x0000ca87de1c73b9)},
+    {W(0x0000fd4097f88097), W(0x00006261bacf09b5), W(0x000046d749f139be),
+     W(0x0000cb01e83439c6)},
+    0
+  },
+  {
+    {W(0x00005a73d7f83766), W(0x00000887d9adfb90), W(0x000089bcc0b4ec11),
+     W(0x0000670f545df9d3)},
+    {W(0x00008ccb6ee529eb), W(0x0000d0834d41a400), W(0x000020272e7c0629),
+     W(0x00000a203fcc4c6f)},
+    0
+  },
+  {
+    {W(0x000002af0614567f), W(0x0000a00439f160c6), W(0x00001944d4c1eb2d),
+     W(0x0000ee81189f5798)},
+    {W(0x0000ebc52a650c0f), W(0x0000b5d0772da2a1), W(0x0000c3a2661ad94d),
+     W(0x0000770902b0b979)},
+    0
+  },
+  {
+    {W(0x0000510bc884284e), W(0x0000adb45bb0e6a2), W(0x0000cc6b6562d6d9),
+     W(0x0000eed9489c7e7e)},
+    {W(0x000083955df2d706), W(0x0000a608c63c5412), W(0x00001c0c26ef6798),
+     W(0x000057ef99a75b67)},
+    0
+  },
+  {
+    {W(0x0000d73079b4f80f), W(0x0000d5fbebbea47f), W(0x00006db2f9d4f5f1),
+     W(0x000071daafe39288)},
+    {W(0x00009ceb054f278c), W(0x0000d94ceedb5dfa), W(0x000083db0c1e3744),
+     W(0x0000308596c7f13d)},
+    0
+  },
+  {
+    {W(0x0000606d3818a3ee), W(0x0000d7caa8c8fcf6), W(0x0000197b863a2f15),
+     W(0x0000fa43c6c037a4)},
+    {W(0x000015eb9da50aee), W(0x0000fa90a3b60691), W(0x000081f97fb6e6f7),
+     W(0x0000512c16d85dd5)},
+    0
+  },
+  {
+    {W(0x00002c2a3457cee6), W(0x00009c12a10af3de), W(0x00004460b0779a86),
+     W(0x0000872f1f9a0ac2)},
+    {W(0x0000be5069d6cb49), W(0x0000c1532fb9241b), W(0x0000d31d0743102d),
+     W(0x000051959cbc7de3)},
+    0
+  },
+  {
+    {W(0x0000695e244c9617), W(0x000005ee94aabec8), W(0x0000fac87b3f3efe),
+     W(0x0000e7d691579ff9)},
+    {W(0x0000ce8fbeb26c01), W(0x0000f8b5d5db5ae8), W(0x0000d6ebc34d266a),
+     W(0x0000cc80f105615e)},
+    0
+  },
+  {
+    {W(0x0000a3d0bd583d1c), W(0x00009b6b2fa57d08), W(0x00008c963fb80454),
+     W(0x0000cec10266e302)},
+    {W(0x0000d2bc653510cd), W(0x000061a00b06f8ee), W(0x00009459f879b5ba),
+     W(0x0000f8715d975b97)},
+    0
+  },
+  {
+    {W(0x00008daa5e2709de), W(0x0000baf487932db7), W(0x0000f261c9e4fdbf),
+     W(0x0000b5aba93306c1)},
+    {W(0x00003cb13f73d7a4), W(0x00003fe8bfd9f3d4), W(0x00009dfa7edae64c),
+     W(0x0000ca51f86a42b2)},
+    0
+  },
+  {
+    {W(0x00008b3dd276bd38), W(0x00003807ad415937), W(0x0000d3b84e4f045a),
+     W(0x0000f16b5c2bab85)},
+    {W(0x0000a6e4b235e53a), W(0x00006f6a2806aea0), W(0x00007f54830afb42),
+     W(0x0000f4166d4c081c)},
+    0
+  },
+  {
+    {W(0x00002808e94e119e), W(0x00004705c11fc063), W(0x00002de2b1e96fcf),
+     W(0x000084474bb1795c)},
+    {W(0x0000a66196040b29), W(0x0000df106f979297), W(0x00004884a25ec491),
+     W(0x000084a84f1fa47d)},
+    0
+  },
+  {
+    {W(0x0000fd1a6f731ae6), W(0x0000b06df110e155), W(0x00003b78e11da2be),
+     W(0x0000d24b07d331a6)},
+    {W(0x0000d24549fe57eb), W(0x00005fe4d60f489b), W(0x0000c9b690821aef),
+     W(0x000074ad2c2e6d49)},
+    0
+  },
+  {
+    {W(0x0000191c1bfeb2ce), W(0x00000d7889b8e132), W(0x000036dc657f35a1),
+     W(0x00000d2766cfb9d6)},
+    {W(0x0000fd79ae7e3775), W(0x000070ff9b88c055), W(0x000027f1d033b704),
+     W(0x0000b6cf43eb4cdb)},
+    0
+  },
+  {
+    {W(0x0000a441b388ff22), W(0x0000c13ed2701ecb), W(0x0000a9b10644ee8e),
+     W(0x0000f362c74e1195)},
+    {W(0x0000259f1afde727), W(0x00000580d83c0b3b), W(0x0000a762ff5834cd),
+     W(0x00008d0c4993bbc6)},
+    0
+  },
+  {
+    {W(0x0000f81ffb26974e), W(0x0000434e45d0fae7), W(0x000004e9f322cddf),
+     W(0x0000952f7f2f44cc)},
+    {W(0x0000386786303a08), W(0x0000e75af4368f22), W(0x00006b8c58cf5c44),
+     W(0x00001fde2bcc6183)},
+    0
+  },
+  {
+    {W(0x0000edf6b5c97616), W(0x0000bb457385671b), W(0x00002de04cd6f327),
+     W(0x0000cb3f466b8ab7)},
+    {W(0x0000ef871b183cfb), W(0x000097500c306673), W(0x0000af4aa3c99cb5),
+     W(0x0000ced05d69e89d)},
+    0
+  },
+  {
+    {W(0x0000b9d7a4f6a81a), W(0x0000e227a2dd5343), W(0x0000fc606d0e5048),
+     W(0x000005c0e1a7ccea)},
+    {W(0x0000e48e3006bb19), W(0x000004a9ba35652e), W(0x00007049714b088d),
+     W(0x0000d6110d8877a7)},
+    0
+  },
+  {
+    {W(0x0000dae1a0de9525), W(0x00000fd603b762a1), W(0x000070b9832157f4),
+     W(0x000058f29d578b6f)},
+    {W(0x000039f9bbee98f8), W(0x0000b1cb459e6f42), W(0x000091fa70fd4ebb),
+     W(0x000086281c9a1a4b)},
+    0
+  },
+  {
+    {W(0x00003ec48ce499d1), W(0x0000495b282d1eeb), W(0x00002993a9bd296e),
+     W(0x0000d8a026801d39)},
+    {W(0x00009f42eb8f1142), W(0x00008b5e5b8b0fa6), W(0x0000d58b31ce19c2),
+     W(0x000062edf6dc6c73)},
+    0
+  },
+  {
+    {W(0x0000a37b664678ba), W(0x0000b4e54e5f8226), W(0x0000ddae93a459fe),
+     W(0x0000baafeb8234af)},
+    {W(0x0000bbdaad9aafcd), W(0x00000de7df312d2d), W(0x00006275a7fa5b17),
+     W(0x0000cb68dbbe5fbb)},
+    0
+  },
+  {
+    {W(0x00004372554327ae), W(0x000032a3dd94a82e), W(0x000090885dacdc09),
+     W(0x0000248504eec79a)},
+    {W(0x0000522e7b2dfd2c), W(0x00006a7103c986b2), W(0x00007847a0251b6b),
+     W(0x00006b1a2a66c318)},
+    0
+  },
+  {
+    {W(0x00005f10532298a3), W(0x00000ce188b1f780), W(0x0000e71a16d2c41d),
+     W(0x000044f8cc882e30)},
+    {W(0x0000cea7350448d4), W(0x0000ae8dbf37a062), W(0x00001be7515a9506),
+     W(0x000041d9f983443e)},
+    0
+  },
+  {
+    {W(0x000054992eea07d3), W(0x000036be53b7d8ae), W(0x0000e1fe388ac176),
+     W(0x00000f418f65152d)},
+    {W(0x0000d2bae41df4e4), W(0x0000b75ae5eb8366), W(0x000095163526abbb),
+     W(0x00006a0f4c005927)},
+    0
+  },
+  {
+    {W(0x00005895a448f5fc), W(0x0000d1d6b9ecf60f), W(0x00008f1d787d597a),
+     W(0x00009fc10ded80e3)},
+    {W(0x0000d9f85bf1f394), W(0x00008aab6470001f), W(0x00001c5ee7032360),
+     W(0x0000f7804f575493)},
+    0
+  },
+  {
+    {W(0x00001e94520df247), W(0x000073faf9181a86), W(0x0000ffcbf7ae3d0d),
+     W(0x0000962b022e276b)},
+    {W(0x00006d90e32804f4), W(0x000051ace0514240), W(0x0000fac0446b4480),
+     W(0x00001895d4d3ac4c)},
+    0
+  },
+  {
+    {W(0x0000c5c69b3cee70), W(0x000095ea17e819bf), W(0x00001e3ded5f19cb),
+     W(0x0000e71858588811)},
+    {W(0x0000532be5ae932a), W(0x000057dda7b9de38), W(0x00005cd3c42cbfee),
+     W(0x000062ae10f210aa)},
+    0
+  },
+  {
+    {W(0x000006928e483897), W(0x000053147e2fe03b), W(0x00001e8ace9f64aa),
+     W(0x00006e770fb4ba45)},
+    {W(0x000092ee04d44eef), W(0x00005a9b20171427), W(0x0000311be204a6d0),
+     W(0x0000c9066e648f7d)},
+    0
+  },
+  {
+    {W(0x00005c6b3aabe8d7), W(0x000071cbb2c42266), W(0x00000b19cd5c86de),
+     W(0x0000e0bcc58d9594)},
+    {W(0x00006264ba4601e2), W(0x00001cf3c67fb2d0), W(0x00003a739d19a3ed),
+     W(0x0000dc439551c6b0)},
+    0
+  },
+  {
+    {W(0x0000c79e185a56a3), W(0x0000fd225fc066b2), W(0x00006fe1373ae21f),
+     W(0x00007c036f5f7179)},
+    {W(0x0000c04bf791115e), W(0x0000eb65f0ca14ff), W(0x0000ae6838146930),
+     W(0x0000c4a2a383f488)},
+    0
+  },
+  {
+    {W(0x0000b81b15968600), W(0x000021097fb48259), W(0x0000e67fec1a9488),
+     W(0x0000ac3bf5ac8a89)},
+    {W(0x00005ed2d3b57355), W(0x000038c1856b7d31), W(0x000084a30a40a474),
+     W(0x00009b9420bde3d8)},
+    0
+  },
+  {
+    {W(0x00008ac560e76d02), W(0x0000f1dff99d1359), W(0x0000da42a5916f5a),
+     W(0x0000518db9743922)},
+    {W(0x0000c3afd192e4a8), W(0x000039d1d7d11d60), W(0x00002613a1483d23),
+     W(0x0000a366a5e090b3)},
+    0
+  },
+  {
+    {W(0x0000b5f3e63e0784), W(0x0000f57b3f0aabe6), W(0x0000d0acb9e5a540),
+     W(0x0000a36e4b4e6b9f)},
+    {W(0x000003a470793910), W(0x0000ea3bf83213ad), W(0x0000a6447d69319c),
+     W(0x00008f854daf32d3)},
+    0
+  },
+  {
+    {W(0x00007b093dbef667), W(0x00008be51da55747), W(0x000089863764e8fe),
+     W(0x00003244b8578594)},
+    {W(0x00009d9e01987dc1), W(0x0000d50228b2d57c), W(0x00005f20a2c5bcd6),
+     W(0x00003bffdf3be785)},
+    0
+  },
+  {
+    {W(0x0000f1b9ab09992d), W(0x0000868e3c14f29f), W(0x0000dca7c62521b4),
+     W(0x0000f4e3f04b9e58)},
+    {W(0x0000a75a9f616651), W(0x000032374864c7f7), W(0x0000b986427e3210),
+     W(0x0000d0679827a1dd)},
+    0
+  },
+  {
+    {W(0x000062ae49502249), W(0x000000d1bb743552), W(0x00002b59815cb3f6),
+     W(0x000084bc3a3ddd43)},
+    {W(0x0000588018742506), W(0x00005dde02696588), W(0x0000c18d68fcd28b),
+     W(0x0000d0b796080823)},
+    0
+  },
+  {
+    {W(0x0000a1a205f07094), W(0x000086b2e272287f), W(0x0000940f959785db),
+     W(0x0000522585424525)},
+    {W(0x0000e003713da71b), W(0x0000679fc4ccc480), W(0x000039299c5baefe),
+     W(0x0000de77cbe5e5c3)},
+    0
+  },
+  {
+    {W(0x00003bd102015093), W(0x00009f01d74b459c), W(0x0000911c7690d239),
+     W(0x00006c34c50ab290)},
+    {W(0x0000eb8326dc41eb), W(0x00003640ee090a1d), W(0x0000a47cca5c6f8a),
+     W(0x0000d623c1b262fc)},
+    0
+  },
+  {
+    {W(0x00003fff202fdae7), W(0x0000baf2c5ebfe1a), W(0x0000d4d5ef8df54a),
+     W(0x0000f2e080f2f23f)},
+    {W(0x000047a9df480243), W(0x0000374d16eb315e), W(0x00009db1af8dd04b),
+     W(0x00003ea5b8c7e69d)},
+    0
+  },
+  {
+    {W(0x0000d025cd6e5779), W(0x0000c760f8316e76), W(0x0000157c5bf72cde),
+     W(0x0000fb4099069c2d)},
+    {W(0x0000510b5c6dc2a5), W(0x00001fb0a4a34948), W(0x00003b3059e2eb0e),
+     W(0x000028f37c55a779)},
+    0
+  },
+  {
+    {W(0x00007fcbb9bfb99c), W(0x0000b58c9285533f), W(0x000039dc6288110e),
+     W(0x0000723f1c9c8f10)},
+    {W(0x00002738b412f305), W(0x00008162a1f2560e), W(0x00002d8a1a0055df),
+     W(0x0000aed2d5cac194)},
+    0
+  },
+  {
+    {W(0x00002436020b431e), W(0x0000a3d41e9cdcc5), W(0x000050cadf2075be),
+     W(0x0000e4a7afe190f3)},
+    {W(0x0000fae26c817399), W(0x000070ae6b9ac86b), W(0x000095aaaf3ced3f),
+     W(0x00009376aada30e8)},
+    0
+  },
+  {
+    {W(0x00009d12168e94bd), W(0x000061240919df36), W(0x0000974e894abec7),
+     W(0x0000d2ea82bb1d6a)},
+    {W(0x00001ac72d594d7a), W(0x0000c02c089e59a2), W(0x0000a4016936fc4d),
+     W(0x00001cc7b411f333)},
+    0
+  },
+  {
+    {W(0x000050e429450c34), W(0x0000c89a0c1777fc), W(0x000033884811ce3f),
+     W(0x00005fe4b9458594)},
+    {W(0x0000ad671f98eef7), W(0x0000422153c29999), W(0x00000ff503ed1ecc),
+     W(0x0000d41a0e74d9a5)},
+    0
+  },
+  {
+    {W(0x000006d46d6ba7e9), W(0x0000dab6475683ee), W(0x0000f741f391d3df),
+     W(0x0000b3f1f999f8ba)},
+    {W(0x00001d5e787d2e0c), W(0x00004991154c4768), W(0x0000b8950f340ac2),
+     W(0x0000d4a8fdd9b868)},
+    0
+  },
+  {
+    {W(0x0000616ff6476828), W(0x0000d19b88a62a82), W(0x0000af824ff17d9d),
+     W(0x0000aff0631c817d)},
+    {W(0x00002e4901ccc789), W(0x00005b0be9080533), W(0x0000a81d049c55e5),
+     W(0x0000efe3011fee7e)},
+    0
+  },
+  {
+    {W(0x00003125c5b32f48), W(0x0000756393279d7f), W(0x000078d3ffb636fe),
+     W(0x00008c66b4dc2993)},
+    {W(0x0000b3c7e718830c), W(0x000016d3895b2658), W(0x0000a1b12d225891),
+     W(0x0000552ed1593e31)},
+    0
+  },
+  {
+    {W(0x00009c3a6eeaf1d3), W(0x0000d1f44e3c7531), W(0x0000c015759834db),
+     W(0x0000fa103b327b2f)},
+    {W(0x000018d23db01b94), W(0x0000dc18a7adc64e), W(0x000099c41e01c33c),
+     W(0x0000afd55d8f53e3)},
+    0
+  },
+  {
+    {W(0x00000cac2dd3fcbf), W(0x0000d7f025674d81), W(0x0000448de0c2156d),
+     W(0x0000d980f5907ee5)},
+    {W(0x0000f80e3b198a50), W(0x0000b62f221726ea), W(0x0000fbc720fedad7),
+     W(0x0000d27066390920)},
+    0
+  },
+  {
+    {W(0x0000eda5b5449ff8), W(0x0000c6713684cc3f), W(0x0000a1f9ee7d9cc4),
+     W(0x0000ea0a72617e2e)},
+    {W(0x0000b47393f6ba5e), W(0x0000e1c0dbf3e749), W(0x00009ea96653957e),
+     W(0x0000a51cb2ff4da5)},
+    0
+  },
+  {
+    {W(0x00005e795add16b1), W(0x0000e6207b852973), W(0x000093bee8ac6f7f),
+     W(0x00002d7d8a7e0fce)},
+    {W(0x000034453602d0d8), W(0x0000d3327872364d), W(0x0000518f999427c2),
+     W(0x0000f340f643d971)},
+    0
+  },
+  {
+    {W(0x000059cba478d04c), W(0x0000c7160a515341), W(0x00002bcf3ac952d4),
+     W(0x0000b30d14814b63)},
+    {W(0x0000f4c09b0cc5fe), W(0x00006f9ac07bd312), W(0x0000a055d197caef),
+     W(0x0000b7daa07e89ff)},
+    0
+  },
+  {
+    {W(0x0000b9ce4409d560), W(0x0000bd6e4ba4fea8), W(0x0000460461db5767),
+     W(0x0000b9e83c76ba29)},
+    {W(0x0000ee9659a5cec3), W(0x0000eba7f81364a6), W(0x000062d7b8c7c5a8),
+     W(0x00001bf3642d3759)},
+    0
+  },
+  {
+    {W(0x00009fdf8f52c644), W(0x0000bc4fece5ddb5), W(0x0000d6a8328e4f37),
+     W(0x00003bcb1814c8a7)},
+    {W(0x00000f5d070200c5), W(0x000006810cf7ad48), W(0x0000e2b6918c049a),
+     W(0x00009aa793732ed4)},
+    0
+  },
+  {
+    {W(0x0000de63176e5ebc), W(0x0000dc7da058edad), W(0x0000435c840b965d),
+     W(0x0000282ac09bff39)},
+    {W(0x0000a95ce03b4fc4), W(0x00004471889fb223), W(0x0000ec039839f949),
+     W(0x00003207cb307a1e)},
+    0
+  },
+  {
+    {W(0x0000bc21f813c063), W(0x0000fe88929a72d3), W(0x0000155ae90a01c6),
+     W(0x0000b6ac72846f8e)},
+    {W(0x00009c7f903956e1), W(0x00009dfb5429043b), W(0x00008b89edd6e4e7),
+     W(0x0000e75bf133aecb)},
+    0
+  },
+  {
+    {W(0x0000edf8cc0b3583), W(0x0000b8508e66ea1f), W(0x0000bc35ecdab7a9),
+     W(0x0000e8ba02243754)},
+    {W(0x0000769ff1b5fa68), W(0x0000a9fc26ce0bf4), W(0x0000edce935f7a67),
+     W(0x00000047ce242143)},
+    0
+  },
+  {
+    {W(0x000074ea9fe8e19e), W(0x0000f42ee54c25fe), W(0x000048367c8aa9b5),
+     W(0x0000c10f34b08dc6)},
+    {W(0x000098667ff2a717), W(0x000045942f7f49f5), W(0x000088219bc50c96),
+     W(0x00005490973e9cf0)},
+    0
+  },
+  {
+    {W(0x0000e824b7fc0a7d), W(0x000019cd63365fee), W(0x0000fefcb20b1e2d),
+     W(0x0000ae151d643f9d)},
+    {W(0x0000c574f7fd3d8c), W(0x0000a069d8415241), W(0x000018347b1ab095),
+     W(0x0000b1e987f3de38)},
+    0
+  },
+  {
+    {W(0x00009027e2b1dcec), W(0x00002c9f0fdaab13), W(0x00008370a8888e33),
+     W(0x0000fc33256d9912)},
+    {W(0x0000fc5bbecc9367), W(0x00005e947c58b096), W(0x000038a007cd1fa8),
+     W(0x0000999d3e1f7326)},
+    0
+  },
+  {
+    {W(0x0000b13e657600a3), W(0x0000abfdfd731c85), W(0x0000abff5a13ba37),
+     W(0x00008fdd98854e8f)},
+    {W(0x0000753bfedb1129), W(0x00003829d9fa12a2), W(0x00001ca5eb38a071),
+     W(0x0000ed71d36ecb65)},
+    0
+  },
+  {
+    {W(0x0000469575a2191d), W(0x00005b9a0533553c), W(0x0000a9d2c2f4e4f0),
+     W(0x000067832db20b28)},
+    {W(0x0000648bd7db58bf), W(0x0000b61b6af153b7), W(0x00000364477b1402),
+     W(0x0000f56f8c10bc19)},
+    0
+  },
+  {
+    {W(0x00006d5c85c938a1), W(0x0000d6a1ac2182d6), W(0x0000a7199a7792be),
+     W(0x0000c602c3cd89d4)},
+    {W(0x0000a5d44a6d720a), W(0x000081800e73b80f), W(0x0000c92473ba5003),
+     W(0x00009bd3003c425d)},
+    0
+  },
+  {
+    {W(0x0000fb94f3c7430b), W(0x0000c8e2077c8980), W(0x000047dcba021557),
+     W(0x00009f3722dc57e3)},
+    {W(0x000023f7703c1527), W(0x0000aff1429eeb36), W(0x00001db12ca674c5),
+     W(0x0000ee359fcf4a39)},
+    0
+  },
+  {
+    {W(0x00008c7a399caa76), W(0x000008ec283e07ef), W(0x0000e4a6c404016b),
+     W(0x00005108027a5460)},
+    {W(0x0000a1884db81f3d), W(0x000030318205d3e1), W(0x0000696185be5466),
+     W(0x000078a8bec6d5ba)},
+    0
+  },
+  {
+    {W(0x0000a7241ecef4b6), W(0x0000b1008cad3d51), W(0x0000a0fb0dd120a8),
+     W(0x0000f54b64295150)},
+    {W(0x000006b32bbc5cd3), W(0x0000b5b5dbff4a01), W(0x0000578439ec1fcf),
+     W(0x000037902c55c55f)},
+    0
+  },
+  {
+    {W(0x0000462d62215b3c), W(0x0000ebb6b08b692a), W(0x0000f8941dc1f6bc),
+     W(0x00006f521964108a)},
+    {W(0x00003fe0022cea67), W(0x0000e2c41dd1596d), W(0x000087f386e6da9b),
+     W(0x0000903a50207bd8)},
+    0
+  },
+  {
+    {W(0x0000070e4eeb47a6), W(0x000086d3a4dbb7f6), W(0x0000f8789ab70e14),
+     W(0x00004e7e36e40fb1)},
+    {W(0x0000115023691d7d), W(0x00004495f514577e), W(0x00005f839afdc055),
+     W(0x00002a5d54e9c9d9)},
+    0
+  },
+  {
+    {W(0x000019ffe6f71d08), W(0x0000ac92fdc0607d), W(0x0000484a50913768),
+     W(0x00009cfd85ab85cb)},
+    {W(0x0000d1830d93d6b6), W(0x0000b238cbe2dc61), W(0x0000a24e440322c2),
+     W(0x000080f287e1101f)},
+    0
+  },
+  {
+    {W(0x0000dbfffadaad16), W(0x00002c398c36b370), W(0x000019db98ce517c),
+     W(0x0000a732c239aac8)},
+    {W(0x0000bccf00a074de), W(0x00009d9a5f181b8d), W(0x0000ad2193c05ff7),
+     W(0x00003f74f3bd15a3)},
+    0
+  },
+  {
+    {W(0x0000adf1ec12b295), W(0x0000a25959029cbb), W(0x00008b676e327ff2),
+     W(0x00002ede369718df)},
+    {W(0x0000b6ca53984eba), W(0x0000e90f21eb726b), W(0x0000c4e950307a12),
+     W(0x00005bf51a0c70a4)},
+    0
+  },
+  {
+    {W(0x00001fbb3ab12ca5), W(0x00007b9365a6c212), W(0x000083772163386f),
+     W(0x000014c01e4cd62b)},
+    {W(0x00004c7d355b2bb6), W(0x000000634017303b), W(0x00001c1bb0e2297b),
+     W(0x000040ae732888e8)},
+    0
+  },
+  {
+    {W(0x00002390a1d4d35e), W(0x00002ffb5c9099d7), W(0x00009dbd899b68cb),
+     W(0x0000734d4f2178da)},
+    {W(0x00003ea8b8855a09), W(0x00004fba28f79b73), W(0x00007585c8bbe66e),
+     W(0x00003e6f0966b69b)},
+    0
+  },
+  {
+    {W(0x00003b8b891927f3), W(0x000092dab6466fab), W(0x000065b6ff3c54e1),
+     W(0x0000656e3179fa9f)},
+    {W(0x00001dc4515ed620), W(0x0000471a19384fb5), W(0x00000396aa56a060),
+     W(0x0000c280d9d2d03a)},
+    0
+  },
+  {
+    {W(0x00007b840d86deec), W(0x0000bc3fbc6f0b16), W(0x0000105ca0bbfd85),
+     W(0x0000c6301f115072)},
+    {W(0x0000d4bef6b14a50), W(0x0000e36fd283f4fb), W(0x0000690722da0101),
+     W(0x0000e6cf1ff89407)},
+    0
+  },
+  {
+    {W(0x0000fb686ace8e09), W(0x000059e532262c1e), W(0x00001201e0bb0d3c),
+     W(0x0000e528e52ff047)},
+    {W(0x0000c719f1d9d46e), W(0x000076a6d91f0243), W(0x0000b2d054a8520a),
+     W(0x00003086047d3a22)},
+    0
+  },
+  {
+    {W(0x0000ed0c69464966), W(0x000053dab51b8392), W(0x00008208073a8736),
+     W(0x00001d765ccfb328)},
+    {W(0x0000db4ba4ebfb3f), W(0x00000b0ce2c08876), W(0x000052a3182ad6a4),
+     W(0x0000b134946efef5)},
+    0
+  },
+  {
+    {W(0x000078a4d42cf4d1), W(0x00003bcda44b5cd7), W(0x000041f42e8ea7c4),
+     W(0x00004d67043d3933)},
+    {W(0x00006dbbfbb7f616), W(0x00005e345ba7210d), W(0x00000f1635d9d69e),
+     W(0x00009d78d11be43e)},
+    0
+  },
+  {
+    {W(0x0000b38079c29aa1), W(0x0000f77ae83bd727), W(0x0000968bd49b0625),
+     W(0x0000075f821bb461)},
+    {W(0x000088d55f7e885c), W(0x00006a9307737b85), W(0x00008c8804bf9e00),
+     W(0x0000e2862cb7a6bd)},
+    0
+  },
+  {
+    {W(0x00000a06be96c4a8), W(0x00008a1a8f0ebcd8), W(0x0000759655d7b527),
+     W(0x00007fd70e9f5b7a)},
+    {W(0x000075e34b6a5fc8), W(0x0000ec3f604485c4), W(0x0000cf5ab098812d),
+     W(0x00007ecdb03caf85)},
+    0
+  },
+  {
+    {W(0x0000c69f847fb216), W(0x000025ecea705449), W(0x0000fc7d3a495eaf),
+     W(0x0000387a3f24110a)},
+    {W(0x0000e78ad76a45ee), W(0x0000b429d14618c0), W(0x000057bffb1915c8),
+     W(0x000021e7513e0882)},
+    0
+  },
+  {
+    {W(0x0000267bb33c16d9), W(0x00002c168e226956), W(0x0000c72b45778f83),
+     W(0x00006c70b7283814)},
+    {W(0x0000cbbd042510b2), W(0x000099ab761504a1), W(0x0000b89182a34773),
+     W(0x0000782b7f1e9699)},
+    0
+  },
+  {
+    {W(0x0000a3683d821179), W(0x00001326c4b41acd), W(0x0000e6cc81b8cdfa),
+     W(0x0000a688839a6694)},
+    {W(0x0000cdbef7ca6db4), W(0x0000d2a26175a62a), W(0x00006e0bfa9c2f2f),
+     W(0x00007f7ba33e0c63)},
+    0
+  },
+  {
+    {W(0x0000d4ddd277c351), W(0x000077dd6f2c87e3), W(0x00000e6f59b3ed9e),
+     W(0x000007e09b3a1220)},
+    {W(0x000070609285dd20), W(0x00005be8bf2422f2), W(0x0000301a328ff017),
+     W(0x0000870c6206b144)},
+    0
+  },
+  {
+    {W(0x000050f52fbd80e0), W(0x00005b72af178035), W(0x00000b496b36a227),
+     W(0x00009670505eb5d7)},
+    {W(0x00001ec52330b5be), W(0x0000e5bb52be65e7), W(0x0000dcd7cc94fd7d),
+     W(0x00002ab6864eaa84)},
+    0
+  },
+  {
+    {W(0x0000341fdaf3dbd2), W(0x0000a6ad46bb1949), W(0x0000c8c8992e013d),
+     W(0x00007f4791b2f4d0)},
+    {W(0x000014146d90d5cf), W(0x0000ebaa0fc78590), W(0x0000f37dd75e9542),
+     W(0x000042186a8e8423)},
+    0
+  },
+  {
+    {W(0x000021ddff79d1a6), W(0x00004000cd546df3), W(0x0000afc64cc66c52),
+     W(0x000076be2e0906fe)},
+    {W(0x0000223ef3738a87), W(0x0000d033a1d1f5ba), W(0x0000b590ed39177e),
+     W(0x00006e5daa01754f)},
+    0
+  },
+  {
+    {W(0x0000d917a30d5492), W(0x0000274630e7b5ec), W(0x00005939b79f4e15),
+     W(0x000016fa06c05191)},
+    {W(0x00006cddb610762b), W(0x00003fc8ae8384f9), W(0x0000777b330beee6),
+     W(0x0000dd4f92fb5901)},
+    0
+  },
+  {
+    {W(0x0000f2a268299cc8), W(0x0000a9a6e50fff3a), W(0x0000726ec7b895d9),
+     W(0x000011dab3ff69f5)},
+    {W(0x00006d09a7ac0a4a), W(0x00006592454051f3), W(0x0000657b623fc5f5),
+     W(0x00004a9c40489a58)},
+    0
+  },
+  {
+    {W(0x00009a6bbbdd59c4), W(0x00001248d5aa3eda), W(0x000078161a084327),
+     W(0x000058068fde786d)},
+    {W(0x0000e48d206e91c5), W(0x0000186850a53e7b), W(0x0000d6827d940581),
+     W(0x0000db19544cb845)},
+    0
+  },
+  {
+    {W(0x000007268d8d62dc), W(0x0000937e0e274d81), W(0x0000814703befacd),
+     W(0x00003a62f274baf9)},
+    {W(0x0000fda8f2169677), W(0x00003d34d7aa3405), W(0x000011f4ebaedd74),
+     W(0x00000b68add3065c)},
+    0
+  },
+  {
+    {W(0x000016de4b8e4faa), W(0x00009b7068a8be87), W(0x0000aecfd518443c),
+     W(0x00008c0c99f081be)},
+    {W(0x00009a6dce5febf1), W(0x00001fdc6fa448cd), W(0x000054c3220cc328),
+     W(0x0000d7393d507642)},
+    0
+  },
+  {
+    {W(0x0000fca8340d7f2d), W(0x0000c85e85a3c45e), W(0x0000e63819c2ef4c),
+     W(0x000096d8e60223a6)},
+    {W(0x00003cb6683a28b2), W(0x000096ac3587d8b7), W(0x0000a69ab8dbe090),
+     W(0x000068f57eabec6e)},
+    0
+  },
+  {
+    {W(0x000025f506b1a5ad), W(0x0000d8a9c6a7816d), W(0x0000af71dd62d913),
+     W(0x0000e39741534522)},
+    {W(0x000016a2a4c53ea8), W(0x0000a09d2bde070d), W(0x0000496cb944a762),
+     W(0x000099d0d1941aaf)},
+    0
+  },
+  {
+    {W(0x0000bd55d46ca6bc), W(0x000091f306ac6d29), W(0x0000b4903fcee9e5),
+     W(0x0000a7834b372ecb)},
+    {W(0x0000a1e35bc9fa8b), W(0x000053b342a5ed10), W(0x0000959a4e797753),
+     W(0x000017ec186df04f)},
+    0
+  },
+  {
+    {W(0x00005faa4967ceb0), W(0x0000a86370701c30), W(0x0000a6f146e699a9),
+     W(0x0000d9d7a7764269)},
+    {W(0x0000a96486ae059b), W(0x0000ba2cb86beb00), W(0x0000ef7845bcdc99),
+     W(0x00003712aeb6887a)},
+    0
+  },
+  {
+    {W(0x0000dfbcd21f023f), W(0x00000799d3542820), W(0x0000426f5734fd41),
+     W(0x00006e2f27cb0214)},
+    {W(0x000060a1128f1847), W(0x00002689fe0bd968), W(0x000085640c3cd4e8),
+     W(0x000051a43af42336)},
+    0
+  },
+  {
+    {W(0x000005178111d3aa), W(0x00003e5c44177bba), W(0x00004467a7d7a6e6),
+     W(0x000016edb0d3e05e)},
+    {W(0x0000a7866bbc9a7c), W(0x000054bf2f40f4f9), W(0x0000828fd1875674),
+     W(0x0000e7cadea10b88)},
+    0
+  },
+  {
+    {W(0x0000e6326a8bfdd2), W(0x0000c6741d182b78), W(0x0000b18dfb3aa472),
+     W(0x000056dfa981726b)},
+    {W(0x00000ac4ea3cd03f), W(0x000072788ee2bd37), W(0x000054f21fdefca9),
+     W(0x00006e9eb45c5597)},
+    0
+  },
+  {
+    {W(0x00000cb67f3d3896), W(0x0000b071160e9a05), W(0x0000474684d04dc7),
+     W(0x000069ccab873a4e)},
+    {W(0x00002a012b5ea443), W(0x0000abf4124c8477), W(0x000093fb22b2356a),
+     W(0x00007a7fb111538a)},
+    0
+  },
+  {
+    {W(0x0000d283773976da), W(0x000043803688a9bf), W(0x000016568aa94a16),
+     W(0x000098f17f6d2d04)},
+    {W(0x00001ebc1d05d4dc), W(0x0000d42df8c88a41), W(0x0000dca0809150bb),
+     W(0x00002337b9df2178)},
+    0
+  },
+  {
+    {W(0x000065df36a11dde), W(0x00007b7edaa1bf5c), W(0x0000c1b3ecad164f),
+     W(0x000050e6daa49778)},
+    {W(0x00006480be07db28), W(0x000004b38c861339), W(0x0000d8fef52812d9),
+     W(0x00004451f228eb23)},
+    0
+  },
+  {
+    {W(0x00001206aadc6df8), W(0x0000daf9aba72f35), W(0x0000d7c57dad358f),
+     W(0x000052d219d46ff8)},
+    {W(0x000046a222049ea9), W(0x0000b0cdb4ed0390), W(0x0000d6ccf603dccb),
+     W(0x000095f644711119)},
+    0
+  },
+  {
+    {W(0x0000176426396cea), W(0x000085e2a1a39a91), W(0x0000e324568832e0),
+     W(0x0000438756f44afc)},
+    {W(0x000073d22835b326), W(0x00000cf2e3e6b130), W(0x000019961fce8e4d),
+     W(0x0000ee969cda4ae9)},
+    0
+  },
+  {
+    {W(0x00000fc3844705a8), W(0x00004f9c454c49b7), W(0x00005047004f6cf4),
+     W(0x00000e6c773c29df)},
+    {W(0x0000823fdce993cd), W(0x00001d449cea26b1), W(0x000094c140efcf5b),
+     W(0x0000e5df5746fcfb)},
+    0
+  },
+  {
+    {W(0x000062653abdf13e), W(0x0000ce4c1be17305), W(0x0000c0188a384efe),
+     W(0x0000017e96db1455)},
+    {W(0x00003b5b60a7aaa3), W(0x0000367c87498a9c), W(0x00008581610c2f29),
+     W(0x0000f5ad9f192ca3)},
+    0
+  },
+  {
+    {W(0x0000b6ec9bd23305), W(0x00007f094f8c7df0), W(0x000058ebad4eed26),
+     W(0x000061438b1252c2)},
+    {W(0x00000fcb3210ced6), W(0x0000f20a8ad7a788), W(0x0000c2146341901e),
+     W(0x0000ad261bcec4ab)},
+    0
+  },
+  {
+    {W(0x0000ed0626d4fb60), W(0x000099697fbacc4e), W(0x0000817655da7540),
+     W(0x0000eb5936a78a64)},
+    {W(0x00001b87cdff8e94), W(0x00008f59770739cd), W(0x0000e10d02a968b7),
+     W(0x00007a123e469c94)},
+    0
+  },
+  {
+    {W(0x00007e7a7e86c9ee), W(0x00005ec063b181b3), W(0x00000f766a2cf05e),
+     W(0x00004e1735e6fe00)},
+    {W(0x0000f8263f46d981), W(0x0000fc6f3966cbcb), W(0x0000b004881420d6),
+     W(0x0000c3944624d107)},
+    0
+  },
+  {
+    {W(0x0000ae1a4ef0197e), W(0x0000b348ed08b26d), W(0x0000b49f254fcb7f),
+     W(0x00006e7da4122b86)},
+    {W(0x0000583e15c892ed), W(0x00003a1c7f08eafe), W(0x000092a39f8cea69),
+     W(0x00002381da3bfdc2)},
+    0
+  },
+  {
+    {W(0x0000f70391fa22d0), W(0x0000ec9f229402a2), W(0x000044fa2bc1f1e6),
+     W(0x00003b8565467151)},
+    {W(0x0000e4f4177c7972), W(0x00009a50d9b26e70), W(0x0000683b61642f25),
+     W(0x0000efb2fe005598)},
+    0
+  },
+  {
+    {W(0x0000b409a8bea691), W(0x0000816dbf920e2d), W(0x0000a9cb975aa2ff),
+     W(0x0000252945fd3893)},
+    {W(0x00006a06f0c463da), W(0x0000f52565251df2), W(0x00009ff13cd4f668),
+     W(0x000074b35efb38b7)},
+    0
+  },
+  {
+    {W(0x0000590e9843f0ca), W(0x0000fce291183aa7), W(0x0000963a0c04ae42),
+     W(0x00009b6a2b2c936f)},
+    {W(0x000056e117eb16a6), W(0x000070de4e863485), W(0x0000706273609caa),
+     W(0x0000be47bbe4f696)},
+    0
+  },
+  {
+    {W(0x00003b87dd5dc358), W(0x000035257873c153), W(0x00009402f39a9c0a),
+     W(0x000052abec7a2bb2)},
+    {W(0x000026435008af10), W(0x00003f451da860a9), W(0x0000a0d2f7b04166),
+     W(0x00004d7c213791ed)},
+    0
+  },
+  {
+    {W(0x0000d4b8206694da), W(0x0000bb45b68d19f7), W(0x000051f7e340c77f),
+     W(0x0000dd003ae7e67c)},
+    {W(0x0000db5091b21af9), W(0x00009a760296bd98), W(0x000077646d261fe6),
+     W(0x000012f205f50e38)},
+    0
+  },
+  {
+    {W(0x0000b036b8849e52), W(0x000084a559328fb3), W(0x0000dcbf2535d499),
+     W(0x0000fc30dd3ffa2d)},
+    {W(0x00003a0af9a85787), W(0x000034f5926f81bd), W(0x000040287b967e3c),
+     W(0x00005b52f77c9132)},
+    0
+  },
+  {
+    {W(0x0000ca97e81f9023), W(0x0000c66c6920a225), W(0x0000f161ee60072e),
+     W(0x00000794fd6222e0)},
+    {W(0x00002a00910109b7), W(0x000036ec284aa4e1), W(0x0000a2fb6677bdd2),
+     W(0x0000058ac6672c50)},
+    0
+  },
+  {
+    {W(0x0000253f0d6e8bdf), W(0x0000eb73f0be2318), W(0x00002d200a28e5f8),
+     W(0x0000824ce2940b91)},
+    {W(0x00008723f8f11dc8), W(0x0000cd523eec0b63), W(0x000006fe4d7c6281),
+     W(0x00004086c3d3b704)},
+    0
+  },
+  {
+    {W(0x000056a13fab6412), W(0x0000e980f605887a), W(0x0000a68349087ce4),
+     W(0x00004db6c682ee2a)},
+    {W(0x0000c43a8e2414c8), W(0x0000fd25bbff5ee0), W(0x0000713722d0e9ad),
+     W(0x0000ce9eb51afb91)},
+    0
+  },
+  {
+    {W(0x000045babb04f70f), W(0x000091f467d48ad5), W(0x0000b84d3eface1d),
+     W(0x000087e7607d7ada)},
+    {W(0x0000cb359398f614), W(0x000041e63a4d82c9), W(0x00003397e87f4150),
+     W(0x0000bc0a04271a10)},
+    0
+  },
+  {
+    {W(0x000052a2bc45b670), W(0x0000c269b5612187), W(0x000053444943b03c),
+     W(0x0000886546137545)},
+    {W(0x00001bcfac40c614), W(0x0000df20a475526b), W(0x00008de1b4e7bfff),
+     W(0x000082a92f139c15)},
+    0
+  },
+  {
+    {W(0x00001e2426621bd4), W(0x0000a308c512956f), W(0x0000d764ffc96ec5),
+     W(0x00007c3e3853e393)},
+    {W(0x00002a4419534916), W(0x0000cc602e566afa), W(0x000003ec4180d6de),
+     W(0x000022480618ce68)},
+    0
+  },
+  {
+    {W(0x000027cf6bf51857), W(0x0000f28b1f38e4be), W(0x000040d96ffd3685),
+     W(0x0000443d9efa2cb1)},
+    {W(0x000083785d195f53), W(0x000025ebf8e9f9e1), W(0x0000d1038ffc4385),
+     W(0x0000bd88e19fbb45)},
+    0
+  },
+  {
+    {W(0x0000db71838fa68f), W(0x00004ed09c5ff356), W(0x00003a3f0642272e),
+     W(0x00003b104f0cdb4b)},
+    {W(0x0000b4396c911444), W(0x00009c3ed93ab248), W(0x0000cbd0aa1f8673),
+     W(0x00008de12a17b047)},
+    0
+  },
+  {
+    {W(0x0000f30dbe76cf3f), W(0x0000729a08e2391a), W(0x00004ce4f34930c0),
+     W(0x00001762628f311b)},
+    {W(0x0000f1c81bdbe332), W(0x0000288bb3b8482f), W(0x0000904d289a5ea1),
+     W(0x00003c401ac0e496)},
+    0
+  },
+  {
+    {W(0x000038ba69c4d9e1), W(0x000076019f8af085), W(0x0000a5ba3cd14035),
+     W(0x00002cabd63b3730)},
+    {W(0x000033eeb354bee3), W(0x000019fb8d9d11f8), W(0x000079d13c5917c8),
+     W(0x000075886ea1c957)},
+    0
+  },
+  {
+    {W(0x0000b216aad30ae0), W(0x00006003dae2a0e3), W(0x0000556cd7f96aa2),
+     W(0x0000ed4153784cc3)},
+    {W(0x000024e9c773f0c4), W(0x0000e3719c12e136), W(0x0000bd5861f21ae3),
+     W(0x000068b786393e11)},
+    0
+  },
+  {
+    {W(0x00007ba3819de791), W(0x0000e3e074f952bd), W(0x00001a1d1f841613),
+     W(0x0000cc40a9cd0312)},
+    {W(0x0000b5b95a8fcf86), W(0x00008ffa7726df9c), W(0x0000f6e5e5d96686),
+     W(0x00005dfc254ede72)},
+    0
+  },
+  {
+    {W(0x00004c8e476ba3f7), W(0x00009922e88a50b3), W(0x0000c335fba51206),
+     W(0x000087cba715d992)},
+    {W(0x0000f1db8c7813c0), W(0x0000abf2df59baf4), W(0x00009d36ebba2325),
+     W(0x0000e60d787ad2c1)},
+    0
+  }
+};
+
+static const wei_tables_t tables_p192 = {
+  p192_wnd_fixed,
+  p192_wnd_naf,
+  NULL
+};
+
+#undef W
@@ -0,0 +1,13347 @@
+/* Autogenerated: scripts/gen-tables.c p224 */
+/* machine_wordsize = 64 */
+/* fixed window = 4, naf window = 12 */
+
+#define W UINT64_C
+
+static const wge_t p224_wnd_fixed[896] = {
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbc9052266d0a4aea), W(0x852597366018bfaa), W(0x6dd3af9bf96bec05),
+     W(0x00000000a21b5e60)},
+    {W(0x2edca1e5eff3ede8), W(0xf8cd672b05335a6b), W(0xaea9c5ae03dfe878),
+     W(0x00000000614786f1)},
+    0
+  },
+  {
+    {W(0x4ca9a1ece722ff54), W(0xd704f84f5650df9b), W(0x10c911f72a0f1689),
+     W(0x00000000cafb50f5)},
+    {W(0x02aac79b95a24e5e), W(0x518c11b1c90ae186), W(0x0c84ced076cc101a),
+     W(0x000000005cabb880)},
+    0
+  },
+  {
+    {W(0xe37710d786614a9a), W(0x24c17ffce0b02223), W(0x00505bb6c3cf1c5b),
+     W(0x00000000af8b6496)},
+    {W(0x9a73b17373e4e25d), W(0x7050163204144e62), W(0xafe10c35357940ac),
+     W(0x000000006dfa492c)},
+    0
+  },
+  {
+    {W(0x0a72faf6840f10e9), W(0x3c2dbf310860856c), W(0x4256e88acb021706),
+     W(0x0000000089f0c6a0)},
+    {W(0x6743e2738c1f2b39), W(0xd8933d1c98933269), W(0x7ee104d32058f0ba),
+     W(0x000000008c87db62)},
+    0
+  },
+  {
+    {W(0x0b10cc50d42fac58), W(0xd80cdd0af8dfc283), W(0x39211b77975a451e),
+     W(0x00000000f7f4fe95)},
+    {W(0x2b552e7364fade9e), W(0x5e5610f361a9e695), W(0x42b54f7911bcf038),
+     W(0x00000000c858da82)},
+    0
+  },
+  {
+    {W(0xde577c0dde4901db), W(0x09e4f7891a8aec73), W(0x1addb3a1e0cd01d4),
+     W(0x00000000f25fe17c)},
+    {W(0x5fae6c32dc7c211c), W(0x5603672c0f5c7709), W(0x9b6731a6f2d2c41c),
+     W(0x00000000162f9e1c)},
+    0
+  },
+  {
+    {W(0x90462820899abac2), W(0xc6adf68368646e35), W(0xc81df8121e2526ba),
+     W(0x000000007ed50814)},
+    {W(0x610f21855dd6407c), W(0x3f3879aa1fb32889), W(0xce5eb25eed8ceeee),
+     W(0x000000000e5952e3)},
+    0
+  },
+  {
+    {W(0xb4c9d865de1707ec), W(0x3fcec8557bd696a2), W(0x8e4a5712a3bebfe9),
+     W(0x000000001b59038c)},
+    {W(0x1bc1ff3629a5f205), W(0x0efc11fd7558734a), W(0xc4e1906609762590),
+     W(0x000000002199c364)},
+    0
+  },
+  {
+    {W(0x1c1ecc777b94d3c7), W(0x23767b5f743eda4a), W(0x94f5e9ba2f993a50),
+     W(0x0000000079d4095a)},
+    {W(0xe07e55b68f776409), W(0x2b57fa61909bf3f1), W(0xe733d62777e1db6d),
+     W(0x000000005114ac9d)},
+    0
+  },
+  {
+    {W(0xb808145ca53cb542), W(0x8d51557eb4f2672c), W(0xc1f86e2c3e8abf6a),
+     W(0x000000009d0cdd53)},
+    {W(0xccddceff8dd67e37), W(0x94892c1d02883b6f), W(0xdbc0f8ee873d7e4c),
+     W(0x000000002a687506)},
+    0
+  },
+  {
+    {W(0xac358ca86c6825d9), W(0x71f50674e1bdd5ca), W(0x0f060758d0dee306),
+     W(0x00000000d6d89093)},
+    {W(0x649ea142f1b7227e), W(0x87d166a208181c2c), W(0xc1182bf06c63713a),
+     W(0x0000000045e48d79)},
+    0
+  },
+  {
+    {W(0xf6495da18f86d9da), W(0x5dc634c9a37b7441), W(0x571d38d92b0b8e1a),
+     W(0x00000000517af941)},
+    {W(0x1305b61292dd72b5), W(0x8db28ab18cf21835), W(0xbc243af05f59deb1),
+     W(0x00000000a71404ae)},
+    0
+  },
+  {
+    {W(0x489c8db23a1f6a38), W(0x4943a5aeffbe563f), W(0x68ade63cbc99fb0b),
+     W(0x00000000398eacf0)},
+    {W(0x83fdacb5ed549cc4), W(0xb6ab4a8b800df824), W(0xb4dc6bf8442ed616),
+     W(0x000000003f8060b4)},
+    0
+  },
+  {
+    {W(0xf4109221b83ee7d6), W(0x565559e4cdbd6eec), W(0xf4550d2e1ef814eb),
+     W(0x00000000b3a9b5e4)},
+    {W(0x1544e90e6d218d7b), W(0x31b0bc683f51f9f9), W(0x6516bbc3825b5795),
+     W(0x000000003d1419d2)},
+    0
+  },
+  {
+    {W(0x55bfd519e977f339), W(0x5cd307d1b16ed1af), W(0xc5e26f62d91345bb),
+     W(0x0000000064a35d22)},
+    {W(0x05015842a243f1ee), W(0x6fa10db370203aa0), W(0xdaf3972b05a83a63),
+     W(0x000000009422f10e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6a4bd1f973b437e2), W(0xbb0f749ab3f66de6), W(0x471a2a7ffdf9a0e9),
+     W(0x00000000b9c51b5f)},
+    {W(0xfa29681a44574243), W(0x9522774b9c409bd0), W(0x48be80cb169405c3),
+     W(0x00000000f22d3fc0)},
+    0
+  },
+  {
+    {W(0xb17f74ecbf5c291a), W(0x7fe47107e460275b), W(0xaef1352456dc0e69),
+     W(0x00000000055bebff)},
+    {W(0x5a0a611585eeba4b), W(0xd72b601652aae002), W(0x55229ca965c91bf7),
+     W(0x00000000837c7497)},
+    0
+  },
+  {
+    {W(0x5983f1a792d256df), W(0x640d13e7ee7ac222), W(0xa7dc8e2148c69cc0),
+     W(0x00000000bd701252)},
+    {W(0x483083a1aa2ef84d), W(0x560bf32fc0d30797), W(0xbda6fdc0d4ec2e63),
+     W(0x0000000015074c14)},
+    0
+  },
+  {
+    {W(0x2587df14bb871aa2), W(0xc5d6ae2a904f01e9), W(0x88aa4d08bce7f04f),
+     W(0x00000000d7f1a354)},
+    {W(0x5bfae67775d9b4b6), W(0xf0375024299925d3), W(0x74d5a7576a708cd7),
+     W(0x0000000097968c25)},
+    0
+  },
+  {
+    {W(0x09f4b85da3147f5e), W(0x05778b5f5fbe44c4), W(0x086f71b72bf31fcc),
+     W(0x0000000097c4854d)},
+    {W(0x38e6f91ef312c01c), W(0xc5ad9f2b9524550b), W(0x86060dc6580a8e1f),
+     W(0x000000000e0ca233)},
+    0
+  },
+  {
+    {W(0x5cc7a3b05c6db03a), W(0x2a4f07377df81446), W(0xde858b94fdbafce3),
+     W(0x00000000dccf2aef)},
+    {W(0x89351ae8cd463946), W(0x092402cbb9de69d0), W(0x3373feadd33d57b5),
+     W(0x000000003f5e09e7)},
+    0
+  },
+  {
+    {W(0xdc504a3696192847), W(0xa00fa5942ff1548e), W(0x55d4cb1819bd5451),
+     W(0x0000000053203701)},
+    {W(0xa06e7c39081edb3e), W(0xfb93a24ba153803e), W(0x949d9711f4af7650),
+     W(0x000000007f296202)},
+    0
+  },
+  {
+    {W(0xd1a6df9844a6cdeb), W(0x89ef410c084a7e0f), W(0xdf5b65900b68659d),
+     W(0x00000000e1cee8dc)},
+    {W(0xf5210071b48fcec5), W(0x01031fdfccbda01d), W(0x01bb7a1c4c7a3392),
+     W(0x00000000a7484df7)},
+    0
+  },
+  {
+    {W(0x9ec58ff9148abb6e), W(0xaf2ac3e5f13ae7f2), W(0x7286fc78c8de96ca),
+     W(0x00000000162d644c)},
+    {W(0x35867d9521ffe163), W(0x5c187c737450a524), W(0xcf1b49da62b6e760),
+     W(0x000000008c7b9b86)},
+    0
+  },
+  {
+    {W(0xdc8054e0743f4c5e), W(0xae050dfc1883868a), W(0x9a30b4479fa29d08),
+     W(0x000000006df41fd4)},
+    {W(0x391ee90886b2cab6), W(0x1cae36f175ea2503), W(0x377ab96cded366e1),
+     W(0x000000004ec018d8)},
+    0
+  },
+  {
+    {W(0x3f77595ba6156da7), W(0xb9484d7c6071f5cd), W(0x3a8108e6a7d4c40e),
+     W(0x00000000cdde33ad)},
+    {W(0xdc862b168a6778f6), W(0x13b22abf9e0a94d3), W(0x298cd26861301fe2),
+     W(0x000000001bee007d)},
+    0
+  },
+  {
+    {W(0xa54309ef72241bb1), W(0xd8fad56fb3259c0f), W(0x994b738c05f63199),
+     W(0x00000000f77c23ca)},
+    {W(0x651f5994f3c92898), W(0xea30b05b7a8a2f30), W(0x8f4acb4c2f0c86ae),
+     W(0x00000000f5eba031)},
+    0
+  },
+  {
+    {W(0x33ce5264c3f1c883), W(0xa880129744c30f91), W(0x098a89a6df6ab7cf),
+     W(0x0000000084397a38)},
+    {W(0xca5adc8d44e11b3a), W(0x548b6f569200d029), W(0x9c0ddc98d24b0794),
+     W(0x00000000d8798e92)},
+    0
+  },
+  {
+    {W(0x0fa94dcf9b764c74), W(0x62991cc89ac66ed9), W(0x774f08b6fd84e4f4),
+     W(0x00000000b7c66a4f)},
+    {W(0x069ff26a74c2b262), W(0xb2b0071e4f39a2e1), W(0xa94be3eabfdcde15),
+     W(0x0000000036a2f769)},
+    0
+  },
+  {
+    {W(0x3589c68859ea674c), W(0x38d2b2a5f5124737), W(0xfec6c9204b075030),
+     W(0x0000000093db6417)},
+    {W(0x065ddb8cf6cc30f7), W(0x06c65238d30d1a68), W(0xd276efd0766edbd0),
+     W(0x000000000b283c89)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xcb74232b698ab732), W(0x4f40ee59b62e25de), W(0xfb8ee6c4c5c8bed1),
+     W(0x000000004617192d)},
+    {W(0xeaf8b0a3626b516c), W(0x0f8cc094dc2453a5), W(0xf43e697c4d7f2e28),
+     W(0x000000002e81523e)},
+    0
+  },
+  {
+    {W(0xe80619b5008cfd4a), W(0xd4f8888225f0799b), W(0x9bf5f7d0eb6dfe0d),
+     W(0x0000000063a366a0)},
+    {W(0x927212be3703627a), W(0xbd5509cb02c160de), W(0xfe05e98d09ea0af6),
+     W(0x00000000bae9ad71)},
+    0
+  },
+  {
+    {W(0x23138239ceaa7c3c), W(0xa694e0b580c0cfc1), W(0x587454f527734f88),
+     W(0x00000000b527a9af)},
+    {W(0x049823f2ee6f2afb), W(0xe574bc6425a1f7dc), W(0x1d11fd76b3ea257d),
+     W(0x00000000afd0ae51)},
+    0
+  },
+  {
+    {W(0xe475669671544a12), W(0x93d2ed81af2eb7f6), W(0xc52db6685c0e9df7),
+     W(0x000000002b7064bd)},
+    {W(0x43184720ded1b829), W(0xad215e80d4b9fc59), W(0x88ef261a1343040b),
+     W(0x00000000b9864942)},
+    0
+  },
+  {
+    {W(0xbabee7910deb6f15), W(0x66179f3c030c3495), W(0x457bca6dd426f7b5),
+     W(0x0000000081319526)},
+    {W(0x2498c158d35cd40e), W(0xaec4ff200b2bd04a), W(0xcff7484912985a92),
+     W(0x00000000837d8e0e)},
+    0
+  },
+  {
+    {W(0xc42a6b834782e689), W(0xa767b1e19e9a2ddd), W(0xabdd54a4f3f5ab2e),
+     W(0x00000000c69f9a88)},
+    {W(0x8affd6625eeb634c), W(0x434e3998b4602516), W(0xfbd56bb7c75f7a3f),
+     W(0x00000000e4aa58aa)},
+    0
+  },
+  {
+    {W(0xf99e1bc14d8759b7), W(0xe489d308f9d97ac1), W(0xe520dfcf31242e73),
+     W(0x00000000ba519709)},
+    {W(0xaada88da502d066a), W(0x2db805ffdf453d98), W(0xa35584c348d83f43),
+     W(0x000000007efe383e)},
+    0
+  },
+  {
+    {W(0x81c21906ee10b9c9), W(0x5c74da45140e4fb4), W(0x65c368fcb07d29b4),
+     W(0x000000006829786b)},
+    {W(0x7c01e8b77aba9db1), W(0x597dbeb55c2ad4ba), W(0xca528c398b692603),
+     W(0x0000000009175739)},
+    0
+  },
+  {
+    {W(0x00e54d7e6fa0e5d8), W(0x53d70b1380274626), W(0x448cb4f0f63104d3),
+     W(0x0000000086f7822c)},
+    {W(0x635d1d19567fec1a), W(0xad5841d374c9d852), W(0xa7638f562f27a18d),
+     W(0x000000007df0f814)},
+    0
+  },
+  {
+    {W(0xbfa21d690f0c5086), W(0x0d29b38c9934b257), W(0xfad28b1a2552b462),
+     W(0x0000000087244f2d)},
+    {W(0xe091c63b042aa2fb), W(0x86f0f8da224579d6), W(0xa4177fae7927774b),
+     W(0x0000000039e5970f)},
+    0
+  },
+  {
+    {W(0x43c60bf94a966ff2), W(0x94a73ea6be98cc32), W(0x6f6a67d4e899fd7f),
+     W(0x000000004805ca93)},
+    {W(0x532ddf8d49a69773), W(0x4785c103b5f6725b), W(0xa61516129818fcf0),
+     W(0x00000000a9419c51)},
+    0
+  },
+  {
+    {W(0xbb5a090b0afb5680), W(0x29e6e1242a905098), W(0xb46f0674eb89d752),
+     W(0x00000000c23b6e08)},
+    {W(0x84d934a57d46e8c8), W(0x814623ef7446341f), W(0x428fe6ef2d200178),
+     W(0x00000000663531ec)},
+    0
+  },
+  {
+    {W(0x4ab996f91ed0f16e), W(0xf3972d523bca93de), W(0x51f0a2509c224825),
+     W(0x000000004390fa94)},
+    {W(0xa17f9bcf52d41c04), W(0x1da254f187ca94cd), W(0x8c10d5328eb876e4),
+     W(0x000000006ab8e456)},
+    0
+  },
+  {
+    {W(0xaede35a83d2d0473), W(0xc3bc4ec343fadb36), W(0x89ff847eda078971),
+     W(0x00000000757ad40d)},
+    {W(0x063bed043367d69b), W(0x96916bd1fbec9b9f), W(0xed5c65dda2938401),
+     W(0x00000000d3c116f5)},
+    0
+  },
+  {
+    {W(0xa2d0d2779e3f46b2), W(0x6e8eb285d8be2204), W(0xac17e25ac9fa15ec),
+     W(0x0000000091b10a2f)},
+    {W(0x12c8ef7f897ae118), W(0x919f4309087fa01d), W(0xd198666ab6f728bd),
+     W(0x00000000cef80aee)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xce2f6f2e16d9fe00), W(0x205e3401ae50cdc8), W(0x59a0da005c73b50f),
+     W(0x000000006b833239)},
+    {W(0x54c575fab1b01bc6), W(0x38a3a688fdd6dfac), W(0xb3095407761a3a3e),
+     W(0x00000000ca8c1a6e)},
+    0
+  },
+  {
+    {W(0x002c4e27979df4a2), W(0xf600aa2e4f02beba), W(0x21de614fc26d73f0),
+     W(0x0000000038b705d3)},
+    {W(0x23429db613b06b78), W(0xa3e9a4f2f4967923), W(0x9eb6af93198f9eed),
+     W(0x000000006bb259cc)},
+    0
+  },
+  {
+    {W(0x9d706835673f027a), W(0xd2469327a86ba658), W(0x108f463b7ce2b526),
+     W(0x0000000003196a7c)},
+    {W(0xb46c53a88cfd0f9a), W(0xb49ffb94aea0ef68), W(0xbc7296004dcbfdf5),
+     W(0x00000000c478b470)},
+    0
+  },
+  {
+    {W(0xdcabdf3a6f5b4a5a), W(0x1e2db542d382ee31), W(0xe97abee6eeccf680),
+     W(0x00000000c6941824)},
+    {W(0x47a3192fc6749744), W(0xc0f578ba7f45fc06), W(0x4d9341e87b1af995),
+     W(0x00000000248e916d)},
+    0
+  },
+  {
+    {W(0x84048cbf276bd605), W(0xd9bab205c7ba57c6), W(0x1745229873781271),
+     W(0x0000000034e9ae92)},
+    {W(0xa064678e5f6198f5), W(0x9f7fa8f28d0f4bdc), W(0x4c193a794453828f),
+     W(0x000000009160a5ec)},
+    0
+  },
+  {
+    {W(0xf9866f2110ec9c67), W(0x29be7caaefb493a3), W(0x371bdc1b6153ebc0),
+     W(0x0000000003d4095d)},
+    {W(0x90a944537aeecad5), W(0xfa2938d429eca8cb), W(0xf61cd6ac2573b98c),
+     W(0x0000000025164163)},
+    0
+  },
+  {
+    {W(0x8a80e3ebea9575d1), W(0x368965773ae85b6c), W(0xc527500fcfeeda82),
+     W(0x000000004f26cdf7)},
+    {W(0xfbd292d2886c7e2e), W(0x22c487db8d1a3239), W(0x836c4ab7f264d31d),
+     W(0x00000000e9800fc2)},
+    0
+  },
+  {
+    {W(0x082378c2dde84f14), W(0xaf15229f4bf3bcae), W(0xb15f6e5282c65899),
+     W(0x000000005919e8e7)},
+    {W(0x6c2512126798e12c), W(0x696c3757ce97fdbe), W(0x1738524df8d74875),
+     W(0x0000000044e69e4f)},
+    0
+  },
+  {
+    {W(0xaf36d8ea54e5bb5e), W(0x124229d1341df1aa), W(0xee0a7952a8661a9e),
+     W(0x00000000a5b3cc48)},
+    {W(0x782333053af61c88), W(0xa8553c9850bd89e5), W(0x9ee3355b77b1d3b5),
+     W(0x00000000a25c4adc)},
+    0
+  },
+  {
+    {W(0xd542647f832a8b19), W(0x293c451ea8dcb879), W(0x42c03172c1b29b4d),
+     W(0x000000001f575e1f)},
+    {W(0x5fd5142d5536eb9f), W(0xa55716662ecf88da), W(0xf07aa1793f881197),
+     W(0x00000000feba942c)},
+    0
+  },
+  {
+    {W(0xd0c1f28353299b45), W(0x1aa5af151d3fca95), W(0xc0d201918f0360e3),
+     W(0x000000007258956f)},
+    {W(0x256844c5ea63cfb6), W(0xbb3bcd8082ace547), W(0x61019fed3355c790),
+     W(0x00000000f0c6182b)},
+    0
+  },
+  {
+    {W(0x54e9eb419c3b9c4f), W(0x2ee02fd11bc6447d), W(0x6369497565482175),
+     W(0x0000000072869bff)},
+    {W(0xf6aea0b9b7191008), W(0x5bd0a826a70d16cd), W(0x14730725a212780d),
+     W(0x00000000dc25b909)},
+    0
+  },
+  {
+    {W(0x9cb2690029a90fe9), W(0xe8f27c7a1023f383), W(0x7ff09f0b12aa9a6b),
+     W(0x000000000980e123)},
+    {W(0x55e77eb284a80d25), W(0x891af5bb64f9afb1), W(0x7c7d77131df53ebe),
+     W(0x00000000bb3dc821)},
+    0
+  },
+  {
+    {W(0x6f9f801bda44d7f6), W(0x09e5f233de60cadc), W(0x03f14ef1dcefa0de),
+     W(0x00000000bfc75374)},
+    {W(0x47d5342fc2ff41e4), W(0xd6530a03167caae8), W(0xbd2baf6e1246925e),
+     W(0x000000004b929764)},
+    0
+  },
+  {
+    {W(0x019b34374a224789), W(0x79d42c4898e1f8af), W(0x828423e05d548148),
+     W(0x00000000eb3dcf57)},
+    {W(0x522759ec81ca6909), W(0x3e0d77428ff0fbe6), W(0x834e8f38c3b304d7),
+     W(0x0000000091e898d2)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8d67344209a50ad3), W(0xc4f517cc01c6af2b), W(0xc6a67d3a24e6fbcf),
+     W(0x00000000bbe5e1ed)},
+    {W(0x964e75d18492568c), W(0x09dfd2ceb97b0d10), W(0x67a932fe09007531),
+     W(0x00000000c85f611d)},
+    0
+  },
+  {
+    {W(0x306867f0e5f3820b), W(0x5fe6163a271f814c), W(0x038f4fe6455790c2),
+     W(0x0000000058008770)},
+    {W(0xa3ffa2552a2eebb4), W(0x4eecbe862ae5134e), W(0x2bb3a978fa061ce0),
+     W(0x00000000a4fe1b53)},
+    0
+  },
+  {
+    {W(0x12b7160320bad002), W(0xd5045d6c0ee3063d), W(0x853772f72261149a),
+     W(0x000000008f349671)},
+    {W(0xdd3b39e19ec1ef24), W(0x02d7c1cd3acb7c05), W(0x9381a0b034c3e767),
+     W(0x0000000074081fec)},
+    0
+  },
+  {
+    {W(0x90a49b52ae230adf), W(0xdfc8b644f501aeb8), W(0x8b89e79bc50fe003),
+     W(0x00000000a04a6f7a)},
+    {W(0xff3922ddc225c287), W(0x0cd4b29fc4ed1911), W(0x8af23a3e0ce76929),
+     W(0x00000000918974b5)},
+    0
+  },
+  {
+    {W(0x1b735668239b2f0b), W(0x066337aebbf9ef82), W(0xf058688a754e211c),
+     W(0x0000000095864d69)},
+    {W(0x8beee13639a1596b), W(0xd3b816819150359b), W(0x3f4ac39d0ab949fd),
+     W(0x00000000f6d5f8ee)},
+    0
+  },
+  {
+    {W(0xfee998498da671b5), W(0xdbbe577f2e099be3), W(0x31915ae65f8e6df6),
+     W(0x000000002ba98b17)},
+    {W(0xe2f20ab00d5b6ffc), W(0xdc69cc94791aa104), W(0x5c5045ab2ae23401),
+     W(0x00000000d646c528)},
+    0
+  },
+  {
+    {W(0xe6bee7b891f7da3d), W(0x303e2e61b1959a03), W(0xe7e570569b779901),
+     W(0x000000001c2d553f)},
+    {W(0x47995b489abaa6a1), W(0x6d28c851ab4d653f), W(0xb70d2132f8e40f18),
+     W(0x00000000baae5b9b)},
+    0
+  },
+  {
+    {W(0x597ba0a80fd96b35), W(0xb6624fc60eb981ea), W(0xbfc4dac6e6e26240),
+     W(0x0000000035dd20af)},
+    {W(0xe7b4056361745187), W(0x554c1adc8d381cfb), W(0x354e81ee4013b9ec),
+     W(0x0000000050a8d84c)},
+    0
+  },
+  {
+    {W(0x6d08786e67aad45f), W(0x8bf6b0652cc15260), W(0xa53ab3f484169282),
+     W(0x0000000049111025)},
+    {W(0x8db73ccf714a4d69), W(0xaec354d349ee5fc0), W(0x26497f34eb0a609a),
+     W(0x00000000752e2221)},
+    0
+  },
+  {
+    {W(0xd3c9cb6ad67a8d4c), W(0x115ea4ff38755541), W(0x5c237f2b4ad0effb),
+     W(0x0000000075646bb1)},
+    {W(0xa07ca1d31c0c1001), W(0xc00e9dcd7f647322), W(0x819d18b8e24ec66d),
+     W(0x0000000095c255a0)},
+    0
+  },
+  {
+    {W(0x8d7cbdb6c3ff6cb2), W(0x2baad72032e5cd9d), W(0x43f0f9112385860f),
+     W(0x000000004b6038f7)},
+    {W(0x8ece6e04e096aed9), W(0x964d3a2640da7078), W(0x1a09dbafa20a6649),
+     W(0x00000000709cfd74)},
+    0
+  },
+  {
+    {W(0xcfce86aabf7ca431), W(0x5158554516c2854c), W(0x5fd18a953999a9a1),
+     W(0x00000000a1e55106)},
+    {W(0xd7192594d29f7bb5), W(0xb7a8c7e27c17c721), W(0xdb82b841f6856acd),
+     W(0x0000000039017815)},
+    0
+  },
+  {
+    {W(0x08fa51751b2f2123), W(0xe9ac51f9ad400dee), W(0x8bbf71addb50d10c),
+     W(0x000000001322cb4e)},
+    {W(0xb7ef36d23efa91c3), W(0x4c6187caa5571f80), W(0x6a106d1c938aa540),
+     W(0x00000000fee7b99f)},
+    0
+  },
+  {
+    {W(0x7d2123b37c5bc163), W(0x1d58d68061435520), W(0xeb4a95b52b094145),
+     W(0x0000000009b8c6a3)},
+    {W(0x54e524543c690f29), W(0x6bd00cf3646b89b4), W(0x17b930ad2640a633),
+     W(0x00000000a457233d)},
+    0
+  },
+  {
+    {W(0x97507c26c39fd75e), W(0xd82ad3a60c5debbb), W(0xa01f4d9e3c42310d),
+     W(0x000000005fdffd07)},
+    {W(0x5e2bab3ed1fedd01), W(0x8abe3a414ce43e20), W(0x0c4858ede71cd8a2),
+     W(0x000000008bd12b19)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0f4e6e420874ad96), W(0x3e5a96cd2bfeb37b), W(0x53c918ad6bb45b1b),
+     W(0x00000000b8bd0546)},
+    {W(0x0e33f7bcfd07d3ba), W(0x58f58e4a9e58beb5), W(0x986f520626578e47),
+     W(0x0000000090135d8a)},
+    0
+  },
+  {
+    {W(0x4190a603089bae53), W(0xa64a64f3ec5c8b6b), W(0xba9eddb48bca6d9c),
+     W(0x000000003ebc0dcc)},
+    {W(0xa709d0a09555731f), W(0xa147a9ebc3d3be2f), W(0xf474acd5dae0ded6),
+     W(0x00000000965b8988)},
+    0
+  },
+  {
+    {W(0x801f7df639cc2db6), W(0x71e956a8c0e48f44), W(0x7e8d39ef6f629eae),
+     W(0x00000000df356d0f)},
+    {W(0xc937c69cc49f6ead), W(0x426a73c660ad874d), W(0x12e7f7d5b58156ab),
+     W(0x00000000ae200b42)},
+    0
+  },
+  {
+    {W(0xfb05e5eca9158749), W(0x5b8ef8887df5ec60), W(0xd08f651c2d8170fd),
+     W(0x00000000e08fb325)},
+    {W(0xa2b2a1731ccffe04), W(0xe5f3342220fa30ea), W(0xc7e20c19d169c10d),
+     W(0x00000000366327ee)},
+    0
+  },
+  {
+    {W(0xc2de5a474f713ab4), W(0x19272ef2fc219c62), W(0x10b29f678810b8af),
+     W(0x00000000e9b9c1a6)},
+    {W(0x3b8d7e415778e437), W(0x4c59e903cc9dd567), W(0x21b028e3a3a0f1ab),
+     W(0x0000000020be611a)},
+    0
+  },
+  {
+    {W(0xf62aa1bd5d85ed76), W(0x38737578e359773b), W(0x31df94392b782c08),
+     W(0x0000000080e166af)},
+    {W(0xa7a7bd40673b4b07), W(0x95ad760250ca47c9), W(0x4a7eebb48ed45ebe),
+     W(0x0000000003e9fc9d)},
+    0
+  },
+  {
+    {W(0xc4d10bdfb7bc57d3), W(0x164bb36ecbdffecd), W(0x6513a3ad86e7136c),
+     W(0x0000000048a93aaa)},
+    {W(0xf17a5691e00d91d4), W(0xbf90fe39207ae758), W(0xf7cfa610889e08aa),
+     W(0x000000004e1328b6)},
+    0
+  },
+  {
+    {W(0xaba113fc33fde338), W(0xc0022adf0e6fb34d), W(0x491a39cae2da2a97),
+     W(0x0000000054e2ec96)},
+    {W(0x3d0946d9b883d291), W(0xd8794d716f792b36), W(0x13094248d78ca8ec),
+     W(0x00000000286898ab)},
+    0
+  },
+  {
+    {W(0x06caad18f6fc92a1), W(0x6f770ed74f2a7a0f), W(0xc56bfff154b9fb74),
+     W(0x000000000c42d460)},
+    {W(0x5f286d93e8e26937), W(0xf04c11d4fb804a26), W(0x7e1e4120952a7a51),
+     W(0x00000000337c1615)},
+    0
+  },
+  {
+    {W(0xb354ae4c0c894527), W(0xa39fcad9f18c6f77), W(0x7bd039dcf685126a),
+     W(0x00000000fb3809c0)},
+    {W(0xc99f8944e8ec1ffb), W(0x08ed706a7c71a341), W(0x4c371e8621f4ed22),
+     W(0x00000000a650cd97)},
+    0
+  },
+  {
+    {W(0x4c915eacaafa584f), W(0x955722a3da244955), W(0xe3a031fd6e3e47f0),
+     W(0x0000000027c9f749)},
+    {W(0xfdbcbdceafcba503), W(0x6faf48df006ea7ef), W(0x7957977a3f73f83d),
+     W(0x00000000b05e95c2)},
+    0
+  },
+  {
+    {W(0x8e7cfcb064586632), W(0xe83d4510fcae4f5c), W(0xc9a4fa0c62196ce2),
+     W(0x0000000083e1de7b)},
+    {W(0x8f0bc09a4871e08f), W(0x1e32cbe6fa78f5d2), W(0x23d217ebda32a5ee),
+     W(0x00000000f8df814e)},
+    0
+  },
+  {
+    {W(0xfd976685dd8ce9e3), W(0xa8ff6c8d2b380b3d), W(0x1ddb54ba2b68553f),
+     W(0x0000000032e6268d)},
+    {W(0x850aeb9db90b7338), W(0x990e35f243a5e7c5), W(0x58b29b78a0388567),
+     W(0x000000005770b359)},
+    0
+  },
+  {
+    {W(0x80a1f116efdc00b8), W(0x0b205db0670e56db), W(0xcaa4c48ad1c521ab),
+     W(0x0000000041b37b7f)},
+    {W(0xf6421dcede1b3d20), W(0x906ec304afa1a3e7), W(0xbc2935cf5c6bc442),
+     W(0x00000000be169cc3)},
+    0
+  },
+  {
+    {W(0xcbf4aeccc210b654), W(0x48ff9001c27e94b5), W(0x0ac17cf674afa385),
+     W(0x0000000032be12af)},
+    {W(0x525253b73816d185), W(0xa5f98e90124b6093), W(0x6733fe3bae5f6f3f),
+     W(0x000000009f03199f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe5876159a597c946), W(0xcc637e99308bf446), W(0xdb6a36f68047e56a),
+     W(0x00000000e8293346)},
+    {W(0x93a30fbd51f3fb7c), W(0x3e0a22c7cd2f5b41), W(0x3d9fe7400b7b25a0),
+     W(0x00000000aafd7816)},
+    0
+  },
+  {
+    {W(0xac70d023cabaac34), W(0x7fc6e9c4e4e20984), W(0xcce8d1030ffac935),
+     W(0x000000006efdaa99)},
+    {W(0xea3876d9d5d8263d), W(0x1319056aa0b5e29a), W(0x9fa645d365ae7e78),
+     W(0x0000000093cb4927)},
+    0
+  },
+  {
+    {W(0x7f6337ce886ba3df), W(0x7b3e3023e5943606), W(0xa28353d521b5b09f),
+     W(0x00000000917b4519)},
+    {W(0xfd5ad004d1005ca4), W(0xc733582573dbf462), W(0x3b50b66b7f25c9d4),
+     W(0x0000000035b3bf78)},
+    0
+  },
+  {
+    {W(0x11e78f96857c7d7b), W(0xcd19ea8e55ff3762), W(0xb557ab25a90b8b11),
+     W(0x0000000098bfd175)},
+    {W(0x453f5ec0436277e5), W(0x74f19c3ebd8cc123), W(0xaf6d61dee53f50d1),
+     W(0x00000000b809c27b)},
+    0
+  },
+  {
+    {W(0xed539df19fba2bd9), W(0x718a4f45d5c7355c), W(0x10d601445ced43ea),
+     W(0x000000009618c03b)},
+    {W(0x8b9bcb4a55e1556d), W(0xf1a46d41e3767fbb), W(0x8a0093442a5c6f77),
+     W(0x00000000a23cb6b8)},
+    0
+  },
+  {
+    {W(0xd49816e2bda630b0), W(0xabd8c48b68c388d9), W(0x3b976a04741de91e),
+     W(0x00000000f24259fb)},
+    {W(0xcbbf26845a923f4f), W(0x8a51b8af56659522), W(0x43c8b17eea31954e),
+     W(0x000000003d1de35f)},
+    0
+  },
+  {
+    {W(0xd85103689613f782), W(0x7ea65e3dd5dedcbd), W(0xbd599498ab06f6a4),
+     W(0x00000000c5aa099e)},
+    {W(0x32f40f7bf3eb18eb), W(0xfde611a8ad93fbe0), W(0xf575175240b951f1),
+     W(0x00000000fc37b6e1)},
+    0
+  },
+  {
+    {W(0x2c486c0bf649bf08), W(0x9417e436a5afc024), W(0x38aa1ed3b063a531),
+     W(0x000000001558aff7)},
+    {W(0x904e9ed7004fbb10), W(0xd2555c073494f0b6), W(0x0f32df2c365e3d05),
+     W(0x000000005c8f30d5)},
+    0
+  },
+  {
+    {W(0xb3b67c86ab778dac), W(0x22160b145820cba5), W(0x250299647c0b0cc9),
+     W(0x0000000000e9bedd)},
+    {W(0xa03f67af34239318), W(0x4b896c94e93bd50d), W(0x7b36c385dbbf6cc8),
+     W(0x0000000052ff4ee5)},
+    0
+  },
+  {
+    {W(0x44a137ddd002f978), W(0xe36c72920478c491), W(0x0dae117fde2fcba0),
+     W(0x00000000770ea0d5)},
+    {W(0x3d353ef26ba16838), W(0xb45fb17255305daf), W(0xe9f934b43cd0df40),
+     W(0x0000000019eea8bf)},
+    0
+  },
+  {
+    {W(0x64e46b9dde73d4c6), W(0x27db09e8a3bc34ba), W(0x065c30a4c2253e0f),
+     W(0x0000000080db0967)},
+    {W(0xb3c5523b51520af6), W(0xf9474fc39496552c), W(0xb2a382f59bed457c),
+     W(0x000000004aeb3ea6)},
+    0
+  },
+  {
+    {W(0x2f568e24a0b8f0c1), W(0xe025993cd071a827), W(0x1682ebbaedf5f151),
+     W(0x00000000d5332d28)},
+    {W(0x0b9b644c3e49236b), W(0xa74f5b436e8cf368), W(0x5058f53c315b0cb0),
+     W(0x00000000162aae3f)},
+    0
+  },
+  {
+    {W(0x3ac9a7c774022757), W(0x9e23a00d779d3242), W(0x4c8985e24a3a2684),
+     W(0x000000008287c86d)},
+    {W(0x07576911d0e0ce70), W(0x45643bd6e114aff0), W(0x9e67041bfd164b9a),
+     W(0x00000000aa98a9de)},
+    0
+  },
+  {
+    {W(0xa18e971260c5105d), W(0xfe3628ee075732c1), W(0x65869dfb3deea963),
+     W(0x00000000de8f8c00)},
+    {W(0xfb6482713b2a040d), W(0x3486dc8328386f82), W(0x00237a52b76af510),
+     W(0x000000006c2a5299)},
+    0
+  },
+  {
+    {W(0x3d7f6a9a850ac224), W(0xe40d55752ceef446), W(0x167cd22b97d044fd),
+     W(0x0000000017cc66ce)},
+    {W(0x2c7356b9d8058cd1), W(0xfc536ebf4d09558d), W(0xc4f911b6bbfb1e44),
+     W(0x00000000a4e61004)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6a7ebdd12f432139), W(0x25d6c68a676d690b), W(0x70ef4a18f169ac1a),
+     W(0x000000003fe9e66e)},
+    {W(0x9b515115a193f6f9), W(0x4399b66b6b6b0581), W(0x52c4fcf1d0e88db2),
+     W(0x0000000031c324fa)},
+    0
+  },
+  {
+    {W(0x403677bb62e391aa), W(0xcd3fd0e0e67af8a2), W(0xdcb518130b4be307),
+     W(0x0000000088ce9bf6)},
+    {W(0x0f788e98e4877d66), W(0x1742afd08400154f), W(0x80428f26768edb4a),
+     W(0x00000000277da6c6)},
+    0
+  },
+  {
+    {W(0x6933e2460b15cc70), W(0x8bc929588f4bec34), W(0xc9121c9213b62772),
+     W(0x00000000543662c4)},
+    {W(0x1090a59c4549aa77), W(0x066a0956c62e7c6f), W(0x19c57ed5a38394a8),
+     W(0x000000004823e8cf)},
+    0
+  },
+  {
+    {W(0x61b100d2003e564b), W(0xaf3087cc416f9398), W(0x11e5f34b8d0f5a48),
+     W(0x00000000e047da80)},
+    {W(0xc598885ae946d928), W(0x838b9ed4455959c9), W(0x6bdbe44ce69bdd02),
+     W(0x00000000d3377883)},
+    0
+  },
+  {
+    {W(0xe93c7baad1de4464), W(0xb54baf6323daaa17), W(0x64e1431bcf91e74b),
+     W(0x000000001ae9e235)},
+    {W(0x2c00590f43fd6c3d), W(0x98d151a00ba0b46e), W(0xe61cc51e1ee4dc18),
+     W(0x0000000093805289)},
+    0
+  },
+  {
+    {W(0xa33f496c15b970a3), W(0x3f6d708bc65b315e), W(0x2ca2c55125723787),
+     W(0x00000000c7e943c6)},
+    {W(0x1845a4319a10432d), W(0x81764017b33bb1fe), W(0xbb41c15af5b5a1e6),
+     W(0x00000000f5bd0a9c)},
+    0
+  },
+  {
+    {W(0xe9864244042a23c5), W(0xbb7b264873ab2381), W(0xe3536d470ed12b18),
+     W(0x000000000a040c86)},
+    {W(0x550f58009c5a68b2), W(0xfa0aebe0a16b2d10), W(0x40239ea3d20e3020),
+     W(0x0000000013feb317)},
+    0
+  },
+  {
+    {W(0x122068598e882fb8), W(0x3e1a95f6d53242c9), W(0x765eedc11c2921f5),
+     W(0x0000000084f582be)},
+    {W(0xf8de62be525bb499), W(0xd0a27199f9eee520), W(0x721633cd209f3c9d),
+     W(0x00000000c2e9678c)},
+    0
+  },
+  {
+    {W(0x852acfe8c8a35690), W(0xdde1d1be92b626ca), W(0x918c76faf571ade2),
+     W(0x000000005b7490f5)},
+    {W(0xdf1662bd38c8b0c0), W(0x470868d3bb1e6d8b), W(0x9a06de8ad821c745),
+     W(0x00000000caec5c2c)},
+    0
+  },
+  {
+    {W(0xc1321d2a64f233d6), W(0x30546bc874538108), W(0xc8d1c4862f1d65e6),
+     W(0x000000008ecd7a1e)},
+    {W(0x3466245accea4b95), W(0xf5d50910700ed4ab), W(0xb5a66db1fa32badf),
+     W(0x00000000fc4883b2)},
+    0
+  },
+  {
+    {W(0x962b479cb4589512), W(0xb97069b4c4a7efe4), W(0xd0ef4040a0d20fc9),
+     W(0x0000000076eabbd4)},
+    {W(0x17a7508138b07e76), W(0x3d3dbafe4bc6d910), W(0x36e896fbff0f721e),
+     W(0x000000006146e5ef)},
+    0
+  },
+  {
+    {W(0x6fd3001fab1ff699), W(0x5b228934e508cb13), W(0xcc02c93c80a73390),
+     W(0x000000006ad8073c)},
+    {W(0x5f92bcf69444deec), W(0x06c7d42b8847a6eb), W(0x40b45a83758f4aa4),
+     W(0x00000000db4ada91)},
+    0
+  },
+  {
+    {W(0xfff55c750083de14), W(0x317fc21d661c826d), W(0x6bdaa80cb311e146),
+     W(0x00000000cad158e9)},
+    {W(0x4502f45469952fc9), W(0x74f37d8f239ecee1), W(0x161e1cf82b344eb3),
+     W(0x0000000002ce3f80)},
+    0
+  },
+  {
+    {W(0x0009b919645e7684), W(0x8105efea53d14c44), W(0xdf767e4ccbb0101a),
+     W(0x00000000ecc4eabb)},
+    {W(0x70cf6d6c0c2ac7fe), W(0x170895270ede1159), W(0x5ed679cb4162258f),
+     W(0x000000005e706cdc)},
+    0
+  },
+  {
+    {W(0x33b4ee64cd1206e2), W(0xcab93e6778fd4645), W(0x7e760bcfb807ac0a),
+     W(0x00000000923934bf)},
+    {W(0xaf2ed832fa2159f5), W(0xe1d5b548918e957c), W(0xde9c3716df411692),
+     W(0x000000002c76553a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd3a72d083d4c49ae), W(0x03aca3cca5e4f840), W(0xf00706d6d9bcbe83),
+     W(0x00000000986b79c3)},
+    {W(0xefb01a68412a3304), W(0x19e3729ea0bb40d2), W(0x57b4bca12d182974),
+     W(0x0000000043c566de)},
+    0
+  },
+  {
+    {W(0x82f0ce0889b3a627), W(0x4c9d1c888ffc3544), W(0xf2cd74da1414581d),
+     W(0x000000002ab74c29)},
+    {W(0xd4c61a1b47673821), W(0x4166899a8b9a0584), W(0x7b53c8e6d7114188),
+     W(0x000000004e91e1e4)},
+    0
+  },
+  {
+    {W(0xce03f04a3118786e), W(0x107aaf6b827606a4), W(0x277b88b910bcfdd2),
+     W(0x00000000f2e4c5e4)},
+    {W(0xb9213c6db9b85218), W(0xebb4f0be161c54e8), W(0x859e60452814c386),
+     W(0x00000000ac244cf4)},
+    0
+  },
+  {
+    {W(0x680b826b004de7f7), W(0xc1ff25d4c0a2ee02), W(0x8b33b701b25a4e2a),
+     W(0x000000003a2939d0)},
+    {W(0xe6feb01b9621d94e), W(0xca0e2b81d1311810), W(0xdbcecc81a701c8f2),
+     W(0x00000000eee95871)},
+    0
+  },
+  {
+    {W(0xc6ef0b2bba999075), W(0xf6d22ab0ece247c6), W(0x135549571b593e87),
+     W(0x00000000ac683c89)},
+    {W(0x4edf5e770740cc1e), W(0x64817f700bd01e9c), W(0xbb03044cbb544f1b),
+     W(0x0000000052d9c64d)},
+    0
+  },
+  {
+    {W(0xabd58a31eb3d07d3), W(0xe9d983710becd14a), W(0x455fdc2f8ccd0d0a),
+     W(0x000000002619d271)},
+    {W(0xa0ead660e85b2855), W(0x054a971cf9ec3cde), W(0x57797143d585bb5b),
+     W(0x00000000442ee40c)},
+    0
+  },
+  {
+    {W(0xa29959175ba51b3c), W(0x5fd33dc808220ee9), W(0x00769e1f8eabc610),
+     W(0x00000000dc0795e2)},
+    {W(0x816611ff6608d9f5), W(0xdad3f2c88c835504), W(0x111f610fc1dd016b),
+     W(0x000000008f80fac6)},
+    0
+  },
+  {
+    {W(0xb5c4c69b22d3206b), W(0x886af51ef507ee25), W(0xf21fe543454a0f10),
+     W(0x0000000029d7720a)},
+    {W(0x7c33ec2a22d2999a), W(0xa4d8106eb4054a86), W(0x8a74b5b0db971595),
+     W(0x000000008850caf4)},
+    0
+  },
+  {
+    {W(0x6fabb994942e6278), W(0xe5cc0c4b4f08b611), W(0x2af6f2166773822b),
+     W(0x000000001eb9d7e7)},
+    {W(0x4fd0975e10284622), W(0xdb349dd3ae2c2f5b), W(0xbe3647d8368407f9),
+     W(0x0000000002303ca5)},
+    0
+  },
+  {
+    {W(0xaf7fc11e60e9be18), W(0x8353d777f57b6f45), W(0xee72d29bf37e04aa),
+     W(0x00000000efe8ffa2)},
+    {W(0xed44b48c9798c158), W(0xd4d6d9722667d4bf), W(0xb5b79c7e3e67b246),
+     W(0x0000000078033fd4)},
+    0
+  },
+  {
+    {W(0x4aea834448c519cb), W(0x05eeeb637b5173cf), W(0xc75e3b47f6400654),
+     W(0x00000000c3672733)},
+    {W(0xf513654c75d95fa8), W(0x6799a5e3b0cacfbc), W(0x1b3755f8b49c77fd),
+     W(0x0000000078d037fe)},
+    0
+  },
+  {
+    {W(0x38994eb325bcd2a0), W(0x463f007061ba54c3), W(0x7378a0523d858b20),
+     W(0x00000000725723be)},
+    {W(0xc640b758d4c840a0), W(0xd2c5d34354ce219d), W(0x49e92ab1e4bc9be9),
+     W(0x000000003a71a539)},
+    0
+  },
+  {
+    {W(0x208c2bb4b05868e7), W(0x014e70e12f28fd20), W(0xef837318339356cf),
+     W(0x00000000be6548f5)},
+    {W(0x26530a885633e150), W(0x5428df0d93c3eeb9), W(0xc259cfb1c26ee12f),
+     W(0x00000000fefebe91)},
+    0
+  },
+  {
+    {W(0x845d659ac9374f79), W(0x8a5bb74f2027de00), W(0x9838698809831fa0),
+     W(0x000000008788af1a)},
+    {W(0x8fb4bf9f383e4964), W(0x3f57611bcead47df), W(0x8ae3bb65bfb1a4e3),
+     W(0x00000000cf810c6f)},
+    0
+  },
+  {
+    {W(0xb9387f2806ac9ea7), W(0x758f198cabd1ed84), W(0x938133fc3bf0b609),
+     W(0x000000001719ee7b)},
+    {W(0x25245c8100632d53), W(0x896b7baa82ad88e8), W(0x665add51f9161073),
+     W(0x00000000a1ff0085)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa04cb6623bc6ae19), W(0x4f889fa2f30acc6a), W(0xb8b6110cd7560ec2),
+     W(0x000000004f8fab99)},
+    {W(0x4308e6086bc71596), W(0x10d12c432c9d6af5), W(0x64c7b963ca6486c0),
+     W(0x0000000028ca7953)},
+    0
+  },
+  {
+    {W(0x4220e84788d7b871), W(0xc1fb7864a785596f), W(0xf4276ec4fa4258dc),
+     W(0x00000000fc15e9f1)},
+    {W(0xa58a670d293a6fc6), W(0xd56aed8a9382335f), W(0x311f97663477647c),
+     W(0x000000004f5dbddc)},
+    0
+  },
+  {
+    {W(0xc7b39de951929e02), W(0x2b86f57093ff36ec), W(0x802aa4a0a6f2dced),
+     W(0x00000000dbd9b943)},
+    {W(0x8c1a0edba8bbc105), W(0x54aa43d17cecf63b), W(0x78b1b38554af7ee1),
+     W(0x000000000498d501)},
+    0
+  },
+  {
+    {W(0x598815141cd0a45c), W(0xa32929ee919ddc75), W(0x3037e369f87e0bab),
+     W(0x00000000a090d36b)},
+    {W(0x579ffa96b3841cb6), W(0x904c8cca38e224e4), W(0x702d5e892cadda68),
+     W(0x0000000012eff4f2)},
+    0
+  },
+  {
+    {W(0x2e93f070c07ab316), W(0x25c23713fcee759c), W(0x6a329ada132e8c43),
+     W(0x00000000ec4a7a29)},
+    {W(0xd5e2b374e8c7f287), W(0xcf0c014936a40bf0), W(0x25e16e859da99c9f),
+     W(0x000000007730bda6)},
+    0
+  },
+  {
+    {W(0x350411ebb6cb033c), W(0x4b4e8d93c83be0ea), W(0xbb338804c7612043),
+     W(0x00000000fb1e56ce)},
+    {W(0x4b75557bef5ca7d8), W(0x5e0d7736fed92eee), W(0x61eea795c3259e9d),
+     W(0x00000000c28b498a)},
+    0
+  },
+  {
+    {W(0xd0a972a81f147d23), W(0x346ed362e471b9e4), W(0xd7accdbccfd1906e),
+     W(0x00000000293a4390)},
+    {W(0x86a243d879ac99cd), W(0xca928f1806c24954), W(0x254958103453aba8),
+     W(0x0000000036f891b2)},
+    0
+  },
+  {
+    {W(0x4b805781a01e18e0), W(0x35c19d908dd02690), W(0x832778411d04223e),
+     W(0x000000007ea96551)},
+    {W(0x4c78c04de06c5996), W(0xc34eaf3c70dde026), W(0xae645b00b58c0bf7),
+     W(0x000000003afcf537)},
+    0
+  },
+  {
+    {W(0x8de09e8688195009), W(0x70957a8576e08928), W(0x59256cc9a653c234),
+     W(0x00000000d8d51507)},
+    {W(0x473099945d7b9252), W(0x3ff7ccc10f159c21), W(0x0339c473fe9fe5bc),
+     W(0x0000000016784f00)},
+    0
+  },
+  {
+    {W(0x9c32af389dfdba3f), W(0xf93a2f1469ee0a06), W(0x38105c261fd2a13b),
+     W(0x00000000fe12d778)},
+    {W(0xd4a507743947424e), W(0x8f7c85bed5b96217), W(0x9f4dc1440f0582fb),
+     W(0x0000000087629c9c)},
+    0
+  },
+  {
+    {W(0xdd0b49af9620574e), W(0x687037027e561904), W(0xab404bf83056fb70),
+     W(0x000000004911d8a5)},
+    {W(0x918076310f24dcd1), W(0x6847c0d5606c33cb), W(0x525adb32791f57f0),
+     W(0x00000000818f0a1f)},
+    0
+  },
+  {
+    {W(0x4855546c49e538af), W(0x11f89f316d3c05ab), W(0x9e6dd61e44996dfb),
+     W(0x00000000e5054752)},
+    {W(0x4c1c7978053ae779), W(0x49d3b92ea7675178), W(0x307c1a3472b800a4),
+     W(0x00000000afc9ca2a)},
+    0
+  },
+  {
+    {W(0x586d393a1cbe9e0c), W(0x2e2acea1480cf461), W(0xe3cf0a1413a215d4),
+     W(0x0000000082460da2)},
+    {W(0x188125b738bbf760), W(0xa80c3de5cd5956cb), W(0xbfc652be9e63be59),
+     W(0x00000000275a3495)},
+    0
+  },
+  {
+    {W(0x7afa362d34fb8b2f), W(0x995871edf7c5f96b), W(0x6be4e8e8fa20c1e4),
+     W(0x0000000002b63df7)},
+    {W(0x3453fb74f9949e2f), W(0x376ae7a8f6fdf958), W(0xadf32795502b7475),
+     W(0x0000000020557243)},
+    0
+  },
+  {
+    {W(0x3d0c5313937b1868), W(0xb2ed18b4aa1e00ca), W(0x18e7fcd5e23097a6),
+     W(0x00000000790fdadc)},
+    {W(0x00c47190f18eb299), W(0x1797157ef4068839), W(0x257f4df15b080743),
+     W(0x00000000d4b97dd1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x156bffa3c043c4d3), W(0xc568dd1aef4fdf72), W(0x373456aa0fb07e25),
+     W(0x000000000c136024)},
+    {W(0x750634859c743fd6), W(0x512889e409872cea), W(0x2982d6761f75eff7),
+     W(0x0000000046918abe)},
+    0
+  },
+  {
+    {W(0x9c68e7cc52954a16), W(0xac850b4422874bf5), W(0x3b1f707164db3074),
+     W(0x00000000a14665fa)},
+    {W(0x78fc6e6887ef6099), W(0x1edffe7677eb0618), W(0xf5f0fda16d531161),
+     W(0x00000000429c094e)},
+    0
+  },
+  {
+    {W(0x8d50697c1fc8bbf5), W(0x635b9ddb18d3d9b3), W(0x8fec6d12ca8ada69),
+     W(0x00000000fb16f80b)},
+    {W(0x4f64e839c661436b), W(0xe91257b77370cc81), W(0x61ea283e9be9bd04),
+     W(0x00000000f385b27a)},
+    0
+  },
+  {
+    {W(0x570bd76b0a953500), W(0x493624f942617e4e), W(0xbd807766ec1fce2d),
+     W(0x000000005098d9d8)},
+    {W(0x468a4f16cbc6ada2), W(0xb78fc3acada13650), W(0x1dce66deb5aa694d),
+     W(0x000000005318219a)},
+    0
+  },
+  {
+    {W(0xee34d0b37f1ad442), W(0xd3c81dc7e5d2987f), W(0x4f2b27ad725a1a94),
+     W(0x000000005fa7a38c)},
+    {W(0xc4db364ec7e5f9d7), W(0x5982c0ece4da629d), W(0x282fc5cdeb59aa65),
+     W(0x00000000559ab9ab)},
+    0
+  },
+  {
+    {W(0x59b256e227e1052e), W(0x0240588a9a36ca70), W(0x5f33fcbe104c6677),
+     W(0x00000000d5f7483d)},
+    {W(0x48477e0197ea744b), W(0x2af1ec011d7d7950), W(0x7d346e160076d54b),
+     W(0x000000008ff9a5f0)},
+    0
+  },
+  {
+    {W(0x5e1bbb3e7f9fd46d), W(0x03d4c62f9bf65ad9), W(0xd8bb69e32f3af06d),
+     W(0x000000005d4ab923)},
+    {W(0x2bec67a0da9f6aef), W(0x32a587a489a6b19d), W(0x704e0a1a69b7f449),
+     W(0x000000006841c77b)},
+    0
+  },
+  {
+    {W(0xd30a5800fedbc51c), W(0x2745e2b897115f9f), W(0xeff5c174bb10a57f),
+     W(0x00000000adf87884)},
+    {W(0x162e3c5b589f5f94), W(0x16aad5e5a2bc843d), W(0xd6f94dfb25478287),
+     W(0x0000000031bb4258)},
+    0
+  },
+  {
+    {W(0x045bb2118f8fc5e5), W(0x67ea8d44a873c0b3), W(0x19309752cdfaf481),
+     W(0x000000003bd89386)},
+    {W(0xc111823ed6db09e5), W(0x1bf4c3815b1f8407), W(0x05201923bd1701a4),
+     W(0x00000000a55cad5a)},
+    0
+  },
+  {
+    {W(0x5e6927a2a9c05d75), W(0x7ec93d18edf719a8), W(0xb88d277847a2091a),
+     W(0x0000000014f43de9)},
+    {W(0x481d7be12857147d), W(0xf314ccf362960f69), W(0xf1dcc06ebc81b4cc),
+     W(0x000000000ff90f0a)},
+    0
+  },
+  {
+    {W(0x17091aeec3f569dd), W(0x06a662b40d286172), W(0x072d8850832dfb91),
+     W(0x00000000d6bfc7c2)},
+    {W(0x5ac22ab291d833ef), W(0xdbe89cc70c45e622), W(0x0b305175e12dd0fc),
+     W(0x00000000b021b3d5)},
+    0
+  },
+  {
+    {W(0x6c5c8427c180bac0), W(0xdf01fd2146351cc8), W(0xdd1d4004b964daab),
+     W(0x00000000c4d0e945)},
+    {W(0xb82dabad72fb966c), W(0x2268903b7d7ac429), W(0x7dafa986eed99c4c),
+     W(0x00000000cbdad15b)},
+    0
+  },
+  {
+    {W(0x234898e10216e1a9), W(0x721752c4badfa891), W(0xf9dab8140f4b7e51),
+     W(0x000000006cdc2998)},
+    {W(0x9a8756a5100790cd), W(0x068b4972cd50030f), W(0xd53b9f6c471c5cd6),
+     W(0x000000002b93ff7b)},
+    0
+  },
+  {
+    {W(0xa3bee6f27ddb0e80), W(0x230d780492e34a2b), W(0xfd84ff2068d595a5),
+     W(0x00000000dbc74bba)},
+    {W(0x8f4ec18865ac26ab), W(0xd812eab778699d20), W(0xce3532f526f14088),
+     W(0x000000006a45d721)},
+    0
+  },
+  {
+    {W(0xa3e1c67686f1d3ad), W(0xe4fa575c71fd82be), W(0x343c5ecdfc483f75),
+     W(0x00000000c26c05e6)},
+    {W(0x77955887bda7aaf4), W(0x39f370a2727240ee), W(0x0ba501f9370fc477),
+     W(0x00000000c59d7e97)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe5e0aad860c5d65f), W(0xc4b812b6c7b54b13), W(0x008e0bc3e9d8af38),
+     W(0x0000000071a411c5)},
+    {W(0xc482b23227cb0dc7), W(0x5042230e07289ac0), W(0xa128b56668d763c4),
+     W(0x00000000c589940b)},
+    0
+  },
+  {
+    {W(0x9f724691391a31fe), W(0x79581fa00ca4bf22), W(0x4bbc9bf5730e0882),
+     W(0x0000000091d1e24a)},
+    {W(0x26de9371d756f110), W(0xf050810bd72ae23c), W(0x75b289b36ca80e46),
+     W(0x00000000777ca3a2)},
+    0
+  },
+  {
+    {W(0xaf9c00ebc1d3ad41), W(0x6b575b77b90b0248), W(0x2e1dac5f45a5507d),
+     W(0x000000008db688a8)},
+    {W(0xa655bbf0ab53ef89), W(0xea6e67540fdb8f93), W(0x9751d174fdb2b439),
+     W(0x00000000aef8bdee)},
+    0
+  },
+  {
+    {W(0x2c67eef0f7481883), W(0x49af94141a833a88), W(0x5fc1c69f8aa0f2d7),
+     W(0x000000009f06aae9)},
+    {W(0x4ecfeaa52b6f561b), W(0xbf5973f717fda35e), W(0x0013029b338ff3e0),
+     W(0x00000000e6215b79)},
+    0
+  },
+  {
+    {W(0xcb23a5416f8d4351), W(0x3cb31aea51dd59db), W(0x7d0b3dda24f458a5),
+     W(0x0000000026b341e1)},
+    {W(0x80d2e582b5440aa5), W(0x1b5ad25e9e2fd334), W(0x794f6e44114215cd),
+     W(0x00000000e3bb54b5)},
+    0
+  },
+  {
+    {W(0x3828dbf72c4c3668), W(0x17810cb9b8a0c6af), W(0xdd7d6cea9f12e96e),
+     W(0x00000000e595dcab)},
+    {W(0xad54b44b5b28c732), W(0xb904d92fe8aa36bb), W(0xcbe6341511dcc1c4),
+     W(0x00000000eff9d401)},
+    0
+  },
+  {
+    {W(0x4432f2cf08bd06c5), W(0xec0de874a3a488e9), W(0xd17c48299efd00d7),
+     W(0x00000000f5128936)},
+    {W(0x35e93b4883542187), W(0x22977d11ae41e05a), W(0x41a1010ae030a465),
+     W(0x000000001db1bce3)},
+    0
+  },
+  {
+    {W(0x95692ad22e68e2c2), W(0x72e6eaf50b27bb26), W(0x8b45b55f090be6f6),
+     W(0x00000000ea84dd7c)},
+    {W(0x928497fa8e110b28), W(0x100a822e971d5f28), W(0x9ddbd5c46339a104),
+     W(0x000000003fe08c7f)},
+    0
+  },
+  {
+    {W(0x6112f38ee27abdf0), W(0x12fd1d52f5ab47b4), W(0x4fccb7e85984ae07),
+     W(0x0000000081972b3a)},
+    {W(0x5d4f964b95532439), W(0x60b2cf53905ded37), W(0xfb6ad50f6a31fa69),
+     W(0x00000000d83dca88)},
+    0
+  },
+  {
+    {W(0xff252d357540a87d), W(0xaffcab72a1530a6c), W(0x9793a371c8e9b570),
+     W(0x000000003489107c)},
+    {W(0xf0b49c6cdcf94c42), W(0x35c46e5c879022b6), W(0x2c618b82069dd468),
+     W(0x0000000064bde16d)},
+    0
+  },
+  {
+    {W(0x5423908eded9227f), W(0xa6f72d9e43d7285e), W(0x6a49fc8249363917),
+     W(0x00000000f5d8d60b)},
+    {W(0xa0f34345067bfaaf), W(0x19294466665a2267), W(0xffa2e5fc1ac20d98),
+     W(0x000000004e6d33c1)},
+    0
+  },
+  {
+    {W(0xc1916a893bf9b78d), W(0xad0d163d62555b0b), W(0x82d7d36f00203bb0),
+     W(0x00000000d8764be5)},
+    {W(0xf446925f91a430b0), W(0xedc1e316a23e8076), W(0x11610026b903dea6),
+     W(0x00000000d83fceb2)},
+    0
+  },
+  {
+    {W(0xc4969a0d978295dd), W(0xabbb112cdf19cc2f), W(0x554a3a068bd7557f),
+     W(0x000000008fe8b8dc)},
+    {W(0xf261d772516a1ab6), W(0x4d16bca082e07bc5), W(0x45447ad3d1d7da5e),
+     W(0x0000000019044418)},
+    0
+  },
+  {
+    {W(0xf5f78e41a86b0be3), W(0x135a0c713455a3e9), W(0xddf065a730c1c2c7),
+     W(0x000000003692f51b)},
+    {W(0x0f5906c0ebc66e40), W(0x5229db63bfc2af37), W(0xd9f883275fa05ed1),
+     W(0x00000000fad22122)},
+    0
+  },
+  {
+    {W(0x889c6c442b9cf3d8), W(0xc8a3770312d9fd78), W(0x46f4af45a6aed948),
+     W(0x000000004de1be3f)},
+    {W(0x932b6857229dbecf), W(0xa90d9c3e4b284bc1), W(0x9200852fe27e82bc),
+     W(0x00000000e41775aa)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9c7f7bc2b83e5822), W(0xec2c9c4885016181), W(0x1d49bd53ae2e08c9),
+     W(0x00000000d51d0f76)},
+    {W(0x574b1fa2e02702a5), W(0x4b568161275045e3), W(0xb270bab6e63f9064),
+     W(0x00000000cbacaf10)},
+    0
+  },
+  {
+    {W(0x55cc3b9328c9f54b), W(0x9f91db2081366649), W(0x66b83a450bb5529e),
+     W(0x00000000020a3d7b)},
+    {W(0x6d9c718d84c6fb9a), W(0x6e5e8c084c39583c), W(0x8cb7eb45063ccb67),
+     W(0x0000000001328b11)},
+    0
+  },
+  {
+    {W(0xabf966096a5f7b17), W(0x47b13fc6aba9ecab), W(0xfaf06b0a2e98ce8a),
+     W(0x00000000491b3cf9)},
+    {W(0x7a80b8eb582c7225), W(0x47c9bcb5e8f1bd8a), W(0x1729e6de54c8f5e8),
+     W(0x00000000ef977130)},
+    0
+  },
+  {
+    {W(0x7e06eec9c3d2cc22), W(0x5a9598092a100811), W(0xf5c07857f4997f3a),
+     W(0x00000000ad98c158)},
+    {W(0xf408207d5ae7c1cf), W(0x8cd5c2c0db7d94f4), W(0xf3bfa4da6379ef0a),
+     W(0x00000000de775bfd)},
+    0
+  },
+  {
+    {W(0x612e4dc5ec46a462), W(0x432cc03f1216665f), W(0x7de2ad41f213be85),
+     W(0x000000009e8027c9)},
+    {W(0xcd378b6f267d299d), W(0x5832cc42d355062b), W(0x5c06677af6d34a0b),
+     W(0x000000001772bb1a)},
+    0
+  },
+  {
+    {W(0xd08dfe44d39752a4), W(0x208bc4369b19df92), W(0xcc3f5acefd14af8d),
+     W(0x000000009cb59da4)},
+    {W(0x880b584a97f49ac2), W(0x72d9f8ffe1fa2671), W(0x0c870e3e76bf0449),
+     W(0x000000006fb6d427)},
+    0
+  },
+  {
+    {W(0xa4893bcaf673c08d), W(0xcd42ea447fe57da6), W(0x59ffa005515d20b0),
+     W(0x00000000851842aa)},
+    {W(0x58a71577cbdd37bd), W(0x0ecfaa0d07a078bf), W(0x2da883ab15026280),
+     W(0x0000000040a1793b)},
+    0
+  },
+  {
+    {W(0x70db0532bad01fec), W(0xf82bbcfa12b3f8dd), W(0x92abaaa2167ab18c),
+     W(0x000000005e4d357c)},
+    {W(0x1fb69d3d4304ac9f), W(0x15e5d0107bd8f0e1), W(0x84b3151047351320),
+     W(0x000000006a03c6b3)},
+    0
+  },
+  {
+    {W(0x9565acc2c770ffa2), W(0x1ea45a2a6f30151f), W(0xbb72db289b6f76c0),
+     W(0x00000000e5778000)},
+    {W(0xe16af032f73679e5), W(0xaa43aee57949ff82), W(0x536b70ced89ee854),
+     W(0x000000009fef4e10)},
+    0
+  },
+  {
+    {W(0x5a2c8035739b3599), W(0xdac9ebee91588e92), W(0x451b95e71b69af1a),
+     W(0x000000003517cee5)},
+    {W(0x1e09f842b64f8f05), W(0x099f255090930327), W(0x9e48451eefa175e0),
+     W(0x00000000edef520b)},
+    0
+  },
+  {
+    {W(0x6df4e3287cedecd0), W(0xa6f07efa771e8be5), W(0xbb56ac3040afa525),
+     W(0x000000007e6ed9db)},
+    {W(0x23e8424c46a2e362), W(0xe07aba3e43643cba), W(0xcc45bf433c4548b6),
+     W(0x00000000dcd29889)},
+    0
+  },
+  {
+    {W(0xa249206443b4b068), W(0xeddb27dd1e8946dc), W(0x821353119916090e),
+     W(0x0000000098fdccc1)},
+    {W(0x31f673e34585ddd8), W(0xac4307eed529f3ea), W(0x428145ceb119ca51),
+     W(0x00000000cf53a57b)},
+    0
+  },
+  {
+    {W(0x2f95739f57fadb27), W(0x47890f4eed96d74b), W(0x98699286bdca0ae0),
+     W(0x00000000693415d3)},
+    {W(0x8251a9089f59fab6), W(0x83ff5cd4b12f2a4c), W(0x768ec018dfa0477d),
+     W(0x00000000feeefaab)},
+    0
+  },
+  {
+    {W(0x38640e713728e89e), W(0x745bd8a2a872dbd5), W(0xffeb6e878f90052e),
+     W(0x000000009a484b77)},
+    {W(0xe045b6ceb85a7c0b), W(0xafd92044b3a39b3e), W(0x462a1b9bdbc53298),
+     W(0x0000000060a23eea)},
+    0
+  },
+  {
+    {W(0xc215dc566aa52462), W(0x966ee9416d03d1d4), W(0xb8a052244b805a7a),
+     W(0x00000000be405ee3)},
+    {W(0xc0f552b02b63ea57), W(0x744c576f68f5d07c), W(0x2d88fa11d56e5b82),
+     W(0x000000006e681075)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8a1c84ea050b6e45), W(0xc2315710c38a15ff), W(0x67d1f3e45b502e99),
+     W(0x00000000f85c7d6e)},
+    {W(0x7c34a744d3018572), W(0x8b89ec4794062e0f), W(0x35f7a2669579c983),
+     W(0x0000000063ed902e)},
+    0
+  },
+  {
+    {W(0x51eea6cada9ad1f1), W(0x3afc7be469de6020), W(0xa7aeef7af383a0c6),
+     W(0x00000000ec5ab9f7)},
+    {W(0xb56f14b0e3d53f58), W(0xda9d33727b78f2d9), W(0x0886a015b4e91769),
+     W(0x00000000b8c7fe1f)},
+    0
+  },
+  {
+    {W(0x48a0860fc6a270c7), W(0xe8f8a0bee3c9d6e7), W(0x37a0510c1c9dda6d),
+     W(0x0000000087290f47)},
+    {W(0xe0b9b992b746897c), W(0x691f74eb04968462), W(0xba7c23dd79bcdef3),
+     W(0x000000003c9dfbbc)},
+    0
+  },
+  {
+    {W(0x0745f5173d08ef7e), W(0x732c8246c7781923), W(0xe11121586cd5a87c),
+     W(0x00000000734d96e5)},
+    {W(0xfbc17aeb0ea91035), W(0x9fdb58147d6ae9b9), W(0x7a81eba86b340fbc),
+     W(0x00000000a462be47)},
+    0
+  },
+  {
+    {W(0x88241ba44fcaf8f6), W(0x25f7328a6839ac95), W(0x4e73d41bb01a4c73),
+     W(0x00000000dbce70d9)},
+    {W(0x25457ffa470b6777), W(0x2545dcdb4155bcf6), W(0x3c25b38e79b75849),
+     W(0x000000008c33a19b)},
+    0
+  },
+  {
+    {W(0x36d03f9a612a3e39), W(0xf3a566277049620b), W(0x50448eab29c0b51d),
+     W(0x000000003f0b2dd9)},
+    {W(0x217c3b7c673df2ce), W(0x17355feb8eca2e20), W(0x3afc231520883efb),
+     W(0x00000000c23211b5)},
+    0
+  },
+  {
+    {W(0x32172eb5334d8d79), W(0x1ed58d887d243c47), W(0xed3510a84a4714a6),
+     W(0x00000000fde7f4a6)},
+    {W(0x1ed13734b3d82e22), W(0xa661cacd4721f266), W(0x99b1258ff2889694),
+     W(0x0000000045218687)},
+    0
+  },
+  {
+    {W(0x1f6e5aaba4179427), W(0x64717e7d4d58f138), W(0x389e7a2b72e75855),
+     W(0x000000004b5aa1e6)},
+    {W(0x29d90bc212a92070), W(0x553f857ab35b2d2a), W(0x832c687aaca3b9cc),
+     W(0x00000000e2911a57)},
+    0
+  },
+  {
+    {W(0xba68ec894edbba95), W(0x09789c175aa810ec), W(0xa14202fe3b13484a),
+     W(0x00000000f43a5a8e)},
+    {W(0x2eebd70c5692f85e), W(0xaee6fc8f91687ea9), W(0x308af3f20097459b),
+     W(0x00000000bcd33020)},
+    0
+  },
+  {
+    {W(0x4e8e9afe75d11505), W(0x5b7b646419587930), W(0xdb38100406303665),
+     W(0x000000002dcfdbbf)},
+    {W(0xd2f2331e697fde9a), W(0xaee153c0a05f2e5f), W(0x585829659bc50e15),
+     W(0x000000003c8f91e7)},
+    0
+  },
+  {
+    {W(0xa446bbd2ea244735), W(0x148c9c3c33bce904), W(0x866efe12da589e74),
+     W(0x0000000026c526ea)},
+    {W(0x54dba832cd57d025), W(0xf6307663125fc5e1), W(0xde03f31343434829),
+     W(0x000000002cca0530)},
+    0
+  },
+  {
+    {W(0xd4b9ecd80dd72354), W(0x1bedce09e27c0fb3), W(0x99bda5fbe75a97d2),
+     W(0x000000000ec3ba1e)},
+    {W(0xa8ccf9fd4ecb59ef), W(0xed6b09ee66e1b5e1), W(0xeb448ac3f7bde91d),
+     W(0x0000000024a3881f)},
+    0
+  },
+  {
+    {W(0xe35ffad5ab97b22a), W(0x48be7d616ea1516f), W(0xa12004cf19e369c4),
+     W(0x00000000ac2f0abe)},
+    {W(0xc7445b78667e0fcf), W(0x09ed2bba00353489), W(0xcab83b6f488a7a67),
+     W(0x000000000d0c2a8d)},
+    0
+  },
+  {
+    {W(0x2dcf10a61786b7a4), W(0x6ac4c378e8ebb660), W(0xaae062692bb2337c),
+     W(0x00000000d3184588)},
+    {W(0x605c35c8dc87cc7f), W(0x1ada5241dd069d2d), W(0x7f39647efbc53300),
+     W(0x00000000b85fe4b5)},
+    0
+  },
+  {
+    {W(0x963cc460bc8a447d), W(0x842af3b64fc24319), W(0x184327bf0b3e6529),
+     W(0x00000000d587cc57)},
+    {W(0x330d84ad66f0651b), W(0x1f2b68344ffdd6a8), W(0x66b606b6a956da39),
+     W(0x000000009a8bca0c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x56b1b68cf505ff0a), W(0x85630476a766a468), W(0x15b9ce0d7f0a8ccb),
+     W(0x000000008bfb375d)},
+    {W(0xe7944b6a8741f066), W(0x8026fb64e502fd6a), W(0x956dea42079ac7ac),
+     W(0x000000003fc3f258)},
+    0
+  },
+  {
+    {W(0x7157aab7bd407e63), W(0x62a53378de649372), W(0xdc9ac491ec032ca1),
+     W(0x00000000af00af85)},
+    {W(0x3d3a586c5a1b0fb3), W(0x6cce27cab1b4ed91), W(0x2fb5dda70da4ec47),
+     W(0x00000000e69eb235)},
+    0
+  },
+  {
+    {W(0x4a718a90a2c9ee34), W(0xaf44fcce6813c47e), W(0xbae4540ecc1aaacb),
+     W(0x00000000fd6dde20)},
+    {W(0xa1399699f4786198), W(0xabb23a8547c1ef53), W(0xa1779b32ff24f01d),
+     W(0x00000000afe60f72)},
+    0
+  },
+  {
+    {W(0x6e7fd2aba9ef8159), W(0x802458a0206a6f14), W(0xf31bbf6c43a11c7f),
+     W(0x00000000e2ff97fb)},
+    {W(0xb83101a9893d191b), W(0x52ca6e060b2c24c6), W(0xc5ea4420d00a24aa),
+     W(0x0000000080054822)},
+    0
+  },
+  {
+    {W(0x5d302b853173ee97), W(0x275a0fe0a3ec0bc2), W(0xde0332207469b929),
+     W(0x000000009823907b)},
+    {W(0x8d35908d06ebb14d), W(0x8a0b74c2668b8357), W(0x388da84dcd96886f),
+     W(0x000000008e759b7d)},
+    0
+  },
+  {
+    {W(0xb006863182c45d8b), W(0x51283056b87f256b), W(0x554d7fadb7562059),
+     W(0x0000000068b8bed1)},
+    {W(0x5349ed31e9ccc163), W(0x0ef896e4aa23f48d), W(0x125ee820ac744603),
+     W(0x00000000150da1ca)},
+    0
+  },
+  {
+    {W(0x16a4c78d546f326b), W(0x42a579ae26b49a2d), W(0x5044959669e5dc3a),
+     W(0x000000002af6b2c1)},
+    {W(0x07439dc4de7ccc7f), W(0xacbc3d69f5736c67), W(0x0cc523ddeeb790dd),
+     W(0x00000000ae2f8bbf)},
+    0
+  },
+  {
+    {W(0x1c12b2d5f1c49667), W(0x7bc41dbb7628ecee), W(0x653988080692cc8d),
+     W(0x000000005048f64f)},
+    {W(0xd880351d2cde35bc), W(0x131f80e2ae75c4fc), W(0x5f9ca8603e2ff89e),
+     W(0x00000000435a454d)},
+    0
+  },
+  {
+    {W(0x1dbe11f0fc6b3603), W(0x0ed82341805cdd89), W(0x5d6a45d50562fe66),
+     W(0x00000000c9eb9f56)},
+    {W(0x1fbcb27202dcc377), W(0x873a72d54b25d574), W(0x1466b27fb78a31c0),
+     W(0x00000000468c47f5)},
+    0
+  },
+  {
+    {W(0xb836e3e5ba96c374), W(0x2c1ed972f6743281), W(0xd77d434013f41d4f),
+     W(0x00000000397a6846)},
+    {W(0xbd735496748b4159), W(0xeadd97bc6560f3f3), W(0x119c162c61405ead),
+     W(0x000000009870a7f1)},
+    0
+  },
+  {
+    {W(0x4f81eb057c46ea86), W(0xaad784b0dd4548bd), W(0xff17a13f49ea4452),
+     W(0x0000000054ebcb9f)},
+    {W(0x3e7236a8810464d0), W(0xfe62fc5f4d44b2ce), W(0x0d85cf3ffeac4aaf),
+     W(0x000000007d7cb315)},
+    0
+  },
+  {
+    {W(0xb0f78fa94ea682b5), W(0xa319bd5282bbcdcf), W(0x7cdb7afd01559ec4),
+     W(0x0000000086ff3957)},
+    {W(0x6c320e71c4e5e26b), W(0x8d455eef45b1afec), W(0x6b93f2de9d12c298),
+     W(0x000000003e21f849)},
+    0
+  },
+  {
+    {W(0xc12b655dbb797884), W(0xa6ec705d219c2865), W(0xf3ec2977c6daf8cf),
+     W(0x0000000010269fa7)},
+    {W(0x8de615f1f0951e7f), W(0x0e454e35b448dafb), W(0x0fd25b12ac03ce6a),
+     W(0x00000000b96afd44)},
+    0
+  },
+  {
+    {W(0x069f14f0c1091d62), W(0xa04696efc970df0c), W(0x0475ddb98cddee54),
+     W(0x00000000ac228ae6)},
+    {W(0xc73f5026da3d6fc8), W(0x475ad247bdeb5cb1), W(0x8694111c82098200),
+     W(0x00000000c11479ab)},
+    0
+  },
+  {
+    {W(0x0c73fe98f181f7b2), W(0xe9de471e4aa502d3), W(0x4f6200506c27909f),
+     W(0x00000000f76957c1)},
+    {W(0x1565b30ae0c4eaa1), W(0xb518ef0efba38431), W(0x82a6a12465c7038d),
+     W(0x00000000e7db47e4)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfdab8dbd56f2fd55), W(0x198d2eb9773fef23), W(0x8698e8b3011efbb9),
+     W(0x00000000a4f63ad2)},
+    {W(0x60003ff68629eaf2), W(0xd24558865aebc019), W(0x859f79cb00bcb9de),
+     W(0x000000006a9d21d2)},
+    0
+  },
+  {
+    {W(0xd064269b8e21820b), W(0x7020a8a81ccbf4e2), W(0x5cee0a5ce21fbca7),
+     W(0x00000000263913a5)},
+    {W(0xa3fc8bad8a6b9ebd), W(0x838a0019047f1949), W(0x35a0d475d1a5d116),
+     W(0x000000009e3419f5)},
+    0
+  },
+  {
+    {W(0x0ca1adfdcffa9aa8), W(0xed4f750db13f2859), W(0x277e9cd1d393e869),
+     W(0x0000000090b15b52)},
+    {W(0xf705f5049386d23f), W(0x98b6973f2c2d2fb1), W(0xcb991398f49260e8),
+     W(0x00000000fed48a8d)},
+    0
+  },
+  {
+    {W(0xd95b8ba8ce14b1f7), W(0x20d433991d6eb61c), W(0x47b3133dc7ef0d06),
+     W(0x00000000f255931e)},
+    {W(0x60b980745d5a0b15), W(0x8b1f2bd22344f6b6), W(0x00302e85789f9baa),
+     W(0x00000000ccdbabda)},
+    0
+  },
+  {
+    {W(0x7d7a4275907aee06), W(0x04664bf0734f5375), W(0x1b39f12e509e1f0b),
+     W(0x00000000317a399d)},
+    {W(0xf2cd51b3657df2f0), W(0xcabaa31e3332625f), W(0xa1f9af72cbcc7e65),
+     W(0x00000000faeecb6d)},
+    0
+  },
+  {
+    {W(0xccdf2aea60db2622), W(0x079a560f3aaf1827), W(0x145f7fdb6db316a6),
+     W(0x0000000091522593)},
+    {W(0x59515564c3c41ab6), W(0x932695d6ff19bbaf), W(0x59f3042e1ad4c34b),
+     W(0x0000000006b5a6cb)},
+    0
+  },
+  {
+    {W(0x4393bd730c82f46a), W(0xa6f501afdb6b3641), W(0x30dfb642ec536787),
+     W(0x000000007d2ad624)},
+    {W(0x720b21202e67336b), W(0x2e14ded2f05711cd), W(0x0ab71deced1657f9),
+     W(0x00000000e38569e7)},
+    0
+  },
+  {
+    {W(0x228b3a54fb42e9d6), W(0x3efd699dd1e183b4), W(0x18288fb94948ad88),
+     W(0x00000000f45f24f0)},
+    {W(0x37574acd23d7207d), W(0x57c32be7e86d0db8), W(0x451b09b71ccef3f9),
+     W(0x00000000ee7d7495)},
+    0
+  },
+  {
+    {W(0x585d64c5c423d52d), W(0xa4773dd7a6c9dcfa), W(0x04835fd556fee6b1),
+     W(0x000000005a5789d8)},
+    {W(0xd340231be4d91c9e), W(0x485a82808d4d1842), W(0x04c0f507feddb999),
+     W(0x00000000f1275343)},
+    0
+  },
+  {
+    {W(0xa398655bc983f11f), W(0x86d8fa1c73bda9db), W(0xb86b74280c2ccd77),
+     W(0x000000009f322e25)},
+    {W(0x00ec975db6cb6427), W(0x8e0b84f779a94d02), W(0x057521cd8a00e16e),
+     W(0x0000000087179a09)},
+    0
+  },
+  {
+    {W(0x10c07d3f68541521), W(0xc7ccd85e50bd807d), W(0x775987f7ffd1fa5f),
+     W(0x00000000641ac62e)},
+    {W(0xc4bf07415dc9d06e), W(0xe4307e2bee9a002d), W(0x40fcb06788bc226a),
+     W(0x0000000037a2c0d6)},
+    0
+  },
+  {
+    {W(0x9cc6a2e8766e0176), W(0xb8d340d8af56fb2a), W(0xa948bb93a879797d),
+     W(0x000000009850419e)},
+    {W(0x4accaef91e3e97dc), W(0x5d9c76986f4ebd58), W(0xf5cf38f4154cb0e0),
+     W(0x00000000f108a1ae)},
+    0
+  },
+  {
+    {W(0xd9a6d81c900918b1), W(0x826f135064da4413), W(0xc6108c7de453c2dd),
+     W(0x0000000027f8d197)},
+    {W(0xb6482c2f13834ab9), W(0xd044065420e74cc6), W(0x4fdccb9ecbae6c0e),
+     W(0x000000002f4b5750)},
+    0
+  },
+  {
+    {W(0x1714091911b4357b), W(0x625c9b943b2b7682), W(0x76910fc61cc54f84),
+     W(0x00000000e994443f)},
+    {W(0xd0f8e5992fc4483a), W(0x02e4b179989ac103), W(0xb0acd761ad7bb760),
+     W(0x0000000054f9aba6)},
+    0
+  },
+  {
+    {W(0xce6a5da10a065ccb), W(0xae488e8c3323b56e), W(0x7217ee1e74ef7eee),
+     W(0x0000000015262a56)},
+    {W(0xe4a3c825886e8212), W(0xe3dd29762f361b1c), W(0xe81fa8fd219c34b6),
+     W(0x000000001995ee9c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd52a1c1ea61d5325), W(0xcb34540ad08a8ae3), W(0x03e86cff750d587a),
+     W(0x0000000027e73149)},
+    {W(0x527a9877156ef6cf), W(0x6ee444f196f4a96b), W(0x038153e5e4a1f249),
+     W(0x00000000d9998bb3)},
+    0
+  },
+  {
+    {W(0x3c280032e1ee20f3), W(0xc6f2aff8a9734b49), W(0x3686d2f0b12f26d4),
+     W(0x00000000e0111b72)},
+    {W(0x7a48daba8bf62e5c), W(0x63c661a3069099d5), W(0x6cdc05f3aba55aed),
+     W(0x000000004ea7440f)},
+    0
+  },
+  {
+    {W(0xb4a0a7e34edd01ad), W(0xb472df44d28d49c3), W(0x4cb47055ab2cbbd4),
+     W(0x00000000cd15bd1f)},
+    {W(0x16ef99e331800301), W(0x78a8538eb349d462), W(0x4dce044a746c4b41),
+     W(0x0000000056cf52da)},
+    0
+  },
+  {
+    {W(0xd727b45833ad9d0f), W(0x340cf8e06aab9dfc), W(0x078f906d695de110),
+     W(0x00000000a987a86e)},
+    {W(0xd50493d465ed9ae8), W(0xb26733043eb5588c), W(0x101a021ece9abc84),
+     W(0x000000002ec773ad)},
+    0
+  },
+  {
+    {W(0xcbfe120b3e7baca8), W(0x56a88710e69958d1), W(0x9586b08ea2e1385c),
+     W(0x000000008d8876e4)},
+    {W(0xe749a357a05f5596), W(0x62d3a28585028619), W(0x8430e884f41d9b86),
+     W(0x00000000e0fe7436)},
+    0
+  },
+  {
+    {W(0xa50c7d9fe7457d94), W(0x5bd93ac0aaf263e7), W(0x28bc6b5827bdb99e),
+     W(0x00000000a291a83e)},
+    {W(0xe155fe7afed995c1), W(0x441255d1a92f7c72), W(0x54ea2480fdebd3d9),
+     W(0x000000001d9b3247)},
+    0
+  },
+  {
+    {W(0x1fe90870a2b679a7), W(0x841d50a460faf2a7), W(0x9776155274445704),
+     W(0x00000000c6294a8b)},
+    {W(0x8306971e88aef1a6), W(0x8a08da7479313f41), W(0x5ff5c231459c33b3),
+     W(0x00000000a47413df)},
+    0
+  },
+  {
+    {W(0xa5a5886a67588c0e), W(0xf569db1fd9832e54), W(0x38ed1085c764b06f),
+     W(0x000000007eb63b3e)},
+    {W(0x585bdb2011a2a8db), W(0x3d5436af8a62c89d), W(0x35b915875e301e9d),
+     W(0x000000004e488867)},
+    0
+  },
+  {
+    {W(0x02596d630ad7acbd), W(0xf395797781ed48b5), W(0xfd23aeec8ec54e25),
+     W(0x00000000a7513cf4)},
+    {W(0x8f6097ddfa5cf86c), W(0xea60f2b62a1c180b), W(0x253dbb93acdc4130),
+     W(0x000000009daa0c3e)},
+    0
+  },
+  {
+    {W(0x6e92d485701d31e8), W(0x53a09da08a6e2064), W(0x4ee89ae2c92637e7),
+     W(0x00000000a8cbe2a0)},
+    {W(0x688111d2c8b9f5ad), W(0x75a9c0581fafd02e), W(0x0cd0654b315d9dc5),
+     W(0x0000000002890b79)},
+    0
+  },
+  {
+    {W(0x2f0f74a024fed0d9), W(0x28c66344f3ddaad3), W(0x55736fdea0f85074),
+     W(0x000000009f28ac0a)},
+    {W(0x5b08d2ff0c8f2cd4), W(0x96848bd3aaec443d), W(0xb42131349fd17e0f),
+     W(0x00000000f10e3114)},
+    0
+  },
+  {
+    {W(0x817dc7693878d553), W(0x60a4d34cfd0338c3), W(0x36e30856b99ba802),
+     W(0x000000001dcffb49)},
+    {W(0x665a28b48ba72940), W(0x9d6822eaf1016ea1), W(0xc3331f1b86a30740),
+     W(0x000000000205d1d8)},
+    0
+  },
+  {
+    {W(0xf2335efb5adf052d), W(0x9cde465e398d73b0), W(0x212ffe0a00bb4ee5),
+     W(0x000000007ab2ea4d)},
+    {W(0xe2f332a29a9ad333), W(0xbb4703c4eeeaddc8), W(0x143e5fcc2962d309),
+     W(0x0000000049553c63)},
+    0
+  },
+  {
+    {W(0x96506aa353d9c3c5), W(0x4d8a07413f484d6d), W(0xbd490fb210e92da9),
+     W(0x00000000ffd03214)},
+    {W(0x957922575fa8cebc), W(0xe4e706c87dfe3775), W(0xe2412ec19120d23f),
+     W(0x000000001de70984)},
+    0
+  },
+  {
+    {W(0xbb9273c928113fdf), W(0x6ab4dc1c4c568852), W(0xb258fcfff3f274f5),
+     W(0x00000000dee7fe95)},
+    {W(0xea16df71f7dd8fb6), W(0xf774dfb93f7227a1), W(0xc554b4918865b774),
+     W(0x0000000010280ec0)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xaedb7e510d9efc66), W(0x3d4cd6e32d780714), W(0x95533ca376c48d11),
+     W(0x00000000ef834a13)},
+    {W(0xbb0ea84cfcf0269c), W(0x2e9952888bf5f008), W(0x5462d73b0c5e907a),
+     W(0x000000001d6aecec)},
+    0
+  },
+  {
+    {W(0x8806d22d3ff1fac3), W(0xe5b92d9d827b3141), W(0x45f1bee6c0bcac45),
+     W(0x00000000e2c1046e)},
+    {W(0x0b973abe368d7809), W(0x6f45c847c60d4681), W(0x1ae3e5bf05dd04f4),
+     W(0x0000000064bbe857)},
+    0
+  },
+  {
+    {W(0x7410e34023b4ace4), W(0x55122cfbac74f592), W(0xc3f81e6025e61e10),
+     W(0x00000000aea3e348)},
+    {W(0x7447f1b7c1856910), W(0xc1688cb865a9fcdd), W(0x2e4c7fd84cdcce52),
+     W(0x00000000098fb6c3)},
+    0
+  },
+  {
+    {W(0xa40697e3ad2244ee), W(0x379dd18c6dcf122e), W(0x177fcb32179d681f),
+     W(0x000000002e1c6f2e)},
+    {W(0xdfe5e464d9f2b14a), W(0xfcfc80174c70a028), W(0x4d64db2b6183ea61),
+     W(0x00000000d053bce3)},
+    0
+  },
+  {
+    {W(0xc3a07824be7d7700), W(0x66d726bd61458e61), W(0x90d1488a05e60c89),
+     W(0x0000000061d8b181)},
+    {W(0x307950758f1e1984), W(0xf0e084d61b1fa2a6), W(0x87919360c484b9b8),
+     W(0x00000000f6d11a5a)},
+    0
+  },
+  {
+    {W(0xcbed76d1016f2fed), W(0x658048557297b930), W(0x15a5016d41bcff80),
+     W(0x00000000f8ff250f)},
+    {W(0x3407fff9df31aad8), W(0xaf1c1c5bd44099d1), W(0x59fc068601ce1b37),
+     W(0x0000000050dbfc63)},
+    0
+  },
+  {
+    {W(0xc6922afeb6c253c3), W(0x49b9556ec10c0163), W(0xebff54b9cb13f699),
+     W(0x00000000f5c2f1bc)},
+    {W(0xffbde6dbccad3abe), W(0xe16bd2c986ceb70f), W(0x277b344eccea1ca8),
+     W(0x0000000046fadabf)},
+    0
+  },
+  {
+    {W(0xe6f3cecda9c848c0), W(0x1953cde43c37feb1), W(0xbbc0b11e857f0263),
+     W(0x00000000091b8ddb)},
+    {W(0x8541cfa646acc3ea), W(0x7c142776772c3ab4), W(0xcd2d8bee71e71be0),
+     W(0x00000000d29d11b6)},
+    0
+  },
+  {
+    {W(0x38c07c990da77b98), W(0x7011c84a055f173d), W(0x1ddd7461c482c474),
+     W(0x000000009e0ac6e1)},
+    {W(0xf499966060a186e6), W(0x963ff814efaa7852), W(0xc078136fee48158d),
+     W(0x00000000a23467bb)},
+    0
+  },
+  {
+    {W(0x903b838e5ac54d98), W(0x6d69a24a3e763068), W(0x653b8a5cdd562b1c),
+     W(0x00000000eb612629)},
+    {W(0x8c099f348df7b787), W(0x4fa2e8fbbb8c1492), W(0x0dd20158794f06c5),
+     W(0x0000000073ca72cd)},
+    0
+  },
+  {
+    {W(0x0332c86ab05cef54), W(0x9fd517f88a867b97), W(0x6e6b9dd5780e330e),
+     W(0x00000000a43d6a8f)},
+    {W(0x461f9d83485deb75), W(0xe8bd0c24eda6cbf2), W(0x78b96fe33c942cc2),
+     W(0x0000000077aedc71)},
+    0
+  },
+  {
+    {W(0x4b9ffc6ac6b24ae6), W(0x4a42092a8ee5427c), W(0xff6b61a7997ab138),
+     W(0x000000003b574c18)},
+    {W(0xbeade6c6d6cb4977), W(0x2e2d5dc5315f47ce), W(0x39f2d0a5c77bac27),
+     W(0x0000000028b192db)},
+    0
+  },
+  {
+    {W(0x4df6bb4c70c831a0), W(0xe615811f362a495f), W(0xf22cc81bcdb7099c),
+     W(0x000000007805f582)},
+    {W(0x44a7a970932c089d), W(0x53f3f0e3643ff121), W(0x93db9333a0128796),
+     W(0x00000000803c16b6)},
+    0
+  },
+  {
+    {W(0x595ac6a78a772cea), W(0x7c9d2debb231926a), W(0x4f7c45eb4431e2cc),
+     W(0x000000005430fd48)},
+    {W(0x41a0f07ff4bb5495), W(0x20b0f4df9b8104e8), W(0xa80c45471aefa42b),
+     W(0x00000000709fee05)},
+    0
+  },
+  {
+    {W(0x3bccf92940cd5de7), W(0x59c33ae4f9f5bb03), W(0x5d85181ddf75f323),
+     W(0x00000000779b72ec)},
+    {W(0x39ac684e6d200928), W(0x065ea211816aefab), W(0x24b94462485c5eef),
+     W(0x00000000442c94e2)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xdfa7909ea902a170), W(0x93925c6a374a8799), W(0xb4c9c6a6121579dd),
+     W(0x000000002b2a2fe1)},
+    {W(0x2dec18b9421343f7), W(0x4a7ce3d6467e925a), W(0x33d0508251b39839),
+     W(0x000000006dd45eec)},
+    0
+  },
+  {
+    {W(0x9c7bf2996fa7c2c7), W(0x4a4734a42cb77bd8), W(0x0a33b879b7245ac9),
+     W(0x00000000e50ef27d)},
+    {W(0xb91f69793e4bd3ce), W(0xf8b8d90d1ca8036c), W(0xf053ecd4bee50919),
+     W(0x00000000ece7c952)},
+    0
+  },
+  {
+    {W(0xaaf7ef5fe73f9dd1), W(0x315302f93d3b7078), W(0x00b8f278f09fd9b4),
+     W(0x00000000f7dd85ca)},
+    {W(0x54e7df9d4140a60e), W(0xaef051a2e305da30), W(0x88c0e22667dd41ab),
+     W(0x00000000c437eba8)},
+    0
+  },
+  {
+    {W(0x2380678ef9a13e9f), W(0x3f5ce533e93e1c94), W(0xa4954b1368003338),
+     W(0x00000000fa7015a9)},
+    {W(0x3e89282163905ece), W(0x4b7bb99219b8125b), W(0x8579e7efd66a6ac0),
+     W(0x000000007516c1ae)},
+    0
+  },
+  {
+    {W(0x6d88e9dab55dd50b), W(0xbb1af641af929b4d), W(0x2c88cea609f3ff8a),
+     W(0x0000000095aa1478)},
+    {W(0x4d819416f6e2f2aa), W(0xce813081e1f9b46c), W(0x368fe1833fdecbde),
+     W(0x00000000ce1f9cb4)},
+    0
+  },
+  {
+    {W(0x32d143d613b3c6d8), W(0x37eefa5a07002476), W(0xf7ed9d04028e4eac),
+     W(0x0000000065e3cb55)},
+    {W(0x1cab251122c86f9d), W(0x50c1e3f3df940bc6), W(0x2643f52d734bf045),
+     W(0x0000000011593f75)},
+    0
+  },
+  {
+    {W(0xd351d4d7c347067e), W(0x5fe38868141df0b6), W(0x6a97a114aaee8341),
+     W(0x00000000aafe4f6c)},
+    {W(0x3ce36b09c0912e86), W(0xd6174b634106201e), W(0xfda3c46340106385),
+     W(0x000000009e471096)},
+    0
+  },
+  {
+    {W(0x24b41db663cc0fbd), W(0x34bd0f2936a421ac), W(0x619cb9a4dc178877),
+     W(0x00000000a266089e)},
+    {W(0x9fd8767d7b84d003), W(0xa5381512ba9a6d1f), W(0x46c198f48cbdf583),
+     W(0x0000000023f49a00)},
+    0
+  },
+  {
+    {W(0x9a21bdfe669558fe), W(0x06c5b6048411fa8b), W(0xf5bd9bc8de70b24d),
+     W(0x00000000d7443ed1)},
+    {W(0x2b84584e0a439533), W(0x2cf8fe063ea3f8f2), W(0xbc0565bd099fde13),
+     W(0x000000008fd32c81)},
+    0
+  },
+  {
+    {W(0xfcb125d5224521dd), W(0x7d3c0cbb097e443e), W(0x0cce254b96ff5378),
+     W(0x00000000562b2166)},
+    {W(0x73e36236c45e09f3), W(0xf844b9b5992060e2), W(0x139e42f9a968d30e),
+     W(0x00000000e5b89488)},
+    0
+  },
+  {
+    {W(0xbbdec90782ecbbdc), W(0x1807ae9c6c0cb953), W(0xca5b89e3f8e40104),
+     W(0x000000005e56c8f6)},
+    {W(0x040b1ce441f32d88), W(0xbd9bda0d76bd7772), W(0x6bb455f6396f023e),
+     W(0x000000004243e710)},
+    0
+  },
+  {
+    {W(0xf5dcc900a10e49d6), W(0x2e74ef9862fd7874), W(0x9d3a587374f61b6c),
+     W(0x0000000010ca6b61)},
+    {W(0x848244dc470595b7), W(0xf7db6c8781922f08), W(0xb2a50ed6bc236621),
+     W(0x000000000cbc779a)},
+    0
+  },
+  {
+    {W(0x233a4ea200a8605a), W(0xfb49bd9bed225296), W(0x49f70f9b18a0b19f),
+     W(0x00000000fd4a3974)},
+    {W(0x6935d1e03d19e5f7), W(0x167ee2db4ca49b02), W(0x83dab70c465d1799),
+     W(0x000000003925587b)},
+    0
+  },
+  {
+    {W(0xe5e506e54e01759a), W(0x5bdb056834984e59), W(0x023cf8a4c78ed701),
+     W(0x000000008818f370)},
+    {W(0xedb22c00adc05868), W(0x1eb0f72a61bbfcfe), W(0x87de5c204b1c28bf),
+     W(0x0000000013f66db8)},
+    0
+  },
+  {
+    {W(0xc0ef9c326d5a56c1), W(0x1398d5b987339367), W(0x4cb8372bd690f5fe),
+     W(0x0000000074004a4c)},
+    {W(0x62fc7f7ea8b7608c), W(0x7fcc6560c75eca95), W(0x1a3939cc87991514),
+     W(0x000000009eeab34e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa399de315dd3bfdc), W(0xbc0f8f54867305ce), W(0xd31a5a812200477c),
+     W(0x000000009ac2ed5d)},
+    {W(0xa5a011eb59ceee51), W(0x53fce4079cb94041), W(0x26131e4cf7a7e8fe),
+     W(0x00000000bcae3bd4)},
+    0
+  },
+  {
+    {W(0xe00bddece3b818f5), W(0x4681ea2b44e43c61), W(0xb6fe7f05c584d310),
+     W(0x00000000951b39e7)},
+    {W(0x1eae5fc581eb4c72), W(0xdae90140518f5441), W(0x216fb5f2c505aeda),
+     W(0x00000000bb781e43)},
+    0
+  },
+  {
+    {W(0x0608c061644107d2), W(0x386fe5c1bda097bf), W(0xeb251aa0490da22d),
+     W(0x00000000babb9682)},
+    {W(0xc1f77a1f1b64fff7), W(0xda96531886762ba1), W(0x0ee1f6b4c4169423),
+     W(0x000000003a9de0c8)},
+    0
+  },
+  {
+    {W(0xf9a62c2a3cf8ec7d), W(0x23fabd24e0d93869), W(0xb3106bbb6d3f0de8),
+     W(0x00000000b0f77641)},
+    {W(0x9b298ebb6c7c7f7d), W(0x9f30709a184aed09), W(0x79c1d22f334394d4),
+     W(0x00000000d95473d2)},
+    0
+  },
+  {
+    {W(0x33dc3223e341202f), W(0xe4864f0e010b9b98), W(0xbf9735c51828818a),
+     W(0x00000000a6e86e29)},
+    {W(0x609f5b41a1ca6b2e), W(0xfe05620aa3ddd815), W(0xc55f98d98b3c391f),
+     W(0x00000000666e3b5c)},
+    0
+  },
+  {
+    {W(0xcb7cb589ae76cd6a), W(0x3ecf8591f3fc070e), W(0xe19d60f260dba7d6),
+     W(0x00000000e420c869)},
+    {W(0x097e4daa59b7cb97), W(0x7f52c8de707e030c), W(0x9803c9fe0dcda4fd),
+     W(0x000000002bbc44ce)},
+    0
+  },
+  {
+    {W(0x88ee8952d11e54c6), W(0xad79e3b54c760f3f), W(0x76313bb52b252443),
+     W(0x00000000fd6407fb)},
+    {W(0xca6d44a7f6940968), W(0xee29fd9889eb82ba), W(0x189e4073dc9cc4d3),
+     W(0x00000000fc078958)},
+    0
+  },
+  {
+    {W(0xfabcb2492ff400c0), W(0xacc122ab10355326), W(0x4f316ca191ed19cf),
+     W(0x00000000d20efc4e)},
+    {W(0x1a2e490c940a18e1), W(0x029cb6e52b83ac01), W(0x8da694f80fd81ad0),
+     W(0x00000000fcad677f)},
+    0
+  },
+  {
+    {W(0x5adbc36451dd2c4a), W(0xfd051ae034a3b723), W(0x5aee84bf8c415a8b),
+     W(0x00000000e6da473c)},
+    {W(0x3856468713ff9d67), W(0x3b4c0715d82cc625), W(0xdd61ce2b3de3ba3b),
+     W(0x000000005b2e670c)},
+    0
+  },
+  {
+    {W(0x248ec9b3b1b32829), W(0x35de7b9311ef88d2), W(0x370ca0eada678713),
+     W(0x000000007a293625)},
+    {W(0xddfa0a4d1a056e86), W(0xfe05d52e1f856294), W(0xf728ccb46bd2e637),
+     W(0x0000000091baf444)},
+    0
+  },
+  {
+    {W(0x12e49615051a3fa9), W(0x0c3497bd00767fea), W(0x085fe867551b4c13),
+     W(0x00000000b3af533f)},
+    {W(0xea2f61ed3a165692), W(0x53146ae299d98a52), W(0x9e8553c05718399f),
+     W(0x00000000e6ebfc85)},
+    0
+  },
+  {
+    {W(0x9e4adc2574014196), W(0xf964b6c48981411a), W(0x58e82e867eb4dd2d),
+     W(0x0000000097c312ce)},
+    {W(0xd7b84e08153d2149), W(0x4e547787c95c8ff2), W(0x7546fc40d7ac3655),
+     W(0x00000000504a9f59)},
+    0
+  },
+  {
+    {W(0xe03b4634aa82049c), W(0xd179200e3e0102c7), W(0xac5e005c3509e11b),
+     W(0x000000005e9b827a)},
+    {W(0xc190963a8b47cdd1), W(0xf3afd3f4a328949d), W(0x4b6811401c60de86),
+     W(0x00000000bee06528)},
+    0
+  },
+  {
+    {W(0x9edb04253f1e5f11), W(0x63c34818476b8958), W(0x4bab1b96f14565b6),
+     W(0x000000003d3ca262)},
+    {W(0xfd4e9a4718ef180c), W(0xa1174dbb0043c8ff), W(0x0b1e0a8dafaf8911),
+     W(0x00000000cbeb2d8e)},
+    0
+  },
+  {
+    {W(0x20eaa3056b8c3043), W(0x8d50d50f43769812), W(0xa1c35486d5c49062),
+     W(0x00000000397a978b)},
+    {W(0x8aca9ffd3cb99936), W(0x507c5a9fee7a10b8), W(0x411ac4d004608af9),
+     W(0x0000000048c46abc)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xebbefd50486cbfa7), W(0xe20aab7144fc634e), W(0x08a9107e9ddeace8),
+     W(0x00000000909eff4c)},
+    {W(0xf816fa9e746a522f), W(0x864324daefd70514), W(0x0094b64c598db9df),
+     W(0x00000000c6634c12)},
+    0
+  },
+  {
+    {W(0x2ddbdad635f741c9), W(0xbeac98ef5e95c8ee), W(0xf68aac5d74fa6bf8),
+     W(0x00000000e404df62)},
+    {W(0xf325276313d824a6), W(0x4c5b99db934f4963), W(0x39f3ad8165ea023c),
+     W(0x00000000f2ab45c6)},
+    0
+  },
+  {
+    {W(0x7440165bd89c49d6), W(0xbc50c381252d3538), W(0xfc485299c7935e6e),
+     W(0x00000000afc2b1d4)},
+    {W(0x8b5606a87b5b7847), W(0xc8ca9e3a8714fa4e), W(0x03679b60d015855f),
+     W(0x0000000014d9de29)},
+    0
+  },
+  {
+    {W(0x7163417ca7d5999d), W(0x58690b9fe75a8d8d), W(0xf46ea0c134a71e84),
+     W(0x00000000a472172f)},
+    {W(0x5941f31edb5e6f96), W(0xff03761f45ef8849), W(0xff6e6be2813628f8),
+     W(0x000000002f6a6923)},
+    0
+  },
+  {
+    {W(0x9ab52f7613448c75), W(0x4392015e061d7ef8), W(0xae0d756d010840be),
+     W(0x0000000097508e7b)},
+    {W(0xadc78971d15d5084), W(0x7c713bfc4d5b80a4), W(0x256809bbf9aaef5c),
+     W(0x00000000a1ec2e50)},
+    0
+  },
+  {
+    {W(0xc977cb3027b6061c), W(0x430b3684d39b851a), W(0xa19898abcd656ca9),
+     W(0x00000000afd81332)},
+    {W(0x2bb5e6b0fa31c77d), W(0x60d12981c3157a16), W(0x69cbb1588acd8d9d),
+     W(0x000000006d76f690)},
+    0
+  },
+  {
+    {W(0xab510c97eb046732), W(0x9bf44d3fee7b323c), W(0x23d6cc1a37854732),
+     W(0x00000000dbbcc348)},
+    {W(0x64d5f135f773172b), W(0xb0c07c016fb100cc), W(0x980b1419b27f28f5),
+     W(0x00000000ca8834c2)},
+    0
+  },
+  {
+    {W(0x2edb771cd715e784), W(0x5451781fd4ae16cd), W(0xdee3f3e2c8055a0a),
+     W(0x00000000c08d1ca2)},
+    {W(0x4252a1b83a1c4bfb), W(0xbca7011a6d687314), W(0x3b383652ba935b81),
+     W(0x0000000052c1b85d)},
+    0
+  },
+  {
+    {W(0x5472ab5091200dec), W(0x87dd991b858c8d87), W(0x1b601a699a28a4e5),
+     W(0x000000006df37d59)},
+    {W(0xc679ad0ab6957999), W(0x7f9cfe4eee5d5387), W(0xeae158bcceaf9a60),
+     W(0x000000000c61dd1d)},
+    0
+  },
+  {
+    {W(0x5f596df2eabe54b6), W(0x090fa08ea0cbb167), W(0x27417fe1d5ab1d85),
+     W(0x0000000062443f46)},
+    {W(0x7c06fbbf26fe4243), W(0xe31973f76e986ca7), W(0x2758c122e4f1b138),
+     W(0x00000000547f707e)},
+    0
+  },
+  {
+    {W(0x66d037ee6d9b0efa), W(0xe2b6720cb5d38d18), W(0x3473e3a2de324904),
+     W(0x000000002b265d00)},
+    {W(0xaf76dac939cf88f0), W(0x827beac99ac8182b), W(0x69bf74493dfb5978),
+     W(0x000000001e391b33)},
+    0
+  },
+  {
+    {W(0xa8c50b823995b71c), W(0xe463d9452ca8ebbc), W(0x4b89df2bbd703353),
+     W(0x00000000001dbf29)},
+    {W(0x807725fd07aefdcb), W(0xd41a029c5e8b24d9), W(0x46e0bae421d475e7),
+     W(0x00000000a7b6aeb4)},
+    0
+  },
+  {
+    {W(0x7811e453e8ddfc89), W(0x9d7cfe7246abf52b), W(0x4d476dde8ce778cb),
+     W(0x00000000b62d6386)},
+    {W(0xee325ab00f793f08), W(0x2848920d7e017043), W(0x1ab194de7ec7f5d1),
+     W(0x000000003991e121)},
+    0
+  },
+  {
+    {W(0xe755feca8a34520b), W(0x69092c7004d1f4bf), W(0xc58ec1966003dc0e),
+     W(0x00000000d6ae86da)},
+    {W(0x02e5b3502047987c), W(0x85431ace4fe26d65), W(0x861ece215686b587),
+     W(0x00000000c1baa226)},
+    0
+  },
+  {
+    {W(0x5c74d82395f44ac6), W(0xd71cf20c78d3cae5), W(0x4817a07d6b7ee498),
+     W(0x000000001258aa43)},
+    {W(0x97e8c1ef5ddf08f7), W(0xa990866179d7deae), W(0xd281e3c43e4335f4),
+     W(0x00000000d3342f93)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb92b8aef793c7e62), W(0xd358ac7c6354d2c9), W(0x0381968a5a4d9e35),
+     W(0x0000000052d9f13a)},
+    {W(0xc63b9fe636ed6955), W(0x726db1453743142f), W(0xaea91efc6e186e53),
+     W(0x000000003de25aa0)},
+    0
+  },
+  {
+    {W(0xf89217574c1ff250), W(0xb6db16c1ced4216d), W(0xd524c87728cf0cfe),
+     W(0x0000000003bdd0b5)},
+    {W(0xd91831dddfd0f98a), W(0x980f4d7dd131c59b), W(0xf492c76747533185),
+     W(0x0000000063c30af1)},
+    0
+  },
+  {
+    {W(0x79a5ddcb0cc8e4dd), W(0x26e26606495cdcc7), W(0x9d2ff41e7f199f53),
+     W(0x00000000be613bf2)},
+    {W(0x967f075336bd8348), W(0xc4ce646276c36728), W(0xee5a166b02af3c45),
+     W(0x000000000bda3025)},
+    0
+  },
+  {
+    {W(0x63718529ff47da80), W(0xa699d496473e976c), W(0x368ce83988aeb436),
+     W(0x0000000094aabe19)},
+    {W(0xb19a3ec60bf4b797), W(0xcd07cc987d50b7ff), W(0x8c4eb78c81c2bf46),
+     W(0x00000000b0a7cd1f)},
+    0
+  },
+  {
+    {W(0x56f0849c2ddf8350), W(0x4be4bf015739e59e), W(0x8b91a3a31fc6493a),
+     W(0x00000000d401b24b)},
+    {W(0x9decd9c5e89ec9f3), W(0xe63f936917f178e9), W(0x7a09efc0fa904473),
+     W(0x00000000ca5c00a9)},
+    0
+  },
+  {
+    {W(0x6aca6f60e3f640d4), W(0x574789e14bda0113), W(0xb4db3fdf12ccd894),
+     W(0x00000000b39be04f)},
+    {W(0xb4705565f1e4603b), W(0xef713fb6ccbe5154), W(0x11964906d84fec44),
+     W(0x000000009ceede3f)},
+    0
+  },
+  {
+    {W(0x13111bdb0244c62d), W(0x14dda4d9175d3f77), W(0x21244b52e0971342),
+     W(0x00000000d6fa5642)},
+    {W(0x68da34f12ee8560d), W(0x387164b3b9933942), W(0xee292b1dd7d7f791),
+     W(0x000000004382d48d)},
+    0
+  },
+  {
+    {W(0xe877a2082a7dfaac), W(0x77afbba8af9b8432), W(0xbb09b9231257224a),
+     W(0x000000001501cefc)},
+    {W(0xe061421f38985dbe), W(0x00e2d3d6aa863b6a), W(0x1a9bf0b72733782a),
+     W(0x000000006912b5aa)},
+    0
+  },
+  {
+    {W(0x38d0122470c5c0c6), W(0x84a934e4a0259e70), W(0xfd49df968e85d7ef),
+     W(0x000000006bb4a230)},
+    {W(0x58b99e52a15b7d76), W(0x2dc32c4c3c2be4ba), W(0x4937a76de49fcb40),
+     W(0x00000000dc9b73dc)},
+    0
+  },
+  {
+    {W(0xa516c9ed5ce8f858), W(0xd3f7221c41610138), W(0x8795351f71d5b83a),
+     W(0x000000009a45e682)},
+    {W(0x9edacc8def8c4cff), W(0x9166ced117bd9c0b), W(0x57013f03871cc69c),
+     W(0x00000000b6b7b6e2)},
+    0
+  },
+  {
+    {W(0x4855e4b1f3f01792), W(0x7556de49124c67e8), W(0x494ae118d4d7f50b),
+     W(0x00000000f16b9834)},
+    {W(0x3a6a8d30ab9ad587), W(0xa950fac018d69af9), W(0x9daffa887f8ed091),
+     W(0x00000000ba6e7c59)},
+    0
+  },
+  {
+    {W(0x011788f58f831a7c), W(0xf480aaea9c64aa0c), W(0xcc8f1ea7f896522c),
+     W(0x00000000772627b7)},
+    {W(0x72bb812ae1227c86), W(0x6e202e0657f8a759), W(0x4c06faebc7e7a397),
+     W(0x00000000eea7a14b)},
+    0
+  },
+  {
+    {W(0x0c456e8446853977), W(0x94a82d15bacf3d29), W(0x17a88c53861ef909),
+     W(0x0000000025d01a4d)},
+    {W(0x0b6e87feaa44d1ac), W(0xce900509066301cc), W(0xe4c44c3a51763eac),
+     W(0x00000000243f5364)},
+    0
+  },
+  {
+    {W(0x69fe2b3ef02ccf3e), W(0xa6634ac0623f7c06), W(0xba6dd8e5a81b9914),
+     W(0x00000000d33612e7)},
+    {W(0xc948497ccf35703c), W(0x3725232b7184b686), W(0xfa105e4bd5e74279),
+     W(0x000000004bfe5bea)},
+    0
+  },
+  {
+    {W(0x03d46274bbed4591), W(0xc3c74b90fcb464d3), W(0xf6934477dcb4ccb3),
+     W(0x00000000bdf563a1)},
+    {W(0x7c07acc7dae24867), W(0x05fd64244d4331eb), W(0x022d151f768b2706),
+     W(0x00000000f65a4027)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x5cbe2653fff51bbb), W(0xbec1f2c532707706), W(0x1d1ff2029739588e),
+     W(0x00000000e51c696a)},
+    {W(0xdd740417fa60c3f4), W(0x6a0e351e25fcc7e6), W(0x0d72b69eac2dfbc7),
+     W(0x000000001ff6f6ad)},
+    0
+  },
+  {
+    {W(0x727a95e96cffb688), W(0x83b28617fb0e9702), W(0xdb71dd75cca5f38c),
+     W(0x00000000ad31c5dd)},
+    {W(0x3ff02651f33897ae), W(0x380268df683b0e57), W(0x4ab25a51c6e32a5b),
+     W(0x00000000283f183b)},
+    0
+  },
+  {
+    {W(0xf1c993cad2fe399c), W(0x4e4c53efa2f0722e), W(0x8af34ce1e7c142ac),
+     W(0x00000000ce47aba3)},
+    {W(0xb6c1f1fe7f0fff87), W(0x0f23c16d49dac9d9), W(0xdbfb3b981baa4d4d),
+     W(0x00000000d927e1a8)},
+    0
+  },
+  {
+    {W(0xe8013df73d465f68), W(0x3e4bfa755dcfcfb0), W(0xe0fbd7bb7a765b73),
+     W(0x000000004e7374be)},
+    {W(0xfe9b1e77186b6aed), W(0xf7011562375f54f1), W(0x202fbb6d55dc463e),
+     W(0x000000008d697af5)},
+    0
+  },
+  {
+    {W(0xcbe7ae6cfba0cb63), W(0x8d2c58f9083430ef), W(0x49e8e023f7216901),
+     W(0x000000008fae947a)},
+    {W(0xe1504266fb02e2c0), W(0xf6c9e019320da5cc), W(0x0fadd8b2302feeaa),
+     W(0x00000000d38883e4)},
+    0
+  },
+  {
+    {W(0xad702f59614edc45), W(0xdd7dc47eb8c59252), W(0x6cbabd29734324d9),
+     W(0x0000000006149d80)},
+    {W(0x25ea95da67404e4b), W(0xfc4aea50f02ca196), W(0x985a22840490d58b),
+     W(0x00000000965b923f)},
+    0
+  },
+  {
+    {W(0x984b487c3960ef71), W(0x59fcbe018b769be2), W(0x77bbab4cd778e0bc),
+     W(0x00000000eba79fed)},
+    {W(0x6652bcb86b374139), W(0xb27f6d7425ac1b0f), W(0x8976cd8e9d2756be),
+     W(0x000000000fe8f94f)},
+    0
+  },
+  {
+    {W(0xbcdbe444e165ca1e), W(0x76643977cb4a833d), W(0xef7d725eb07c1b51),
+     W(0x00000000dc3b82a8)},
+    {W(0xaa5a7ac821f29146), W(0xa51481d901e0c54e), W(0xd220aca62b2d5197),
+     W(0x00000000736d91c9)},
+    0
+  },
+  {
+    {W(0xd715cef5c8f45b3c), W(0xeef14d6cbe6cd904), W(0x8b7ba649d06ce5e2),
+     W(0x000000006b7254a1)},
+    {W(0x8a7e751e97ccb2ab), W(0x7a5be9c2d346aad6), W(0x3693e452a9eff249),
+     W(0x00000000f35ce492)},
+    0
+  },
+  {
+    {W(0x3d075ca2415e6f04), W(0x5af974672a87f6c4), W(0x7d93c94217abbe81),
+     W(0x0000000006472801)},
+    {W(0x76fc13b3adc44f9e), W(0x13d64aaebcba9f97), W(0x7f56d265af33f4af),
+     W(0x000000004c576d23)},
+    0
+  },
+  {
+    {W(0x33e1aae54e00bf83), W(0x79b7d394b59f7783), W(0x1231628afa707666),
+     W(0x000000004a0f3bf3)},
+    {W(0xfa2b5aa57a2741a5), W(0x0235b85eb62f5f1d), W(0xb48bebe95026c719),
+     W(0x00000000eaf1016e)},
+    0
+  },
+  {
+    {W(0xc0630594ad0528b9), W(0x43905a16e709d59c), W(0x39a5427bc495515d),
+     W(0x000000008490a0e4)},
+    {W(0xce6c24e244f5be2e), W(0x3010cac0d8d62c65), W(0xde8d0cf70af1bf95),
+     W(0x00000000854d956c)},
+    0
+  },
+  {
+    {W(0x5f9a8b5c04cf5873), W(0x1a18bc66f7d486bb), W(0xcfa8453086d49b1d),
+     W(0x00000000e9ccdd59)},
+    {W(0xdddc3de44e3c3dc2), W(0xd3e8d10fdc40db09), W(0x2e7e5a91d1cf5794),
+     W(0x000000000b63f631)},
+    0
+  },
+  {
+    {W(0x60cb47eacad71d1c), W(0x6114160e7825e536), W(0x54566580a366d4df),
+     W(0x00000000fb6c1da0)},
+    {W(0xc70dc4e7d035646c), W(0xe47b207da6c5f68f), W(0x14e8d5befaf211ff),
+     W(0x00000000dda33228)},
+    0
+  },
+  {
+    {W(0xe759452fcac5521c), W(0xb29158d58fc3ee15), W(0xae5d8c9422854a19),
+     W(0x000000005bd332b8)},
+    {W(0x2dba7cc9f305910d), W(0x71f2eb1d3f38eaf5), W(0x4cad987d0d82e3a5),
+     W(0x00000000fcd8df80)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x74d6d0ba87d54b6b), W(0x723937b39af89e67), W(0xda49ba83ada42e0e),
+     W(0x0000000083b9c4ec)},
+    {W(0x12dfdcada3055000), W(0xa98d52437e0a2cb4), W(0x6ed0d332f7e3a9a3),
+     W(0x000000001f8c692d)},
+    0
+  },
+  {
+    {W(0xab70364f75cd1b48), W(0xf0408ddf6b243c97), W(0x0ef0ffd58b9a0873),
+     W(0x00000000b6e8c899)},
+    {W(0x2e1c11d8be3a87dc), W(0x6ed01611154379bf), W(0xc876e0d34382cb75),
+     W(0x00000000c42ec7d1)},
+    0
+  },
+  {
+    {W(0x71aba88eab41ec83), W(0x3366c35b590711c2), W(0x87bfe9390b6ab428),
+     W(0x000000001d7e1090)},
+    {W(0x7ebcdd741d44d3e7), W(0x42a83b752a937fd4), W(0xc4155a573da3197e),
+     W(0x00000000f1cea938)},
+    0
+  },
+  {
+    {W(0x6983b44bb129c61a), W(0x463c956ff27d3e69), W(0x5a97c010e4a043b6),
+     W(0x00000000c8f8a3c7)},
+    {W(0xb9a3137c6cfa78d3), W(0xfc8d858e5655ed33), W(0xc1a3c9bb0b6dca4a),
+     W(0x00000000630b3026)},
+    0
+  },
+  {
+    {W(0x3f0bf1e32f9e0c0c), W(0xbd33fa00031e908e), W(0x6e2d4301bc16afc6),
+     W(0x0000000090a23e58)},
+    {W(0x2549fd2099df250f), W(0xa724a01852f4ef15), W(0x1a5fbbc35b4c8dd8),
+     W(0x000000007457c84e)},
+    0
+  },
+  {
+    {W(0xaa616a39ca000d60), W(0xcacdc37a662a3f35), W(0xee30f511dd7d18e3),
+     W(0x00000000f25f9c46)},
+    {W(0x3e51e6527bee7ee6), W(0xdd692c2b81e804d2), W(0xa52da544b0aaaab1),
+     W(0x0000000089ee1376)},
+    0
+  },
+  {
+    {W(0xf21a3a3991370dc2), W(0x4835ded538aa8cf8), W(0xf1f81f183dd4e3e5),
+     W(0x00000000ee849585)},
+    {W(0xb30df0288aa2dfcc), W(0x24f52ca41e4514ba), W(0x3b2305c3757e6772),
+     W(0x00000000a3525eaa)},
+    0
+  },
+  {
+    {W(0x0fd330ac4fc503ac), W(0xd80c9e620f394d0b), W(0x99b62540e4d013eb),
+     W(0x00000000aa1c17a9)},
+    {W(0x8f6f27420a2e0bc8), W(0x3a715ba27366a618), W(0x8818aa1488e9ae3e),
+     W(0x00000000d2fe924a)},
+    0
+  },
+  {
+    {W(0x46ea826a2ced9c6c), W(0xe4112274c4da4263), W(0xbfc3581d43744264),
+     W(0x00000000cc933457)},
+    {W(0x9cbecb36b80bff4c), W(0xb9509e61e0071ca1), W(0x67a2c9e1cf0cfc02),
+     W(0x000000002f9bd24a)},
+    0
+  },
+  {
+    {W(0x935833d6f1e98090), W(0x530418e5d0e4995f), W(0x933733ca87f60eef),
+     W(0x00000000379092ba)},
+    {W(0xd4945af5423ea862), W(0x165baec160eeff1a), W(0x4bee290d1d6d1df0),
+     W(0x00000000e87f42f5)},
+    0
+  },
+  {
+    {W(0xf0a3e291cd741439), W(0x41b8528c74dc9c31), W(0x01ba1bb0c78baacd),
+     W(0x00000000e5b73558)},
+    {W(0x9cf505751ce4898f), W(0x5a0b632c5421bd61), W(0xc421cfb2241cb4c7),
+     W(0x000000009ba297a8)},
+    0
+  },
+  {
+    {W(0xda605905dcd6bf3b), W(0x0b1bb0c15f01a30b), W(0x40f7d79d7c053c41),
+     W(0x00000000c39feb03)},
+    {W(0x3d73c35998a4669a), W(0x4a94f93ee472e81d), W(0xed66fd6fdea2bf34),
+     W(0x00000000ddc57518)},
+    0
+  },
+  {
+    {W(0x83877c704ef0a025), W(0x09e709b439e61abc), W(0x7885ad28a88e05f1),
+     W(0x0000000053bfba53)},
+    {W(0x8e433b9e9b73b3c4), W(0x7394d932d6a78477), W(0x3ce9d748cefdc6a1),
+     W(0x0000000027d9ed71)},
+    0
+  },
+  {
+    {W(0xd120f88d73c8d3ee), W(0x060ff4c7e3275570), W(0x8d5e8c7fe344b66d),
+     W(0x000000001cdb23ae)},
+    {W(0xce526de223a7070c), W(0x4b694305e64e6355), W(0x7e00559a5edf30dc),
+     W(0x000000003501ee2b)},
+    0
+  },
+  {
+    {W(0x7675921ad58b2165), W(0xa292bedab30c5e67), W(0xb5aac1319a004497),
+     W(0x00000000caf13420)},
+    {W(0xced86c69a8c50521), W(0x9774900bc60fb50a), W(0xdec986578cd4dd3d),
+     W(0x000000005092d4ea)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd29e534e09326b40), W(0x727f40f5215aa2f4), W(0x3c54a3cb5f00b26c),
+     W(0x0000000071ec2585)},
+    {W(0x4c553b9214b424a2), W(0x06c97184f86c23e2), W(0x0fb40ab0dd6cfc3e),
+     W(0x000000004647a750)},
+    0
+  },
+  {
+    {W(0x8c6adeda3dba43f3), W(0xa42d63e8ebd0f498), W(0xb75b4edf993107d0),
+     W(0x000000000232f8ad)},
+    {W(0xa2592945720ca302), W(0x473bf91748d03da4), W(0x8ff4aaa7da871c01),
+     W(0x00000000746e818b)},
+    0
+  },
+  {
+    {W(0x24d41168219f7107), W(0xb0ff73a11fbe4a4d), W(0x115e6b5f39d641f5),
+     W(0x0000000020b57a07)},
+    {W(0xfeee837b893df871), W(0xbf0a2e79f0116ec8), W(0x7abd73c81f17f63b),
+     W(0x00000000e5c34917)},
+    0
+  },
+  {
+    {W(0x23800fab3e28ba8b), W(0x99a4d0418b12655a), W(0x33023ec966a4179d),
+     W(0x000000001205108d)},
+    {W(0xa87c96acdbb13a66), W(0x98998891402e3b9a), W(0x6b327511d3dbe7de),
+     W(0x000000005723ac5b)},
+    0
+  },
+  {
+    {W(0x4c28ed4d73074b6a), W(0xbd2f9bf2094975ca), W(0xc90043dae1204222),
+     W(0x000000001d17faa2)},
+    {W(0x7c69ec1ac23a5561), W(0xaa36aef192aebd30), W(0x623fd5e826bb7581),
+     W(0x0000000081fb95c6)},
+    0
+  },
+  {
+    {W(0x91ba0a3001dfba4f), W(0x4c404ebdfe724473), W(0x2e5f3d4e8e13b23f),
+     W(0x00000000feaa8778)},
+    {W(0x15942cd199a263f0), W(0xaa07607d659bd75d), W(0xb8b0d8e297bc6125),
+     W(0x000000006c43dcd0)},
+    0
+  },
+  {
+    {W(0x56710f771a7ec77a), W(0xa52e280c599db458), W(0xfb4212fd9bae217d),
+     W(0x000000002e51ec9b)},
+    {W(0xac1ce1e4be6ce9cc), W(0x63ca9c2d361b838d), W(0xb6a7599875f720e5),
+     W(0x0000000042ba6008)},
+    0
+  },
+  {
+    {W(0x7ab235bda70cb5da), W(0xac5f3af5bede2315), W(0xe6d564645f9a6aaf),
+     W(0x00000000357d2d21)},
+    {W(0x95a60b403156d6fe), W(0x9e63e29f49f4f0e2), W(0x4c739342dca3ea62),
+     W(0x00000000a16d4457)},
+    0
+  },
+  {
+    {W(0xb85fee6976034e6b), W(0x5db45ef017fd303a), W(0xbe53fe348343efbd),
+     W(0x000000006ab7c44f)},
+    {W(0xdc9db89ba7835a6a), W(0x4a0abcf861c6218d), W(0x87f948cdd9a09ad6),
+     W(0x0000000064b0d6e4)},
+    0
+  },
+  {
+    {W(0xbe9c0e8aa950a05a), W(0xe8d059a88da05c21), W(0x83c2bb8318c3ca17),
+     W(0x0000000051e525c9)},
+    {W(0x1ecab462586475b9), W(0x0e12592f5c33bc62), W(0x971cb54469e70321),
+     W(0x00000000662ee00c)},
+    0
+  },
+  {
+    {W(0xe10dd1e3c5f63217), W(0xd3cc99aefb45c613), W(0x4d8cf0b280e08e63),
+     W(0x000000002a3e2432)},
+    {W(0x64c606e3ceb74e10), W(0x92033786adcba26a), W(0xcb92404d3343d8df),
+     W(0x0000000006802541)},
+    0
+  },
+  {
+    {W(0xdcc5b89ae1948d0e), W(0xd5a2f46b463327ef), W(0xbfce0e4dadb9328a),
+     W(0x000000000d62b545)},
+    {W(0x349d4bd51dd89a4b), W(0xc19125f9a76133fc), W(0xf5a817aab4284724),
+     W(0x00000000f7ca3909)},
+    0
+  },
+  {
+    {W(0x05e1f65a826d2036), W(0x2940765fd3d73825), W(0xc80afe06d7d85010),
+     W(0x0000000045f45f11)},
+    {W(0x47e339234ead3f2c), W(0xe3d9da049cbcf4d6), W(0x33088ffb89effdb3),
+     W(0x0000000026442c78)},
+    0
+  },
+  {
+    {W(0x792a45198be6551d), W(0x97dda1ebbfd0d664), W(0x2934190ffba80483),
+     W(0x00000000101faa94)},
+    {W(0x6faee0f6675b460b), W(0xccd38d4ecfd88ea4), W(0x76c5cb37d57bdb40),
+     W(0x000000003f31fb10)},
+    0
+  },
+  {
+    {W(0x6f410e7358de44b6), W(0x2b615974d9f696d1), W(0x3bd0efe9d131917f),
+     W(0x000000000fc9bcc9)},
+    {W(0x12a46b5175cd338e), W(0x0fed28350f5148ec), W(0x4d9895ec05f68b36),
+     W(0x00000000da24384b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0655039e7fc121e6), W(0x42a0f87fbc44db37), W(0x67d89bbe3d4e983e),
+     W(0x0000000085435ace)},
+    {W(0xbe29cd2e18346e4d), W(0xe8b5a373ed39f9e8), W(0x3d4406d255cac6ca),
+     W(0x00000000de2aeda4)},
+    0
+  },
+  {
+    {W(0x84e7489a784462ed), W(0xe5d5e019c981ba62), W(0xa77e3ed1792db847),
+     W(0x00000000f4b6792a)},
+    {W(0xed208d2236f5a622), W(0x953f894ffc7dc4a1), W(0x095b0ea787c2b024),
+     W(0x0000000088016bc4)},
+    0
+  },
+  {
+    {W(0xed47d3b7c57ef65f), W(0x623f72286051e486), W(0xfb40723c2e29a4c3),
+     W(0x0000000077353f89)},
+    {W(0xf4eea8fdda6cb60f), W(0xd086a7ab672e091a), W(0x96e8e707ef34d20e),
+     W(0x000000002e5db0f7)},
+    0
+  },
+  {
+    {W(0x291c3272c5905237), W(0x7507a05b766b4a0b), W(0xafb97a2d6e56a096),
+     W(0x00000000e3cbbbe3)},
+    {W(0x2369de3444beffab), W(0x287f5c704c78c1e4), W(0x14e1a4eb698e8f90),
+     W(0x00000000a87a74e8)},
+    0
+  },
+  {
+    {W(0xc960822361ffdada), W(0xbfde5d50d3a9e728), W(0x23db313b9fcf28b0),
+     W(0x00000000e226f1f0)},
+    {W(0xdd26c697c362ae30), W(0xbe0de20ea3a7479f), W(0xc0ad648f4871cbd5),
+     W(0x0000000030414c9b)},
+    0
+  },
+  {
+    {W(0x1d7326e1858ad4cf), W(0x7ee589d652fad307), W(0x9cfd50233aa389bc),
+     W(0x000000003feb82b3)},
+    {W(0x4a98e74403b8a60e), W(0x2c871f8322a198b9), W(0x95dcd4255fd22f5d),
+     W(0x00000000e40ca457)},
+    0
+  },
+  {
+    {W(0x6115b5dede9cd058), W(0x494a27b812e07056), W(0xdadb7f44ab33f925),
+     W(0x000000009611fc0f)},
+    {W(0x135db6737c525248), W(0x13d5d03c0014d0b2), W(0x498b5aab34df44be),
+     W(0x000000003b9bf0a3)},
+    0
+  },
+  {
+    {W(0x7702c304a0369424), W(0x88180dc590cc96b4), W(0xea844162ec9108c9),
+     W(0x0000000079d4d2e8)},
+    {W(0x9b79933ff7c7120d), W(0x731916379b1c7dfd), W(0x4a0a1e22f8a798d5),
+     W(0x000000007439503e)},
+    0
+  },
+  {
+    {W(0xad65298935ef27c5), W(0xeb42119658b32f27), W(0x4b505f2e976af3d3),
+     W(0x0000000064c1cfc3)},
+    {W(0x59913cfdf3dae0f8), W(0x2039f0fcbab37657), W(0x8887e569f066519c),
+     W(0x000000003d975cff)},
+    0
+  },
+  {
+    {W(0x82d22a5133b47b28), W(0x480198aee38ffddd), W(0xa964fa9d03df60cb),
+     W(0x000000009bfb3890)},
+    {W(0x96707a63ee5cec96), W(0x22ae2467f9f9338a), W(0x0acd29e15d9e9ac0),
+     W(0x00000000854609dd)},
+    0
+  },
+  {
+    {W(0xb80a187645e7789f), W(0xaff77eda7a0670f5), W(0xceba003e99c0dcff),
+     W(0x00000000737b1478)},
+    {W(0x88ff60f7169db41d), W(0xe2c4f8baa8a91790), W(0x8ebfd0f8d0c75bfd),
+     W(0x00000000af779b34)},
+    0
+  },
+  {
+    {W(0xe5bd052cc745e953), W(0x1d26e2b670e13a7c), W(0x0121f8bc0c4379c6),
+     W(0x0000000071124e71)},
+    {W(0xe43a3a5487d6954b), W(0x9bfa2ae6d9134113), W(0x3a1c2b24bbbe7daf),
+     W(0x000000003950f72a)},
+    0
+  },
+  {
+    {W(0xe024a3b5f30d07fb), W(0xe4416883ffdc8787), W(0x16ab4631bb8a1baa),
+     W(0x00000000f8688223)},
+    {W(0x09c1692b2f0f8322), W(0x13a2837f0dd7a6f9), W(0x784e210d3a94d17d),
+     W(0x0000000058b82c4e)},
+    0
+  },
+  {
+    {W(0xb5fbaafe4583d724), W(0x051dd3b453d923d7), W(0xc59594fb8aeef402),
+     W(0x00000000d7267ef5)},
+    {W(0xede0bede5e8a7497), W(0x6171e5a5b019e637), W(0xb69b47a81be98aa9),
+     W(0x00000000d848486b)},
+    0
+  },
+  {
+    {W(0x9f084f50cc8fc2ff), W(0x4d3ec70415421912), W(0xa93a4b3569e1810f),
+     W(0x0000000066d7f71e)},
+    {W(0x9b5d9b1475523ca2), W(0x8615c97c85c36f3f), W(0x1acc3982f837f0c4),
+     W(0x000000004526c2f7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe4d85de62ef56139), W(0xf2c33f4b0b0acedc), W(0x04526cb66091bc19),
+     W(0x00000000ac1ce3ea)},
+    {W(0xb54024a624bfc4bb), W(0x909d86a257196c24), W(0x1b1d5d2a42e04322),
+     W(0x00000000bb31992a)},
+    0
+  },
+  {
+    {W(0x5f4861c3b476bc0f), W(0xed89263c9a1b156b), W(0xbeb5a95545b930e9),
+     W(0x0000000029358e8a)},
+    {W(0x7923968baad0495f), W(0x3abc6adf127f5983), W(0x22713358f5aef19c),
+     W(0x000000000329be36)},
+    0
+  },
+  {
+    {W(0x601f8a4b79c8640b), W(0xd9c6e4e3b41e11ed), W(0xd237ed43343ad430),
+     W(0x00000000c16da3f5)},
+    {W(0xc296c55df5e58b46), W(0x3abed6e4302d16d9), W(0x8a69257931180e58),
+     W(0x0000000025fd21a4)},
+    0
+  },
+  {
+    {W(0x842632ce97c8de6b), W(0xfcb4c194d5e766ad), W(0xdb59f894bab1e908),
+     W(0x00000000a103e5b9)},
+    {W(0xc4c67972e0644e8b), W(0x340af5c52cd3e628), W(0x787c5ec2e2690b88),
+     W(0x00000000153e0f49)},
+    0
+  },
+  {
+    {W(0xe2597a02c9d55307), W(0x459cb90c67943edb), W(0x1f1623a0fb3084de),
+     W(0x00000000d882d666)},
+    {W(0x228543b3caeb5ab3), W(0x8f078887de9c77de), W(0xd9aa7a81f4fc8062),
+     W(0x000000002e5688f1)},
+    0
+  },
+  {
+    {W(0x01d9f5c67e2abe1e), W(0x4187566a9acab18d), W(0x43543f3e96fbb4bc),
+     W(0x0000000019e99acc)},
+    {W(0x4d4f6942911c12bc), W(0x05a419a82373babd), W(0xdd5243360c662933),
+     W(0x0000000060570f05)},
+    0
+  },
+  {
+    {W(0x9c38e378fe646b79), W(0x8eac893662c025e2), W(0x4405db338ae3943b),
+     W(0x000000001adf2f4d)},
+    {W(0xf861d52b0759d392), W(0x771d95e2990d7abc), W(0xdf7ce48713c7a1e7),
+     W(0x0000000086004540)},
+    0
+  },
+  {
+    {W(0x98a32e875607a4f3), W(0x841d648d9cbcb156), W(0x85f705a800a72b88),
+     W(0x00000000b60a7751)},
+    {W(0x3ef7d9b630e3dc7e), W(0xeec26796c5078f17), W(0xb521d60e20110dec),
+     W(0x00000000324aa16f)},
+    0
+  },
+  {
+    {W(0x167df3fafe2b4587), W(0x13530666452e2916), W(0xaba8bb82c9a79c42),
+     W(0x00000000330dd2a8)},
+    {W(0xafd11f4436940550), W(0x7712d6261fa67c92), W(0xf55795e606884d27),
+     W(0x0000000059ce6f03)},
+    0
+  },
+  {
+    {W(0x7053cd14547a71b7), W(0x3ecd5cadc75d38b5), W(0xfa6fa1eaff26fb53),
+     W(0x0000000089904b74)},
+    {W(0xb9800605ba1aaedf), W(0x517f26e60d1c07cb), W(0xe982130b7605e424),
+     W(0x00000000c4ed9c66)},
+    0
+  },
+  {
+    {W(0xaa973bc73d8158e0), W(0xfa7d2152c04dc5a9), W(0x1630d706f0cd4156),
+     W(0x0000000087685231)},
+    {W(0xddc6abec38e18cbe), W(0xb49f69effa58b77f), W(0xd98dd9aa2877fd78),
+     W(0x00000000e7e9ae11)},
+    0
+  },
+  {
+    {W(0xb3f704f406117460), W(0xed0726e92c1c043d), W(0xbe354e8d3e68dbd8),
+     W(0x00000000a6382386)},
+    {W(0x26378a40a4136478), W(0xcc8a890904646666), W(0xc603785d88fbb7ce),
+     W(0x00000000b1f815a2)},
+    0
+  },
+  {
+    {W(0x006f8499387a5e80), W(0xe89c2605589b2718), W(0x7407c686b6ba392d),
+     W(0x00000000458a0df7)},
+    {W(0x8436de88ab26375d), W(0x12028b33e3d5a291), W(0xe63da0914de04e27),
+     W(0x00000000ba87b120)},
+    0
+  },
+  {
+    {W(0x43fe75c8ee89450b), W(0x16a051c09a29229c), W(0x7d4b9fc39b1a9170),
+     W(0x00000000133dd4ca)},
+    {W(0x53ac8646738df325), W(0x5c600cb66dcfad8d), W(0x6ff11203e4115708),
+     W(0x00000000bc9689c3)},
+    0
+  },
+  {
+    {W(0x131ba9f5cbea0233), W(0x0750486531c31ba9), W(0xa023a81cd28117d5),
+     W(0x00000000f6f91c4b)},
+    {W(0x93700f75b6f23351), W(0x349ac19c74389aa3), W(0xad97afc56c5ec3ac),
+     W(0x000000007dd6918b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd81789dcaab0cefc), W(0x67ca91b07b457d74), W(0x096f997d5a87275f),
+     W(0x000000005d4f53a6)},
+    {W(0xc86a176a3d1c72aa), W(0xbb03ebf70c5247ba), W(0x325d67b1b389c0f5),
+     W(0x00000000dc511ddb)},
+    0
+  },
+  {
+    {W(0x98673100a5b224c1), W(0x7e857bdd35c900a8), W(0x63415d28db5df675),
+     W(0x000000006b676a73)},
+    {W(0x3e21afd004cd81e5), W(0x2e610defa33929eb), W(0x6bf414b5717e43a4),
+     W(0x000000009c7a3c47)},
+    0
+  },
+  {
+    {W(0x736e668443726846), W(0x4ea61054a762a548), W(0xa90f1dd74ea95a8f),
+     W(0x00000000f1a7ecac)},
+    {W(0xdb175bab052ff525), W(0x113349c6176f58b3), W(0xf30e4d8366d2f2dd),
+     W(0x00000000047e3e70)},
+    0
+  },
+  {
+    {W(0xb80d181c13fd6d90), W(0x288db1c92be6d108), W(0x7004d85bb342ddca),
+     W(0x00000000be7db7ec)},
+    {W(0xc1d565da0ba4c981), W(0xaf5c7b86b82063a3), W(0xbf4ed46eaa90bf00),
+     W(0x000000003a15f177)},
+    0
+  },
+  {
+    {W(0x09e379b487f39f99), W(0x3fce44cd9e14e886), W(0x75711ae32fb4d3e3),
+     W(0x00000000036fce90)},
+    {W(0x2542f70e85e9ac2b), W(0x8303b7eea4a903d2), W(0x637b247b95852fe8),
+     W(0x00000000012141cc)},
+    0
+  },
+  {
+    {W(0x12f4285d2ad64bbf), W(0xe31b4490289cd434), W(0x5132c5c42614d391),
+     W(0x00000000d24f8d84)},
+    {W(0xb496fb6f0a9c7374), W(0xaa619fb0945d4d6b), W(0x226ba20e64d58ea0),
+     W(0x0000000078fadda9)},
+    0
+  },
+  {
+    {W(0x5ded0d3489bc38a6), W(0x82054d24d70c960d), W(0xbcbebb9e08b78436),
+     W(0x00000000662ab949)},
+    {W(0x1d7a378cea6945f0), W(0x2b017a9fcd6abb3b), W(0x4dbff4b2991364b4),
+     W(0x000000006e088465)},
+    0
+  },
+  {
+    {W(0x3ad984a7b77380be), W(0x216f17483bd4bc94), W(0x4aee7a72c17ca930),
+     W(0x00000000fcd30768)},
+    {W(0xa1f41f7602746210), W(0x670f40136fdb5587), W(0x0145b6043c2763bb),
+     W(0x000000006e18b2a2)},
+    0
+  },
+  {
+    {W(0xc5dcbe5ad0c666a8), W(0x635bc454968b0667), W(0x0b12ef0026146dcd),
+     W(0x000000005211e237)},
+    {W(0xc7e0b6798d36b8a9), W(0x5c86fc95f7ee0e2e), W(0x3079c265a7590033),
+     W(0x00000000193ae51d)},
+    0
+  },
+  {
+    {W(0xfe84b0cfa5667c2b), W(0xdca691e9f9e7a819), W(0x53a5a36d7bea36d4),
+     W(0x00000000887236cc)},
+    {W(0x6a6bd40a54a67b38), W(0xa9977215fc076580), W(0xabf0769efe3a7abe),
+     W(0x000000007074a956)},
+    0
+  },
+  {
+    {W(0x9b91bd9d1342d8bf), W(0xf26058ab87364547), W(0x6e4c635938255fc4),
+     W(0x000000002e8910ea)},
+    {W(0xa2106339d884d2b6), W(0x0293ef06a08d2eee), W(0xcb880dee10bd8a70),
+     W(0x0000000022f1dce8)},
+    0
+  },
+  {
+    {W(0x14714b2dcf3e7753), W(0x27b28a245aab8234), W(0x69efd6a30514f991),
+     W(0x000000006bbffd26)},
+    {W(0x4d416ef7bce508b7), W(0xad164dc22a31c308), W(0xaef1e414b2d6cdb9),
+     W(0x00000000fea79a11)},
+    0
+  },
+  {
+    {W(0xd7a06d220c0ec111), W(0x576d989cf6c15923), W(0x418def4cfed2506b),
+     W(0x00000000177c2544)},
+    {W(0x78f73bc16f60cb04), W(0x0c821482aa06b166), W(0x1a7563f47594499b),
+     W(0x000000001fd27a5f)},
+    0
+  },
+  {
+    {W(0x4fbb30f80c19a5e3), W(0x5fb748703b08857b), W(0x725921ba71ea7a4a),
+     W(0x000000008b3c2fab)},
+    {W(0x61f89e53a8641261), W(0x654ab96b667679eb), W(0xffd42d563930cd03),
+     W(0x000000006dc5a3d8)},
+    0
+  },
+  {
+    {W(0x0c2c98d17a511c68), W(0x6ef5c5603d2ae8ed), W(0x9d66d2572014d491),
+     W(0x00000000e1c67275)},
+    {W(0x22f7961cfd32304f), W(0x5126f992a66c63c1), W(0xa7f65b1d8c45d721),
+     W(0x000000005067c8ad)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa72d343bca8e1890), W(0x07464235006aff79), W(0x136d5ba51ec739c9),
+     W(0x00000000ce9ce64b)},
+    {W(0xb11ea220721071fb), W(0xfb7789dc7bfe943d), W(0xac86bd3f57dad905),
+     W(0x000000005eeba8a6)},
+    0
+  },
+  {
+    {W(0xb0b49013ac243d83), W(0x6bbaa79031f50c04), W(0x1d543cecd8fab554),
+     W(0x000000002fb0a285)},
+    {W(0x3256cf6915602d83), W(0x4a5d9d40f3bd35dd), W(0x7dff3a008a264f24),
+     W(0x0000000024830923)},
+    0
+  },
+  {
+    {W(0x3267fa614400cf66), W(0xfe3437417dfb1e52), W(0x552bcdda34e86055),
+     W(0x00000000131f5b56)},
+    {W(0x40256e8c6065029d), W(0x6fac416761212776), W(0xbba74ace3807bd7c),
+     W(0x00000000a2ce6ab3)},
+    0
+  },
+  {
+    {W(0xfd51954f954e93a7), W(0xbe73a498d0706483), W(0x45e8a87b89215ea5),
+     W(0x00000000f3cf4080)},
+    {W(0x85c8552dcdccb303), W(0xdb8ab95109212e02), W(0x19c8db3910c2badf),
+     W(0x000000007b08661c)},
+    0
+  },
+  {
+    {W(0x9e15fa46dafc0f6f), W(0x89a68d97148c6f0e), W(0x4cc0f2bbdb00031e),
+     W(0x00000000c3df9d3a)},
+    {W(0x1ff47bb7340e9460), W(0x7ef8908d620b581f), W(0x4277ac9d57588030),
+     W(0x00000000fc122be2)},
+    0
+  },
+  {
+    {W(0x1336d2ba5631310d), W(0x039396d8cd5bed69), W(0xac1f77dcedd85963),
+     W(0x00000000ea62aa43)},
+    {W(0xf970f80140cf73fd), W(0x7927be4625fc53f3), W(0x9f9753ccf9d1654e),
+     W(0x00000000b61c3720)},
+    0
+  },
+  {
+    {W(0x96dca6f71f400c41), W(0x295855476461f973), W(0xb90ca0df1f57a9e0),
+     W(0x00000000b010f7d3)},
+    {W(0x21188094d1cf0605), W(0xcfd8c7abf21e0d4d), W(0xde0d0f245f3468a5),
+     W(0x000000004e99f334)},
+    0
+  },
+  {
+    {W(0x70d9012f0e472341), W(0x876213ff7c2bf741), W(0xb309c07a47c7e115),
+     W(0x00000000977513df)},
+    {W(0xbe1ac3e87682fd32), W(0x1c6b708ab7e947d5), W(0x41e0c22009c3181e),
+     W(0x000000008b26dfc1)},
+    0
+  },
+  {
+    {W(0xfa3323204c02bbfb), W(0x1dd657b9bb0f1fc0), W(0x784ebda568034aed),
+     W(0x0000000058fb05ab)},
+    {W(0x32cca1fc0677d37f), W(0x2c9407c683e2269c), W(0x33fa100fea0312b9),
+     W(0x000000001761c87e)},
+    0
+  },
+  {
+    {W(0xf4f00cb540a8cd2a), W(0x05e2b3e058c8e52b), W(0x5593b9ee99489e99),
+     W(0x000000007924f02b)},
+    {W(0x0334e2ed464ae656), W(0x55ec8d2c2a2bf206), W(0xa7b0820941ac277d),
+     W(0x000000000c5c176d)},
+    0
+  },
+  {
+    {W(0x1aabcb3f3ac595c7), W(0x93706f441450434d), W(0x0e6c721ccf82a49f),
+     W(0x00000000ec192907)},
+    {W(0xfecc2ffd92676891), W(0xc8f49751451e72f3), W(0xe8852ddc81bf062a),
+     W(0x00000000f84db443)},
+    0
+  },
+  {
+    {W(0x32a2e886b1dfeb18), W(0x074b98988b6ac261), W(0x1ea4ca4c3c40d7a6),
+     W(0x00000000f7653f1d)},
+    {W(0x2b2347ff6940eab6), W(0xca0ffd5956338adb), W(0x8e442705314b0e58),
+     W(0x0000000079527139)},
+    0
+  },
+  {
+    {W(0xd63c1700be4dbd9f), W(0x9b252cda1101a669), W(0x501cc189d06390a9),
+     W(0x000000000fb428cd)},
+    {W(0x0a3108aa8dcdeb0d), W(0x71a44ce547aa9e0e), W(0xe86804cc9c9d8b17),
+     W(0x0000000061ad5482)},
+    0
+  },
+  {
+    {W(0x4432954ffe987606), W(0x4d668855ebe782ea), W(0xf9379d6a11e7dc71),
+     W(0x00000000fb5f9f2d)},
+    {W(0x98c8071eebb7e729), W(0x23ed50173aaef819), W(0x0cd970393d2ba5a3),
+     W(0x000000002ceebe22)},
+    0
+  },
+  {
+    {W(0x6646c443f7bd7afe), W(0x242cedcec3bd60cf), W(0x5e74dbe87c4048fa),
+     W(0x00000000d29b1f65)},
+    {W(0x91eb1130c5c513c7), W(0x9edbdaddbb7b08f7), W(0x6e37d0fb3c5f214f),
+     W(0x0000000085ea7863)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x87af66ad46abff2c), W(0x6dfaf22426b2f70c), W(0xf84408cd5494f6a8),
+     W(0x00000000a24b6575)},
+    {W(0xfb2baa35b3e6fa13), W(0x48b82a517fdee2e4), W(0xd231d3ab82709ae1),
+     W(0x000000008897d9e8)},
+    0
+  },
+  {
+    {W(0x6aa0f607bfc94c0f), W(0x4123775a0cbee27c), W(0xbbef8dbbae1d1601),
+     W(0x00000000e7149786)},
+    {W(0xbe686d03f56932af), W(0x3e33d4ba91ce3c48), W(0xa72c8f853d6535b6),
+     W(0x000000002c9fb75e)},
+    0
+  },
+  {
+    {W(0x1db377d9cf1bb365), W(0x8b74ddb863e01d3e), W(0x6bb31b8b8c9ad4b9),
+     W(0x000000002b26fec2)},
+    {W(0xfeaf9d41858449ed), W(0x700223fbe2652b65), W(0xee2505a903b48402),
+     W(0x000000002438e370)},
+    0
+  },
+  {
+    {W(0xe10a7afc2576d875), W(0x411dab1f0a9b3e69), W(0x046cc610f0719c41),
+     W(0x000000009d1611b2)},
+    {W(0x6b7a1ff01ba334cc), W(0x47e8a2e524d9cfba), W(0xa740e80a5bd30854),
+     W(0x000000001159e67f)},
+    0
+  },
+  {
+    {W(0xcbc5f1f61f29a3fb), W(0xd8f274a0344f8fc8), W(0xdda47efdc4a29771),
+     W(0x00000000463e0599)},
+    {W(0x2a29abde6ee7a7a7), W(0x63931e00145b94b5), W(0x805c1db4e92df244),
+     W(0x00000000f904d9e2)},
+    0
+  },
+  {
+    {W(0x48f55927014a8dd3), W(0x6a0036325257b742), W(0xbafd43817c569d78),
+     W(0x000000003bf2d7c4)},
+    {W(0x8c93253adb00a9b4), W(0x01abe1d2c8733a7e), W(0x68216416c3dc4e3e),
+     W(0x00000000fd38cc81)},
+    0
+  },
+  {
+    {W(0xa9b037286ff7ffaf), W(0x9bf1de83ed9bae60), W(0x8eab46c846ffca99),
+     W(0x00000000f59d74f4)},
+    {W(0xc33511d5621ce75a), W(0x208aba6f102b6d06), W(0x6fc839749f7de28f),
+     W(0x00000000644a522a)},
+    0
+  },
+  {
+    {W(0x5898fc387c2ca549), W(0xa757b52ea3566efe), W(0x91ab431624bb02bf),
+     W(0x0000000000e46ee0)},
+    {W(0x8c02881c9ec42857), W(0xb9a285401d20ad25), W(0x40d6ae86b01ce79f),
+     W(0x0000000040b2c06e)},
+    0
+  },
+  {
+    {W(0x10684afb9a1c12d0), W(0xc375dcda666e399d), W(0x49281fee5aba3a6e),
+     W(0x00000000ec9b4f71)},
+    {W(0xaee1ea33e3c7787d), W(0x4fcf7bbc4eb2cc90), W(0xb3aa40791f8584cb),
+     W(0x00000000a91e4b4d)},
+    0
+  },
+  {
+    {W(0x3a162055e9d7fcf6), W(0xde746e241c83cc8d), W(0xe470860c22fff151),
+     W(0x00000000f59ac1b9)},
+    {W(0xb66b69037d830142), W(0x006a6d2e4e62945d), W(0x522cb545364c21f6),
+     W(0x00000000aa404038)},
+    0
+  },
+  {
+    {W(0xabbffd88bc2e9d41), W(0x1742f7ee2719af9e), W(0xcd01c562fc7908d7),
+     W(0x00000000fea825b8)},
+    {W(0xb21daa3af08391c2), W(0x4c6da1efe00da389), W(0x6558f6a796daa181),
+     W(0x0000000068597a31)},
+    0
+  },
+  {
+    {W(0x1d8cdb7dee477507), W(0x9aa8bdd80f5d39c7), W(0xba3afec5df8a463d),
+     W(0x00000000a2d18f37)},
+    {W(0x339543183e8b12fe), W(0x7810c66b29400a05), W(0x7f1948ffae2fd3ad),
+     W(0x00000000a4b4097d)},
+    0
+  },
+  {
+    {W(0x3b690abbc8a0450a), W(0xe700bb03d33c167a), W(0x6d575f5ab4597c05),
+     W(0x00000000856f44c0)},
+    {W(0x79c7f8d41044577a), W(0xb75098425e9347af), W(0xaa60532c372678e3),
+     W(0x000000009b6f913a)},
+    0
+  },
+  {
+    {W(0xa5f48e4b700c60b5), W(0xa819974bc4776f78), W(0x67cdbcf9118c5baf),
+     W(0x0000000058397aa1)},
+    {W(0x079ca703e2900bf4), W(0x48b08061913807ce), W(0xa9354dffa4e288c7),
+     W(0x000000009da292f7)},
+    0
+  },
+  {
+    {W(0x6feabf1b710da4b6), W(0x15d618e52bb6c4f8), W(0xe54c518485f8ead8),
+     W(0x00000000d655840f)},
+    {W(0x218cc27eefd7c0e7), W(0x457792f62484da60), W(0x7597b1d75cacc293),
+     W(0x0000000087987504)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x259779c54fd7f402), W(0x3aa4fd10afc1d993), W(0x77170d3286dcdc83),
+     W(0x000000008441f4f3)},
+    {W(0x46144a819892b126), W(0xc654996358df739b), W(0x01761502344ddb0c),
+     W(0x00000000d9bcbeb6)},
+    0
+  },
+  {
+    {W(0x1bb01e23746fcfe2), W(0x38352329dc5e2b63), W(0x68e597b55df11c5b),
+     W(0x0000000044ec319c)},
+    {W(0x0e27f5b084b36d32), W(0x06c3753de5706d53), W(0xa7111b5de67b3281),
+     W(0x000000008fa5ee02)},
+    0
+  },
+  {
+    {W(0xda91cf48c2eb5b9f), W(0x821b171bdb33cda7), W(0x489cbfa3006b3e24),
+     W(0x000000004461fe49)},
+    {W(0x4d93f4e1c4e7389d), W(0xf28f63e5fe8e5310), W(0x94deaf7cf3d0d29d),
+     W(0x000000003d33e2ad)},
+    0
+  },
+  {
+    {W(0x436d6b94e415829a), W(0x541c7bda794d49e6), W(0x5afaacb1702ede17),
+     W(0x000000003b5ca68c)},
+    {W(0x9ca7b73fc9496ea8), W(0xc5ce627a50a1e66e), W(0xc90185b1762e4f6f),
+     W(0x000000006705418b)},
+    0
+  },
+  {
+    {W(0x5330a9792458c92b), W(0xdba786fa77ea9ee9), W(0xae5f476ace00962f),
+     W(0x0000000005915824)},
+    {W(0x8cdf03001219b9cd), W(0xdc707120660a19e4), W(0xfdd0563dc70e0b11),
+     W(0x0000000041d445a6)},
+    0
+  },
+  {
+    {W(0x2d7e46eb6a28fa6b), W(0x1ae23996034b69ed), W(0x3c25755a51bc6b67),
+     W(0x00000000e9bf6717)},
+    {W(0x06b03b1f579d75fc), W(0xe0b2026ffc3e6ce3), W(0x58938357723756d9),
+     W(0x00000000b4731ae9)},
+    0
+  },
+  {
+    {W(0x58182a194fe2181c), W(0x0c4b58a327b6bd7a), W(0xd4f2f0981c72e55a),
+     W(0x000000006b53e542)},
+    {W(0xb5e110220bdee531), W(0xa8bb8315a8f7b191), W(0xbdf84150e62460d4),
+     W(0x0000000074ea071f)},
+    0
+  },
+  {
+    {W(0x8e5770781d2f288c), W(0x8ebb1ef68e833532), W(0xf5ead3c9fb9fbcd0),
+     W(0x00000000e31f0c20)},
+    {W(0xc462ce8bf16fa294), W(0xc10686456466c045), W(0x3e1abc0385e7447b),
+     W(0x00000000bba798a0)},
+    0
+  },
+  {
+    {W(0x616ee9791ea96169), W(0x60b3f06d78257a1a), W(0x609d2d2dec98f98d),
+     W(0x00000000d1b3e514)},
+    {W(0x2e59e2321100f9ce), W(0x34e1a9a48087f780), W(0x95c2865d0b40b853),
+     W(0x000000008fa97627)},
+    0
+  },
+  {
+    {W(0xf1766b07db26dfa2), W(0x050e85e5dfd72d39), W(0x59466485ad6b741f),
+     W(0x000000005fceaf74)},
+    {W(0x0c6b2254bc9edaeb), W(0xfca1477c453c9eae), W(0xa38171669c00d050),
+     W(0x00000000a87cf553)},
+    0
+  },
+  {
+    {W(0x4c0dcf94c173f9cf), W(0x61d12afbcc4c491e), W(0x12a6c289fa790f55),
+     W(0x0000000037abf7be)},
+    {W(0xcb586fd2d04d2ae3), W(0x3c04c5b4192166df), W(0xbba9c7687ee1f233),
+     W(0x00000000b69b46cc)},
+    0
+  },
+  {
+    {W(0x6b581764463d181b), W(0xa9bac44fc440084f), W(0xf0d004bb088767cd),
+     W(0x0000000094e1ba30)},
+    {W(0xa1a1841255abae1e), W(0x6d71f955a732c539), W(0x3608f75d896710ea),
+     W(0x00000000a067bb07)},
+    0
+  },
+  {
+    {W(0x4e2d8d4c58ee2dea), W(0x8042631ee6546299), W(0x2df96d37262d0cb2),
+     W(0x00000000349292cc)},
+    {W(0x2fddedd304a3c0d5), W(0xd5418050452a0a52), W(0xc60538612293a069),
+     W(0x00000000fe3040eb)},
+    0
+  },
+  {
+    {W(0x4ee2bac62036fb32), W(0xce8c9892c62978b5), W(0x56d307230ee684b9),
+     W(0x00000000b8993d5e)},
+    {W(0xfc1727552fee5c92), W(0x43c48f91c8622a7c), W(0x78cfee0e4279a0bd),
+     W(0x000000003826553c)},
+    0
+  },
+  {
+    {W(0xb55799e4d0327c5a), W(0x7408bf29f145e8f9), W(0x4580043d97e6d3d7),
+     W(0x000000005f599a51)},
+    {W(0x38414d94517f2eda), W(0x37f611a1e09d35b1), W(0xce07329031551461),
+     W(0x000000001044bab9)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbc19767ba374b8d9), W(0xa97161c13ed7db29), W(0x45c30a38cc843c60),
+     W(0x00000000508e3e86)},
+    {W(0x1457fcb6433b6dbe), W(0xed4ed464d8c78825), W(0x2b88e6d2c3997703),
+     W(0x00000000a1f2140c)},
+    0
+  },
+  {
+    {W(0xc1e32f38e74fffdd), W(0xf9561e97d93030cb), W(0x39bbca3615f3f603),
+     W(0x0000000090c8c914)},
+    {W(0xa53fc6813734c1a1), W(0x158ec0bbb0c4475f), W(0xa57cf95ced39d189),
+     W(0x00000000d562a81e)},
+    0
+  },
+  {
+    {W(0x73bdb8f93749cd29), W(0xf86faf9467a951ec), W(0x4fc2d141e19a8052),
+     W(0x000000001183daf4)},
+    {W(0x6d07a6d13d4b1eba), W(0x30d8e6494762c700), W(0x502ad057733e1433),
+     W(0x00000000e0440364)},
+    0
+  },
+  {
+    {W(0x02c6b6795cfdbf76), W(0x8195dc3aace24453), W(0xbe2f8e64a58b929b),
+     W(0x000000009a3a7efb)},
+    {W(0x7fa4b0429f7af479), W(0xb747bbcf8ad04303), W(0xa67998c5426eb7ce),
+     W(0x00000000db040e40)},
+    0
+  },
+  {
+    {W(0xbff47d0326005ced), W(0xf559caa7cc1c64e3), W(0x66447786768c52e8),
+     W(0x0000000081a090a0)},
+    {W(0x987b444fc97f77eb), W(0x22ee89aeedaa102f), W(0x9e4a95097ff25cc6),
+     W(0x000000003c1b963a)},
+    0
+  },
+  {
+    {W(0x8c4b7a2f9fe32da8), W(0xec307545df98de16), W(0x0341cba5fcd362d8),
+     W(0x000000005bbf03c7)},
+    {W(0x977d0c85e8bf3b32), W(0x430760959b0fa3a0), W(0x74ba2a975e52dd5a),
+     W(0x0000000043bbf8eb)},
+    0
+  },
+  {
+    {W(0x9fe9d84acdaff08b), W(0x6dca0765659b7b2c), W(0xc449765bd19f7d56),
+     W(0x000000006449fa74)},
+    {W(0xe49f8fbc428f9011), W(0x9092fb33830ed28d), W(0xa6daf46e3bb04fc2),
+     W(0x00000000fe1bd2f3)},
+    0
+  },
+  {
+    {W(0x3bfd76b27d551504), W(0xa3a2cf8c0361658a), W(0x66db4cfaa3b9f1bd),
+     W(0x000000004799c86b)},
+    {W(0x01c04fa027afe24e), W(0xaa0383bc0689618b), W(0x524802bb5b052124),
+     W(0x0000000025748110)},
+    0
+  },
+  {
+    {W(0x9500be252f2b1f26), W(0x530b02ae5b66719c), W(0x72271ff91f719649),
+     W(0x000000000ed5cd46)},
+    {W(0x65a465eb221428cc), W(0x61ca69785a97cb2e), W(0x6dd17d8a303d263a),
+     W(0x00000000e636a1d8)},
+    0
+  },
+  {
+    {W(0x6485b1b4e25e2789), W(0xa806b8ea342e8b43), W(0xcf7fd6e220245c7b),
+     W(0x000000003f62c94b)},
+    {W(0x3b42eea95702193d), W(0x78e01b3b7b1f3070), W(0x4c778cfae835f793),
+     W(0x0000000042635486)},
+    0
+  },
+  {
+    {W(0x98428ef3aae83d97), W(0x0b1be2a148a0f0b7), W(0x0f753f3b859b794c),
+     W(0x00000000366807f7)},
+    {W(0x45a2ed30b11dc43c), W(0x3bc730941f50486d), W(0xb92afe058cc7c820),
+     W(0x00000000f103c59d)},
+    0
+  },
+  {
+    {W(0xb542168afd9c3522), W(0x435f3e05f1dd3dc0), W(0xf3b21a793556cca8),
+     W(0x000000000d1838e7)},
+    {W(0xbbfa360f0a1d87d1), W(0xdcacc27743bd0f7a), W(0xa293f5a9fdb15d31),
+     W(0x00000000f9285692)},
+    0
+  },
+  {
+    {W(0x15f60df18f678d0c), W(0x9dd7d5b6f3478a7b), W(0x4c6b3672fb90e174),
+     W(0x0000000054d08d86)},
+    {W(0x5716ccec421e9415), W(0xe8fda00537ba57ca), W(0xdd0ca79ac2b5d986),
+     W(0x00000000405949b6)},
+    0
+  },
+  {
+    {W(0x19b2d81773d63406), W(0x06d158413300faa4), W(0x74867b9d448c5591),
+     W(0x0000000063849d8d)},
+    {W(0x4855d32771aac423), W(0x7805596715c0eca8), W(0xf9c25ecf01ce9614),
+     W(0x00000000fd6cec16)},
+    0
+  },
+  {
+    {W(0x6146e8e9f19f5408), W(0x06114da346ffbd1c), W(0xa72a1aeae33e2a4e),
+     W(0x00000000f532b902)},
+    {W(0xd976b788dd5755e6), W(0x4a7e0591ca96d561), W(0xbe931f67d031d294),
+     W(0x00000000799de4e6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x7da35372960b1fe7), W(0xb15275caefe3b9e7), W(0x9c0da2e308b0fe30),
+     W(0x00000000cef9bd5d)},
+    {W(0x087c3eeafc9156e7), W(0x13e948764386ea9f), W(0x057ad0af5543dce0),
+     W(0x00000000c5162840)},
+    0
+  },
+  {
+    {W(0x163c66e0c4755991), W(0xdd950bf5849061a0), W(0x7bf9525770208a9e),
+     W(0x0000000007a10de2)},
+    {W(0x45c2891ab0813c25), W(0x450f087f15468f60), W(0x387e234b73d5ebe9),
+     W(0x00000000a32ac9f8)},
+    0
+  },
+  {
+    {W(0x482c36791bdc3884), W(0x6f172c006b421466), W(0x2587649fa58b570f),
+     W(0x000000003e4ee4bd)},
+    {W(0xf5a1388aef99f5b4), W(0x5a8f54da98494de5), W(0x50e9cc728f25a37c),
+     W(0x000000001ce8e0f0)},
+    0
+  },
+  {
+    {W(0x612650a13a2c7153), W(0x72e7ea2bc29b399c), W(0x60425f21d673cbc5),
+     W(0x00000000ece9a8ea)},
+    {W(0x394b09ddfd08bc21), W(0x58e594d51b69fef5), W(0xeab0baec141fc2ff),
+     W(0x0000000085999248)},
+    0
+  },
+  {
+    {W(0x58625a1a370622e3), W(0xe2d5d70aea895fc8), W(0x53bc48b9cac0e4d3),
+     W(0x000000001d43df08)},
+    {W(0xee75a210681301c8), W(0x097c56b0e1a8bb95), W(0x4a384a6d7e7b6ce5),
+     W(0x0000000026d0db83)},
+    0
+  },
+  {
+    {W(0x495ac57587b49d63), W(0xb50a81156bf10350), W(0x90ac41f92674f39c),
+     W(0x00000000aedc843c)},
+    {W(0x60ca4b9c20e79ef7), W(0x67e854832b7ba708), W(0x2e4b0764c070ae10),
+     W(0x000000000c3aa1f7)},
+    0
+  },
+  {
+    {W(0x776f7b1a252fb3dd), W(0xb6f63fd92b058af6), W(0xb0461b360d06abe2),
+     W(0x0000000090f6c358)},
+    {W(0x9a72e4385c9d58a0), W(0xce59656924e0b184), W(0x5f6753e56facf219),
+     W(0x000000005f23a218)},
+    0
+  },
+  {
+    {W(0x233ddda469260167), W(0x055176b1bce451f2), W(0x33fc9573e21ca9dd),
+     W(0x00000000608477ee)},
+    {W(0x37f4a8b6b1111c08), W(0x60c86d482f253ba7), W(0x3ae7c4bbec1f4a44),
+     W(0x000000001c649260)},
+    0
+  },
+  {
+    {W(0x5162797e3b33cd4c), W(0x6fc60b78a87e9702), W(0xe2a31c192ab93ff3),
+     W(0x000000004288abf4)},
+    {W(0x80be51bb297e2ccf), W(0x058de4bc388680ed), W(0x7da1a8298dedbe92),
+     W(0x00000000bffcb08c)},
+    0
+  },
+  {
+    {W(0x550c3e8265c70a3a), W(0x40b9aa3e448361bb), W(0x41969a52feab6ae4),
+     W(0x0000000074461138)},
+    {W(0x47381f1837a53426), W(0xd6e199e32be030b8), W(0x4da4cd53b091abda),
+     W(0x000000007df8f1e3)},
+    0
+  },
+  {
+    {W(0x39bd0099f5833d2b), W(0x886d33b3b0ef3648), W(0x97226670c1936e74),
+     W(0x000000003eb64bfc)},
+    {W(0xfa065545408e784b), W(0x962468326cb29cd8), W(0x6b24b9f4010fbc36),
+     W(0x0000000072e08b5c)},
+    0
+  },
+  {
+    {W(0x3d1be5ab85de6fe5), W(0xf11ef92662509881), W(0x244caa0565d5f607),
+     W(0x00000000c38d7540)},
+    {W(0x0b239ba6c1a149a8), W(0x53224bb319b8e994), W(0xd2cd0a341f25f647),
+     W(0x000000007f481820)},
+    0
+  },
+  {
+    {W(0x4b407e59cb87940a), W(0xa05e3d79844408fa), W(0x0751f86d742669b3),
+     W(0x00000000b00b365a)},
+    {W(0x3a8360fb7860c6e5), W(0x10209a6b4147cefc), W(0x7a7f62310393026e),
+     W(0x000000002e39fa34)},
+    0
+  },
+  {
+    {W(0x3221832ca6d64780), W(0x3dbd0cb98fc6ce6c), W(0x9cdf65d96582853a),
+     W(0x00000000708e9258)},
+    {W(0x273611ecf6bfe6cf), W(0xa78d98b3ef43a507), W(0x88f8462486406043),
+     W(0x000000004396769b)},
+    0
+  },
+  {
+    {W(0x65ddd79a8b2767f2), W(0x9ab0776134988e35), W(0x814a0e96d93aac10),
+     W(0x0000000076ec0b96)},
+    {W(0xe6639b9a802069a0), W(0x23a6da3d9143cd9d), W(0x77b915d6fb9b096c),
+     W(0x000000004353464a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xaf8f400d085dbc17), W(0x93399c4a2a94dc1a), W(0x370e4c06f8d2e936),
+     W(0x00000000ca35bd61)},
+    {W(0x2c1682bc0fb73083), W(0x4742b84d00b6e1a8), W(0x9bb1736d6d92e1f4),
+     W(0x000000003e9b6293)},
+    0
+  },
+  {
+    {W(0x6c35afbc2a85b5cc), W(0xb02b80b7f6f30e96), W(0x4dd8bbbe669a8252),
+     W(0x00000000b9b1b311)},
+    {W(0xbbcbf46b28535ef6), W(0x20d09a27e4d59c99), W(0x877172dc63242255),
+     W(0x00000000853f9c6a)},
+    0
+  },
+  {
+    {W(0x098ed9f466160475), W(0xcd03c2a62b5cc27d), W(0xea55ca5d93a47e38),
+     W(0x00000000cb5d6d88)},
+    {W(0x33c38d69730b1e82), W(0x5fc82fe400d8c2cb), W(0x2a78dd118e23d6eb),
+     W(0x00000000e1d2add5)},
+    0
+  },
+  {
+    {W(0xd5de71e9432984a1), W(0xb421581fe7f42edd), W(0xc8c4ee600b9c53bf),
+     W(0x0000000082b1e37e)},
+    {W(0x4a10fc2951492ea8), W(0x69016e9c7502a8c1), W(0xcd3e05272dc30077),
+     W(0x000000002e0b7f76)},
+    0
+  },
+  {
+    {W(0xf3fba81a0b71ae2d), W(0x9a6e1039a00fafc3), W(0x19d43510bd5540da),
+     W(0x00000000fd8ebce3)},
+    {W(0x5a29656059478902), W(0xbcd2c8b49246ae48), W(0x03a6a2e18ae847e6),
+     W(0x00000000f8d3a890)},
+    0
+  },
+  {
+    {W(0xc21b4aab161f4880), W(0x44db3fe095f715ce), W(0xdb4528e5ff0073cd),
+     W(0x00000000dbc69fc1)},
+    {W(0x8bfc41015161785c), W(0x22e31d16e2c44c67), W(0x1b45072ca7624b31),
+     W(0x00000000ebf2704a)},
+    0
+  },
+  {
+    {W(0xa5c35a0417fe5bf9), W(0x346a0aa09b6ecd7d), W(0x8eff670112cd6a34),
+     W(0x000000001f49baae)},
+    {W(0x133a8b99764608e0), W(0xb242b806bd0b9808), W(0x2c37aca0c50671f5),
+     W(0x0000000044e6ac16)},
+    0
+  },
+  {
+    {W(0x540d3ef9fd1ff163), W(0xd48da416e3c8a7e4), W(0xccac1ee539e285d6),
+     W(0x000000008d098605)},
+    {W(0xaae2485c09862475), W(0x4df1fb56424cb101), W(0xe045acd6d81ebf03),
+     W(0x00000000ec4b922d)},
+    0
+  },
+  {
+    {W(0xf98f3b05cb8747df), W(0x62a8b3b68e40279f), W(0x812f1995c8c8b3c0),
+     W(0x000000001452cacb)},
+    {W(0x4896d9ba5565eb87), W(0x7f61eae4e1cb7d2c), W(0x44909d11ca0d73d5),
+     W(0x00000000e887e830)},
+    0
+  },
+  {
+    {W(0xe3ace3b33fbc727e), W(0x39644794fb5f0701), W(0x25904a791534cde5),
+     W(0x00000000f9421b0d)},
+    {W(0x0528f7cad3275fa8), W(0xdea09c8b8a9c39d8), W(0x458a7c5fdd383932),
+     W(0x00000000baf06aaf)},
+    0
+  },
+  {
+    {W(0xd03be412cdcb37e6), W(0xf8986b2f1dd343cd), W(0xf9001ffd436866ad),
+     W(0x00000000a3d9d5f8)},
+    {W(0xa7cdffe3f3e817da), W(0x5370523a8b543d6b), W(0x12ccc91ed0674275),
+     W(0x00000000189f8da4)},
+    0
+  },
+  {
+    {W(0x193b780b1adf0fac), W(0x5042f2da5abd6eef), W(0x06442ef6d76b78fd),
+     W(0x000000000cdf9e58)},
+    {W(0x8a5c2657fef055d2), W(0x0bf16e33fae0a442), W(0xb5adbc986c2b778b),
+     W(0x00000000f374d05a)},
+    0
+  },
+  {
+    {W(0x19ef339020e53884), W(0x3fe3b827de76a7b6), W(0xe30c5cb7c6920538),
+     W(0x00000000f4ce09ad)},
+    {W(0x5ef2fec93b2c36f7), W(0xd339eeeaad3dbb7e), W(0xb38f3864cebd81d5),
+     W(0x00000000e9dc07ef)},
+    0
+  },
+  {
+    {W(0x0c6f4ae2846ef971), W(0xd2466841b657d5f6), W(0x70a6775eabf1920f),
+     W(0x0000000015909e3c)},
+    {W(0xe0c73f43cede3a4d), W(0x15282f23563843f3), W(0x2e80308de15912d0),
+     W(0x00000000d16c8835)},
+    0
+  },
+  {
+    {W(0x34fbec4b2a067974), W(0x2704afe70d8409fd), W(0x4a771c133258c60e),
+     W(0x0000000057d1f256)},
+    {W(0xc2119dfb6b4ed3bf), W(0xbe47b3ebb4a46832), W(0x1457989a1dcff201),
+     W(0x0000000063297125)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb00d2849767329dd), W(0x10d3971196ae8e24), W(0x4ed443bf118cc563),
+     W(0x000000009157acc3)},
+    {W(0x14b54c12755122ae), W(0x4fd8769207d6ccc1), W(0xf50f2de305ec4685),
+     W(0x000000001a923061)},
+    0
+  },
+  {
+    {W(0x11277d6966e2227a), W(0x5181f585d9cc122b), W(0x2cbd87e43f2ab21d),
+     W(0x00000000494cfb1e)},
+    {W(0xae7bbb8fd57e150f), W(0xee6852519977c3ac), W(0xb224446c397ea438),
+     W(0x000000007ed9dec7)},
+    0
+  },
+  {
+    {W(0xc94659b0dcff0296), W(0x39aab1642f0568f5), W(0x50d8c266ed8a79a8),
+     W(0x00000000757c7d99)},
+    {W(0x66c509e44445c1ec), W(0x70d28954b792533a), W(0x34caeea99e0c5aad),
+     W(0x00000000e5b193ca)},
+    0
+  },
+  {
+    {W(0xae9bd277649e4b51), W(0x4268b40c6c678048), W(0xae4a71b152da3782),
+     W(0x000000001e1cd89e)},
+    {W(0x2f691fc64f079bbd), W(0xfe5d33d3f69884c3), W(0xdda1c48319020a41),
+     W(0x0000000077d02be4)},
+    0
+  },
+  {
+    {W(0xa293c1cfb4f60ac0), W(0x3ce2558998d81eae), W(0xf7776c884a05fd65),
+     W(0x0000000031edd830)},
+    {W(0x6b0037417102bdbe), W(0x619c469b530442c5), W(0x993316f52717506f),
+     W(0x00000000977de534)},
+    0
+  },
+  {
+    {W(0xd7c8b168856e9dad), W(0x034f792d94661f99), W(0x5e1f223f968a0514),
+     W(0x00000000f2936613)},
+    {W(0xf109d7479468ee68), W(0x35d5c3678c1958b8), W(0x58b0e5bdd1baaa07),
+     W(0x0000000004265560)},
+    0
+  },
+  {
+    {W(0x8a38d900c07ee494), W(0xd40347a215f78485), W(0xdc40308340936fbc),
+     W(0x0000000026d9bf80)},
+    {W(0x6682494a87df50e9), W(0x88a94156658eecc3), W(0xf4a7dc3be2c9cc47),
+     W(0x000000006742c074)},
+    0
+  },
+  {
+    {W(0x3c293b4fb759588a), W(0xccc60f4b50ebe82c), W(0x9c0164e0e5c199da),
+     W(0x0000000009ae68d1)},
+    {W(0xe57a6b34dbb33342), W(0x71131364764aa682), W(0xc37e19f6d2b124d2),
+     W(0x000000000684de69)},
+    0
+  },
+  {
+    {W(0x395994b8143516ae), W(0x7ff29028420d2244), W(0x4842f0391329a508),
+     W(0x00000000d438cc67)},
+    {W(0x6b172560322e6e1e), W(0x620a9175db822997), W(0x2a0b5253fc6f74c4),
+     W(0x00000000246340fe)},
+    0
+  },
+  {
+    {W(0x78d13bc425cd6009), W(0x0caf9c1bbef3c86c), W(0x5775ca5261b79b27),
+     W(0x000000002b6d0cde)},
+    {W(0x4b223923792f94a7), W(0xa9fb052d1b5f0ca6), W(0xe8acc3c451ca9759),
+     W(0x0000000094e1c364)},
+    0
+  },
+  {
+    {W(0xa04c5892b82f02f1), W(0x5031151480195bb9), W(0x20ae7a5fcb6607a1),
+     W(0x00000000cc71b38f)},
+    {W(0xf360a6bc181caec0), W(0x463e07341aacded9), W(0x813ce75cc9383f3e),
+     W(0x00000000c363cdec)},
+    0
+  },
+  {
+    {W(0x290611a85aab309f), W(0x074075bacb02fd39), W(0x179a9e2b22966bc6),
+     W(0x000000003e76713f)},
+    {W(0xe6b4ef04b8723f39), W(0x3c623eb7cadc7901), W(0xb82729fb1c17e023),
+     W(0x00000000fdc5c02e)},
+    0
+  },
+  {
+    {W(0x12b6ecad1f23ab33), W(0x2703852419bd8dc1), W(0xdd782163b3a647f2),
+     W(0x000000007393d8c7)},
+    {W(0x7d7ad1480e812fb6), W(0x70f69cb9087d38cc), W(0x36eae9ede837f617),
+     W(0x000000008983ab9d)},
+    0
+  },
+  {
+    {W(0x6829e17149e95ce6), W(0x30064be1fa0f0ebf), W(0x8dcc19608629a904),
+     W(0x00000000baccb6c7)},
+    {W(0xb96304b64ab40f9d), W(0x853a857ec8b2246a), W(0x014aaf3e0056f029),
+     W(0x00000000a9e542b0)},
+    0
+  },
+  {
+    {W(0x3c9a84d531d5a4df), W(0x2c6c4385a32078a8), W(0x6d66944612c95b9e),
+     W(0x000000001afe3e56)},
+    {W(0x4c1034238310918f), W(0x44c45d6e426f2bc6), W(0x23aa9dece5cc42b7),
+     W(0x00000000567b5fba)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3a2fc0ae2e5b54d1), W(0x810b88003a0ae219), W(0xeb53d99171d39325),
+     W(0x000000001b364d9f)},
+    {W(0xe634fa4bc225e922), W(0x48c1302dfa979c3b), W(0x7a46c4300315e213),
+     W(0x000000007d3dfc00)},
+    0
+  },
+  {
+    {W(0x69c6dab4f75af9f3), W(0xbd0a143fcad74055), W(0xf457bc615f980b30),
+     W(0x0000000008ab6cd4)},
+    {W(0x5a3b5bb9a472e295), W(0x1e6479464a0eec60), W(0xeb13a610a4e2c617),
+     W(0x00000000ea8ba726)},
+    0
+  },
+  {
+    {W(0x8208d95bb1f39e26), W(0xd33801fe1d126957), W(0x2b3db8bc38314570),
+     W(0x0000000068f43b86)},
+    {W(0x2fa1baa706523bb4), W(0x7b7200e3b3650b8b), W(0x5ab609c3222d46b5),
+     W(0x00000000e25b7f78)},
+    0
+  },
+  {
+    {W(0x2601c0c2f09c3b4a), W(0xb71c88f810c7e593), W(0x163a4b4fd433020b),
+     W(0x000000006ea15982)},
+    {W(0x559abf4bd7a199df), W(0x8c58a3fd168cc6db), W(0xcad8eab05e92d42d),
+     W(0x000000000f718cd3)},
+    0
+  },
+  {
+    {W(0x1eccb2dd5222ebab), W(0x6cca2e8f45eee5ae), W(0x93a2e216f0f806c3),
+     W(0x000000000b896b9f)},
+    {W(0x21ac6aa62753730f), W(0x93ff82bde860a374), W(0xc336e305a6d03d5f),
+     W(0x000000005a3ad08c)},
+    0
+  },
+  {
+    {W(0x7e65ba9705094bb6), W(0x69a96369927ff44f), W(0x8e5841d8cfc2ebd4),
+     W(0x00000000cd919ed2)},
+    {W(0xd72479fa7d67ba45), W(0xb458951df9079703), W(0x12b5f89b11b2590d),
+     W(0x000000009e78739c)},
+    0
+  },
+  {
+    {W(0x64971999b68ddf1d), W(0x0f78a155cc5dc1ba), W(0xbbfeebe2c7f1ee3f),
+     W(0x00000000a475b47a)},
+    {W(0xd00f3342ae6b1a67), W(0xcbc8eae8aa2739d6), W(0x084216386bcba57f),
+     W(0x00000000f50c5c89)},
+    0
+  },
+  {
+    {W(0x56ea720e21fce16e), W(0xb07c02a7c14eb574), W(0x1a141ce9e5e93b80),
+     W(0x00000000f206da59)},
+    {W(0xff6ca106400443af), W(0xe7e89a4185cacb30), W(0x73777848e54c35f6),
+     W(0x00000000eecb8a06)},
+    0
+  },
+  {
+    {W(0x27c35c5a27098970), W(0xd349579788bff7c0), W(0x84083f2a2aa31cbd),
+     W(0x00000000ee8007b7)},
+    {W(0x7c2ce5dbd736e6e1), W(0x7eccf31846d1faf9), W(0x7894ccc60d96af5f),
+     W(0x00000000143733e6)},
+    0
+  },
+  {
+    {W(0xf8d1a77938e5c20b), W(0x1407c96c74b4b8c0), W(0x0f677dc4aa226358),
+     W(0x00000000bce88332)},
+    {W(0xa1eff8f8ae06373b), W(0x46e8175d6f4d4505), W(0x1241400637fa6b50),
+     W(0x00000000078af83c)},
+    0
+  },
+  {
+    {W(0x6038786aaa9911e2), W(0x9ec4cf47043fa7bc), W(0xeeffb86e39594053),
+     W(0x00000000f30130d5)},
+    {W(0x8e9bddbb93573962), W(0xa5656b7e6b822690), W(0xf63c9eadfd18acdc),
+     W(0x00000000a29c50ef)},
+    0
+  },
+  {
+    {W(0x875129d87a68f812), W(0x43107ab723706eff), W(0x0f0278ce343d01b4),
+     W(0x00000000d1d2ff3f)},
+    {W(0x62e80eed947dc2e4), W(0xb237e73376f993b1), W(0xc6cb2916d8eb588f),
+     W(0x000000003e93bfcf)},
+    0
+  },
+  {
+    {W(0x40dc414f2323cfa1), W(0x81bf906402fc59aa), W(0x2f863790f4b7afef),
+     W(0x00000000df1eb2ce)},
+    {W(0xc2be20ad2da3a955), W(0x826e16e405119c9a), W(0x59ba9dd2a27da69d),
+     W(0x0000000050be3370)},
+    0
+  },
+  {
+    {W(0xe5b817ac702f4a30), W(0x732be8dd62b0b4a9), W(0x49eb11c00b744a18),
+     W(0x00000000db8066e2)},
+    {W(0x60bc3f3b61315a81), W(0xa033694a9db8094e), W(0xe5728d571a336970),
+     W(0x0000000098764bb8)},
+    0
+  },
+  {
+    {W(0x471336b0a31f05a5), W(0xe1b3c5c4c97e0c25), W(0xd00385b440016340),
+     W(0x000000008681b939)},
+    {W(0xfb0504e6f3dbd1c9), W(0xf84aaa64190db5e8), W(0x5e7d861273d7879b),
+     W(0x000000008f037a48)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb920e0894bb632f0), W(0x5fd26f9a81a11e46), W(0xd873ff38ad7ce91c),
+     W(0x00000000463f5eef)},
+    {W(0xa997a44ae973b348), W(0x7c4b4d9667e4b48b), W(0xc007a35a76b8b69f),
+     W(0x000000000ebb0cc7)},
+    0
+  },
+  {
+    {W(0x3259f50719d5d3aa), W(0xfaa534d08dd2cea1), W(0x964e43aab1de59c3),
+     W(0x00000000d9cd158a)},
+    {W(0xf7812a29b8fe9ccf), W(0x5a40b462483a8ca3), W(0xeafa2982f93b681f),
+     W(0x0000000022d0852e)},
+    0
+  },
+  {
+    {W(0x45934ad0ab519f43), W(0x0eda4d94a0a5bb1b), W(0x9f749e30bcff29b2),
+     W(0x000000002f73a7d6)},
+    {W(0x9ed5bbc82a833e74), W(0x83945e37111b6548), W(0x9b5681717b77f3f9),
+     W(0x00000000f1563350)},
+    0
+  },
+  {
+    {W(0x5898ed4e597adc60), W(0xa9c6e64f63896a2f), W(0x7134977682a0ed92),
+     W(0x0000000071b9b0ee)},
+    {W(0xd360630c216fc62a), W(0xa2285bdfbd440771), W(0x28e79328a49907da),
+     W(0x00000000ad498ec7)},
+    0
+  },
+  {
+    {W(0x8425931aefa756c6), W(0x041152d67ee21dd8), W(0xa53025173bd1871a),
+     W(0x00000000dad18e22)},
+    {W(0x10b5fa6efe7a7229), W(0x16173a145c5be6f9), W(0xb92d548d62d66386),
+     W(0x000000004b022086)},
+    0
+  },
+  {
+    {W(0x1af36a1187ddb335), W(0x41c1b2bae8007ca0), W(0x50c8cb1d30d45dfd),
+     W(0x0000000075a78816)},
+    {W(0x2106db853b6d8286), W(0xf9615d6dff67232f), W(0x5f7fc100bd179b41),
+     W(0x00000000e740fe26)},
+    0
+  },
+  {
+    {W(0x8e4737535c13eb99), W(0xe3a7ec4eb0f98cd8), W(0x6a3fea534dba3e97),
+     W(0x00000000dcedaa71)},
+    {W(0xe3930d74532e764e), W(0x782e46da5a678413), W(0x9c95a4c904d846f2),
+     W(0x000000003ae40683)},
+    0
+  },
+  {
+    {W(0x5e338a949dfbcf8e), W(0x9f1b52520324aba6), W(0x32ea5aeb970769c2),
+     W(0x0000000082c3b64b)},
+    {W(0x80346bd1feabe87b), W(0x63f11cc598111ddd), W(0x75819a032ef9e31e),
+     W(0x000000006e0e0fd4)},
+    0
+  },
+  {
+    {W(0xc708244b2e8fa4a8), W(0x4f239eded257f2cb), W(0x8e971ecff3192c1a),
+     W(0x0000000017f38ef9)},
+    {W(0x7c554d961aaae4da), W(0xa77f2992d521e6e4), W(0x3da56d53df7601be),
+     W(0x000000000186fbb3)},
+    0
+  },
+  {
+    {W(0xf57bde1cfca5574b), W(0xf2d37560406936cb), W(0x9182321832521f0c),
+     W(0x0000000062284045)},
+    {W(0x9e2d0754e56f5424), W(0xf45e699b60b75a5d), W(0xe050428d4b228b2b),
+     W(0x000000007119f781)},
+    0
+  },
+  {
+    {W(0x3824516fe796bb22), W(0xdcabe724f084506d), W(0x8f81b4cef8e8ca62),
+     W(0x0000000050801b2b)},
+    {W(0xfb3588989c54c069), W(0xb1dec2a150def1fa), W(0xbc3260e808c6c873),
+     W(0x000000007fb683c4)},
+    0
+  },
+  {
+    {W(0x480e16f90575e336), W(0xd55c8bf1df29de83), W(0x70844075cb5e14d7),
+     W(0x0000000011f519a2)},
+    {W(0xbdf85e8dd7012dd2), W(0x4761448372c610f1), W(0x850eeaf7649bad5a),
+     W(0x00000000f00aeeaa)},
+    0
+  },
+  {
+    {W(0x7d4edc309a0633cb), W(0x631c0b6a16da4f90), W(0x91b76085490b9bf2),
+     W(0x0000000061f9637a)},
+    {W(0x3add0d788f333b9c), W(0xca70ac89862efec2), W(0x3b540cb22476f537),
+     W(0x0000000013efdddb)},
+    0
+  },
+  {
+    {W(0xaf5a37817c6be6e1), W(0x10d4673faa336e9d), W(0x368211c407272e92),
+     W(0x00000000d7dd39c1)},
+    {W(0x7e327fb5051c4049), W(0xe3f1f1e181067082), W(0x85d2554d73261e91),
+     W(0x00000000d50d657f)},
+    0
+  },
+  {
+    {W(0xd35eb0b280d37f6a), W(0xac87fdda02b5b68f), W(0xf2be3787d51c6d3d),
+     W(0x000000004a54fe8d)},
+    {W(0x85a219d83514dd73), W(0x2f1ed85574e666c8), W(0xf0d4673c90e70bcc),
+     W(0x000000002daaf4bd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd481d37aead2c5e0), W(0x83660242676ef7cb), W(0x4bcdf56d6ddd542a),
+     W(0x000000000807b6ee)},
+    {W(0x99cfbaa188b2540c), W(0x92cdeb4c440a4586), W(0x62bde53daab76f82),
+     W(0x0000000031ca293a)},
+    0
+  },
+  {
+    {W(0x4079f1891175b9ba), W(0xe9e1ab30150e6d32), W(0x2d4254008b6cc92b),
+     W(0x00000000274ec0c2)},
+    {W(0x6d261b018f0527d9), W(0x63cc56854ef086f3), W(0x7f963f7129dec1b9),
+     W(0x00000000ea97e94e)},
+    0
+  },
+  {
+    {W(0x0834526441d99c15), W(0x17c124bd34f3b1e1), W(0xc8425e3120468107),
+     W(0x00000000a035ed92)},
+    {W(0x15129a6619019adc), W(0x4c880baed78546b5), W(0x04faf0ec2a03f320),
+     W(0x00000000f88d60ed)},
+    0
+  },
+  {
+    {W(0xb6ef6e4fec9ac930), W(0xf97982f67bd6b2eb), W(0x3506344db87b9f50),
+     W(0x00000000e38cc59c)},
+    {W(0x98614bb40df2358f), W(0xa73a33ba4daab44e), W(0xc680567a3957de53),
+     W(0x00000000cfa42f96)},
+    0
+  },
+  {
+    {W(0x061731afb3fe0b33), W(0xdee055b2785b32f1), W(0x1de52e72c296cafa),
+     W(0x00000000b10ce663)},
+    {W(0xc6a06418c5a7f1be), W(0x1713586c50016567), W(0x2c001a594502900b),
+     W(0x00000000450b28d5)},
+    0
+  },
+  {
+    {W(0x0ba00094fda66aba), W(0x034594b000c25d60), W(0xaecf0812b0ccb9b4),
+     W(0x00000000ebecd41b)},
+    {W(0xe2cb6f9c95fb80f1), W(0x33f77310e9f56be8), W(0x77e2c3e0ab12b176),
+     W(0x00000000a7a303fc)},
+    0
+  },
+  {
+    {W(0x049ce7f9d1e5c2d6), W(0x6a8702d5dda045cf), W(0x444a4ca8ae642723),
+     W(0x00000000c9e8efd0)},
+    {W(0xee8ff912bc74c0b8), W(0x7cacfd02a5f0a182), W(0x0bdcdeccf34c0a0e),
+     W(0x00000000f174835c)},
+    0
+  },
+  {
+    {W(0xfbd1a1913cfb3680), W(0xd4f7de7614bfa4e1), W(0xfcdb2abdf38ce345),
+     W(0x0000000045ebd21e)},
+    {W(0xb59f480a1d84093e), W(0xcc2181973957e934), W(0xe4604f767c1b8e5b),
+     W(0x00000000c58f2c48)},
+    0
+  },
+  {
+    {W(0xf3798b62885801a9), W(0x08f77ad99856b7c0), W(0x471ef44904ab2722),
+     W(0x00000000e5f3587d)},
+    {W(0x21b96d5cc09f1c74), W(0x5e2a228bb0c73d23), W(0x69323a1ba3366107),
+     W(0x00000000759bf017)},
+    0
+  },
+  {
+    {W(0xd2ade9c1854da328), W(0xb2369f45683ea003), W(0x26a2a12e6bbf8ead),
+     W(0x0000000065fa7d53)},
+    {W(0x6154c3a844971ebd), W(0x9e3b11add7f809d8), W(0x24d19af820ed9167),
+     W(0x00000000a692a83a)},
+    0
+  },
+  {
+    {W(0xd856830580001060), W(0x6a578b8b34f0a25d), W(0x0eadf2ee039f50cc),
+     W(0x000000006a3cf739)},
+    {W(0x6a9a2a618ca51f3b), W(0x92f53d4f5c707fb6), W(0x756df23222360abf),
+     W(0x00000000a7a12676)},
+    0
+  },
+  {
+    {W(0x3e7e898a48067657), W(0x429f687214230734), W(0xe3a1abc87bef4c47),
+     W(0x00000000b3564180)},
+    {W(0xeed81406b41998c2), W(0xe40d75bea7ce6e62), W(0x9d22967df02dd5b1),
+     W(0x00000000a3ff259d)},
+    0
+  },
+  {
+    {W(0xe36b37d3ba10e2eb), W(0x2be422df5d87cbda), W(0xc8f5e0fe404781e8),
+     W(0x00000000a1bc9eda)},
+    {W(0x23299058d68a56ff), W(0x7d7df62c970d11fc), W(0x8ed8b412785e8445),
+     W(0x00000000bad1345d)},
+    0
+  },
+  {
+    {W(0xed710d9781d83b84), W(0x9d798cd73a39d170), W(0x0683a7e0ef236d5b),
+     W(0x00000000b9141322)},
+    {W(0x05109f73295bb2f8), W(0xb994c8ebdade7c00), W(0xc11452def251df45),
+     W(0x00000000b48e9a05)},
+    0
+  },
+  {
+    {W(0x165046c8eb75d498), W(0x232d37a1030a06a1), W(0x3932bda309c6053c),
+     W(0x00000000cb39f998)},
+    {W(0x87fe797695de7723), W(0x216feab00499f81d), W(0x2959c2647ae298d0),
+     W(0x000000001edb6b93)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfecff2a6481e157c), W(0xa01ff9324f8b44cc), W(0x9c0232a4d783714c),
+     W(0x0000000090d1c36e)},
+    {W(0xbd5e004dad070ffb), W(0xec3d0dd1f22c1c14), W(0xc4fac85877b24ec6),
+     W(0x00000000f15be1db)},
+    0
+  },
+  {
+    {W(0x83f05d8db95b1070), W(0x225fcf2b4dc83cf2), W(0x09d299d6523db1cd),
+     W(0x00000000e968d6f7)},
+    {W(0xa5406081b132ecd5), W(0x645c2ab4c545ab6a), W(0x592bcabbcf6e254a),
+     W(0x00000000599530e8)},
+    0
+  },
+  {
+    {W(0xce43975edae389c1), W(0x4355bc25a5d688cd), W(0x5bdb528b9f7eff59),
+     W(0x000000005a9663b4)},
+    {W(0xdb49700b2bdd1ea5), W(0x8187c0b0b25b3442), W(0x8606cb7cea0a4ef9),
+     W(0x00000000f7d88d71)},
+    0
+  },
+  {
+    {W(0xa46f08d8da598881), W(0x4cf987a8b9fe1aa5), W(0x1b37edc032c26e96),
+     W(0x00000000cc6e653e)},
+    {W(0x37d78fa48ea05891), W(0xb6453df344dcd6fa), W(0x72834a3e637ed305),
+     W(0x000000006cab1cc9)},
+    0
+  },
+  {
+    {W(0x6bf6abd3f206fb4a), W(0x74185bcb0952e145), W(0x7e4bf6f77b34f1be),
+     W(0x000000007d8ad958)},
+    {W(0x693defb4922cec05), W(0x1f7733057f4ae3f2), W(0xf58d64033ab96e06),
+     W(0x0000000012e1ecf7)},
+    0
+  },
+  {
+    {W(0x61425e886cea392d), W(0x6f33c1fb58702c40), W(0xf184e51ccec293f8),
+     W(0x00000000e235ffd9)},
+    {W(0x95eb779a9e082a0a), W(0x786e75a4c4c622dc), W(0x308a5e90083bb119),
+     W(0x00000000c962912e)},
+    0
+  },
+  {
+    {W(0x16773735ab1a3fd3), W(0xd044d5225595a0fe), W(0x721882607a60f969),
+     W(0x00000000c1b43819)},
+    {W(0xb3da54b4846a5dce), W(0x43f6bca53854d663), W(0x67b040477f496ea5),
+     W(0x000000002166b424)},
+    0
+  },
+  {
+    {W(0x2efe30a11ff1de02), W(0xfc2c0f38d9e804cc), W(0xb6ba8131b9c440fa),
+     W(0x00000000d2f7d77a)},
+    {W(0x88842b6960e1b4f3), W(0x008db8f296f7f20a), W(0xf13ceac59a618fff),
+     W(0x000000006577f60c)},
+    0
+  },
+  {
+    {W(0x8aa2335ab49b2fe2), W(0x434d6318beee036d), W(0xc5e84a7d1cd1401c),
+     W(0x00000000a44823db)},
+    {W(0x6a0bbebc470938f1), W(0x9c7c62f1e9b992cf), W(0xc33668d733192c9f),
+     W(0x0000000013031d96)},
+    0
+  },
+  {
+    {W(0xec43efa659ef1f6e), W(0x8214f7111c412e2c), W(0xfc033f6dc267c968),
+     W(0x00000000e6aa5e8c)},
+    {W(0x7d144ae8de940bc1), W(0x73a0c7b08cfb6b8a), W(0x5c883b7e2a8a7cac),
+     W(0x000000009c287c27)},
+    0
+  },
+  {
+    {W(0xd99d2adc6befdf26), W(0x4c512342355967e6), W(0xb8774728cdc3cc33),
+     W(0x000000001e80ad55)},
+    {W(0x0f266bc29dbc150b), W(0xbd8a3cbc46a9969d), W(0x7f17241a6cef966a),
+     W(0x0000000088acd32f)},
+    0
+  },
+  {
+    {W(0xbd482556d0b89306), W(0xc33614271653fafd), W(0x10b62eeb39c09ddd),
+     W(0x0000000079f6d014)},
+    {W(0x78d81b00d744c03c), W(0xec51067ee8963c96), W(0x63b703858c8f6a4c),
+     W(0x00000000551fa28d)},
+    0
+  },
+  {
+    {W(0xb9e782faa74ae2a7), W(0x707cb5120773dac9), W(0x1cb082fa3e9cd8f5),
+     W(0x0000000050c85792)},
+    {W(0x7525a4e4443f6a97), W(0x7a9c5c36bcdec240), W(0xf0d50a481e75d93e),
+     W(0x000000002618b31f)},
+    0
+  },
+  {
+    {W(0x014da731f1d00722), W(0x7feb8a5c05f6ff46), W(0x04e070a679f6e834),
+     W(0x00000000bc06d1d7)},
+    {W(0x91b4a6005a98de28), W(0xfe53e98ddfe1792c), W(0xf7860c90d3a7e48b),
+     W(0x000000006748811b)},
+    0
+  },
+  {
+    {W(0x59af3ff9fec21cfd), W(0x59b0e279f8daf76d), W(0x4b2134fa3c1b9967),
+     W(0x00000000a827e128)},
+    {W(0x612bdf3175fc6872), W(0x965aacc7956668d1), W(0xe000daa2608a7026),
+     W(0x00000000829762dd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x433a33e9f611c717), W(0x5f8001f92417a7ce), W(0x7a6ca2981d9155b1),
+     W(0x00000000d78e16eb)},
+    {W(0x3ab289c1c11dfcf9), W(0x14996507ee48adb0), W(0x8dd6fbf2c998c5c9),
+     W(0x00000000959f66af)},
+    0
+  },
+  {
+    {W(0x7ef25e1542de8327), W(0xf84d2f14c3c0b7b4), W(0x9d3722872d411980),
+     W(0x00000000b86b3e9a)},
+    {W(0x6682e29b7f225094), W(0x7638e99ec7ddb5da), W(0xc5272ca980ad8746),
+     W(0x0000000067e42112)},
+    0
+  },
+  {
+    {W(0x126208fba89d04f2), W(0xcea88f22c3f913fb), W(0xfbf9d09c81ebbd24),
+     W(0x0000000060be0397)},
+    {W(0xab78592d554a7a99), W(0xbca7876aee7a8b54), W(0x5cb0cea758636e68),
+     W(0x0000000056d9eb18)},
+    0
+  },
+  {
+    {W(0x76b14e73f20ce9cb), W(0xe87b13ab5173ac48), W(0xde2af466ac29f6c0),
+     W(0x00000000bf4405a4)},
+    {W(0xe0a961715cd87093), W(0x6f175bdec72bdfba), W(0x2c99116514f78dd7),
+     W(0x00000000f55ecef7)},
+    0
+  },
+  {
+    {W(0x085cede399ce3cf2), W(0x87ec383739a2603a), W(0xbdc1e809b203a75d),
+     W(0x00000000f3640f89)},
+    {W(0x8d9d5264d93d4aae), W(0xd455e58cd480817b), W(0xe3368ba58492b58b),
+     W(0x0000000024b8bfe6)},
+    0
+  },
+  {
+    {W(0x7a6dcf7f50cfff54), W(0xd9932f1f2905feea), W(0xd274195e5bba1fd8),
+     W(0x00000000596a73e6)},
+    {W(0xfa2e2812d4297f7a), W(0xc5b1614183723184), W(0x7ce090e321f09629),
+     W(0x00000000b6dc2849)},
+    0
+  },
+  {
+    {W(0x31e49c5c31434cbf), W(0xaf660f6c2d0ee2e6), W(0x271cbc873aaf91fd),
+     W(0x00000000cb833e79)},
+    {W(0x36952e46520b6d31), W(0x6695996bf7a6bc06), W(0x1f6ccb97da163497),
+     W(0x00000000b5f271bf)},
+    0
+  },
+  {
+    {W(0x95ce63b8c29bf199), W(0x1e469d80225d1531), W(0x143d1930f1862d72),
+     W(0x0000000089faba0c)},
+    {W(0x36978268ac073163), W(0x077ad8472f3bfacc), W(0x817ba1fc8ecd6948),
+     W(0x00000000ad14a0f1)},
+    0
+  },
+  {
+    {W(0x29b44f02482cdab4), W(0x88f3dd7a09859196), W(0x8a9337d3274e7582),
+     W(0x00000000e9cba9ed)},
+    {W(0xab1d6ae130787ea1), W(0x72445ee41aa44fa6), W(0x2f9c17038201c08b),
+     W(0x00000000d128d342)},
+    0
+  },
+  {
+    {W(0x2c7dc4741b431c86), W(0x6c31f68d18a6a123), W(0xaa43dbfb53665bca),
+     W(0x000000008d40fe26)},
+    {W(0x6723ea8e7d646aab), W(0xcd9dea27bade3e08), W(0x2f3a4dc9c7adbb73),
+     W(0x00000000a74a2565)},
+    0
+  },
+  {
+    {W(0xef345020106086c7), W(0x18e51b40d0e87d76), W(0xe86e0a88222e0b10),
+     W(0x000000006fa3b5c9)},
+    {W(0x9da8796a410e6c90), W(0x4fe0bb39abdf6b2a), W(0xbbc769057ead1796),
+     W(0x000000008c71560c)},
+    0
+  },
+  {
+    {W(0x32c5bb8f1b020bba), W(0xc2383a3f28810885), W(0x14a9a0ad2ceffdff),
+     W(0x000000007970ea64)},
+    {W(0x8708e80ac1169c12), W(0x5a067425bbf83ccb), W(0x800c8eba5cc8baac),
+     W(0x0000000098c8b359)},
+    0
+  },
+  {
+    {W(0xbb8f292416cf432a), W(0x455c67ee5a087018), W(0x351ad0f18c5485dd),
+     W(0x00000000f7d7679e)},
+    {W(0x2bdc4896318e4ede), W(0x8b26b0fb277bcf81), W(0x87185cc7f147c5b4),
+     W(0x00000000df48c9e6)},
+    0
+  },
+  {
+    {W(0x9473341bc0354be0), W(0xb5b4c2579f33393e), W(0x09fb2116b3dc51a3),
+     W(0x000000000ee5b84f)},
+    {W(0xf91ac6753e9814a0), W(0x506f79fd816d6ca6), W(0x0cfcd5edc0c5edef),
+     W(0x00000000b71c05e5)},
+    0
+  },
+  {
+    {W(0x30f6e053ad55ab2a), W(0xa878cbee4b4739f2), W(0x3bbafe26d62b9aef),
+     W(0x00000000b84b80ac)},
+    {W(0xd03fc3fdc8ef692b), W(0xe63bac37b6803cd9), W(0x205a14b181afcd95),
+     W(0x000000007a0ade0e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x7e8f146e60051d31), W(0x4cd2aa833818b39f), W(0xf677bde616886905),
+     W(0x00000000022ae138)},
+    {W(0x5746a45898b45d19), W(0x70f9fca7acf62d52), W(0x4ee4670563279bc6),
+     W(0x00000000fd285b9c)},
+    0
+  },
+  {
+    {W(0xbad78996f0d700ae), W(0x1b3ef234c931bee3), W(0x7cd507dee3c1a2d8),
+     W(0x0000000058fc32e1)},
+    {W(0x01135f5f83e229c6), W(0x8d5e43a4fb8b7b35), W(0x2dffb3fe413750b4),
+     W(0x000000006a265953)},
+    0
+  },
+  {
+    {W(0x4f9806d5378ab9b6), W(0x901cd1d56fe0ae7b), W(0x8cc008d15c5d7d40),
+     W(0x00000000482bb599)},
+    {W(0xd27c78dcb3197df2), W(0x9d016d1081981d1c), W(0xe4da8fb822e5c2e4),
+     W(0x00000000b47c1de2)},
+    0
+  },
+  {
+    {W(0x796bb2af8c78030e), W(0x7d56b42a56c1932c), W(0x6ff56bc3f443c29c),
+     W(0x00000000bdd22bb5)},
+    {W(0x2117854795857542), W(0xbdc732f622575d25), W(0x4ffc71d37ffb29d7),
+     W(0x00000000d6ef14c3)},
+    0
+  },
+  {
+    {W(0x720a640602750aa5), W(0x224093ca6eb9dff7), W(0x1a96eb25184a84c3),
+     W(0x00000000acd4f389)},
+    {W(0xb39c3858199d9f4d), W(0x327750a7852d22bc), W(0x7f87358be3d02e8d),
+     W(0x00000000e8735aa7)},
+    0
+  },
+  {
+    {W(0xbc9613ab3a92228c), W(0x304f1f535920119c), W(0x9633ba13c3d2b2e2),
+     W(0x00000000e7d31665)},
+    {W(0xe622933cc95ebff4), W(0x9abfde78ec5df7bb), W(0x7feb42b150f7f156),
+     W(0x00000000eb17ef8e)},
+    0
+  },
+  {
+    {W(0x598811905e3814ef), W(0x1c96169829479d51), W(0xe286663a43ea1c9f),
+     W(0x00000000a124948f)},
+    {W(0xdf025db8c70b2863), W(0xa4141ee912c4d089), W(0x422590376609890c),
+     W(0x00000000d3e65394)},
+    0
+  },
+  {
+    {W(0x1a08721f25b9b992), W(0xbf152cb2eeddf997), W(0x3c761d64b6ad560a),
+     W(0x0000000052dd9f57)},
+    {W(0x39b5966ec0d79f78), W(0x562740a0ca15f167), W(0xd9642afbea78b847),
+     W(0x0000000037eea476)},
+    0
+  },
+  {
+    {W(0x6e22fbe72a4fc6db), W(0xac1a41a46ee63594), W(0xd10c82069853b2e8),
+     W(0x00000000839c4b30)},
+    {W(0x9b05c7b2173f6f3f), W(0xa10d5e1f92e88123), W(0x7af6121a73903a98),
+     W(0x00000000b4a959c5)},
+    0
+  },
+  {
+    {W(0xda4b72e5d57560f1), W(0x68c344aca3072640), W(0x4754e3c536a057e0),
+     W(0x000000004faa9820)},
+    {W(0xf20160bde786962f), W(0x77ea80d1a80ee38d), W(0x665dbf2ec8e173dc),
+     W(0x000000002aba1be0)},
+    0
+  },
+  {
+    {W(0xe9560d2377831f15), W(0x2538f064eaf91f36), W(0xd3234d5d3afba16f),
+     W(0x0000000072cdd346)},
+    {W(0xf10c4fac41950138), W(0xd4d4d2bdeb6758be), W(0x10d5e69ba6213bd1),
+     W(0x000000008e93fb70)},
+    0
+  },
+  {
+    {W(0x228ed7a9b6e8e52b), W(0x5d4bca442d501abf), W(0x3dad807be4f5d2f6),
+     W(0x000000000b4aa28f)},
+    {W(0xe672b21f006c4c0f), W(0x614c5f640888b653), W(0x226f83cda3e477ae),
+     W(0x000000000afdcedc)},
+    0
+  },
+  {
+    {W(0x0170fe6562df849a), W(0x08108dcbad644eab), W(0x5922238d140f8cfb),
+     W(0x00000000e644fb2f)},
+    {W(0x30b14b73b33a6749), W(0x8d78c44806b68ac2), W(0xa5cbecc3eaf5e5c5),
+     W(0x0000000039ca4af4)},
+    0
+  },
+  {
+    {W(0xe7476654d5a1f5d3), W(0x7a0ad378562eb536), W(0x2887f7567f5bedc0),
+     W(0x000000008581b7e9)},
+    {W(0x160c35049986fd24), W(0x06b5ca84dde60b62), W(0xb94770da8a8ca29b),
+     W(0x000000003ecfeca1)},
+    0
+  },
+  {
+    {W(0xb1e6354c8daa98af), W(0xba4e902de3bf1905), W(0x2bbef4b24e5a3e86),
+     W(0x0000000098713146)},
+    {W(0x8f31b77bc89be1b3), W(0x20b29efddc938969), W(0xa789b8829dc02de1),
+     W(0x00000000de8fe69f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb615d5a728c355ca), W(0x2c8d2d4f8ea9ecfb), W(0x7f81ee5d6be624fe),
+     W(0x0000000045035a93)},
+    {W(0xc3d2310097611fa5), W(0x3ccce59ae9c562fc), W(0x6ee17a32f451c22a),
+     W(0x00000000932ddcfa)},
+    0
+  },
+  {
+    {W(0xb483969f9b05d089), W(0xcfd11869f8cf3d39), W(0xa602a0061d89563e),
+     W(0x0000000091cd1395)},
+    {W(0xdbdaa43271d49ace), W(0x1c3623ed0966d0a9), W(0xf1b4da0f166bebe1),
+     W(0x00000000433f9113)},
+    0
+  },
+  {
+    {W(0x20e67927542a815c), W(0x7f7fe269488e81fb), W(0xb0057d32d968afb4),
+     W(0x00000000b8d04c1b)},
+    {W(0xee01ab8285a86d34), W(0x5e5709d8ef38d717), W(0xfba87128830deaea),
+     W(0x00000000bf20a3cb)},
+    0
+  },
+  {
+    {W(0x8c31bbf9209ded15), W(0x818a6e0b0e3623bf), W(0xc5f4aaefbb5c266d),
+     W(0x00000000a7179b54)},
+    {W(0xed08718615383b16), W(0xbbe070e0375cb291), W(0x73198d27047af636),
+     W(0x000000008f1c0b06)},
+    0
+  },
+  {
+    {W(0x35994c3788a000ac), W(0x337027afccc2b918), W(0x870c688bf27570cb),
+     W(0x000000008c91a8af)},
+    {W(0x5459f2f5458bc212), W(0x7d5dcbea9157cd7c), W(0xdbbbf2c4021d9845),
+     W(0x000000003319b3fc)},
+    0
+  },
+  {
+    {W(0x37a9713444861e3d), W(0x6798891d079c1b7a), W(0x3012e200eaf11509),
+     W(0x0000000061b63246)},
+    {W(0xc0246bd8a87c42aa), W(0xed286525b92f89e2), W(0x44cf10453fff4a96),
+     W(0x000000006e70ae3f)},
+    0
+  },
+  {
+    {W(0x9a3cdc818c5dd4e2), W(0x6a09971a6fd2d1fe), W(0xa14e785bfe48b29f),
+     W(0x000000007afeb3e3)},
+    {W(0x15c1eebfb175e3fc), W(0xc21625b9dc5c271b), W(0x4095982dd51bbdf3),
+     W(0x00000000ea6a656f)},
+    0
+  },
+  {
+    {W(0xfbf89123edb21e1a), W(0xba1f0507b350235f), W(0x487a5b44601ae7a3),
+     W(0x00000000168cfefc)},
+    {W(0x27f109991632dc61), W(0x224754d43f7f4917), W(0x93695572576cbe66),
+     W(0x000000001697b707)},
+    0
+  },
+  {
+    {W(0x6e3060c91a8145d6), W(0x023d4420ae018c88), W(0xe4e53bbb57cd7071),
+     W(0x00000000339bf37e)},
+    {W(0xb793ed802df7fe4e), W(0x3f629a493e28cc26), W(0x8fe699dbe3e5c463),
+     W(0x0000000004e7389b)},
+    0
+  },
+  {
+    {W(0x0b1163b6267d8f5d), W(0x726828b81ac7d2d2), W(0x180c40fd4c82417b),
+     W(0x000000005058e425)},
+    {W(0xf6d593db8e18f430), W(0xf422f9bf853baa10), W(0x002c8385036c8ff8),
+     W(0x000000003fca8138)},
+    0
+  },
+  {
+    {W(0x1e573ce8cb81538e), W(0x67f4dfb05fb563b3), W(0x3b90c09b70727287),
+     W(0x00000000aa1f931e)},
+    {W(0xdaefa3db7bbabbda), W(0x3bb95d2484c26d9f), W(0xd48e503528e1f78c),
+     W(0x00000000a8ee14d7)},
+    0
+  },
+  {
+    {W(0x37b01990e40c62d3), W(0x3af2466520b44782), W(0xc94b6eb26a7bee29),
+     W(0x000000003b88d552)},
+    {W(0x193b46c60c86ef05), W(0xa0dcccc519d15b8c), W(0x1e3f7961ef2fbcb0),
+     W(0x000000007b874768)},
+    0
+  },
+  {
+    {W(0xa19390c883915790), W(0x5cff6adb89c07f5b), W(0xefb0fb2f4477268f),
+     W(0x00000000eb9fd9ea)},
+    {W(0xa7aefce02d652e86), W(0x9841c09c9b664479), W(0xca20d6411bbbd8bd),
+     W(0x000000002552d0bc)},
+    0
+  },
+  {
+    {W(0x703c40872190027b), W(0x30337b258fdd4999), W(0xcda53385a1899946),
+     W(0x0000000009e5e77e)},
+    {W(0x4195bb40a55d0025), W(0x92590e25f42bd0ff), W(0xce381c9de8851807),
+     W(0x00000000b5b4be14)},
+    0
+  },
+  {
+    {W(0xa7e1a2e83623eda0), W(0x718ab879ac58d5ff), W(0xfc81b7ef534d3d98),
+     W(0x000000007bf3507e)},
+    {W(0xc99a574a59fc820a), W(0x7128bce98c34bfc0), W(0x14ad70af2d1682f0),
+     W(0x000000008d8b67f5)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1aa93494897a6b26), W(0x0eecf33d07822bd8), W(0x411c39e9690a0450),
+     W(0x00000000ddfd5a23)},
+    {W(0x5d8da0af752f4021), W(0xc6e5a1f074dcec38), W(0x6b77f2b0a51c46ee),
+     W(0x000000001367898a)},
+    0
+  },
+  {
+    {W(0xd8b1efba10f0de19), W(0x831a06cb5d75e9ca), W(0x7af3d6fddea9f60f),
+     W(0x0000000095065ae4)},
+    {W(0xe0c7e800379b23db), W(0x5d673e5222ced186), W(0x95367fa5c6698d7f),
+     W(0x000000009310a67e)},
+    0
+  },
+  {
+    {W(0x7322a3b2288d3aae), W(0xbe251fd51b5b3f21), W(0xcad2ee211fe6e87b),
+     W(0x00000000b5fd4e5b)},
+    {W(0xe5ae89d491f82182), W(0x3262d99ec2853eeb), W(0xcb1595849036d2d0),
+     W(0x0000000045627827)},
+    0
+  },
+  {
+    {W(0xf3411909f3073506), W(0x94dcf7c12470f5ee), W(0xade34d2cf0be84fe),
+     W(0x0000000090636c20)},
+    {W(0x180fa04cb2827737), W(0x26143ea22db09b0f), W(0x83bcc5590a0909aa),
+     W(0x00000000281cf9aa)},
+    0
+  },
+  {
+    {W(0x38d6fee0b3d17628), W(0x5ac1dd548f859667), W(0xca6e59bf86559609),
+     W(0x000000006854b4e8)},
+    {W(0x23a24b8761f3a762), W(0x0173425e5840ce8a), W(0x00fd3d85946b6bbd),
+     W(0x000000008a095b45)},
+    0
+  },
+  {
+    {W(0x74d544f1156ebcbc), W(0x3127ea7e4c355669), W(0x099e116c1ea60e82),
+     W(0x00000000d960a70d)},
+    {W(0xd60a4a59d32fd59f), W(0x3cf7063d305faf07), W(0xe6b8e5c261b80d24),
+     W(0x00000000d428e0cc)},
+    0
+  },
+  {
+    {W(0x26d2129522dd5fee), W(0xd4c31ad35d2ed352), W(0x44afa3c43daf91ee),
+     W(0x00000000d529e7b2)},
+    {W(0xd7ed0b4717333fb8), W(0xe9201771cc9faccf), W(0xc9757998c98aa7de),
+     W(0x00000000ce2c4e14)},
+    0
+  },
+  {
+    {W(0x098fc5031ae8d0a4), W(0x41d102953d3f8532), W(0x23d266c850253fa1),
+     W(0x00000000b38286d6)},
+    {W(0x99903092fb63eee1), W(0x9100a99c48a64b98), W(0xfe159bd8bc43643a),
+     W(0x000000002f08eae4)},
+    0
+  },
+  {
+    {W(0x5b31f9b6b10e23d2), W(0x5c151d19c558d554), W(0x19a6f592e3c46403),
+     W(0x000000002211131c)},
+    {W(0x4d8f19e7bb6a51b6), W(0x551259ee8c4d4f34), W(0xad36aa89347e8cae),
+     W(0x000000005a959e3c)},
+    0
+  },
+  {
+    {W(0x178db2dd9f2c968b), W(0xc9ba55bc8674b5e1), W(0xd3884f45ce21dcf1),
+     W(0x000000007664513a)},
+    {W(0x7a1b3e56bb703b97), W(0xc4a588c4c9e299e2), W(0x8d3f0ffce96de0f0),
+     W(0x000000005aba434e)},
+    0
+  },
+  {
+    {W(0x3206b59f8685946b), W(0x7e914149bf15b53c), W(0xfec559402fff52c6),
+     W(0x00000000c3791f65)},
+    {W(0x394de0c178dad0a9), W(0x72c6919f5c5fed8c), W(0x0e57743b674b4d59),
+     W(0x00000000d7315975)},
+    0
+  },
+  {
+    {W(0x7fa4f80a3dad8066), W(0x60f2414dc574aafe), W(0x1529340525994c45),
+     W(0x00000000a00f9231)},
+    {W(0xf98edea50f201926), W(0xaf5b2ad4d0bcf974), W(0x448873aca3c74ad6),
+     W(0x000000008ff67b2d)},
+    0
+  },
+  {
+    {W(0x510cb9a475e7728e), W(0x54d76825baf15c58), W(0x0023d4d4234a8fab),
+     W(0x000000009d6e89b9)},
+    {W(0x374850ff2cce0b43), W(0x32a29d1b6bf4faef), W(0x799cb3eedd164002),
+     W(0x00000000fc7797a7)},
+    0
+  },
+  {
+    {W(0x34261e5426f100f7), W(0x589b344bcf17aa4d), W(0x0c7a04fa801ccc35),
+     W(0x00000000762b3408)},
+    {W(0x002ca1319578af64), W(0xe0fba28a0870f41d), W(0x276eaa2670686201),
+     W(0x00000000f592842e)},
+    0
+  },
+  {
+    {W(0xb78b71bccf7ff5db), W(0x625166caa79ca9e4), W(0x095aa863e7aab4c3),
+     W(0x00000000980df4d9)},
+    {W(0x75ac5ed8fc336519), W(0xf211966fcc69d2f9), W(0x10ce7510429f98f1),
+     W(0x000000005736d4ee)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8da51d84f3b848f9), W(0xc9d1a3dbb2abe419), W(0xc275c72eefa624dc),
+     W(0x000000008b684df9)},
+    {W(0x75f1bf6ec682bec0), W(0x3f9f9e0afc8f823d), W(0xb3363382a497166b),
+     W(0x000000003241d9b6)},
+    0
+  },
+  {
+    {W(0x052107c118a6fdae), W(0x7a4941a34c1843ed), W(0x10eeec3a5b395717),
+     W(0x0000000041bed6c7)},
+    {W(0xe3bf062dc77d493c), W(0x99abf215e2632a75), W(0xf5482813ccb37627),
+     W(0x0000000065bddca7)},
+    0
+  },
+  {
+    {W(0x506cdad2b6a58003), W(0xcc9e3e861cd413bf), W(0x4669ee325af9735a),
+     W(0x00000000f133df4e)},
+    {W(0x343b9133a97f8799), W(0x5ed1097ed2df1205), W(0xe1f7e724c0f593eb),
+     W(0x0000000003f70d2b)},
+    0
+  },
+  {
+    {W(0xdc0b4f056cd705df), W(0x584543cca26650ba), W(0x52a5b5a49623d15d),
+     W(0x000000008530847b)},
+    {W(0x2b9634a495176358), W(0xb76d861388564796), W(0xdd09c6f78cd268e3),
+     W(0x00000000fbbf3c6c)},
+    0
+  },
+  {
+    {W(0x1b85ad40d1a99127), W(0xc5c3aeaedf111baf), W(0x84a08959b8cbdcbd),
+     W(0x00000000f524602d)},
+    {W(0x2b9c8cc7fee9168a), W(0x7909e06a0d04c9bf), W(0x83aaa35a6cc84847),
+     W(0x00000000f959e850)},
+    0
+  },
+  {
+    {W(0x4d0104343b97a302), W(0x74f53cf14c309e4a), W(0x5f2efc7b0b2d9570),
+     W(0x000000008b813ff2)},
+    {W(0x23c1b9d3c407d3d6), W(0x69fb3fc13bdcbf71), W(0x0918eac4a8f3d1af),
+     W(0x000000000dce7141)},
+    0
+  },
+  {
+    {W(0xa40bf6387c776f56), W(0xa708b8080e6b3b00), W(0xdfae3ebb3c8be01f),
+     W(0x0000000033242898)},
+    {W(0xe34b67f88555475f), W(0xdcd6c559834e28be), W(0x0e3d88eaff67d51e),
+     W(0x00000000ef451b8c)},
+    0
+  },
+  {
+    {W(0x076ba1e240600691), W(0x3cbbece3af9141d1), W(0xeae3910890d62387),
+     W(0x0000000039ae931a)},
+    {W(0x7c192920ef1b81b3), W(0x07e50a2b51f12b8a), W(0xaa15f8c6f1cfbc63),
+     W(0x0000000026ff0bea)},
+    0
+  },
+  {
+    {W(0x4ac8c0e8e53f6dd5), W(0x017ac8d90d19a2e2), W(0xba70cee08e935def),
+     W(0x0000000003e21efe)},
+    {W(0x059a6d5e1eed3662), W(0x02ab68a278b754da), W(0xf926edd3664e0001),
+     W(0x000000002647369f)},
+    0
+  },
+  {
+    {W(0x1076b1eb594c77a9), W(0xc4197cd36ad2cad4), W(0x554c32cee1aacc58),
+     W(0x00000000635b8410)},
+    {W(0xe7b9ee74e0c630ed), W(0x40561bd980e38acb), W(0x5a8bac0ec73af74b),
+     W(0x00000000e3c4cb3f)},
+    0
+  },
+  {
+    {W(0x96eeb3a218623f9b), W(0x641ad96534fe1082), W(0xaa31211947e3aa1f),
+     W(0x000000006b6b37d8)},
+    {W(0x2f39d89d1971bd92), W(0xc6cbc51f3edcc8c1), W(0x4144834216283861),
+     W(0x00000000aebdab66)},
+    0
+  },
+  {
+    {W(0xb3615bc1da251259), W(0x8fd04e3c88b4bf7a), W(0x83c423856f1160ca),
+     W(0x00000000b15c3b37)},
+    {W(0x583b6d84a7ecaae4), W(0xfef2925fc60c96ff), W(0x31374d64acaf264d),
+     W(0x00000000a55b0c15)},
+    0
+  },
+  {
+    {W(0xa66f621582f918c9), W(0xdf7ed0e19d7a2a6e), W(0xccc325fec827f796),
+     W(0x00000000e4cb02c3)},
+    {W(0x245ecaa946bbcb23), W(0xdad8b102d08f876b), W(0x71251c9f933574e3),
+     W(0x00000000399564c4)},
+    0
+  },
+  {
+    {W(0x8c657895c0bee948), W(0x58bc63917b4b3320), W(0xd009465f2d48c25c),
+     W(0x000000001c7bf8a5)},
+    {W(0x00bb3b0efebc2d85), W(0xf1d9b4aaef8f7a51), W(0x403dcdc3b4bf39ff),
+     W(0x000000009fa9b95f)},
+    0
+  },
+  {
+    {W(0x55b7041fcfb3053e), W(0x87769f01226e5185), W(0xff39b2676079ea75),
+     W(0x0000000023eededc)},
+    {W(0x5fa4b8470504295d), W(0xbd5f9060c17bb5ce), W(0xdf7fd590f7d5b3a2),
+     W(0x000000005370ea22)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x5ac7dc319f2ac6a5), W(0xd3536baf5a5fa2f2), W(0x19e26cfd918f6160),
+     W(0x000000003d611b68)},
+    {W(0xfbe0d26458b92257), W(0x6f69ee33a4b3a16e), W(0xfb87b2d4ab7e3e38),
+     W(0x00000000e4cf7a53)},
+    0
+  },
+  {
+    {W(0xd0fd8e2d16b5009f), W(0x75cd4af485f596e9), W(0xc0ff364ac650d10a),
+     W(0x00000000aa432f6b)},
+    {W(0x60cd9ff6b9e1fd35), W(0xf5ffdf83a81387b4), W(0x0f74dad81fb57eae),
+     W(0x0000000077ebce28)},
+    0
+  },
+  {
+    {W(0x21208e24ad9729df), W(0x8a66913450a51554), W(0x739f33c476da2c79),
+     W(0x0000000047f7655f)},
+    {W(0x6df3da713faf5d73), W(0x23d729bdda653a05), W(0x7efefa7fe0dbba03),
+     W(0x000000008546d123)},
+    0
+  },
+  {
+    {W(0xe91399208a41f62f), W(0xe343f86aafcf2338), W(0x330ff0088626eb92),
+     W(0x0000000062bc5b8f)},
+    {W(0x9ed3ab3d770a0f51), W(0x87533c3facdfce8c), W(0x36ceed7d198a1e9a),
+     W(0x00000000366edc66)},
+    0
+  },
+  {
+    {W(0x1df015dfc9194ba8), W(0xe5e57b965545ae11), W(0x34894ebbf86d852d),
+     W(0x0000000061b42915)},
+    {W(0xb25bf6b0aab92979), W(0xf88d93822f858332), W(0xa64fc13d082b80c9),
+     W(0x00000000db34263a)},
+    0
+  },
+  {
+    {W(0x3d345d79d05e1a54), W(0x9b0c74e24e4eb11a), W(0xd3f608314f7cb301),
+     W(0x000000009b37cac3)},
+    {W(0xd42ac14add153410), W(0x67daba894b82b6e1), W(0x293aa2ea062085e8),
+     W(0x00000000dafbaa02)},
+    0
+  },
+  {
+    {W(0xabba8dd8810e3b3c), W(0xd024fdfabc9b4d54), W(0x56df515609ce7445),
+     W(0x00000000869985ec)},
+    {W(0xd64936f1a279f60b), W(0x147e3ae6f9f4dd90), W(0x9b4a0a61b0502e71),
+     W(0x000000002b7784e2)},
+    0
+  },
+  {
+    {W(0x7783a2368f78c75c), W(0x185d7d80cacbfea9), W(0xd767d6c637384da3),
+     W(0x000000001b40ecf0)},
+    {W(0xcb35e135b58df6c4), W(0xdede089c1bdb10dc), W(0x032e487351f82512),
+     W(0x0000000086fff3dd)},
+    0
+  },
+  {
+    {W(0x44aeebfb1973898f), W(0x229635056fdec0d8), W(0xc61c3dc64dccb72d),
+     W(0x0000000029d98bbe)},
+    {W(0x0b4d124cc79d4f82), W(0xab61b97460e1bdf3), W(0x502b0c2660907706),
+     W(0x0000000052fb8b7c)},
+    0
+  },
+  {
+    {W(0x195a49f1757467e5), W(0xbd37554819bb9a9f), W(0x32a666f4dd63e900),
+     W(0x00000000bb5bae80)},
+    {W(0x71975390b06e326c), W(0xa8071dcb7200d75c), W(0x34371f379bb8f1f0),
+     W(0x00000000d14c5988)},
+    0
+  },
+  {
+    {W(0xa9ab961d2fb2a30d), W(0x7f2e1082587b4227), W(0xf2fed11b9bacdb2f),
+     W(0x000000004327e6c8)},
+    {W(0x59f2340af5f7ca94), W(0xa241b47fdae690d8), W(0x0426688120f9a82b),
+     W(0x00000000b60ba27e)},
+    0
+  },
+  {
+    {W(0x949b80c21b8b14e9), W(0x7634d5e79e45f562), W(0x89e47023eacf4d90),
+     W(0x00000000ed86f825)},
+    {W(0xa46549d32a28ee33), W(0x91467c95cc9d20c3), W(0xaad820ffb5aaafc8),
+     W(0x00000000fa9b0b7b)},
+    0
+  },
+  {
+    {W(0x8665d519e7f02675), W(0x3114f6400b392d7e), W(0x27724fe5da3e7314),
+     W(0x00000000b0000497)},
+    {W(0x926765149626e05c), W(0x70fdd06886de4867), W(0xc9127734bfb7e396),
+     W(0x00000000ec308376)},
+    0
+  },
+  {
+    {W(0x49b1e5426f169f5d), W(0x6be4fa185467b60c), W(0xf10e3ad863a775bc),
+     W(0x00000000555978a5)},
+    {W(0xe2647c332b932386), W(0xc10e0d582d98173b), W(0xd4d665e8a46de613),
+     W(0x000000008c2f942e)},
+    0
+  },
+  {
+    {W(0xc1ad35cf9ef2ca53), W(0xf54f3d1d8063b121), W(0x2eddbe162c69c142),
+     W(0x00000000e20cbf04)},
+    {W(0xc6a6486c58b9d3e5), W(0x30a9fb2a5f1b4348), W(0xbd211312aa7af663),
+     W(0x00000000f09747fa)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1656bed1a5136305), W(0xd5bd811ff9475d4e), W(0x71b2886d29f67636),
+     W(0x00000000ce5ffc47)},
+    {W(0xed19aefdf8ec4c6c), W(0x3a69ea4700fbe22e), W(0xed7635e41a593c52),
+     W(0x00000000fea5dbc5)},
+    0
+  },
+  {
+    {W(0xf927be40a563da21), W(0x65697957a625fc39), W(0xc7c05c00c708ccff),
+     W(0x00000000e3551df0)},
+    {W(0x4a824ae61db01e2b), W(0x21fd2abf00aff255), W(0x489f78dbdc1865ba),
+     W(0x00000000c47678ec)},
+    0
+  },
+  {
+    {W(0x3efcf92ed275a39f), W(0x7a5bf4539e7dc5c3), W(0xa7519f80545e2429),
+     W(0x00000000bff83ef6)},
+    {W(0x1bbaa3ed41844609), W(0xa746f8d4ba740cb0), W(0x3714c524011d7f77),
+     W(0x000000009d085ce0)},
+    0
+  },
+  {
+    {W(0x4d52ad98a7314858), W(0xa2ad3d5444075a5f), W(0xa5da6ace5f264197),
+     W(0x000000001bd94b24)},
+    {W(0xaddbfb841046d21c), W(0xdb3e6a829deccfa5), W(0x0ae5bd2838b0cd4d),
+     W(0x00000000cdefc743)},
+    0
+  },
+  {
+    {W(0x7c3c87dd791db6e8), W(0xed4208a53caebe1b), W(0x33eaeca28e595178),
+     W(0x00000000dd44f120)},
+    {W(0x1a9fbcef9d16c2ad), W(0xa23758ebd7c0df1c), W(0x017c56f697fb0194),
+     W(0x0000000054d22072)},
+    0
+  },
+  {
+    {W(0xae9f8ef8afd9fc37), W(0x5f93d388a105296c), W(0x5d952034b48af789),
+     W(0x0000000005f5e48c)},
+    {W(0xdfeeb7d68609fed7), W(0xdba142e5203e35bc), W(0x8eb741a00544a93e),
+     W(0x000000001717b2c2)},
+    0
+  },
+  {
+    {W(0x71dfc732dd2771f4), W(0x8f335f6c5de194aa), W(0x0f41c61f9d9f0542),
+     W(0x000000004d72b9d5)},
+    {W(0x2c04cd0c611d8ad3), W(0xd878bb9908bbb3fb), W(0x637cba053c3cfcb5),
+     W(0x00000000ed1e549d)},
+    0
+  },
+  {
+    {W(0x9f68d2fc11028ec7), W(0xda67d396db80636b), W(0x058ae3aa399cbe22),
+     W(0x000000009a20e964)},
+    {W(0x0655d446a4afe4c5), W(0xd1f696f182be9278), W(0x78c7207b02a07951),
+     W(0x000000005473af3e)},
+    0
+  },
+  {
+    {W(0x6837adbbe6595e09), W(0x44e3212ad88fb4d9), W(0x26fc88c5f8e688ce),
+     W(0x00000000d9b86af8)},
+    {W(0xd85b435634be244c), W(0xc3824de042d84a11), W(0xe3bfb39d9b2adb0d),
+     W(0x000000008fa5eb08)},
+    0
+  },
+  {
+    {W(0xbcd7c24f8b74a444), W(0xe4e1a7a8733dfe39), W(0x29728adafb91b081),
+     W(0x00000000d7ba61c3)},
+    {W(0x23fc30b2ce4a71da), W(0xaa539e9d22c0b8fa), W(0x89c399454b65a1fe),
+     W(0x000000001b9dcffe)},
+    0
+  },
+  {
+    {W(0xe2840251132c102e), W(0x867c4ad39483d3c7), W(0x6c740c487ce66a7b),
+     W(0x000000007bc81de6)},
+    {W(0x3ca71479e5361508), W(0x71c2560c6b7a27f9), W(0xdb1e68082f4f904f),
+     W(0x00000000c5da6a89)},
+    0
+  },
+  {
+    {W(0x48532007a430f529), W(0xf9c913ede1daa6d9), W(0xbd0a98e58ffcdbb0),
+     W(0x000000009b2bdde3)},
+    {W(0x58bd41343eec4099), W(0x524e44ad4dcdfb2b), W(0x7457124c29153443),
+     W(0x000000009190c343)},
+    0
+  },
+  {
+    {W(0xa91fd568ed7c228f), W(0x132d38806dbe4662), W(0xe124bc918a3e719d),
+     W(0x00000000b4db3f75)},
+    {W(0x94ddc60af5443ce0), W(0xb74d7fe6101e6e90), W(0xa5c69d362e0c1b94),
+     W(0x00000000c5271bac)},
+    0
+  },
+  {
+    {W(0x3114935144f29d04), W(0x2a667d0a066cfa6b), W(0x9b47ae734b316177),
+     W(0x000000006a25d406)},
+    {W(0xc030b05be3197bdd), W(0xfd60de3552c31945), W(0x72474f0c63bd7a24),
+     W(0x000000004a9b2000)},
+    0
+  },
+  {
+    {W(0xb2b19598e483348e), W(0x274426b770d8787c), W(0x0a225edf23daa47c),
+     W(0x00000000608c7cf4)},
+    {W(0xd123265b898fa11c), W(0x8718790d4bffdd80), W(0xdcd59d69f33d2f41),
+     W(0x00000000e77b6065)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe34c46c70c51f106), W(0xa808bcef1a8f4562), W(0xb1bb8fc96cddda1e),
+     W(0x00000000a502ea7e)},
+    {W(0x9421a0eb9e63e9ac), W(0x09abe1ac124b21a9), W(0xfc9b2b69634ea315),
+     W(0x000000004d2d4d06)},
+    0
+  },
+  {
+    {W(0x1f5f9c087da97135), W(0x60a61939cbb88522), W(0xd63bd64a590e948d),
+     W(0x0000000045a94350)},
+    {W(0x8b9c0e7fc3f04dfe), W(0x24ed2a64c46a6c09), W(0x6aa2f787e5cb409f),
+     W(0x0000000090fd8928)},
+    0
+  },
+  {
+    {W(0x7535f2ce450a90c1), W(0x29cb37b32202c2ff), W(0xc576098aad07269a),
+     W(0x00000000233792b7)},
+    {W(0x5864342f368c1c44), W(0x2dca7f7302886c17), W(0x74bab9eeb1a39467),
+     W(0x00000000e841def5)},
+    0
+  },
+  {
+    {W(0xce23cb8f2cd73074), W(0x27d52714025cce52), W(0x60a7af167128e28f),
+     W(0x00000000ee37af3a)},
+    {W(0x228c1193291c3d92), W(0x559ca84b8bcaaced), W(0x5f7c29e260835724),
+     W(0x0000000042db013e)},
+    0
+  },
+  {
+    {W(0x4f3cafc73daddf8b), W(0xc7f938974571821c), W(0x564a1effb59cdc87),
+     W(0x00000000d3fc8e11)},
+    {W(0x210954cc32b8d1f1), W(0x0b89424a485b3e16), W(0xc71b961ea39a8650),
+     W(0x0000000050587567)},
+    0
+  },
+  {
+    {W(0x4c395b4e0510ae51), W(0x49d7c3048e70bc90), W(0x9d40e63f04b3e853),
+     W(0x000000004a2dc6ce)},
+    {W(0x36339e466ec0b89c), W(0xb1a1676b385a4594), W(0x9304dd88455a09ad),
+     W(0x00000000c6ff5bf9)},
+    0
+  },
+  {
+    {W(0x484daaee8c84d27f), W(0x612b63b1d799a2f4), W(0xef0ac41a550daad1),
+     W(0x000000008fbf8f4e)},
+    {W(0x84f7e136377207e9), W(0xfd5152ed7bdb6e8f), W(0x395821ccd89df99b),
+     W(0x0000000020d76719)},
+    0
+  },
+  {
+    {W(0x406ace5b5fdcb5d6), W(0x088fb5091ea243b0), W(0x22934b39d6070207),
+     W(0x00000000d9cd49e0)},
+    {W(0x4d0f31740d4662d6), W(0x4eef4ac5c755b33c), W(0xc50467c8f8e1a986),
+     W(0x0000000018a3ef6a)},
+    0
+  },
+  {
+    {W(0x761f1b7c79a68d97), W(0x3ccdde400b49a02f), W(0x77637e3ebb854598),
+     W(0x000000000022290f)},
+    {W(0xf0700420dfc1715a), W(0x4a5a58b2e0410aa3), W(0xf6bc18c06d34be85),
+     W(0x0000000046cdba65)},
+    0
+  },
+  {
+    {W(0x2fe8fb714b821219), W(0x4feedce11a1e9b3b), W(0xbfb2449b3925b0ea),
+     W(0x00000000b054dfbe)},
+    {W(0x2864722329864158), W(0xe2ec01b2a5055940), W(0x23b5a4c431e1b9a5),
+     W(0x00000000195035c8)},
+    0
+  },
+  {
+    {W(0x51cb66d5a1983b54), W(0xaf231cb558d0680a), W(0x1d2325d3cb3e58aa),
+     W(0x0000000013427358)},
+    {W(0x7dbb0bf16d4b8ce2), W(0x3bec3e7485f983bc), W(0x8a991a310f88839b),
+     W(0x000000006b3985b4)},
+    0
+  },
+  {
+    {W(0xdbbe1817a95bc0c4), W(0x8583001a91e4e9f4), W(0xe4667773bf43b7fd),
+     W(0x0000000052865635)},
+    {W(0x5962ba86ec4299f7), W(0x3849c7d128fe8ab8), W(0xd636805cd449338b),
+     W(0x00000000a1efd1c9)},
+    0
+  },
+  {
+    {W(0xb992a79ff123c708), W(0xada9dff419a0cf96), W(0x6a4d3e6c98adc9dd),
+     W(0x0000000040f8faf2)},
+    {W(0xef011d37676dfe03), W(0xb029aa6b7e67e105), W(0x45add6b387eb4d53),
+     W(0x00000000ce77f195)},
+    0
+  },
+  {
+    {W(0xd9e41b7ca9451b5f), W(0xb69c99b7154bb407), W(0x0a7b54c79e3d7f55),
+     W(0x00000000135359b7)},
+    {W(0x84d9fef7d2d3aed3), W(0x61c133555d18cdb1), W(0x1cba3904142d7261),
+     W(0x00000000ac50bd6c)},
+    0
+  },
+  {
+    {W(0xbaa57c7c88c46f2f), W(0x7299422c3b207add), W(0xb373586a4ed0514a),
+     W(0x00000000309bffcc)},
+    {W(0x461b005bc5186b1b), W(0xbbee060fc0f53c53), W(0xcda6e3b1c558624a),
+     W(0x000000006faa11b6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0d20898ec81b286e), W(0x3f1398f89d1c985c), W(0xce3b7676c62ed966),
+     W(0x00000000eb820161)},
+    {W(0x60f146184dd1834e), W(0x16b9b346e6d270e0), W(0x9e64598780e6594b),
+     W(0x00000000879e807c)},
+    0
+  },
+  {
+    {W(0x0703230be215ad69), W(0xcb4845fc9c23cc7f), W(0x3f2e4ff0a6d601b3),
+     W(0x000000008b1b5936)},
+    {W(0xe0882f46d006b554), W(0xd39b85a4402ec9ab), W(0x555b4d4e47de2c7e),
+     W(0x00000000eaa5bf4d)},
+    0
+  },
+  {
+    {W(0xeb2590871f5ff323), W(0xc5fb4dee5f91e522), W(0x534b6923f4380b52),
+     W(0x0000000076e6c597)},
+    {W(0x15c185626c95810a), W(0x301f16393989489d), W(0xa07c991b9e7d3b77),
+     W(0x0000000015324c79)},
+    0
+  },
+  {
+    {W(0xf78b555ac42ab049), W(0x9092aa3c971ade84), W(0x5ad4ea734e8a2ef9),
+     W(0x000000000425d602)},
+    {W(0x791d91222b7e58ba), W(0xf3147395227d0459), W(0xe4f1346cc9d765a1),
+     W(0x0000000028b65397)},
+    0
+  },
+  {
+    {W(0xc689b6f29c67637c), W(0x452c766124bde37e), W(0xd84ce94ce135cc88),
+     W(0x00000000f5cdf687)},
+    {W(0x8d08fbda56a1bebb), W(0xa871b0e627ce6fba), W(0x0d390f7cde121e60),
+     W(0x00000000b0c38ddb)},
+    0
+  },
+  {
+    {W(0xe7d16970ceec40d6), W(0x361a2299871eef82), W(0xb27a33c5b5fdd432),
+     W(0x000000001d066c2a)},
+    {W(0xe97230fd1d4d340e), W(0x5852f3b4862b60db), W(0x539f6530593d4118),
+     W(0x000000008436da66)},
+    0
+  },
+  {
+    {W(0x671da5bcb6bc89b5), W(0x7b6ad51be54748ff), W(0x5265d7ece9643b0f),
+     W(0x0000000059ed5fda)},
+    {W(0xd5f927542ef52970), W(0xf3b67e8570e9a5df), W(0xed2aae2f7bf74fe6),
+     W(0x00000000eb779118)},
+    0
+  },
+  {
+    {W(0x2425af9ee5f6d86b), W(0xe4dac347ead58c17), W(0xccdd8dd9b5cbb50e),
+     W(0x0000000086b3650e)},
+    {W(0xdc32063495382a07), W(0xe9848376a3e665cd), W(0x33fae4151e2d319e),
+     W(0x00000000eca579c1)},
+    0
+  },
+  {
+    {W(0x696bba18dd8c5e36), W(0xf92da576d75dff19), W(0x1cc09d9a246d8018),
+     W(0x000000001e243599)},
+    {W(0x152abdb5b0394fa4), W(0x44b32bb431861b47), W(0xb25777c48d885ef8),
+     W(0x00000000426061aa)},
+    0
+  },
+  {
+    {W(0x6a9d1fc4372307a3), W(0x50fbf10989b65031), W(0xfde88e7a23a987e1),
+     W(0x000000002dd37a50)},
+    {W(0xcebc549b2947bdb3), W(0xab66e245820f3f12), W(0x694bc71eb7bcaa87),
+     W(0x000000008e6e09c1)},
+    0
+  },
+  {
+    {W(0x6a879c70003cf956), W(0x29d9392a625ec537), W(0x699f542dd05f96ba),
+     W(0x000000006863ffa3)},
+    {W(0xbef33c9b172851ca), W(0x92b1229b48269fb8), W(0xb650f1e2da2b743f),
+     W(0x00000000b17eebb2)},
+    0
+  },
+  {
+    {W(0xfe8a98efc6572555), W(0x7137139363ff767a), W(0x0e5335e1c5f7f4d1),
+     W(0x000000007cfba5a2)},
+    {W(0x77da197696ccd504), W(0x16544c8767e59eaa), W(0x96be881c504acfd5),
+     W(0x00000000beef988a)},
+    0
+  },
+  {
+    {W(0x582e5a0dc96b9e3e), W(0x8f44a5e61e8a56df), W(0x351b109571e87285),
+     W(0x00000000f97cee70)},
+    {W(0xfb93f7bc73b46ec9), W(0xb756f2d546564e50), W(0x779c6b0abb7bc1a5),
+     W(0x00000000a78ed502)},
+    0
+  },
+  {
+    {W(0x823259763faff788), W(0x05c5a091575e852e), W(0xe0cc66d62c72e2f2),
+     W(0x000000001927e387)},
+    {W(0x4d0b0121b872a6ad), W(0x5bcfc9637da1cf59), W(0xdb25f5a726204672),
+     W(0x000000000a8b1258)},
+    0
+  },
+  {
+    {W(0xa54432a76f687cd7), W(0x308a3df35b52a071), W(0xc131c1b37558796e),
+     W(0x00000000210c0949)},
+    {W(0x630b384d3c336761), W(0x9bd616fd8648060c), W(0xa83fd622db621bf0),
+     W(0x00000000483374f0)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x7d69f703e8b35d2e), W(0xc271bab120d3988b), W(0xaab259f96c24b0c1),
+     W(0x000000005e65b843)},
+    {W(0x75e5c2e151fcf150), W(0x8993613bea29f462), W(0x8c9eae941834a191),
+     W(0x00000000f967c0ea)},
+    0
+  },
+  {
+    {W(0xc386d032ea2be4c9), W(0x828f0d4f16b11ec1), W(0x94c7a19f75da11d8),
+     W(0x00000000fda19041)},
+    {W(0xcd2bfd30d7f40cb4), W(0xb240b8db0e5ba2ee), W(0x375d77662339d87a),
+     W(0x0000000024af1974)},
+    0
+  },
+  {
+    {W(0x5d2e90ad87dc2c5f), W(0xed6943f8b9ad99ac), W(0xaa4598650c329529),
+     W(0x0000000096ffc387)},
+    {W(0x13516c2e34567b61), W(0x39122bf4a0aa883b), W(0xa825f1f8bfa72fcc),
+     W(0x0000000097da099b)},
+    0
+  },
+  {
+    {W(0x1082f9900e22d6ca), W(0xf4898bd82c9f0b9e), W(0x703ab683666e06e5),
+     W(0x000000006f1b6308)},
+    {W(0xc8b722db2a6a3005), W(0x3ef671a0d103845d), W(0xd0ce016b2459c28d),
+     W(0x0000000060884f40)},
+    0
+  },
+  {
+    {W(0x757c94effec9743d), W(0xf290f9329649e576), W(0x8be7ad8d79587916),
+     W(0x00000000add01304)},
+    {W(0x29445ca061f6de8f), W(0x1426c1d9285b7eef), W(0x962f7357ae55ea09),
+     W(0x00000000983ad1c5)},
+    0
+  },
+  {
+    {W(0x4e1fae128243d368), W(0xe6b7d57cf397b191), W(0x47dd818f2940f1c8),
+     W(0x0000000068c77c89)},
+    {W(0xba40969ee08f2ebf), W(0x102a61728ffaa799), W(0x997feef1712df945),
+     W(0x000000004da4261d)},
+    0
+  },
+  {
+    {W(0x3f49b089666e86e2), W(0xb96b8ccfe4f392d0), W(0x4a84d25ec0bd57d7),
+     W(0x000000008b9c3a47)},
+    {W(0x88262b51dd447511), W(0xf3ee05e85d6233aa), W(0xba39a0b71da165fe),
+     W(0x0000000056569118)},
+    0
+  },
+  {
+    {W(0x980ae61055c0ab69), W(0x5c17d9ffc6222c7e), W(0x9b8f42e03030f359),
+     W(0x00000000bbf50262)},
+    {W(0x469ee64ed0aba7f0), W(0x45ce7ede3ef5e0ea), W(0xb57bce910e1c1519),
+     W(0x00000000806bb655)},
+    0
+  },
+  {
+    {W(0x6ea071a9a95c2bdb), W(0xdab021117577ee45), W(0x9113f4af76cbaa9d),
+     W(0x0000000099635e61)},
+    {W(0xcb3555d57550b520), W(0x38c2ba9d52e2ecf4), W(0x11a91c70229529a3),
+     W(0x00000000a00ee973)},
+    0
+  },
+  {
+    {W(0x71c573cb7841328c), W(0x6497cd60082ecf99), W(0x69a1bc0571ec9eb7),
+     W(0x000000006642d5e6)},
+    {W(0x289bd24a20103e3d), W(0xb7ab5d3aff4810d8), W(0xc0bee664a1c2180e),
+     W(0x000000004d78e819)},
+    0
+  },
+  {
+    {W(0xa99a7cfe21a67f28), W(0x66ca131763510171), W(0xaec94201513cada5),
+     W(0x0000000049f01d2c)},
+    {W(0x1244c6579a2bc018), W(0xf5d6b73435a707ee), W(0x25599a6ce3b48661),
+     W(0x000000001c93b01e)},
+    0
+  },
+  {
+    {W(0x41c9ff86a767b7d9), W(0x61be605d69122581), W(0x289025b52e1290f4),
+     W(0x00000000471f9d09)},
+    {W(0xe2de2750b61b1166), W(0x95bb9edfefd4bfec), W(0x625d2dce76cf1560),
+     W(0x000000001ac06478)},
+    0
+  },
+  {
+    {W(0xd84872ea39dff000), W(0x934ce180cd477683), W(0x7d06aaf9ac940ed3),
+     W(0x000000002ad2666b)},
+    {W(0xdb8326a464ffe84a), W(0x4ba7405ae5bb163a), W(0xc9552ab599d0eeee),
+     W(0x00000000b3d04679)},
+    0
+  },
+  {
+    {W(0xac4ee29799847510), W(0x0655c22be26597cf), W(0xde1b700d9b4112d3),
+     W(0x00000000fbe46409)},
+    {W(0xedb1a43fd352b712), W(0x0fef8c72f4617de5), W(0xce9a8e3e10cde3db),
+     W(0x00000000f2b58ff4)},
+    0
+  },
+  {
+    {W(0x2e1bc53e5fc5462a), W(0xa84c1e203bfcb6eb), W(0x7189c102cc630ee2),
+     W(0x0000000037ad5b3f)},
+    {W(0x47119084e3855cd3), W(0x9a8b2fa83430f744), W(0x53b6eea4d22c061a),
+     W(0x00000000097f12d6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4760716e18e92c63), W(0x03cdfbf4789ae13c), W(0xc6470ce9f578d1e6),
+     W(0x00000000d42e2969)},
+    {W(0x5f1cf2304db766a1), W(0x1237a68d733456c6), W(0x91e21ef9592bb19a),
+     W(0x000000008814ad36)},
+    0
+  },
+  {
+    {W(0xbefb4b7b91a052d2), W(0xf5d7b19f6eb484b6), W(0xdc02e33ea01ef7f5),
+     W(0x00000000f8ac22f1)},
+    {W(0x0cbad0141ee85810), W(0x0ecada19c2d60cca), W(0x375f545c78a4abe0),
+     W(0x00000000bb2518b8)},
+    0
+  },
+  {
+    {W(0xe94cf6cfe924bce1), W(0x3c03f7b7721159cc), W(0xba328884d001dacc),
+     W(0x000000006ca68824)},
+    {W(0x857c60d099214785), W(0x6d9d01de3e1c1a16), W(0xe5100cc64e3a8a4a),
+     W(0x000000002fadd498)},
+    0
+  },
+  {
+    {W(0x96e332c121699c26), W(0x3b2527e2ba35b5c5), W(0x3d57260432a3227e),
+     W(0x000000003287caa4)},
+    {W(0xd3d8aa48fa83e20a), W(0x42872cdcd8f05722), W(0x789832b8211c6e5e),
+     W(0x00000000d7095c24)},
+    0
+  },
+  {
+    {W(0x8e5e0a0876f2859a), W(0x49d7fe17a554b8a7), W(0xde9b7d083cfefa32),
+     W(0x00000000b712685d)},
+    {W(0xd942a6e33f072319), W(0x105e78a0c242dae3), W(0xca0a3ad35c2986c1),
+     W(0x0000000058984f5a)},
+    0
+  },
+  {
+    {W(0xbb8f3d6690f303c9), W(0x9f67adfd75e4f894), W(0xc5900752597d61ec),
+     W(0x00000000bb05ff05)},
+    {W(0x78265562608daf57), W(0x31f9a44f8bb8c320), W(0x9604812d2afed365),
+     W(0x000000002ecd08d1)},
+    0
+  },
+  {
+    {W(0x4f8511c4254ed32d), W(0x437b9a4ff62b6ad5), W(0x9849b3b9e0ab6bd6),
+     W(0x00000000437c1eb4)},
+    {W(0x60c6615699f67517), W(0xe7f23f9de2da9ad4), W(0xe933cc08c72b155a),
+     W(0x00000000ad7576ea)},
+    0
+  },
+  {
+    {W(0x019aa18e83df61c0), W(0x159ba38106661e71), W(0xc90694972a662ce2),
+     W(0x000000005ff8cdb7)},
+    {W(0x22ef598690a3120f), W(0x4c18595b62a400b7), W(0x1fe38da6b2915c27),
+     W(0x00000000ffba34b0)},
+    0
+  },
+  {
+    {W(0x6335b063eb9b1c9e), W(0xfc5ad1b96133838a), W(0xce767a1c76c52676),
+     W(0x000000005e465185)},
+    {W(0x93f4d92f3794090c), W(0x25dd3904ce0d54ed), W(0xabc94edc742e50dc),
+     W(0x0000000078bba80f)},
+    0
+  },
+  {
+    {W(0x4b83b6cd887eb7e0), W(0x1b46a81881b49586), W(0xae4acd7d1fa505f1),
+     W(0x00000000832817ef)},
+    {W(0xd6ef910fc574766b), W(0x2419996ad59182a2), W(0x323e203f764ce5bd),
+     W(0x0000000063236d14)},
+    0
+  },
+  {
+    {W(0x118cb519f567e8d7), W(0x1c12c8c98ea6b928), W(0x395935d856dd68b6),
+     W(0x00000000bd116bcd)},
+    {W(0x5ced4a6bfc1ac8c8), W(0x5a7b4c09bb4ec3a0), W(0x1f24cb4f63f4b4af),
+     W(0x00000000f9b9d0b1)},
+    0
+  },
+  {
+    {W(0x18a50232596243e7), W(0xaa27b29725f531db), W(0xa07010988b3f0f16),
+     W(0x000000006a6aef50)},
+    {W(0xfb3a537d60fe4fb4), W(0xd4b3fc268c64961c), W(0x440a2f1983f4d9b6),
+     W(0x000000007696fcba)},
+    0
+  },
+  {
+    {W(0xc0f2402bf34d3bad), W(0x2a9eb6015360ffc2), W(0x7da3a9048d33aed5),
+     W(0x000000004dde5b44)},
+    {W(0x6c75adbb3a35e974), W(0xd7a771830c9938a7), W(0x30114b89f4ef9f5d),
+     W(0x00000000bb08ab61)},
+    0
+  },
+  {
+    {W(0xdf042ef780255f87), W(0x2a918359481cae35), W(0x3de7d9146fed5580),
+     W(0x00000000a4e1bcfb)},
+    {W(0x85cd2cffcd8bcdde), W(0x03a1d5434370738c), W(0x9814d14cf95a95e6),
+     W(0x00000000e0fd8dcb)},
+    0
+  },
+  {
+    {W(0xc27ed927f9193246), W(0xe4ef91cd655d6ffb), W(0xde7270a743a4fc18),
+     W(0x00000000cba9f29e)},
+    {W(0x2e139df8a246b9ef), W(0xc362ff6d5cc92d84), W(0x6a5bdae7c5a596a0),
+     W(0x00000000d5e4697c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa1aad671dd86fb5f), W(0x2ccfca9ef4cdb11a), W(0x06b67d2c35eb1979),
+     W(0x00000000d3a50661)},
+    {W(0x47a43129cf9afa3f), W(0x0f28c0722c80dfe0), W(0x2528a4361e137541),
+     W(0x000000004a30bc3a)},
+    0
+  },
+  {
+    {W(0x1f9e6c97fe5a3569), W(0x2727d87117ed7898), W(0x745aa2ed668c28ad),
+     W(0x00000000cf9ce234)},
+    {W(0x4a78372883f03768), W(0xadfd1b46bf5955af), W(0xea43a79292891a4a),
+     W(0x00000000c67457a9)},
+    0
+  },
+  {
+    {W(0x292f0d6898013b12), W(0x42f99c9b3e2b7aaa), W(0x77ff29a4e2ba5f7b),
+     W(0x00000000e21d90f9)},
+    {W(0xbc0b01cfd9c0cb58), W(0x4d244a26e3677335), W(0x2b1a301a8fee4b54),
+     W(0x000000005d1511ed)},
+    0
+  },
+  {
+    {W(0xb5a7fc92e8cde28b), W(0x130ca680ec8a7e38), W(0x882cb9d7786e2a86),
+     W(0x00000000103bbacc)},
+    {W(0x7395bf15c662b5a7), W(0x5a3d78414be2ec80), W(0x4eb9dbc0b287766f),
+     W(0x0000000054c7f36b)},
+    0
+  },
+  {
+    {W(0xb2b2a50a5b0fb7e0), W(0x6454833ceab1629b), W(0x6f8b4a637c39d5d0),
+     W(0x0000000030d626b2)},
+    {W(0x9a8acb170c71f852), W(0x8323dbb1475745be), W(0x270a6721740adcb9),
+     W(0x000000000a03009e)},
+    0
+  },
+  {
+    {W(0x19304128f5f98d3b), W(0x20e20a4b2c789ffc), W(0x89d5514cc97daa5b),
+     W(0x00000000dd34b4a0)},
+    {W(0x0a9eb31b0ddbc536), W(0x2c55f38f24ae2dbb), W(0x9646b08717cc1b59),
+     W(0x0000000071ce3be4)},
+    0
+  },
+  {
+    {W(0xadae3f5f845c5e5b), W(0x992a16a4cd1bd7ee), W(0x337e9b3ca4485725),
+     W(0x000000003626cd8e)},
+    {W(0x79b2db81a608fed6), W(0xbbd71232965d94d6), W(0x697683dc80d5574d),
+     W(0x00000000c03e299d)},
+    0
+  },
+  {
+    {W(0x663a8bf511dfaf3f), W(0x5a8b6d6ff1bd6f1b), W(0x4f49967b2de2cf36),
+     W(0x0000000049fde755)},
+    {W(0x9956f1ec1ea11bab), W(0xf4e97d3069f14061), W(0x516db87bc5c29863),
+     W(0x00000000d4456e50)},
+    0
+  },
+  {
+    {W(0x7a56403dc7a50ffd), W(0x89279eedc6c97a34), W(0xb329577f1915e4d9),
+     W(0x000000009837ddee)},
+    {W(0xb3ca9adf982499b3), W(0x0b11a0468b42a65b), W(0xf3ccd8fd29487966),
+     W(0x000000003cdc7ce3)},
+    0
+  },
+  {
+    {W(0x0479927d419dbdcd), W(0xfef1dbd24075a914), W(0xce7e7212a8616c04),
+     W(0x00000000519ebce8)},
+    {W(0x66a27a7a7f82ed99), W(0x9f897654a9bb6b73), W(0x517c70c8ea60310c),
+     W(0x00000000d5129eae)},
+    0
+  },
+  {
+    {W(0x9de10a198943fbbf), W(0xd71503ab62ce399d), W(0xda5b4e8f20ad5b83),
+     W(0x00000000fc5280bb)},
+    {W(0x5ce589211d5df580), W(0xef9c250a24c93627), W(0x54bf8779f4212e9d),
+     W(0x000000004c3ec292)},
+    0
+  },
+  {
+    {W(0xe2d9080febea6832), W(0x50a350b71caa4ae4), W(0x93c29492e721c971),
+     W(0x000000000d9b6421)},
+    {W(0xf5edf0297fc0717a), W(0xd51854da7ad6d13c), W(0xdf617255a23264cc),
+     W(0x00000000a35133b7)},
+    0
+  },
+  {
+    {W(0x8addbc4ba26f1907), W(0x2e70c51dc9976f08), W(0x5b2a4931a3d8d900),
+     W(0x000000003dba2d6d)},
+    {W(0xcbaaaa0b8e6a94d8), W(0xbfec4ed4faf506d2), W(0x9430ca0b70281d92),
+     W(0x00000000193ac2e6)},
+    0
+  },
+  {
+    {W(0x267dbd4f8ca23ea2), W(0xcb128d0a2fff2d75), W(0x11b3376111816de9),
+     W(0x00000000d68e3947)},
+    {W(0x559daf251bc7c656), W(0x69ed48bde283a507), W(0xb818c2bd148da7ed),
+     W(0x0000000095b07416)},
+    0
+  },
+  {
+    {W(0xf144c23198c5ac76), W(0x13a4fc9a01dcdc06), W(0x59dfa0445c97a38a),
+     W(0x00000000a424ac70)},
+    {W(0xccf362c7c1438d95), W(0x11b2ddcdff194d3c), W(0xff700c0ebf2898c0),
+     W(0x00000000fa061170)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x78b8a6b86d6d1495), W(0x9a15b1715019a365), W(0xd611e283025726c3),
+     W(0x0000000068f7b67f)},
+    {W(0xb4e7c5cf9367aca7), W(0xfb9fa2955ed6c698), W(0x2c0dd03d6ea9c71d),
+     W(0x000000006ad6ab61)},
+    0
+  },
+  {
+    {W(0x2b432e4e42b0ea67), W(0x5192044097be15f2), W(0x752805f0fb123348),
+     W(0x00000000095f8861)},
+    {W(0xe4fd179c428d08f5), W(0x4c2603c8bfe10a89), W(0xb5e94f0fc1a95174),
+     W(0x0000000038bffbb7)},
+    0
+  },
+  {
+    {W(0x842b9439517736b8), W(0x017ab23979b770df), W(0x29cf116b2ca8d23d),
+     W(0x00000000d89fd3b6)},
+    {W(0x20362fb9a037ebda), W(0xd010fe6817dff9f9), W(0xcbd44b83b8350a9e),
+     W(0x000000003adbe1f1)},
+    0
+  },
+  {
+    {W(0xabe6aeaca6e5dc69), W(0xde0a4f865e84d762), W(0x1d74cb44538499e7),
+     W(0x00000000bfb3e36a)},
+    {W(0x198dddb7bbcfa69a), W(0x873a7f1ffcbe1984), W(0x80cf7321b7b8bbcc),
+     W(0x0000000000ac08de)},
+    0
+  },
+  {
+    {W(0x243d2e96c854b8a6), W(0x8938cb33358d9af4), W(0x81a7eea1b47467ae),
+     W(0x00000000470b2dab)},
+    {W(0x3d8103c47063770a), W(0xafa79d2a9a2755c4), W(0x5b3e47419228b07c),
+     W(0x00000000bc9b37bd)},
+    0
+  },
+  {
+    {W(0xd89a7c51020255bf), W(0x1abc0a1a489bd20b), W(0xf9bbb011e7ac0a69),
+     W(0x00000000be7ead5c)},
+    {W(0x5bf6715dfd43757d), W(0x74bb4d9c2573c5cb), W(0x7ccb3fa630483451),
+     W(0x000000000071ca44)},
+    0
+  },
+  {
+    {W(0xe410e71831b3565e), W(0x78c21e10b76d2e77), W(0x6f7bfcdc0df8f583),
+     W(0x00000000210d7777)},
+    {W(0x04ef15f1740c2b91), W(0x03a4d42287836a34), W(0x2fbcd21844c267d1),
+     W(0x00000000bb549183)},
+    0
+  },
+  {
+    {W(0xf92173f59cbc0a32), W(0xca2337d83b6ebbae), W(0x49918d5044ad6eda),
+     W(0x0000000071e12775)},
+    {W(0x7c6c9ea3fc7a6248), W(0xe1e9ac5fa76fc6d0), W(0x0e5cdfb095bb0f9e),
+     W(0x000000003505e20d)},
+    0
+  },
+  {
+    {W(0x205ad8c6a993566d), W(0x1874691d84ebf013), W(0x749aace4f24e1951),
+     W(0x00000000aaf03f06)},
+    {W(0x33c5f5b449610345), W(0x9fbc337a378cf813), W(0x9b1441f38ac53e4c),
+     W(0x000000000113566b)},
+    0
+  },
+  {
+    {W(0x447246903783ad2b), W(0xbbc2508f6169a512), W(0x97426a68b54ae1fa),
+     W(0x0000000084a843c6)},
+    {W(0x57ee46491439b1e1), W(0x224d6e579fa3b852), W(0xb9fbee93cf4188dd),
+     W(0x00000000c6f126b9)},
+    0
+  },
+  {
+    {W(0xddd1ff7dcf358165), W(0x73e9c17ff244b120), W(0x40c26687e6046902),
+     W(0x000000001691fe67)},
+    {W(0x6e105d9c933ab02a), W(0x02d570b49b50eded), W(0xe9b08b5500b6a88f),
+     W(0x000000004b82631a)},
+    0
+  },
+  {
+    {W(0xec19a27bd3e26092), W(0xddac453de5ad9b86), W(0xb0a1794dc7d0db50),
+     W(0x0000000012340a6f)},
+    {W(0x8bcb070720e8dc2d), W(0xe23756c554438da3), W(0x68e9b91033597066),
+     W(0x00000000192ee4ac)},
+    0
+  },
+  {
+    {W(0xe899e96c2d66a175), W(0x5fb2ed8eb64bf9de), W(0xa7cc5c8843b5e3af),
+     W(0x00000000656b15b3)},
+    {W(0xc5c4e24add7873f4), W(0x6324347c112512c6), W(0xccd67ae626ff024e),
+     W(0x000000004f8c1dc8)},
+    0
+  },
+  {
+    {W(0xecd3e1aae1246244), W(0xfb799ecfbe482681), W(0x9fac48a447798831),
+     W(0x00000000afbbf20e)},
+    {W(0xd6f1c5bc3d17bb47), W(0x1b8d361afe2c6138), W(0x0fdeccc7d3d7cf0a),
+     W(0x00000000a05a2e1d)},
+    0
+  },
+  {
+    {W(0xef18bf5c142fbd3e), W(0xc11a8ae3268ce667), W(0xb9cffb1870f67534),
+     W(0x00000000c3038e8d)},
+    {W(0x29b2c2c3941d9303), W(0x4205ec1c4d1a3a20), W(0x5ab3157be2c18665),
+     W(0x000000007a60e7b3)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8fa02752db846749), W(0xc21478c8fcbae4b8), W(0x22632d48cff78948),
+     W(0x0000000070d86a48)},
+    {W(0x00132e4fa8b86e1b), W(0x0457eac23721a7ea), W(0x0c2cbce2dcc0060a),
+     W(0x0000000038fb42c3)},
+    0
+  },
+  {
+    {W(0x15442e1c83cff561), W(0xab89d9c962cd98e6), W(0x7426c5f858dcba94),
+     W(0x0000000080d0a8cf)},
+    {W(0x52648e23449af58b), W(0xdb61eac83a628b1d), W(0x9c140c5ff0844217),
+     W(0x00000000b3cc7bfa)},
+    0
+  },
+  {
+    {W(0x14edb17a2ee7720d), W(0x069e86b19273dd28), W(0x1acf759f66a0a61c),
+     W(0x00000000a37c8b2c)},
+    {W(0x791a7a720a58bf41), W(0x5b58194a1394c04d), W(0x537e9de62bc4f979),
+     W(0x000000004480f137)},
+    0
+  },
+  {
+    {W(0xf0426be1d6e670a1), W(0x14838573b4f44241), W(0x80845fb2efc4394a),
+     W(0x0000000090205f0f)},
+    {W(0x8a6cba7099c56ec6), W(0x6149abf74345224a), W(0x9c7703f2fc80d60c),
+     W(0x000000003d5a7643)},
+    0
+  },
+  {
+    {W(0xf7467e9c88af1879), W(0xed83e4fe881b44c9), W(0x88a66c42cc9d7b43),
+     W(0x00000000cec2ac0e)},
+    {W(0xf49170502843740e), W(0x4ec6e76e32ec1bd8), W(0x5158b1790bfe4690),
+     W(0x00000000b8cff2c4)},
+    0
+  },
+  {
+    {W(0xf0088ed21578de97), W(0x31601e3f8e52e39b), W(0x24e4d36e7ffc9ff1),
+     W(0x00000000937087c2)},
+    {W(0x08449bac5a9ade82), W(0x8ea21a05415b825c), W(0x4d184400c5b06c69),
+     W(0x00000000b0568c84)},
+    0
+  },
+  {
+    {W(0x5875ed12c4b69804), W(0x19d637eabbc59f9e), W(0x208a7df4c43ac1e4),
+     W(0x0000000064ffab0e)},
+    {W(0x15dfbf8f15aa91e2), W(0x478ab09596c5f6d9), W(0xda157675bad2b570),
+     W(0x0000000072835dda)},
+    0
+  },
+  {
+    {W(0xe4b299d2730ebcfd), W(0x6cdbe6f379702991), W(0xff023a31ad58884b),
+     W(0x0000000018b5c6ce)},
+    {W(0x433c522f51fd8a3b), W(0xc15792713e4907b4), W(0xe44547793c1c0282),
+     W(0x00000000b4df9ee5)},
+    0
+  },
+  {
+    {W(0x5b05d504da2953bd), W(0xe9b9c7d7644dda91), W(0x95719856740db6b9),
+     W(0x00000000fc9bd88a)},
+    {W(0xcd4b754e218e4e65), W(0xb8c8325341bed20e), W(0xd952d2e3d03ff5b0),
+     W(0x00000000248eab36)},
+    0
+  },
+  {
+    {W(0xb1e367cde0f2a08d), W(0x3ffda2c82a048373), W(0x9ff76c3f7ebd7502),
+     W(0x000000002aff3395)},
+    {W(0xda79325cfe647ecb), W(0xb4622192c5911d44), W(0x5deae1f89533c6e7),
+     W(0x00000000c4f44a70)},
+    0
+  },
+  {
+    {W(0x49edcdc2c60af0f5), W(0x969950b8e5e50d63), W(0x5eca1af114ba759c),
+     W(0x00000000eef98aab)},
+    {W(0xbb5644e21245afb3), W(0x32b88b75b474e873), W(0x6bb80695a3143f04),
+     W(0x000000009a16636f)},
+    0
+  },
+  {
+    {W(0x658675d748953bf7), W(0x8faf514adf2f4ac2), W(0x50213318dde660e1),
+     W(0x0000000064826f9f)},
+    {W(0xadcc3e458433d7fa), W(0xcc5ad72abc26833e), W(0x619251e2de547aae),
+     W(0x00000000f96f73d1)},
+    0
+  },
+  {
+    {W(0xc8dd837c6c1cedb8), W(0xd6a8b5392471de47), W(0x49d40d4460068cef),
+     W(0x00000000564a27e3)},
+    {W(0xe71a89475029a1de), W(0xaa9d4aa7c79a7100), W(0xae0e04f3064d90ff),
+     W(0x00000000af5a90d5)},
+    0
+  },
+  {
+    {W(0x083d83922007017e), W(0xeb2eba475d82e210), W(0x6739aef9eed51fd4),
+     W(0x00000000e530ed22)},
+    {W(0x497334d0d9ce90eb), W(0xd2a740fff09a9749), W(0x18fd518f2fc773bf),
+     W(0x000000006e7db848)},
+    0
+  },
+  {
+    {W(0x651f9e291d0d2f8a), W(0x8631791be078bff5), W(0xfa65d8258b83192e),
+     W(0x0000000039fd6792)},
+    {W(0x81151c7fa9c19c66), W(0x158f91290fa9a96f), W(0x243da875b51a456f),
+     W(0x00000000beaf2cdf)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xba3e8f2e548b77dd), W(0x21cbbb1a728cadb5), W(0xdb7403930feebd0a),
+     W(0x00000000dcffa1d6)},
+    {W(0xa742cd6fb6848db5), W(0x39f63442549a4fca), W(0x426c42e93d24aeeb),
+     W(0x00000000b67d7f28)},
+    0
+  },
+  {
+    {W(0x9d6ad457c458ba03), W(0x8264053378e956e9), W(0x32977879b94af545),
+     W(0x00000000d20f35a3)},
+    {W(0x9c65ff216224b353), W(0x4a46fdf75c8f99f9), W(0x307b3d8d4ce9a00e),
+     W(0x00000000798d2cf9)},
+    0
+  },
+  {
+    {W(0xa47e21c13964d2a4), W(0xf918e47e5f9875c7), W(0x4ac560662ecbc86c),
+     W(0x000000005ea26fc2)},
+    {W(0x31e429d6a5a826e0), W(0xd7082b19944c3736), W(0x02c3927ecf2fc959),
+     W(0x000000003bb33cf9)},
+    0
+  },
+  {
+    {W(0xb5fae58e477cabed), W(0x6ba8e28a55622b3a), W(0x56c2b54eff23a08d),
+     W(0x00000000866ba05b)},
+    {W(0xa737dae5037720d9), W(0xb93a1d0bdc5131fd), W(0x860b7b0dbb1176e6),
+     W(0x00000000f51c76d2)},
+    0
+  },
+  {
+    {W(0xde210bb39b68b84a), W(0x98b4770a74430a09), W(0x85cefd4ff0e810c7),
+     W(0x00000000ba1cac0a)},
+    {W(0x35194ff1e9e74a58), W(0x520f3a2b6452e158), W(0xd8535bc98ed85e25),
+     W(0x000000003bc32918)},
+    0
+  },
+  {
+    {W(0x56c53d5f1fed9837), W(0x752789ed8c3176ff), W(0x94c341e126489626),
+     W(0x00000000a5b14d8d)},
+    {W(0xb4f1f6123cb481d4), W(0x94eb82ca1a2f793c), W(0x6ba99e2b600ebda4),
+     W(0x00000000d1571ee0)},
+    0
+  },
+  {
+    {W(0x02ad20b1ff03f6d9), W(0x17295d2030165084), W(0x67757e6cb8bee43f),
+     W(0x000000000eedd6d6)},
+    {W(0x5acf912361ba2edd), W(0x4442dc9a8dee8798), W(0x9970bc21a4c9925a),
+     W(0x0000000054e339cf)},
+    0
+  },
+  {
+    {W(0x60e9cb5e72791646), W(0x644a5b6e107232fb), W(0xa23e4299004f8684),
+     W(0x00000000efa3c56b)},
+    {W(0xad436903964aa750), W(0x041c2a91bb576a94), W(0x3513e3febd787460),
+     W(0x000000004066ae12)},
+    0
+  },
+  {
+    {W(0xc9536b4ad257958d), W(0x9ab6a13510222aaa), W(0xdf7ca8e384934c38),
+     W(0x000000005e5dc148)},
+    {W(0x4d98778c93660c96), W(0xd69648d2b7c8140c), W(0xb0ea1d3669c09498),
+     W(0x000000007e0cd235)},
+    0
+  },
+  {
+    {W(0x21a0558f106cde5b), W(0x84c5579e2ea40699), W(0x5834fcc4057a8487),
+     W(0x00000000b35b630b)},
+    {W(0x2d1d0e726779af9f), W(0xd90a02486560d0d6), W(0x4d572129eb026a8b),
+     W(0x00000000720991c7)},
+    0
+  },
+  {
+    {W(0x0df3b4b07d78f32c), W(0xf41918619cf9b276), W(0x6444967a9dd92d6a),
+     W(0x000000005f3bbd8f)},
+    {W(0x1a4b4820a9ba118e), W(0x2aa6dcc42d798278), W(0x0ce3d37ce9681e55),
+     W(0x00000000739d5ad5)},
+    0
+  },
+  {
+    {W(0xee53ff2e7605a526), W(0x09187c915105c866), W(0x1f9de3bb02b0042e),
+     W(0x000000004f9500fd)},
+    {W(0x8cb6dd5c880380ec), W(0x2a74a12caa04e960), W(0xec0e66ffa0112a70),
+     W(0x00000000ec305363)},
+    0
+  },
+  {
+    {W(0x27760c7d940daa93), W(0xd15d7a6a9e3147b9), W(0x89363a50b9bb9711),
+     W(0x00000000e852edfe)},
+    {W(0x43ee10a594740e26), W(0xaa2970312d6acef6), W(0x2089038503fc12e9),
+     W(0x000000002d45580b)},
+    0
+  },
+  {
+    {W(0xaaca1be1c0ad0a5d), W(0x6f65ac78b4f7cd9f), W(0xf685dd47fae3835d),
+     W(0x000000006c5b897b)},
+    {W(0x03e5ac2e8e631946), W(0x4dafffd871afc215), W(0xa1bdc366ce6c64d0),
+     W(0x00000000e59eacca)},
+    0
+  },
+  {
+    {W(0x6d4895a38fdfcf33), W(0x19da7037ff2438e1), W(0x3cfaa48e67f22bef),
+     W(0x000000006bf9fc2b)},
+    {W(0x7b4df30e0a03dd57), W(0xd632b168956e9ec2), W(0xfc98eaece6cb0b1c),
+     W(0x000000007dbf18a3)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9ec12515237ac7ff), W(0xed07ceb73f080f23), W(0x08bba00bc3509a49),
+     W(0x0000000007998613)},
+    {W(0x5c36ecb2d7bef81a), W(0x9bd5732375c6840a), W(0x2c678e3c3e8f5265),
+     W(0x00000000c7f1cc73)},
+    0
+  },
+  {
+    {W(0x2409728c0993fc0d), W(0x7af57f462d5fd352), W(0xee72bd5628f3cb14),
+     W(0x0000000021c2f494)},
+    {W(0xac73118df22e2fef), W(0x490bb371283e1b56), W(0xaa6c7b0af00c3802),
+     W(0x00000000ee304f23)},
+    0
+  },
+  {
+    {W(0x76700d977eb65d58), W(0x931370ff164e0759), W(0x3e026c5a01746a00),
+     W(0x0000000074d457cd)},
+    {W(0x829ea9059c084cb1), W(0x55281cf8819b8f20), W(0x776ab2272c8499fb),
+     W(0x000000005d82676e)},
+    0
+  },
+  {
+    {W(0x5b89b52b2619d224), W(0x1df61e0b433d8d17), W(0x49353c25ec27bd08),
+     W(0x00000000f18b23f5)},
+    {W(0x2c798eecc525714f), W(0x6bd787c191011438), W(0x6e2db36afaa77bac),
+     W(0x000000002a3b730b)},
+    0
+  },
+  {
+    {W(0x75a6e7e528a283ea), W(0x792ef9cf5c7d8547), W(0x1e3d9d168a550266),
+     W(0x00000000eeb85fcf)},
+    {W(0x53d42383af9e330c), W(0xf77035f54a96c874), W(0x5c724965c7fb89ef),
+     W(0x0000000037da15df)},
+    0
+  },
+  {
+    {W(0xea09f154f5bd48f0), W(0x45e66f6318c36c89), W(0x1d069cd7ff1cf2a0),
+     W(0x00000000672fde0f)},
+    {W(0xf1f4e5b907bd9cc6), W(0xa40cdc9d86238146), W(0x00bcd404cdc7fd6b),
+     W(0x0000000051a105eb)},
+    0
+  },
+  {
+    {W(0xefd9b39f657dc7f0), W(0x0aba50745ca3d3d7), W(0x2255412b554f652b),
+     W(0x00000000a6fffe5b)},
+    {W(0x1de5ebd691545fee), W(0xbb69710e96877d32), W(0x95cdb2a2e11798e0),
+     W(0x000000005d15f278)},
+    0
+  },
+  {
+    {W(0x348659fad8d6b178), W(0x724963c60afc95de), W(0x1f2f8d2f478c3432),
+     W(0x00000000aa0e8781)},
+    {W(0xbf3811fe49e60cff), W(0x50f264cd526d1fb9), W(0xf613e178f802b4ae),
+     W(0x00000000d3df21bc)},
+    0
+  },
+  {
+    {W(0xcc7acd49913916c1), W(0x316fea17fc1955f3), W(0x567f019a5de4d8af),
+     W(0x000000008cbc5cbe)},
+    {W(0x9b5ba9a1b3d48402), W(0x67dd6efb03f9b3b8), W(0x5d5f60530886aa68),
+     W(0x0000000022398f61)},
+    0
+  },
+  {
+    {W(0x40af417945bfb8c0), W(0x6e8997cf3b133f03), W(0xc2f372b39b5dda1d),
+     W(0x000000003948b7d7)},
+    {W(0x9902859355f88793), W(0x405ba3c5bcf7e27f), W(0xb2fc7cd31de8aa5f),
+     W(0x00000000aadbe95a)},
+    0
+  },
+  {
+    {W(0x5e26e2e2233c165e), W(0x21b95e091da81fd1), W(0xd501e53a1af33fce),
+     W(0x00000000d7527bd2)},
+    {W(0x87c3a099ae677819), W(0x91a7e20b274eb569), W(0x24df48e85d2f2bdc),
+     W(0x0000000097e222bf)},
+    0
+  },
+  {
+    {W(0xff2c8be9d00dadb4), W(0x8d199a2926721264), W(0x7f2093a5bd6c65e6),
+     W(0x0000000021e5d488)},
+    {W(0xa000a3ec03e74b8c), W(0xeb8e9efa68530945), W(0x3f15aab2d1f6fc3c),
+     W(0x000000009b5d8cbb)},
+    0
+  },
+  {
+    {W(0x243f22e4a828c057), W(0xc13513961e32fea9), W(0xbd34bce4975fb13d),
+     W(0x00000000c9b351b9)},
+    {W(0x980a15ea8643fb8f), W(0x9521d42de2c65c08), W(0x04df9abc1aca5a5e),
+     W(0x00000000cb44a546)},
+    0
+  },
+  {
+    {W(0x45f74205b9fa3849), W(0x121a4ca897a4da7b), W(0x819c4b2d6d246547),
+     W(0x000000008255bc16)},
+    {W(0xf9d396e1156c1f2a), W(0xe8758b6d5502b719), W(0x94965c578b9b6ca8),
+     W(0x000000003c7a5ffc)},
+    0
+  },
+  {
+    {W(0x8465c265acea404b), W(0x1bbaf29e58645d6f), W(0x5b99f740cb461d13),
+     W(0x00000000a66cca86)},
+    {W(0x50052d3ca4a8113a), W(0xac0a20a3a6d35b43), W(0xff55ddc0cbc177a1),
+     W(0x00000000c8f1035a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc11d698475175beb), W(0x3c966d66bad3d4ba), W(0xb82cec9b67c5bea4),
+     W(0x0000000093b6322c)},
+    {W(0x9661c0461f09f72e), W(0x12a03826769c204a), W(0xc215f2cd35880fdc),
+     W(0x000000004f5bf77f)},
+    0
+  },
+  {
+    {W(0x7ee5008f073b3ba4), W(0xf81d75be28c86852), W(0xc2987502d457685a),
+     W(0x00000000e596765e)},
+    {W(0xfb631b84d0f9d913), W(0xe5cce6ba42aaadd8), W(0x2257f5b6f7d72923),
+     W(0x00000000260ae885)},
+    0
+  },
+  {
+    {W(0xefbe910593e92c0c), W(0x1cee1814266e3900), W(0xbec6b919e042e34f),
+     W(0x000000005cb15a6f)},
+    {W(0x7568673fd41a287a), W(0x4deaa29dfe7b7595), W(0x2d437dfd3e67572e),
+     W(0x0000000003299218)},
+    0
+  },
+  {
+    {W(0xd06815184d95806d), W(0x537054cb93423c26), W(0xea12b99cc2eabb37),
+     W(0x000000009297a177)},
+    {W(0xddfee3a2791e1723), W(0x21639c414de65e15), W(0xe43ae1fc7f3bad81),
+     W(0x000000007af9ba54)},
+    0
+  },
+  {
+    {W(0x7f81aff55df1d007), W(0xbe630797d6ea063d), W(0x46b66ca3631cf97e),
+     W(0x000000003bfc14a4)},
+    {W(0x3a379a18d751c657), W(0x87fb3d3baa5dfd05), W(0x95b8ff29f3af9e8f),
+     W(0x00000000928c3c53)},
+    0
+  },
+  {
+    {W(0xad55e7422cbf4902), W(0xceb87a93a30d570d), W(0x525f0059daaa178c),
+     W(0x00000000f38af4e6)},
+    {W(0xa001bb9ff041ead7), W(0x951d1144a05f60e2), W(0xfd38f820701418ea),
+     W(0x0000000027e433c5)},
+    0
+  },
+  {
+    {W(0x441290303383e911), W(0x1fa18b398b7e591b), W(0xf476b49fc7753dad),
+     W(0x000000002fc4d6c3)},
+    {W(0xe26efb1843355b4f), W(0xb345e6e04dd384fc), W(0xc574295c478d3761),
+     W(0x00000000421851ef)},
+    0
+  },
+  {
+    {W(0x588f5f0027afc27a), W(0x7fd91a63b4277028), W(0x5fe5d31d2477f29e),
+     W(0x0000000068c2db2a)},
+    {W(0x2a5ebb993c6bab6a), W(0x8847424d7b9c3f49), W(0xbf266e3bbf734579),
+     W(0x00000000fe65a7a9)},
+    0
+  },
+  {
+    {W(0x369366f404f12c25), W(0xf7b707ef3b495cf1), W(0x54db2f4dd190b469),
+     W(0x0000000065968af3)},
+    {W(0x3523b48ff7a6144e), W(0xc8b9ba516d259272), W(0x84256892b1231a44),
+     W(0x0000000054bb9db3)},
+    0
+  },
+  {
+    {W(0x17226de3b643e520), W(0xced25969673e9c13), W(0xa5cd67f0ba2862dc),
+     W(0x0000000063e09394)},
+    {W(0x8e82d99158403a1a), W(0x01d4d5f1d65039c4), W(0x632aaaf0f1028073),
+     W(0x00000000ea3a5927)},
+    0
+  },
+  {
+    {W(0x25165c562b1625ac), W(0x5e5ab2da59d95fab), W(0x905fb6f3d6d48bd8),
+     W(0x00000000ab915bc0)},
+    {W(0xf160d184d4205bde), W(0xbee102de7c8c89a8), W(0x723440074077bea0),
+     W(0x00000000acb9ef56)},
+    0
+  },
+  {
+    {W(0x7efc02f83326dbbc), W(0x38b936981b7f7cc4), W(0x1a32339f302561a0),
+     W(0x000000001ecb3eec)},
+    {W(0xf87b501933ce5e14), W(0x75eef647e659aa1d), W(0xba64bdc4da557b9d),
+     W(0x00000000988510ea)},
+    0
+  },
+  {
+    {W(0x1523e4cd6bc123a8), W(0x790902b760961aec), W(0xac18948c2e590d8a),
+     W(0x0000000012be3848)},
+    {W(0x2cbe9a30a2e4d9e5), W(0xeb87d419355974b5), W(0xfe46bfe9a7d3d6cd),
+     W(0x00000000dda7c4bd)},
+    0
+  },
+  {
+    {W(0x71d1f5e69740aa72), W(0x37433e71001738f2), W(0x349b8029aa9e486c),
+     W(0x00000000abf7b673)},
+    {W(0x0c85e941efda85ad), W(0x14f361620418cbd9), W(0x8a23a271354f721b),
+     W(0x00000000ff8340f7)},
+    0
+  },
+  {
+    {W(0x13610ed80ce4d1d5), W(0xab775f8cd384b71e), W(0x7644782de1a248d5),
+     W(0x000000002f8cd381)},
+    {W(0x1689747e828b8f2b), W(0x3377cb6ae7bea161), W(0x35dc3588dfaeb839),
+     W(0x000000001465f1a0)},
+    0
+  }
+};
+
+static const wge_t p224_wnd_naf[1024] = {
+  {
+    {W(0xbc9052266d0a4aea), W(0x852597366018bfaa), W(0x6dd3af9bf96bec05),
+     W(0x00000000a21b5e60)},
+    {W(0x2edca1e5eff3ede8), W(0xf8cd672b05335a6b), W(0xaea9c5ae03dfe878),
+     W(0x00000000614786f1)},
+    0
+  },
+  {
+    {W(0xe37710d786614a9a), W(0x24c17ffce0b02223), W(0x00505bb6c3cf1c5b),
+     W(0x00000000af8b6496)},
+    {W(0x9a73b17373e4e25d), W(0x7050163204144e62), W(0xafe10c35357940ac),
+     W(0x000000006dfa492c)},
+    0
+  },
+  {
+    {W(0x0b10cc50d42fac58), W(0xd80cdd0af8dfc283), W(0x39211b77975a451e),
+     W(0x00000000f7f4fe95)},
+    {W(0x2b552e7364fade9e), W(0x5e5610f361a9e695), W(0x42b54f7911bcf038),
+     W(0x00000000c858da82)},
+    0
+  },
+  {
+    {W(0x90462820899abac2), W(0xc6adf68368646e35), W(0xc81df8121e2526ba),
+     W(0x000000007ed50814)},
+    {W(0x610f21855dd6407c), W(0x3f3879aa1fb32889), W(0xce5eb25eed8ceeee),
+     W(0x000000000e5952e3)},
+    0
+  },
+  {
+    {W(0x1c1ecc777b94d3c7), W(0x23767b5f743eda4a), W(0x94f5e9ba2f993a50),
+     W(0x0000000079d4095a)},
+    {W(0xe07e55b68f776409), W(0x2b57fa61909bf3f1), W(0xe733d62777e1db6d),
+     W(0x000000005114ac9d)},
+    0
+  },
+  {
+    {W(0xac358ca86c6825d9), W(0x71f50674e1bdd5ca), W(0x0f060758d0dee306),
+     W(0x00000000d6d89093)},
+    {W(0x649ea142f1b7227e), W(0x87d166a208181c2c), W(0xc1182bf06c63713a),
+     W(0x0000000045e48d79)},
+    0
+  },
+  {
+    {W(0x489c8db23a1f6a38), W(0x4943a5aeffbe563f), W(0x68ade63cbc99fb0b),
+     W(0x00000000398eacf0)},
+    {W(0x83fdacb5ed549cc4), W(0xb6ab4a8b800df824), W(0xb4dc6bf8442ed616),
+     W(0x000000003f8060b4)},
+    0
+  },
+  {
+    {W(0x55bfd519e977f339), W(0x5cd307d1b16ed1af), W(0xc5e26f62d91345bb),
+     W(0x0000000064a35d22)},
+    {W(0x05015842a243f1ee), W(0x6fa10db370203aa0), W(0xdaf3972b05a83a63),
+     W(0x000000009422f10e)},
+    0
+  },
+  {
+    {W(0x86ade48bf845831a), W(0x473e361f79cec3fb), W(0x5523244bb9622253),
+     W(0x00000000538d543e)},
+    {W(0x12bb38bff8570c03), W(0x784e1b25b4e20b8c), W(0x2a2e7758e6873448),
+     W(0x000000002954321a)},
+    0
+  },
+  {
+    {W(0x716b6add1bfad739), W(0x0e68b721ea007122), W(0x4e35e1f608a75056),
+     W(0x00000000e28f8fa3)},
+    {W(0x7393ad1693c21468), W(0x4533e9284e27959e), W(0xe5b33144433c708d),
+     W(0x000000004c003b64)},
+    0
+  },
+  {
+    {W(0x869c61a18738f5d4), W(0xe83f1dc18d8b998b), W(0x1f2719895cc8116d),
+     W(0x00000000a8992ade)},
+    {W(0xb2334f8e88f6e037), W(0x9fcaafe11fadf19a), W(0x939bd9ec71d5904e),
+     W(0x00000000534ec549)},
+    0
+  },
+  {
+    {W(0x746daf5fd7a234b5), W(0x8d13c8a1210782c4), W(0x1008fd0f358ace9d),
+     W(0x00000000af231c63)},
+    {W(0x17203da0eedf77aa), W(0x0974abbe3534d554), W(0xf7552ee730962d48),
+     W(0x00000000a1ab0080)},
+    0
+  },
+  {
+    {W(0xec729f5b2390b30d), W(0x5467eb45347bddd0), W(0x79a42c594576657b),
+     W(0x000000003a4d5c62)},
+    {W(0x72672c8d871cf39c), W(0x22af9ec134edf6de), W(0x264b7c52c615c176),
+     W(0x000000006b6c91f7)},
+    0
+  },
+  {
+    {W(0xb5862dd8c8d94c12), W(0x3488de74fb7f7ec7), W(0xf3fb356bf9ca08fd),
+     W(0x00000000a3379ec2)},
+    {W(0x5680ab9427d39af3), W(0x4aa3a0131f4b780d), W(0x9c77acf2181ad0f0),
+     W(0x00000000c5ed6c19)},
+    0
+  },
+  {
+    {W(0x3ff1d62069c717f0), W(0x975088a3b26ad028), W(0xbb9b74533395a449),
+     W(0x00000000ac8575b5)},
+    {W(0x19b522940cb11f18), W(0x84cd103861b7e04c), W(0xb7e04864ea595a3a),
+     W(0x00000000f641867a)},
+    0
+  },
+  {
+    {W(0x5d150588382f2331), W(0xabac1d436e0c12f8), W(0xe25d613acc4b0247),
+     W(0x0000000098b62cd3)},
+    {W(0xca8e4ca9c09181c3), W(0xae6dcc271f7fb23f), W(0x44527d4941da9f53),
+     W(0x000000009e1f47c6)},
+    0
+  },
+  {
+    {W(0x724287d605073659), W(0x266f173886eb5493), W(0x72b46e9e70786420),
+     W(0x000000000bd8afe8)},
+    {W(0xeea543b62e7a6b37), W(0x1221cd6e7400cd52), W(0x9604a54b0a6c2e1c),
+     W(0x00000000e2c2c60a)},
+    0
+  },
+  {
+    {W(0x6ef3ab0521a4d862), W(0x7fe6fa59fbca1b97), W(0x639e011cd8911f8e),
+     W(0x00000000b731d607)},
+    {W(0x0706cd08654578a1), W(0x5d08a7fc8e5b6703), W(0xdc2ea4684d443d17),
+     W(0x00000000ccc5dbca)},
+    0
+  },
+  {
+    {W(0x9afdccc14a1a48c2), W(0x9befe15bf2645ccf), W(0xc06a289b170bc3de),
+     W(0x000000008b3174cc)},
+    {W(0xc289c4c5cb55af1c), W(0x73ec1671fcbc66cf), W(0xfdc7bcecea32e7fb),
+     W(0x000000002d89d32d)},
+    0
+  },
+  {
+    {W(0x4821f12515c4b334), W(0x3a67886843b3629d), W(0xa3b3215133190540),
+     W(0x000000004038845d)},
+    {W(0xedfaa06ccf5706d9), W(0x08de20a400044014), W(0x1a8a108bd5eb20d6),
+     W(0x0000000038cb0a6b)},
+    0
+  },
+  {
+    {W(0x231d20c5b60e66c5), W(0x89bcc285a36c8848), W(0xc4b2c9f8cb7e8b54),
+     W(0x000000002f8b6de0)},
+    {W(0xb8860525243f2d3f), W(0x945673bffdcf530d), W(0xefc627b649da0f6b),
+     W(0x000000004e9fb807)},
+    0
+  },
+  {
+    {W(0x687018fcba2c7ded), W(0xcc9d7b657c723f5d), W(0x938287142221f721),
+     W(0x0000000013d720d3)},
+    {W(0xe61c9b05e6d02ad4), W(0x72b115dec198db55), W(0x621f284ebe38af8f),
+     W(0x0000000018f09bf6)},
+    0
+  },
+  {
+    {W(0xa178a33a13e6bef2), W(0x7d66c450dd724842), W(0x30befc70a5d7a87c),
+     W(0x0000000069874db8)},
+    {W(0xcfcdbfce3ef58d85), W(0x9fa94e38e3d6346a), W(0xde39cef584c65476),
+     W(0x00000000e4efb3c1)},
+    0
+  },
+  {
+    {W(0x92f507cd4b30aee1), W(0xa95f03729137f80a), W(0x2be56c53cb924116),
+     W(0x000000000703cdda)},
+    {W(0x0b8faa7fbf64ed3a), W(0x9943cbedb73eae3f), W(0xdbca2fc4f227ad25),
+     W(0x0000000006231927)},
+    0
+  },
+  {
+    {W(0x29e4a335c0aebb53), W(0x155e8020600e1a17), W(0x556905e7a542f638),
+     W(0x00000000c7209080)},
+    {W(0x0b55b0fdf57b447b), W(0xc37cde3ea6cf1f95), W(0x1acfe8809d44e115),
+     W(0x00000000e820af09)},
+    0
+  },
+  {
+    {W(0x24f4b13593d07eac), W(0xfc097ef4f0524e07), W(0x1770de3d138ee6ed),
+     W(0x00000000edc6985e)},
+    {W(0x997ae14f34e15a3c), W(0xa168adf0b5a50098), W(0xe84702e105ed2b31),
+     W(0x000000004701e013)},
+    0
+  },
+  {
+    {W(0xd7b84536009f6ea1), W(0x526440936ae52eb4), W(0x58155fb24989ea92),
+     W(0x0000000051865588)},
+    {W(0xb2f24a3ed29d86e0), W(0x6e88be4d4a65a557), W(0x39d391fec5c558ab),
+     W(0x0000000071637238)},
+    0
+  },
+  {
+    {W(0x7d3144d7835832b0), W(0xca5729eeeeb7e587), W(0x24b3127963105e87),
+     W(0x00000000358ad95d)},
+    {W(0x8b96f12f44854e57), W(0x43d92d9ea1f8699a), W(0x19da3cf736720d2f),
+     W(0x000000000c3e259d)},
+    0
+  },
+  {
+    {W(0x01ae0872a47a47e4), W(0x1ffda591f209f351), W(0xfd2dee371c3d4f64),
+     W(0x0000000023082359)},
+    {W(0x226bc4e492135e7e), W(0x68af001cc1dc2c14), W(0xd11ebfc04a88888d),
+     W(0x000000005bb60dfa)},
+    0
+  },
+  {
+    {W(0x2fefa18a58d7da2d), W(0x28fd16890a5f6d1a), W(0xe2cc44edaeecb1e4),
+     W(0x000000001a3c357a)},
+    {W(0xe129986c0093ad3c), W(0x8691e9c278fb4e9b), W(0x1f4566926b166a07),
+     W(0x0000000055649b1b)},
+    0
+  },
+  {
+    {W(0xffa27852d85db49c), W(0xebaf8c054d6d2499), W(0x5a3e6570b5248259),
+     W(0x00000000b7125d0c)},
+    {W(0x37979bfcf6311485), W(0x732a179e785afdfc), W(0xe1b6b02f1a4c7732),
+     W(0x00000000a84e1866)},
+    0
+  },
+  {
+    {W(0xd6c61ac1ac4962cb), W(0xb7765b3a9d056208), W(0x566c60a7a70e6aa2),
+     W(0x00000000483b996a)},
+    {W(0xa38d32bc05f2cab3), W(0x21c5e288c38fefeb), W(0x689ae7bd57f15c48),
+     W(0x000000003e0d8010)},
+    0
+  },
+  {
+    {W(0x60f6d4668093f89c), W(0x6cafa25ecf003c2d), W(0xbc77b044d0d7630e),
+     W(0x00000000d7a09161)},
+    {W(0x127441b649f29af3), W(0x0d32c4e0b0254e23), W(0xcfe71abe75e8f41c),
+     W(0x0000000096b0e82f)},
+    0
+  },
+  {
+    {W(0x914c46e3eedcec8a), W(0xd558c5f5ed51dbbb), W(0x82de2f25e4f6643f),
+     W(0x000000009c778d76)},
+    {W(0x77c2b2a26c93b4de), W(0x4432cd3b9635218b), W(0xc387b3d0108057ac),
+     W(0x0000000016bfa10c)},
+    0
+  },
+  {
+    {W(0x6bea2eea5cafdf31), W(0x283305b4b2a1752a), W(0x5ae43a7b614e3749),
+     W(0x0000000032f496b8)},
+    {W(0x1b3119d69b30c18a), W(0x116cb83562b94d0d), W(0x195fe1967b33ba80),
+     W(0x00000000265f5d6f)},
+    0
+  },
+  {
+    {W(0xb117f21651163ec0), W(0xabe52dc53135e777), W(0x0342b8ea0239aaa4),
+     W(0x000000005259d119)},
+    {W(0xa2f6126f3726e83b), W(0x9e12c0b8ef7f42bf), W(0xdf28154d890e7b02),
+     W(0x000000006ac8cce1)},
+    0
+  },
+  {
+    {W(0x1b8e1a929be5cb81), W(0xac6ea7f7068df2b5), W(0xac83a92b3026664e),
+     W(0x0000000072b37735)},
+    {W(0x372f6086d75a6877), W(0x1d3f6ee911856f73), W(0x4ab6f7d792c7e379),
+     W(0x0000000041a7129a)},
+    0
+  },
+  {
+    {W(0x4b469803a0f5141e), W(0x88aad653654b6fc7), W(0xc89ae6211f7c6418),
+     W(0x000000008a394a5f)},
+    {W(0x6b9fcd7342051896), W(0x6719b01ac35f4dc3), W(0xdef5333520620bd2),
+     W(0x000000000c776c2f)},
+    0
+  },
+  {
+    {W(0xa1e32c1775c74ec0), W(0x0578cf959240e486), W(0x101c781211c19cf2),
+     W(0x0000000024cb7afc)},
+    {W(0x337ad47991870d46), W(0x7abcb154b1502815), W(0xac82048ac70a452a),
+     W(0x000000005f3c40fa)},
+    0
+  },
+  {
+    {W(0xfbb6d0a2c69d05f8), W(0xdd627a224fbfa38b), W(0x57b06e89e4fb6c26),
+     W(0x000000007a948732)},
+    {W(0x67fa73333ade788b), W(0xd1379db33481097d), W(0x3791fe294dfdde6e),
+     W(0x0000000067e918f4)},
+    0
+  },
+  {
+    {W(0x9189ca987373533a), W(0x12e78a5cf55abc5f), W(0xe200f8f8e8c22169),
+     W(0x000000006c6df076)},
+    {W(0xb4c0685c51d2f643), W(0x5edc063480c724fe), W(0x6249c7031a167b5f),
+     W(0x000000003a14c529)},
+    0
+  },
+  {
+    {W(0x48a895512c889cba), W(0xf78d3646d4c47f19), W(0x74a82870b1d3215c),
+     W(0x00000000121caba0)},
+    {W(0xe136e70c1d7c2bc2), W(0x4997df4a32ee7d4b), W(0x89c445fcd1751c3b),
+     W(0x00000000dea76cd6)},
+    0
+  },
+  {
+    {W(0xc896526a7c79d528), W(0x7593ecf9e4765c57), W(0x5b644829eb3f6aac),
+     W(0x000000009146e3e0)},
+    {W(0x45f1e73a6d151eb0), W(0x6e3feb6dec8f24a5), W(0xdcce107ec8feda19),
+     W(0x0000000010902618)},
+    0
+  },
+  {
+    {W(0x29d400aac78ea02b), W(0xb502fa20cbab68aa), W(0xad4d2ec51e8e152d),
+     W(0x00000000de55837a)},
+    {W(0xc856aab7fe2c30b4), W(0x835fef9243f8866a), W(0x9160577f9db6e0ff),
+     W(0x0000000045ba96a2)},
+    0
+  },
+  {
+    {W(0xc7f31ea100f2f69b), W(0x1aeb2d12025d36b4), W(0xcda4a199a0c77541),
+     W(0x00000000969d5c31)},
+    {W(0xa33d1375b06fcaa8), W(0x71130709f298df42), W(0x1456b2b178a436e8),
+     W(0x000000008ace578e)},
+    0
+  },
+  {
+    {W(0x654d63929fc074ea), W(0x4273b429b52aa379), W(0xc28a76bac8be83fe),
+     W(0x00000000e4b8902d)},
+    {W(0xf50e7a7da1ac5145), W(0x3f62c6021a7dfd89), W(0x9bb14cdb0206a474),
+     W(0x00000000289247ca)},
+    0
+  },
+  {
+    {W(0xff1076b7f1f1df96), W(0x477c7a9e6739a851), W(0xed36eb5e65682214),
+     W(0x000000007d1b78fc)},
+    {W(0x4e3bafbed8f1979e), W(0xba8dd1fc1dd669b4), W(0x69702916632927f3),
+     W(0x000000002c15e422)},
+    0
+  },
+  {
+    {W(0x8ef4a0fca4b9763d), W(0x2b91b27ee1e4e936), W(0x6d5bcc58f7df88ec),
+     W(0x00000000c7b0d774)},
+    {W(0x686582dd1c28224e), W(0x00e58c36e6a73ddf), W(0x240049eceb6a65df),
+     W(0x000000002f7f413a)},
+    0
+  },
+  {
+    {W(0x29f37bbfdf0dca1c), W(0x66bbaebf7ef50418), W(0x74ce96ba3d2c8dd9),
+     W(0x00000000fa075634)},
+    {W(0xb13684500bdae45b), W(0x8cfccf29424bdd89), W(0x7728055f72da9a9c),
+     W(0x00000000812e8696)},
+    0
+  },
+  {
+    {W(0x43eb67c1ba269e67), W(0xf979d7f9fd71fe44), W(0x65530cbac87bf4ab),
+     W(0x00000000a8a263f6)},
+    {W(0xdb9e3a3df4771bfa), W(0xfb8b46c8b0f36aa8), W(0xb9a347a8e21106c5),
+     W(0x00000000bf6454f8)},
+    0
+  },
+  {
+    {W(0x5fcc0903c31230a0), W(0xab0264b6e9c9a39d), W(0xebcd86162d844414),
+     W(0x00000000820c60f2)},
+    {W(0xa4d569e4e001a50e), W(0x07ac457d09b7d163), W(0xc3a2bf43f3d7eec4),
+     W(0x00000000392ea26c)},
+    0
+  },
+  {
+    {W(0x0a617a165d49f61b), W(0xc24c75ab5fa1c8f3), W(0xb2c16723e825848f),
+     W(0x000000000b5f7480)},
+    {W(0x76a5209013afece4), W(0x6a0560e81ee58e7d), W(0xb6d6e806293f957f),
+     W(0x00000000dd0dd19f)},
+    0
+  },
+  {
+    {W(0x3c58bb014b44db76), W(0xd5675d2c220a1127), W(0xae30828eaf967417),
+     W(0x000000001ca4dc67)},
+    {W(0x056f6ea2cb0152c1), W(0xe369478603518abc), W(0xd95b3943a674e122),
+     W(0x0000000099f04c22)},
+    0
+  },
+  {
+    {W(0x488844ef0dfe8347), W(0x8ccef3a51d0ad151), W(0x80b9f0321e54350f),
+     W(0x000000005eea8064)},
+    {W(0x99583ef1ac7bdf4e), W(0x7d915f557af9144c), W(0xafb3d55d4f25954d),
+     W(0x0000000040caa0af)},
+    0
+  },
+  {
+    {W(0xce984c344b6ae03f), W(0x5e58dc5c131a6044), W(0x5e77c17fbc181873),
+     W(0x00000000d9ba9074)},
+    {W(0x729009798924be76), W(0xc568293143ad4fee), W(0x901fe5f881e1d262),
+     W(0x000000008d18d721)},
+    0
+  },
+  {
+    {W(0xc799c6bc8461bff8), W(0xff4a54ba5f89077f), W(0xbdb079ad55c40d02),
+     W(0x0000000041b4dac1)},
+    {W(0x57586d6fb4ae2454), W(0x41adc0beef32382a), W(0x123176c064ba1aa7),
+     W(0x000000004bc45414)},
+    0
+  },
+  {
+    {W(0x3fd32d1a3b0ff077), W(0xb314b2908dbb35c8), W(0x31ef6ff8cbede2cf),
+     W(0x0000000057e3c765)},
+    {W(0xa1f2e01b164ae81c), W(0x82346090a2fdae54), W(0x30e65512bf224dde),
+     W(0x0000000074fd6bad)},
+    0
+  },
+  {
+    {W(0xe8530f744e3f79d5), W(0x75141bfb73acbf9a), W(0x16e3ef83d5fc8bdb),
+     W(0x000000000c69c522)},
+    {W(0x33cb9fac9a2efd82), W(0x7da70a9c4fd7e383), W(0xce05586d11463ea5),
+     W(0x000000001a0f8a12)},
+    0
+  },
+  {
+    {W(0xfac916cd2e00cc05), W(0x54781047777e6205), W(0x2181e6fb6918d089),
+     W(0x000000002d4f68a2)},
+    {W(0xb79879e64e79fc7e), W(0xd685ec1e7a97563e), W(0xcfd69cc6e97b76d6),
+     W(0x000000001d02b613)},
+    0
+  },
+  {
+    {W(0xf1a893f66e9f95a5), W(0xa3a7f36a9fe77cbf), W(0x693ec400b1e30ca5),
+     W(0x000000000791dad8)},
+    {W(0x1a341d972dd791b2), W(0x2e8bf7dd06bc4d61), W(0xeab3a5215e6575d1),
+     W(0x00000000a45bdcdc)},
+    0
+  },
+  {
+    {W(0xc00771965073c489), W(0x2988b7840bd2bfb8), W(0x7f3a302f7b296784),
+     W(0x000000009a702274)},
+    {W(0x66af9ad29a94eee9), W(0x856748578952e9fd), W(0xcb8a5cf3daf489be),
+     W(0x000000003c38ec14)},
+    0
+  },
+  {
+    {W(0xded933758825e9b9), W(0xd6e5875ac95f9bcb), W(0x219322fecabb9c76),
+     W(0x000000005363ee70)},
+    {W(0x4f1c6ab641a6a35e), W(0xb29105f8573aa056), W(0xaab8a2d649ef6dbe),
+     W(0x0000000081ff1b49)},
+    0
+  },
+  {
+    {W(0x7be955d202196e6b), W(0xa2161834ceddbcc0), W(0x65707bc26c8940cb),
+     W(0x0000000052d6fe41)},
+    {W(0x9f1d9cde66034f54), W(0x48b9ee051f8deba5), W(0x9fa44685da33f979),
+     W(0x00000000c02e8ef5)},
+    0
+  },
+  {
+    {W(0x2c85f48a00c01dc6), W(0x8a904eecba02d248), W(0xe4ad99459d8cd10f),
+     W(0x000000008560063f)},
+    {W(0xf1c7c72359d97963), W(0xe2d6a8c7f659ccba), W(0x53d3b0696f95a49d),
+     W(0x000000007dd4a793)},
+    0
+  },
+  {
+    {W(0xb5df7311696000f2), W(0xec4e051c6782df35), W(0xb790ec5e188ed3b7),
+     W(0x00000000879c92ea)},
+    {W(0x73c05f5dcb8a329b), W(0xc56d0368661de7ac), W(0xaab9247d3eb00269),
+     W(0x000000002477a0c5)},
+    0
+  },
+  {
+    {W(0x126414cb36d5d387), W(0xede1881f6dcfb690), W(0x8a70eaa65d201020),
+     W(0x000000002229f951)},
+    {W(0xbd511468d3c2dd1f), W(0x52566b764f28b098), W(0x2a082034d6be8d48),
+     W(0x00000000436fe24c)},
+    0
+  },
+  {
+    {W(0x7968c9eafcd6b1f7), W(0xe41945e755fc60ce), W(0x4eb9ea5f99ad0d0f),
+     W(0x0000000015c2841b)},
+    {W(0xc2d8eb2e6f6b6577), W(0x4ef0d88b1aa1696e), W(0x297fc13b3a1b3b60),
+     W(0x000000008f5c70a3)},
+    0
+  },
+  {
+    {W(0x62cb02350f84baf7), W(0x9327d067a7080980), W(0xd905f96ce8923652),
+     W(0x000000004917d3af)},
+    {W(0x37c8a9e7f097aba0), W(0x5f6ea093c52652fc), W(0x2699675c19b31321),
+     W(0x0000000000d42161)},
+    0
+  },
+  {
+    {W(0x6d72347c010029e1), W(0xbef600f17817982a), W(0xb6566ad90cda4481),
+     W(0x00000000ba8ca257)},
+    {W(0x988479c574bb8f02), W(0x17ef54b7bcde94f1), W(0x5e4ad49e5754ec93),
+     W(0x000000005effec6f)},
+    0
+  },
+  {
+    {W(0x1789fedd46647b12), W(0x30895370ccb4c102), W(0x104882fbdc5cf757),
+     W(0x00000000c1787367)},
+    {W(0xe27d88b1965c61ae), W(0x7d6abb9a17ff81cd), W(0xcaf1447a882795db),
+     W(0x000000003785977d)},
+    0
+  },
+  {
+    {W(0x5114cccad878365a), W(0x225872ee8234ba18), W(0x8f4c0c4e4c07900c),
+     W(0x0000000088f65a62)},
+    {W(0x2a92eefb6be15f71), W(0xf278925e022aba32), W(0xaf2b9e3d1bcdd920),
+     W(0x000000005ba63709)},
+    0
+  },
+  {
+    {W(0x580e9d727ac00869), W(0x5cfc7c73b14ec9b4), W(0x18a3cedb17c33dc6),
+     W(0x000000002e65d272)},
+    {W(0x46423f223d106294), W(0x7cf5785e615e28ab), W(0x0adefc2a0982ff65),
+     W(0x000000008f9aa33f)},
+    0
+  },
+  {
+    {W(0xbcb75c24ebe0e3ad), W(0xe5c08ea1ede78ca3), W(0xb3d6d80d3fd71e6e),
+     W(0x00000000ccaa988b)},
+    {W(0xad20dc3b79d2c682), W(0x324346af15e68727), W(0x356c79dd8d583855),
+     W(0x000000005c8dc58b)},
+    0
+  },
+  {
+    {W(0x9f967d185aee0a6e), W(0xf8f72db35c6d4a51), W(0x0352294bc46bea67),
+     W(0x00000000f477e004)},
+    {W(0x6ac82cfc07d2bff3), W(0xc44c6c2845a4c670), W(0xa9a3ad238fdb7508),
+     W(0x00000000f7d6a14b)},
+    0
+  },
+  {
+    {W(0x5165ac3a4f7522b2), W(0xeba5292f74e348c8), W(0xf2d00311c30595a1),
+     W(0x000000000c56861c)},
+    {W(0x0aa54c200f22ecc5), W(0x05200a63db870f4e), W(0x87f335c016f49f5c),
+     W(0x0000000050e089be)},
+    0
+  },
+  {
+    {W(0xe45f8537dca9966c), W(0x310e13b055e86013), W(0x0d4f100036cac8fc),
+     W(0x00000000ad54d682)},
+    {W(0x17d6383c5fbb0825), W(0xf15ba9bb1d7bf20f), W(0xd918cba8e8f2dd00),
+     W(0x00000000bd20631c)},
+    0
+  },
+  {
+    {W(0xf96e1400ca9b47a0), W(0xe0808e46e4b66011), W(0xc8af18c854b0948a),
+     W(0x000000007a6944fa)},
+    {W(0x7d66b039c34337cb), W(0xb750d98bec918dc8), W(0x06197a5227c70de2),
+     W(0x00000000e277a765)},
+    0
+  },
+  {
+    {W(0x4b8a70090faa8566), W(0x2a4e08d882242dce), W(0x66b0a889ff6c791d),
+     W(0x00000000224b7086)},
+    {W(0x034dc3d978717355), W(0xc643bac95d43bfa7), W(0xc3c4b5c57d7285f5),
+     W(0x000000004a87d031)},
+    0
+  },
+  {
+    {W(0xba6596ad2427f43d), W(0xb9289c92a8291bba), W(0xf9a1709bbcc99dc9),
+     W(0x00000000beebbaf0)},
+    {W(0x15c9ab628d367c31), W(0xf8b72f6a495a9b9f), W(0xbf91fa158d09fb53),
+     W(0x0000000046135a2c)},
+    0
+  },
+  {
+    {W(0x96f347057c9357ae), W(0x2169f9f45a78b576), W(0xc2da99ed8c877299),
+     W(0x00000000d25005cb)},
+    {W(0x7edef9c4b9066bfc), W(0x7f10468ad415741d), W(0xb79541517d68ed3f),
+     W(0x0000000069a416df)},
+    0
+  },
+  {
+    {W(0x1d781ae5a7ce3bd7), W(0x5b8d3d15010da321), W(0x604465805466352d),
+     W(0x00000000136b472f)},
+    {W(0x32bb9f532092074b), W(0x39a5c0163718fd12), W(0x262369b12c6dd021),
+     W(0x000000008268e759)},
+    0
+  },
+  {
+    {W(0x32d15159a63e0ddc), W(0x2d388f394b828bdb), W(0x9155589bb774523b),
+     W(0x00000000cf23b3cb)},
+    {W(0x6fc0570e46688f1f), W(0x179f9e2593f73e95), W(0x7e8d781ce12db044),
+     W(0x00000000aac99c2c)},
+    0
+  },
+  {
+    {W(0xd71429528e346286), W(0x6239539d37aeb232), W(0x2d7e1e581228e070),
+     W(0x0000000086c6dc63)},
+    {W(0x026ab0ff3501d5fb), W(0x6c1002f5ebfc7a68), W(0xa1504c245a0e61eb),
+     W(0x00000000f1392a0e)},
+    0
+  },
+  {
+    {W(0x14be999c5904a49d), W(0x72496bedd2378a8e), W(0x0a427adcce6374d2),
+     W(0x00000000e280d22c)},
+    {W(0x6e07793a1400fd89), W(0x8d548e11cabdeefb), W(0xae31653f1089abca),
+     W(0x00000000e7d43c3b)},
+    0
+  },
+  {
+    {W(0x0359a075e26b4013), W(0x7f04f4f3a2ea2de3), W(0x55f1898e2eefef37),
+     W(0x00000000b27e3849)},
+    {W(0x8586c4c97078cbd6), W(0xdde1902bf33f84e4), W(0x9180533b26c0d59a),
+     W(0x00000000b15d4e8e)},
+    0
+  },
+  {
+    {W(0xb0f13638e2d28207), W(0xf031d7d7a06344de), W(0xb548d6131921c75c),
+     W(0x000000002f22f0c6)},
+    {W(0x70835cddf270e762), W(0x41fa75b6e01025eb), W(0x39226caf650a0371),
+     W(0x00000000328efbff)},
+    0
+  },
+  {
+    {W(0x37b84c135c6c9068), W(0x38ffeb456bea3085), W(0x858acd84d9627254),
+     W(0x00000000c2d29e09)},
+    {W(0x6be5303dbbda089c), W(0xf4bdaf09a32168fd), W(0x8b117aad5d666d48),
+     W(0x00000000dc58871f)},
+    0
+  },
+  {
+    {W(0xbcf9a72785628acd), W(0xbba77c0687c7f410), W(0xd25ed875761279b5),
+     W(0x000000009c969ca6)},
+    {W(0x894fed775c5de5a7), W(0x129790606310f0db), W(0x2deb318c3efa93a9),
+     W(0x000000003e0665e0)},
+    0
+  },
+  {
+    {W(0xa2b29d47facb5520), W(0xa1e30c9f01663a5b), W(0x5b27f29a344bbb7f),
+     W(0x00000000ce9f1a69)},
+    {W(0x90da981f7809dbcc), W(0xe0829c45f67b66f2), W(0xa4fd582890b89744),
+     W(0x0000000082db9d6a)},
+    0
+  },
+  {
+    {W(0x3faedc6cfed7e5c8), W(0x367c644e81e5f80c), W(0xd574fbde6fb4cf8b),
+     W(0x00000000df03a115)},
+    {W(0xb9ce082a3f7a743f), W(0x74e537ae54c8af70), W(0xef9da71210a2f501),
+     W(0x00000000c1a3e51c)},
+    0
+  },
+  {
+    {W(0x1ff8ee611f4ec300), W(0xf7e4c34eb1be6d82), W(0xe47c71463bdfc8e3),
+     W(0x00000000377aeb4d)},
+    {W(0x3dbdcd5fc5c6b7c1), W(0x0597023ff8d05651), W(0x4b707c8b082cc0fa),
+     W(0x00000000f6dff676)},
+    0
+  },
+  {
+    {W(0x916d6c258586a4bc), W(0x94b7a39374b92f26), W(0xcd486c01f7e98368),
+     W(0x00000000494599cb)},
+    {W(0x415abe3c8b94be15), W(0xb2c1600842893784), W(0x333174ca32affe39),
+     W(0x0000000052078ea9)},
+    0
+  },
+  {
+    {W(0x247c35545d918fa9), W(0xc737de0f6a01a413), W(0x773fc162fd5d7d1d),
+     W(0x0000000026954203)},
+    {W(0x9eb0cadacdc7fb9a), W(0xf0c4f53571d499d7), W(0x4bed991511088de2),
+     W(0x00000000b9341d88)},
+    0
+  },
+  {
+    {W(0x1c1c253a19e20806), W(0x37b4c2ee2e986fb9), W(0x465e459d9e13f153),
+     W(0x00000000a79e8b34)},
+    {W(0x42464ebde89180c6), W(0x39c666a2115e3bba), W(0x844603d96117b485),
+     W(0x00000000da1b9384)},
+    0
+  },
+  {
+    {W(0x5ba98a6d6fb47399), W(0x5d595575fc0d8b7f), W(0x980f2a1617bda024),
+     W(0x00000000ca396689)},
+    {W(0x77a6e0c0b929aee7), W(0xd76be0bb2191cd37), W(0x442b6cba7b7ff72a),
+     W(0x00000000d8873741)},
+    0
+  },
+  {
+    {W(0x30ea30f57844051a), W(0x15cfb4fb6cd76160), W(0xb1f70a1db2edd87b),
+     W(0x000000004ccb28eb)},
+    {W(0x664f1e440663189e), W(0xaec3bf93ed00b916), W(0x468978feb822e3cc),
+     W(0x00000000503c7273)},
+    0
+  },
+  {
+    {W(0x7e98db88456a15ba), W(0xa2ae112c203210e4), W(0x96452b4d8e4b0204),
+     W(0x0000000065e81f87)},
+    {W(0xf68cc51e8e1fb921), W(0xfbabf57bf709648f), W(0x116b1e40c1d28c2c),
+     W(0x000000004e6c88b8)},
+    0
+  },
+  {
+    {W(0x03c9cf338997dcc5), W(0x4c6b34818e503fde), W(0x0c753987f0acb119),
+     W(0x00000000bbda1a81)},
+    {W(0x6f4b6fbeddd61c34), W(0x03092d0679badfcf), W(0x4028320160955dea),
+     W(0x0000000012d979ce)},
+    0
+  },
+  {
+    {W(0x2e2c5a5fa675f016), W(0x70b975e22e59cd7d), W(0xa935f988d02e131c),
+     W(0x00000000ecbd77a1)},
+    {W(0x72e73f16d84cbe1b), W(0x8e46bd209bb9f0ab), W(0x939cf7bc8669d7cf),
+     W(0x0000000093d40994)},
+    0
+  },
+  {
+    {W(0x8d555141b6b28274), W(0x1d1880ae8a1482f6), W(0xc8b06015eb0edc91),
+     W(0x000000004da8594f)},
+    {W(0x56abd7ffe813375d), W(0x97dbafe8e3f15de0), W(0x4d644d665e7c22b9),
+     W(0x00000000c30cb3d0)},
+    0
+  },
+  {
+    {W(0xb59ace06d9e77f39), W(0xf810653b729ddff6), W(0x51cd5a812a563ba3),
+     W(0x000000002ed95a1d)},
+    {W(0xb9ee2aa15f1bd785), W(0xac6b2404e697535e), W(0x5a7b3ccc578c92bc),
+     W(0x00000000f57705e4)},
+    0
+  },
+  {
+    {W(0x2944dc71a30e44f1), W(0x63bdbf8e36e021e8), W(0x40426a2d8ec7a247),
+     W(0x00000000a69b756b)},
+    {W(0x5bc29a6a5048dd22), W(0x56bc4dce288af5a7), W(0x74440a21ac52971a),
+     W(0x00000000a7450bc7)},
+    0
+  },
+  {
+    {W(0x733693276cb75212), W(0x1f268df879055b05), W(0x8935f76a22fc3b85),
+     W(0x00000000135e6ab9)},
+    {W(0x12317275d97b018a), W(0x7da28caf3e8cf985), W(0xbd3a5ddfcd60e65c),
+     W(0x000000005c5861ec)},
+    0
+  },
+  {
+    {W(0x448a6c665de33d90), W(0x4247bff4ca540f4f), W(0x71b62e9dcd330eb9),
+     W(0x0000000021a233f9)},
+    {W(0xf9997f625a263def), W(0x828247f9c3e863e6), W(0xdfcd4fe26914f168),
+     W(0x00000000370140f4)},
+    0
+  },
+  {
+    {W(0xb82302cde256a69b), W(0xcded5b4991e601f3), W(0xb81f235d93cdf673),
+     W(0x00000000ea21b113)},
+    {W(0x61c79cad07b99836), W(0x6a67c18c0a2cdce3), W(0xd3fb6bec13befe71),
+     W(0x00000000b63339c6)},
+    0
+  },
+  {
+    {W(0x19de9480af38188d), W(0x162def26b7d2af71), W(0xe4f74d8d45a79e79),
+     W(0x0000000015415ccf)},
+    {W(0xd3342b8770397e42), W(0xad06492b6d775adf), W(0xdb085fdc1c4bdb37),
+     W(0x00000000c1b28af5)},
+    0
+  },
+  {
+    {W(0x63a3848da6cf69a6), W(0xe39b5527ef36ef97), W(0xdceaf2b7fc38a77a),
+     W(0x000000009b9e0b11)},
+    {W(0x7cbe9897f2547c04), W(0x2eaf305ced1d2798), W(0x867283925d72d00a),
+     W(0x00000000e6a9f05b)},
+    0
+  },
+  {
+    {W(0x670f603137f15e58), W(0xb62f27c58ec0db49), W(0xe77aa9241490a807),
+     W(0x00000000ee6f54fc)},
+    {W(0x906dc816c43754d3), W(0xd05e4cbf2a777bb7), W(0x0aaa8de7bb0736ed),
+     W(0x0000000064acd186)},
+    0
+  },
+  {
+    {W(0x2ad818a2612058ab), W(0x01843c7a0b635755), W(0x1854d80a0df09b27),
+     W(0x0000000088f3bd2b)},
+    {W(0x9532cc2efe2a8083), W(0x1480277d512b807c), W(0x9fc7011bc98f4918),
+     W(0x0000000099286ef5)},
+    0
+  },
+  {
+    {W(0xf03814178288191b), W(0xab6358f4d1244e15), W(0x3b954b32ab07ca94),
+     W(0x00000000c2f41aa4)},
+    {W(0x7b31a5a0f60a4be2), W(0x9dfe4e9638ae6e0e), W(0x314dfb4919166e6a),
+     W(0x000000003aa01e86)},
+    0
+  },
+  {
+    {W(0x9af4802f2285cafe), W(0x8d2482aa08446543), W(0x3f778c41add82280),
+     W(0x00000000359e01f9)},
+    {W(0x14381934a3f60368), W(0xc7fb0d414dba60a8), W(0x5eccd9130739c64d),
+     W(0x000000004cda8395)},
+    0
+  },
+  {
+    {W(0x2aa78f140ec7ffc8), W(0xf72e5d38ed9759be), W(0x2280ed9210901406),
+     W(0x0000000070be49bf)},
+    {W(0x92ab92c6c2744ded), W(0x3ecf42c021a3ea17), W(0xf136df1bf3a7e621),
+     W(0x000000008d2e7c62)},
+    0
+  },
+  {
+    {W(0x5fe8d6e0c578a26f), W(0xab38023bb57e4d82), W(0x1791935799f85c87),
+     W(0x00000000524842c0)},
+    {W(0xd5f01511e122670c), W(0xd2b73685cc16b85f), W(0xf7c217d11e8eb55b),
+     W(0x000000006fff502e)},
+    0
+  },
+  {
+    {W(0xfce26f9a1acf3e3f), W(0x49538409679d53a9), W(0xfc334ae9e2c9a17a),
+     W(0x00000000b747b2d3)},
+    {W(0xd1ab41753fe75936), W(0xc89adc498c956e96), W(0x58c540de14ee931e),
+     W(0x000000007b642e6d)},
+    0
+  },
+  {
+    {W(0x7955b4b99cdd4007), W(0xb6b74d6d4afb2af6), W(0x3a787e06ad36e118),
+     W(0x000000003e31698d)},
+    {W(0x76e23a207759f863), W(0x5b8c802afeabdacc), W(0x7a9ea34a10a4e0fa),
+     W(0x00000000e5660440)},
+    0
+  },
+  {
+    {W(0x5d39d5946052dbe0), W(0xec232696720c1786), W(0xc3ae77f9695d053c),
+     W(0x0000000015fef9e9)},
+    {W(0x193e321d3312734a), W(0xd6727d3fdc0b423d), W(0x59e21792abb46731),
+     W(0x000000007580fb0c)},
+    0
+  },
+  {
+    {W(0x399a2011f29ec356), W(0x3aa2e4e3c535b95d), W(0xa604aeacf97dc70a),
+     W(0x00000000a7ad8cc1)},
+    {W(0xd4452193ded0e227), W(0x5975e5902245307f), W(0xac3ee6114c1753f5),
+     W(0x0000000072082489)},
+    0
+  },
+  {
+    {W(0x2cce16b243a75028), W(0x96972a77776c000a), W(0x39c49f36d30436df),
+     W(0x00000000956464f1)},
+    {W(0xe098d67d5393c001), W(0xcc5ba1ab0b3564ac), W(0xeb344d928f9ee795),
+     W(0x000000001f632b15)},
+    0
+  },
+  {
+    {W(0xf7026e446c4bdb81), W(0x63f4b1fd69927366), W(0x6b685fcc06acddc7),
+     W(0x0000000038646daa)},
+    {W(0xc9dd8c80462a1fde), W(0xff66cbc59976f4cb), W(0x45a81ce274ec2d4f),
+     W(0x00000000f593089e)},
+    0
+  },
+  {
+    {W(0x844e07a77f1ae228), W(0x8e9878722682447a), W(0xd0d74dd234bc502d),
+     W(0x00000000061adfe8)},
+    {W(0xb9ce06c97fefcddb), W(0x8a9ee231944750a1), W(0xfb2d1bb3299af0c7),
+     W(0x00000000089d35dc)},
+    0
+  },
+  {
+    {W(0xea89f3849b3af6b4), W(0xd8cf06794205f287), W(0x97702e72d58784a7),
+     W(0x000000008b580559)},
+    {W(0x583698889315e8a4), W(0x378c95ce684ca079), W(0x86c51d6998641d7d),
+     W(0x00000000ce584d10)},
+    0
+  },
+  {
+    {W(0x08db40accf143538), W(0x2162a65fdbeac8cc), W(0x7cb704542e9fac6b),
+     W(0x00000000d4eb21d0)},
+    {W(0x34787ae72bef4795), W(0xa6c022fae25cd501), W(0x09f3db83408de325),
+     W(0x00000000e60488e3)},
+    0
+  },
+  {
+    {W(0x8c0c6e0cce5e255d), W(0x54908ee01e3f78de), W(0x416beabcd86f610d),
+     W(0x00000000074d43a6)},
+    {W(0x1dd5560f38c7e583), W(0x93ccb211d8799d48), W(0xf3f32de5d18dedb1),
+     W(0x0000000098046288)},
+    0
+  },
+  {
+    {W(0x46ec403a67e7b0b2), W(0x69c17eb57d2fa9ba), W(0x7e9508848a3fa513),
+     W(0x000000008078f503)},
+    {W(0xaa7069feeef7a1f3), W(0x546c981a8ab16252), W(0x4786a56041bdf411),
+     W(0x000000006ab2edeb)},
+    0
+  },
+  {
+    {W(0x1aaff716c164d994), W(0x455121ccf50c5191), W(0x7c0bddb087ac9efa),
+     W(0x000000001bac46dd)},
+    {W(0x449bf5660676c787), W(0x1fd98740252574f2), W(0xc5dee82f5f9b26a0),
+     W(0x00000000d1431968)},
+    0
+  },
+  {
+    {W(0x8a031ba36cf01c4b), W(0x68f88431f140db67), W(0xe05d998069d0a624),
+     W(0x0000000029054860)},
+    {W(0x98ee830632c6ff56), W(0x22c7ac2724013fa3), W(0x0173645a8ab67948),
+     W(0x000000001efdf97d)},
+    0
+  },
+  {
+    {W(0x86882810cd39d38a), W(0xd4519bc34ac1d31d), W(0x7f2d46ab2f79bd10),
+     W(0x00000000cbbff35e)},
+    {W(0x4bda1326186a318c), W(0x7a3be0295983b6ff), W(0xee313c4504a1cc73),
+     W(0x0000000039e9dcba)},
+    0
+  },
+  {
+    {W(0xcf23fa41435084c0), W(0x5fea4760e3ca5986), W(0x5f64d409027d584f),
+     W(0x0000000073762fd3)},
+    {W(0x58df154509d8b92c), W(0x12ef61f81ed9a568), W(0xaf40fc3b14a841e1),
+     W(0x0000000053bd0a37)},
+    0
+  },
+  {
+    {W(0xac8de0111dc27cc4), W(0x8c56f8ea5a0c2ced), W(0x3ffa7cd0d0799266),
+     W(0x00000000c7bc1c74)},
+    {W(0x9b7a70fa02f2e794), W(0x1adbbae943b76a7f), W(0x22a88277b5b66658),
+     W(0x00000000999b2157)},
+    0
+  },
+  {
+    {W(0x64fa749fb91142ea), W(0x2802860a8197820b), W(0x97ed3680b01cf34e),
+     W(0x0000000042800a1d)},
+    {W(0x5c40adcc8bacf503), W(0x13e64fbc002c33ce), W(0x0d7e402c5f1a8812),
+     W(0x00000000baa8f872)},
+    0
+  },
+  {
+    {W(0xbd5b936ec40cdadc), W(0x16b3baeaf6bc1498), W(0xf1c115e2cd96b2de),
+     W(0x00000000e9209d2e)},
+    {W(0x29aeff4049fddc7f), W(0x99e80eb4e14c0fba), W(0xfa8bfd1d9993f25b),
+     W(0x0000000029a71e69)},
+    0
+  },
+  {
+    {W(0x21e7cc7f03fd6ee9), W(0xeb47a6004b6f9ea5), W(0x61eb23fdf3fbcb92),
+     W(0x00000000827fb925)},
+    {W(0xe66cc80becef164c), W(0x013b154684ca9c3a), W(0x593e2f6cf06685cd),
+     W(0x00000000ec964a68)},
+    0
+  },
+  {
+    {W(0xfff36f59478cac8b), W(0xb5126642d0e05fc9), W(0xc923401aec1c55cb),
+     W(0x000000008a0f2994)},
+    {W(0xd6fe235a7625f14b), W(0x0e97f5b63c487b92), W(0xd4aa8b448e69797a),
+     W(0x000000000dac2791)},
+    0
+  },
+  {
+    {W(0xb75100e1bfbead22), W(0xe23b747e84be9492), W(0x783b613cc5f68948),
+     W(0x000000007e2fb86c)},
+    {W(0xce02694935b13dfe), W(0xfebef2b760aa8057), W(0xd0f150368b277e4c),
+     W(0x00000000ddafce5e)},
+    0
+  },
+  {
+    {W(0x3d490a89fdd99439), W(0xd42f1ee2f5ce0ece), W(0x511217a9a369c1f0),
+     W(0x0000000058329607)},
+    {W(0x28ffb15b34f881c0), W(0x3727b273328b9547), W(0x2242c7bc1ea5b11e),
+     W(0x00000000d93e9492)},
+    0
+  },
+  {
+    {W(0xd4462038c4fd0901), W(0x65b4a63158aebe53), W(0x8fd005abb9fc0f56),
+     W(0x00000000a1e9c755)},
+    {W(0x2a1dd8135dbe27b2), W(0xc36b6a3dae4cfe9e), W(0x26825c6a88618dcb),
+     W(0x00000000fa646313)},
+    0
+  },
+  {
+    {W(0x2651640e64f74f1a), W(0x50a4606c91474207), W(0x35f2e7915fd64086),
+     W(0x00000000839c68c5)},
+    {W(0xa18434e3c3c07db0), W(0xba921ba62b7c11c1), W(0x45c202c6eac838c3),
+     W(0x0000000035f826a3)},
+    0
+  },
+  {
+    {W(0x69f4adffc037ccfb), W(0x93ba8dbbf19adcc8), W(0xc7c03403f7850a6c),
+     W(0x0000000056e4542f)},
+    {W(0x099e6ca08af41c79), W(0xf8090ba8d387fb45), W(0xedc83646cbd76b7e),
+     W(0x000000003f2a5635)},
+    0
+  },
+  {
+    {W(0x0cd54e7b2044f674), W(0x195ccf2bd457c395), W(0x054ac9b0fbba2e25),
+     W(0x0000000053cde11d)},
+    {W(0x86f58c60c5f192ce), W(0x57da066aa2c1d5db), W(0xff346b552a42275c),
+     W(0x000000004e910e3e)},
+    0
+  },
+  {
+    {W(0xc1fba58c83e7dc55), W(0x6c640df9d3dd1c54), W(0x286b9a2470dd0439),
+     W(0x0000000011d9fb10)},
+    {W(0xd2e59b2bcfa0a4f2), W(0x28aa3c558690778f), W(0x2b411b4b97b81e49),
+     W(0x00000000ded05cc5)},
+    0
+  },
+  {
+    {W(0xd2f259313c0ce4c0), W(0x4da75d922d7f6978), W(0xd9713ad5226ad213),
+     W(0x0000000065749528)},
+    {W(0xc7cd5b092861e228), W(0xbc28ccb42b8cc168), W(0x4f168567b1e55502),
+     W(0x000000007defcdba)},
+    0
+  },
+  {
+    {W(0xbcc604d1bf830886), W(0x3bb33c66fd12738b), W(0x4aea428df23d5234),
+     W(0x000000004b2d04ca)},
+    {W(0x9134eff720d9e4e7), W(0x6af2b12d83307be9), W(0x7f109fb39a34c9b1),
+     W(0x0000000050a64d8b)},
+    0
+  },
+  {
+    {W(0x7b4cea681748a167), W(0x6ea403eeb74a3dff), W(0x200ff5a0ab6119f9),
+     W(0x00000000c511dabf)},
+    {W(0xcaa038f33d57d24c), W(0x3cfd43b28db376b6), W(0x9cbdc8a15e32288e),
+     W(0x00000000d457a552)},
+    0
+  },
+  {
+    {W(0xfe3c3002bac1060a), W(0x48a00e02ff54b4f0), W(0xa91f2719adfffe5a),
+     W(0x00000000a94933c3)},
+    {W(0x75c2c92fda198ba6), W(0xf6434261c56c620b), W(0x9ad81a57a710a7fa),
+     W(0x00000000b414bc3d)},
+    0
+  },
+  {
+    {W(0xf587d423f87cb901), W(0x017cff93aac8b7a9), W(0xaa0364cd0ef2e3c9),
+     W(0x00000000ab5cfd78)},
+    {W(0xa0c69e3699d6ce84), W(0xc4fedf4c7b9cf127), W(0x6f5433583ab69c3d),
+     W(0x00000000421bfd52)},
+    0
+  },
+  {
+    {W(0xdcd87e28aa2a9458), W(0xa4e2a84706934660), W(0x3884ff3f53d92eaf),
+     W(0x000000004cab8953)},
+    {W(0x145c96feab0238b2), W(0xda8a37b455671e1a), W(0xe816dfc0c62f4957),
+     W(0x0000000059646c11)},
+    0
+  },
+  {
+    {W(0x336b1a29d785da35), W(0xfc62d403803bd288), W(0x2dc130eb466a41c9),
+     W(0x00000000e06cde72)},
+    {W(0x9197319fe357e474), W(0xf66d2a5c7e48c70d), W(0xb9f0b9e19795fc9c),
+     W(0x0000000025abeb63)},
+    0
+  },
+  {
+    {W(0xfc236ff7d48b8629), W(0x64b65c9763952584), W(0x62c2c7c79459a194),
+     W(0x0000000008ecb884)},
+    {W(0xc2a17a9ef0eea6e4), W(0x7fcf1ec80de55ada), W(0xdb66a0006fd6b079),
+     W(0x00000000f192917f)},
+    0
+  },
+  {
+    {W(0x38bb395706c7beb1), W(0xc49aca10d725ce8a), W(0xec84b5ead225eef2),
+     W(0x0000000018a3cd02)},
+    {W(0x9151f5cd02a76020), W(0x60e98fd3c5dec4ac), W(0xccb4378cb6dfb571),
+     W(0x000000004518d8c3)},
+    0
+  },
+  {
+    {W(0xa133027436a60863), W(0x7ef5abf992991618), W(0x35be8a4d820d04da),
+     W(0x00000000a3a47491)},
+    {W(0x3a115c78e80dd781), W(0x4696ab6f226ae934), W(0xc99679779009aaaa),
+     W(0x000000009f42f864)},
+    0
+  },
+  {
+    {W(0x4284e477cfb08e1c), W(0xb3578b4c5abf639e), W(0x65e0cf7878c9298b),
+     W(0x0000000063e3593e)},
+    {W(0x21e0bf59668804d3), W(0x61e7c81c78bc7169), W(0x2bc3d39b309d2958),
+     W(0x00000000b740ca3b)},
+    0
+  },
+  {
+    {W(0x8212ea4f231fd5ae), W(0x9c542fc1136881d5), W(0xe1869be5058ef9a4),
+     W(0x0000000085cc445e)},
+    {W(0xe6ef564e8495ff72), W(0x2fe25dda7106b467), W(0xb4cf12db26c3fa01),
+     W(0x000000002655c36b)},
+    0
+  },
+  {
+    {W(0x92a12c11568bba05), W(0x1c7cfb380e286c7b), W(0xcf207b5e971a92a6),
+     W(0x00000000c979b4ec)},
+    {W(0x008d7bd36bd057b6), W(0xf6289d108c854d19), W(0xce07ae55b376b38e),
+     W(0x00000000270d7211)},
+    0
+  },
+  {
+    {W(0x1408401aaa9f9e48), W(0xc722a73ccd8c5a18), W(0x535edc77c581eee3),
+     W(0x000000002caeec91)},
+    {W(0x895dc07648afc022), W(0xdf84e9dd6be54cba), W(0x1de49ceaf639bfe9),
+     W(0x00000000427325a9)},
+    0
+  },
+  {
+    {W(0xf51242e5b99bdf7d), W(0xd7e2d9637e82b360), W(0x9ca6b83510e25931),
+     W(0x00000000a465623f)},
+    {W(0x19a6e5c12fcc05fb), W(0x8dc57c0f5a990205), W(0x5785633fdb9448d1),
+     W(0x000000007364ef08)},
+    0
+  },
+  {
+    {W(0x030aa9a40495f0c4), W(0x8d3fb9c3b247cce3), W(0x43ad4b27e9df58f3),
+     W(0x00000000366f2822)},
+    {W(0x5dbac0fc5924186f), W(0x631d8b7762442f72), W(0xcda555a61c7ba42f),
+     W(0x0000000098b58de4)},
+    0
+  },
+  {
+    {W(0x23c1583b68081e35), W(0x9409c02aca7aabf4), W(0x13b897e99f82a76d),
+     W(0x00000000ce5726cf)},
+    {W(0xe7f02e60be3832f5), W(0xc4cfafcb3df1169c), W(0x88fcd6139480a211),
+     W(0x000000001d630a7b)},
+    0
+  },
+  {
+    {W(0x8a15dcffb231d318), W(0xbde21f3b7b255d23), W(0xa70062b28c969708),
+     W(0x00000000bcdc84f7)},
+    {W(0xffb74fcc9e405e44), W(0x09b123f5be749123), W(0x2b760acc8b21b9bb),
+     W(0x00000000fdb47523)},
+    0
+  },
+  {
+    {W(0xedb1d8c8ec1ec01f), W(0xe70d415712a17bbd), W(0xfb0b480b056d8313),
+     W(0x00000000af2f1c55)},
+    {W(0xd3e4173363dc1624), W(0xf7abf187c11d0f2d), W(0x52724667a33ea3f3),
+     W(0x00000000ecbc8e3d)},
+    0
+  },
+  {
+    {W(0xc678f136e3f9316d), W(0x7adec93f7361983e), W(0x389fb46cb18bddeb),
+     W(0x00000000b08d7c56)},
+    {W(0xb53491b9a56aa87b), W(0x98c79c2365f7d1d5), W(0x0775434f1e17342a),
+     W(0x000000002395f20a)},
+    0
+  },
+  {
+    {W(0xb02b54c628e1c833), W(0xb68996ed95b1cad5), W(0xa5958039f97fe691),
+     W(0x0000000091342cb3)},
+    {W(0xd131cf213b33f9f6), W(0x1536f174894677c7), W(0xf849801c9788f523),
+     W(0x00000000add29c26)},
+    0
+  },
+  {
+    {W(0xc078145780827572), W(0x95cf5f3e31669227), W(0xd30b199488d2b253),
+     W(0x0000000035c590bf)},
+    {W(0x437bb5f5d43d26d0), W(0x68b4715ca380772d), W(0x16d665883e05baaa),
+     W(0x00000000398ff4e2)},
+    0
+  },
+  {
+    {W(0x715120dc3ac71731), W(0x7dd580cd22709e0a), W(0x8eb1ec22c565cc4c),
+     W(0x0000000025a060bf)},
+    {W(0x73b151c29450b126), W(0x9de0ca92ae2877d9), W(0xe52487145f0d72c5),
+     W(0x000000006bf7349f)},
+    0
+  },
+  {
+    {W(0xc78916114a34a06e), W(0x1664c50112ffe27a), W(0x3360e64c0ba77b4c),
+     W(0x000000000b5bf30f)},
+    {W(0x33f07101f7590e87), W(0xd0a0185bdf3ee049), W(0xe81b984c4ad24268),
+     W(0x00000000c0651597)},
+    0
+  },
+  {
+    {W(0x7beb66dd8ad4fee4), W(0x3247360c0b3fcba1), W(0x7c5825ec0d9b22df),
+     W(0x00000000dca74294)},
+    {W(0xb472eeff49b206f9), W(0xacc0affb293edb31), W(0x639e87d41f004d73),
+     W(0x00000000d317f65a)},
+    0
+  },
+  {
+    {W(0x09d8d26c77a16229), W(0x152bdcb1e3eabf23), W(0xe7fbf4c6e6f96208),
+     W(0x0000000098405876)},
+    {W(0xaa6f251c52b7eb36), W(0x4f145d4562c08734), W(0x53ccf87379b08f3c),
+     W(0x00000000d088507e)},
+    0
+  },
+  {
+    {W(0x4896b3e3b7a9afa0), W(0x8d9b6aecae219817), W(0xab2ba4ed87fd74a6),
+     W(0x00000000560cc4e6)},
+    {W(0x19f373cfc880665f), W(0x45b87be25fa3de80), W(0x9095f3fc0273ef6c),
+     W(0x00000000c2ed8f62)},
+    0
+  },
+  {
+    {W(0x711cfd0c204e6141), W(0x9e4f41965b698889), W(0xbe15e2539c4a92a3),
+     W(0x00000000cabebc74)},
+    {W(0x1dc025dfa522aee0), W(0x33984f0af5628c02), W(0xa8e4ab84480f84d8),
+     W(0x000000006770df1d)},
+    0
+  },
+  {
+    {W(0x978e87cc9fa1908b), W(0xd8d6dfe3e793f7ea), W(0x7588ba3511c5e4dc),
+     W(0x000000004fb5ecf5)},
+    {W(0x4bc25dda409bd663), W(0x70226fbcb7d5b346), W(0x0adadd8a6ea97412),
+     W(0x000000000d08adc9)},
+    0
+  },
+  {
+    {W(0x2a758bce559607be), W(0x83609d6091cdcdf5), W(0xf2c271817b19986b),
+     W(0x00000000c8781642)},
+    {W(0xefd88ea34044d049), W(0xbb5d4c9d2f0408c5), W(0x92ec7b47a097b960),
+     W(0x00000000aac72475)},
+    0
+  },
+  {
+    {W(0x6a5d0fba224033cc), W(0xbf18e88e5e0631a0), W(0x7e5f9f9ef90b04c1),
+     W(0x0000000014f1e5bf)},
+    {W(0x46206b942040021b), W(0x936ffab896b01702), W(0x8075acadd3a83245),
+     W(0x00000000af02a6d1)},
+    0
+  },
+  {
+    {W(0x59b580cbce3983ea), W(0x9344d9a149f3294c), W(0xe25253e959ead6ff),
+     W(0x0000000044e21c29)},
+    {W(0x9e254f4bfd0476c7), W(0x52d92329b541ab55), W(0x1f81248a75d86b67),
+     W(0x00000000f83d0eb2)},
+    0
+  },
+  {
+    {W(0xe004c32ab00a56ba), W(0xa1a9b9e3fea5f0a6), W(0xff17d49e389fa0b3),
+     W(0x000000000f01f3ba)},
+    {W(0x05c9c2b2c17b167a), W(0xfb25c2bcfe742b11), W(0xa8a3f672a4ddc574),
+     W(0x00000000513dd12c)},
+    0
+  },
+  {
+    {W(0x05b0d459bd3687f0), W(0x597cb26407e36920), W(0xb2ab23d242b94535),
+     W(0x0000000058d7fe40)},
+    {W(0x76c879c9238ba4e6), W(0xadeb910871030531), W(0x3955ab44c6367755),
+     W(0x000000001449897c)},
+    0
+  },
+  {
+    {W(0xf57e5c3e20152716), W(0x955f30ffc4bf0710), W(0x91773cee46fd686e),
+     W(0x00000000af47e967)},
+    {W(0x469d15eacd48a3f6), W(0x6070ed3c5cde086e), W(0xd6b2e7e455375c03),
+     W(0x000000000e405fa3)},
+    0
+  },
+  {
+    {W(0x5de1bde6bf8d627c), W(0xe7a9b6e99f326ee4), W(0x3695595de4d2fc63),
+     W(0x0000000005cd4ec5)},
+    {W(0x6796c2d2532a056d), W(0x1ce43fe89a97c266), W(0x261733a024b3c095),
+     W(0x0000000035c992e9)},
+    0
+  },
+  {
+    {W(0x0ef004b90856baab), W(0x65b012ef420cdc12), W(0x717f37c0d4d6b3ed),
+     W(0x000000003ee909fe)},
+    {W(0xf958d3020c544dca), W(0xa78891b270d6cb2f), W(0x73992bee0b963c75),
+     W(0x0000000024f9df30)},
+    0
+  },
+  {
+    {W(0xac0e2d7d3bf00414), W(0x534ecdaed5b94d6c), W(0xde35124d4c535b5c),
+     W(0x000000002b76ea57)},
+    {W(0x53b510915610104b), W(0x4869b08829e8969b), W(0x1226b26d4153edbf),
+     W(0x000000000e0e07b4)},
+    0
+  },
+  {
+    {W(0x2e7f68b33e9381b6), W(0xccbb21bd2d5a5192), W(0xc0cf51c2f672a77f),
+     W(0x00000000cfaaae2a)},
+    {W(0xbdf2576a516c52f1), W(0x13f7490ea037a4ad), W(0x38f8f65fd3bc52b2),
+     W(0x000000003bf0eb67)},
+    0
+  },
+  {
+    {W(0x2004a7244443df3d), W(0x9b2c4fd43d3cfe44), W(0x322c37d28b540e41),
+     W(0x00000000f723598b)},
+    {W(0xe4452ca9590208b7), W(0xda0aa07af9769599), W(0x56aefdf0924ac5be),
+     W(0x00000000eb6016b9)},
+    0
+  },
+  {
+    {W(0x73546d0ca6e7e6a9), W(0x8fced2c0fb1b4ec8), W(0x59772dec3293aaba),
+     W(0x000000009922ee6a)},
+    {W(0xc8ec0b3d232dce54), W(0xc272b19c40ac00b1), W(0x5a7cef9c1c4f0531),
+     W(0x00000000b2703925)},
+    0
+  },
+  {
+    {W(0xd5364cbc7faad77a), W(0xe16b73b92d343653), W(0xfc40febaa81d9c70),
+     W(0x000000006fe50c20)},
+    {W(0x2862ae335d9840cd), W(0x6ae3be6ae88f06bf), W(0xa75d5cc158148329),
+     W(0x00000000a40e41ce)},
+    0
+  },
+  {
+    {W(0xbfa346641b934809), W(0x0863cea17988f7f2), W(0x0b05c20d9086e495),
+     W(0x00000000be449229)},
+    {W(0x9b7a83a1be9ec549), W(0x06c7edb1239e02e8), W(0xc5ffbae60d4b0dc2),
+     W(0x0000000067bb6f1c)},
+    0
+  },
+  {
+    {W(0xb83466b8dfacfa50), W(0x66421c734775a000), W(0x0b7c783daa507515),
+     W(0x000000003e696d92)},
+    {W(0xf47ff0c60957aa3f), W(0x3522f3e81a0c15f8), W(0xe87cbb17b1a778fa),
+     W(0x000000005953f9b4)},
+    0
+  },
+  {
+    {W(0x2fbb537f383609ee), W(0xf13aa357cfac3049), W(0xd825c08723918736),
+     W(0x000000005b9afa2a)},
+    {W(0x2fe8b634429a4c00), W(0xaada5436c9f40b92), W(0x28cb1b8147bfb8ca),
+     W(0x00000000ada6fb53)},
+    0
+  },
+  {
+    {W(0xa2bda89595d5edc4), W(0xf930cdb22499d4db), W(0xd20bb7a79fdfa8fa),
+     W(0x0000000013f6e854)},
+    {W(0x477c9acbccccc542), W(0x686fe781ec168cd2), W(0x83841f6c0f7f50fe),
+     W(0x00000000eefaf3a7)},
+    0
+  },
+  {
+    {W(0x15f56d071ca07c6a), W(0x235b67efe7691208), W(0x2e91028eddcb9e03),
+     W(0x00000000c84401e9)},
+    {W(0xb8909720c5ca9e42), W(0xc27eed38a7c8521c), W(0xa2051441f2fafe98),
+     W(0x0000000094186215)},
+    0
+  },
+  {
+    {W(0x02e8abaf872b84e4), W(0xf92cbef376b32b88), W(0x5982c6414690d1c9),
+     W(0x000000007ce50942)},
+    {W(0x45782b6a23114d7f), W(0xe122ba7473f4bcd2), W(0x4511e93d758a44b1),
+     W(0x0000000022a5127e)},
+    0
+  },
+  {
+    {W(0x3bf9a74429923602), W(0x54157999b6786f5c), W(0x627db3da14906bee),
+     W(0x000000002bdf02b0)},
+    {W(0x19af607871efe894), W(0x1232ce859d1166d3), W(0xa121d5a567e1408a),
+     W(0x00000000a45f4ee3)},
+    0
+  },
+  {
+    {W(0x51601445c2b61ea4), W(0x2e07fb3c36490bbf), W(0x1cffe02f0e2a119c),
+     W(0x000000002403b991)},
+    {W(0x2d2de5bb2d9f8125), W(0xcf2ad1b8f41f24d2), W(0x7c3d7b6c55a2cad8),
+     W(0x00000000ac50364f)},
+    0
+  },
+  {
+    {W(0xe488dd0cbd8eacee), W(0x0203f08957bcff4a), W(0x2617645e40793384),
+     W(0x00000000fbfb76af)},
+    {W(0x07782b613f76c846), W(0x0ea7a5d0c5abd3f3), W(0x840e33b9aed5f300),
+     W(0x0000000014b89580)},
+    0
+  },
+  {
+    {W(0x79ef07c7faebde2a), W(0x719605ac27927981), W(0x9f1d0f4ab4b81992),
+     W(0x00000000dd50aa84)},
+    {W(0x2ba12ee9ccb7ff9e), W(0x018ddda8f25e2d10), W(0xb4a8ebfdacabe2aa),
+     W(0x00000000ac8d3915)},
+    0
+  },
+  {
+    {W(0xb7ffd5bdc7f70dac), W(0x68707ba9f896b8b6), W(0xb4fb429cc4362072),
+     W(0x0000000021622ec4)},
+    {W(0xec23e73194c09cbf), W(0xe62256eaa8e8e101), W(0x1ca5a2eeb762842e),
+     W(0x000000009c0d2faa)},
+    0
+  },
+  {
+    {W(0xca7bf8806a96802a), W(0x7286e2632618d6a3), W(0x923f88df86220746),
+     W(0x000000001a172ce9)},
+    {W(0xe70b7cc36e753650), W(0x67ad275e269632ce), W(0xb3f3bedb4d9cb206),
+     W(0x0000000026cfca0a)},
+    0
+  },
+  {
+    {W(0x540f2e20db89bb2f), W(0x075674005aecb366), W(0x0b9e966e8b56c720),
+     W(0x000000008476e10e)},
+    {W(0xd784cf3a430a88e5), W(0x1e8443960892b822), W(0xde71a4b902af6de6),
+     W(0x0000000056cad721)},
+    0
+  },
+  {
+    {W(0xfdacff868c0a61de), W(0x0cdea4ca01437c29), W(0x080cce6949268cb6),
+     W(0x0000000070301479)},
+    {W(0x7d2165b53b6c4620), W(0x29e972292de26ae0), W(0xa346c53a78ac0e59),
+     W(0x00000000e55442fd)},
+    0
+  },
+  {
+    {W(0x166fa981fccc2c2d), W(0x71478461e7e433af), W(0x56947eae0b1266f8),
+     W(0x00000000624d0cd2)},
+    {W(0x50c9b4e33881f8b1), W(0xe436f6b23759fd41), W(0xe36cce840637e324),
+     W(0x00000000406b04e9)},
+    0
+  },
+  {
+    {W(0x9812a8ca691b45c9), W(0x86b06a5f707b3a7e), W(0xebe0de2ceeb00da8),
+     W(0x000000002dd48e4d)},
+    {W(0x34102e871f2c0ab2), W(0xa29f8ce8c312df5e), W(0x37dd550bb48d3910),
+     W(0x0000000062b2d471)},
+    0
+  },
+  {
+    {W(0x48dacc1851900288), W(0xe317ec66346792bc), W(0xd42cd85ecb1131c2),
+     W(0x00000000585f346e)},
+    {W(0x4d7b3bfc9af41b03), W(0xfce71cde817c6ef8), W(0x3e4f7a7471785c74),
+     W(0x0000000058d1a96a)},
+    0
+  },
+  {
+    {W(0x4aee2c8f0a002597), W(0x11e99addf5946a2a), W(0x90816984a3797d15),
+     W(0x00000000d3b1ffc1)},
+    {W(0x3a6fbbd65e8801c6), W(0xb4a6bb9140cdd487), W(0x94a866c1aa30316d),
+     W(0x000000004d87d51e)},
+    0
+  },
+  {
+    {W(0xc72f49666d9c60ea), W(0x301d2ed02e678ec2), W(0x397804b0cae6c596),
+     W(0x00000000d3503805)},
+    {W(0xf33b15c2bec575db), W(0xc75c9d969d651453), W(0x6d7b0f3b58bf2f4c),
+     W(0x00000000aa02913c)},
+    0
+  },
+  {
+    {W(0x2de4a086c04ee885), W(0xd384127bfce9b3f6), W(0x3da4ba9cd8739ffa),
+     W(0x00000000115f52b3)},
+    {W(0xd99a3257b8cfe909), W(0xf090d943398a8971), W(0xffa2a082bc49f555),
+     W(0x00000000c5c84715)},
+    0
+  },
+  {
+    {W(0x462b9f44fb8dafdd), W(0xde84d94eae9db1c2), W(0x76582c6a40b4ab47),
+     W(0x00000000a30f060f)},
+    {W(0xf20f66a54a514b81), W(0xd43987709ba80fd8), W(0x6d0e2ea8deb199e9),
+     W(0x00000000b782e138)},
+    0
+  },
+  {
+    {W(0x5478f5a32a2af3da), W(0x1afccba47b17ee38), W(0xb90e47e9834be162),
+     W(0x000000006c089034)},
+    {W(0x0aba69dab6e8370d), W(0x3188077d15c36664), W(0xb8865f20312c7261),
+     W(0x00000000c396ba48)},
+    0
+  },
+  {
+    {W(0x37a6b057a8a5c24d), W(0x6ef8e40933a57f9b), W(0x4498fc25d7f33169),
+     W(0x00000000fe940ef5)},
+    {W(0xd7f11b07190c4625), W(0x492b2ce7e10cb48e), W(0x5cc980029cb1a4bd),
+     W(0x000000004cb0b5ee)},
+    0
+  },
+  {
+    {W(0x082c2ac9ba4980ed), W(0x8af13d5f2979a998), W(0x123c424caf3af93d),
+     W(0x00000000fee304b4)},
+    {W(0x501fc72c3f32fcf8), W(0x981231f3f7603254), W(0xc414c540ba57b066),
+     W(0x00000000ab614acd)},
+    0
+  },
+  {
+    {W(0xdf837dc7d4235fc0), W(0x0621cb608858e9fb), W(0xa85971d829c77b8a),
+     W(0x00000000eeb7ec13)},
+    {W(0x15c025e2731c15e0), W(0xd7df2337ef0c9b09), W(0x19e476fadc4d50fb),
+     W(0x00000000b4542519)},
+    0
+  },
+  {
+    {W(0x29860c6fa4f8494d), W(0xcb92a71d4be01d70), W(0xaa8bf82c0dfaf7f0),
+     W(0x0000000089c28da2)},
+    {W(0xdd1882a560c6bc45), W(0xfbd07657e52b4205), W(0x8d007d512e5e3d55),
+     W(0x00000000bf6e51c6)},
+    0
+  },
+  {
+    {W(0x0ead482f613f0cb4), W(0xd7dbef26153e67c6), W(0x30bbf5a4cf051783),
+     W(0x00000000e1acc7d3)},
+    {W(0x6cf048dd6bbb1dd2), W(0x085cacca52606f4b), W(0x5a56656d0f05027c),
+     W(0x00000000443000f3)},
+    0
+  },
+  {
+    {W(0xbbc1c47201252128), W(0x48a4f1b846bb41d0), W(0x5cbb2c8b791996ad),
+     W(0x0000000075ed0789)},
+    {W(0x566d115c43317740), W(0x84e53bbb5d7be2d6), W(0x80b4d581e61dc910),
+     W(0x00000000420c8744)},
+    0
+  },
+  {
+    {W(0xeb97407c80dcba39), W(0xc000e6608361abba), W(0xfe9188d9eee2b91d),
+     W(0x0000000006b3f2cb)},
+    {W(0x2c7d743eeace8b2a), W(0x0ac2595a493fc690), W(0x44e79d39cc02083e),
+     W(0x000000004bd50267)},
+    0
+  },
+  {
+    {W(0x1f4086627bcc08f6), W(0x1ff6952dfa424b14), W(0xbdda0736bd603691),
+     W(0x00000000b64dbf39)},
+    {W(0xf2196bba49a7557a), W(0xc43ee0d24e750fe4), W(0x4710da3db1a385de),
+     W(0x000000006571cb59)},
+    0
+  },
+  {
+    {W(0xfaee13a77a137473), W(0x7e0bc2320a99a5b5), W(0x2921772d6312fcac),
+     W(0x00000000bd09dedb)},
+    {W(0x19d4a7e0c72dca8e), W(0xb1a1073fd208335c), W(0x6ec434f67d00d481),
+     W(0x000000000c532305)},
+    0
+  },
+  {
+    {W(0xc404d98758dd718e), W(0xc547fe71cf211624), W(0x1d7c92b9ff8c057c),
+     W(0x000000000e561072)},
+    {W(0x9de90142a0ac24c8), W(0xa2b1b2a743b38f6e), W(0x5118dec79f3ba31a),
+     W(0x00000000c09f605d)},
+    0
+  },
+  {
+    {W(0xbdcc5945a4bff045), W(0x2868b5d922022b33), W(0xf6925d2e71800a30),
+     W(0x0000000055658868)},
+    {W(0xa76f0ad07dc19d53), W(0x5e0d40d9c77c1c8d), W(0xe790880a5df98deb),
+     W(0x00000000728d00eb)},
+    0
+  },
+  {
+    {W(0xa2dfa272bf85f78f), W(0xca7bc02e6c070827), W(0xf7191b9059a35149),
+     W(0x00000000ae1e4d80)},
+    {W(0x274dc1a0e7948c63), W(0x72337d6a9b81560a), W(0xfc6838c30d2f34c9),
+     W(0x000000002126e019)},
+    0
+  },
+  {
+    {W(0xf509360a3c460106), W(0x4a8a59b48a63aa81), W(0x5f8dfb225db0f7a0),
+     W(0x000000002f801bc8)},
+    {W(0x731abd3dfb4f18a8), W(0x7c4a2e3d2f935f4f), W(0xb4051e44c34fef0b),
+     W(0x0000000017ba7230)},
+    0
+  },
+  {
+    {W(0xe7fd369bc054c9ac), W(0xe227b1f00526000a), W(0xf2ee4af1375b3402),
+     W(0x000000008009ddc1)},
+    {W(0x2089e5c9c6e05ecd), W(0x856bf64f33f5b213), W(0x24bca10dc86be182),
+     W(0x0000000095c0c940)},
+    0
+  },
+  {
+    {W(0x3cae37d8001075cb), W(0x58439532c8179269), W(0xa2aaae42737d47f1),
+     W(0x0000000048156a86)},
+    {W(0xb2212289d1fe8272), W(0x20f870c8e3436a97), W(0x012e901cb95649b0),
+     W(0x000000009c3b306b)},
+    0
+  },
+  {
+    {W(0x09fc76ea08adfeea), W(0xdb5827823a65bf50), W(0xeeb5bec42a337417),
+     W(0x000000004a113bbf)},
+    {W(0xeb04c81e26998e59), W(0xbae5a9fe128f93f1), W(0x293bb6b3906a25ef),
+     W(0x000000009c721356)},
+    0
+  },
+  {
+    {W(0x8e77a22a2610845c), W(0x91b5cf9c5aa98971), W(0x8b57460a9634b8a7),
+     W(0x0000000082511dd9)},
+    {W(0x38610ff15f98b6a4), W(0xa6ba45eb98871485), W(0x0c87fdfcf2e2b222),
+     W(0x00000000bcd2082c)},
+    0
+  },
+  {
+    {W(0xed436684744236fa), W(0x980ac43e11135548), W(0x594ec44598936df8),
+     W(0x00000000d5b63648)},
+    {W(0x8ea167f9472fb7fc), W(0xe7925d9e6cc47bdd), W(0x1f80bc06e86be816),
+     W(0x00000000cab07246)},
+    0
+  },
+  {
+    {W(0xdc5c77976e82960a), W(0xc878c02aee173ee9), W(0x1edbc3960ab2b937),
+     W(0x00000000cc1031df)},
+    {W(0xcd652699be3405e0), W(0x77f5b17918eb9f47), W(0xf4896b2fdfc69a9f),
+     W(0x00000000e39e2c76)},
+    0
+  },
+  {
+    {W(0x4c1c3ea3d369bcf6), W(0xb082d5b64fefe310), W(0x5fd559bbf75ea52d),
+     W(0x0000000034da10d2)},
+    {W(0x2f51ff199fe68e8a), W(0xe6a32eb7730cb15a), W(0xca2b8ebfe583ca73),
+     W(0x0000000048362492)},
+    0
+  },
+  {
+    {W(0x9b992336663cbb81), W(0x4b6fe441b61738a3), W(0xf1196fe2c5cc7816),
+     W(0x0000000079c99bf8)},
+    {W(0xa311ba556a34f320), W(0x40533cf953b88685), W(0x3a870a2beccb49fa),
+     W(0x000000002134e225)},
+    0
+  },
+  {
+    {W(0x15872994abc6a1c8), W(0x4e1136731d84d454), W(0xad19eba359403c7f),
+     W(0x000000004c5d534b)},
+    {W(0x22a512e43bd88bc8), W(0x0fd22cdb710bf2ba), W(0x676010839ac9fff2),
+     W(0x0000000052715bd9)},
+    0
+  },
+  {
+    {W(0x7300931510ab2c50), W(0xdfabc2b7b6ce2d12), W(0x642704d2e06e0ee4),
+     W(0x000000001fbc78e5)},
+    {W(0x816c9cf420dfbc82), W(0xb4973604c52c0d59), W(0xb4cd7d250cf21d8f),
+     W(0x00000000344ea24e)},
+    0
+  },
+  {
+    {W(0xb345e88e4a900e2f), W(0x8729529ebfa6bfbf), W(0x190154d909dc1d43),
+     W(0x0000000092a64e70)},
+    {W(0x0acfa8c14a3ff16e), W(0xa44825e665b4be63), W(0x4f9e24ae4abb905d),
+     W(0x00000000c1a031e4)},
+    0
+  },
+  {
+    {W(0x3534938c6b938eab), W(0x93956aca0e584c5d), W(0x24c48bdd29b788ce),
+     W(0x0000000070b141bd)},
+    {W(0xb58ea7a53b25f55c), W(0xd4febc93177798b0), W(0x6b66c0452f5b9c42),
+     W(0x0000000060f76c24)},
+    0
+  },
+  {
+    {W(0x56a1c174f7a5c8b4), W(0x4be8d29827217ffd), W(0x03970e9c0632a94e),
+     W(0x0000000062c7fe4a)},
+    {W(0x7a0b0a9fa806bd5e), W(0x277ee3d660f11552), W(0x38510f47326a5257),
+     W(0x00000000be7632de)},
+    0
+  },
+  {
+    {W(0x2536ae108d874b1f), W(0x7be49393997ca04b), W(0x669c0a29f85044cf),
+     W(0x0000000051eaa9dd)},
+    {W(0xc107099cfaa27850), W(0x059262faa3d59a41), W(0x0b28e9eb94e61007),
+     W(0x000000001e2af072)},
+    0
+  },
+  {
+    {W(0xf2910805073eb6cc), W(0x678756c36b950e01), W(0x09a1b5decc3d1eea),
+     W(0x00000000667ed2ce)},
+    {W(0x95b7e9aefd0b8f3b), W(0x61516d732faae719), W(0x95541d7702a03086),
+     W(0x000000007daa9ae7)},
+    0
+  },
+  {
+    {W(0x5ed73c8ba541b6a8), W(0xb171b8baa4f01ed0), W(0x3be965785c638862),
+     W(0x00000000b6befca5)},
+    {W(0xf683872344460f93), W(0x2c16fc436d32e34d), W(0x2307eaa1a7bd4d74),
+     W(0x0000000002ca379d)},
+    0
+  },
+  {
+    {W(0x198d16692526e629), W(0xd157f539db262eb5), W(0x06c07ef5f236172c),
+     W(0x00000000a3126b36)},
+    {W(0x935eb9879a06ae72), W(0x67e75833756ddf2c), W(0xe510ec0a6a52d685),
+     W(0x000000001261fabc)},
+    0
+  },
+  {
+    {W(0xfc7a91039ba9d4cc), W(0x31a8b1d903c9569f), W(0xbc6aee0a1abc1d11),
+     W(0x00000000be5c6d07)},
+    {W(0x9c15d08fbd63055d), W(0xf8fb7a8d5a013c14), W(0x13fbfb282e32d6f1),
+     W(0x0000000040db3441)},
+    0
+  },
+  {
+    {W(0x7a87cd78ef472540), W(0xa03b15e46c127ca0), W(0x9f74e0730d2ecffe),
+     W(0x000000005e0155ed)},
+    {W(0x924ef2313e5e8714), W(0x0ecbabc7ddd1ef05), W(0x2364dffd0d2d6a7c),
+     W(0x000000000efb2a2c)},
+    0
+  },
+  {
+    {W(0xfdf1aa85a773a18e), W(0x4590b06cad567028), W(0x1b8f9d29db19bfe0),
+     W(0x000000006dc52f97)},
+    {W(0xd48cdb1a5c4f7538), W(0xcf7e79404a4f334b), W(0x720005be5fa3ebd0),
+     W(0x0000000036fd0171)},
+    0
+  },
+  {
+    {W(0x3aa2aeb0becdc432), W(0x7b2f8d409eacc8da), W(0xfe9b546ce5ea33de),
+     W(0x000000000dc8020d)},
+    {W(0x8044e73284478758), W(0x99d6c7e4fb50aeae), W(0xaaaedd8b988dd581),
+     W(0x000000001cbb2dda)},
+    0
+  },
+  {
+    {W(0x31f13a8b7bf1dbc9), W(0xd307b5298032223a), W(0x5f52a2abf607cf46),
+     W(0x00000000446c271a)},
+    {W(0xb13db4d8ecc91a91), W(0x2171c45b8d065b56), W(0x99b0a323bcceed52),
+     W(0x0000000021b4ad13)},
+    0
+  },
+  {
+    {W(0xa0651f72437da019), W(0xc6e0349dc0aca407), W(0x02c282d6e7fc1342),
+     W(0x00000000d0d39ecc)},
+    {W(0x5facf3d3b9b289a5), W(0x315f8c0b6a0c4bde), W(0x243b4315c0908f6b),
+     W(0x0000000067300e58)},
+    0
+  },
+  {
+    {W(0x05ccef1ac93683e7), W(0x81a33b9aca10e677), W(0xa30b25fee4af6407),
+     W(0x000000001698b502)},
+    {W(0x3a60e064ba4b31f9), W(0x728830ef25f22887), W(0xfb5f9f9526962b5c),
+     W(0x00000000519c7ed4)},
+    0
+  },
+  {
+    {W(0x194e5820261f5269), W(0x878ffff4e614a3f6), W(0xb4b7bc6a65cbc3e4),
+     W(0x000000005f3d2db2)},
+    {W(0x22864b28a7d0b0ff), W(0x4c3d9ae5982b6322), W(0xb0a5c2918d4ba128),
+     W(0x00000000aa98aa8d)},
+    0
+  },
+  {
+    {W(0xaeeda0a9bdb12e00), W(0xf58df1af302044ef), W(0xf02b69bf6678707c),
+     W(0x0000000076d02e43)},
+    {W(0xd50f3bf1929e028c), W(0xec266a176159f496), W(0xc0eee5bb54274c40),
+     W(0x0000000056d16f28)},
+    0
+  },
+  {
+    {W(0x0156c28fa43ddb57), W(0x51eee09ad6ce0b83), W(0x1b28597927ff573b),
+     W(0x000000001201eae1)},
+    {W(0xd705ba4f8f338d7a), W(0xf3fb56ed250598cd), W(0x9e31755eacd1ea4e),
+     W(0x0000000080f0df15)},
+    0
+  },
+  {
+    {W(0xd44359d82107a984), W(0x875892995939befb), W(0xa18308749adb9525),
+     W(0x0000000094444801)},
+    {W(0x47aa24dee374fa14), W(0x64f3bc035e937a69), W(0xa7e87bc6961656e0),
+     W(0x000000001479b0f8)},
+    0
+  },
+  {
+    {W(0xab52dd52c2c323c4), W(0xa50a9145b480796f), W(0x4633a2a4f1a118b9),
+     W(0x00000000de59bca7)},
+    {W(0x640f6cbe39bc2c18), W(0x6afe1217a6fd9e37), W(0xb26e7f8f4d21647e),
+     W(0x000000008ed48b65)},
+    0
+  },
+  {
+    {W(0x660680e96bbf3225), W(0x1ec0c821cb690f50), W(0x89d2a641a6f31a77),
+     W(0x00000000a8e266d5)},
+    {W(0x5b259ee03a226af6), W(0xb3a572dbc7025dea), W(0xcb8210bff740f449),
+     W(0x00000000ab029255)},
+    0
+  },
+  {
+    {W(0x3d1cc8f59f8e1a67), W(0x530a0df1cccee748), W(0x4dacb396c235246a),
+     W(0x00000000cd99eb5e)},
+    {W(0xcacd8e2cfbef97b2), W(0x1cf70fcd53523135), W(0x437c6c4cd8d828c9),
+     W(0x0000000005e31dec)},
+    0
+  },
+  {
+    {W(0xea21a4c0e8e3768e), W(0x37925f89ae42c258), W(0x0b3eab62fc657239),
+     W(0x00000000e1d19272)},
+    {W(0x10936bb394682395), W(0xf809cc97b0b46549), W(0x6b2d45a5178ee640),
+     W(0x0000000005916b5e)},
+    0
+  },
+  {
+    {W(0xe9cf575a51f11c3d), W(0xe0c8f46c702ef0af), W(0x699fc3bf9d0372b0),
+     W(0x00000000217f2942)},
+    {W(0xfb5360950d600798), W(0x3d902d0ea472ac74), W(0xadfddd97fffa9f06),
+     W(0x0000000017353181)},
+    0
+  },
+  {
+    {W(0x6aa7785d44752346), W(0x6fe030cade1680ba), W(0xd69599fd4bd2b8bd),
+     W(0x00000000cb1bbe28)},
+    {W(0x57def46e3b2a2c4c), W(0x973e0fdac9bba754), W(0x8c21f4d29597add6),
+     W(0x000000008d36d9cb)},
+    0
+  },
+  {
+    {W(0x77ad408681880634), W(0x2af84521015e1414), W(0xbe65a71ce9a02987),
+     W(0x00000000a866f48f)},
+    {W(0xc2715e39f8c9a838), W(0x73af33b9141af567), W(0x8a11e901c628791e),
+     W(0x000000000196362d)},
+    0
+  },
+  {
+    {W(0xe76fef0b934df291), W(0x2a012daf6961c552), W(0x0977fda4acacd059),
+     W(0x0000000028d7e587)},
+    {W(0x1089b524abd29393), W(0xb98edee21be7cc5f), W(0x851c559115b91cbf),
+     W(0x000000001b4a5423)},
+    0
+  },
+  {
+    {W(0xdae8d5495a5f16f9), W(0x9804fa504cbb5d6d), W(0xc44b59c7d659bc86),
+     W(0x00000000904b3a8e)},
+    {W(0x62708873e81e3465), W(0xc3c8accba4cfcfcf), W(0x792b957f5ccd95e4),
+     W(0x00000000ae5d5666)},
+    0
+  },
+  {
+    {W(0xb3bb80dea77332fe), W(0xf1a7269fe24dc6b0), W(0x3bb3831a96b66c30),
+     W(0x00000000b8c00d1e)},
+    {W(0x6e7c9f99cdc75fa4), W(0x4444096a33810ed6), W(0x9a1e0bbe5d066134),
+     W(0x00000000e238bc99)},
+    0
+  },
+  {
+    {W(0x9b8c9ec499b7af9e), W(0xbb37bf9faeed2610), W(0x7813020e55926f05),
+     W(0x00000000dfdfdbf3)},
+    {W(0x308f0d44bd4e6c48), W(0x7909fdcef4898273), W(0xeea95ba48ee0dd22),
+     W(0x00000000a3aa1645)},
+    0
+  },
+  {
+    {W(0xe56003418474b3b7), W(0xe88573054497b607), W(0x1135b0418bd10a57),
+     W(0x0000000012582851)},
+    {W(0xd4054efb0b6acf44), W(0x2f190b0150af6cd2), W(0x9735a1b46934c1ca),
+     W(0x00000000ddaf94ea)},
+    0
+  },
+  {
+    {W(0xe2f56a9d97e0c5c6), W(0xbb5f1f46e8eb08f6), W(0xda0890a026a5351b),
+     W(0x00000000b4965215)},
+    {W(0x9388599ba42feaa2), W(0x0d1416a1d0f59fa4), W(0x3e8e01658fc0afba),
+     W(0x0000000052c56b4c)},
+    0
+  },
+  {
+    {W(0xd4400ae45a7f70ce), W(0x33bc04236b6a4903), W(0x6084475045dfabdb),
+     W(0x0000000057da81c4)},
+    {W(0x3b5735396bd717f6), W(0xa02c72915df5512a), W(0xf041f5c6dee81cef),
+     W(0x000000001f6a694b)},
+    0
+  },
+  {
+    {W(0x9a7d57d3406aa899), W(0x0197c3df8a0e48d4), W(0x9a756521023cfa24),
+     W(0x000000006899e140)},
+    {W(0x5800ba3f284a03d3), W(0x07269fba8e900b75), W(0xe576f906d1f36320),
+     W(0x0000000018b056dc)},
+    0
+  },
+  {
+    {W(0x65c9bb3d4c1ef08e), W(0x602851120060d7b6), W(0xed8f7d68f079f6e6),
+     W(0x000000006a25dbed)},
+    {W(0x73db61843dbfe939), W(0xe5035e68ee6b89ec), W(0x3f5c3671fe5125c7),
+     W(0x0000000028ca97e9)},
+    0
+  },
+  {
+    {W(0x1b35e2a8d38029c1), W(0xe916b43b8f1cdb4a), W(0x2918b31c1ecbd23e),
+     W(0x00000000c177f7be)},
+    {W(0x3086ccab2c78ca6c), W(0x11bff7b4eb4420ef), W(0xd718c76239005f16),
+     W(0x000000003af9dc75)},
+    0
+  },
+  {
+    {W(0x8284f08b630db9c8), W(0x59e8771bff4c6b38), W(0xcd94a040d879f6ef),
+     W(0x00000000860a7532)},
+    {W(0x78975a2170e6fcf2), W(0x4086744f9bf69061), W(0x794497c05bbb5810),
+     W(0x00000000e3a1b298)},
+    0
+  },
+  {
+    {W(0x7f37809d88d8a394), W(0x158c42d6ae6c0017), W(0xd9b3c29c30819f8d),
+     W(0x00000000f0cce5d2)},
+    {W(0x56f6d54f19f3d499), W(0xe43be0c84787aaee), W(0x02b60620cdb2ac72),
+     W(0x000000008073fc7b)},
+    0
+  },
+  {
+    {W(0x75e2c90254d5c505), W(0x0a2e632ba6d05e6a), W(0xd944eec8a593fc45),
+     W(0x00000000525019ac)},
+    {W(0x36c5f71fb508bcb6), W(0x3bace703e7c26f0c), W(0xc4b2ebf0a6cbb3b8),
+     W(0x00000000bba5de81)},
+    0
+  },
+  {
+    {W(0x2a749da89bb02631), W(0x9922323a7552ab99), W(0x0bf60ff4af2b8f7c),
+     W(0x00000000ed7fe2f1)},
+    {W(0xb438181a30c921c8), W(0x9c4d02a82a5a90ee), W(0x0f85c9bc91cb2281),
+     W(0x0000000077b1f486)},
+    0
+  },
+  {
+    {W(0x0c30e22acaaed18d), W(0x0b5b20e191cac286), W(0x78689d46314a269b),
+     W(0x000000006d08cf3d)},
+    {W(0x8ab01d441fab88f9), W(0x3e61003af2dacf44), W(0xe33b648a47caa2b6),
+     W(0x00000000ed9858c5)},
+    0
+  },
+  {
+    {W(0x34b14290536b80cc), W(0x6b172920ecf45696), W(0x69c45122cf310ebe),
+     W(0x00000000d3f8184b)},
+    {W(0xe369b3297e6b569a), W(0xa662a4246ba5c57a), W(0xceee4d4aff826aef),
+     W(0x0000000099ed73f5)},
+    0
+  },
+  {
+    {W(0xf9c5373ed34d8086), W(0x69bd1ecbca56b252), W(0x4fe184e875730d0f),
+     W(0x000000000b982d65)},
+    {W(0xe8e22a764db49114), W(0x205952e7fcddddd1), W(0x7db1b0f9c97f12e9),
+     W(0x00000000d829cc9f)},
+    0
+  },
+  {
+    {W(0x7331711c62e34216), W(0x76c1140899d76710), W(0x0705b183e7583f71),
+     W(0x000000003787d635)},
+    {W(0xab256d6395e7d5f4), W(0xbf2939ca99dcc054), W(0x5b1713df5dc4a284),
+     W(0x0000000000afce5e)},
+    0
+  },
+  {
+    {W(0x5f0af1016b0bf9c0), W(0x580526f0f05e71db), W(0x44d7c70ca7b1a839),
+     W(0x00000000a88431cd)},
+    {W(0xffcbce6b3061be8f), W(0x4e362a39747b0627), W(0xf3794553e98ae4cb),
+     W(0x000000000501d579)},
+    0
+  },
+  {
+    {W(0xb64fbd8956aaa4aa), W(0xc52aae389b0a3c8e), W(0x6bc3f374d2c2b873),
+     W(0x000000003aa50301)},
+    {W(0x14339c4f73811e59), W(0x7aa84bf4f018bdd3), W(0x2450d93c3ea82e8b),
+     W(0x000000007bb49ac6)},
+    0
+  },
+  {
+    {W(0x897adee0ae4f61c6), W(0x71603af083e07dbc), W(0xc90bfae9e94210c4),
+     W(0x000000005c345f14)},
+    {W(0xce41b4d04da7008c), W(0x225c03898f35dce3), W(0xe9126721b78d53eb),
+     W(0x000000005a31660f)},
+    0
+  },
+  {
+    {W(0x68f62ac2efb77072), W(0xac0a349c13541e70), W(0xe2ba36998e74c451),
+     W(0x00000000b99c9d85)},
+    {W(0x3471602c7b6e3d68), W(0xfab3804d9c6be48e), W(0x13afc8a708254f54),
+     W(0x0000000076e3c894)},
+    0
+  },
+  {
+    {W(0xd90b556fbdadbad1), W(0x15ff124ab930e311), W(0xcbd9ba022760421a),
+     W(0x0000000066af28ed)},
+    {W(0x705cb3c89c4c53ec), W(0xa0a6fc41d6a4ef1c), W(0x2424ed522849a09d),
+     W(0x000000002bf45549)},
+    0
+  },
+  {
+    {W(0x828292aa17054e91), W(0xe114d6c9d079b622), W(0x4228ee6fa11d42fe),
+     W(0x00000000f4a818e5)},
+    {W(0x08d892586adb0841), W(0xba9c601e048feebb), W(0xccb4ed321c860563),
+     W(0x000000006e1f721a)},
+    0
+  },
+  {
+    {W(0x4c489e9afa95eb4f), W(0x19ae36955bdcc7d5), W(0xb92948561e19b1a2),
+     W(0x000000002f38ed60)},
+    {W(0xac8d8a690db25340), W(0x4c6be88a99f4bf50), W(0x66e0e958ce4c0d01),
+     W(0x00000000ccabfb4a)},
+    0
+  },
+  {
+    {W(0x74c46b6359d04ad0), W(0x888087eb585e6256), W(0x328c9ad2f0ed826e),
+     W(0x00000000c8e161c1)},
+    {W(0x1a27ffa9e0fc07d7), W(0x053c00b1b07b0c09), W(0x91f14ecfd9a0f5e6),
+     W(0x0000000083a6b0bf)},
+    0
+  },
+  {
+    {W(0x31f3e8027392d88f), W(0xda0b64ab44f21cec), W(0xaf78258ec88cc348),
+     W(0x0000000035aa0b85)},
+    {W(0x66668af7b080276c), W(0xd565075ddd59981b), W(0x5384ad7230215e1d),
+     W(0x00000000034c2088)},
+    0
+  },
+  {
+    {W(0xe049c48b77e50091), W(0x8ae560d892a644bc), W(0x3efe2020d2960df6),
+     W(0x0000000066850997)},
+    {W(0x0269073658ceed91), W(0xa7cc512e74ca4c0f), W(0xd0ad2d8e5c0b1730),
+     W(0x0000000021633013)},
+    0
+  },
+  {
+    {W(0x83506a83c0ab99a6), W(0xe2b38f2320f792e2), W(0x8184186d485f2ad3),
+     W(0x00000000bd2836f1)},
+    {W(0x985a5af7e62808e1), W(0xcbcce4666239e7d3), W(0xda1ef393b2de82b8),
+     W(0x0000000003458361)},
+    0
+  },
+  {
+    {W(0xf3b01efb7330a37b), W(0xb5ba0bbbcf142002), W(0x5bbefa902eb752ae),
+     W(0x000000008c034f81)},
+    {W(0x56d4386e70b02390), W(0x36944e985986548c), W(0x5b539e403413996c),
+     W(0x0000000097cc7894)},
+    0
+  },
+  {
+    {W(0x7824f80c431cc8f8), W(0x77febebbf4daf2c5), W(0xf8f940204e7cf6d0),
+     W(0x000000009d69f82e)},
+    {W(0x779e4628e3e46b29), W(0xc2744437a3fe25f5), W(0x545efcca1eb74398),
+     W(0x00000000e2adcb52)},
+    0
+  },
+  {
+    {W(0x68fda4c54fe7d2cf), W(0x9a8aafd2b4f138f9), W(0xf7653c3a53c33f93),
+     W(0x00000000f799f22e)},
+    {W(0x1822bf838a4e3832), W(0x94fca445f6343dcb), W(0x358e9ae5c7bcac81),
+     W(0x000000000ad4c0c5)},
+    0
+  },
+  {
+    {W(0x022b1638cebe4a02), W(0xe1249b724de30df5), W(0xfd332219036753bc),
+     W(0x00000000d10188ca)},
+    {W(0x4a6e337618347b88), W(0x7d418503d3708d48), W(0x2fe3458aa13ddfae),
+     W(0x000000000596498d)},
+    0
+  },
+  {
+    {W(0x1a933d4285ff3816), W(0x98826922725ebcb6), W(0x798fc8f99484e91a),
+     W(0x00000000f70955a8)},
+    {W(0xa7d2c66ddd172fae), W(0x76add61e197094cf), W(0x93f8d33f0e89c959),
+     W(0x00000000fe4ba705)},
+    0
+  },
+  {
+    {W(0x4e954ca5a21e8856), W(0x7106111c22b25ac8), W(0x52e80dc47929b5a3),
+     W(0x0000000095163936)},
+    {W(0x5885ad04a3e29daf), W(0x4cc9a275aa58f328), W(0xcf03dbec5e2c97a3),
+     W(0x00000000b4fbbe20)},
+    0
+  },
+  {
+    {W(0x7d175673d99f08d2), W(0x6e48cd262a890b82), W(0x19b79dcd89b5fb26),
+     W(0x000000008ad46348)},
+    {W(0x35f35fd033383881), W(0x7138a27e1d8c249b), W(0xe9c08d4d0326f59c),
+     W(0x0000000067a3eaf5)},
+    0
+  },
+  {
+    {W(0x66be8119ac528a57), W(0x7f3cc449c51e7781), W(0xdde71431c13e7570),
+     W(0x00000000129fd55c)},
+    {W(0x542879b3b6066bcf), W(0xbdc93d52ff52cc18), W(0x06e185eecdc6c645),
+     W(0x00000000a0b967af)},
+    0
+  },
+  {
+    {W(0x7cc56729fd3fce23), W(0x5f6d80621b056786), W(0xcc85e7124c546d81),
+     W(0x0000000005782a3a)},
+    {W(0xd95569c20b7a304c), W(0xd08acb0cc0e70d8c), W(0xb9943704901826f1),
+     W(0x00000000c124c1d9)},
+    0
+  },
+  {
+    {W(0x174ee27ec33d13e1), W(0xb686d1dc76e77774), W(0x0ef81564ba47ccda),
+     W(0x00000000d92b8a46)},
+    {W(0xaf20fc2d2deed691), W(0x2294c5522fef09d1), W(0xcc6a78e94948440d),
+     W(0x00000000b5c5dd4b)},
+    0
+  },
+  {
+    {W(0x87ae24781c710c94), W(0x5eaabc45f3d3d34c), W(0x9fef07c1746778ce),
+     W(0x0000000079c342ea)},
+    {W(0xffe2b14083f63b02), W(0x609da09247e03087), W(0x7a97c1b4379d861e),
+     W(0x000000000fe3797b)},
+    0
+  },
+  {
+    {W(0xe7bcdb194d3cfade), W(0xd6397bbd153df4ab), W(0xb93ccc8ea4e79631),
+     W(0x00000000162aac45)},
+    {W(0xa71dc654f2646045), W(0xea5343f0de6db565), W(0x64c7a6a17af967f9),
+     W(0x000000006a775bd4)},
+    0
+  },
+  {
+    {W(0xe8a112eb986fc2bc), W(0x44c00b699b956768), W(0x6f7804d1018a0b85),
+     W(0x00000000f4c278c8)},
+    {W(0xa6cd88bb83538e0f), W(0x5bd3cbc52a28a16e), W(0xe08a26b7e2bcf135),
+     W(0x00000000c438e133)},
+    0
+  },
+  {
+    {W(0x7b3496f3cc79658f), W(0xf6068af0d4e45156), W(0xb16fbd4b22d80c50),
+     W(0x00000000a8c75e38)},
+    {W(0x6922cf2b008b1a76), W(0xe7f1bfaed0e7ff84), W(0x4724aaff6be9300d),
+     W(0x0000000012054926)},
+    0
+  },
+  {
+    {W(0xace1d388748fe424), W(0x4d74165ab2a62c90), W(0xafb016e1695d144f),
+     W(0x00000000f2c31e80)},
+    {W(0xec07b785c155dbe6), W(0x8865be57efe8f4d9), W(0x7bc5492b753bd46d),
+     W(0x0000000010ffa061)},
+    0
+  },
+  {
+    {W(0x2dfa85c7a5db58db), W(0xdb4d66a6b4095dec), W(0x43ce7a9b5523e444),
+     W(0x0000000064ee0a8a)},
+    {W(0x790954c7935c4433), W(0xa9243482dd1e59e5), W(0xf0506a8e0a46d6d4),
+     W(0x0000000054ee6a99)},
+    0
+  },
+  {
+    {W(0xc67c9f5c21be930a), W(0x02f6878b232b4f7c), W(0x7ab2d8f19582b991),
+     W(0x00000000b2f43fc7)},
+    {W(0x4318e12f0aa28f8b), W(0x4149d7f671b0b715), W(0xb2f30a35586c0ca7),
+     W(0x00000000f921da4b)},
+    0
+  },
+  {
+    {W(0x7beb07d16a7fba6f), W(0x352c7d5898d5c2b5), W(0xa0b3efe1cbca1652),
+     W(0x000000000dba322f)},
+    {W(0x9ea3e052c43549b2), W(0x68086d3dd6ddf860), W(0x428be541da24b974),
+     W(0x000000007ce8c9b6)},
+    0
+  },
+  {
+    {W(0xe72507e11fd6cdc6), W(0xc7ff59e3c1422488), W(0xd5ea9e203a4d5350),
+     W(0x00000000f82adf56)},
+    {W(0xb3598112e3f35cfe), W(0xe0b801d11f3d9a92), W(0x4471cbffaeb4fca2),
+     W(0x00000000be269887)},
+    0
+  },
+  {
+    {W(0x4fc10f6a5d3fda3f), W(0x979574dce60c6457), W(0xad650858e1ad3ab4),
+     W(0x00000000d50e7859)},
+    {W(0xc611755b99fff416), W(0x112f57f23d7d7b05), W(0x9177d36f71708d5b),
+     W(0x000000000029e6f1)},
+    0
+  },
+  {
+    {W(0x6f38254d99d62763), W(0xc1c08f9030932921), W(0xe04bfecf40137c07),
+     W(0x00000000ead9ad57)},
+    {W(0x6cd10afd68b77125), W(0x23ce5c27459a6fc7), W(0xce63b5627c8320bf),
+     W(0x000000007eafc861)},
+    0
+  },
+  {
+    {W(0xaa774fb8c535c261), W(0xedfa46e3e96df6a2), W(0xaa3faca39426ace2),
+     W(0x000000007470fc72)},
+    {W(0x016f0fcba7ac406a), W(0xb9de1abc4dac9125), W(0x90cf664ac7bb9997),
+     W(0x00000000a598bcec)},
+    0
+  },
+  {
+    {W(0x5b63e521506b3a2c), W(0xb60e2cbb26b3767f), W(0x011a6c10424c4f6a),
+     W(0x00000000d203a893)},
+    {W(0x5d3bea3fbafef5e6), W(0x955550754e32edd7), W(0x91761b40e1d5b36e),
+     W(0x000000002c198518)},
+    0
+  },
+  {
+    {W(0x0705be3b270c2312), W(0xfc7f248092096081), W(0x7ee0459f6aebe010),
+     W(0x00000000126fbbcb)},
+    {W(0x5f12949202b0598d), W(0x20b56036772796a6), W(0xcabcb8dcf622fedd),
+     W(0x00000000b82ca6a9)},
+    0
+  },
+  {
+    {W(0xc5826a71e44db752), W(0xfeab36f8f8780890), W(0x66fbc1209fc1c119),
+     W(0x000000007503a321)},
+    {W(0x20840d71c334a5bc), W(0x36dc7e87de832232), W(0xe7d713f8c52c623d),
+     W(0x0000000017537dae)},
+    0
+  },
+  {
+    {W(0xbc73fec73ac99999), W(0x87022e4de8e9d907), W(0xe1564032c113cfdc),
+     W(0x0000000020592bfc)},
+    {W(0x7990c18884c6e6ae), W(0x6b7255ca18d1429e), W(0x5b74d21653f34f83),
+     W(0x00000000b26139c0)},
+    0
+  },
+  {
+    {W(0xb5b7ec7402a8d3d7), W(0x64095271a5eb1694), W(0x311b91289994d489),
+     W(0x00000000fbdaa9be)},
+    {W(0xa63e8db3110b15ef), W(0x41a87cb1b761c0df), W(0xcda382070ae49686),
+     W(0x000000006549f280)},
+    0
+  },
+  {
+    {W(0x3d133f87788f09f3), W(0x2f72fb775cd9ccf7), W(0xb69223c9543c5360),
+     W(0x00000000fde41a55)},
+    {W(0xae8909a2d6bde39e), W(0xf407e49a2eeeda69), W(0x8d1b6c7f7290941a),
+     W(0x00000000cd979e51)},
+    0
+  },
+  {
+    {W(0x2fd2c2ff8a59d1e2), W(0x2198638599bfb72b), W(0xa4a163ee81b24e23),
+     W(0x00000000f388a56f)},
+    {W(0x9fa6edf36e999c23), W(0xd436644fa3f958e3), W(0x64d1031fc19af107),
+     W(0x00000000e4e6d106)},
+    0
+  },
+  {
+    {W(0x674a0ea5e8fa0ec1), W(0xda0d4520d4983b73), W(0xb1dbe1c31904a6f3),
+     W(0x000000009d73a244)},
+    {W(0x12ba40dd3f6b920a), W(0x014ca1b49907dd95), W(0x6ba2ec97169363af),
+     W(0x000000006f6ede70)},
+    0
+  },
+  {
+    {W(0x2eb2129f36685b53), W(0x72899e25dee8596c), W(0x648eb7778aeb0294),
+     W(0x0000000086bb77b8)},
+    {W(0x6db1c01eb606d073), W(0x8c25d10a136e68f0), W(0xc720ee0be90adf16),
+     W(0x0000000030aeefb9)},
+    0
+  },
+  {
+    {W(0x06c659ab45880d88), W(0xa7ec0b1f93cd1714), W(0xb9b41844c9210f81),
+     W(0x000000001d10fb61)},
+    {W(0x0d23369f7993c7ce), W(0x6fc15721f2bbac8e), W(0x632319e70cd2e8c8),
+     W(0x00000000fcd9fd9a)},
+    0
+  },
+  {
+    {W(0x5bb5bff46906c609), W(0xb486e6e7d90417f8), W(0x29886f8dbc1e794f),
+     W(0x00000000bdfcf2df)},
+    {W(0xc1e533f5566b93f6), W(0x72e1ed86058f5408), W(0x627a818a21aad96b),
+     W(0x000000004e2f8a17)},
+    0
+  },
+  {
+    {W(0x11f51023398554c0), W(0x5a2aaa414a01ddc2), W(0xedd95c3ffdf68b0c),
+     W(0x000000001d781f0b)},
+    {W(0xa5793bdc261eea6d), W(0x6ba7c020aac76a6a), W(0x5e0aa889ef3fe887),
+     W(0x0000000008401f87)},
+    0
+  },
+  {
+    {W(0xbb1b11b92b32ff0b), W(0x0b7b17d2cd6974fd), W(0x786bade6347660db),
+     W(0x000000006af8d3c5)},
+    {W(0x4812519837fdcd0c), W(0x2193b79aa068986d), W(0x8027ddf248f5c67b),
+     W(0x000000003827a757)},
+    0
+  },
+  {
+    {W(0x51b009f7329cd7cf), W(0xe012d197c5d52a09), W(0x4f3fae7f0738082d),
+     W(0x00000000876f7359)},
+    {W(0xe2eb637eee60ce1d), W(0x77c24770b2cba852), W(0xbe5166a744c9dc33),
+     W(0x00000000a35f1f75)},
+    0
+  },
+  {
+    {W(0x5d75d473cdef073f), W(0x83ec9e6a3ddb36ef), W(0xcbc8da94c3fe2bf5),
+     W(0x0000000012c52ca5)},
+    {W(0x0b2cd010e20fa61e), W(0x042c60ffae4b5661), W(0x99277ffb55209188),
+     W(0x000000002ef1e1be)},
+    0
+  },
+  {
+    {W(0xdb92f62cfd3316a2), W(0x028940d4cbc6d887), W(0xb9aab506cd7ab748),
+     W(0x00000000b228912a)},
+    {W(0x83a0dfdc27ea1670), W(0x0d6e75dad6858a8b), W(0xd43f8ae9f650e05c),
+     W(0x00000000191db478)},
+    0
+  },
+  {
+    {W(0xc7397a9b0e41e1f1), W(0xfdc52d0a71cee120), W(0xa95cc457af4aa240),
+     W(0x0000000095bbe38d)},
+    {W(0xcf752dd13eeec0e7), W(0xca19350a799380f5), W(0xc4327d4061da1f55),
+     W(0x00000000989af344)},
+    0
+  },
+  {
+    {W(0x4b0ffcd9d13b7787), W(0x304c3a05292b8300), W(0xc547efd5e014532b),
+     W(0x000000002d59dae8)},
+    {W(0x1f36f2ecace3984c), W(0xf7932ba57e0e6e8b), W(0x7fd8727edb37f27b),
+     W(0x0000000038e58f0c)},
+    0
+  },
+  {
+    {W(0x95136b3000022977), W(0x4194f4bb61a98168), W(0x7087e7aec7e0954f),
+     W(0x000000009381b81a)},
+    {W(0x4274b207ffd1f331), W(0x88dc1736df339d14), W(0x9bfe710711076f16),
+     W(0x0000000039d28ed9)},
+    0
+  },
+  {
+    {W(0x57a9c52ad5ccc817), W(0xb690c925a502192e), W(0xec4d287bd14a4f8a),
+     W(0x00000000a8daa126)},
+    {W(0xf3edfbeb7a26b0e8), W(0xfa9dc6fdcafbb5d7), W(0x0ed04b0ea25cceed),
+     W(0x0000000024846815)},
+    0
+  },
+  {
+    {W(0xb00402a48fc42737), W(0xaffc5fbddf069d9e), W(0x9f7cf546e6ec36d2),
+     W(0x000000001898f0a9)},
+    {W(0x005e57bf83204032), W(0x94469423a0b92de9), W(0x2d923be094e831a2),
+     W(0x00000000081c4d9d)},
+    0
+  },
+  {
+    {W(0x2d3c4f72b8532990), W(0xf172aad13c72d8fb), W(0xfcba6fe8bfb5b14c),
+     W(0x0000000012f23f93)},
+    {W(0x36a7c2bb4c1ae241), W(0xb26cb6f7546474b8), W(0x1009cc6ea86a1442),
+     W(0x00000000694b0a1f)},
+    0
+  },
+  {
+    {W(0x18be30c559e319f7), W(0x037c9a3e6e2637ec), W(0x99184b71c6ae80d6),
+     W(0x00000000e104ee84)},
+    {W(0xd14fcf6e95f1fc7c), W(0x9406c25425be3622), W(0xb227b65e00fcede5),
+     W(0x000000006d98c147)},
+    0
+  },
+  {
+    {W(0xba2a356226b09f23), W(0xb69b5e192e3d4000), W(0xd10f7e6a746f124c),
+     W(0x00000000a13ecd9e)},
+    {W(0x23f08cd438bf97bf), W(0x5c7d58615cbd6c01), W(0x35099bde90f2e7e8),
+     W(0x000000007e56f751)},
+    0
+  },
+  {
+    {W(0xf152fa76dce34735), W(0x144c2b114234a5c6), W(0x51e7b293e09b35c7),
+     W(0x000000005dada60c)},
+    {W(0x428e8c90474d3c43), W(0x51eef06f3f7e4805), W(0xdee21fb06756c941),
+     W(0x000000006595ab7a)},
+    0
+  },
+  {
+    {W(0x3d08c06336b4d10b), W(0xed7bf59986cfcd79), W(0x9a7f65af1de6f2fa),
+     W(0x00000000bb785402)},
+    {W(0x1b4310d22331edd9), W(0xfe4b5d9237191298), W(0x32b7e4e546faf848),
+     W(0x00000000fb7ba570)},
+    0
+  },
+  {
+    {W(0xfe6b3922ee7b515a), W(0xe1af54441cd1babc), W(0x678dd5b048b07921),
+     W(0x00000000d0cd76ba)},
+    {W(0x2b698ee2c557492a), W(0x381da928867d6ca7), W(0xd607592184749ba2),
+     W(0x0000000060796051)},
+    0
+  },
+  {
+    {W(0x86e077e3e07b875f), W(0x453cf8374e2fb16f), W(0xdd146e29a3291fe9),
+     W(0x0000000068c8f516)},
+    {W(0xe05d19bcf936228e), W(0xe40276970be8cac9), W(0x1f5a4a65a87949f8),
+     W(0x0000000059e32b52)},
+    0
+  },
+  {
+    {W(0x2ee1352b04e41eec), W(0x9b4465d2c5fd3d60), W(0x894465698049446a),
+     W(0x000000001f00cc9c)},
+    {W(0xde106ddc4784a8d2), W(0xf9cbc6e2a784077e), W(0xe247b03eb11363d4),
+     W(0x00000000e138b59c)},
+    0
+  },
+  {
+    {W(0xf08eb31cad78d333), W(0x6498eb182bbd437d), W(0x490d1ccc9ec5edd6),
+     W(0x00000000c196bcbb)},
+    {W(0x5a6233ef75c52d0a), W(0xb390b12981a0528f), W(0x55381420892bcef2),
+     W(0x000000005bb20d2c)},
+    0
+  },
+  {
+    {W(0x64a1990412b751f5), W(0xdd5c4d54483a4d92), W(0xaff06e5c306465d9),
+     W(0x00000000ac0b5209)},
+    {W(0x21e6ad094e882730), W(0x07a52ba4fe62917d), W(0x6a732d0659b85d12),
+     W(0x0000000003b7cab7)},
+    0
+  },
+  {
+    {W(0x3cfb4857c6f342b1), W(0x4f98fb0c3a4e054d), W(0xffaa96836e5ebd09),
+     W(0x000000000f79ec0d)},
+    {W(0xf048240498828c51), W(0x0372c669d95fd9c7), W(0xbe179c88858050f2),
+     W(0x0000000054fae8f8)},
+    0
+  },
+  {
+    {W(0x3f374ad33f96ae83), W(0xfd17f5ef29a9fd08), W(0x1e0f3a8ed947d4db),
+     W(0x00000000e799ebd8)},
+    {W(0x100cdceb1f49a29e), W(0x22f05d95f65a94ca), W(0x78de0069379603b1),
+     W(0x00000000dc8de678)},
+    0
+  },
+  {
+    {W(0x7a1dd70ee1c06834), W(0x8fada8c1778fcabe), W(0x413077c73896ad19),
+     W(0x000000007bda4aac)},
+    {W(0x9352522cc91637e6), W(0x1f540b4f9090fe01), W(0xad09409f2d62cfdd),
+     W(0x00000000a8117166)},
+    0
+  },
+  {
+    {W(0x48fbdffad8ab2578), W(0xbbe8360c052f865e), W(0x74f82ceaa1073a7b),
+     W(0x0000000069ecb732)},
+    {W(0xd1e31eaf67206744), W(0x79867db7dfb72e4a), W(0x821375418f12a09f),
+     W(0x000000008746487a)},
+    0
+  },
+  {
+    {W(0x5c10bd5be32fb3ca), W(0xd29259a0a075a359), W(0x2762e6fb5d98746f),
+     W(0x0000000015c5e84f)},
+    {W(0x456a9e9a3f6576f1), W(0xf13d3de36fac1e1e), W(0xa7e89b6a064d0c84),
+     W(0x000000001d838bbc)},
+    0
+  },
+  {
+    {W(0xb58e093ea9882f4f), W(0xdd99271a3b3c6f04), W(0xd42f668343c250dd),
+     W(0x0000000060b2ce78)},
+    {W(0x6e3986702ce7494e), W(0xaa261fb6c36b3345), W(0x7114d91aae71efb4),
+     W(0x000000004f7c7532)},
+    0
+  },
+  {
+    {W(0x9a3cee98effe7ed5), W(0xbbc3318f15893459), W(0xd84c79a04ef21d2c),
+     W(0x000000009b876f5b)},
+    {W(0x1fb2dfa29b92eeca), W(0x3d0b9db178b3e58f), W(0x1ab86dd0d89be79b),
+     W(0x00000000a8a4e995)},
+    0
+  },
+  {
+    {W(0x3909f1dd5ee72ef3), W(0x89b2eb615f6d9a4f), W(0x951c309b3e081e2d),
+     W(0x000000005a315eaa)},
+    {W(0x9211f4b10df6086e), W(0x400faa7a11dd6330), W(0x312c57504dc1c0c1),
+     W(0x00000000831e4c2f)},
+    0
+  },
+  {
+    {W(0x2fbb918e2841487e), W(0xcc460934165d973d), W(0x3278f414bbd59645),
+     W(0x00000000c5d79889)},
+    {W(0x105c939326a4933d), W(0xba13b7457f4f23f9), W(0xf3d93de5fcfcc49d),
+     W(0x00000000d45ba7c8)},
+    0
+  },
+  {
+    {W(0xde00567ad3ad65a4), W(0x367bdc50b617f51d), W(0xbc021d5f60f3103e),
+     W(0x00000000ffdb5df8)},
+    {W(0x394312c36a82a79e), W(0x00a8c2e840e823c9), W(0x2d5aa71d654a5554),
+     W(0x00000000d1ad46f2)},
+    0
+  },
+  {
+    {W(0x2d7678843f682d0f), W(0xa494bb06554a7a35), W(0x8aa0e3b9b5a5de5f),
+     W(0x00000000ce79c746)},
+    {W(0x0cfec5ac3e5e28f4), W(0x162dcc6b7ee05507), W(0x7f1475450c93619f),
+     W(0x00000000b844631c)},
+    0
+  },
+  {
+    {W(0xdc737d63f69ef6a8), W(0x3969d7541424db88), W(0x71c1f00c5d002d61),
+     W(0x00000000cfb2c750)},
+    {W(0x46cf16a69f2ac438), W(0xece8541ba704f535), W(0x4c3e960761c20cb2),
+     W(0x0000000097fad261)},
+    0
+  },
+  {
+    {W(0x0cccd2d7f2b745b0), W(0xb33ec62ab7ca7c79), W(0xabf492d8e62a57ed),
+     W(0x00000000af98fb74)},
+    {W(0x1fa39e815914cc07), W(0xfc079a691df8e2b4), W(0xc7badd458d192c62),
+     W(0x000000007fce8286)},
+    0
+  },
+  {
+    {W(0x1c14e9a788d6baae), W(0x2100bc70022c4935), W(0x25bd70feedaf084c),
+     W(0x00000000c0effbf7)},
+    {W(0xf6e383cb81564b3a), W(0xd188fe0650024473), W(0x4ba4c49ca857773e),
+     W(0x00000000c6d69bd4)},
+    0
+  },
+  {
+    {W(0x57d799f8f9861165), W(0xf4ddbdffc1ada579), W(0x77b1fb032b5d5844),
+     W(0x00000000bec905ba)},
+    {W(0x7997a6b0c534d2a6), W(0x422901f2ba59eeab), W(0xf394839364fe4e90),
+     W(0x0000000097f677f2)},
+    0
+  },
+  {
+    {W(0xa6da52aff905fba0), W(0x4f4e1892ab414401), W(0x219822191772101b),
+     W(0x0000000044df984f)},
+    {W(0xed357c4f95cfaaf9), W(0x2121cdc1bbf84af5), W(0xe728a0b3ddbb13f8),
+     W(0x00000000f01c640b)},
+    0
+  },
+  {
+    {W(0xe750420dd5f04f2b), W(0x6758a269408fca64), W(0x18b4a356b22f1637),
+     W(0x00000000f256cd69)},
+    {W(0x865d029dc90526ce), W(0x413087059ee06f58), W(0xdca3fba8abe9e718),
+     W(0x00000000211ec9f8)},
+    0
+  },
+  {
+    {W(0x88a7dc1d4389d880), W(0x96d0551fb5027af3), W(0x16fab832fc1e7e7f),
+     W(0x00000000de9b3bd6)},
+    {W(0xa6aa237fabda23de), W(0xbccb27d319e17f69), W(0x23bfe1456ded6d99),
+     W(0x00000000e6d13e39)},
+    0
+  },
+  {
+    {W(0xa12974881c203066), W(0xbab4d9354f2cfc90), W(0x9e49a0cce2dc39af),
+     W(0x0000000088cc9166)},
+    {W(0xb2556a8129539f6a), W(0xc5a92c676c191927), W(0x44c16efcce6175b0),
+     W(0x00000000a58a520a)},
+    0
+  },
+  {
+    {W(0x99b2db1c47b78853), W(0x586dcaa63e91c959), W(0xd732ecfe39737cea),
+     W(0x00000000d71f0282)},
+    {W(0x7f920da0814bd908), W(0x844866cac9795d8a), W(0x9bfbe646a47cbe55),
+     W(0x00000000d211632c)},
+    0
+  },
+  {
+    {W(0xeeec323f0e7a2314), W(0x9019f5ce06c2d81f), W(0x8990ce2f97424742),
+     W(0x00000000cbaf8f24)},
+    {W(0x931bbad08821a259), W(0xf42216562a226a1c), W(0x89301788bb1c111b),
+     W(0x00000000a8afbb88)},
+    0
+  },
+  {
+    {W(0x1d3ff0aca94eb3f8), W(0x869ca1bd8de56875), W(0xfe9d5b629556466e),
+     W(0x0000000046f509bc)},
+    {W(0xc716fcc7650e9b7e), W(0xa53ec0e69bd671b5), W(0x6e2ac4636319ec2c),
+     W(0x00000000181bd79d)},
+    0
+  },
+  {
+    {W(0xd7eac870f759566d), W(0xc904b05c6611dabe), W(0xaaadb65aba5c1e1a),
+     W(0x00000000466b5402)},
+    {W(0x45145104361581f0), W(0x81472b0da6134028), W(0xab43382d0ffb9112),
+     W(0x00000000abd5c0f1)},
+    0
+  },
+  {
+    {W(0x184f8d12cbafbdea), W(0xe187ca37c084726c), W(0x9f200534afe86796),
+     W(0x00000000dfd184be)},
+    {W(0x6e7dfcfed6a03095), W(0x6f57d49326c36895), W(0x7210c59e9f5f9000),
+     W(0x00000000a8533766)},
+    0
+  },
+  {
+    {W(0x2b2535a0eb1a771a), W(0x5b1e109f9ecfd71b), W(0xd5b48aadc60500f3),
+     W(0x000000001faeffee)},
+    {W(0x7bd503bef7a60c17), W(0xf60b030f80645f10), W(0xf987da9621e5e1c0),
+     W(0x00000000d8592c5b)},
+    0
+  },
+  {
+    {W(0xac2cfaf7e2df3764), W(0x7fe79e085a83d400), W(0x1cb3f6f7d59647e1),
+     W(0x000000006fdb2b75)},
+    {W(0x7d2b71b3fadc81db), W(0x3173764a016cb716), W(0x42adc1bec58547bb),
+     W(0x000000006004fa2d)},
+    0
+  },
+  {
+    {W(0x7a947165c9bc1a41), W(0x288bc5a8137ecd94), W(0xdde9b3860c6422d2),
+     W(0x0000000005d411e0)},
+    {W(0xf7733b507efba1e2), W(0x0b0e9d95706c52de), W(0xdbbc2d88c6800f4c),
+     W(0x00000000dca41faf)},
+    0
+  },
+  {
+    {W(0x81c23fe50f363cad), W(0xa431ae3dd0b0b9ce), W(0xa0cf2f17025fec93),
+     W(0x00000000d2d95edc)},
+    {W(0x64583f1ff0a0d0ba), W(0x00ed8b03938f61b3), W(0xd12560e63c02a38c),
+     W(0x000000004af95c9d)},
+    0
+  },
+  {
+    {W(0x43e8eb23d9b1931b), W(0x3e5f7f8de8a313bc), W(0xf329dd897169de6b),
+     W(0x0000000009e8f9df)},
+    {W(0x78fd97d97d79bf25), W(0x7fec0146b8c557a5), W(0xd2b308d397f17fd2),
+     W(0x000000008af5b4a4)},
+    0
+  },
+  {
+    {W(0xb14609ff8cbc37ad), W(0x0dc46f3117d1f429), W(0x9e64a292d97e656c),
+     W(0x00000000c96ae3d9)},
+    {W(0xc910a756448b1791), W(0x39e3e8b638549a7c), W(0xa234ddb55deb941e),
+     W(0x00000000aee229cf)},
+    0
+  },
+  {
+    {W(0xfb50b3b807368f00), W(0x1fef0875faecd21e), W(0x68fca2a360511870),
+     W(0x00000000336be5b2)},
+    {W(0xf651e9328df8cead), W(0x4de6edfd25da113c), W(0xca6348d4731d45b1),
+     W(0x00000000cef6ce71)},
+    0
+  },
+  {
+    {W(0x0dddcf8829b1e7f0), W(0xca9cf6dabd7842f1), W(0x86d29a58703a1307),
+     W(0x00000000ed17b8c3)},
+    {W(0xcd4c342821735789), W(0x2bb53ab65111ea1d), W(0x6f6cd5b53b7be279),
+     W(0x00000000d7f1dece)},
+    0
+  },
+  {
+    {W(0xea83bf2cf8cf11bc), W(0x58081db434890fc1), W(0x0b6ad09156c7e3f5),
+     W(0x00000000ae5a1b47)},
+    {W(0x1469ba12ec87f379), W(0x0063dab1d5623ea5), W(0x5eb3808d67e49f50),
+     W(0x0000000099855b41)},
+    0
+  },
+  {
+    {W(0x7d7d4000c938571c), W(0xf6f31c3f1bb4604b), W(0xbf489f141acf1e1d),
+     W(0x0000000056a22b72)},
+    {W(0xed5f8b1706d1a8d0), W(0x5c177d00658674f3), W(0x81a16ef1f98f4777),
+     W(0x0000000005c0401e)},
+    0
+  },
+  {
+    {W(0x4bd0c8775ae31078), W(0x68092f714e8744f0), W(0x4bc145b3b7fcdf47),
+     W(0x00000000a0217a9e)},
+    {W(0xf40458740d2ac484), W(0x77d8e43b5e29ee06), W(0x88090ef961780f24),
+     W(0x000000004c7c7303)},
+    0
+  },
+  {
+    {W(0x24eba223b0607fc3), W(0x78931e8fe2303215), W(0x4192bf14e12cb3a9),
+     W(0x000000000ab0d5d9)},
+    {W(0x3c4cd9856c3479c4), W(0x8aae069b0b943781), W(0x9620d62b506d526f),
+     W(0x00000000b731d694)},
+    0
+  },
+  {
+    {W(0xd65170469bd8b731), W(0x7623b5478293e6f7), W(0xa9fcc664d066a040),
+     W(0x00000000de17b2c0)},
+    {W(0xe0f5e1b7ce11ae7f), W(0x497c3ac9071b5046), W(0x7de004c5eff4878e),
+     W(0x00000000e6568829)},
+    0
+  },
+  {
+    {W(0xba85156c3a2b5726), W(0x9ca76187777a6265), W(0xc2888eda7cf751a2),
+     W(0x00000000239019c3)},
+    {W(0x83332841d7908096), W(0x57c6422e3a4e9d64), W(0x0490164939befb6a),
+     W(0x000000002cb4c4fd)},
+    0
+  },
+  {
+    {W(0x0082ae74529bb61f), W(0x064250eaaf235e63), W(0x87418c1540434853),
+     W(0x00000000de7a2514)},
+    {W(0xfa86516bd85d7c43), W(0xc720391fdc0dcf6c), W(0x3596bd0c764c610d),
+     W(0x00000000820bb3a5)},
+    0
+  },
+  {
+    {W(0x6e9aad8d3ce25edd), W(0x293234ff679880e6), W(0xee14c3f215c342a1),
+     W(0x0000000048e1a8d4)},
+    {W(0xea7c3dae47795ca5), W(0x39dfd86df041c9d7), W(0x1aea7bbfb5e8669d),
+     W(0x000000008150c9cd)},
+    0
+  },
+  {
+    {W(0x449b27e68dfe3275), W(0xc8122c4360792264), W(0x99cb963ef46cac9a),
+     W(0x0000000099396a72)},
+    {W(0x2497ea647851d26c), W(0x1834db8743cb277b), W(0xab6925f85bdb9021),
+     W(0x000000004be413eb)},
+    0
+  },
+  {
+    {W(0x8d5c9cb58ee39ed6), W(0x7de788c1eec2df28), W(0xaaca54b382c3bf4c),
+     W(0x000000003dfabc27)},
+    {W(0xadcc4e39fc8a3606), W(0x276533cebfa91797), W(0x7c076eb0bdfc8d8e),
+     W(0x000000009373d6ea)},
+    0
+  },
+  {
+    {W(0xb3497f8e37e304e3), W(0x4ccea2e4f5c8ee1a), W(0x05124202fdd7874e),
+     W(0x00000000f85bd453)},
+    {W(0x0a6cc71c498a958b), W(0x657d24c807b4b23f), W(0x1f4fc60d29a25c1b),
+     W(0x00000000b4ce7227)},
+    0
+  },
+  {
+    {W(0xc610f80694d90440), W(0x6d59b8267ef43c5e), W(0x077184cd4ee051ab),
+     W(0x0000000032ecbb75)},
+    {W(0x7df9580c0a667129), W(0x6709392a260a86e0), W(0xd91f051e37588afc),
+     W(0x0000000005f95b27)},
+    0
+  },
+  {
+    {W(0x6be44bbc7ecc82c8), W(0xd9215f64a64fc8f8), W(0x4ff5238d47ca904c),
+     W(0x000000000c514828)},
+    {W(0x4907946f5699cb36), W(0x3b8be9087bd132a8), W(0x07eb0400d968ab70),
+     W(0x00000000273dd121)},
+    0
+  },
+  {
+    {W(0x4cb059926f5b84ad), W(0x34d050022e9f6dbe), W(0xb06378aa15ca1763),
+     W(0x0000000072717fd8)},
+    {W(0x758bf88b6aeaf8bd), W(0xfcaaedd396310e99), W(0x863eb0a8d9c67248),
+     W(0x00000000e588609b)},
+    0
+  },
+  {
+    {W(0x6d22ee1cf8439421), W(0xefd87c1af71dd1d4), W(0xd3c3dd531e6a8f6c),
+     W(0x00000000a3c6eba4)},
+    {W(0x0af5348234014dde), W(0x4e54e2bf8b6f634d), W(0xd5f5152b518800b6),
+     W(0x0000000031f70679)},
+    0
+  },
+  {
+    {W(0xc10230e99dbbd00f), W(0x180fb4b577ea8f5d), W(0x10ffe1302e2cbb8b),
+     W(0x000000008f726970)},
+    {W(0xa0a108dda68d7dce), W(0xf0fb4246c877b4e6), W(0x6d91b9ecdce4146f),
+     W(0x000000008f1df50e)},
+    0
+  },
+  {
+    {W(0x8b25526f99ca66a7), W(0x3577fe78df879981), W(0x97ebda0d848d25ec),
+     W(0x0000000080a197b1)},
+    {W(0x4f5f9c3c22f9083c), W(0xbb1a19a71e2cb272), W(0x3af1562b2765e090),
+     W(0x00000000ee3f03f4)},
+    0
+  },
+  {
+    {W(0xa5db9ba6f2e31610), W(0xc236fb0201afe3f3), W(0x7ccdace35b247dde),
+     W(0x00000000f731edc9)},
+    {W(0x1f41853d42745f3b), W(0xeb67cb5bb75cd36c), W(0x455c1f89a2f30a0e),
+     W(0x00000000dcedf8d6)},
+    0
+  },
+  {
+    {W(0x2dc177ddc72b403a), W(0xef42a649463a0ec4), W(0x57ee1daf9012af45),
+     W(0x000000000ace7976)},
+    {W(0x1336c104d90479f1), W(0x97c4d0f2ab760b12), W(0x34a9e3ac72d4ffe1),
+     W(0x00000000e62a9d07)},
+    0
+  },
+  {
+    {W(0x41181596599f0237), W(0xe545c6539cd5ef12), W(0xdd5f527bc1ecaf18),
+     W(0x00000000188a9d56)},
+    {W(0xa0fbdffd1fbeabb9), W(0xf30edb86677e8be8), W(0xc6d5353eebbb115b),
+     W(0x000000001257392a)},
+    0
+  },
+  {
+    {W(0xee9daa96232e4560), W(0x15fd2821c6bc6900), W(0x316d5bac27e23c30),
+     W(0x00000000a9e7f610)},
+    {W(0x18a83bd52cb17846), W(0x4ca8bf71f81637ed), W(0x9bf5c94f6fc5996d),
+     W(0x00000000688b9715)},
+    0
+  },
+  {
+    {W(0x81791b305b1a1e75), W(0x13efc0f985ab7e73), W(0xeca06b34f9372d33),
+     W(0x0000000053e9cdb4)},
+    {W(0xc7c5ad8da73f8be8), W(0x8ca99faa3c9fad7e), W(0x1cb63b0978f0cd3c),
+     W(0x000000009d362345)},
+    0
+  },
+  {
+    {W(0xfbbcbac0165e07f4), W(0xfadd94f7e3d4b4b2), W(0xbf3cb2897ecae927),
+     W(0x0000000078016458)},
+    {W(0xff8957c09fabc3de), W(0x1ab0f627c71b2602), W(0x6b9e59d763ee92e1),
+     W(0x00000000cd573323)},
+    0
+  },
+  {
+    {W(0x863e4db43dba0558), W(0x8c30990805ec686e), W(0xe38e78b115164b1a),
+     W(0x0000000045889c06)},
+    {W(0xf15764d13f4f39f2), W(0xa50e24cbdef715e6), W(0x20ccb5a2ca753cce),
+     W(0x00000000504c619b)},
+    0
+  },
+  {
+    {W(0x941d82fb08a7edca), W(0x8e3e3fa2959aafed), W(0xa36a322e5fa76002),
+     W(0x0000000011a5d491)},
+    {W(0x3ccb2f3af8594108), W(0x984961f29ffe736d), W(0x929187084be0d603),
+     W(0x000000004743572d)},
+    0
+  },
+  {
+    {W(0xd8c544b2d73d2900), W(0x8655096db52a06e7), W(0x3397cbd70e74a03d),
+     W(0x000000009261daa8)},
+    {W(0x4a43c417a54c43db), W(0x1f96e061d6d546de), W(0xb4ec0e109dddb39b),
+     W(0x00000000ffe3531a)},
+    0
+  },
+  {
+    {W(0x5506e605054d09fb), W(0x0e0a495c2bae430f), W(0x0508e6b790b939d3),
+     W(0x000000008b037db3)},
+    {W(0x64844c7e348e6b41), W(0xc544c02def0f395a), W(0x1a920382748e169e),
+     W(0x00000000861bcc17)},
+    0
+  },
+  {
+    {W(0x5fd52f017740f820), W(0xaa4941836e8abbf4), W(0xd94fb6ac769ad079),
+     W(0x0000000040ab7217)},
+    {W(0x731ca2c166785be0), W(0xa1edc3dbdfa19460), W(0x95ca3481b0af337c),
+     W(0x000000009a6c8bcb)},
+    0
+  },
+  {
+    {W(0xdeaf1e5a7436b45a), W(0x46099a3e79903510), W(0xb42fe1097424d8b7),
+     W(0x000000006830b5b2)},
+    {W(0xa07aadfe991e14f7), W(0x650fe612b0adbaad), W(0x21ed329e8e8afc63),
+     W(0x0000000089576642)},
+    0
+  },
+  {
+    {W(0x5005e5287ad5682f), W(0x7e07620ef3fb7bd8), W(0xe9f94b7a2e2c3025),
+     W(0x000000004e9644b5)},
+    {W(0xcee9d47fc4dbd373), W(0xea778c9579803c9f), W(0x969e192e803002db),
+     W(0x00000000bd19ae8e)},
+    0
+  },
+  {
+    {W(0xbaf8392caf4f0343), W(0x6bed7bc36f7df42e), W(0x5fe5fa49347a0cf8),
+     W(0x00000000ef9b4242)},
+    {W(0x18da775287d52ed6), W(0xeb962a7c3182214e), W(0x8742560cc0b14ada),
+     W(0x00000000f6147e4e)},
+    0
+  },
+  {
+    {W(0xaddab83ccbf1b179), W(0x8e96bbca972b4da8), W(0xb3d0ffa730220ebd),
+     W(0x00000000008d0daa)},
+    {W(0xa6c2236eba96ac06), W(0x6ee5ed147af3ac66), W(0x69634b20f8f57d18),
+     W(0x00000000f6ad40f8)},
+    0
+  },
+  {
+    {W(0x0d733bc4bc2188f2), W(0x2bbd8fc3f9ae21c6), W(0x7a9a9a251319db08),
+     W(0x00000000fe2c632a)},
+    {W(0x292f5b65b949ad35), W(0x501461baa5bd5fd8), W(0x77d3724757f87966),
+     W(0x00000000e6c76ef0)},
+    0
+  },
+  {
+    {W(0xefafd5e05eb49959), W(0x84590e5dc66da683), W(0xa6f6c9c47bf830d2),
+     W(0x000000005f9d0364)},
+    {W(0xa42bbf115b525078), W(0xaac4da20165323a0), W(0xb20a8e8408d92d42),
+     W(0x00000000ae577fbe)},
+    0
+  },
+  {
+    {W(0x47b28b1d226dcd76), W(0x4f9ab446e3af94d4), W(0xd25286ffbb0b0d39),
+     W(0x0000000065de6d4f)},
+    {W(0xe506690909cc08b4), W(0xc223d785c5810aeb), W(0x0a162a728bb5bb91),
+     W(0x0000000055f1e3e6)},
+    0
+  },
+  {
+    {W(0x7921fcfb409a3f03), W(0x42753f9611ea37b8), W(0x7c92ad32ea258bc6),
+     W(0x00000000688e8a5f)},
+    {W(0xcc6be38d6cb7a37b), W(0x36faff6131abb4b8), W(0x3d80f6393a313388),
+     W(0x00000000ebe3eee8)},
+    0
+  },
+  {
+    {W(0x82a727cd125bc103), W(0x47bf6c754bb2ebee), W(0x7fe1c0a969380aec),
+     W(0x000000000d98c638)},
+    {W(0x9e7f6eb3aed740f5), W(0x7d5cfdc6427de348), W(0x6c54645b256ed778),
+     W(0x00000000cec8fd7c)},
+    0
+  },
+  {
+    {W(0xba6cac22302a5921), W(0x97015c04f307cf53), W(0xe4c53d57a1869b29),
+     W(0x00000000ca7c5758)},
+    {W(0xd3496babffc6d15e), W(0x4571409171aedbe0), W(0xf1dec72aba22e534),
+     W(0x00000000f512471e)},
+    0
+  },
+  {
+    {W(0xeb8a71012031c007), W(0x1b2ce9870c1d2ecf), W(0xa4037714680c707e),
+     W(0x000000007982a4aa)},
+    {W(0xc751305b0d058f75), W(0xdc6b9c3ddd0348e2), W(0xbfd49987c9d82f40),
+     W(0x00000000b9fa0b44)},
+    0
+  },
+  {
+    {W(0x731dbd519eaee2af), W(0xe26558822956cf56), W(0x1b1c042c41b8fd48),
+     W(0x00000000cd6c88bc)},
+    {W(0x9faaf83557d7747e), W(0x2155e73691806651), W(0xc0351e286d2f2afa),
+     W(0x000000003d5cf22b)},
+    0
+  },
+  {
+    {W(0xdebcfc93ba37e081), W(0xf71e36525ee378f3), W(0x483192d452dc56c8),
+     W(0x000000002392841d)},
+    {W(0x85eea61fb6033e5b), W(0x82b54c119712368d), W(0x39a48f3b946f22f9),
+     W(0x000000001efa1638)},
+    0
+  },
+  {
+    {W(0x6a3c69abeb6dc2b3), W(0x5c26d91c8126e3c4), W(0x70ebbf6a7fe7dd07),
+     W(0x0000000066ed11a5)},
+    {W(0x9da3ce1062f5fae8), W(0x51f532a02e9c3737), W(0xe6b75196cb8c8487),
+     W(0x0000000039311b1e)},
+    0
+  },
+  {
+    {W(0x80e3cd46f11cd703), W(0xb5a52bed6aa0cf45), W(0x913f229d9c53cc7d),
+     W(0x00000000c6bd9ee3)},
+    {W(0x41338d8477edaa35), W(0x09502e1ae4b319d6), W(0xeb9082a887b346e5),
+     W(0x00000000b51a1075)},
+    0
+  },
+  {
+    {W(0xf653561e4e14919f), W(0xbbe01400264eb16f), W(0x244dd8f059e19698),
+     W(0x00000000e112038f)},
+    {W(0x2eebd3f73a63b694), W(0x4bbbd311aa6de0ad), W(0xea49d310e6591a58),
+     W(0x00000000ca9c1578)},
+    0
+  },
+  {
+    {W(0x4bc177337516a887), W(0x7823c52788d0bf8c), W(0x99a901927d652964),
+     W(0x00000000cbca7558)},
+    {W(0xee34b97f0535d1ef), W(0xc6fe4731ff18dd98), W(0x6c01c28906d68f2e),
+     W(0x000000002b3d08fa)},
+    0
+  },
+  {
+    {W(0xcec5f4c4996fb1c6), W(0x2dd1ef5a209d3d81), W(0xb7c78cb6eb50713d),
+     W(0x00000000ce522709)},
+    {W(0xc904c832a7badc03), W(0x671f4d4bb6c71bc6), W(0xf17de3dd11e62b46),
+     W(0x000000000f36e4f8)},
+    0
+  },
+  {
+    {W(0x70ac2ed48e3c54d8), W(0x65b797dd8470c38e), W(0x0f7f01f97150b250),
+     W(0x00000000c18728a8)},
+    {W(0x7d60bd254665ee06), W(0x28faebed60268619), W(0xee0629a88a5eca82),
+     W(0x000000004a07e192)},
+    0
+  },
+  {
+    {W(0xf7420f948ac7b10d), W(0xa1c089ef5e10a16b), W(0x8a68c1e82ea554f7),
+     W(0x00000000d73c5b79)},
+    {W(0x53e4dbde5db92bfb), W(0x2bf9ec6b1757ea71), W(0x17335dbd4a5d7440),
+     W(0x00000000980680c4)},
+    0
+  },
+  {
+    {W(0x61fc955cc18b8619), W(0x7769f71f86147f7a), W(0xd9c8afc7bd022fdd),
+     W(0x000000001f8b7b3c)},
+    {W(0x0f8af95e328f36c1), W(0x5cad58a560aa8274), W(0x8f254ea8ad724901),
+     W(0x000000006a68dab7)},
+    0
+  },
+  {
+    {W(0xb4a31a29f718c88c), W(0x9fa2b3c6ace353cc), W(0x5cfac1b5eba81e1d),
+     W(0x000000008264a09c)},
+    {W(0x38a198740c69f6b2), W(0x8da579e1566bf36b), W(0xce64d0fb699958f8),
+     W(0x00000000064f1f7c)},
+    0
+  },
+  {
+    {W(0x1bc6de2990475889), W(0x0e7e3120d63994c7), W(0x9520b09964d6aa90),
+     W(0x00000000cd814b36)},
+    {W(0x686c281513d15f63), W(0xc3882dbe74a3b906), W(0x179cb6e4a63b2338),
+     W(0x0000000037ddae6a)},
+    0
+  },
+  {
+    {W(0x9cdfc6504ae501e7), W(0xc82644cf25334503), W(0xa8c1fa455cb233e3),
+     W(0x00000000082273bc)},
+    {W(0xd070d0feb90439d8), W(0x78c50a434a6dfa7f), W(0x471c2bbd52456215),
+     W(0x00000000e38eccc1)},
+    0
+  },
+  {
+    {W(0x6ed1a244bd687b4d), W(0xeb7c116e03538bf3), W(0x0348fde98d0a97fc),
+     W(0x00000000f1af0454)},
+    {W(0xb27a5ca5445d5890), W(0x08083e756abad3b9), W(0xd934308d27916132),
+     W(0x000000008fca062d)},
+    0
+  },
+  {
+    {W(0x5871aa1d8d0b2a26), W(0xb9d6dce53d09794c), W(0xc3e4fb9450e798ea),
+     W(0x000000005eee97bf)},
+    {W(0x2c6fd5f61782e0b3), W(0x3915e8717795219c), W(0x48162d072c46627c),
+     W(0x00000000fbdc5e04)},
+    0
+  },
+  {
+    {W(0x2ad9b8b11e3f90b8), W(0xc891d2bfeb687fe6), W(0x6189a778331c3913),
+     W(0x00000000f5c4150f)},
+    {W(0xf5345e0a961afe92), W(0xda3da0d4794aed7a), W(0x687e49f391558e1a),
+     W(0x000000009193025b)},
+    0
+  },
+  {
+    {W(0x82af78ccf989a882), W(0x090b379878d6debb), W(0x1cf2ad7f92e9180f),
+     W(0x0000000057e183aa)},
+    {W(0xf14cd5b529fb7577), W(0x92770c90606d15f6), W(0xa3d093a7e5d43091),
+     W(0x00000000f10ad64d)},
+    0
+  },
+  {
+    {W(0xb6709195f4d2d60a), W(0x10f5e22aa75f89c7), W(0x015081b6863cc072),
+     W(0x00000000225c1ea9)},
+    {W(0xdc19f77b13afceb4), W(0xb23d2582d3e1dfd9), W(0xb87fd853bd79e24e),
+     W(0x000000009ab7031d)},
+    0
+  },
+  {
+    {W(0x8b4cb2bbe8fb4c1e), W(0x34c4fed69f11c920), W(0x27032e52c7c6dc37),
+     W(0x000000004c1c7cf9)},
+    {W(0x05caca4bfec1649e), W(0x888dd08858601ee0), W(0x68dee15b743258a6),
+     W(0x00000000d7d0ff47)},
+    0
+  },
+  {
+    {W(0xe1dee9217911dc9f), W(0x5065db7afa5b0d4b), W(0x17c7373b27de4ad7),
+     W(0x00000000211b4385)},
+    {W(0xd479794f296a8d3f), W(0x4e9c2a77e675545e), W(0x1b81200efb40f688),
+     W(0x00000000159b0502)},
+    0
+  },
+  {
+    {W(0x7e83831bc692c557), W(0xd61100c2ed498aca), W(0x37dff8585dea1334),
+     W(0x00000000e3216cc4)},
+    {W(0xde8bd017e6705858), W(0xf14744fb9532c378), W(0xad94a3a6b1d7bdd1),
+     W(0x00000000599e20be)},
+    0
+  },
+  {
+    {W(0x87271f6862a1070a), W(0x69beb396faf61b7f), W(0x1a90a360b6e81f78),
+     W(0x0000000029f53646)},
+    {W(0x6254637298ccf710), W(0x5817039dd2780c58), W(0x2d9fda8977ccb415),
+     W(0x0000000044fd1b03)},
+    0
+  },
+  {
+    {W(0xc151db7aaa8a843a), W(0xf78e60537fbb5789), W(0x3e567c5b2e86e6d9),
+     W(0x00000000312dedc0)},
+    {W(0x5245c2394b891876), W(0xb578994fa76520e0), W(0x8b296b7d1fa19fd4),
+     W(0x00000000c1a4f3e6)},
+    0
+  },
+  {
+    {W(0x9a2232668dffcfac), W(0xe2499981296db278), W(0xe96ffb91e5448eda),
+     W(0x000000001c2a61c8)},
+    {W(0x43f9280f4972b062), W(0x90594276b27e4d47), W(0x826d1c7e3e121435),
+     W(0x00000000a8012991)},
+    0
+  },
+  {
+    {W(0xfe63d3aa7fffe3e3), W(0xdc9ac8073317cff3), W(0x2360ad28dc524c6e),
+     W(0x0000000077a0e26c)},
+    {W(0xe9c0240bfaca1679), W(0x5b9b49bda77cb08d), W(0xfcabb9303fc4476c),
+     W(0x000000004b7430f3)},
+    0
+  },
+  {
+    {W(0x3db0415d84449242), W(0x63e3b8a8251d0f86), W(0xc4e6bcfa78854b3a),
+     W(0x00000000b4c09e31)},
+    {W(0xe13a0b2729d4e002), W(0xb22d7ec8b3b0a275), W(0x1b0e4cbc27e9871b),
+     W(0x000000005eeaa4e7)},
+    0
+  },
+  {
+    {W(0x3966124778bdb1a7), W(0x8f683514f88970af), W(0x4a91ecebdf2f24ff),
+     W(0x0000000092b09430)},
+    {W(0xe1f129bb1ef9dd37), W(0xc063421623d2307a), W(0x7c066b324cbcb8a8),
+     W(0x000000000e834344)},
+    0
+  },
+  {
+    {W(0x35b8054f937fb4ea), W(0x2b0efe72e02f3762), W(0x532c92ed7b66ea84),
+     W(0x00000000211d2cee)},
+    {W(0x1d9b1421c16fa59a), W(0x6a7e9110ecb072fa), W(0xf4abc71c9cd32c65),
+     W(0x00000000468adf4a)},
+    0
+  },
+  {
+    {W(0x9dca7d4e4279b455), W(0xcc5e4e174a8e0630), W(0xc088477747f16b8c),
+     W(0x0000000008068215)},
+    {W(0x00741897482228b6), W(0x4be5684d7cdb0228), W(0x446d184b9ca480f2),
+     W(0x00000000bee12cf1)},
+    0
+  },
+  {
+    {W(0xdec4d9e88d4fba78), W(0x4130b82c0b8697c1), W(0x33efcf98ea27cc84),
+     W(0x00000000a9722ae6)},
+    {W(0x86a5d01d641566c8), W(0x9c9db1336001c8ff), W(0xf4468e8032da650b),
+     W(0x00000000a81d29d8)},
+    0
+  },
+  {
+    {W(0x4e507dce4d0de881), W(0x37a298d1b8c88722), W(0x38e66e9eca64b248),
+     W(0x0000000020809dc2)},
+    {W(0x9d20eb663581b830), W(0x9d8aca9bc4733f01), W(0x714058c8e60a6ba7),
+     W(0x0000000044ace404)},
+    0
+  },
+  {
+    {W(0xd9c16f7b19063c17), W(0x504095b695197321), W(0x2d04193baff587a7),
+     W(0x00000000beb89cd8)},
+    {W(0x6930ba52ea1a8e5b), W(0x70ff065c21a2c760), W(0x1b3d4fb717643323),
+     W(0x0000000055ca3aae)},
+    0
+  },
+  {
+    {W(0x777b15cd4bb7a4e3), W(0xd3b610387ee98b5f), W(0xfa24ebfa401b70ca),
+     W(0x0000000099e9c78c)},
+    {W(0x906364d51188bb46), W(0x7573030a5e159a02), W(0xbba9d911cbad23a2),
+     W(0x00000000f6e3a98c)},
+    0
+  },
+  {
+    {W(0x1ccf61d00a490640), W(0x08811a4e083f697e), W(0xaa7d75927811aec2),
+     W(0x0000000042d4b0f8)},
+    {W(0xf170c82124b1d5dc), W(0xa2d755f7b7da8cad), W(0xb7b6293a762db446),
+     W(0x00000000dcd5a509)},
+    0
+  },
+  {
+    {W(0x72862ebeb60fd882), W(0xd9fd2ad803d09e94), W(0xb928e5aa9f64f13d),
+     W(0x0000000027249691)},
+    {W(0x5ea5c3c2fdb06d9e), W(0x8194b4b21f933ede), W(0xc8acd3b1976cab59),
+     W(0x00000000fe72e4d3)},
+    0
+  },
+  {
+    {W(0xc3e370127574bf67), W(0x28bcb72943f953ff), W(0xccd004835b7e0478),
+     W(0x000000005ba9379b)},
+    {W(0xf4f921b21e3d32f3), W(0x793bce5fac605288), W(0xf88114d392e2ca35),
+     W(0x00000000fc2b4c3b)},
+    0
+  },
+  {
+    {W(0x57e0157023ca6786), W(0xf64818dbfa462224), W(0x13ff328b45b57540),
+     W(0x00000000ac8a7fc3)},
+    {W(0xf58609541d0db629), W(0xf738063cd3e9860d), W(0x5e2fd8f9d63d5d5b),
+     W(0x0000000078d837c3)},
+    0
+  },
+  {
+    {W(0x4364a451560a6f84), W(0x3709eedb585eceb9), W(0x8e0c351d6b0954b9),
+     W(0x00000000c5212751)},
+    {W(0xce1f04aa2c700ec9), W(0xdc66abb0abddff94), W(0x99901c01d0f666a9),
+     W(0x00000000ae73b3bf)},
+    0
+  },
+  {
+    {W(0x7c1b46dd38f49b46), W(0x72f274f7e4b64055), W(0xe5e2fe5a9de8eab6),
+     W(0x000000009427721e)},
+    {W(0x07f7554ea6e269bb), W(0x7e61d9518223d7a4), W(0xa2344cc2c575176a),
+     W(0x00000000b8c5d317)},
+    0
+  },
+  {
+    {W(0x07b1ce844c81d2cb), W(0xd29961722444ce1f), W(0x39771bd2cb80eb3c),
+     W(0x00000000e4707dfe)},
+    {W(0x0dcb381509c187ac), W(0xd333ebafff2ca6b0), W(0xf224fe6a233a7882),
+     W(0x000000004de36bdd)},
+    0
+  },
+  {
+    {W(0xb38b0edcfe7e7280), W(0xa4a07ef8e32de103), W(0xf92bbaee34c15f90),
+     W(0x00000000d4abaf22)},
+    {W(0x5b47d3b42dab046b), W(0xecef039ed31090ac), W(0x98883da304c01609),
+     W(0x000000005bfaeb6c)},
+    0
+  },
+  {
+    {W(0xcc3ad5908c9317d7), W(0x5e24f7f8d531dfc6), W(0xb54c8f49e4f57354),
+     W(0x00000000c05a383f)},
+    {W(0xe71344be4245f1be), W(0xd766a3d18e25369b), W(0xa3c51584eff09adc),
+     W(0x00000000f7dfa62c)},
+    0
+  },
+  {
+    {W(0x5291062d8441d549), W(0x39212572964d321b), W(0x63c2478ad5ad520f),
+     W(0x0000000053f57eb2)},
+    {W(0x76fa88bf76f79098), W(0x3f7882b146b4e383), W(0xf195ba9c09efff00),
+     W(0x00000000c3f7ccc4)},
+    0
+  },
+  {
+    {W(0xc8ef81534f922133), W(0x5faaaab1e0dbcb9f), W(0xfb63b384c717ac0c),
+     W(0x0000000065ba92ce)},
+    {W(0xe5c787ad0ce73105), W(0xccf005f4af21efd9), W(0xf00515fc862d52df),
+     W(0x00000000f67bb80b)},
+    0
+  },
+  {
+    {W(0x57d78be18b89c5c8), W(0x0d204e28944d0af9), W(0xbf738ed0902a9180),
+     W(0x00000000b6276c36)},
+    {W(0x4214b2165734d503), W(0x6209ab527566b8bc), W(0xeb40ffd29a0062ba),
+     W(0x00000000e2942053)},
+    0
+  },
+  {
+    {W(0xfd2353627f26cca1), W(0xd883deeda04b86d4), W(0xdc6d33608ca951d8),
+     W(0x0000000079a40575)},
+    {W(0x9fc95d4491f6ca7c), W(0x38192a42ee8b018d), W(0x9d73bd264bf7d5e5),
+     W(0x00000000439f9955)},
+    0
+  },
+  {
+    {W(0x08668b1b28642286), W(0x6070f7511313e5dc), W(0x08b5524da0a6d273),
+     W(0x0000000026d7acbb)},
+    {W(0x4d7e33c5758c2299), W(0x3b3dce8bd3dc47d4), W(0x8941d386549e5fa2),
+     W(0x00000000438ef80d)},
+    0
+  },
+  {
+    {W(0x5bc570695a9942e5), W(0xc216a42e6482eaf5), W(0x1f45520ecefccfd0),
+     W(0x000000003cf391a2)},
+    {W(0x69084e65d7884464), W(0xb9957625ea59a4a7), W(0xe0621b5198c8d5a8),
+     W(0x0000000043bc6bab)},
+    0
+  },
+  {
+    {W(0xde67d6cd659545e3), W(0xe9813f9d72fe03cb), W(0xc898c7fa1c12fc63),
+     W(0x00000000ac800e4f)},
+    {W(0x4fefd311bfcd3284), W(0x3929a974caae34d8), W(0x8dfd5a58b45168ea),
+     W(0x00000000981253d0)},
+    0
+  },
+  {
+    {W(0xffbdd41fcdebbfbc), W(0x6653f1cc064735f3), W(0xaef83188dd76da57),
+     W(0x00000000fcccafe5)},
+    {W(0x6047bf2ea524fa10), W(0x8c2ef329f5d45121), W(0x6e8e39660a6b9f64),
+     W(0x00000000f3f8edbd)},
+    0
+  },
+  {
+    {W(0xba3d34ae3d7b744c), W(0x77c39354e23500fd), W(0xcde9f8146bb28ee9),
+     W(0x0000000037e3f5f0)},
+    {W(0x7b6c76ce8ef599e9), W(0xfcaf27065937d4cb), W(0x009bfcae312de8dd),
+     W(0x0000000017f13700)},
+    0
+  },
+  {
+    {W(0x01ce28265dc3e818), W(0xf93fc76172f155f4), W(0x05f14573813b8dec),
+     W(0x00000000b7ff48be)},
+    {W(0x191a1d574d3f5613), W(0x2a008e9bbd4626e2), W(0xa8cd60bec3e8b9d8),
+     W(0x0000000014548371)},
+    0
+  },
+  {
+    {W(0xebd766a0981ba564), W(0x0ee17153c8dddfb8), W(0x4b3cb03ce74e2209),
+     W(0x0000000016a2e2d2)},
+    {W(0xa3d697be3c71eb2b), W(0x52cbb9487a0311c5), W(0x2681f1360abca47a),
+     W(0x00000000ea7beb0d)},
+    0
+  },
+  {
+    {W(0x121afa7392ea08d4), W(0x1cf11a240f843d7b), W(0x798dbf61f10c4852),
+     W(0x00000000354a74d0)},
+    {W(0xd2683f04b685ecf2), W(0x4b804bbeb855fdb1), W(0x0769693f0dfd1e8b),
+     W(0x000000008822ea1c)},
+    0
+  },
+  {
+    {W(0x8e5ed51a0a71ff52), W(0xbce5b7c94220a569), W(0x799175ae4f9bb38d),
+     W(0x000000006e064779)},
+    {W(0xe0243bc4f2fb3a46), W(0x89d1b7e4faaae03e), W(0xeccdfd35939ef462),
+     W(0x00000000cb6f5d3e)},
+    0
+  },
+  {
+    {W(0x4dec921d9649238f), W(0x7bf79e7ce77cb76a), W(0x3da4b4ea8365ec18),
+     W(0x00000000c6de384e)},
+    {W(0x9d1f80f3c236cc46), W(0x02f5904aac50fda9), W(0x6d089ff9fd22818e),
+     W(0x00000000b94641c3)},
+    0
+  },
+  {
+    {W(0x7568415483a292f2), W(0x1bb5e57f4ea7b4ad), W(0x2a5f4402816fa3ec),
+     W(0x00000000c17f15bf)},
+    {W(0x0a7b66c9e3f70bd4), W(0x31bb2ab80467f310), W(0x6391e04a01969214),
+     W(0x00000000cbeb80dc)},
+    0
+  },
+  {
+    {W(0xaad5f4371d87083e), W(0x4e0debec88328dc2), W(0x6beed785039a325d),
+     W(0x00000000e6eca707)},
+    {W(0xdc45bac278ed20bf), W(0x8a880dc3a66727a0), W(0xd2084efbc1d4edfa),
+     W(0x00000000b3d74696)},
+    0
+  },
+  {
+    {W(0x3b909a8cfd11849f), W(0x813529cb31cdf41f), W(0xf6cc983d4de6ff49),
+     W(0x0000000094da6f21)},
+    {W(0x549c23a9bce3044d), W(0xbdfaca3b0cd9e1c9), W(0x9b3d7677fe4470f4),
+     W(0x00000000415de5ca)},
+    0
+  },
+  {
+    {W(0x4d0faadbbc588199), W(0xad13abeabc36487f), W(0xa4f9b29dbe9398ee),
+     W(0x000000002dc5fc0f)},
+    {W(0x9f7f77020e24228c), W(0x2c9aa03ba72fa4c8), W(0x3f9b3fef63942552),
+     W(0x00000000cc20cbfa)},
+    0
+  },
+  {
+    {W(0x9a5186b69a9c1f59), W(0x03df65b3a8338769), W(0x9ac849728cd8f0c6),
+     W(0x00000000c96bc053)},
+    {W(0xc562ee6aa75ec5e8), W(0x3e7cb2f7a3fa0949), W(0x8dc925e21e338f03),
+     W(0x0000000046dc5811)},
+    0
+  },
+  {
+    {W(0xb0c0f88f80077af6), W(0x373519dfec0fca66), W(0x778d9238df21741b),
+     W(0x00000000cb9e9145)},
+    {W(0x50b8dba5d87853da), W(0x10b77b23fbb88d91), W(0x3253760d26167482),
+     W(0x000000004356eb1d)},
+    0
+  },
+  {
+    {W(0x1d68a205a09663e1), W(0x510be27302e81f69), W(0x8f1c1669f509ae05),
+     W(0x00000000b1b1073b)},
+    {W(0xcec3f71be1789cc0), W(0x589bcb52293b393a), W(0x88766c7d247cb10a),
+     W(0x00000000601dbcf4)},
+    0
+  },
+  {
+    {W(0x61811723753ca99d), W(0x21d19f683bd94ad0), W(0xa6baf4e99710a0aa),
+     W(0x000000007e75feb5)},
+    {W(0xffdc50b31b49ae0e), W(0x1f134b47f2a1846e), W(0x4ee4eec78a20eced),
+     W(0x0000000070e5dc5f)},
+    0
+  },
+  {
+    {W(0xcfef68542140fade), W(0x78996a1e1486cfcb), W(0xe4eb130a3e7e0378),
+     W(0x00000000336ba6a8)},
+    {W(0xd7b17471f7326d90), W(0x844fbcbf222f9794), W(0xc010f44095621dda),
+     W(0x0000000080c1b47c)},
+    0
+  },
+  {
+    {W(0xa68bc41f8222300e), W(0x7d838517408de3e5), W(0xdda815d68d617fbb),
+     W(0x000000002b60782a)},
+    {W(0xc731acdfe9cfd9fd), W(0x3e4c3a5c8a309dbf), W(0xe201cbb0088eb29e),
+     W(0x000000008ce76c97)},
+    0
+  },
+  {
+    {W(0x17a610444567d15f), W(0xbe8322ce93e9d3bc), W(0xad1aa8fc1491a0ba),
+     W(0x00000000c2646f0b)},
+    {W(0x2a8bcc22aa75049b), W(0x83a13fd813d6d099), W(0x2655243330ae7510),
+     W(0x0000000034e09ca8)},
+    0
+  },
+  {
+    {W(0x1933d7d6328a6d8a), W(0xed4c9f922d87555f), W(0x6fdea7c80e8695d3),
+     W(0x00000000219b25a8)},
+    {W(0x2098796707fe892d), W(0xf48883ae9c1e9605), W(0xd26ebe629b6411f0),
+     W(0x000000008a514a37)},
+    0
+  },
+  {
+    {W(0x4c4f6c7b52237310), W(0x445fac1e951ea56c), W(0x7a7a0dd9e35d9363),
+     W(0x0000000057a0d48d)},
+    {W(0x35de0e660ecca59a), W(0x8db49f19141e61de), W(0xce3a5f0c3a8f177f),
+     W(0x00000000856d1321)},
+    0
+  },
+  {
+    {W(0xf10d855b5325140b), W(0x8765fcce858e26b1), W(0x8b73cf294c6f2625),
+     W(0x000000007be1916b)},
+    {W(0xe612d6fffc5baff6), W(0x7e081841cfb0476b), W(0x4c9f48fc9aa126ab),
+     W(0x000000004829a278)},
+    0
+  },
+  {
+    {W(0xb2a17458b49bfa38), W(0x8aa857bd8d5a2ad7), W(0x53095b3ea920b4a4),
+     W(0x000000001aa25d2b)},
+    {W(0x6769e75da13261af), W(0xb9b18ad569196d99), W(0x3e61e251b4649b0d),
+     W(0x0000000021878578)},
+    0
+  },
+  {
+    {W(0xb87ae0ca9709955e), W(0xeadb95c7a3d15d83), W(0xa272926d8d50e60e),
+     W(0x000000001e9f1d76)},
+    {W(0x7b3e96cc76ccf5cd), W(0x32c8fe7212c0e6bc), W(0xb8b0ea9a52bc058a),
+     W(0x0000000061e8e50c)},
+    0
+  },
+  {
+    {W(0x23e5835d43ae56bd), W(0xd7b67ddda9a9f264), W(0xb5814c35dbd6106d),
+     W(0x000000009ce3b5f8)},
+    {W(0x19f0e57995520b13), W(0xf852375a6f1f3b0b), W(0xf8b1d817873766ef),
+     W(0x000000004a0a62b1)},
+    0
+  },
+  {
+    {W(0x34a773e62caeef73), W(0xa5d43d1f1680443c), W(0x7ca387e5f72147ba),
+     W(0x00000000d2674c4b)},
+    {W(0xe8a7884c6d84962e), W(0xcfd450d99e13657e), W(0xd2d50d525799c13d),
+     W(0x00000000bb9bd4cc)},
+    0
+  },
+  {
+    {W(0x299928374332b347), W(0x429ea6751aab0c0b), W(0xb037eb941fce6a5d),
+     W(0x0000000068fac92e)},
+    {W(0xb23715c9e36c5631), W(0x2df0a9d86efeeab0), W(0xed58b7d4a92efe73),
+     W(0x00000000e2c9ac8d)},
+    0
+  },
+  {
+    {W(0xb1d88cf5df2d9511), W(0x0036bc6e3bada599), W(0x75af527ee771b84d),
+     W(0x000000006cfdeb62)},
+    {W(0xd756b1df5b62dfc9), W(0x9caa93e58c21e535), W(0x05929fa4d7eb5e02),
+     W(0x00000000aa9e574c)},
+    0
+  },
+  {
+    {W(0x3a9b4531e3b22658), W(0x968c3394e73234bc), W(0x5138dad88e6e9a6d),
+     W(0x00000000c51f7171)},
+    {W(0xd672ff9755f9b33f), W(0xf2aa461ca7419b8b), W(0xd520ba2494cb0f1c),
+     W(0x00000000c478b632)},
+    0
+  },
+  {
+    {W(0x1c227de26c7b8ea9), W(0xb27500be5d4f2bca), W(0x60735a8db3a3904c),
+     W(0x00000000e0d8fc07)},
+    {W(0x3ee2019b64df3735), W(0x4b1cffddcad6ee8c), W(0x80dc61a9a5730f12),
+     W(0x00000000e3fa433c)},
+    0
+  },
+  {
+    {W(0xa152cd1e6ae133a4), W(0xd97270340344ef4a), W(0xa8a91a487796ebbd),
+     W(0x000000002c3b7477)},
+    {W(0x48310ab55ff6971f), W(0xa5d8f8e3da146724), W(0x827588fe32d9aff3),
+     W(0x00000000684c6b50)},
+    0
+  },
+  {
+    {W(0x533e389706f9ed9c), W(0x1ab4332fd70193fa), W(0x53244fc5400bcf7d),
+     W(0x000000002c94bc2c)},
+    {W(0xe54603ca0159e3d7), W(0xc58e3bd39d17cd42), W(0xad57463284784d19),
+     W(0x00000000c52b8a47)},
+    0
+  },
+  {
+    {W(0x41e4883dddea519a), W(0xc80853c1065a5978), W(0xad7b6d7648d590d2),
+     W(0x0000000041c8acdc)},
+    {W(0x0490568290d09273), W(0x69e7dec9f5f651e7), W(0x775a7fe85c86a230),
+     W(0x0000000054a4a6bb)},
+    0
+  },
+  {
+    {W(0xfa70e2b41b0bdb8e), W(0x6f986023beeb9a4b), W(0x110a567894f40ba2),
+     W(0x00000000783b0ef9)},
+    {W(0xf07a778e77895199), W(0xa10614b49d156e2c), W(0x6c4c03402fef8600),
+     W(0x00000000490f8d16)},
+    0
+  },
+  {
+    {W(0x2e4a0df97a45574f), W(0x8392ddd73dee0bf9), W(0x98080927f6cfb2c2),
+     W(0x000000006e8c1c83)},
+    {W(0x112682e79b4dfe08), W(0x7b79061bf30630f1), W(0xf05c12e2e166df2e),
+     W(0x00000000b6c5bab6)},
+    0
+  },
+  {
+    {W(0x6b27abf3f4930a8d), W(0x43809761e8c28685), W(0x5fe8a0c9fbc55621),
+     W(0x000000001c732c0a)},
+    {W(0x7fafc3b720e02e44), W(0x01d0d84c68808b72), W(0x8bebe666b8613524),
+     W(0x0000000030bf9507)},
+    0
+  },
+  {
+    {W(0xd8820d4f90d7d213), W(0x33e836ceb86d5d7f), W(0x62fe86d7a9af1619),
+     W(0x000000005107388f)},
+    {W(0xc6a47576b25536db), W(0xe83fc0a45131eb9c), W(0x6fea9784e4228ae3),
+     W(0x000000000b74ee88)},
+    0
+  },
+  {
+    {W(0xe82b8f28d5f232fd), W(0xdff053ac6d763b61), W(0x37e32944178c986a),
+     W(0x00000000adf8acae)},
+    {W(0x75600aeae1391321), W(0x326a34f3fd8a5ece), W(0xf17aec5fc32331c3),
+     W(0x00000000bc2be4c7)},
+    0
+  },
+  {
+    {W(0xac39bc21be832a10), W(0x91114b66bb0097f7), W(0xb100d2079f84f8c7),
+     W(0x0000000045acc7dc)},
+    {W(0x12570e162e5404dc), W(0x1eb6c5730036db4f), W(0xfe33a310d730c1a8),
+     W(0x0000000073701e60)},
+    0
+  },
+  {
+    {W(0xe3a8d540b45bbbc1), W(0xb9b7047358cc00f1), W(0x7ba8b73d7942a206),
+     W(0x00000000058336d3)},
+    {W(0xbbc51f806da0ca9e), W(0x0becdcd40f0925c8), W(0xa1009f7ef949f5c3),
+     W(0x000000006948ecf6)},
+    0
+  },
+  {
+    {W(0xb63ef94e929ef6e4), W(0x92439ae0221a695e), W(0xc2827079f14dc8b1),
+     W(0x0000000060b8c7ac)},
+    {W(0x70045f53c6bd7111), W(0xccf150e5b8bdeec4), W(0xc77569884574c53c),
+     W(0x000000009c8c5713)},
+    0
+  },
+  {
+    {W(0x480d865d3e294dc7), W(0xdea3959c11945994), W(0x5b7a1f4e28270b83),
+     W(0x000000009cccd09a)},
+    {W(0xf151af92ff3f0131), W(0x1a93b69d92d2da1f), W(0xd3cec906beef4750),
+     W(0x00000000880257ae)},
+    0
+  },
+  {
+    {W(0x20cc17f790107dcd), W(0x54fde09bf3683518), W(0xb5ec36b7cb33cc9b),
+     W(0x00000000a1136135)},
+    {W(0x53b09446be9265dc), W(0x25016cbed94283c8), W(0x0ce35e43c423e9d1),
+     W(0x000000001020afc1)},
+    0
+  },
+  {
+    {W(0xdd7a3fffa36770d1), W(0x0a202f2b2423d88a), W(0xc956694aec1bc318),
+     W(0x000000007f966066)},
+    {W(0x287a269dbcdf0cbf), W(0x344e4f0f3c82364b), W(0xd55fbdee6414a7f1),
+     W(0x00000000b4ae5431)},
+    0
+  },
+  {
+    {W(0xe89933e17b2b21e5), W(0xa38ab6f1226dbd71), W(0x1318c0cc0df366a4),
+     W(0x000000009a09ecce)},
+    {W(0x2ecde7e48c7e78ee), W(0x8f952a3127b0249c), W(0xab6924c406539e6d),
+     W(0x00000000fd8c32f0)},
+    0
+  },
+  {
+    {W(0x95fa132219522a96), W(0x5d3b3fdcbc24986e), W(0x3c944d86dec56006),
+     W(0x000000001b810901)},
+    {W(0x885357dacfb23b60), W(0x7bc10f3e28b87cf6), W(0xc5f2a5f36576d36d),
+     W(0x00000000325c2062)},
+    0
+  },
+  {
+    {W(0xf0107e343ca8a90f), W(0x43347de6a4a67f26), W(0x525d064cb19e9de9),
+     W(0x00000000cdc3917e)},
+    {W(0x5bf964657e456f87), W(0x1a7bf0b027e7371f), W(0x92cfde3d69ae61a6),
+     W(0x00000000df97dbe6)},
+    0
+  },
+  {
+    {W(0xbf6d10e1924f5d8e), W(0xcf10c0ff088f56db), W(0x9b20d7c669e69df7),
+     W(0x0000000092f3f481)},
+    {W(0xa097247eec926ec4), W(0x4380c8992cc01f7d), W(0x02a3e30df311073c),
+     W(0x000000000d09421d)},
+    0
+  },
+  {
+    {W(0xc25966d2b0832a3e), W(0xd6bf40ffc457e658), W(0x09a669718a5f5681),
+     W(0x0000000069f5f62b)},
+    {W(0x7c496c8bf5c9e92c), W(0xd36becc2b60ea83a), W(0x8b9939c076b5d871),
+     W(0x000000006eeb9776)},
+    0
+  },
+  {
+    {W(0x31492652bb28c1c2), W(0x6067cf85770cb8fe), W(0x93b1574b7207e532),
+     W(0x0000000044862c56)},
+    {W(0x868c973e61c65aca), W(0x7ae18862b52abfd6), W(0x72b98c15b0255708),
+     W(0x00000000ce2c3050)},
+    0
+  },
+  {
+    {W(0x20c0850daff431db), W(0xee3b46278b7e21c5), W(0x7aca4003009b3ea7),
+     W(0x00000000ac3fb83b)},
+    {W(0x62f9b62490a85381), W(0x56df0d78130fc436), W(0x44f8d1c4eb09ac2a),
+     W(0x00000000eabdda8c)},
+    0
+  },
+  {
+    {W(0x3e6fa25b75d9c9aa), W(0x5d46308ab3d0e0f8), W(0xed3790f9b69170eb),
+     W(0x00000000109c5263)},
+    {W(0x01bd333ea10d1030), W(0xa7945000083181fa), W(0xc58c8705c8ef4b7c),
+     W(0x00000000a690c14a)},
+    0
+  },
+  {
+    {W(0xdc6e4a591e5d3241), W(0xdd728765b0a02e85), W(0x3ff3295d3317a642),
+     W(0x0000000051e9f4bd)},
+    {W(0x7802f80527aebea7), W(0x68a34151395b2253), W(0x7e602054d7ff7205),
+     W(0x00000000fdb48aa4)},
+    0
+  },
+  {
+    {W(0xb3e48a80f2fe9d67), W(0x8fec193635024481), W(0x07c9235676fdabd2),
+     W(0x00000000360b2562)},
+    {W(0x15a68128afae17e9), W(0xc6a05c53da3c1ada), W(0x904463d6ff52fb2d),
+     W(0x000000006e546701)},
+    0
+  },
+  {
+    {W(0x98d09b4e47b86222), W(0x0b8a61fcfac03dff), W(0xd9f85fdc6145fa54),
+     W(0x0000000049c9d6dd)},
+    {W(0x23cb85f057c8dbce), W(0x5c8d8f5dd41e72ae), W(0x160ad69189267e48),
+     W(0x000000001f061459)},
+    0
+  },
+  {
+    {W(0x8b158f24c9d73e21), W(0xd24ce3e643855743), W(0x1dcbc4da3b46f0df),
+     W(0x000000001a49568b)},
+    {W(0x9852706932a315fb), W(0xc4b691a7dec6b580), W(0xe3d7eaa9eb8b5acb),
+     W(0x0000000023dc2b02)},
+    0
+  },
+  {
+    {W(0x11d0773e123488d2), W(0x3949a5497b3373ac), W(0x60af5ec43c35f3e4),
+     W(0x0000000008f71bac)},
+    {W(0x480cfb6d93db8269), W(0x7f738b541c74ac5c), W(0xce6bd3d06ba22cd5),
+     W(0x0000000073ecf70a)},
+    0
+  },
+  {
+    {W(0x613b4cc828ea9e38), W(0x99d2f095018053ab), W(0x5666aecf823847d7),
+     W(0x00000000b119f020)},
+    {W(0x7a809791c8f61379), W(0x180c9eb4e11cb996), W(0xdef9c0633c2d62db),
+     W(0x00000000f505a8e9)},
+    0
+  },
+  {
+    {W(0x2080fb989de30ca3), W(0x353da7b712a9aaaf), W(0xc66f60a9a8fa9dcf),
+     W(0x00000000a85b5458)},
+    {W(0xe055db490a624f21), W(0xeb69341a1bbdf334), W(0x46004e27397baafd),
+     W(0x000000000db47f2f)},
+    0
+  },
+  {
+    {W(0xda0c03e218114c15), W(0x90376e73ffba68ac), W(0xd440ed190d5f1ea5),
+     W(0x0000000057e3ac30)},
+    {W(0x17136e3451bf8a48), W(0xbe468ed83163cf04), W(0xc59dbc0e8203ed91),
+     W(0x00000000004f8a50)},
+    0
+  },
+  {
+    {W(0xe8c7730e2ab45315), W(0xbb9e26f31f8ad1f2), W(0xcf358324c7b6d183),
+     W(0x00000000f2654eca)},
+    {W(0x9fbb75b46d15e597), W(0x62c9d4f562e884a7), W(0x806152af0278ac38),
+     W(0x00000000211ac9d7)},
+    0
+  },
+  {
+    {W(0x6f870d3348455549), W(0x2f36dee95a438dee), W(0xefaf575bf94300a9),
+     W(0x0000000000367b8e)},
+    {W(0xa8db03aebdf356d8), W(0xf3f578d907d2e51a), W(0xf2fa7b2eb283007b),
+     W(0x000000003031ad41)},
+    0
+  },
+  {
+    {W(0x20d55bbaa59068fd), W(0xe05265c649ff629c), W(0x94643c35b9e33273),
+     W(0x00000000cc97ebef)},
+    {W(0x3726466d2bd1ed49), W(0xb993a3405e6a45ee), W(0x7ddcfb91da6d3142),
+     W(0x00000000e87307b5)},
+    0
+  },
+  {
+    {W(0x902a999a092c3c9d), W(0xcfc941cb92a49339), W(0xfd22b73d1e1e90b9),
+     W(0x0000000017225485)},
+    {W(0xa72c7c3f642b51a1), W(0x653461c193b98569), W(0x64ccce1f29e49942),
+     W(0x00000000822b9038)},
+    0
+  },
+  {
+    {W(0xbbfa528740bda677), W(0xda23775e57cca6a7), W(0x273d2b401df95c48),
+     W(0x00000000dce52925)},
+    {W(0x297c4b04845d924f), W(0x126a81225598e7a8), W(0xc043283898505fbc),
+     W(0x00000000576e3d3a)},
+    0
+  },
+  {
+    {W(0xc66062b540baa61c), W(0xa0bd6204ce7d1220), W(0x945b266e564cda17),
+     W(0x00000000b143b9cc)},
+    {W(0xe74cf0d7b821b698), W(0x79df5a0674e15d57), W(0xd266bb5ff57f159c),
+     W(0x00000000e94247db)},
+    0
+  },
+  {
+    {W(0x46d7b517054abebb), W(0xed7cc52e6766a06d), W(0x085c339d3bd0db5d),
+     W(0x000000006d553b92)},
+    {W(0x6985a7dab45516b2), W(0xd57399bd91da89b0), W(0x4f57246cacc4546b),
+     W(0x00000000772febef)},
+    0
+  },
+  {
+    {W(0x831f1d8f4637c230), W(0xca8077b67b2555c2), W(0x857f7af0f0dc6a95),
+     W(0x000000009ec47491)},
+    {W(0x13f5b9abd1f62ade), W(0x71430664aef85cf9), W(0x2ac9adc5b67f5348),
+     W(0x00000000e217d1ba)},
+    0
+  },
+  {
+    {W(0x19996cd0be53756f), W(0x8dbed42831c69282), W(0xd82656c3c3349f69),
+     W(0x000000009ac8b2ff)},
+    {W(0x087192dba0fecc37), W(0x991bedfc3bd91c6c), W(0x7037076e164e4cb6),
+     W(0x0000000051286b2c)},
+    0
+  },
+  {
+    {W(0xa87ade8f1f39ff02), W(0x4e8a3e8c6249c6b9), W(0xfc442f27cf7c1339),
+     W(0x00000000fe7e3086)},
+    {W(0x775c44c8c14406f4), W(0x2ae690f02b03a76e), W(0xfa57b31f7a4c860e),
+     W(0x0000000017ae0931)},
+    0
+  },
+  {
+    {W(0x5cb377d74cc58a30), W(0x75668960e3a271fa), W(0xa42fc16b4b06a062),
+     W(0x000000003475537a)},
+    {W(0xf7ec53d6cf0ce783), W(0x837fb7cddceb01a9), W(0x6c0b92869f115605),
+     W(0x0000000068a5d912)},
+    0
+  },
+  {
+    {W(0xd6113b423b780338), W(0x12e33aa958a1df53), W(0xa2f3ba32145835e7),
+     W(0x00000000390f5f30)},
+    {W(0x8212c347725e516c), W(0x31a61b3a673e45bb), W(0xb4c3315b7726d24b),
+     W(0x00000000253806c6)},
+    0
+  },
+  {
+    {W(0xf86e29a62e7396c9), W(0xd8de1a9aa16b3d13), W(0x07a9fd6f6f818d5e),
+     W(0x0000000015d3e058)},
+    {W(0x43af5a924e949c55), W(0x7311af864e1f751f), W(0x3199f0e49990adb0),
+     W(0x00000000351dea71)},
+    0
+  },
+  {
+    {W(0x50e90c626323ea9b), W(0x50b2d7223e4756e0), W(0x4f718683cb80aad2),
+     W(0x000000003a56a73d)},
+    {W(0x2e52e06048ba0306), W(0x62871dde0ac5cbed), W(0xcf10f8c9cff1323e),
+     W(0x00000000116b766f)},
+    0
+  },
+  {
+    {W(0xbca84d8e78214fb4), W(0xbb2e4787c1d41cf3), W(0xd842718cc5ea3e47),
+     W(0x00000000f630588b)},
+    {W(0x9048c3027cab2332), W(0x070fd6d11b3fe350), W(0x19e478ac200d7ffd),
+     W(0x0000000072c46179)},
+    0
+  },
+  {
+    {W(0x0332234bc3a99bb4), W(0x6538e76d4025fee3), W(0xa9a919f33ae5ee10),
+     W(0x00000000230fde48)},
+    {W(0x550f0d31cda9ddc9), W(0x428c5e2f5fc1fcd6), W(0xc6b830b011e19e19),
+     W(0x000000002c2b24a1)},
+    0
+  },
+  {
+    {W(0x49a0ef08fb41da95), W(0xe5547ad4b9362454), W(0x1451114b09af3917),
+     W(0x000000001177f1cc)},
+    {W(0x5b3e3c30be260f30), W(0x2d9a3bc28a5da7b3), W(0x92cecb33badcab7a),
+     W(0x00000000c119d8fb)},
+    0
+  },
+  {
+    {W(0x6816c13eccceb360), W(0x1b11a10f74bbb9f8), W(0x44e02072999c94ab),
+     W(0x000000001f3119b4)},
+    {W(0xcff4ecdfc0ac9481), W(0x35ce16653c615092), W(0x606aab505b56d391),
+     W(0x00000000482e13f3)},
+    0
+  },
+  {
+    {W(0x534414519c40c271), W(0x861a2576e8a18a94), W(0xfca0abf46b2f071b),
+     W(0x0000000084b116f4)},
+    {W(0xe43df726bffc1202), W(0xdba6dfc178f45969), W(0x07784e75fe8d95f0),
+     W(0x0000000013b9b40e)},
+    0
+  },
+  {
+    {W(0x9ae58562dd8279f6), W(0x170964cc7230b221), W(0x46e390a99fd7e7ca),
+     W(0x000000001f23fd78)},
+    {W(0xc05bcd27b8e3d054), W(0x9b4eb31ca728a98e), W(0x2a479fffd6870145),
+     W(0x00000000f8e1c245)},
+    0
+  },
+  {
+    {W(0xa0fbd08056711870), W(0x94c60bfbbbbc3bfb), W(0xe02250d0aa00fae4),
+     W(0x00000000b5ba0e0a)},
+    {W(0x056d97b7cb62da90), W(0x9a27bdf9b808439e), W(0xfa209241da8e8d2c),
+     W(0x0000000048ed8ec4)},
+    0
+  },
+  {
+    {W(0x94c6222634e72dce), W(0x3fd19b65afb9f59d), W(0x6e0f7f5d984f456e),
+     W(0x000000008cdcd53a)},
+    {W(0x7534c511c64437ac), W(0x76308ed77e8a83bf), W(0xcdc67950af85c00a),
+     W(0x00000000b8f37c61)},
+    0
+  },
+  {
+    {W(0x6ad6230ce66a5924), W(0x1fd19cbdaa5a6066), W(0x143eae3b58db7f16),
+     W(0x000000006ec61525)},
+    {W(0x5628587bdf2c88b5), W(0xd40e259633b53909), W(0x1a1e5fc2689866cd),
+     W(0x000000009efe7a3a)},
+    0
+  },
+  {
+    {W(0x7453c6b50e3ef09c), W(0x8218b623183cfeb8), W(0x5a758b06d3bf916f),
+     W(0x00000000daa50196)},
+    {W(0xcb8413092e4bc888), W(0x3271deee302419e4), W(0x6dec2b7b7a9b324d),
+     W(0x000000000f1a412b)},
+    0
+  },
+  {
+    {W(0xf4cd9a48cc0fa9e8), W(0x3e0b8e493595d8db), W(0xb1e4b6e5a8085bf5),
+     W(0x00000000ddea9953)},
+    {W(0x4a14630c4cadaa6a), W(0xb584c3eeb4a58ca2), W(0xf4aa5285020ad93e),
+     W(0x00000000184cdab2)},
+    0
+  },
+  {
+    {W(0x3fa90ed0d767cace), W(0x57df6460b49c4a4c), W(0x75060c337fdbdd6f),
+     W(0x00000000d4de468b)},
+    {W(0x4707bdb6d969e648), W(0x932f37416509707e), W(0x64a2669410334eab),
+     W(0x00000000ad4a9651)},
+    0
+  },
+  {
+    {W(0x4080f46851137803), W(0x03e9fadd138b26f2), W(0xc11c1108f8055880),
+     W(0x00000000eb8375ad)},
+    {W(0x7d6d03474d87a5b2), W(0xd497a5a9983c6fc3), W(0x370f9b4b039cf8a8),
+     W(0x00000000fa853dc4)},
+    0
+  },
+  {
+    {W(0x2fa1a655732da19b), W(0x46e1f1ec2facc565), W(0xb5517e55f6fe74b2),
+     W(0x00000000485d9f28)},
+    {W(0xc1b6c02345a6e6b5), W(0x4621d6ecfd4f0792), W(0x47664f1fd2a26395),
+     W(0x00000000035dd985)},
+    0
+  },
+  {
+    {W(0x03285e600e6fd5e7), W(0x0da9e3b33e801cbb), W(0x6058d8f9a42a8225),
+     W(0x00000000fbcc1244)},
+    {W(0x676a1a573c7ec113), W(0x8aba07c4462dfcd3), W(0x29fe36d95604cd92),
+     W(0x00000000cbb4312c)},
+    0
+  },
+  {
+    {W(0x9bed0c1e09ae317c), W(0xbb59f48b3406e86b), W(0xe837a3d2613c6beb),
+     W(0x0000000025eea6d3)},
+    {W(0x3cb807d5b39d0b9a), W(0xd69b2a6ddc70ef9d), W(0x49c5352100ff776a),
+     W(0x000000001a138256)},
+    0
+  },
+  {
+    {W(0x7e966951c2abd9cd), W(0x90ec05bcbc513101), W(0x065df11d45868207),
+     W(0x000000003b902c86)},
+    {W(0x314890047bdd8c1b), W(0x58fd1fb7148bc293), W(0xc53b9d7c8a02cb52),
+     W(0x00000000152a2172)},
+    0
+  },
+  {
+    {W(0x92fbba4d343c5a3d), W(0xcd6fa92506ce086b), W(0x574784b682e4ccc5),
+     W(0x00000000c6b8f2c2)},
+    {W(0xe3f09020f4bec47e), W(0x23825face7b9c11a), W(0x1681a0afa7634aa9),
+     W(0x000000002e529f39)},
+    0
+  },
+  {
+    {W(0x538bea80cf071de6), W(0xb288d6168277e873), W(0xfdc524fab0bfd621),
+     W(0x000000009d1b4ffa)},
+    {W(0x65497984d6d924a4), W(0x38b29c24c5875861), W(0x9757a218cb49e381),
+     W(0x000000009bc7f03f)},
+    0
+  },
+  {
+    {W(0xad997baf5c74bd70), W(0x7ef9fc557797f657), W(0x10c47c20a24aab3f),
+     W(0x00000000409772a0)},
+    {W(0x9484ae2599f8359e), W(0xb0b17143605b9b55), W(0x4230b79ee824ab36),
+     W(0x0000000059aa4ef3)},
+    0
+  },
+  {
+    {W(0x4e270887d5b3e5d2), W(0xeb520176ae656fed), W(0x7ec6c7b410be27fa),
+     W(0x000000000865dd46)},
+    {W(0x6381c97faec4dd3e), W(0x00bb13dbe8eae14a), W(0xe4395c4d120c964a),
+     W(0x00000000e828afa0)},
+    0
+  },
+  {
+    {W(0x2ede4ad2c6bfbc4d), W(0x156cf7ae30b7e73f), W(0x105bb870a5a62503),
+     W(0x0000000040bd0a69)},
+    {W(0xd3938dc445c659ee), W(0xe2470ca7d00d3493), W(0xc1c856a0c6ab6c9b),
+     W(0x0000000087e7dfe6)},
+    0
+  },
+  {
+    {W(0x471cbd49966808c6), W(0x9366956aca9a59dd), W(0x0724ac0ae05fd5da),
+     W(0x00000000b7f29bc6)},
+    {W(0xb703fbb3ded40a2c), W(0xcd2687327bc79ae4), W(0x4eabb92a5df06159),
+     W(0x0000000045aec3b5)},
+    0
+  },
+  {
+    {W(0xee799874727c2add), W(0x789b24464e306b78), W(0x0ce437c983bc5d6e),
+     W(0x0000000017ca47bb)},
+    {W(0x9f1afbbcfd210a0c), W(0xd5e48c615dbf5465), W(0x34eb606ceef37ce6),
+     W(0x000000009e980a07)},
+    0
+  },
+  {
+    {W(0xce45752e26066a77), W(0x84a944b75d40eaf8), W(0x032a804fd5bcf78e),
+     W(0x00000000e77ce896)},
+    {W(0x60dbcbfc6c0a9571), W(0xf8a907e3431d12e7), W(0xc277bbc2e423c3b0),
+     W(0x00000000c81e2554)},
+    0
+  },
+  {
+    {W(0x6bdcb874abe381d1), W(0x3efec406e514a589), W(0x03f49098aef101d1),
+     W(0x000000002d29fb54)},
+    {W(0x97b0dacb325efb50), W(0x9f7e7b49667232ae), W(0x1b0b2184f0057b56),
+     W(0x000000007f08c12f)},
+    0
+  },
+  {
+    {W(0xce614950f64f6470), W(0x46d96dd39f3554ce), W(0x935269bb1840800d),
+     W(0x000000005264066e)},
+    {W(0x670997783673c402), W(0xa4d00c01a387bdc4), W(0xbf5e33d579eca7d2),
+     W(0x000000002b69f174)},
+    0
+  },
+  {
+    {W(0xf1f9f140f83ef4c6), W(0xb71d1cf082b50093), W(0xb59a65593ec503e1),
+     W(0x00000000acb9d1ae)},
+    {W(0x865b7f40ce1b1346), W(0x0a858d8c907af15d), W(0x25bd4377bb91f26b),
+     W(0x0000000062e4ecae)},
+    0
+  },
+  {
+    {W(0x734ea0b0e68df8ef), W(0x1bb5bd66761d51fe), W(0x998c382cbe4644bd),
+     W(0x000000008bde1163)},
+    {W(0x36277ee98afea1e9), W(0xa54b1142fc8d4361), W(0x40c8b5c37525cf36),
+     W(0x00000000cf4ec869)},
+    0
+  },
+  {
+    {W(0x7954aae5b0144aba), W(0x9fbd43981c4e6933), W(0xd3800497d8b08e40),
+     W(0x00000000bb27dfb2)},
+    {W(0x7b9ab6cbb1e23ce2), W(0xa6f191e71749aaba), W(0x245e83a96cc6854c),
+     W(0x0000000083d1a22b)},
+    0
+  },
+  {
+    {W(0x03aa32947dc9c25f), W(0x5a924d6bb7735a27), W(0x773f9424072a6b46),
+     W(0x00000000ac261417)},
+    {W(0xebebc6ec39e7cabd), W(0x61e67018aeb4978b), W(0xb114067004d466e0),
+     W(0x000000005491bf25)},
+    0
+  },
+  {
+    {W(0xe084901fb74d8a0c), W(0x559a8e11ecd9feea), W(0xf673495a0c507a53),
+     W(0x00000000d403f74b)},
+    {W(0x0ee37720ef467abd), W(0xb30d1d4780ae6107), W(0xfe4074dec66f66d1),
+     W(0x000000000ed8c80e)},
+    0
+  },
+  {
+    {W(0x7bba2cb47170a968), W(0x00e769f662405927), W(0xde2519776cc6c671),
+     W(0x00000000917b7998)},
+    {W(0x1796004fd3e9cc93), W(0xa7a34d808934ce65), W(0x3b791935a2571468),
+     W(0x00000000a7e8cda7)},
+    0
+  },
+  {
+    {W(0xd7e6f2714ebf7726), W(0xb889ae8a2a78d14b), W(0x12b112ae24328ecb),
+     W(0x000000008694297e)},
+    {W(0x0a006c2de2393fd4), W(0xc5e1f23d67ff52de), W(0x3fb83e1316cc5f58),
+     W(0x000000005e39319f)},
+    0
+  },
+  {
+    {W(0x20e645c27098f0d8), W(0x9c7d5b0629a07fa9), W(0xd7d2b80c7841d217),
+     W(0x00000000aebad3d2)},
+    {W(0xdea24d38d8403e57), W(0x243cd5dad13d3605), W(0x46f4c2763c39210e),
+     W(0x00000000a41e4032)},
+    0
+  },
+  {
+    {W(0x273b2a633f6633da), W(0xb13817cf48717883), W(0xe9fdbc13d1daaaa2),
+     W(0x00000000bedae8a3)},
+    {W(0xa48fa6603f22615c), W(0x0c083f2c9206bf1f), W(0x3451c7ff69b9254a),
+     W(0x0000000099086913)},
+    0
+  },
+  {
+    {W(0x1b364c74824b6ff4), W(0xc1d7873a17fcfcc1), W(0xc07fe90dd612ff6e),
+     W(0x000000000ce80de1)},
+    {W(0x5c4bfef80b7edbe2), W(0xae3fdc0c611d4ea7), W(0x66fb965d1bffc729),
+     W(0x0000000018c0e7b4)},
+    0
+  },
+  {
+    {W(0x7106f175b702a7f5), W(0xe43f801270b2cc5f), W(0xf96466020c24f7a6),
+     W(0x0000000073c4dd5c)},
+    {W(0x9468642f468de5d5), W(0xb9c2619fdc4b1d6e), W(0x5291a34f34e78b66),
+     W(0x0000000072f5f5c2)},
+    0
+  },
+  {
+    {W(0x9530e2f5e9725452), W(0xa095fe2dd43465cc), W(0x80a8db74ac1954d4),
+     W(0x000000008b3f384e)},
+    {W(0xb0ab8b594a70a2b8), W(0x07a8fbca3384a8b5), W(0xade5d5009c545d69),
+     W(0x00000000e80972e7)},
+    0
+  },
+  {
+    {W(0x4fc2ef0278ff2f2f), W(0x00eb3eb8c4871b66), W(0xa1ddc42075c2230c),
+     W(0x00000000cf6d6812)},
+    {W(0xd09a8308e10f79f3), W(0x17cc6d8b8577cd81), W(0x733ae92d9d842ad3),
+     W(0x00000000a46a4be5)},
+    0
+  },
+  {
+    {W(0x53e46f577c4f32d4), W(0x7195d708ca5647d0), W(0x582ab3e627d82225),
+     W(0x000000001facc7ea)},
+    {W(0xf982dafba9c6fffb), W(0x678f5060bd2669fd), W(0xb86525d642c6aefe),
+     W(0x00000000afa1f6de)},
+    0
+  },
+  {
+    {W(0xc50d42a8d7c6495a), W(0x68d55c17f5d9313c), W(0xcef5897581f5aaa5),
+     W(0x00000000b253a1b9)},
+    {W(0x7ee2a58e3c7a0c55), W(0xc713e2c976b4b9b6), W(0x6ef497feaccce5ba),
+     W(0x000000007272964a)},
+    0
+  },
+  {
+    {W(0xcc566d4a71086891), W(0x47eb17fe21af5772), W(0xcb70e61dccc867f6),
+     W(0x00000000f72c967f)},
+    {W(0xb34fac3e646290c6), W(0x8782d4e4fd63970e), W(0x798033f388818f1a),
+     W(0x00000000e9e938c6)},
+    0
+  },
+  {
+    {W(0x33c5340c137429f6), W(0xd677e6a3fe6257b6), W(0x721ad0c4fcaa48af),
+     W(0x000000000e365c54)},
+    {W(0x54720bc94e65ed25), W(0x76a77f59c65a68c7), W(0x70cec0f2a93f37c5),
+     W(0x0000000011a496f9)},
+    0
+  },
+  {
+    {W(0xd281d4745ab02494), W(0x0b22521895e96c2b), W(0x446e46a50a7c2b03),
+     W(0x0000000005e94cd2)},
+    {W(0x38d32853ebd347fc), W(0x4a4e7c79b03bb05a), W(0x92a92d7643a1f0ce),
+     W(0x0000000018a2a7f7)},
+    0
+  },
+  {
+    {W(0xb866d6b3ffec6852), W(0x92786dba2181fbc0), W(0x97fb398df0f2d20e),
+     W(0x0000000077cc3ba5)},
+    {W(0x7b6b9cccbd647f5e), W(0xd873b69c81809842), W(0xb88d227bad9d4e54),
+     W(0x0000000078a4b3f0)},
+    0
+  },
+  {
+    {W(0x871071915e498b4c), W(0x927eb126e7310b39), W(0x68f36b032dd0806e),
+     W(0x000000004a5ee166)},
+    {W(0x0c5b31bd0d655787), W(0x35eb95edabcf98ec), W(0x10e889e23d768c7f),
+     W(0x0000000095397038)},
+    0
+  },
+  {
+    {W(0xf14e406e61ae53b4), W(0x82f1efc21e365689), W(0xf3370c27ccac364f),
+     W(0x000000005bbbb7ef)},
+    {W(0x61a54eee23c8eb92), W(0x102a00fd2aeb2904), W(0x1a119b39f58f4994),
+     W(0x0000000035352f02)},
+    0
+  },
+  {
+    {W(0xbfe549fecddfb6de), W(0x4218d77bd56005f9), W(0x4fe34f0bb7324828),
+     W(0x000000006f3c573b)},
+    {W(0xbe8123c3033ee2af), W(0xe7a9215f49d84fa0), W(0x837d142611a66c51),
+     W(0x00000000186d4cb7)},
+    0
+  },
+  {
+    {W(0x553a23ff528141ed), W(0xcdeb69905709e7fa), W(0x21639fddbe6da3ff),
+     W(0x00000000617d6db8)},
+    {W(0xdb94ccca59cc72ad), W(0x500f4f4aee6d4b12), W(0x16d0c05f4f418dc7),
+     W(0x00000000fd1f11d1)},
+    0
+  },
+  {
+    {W(0x6d822df4611f30bb), W(0x642b370318135eb7), W(0x89ce322e939d2172),
+     W(0x0000000054e707f5)},
+    {W(0x125d9b13acb98e2f), W(0x18372b6090f4b367), W(0x904e4318db54dfe0),
+     W(0x000000000a4ac724)},
+    0
+  },
+  {
+    {W(0xa2756cba6153a9d1), W(0xf5e95e744a76284c), W(0x8d896958fa184ae1),
+     W(0x0000000027b8642f)},
+    {W(0xcee0ac1682dce3b4), W(0x784153ae5bb3b2a6), W(0x57499a0352a3be40),
+     W(0x00000000cd2b1bf2)},
+    0
+  },
+  {
+    {W(0x72eff6cd31e45fb8), W(0x3c5160fcfe192595), W(0xb645f926133c8171),
+     W(0x000000005a668384)},
+    {W(0x88c856db0dc757bf), W(0x9f1d99900a396ee6), W(0xd5ca35b1603d2b5a),
+     W(0x000000000a86b564)},
+    0
+  },
+  {
+    {W(0x9b5dc5612d68c19c), W(0x610185c4c7c22f77), W(0x8ea3bcd9b8775c8c),
+     W(0x0000000007194ffe)},
+    {W(0x82ad3bc5a1d97600), W(0xe28c293ce3bb03ba), W(0x28a3b5ece82c59c3),
+     W(0x0000000077301eb2)},
+    0
+  },
+  {
+    {W(0xbf499b8dd414185f), W(0xce76d42c2e694b2e), W(0x209a5b958a757d87),
+     W(0x00000000db13f87e)},
+    {W(0x8752e0285b97c282), W(0x34e5836e66b92ac3), W(0xb5ebb1f86e28cf0d),
+     W(0x00000000a87bca9d)},
+    0
+  },
+  {
+    {W(0x21296181b72403db), W(0xe8eb39f85030de91), W(0x71f93f8a25b7a107),
+     W(0x000000008c3aa012)},
+    {W(0x130f7f0ece8271cb), W(0x348e4bb2a5c95748), W(0x39621a6118d3fd68),
+     W(0x00000000e998fca3)},
+    0
+  },
+  {
+    {W(0x3d40bd4693fd0cb3), W(0x0a651543e7a2f5f8), W(0x56214385c8386631),
+     W(0x0000000093858c3a)},
+    {W(0xf92b93e95ce49e3d), W(0x552805270d3d28a5), W(0xb4d91dbdb510b66d),
+     W(0x000000004edeaee8)},
+    0
+  },
+  {
+    {W(0xbda9cd3a296d342f), W(0x89eaf6d3c839a06f), W(0xebca1ae453d2ed89),
+     W(0x00000000b9603287)},
+    {W(0x95e8e1386be9770b), W(0xcdb0ff3fa1cfd60c), W(0xd967bde320108b39),
+     W(0x000000000e9333aa)},
+    0
+  },
+  {
+    {W(0x5fa92b012619794b), W(0x18bc16fe702c1fb4), W(0xd523a491c98ca674),
+     W(0x00000000f4e94140)},
+    {W(0x56e3a37cf2663662), W(0xe20edcdec343ca6b), W(0x6a60779d8bfc8317),
+     W(0x00000000ca51d3aa)},
+    0
+  },
+  {
+    {W(0x1940bf505080f2db), W(0x56cd105fe486b5be), W(0x196de19950c30bc2),
+     W(0x00000000f7c8d698)},
+    {W(0xfb9860b69aed5af7), W(0x5ddd9ce0fa0b7d85), W(0xa0e15d19e13d0e83),
+     W(0x00000000bdae4714)},
+    0
+  },
+  {
+    {W(0x2e530f214b1a54c9), W(0x602751da62d2bb30), W(0xae7805c24b95913d),
+     W(0x00000000ee970c64)},
+    {W(0x97f55bd267c0368e), W(0xf6632c39e6570940), W(0x447e80a85b0ddcb8),
+     W(0x00000000d184f240)},
+    0
+  },
+  {
+    {W(0xe13709193e5c96f4), W(0x557048ab3d1dc31d), W(0xa73f2281a1a96009),
+     W(0x00000000d8a4d0fc)},
+    {W(0x3d32d82e1407a679), W(0x19ae25d8ab48a2b7), W(0x902dd38d45e9cc7d),
+     W(0x000000009d9909e8)},
+    0
+  },
+  {
+    {W(0xb02223e718b53d44), W(0xa6f7a7fec3eaeb1a), W(0xb4c87a3a58af6956),
+     W(0x00000000ae15c092)},
+    {W(0x8521a9905df46b3e), W(0x3569ff8da92c3b43), W(0x8eb3620945ac6f7e),
+     W(0x00000000353c022d)},
+    0
+  },
+  {
+    {W(0x491b17226945e1d5), W(0xe9033f80e0730b7b), W(0x18ebd6640df9ea6e),
+     W(0x000000008cdb37b3)},
+    {W(0x7b74089edc425b0d), W(0xa6285adef723c24f), W(0x632d4f57444f81d6),
+     W(0x00000000e657d563)},
+    0
+  },
+  {
+    {W(0xde0dabf278f877fd), W(0x61f544f5248d4d20), W(0xb459c3eb096d946e),
+     W(0x00000000bdab8d24)},
+    {W(0x10ec7157cb77df90), W(0x399400886664b857), W(0x5d7afdca4a26e287),
+     W(0x00000000625d2558)},
+    0
+  },
+  {
+    {W(0x38d7b38914bf14f9), W(0x796411f8d093fa5f), W(0xe2fca83376b9c256),
+     W(0x0000000086363ff0)},
+    {W(0x54f3923c71f7d75b), W(0xe0d0f22fcb07403b), W(0xa605c37328f50073),
+     W(0x0000000012820fbc)},
+    0
+  },
+  {
+    {W(0xd1bdbfc27044f028), W(0x7765c182d30c82c4), W(0xe38121a066d3e78b),
+     W(0x00000000e5903373)},
+    {W(0x94fe4b05faa391eb), W(0x2245df512e97a651), W(0x92b706b6dcc57eea),
+     W(0x0000000096098e2d)},
+    0
+  },
+  {
+    {W(0xb6a682d1e67d49a7), W(0xf85af79eeecb6905), W(0xc8939f87bf8526ea),
+     W(0x000000008c6cd4d9)},
+    {W(0xcdad1c7823baff90), W(0x6521497b68fdbbd4), W(0x772b11c2755b573d),
+     W(0x00000000afff05be)},
+    0
+  },
+  {
+    {W(0x010f6940b64c8655), W(0x59c451156840a739), W(0x855f1caff2738cb1),
+     W(0x0000000041e8efa9)},
+    {W(0xfd8a80277ffca5d8), W(0xb964411d4e51f952), W(0x187620d903eab769),
+     W(0x0000000025493172)},
+    0
+  },
+  {
+    {W(0x8b6b3a88be0cb8fe), W(0xd09ba34200ab9701), W(0xf6d2043194b1f7a1),
+     W(0x0000000037552ee0)},
+    {W(0x8a59f496268ad104), W(0x3115b3dc7b570472), W(0x7d927d3c4348645a),
+     W(0x00000000c36fda79)},
+    0
+  },
+  {
+    {W(0x5d8963245bfcc374), W(0xc157e0aa8a21ef11), W(0xd1fe19582ed503e9),
+     W(0x0000000004f78801)},
+    {W(0x42950e121c218728), W(0x42b8a1b46e12117d), W(0x5676b8349630b7c0),
+     W(0x00000000a2dd9f33)},
+    0
+  },
+  {
+    {W(0x854e7746b7988528), W(0xdf3d5140168f9ca3), W(0x8deb982cec9b620e),
+     W(0x00000000c6dc6589)},
+    {W(0x4a2527b91d0bc48c), W(0x4a919340148f5244), W(0xcd39824ffe9d0133),
+     W(0x000000007e5841ef)},
+    0
+  },
+  {
+    {W(0xced08cb8e6094923), W(0xfe2c7e1cf8a7fc07), W(0xe284e288087bd7c0),
+     W(0x000000000e24bace)},
+    {W(0x612f34a92c2d89d4), W(0x8cf5e001d16ff602), W(0xda69a54ac186f54c),
+     W(0x000000001ec18787)},
+    0
+  },
+  {
+    {W(0x9348a02e2c6966a9), W(0xa036e1c2dd457fc2), W(0x07ad151bcbb808c6),
+     W(0x000000005573c312)},
+    {W(0x7778b344e7943472), W(0xf2870d275fb5dc69), W(0x24906b44efc6c101),
+     W(0x000000007cf84adb)},
+    0
+  },
+  {
+    {W(0x3b9c7a0a67b07396), W(0x36d72d01dfef4180), W(0x589d42da8e65514c),
+     W(0x00000000274d60f8)},
+    {W(0x2b16ea11330deec2), W(0x37c185325224a54b), W(0x1c36c825c9cff944),
+     W(0x00000000c243ec22)},
+    0
+  },
+  {
+    {W(0x479c4ee2e244ce26), W(0xa91bfb42409dd475), W(0x31aa9ae2b1e35cff),
+     W(0x00000000d0216965)},
+    {W(0xbba4a5c9cb1784f1), W(0xe0d74657073f0445), W(0x99b0d7476f2caa1f),
+     W(0x0000000049fbb11a)},
+    0
+  },
+  {
+    {W(0x2f440361ae73f5ec), W(0xb59cd6bec503bd02), W(0x72df8ad969f7f93c),
+     W(0x00000000f8696082)},
+    {W(0x47a9554d90e34516), W(0x3155511421264bd9), W(0xcabeb39fc780573a),
+     W(0x00000000be0f9f77)},
+    0
+  },
+  {
+    {W(0xc3f74a2f54a41938), W(0x675f9ee72fb798af), W(0x1be9c70e36c0a978),
+     W(0x00000000a73c3480)},
+    {W(0x4b2d56a17298f146), W(0x04d309dc71e0416e), W(0xb93791a43540430f),
+     W(0x000000004df265a5)},
+    0
+  },
+  {
+    {W(0xc43b05ec4dde4608), W(0xf26d43caca4a585c), W(0xee43971164020e11),
+     W(0x00000000e8c04422)},
+    {W(0x87746043848fc3df), W(0xe932850e6af87b9b), W(0x9a74bfcaaf401b56),
+     W(0x00000000eaad70af)},
+    0
+  },
+  {
+    {W(0x4bedc78e719f5e5f), W(0xad22c3cb86937acd), W(0xc54fdce1a5ddeb51),
+     W(0x000000007e3fddd0)},
+    {W(0x8b1bd3c7f8e6a006), W(0xea877c2fbacd88f5), W(0x334f23933421dcef),
+     W(0x000000002533ffab)},
+    0
+  },
+  {
+    {W(0x1d9ed778d30020dc), W(0xa1f2101326ec68b7), W(0x17a2cc927b9104f6),
+     W(0x00000000cea2c10b)},
+    {W(0xe4111ffa1de61dac), W(0x929789d6a61d6d45), W(0xe758bc32e57efb4a),
+     W(0x00000000fb3e2b53)},
+    0
+  },
+  {
+    {W(0x15fa1da62f5065b7), W(0xdf983dc2bba7f1ad), W(0x610c979f9c4dcd45),
+     W(0x00000000f646c148)},
+    {W(0xd8cd1ea6d50ee9c0), W(0x6de8a6ca235465c3), W(0xe9f429246cdf4c71),
+     W(0x0000000037972c47)},
+    0
+  },
+  {
+    {W(0xc2ff85c37eaa6fe0), W(0xf6d86a0ea3bd4a9d), W(0xcb71556c813f1c3a),
+     W(0x00000000fac0cb6f)},
+    {W(0x118a5a22cd3192ed), W(0x0b1c8df7c9184a6e), W(0x8a8f1e1db016ea23),
+     W(0x00000000980cc9ca)},
+    0
+  },
+  {
+    {W(0x30927e4ceef7a1c4), W(0xecc382c204ea6c46), W(0x58ce3cbf32f10a3e),
+     W(0x000000007a8c0f8c)},
+    {W(0xc281013a30a3a7b7), W(0x778ea90fb092710c), W(0x6314767980c59378),
+     W(0x000000005fba4ac8)},
+    0
+  },
+  {
+    {W(0x1ff5dfe8c1820226), W(0x96bbdc9848d384c0), W(0xe2264db09b38de2c),
+     W(0x00000000f0cdec5d)},
+    {W(0x1a3d852f4d1e4a3a), W(0x4550234e998f18df), W(0x1bede5098aaa5d77),
+     W(0x000000002380dadd)},
+    0
+  },
+  {
+    {W(0x5221592394727405), W(0x443cf5ce8cc56a59), W(0xa16bd6ebe483cbae),
+     W(0x000000000782362a)},
+    {W(0xd7710104ccbd90ca), W(0xfb04f503188eacb4), W(0x62422a11e46b83e9),
+     W(0x0000000003b0558f)},
+    0
+  },
+  {
+    {W(0x1a8709015073c0dd), W(0xff0e102c54830809), W(0xeb455a29a453c1f3),
+     W(0x000000006d67a224)},
+    {W(0x836641d412d5faf0), W(0xda75aaede2a72467), W(0xaca3e5c1b0d95870),
+     W(0x00000000b3ca21d5)},
+    0
+  },
+  {
+    {W(0x9f4458f8a80ccefb), W(0x0ef1294391300fbb), W(0x423b4f8f38cc82bd),
+     W(0x00000000f88635a0)},
+    {W(0x839f6bace8765f41), W(0x60b5d6bebc160c6a), W(0xa28701616b2e9bc8),
+     W(0x000000000c2323ff)},
+    0
+  },
+  {
+    {W(0xb4253138429c8539), W(0x428ace3c674b8126), W(0xa942966b51fdc8f6),
+     W(0x0000000048b12d5d)},
+    {W(0x344f306e897f4acb), W(0xc21d64c58ba35ebd), W(0x67719318c7a1a049),
+     W(0x0000000065a39fa1)},
+    0
+  },
+  {
+    {W(0x3d3f4c18b4f23fc9), W(0x061555bc654bc5ad), W(0x75473a745c891aad),
+     W(0x00000000af2ff8ca)},
+    {W(0xb340387bd5748a74), W(0x42269d035d800616), W(0x0e92ef717aac59ac),
+     W(0x000000001e25ee85)},
+    0
+  },
+  {
+    {W(0x76be6d4bfaaeefc5), W(0x1fcf5a1664f82f9b), W(0x96af55fd90549105),
+     W(0x00000000951c7c70)},
+    {W(0x5927ef40baeb05c9), W(0x987d7a9524880b0c), W(0x02d2a08d7f7d2c47),
+     W(0x0000000009add7e6)},
+    0
+  },
+  {
+    {W(0x7d836b65015495ef), W(0x58d1e7e7d51b7432), W(0x9bb5abf2eed478b5),
+     W(0x00000000d772fce7)},
+    {W(0x3d838f25e2864216), W(0x53560f675ac31cee), W(0x8b21fecc7453088c),
+     W(0x0000000094dcc9eb)},
+    0
+  },
+  {
+    {W(0x6d859d720c2161d5), W(0xd23e83cd63e23212), W(0x54da7908582172d1),
+     W(0x000000006b2240d8)},
+    {W(0x5e77eedb3d4dbd1c), W(0x03c70aedb81b156d), W(0xd5addf542fc7276a),
+     W(0x00000000a4c00c98)},
+    0
+  },
+  {
+    {W(0x60eae4e78ac20c1c), W(0x43b09df8c62af348), W(0x39498a9a6b05032d),
+     W(0x0000000053326abc)},
+    {W(0xc2206575c27ec4a3), W(0x926d7768193d086c), W(0xb1fbbfa5d5a10ffc),
+     W(0x000000003e701eac)},
+    0
+  },
+  {
+    {W(0xff8aa8125e0b62e4), W(0x53b3f27bd340950f), W(0x77a2e169aa94efa0),
+     W(0x000000007c6c7b5a)},
+    {W(0xa873c8f3ba30cd54), W(0x3ac476dc0e55079e), W(0x755566ab1cd70ef6),
+     W(0x00000000cd90eaf5)},
+    0
+  },
+  {
+    {W(0xf5359d026abcb9d2), W(0x8cf208a5df9d1076), W(0x78a83947aeaf3bb8),
+     W(0x00000000223dc1b5)},
+    {W(0xb556335f01a42402), W(0x248a2677679fb067), W(0xa602015a73fc43e3),
+     W(0x0000000016cc18bc)},
+    0
+  },
+  {
+    {W(0xee63df59a6414ac3), W(0x52d4d9838fffa553), W(0xce2bf7257b3fb585),
+     W(0x000000001e9f8def)},
+    {W(0x307f2e661fa42203), W(0xdf73687199a460ab), W(0x6c0e35ab0ca8336d),
+     W(0x000000001e73175f)},
+    0
+  },
+  {
+    {W(0x599d75fef84558b9), W(0x5425a8dbc5c2d3ad), W(0x5c7a14781e7c6189),
+     W(0x00000000fb60c8a3)},
+    {W(0x18bb4e0bf54041c6), W(0xaa3b9ffd408cd3cd), W(0x5699925d35a23539),
+     W(0x000000008876378a)},
+    0
+  },
+  {
+    {W(0xfed7a67463022c94), W(0xda31ce12cba968a8), W(0x9d1299c6b34663b6),
+     W(0x000000002ed30529)},
+    {W(0x15a3d031677601ca), W(0x9fd0db3fd65355c8), W(0xb7d3086cc351934a),
+     W(0x000000009b31fff1)},
+    0
+  },
+  {
+    {W(0xbf3a3bd52dfef761), W(0x7955679763e2855d), W(0xa11503326dc7286c),
+     W(0x00000000704e27d1)},
+    {W(0x0ef7a04fd633222e), W(0x15ed4e765c4e8fe0), W(0xf17cccc72e308425),
+     W(0x00000000d905b22f)},
+    0
+  },
+  {
+    {W(0x604c4809b012e342), W(0xfe688ffd1b6f0a04), W(0x249d31f7b35c3488),
+     W(0x00000000e7d82947)},
+    {W(0xd11bae089c86e886), W(0x91f53f5efdea9aa2), W(0x5c0d6a2fed784c11),
+     W(0x00000000eb7eaa59)},
+    0
+  },
+  {
+    {W(0xdfb763943996e0a0), W(0xaa1f0765918bf212), W(0x1c19d22de4380247),
+     W(0x00000000cbaaa493)},
+    {W(0xee8789b1044038ec), W(0x64b45501fc779004), W(0x1727e2c05bf9059e),
+     W(0x000000002ec36e71)},
+    0
+  },
+  {
+    {W(0xfb9924910fddcc51), W(0xe65327e620c9f15b), W(0x3455d964fa3220bd),
+     W(0x00000000031400db)},
+    {W(0xd4952a00f818c65d), W(0x33165c377a413284), W(0x8913431396d2d797),
+     W(0x00000000aceb66cf)},
+    0
+  },
+  {
+    {W(0xed353afc8dbd34ab), W(0x1d2cfdeb96f07281), W(0x2faee022578c5e27),
+     W(0x000000000b67170a)},
+    {W(0xd20def28f7e0600a), W(0x3da49c506b6d6a43), W(0x338c8160bbb8b54e),
+     W(0x00000000c04fc79f)},
+    0
+  },
+  {
+    {W(0x4c85a44fbcc88d24), W(0x652815ab616324a9), W(0xf487498726be4e8f),
+     W(0x000000001ec95fc9)},
+    {W(0xf360dd452661d2f4), W(0x00a30b9766e0e715), W(0x3f38cdaa47a805b0),
+     W(0x00000000f4f92123)},
+    0
+  },
+  {
+    {W(0x11dc96d7f3561fd4), W(0xf40e7fff4bfad45e), W(0x3f5e646f64161736),
+     W(0x0000000069fae30e)},
+    {W(0x94de6e9bd62a961a), W(0x225bb7d53ef85e47), W(0x8a00406bc914891d),
+     W(0x00000000ecb259e8)},
+    0
+  },
+  {
+    {W(0xb6153ab34605f3ba), W(0x4ff3fdcb4cce1ced), W(0x814abbe4ef4c69f8),
+     W(0x0000000060dd0180)},
+    {W(0xef40a389a8d4402c), W(0x7366436b327e3a32), W(0x63d0cb8e0bc76ec4),
+     W(0x000000001aeeb2e1)},
+    0
+  },
+  {
+    {W(0xddcb642163cbf363), W(0xf57b44f1accf144b), W(0xcae409dc1362cde9),
+     W(0x00000000a8162ccc)},
+    {W(0x0066d5c73eaab06d), W(0xa9024d126934e28c), W(0xe0a734255527347b),
+     W(0x000000001b0fecbc)},
+    0
+  },
+  {
+    {W(0x401e35e158eb225b), W(0x8471783a35624910), W(0x8f6b20c479998254),
+     W(0x00000000edcba06d)},
+    {W(0xc6e9fb59397eddfb), W(0x4406c410838fd9cf), W(0x756c8993af0e31ce),
+     W(0x0000000092c5f09a)},
+    0
+  },
+  {
+    {W(0xa5306a1d158e446b), W(0xb990504d6f5bcb3d), W(0x9994e7569078b672),
+     W(0x000000009f287219)},
+    {W(0xc1d74970243e8ff8), W(0x2daec49fe6210f9c), W(0x1d4a8dda0d9f6244),
+     W(0x000000003aab115c)},
+    0
+  },
+  {
+    {W(0x5c270570bd6048c3), W(0x6ccb5d11b4b50b0f), W(0xba310504bdaad6a0),
+     W(0x0000000092702c9d)},
+    {W(0x46d2de542f44e061), W(0xf221256122c84360), W(0x1f0573bb1c0fef2b),
+     W(0x0000000032c59a8c)},
+    0
+  },
+  {
+    {W(0xcd30326b39f49f48), W(0x85e220c35b0b82ac), W(0x17f5fa769e8bdc41),
+     W(0x0000000082c4a2d7)},
+    {W(0xeb19262fb6b64bd4), W(0xc5e437e4fd86e31c), W(0xe7bd555b7bbfdc98),
+     W(0x00000000d7cd64d2)},
+    0
+  },
+  {
+    {W(0x12dde95771b7e968), W(0x49e19f93c3d8c87a), W(0xca056fceda05b1bb),
+     W(0x0000000000eefc7b)},
+    {W(0xe55bd7cafe4097b1), W(0x7f597d0bf18e1363), W(0x8dcac511619dec1b),
+     W(0x00000000a4477bea)},
+    0
+  },
+  {
+    {W(0xf7cdb43c39db88d3), W(0x6ee028658ab07c1b), W(0x2412665162bdd10c),
+     W(0x00000000b5f0e3c8)},
+    {W(0xe079ce93bc04d8a0), W(0x5312a89fcb599601), W(0xbc666431f443b857),
+     W(0x0000000094ae6f77)},
+    0
+  },
+  {
+    {W(0xc5d123280e12964d), W(0x8a570138e5a04f61), W(0x8fb8c37aaaf18692),
+     W(0x000000000a7fd4ce)},
+    {W(0x4bc4f21861e5296b), W(0xd507553aa809deeb), W(0x41c54fb57f3e106e),
+     W(0x00000000b3620e1b)},
+    0
+  },
+  {
+    {W(0x97269a4e6f6626bf), W(0x27523c705c9876b5), W(0xb9fa54cb3dbb0757),
+     W(0x000000003227ab4e)},
+    {W(0x382efb3ce1d04dee), W(0xbbc3330295a8e217), W(0xd149c0d7e07fc4f2),
+     W(0x0000000090c2e230)},
+    0
+  },
+  {
+    {W(0xa73aa49f997a3c07), W(0x5fc8d41f80e80933), W(0x7a12ce43df774b76),
+     W(0x00000000141c2eb5)},
+    {W(0x5f5ecb46038270d3), W(0x9c9ac312be70b7f0), W(0x974b973d99a8c088),
+     W(0x000000001fee274e)},
+    0
+  },
+  {
+    {W(0xb533906466aff31c), W(0x0e4f2e8c309a95b0), W(0xbd8420f6a5ebd0f7),
+     W(0x0000000023d76141)},
+    {W(0xd0f7a2fc4c61700c), W(0x6ca0e6c6eb4a929a), W(0x30a5c864e58a7044),
+     W(0x00000000e57e135a)},
+    0
+  },
+  {
+    {W(0xf10c4bcad3f7526d), W(0x8adf6b95e1b44312), W(0x7d787012a492871e),
+     W(0x0000000017996276)},
+    {W(0xcdb602e14ed584a9), W(0x12fdbbbc71f71019), W(0x4f687c490475dc0e),
+     W(0x00000000b3feb153)},
+    0
+  },
+  {
+    {W(0xb8c4c7fc907daafb), W(0x001f2403cba6cfd9), W(0xf95a9b14a1bb12f6),
+     W(0x0000000034f3e415)},
+    {W(0x8af5b76ef31c5de9), W(0xfd0dbfb50bc98005), W(0x1febfe612653d982),
+     W(0x0000000033c67aaa)},
+    0
+  },
+  {
+    {W(0xa37f61a24d2af6d0), W(0x70c183d5b3f01cda), W(0x4768424f68be6691),
+     W(0x000000007d1814e2)},
+    {W(0x9395d262bd6f4c31), W(0x39c2afab8b0afc13), W(0x6f0c590edad2baed),
+     W(0x000000005c872195)},
+    0
+  },
+  {
+    {W(0xf0077346f7093eb2), W(0x54f551892d1638b3), W(0xd3e392ad67cb5fea),
+     W(0x0000000016db9248)},
+    {W(0x524a72fe5940e811), W(0xac51d5c248171bc2), W(0x98ff6cd86d5f4fed),
+     W(0x0000000076aea162)},
+    0
+  },
+  {
+    {W(0x7614816a793c8b5c), W(0xac784734e5bc13ec), W(0x73e2d5d8cdd32062),
+     W(0x000000002ca36b1e)},
+    {W(0x65d9b042ac81efc5), W(0x2ebf73e2644778db), W(0x4516190f0fdce986),
+     W(0x000000003a92e440)},
+    0
+  },
+  {
+    {W(0x976b4274acf3d09c), W(0x3284d74e4f34bb2e), W(0x4bfb5caf0f7c4887),
+     W(0x00000000069359f1)},
+    {W(0xca5f12812dba5f32), W(0xf2c75715e9d65240), W(0x8971ce826073b408),
+     W(0x000000005eb6d791)},
+    0
+  },
+  {
+    {W(0xae1543fca398be14), W(0x18bd8c253fc11924), W(0xc585ef804a35e821),
+     W(0x00000000bdb459c8)},
+    {W(0x0c9537d19c6aacde), W(0xe7a3ad1a25c5c66f), W(0xf6dfc439f851d2e1),
+     W(0x00000000b4279e3e)},
+    0
+  },
+  {
+    {W(0x58b72c58f8b65b13), W(0x7e570fbca062e750), W(0x7255eeec175c459b),
+     W(0x0000000069620506)},
+    {W(0xd7a85b729e3cc178), W(0x9b4ad4af3ddbc01c), W(0xf043a2ccdad654b0),
+     W(0x00000000b5155e36)},
+    0
+  },
+  {
+    {W(0xcdb1f5911ee7e102), W(0xc90d43308a35eb3a), W(0xc9698ad38c9cc83e),
+     W(0x0000000042b2769b)},
+    {W(0xbe5db4b2f721c4fe), W(0xb5fd5dd460bc94a8), W(0x63629f1b84a952be),
+     W(0x00000000b35aa048)},
+    0
+  },
+  {
+    {W(0xb6917763e54cca98), W(0xa3f4d570494d50dc), W(0x8c6e10bef52e21f7),
+     W(0x0000000051e4691d)},
+    {W(0x28f318b1e1771815), W(0x852aa69f36b7a547), W(0xfcb92412123e0dad),
+     W(0x00000000047d0c37)},
+    0
+  },
+  {
+    {W(0xdb4abf92e4004a8a), W(0xc6447985ef60ae5c), W(0x8c7a4a1751c6f399),
+     W(0x00000000c4bec3e6)},
+    {W(0xc8026fc4b90ba1ad), W(0xce1d3867949b7360), W(0x065ec90257bf5766),
+     W(0x000000003a2c281f)},
+    0
+  },
+  {
+    {W(0x7d7f2dc824ad0cf7), W(0xec7848505720e382), W(0xf8c5610077baf182),
+     W(0x000000003ffb09fd)},
+    {W(0xae2bc67bf2d737ec), W(0x02482dea0a4ea31d), W(0x54082dc9ba7849fe),
+     W(0x000000002e3f6a12)},
+    0
+  },
+  {
+    {W(0x108fbea756da5beb), W(0x50a833085bb662f8), W(0xf6a563a3f1b9bae4),
+     W(0x000000005ebde3e0)},
+    {W(0x838413f61162288f), W(0xc6264dbb47fe5a17), W(0x474fb6fff39ee8b6),
+     W(0x00000000cfd1cd51)},
+    0
+  },
+  {
+    {W(0x2f4689947715222e), W(0xe5317f51545a8ba2), W(0xa6335097a4d6c593),
+     W(0x00000000ca0e7ce7)},
+    {W(0x0d2264137b87c2b5), W(0x832e247d45288f02), W(0x9437de6b7f6c98c5),
+     W(0x00000000ada632a1)},
+    0
+  },
+  {
+    {W(0x38ac961ca24c1ee2), W(0x3b6283f3104a04b7), W(0xc84b3ce839c35a41),
+     W(0x0000000027487d3d)},
+    {W(0x6dc365b4c5568158), W(0x73e53701abdb966e), W(0xfbc7eb6373462d12),
+     W(0x00000000245a46ac)},
+    0
+  },
+  {
+    {W(0x3842fe12c3ddcb1a), W(0x4ed3d9e63e135347), W(0xd2fbfa40988b427c),
+     W(0x000000009cade24b)},
+    {W(0x3c780f3eac2a872a), W(0xee31d4f948ce177d), W(0x95ff0c82806af5c0),
+     W(0x00000000caf3ef9f)},
+    0
+  },
+  {
+    {W(0xe110b581360ebcc3), W(0x4a43fa3ce3afcdf2), W(0xd1c7a871e5e28b8d),
+     W(0x00000000021937db)},
+    {W(0x96357dd88a092413), W(0xe26e9bb6fb7f7cc4), W(0x75adf0ac7246efd2),
+     W(0x000000005f15bfce)},
+    0
+  },
+  {
+    {W(0x062cc3c3d6b3312f), W(0x28151a53d139759a), W(0xf8022f5a05720897),
+     W(0x000000004a41dac3)},
+    {W(0x2e7b1b52d616426e), W(0xabe1001fbf79f82f), W(0x91c6fe4da2a251b4),
+     W(0x000000009f2c9791)},
+    0
+  },
+  {
+    {W(0xe033c48b737e5ed7), W(0xf098ebd9a6be84d8), W(0x3b8b579664920c87),
+     W(0x00000000a60aa783)},
+    {W(0xe7e4fda1dee9aada), W(0x9d7ffe0ba6d65060), W(0x5ecedca9f84c9976),
+     W(0x00000000c97328fb)},
+    0
+  },
+  {
+    {W(0xcc7c118db28e3848), W(0xc831a172c2aa0b6b), W(0x831893615c69835c),
+     W(0x000000001087e465)},
+    {W(0x6dde09cc46517d1a), W(0xf6effdc05b06b59f), W(0x14a45dfd52af2f70),
+     W(0x00000000c5bdd4e2)},
+    0
+  },
+  {
+    {W(0x40cf4940a8260b73), W(0x983a11513a7f4fe0), W(0x82875afebf2cdbb3),
+     W(0x000000004d117f9c)},
+    {W(0x27fe166bef9bd860), W(0xc6279fd2cb37727b), W(0xe34fc1556d0fcc48),
+     W(0x0000000078dfed14)},
+    0
+  },
+  {
+    {W(0x174c2260e3198460), W(0x292647f023c38e69), W(0x7ad803c4feeb6dd0),
+     W(0x00000000411e4442)},
+    {W(0x8bb2e83ba3dda9d0), W(0x6165ab24c48e2ba5), W(0xdc8704c2222c7a63),
+     W(0x00000000d2a81a10)},
+    0
+  },
+  {
+    {W(0xbbb9f23e246f30ac), W(0x2e94ef976df3a396), W(0x8066d7d1772fd251),
+     W(0x0000000084cf4e0d)},
+    {W(0xd149e3f84ea9d785), W(0xc14ae99d72030612), W(0xabf32cb2a7dd5c67),
+     W(0x00000000f4a271f6)},
+    0
+  },
+  {
+    {W(0x876e4a569a76a013), W(0xb558acf602302d3c), W(0x3ef2d8def95cc061),
+     W(0x000000007b81a032)},
+    {W(0xacf32a3163eb7bd1), W(0xe9aeb19336ebd51b), W(0xbd2cd5c6bc1e19a6),
+     W(0x00000000572295d8)},
+    0
+  },
+  {
+    {W(0x264f76867a0454bb), W(0x55ef8b775dce5ee9), W(0x9893e66d525e885f),
+     W(0x00000000e9e38e0e)},
+    {W(0xd1469b94eca3cba7), W(0xcea5de110b1bbe2d), W(0x12318563fc79e81b),
+     W(0x00000000f9272fb2)},
+    0
+  },
+  {
+    {W(0x828a3b3c01a6b6e4), W(0xb4a35c8ecead6fe6), W(0xe5642a2b44f77ef4),
+     W(0x000000001a2b54ad)},
+    {W(0x35727ea985389260), W(0xd34ac21acccb56bd), W(0x67382a84fbf334fc),
+     W(0x00000000b88f40a8)},
+    0
+  },
+  {
+    {W(0xdeaa7e506b882650), W(0x2b264e348e885bc5), W(0x9ee522a1a506cc9f),
+     W(0x000000008ee89d7b)},
+    {W(0xda96b1a837eca2c2), W(0xd4072c44c28eaea3), W(0x9d205a3460bf6553),
+     W(0x000000009e669706)},
+    0
+  },
+  {
+    {W(0x623107f41290899c), W(0x75d9e663151f00d0), W(0x304a6fe9b276d6d5),
+     W(0x0000000025129f53)},
+    {W(0x660af27d08a44081), W(0x091249e91127454f), W(0x3df3fcc0d1f2f799),
+     W(0x0000000046132a5c)},
+    0
+  },
+  {
+    {W(0xd7cfc8e1029dc834), W(0x6123bd3e7715db11), W(0x88f3b5a5d4a222e1),
+     W(0x00000000a87debac)},
+    {W(0x76eed4240c558052), W(0x7f4f71740cf61250), W(0x21b59f7c06a89823),
+     W(0x000000000e901d23)},
+    0
+  },
+  {
+    {W(0x840b2ad362c9a0f6), W(0x68516478ae4b2203), W(0xe48d486f16148eb2),
+     W(0x00000000791f9e93)},
+    {W(0xf99fc3725b01e30b), W(0x953ad98a6da8a5cf), W(0x266b72dd735b12f6),
+     W(0x00000000384778cd)},
+    0
+  },
+  {
+    {W(0xaec04d23b98cc623), W(0x80b7956823c529d8), W(0x67fa1d2e4bec5148),
+     W(0x00000000726d9d69)},
+    {W(0xd59f58ff397a6a58), W(0x4885cd7bff5daff3), W(0x97848bda28e69f6d),
+     W(0x000000002c9b0780)},
+    0
+  },
+  {
+    {W(0x9b8157bc1bf561dc), W(0x987a9ae4af33e6ba), W(0x0f872745f31675b6),
+     W(0x0000000063269d61)},
+    {W(0xf734e00541269ab7), W(0xab59149a622134c9), W(0x1f03e1cb5d265a80),
+     W(0x000000006b2e1bb4)},
+    0
+  },
+  {
+    {W(0x5cf45e0eea6212b3), W(0x006c739ec421cf93), W(0x771edd4d3051f788),
+     W(0x000000002fb7350b)},
+    {W(0xe915acf29e71ad44), W(0xab67d3d4d5e93cb8), W(0x634bcee30300c0ab),
+     W(0x0000000056544d27)},
+    0
+  },
+  {
+    {W(0x28033ab16bc22416), W(0x33c8afa29cb44f0b), W(0x78e16f92c83f6b5e),
+     W(0x0000000049bc2118)},
+    {W(0x43f15edbc6399173), W(0xcc7711cad15642e8), W(0x4cd61d562dcd7be0),
+     W(0x00000000000068ff)},
+    0
+  },
+  {
+    {W(0x28971fafc3941c77), W(0x8e92099856bf3bfa), W(0x7fb80baed3955384),
+     W(0x0000000005967050)},
+    {W(0xaec241f8206f9340), W(0x47808aa4c3d2702a), W(0xd96f7ce7d84a5865),
+     W(0x00000000e36faa15)},
+    0
+  },
+  {
+    {W(0x3f32028f86344cf3), W(0x5e1e243ea7fee5a0), W(0xaa94f9b883a3453b),
+     W(0x0000000001524b6d)},
+    {W(0x0b2165915875edae), W(0xeb54b9d9b8c8565d), W(0x824297ccd40fc599),
+     W(0x000000003efca579)},
+    0
+  },
+  {
+    {W(0x4eb3e8e6abf25452), W(0x9640b4a0db8a4b71), W(0x04f5503e81ca374e),
+     W(0x0000000070b75068)},
+    {W(0x5098d14549d51ab8), W(0x20ac8bfb07acdeaa), W(0xc7ef088f6689b17a),
+     W(0x00000000dcccbe44)},
+    0
+  },
+  {
+    {W(0xf23fd9d30cf5a056), W(0xce9e980348b45af1), W(0xd8a4f5da9501843b),
+     W(0x00000000c1a10b36)},
+    {W(0x67e1c527f7342d1f), W(0xd4650fbd35afe1e7), W(0x5d441ed72ed10053),
+     W(0x00000000ad46a387)},
+    0
+  },
+  {
+    {W(0x7806f68c1a005bc8), W(0xaec47928b9ff983a), W(0x2137e23be8fb0f60),
+     W(0x000000002e89d4e7)},
+    {W(0x84a95db250a55909), W(0x3739068c1e3064a9), W(0x8b79244390b7e4fc),
+     W(0x000000006ab7aba5)},
+    0
+  },
+  {
+    {W(0x701f8500d4a79d50), W(0x37d494d737419cb9), W(0x73d63acbcf2de001),
+     W(0x000000007088d953)},
+    {W(0x0ff218aadfc7b98d), W(0xf821d6169daca570), W(0x8e0ceb7ee3d63a0e),
+     W(0x00000000b9ed85d7)},
+    0
+  },
+  {
+    {W(0x2363fe57fe7d97f2), W(0x6864a2f7d5f307a4), W(0x0626f466ae7b7b76),
+     W(0x00000000a453d21b)},
+    {W(0xcdc9cbc7395df9ec), W(0x559bd65ef75838f3), W(0xc2ee6f19b568971d),
+     W(0x0000000038639987)},
+    0
+  },
+  {
+    {W(0x710021b03c5138ae), W(0xefc352d903594941), W(0x978855a13562853a),
+     W(0x00000000351baf92)},
+    {W(0xd967f5c5ca117d7b), W(0x05dfb44a3d296d89), W(0x3346f41a46ba695e),
+     W(0x00000000e4bb692e)},
+    0
+  },
+  {
+    {W(0x70cfd149a25ee85a), W(0x38846359bea95cc3), W(0xb8eb9f5d4a6be26b),
+     W(0x000000000aa51f66)},
+    {W(0x97429349336f4c00), W(0xc109a6101ceb172d), W(0x56e920c5b87a4cfd),
+     W(0x00000000ad5652c4)},
+    0
+  },
+  {
+    {W(0xeaac5343a039d1e0), W(0xed16196333483075), W(0xc59c00d1c775ee93),
+     W(0x000000007c5fc025)},
+    {W(0xa075d520f3a5706f), W(0xa152f41104a10db5), W(0x487ee5e05dc49508),
+     W(0x00000000c8496ee6)},
+    0
+  },
+  {
+    {W(0x8bf51ad43e94fb2d), W(0xd5712524b4b3d8c3), W(0x34aa523f67492952),
+     W(0x00000000f22882a0)},
+    {W(0x10aa8c5a58a3bd47), W(0x505f52dd2cf101fa), W(0xb72933bfc03daf52),
+     W(0x00000000daa4bf22)},
+    0
+  },
+  {
+    {W(0x47341027402b4b3a), W(0x25d8440a2be96976), W(0xaa3d3df9350e40ee),
+     W(0x0000000086059595)},
+    {W(0x7d612ec02409b26a), W(0xbf3fa517caf389cf), W(0x8f42ca2c7b9bbe7a),
+     W(0x000000009066b45a)},
+    0
+  },
+  {
+    {W(0x2a86455e7afe3581), W(0x6bea6afad70582ef), W(0x6134c21d6c7e5a00),
+     W(0x00000000970ef6b8)},
+    {W(0x154459b2541739d0), W(0xb42988511e7fd61b), W(0xd3952ab369c36e02),
+     W(0x000000009194898c)},
+    0
+  },
+  {
+    {W(0x48fe1961284790d9), W(0x2d55bce38c4dc2c6), W(0x67671d03e72e701a),
+     W(0x000000006e7e4617)},
+    {W(0x7e3723667ad814a8), W(0x784460f3e874bd80), W(0xe58e5c6c353599d3),
+     W(0x000000000ae15669)},
+    0
+  },
+  {
+    {W(0x31c22bb0b90d9c57), W(0x5366313b6682cd85), W(0xefb61bb768f62220),
+     W(0x000000002c7beb55)},
+    {W(0x755f78dc905f581d), W(0xafae75b7f46d48c5), W(0x35510e546ac7b625),
+     W(0x0000000092a179f5)},
+    0
+  },
+  {
+    {W(0x7dc571362549f74a), W(0x72891c73b49c88b9), W(0x639b833ccc8a6bb9),
+     W(0x000000003fb09479)},
+    {W(0xa2d49d5cf84b5cf9), W(0xadacaf96802b193f), W(0x9de61dfe099cff1f),
+     W(0x000000001121e706)},
+    0
+  },
+  {
+    {W(0x6968d941fd3d4e5e), W(0x038305e83fc49a6b), W(0x48078c01337a9330),
+     W(0x0000000009ecd1dd)},
+    {W(0xd40babe5e18c54da), W(0x93aeb07979750e81), W(0xde8a698907be4ede),
+     W(0x000000000783a1b4)},
+    0
+  },
+  {
+    {W(0x611b7b2cebb2f8a3), W(0x9e52c5ff6f115dea), W(0xcb0e65022c7b4ea9),
+     W(0x00000000eef612ef)},
+    {W(0x69271965ad2f5c52), W(0x5c603832ea9e0f47), W(0x8cf3d07895476322),
+     W(0x000000009d61e891)},
+    0
+  },
+  {
+    {W(0x15f588882f6dd29c), W(0x0a8f93b5719bbe70), W(0xb42d7d6e028d078b),
+     W(0x000000002f0f0841)},
+    {W(0x335c49e0163361a4), W(0xd0491706d456c500), W(0x34c3d58b86e3c202),
+     W(0x00000000dcc679d9)},
+    0
+  },
+  {
+    {W(0x147ddddb033e8805), W(0x4eba5af8e1f8b96b), W(0x1b904dba1ca7c198),
+     W(0x000000009321c104)},
+    {W(0x97f195a687bb6dc1), W(0xabb4c52e2f1e48d4), W(0x6f7865a2ae77898b),
+     W(0x000000009aea99cd)},
+    0
+  },
+  {
+    {W(0x8c00e6caae27be19), W(0xe84cfef47be0a2dd), W(0xfa39564080e74dd0),
+     W(0x00000000c71679d3)},
+    {W(0xe036145a25331088), W(0x973f05c401057e31), W(0x0172ce8b0f74ded3),
+     W(0x00000000503980f6)},
+    0
+  },
+  {
+    {W(0x1a71a46b86f8cc52), W(0x93b9ba0215c9da1f), W(0xd710cdb820911290),
+     W(0x000000001be57b4f)},
+    {W(0xb65102c861af16d2), W(0x7ad04ac34961ed09), W(0x41463667fe42096d),
+     W(0x00000000ce0d1179)},
+    0
+  },
+  {
+    {W(0xf88992f36cf14b22), W(0x326d876d661d2a59), W(0x05597f3c6168caa2),
+     W(0x000000006fd8099b)},
+    {W(0x2c0b00a536b65ec0), W(0x34173757c10d707b), W(0x544e89eeb88664a8),
+     W(0x0000000082c091c8)},
+    0
+  },
+  {
+    {W(0x49acd75f6e809008), W(0x68c0755322ce0224), W(0x7caec7526306cf98),
+     W(0x000000005d397492)},
+    {W(0xd67530e6a88e4155), W(0x5bf5bd58bead67d9), W(0x3b6c36fce4eb9842),
+     W(0x00000000241a0be5)},
+    0
+  },
+  {
+    {W(0x5f5896fad6b11c1e), W(0x1dd22a7d5988e0e5), W(0xa0c4958ef0824474),
+     W(0x00000000aa22b132)},
+    {W(0xc7968c6f0c729c88), W(0x227c515a89772b28), W(0xf0ccdf371b33f991),
+     W(0x00000000dfc5aa16)},
+    0
+  },
+  {
+    {W(0x5c1f6a99ed298765), W(0xff260292feddb63e), W(0x4b767e1f9992aa4f),
+     W(0x00000000d577c305)},
+    {W(0x55470c824e4e7e92), W(0x61860a041109a2d4), W(0x08cf2b47a220a9e1),
+     W(0x00000000b1871acb)},
+    0
+  },
+  {
+    {W(0x30608718581dd233), W(0xd5178c3193016bed), W(0xb854bcee52e4ca29),
+     W(0x0000000049a645ef)},
+    {W(0xa0003746af441544), W(0xfca615e3793c163d), W(0xf5ad9d2194e51e8d),
+     W(0x00000000afb982bb)},
+    0
+  },
+  {
+    {W(0x906c5d7edd38e71d), W(0x8d8bd83bfcd5dc4c), W(0x43e86036062f4973),
+     W(0x000000001fc89321)},
+    {W(0xc9eadf02773876e1), W(0x5175b314c4af1610), W(0x03e26fe975f5e8e7),
+     W(0x0000000053c0eb90)},
+    0
+  },
+  {
+    {W(0x208a953d0656d3ee), W(0x06b0aadf5c4cdd3b), W(0x337b0c1c4aa7e117),
+     W(0x00000000e36a6270)},
+    {W(0x7ff1a90440bc7808), W(0xfe6dee30016f91d3), W(0x329673e9567671e1),
+     W(0x000000000e4c5535)},
+    0
+  },
+  {
+    {W(0xa39a7c56537ec3a6), W(0x6edb9f255c0044de), W(0x783020671bb4fcaa),
+     W(0x000000009f4b3e9b)},
+    {W(0x97792d6ee47439bb), W(0xc87b70874c25c017), W(0xcfe4321fa0945868),
+     W(0x00000000acbe5aa0)},
+    0
+  },
+  {
+    {W(0xf9f2292d11d96b9c), W(0xf92fc076b3226be5), W(0xb96e5203d223ed15),
+     W(0x0000000046c58b2a)},
+    {W(0x32e1738e73f96956), W(0x332fe6a4b2e530c9), W(0x35cfcd4ae0d27739),
+     W(0x00000000b241b25a)},
+    0
+  },
+  {
+    {W(0xecb57d930aabb441), W(0x1bd167f7cdab3030), W(0xd574edc557249e22),
+     W(0x000000003d6ae389)},
+    {W(0xe5b109ff461789ae), W(0xb68174c9c5045379), W(0x2778d4bc73f336a7),
+     W(0x0000000074a3f675)},
+    0
+  },
+  {
+    {W(0x11cc592caf3c94d8), W(0x10dd76cc08213856), W(0xf972021c86a50cd7),
+     W(0x00000000c03d751c)},
+    {W(0xa50fa797a9a7d056), W(0x638332322331c224), W(0x68bf3cbeb05c9869),
+     W(0x00000000b43a1327)},
+    0
+  },
+  {
+    {W(0xf7c232980a069d46), W(0x2ff47bdfabade062), W(0x3ede284455a55218),
+     W(0x00000000bda7ff75)},
+    {W(0x8f6ef6e311f16856), W(0x97e000547a9f2492), W(0xb25070744c8d435b),
+     W(0x000000000e38a26e)},
+    0
+  },
+  {
+    {W(0xedf3db0f06abcce0), W(0xba89c60d900f5112), W(0x44fb4414abf90dfa),
+     W(0x00000000639ad107)},
+    {W(0x34312f463ce4279e), W(0x80dd2cf0c34f3e18), W(0xe6e31e9d261d0af0),
+     W(0x000000009139ec10)},
+    0
+  },
+  {
+    {W(0x0259e0223986970f), W(0xb24b4b1088a3c72a), W(0x875fa8def81c7666),
+     W(0x00000000d64cb566)},
+    {W(0xf0bbaecf1845767a), W(0xf17117e35ba29f2c), W(0xcb50b546165707b3),
+     W(0x00000000c38c9b78)},
+    0
+  },
+  {
+    {W(0xaedb737bd8cf931e), W(0x109dde5e4b540641), W(0xa8627f3a05641a5c),
+     W(0x00000000bb51dbe5)},
+    {W(0x88784243f0b85415), W(0x032f45cd3961789d), W(0x929c42d39b68332c),
+     W(0x0000000026201b97)},
+    0
+  },
+  {
+    {W(0xfdd56931df5ac31f), W(0x5887de3eb9727a46), W(0x3a829bbf3465780f),
+     W(0x000000004ea95080)},
+    {W(0x8e0189c6807b443f), W(0x79a14950fc9c8fde), W(0x45859537a7ee3dee),
+     W(0x000000000a0d5c0c)},
+    0
+  },
+  {
+    {W(0xf136818cffa1ca56), W(0xa8ec7c9f3ed92d19), W(0xf022bde9e7205c67),
+     W(0x000000007dc609b7)},
+    {W(0x3fce313303696990), W(0xf48b449c689236c9), W(0x5664330ad23173a5),
+     W(0x00000000411cbf6e)},
+    0
+  },
+  {
+    {W(0xa5e92546e78d7bc1), W(0xaaa5b76abc574b0a), W(0x350371e2d23ca053),
+     W(0x00000000a243d725)},
+    {W(0x2ba32243c8b47480), W(0x60af01443f0c8e58), W(0x91ef5c19281ff4f6),
+     W(0x000000004a82a672)},
+    0
+  },
+  {
+    {W(0xf5d65d23f8de96da), W(0x971c067845077940), W(0x10d3561d2b66a085),
+     W(0x00000000f4729ebf)},
+    {W(0xa1d185d96774c3c2), W(0xc94b747941ba7f0f), W(0xe217407b6b0d3680),
+     W(0x000000009ebe86fe)},
+    0
+  },
+  {
+    {W(0x89d5bd3ff5850b47), W(0x69fa201d846a0a42), W(0x06a382dd9184c626),
+     W(0x00000000e77cb47c)},
+    {W(0xe70069d868d658f8), W(0x1ea35a66cf7c23d9), W(0x004411f9ee5310af),
+     W(0x0000000093308915)},
+    0
+  },
+  {
+    {W(0x2298070d1e26a496), W(0xd21489b26fdb9a6e), W(0x48330cbb3f0f1ab9),
+     W(0x000000001a0806b5)},
+    {W(0x5fe8d4cbd3f01371), W(0x1b97f2a315e3f48c), W(0x3e43e2a56ec13fef),
+     W(0x00000000f24cbe79)},
+    0
+  },
+  {
+    {W(0x65d4be50d57acd59), W(0x1ce1182aece9a58b), W(0xa5c2cb46c1b57a44),
+     W(0x00000000148a7e61)},
+    {W(0xc0ef940ba1613c53), W(0xc23fec3e41260206), W(0x271a4b7b61b509fb),
+     W(0x00000000e7f1a545)},
+    0
+  },
+  {
+    {W(0xa898424f63cfee1c), W(0xead338594ac7e129), W(0x8466375a49dcffe5),
+     W(0x00000000d8c6b117)},
+    {W(0x7dfd8040fdad94f6), W(0xdb25351379303542), W(0xebf637337ea13630),
+     W(0x00000000c8455fd0)},
+    0
+  },
+  {
+    {W(0xaa5c0c6a5e67a2fb), W(0x62b7db020d9e3d82), W(0xacfc6fa054cd273b),
+     W(0x00000000abb8d377)},
+    {W(0xfeb78185b2ffe321), W(0x97b3faad3871866d), W(0x8258c72d57b85aa0),
+     W(0x0000000097878847)},
+    0
+  },
+  {
+    {W(0xaaba587a6bc2db0f), W(0x48281b7f85e9b009), W(0x3593ea9238c3ffc4),
+     W(0x0000000066c852c5)},
+    {W(0x977275f197f35e46), W(0xa42e7adee0b544fb), W(0xd718092d995cf7c5),
+     W(0x0000000028dff7c6)},
+    0
+  },
+  {
+    {W(0x2627af987e04b129), W(0xc3d23e842b2de5d2), W(0xf1b2348b9ec7cc42),
+     W(0x00000000203c8a3a)},
+    {W(0x4dbc3b30bb8a9d82), W(0xd8f66cfe93c45c22), W(0x1449a0f837b0bce7),
+     W(0x000000008e2c78b0)},
+    0
+  },
+  {
+    {W(0xf1ca98f8756d01b5), W(0xef1d92aa3c4ccfa1), W(0x304e7b73f9dc9818),
+     W(0x000000008c3e2550)},
+    {W(0x2a382288e0585fa0), W(0xa62cb6cfaa36522d), W(0xd475c7b6202a7f64),
+     W(0x000000009511a92d)},
+    0
+  },
+  {
+    {W(0x44b5d2a637be4bfc), W(0x8e2577cc18dbca8e), W(0x36be5a38e2d8324b),
+     W(0x0000000002520fd6)},
+    {W(0x39805c3d1c6b511b), W(0x89641e1819f374c4), W(0xe8f34d3b0e3e80db),
+     W(0x00000000f11395e1)},
+    0
+  },
+  {
+    {W(0x5a57940c247ff06b), W(0xd843f074197ed7f0), W(0xe70fbd6095da0079),
+     W(0x0000000042a15f4c)},
+    {W(0x258f153fe03caf10), W(0x6eabe0d248ff471e), W(0x0c86585f6a81db60),
+     W(0x00000000dfacb644)},
+    0
+  },
+  {
+    {W(0x66824e811aa5b3a9), W(0x7d070643c90a85b5), W(0xaec9a09e32f76b95),
+     W(0x00000000480d7677)},
+    {W(0x7826086fcac91ec9), W(0x0f6382f573d222df), W(0xa5ff47f68d5d6abe),
+     W(0x00000000c91b692a)},
+    0
+  },
+  {
+    {W(0xe60cfbedff875dd2), W(0x2366899fd4f2ee6a), W(0xbdaac3cbd22dce43),
+     W(0x00000000e2e86ea6)},
+    {W(0x5729760c4b227794), W(0x044ef0d7a291e9b2), W(0x3039f12dfbf33b34),
+     W(0x00000000200d915c)},
+    0
+  },
+  {
+    {W(0xb1ae627817bc7d7b), W(0x535440559e80853c), W(0xbe3b6a55b7ca70f6),
+     W(0x000000009e151ab7)},
+    {W(0x2ecbe1c0f4d5b28e), W(0x0edab9e545d11d7d), W(0x45647d575f4d77bb),
+     W(0x0000000095d444c3)},
+    0
+  },
+  {
+    {W(0x1b391e2c59445695), W(0x6d8a9ceea236e047), W(0xd7db3c5a116d5faa),
+     W(0x0000000014fe4ba0)},
+    {W(0x5709b1b7d152aa6a), W(0x9c9d6129882983db), W(0x0a0d4e0cd566a024),
+     W(0x00000000148afd83)},
+    0
+  },
+  {
+    {W(0xd0c2c748c2a6e6ae), W(0x9d62b18d152014a7), W(0x0b1b3cef85465e3c),
+     W(0x000000001aea2f44)},
+    {W(0xa39683563c4e05d0), W(0x5d2316542341edf1), W(0x32264ebb230961a4),
+     W(0x00000000c8260652)},
+    0
+  },
+  {
+    {W(0xce687a9dd6e2af44), W(0x8d5d3a533e3ce266), W(0xd2bff42803e43bc0),
+     W(0x0000000028a57030)},
+    {W(0x510c38d8d6363aca), W(0x0ba1f1f82aed2d46), W(0x63f5f99556427429),
+     W(0x0000000027ab9ab6)},
+    0
+  },
+  {
+    {W(0xfc77f131590c6749), W(0xb7812d4e13911194), W(0xc91673af879b0d3d),
+     W(0x0000000038f1e670)},
+    {W(0xbd8aba669154a008), W(0x211290f4f44bb9ac), W(0x306c37c1fe9471fa),
+     W(0x00000000139430c3)},
+    0
+  },
+  {
+    {W(0xd4dc97803f9b658a), W(0x677857664aebf1a4), W(0x77ebac8f01319d5f),
+     W(0x0000000043a685a4)},
+    {W(0xb2e9d6542cf2d59a), W(0x5cc5526dbdf54057), W(0xa41841bef5748280),
+     W(0x000000001c4a312c)},
+    0
+  },
+  {
+    {W(0xcb9a927ae696f294), W(0xac65bfd8ec889de0), W(0x30ce3156dc6d55d3),
+     W(0x00000000016cd308)},
+    {W(0xb97cf91befe07160), W(0xb8819ca7dcfb47b4), W(0x96eb165fa7ec59cb),
+     W(0x00000000231b87ed)},
+    0
+  },
+  {
+    {W(0xd06a191b367fae47), W(0xc341068ee0c6e1d3), W(0x5cfe8c94a8c6d95a),
+     W(0x00000000fa9688a6)},
+    {W(0x8dfa9414d75e4b37), W(0x358c4b3e03841860), W(0x96547228c32369db),
+     W(0x0000000031a85532)},
+    0
+  },
+  {
+    {W(0x20d94e313588eefb), W(0x2b4ddc7c0a364c8e), W(0xb86b76ede4d0f22f),
+     W(0x00000000f5f24690)},
+    {W(0x254381368f242aa5), W(0xcff3f1dac7638eb2), W(0xab1f4149ed6e0db4),
+     W(0x0000000054deb69b)},
+    0
+  },
+  {
+    {W(0xc7baae714c78edc4), W(0x04fefc600df07dc3), W(0xe0175894f4253819),
+     W(0x00000000bbd88b46)},
+    {W(0x316117638641b9e4), W(0x8552eb9b09a16f72), W(0x22b4e67a9d7221ce),
+     W(0x00000000ded069d7)},
+    0
+  },
+  {
+    {W(0x5ca4f3b81c723480), W(0xe5da7c0b5e386c2d), W(0xbec9d2ddd758c701),
+     W(0x0000000078bc05bb)},
+    {W(0x62fc18822a987aca), W(0x3a049460f81f4d78), W(0xa5e18b2409e6228e),
+     W(0x000000001e49b01c)},
+    0
+  },
+  {
+    {W(0xa23c19fc30c71e8a), W(0xc079e8f90da09eb8), W(0xb886b9188bb8e26d),
+     W(0x0000000060c3b439)},
+    {W(0xa7c74446eac989a4), W(0x13438af41e4077d4), W(0x29e315c5ae9d8fc5),
+     W(0x000000005db9ce62)},
+    0
+  },
+  {
+    {W(0x0a3be947384e4c9b), W(0xb974dc28842c51d2), W(0x046ef19ff00dad54),
+     W(0x000000002236f358)},
+    {W(0xb372cfe41c98ca1c), W(0xe739190854c29ceb), W(0x3dbbef3614d226f8),
+     W(0x00000000323774e2)},
+    0
+  },
+  {
+    {W(0x261bf10fcbff69b7), W(0x70f3d5cb20dca1ed), W(0x6bbb5d0f26cce12a),
+     W(0x00000000f61b545e)},
+    {W(0xe43f8761fed6e458), W(0x4b5faf704e858562), W(0xaffe71ddddb345fc),
+     W(0x000000001d265504)},
+    0
+  },
+  {
+    {W(0xbed0f43079d4a2b4), W(0x3b58a6caa274c3fc), W(0x890138133686bcfd),
+     W(0x0000000035cb4089)},
+    {W(0x87d4d4956bbb3dba), W(0xe1f23f9c7fcd06a3), W(0xe1ad48837f107c83),
+     W(0x000000000195b4e8)},
+    0
+  },
+  {
+    {W(0xd091fe6cd3b1645d), W(0x684aca693f9a5a58), W(0xff913a80d21ce0ec),
+     W(0x0000000078c8e65d)},
+    {W(0x46853789fbf31215), W(0x471967cc28e125ff), W(0x1a40c2b7d87121fb),
+     W(0x000000001d5e77e5)},
+    0
+  },
+  {
+    {W(0x11787bb1b571009e), W(0x28af81d6089450f0), W(0xe9463305037816ad),
+     W(0x000000007813b658)},
+    {W(0x438cab6936829e1c), W(0xc3dcc6fceb6639e8), W(0x753b54de07a344d3),
+     W(0x000000005809e970)},
+    0
+  },
+  {
+    {W(0x1c46dbaf7cb4aaa6), W(0xb5b9d7da2e985824), W(0x5a2b138ed5748c07),
+     W(0x0000000023e74342)},
+    {W(0xc1a0bf54d741a218), W(0x7aaaac5966544d83), W(0x8edc43949ea2a1e6),
+     W(0x00000000d26ae7ef)},
+    0
+  },
+  {
+    {W(0x6134ac2a65d19092), W(0x85ec71870b697df8), W(0x14fdccd0e47e5d6f),
+     W(0x00000000ee3a6417)},
+    {W(0xf07b5eeb713f4bda), W(0x78129488e5cb62ea), W(0xd99baae3c3fe5d68),
+     W(0x000000009d21148b)},
+    0
+  },
+  {
+    {W(0x591cfc79bf4a7894), W(0xa0905bb725ecb386), W(0x9e6c0655469073ab),
+     W(0x00000000167083d2)},
+    {W(0x6aab9a44b7b420cd), W(0x3cc44b40742e6221), W(0xcdc07268e865e776),
+     W(0x000000009c81bbea)},
+    0
+  },
+  {
+    {W(0xefd4a5e18288209c), W(0xed141d579997b3c6), W(0x62d80d16998ab968),
+     W(0x0000000023cef221)},
+    {W(0x2cbce5a71e3bb766), W(0x8ccd0b5b0bdaab11), W(0xa697ae714ddfd4ed),
+     W(0x00000000b10ac73b)},
+    0
+  },
+  {
+    {W(0x4b6c715159aeb2fb), W(0xcd9a6892fba65d51), W(0x09ab6ba2d656cd3f),
+     W(0x00000000702c50be)},
+    {W(0xfcd4dd3df436602c), W(0xbf3654d94b4d52e1), W(0x228ed3f268b6b19a),
+     W(0x000000008636e1dc)},
+    0
+  },
+  {
+    {W(0x611761ae202447f8), W(0x6f71d25b781c1b29), W(0x91495b8a06be4be3),
+     W(0x000000006bc9058c)},
+    {W(0x38bba068933f6ed1), W(0x67137ecad7dd90fb), W(0xd01038340c62e6b7),
+     W(0x00000000e2ebecc7)},
+    0
+  },
+  {
+    {W(0xf489c5a49c848ae7), W(0xc74e5736bc093676), W(0x22c972c6452249c1),
+     W(0x000000006575411d)},
+    {W(0x4fb193a8703a9952), W(0x50815f71d8cdb9d6), W(0x396bab852118a6bb),
+     W(0x000000003a285599)},
+    0
+  },
+  {
+    {W(0x1f84f29b216201ca), W(0x99d845a088230a98), W(0x2533148c6f7414f8),
+     W(0x00000000ca190b24)},
+    {W(0xad90c91aa9e3f705), W(0xad62098a20bce3b0), W(0x0fc92ae36e49617b),
+     W(0x000000007ac05a77)},
+    0
+  },
+  {
+    {W(0x2e4eb35365343609), W(0xbc0171ed0797f28c), W(0xf87410be18109f2c),
+     W(0x0000000048534fd3)},
+    {W(0x625416a2858739e9), W(0x69035bea3bf42ef5), W(0xf4169c2bc2239965),
+     W(0x000000006b0a7c81)},
+    0
+  },
+  {
+    {W(0x8e428eba415faade), W(0xcb130074254711c5), W(0x454d00677746e8fe),
+     W(0x000000000974d662)},
+    {W(0x6924612d841e8760), W(0xcaef2e98779e8f1c), W(0x811ec00552e66f13),
+     W(0x0000000095e9399c)},
+    0
+  },
+  {
+    {W(0xe83c78715e1bf775), W(0x6c60f0c5eb57586f), W(0x48fde7c1a838fa9e),
+     W(0x000000008aa5ac5b)},
+    {W(0x332c16601454e7bd), W(0x5650947562d22ae7), W(0x0d71f7b2d6cbc665),
+     W(0x000000005ca95f5a)},
+    0
+  },
+  {
+    {W(0xaacf24ef39d52530), W(0xefc0a9e8968c2d88), W(0x0df0daa85df68f45),
+     W(0x00000000440ddb37)},
+    {W(0x89a3a9c4e8dc5b31), W(0x85dc22fd60279fa4), W(0x931f1f554d7d92a5),
+     W(0x0000000004cadf9b)},
+    0
+  },
+  {
+    {W(0x771dce2266075613), W(0x3284a91b3d5d8954), W(0xb611253c84159977),
+     W(0x0000000028060ed2)},
+    {W(0x728c0f60493ee5c0), W(0x68377e21ccb30f15), W(0x74c73f11a80a5228),
+     W(0x0000000005ad7605)},
+    0
+  },
+  {
+    {W(0x8b951bb9d28c7ab0), W(0x5f4e3d8936605657), W(0x8b80f3b82003bef0),
+     W(0x00000000848185f0)},
+    {W(0xfe6d1aea020518b3), W(0x33e56c9fe91c72ae), W(0xeba964325610b9ec),
+     W(0x0000000033b9862a)},
+    0
+  },
+  {
+    {W(0x67d6250bd1a7109a), W(0xb75464f6c604bf17), W(0xb9faf77897239322),
+     W(0x00000000b520c9a2)},
+    {W(0x48804e6d4860ec4a), W(0x47de2bfa7ae96242), W(0xccae668f9277c754),
+     W(0x00000000ec288921)},
+    0
+  },
+  {
+    {W(0x9249aca025095072), W(0xf73b265e2b430634), W(0xf5afb17613ab75cb),
+     W(0x00000000c8080e7f)},
+    {W(0x7a3dd40bf426b3f5), W(0xf344a67edac9a16c), W(0x8c0d66bfc3de23d6),
+     W(0x00000000fe1647b3)},
+    0
+  },
+  {
+    {W(0xff6397f27fe4838f), W(0x7f0fd7cdc2fcd27e), W(0xc1fad862a20083c8),
+     W(0x00000000a1b6bfd7)},
+    {W(0xdd5d67c143a7dd26), W(0xf3c8a0a2949f059d), W(0x576a636af8177a15),
+     W(0x00000000554d6709)},
+    0
+  },
+  {
+    {W(0x271b80cc9c0c3c28), W(0x6e311720872ae0ab), W(0x6324c40d4360f6ba),
+     W(0x0000000024c01a59)},
+    {W(0x660b84c39728bbdd), W(0x4d4687754d18de95), W(0x2625317fe6ba1e55),
+     W(0x0000000097b83ef1)},
+    0
+  },
+  {
+    {W(0x802eb74d7410a480), W(0xb9a2bda7e548079d), W(0x55232f2a39ca8f61),
+     W(0x000000002fb7e55d)},
+    {W(0x9220ae58194dcc29), W(0x5e7934932e848bd7), W(0x92402ca2260acc3b),
+     W(0x00000000e550753a)},
+    0
+  },
+  {
+    {W(0xaad8803ba5da8d70), W(0x700613be98500f37), W(0x993418b0641aab42),
+     W(0x000000008512cc28)},
+    {W(0x579d1bd2e6b3ae5f), W(0xabca35b5dfbb6873), W(0xaab5c3061c094114),
+     W(0x00000000f049ca37)},
+    0
+  },
+  {
+    {W(0x3f033579692cd275), W(0x257c60987a0f9200), W(0xc9a86048d8cdb51a),
+     W(0x000000007c8ae232)},
+    {W(0x4c50572ef69e45f2), W(0x6c662e7dddc8712e), W(0xbf36bc2feda04ec8),
+     W(0x0000000057548fde)},
+    0
+  },
+  {
+    {W(0xeb2dabf64b860df5), W(0x978d32ac02277c89), W(0x7165200a2c85afe5),
+     W(0x00000000f4e176f1)},
+    {W(0xcb06cbe248008b15), W(0xd94300836561582e), W(0xa2a28d872ece5178),
+     W(0x000000006f3d68f9)},
+    0
+  },
+  {
+    {W(0x79b44a2f8d7b6172), W(0xb8d7142edae9c574), W(0x5e555c1c0bc8c48f),
+     W(0x00000000badd240b)},
+    {W(0xb2c110abeb676285), W(0x9c1d25d7dc163691), W(0x887342bb7948b6f5),
+     W(0x000000006755ee25)},
+    0
+  },
+  {
+    {W(0x3850a16794d16c64), W(0xd9c29777e527fe4a), W(0xb5678a08d48d83f8),
+     W(0x00000000de38a969)},
+    {W(0xa8f6d3225d70aec0), W(0x26ccd761a8e29381), W(0xdbbbd0b27f9bdf29),
+     W(0x000000006a2d47b3)},
+    0
+  },
+  {
+    {W(0x6636628ee018d3b4), W(0x583c020af13246be), W(0x9db9195644a2faf8),
+     W(0x0000000026d82a20)},
+    {W(0xee76866aabd468cc), W(0xa433d2ade59f93f7), W(0xd42bc58c2c6e1271),
+     W(0x00000000500d0e97)},
+    0
+  },
+  {
+    {W(0xb2aa489939400d2b), W(0x1ddd4cd92746f9c0), W(0x904dc87f69f6875c),
+     W(0x0000000042f0af7b)},
+    {W(0xbd1c62ee95e79c1f), W(0xbfef76fcebb9621d), W(0xb20368e14188fc0c),
+     W(0x00000000587f2c9a)},
+    0
+  },
+  {
+    {W(0xc280ee515c2b4d2d), W(0x261cc9a99382f279), W(0x62a582ce8d8b6b03),
+     W(0x000000007cc903f0)},
+    {W(0xa7e04e2cd47ef91d), W(0x906b23b597b67076), W(0x6c950321970b0f7f),
+     W(0x0000000012371e36)},
+    0
+  },
+  {
+    {W(0xecdced34b19cee20), W(0x3303aa30df0ea972), W(0x59e0e10479662c0d),
+     W(0x000000004aed435a)},
+    {W(0xdc2dc60feb87e9d4), W(0x39b7cf1e60b20694), W(0x4e52bfcecacde571),
+     W(0x000000007878fbad)},
+    0
+  },
+  {
+    {W(0x29266d73ce5b3021), W(0x3549846e812022d3), W(0xdbc93cf27ab2f5e7),
+     W(0x00000000f48588d6)},
+    {W(0x04045a0c7c72d817), W(0x171cdee03a313fce), W(0xf0a8cc29283b0374),
+     W(0x0000000019c0dbda)},
+    0
+  },
+  {
+    {W(0xee81388b501ebecf), W(0xa0b1628f3408cf2c), W(0xd3ed8a8906faf232),
+     W(0x0000000092a0aaf0)},
+    {W(0xf39ec3a431bb878e), W(0xb58d4a55e782321b), W(0x9e8d1068f10fd94a),
+     W(0x000000008b22b5c6)},
+    0
+  },
+  {
+    {W(0xda551df5c014ef03), W(0x38accae09c855179), W(0x58b1724785881516),
+     W(0x000000004ca3afde)},
+    {W(0xedad620a1906665e), W(0xf0e5252d9a38e2fc), W(0x50e9fd35030bf9a9),
+     W(0x00000000ff8b3792)},
+    0
+  },
+  {
+    {W(0x5fa2f4ecf4ad084f), W(0x7800573747e40373), W(0xa2edf1baccd5cf7e),
+     W(0x00000000ea4609c6)},
+    {W(0x1a1e2174427886a0), W(0x93fc788ef3ea9092), W(0xc5ac69493daeb9b2),
+     W(0x0000000095189b90)},
+    0
+  },
+  {
+    {W(0x62893024e8aca11a), W(0x96d8cfd50fe80106), W(0x0aee26ed3f556af9),
+     W(0x00000000cf63eeee)},
+    {W(0xa0db3c63b035a4e5), W(0x51cada09a3689d6a), W(0xa8e382e294f6ed36),
+     W(0x000000007b590cbd)},
+    0
+  },
+  {
+    {W(0xf8b5f0206c63b99d), W(0x177a438dc3cd033a), W(0x22c0a54861760b3c),
+     W(0x00000000357984e9)},
+    {W(0x20516e09c075495b), W(0x9c29974ab6a3bfcb), W(0x1135481b49b5e871),
+     W(0x000000005bb6298f)},
+    0
+  },
+  {
+    {W(0x238e527ed3ff620e), W(0xbc33ef951f68028a), W(0x28c5fc24137e7e3a),
+     W(0x000000002fa8616b)},
+    {W(0xfeef3e01614dcccf), W(0x3d4c66e437fe7ef8), W(0xe05519539838ae24),
+     W(0x000000002501bb83)},
+    0
+  },
+  {
+    {W(0x22bfc5f689e178bd), W(0xed4b08489379b73d), W(0xcb76df9d10d6b0bd),
+     W(0x0000000028250e0b)},
+    {W(0x7e5ab52d4c8cd98a), W(0xed6902ec0c17fa37), W(0x0e8871efb2af1a1f),
+     W(0x000000008dba459a)},
+    0
+  },
+  {
+    {W(0x0351c51ff65f7b7e), W(0xfdc528e4bfccbc49), W(0x4708bd692d2f451f),
+     W(0x0000000016c77377)},
+    {W(0x3ad21aaf9bdc2171), W(0x7412ced1abc01d1a), W(0x134f680ac2930ba8),
+     W(0x000000008be69c22)},
+    0
+  },
+  {
+    {W(0x13194e926a81d8a0), W(0xce7170061779c743), W(0x6797d6e5e66495e8),
+     W(0x00000000014626f4)},
+    {W(0x2f27744cb7d8e078), W(0x61020a341eaedefc), W(0x7d4f264974a987c0),
+     W(0x0000000077676ac0)},
+    0
+  },
+  {
+    {W(0x5baa88ffe147b281), W(0x86d67276eaf63325), W(0xef81a2c4097ef318),
+     W(0x0000000053d40973)},
+    {W(0x16391f80188ac1ec), W(0x1f31d09a79264457), W(0x83b32c8e550523a0),
+     W(0x000000009e0867dd)},
+    0
+  },
+  {
+    {W(0xe27fc9ef77602ce6), W(0x1dd378877ed824ed), W(0x5d95ec3f2ea0f9ab),
+     W(0x000000004fa1988a)},
+    {W(0xbdbf6570f04c3495), W(0x9218820819999960), W(0xd5f82ee127985643),
+     W(0x000000004cf37f8e)},
+    0
+  },
+  {
+    {W(0x03f9ba4181205bb8), W(0xeb260709ca56efbb), W(0xda218ce21d516a87),
+     W(0x000000002a5e7d56)},
+    {W(0xefc43048bbebedbf), W(0xefe4e50ec012d3ae), W(0xb149f6a0df661940),
+     W(0x00000000ea3a5c73)},
+    0
+  },
+  {
+    {W(0x388ccb78e8edb319), W(0x8f246ead23fc488f), W(0x48d720c7ec0d0be8),
+     W(0x000000006519b886)},
+    {W(0x523633d1f567f61d), W(0x68343eb09f0dfb5d), W(0xc62d63b5703a9694),
+     W(0x00000000a75c1ec3)},
+    0
+  },
+  {
+    {W(0x1b57f37a6cb3cc3e), W(0x3bf0f48c9cb9f86d), W(0xc3ed4506f0064459),
+     W(0x0000000036c945cd)},
+    {W(0xe765cdab2e55990a), W(0xe3811590ccd0fb07), W(0x2fe7e0466d8968cd),
+     W(0x00000000df2a54fc)},
+    0
+  },
+  {
+    {W(0xba42ba38c03c40bf), W(0xef532db90fded5fc), W(0x849d35d877ed1d33),
+     W(0x00000000f2150355)},
+    {W(0xeb2eb65129450ba2), W(0x53ca27bb317d8ef4), W(0x6d6a6a80a570fa7b),
+     W(0x000000007cefb526)},
+    0
+  },
+  {
+    {W(0x2beb0706f6c6393c), W(0x469e743a20ee8fb0), W(0x29686935ee7d71c4),
+     W(0x0000000087099014)},
+    {W(0xb7a8cf4dc63dd360), W(0x4221f870091d5e5c), W(0xd8ef20b32c768c57),
+     W(0x00000000f231ce32)},
+    0
+  },
+  {
+    {W(0x205ad3491766a8d9), W(0x70416030b2d3154f), W(0xaa3895abd2ae7a51),
+     W(0x00000000c1f13e71)},
+    {W(0x5fe8d6e93885e175), W(0xdda4a3d3b6006927), W(0xbd27c0d664db3e9f),
+     W(0x00000000d4beab96)},
+    0
+  },
+  {
+    {W(0xcd4aff26b5766c53), W(0x9790d21097a03418), W(0x74b0255865794549),
+     W(0x00000000fff2dacf)},
+    {W(0x03030a47b5116e30), W(0xc949be83c92e555d), W(0x505153ecd0130490),
+     W(0x0000000016efdaf4)},
+    0
+  },
+  {
+    {W(0xa0322255ff47c3ab), W(0x3e6358a7d70f8b3e), W(0x5bacb5160b2a6b3d),
+     W(0x0000000086c3d829)},
+    {W(0x7f5bf638112cc163), W(0x0c3d87a47d7fd379), W(0x05c035dcb1b63413),
+     W(0x000000000b704596)},
+    0
+  },
+  {
+    {W(0x6e913e61b3ebaf73), W(0xef552986af8b5b43), W(0x8600c1e63085d029),
+     W(0x00000000d03157ff)},
+    {W(0xa6b8c4bc50155364), W(0x2a7ebdf33240b691), W(0xd0adcb88bf2389c6),
+     W(0x00000000d9cd6f3e)},
+    0
+  },
+  {
+    {W(0xfcb77794151deb0a), W(0xd74a11af726c4246), W(0x38f745f3b5060b3e),
+     W(0x00000000cf4f28d8)},
+    {W(0x8056e24233459ac9), W(0xc4d0bb884cedf3e8), W(0x453f4114456a3d51),
+     W(0x0000000033b05cdf)},
+    0
+  },
+  {
+    {W(0x6613b0dccac911e3), W(0x5356c51f91de246a), W(0xf04cbdedd5659a56),
+     W(0x00000000d296ef7c)},
+    {W(0x8ebe520214b77d54), W(0x5ce1ee7eb3f4d02f), W(0x3608da3695d334d1),
+     W(0x00000000854a29d7)},
+    0
+  },
+  {
+    {W(0x267fe79414d4bbf6), W(0x3acdd39ac8838bdb), W(0x83a3f28c59c41404),
+     W(0x00000000dde24abc)},
+    {W(0x0f48d26511be33e8), W(0xfa145590adcb031e), W(0xef9fd00a2842e26a),
+     W(0x00000000946f1967)},
+    0
+  },
+  {
+    {W(0x97fe9a1541821d90), W(0x94484af60c5d7eb0), W(0x63c80707d965b32a),
+     W(0x000000003465c7fc)},
+    {W(0x91de1b84d561a9e2), W(0x05c7814ac82556ff), W(0xb773759e8f203f28),
+     W(0x00000000b5745065)},
+    0
+  },
+  {
+    {W(0xaa88e4f7ef7b1a94), W(0x8dffae5c54be7cd6), W(0x52a9570dfdf8c226),
+     W(0x00000000f03b2189)},
+    {W(0xa39944263ed542ce), W(0x04c9db480604c0c0), W(0x8d04bb82c63bb1ad),
+     W(0x00000000c0005ef9)},
+    0
+  },
+  {
+    {W(0x79d3874891af3e95), W(0xe0fd4ce9720a8e5f), W(0x973b613608d5f8cd),
+     W(0x00000000b65b9ba5)},
+    {W(0xc628dec02548ce04), W(0x2d3f588cc2918056), W(0xdef178f715250557),
+     W(0x000000009781e033)},
+    0
+  },
+  {
+    {W(0x13553aebe7d19911), W(0x4cd0ac42d0fd0f4c), W(0x65ed464719dc1008),
+     W(0x00000000119f5be6)},
+    {W(0x630aa634ae04d682), W(0x05d9f7e240eb36f1), W(0x496d8ca6feb28a0f),
+     W(0x0000000094ef0c57)},
+    0
+  },
+  {
+    {W(0x5685207dc0b3287a), W(0x0c5a6291205d2807), W(0x17691024118fd8f6),
+     W(0x0000000051a3db28)},
+    {W(0x146fd7afd430357e), W(0x70a8c3e219b8936f), W(0x05d6168e1eb22a27),
+     W(0x0000000060ac6e33)},
+    0
+  },
+  {
+    {W(0xba4885fc6c86f60e), W(0x44acfad1e20ec28f), W(0xd2fb91d32ab39331),
+     W(0x000000009ff23d5d)},
+    {W(0x20a2ab36aa65490c), W(0x365cf7fb7b56d8d1), W(0x923239797518da64),
+     W(0x000000004e6fb37c)},
+    0
+  },
+  {
+    {W(0x0a284b4a3d4468f8), W(0x125c313627898b5a), W(0x1f386d8a2afc4c5c),
+     W(0x000000006056a5a2)},
+    {W(0x472d97f0f5df1d9e), W(0xceb41bb04911cee1), W(0x4b3e0a22b941acc9),
+     W(0x00000000b183724b)},
+    0
+  },
+  {
+    {W(0x8033f27be62e3b7a), W(0xbc64b1e17f833a00), W(0x3906e961d8245005),
+     W(0x0000000037baa48e)},
+    {W(0x0fa8208c99e48b8c), W(0xac5d490f09a0d9fe), W(0x9cf20002bfc15276),
+     W(0x0000000063519b62)},
+    0
+  },
+  {
+    {W(0x0b584b64c009e306), W(0xcc4802e8565d2478), W(0x4c878d74d4d2a53a),
+     W(0x00000000e37aebc9)},
+    {W(0x2318dc90cf799a79), W(0x18d7501cfe054062), W(0x4d0d16d5c41dab6a),
+     W(0x00000000c806d388)},
+    0
+  },
+  {
+    {W(0x1f53b23ee6dae5e1), W(0x9d0f66b38fb238d9), W(0x32f213860b9b5049),
+     W(0x0000000083a7ac50)},
+    {W(0xfc86a31cb24ac03c), W(0x4ffe53e2b86175b2), W(0x66567d2031c64997),
+     W(0x000000004f77b26c)},
+    0
+  },
+  {
+    {W(0x71ecfa55dd221f20), W(0x24a3a82960d09dd6), W(0x4d918d878bd70fec),
+     W(0x00000000fd1e794b)},
+    {W(0x2813b470dad441d5), W(0x8bb502c457a4f5dd), W(0x7e2e86363202e1d9),
+     W(0x0000000009c20450)},
+    0
+  },
+  {
+    {W(0x0ba1d2d62e67e9be), W(0x7f61765d2ab38744), W(0x9073b1533d0a2b12),
+     W(0x00000000618e6a3c)},
+    {W(0xcfcf353dd8cd8a06), W(0x980ab68cc765d586), W(0xb98f100ebe57dfb8),
+     W(0x00000000cb9f7824)},
+    0
+  },
+  {
+    {W(0xa4d15e00fafadd67), W(0xe9d7a59ae65de62c), W(0x66af0c796abe90c9),
+     W(0x00000000fc44701b)},
+    {W(0x05a55f7f4ab31fa5), W(0xe2909c260a5d8cc8), W(0x503d61e4a87b98ff),
+     W(0x000000005d95faf6)},
+    0
+  },
+  {
+    {W(0x049608547de95835), W(0x714caf10840b0ecc), W(0x49021f7fa577c336),
+     W(0x0000000013f9e2cd)},
+    {W(0x857177e977dbb212), W(0x1df169dd707cf38f), W(0x24364e6530a9ec95),
+     W(0x0000000034fe79e0)},
+    0
+  },
+  {
+    {W(0x6b392506acab129f), W(0x0aa515b52a61e0a4), W(0x860037015f842a04),
+     W(0x0000000070fbe092)},
+    {W(0xe5d73a2a33dd31bd), W(0xf44d14c2592a75f9), W(0xaf582ac6e034a57b),
+     W(0x000000007716a911)},
+    0
+  },
+  {
+    {W(0x29e10d92fe1c9be7), W(0xc9be41dd42916891), W(0x4c02b94597e4db80),
+     W(0x00000000d692f744)},
+    {W(0x8a177fb44231ebff), W(0x707ec173a07ca553), W(0x7aaa82c0f88d06d0),
+     W(0x00000000cc1387d6)},
+    0
+  },
+  {
+    {W(0x05c5a5cc10412c8b), W(0xf9d9b00d92a25152), W(0x3a89ecb50126adc4),
+     W(0x00000000243e9185)},
+    {W(0x9b1ae16d5a8292c2), W(0x78c41769303e0e76), W(0xf3b25d771159eb0f),
+     W(0x00000000818feef3)},
+    0
+  },
+  {
+    {W(0x5a59ed4c2334c16c), W(0x5b46992e891cfbd3), W(0x38b72f30ada88221),
+     W(0x000000002bafaca5)},
+    {W(0x7052c3d643cdb232), W(0x65fa4559d20bc964), W(0x35242f517bc1370d),
+     W(0x0000000054bfb24b)},
+    0
+  },
+  {
+    {W(0xf3b1be39b21dbd79), W(0x32eaa006e8d1072a), W(0xd64fc29889ccc6f1),
+     W(0x000000009ead117d)},
+    {W(0x33f8a1a16c3e3a07), W(0x6b0171e61023a772), W(0x9150a85649cb261c),
+     W(0x00000000a697ab95)},
+    0
+  },
+  {
+    {W(0xb687bf48b2e65c67), W(0x8dca8b52179334c0), W(0x939c4747b473d788),
+     W(0x0000000017d19281)},
+    {W(0xca140bc280ac4cf8), W(0x7fef959a74eb06a2), W(0x58ff5f037f8b2468),
+     W(0x000000002d4ffb99)},
+    0
+  },
+  {
+    {W(0x1fb2a3af736bfdf8), W(0xcf4d03f1befea577), W(0x026afed3dd6b7e2b),
+     W(0x000000002f2278ee)},
+    {W(0xde2e8f8d7bb42b9f), W(0xf06b5d601d754a7d), W(0xf4483e995a278394),
+     W(0x0000000049e68b8e)},
+    0
+  },
+  {
+    {W(0x985041bcfb481bd5), W(0x3b86141930d6d731), W(0xa5021f8f282a05ed),
+     W(0x0000000046acd8c8)},
+    {W(0x6b3cb2bd84c249ba), W(0xc47ea76c2ef89207), W(0x69f652d3034133e6),
+     W(0x00000000d5b1a552)},
+    0
+  },
+  {
+    {W(0x75be2a656b1b8744), W(0x80eccf9709d2bb98), W(0xe62aed59058ab698),
+     W(0x0000000079870b68)},
+    {W(0xcf8eb9b1d63aebda), W(0xfd982524c35fceb4), W(0xf922e24a9d141fa8),
+     W(0x0000000056ea8fc2)},
+    0
+  },
+  {
+    {W(0xd0e1f3b3ceabff5d), W(0x537ed8a1c9a850f2), W(0xbc0c19bdc566118b),
+     W(0x0000000023e7981b)},
+    {W(0x6841300ed5f3a8d2), W(0x018d9edd00c23088), W(0xb2b821161193521a),
+     W(0x00000000f6c40de3)},
+    0
+  },
+  {
+    {W(0x20f402eba40c0b54), W(0x1751b67cb5dbe0b6), W(0x6a8b6de6a2939389),
+     W(0x0000000051b0ac3e)},
+    {W(0xa8f5dc448e552c7e), W(0xcef9d8c09cf3784b), W(0x7a9ad539988c69f4),
+     W(0x0000000028abdbf2)},
+    0
+  },
+  {
+    {W(0xb0babe543b24b6ff), W(0x1ba26269ad10de08), W(0x787b537003a1a2ac),
+     W(0x00000000db047f94)},
+    {W(0x352b8a11b8c3b6da), W(0x44706f9b4d77ad1e), W(0x973697f568113029),
+     W(0x00000000cd195011)},
+    0
+  },
+  {
+    {W(0x63ea6eced00b7036), W(0x04f2098fd38c4df1), W(0xde95d2dd8f33afcc),
+     W(0x00000000f1761814)},
+    {W(0x90e96f19144d075b), W(0xe8e49448e716d830), W(0xc5236b23e5a8c670),
+     W(0x00000000d6ef2f9c)},
+    0
+  },
+  {
+    {W(0xdf9a9d59590dfc1f), W(0xfec758c6646dbff6), W(0x027bfa6f61b5e7b4),
+     W(0x00000000b94f61c6)},
+    {W(0xcd1c09eed2a650e4), W(0xf00e865ecb514291), W(0x0aebeab24fcfd7e0),
+     W(0x000000000bcd691e)},
+    0
+  },
+  {
+    {W(0xffb79d225f9c3001), W(0x3dadd59a071c1b9e), W(0x90481a6e2821f10b),
+     W(0x00000000f2b83fe6)},
+    {W(0x35189efeaa6641c6), W(0xd52bfefb980cecf9), W(0xff640e372da9555a),
+     W(0x00000000b94b552d)},
+    0
+  },
+  {
+    {W(0x3990dbe9fadb7cbd), W(0x3baa844ba95850e8), W(0xdb1619310638a899),
+     W(0x00000000979a9c9c)},
+    {W(0x8e55a3035d98072e), W(0xb96ad12bb7870517), W(0x0d373d5e0697df47),
+     W(0x00000000df37ec83)},
+    0
+  },
+  {
+    {W(0x3b7d0bdcec8e938b), W(0xc682ba24d5a11c10), W(0xafd51c29c0d3ff4b),
+     W(0x000000005da3122e)},
+    {W(0x8b86feff16ad8019), W(0x2ce004daf13402dc), W(0x8c45c7571073de56),
+     W(0x00000000b5b1773a)},
+    0
+  },
+  {
+    {W(0x2926e328103f6684), W(0xe811e0ccc5e25daf), W(0x437aadd7e90b4e6b),
+     W(0x00000000f58e9874)},
+    {W(0xa02d76080eeae491), W(0x6e4b2d92f93427c1), W(0xa76bdccf6f9160b3),
+     W(0x0000000028566e94)},
+    0
+  },
+  {
+    {W(0x90a19f4827a62137), W(0x164deee468d715b8), W(0xf5f35843084b754c),
+     W(0x0000000087d5e0b3)},
+    {W(0x5c4adb6b8c1fb14c), W(0x7ba68d9a6b5e0fd5), W(0x2e0223b278965fdc),
+     W(0x000000001489a61f)},
+    0
+  },
+  {
+    {W(0x4805f74f534a2590), W(0x5759fc1616eccf1a), W(0xe027c4b32d02501e),
+     W(0x00000000296c2938)},
+    {W(0x7a71ae4fd039bd21), W(0x95f144cf945846f4), W(0x6439c79ec2666576),
+     W(0x00000000ffa6e0c4)},
+    0
+  },
+  {
+    {W(0xb77139213205ffb3), W(0x3a85cc5c251cdd58), W(0x5c77054c3e834856),
+     W(0x000000008d7e45eb)},
+    {W(0xbc1d31c14b2eea39), W(0x8da1524c474e2f1d), W(0x3f88a34438a3c6f6),
+     W(0x0000000087c70884)},
+    0
+  },
+  {
+    {W(0xae8185b984151ed9), W(0x4cd33436798aca6a), W(0xe6979d7d25f9319e),
+     W(0x00000000402a8062)},
+    {W(0xa00c0a80691e9181), W(0x805b733957a8b6db), W(0x6fcce5c4b2f28059),
+     W(0x000000009c6c61a7)},
+    0
+  },
+  {
+    {W(0x4cfb8366f2afd215), W(0xfaec889a14117b4f), W(0x3a3b82480904a874),
+     W(0x000000009df5e3a3)},
+    {W(0xae8f168c48689737), W(0x802e3a3d2eb8cc5a), W(0x9ba8cc757d8697f6),
+     W(0x00000000a2a9936b)},
+    0
+  },
+  {
+    {W(0xe6fb51a60877b616), W(0x1d12bacc5551454a), W(0xfebc772bda16daa2),
+     W(0x00000000505d52bf)},
+    {W(0x32480ef7d445b162), W(0xab17ef13aa150fed), W(0x750d28cc68695f0b),
+     W(0x00000000bd8a7174)},
+    0
+  },
+  {
+    {W(0xa7f2a5edf6ef4959), W(0x9b39863b3f7136e9), W(0x774ec05ab717fa98),
+     W(0x00000000db9b0c19)},
+    {W(0xff6cfd1d0c7601a9), W(0x6e31b7adf991fb24), W(0x78b1f00f5c7d7678),
+     W(0x00000000cf910c16)},
+    0
+  },
+  {
+    {W(0x464295e72622c373), W(0x018eb74ee9ab796d), W(0x64dce1d1c92f99ee),
+     W(0x0000000048182b8e)},
+    {W(0xc0fc679579133d49), W(0x6e669019eb06708b), W(0xa6a4519e48aeacdb),
+     W(0x00000000ba9a6382)},
+    0
+  },
+  {
+    {W(0x6d2efaf4de860922), W(0x8ca08e3e261bdfd6), W(0x07ccc51c7c1c9abb),
+     W(0x00000000a7761eec)},
+    {W(0x68f33658831d0155), W(0xac7685832e781bfc), W(0x15393e46e9cd3699),
+     W(0x00000000eba780cb)},
+    0
+  },
+  {
+    {W(0x6fd596f21b56ce61), W(0xfde85a7fae6cc055), W(0x82dabd07bd182999),
+     W(0x000000006fc0b8b8)},
+    {W(0x2428cbb6ceda6677), W(0xc82d7460a386d6a8), W(0x91cb3e87234ee93a),
+     W(0x00000000dd2d2546)},
+    0
+  },
+  {
+    {W(0x0cbc7e3a33f316b9), W(0xe9e72a0168ab869d), W(0x1f3f2ab7ed87f414),
+     W(0x00000000bfbd901c)},
+    {W(0x94147b6f9bfdde44), W(0x8e3fd3469e69132d), W(0x6178d8152a5ef1f8),
+     W(0x0000000097dec912)},
+    0
+  },
+  {
+    {W(0xb1448eef5e1e86ac), W(0xdfdc16e3046bc701), W(0xf60fd6d75c3f0726),
+     W(0x0000000037ada124)},
+    {W(0x7fb2d360add0806d), W(0xef024e8cd89f7c14), W(0xf4ab69cd33643c91),
+     W(0x00000000aac65b05)},
+    0
+  },
+  {
+    {W(0x7b14f35b374b7326), W(0x7780cd9fc400f95a), W(0x6356393870e49bd9),
+     W(0x0000000000aced2f)},
+    {W(0xfc260bafe4254d58), W(0x5ac7aa293b9f2bbe), W(0x27e4c2068dac254c),
+     W(0x000000004898c79c)},
+    0
+  },
+  {
+    {W(0x74ff5d6566a30e60), W(0x2f920453494abed0), W(0x3169736bd613998f),
+     W(0x000000005eb1d304)},
+    {W(0x95aa3f6f90661028), W(0x644d764dfde17865), W(0x0fdc0c74d5fbb959),
+     W(0x0000000002147d25)},
+    0
+  },
+  {
+    {W(0xdc0466eea15878ad), W(0xced25e459a154bf1), W(0x8c595b9aa9a6c4a1),
+     W(0x0000000096084ee1)},
+    {W(0x1dc8e9fbc0b720fb), W(0x3320a32c1bad3014), W(0x2aeec996db0fe2fe),
+     W(0x00000000daec5795)},
+    0
+  },
+  {
+    {W(0xbfd12b741d689af0), W(0xcc2c2f903460cc69), W(0x881015df8141b673),
+     W(0x00000000437535d9)},
+    {W(0xe3efa5f26281315d), W(0xf8142e7b77cab909), W(0x69f7b5493adbb8f8),
+     W(0x0000000016daf438)},
+    0
+  },
+  {
+    {W(0xd83803a5d88257a2), W(0x0e7a711de9b91036), W(0x7712842623dcb64d),
+     W(0x000000001d1b1a7c)},
+    {W(0x55d36f8c63eace87), W(0xa58a356872394f4b), W(0x9404c67fb068368d),
+     W(0x00000000d85fee8b)},
+    0
+  },
+  {
+    {W(0x7c5509ce2644f721), W(0x5dab3c5dc8b64652), W(0x14d156e0932c6d94),
+     W(0x00000000aaa079a0)},
+    {W(0x839fe91947edb103), W(0xe5ed9869cb49c057), W(0x957826c87c1db9f6),
+     W(0x0000000067def815)},
+    0
+  },
+  {
+    {W(0xd59b7d8ed4c1ed93), W(0x46f1b6395f46913f), W(0xe4e5f8ad49548934),
+     W(0x000000005dde7770)},
+    {W(0x509833436de9f132), W(0x6d17fb9f4075721a), W(0x6c3d08627630ce28),
+     W(0x0000000085e34e47)},
+    0
+  },
+  {
+    {W(0xff3aa0785dc180eb), W(0x3c728ba914f620c0), W(0x4b02dbf35e1e8a3b),
+     W(0x00000000c44dac5f)},
+    {W(0x5b860890d3341e2a), W(0xa2e3c32d1f312b1d), W(0x1d3ae20dba7e993b),
+     W(0x00000000fa765311)},
+    0
+  },
+  {
+    {W(0x1369d9cdbab0492c), W(0xfefe5b441ef3048b), W(0xce2e76f13e41b7f4),
+     W(0x0000000019375ab3)},
+    {W(0x66bf4b01c623d9e8), W(0xf7f346997efae661), W(0x0fd63fc864d707df),
+     W(0x00000000a104fdb6)},
+    0
+  },
+  {
+    {W(0xc38921affe24648a), W(0xb8bc1e7fc8391bf0), W(0xab38c6733e2fceff),
+     W(0x00000000773b1f00)},
+    {W(0x77c2d6d8c7066ac5), W(0x86c6ff25bb822177), W(0x68b0f3ff80ef3e6d),
+     W(0x00000000711eeead)},
+    0
+  },
+  {
+    {W(0x155ece1eb5c00e63), W(0xe9b893a5b4d15868), W(0x19acd531a080512a),
+     W(0x000000008302a3c8)},
+    {W(0x87efb80cbc84983b), W(0x9b2b784d344f6ac3), W(0xb24599b639b7ced3),
+     W(0x00000000a90e6fda)},
+    0
+  },
+  {
+    {W(0x0029ba5b1ee0ce6f), W(0x653a44df3405aab6), W(0x7654593c7d7c3256),
+     W(0x00000000fbe944dc)},
+    {W(0x2bf0b6c866d35ce2), W(0x5f0652a32b8e5865), W(0x79427a4cac2e8626),
+     W(0x000000006339e73c)},
+    0
+  },
+  {
+    {W(0xf36b43ff81661023), W(0xb72c70adf740af5c), W(0x202aa368096b964f),
+     W(0x00000000b5a7b353)},
+    {W(0x5a0c837d8d4e44a3), W(0x3583c8e42d7b050f), W(0x5a1c71bbe35193ec),
+     W(0x00000000169a194a)},
+    0
+  },
+  {
+    {W(0x0904e9e30cf1bfa8), W(0xc65736217883849e), W(0x44b408221f954222),
+     W(0x00000000ba47df57)},
+    {W(0xca2606a9d1b022c9), W(0x266bbfa98ae6a241), W(0x9da3aaecc7226091),
+     W(0x000000003904fa70)},
+    0
+  },
+  {
+    {W(0xed3ec1649e30a15c), W(0x28537b2a4128d2fa), W(0xe7969a99167308df),
+     W(0x00000000cea47455)},
+    {W(0xcdab3ee33b07dc0c), W(0x854cc3134ab56443), W(0x2cb40cf64104e89a),
+     W(0x0000000084acb065)},
+    0
+  },
+  {
+    {W(0x1d723466a2dfafac), W(0xf266df1b91fb4b62), W(0x82764b4029f374f1),
+     W(0x00000000e9e0e298)},
+    {W(0xc9d7f7c25e574e56), W(0xaabe5cbe29aa3197), W(0xa53ad821bab7d715),
+     W(0x000000002d9ec9c0)},
+    0
+  },
+  {
+    {W(0xca710079bc619763), W(0xc896c4834c1e7e0f), W(0x152c8e25fd2dc9aa),
+     W(0x00000000de9920f8)},
+    {W(0x40b0ffe49d494f41), W(0x2b9bd4cc96c851af), W(0x617ab05a73b3a117),
+     W(0x00000000cd783b43)},
+    0
+  },
+  {
+    {W(0xa2b09cb7d25c3be5), W(0x559d6b77d00d00ca), W(0xe2276f12c5b5b90d),
+     W(0x00000000cccef198)},
+    {W(0x5c288a3bbae8fe3b), W(0x4e8183cb933bd0c6), W(0xb48da12f3654c738),
+     W(0x0000000023aeb8c0)},
+    0
+  },
+  {
+    {W(0xce235439945bf23d), W(0x645fb5fe0f8c9628), W(0xf5fbce202f4772c5),
+     W(0x00000000d4e08703)},
+    {W(0xde2077523a99ea00), W(0xeb3492e3ce30aa7c), W(0x85791117d0a054b0),
+     W(0x00000000e91b6872)},
+    0
+  },
+  {
+    {W(0xed43033b53e5de61), W(0x7d71aa4cc2ec9482), W(0x4bd0fba907638b40),
+     W(0x000000008269d900)},
+    {W(0x636d3af73996b289), W(0x6a2668c1fa9e76e5), W(0x04b64de488ef3cb1),
+     W(0x000000000efb6b10)},
+    0
+  },
+  {
+    {W(0x981916ac1145efc5), W(0x4377639a1461c907), W(0x012c51125cc3e78f),
+     W(0x000000006e74db4f)},
+    {W(0xae52e12eeea911a6), W(0x9abab8c01ee14468), W(0x5e0fe9b1f0d386c2),
+     W(0x00000000dbc86a8a)},
+    0
+  },
+  {
+    {W(0xb9bbba198698c020), W(0x1dffd47f72a49f4f), W(0x1c84983d5b76f125),
+     W(0x00000000debdbebb)},
+    {W(0x6ed255f0db68f4da), W(0xeb0fb284e7295efa), W(0x7b77469ed170aaff),
+     W(0x00000000a2046412)},
+    0
+  },
+  {
+    {W(0x81bd88236d9bcf69), W(0x49ce1f1f96aa7fdb), W(0x759775d43554b9a1),
+     W(0x000000006fb954d8)},
+    {W(0xfe72ca16721a4273), W(0x6c3097728cd2b949), W(0x48d18a1ed3e42ab4),
+     W(0x000000004ad000c6)},
+    0
+  },
+  {
+    {W(0xb1f8418f94fd341b), W(0x6b7a16e63872b20e), W(0xed83c6552bdce001),
+     W(0x0000000071922f7a)},
+    {W(0x81328ffb2eeabc6e), W(0x8dd7e0b2cd5ad15a), W(0x95bd2526dd4cae6d),
+     W(0x00000000780a1a10)},
+    0
+  },
+  {
+    {W(0x25ac220d252774ba), W(0xfa8650d909256046), W(0x01868d0967f2af9f),
+     W(0x000000009e53753e)},
+    {W(0x53cb587e5de31533), W(0x1c96005f0decfab9), W(0x39d70ee1a8035c45),
+     W(0x000000001d3b8217)},
+    0
+  },
+  {
+    {W(0xe9e5461d6f64d950), W(0x158e259667768525), W(0x5fae4450299b1bd8),
+     W(0x00000000125ed24e)},
+    {W(0x9852b63e280f4d99), W(0x302e818efda9ebaf), W(0xf2fe62c6e8466532),
+     W(0x0000000056ba5148)},
+    0
+  },
+  {
+    {W(0xbf5a8dd0f0739531), W(0x2689a4b70b9463de), W(0xd6b196f6628ee73b),
+     W(0x000000005f07e40c)},
+    {W(0x4686c9e002085d2c), W(0x4f93c76109c19df6), W(0x58dfc763bb7946a7),
+     W(0x00000000089bb3fa)},
+    0
+  },
+  {
+    {W(0x7f03b314cc7cc13b), W(0xe97c8bab52a234dd), W(0xfe2c892861fa7c21),
+     W(0x000000005c4703f3)},
+    {W(0xf96399151b7f7da0), W(0x8f8dda5d1d37e99a), W(0x06fcbd3e63ef5d69),
+     W(0x00000000f013f75f)},
+    0
+  },
+  {
+    {W(0xc4a344e7eee78c8b), W(0x4b433fcd65d5dbd8), W(0xdae05e1579d78e11),
+     W(0x000000004f4d4825)},
+    {W(0x543f1cb5ff740622), W(0xde9ce4921b9b315d), W(0xf4daf521997510c2),
+     W(0x00000000839ac45b)},
+    0
+  },
+  {
+    {W(0x3c0a680ea91bb108), W(0x3999a4dd6c2cc8c8), W(0xbbba49d90773dc20),
+     W(0x000000001cd45e18)},
+    {W(0x74cab14aa538beaf), W(0x7d96df224da32ae5), W(0x4893ad58c0dc4ef1),
+     W(0x0000000023325cbd)},
+    0
+  },
+  {
+    {W(0x7b3ff9144cc92b94), W(0x221a554f25c185f4), W(0x111e539f30e7ad85),
+     W(0x000000000ddf1acd)},
+    {W(0x341455c4957eee74), W(0x2e4204f3ef74554b), W(0xfc76c89944ed857b),
+     W(0x000000006205a4f0)},
+    0
+  },
+  {
+    {W(0x4a75bc2bc9314331), W(0xbcd8da0c6966b82f), W(0x301d4d7709c051ad),
+     W(0x00000000f4851b14)},
+    {W(0xa9654a690b302992), W(0x06ed2792f08844e5), W(0xaa87c09cb2a65e0a),
+     W(0x000000009052e1ce)},
+    0
+  },
+  {
+    {W(0xea00652d33fe8cf0), W(0x9431f843840cd776), W(0x0bed744ff4a38d5b),
+     W(0x000000004d91da5f)},
+    {W(0x67b6acc1631822cb), W(0x8b9dfb04dffb10a2), W(0xdcf883aeda249eff),
+     W(0x00000000faa62e2d)},
+    0
+  },
+  {
+    {W(0x6747e5f48280608e), W(0xc61f36ff0ba0c365), W(0xc37ef7addd5dc4e5),
+     W(0x0000000080921b76)},
+    {W(0xd6a9372327c55042), W(0x1f82997682019c19), W(0xcac488b32cc4bfd1),
+     W(0x000000008b6717a5)},
+    0
+  },
+  {
+    {W(0x47a1e6d0af3efb90), W(0xceabfdb66fc685e2), W(0x6c5a1725e426ca27),
+     W(0x0000000006eec86c)},
+    {W(0x60e103fe58f5d288), W(0x70a1b4da50b794a4), W(0xb3a751b0efd1494c),
+     W(0x00000000fa18b87f)},
+    0
+  },
+  {
+    {W(0x28b294362e28d100), W(0x0647f3c5e7e57c13), W(0xc7a2e34373359b21),
+     W(0x00000000ee8f8475)},
+    {W(0x51f4eedd8a1d98d4), W(0xa31502f3d34e1a4c), W(0x54a703bd1e25b16d),
+     W(0x00000000bd261022)},
+    0
+  },
+  {
+    {W(0xb4606544bd9c1c8e), W(0x65960b065b78104a), W(0xf5a5a0d7afba6ee8),
+     W(0x0000000030b0ae46)},
+    {W(0x47cd0d7eccdb495d), W(0x7dc415d343600dd1), W(0xb4ecc7985d7ac18c),
+     W(0x00000000484af3be)},
+    0
+  },
+  {
+    {W(0x8b01fb434124ecfc), W(0x372d9518b3e08afd), W(0x0d4b59d24e97b806),
+     W(0x0000000065b48a6d)},
+    {W(0x0655596a89fd802c), W(0x4089dbf94af1b29b), W(0x62babb9927b60c36),
+     W(0x00000000b2cbefc2)},
+    0
+  },
+  {
+    {W(0x2d3e082731d301a6), W(0xbdf0c4675eff7253), W(0x385f8eaf1fb2f9db),
+     W(0x00000000cec2ec68)},
+    {W(0x92de87bce6ab423f), W(0x5c29a88d9a66f26e), W(0x238f8a46fc350312),
+     W(0x00000000580b74fc)},
+    0
+  },
+  {
+    {W(0x15c51e7337928cd2), W(0xb9048dcb34e61584), W(0xf36898af7f2e7000),
+     W(0x00000000569e0ea7)},
+    {W(0x9ff314c95e22c630), W(0x418c8a16b7fd52e1), W(0xa165c89b12659956),
+     W(0x00000000079c60db)},
+    0
+  },
+  {
+    {W(0x54dce459f2d06984), W(0xbb2c349aec97da33), W(0x4af7cfe737c9d6d3),
+     W(0x000000002beb410a)},
+    {W(0x1cf5097324feb197), W(0x4bdc050ba7e4b195), W(0x5e78ff4f1105f599),
+     W(0x00000000675b03fd)},
+    0
+  },
+  {
+    {W(0x2065e063f23aa173), W(0xe695946c33b968e5), W(0xb87594841c12b1f4),
+     W(0x000000006c0606dd)},
+    {W(0x1f0b1967deb4d3dc), W(0xb9deea9244b633b0), W(0xecb3d1897b2ea479),
+     W(0x000000001df99a02)},
+    0
+  },
+  {
+    {W(0x54de2206336e7507), W(0xbb2a455eac6bf49c), W(0xaf81e10f8183f690),
+     W(0x00000000c0c030a9)},
+    {W(0x2a4767ab08a1f99d), W(0x560c3b368c34f455), W(0xcea665405b4eaf28),
+     W(0x000000000aca44a3)},
+    0
+  },
+  {
+    {W(0x2da21eda62d12e53), W(0x3d04197f3fd0dd63), W(0xceebef47b3173b8f),
+     W(0x0000000029507784)},
+    {W(0x4cfecadb8ee52105), W(0xa1638ca0edf7c4a1), W(0x56c74de8749abdfc),
+     W(0x000000009d56408e)},
+    0
+  },
+  {
+    {W(0xcfb1d6176cd513af), W(0xd29719449165a7a6), W(0x9dbef4bb0e597982),
+     W(0x00000000ab11452b)},
+    {W(0x0e61ecf563b59408), W(0xc705fe010c66d010), W(0x543893b202ad48bd),
+     W(0x000000005f2ef2cf)},
+    0
+  },
+  {
+    {W(0xe04e715c6ec811b9), W(0x4ba3045b43ee2c83), W(0x1c765fe233534ba9),
+     W(0x000000002443659b)},
+    {W(0x26759e9c04f624ed), W(0x3daf4c80bf53d21e), W(0x85846f6a3a3981d4),
+     W(0x000000005ce28e15)},
+    0
+  },
+  {
+    {W(0xc0f6f3030dafa954), W(0x56af8aa3a7251f2a), W(0x153f556db9528314),
+     W(0x00000000ab1dbd45)},
+    {W(0x226df41d22e0d790), W(0x9ac82674f1466a7b), W(0xff17bafca062dba5),
+     W(0x00000000cacb71c4)},
+    0
+  },
+  {
+    {W(0xdc70a52b6b8ce2e2), W(0x1ae6eb90a3290ac3), W(0x572da03f3d3eb05f),
+     W(0x000000002c8b55e0)},
+    {W(0x8c0bca138ec0865b), W(0x93a1b8fa8aa562ea), W(0xb3e8edda029046be),
+     W(0x0000000082fac51e)},
+    0
+  },
+  {
+    {W(0xd2052974f8242897), W(0x521fb9990be024a4), W(0xcef9b2d5adbd3144),
+     W(0x000000006adaf3c4)},
+    {W(0xc7db250edc945427), W(0xa23aa9049bc8128c), W(0x50b28ba7fa9d66a5),
+     W(0x000000008f56bb5e)},
+    0
+  },
+  {
+    {W(0x283d33dabcd7ea59), W(0xbfc58d924fc887d5), W(0xc72a590132f737f6),
+     W(0x0000000035290b17)},
+    {W(0x47a2271884300d3f), W(0x1944bd235ac72642), W(0xc2cb52574b3aa7e9),
+     W(0x00000000e031b645)},
+    0
+  },
+  {
+    {W(0x073f105571f8b52f), W(0x50c71b84e8f509a5), W(0x895da5cec6d4c024),
+     W(0x000000006f47575c)},
+    {W(0x1549066031dc9d31), W(0xba9a721802967984), W(0x30eb98a0bde05460),
+     W(0x000000006766aa1c)},
+    0
+  },
+  {
+    {W(0x69bc53c5338c6e6e), W(0xb7c8beb5b9afcb2d), W(0x23d189994068efed),
+     W(0x00000000f388dbf8)},
+    {W(0x4373e33159bd81ec), W(0x14b05d0d896063fc), W(0xad7bfeeb46536b5e),
+     W(0x00000000be1df09e)},
+    0
+  },
+  {
+    {W(0xf0754f00891a9a3f), W(0x0648d00dff370fea), W(0xe63c2f26402d0ff8),
+     W(0x0000000043c91011)},
+    {W(0xb10f65efccb8809d), W(0x9e07ad8574c1edfe), W(0xd52f19669dbcf3a4),
+     W(0x0000000044a2858b)},
+    0
+  },
+  {
+    {W(0x1dd25c0273dbf2a3), W(0x54bb2bcb24dc3fcc), W(0x690c9745d6c1a746),
+     W(0x0000000003338a8b)},
+    {W(0x702e8f89cbe8c095), W(0x35f6b6a2423b99ca), W(0x44d1ccb0d2bb5c23),
+     W(0x0000000045b88279)},
+    0
+  },
+  {
+    {W(0xe0819e2de72dfc95), W(0xc47b246b762a04ee), W(0xdcf32874fee0f2f7),
+     W(0x0000000077a6d5a3)},
+    {W(0x52f78a82fd6384ca), W(0x14e2a4f37ab13b86), W(0x5f5c107f3a22511e),
+     W(0x0000000091a546b9)},
+    0
+  },
+  {
+    {W(0xdc872eba351a46ea), W(0x057d0005e98a7cc2), W(0xb4704b518967ce26),
+     W(0x00000000d4c163a8)},
+    {W(0xdbd4854583ef7cf4), W(0x5177820d3298c5b4), W(0x7167b6d257b12780),
+     W(0x0000000082b36a7c)},
+    0
+  },
+  {
+    {W(0x96a49bd85ff21218), W(0x79c1aa3c8d0f15d0), W(0x3f8533b223b17633),
+     W(0x0000000020d1bb87)},
+    {W(0x3753d5be0adb239a), W(0xd8b639f741b8e830), W(0x9ce2c80f10353a70),
+     W(0x00000000d9cd71a7)},
+    0
+  },
+  {
+    {W(0xe941cfe9095163e6), W(0xcda3b78568d3816f), W(0xdda8a9e9746dc042),
+     W(0x00000000da92fc36)},
+    {W(0x90e5e80e53a0c99c), W(0x962aa527299648a3), W(0x7a511bfea7bc0a91),
+     W(0x00000000572c85a3)},
+    0
+  },
+  {
+    {W(0xd897535f7d7fd3f6), W(0x06a71de33e19e3ef), W(0xb199d5315d045dba),
+     W(0x00000000de6add6d)},
+    {W(0xb826d7cf4d33cbd6), W(0x1ddbe3b17f784492), W(0xd46f1e6d55892a89),
+     W(0x0000000033589462)},
+    0
+  },
+  {
+    {W(0x6d19405fa8bba78f), W(0x7e781f6c34c1a1ce), W(0x184a3c6da084846e),
+     W(0x00000000a614b9c7)},
+    {W(0x47ae2bc0a79663d7), W(0x397a970705045bfd), W(0x254ee91dfb33aca6),
+     W(0x000000004b8b7e01)},
+    0
+  },
+  {
+    {W(0xdd92ffc97c3573fb), W(0xec88aa87a26ff51a), W(0xc8d93b5a8b564a1d),
+     W(0x00000000dcfc7f26)},
+    {W(0xbe774524f5965e62), W(0x804a41d094c2b6ce), W(0xe37b541c5d1d5cb1),
+     W(0x000000007d17da77)},
+    0
+  },
+  {
+    {W(0xe187bb37c5213feb), W(0x1f320754878aa501), W(0x5c95d041e0a02ab1),
+     W(0x00000000b243cbdf)},
+    {W(0x979fe6c45e0ec074), W(0x33467c58fb45662b), W(0xa70a40f8d829a708),
+     W(0x0000000041984a1c)},
+    0
+  },
+  {
+    {W(0xdc90d41faaf2f26e), W(0x27180cbc9d230161), W(0x54ae81e1434223f5),
+     W(0x00000000935d263e)},
+    {W(0xc9c0f8a36b0f2dfd), W(0x2bc9e007b4dad54d), W(0xec220d7c80449587),
+     W(0x0000000065de940d)},
+    0
+  },
+  {
+    {W(0x3778a179f230625e), W(0x6e1aa9f57b1b88be), W(0x65185d3f474f9205),
+     W(0x00000000401f8d3a)},
+    {W(0x1b22608c36d38a19), W(0x25b0f6d96ddffa66), W(0x4c9ba194d3fc15e3),
+     W(0x0000000084687f55)},
+    0
+  },
+  {
+    {W(0x275384e68b59a071), W(0xfd08b6d9388bbf24), W(0x53f49569529f4416),
+     W(0x00000000af4bdb1a)},
+    {W(0x7c01997ba56e701c), W(0x9c26bee4ad373a31), W(0xaa61f2c2f7fce744),
+     W(0x00000000aed84b01)},
+    0
+  },
+  {
+    {W(0xf2865fccb81d6064), W(0x8a9f8a568b8cb6b5), W(0xd8700b077c3ec69b),
+     W(0x00000000391ebe69)},
+    {W(0xd5c345313a283f7a), W(0x40f08100d9c3e236), W(0x9b96c88b7e44ba16),
+     W(0x000000008c810be6)},
+    0
+  },
+  {
+    {W(0xb740682e6c15a435), W(0xa6b80ce2f89b66f7), W(0x15a28ad2303e5f26),
+     W(0x00000000eed3b1a5)},
+    {W(0x10de6adf7c195c61), W(0x2ba15febc84da38e), W(0xf76a4bebfa13582e),
+     W(0x00000000adf2c537)},
+    0
+  },
+  {
+    {W(0xd1b65a991bef5535), W(0x57a12a818b3c617b), W(0x3a39201416418074),
+     W(0x00000000a638d4ee)},
+    {W(0x43f5047c09d185a4), W(0xe7453bbf43ab1401), W(0x6ff5b3439264ebd8),
+     W(0x00000000486032fd)},
+    0
+  },
+  {
+    {W(0x599a2a4b35cc1b9f), W(0x625c23ee7023c86f), W(0xe698a7f854916e7f),
+     W(0x00000000bc06d020)},
+    {W(0xb886940b8d9421a0), W(0xd9e9b7cc45a17038), W(0x0d3e68bdd7aed343),
+     W(0x00000000d8128c11)},
+    0
+  },
+  {
+    {W(0x362cff857f4774c3), W(0xdd4ea986369e5b59), W(0x93f2c5376da8dd3c),
+     W(0x0000000083e11ebe)},
+    {W(0xe9200041feb0f9b7), W(0x963dd72c23e25f97), W(0xab3c2101ff120000),
+     W(0x000000000e30b17f)},
+    0
+  },
+  {
+    {W(0x39fef511aae1eab7), W(0x018476a055050491), W(0xa55000962f09145f),
+     W(0x000000006619203e)},
+    {W(0xed0e330c558d14e6), W(0xbf53be3bd96778ea), W(0xe7f4965f4bed80b3),
+     W(0x00000000bb765edf)},
+    0
+  },
+  {
+    {W(0x340e851fc77b891a), W(0x427208f0c409fb59), W(0x40464c3f42f108cf),
+     W(0x00000000fa31ca45)},
+    {W(0x49f662bd211e5d3f), W(0x5871d20b4c66857b), W(0x85d2837339942156),
+     W(0x000000004fa9b376)},
+    0
+  },
+  {
+    {W(0x253f42af2a1ae1df), W(0x6fde42ab3379d95e), W(0x13100dddfc25d825),
+     W(0x0000000053c0da0a)},
+    {W(0x8599cd16969a7d4f), W(0xe2e2ed489a03d85e), W(0xf657e9ed5179ea83),
+     W(0x0000000017d0c80d)},
+    0
+  },
+  {
+    {W(0x776100c2f66bf341), W(0xb93650004bc2dd0c), W(0x0eccd3b5ef937813),
+     W(0x00000000c00113eb)},
+    {W(0x778394dad88dc996), W(0x1ecf7f42ef92775e), W(0x292d943713b4dc29),
+     W(0x0000000051e7f771)},
+    0
+  },
+  {
+    {W(0x0cc678d77c1db907), W(0xc2cbb2bc4219177c), W(0xd99b53cc525c7de8),
+     W(0x00000000103e595f)},
+    {W(0xd657f51e3d676f5a), W(0x49e6ba8decc2856e), W(0xe007e4444eff0aa1),
+     W(0x000000004a142bee)},
+    0
+  },
+  {
+    {W(0x73d78b19e3e31738), W(0xf7096f47f7a1b191), W(0xee7e0dee4a930abc),
+     W(0x00000000b4f231c4)},
+    {W(0xa13f202758ac7108), W(0xa388931fa1e261fb), W(0xa7ec1a1129954165),
+     W(0x000000006d77f99c)},
+    0
+  },
+  {
+    {W(0x54cd6e3fd9cd7981), W(0x0a78ee98896000c9), W(0x90fd2de49a696cd2),
+     W(0x00000000dd701586)},
+    {W(0xcbe38b06e890d8ff), W(0x9420ecf39c79f346), W(0x03a16b64cb771b7e),
+     W(0x000000007eb0ad4b)},
+    0
+  },
+  {
+    {W(0x08d3de46200cf014), W(0x0f09b467dd09da10), W(0x45e54b6c1e82a893),
+     W(0x00000000e5bdb683)},
+    {W(0x38774fcd5f1278fb), W(0xeeb641843b1faf1a), W(0xd353730e19139818),
+     W(0x00000000e10ed5a8)},
+    0
+  },
+  {
+    {W(0x2914c4878f1f280b), W(0x00e8722a73b9468d), W(0x203522e1d1bf0d83),
+     W(0x000000001f4dba6d)},
+    {W(0x3ca51927622e59c6), W(0xd8c656553fd46c6e), W(0x6c3d4a8da3242012),
+     W(0x00000000c2e04eba)},
+    0
+  },
+  {
+    {W(0x3b34d051f54e3d15), W(0xea1623c531513d2e), W(0xf8f46512fab814b1),
+     W(0x0000000001d600d3)},
+    {W(0x94197d7670dfd8c9), W(0x8d831dba900ec478), W(0xa86a92ca8dc4e2b6),
+     W(0x00000000178a6af7)},
+    0
+  },
+  {
+    {W(0xd2a59000bbaa73f5), W(0xd21abc20b47c190e), W(0xcb89f4c8efc066c1),
+     W(0x000000000deb49a3)},
+    {W(0x36bbd370e1e7e127), W(0x44dddc103126c195), W(0x2ee0b26920503ed6),
+     W(0x0000000097579f56)},
+    0
+  },
+  {
+    {W(0x8ecf262528f89da1), W(0xab5e403f6760ce7d), W(0x5b95b709902ec5cb),
+     W(0x00000000dc9cbc0a)},
+    {W(0x90484b97b8265b9e), W(0xdafcb65d058e5430), W(0x24981fba9fcc480d),
+     W(0x000000009089c7ee)},
+    0
+  },
+  {
+    {W(0x78fb29125a930b41), W(0xeaecd374aef172a5), W(0xeb261fc608faa154),
+     W(0x0000000046ef25e9)},
+    {W(0x0f428238a69473de), W(0xba24acf3ab68dab9), W(0x77ed3e551adc96dd),
+     W(0x00000000505ac562)},
+    0
+  },
+  {
+    {W(0x2f3a5850bc82dd9c), W(0xf4ae8419fb0fabb0), W(0x3b7f9bc1a3d6365d),
+     W(0x00000000f6325e48)},
+    {W(0x67d89b3120ba7f50), W(0x00e69115401373aa), W(0xe41591430cda95e2),
+     W(0x00000000643c372c)},
+    0
+  },
+  {
+    {W(0x298bab01a76c4e9f), W(0x022ea9535731435e), W(0xad9f0b5f63f85c60),
+     W(0x00000000ffc2c9b1)},
+    {W(0x55339e1f558b95f3), W(0x35eed1874b9f64b0), W(0x84d5ea3ad643defe),
+     W(0x0000000050e8b6f7)},
+    0
+  },
+  {
+    {W(0xdac0dd02147ff41a), W(0xe2cc3947aa7ee900), W(0xae4eddb86d4eea09),
+     W(0x000000009245c62e)},
+    {W(0xf0fb08fea0bdc17c), W(0x98e0a66064ba0424), W(0xfad5de9f7fa4c420),
+     W(0x0000000031539d7b)},
+    0
+  },
+  {
+    {W(0xbe45834a3f7324cf), W(0x3d52f8cd35decce1), W(0x36a833d040a0e1c1),
+     W(0x00000000f5214805)},
+    {W(0x219b42cd82102761), W(0x63836c302ff18568), W(0xdaa8fb338d48bcf9),
+     W(0x0000000037b99216)},
+    0
+  },
+  {
+    {W(0xc09ad6bd601da44d), W(0x9ddc42f989f2c48c), W(0xc13c76943ae8a9aa),
+     W(0x000000003592da7c)},
+    {W(0xd5215591ec42eef7), W(0xb66e3c78d081709c), W(0x430c4fa9ab0700cb),
+     W(0x000000009c6ae08d)},
+    0
+  },
+  {
+    {W(0x8d1d39c1eb341a69), W(0x5bba4daf3b2e3a6c), W(0xd177f5002df71613),
+     W(0x00000000ee8631ee)},
+    {W(0x50fa275742c0eb80), W(0x3813e359ff11c315), W(0xb777e12b20521f7e),
+     W(0x00000000c4cb2d23)},
+    0
+  },
+  {
+    {W(0x1cf706a765ce0d82), W(0x4dc32aad9f7131fd), W(0xc720a837bb06d4a6),
+     W(0x00000000deb615d1)},
+    {W(0xa30dc8c7ec164c32), W(0x66c6d00b44633888), W(0xa8f2222870022fe6),
+     W(0x000000001a0de00d)},
+    0
+  },
+  {
+    {W(0xdcc711efc629acd6), W(0xa42de3f576e99305), W(0xf205c648a27d430f),
+     W(0x000000001c286fb5)},
+    {W(0x1f3ad54ff3d07a10), W(0x4578db1439c1fae2), W(0x00313fbb3f5a6e33),
+     W(0x000000001cc11a2e)},
+    0
+  },
+  {
+    {W(0x3aafcb566d420f40), W(0xebc4437fe9389456), W(0x08aa5ef6d66fefc4),
+     W(0x00000000288ea23e)},
+    {W(0xadcdb30bb8b13dfa), W(0x60f8429b2156fc26), W(0x60dd2c84e1293bb0),
+     W(0x00000000a4c61002)},
+    0
+  },
+  {
+    {W(0x8ca9434a693d4201), W(0x52c173c284f129cd), W(0xf2be9cb6cd9f8db5),
+     W(0x0000000013280951)},
+    {W(0x6c0e5ee5032a5c28), W(0xb4170798d5956e94), W(0x8408b9f016771c25),
+     W(0x00000000fb453e50)},
+    0
+  },
+  {
+    {W(0xa80121899b2764a5), W(0x919973b9e140aee8), W(0xe782a1be7212e180),
+     W(0x0000000099a50465)},
+    {W(0x4ed8e5af28d7c926), W(0x4130e9d43bf146cc), W(0xd6b90f777278eef1),
+     W(0x000000003dee3b20)},
+    0
+  },
+  {
+    {W(0xa16b533a904a2f24), W(0x9a4530d79ae9b50f), W(0x4067b240490eb6f8),
+     W(0x0000000086b7d5a6)},
+    {W(0xf6bd26e5a5886fe5), W(0xb6c7760cf1fce895), W(0xcf1f67efaae15808),
+     W(0x000000006da1de3a)},
+    0
+  },
+  {
+    {W(0x1a4b55e5979fee74), W(0x77ac43c584e00547), W(0x755baeb796e061d8),
+     W(0x000000008735893d)},
+    {W(0x3e137a82e3850f3c), W(0x788a5eca1cf66d39), W(0x20e187a69d5651de),
+     W(0x000000006513dd3c)},
+    0
+  },
+  {
+    {W(0x5abc873f8394b440), W(0x1ce98c49ce8e53aa), W(0x2bff2cc56285bf91),
+     W(0x00000000f273c034)},
+    {W(0xde00a4ba50c09d97), W(0x8264030b051a375f), W(0x752d94631d86d39b),
+     W(0x00000000fc47dff1)},
+    0
+  },
+  {
+    {W(0x090952ef367c1718), W(0x88afc72e07f6a78e), W(0x4ea3c597d86a5056),
+     W(0x000000002cec01c9)},
+    {W(0x2e51fed58dfb6763), W(0xcb892541cd245385), W(0xd0773437774ca5b6),
+     W(0x00000000b206339d)},
+    0
+  },
+  {
+    {W(0x2c39eb6970bd6988), W(0xb65771ee1a3bf46a), W(0x9291cd251596e9bf),
+     W(0x0000000049a53628)},
+    {W(0xfcc734e4dd55e596), W(0xfe751dcabdbadebf), W(0x634a4c196e4e2243),
+     W(0x0000000067fd10ec)},
+    0
+  },
+  {
+    {W(0xc7b363f6758b7ecf), W(0xff457ff1c0887b68), W(0x73a230fce4881649),
+     W(0x000000001719b5bf)},
+    {W(0xaf886ece6374607d), W(0x3e24d42e410b3e3f), W(0x3e10905206ec4894),
+     W(0x0000000052beeb5a)},
+    0
+  },
+  {
+    {W(0x14bb47aea2343182), W(0x43383155bc5ffe22), W(0xbeb12c71ca9b3823),
+     W(0x00000000d18b32de)},
+    {W(0x4815716ec33fa501), W(0x20b1e1f7ca8047ee), W(0xced7cfe42bf7b29c),
+     W(0x000000007864ba93)},
+    0
+  },
+  {
+    {W(0xce84c53043d6a499), W(0x57741999599f9884), W(0x1002bc7714db45e9),
+     W(0x0000000076ae059f)},
+    {W(0xcb263a377bcf6838), W(0x11bdcdec03b79237), W(0x8400b309fddda886),
+     W(0x000000008648dc3d)},
+    0
+  },
+  {
+    {W(0x05fb65acd450f450), W(0x5c8469373d69cff7), W(0x7dda080f389b805b),
+     W(0x000000000d1685ff)},
+    {W(0x9ad5b6d4e8f16d27), W(0x89d2f170fe6f23b3), W(0x22e209b710cba079),
+     W(0x000000007aecdfa7)},
+    0
+  },
+  {
+    {W(0x8e71350133d67b46), W(0x3bf068ffe9285146), W(0xe0b3a29a4be5b955),
+     W(0x000000007a4f881d)},
+    {W(0x7e04cafa69cce69e), W(0x2903b3076975658e), W(0x887053445b64937b),
+     W(0x0000000021fb3670)},
+    0
+  },
+  {
+    {W(0xce07b81cf334de61), W(0x81d7d0d333363cbf), W(0x28cc60122e2c4cdc),
+     W(0x00000000e33e23c4)},
+    {W(0x6e89d7b8ab38bce7), W(0x2db3241adcd6e9c7), W(0xad6df25b18d7c5c5),
+     W(0x0000000005a560b3)},
+    0
+  },
+  {
+    {W(0x2ae9b6ceef0af801), W(0xaf0b3e3a5ebbaae4), W(0x20505935e1a6ef3b),
+     W(0x000000000fe92af5)},
+    {W(0xd07b3b7c30f2b6a4), W(0x47248c2ffd8a385e), W(0xf62543f295e090c6),
+     W(0x0000000073055be6)},
+    0
+  },
+  {
+    {W(0xa298a7c6f7ee28ed), W(0x6800561adb3a507f), W(0xd9f6dfaeea142f76),
+     W(0x00000000180f5bfa)},
+    {W(0x794022d2987b46da), W(0x0aa912d4850694b8), W(0xc70e6ceb6b6de097),
+     W(0x000000009016e92e)},
+    0
+  },
+  {
+    {W(0x60b2d471f58474ec), W(0x2663f516318e8af2), W(0x5068dad97fdc2599),
+     W(0x00000000a749ed01)},
+    {W(0xafdd2076f1797487), W(0xa76df3cfccdfee1d), W(0xadd41fde59f2ece2),
+     W(0x00000000061cf02a)},
+    0
+  },
+  {
+    {W(0xd12d604d22605564), W(0xdc3ed0a4e47848a3), W(0x9105445cf5f25019),
+     W(0x000000008c1cb3d5)},
+    {W(0x1b4973bc691365d7), W(0xcf7e98e5e8680f27), W(0x19bfa745c16c1d59),
+     W(0x000000000173c0c5)},
+    0
+  },
+  {
+    {W(0x61ed4f26cc27897f), W(0xfe5b8eac0b7fc0a1), W(0x3fbe2b306cff8917),
+     W(0x00000000c8907282)},
+    {W(0xba9dd370d135a85f), W(0x5f90a0c97f44c487), W(0x991bc812ecfaf580),
+     W(0x000000001ae2eff1)},
+    0
+  },
+  {
+    {W(0x481c2a46af569a23), W(0xa5c73c227f5600cc), W(0xab7e91c9dc186a79),
+     W(0x0000000064b82a05)},
+    {W(0x0fb5992ed51c64ff), W(0x5c5e8ea7e2090faa), W(0x95ffedb53c824497),
+     W(0x000000009ecee8e4)},
+    0
+  },
+  {
+    {W(0x6dea24fc20b40b69), W(0x5b3fd94cba87d490), W(0xca78bde2ed1a1778),
+     W(0x000000008ad096af)},
+    {W(0xdd418d2f20315029), W(0x09629e284f02a99e), W(0x2e16ad593d7295d9),
+     W(0x00000000133e1d78)},
+    0
+  },
+  {
+    {W(0x1f36fd68ed02c0ae), W(0x7075b6f788a88dee), W(0xcbc4902df8760fe8),
+     W(0x00000000eb688fc6)},
+    {W(0x00d651fedbb862fb), W(0x86cbef84678dba12), W(0x96d1620b1f615f33),
+     W(0x0000000093122285)},
+    0
+  },
+  {
+    {W(0xd9f991093703f3bb), W(0x55f8f8c55b0eeec0), W(0x9d6ec9a03ab94c8c),
+     W(0x00000000575bc232)},
+    {W(0xf4544f0cbf145951), W(0x6b3c84e1137d4ee3), W(0x5df7660d3ff06e17),
+     W(0x0000000021f8e361)},
+    0
+  },
+  {
+    {W(0x37c7fb1214ecdf5a), W(0x7f4003f5a338764e), W(0x0df7518e7f8efa26),
+     W(0x00000000d8668220)},
+    {W(0xfc05d7ec690fa181), W(0x811e3d98880c58a4), W(0x813e79c31a5077d6),
+     W(0x000000003e4c76d0)},
+    0
+  },
+  {
+    {W(0x9b529c594051950d), W(0x94668b09e779a21e), W(0x6e8f52160481dc07),
+     W(0x00000000ada82b18)},
+    {W(0xdf24836eec435214), W(0xba4bab0f414b6818), W(0x228983c179ae9f07),
+     W(0x000000007a58efb2)},
+    0
+  },
+  {
+    {W(0x1fd40c47fb7c0604), W(0x2969b683e500d2ab), W(0xd2ff71f4c6b13904),
+     W(0x000000001e83755a)},
+    {W(0xf5d623ca2e461a75), W(0x56b94e961fdccdf6), W(0x97ef34423ec9701e),
+     W(0x00000000d6ad3758)},
+    0
+  },
+  {
+    {W(0x1edcbe988980ed86), W(0x65ce757cef2794e9), W(0xfbf428a88a24d70e),
+     W(0x000000006408aae5)},
+    {W(0x4653c149876acf9d), W(0x1bb99560d60e00c1), W(0x6ad5b970f1e2570e),
+     W(0x0000000007114b1f)},
+    0
+  },
+  {
+    {W(0x5a067f8cd3a36d08), W(0xb673c54ecef265ab), W(0x725f2efff4ed8637),
+     W(0x00000000dcace278)},
+    {W(0xa5c47f3abda633a6), W(0xf0aa3b65c260f08f), W(0x25c195f03efaa226),
+     W(0x00000000fdfc6df2)},
+    0
+  },
+  {
+    {W(0x32a34d3ac9c01a8a), W(0x42900944422f2c65), W(0x21b05adb37c80d21),
+     W(0x00000000c8ad15ff)},
+    {W(0xba2d7b080ef299ce), W(0x016684271c7b95fe), W(0x7bc4b4c772baaefb),
+     W(0x000000006d3c3c1c)},
+    0
+  },
+  {
+    {W(0x0e3f82ae06daa1c8), W(0x68b43b991bea6056), W(0xb4ae1e128ef703de),
+     W(0x00000000ad72b66d)},
+    {W(0x6903b204a57c3567), W(0xab82ac0534d2945a), W(0xa88aa5b54f5a37fe),
+     W(0x000000000c01aa2e)},
+    0
+  },
+  {
+    {W(0x6a093838f798e0f8), W(0x4d49a4116dab785c), W(0x987d1a3173775429),
+     W(0x00000000dad1be98)},
+    {W(0xa360b0f7b71f5e10), W(0x26e588196d7ce930), W(0x60f01c366466fcba),
+     W(0x00000000be4191e3)},
+    0
+  },
+  {
+    {W(0x96df4bc560ac0ced), W(0x754aecdd066674c0), W(0xa013cd1c04aa75a9),
+     W(0x000000007403751f)},
+    {W(0x33b67536c47149d8), W(0xe0132263ace1e3a4), W(0x063a2ec6dfa35aa3),
+     W(0x000000004434049f)},
+    0
+  },
+  {
+    {W(0x98e93366250f5f36), W(0xb5c5962f1d4f8dbd), W(0x8524aa5ddedfeb3c),
+     W(0x000000006c22996d)},
+    {W(0xbecd352098446b53), W(0x1ed2c7cf64b5be80), W(0x1d54bc2d0fac33e3),
+     W(0x00000000af74a78d)},
+    0
+  },
+  {
+    {W(0xd25dd992b05efa9d), W(0xf45c2b578be36685), W(0x103629f6d69ea5e0),
+     W(0x00000000d0460b29)},
+    {W(0xe20ff87673bc38c5), W(0xc6686b469356232b), W(0x959ca2198add3506),
+     W(0x00000000456386f9)},
+    0
+  },
+  {
+    {W(0x538e8056a03d4d87), W(0xb238b7cceb055b47), W(0xcd00d92ec6e7a709),
+     W(0x00000000c0b0d557)},
+    {W(0xce01be3b730da748), W(0xbd837e5c21a228b7), W(0x81009b8c3f8dec1f),
+     W(0x000000005916abf6)},
+    0
+  },
+  {
+    {W(0x0bb2b9b1b974fa55), W(0xa66795ffc4b62e54), W(0x4b0ca1db5d76b854),
+     W(0x00000000ff375f25)},
+    {W(0x0383d30acdef0132), W(0x785b36b5eb76aa82), W(0x54a90c3b184b4493),
+     W(0x00000000f942d983)},
+    0
+  },
+  {
+    {W(0x25859b3de8077d23), W(0x789039049975f602), W(0xfccd5d9537341324),
+     W(0x000000007f205e4f)},
+    {W(0x14a367e7d6b16269), W(0x02270964b6f8eae4), W(0x8c7db7481b14d85b),
+     W(0x0000000055c50509)},
+    0
+  },
+  {
+    {W(0x36bd2ae2e92740a2), W(0xb7d544269e4caaf4), W(0x9fefeca516a11bb3),
+     W(0x00000000622c1a1f)},
+    {W(0xa14bae8314885172), W(0x67661af69ab0fe8a), W(0xb83670bd3b83b850),
+     W(0x0000000062de3812)},
+    0
+  },
+  {
+    {W(0x799a53fb70eb00c2), W(0x863ff7481e56b188), W(0x7116abe8f14c791a),
+     W(0x000000007efdaa94)},
+    {W(0x479633f378b3ca41), W(0x6a99b4f1bc49dc45), W(0x5c6a31406630cc7d),
+     W(0x000000008008556f)},
+    0
+  },
+  {
+    {W(0x8473f980b5deacce), W(0x57d963e4925e0499), W(0x9d7ab729f9cd48f8),
+     W(0x00000000e29440c8)},
+    {W(0xbacc4b58d3e39592), W(0x0eb0e21040e15546), W(0x49febd83858c76e6),
+     W(0x0000000080c0bf1a)},
+    0
+  },
+  {
+    {W(0xd258210fe7d9dda3), W(0xb387723980aaa01c), W(0xe8fbcabe8d056b32),
+     W(0x000000006da00d11)},
+    {W(0x0f683f3abd05a58b), W(0x5a2a9c03c6c8b0a0), W(0xcb2f1dd5dde4f6f7),
+     W(0x00000000c465b2fc)},
+    0
+  },
+  {
+    {W(0x174583684d4fec1e), W(0xb6b5d3fcc4951e25), W(0xdc991d71e58c05ae),
+     W(0x00000000d14ea5cf)},
+    {W(0xcc8048b87bebcb28), W(0x8bdbd96cd348d912), W(0xa8b7cefe9c6b24d5),
+     W(0x0000000054247fc6)},
+    0
+  },
+  {
+    {W(0xcae8d638ab531ba8), W(0xcbc9a9d1a521e068), W(0x2de9567ad62cca67),
+     W(0x00000000ed8f529f)},
+    {W(0x7d49c1786755c1c9), W(0xd796e69300578e4b), W(0xcaab67dd31acb313),
+     W(0x000000008f47e947)},
+    0
+  },
+  {
+    {W(0x756eef367095636c), W(0x7ed929eb6db00a05), W(0xb922f349eada1cb0),
+     W(0x000000007f5adc32)},
+    {W(0x9da33295be0136d3), W(0x28c9638aec10eb17), W(0xc452f652952bd2c5),
+     W(0x0000000064494738)},
+    0
+  },
+  {
+    {W(0xe6f1e2403b79f000), W(0xa564658913807c73), W(0x9c6a8db1e714f487),
+     W(0x0000000060cdce1b)},
+    {W(0x9f5b3a6d222681dc), W(0x129d7f5aafae0206), W(0xec31f3be13b048a8),
+     W(0x00000000b19e0871)},
+    0
+  },
+  {
+    {W(0xd28eb95e86def6b4), W(0xc9051dfc1ed1343e), W(0x63f1e2103f29ff34),
+     W(0x00000000db7ebd6d)},
+    {W(0x8f99a97e977d3a00), W(0x3e26c3dde0224c2b), W(0x6cadebf1bba83310),
+     W(0x0000000043030d30)},
+    0
+  },
+  {
+    {W(0xb33d2f0d59d833ef), W(0x3c7e4cc6c114545d), W(0x8ad1d009a0bf5283),
+     W(0x00000000ced1829b)},
+    {W(0x57e2a4fd980e8717), W(0xfab19df6ab42f56f), W(0x41cebb4f0f09d1c1),
+     W(0x00000000322cefd5)},
+    0
+  },
+  {
+    {W(0x2274f029bdafe727), W(0x3467d8bce8bb4a58), W(0x4ccfec8fa2782888),
+     W(0x00000000f417fae8)},
+    {W(0x2eee0272f996c849), W(0x748644b9dfefc675), W(0xb4a65a5b0d88a466),
+     W(0x0000000087247f36)},
+    0
+  },
+  {
+    {W(0x4b7c57fbff3868df), W(0x368f3e512ba7f00f), W(0xb91865e7aa943325),
+     W(0x00000000569e1140)},
+    {W(0xf1a29f79d4fdb7f4), W(0x3b98633a1ca666a4), W(0xb7d6e91bcabdc617),
+     W(0x0000000058c2b920)},
+    0
+  },
+  {
+    {W(0xee2ea63c01f900a3), W(0x665c07ff43a75dd8), W(0x39b3a5d4562c0b83),
+     W(0x00000000d9ca7502)},
+    {W(0x067a2a49559b01c7), W(0xc19eaf0beefaa19c), W(0xf156e0c584a66ab1),
+     W(0x00000000cb57ca7e)},
+    0
+  },
+  {
+    {W(0x544470a4cbc0d84a), W(0x53a137b19cf1d6f9), W(0xb92d4591ff952928),
+     W(0x00000000d4c2d9b0)},
+    {W(0xc15e9ff97696c065), W(0x6cd739aa23429e16), W(0x4811d85696cac1e3),
+     W(0x000000008c02d97e)},
+    0
+  },
+  {
+    {W(0xb5d96eb899bc666f), W(0x74c16bb7b9ca8418), W(0xf5bc635ef254c81c),
+     W(0x00000000c1cf58a1)},
+    {W(0xe32004e84696baab), W(0x37f968a25a8693d2), W(0x692988d71562a75e),
+     W(0x00000000b7119af8)},
+    0
+  },
+  {
+    {W(0xa55ef764dd4eda3b), W(0xe188271ffa8a8083), W(0xae993010ab7a2289),
+     W(0x00000000079bb289)},
+    {W(0xfbd5c1f3ef518753), W(0xb06415b6ec1bc060), W(0xd1184278e9fc731b),
+     W(0x00000000a4e7165d)},
+    0
+  },
+  {
+    {W(0x93df1eaf4f844f28), W(0x0a19abf1bd2992d0), W(0xdb9ac37f4379f962),
+     W(0x00000000638a91df)},
+    {W(0x88434c19a7b9d2dd), W(0x76a58f7b5ff068f0), W(0x9949d5a8a9130c99),
+     W(0x00000000d775444c)},
+    0
+  },
+  {
+    {W(0xf50ffbf170bccaad), W(0x781bcdc3f251b505), W(0x32756bf6edf49a54),
+     W(0x000000009ee3b5b9)},
+    {W(0x1cd64ad18680eb21), W(0xcb5b5b14ff21b514), W(0x4fdd0f7c973cc562),
+     W(0x00000000d9494fca)},
+    0
+  },
+  {
+    {W(0xe1ee15760d04573f), W(0x09c15af9d4ed72fa), W(0xbb085ccbc5501496),
+     W(0x0000000044295b9e)},
+    {W(0xcaa57d2de0d58755), W(0x384eb5696bff9f0c), W(0x6e5deb86fa11953b),
+     W(0x000000006b318891)},
+    0
+  },
+  {
+    {W(0x9e560b7a655562b1), W(0xd6fbed8477b47a81), W(0x2ded7dd24ae21f21),
+     W(0x000000007001ed7f)},
+    {W(0x84ee0561bbbae98d), W(0xf3960359be0825af), W(0xc9a654b1eed91a37),
+     W(0x0000000081c00b15)},
+    0
+  },
+  {
+    {W(0xc75b147a4c588739), W(0x62c1fa9a5552e445), W(0xbfccabcb3318d3f0),
+     W(0x00000000d25d6812)},
+    {W(0xca2db536cce1579b), W(0xb52a9be1e84323af), W(0xe88a1ea2a7338922),
+     W(0x00000000f1a24db4)},
+    0
+  },
+  {
+    {W(0x0d0ba9650fa49320), W(0x7eb470ff487415c9), W(0x77482b5a5d028cd3),
+     W(0x0000000046df0993)},
+    {W(0x3a7bc187df731cde), W(0x4464469a110d2742), W(0x5f43ae09b7a73d8a),
+     W(0x000000008562a612)},
+    0
+  },
+  {
+    {W(0x520a62a9b1913502), W(0x00397e20f6534c3e), W(0x02186f40333d3520),
+     W(0x00000000ca24cd5c)},
+    {W(0xb93d2d3bd8cd1ea2), W(0x6ff5b45c955c9195), W(0x5d6dd8f3ab6edb9c),
+     W(0x0000000023901fad)},
+    0
+  },
+  {
+    {W(0x70943d4b38d80f35), W(0x2f7184e8fdd44653), W(0xfca246e7f52a08d1),
+     W(0x00000000eb114cfe)},
+    {W(0x2aaa43e254e11379), W(0xa94227df657a2f3e), W(0xf51d68ed32e0de21),
+     W(0x000000003ca1277d)},
+    0
+  },
+  {
+    {W(0x38d2e7fd998e4956), W(0x5251be6f093d7efb), W(0xdae98b388b5329ff),
+     W(0x000000009c684477)},
+    {W(0xd8ecf40560e8ca9a), W(0x69ae4d68c4d1390f), W(0x3caf13469dafb824),
+     W(0x000000000892b761)},
+    0
+  },
+  {
+    {W(0xab685b8ca949b791), W(0xce1606966e067df2), W(0xee77d1d8037fa6ea),
+     W(0x0000000005c6c952)},
+    {W(0x471d2bd513d245b3), W(0xa63510c012765411), W(0x74ddd4e54d706bab),
+     W(0x00000000562c454f)},
+    0
+  },
+  {
+    {W(0x99f56f0ff919e7e0), W(0x10b7b9e0612640c1), W(0xb30c8d86afab9b52),
+     W(0x00000000cce5e8e6)},
+    {W(0xc954fc657b06d709), W(0x2ad74dd3f301506a), W(0x903f959543f513d5),
+     W(0x000000006826ee80)},
+    0
+  },
+  {
+    {W(0xb1a19972ae9d558c), W(0xf7d47c502f299406), W(0x1fbac83b049824a3),
+     W(0x0000000021862f8f)},
+    {W(0x8de09d3c2cdff572), W(0x895aee88308113e2), W(0x2c4e926cb3063e1e),
+     W(0x000000005c5a4405)},
+    0
+  },
+  {
+    {W(0x5f5e07eb1ca2ef81), W(0xa2bcb2421a1ae4e1), W(0xf06cc5f126775fa1),
+     W(0x00000000dd60a612)},
+    {W(0xdf2e09226a51b10a), W(0x78c3f12a6e258cc9), W(0xfbb3c7e1eb8b9ebb),
+     W(0x00000000a21a894b)},
+    0
+  },
+  {
+    {W(0x8eaad3e0bbc01244), W(0x1ee54d4a156b975f), W(0x5e6c95786f18100c),
+     W(0x0000000048d8a50d)},
+    {W(0x189e2c2fd32e2ad5), W(0x963e7f9c5ff7f992), W(0x49d352aba2f1c18a),
+     W(0x00000000fb75c2c9)},
+    0
+  },
+  {
+    {W(0xb16f14d3d62c8dec), W(0x7ac9800f8ea7a245), W(0xdf00185acb24073c),
+     W(0x0000000017992ebd)},
+    {W(0xa320b36d01f2c25c), W(0xf92373abee966530), W(0x29be00374bfbe899),
+     W(0x00000000d9c6f66a)},
+    0
+  },
+  {
+    {W(0x06ba4ca2b8f5aa52), W(0x4b1efba6840ad9b9), W(0x7381b005e74aa5c3),
+     W(0x0000000022522dfc)},
+    {W(0x5db1869c33a293b3), W(0xad0b91c8a7f4daac), W(0x8901afe078fd6742),
+     W(0x00000000e04bc33f)},
+    0
+  },
+  {
+    {W(0xc4e83475f5d86631), W(0x579b923430659b02), W(0x1e7fc6f2828a3f30),
+     W(0x000000000ce7c5f6)},
+    {W(0xb08b7f94350bcce1), W(0x98d72ce72823eba5), W(0xac7eb08a9f740e4e),
+     W(0x000000008709489f)},
+    0
+  },
+  {
+    {W(0x9776ed5dbf1c56ea), W(0x018ff70d7a65304e), W(0xd4520c33c116f406),
+     W(0x000000007a8b7d32)},
+    {W(0x12393bcceb859fc1), W(0x0bd9c600be6fd6e6), W(0xb95160e2ac714b16),
+     W(0x00000000fd18e3a3)},
+    0
+  },
+  {
+    {W(0x9bd57ed7927b9df5), W(0xe749e87e08634546), W(0xd90045aa75a4dc83),
+     W(0x000000002c37646b)},
+    {W(0x124ea2979489659e), W(0xa606e2296f503f94), W(0x8706a00241e22705),
+     W(0x0000000039e96b77)},
+    0
+  },
+  {
+    {W(0x0fc063c7f5d35a7f), W(0x443de3fe131c7869), W(0x69218eb6d2e77406),
+     W(0x00000000ab9cb51a)},
+    {W(0xdd84e7afe3072381), W(0x9b91cc89c04d5554), W(0xdac569dd8659f4f8),
+     W(0x00000000c6a7a2c2)},
+    0
+  },
+  {
+    {W(0x5580437dc4d7674a), W(0x4a94f769d94bad6a), W(0xe44f0c790d1c0f54),
+     W(0x00000000d1f2cb85)},
+    {W(0x21b3e06175de80f3), W(0x70c1e738dc1a78c6), W(0x8831f3c6c36f6061),
+     W(0x0000000047a5938e)},
+    0
+  },
+  {
+    {W(0x4642c20ef9f1f974), W(0xf9fa662480492a48), W(0x54986fba8b604033),
+     W(0x000000008d7ff3bd)},
+    {W(0x7c83d6aa5f7563a0), W(0x39b1cb36e58267c5), W(0xe01b539653164bf1),
+     W(0x000000006639b41d)},
+    0
+  },
+  {
+    {W(0x217178b6ee24a251), W(0x794032f1e2cf509a), W(0x4a4426010b87613e),
+     W(0x000000005f033e4f)},
+    {W(0xc40c2f39a9945c5f), W(0x51c16b01f7b3781f), W(0xdd40b4112f636217),
+     W(0x0000000053047804)},
+    0
+  },
+  {
+    {W(0x1fb38a98a4f4c0f0), W(0x5643c8af9acce61b), W(0x619f2daef882ea72),
+     W(0x00000000187fa3ca)},
+    {W(0x10a95bf71513c4fb), W(0x501e256dddecbbcc), W(0x0b4f52238379dce0),
+     W(0x0000000098435062)},
+    0
+  },
+  {
+    {W(0x7f011b23f4a98fa6), W(0x8554d39f8df90bc2), W(0x53ef5360a89fc9dd),
+     W(0x0000000039d5c04b)},
+    {W(0x0b0a7a29634ea7d8), W(0xa5b67aa8b03878d8), W(0x32116ef805ca55a5),
+     W(0x00000000f98b11e6)},
+    0
+  },
+  {
+    {W(0x6afb6a5c966f143c), W(0x26655733287a1471), W(0x64625d60f19c516e),
+     W(0x000000007a106822)},
+    {W(0xc5affdb2bbb4d96f), W(0xa188808df404bcc2), W(0xba64c63f22214660),
+     W(0x00000000531a1b4e)},
+    0
+  },
+  {
+    {W(0xb0e26eca92e3ac40), W(0x9ddc1b52908f47fd), W(0xa06a8034fae60044),
+     W(0x00000000b548ad77)},
+    {W(0x199fb96b37288242), W(0x8edb361476346808), W(0xb2b0bceb66b90a88),
+     W(0x00000000b90d54b3)},
+    0
+  },
+  {
+    {W(0xd09770f3204a0bf4), W(0x604a5b702c41c58b), W(0x9de7e8caa5a976eb),
+     W(0x0000000050a65325)},
+    {W(0xb05ba282de44f099), W(0x41811a188e73765d), W(0x500084efeae73153),
+     W(0x000000005e7443f9)},
+    0
+  },
+  {
+    {W(0x41cfcbe5fc26f3e7), W(0x888383862977d1e0), W(0x94e7e324b587c9fd),
+     W(0x00000000cdd897b8)},
+    {W(0x20a5886e0aeac408), W(0x7adf4221786c4276), W(0x3579d8a13308044c),
+     W(0x0000000070916459)},
+    0
+  },
+  {
+    {W(0xe697213322a83794), W(0xbba2253066baea49), W(0xa96b65318609b8f9),
+     W(0x00000000f6f524bb)},
+    {W(0xa4db7aa2af2c5142), W(0x78725de72f66c91b), W(0xd165ff05a2991bac),
+     W(0x000000005e2fcc62)},
+    0
+  },
+  {
+    {W(0xdc79b916c26ffc89), W(0xb7c444296f46312d), W(0x39ed779ec1a2d726),
+     W(0x00000000d3e337df)},
+    {W(0x1b2c7481b4623fcc), W(0x3a279874036680b7), W(0xe0888354ac2bec30),
+     W(0x000000007bfb6467)},
+    0
+  },
+  {
+    {W(0x1a060c2aefc014cb), W(0x53f6316582cdcf81), W(0x326d20046408c562),
+     W(0x00000000f045798d)},
+    {W(0x6a3862fe40d31155), W(0x243c0f08134a8fab), W(0x45c76d51f29ef27e),
+     W(0x000000001a3344c2)},
+    0
+  },
+  {
+    {W(0xb01b8ef4d16bb992), W(0xcb62b5c80e5d9e50), W(0x15d662b527d9de31),
+     W(0x000000008b7962ef)},
+    {W(0x206bf69de1af3642), W(0x2de5c8d743f8b60e), W(0x8107e63985c5178d),
+     W(0x0000000082da17fe)},
+    0
+  },
+  {
+    {W(0xfd53a76ddd9efdc9), W(0x8edd26c6240eb2be), W(0xf09129e427b61b89),
+     W(0x00000000e06e9834)},
+    {W(0x5c2b27a18084e117), W(0x6a1a1967f51d2529), W(0xf8be2f13f512a316),
+     W(0x000000000643048c)},
+    0
+  },
+  {
+    {W(0xc407365bb7768412), W(0x44a4ae7b377eb12d), W(0x65dcb0729378f5b2),
+     W(0x000000008fdca1ff)},
+    {W(0x0f6d65349769bcf1), W(0xad716776485f203a), W(0xb4da94aa68bca5c6),
+     W(0x0000000085a5f5c4)},
+    0
+  }
+};
+
+static const wei_tables_t tables_p224 = {
+  p224_wnd_fixed,
+  p224_wnd_naf,
+  NULL
+};
+
+#undef W
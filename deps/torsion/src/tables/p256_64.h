@@ -0,0 +1,14227 @@
+/* Autogenerated: scripts/gen-tables.c p256 */
+/* machine_wordsize = 64 */
+/* fixed window = 4, naf window = 12 */
+
+#define W UINT64_C
+
+static const wge_t p256_wnd_fixed[1024] = {
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x79e730d418a9143c), W(0x75ba95fc5fedb601), W(0x79fb732b77622510),
+     W(0x18905f76a53755c6)},
+    {W(0xddf25357ce95560a), W(0x8b4ab8e4ba19e45c), W(0xd2e88688dd21f325),
+     W(0x8571ff1825885d85)},
+    0
+  },
+  {
+    {W(0x850046d410ddd64d), W(0xaa6ae3c1a433827d), W(0x732205038d1490d9),
+     W(0xf6bb32e43dcf3a3b)},
+    {W(0x2f3648d361bee1a5), W(0x152cd7cbeb236ff8), W(0x19a8fb0e92042dbe),
+     W(0x78c577510a5b8a3b)},
+    0
+  },
+  {
+    {W(0xffac3f904eebc127), W(0xb027f84a087d81fb), W(0x66ad77dd87cbbc98),
+     W(0x26936a3fb6ff747e)},
+    {W(0xb04c5c1fc983a7eb), W(0x583e47ad0861fe1a), W(0x788208311a2ee98e),
+     W(0xd5f06a29e587cc07)},
+    0
+  },
+  {
+    {W(0x74b0b50d46918dcc), W(0x4650a6edc623c173), W(0x0cdaacace8100af2),
+     W(0x577362f541b0176b)},
+    {W(0x2d96f24ce4cbaba6), W(0x17628471fad6f447), W(0x6b6c36dee5ddd22e),
+     W(0x84b14c394c5ab863)},
+    0
+  },
+  {
+    {W(0xbe1b8aaec45c61f5), W(0x90ec649a94b9537d), W(0x941cb5aad076c20c),
+     W(0xc9079605890523c8)},
+    {W(0xeb309b4ae7ba4f10), W(0x73c568efe5eb882b), W(0x3540a9877e7a1f68),
+     W(0x73a076bb2dd1e916)},
+    0
+  },
+  {
+    {W(0x403947373e77664a), W(0x55ae744f346cee3e), W(0xd50a961a5b17a3ad),
+     W(0x13074b5954213673)},
+    {W(0x93d36220d377e44b), W(0x299c2b53adff14b5), W(0xf424d44cef639f11),
+     W(0xa4c9916d4a07f75f)},
+    0
+  },
+  {
+    {W(0x0746354ea0173b4f), W(0x2bd20213d23c00f7), W(0xf43eaab50c23bb08),
+     W(0x13ba5119c3123e03)},
+    {W(0x2847d0303f5b9d4d), W(0x6742f2f25da67bdd), W(0xef933bdc77c94195),
+     W(0xeaedd9156e240867)},
+    0
+  },
+  {
+    {W(0x27f14cd19499a78f), W(0x462ab5c56f9b3455), W(0x8f90f02af02cfc6b),
+     W(0xb763891eb265230d)},
+    {W(0xf59da3a9532d4977), W(0x21e3327dcf9eba15), W(0x123c7b84be60bbf0),
+     W(0x56ec12f27706df76)},
+    0
+  },
+  {
+    {W(0x75c96e8f264e20e8), W(0xabe6bfed59a7a841), W(0x2cc09c0444c8eb00),
+     W(0xe05b3080f0c4e16b)},
+    {W(0x1eb7777aa45f3314), W(0x56af7bedce5d45e3), W(0x2b6e019a88b12f1a),
+     W(0x086659cdfd835f9b)},
+    0
+  },
+  {
+    {W(0x2c18dbd19dc21ec8), W(0x98f9868a0fcf8139), W(0x737d2cd648250b49),
+     W(0xcc61c94724b3428f)},
+    {W(0x0c2b407880dd9e76), W(0xc43a8991383fbe08), W(0x5f7d2d65779be5d2),
+     W(0x78719a54eb3b4ab5)},
+    0
+  },
+  {
+    {W(0xea7d260a6245e404), W(0x9de407956e7fdfe0), W(0x1ff3a4158dac1ab5),
+     W(0x3e7090f1649c9073)},
+    {W(0x1a7685612b944e88), W(0x250f939ee57f61c8), W(0x0c0daa891ead643d),
+     W(0x68930023e125b88e)},
+    0
+  },
+  {
+    {W(0x04b71aa7d2697768), W(0xabdedef5ca345a33), W(0x2409d29dee37385e),
+     W(0x4ee1df77cb83e156)},
+    {W(0x0cac12d91cbb5b43), W(0x170ed2f6ca895637), W(0x28228cfa8ade6d66),
+     W(0x7ff57c9553238aca)},
+    0
+  },
+  {
+    {W(0xccc425634b2ed709), W(0x0e356769856fd30d), W(0xbcbcd43f559e9811),
+     W(0x738477ac5395b759)},
+    {W(0x35752b90c00ee17f), W(0x68748390742ed2e3), W(0x7cd06422bd1f5bc1),
+     W(0xfbc08769c9e7b797)},
+    0
+  },
+  {
+    {W(0xa242a35bb0cf664a), W(0x126e48f77f9707e3), W(0x1717bf54c6832660),
+     W(0xfaae7332fd12c72e)},
+    {W(0x27b52db7995d586b), W(0xbe29569e832237c2), W(0xe8e4193e2a65e7db),
+     W(0x152706dc2eaa1bbb)},
+    0
+  },
+  {
+    {W(0x72bcd8b7bc60055b), W(0x03cc23ee56e27e4b), W(0xee337424e4819370),
+     W(0xe2aa0e430ad3da09)},
+    {W(0x40b8524f6383c45d), W(0xd766355442a41b25), W(0x64efa6de778a4797),
+     W(0x2042170a7079adf4)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x808b0b650bc6fb80), W(0x5882e0753ffe2e6b), W(0xd5ef2f7c2c83f549),
+     W(0x54d63c809103b723)},
+    {W(0xf2f11bd652a23f9b), W(0x3670c3194b0b6587), W(0x55c4623bb1580e9e),
+     W(0x64edf7b201efe220)},
+    0
+  },
+  {
+    {W(0xd8c5fccfc5e3a3d8), W(0xbefd904c4079dfbf), W(0xbc6d6a58fead0197),
+     W(0x39227077695532a4)},
+    {W(0x09e23e6ddbef42f5), W(0x7e449b64480a9908), W(0x7b969c1aad9a2e40),
+     W(0x6231d7929591c2a4)},
+    0
+  },
+  {
+    {W(0x6b34413077adc612), W(0xa7496529bbd803a0), W(0x1a1baaa76d8805bd),
+     W(0xc8403902470343ad)},
+    {W(0x39f59f66175adff1), W(0x0b26d7fbb7d8c5b7), W(0xa875f5ce529d75e3),
+     W(0x85efc7e941325cc2)},
+    0
+  },
+  {
+    {W(0xdb6d96f305968b80), W(0x380a0913089f73b9), W(0x7da70b83c2c61e01),
+     W(0x95fb8394569b38c7)},
+    {W(0x9a3c651280edfe2f), W(0x8f726bb98faeaf82), W(0x8010a4a078424bf8),
+     W(0x296720440e844970)},
+    0
+  },
+  {
+    {W(0x492bdc0752b3e584), W(0x35ff9aa8b5f86a2c), W(0x2074213db27de573),
+     W(0xc0bfffc45263832a)},
+    {W(0x2429c22a1d49c605), W(0x1b037d75b320ebfb), W(0x52b6a1739220f428),
+     W(0x2995919ca4cd2660)},
+    0
+  },
+  {
+    {W(0x802b8d2333e12b70), W(0x6d490a4b19dd329b), W(0x14f356cc6abc354d),
+     W(0x11eddf7fd0a0da0d)},
+    {W(0x1e208328d87fd1d8), W(0xfd2f4f8cfd025813), W(0x03b48cc47c29bca2),
+     W(0x3f2a78b3241a2b71)},
+    0
+  },
+  {
+    {W(0x6a9505760a99cbca), W(0x94e258f604a428f2), W(0x45ab5a4d7832ba0c),
+     W(0x71704d008938c167)},
+    {W(0xdb97ab0ef88b8b70), W(0x56feb92ec00eb207), W(0xe70352687d367d80),
+     W(0x65000c24c7973a41)},
+    0
+  },
+  {
+    {W(0x63c5cb817a2ad62a), W(0x7ef2b6b9ac62ff54), W(0x3749bba4b3ad9db5),
+     W(0xad311f2c46d5a617)},
+    {W(0xb77a8087c2ff3b6d), W(0xb46feaf3367834ff), W(0xf8aa266d75d6b138),
+     W(0xfa38d320ec008188)},
+    0
+  },
+  {
+    {W(0x11ba0b8158654feb), W(0x83d0c099c40973c6), W(0x4abb178bc0af37ce),
+     W(0x18b621e8bd1662ab)},
+    {W(0x77f15c29db878b55), W(0x8716f0781bc0b40f), W(0x475f05075a27182c),
+     W(0xc039bab46c77b89e)},
+    0
+  },
+  {
+    {W(0xc04afa1ae3451a09), W(0x7cc69103bc117423), W(0x876be3aa51cf56ee),
+     W(0xe7577d57ad844a25)},
+    {W(0x266fed8cdb77f341), W(0xcfa258dc23ae4a2a), W(0x53a7a98cda782760),
+     W(0x04b48868ceaf7d4a)},
+    0
+  },
+  {
+    {W(0x414d3313d5c74b93), W(0xf14256ecdb6d9a91), W(0x3e4fcab843f2c9ec),
+     W(0x14f4959822ba1d4f)},
+    {W(0xbbf13474afa4716d), W(0xd23899e041976280), W(0x8afc38541c794fa1),
+     W(0x4c298b97e78b6e92)},
+    0
+  },
+  {
+    {W(0xc0f2affc4e6916c6), W(0x6fb94957811842da), W(0x6034bcb624b4d157),
+     W(0xde2efdc7992efb90)},
+    {W(0xd66f7eceac793c87), W(0x02f026267dc6fdcd), W(0x90d3235c9aa1c501),
+     W(0xf6e494962b4666f0)},
+    0
+  },
+  {
+    {W(0x9b6130a2fd52ced4), W(0x9bc0b8b65d50773e), W(0xdd08f94f9bfcc8db),
+     W(0xdd33197ced190168)},
+    {W(0x3062b5c707f21414), W(0x7244234e19839ddb), W(0x630f6ad89877267c),
+     W(0xb283ddcdc868a7d3)},
+    0
+  },
+  {
+    {W(0x082736d19c0859c3), W(0x89ea5516b269386a), W(0xf25071871aa87b33),
+     W(0xe9d82f5f704e8236)},
+    {W(0x7834612442e855f5), W(0x209f50fe395e00d8), W(0xcd9e03aae6e7e62b),
+     W(0xb4b4959e5e5be37b)},
+    0
+  },
+  {
+    {W(0x85cc1158d295a458), W(0x52625915a81821f7), W(0xeae65a00dabf3d08),
+     W(0x8567e0492d2db6d9)},
+    {W(0xf6c9d65b3565303b), W(0x3928349ba7cb419f), W(0x4aa7cd7a1275714c),
+     W(0x921ef60bec0fdcda)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x486d8ffa696946fc), W(0x50fbc6d8b9cba56d), W(0x7e3d423e90f35a15),
+     W(0x7c3da195c0dd962c)},
+    {W(0xe673fdb03cfd5d8b), W(0x0704b7c2889dfca5), W(0xf6ce581ff52305aa),
+     W(0x399d49eb914d5e53)},
+    0
+  },
+  {
+    {W(0x44e3811039949296), W(0x5b63827b361db1b5), W(0x3e5323ed206eaff5),
+     W(0x942370d2c21f4290)},
+    {W(0xf2caaf2ee0d985a1), W(0x192cc64b7239846d), W(0x7c0b8f47ae6312f8),
+     W(0x7dc61f9196620108)},
+    0
+  },
+  {
+    {W(0x35d6a53eed4c3717), W(0x9f8240cf3d0ed2a3), W(0x8c0d4d05e5543aa5),
+     W(0x45d5bbfbdd33b4b4)},
+    {W(0xfa04cc73137fd28e), W(0x862ac6efc73b3ffd), W(0x403ff9f531f51ef2),
+     W(0x34d5e0fcbc73f5a2)},
+    0
+  },
+  {
+    {W(0x4f7081e144cc3add), W(0xd5ffa1d687be82cf), W(0x89890b6c0edd6472),
+     W(0xada26e1a3ed17863)},
+    {W(0x276f271563483caa), W(0xe6924cd92f6077fd), W(0x05a7fe980a466e3c),
+     W(0xf1c794b0b1902d1f)},
+    0
+  },
+  {
+    {W(0x33b2385c08369a90), W(0x2990c59b190eb4f8), W(0x819a6145c68eac80),
+     W(0x7a786d622ec4a014)},
+    {W(0x33faadbe20ac3a8d), W(0x31a217815aba2d30), W(0x209d2742dba4f565),
+     W(0xdb2ce9e355aa0fbb)},
+    0
+  },
+  {
+    {W(0xb3156bf38bd7aff1), W(0x1b5ee4cb1d81b146), W(0x7ba1ac41d628a915),
+     W(0x8f3a8f9cfd89699e)},
+    {W(0x7329b9c9a0748be7), W(0x1d391c95a92e621f), W(0xe51e6b214d10a837),
+     W(0xd255f53a4947b435)},
+    0
+  },
+  {
+    {W(0x0c4a58d474a86108), W(0xf8048a8fee4c5d90), W(0xe3c7c924e86d4c80),
+     W(0x28c889de056a1e60)},
+    {W(0x57e2662eb214a040), W(0xe8c48e9837e10347), W(0x8774286280ac748a),
+     W(0xf1c24022186b06f2)},
+    0
+  },
+  {
+    {W(0x3d2b24b9eb7926b8), W(0xbff88cb3cdbe5509), W(0xd0f399afe4dd640b),
+     W(0x3c5fe1302f76ed45)},
+    {W(0x6f3562f43764fb3d), W(0x7b5af3183151b62d), W(0xd5bd0bc7d79ce5f3),
+     W(0xfdaf6b20ec66890f)},
+    0
+  },
+  {
+    {W(0xe8cbf1e5d5923359), W(0xdb0cea9d539b9fb0), W(0x0c5b34cf49859b98),
+     W(0x5e583c56a4403cc6)},
+    {W(0x11fc1a2dd48185b7), W(0xc93fbc7e6e521787), W(0x47e7a05805105b8b),
+     W(0x7b4d4d58db8260c8)},
+    0
+  },
+  {
+    {W(0xb31bd6136339c083), W(0x39ff8155dfb64701), W(0x7c3388d2e29604ab),
+     W(0x1e19084ba6b10442)},
+    {W(0x17cf54c0eccd47ef), W(0x896933854a5dfb30), W(0x69d023fb47daf9f6),
+     W(0x9222840b7d91d959)},
+    0
+  },
+  {
+    {W(0xc510610939842194), W(0xb7e2353e49d05295), W(0xfc8c1d5cefb42ee0),
+     W(0xe04884eb08ce811c)},
+    {W(0xf1f75d817419f40e), W(0x5b0ac162a995c241), W(0x120921bbc4c55646),
+     W(0x713520c28d33cf97)},
+    0
+  },
+  {
+    {W(0x32027fe891e5d7d3), W(0xf14b7d1773a07678), W(0xf88497b3c0dfdd61),
+     W(0xf7c2eec02a8c4f48)},
+    {W(0xaa5573f43756e621), W(0xc013a2401825b948), W(0x1c03b34563878572),
+     W(0xa0472bea653a4184)},
+    0
+  },
+  {
+    {W(0x41d04ee21726931a), W(0x0bbbb2c83660ecfd), W(0xa6ef6de524818e18),
+     W(0xe421cc51e7d57887)},
+    {W(0xf127d208bea87be6), W(0x16a475d3b1cdd682), W(0x9db1b684439b63f7),
+     W(0x5359b3dbf0f113b6)},
+    0
+  },
+  {
+    {W(0x7b32d69bd4eff2d7), W(0x88ae67714288b60f), W(0x159461b437a1e723),
+     W(0x1f3d4789570aae8c)},
+    {W(0x869118c07f9871da), W(0x35fbda78f635e278), W(0x738f3641e1541dac),
+     W(0x6794b13ac0dae45f)},
+    0
+  },
+  {
+    {W(0x3a5c752edcc18770), W(0x4baf1f2f8825c3a5), W(0xebd63f7421b153ed),
+     W(0xa2383e47b2f64723)},
+    {W(0xe7bf620a2646d19a), W(0x56cb44ec03c83ffd), W(0xaf7267c94f6be9f1),
+     W(0x8b2dfd7bc06bb5e9)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6772b0e5ab4b35a2), W(0x1d8b6001f5eeaacf), W(0x728f7ce4795b9580),
+     W(0x4a20ed2a41fb81da)},
+    {W(0x9f685cd44fec01e6), W(0x3ed7ddcca7ff50ad), W(0x460fd2640c2d97fd),
+     W(0x3a241426eb82f4f9)},
+    0
+  },
+  {
+    {W(0x80009862d5d721d5), W(0x0c3357a35bd3a182), W(0x27f3a83b7aa2cda4),
+     W(0xb58ae74ef6f83085)},
+    {W(0x2a911a812e6dad6b), W(0xde286051f43d6c5b), W(0x4bdccc41f996c4d8),
+     W(0xe7312ec00ae1e24e)},
+    0
+  },
+  {
+    {W(0x6faf68feaae6ee70), W(0x78f4cc155602b0c9), W(0x7e3321a86e94052a),
+     W(0x2fb3a0d6734d5d80)},
+    {W(0xf3b98f3bb25a43ba), W(0x30bf803119ee2951), W(0x7ffee43321b0612a),
+     W(0x12f775e42eb821d0)},
+    0
+  },
+  {
+    {W(0xf8d112e76e6485b3), W(0x4d3e24db771c52f8), W(0x48e3ee41684a2f6d),
+     W(0x7161957d21d95551)},
+    {W(0x19631283cdb12a6c), W(0xbf3fa8822e50e164), W(0xf6254b633166cc73),
+     W(0x3aefa7aeaee8cc38)},
+    0
+  },
+  {
+    {W(0x46f7008037a929a9), W(0x65601a8e19fec6bd), W(0x537f5edc12ab8b62),
+     W(0xe497cd955e5990cf)},
+    {W(0x2fcd387f9aa5b2f9), W(0xe5faa3ff67b78fe8), W(0x1bcf538d295d5e30),
+     W(0x3a573239a813a7ec)},
+    0
+  },
+  {
+    {W(0xe9f5286bd17c2409), W(0x2c4e479363264d9b), W(0x177042b117f6880f),
+     W(0x39b7e2c84ce1ee43)},
+    {W(0xcec8e722d096f4a9), W(0x6861aecbbed5e697), W(0xc2d153f06c231911),
+     W(0xcc2f42b82890537a)},
+    0
+  },
+  {
+    {W(0x33e2cb51d0a917b4), W(0xc2cfa3f34899f931), W(0xb2c94f4be9a2f6b6),
+     W(0x9707b1817ca162b7)},
+    {W(0xb602a172d5f8b10d), W(0xfd3078354fd4542a), W(0xeef226dddd996992),
+     W(0x221fa989eb0a15e1)},
+    0
+  },
+  {
+    {W(0x79b0fe623b36f9fd), W(0x26543b23fde19fc0), W(0x136e64a0958482ef),
+     W(0x23f637719b095825)},
+    {W(0x14cfd596b6a1142e), W(0x5ea6aac6335aac0b), W(0x86a0e8bdf3081dd5),
+     W(0x5fb89d79003dc12a)},
+    0
+  },
+  {
+    {W(0x73628677de1132a3), W(0x75127e642fa88847), W(0x192f7a305b49e660),
+     W(0x1a063cfe11436aa9)},
+    {W(0x720014574b710189), W(0xfaa946de2a57378d), W(0x5c495c63191c3066),
+     W(0x2b4b7e656b7db4db)},
+    0
+  },
+  {
+    {W(0xa4e3d27ad0630413), W(0x5770e38219fa56eb), W(0x4465cf7a754c0666),
+     W(0xfe9161d26169c5f3)},
+    {W(0x5df62722dc0ee348), W(0x9cc6596a29890454), W(0xf043d6189f5d322a),
+     W(0xb4ce957a181ee3e9)},
+    0
+  },
+  {
+    {W(0x08190a49fe5c62ed), W(0x2c57543d3691183d), W(0x75ee318ba9044823),
+     W(0xd20ce09eaef28f58)},
+    {W(0x10613d50848a4a66), W(0x4b98a1a89fcf2efb), W(0x415f1ed998fc6427),
+     W(0x086abb56e3852b50)},
+    0
+  },
+  {
+    {W(0xf615c33af72e34d4), W(0x0bd9ea40110eec35), W(0x1c12bc5bc1dea34e),
+     W(0x686584c949ae4699)},
+    {W(0x13ad95d38c97b942), W(0x4609561a4e5c7562), W(0x9e94a4aef2737f89),
+     W(0xf57594c6371c78b6)},
+    0
+  },
+  {
+    {W(0x5a768cd919eda9de), W(0x6e3206f48e2a51d2), W(0xd356e8c08678a3ef),
+     W(0x93f8d36d543f91c9)},
+    {W(0xfef231f4a4086743), W(0x4d379a119148c6c9), W(0x00b5581ddc8232ce),
+     W(0xa67a72efd702214b)},
+    0
+  },
+  {
+    {W(0x6145a9f617b4e892), W(0xfe6402275f229ff1), W(0x6db03ea8dc046ba3),
+     W(0x71c873d60351dacc)},
+    {W(0x4baee337c2947b5b), W(0x900885c7b08b4380), W(0x1f1ea661c84579b9),
+     W(0xccddbb93a5017818)},
+    0
+  },
+  {
+    {W(0x554d883dcf9fb480), W(0x76ca71c50dfb9a4d), W(0xc251142be04240ea),
+     W(0x899ba63dfa7afc99)},
+    {W(0xed945b129fbbcda3), W(0x3c4dd528a299a4cc), W(0x68e8b6098a63c092),
+     W(0xecf50a6c3f40621b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0f0165fce3779ee3), W(0xe00e7f9dbd495d9e), W(0x1fa4efa220284e7a),
+     W(0x4564bade47ac6219)},
+    {W(0x90e6312ac4708e8e), W(0x4f5725fba71e9adf), W(0xe95f55ae3d684b9f),
+     W(0x47f7ccb11e94b415)},
+    0
+  },
+  {
+    {W(0x3617890361a341c1), W(0x3604dc600cfd6142), W(0x022295eb8533316c),
+     W(0x3dbde4ac44af2922)},
+    {W(0x898afc5d1c7eef69), W(0x58896805d14f4fa1), W(0x05002160203c21ca),
+     W(0x6f0d1f3040ef730b)},
+    0
+  },
+  {
+    {W(0xbd9b8b1dbe7a2af3), W(0xec51caa94fb74a72), W(0xb9937a4b63879697),
+     W(0x7c9a9d20ec2687d5)},
+    {W(0x1773e44f6ef5f014), W(0x8abcf412e90c6900), W(0x387bd0228142161e),
+     W(0x50393755fcb6ff2a)},
+    0
+  },
+  {
+    {W(0xfabf770977f7195a), W(0x8ec86167adeb838f), W(0xea1285a8bb4f012d),
+     W(0xd68835039a3eab3f)},
+    {W(0xee5d24f8309004c2), W(0xa96e4b7613ffe95e), W(0x0cdffe12bd223ea4),
+     W(0x8f5c2ee5b6739a53)},
+    0
+  },
+  {
+    {W(0x3d61333959145a65), W(0xcd9bc368fa406337), W(0x82d11be32d8a52a0),
+     W(0xf6877b2797a1c590)},
+    {W(0x837a819bf5cbdb25), W(0x2a4fd1d8de090249), W(0x622a7de774990e5f),
+     W(0x840fa5a07945511b)},
+    0
+  },
+  {
+    {W(0xe58e90b36b0cf82e), W(0x6438d2462615b5e7), W(0x07b1f8fc669c145a),
+     W(0xb0d8b2da36f1e1cb)},
+    {W(0x54d5dadbd9184c4d), W(0x3dbb18d5f93d9976), W(0x0a3e0f56d1147d47),
+     W(0x2afa8c8da0a48609)},
+    0
+  },
+  {
+    {W(0x26e08c07e3533d77), W(0xd7222e6a2e341c99), W(0x9d60ec3d8d2dc4ed),
+     W(0xbdfe0d8f7c476cf8)},
+    {W(0x1fe59ab61d056605), W(0xa9ea9df686a8551f), W(0x8489941e47fb8d8c),
+     W(0xfeb874eb4a7f1b10)},
+    0
+  },
+  {
+    {W(0xed406aa9bd763802), W(0xc21486a065303da1), W(0x61ae291ec7e62ec4),
+     W(0x622a0492df99333e)},
+    {W(0x7fd80c9dbb7a8ee0), W(0xdc2ed3bc6c01aedb), W(0x35c35a1208be74ec),
+     W(0xd540cb1a469f671f)},
+    0
+  },
+  {
+    {W(0x9164088d977eab40), W(0x51f4c5b62760b390), W(0xd238238f340dd553),
+     W(0x358566c3db1d31c9)},
+    {W(0x3a5ad69e5068f5ff), W(0xf31435fcdaff6b06), W(0xae549a5bd6debff0),
+     W(0x59e5f0b775e01331)},
+    0
+  },
+  {
+    {W(0x2cc5226138634818), W(0x501814f4b44c2e0b), W(0xf7e181aa54dfdba3),
+     W(0xcfd58ff0e759718c)},
+    {W(0xf90cdb14d3b507a8), W(0x57bd478ec50bdad8), W(0x29c197e250e5f9aa),
+     W(0x4db6eef8e40bc855)},
+    0
+  },
+  {
+    {W(0xd5d5cdd35958cd79), W(0x3580a1b51d373114), W(0xa36e4c91fa935726),
+     W(0xa38c534def20d760)},
+    {W(0x7088e40a2ff5845b), W(0xe5bb40bdbd78177f), W(0x4f06a7a8857f9920),
+     W(0xe3cc3e50e968f05d)},
+    0
+  },
+  {
+    {W(0x2ce53c5abf776f5b), W(0x6f72407160357b05), W(0xb259371771bf3f7a),
+     W(0x87d2501c440c4a9f)},
+    {W(0x440552e187b05340), W(0xb7bf7cc821624c32), W(0x4155a6ce22facddb),
+     W(0x5a4228cb889837ef)},
+    0
+  },
+  {
+    {W(0x10595b5696a71cba), W(0x944938b2fdcadeb7), W(0xa282da4cfccd8471),
+     W(0x98ec05f30d37bfe1)},
+    {W(0xe171ce1b0698304a), W(0x2d69144421bdf79b), W(0xd0cd3b741b21dec1),
+     W(0x712ecd8b16a15f71)},
+    0
+  },
+  {
+    {W(0xaad066da4d88f1dd), W(0xc604f1657ad35dea), W(0x7edc07204478ca67),
+     W(0xa10dfae0ba02ce06)},
+    {W(0xeceb1c76af36f4e4), W(0x994b2292af3f8f48), W(0xbf9ed77b77c8a68c),
+     W(0x74f544ea51744c9d)},
+    0
+  },
+  {
+    {W(0xe89f48c85963a46e), W(0x658ab875a99e61c7), W(0x6e296f874b8517b4),
+     W(0x36c4fcdcfc1bc656)},
+    {W(0xde5227a1a3906def), W(0x9fe95f5762418945), W(0x20c91e81fdd96cde),
+     W(0x5adbe47eda4480de)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa7a8746a584c5e20), W(0x267e4ea1b9dc7035), W(0x593a15cfb9548c9b),
+     W(0x5e6e21354bd012f3)},
+    {W(0xdf31cc6a8c8f936e), W(0x8af84d04b5c241dc), W(0x63990a6f345efb86),
+     W(0x6fef4e61b9b962cb)},
+    0
+  },
+  {
+    {W(0xf6368f0925722608), W(0x131260db131cf5c6), W(0x40eb353bfab4f7ac),
+     W(0x85c7888037eee829)},
+    {W(0x4c1581ffc3bdf24e), W(0x5bff75cbf5c3c5a8), W(0x35e8c83fa14e6f40),
+     W(0xb81d1c0f0295e0ca)},
+    0
+  },
+  {
+    {W(0xf2efe23d442a8ad1), W(0xc3816a7d06b9c164), W(0xa9df2d8bdc0aa5e5),
+     W(0x191ae46f120a8e65)},
+    {W(0x83667f8700611c5b), W(0x83171ed7ff109948), W(0x33a2ecf8ca695952),
+     W(0xfa4a73eef48d1a13)},
+    0
+  },
+  {
+    {W(0xfcde7cc8f43a730f), W(0xe89b6f3c33ab590e), W(0xc823f529ad03240b),
+     W(0x82b79afe98bea5db)},
+    {W(0x568f2856962fe5de), W(0x0c590adb60c591f3), W(0x1fc74a144a28a858),
+     W(0x3b662498b3203f4c)},
+    0
+  },
+  {
+    {W(0x48fc4ed082dd1b6a), W(0x5783a13867b703af), W(0x2463cb9a005d6aaa),
+     W(0xd31ec55c706ecd43)},
+    {W(0x9f8ed33f8e9a7641), W(0x625453ed098d9e7a), W(0xa3beade4ec887493),
+     W(0x442b80505a795566)},
+    0
+  },
+  {
+    {W(0x91e3cf0d6c39765a), W(0xa2db3acdac3cca0b), W(0x288f2f08cb953b50),
+     W(0x2414582ccf43cf1a)},
+    {W(0x8dec8bbc60eee9a8), W(0x54c79f02729aa042), W(0xd81cd5ec6532f5d5),
+     W(0xa672303acf82e15f)},
+    0
+  },
+  {
+    {W(0x46df582d3bfab839), W(0x92474e042f8adade), W(0x36a7766a147a1bc3),
+     W(0xb6940f540dc0f979)},
+    {W(0x44738ef2f2759f25), W(0x9dd95789a719f4c6), W(0x2859b7f40750c345),
+     W(0x5e788bf2b22180d5)},
+    0
+  },
+  {
+    {W(0x376aafa8719c0563), W(0xcd8ad2dcbc5fc79f), W(0x303fdb9fcb750cd3),
+     W(0x14ff052f4418b08e)},
+    {W(0xf75084cf3e2d6520), W(0x7ebdf0f8144ed509), W(0xf43bf0f2d3f25b98),
+     W(0x86ad71cfa354d837)},
+    0
+  },
+  {
+    {W(0xa839c9fdfd67ca25), W(0x023e626860f2015c), W(0x2414a7930e7b2a65),
+     W(0x92dbe372b13edcbb)},
+    {W(0xf64981ee64c2200f), W(0x94fb9cdf8446f2f3), W(0x01411a6a3f1367bb),
+     W(0x7985c1915a1e8331)},
+    0
+  },
+  {
+    {W(0xb827fe9226f43572), W(0xdfd3ab5b5d824758), W(0x315dd23a539094c1),
+     W(0x85c0e37a66623d68)},
+    {W(0x575c79727be19ae0), W(0x616a3396df0d36b5), W(0xa1ebb3c826b1ff7e),
+     W(0x635b9485140ad453)},
+    0
+  },
+  {
+    {W(0xc8123c6037e2efea), W(0x8d49b502034a96f6), W(0x466a346b973e4a95),
+     W(0xf176b5bab7de00ff)},
+    {W(0x1c58fa3b82dfa945), W(0x2eb27a9609e429ae), W(0x57c67a67a12b187c),
+     W(0xb155ba82e2298bba)},
+    0
+  },
+  {
+    {W(0x92bf3cdada430c0b), W(0x4702850e3a96dac6), W(0xc91cf0a515ac326a),
+     W(0x95de4f49ab8c25e4)},
+    {W(0xb01bad09e265c17c), W(0x24e45464087b3881), W(0xd43e583ce1fac5ca),
+     W(0xe17cb3186ead97a6)},
+    0
+  },
+  {
+    {W(0xf1a542073d99bcfa), W(0x59db703ce8becf6d), W(0x2e455142d2459569),
+     W(0xb0ee5143a901b910)},
+    {W(0xfc05d451e26d994f), W(0x7a6062b41360caaf), W(0xdf1ded5f4fa639b1),
+     W(0xaf930348d335b8b0)},
+    0
+  },
+  {
+    {W(0x6cc3924374dcec46), W(0x33cfc02d54c2b73f), W(0x82917844f26cd99c),
+     W(0x8819dd95d1773f89)},
+    {W(0x09572aa60871f427), W(0x8e0cf365f6f01c34), W(0x7fa52988bff1f5af),
+     W(0x4eb357eae75e8e50)},
+    0
+  },
+  {
+    {W(0x3d8f248a21fd0861), W(0xade3bd649bd5a4b6), W(0xcb56c953c2e2a6bf),
+     W(0x699cd2b5287d6c5f)},
+    {W(0xdebce1be47d05e8f), W(0x1a4fbb13a8f53732), W(0x97163beaa5852b08),
+     W(0x92c49e6ceec6987a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd9d0c8c4868af75d), W(0xd7325cff45c8c7ea), W(0xab471996cc81ecb0),
+     W(0xff5d55f3611824ed)},
+    {W(0xbe3145411977a0ee), W(0x5085c4c5722038c6), W(0x2d5335bff94bb495),
+     W(0x894ad8a6c8e2a082)},
+    0
+  },
+  {
+    {W(0x540234b22c11bb37), W(0x2d0366dded4c74a3), W(0xf9a968daeec5f25d),
+     W(0x3660106867b63142)},
+    {W(0x07cd6d2c68d7b6d4), W(0xa8f74f090c842942), W(0xe27514047768b1ee),
+     W(0x4b5f7e89fe62aee4)},
+    0
+  },
+  {
+    {W(0xd1e059b21994ef20), W(0x2a653b69638ae318), W(0x70d5eb582f699010),
+     W(0x279739f709f5f84a)},
+    {W(0x5da4663c8b799336), W(0xfdfdf14d203c37eb), W(0x32d8a9dca1dbfb2d),
+     W(0xab40cff077d48f9b)},
+    0
+  },
+  {
+    {W(0xf2369f0b879fbbed), W(0x0ff0ae86da9d1869), W(0x5251d75956766f45),
+     W(0x4984d8c02be8d0fc)},
+    {W(0x7ecc95a6d21008f0), W(0x29bd54a03a1a1c49), W(0xab9828c5d26c50f3),
+     W(0x32c0087c51d0d251)},
+    0
+  },
+  {
+    {W(0xf61790abfbaf50a5), W(0xdf55e76b684e0750), W(0xec516da7f176b005),
+     W(0x575553bb7a2dddc7)},
+    {W(0x37c87ca3553afa73), W(0x315f3ffc4d55c251), W(0xe846442aaf3e5d35),
+     W(0x61b911496495ff28)},
+    0
+  },
+  {
+    {W(0x47feeb6662b5f3af), W(0xcefab5610abb3734), W(0x449de60e19f35cb1),
+     W(0x39f8db14157f0eb9)},
+    {W(0xffaecc5b3c61bfd6), W(0xa5a4d41d41216703), W(0x7f8fabed224e1cc2),
+     W(0x0d5a8186871ad953)},
+    0
+  },
+  {
+    {W(0x4bdf3a4956f90823), W(0xba0f5080741d777b), W(0x091d71c3f38bf760),
+     W(0x9633d50f9b625b02)},
+    {W(0x03ecb743b8c9de61), W(0xb47512545de74720), W(0x9f9defc974ce1cb2),
+     W(0x774a4f6a00bd32ef)},
+    0
+  },
+  {
+    {W(0x190d8ea601799a52), W(0xa20cec41b86d2952), W(0x3062ffb27fff2a7c),
+     W(0x741b32e579f19d37)},
+    {W(0xf80d81814eb57d47), W(0x7a2d0ed416aef06b), W(0x09735fb01cecb588),
+     W(0x1641caaac6061f5b)},
+    0
+  },
+  {
+    {W(0x327bc002b0131e5b), W(0x1739e6d5cb2514d9), W(0xc8cbdafe55a81543),
+     W(0x5bb1a36ce1137243)},
+    {W(0x205da3c517325327), W(0xc35c1a36515a057e), W(0xf00f64c942925f9b),
+     W(0xbd14633cb7d59f7a)},
+    0
+  },
+  {
+    {W(0xae2ad171656e8c3a), W(0xc0e2a4631acd0705), W(0x006f6a8aa0b6055c),
+     W(0xaf4513d72b65a26e)},
+    {W(0x3f549e14d616d5bc), W(0x64ee395571253b1f), W(0xe8b10bc1b8ce243a),
+     W(0xbcbeace5913a4e77)},
+    0
+  },
+  {
+    {W(0x47c1004341f37dbd), W(0x96eccae36168ecf6), W(0x65bde59d1ca46aa3),
+     W(0x38a7027ab8698ffa)},
+    {W(0xa2b89dc86dc34437), W(0x5a0a118d43a4153f), W(0x9e330a861ce22fd8),
+     W(0x28382af6b3bbd3bc)},
+    0
+  },
+  {
+    {W(0x68d32256f779d6a7), W(0x20423b4d19e7284e), W(0xde19aa1b38f3b153),
+     W(0x73d0b6c28444f703)},
+    {W(0x666161489c64e6a3), W(0x99587c3737256224), W(0x6f5277fe61331563),
+     W(0x7174ad4aa656502e)},
+    0
+  },
+  {
+    {W(0x0b2e27c0d81e0271), W(0xa67a7596117a317c), W(0x17f08928a6723d99),
+     W(0x71a75681485310a3)},
+    {W(0x90465462afb66ca9), W(0x185e97ccfbbe229d), W(0x6a1a606addad8fc2),
+     W(0x2431f316b3c797cf)},
+    0
+  },
+  {
+    {W(0xec1ffc920133918d), W(0x15d9bf5eb2c9ef97), W(0x7885b542fc6cbb9a),
+     W(0x8abe64535720cf5d)},
+    {W(0x4e715dced4ec68ab), W(0x57a67614279c24a3), W(0x788ed52a31bb61cf),
+     W(0xaba82444f437a003)},
+    0
+  },
+  {
+    {W(0x4703401193529432), W(0x1f106bdd30743462), W(0xabfb9964cd66d8ca),
+     W(0x934d9d5ae9bdadd5)},
+    {W(0x5976d815908e3d22), W(0x344a362f28e057bd), W(0xf92cdadc5443dfb3),
+     W(0x001297adf089603b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x7f99824f20151427), W(0x206828b692430206), W(0xaa9097d7e1112357),
+     W(0xacf9a2f209e414ec)},
+    {W(0xdbdac9da27915356), W(0x7e0734b7001efee3), W(0x54fab5bbd2b288e2),
+     W(0x4c630fc4f62dd09c)},
+    0
+  },
+  {
+    {W(0x8537107a1ac2703b), W(0xb49258d86bc857b5), W(0x57df14debcdaccd1),
+     W(0x24ab68d7c4ae8529)},
+    {W(0x7ed8b5d4734e59d0), W(0x5f8740c8c495cc80), W(0x84aedd5a291db9b3),
+     W(0x80b360f84fb995be)},
+    0
+  },
+  {
+    {W(0xae915f5d5fa067d1), W(0x4134b57f9668960c), W(0xbd3656d6a48edaac),
+     W(0xdac1e3e4fc1d7436)},
+    {W(0x674ff869d81fbb26), W(0x449ed3ecb26c33d4), W(0x85138705d94203e8),
+     W(0xccde538bbeeb6f4a)},
+    0
+  },
+  {
+    {W(0x55d5c68da61a76fa), W(0x598b441dca1554dc), W(0xd39923b9773b279c),
+     W(0x33331d3c36bf9efc)},
+    {W(0x2d4c848e298de399), W(0xcfdb8e77a1a27f56), W(0x94c855ea57b8ab70),
+     W(0xdcdb9dae6f7879ba)},
+    0
+  },
+  {
+    {W(0x7bdff8c2019f2a59), W(0xb3ce5bb3cb4fbc74), W(0xea907f688a9173dd),
+     W(0x6cd3d0d395a75439)},
+    {W(0x92ecc4d6efed021c), W(0x09a9f9b06a77339a), W(0x87ca6b157188c64a),
+     W(0x10c2996844899158)},
+    0
+  },
+  {
+    {W(0x5859a229ed6e82ef), W(0x16f338e365ebaf4e), W(0x0cd313875ead67ae),
+     W(0x1c73d22854ef0bb4)},
+    {W(0x4cb5513174a5c8c7), W(0x01cd29707f69ad6a), W(0xa04d00dde966f87e),
+     W(0xd96fe4470b7b0321)},
+    0
+  },
+  {
+    {W(0x342ac06e88fbd381), W(0x02cd4a845c35a493), W(0xe8fa89de54f1bbcd),
+     W(0x341d63672575ed4c)},
+    {W(0xebe357fbd238202b), W(0x600b4d1aa984ead9), W(0xc35c9f4452436ea0),
+     W(0x96fe0a39a370751b)},
+    0
+  },
+  {
+    {W(0x4c4f07367f636a38), W(0x9f943fb70e76d5cb), W(0xb03510baa8b68b8b),
+     W(0xc246780a9ed07a1f)},
+    {W(0x3c0514156d549fc2), W(0xc2953f31607781ca), W(0x955e2c69d8d95413),
+     W(0xb300fadc7bd282e3)},
+    0
+  },
+  {
+    {W(0x81fe7b5087e9189f), W(0xdb17375cf42dda27), W(0x22f7d896cf0a5904),
+     W(0xa0e57c5aebe348e6)},
+    {W(0xa61011d3f40e3c80), W(0xb11893218db705c5), W(0x4ed9309e50fedec3),
+     W(0xdcf14a104d6d5c1d)},
+    0
+  },
+  {
+    {W(0x056c265b55691342), W(0xe8e0850491049dc7), W(0x131329f5c9bae20a),
+     W(0x96c8b3e8d9dccdb4)},
+    {W(0x8c5ff838fb4ee6b4), W(0xfc5a9aeb41e8ccf0), W(0x7417b764fae050c6),
+     W(0x0953c3d700452080)},
+    0
+  },
+  {
+    {W(0x2137268238dfe7e8), W(0xea417e152bb79d4b), W(0x59641f1c76e7cf2d),
+     W(0x271e3059ea0bcfcc)},
+    {W(0x624c7dfd7253ecbd), W(0x2f552e254fca6186), W(0xcbf84ecd4d866e9c),
+     W(0x73967709f68d4610)},
+    0
+  },
+  {
+    {W(0xa14b1163c27901b4), W(0xfd9236e0899b8bf3), W(0x42b091eccbc6da0a),
+     W(0xbb1dac6f5ad1d297)},
+    {W(0x80e61d53a91cf76e), W(0x4110a412d31f1ee7), W(0x2d87c3ba13efcf77),
+     W(0x1f374bb4df450d76)},
+    0
+  },
+  {
+    {W(0x5e78e2f20d188dab), W(0xe3968ed0f4b885ef), W(0x46c0568e7314570f),
+     W(0x3161633801170521)},
+    {W(0x18e1e7e24f0c8afe), W(0x4caa75ffdeea78da), W(0x82db67f27c5d8a51),
+     W(0x36a44d866f505370)},
+    0
+  },
+  {
+    {W(0xd72c5bda0333974f), W(0x5db516ae27a70146), W(0x34705281210ef921),
+     W(0xbff17a8f0c9c38e5)},
+    {W(0x78f4814e12476da1), W(0xc1e1661333c16980), W(0x9e5b386f424d4bca),
+     W(0x4c274e87c85740de)},
+    0
+  },
+  {
+    {W(0xb6a9b88d6c2f5226), W(0x14d1b944550d7ca8), W(0x580c85fc1fc41709),
+     W(0xc1da368b54c6d519)},
+    {W(0x2b0785ced5113cf7), W(0x0670f6335a34708f), W(0x46e2376715cc3f88),
+     W(0x1b480cfa50c72c8f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x202886024147519a), W(0xd0981eac26b372f0), W(0xa9d4a7caa785ebc8),
+     W(0xd953c50ddbdf58e9)},
+    {W(0x9d6361ccfd590f8f), W(0x72e9626b44e6c917), W(0x7fd9611022eb64cf),
+     W(0x863ebb7e9eb288f3)},
+    0
+  },
+  {
+    {W(0x877b7cf5678a31b0), W(0xd50301ae3998b620), W(0x734257c5c00fb396),
+     W(0xf9fb18a004e672a6)},
+    {W(0xff8bd8ebe8758851), W(0x1e64e4c65d99ba44), W(0x4b8eaedf7dfd93b7),
+     W(0xba2f2a9804e76b8c)},
+    0
+  },
+  {
+    {W(0xa18f07e0e90fb21e), W(0x00fd2b80bba7fca1), W(0x20387f2795cd67b5),
+     W(0x5b89a4e7d39707f7)},
+    {W(0x8f83ad3f894407ce), W(0xa0025b946c226132), W(0xc79563c7f906c13b),
+     W(0x5f548f314e7bb025)},
+    0
+  },
+  {
+    {W(0x0ee6d3a7c35d8794), W(0x042e65580356bae5), W(0x9f59698d643322fd),
+     W(0x9379ae1550a61967)},
+    {W(0x64b9ae62fcc9981e), W(0xaed3d6316d2934c6), W(0x2454b3025e4e65eb),
+     W(0xab09f647f9950428)},
+    0
+  },
+  {
+    {W(0xc1b3d3d331b85f09), W(0x0f45354aa88ae64a), W(0xa8b626d32fec50fd),
+     W(0x1bdcfbd4e828834f)},
+    {W(0xe45a2866cd522539), W(0xfa9d4732810f7ab3), W(0xd8c1d6b4c905f293),
+     W(0x10ac80473461b597)},
+    0
+  },
+  {
+    {W(0xe2c815366d91cd2c), W(0x40a2beeadaa3f0e4), W(0xfb167a592441e083),
+     W(0x004675e9e9240347)},
+    {W(0x7848aaff840e446e), W(0x9f9f258fea308f72), W(0x50f12899639bfad9),
+     W(0x0939ae63205c0af6)},
+    0
+  },
+  {
+    {W(0xbbb175146fc627e2), W(0xa0569bc591573a51), W(0xa7016d9e358243d5),
+     W(0x0dac0c56ac1d6692)},
+    {W(0x993833b5da590d5f), W(0xa8067803de817491), W(0x65b4f2124dbf75d0),
+     W(0xcc960232ccf80cfb)},
+    0
+  },
+  {
+    {W(0xb2083a1222248acc), W(0x1f6ec0ef3264e366), W(0x5659b7045afdee28),
+     W(0x7a823a40e6430bb5)},
+    {W(0x24592a04e1900a79), W(0xcde09d4ac9ee6576), W(0x52b6463f4b5ea54a),
+     W(0x1efe9ed3d3ca65a7)},
+    0
+  },
+  {
+    {W(0x35d742806cf3d65b), W(0x4b7c790678b28dd9), W(0xc4fcdd2f95e1f85f),
+     W(0xcf6fb7ba591350b6)},
+    {W(0x9f8e3287edfc26af), W(0xe2dd9e73c2d0ed9a), W(0xeab5d67f24cbb703),
+     W(0x60c293999a759a5a)},
+    0
+  },
+  {
+    {W(0xcf8625d7708f97cd), W(0xfb6c5119ea419de4), W(0xe8cb234dc03f9b06),
+     W(0x5a7822c335e23972)},
+    {W(0x9b876319a284ff10), W(0xefcc49977093fdce), W(0xdddfd62a878fe39a),
+     W(0x44bfbe53910aa059)},
+    0
+  },
+  {
+    {W(0xfb93ca3d7ca53d5f), W(0x432649f004379cbf), W(0xf506113acba2ff75),
+     W(0x4594ae2103718b35)},
+    {W(0x1aa6cee50d044627), W(0xc0e0d2b7f5c94aa2), W(0x0bf33d3dee4dd3f5),
+     W(0xaca96e288477c97a)},
+    0
+  },
+  {
+    {W(0x6487e9944a0ceffa), W(0xbba39edd98f54f99), W(0x7f30dc48712240fc),
+     W(0x806091713cd219dd)},
+    {W(0xd96028d2b1b5067c), W(0x4f6fcc1fe80c6e35), W(0x9dec37d65f1e3c72),
+     W(0xf576db06ebf87855)},
+    0
+  },
+  {
+    {W(0x995c068e6861a713), W(0xa9ba339463de88dc), W(0xab954344689a964f),
+     W(0x58195aec0f5a0d6c)},
+    {W(0xc5f207d5c98f8b50), W(0x6600cd280c98ccf6), W(0x1a680fe339c3e6c2),
+     W(0xa23f3931660e87c0)},
+    0
+  },
+  {
+    {W(0x36cd2020a1559689), W(0xa59d27a0e6133736), W(0xda90cee60b99e5d5),
+     W(0x7a914a5651df2302)},
+    {W(0x757460d5f99a0475), W(0xb107314f40e49ce1), W(0x411c80ac910b8e30),
+     W(0x48e3547508069ddd)},
+    0
+  },
+  {
+    {W(0x43bc1b42c78440a1), W(0x9a07e22632ac6c3f), W(0xaf3d7ba10f4bcd15),
+     W(0x3ad43c9da36814c6)},
+    {W(0xca11f742a0c9c162), W(0xd3e06fc6c90b96ec), W(0xeace6e766bf2d03f),
+     W(0x8bcd98e8f8032795)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe27a6dbe305406dd), W(0x8eb7dc7fdd5d1957), W(0xf54a6876387d4d8f),
+     W(0x9c479409c7762de4)},
+    {W(0xbe4d5b5d99b30778), W(0x25380c566e793682), W(0x602d37f3dac740e3),
+     W(0x140deabe1566e4ae)},
+    0
+  },
+  {
+    {W(0xeaee6126c49a861e), W(0x024f3b65e14f0d06), W(0x51a3f1e8c69bfc17),
+     W(0xc3c3a8e9a7686381)},
+    {W(0x3400752cb103d4c8), W(0x02bc46139218b36b), W(0xc67f75eb7651504a),
+     W(0xd6848b56d02aebfa)},
+    0
+  },
+  {
+    {W(0x958381db1782269b), W(0xae34bf792597e550), W(0xbb5c60645f385153),
+     W(0x6f0e96afe3088048)},
+    {W(0xbf6a021577884456), W(0xb3b5688c69310ea7), W(0x17c9429504fad2de),
+     W(0xe020f0e517896d4d)},
+    0
+  },
+  {
+    {W(0xcca4428dbbe5a1a9), W(0x8187fd5f3126bd67), W(0x0036973a48105826),
+     W(0xa39b6663b8bd61a0)},
+    {W(0x6d42deef2d65a808), W(0x4969044f94636b19), W(0xf611ee47dd5d564c),
+     W(0x7b2f3a49d2873077)},
+    0
+  },
+  {
+    {W(0x03b0d8dd0f82b214), W(0x460c34f9f103cbc6), W(0xf32e5c0318d79e19),
+     W(0x8b8888baa84117f8)},
+    {W(0x8f3c37dcc0722677), W(0x10d21be91c1c0f27), W(0xd47c8468e0f7a0c6),
+     W(0x9bf02213adecc0e0)},
+    0
+  },
+  {
+    {W(0x97554160b7fe7b6e), W(0x7d16189a400a3fb2), W(0xd73e9beae328ca1e),
+     W(0x0dd04b97e793d8cc)},
+    {W(0xa9c83c9b506db8cc), W(0x5cd47aaecf38814c), W(0x26fc430db64b45e6),
+     W(0x079b5499d818ea84)},
+    0
+  },
+  {
+    {W(0x03b5d21ae0ac2941), W(0x279b0254c2d31937), W(0x3307c052cac992d0),
+     W(0x6aa7cb92efa8b1f3)},
+    {W(0x5a1825800d37c7a5), W(0x13380c37342d5422), W(0x92ac2d66d5d2ef92),
+     W(0x035a70c9030c63c6)},
+    0
+  },
+  {
+    {W(0x5109b78571ba1861), W(0x48b22d5cd0c8f93d), W(0xe8fa84a78633bb93),
+     W(0x53fba6ba5aebbd08)},
+    {W(0x7ff27df3e5eea7d8), W(0x521c879668ca7158), W(0xb9d5133bce6f1a05),
+     W(0x2d50cd53fd0ebee4)},
+    0
+  },
+  {
+    {W(0x14eba133f74cff17), W(0x240aaa03ecb813f2), W(0xcfbb65406f665bee),
+     W(0x084b1fe4a425ad73)},
+    {W(0x009d5d16d081f6a6), W(0x35304fe8eef82c90), W(0xf20346d5aa9eaa22),
+     W(0x0ada9f07ac1c91e3)},
+    0
+  },
+  {
+    {W(0x7d9b3e23b40df1cf), W(0x5933737394e971b4), W(0xbf57bd14669cf921),
+     W(0x865daedf0c1a1064)},
+    {W(0x3eb70bd383279125), W(0xbc3d5b9f34ecdaab), W(0x91e3ed7e5f755caf),
+     W(0x49699f54d41e6f02)},
+    0
+  },
+  {
+    {W(0x304177580f3e4834), W(0xfdbb21c217a9afcb), W(0x756fa17f2f9a67b3),
+     W(0x2a6b2421a245c1a8)},
+    {W(0x64be27944af02291), W(0xade465c62a5804fe), W(0x8dffbd39a6f08fd7),
+     W(0xc4efa84caa14403b)},
+    0
+  },
+  {
+    {W(0xdab4804647718427), W(0xdf17ff9b6e830f8b), W(0x408d7ee8e49a1347),
+     W(0x6ac71e2391c1d4ae)},
+    {W(0xc8cbb9fd1defd73c), W(0x19840657bbbbfec5), W(0x39db1cb59e7ef8ea),
+     W(0x78aa829664105f30)},
+    0
+  },
+  {
+    {W(0xcdbef1c2065fef4a), W(0x77e60f7dfd5b92e3), W(0xd7c549f026708350),
+     W(0x201b3ad034f121bf)},
+    {W(0x5fcac2a10334fc14), W(0x8a9a9e09344552f6), W(0x7dd8a1d397653082),
+     W(0x5fc0738f79d4f289)},
+    0
+  },
+  {
+    {W(0x67608e71bd3502ba), W(0x4ef41f24b4de75a0), W(0xb08dde5efd6125e5),
+     W(0xde484825a409543f)},
+    {W(0x1f198d9865cc2295), W(0x428a37716e0edfa2), W(0x4f9697a2adf35fc7),
+     W(0x01a43c79f7cac3c7)},
+    0
+  },
+  {
+    {W(0xc1258d5b7cae440c), W(0x21c08b41402b7531), W(0xf61a8955de932321),
+     W(0x3568faf82d1408af)},
+    {W(0x71b15e999ecf965b), W(0xf14ed248e917276f), W(0xc6f4caa1820cf9e2),
+     W(0x681b20b218d83c7e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x889f6d65533ef217), W(0x7158c7e4c3ca2e87), W(0xfb670dfbdc2b4167),
+     W(0x75910a01844c257f)},
+    {W(0xf336bf07cf88577d), W(0x22245250e45e2ace), W(0x2ed92e8d7ca23d85),
+     W(0x29f8be4c2b812f58)},
+    0
+  },
+  {
+    {W(0xfbb9b2452133ffd9), W(0x39a8b2f1830f1a20), W(0x484bc97dd5a1f52a),
+     W(0xd6aebf56a40eddf8)},
+    {W(0x32257acb76ccdac6), W(0xaf4d36ec1586ff27), W(0x8eaa8863f8de7dd1),
+     W(0x0045d5cf88647c16)},
+    0
+  },
+  {
+    {W(0xc51e414351facc61), W(0xbaf2647de68a25bc), W(0x8f5271a00ff872ed),
+     W(0x8f32ef993d2d9659)},
+    {W(0xca12488c7593cbd4), W(0xed266c5d02b82fab), W(0x0a2f78ad14eb3f16),
+     W(0xc34049484d47afe3)},
+    0
+  },
+  {
+    {W(0xa6f3d574c005979d), W(0xc2072b426a40e350), W(0xfca5c1568de2ecf9),
+     W(0xa8c8bf5ba515344e)},
+    {W(0x97aee555114df14a), W(0xd4374a4dfdc5ec6b), W(0x754cc28f2ca85418),
+     W(0x71cb9e27d3c41f78)},
+    0
+  },
+  {
+    {W(0x09c1670209470496), W(0xa489a5edebd23815), W(0xc4dde4648edd4398),
+     W(0x3ca7b94a80111696)},
+    {W(0x3c385d682ad636a4), W(0x6702702508dc5f1e), W(0x0c1965deafa21943),
+     W(0x18666e16610be69e)},
+    0
+  },
+  {
+    {W(0x6792fd350369c8e1), W(0x9271aa62b9dc843b), W(0x8711a4b14d02e2ab),
+     W(0x02b2a3e27ee1a383)},
+    {W(0xb226e35f0e2b379b), W(0x3d3de39cd652ab25), W(0xaca6d4c93b560106),
+     W(0xeced0cf4c95bd877)},
+    0
+  },
+  {
+    {W(0x45beb4ca2a604b3b), W(0x56f651843a616762), W(0xf52f5a70978b806e),
+     W(0x7aa3978711dc4480)},
+    {W(0xe13fac2a0e01fabc), W(0x7c6ee8a5237d99f9), W(0x251384ee05211ffe),
+     W(0x4ff6976d1bc9d3eb)},
+    0
+  },
+  {
+    {W(0x8910507903605c39), W(0xf0843d9ea142c96c), W(0xf374493416923684),
+     W(0x732caa2ffa0a2893)},
+    {W(0xb2e8c27061160170), W(0xc32788cc437fbaa3), W(0x39cd818ea6eda3ac),
+     W(0xe2e942399e2b2e07)},
+    0
+  },
+  {
+    {W(0xdde0492316e043a2), W(0x98a452611dd3d209), W(0xeaf9f61bd431ebe8),
+     W(0x00919f4dbaf56abd)},
+    {W(0xe42417db6d8774b1), W(0x5fc5279c58e0e309), W(0x64aa40613adf81ea),
+     W(0xef419edabc627c7f)},
+    0
+  },
+  {
+    {W(0x3919759239ef620f), W(0x9d47284074fa29c4), W(0x4e428fa39d416d83),
+     W(0xd1a7c25129f30269)},
+    {W(0x46076e1cd746218f), W(0xf3ad6ee8110d967e), W(0xfbb5f434a00ae61f),
+     W(0x3cd2c01980d4c929)},
+    0
+  },
+  {
+    {W(0xfa24d0537a4af00f), W(0x3f938926ca294614), W(0x0d700c183982182e),
+     W(0x801334434cc59947)},
+    {W(0xf0397106ec87c925), W(0x62bd59fc0ed6665c), W(0xe8414348c7cca8b5),
+     W(0x574c76209f9f0a30)},
+    0
+  },
+  {
+    {W(0x6967d39b0260e52a), W(0xd42585cc90653325), W(0x0d9bd60521ca7954),
+     W(0x4fa2087781ed57b3)},
+    {W(0x60c1eff8e34a0bbe), W(0x56b0040c84f6ef64), W(0x28be2b24b1af8483),
+     W(0xb2278163f5531614)},
+    0
+  },
+  {
+    {W(0x95be42e2bb8b6a07), W(0x64be74eeca23f86a), W(0xa73d74fd154ce470),
+     W(0x1c2d2857d8dc076a)},
+    {W(0xb1fa1c575a887868), W(0x38df8e0b3de64818), W(0xd88e52f9c34e8967),
+     W(0x274b4f018b4cc76c)},
+    0
+  },
+  {
+    {W(0x59c81ec2c11c208b), W(0x240207da4e3a7234), W(0x4957eb80f4a089d8),
+     W(0xc86960bc2137a072)},
+    {W(0xde1154fd7f1a932c), W(0xb517fe74d3f2fa17), W(0x2d5d94557111c0eb),
+     W(0x2aa3378980929d36)},
+    0
+  },
+  {
+    {W(0x3f5c05b4f8b7559d), W(0x0be4c7acfae29200), W(0xdd6d3ef756532acc),
+     W(0xf6c3ed87eea7a285)},
+    {W(0xe463b0a8f46ec59b), W(0x531d9b14ecea6c83), W(0x3d6bdbafc2dc836b),
+     W(0x3ee501e92ab27f0b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8df275455922ac1c), W(0xa7b3ef5ca52b3f63), W(0x8e77b21471de57c4),
+     W(0x31682c10834c008b)},
+    {W(0xc76824f04bd55d31), W(0xb6d1c08617b61c71), W(0x31db0903c2a5089d),
+     W(0x9c092172184e5d3f)},
+    0
+  },
+  {
+    {W(0x5ace5035ea6c3997), W(0x54259aaac2610bef), W(0xef18bb3f3c80dd39),
+     W(0x6910b95b5fc3fa39)},
+    {W(0xfce2f51043e09aee), W(0xced56c9fa7675665), W(0x10e265acd872db61),
+     W(0x6982812eae9fce69)},
+    0
+  },
+  {
+    {W(0xca2eb690768fccfc), W(0xf402d37db835b362), W(0x0efac0d0e2fdfcce),
+     W(0xefc9cdefb638d990)},
+    {W(0x2af12b72d1669a8b), W(0x33c536bc5774ccbd), W(0x30b21909fb34870e),
+     W(0xc38fa2f77df25aca)},
+    0
+  },
+  {
+    {W(0xb8fa3d931341ed7a), W(0x4223272ca7b59d49), W(0x3dcb194783b8c4a4),
+     W(0x4e413c01ed1302e4)},
+    {W(0x6d999127e17e44ce), W(0xee86bf7533b3adfb), W(0xf6902fe625aa96ca),
+     W(0xb73540e4e5aae47d)},
+    0
+  },
+  {
+    {W(0x7bfc5e75b2c69dbc), W(0x3aa77a2903c3da6c), W(0xde0df03cca910271),
+     W(0xcbd5ca4a7806dc55)},
+    {W(0xe1ca58076db476cb), W(0xfde15d625f37a31e), W(0xf49af520f41af416),
+     W(0x96c5c5b17d342db5)},
+    0
+  },
+  {
+    {W(0xcc50ef6c872b4a60), W(0xab2a34a44613521b), W(0x39c5c190983e15d1),
+     W(0x61dde5df59905512)},
+    {W(0xe417f6219f2275f3), W(0x0750c8b6451d894b), W(0x75b04ab978b0bdaa),
+     W(0x3bfd9fd4458589bd)},
+    0
+  },
+  {
+    {W(0xc792e02adb22b94b), W(0x993d8ae9a1eaa45b), W(0x8aad6cd3cd1e1c63),
+     W(0x89529ca7c5ce688a)},
+    {W(0x2ccee3aae572a253), W(0xe02b643802a21efb), W(0xa7091b6ec9430358),
+     W(0x06d1b1fa9d7db504)},
+    0
+  },
+  {
+    {W(0xaafcbfabaf95894c), W(0x7b9bdc07276b2241), W(0xeaf983625bdda48b),
+     W(0x5977faf2a3fcb4df)},
+    {W(0xbed042ef052c4b5b), W(0x9fe87f71067591f0), W(0xc89c73ca22f24ec7),
+     W(0x7d37fa9ee64a9f1b)},
+    0
+  },
+  {
+    {W(0x7945ead858854be1), W(0x4111c12ecbd4d49d), W(0xece3b1ec3a29c2ef),
+     W(0x6356d4048d3616f5)},
+    {W(0x9f0d6a8f594d320e), W(0x0989316df651ccd2), W(0x6c32117a0f8fdde4),
+     W(0x9abe5cc5a26a9bbc)},
+    0
+  },
+  {
+    {W(0xbd78148045ee2f40), W(0x75e354af416b60cf), W(0xde0b58a18d49a8c4),
+     W(0xe40e94e2fa359536)},
+    {W(0xbd4fa59f62accd76), W(0x05cf466a8c762837), W(0xb5abda99448c277b),
+     W(0x5a9e01bf48b13740)},
+    0
+  },
+  {
+    {W(0x36be15b32d2ce811), W(0x846dc0c2f8291d21), W(0x5cfa0ecb789fcfdb),
+     W(0x45a0beedd7535b9a)},
+    {W(0xec8e9f0796d69af1), W(0x31a7c5b8599ab6dc), W(0xd36d45eff9e2e09f),
+     W(0x3cf49ef1dcee954b)},
+    0
+  },
+  {
+    {W(0xb51e55e6f2606a82), W(0xe25f706190f2fb57), W(0xacef6c2ab1a4e37c),
+     W(0x864e359d5dcf2706)},
+    {W(0x479e6b187ce57316), W(0x2cab25003a96b23d), W(0xed4898628ef16df7),
+     W(0x2056538cef3758b5)},
+    0
+  },
+  {
+    {W(0x726f97297a3cd22a), W(0x9f8cd5dc4a628397), W(0x17b93ab9c23165ed),
+     W(0xff5f5dbf122823d4)},
+    {W(0xc1e4e4b5654a446d), W(0xd1a9496f677257ba), W(0x6387ba94de766a56),
+     W(0x23608bc8521ec74a)},
+    0
+  },
+  {
+    {W(0xef69a0c3d41d3bd3), W(0xb533b8c907a26bde), W(0xe2801d97db2edf9f),
+     W(0xdc4a8269e1877af0)},
+    {W(0x6c1c58513d590dbe), W(0x84632f6bee4e9357), W(0xd36d36b779b33374),
+     W(0xb46833e39bbca2e6)},
+    0
+  },
+  {
+    {W(0xe065d190ca84bad7), W(0xfb13919fad58e65c), W(0x3c41718bf1cb6e31),
+     W(0x688969f006d05c3f)},
+    {W(0xd4f94ce721264d45), W(0xfdfb65e97367532b), W(0x5b1be8b10945a39d),
+     W(0x229f789c2b8baf3b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xcc7a64880a750c0f), W(0x39bacfe34e548e83), W(0x3d418c760c110f05),
+     W(0x3e4daa4cb1f11588)},
+    {W(0x2733e7b55ffc69ff), W(0x46f147bc92053127), W(0x885b2434d722df94),
+     W(0x6a444f65e6fc6b7c)},
+    0
+  },
+  {
+    {W(0x7a1a465ac3f16ea8), W(0x115a461db2f1d11c), W(0x4767dd956c68a172),
+     W(0x3392f2ebd13a4698)},
+    {W(0xc7a99ccde526cdc7), W(0x8e537fdc22292b81), W(0x76d8cf69a6d39198),
+     W(0xffc5ff432446852d)},
+    0
+  },
+  {
+    {W(0x6d0b16f4bdaedfbd), W(0x23fd326086746ced), W(0x8bfb1d2fff4b3e17),
+     W(0xc7f2ec2d019c14c8)},
+    {W(0x3e0832f245104b0d), W(0x5f00dafbadea2b7e), W(0x29e5cf6699fbfb0f),
+     W(0x264f972361827cda)},
+    0
+  },
+  {
+    {W(0x97b14f7ea90567e6), W(0x513257b7b6ae5cb7), W(0x85454a3c9f10903d),
+     W(0xd8d2c9ad69bc3724)},
+    {W(0x38da93246b29cb44), W(0xb540a21d77c8cbac), W(0x9bbfe43501918e42),
+     W(0xfffa707a56c3614e)},
+    0
+  },
+  {
+    {W(0x6eb1a2f3e30bc27f), W(0xe5f0c05ab0836511), W(0x4d741bbf4965ab0e),
+     W(0xfeec41ca83464bbd)},
+    {W(0x1aca705f99d0b09f), W(0xc5d6cc56f42da5fa), W(0x49964eddcc52b931),
+     W(0x8ae59615c884d8d8)},
+    0
+  },
+  {
+    {W(0x0ce4e3f1d4e353b7), W(0x062d8a14ef46b0a0), W(0x6408d5ab574b73fd),
+     W(0xbc41d1c9d3273ffd)},
+    {W(0x3538e1e76be77800), W(0x71fe8b37c5655031), W(0x1cd916216b9b331a),
+     W(0xad825d0bbb388f73)},
+    0
+  },
+  {
+    {W(0xf634b57b39f8868a), W(0xe27f4fd475cc69af), W(0xa47e58cbd0d5496e),
+     W(0x8a26793fd323e07f)},
+    {W(0xc61a9b72fa30f349), W(0x94c9d9c9b696d134), W(0x792beca85880a6d1),
+     W(0xbdcc4645af039995)},
+    0
+  },
+  {
+    {W(0x56c2e05b1cb76219), W(0x0ec0bf9171567e7e), W(0xe7076f8661c4c910),
+     W(0xd67b085bbabc04d9)},
+    {W(0x9fb904595e93a96a), W(0x7526c1eafbdc249a), W(0x0d44d367ecdd0bb7),
+     W(0x953999179dc0d695)},
+    0
+  },
+  {
+    {W(0xce7ef8e58c796c3c), W(0x9adaae84dd66e57a), W(0x784ae13e45227f33),
+     W(0xb046c5b82a85e757)},
+    {W(0xb7aa50aeec37631f), W(0xbedc4fca3b300758), W(0x0f82567e0ac9700b),
+     W(0x1071d9d44ff5f8d2)},
+    0
+  },
+  {
+    {W(0x61360ee99e240d18), W(0x057cdcacb4b94466), W(0xe7667cd12fe5325c),
+     W(0x1fa297b521974e3b)},
+    {W(0xfa4081e7db083d76), W(0x31993be6f206bd15), W(0x8949269b14c19f8c),
+     W(0x21468d72a9d92357)},
+    0
+  },
+  {
+    {W(0xd09ef6c4e51a2811), W(0x39f6862bb8fb66b9), W(0x64e77f8d22dfaa99),
+     W(0x7b10504461b08aac)},
+    {W(0x71704e4c4a7df332), W(0xd09734342ffe015b), W(0xab0eaf4408d3020e),
+     W(0x28b1909eed63b97a)},
+    0
+  },
+  {
+    {W(0x2ccbc583a4c506ec), W(0x957ed188d1acfe97), W(0x8baed83312f1aea2),
+     W(0xef2a6cb48325362d)},
+    {W(0x130dde428e195c43), W(0xc842025a0e6050c6), W(0x2da972a708686a5d),
+     W(0xb52999a1e508b4a8)},
+    0
+  },
+  {
+    {W(0x2f3fa882cdadcd4f), W(0xa4ef68595f631995), W(0xe52ca2f9e531766f),
+     W(0x20af5c3057e2c1d3)},
+    {W(0x1e4828f6e51e94b8), W(0xf900a1751a2f5d4f), W(0xe831adb3392c58a0),
+     W(0x4c5a90ca1b6e5866)},
+    0
+  },
+  {
+    {W(0xd9f090b910a5a8bd), W(0xca91d249096864da), W(0x8e6a93be3f67dbc1),
+     W(0xacae6fbaf5f4764c)},
+    {W(0x1563c6e0d21411a0), W(0x28fa787fda0a4ad8), W(0xd524491c908c8030),
+     W(0x1257ba0e4c795f07)},
+    0
+  },
+  {
+    {W(0x5f3dcba86182827c), W(0xd1a448ddbd7e7252), W(0x2d8f96fcf493b815),
+     W(0xba0a4c263b0aa95f)},
+    {W(0x88a1514063a0007f), W(0x9564c25e6a9c5846), W(0x5a4d7b0fdc0fcbca),
+     W(0x2275daa33f8a740e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x83f49167ceca9754), W(0x426d2cf64b7939a0), W(0x2555e355723fd0bf),
+     W(0xa96e6d06c4f144e2)},
+    {W(0x4768a8dd87880e61), W(0x15543815e508e4d5), W(0x09d7e772b1b65e15),
+     W(0x63439dd6ac302fa0)},
+    0
+  },
+  {
+    {W(0x859d3145983c38b5), W(0xb14f176c637abc8b), W(0x2793fb9dcaff7be6),
+     W(0xebe5a55f35a66a5a)},
+    {W(0x7cec1dcd9f87dc59), W(0x7c595cd3fbdbf560), W(0x5b543b2226eb3257),
+     W(0x69080646c4c935fd)},
+    0
+  },
+  {
+    {W(0x6aac688eadd70482), W(0x708de92a7b4a4e8a), W(0x75b6dd73758a6eef),
+     W(0xea4bf352725b3c43)},
+    {W(0x10041f2c87912868), W(0xb1b1be95ef09297a), W(0x19ae23c5a9f3860a),
+     W(0xc4f0f839515dcf4b)},
+    0
+  },
+  {
+    {W(0xb93452381d531696), W(0x57201c0088cdde69), W(0xdde922519a86afc7),
+     W(0xe3043895bd35cea8)},
+    {W(0x7608c1e18555970d), W(0x8267dfa92535935e), W(0xd4c60a57322ea38b),
+     W(0xe0bf7977804ef8b5)},
+    0
+  },
+  {
+    {W(0xd730049f16a66e91), W(0xe97f2820fa1b0e0d), W(0x4131e003304c28ea),
+     W(0x820ab732526bac62)},
+    {W(0xb2ac9ef928714423), W(0x54ecfffaadb10cb2), W(0x8781476ef886a4cc),
+     W(0x4b2c87b5db2f8d49)},
+    0
+  },
+  {
+    {W(0x6ada1d4286d2e0f8), W(0xe59201220e8a9fd5), W(0x02c936af708c1b49),
+     W(0x60f30fee2b4bfaff)},
+    {W(0x6637ad06858e6a61), W(0xce4c77673fd374d0), W(0x39d54b2d7188defb),
+     W(0xa8c9d250f56a6b66)},
+    0
+  },
+  {
+    {W(0x0e6ec0965f520698), W(0x640631fe44f7b8d9), W(0x92fd34fca35a68b9),
+     W(0x9c5a4b664d40cf4e)},
+    {W(0x949454bf80b6783d), W(0x80e701fe3a320a10), W(0x8d1a564a1a0a39b2),
+     W(0x1436d53d320587db)},
+    0
+  },
+  {
+    {W(0x6233ea68c094dbb5), W(0xb77d062ed968d410), W(0x3e719bbc58b3002d),
+     W(0x68e7dd3d3dc49d58)},
+    {W(0x8d825740013a5e58), W(0x213117473c9e3c1b), W(0x0cb0a2a77c99b6ab),
+     W(0x5c48a3b3c2f888f2)},
+    0
+  },
+  {
+    {W(0x8b51e5798e081f1d), W(0x63dbc649ae7c1d2c), W(0xf597e5f08af7c5e8),
+     W(0x32e841880ca823d7)},
+    {W(0x2dae4826e8b1186e), W(0xca5a5cb97061b8fc), W(0x8c3a8d4411ddb233),
+     W(0x4b95d5bd8f0beb23)},
+    0
+  },
+  {
+    {W(0x99d04c296087d631), W(0xe47993df89e0e18e), W(0x738c45d7064c8d58),
+     W(0xc8b25ca526cd7af6)},
+    {W(0x7c58743788097873), W(0x54d3cb32108d937c), W(0xe22f05466ae0f2f6),
+     W(0x47f791fc12f182e5)},
+    0
+  },
+  {
+    {W(0x508214ee59e38272), W(0xc18ba1c1d9d11b4b), W(0x1f9440fb5b3d94c9),
+     W(0x2d087d5be6f1d3ce)},
+    {W(0x834b26fd00a7ab36), W(0xcd80610156a5f0e6), W(0x55c4244ac3568612),
+     W(0x412b48a4cbe51b2f)},
+    0
+  },
+  {
+    {W(0x4c5c4be12927d4ca), W(0xb0f23f16518f848e), W(0x84f789220c757bcb),
+     W(0x35bd1cbb325deb96)},
+    {W(0xbdb186fb7d0de10a), W(0xd07350e3b22c9685), W(0x3f95393eef45c641),
+     W(0xb8870ff1d07b6d44)},
+    0
+  },
+  {
+    {W(0x669ddd2e9ba1b996), W(0x4a94db465e8144f5), W(0x265aee927e34c0cf),
+     W(0x8dc3912fcb79ae88)},
+    {W(0x96be4b6b3eaf2365), W(0xe95685af56ceffe5), W(0x4074d0dc79e932ed),
+     W(0xd4565b7da952d2e3)},
+    0
+  },
+  {
+    {W(0x973065dde10df32c), W(0xde4cf682aca368d3), W(0x6e25c917e056f0e4),
+     W(0x72d2fa3b9dd73df1)},
+    {W(0x0fb04a171cd5987d), W(0x93d6f6248a2e89ec), W(0x52c7e267ede29ae4),
+     W(0x10597e22d95f3760)},
+    0
+  },
+  {
+    {W(0x2c9f9c762b0da620), W(0xb505a12ccd4457af), W(0x1153d4a1acfb7718),
+     W(0x50912ecd8926c1e2)},
+    {W(0xeb06231cf8a5ed8e), W(0xc6c81301259667c2), W(0x396a4aa49a65dc35),
+     W(0x808ad3154116cd48)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc7913e91991724f3), W(0x5eda799c39cbd686), W(0xddb595c763d4fc1e),
+     W(0x6b63b80bac4fed54)},
+    {W(0x6ea0fc697e5fb516), W(0x737708bad0f1c964), W(0x9628745f11a92ca5),
+     W(0x61f379589a86967a)},
+    0
+  },
+  {
+    {W(0x9af39b2caa665072), W(0x78322fa4efd324ef), W(0x3d153394c327bd31),
+     W(0x81d5f2713129dab0)},
+    {W(0xc72e0c42f48027f5), W(0xaa40cdbc8536e717), W(0xf45a657a2d369d0f),
+     W(0xb03bbfc4ea7f74e6)},
+    0
+  },
+  {
+    {W(0x46a8c4180d738ded), W(0x6f1a5bb0e0de5729), W(0xf10230b98ba81675),
+     W(0x32c6f30c112b33d4)},
+    {W(0x7559129dd8fffb62), W(0x6a281b47b459bf05), W(0x77c1bd3afa3b6776),
+     W(0x0709b3807829973a)},
+    0
+  },
+  {
+    {W(0x8c26b232a3326505), W(0x38d69272ee1d41bf), W(0x0459453effe32afa),
+     W(0xce8143ad7cb3ea87)},
+    {W(0x932ec1fa7e6ab666), W(0x6cd2d23022286264), W(0x459a46fe6736f8ed),
+     W(0x50bf0d009eca85bb)},
+    0
+  },
+  {
+    {W(0x0b825852877a21ec), W(0x300414a70f537a94), W(0x3f1cba4021a9a6a2),
+     W(0x50824eee76943c00)},
+    {W(0xa0dbfcecf83cba5d), W(0xf953814893b4f3c0), W(0x6174416248f24dd7),
+     W(0x5322d64de4fb09dd)},
+    0
+  },
+  {
+    {W(0x574473843d9325f3), W(0xa9bef2d0f371cb84), W(0x77d2188ba61e36c5),
+     W(0xbbd6a7d7c602df72)},
+    {W(0xba3aa9028f61bc0b), W(0xf49085ed6ed0b6a1), W(0x8bc625d6ae6e8298),
+     W(0x832b0b1da2e9c01d)},
+    0
+  },
+  {
+    {W(0xa337c447f1f0ced1), W(0x800cc7939492dd2b), W(0x4b93151dbea08efa),
+     W(0x820cf3f8de0a741e)},
+    {W(0xff1982dc1c0f7d13), W(0xef92196084dde6ca), W(0x1ad7d97245f96ee3),
+     W(0x319c8dbe29dea0c7)},
+    0
+  },
+  {
+    {W(0xd3ea38717b82b99b), W(0x75922d4d470eb624), W(0x8f66ec543b95d466),
+     W(0x66e673ccbee1e346)},
+    {W(0x6afe67c4b5f2b89a), W(0x3de9c1e6290e5cd3), W(0x8c278bb6310a2ada),
+     W(0x420fa3840bdb323b)},
+    0
+  },
+  {
+    {W(0x0ae1d63b0eb919b0), W(0xd74ee51da74b9620), W(0x395458d0a674290c),
+     W(0x324c930f4620a510)},
+    {W(0x2d1f4d19fbac27d4), W(0x4086e8ca9bedeeac), W(0x0cdd211b9b679ab8),
+     W(0x5970167d7090fec4)},
+    0
+  },
+  {
+    {W(0x3420f2c9faf1fc63), W(0x616d333a328c8bb4), W(0x7d65364c57f1fe4a),
+     W(0x9343e87755e5c73a)},
+    {W(0x5795176be970e78c), W(0xa36ccebf60533627), W(0xfc7c738009cdfc1b),
+     W(0xb39a2afeb3fec326)},
+    0
+  },
+  {
+    {W(0xb7ff1ba16224408a), W(0xcc856e92247cfc5e), W(0x01f102e7c18bc493),
+     W(0x4613ab742091c727)},
+    {W(0xaa25e89cc420bf2b), W(0x00a5317690337ec2), W(0xd2be9f437d025fc7),
+     W(0x3316fb856e6fe3dc)},
+    0
+  },
+  {
+    {W(0x27520af59ac50814), W(0xfdf95e789a8e4223), W(0xb7e7df2a56bec5a0),
+     W(0xf7022f7ddf159e5d)},
+    {W(0x93eeeab1cac1fe8f), W(0x8040188c37451168), W(0x7ee8aa8ad967dce6),
+     W(0xfa0e79e73abc9299)},
+    0
+  },
+  {
+    {W(0x67332cfc2064cfd1), W(0x339c31deb0651934), W(0x719b28d52a3bcbea),
+     W(0xee74c82b9d6ae5c6)},
+    {W(0x0927d05ebaf28ee6), W(0x82cecf2c9d719028), W(0x0b0d353eddb30289),
+     W(0xfe4bb977fddb2e29)},
+    0
+  },
+  {
+    {W(0xbb5bb990640bfd9e), W(0xd226e27782f62108), W(0x4bf0098502ffdd56),
+     W(0x7756758a2ca1b1b5)},
+    {W(0xc32b62a35285fe91), W(0xedbc546a8c9cd140), W(0x1e47a013af5cb008),
+     W(0xbca7e720073ce8f2)},
+    0
+  },
+  {
+    {W(0xe10b2ab817a91cae), W(0xb89aab6508e27f63), W(0x7b3074a7dba3ddf9),
+     W(0x1c20ce09330c2972)},
+    {W(0x6b9917b45fcf7e33), W(0xe6793743945ceb42), W(0x18fc22155c633d19),
+     W(0xad1adb3cc7485474)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x646f96796424c49b), W(0xf888dfe867c241c9), W(0xe12d4b9324f68b49),
+     W(0x9a6b62d8a571df20)},
+    {W(0x81b4b26d179483cb), W(0x666f96329511fae2), W(0xd281b3e4d53aa51f),
+     W(0x7f96a7657f3dbd16)},
+    0
+  },
+  {
+    {W(0x8553d37c051af62b), W(0xe9a998eb0bf94496), W(0xe0844f9fb0d59aa1),
+     W(0x983fd558e6afb813)},
+    {W(0x9670c0ca65d69804), W(0x732b22de6ea5ff2d), W(0xd7640ba95fd8623b),
+     W(0x9f619163a6351782)},
+    0
+  },
+  {
+    {W(0xf167b4e0bdefdd4f), W(0x69958465f366e401), W(0x5aa368aba73bbec0),
+     W(0x121487097b240c21)},
+    {W(0x378c323318969006), W(0xcb4d73cee1fe53d1), W(0x5f50a80e130c4361),
+     W(0xd67f59517ef5212b)},
+    0
+  },
+  {
+    {W(0x332f81088cad38c0), W(0x471b7e906bd68ae2), W(0x56ac3fb20d8e27a3),
+     W(0xb54660db136b4b0d)},
+    {W(0x123a1e11a6fd8de4), W(0x44dbffeaa37799ef), W(0x4540b977ce6ac17c),
+     W(0x495173a8af60acef)},
+    0
+  },
+  {
+    {W(0xeb4437434573eab0), W(0x11570dfbd1ac6031), W(0xf7d9b45b44dd9afd),
+     W(0xb8066add22067231)},
+    {W(0x15f92ad8f8a3f0b4), W(0x9e0e4899e0ace2a2), W(0xbdcd0aadfab38b80),
+     W(0x46506ae917020052)},
+    0
+  },
+  {
+    {W(0x429a69f78fca399d), W(0xfe9e27d20207bb63), W(0xec655ed68788f582),
+     W(0xa426d748adb75f6e)},
+    {W(0x18695c02ca81c66d), W(0x84fb8d27a531d425), W(0x3a3a8956deff48ba),
+     W(0xaf1d0d56766d2247)},
+    0
+  },
+  {
+    {W(0x5a059565352c4b5c), W(0x49261531590bc3e2), W(0x809f7521f66f9f5f),
+     W(0x2baef6bfc70a4a9b)},
+    {W(0xe7e6fa6509ed3561), W(0x11370233984b230c), W(0x2151659bd04cdc69),
+     W(0xbdb83c63f007d416)},
+    0
+  },
+  {
+    {W(0x9ebb284d391c2a82), W(0xbcdd4863158308e8), W(0x006f16ec83f1edca),
+     W(0xa13e2c37695dc6c8)},
+    {W(0x2ab756f04a057a87), W(0xa8765500a6b48f98), W(0x4252face68651c44),
+     W(0xa52b540be1765e02)},
+    0
+  },
+  {
+    {W(0xcb35a1a85ca37ff0), W(0xe1a04f1ccd2f1c8f), W(0x238816ce15a26112),
+     W(0xe206a111095b177e)},
+    {W(0x3c10b6048a424149), W(0xc6a3f56774752cfb), W(0xbf16a37a47f1dbb8),
+     W(0x7c372f9ad31a3dfb)},
+    0
+  },
+  {
+    {W(0x122d05b5c20b4d2a), W(0xff659cf50c662a67), W(0xed57c128e8ffc9e9),
+     W(0x0fbb15859e987683)},
+    {W(0xadd70df247319a2b), W(0x4b98baba374be470), W(0xf03d747356a7b307),
+     W(0x342e696e3efebf30)},
+    0
+  },
+  {
+    {W(0xf84b48f7864ac537), W(0x04713409a6940d3d), W(0x014db22d6174c7ae),
+     W(0xc73a1c438c213034)},
+    {W(0x18ac4ea5ffdd93ec), W(0x724fc7576102783e), W(0x9fe13fcc91c3e83f),
+     W(0x92a8c2c8f08f0bf5)},
+    0
+  },
+  {
+    {W(0x7f2e22fd8f67f6de), W(0xab018833d8693177), W(0x266d1db6863eca95),
+     W(0x6bb7732b31b5ef2b)},
+    {W(0x4fa927c6915f80ce), W(0x6fa1d6d25f90efd8), W(0x7bd75de8456b48ad),
+     W(0xd2cb507a845b6429)},
+    0
+  },
+  {
+    {W(0xa72cf82ae255d7ec), W(0x52025c23a460e204), W(0x10ae542d7d5b0a44),
+     W(0xa85143109305aeda)},
+    {W(0x958315f5a14bbfe8), W(0x3f361826385365fe), W(0xc2b3a36b66d95040),
+     W(0x12c7b3347cf4eda2)},
+    0
+  },
+  {
+    {W(0xa545b4d1e744119d), W(0x4c93b169829a71e7), W(0x2dbb908c6117fcbf),
+     W(0x4dc97320b35a3d85)},
+    {W(0x94c04f856bf88105), W(0x452e1bce1b51bc1f), W(0x0c41ff50b3013af3),
+     W(0xf07af445224d7e24)},
+    0
+  },
+  {
+    {W(0xbdb9e57ca3d24f6a), W(0x8a8246d7f345a763), W(0x73bd2a6d98cfbb5f),
+     W(0x1dd8e85e86ed04db)},
+    {W(0x76f2da42c01f420b), W(0x7ef0547364407bc7), W(0x7e98ba7faff548f5),
+     W(0x6b7afbeefd30b64a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4f922fc516a0d2bb), W(0x0d5cc16c1a623499), W(0x9241cf3a57c62c8b),
+     W(0x2f5e6961fd1b667f)},
+    {W(0x5c15c70bf5a01797), W(0x3d20b44d60956192), W(0x04911b37071fdb52),
+     W(0xf648f9168d6f0f7b)},
+    0
+  },
+  {
+    {W(0x027cc8b8fac61d9a), W(0x7d25e062e3c6fe8a), W(0xe08805bfe5bff503),
+     W(0x13271e6c6ff632f7)},
+    {W(0x55dca6c0232f76a5), W(0x8957c32d701ef426), W(0xee728bcba10a5178),
+     W(0x5ea60411b62c5173)},
+    0
+  },
+  {
+    {W(0x4090914bb5def996), W(0x1cb69c83233dd1e7), W(0xc1e9c1d39b3d5e76),
+     W(0x1f3338edfccf6012)},
+    {W(0xb1e95d0d2f5378a8), W(0xacf4c2c72f00cd21), W(0x6e984240eb5fe290),
+     W(0xd66c038d248088ae)},
+    0
+  },
+  {
+    {W(0x9ad5462bb4d8bc50), W(0x181c0b16a9195770), W(0xebd4fe1c78412a68),
+     W(0xae0341bcc0dff48c)},
+    {W(0xb6bc45cf7003e866), W(0xf11a6dea8a24a41b), W(0x5407151ad04c24c2),
+     W(0x62c9d27dda5b7b68)},
+    0
+  },
+  {
+    {W(0xd4992b30614c0900), W(0xda98d121bd00c24b), W(0x7f534dc87ec4bfa1),
+     W(0x4a5ff67437dc34bc)},
+    {W(0x68c196b81d7ea1d7), W(0x38cf289380a6d208), W(0xfd56cd09e3cbbd6e),
+     W(0xec72e27e4205a5b6)},
+    0
+  },
+  {
+    {W(0x32865719a8afd30b), W(0x867983288a826dce), W(0xdf04e891c4a8fbe0),
+     W(0xbb6b6e1bebf56ad3)},
+    {W(0x0a695b11471f1ff0), W(0xd76c3389be15baf0), W(0x018edb95be96c43e),
+     W(0xf2beaaf490794158)},
+    0
+  },
+  {
+    {W(0xe8b97932b88756dd), W(0xed4e8652f17e3e61), W(0xc2dd14993ee1c4a4),
+     W(0xc0aaee17597f8c0e)},
+    {W(0x15c4edb96c168af3), W(0x6563c7bfb39ae875), W(0xadfadb6f20adb436),
+     W(0xad55e8c99a042ac0)},
+    0
+  },
+  {
+    {W(0x0a50b12e523b8bf6), W(0x8009eb5b8f910c1b), W(0xf535af824a167588),
+     W(0x0f835f9cfb2a2abd)},
+    {W(0xf59b29312afceb62), W(0xc797df2a169d383f), W(0xeb3f5fb066ac02b0),
+     W(0x029d4c6fdaa2d0ca)},
+    0
+  },
+  {
+    {W(0x65c29219909523c8), W(0xa62f648fa3a1c741), W(0x88598d4f60c9e55a),
+     W(0xbce9141b0e4f347a)},
+    {W(0x9af97d8435f9b988), W(0x0210da62320475b6), W(0x3c076e229191476c),
+     W(0x7520dbd944fc7834)},
+    0
+  },
+  {
+    {W(0x87a7ebd1e0a1b12a), W(0x1e4ef88d770ba95f), W(0x8c33345cdc2ae9cb),
+     W(0xcecf127601cc8403)},
+    {W(0x687c012e1b39b80f), W(0xfd90d0ad35c33ba4), W(0xa3ef5a675c9661c2),
+     W(0x368fc88ee017429e)},
+    0
+  },
+  {
+    {W(0x664300b07850ec06), W(0xac5a38b97d3a10cf), W(0x9233188de34ab39d),
+     W(0xe77057e45072cbb9)},
+    {W(0xbcf0c042b59e78df), W(0x4cfc91e81d97de52), W(0x4661a26c3ee0ca4a),
+     W(0x5620a4c1fb8507bc)},
+    0
+  },
+  {
+    {W(0xb82226052b7ce542), W(0xe6d4ce997472bde1), W(0x53e16ebe09d2f4da),
+     W(0x180ff42e53b92b2e)},
+    {W(0xc59bcc022c34a1c6), W(0x3803d6f9422c46c2), W(0x18aff74f5c14a8a2),
+     W(0x55aebf8010a08b28)},
+    0
+  },
+  {
+    {W(0x84b9ca1504b6c5a0), W(0x35216f3918f0e3a3), W(0x3ec2d2bcbd986c00),
+     W(0x8bf546d9d19228fe)},
+    {W(0xd1c655a44cd623c3), W(0x366ce718502b8e5a), W(0x2cfc84b4eea0bfe7),
+     W(0xe01d5ceecf443e8e)},
+    0
+  },
+  {
+    {W(0xb956970e2fdd23cc), W(0xb80288bc5682e971), W(0xe6e6d91e9ae86ebc),
+     W(0x0564c83f8c9f1939)},
+    {W(0x551932a239560368), W(0xe893752b049c28e2), W(0x0b03cee5a6a158c3),
+     W(0xe12d656b04964263)},
+    0
+  },
+  {
+    {W(0xa75feacabe063f64), W(0x9b392f43bce47a09), W(0xd42415091ad07aca),
+     W(0x4b0c591b8d26cd0f)},
+    {W(0x2d42ddfd92f1169a), W(0x63aeb1ac4cbf2392), W(0x1de9e8770691a2af),
+     W(0xebe79af7d98021da)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x58af2010f5b343bc), W(0x0f2e400af2f142fe), W(0x3483bfdea85f4bdf),
+     W(0xf0b1d09303bfeaa9)},
+    {W(0x2ea01b95c7081603), W(0xe943e4c93dba1097), W(0x47be92adb438f3a6),
+     W(0x00bb7742e5bf6636)},
+    0
+  },
+  {
+    {W(0xb674481b7bfe7178), W(0x4e1debae65405868), W(0x061b2821c48c867d),
+     W(0x69c15b35513b30ea)},
+    {W(0x3b4a166636871088), W(0xe5e29f5d1220b1ff), W(0x4b82bb35233d9f4d),
+     W(0x4e07633318cdc675)},
+    0
+  },
+  {
+    {W(0x3a63c39731815e69), W(0x6df9cbd6dcdd2802), W(0x4c47ed4a15b4f6af),
+     W(0x62009d826ac0f978)},
+    {W(0x664d80d28b898fc7), W(0x72f1eeda2c17c91f), W(0x9e84d3bc7aae6609),
+     W(0x58c7c19528376895)},
+    0
+  },
+  {
+    {W(0x0d53f5c7a3e6fced), W(0xe8cbbdd5f45fbdeb), W(0xf85c01df13339a70),
+     W(0x0ff71880142ceb81)},
+    {W(0x4c4e8774bd70437a), W(0x5fb32891ba0bda6a), W(0x1cdbebd2f18bd26e),
+     W(0x2f9526f103a9d522)},
+    0
+  },
+  {
+    {W(0xa752c905a8271d7e), W(0x4735dfa558e5810b), W(0xe18a44ee5d925aeb),
+     W(0x9708697f13c8a853)},
+    {W(0x8377d540bfcc9a0b), W(0x7b27e01ce574d403), W(0x3d3d180ccf60a8a6),
+     W(0xe48ef152f1c298bf)},
+    0
+  },
+  {
+    {W(0x313a2e8c0aeaa3c0), W(0x89f46d9eabe85b0a), W(0xd2889ebd2da97d3a),
+     W(0x9484026a103f8cba)},
+    {W(0x52159f8a87d83b5f), W(0xdb2220d6b1ef0295), W(0xbda0746e03c01acf),
+     W(0x4f97b2a714419fe3)},
+    0
+  },
+  {
+    {W(0xccbf7ac2c880e5ca), W(0x8299dbee8d11c450), W(0xbb27d11b0f77a6bf),
+     W(0xc601630b5edce793)},
+    {W(0xdb73b9fb79e7f8ea), W(0xe448bba7f4367288), W(0xf5b6416fb035571b),
+     W(0x981b8f5da48891a2)},
+    0
+  },
+  {
+    {W(0x40ce305192c4d684), W(0x8b04d7257612efcd), W(0xb9dcda366f9cae20),
+     W(0x0edc4d24f058856c)},
+    {W(0x64f2e6bf85427900), W(0x3de81295dc09dfea), W(0xd41b4487379bf26c),
+     W(0x50b62c6d6df135a9)},
+    0
+  },
+  {
+    {W(0x30268c47a26a3132), W(0xfaa24ba46ce92605), W(0x080e39339c8184a6),
+     W(0x2e53814fb44fef0c)},
+    {W(0x88a1264546e604cf), W(0xb7e29b6210c8cc08), W(0x99786232d2323e0a),
+     W(0x8621cd5a3f46e27e)},
+    0
+  },
+  {
+    {W(0xc8b0fcfa812daad6), W(0xeb2d94261d8c83e5), W(0xf38308e53329914f),
+     W(0xf91936777bba9587)},
+    {W(0x6e156debe9c8c90e), W(0x42b3a651cad597d3), W(0x3006455813a47dd7),
+     W(0x542c59f363b883e6)},
+    0
+  },
+  {
+    {W(0xea4f5e09f9a92333), W(0x4c24b97c5cb3bd9f), W(0xd30068e239cb87fc),
+     W(0xeeaff323ee80c7f0)},
+    {W(0xdd78de4727429e07), W(0x4ce46496648eb245), W(0xdcdae2f00fc62d56),
+     W(0xa9a81d6003913c29)},
+    0
+  },
+  {
+    {W(0xd4f8e3b4c72dfe67), W(0xc416b0f690e19fdf), W(0x18b9098d4c13bd35),
+     W(0xac11118a15b8cb9e)},
+    {W(0xf598a318f0062841), W(0xbfe0602f89f356f4), W(0x7ae3637e30177a0c),
+     W(0x3409774761136537)},
+    0
+  },
+  {
+    {W(0xce9cf0c3e380a61b), W(0x9be54396b46206f6), W(0x09d7c5751e6abde0),
+     W(0xf47427fff335babe)},
+    {W(0x96a068a843e9153c), W(0x2978f85ce3cdabd6), W(0x12a44e36dd3d907f),
+     W(0x3e56685538c641bd)},
+    0
+  },
+  {
+    {W(0x4e7685b516f79ba1), W(0xa46959ab22ed8426), W(0xd0d185446be3079f),
+     W(0x06cf8a6bb705da67)},
+    {W(0x2b355ff247ab820a), W(0xde02b764a8dc3b5a), W(0x494bed48d4083b27),
+     W(0x2811ca4a14eb4e0a)},
+    0
+  },
+  {
+    {W(0x4a9c94e24261867f), W(0xb6b24ec9d3539fef), W(0x5f03e7006bb3fef3),
+     W(0x4c480bc969a0f34a)},
+    {W(0x1be1df5ba001f9d9), W(0xef662cb4cdc2be56), W(0x2021de7d9135e8fd),
+     W(0x01f892f8710e6751)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0db2fb5ed005832a), W(0x5f5efd3b91042e4f), W(0x8c4ffdc6ed70f8ca),
+     W(0xe4645d0bb52da9cc)},
+    {W(0x9596f58bc9001d1f), W(0x52c8f0bc4e117205), W(0xfd4aa0d2e398a084),
+     W(0x815bfe3a104f49de)},
+    0
+  },
+  {
+    {W(0x54eb3acce548b37b), W(0xb38e754284d40549), W(0x8c3daa517b341b4f),
+     W(0x2f6928ec690bf7fa)},
+    {W(0x0496b32386ce6c41), W(0x01be1c5510adadcd), W(0xc04e67e74bb5faf9),
+     W(0x3cbaf678e15c9985)},
+    0
+  },
+  {
+    {W(0x524d226ad7ab9a2d), W(0x9c00090d7dfae958), W(0x0ba5f5398751d8c2),
+     W(0x8afcbcdd3ab8262d)},
+    {W(0x57392729e99d043b), W(0xef51263baebc943a), W(0x9feace9320862935),
+     W(0x639efc03b06c817b)},
+    0
+  },
+  {
+    {W(0xe839be7d341d81dc), W(0xcddb688932148379), W(0xda6211a1f7026ead),
+     W(0xf3b2575ff4d1cc5e)},
+    {W(0x40cfc8f6a7a73ae6), W(0x83879a5e61d5b483), W(0xc5acb1ed41a50ebc),
+     W(0x59a60cc83c07d8fa)},
+    0
+  },
+  {
+    {W(0xdec98d4ac3b81990), W(0x1cb837229e0cc8fe), W(0xfe0b0491d2b427b9),
+     W(0x0f2386ace983a66c)},
+    {W(0x930c4d1eb3291213), W(0xa2f82b2e59a62ae4), W(0x77233853f93e89e3),
+     W(0x7f8063ac11777c7f)},
+    0
+  },
+  {
+    {W(0x604ac97c59371000), W(0xe1c48c707f759c18), W(0x3f62ecc5a5db6b65),
+     W(0x0a78b17338a21495)},
+    {W(0x6be1819dbcc8ad94), W(0x70dc04f6d89c3400), W(0x462557b4a6b4840a),
+     W(0x544c6ade60bd21c0)},
+    0
+  },
+  {
+    {W(0x36e607cf02ff6072), W(0xa47d2ca98ad98cdc), W(0xbf471d1ef5f56609),
+     W(0xbcf86623f264ada0)},
+    {W(0xb70c0687aa9e5cb6), W(0xc98124f217401c6c), W(0x8189635fd4a61435),
+     W(0xd28fb8afa9d98ea6)},
+    0
+  },
+  {
+    {W(0x439530b665c7322d), W(0xcf12cc01b3c1b3fb), W(0xc70b01860172f685),
+     W(0xb915ee221b58391d)},
+    {W(0x9afdf03ba317db24), W(0x87dec65917b8ffc4), W(0x7f46597be4d3d050),
+     W(0x80a1c1ed006500e7)},
+    0
+  },
+  {
+    {W(0x3d4da8c3017025f3), W(0xefcf628cfb9579b4), W(0x5c4d00161f3716ec),
+     W(0x9c27ebc46801116e)},
+    {W(0x5eba0ea11da1767e), W(0xfe15145247004c57), W(0x3ace6df68c2373b7),
+     W(0x75c3dffe5dbc37ac)},
+    0
+  },
+  {
+    {W(0xa2a147dba28a0749), W(0x246c20d6ee519165), W(0x5068d1b1d3810715),
+     W(0xb1e7018c748160b9)},
+    {W(0x03f5b1faf380ff62), W(0xef7fb1ddf3cb2c1e), W(0xeab539a8fc91a7da),
+     W(0x83ddb707f3f9b561)},
+    0
+  },
+  {
+    {W(0xb57276d980101b98), W(0x760883fdb82f0f66), W(0x89d7de754bc3eff3),
+     W(0x03b606435dc2ab40)},
+    {W(0xcd6e53dfe05beeac), W(0xf2f1e862bc3325cd), W(0xdd0f7921774f03c3),
+     W(0x97ca72214552cc1b)},
+    0
+  },
+  {
+    {W(0xe79a4af09cec46ea), W(0xb15347a1658b9bc7), W(0x6bd2796f35af2f75),
+     W(0xac9579904051c435)},
+    {W(0x2669dda3c33a655d), W(0x5d503c2e88514aa3), W(0xdfa113373753dd41),
+     W(0x3f0546730b754f78)},
+    0
+  },
+  {
+    {W(0x760cb3b5e224c5d7), W(0xfa3baf8c68616919), W(0x9fbca1138d142552),
+     W(0x1ab18bf17669ebf5)},
+    {W(0x55e6f53e9bdf25dd), W(0x04cc0bf3cb6cd154), W(0x595bef4995e89080),
+     W(0xfe9459a8104a9ac1)},
+    0
+  },
+  {
+    {W(0x49d66316a8123ef0), W(0x73c32db4e7f95438), W(0x2e2ed2090d9e7854),
+     W(0xf98a93299d9f0507)},
+    {W(0xc5d33cf60c6aa20a), W(0x9a32ba1475279bb2), W(0x7e3202cb774a7307),
+     W(0x64ed4bc4e8c42dbd)},
+    0
+  },
+  {
+    {W(0x694b64c5abb020e8), W(0x3d18c18419c4eec7), W(0x9c4673ef1c4793e5),
+     W(0xc7b8aeb5056092e6)},
+    {W(0x3aa1ca43f0f8c16b), W(0x224ed5ecd679b2f6), W(0x0d56eeaf55a205c9),
+     W(0xbfe115ba4b8e028b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3e22a7b397acf4ec), W(0x0426c4005ea8b640), W(0x5e3295a64e969285),
+     W(0x22aabc59a6a45670)},
+    {W(0xb929714c5f5942bc), W(0x9a6168bdfa3182ed), W(0x2216a665104152ba),
+     W(0x46908d03b6926368)},
+    0
+  },
+  {
+    {W(0xa9f5d8745a1251fb), W(0x967747a8c72725c7), W(0x195c33e531ffe89e),
+     W(0x609d210fe964935e)},
+    {W(0xcafd6ca82fe12227), W(0xaf9b5b960426469d), W(0x2e9ee04c5693183c),
+     W(0x1084a333c8146fef)},
+    0
+  },
+  {
+    {W(0xce06b88210395755), W(0x117ce6345ec1df80), W(0xfefae513eff55e96),
+     W(0xcf36cba6fd7fed1e)},
+    {W(0x7340eca9a40ebf88), W(0xe6ec1bcfb3d37e12), W(0xca51b64e86bbf9ff),
+     W(0x4e0dbb588b40e05e)},
+    0
+  },
+  {
+    {W(0x96649933aed1d1f7), W(0x566eaff350563090), W(0x345057f0ad2e39cf),
+     W(0x148ff65b1f832124)},
+    {W(0x042e89d4cf94cf0d), W(0x319bec84520c58b3), W(0x2a2676265361aa0d),
+     W(0xc86fa3028fbc87ad)},
+    0
+  },
+  {
+    {W(0x359d7b9c7ea2ee34), W(0x3fd0d94c09cc3a71), W(0xbb53c31c3a1ea37a),
+     W(0x533425facf818c87)},
+    {W(0x7cd199c3810156e0), W(0x0ea020e430c16448), W(0xe557ba094a642542),
+     W(0xe657e7e79465f5ea)},
+    0
+  },
+  {
+    {W(0xfc83d2ab5c8b06d5), W(0xb1a785a2fe4eac46), W(0xb99315bc846f7779),
+     W(0xcf31d816ef9ea505)},
+    {W(0x2391fe6a15d7dc85), W(0x2f132b04b4016b33), W(0x29547fe3181cb4c7),
+     W(0xdb66d8a6650155a1)},
+    0
+  },
+  {
+    {W(0x59cd0e8b593d070f), W(0x437575165255625d), W(0x551fdda75b7a0399),
+     W(0x7bb6e6b02dec1eeb)},
+    {W(0x729bb662334c0922), W(0x3df631df0cf41b79), W(0x01abf3c578f32402),
+     W(0xfcb4666c9cd33c88)},
+    0
+  },
+  {
+    {W(0x6b66d7e1adc1696f), W(0x98ebe5930acd72d0), W(0x65f24550cc1b7435),
+     W(0xce231393b4b9a5ec)},
+    {W(0x234a22d4db067df9), W(0x98dda095caff9b00), W(0x1bbc75a06100c9c1),
+     W(0x1560a9c8939cf695)},
+    0
+  },
+  {
+    {W(0x2eda49f33e775810), W(0xa99a9e114221330d), W(0x4950e422aeaa3943),
+     W(0x9dd4df581824ea7c)},
+    {W(0x71a21dcddfbe0f02), W(0x36c417b16fbb081d), W(0xe6f90483f1a3d306),
+     W(0x515118fb5c500cd5)},
+    0
+  },
+  {
+    {W(0xcf006d3e99e0925f), W(0x2dd74a966322375a), W(0xc58b446ab56af5ba),
+     W(0x50292683e0b9b4f1)},
+    {W(0xe2c34cb41aeaffa3), W(0x8b17203f9b9587c1), W(0x6d559207ead1350c),
+     W(0x2b66a215fb7f9604)},
+    0
+  },
+  {
+    {W(0x73bdff5cae037562), W(0x4af7123feb56d4cd), W(0xaf2042d4796bdfe6),
+     W(0xe11cdf88fdc548d3)},
+    {W(0x1139fa4916a048c8), W(0x7ee12a2fc6276a86), W(0xc7e286bbb5062f0b),
+     W(0xa88e1e89d0ade296)},
+    0
+  },
+  {
+    {W(0x0850325efe51bf74), W(0x9c4f579e5e460094), W(0x5c87b92a76da2f25),
+     W(0x889de4e06febef33)},
+    {W(0x6900ec06646083ce), W(0xbe2a0335bfe12773), W(0xadd1da35c5344110),
+     W(0x757568b7b802cd20)},
+    0
+  },
+  {
+    {W(0x650597415ccee85c), W(0x92d24c0eb5577607), W(0x3c97ab26f63d9b4c),
+     W(0x609e521fd7e1cb68)},
+    {W(0xe33685c5ef326143), W(0x3fcbe499fce7e5a0), W(0xb76cbfadf9c1e69c),
+     W(0x643b6de4dfdb6724)},
+    0
+  },
+  {
+    {W(0x7555977900f7e6c8), W(0x38e8b94f0facd2f0), W(0xfea1f3af03fde375),
+     W(0x5e11a1d875881dfc)},
+    {W(0xb3a6b02ec1e2f2ef), W(0x193d2bbbc605a6c5), W(0x325ffeee339a0b2d),
+     W(0x27b6a7249e0c8846)},
+    0
+  },
+  {
+    {W(0xdc6ba4f6cba8c05e), W(0x512c615f7ccea6e3), W(0x8bb9168e8840ec5b),
+     W(0xb63c2e0b6af43f4b)},
+    {W(0x9064b6e1e2aa567a), W(0x71cbc7127b504205), W(0x0e53fa506187de4f),
+     W(0xd83ed1ccf2e5dee8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe4050f1cf1c367ca), W(0x9bc85a9bc90fbc7d), W(0xa373c4a2e1a11032),
+     W(0xb64232b7ad0393a9)},
+    {W(0xf5577eb0167dad29), W(0x1604f30194b78ab2), W(0x0baa94afe829348b),
+     W(0x77fbd8dd41654342)},
+    0
+  },
+  {
+    {W(0x31f14802fcf0a7fd), W(0x42fd07895488b01e), W(0x71d78d6d9952b498),
+     W(0x8eb572d907ac5201)},
+    {W(0xe0a2a44c4d194a88), W(0xd2b63fd9ba017e66), W(0x78efc6c8f888aefc),
+     W(0xb76f6bda4a881a11)},
+    0
+  },
+  {
+    {W(0xa2f7932c68af43ee), W(0x5502468e703d00bd), W(0xe5dc978f2fb061f5),
+     W(0xc9a1904a28c815ad)},
+    {W(0xd3af538d470c56a4), W(0x159abc5f193d8ced), W(0x2a37245f20108ef3),
+     W(0xfa17081e223f7178)},
+    0
+  },
+  {
+    {W(0x1fe2a9b2b4b4b67c), W(0xc1d10df0e8020604), W(0x9d64abfcbc8058d8),
+     W(0x8943b9b2712a0fbb)},
+    {W(0x90eed9143b3def04), W(0x85ab3aa24ce775ff), W(0x605fd4ca7bbc9040),
+     W(0x8b34a564e2c75dfb)},
+    0
+  },
+  {
+    {W(0x5c18acf88e2f7d90), W(0xfdbf33d777be32cd), W(0x0a085cd7d2eb5ee9),
+     W(0x2d702cfbb3201115)},
+    {W(0xb6e0ebdb85c88ce8), W(0x23a3ce3c1e01d617), W(0x3041618e567333ac),
+     W(0x9dd0fd8f157edb6b)},
+    0
+  },
+  {
+    {W(0xb2b2610798fa7aaa), W(0x41209ee4f073aa4e), W(0xf1570359f2d6b19b),
+     W(0xcbe6868cfc577caf)},
+    {W(0x186c4bdc32c04dd3), W(0xa6c35faecfeee397), W(0xb4a1b312f086c0cf),
+     W(0xe0a5ccc6d9461fe2)},
+    0
+  },
+  {
+    {W(0x516ff3a36fa6110c), W(0x74fb1eb1fb93561f), W(0x6c0c90478457522b),
+     W(0xcfd321046bb8bdc6)},
+    {W(0x2d6884a2cc80ad57), W(0x7c27fc3586a9b637), W(0x3461baedadf4e8cd),
+     W(0x1d56251a617242f0)},
+    0
+  },
+  {
+    {W(0xb84011a9431dd80e), W(0xeb7c7cca73306cd9), W(0x20fadd29d1b3b730),
+     W(0x83858b5bfe37b3d3)},
+    {W(0xbf4cd193b6251d5c), W(0x1cca1fd31352d952), W(0xc66157a490fbc051),
+     W(0x7990a63889b98636)},
+    0
+  },
+  {
+    {W(0x892c81a321175ec1), W(0x9159a505ee018109), W(0xc70130532d8be316),
+     W(0x76060c21426fa2e5)},
+    {W(0x074d2dfc6b6f0f22), W(0x9725fc64ca01a671), W(0x3f6679b92770bd8e),
+     W(0x8fe6604fd7c9b3fe)},
+    0
+  },
+  {
+    {W(0xce711154b6e00a84), W(0xd9fe7e4224890e60), W(0xd10bc6c34560988f),
+     W(0xbdc2ef526859b004)},
+    {W(0xdcf0d868d5c890ee), W(0x893115e6119c47dc), W(0xe97966fbee714567),
+     W(0x117813355c85aa53)},
+    0
+  },
+  {
+    {W(0x71d530cc73204349), W(0xc9df473d94a0679c), W(0xc572f0014261e031),
+     W(0x9786b71f22f135fe)},
+    {W(0xed6505fa6b64e56f), W(0xe2fb48e905219c46), W(0x0dbec45bedf53d71),
+     W(0xd7d782f2c589f406)},
+    0
+  },
+  {
+    {W(0x350fb66b73ed0966), W(0x968e4b082886032b), W(0x5a16ed6e88390493),
+     W(0x0a83ce84a121edbe)},
+    {W(0x7c86fc10a3d9cda0), W(0x5a40a6d595ce67fb), W(0x6cb8cda7f937dbf6),
+     W(0x95b44768651f6283)},
+    0
+  },
+  {
+    {W(0x06513c8a446cd7f4), W(0x158c423b906d52a6), W(0x71503261c423866c),
+     W(0x4b96f57093c148ee)},
+    {W(0x5daf9cc7239a8523), W(0x611b597695ac4b8b), W(0xde3981db724bf7f6),
+     W(0x7e7d0f7867afc443)},
+    0
+  },
+  {
+    {W(0x984f101ed6fc3837), W(0x340bf99f5e1b3a09), W(0xbb96036f06942626),
+     W(0x7bc878ab0c7da618)},
+    {W(0xb37416441c6fb035), W(0xc65bd5aea182fe9f), W(0x1b9c2fb86cc7a67a),
+     W(0x8d1b19af5ce68d7d)},
+    0
+  },
+  {
+    {W(0x3d1ab80c8ce59954), W(0x742c5a9478222ac0), W(0x3ddacbf894f878dd),
+     W(0xfc085117e7d54a99)},
+    {W(0xfb0f1dfa21e38ec2), W(0x1c7b59cb16f4ff7f), W(0x988752397ea888fe),
+     W(0x705d270cb10dc889)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe5aa692a87dec0e1), W(0x010ded8df7b39d00), W(0x7b1b80c854cfa0b5),
+     W(0x66beb876a0f8ea28)},
+    {W(0x50d7f5313476cd0e), W(0xa63d0e65b08d3949), W(0x1a09eea953479fc6),
+     W(0x82ae9891f499e742)},
+    0
+  },
+  {
+    {W(0xab58b9105ca7d866), W(0x582967e23adb3b34), W(0x89ae4447cceac0bc),
+     W(0x919c667c7bf56af5)},
+    {W(0x9aec17b160f5dcd7), W(0xec697b9fddcaadbc), W(0x0b98f341463467f5),
+     W(0xb187f1f7a967132f)},
+    0
+  },
+  {
+    {W(0x90fe7a1d214aeb18), W(0x1506af3c741432f7), W(0xbb5565f9e591a0c4),
+     W(0x10d41a77b44f1bc3)},
+    {W(0xa09d65e4a84bde96), W(0x42f060d8f20a6a1c), W(0x652a3bfdf27f9ce7),
+     W(0xb6bdb65c3b3d739f)},
+    0
+  },
+  {
+    {W(0xeb5ddcb6ec7fae9f), W(0x995f2714efb66e5a), W(0xdee95d8e69445d52),
+     W(0x1b6c2d4609e27620)},
+    {W(0x32621c318129d716), W(0xb03909f10958c1aa), W(0x8c468ef91af4af63),
+     W(0x162c429ffba5cdf6)},
+    0
+  },
+  {
+    {W(0x2f682343753b9371), W(0x29cab45a5f1f9cd7), W(0x571623abb245db96),
+     W(0xc507db093fd79999)},
+    {W(0x4e2ef652af036c32), W(0x86f0cc7805018e5c), W(0xc10a73d4ab8be350),
+     W(0x6519b3977e826327)},
+    0
+  },
+  {
+    {W(0xe8cb5eef9c053df7), W(0x8de25b37b300ea6f), W(0xdb03fa92c849cffb),
+     W(0x242e43a7e84169bb)},
+    {W(0xe4fa51f4dd6f958e), W(0x6925a77ff4445a8d), W(0xe6e72a50e90d8949),
+     W(0xc66648e32b1f6390)},
+    0
+  },
+  {
+    {W(0xb2ab1957173e460c), W(0x1bbbce7530704590), W(0xc0a90dbddb1c7162),
+     W(0x505e399e15cdd65d)},
+    {W(0x68434dcb57797ab7), W(0x60ad35ba6a2ca8e8), W(0x4bfdb1e0de3336c1),
+     W(0xbbef99ebd8b39015)},
+    0
+  },
+  {
+    {W(0x6c3b96f31711ebec), W(0x2da40f1fce98fdc4), W(0xb99774d357b4411f),
+     W(0x87c8bdf415b65bb6)},
+    {W(0xda3a89e3c2eef12d), W(0xde95bb9b3c7471f3), W(0x600f225bd812c594),
+     W(0x54907c5d2b75a56b)},
+    0
+  },
+  {
+    {W(0xa93cc5f08db60e35), W(0x743e3cd6fa833319), W(0x7dad5c41f81683c9),
+     W(0x70c1e7d99c34107e)},
+    {W(0x0edc4a39a6be0907), W(0x36d4703586d0b7d3), W(0x8c76da03272bfa60),
+     W(0x0b4a07ea0f08a414)},
+    0
+  },
+  {
+    {W(0x699e4d2945c1dd53), W(0xcadc5898231debb5), W(0xdf49fcc7a77f00e0),
+     W(0x93057bbfa73e5a0e)},
+    {W(0x2f8b7ecd027a4cd1), W(0x114734b3c614011a), W(0xe7a01db767677c68),
+     W(0x89d9be5e7e273f4f)},
+    0
+  },
+  {
+    {W(0xd225cb2e089808ef), W(0xf1f7a27dd59e4107), W(0x53afc7618211b9c9),
+     W(0x0361bc67e6819159)},
+    {W(0x2a865d0b7f071426), W(0x6a3c1810e7072567), W(0x3e3bca1e0d6bcabd),
+     W(0xa1b02bc1408591bc)},
+    0
+  },
+  {
+    {W(0xe0deee5931fba239), W(0xf47424d398bd91d1), W(0x0f8886f4071a3c1d),
+     W(0x3f7d41e8a819233b)},
+    {W(0x708623c2cf6eb998), W(0x86bb49af609a287f), W(0x942bb24963c90762),
+     W(0x0ef6eea555a9654b)},
+    0
+  },
+  {
+    {W(0x5f6d2d7236f5defe), W(0xfa9922dc56f99176), W(0x6c8c5ecef78ce0c7),
+     W(0x7b44589dbe09b55e)},
+    {W(0xe11b3bca9ea83770), W(0xd7fa2c7f2ab71547), W(0x2a3dd6fa2a1ddcc0),
+     W(0x09acb4305a7b7707)},
+    0
+  },
+  {
+    {W(0x4add4a2e649d4e57), W(0xcd53a2b01917526e), W(0xc526233020b44ac4),
+     W(0x4028746abaa2c31d)},
+    {W(0x5131839064291d4c), W(0xbf48f151ee5ad909), W(0xcce57f597b185681),
+     W(0x7c3ac1b04854d442)},
+    0
+  },
+  {
+    {W(0x65587dc3c093c171), W(0xae7acb2424f42b65), W(0x5a338adb955996cb),
+     W(0xc8e656756051f91b)},
+    {W(0x66711fba28b8d0b1), W(0x15d74137b6c10a90), W(0x70cdd7eb3a232a80),
+     W(0xc9e2f07f6191ed24)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa80d1db6f79588c0), W(0xfa52fc69b55768cc), W(0x0b4df1ae7f54438a),
+     W(0x0cadd1a7f9b46a4f)},
+    {W(0xb40ea6b31803dd6f), W(0x488e4fa555eaae35), W(0x9f047d55382e4e16),
+     W(0xc9b5b7e02f6e0c98)},
+    0
+  },
+  {
+    {W(0xc12738b67c4a658a), W(0xb3c4763940e72182), W(0x3b77be468798e44f),
+     W(0xdc047df217a7f85f)},
+    {W(0x2439d4c55e59d92d), W(0xcedca475e8e64d8d), W(0xa724cd0d87ca9b16),
+     W(0x35e4fd59a5540dfe)},
+    0
+  },
+  {
+    {W(0x4b7d0e0683a7337b), W(0x1e3416d4ffecf249), W(0x24840eff66a2b71f),
+     W(0xd0d9a50ab37cc26d)},
+    {W(0xe21981506fe28ef7), W(0x3cc5ef1623324c7f), W(0x220f3455769b5263),
+     W(0xe2ade2f1a10bf475)},
+    0
+  },
+  {
+    {W(0x9894344f3a29467a), W(0xde81e949c51eba6d), W(0xdaea066ba5e5c2f2),
+     W(0x3fc8a61408c8c7b3)},
+    {W(0x7adff88f06d0de9f), W(0xbbc11cf53b75ce0a), W(0x9fbb7accfbbc87d5),
+     W(0xa1458e267badfde2)},
+    0
+  },
+  {
+    {W(0x03b6c8c7dacddb7d), W(0x92ed50047e1edcad), W(0xa0e46c2f54080633),
+     W(0xcd37663d46dec1ce)},
+    {W(0x396984c5f365b7cc), W(0x294e3a2ae79bb95d), W(0x9aa17d7727b1d3c1),
+     W(0x3ffd3cfae49440f5)},
+    0
+  },
+  {
+    {W(0x041c93e3abb830d1), W(0x2ad235325c2c5270), W(0xaefd1be2ee4b259d),
+     W(0x3ef267771eadd857)},
+    {W(0x2af8f7039b0d7d86), W(0x80f5af2d7b7e6f20), W(0xb5fa1d3ccec8e295),
+     W(0xe73f3902f68f09f6)},
+    0
+  },
+  {
+    {W(0x26679d11399f9cf3), W(0x78e7a48e1e3c4394), W(0x08722dea0d98daf1),
+     W(0x37e7ed5880030ea3)},
+    {W(0xf3731ad43c8aae72), W(0x7878be95ac729695), W(0x6a643affbbc28352),
+     W(0xef8b801b78759b61)},
+    0
+  },
+  {
+    {W(0x1cb43668e039c256), W(0x5f26fb8b7c17fd5d), W(0xeee426af79aa062b),
+     W(0x072002d0d78fbf04)},
+    {W(0x4c9ca237e84fb7e3), W(0xb401d8a10c82133d), W(0xaaa525926d7e4181),
+     W(0xe943083373dbb152)},
+    0
+  },
+  {
+    {W(0xdcdd3709b63afe75), W(0xad9d7f0b3f1af8ff), W(0xdd6a8045194f4bee),
+     W(0x867724cc2f7d998c)},
+    {W(0xd51d0aa5837751be), W(0x21d6754a959a0658), W(0xd2212611695f7e58),
+     W(0xec4b93c2297363ef)},
+    0
+  },
+  {
+    {W(0x0ac1c5fab6ef26cf), W(0xcd8ba0c5a39de8ee), W(0x11ba7537dd7796e0),
+     W(0x1215933476d58d6d)},
+    {W(0xf51eb76f529fda4c), W(0x2fd9209ddedaa8a3), W(0x555a675615efac65),
+     W(0xb784c9ca7fd42fe9)},
+    0
+  },
+  {
+    {W(0x8165ec11b9d1a70f), W(0x01347efc384f6cae), W(0xe95c01a0ab7aeca9),
+     W(0x459ba1c5c6c99530)},
+    {W(0x38967a635cf3416b), W(0x5c3761fd1e5457e2), W(0x43e6077af03e9df6),
+     W(0xb15d34628bd1c7f6)},
+    0
+  },
+  {
+    {W(0x2f5fad1e6ee7c983), W(0xeb0f9d7cb41328f5), W(0x9ba68b441d78d5f7),
+     W(0xa06b3b9e35bc726f)},
+    {W(0xa2550255593e1ff1), W(0x552dd43ddfbec115), W(0x2c48a7abbba8f046),
+     W(0xd4fc56a3ad0bf133)},
+    0
+  },
+  {
+    {W(0xad87d3db35a75c49), W(0xc69d800961af03c5), W(0x31aef61a3a6a6c4c),
+     W(0xb3292640aa10a993)},
+    {W(0x959aae80aaee340f), W(0xf900528e7f381a3b), W(0x44ecf76e853691a3),
+     W(0xa081663ce749e68e)},
+    0
+  },
+  {
+    {W(0xa6ba1683461b35ec), W(0x3ac0f7d3b67f8058), W(0x4fb976f308e6ad9e),
+     W(0x6c4095069c7c6f5f)},
+    {W(0xd8a175e4e9091957), W(0xa1716baea7e4c07a), W(0x3a942fbf59561de8),
+     W(0x9d117777939c9ccb)},
+    0
+  },
+  {
+    {W(0x4f2782136283e34a), W(0x6f9fcf60fbfa315f), W(0x224a2ab99b701364),
+     W(0xb4b1b418f9fecadc)},
+    {W(0xbf7280fe50ba1b9a), W(0x7e68259c33f36db9), W(0x8ccb754e154c9fb0),
+     W(0xf281adb1db2328f1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf92dda31be24319a), W(0x03f7d28be095a8e7), W(0xa52fe84098782185),
+     W(0x276ddafe29c24dbc)},
+    {W(0x80cd54961d7a64eb), W(0xe43608897f1dbe42), W(0x2f81a8778438d2d5),
+     W(0x7e4d52a885169036)},
+    0
+  },
+  {
+    {W(0x7b15fd9d615faa8f), W(0x8fa1eb40968554ed), W(0x7bb4447e7aa44882),
+     W(0x2bb2d0d1029fff32)},
+    {W(0x075e2a646caa6d2f), W(0x8eb879de22e7351b), W(0xbcd5624e9a506c62),
+     W(0x218eaef0a87e24dc)},
+    0
+  },
+  {
+    {W(0x1fe647d83d30a2c5), W(0x0857f77ef78a81dc), W(0x11d5a334131a4a9b),
+     W(0xc0a94af929d393f5)},
+    {W(0xbc3a5c0bdaa6ec1a), W(0xba9fe49388d2d7ed), W(0xbb4335b4bb614797),
+     W(0x991c4d6872f83533)},
+    0
+  },
+  {
+    {W(0x77b868cee978a1d3), W(0xe3a68b337ab92d04), W(0x5102979487a5b862),
+     W(0x5f0606c33a61d41d)},
+    {W(0x2814be276f9326f1), W(0x2f521c14c6fe3c2e), W(0x17464d7dacdf7351),
+     W(0x10f5f9d3777f7e44)},
+    0
+  },
+  {
+    {W(0x1fd84ce43d34a2e3), W(0xee3759ceb43b5d61), W(0x895bc78c619186c7),
+     W(0xf19c3809cbb9725a)},
+    {W(0xc0be21aade744b1f), W(0xa7d222b060f8056b), W(0x74be6157b23efe11),
+     W(0x6fab2b4f0cd68253)},
+    0
+  },
+  {
+    {W(0xb6e33878a4d32282), W(0xe36e029d48020ae7), W(0xe05847fb37a9b750),
+     W(0xf876812cb29e3819)},
+    {W(0x84ad138ed23a17f0), W(0x6d7b4480f0b3950e), W(0xdfa8aef42fd67ae0),
+     W(0x8d3eea2452333af6)},
+    0
+  },
+  {
+    {W(0x2101a522b99a72cb), W(0x06de6e6787618016), W(0x5ff8c7cde6f3653e),
+     W(0x0a821ab5c7a6754a)},
+    {W(0x7e3fa52b7cb0b5a2), W(0xa7fb121cc9048790), W(0x1a72502006ce053a),
+     W(0xb490a31f04e929b0)},
+    0
+  },
+  {
+    {W(0xb06b1244c5f95cd8), W(0xda8c8af0f4ab95f4), W(0x1bae59c2b9e5836d),
+     W(0x07d51e7e3acffffc)},
+    {W(0x01e15e6ac2ccbcda), W(0x3bc1923f8528c3e0), W(0x43324577a49fead4),
+     W(0x61a1b8842aa7a711)},
+    0
+  },
+  {
+    {W(0x4239d571fb167583), W(0xdd011c78d16c8f8a), W(0x271c289569a27519),
+     W(0x9ce0a3b7d2d64b6a)},
+    {W(0x8c977289d5ec6738), W(0xa3b49f9a8840ef6b), W(0x808c14c99a453419),
+     W(0x5c00295b0cf0a2d5)},
+    0
+  },
+  {
+    {W(0x994b37d8affa8208), W(0xc3c31b0bdc29aafc), W(0x3da746517a3a607f),
+     W(0xd8e1b8c1fe6955d6)},
+    {W(0x716e1815c8418682), W(0x541d487f7dc91d97), W(0x48a04669c6996982),
+     W(0xf39cab1583a6502e)},
+    0
+  },
+  {
+    {W(0xa83ccf6e19abd09e), W(0x0b4097c14ff17edb), W(0x58a5c478d64a06ce),
+     W(0x2ddcc3fd544a58fd)},
+    {W(0xd449503d9e8153b8), W(0x3324fd027774179b), W(0xaf5d47c8dbd9120c),
+     W(0xeb86016234fa94db)},
+    0
+  },
+  {
+    {W(0xab53ddbd0f968c00), W(0xa03da7ec000c880b), W(0x7b2396246a9ad24d),
+     W(0x612c040101ec60d0)},
+    {W(0x70d10493109f5df1), W(0xfbda403080af7550), W(0x30b93f95c6b9a9b3),
+     W(0x0c74ec71007d9418)},
+    0
+  },
+  {
+    {W(0xf85c974e6d671192), W(0x1e14100ade16f60f), W(0x45cb0d5a95c38797),
+     W(0x18923bba9b022da4)},
+    {W(0xef2be899bbe7e86e), W(0x4a1510ee216067bf), W(0xd98c815484d5ce3e),
+     W(0x1af777f0f92a2b90)},
+    0
+  },
+  {
+    {W(0x99d53099df1ea40e), W(0xb3f24a0b57d61e64), W(0xd088a198596eb812),
+     W(0x22c8361b5762940b)},
+    {W(0x66f01f97f9c0d95c), W(0x884611728e43cdae), W(0x11599a7fb72b15c3),
+     W(0x135a7536420d95cc)},
+    0
+  },
+  {
+    {W(0x1ed46585c9f84296), W(0x7fbaa8fb3bc278b0), W(0xa8e96cd46c4fcbd0),
+     W(0x940a120273b60a5f)},
+    {W(0x34aae12055a4aec8), W(0x550e9a74dbd742f0), W(0x794456d7228c68ab),
+     W(0x492f8868a4e25ec6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4fe7ee31b0e63d34), W(0xf4600572a9e54fab), W(0xc0493334d5e7b5a4),
+     W(0x8589fb9206d54831)},
+    {W(0xaa70f5cc6583553a), W(0x0879094ae25649e5), W(0xcc90450710044652),
+     W(0xebb0696d02541c4f)},
+    0
+  },
+  {
+    {W(0x758c1a3ea2dee7a6), W(0xdcde2f3c734b2284), W(0xaba445d24eaba6ad),
+     W(0x35aaf66876cee0a7)},
+    {W(0x7e0b04a9e5aa049a), W(0xe74083ad91103e84), W(0xbeb183ce40afecc3),
+     W(0x6b89de9fea043f7a)},
+    0
+  },
+  {
+    {W(0xb99f0e0399375235), W(0x7614c847b9917970), W(0xfec93ce9524ec067),
+     W(0xe40e7bf89b122520)},
+    {W(0xb5670631ee4c4774), W(0x6f03847a3b04914c), W(0xc96e9429dc9dd226),
+     W(0x43489b6c8c57c1f8)},
+    0
+  },
+  {
+    {W(0x0e299d23fe67ba66), W(0x9145076093cf2f34), W(0xf45b5ea997fcf913),
+     W(0x5be008438bd7ddda)},
+    {W(0x358c3e05d53ff04d), W(0xbf7ccdc35de91ef7), W(0xad684dbfb69ec1a0),
+     W(0x367e7cf2801fd997)},
+    0
+  },
+  {
+    {W(0x46ffd227cc2338fb), W(0x89ff6fa990e26153), W(0xbe570779331a0076),
+     W(0x43d241c506e1f3af)},
+    {W(0xfdcdb97dde9b62a3), W(0x6a06e984a0ae30ea), W(0xc9bf16804fbddf7d),
+     W(0x170471a2d36163c4)},
+    0
+  },
+  {
+    {W(0xff5ba8ae3113655e), W(0xfa2c6e2b57b83180), W(0x1c48271977e0eabe),
+     W(0xf9f3c555337fea97)},
+    {W(0x340f7022a42581cb), W(0xe1de0bc218f710e3), W(0xee640adef62e5aa8),
+     W(0x16b2389149428940)},
+    0
+  },
+  {
+    {W(0x361619e455950cc3), W(0xc71d665c56b66bb8), W(0xea034b34afac6d84),
+     W(0xa987f832e5e4c7e3)},
+    {W(0xa07427727a79a6a7), W(0x56e5d017e26d6c23), W(0x7e50b97638167e10),
+     W(0xaa6c81efe88aa84e)},
+    0
+  },
+  {
+    {W(0x0ca1f3b7b0dc8595), W(0x27de46089f1d9f2e), W(0x1af3bf39badd82a7),
+     W(0x79356a7965862448)},
+    {W(0xc0602345f5f9a052), W(0x1a8b0f89139a42f9), W(0xb53eee42844d40fc),
+     W(0x93b0bfe54e5b6368)},
+    0
+  },
+  {
+    {W(0x473959d74d325bbf), W(0x2a61beec8d6114b9), W(0x25672a94924be2ee),
+     W(0xa48595dbf2c23d0c)},
+    {W(0xe476848b6a221838), W(0xe743e69a35c1b673), W(0x2ab42499d8468503),
+     W(0x62aa0054e9e90ba7)},
+    0
+  },
+  {
+    {W(0x358d13f1bc482911), W(0x685d1971b7fa7f26), W(0x3e67a51d2be1aee4),
+     W(0xe041850998d114a9)},
+    {W(0x59639f604e052561), W(0x32075c49155d0818), W(0x2aa2343b67b64b1c),
+     W(0x1b445e2967f53e6a)},
+    0
+  },
+  {
+    {W(0xbdfb271773a904e0), W(0x7ce1e40b28888d73), W(0x2e7e35f6eaa97d1b),
+     W(0xd061772aa9afa097)},
+    {W(0x434ac7c47a1f7c59), W(0x6e21124ae79b7b9a), W(0x055acff3bb22ecc7),
+     W(0x8bfd7ac984c858d3)},
+    0
+  },
+  {
+    {W(0x5434dd02c024789c), W(0x90dca9ea41b57bfc), W(0x8aa898e2243398df),
+     W(0xf607c834894a94bb)},
+    {W(0xbb07be97c2c99b76), W(0x6576ba6718c29302), W(0x3d79efcce703a88c),
+     W(0xf259ced7b6a0d106)},
+    0
+  },
+  {
+    {W(0x2fd57df59f1f68ad), W(0x5ddcc6dbb06470c8), W(0x801b6451a9b47307),
+     W(0x6b51c8e376551bf4)},
+    {W(0xef0bd1f7d44e1da9), W(0x714bcb1d4d4e600c), W(0xc57bb9e40c6540c7),
+     W(0x71bd1ec2327cc644)},
+    0
+  },
+  {
+    {W(0x00cd33b5cfd84f0a), W(0xcfa568f74e6b0ddd), W(0x1c694edb2d0f48f4),
+     W(0x2747c7ccfeff7dd8)},
+    {W(0xcedaecadac8c24b2), W(0xdb29de3f0742a5e5), W(0xe35d8fbb3090296d),
+     W(0x788cabf7b11fb54a)},
+    0
+  },
+  {
+    {W(0x9a52cf7e7f4dd81f), W(0xa0132be15e69c05e), W(0x90dab7472a0f4d72),
+     W(0xc142f911312d6706)},
+    {W(0xe8d3631f8261998b), W(0xf0f42fae615c1c94), W(0x2f4e948caec3fa5d),
+     W(0x242ae7a8a374101e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0f893a5dc8de610b), W(0xe8c515fb67e223ce), W(0x7774bfa64ead6dc5),
+     W(0x89d20f95925c728f)},
+    {W(0x7a1e0966098583ce), W(0xa2eedb9493f2a7d7), W(0x1b2820974c304d4a),
+     W(0x0842e3dac077282d)},
+    0
+  },
+  {
+    {W(0xa1010e9d74cd06ff), W(0x9c17c7dfaca3eeac), W(0x74c86cd38063aa2b),
+     W(0x8595c4b3734614ff)},
+    {W(0xa3de00ca990f62cc), W(0xd9bed213ca0c3be5), W(0x7886078adf8ce9f5),
+     W(0xddb27ce35cd44444)},
+    0
+  },
+  {
+    {W(0x5a3097befc15aa1e), W(0x40d12548b54b0745), W(0x5bad4706519a5f12),
+     W(0xed03f717a439dee6)},
+    {W(0x0794bb6c4a02c499), W(0xf725083dcffe71d2), W(0x2cad75190f3adcaf),
+     W(0x7f68ea1c43729310)},
+    0
+  },
+  {
+    {W(0x9c7c581d26ee8382), W(0xcf17dcc5359d638e), W(0xee8273abb728ae3d),
+     W(0x1d112926f821f047)},
+    {W(0x1149847750491a74), W(0x687fa761fde0dfb9), W(0x2c2580227ea435ab),
+     W(0x6b8bdb9491ce7e3f)},
+    0
+  },
+  {
+    {W(0x9c806d8af7f91d0f), W(0x3b61b0f1a82a5728), W(0x4640032d94d76754),
+     W(0x273eb5de47d834c6)},
+    {W(0x2988abf77b4e4d53), W(0xb7ce66bfde401777), W(0x9fba6b32715071b3),
+     W(0x82413c24ad3a1a98)},
+    0
+  },
+  {
+    {W(0x75537b7e3cc8ac85), W(0x8d725f57dd02753b), W(0xfd05ff64b737df2f),
+     W(0x55fe8712f6d2531d)},
+    {W(0x57ce04a96ab6b01c), W(0x69a02a897cd93724), W(0x4f82ac35cf86699b),
+     W(0x8242d3ad9cb4b232)},
+    0
+  },
+  {
+    {W(0x69c435269be47be0), W(0x323b7dd8cb28fea1), W(0xfa5538ba3a6c67e5),
+     W(0xef921d701d378e46)},
+    {W(0xf92961fc3c4b880e), W(0x3f6f914e98940a67), W(0xa990eb0afef0ff39),
+     W(0xa6c2920ff0eeff9c)},
+    0
+  },
+  {
+    {W(0xb23a03a553fb2b56), W(0x6ce141e74e057f78), W(0x796525c389e490d9),
+     W(0x0bc95725a31a7e75)},
+    {W(0x1ec567911220fd06), W(0x716e3a3c408b0bd6), W(0x31cd6bf7e8ebeba9),
+     W(0xa7326ca6bee6b670)},
+    0
+  },
+  {
+    {W(0x70b63d32343bf1a9), W(0x8fd3bd2837d1a6b1), W(0x0454879c316865b4),
+     W(0xee959ff6c458efa2)},
+    {W(0x0461dcf89706dc3f), W(0x737db0e2164e4b2e), W(0x092626802f8843c8),
+     W(0x54498bbc7745e6f6)},
+    0
+  },
+  {
+    {W(0x5341352b5acf6e10), W(0xc50343fdafe652c3), W(0x4af3792d18577a7f),
+     W(0xe1a4c617af16823d)},
+    {W(0x9b26d0cd33425d0a), W(0x306399ed9b7bc47f), W(0x2a792f33706bb20b),
+     W(0x3121961498111055)},
+    0
+  },
+  {
+    {W(0x4c1f428cd5f30851), W(0x94dfed272a4f6630), W(0x4df53772fc5d48a4),
+     W(0xdd2d5a2f933260ce)},
+    {W(0x574115bdd44cc7a5), W(0x4ba6b20dbd12533a), W(0x30e93cb8243057c9),
+     W(0x794c486a14de320e)},
+    0
+  },
+  {
+    {W(0x6095355699f241d7), W(0xee4adbd7001a349d), W(0x0b35bf6aaa89e491),
+     W(0x7f0076f4136f7546)},
+    {W(0xd19a18ba9264da3d), W(0x6eb2d2cd62a7a28b), W(0xcdba941f8761c971),
+     W(0x1550518ba3be4a5d)},
+    0
+  },
+  {
+    {W(0xc232d97302f1cd1e), W(0xce87eacb1dd212a4), W(0x6e4c8c73e69802f7),
+     W(0x12ef02901fffddbd)},
+    {W(0x941ec74e1bcea6e2), W(0xd0b540243cb92cbb), W(0x809fb9d47e8f9d05),
+     W(0x3bf16159f2992aae)},
+    0
+  },
+  {
+    {W(0xb2497007eafbb1e1), W(0xd75c9ce6e75b7a93), W(0x3558352defb68d78),
+     W(0xa2f26699223f6396)},
+    {W(0xeb911ecfe469b17a), W(0x62545779e72d3ec2), W(0x8ea47de782cb113f),
+     W(0xebe4b0864e1fa98d)},
+    0
+  },
+  {
+    {W(0xbdb8e675b055cb40), W(0x898f8e7b977b5167), W(0xecc65651b82fb863),
+     W(0x565448146d88f01f)},
+    {W(0xb0928e95263a75a9), W(0xcfb6836f1a22fcda), W(0x651d14db3f3bd37c),
+     W(0x1d3837fbb6ad4664)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x20d3c982cf7d62d2), W(0x1f36e29d23ba8150), W(0x48ae0bf092763f9e),
+     W(0x7a527e6b1d3a7007)},
+    {W(0xb4a89097581a85e3), W(0x1f1a520fdc158be5), W(0xf98db37d167d726e),
+     W(0x8802786e1113e862)},
+    0
+  },
+  {
+    {W(0xefb2149e36f09ab0), W(0x03f163ca4a10bb5b), W(0xd029704506e20998),
+     W(0x56f0af001b5a3bab)},
+    {W(0x7af4cfec70880e0d), W(0x7332a66fbe3d913f), W(0x32e6c84a7eceb4bd),
+     W(0xedc4a79a9c228f55)},
+    0
+  },
+  {
+    {W(0xf6e894d1f4c6b6ec), W(0x526b082718b3cd9b), W(0x73f952a812117fbf),
+     W(0x2be864b011945bf5)},
+    {W(0x86f18ea542099b64), W(0x2770b28a07548ce2), W(0x97390f28295c1c9c),
+     W(0x672e6a43cb5206c3)},
+    0
+  },
+  {
+    {W(0xc37c7dd0c55c4496), W(0xa6a9635725bbabd2), W(0x5b7e63f2add7f363),
+     W(0x9dce37822e73f1df)},
+    {W(0xe1e5a16ab2b91f71), W(0xe44898235ba0163c), W(0xf2759c32f6e515ad),
+     W(0xa5e2f1f88615eecf)},
+    0
+  },
+  {
+    {W(0xcacce2c847c64367), W(0x6a496b9f45af4ec0), W(0x2a0836f36034042c),
+     W(0x14a1f3900b6c62ea)},
+    {W(0xe7fa93633ef1f540), W(0xd323b30a72a76d93), W(0xffeec8b50feae451),
+     W(0x4eafc172bd04ef87)},
+    0
+  },
+  {
+    {W(0x74519be7abded551), W(0x03d358b8c8b74410), W(0x4d00b10b0e10d9a9),
+     W(0x6392b0b128da52b7)},
+    {W(0x6744a2980b75c904), W(0xc305b0aea8f7f96c), W(0x042e421d182cf932),
+     W(0xf6fc5d509e4636ca)},
+    0
+  },
+  {
+    {W(0xe4435a51b3e59b89), W(0x136139554133a1c9), W(0x87f46973440bee59),
+     W(0x714710f800c401e4)},
+    {W(0xc0cf4bced6c446c9), W(0xe0aa7fd66c4d5368), W(0xde5d811afc68fc37),
+     W(0x61febd72b7c2a057)},
+    0
+  },
+  {
+    {W(0x795847c9d64cc78c), W(0x6c50621b9b6cb27b), W(0x07099bf8df8022ab),
+     W(0x48f862ebc04eda1d)},
+    {W(0xd12732ede1603c16), W(0x19a80e0f5c9a9450), W(0xe2257f54b429b4fc),
+     W(0x66d3b2c645460515)},
+    0
+  },
+  {
+    {W(0x27375fe665f837e2), W(0x93f8c68bd882179f), W(0x584feadc59b16187),
+     W(0xe5b50be9483bc162)},
+    {W(0x7ad9d6f1a2776625), W(0xe9d1008004ff457b), W(0x5b56d322677618a6),
+     W(0x036694eae3e68673)},
+    0
+  },
+  {
+    {W(0x6ca4f87e822e37be), W(0x73f237b4253bda4e), W(0xf747f3a241190aeb),
+     W(0xf06fa36f804cf284)},
+    {W(0x0a6bbb6efc621c12), W(0x5d624b6440b80ec6), W(0x4b0724257ba556f3),
+     W(0x7fa0c3543e2d20a8)},
+    0
+  },
+  {
+    {W(0x6feaffc51d8a4fd1), W(0x59663b205f1ad208), W(0xefc93cef24acb46a),
+     W(0x54929de05967118c)},
+    {W(0x885708009acffb1c), W(0x492bbf2b145639ec), W(0x71f495a638f0018e),
+     W(0xe24365dbc2792847)},
+    0
+  },
+  {
+    {W(0xe921fa31e3229d41), W(0xa929c65294531bd4), W(0x84156027a6d38209),
+     W(0xf3d69f736bdb97bd)},
+    {W(0x8906d19a16833631), W(0x68a34c2e03d51be3), W(0xcb59583b0e511cd8),
+     W(0x99ce6bfdfdc132a8)},
+    0
+  },
+  {
+    {W(0x4bedae86a6f29002), W(0x7abedb56e034457a), W(0x8bf3eec6179bff2a),
+     W(0x9d626d57390f4e6b)},
+    {W(0x653fe0e914dd6ea3), W(0x7483715989bd6d08), W(0x85fb05b4ebd9b03d),
+     W(0x7dc3f2214a768bbc)},
+    0
+  },
+  {
+    {W(0x3facdaaaffcdb463), W(0x658bbc1a34a38b08), W(0x12a801f8f1a9078d),
+     W(0x1567bcf96ab855de)},
+    {W(0xe08498e03572359b), W(0xcf0353e58659e68b), W(0xbb86e9c87d23807c),
+     W(0xbc08728d2198e8a2)},
+    0
+  },
+  {
+    {W(0xaacc63f132b0ed8f), W(0x041237242bafefd2), W(0x0df9a7987e2d2a13),
+     W(0x09bd13cf9c27591f)},
+    {W(0xaa5f5e476e1afb50), W(0xcd146a42b66eb646), W(0x3f07561d1442ec3c),
+     W(0x7e5471738ae8ec47)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8de2b7bc453cadd6), W(0x203900a7bc0bc1f8), W(0xbcd86e47a6abd3af),
+     W(0x911cac128502effb)},
+    {W(0x2d550242ec965469), W(0x0e9f769229e0017e), W(0x633f078f65979885),
+     W(0xfb87d4494cf751ef)},
+    0
+  },
+  {
+    {W(0x6066e2a2d551ee10), W(0x87a8f1d8727e09a6), W(0x00d08bab2c01148d),
+     W(0x6da8e4f1424f33fe)},
+    {W(0x466d17f0cf9a4e71), W(0xff5020103bf5cb19), W(0xdccf97d8d062ecc0),
+     W(0x80c0d9af81d80ac4)},
+    0
+  },
+  {
+    {W(0x1a0445ff1d7aadab), W(0x65d38260d5f6a67c), W(0x6e62fb0891cfb26f),
+     W(0xef1e0fa55c7d91d6)},
+    {W(0x47e7c7ba33db72cd), W(0x017cbc09fa7c74b2), W(0x3c931590f50a503c),
+     W(0xcac54f60616baa42)},
+    0
+  },
+  {
+    {W(0x98857ceb1bf4581c), W(0xe635e186aca7b166), W(0x278ddd22659722ac),
+     W(0xa0903c4c1db68007)},
+    {W(0x366e458948f21402), W(0x31b49c14b96abda2), W(0x329c4b09e0403190),
+     W(0x97197ca3d29f43fe)},
+    0
+  },
+  {
+    {W(0x7173dd5d4b07e2b1), W(0xd144c4cb8d9ea221), W(0xe8b04ea41105ab14),
+     W(0x92dda542fe80d8f1)},
+    {W(0xe9982fa8cf03dce6), W(0x8b5ea9651a22cffc), W(0xf7f4ea7f3fad88c4),
+     W(0x62db773e6a5ba95c)},
+    0
+  },
+  {
+    {W(0x18bd3fb4820357c7), W(0x992039ae6f1458ad), W(0x9a1df3c525b44aa1),
+     W(0x2d780357ed3d5281)},
+    {W(0x58cf7e4dc77ad4d4), W(0xd49a7998f9df4fc4), W(0x4465a8b51d71205e),
+     W(0xa0ee0ea6649254aa)},
+    0
+  },
+  {
+    {W(0x4baae6e89c92b235), W(0xa73bbd0e6b3993a1), W(0xd06d60ec693dd031),
+     W(0x03cab91b7156881c)},
+    {W(0xd615862f1db3574b), W(0x485b018564bb061a), W(0x27434988a0181e06),
+     W(0x2cd61ad4c1c0c757)},
+    0
+  },
+  {
+    {W(0x03e2de1cf3480d4a), W(0xf0d8edc7bc8acf1a), W(0xf23e330368295a9c),
+     W(0xfadd5f68c546a97d)},
+    {W(0x895597ad96f8acb1), W(0xbddd49d5671bdae2), W(0x16fcd52821dd43f4),
+     W(0xa5a454126619141a)},
+    0
+  },
+  {
+    {W(0xc85c34d3030d86a0), W(0xf14b2e80213ce95e), W(0xce3eed9bf07e6d7f),
+     W(0x476c3e21a3a3ec79)},
+    {W(0xb4ec11f2cadea5d3), W(0xd1ad5f12cca936aa), W(0x1724609e34e61c7d),
+     W(0xcc520df32fd67ba2)},
+    0
+  },
+  {
+    {W(0x6bfbe2a8a9a17f2a), W(0x1cac2f6003d95017), W(0x38c062578ea2b48c),
+     W(0x21ca4d5ccc3cc38a)},
+    {W(0xff067a5467452091), W(0x63bfdf5d139d462c), W(0x221376a11450006f),
+     W(0xc81afe5e332a9aec)},
+    0
+  },
+  {
+    {W(0x11a09a99bafea141), W(0x7fe0414b19d41640), W(0xd66b072af3b609d1),
+     W(0x27f7de34bc5554d2)},
+    {W(0xd66529afbc517b45), W(0x8be4352112d18d9f), W(0x942192e14e0defd7),
+     W(0xb465871f90c0af1e)},
+    0
+  },
+  {
+    {W(0xfa32c79f439f29cf), W(0x7bf321c04dd82a3b), W(0xff127f54eaa2c1b1),
+     W(0xa8365f2df35e9618)},
+    {W(0x852d29024d0ef8dd), W(0x395ce2c159228c4a), W(0xb69f44e8215afed3),
+     W(0x16c1f898b27458e3)},
+    0
+  },
+  {
+    {W(0x170f87e0f33f25bc), W(0x24dcb667c339c098), W(0xbf1702a4ab073eae),
+     W(0xada6919c238cfb44)},
+    {W(0x53008511ddee6375), W(0xdb92fa85b8db60ad), W(0x50b6a366a421210e),
+     W(0xdc7bf8eb4c37558f)},
+    0
+  },
+  {
+    {W(0xe47ba1082e4f257e), W(0xcf0ee2df35689d7c), W(0x8b8fc38e321ba0d0),
+     W(0x9470c64c0f745e8b)},
+    {W(0xa73887f5d65fa22f), W(0xa581f89bc2a7efbe), W(0x835a0ba6eee4c98a),
+     W(0x86e183e9a3291a71)},
+    0
+  },
+  {
+    {W(0xfb5487b089e4043b), W(0x4de49def09799bd2), W(0x9da870c0b3e760be),
+     W(0x5e4e1dd389ee1539)},
+    {W(0x1b3849fa915705db), W(0x7ce5e1945eac0e81), W(0x7c1772a0b00d3f5c),
+     W(0x547926766c00b5a1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8ce9b6bfc360e25a), W(0xe6425195075a1a78), W(0x9dc756a8481732f4),
+     W(0x83c0440f5432b57a)},
+    {W(0xc670b3f1d720281f), W(0x2205910ed135e051), W(0xded14b0edb052be7),
+     W(0x697b3d27c568ea39)},
+    0
+  },
+  {
+    {W(0x2e599b9afb3ff9ed), W(0x28c2e0ab17f6515c), W(0x1cbee4fd474da449),
+     W(0x071279a44f364452)},
+    {W(0x97abff6601fbe855), W(0x3ee394e85fda51c4), W(0x190385f667597c0b),
+     W(0x6e9fccc6a27ee34b)},
+    0
+  },
+  {
+    {W(0x0b89de9314092ebb), W(0xf17256bd428e240c), W(0xcf89a7f393d2f064),
+     W(0x4f57841ee1ed3b14)},
+    {W(0x4ee14405e708d855), W(0x856aae7203f1c3d0), W(0xc8e5424fbdd7eed5),
+     W(0x3333e4ef73ab4270)},
+    0
+  },
+  {
+    {W(0x3bc77adedda492f8), W(0xc11a3aea78297205), W(0x5e89a3e734931b4c),
+     W(0x17512e2e9f5694bb)},
+    {W(0x5dc349f3177bf8b6), W(0x232ea4ba08c7ff3e), W(0x9c4f9d16f511145d),
+     W(0xccf109a333b379c3)},
+    0
+  },
+  {
+    {W(0xe75e7a88a1f25897), W(0x7ac6961fa1b5d4d8), W(0xe3e1077308f3ed5c),
+     W(0x208a54ec0a892dfb)},
+    {W(0xbe826e1978660710), W(0x0cf70a97237df2c8), W(0x418a7340ed704da5),
+     W(0xa3eeb9a908ca33fd)},
+    0
+  },
+  {
+    {W(0x49d96233169bca96), W(0x04d286d42da6aafb), W(0xc09606eca0c2fa94),
+     W(0x8869d0d523ff0fb3)},
+    {W(0xa99937e5d0150d65), W(0xa92e2503240c14c9), W(0x656bf945108e2d49),
+     W(0x152a733aa2f59e2b)},
+    0
+  },
+  {
+    {W(0xb4323d588434a920), W(0xc0af8e93622103c5), W(0x667518ef938dbf9a),
+     W(0xa184307383a9cdf2)},
+    {W(0x350a94aa5447ab80), W(0xe5e5a325c75a3d61), W(0x74ba507f68411a9e),
+     W(0x10581fc1594f70c5)},
+    0
+  },
+  {
+    {W(0x60e2857080eb24a9), W(0x7bedfb4d488e0cfd), W(0x721ebbd7c259cdb8),
+     W(0x0b0da855bc6390a9)},
+    {W(0x2b4d04dbde314c70), W(0xcdbf1fbc6c32e846), W(0x33833eabb162fc9e),
+     W(0x9939b48bb0dd3ab7)},
+    0
+  },
+  {
+    {W(0x5aaa98a7cb0c9c8c), W(0x75105f3081c4375c), W(0xceee50575ef1c90f),
+     W(0xb31e065fc23a17bf)},
+    {W(0x5364d275d4b6d45a), W(0xd363f3ad62ec8996), W(0xb5d212394391c65b),
+     W(0x84564765ebb41b47)},
+    0
+  },
+  {
+    {W(0x20d18ecc37107c78), W(0xacff3b6b570c2a66), W(0x22f975d99bd0d845),
+     W(0xef0a0c46ba178fa0)},
+    {W(0x1a41965176b6028e), W(0xc49ec674248612d4), W(0x5b6ac4f27338af55),
+     W(0x06145e627bee5a36)},
+    0
+  },
+  {
+    {W(0x33e95d07e75746b5), W(0x1c1e1f6dc40c78be), W(0x967833ef222ff8e2),
+     W(0x4bedcf6ab49180ad)},
+    {W(0x6b37e9c13d7a4c8a), W(0x2748887c6ddfe760), W(0xf7055123aa3a5bbc),
+     W(0x954ff2257bbb8e74)},
+    0
+  },
+  {
+    {W(0xc42b8ab197c3dfb9), W(0x55a549b0cf168154), W(0xad6748e7c1b50692),
+     W(0x2775780f6fc5cbcb)},
+    {W(0x4eab80b8e1c9d7c8), W(0x8c69dae13fdbcd56), W(0x47e6b4fb9969eace),
+     W(0x002f1085a705cb5a)},
+    0
+  },
+  {
+    {W(0x4e23ca446d3fea55), W(0xb4ae9c86f4810568), W(0x47bfb91b2a62f27d),
+     W(0x60deb4c9d9bac28c)},
+    {W(0xa892d8947de6c34c), W(0x4ee682594494587d), W(0x914ee14e1a3f8a5b),
+     W(0xbb113eaa28700385)},
+    0
+  },
+  {
+    {W(0x81ca03b92115b4c9), W(0x7c163d388908cad1), W(0xc912a118aa18179a),
+     W(0xe09ed750886e3081)},
+    {W(0xa676e3fa26f516ca), W(0x753cacf78e732f91), W(0x51592aea833da8b4),
+     W(0xc626f42f4cbea8aa)},
+    0
+  },
+  {
+    {W(0xef9dc899a7b56eaf), W(0x00c0e52c34ef7316), W(0x5b1e4e24fe818a86),
+     W(0x9d31e20dc538be47)},
+    {W(0x22eb932d3ed68974), W(0xe44bbc087c4e87c4), W(0x4121086e0dde9aef),
+     W(0x8e6b9cff134f4345)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x96892c1f711b0eb9), W(0xb905f2c8780ab954), W(0xace26309a20792db),
+     W(0xec8ac9b30684e126)},
+    {W(0x486ad8b6b40a2447), W(0x60121fc19fe3fb24), W(0x5626fccf1a8e3b3f),
+     W(0x4e5686226ad1f394)},
+    0
+  },
+  {
+    {W(0x5a4b46c64a8a3d62), W(0x8469c4d0247743d2), W(0x2bb3a13d88f7e433),
+     W(0x62b23a1001be5849)},
+    {W(0xe83596b4a63d1a4c), W(0x454e7fea7d183f3e), W(0x643fce6117afb01c),
+     W(0x4e65e5e61c4c3638)},
+    0
+  },
+  {
+    {W(0xe5db77176add8545), W(0x1b71cb6672c49b66), W(0xd856073968421d77),
+     W(0x03840fe883e3afea)},
+    {W(0xb391dad51ec69977), W(0xae243fb9307f6726), W(0xc88ac87be8ca160c),
+     W(0x5174cced4ce355f4)},
+    0
+  },
+  {
+    {W(0xc1e17eb6cbc613e5), W(0x33131d55497ea61c), W(0x2f69d39eaf7eded5),
+     W(0x73c2f434de6af11b)},
+    {W(0x4ca52493a4a375fa), W(0x5f06787cb833c5c2), W(0x814e091f3e6e71cf),
+     W(0x76451f578b746666)},
+    0
+  },
+  {
+    {W(0x5ee6ab8495fe1347), W(0xab0f6c396f24503c), W(0x807e3ffb4486dd6b),
+     W(0xf00b6c748002fef5)},
+    {W(0x48bff9a6a7862999), W(0x85e5a06cbed89e26), W(0x86d311af3d8419eb),
+     W(0x24f3ad7834733f16)},
+    0
+  },
+  {
+    {W(0x5e3e03fc6c68d687), W(0x3e732c3d1ff052c7), W(0xf2d0efa66ed16e7a),
+     W(0x63d92b26b65bb746)},
+    {W(0xffcd82badd44867c), W(0xa71b4a9ef8c081b8), W(0x6c1676a7736c8785),
+     W(0xbe2c06169d8932d0)},
+    0
+  },
+  {
+    {W(0x53376d282bcffbc4), W(0x708817a706eadb7a), W(0x6ff50e05cd35ae69),
+     W(0x63b5fb7574bc7fde)},
+    {W(0x71c9e953e7fe08c4), W(0xb4d8bfd4f583ca18), W(0xde8d788245e81c5c),
+     W(0xa5f5e93ce0474138)},
+    0
+  },
+  {
+    {W(0x80f9bdef694db7e0), W(0xedca8787b9fcddc6), W(0x51981c3403b8dce1),
+     W(0x4274dcf170e10ba1)},
+    {W(0xf72743b86def6d1a), W(0xd25b1670ebdb1866), W(0xc4491e8c050c6f58),
+     W(0x2be2b2ab87fbd7f5)},
+    0
+  },
+  {
+    {W(0xded5c7acac7daf05), W(0x0f06f5ed932f7a24), W(0x8dd86e2053ce3505),
+     W(0xfdbbb2f83cf6f7e6)},
+    {W(0xf4018a7fc9228c12), W(0x5a0ef8d3751c80ab), W(0x36da19374b7158e8),
+     W(0x3cccf44c0d78c85f)},
+    0
+  },
+  {
+    {W(0x067199b77686004c), W(0x9ed28b209abb9135), W(0x25f495998e8f3230),
+     W(0x41df3c8607c1b88e)},
+    {W(0x9d2e7c1149171dc4), W(0x6ccd4d68e51d00fa), W(0x68b7fed58fdd0683),
+     W(0x7c3c1505e55f665c)},
+    0
+  },
+  {
+    {W(0x7f47170afc35268d), W(0x9c105144c98f8f7f), W(0xd442194e9b7613b6),
+     W(0xaac8a2805879a926)},
+    {W(0x51f747bc0c2a78f6), W(0x25445aae63faef51), W(0x4bea10e33ceeec1c),
+     W(0x12cabf7224e08901)},
+    0
+  },
+  {
+    {W(0x9341334e08b2f5ea), W(0x0e1e5251adb53751), W(0xb804e03a1a8e9e7a),
+     W(0x19afbe1dde6066c7)},
+    {W(0x6ab5e3eea444a011), W(0xd562600e92a32a8a), W(0xc0952fa320b3d14e),
+     W(0xe42b0bb6c94d5c38)},
+    0
+  },
+  {
+    {W(0xfc0b644b966d43c1), W(0xce99bacebc5bf66b), W(0x5e3e4f85b79baea8),
+     W(0xd1d7c93745f11fdb)},
+    {W(0xa3b91dcb848068ce), W(0x7e28dcf1b9d4f188), W(0x08685bf56d908259),
+     W(0xccc57953e8176d08)},
+    0
+  },
+  {
+    {W(0xcfb5d3f9ea107d2b), W(0x3bb207652cfdec48), W(0x9cd1954dedafdfba),
+     W(0xc7fd68e74f3460cb)},
+    {W(0xec006a3d1ce59aa7), W(0x889c592c1d22dbce), W(0xa563ddc968e084c6),
+     W(0xa6a21203cdf5c8f9)},
+    0
+  },
+  {
+    {W(0xdcd84242520b4f40), W(0x2746abdb4ca3bb47), W(0x58bfad842924f364),
+     W(0x11336313bb2e5f6a)},
+    {W(0x3eb7fd111cdf04dc), W(0x8551f5490a2576c6), W(0xc6550f976c073a2c),
+     W(0xe0892e1822b466df)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3e0e5c9dd111f8ec), W(0xbcc33f8db7c4e760), W(0x702f9a91bd392a51),
+     W(0x7da4a795c132e92d)},
+    {W(0x1a0b0ae30bb1151b), W(0x54febac802e32251), W(0xea3a5082694e9e78),
+     W(0xe58ffec1e4fe40b8)},
+    0
+  },
+  {
+    {W(0xfbb8349d29c4120b), W(0x9f94391fc0d0d915), W(0xc4074fa75410ba51),
+     W(0xa66adbf6150a5911)},
+    {W(0xc164543c34bfca38), W(0xe0f27560b9e1ccfc), W(0x99da0f53e820219c),
+     W(0xe8234498c6b4997a)},
+    0
+  },
+  {
+    {W(0x7b23c513516e19e4), W(0x56e2e847c5c4d593), W(0x9f727d735ce71ef6),
+     W(0x5b6304a6f79a44c5)},
+    {W(0x6638a7363ab7e433), W(0x1adea470fe742f83), W(0xe054b8545b7fc19f),
+     W(0xf935381aba1d0698)},
+    0
+  },
+  {
+    {W(0xb5504f9d918e4936), W(0x65035ef6b2513982), W(0x0553a0c26f4d9cb9),
+     W(0x6cb10d56bea85509)},
+    {W(0x48d957b7a242da11), W(0x16a4d3dd672b7268), W(0x3d7e637c8502a96b),
+     W(0x27c7032b730d463b)},
+    0
+  },
+  {
+    {W(0x55366b7d5846426f), W(0xe7d09e89247d441d), W(0x510b404d736fbf48),
+     W(0x7fa003d0e784bd7d)},
+    {W(0x25f7614f17fd9596), W(0x49e0e0a135cb98db), W(0x2c65957b2e83a76a),
+     W(0x5d40da8dcddbe0f8)},
+    0
+  },
+  {
+    {W(0x37f68bb4a595939d), W(0x0355647928740217), W(0x8e740e7c84ad7612),
+     W(0xd89bc8439044695f)},
+    {W(0xf7f3da5d85a9184d), W(0x562563bb9fc0b074), W(0x06d2e6aaf88a888e),
+     W(0x612d8643161fbe7c)},
+    0
+  },
+  {
+    {W(0x9fb3bba354530bb2), W(0xbde3ef77cb0869ea), W(0x89bc90460b431163),
+     W(0x4d03d7d2e4819a35)},
+    {W(0x33ae4f9e43b6a782), W(0x216db3079c88a686), W(0x91dd88e000ffedd9),
+     W(0xb280da9f12bd4840)},
+    0
+  },
+  {
+    {W(0x458f86913e538cd7), W(0xa7001f6c8e08ad53), W(0x52b8c6e6bf5d15ff),
+     W(0x548234a4011215dd)},
+    {W(0xff5a9d2d3d5b4045), W(0xb0ffeeb64a904190), W(0x55a3aca448607f8b),
+     W(0x8cbd665c30a0672a)},
+    0
+  },
+  {
+    {W(0xa37f3573f37f5937), W(0xeb0f6c7dd1e4fca5), W(0x2965a554ac8ab0fc),
+     W(0x17fbf56c274676ac)},
+    {W(0x2e2f6bd9acf7d720), W(0x41fc8f8810224766), W(0x517a14b385d53bef),
+     W(0xdae327a57d76a7d1)},
+    0
+  },
+  {
+    {W(0x515d5c891f5f82dc), W(0x9a7f67d76361079e), W(0xa8da81e311a35330),
+     W(0xe44990c44b18be1b)},
+    {W(0xc7d5ed95af103e59), W(0xece8aba78dac9261), W(0xbe82b0999394b8d3),
+     W(0x6830f09a16adfe83)},
+    0
+  },
+  {
+    {W(0x43c41ac194d7d9b1), W(0x5bafdd82c82e7f17), W(0xdf0614c15fda0fca),
+     W(0x74b043a7a8ae37ad)},
+    {W(0x3ba6afa19e71734c), W(0x15d5437e9c450f2e), W(0x4a5883fe67e242b1),
+     W(0x5143bdc22c1953c2)},
+    0
+  },
+  {
+    {W(0xa2a9ce7c6b53f5f9), W(0x642465951b176d99), W(0xb1298d36b95c081b),
+     W(0x53505bb81d9a9ee6)},
+    {W(0x3f6f9e61f2ba70b0), W(0xd07e16c98afad453), W(0x9f1694bbe7eb4a6a),
+     W(0xdfebced93cb0bc8e)},
+    0
+  },
+  {
+    {W(0xc676d7f2b1f3390b), W(0x9f7a1b8ca5b61272), W(0x4ebebfc9c2e127a9),
+     W(0x4602500c5dd997bf)},
+    {W(0x7f09771c4711230f), W(0x058eb37c020f09c1), W(0xab693d4bfee5e38b),
+     W(0x9289eb1f4653cbc0)},
+    0
+  },
+  {
+    {W(0xa44d2b391770f5a7), W(0xe4d4d7910e44eb82), W(0x42e69d1e3f69712a),
+     W(0xbf11c4d6ac6a820e)},
+    {W(0xb5e7f3e542c4224c), W(0xd6b4e81c449d941c), W(0x5d72bd165450e878),
+     W(0x6a61e28aee25ac54)},
+    0
+  },
+  {
+    {W(0x54da9dc7ab952578), W(0xb5423df226e84d0b), W(0xa8b64eeb9b872042),
+     W(0xac2057825990f6df)},
+    {W(0x4ff696eb21f4c77a), W(0x1a79c3e4aab273af), W(0x29bc922e9436b3f1),
+     W(0xff807ef8d6d9a27a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc7f3a8f833f6746c), W(0x21e46f65fea990ca), W(0x915fd5c5caddb0a9),
+     W(0xbd41f01678614555)},
+    {W(0x346f4434426ffb58), W(0x8055943614dbc204), W(0xf3dd20fe5a969b7f),
+     W(0x9d59e956e899a39a)},
+    0
+  },
+  {
+    {W(0x3c2f0ba9b733aa5f), W(0xdece47cbf05af235), W(0xf8e3f715a2ac82a5),
+     W(0xc97ba6412203f18a)},
+    {W(0xc3af550409c11060), W(0x56ea2c0546af512d), W(0xfac28daff3f28146),
+     W(0x87fab43a959ef494)},
+    0
+  },
+  {
+    {W(0xef4f115c775d6ece), W(0x69d2e3bbe8c0e78d), W(0xb0264ef1145cfc81),
+     W(0x0a41e9fa1b69788b)},
+    {W(0x0d9233be909a1f0b), W(0x150a84520ae76b30), W(0xea3375370632bb69),
+     W(0x15f7b3cfaa25584a)},
+    0
+  },
+  {
+    {W(0x09891641d4c5105f), W(0x1ae80f8e6d7fbd65), W(0x9d67225fbee6bdb0),
+     W(0x3b433b597fc4d860)},
+    {W(0x44e66db693e85638), W(0xf7b59252e3e9862f), W(0xdb785157665c32ec),
+     W(0x702fefd7ae362f50)},
+    0
+  },
+  {
+    {W(0x6eb4a9141339609a), W(0x2b627dee3e37eabd), W(0xea4083d1728c8d9c),
+     W(0xe70814d4518f21e4)},
+    {W(0x4cb05b5717398d14), W(0x9d37d2558003f6c9), W(0x70577af760829275),
+     W(0xcb4a9a9ac67d7e4f)},
+    0
+  },
+  {
+    {W(0xfe756a5c97290293), W(0xbf04a19cd388acbf), W(0xfbbbb9cf5e916bda),
+     W(0xf489527391f93bec)},
+    {W(0xdee07ec32a5923d7), W(0xc7bc949bfde0c370), W(0xbd5121750419d8fc),
+     W(0x54f5d4763fdcc93f)},
+    0
+  },
+  {
+    {W(0xc20f05f7d13fb27d), W(0xc05b30d36c7195c0), W(0xa335cf1832fc56c5),
+     W(0xae65bcd362b3a82b)},
+    {W(0xcbf6aab8630d99ea), W(0x164be816e62cec6c), W(0x6d41819d2feed2f1),
+     W(0xfcdc59070b91bd0d)},
+    0
+  },
+  {
+    {W(0x3754475d0fefb0c3), W(0xd48fb56b46d7c35d), W(0xa070b633363798a4),
+     W(0xae89f3d28fdb98e6)},
+    {W(0x970b89c86363d14c), W(0x8981752167abd27d), W(0x9bf7d47444d5a021),
+     W(0xb3083bafcac72aee)},
+    0
+  },
+  {
+    {W(0x247d7b0c60d9b5d0), W(0x584eb583128f2e7b), W(0xff6a74782eb389c7),
+     W(0x2559f53400b50a34)},
+    {W(0x46d85d485f5a25b8), W(0x1214f8af870405db), W(0xa409ecfd9777ab35),
+     W(0xe13599999c22cf23)},
+    0
+  },
+  {
+    {W(0x0acda2ffcc5e62e9), W(0x3b8b7d755edb02a4), W(0xa700741c66120c76),
+     W(0xf77e847f7d974064)},
+    {W(0x0d310678a5e3d464), W(0xde68b1f346bf35a3), W(0xcae83028d32f9043),
+     W(0x724e4717517cb0cb)},
+    0
+  },
+  {
+    {W(0x7a839912e0d59fc2), W(0x974b95b2422a3a39), W(0xd8fbba387f5e74e0),
+     W(0x04e52f936712705a)},
+    {W(0x43595fc7518103c9), W(0x28e137b354d6eb40), W(0x63fad7f3377b326c),
+     W(0xa644aca4bbff6d03)},
+    0
+  },
+  {
+    {W(0x389741debe949a44), W(0x638e9388546a4fa5), W(0x3fe6419ca0047bdc),
+     W(0x7047f648aaea57ca)},
+    {W(0x54e48a9041fbab17), W(0xda8e0b28576bdba2), W(0xe807eebcc72afddc),
+     W(0x07d3336df42577bf)},
+    0
+  },
+  {
+    {W(0x42a745ea270f77d9), W(0xba79e329e2a23d1a), W(0xa9473fff58d32463),
+     W(0x1e0373e266c91dcd)},
+    {W(0x3a325e4d61a42e3e), W(0x777f29b5bd463698), W(0x83a449199305fb68),
+     W(0xabf9be4f393d5d10)},
+    0
+  },
+  {
+    {W(0xfae8563b4f3011db), W(0xda33776536610c03), W(0xad4f6f2a6381af0b),
+     W(0xc277984cd95378ec)},
+    {W(0x5ab0a10c5751d2b2), W(0x70a18bb97a4bf3f4), W(0x38d07ad4eae3caf3),
+     W(0xe8ef552fec430361)},
+    0
+  },
+  {
+    {W(0x56e7cdd42cb58bc7), W(0xb08493e01b791ce5), W(0x4cb1d0990fb3a0e3),
+     W(0x763dec848301a296)},
+    {W(0x323621d2ca82a865), W(0xc29129caac78e631), W(0xd98a8cccad38e5b9),
+     W(0xa65dc52295352dd7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x62a8c244bfe20925), W(0x91c19ac38fdce867), W(0x5a96a5d5dd387063),
+     W(0x61d587d421d324f6)},
+    {W(0xe87673a2a37173ea), W(0x2384800853778b65), W(0x10f8441e05bab43e),
+     W(0xfa11fe124621efbe)},
+    0
+  },
+  {
+    {W(0x23f949feb8a24a20), W(0x17ebfed1f52ca53f), W(0x9b691bbebcfb4853),
+     W(0x5617ff6b6278a05d)},
+    {W(0x241b34c5e3c99ebd), W(0xfc64242e1784156a), W(0x4206482f695d67df),
+     W(0xb967ce0eee27c011)},
+    0
+  },
+  {
+    {W(0xc0f734a3b2335834), W(0x9526205a90ef6860), W(0xcb8be71704e2bb0d),
+     W(0x2418871e02f383fa)},
+    {W(0xd71776814082c157), W(0xcc914ad029c20073), W(0xf186c1ebe587e728),
+     W(0x6fdb3c2261bcd5fd)},
+    0
+  },
+  {
+    {W(0xb4480f0441c23fa3), W(0xb4712eb0c1989a2e), W(0x3ccbba0f93a29ca7),
+     W(0x6e205c14d619428c)},
+    {W(0x90db7957b3641686), W(0x0432691d45ac8b4e), W(0x07a759acf64e0350),
+     W(0x0514d89c9c972517)},
+    0
+  },
+  {
+    {W(0xcc7c4c1c2cf9d7c1), W(0x1320886aee95e5ab), W(0xbb7b9056beae170c),
+     W(0xc8a5b250dbc0d662)},
+    {W(0x4ed81432c11d2303), W(0x7da669121f03769f), W(0x3ac7a5fd84539828),
+     W(0x14dada943bccdd02)},
+    0
+  },
+  {
+    {W(0x7bb4f7aaf0dcbc49), W(0x7de551f970bbb45b), W(0xcfd0f3e49f2ca2e5),
+     W(0xece587091f5c76ef)},
+    {W(0x32920edd167d79ae), W(0x039df8a2fa7d7ec1), W(0xf46206c0bb30af91),
+     W(0x1ff5e2f522676b59)},
+    0
+  },
+  {
+    {W(0x51b90651cbae2f70), W(0xefc4bc0593aaa8eb), W(0x8ecd8689dd1df499),
+     W(0x1aee99a822f367a5)},
+    {W(0x95d485b9ae8274c5), W(0x6c14d4457d30b39c), W(0xbafea90bbcc1ef81),
+     W(0x7c5f317aa459a2ed)},
+    0
+  },
+  {
+    {W(0xe3b22c6bc4fe3c39), W(0xba4a81536c7bebdf), W(0xf23ab6b725693459),
+     W(0x53bc377014922b11)},
+    {W(0x4645c8ab5afc60db), W(0xaa02235520b9f2a3), W(0x52a2954cce0fc507),
+     W(0x8c2731bb7ce1c2e7)},
+    0
+  },
+  {
+    {W(0x410dc6a90deeaf52), W(0xb003fb024c641c15), W(0x1384978c5bc504c4),
+     W(0x37640487864a6a77)},
+    {W(0x05991bc6222a77da), W(0x62260a575e47eb11), W(0xc7af6613f21b432c),
+     W(0x22f3acc9ab4953e9)},
+    0
+  },
+  {
+    {W(0x27c8919240be34e8), W(0xc7162b3791907f35), W(0x90188ec1a956702b),
+     W(0xca132f7ddf93769c)},
+    {W(0x3ece44f90e2025b4), W(0x67aaec690c62f14c), W(0xad74141822e3cc11),
+     W(0xcf9b75c37ff9a50e)},
+    0
+  },
+  {
+    {W(0x0d0942770c24efc8), W(0x0349fd04bef737a4), W(0x6d1c9dd2514cdd28),
+     W(0x29c135ff30da9521)},
+    {W(0xea6e4508f78b0b6f), W(0x176f5dd2678c143c), W(0x081484184be21e65),
+     W(0x27f7525ce7df38c4)},
+    0
+  },
+  {
+    {W(0x5066efb6d9790ed6), W(0xa77a0cbca6aa793b), W(0x1a915f3c223e042e),
+     W(0x1c5def0469c5874b)},
+    {W(0x0e83007873b6c1da), W(0x55cf85d2fcd8557a), W(0x0f7c7c760460f3b1),
+     W(0x87052acb46e58063)},
+    0
+  },
+  {
+    {W(0x9faaccf5e4652f1d), W(0xbd6fdd2ad56157b2), W(0xa4f4fb1f6261ec50),
+     W(0x244e55ad476bcd52)},
+    {W(0x881c9305047d320b), W(0x1ca983d56181263f), W(0x354e9a44278fb8ee),
+     W(0xad2dbc0f396e4964)},
+    0
+  },
+  {
+    {W(0x7915c5242d0a4c23), W(0xeb5d26e46bb3cc52), W(0x369a9116c09e2c92),
+     W(0x0c527f92cf182cf8)},
+    {W(0x9e5919382aede0ac), W(0xb29222086cc34939), W(0x3c9d896299a34361),
+     W(0x3c81836dc1905fe6)},
+    0
+  },
+  {
+    {W(0xfce0176788a2ffe4), W(0xdc506a3528e169a5), W(0x0ea108617af9c93a),
+     W(0x1ed2436103fa0e08)},
+    {W(0x96eaaa92a3d694e7), W(0xc0f43b4def50bc74), W(0xce6aa58c64114db4),
+     W(0x8218e8ea7c000fd4)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6a7091c2e48fb889), W(0x26882c137b8a9d06), W(0xa24986631b82a0e2),
+     W(0x844ed7363518152d)},
+    {W(0x282f476fd86e27c7), W(0xa04edaca04afefdc), W(0x8b256ebc6119e34d),
+     W(0x56a413e90787d78b)},
+    0
+  },
+  {
+    {W(0x82ee061d5a74be50), W(0xe41781c4dea16ff5), W(0xe0b0c81e99bfc8a2),
+     W(0x624f4d690b547e2d)},
+    {W(0x3a83545dbdcc9ae4), W(0x2573dbb6409b1e8e), W(0x482960c4a6c93539),
+     W(0xf01059ad5ae18798)},
+    0
+  },
+  {
+    {W(0x38151e274d559d96), W(0x4f18c0d3b8db6c01), W(0x49a3aa836f9921af),
+     W(0xdbeab27b8c046029)},
+    {W(0x242b9eaa7040bf3b), W(0x39c479e51614b091), W(0x338ede2b0e4baf5d),
+     W(0x5bb192b7f0a53945)},
+    0
+  },
+  {
+    {W(0x715c9f973112795f), W(0xe8244437984e6ee1), W(0x55cb4858ecb66bcd),
+     W(0x7c136735abaffbee)},
+    {W(0x546615955dbec38e), W(0x51c0782c388ad153), W(0x9ba4c53ac6e0952f),
+     W(0x27e6782a1b21dfa8)},
+    0
+  },
+  {
+    {W(0x7d89c251ec5d7f65), W(0x0c8f561690394087), W(0x609e1cfcf0691ab3),
+     W(0x2a0300bfe9b20b21)},
+    {W(0xbf532fadb114faf4), W(0x328fc0b9521bf5d1), W(0xbd51f93c3bfc36de),
+     W(0xd989050e7a4e5f60)},
+    0
+  },
+  {
+    {W(0x682f903d4ed2dbc2), W(0x0eba59c87c3b2d83), W(0x8e9dc84d9c7e9335),
+     W(0x5f9b21b00eb226d7)},
+    {W(0xe33bd394af267bae), W(0xaa86cc25be2e15ae), W(0x4f0bf67d6a8ec500),
+     W(0x5846aa44f9630658)},
+    0
+  },
+  {
+    {W(0x6786ba38e7e0c278), W(0x09bf87ce588b2e6f), W(0x723b7022465fee3a),
+     W(0x08b8411464682394)},
+    {W(0x0eb52ce029e64629), W(0xadb60e8fcca78e43), W(0x20dd7062b654a991),
+     W(0x4281d428c69a6fe5)},
+    0
+  },
+  {
+    {W(0xfeb09740e2c2bf15), W(0x627a2205a9e99704), W(0xec8d73d0c2fbc565),
+     W(0x223eed8fc20c8de8)},
+    {W(0x1ee32583a8363b49), W(0x1a0b6cb9c9c2b0a6), W(0x49f7c3d290dbc85c),
+     W(0xa8dfbb971ef4c1ac)},
+    0
+  },
+  {
+    {W(0x5c257ca3c01e2ee1), W(0x1fb43a1427c36961), W(0xd594a7cb3472f324),
+     W(0xc15ec024660abe10)},
+    {W(0xb176d4496b614ced), W(0x0b04734d62dbb885), W(0x2cb753c636ddb587),
+     W(0x9a1c80e614cd340c)},
+    0
+  },
+  {
+    {W(0xafb34d4c65c7c2ab), W(0x1d4610e7e2c5ea84), W(0x893f6d1b973c4ab5),
+     W(0xa3cdd7e9945ba5c4)},
+    {W(0x60514983064417ee), W(0x1459b23cad6bdf2b), W(0x23b2c3415cf726c3),
+     W(0x3a82963532d6354a)},
+    0
+  },
+  {
+    {W(0xe9f65696c06fe7cd), W(0x510630579afd3a15), W(0x3dcdaca6185360ed),
+     W(0x2741703dc1853d2f)},
+    {W(0xbd8ad84a1a33f1a0), W(0x5f6c698cc35cb07c), W(0x212bd1196561e6b9),
+     W(0xf149cd7e617b4fd7)},
+    0
+  },
+  {
+    {W(0x294f901fab192c18), W(0xec5fcbfe7030164f), W(0xe2e2fcb7e2246ba6),
+     W(0x1e7c88b3221a1a0c)},
+    {W(0x72c7dd93c92d88c5), W(0x41c2148e1106fb59), W(0x547dd4f5a0f60f14),
+     W(0xed9b52b263960f31)},
+    0
+  },
+  {
+    {W(0x1ce3c9c530e82bf8), W(0x4d6625420dbb772a), W(0x19e25a60d9c17214),
+     W(0x13bcf84c7722fa55)},
+    {W(0x228aca0ef89ef7a7), W(0x03d64e2ffd3ed455), W(0xf1c390f5dde6c904),
+     W(0x731452a67678e18a)},
+    0
+  },
+  {
+    {W(0x6c8349ebb0a5b358), W(0xb154c5c29e7e2ed6), W(0xcad5eccfeda462db),
+     W(0xf2d6dbe42de66b69)},
+    {W(0x426aedf38665e5b2), W(0x488a85137b7f5723), W(0x15cc43b38bcbb386),
+     W(0x27ad0af3d791d879)},
+    0
+  },
+  {
+    {W(0x3c006e61a0632cba), W(0x920d924845b35ccd), W(0x4b3379fb7c5c7f65),
+     W(0x526cdf10b05e050b)},
+    {W(0x3188e936d21bf1ae), W(0xb3e07b39624bbd2f), W(0x7b9bfcf31367a541),
+     W(0x039f8ec88a367927)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc16c236e846e364f), W(0x7f33527cdea50ca0), W(0xc48107750926b86d),
+     W(0x6c2a36090598e70c)},
+    {W(0xa6755e52f024e924), W(0xe0fa07a49db4afca), W(0x15c3ce7d66831790),
+     W(0x5b4ef350a6cbb0d6)},
+    0
+  },
+  {
+    {W(0x05214c050f15dde9), W(0xa47a76a80d5f2b82), W(0xbb254d3062e82b62),
+     W(0x11a05fe03ec955ee)},
+    {W(0x7eaff46e9d529b36), W(0x55ab13018f9e3df6), W(0xc463e37199317698),
+     W(0xfd251438ccda47ad)},
+    0
+  },
+  {
+    {W(0xe2a37598a9d82abf), W(0x5f188ccbe6c170f5), W(0x816822005066b087),
+     W(0xda22c212c7155ada)},
+    {W(0x151e5d3afbddb479), W(0x4b606b846d715b99), W(0x4a73b54bf997cb2e),
+     W(0x9a1bfe433ecd8b66)},
+    0
+  },
+  {
+    {W(0xe13122f3dbfb894e), W(0xbe9b79f6ce274b18), W(0x85a49de5ca58aadf),
+     W(0x2495775811487351)},
+    {W(0x111def61bb939099), W(0x1d6a974a26d13694), W(0x4474b4ced3fc253b),
+     W(0x3a1485e64c5db15e)},
+    0
+  },
+  {
+    {W(0x5afddab61430c9ab), W(0x0bdd41d32238e997), W(0xf0947430418042ae),
+     W(0x71f9addacdddc4cb)},
+    {W(0x7090c016c52dd907), W(0xd9bdf44d29e2047f), W(0xe6f1fe801b1011a6),
+     W(0xb63accbcd9acdc78)},
+    0
+  },
+  {
+    {W(0x7817acab4baef62e), W(0x9f5a2202a85b91e8), W(0x9666ebe66ce57610),
+     W(0x32ad31f3f73bfe03)},
+    {W(0x628330a425bcf4d6), W(0xea950593515056e6), W(0x59811c89e1332156),
+     W(0xc89cf1fe8c11b2d7)},
+    0
+  },
+  {
+    {W(0x0ad7337ac0b7eff3), W(0x8552225ec5e48b3c), W(0xe6f78b0c73f13a5f),
+     W(0x5e70062e82349cbe)},
+    {W(0x6b8d5048e7073969), W(0x392d2a29c33cb3d2), W(0xee4f727c4ecaa20f),
+     W(0xa068c99e2ccde707)},
+    0
+  },
+  {
+    {W(0xebde86ec1ed66f18), W(0x225d906bd61fce43), W(0x5cab07d6e8bed74d),
+     W(0x16e4617f27855ab7)},
+    {W(0x6568aaddb2fbc3dd), W(0xedb5484f8aeddf5b), W(0x878f20e86dcf2fad),
+     W(0x3516497c615f5699)},
+    0
+  },
+  {
+    {W(0x5b826fcb1b3ec67b), W(0xece1b4b041356616), W(0x7d5ce77e56a3ab4f),
+     W(0xf6087f13aa212da0)},
+    {W(0xe63015054db92129), W(0xb8ae4c9940407d11), W(0x2b6de222dfab8385),
+     W(0x9b323022b7d6c3b4)},
+    0
+  },
+  {
+    {W(0x057ef17a5ae6ad84), W(0x9feae00b293a6ae0), W(0xd18bb6c154266408),
+     W(0xd3d3e1209c8e8e48)},
+    {W(0xba8d4ca80e94fc8f), W(0x80262ffc8a8ea0fe), W(0xac5b2855f71655fd),
+     W(0xa348f8fae9aced89)},
+    0
+  },
+  {
+    {W(0x60684b69a5660af3), W(0x69aad23b9066d14b), W(0x4d9f9b49fa4d020a),
+     W(0xafb54ec1b5cd6a4a)},
+    {W(0x2b25fe1832fd864d), W(0xee6945062b6b64d0), W(0x954a2a515001d8aa),
+     W(0x5e1008557082b5b3)},
+    0
+  },
+  {
+    {W(0x5158aee8707bace2), W(0x458d14c6f86d1c56), W(0x15ebf15cc1b9bee2),
+     W(0xa015df660f379cc0)},
+    {W(0xb24ceba3202ed161), W(0x4558f687204b3df0), W(0x890e8eedbe264c04),
+     W(0xb5b7871090de8bb7)},
+    0
+  },
+  {
+    {W(0x20ecf71cbc90eb1b), W(0x4234facf651c1df4), W(0xc720fce9e681f678),
+     W(0x680becdda7c007f4)},
+    {W(0x7c08dc063181afea), W(0x75c1b050a34eca91), W(0x7d3479d54b9e2333),
+     W(0xed16640af3951aa3)},
+    0
+  },
+  {
+    {W(0xd3ae1ae29915a53a), W(0x98358b72b717839e), W(0x87351551240c58d0),
+     W(0xc747589cb53850e9)},
+    {W(0x5be861ba7f2a079c), W(0x9506982b81a53f25), W(0x169a2cfe64551da8),
+     W(0x5e36bd2e5ca003a7)},
+    0
+  },
+  {
+    {W(0x911b596264723e54), W(0x34384f8c004b327c), W(0x06ca5c61b85435f2),
+     W(0x12e0cd25e2c1075c)},
+    {W(0xa4b84cb8ac727394), W(0x50bd720492b352c1), W(0xe85524a49cbd0fb4),
+     W(0x10b9274be7876024)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xef0a3fecfa181e69), W(0x9ea02f8130d69a98), W(0xb2e9cf8e66eab95d),
+     W(0x520f2beb24720021)},
+    {W(0x621c540a1df84361), W(0x1203772171fa6d5d), W(0x6e3c7b510ff5f6ff),
+     W(0x817a069babb2bef3)},
+    0
+  },
+  {
+    {W(0x83572fb6b294cda6), W(0x6ce9bf75b9039f34), W(0x20e012f0095cbb21),
+     W(0xa0aecc1bd063f0da)},
+    {W(0x57c21c3af02909e5), W(0xc7d59ecf48ce9cdc), W(0x2732b8448ae336f8),
+     W(0x056e37233f4f85f4)},
+    0
+  },
+  {
+    {W(0x8a10b53189e800ca), W(0x50fe0c17145208fd), W(0x9e43c0d3b714ba37),
+     W(0x427d200e34189acc)},
+    {W(0x05dee24fe616e2c0), W(0x9c25f4c8ee1854c1), W(0x4d3222a58f342a73),
+     W(0x0807804fa027c952)},
+    0
+  },
+  {
+    {W(0xc222653a4f0d56f3), W(0x961e4047ca28b805), W(0x2c03f8b04a73434b),
+     W(0x4c966787ab712a19)},
+    {W(0xcc196c42864fee42), W(0xc1be93da5b0ece5c), W(0xa87d9f22c131c159),
+     W(0x2bb6d593dce45655)},
+    0
+  },
+  {
+    {W(0x22c49ec9b809b7ce), W(0x8a41486be2c72c2c), W(0x813b9420fea0bf36),
+     W(0xb3d36ee9a66dac69)},
+    {W(0x6fddc08a328cc987), W(0x0a3bcd2c3a326461), W(0x7103c49dd810dbba),
+     W(0xf9d81a284b78a4c4)},
+    0
+  },
+  {
+    {W(0x3de865ade4d55941), W(0xdedafa5e30384087), W(0x6f414abb4ef18b9b),
+     W(0x9ee9ea42faee5268)},
+    {W(0x260faa1637a55a4a), W(0xeb19a514015f93b9), W(0x51d7ebd29e9c3598),
+     W(0x523fc56d1932178e)},
+    0
+  },
+  {
+    {W(0x501d070cb98fe684), W(0xd60fbe9a124a1458), W(0xa45761c892bc6b3f),
+     W(0xf5384858fe6f27cb)},
+    {W(0x4b0271f7b59e763b), W(0x3d4606a95b5a8e5e), W(0x1eda5d9b05a48292),
+     W(0xda7731d0e6fec446)},
+    0
+  },
+  {
+    {W(0xa3e3369390d45871), W(0xe976404006166d8d), W(0xb5c3368289a90403),
+     W(0x4bd1798372f1d637)},
+    {W(0xa616679ed5d2c53a), W(0x5ec4bcd8fdcf3b87), W(0xae6d7613b66a694e),
+     W(0x7460fc76e3fc27e5)},
+    0
+  },
+  {
+    {W(0x70469b8295caabee), W(0xde024ca5889501e3), W(0x6bdadc06076ed265),
+     W(0x0cb1236b5a0ef8b2)},
+    {W(0x4065ddbf0972ebf9), W(0xf1dd387522aca432), W(0xa88b97cf744aff76),
+     W(0xd1359afdfe8e3d24)},
+    0
+  },
+  {
+    {W(0x52a3ba2b91502cf3), W(0x2c3832a8084db75d), W(0x04a12dddde30b1c9),
+     W(0x7802eabce31fd60c)},
+    {W(0x33707327a37fddab), W(0x65d6f2abfaafa973), W(0x3525c5b811e6f91a),
+     W(0x76aeb0c95f46530b)},
+    0
+  },
+  {
+    {W(0xe8815ff62f93a675), W(0xa6ec968405f48679), W(0x6dcbb556358ae884),
+     W(0x0af61472e19e3873)},
+    {W(0x72334372a5f696be), W(0xc65e57ea6f22fb70), W(0x268da30c946cea90),
+     W(0x136a8a8765681b2a)},
+    0
+  },
+  {
+    {W(0xad5e81dc0f9f44d4), W(0xf09a69602c46585a), W(0xd1649164c447d1b1),
+     W(0x3b4b36c8879dc8b1)},
+    {W(0x20d4177b3b6b234c), W(0x096a25051730d9d0), W(0x0611b9b8ef80531d),
+     W(0xba904b3b64bb495d)},
+    0
+  },
+  {
+    {W(0x1192d9d493a3147a), W(0x9f30a5dc9a565545), W(0x90b1f9cb6ef07212),
+     W(0x299585460d87fc13)},
+    {W(0xd3323effc17db9ba), W(0xcb18548ccb1644a8), W(0x18a306d44f49ffbc),
+     W(0x28d658f14c2e8684)},
+    0
+  },
+  {
+    {W(0x44ba60cda99f8c71), W(0x67b7abdb4bf742ff), W(0x66310f9c914b3f99),
+     W(0xae430a32f412c161)},
+    {W(0x1e6776d388ace52f), W(0x4bc0fa2452d7067d), W(0x03c286aa8f07cd1b),
+     W(0x4cb8f38ca985b2c1)},
+    0
+  },
+  {
+    {W(0x83ccbe808c3bff36), W(0x005a0bd25263e575), W(0x460d7dda259bdcd1),
+     W(0x4a1c5642fa5cab6b)},
+    {W(0x2b7bdbb99fe4fc88), W(0x09418e28cc97bbb5), W(0xd8274fb4a12321ae),
+     W(0xb137007d5c87b64e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x80531fe1c63c4962), W(0x50541e89981fdb25), W(0xdc1291a1fd4c2b6b),
+     W(0xc0693a17a6df4fca)},
+    {W(0xb2c4604e0117f203), W(0x245f19630a99b8d0), W(0xaedc20aac6212c44),
+     W(0xb1ed4e56520f52a8)},
+    0
+  },
+  {
+    {W(0xb5560fb6700a1acd), W(0xe823fd73fd999681), W(0xda915d1f6cb4e1ba),
+     W(0x0d0301186ebe00a3)},
+    {W(0x744fb0c989fca8cd), W(0x970d01dbf9da0e0b), W(0x0ad8c5647931d76f),
+     W(0xb15737bff659b96a)},
+    0
+  },
+  {
+    {W(0x18f37a9c6bdf22da), W(0xefbc432f90dc82df), W(0xc52cef8e5d703651),
+     W(0x82887ba0d99881a5)},
+    {W(0x7cec9ddab920ec1d), W(0xd0d7e8c3ec3e8d3b), W(0x445bc3954ca88747),
+     W(0xedeaa2e09fd53535)},
+    0
+  },
+  {
+    {W(0xa12b384ece53c2d0), W(0x779d897d5e4606da), W(0xa53e47b073ec12b0),
+     W(0x462dbbba5756f1ad)},
+    {W(0x69fe09f2cafe37b6), W(0x273d1ebfecce2e17), W(0x8ac1d5383cf607fd),
+     W(0x8035f7ff12e10c25)},
+    0
+  },
+  {
+    {W(0xb7d4cc0f296c9005), W(0x4b9094fa7b0aebdb), W(0xe1bf10f1c00ec8d4),
+     W(0xd807b1c4d667c101)},
+    {W(0xa9412cdfbe713383), W(0x435e063e81142ba1), W(0x984c15ecaf0a6bdc),
+     W(0x592c246092a3dab9)},
+    0
+  },
+  {
+    {W(0xca442d5a2093c22a), W(0xebd0bd31d5703aed), W(0x308f2afd653287b6),
+     W(0x9bb88bac0d1bc8ba)},
+    {W(0xfbaf853875c1e3b2), W(0xbd2ac950ca11447c), W(0x286d816cea5c4c8d),
+     W(0xdc3aa80028dc3208)},
+    0
+  },
+  {
+    {W(0x9365690016e23e9d), W(0xcb220c6ba7cc41e1), W(0xb36b20c369d6245c),
+     W(0x2d63c348b62e9a6a)},
+    {W(0xa3473e19cdc0bcb5), W(0x70f18b3f8f601b98), W(0x8ad7a2c7cde346e4),
+     W(0xae9f6ec3bd3aaa64)},
+    0
+  },
+  {
+    {W(0x854d34c77e6c5520), W(0xc27df9efdcb9ea58), W(0x405f2369d686666d),
+     W(0x29d1febf0417aa85)},
+    {W(0x9846819e93470afe), W(0x3e6a9669e2a27f9e), W(0x24d008a2e31e6504),
+     W(0xdba7cecf9cb7680a)},
+    0
+  },
+  {
+    {W(0x030223503274c7e1), W(0x61ee8c934c4b6c26), W(0x3c4397e3199389ce),
+     W(0xe0082600488757ce)},
+    {W(0xaac3a2df06b4dafb), W(0x45af0700ddff5b6a), W(0x0a5974248c1d9fa0),
+     W(0x1640087d391fc68b)},
+    0
+  },
+  {
+    {W(0x26a43e41d07fa53d), W(0x3154a78a74e35bc5), W(0x7b768924e0da2f8c),
+     W(0xba964a2b23613f9a)},
+    {W(0x5a548d35ba1d16c4), W(0x2e1bfed1fb54d057), W(0xff992136bc640205),
+     W(0xf39cb9148156df29)},
+    0
+  },
+  {
+    {W(0xf4873fcf4e5548bd), W(0x8725da3f03ce57f0), W(0xd82f5c95ca953258),
+     W(0xac647f127cf0747e)},
+    {W(0xff2038b02d570bd5), W(0xb0c2a767a13ae03f), W(0xebaa27cde9932d16),
+     W(0xa686e3fc1234e901)},
+    0
+  },
+  {
+    {W(0xc913e64699b444ad), W(0xddfce99dc40504c5), W(0x58482a99d42e53db),
+     W(0x9aaf2c25d1aff537)},
+    {W(0xee90f7962664cf67), W(0x74ab5c99f1393e2b), W(0xfad0faeae6225bb0),
+     W(0xc355648c2d63dd6c)},
+    0
+  },
+  {
+    {W(0x9f80435e63261ecc), W(0x6302a62e4337d6c9), W(0x91916a49ca4958a0),
+     W(0x554958993149d5d3)},
+    {W(0x378d020b9f91de3c), W(0x47b839a34dd25170), W(0x2825854138b7f258),
+     W(0xea5b14f7437e7dec)},
+    0
+  },
+  {
+    {W(0xe4e31d271d91cf9d), W(0xcb35d4fdb377b20a), W(0x74de1e45055e1327),
+     W(0x3298e31b28703e75)},
+    {W(0x55087237de013339), W(0x32cbf30123d101c6), W(0xc70dba22e8aab0dc),
+     W(0x4a52623d3d155bb9)},
+    0
+  },
+  {
+    {W(0x74f08736b0018f44), W(0xf4a03417b446d0f5), W(0x66a4aa2fa40ca6b2),
+     W(0x215679f0badb60ed)},
+    {W(0x3871195a323e4eef), W(0x8f0940c320952b16), W(0xfe8dac62879d5f7d),
+     W(0x649cb623c1a6e875)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xecaff541338d6e43), W(0x56f7dd734541d5cc), W(0xb5d426de96bc88ca),
+     W(0x48d94f6b9ed3a2c3)},
+    {W(0x6354a3bb2ef8279c), W(0xd575465b0b1867f2), W(0xef99b0ff95225151),
+     W(0xf3e19d88f94500d8)},
+    0
+  },
+  {
+    {W(0x0d0df6ce51efb310), W(0xcb5b2eb4958df5be), W(0xd6459e2936158e59),
+     W(0x82aae2b91466e336)},
+    {W(0xfb658a39411aa636), W(0x7152ecc5d4c0a933), W(0xf10c758a49f026b7),
+     W(0xf4837f97cb09311f)},
+    0
+  },
+  {
+    {W(0x7807f364b71698f5), W(0x6ba418d29f7b605e), W(0xfd20b00fa03b2cbb),
+     W(0x883eca37da54386f)},
+    {W(0xff0be43ff3437f24), W(0xe910b432a48bb33c), W(0x4963a128329df765),
+     W(0xac1dd556be2fe6f7)},
+    0
+  },
+  {
+    {W(0x994f523a626332d5), W(0x7bc388335561bb44), W(0x005ed4b03d845ea2),
+     W(0xd39d3ee1c2a1f08a)},
+    {W(0x6561fdd3e7676b0d), W(0x620e35fffb706017), W(0x36ce424ff264f9a8),
+     W(0xc4c3419fda2681f7)},
+    0
+  },
+  {
+    {W(0x1c30861cf405ff06), W(0xebac86bd486e828b), W(0xe791a971636933fc),
+     W(0x50e7c2be7aeee947)},
+    {W(0xc3d4a095fa90d767), W(0xae60eb7be670ab7b), W(0x17633a64397b056d),
+     W(0x93a21f33105012aa)},
+    0
+  },
+  {
+    {W(0x857c1f22369b87ad), W(0x3c00e5d932fca556), W(0x1ad74cab90b06466),
+     W(0xa7112386550faaf2)},
+    {W(0x7435e1986d9bd5f5), W(0x2dcc7e3859c3463f), W(0xdc7df748ca7bd4b2),
+     W(0x13cd4c089dec2f31)},
+    0
+  },
+  {
+    {W(0x5936e46022caf46b), W(0x6a45dd8f9a96fe4f), W(0xf7925434b98f474e),
+     W(0x414104120053ef15)},
+    {W(0x71cf8d1241de97bf), W(0xb8547b61bd80bef4), W(0xb47d3970c4db0037),
+     W(0xf1bcd328fef20dff)},
+    0
+  },
+  {
+    {W(0x00f831769bb81648), W(0xd69eb485653120d0), W(0xd17d75f44ccabc62),
+     W(0x34a07f82b749fcb1)},
+    {W(0x2c3af787bbfb5554), W(0xb06ed4d062e283f8), W(0x5722889fa19213a0),
+     W(0x162b085edcf3c7b4)},
+    0
+  },
+  {
+    {W(0xd981b888bdbcf0ca), W(0xd75f5da6df279e9f), W(0x128bbf247054e934),
+     W(0x3c6ff6e581db134b)},
+    {W(0x795b7cf4047d26e4), W(0xf370f7b85049ec37), W(0xc6712d4dced945af),
+     W(0xdf30b5ec095642bc)},
+    0
+  },
+  {
+    {W(0xbbe9eb3a6568013e), W(0x8dbd203f22f243fc), W(0x9dbd7694b342734a),
+     W(0x8f6d12f846afa984)},
+    {W(0xb98610a2c9eade29), W(0xbab4f32347dd0f18), W(0x5779737b671c0d46),
+     W(0x10b6a7c6d3e0a42a)},
+    0
+  },
+  {
+    {W(0xfcdfea499c438edf), W(0x7678dcc391edba44), W(0xf07b3b87e2ba50f0),
+     W(0xc13888ef43948c1b)},
+    {W(0xc2135ad41140af42), W(0x8e5104f3926ed1a7), W(0xf24430cb88f6695f),
+     W(0x0ce0637b6d73c120)},
+    0
+  },
+  {
+    {W(0x36d90ddaeb300f7a), W(0x9dcf7dfcedb5e801), W(0x645cb26874d5244c),
+     W(0xa127ee79348e3aa2)},
+    {W(0x488acc53575f1dbb), W(0x95037e8580e6161e), W(0x57e59283292650d0),
+     W(0xabe67d9914938216)},
+    0
+  },
+  {
+    {W(0x345913d37fafa4c8), W(0x3d9180820491aac0), W(0x9347871f3e69264c),
+     W(0xbea9dd3cb4f4f0cd)},
+    {W(0xbda5d0673eadd3e7), W(0x0033c1b80573bcd8), W(0x255893795da2486c),
+     W(0xcb89ee5b86abbee7)},
+    0
+  },
+  {
+    {W(0x4ad78f356798e4ba), W(0x9214e6e5c7d0e091), W(0xc420b488b1290403),
+     W(0x64049e0afc295749)},
+    {W(0x03ef5af13ae9841f), W(0xdbe4ca19b0b662a6), W(0x46845c5ffa453458),
+     W(0xf8dabf1910b66722)},
+    0
+  },
+  {
+    {W(0x741452568776e667), W(0x6e76142cb23c6bb5), W(0xdbf307121b3a8a87),
+     W(0x60e7363e98450836)},
+    {W(0x5741450eb7366d80), W(0xe4ee14ca4837dbdf), W(0xa765eb9b69d4316f),
+     W(0x04548dca8ef43825)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x32670d2f7189e71f), W(0xc64387485ecf91e7), W(0x15758e57db757a21),
+     W(0x427d09f8290a9ce5)},
+    {W(0x846a308f38384a7a), W(0xaac3acb4b0732b99), W(0x9e94100917845819),
+     W(0x95cba111a7ce5e03)},
+    0
+  },
+  {
+    {W(0x97b7851aaaca5e9b), W(0x518aa52156713b97), W(0x3357e8c7150a61f6),
+     W(0x7842e7e2ec2c2b69)},
+    {W(0x8dffaf656868a548), W(0xd963bd82e068fc81), W(0x64da5c8b65917733),
+     W(0x927090ff7b247328)},
+    0
+  },
+  {
+    {W(0x37a01e48a105fc8e), W(0x769d754a289ba48c), W(0xc08c6fe1d51c2180),
+     W(0xb032dd33b7bd1387)},
+    {W(0x953826db020b0aa6), W(0x05137e800664c73c), W(0xc66302c4660cf95d),
+     W(0x99004e11b2cef28a)},
+    0
+  },
+  {
+    {W(0x214bc9a7d298c241), W(0xe3b697ba56807cfd), W(0xef1c78024564eadb),
+     W(0xdde8cdcfb48149c5)},
+    {W(0x946bf0a75a4d2604), W(0x27154d7f6c1538af), W(0x95cc9230de5b1fcc),
+     W(0xd88519e966864f82)},
+    0
+  },
+  {
+    {W(0x1013e4f796ea6ca1), W(0x567cdc2a1f792871), W(0xadb728705c658d45),
+     W(0xf7c1ff4ace600e98)},
+    {W(0xa1ba86574b6cad39), W(0x3d58d634ba20b428), W(0xc0011cdea2e6fdfb),
+     W(0xa832367a7b18960d)},
+    0
+  },
+  {
+    {W(0x47618c9f0e4938f7), W(0x58d47d69dc83719e), W(0xd74c1a23f41a64cc),
+     W(0x5d28e068b5829f66)},
+    {W(0xd8d37529210466f6), W(0x2af1152fc6a64ef8), W(0x55d4485c19ce6a7a),
+     W(0x6d0bd2f5f648e2d7)},
+    0
+  },
+  {
+    {W(0x1ecc032af416448d), W(0x4a7e8c10ec76d971), W(0x854f9805b90b6eae),
+     W(0xfd0b15324bed0594)},
+    {W(0x89f71848d98b5ca3), W(0xd01fe5fcf039b3ef), W(0x4481332e627bda2e),
+     W(0xe67cecd7a5073e41)},
+    0
+  },
+  {
+    {W(0xb828dd1a7cb1282c), W(0xa08d7626be46973a), W(0x6baf8d40e708d6b2),
+     W(0x72571fa14daeb3f3)},
+    {W(0x85b1732ff22dfd98), W(0x87ab01a70087108d), W(0xaaaafea85988207a),
+     W(0xccc832f869f00755)},
+    0
+  },
+  {
+    {W(0x2ab0bce94595a859), W(0x4d8c2da082084ee7), W(0x21ff8be5acca3d3c),
+     W(0xd8b805337827f633)},
+    {W(0xf74e8c026becabbf), W(0x9fae4dbefede4828), W(0xd3885a5b3cc46bcf),
+     W(0x2d535e2b6e6ad144)},
+    0
+  },
+  {
+    {W(0x63d3444507d9e240), W(0x6fbadf4338cff7e6), W(0x8717624a959c9461),
+     W(0xd7d951c411fb775b)},
+    {W(0x4049161af6fc3a2b), W(0x0dfa2547a1a8e98d), W(0xeca780d439c2139c),
+     W(0xd8c2d8cbd73ea8ef)},
+    0
+  },
+  {
+    {W(0x3aa1974f07605b28), W(0x4f3d82a71e296255), W(0xbbe5ea03b4e23f16),
+     W(0x8f5c6c6b4e654193)},
+    {W(0x27181182d3e8ab01), W(0xc68bb231f3ba6bc2), W(0x90a244d820af1fd7),
+     W(0x605abc055b713f4f)},
+    0
+  },
+  {
+    {W(0x964d950e36ff3bf0), W(0x8ad20f6ff0b34638), W(0x4d9177b3b5d7585f),
+     W(0xcf839760ef3f019f)},
+    {W(0x582fc5b38288c545), W(0x2f8e4e9b13116bd1), W(0xf91e1b2f332120ef),
+     W(0xcf5687242a17dd23)},
+    0
+  },
+  {
+    {W(0xca5fe19bd221991a), W(0x271ff066f05f400e), W(0x9d46ec4c9cf09896),
+     W(0xdcaa8dfdec4febc3)},
+    {W(0xaa3995a0adf19d04), W(0xc98634239da573a6), W(0x378058b2f2465b2b),
+     W(0x20d389f9b4c31612)},
+    0
+  },
+  {
+    {W(0x1907d767c9c8d468), W(0xb428bd1404d61617), W(0x002865fc44bc0197),
+     W(0x71f29f20d2d1286d)},
+    {W(0xeae96590dc5a11fc), W(0xa204462fcb933b4a), W(0x1504f0eeee742617),
+     W(0xec6e9a444b4cf39a)},
+    0
+  },
+  {
+    {W(0xd7d199c7b7631c9d), W(0x1322c2b8bb123942), W(0xe662b68fbe8b6848),
+     W(0xc970faf2cde99b14)},
+    {W(0x61b27134b06655e5), W(0xadcef8f781365d89), W(0x917b5ab521b851aa),
+     W(0x4f4472121cf694a7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x488f1185ca8d9d1a), W(0xadf2c77dd987ded2), W(0x5f3039f060c46124),
+     W(0xe5d70b7571e095f4)},
+    {W(0x82d586506260e70f), W(0x39d75ea7f750d105), W(0x8cf3d0b175bac364),
+     W(0xf3a7564d21d01329)},
+    0
+  },
+  {
+    {W(0xb24aa43e3fcd3efc), W(0xdd26c034b8088e9a), W(0xa5ef4dc9bd3d46ea),
+     W(0xa2f99d588a4c6a6f)},
+    {W(0xddabd3552f1da46c), W(0x72c3f8ce1afacdd1), W(0xd90c4eee92d40578),
+     W(0xd28bb41fca623b94)},
+    0
+  },
+  {
+    {W(0x242792d2e7417ce1), W(0xff42bc71970ee7f5), W(0x1ff4dc6d5c67a41e),
+     W(0x77709b7b20882a58)},
+    {W(0x3554731dbe217f2c), W(0x2af2a8cd5bb72177), W(0x58eee769591dd059),
+     W(0xbb2930c94bba6477)},
+    0
+  },
+  {
+    {W(0x1e6adddaf176f2c0), W(0x01ca4604e2572658), W(0x0a404ded85342ffb),
+     W(0x8cf60f96441838d6)},
+    {W(0x9bbc691cc9071c4a), W(0xfd58874434442803), W(0x97101c85809c0d81),
+     W(0xa7fb754c8c456f7f)},
+    0
+  },
+  {
+    {W(0x6af7a1d5af71013f), W(0xe68216e50bedc946), W(0xf4cba30bd27370a0),
+     W(0x7981afbf870421cc)},
+    {W(0x02496a679449f0e1), W(0x86cfc4be0a47edae), W(0x3073c936b1feca22),
+     W(0xf569461203f8f8fb)},
+    0
+  },
+  {
+    {W(0xbcadd6715bde48f8), W(0xc97038732189bc7d), W(0x5d45299ec709ee8a),
+     W(0xd1287ee2845aaff8)},
+    {W(0x7d1f8874db1dbf1f), W(0xea46588b990c88d6), W(0x60ba649a84368313),
+     W(0xd5fdcbce60d543ae)},
+    0
+  },
+  {
+    {W(0xcf3de9959890272d), W(0x75f3432a3e713a10), W(0x5e13479fe28227b8),
+     W(0xb8561ea9fefacdc8)},
+    {W(0xa6a297a08332aafd), W(0x9b0d8bb573809b62), W(0xd2fa1cfd0c63036f),
+     W(0x7a16eb55bd64bda8)},
+    0
+  },
+  {
+    {W(0xf7e48e8a2ac13e27), W(0x4494f6df4eb1a9f5), W(0xedbf84eb981f0a62),
+     W(0x49badc32536438f0)},
+    {W(0x50bea541004f7571), W(0xbac67d10df1c94ee), W(0x253d73a1b727bc31),
+     W(0xb3d01cf230686e28)},
+    0
+  },
+  {
+    {W(0xa40bc039306a5a3b), W(0x4e0a41fd96783a1b), W(0xa1e8d39a0253cdd4),
+     W(0x6480be26c7388638)},
+    {W(0xee365e1d2285f382), W(0x188d8d8fec0b5c36), W(0x34ef1a481f0f4d82),
+     W(0x1a8f43e1a487d29a)},
+    0
+  },
+  {
+    {W(0xa5a8147c3902dda5), W(0x35d2f706fe6973b4), W(0x5ac2efcfc257457e),
+     W(0x933f48d48700611b)},
+    {W(0xc365af884912beb2), W(0x7f5a4de6162edf94), W(0xc646ba7c0c32f34b),
+     W(0x632c6af3b2091074)},
+    0
+  },
+  {
+    {W(0x10f6a3339bb26f5f), W(0x1e85db8e044d85b6), W(0xc3697a0894197e54),
+     W(0x65e18cc0a7cb4ea8)},
+    {W(0xa38c4f50a471fe6e), W(0xf031747a2f13439c), W(0x53c4a6bac007318b),
+     W(0xa8da3ee51deccb3d)},
+    0
+  },
+  {
+    {W(0xbfc01adf5ca48f3f), W(0x64352f06e22a9b84), W(0xcee54da1c1099e4a),
+     W(0xbbda54e8fa1b89c0)},
+    {W(0x166a3df56f6e55fb), W(0x1ca44a2420176f88), W(0x936afd88dfb7b5ff),
+     W(0xe34c24378611d4a0)},
+    0
+  },
+  {
+    {W(0x5f24416d3e554892), W(0x8413b53d430e2a45), W(0x99c56aee9032a2a0),
+     W(0x09432bf6eec367b1)},
+    {W(0x552850c6daf0ecc1), W(0x49ebce555bc92048), W(0xdfb66ba654811307),
+     W(0x1b84f7976f298597)},
+    0
+  },
+  {
+    {W(0xd5b5d9eb70f8d5a4), W(0x375adde7d7bbb228), W(0x31e88b860c1c0b32),
+     W(0xd1f568c4173edbaa)},
+    {W(0x1592fc835459df02), W(0x2beac0fb0fcd9a7e), W(0xb0a6fdb81b473b0a),
+     W(0xe3224c6f0fe8fc48)},
+    0
+  },
+  {
+    {W(0xa1a5c8455777e189), W(0xcc10bee0456f2829), W(0x8ad95c56da762bd5),
+     W(0x152e2214e9d91da8)},
+    {W(0x975b0e727cb23c74), W(0xfd5d7670a90c66df), W(0xb5b5b8ad225ffc53),
+     W(0xab6dff73faded2ae)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd433e50f6d3549cf), W(0x6f33696ffacd665e), W(0x695bfdacce11fcb4),
+     W(0x810ee252af7c9860)},
+    {W(0x65450fe17159bb2c), W(0xf7dfbebe758b357b), W(0x2b057e74d69fea72),
+     W(0xd485717a92731745)},
+    0
+  },
+  {
+    {W(0x896c42e8ee36860c), W(0xdaf04dfd4113c22d), W(0x1adbb7b744104213),
+     W(0xe5fd5fa11fd394ea)},
+    {W(0x68235d941a4e0551), W(0x6772cfbe18d10151), W(0x276071e309984523),
+     W(0xe4e879de5a56ba98)},
+    0
+  },
+  {
+    {W(0x6c8d0aa9b898fd52), W(0x2fb38a57be9af1a7), W(0xe1f2b9a93b4f03f8),
+     W(0x2b1aad44c3f0cc6f)},
+    {W(0x58b5332e7cf2c084), W(0x1c57d96f0367d26d), W(0x2297eabdfa6e4a8d),
+     W(0x65a947ee4a0e2b6a)},
+    0
+  },
+  {
+    {W(0xaaafafb0285b9491), W(0x01a0be881e4c705e), W(0xff1d4f5d2ad9caab),
+     W(0x6e349a4ac37a233f)},
+    {W(0xcf1c12464a1c6a16), W(0xd99e6b6629383260), W(0xea3d43665f6d5471),
+     W(0x36974d04ff8cc89b)},
+    0
+  },
+  {
+    {W(0xf535b616fdd5b854), W(0x592549c85728719f), W(0xe231468606921cad),
+     W(0x98c8ce34311b1ef8)},
+    {W(0x28b937e7e9090b36), W(0x67fc3ab90bf7bbb7), W(0x12337097a9d87974),
+     W(0x3e5adca1f970e3fe)},
+    0
+  },
+  {
+    {W(0xc26c49a1cfe89d80), W(0xb42c026dda9c8371), W(0xca6c013adad066d2),
+     W(0xfb8f722856a4f3ee)},
+    {W(0x08b579ecd850935b), W(0x34c1a74cd631e1b3), W(0xcb5fe596ac198534),
+     W(0x39ff21f6e1f24f25)},
+    0
+  },
+  {
+    {W(0xcdcc68a7b3f85ff0), W(0xacd21cdd1a888044), W(0xb6719b2e05dbe894),
+     W(0xfae1d3d88b8260d4)},
+    {W(0xedfedece8a1c5d92), W(0xbca01a94dc52077e), W(0xc085549c16dd13ed),
+     W(0xdc5c3bae495ebaad)},
+    0
+  },
+  {
+    {W(0x27f29e148f929057), W(0x7a64ae06c0c853df), W(0x256cd18358e9c5ce),
+     W(0x9d9cce82ded092a5)},
+    {W(0xcc6e59796e93b7c7), W(0xe1e4709231bb9e27), W(0xb70b3083aa9e29a0),
+     W(0xbf181a753785e644)},
+    0
+  },
+  {
+    {W(0xcc17063fbe7b643a), W(0x7872e1c846085760), W(0x86b0fffbb4214c9e),
+     W(0xb18bbc0e72bf3638)},
+    {W(0x8b17de0c722591c9), W(0x1edeab1948c29e0c), W(0x9fbfd98ef4304f20),
+     W(0x2d1dbb6b9c77ffb6)},
+    0
+  },
+  {
+    {W(0xf53f2c658ead09f7), W(0x1335e1d59780d14d), W(0x69cc20e0cd1b66bc),
+     W(0x9b670a37bbe0bfc8)},
+    {W(0xce53dc8128efbeed), W(0x0c74e77c8326a6e5), W(0x3604e0d2b88e9a63),
+     W(0xbab38fca13dc2248)},
+    0
+  },
+  {
+    {W(0x255616d3c7141771), W(0xa86691ab2f226b66), W(0xda19fea4b3ca63a9),
+     W(0xfc05dc42ae672f2b)},
+    {W(0xa9c6e786718ba28f), W(0x07b7995b9c66b984), W(0x0f434f551b3702f2),
+     W(0xd6f6212fda84eeff)},
+    0
+  },
+  {
+    {W(0x8ed6e8c85c0a3f1e), W(0xbcad24927c87c37f), W(0xfdfb62bb9ee3b78d),
+     W(0xeba8e477cbceba46)},
+    {W(0x37d38cb0eeaede4b), W(0x0bc498e87976deb6), W(0xb2944c046b6147fb),
+     W(0x8b123f35f71f9609)},
+    0
+  },
+  {
+    {W(0x4b0e7987b5b41d78), W(0xea7df9074bf0c4f8), W(0xb4d03560fab80ecd),
+     W(0x6cf306f6fb1db7e5)},
+    {W(0x0d59fb5689fd4773), W(0xab254f4000f9be33), W(0x18a09a9277352da4),
+     W(0xf81862f5641ea3ef)},
+    0
+  },
+  {
+    {W(0xa155dcc7de79dc24), W(0xf1168a32558f69cd), W(0xbac215950d1850df),
+     W(0x15c8295bb204c848)},
+    {W(0xf661aa367d8184ff), W(0xc396228e30447bdb), W(0x11cd5143bde4a59e),
+     W(0xe3a26e3b6beab5e6)},
+    0
+  },
+  {
+    {W(0xb59b01579f759d01), W(0xa2923d2f7eae4fde), W(0x18327757690ba8c0),
+     W(0x4bf7e38b44f51443)},
+    {W(0xb6812563b413fc26), W(0xedb7d36379e53b36), W(0x4fa585c4c389f66d),
+     W(0x8e1adc3154bd3416)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd3b3a13f1402b9d0), W(0x573441c32c7bc863), W(0x4b301ec4578c3e6e),
+     W(0xc26fc9c40adaf57e)},
+    {W(0x96e71bfd7493cea3), W(0xd05d4b3f1af81456), W(0xdaca2a8a6a8c608f),
+     W(0x53ef07f60725b276)},
+    0
+  },
+  {
+    {W(0xa6b5c9d646ac49d2), W(0x42c77c0b83137aa9), W(0x24d000fc68225a38),
+     W(0x0f63cfc82fe1e907)},
+    {W(0x22d1b01bc6441f95), W(0x7d38f719ec8e448f), W(0x9b33fa5f787fb1ba),
+     W(0x94dcfda1190158df)},
+    0
+  },
+  {
+    {W(0x057fed45526f09fd), W(0xe8a4f10c8128240a), W(0x9332efc4ff2bfd8d),
+     W(0x214e77a0bd35aa31)},
+    {W(0x32896d7314faa40e), W(0x767867ec01e5f186), W(0xc9adf8f117a1813e),
+     W(0xcb6cda7854741795)},
+    0
+  },
+  {
+    {W(0x211cde10296c36ef), W(0x7ee8967282c4da77), W(0xb617d270a57836da),
+     W(0xf0cd9c319cb7560b)},
+    {W(0x01fdcbf7e455fe90), W(0x3fb53cbb7e7334f3), W(0x781e2ea44e7de4ec),
+     W(0x8adab3ad0b384fd0)},
+    0
+  },
+  {
+    {W(0x1c6bd47d53b618c0), W(0xc424f46c6a227923), W(0x7303ffdedd92d964),
+     W(0xe971287871b5abf2)},
+    {W(0x8f48a632f815561d), W(0x85f48ff5d3c055d1), W(0x222a14277525684f),
+     W(0xd0d841a067360cc3)},
+    0
+  },
+  {
+    {W(0x01778a2b599ff0f9), W(0x68a923d78104fc6b), W(0x5bfa44dfda694ff3),
+     W(0x4f7199dbf7667f12)},
+    {W(0xc06d8ff6e46f2a79), W(0x08b5deade9f8131d), W(0x02519a59abb4ce7c),
+     W(0xc4f710bcb42aec3e)},
+    0
+  },
+  {
+    {W(0xb228a90f0e0b040d), W(0xbaf02d8245ff897f), W(0x2aac79e600fa6122),
+     W(0x248288178e36f557)},
+    {W(0xb9521d31113ec356), W(0x9e48861e15eff1f8), W(0x2aa1d412e0d41715),
+     W(0x71f8620353f131b8)},
+    0
+  },
+  {
+    {W(0x3014368b4ed80940), W(0x67e6d0567a6fcedd), W(0x7c208c49ca97579f),
+     W(0xfe3d7a81a23597f6)},
+    {W(0x5e2032027e096ae2), W(0xb1f3e1e724b39366), W(0x26da26f32fdcdffc),
+     W(0x79422f1d6097be83)},
+    0
+  },
+  {
+    {W(0x025c0d7524ae7c52), W(0xb5178ed4a4a10cbf), W(0x17c97d226a0576b8),
+     W(0x758cff4414d58fce)},
+    {W(0xd9c6c7c239adaa99), W(0x5786a440b443bff3), W(0x6533ad2b8cd9561f),
+     W(0x8bf37d94edbcfb0d)},
+    0
+  },
+  {
+    {W(0x50549c748c878145), W(0x67f14edf39c63565), W(0x22ddf78c9bcf2d5e),
+     W(0xffaa842f68201d10)},
+    {W(0x47d94a9dd1b2de28), W(0xc09c4be8054be414), W(0xac80e178ca82755b),
+     W(0xe3251d105697c3bd)},
+    0
+  },
+  {
+    {W(0x1960daf13b191165), W(0x06fef589940361e2), W(0xb85e6b4b82a89bc7),
+     W(0xdb6dc7f58e063f70)},
+    {W(0x458493acde702603), W(0xb09c47e8e988d659), W(0x22da05e14d4ca259),
+     W(0x43b26383b4d19014)},
+    0
+  },
+  {
+    {W(0x2bbe09d35001417b), W(0x795e84ee5962ed5e), W(0x5b79d1ca279f46c3),
+     W(0x1f7f8a3b83836a2e)},
+    {W(0x692200b14a64dc32), W(0xc84243350f84f739), W(0xf110da07cc9155c0),
+     W(0xee8fbe61594b0507)},
+    0
+  },
+  {
+    {W(0xc1e4c20189b23a39), W(0xc87fad5386d6a587), W(0x6b8bc9175869a5bc),
+     W(0xaa715e907445b9a2)},
+    {W(0x405dd4016f5f32b5), W(0xe36f6e7c68e8e0bc), W(0x26ee7d48b930c0e9),
+     W(0x4dde7aad89addce2)},
+    0
+  },
+  {
+    {W(0x2f6a5391035703cc), W(0x9899bf6a40c7e24d), W(0xc3f7f248bbfcbb9a),
+     W(0xf65027ded555875b)},
+    {W(0xa7a16b69ffff3b37), W(0x67b6eb54145b4431), W(0x19d7e1d249afd679),
+     W(0xbd819bab110fccdf)},
+    0
+  },
+  {
+    {W(0x42dca8b1542eaf38), W(0xc8cad8e47f6c839a), W(0x51e29aa52737ac00),
+     W(0x230032a539ebb168)},
+    {W(0xd92c8136c473b8be), W(0x2fd028f47e43f205), W(0x1fdbabd9c655642c),
+     W(0xff04bf9cb64504ed)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x263a2cfb9db3b381), W(0x9c3a2deed4df0a4b), W(0x728d06e97d04e61f),
+     W(0x8b1adfbc42449325)},
+    {W(0x6ec1d9397e053a1b), W(0xee2be5c766daf707), W(0x80ba1e14810ac7ab),
+     W(0xdd2ae778f530f174)},
+    0
+  },
+  {
+    {W(0x0435d97a205b9d8b), W(0x6eb8f064056756d4), W(0xd5e88a8bb6f8210e),
+     W(0x070ef12dec9fd9ea)},
+    {W(0x4d8495053bcc876a), W(0x12a75338a7404ce3), W(0xd22b49e1b8a1db5e),
+     W(0xec1f205114bfa5ad)},
+    0
+  },
+  {
+    {W(0xadbaeb79b6828f36), W(0x9d7a025801bd5b9e), W(0xeda01e0d1e844b0c),
+     W(0x4b625175887edfc9)},
+    {W(0x14109fdd9669b621), W(0x88a2ca56f6f87b98), W(0xfe2eb788170df6bc),
+     W(0x0cea06f4ffa473f9)},
+    0
+  },
+  {
+    {W(0x43ed81b5c4e83d33), W(0xd9f358795efd488b), W(0x164a620f9deb4d0f),
+     W(0xc6927bdbac6a7394)},
+    {W(0x45c28df79f9e0f03), W(0x2868661efcd7e1a9), W(0x7cf4e8d0ffa348f1),
+     W(0x6bd4c284398538e0)},
+    0
+  },
+  {
+    {W(0x2618a091289a8619), W(0xef796e606671b173), W(0x664e46e59090c632),
+     W(0xa38062d41e66f8fb)},
+    {W(0x6c744a200573274e), W(0xd07b67e4a9271394), W(0x391223b26bdc0e20),
+     W(0xbe2d93f1eb0a05a7)},
+    0
+  },
+  {
+    {W(0xf23e2e533f36d141), W(0xe84bb3d44dfca442), W(0xb804a48d6b7c023a),
+     W(0x1e16a8fa76431c3b)},
+    {W(0x1b5452adddd472e0), W(0x7d405ee70d1ee127), W(0x50fc6f1dffa27599),
+     W(0x351ac53cbf391b35)},
+    0
+  },
+  {
+    {W(0x7efa14b84444896b), W(0x64974d2ff94027fb), W(0xefdcd0e8de84487d),
+     W(0x8c45b2602b48989b)},
+    {W(0xa8fcbbc2d8463487), W(0xd1b2b3f73fbc476c), W(0x21d005b7c8f443c0),
+     W(0x518f2e6740c0139c)},
+    0
+  },
+  {
+    {W(0x56036e8c06d75fc1), W(0x2dcf7bb73249a89f), W(0x81dd1d3de245e7dd),
+     W(0xf578dc4bebd6e2a7)},
+    {W(0x4c028903df2ce7a0), W(0xaee362889c39afac), W(0xdc847c31146404ab),
+     W(0x6304c0d8a4e97818)},
+    0
+  },
+  {
+    {W(0xae51dca2a91f6791), W(0x2abe41909baa9efc), W(0xd9d2e2f4559c7ac1),
+     W(0xe82f4b51fc9f773a)},
+    {W(0xa77130274073e81c), W(0xc0276facfbb596fc), W(0x1d819fc9a684f70c),
+     W(0x29b47fddc9f7b1e0)},
+    0
+  },
+  {
+    {W(0x358de103459b1940), W(0xec881c595b013e93), W(0x51574c9349532ad3),
+     W(0x2db1d445b37b46de)},
+    {W(0xc6445b87df239fd8), W(0xc718af75151d24ee), W(0xaea1c4a4f43c6259),
+     W(0x40c0e5d770be02f7)},
+    0
+  },
+  {
+    {W(0x6a4590f4721b33f2), W(0x2124f1fbfedf04ea), W(0xf8e53cde9745efe7),
+     W(0xe7e1043265f046d9)},
+    {W(0xc3fca28ee4d0c7e6), W(0x847e339a87253b1b), W(0x9b5953483743e643),
+     W(0xcb6a0a0b4fd12fc5)},
+    0
+  },
+  {
+    {W(0xfb6836c327d02dcc), W(0x5ad009827a68bcc2), W(0x1b24b44c005e912d),
+     W(0xcc83d20f811fdcfe)},
+    {W(0x36527ec1666fba0c), W(0x6994819714754635), W(0xfcdcb1a8556da9c2),
+     W(0xa593426781a732b2)},
+    0
+  },
+  {
+    {W(0xec1214eda714181d), W(0x609ac13b6067b341), W(0xff4b4c97a545df1f),
+     W(0xa124050134d2076b)},
+    {W(0x6efa0c231409ca97), W(0x254cc1a820638c43), W(0xd4e363afdcfb46cd),
+     W(0x62c2adc303942a27)},
+    0
+  },
+  {
+    {W(0xc67b9df056e46483), W(0xa55abb2063736356), W(0xab93c098c551bc52),
+     W(0x382b49f9b15fe64b)},
+    {W(0x9ec221ad4dff8d47), W(0x79caf615437df4d6), W(0x5f13dc64bb456509),
+     W(0xe4c589d9191f0714)},
+    0
+  },
+  {
+    {W(0x27b6a8ab3fd40e09), W(0xe455842e77313ea9), W(0x8b51d1e21f55988b),
+     W(0x5716dd73062bbbfc)},
+    {W(0x633c11e54e8bf3de), W(0x9a0e77b61b85be3b), W(0x565107290911cca6),
+     W(0x27e76495efa6590f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe4ac8b33070d3aab), W(0x2643672b9a2cd5e5), W(0x52eff79b1cfc9173),
+     W(0x665ca49b90a7c13f)},
+    {W(0x5a8dda59b3efb998), W(0x8a5b922d052f1341), W(0xae9ebbab3cf9a530),
+     W(0x35986e7bf56da4d7)},
+    0
+  },
+  {
+    {W(0x534acf4fda79e5ac), W(0x68b83b3a8630215f), W(0x5c748b2ed085756e),
+     W(0xb0317258e5d37cb2)},
+    {W(0x6735841ac5ccc2c4), W(0x7d7dc96b3d9d5069), W(0xa147e410fd1754bd),
+     W(0x65296e94d399ddd5)},
+    0
+  },
+  {
+    {W(0x831ab3edf0290a8f), W(0xcae81966cb47c387), W(0xaad7dece184efb4f),
+     W(0xdcfc53b34749110e)},
+    {W(0x6698f23c4cb632f9), W(0xc42a1ad6b91f8067), W(0xb116a81d6284180a),
+     W(0xebedf5f8e901326f)},
+    0
+  },
+  {
+    {W(0xd7e0c4cdb30cfb3a), W(0x6d09b8c16c9db4c8), W(0x40ba1a4207c8d9df),
+     W(0x6fd495f71c52c66d)},
+    {W(0xfb0e169f275264da), W(0x80c2b746e57d8362), W(0xedd987f749ad7222),
+     W(0xfdc229af4398ec7b)},
+    0
+  },
+  {
+    {W(0x54a6fe5a59b0ff62), W(0x25ec81a34094d0d4), W(0xfcfd834e33437f1d),
+     W(0x8e98378ba67604dc)},
+    {W(0x53137dd6f4848598), W(0x87f2c5bf62fda36a), W(0x70dc1c27ef74df46),
+     W(0x3ebf428f0a86a056)},
+    0
+  },
+  {
+    {W(0x6713ac7ad0d350a3), W(0x84f6ebf9105a1f2f), W(0x17a1495816254046),
+     W(0xafa5e9a4aef406f7)},
+    {W(0xf97baf7c1cdd69b6), W(0x64081a305ee86474), W(0xeb9f7f091227f62a),
+     W(0x3e47f1dc3485652c)},
+    0
+  },
+  {
+    {W(0x6f975e7fb7f01d83), W(0x5f1f860b45ccf5cb), W(0x22702eba8b70930f),
+     W(0xd8186df72b5cc879)},
+    {W(0x8c065da01720468f), W(0x4247726100464c80), W(0xd8c4bbbec277e1ca),
+     W(0x04aaea1766ba642f)},
+    0
+  },
+  {
+    {W(0xb0d1ed8452666a58), W(0x4bcb6e00e6a9c3c2), W(0x3c57411c26906408),
+     W(0xcfc2075513556400)},
+    {W(0xa08b1c505294dba3), W(0xa30ba2868b7dd31e), W(0xd70ba90e991eca74),
+     W(0x094e142ce762c2b9)},
+    0
+  },
+  {
+    {W(0x542bc9b624593b2c), W(0x8d459d6aa3c4a5d8), W(0xd0d146bf05ee43aa),
+     W(0x3707ef3e44da6976)},
+    {W(0x615383aa874be76d), W(0x547c4d7fcc4f8782), W(0xc8cea7267c6491e4),
+     W(0x858374ead2b2d493)},
+    0
+  },
+  {
+    {W(0x3e07056a5de41c6f), W(0x9a611097e12a897d), W(0x67b015e9a21725ec),
+     W(0xccc2d2b3f796e4ea)},
+    {W(0x013ba88903df229a), W(0x2a118715c59584b1), W(0xd9e64cc5662ee195),
+     W(0x0adf410701d5ced3)},
+    0
+  },
+  {
+    {W(0xea87389ab1753624), W(0x10fd265233c61483), W(0x6fa52aca98a1d8f8),
+     W(0x70ad5c05bc5253e2)},
+    {W(0x163c1b0f8484f5cd), W(0x6c2de03c20bc1ec6), W(0xd56dd52428f6d210),
+     W(0xa29d8ced39ae9820)},
+    0
+  },
+  {
+    {W(0x88ea439bac7f13ef), W(0x65aa143f8d9a7d14), W(0xffe0cf2d20cb2f1a),
+     W(0x847b7bf1381c6ad1)},
+    {W(0x56f5b8148ac80b4d), W(0x041b441835ceaff2), W(0xde9088c0cda5fcef),
+     W(0xe668519be083b8ce)},
+    0
+  },
+  {
+    {W(0x89003860bb8282ad), W(0xeaf0446cc144cb6f), W(0x2fd111498e166b0a),
+     W(0x162fe9437586b9a4)},
+    {W(0x8c7eb8b07a5bfe72), W(0x21381aa27123f232), W(0x2109da4b2e23051c),
+     W(0xca4f85bb968a8ee8)},
+    0
+  },
+  {
+    {W(0xe7988919e6d5c574), W(0x9b05deb900a46083), W(0x335601648a079ead),
+     W(0x2d53a351528f6128)},
+    {W(0xbd61dc930f8ff5be), W(0x880889ae9fb96965), W(0x37bc5d51ea96bd2a),
+     W(0x77fdff39de29286a)},
+    0
+  },
+  {
+    {W(0x3034bd653db8257a), W(0x78461d3f0ea6d8ca), W(0x92f28378bf2ba2da),
+     W(0x16b4edec601bbbe3)},
+    {W(0x90eec2ea0068ed20), W(0x17bf054211e377d2), W(0x32893dc357fc6649),
+     W(0x992e54b425cc711c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb81d783e979f3925), W(0x1efd130aaf4c89a7), W(0x525c2144fd1bf7fa),
+     W(0x4b2969041b265a9e)},
+    {W(0xed8e9634b9db65b6), W(0x35c82e3203599d8a), W(0xdaa7a54f403563f3),
+     W(0x9df088ad022c38ab)},
+    0
+  },
+  {
+    {W(0x8d084f124237b64b), W(0x688ebe99e3ecfd07), W(0x57b8a70cf6845dd8),
+     W(0x808fc59c5da4a325)},
+    {W(0xa9032b2ba3585862), W(0xb66825d5edf29386), W(0xb5a5a8db431ec29b),
+     W(0xbb143a983a1e8dc8)},
+    0
+  },
+  {
+    {W(0x9e93ba24f111661e), W(0xedced484b105eb04), W(0x96dc9ba1f424b578),
+     W(0xbf8f66b7e83e9069)},
+    {W(0x872d4df4d7ed8216), W(0xbf07f3778e2cbecf), W(0x4281d89998e73754),
+     W(0xfec85fbb8aab8708)},
+    0
+  },
+  {
+    {W(0x13b5bf22765fa7d0), W(0x59805bf01d6a5370), W(0x67a5e29d4280db98),
+     W(0x4f53916f776b1ce3)},
+    {W(0x714ff61f33ddf626), W(0x4206238ea085d103), W(0x1c50d4b7e5809ee3),
+     W(0x999f450d85f8eb1d)},
+    0
+  },
+  {
+    {W(0x82eebe731a3a93bc), W(0x42bbf465a21adc1a), W(0xc10b6fa4ef030efd),
+     W(0x247aa4c787b097bb)},
+    {W(0x8b8dc632f60c77da), W(0x6ffbc26ac223523e), W(0xa4f6ff11344579cf),
+     W(0x5825653c980250f6)},
+    0
+  },
+  {
+    {W(0x4bf367ba4a493b31), W(0x54f20a529bf7f026), W(0xb696e0629795914b),
+     W(0xcddab96d8bf236ac)},
+    {W(0x4ff2c70aed25ea13), W(0xfa1d09eb81cbbbe7), W(0x88fc8c87468544c5),
+     W(0x847a670d696b3317)},
+    0
+  },
+  {
+    {W(0xeda6c595d314e7bc), W(0x2ee7464b467899ed), W(0x1cef423c0a1ed5d3),
+     W(0x217e76ea69cc7613)},
+    {W(0x27ccce1fe7cda917), W(0x12d8016b8a893f16), W(0xbcd6de849fc74f6b),
+     W(0xfa5817e2f3144e61)},
+    0
+  },
+  {
+    {W(0xb79d4cc5ac751e7b), W(0x93f96472fd4211bd), W(0x8c72d3d2c8de4fc6),
+     W(0x7b69cbf5df44f064)},
+    {W(0x3da90ca2f4bf94e1), W(0x1a5325f8f12894e2), W(0x0a437f6c7917d60b),
+     W(0x9be7048696c9cb5d)},
+    0
+  },
+  {
+    {W(0xc0b48d4e49ccd6d7), W(0xff8fb02c88bd5580), W(0xc75235e907d473b2),
+     W(0x4fab1ac5a2188af3)},
+    {W(0x030fa3bc97576ec0), W(0xe8c946e80b7e7d2f), W(0x40a5c9cc70305600),
+     W(0x6d8260a9c8b013b4)},
+    0
+  },
+  {
+    {W(0xe6c51073615cd9e4), W(0x498ec047f1243c06), W(0x3e5a8809b17b3d8c),
+     W(0x5cd99e610cc565f1)},
+    {W(0x81e312df7851dafe), W(0xf156f5baa79061e2), W(0x80d62b71880c590e),
+     W(0xbec9746f0a39faa1)},
+    0
+  },
+  {
+    {W(0x2b09d2c3cfdcf7dd), W(0x41a9fce3723fcab4), W(0x73d905f707f57ca3),
+     W(0x080f9fb1ac8e1555)},
+    {W(0x7c088e849ba7a531), W(0x07d35586ed9a147f), W(0x602846abaf48c336),
+     W(0x7320fd320ccf0e79)},
+    0
+  },
+  {
+    {W(0x1ecc8cb9d3210a04), W(0x6bc7d463dafb5269), W(0x3e59b10a67c3489f),
+     W(0x1769788c65641e1b)},
+    {W(0x8a53b82dbd6cb838), W(0x7066d6e6236d5f22), W(0x03aa1c616908536e),
+     W(0xc971da0d66ae9809)},
+    0
+  },
+  {
+    {W(0x92eb40907f8f875d), W(0x9c9d754e56c26bbf), W(0x158cea618110bbe7),
+     W(0x62a6b802745f91ea)},
+    {W(0xa79c41aac6e7394b), W(0x445b6a83ad57ef10), W(0x0c5277eb6ea6f40c),
+     W(0x319fe96b88633365)},
+    0
+  },
+  {
+    {W(0xcbcde2393191f4fd), W(0x43093e16d3d6ada1), W(0x184579f358769606),
+     W(0x2c94a8b3d236625c)},
+    {W(0x6922b9c05c437d8e), W(0x3d4ae423d8d9f3c8), W(0xf72c31c12e7090a2),
+     W(0x4ac3f5f3d76a55bd)},
+    0
+  },
+  {
+    {W(0x77f84203d39b8c34), W(0xed8b1be63125eddb), W(0x5bbf2441f6e39dc5),
+     W(0xb00f6ee66a5d678a)},
+    {W(0xba456ecf57d0ea99), W(0xdcae0f5817e06c43), W(0x01643de40f5b4baa),
+     W(0x2c324341d161b9be)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x949c9976e1337c26), W(0x6faadebdd73d68e5), W(0x9e158614f1b768d9),
+     W(0x22dfa5579cc4f069)},
+    {W(0xccd6da17be93c6d6), W(0x24866c61a504f5b9), W(0x2121353c8d694da1),
+     W(0x1c6ca5800140b8c6)},
+    0
+  },
+  {
+    {W(0xf1604a7dd4b79bb8), W(0xaee806fb52c878c8), W(0x34144f118d47b8e8),
+     W(0x72edf52b949f9054)},
+    {W(0xebfca84e2127015a), W(0x9051d0c09cb7cef3), W(0x86e8fe58296deec8),
+     W(0x33b2818841010d74)},
+    0
+  },
+  {
+    {W(0xbd5660ed9aed9f40), W(0x70ca6ad1532a8c99), W(0xc4978bfb95c371ea),
+     W(0xe5464d0d7003109d)},
+    {W(0x1af32fdfd9e535ef), W(0xabf57ea798c9185b), W(0xed7a741712b42488),
+     W(0x8e0296a7e97286fa)},
+    0
+  },
+  {
+    {W(0x01079383171b445f), W(0x9bcf21e38131ad4c), W(0x8cdfe205c93987e8),
+     W(0xe63f4152c92e8c8f)},
+    {W(0x729462a930add43d), W(0x62ebb143c980f05a), W(0x4f3954e53b06e968),
+     W(0xfe1d75ad242cf6b1)},
+    0
+  },
+  {
+    {W(0x8b57416e1f017d5e), W(0x375333967674e99b), W(0x6e6d94c0e8f488a0),
+     W(0xb93a787adc16f95e)},
+    {W(0xc3ac51a2dcc99ccc), W(0xc134b4139aa47c1d), W(0xf28fcdafafdfd8d5),
+     W(0x0d57bd8e10b831ed)},
+    0
+  },
+  {
+    {W(0x9276fbccf0bcfc46), W(0x3a822aceb5cffee6), W(0x328ed2fec75d915b),
+     W(0xa145c113c359476c)},
+    {W(0xf61a81538be17bcd), W(0x01e867c3aa6c3d8f), W(0x5634e15d6516c82f),
+     W(0xc1437bd26948b9b0)},
+    0
+  },
+  {
+    {W(0xd2fcd2006c19d4c7), W(0xa0f3c437e1b1e976), W(0xf0545ff694f237e8),
+     W(0xdd10ec3fc0bf8bb1)},
+    {W(0x4f89696cac7cd3e1), W(0xed3714ec5f24bfe6), W(0x363eb1d85faf7706),
+     W(0xfcbd604dc027cc32)},
+    0
+  },
+  {
+    {W(0x5f95c6c7af8685c8), W(0xd4c1c8ce2f8f01aa), W(0xc44bbe322574692a),
+     W(0xb8003478d4a4a068)},
+    {W(0x7c8fc6e52eca3cdb), W(0xea1db16bec04d399), W(0xb05bc82e8f2bc5cf),
+     W(0x763d517ff44793d2)},
+    0
+  },
+  {
+    {W(0x16ce8eddc355363b), W(0x4af2f70ff8820d6e), W(0xcb7ed4d27661a508),
+     W(0x41d3444edd195472)},
+    {W(0x17fea2b438da9649), W(0x9bf69356aeb4a200), W(0xa13b5f916ab19c3d),
+     W(0xc0519c14dc9360a6)},
+    0
+  },
+  {
+    {W(0xc2571ae92e42e171), W(0xcb31ab63ed41ccf9), W(0x37f3c576b5c8854f),
+     W(0x66e5191bc62392a1)},
+    {W(0x71565a1c6cd5683b), W(0x484b0283606fe689), W(0xf3a25d6767e2fda6),
+     W(0x87ba21de8a65c0a4)},
+    0
+  },
+  {
+    {W(0xde74e49ca70684d1), W(0x3ae8766133e80c3d), W(0x5984a2a916a5c34d),
+     W(0x09a83eccb8298c35)},
+    {W(0x9a19867caa4ca4c0), W(0x02085610b375b8ff), W(0xf296328bf70396dc),
+     W(0x9c9ddc4cde6fae63)},
+    0
+  },
+  {
+    {W(0x4451c1b808bd98d0), W(0x644b1cd46575f240), W(0x6907eb337375d270),
+     W(0x56c8bebdfa2286bd)},
+    {W(0xc713d2acc4632b46), W(0x17da427aafd60242), W(0x313065b7c95c7546),
+     W(0xf8239898bf17a3de)},
+    0
+  },
+  {
+    {W(0x94683d260b083b6e), W(0x0a3752eb06f6a54d), W(0x48bedc23752074dd),
+     W(0x637622fc3e822593)},
+    {W(0xea0005136be55d3b), W(0x9f5e12f4324d006d), W(0x529486a964fc0270),
+     W(0x09ba0d0c923399e6)},
+    0
+  },
+  {
+    {W(0x363858473a977080), W(0x4cf8e1b80c6a6ab6), W(0x919a5c6c0482261e),
+     W(0x517a9ad0e5ce4806)},
+    {W(0x2792d40c056aa7aa), W(0x4c7c6adae56c61b0), W(0xf19cb178a4b19e0c),
+     W(0x046d5c4fe4ba267f)},
+    0
+  },
+  {
+    {W(0xd3e926ab121550b3), W(0xe4975e4ac147ce84), W(0x7a8be0f95eff722a),
+     W(0x71e4702c6fd4f2a0)},
+    {W(0x13b92acf3cb7b280), W(0xc588716d28272d73), W(0x862c7bf3daa9fe5c),
+     W(0x78c008f2e2a79e42)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf3b7963f4c830320), W(0x842c7aa0903203e3), W(0xaf22ca0ae7327afb),
+     W(0x38e13092967609b6)},
+    {W(0x73b8fb62757558f1), W(0x3cc3e831f7eca8c1), W(0xe4174474f6331627),
+     W(0xa77989cac3c40234)},
+    0
+  },
+  {
+    {W(0xae8317f4b0166f7a), W(0xfbd3e3f7ceec74e6), W(0xfdb516ace0874bfd),
+     W(0x3d846019c681f3a3)},
+    {W(0x0b12ee5c7c1620b0), W(0xba68b4dd2b63c501), W(0xac03cd326668c51e),
+     W(0x2a6279f74e0bcb5b)},
+    0
+  },
+  {
+    {W(0xb32cb8b0b796d219), W(0xc3e95f4f34741dd9), W(0x8721212568edf6f5),
+     W(0x7a03aee4a2b9cb8e)},
+    {W(0x0cd3c376f53a89aa), W(0x0d8af9b1948a28dc), W(0xcf86a3f4902ab04f),
+     W(0x8aacb62a7f42002d)},
+    0
+  },
+  {
+    {W(0xfd8e139f8f5fcda8), W(0xf3e558c4bdee5bfd), W(0xd76cbaf4e33f9f77),
+     W(0x3a4c97a471771969)},
+    {W(0xda27e84bf6dce6a7), W(0xff373d9613e6c2d1), W(0xf115193cd759a6e9),
+     W(0x3f9b702563d2262c)},
+    0
+  },
+  {
+    {W(0x9cb0ae6c252bd479), W(0x05e0f88a12b5848f), W(0x78f6d2b2a5c97663),
+     W(0x6f6e149bc162225c)},
+    {W(0xe602235cde601a89), W(0xd17bbe98f373be1f), W(0xcaf49a5ba8471827),
+     W(0x7e1a0a8518aaa116)},
+    0
+  },
+  {
+    {W(0x12536fea87baa627), W(0x58c1fec1f72aa680), W(0x6c29b637601e5dc9),
+     W(0x9e3c3c1cde9e01b9)},
+    {W(0xefc8127b2bcfe0b0), W(0x351071022a12f50d), W(0x6ccd6cb14879b397),
+     W(0xf792f804f8a82f21)},
+    0
+  },
+  {
+    {W(0x8b1e572235e6fc06), W(0x3477728f0b3e13d5), W(0x150c294daa8a7372),
+     W(0xc0291d433bfa528a)},
+    {W(0xc6c8bc67cec5a196), W(0xdeeb31e45c2e8a7c), W(0xba93e244fb6e1c51),
+     W(0xb9f8b71b2e28e156)},
+    0
+  },
+  {
+    {W(0x8c3184911a335cc8), W(0x563459ba6a5913e4), W(0x1b920d61c7b32919),
+     W(0x805ab8b6a02425ad)},
+    {W(0x2ac512da8d006086), W(0x6ca4846abcf5c0fd), W(0xafea51d8ac2138d7),
+     W(0xcb647545344cd443)},
+    0
+  },
+  {
+    {W(0x343ac0a3ee9523f0), W(0xbb75eab2975ea978), W(0x1bccf332107387f4),
+     W(0x790f92599ab0062e)},
+    {W(0xf1a363ad1e4f6a5f), W(0x06e08b8462519a50), W(0x609151877265f1ee),
+     W(0x6a80ca3493ae985e)},
+    0
+  },
+  {
+    {W(0xa3f4f521e447f2c4), W(0x81b8da7a604291f0), W(0xd680bc467d5926de),
+     W(0x84f21fd534a1202f)},
+    {W(0x1d1e31814e9df3d8), W(0x1ca4861a39ab8d34), W(0x809ddeec5b19aa4a),
+     W(0x59f72f7e4d329366)},
+    0
+  },
+  {
+    {W(0x2dfb9e08be0f4492), W(0x3ff0da03e9d5e517), W(0x03dbe9a1f79466a8),
+     W(0x0b87bcd015ea9932)},
+    {W(0xeb64fc83ab1f58ab), W(0x6d9598da817edc8a), W(0x699cff661d3b67e5),
+     W(0x645c0f2992635853)},
+    0
+  },
+  {
+    {W(0x9f1b2466cdedca85), W(0x140bb7101a09538c), W(0xac8ae8515e11115d),
+     W(0x0d63ff676f03f59e)},
+    {W(0x755e55517d234afb), W(0x61c2db4e7e208fc1), W(0xaa9859cef28a4b5d),
+     W(0xbdd6d4fc34af030f)},
+    0
+  },
+  {
+    {W(0xd50e57c7d7fe71f3), W(0x15342190bc97ce38), W(0x51bda2de4df07b63),
+     W(0xba12aeae200eb87d)},
+    {W(0xabe135d2a9b4f8f6), W(0x04619d65fad6d99c), W(0x4a6683a77994937c),
+     W(0x7a778c8b6f94f09a)},
+    0
+  },
+  {
+    {W(0x3f39e67f906151e5), W(0xcea27f5f55e10649), W(0xdca1d4e1c17cf7b7),
+     W(0x0c326d122fe2362d)},
+    {W(0x05f7ac337dd35df3), W(0x0c3b7639c396dbdf), W(0x0912f5ac03b7db1c),
+     W(0x9dea4b705c9ed4a9)},
+    0
+  },
+  {
+    {W(0x8dd1fb83425c6559), W(0x7fc00ee60af06fda), W(0xe98c922533d956df),
+     W(0x0f1ef3354fbdc8a2)},
+    {W(0x2abb5145b79b8ea2), W(0x40fd2945bdbff288), W(0x6a814ac4d7185db7),
+     W(0xc4329d6fc084609a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x511053e453544774), W(0x834d0ecc3adba2bc), W(0x4215d7f7bae371f5),
+     W(0xfcfd57bf6c8663bc)},
+    {W(0xded2383dd6901b1d), W(0x3b49fbb4b5587dc3), W(0xfd44a08d07625f62),
+     W(0x3ee4d65b9de9b762)},
+    0
+  },
+  {
+    {W(0x64e5137d0d63d1fa), W(0x658fc05202a9d89f), W(0x4889487450436309),
+     W(0xe9ae30f8d598da61)},
+    {W(0x2ed710d1818baf91), W(0xe27e9e068b6a0c20), W(0x1e28dcfb1c1a6b44),
+     W(0x883acb64d6ac57dc)},
+    0
+  },
+  {
+    {W(0xed7f2e774e6daae2), W(0x7b3ae0e39e0a19bc), W(0xd3293f8a91ae677e),
+     W(0xd363b0cb45c8611f)},
+    {W(0xbe1d1ccf309ae93b), W(0xa3f80be73920cae1), W(0xaaacba74498edf01),
+     W(0x1e6d2a4ab2f5ac90)},
+    0
+  },
+  {
+    {W(0x8735728dc2c6ff70), W(0x79d6122fc5dc2235), W(0x23f5d00319e277f9),
+     W(0x7ee84e25dded8cc7)},
+    {W(0x91a8afb063cd880a), W(0x3f3ea7c63574af60), W(0x0cfcdc8402de7f42),
+     W(0x62d0792fb31aa152)},
+    0
+  },
+  {
+    {W(0x40fdf5aabeccefb5), W(0xcf56ede93621d7c7), W(0xb632a9ce52b576c1),
+     W(0xd3403ae89a6f6027)},
+    {W(0x660a050de8785a64), W(0x10f3d6479682652e), W(0x78b25edf4fbcbe02),
+     W(0xc9710fdeb4f9315d)},
+    0
+  },
+  {
+    {W(0x8e1b4e438a5807ce), W(0xad283893e4109a7e), W(0xc30cc9cbafd59dda),
+     W(0xf65f36c63d8d8093)},
+    {W(0xdf31469ea60d32b2), W(0xee93df4b3e8191c8), W(0x9c1017c5355bdeb5),
+     W(0xd26231858616aa28)},
+    0
+  },
+  {
+    {W(0xd655ade73245980e), W(0xa6f5965781067200), W(0xe4fc23bedb136be1),
+     W(0x9f246cdcaf13d879)},
+    {W(0xc2b93117f961ac0e), W(0xc8a741b5ebdb9e1a), W(0x82ede2466c693bd1),
+     W(0xfcde6b4f3dd1701e)},
+    0
+  },
+  {
+    {W(0xb02c83f9dec31a21), W(0x988c8b236ad9d573), W(0x53e983aea57be365),
+     W(0xe968734d646f834e)},
+    {W(0x9137ea8f5da6309b), W(0x10f3a624c1f1ce16), W(0x782a9ea2ca440921),
+     W(0xdf94739e5b46f1b5)},
+    0
+  },
+  {
+    {W(0xc68286970f6f722b), W(0xb51401b01ce64e46), W(0x78681257370279a0),
+     W(0x7418386039280446)},
+    {W(0xbc44192eb6b3f93e), W(0x9732ea4961d9298f), W(0x520b8af5bf71120f),
+     W(0x75138f704bd2cced)},
+    0
+  },
+  {
+    {W(0x9f9be006cce85c9b), W(0x360e70d6a4c7c2d3), W(0x2cd5beeaaefa1e60),
+     W(0x64cf63c08c3d2b6d)},
+    {W(0xfb107fa3e1cf6f90), W(0xb7e937c6d5e044e6), W(0x74e8ca78ce34db9f),
+     W(0x4f8b36c13e210bd0)},
+    0
+  },
+  {
+    {W(0xa8cedfdae230cc55), W(0x36477872cace5c58), W(0x8878a5cd76d9acae),
+     W(0x5900c6afc1605435)},
+    {W(0xd4b0af62681f275d), W(0xaf445a6067fadc4b), W(0x79e9b8fe07ee1aa7),
+     W(0x8350bbc7f4318176)},
+    0
+  },
+  {
+    {W(0x1df165a434a35ea8), W(0x3418e0f74d4412f6), W(0x5af1f8af518836c3),
+     W(0x42ceef4d130e1965)},
+    {W(0x5560ca0b543a1957), W(0xc33761e5886cb123), W(0x66624b1ffe98ed30),
+     W(0xf772f4bf1090997d)},
+    0
+  },
+  {
+    {W(0x5fd75b65a1c55ee6), W(0xf95b02af26d3aa58), W(0xb9501ed3f99e1761),
+     W(0xcb9d2ebc6737cc00)},
+    {W(0xa921bf5f21c646fa), W(0x78fe6fa7e23856a7), W(0xfbb5b7217f77bf35),
+     W(0xf6716e8deb11fcf2)},
+    0
+  },
+  {
+    {W(0xf4e540bb4885d410), W(0x7287f8109ba5f8d7), W(0x22d0d865de98dfb1),
+     W(0x49ff51a1bcfbb8a3)},
+    {W(0xb6b6fa536bc3012e), W(0x3d31fd72170d541d), W(0x8018724f4b0f4966),
+     W(0x79e7399f87dbde07)},
+    0
+  },
+  {
+    {W(0x4add3d0786582d9d), W(0x49449b73d92f2591), W(0xc48257f40a8f073e),
+     W(0x8c98045c304bf77a)},
+    {W(0xbf3507c09e2e77ae), W(0xc280dd8930ef837d), W(0x2e8023c203f7fc9e),
+     W(0x62243622fc6a75ee)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x56f8410ef4f8b16a), W(0x97241afec47b266a), W(0x0a406b8e6d9c87c1),
+     W(0x803f3e02cd42ab1b)},
+    {W(0x7f0309a804dbec69), W(0xa83b85f73bbad05f), W(0xc6097273ad8e197f),
+     W(0xc097440e5067adc1)},
+    0
+  },
+  {
+    {W(0x3f747fa0b311898c), W(0xe2a272e4cd0eac65), W(0x4bba5851f914d0bc),
+     W(0x7a1a9660c4a43ee3)},
+    {W(0xe5a367cea1c8cde9), W(0x9d958ba97271abe3), W(0xf3ff7eb63d1615cd),
+     W(0xa2280dcef5ae20b0)},
+    0
+  },
+  {
+    {W(0x266344a43794f8dc), W(0xdcca923a483c5c36), W(0x2d6b6bbf3f9d10a0),
+     W(0xb320c5ca81d9bdf3)},
+    {W(0x620e28ff47b50a95), W(0x933e3b01cef03371), W(0xf081bf8599100153),
+     W(0x183be9a0c3a8c8d6)},
+    0
+  },
+  {
+    {W(0xb6c185c341dca566), W(0x7de7fedad8622aa3), W(0x99e84d92901b6dfb),
+     W(0x30a02b0e7c4ad288)},
+    {W(0xc7c81daa2fd3cf36), W(0xd1319547df89e59f), W(0xb2be8184cd496733),
+     W(0xd5f449eb93d3412b)},
+    0
+  },
+  {
+    {W(0x25470fabe085116b), W(0x04a4337587285310), W(0x4e39187ee2bfd52f),
+     W(0x36166b447d9ebc74)},
+    {W(0x92ad433cfd4b322c), W(0x726aa817ba79ab51), W(0xf96eacd8c1db15eb),
+     W(0xfaf71e910476be63)},
+    0
+  },
+  {
+    {W(0xd74e9bdac97e6516), W(0x88779360c230f49e), W(0xa6ec1de31e74ea49),
+     W(0x581dcee53fb645a2)},
+    {W(0xbaef23918f483f14), W(0x6d2dddfcd137d13b), W(0x54cde50ed2743a42),
+     W(0x89a34fc5e4d97e67)},
+    0
+  },
+  {
+    {W(0x72cfd2e949dee168), W(0x1ae052233e2af239), W(0x009e75be1d94066a),
+     W(0x6cca31c738abf413)},
+    {W(0xb50bd61d9bc49908), W(0x4a9b4a8cf5e2bc1e), W(0xeb6cc5f7946f83ac),
+     W(0x27da93fcebffab28)},
+    0
+  },
+  {
+    {W(0xc492ec644cd8f64c), W(0x58a2d790279d7b51), W(0x0ced1fc51fc75256),
+     W(0x3e658aed8f433017)},
+    {W(0x0b61942e05da59eb), W(0xba3d60a30ddc3722), W(0x7c311cd1742e7f87),
+     W(0x6473ffeef6b01b6e)},
+    0
+  },
+  {
+    {W(0x3ce519ef76257c51), W(0x6f5818d318d477e7), W(0xab022e037963edc0),
+     W(0xf0403a898bd1f5f3)},
+    {W(0xe43b8da0496033ca), W(0x0994e10ea1cfdd72), W(0xb1ec6d20ba73c0e2),
+     W(0x0329c9ecb6bcfad1)},
+    0
+  },
+  {
+    {W(0xf1ff42a12c84bd9d), W(0x751f3ec4390c674a), W(0x27bb36f701e5e0ca),
+     W(0x65dfff515caf6692)},
+    {W(0x5df579c4cd7bbd3f), W(0xef8fb29785591205), W(0x1ded7203e47ac732),
+     W(0xa93dc45ccd1c331a)},
+    0
+  },
+  {
+    {W(0xbdec338e3318d2d4), W(0x733dd7bbbe8de963), W(0x61bcc3baa2c47ebd),
+     W(0xa821ad1935efcbde)},
+    {W(0x91ac668c024cdd5c), W(0x7ba558e4c1cdfa49), W(0x491d4ce0908fb4da),
+     W(0x7ba869f9f685bde8)},
+    0
+  },
+  {
+    {W(0x7b2a0bcb81f41c78), W(0x5c522c851fd240e1), W(0xce512e68df5ce3f6),
+     W(0xa7d4b952b6d5ee13)},
+    {W(0x8cdc0a8b31ad7eaf), W(0x165e86751b915e20), W(0x8e8c269b5d6477f4),
+     W(0xd28d5ade44421b91)},
+    0
+  },
+  {
+    {W(0xed1b5ec279f464ba), W(0x2d65e42c47d72e26), W(0x8198e5749e67f926),
+     W(0x4106673834747e44)},
+    {W(0x4637acc1e37e5447), W(0x02cbc9ecf3e15822), W(0x58a8e98e805aa83c),
+     W(0x73facd6e5595e800)},
+    0
+  },
+  {
+    {W(0x197cfdb332a92318), W(0x9ebea84125ac87b6), W(0x4cd805f7a3510c7a),
+     W(0x24df999ae06e428e)},
+    {W(0xd54dd5dc4d71459c), W(0x1484324f20b8a03c), W(0x7924f2d93174b927),
+     W(0x42b8acbff93ade50)},
+    0
+  },
+  {
+    {W(0x468ff80338330507), W(0x06f34ddf4037a53e), W(0x70cd1a408d6993a4),
+     W(0xf85a159743e5c022)},
+    {W(0x396fc9c2c125a67d), W(0x03b7bebf1064bfcb), W(0x7c444592a9806dcb),
+     W(0x1b02614b4487cd54)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8303604f692ac542), W(0xf079ffe1227b91d3), W(0x19f63e6315aaf9bd),
+     W(0xf99ee565f1f344fb)},
+    {W(0x8a1d661fd6219199), W(0x8c883bc6d48ce41c), W(0x1065118f3c74d904),
+     W(0x713889ee0faf8b1b)},
+    0
+  },
+  {
+    {W(0x972b3f8f81a1b3be), W(0x4f3ce145ce2764a0), W(0xe2d0f1cc28c4f5f7),
+     W(0xdeee0c0dc7f3985b)},
+    {W(0x7df4adc0d39e25c3), W(0x40619820c467a080), W(0x440ebc9361cf5a58),
+     W(0x527729a6422ad600)},
+    0
+  },
+  {
+    {W(0xca6c0937b1b76ba6), W(0x1a2eab854d2026dc), W(0xb1715e1519d9ae0a),
+     W(0xf1ad9199bac4a026)},
+    {W(0x35b3dfb807ea7b0e), W(0xedf5496f3ed9eb89), W(0x8932e5ff2d6d08ab),
+     W(0xf314874e25bd2731)},
+    0
+  },
+  {
+    {W(0xefb26a753f73f449), W(0x1d1c94f88d44fc79), W(0x49f0fbc53bc0dc4d),
+     W(0xb747ea0b3698a0d0)},
+    {W(0x5218c3fe228d291e), W(0x35b804b543c129d6), W(0xfac859b8d1acc516),
+     W(0x6c10697d95d6e668)},
+    0
+  },
+  {
+    {W(0xc38e438f0876fd4e), W(0x45f0c30783d2f383), W(0x203cc2ecb10934cb),
+     W(0x6a8f24392c9d46ee)},
+    {W(0xf16b431b65ccde7b), W(0x41e2cd1827e76a6f), W(0xb9c8cf8f4e3484d7),
+     W(0x64426efd8315244a)},
+    0
+  },
+  {
+    {W(0x1c0a8e44fc94dea3), W(0x34c8cdbfdad6a0b0), W(0x919c384004113cef),
+     W(0xfd32fba415490ffa)},
+    {W(0x58d190f6795dcfb7), W(0xfef01b0383588baf), W(0x9e6d1d63ca1fc1c0),
+     W(0x53173f96f0a41ac9)},
+    0
+  },
+  {
+    {W(0x2b1d402aba16f73b), W(0x2fb310148cf9b9fc), W(0x2d51e60e446ef7bf),
+     W(0xc731021bb91e1745)},
+    {W(0x9d3b47244fee99d4), W(0x4bca48b6fac5c1ea), W(0x70f5f514bbea9af7),
+     W(0x751f55a5974c283a)},
+    0
+  },
+  {
+    {W(0x6e30251acb452fdb), W(0x31ee696550f30650), W(0xb0b3e508933548d9),
+     W(0xb8949a4ff4b0ef5b)},
+    {W(0x208b83263c88f3bd), W(0xab147c30db1d9989), W(0xed6515fd44d4df03),
+     W(0x17a12f75e72eb0c5)},
+    0
+  },
+  {
+    {W(0x3b59796d36cf69db), W(0x1219eee956670c18), W(0xfe3341f77a070d8e),
+     W(0x9b70130ba327f90c)},
+    {W(0x36a324620ae18e0e), W(0x2021a62346c0a638), W(0x251b5817c62eb0d4),
+     W(0x87bfbcdf4c762293)},
+    0
+  },
+  {
+    {W(0xf78ab505cdd61d64), W(0x8c7a53fcc8c18857), W(0xa653ce6f16147515),
+     W(0x9c923aa5ea7d52d5)},
+    {W(0xc24709cb5c18871f), W(0x7d53bec873b3cc74), W(0x59264afffdd1d4c4),
+     W(0x5555917e240da582)},
+    0
+  },
+  {
+    {W(0xcae8bbda548f5a0e), W(0x1910eaba3bbfbbe1), W(0xae5796857677afc3),
+     W(0x49ea61f173ff0b5c)},
+    {W(0x786554784f7c3922), W(0x95d337cd20c68eef), W(0x68f1e1e5df779ab9),
+     W(0x14b491b0b5cf69a8)},
+    0
+  },
+  {
+    {W(0x7a6cbbe028e3fe89), W(0xe7e1fee4c5aac0eb), W(0x7f47eda5697e5140),
+     W(0x4f450137b454921f)},
+    {W(0xdb625f8495cd8185), W(0x74be0ba1cdb2e583), W(0xaee4fd7cdd5e6de4),
+     W(0x4251437de8101739)},
+    0
+  },
+  {
+    {W(0x686d72a0ac620366), W(0x4be3fb9cb6d59344), W(0x6e8b44e7a1eb75b9),
+     W(0x84e39da391a5c10c)},
+    {W(0x37cc1490b38f0409), W(0x029519432c2ade82), W(0x9b6887831190a2d8),
+     W(0x25627d14231182ba)},
+    0
+  },
+  {
+    {W(0x6eb550aa658a6d87), W(0x1405aaa7cf9c7325), W(0xd147142e5c8748c9),
+     W(0x7f637e4f53ede0e0)},
+    {W(0xf8ca277614ffad2c), W(0xe58fb1bdbafb6791), W(0x17158c23bf8f93fc),
+     W(0x7f15b3730a4a4655)},
+    0
+  },
+  {
+    {W(0x39d4add2d842ca72), W(0xa71e43913ed96305), W(0x5bb09cbe6700be14),
+     W(0x68d69d54d8befcf6)},
+    {W(0xa45f536737183bcf), W(0x7152b7bb3370dff7), W(0xcf887baabf12525b),
+     W(0xe7ac7bddd6d1e3cd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x25914f7881fdad90), W(0xcf638f560d2cf6ab), W(0xb90bc03fcc054de5),
+     W(0x932811a718b06350)},
+    {W(0x2f00b3309bbd11ff), W(0x76108a6fb4044974), W(0x801bb9e0a851d266),
+     W(0x0dd099bebf8990c1)},
+    0
+  },
+  {
+    {W(0x14c6dd8a58d6cd46), W(0x9cb633b58e6634d2), W(0xc1305047f81bc328),
+     W(0x12ede0e226a177e5)},
+    {W(0x332cca62065a6f4f), W(0xc3a47ecd67be487b), W(0x741eb1870f47ed1c),
+     W(0x99e66e58e7598b14)},
+    0
+  },
+  {
+    {W(0xebd6a6777b0ac93d), W(0xa6e37b0d78f5e0d7), W(0x2516c09676f5492b),
+     W(0x1e4bf8889ac05f3a)},
+    {W(0xcdb42ce04df0ba2b), W(0x935d5cfd5062341b), W(0x8a30333382acac20),
+     W(0x429438c45198b00e)},
+    0
+  },
+  {
+    {W(0xfb2838be67e573e0), W(0x05891db94084c44b), W(0x9131137396c1c2c5),
+     W(0x6aebfa3fd958444b)},
+    {W(0xac9cdce9e56e55c1), W(0x7148ced32caa46d0), W(0x2e10c7efb61fe8eb),
+     W(0x9fd835daff97cf4d)},
+    0
+  },
+  {
+    {W(0x6c626f56c1770616), W(0x5351909e09da9a2d), W(0xe58e6825a3730e45),
+     W(0x9d8c8bc003ef0a79)},
+    {W(0x543f78b6056becfd), W(0x33f13253a090b36d), W(0x82ad4997794432f9),
+     W(0x1386493c4721f502)},
+    0
+  },
+  {
+    {W(0x3794eefa5abea82a), W(0x8dc611b993fe62d4), W(0x69f1af37281ef606),
+     W(0x6af546c839839e69)},
+    {W(0x625578c7c977ec23), W(0xa8de294cbd5c0576), W(0xe2ddaf0f7cd1a4c0),
+     W(0x8243fc704f95f4d4)},
+    0
+  },
+  {
+    {W(0xe566f400b008733a), W(0xcba0697d512e1f57), W(0x9537c2b240509cd0),
+     W(0x5f989c6957353d8c)},
+    {W(0x7dbec9724c3c2b2f), W(0x90e02fa8ff031fa8), W(0xf4d15c53cfd5d11f),
+     W(0xb3404fae48314dfc)},
+    0
+  },
+  {
+    {W(0xa36da109081e9387), W(0xfb9780d78c935828), W(0xd5940332e540b015),
+     W(0xc9d7b51be0f466fa)},
+    {W(0xfaadcd41d6d9f671), W(0xba6c1e28b1a2ac17), W(0x066a7833ed201e5f),
+     W(0x19d99719f90f462b)},
+    0
+  },
+  {
+    {W(0xf02cc3a9f327a07f), W(0xefb27a9b4490937d), W(0x81451e96b1b3afa5),
+     W(0x67e24de891883be4)},
+    {W(0x1ad65d4770869e54), W(0xd36291a464a3856a), W(0x070a1abf7132e880),
+     W(0x9511d0a30e28dfdf)},
+    0
+  },
+  {
+    {W(0xfdeed650f8d1cac4), W(0xeb99194b6d16bda5), W(0xb53b19f71cabbe46),
+     W(0x5f45af5039b9276c)},
+    {W(0xd0784c6126ee9d77), W(0xf7a1558b0c02ca5d), W(0xb61d6c59f032e720),
+     W(0xae3ffb95470cf3f7)},
+    0
+  },
+  {
+    {W(0x9b185facc72a4be5), W(0xf66de2364d848089), W(0xba14d07c717afea9),
+     W(0x25bfbfc02d551c1c)},
+    {W(0x2cef0ecd4cdf3d88), W(0x8cee2aa3647f73c4), W(0xc10a7d3d722d67f7),
+     W(0x090037a294564a21)},
+    0
+  },
+  {
+    {W(0xe6567987fa9ced27), W(0x36b2d8842a9e5dbc), W(0xf4bdeec6380d8e8c),
+     W(0xb5e6a6b0dbc300d0)},
+    {W(0x7ba7e9b9592bef36), W(0x2b373c4fee81b749), W(0x484b5e01f0ce596b),
+     W(0x7cc51c62c0bf54cc)},
+    0
+  },
+  {
+    {W(0x6ac07bb84f3815c4), W(0xddb9f6241aa9017e), W(0x31e30228ca85720a),
+     W(0xe59d63f57cb75838)},
+    {W(0x69e18e777baad2d0), W(0x2cfdb784d42f5d73), W(0x025dd53df5774983),
+     W(0x2f80e7cee042cd52)},
+    0
+  },
+  {
+    {W(0x4bf56bafec695bb0), W(0x22da1ca8f13c78ad), W(0x0f9c4b131182abb0),
+     W(0x02ea555aae7d249e)},
+    {W(0x868583f25e05d9e3), W(0xe09cdcdf70382afa), W(0xdf072ec787080408),
+     W(0x0a317847cbf75658)},
+    0
+  },
+  {
+    {W(0x43f18d7f4d6ee4ab), W(0xd3ac8cde9570c3dc), W(0x527e49070b8c9b2a),
+     W(0x716709a7c5a4c0f1)},
+    {W(0x930852b0916a26b1), W(0x3cc17fcf4e071177), W(0x34f5e3d459694868),
+     W(0xee0341aba28f655d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf431f462060b5f61), W(0xa56f46b47bd057c2), W(0x348dca6c47e1bf65),
+     W(0x9a38783e41bcf1ff)},
+    {W(0x7a5d33a9da710718), W(0x5a7799872e0aeaf6), W(0xca87314d2d29d187),
+     W(0xfa0edc3ec687d733)},
+    0
+  },
+  {
+    {W(0x1c894849cb198ac7), W(0xa884a93d0f264665), W(0x2da964ef9b200678),
+     W(0x3c351b87009834e6)},
+    {W(0xafb2ef9fe2c4b44b), W(0x580f6c473326790c), W(0xb84805210b02264a),
+     W(0x8ba6f9e242a194e2)},
+    0
+  },
+  {
+    {W(0x499b6ab65eb03c0e), W(0xf19b795472bc3fde), W(0xa86b5b9c6e3a80d2),
+     W(0xe43775086d42819f)},
+    {W(0xc1663650bb3ee8a3), W(0x75eb14fcb132075f), W(0xa8ccc9067ad834f6),
+     W(0xea6a2474e6e92ffd)},
+    0
+  },
+  {
+    {W(0x39d934abd3c095f1), W(0x04b261bee4b76d71), W(0x1d2e6970e73e6984),
+     W(0x879fb23b5e5fcb11)},
+    {W(0x11506c72dfd75490), W(0x3a97d08561bcf1c1), W(0x43201d82bf5e7007),
+     W(0x7f0ac52f798232a7)},
+    0
+  },
+  {
+    {W(0xcb4d20ee4b049136), W(0x8b63bf12356a4613), W(0x1221aef670e08128),
+     W(0xe62d8c514acb6b16)},
+    {W(0x71f64a67379e7896), W(0xb25237a2cafd7fa5), W(0xf077bd983841ba6a),
+     W(0xc4ac02443cd16e7e)},
+    0
+  },
+  {
+    {W(0xb25101fb319d7682), W(0xb02931290a982fee), W(0x51c1c9b90261b344),
+     W(0x0e008c5bbfd371fa)},
+    {W(0xd866dd1c0278ca33), W(0x666f76a6e5aa53b1), W(0xe5cfb7796013a2cf),
+     W(0x1d3a1aada3521836)},
+    0
+  },
+  {
+    {W(0x3c5604ff50f75f9c), W(0x1d8eddf37e752b22), W(0x0ef074dd3c9a1118),
+     W(0xd0ffc172ccb86d7b)},
+    {W(0xabd1ece3037d90f2), W(0xe3f307d66055856c), W(0x422f93287e4c6daf),
+     W(0x902aac66334879a0)},
+    0
+  },
+  {
+    {W(0x76b4131a567193ec), W(0xaf3c305ae5f6e70b), W(0x9587bd39031eebdd),
+     W(0x5709def871bbe831)},
+    {W(0x570599830eb2b669), W(0x4d80ce1b875b7029), W(0x838a7da80364ac16),
+     W(0x2f431d23be1c83ab)},
+    0
+  },
+  {
+    {W(0x8e52874cb940c71e), W(0x211935a9db5f4b3a), W(0x94350492301b1dc3),
+     W(0x33d2646d29958620)},
+    {W(0x16b0d64bef911404), W(0x9d1f25ea9a3c5ef4), W(0x20f200eb4a352c78),
+     W(0x43929f2c4bd0b428)},
+    0
+  },
+  {
+    {W(0xe781276638235d4e), W(0x1c62bd67496e3298), W(0x8378660c3f175bc8),
+     W(0x4d04e18917afdd4d)},
+    {W(0x32a8160185a8068c), W(0xdb58e4e192b29a85), W(0xe8a65b86c70d8a3b),
+     W(0x5f0e6f4e98a0403b)},
+    0
+  },
+  {
+    {W(0xd44636e6e82c9f9e), W(0x711db87cc33a1043), W(0x6f431263aa8aec05),
+     W(0x43ff120d2744a4aa)},
+    {W(0xd3bd892fae77779b), W(0xf0fe0cc98cdc9f82), W(0xca5f7fe6f1c5b1bc),
+     W(0xcc63a68244929a72)},
+    0
+  },
+  {
+    {W(0x2c2492b73f894ae0), W(0xf59df3e5b75f18ce), W(0x7cb740d28f53cad0),
+     W(0x3eb585fbc4f01294)},
+    {W(0x17da0c8632c7f717), W(0xeb8c795baf943f4c), W(0x4ee23fb5f67c51d2),
+     W(0xef18757568889949)},
+    0
+  },
+  {
+    {W(0x2834da3eb38dff6f), W(0xbe012c52ea636be8), W(0x292d238c61dd37f8),
+     W(0x0e54523f8f8142db)},
+    {W(0xe31eb436036a05d8), W(0x83e3cdff1e93c0ff), W(0x3fd2fe0f50821ddf),
+     W(0xc8e19b0dff9eb33b)},
+    0
+  },
+  {
+    {W(0x3ea011a4e822f0d0), W(0xbc647ad15a8704f8), W(0xbb315b3550c6820f),
+     W(0x863dec3db7e76bec)},
+    {W(0x01ff5d3af017bfc7), W(0x20054439976b8229), W(0x067fca370bbd0d3b),
+     W(0xf63dde647f5e3d0f)},
+    0
+  },
+  {
+    {W(0x147d90525e9ca895), W(0x2f4dd31e972072df), W(0xa16fda8ee6c6755c),
+     W(0xc66826ffcf196558)},
+    {W(0x1f1a76a30cf43895), W(0xa9d604e083c3097b), W(0xe190830966390e0e),
+     W(0xa50bf753b3c85eff)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x75d9bc15adf7cccf), W(0x81a3e5d6dfa1e1b0), W(0x8c39e444249bc17e),
+     W(0xf37dccb28ea7fd43)},
+    {W(0xda654873907fba12), W(0x35daa6da4a372904), W(0x0564cfc66283a6c5),
+     W(0xd09fa4f64a9395bf)},
+    0
+  },
+  {
+    {W(0x832d7080eb6b242d), W(0xd30bd0233b71e246), W(0x7027991bbe31139d),
+     W(0x68797e91462e4e53)},
+    {W(0x423fe20a6b4e185a), W(0x82f2c67e42d9b707), W(0x25c817684cf7811b),
+     W(0xbd53005e045bb95d)},
+    0
+  },
+  {
+    {W(0xc51aa29e5cfe5c48), W(0x82c020ae815ee096), W(0x7848ad827549a68a),
+     W(0x7933d48960471355)},
+    {W(0x04998d2e67c51e57), W(0x0f64020ad9944afc), W(0x7a299fe1a7fadac6),
+     W(0x40c73ff45aefe92c)},
+    0
+  },
+  {
+    {W(0xe5f649be9d8e68fd), W(0xdb0f05331b044320), W(0xf6fde9b3e0c33398),
+     W(0x92f4209b66c8cfae)},
+    {W(0xe9d1afcc1a739d4b), W(0x09aea75fa28ab8de), W(0x14375fb5eac6f1d0),
+     W(0x6420b560708f7aa5)},
+    0
+  },
+  {
+    {W(0xbf44ffc75488771a), W(0xcb76e3f17f2f2191), W(0x4197bde394f86a42),
+     W(0x45c25bb970641d9a)},
+    {W(0xd8a29e31f88ce6dc), W(0xbe2becfd4bb7ac7d), W(0x13094214b5670cc7),
+     W(0xe90a8fd560af8433)},
+    0
+  },
+  {
+    {W(0x2d1afd5696f37750), W(0x25dda55791507ff2), W(0x2b95fd4c006543ed),
+     W(0xf3c778d9a23c3911)},
+    {W(0x84ccf4463b04938d), W(0x3d9dded67eef947b), W(0xbed83735dae325b5),
+     W(0x5ba0f75cf921455d)},
+    0
+  },
+  {
+    {W(0x0ecf9b8b4ebd3f02), W(0xa47acd9d86b770ea), W(0x93b84a6a2da213ce),
+     W(0xd760871b53e7c8cf)},
+    {W(0x7a5f58e536e530d7), W(0x7abc52a51912ad51), W(0x7ad43db02ea0252a),
+     W(0x498b00ecc176b742)},
+    0
+  },
+  {
+    {W(0x9eae499c6254dc41), W(0x7e2939247a837e7e), W(0x74aec08c090524a7),
+     W(0xf82b92198d6f55f2)},
+    {W(0x493c962e1402cec5), W(0x9f17ca17fa2f30e7), W(0xbcd783e8e9b879cb),
+     W(0xea3d8c145a6f145f)},
+    0
+  },
+  {
+    {W(0x9ff713ef888ae17f), W(0x6007f68fb34b7beb), W(0x5d2b18983b653d64),
+     W(0xcbf73e91d3ca4b1b)},
+    {W(0x4b050ad56cdfb3a1), W(0x41bd3ec3d1f833a4), W(0x78d7e2ee719d7bf5),
+     W(0xea4604672a27412e)},
+    0
+  },
+  {
+    {W(0x7dad6d1b42cd7900), W(0xb6e6b439e058f8a4), W(0x8836f1e662aa3bbc),
+     W(0xd45bf2c811142b0a)},
+    {W(0xae324bac3c045ed1), W(0x372be24d270a8333), W(0xeeda7a3a6b7c73b6),
+     W(0xf6675402db49562a)},
+    0
+  },
+  {
+    {W(0xc312ba68441e760d), W(0x84d0d061a50e512e), W(0xfe764f4e4bbdd849),
+     W(0xa924adcf9dadd5c0)},
+    {W(0x08685961debfe976), W(0xd3d846c529fba601), W(0x43bf8227dc3f4040),
+     W(0x05e767b8a49e9ff5)},
+    0
+  },
+  {
+    {W(0xdede15e75e0dee6e), W(0x74f24872dc628aa2), W(0xd3e9c4fe7861bb93),
+     W(0x56d4822a6187b2e0)},
+    {W(0xb66417cfc59826f9), W(0xca2609692408169e), W(0xedf69d06c79ef885),
+     W(0x00031f8adc7d138f)},
+    0
+  },
+  {
+    {W(0xc4689c309953e453), W(0x5e355a2e1712dca5), W(0x1ff83c81f1cd96f7),
+     W(0xb06b89fb44cf56db)},
+    {W(0x1827705365f16e0d), W(0x6403b91de5618672), W(0xba3f9475be384bc6),
+     W(0x7f691cbe303ce5f3)},
+    0
+  },
+  {
+    {W(0x63d3c6423fe56a64), W(0x6ddc7f8d1d8d3d3c), W(0x6ee5220ccc596442),
+     W(0xd1156a7334d8df26)},
+    {W(0xd8836fd52fab094c), W(0x996fad033a349c2d), W(0xdd8802e9c7887878),
+     W(0x64e797d211baed91)},
+    0
+  },
+  {
+    {W(0x4589ba03210f4045), W(0xd5e7366301e8012a), W(0x1c26052d74462ffa),
+     W(0xe78f600c4f989519)},
+    {W(0xc63ca0c97cee0b2f), W(0xbe588573af760b5f), W(0x05906fc4593773cd),
+     W(0xd5970fb0e322d5af)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x103c46e60ebcf726), W(0x4482b8316231470e), W(0x6f6dfaca487c2109),
+     W(0x2e0ace9762e666ef)},
+    {W(0x3246a9d31f8d1f42), W(0x1b1e83f1574944d2), W(0x13dfa63aa57f334b),
+     W(0x0cf8daed9f025d81)},
+    0
+  },
+  {
+    {W(0x85de1f0d1e935abb), W(0xdefd10b4154de37a), W(0xb8d9e392369cebb5),
+     W(0x54d5ef9b761324be)},
+    {W(0x4d6341ba74f17e26), W(0xc0a0e3c878c1dde4), W(0xa6d7758187d918fd),
+     W(0x6687601502ca3a13)},
+    0
+  },
+  {
+    {W(0xbc19180c207674f1), W(0x112e09a733ae8fdb), W(0x996675546aaeb71e),
+     W(0x79432af1e101b1c7)},
+    {W(0xd5eb558fde2ddec6), W(0x81392d1f5357753f), W(0xa7a76b973ae1158a),
+     W(0x416fbbff4a899991)},
+    0
+  },
+  {
+    {W(0xee7332c7904fc3fa), W(0x14a23f45c7e3636a), W(0xc38659c3f091d9aa),
+     W(0x4a995e5db12d8540)},
+    {W(0x20a53becf3a5598a), W(0x56534b17b1eaa995), W(0x9ed3dca4bf04e03c),
+     W(0x716c563ad8d56268)},
+    0
+  },
+  {
+    {W(0x6d956e892f3b26e7), W(0xf4709860da875247), W(0x3ad151792482dda3),
+     W(0xd64110e3017d82f0)},
+    {W(0x14928d2cfad414e4), W(0x2b155f582ed02b24), W(0x481a141bcb821bf1),
+     W(0x12e3c7704f81f5da)},
+    0
+  },
+  {
+    {W(0xdd5944ea308780f2), W(0xdc8de7613845f5e4), W(0x6beaba7d7624d7a3),
+     W(0x1e709afd304df11e)},
+    {W(0x9536437602170456), W(0xbf204b3ac8f94b64), W(0x4e53af7c5680ca68),
+     W(0x0526074ae0c67574)},
+    0
+  },
+  {
+    {W(0xe29fa63e7882f14f), W(0xc9f6dc3507c6cadc), W(0x46f22d6fb882bed0),
+     W(0x1a45755bd118e52c)},
+    {W(0x9f2c7c277c4608cf), W(0x7ccbdf32568012c2), W(0xfcb0aedd61729b0e),
+     W(0x7ca2ca9ef7d75dbf)},
+    0
+  },
+  {
+    {W(0x5043dea7e0f222c2), W(0x309d42ac72e65142), W(0x94fe9ddd9216cd30),
+     W(0xd6539c7d0f87feec)},
+    {W(0x03c5a57c432ac7d7), W(0x72692cf0327fda10), W(0xec28c85f280698de),
+     W(0x2331fb467ec283b1)},
+    0
+  },
+  {
+    {W(0x88b34414c53352e7), W(0x5a34889c1337d46e), W(0x612c1560f95f2bc8),
+     W(0x8a3f8441d4807a3a)},
+    {W(0x680d9e975224da68), W(0x60cd6e88c3eb00e9), W(0x3875a98e9a6bc375),
+     W(0xdc80f9244fd554c2)},
+    0
+  },
+  {
+    {W(0x37461955c298b974), W(0x905fb5f0f8711e04), W(0x787abf3afe969d18),
+     W(0x392167c26f6a494e)},
+    {W(0xfc7a0d2d28c511da), W(0xf127c7dcb66a262d), W(0xf9c4bb95fd63fdf0),
+     W(0x900165893913ef46)},
+    0
+  },
+  {
+    {W(0x30495ba3e2a9a6db), W(0x4601303d58f9268b), W(0xbe3b0dad7eb0f04f),
+     W(0x4ea472504456936d)},
+    {W(0x8caf8798d33fd3e7), W(0x1ccd8a89eb433708), W(0x9effe3e887fd50ad),
+     W(0xbe240a566b29c4df)},
+    0
+  },
+  {
+    {W(0xae80b91364d9c2f4), W(0x7468bac3a010a8ff), W(0xdfd2003737359d41),
+     W(0x1a0f5ab815efeacc)},
+    {W(0x7c25ad2f659d0ce0), W(0x4011bcbb6785cff1), W(0x128b99127e2192c7),
+     W(0xa549d8e113ccb0e8)},
+    0
+  },
+  {
+    {W(0x84bfcf5343ad73b3), W(0x1b528c204f035a94), W(0x4294edf733eeac69),
+     W(0xb6283e83817f3240)},
+    {W(0xc3fdc9590a5f25b1), W(0xefaf8aa55844ee22), W(0xde269ba5dbdde4de),
+     W(0xe3347160c56133bf)},
+    0
+  },
+  {
+    {W(0x9076a70c0e367a98), W(0xbea1bc150f62b7c2), W(0x2645a68c30fe0343),
+     W(0xacaffa78699dc14f)},
+    {W(0xf4469964457bf9c4), W(0x0db6407b0d2ead83), W(0x68d56cadb2c6f3eb),
+     W(0x3b512e73f376356c)},
+    0
+  },
+  {
+    {W(0x7c8386432fe3cd4c), W(0xe0f33acbb4bc633c), W(0xb4a9ecec3d139f1f),
+     W(0x05ce69cddc4a1f49)},
+    {W(0xa19d1b16f5f98aaf), W(0x45bb71d66f23e0ef), W(0x33789fcd46cdfdd3),
+     W(0x9b8e2978cee040ca)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa0158eeae457a477), W(0xd19857dbee6ddc05), W(0xb326522418c41671),
+     W(0x3ffdfc7e3c2c0d58)},
+    {W(0x3a3a525426ee7cda), W(0x341b0869df02c3a8), W(0xa023bf42723bbfc8),
+     W(0x3d15002a14452691)},
+    0
+  },
+  {
+    {W(0x5ef7324c85edfa30), W(0x2597655487d4f3da), W(0x352f5bc0dcb50c86),
+     W(0x8f6927b04832a96c)},
+    {W(0xd08ee1ba55f2f94c), W(0x6a996f99344b45fa), W(0xe133cb8da8aa455d),
+     W(0x5d0721ec758dc1f7)},
+    0
+  },
+  {
+    {W(0xf3cae7e9262a3539), W(0x78a49d1d6670d59e), W(0x37de0f63c1c5e1b9),
+     W(0x3072c30c69cb7c1c)},
+    {W(0x1d278a5277c850e6), W(0x84f15f8f1f6a3de6), W(0x46a8bb45592ca7ad),
+     W(0x1912e3eee4d424b8)},
+    0
+  },
+  {
+    {W(0x6ba7a92079e5fb67), W(0xe1331feb70aa725e), W(0x5080ccf57df5d837),
+     W(0xe4cae01d7ff72e21)},
+    {W(0xd9243ee60412a77d), W(0x06ff7cacdf449025), W(0xbe75f7cd23ef5a31),
+     W(0xbc9578220ddef7a8)},
+    0
+  },
+  {
+    {W(0xdc988086365e668b), W(0xada8dcdaaabda5fb), W(0xbc146b4c255f1fbe),
+     W(0x9cfcde29cf34cfc3)},
+    {W(0xacbb453e7e85d1e4), W(0x9ca09679f92358b5), W(0x15fc2d96240823ff),
+     W(0x8d65adf70c11d11e)},
+    0
+  },
+  {
+    {W(0x8cf7230cb0ce1c55), W(0x5b534d050bbfb607), W(0xee1ef1130e16363b),
+     W(0x27e0aa7ab4999e82)},
+    {W(0xce1dac2d79362c41), W(0x67920c9091bb6cb0), W(0x1e648d632223df24),
+     W(0x0f7d9eefe32e8f28)},
+    0
+  },
+  {
+    {W(0x775557f10296f4fd), W(0x1dca76a3ea51b436), W(0xf3e98f60fb950805),
+     W(0x31ff32ea831cf7f1)},
+    {W(0x643e7bf18d2c714b), W(0x64b5c3392e9d2aca), W(0xa9fd9ccc6adc2d23),
+     W(0xfc2397eccc721b9b)},
+    0
+  },
+  {
+    {W(0x6943f39afa833834), W(0x22951722a6328562), W(0x81d63dd54170fc10),
+     W(0x9f5fa58faecc2e6d)},
+    {W(0xb66c8725e77d9a3b), W(0x11235cea6384ebe0), W(0x06a8c1185845e24a),
+     W(0x0137b286ebd093b1)},
+    0
+  },
+  {
+    {W(0xf031182db48ec57d), W(0x515d32f804b233b9), W(0x06bbb1d4093aad26),
+     W(0x88a142fe0d83d1ec)},
+    {W(0x3b95c099245c73f8), W(0xb126d4af52edcd32), W(0xf8022c1e8fcb52e6),
+     W(0x5a51ac4c0106d339)},
+    0
+  },
+  {
+    {W(0xc589e1ce44ace150), W(0xe0f8d3d94381e97c), W(0x59e99b1162c5a4b8),
+     W(0x90d262f7fd0ec9f9)},
+    {W(0xfbc854c9283e13c9), W(0x2d04fde7aedc7085), W(0x057d776547dcbecb),
+     W(0x8dbdf5919a76fa5f)},
+    0
+  },
+  {
+    {W(0xb7f70a1a7c64a054), W(0x0dc1c0df9db43e79), W(0x6d0a4ae251fe63d6),
+     W(0xe0d5e3327f0c8abf)},
+    {W(0xff5500362b7ecee8), W(0x3ea0e6f75d055008), W(0x30deb62ff24ac84f),
+     W(0x936969fd5d7116b7)},
+    0
+  },
+  {
+    {W(0xd01506950de1e578), W(0x2e1463e7e9f72bc6), W(0xffa684411b39eca5),
+     W(0x673c85307c037f2f)},
+    {W(0xd0d6a600747f91da), W(0xb08d43e1c9cb78e9), W(0x0fc0c64427b5cef5),
+     W(0x5c1d160aa60a2fd6)},
+    0
+  },
+  {
+    {W(0x02da76122617cf7f), W(0xd6e25d4eeee35260), W(0xb2fa5b0afd3533e9),
+     W(0xe76bb7b0b9126f88)},
+    {W(0x692e6a9988856866), W(0x3fdf394f49db65ca), W(0x2529699122d8d606),
+     W(0xe815bfbf3dd7c4cf)},
+    0
+  },
+  {
+    {W(0xf98cae5328c8e13b), W(0x375f10c4b2eddcd1), W(0xd4eb8b7f5cce06ad),
+     W(0xb4669f4580a2e1ef)},
+    {W(0xd593f9d05bbd8699), W(0x5528a4c9e7976d13), W(0x3923e0951c7e28d3),
+     W(0xb92937903f6bb577)},
+    0
+  },
+  {
+    {W(0x69c984ed4d844e7f), W(0xd354b2174a2e8a82), W(0x25bd4addfb2c4136),
+     W(0xf72df4de144b26e1)},
+    {W(0xd0aa9db0e6101afd), W(0x4445efaae49bd1b8), W(0x5dc54eee331593b2),
+     W(0xfa35e3b9094bf10b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xdb567d6ac42bd6d2), W(0x6df86468bb1f96ae), W(0x0efe5b1a4843b28e),
+     W(0x961bbb056379b240)},
+    {W(0xb6caf5f070a6a26b), W(0x70686c0d328e6e39), W(0x80da06cf895fc8d3),
+     W(0x804d8810b363fdc9)},
+    0
+  },
+  {
+    {W(0x63b99ce74462007d), W(0xb8ab48a54cb5f5b7), W(0x9ec673d2f55edde7),
+     W(0xd1567f748cfaefda)},
+    {W(0x46381b6b0887bcec), W(0x694497cee178f3c2), W(0x5e6525e31e6266cb),
+     W(0x5931de26697d6413)},
+    0
+  },
+  {
+    {W(0x14e49da11f17a34c), W(0x5420ab39235a1456), W(0xb76372412f50363b),
+     W(0x7b15d623c3fabb6e)},
+    {W(0xa0ef40b1e274e49c), W(0x5cf5074496b1860a), W(0xd6583fbf66afe5a4),
+     W(0x44240510f47e3e9a)},
+    0
+  },
+  {
+    {W(0x142b55021a93507a), W(0xb4cd11878d3c06cf), W(0xdf70e76a91ec3f40),
+     W(0x484e81ad4e7553c2)},
+    {W(0x830f87b5272e9d6e), W(0xea1c93e5c6ff514a), W(0x67cc2adcc4192a8e),
+     W(0xc77e27e242f4535a)},
+    0
+  },
+  {
+    {W(0xb5358b1e48ac2840), W(0x18311294ecba9477), W(0xda58f990a6946b43),
+     W(0x3098baf99ab41819)},
+    {W(0x66c4c1584198da52), W(0xab4fc17c146bfd1b), W(0x2f0a4c3cbf36a908),
+     W(0x2ae9e34b58cf7838)},
+    0
+  },
+  {
+    {W(0x45eb40ec0ccced58), W(0x25cd4b9c0da44f98), W(0x43e06458871812c6),
+     W(0x99f80d5516cef651)},
+    {W(0x571340c9ce6dc153), W(0x138d5117d8665521), W(0xacdb45bc4e07014d),
+     W(0x2f34bb3884b60b91)},
+    0
+  },
+  {
+    {W(0x417499e84a34f239), W(0x15fdb83cb90402d5), W(0xb75f46bf433aa832),
+     W(0xb61e15af63215db1)},
+    {W(0xaabe59d4a127f89a), W(0x5d541e0c07e816da), W(0xaaba0659a618b692),
+     W(0x5532773317266026)},
+    0
+  },
+  {
+    {W(0x8cda9cf2d0c05199), W(0x502fbc22fae78454), W(0xc0bda9dff572a182),
+     W(0x5f9b71b86158b372)},
+    {W(0xe0f33a592b82dd07), W(0x763027359523032e), W(0x7fe1a721c4505a32),
+     W(0x7b6e3e82f796409f)},
+    0
+  },
+  {
+    {W(0x023c155d3f6effc7), W(0x1fbd69ff9c90f0c7), W(0xe5d7da8abeec2c5d),
+     W(0x8813872bd7e86273)},
+    {W(0x9f3bc2c655f5e228), W(0x11482869b0923b41), W(0x65d75c741aa307ca),
+     W(0xda92c2577f24eee5)},
+    0
+  },
+  {
+    {W(0x26357732edc665d1), W(0x9fb5b731a939ef1b), W(0x7db720fb94968089),
+     W(0x36f75f2c33138c52)},
+    {W(0xf8b793ec48d3cb97), W(0x8dff1d456d261726), W(0xfb65791b885c4ffb),
+     W(0xf7c79e2df1a3a870)},
+    0
+  },
+  {
+    {W(0x08dd1028754c92e1), W(0xca90b57acf0fef34), W(0x1a9b84ac8af55919),
+     W(0xaa95e0e1ed93686b)},
+    {W(0x46737315167021a4), W(0x6cb6a0da20d5ff98), W(0xecc4801a1092e706),
+     W(0xedcab23a3c5e61a6)},
+    0
+  },
+  {
+    {W(0xb4c66356ea37ba9e), W(0x1adc84150afff55d), W(0xf0080ef9596cc862),
+     W(0x756c85b86d647ab6)},
+    {W(0xc9db94aa1db9c215), W(0x2dd36db12013b1a5), W(0xde6ac61c4286c903),
+     W(0x3fd32f88c76cf884)},
+    0
+  },
+  {
+    {W(0x7f1290fca06d107e), W(0x697261fdb7661137), W(0x1bb5be4e947b4b38),
+     W(0xb49826b63bb79130)},
+    {W(0x019ddfe85ba8bffb), W(0xb1af79007e3fa8e4), W(0x72e1bdf201bcfe7f),
+     W(0x2ed3ca8fd1169aea)},
+    0
+  },
+  {
+    {W(0x3befda8cd745fff1), W(0x70b9e9b669b9924e), W(0xa5df48cfd1511381),
+     W(0x84f93fe2d06bc535)},
+    {W(0xaa42c5a9b279a6c3), W(0x651da6c4d8f96132), W(0xb0368c8b01b6aea5),
+     W(0x64e44c47ac7862a2)},
+    0
+  },
+  {
+    {W(0xe17a9947d9de99a8), W(0xc2e61b2dc93477bd), W(0x57f684d41d19e287),
+     W(0x843c2122fe358135)},
+    {W(0xe2d3e2e904f7e8ab), W(0xbf93ffe9b5f27aee), W(0x29830d1d7b1858c4),
+     W(0xa8f449648106adbf)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe3417bc035d0b34a), W(0x440b386b8327c0a7), W(0x8fb7262dac0362d1),
+     W(0x2c41114ce0cdf943)},
+    {W(0x2ba5cef1ad95a0b1), W(0xc09b37a867d54362), W(0x26d6cdd201e486c9),
+     W(0x20477abf42ff9297)},
+    0
+  },
+  {
+    {W(0xa004dcb3292a9287), W(0xddc15cf677b092c7), W(0x083a8464806c0605),
+     W(0x4a68df703db997b0)},
+    {W(0x9c134e4505bf7dd0), W(0xa4e63d398ccf7f8c), W(0xa6e6517f41b5f8af),
+     W(0xaa8b9342ad7bc1cc)},
+    0
+  },
+  {
+    {W(0x126f35b51e706ad9), W(0xb99cebb4c3a9ebdf), W(0xa75389afbf608d90),
+     W(0x76113c4fc6c89858)},
+    {W(0x80de8eb097e2b5aa), W(0x7e1022cc63b91304), W(0x3bdab6056ccc066c),
+     W(0x33cbb144b2edf900)},
+    0
+  },
+  {
+    {W(0xc41764717af715d2), W(0xe2f7f594d0134a96), W(0x2c1873efa41ec956),
+     W(0xe4e7b4f677821304)},
+    {W(0xe5c8ff9788d5374a), W(0x2b915e6380823d5b), W(0xea6bc755b2ee8fe2),
+     W(0x6657624ce7112651)},
+    0
+  },
+  {
+    {W(0x157af101dace5aca), W(0xc4fdbcf211a6a267), W(0xdaddf340c49c8609),
+     W(0x97e49f52e9604a65)},
+    {W(0x9be8e790937e2ad5), W(0x846e2508326e17f1), W(0x3f38007a0bbbc0dc),
+     W(0xcf03603fb11e16d6)},
+    0
+  },
+  {
+    {W(0xd6f800e07442f1d5), W(0x475607d166e0e3ab), W(0x82807f16b7c64047),
+     W(0x8858e1e3a749883d)},
+    {W(0x5859120b8231ee10), W(0x1b80e7eb638a1ece), W(0xcb72525ac6aa73a4),
+     W(0xa7cdea3d844423ac)},
+    0
+  },
+  {
+    {W(0x5ed0c007f8ae7c38), W(0x6db07a5c3d740192), W(0xbe5e9c2a5fe36db3),
+     W(0xd5b9d57a76e95046)},
+    {W(0x54ac32e78eba20f2), W(0xef11ca8f71b9a352), W(0x305e373eff98a658),
+     W(0xffe5a100823eb667)},
+    0
+  },
+  {
+    {W(0x57477b11e51732d2), W(0xdfd6eb282538fc0e), W(0x5c43b0cc3b39eec5),
+     W(0x6af12778cb36cc57)},
+    {W(0x70b0852d06c425ae), W(0x6df92f8c5c221b9b), W(0x6c8d4f9ece826d9c),
+     W(0xf59aba7bb49359c3)},
+    0
+  },
+  {
+    {W(0x5c8ed8d5da64309d), W(0x61a6de5691b30704), W(0xd6b52f6a2f9b5808),
+     W(0x0eee419498c958a7)},
+    {W(0xcddd9aab771e4caa), W(0x83965dfd78bc21be), W(0x02affce3b3b504f5),
+     W(0x30847a21561c8291)},
+    0
+  },
+  {
+    {W(0xd2eb2cf152bfda05), W(0xe0e4c4e96197b98c), W(0x1d35076cf8a1726f),
+     W(0x6c06085b2db11e3d)},
+    {W(0x15c0c4d74463ba14), W(0x9d292f830030238c), W(0x1311ee8b3727536d),
+     W(0xfeea86efbeaedc1e)},
+    0
+  },
+  {
+    {W(0xb9d18cd366131e2e), W(0xf31d974f80fe2682), W(0xb6e49e0fe4160289),
+     W(0x7c48ec0b08e92799)},
+    {W(0x818111d8d1989aa7), W(0xb34fa0aaebf926f9), W(0xdb5fe2f5a245474a),
+     W(0xf80a6ebb3c7ca756)},
+    0
+  },
+  {
+    {W(0xa7f96054afa05dd8), W(0x26dfcf21fcaf119e), W(0xe20ef2e30564bb59),
+     W(0xef4dca5061cb02b8)},
+    {W(0xcda7838a65d30672), W(0x8b08d534fd657e86), W(0x4c5b439546d595c8),
+     W(0x39b58725425cb836)},
+    0
+  },
+  {
+    {W(0x8ea610593de9abe3), W(0x404348819cdc03be), W(0x9b261245cfedce8c),
+     W(0x78c318b4cf5234a1)},
+    {W(0x510bcf16fde24c99), W(0x2a77cb75a2c2ff5d), W(0x9c895c2b27960fb4),
+     W(0xd30ce975b0eda42b)},
+    0
+  },
+  {
+    {W(0xfda853931a62cc26), W(0x23c69b9650c0e052), W(0xa227df15bfc633f3),
+     W(0x2ac788481bae7d48)},
+    {W(0x487878f9187d073d), W(0x6c2be919967f807d), W(0x765861d8336e6d8f),
+     W(0x88b8974cce528a43)},
+    0
+  },
+  {
+    {W(0x09521177ff57d051), W(0x2ff38037fb6a1961), W(0xfc0aba74a3d76ad4),
+     W(0x7c76480325a7ec17)},
+    {W(0x7532d75f48879bc8), W(0xea7eacc058ce6bc1), W(0xc82176b48e896c16),
+     W(0x9a30e0b22c750fed)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc37e2c2e421d3aa4), W(0xf926407ce84fa840), W(0x18abc03d1454e41c),
+     W(0x26605ecd3f7af644)},
+    {W(0x242341a6d6a5eabf), W(0x1edb84f4216b668e), W(0xd836edb804010102),
+     W(0x5b337ce7945e1d8c)},
+    0
+  },
+  {
+    {W(0x4c076b86d23ddc82), W(0x03fd344c7e0143f0), W(0xa95362ff317af2c5),
+     W(0x0add3db7e18b7a4f)},
+    {W(0x9c673e3f8260e01b), W(0xfbeb49e554a1cc91), W(0x91351bf292f2e433),
+     W(0xc755e7ec851141eb)},
+    0
+  },
+  {
+    {W(0x349ae368da9f3804), W(0x470f07fea164349c), W(0xd52f4cc98562baa5),
+     W(0xc74a9e862b290df3)},
+    {W(0xd3a1aa3543471a24), W(0x239446beb8194511), W(0xbec2dd0081dcd44d),
+     W(0xca3d7f0fc42ac82d)},
+    0
+  },
+  {
+    {W(0x2bf5db47f23206d5), W(0x2f6d34201d260152), W(0x17b876533f8ff89a),
+     W(0x5157c30c378fa458)},
+    {W(0x7517c5c52d4fb936), W(0xef22f7ace6518cdc), W(0xdeb483e6bf847a64),
+     W(0xf508455892e0fa89)},
+    0
+  },
+  {
+    {W(0xb418c2a69b583160), W(0xbe74fcd4b4e59194), W(0xf178eeaa3c83e3ff),
+     W(0xe051f895e296f29b)},
+    {W(0xd023523806ceb84a), W(0x5ace48cee111fe6b), W(0x40e43a491c045545),
+     W(0xf3fa86dddd522146)},
+    0
+  },
+  {
+    {W(0x959616fa908ec5b5), W(0x882d661da01ab12d), W(0xc49f60824382ae8a),
+     W(0x5cdf92eb5d133f5e)},
+    {W(0x98cecc425ef6c9c1), W(0xb52d6682664d84ee), W(0x9e285ed86f25b8c4),
+     W(0xeb80cdc748debe88)},
+    0
+  },
+  {
+    {W(0x2d9794c1ec222ba0), W(0xc3dff42f523e5d48), W(0x4a7cd5700fe4846b),
+     W(0xefc5b113ff135174)},
+    {W(0x2630b25bc6b05e85), W(0x0a6d3029654cd077), W(0xb4f1f54f32d8b89d),
+     W(0xde3baff21627fc27)},
+    0
+  },
+  {
+    {W(0xab9659d8df7304d4), W(0xb71bcf1bff210e8e), W(0xa9a2438bd73fbd60),
+     W(0x4595cd1f5d11b4de)},
+    {W(0x9c0d329a4835859d), W(0x4a0f0d2d7dbb6e56), W(0xc6038e5edf928a4e),
+     W(0xc94296218f5ad154)},
+    0
+  },
+  {
+    {W(0xb883b83ba4a2df3e), W(0x045b7cc244e5a363), W(0xa42bd7734e0d96de),
+     W(0xb92575478d93c165)},
+    {W(0xe8f9012673c8138e), W(0x5a8ee74d607d84bf), W(0x1becbb5049ea4363),
+     W(0x1d4b61145ada3286)},
+    0
+  },
+  {
+    {W(0xebb678b5aa093b15), W(0x0eacdf44d3e2b40c), W(0xbc4223c42089199f),
+     W(0x0e252bb4490a06a4)},
+    {W(0x1e6479b5cc2c5df7), W(0x8b6922d2ba94328a), W(0x4278cce7218b948c),
+     W(0x947e995ce6064f39)},
+    0
+  },
+  {
+    {W(0xcdf32d65f1d96994), W(0x8bb3d8f3b75b2b18), W(0x5a95d2a3cb307798),
+     W(0xdf8629cccb15a8b5)},
+    {W(0x375bdcbe548c4926), W(0x94ad58c63c25b3a6), W(0xe94e0d528fac4888),
+     W(0x9cbe774669ba5be3)},
+    0
+  },
+  {
+    {W(0x08a33840a70c6ec4), W(0x9e8819f7e0311195), W(0xed209d96708ab202),
+     W(0x10d7c4e7ce943a27)},
+    {W(0x372fb317a29b49a1), W(0x57a67fb346627d1f), W(0xf912561e7cdf39ec),
+     W(0xfa3ce6f26f7c8f17)},
+    0
+  },
+  {
+    {W(0x04c16de7782fedc1), W(0xfee2c11a093ae7c4), W(0x357a7d853dde90b1),
+     W(0x68136af2ce6923dc)},
+    {W(0x0aaa9b448e864536), W(0x16b53452feaa1c2f), W(0xe8f494d15946d955),
+     W(0xb53116513b1569e3)},
+    0
+  },
+  {
+    {W(0xddebfd7dbe51e3e7), W(0x0b25fc407f026831), W(0x4f3bad3bace45fd1),
+     W(0x8cb332ba706809a7)},
+    {W(0x40e160b1d6b93fca), W(0x85368edf8b28bded), W(0x266f0a8c90b4c2fd),
+     W(0xaad987f6ffaad24f)},
+    0
+  },
+  {
+    {W(0x9f310d424e1b623b), W(0xf045749b816266a5), W(0x944fd751a0db7827),
+     W(0x80120da6681d7259)},
+    {W(0x00cdd20d31a9c588), W(0x7bf2abd397ae4bf1), W(0xf75a22906b08c06a),
+     W(0x0fa3e5844a12dc8b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x91213462f23f2d92), W(0x6cab71bd60b94078), W(0x6bdd0a63176cde20),
+     W(0x54c9b20cee4d54bc)},
+    {W(0x3cd2d8aa9f2ac02f), W(0x03f8e617206eedb0), W(0xc7f68e1693086434),
+     W(0x831469c592dd3db9)},
+    0
+  },
+  {
+    {W(0x7aa7a1583ae9c1bd), W(0xe0af6d98e37ce240), W(0xe54342d928ab38b4),
+     W(0xe8b750070a1c98ca)},
+    {W(0xefce86afe02358f2), W(0x31b8b856ea921228), W(0x052a19120a1c67fc),
+     W(0xb4069ea4e3aead59)},
+    0
+  },
+  {
+    {W(0x4a9090cde36d0757), W(0xf722d7b1d9a29382), W(0xfb7fb04c04b48ddf),
+     W(0x628ad2a7ebe16f43)},
+    {W(0xcd3fbfb520226040), W(0x6c34ecb15104b6c4), W(0x30c0754ec903c188),
+     W(0xec336b082d23cab0)},
+    0
+  },
+  {
+    {W(0x9f51439e558df019), W(0x230da4baac712b27), W(0x518919e355185a24),
+     W(0x4dcefcdd84b78f50)},
+    {W(0xa7d90fb2a47d4c5a), W(0x55ac9abfb30e009e), W(0xfd2fc35974eed273),
+     W(0xb72d824cdbea8faf)},
+    0
+  },
+  {
+    {W(0xd213f923cbb13d1b), W(0x98799f425bfb9bfe), W(0x1ae8ddc9701144a9),
+     W(0x0b8b3bb64c5595ee)},
+    {W(0x0ea9ef2e3ecebb21), W(0x17cb6c4b3671f9a7), W(0x47ef464f726f1d1f),
+     W(0x171b94846943a276)},
+    0
+  },
+  {
+    {W(0x779b8552de7e5c19), W(0xfab28609c1c0256c), W(0x64f58eeeabd4743d),
+     W(0x4e8ef8387b6cc93b)},
+    {W(0xee650d264cb1bf3d), W(0x4c1f9d0973dedf61), W(0xaef7c9d7bfb70ced),
+     W(0x1ec0507e1641de1e)},
+    0
+  },
+  {
+    {W(0xc9941109a607419d), W(0xfaa71e62bb6bca80), W(0x34158c1307c431f3),
+     W(0x594abebc992bc47a)},
+    {W(0x6dfea691eb78399f), W(0x48aafb353f42cba4), W(0xedcd65af077c04f0),
+     W(0x1a29a366e884491a)},
+    0
+  },
+  {
+    {W(0x549db2b5ef7d9289), W(0x2480d4a8197f015a), W(0x61d5590bc40493b6),
+     W(0x3a55b52e6f780331)},
+    {W(0x40eb8115309eadb0), W(0xdea7de5a92e5c625), W(0x64d631f0cc6a3d5a),
+     W(0x9d5e9d7c93e8dd61)},
+    0
+  },
+  {
+    {W(0x7bf6a5c1f7ea25aa), W(0xd165e6bffbb07d5f), W(0xe353936189e78671),
+     W(0xa3fcac892bac4219)},
+    {W(0xdfab6fd4f0baa8ab), W(0x5a4adac1e2c1c2e5), W(0x6cd75e3140d85849),
+     W(0xce263fea19b39181)},
+    0
+  },
+  {
+    {W(0xb8d804a3315980cd), W(0x693bc492fa3bebf7), W(0x3578aeee2253c504),
+     W(0x158de498cd2474a2)},
+    {W(0x1331f5c7cfda8368), W(0xd2d7bbb378d7177e), W(0xdf61133af3c1e46e),
+     W(0x5836ce7dd30e7be8)},
+    0
+  },
+  {
+    {W(0xe042ece59a29a5c5), W(0xb19b3c073b6c8402), W(0xc97667c719d92684),
+     W(0xb5624622ebc66372)},
+    {W(0x0cb96e653c04fa02), W(0x83a7176c8eaa39aa), W(0x2033561deaa1633f),
+     W(0x45a9d0864533df73)},
+    0
+  },
+  {
+    {W(0x1b7a588d04c82bdd), W(0x68005534f8319dfd), W(0xde8a55b5d8eb9580),
+     W(0x5ea886da8d5bca81)},
+    {W(0xe8530a01252a0b4d), W(0x1bffb4fe35eaa0a1), W(0x2ad828b1d8e99563),
+     W(0x7de96ef595f9cd87)},
+    0
+  },
+  {
+    {W(0xa29ae9df5ece6e7c), W(0x0603ac8f0facfb55), W(0xcfe85b7adda233a5),
+     W(0xe618919fbd75f0b8)},
+    {W(0xf555a3d299bf1603), W(0x1f43afc9f184255a), W(0xdcdaf341319a3e02),
+     W(0xd3b117ef03903a39)},
+    0
+  },
+  {
+    {W(0xd983cf8d20f8a242), W(0x7aff5b1df22e1ad8), W(0x68fd11d07fc4feb3),
+     W(0x5d53ae90b0f1c3e1)},
+    {W(0x50fb7905ec041803), W(0x85e3c97714404888), W(0x0e67faedac628d8f),
+     W(0x2e8651506668532c)},
+    0
+  },
+  {
+    {W(0xb6b82fa74d82f4c2), W(0x90725a606804efb3), W(0xbc82ec46adc3425e),
+     W(0xb7b805812787843e)},
+    {W(0xdf46d91cdd1fc74c), W(0xdc1c62cbe783a6c4), W(0x59d1b9f31a04cbba),
+     W(0xd87f6f7295e40764)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x196860411e84e0e5), W(0xa5db84d3aea34c93), W(0xf9d5bb197073a732),
+     W(0xb8d2fe566bcfd7c0)},
+    {W(0x45775f36f3eb82fa), W(0x8cb20cccfdff8b58), W(0x1659b65f8374c110),
+     W(0xb8b4a422330c789a)},
+    0
+  },
+  {
+    {W(0xc4f4cda3af2ebc2f), W(0xa0af843dcb4efe24), W(0x53b857c19ccd10b1),
+     W(0xddc9d1eb914d3e04)},
+    {W(0x7bdec8bb62771deb), W(0x829277aa91c5aa81), W(0x7af18dd6832391ae),
+     W(0x1740f316c71a84ca)},
+    0
+  },
+  {
+    {W(0x2d500910cab91f1e), W(0xbedd9e444d1cd216), W(0xd634b74fedd02252),
+     W(0xbd60f8e11258617a)},
+    {W(0xd8c7537b9e05614a), W(0xfd26c766e7af5fc5), W(0x0660b581582bd926),
+     W(0x87019244acf07fc8)},
+    0
+  },
+  {
+    {W(0x8928e99aeeaf8c49), W(0xee7aa73d6e24d728), W(0x4c5007c2e72b156c),
+     W(0x5fcf57c5ed408a1d)},
+    {W(0x9f719e39b6057604), W(0x7d343c01c2868bbf), W(0x2cca254b7e103e2d),
+     W(0xe6eb38a9f131bea2)},
+    0
+  },
+  {
+    {W(0x0ba4e3520a981b0d), W(0x1c354cb3bd1a41a4), W(0x1aabaa3adf9fab9c),
+     W(0x0701a7d153c418d5)},
+    {W(0xdd1a7cefdcf2b921), W(0x6ceef0b3bcf48061), W(0x1083b598de25cce6),
+     W(0x890a54c7e90a5e34)},
+    0
+  },
+  {
+    {W(0x405718db4f6d01b1), W(0xe73c6bc28f11e8a0), W(0xac11bb8ca0591a3b),
+     W(0x12d09a5a0acc4531)},
+    {W(0xcbf174eee7de13f4), W(0x177e2be6044fd682), W(0x65f574cb1c48af70),
+     W(0xce5966929961cb7c)},
+    0
+  },
+  {
+    {W(0xc59eed6c048752a1), W(0x41f2702ea01341b4), W(0x6e35903b9dc6b092),
+     W(0x4291aba81f5b5b23)},
+    {W(0x8173aa70a653d61d), W(0xd1b648d44f2eb51e), W(0x31b7ce065ab93f8f),
+     W(0xa55408ee99e2f4fe)},
+    0
+  },
+  {
+    {W(0xb33e624f8be762b4), W(0x2a9ee4d1058e3413), W(0x968e636967d805fa),
+     W(0x9848949b7db8bfd7)},
+    {W(0x5308d7e5d23a8417), W(0x892f3b1df3e29da5), W(0xc95c139e3dee471f),
+     W(0x8631594dd757e089)},
+    0
+  },
+  {
+    {W(0x6cebf355e1e54549), W(0x3c755eb7aa88ed82), W(0x79d0a88998c9932f),
+     W(0x0636aec2cb5095e6)},
+    {W(0x28241a9495259f8c), W(0xa6b7abada63914a7), W(0x2f81eb0bb3d2a13a),
+     W(0x9b07a130becf1412)},
+    0
+  },
+  {
+    {W(0xca86b757409663df), W(0x66998f9b20159431), W(0x0d50add6d1aef5ed),
+     W(0xb35b824e07bfed22)},
+    {W(0xcd437a79db49a2ee), W(0xbf98a80a522c2f5f), W(0x3d2e39237cd21a00),
+     W(0xe813051223d819e3)},
+    0
+  },
+  {
+    {W(0x76b68f4fc94a5f66), W(0xef2b23a05390d72f), W(0xab34448759571e9e),
+     W(0x471a9079c1582591)},
+    {W(0x01567c3b2646f3a4), W(0x8cb1f6b4a6297bca), W(0xf4f61deb68361444),
+     W(0x2fece80a4ccead70)},
+    0
+  },
+  {
+    {W(0xe0c82a3cde918dcc), W(0x2e7b599426fdcf4b), W(0x82c5024932cb1b2d),
+     W(0xea613a9d7657ae07)},
+    {W(0xc2eb5f6cf1fdc9f7), W(0xb6eae8b8879fe682), W(0x253dfee0591cbc7f),
+     W(0x000da7133e1290e6)},
+    0
+  },
+  {
+    {W(0xf2d5a54f0e929d5f), W(0x601100b7c4d21650), W(0xdf34e6506928bab8),
+     W(0xd6124e5642dbaeb3)},
+    {W(0xac71efe7d5fe5707), W(0xe466ec8f7e39d411), W(0x8af72d268beb7402),
+     W(0x96b273b67f05ab44)},
+    0
+  },
+  {
+    {W(0x01b71dba5d034de5), W(0x5cda5d59dd0a57a2), W(0xee1a0db7262c5908),
+     W(0xd3d282dcc405c6ac)},
+    {W(0x7889037809a6433d), W(0x8f5fb44f8ddab5a1), W(0x5056d1d4ae7e7cf1),
+     W(0x29be7c7b2314fa2e)},
+    0
+  },
+  {
+    {W(0x2155f57c055de17d), W(0xfa8d1f529a1ffb31), W(0xa31b81aa8434d03c),
+     W(0x8f84942038eda0ca)},
+    {W(0x03e5f8208a81d2ec), W(0xd018c8e3201c2829), W(0xbc101c4e6a22433c),
+     W(0xcc2ac6b8fbe89805)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1083e2ea1f095615), W(0x0a28ad7714e68c33), W(0x6bfc02523d8818be),
+     W(0xb585113af35850cd)},
+    {W(0x7d935f0b30df8aa1), W(0xaddda07c4ab7e3ac), W(0x92c34299552f00cb),
+     W(0xc33ed1de2909df6c)},
+    0
+  },
+  {
+    {W(0x2dc40d483e07113c), W(0x6e4a5d397d8b63ae), W(0x5582a94b79684c2b),
+     W(0x932b33d4622da26c)},
+    {W(0xf534f6510dbbf08d), W(0x211d07c964c23a52), W(0x0eeece0fee5bdc9b),
+     W(0xdf178168f7015558)},
+    0
+  },
+  {
+    {W(0xabe7905a83cdd60e), W(0x50602fb5a1170184), W(0x689886cdb023642a),
+     W(0xd568d090a6e1fb00)},
+    {W(0x5b1922c70259217f), W(0x93831cd9c43141e4), W(0xdfca35870c95f86e),
+     W(0xdec2057a568ae828)},
+    0
+  },
+  {
+    {W(0x568f8925913cc16d), W(0x18bc5b6de1a26f5a), W(0xdfa413bef5f499ae),
+     W(0xf8835decc3f0ae84)},
+    {W(0xb6e60bd865a40ab0), W(0x65596439194b377e), W(0xbcd8562592084a69),
+     W(0x5ce433b94f23ede0)},
+    0
+  },
+  {
+    {W(0x860d523d42e06189), W(0xbf0779414e3aff13), W(0x0b616dcac1b20650),
+     W(0xe66dd6d12131300d)},
+    {W(0xd4a0fd67ff99abde), W(0xc9903550c7aac50d), W(0x022ecf8b7c46b2d7),
+     W(0x3333b1e83abf92af)},
+    0
+  },
+  {
+    {W(0xc0da65e784d6365d), W(0xbcb7443f8f759fb8), W(0x35c712b17ae81930),
+     W(0x80428dff4c6e08ab)},
+    {W(0xf19dafefa4faf843), W(0xced8538dffa9855f), W(0x20ac409cbe3ac7ce),
+     W(0x358c1fb6882da71e)},
+    0
+  },
+  {
+    {W(0xefecdef7be42a582), W(0xd3fc608065046be6), W(0xc9af13c809e8dba9),
+     W(0x1e6c9847641491ff)},
+    {W(0x3b574925d30c31f7), W(0xb7eb72baac2a2122), W(0x776a0dacef0859e7),
+     W(0x06fec31421900942)},
+    0
+  },
+  {
+    {W(0x324794b07e50122b), W(0xdd744f8b4af07ca5), W(0x30a12f08d63fc97b),
+     W(0x39650f1a76626d9d)},
+    {W(0x101b47f71fa38477), W(0x3d815f19d4dc124f), W(0x1569ae95b26eb58a),
+     W(0xc3cde18895fb1887)},
+    0
+  },
+  {
+    {W(0x7ec62fbbf4737f21), W(0xd8dba5ab6209f5ac), W(0x24b5d7a9a5f9adbe),
+     W(0x707d28f7a61dc768)},
+    {W(0x7711460bcaa999ea), W(0xba7b174d1c92e4cc), W(0x3c4bab6618d4bf2d),
+     W(0xb8f0c980eb8bd279)},
+    0
+  },
+  {
+    {W(0x9d658932790691bf), W(0xed61058906b736ae), W(0x712c2f04c0d63b6e),
+     W(0x5cf06fd5c63d488f)},
+    {W(0x97363facd9588e41), W(0x1f9bf7622b93257e), W(0xa9d1ffc4667acace),
+     W(0x1cf4a1aa0a061ecf)},
+    0
+  },
+  {
+    {W(0x28d675b2c0519a23), W(0x9ebf94fe4f6952e3), W(0xf28bb767a2294a8a),
+     W(0x85512b4dfe0af3f5)},
+    {W(0x18958ba899b16a0d), W(0x95c2430cba7548a7), W(0xb30d1b10a16be615),
+     W(0xe3ebbb9785bfb74c)},
+    0
+  },
+  {
+    {W(0x07b53f5eb2e63645), W(0xbe57e54784c84232), W(0xd779c2167214d5cf),
+     W(0x617969cd029a3aca)},
+    {W(0xd17668cd8a7017a0), W(0x77b4d19abe9b7ee8), W(0x58fd0e939c161776),
+     W(0xa8c4f4efd5968a72)},
+    0
+  },
+  {
+    {W(0x81eeb865d2fdca23), W(0x5a15ee08cc8ef895), W(0x768fa10a01905614),
+     W(0xeff5b8ef880ee19b)},
+    {W(0xf0c0cabbcb1c8a0e), W(0x2e1ee9cdb8c838f9), W(0x0587d8b88a4a14c0),
+     W(0xf6f278962ff698e5)},
+    0
+  },
+  {
+    {W(0x519d34b3bf44da80), W(0x283834f95ab32e66), W(0x6e6087976278a000),
+     W(0x1e62960e627312f6)},
+    {W(0x9b87b27be6901c55), W(0x80e7853824fdbc1f), W(0xbbbc09512facc27d),
+     W(0x06394239ac143b5a)},
+    0
+  },
+  {
+    {W(0x9c4b646e9e2fce99), W(0x68a210811e80857f), W(0x06d54e443643b52a),
+     W(0xde8d6d630d8eb843)},
+    {W(0x7032156342146a0a), W(0x8ba826f25eaa3622), W(0x227a58bd86138787),
+     W(0x43b6c03c10281d37)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x02b37a952f41deff), W(0x0e44a59ae63b89b7), W(0x673257dc143ff951),
+     W(0x19c02205d752baf4)},
+    {W(0x46c23069c4b7d692), W(0x2e6392c3fd1502ac), W(0x6057b1a21b220846),
+     W(0xe51ff9460c1b5b63)},
+    0
+  },
+  {
+    {W(0x6e85cb51566c5c43), W(0xcff9c9193597f046), W(0x9354e90c4994d94a),
+     W(0xe0a393322147927d)},
+    {W(0x8427fac10dc1eb2b), W(0x88cfd8c22ff319fa), W(0xe2d4e68401965274),
+     W(0xfa2e067d67aaa746)},
+    0
+  },
+  {
+    {W(0xb9dc857c5b0f7bd4), W(0x6990c2c9108ea1cd), W(0x84730b83b984c7a9),
+     W(0x552723d2eab18a78)},
+    {W(0x9752c2e2919ba0f9), W(0x075a3bd94bf40890), W(0x71e52a04a6d98212),
+     W(0x3fb6607a9f18a4c8)},
+    0
+  },
+  {
+    {W(0xb6d92a7f3e5f9f11), W(0x9afe153ad6cb3b8e), W(0x4d1a6dd7ddf800bd),
+     W(0xf6c13cc0caf17e19)},
+    {W(0x15f6c58e325fc3ee), W(0x71095400a31dc3b2), W(0x168e7c07afa3d3e7),
+     W(0x3f8417a194c7ae2d)},
+    0
+  },
+  {
+    {W(0xf47b75216ce400bb), W(0xf72919f7caf07d99), W(0x95b86e0600ce62e0),
+     W(0x11872baf8fcfd00e)},
+    {W(0x049b21eb211f7dc6), W(0xb8900e5654ebd6f6), W(0x7c38cea4162d78da),
+     W(0x9a586c9e0bfa3da0)},
+    0
+  },
+  {
+    {W(0xec234772813b230d), W(0x634d0f5f17344427), W(0x11548ab1d77fc56a),
+     W(0x7fab1750ce06af77)},
+    {W(0xb62c10a74f7c4f83), W(0xa7d2edc4220a67d9), W(0x1c404170921209a0),
+     W(0x0b9815a0face59f0)},
+    0
+  },
+  {
+    {W(0xad3883e151c3ebe5), W(0xdb14d5c7d25d7be8), W(0x23e44911558ea8c9),
+     W(0x3a68529f3f45c6ab)},
+    {W(0xeb18a1dc149f75b8), W(0x9b8946a1079c7cb2), W(0x27ad2a191157a94e),
+     W(0x84b14f461106f85a)},
+    0
+  },
+  {
+    {W(0x2842589b319540c3), W(0x18490f59a283d6f8), W(0xa2731f84daae9fcb),
+     W(0x3db6d960c3683ba0)},
+    {W(0xc85c63bb14611069), W(0xb19436af0788bf05), W(0x905459df347460d2),
+     W(0x73f6e094e11a7db1)},
+    0
+  },
+  {
+    {W(0x34540e92e685f58a), W(0x6b2eca2c0dd396f9), W(0xa7531847ba86b4b4),
+     W(0xa4bf77f2cc32dfff)},
+    {W(0x7be46014707a589d), W(0x049892526dcdbf0c), W(0x5473994a7cf9ca06),
+     W(0x02b853cab401b3e4)},
+    0
+  },
+  {
+    {W(0xdc7f938eb6357f37), W(0xc5d00f792bd8aa62), W(0xc878dcb92ca979fc),
+     W(0x37e83ed9eb023a99)},
+    {W(0x6b23e2731560bf3d), W(0x1086e4591d0fae61), W(0x782483169a9414bd),
+     W(0x1b956bc0f0ea9ea1)},
+    0
+  },
+  {
+    {W(0x159850d3272cfc4b), W(0x7f8e93f73b9b6b67), W(0xeadc4b677aed726b),
+     W(0x40b51984fb92b8a7)},
+    {W(0xb11764dda0752db1), W(0x36b8205cc31f3e4c), W(0xb3c073e676e40a6b),
+     W(0x7bb541a4893098d2)},
+    0
+  },
+  {
+    {W(0x7b85bb91c31b9c38), W(0x0c5aa90b48ef57b5), W(0xdedeb169af3bab6f),
+     W(0xe610ad732d373685)},
+    {W(0xf13870df02ba8e15), W(0x0337edb68ca7f771), W(0xe4acf747b62c036c),
+     W(0xd921d576b6b94e81)},
+    0
+  },
+  {
+    {W(0x8c3a96a986ccce69), W(0x025d620318c523c6), W(0xdec1906ae80886a7),
+     W(0x6cd6229ce126262b)},
+    {W(0x8053143aae881c98), W(0x0189394a286cc2c7), W(0x9e3ee0e0dea7fcf1),
+     W(0xf06f9b7a2ae8c723)},
+    0
+  },
+  {
+    {W(0xdbc864392c422f7a), W(0xfb635362ed348898), W(0x83084668c45bfcd1),
+     W(0xc357c9e32b315e11)},
+    {W(0xb173b5405b2e5b8c), W(0x7e946931e102b9a4), W(0x17c890eb7b0fb199),
+     W(0xec225a83d61b662b)},
+    0
+  },
+  {
+    {W(0xb460a58b5f13ed61), W(0x4c571d3b74ea1318), W(0x39bbbfa7b1f15dc9),
+     W(0xbf12b379d2dc20e4)},
+    {W(0x5c213ccbac517de3), W(0x5462c1611bcf5a41), W(0x1f4ce6ae17c5752d),
+     W(0x34979d29430b7995)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf306a3c8ee3c76cb), W(0x3cf11623d32a1f6e), W(0xe6d5ab646863e956),
+     W(0x3b8a4cbe5c005c26)},
+    {W(0xdcd529a59ce6bb27), W(0xc4afaa5204d4b16f), W(0xb0624a267923798d),
+     W(0x85e56df66b307fab)},
+    0
+  },
+  {
+    {W(0xb2330fef4e4ca463), W(0xbcef72873566cc63), W(0xd161d2cacf780900),
+     W(0x135dc5395b54827d)},
+    {W(0x638f052e27bf1bc6), W(0x10a224f007dfa06c), W(0xe973586d6d3321da),
+     W(0x8b0c573826152c8f)},
+    0
+  },
+  {
+    {W(0x896895959884aaf7), W(0xb1959be307b348a6), W(0x96250e573c147c87),
+     W(0xae0efb3add0c61f8)},
+    {W(0xed00745eca8c325e), W(0x3c911696ecff3f70), W(0x73acbc65319ad41d),
+     W(0x7b01a020f0b1c7ef)},
+    0
+  },
+  {
+    {W(0x9910ba6b23a5d896), W(0x1fe19e357fe4364e), W(0x6e1da8c39a33c677),
+     W(0x15b4488b29fd9fd0)},
+    {W(0x1f4392541a1f22bf), W(0x920a8a70ab8163e8), W(0x3fd1b24907e5658e),
+     W(0xf2c4f79cb6ec839b)},
+    0
+  },
+  {
+    {W(0x262143b5224c08dc), W(0x2bbb09b481b50c91), W(0xc16ed709aca8c84f),
+     W(0xa6210d9db2850ca8)},
+    {W(0x6d8df67a09cb54d6), W(0x91eef6e0500919a4), W(0x90f613810f132857),
+     W(0x9acede47f8d5028b)},
+    0
+  },
+  {
+    {W(0x84cea0691416a6a5), W(0x8f860c7943ef881c), W(0x41311f8a38038a5d),
+     W(0xe78c2ec0fc612067)},
+    {W(0x494d2e815ad73581), W(0xb4cc9e0059604097), W(0xff558aecf3612cba),
+     W(0x35beef7a9e36c39e)},
+    0
+  },
+  {
+    {W(0x45e21446de673629), W(0x57f7aa1e703c2d21), W(0xa0e99b7f98c868c7),
+     W(0x4e42f66d8b641676)},
+    {W(0x602884dc91077896), W(0xa0d690cfc2c9885b), W(0xfeb4da333b9a5187),
+     W(0x5f789598153c87ee)},
+    0
+  },
+  {
+    {W(0x8b5c619c76497ee8), W(0x5d2b0ac6c717370e), W(0x98204cb64fcf68e1),
+     W(0x0bdec21162bc6792)},
+    {W(0x6973ccefa63b1011), W(0xf9e3fa97e0de1ac5), W(0x5efb693e3d0e0c8b),
+     W(0x037248e9d2d4fcb4)},
+    0
+  },
+  {
+    {W(0xb19b1c4fca66eca8), W(0xf04a20b55663de54), W(0x42a29a33c223b617),
+     W(0x86c68d0d44827e11)},
+    {W(0x71f90ddeadba1206), W(0xeeffb4167a6ceeea), W(0x9e302fbac543e8af),
+     W(0xcf07f7471aa77b96)},
+    0
+  },
+  {
+    {W(0xcf57fca29849e95b), W(0x96e9793ed510053c), W(0x89fa443d07d3e75e),
+     W(0xfe2bc235e52800a0)},
+    {W(0x1c208b8c0ac7e740), W(0xb5852a49e7222263), W(0x217e4005e541e592),
+     W(0xee52747dc960b0e1)},
+    0
+  },
+  {
+    {W(0x5fd7cafb475952af), W(0x23a6d71954a43337), W(0xa83a7523b1617941),
+     W(0x0b7f35d412b37dd4)},
+    {W(0x81ec51292ae27eaf), W(0x7ca92fb3318169df), W(0xc01bfd6078d0875a),
+     W(0xcc6074e3c99c436e)},
+    0
+  },
+  {
+    {W(0xd3694e2ab20364e4), W(0x62699718e770b20d), W(0x6183291b6ed77d1c),
+     W(0x69aada7f6d6180a5)},
+    {W(0x51f9054bf185509b), W(0xfd7e845678701077), W(0xd6a2308a7fb96d8d),
+     W(0xd53e48d228dc87ee)},
+    0
+  },
+  {
+    {W(0x4ca6bdebf57912b8), W(0x9a17577e98507b5a), W(0x8ed4ab7759e51dfc),
+     W(0x103b7b2a470f5a36)},
+    {W(0x0c8545ac12553321), W(0xab5861a760482817), W(0xf4b5f602b9b856cf),
+     W(0x609955787adf2e5f)},
+    0
+  },
+  {
+    {W(0x3e858c2ffceac518), W(0x94589aac6656bbe1), W(0x82293299cdf809af),
+     W(0x1280aafbed23f0d1)},
+    {W(0xdeab0c677306e2a4), W(0xe010a39acfaec17f), W(0xd5cb00b340f02322),
+     W(0x9bfafcccca58cca2)},
+    0
+  },
+  {
+    {W(0x60ce25b1ee5cb44f), W(0xddcc7d182c2d7598), W(0x1765a1b301847b5c),
+     W(0xf5d9c3635d0d23b7)},
+    {W(0x42ff1ba7928b65d0), W(0x587ac69d6148e043), W(0x3099be0dd320390b),
+     W(0xa7b88dfc4278329f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x80802dc91ec34f9e), W(0xd8772d3533810603), W(0x3f06d66c530cb4f3),
+     W(0x7be5ed0dc475c129)},
+    {W(0xcb9e3c1931e82b10), W(0xc63d2857c9ff6b4c), W(0xb92118c692a1b45e),
+     W(0x0aec44147285bbca)},
+    0
+  },
+  {
+    {W(0xfc189ae71e29a3ef), W(0xcbe906f04c93302e), W(0xd0107914ceaae10e),
+     W(0xb7a23f34b68e19f8)},
+    {W(0xe9d875c2efd2119d), W(0x03198c6efcadc9c8), W(0x65591bf64da17113),
+     W(0x3cf0bbf83d443038)},
+    0
+  },
+  {
+    {W(0xae485bb72b724759), W(0x945353e1b2d4c63a), W(0x82159d07de7d6f2c),
+     W(0x389caef34ec5b109)},
+    {W(0x4a8ebb53db65ef14), W(0x2dc2cb7edd99de43), W(0x816fa3ed83f2405f),
+     W(0x73429bb9c14208a3)},
+    0
+  },
+  {
+    {W(0xb618d590b01e6e27), W(0x047e2ccde180b2dc), W(0xd1b299b504aea4a9),
+     W(0x412c9e1e9fa403a4)},
+    {W(0x88d28a3679407552), W(0x49c50136f332b8e3), W(0x3a1b6fcce668de19),
+     W(0x178851bc75122b97)},
+    0
+  },
+  {
+    {W(0xb1e13752fb85fa4c), W(0xd61257ce383c8ce9), W(0xd43da670d2f74dae),
+     W(0xa35aa23fbf846bbb)},
+    {W(0x5e74235d4421fc83), W(0xf6df8ee0c363473b), W(0x34d7f52a3c4aa158),
+     W(0x50d05aab9bc6d22e)},
+    0
+  },
+  {
+    {W(0x8c56e735a64785f4), W(0xbc56637b5f29cd07), W(0x53b2bb803ee35067),
+     W(0x50235a0fdc919270)},
+    {W(0x191ab6d8f2c4aa65), W(0xc34758318396023b), W(0x80400ba5f0f805ba),
+     W(0x8881065b5ec0f80f)},
+    0
+  },
+  {
+    {W(0xc370e522cc1b5e83), W(0xde2d4ad1860b8bfb), W(0xad364df067b256df),
+     W(0x8f12502ee0138997)},
+    {W(0x503fa0dc7783920a), W(0xe80014adc0bc866a), W(0x3f89b744d3064ba6),
+     W(0x03511dcdcba5dba5)},
+    0
+  },
+  {
+    {W(0x197dd46d95a7b1a2), W(0x9c4e7ad63c6341fb), W(0x426eca29484c2ece),
+     W(0x9211e489de7f4f8a)},
+    {W(0x14997f6ec78ef1f4), W(0x2b2c091006574586), W(0x17286a6e1c3eede8),
+     W(0x25f92e470f60e018)},
+    0
+  },
+  {
+    {W(0x805c564631890a36), W(0x703ef60057feea5b), W(0x389f747caf3c3030),
+     W(0xe0e5daeb54dd3739)},
+    {W(0xfe24a4c3c9c9f155), W(0x7e4bf176b5393962), W(0x37183de2af20bf29),
+     W(0x4a1bd7b5f95a8c3b)},
+    0
+  },
+  {
+    {W(0xa83b969946191d3d), W(0x281fc8dd7b87f257), W(0xb18e2c1354107588),
+     W(0x6372def79b2bafe8)},
+    {W(0xdaf4bb480d8972ca), W(0x3f2dd4b756167a3f), W(0x1eace32d84310cf4),
+     W(0xe3bcefafe42700aa)},
+    0
+  },
+  {
+    {W(0x5fe5691ed785e73d), W(0xa5db5ab62ea60467), W(0x02e23d41dfc6514a),
+     W(0x35e8048ee03c3665)},
+    {W(0x3f8b118f1adaa0f8), W(0x28ec3b4584ce1a5a), W(0xe8cacc6e2c6646b8),
+     W(0x1343d185dbd0e40f)},
+    0
+  },
+  {
+    {W(0xe5d7f844caaa358c), W(0x1a1db7e49924182a), W(0xd64cd42d9c875d9a),
+     W(0xb37b515f042eeec8)},
+    {W(0x4d4dd4097b165fbe), W(0xfc322ed9e206eff3), W(0x7dee410259b7e17e),
+     W(0x55a481c08236ca00)},
+    0
+  },
+  {
+    {W(0x8c885312c23fc975), W(0x1571580605d6297b), W(0xa078868ef78edd39),
+     W(0x956b31e003c45e52)},
+    {W(0x470275d5ff7b33a6), W(0xc8d5dc3a0c7e673f), W(0x419227b47e2f2598),
+     W(0x8b37b6344c14a975)},
+    0
+  },
+  {
+    {W(0xd0667ed68b11888c), W(0x5e0e8c3e803e25dc), W(0x34e5d0dcb987a24a),
+     W(0x9f40ac3bae920323)},
+    {W(0x5463de9534e0f63a), W(0xa128bf926b6328f9), W(0x491ccd7cda64f1b7),
+     W(0x7ef1ec27c47bde35)},
+    0
+  },
+  {
+    {W(0xa857240fa36a2737), W(0x35dc136663621bc1), W(0x7a3a6453d4fb6897),
+     W(0x80f1a439c929319d)},
+    {W(0xfc18274bf8cb0ba0), W(0xb0b537668078c5eb), W(0xfb0d49241e01d0ef),
+     W(0x50d7c67d372ab09c)},
+    0
+  }
+};
+
+static const wge_t p256_wnd_naf[1024] = {
+  {
+    {W(0x79e730d418a9143c), W(0x75ba95fc5fedb601), W(0x79fb732b77622510),
+     W(0x18905f76a53755c6)},
+    {W(0xddf25357ce95560a), W(0x8b4ab8e4ba19e45c), W(0xd2e88688dd21f325),
+     W(0x8571ff1825885d85)},
+    0
+  },
+  {
+    {W(0xffac3f904eebc127), W(0xb027f84a087d81fb), W(0x66ad77dd87cbbc98),
+     W(0x26936a3fb6ff747e)},
+    {W(0xb04c5c1fc983a7eb), W(0x583e47ad0861fe1a), W(0x788208311a2ee98e),
+     W(0xd5f06a29e587cc07)},
+    0
+  },
+  {
+    {W(0xbe1b8aaec45c61f5), W(0x90ec649a94b9537d), W(0x941cb5aad076c20c),
+     W(0xc9079605890523c8)},
+    {W(0xeb309b4ae7ba4f10), W(0x73c568efe5eb882b), W(0x3540a9877e7a1f68),
+     W(0x73a076bb2dd1e916)},
+    0
+  },
+  {
+    {W(0x0746354ea0173b4f), W(0x2bd20213d23c00f7), W(0xf43eaab50c23bb08),
+     W(0x13ba5119c3123e03)},
+    {W(0x2847d0303f5b9d4d), W(0x6742f2f25da67bdd), W(0xef933bdc77c94195),
+     W(0xeaedd9156e240867)},
+    0
+  },
+  {
+    {W(0x75c96e8f264e20e8), W(0xabe6bfed59a7a841), W(0x2cc09c0444c8eb00),
+     W(0xe05b3080f0c4e16b)},
+    {W(0x1eb7777aa45f3314), W(0x56af7bedce5d45e3), W(0x2b6e019a88b12f1a),
+     W(0x086659cdfd835f9b)},
+    0
+  },
+  {
+    {W(0xea7d260a6245e404), W(0x9de407956e7fdfe0), W(0x1ff3a4158dac1ab5),
+     W(0x3e7090f1649c9073)},
+    {W(0x1a7685612b944e88), W(0x250f939ee57f61c8), W(0x0c0daa891ead643d),
+     W(0x68930023e125b88e)},
+    0
+  },
+  {
+    {W(0xccc425634b2ed709), W(0x0e356769856fd30d), W(0xbcbcd43f559e9811),
+     W(0x738477ac5395b759)},
+    {W(0x35752b90c00ee17f), W(0x68748390742ed2e3), W(0x7cd06422bd1f5bc1),
+     W(0xfbc08769c9e7b797)},
+    0
+  },
+  {
+    {W(0x72bcd8b7bc60055b), W(0x03cc23ee56e27e4b), W(0xee337424e4819370),
+     W(0xe2aa0e430ad3da09)},
+    {W(0x40b8524f6383c45d), W(0xd766355442a41b25), W(0x64efa6de778a4797),
+     W(0x2042170a7079adf4)},
+    0
+  },
+  {
+    {W(0x97091dcbd53c5c9d), W(0xf17624b6ac0a177b), W(0xb0f139752cfe2dff),
+     W(0xc1a35c0a6c7a574e)},
+    {W(0x227d314693e79987), W(0x0575bf30e89cb80e), W(0x2f4e247f0d1883bb),
+     W(0xebd512263274c3d0)},
+    0
+  },
+  {
+    {W(0xfea912baa5659ae8), W(0x68363aba25e1a16e), W(0xb8842277752c41ac),
+     W(0xfe545c282897c3fc)},
+    {W(0x2d36e9e7dc4c696b), W(0x5806244afba977c5), W(0x85665e9be39508c1),
+     W(0xf720ee256d12597b)},
+    0
+  },
+  {
+    {W(0x562e4cecc135b208), W(0x74e1b2654783f47d), W(0x6d2a506c5a3f3b30),
+     W(0xecead9f4c16762fc)},
+    {W(0xf29dd4b2e286e5b9), W(0x1b0fadc083bb3c61), W(0x7a75023e7fac29a4),
+     W(0xc086d5f1c9477fa3)},
+    0
+  },
+  {
+    {W(0xf4f876532de45068), W(0x37c7a7e89e2e1f6e), W(0xd0825fa2a3584069),
+     W(0xaf2cea7c1727bf42)},
+    {W(0x0360a4fb9e4785a9), W(0xe5fda49c27299f4a), W(0x48068e1371ac2f71),
+     W(0x83d0687b9077666f)},
+    0
+  },
+  {
+    {W(0xa4a319acd837879f), W(0x6fc1b49eed6b67b0), W(0xe395993332f1f3af),
+     W(0x966742eb65432a2e)},
+    {W(0x4b8dc9feb4966228), W(0x96cc631243f43950), W(0x12068859c9b731ee),
+     W(0x7b948dc356f79968)},
+    0
+  },
+  {
+    {W(0x042c2af497e2feb4), W(0xd36a42d7aebf7313), W(0x49d2c9eb084ffdd7),
+     W(0x9f8aa54b2ef7c76a)},
+    {W(0x9200b7ba09895e70), W(0x3bd0c66fddb7fb58), W(0x2d97d10878eb4cbb),
+     W(0x2d431068d84bde31)},
+    0
+  },
+  {
+    {W(0x5e5db46acb66e132), W(0xf1be963a0d925880), W(0x944a70270317b9e2),
+     W(0xe266f95948603d48)},
+    {W(0x98db66735c208899), W(0x90472447a2fb18a3), W(0x8a966939777c619f),
+     W(0x3798142a2a3be21b)},
+    0
+  },
+  {
+    {W(0xe2f73c696755ff89), W(0xdd3cf7e7473017e6), W(0x8ef5689d3cf7600d),
+     W(0x948dc4f8b1fc87b4)},
+    {W(0xd9e9fe814ea53299), W(0x2d921ca298eb6028), W(0xfaecedfd0c9803fc),
+     W(0xf38ae8914d7b4745)},
+    0
+  },
+  {
+    {W(0x871514560f664534), W(0x85ceae7c4b68f103), W(0xac09c4ae65578ab9),
+     W(0x33ec6868f044b10c)},
+    {W(0x6ac4832b3a8ec1f1), W(0x5509d1285847d5ef), W(0xf909604f763f1574),
+     W(0xb16c4303c32f63c4)},
+    0
+  },
+  {
+    {W(0xfd16847fdec67ef5), W(0x742ee464233e76b7), W(0x0b8e4134efc2b4c8),
+     W(0xca640b8642a3e521)},
+    {W(0x653a01908ceb6aa9), W(0x313c300c547852d5), W(0x24e4ab126b237af7),
+     W(0x2ba901628bb47af8)},
+    0
+  },
+  {
+    {W(0x00467bc58cce08b5), W(0xb636458c7f178d55), W(0xc5748baea677d806),
+     W(0x2763a387dfa394eb)},
+    {W(0xa12b448a7d3cebb6), W(0xe7adda3e6f20d850), W(0xf63ebce51558462c),
+     W(0x58b36143620088a8)},
+    0
+  },
+  {
+    {W(0xa9d89488a059c142), W(0x6f5ae714ff0b9346), W(0x068f237d16fb3664),
+     W(0x5853e4c4363186ac)},
+    {W(0xe2d87d2363c52f98), W(0x2ec4a76681828876), W(0x47b864fae14e7b1c),
+     W(0x0c0bc0e569192408)},
+    0
+  },
+  {
+    {W(0x624d60492ed22e91), W(0x6fdfe0b56f072822), W(0xeeca111539ce2271),
+     W(0x98100a4fdb01614f)},
+    {W(0xb6b0daa2a35c628f), W(0xb6f94d2ec87e9a47), W(0xc67732591d57d9ce),
+     W(0xf70bfeec03884a7b)},
+    0
+  },
+  {
+    {W(0x4ff23ffd248a7d06), W(0x80c5bfb4878873fa), W(0xb7d9ad9005745981),
+     W(0x179c85db3db01994)},
+    {W(0xba41b06261a6966c), W(0x4d82d052eadce5a8), W(0x9e91cd3ba5e6a318),
+     W(0x47795f4f95b2dda0)},
+    0
+  },
+  {
+    {W(0x1ee426ccd5cd79bf), W(0x0032940b946c6e18), W(0x1b1e8ae057477f58),
+     W(0xe94f7d346d823278)},
+    {W(0xc747cb96782ba21a), W(0xc5254469f72b33a5), W(0x772ef6dec7f80c81),
+     W(0xd73acbfe2cd9e6b5)},
+    0
+  },
+  {
+    {W(0x283c7513caa76097), W(0x0a624fa936c83906), W(0x6b20afec715af2c7),
+     W(0x4b969974eba78bfd)},
+    {W(0x220755ccd921d60e), W(0x9b944e107baeca13), W(0x04819d515ded93d4),
+     W(0x9bbff86e6dddfd27)},
+    0
+  },
+  {
+    {W(0x21950b421ff6acd3), W(0xffe7048453dc6909), W(0xff4cd0b228766127),
+     W(0xabdbe6084fb7db2b)},
+    {W(0x837c92285e1109e8), W(0x26147d27f4645b5a), W(0x4d78f592f7818ed8),
+     W(0xd394077ef247fa36)},
+    0
+  },
+  {
+    {W(0x508cec1c3b3f64c9), W(0xe20bc0ba1e5edf3f), W(0xda1deb852f4318d4),
+     W(0xd20ebe0d5c3fa443)},
+    {W(0x370b4ea773241ea3), W(0x61f1511c5e1a5f65), W(0x99a5e23d82681c62),
+     W(0xd731e383a2f54c2d)},
+    0
+  },
+  {
+    {W(0x97359638546c4d8d), W(0x5f9c3fc492f24679), W(0x912e8beda8c8acd9),
+     W(0xec3a318d306634b0)},
+    {W(0x80167f41c31cb264), W(0x3db82f6f522113f2), W(0xb155bcd2dcafe197),
+     W(0xfba1da5943465283)},
+    0
+  },
+  {
+    {W(0x258bbbf9e7305683), W(0x31eea5bf07ef5be6), W(0x0deb0e4a46c814c1),
+     W(0x5cee8449a7b730dd)},
+    {W(0xeab495c5a0182bde), W(0xee759f879e27a6b4), W(0xc2cf6a6880e518ca),
+     W(0x25e8013ff14cf3f4)},
+    0
+  },
+  {
+    {W(0x3ec832e77acaca28), W(0x1bfeea57c7385b29), W(0x068212e3fd1eaf38),
+     W(0xc13298306acf8ccc)},
+    {W(0xb909f2db2aac9e59), W(0x5748060db661782a), W(0xc5ab2632c79b7a01),
+     W(0xda44c6c600017626)},
+    0
+  },
+  {
+    {W(0x69d44ed65c46aa8e), W(0x2100d5d3a8d063d1), W(0xcb9727eaa2d17c36),
+     W(0x4c2bab1b8add53b7)},
+    {W(0xa084e90c15426704), W(0x778afcd3a837ebea), W(0x6651f7017ce477f8),
+     W(0xa062499846fb7a8b)},
+    0
+  },
+  {
+    {W(0x3667eb1a7f4c04cc), W(0x59556621a9404f84), W(0x71cdf6537eceb50a),
+     W(0x994a44a69b8335fa)},
+    {W(0xd7faf819dbeb9b69), W(0x473c5680eed4350d), W(0xb6658466da44bba2),
+     W(0x0d1bc780872bdbf3)},
+    0
+  },
+  {
+    {W(0xb8d3d9319ff91fe5), W(0x039c4800f0518eed), W(0x95c376329182cb26),
+     W(0x0763a43482fc568d)},
+    {W(0x707c04d5383e76ba), W(0xac98b930824e8197), W(0x92bf7c8f91230de0),
+     W(0x90876a0140959b70)},
+    0
+  },
+  {
+    {W(0xdc2306ebfcdbb2b2), W(0x79527db7ba66f4b9), W(0xbf639ed67765765e),
+     W(0x01628c4706b6090a)},
+    {W(0x66eb62f1b957b4a1), W(0x33cb7691ba659f46), W(0x2c90d98cf3e055d6),
+     W(0x7d096ac42f174750)},
+    0
+  },
+  {
+    {W(0x86f04d3b51f9c391), W(0xc16d0c52a48a4ddd), W(0xfc88362a891ea186),
+     W(0xe8218ad07de96a54)},
+    {W(0x2c735ac12f33af7a), W(0x05af456a06620ae8), W(0xde3ec728c30a96a0),
+     W(0xfd59d7eb9a8f62d9)},
+    0
+  },
+  {
+    {W(0x9e5da11cc5e79347), W(0x87986a54361bfe25), W(0xc856868891e9ae09),
+     W(0x49d3ad05548efa2a)},
+    {W(0x987b0687f4eb5cf6), W(0x9bea0d0f2655d14f), W(0x2126ac553a8dd126),
+     W(0x6d37b1fa546fbecc)},
+    0
+  },
+  {
+    {W(0xf19f382e92aa7864), W(0x49c7cb94fc05804b), W(0xf94aa89b40750d01),
+     W(0xdd421b5d4a210364)},
+    {W(0x56cd001e39df3672), W(0x030a119fdd4af1ec), W(0x11f947e696cd0572),
+     W(0x574cc7b293786791)},
+    0
+  },
+  {
+    {W(0xae8f8fe1eeb03d1a), W(0x2b34a7dc096fb852), W(0x794922ef17e29b1a),
+     W(0xb2dacdf66ef82fce)},
+    {W(0xdb8dcc81f42911ee), W(0xb871ba63e405ca09), W(0xa66d92525e82d5b3),
+     W(0xc39725521af82878)},
+    0
+  },
+  {
+    {W(0x616d2c02fb760095), W(0xcfa8ca0e2a7aa6ab), W(0xf123716223af72e0),
+     W(0xa22f8fbea42fd1f6)},
+    {W(0x5072758b78f3d040), W(0x7be19f0ded4437a8), W(0xe79807a770456a7e),
+     W(0x24a1bde1d0c2302d)},
+    0
+  },
+  {
+    {W(0x0a2193bfc266f85c), W(0x719a87be5a0ec9ce), W(0x9c30c6422b2f9c49),
+     W(0xdb15e4963d5baeb1)},
+    {W(0x83c3139be0d37321), W(0x4788522b2e9fdbb2), W(0x2b4f0c7877eb94ea),
+     W(0x854dc9d595105f9e)},
+    0
+  },
+  {
+    {W(0xa40206d330ff0e92), W(0xdd306e2a05176f8b), W(0x58f6428165f89e14),
+     W(0x5ed556aae89327fc)},
+    {W(0xc2b1870af8321bb8), W(0x097a54ff99227b16), W(0xd07370c450128375),
+     W(0xb75df5ec191a421f)},
+    0
+  },
+  {
+    {W(0xd3a5d81fc63d5e79), W(0x8e9d0af402ba3183), W(0xb097c711165c6e4c),
+     W(0xe0beeb1aebff18d3)},
+    {W(0xfe657f130801937b), W(0xa02dbc426fe5b29d), W(0xcbdbfdb9cf290d1f),
+     W(0x7acf4419e85bc145)},
+    0
+  },
+  {
+    {W(0x2c9ee62dc3363a22), W(0x125d4714ec67199a), W(0xf87abebf2ab80485),
+     W(0xcf3086e87a243ca4)},
+    {W(0x5c52b051c64e09dd), W(0x5e9b16125625aad7), W(0x0536a39db19c6126),
+     W(0x97f0013247b64be5)},
+    0
+  },
+  {
+    {W(0x3646b0dd7e1ee314), W(0xef617e0025af7677), W(0x36bf2f65ea65641a),
+     W(0xabfc8457b5e11eff)},
+    {W(0x998dfac18f1192b6), W(0xce91ee270142811b), W(0xbb0066ae1f282369),
+     W(0x159751e2e1cbaebe)},
+    0
+  },
+  {
+    {W(0x516329ff7b4d8b2c), W(0xb856664a2d4b409b), W(0x041252997f6b0670),
+     W(0x2bd0204360826caa)},
+    {W(0x010e522661ddbcb1), W(0xcd07bc34c235d56c), W(0xa8f439ab06e58e3e),
+     W(0xaf490825d5cff157)},
+    0
+  },
+  {
+    {W(0xc1ee6264a7eabe67), W(0x62d51e29fd54487d), W(0x3ea123446310eb5a),
+     W(0xbd88aca74765b805)},
+    {W(0xb7b284be14fb691a), W(0x640388f83b9fffef), W(0x7ab49dd209f98f9a),
+     W(0x7150f87e7211e445)},
+    0
+  },
+  {
+    {W(0xd81ad9386982f865), W(0x27113bb4ae6a94b8), W(0x4a39f02bbedd4f47),
+     W(0x0211de8fd5692705)},
+    {W(0xd587138c63c92f69), W(0x2354719f6237fc68), W(0xfa8a5b9b0b46a59f),
+     W(0x4a70abf75c554ed3)},
+    0
+  },
+  {
+    {W(0x64cfdc70d9453d29), W(0x0aeaca9afd36b1af), W(0x4a278686e1639607),
+     W(0x0581b4711fdf2498)},
+    {W(0x82290e253d61f6d2), W(0x20b021c3df219dc5), W(0xff6c1a78f9a2852f),
+     W(0x435ac466954ffbb3)},
+    0
+  },
+  {
+    {W(0x263e039bb308cc40), W(0x6684ad762b346fd2), W(0x9a127f2bcaa12d0d),
+     W(0x76a8f9fea974291f)},
+    {W(0xc802049b68aa19e4), W(0x65499c990c5dbba0), W(0xee1b1cb5344455a1),
+     W(0x3f293fda2cd6f439)},
+    0
+  },
+  {
+    {W(0xdc90323bafceb64d), W(0xda8cdb78397e43f4), W(0xee848e1d2566805e),
+     W(0xf1ae5380578181c7)},
+    {W(0x2dc7b8e69c70c77c), W(0x85f4d9c45b68b7e7), W(0x84577f1f3260b767),
+     W(0x1fbd470f53cf3e69)},
+    0
+  },
+  {
+    {W(0x2d037bf83f9432b4), W(0xb1f1abb66a7b4371), W(0x650522fd4a9a3b17),
+     W(0xbc438ae1a4e65b07)},
+    {W(0x31b57ea284693c04), W(0x7ab58a3f75503e46), W(0x03a3c2c7b98ff4b3),
+     W(0x4a673fe054fcd65a)},
+    0
+  },
+  {
+    {W(0xb7a96e0a4ea6fdf7), W(0xbbe914d3b99cd026), W(0x6a610374c569a602),
+     W(0xe9b1c23914da499e)},
+    {W(0xb5f6f0feadc19a99), W(0x731251826f21687c), W(0x5a8a14644be77793),
+     W(0x94ce9e0adba8bfc7)},
+    0
+  },
+  {
+    {W(0x564bdda6c71f8d02), W(0xd0a875e919f7f72c), W(0x57670e41bf619241),
+     W(0xf51ec8724c3c386f)},
+    {W(0x00aec19ee8bf7d17), W(0x5df79360286166f3), W(0xa6fae60930a4f924),
+     W(0x1429b1f8ae1d3ed8)},
+    0
+  },
+  {
+    {W(0xde6ddcb77b371390), W(0xcb11125c02a9ba44), W(0xc08ec1602b1d28fd),
+     W(0x680d5abf65e03a86)},
+    {W(0xd5ec7bbbf5327839), W(0xc87057ca3bce7fe5), W(0x4e346db071cbfc97),
+     W(0xd3d6d111ee9e512f)},
+    0
+  },
+  {
+    {W(0x2ca0ba9c3796f4c7), W(0x3571e4d1592ce334), W(0x28f9cdebe9f6e877),
+     W(0xee206023efce1a70)},
+    {W(0xb2159e08b76369dc), W(0x2754e4260a7f687c), W(0xe008039e02de2ff1),
+     W(0xccd7e9418ea700c1)},
+    0
+  },
+  {
+    {W(0xaec63acbdd10edd0), W(0xfd4f61e491ae8d13), W(0xe7b092174df861f4),
+     W(0x3720b2475548de20)},
+    {W(0xaf419847ebf3df78), W(0xe7229d8956cd660d), W(0x0cd622baeb879899),
+     W(0x5fdaee391cab12c7)},
+    0
+  },
+  {
+    {W(0xd87f4ae086653aa8), W(0x327dac318072f08d), W(0x098f37bb0832c416),
+     W(0x0cf804d77a9b6a20)},
+    {W(0x4b9c5438a67e2173), W(0x1cc0d4cea23afa67), W(0x270adcc57148b135),
+     W(0xf9af0acd904d4731)},
+    0
+  },
+  {
+    {W(0xa125e6c1b7ebcb88), W(0x3289e86e10ec0d40), W(0xcc3a5ecb98353869),
+     W(0x734e0d078a2b0d3a)},
+    {W(0xe0d92e9a51933360), W(0xfa6bcdb1786076b9), W(0xd13cca90747f19ec),
+     W(0x61d8209d49f3a53d)},
+    0
+  },
+  {
+    {W(0xad19e039119f6cab), W(0xf15b920fa8dfce56), W(0x8a2627c4851b5bc7),
+     W(0x7c3ff661d8ecca6e)},
+    {W(0xb9dd2bf2d5f5b5bf), W(0x56b76c57baa43b27), W(0xdc8df855fe2f4937),
+     W(0xe95dd9d8889821b2)},
+    0
+  },
+  {
+    {W(0x08e4c4901b620dc4), W(0x55a3bb1ad9699e92), W(0x7890e8d547968833),
+     W(0xbbdbec7d79af29b1)},
+    {W(0x92750de73e51e1bc), W(0x50cf6d11ad91a350), W(0x9dc33392fa67285c),
+     W(0x2cdf7f854480ffe3)},
+    0
+  },
+  {
+    {W(0x87af199e6cc47305), W(0x062afb7c1e314dde), W(0x2be22ba0f3a49fb4),
+     W(0x6ed0b988157b7f56)},
+    {W(0x8162cf502d653fd9), W(0x17d29c64877b7497), W(0xd7e814380f67b514),
+     W(0xfedf1014fe6ee703)},
+    0
+  },
+  {
+    {W(0x14d7251a8c03e3f4), W(0xd71602d5b0e5fe20), W(0x27d2bf4f683b30d1),
+     W(0xe1a8d418f77f10e1)},
+    {W(0xa4941a1e76a0ead7), W(0xff318484da0a4996), W(0xaaf4d4e193394872),
+     W(0xae839cd80e99505c)},
+    0
+  },
+  {
+    {W(0x62ea859803b58b02), W(0x5a71497198a5ea8c), W(0x1783d1b6917e4725),
+     W(0x2d7ca4d8f1e35487)},
+    {W(0x3f69b4d49b4d4324), W(0xda04cc898e17ff54), W(0x5870726c16e3e02a),
+     W(0xaeb9041c69e788c5)},
+    0
+  },
+  {
+    {W(0xaab54cfc93740130), W(0xf72dab6d225733fa), W(0x04b76d2d1ed32559),
+     W(0xa9fe2396bb85b9cb)},
+    {W(0x128b0d24bf2219f0), W(0x2292393b579f3ce2), W(0x51dc5fac145ff0d5),
+     W(0xb16d6af8c3febbc1)},
+    0
+  },
+  {
+    {W(0x36e84bb6dee35b41), W(0x70e9016cdddfd928), W(0x6072a061ae619f28),
+     W(0x15fe6a86904a36cf)},
+    {W(0x9ab6968bf6005965), W(0xfd1c4a970ad602d0), W(0xd0a8879244f403f2),
+     W(0x76759223abe3c14b)},
+    0
+  },
+  {
+    {W(0x45d8fadf89a6b23c), W(0x057dee066fffbbfe), W(0x6dd5757b4774e5e2),
+     W(0xb44267fa47607091)},
+    {W(0xd254ac6fac739807), W(0xb29bea93e4097eac), W(0xde07a886ce2b1765),
+     W(0xa326800a6561e516)},
+    0
+  },
+  {
+    {W(0x44359ac0ee931637), W(0xd7af3ac7bef60c41), W(0xd451e48e5c9a5a00),
+     W(0x879a858ede205114)},
+    {W(0xd32345065cfd0b21), W(0x4d7bea68794a5062), W(0xa4f7b9d729fc3993),
+     W(0xe838260e4e5ea446)},
+    0
+  },
+  {
+    {W(0x97484c32e4d4b063), W(0xbb397e446873506e), W(0x233f2018e0c682b4),
+     W(0xff6bcbc968d12590)},
+    {W(0x97f470fd2357e496), W(0x5c523069bcb4b614), W(0xea33b10eea506661),
+     W(0xc1f96ddf04b09a83)},
+    0
+  },
+  {
+    {W(0x9e57d734c45e9796), W(0x153be80d1ab41bf5), W(0xa3e0c36555031caa),
+     W(0x52cf34eba3294d40)},
+    {W(0x17832c7dff583ebf), W(0xaaf7036866e40faa), W(0x19ffe1c87f4b0fa6),
+     W(0xacb5d3bd9a663404)},
+    0
+  },
+  {
+    {W(0xb7fecb5e72d4ed33), W(0x20a22a805165f53a), W(0x2cc11d879e158e90),
+     W(0x9e9cba4dba2cce03)},
+    {W(0x1bbe8b81a018c44b), W(0xbc42febd20bd77a8), W(0x952b4d839cea765f),
+     W(0x64e5294358c0dbe7)},
+    0
+  },
+  {
+    {W(0x123cd8a509b785f9), W(0x856402511edd29cd), W(0xb60e95ac66e9882a),
+     W(0xf9107ec90f43caaa)},
+    {W(0x8f48fbb98b6601df), W(0x3afdd0f11ceb4b35), W(0x0a804b08f470ceec),
+     W(0x04310217b33d1017)},
+    0
+  },
+  {
+    {W(0xe7319a1604954b44), W(0x039c1b75c154a104), W(0x58a557005a470317),
+     W(0xd3608e5e15e86af3)},
+    {W(0x865b9c5b5925d28d), W(0x92f3bdeb2887e5eb), W(0x9ad29e49646bfa23),
+     W(0x1abf07cae2c90eac)},
+    0
+  },
+  {
+    {W(0x3f21dacbfeee0d22), W(0x38cc5a162867812f), W(0xfb482bb8863b12d5),
+     W(0x4838f777b417b0f3)},
+    {W(0xd0a0163f5403b490), W(0xfed783986e3636a5), W(0xfed128b6c8164faa),
+     W(0xbc0916804ff653a7)},
+    0
+  },
+  {
+    {W(0x99af5cfefe873080), W(0xbb41a9b517edeaf0), W(0x6448d7bdac761ea1),
+     W(0xca5dc1a02219af0a)},
+    {W(0x7508b4d10ba7df53), W(0x4186f17ae51252d8), W(0x009ffd7cae9a0019),
+     W(0x52de55f86b32112d)},
+    0
+  },
+  {
+    {W(0xcab32d59bb31fe40), W(0x875cf0f53893ec5b), W(0x41a4d820a3d14ecc),
+     W(0xcc3023737bb6f782)},
+    {W(0xf40f9faa82e13276), W(0x207de89e8a75c2a6), W(0xa3f2483c9d371c05),
+     W(0x7d5c6592c8588f2a)},
+    0
+  },
+  {
+    {W(0xbfad3818b7c5ae8a), W(0xefc278a4db8ad0a0), W(0x43b83bd7159b6e9f),
+     W(0x0d6905d56096551d)},
+    {W(0xf73cab34323069ef), W(0x80f4ad4b6eada798), W(0x3893d4a8ef04ad92),
+     W(0xa62cfc3fdc7e0d78)},
+    0
+  },
+  {
+    {W(0x02b8ab7500d22061), W(0x6fc8292b00267f28), W(0x892717d7b43d01f6),
+     W(0x0db84b08deab769a)},
+    {W(0x7bce6e253341e324), W(0x8498b3130aed2186), W(0x3c3e759e1e3a8b1e),
+     W(0x413ef0e849e8ecd3)},
+    0
+  },
+  {
+    {W(0x45922aede1b0d9f5), W(0xe3cec6011d52c62f), W(0xd9140c37d2cc8869),
+     W(0xdeac1e2583fe435e)},
+    {W(0xa7f219a5d5065970), W(0x14bfd6e7f6eac893), W(0x1c65b6cf87259935),
+     W(0xf1f815624409735c)},
+    0
+  },
+  {
+    {W(0xa8d342dee31ab219), W(0x58e56c31231b83b7), W(0x588a5ac5357f517d),
+     W(0x9fe3ed111fa78892)},
+    {W(0x7ce350b93a299f46), W(0xb200d300d96ea7b6), W(0x13535f43a2ed141b),
+     W(0x54598b747335dc58)},
+    0
+  },
+  {
+    {W(0xa5cf2f53fae06ebc), W(0x03e53ec1989e4964), W(0xcf850164cbe3f981),
+     W(0x3790d90ab29b5a09)},
+    {W(0xfbdfba2c032f0751), W(0xa7614b52dfab2ec6), W(0x0d6285a1e4812729),
+     W(0x77117650aa964c7a)},
+    0
+  },
+  {
+    {W(0x7370cdcfeb6f06d6), W(0x44aed8c505b860e0), W(0x6fdd5f8a955ce458),
+     W(0xc902d5cb6c25882d)},
+    {W(0xa8a4ec69cfe28f37), W(0x5e025cd92b44ff84), W(0xbcfe87d283b3f249),
+     W(0xef54e3fcf9e8dce7)},
+    0
+  },
+  {
+    {W(0xde2e3b75e4a7de45), W(0x43064b46e031ec7d), W(0x1e4d655a15c4e268),
+     W(0x45f8a63909cdc5ec)},
+    {W(0xf66f0c9cc2fa2cb9), W(0xf3f67cf95a6a27c2), W(0x79ff7c51c64e6eaf),
+     W(0x13a4fb3a128766b5)},
+    0
+  },
+  {
+    {W(0x7c112439562ba952), W(0xd4a7dad431d0a8ce), W(0x6cbe139277f1b401),
+     W(0x8d8a8907d4bd470d)},
+    {W(0x8224fa8f727866ce), W(0x3fb96a11a34a7265), W(0x9f872eadbaf2a7a4),
+     W(0x2734a68e3fd22f28)},
+    0
+  },
+  {
+    {W(0xe91bab76bcc86ad2), W(0xa5403f8b9c9cef95), W(0xb963d4f38f067d12),
+     W(0x5efa9e0f0d2793f6)},
+    {W(0x86b23ba8a76e5e25), W(0xb15bd9e03affc453), W(0xf6c0ad805776542f),
+     W(0x25d026e4145dc30f)},
+    0
+  },
+  {
+    {W(0x25d4d5b50752e7c6), W(0xc3c9dfb325ae272b), W(0x480012da1bc27c04),
+     W(0xcaefff38abd77d0f)},
+    {W(0x95294ff5bf975acb), W(0xda28f6903bd5f9b9), W(0x13e62404489dca02),
+     W(0x9ef2c4917e92271e)},
+    0
+  },
+  {
+    {W(0x4c642278cde85d86), W(0x29cac5da84af5d69), W(0x2cbf3bea9ff7a057),
+     W(0x3ccf314e05a3ed0d)},
+    {W(0x4a2cdbc7483911e2), W(0xd39202155f0a60e7), W(0x4eff5a871a2de65b),
+     W(0x9d3a9565e4f3d2a1)},
+    0
+  },
+  {
+    {W(0x4a2e77a8f43dddcb), W(0xeb62ec3f800a4b6b), W(0xf99c4406fd357099),
+     W(0x293394d37948e690)},
+    {W(0xba27dd7466f61b38), W(0xa5b23d71492b02f9), W(0x1c98d5943ed6bbd2),
+     W(0xec0d43029e46561c)},
+    0
+  },
+  {
+    {W(0xe4e632a472f86362), W(0x1b7672690157eb61), W(0x090dc481cc296977),
+     W(0x5b5eb3a4878085c8)},
+    {W(0x4562fda0ea981b91), W(0x29c5fb70323a1e1c), W(0x497ce7b79ebdac87),
+     W(0xe71b327e45320dd5)},
+    0
+  },
+  {
+    {W(0x029fc41ca24b5f7f), W(0xe94ec19b0801db99), W(0x56be9e05ee43bdae),
+     W(0xe7e3af3f6cad4049)},
+    {W(0xbb294c1967ad20aa), W(0x185ec50795886469), W(0x91bb4adfb4fbd595),
+     W(0xe95f8615820b6d8f)},
+    0
+  },
+  {
+    {W(0x7f3b4dab9f6527ef), W(0xb131b783e02067f8), W(0xe8d5c495bd650082),
+     W(0x6782c95213886452)},
+    {W(0x20645c0bbe9cd781), W(0x50f8b8750ed2c23f), W(0x3984d4d2e0115e04),
+     W(0x3d9083fb7f4ceb38)},
+    0
+  },
+  {
+    {W(0xcda0b99e816307d2), W(0x235b7e71554fc52f), W(0x986131c757c17902),
+     W(0x6e6471be9e06abab)},
+    {W(0x54ed8cb5c3a40c18), W(0xf98adc48b03cdb83), W(0x3b3e520d4e95a091),
+     W(0x04409b44b11f94bb)},
+    0
+  },
+  {
+    {W(0x451eb127f00de2e0), W(0x3801438c66668d24), W(0x3ac0566f68e8eebf),
+     W(0xdf1cc8eb80125e3c)},
+    {W(0x097156c43df7d040), W(0x820b57b8a2de2f0a), W(0x9b06d77b13bf412b),
+     W(0x44063f4f8ba783c7)},
+    0
+  },
+  {
+    {W(0x1abca512c00a3ec5), W(0x2d1ae5bce1ca0151), W(0x1f2283310f9d10a3),
+     W(0xab071efb460caed3)},
+    {W(0x9aa897239c20d689), W(0x78b388a665b9fc54), W(0x2bfcbdd786227be6),
+     W(0x93eee05e46bc72b7)},
+    0
+  },
+  {
+    {W(0x9d5adf6deffd64de), W(0x49b94110f55a405a), W(0xb9cf820598c7af30),
+     W(0x60ae7db922d4f0a6)},
+    {W(0x0d0dcb43c7fdece0), W(0x92862f92b4d00ae4), W(0x63829e08c1060c6b),
+     W(0x02094381461872fc)},
+    0
+  },
+  {
+    {W(0xcbd7accf35fab9ee), W(0x09529f15eacef129), W(0x3efab6a0eb1108c0),
+     W(0x1debe929d4b66f57)},
+    {W(0xe22771d982228ed7), W(0xb5b95f1768f15b7e), W(0x83ef606f45cac02f),
+     W(0x8c4b92fbed6afb93)},
+    0
+  },
+  {
+    {W(0x451421f22aaf72bf), W(0x26761e7c7a9b0027), W(0xeae044e1e2093c60),
+     W(0x5c6e7695b0a990e6)},
+    {W(0xbfd9b953ba0c0a27), W(0x37f44fba68fc836a), W(0xe0f25af16c4d82a6),
+     W(0x4462aeb6aeaa4adf)},
+    0
+  },
+  {
+    {W(0x1db2583523bf16c5), W(0xb5a45e0240abfb92), W(0x16bbb23c02196ebd),
+     W(0xbca934a223495d10)},
+    {W(0x94a3973b97a7a75c), W(0x143518b32d419bcc), W(0xfc0a6b7162ed0ef6),
+     W(0xdf476018e8851937)},
+    0
+  },
+  {
+    {W(0x13832c69662e97da), W(0xcd8ce2b4aa2cd727), W(0x74f2eb8ccf1a7dc0),
+     W(0xf4d7fbbf459a2e53)},
+    {W(0x22753cbb1381e6a4), W(0x4fc9ce29547b8688), W(0x66c734b24cd190e4),
+     W(0x4fb516b9734a973f)},
+    0
+  },
+  {
+    {W(0xa513cb983b07bd14), W(0x76498eff02f03468), W(0x2bb7eb63585137d7),
+     W(0x0466ea7325cc7b23)},
+    {W(0xe01d9523ec7c6299), W(0xbc49f32d41571614), W(0x060ac38e3e74a6fc),
+     W(0x5ed16392001cbaac)},
+    0
+  },
+  {
+    {W(0xe5ca2589f9ff5a7a), W(0x240b3b3a785fa633), W(0x088dc130660d979a),
+     W(0x4b48fe9f2fd3c9ef)},
+    {W(0xf0ab66cf0f986225), W(0xac9b262a22fa0c9d), W(0x8b6b8bad35b878a2),
+     W(0x4c90e8855b895772)},
+    0
+  },
+  {
+    {W(0x250f01c420432815), W(0x1c3b6728b24f29cc), W(0x41abf76113ffe5ec),
+     W(0x84665149fa9d03b8)},
+    {W(0x7c35fa68fb0cbd9f), W(0xacf49f67338a2ffa), W(0xccf2d7dae6f143b3),
+     W(0x09282b4909dd9c6e)},
+    0
+  },
+  {
+    {W(0x350be567c85ab647), W(0x60e10c8687d73937), W(0x79d77d795f87004b),
+     W(0xf5cdf52eb3b8b82f)},
+    {W(0x654ad701064cbbbd), W(0x41387d8ff1a840d2), W(0xa6c5054585ca177e),
+     W(0x75a4de7bbb4b88b4)},
+    0
+  },
+  {
+    {W(0x3a56282911b747eb), W(0xbcb17625d2d249f0), W(0x666acb6e14b47dd9),
+     W(0xecdf63c461eaea54)},
+    {W(0x38ab47f80659f519), W(0x9de92e9c26f1a072), W(0xd570f6614da11b20),
+     W(0x58e417c8ef2d5fcd)},
+    0
+  },
+  {
+    {W(0xa479d917eb6f2dba), W(0x5d1289b7e40b2b70), W(0x6a7d668925e5cb18),
+     W(0x3729037f1bc7d5fb)},
+    {W(0x5fd8c5d2d8cc97b6), W(0x158b57083acaa787), W(0x3e5693ac79c08449),
+     W(0xd0ae7aed159916a5)},
+    0
+  },
+  {
+    {W(0x7dfbb6c0a6df520e), W(0xe39533bb4ddd1e84), W(0xbe25aac1f44653c5),
+     W(0x4b65d579209241f9)},
+    {W(0xedb34f5f8648ad7a), W(0x2674b77eabbda12a), W(0x0989b17423ead44d),
+     W(0xbd0fa4c5c49a183a)},
+    0
+  },
+  {
+    {W(0x716d2c381ac9656d), W(0x3861ac24658c8d98), W(0x705c516ee9250d94),
+     W(0x948ceda6b1571fae)},
+    {W(0x4fc7b2b0db5ee109), W(0xfbc80efc281089b5), W(0x2ba6730f4cd7f66a),
+     W(0x87bcaf9d4d71912b)},
+    0
+  },
+  {
+    {W(0xcdd121a7a4da0512), W(0x4ef507bbaa5303f6), W(0xb84ecd021bbe5f09),
+     W(0xda80bf3c3eda0ed0)},
+    {W(0xe834cf7977207aef), W(0xaca637503f15bf97), W(0x110e4295c3de245a),
+     W(0xf7cc3bd56dd117e0)},
+    0
+  },
+  {
+    {W(0x687cc90c9ebec0d7), W(0xa094af091e29c51b), W(0xb288d3500f5fae25),
+     W(0x85ef1ce3404a9373)},
+    {W(0xa4b6ee055e671536), W(0x7886a321066fcbfc), W(0x6ce84b2f9541e5e1),
+     W(0xdb6eccaf85419d49)},
+    0
+  },
+  {
+    {W(0x928b83f56a7928e3), W(0x9a98ad7498be85a6), W(0x6ab45d6008b33f84),
+     W(0x4bdfc8c269c75813)},
+    {W(0xc25dda94fe42b52b), W(0x52d96987ab58cf4e), W(0x90cd76f5261f4a14),
+     W(0x3958e9f734a8e2d6)},
+    0
+  },
+  {
+    {W(0xf87bc5ad5f28c781), W(0xf1d84a3ac6fa266a), W(0x16a11da19e8b432d),
+     W(0x4882444f6746eb37)},
+    {W(0x5bf07c383c7010fb), W(0xb55d9dbab5a9f97f), W(0x1c0ce37547cd166b),
+     W(0xe0796e9576678b23)},
+    0
+  },
+  {
+    {W(0xbc572366625fcdcf), W(0x99854dccd0125229), W(0x636fed139a845606),
+     W(0x31dcc27c1a32ab23)},
+    {W(0xc1bb6b28d0c74d67), W(0x8cf9f549b7f2db89), W(0x53fa58b2c5973373),
+     W(0xcb4c852a2e55f478)},
+    0
+  },
+  {
+    {W(0xf9f5d6235e0833b4), W(0xc645535a3eec934f), W(0x17dfef4891905168),
+     W(0x73df276609157684)},
+    {W(0x17a22c379e58cc1f), W(0x52b52cdd5508f08d), W(0xe1c4006a8a37b4f5),
+     W(0x693d2fb981e5c936)},
+    0
+  },
+  {
+    {W(0x70ad14e478a414b2), W(0x52b72e920cbaa1d8), W(0x10edd1eab6bb6fdb),
+     W(0x12acba6ffd78c821)},
+    {W(0x8fdb75e81458fa14), W(0xc423d4209dee8c5e), W(0x9a8463f594b6104a),
+     W(0x2fde2be6ccee9be8)},
+    0
+  },
+  {
+    {W(0xd342772ba208937e), W(0x314ab8b270a558cc), W(0xb2b0ecee615717a3),
+     W(0x8d0b9db03dd54a93)},
+    {W(0x15209b1771a6db88), W(0x33c8931c58a1afe7), W(0x79e3b6e4ec4ec6d8),
+     W(0x67efbe60ef1f485d)},
+    0
+  },
+  {
+    {W(0x28f1c5850749f50f), W(0x132386a41e5b1f5b), W(0xab78aec2ba5ff74a),
+     W(0x711754a9e7586d35)},
+    {W(0xc2385603c92d5178), W(0x5bf37c09f346333d), W(0x4207c33a2d8da734),
+     W(0xf1a7ab09f4c09ce8)},
+    0
+  },
+  {
+    {W(0xc481bb9a9c7c0b4a), W(0x026d81beb30f0a99), W(0x41392ad87a1b381b),
+     W(0xd44754a5b15579f6)},
+    {W(0xb02e68377d8f660a), W(0x6add4477dbc8d5b4), W(0x3b4efe824d66bcec),
+     W(0x78964c0109d0dca3)},
+    0
+  },
+  {
+    {W(0xd14a7d4ed85221e5), W(0xe4c19c52bc99037b), W(0x2fc47aa11e9ac3f7),
+     W(0x72ffff6cc750eb1c)},
+    {W(0x85e5c154b5acf60e), W(0x70a430a674ce0518), W(0x7675dc40e5be466a),
+     W(0x04c20577c4dd37c5)},
+    0
+  },
+  {
+    {W(0x1cf4bc889e301ad0), W(0xa7944fb957cb0179), W(0xcc61f9607ec4da1c),
+     W(0x50285056cf7320cd)},
+    {W(0x5f28f104d2915739), W(0xc5455e159924620b), W(0x8af71a68c220710f),
+     W(0xcc37f43f6beeef82)},
+    0
+  },
+  {
+    {W(0x2c19d407951c9dae), W(0x26f6677560b1f6a6), W(0xe28ff62755e0a043),
+     W(0x62a5dd6c6d0a0e81)},
+    {W(0xa7410810a33f4118), W(0xa66dadf9c0eea589), W(0x099acd6994d9dff5),
+     W(0xb163484c4b773ed6)},
+    0
+  },
+  {
+    {W(0xb3626b376a14abf2), W(0xdad486944800400d), W(0xdf0f9eaa420c372c),
+     W(0x66e06bc387c49165)},
+    {W(0xa8ec8d58d43ace09), W(0xc70afa05bd88bdc6), W(0x02c3ea7530406b65),
+     W(0x34d831e2567af8c0)},
+    0
+  },
+  {
+    {W(0xddffb87cd2ea70b4), W(0xa8a308276bfb1c75), W(0x3fc8f84507d345f7),
+     W(0xa3c8220107c99374)},
+    {W(0xe3861a478e52c633), W(0xa3fa73352f93120d), W(0xb86b05b93165ed5c),
+     W(0xc03f5880b306733d)},
+    0
+  },
+  {
+    {W(0x57ab12a3984e3fdc), W(0x239ac554a6f45aa0), W(0x602ad857b33face5),
+     W(0x8b5281c23a403957)},
+    {W(0x94e5c07608eae36a), W(0x6da18f730dc9bc05), W(0x0623fbb15ad7d1cb),
+     W(0x4eeec087883d0a20)},
+    0
+  },
+  {
+    {W(0x89563b16e5eb7376), W(0x66e222f7902e6580), W(0x81b721c8aad80c7f),
+     W(0xcbf9a33475dd4fa6)},
+    {W(0x868c6a6448415259), W(0x3d98f8ae3cb46440), W(0xd1fea41d1cdf5428),
+     W(0xaf04660861baf8ca)},
+    0
+  },
+  {
+    {W(0x8b1ca80abfaaa237), W(0xa50cf163c75f7cdf), W(0xe6b2acc791b00b68),
+     W(0x7228e388634880b1)},
+    {W(0x587ab652445c587e), W(0x6dd44e83d2f8e1b1), W(0x713b2f6eeddc8968),
+     W(0xf726f0528a0a053b)},
+    0
+  },
+  {
+    {W(0xb6eec90dd7ac2b21), W(0x247cba7a8c6d3b2c), W(0x61ed6b9d1d8e3318),
+     W(0x902a5e7d7f736944)},
+    {W(0x1d880838d4192bf2), W(0x23420a8a984ad887), W(0x5c1890f6dc485297),
+     W(0x901ec12c8d708602)},
+    0
+  },
+  {
+    {W(0x73574daa9aafa426), W(0x9947de6d58a4aa0a), W(0x917355bf343f4f94),
+     W(0x40ff8852a0794f94)},
+    {W(0x04a7835ef6b226dc), W(0x93b55bbd1bb763fe), W(0xa3578393e08b0053),
+     W(0x7181a69f82ef44fd)},
+    0
+  },
+  {
+    {W(0x53c55500d5a12003), W(0x159930c6c157fc81), W(0x89a73fb5c90926c8),
+     W(0x9d7f42388b54e950)},
+    {W(0x37c3e7616d95d509), W(0x323da0a871d5a1a1), W(0xb4ddbc782b9cce10),
+     W(0x2b585aed6f4b006a)},
+    0
+  },
+  {
+    {W(0x97dc759973ee3a46), W(0x37772bd58cb5a5be), W(0x85a3f3a483a17e4a),
+     W(0xfb4941415324b823)},
+    {W(0x672a65542cf3d3d9), W(0x7d10aabc28ca9ca5), W(0xf7b308e923c80c39),
+     W(0x62667900cb32e3fd)},
+    0
+  },
+  {
+    {W(0xe111f348c06526e3), W(0x03a1b36d48c557c1), W(0x75100ef697e0fa40),
+     W(0x5aab7f880a0da5f9)},
+    {W(0x08f5bab01dea81eb), W(0x8d834fb052309bef), W(0xc0acdfc5134422d5),
+     W(0xb7b5e68517df49ae)},
+    0
+  },
+  {
+    {W(0x2be805298b669f5c), W(0x2413095dc3381e17), W(0x0065bc7dc41d5df3),
+     W(0x4956c53981fcf418)},
+    {W(0x8c0bbb286a8d8ade), W(0x45bbb9b7d06205b2), W(0xbceefe86f023fd60),
+     W(0x8925131b8a9b9db5)},
+    0
+  },
+  {
+    {W(0x6a627dddb07d1121), W(0x54b2138485422143), W(0xce0cf46d46fac519),
+     W(0xcfd040955b88e720)},
+    {W(0x057de43c8f5c5358), W(0xa840edb55a210d38), W(0x1bd797cef614f744),
+     W(0xeca274a8df179dfa)},
+    0
+  },
+  {
+    {W(0xbff5fe52f84091ed), W(0x90e8cad7d197b71f), W(0xb97b8523564aa4e7),
+     W(0x453c79173d3b8d45)},
+    {W(0xbfd43b90fbfdf621), W(0xcfc46a579a597b57), W(0x97458629ca251b9e),
+     W(0x2441ee53917ee624)},
+    0
+  },
+  {
+    {W(0x667027d0343d4e8f), W(0x263f030f1e843bfc), W(0x84c45b9211e6234f),
+     W(0xccca0dd327c7ef95)},
+    {W(0x9ddeead776f09514), W(0xbe8b495e1eb2f602), W(0x5b0b101bac8c8c53),
+     W(0x87c7f15fe32d1d7f)},
+    0
+  },
+  {
+    {W(0xd1c91f1c120dce7d), W(0x8d4391b617218941), W(0x74258a8124e35c36),
+     W(0x629ed75e5cd9f70a)},
+    {W(0xf03c6819bf8ca726), W(0xaba5edbe18532ea5), W(0xe2f29fc6c18dde73),
+     W(0xfa7804a77ee39b11)},
+    0
+  },
+  {
+    {W(0x3c51b9caa763b25b), W(0x88eb9b02d07d92f4), W(0xa5ddbf091b0ea795),
+     W(0x8b3b75f504b324b2)},
+    {W(0xbd41110447d614cf), W(0x28d1c54ce5a9fc16), W(0xb277c8501b8a9c3d),
+     W(0x1cb5b8c0ae5431a3)},
+    0
+  },
+  {
+    {W(0x1260cb930f070a59), W(0xafdbfe9c97723bee), W(0xbfdcd7753902e0fe),
+     W(0xa7aecb4e60176fc8)},
+    {W(0x34b9a600823375e6), W(0xbfb0f943fece1c15), W(0x412f85101a5003e2),
+     W(0xca27e53742455463)},
+    0
+  },
+  {
+    {W(0xb523048577e0d21f), W(0x8dd6117b87b9eef5), W(0xac61460041df09d8),
+     W(0x2112edff7abbb4b5)},
+    {W(0x457faa3766dace75), W(0x381a0681c3c6c67e), W(0x059e5c3ef6d0c516),
+     W(0x322eafd3ab8c1e50)},
+    0
+  },
+  {
+    {W(0x64936cef01950ca4), W(0xb606b5a30283bb54), W(0x04f371a290cd4da8),
+     W(0x17abab5af48dcd72)},
+    {W(0x23f2f36ba752bcb4), W(0x81cefb8d36da7945), W(0x0619ae5ef449bf09),
+     W(0xa48a3cc5c6882832)},
+    0
+  },
+  {
+    {W(0x3d058ae32625a68e), W(0xd7ddc4dc77e99bef), W(0x5db4d57f6e746650),
+     W(0xa32987a4d39a5f74)},
+    {W(0x47fd19d729bc4c40), W(0x2645c43512c31d00), W(0x7a9716896e532ef8),
+     W(0x4041bd2ec902afe6)},
+    0
+  },
+  {
+    {W(0x76991a74be462c16), W(0x525482e759e515c0), W(0x6e67df1dab618489),
+     W(0xe5cbf3f81b41cbcb)},
+    {W(0x65999e5a10332942), W(0x6b1520021436d1b1), W(0x570dc394aaa681b1),
+     W(0x27958efd43180913)},
+    0
+  },
+  {
+    {W(0xb69d5f55cf882120), W(0x834d36fcac18c090), W(0xd1d84d2fabc18a7b),
+     W(0x61c4f772955d0b0b)},
+    {W(0x7412b01ccf43e231), W(0x1a159c3b341ebdc9), W(0x615b07f796cea622),
+     W(0x7fda67f39cdf8a8f)},
+    0
+  },
+  {
+    {W(0x2df216f3d41e53a9), W(0x75be7b7ba97a56bc), W(0x8d51bfbf284a754f),
+     W(0xf1b06e389fc1c700)},
+    {W(0xdd8df02d92087b87), W(0x4c02e0854d050290), W(0xea0536fc122e2d30),
+     W(0x7a56523e3d65568d)},
+    0
+  },
+  {
+    {W(0x31bdebb2c57c402d), W(0x1b0e700c3ece3319), W(0x24a27ce7b49ece2a),
+     W(0x59fff4fb3198076f)},
+    {W(0xd55b028978b7dba6), W(0x9702990a2b9c4c64), W(0x2b9f62359a9c90d6),
+     W(0xa413675e757b9775)},
+    0
+  },
+  {
+    {W(0x4e81e867b9af7ffc), W(0x7eb81fe35aeb17d6), W(0x6ed6beb6e2d937d3),
+     W(0x53cac5ce0c05c726)},
+    {W(0xcc18782ce53c2bb3), W(0x1f9d79c580224531), W(0xe11afabe06dda1ed),
+     W(0x3fd686e4a34b1ed6)},
+    0
+  },
+  {
+    {W(0x84a6a3d0d6b4fe23), W(0xb4835d4672296d3e), W(0x272e470b94bf0e09),
+     W(0x8bcbef5f6d80f73c)},
+    {W(0xd994b92a8296a838), W(0xb155a2ba7a75a985), W(0xfc88f792bff4f908),
+     W(0x340b4d8ed3028f54)},
+    0
+  },
+  {
+    {W(0x41531477b0f9f08a), W(0xdb6179d50f92513b), W(0xf7053928e4349b71),
+     W(0x790e4e4fa82a5d0f)},
+    {W(0x30adde2a5de1c9ef), W(0xb35f4924fc1c3afb), W(0x3b2b82a4174e01d3),
+     W(0x6567036edf0c5767)},
+    0
+  },
+  {
+    {W(0xe99b78b7a9e04823), W(0xe733db85eb74078d), W(0x8fa1dad937780396),
+     W(0x51cf329864935a25)},
+    {W(0x46988f609e4e6194), W(0xd569903de3481168), W(0x71a380d3e0e825cc),
+     W(0x6ab53205c21af31b)},
+    0
+  },
+  {
+    {W(0x3a7150c44e939a62), W(0x698f8bddf1a54ad8), W(0x439931aadbf08abb),
+     W(0xfce309b7c24ed6d3)},
+    {W(0x299ec09791ef6564), W(0xc64ff18ccd0b97d8), W(0x08ca3ba644c277b6),
+     W(0xe048a7f63125296d)},
+    0
+  },
+  {
+    {W(0x2b193ac85d0cd878), W(0x9ace118b586ae112), W(0x06fceba2c647cfa8),
+     W(0xa87a70ad666b1e78)},
+    {W(0x77ed69d37f0aeaf5), W(0x50f321d966d016b4), W(0x63463fa56afafb96),
+     W(0xe04fb28ffe7f3e1a)},
+    0
+  },
+  {
+    {W(0x84d753bd9995ffcb), W(0xe038f51cd5e43bf3), W(0x33439d4391e6e15b),
+     W(0xa722d6de7356b477)},
+    {W(0x727a4fa8a09e0ca4), W(0x593cf9a2c4d74f34), W(0x696a0cc605adafda),
+     W(0xcf53b4dbd7fcfd40)},
+    0
+  },
+  {
+    {W(0xa521291496bd45b4), W(0xcdb96f5078d5f76d), W(0xd7d5a84a4af0e31e),
+     W(0x42e70717939a8b75)},
+    {W(0x69137c7279782ef7), W(0x405ebe3bea9a6504), W(0xb50037a07d50e4d4),
+     W(0xd7c8d4e3d8197f6d)},
+    0
+  },
+  {
+    {W(0x6209475fde097b9f), W(0x86ecc1f725fd3cec), W(0x8d7d9084e7f393a9),
+     W(0x8ef65fa229411a01)},
+    {W(0x8f746ab9425fe300), W(0x95f02495f5246328), W(0x206f8e0a158d3dc0),
+     W(0x0355cff9b9c6df0f)},
+    0
+  },
+  {
+    {W(0x0ebee9529d19cbb0), W(0x4a7438eeca3ed438), W(0x49b4cdd8de8b4af2),
+     W(0xd574e7385da2877b)},
+    {W(0x3cb838ae74108153), W(0xb377f34cbb0a2ac0), W(0x9ac9f24576ffaefd),
+     W(0x9ffcbef1de34eb67)},
+    0
+  },
+  {
+    {W(0xfaf2c8c8dff4e4dc), W(0x785ebb70377e1bc2), W(0xe2984b04b7fe14e0),
+     W(0x02f373d93f91d307)},
+    {W(0x04744cb9f5ca0985), W(0xadf364861756bc7e), W(0xeee8a617653a2363),
+     W(0x016273c32b347066)},
+    0
+  },
+  {
+    {W(0xf047c1cae8d79c5a), W(0x75b4110724949495), W(0xfc8832ce8a6317a1),
+     W(0x877ecb1f81090924)},
+    {W(0xdfbbbce5cc0ae8c8), W(0x867c4b1e2c77c3ce), W(0xf2dfcc3782757770),
+     W(0xb7335d7db35eb5b0)},
+    0
+  },
+  {
+    {W(0xd5c4e870d4db628e), W(0x2584f7a422f50da5), W(0x1c5b2f9268cc2105),
+     W(0x91747e441fe68454)},
+    {W(0x89cbbe459ebe0fbb), W(0xa6567334d1bf4df9), W(0xd9d8a6fa701593d1),
+     W(0x34de3445a1cc1350)},
+    0
+  },
+  {
+    {W(0x331e9a1399721da1), W(0xab48c677f6eb9c2e), W(0xeff9c2e51103c239),
+     W(0xd4a29ad1f04497d0)},
+    {W(0x69058e8cebdb093a), W(0xec1243e4d6a81da4), W(0xd9615651b4036e27),
+     W(0xb8983a5762bd0368)},
+    0
+  },
+  {
+    {W(0x7373d43feea92463), W(0x1d190b8d9a574c26), W(0xfff03aca2229d6fb),
+     W(0xa356fdaa383d41cd)},
+    {W(0x1858bcf4e399bbc0), W(0x32e67354066211dc), W(0x4a801b4fda580a72),
+     W(0xaacd689ecefd4947)},
+    0
+  },
+  {
+    {W(0xd4389299f7674569), W(0xc939f7769f42ec44), W(0x103c61dad3ed9406),
+     W(0xf6e09a0f2dc78cb5)},
+    {W(0x545ccb80688fdeed), W(0x80d33335dad06d5e), W(0xdfa886efb5d78a50),
+     W(0xd1d87b1885df4471)},
+    0
+  },
+  {
+    {W(0x5b372794f8d97a21), W(0xa029d697744cd0bb), W(0xc82062ef7cd5a1a0),
+     W(0x6fd388236be64fc2)},
+    {W(0xe3dc61a57242fe93), W(0x5ea182325ea1fb4a), W(0x233d8d7b286d1d45),
+     W(0x424cf174c47adb91)},
+    0
+  },
+  {
+    {W(0xd333d7bf47cdc6d7), W(0xd732134903390176), W(0xed38807d693a5443),
+     W(0x760b775d54ee86b7)},
+    {W(0xeba9ab6fa0fe9684), W(0xbdd4b10207bf9741), W(0x2e63f31e4ef8bd76),
+     W(0x293c47c5faa0e787)},
+    0
+  },
+  {
+    {W(0x34ce32e936836a3d), W(0xfc4e6b0648b4a016), W(0xc0a8209ab723a7e4),
+     W(0x0b40a6ee9856a28e)},
+    {W(0xadb8ad9684f2df64), W(0x5072cadb9123cfe0), W(0xeccce05dfd220707),
+     W(0x5fac790b0a621fef)},
+    0
+  },
+  {
+    {W(0x6189867b4dc3dd5e), W(0x1bad041aaadf6f49), W(0x17951ac80b015908),
+     W(0x2994ec07b5b5f5bf)},
+    {W(0xf721e522a0c21981), W(0xb0c7f4fefc2a62b9), W(0x8ac7eb5b048b9a97),
+     W(0x7981c9a08363dc17)},
+    0
+  },
+  {
+    {W(0x7a2a0aef8b9ef3b0), W(0x5061d6d231efd764), W(0x4afae8330cc708ce),
+     W(0xf5480b7abd4c4b3a)},
+    {W(0xe197b71469a18260), W(0x549c30dc0e50ea22), W(0x4faf112857f08041),
+     W(0xb28763aedba113d7)},
+    0
+  },
+  {
+    {W(0xa94b2a0d1d5c6ebd), W(0x6a9273aaf41513b1), W(0x37cf6d7a73053107),
+     W(0xdf4c13422cf15c07)},
+    {W(0x760343e74b51c2fa), W(0xfd2e3b923a87e9e9), W(0x1ec58c3333835ca6),
+     W(0xe52ebda984ba9aa6)},
+    0
+  },
+  {
+    {W(0x67529b36903e6f23), W(0x6084d81d9195b6e4), W(0x6e4fc985566c27eb),
+     W(0x70548c0b82f5fc59)},
+    {W(0x70f960f0bd316017), W(0x56ef815d725705d9), W(0x2370ea9aac4d06fb),
+     W(0xf0c2f61798686c95)},
+    0
+  },
+  {
+    {W(0x9c8c77e58e11a6b6), W(0x51cf0cbacdfd8063), W(0xeb855f5031329294),
+     W(0xef6459f9e1a61e6d)},
+    {W(0xd7639869b284db18), W(0x171741ff91585724), W(0x05232d3de968a40f),
+     W(0xa986a39af0cf6aa5)},
+    0
+  },
+  {
+    {W(0x0b5d0aa1b0c3a6a4), W(0x0c60352a0252bcee), W(0x7d9231927565fae5),
+     W(0x46c8a00a452cb814)},
+    {W(0x1cbc6cd270a7b1df), W(0x5aa88ac4737674ed), W(0xa798c61800ff9f71),
+     W(0x558ce1449a47aa38)},
+    0
+  },
+  {
+    {W(0x71d340fe1ca582c2), W(0x8cf428c223b9cb18), W(0xd3df2460e35fdc36),
+     W(0x58f6631734ec5e9c)},
+    {W(0xdbb6141f6494e3ef), W(0x499bb8a2de57a1e0), W(0x3080f99e8a905165),
+     W(0xa9c943580da87d28)},
+    0
+  },
+  {
+    {W(0xd8e49ad381bea931), W(0xb65b347270480be7), W(0xed2f4e0d6d66dcd9),
+     W(0x342f9a49742aa274)},
+    {W(0x34404741d65121cc), W(0x94a77299a7dc92c6), W(0x1912e4a50eb3aab4),
+     W(0xbc1c0d5577a07ad7)},
+    0
+  },
+  {
+    {W(0xef3905f97866a372), W(0x91f17eb26ce376ee), W(0x2117c47f49efbdba),
+     W(0xfd6d30a4fa29da28)},
+    {W(0x239838e078694bc2), W(0x39b6092e34fd110e), W(0x6ccac5f80c0d907c),
+     W(0x1c0a811e5f4044e2)},
+    0
+  },
+  {
+    {W(0x832b7b3715c8c9c8), W(0x095ded1dc9da3ba2), W(0x6878c19a3cd80d08),
+     W(0x0bd1c2de94a9374a)},
+    {W(0x93a31be272c73c52), W(0xb93451c3063dae23), W(0xc81ecdae2926c600),
+     W(0xade66d104b6461e5)},
+    0
+  },
+  {
+    {W(0x19cb790f6e3bd857), W(0x47d170d646f43caf), W(0xf45804878274261d),
+     W(0xcefae94bf8978033)},
+    {W(0xf768a0667876179e), W(0x42164f68b66e6d9a), W(0xeb396d4ece230e10),
+     W(0xa84b62483df8e533)},
+    0
+  },
+  {
+    {W(0xb9945d32b84f9ca1), W(0x412f72127d8d236d), W(0xeed2119f8ad3f050),
+     W(0x94315bb868a20e5d)},
+    {W(0xcffc4d53e3bfd88d), W(0x07f333326acbd39a), W(0xb51fef44f09c9904),
+     W(0xa0ea8db462fa18ad)},
+    0
+  },
+  {
+    {W(0x7bc47f9983953748), W(0xc9339f40af136ed4), W(0x69c366c71d48b6e4),
+     W(0x506aa4f8bbb3e5ad)},
+    {W(0x21da09d92fd6cba9), W(0x12ff9d8651e375c8), W(0xa8f4a573d2d76221),
+     W(0x6e70cd69f074bcb2)},
+    0
+  },
+  {
+    {W(0x8f5fbe31ca70481f), W(0xe9a96b088f7a4ff9), W(0xeb07edcf23e8acf1),
+     W(0xaf003678d381c0e0)},
+    {W(0xf3bf1cb8a621dcfa), W(0x69681992b87919ea), W(0x151b58b5da00205d),
+     W(0xe93824438d63c287)},
+    0
+  },
+  {
+    {W(0x77d48b3c9c89f591), W(0x81e05ccdf75b86bb), W(0xb3ba55d6bc203656),
+     W(0x87a0f8b326ba88d8)},
+    {W(0x74aa1f46ef8208e6), W(0xf1388e656f173628), W(0x51c24bcd6bfe18e5),
+     W(0x70dc87025a3d069a)},
+    0
+  },
+  {
+    {W(0x2f411fb8397f4686), W(0xb58fa5c8d2ae0ca2), W(0x87c463e1adea5e22),
+     W(0x95ae4ae2f713b8a9)},
+    {W(0x91725b2cec99a575), W(0xbe2387d8e1e1da74), W(0x044129d9b13894d6),
+     W(0xc806d40713d722d6)},
+    0
+  },
+  {
+    {W(0x2b8b06ac17b7a5c8), W(0xf32d9f5e50c404ea), W(0x8224d81bd7cbc817),
+     W(0xd2d608c0a576d9be)},
+    {W(0x0cf635847202aad1), W(0xb88e701d236ca1fc), W(0xc49805db41610201),
+     W(0x4e115578bdbc7d7c)},
+    0
+  },
+  {
+    {W(0xe5a28270403aa367), W(0xe506d28c6df98248), W(0x9f4841d536bd37a6),
+     W(0x82d3242a07c0983a)},
+    {W(0x5380dd8bad660fc0), W(0x92d8a38963325645), W(0x6b7df96482ba9586),
+     W(0x5d5c333440d05303)},
+    0
+  },
+  {
+    {W(0xf3d117f6838a6891), W(0x4e05178e19b0e9a4), W(0x3e8b89b57cb31b57),
+     W(0xce2f1057f4ae9154)},
+    {W(0x8f8f8a87f74aba59), W(0xa202a56aad09925a), W(0x0a46abd0942d0af6),
+     W(0x6604b72e70ffbf94)},
+    0
+  },
+  {
+    {W(0x4671c97bd42f88df), W(0x5ec6c6eec834eeb2), W(0x52cc2c24923c2675),
+     W(0x67424a95824340fa)},
+    {W(0x76b9fd506ac0ba9a), W(0x768323c2d1dbda9f), W(0x45addce9c2ec3802),
+     W(0x79a13336c62d65cf)},
+    0
+  },
+  {
+    {W(0x0f9e2c1b0e14e5e7), W(0x55c66a2b03f93e8c), W(0x082e53f468b56652),
+     W(0x635d059ef178f222)},
+    {W(0x712939718a3b1cac), W(0x1d31a4074cf95037), W(0xf979c366f23ee6a8),
+     W(0x56d166af77b54e92)},
+    0
+  },
+  {
+    {W(0x2ab3a311c61c4775), W(0x1ebea7c4d1054deb), W(0x08ae54e4801fd0f5),
+     W(0x95a5a87e39fb811a)},
+    {W(0x46d92f505fa1ada6), W(0xcd3001d4efdb815d), W(0x4501d52dad3a9b48),
+     W(0xe8903b373e441f1a)},
+    0
+  },
+  {
+    {W(0x61a8b2fa1dc5eee4), W(0x53dc06fae9acb571), W(0xf03aff5a379bc3e1),
+     W(0x2bb0a7623d93b5ba)},
+    {W(0x938423eb30f6d3c9), W(0x56fdb5d7e128fdee), W(0xae51853b41e90625),
+     W(0xebfa79c60dd895c1)},
+    0
+  },
+  {
+    {W(0x71e457f7e6052c6f), W(0x1262616778c1bc2c), W(0x8b4e5988a7ac14b6),
+     W(0xebeaf14f4a87c546)},
+    {W(0x06a5ea7800708f99), W(0x89908bc3fe3ccbce), W(0x45b2ccc2c5148753),
+     W(0xacb23034303e8818)},
+    0
+  },
+  {
+    {W(0x519c0b6c40c26aea), W(0xe4ee79184cb26b41), W(0xd89e49031b1ffe85),
+     W(0x44fd6d97b2d7a286)},
+    {W(0x64422b3def50b173), W(0xe7955de760184ced), W(0x959a472f13fd171b),
+     W(0xf5c7bcedb88c539a)},
+    0
+  },
+  {
+    {W(0x0f6883bb44a013cc), W(0x2066a416c958ddb5), W(0xaec95e0be3ff9530),
+     W(0x8239ad90fe34e326)},
+    {W(0xe0113315b55d67a6), W(0x476f72197137a153), W(0x6e7eee908caf9bcb),
+     W(0xc685521ee6384fd5)},
+    0
+  },
+  {
+    {W(0xcdfa99cd33139944), W(0xd5e15b96df8e9a95), W(0x43139ae9257cb8aa),
+     W(0xe8a4a7fdb227d5e5)},
+    {W(0xa9aafffe3f2396b0), W(0x90082981642c43e9), W(0x83cadbc1935fc40c),
+     W(0x524e30996622852a)},
+    0
+  },
+  {
+    {W(0x7f4079b060f54881), W(0xff5e68d99f73ade2), W(0x3c33bd790919bbd3),
+     W(0xc36d3c4eb7bdac33)},
+    {W(0x78351343838242a0), W(0x17a235e38aa5775c), W(0xb087afde0cf43cf5),
+     W(0x5bc6e3cd9c161293)},
+    0
+  },
+  {
+    {W(0x778b3a26e8746691), W(0x58825a25152382e4), W(0x0da78dd63bce1f92),
+     W(0xbde5163a21ddec51)},
+    {W(0xf01e7b2107579ba6), W(0xa335e00dc276d0dd), W(0xc16d7d5168a200ff),
+     W(0x79c52a08e2519839)},
+    0
+  },
+  {
+    {W(0x8c27615649700dc5), W(0x0e2c985bfe7067fc), W(0xb663d952d1e69151),
+     W(0x6c4d1343c9ae77a2)},
+    {W(0x540c58ac4a878065), W(0xb9087f225d6ef738), W(0xbd29b280d42b31c7),
+     W(0x03e1e5398dc6de01)},
+    0
+  },
+  {
+    {W(0x789e5ab4e182cadb), W(0xd988af4e3d5fbf46), W(0xa0682722945177ad),
+     W(0x9f89465090a513c0)},
+    {W(0x472d3f755985d899), W(0x5c02e79d217c6528), W(0xb19215c52c06c6e1),
+     W(0xb241d05e42a5358f)},
+    0
+  },
+  {
+    {W(0x626574049bdc52a4), W(0x786ca8651679966d), W(0x760c2aebdfaf0039),
+     W(0x87db89b34acb56cd)},
+    {W(0xf2234413dae404b4), W(0x0ea77af6b4efaa74), W(0xa45b7464f704dfaf),
+     W(0x2a1dca9be8b9ab5d)},
+    0
+  },
+  {
+    {W(0xc86d1f61137ee583), W(0x050b1962277b55ba), W(0x159c5c0caaa207bb),
+     W(0x965dca7c8cb7629d)},
+    {W(0xe43b2d3055c80622), W(0x0ab4e7708b7003ff), W(0xacee370734d973ca),
+     W(0x78432261cee243e7)},
+    0
+  },
+  {
+    {W(0xeeb76c1ddabce91d), W(0x23d3ef2ba457fbde), W(0x77575db5443ab355),
+     W(0x152c80092de0d3b7)},
+    {W(0x6329b2c1e73820e0), W(0xeed70503e754c4ba), W(0x3c4e6fd25b339e55),
+     W(0x8d8995d8708213bc)},
+    0
+  },
+  {
+    {W(0xb00f74f5e6ceb529), W(0xe6eddd6f2c5a9f92), W(0xe0217991fb89b059),
+     W(0xae32763262d6e45f)},
+    {W(0xdb903af12af19a84), W(0x646410eaf04d3799), W(0xae0fea6a2d8d51bf),
+     W(0xc1ba1350ec5dd640)},
+    0
+  },
+  {
+    {W(0xe190c004248d4473), W(0x7137fe2c678c7bf7), W(0x971498dc6a36801c),
+     W(0x49ba9f0eb6f74c10)},
+    {W(0x7214dec907af9cf3), W(0xb9cd15a6a8d1bce6), W(0x80c2852bae42e4d5),
+     W(0xf21ebd93fa36060a)},
+    0
+  },
+  {
+    {W(0x921e22a6eb688007), W(0x5212729f8c72137d), W(0x4ca8945dbca8d4cb),
+     W(0x1ebf3d3dbe55624d)},
+    {W(0x18e95bbfea4eddd9), W(0x460ffa373f7c3b8f), W(0x841d4d0071a00ad9),
+     W(0xf215340e38f7a90a)},
+    0
+  },
+  {
+    {W(0x08ff5a112250e054), W(0xe27df21486264f17), W(0xdb38685d9982c58a),
+     W(0xfc6a12a9ddc5b534)},
+    {W(0x600ac0220b45cecd), W(0xa3d24ef0a821deb8), W(0xd065c25f8635f5d7),
+     W(0xdf2579c6b3e06d66)},
+    0
+  },
+  {
+    {W(0x96ecf3d4371b5afa), W(0x76afabb1d8f7a0d0), W(0xda79b21b488a6c93),
+     W(0x7bf04448d899155f)},
+    {W(0x80e8603e7c6a22af), W(0x77f78cb567bf4140), W(0x004ae1e2a8e3aacc),
+     W(0xb375ecac5fe735f7)},
+    0
+  },
+  {
+    {W(0xdd5ccb6a629a40c1), W(0xd5821eaef86ef418), W(0x4c609599b40ecf3a),
+     W(0x4b50b25f2e147139)},
+    {W(0x8e321d17144779ba), W(0xf679f235ca4c0eb5), W(0x07f1f2cedbf44421),
+     W(0x7c791be2bfdcbd46)},
+    0
+  },
+  {
+    {W(0x4f89e9cd54adb961), W(0xbed09c4bc781edb1), W(0x6af6060a29a479d0),
+     W(0xce0daefd7cf7c80f)},
+    {W(0xb33aa4b1967311ae), W(0x1043778adf2e0be1), W(0xf4ca62887fa83392),
+     W(0x36bbdfa0e0bf4422)},
+    0
+  },
+  {
+    {W(0xec2d16a23ad03c6e), W(0x3374d2762bde0ce4), W(0x77c581ec93749106),
+     W(0x4ccd267377f83f12)},
+    {W(0xe603a114c921efda), W(0x17448a3d0ea7fdcc), W(0x6c4edad11f095fe6),
+     W(0x8c4cfdadf398004c)},
+    0
+  },
+  {
+    {W(0xe8bdd72b11a47b23), W(0xf8b63e599fd472c2), W(0x7147edc4acf62298),
+     W(0x7b3d079002740962)},
+    {W(0x341a72b962807586), W(0xe66a6612fdad6044), W(0xd0362efcc349de51),
+     W(0x22d26ea2bf48616a)},
+    0
+  },
+  {
+    {W(0x15fec0ae929897be), W(0x6fe2c98be2caab2f), W(0x9b4f1341de23410e),
+     W(0xeb2af721f2de67ba)},
+    {W(0xf5622ec455247408), W(0x6783eb1dca16289b), W(0xa8d4701c675b99ae),
+     W(0xadec5058f145baf9)},
+    0
+  },
+  {
+    {W(0x324e849df66ebaa7), W(0xe5db269b16332ba4), W(0x17b33294d33e5e70),
+     W(0x05cce103792fdcbc)},
+    {W(0xb303f851a168f7f6), W(0x50d866651e6afd1e), W(0x66a1ffef9c92eba1),
+     W(0x0f4ae27fffa06474)},
+    0
+  },
+  {
+    {W(0xc55352909f86c9ee), W(0xd5404644d891c5a4), W(0xadad425e8a336499),
+     W(0x8f6a04f9d9dbded3)},
+    {W(0xd28d3b6f3a4bac89), W(0x88f840f4fdd87662), W(0xc36a1a191d6443a6),
+     W(0xe48672d516b46523)},
+    0
+  },
+  {
+    {W(0x8d11b474c54fae86), W(0x4f565d35d6bcf107), W(0x8d3f451f256ff51e),
+     W(0xe533ffa55c10b3e2)},
+    {W(0x94c4dd82cf818791), W(0xfe9a4445c74cdc45), W(0x786157d9d78161ac),
+     W(0x298932d6d3449684)},
+    0
+  },
+  {
+    {W(0xea20ebdcfbd0a481), W(0xf2a7d1b42af830a2), W(0x65d0267f1010b2e5),
+     W(0x90d0cec61e667780)},
+    {W(0xf90ed0e2094b2211), W(0xedb38d7aaf9c14ec), W(0xcf95061dd813df2e),
+     W(0x31b6a72056e75a00)},
+    0
+  },
+  {
+    {W(0x2f9032cc0b4634a7), W(0xc8c7b9c4888ed5fa), W(0xb60125595d324376),
+     W(0x3c1940bf25de0ad6)},
+    {W(0x92625f90c3d3b572), W(0x012e7809926762ca), W(0x3f6834f1fa7db4a5),
+     W(0xe0d1af00a74f518d)},
+    0
+  },
+  {
+    {W(0x60d3e915608b49b9), W(0xc3e4f6cc12447606), W(0xcf5052405ae7c19b),
+     W(0xe3e2ea293ac81eed)},
+    {W(0x93d62f92063e1db2), W(0x1992393c31834625), W(0x13eedd9127039556),
+     W(0x1807a9450fa4383f)},
+    0
+  },
+  {
+    {W(0xbca91e697ad47961), W(0xb81412e7a639f646), W(0x8bc6ffe42ebb182e),
+     W(0xe4ecc00761343fec)},
+    {W(0x6dc253884c91d11c), W(0xd00dce102b7fb947), W(0x3ac5509437114d4d),
+     W(0xb115208b4dfbfaaf)},
+    0
+  },
+  {
+    {W(0x53267f1c5186eb08), W(0x40570b74a654f282), W(0x4b6ecde9f1d94e36),
+     W(0x6b229f3df492457d)},
+    {W(0x86611f6d15787bfc), W(0xc7aa008a6c1dd320), W(0xa30fd55f5a65ec3a),
+     W(0x3f5df13ac68d0045)},
+    0
+  },
+  {
+    {W(0xa40f43ce68bb0353), W(0xd598c61228941e96), W(0xc5eacf5fe0b88d7d),
+     W(0x0ef52321dad0bd70)},
+    {W(0x67120bc4a8ac2fcf), W(0x34d70bcc3b528bc5), W(0x4d646cd2d6d0662f),
+     W(0x6306572b1f7e7940)},
+    0
+  },
+  {
+    {W(0x80f085e5b11c5070), W(0xbb877e044c02fe9f), W(0xfb5e508ed15f3ef8),
+     W(0x653ada5a37a1e502)},
+    {W(0xb7a763c1b90b4e4a), W(0x55fbbd3c3c488898), W(0xdf62e8482ab18bef),
+     W(0x0e816f86ea89d76d)},
+    0
+  },
+  {
+    {W(0xc12ae3e45cff326a), W(0x8c3219b1353b6299), W(0x1094b9836a236fa1),
+     W(0x6085c0c76f4327e3)},
+    {W(0x92a1aaaeae333037), W(0xec10fb1e8c479574), W(0xa7c41e8ad33d4a06),
+     W(0x7a6350c1002151a6)},
+    0
+  },
+  {
+    {W(0xdce64124afc81178), W(0xf5801b67799fbb0f), W(0xe7fd99f84561396e),
+     W(0x05a86cc01d413f0f)},
+    {W(0x7c277496d068a51a), W(0x98d50314770bc8da), W(0x744b5f73e1bec038),
+     W(0xff9bc2368d94b0d1)},
+    0
+  },
+  {
+    {W(0x9e44d9a33bbb47ef), W(0x23843111349c57b8), W(0xf04375b215f6c0cc),
+     W(0x9e944697dfd9d821)},
+    {W(0x084ebc938cd26365), W(0xce198b1a58278a8e), W(0xea2822ecf675bc4e),
+     W(0xbf903a57b6ffa400)},
+    0
+  },
+  {
+    {W(0xf3fcf971b882d803), W(0x6189b27cbde419d3), W(0xefd1054ac258027a),
+     W(0xc931022f83f72fe9)},
+    {W(0xb4b1d5423496ed69), W(0xcc8329b258df378e), W(0xfa3b948f228f9890),
+     W(0xfa2f1632ce311b18)},
+    0
+  },
+  {
+    {W(0x57608e77a104b310), W(0x8d1909122ca5ccc5), W(0x06bae9ec2398facc),
+     W(0x388dd67095172f46)},
+    {W(0x923375d72190661b), W(0xa0aa542421bd30b3), W(0x3e243b616b6fba17),
+     W(0x4150679d8a5613f3)},
+    0
+  },
+  {
+    {W(0x24633565f510111d), W(0xed4946e67adf0813), W(0x7d6cd6a325fa179d),
+     W(0x6527a08ba4b08235)},
+    {W(0x6bf6b1a1f8cdc370), W(0x9dbfc3cf39cdfa8d), W(0x8c4dfe7019036700),
+     W(0x0cf326120e564716)},
+    0
+  },
+  {
+    {W(0x9644bcaa9e962437), W(0x8aebb7af179906a5), W(0x37038b84306ef338),
+     W(0x8245ab3bfcd4e322)},
+    {W(0x2d8bd2a81e25437e), W(0x5b22c8e25d312949), W(0x81e8f0178ce9c747),
+     W(0xd13e7b86a6ba8848)},
+    0
+  },
+  {
+    {W(0x611d7774a1b71779), W(0x5c16ab52c51c883d), W(0x1162713f0132bb8c),
+     W(0x7cd8d386732b3aa1)},
+    {W(0x789bf3be25f1d983), W(0x598c3c47b0435f31), W(0x7a815948726a2f75),
+     W(0x458f75aeb687bf5b)},
+    0
+  },
+  {
+    {W(0xfae6a1a6377b61c6), W(0x5fb17c7c08b6f98c), W(0xb75053f1fa95faa6),
+     W(0x17ce9c274dc2b666)},
+    {W(0x89f6f987a7c1c252), W(0xc089c33b40bcc54c), W(0x2a05cdb852255c66),
+     W(0xf3ba269e59d6c055)},
+    0
+  },
+  {
+    {W(0xcfa844c758b14470), W(0x4a8d0b95b77aa33a), W(0x5827673166d07922),
+     W(0x02eea1cf7e84e1c2)},
+    {W(0x6e357a3a271adbd1), W(0x04205b1e1f8ac57f), W(0x2baf21d633d78dcf),
+     W(0x9516b79e640ecb40)},
+    0
+  },
+  {
+    {W(0x918cfa7dde015768), W(0xbf60e90bc0d97021), W(0x1737f0ee0d04bc7d),
+     W(0x877996df288cf250)},
+    {W(0xbea693ea69846359), W(0xf655ec7a78a802ae), W(0x3eb69c7d66a84c01),
+     W(0xd0d2e6e6cacb5049)},
+    0
+  },
+  {
+    {W(0xf8dd5390a73efe1c), W(0x331159ef977b5cb2), W(0x03929b450d0e20fb),
+     W(0x8f81a78f2659881c)},
+    {W(0x69cec5ab4a056ff0), W(0xea974c3c4dde7e1c), W(0xff7b8082582b5e41),
+     W(0xb3cf3311087e9232)},
+    0
+  },
+  {
+    {W(0x4f3e891f3606c012), W(0x8594e149f3f13d30), W(0x4659f1df85d3e7e3),
+     W(0x0c98b85f862e0643)},
+    {W(0xcf50f473b6b7938f), W(0x3be26265fbfe1eeb), W(0x204cd7df9730cea2),
+     W(0xc84c17affa12ac6d)},
+    0
+  },
+  {
+    {W(0x818a4286886c8b4b), W(0xa77ec0d7bd1aede4), W(0x448bf6c9dc44d784),
+     W(0xf114accf75db23f3)},
+    {W(0x694c0df06388f619), W(0x7c976c5590e07748), W(0xd0255f83406ab71d),
+     W(0x74037aaca939c871)},
+    0
+  },
+  {
+    {W(0x192a558626b6932e), W(0x7808fe1ce685f151), W(0x8c5f4535e8d411f5),
+     W(0x1a0ead261a05e05b)},
+    {W(0x614c4b73d3ea760f), W(0xce1069c99ff66f8a), W(0xbc081365f8c22528),
+     W(0xf1ecf8bd637c10c0)},
+    0
+  },
+  {
+    {W(0x97aca360c3831210), W(0x29e2bb7e08b8619f), W(0xee84e74a34484af0),
+     W(0xb4359f660328b567)},
+    {W(0xa94c429c24cc606b), W(0x0dc1760b786c69c7), W(0x02f96dc1edb4514f),
+     W(0x6a449965772acf16)},
+    0
+  },
+  {
+    {W(0xb650f02020d6a1ed), W(0x8cb20f35cbf21ebf), W(0x029d3d9593a67f1c),
+     W(0xced0d0bb5a56f565)},
+    {W(0x47487b7e7a30f1ed), W(0x095130edede950fe), W(0x272489e70d97bfce),
+     W(0x37546fc42e9b4360)},
+    0
+  },
+  {
+    {W(0x0e712a11d3643d75), W(0x11a2a4f6203eedeb), W(0x1cad49babbdbdb7b),
+     W(0x420ccc5574589917)},
+    {W(0xd7fd355a43258c00), W(0x8190b7e61a23bac0), W(0x5bff277868ab7686),
+     W(0x33001dd2b023d601)},
+    0
+  },
+  {
+    {W(0x83f4dfda54a989b0), W(0x418ed67fbb3689c9), W(0x317e3af529a7f9f1),
+     W(0xe962be569a12de94)},
+    {W(0x39c1b917f6f81b43), W(0x81563a0d9ef16f55), W(0x064020f779110f4b),
+     W(0xdedf5435a56e82f4)},
+    0
+  },
+  {
+    {W(0x49c0b8cc61104635), W(0x17c651cfce593f20), W(0x8aee6e36a4cf66a8),
+     W(0x712fd3aa7244511d)},
+    {W(0x916fa124e94aa537), W(0x7aca9051a9953f2f), W(0x0d0b7165f9e78673),
+     W(0x5fae87ceaf286b68)},
+    0
+  },
+  {
+    {W(0xfab07ec19cfadf73), W(0x4dcbe9ac9c797088), W(0x24db6e0560edabd6),
+     W(0x72c77135fdf12383)},
+    {W(0x4fe62798128148d6), W(0x0ad8d242da47d49d), W(0x0b80ce8c77f45c2d),
+     W(0x4c7ddb28aef6e8f5)},
+    0
+  },
+  {
+    {W(0xe9f2f7acf40b225a), W(0xd19e48903c7241b5), W(0x7852483bba3f2b62),
+     W(0xe1d66f536336bd5e)},
+    {W(0x223a8ea7ffb99e60), W(0x65752d6a5e84e6e9), W(0x9abd8fa0ef92b69c),
+     W(0x1e7e074793935daf)},
+    0
+  },
+  {
+    {W(0x60af9422859d32fe), W(0x7ced61367a208cca), W(0xa6fa0d577a9259ef),
+     W(0xb1dba40507c93789)},
+    {W(0x767c57de829c0ab1), W(0xe00de4159b51b2a6), W(0xe5b32682eb9ac1a6),
+     W(0x0872ae49affce0ea)},
+    0
+  },
+  {
+    {W(0xa2281c9a6b5f53df), W(0x5a57ba593d6fd7be), W(0x77eeb9032811b075),
+     W(0xf428bb2589dcf565)},
+    {W(0x078facf61702fb36), W(0xf331c8e82a017e08), W(0xdef2db4a8d3f3f3f),
+     W(0xe0acf85bc0b227aa)},
+    0
+  },
+  {
+    {W(0x01f180363c4894f2), W(0xba7442edbfb3ea0b), W(0x02368c49c3e4bd97),
+     W(0x60c3678e5ba3f878)},
+    {W(0x209b564e3654adc0), W(0x98fe33b7c2ffa873), W(0xfe29edc43edb36e3),
+     W(0x371696db933ca8b3)},
+    0
+  },
+  {
+    {W(0xb427a18949aa1845), W(0x2520ad38288032a8), W(0x016771efe64e866f),
+     W(0xca3712de120a1279)},
+    {W(0x6e706343fc32e749), W(0xe979c42ababbe3f1), W(0xa56ad75f15cbf956),
+     W(0x5e89ba2b838e33ff)},
+    0
+  },
+  {
+    {W(0xd781b86092a2979e), W(0xa6cb3c0a8e20f774), W(0xa120387ad52b9eb6),
+     W(0x0fdec7765390233c)},
+    {W(0x8c4ee76d6f13c04a), W(0xe735350b3036a98a), W(0x58a90cc1c635ce59),
+     W(0x9e69aa721787e911)},
+    0
+  },
+  {
+    {W(0x33e19cd756dd2958), W(0xb45c27ebbd019c1e), W(0x55b7c60b1ed3180f),
+     W(0x52d28fea96984cd0)},
+    {W(0xa2cbf95e78fe8824), W(0xed7caa934db6bf72), W(0xc50f3903d431ef5e),
+     W(0xc78ee06598f8b497)},
+    0
+  },
+  {
+    {W(0xd24975f9c544d56f), W(0xc35a0d460f851078), W(0x5d8787d16892645c),
+     W(0x4781d97924249472)},
+    {W(0xefb731b1030472fc), W(0x42ee651eac23a52f), W(0x2217c46534fb7b2b),
+     W(0x20298a5e3551c6a5)},
+    0
+  },
+  {
+    {W(0xa1f53e81089c565e), W(0x039975f20e90944a), W(0x46dc34bfae6b7723),
+     W(0x288ba24c91879996)},
+    {W(0x1ff9b53d2547a335), W(0x1e36fbc27005a4fe), W(0x7ba364fb63699f6f),
+     W(0x72ed64e4a7c71394)},
+    0
+  },
+  {
+    {W(0x2cb663f06273582e), W(0xecf2f56095ee1bd0), W(0x27005daa26956b31),
+     W(0x2fed990a58ebf447)},
+    {W(0xb1b6441a157da6fb), W(0x5929a358af17ab3b), W(0x4b40453770ffbe3a),
+     W(0xeed4e2ecabc96ee5)},
+    0
+  },
+  {
+    {W(0x126c565a776b6af6), W(0x24bdbfa46959ec23), W(0x6e563a1c1cd88752),
+     W(0x358346b450d70e2d)},
+    {W(0x9a78a208f36b99f8), W(0xd119db2b99ffbf72), W(0xa045bc61ae69ab49),
+     W(0x20b587d8d6aa132e)},
+    0
+  },
+  {
+    {W(0x0b4f6aee6079c17f), W(0xe3cb495b3424ed0f), W(0xdf643c307f9bf895),
+     W(0x8c559f88858bc430)},
+    {W(0xbf52510969520092), W(0xb6227e9eff1fa31c), W(0xcb55a151ecfb2410),
+     W(0x11e3334e11f2995c)},
+    0
+  },
+  {
+    {W(0x705b21c61c1b0ca9), W(0x6ec1c64933b3c22d), W(0xa3120eb0aa39976f),
+     W(0x6e3c834e23833b31)},
+    {W(0xbb48a0d1c2369726), W(0x13244b9092dae76a), W(0xd1f8f1900ea78e4b),
+     W(0xae2ccb31aa988020)},
+    0
+  },
+  {
+    {W(0x800c45ac17200cdc), W(0x68b0bfaf0bd41508), W(0xd3e2e885d1db6704),
+     W(0x89036116bf7b9b3f)},
+    {W(0x88d6724664afc305), W(0x1a231a991ef8fa12), W(0x920e4894fee5e9e5),
+     W(0x0bf017dcad544c01)},
+    0
+  },
+  {
+    {W(0x0e46511bfdf5f477), W(0x490e755ac4bb10d0), W(0xdfef9bfda631d48f),
+     W(0x8af3bd22749abda9)},
+    {W(0x3a36fd84fbc6c42d), W(0x6e5ef25dccc286c2), W(0x9aa6521217ee8927),
+     W(0x2865e8d10b4b9749)},
+    0
+  },
+  {
+    {W(0xb0740c97d452f9d1), W(0x12b61bb74f76d734), W(0x86c67352beb49154),
+     W(0xd8fed14be83c0055)},
+    {W(0x79c78592c5a687ad), W(0xad2dbab962643cdf), W(0xae82e2103196aac8),
+     W(0x21223f5ba52fd5de)},
+    0
+  },
+  {
+    {W(0x65d2c8055546b457), W(0xbd8edcc440702fed), W(0x5c6c69b158d82f87),
+     W(0xc766b99901dd2653)},
+    {W(0x4081cf7ae3feb8bc), W(0x3c189b54c851fc5d), W(0x186fb20c54aa87a8),
+     W(0xf9396c538742ff3b)},
+    0
+  },
+  {
+    {W(0x17fe16b24fbb4402), W(0x704133a01d68b449), W(0x667dc739b56bcb9c),
+     W(0x4803161cabf9b950)},
+    {W(0xd01d68bc9d7ed027), W(0x738edebd58f47f69), W(0x539433e568d52ede),
+     W(0xd9dc73de13cfa2ae)},
+    0
+  },
+  {
+    {W(0x2943db25430227ac), W(0xbffee9877c7d31b6), W(0xd53be0574ac28fd6),
+     W(0x5606e5ba402cf1fb)},
+    {W(0x7bbc70765fcc49e7), W(0xc7eb8b58a467122b), W(0x42e97f133983fdaf),
+     W(0xc90091f91b0978bc)},
+    0
+  },
+  {
+    {W(0x96fcd4a28ffb0819), W(0x59a8a75454c6cee7), W(0x7f07586fd7eb2084),
+     W(0xdfb66be964e553ec)},
+    {W(0x32944177313cde93), W(0x1267107dc34a378b), W(0xb33137d1870d22e7),
+     W(0x8f69d5bdb7fa3897)},
+    0
+  },
+  {
+    {W(0x03238ab63658bb3b), W(0x0089a392e78082f8), W(0x29c5746a3b83b39a),
+     W(0x0379426878b0aff0)},
+    {W(0x40c521c920a4d447), W(0x1622d9dbd1b4660b), W(0xab56a19b901514b6),
+     W(0x47d65debcf095c33)},
+    0
+  },
+  {
+    {W(0xa27a801a63e5d307), W(0xf37ce6da8fb76448), W(0xe169667ca5ec0c92),
+     W(0xfdad5804e5bcde65)},
+    {W(0xd5359d173e8aaf47), W(0xbf43d5968f370fc9), W(0xb0c466112d99bf3f),
+     W(0xf722b93f534b35ae)},
+    0
+  },
+  {
+    {W(0x36c33510fdd2e986), W(0x0cb3b5b5c5b18c6e), W(0xa502fadf6b3b9607),
+     W(0xb89e8561d89eb073)},
+    {W(0x6a322c84b98bd192), W(0x5f72a3f519f4b967), W(0xb763b33bbaa1576f),
+     W(0xdd7d224a29212220)},
+    0
+  },
+  {
+    {W(0x6340ad70dfe40522), W(0x12d818e91d2fa91d), W(0x1dee1da640a57903),
+     W(0xfbb24e4d59f3747f)},
+    {W(0xaaf091b9ab558ef3), W(0xb45413fba6208dc4), W(0x3cb57478784b743f),
+     W(0x316fa5467ac54297)},
+    0
+  },
+  {
+    {W(0x3314a5d82618d1ad), W(0xe68d676f72f0c168), W(0x1072406364e1ad4d),
+     W(0x0693de440adb29fb)},
+    {W(0x19c7d06dd9ccded9), W(0x3bc21866df509522), W(0xbacdc75421672192),
+     W(0x260b34196d485bc6)},
+    0
+  },
+  {
+    {W(0x4641b877915a3ed0), W(0x2190ba2807895431), W(0xc7a244e3477f716d),
+     W(0x7b8e399226bb5157)},
+    {W(0x5513bc0f1cc249bb), W(0xd9ca7a496b95dae7), W(0x7866ca7a57d33c6a),
+     W(0x76e514c55cd43a4d)},
+    0
+  },
+  {
+    {W(0xbc2e6a4199b13042), W(0x1558458bc1a14dfa), W(0xf283a49d18a1d974),
+     W(0x8a1847f9dd80b435)},
+    {W(0x2de7e4e2ac587caf), W(0xa858f05ec308763c), W(0x13b901a4e0b1f268),
+     W(0xf13d1d13550b2ac3)},
+    0
+  },
+  {
+    {W(0xc6aceb7c621f77e2), W(0xdf31fd597c23eb92), W(0xd584ea544f307c2c),
+     W(0x713dffcd0a749fc4)},
+    {W(0xff8ba25cc7edbeb1), W(0xa89dce3835bf4a43), W(0xa2d09d1e6da37371),
+     W(0x5aa0a6056f1969de)},
+    0
+  },
+  {
+    {W(0xa8bbddc53c4ea68c), W(0x9f240655e213f1e5), W(0x36a28cd3290224e9),
+     W(0xf05bbd4b84549615)},
+    {W(0x4820e9673b4fbe56), W(0x60aeff4899e1f1f7), W(0x9427c1cd7a5a0e2a),
+     W(0x9aa769d420ab53a7)},
+    0
+  },
+  {
+    {W(0x92a32dc774974628), W(0x6820fba558c9773b), W(0x34e23c82bcb452ff),
+     W(0x3ccfda26bdb6d3ff)},
+    {W(0xdfab3ea12dd308fc), W(0x19d940aa32aeb9aa), W(0xbea0f87d6ef1f7b7),
+     W(0x016b780d9847e193)},
+    0
+  },
+  {
+    {W(0x1ea0109e01f273c4), W(0xa708841971748cdc), W(0xb7cac52537f1ee21),
+     W(0xcea305c6dfedf065)},
+    {W(0x70af55f0f749fd26), W(0x17a232ec270a97a6), W(0x3405e205d19998c8),
+     W(0x9bf59bff991a7809)},
+    0
+  },
+  {
+    {W(0x7a21af4f8577d066), W(0xe2544b05d84fefc6), W(0x1742c0433e7641bf),
+     W(0x23980f834520b95e)},
+    {W(0x2d45640f97e740ba), W(0x6d13ecf6f5a2173e), W(0xa82207ff67899744),
+     W(0xc9ca249583d1c64b)},
+    0
+  },
+  {
+    {W(0xe5271972491a2a35), W(0x640ecf69cbdcabab), W(0xf51a014f9a1d0c7c),
+     W(0xe6edac68cc7fbcba)},
+    {W(0x479c082612777592), W(0x984a5fd01cc151f3), W(0x607e162703880edf),
+     W(0x6775c10e82f159d3)},
+    0
+  },
+  {
+    {W(0xf3e13beda182ca50), W(0xb224f046995dce91), W(0xc3cb21403bc808eb),
+     W(0x7463396adca24b87)},
+    {W(0xb3733373651410ca), W(0x114d84d98aee50a9), W(0xa1af12f0f65ce5b5),
+     W(0xc7d52faa2bbf9896)},
+    0
+  },
+  {
+    {W(0x1432f4004bc83172), W(0x4d50fac58094a8ae), W(0xb612c119fccde347),
+     W(0xde4adc35e2b8924b)},
+    {W(0xdf0f4f2921a9d7c0), W(0xab7bbf43eb6e417c), W(0xeba13c099c0eb379),
+     W(0x8feb23a589f30b96)},
+    0
+  },
+  {
+    {W(0x5fc427b49ed07687), W(0x833199dd876228ee), W(0xa3492cada11768a1),
+     W(0x10d3d93e8d5a5042)},
+    {W(0x582ef1ecfe20b401), W(0xfe7ec0163e2771eb), W(0xfead5efc3442067b),
+     W(0x7436ca02c1c9873a)},
+    0
+  },
+  {
+    {W(0x03b498befba9e774), W(0xac7518b76ba4d7bd), W(0x7477a334e922d6d4),
+     W(0x0c2c07bbaca0314f)},
+    {W(0x1ba90cc95cc9f8e6), W(0xed7d35945724c546), W(0x7d8a51d903aa5cc1),
+     W(0x3262436ba8a43645)},
+    0
+  },
+  {
+    {W(0x7e20786af93bf503), W(0x1de921ee6118426e), W(0xde6f3ad11a68e430),
+     W(0xb79674b679c6e55b)},
+    {W(0xff1d73a3486f2691), W(0x9b8c6d183e97549e), W(0xf211da61aa7f1ff8),
+     W(0x9752edb8f2d65ac1)},
+    0
+  },
+  {
+    {W(0x6f85fdddeb81c829), W(0xa93a54cbf529b275), W(0x943c20942e659007),
+     W(0xa1cd5684414e9137)},
+    {W(0x215b0803ce44299e), W(0xf4f9d604db302bd4), W(0x82c3e899dd4103b8),
+     W(0x03f5f4089471dbcc)},
+    0
+  },
+  {
+    {W(0x889a633db72f602b), W(0x035ce26dfa244265), W(0x1fb87a24a3b53711),
+     W(0xacbc8805dc807c6f)},
+    {W(0x441fccc84f0b118e), W(0x9e6fc7b44a23738d), W(0x9daaae090810e193),
+     W(0xf3c4da647e171e10)},
+    0
+  },
+  {
+    {W(0x1d170a4a184af803), W(0xf645e37123723a39), W(0x6fe6827ba8e78394),
+     W(0xe9db327365406891)},
+    {W(0x4f37db49fa60971c), W(0x579d28f2e3b2cb80), W(0x3ab7e7d08a95bb6e),
+     W(0x9d080c6939738dd6)},
+    0
+  },
+  {
+    {W(0x063cdaf557431d75), W(0x93ecf0d97e23f607), W(0x5ebbd78a916e2ea2),
+     W(0x30263269ce0dcf1e)},
+    {W(0xd3e6f3e87fed649d), W(0x205750dab5f0f816), W(0xd0fcbc7d1e951bb3),
+     W(0xe57113891bc1693a)},
+    0
+  },
+  {
+    {W(0x8e94a2e450bacc55), W(0x9d0909577ac58928), W(0x637907d2cfd312b4),
+     W(0xa25c5b299dd0bf57)},
+    {W(0x3a05d4ecad39eb39), W(0x406c01c7ae237f79), W(0x9c6bbbbc96ece9e9),
+     W(0x0c528874f188d884)},
+    0
+  },
+  {
+    {W(0x93beec00dbcca145), W(0xaf2562e79e3bf518), W(0x6fa2df6f632b1e55),
+     W(0xefa93e37d44782d8)},
+    {W(0x7e34fa5e3647eee2), W(0xa9a1ac0de62e68e3), W(0xdbaabe120fdda35a),
+     W(0x5882b0b98c2067e2)},
+    0
+  },
+  {
+    {W(0xcfb5083f1d2691dd), W(0x110ffcd16c262909), W(0x73aefe3270e9c373),
+     W(0x7321abb76a78cfb3)},
+    {W(0x9725a65019f04b27), W(0xda3d5871d32ea6aa), W(0xb557e479ac3d7f86),
+     W(0x2907e5e03a979e0d)},
+    0
+  },
+  {
+    {W(0x9c0c5aad437014c7), W(0xd080f24e9f0825ce), W(0x74d4a7473d696e49),
+     W(0xb9bac8f2aae3f3a6)},
+    {W(0x7b7f49ecaf76997f), W(0xe177bdf59faa86a6), W(0xfcdb640344ca266f),
+     W(0x243c7085d5b97aee)},
+    0
+  },
+  {
+    {W(0xc404754e62051d07), W(0xea94e721a61af646), W(0x0b58d83bf602570b),
+     W(0x8a19aa7a8ce049f7)},
+    {W(0xd07d36092e34623b), W(0xd22ba313d80d5026), W(0x3b851a7dfbee4c90),
+     W(0xa3283cf14faf2b85)},
+    0
+  },
+  {
+    {W(0xcc69f1a76bb11da4), W(0xc440a192c3641464), W(0xe1575039d94b4753),
+     W(0x2a69dc1cd05c17c3)},
+    {W(0x1fd2bace5e662ed0), W(0xd4c1ec3bfd18ae79), W(0x57ee7abcbf5d59c8),
+     W(0xb8807804878e5e09)},
+    0
+  },
+  {
+    {W(0x0bf24ecb017dd447), W(0x795ad5216f4fcacb), W(0xcf750036a9bd8d5d),
+     W(0xd7ff0337743d07d2)},
+    {W(0xac20e55e6f40aae0), W(0x5390f33e06ce4098), W(0x6c948efbd2b5e594),
+     W(0xf6a1047eaa6e5adb)},
+    0
+  },
+  {
+    {W(0xa92f8a411dba5296), W(0x38a344ec2a69ea13), W(0x62f6a0988878e389),
+     W(0xd73ff38af88a0413)},
+    {W(0x24747d4039622b3c), W(0xcad0a83bbe2d3917), W(0x7aebeeb7138d0b4e),
+     W(0xfca408df8d6b5928)},
+    0
+  },
+  {
+    {W(0x9561b339c584f1cb), W(0xfd3050e3c9be0481), W(0x5fcff93d0a05b0c5),
+     W(0x24aa9d3ee0179ff8)},
+    {W(0xbd11032260729ce2), W(0x01895c6004ff8ff7), W(0xb73e02566f7fed90),
+     W(0xb4ccac392bb1b091)},
+    0
+  },
+  {
+    {W(0xbd741195f8aa8179), W(0xd4e5a717d967a4ea), W(0xe81be39349534ee3),
+     W(0x408c8c737a094c85)},
+    {W(0x0d0bc10432849139), W(0xfa123766aa109dcf), W(0xb62f670407ba3f85),
+     W(0x2aed12ed1089fa71)},
+    0
+  },
+  {
+    {W(0xfe9dd9e331ad0c99), W(0x2b505faec8f451f3), W(0x52e6c76d1027394a),
+     W(0xa09fa6a27e136742)},
+    {W(0x8a63902184e7f431), W(0xfb3857ea6bd8f3b4), W(0xbfc5ed74f8f14f32),
+     W(0x74c43f1e03878855)},
+    0
+  },
+  {
+    {W(0xa74e53b413265996), W(0xb881c3004b794e40), W(0xa0e94122547f87c5),
+     W(0xcab5a0ccfe296cd1)},
+    {W(0xf0c6c2238cbb927e), W(0x65bdbfd7ec7fcf26), W(0x0f5900c307b60fd1),
+     W(0xf5661bf9ff677707)},
+    0
+  },
+  {
+    {W(0x2face17592cb6b93), W(0x952da8d4bf65fa13), W(0x9d94bf37cf75ad8d),
+     W(0xd459411a53656565)},
+    {W(0x155cc9c96825bb7f), W(0xd2f7ea0bb63347b5), W(0x35e167f63bf0244b),
+     W(0x74d687fe7be417db)},
+    0
+  },
+  {
+    {W(0xb600aefe1ff3c5a2), W(0x5693b0126965ff56), W(0x673a657bc47f9918),
+     W(0x97dc2c4d1e43e72b)},
+    {W(0xf813ac7f05601b93), W(0x623d3a096a0a5fc8), W(0x73fa880781a935c1),
+     W(0xf1d8d1d360e11a99)},
+    0
+  },
+  {
+    {W(0x74fda1e08df16a0e), W(0xc05b41a0758b3e65), W(0xb8210197437959b7),
+     W(0x389a5876271267a0)},
+    {W(0x6df912dc32272f92), W(0x3475e58dcb214434), W(0xc7cf6efacbdf7f97),
+     W(0x0327347fe8169395)},
+    0
+  },
+  {
+    {W(0x164cd06447cf672a), W(0x1da7c0479eaf3666), W(0x969de68dc2ffba41),
+     W(0x240e6016b68ed9f5)},
+    {W(0xcc1891584e025ec6), W(0x48c3b8ede60d635a), W(0x1a882958736ca547),
+     W(0x7e8c34d6e05708bc)},
+    0
+  },
+  {
+    {W(0xd50477c77ec45893), W(0x0277dc256b21f00a), W(0xbefff95bdce1d507),
+     W(0x6874a77a355fa0bb)},
+    {W(0x8e9143df186629ba), W(0xf4e55c15aa879f7d), W(0x56d69a9fd8ffa292),
+     W(0xed1d450ff876cd88)},
+    0
+  },
+  {
+    {W(0x68acb86c5524ad15), W(0x429698d850cedab5), W(0xf98ff56b233144b8),
+     W(0xc9ddd91793cba5af)},
+    {W(0xd9df5c907e9b09e3), W(0x57b27ac8751d3fc2), W(0xe865101fd54866b1),
+     W(0x9b306a0df7aed7d6)},
+    0
+  },
+  {
+    {W(0xc7aed0d108d4e612), W(0x5b628f9dae667617), W(0x4a51f91844c35bf6),
+     W(0x2c5e689ded6a633c)},
+    {W(0x668598f03ae328eb), W(0xd0d32d11dffeba29), W(0x6d788d9c28698d53),
+     W(0xbdf7598bccf5ea8f)},
+    0
+  },
+  {
+    {W(0x2c643540bf6fc4cd), W(0x9ace1869ea2216df), W(0x09f0718271c99474),
+     W(0x59d6a99a510556cf)},
+    {W(0xe1879e4d883a8d00), W(0x50c08cb76ede2dcd), W(0x0b4c8ce8cbbcb20d),
+     W(0xa3bc499209b416f4)},
+    0
+  },
+  {
+    {W(0x6f91a5beb78bd99d), W(0xd2da27871146f820), W(0x78751c59b17805d0),
+     W(0x147abf624febaf47)},
+    {W(0xb52619c8f8d1bf9d), W(0xf39ca46e405901d9), W(0xefe61cd6f8f6604e),
+     W(0x89d93f6f3a5e0a57)},
+    0
+  },
+  {
+    {W(0x30e637c51532402a), W(0xf648f9e3ce1c0756), W(0xca5f2f610011a209),
+     W(0x90c72f745580d241)},
+    {W(0x26d10b6de857e8d5), W(0x55c9eacf2d4572f0), W(0x38f1e51916dfc526),
+     W(0x30284eef523337c0)},
+    0
+  },
+  {
+    {W(0x1380ac303c9899d9), W(0xf77956a1b966125f), W(0x3bfbfbaac11d0a62),
+     W(0x95e28296e304f220)},
+    {W(0xab6efd292cfe0320), W(0xb4a7787cfae3c7d7), W(0x2c55b366a7ef2e1b),
+     W(0x9582c772fe688228)},
+    0
+  },
+  {
+    {W(0x783b03cc243d14a2), W(0x7cadfe4d0e24a3db), W(0xe293ef210db36835),
+     W(0x9649815284369fe4)},
+    {W(0xc95317dae26bdab2), W(0x00288a101cb74195), W(0x015bf2de3fb3f9fc),
+     W(0xa73e2258d87aca1d)},
+    0
+  },
+  {
+    {W(0xb12a154bd1b41ee1), W(0x0470283d947ee671), W(0x118ec05ff620bf86),
+     W(0x57e6606ceb299c67)},
+    {W(0x913947cbabb04084), W(0xed580e2ca1003e6c), W(0xe840d56b129ae090),
+     W(0x55768599583ad6e7)},
+    0
+  },
+  {
+    {W(0xfa75743a736ba8d4), W(0x6e8154ca9a47bfc0), W(0x5eda0156ecf2e8ec),
+     W(0xab694abf83a15e15)},
+    {W(0x0e245b7af84a864e), W(0x4bb3a22916f1bc26), W(0x69d0ca410067d764),
+     W(0x4ebc8fc8fd0218eb)},
+    0
+  },
+  {
+    {W(0x0a0cfc754f2066d2), W(0x021fe2cd1e72173f), W(0x40c6017e0b4bb4dd),
+     W(0x182ffcaef004e1ca)},
+    {W(0xe898e5a26f5504c1), W(0xfd688fb7f5949c0c), W(0xc81ced79135fa29e),
+     W(0xbe3e09001214d65b)},
+    0
+  },
+  {
+    {W(0x14f89c65ddb17ec0), W(0x5e02d656418d9939), W(0x8b0f4b3d4bc9025a),
+     W(0xdf418591178a4922)},
+    {W(0x72fb745c7ebe71a9), W(0x229f7853275d915d), W(0x449ef5d458f4d3a5),
+     W(0x5dbe06d6509dfbfd)},
+    0
+  },
+  {
+    {W(0xdcf61dfaa4624fbf), W(0xcbee39b12e967e79), W(0x283e913e5edbf7dd),
+     W(0x5a0338656f0f9a86)},
+    {W(0x1b48dad655701280), W(0xd2452be687cc7869), W(0xc620f5eec8afa81f),
+     W(0xaed058d14064e79d)},
+    0
+  },
+  {
+    {W(0xb093c620e1588ebd), W(0x32ed37282cd39dd3), W(0x64a54c75356981f5),
+     W(0x9cb3f9029bf6fa69)},
+    {W(0xd6bb5fd8bfe4bbcf), W(0xdc36dbcb24fc909e), W(0x704855b412287085),
+     W(0x9dcb2eafe124abc9)},
+    0
+  },
+  {
+    {W(0xce9d167e5a0f94ec), W(0xcd1b6c8f1b446aec), W(0xbb84dc1ef3140f24),
+     W(0x43fee3f13235f01a)},
+    {W(0x0aa21966fdd255e5), W(0x5e78c3b7b5e152ee), W(0x40f118f9593fb5fe),
+     W(0x0fe0fc2aa9fcea7b)},
+    0
+  },
+  {
+    {W(0x8001b49fcda5dd1e), W(0x8c47d5762d32216c), W(0x2aaf8fd129474d80),
+     W(0x5ce6411f5bf8568c)},
+    {W(0x63a663153db0c833), W(0xb73c538906d17b32), W(0x210c3a2dbe60d79d),
+     W(0x3cc555f980d45696)},
+    0
+  },
+  {
+    {W(0x1cab63c3013fde68), W(0x69cad6a5604fa253), W(0x31c05100f683efa5),
+     W(0x7116e768d8f8b982)},
+    {W(0xd026c2aa08db2756), W(0x07454ffd5a097e06), W(0x77931edbdf716613),
+     W(0x466a7d6b65bbb567)},
+    0
+  },
+  {
+    {W(0x6a6efc8cfa192e14), W(0xcce86ea6bc0c9aac), W(0x31a2fc02bcb6812f),
+     W(0xfe87a90d38adcefd)},
+    {W(0x75f9aca405ee051e), W(0x6b39d5e9e48ec41c), W(0x641a7852f369a0b8),
+     W(0x460e4465d6fadf14)},
+    0
+  },
+  {
+    {W(0x513270f81d4c41c9), W(0x22816433d6ebeabb), W(0xe3c96f241cb217f4),
+     W(0xf45c1f52539d1032)},
+    {W(0x40057f1d2c15caae), W(0xf9fd0db2e24966ae), W(0x822e14ab3c3da9db),
+     W(0x7ad08a2712415143)},
+    0
+  },
+  {
+    {W(0x168ac9910da4b141), W(0x29861f8f501bd758), W(0x00fc7e47f89e195f),
+     W(0x25450e4f02a5c890)},
+    {W(0xafe8e2a849309410), W(0x7cd6a232e39b8f45), W(0xdc352e0a9d96e993),
+     W(0x4df9136e4b544e6a)},
+    0
+  },
+  {
+    {W(0x7ec4c0ce441e8393), W(0x030d1f8a382fe022), W(0xf8b948fc21b25c4b),
+     W(0xf24575b4ea641477)},
+    {W(0x6b9a3d7734ccfae6), W(0x06d20dc5212fbf1c), W(0xd9b3fb83257fdede),
+     W(0x9d99fef24b044548)},
+    0
+  },
+  {
+    {W(0xb1321ad6b4361f4b), W(0xce1f78dc0f2f6ab4), W(0x339cc4134e221611),
+     W(0xa3cd87cbb2a39fe1)},
+    {W(0x818307a7bb636b91), W(0x09517eaf57f64ced), W(0x0fb30088d68aec7c),
+     W(0x0e523e9e1ff2ccf1)},
+    0
+  },
+  {
+    {W(0x024495c5e268f87b), W(0x2b9327fd6946ac8b), W(0x0f0e6bed6233e8e4),
+     W(0x06be31496e6e79a0)},
+    {W(0xa42f3ae7043e030e), W(0x7c5840670b0e02a8), W(0x3b5ba6e338ba5e6e),
+     W(0x27e89b58f9a499ba)},
+    0
+  },
+  {
+    {W(0x660c827684660465), W(0x0f7197cab65e0fed), W(0x8bd75389f7189998),
+     W(0xbc3b906829f0d80d)},
+    {W(0x1f2753126f299000), W(0xc82eb7913407ecb9), W(0x88d3ea961793a9d6),
+     W(0xf196c44689059286)},
+    0
+  },
+  {
+    {W(0x41a5484d8614b95e), W(0x6481a7335ee25281), W(0x7e761b8417a7a1ef),
+     W(0x6b0bc67e23ef5bb0)},
+    {W(0x9b3389e02f686485), W(0xec22f8c38a23ecfa), W(0x71a4ff6a632813dc),
+     W(0xbabc5b3f30dc4090)},
+    0
+  },
+  {
+    {W(0x6df08be12daccc41), W(0xa5a71984ec87ed3e), W(0xbc70fc5b7e2d035b),
+     W(0x21a1d3f5de6f6365)},
+    {W(0x1822c731c725274c), W(0x3ac20b2813334218), W(0x611438e425668261),
+     W(0xc86d66363f2d062a)},
+    0
+  },
+  {
+    {W(0xa1f1b66958c51388), W(0xe152dd6260ca41d0), W(0x3d7479940b3c2e8a),
+     W(0xe5f8c838b55d016d)},
+    {W(0xde92fe6044b2ecb3), W(0x768490b4f5875bd9), W(0x450621835aa68eaf),
+     W(0x157ed2408ecdc783)},
+    0
+  },
+  {
+    {W(0x189703459e834a1f), W(0xeaf20730757457cc), W(0x84b0c99aa8cfa454),
+     W(0xe22033bb75ede427)},
+    {W(0x9d4616c923d1718b), W(0xbbc731e3e89d0854), W(0xe68d8cf68e8943c2),
+     W(0x29842c48c6a510a4)},
+    0
+  },
+  {
+    {W(0xa326671e3fa73965), W(0xcea5617dc8314d80), W(0xdc17a35ad2b51140),
+     W(0xdeae39e1579d56e8)},
+    {W(0x812427a80a09f3cd), W(0x1a3d1b096dc11891), W(0x5b087eaf255a9351),
+     W(0x18054cab3be0219e)},
+    0
+  },
+  {
+    {W(0xccafca9df28729f5), W(0xe72e592d70767100), W(0x1dc371f8699247c4),
+     W(0x39cb6527627c4342)},
+    {W(0xb305a4341384c0c2), W(0x2b7e0949387cfcc8), W(0x6e91c29129870c94),
+     W(0x80178eb1edcfcbfe)},
+    0
+  },
+  {
+    {W(0x4d517330d5fd27f3), W(0x6ff614e77846416a), W(0x1f81545202849ccc),
+     W(0x52ca5ae8cdcea531)},
+    {W(0xaa42bc544d558678), W(0x4981c812ad4f12b2), W(0xcca3289556349950),
+     W(0x7e1b799d8258a26e)},
+    0
+  },
+  {
+    {W(0x30504419208ec464), W(0xd154592bf4faff8d), W(0x9ca0b8867ed768ae),
+     W(0x2503f93e340a952d)},
+    {W(0x5b3498a4417be4de), W(0x3e36f511bfa82e5d), W(0x7b679813118baee0),
+     W(0x266a9230071651d7)},
+    0
+  },
+  {
+    {W(0xe7384bd7f208a4af), W(0xb20f4b0c2886d515), W(0x6d1b76594f014ff1),
+     W(0x1f1eae9d990e8b89)},
+    {W(0x75fdc7c1c4d876fa), W(0x20b6d1eedba76de9), W(0x5fea64939799eb91),
+     W(0x8525b3e3f3603852)},
+    0
+  },
+  {
+    {W(0x5c95d8efee5dc4e5), W(0xe83ddce07e932ec8), W(0x66222f2ec1f51ad7),
+     W(0x93cf6d6272d8366e)},
+    {W(0xc2b1987f08ec99f9), W(0x92f7a414cadb2127), W(0x0b72fe43fc9ddf6c),
+     W(0x5cfc7c071c13c066)},
+    0
+  },
+  {
+    {W(0xa3cd128781f92de8), W(0x5a8aa649adc03c39), W(0xe01de9d343aa9e53),
+     W(0x0fac694fce888ece)},
+    {W(0x4b703b35b7fe1ab6), W(0x5f214ccba7e11984), W(0x1a1f5262a169345e),
+     W(0x6eb8de80e8d609cf)},
+    0
+  },
+  {
+    {W(0x182c81b97cc6f46e), W(0x16c305eabe625e48), W(0xc611cbca5fda4cfd),
+     W(0x27144eba6a47871f)},
+    {W(0x55f0b2a68f191a27), W(0x9995eb23f71106b2), W(0x2961186d243a6848),
+     W(0x39867d488a21c9fb)},
+    0
+  },
+  {
+    {W(0x3eb648cb308d043e), W(0xe768e125997588df), W(0x3329816aa0727ecc),
+     W(0x8ac6a07d16222efe)},
+    {W(0x0e198995458bd81b), W(0x0dc75fbebf141de0), W(0xb7fd2da71e3d6ee6),
+     W(0x61c9d01f7e842d27)},
+    0
+  },
+  {
+    {W(0x9da1b965988478c2), W(0x97a519b1e32a07b0), W(0x7e44e74209c31317),
+     W(0x05710798aa3a9542)},
+    {W(0xa9ee8f7b964c6892), W(0x5fe130684768799c), W(0x4c49de0bdede0dbf),
+     W(0x8d89f5f8abf88cc0)},
+    0
+  },
+  {
+    {W(0xde7cbaac7f8bdafb), W(0x5c3f096337fcc99b), W(0x970695b996dcf65c),
+     W(0xb2945428f11cdd3c)},
+    {W(0x9feb22aa53422e75), W(0x9c643ac416f1a362), W(0xb568b7c963fdec16),
+     W(0x0b406c73eda61330)},
+    0
+  },
+  {
+    {W(0xd1194e59257d648c), W(0xa577135a6e505e8d), W(0xb930453d60213ee0),
+     W(0xb2b7bc7518508d18)},
+    {W(0x29b339f9f0876802), W(0x6d3b7671522c6204), W(0x7bcd73a6d2552f23),
+     W(0x87f83edb625d58cd)},
+    0
+  },
+  {
+    {W(0xf634f20d2d17b273), W(0xbd84ac5f4195a37c), W(0x7e8a8be9ba6d4527),
+     W(0xe2a7acbab67d49b4)},
+    {W(0x4e6e734d109d9e18), W(0xf0953048b6aa5b0d), W(0x0bcfd81253cef3bf),
+     W(0xd71eb4a6895916aa)},
+    0
+  },
+  {
+    {W(0xf519201a116ca3be), W(0xf87bbec2a051378a), W(0x2249beb05ac58db7),
+     W(0x39f6818441ee6d24)},
+    {W(0xcb2b2a6557c3c533), W(0xbb1b800da57673ea), W(0xdbd9f70950298985),
+     W(0x85c5c8ef010a9c63)},
+    0
+  },
+  {
+    {W(0x569885cc97a3b69b), W(0x43b58991a533bce7), W(0x93895e3cacaacd14),
+     W(0xf5de8e587719b915)},
+    {W(0xbe319bfccc330ded), W(0xa1acc583844c723e), W(0xfffee242ca0d8d58),
+     W(0xb9fd87caf0d9a429)},
+    0
+  },
+  {
+    {W(0x762beb0f27f819a1), W(0xc24545e3c8ee9b2d), W(0x1cf08d4f0242d11a),
+     W(0xfbe7ba61d492ec1e)},
+    {W(0x42c3690a34a051d0), W(0x487c4692793846ad), W(0x0123b05e70679dbd),
+     W(0x16631520faacb697)},
+    0
+  },
+  {
+    {W(0x327a7545d4498f5b), W(0x6decce5e1b9ad2c2), W(0x03e8a527a297ad2a),
+     W(0x12e54a14365a4c9a)},
+    {W(0xe7698855193a2144), W(0x70737f18f4cf7e85), W(0x67228d60d7c8fa33),
+     W(0x58b9d06423f21fff)},
+    0
+  },
+  {
+    {W(0x479467db78a780b8), W(0x4d4b70a37df332c8), W(0xc81c21ad778dc4a6),
+     W(0xd9adc58913f4a6ab)},
+    {W(0x251c6738e1a2d572), W(0xf94969ecb3a89671), W(0xfd7940ac27058787),
+     W(0x780b745491a46796)},
+    0
+  },
+  {
+    {W(0x0423ef5cc61228d1), W(0xeb292de179c2c257), W(0xa47d9dba59adede2),
+     W(0x595067054be26d11)},
+    {W(0xce81e4a8083833cd), W(0x4176e0b49e3e6945), W(0xa7d4622cc822fa66),
+     W(0xb49262f1dd080910)},
+    0
+  },
+  {
+    {W(0x6106939e981ec764), W(0xae4a162a652ea2e4), W(0x9b614cce1f2e5caa),
+     W(0x8e7ea9edf1a742d6)},
+    {W(0xd1a61bd2de5fef5b), W(0x38cc3d94d4a63ec6), W(0x705c753a36d7cefc),
+     W(0x3005057153368804)},
+    0
+  },
+  {
+    {W(0x810ad351a3277bae), W(0xd3c1cf7416735c08), W(0x29409563a8f4f9c8),
+     W(0xeb70dd7c39cd6f7b)},
+    {W(0xa6fcdea748447d09), W(0x814491c2576fea7e), W(0x5b3f064b96a75d6e),
+     W(0xb63afe9a6643e5d2)},
+    0
+  },
+  {
+    {W(0x8784587e31df5770), W(0x0b0cd692a90bb5a5), W(0x1a88e6f9a1e2a6f0),
+     W(0xd7b33c87ffa2c459)},
+    {W(0xe1a3894b81bff495), W(0xd29420b39e5e405f), W(0x6e674872d3c46339),
+     W(0xf61f9f1307259e21)},
+    0
+  },
+  {
+    {W(0xd1e93ca29bf676b3), W(0x96ca29d075473eb1), W(0x1d45cd3094f1edfa),
+     W(0x8d9ba4566025bf28)},
+    {W(0xe3ba7c07dddf42c8), W(0xbb1c6ef2eb0f9372), W(0x4517e2d862ec827e),
+     W(0xb08053a4f15e7eba)},
+    0
+  },
+  {
+    {W(0x1f19f155efb651b4), W(0xe40419e7df5ae496), W(0x1f5497a6f6554ab1),
+     W(0x22734df4f3151eba)},
+    {W(0x592bfabd6d30d90a), W(0x0e4ec185c522eb11), W(0x1953bacdd528fd22),
+     W(0xd64797401ab0d68c)},
+    0
+  },
+  {
+    {W(0x59f61507e5a9bce5), W(0x42872122a4e7d0da), W(0xee2ef9ce6c1161c2),
+     W(0xee0163c146ff3810)},
+    {W(0x42371f502002b477), W(0xdae377ff8e39f147), W(0x269b511be37b93d0),
+     W(0x519a3873387be33b)},
+    0
+  },
+  {
+    {W(0xad34a71002ad56f8), W(0x76d978a45274142a), W(0xd6456052010d480b),
+     W(0x98cc6cabb47b524d)},
+    {W(0x47227e194cfa70cd), W(0x3322d84abdca94e1), W(0xda2c0996895f83d4),
+     W(0xefc675eab9833246)},
+    0
+  },
+  {
+    {W(0x7fcd1337b5bef919), W(0x84b88a559bd33f3a), W(0x0074c1b5467dbf6a),
+     W(0x9dc459f621b9cc1f)},
+    {W(0x75689c235c95a04d), W(0x902782ac9a1cc6bc), W(0x30150453888d6485),
+     W(0x2ecdb6b85815296f)},
+    0
+  },
+  {
+    {W(0x7a3cc5772530873c), W(0x58bdfb60bc179493), W(0x86817ad353122fe1),
+     W(0xe3b773ed32115082)},
+    {W(0xdc9fc067cd04179d), W(0xc7222bf2229c4372), W(0xf7ce0f6928e7d7c1),
+     W(0x18a6a1d0a46d19ab)},
+    0
+  },
+  {
+    {W(0x088c383920bebf66), W(0x808327820d3f7fc2), W(0xdb979b8896b5f3de),
+     W(0x3893891441cf246a)},
+    {W(0x6bfac8b8d9ec4563), W(0x97d1240f161da9de), W(0xe105a19b73ee3b7a),
+     W(0xdd55ea55ecf14bb5)},
+    0
+  },
+  {
+    {W(0x41ff5cd8aa6c875a), W(0xccba37e688bc8727), W(0x40e72b5a1033f8d3),
+     W(0x157335433bb309c2)},
+    {W(0xc4f72ee60f96c9fe), W(0x6223fe873c5df681), W(0x55b61fd7853c834e),
+     W(0x4a3ab6959cfb3da6)},
+    0
+  },
+  {
+    {W(0x59e7128fdcb266ec), W(0xbbe2257a8e7ace3c), W(0x1f897329a71052ec),
+     W(0xce41a6c0ea8e0be1)},
+    {W(0xe1c52f84d6a50aa2), W(0x01242da31def65e9), W(0xf7057fa92f3a887f),
+     W(0xa8bdac267cba1854)},
+    0
+  },
+  {
+    {W(0x54b02745b7aa7f5b), W(0xfc05e2e4edb23da5), W(0x5cc765f271bb8fe9),
+     W(0x43dc0dde8e4a607e)},
+    {W(0x01461898ab5523df), W(0x4c30a27d88ad8348), W(0xc71cced2bdf8a27b),
+     W(0x8f661750c3ca8b82)},
+    0
+  },
+  {
+    {W(0xede4661b808dae3f), W(0xefd2266363b9fa2b), W(0x2ab609eea2573038),
+     W(0xe1417a8cb00d40af)},
+    {W(0x6499a09df4e4df34), W(0x9cce8f3537ce5326), W(0xf96274fead7570b1),
+     W(0x4defe8fc874d383d)},
+    0
+  },
+  {
+    {W(0x40f13ed3ab1e7b1f), W(0x9e12b414f0d78aa9), W(0x5db280ef89df8a6a),
+     W(0xb69cb29ebc947343)},
+    {W(0x8a8aefe1f85f929b), W(0x00eb7dc2bdb0d18f), W(0x16c45266e5658f05),
+     W(0x2227b70b217b17e2)},
+    0
+  },
+  {
+    {W(0xb0c0c077e1597cd8), W(0xcdb3c6564f586f38), W(0x90b36b9ecf0be1aa),
+     W(0x84bdd6eaee632843)},
+    {W(0x81fee419544aae6d), W(0x474c59bbb22a2b7d), W(0x752dad95533b8827),
+     W(0x00764e0b27a3d602)},
+    0
+  },
+  {
+    {W(0x572e2540091a3c95), W(0xa2d91b4681425bd3), W(0xc00e280d6c41d098),
+     W(0x81a1ed285c963fdf)},
+    {W(0xa5db8aab3d22a0ca), W(0x15ce02698a6949f2), W(0x1c5f76471d2e0f8d),
+     W(0x920cd7d5caa9c436)},
+    0
+  },
+  {
+    {W(0x98384a1419dfe3f6), W(0xbffc81a28e2414df), W(0x9f8af2e1d502c02f),
+     W(0x0783eef11586d9b9)},
+    {W(0xd8265e1f48d9238e), W(0x5450bfda3fecc2ab), W(0xc99351eb4e0c9433),
+     W(0xe2a8172be069d605)},
+    0
+  },
+  {
+    {W(0x0abe06d74f82b68a), W(0x541d2fbc070e2168), W(0x09a6f07cc9363b0e),
+     W(0x2fe0d585fe99aeda)},
+    {W(0x3a680fb16b9f2272), W(0xae6088225d1abc55), W(0x768b5ac67ab73d01),
+     W(0x6806b9909b7e3c46)},
+    0
+  },
+  {
+    {W(0xddb8cb8d5c8395e9), W(0x70d6f02bb5b96c9e), W(0x4f93ba6edb04f88c),
+     W(0x760c7ef298af8566)},
+    {W(0xd89144d26aa492cb), W(0x65357ef5f0bc05ba), W(0x01b55e462e0bd5a8),
+     W(0x9125ea30f951f1a1)},
+    0
+  },
+  {
+    {W(0xe01e5a08902fa851), W(0x8f39f45cedaa8d14), W(0x4cd3deae017fd35e),
+     W(0xdec2bccd7bbc917e)},
+    {W(0x29238f154d5fd168), W(0xb5c69b28ebb84bf1), W(0x704a5ae884438c36),
+     W(0xe9d8b6901ad0c2c0)},
+    0
+  },
+  {
+    {W(0xb930f6cff5833a46), W(0x97cab5bcf71e0540), W(0x19262dbc3637e2db),
+     W(0x76c1b2e4f2527db3)},
+    {W(0x24badf15b8647e56), W(0x46fa5ba93e9c4042), W(0x446ac89bf7f9bb5a),
+     W(0x6e13f2b49b6f27c1)},
+    0
+  },
+  {
+    {W(0x3f1f98efc77e407c), W(0xcc6487922d12a519), W(0xf28c401c5782df04),
+     W(0x11e110cbc1cc7156)},
+    {W(0x014966e6421a0af9), W(0xa5ea82fd41353b2b), W(0xfead5f4ef538e8f8),
+     W(0xa045c24293bca7a6)},
+    0
+  },
+  {
+    {W(0xbc54e08f80637e6a), W(0x316288b54e7230e7), W(0x5c8d0a254d6aa348),
+     W(0x332489ac7c4557fb)},
+    {W(0xd78f5afdff98a993), W(0xd04f4f57975032c6), W(0x44df0c5d2a8b2d49),
+     W(0x024a1a093fcf8284)},
+    0
+  },
+  {
+    {W(0xad85732487282973), W(0xd979ca0d2b4cad08), W(0x6944e011cf035466),
+     W(0x41791ffe037dbc09)},
+    {W(0xcb005f79e52c5c14), W(0x95618c7707e8b7a9), W(0x3c4e9954883a250b),
+     W(0x156eb53083a45597)},
+    0
+  },
+  {
+    {W(0x6b2170a94a98a1e9), W(0x8e0f3707824b4027), W(0x7f97caf5ba46d950),
+     W(0xf5baf25cc1494d49)},
+    {W(0xc806c2d5ef7cfd38), W(0xc5fa2ab5151134d5), W(0x55cc3b9751d6b8a6),
+     W(0xec683be02f255159)},
+    0
+  },
+  {
+    {W(0xb6b372e72e532e7a), W(0x8ff5a6f8a87a793b), W(0x3b61d9902c084fa4),
+     W(0xa591c36f74a93b7c)},
+    {W(0x15c2863a9ac9e8b1), W(0xb09fd435d78374f4), W(0xa72c5b85d695c219),
+     W(0xbf1eb0bdbaf4f1af)},
+    0
+  },
+  {
+    {W(0x5c77267b2d83cab6), W(0x8bb4d5c9357278cb), W(0xf051a4828443c6b4),
+     W(0x0a4ad1db5aeed7bb)},
+    {W(0x805694b7157e2a3d), W(0xb46c6a1f46308255), W(0xe11e89d15d55148e),
+     W(0xf79f6442ac79f1bd)},
+    0
+  },
+  {
+    {W(0xef5463c08b9e8468), W(0xa27f92e27ebcfee8), W(0xf8bd798048ddd476),
+     W(0xd488e42aa82cd1c7)},
+    {W(0xa444978db998f763), W(0xb1481165f31a3a73), W(0xbec589845894fa00),
+     W(0xc5e15030619d2b0d)},
+    0
+  },
+  {
+    {W(0x5c550998de378321), W(0x380741f777e58dab), W(0x1f02fa8ae63d825f),
+     W(0x371be91b0632a470)},
+    {W(0xe64d518b83a2a81c), W(0x89154696ea24ca2f), W(0x1f799886ee5fada2),
+     W(0xcfb89cc40c7c2f2c)},
+    0
+  },
+  {
+    {W(0xccd886099c823a36), W(0x65a6f1019a5c1cb0), W(0x644ead0224bb2db8),
+     W(0xb784da8c07bc2281)},
+    {W(0x533ec8ba0af412ae), W(0xbf6ef30c6cb6c6e5), W(0x61f1601dc1a7bfd7),
+     W(0x587585422f56e6e9)},
+    0
+  },
+  {
+    {W(0x7050a22d0ef59f1d), W(0x57dd15328b24a4a8), W(0x3de5ec88b11ba176),
+     W(0x12c918cd7f40705a)},
+    {W(0x949a7adfd3ce9d64), W(0x1d42ec22c670b6a4), W(0x9a7ab2494e58763b),
+     W(0xa2e7703859d1b38c)},
+    0
+  },
+  {
+    {W(0xf6cd248e976b1760), W(0x0d988339c45c12e4), W(0x7b49c7670bffcc5b),
+     W(0x475f211816870769)},
+    {W(0x4a4570d099f7a8ef), W(0xf7659bf990942fd2), W(0x19f0e028ee7590e0),
+     W(0x759687197c4c63cb)},
+    0
+  },
+  {
+    {W(0x8b205cac3216cdc8), W(0xf7c2020744a20729), W(0x17b92464cf23faf8),
+     W(0xa59ae4a386d2d7fa)},
+    {W(0x87077848f394fce6), W(0xd104cb26ee806222), W(0x876e43cf4264a0b7),
+     W(0x03371c9b4a3ecb7b)},
+    0
+  },
+  {
+    {W(0x9da9bf48448c280d), W(0xe2d3444825c5c173), W(0x9000d7a83c92b6ed),
+     W(0xccd99c2ac614baa0)},
+    {W(0xddca3f6293ad5ba1), W(0xde44167762dad6b0), W(0xdd4c17929393f9cd),
+     W(0x5ad2c52bd273fbff)},
+    0
+  },
+  {
+    {W(0x2eeb0095888a7df2), W(0x5dfafb55bef55d99), W(0xa4ad38c635c0b3c3),
+     W(0x51c2576044b0dc32)},
+    {W(0x627baa933a01b091), W(0x7b4d61fc428d0c9b), W(0xcbf796d53d4f9a15),
+     W(0xd5dcb0a21fc9010c)},
+    0
+  },
+  {
+    {W(0x8153ab2a5e2fa0b8), W(0xab6d34a81d1ba532), W(0x5dff595687c5df51),
+     W(0x2ed979da302b0fb8)},
+    {W(0xaaaeb7d7e41f5171), W(0x2c348a9331d4744c), W(0x3b241b42a9dfad86),
+     W(0x28c4603557e4422a)},
+    0
+  },
+  {
+    {W(0xf492fb18505472de), W(0x580bb8f182bb42a7), W(0x8c32c52421dc81f9),
+     W(0x506e735dfeb39101)},
+    {W(0xa3be277ccb4bd0f0), W(0x21a0bb98609d00e2), W(0x860440a1d8713fd2),
+     W(0x910e6539f67ecfbd)},
+    0
+  },
+  {
+    {W(0x3f76e5bbde674add), W(0xb54bfde5ec31ea99), W(0x692c8c380580a9d5),
+     W(0x627bc0e381eaa7eb)},
+    {W(0x2913ef2d73ffc466), W(0x42d0a9ae765e1c32), W(0x167157e3472ec53b),
+     W(0x624e380bc9e35c39)},
+    0
+  },
+  {
+    {W(0x6f8ce1ca87246b88), W(0x92c039e6e0684222), W(0xbef482e866643411),
+     W(0x79cdfd527a96285c)},
+    {W(0x54e3df4d3bbc3c57), W(0x7b0cb01fc5c3a149), W(0xf6d264dabc23947d),
+     W(0x293e7b9ee0869519)},
+    0
+  },
+  {
+    {W(0x3397a30fbcbdcb1f), W(0x3a489d294142238e), W(0x3f0f42a0ee85892b),
+     W(0x099bdc1cb7bae746)},
+    {W(0xf2aea76a1cece654), W(0xebd6f1b629200042), W(0x91e9260ef0809b94),
+     W(0x5bbfde5524ccf44e)},
+    0
+  },
+  {
+    {W(0x0e9e0de9a720c3b7), W(0x282e9873446a267b), W(0x7d4d7504311b30f2),
+     W(0x654434afd0ad3d94)},
+    {W(0x1bfc95d06938f546), W(0x8207fbc6106699f2), W(0xac58e73f30073f0c),
+     W(0xc4dcdda993ad2aae)},
+    0
+  },
+  {
+    {W(0x02c4348e7ec01c66), W(0xc7dc17f299356691), W(0xc2057c7b44ba3366),
+     W(0x7a596c9d7bdb5d01)},
+    {W(0x2fc61174a3d02445), W(0x3f28b17228502c32), W(0x245a702bc785dda1),
+     W(0xc13f9dc4f31ff67f)},
+    0
+  },
+  {
+    {W(0xf8210e471aa37a76), W(0xabdbabe253ff6f38), W(0xb1ad9240280d43ba),
+     W(0xcc97a0f1343f6ccc)},
+    {W(0xd66bebc67dbf474f), W(0x97e1a656ceeed580), W(0xd248284a7a109128),
+     W(0x525de25cb4aecb49)},
+    0
+  },
+  {
+    {W(0x98c89d00a283df21), W(0x38ca7c6f39d619cc), W(0xaa6aac06a9c2eaca),
+     W(0xe0dab4a86d023ae0)},
+    {W(0x828960ee6ae59511), W(0xfd89438bd5a23269), W(0xc3d907477f7a058d),
+     W(0x3b72a0c56fe0a6d7)},
+    0
+  },
+  {
+    {W(0x90dd555a0abe59b8), W(0x2e9dd3653cea9e4c), W(0x0fe4008ccd4d7b06),
+     W(0xcfebc725b71f7e6b)},
+    {W(0x7e196cff67090836), W(0xccd1ab0551d345f2), W(0x8c9cdf03f5ad60b4),
+     W(0x1724bc9909926dea)},
+    0
+  },
+  {
+    {W(0x25345248058048d3), W(0x519c399637b0a9f1), W(0xd06a225b1206628b),
+     W(0x6929b3e1fed4aa76)},
+    {W(0x08bb3215a06f1cd0), W(0x94337fb2944e6340), W(0x8b654c28f99066d8),
+     W(0x2abd51fa3f27cf77)},
+    0
+  },
+  {
+    {W(0xef2268303ef32e28), W(0xdd8f7265e4d577de), W(0xe09b34d8a8fd5dbe),
+     W(0xc7bfffe4757ed4ab)},
+    {W(0xa10f90a724c85df0), W(0xa38392908f941151), W(0x83afeece5c89f044),
+     W(0x6d59ae3bbb2d922c)},
+    0
+  },
+  {
+    {W(0xe0a68d4245a3996f), W(0x48fcb6273bc9c6ab), W(0xc6eb11be3a3ee812),
+     W(0xe6ea380430f7025e)},
+    {W(0x268d1cf5b7133236), W(0xbfe80e60de4e7702), W(0xd9e0169d23949850),
+     W(0xf1d24ceb705bbec1)},
+    0
+  },
+  {
+    {W(0xdd839e945b7a3a3b), W(0x39971605e5f0cb52), W(0x1ac290d240ee0af9),
+     W(0x2ac922454e346685)},
+    {W(0x0abcc8aa51788f91), W(0x135b811c1fe7d670), W(0x8620fb4fc8d12d66),
+     W(0xa42c715795fc85aa)},
+    0
+  },
+  {
+    {W(0x924d7a5db9269047), W(0x197552196e4abac1), W(0x5eb3b980a1c814a1),
+     W(0xf2e28d741d2167c5)},
+    {W(0x382782dda14f932f), W(0x6c4e27eda53eabf5), W(0x66bc4555be4a4949),
+     W(0x5be1f89328a6c75f)},
+    0
+  },
+  {
+    {W(0x4334822f3b2e0e66), W(0xfc61e17f581dc850), W(0x6cc55614200874d1),
+     W(0xfb4325787764e6c4)},
+    {W(0xaf3b373e25583821), W(0xd58addf02e292f9d), W(0x4694eefa2dc31251),
+     W(0x441e7934bb697345)},
+    0
+  },
+  {
+    {W(0xd3f2ecd6b6753ab4), W(0xfc9d754901639a14), W(0x5e0053ec6580ae87),
+     W(0x61efbcfadb9f6aca)},
+    {W(0x8696c7cff2a2a215), W(0xa822dde4bcc96f05), W(0x20bf95f76b31ce2f),
+     W(0x6099d96275378ab1)},
+    0
+  },
+  {
+    {W(0x4a5c116bca632d30), W(0xdd51583c153aecfe), W(0x082e87f5f2f7961f),
+     W(0x0cdcdcf4b6de6a75)},
+    {W(0x6b1c6cfe82977583), W(0x8c893100b9f7e2b1), W(0xc7d6399d351cddef),
+     W(0xbf82e84a33753e6e)},
+    0
+  },
+  {
+    {W(0xb2b7c8dd4a8e3147), W(0x4eaef675b483f9e9), W(0x9330348d95c92e67),
+     W(0x4d2cf2122296b247)},
+    {W(0x58071256c5bdb7e1), W(0x880e36b8d3818213), W(0x3dd824de7cccb703),
+     W(0x8c85cfef0b3035f6)},
+    0
+  },
+  {
+    {W(0x96660ad02feeab29), W(0x5abcd44943a91ea2), W(0x0ba1fa57f9b71e28),
+     W(0x1d42355e5a57ae4a)},
+    {W(0x8f1055d08d2c652d), W(0x3e75d719cf6c22ab), W(0x1119f80c7d29c5ab),
+     W(0x39728a5b8c73e0b8)},
+    0
+  },
+  {
+    {W(0xf3a3470974a729d5), W(0xb512a50cdaf8e9eb), W(0xd5b89d6eecadd02b),
+     W(0x252b89f837a43f29)},
+    {W(0x4c7b58df642feeec), W(0x6fa1a37e8b9b2cd8), W(0x96b77d7f4ba8e288),
+     W(0x66f9bb1372f48db7)},
+    0
+  },
+  {
+    {W(0xbfca1a615c99a6b1), W(0xf05843a3b971987d), W(0xf6e3f0ef62bcb7b0),
+     W(0x2498b9d05c9c4703)},
+    {W(0x14dfb49a663eced8), W(0x006714212ede56b8), W(0x9c82e85289fe1432),
+     W(0x7a769010af5ef1b3)},
+    0
+  },
+  {
+    {W(0xd3021ce23fec4ac3), W(0xd05da37b6a0e7e18), W(0xe3d5913ea1760713),
+     W(0x15a015b4cd935715)},
+    {W(0x92204ab8ec2bfb4c), W(0x4074bd99ed1135f0), W(0x1caeb071c1fe775f),
+     W(0x475042d99b4aa0fc)},
+    0
+  },
+  {
+    {W(0xd465fe30a02ee6c4), W(0x52d4bcf8892436db), W(0x3e675875b85fcc1c),
+     W(0x10e59330dedadbbc)},
+    {W(0x06d4259d2028c5f0), W(0x20d47ba7648b4bd5), W(0xfb6f3ea200033611),
+     W(0x3cad37bfb62e6429)},
+    0
+  },
+  {
+    {W(0x0561190d63da5e41), W(0x50cf8b46f9f301f1), W(0xde6ec5b032dd4114),
+     W(0x10ebaee989ef02ba)},
+    {W(0xc80cd68239661c3f), W(0x48ac2e38046e352b), W(0x1c9910445ae44392),
+     W(0x90a1b379b0be66c5)},
+    0
+  },
+  {
+    {W(0x19af0c91fa5e802e), W(0x7b997a4cbefc9de2), W(0x91590c78ed8ce6c6),
+     W(0xd86dd0ca2672321a)},
+    {W(0x9188ea5dc7f110bb), W(0x7cc78b98c6d8a84e), W(0xab4dc97fb0f6f1c3),
+     W(0x4e9a7f9b8b8bc4c4)},
+    0
+  },
+  {
+    {W(0x3e7537f140b32c31), W(0x94c23d0569cf169d), W(0x5c67e72730a2949a),
+     W(0xf1e2d946f6cb021d)},
+    {W(0x06356398f59cd2d3), W(0xaee11a9e9995521a), W(0x684bd325964e1457),
+     W(0x6944707001f8e2ce)},
+    0
+  },
+  {
+    {W(0x9a5517835520e89e), W(0xb82bc29864599ec7), W(0x8354b244306b4431),
+     W(0xa97519cf4799250f)},
+    {W(0x0cd64fb5103f6485), W(0x1c5caf07278b77b4), W(0x735f5f54660c0213),
+     W(0x04744657837735b1)},
+    0
+  },
+  {
+    {W(0x8b8ea230eca85629), W(0xf6348fbf184fdc62), W(0x7e00027ab129db64),
+     W(0x1bd67182c8ec1191)},
+    {W(0x029fd1958c1ac99c), W(0x49163be70263ee6b), W(0x35f2c8e8da6a5bca),
+     W(0x35cb00ad13f9c047)},
+    0
+  },
+  {
+    {W(0x54028dfb5263f85c), W(0x245cba9864a5b6df), W(0x8dc71582115e536d),
+     W(0xf349fa92948b3cd4)},
+    {W(0x46cb903a540b919d), W(0x997b37490c8bd7c7), W(0x97fced9b7ba7acf4),
+     W(0x327d5313e281ca77)},
+    0
+  },
+  {
+    {W(0xa8a12aa2b3f5b224), W(0x9ed2c87b8ae19ffe), W(0x5716186b0b0dd086),
+     W(0x2cd63dd32b3ff9e8)},
+    {W(0x8d8bceca9a9986d4), W(0x20605c4d6a3c486f), W(0xbe086189b3752cae),
+     W(0xa2ccfcc30100bc18)},
+    0
+  },
+  {
+    {W(0x65085e5aa6f90bec), W(0x30adb77902cb3a96), W(0x887d90894d5cf147),
+     W(0x6e24068e28fec3f7)},
+    {W(0xdd29bfd59364ab98), W(0x54d78210a10199b0), W(0x465de50a5ddef87f),
+     W(0x06157a716318e22c)},
+    0
+  },
+  {
+    {W(0x77c152465770ac87), W(0xdb54a5887e3aac43), W(0xfedeb6abb1949b40),
+     W(0xad7814438e817225)},
+    {W(0x0f55a6fa8a0207b4), W(0xb645116d4586051d), W(0xd8ec0e5457887a6c),
+     W(0xe6ea51a385a9569b)},
+    0
+  },
+  {
+    {W(0x2c91135edf02c3d7), W(0xd4b8904152ee9938), W(0xb8a657a069c1666a),
+     W(0xf0c1affa332aaf9c)},
+    {W(0x101669bdf16bdf88), W(0x632c80962f98841c), W(0xfcd9a53cdbf19cae),
+     W(0x69945ac26b08253b)},
+    0
+  },
+  {
+    {W(0x23a06068b111bbea), W(0x4c8b711bd3ee70c7), W(0x7d5af405543fb6f3),
+     W(0xd37594d627b54d70)},
+    {W(0x67ba4714cf131ccc), W(0x23530d471324cd81), W(0x96cdb5cdbe56189e),
+     W(0x9cdaa163c4f22188)},
+    0
+  },
+  {
+    {W(0x08a4f39cf34b9e0f), W(0x1c1a09ba434215e3), W(0x7ee7012a08a34340),
+     W(0x5ac3558ac97c959b)},
+    {W(0x4a9a4dcc3e7cfe49), W(0x9839970eec1ab25e), W(0xb8326cef528bd2e8),
+     W(0xffb971cb6f59cc3a)},
+    0
+  },
+  {
+    {W(0xbbedfc36cc412cf9), W(0x7ecd4ab700cf1608), W(0xeadd251fdbbda445),
+     W(0xcebaedaf9af86e6f)},
+    {W(0x7d12904824f0bd40), W(0xf34a70083673dbd8), W(0x676ad03639e1f240),
+     W(0x077705e942c5d5f0)},
+    0
+  },
+  {
+    {W(0x44a5d7955d0763c0), W(0x6ca1655c5e0a17e0), W(0x7e484b3ed3dc5615),
+     W(0xc2f33e6f5309a77e)},
+    {W(0xc79230dd5135cf29), W(0x34f2d748c91c651d), W(0x2de893313757b62b),
+     W(0x1e58d64817d8d619)},
+    0
+  },
+  {
+    {W(0x2ae13472a85dba8b), W(0x55d1203c54632789), W(0xbaf39bb72b9a0ee2),
+     W(0x5264ed60c0bf5986)},
+    {W(0xf5259586b8c68436), W(0x1b5b6d95127ab34e), W(0x28d9ae1cc287ba4b),
+     W(0x0b5eaf341a457f9a)},
+    0
+  },
+  {
+    {W(0x9bf9db30cdf97a85), W(0xf56b7f00387e8200), W(0x6db49e4bbfe45932),
+     W(0xd71a74dc2bedcbc7)},
+    {W(0x81003fe80b61cdc6), W(0x03a230147ca03ca4), W(0x488567213caaff6a),
+     W(0x96a18ebe25b5fea8)},
+    0
+  },
+  {
+    {W(0x802e414a3f9e67af), W(0x39c1968248a94639), W(0x86c21df4d49c5192),
+     W(0xb6c4349cb9357468)},
+    {W(0x52426f1da86be46c), W(0xc2da65e6b7328068), W(0x5b222c1f32c27400),
+     W(0xfcba17890ec183fe)},
+    0
+  },
+  {
+    {W(0x59761a1a2b69dc73), W(0xe0dd3f5d12058396), W(0xacf229687e0bbc2d),
+     W(0x378175f914c996da)},
+    {W(0x95793c369201228f), W(0xd6a5ed4550fb158c), W(0xd2e3b14b6972c988),
+     W(0xa0a75184e5619d6e)},
+    0
+  },
+  {
+    {W(0xf385e999a0fa68ac), W(0xd05fe47a9571ade0), W(0x695a0dacb905a380),
+     W(0x51e6d551ac8858f1)},
+    {W(0x97e60b397747302a), W(0x41ffae1ddd5710f1), W(0x426fb7836797a12c),
+     W(0xf173dc2bc6563a75)},
+    0
+  },
+  {
+    {W(0x1f12d2ffdd8c582b), W(0x3477eb3f33821e8c), W(0x6b36f5c3f528b3b8),
+     W(0x6ffe0088174e9481)},
+    {W(0xe7e63f4ccdc57bd1), W(0x9610ccb7370d826c), W(0x920c57661c82333c),
+     W(0x5ce27846bed7225b)},
+    0
+  },
+  {
+    {W(0x3a6425c4efe4608e), W(0xf755cbce70dcd104), W(0xa6cea37823de30c7),
+     W(0x8fe1d15bc6512466)},
+    {W(0x821ae76b38cf43b6), W(0x79e3e19b187bde08), W(0x66fc8f096412db62),
+     W(0x518e8bc4324a116c)},
+    0
+  },
+  {
+    {W(0x5bfd339405eb2184), W(0x2b06c85bc2528c2a), W(0xda1bf1d3982df5c2),
+     W(0x7811286af6b6867b)},
+    {W(0x3f80e04e63e4ad03), W(0x8472d7a64361f70d), W(0x62e4618c0a5780da),
+     W(0x7dbe11ef5080c901)},
+    0
+  },
+  {
+    {W(0xda73e85af779cc87), W(0xff1c6ee8d6b01759), W(0xfe4694fdc0bfe52c),
+     W(0x74155028ca6357c2)},
+    {W(0x96da181d33d9f0bc), W(0x0937c7d490ee4d69), W(0x761aeb427d51c55d),
+     W(0xf85ab7173244f637)},
+    0
+  },
+  {
+    {W(0xf0429029fa68edbf), W(0x17c110f22826e986), W(0x7e4b41d60a0c0910),
+     W(0x5a6bfaa944a6dbdb)},
+    {W(0x6234c1084d83ae3f), W(0x263fe04859e2c7f8), W(0x3146fcefb338c73e),
+     W(0x6ced4e21b17dcd16)},
+    0
+  },
+  {
+    {W(0x72f043abbd19745b), W(0xb4dac6adfac29167), W(0xe55ae14d7dbc3a54),
+     W(0x81fee0250b6ef414)},
+    {W(0x4a3cf7ccd77a248f), W(0xf480c922da481d9c), W(0x8f54faf7ca337418),
+     W(0xbe5cf058836a612d)},
+    0
+  },
+  {
+    {W(0xe887ab9c782fca38), W(0x352d91c03b5a4464), W(0x38ea6143d5370636),
+     W(0x511b14f2c8cabf9d)},
+    {W(0x18884076b5db080b), W(0xebaf4d317ac3ef17), W(0x1f572a3c69df9e56),
+     W(0xac628d712e12fe7a)},
+    0
+  },
+  {
+    {W(0xf3d7708a2bd8a49c), W(0x26e4c3b437ed4e8a), W(0x6d51795d61b8042e),
+     W(0xae85134713a651e1)},
+    {W(0xf36020b615af6cef), W(0x2b5f099363acdc26), W(0x40b39da59062e2cf),
+     W(0x4d1916587d5a8d4a)},
+    0
+  },
+  {
+    {W(0x01a6a0a7047b0c39), W(0x9b88a0cb1f2e4401), W(0xbe09eeedf6062fe9),
+     W(0xeed71ab2336a3072)},
+    {W(0xdf80ad93d1652ae1), W(0xfa61aaea1285e64f), W(0x7765376f405e9bea),
+     W(0x007018e087f4c70f)},
+    0
+  },
+  {
+    {W(0xaadd270b2074ef55), W(0xbf994767886aa69f), W(0x471a84b9ffdbe511),
+     W(0x30e5a5d2c31fc9a5)},
+    {W(0xa27dbce4350c8279), W(0xdb824c0623cf7c12), W(0xadb03cd53082ea74),
+     W(0xfd3b5b03d79e7e95)},
+    0
+  },
+  {
+    {W(0xdaeac943cd987ca5), W(0x6fbcacfb469093a9), W(0x837c954990a5985b),
+     W(0x2c57ec98a9894011)},
+    {W(0x6336fa34919d52c2), W(0x0a1b3a289de83bbc), W(0x5e231f4cbc88ed7c),
+     W(0xe28e28d694630454)},
+    0
+  },
+  {
+    {W(0x8c366f10510a1e4b), W(0x0de35551d1404d69), W(0x7d52ae0daaf68024),
+     W(0x9a3b93c79603b5f4)},
+    {W(0x59f3bf85925c6a6d), W(0x26b086442d1b9e1d), W(0x057810c2c6a9d6f1),
+     W(0x83a01c7567c265d6)},
+    0
+  },
+  {
+    {W(0x67937e5be13df911), W(0xe372088d98175f30), W(0xf9392625a11316b9),
+     W(0x9fed5188db0b7af2)},
+    {W(0x41ef1a919ae6cc27), W(0x6c74db6eeeaa0916), W(0x05f291227f8629f0),
+     W(0xe238972d77db5a2a)},
+    0
+  },
+  {
+    {W(0x1a8b8811751c2118), W(0xb9d06aaba60ae667), W(0xb59accece67651fd),
+     W(0x4c79ef3d8a784a76)},
+    {W(0x0a36d859477cdb4c), W(0x1db98f5724d20973), W(0xe28364527bb6533e),
+     W(0x475a95776fdef449)},
+    0
+  },
+  {
+    {W(0x66f2a1ade71f2e9a), W(0x06d34f9539b982fa), W(0xe582b4597b508100),
+     W(0xebf9783b6cadadcf)},
+    {W(0x226679b7c1b69737), W(0xe32f94c73a51b33f), W(0x5678aa8368bd535e),
+     W(0xf242e35f0e408f03)},
+    0
+  },
+  {
+    {W(0xfed6a0610da70bf7), W(0x63ee0ee5ea7c74be), W(0xdf25dd92f635d15c),
+     W(0x9a8d62850d5a13c3)},
+    {W(0xf6fbd56a10597ce3), W(0x6c1637ac7e96fdd2), W(0xe0e332d26d955fe1),
+     W(0xa20c4839dc66c777)},
+    0
+  },
+  {
+    {W(0x455ac2a425e83681), W(0x79138b2f602d1533), W(0xfd72d1dbe7a54a1a),
+     W(0xca569963d4fec8af)},
+    {W(0xcf93025a9ad7c15d), W(0xa33cfa0bbb97c8f1), W(0x9f8a13862d0d35f5),
+     W(0x5452df4f8ed1b2fc)},
+    0
+  },
+  {
+    {W(0xf1ed17dcf2ee606b), W(0x6eeef221d5be9ede), W(0xce77325a31757c89),
+     W(0xc7a4b5d90f4f2809)},
+    {W(0x7ed6f67e5feea643), W(0x2e79caed8bfcbacc), W(0x95200b9600929545),
+     W(0xd0a1546ae628725a)},
+    0
+  },
+  {
+    {W(0x0f720bfff228ee03), W(0x2fec1dae5b13a7c5), W(0x403b72e2b612094e),
+     W(0x22fb6ee5d46accec)},
+    {W(0x1c042974342ab05a), W(0x1f927614937e1e77), W(0x984766394c654a38),
+     W(0x8dae9fa826104d38)},
+    0
+  },
+  {
+    {W(0xcefa3a06637e186f), W(0x119ee605ce13b607), W(0xb167a9a9fa79098d),
+     W(0x30b3bd3999756f3a)},
+    {W(0x0c6ad60ec56ab1ae), W(0xd982fd43cb4ebaaf), W(0x5eafa9b5feb68ba5),
+     W(0x808bf003ece77132)},
+    0
+  },
+  {
+    {W(0xd72905784a490345), W(0xecfd67c34613fae2), W(0x4207f80a17130f5e),
+     W(0x6a1be0b776d731eb)},
+    {W(0x6e5007b26991dd51), W(0x962b17202b75c5a0), W(0xa5159a06680246bd),
+     W(0xeaa8ca6444c3e2f0)},
+    0
+  },
+  {
+    {W(0xa9afc597ff51bd2c), W(0x8069163599619e32), W(0x9cd7ad4f1f5203e0),
+     W(0xc0f49d65b372d9cd)},
+    {W(0x8247760497dcfabd), W(0xb0fedf81e20cc31a), W(0x3f67286b367d8443),
+     W(0xb2f09e37122f817c)},
+    0
+  },
+  {
+    {W(0xc53e54e7ccedde15), W(0x26ec8802d4a85125), W(0xd1a94ac5b718b00a),
+     W(0x8549748d97f3b59b)},
+    {W(0x1f02b9d518a33289), W(0xf45c1895d632104c), W(0xba5019f8aed489fc),
+     W(0xe592827da46e1327)},
+    0
+  },
+  {
+    {W(0x4dc3c1ecb95021c2), W(0x1cdfc877434386a6), W(0x292652e4f18e99f8),
+     W(0x546c70f185c20096)},
+    {W(0x7181ecb81c22ceac), W(0xa8c52dbce6d9f84e), W(0xd975e75dcdfab89f),
+     W(0x84a44da20eb370b4)},
+    0
+  },
+  {
+    {W(0x7ee30b2616ffd445), W(0xbc5e3f4fa856ca90), W(0xb2a71d44fba6b417),
+     W(0x0ff9c2d71522d113)},
+    {W(0x09ecc237c1a46b02), W(0xad0d6527d1b0d9cf), W(0x3a0f7693db5dfe53),
+     W(0x126c60df9ef77ab5)},
+    0
+  },
+  {
+    {W(0xeb223603d94134e0), W(0xb6f9d8d34029cba6), W(0x4d40819f966b34ef),
+     W(0x93d0b688bb067941)},
+    {W(0x9849a544d320fc54), W(0x313529d98f019e28), W(0xb32900bbef5ff7c9),
+     W(0x05e0d67b4298d64d)},
+    0
+  },
+  {
+    {W(0x48dd32adf2580f5d), W(0xf2992a12ab22630b), W(0x1858b2161623cb1b),
+     W(0x475f2065d6a10dc4)},
+    {W(0x12ac16a619f7d63f), W(0xce195950e32dd9fb), W(0x02a6fe6054733b7d),
+     W(0x607808a77b4dc2eb)},
+    0
+  },
+  {
+    {W(0xa8d994dada45dbd8), W(0xf836e082318673d9), W(0x09eb3581e5acee06),
+     W(0x4d1c000b28113c31)},
+    {W(0x57c18300b24e3cd8), W(0x142bdcfb5ce5ca77), W(0x360b59cb7f38578d),
+     W(0xbdbb069e85b76a93)},
+    0
+  },
+  {
+    {W(0xc0f0e3f450927ac6), W(0xc547dfb815dc7219), W(0x95012dc910360eaf),
+     W(0xa3203b186908c0ab)},
+    {W(0x0ac8da606ada7e39), W(0x76358ec4b09ef87b), W(0xfc286f273102900a),
+     W(0xa1e4dec9928227d3)},
+    0
+  },
+  {
+    {W(0xe6cc5a8b101a6130), W(0xd6da9d80c670fa13), W(0x6b40f3dd6fe018d6),
+     W(0x895e40cc8af6e695)},
+    {W(0x13d57b005c382acf), W(0x957ea300bc8e5698), W(0x507bc6fb99d41dbc),
+     W(0x5c61a48a84b2a701)},
+    0
+  },
+  {
+    {W(0xe273b6d33e1c8262), W(0x4eda87389ccb6a8c), W(0x00af10f3301880aa),
+     W(0xea38f0e69ef5512e)},
+    {W(0x344d5bd7866918aa), W(0xa978da53e6bfe048), W(0x130d5312f318a001),
+     W(0x3965509d936674e8)},
+    0
+  },
+  {
+    {W(0x42d3f84928682729), W(0x3463c45035a0aa90), W(0x4782bef309d26645),
+     W(0x6615fd87e5873a21)},
+    {W(0x9e0efb73348bf44b), W(0x0f8e51fca7af0558), W(0xe5b25d16bce17a55),
+     W(0xab2c9f42d9ea787f)},
+    0
+  },
+  {
+    {W(0xfc717f81028ec64e), W(0x1dddd6bf7596bc9f), W(0xec924137519013fb),
+     W(0x5edcf9ecf0e340e5)},
+    {W(0x3b493efb8730ec87), W(0xad8eb47251ce6135), W(0xff22789cb9eda449),
+     W(0xfd1748f6cb001606)},
+    0
+  },
+  {
+    {W(0xed4fd330936c229f), W(0xb1ff3ddb37086c22), W(0x73e419662b1c066c),
+     W(0xea23f4b23765fbbb)},
+    {W(0xdf8140d7925e277a), W(0xe755c734b518fc86), W(0x3ffc822431144736),
+     W(0x891d67e17e0d22b0)},
+    0
+  },
+  {
+    {W(0x2da352cd67b1f947), W(0x059431c2eed27d99), W(0x2e08c65506b284bb),
+     W(0x5e7eb1c90bbb7888)},
+    {W(0x6094f7f154ba484d), W(0x7b034cfa73355a54), W(0xb3023932aa65648a),
+     W(0x734caabe9ec21a9a)},
+    0
+  },
+  {
+    {W(0x046246cea3081b55), W(0xd827ad24fe3dcbab), W(0xebf09ef3647d9817),
+     W(0x8b8b65512410e11a)},
+    {W(0x7c3a0f4d3e6bfbe5), W(0x7c277e6df76458dd), W(0x6b8236b8313d91df),
+     W(0x8f7c6906ac27d8d3)},
+    0
+  },
+  {
+    {W(0xba303f50f089c91b), W(0x264ad8a85bcc0b8c), W(0x2d0a83c76c216ffe),
+     W(0x67c604619988a7bd)},
+    {W(0x2cf3f205c03e309c), W(0x61666397e4f90c35), W(0xcae2ded4db75fdab),
+     W(0x672972dd2c95abf4)},
+    0
+  },
+  {
+    {W(0x46c67acdf0c899ec), W(0x9daf55d6211a1f0f), W(0x9cbee605b48f4307),
+     W(0x3f8a2d37296bc030)},
+    {W(0x19bbd2c0bcd81a03), W(0xfbadfa9633b066aa), W(0x40cd993c20063de2),
+     W(0x3b074aaf56eafb6a)},
+    0
+  },
+  {
+    {W(0xfda2e06791beaf06), W(0x2434c720acde2dfb), W(0xd47ecad7e753c1e8),
+     W(0x3f417b8b55db8420)},
+    {W(0x3bfbf0ea7df1bacb), W(0x31ef868bb8acf07c), W(0x1d0d347eef16a5f2),
+     W(0xf65e64d69cba5e5f)},
+    0
+  },
+  {
+    {W(0xbed1451b8cf18b58), W(0x371bcb170703ff2d), W(0x2eb4f99ba55e82f5),
+     W(0x4ddd08aa5e58c013)},
+    {W(0x0c1ffa61fa06b838), W(0x1fb4239a6c30f99e), W(0xa16f88154799ee4e),
+     W(0xa519d17e07cb1010)},
+    0
+  },
+  {
+    {W(0xdc74f5bc727ec61a), W(0xa1f69873d92acd07), W(0x377f8c2959318847),
+     W(0x8317b454430f4779)},
+    {W(0x226843eda831fe73), W(0x80b5b5065a4ca05d), W(0x658015e619452a8a),
+     W(0x8c68c5488e366579)},
+    0
+  },
+  {
+    {W(0xc74022334dd633ee), W(0x4fdbadbda13980c1), W(0x060232cc400bf04b),
+     W(0x83bda8e6e7f827b1)},
+    {W(0x3c4802ecd74b82b5), W(0x08869a0a5e8ec266), W(0xfea1d034b8530dcf),
+     W(0xb509a89018c2c7f4)},
+    0
+  },
+  {
+    {W(0x213a0de38c300ddc), W(0x37476dc5fd5471f0), W(0x25de446b78843db6),
+     W(0x3adf3db07e8ab41b)},
+    {W(0xf8c774aa5d1e90d3), W(0x59d6ca1566bce7a5), W(0xc69fee1ad65347a6),
+     W(0xdefde69ba3ed479b)},
+    0
+  },
+  {
+    {W(0x9211c15252df83e3), W(0xee9634925616ae97), W(0x21e474cb28171e55),
+     W(0xe774fc9be3ae2aeb)},
+    {W(0xc61abb625f00eb36), W(0x1cbbe38ef7551e9d), W(0x72da819ea5c80f9a),
+     W(0x0f7aefae53ae9915)},
+    0
+  },
+  {
+    {W(0xb55fca7b3303d072), W(0xcf4be4b6aec25e5f), W(0xafac9e2a14aa8d2f),
+     W(0x163678b652773eda)},
+    {W(0xce62af8215cde50d), W(0x06d23efaddf14c70), W(0x4a83df9aac788e05),
+     W(0x19c76a07dd660791)},
+    0
+  },
+  {
+    {W(0xa3a55c979ff91d4f), W(0x5ed11dce7d9472e6), W(0x5fdab5fee86be030),
+     W(0xa811ff825c8f63c2)},
+    {W(0x4eea8ae780cde9c4), W(0xfab9904d636a3139), W(0x80090d16117972d2),
+     W(0xfa864a56de41509d)},
+    0
+  },
+  {
+    {W(0x0867b0ff54629530), W(0xafbec2e93cd5326c), W(0x75c466f8be18fac7),
+     W(0x4ae873b14b08b71b)},
+    {W(0x0cd90641ced1bd47), W(0x0f412f9336a27a5d), W(0xbd8bfee729736da6),
+     W(0x1a4dce259e55e79b)},
+    0
+  },
+  {
+    {W(0x1414921b9b6abc58), W(0x949685ef598fa877), W(0xf73ef2bbcd823867),
+     W(0x089c481fce902d98)},
+    {W(0x5c2ab09eb7de9f8f), W(0x2efff6d8fb5f81e4), W(0xd8e0e1144650a8fd),
+     W(0x6a1d6abf63812ff1)},
+    0
+  },
+  {
+    {W(0x76b9dea117e0562c), W(0x4756f0ad12dfbe53), W(0xcf0760d42def86e8),
+     W(0xa417e7a4b52a6c84)},
+    {W(0x0d1f2eda2e4b0d9b), W(0xc4683c5f4a038e7f), W(0x6aee01f026ec71f0),
+     W(0xa63128ade89de19f)},
+    0
+  },
+  {
+    {W(0xee2e3982af21e2b7), W(0x0460d8939c60a03b), W(0xe825d5eb999daa2a),
+     W(0x30b51bc98e70bb1b)},
+    {W(0x17d61d460dcbe1ca), W(0xf53e958d29384cfe), W(0xc8ce4cd9585892da),
+     W(0x9a901d6e5c27d0a5)},
+    0
+  },
+  {
+    {W(0x7d48afdec9fd205a), W(0x3180020076e24433), W(0xf3b7a125b43f9c5d),
+     W(0xb95021f16bc34bec)},
+    {W(0x765044714cb4f128), W(0xae656614d481e8d7), W(0x562203208af8e666),
+     W(0xe42539673d1b1d0d)},
+    0
+  },
+  {
+    {W(0xbb06ca2f84311eb6), W(0x297e0ac27a1959ea), W(0xb647ae7c6042b439),
+     W(0x8063e7e325a889cd)},
+    {W(0xd418f8d3f0b63e06), W(0x9f50334e64b335c3), W(0xa57b8d604b839812),
+     W(0x6cd23690ccaf3503)},
+    0
+  },
+  {
+    {W(0x539e9c8316cffd3f), W(0x8bafc5c0fbf9ae30), W(0xc78434b00c81d9a8),
+     W(0x2a24288261871d0f)},
+    {W(0x5afdfd40ddc42b3f), W(0x1944c52f46d40207), W(0xcb76e7d8de218bd5),
+     W(0x6881ec3e11560377)},
+    0
+  },
+  {
+    {W(0xfc0f923fba506bca), W(0xaaf9d8fc04831541), W(0xf3f6be35d2f23418),
+     W(0xd3ba90932c36b8e4)},
+    {W(0x3310fd15d4b3705d), W(0x6e467df6c74c3e38), W(0xbf695f7a3cadf005),
+     W(0x2b05c501a846c9cc)},
+    0
+  },
+  {
+    {W(0x4ba52dbec1114857), W(0xc5c642147bef79c9), W(0xb86e916cf8752dba),
+     W(0x8f6c01956b379cb0)},
+    {W(0xb84db15ca311ca96), W(0x5a696374dac0b9c9), W(0x74a5221e7b42d928),
+     W(0x2a98ee05bfb94766)},
+    0
+  },
+  {
+    {W(0xa7706292a3f3481d), W(0x41e92575bd14c3de), W(0xff9968f6255754bf),
+     W(0x4fa943966e20021e)},
+    {W(0x0f7494d957dd878e), W(0x4ea481357dc2e4f4), W(0xede8313223c8c012),
+     W(0x577a072813406ac5)},
+    0
+  },
+  {
+    {W(0x60aa8c30b278d70e), W(0x9e975de04e391108), W(0xb1c525cdcd7ec34b),
+     W(0x6d9bed906896db4e)},
+    {W(0x0e780e300cad4b6a), W(0xa92da24be1f0c18c), W(0xaa03d186906f81e5),
+     W(0x92891494ebaeaf02)},
+    0
+  },
+  {
+    {W(0xb3cdcfe9c3af6292), W(0x9ac017a746e09251), W(0x7ab6cae1ad695f21),
+     W(0xfe1c4e48c6060e3f)},
+    {W(0xd61ff7b24bb43dc1), W(0x8f86407bfe6f1ec1), W(0x3b03134e8590a894),
+     W(0x2c2eb6b2cdc69f15)},
+    0
+  },
+  {
+    {W(0x2c1e17e72e963b3a), W(0xd0c94f4ec2dca7de), W(0xdaf66b14fb2cc1eb),
+     W(0x8979a424f5fdd65a)},
+    {W(0x10e67ca558f1d5f5), W(0x2a9316bfe985c899), W(0x5c6619ae1d56c2a1),
+     W(0x2ecb6bdf1aef89ea)},
+    0
+  },
+  {
+    {W(0xa6d8b13593dfa42f), W(0xad770d8d6acb46b0), W(0xda9cce4144e25abe),
+     W(0xcd7f17d1a6bde096)},
+    {W(0x20405569bcba1fe0), W(0xc5eeba7c0d8875b8), W(0x98821e6678a0a249),
+     W(0x821af14baabddf74)},
+    0
+  },
+  {
+    {W(0x3680b2e5c4f95a45), W(0x49d2a62ce9fc8c74), W(0x13296be9ab273621),
+     W(0xdb831381e366f058)},
+    {W(0xd7e00485a8da96e6), W(0xd92e039530b9c18f), W(0x5de7cdc77ff4e7fe),
+     W(0x3ea7d885adaaf6fe)},
+    0
+  },
+  {
+    {W(0x33d63ee025b0dd9b), W(0x1a10d0580bba06ea), W(0x789ba934ebd02028),
+     W(0x3d020ff6b9e76580)},
+    {W(0x00f3750f80c491b9), W(0x019e88099b33c264), W(0xb87bad19942e0ce0),
+     W(0x0cb5a795d9e055db)},
+    0
+  },
+  {
+    {W(0x617bd9029ba489d7), W(0x13841fe473c7360f), W(0x3893f5c905d7a1be),
+     W(0xe580a190d351ed4e)},
+    {W(0xe99bca21d2382e3d), W(0xe4513e63dd4e3ae5), W(0x974f1daae40dd036),
+     W(0x954dbc3a0c1af952)},
+    0
+  },
+  {
+    {W(0xecf17e8775cc5649), W(0xae760daab5932f05), W(0x8249dc87dcf7df26),
+     W(0xeb113dfb2ecfbb47)},
+    {W(0xed8f8f374ecd4716), W(0x0b8aeb384b344358), W(0x4a82bff315ed8ab5),
+     W(0x973e080e9145403a)},
+    0
+  },
+  {
+    {W(0xa2290b967b997614), W(0xeba5c39305670114), W(0xb5f327a428e4f627),
+     W(0x7c24ef94b8642fb0)},
+    {W(0x993af554e2812e43), W(0x13f7e4198bb7de16), W(0x027fcb17f4b2db90),
+     W(0x74639f4638802698)},
+    0
+  },
+  {
+    {W(0x2e603ac7c8b4cfb8), W(0x9d499e18927e1e14), W(0xc7099b67d9f980ee),
+     W(0x5051374eb5631acb)},
+    {W(0x511f80ad7eedc6af), W(0xf6bbd9d23774ab95), W(0xe1bf993677a16821),
+     W(0xfb1f851c17b17f1c)},
+    0
+  },
+  {
+    {W(0x5e7aac9b5f7a5e71), W(0x61549df9bc67c305), W(0x1c0ba8d9a8acced8),
+     W(0x259d4cf7e7298893)},
+    {W(0x694d955db15c1202), W(0x44c0cdbef405ef31), W(0x9fe32cfa05609208),
+     W(0xf50736a4ae20a557)},
+    0
+  },
+  {
+    {W(0x735673260ca5bc31), W(0x2b529e45190ac0c5), W(0x65e43e2f772b3c83),
+     W(0x58c15114065b745c)},
+    {W(0xceb9a2adf18dcdf1), W(0x613d4890be7a9041), W(0xdfe78d91ebdbfbd7),
+     W(0x38d44410ae41089c)},
+    0
+  },
+  {
+    {W(0x2642c5c1165104c0), W(0x6ebd1d07e68daa3f), W(0xd4cf7ab5cbfeacd3),
+     W(0xd98c2024258ab8c0)},
+    {W(0x0b7c16115d58e0c0), W(0x4fcd48e1bd7daa85), W(0x57fc615483fe6fc8),
+     W(0xc9fbb778a4556c88)},
+    0
+  },
+  {
+    {W(0xe2929febd40b4b20), W(0xb4ee129739d13708), W(0x0ba56ef22180ba07),
+     W(0x4320b5902c44edc9)},
+    {W(0xdecc5c3aa87cf681), W(0xd95a09415cea94e8), W(0x1c384370729bc03e),
+     W(0xd4a72d12b49b7fc9)},
+    0
+  },
+  {
+    {W(0x92d29f210b6963ae), W(0x6a53bf711ecbb2f1), W(0x68918640e5443cf6),
+     W(0xe2dbaafe10b4e658)},
+    {W(0xe5991c7fb95452e3), W(0xa6bcdcbefb5c1baf), W(0xe05cc9d331a82d6f),
+     W(0xf5adf3d2d9e554f7)},
+    0
+  },
+  {
+    {W(0x50a2a9a1c4241e56), W(0x4a769e3908bff1d6), W(0xbe4f7981c946efb9),
+     W(0x4c0a361b8156aadd)},
+    {W(0x2b8b1553c2e5e730), W(0xd87fec248b63a900), W(0x96c4db6974d3e4b6),
+     W(0xb24091f7dd629c2e)},
+    0
+  },
+  {
+    {W(0x4d690e3c6bee2a37), W(0x8d6ed69b6ec21d4d), W(0xe2ceb6e184b5731c),
+     W(0x80b4db0ad80e1fa1)},
+    {W(0x6515b31a13c8952c), W(0x8bc77160f041d104), W(0x264c425ee1f00bb2),
+     W(0xbbf8ad45c423848e)},
+    0
+  },
+  {
+    {W(0x7fc1281361e83f74), W(0x15e3058c8f26a1f4), W(0xbb376b81a550a16c),
+     W(0xfa6fc07915e942b8)},
+    {W(0x1b2cbd674abfaff4), W(0x585bda9d11a63c17), W(0xed91cc5a67813da5),
+     W(0xb9f9f7162ce60254)},
+    0
+  },
+  {
+    {W(0xed820bd2154378d8), W(0xa2a4c1c85e580fa8), W(0x20cbe0d447de98d3),
+     W(0x874964e030354ffe)},
+    {W(0x5d902f5d16a853a9), W(0xd4f7540c41cb1591), W(0x2df5c722b1b7a9d0),
+     W(0xc9ffb7c7ba1ac480)},
+    0
+  },
+  {
+    {W(0x5aa5d0155176e7d1), W(0xa6d620cf46e7f923), W(0x13c365c11e4c0d3d),
+     W(0x641a3ee53f1ed96f)},
+    {W(0xc3a37e980b9cab08), W(0xbb61f0204bfc00e6), W(0xbb457318afb8e4dc),
+     W(0x64d7ccaf9d2bf98f)},
+    0
+  },
+  {
+    {W(0xaf0856805df50093), W(0x930d6faf8401c2c2), W(0x069124a526ced6f7),
+     W(0xc2e3d3fcf02c8d47)},
+    {W(0x3b69c576e5e4538b), W(0x673ed116f74ac312), W(0x4e94e9f2603c9146),
+     W(0x38ee52d718cef1ee)},
+    0
+  },
+  {
+    {W(0x3d3d6cd87f5f1542), W(0x22450aef5a688030), W(0xcca6fbdb512560df),
+     W(0x939adb25ea20b468)},
+    {W(0x82bdcc3fe0591094), W(0xa5d6cc113837673f), W(0x79f208c8440deed6),
+     W(0x660aaf99f611fa67)},
+    0
+  },
+  {
+    {W(0xfa76ae0aee055f40), W(0xaa4b00fda41b6177), W(0xd5851d6d187733bb),
+     W(0x685dcfae116342ec)},
+    {W(0xbffc31bbea845de8), W(0x92f3036462e4acd8), W(0xc56813be89716cfe),
+     W(0xe159a4e3a15dc428)},
+    0
+  },
+  {
+    {W(0xeabc661f467f46d1), W(0x153ff4fc3933eb60), W(0x8ee2640acc1b4f66),
+     W(0x42a2168f6b7efa87)},
+    {W(0x6a2e8f112cb8078e), W(0xf42559a7c81821e0), W(0x016f7b60b08a59c7),
+     W(0xb957221e8884357c)},
+    0
+  },
+  {
+    {W(0x8f3741866a6ac808), W(0xa022a6f2dc344d1d), W(0xc99e5c0a0ef7d0f2),
+     W(0x09fc1c853dc98863)},
+    {W(0x1126396d9186b8ed), W(0xb2cb60d1f6971ad0), W(0xf10eb792649acd3b),
+     W(0xc5c6a77fcaa164f5)},
+    0
+  },
+  {
+    {W(0xb0002ebd34a7f90b), W(0x0232ea65fbb241d3), W(0xf7820ec2f89c2c5f),
+     W(0xe0a02dd799e2d876)},
+    {W(0xc4eba960f0717204), W(0x8c3d295be1a39c7f), W(0xf71a22b0a2e1dfe3),
+     W(0x8bf51d88dc625616)},
+    0
+  },
+  {
+    {W(0x2fe415e0c0292428), W(0xbd95dfa2323cbbd4), W(0xf59e71a76c107fd5),
+     W(0xb585dc9aaa02e9be)},
+    {W(0x7f6218abc845998c), W(0x740ac09550133f76), W(0x678abf130d91232e),
+     W(0x99db2c7dd5f3b7ac)},
+    0
+  },
+  {
+    {W(0x145e5ae100073625), W(0x6f37b14c09abd5c0), W(0x9f57ca2f1c53fd51),
+     W(0xa7fe3a88b484e1cd)},
+    {W(0xb774a4476ae66340), W(0xde893f1aea5bb0c6), W(0x4d411efb441203f2),
+     W(0xad4d0f429037ad90)},
+    0
+  },
+  {
+    {W(0xf657ee66f8147de1), W(0xec20074eb10607ba), W(0xc0c0569d22065ddc),
+     W(0x3a4bf5cf0f9a4c18)},
+    {W(0x1b074fb0ef78aae3), W(0x8915c6ae6caab28e), W(0x0a4e9a537498a5e1),
+     W(0xd46a444312922d11)},
+    0
+  },
+  {
+    {W(0xe5ff46d004072ba2), W(0x7d738e8f8306cd43), W(0x69d7c183f62ec911),
+     W(0x1877bb0530449c75)},
+    {W(0xd6fea447fda4fd59), W(0x6b4e787d9bacf1d2), W(0xda1f07d44019afd4),
+     W(0xa31ae0334f41238a)},
+    0
+  },
+  {
+    {W(0xef953ce77cd2e632), W(0x60a2e7f029509ff2), W(0x9f4b0a9904e2c40e),
+     W(0xf6e9f2959ed4e527)},
+    {W(0x56f475288b2c4ddf), W(0x6dbff09731ab3ac9), W(0x5d02f94cde1669da),
+     W(0xe66b2b0ac6ee4882)},
+    0
+  },
+  {
+    {W(0xe63c3860c1cd369f), W(0xc41058863655adaa), W(0x6034f8cd6ad13ad6),
+     W(0x0757a624d96f0947)},
+    {W(0x062c00aa0586abea), W(0x732ff312a7329472), W(0xf29d93db863a4086),
+     W(0xbe97b8df2955a09c)},
+    0
+  },
+  {
+    {W(0xb83145be97c5f7d3), W(0xb548913b4c5f569b), W(0xf41ddccefe16d653),
+     W(0x57bc996a0fda654a)},
+    {W(0xb8226c27394c27dd), W(0x09776ff14476d0c1), W(0xaf053feaf5d6e2f4),
+     W(0xddc59cadf21bc430)},
+    0
+  },
+  {
+    {W(0xbe339f7af461a4bd), W(0xedf945b48e521441), W(0xe59c239caac8b6e7),
+     W(0x998437927c0d4a71)},
+    {W(0x2c885773bd37de14), W(0x10d215c5908344ab), W(0x7dec9e5ac2289057),
+     W(0xf734f5292e08a3b3)},
+    0
+  },
+  {
+    {W(0x8c88e139ecb3e383), W(0xbd32579f4461afff), W(0x3691bc9951e9f677),
+     W(0x554ec9c979828b04)},
+    {W(0xfa8adce29be25859), W(0xb3c2105235d9a265), W(0xdd4feef32497286e),
+     W(0x436caebbab6be163)},
+    0
+  },
+  {
+    {W(0x175eb16aa53cb9e1), W(0x9dd8bda2b95ab2db), W(0xa1df7bfe04be3dee),
+     W(0x058894b44b5591b4)},
+    {W(0xa98907d63f2e65d1), W(0x171c7df7750572c7), W(0x170b1c3f41d30782),
+     W(0x0a629ece520a3768)},
+    0
+  },
+  {
+    {W(0x98a0913bdeab40fe), W(0x67fdcd9070caf538), W(0x1543d253d96bd108),
+     W(0xd79d0d84aa794dd1)},
+    {W(0x7f933d572a31f567), W(0xc2bb9c3e684b87eb), W(0x55f48c686010c827),
+     W(0x865b26d6858d6457)},
+    0
+  },
+  {
+    {W(0x62a17d14b2b5295e), W(0x49b0fb5c6f41d9f3), W(0x449fba7554fe71bf),
+     W(0xa8fc7c3040d333f9)},
+    {W(0x81b427fc12dfad2a), W(0x5e2f8c887e7c3319), W(0x3eede5bb6081986d),
+     W(0xa83a4cc408d0d275)},
+    0
+  },
+  {
+    {W(0xe951bfc32371f6fd), W(0x94cd3cb21d8944cb), W(0x2d5dd77faec9bcac),
+     W(0x7cee4e50077f308a)},
+    {W(0x0d63cf7fd623a026), W(0x4e6ffa4dc7ef7e99), W(0x8505c7ea7f2f7370),
+     W(0x14f269da20788577)},
+    0
+  },
+  {
+    {W(0xcebf1e3967b51fac), W(0xf6b5e57e148c21a1), W(0xb35946fb414e05dd),
+     W(0xc43d076838810152)},
+    {W(0x72373091c8d9b109), W(0x2dfda6e86926d00b), W(0xdb8611e1027ddc5b),
+     W(0xa478092f20a565a4)},
+    0
+  },
+  {
+    {W(0x00c82ccdda40072c), W(0x668a89dac3951c24), W(0xf2ddac784c1226ba),
+     W(0xbc6dc7e741714d2c)},
+    {W(0xb248c1df8b62bfa7), W(0x4649592e23a95075), W(0xf00af1ea66c4ffb5),
+     W(0xc778cfd04a698247)},
+    0
+  },
+  {
+    {W(0x9061893df60c343f), W(0x519d32083a6b210b), W(0x18dc7c6fa3367361),
+     W(0x4678a1d6811b9144)},
+    {W(0x67b6717b1f4d96db), W(0x2cbc390be8dfafc3), W(0x5f7e0175d962e04e),
+     W(0x5007de5c310a1a41)},
+    0
+  },
+  {
+    {W(0xef2668eabde9dc51), W(0xb73b1e2622fff55b), W(0x3582938000af2cdf),
+     W(0xabacc9cd5373f1aa)},
+    {W(0xa79cf26ddd728827), W(0xfe577d39807e44b0), W(0x25881ce316083dfa),
+     W(0x2d72d953f6149fdf)},
+    0
+  },
+  {
+    {W(0x0df26047c7dfe8da), W(0x722a62a75795ca63), W(0xfd05155426822db2),
+     W(0xa37c8d5165dd4a4b)},
+    {W(0xa4f87e43d316157f), W(0xc1eab9779dd5b802), W(0x39f7c24a143309e5),
+     W(0x0d889906f70497db)},
+    0
+  },
+  {
+    {W(0xf1af64c1ec6fbbbb), W(0x7b5e61fc364ef4c1), W(0xac69b56873c71e19),
+     W(0x9538f31e1487dfd8)},
+    {W(0x5eb16cbbc95b8dea), W(0xb81990556ceabe72), W(0x502043b333da3300),
+     W(0x521cb1b7418a7274)},
+    0
+  },
+  {
+    {W(0x9be91b0c8ff93d26), W(0xb327ec68ee96e497), W(0xa54e65597234a8fd),
+     W(0x3225bd0279d2832c)},
+    {W(0xc49187b706fbea31), W(0x32d24a2f55d06fc0), W(0xc3aea98ddb6c7c8f),
+     W(0x287714ce8dca2066)},
+    0
+  },
+  {
+    {W(0xfaaf7d4538675d09), W(0x619d0938b544486a), W(0xd4b81a0d7e5ff78b),
+     W(0x927cdab99393353d)},
+    {W(0xc7beeddcaf09ce8a), W(0xba22834187c3fd85), W(0xc45b9295977a760d),
+     W(0x477476a5d9b8424c)},
+    0
+  },
+  {
+    {W(0xaba2261ff5781f2c), W(0x3061d6dfe173bb81), W(0x398f46ea01aa1947),
+     W(0x27967ef5e9db933e)},
+    {W(0xadb4f6de3fa5b2fb), W(0x8b000ad8f0b280f0), W(0xc062a85a9056fbde),
+     W(0x0fcb84059d82359d)},
+    0
+  },
+  {
+    {W(0x21b2bbfe2f990f90), W(0x78f40dee33af15da), W(0x946bd43f3daa63f5),
+     W(0xd0638b3eb4b258d2)},
+    {W(0x572ddfa6ff9ac567), W(0x3275e30fff8452f1), W(0xad2f63d4be857fa5),
+     W(0x137cf3a36bd302b3)},
+    0
+  },
+  {
+    {W(0x0683bd516913e39d), W(0x1e772f05979a2b24), W(0x9d1770fe6554a02c),
+     W(0xcfdf7bc498d41de0)},
+    {W(0xa65c7f28a2ae729a), W(0xcda80daaa2f59f2c), W(0x333a734235130799),
+     W(0x010b9cde8817074e)},
+    0
+  },
+  {
+    {W(0x5f0a8c1561a3efa4), W(0xa1ce3680a2f06c92), W(0xb58b45a02f77a173),
+     W(0x00ca93448f549301)},
+    {W(0x8dba3cfda0925e22), W(0x1b2edd9e9101349c), W(0xaee4de1fbe1584be),
+     W(0xacfb6bebe882ea17)},
+    0
+  },
+  {
+    {W(0x5e4c188e1143a71b), W(0x549389db6188dfea), W(0x70ace99973974340),
+     W(0x03276aa7d466b66f)},
+    {W(0xb0c57d45e878d258), W(0x8490754e12172c94), W(0xd667c1ad3d8bb9e3),
+     W(0x35d67cfc2098ac6a)},
+    0
+  },
+  {
+    {W(0xf4373bd776880305), W(0x79faf1a7cc183c3c), W(0x350d88f4320203cd),
+     W(0x3f79433e31559284)},
+    {W(0x470f6751deb4594f), W(0xcc8eb5d5b04e106e), W(0x1b2d859ad508014f),
+     W(0xa2929af521a38089)},
+    0
+  },
+  {
+    {W(0x782b96a70dff06d5), W(0xfca1b56712d338ad), W(0x1ce09f64e07a0b02),
+     W(0x1b0bdcc699556e0a)},
+    {W(0x1a3869cbddfafeab), W(0x869836c219b92d51), W(0x6d82d6ad8dde1cf4),
+     W(0x93df2f282478ede4)},
+    0
+  },
+  {
+    {W(0xa72a7cdddff5c9a8), W(0x6343f9ddce1cfb36), W(0x561d0ab80e60ab95),
+     W(0x773453a543b16125)},
+    {W(0x1a7ef13e77a5cdea), W(0x1c26f810743cdb91), W(0x7be7b84818843c39),
+     W(0x92fcdeeedfb09a99)},
+    0
+  },
+  {
+    {W(0xbb0b3c7f4f349550), W(0x8b6f8a3a68e6440e), W(0x8571e4f616ff1e1c),
+     W(0x606ef2b3b04f50c1)},
+    {W(0xef7887f521602510), W(0x983521d7a3e5af36), W(0xa69fa8faead010e9),
+     W(0xdcd176ef87c3a576)},
+    0
+  },
+  {
+    {W(0x4d0d4b08efb39345), W(0x5f3120a0dcee3be2), W(0xf967e9488d5d59d1),
+     W(0x26285abb03b0773a)},
+    {W(0x0858496c4d7d5523), W(0x8e7168473acec5d5), W(0x71d704b35682da28),
+     W(0x9914f1c4ede23a75)},
+    0
+  },
+  {
+    {W(0x3d980c0c98f5d183), W(0xe5a54d37c6105d48), W(0x3f1434b6abab7108),
+     W(0xc5c645c691143cfa)},
+    {W(0x5afc4c10efa076da), W(0xcc406cd2ecb4e40f), W(0x80be9f55f2773348),
+     W(0x52eb3d05407f4fec)},
+    0
+  },
+  {
+    {W(0x8ad9690a77206bdb), W(0x272e91f107965762), W(0x789fe098c5baa7af),
+     W(0x5ad3a7ed54b57fdd)},
+    {W(0x2b0774153612bec9), W(0xa4de3b2ed9969f5b), W(0x99c448f481215bf7),
+     W(0x576f0ecb04dbdd93)},
+    0
+  },
+  {
+    {W(0x2af358f366726384), W(0x230e4a6d35abe384), W(0xdbd03893fadb4f10),
+     W(0x3edbe82c74780f30)},
+    {W(0xa7322af8a8f87f99), W(0x4f1ab014b56cb1ce), W(0xdd6012daf562b104),
+     W(0x51d0686e44399068)},
+    0
+  },
+  {
+    {W(0x510aa6d61cceb27e), W(0x3e0c40269346c557), W(0x4a9f38e91f12e31b),
+     W(0x05caf42130986adf)},
+    {W(0xf1b85809c455f905), W(0xb1c54963a121d154), W(0xaf44f5975d4b7af4),
+     W(0xe35c91e7d1769f8a)},
+    0
+  },
+  {
+    {W(0xb3460f3039e97bac), W(0x41063844562a7c82), W(0x3d3be62d3b03215f),
+     W(0x2e2b41b94f07d135)},
+    {W(0xa600dfd3a917ab94), W(0xb99308eef5e2c6ef), W(0x8b93ab46d6e7baf4),
+     W(0x88baa5e79409651a)},
+    0
+  },
+  {
+    {W(0x850b79cc5817209b), W(0x640dc560b49c5c51), W(0x98121ddeea0f6288),
+     W(0x9119177fe049cfde)},
+    {W(0xcbfea823daffa949), W(0x2d0dd1bff9bdca95), W(0x9548c5be907d92ba),
+     W(0x131d4cdee7206ba3)},
+    0
+  },
+  {
+    {W(0x3fc3655fca2f4000), W(0xe81b9876068818b7), W(0x8c1b8615496f25fe),
+     W(0xe1e82c752cab4a86)},
+    {W(0x77f865f66687c22e), W(0x5c0f7ecfe223d37e), W(0x066d2764c30dd242),
+     W(0x30ffa380246d6018)},
+    0
+  },
+  {
+    {W(0x0a45bc77e2e6e0be), W(0x6b51cca25e886d60), W(0x388084f33784486f),
+     W(0x0465f6d78bd2578c)},
+    {W(0xc08d7e72dd6dc135), W(0xe16f71baa38a28a8), W(0x0ae41b01b87c60d1),
+     W(0xe52ea0c2d1b91872)},
+    0
+  },
+  {
+    {W(0x38ce157e255d82f7), W(0x694d1cfc00846fa8), W(0x130d35a49ccc2153),
+     W(0xd6e121d5fabdd6ee)},
+    {W(0xda2eb1b8d9640fac), W(0x793abfa10a748867), W(0xcbc17311d76ce809),
+     W(0xebfc848fa751c03d)},
+    0
+  },
+  {
+    {W(0x65db82243b3720f9), W(0xb38f7d1f5c12850e), W(0x85b78076ae4fea54),
+     W(0x92a75714be5584b3)},
+    {W(0x886f950d8750941e), W(0x5b8f2da3e392c5e6), W(0x0719ecfc82cae5f2),
+     W(0xb152d0a3a4e0c11f)},
+    0
+  },
+  {
+    {W(0xc9f9bb11006df6d2), W(0x49a10fabb09b618b), W(0x87b2aa03b26ddb17),
+     W(0x83f13549135e3a1d)},
+    {W(0x1b42ec52e7175729), W(0x807fd179d5cd5967), W(0x1a454bdfec44b40b),
+     W(0x6a5016602d80ad43)},
+    0
+  },
+  {
+    {W(0x61d990e94ebcab67), W(0x3f67b51cc7729dee), W(0x1f2e3420e586fb41),
+     W(0xc6ce9b5298ad7e43)},
+    {W(0x417faebf2ac91a99), W(0xf8e828784b163480), W(0x166fa79451532cae),
+     W(0xa7be0127047f8e27)},
+    0
+  },
+  {
+    {W(0x35d4dfc33abea4f1), W(0x057ec82d42ecfa8b), W(0xdba1a626f2f84df4),
+     W(0xd9cfbc8bc48615e2)},
+    {W(0x9b82d67684871882), W(0x9e8e6dc14c1e6cca), W(0x7e944dc0272a4110),
+     W(0x12ac4d9716540087)},
+    0
+  },
+  {
+    {W(0x792ef03d7e78289e), W(0xf377c20e83f46909), W(0x8d788ff00dcaf146),
+     W(0xca383f193abb514e)},
+    {W(0xe02d49dafbef083b), W(0x3d887faef238bff0), W(0x44fcfc52cbdf2d27),
+     W(0x5c9210f6f85f56a2)},
+    0
+  },
+  {
+    {W(0x59054929422551f7), W(0x65b1e49d030e950b), W(0x86da582c3a1ced0a),
+     W(0x9eaef63c9feaa087)},
+    {W(0x7eba2fb54c904a37), W(0x4abea5610d1548a6), W(0xf56b0aecb9bb9d28),
+     W(0xb705e9b7d30c58c0)},
+    0
+  },
+  {
+    {W(0xb31ca887d7608bf5), W(0x9fb5c82d0e34ed7e), W(0x727d31a3f259673c),
+     W(0x7c976a03127081a2)},
+    {W(0x4172975ee4d037d0), W(0x73db1c945466c0b6), W(0x2116e101e1daa9b3),
+     W(0xc0f92cd8fa18b7d5)},
+    0
+  },
+  {
+    {W(0xd29c60c43e82b24d), W(0x327aa8a7e1a0d7fd), W(0x62b1f80ce7835f4d),
+     W(0x981bbfd341e59939)},
+    {W(0xa352d26df06b9e7a), W(0x618d752fc98ff22c), W(0x3cc3f9d6d5d56ed4),
+     W(0xfe88d42ab55638a3)},
+    0
+  },
+  {
+    {W(0x91f1ccbf232dabf4), W(0xd00e3210f9c39a32), W(0x466a24ef3908a253),
+     W(0x9cfe22d4dbea9f47)},
+    {W(0x13c8958660bf00b8), W(0x80a53cc6bacab333), W(0x73605c6d3be92507),
+     W(0xb4e1bd8e4e8a741c)},
+    0
+  },
+  {
+    {W(0xbafad037236a4c2c), W(0xfa8ec53b4ce9190d), W(0x6af0756e8df5229b),
+     W(0x6047decd2e22fbaa)},
+    {W(0x67314cfbc3001b12), W(0xbdb868739b470142), W(0x59d7ae02bf67c9a9),
+     W(0xd272f58473b0ea75)},
+    0
+  },
+  {
+    {W(0x33b31ea8edc450a3), W(0x74ddcba0223d7f87), W(0xbdb4ae672932fb9a),
+     W(0x875231ab307747be)},
+    {W(0xba98b0fe352989aa), W(0x619621d020290bf5), W(0x4148cdf127036f84),
+     W(0x3d70c87f12e163a5)},
+    0
+  },
+  {
+    {W(0xe3543c45dce06edd), W(0x349cc9624c71285b), W(0x2f351169cf89aede),
+     W(0x26d1aba3aa71e569)},
+    {W(0xafb1bf831080cc1e), W(0x1e750bf255fa5ebf), W(0x606afdbd3c2974aa),
+     W(0x9fd90e0f7b6e2bc9)},
+    0
+  },
+  {
+    {W(0x67961b1f0d15d9f1), W(0xf5bf85a596cd4d85), W(0x7a1dcccdb7856899),
+     W(0x0a6dfdd1c7c67771)},
+    {W(0x92dc68cd66436d92), W(0x56da62145ff605ac), W(0x06da60e331a19651),
+     W(0x5106a772160f3412)},
+    0
+  },
+  {
+    {W(0x1bc1a79638471a55), W(0x52fb08bd80f8f5d6), W(0x0fbb5f70dd5650a8),
+     W(0x39038d5e02153453)},
+    {W(0x21a8ab8d520ee793), W(0x44dda988645ebe9d), W(0xd74dc9c141343a77),
+     W(0xfcaddd4e52967bc6)},
+    0
+  },
+  {
+    {W(0x2474b0ecddaa6216), W(0xcf3463ce98a1543e), W(0x48df689c4ca20265),
+     W(0xb3c58555a2b00af6)},
+    {W(0xcd9df403c3ef74c9), W(0xb8a255d36d866aff), W(0xe45b45fdd54e1078),
+     W(0x3a94901ac64dfc7d)},
+    0
+  },
+  {
+    {W(0x5b3a39e02c11d392), W(0xd4d3d47717f9dbe3), W(0xe56820fdcf6ac0a1),
+     W(0xd962c1784546d37d)},
+    {W(0x5923157b465e3887), W(0xe32cb68a36e3e506), W(0x58fae387bbd48fa4),
+     W(0x0c1ab9c6d61b63b8)},
+    0
+  },
+  {
+    {W(0x7407647802f52702), W(0x7a0e0aa6c97f1184), W(0x849e512a4c240858),
+     W(0x3fe10cad11aed0cc)},
+    {W(0xe0a9118c3684ee9d), W(0xa440e7646921bcc1), W(0x43e39e4fe5c93724),
+     W(0xccccde97e4ebeafa)},
+    0
+  },
+  {
+    {W(0xc518007c6bff54c1), W(0xc19416bf1f5396e3), W(0xf64f7759fb4e04da),
+     W(0x64d09b9f2abd6dca)},
+    {W(0x74e961ab8fd843ec), W(0xaeefd83546902e79), W(0x5ccd4bbfc7161377),
+     W(0x140559e084368ac4)},
+    0
+  },
+  {
+    {W(0x8b31b93f1d75d15f), W(0x168832001517c90a), W(0x3daec6e246db6c14),
+     W(0x419f390081761cfa)},
+    {W(0xe0ea32e1bbc1ad66), W(0x33a3d3d2d6d509f5), W(0x7dd576bca7911cfd),
+     W(0x1fffb11f86487b03)},
+    0
+  },
+  {
+    {W(0xe1aa588af1ef2ca3), W(0x923931a3b7bf4013), W(0x64933967beae5459),
+     W(0x5f331a5b6915ea95)},
+    {W(0x9ead22c553616520), W(0x5fcc9997de6ca81b), W(0x739d0b19dc6b6324),
+     W(0x2ee20524a7996635)},
+    0
+  },
+  {
+    {W(0x8cb0f08b50bd54b3), W(0x96cf00f1e5f87a07), W(0xc4dddbfd12134aad),
+     W(0x1bafd43a58b78686)},
+    {W(0x7d0e86b4f81ed69e), W(0x6e0b56c566bd6982), W(0xa172bbe2dcb793da),
+     W(0x41bfdfbda616fc17)},
+    0
+  },
+  {
+    {W(0xd9ee3e7b2350d86b), W(0xe7c64754c29636c0), W(0x23346451d2a36eb0),
+     W(0x5fa2ce4d519bae83)},
+    {W(0x23870a1fc86dfd0c), W(0xe79bd49778187345), W(0x619173624bd73fd5),
+     W(0xf8511a5f5b2a3594)},
+    0
+  },
+  {
+    {W(0x69a4ad457c59f57e), W(0xfad223cd502f7721), W(0xf2c248956c7a7363),
+     W(0xf38a272c92d45fe0)},
+    {W(0x21346e7202f77a75), W(0xc00c385fe40c763e), W(0x6c687282309208a9),
+     W(0x1e5e71cf8ee1db65)},
+    0
+  },
+  {
+    {W(0x0bd89d37811ae2b0), W(0x2885b10424d009bb), W(0x57b9effd9517c95b),
+     W(0x9f8c491b4b15f723)},
+    {W(0xa2181846c52d3051), W(0x2ca502146ea6c1f7), W(0x3c1b5731566a9151),
+     W(0x2e535ad13eecb51c)},
+    0
+  },
+  {
+    {W(0xa97eb646dccc7ad6), W(0x9d24f9d4696fe28d), W(0x49a8e5740feae51d),
+     W(0x930fe7c681989c55)},
+    {W(0x1aa1d5e70d37ebdb), W(0xf59117f8c96f4a43), W(0x5cd2276420dcf4d4),
+     W(0xa501cdbf5087bc71)},
+    0
+  },
+  {
+    {W(0x88f8e99f613b6524), W(0xeac4873d2438adc4), W(0xa171196aaec11545),
+     W(0xb50788c79d3149f6)},
+    {W(0x8a6f3ef1b2a5ba79), W(0x19614434a35ccafa), W(0x641e5d94807ac6e0),
+     W(0x7a01d992e940e86a)},
+    0
+  },
+  {
+    {W(0x98f3e00f823d6e42), W(0x9b99ce018db214db), W(0x359860d85442ad93),
+     W(0x6d580b7ba5e417fb)},
+    {W(0x65dde4ce65cf5310), W(0xebfbc3d341195a53), W(0x16cf056ec935dda4),
+     W(0x6c2ed1f8de9cd16a)},
+    0
+  },
+  {
+    {W(0xfba65ce8f43887e4), W(0x3388de9329d9f275), W(0xe038ec66ee4aad19),
+     W(0x6b4bf6614da65273)},
+    {W(0x55135c871b552da7), W(0xcec169c23bd3fcbc), W(0x829c90a53e4e0aad),
+     W(0x02060e1a1b1b437e)},
+    0
+  },
+  {
+    {W(0xfffbaf74e2e8ccb4), W(0x00e8cf0dd843ebaa), W(0x5072850f7f62593a),
+     W(0x956f3e8fee85deed)},
+    {W(0xd347ac67a99a5d81), W(0x21fa978b89142095), W(0xcdd8f37c8938f2d4),
+     W(0xd128ffba23c82edb)},
+    0
+  },
+  {
+    {W(0xfbf228d7af8580b9), W(0x6ca8e35e1beb5e7f), W(0x1753458561c61bb9),
+     W(0xf72914075cd6e214)},
+    {W(0xefda9656d0a0cde7), W(0xdd4d81415a42cb95), W(0xdc8890a3e244c218),
+     W(0x72e207e518ee23bd)},
+    0
+  },
+  {
+    {W(0xf1b337ab87067836), W(0xfd3784c380192ce2), W(0x49df6e312a8f87a3),
+     W(0xa6de3726891210f6)},
+    {W(0x57f34be008d9151f), W(0xaf3a72811c708ec1), W(0x13afb10e75f7b1aa),
+     W(0xc5b8b6497fded725)},
+    0
+  },
+  {
+    {W(0x9dbbf40cd42affef), W(0x7f92626530866abb), W(0xc408b3d6bd89ee35),
+     W(0x21ba4026ffaa143e)},
+    {W(0x2a76a9b4daca25aa), W(0x75834a013b030616), W(0xf6ba97c752d73c5a),
+     W(0x9410013ce622423b)},
+    0
+  },
+  {
+    {W(0x75c4ae038d87556d), W(0x31a79442a48cbb42), W(0xb320456652662d5b),
+     W(0x8f8640da6179a933)},
+    {W(0x6998afd94c08ea28), W(0x5438ce717d38ad2f), W(0x4b5a3b406c9c68df),
+     W(0x4bb9dea2df8c2dbc)},
+    0
+  },
+  {
+    {W(0xe1f0d09ba31ac321), W(0x061052ea734780db), W(0x290bb18b1282456c),
+     W(0x89ea44c378047899)},
+    {W(0x68fc3db2b747de1d), W(0xf2f22c49e1b95c3b), W(0xdddf94684b20d678),
+     W(0x85f2a578968f3f30)},
+    0
+  },
+  {
+    {W(0xbe862d7517d7919f), W(0x123e331af5788319), W(0xb84a0702ce325427),
+     W(0xdacea9954f80e53f)},
+    {W(0x32480dcb7781263d), W(0x220b047abb88a36d), W(0xcde487b02936f40b),
+     W(0x9a05a9127e3c0eb2)},
+    0
+  },
+  {
+    {W(0x12e2f57ef88e31d2), W(0xe612a5ef359c3026), W(0x43a582d7341628e5),
+     W(0xd48311cbfff2ee9d)},
+    {W(0xb4dd93734220477f), W(0x3db61969d385cf7b), W(0x9fd7b5ed04c2d8d6),
+     W(0x04ccc978916a0c4b)},
+    0
+  },
+  {
+    {W(0xb571fc21bb5d6426), W(0xfc183dcf9d45d180), W(0xab4f2bb29f6aa31d),
+     W(0x5b90a7d3d01b4033)},
+    {W(0x17f3882284d7c398), W(0x4ac98312bacf9e3a), W(0x2d230af95426b5a0),
+     W(0xcd272cdd3686c3f3)},
+    0
+  },
+  {
+    {W(0x558e3cdf33d41915), W(0xd756b3d03a71f7fc), W(0xbff3e7e63dd0895f),
+     W(0x3f41b5eca0f81921)},
+    {W(0xfb04473d1108df71), W(0xdc5933aba05a5213), W(0x57a852fbae36a568),
+     W(0xd977496710a79eb9)},
+    0
+  },
+  {
+    {W(0x8d7bfa6ff15fa3b9), W(0xbb42a897bea761a1), W(0x3ecb951d33bfe052),
+     W(0xf6e5e54a5e0269cb)},
+    {W(0xf92c0a9cd182dbef), W(0x1675b91307db17ee), W(0x6956b9fb305b6dc0),
+     W(0x449e0cdf278e029b)},
+    0
+  },
+  {
+    {W(0xb857dcf40f22c541), W(0x3dab4fc54c5f71dc), W(0x4566ff786e118cf7),
+     W(0x2ed974ccf8ebb5ff)},
+    {W(0xbd565d0086cfafd9), W(0x064064212cd8edea), W(0xa1595477c9a2fc4b),
+     W(0x8f3ffd200d6d9cce)},
+    0
+  },
+  {
+    {W(0xe0ada8e5f24d2570), W(0x8c05f97012b5c7da), W(0x13d3fb46c4eca298),
+     W(0xfd9e059302a011bf)},
+    {W(0xf6f0fc85d8c9a44b), W(0x8b78c3936911d91f), W(0xb85d810d9ed4cd94),
+     W(0x9a4205d020a8a9cc)},
+    0
+  },
+  {
+    {W(0x6df47fdaaaefc456), W(0x045eee6984b24307), W(0x01bc5aaee0f58dcc),
+     W(0x78729f28555b8df8)},
+    {W(0xf1eeb05972392838), W(0x8ca11840f3857c76), W(0x1569b9fc07759a50),
+     W(0x246295ac982924b2)},
+    0
+  },
+  {
+    {W(0x864cf638b2c203f3), W(0x82e81bcded24246c), W(0x3fb03ff933ba3294),
+     W(0xe03f63da73146be5)},
+    {W(0x5790d9336162cd93), W(0xabf26709617c6805), W(0x4c80c2437c0143da),
+     W(0xd83408d44d3dc499)},
+    0
+  },
+  {
+    {W(0x369d46c72fd22bf8), W(0x37a68e9c5ccd36a9), W(0x13bc5d7f5b55b00c),
+     W(0x3c8b729d1443b6ec)},
+    {W(0x01067c3a09ec2933), W(0xccc858577dd29e5a), W(0xe6e5b590ea7a0793),
+     W(0x2eee6cce4321332f)},
+    0
+  },
+  {
+    {W(0x746d5f9facda2bed), W(0x5f4370186b798975), W(0x3fed93c4261f8777),
+     W(0xff29bee8eaa3a937)},
+    {W(0x1c48b1c645a0c6fa), W(0xe98c75abfdea200e), W(0x82241afd67e0dec3),
+     W(0xfc6da2b9b9e1934a)},
+    0
+  },
+  {
+    {W(0xa246afbccbce1f57), W(0x826b1e375eaaa5e2), W(0xb45cb276f959c8da),
+     W(0x286c1bec35975921)},
+    {W(0xdb61ad8095d074a5), W(0xf2f843443d730f41), W(0x970d42a670437867),
+     W(0xa334e84e86c05b9d)},
+    0
+  },
+  {
+    {W(0x60c96d8160ced692), W(0xe0cc253e252e8fa7), W(0x8ec018c702467e5e),
+     W(0x96733b812cf6f159)},
+    {W(0x5172f0858fcda361), W(0x16165aaa220e9581), W(0x5781590b672536b2),
+     W(0x8727f6828ecef32e)},
+    0
+  },
+  {
+    {W(0x2a26b94f7e2b582c), W(0xc1aef2079b9b7a21), W(0x4b8c667cfa7ae8a0),
+     W(0x3a88f66061b01b03)},
+    {W(0xc973f79c3708b15d), W(0xd4a3f44cccae217f), W(0xb4b011b93f6cbaaa),
+     W(0x527542a67c7a580e)},
+    0
+  },
+  {
+    {W(0x250dccb028504526), W(0x368023fae32f930d), W(0x799b11095b1d6bdb),
+     W(0xe0738c8d7ca8cbf9)},
+    {W(0x62a3e865a7b71636), W(0x13bebb342713afe6), W(0x79fbb47c6a88ca8f),
+     W(0xe244956e51d82930)},
+    0
+  },
+  {
+    {W(0xc9b3dc9440abeb5e), W(0xc78e6cbe06dab75e), W(0xa075376714357e70),
+     W(0xf279d901c32bd7bc)},
+    {W(0x8503b2018c356ccd), W(0x0c05b5f99273c822), W(0xa6219b2daa8470af),
+     W(0x56fbe4d2b73f2b69)},
+    0
+  },
+  {
+    {W(0x8adc8c684e0a7866), W(0x35d234189f6a2d21), W(0x17df3f5e8e79511b),
+     W(0xb9ba84efae5f2e8f)},
+    {W(0x1758174b11eb36c6), W(0xf965da1a4ebff02e), W(0xa681f4128af4c544),
+     W(0xcd0bfbc875f02789)},
+    0
+  },
+  {
+    {W(0xe18e337989a32a78), W(0x862198c215ed0224), W(0x609766fca2b3ac3c),
+     W(0xf6536e2a952f826e)},
+    {W(0x2054cd413a7f225e), W(0xb0b75f54861caa0b), W(0x3cde3f2fcddfc4c9),
+     W(0xa3f4dbfac0cebdcf)},
+    0
+  },
+  {
+    {W(0xdf0670d97de64477), W(0x18619c1e7364e5b0), W(0x55507a2d236bd928),
+     W(0x208bf075facade60)},
+    {W(0x532d358f090e3f12), W(0x6b3055fb43fdb99d), W(0x9bbeb18aa4808228),
+     W(0x882421384f214f32)},
+    0
+  },
+  {
+    {W(0x716713cc5ce9a3cb), W(0xb929ad8cf4c4494e), W(0x5faabfbae76f1861),
+     W(0x45f26a95811a36e5)},
+    {W(0xcec0bb93466569a4), W(0xb670656137b1c705), W(0x5f560e0a82cd59ab),
+     W(0x817b3b164e7b16da)},
+    0
+  },
+  {
+    {W(0xe7d384af456b5dc2), W(0x0e19a1074ee0c00a), W(0x099a619a287e972e),
+     W(0x48de3c7a77b7774a)},
+    {W(0x6ece5da4bde3be8d), W(0xea022181ff7256d3), W(0x2225efde14ecea69),
+     W(0x613a7d7783548fd7)},
+    0
+  },
+  {
+    {W(0xb37698e7a36526aa), W(0xf93b30e163892e13), W(0x0dafbb986f173688),
+     W(0x765e66c90eaa56dd)},
+    {W(0xbdf2bc97e648d706), W(0x7deb829c40342db7), W(0xc1dda4175d9b4e58),
+     W(0xd56f3ba9a1564a94)},
+    0
+  },
+  {
+    {W(0x5cbb82a3d349c9ce), W(0x3026b5fe5fdcc4fc), W(0xc744097edc6df811),
+     W(0x329ee0b5292c0237)},
+    {W(0xe333f325da2c63fb), W(0x903abd45df0641cf), W(0xb29c3137fdc2e1e6),
+     W(0x73278377d1837f5b)},
+    0
+  },
+  {
+    {W(0xf91ef0224c5c13e5), W(0x808e528de5b2f105), W(0xaa8306a3f8be0984),
+     W(0x77d93af35adc4f7a)},
+    {W(0x6b26ce9f8d311a7c), W(0xc0757266dd485429), W(0x0b223aad44c16a03),
+     W(0x1bc8111522a1fc89)},
+    0
+  },
+  {
+    {W(0xa637d090b536efa0), W(0x22a082ed6f5b604f), W(0x436e2bc99707b350),
+     W(0x5d1c1ef7fff67f59)},
+    {W(0x4e3b36e483deae4b), W(0x5f82da681db63127), W(0xcd1be09cf8f65807),
+     W(0xb98d602e2f19a509)},
+    0
+  },
+  {
+    {W(0xd26d1a789883df5f), W(0xce20d7f8afec3ef7), W(0x6b2ce23052c8273c),
+     W(0x5a4a5d6fe65217bf)},
+    {W(0xdbb7f71651f68973), W(0x80bb917d93a6bf47), W(0x1967f4a379a1f33b),
+     W(0x875bba715dfc9b3c)},
+    0
+  },
+  {
+    {W(0x6a421e81534d5d9a), W(0x7e899f51ea9347c7), W(0x2d0dcec645c9f694),
+     W(0x2dd76f0e72f226c5)},
+    {W(0xa50b949df6673b28), W(0xe4213aa2b56bba3e), W(0xd5daab4abadc01c6),
+     W(0xf885b7c21023e962)},
+    0
+  },
+  {
+    {W(0xf051ce5a153a490b), W(0xae8a126958132191), W(0xe4ea031adba55b06),
+     W(0xfeec85b95f6a1e2b)},
+    {W(0xe129545e0578f4e0), W(0x5f99d4165c422873), W(0x9c77b4129fc81e1a),
+     W(0x3475c83875363be1)},
+    0
+  },
+  {
+    {W(0xa2244e409ca6b9e3), W(0x8fc1e54097830c52), W(0x2cd09f206c1a5c14),
+     W(0xa977a267c5b21ccc)},
+    {W(0x284e433c4fd2be5a), W(0x83d38a5d4df46f97), W(0xd0b6d2b08bfaec9c),
+     W(0xd1fabc9404f16b88)},
+    0
+  },
+  {
+    {W(0x82334360b1c9c691), W(0x85b5c0d579c26593), W(0x3b14134a899bc9a6),
+     W(0xc804c5a4485f8d56)},
+    {W(0x346ee7bdc59023dd), W(0x0aa6f37de272eb0d), W(0xa8439d3d0a501a0f),
+     W(0x07b90ceab969d921)},
+    0
+  },
+  {
+    {W(0x0d550e220c68b5bc), W(0xb9f4d0ce04646598), W(0x5b6e21050eb6721a),
+     W(0x91ae93bd1b805801)},
+    {W(0xf77d100129b04d6e), W(0x1aa5b156e52cab32), W(0x0c0f88354e58a63d),
+     W(0xe1a43bceabc18d3a)},
+    0
+  },
+  {
+    {W(0x45c7127497a240ec), W(0x2b1cc69da4de90f6), W(0x98cbfcc7d88c9fbf),
+     W(0x0196e0c6b40a4005)},
+    {W(0x2768bb1ef68b6fe5), W(0x4ed040e913a849c0), W(0x6581ef5276128f5e),
+     W(0x8848ab766a91a82a)},
+    0
+  },
+  {
+    {W(0xa2faf4c3762ca1f9), W(0xb80ba01eb2beae09), W(0x2d03e09bf094dae1),
+     W(0xad41e791de6f0263)},
+    {W(0x7ceaa68a964106e1), W(0xd7b0ea9b43dc301a), W(0x7fdcbfc5113d0f18),
+     W(0x3c0e77132b808029)},
+    0
+  },
+  {
+    {W(0xae34b858229652a4), W(0xd7ee1ca0772ba4f1), W(0x72e5a1ca4f59df2b),
+     W(0x77c624a8f718c398)},
+    {W(0x5f7ce02bf6aa29f1), W(0x74283e78748a9457), W(0xee2758b019fcf72e),
+     W(0xf29ca22442bf1179)},
+    0
+  },
+  {
+    {W(0xdd8da18f58ec6cd1), W(0x05d09551676ef6fe), W(0x65d078295d9a6528),
+     W(0xb6bcf6142b156b92)},
+    {W(0xe6a16c5a4c269fde), W(0x5f1fa70713968c52), W(0x824d077e2e7d7ea1),
+     W(0xb90acdd3373fc561)},
+    0
+  },
+  {
+    {W(0xad0baec7943de409), W(0x0c08df338f660478), W(0x1b6d4ac94e58906d),
+     W(0x77682947dff451a3)},
+    {W(0xe074b3bfedd2a11a), W(0x5d560ef96dbd945b), W(0x4f9d7deabbe6f9b3),
+     W(0x5f159b9a04779e9e)},
+    0
+  },
+  {
+    {W(0x760d1711e74e39d3), W(0x005864deb4de45de), W(0xc2dee76724ffff9c),
+     W(0xd08eed130348d5bd)},
+    {W(0x39d13bd3b1d30abe), W(0x8c6be56b5b41b81c), W(0x6b423dfce76984fd),
+     W(0xa9c462356845cad5)},
+    0
+  },
+  {
+    {W(0x1a8f200adfc4269a), W(0xf34a5a5ee53d2cc9), W(0x9a331acbf1c22bd4),
+     W(0xbf5eca49f7ab72ad)},
+    {W(0xab595ac43ce01c1a), W(0xdf0b40176db892e7), W(0x714fb881251c6849),
+     W(0xea50b4285facf06f)},
+    0
+  },
+  {
+    {W(0x4ae6e634d7fd992a), W(0x57cbe24652230589), W(0xff4987d56ceda2f8),
+     W(0xbc01ee14f16da68e)},
+    {W(0xce65139cf25bdb6a), W(0xb0ad613c87d27c65), W(0xa4a14aa9ea4ed8a1),
+     W(0x4f4178ab0e39aa6f)},
+    0
+  },
+  {
+    {W(0xf6901140986e3656), W(0x2128cf6b860a8357), W(0x21c2c9c5f24699fc),
+     W(0x2eb392d4c3945d5d)},
+    {W(0xbe7f4cea4ce14c79), W(0xf962056e3c64de64), W(0x5b5acdc2b8aab135),
+     W(0xbfe81f857b905b2f)},
+    0
+  },
+  {
+    {W(0x82eeb64ac14ced4a), W(0xc3a4890335b20401), W(0x3d62121c68a2cbcd),
+     W(0x5e7e95d8fb17c150)},
+    {W(0xc48f40b785468fd4), W(0xcfb38abd8799558f), W(0x9ff4da34ca53ddc4),
+     W(0x9b0464b7195fa95f)},
+    0
+  },
+  {
+    {W(0x2573309f3b71c148), W(0xcf8fc75e703e249b), W(0x22ba1cc6a3959fd8),
+     W(0xbf76c366cf7e084f)},
+    {W(0x9d7d7db76376c3bb), W(0xf8c1b92e52470643), W(0x09cfc390b2e51ce9),
+     W(0x8181130488b1784f)},
+    0
+  },
+  {
+    {W(0x1277a98c369f0030), W(0xd4d164c63bccb710), W(0xf8fc829cb62873f6),
+     W(0xed978497a92b845e)},
+    {W(0x7ae7e2a283355b73), W(0x9aa85d8830b0a559), W(0x752e1478973079f3),
+     W(0xfd2c90d9145f1b21)},
+    0
+  },
+  {
+    {W(0x53861f9634f54954), W(0xa903942523498e43), W(0x36a43e86807f67ca),
+     W(0x08da673cbc12e2ef)},
+    {W(0xb25db5af52ebb71d), W(0x032cd0fdfec4a00b), W(0xc9f0a880711ee224),
+     W(0xe6270c6edeb7de25)},
+    0
+  },
+  {
+    {W(0x75d3a0b11e1ef43b), W(0xbe90a43748cc4f99), W(0xf90a6fece84bb2bf),
+     W(0x4ed6eb9da299611e)},
+    {W(0x3a45f937acaf6a24), W(0x8367b22ebef25d4e), W(0x284260a6b1e0b593),
+     W(0x642a11898f10e69d)},
+    0
+  },
+  {
+    {W(0xc6e5dc364a93d9ad), W(0xe1998e71b586bfe1), W(0xa166a3b62712e399),
+     W(0x4a2d5dcdf7c0edf9)},
+    {W(0x4784e79b44e75a32), W(0x49e71b968b18f997), W(0x0b6382166b999481),
+     W(0x13bedb03ea6e88b3)},
+    0
+  },
+  {
+    {W(0xe94c9c2338628ea4), W(0x72b0e4cbc875c71b), W(0xb4b4d0d153406268),
+     W(0x23dde9a89b369ed1)},
+    {W(0x899666fd0bf3c188), W(0x78a5a9add0d15061), W(0x39e7104fdbddb666),
+     W(0x578067082b841b3f)},
+    0
+  },
+  {
+    {W(0x837b75c7f2e8e699), W(0xfa9f1cc88e0637f2), W(0x7ae18a5d8c10e2cf),
+     W(0xcc2e60d1a1efbb09)},
+    {W(0xff76df62b1a30063), W(0x43106c1e4bef692d), W(0xc6c8bb955a0dd610),
+     W(0xf1cb3c612f7c7825)},
+    0
+  },
+  {
+    {W(0xe5c37722ff8c0f71), W(0x68aa365734dbfecb), W(0x1408f746ffacfbad),
+     W(0xec38b82699566161)},
+    {W(0x1b2d6f1b887371a4), W(0xdad250b8bfc044ca), W(0xd0878954ac31f7d0),
+     W(0x1251fc26c3503bfe)},
+    0
+  },
+  {
+    {W(0x794c2ae9c38cbfb5), W(0xab84afa33024c588), W(0xfcb38abd75ffeecc),
+     W(0x53a492aec31e0736)},
+    {W(0x1994779adbc9890b), W(0x618de7f6fdd63b35), W(0x2e327831096e0161),
+     W(0xd35a09ffebc57952)},
+    0
+  },
+  {
+    {W(0xfdbb220b4043e6c4), W(0x851c00cdf44d672d), W(0x4fa5d33e195282c7),
+     W(0x4b58ab98c8c03cf9)},
+    {W(0xa127d25f199126ba), W(0x01393e9bb08ea8f3), W(0xb59d30b7c75b2b57),
+     W(0xd4f63f017af32b07)},
+    0
+  },
+  {
+    {W(0x9a918944bac7b6a5), W(0x26989bbaf9ee59c7), W(0x0d885b2f56e04a7a),
+     W(0x206a0dcb94331d36)},
+    {W(0x780abcc057636a47), W(0xa002849f0acdcd11), W(0x810ee20b80a6ce87),
+     W(0x201d25425cbe496d)},
+    0
+  },
+  {
+    {W(0x78cb94913f7ede9d), W(0x708e169ff8dfd4cf), W(0x4aee4b33e65b57b8),
+     W(0x42edde5ab878b5eb)},
+    {W(0xbb38410d925ce161), W(0xe6fe0750209fb2e9), W(0x52c9f1822ab6c4de),
+     W(0xd5cdc52d6105b3c3)},
+    0
+  },
+  {
+    {W(0xe9ad5be40353c7b3), W(0x4ca68f15bdecebaa), W(0x7c29e829b52dcee4),
+     W(0xb38d17698ee01e00)},
+    {W(0x666f5f5772adb5be), W(0xe2f412a178252710), W(0x2578f04213dc0c74),
+     W(0x1d59438ea7bfc34f)},
+    0
+  },
+  {
+    {W(0xf05e1a175b593df3), W(0xce245fd6988647a6), W(0x933777e2a326047a),
+     W(0x9b75a218b166b7f2)},
+    {W(0x9a5ee6fbbe313c7e), W(0x8c369a0807c0b82b), W(0x348fcfd57eebc2b8),
+     W(0x71618e913864ddce)},
+    0
+  },
+  {
+    {W(0xd4cc57e60241ec15), W(0xfbea1710276203ae), W(0x786fafc3300bb862),
+     W(0x9cbf293579b7727b)},
+    {W(0x4bd48fc632134e71), W(0x16718be6ed6d3145), W(0x87cce46c9a9fa17f),
+     W(0xbc7bd40c0bdd8dcc)},
+    0
+  },
+  {
+    {W(0xf77212d6c109edd9), W(0x2cc0b1b6829e9d4a), W(0xd97c599bab96ed7b),
+     W(0x997a86edde0d78f7)},
+    {W(0x1940132da260f80b), W(0xb426f49595768866), W(0x119eac9b4950487c),
+     W(0xa637bb1d9df127be)},
+    0
+  },
+  {
+    {W(0xf13d4545920f4986), W(0x126da9361e1678df), W(0xefebcf1915eed370),
+     W(0xf62221f373c08775)},
+    {W(0x24a23e55aca3f909), W(0x41cc70502548e66a), W(0xb0c084547a9ff157),
+     W(0xfb59441c9c40f273)},
+    0
+  },
+  {
+    {W(0x149f99b71d8f6c9e), W(0xb8104dd2e50288f2), W(0x428d8ed36781c22d),
+     W(0x5c9ed4574dc5adcf)},
+    {W(0x8fc4cd4802120b28), W(0xbb55b10f5b88e6e5), W(0x875a1e469009fdec),
+     W(0xaa265c2058a2fe1e)},
+    0
+  },
+  {
+    {W(0xe1e3890fad83db4e), W(0x3fb533e5e66672ea), W(0x3097ce580b6834d7),
+     W(0x641a5282409a411b)},
+    {W(0x7bf37fc53d8dda12), W(0x17aa1232631bae80), W(0xda42794a9959188b),
+     W(0xfd417eaaac91346b)},
+    0
+  },
+  {
+    {W(0x81a12a7a6d7125db), W(0x93b3ee0b99777af3), W(0xf6c2032a5255d157),
+     W(0x55c701a5059ae742)},
+    {W(0xf59968ce82c1e884), W(0xe430f238de8dbf0a), W(0x0e7c2ff469360e73),
+     W(0xd354aecb288068c9)},
+    0
+  },
+  {
+    {W(0xddd234cca90f70e2), W(0x7b8d06b3365edefe), W(0x85a0a31957b4d87b),
+     W(0xa6b084a0a0bac244)},
+    {W(0x6b73a19adc9c0c5e), W(0x7900aae5d76ba82c), W(0x735f4446809adf3b),
+     W(0x3e8080cebbc8f5a9)},
+    0
+  },
+  {
+    {W(0xbb4c5b59684378fd), W(0xda1dbb08d7265984), W(0x3d21128989f5d825),
+     W(0x328de8eee1903a11)},
+    {W(0xef6b509aad432355), W(0xceb21e29ab7b9861), W(0xfe48598d1daf9090),
+     W(0x96308de68c7cb0aa)},
+    0
+  },
+  {
+    {W(0xed366571484875c0), W(0x3148b9423ebff714), W(0xbec25eb6dfbe1f2b),
+     W(0x14a1922fae45b4bc)},
+    {W(0x14f93f6561b3cab7), W(0xe8dc7c24d9b19f30), W(0x6f5af8caf61b622b),
+     W(0x412ce68800ba7487)},
+    0
+  },
+  {
+    {W(0x880379db4d354b80), W(0xb7ccff185ff185a0), W(0xbc46f519af0ceb7c),
+     W(0xdfefe1e5c3bd9403)},
+    {W(0xf1383edef5cae6c8), W(0x89abfc0c9823d852), W(0x194d6f0c43b6bc02),
+     W(0x59e695dcfba6e5d5)},
+    0
+  },
+  {
+    {W(0x1b19ec4bff2717da), W(0x5a1561b22a9b68b4), W(0xdb4a89bbf1a27586),
+     W(0x580effb40a92382c)},
+    {W(0xc8c4a02b318d7a90), W(0x6fe58afef0da549f), W(0x70847e12219143fd),
+     W(0x7498cac0134a5ee7)},
+    0
+  },
+  {
+    {W(0x61d95df2d5ec374d), W(0x0b0890fd398e2fd5), W(0xe21f7b1c8b6c5d5f),
+     W(0x8d66c6776a74b18b)},
+    {W(0xe504da22ca4c17de), W(0xc41a4454dd9bb42c), W(0x5fc9a285bd044c58),
+     W(0xf7d81d4500f5fb1b)},
+    0
+  },
+  {
+    {W(0x46b00bd497b96829), W(0x918cd8482e6a1c8c), W(0x913510f7def48933),
+     W(0x9df0c84671792f41)},
+    {W(0xbc786762c65e8d71), W(0xf876e0548e303acb), W(0x1ad5cf3fb5d142ed),
+     W(0x6782b38b55e66bb3)},
+    0
+  },
+  {
+    {W(0x7576c1ff6b642a65), W(0x25c847b4eeb84698), W(0xddb6f5e56f4109e9),
+     W(0x481bc3423fa24ea0)},
+    {W(0x7b591db5eb44c004), W(0xa2bf4b143c58af07), W(0xec2697b53f50dce4),
+     W(0xf94a48266b8a58d0)},
+    0
+  },
+  {
+    {W(0xdc15e2648b0894e9), W(0x380781a0c6e2b407), W(0xcb4112c95a5b7f63),
+     W(0x4af1860c4256a214)},
+    {W(0x53dc9acaa17a0aad), W(0x5138120eea1a8f97), W(0xe99e9286728406c8),
+     W(0x3a76a5604b1ff36e)},
+    0
+  },
+  {
+    {W(0x95cdf80ab19634f5), W(0x5f0103c3c19c54ee), W(0x0e57e56a25c4c981),
+     W(0xb1a77cd8d46e09b9)},
+    {W(0xbc8bf33d2f14f860), W(0x6a49697d143bd980), W(0x31ea4793e162ccce),
+     W(0xf64a00a671991676)},
+    0
+  },
+  {
+    {W(0x1f189aa64b9137a2), W(0x3a7884a5d8de387b), W(0x988ff5a3e5c812cd),
+     W(0x209313caedd08d25)},
+    {W(0x03e95ef044970977), W(0x559ba3ff78c4933a), W(0xe61ddf029ff7ee5d),
+     W(0xc9009dcc1e296668)},
+    0
+  },
+  {
+    {W(0x2eeef24dc6ada40d), W(0xd9be250a4a0279c4), W(0x73edbab9193b5d89),
+     W(0xf04fe61e780f5d23)},
+    {W(0x01b5b3ed9e11e77e), W(0xb7aedfdac5543423), W(0x4fbf95cf2fadc83b),
+     W(0x8fd4c679c61725dc)},
+    0
+  },
+  {
+    {W(0x847f92180a3ebe88), W(0x4249c6a1bd8fc70e), W(0x8d749f88f077a964),
+     W(0x1cf6239fce38dd17)},
+    {W(0xbe17e263f2960659), W(0xf59bcaed09c77249), W(0xf551fc2c0a50a7fa),
+     W(0x221f6e46a6d2bd15)},
+    0
+  },
+  {
+    {W(0xaaf5d19cc80e7391), W(0xf53857515b55e101), W(0xf518c7436e7902ad),
+     W(0x457a3a4f4b5f9e21)},
+    {W(0xdbe966f4ab59b4c0), W(0x44e90b95705de21e), W(0x62965ac680e8b4de),
+     W(0xece435909950e00d)},
+    0
+  },
+  {
+    {W(0x4cdc1776a9e72ff6), W(0xf49927e508fc9840), W(0x51cf7c0214b86fe5),
+     W(0x3daf02438ebf9668)},
+    {W(0x59941af2e00d7b13), W(0x234c23bd54dc4cb4), W(0x37e43cc3d0b60dba),
+     W(0xa0113d7938bbef3a)},
+    0
+  },
+  {
+    {W(0xb8eaac600fc8b6a0), W(0x6b6775ae50f9cad2), W(0x6e6a69a91c3181ce),
+     W(0x7a75900892215b44)},
+    {W(0xe02e796d6a0f9691), W(0x1b0b09c2c7997440), W(0x30b9a77dbc2ca755),
+     W(0xd4c9173c8708b06e)},
+    0
+  },
+  {
+    {W(0x65bef3e250c58286), W(0x5f6a7eefc53c5324), W(0x2ee4c7c8af027a09),
+     W(0xb298616b49dffd8b)},
+    {W(0x913733de51a149cc), W(0x2f70ef8e674c951d), W(0xd4c35dca1c25c1df),
+     W(0x138067132ecdd1f4)},
+    0
+  },
+  {
+    {W(0xa1a0a149d9290035), W(0x4b07974fff4cd985), W(0xf9494bdb4be05b43),
+     W(0xb10bdeb2a2aa06ca)},
+    {W(0xa53eb7984e3f686a), W(0x4f2032bf76e8cc5a), W(0x760abac1600f8adc),
+     W(0x4bb0f38638001488)},
+    0
+  },
+  {
+    {W(0x1703e726de2053dd), W(0x764f1fda266b020d), W(0xe01e44f6e16763f1),
+     W(0x81233eef9f4276a8)},
+    {W(0x8b0196876681eaf6), W(0x0796ce2322ae8539), W(0x8aee8fb3ee99a22e),
+     W(0x708a6bd2a16a8dc2)},
+    0
+  },
+  {
+    {W(0x788884c329f82ff6), W(0x5cabf2644b3c469a), W(0x7436b49d98917589),
+     W(0x2c9d5df1d9d9f2c7)},
+    {W(0xccdfa16dd980e5c2), W(0x3251e5405e866ece), W(0x030e2c086495604a),
+     W(0xa4108efc132574a1)},
+    0
+  },
+  {
+    {W(0x8189618e07b8a5c6), W(0x12d18d3ba024cc64), W(0x5b307930ddd12ef7),
+     W(0xe0122dae6808e06a)},
+    {W(0x69bfc8baccd90292), W(0x4aecb7d4f684d5b6), W(0xa50f23b053b30e90),
+     W(0xb5adae40f3ceb82b)},
+    0
+  },
+  {
+    {W(0x9246f8eb1a99ce66), W(0x48b81d4e4960e249), W(0xff2f28c8c91cd4f8),
+     W(0xff0598dfb54170a6)},
+    {W(0x54662ac392e91fb0), W(0x689d0b70c937e1d2), W(0x82dc33b6e8e00b12),
+     W(0xcf678af41c0ef462)},
+    0
+  },
+  {
+    {W(0x64f5de9690c7a6a3), W(0xba0ca41390149e20), W(0xd2782b628d603210),
+     W(0xe304ce68e8ddac23)},
+    {W(0xb531f1a821f9609e), W(0x88da2b1b00b62609), W(0x193ba66170a86a6c),
+     W(0x42a8d00764f64a38)},
+    0
+  },
+  {
+    {W(0x60410c61aacdc3c2), W(0x272ee4838c193969), W(0x5ecafe7d07e1d237),
+     W(0x56115637a737e4c3)},
+    {W(0x753d72a9c5b7c2dc), W(0xe0f05788374eb6ed), W(0x8621a0405ba1ee46),
+     W(0x21a3f1e9bb7e924c)},
+    0
+  },
+  {
+    {W(0x36d8a54e44075dd0), W(0x8a9b176c7e5c3fe6), W(0x1a36da6e4830ae6c),
+     W(0x794b48524b940657)},
+    {W(0x9281dc51cb789f60), W(0xb66d9bf2f44e8f2b), W(0x68f8d23d32fd816b),
+     W(0x62224460e0aebe28)},
+    0
+  },
+  {
+    {W(0x20d1f942d89c5a95), W(0x3a00da9c10868a58), W(0x3513b38de891cccc),
+     W(0xdd53a980cc3603f5)},
+    {W(0x5ca3866859a81f73), W(0x6ed055d3baf4d2de), W(0xc58bba5476d5693f),
+     W(0x3a18a18554fadd26)},
+    0
+  },
+  {
+    {W(0x5618938fa4da6e1a), W(0x20fc67c1a4b94751), W(0x531877acd7f4ce45),
+     W(0x844465d101497e56)},
+    {W(0x678a03ea9e066841), W(0xfa9feec852e57492), W(0xd428e625396dd385),
+     W(0x4fe2b9ddba4e0a2d)},
+    0
+  },
+  {
+    {W(0x301eccadf15472ee), W(0xbd4142c2ec1b2cd5), W(0x92ff794276d47292),
+     W(0x743e4f52227e2af0)},
+    {W(0xb079f875c96135ad), W(0x8ca8cf2f36c5f625), W(0xb6e7c020f58fee96),
+     W(0x963bd590e6fc583a)},
+    0
+  },
+  {
+    {W(0xdfc5410609367489), W(0xe5347cd4cf2501b5), W(0x494d64c3095dc64e),
+     W(0xb002839364a69270)},
+    {W(0x0e68d2f9560ec229), W(0x4f6307252e31f95e), W(0x351b375546635418),
+     W(0x6611fb94f00e0886)},
+    0
+  },
+  {
+    {W(0xb91e65761ef3bc03), W(0x53f8de6fb9d19e7a), W(0x16c8d0e101f0a9e4),
+     W(0xbb22d14a6fc0ce99)},
+    {W(0x3fcdf92c5004084e), W(0x3417b416bcf4715f), W(0xfcaefe91ba0fc311),
+     W(0xff791228c10e0af1)},
+    0
+  },
+  {
+    {W(0x705f33a31133fcea), W(0x346c0e6d60939fd9), W(0x8ebf290477118af0),
+     W(0x418589192678e22c)},
+    {W(0xfec2e88643223e71), W(0x832449d8673231b4), W(0xc14993a94aa6bfb5),
+     W(0x1b33b365035d40a2)},
+    0
+  },
+  {
+    {W(0x679316e7cdf0c81a), W(0x0f9dff097ef66377), W(0xe47f33d06f21149b),
+     W(0x973e6998c447aed2)},
+    {W(0x5f67293f337cd1b1), W(0x68d6b0dca16d55b6), W(0x8fdf5cf6b376aa98),
+     W(0x07e2db6ce75ccf16)},
+    0
+  },
+  {
+    {W(0xe2ff140565152126), W(0x4c3d20feaa0a27c0), W(0xbb792dced5a082e0),
+     W(0xbdf1335921bba6c8)},
+    {W(0xd387092e074d7f98), W(0x2e2e057999db35f6), W(0x975dc28436834f72),
+     W(0xf6210d2cf4b7a581)},
+    0
+  },
+  {
+    {W(0xef0b06ae4cdcc970), W(0xde23ce01aa484d30), W(0x5239f5e9c8d2eafd),
+     W(0xb040be31f1226c27)},
+    {W(0xffd14e83bfba11f9), W(0x65b5eed68896ad3d), W(0x368a82d922a3ca4d),
+     W(0x53b5abaa87c3583c)},
+    0
+  },
+  {
+    {W(0x6c95d6b3f20d50a3), W(0x445cbc59564e3b86), W(0xa386de68d357b51d),
+     W(0x5fd4fe21631df161)},
+    {W(0xd297f39783c31a0d), W(0xe80f4d8de385f370), W(0xec3dc3b997331b28),
+     W(0x305a2402f86befee)},
+    0
+  },
+  {
+    {W(0xf4d7aa29c191a38b), W(0x80b636bdfc4ae342), W(0x2d8384c830f45ce2),
+     W(0x6f0257dbfa676422)},
+    {W(0x30cff22bc9fc6658), W(0xf224adf707108ed3), W(0x01889c718f98053a),
+     W(0x0dee5f22805199eb)},
+    0
+  },
+  {
+    {W(0x68865bcdb6c3de03), W(0xd022ee7e5a0bff35), W(0xe79631a577ada982),
+     W(0x20ace42b36a58850)},
+    {W(0x546d354ed3680e2b), W(0x7f9d427b2fcd4578), W(0xd7a2eba1270df0f9),
+     W(0x01e58513c8a64a48)},
+    0
+  },
+  {
+    {W(0xaa2d9697074a138f), W(0xf893e2794ba90667), W(0xee35b15615574b06),
+     W(0x48bb41045bda82de)},
+    {W(0x815f98757eb06d6e), W(0x1491c958402841dc), W(0x69da17edf6697815),
+     W(0xd0a657a2ed669c8e)},
+    0
+  },
+  {
+    {W(0xb70fa20fbc3cf0a7), W(0x2e8087a1ee75e5c1), W(0x98ab32bd9c3f5778),
+     W(0x8554811d6e4e91c9)},
+    {W(0xc35797b7af3fb568), W(0xb97db7b85c38efe2), W(0x336647bf10eecd51),
+     W(0xf371f4760bf1ae33)},
+    0
+  },
+  {
+    {W(0x8bdcc08954237617), W(0x45b716c56c75bd04), W(0xde5fa764434a2cfb),
+     W(0xd071fb9904844a5c)},
+    {W(0x82c6823242a6e26e), W(0x26f5d58f19b98c49), W(0xa2bcd7cfedc42304),
+     W(0x96d4e2ed621c8c4a)},
+    0
+  },
+  {
+    {W(0xb9137ec51720613c), W(0x39d1952e7ac3d6a7), W(0xde8045b07852f740),
+     W(0x7df61898dfd4049d)},
+    {W(0xe83388955d879e53), W(0xb5f08b1508264c4e), W(0xd2a13dac0a81b116),
+     W(0x46cd2e3fb19d96ca)},
+    0
+  },
+  {
+    {W(0xcd4cb25949c27e82), W(0xe1e8a5b635cd6648), W(0x112577482462d98d),
+     W(0x17c27e562d189448)},
+    {W(0x4809cf7be0627146), W(0x45754dcb83076894), W(0xfbf2260103ab5a4a),
+     W(0x3ea66846aeb26b3c)},
+    0
+  },
+  {
+    {W(0x1566be8da9f01625), W(0xbc25932ea190ebb7), W(0x08b4d34726d63b1b),
+     W(0xe3624f2ab24dc7c4)},
+    {W(0x2ea06d665d89b97e), W(0xdcaa100c3c6a9aa2), W(0xbcf48b80685fe2e2),
+     W(0x6e1b39b87335798a)},
+    0
+  },
+  {
+    {W(0x8c811c75204cb400), W(0x4015122cb12dc0a7), W(0xae6ef4aa42a3470d),
+     W(0x63d0b70c4de49ff8)},
+    {W(0x25aa8e7c518f7ad0), W(0xc6399ca1b7e6c8ad), W(0xb9ddc163fcb05af0),
+     W(0x8ccac8151c76651f)},
+    0
+  },
+  {
+    {W(0x1c8c52d40128f3bf), W(0xf4357a1abe343c4a), W(0x84521d38c2845789),
+     W(0x7103d5e87420ae8a)},
+    {W(0x0211e19dbdc57d10), W(0x1cc7fc7aa012765b), W(0x7bb6bb64b519d843),
+     W(0xc5fc492ceedea7b2)},
+    0
+  },
+  {
+    {W(0x9ccb6ac44039f464), W(0x0de9264b401af296), W(0xb9f7e9e7fbc65584),
+     W(0xc4d289870ed9b52c)},
+    {W(0xffcdd949da94e41c), W(0x6f9510a0c88c3063), W(0x5e1497d7c16f667e),
+     W(0x1cc0bc28b1a3568c)},
+    0
+  },
+  {
+    {W(0x2b8a2ef6db39b191), W(0xd20b6c634df60ed8), W(0x05b142119e416ba6),
+     W(0x85d7038ca9892e81)},
+    {W(0xf7ce2177cc59551d), W(0x33a118c7fca5e410), W(0x2d94248c769f0b6d),
+     W(0x7c83434c95a26b88)},
+    0
+  },
+  {
+    {W(0xc39732307765a1bf), W(0x907696886cabc4cc), W(0xf9b434408b4250d0),
+     W(0x009229cd6189a600)},
+    {W(0xd1932fcc2633c26c), W(0xb00f81e133b762b1), W(0xf6a64d85da40e9e4),
+     W(0x0583530b5aee4706)},
+    0
+  },
+  {
+    {W(0x8671c27f2424f6ea), W(0xab8ecad6c0969d22), W(0x5d6dd6c465333d21),
+     W(0x209dd059bc9ee395)},
+    {W(0xc5e17dfd0dcfdff4), W(0xc1e40d7cf93cbb10), W(0x02d1c2e71c99a29e),
+     W(0xd9b5a793b200809c)},
+    0
+  },
+  {
+    {W(0x22bcc147eef98367), W(0x18a1bee60f315d47), W(0xd697e201b7ac91f4),
+     W(0x15f098cbbf7747e4)},
+    {W(0xf1c48c0a609d2731), W(0xf5b3f53fff3da0c4), W(0x01c1be4a9542d6d3),
+     W(0x7d33b30cafc43206)},
+    0
+  },
+  {
+    {W(0xc68153b0175cafc4), W(0x7096745439486374), W(0x6d0b27112150641c),
+     W(0x9e1bf5a6b8c4015a)},
+    {W(0x95791f326fb7a670), W(0x65cfe3a3adf35e07), W(0x5a681ea28983c7e2),
+     W(0xae2f2802be0677dd)},
+    0
+  },
+  {
+    {W(0x6798c875cfeb2493), W(0xb36fb28854180b86), W(0xb90c03037d283f6f),
+     W(0x187b3c2864a559b3)},
+    {W(0x7d728e2737b7bfa3), W(0xdaddd3ab39f7c3d3), W(0xeaf5c4e1559af708),
+     W(0x8d1cbca9424a0af8)},
+    0
+  },
+  {
+    {W(0xd99f95711fb52b27), W(0x6754d027bbd4c0fa), W(0xb1027dd2a2d19dca),
+     W(0x3436c66a5e8cb9ce)},
+    {W(0x6df371a33453544f), W(0xeb9daa6ce3acddff), W(0xa100f06fd3ad5ed0),
+     W(0xd9f61d312ad3e36d)},
+    0
+  },
+  {
+    {W(0x343a3d9b8c5c4469), W(0x17cdcccb4e636d3d), W(0x1ed9e47dd2d87a8f),
+     W(0x8eef67b9ebcbaa12)},
+    {W(0xa51ac25262261028), W(0x38d0d7c84c50e0c1), W(0xda5474eba52b31ce),
+     W(0xfe58678dbf22443f)},
+    0
+  },
+  {
+    {W(0x59809356e4d97e61), W(0x2538254051e42301), W(0xa63c33cf8e0d5029),
+     W(0x5b8c79b0f46a4dca)},
+    {W(0xe93a77534be4de19), W(0x1a8e8a0cb0c9f891), W(0x9c709790c72309fd),
+     W(0x83514637193759ab)},
+    0
+  },
+  {
+    {W(0x238e325f0437c92b), W(0xef9f8d6962cb89c6), W(0x0ea81652e9e3f702),
+     W(0xa47af39cffd57a23)},
+    {W(0xe992fb4ee887b5d1), W(0xce277f2f217c479e), W(0x81f89bdaabce2049),
+     W(0x1618b02dbed4279c)},
+    0
+  },
+  {
+    {W(0xfb47ec62a597b3f3), W(0x2ad62c42808976c0), W(0x5fa6e7f2c814a7f0),
+     W(0x791d7a74c1ea69b3)},
+    {W(0xeb6f400220a1922b), W(0x8ab5e649f29cd8ba), W(0xa300afe8d3610c20),
+     W(0x534e7e300c13b333)},
+    0
+  },
+  {
+    {W(0x87c14af484494d27), W(0x52923c518dbb9331), W(0xe0495e451873172b),
+     W(0x25063f64fabdaa62)},
+    {W(0x5e52e6030940e7a6), W(0x6a8fd02b76efedf6), W(0xc5930982eda86e63),
+     W(0x60e6e9d68d22e2e3)},
+    0
+  },
+  {
+    {W(0x75aa28b3bdee7de4), W(0x49b607437b6140f4), W(0xd06987a1a10aaa28),
+     W(0xffea71f7a6f5e692)},
+    {W(0xb31674ed33949894), W(0x34bf777d3803310a), W(0x15cf6f87e30e1bae),
+     W(0xa62498c8b228a91c)},
+    0
+  },
+  {
+    {W(0x120f8727decb1036), W(0xd1d591675656069d), W(0x4c7439218358fada),
+     W(0x874464791089148f)},
+    {W(0x5a74c1bb2b9cc87f), W(0x699873858f2e49d8), W(0xcc0049e2f326308e),
+     W(0xed80b276d1bb3e62)},
+    0
+  },
+  {
+    {W(0x9a541ed114ea0e9f), W(0x9d2ed4298d72a951), W(0x397dbb3e3920ab9a),
+     W(0xdc03aec8888097cf)},
+    {W(0xf9a69cb8ea76c45b), W(0x238bc46dd427093f), W(0xc993aa594e4e49f0),
+     W(0xd9ed9e355aab6fbf)},
+    0
+  },
+  {
+    {W(0x2eaa00eac7c08494), W(0x6248ffc9971783c1), W(0xf07e24cdf9922c81),
+     W(0xf944e792839f47fe)},
+    {W(0x93dad7d4d98a01c6), W(0x28b9af7544a953f2), W(0xad7344b5e141fd22),
+     W(0x6712b2c3af44ff5b)},
+    0
+  },
+  {
+    {W(0x5edc53c499235624), W(0xb501cc18e1c0da31), W(0x42f4a55fccb0868c),
+     W(0xfb098f5a8d3b991e)},
+    {W(0x0124f695caa655fc), W(0x1061544be6e8ef0e), W(0xd273b0976e4e8dca),
+     W(0xa4e97b4c3134cfec)},
+    0
+  },
+  {
+    {W(0x356b31e51744f794), W(0x56b10b60ee314952), W(0x478a7d0145761e33),
+     W(0xc45c3742eee98eaa)},
+    {W(0xea833fded0053152), W(0xd4dd91200c40ebb5), W(0xca063af48d868701),
+     W(0xf5e45edb3679d506)},
+    0
+  },
+  {
+    {W(0xca3fa9d484cd0031), W(0xe548a8dc56ea5e58), W(0xc8a37406436f4c84),
+     W(0x09121ca6e024a646)},
+    {W(0xc0a00f150f2226c0), W(0xa32191d4055dc4a1), W(0x49fe221e3cae9fa2),
+     W(0x5a38d5b6871101f5)},
+    0
+  },
+  {
+    {W(0xc7b1dc23fd4049db), W(0xb949466a35d2eb14), W(0x023d0a77e151239b),
+     W(0x2548c7e093c7bba1)},
+    {W(0xa892e3ed0aaecc68), W(0xa177b08fd8516a2c), W(0xa07abc3c0e5d654f),
+     W(0xf939ae45c897d0fa)},
+    0
+  },
+  {
+    {W(0x35d0d3188f4660a5), W(0x093f75b7f2af449e), W(0x7dc7ead1dffd8bfd),
+     W(0x3f9bee1be2e834de)},
+    {W(0xdcd3fb0fa9b01c2e), W(0x246fcbf380ca633c), W(0xf967f6840e4731c9),
+     W(0x88e8f5656277a9d5)},
+    0
+  },
+  {
+    {W(0x937d9da4f71cb826), W(0xe2e6a79c71e04603), W(0x49f3478d7b2e80ff),
+     W(0xd40e8539566eea23)},
+    {W(0xdcd0696e9f472ec6), W(0x306820d1a8109954), W(0xb14c127969002265),
+     W(0x6b89b3fa8fe3f49d)},
+    0
+  },
+  {
+    {W(0xbd67767262ab32d7), W(0x1c8e5d4ae30ac205), W(0xe14a8ac0ae478b36),
+     W(0x919d2972cbf7b6b1)},
+    {W(0xa78bf80684903f51), W(0xb43ad4a857207e26), W(0xd5720b1fdfdd4422),
+     W(0x013d4b39134fd0de)},
+    0
+  },
+  {
+    {W(0xe48a06858fef0e08), W(0xad19d75fb1621e01), W(0x39b8e9ff3257c2b1),
+     W(0x4ef3760494386477)},
+    {W(0xfe33faee486b01a2), W(0x22d9bbfd8baf79f7), W(0x2aa25eafbb9a9ea0),
+     W(0x2c23e8f890dfe2dd)},
+    0
+  },
+  {
+    {W(0xf0ca996129096c84), W(0x76e85a5035c91301), W(0xecd53f4723f46f26),
+     W(0x00e8f1f944666d4d)},
+    {W(0x26eb66ba62166a69), W(0x0f4408c08c9c59a4), W(0x75396f859e4dd4b5),
+     W(0xc90aa3221070dc1d)},
+    0
+  },
+  {
+    {W(0x1f98381267250afa), W(0xb8c4cfc68aa1fa35), W(0x9f6a754bcabe948c),
+     W(0xbd258ffb2606bdbb)},
+    {W(0x211e3ad7aa71cb74), W(0x3e0b813403cb935f), W(0x9db4c84633731ebe),
+     W(0x17a2090eb59f7abe)},
+    0
+  },
+  {
+    {W(0x949f3b25665ee9b9), W(0xf3e58a48a96da06a), W(0x02b7fb59949572df),
+     W(0x55c0be60b31890c5)},
+    {W(0x7c9f1adb36bce876), W(0x38e2827a251f26b9), W(0x734b4d86d1fcb060),
+     W(0x96afc92f3a12b5e8)},
+    0
+  },
+  {
+    {W(0x408837470f18d0f5), W(0x64bc47de0d456266), W(0x3579bd2618d346f1),
+     W(0x140630d01de13f82)},
+    {W(0x57e468e3945ef436), W(0x21f5417c8ee196d3), W(0x1af8b8627d48ef74),
+     W(0x9f293ca83142ce28)},
+    0
+  },
+  {
+    {W(0xdef6f398d61e9ff7), W(0x01f8064bed3a67d5), W(0x3be4a1607d2c5a4d),
+     W(0xdf62e3c9d6878ada)},
+    {W(0x7793e2d61724d219), W(0x15582de611aee4fb), W(0x24cbd0a9d7a69daa),
+     W(0x37d546beb945ea55)},
+    0
+  },
+  {
+    {W(0xe2eb1ec612546c8f), W(0x5419fb26029ecb6a), W(0x0eab13fde497ad52),
+     W(0x9a09809cde9a089d)},
+    {W(0x85749842eba14f52), W(0xe9eb0669d397ed12), W(0xc509bb17c0797ff3),
+     W(0x6a3806bd67694cf1)},
+    0
+  },
+  {
+    {W(0x55e9b3f5482e0249), W(0xa2d32da1f30b6d52), W(0x3cd4d716324adaf9),
+     W(0x8d4436556e775dc1)},
+    {W(0x8eb402768eaa108d), W(0xc630ec9207fb2aaf), W(0x5ef0e14646c9f5bf),
+     W(0x92a6c57c471ef76d)},
+    0
+  },
+  {
+    {W(0xc3809d84c41c2351), W(0xb2ac41ee4a052ef1), W(0xe64f81cdc7b9f176),
+     W(0x2a8d536924716ef6)},
+    {W(0x414401a6ed8997d3), W(0x77d840fee6c47c6b), W(0xf997f2c8f2c6339d),
+     W(0x527e3fe82f4c4def)},
+    0
+  },
+  {
+    {W(0x8343e19d44206b06), W(0x3d372fce3ed96134), W(0x97559c66d38adf05),
+     W(0x75e3e3d7e6282009)},
+    {W(0xf7fe6d002b64308a), W(0x5dd665f8517b1f2e), W(0x0c56ae15e3204cb7),
+     W(0xfe80d21e97b727bb)},
+    0
+  },
+  {
+    {W(0xb08750011d589b57), W(0xc48bc938ad827390), W(0x8342191206ca1a63),
+     W(0x589c09dd7828c47d)},
+    {W(0xe82fa4785de22364), W(0x2b8e3f67c3b689ea), W(0x7fb9855ffb3f6f08),
+     W(0x2e6dd8abe7f820ef)},
+    0
+  },
+  {
+    {W(0xad9da2a9c3a876bd), W(0x81b3de3ad144b5c3), W(0xf00c7f72d77b83cb),
+     W(0xe5acea99bec93620)},
+    {W(0x59ee3278d09cfc36), W(0x102aecfcd17002a2), W(0x658e3a628f862fc5),
+     W(0xccb572714deee3f1)},
+    0
+  },
+  {
+    {W(0x3b79ba66474f3ddb), W(0x89fd9b4858a63ee8), W(0xd4d56b7053c87540),
+     W(0x5169b5ff0f0c8224)},
+    {W(0x9eab8e7223fde1b0), W(0xa92508bd23986c82), W(0xfa2f10b5ae4f9e03),
+     W(0x41ee5db3f8ed464e)},
+    0
+  },
+  {
+    {W(0x0190e03b5a79f48b), W(0x97bce2aede783fe9), W(0x1a1ead380ba912d0),
+     W(0xbbed7960f3e6566e)},
+    {W(0xd92ef27c400f5d75), W(0xb1f05c0b8b3f84f5), W(0x47fa899027025390),
+     W(0x983e7a894b513cdd)},
+    0
+  },
+  {
+    {W(0xdbd3fae57c840fc6), W(0xe6a2eca4142764c5), W(0x7975cf25e087092c),
+     W(0xee97656b56cde0b4)},
+    {W(0xce86001d95046466), W(0x6506e6b9ffa1fdaf), W(0xa9e87ce45304115b),
+     W(0x73bab4404e361cb3)},
+    0
+  },
+  {
+    {W(0x6e1c49fe9d8b18a9), W(0xb8f44d1535b1a37f), W(0xe34f39428e6f941d),
+     W(0x65a591225ff651df)},
+    {W(0x860438a896fc9d2b), W(0x552247c9f56df2b1), W(0xd6b6b3e87706677e),
+     W(0x30b18d71999508da)},
+    0
+  },
+  {
+    {W(0xa4f44df615efd9a7), W(0xf846f98d4a0dff53), W(0x7391b1a0368138ce),
+     W(0xa43a5809b0550543)},
+    {W(0x8309d43cdfc088c2), W(0x9ac65750372bb8a0), W(0x24bc93fb36352775),
+     W(0x12af4fc3c00a878e)},
+    0
+  },
+  {
+    {W(0x77c2da7c1f93894d), W(0xfbbc2a5b31c7753a), W(0x579534bae3ac5a8d),
+     W(0x526c9b99db5c2a19)},
+    {W(0x320e4ca33163fcf4), W(0x9432774868d08440), W(0xd1cb3b5abea9ceb9),
+     W(0xc04968d0b97fcc8b)},
+    0
+  },
+  {
+    {W(0x962d3c47959838c2), W(0xe1a8f582455930db), W(0x1f2b5f7b49d1c3b2),
+     W(0x13e064fc886e9465)},
+    {W(0x9019a35fc4ba4451), W(0x09e4e75eafb32272), W(0xcafd833da9c5c761),
+     W(0xcfe97c3a9102927c)},
+    0
+  },
+  {
+    {W(0xaa8db5b94e4d20fd), W(0x9b3fbb52dbbeb087), W(0x4d821ea96d919cab),
+     W(0x6fb33a4714d989b7)},
+    {W(0x108ecc0b36fc5365), W(0x6f8125f37dae5a97), W(0x6cdbb595ffe1932f),
+     W(0xbf7028ceeea3ea32)},
+    0
+  },
+  {
+    {W(0x4190424a7fa6a4e7), W(0xde837b18be21afe3), W(0xb524c73ddc04998e),
+     W(0x8b1f85ac6e28c2a7)},
+    {W(0x7880d103d9fccb57), W(0xa01016606d9f3d98), W(0x56fdf446e88c20e5),
+     W(0x645eceaa28cb0282)},
+    0
+  },
+  {
+    {W(0x8665045226cdf723), W(0x76c2899b947b2421), W(0xcd2cdddfdf8bb409),
+     W(0x4344d01bac52f7b9)},
+    {W(0x5846579b9c890f6e), W(0x62d23ac256bc5ecb), W(0x7113fb979b9e763a),
+     W(0x26659eaedbcb88e2)},
+    0
+  },
+  {
+    {W(0x88ece530ea7634a4), W(0x8896550ace254a18), W(0xc1ae5561a0a65882),
+     W(0x8ada756a811f1b19)},
+    {W(0xcc81febe99f2a373), W(0x96cc55ead80ed3d2), W(0x0365e7bfbb00b7db),
+     W(0xdb67197d13406a03)},
+    0
+  },
+  {
+    {W(0xf2574f5d254c9b8b), W(0x78f3bb4a51a4b277), W(0xe425c5a8cb1942fb),
+     W(0x8594a97e45727b62)},
+    {W(0x045f32f218f022f7), W(0x9024fe4c2be46769), W(0x5687810a7c0e0293),
+     W(0x59fdfbfcfa5dc4f5)},
+    0
+  },
+  {
+    {W(0x9df837273ea9040b), W(0x1f71528442186dbd), W(0x3c7dc6862ae9ffd8),
+     W(0xc7eb201e05c89cd9)},
+    {W(0xffa9db4636250739), W(0xf6492befb2d9b0c5), W(0xc897c01d8ed6ffdb),
+     W(0x0927e438869a8d92)},
+    0
+  },
+  {
+    {W(0xfa97ad71450f4500), W(0x4e590375ac5f6aeb), W(0xf4c89e205336dc68),
+     W(0x57841c78ba4ba008)},
+    {W(0x4672ec62e2cea5f1), W(0x9b3d23468dc791fd), W(0x3ef14df7149f6d17),
+     W(0x3a5bc7c8d7771340)},
+    0
+  },
+  {
+    {W(0x5a89ad5c0f6ff5ee), W(0xa80675e5c35e825e), W(0xb4ba780689717417),
+     W(0x4f90277236e3ecad)},
+    {W(0x63ced73541a840e5), W(0xea1eff997c48f593), W(0x6ba99f5b7a47737a),
+     W(0x563236848a815974)},
+    0
+  },
+  {
+    {W(0x7a612b9d6cb768cf), W(0x6278d08d47ec54f0), W(0x5770b55cb6a78825),
+     W(0xecb3e68819d24176)},
+    {W(0x5b504905c9a4e0b1), W(0x807dfdd65a9703b5), W(0xf07920e2a1ae1383),
+     W(0xdf6662ac709960fa)},
+    0
+  },
+  {
+    {W(0x4298087b6f63a777), W(0x2f0c8579525e9673), W(0x73833d74c00c7f1e),
+     W(0x2def444e2d43d6af)},
+    {W(0x326880887e8662e3), W(0x9d29ac4fc92e51fb), W(0x65a2b448d7b4c15c),
+     W(0x26efaf5dbac40f6c)},
+    0
+  },
+  {
+    {W(0x067735e360a0da04), W(0x7f39f210c802880b), W(0x689ac2fe8bdb491c),
+     W(0x66ee1f1cedabe6b7)},
+    {W(0xe8c04ba7c52e6185), W(0xe53c7cfbdb5fbbb8), W(0x43f38389cb1abd6c),
+     W(0x3af0b2dca8e1327b)},
+    0
+  },
+  {
+    {W(0x6388f82ac401ccad), W(0x8a8d8742141c2409), W(0x2009acadb9efda55),
+     W(0x5139a56cb085cc06)},
+    {W(0x565bbfe2a2f93bfa), W(0x6a9dbb98d61fa9b3), W(0x65e3e781c79b3e8c),
+     W(0xd9e3316a97fe9862)},
+    0
+  },
+  {
+    {W(0x50b8dfc3b41b642e), W(0xd8420ebb526ca52d), W(0x0591dc1271c3fd55),
+     W(0xfc34045ff80be7e2)},
+    {W(0x4f5cdc687f1e7fea), W(0x4ee521831f2b1658), W(0x75cbda91218cf56c),
+     W(0x91f609a752472e48)},
+    0
+  },
+  {
+    {W(0xd08706a3a6a28b1b), W(0x76331ee61ea672ce), W(0x211e143ae5fe54f1),
+     W(0xe44ab6a68d3367de)},
+    {W(0x05c0ed56e56ffaba), W(0x41f1ebb7b75e2d75), W(0xdd164b146031b4e6),
+     W(0x7facc7ba958c985f)},
+    0
+  },
+  {
+    {W(0x1a747ae858c8f3de), W(0xe1fa0ea7c3904379), W(0x6575b25fffda358e),
+     W(0x42573553ebd1369e)},
+    {W(0xfb6709ca9d2342b6), W(0xf74300db6519bb10), W(0xafd4a67ae965d55b),
+     W(0x996433b3d4d7b87b)},
+    0
+  },
+  {
+    {W(0x90c8aac12daeaf2d), W(0x627e5973687e7f02), W(0x8146660af10e3fcd),
+     W(0x33b07e8c5fa06379)},
+    {W(0x1adfec357dd9476f), W(0x3913db42ca194d3f), W(0x6907eeb918462ad8),
+     W(0x6a5a9898e89a32f9)},
+    0
+  },
+  {
+    {W(0x7acf3725265927a0), W(0x9f7e4f137e53e033), W(0xbe68212b2cee2528),
+     W(0xd81cae7d1b94ec47)},
+    {W(0xeaaf8ce194ac1bfb), W(0x75d464c237c2dac6), W(0x9febabb2ee0c6c9f),
+     W(0x4e5ca9dacab0eba0)},
+    0
+  },
+  {
+    {W(0xb46f74caaa993e6b), W(0x5c0aef07f57cb3b6), W(0x76dda772e623be21),
+     W(0xb5bff15de2ec8c17)},
+    {W(0xfb93957ed985d9d1), W(0xae56892fd67affe8), W(0x1abca20d3b37dc76),
+     W(0x5d7fec5f6550cfa5)},
+    0
+  },
+  {
+    {W(0x0722ca8014b8c800), W(0x92623fa7c5543eb2), W(0xa9c951e5c11c24d8),
+     W(0x8710b954420ce067)},
+    {W(0xc42ffb2003a826fb), W(0xec668daf4077e37b), W(0xf1537f330c9860c5),
+     W(0xdac451a512123fb3)},
+    0
+  },
+  {
+    {W(0xe36d6a63e7c9332f), W(0xc21d67bb38cd7b5d), W(0xad7264dda21c08e5),
+     W(0x373c3899081ea21d)},
+    {W(0xd3eda71e975c9795), W(0xff892e3f9a049013), W(0x3fe2885d41a93ef0),
+     W(0x5bef0a41bf21552b)},
+    0
+  },
+  {
+    {W(0x989fec14e64a3e5f), W(0x65c6b1d5c3643090), W(0x4e5aa4832f537f8a),
+     W(0x50ad3f9a798b5c59)},
+    {W(0x31ab74ec2866b25d), W(0x61243dcfd7a4217d), W(0x2dd928bdc1b63335),
+     W(0x330d0533ab42b61b)},
+    0
+  },
+  {
+    {W(0x0dcf0961d7ad60a8), W(0x846446ca0ec0fd6c), W(0x29ab4f3b248e21cb),
+     W(0x2d92e9449e9f8f9a)},
+    {W(0xa43b90b97f4a4278), W(0x99126abbc79454ef), W(0xaacc169b3c11879e),
+     W(0x47d04abcf644f682)},
+    0
+  },
+  {
+    {W(0x5e5100ecdd0a1170), W(0x7b7a011cf7722276), W(0x6d54306fae3b04fb),
+     W(0x37842d6c6a5d1924)},
+    {W(0x3b739e8ad8ecde6e), W(0x2dabbaec09faf16e), W(0x437d11b362b64647),
+     W(0x0a0f213d7e6dc099)},
+    0
+  },
+  {
+    {W(0x0557ae98c3e34ea9), W(0x9aa3b231214a24d0), W(0x1a113f38c0bbf085),
+     W(0x7af0434c4d651784)},
+    {W(0x0563047c7c50eba8), W(0x5b013c9f6945cf27), W(0x570cbb4193bb75ce),
+     W(0xb279271a7723fa72)},
+    0
+  },
+  {
+    {W(0x798b8694a41efeb4), W(0xc4da021fa6a15fbd), W(0x45faf416ce178b3a),
+     W(0x87676833288d8f9d)},
+    {W(0xc169951120cad45b), W(0xc236556fd01bcfe2), W(0x5bbedb47d3aeab2f),
+     W(0x1e48c61fdb4de657)},
+    0
+  },
+  {
+    {W(0x4b12fc3dbe94f49d), W(0xb644c6066528ff2c), W(0x5fef8e18bb8a8549),
+     W(0x7e66d6a2253b1e78)},
+    {W(0xa2d1d700c272fabb), W(0x5a8d0d50525d3ee6), W(0x9891731566ca7eba),
+     W(0x82c78f52368a6dd5)},
+    0
+  },
+  {
+    {W(0x619b8b297553e1b4), W(0xaa322d8d7f57eabf), W(0xb45ceeee7d32a47e),
+     W(0x4bcce159729fdbb4)},
+    {W(0xa365e72dee1ba083), W(0xd3908777e6aafb04), W(0xbb2a85e9e5854960),
+     W(0x2e35963abe7ae263)},
+    0
+  },
+  {
+    {W(0x18dd8f38e5054d2e), W(0x0ed1fe76d8d2181f), W(0xae7cf812e3255b5f),
+     W(0x26931060c269f5af)},
+    {W(0xb0ed653ab4a9aabc), W(0x6e12410316d724e5), W(0x22433ab5f1bd74c2),
+     W(0x09fb5a5406bce29b)},
+    0
+  },
+  {
+    {W(0x0acf987b8bdb1f96), W(0xdc09015dea4884bd), W(0x3ef1b0eb75dc152c),
+     W(0x3bc8f7abde2ee781)},
+    {W(0x91f6572e1dc793b1), W(0x90b9a4af813deb25), W(0xb2c11d66f2f773ba),
+     W(0x8bb7e84f4eb910f6)},
+    0
+  },
+  {
+    {W(0x24d4a60356908c15), W(0xe571a72ef2acf299), W(0x03ebe57edf9ed17e),
+     W(0xbf4d3d8b8ba3d0c3)},
+    {W(0x14aec6e8424a6d31), W(0xe7d4abf4102e252f), W(0xc382c4070240d136),
+     W(0xa94796ebfb2c408f)},
+    0
+  },
+  {
+    {W(0x53557fd2d5339d53), W(0x2af42fb8fef70a52), W(0xae55f3c28701c7c6),
+     W(0xd643c6d98185af6b)},
+    {W(0x5adf28ccbd47bb9f), W(0x3e9562f450595cb0), W(0x2f6c7f9541d2bd9f),
+     W(0x4e602706c7c5e8a8)},
+    0
+  },
+  {
+    {W(0x90cf7da47597dc12), W(0x4b176c15ed08045b), W(0x767dd7d45cb3e06a),
+     W(0x815a81aeee6d1aa3)},
+    {W(0xac212f77abf0358e), W(0xb9fef37e258a48d3), W(0xe7053050c1f45b2a),
+     W(0xd0c7719e72cc9b7d)},
+    0
+  },
+  {
+    {W(0xdd964f0783ccafe8), W(0x7dffecd5ee668f9d), W(0xcfbca222b6ae985d),
+     W(0x28c5419e2e05c96e)},
+    {W(0x0250f400ff3a0776), W(0xef578985882b5074), W(0x1671331e4bf7dc9a),
+     W(0x5eaf53290aeef1f4)},
+    0
+  },
+  {
+    {W(0xbf037525d5a3e4d1), W(0x16b345699a5e31d9), W(0x7c8ae8eacd623ac4),
+     W(0xc94f731f4ac9f9df)},
+    {W(0x8ccfde1028d09ecd), W(0xa23a015b9bae8b1b), W(0x30a2fca02974c93b),
+     W(0x198f4fc071adb7e5)},
+    0
+  },
+  {
+    {W(0xee17335222b7ed7b), W(0x530f1a3a84d207d0), W(0x342ed7e524c537a3),
+     W(0x42d68a3ec47f58b1)},
+    {W(0xfdb8a156225f2307), W(0xc7011576ce5f45d8), W(0xe82aff3149d7500c),
+     W(0x12d22bb3bc8cd299)},
+    0
+  },
+  {
+    {W(0xa8ebb99c9d08c1ca), W(0xdce78c0d79829d82), W(0xa2edf353ea61b695),
+     W(0xd5be19464cd3ae30)},
+    {W(0x0b93339042101c78), W(0x4d66752774d03039), W(0x3f830a461c45a901),
+     W(0x4b6807364bec4e97)},
+    0
+  },
+  {
+    {W(0x4c28e14a9418d3ef), W(0xda4b43a2758b4294), W(0x6193b6a28a152782),
+     W(0x6dc9177ff365a5a1)},
+    {W(0x230bb8624adaadeb), W(0x18ba237ff053db8b), W(0xbb5070cf2d887439),
+     W(0x93583a1f6ebb5347)},
+    0
+  },
+  {
+    {W(0xdb1236b988d33d63), W(0x1c4c8382006874cf), W(0x4d3bcdc103fea54a),
+     W(0x9844ee105b9515e8)},
+    {W(0xe6f845e2ad22aca8), W(0x61381a5e3977f952), W(0x4227634e5a61c544),
+     W(0xba81bff849300911)},
+    0
+  },
+  {
+    {W(0x16fa4bc3dc6e1820), W(0xab4675ff928e5764), W(0xabb2b949ea12dcbb),
+     W(0x25f2a76db9bc6427)},
+    {W(0xb71e78cc98042b8d), W(0xef4b871de171d453), W(0xcfaa004f906e71f5),
+     W(0x71adcdc98c7379d8)},
+    0
+  },
+  {
+    {W(0x67ac3c3023cce3d7), W(0x5f04d4b5ba15e8af), W(0x8cac2727e3338919),
+     W(0xff1656882dc08e98)},
+    {W(0xdec0ef488719d47a), W(0x64a710aba6e77d32), W(0xa44a2632e766463b),
+     W(0x645199e3114f9445)},
+    0
+  },
+  {
+    {W(0x8b42ebe7e230d705), W(0xa9b170dedbdac8bc), W(0x64836a2f7cc56862),
+     W(0xd712826ae3ce66f9)},
+    {W(0x45c7773e698f87ae), W(0xd7412549ba2cfd0a), W(0x3341e08c2700f1fe),
+     W(0xe81fa49ba4b11869)},
+    0
+  },
+  {
+    {W(0xe7088e2378d8f684), W(0x98efd4ba84693801), W(0xea7ff061c171a1dc),
+     W(0x3b132e4e9bab7835)},
+    {W(0xca8ad08b8c889575), W(0xce6ea3345ded798d), W(0x9879fa3e3675343c),
+     W(0xa22ab5e0b4eab6fc)},
+    0
+  },
+  {
+    {W(0xc305f2ab33571510), W(0xadbd65856acc479f), W(0x86f1c93cf6aea4e3),
+     W(0xb8f0c1cff8aa944f)},
+    {W(0x41b94ae4708646bf), W(0xa2b3c078f00cc95c), W(0xa490e324554a9105),
+     W(0x17dfe6ca2f4e9da8)},
+    0
+  },
+  {
+    {W(0x09ba1496b386634b), W(0x35278b4400a4346f), W(0x49109426795a46ed),
+     W(0x45d04b8807cbfa83)},
+    {W(0xe4e2d07ced89e613), W(0x2c71049e29bfc5e1), W(0x61710cf2904201c0),
+     W(0x46cd2dcac61bb896)},
+    0
+  },
+  {
+    {W(0x78043416b34b1a85), W(0x059a8653cc968041), W(0xfefa3b3a1dc7c133),
+     W(0x77dea2ec472fcdc6)},
+    {W(0xc1a1e9eab9a995c9), W(0xfad29935e6874eac), W(0xd4c5b0a84274ddb9),
+     W(0xa094951ce96365d5)},
+    0
+  },
+  {
+    {W(0xea038fb726788219), W(0xd5ec5577a03e08d1), W(0xac09b33552f36d01),
+     W(0x837f6855c0bc51f9)},
+    {W(0x8c8102580f409064), W(0x376b73a03090d83e), W(0xd26c3f1b138bcc17),
+     W(0xd240edbbd4e91a26)},
+    0
+  },
+  {
+    {W(0x69e296c646f07890), W(0x0e9dfbf300ddfaaf), W(0x3b49c51e61e2db3d),
+     W(0x75749466ef7e8d8d)},
+    {W(0x18999185aeeaf8f9), W(0xe04495310778cdc8), W(0x18b2abbf9051e2e2),
+     W(0x31dea8f68f268f9a)},
+    0
+  },
+  {
+    {W(0x2f37697e21ce657d), W(0x045e5f7722ba9160), W(0x35de5fa9ec30d7b8),
+     W(0x7a2b16ac721eee45)},
+    {W(0xe256e8150e780ebb), W(0xb170ce77475c9697), W(0xbc22ae65979b067d),
+     W(0x241affe3157a35e2)},
+    0
+  },
+  {
+    {W(0xe69ca3d67483a5be), W(0xe73af012b840cc32), W(0x1095d81b552fc0de),
+     W(0x08cf4c84a8867d70)},
+    {W(0xcf1110b9431bd0a0), W(0x09080d874a14af76), W(0x2c377717ed697fc2),
+     W(0x4671d18b7b948a12)},
+    0
+  },
+  {
+    {W(0xf368260f1f31bf75), W(0xcb8168d6cbe8a901), W(0x349f5c0d2c629bcd),
+     W(0x72451e86e51e1233)},
+    {W(0xd3d96a7ccbb50fb2), W(0x813672262b94d403), W(0x3dd15542e1e206dc),
+     W(0x02bac2885f1ed42e)},
+    0
+  },
+  {
+    {W(0xd604c8dce15389d3), W(0x3f5c491eefe2aa3e), W(0x08133ed07965fc0c),
+     W(0xb3a8e884dbec5ff6)},
+    {W(0xfb5c5310c2fdf8f6), W(0x0c909351a82df28e), W(0x59e55506f9052f4d),
+     W(0x0bab7a8ebac47d00)},
+    0
+  },
+  {
+    {W(0x1a342d22156ca8b0), W(0x54c27fc92a96c169), W(0x2fb0816d2379c839),
+     W(0x6f94f83baed5a8a9)},
+    {W(0x0265b9ec79fb8fb2), W(0x8503336fbf685ecd), W(0xd15aad9422223902),
+     W(0x019c45c6ad5b5bbf)},
+    0
+  },
+  {
+    {W(0xba28c3bbf9e53e84), W(0x3ccaf2d85e715c4a), W(0xcff26bb60a073505),
+     W(0x02aabb3382cae46f)},
+    {W(0xf526983b9387b85f), W(0x280834aac7340243), W(0x47e1778c1e19221a),
+     W(0xe60a11d02ec909a6)},
+    0
+  },
+  {
+    {W(0x2e3674c4ab44d122), W(0xed5c5a3be5912d6e), W(0x3fab800518999cd1),
+     W(0xf951ad700d869b74)},
+    {W(0xe959b537aaae640a), W(0x599d914dace386c6), W(0xd4c4ff96f1a07e12),
+     W(0xd1f826cc670dea03)},
+    0
+  },
+  {
+    {W(0xe88780820ba8bc97), W(0x576fdb7cff982483), W(0xe9eb3fd18ac40c8f),
+     W(0x6db9824994ec6510)},
+    {W(0x4b64ed9210b4e855), W(0x0f1c17205e99a2be), W(0x75252ca995b14e24),
+     W(0xa68ab2c528d104f8)},
+    0
+  },
+  {
+    {W(0x1a3373b6b422c89a), W(0x4d5ce1875f645cce), W(0x215035b7fd0400fb),
+     W(0xf3317b16af070e89)},
+    {W(0xaf51e0469793a896), W(0x4df8d82edaed09b5), W(0xb41e74d2bfb3248b),
+     W(0xfa3ac3d42ae96473)},
+    0
+  },
+  {
+    {W(0xfb0c0ec841481c7a), W(0xd00af50f960777e5), W(0x3bf1ad870286299f),
+     W(0xe6511c5aa9f7b908)},
+    {W(0x6bcbc5d6ffe349d8), W(0x91e86c409d4bb9cd), W(0x3cf9fd1edcd5d599),
+     W(0xb1a50e76b1d79be2)},
+    0
+  },
+  {
+    {W(0xbcaa747ff4751416), W(0xdfe9592f6483d93a), W(0xd99983df2e224d2f),
+     W(0xa24adda233128cea)},
+    {W(0x02de4de1b2226f1c), W(0xe1ebe7f1970e3541), W(0x26fbb1a7f7437a05),
+     W(0x0149c2b8eac8172b)},
+    0
+  },
+  {
+    {W(0x540a8dffe564176e), W(0x34f872985acd5c12), W(0xf447d7840a5304e1),
+     W(0x46631459123332db)},
+    {W(0x5f4207ae05b472bd), W(0x3c2a271ac8bfb2b0), W(0x90d948642c066ba9),
+     W(0xa0554f9db5aebd4f)},
+    0
+  },
+  {
+    {W(0x9719d1ee59c820e5), W(0xe9ec84568127a6ff), W(0xae2e378ca7c6e357),
+     W(0x208ab1fa759ca3c7)},
+    {W(0x9f57c654ae301169), W(0x586051d70313231f), W(0xcba42882d9205da1),
+     W(0x6159758b59dfdc59)},
+    0
+  },
+  {
+    {W(0x1c02f9cda3bac17a), W(0x8e6faacd2c53e56b), W(0xe13c1cd9373ae99f),
+     W(0x2349eac6eeed7a03)},
+    {W(0x2ac8df9002b2e091), W(0x7e6328bb65334c92), W(0x68c6c07a427e62b7),
+     W(0x00736f296af19373)},
+    0
+  },
+  {
+    {W(0xe26da33cfcf08a32), W(0x2e6454974abb1f37), W(0xf11509d936fa038a),
+     W(0x091c924a69b2cc34)},
+    {W(0xa3cfde51579cfbc3), W(0x54da4568c54e797d), W(0x549c1d753a9a3ca7),
+     W(0x318adbc47dbf6858)},
+    0
+  },
+  {
+    {W(0xf2e333670b4b892e), W(0xf5dce52fb9f4f6d1), W(0xb6454a8f5dbad905),
+     W(0x829fed5b267259e5)},
+    {W(0xddad3f9b5a0d820e), W(0x33693cfa560f3301), W(0x0ab99f1e890a354b),
+     W(0x3f91ec081f21b6e1)},
+    0
+  },
+  {
+    {W(0xabd7e8abdba1277c), W(0x87f498faa88f05fb), W(0x8379af8e9aa77b9d),
+     W(0x1ce02118383858f5)},
+    {W(0x5dc8efa1c2d74d05), W(0xf7052e18595dccf7), W(0xed4b461a7cbacf47),
+     W(0x93f2a99a71b0a982)},
+    0
+  },
+  {
+    {W(0x4129f38e21369027), W(0xe5f7aa0ed3ff82eb), W(0x07fa9995a2f6893f),
+     W(0x8dc1db41aff24832)},
+    {W(0x66db03e1e2826cbe), W(0xfb34c038ab856a54), W(0xc0de2eba2cbc3910),
+     W(0xcc5d4c19d41dc270)},
+    0
+  },
+  {
+    {W(0x4df559de0b0d405b), W(0x831b183507462eae), W(0x8e3c7ec6256b1eaf),
+     W(0xf3edc632431ff329)},
+    {W(0xcc253ae5ed4ab367), W(0xba4a5410f87abffa), W(0xfc2c840dddbb2fda),
+     W(0x19cca2bc83fa74d3)},
+    0
+  },
+  {
+    {W(0x78acc974539d2786), W(0xacc955559139b31b), W(0x8f3c1ca1fe39fe76),
+     W(0x8c0ea003962d11c2)},
+    {W(0x2fe9e56067fbc863), W(0x197fc0371b6c9ce0), W(0x1d95a3e331fdd4fd),
+     W(0x763da325aca27fe6)},
+    0
+  },
+  {
+    {W(0x32c90841e4d65303), W(0x07fe500fab8c61a7), W(0x9c675e19ba889442),
+     W(0xd8ef88a37e098821)},
+    {W(0xda480195a0de0170), W(0xce9deae57049b311), W(0x1b0c4348ae8e1e13),
+     W(0x9bbd2a7876e02d7e)},
+    0
+  },
+  {
+    {W(0x7ebb1f5921a93288), W(0x3b1ed2db1f67a844), W(0xd01762b8a4cfafb9),
+     W(0xc361e6cb0163333e)},
+    {W(0x0ef44d691871ec64), W(0x2201e96fc7aa5284), W(0x62b6a166ba1a1efe),
+     W(0x6570f2e1eb4ff164)},
+    0
+  },
+  {
+    {W(0xed7d44367d3f2c1f), W(0x4220f66fd1ccf425), W(0x3f34bea13358988c),
+     W(0x8a00bfde3fa9d6d9)},
+    {W(0x7ba3011e942b00ab), W(0x61c29b9ffa1a5175), W(0xc4a582ce73264b52),
+     W(0x971387029933cde7)},
+    0
+  },
+  {
+    {W(0xedf3c5706b5f661d), W(0x5dbc23b43a74678f), W(0x107e658e391556b3),
+     W(0x05a00c0de5c19e32)},
+    {W(0xfb82cad165bc0fd6), W(0x9a4ead66c7063a7a), W(0x46e77d59d8ea86d4),
+     W(0x7ca3170f81cde32f)},
+    0
+  },
+  {
+    {W(0x320e4aa49ec6e53d), W(0x92dbe633b4eaabcc), W(0x594e7de41c292122),
+     W(0x649f56a092fcced8)},
+    {W(0x7d5f09092567a2c2), W(0x1b3d31b7a8154360), W(0xbcfcdf7dbae0fa37),
+     W(0xe644609ded513005)},
+    0
+  },
+  {
+    {W(0x6cf2bd1733f8df0a), W(0xdfdfd3b1643eca5e), W(0x9f037d8ac04b254b),
+     W(0x61d5da476030fd77)},
+    {W(0xe2e9abdfc6198b81), W(0x42a8bda493222c73), W(0xa823b34c0a9bc0fc),
+     W(0x194be7c13fed7f71)},
+    0
+  },
+  {
+    {W(0x26357276e6d56722), W(0x3f80554ca1f1c194), W(0x7328ab31df8d9a77),
+     W(0x66b3881cae5ff318)},
+    {W(0x8b78146a057cc314), W(0xbed07673f67e45e0), W(0x551fb7b32171e7d9),
+     W(0xf9fc6df4b8797e95)},
+    0
+  },
+  {
+    {W(0x41631c8ad568e457), W(0xe2d8785be7d86bd8), W(0x7c51a6ca859d1455),
+     W(0x4c7d9ce0c8714036)},
+    {W(0x3bd1f874b6b58dad), W(0xa6f04c18263a885d), W(0x42f1ba14057e87dc),
+     W(0x0cb2645ac08712ed)},
+    0
+  },
+  {
+    {W(0xc3ed804ecc9b659e), W(0x6a160a9c498fb8ac), W(0xab6c930fa97adb7c),
+     W(0x0025201b9d6ec404)},
+    {W(0x185dc47900f9eadb), W(0xad2b83e688fa3391), W(0x7bf0281f858e08ea),
+     W(0xff3cdf7c2ece3629)},
+    0
+  },
+  {
+    {W(0xebdd2c1ff5ea45fe), W(0xb287145ffe4cbe0d), W(0x50904dee2ef38a1c),
+     W(0x9b3e783f09347f23)},
+    {W(0x54be814e7d743738), W(0x945cd5394ebf5755), W(0x2eb42e669df35726),
+     W(0x0ea3f676daf6bab4)},
+    0
+  },
+  {
+    {W(0x08949ce11fdd9348), W(0x804d64e6816526df), W(0x83395e164b32e9b6),
+     W(0xcd2cc26ee63bbe28)},
+    {W(0xb37f5e5b037ce026), W(0xa16473288b459bed), W(0xab277bc75e618045),
+     W(0xfb6c10cfb10d8b48)},
+    0
+  },
+  {
+    {W(0x843787d56010c8cb), W(0xad2ebb13fe7cc0ff), W(0x722cee62dd0269f1),
+     W(0x216e6d6971f0739f)},
+    {W(0x88d8d04cea7bfdd6), W(0x14e60310d8de3147), W(0x5be7af48f6a16082),
+     W(0x975fa4a2a6db1842)},
+    0
+  },
+  {
+    {W(0x41017622e2b384a9), W(0xa017efe87c5aad92), W(0x83c02f84ada0f346),
+     W(0xebc288505a7171cb)},
+    {W(0x4aa73e93c4255c9a), W(0xbe2160ec5f401131), W(0x7b69105ebeae630d),
+     W(0x9850aaf120242637)},
+    0
+  },
+  {
+    {W(0x96d103b9bb81485b), W(0x6b0994c2afcca6e6), W(0x079111f729fe6cd4),
+     W(0x3f220a211eb81836)},
+    {W(0x70d66a5e5e552ec4), W(0xdad7a6573c4a2a13), W(0xe21439c483051fca),
+     W(0xc86b66750f7c653d)},
+    0
+  },
+  {
+    {W(0xb2c55d8f8d2cb420), W(0xc7de3b420bdc3f71), W(0xb2c7d24566166e3c),
+     W(0xabc4b24a6c500c04)},
+    {W(0xe349843b6b61413e), W(0x23a2b159bba48cab), W(0x2b0f00950806acd1),
+     W(0x96871aea182122fe)},
+    0
+  },
+  {
+    {W(0xa6852e40b1a4b53e), W(0xde831f546524f45d), W(0xb511d1d36d780244),
+     W(0x1abace723c3eedc0)},
+    {W(0x050d5bc38a2a836d), W(0x685e912350de3294), W(0x6dd34ca463a0df50),
+     W(0x187fcda40e965192)},
+    0
+  },
+  {
+    {W(0x66542180a8024191), W(0xf38968dfc02f3a27), W(0xdc4b03f45e6c1fa2),
+     W(0x0722ad175e5191fd)},
+    {W(0x6e1d4d35573daa3f), W(0xfcfdfbc1b739cda4), W(0xf52c636c524fdacf),
+     W(0x5e840941a7670acf)},
+    0
+  },
+  {
+    {W(0xbcf06af4aede6914), W(0xf541311260525b48), W(0xafed065996487cff),
+     W(0x2a450d1536484754)},
+    {W(0xd0726b8f5d9aa4b1), W(0x64f68afdb927f119), W(0x5d1e1e482ecb841d),
+     W(0x5749ac89c9afcc18)},
+    0
+  },
+  {
+    {W(0x09909fc13790ab92), W(0x43e9165b9272e132), W(0xc4f9b803069e2729),
+     W(0x2daa6889c8076e8a)},
+    {W(0xdbd347baf12aa9f2), W(0x63c8cf18e90171ad), W(0xa69cc72901e973db),
+     W(0x3c1bf9b98ef9bbeb)},
+    0
+  },
+  {
+    {W(0x938309a701385e35), W(0xe2a90dc0288b3376), W(0xd1049ccd2b0dbbae),
+     W(0xc3522f712b8721de)},
+    {W(0xb68f02314cedde39), W(0x2244d50628b43900), W(0x84c59bd7a08120c3),
+     W(0x050dde7d213201d3)},
+    0
+  },
+  {
+    {W(0x1ba90edf547fb00c), W(0x7b664fed446a7c2d), W(0x95df4c17cb4f6ef2),
+     W(0x10e7d88cda382057)},
+    {W(0x6faf19c73881ec17), W(0xcbcea51f567af7a7), W(0x78a282200d57c9cf),
+     W(0xd76fc792a07b95ee)},
+    0
+  },
+  {
+    {W(0x43876cf5bf9b7519), W(0x72a3f00b65527a1d), W(0xd4f1e45e0b25840a),
+     W(0x83aeef02417e72f4)},
+    {W(0x7a2327d6a91a8db0), W(0xea84fce96e6115cf), W(0x357a9090e78b2185),
+     W(0x01fc0e03c98f2afa)},
+    0
+  },
+  {
+    {W(0xdaf29315f12d1c8c), W(0x7adb8d813a1a2ddb), W(0xa5e3cf1433cd3be7),
+     W(0x7134769a52520f8d)},
+    {W(0xbabc9500d768bd04), W(0xd9210e5c667461bc), W(0xf4a348d13cf69da2),
+     W(0xb67dc1558cd40b8b)},
+    0
+  },
+  {
+    {W(0x4b4fb69cebe33a81), W(0x9a6f120282739b24), W(0x1da8e8a3496bbd86),
+     W(0xa47d56d1f1f08ff2)},
+    {W(0xee3ac54fa9395e30), W(0x1709581db04fa582), W(0xfbbe7ec6e6a1c4a1),
+     W(0x9b04cbfeb10fbb55)},
+    0
+  },
+  {
+    {W(0xd835a1c41bfe684b), W(0x4dfd404c4881d928), W(0x2b43bd9dd3a47295),
+     W(0xac2670f032af1eab)},
+    {W(0xad7d501b8268bb6e), W(0xccd5798fd6a78790), W(0x98788e9489da76df),
+     W(0x364ff1ea93f7fd04)},
+    0
+  },
+  {
+    {W(0x0450a7a67adf07e4), W(0x0192d77e78546b80), W(0x8f51543f86af07b5),
+     W(0x221adfb198cd5a8e)},
+    {W(0xaf22b6443384003c), W(0x2de854ef8f2d30ac), W(0x7a7a17e7e526d1b4),
+     W(0x55dcb950b6469ce3)},
+    0
+  },
+  {
+    {W(0x27461319fc2cd4ea), W(0xacf0a783c836943c), W(0x6434fbc1cc34ac63),
+     W(0xf3c108bdf9855bda)},
+    {W(0xfdaabe340e0b5c4f), W(0xdbb77c4009545370), W(0x5bdd8b992024ac67),
+     W(0xb89d637ced8f5401)},
+    0
+  },
+  {
+    {W(0x1dafe6cd3204b2c0), W(0x255d8ca4e1513ca1), W(0x8a076bc0c2f18680),
+     W(0xcd2a27f19cbfb165)},
+    {W(0xdb706df33e468640), W(0x1a69298731772161), W(0x1bf62265f89fa85c),
+     W(0xc10b59cbc9f2d5ed)},
+    0
+  },
+  {
+    {W(0x41d3bb2615b7fb87), W(0xa77e8ff408759bc3), W(0x6dc645ed9d6b3277),
+     W(0x3a87947572dbc61a)},
+    {W(0x8f1ea04f97c82871), W(0x4993831123d4cf4e), W(0xb38b0464c4c7d8bf),
+     W(0x4f509669dd73e63b)},
+    0
+  },
+  {
+    {W(0x3314f68864cd6c44), W(0xbbe01a5bf29fda6e), W(0x20aed2812aade0a2),
+     W(0xc9a5d4ccf18f10ad)},
+    {W(0x4428eb75f1020e97), W(0x9d8a350c8924fbbb), W(0xf00bd05f2e2793ab),
+     W(0x7183d89764e76bc5)},
+    0
+  },
+  {
+    {W(0x8eb07a4ff506b218), W(0x5f92dc3724e376b8), W(0xf14f0530ccd453d1),
+     W(0x24d92586242c73c2)},
+    {W(0x7b86cce8d7375bad), W(0xc442f654b71d4359), W(0x5eab7092bd53a22c),
+     W(0x06a07f2be069a6fd)},
+    0
+  },
+  {
+    {W(0x545503878868e605), W(0x292cf5ee2164a673), W(0x95eb43d249730081),
+     W(0x9b5edfa1fe8c051c)},
+    {W(0x54d82d52af0dd94e), W(0x8fe5add09556c573), W(0xd0dc9c7331cde0c8),
+     W(0x6926cb7e428b031c)},
+    0
+  },
+  {
+    {W(0x425f7a45ee283cf1), W(0x9b360e2aedf94b46), W(0xd2fe88eafa1099ef),
+     W(0xb7edc99d6cf4b68f)},
+    {W(0x39b5eda19d6eeec2), W(0xbd20c60c504b7a6a), W(0xbb5b76d2e5877843),
+     W(0xb8096e7b8fd07f5c)},
+    0
+  },
+  {
+    {W(0x1c2edbd17e9902d3), W(0x6db46f97f5c0f991), W(0x20046fb6a961bba9),
+     W(0x7388604eae39a00f)},
+    {W(0x235f8c492c322158), W(0x266f61e9f0615913), W(0xa0d878ec9717498c),
+     W(0xbeacce2e85346b90)},
+    0
+  },
+  {
+    {W(0x7848377c647d9b5c), W(0xed7ea53a57697fc1), W(0x49889c0ad427002f),
+     W(0x2a87635b63af949f)},
+    {W(0x048fedd14e0e602f), W(0xb297ec0b051a2a57), W(0x0d3834f6ac619ce3),
+     W(0x24dff6f401c109f6)},
+    0
+  },
+  {
+    {W(0x6c63d9732b5250e0), W(0x262359f1e9be2269), W(0x40f20e03620ebe70),
+     W(0x96c0c12d511554a2)},
+    {W(0x918dd55e40387edf), W(0x80a5efbda5b5c0cc), W(0xadd52096c1f9397e),
+     W(0xa629ac9df3601785)},
+    0
+  },
+  {
+    {W(0x3f56b8c8ad5820a2), W(0xd481ea09db2a75a2), W(0x3141353c0286c31a),
+     W(0xbc23529638754faf)},
+    {W(0xf58e0d54492a1116), W(0x74ca51a2cc3885fe), W(0x2bd9742bab4d47f9),
+     W(0xc7c68a8adb3f165b)},
+    0
+  },
+  {
+    {W(0x7b14cdcb8c0084c0), W(0x4de4bd82e7d212c1), W(0xfc4b5ca40a70fc73),
+     W(0x87c88ce1f845fc00)},
+    {W(0x09071be5b7f502f0), W(0x16b30f81fea95722), W(0x0d51f5b08cecd290),
+     W(0x3893bcb8db146489)},
+    0
+  },
+  {
+    {W(0xe202b8cc913eb45a), W(0xc1f2e4738812bddd), W(0x4337858ebad56621),
+     W(0x71f21c3b3c097709)},
+    {W(0x7b1920530d05ad23), W(0x0c2c5472969c9382), W(0xbf50db9c8c61a186),
+     W(0x27f83f1f0818ec3b)},
+    0
+  },
+  {
+    {W(0xd5b1d023e9e20f99), W(0xb7340f52a122b561), W(0x68bffcdcf4fa0763),
+     W(0xbaa75067dd3f271e)},
+    {W(0x165fe33867148f1b), W(0x58dd3165db128315), W(0x87aada19d31b0ea3),
+     W(0xf0cf1b585fc06e3f)},
+    0
+  },
+  {
+    {W(0xb124cd47f46b2511), W(0xacc91db0d68cc12b), W(0xb2771a5dc360fde4),
+     W(0xb0684d879286e52e)},
+    {W(0x129e1c15d381fdfa), W(0x48a81e42158a5371), W(0x5f8726e6cb3eae3c),
+     W(0x3d725c1383eceada)},
+    0
+  },
+  {
+    {W(0x76baf96cc53d3256), W(0xbc9824ee4832bb80), W(0xd9b3d23282c3f12e),
+     W(0xd3dfdc884300b8d7)},
+    {W(0x2c6d5937ad45c3f9), W(0xc02cace0a9f021a5), W(0x8946d0b15abf5675),
+     W(0x9591af3e54c89a67)},
+    0
+  },
+  {
+    {W(0xa8b3a30c5705adfc), W(0x4030695a29c7aba2), W(0x99c66b62fec1f113),
+     W(0xc49ac86e7c310ebc)},
+    {W(0x8bf5ac3fea3bd3b6), W(0xca552fffc6e5746e), W(0x2f8905e63e021712),
+     W(0xe3da1cba855ddbd5)},
+    0
+  },
+  {
+    {W(0x537b45989820ffa1), W(0x6a5a55ee45c1aff2), W(0x11d0c9f86db414fc),
+     W(0x35018d24c10496b3)},
+    {W(0x486a61cda7702dcd), W(0xaa8c790d635ff548), W(0x009d5830ab678285),
+     W(0xb47e862cb2822822)},
+    0
+  },
+  {
+    {W(0xd67c99412bbf99d4), W(0x33b83e1243f8b9b3), W(0xfa663bcf2ecb89cb),
+     W(0x1f69dc7e7b46cac3)},
+    {W(0x62c129f0cc3ba2f4), W(0x4eec62703037ac23), W(0x1ccd4a31ac6a5ca9),
+     W(0x166e62ce5c3119e5)},
+    0
+  },
+  {
+    {W(0x6b39933b8f7cb499), W(0xd1d40c3d5a1fac79), W(0x11d2781f9b542d88),
+     W(0x10caf9a586f5751e)},
+    {W(0xede98d24f7266f32), W(0x717ac64afaaf0091), W(0x64aeebe093f9f5fe),
+     W(0xa995d00d1c63f4e4)},
+    0
+  },
+  {
+    {W(0x3923c4cecc835522), W(0x927944f9a2ec9080), W(0xc3cb9cb154664c95),
+     W(0x551ac65e55e251f8)},
+    {W(0xae168e8e846c5600), W(0xac6e21d38c06ec45), W(0x28593dd386ed5841),
+     W(0x0aad311eae6092c2)},
+    0
+  },
+  {
+    {W(0xb85887284889bea5), W(0xe4a504a6f87f91e6), W(0x0ae228c35c3c4a83),
+     W(0xca20714b03642352)},
+    {W(0xf0d219b3b7ddf086), W(0xa6da8ac084576559), W(0xc35adf82e58d579f),
+     W(0x59aa73688a5f7c25)},
+    0
+  },
+  {
+    {W(0x1f8f858b765cfcc1), W(0x22297c5cf51eb42e), W(0x5b0b9a24dad446d0),
+     W(0x20541ce45674ee2c)},
+    {W(0x4545b9b4d2a74c88), W(0xec6a5368ff3b9612), W(0xb125142e1e20d98e),
+     W(0x28e1ed3943613d1a)},
+    0
+  },
+  {
+    {W(0x222718aea170b42b), W(0xfb7756f5b77ba16c), W(0xb176037b233cb4d4),
+     W(0x054c08613321014f)},
+    {W(0x016c5a3ff0d8a0a2), W(0x14e72e092f6c777b), W(0x63d43e6d8ffb31a4),
+     W(0x03b80b9b0e01771b)},
+    0
+  },
+  {
+    {W(0x486f1f73298199d2), W(0xfc23d000a50b8e44), W(0x3e9637c7e49251a7),
+     W(0x595eacacf23c7dfb)},
+    {W(0x95c0f17fbd905f0c), W(0xeeafe8c469c2a871), W(0x83f7aed9d0aa532b),
+     W(0x95f329dd1c748c62)},
+    0
+  },
+  {
+    {W(0xa4229376f5d533d2), W(0x0011c7b40d168c34), W(0xf2a6494af12dc30a),
+     W(0x7561ed369ede8922)},
+    {W(0x397524f4cee182ea), W(0xa30db93b4e18696b), W(0x22d5fe8d126c67df),
+     W(0x2c1fee05337c5822)},
+    0
+  },
+  {
+    {W(0xb603b8df25cee3bb), W(0x002bdab74dc0fbbe), W(0x5be578cb06060403),
+     W(0x8b4b04faca29136c)},
+    {W(0xd3c657c9e02468ba), W(0xdfd4a4edd30374b4), W(0x3dc530429192f7eb),
+     W(0xe09e97320d1eea2d)},
+    0
+  },
+  {
+    {W(0xefc6a508ba275241), W(0x5e16184857c2fa40), W(0x750bf2495b9d0ae8),
+     W(0xfbf0169fb1bc7e77)},
+    {W(0xb51463d5a2d87f05), W(0x297d06d7b36e4f14), W(0x466b7b8f5ad36fbb),
+     W(0xfe726d01de6492fa)},
+    0
+  },
+  {
+    {W(0xe9d370f6b327f1ae), W(0x90e31fd2c82cf7bd), W(0xd023ac5b3b7c1dd4),
+     W(0x7b57d738fa455467)},
+    {W(0xf49f3b74d06780d6), W(0x0dd5b009d856e970), W(0x55e47991b3233acc),
+     W(0xc9d66058c8966a74)},
+    0
+  },
+  {
+    {W(0x261a2f90ec10515f), W(0xf6332a1b200dcaa7), W(0x37fd749de61ca008),
+     W(0xc2312175ec757421)},
+    {W(0xf2e0f149c7fbd2cb), W(0xca114c3f2b2d2a1f), W(0xf4eafc045b907bf6),
+     W(0x953e194a648d38e7)},
+    0
+  },
+  {
+    {W(0x831c5bf89e7439d9), W(0x71fef230ae6a2ec3), W(0x310e5c69eaeea732),
+     W(0x6f6c2f0862b6b4cb)},
+    {W(0x6fc794f8ee27d5c8), W(0x67036de4ade74de0), W(0xbca74ec3195d29ae),
+     W(0x1217729212d2f545)},
+    0
+  },
+  {
+    {W(0x8fc431c4d2a45e64), W(0x3767370e43fdc433), W(0xf99000ba79f55869),
+     W(0x9650fcbc39d425ae)},
+    {W(0x477ffe901a800838), W(0x1e08fb41f9fd7f0d), W(0x597bf8e122f314d5),
+     W(0xc496276ceba1d958)},
+    0
+  },
+  {
+    {W(0x0090b207cea376cc), W(0x9cbb1e889f9fdafa), W(0x39cfc3665da47137),
+     W(0xdd3be74252356e45)},
+    {W(0x32d805a1e24f90a3), W(0x76974105ce0eb736), W(0x266bec325b9b444f),
+     W(0xa5c4114fd8eee4e9)},
+    0
+  },
+  {
+    {W(0x259f530ce87c19d3), W(0x125dcca39a31cdcd), W(0x3823d0e34051e5cb),
+     W(0x8c2641392e6bcff5)},
+    {W(0x202e1a337a6fb62a), W(0x63c4ac6b82664fec), W(0xe4598dcb59f9a723),
+     W(0x6f128ad75242b11c)},
+    0
+  },
+  {
+    {W(0x4b18726b5b07930b), W(0x009ba6b35e2fc837), W(0xda4573a7135aa2bf),
+     W(0x22f81ef0ed3b712d)},
+    {W(0x27c131193c62430c), W(0xc99458a84e61f92f), W(0x3fd58b9c48f1b0d8),
+     W(0xe9c3bdc7de8bef03)},
+    0
+  },
+  {
+    {W(0x745a39e8dceff53c), W(0x4cc315aafcf54674), W(0x3b977f5909307b4d),
+     W(0xa83ed556c5aad007)},
+    {W(0xe00054f939756cf7), W(0x34a996f05216e073), W(0xcd4009e9d1eadf99),
+     W(0xd2126ebd84287244)},
+    0
+  },
+  {
+    {W(0x26fd3a8bb67451e2), W(0xd1c2c06463f3a224), W(0xd6a7d7445b0de687),
+     W(0xa02d7127b6f8a467)},
+    {W(0xb339980bded45da4), W(0xc25f15ff7f6ffa88), W(0xc329d36495df06b4),
+     W(0x504392d78de26201)},
+    0
+  },
+  {
+    {W(0x5f57c606ec3c82a4), W(0xa6a0d3f593fe7f7e), W(0x7e305a2cc73fa22b),
+     W(0x3483254bf5fefe3a)},
+    {W(0xbf42fc3e3e32e8ae), W(0xef8e6219d8d006a0), W(0xbe9c6c4fd075f926),
+     W(0x9ebea6c95f9174fc)},
+    0
+  },
+  {
+    {W(0x469a9fdb0ccb39d7), W(0x06ade82853c16cd7), W(0xe4787754ab057ef7),
+     W(0x0f4f6bb0affea221)},
+    {W(0xd2f56e27807f42b1), W(0xfec5240731001acb), W(0xff0c56a149d782b7),
+     W(0xa922d08ba68482af)},
+    0
+  },
+  {
+    {W(0x64cbf3d325be59a9), W(0xe55360a7c3c499c3), W(0x06d520a8e89f0d0b),
+     W(0x17f350c564d96fbc)},
+    {W(0xdd080673490663d3), W(0x6a9027e8972708ef), W(0xfbe51f4a1043554a),
+     W(0x4f35a1683b4abf6b)},
+    0
+  },
+  {
+    {W(0x4242d9000ed4b8fa), W(0x294b0855b8a89ede), W(0x170179e0d321f69e),
+     W(0x058105de3521e792)},
+    {W(0x277d342eaccfe0f9), W(0x3dfec4005b1fdfa6), W(0xe477c23e361e6f5a),
+     W(0x4cf127512e4463d6)},
+    0
+  },
+  {
+    {W(0xc4d168f00a60b6b8), W(0x10d4801f393356ca), W(0x2710cfdf1d924d50),
+     W(0xd35543c70e449daa)},
+    {W(0x99f5e0fcd9db7bd1), W(0x555c95e63e337128), W(0xcb10881456a407e3),
+     W(0x9a758349e1c746b6)},
+    0
+  },
+  {
+    {W(0xffd159d22481a0bf), W(0xf1587e5210ea41f4), W(0xc85dcbf7c862f8e1),
+     W(0x4dd5aea4c793e145)},
+    {W(0xc102e51dd14e3643), W(0x9543a33fc8729efb), W(0xc72a55801fe63df6),
+     W(0x3c3727f07eb9f83c)},
+    0
+  },
+  {
+    {W(0xf1276481fd23a6a0), W(0x189da3ca8b8291d8), W(0x2b27aeba2ef71c97),
+     W(0x85572ec69e8f2778)},
+    {W(0x111db71db1cf929c), W(0x82834769aa4838b2), W(0xd3fa7b27ec146e71),
+     W(0xe83af734187f58ff)},
+    0
+  },
+  {
+    {W(0xfe784cb0bfe01680), W(0x783897b532ee3e58), W(0x54d0512843131db1),
+     W(0xb488528808d8d957)},
+    {W(0x47d5613e65d0fdd0), W(0x8282136762a3511b), W(0x05c9b9039e3db95e),
+     W(0x88299df30284041e)},
+    0
+  },
+  {
+    {W(0xf5efb18cdf7258b9), W(0xb482adb17a207c4d), W(0xae8ef5b5e885c2cb),
+     W(0x65b21b392efd3a7f)},
+    {W(0xa4613c2d7ce28220), W(0xf51c6266a65481a2), W(0x1005c48a45827cdc),
+     W(0xc6628d6a09167e22)},
+    0
+  },
+  {
+    {W(0x3c14f03e751a2dcb), W(0x7a723142475cce96), W(0x3fb04af239849b85),
+     W(0x233101139972e840)},
+    {W(0xe9b355a50d9444b2), W(0x852c01c561714df8), W(0xae75712eac7abdd9),
+     W(0x3daa45c9cfe5cdfc)},
+    0
+  },
+  {
+    {W(0xfb75f04b14a81b56), W(0xd13ec085ef6d469f), W(0x369e0fe942228a9e),
+     W(0xbb3feeab3d8c0b2f)},
+    {W(0xfb2c1f30fe0a8768), W(0xb0fffb0589f52902), W(0x05c4f50b16ca3505),
+     W(0x318b4bd3b50dbb22)},
+    0
+  },
+  {
+    {W(0xbce5b8b517fcc999), W(0xfc7dcc5129a60ecf), W(0xc13022bd6db024b9),
+     W(0x660065d704004e64)},
+    {W(0x770d1a96140cfef8), W(0x8ebb0ad5a9f4a94a), W(0x9134f3d5be87c284),
+     W(0x349b721126370e94)},
+    0
+  },
+  {
+    {W(0x4258bae4381f263d), W(0x829a9ea5bb0c9d6e), W(0x9d2226203191aa08),
+     W(0xd339009b79cdd4d3)},
+    {W(0x2c2a1a2dd65ce983), W(0x30b4715f77f537d9), W(0x17e29c90db03a028),
+     W(0xc558cbf5cb6aaf11)},
+    0
+  },
+  {
+    {W(0x0a38c85d3bc54b7e), W(0xc26bc843fafd0fbc), W(0xda477bffc1aaa255),
+     W(0xa2059cdc636c5310)},
+    {W(0x578f94c16e64191e), W(0x53936aa43e833bf5), W(0xc39c4b63d241bc30),
+     W(0x6cee35486602151a)},
+    0
+  },
+  {
+    {W(0xff8dd235d3163004), W(0x2ab6ae7c3f11fd94), W(0x1aa9dd3fbae38a9f),
+     W(0xe9ce4444c76cd994)},
+    {W(0x8b3dfdabbcde0c68), W(0x94cc8dae1db4a9f7), W(0xa33266cc0e6e5f35),
+     W(0x3b5976ddc796e293)},
+    0
+  },
+  {
+    {W(0x585c6d80a81a4f9f), W(0xa3aedef7535d6bc1), W(0x5a4e13a41df526d9),
+     W(0x7095ec5e1dcef5e1)},
+    {W(0xa09fbb70e7874cde), W(0x23f897d1dcd5a035), W(0xf2730cdd0b307407),
+     W(0x450dc45cf842a828)},
+    0
+  },
+  {
+    {W(0x2d9e2454c13f2cd8), W(0x3e4aaea3ede320bc), W(0xc0e7aa1c8c5f0ab1),
+     W(0x9e2843bf3d2c1638)},
+    {W(0x98cc92f676bb1d39), W(0xe95b2df227e8797f), W(0x4a15a90b7e195bea),
+     W(0x9bfd42f03b7b85ff)},
+    0
+  },
+  {
+    {W(0x0f054c975138ae46), W(0x4f475d6ffcdf4902), W(0xbfc4177e0da548f9),
+     W(0x49fbaad94f472e6f)},
+    {W(0x2d030e5552de3d1a), W(0x704736e18e3feca8), W(0x33235882d3037e48),
+     W(0x656cabb1aca9cc57)},
+    0
+  },
+  {
+    {W(0x6ddee1ffdbb4daa0), W(0x481896e8113b89bf), W(0x800ccce3b8039404),
+     W(0x695d45aa15755a22)},
+    {W(0xc56210c2a18578e8), W(0x6ffe4837b0fd5319), W(0xbde121cb2d2c11d4),
+     W(0xc711c02565e178c4)},
+    0
+  },
+  {
+    {W(0x993044f8c89366af), W(0x120a160a7b119b19), W(0xfc1a78c9257c7289),
+     W(0x091fe1741c04c2e9)},
+    {W(0x2e59274261f2e563), W(0xa62a7b491176bf13), W(0xffc064ebf5dd145a),
+     W(0xa652a24f85bddfea)},
+    0
+  },
+  {
+    {W(0x1b344264b87f6b87), W(0x1dadf444fcdcd5c8), W(0x2e31ea263d7a0769),
+     W(0xdea870edb6c64b84)},
+    {W(0xfc10df278710593f), W(0x3420397e3d33a229), W(0x6b46dce1d5598c43),
+     W(0x3eb2c0e8a7f7c4f8)},
+    0
+  },
+  {
+    {W(0xeb28cd3677bf46a4), W(0x0c24050397712605), W(0xe2b0f130766ade35),
+     W(0xfa88d45e67c35778)},
+    {W(0xb213616789d4fda3), W(0x6dca6ea1b94111f8), W(0x94c4a20cfc64d280),
+     W(0x7cd0dcf0ffcdf028)},
+    0
+  },
+  {
+    {W(0xb166493012eab7a3), W(0xadcbc5fcb45831c6), W(0x482802deac890dc2),
+     W(0x7da2c9b78e4c93bc)},
+    {W(0x1f9a20881ccce575), W(0x0ef7750dcc5f7d3c), W(0x755e2041c8939a76),
+     W(0x386c89acf301f18e)},
+    0
+  },
+  {
+    {W(0x138fddd2ef8940f5), W(0xfb0f4f499b3803aa), W(0x6a154c0f80884a2a),
+     W(0x6a7d389a03ec1dcc)},
+    {W(0x10781159baf0eb8b), W(0x1b6734a59fff02d9), W(0x9a0aeb9ab279ac6e),
+     W(0xa424b06cdc8d7311)},
+    0
+  },
+  {
+    {W(0xea7b2f9e2263a7d0), W(0x0fc07aa7043e6c33), W(0x36dbd84682f3e6e0),
+     W(0xc9ebe715ef8f3b6c)},
+    {W(0x215335cf21e1a1ef), W(0x5d95928fb99b113c), W(0xda3744a3400236da),
+     W(0xf2d9acfdff385fc5)},
+    0
+  },
+  {
+    {W(0xf5e821d68cb390df), W(0x2a2f1890410fd8e8), W(0x7180cedcaa12523f),
+     W(0xeeb8ea7fd939e88d)},
+    {W(0x83693a86dba7df27), W(0xcd1955c8c8eef4af), W(0x4e51b901758940dc),
+     W(0x77445e20f37d7ed5)},
+    0
+  },
+  {
+    {W(0x34dfb6b4620dc106), W(0x00a45e765efc14cc), W(0x8ac3e1e66855482b),
+     W(0x76bd4fb46c179ec3)},
+    {W(0x7a25bd9ec47cba0e), W(0x9ca6e75ac0f0252d), W(0x383f12739366a76b),
+     W(0x8b396b78d8fe1e6c)},
+    0
+  },
+  {
+    {W(0xb3e1374a2ce703f2), W(0x700ab32941be6ca2), W(0xa3e58c6a02491d50),
+     W(0xf8e68bd41e2f37db)},
+    {W(0xe64be701e41f2e78), W(0x472b073a1eb693e4), W(0x3617d58a8eba755e),
+     W(0xe34c2a3563b8ff9b)},
+    0
+  },
+  {
+    {W(0xfdbce6aa21c241e3), W(0xfb3602c1216d144a), W(0x730156087e899739),
+     W(0x4b3e5400b008c366)},
+    {W(0x9b347afb31538ddf), W(0x99f5908379de03ee), W(0xbda1c31b5c819157),
+     W(0x297071da12b69a5f)},
+    0
+  },
+  {
+    {W(0x52ef69a21c6af3ac), W(0x8e38d6ec491fe3d0), W(0xe7d11abc3cac7375),
+     W(0x76f19dddd07b4073)},
+    {W(0xcfa1ba51f012a5b6), W(0x65b1e10785ab0c7b), W(0xbb3996951f91dd67),
+     W(0x9b721f0b8f023bec)},
+    0
+  },
+  {
+    {W(0xf11db34403138eb0), W(0x84871497c42e1d6f), W(0x695ffcfe8a618afa),
+     W(0x3088c0f2af7567e2)},
+    {W(0x07c07c94f220a0da), W(0xa53dbfbf3bb3c523), W(0xa809f46b78039224),
+     W(0xcf877f0587a23a3a)},
+    0
+  },
+  {
+    {W(0x8ef61b0a65727517), W(0xefb7b77a27d376e8), W(0xbf80d00bca63fa58),
+     W(0x1a16dcc461ffd8a7)},
+    {W(0xc65121362ae3a03b), W(0xc161f385486b7ec3), W(0x6cae7d21dc0bda82),
+     W(0x621e6eb176a3748d)},
+    0
+  },
+  {
+    {W(0xc0dd627492e20d72), W(0x72557dcc318c5293), W(0xe3fb6de1bf397539),
+     W(0x9d6ebddef706e5dc)},
+    {W(0xd8f2e28d4e3dfbe4), W(0xcfc18ecaa2f6ac31), W(0xbf062ce02e1959a0),
+     W(0x298f29084d2b5631)},
+    0
+  },
+  {
+    {W(0x1ae5d97d87b6b8b0), W(0xaec18c6c3dd5df58), W(0xcd9dba791b70aec9),
+     W(0x3eb524b5bba29b49)},
+    {W(0x19a08273d818b112), W(0x25efe79829be7782), W(0x27fbdd5df27d0e6c),
+     W(0x1b17ef68dc2bfe84)},
+    0
+  },
+  {
+    {W(0x6313552e3452a5cf), W(0xf43b513498b4af73), W(0x1a65eb3f69baaea9),
+     W(0x9b3bab37653f7584)},
+    {W(0x29f7ad50a3a56cba), W(0x59b6fbcbebfcc151), W(0x3e289a595374ba00),
+     W(0xc6d1cd4c5b0ac4be)},
+    0
+  },
+  {
+    {W(0x60fedd7ba76ec4fd), W(0x131af5f24920205f), W(0x99cec4eed3bd5abf),
+     W(0xa406743774ab2391)},
+    {W(0xb0c6898c50f8ab92), W(0xc78ea19190749c64), W(0x4b9700d20139faf4),
+     W(0x3e5ff538de575c21)},
+    0
+  },
+  {
+    {W(0x097dfc7cf4d0c20f), W(0x03932f005cde44f6), W(0xf556c3023807480b),
+     W(0x4ed49b88f3c65c09)},
+    {W(0x7976af1ae1b99a23), W(0x30055e5e3e35f3a7), W(0xc5f6e298e1a9fccf),
+     W(0x3e43cd399e205d55)},
+    0
+  },
+  {
+    {W(0x5b2ca1b87c6082b3), W(0xa4ae2b0a8779a2c0), W(0xdf241f0d40f73b93),
+     W(0x4b0f143878a6f6ad)},
+    {W(0xc37e9d1bc1f5a7e0), W(0x075c53573ca89919), W(0xc994d1908dbf0bee),
+     W(0x36f5da1a16c0895e)},
+    0
+  },
+  {
+    {W(0xefe17e7b869f5b0c), W(0x7f33e189b63ec078), W(0x49b9c61c2d450e82),
+     W(0x8fdcb2d72b8b996f)},
+    {W(0xf9f8e6c89bd5f8aa), W(0x7f2cee5a3603848e), W(0xa2b2df0ca126a8be),
+     W(0x038b0413ed32ae5d)},
+    0
+  },
+  {
+    {W(0xb980711778cdae56), W(0x521b162d41751840), W(0x8a911b073590d247),
+     W(0x29c72317d42a2010)},
+    {W(0x423fe71a2ad3cf13), W(0xf4902fc7cb79d332), W(0x03b347f3abd0df3a),
+     W(0xecdc93b2194afcd9)},
+    0
+  },
+  {
+    {W(0x5d2aeb74c3164fce), W(0xe82e22b1a3af7c5d), W(0xd484838c610d7344),
+     W(0x62b8090bcf3aec4f)},
+    {W(0x20df581f2853a4d9), W(0x5ecd8638ef5ae763), W(0x6aa5e6f8097344b4),
+     W(0x8e13fb1d93727550)},
+    0
+  },
+  {
+    {W(0x999f034756361b48), W(0xb18d310584616bb5), W(0x77b0f71445177a95),
+     W(0x190dbc706c59766a)},
+    {W(0xbdc0b28237d05bb1), W(0xaf7e64c995f3f933), W(0xe1640b750bf35e86),
+     W(0x7ffaea7bf281540a)},
+    0
+  },
+  {
+    {W(0x0f4ebd6bd1ae635f), W(0xcc5f40f6b929e127), W(0xbbb3fb6cd3961e61),
+     W(0xe679180d075d5266)},
+    {W(0xc06cec7f12711ef6), W(0x20c9e8b0259c1ab3), W(0x1270d41a2230997f),
+     W(0x5bdfdba5cc1c3e30)},
+    0
+  },
+  {
+    {W(0x49de9c35c05acb23), W(0x5b05ec2e0fb80661), W(0x67c9a4239129f964),
+     W(0x0acc45f16b1d0714)},
+    {W(0x367c3833cdb7f54d), W(0xbd94ebc17cb4e2a4), W(0x883450019941c49a),
+     W(0x6c479cfc76561512)},
+    0
+  },
+  {
+    {W(0x218f75de17102a60), W(0x6e4746125aa05742), W(0xd634eaf4e46c32e9),
+     W(0x5d6fb4d6db6a27c7)},
+    {W(0x4d47e959677da4e2), W(0xc63664af844bb4bb), W(0x0d0235c6821a9705),
+     W(0x7bcb29a4edafea9e)},
+    0
+  },
+  {
+    {W(0xf7c7e108acade8b0), W(0x5a036fab953b5cd6), W(0x6ae0dc2b8f93d169),
+     W(0x507a2ef2009c1624)},
+    {W(0x52b48cb586918c86), W(0xfd86f4b50e5877cd), W(0xeac16f42b74c6404),
+     W(0x15e4ea68f8acf7cd)},
+    0
+  },
+  {
+    {W(0x84da835492196cc4), W(0xeff2146832d5d95e), W(0xc96427489efa2ab7),
+     W(0x00918df870e9b546)},
+    {W(0x1cf8f4112e92c8d3), W(0x7c8233a4dc67280d), W(0xe76361f5f7637a36),
+     W(0x9464636b738c9569)},
+    0
+  },
+  {
+    {W(0x68117d8debe7af38), W(0x816f10c91ad3fc2c), W(0x60ec22364ef0bf9b),
+     W(0xa46bba37c5561abb)},
+    {W(0x7ec8c0e6a3742623), W(0x4b0924b638202bde), W(0x7fbaaf2e10d3adf2),
+     W(0x664190c11fc4a2f8)},
+    0
+  },
+  {
+    {W(0x71cba31a00f552e2), W(0xed1927593aca5ed6), W(0xcdb839a36c6a6e9d),
+     W(0x9ca9c04eb91f7c5c)},
+    {W(0xc197c5accd97e928), W(0xee48e97006c9ef3e), W(0x5aa4a0c11db94e4e),
+     W(0x81ff535b3b978e06)},
+    0
+  },
+  {
+    {W(0xc89b244957904bb5), W(0x4bcc9ae47bd9f839), W(0xfb3936c0ecc5fce9),
+     W(0x52f433ef131132ae)},
+    {W(0xebd9edb55a6cda5a), W(0xb5ac84caba41648c), W(0x8e82d2b33993fe3b),
+     W(0x5224598927bd56aa)},
+    0
+  },
+  {
+    {W(0x7f055c19e4e7c789), W(0x8b3a1b6d52c9bf46), W(0xc108a33cff0822fa),
+     W(0xfdc462f703b18af6)},
+    {W(0xdbe16e6c6d227221), W(0x66f27e151b9e0b53), W(0xa1c678af4bc7c2f4),
+     W(0xc4d1c3d1262cd2fc)},
+    0
+  },
+  {
+    {W(0x92ff2bb1c7a1f359), W(0x94e49f2bdae22893), W(0xc2ba802ee8a9c46b),
+     W(0xa441757362499e1a)},
+    {W(0x6ba4f08c61504094), W(0x50b52ecb0845c2b9), W(0x189dcf9a4eb4aea7),
+     W(0x1c4c227abfc34a53)},
+    0
+  },
+  {
+    {W(0x6f556c9b9f023704), W(0x1d9c56d8edecc010), W(0x59af267eb7de7c44),
+     W(0xac067a1efbf9cf69)},
+    {W(0x158baf13e7ff0e57), W(0xf56a2cebcfa9ff1f), W(0x307c7f07f7e7054c),
+     W(0x10488ce22551cfef)},
+    0
+  },
+  {
+    {W(0x0f09e7cc56972ba3), W(0x3d11328ed4dcb3de), W(0xfb4b1b9f109f5868),
+     W(0xf008b9a76ffc8bf3)},
+    {W(0x609a3beeb5276a2b), W(0x0fab1957ed2298f9), W(0x57cea54aefb14479),
+     W(0xcb8e6eea5f1d12cb)},
+    0
+  },
+  {
+    {W(0x46bf7f081a05b921), W(0x6bc1fb84e1126b40), W(0x53112c4a704081f6),
+     W(0xe56e4c6a2299f3cd)},
+    {W(0x897e6f818cc6825b), W(0xe433f75631382bad), W(0xc36b93226dd66528),
+     W(0xde2fbbd7445b0d84)},
+    0
+  },
+  {
+    {W(0x4a8682540f0af29f), W(0xa8701ebadc112911), W(0x44012f2e3679243f),
+     W(0x07658eb2413ebdef)},
+    {W(0x675640324ebbfa2b), W(0xb7a58c39befa4d3b), W(0x31e02f79d4827ba6),
+     W(0x1ca44fb094e027d7)},
+    0
+  },
+  {
+    {W(0x258951f371347599), W(0xb45b4a6bb7cd0810), W(0x7e6f74e999136086),
+     W(0xa76512b182edf1e9)},
+    {W(0x6bef3aa484457b20), W(0xd3f22c9e8171d702), W(0xeb9b96365a98f9d0),
+     W(0xc7ba9f7c80aeaec9)},
+    0
+  },
+  {
+    {W(0xbe2844cec1fbba0c), W(0x1e8a62be09606295), W(0xfd26f723cd7cbbb8),
+     W(0xb7f5618834387372)},
+    {W(0x3108c9e394192013), W(0xf1a8d6aed3df2b09), W(0x91b188e7f566fdd2),
+     W(0xc7b0761787866265)},
+    0
+  },
+  {
+    {W(0x5ae6e6c16f216d89), W(0xbdfef191c0b2126c), W(0x4c81e6d88776a652),
+     W(0x1fa030e33c3437d6)},
+    {W(0x2d9671190eba354c), W(0x817c3ad6a2d27806), W(0x85d857606eaa9b7f),
+     W(0x46d0c152dd679329)},
+    0
+  },
+  {
+    {W(0x87bbb609400b9b22), W(0xdf3f13d204f27063), W(0xcd10c7bb841a2fdd),
+     W(0xde09b5780f5c7ee5)},
+    {W(0x40e093c028220830), W(0x552d4b1e7a055624), W(0xb8b7c66c16cf164f),
+     W(0xf17e4469c4ed47e8)},
+    0
+  },
+  {
+    {W(0x854f089659ef891c), W(0x45cce96d56a43db6), W(0x33cf6e36cd937a76),
+     W(0xb129007c7fbfed2c)},
+    {W(0x1d12c03b6f28a2fd), W(0xf095aa6594e909dd), W(0x4ca32986c9102de2),
+     W(0x1c95b1b7c1340119)},
+    0
+  },
+  {
+    {W(0xfa7b60ca1f1a196e), W(0xb668467319b2f318), W(0xfbddefdda7895ee0),
+     W(0x4057c8231332144c)},
+    {W(0xdc2be2d915b961cb), W(0x0775618f6dd8c489), W(0xaed1d70dfcc1fef3),
+     W(0x26f2b0ebbdae1e11)},
+    0
+  },
+  {
+    {W(0xb3a7cf365e3168ee), W(0x5f7e818b0b46f5a3), W(0x4112b82677d38bec),
+     W(0xe7554b1753ac5e1e)},
+    {W(0xd8453db0663b469c), W(0x089147e5a1e3721c), W(0xc5671bb74d799f3f),
+     W(0xa39d8b4c31b9f019)},
+    0
+  },
+  {
+    {W(0x2ea8bac301726c37), W(0xcf1fb4a3afd6eb54), W(0x4ff1750757b42bbf),
+     W(0x226693fead062e1d)},
+    {W(0x812842cf70fb32ad), W(0x0bb21f8fc5d75b20), W(0x7e7df71fda836d38),
+     W(0x983dbef641431326)},
+    0
+  },
+  {
+    {W(0x9923c1a2f634db58), W(0x5b69506aea8f4eb6), W(0xb0724a16a0d8a030),
+     W(0x8f2c6c5cd9356294)},
+    {W(0x04e6d065afec1603), W(0xc0b3e956fa1092d6), W(0xf39dfc291f243912),
+     W(0x0f951817b9d9a3a9)},
+    0
+  },
+  {
+    {W(0x3471e822d7f1661e), W(0x327c477517908382), W(0xc8780616643fc842),
+     W(0x540def712cf40f15)},
+    {W(0x5527667d7359dcea), W(0xdf2bdb0841575f6e), W(0xafc9730433cdebf2),
+     W(0x1c6797e5a55e77bf)},
+    0
+  },
+  {
+    {W(0x67d256cce695b9b1), W(0x448525100db26849), W(0xe6732f20c78b5a5c),
+     W(0x3fe044ff30a35e5a)},
+    {W(0x793d19348e4bb605), W(0x21e87f0245922bfe), W(0x967070bbfb7b4afd),
+     W(0x66ffce9af9a80274)},
+    0
+  },
+  {
+    {W(0x2ed372df0cdadd7c), W(0x01aa8643bb1c6c7a), W(0x68fd8f60fc80b0d1),
+     W(0x04b676d267f8f195)},
+    {W(0x06d97fe95cbb2f03), W(0xf8be884aaca18d7d), W(0x14f450fef274a448),
+     W(0xf549c5b71b82cdfe)},
+    0
+  },
+  {
+    {W(0x18eb54cffb9f14c9), W(0x7b56c08199ce5b6a), W(0x0a845f087aaf3520),
+     W(0x003d22d0e6099da8)},
+    {W(0x3c6f22957203dbb4), W(0x33fc0ccf34fc41cf), W(0xaeecf961161c9d90),
+     W(0x3fefe46060437381)},
+    0
+  },
+  {
+    {W(0xd751d4201b6ac8f7), W(0x823826c14ccd3e7b), W(0x3571c491f3c1aade),
+     W(0x5ca7969ef1ef9b7d)},
+    {W(0x3534734bfacff063), W(0x70ff612773445034), W(0xb72e9357542c40f5),
+     W(0x62247693a28bccef)},
+    0
+  },
+  {
+    {W(0x91c0ea8e2516938f), W(0xaf5a945a303d75db), W(0x1104dd2210efbf10),
+     W(0x6d51121b291f4e2d)},
+    {W(0x22d5a442cd2c8f62), W(0x35b6047e3e481b04), W(0x972a538e7f5c0847),
+     W(0x6f00cb6d5aafeeca)},
+    0
+  },
+  {
+    {W(0x103d53b2eea6ea73), W(0x672c0cbb0c7d1bde), W(0x57718fd056ffe33c),
+     W(0x99e7ad698cd3ac0d)},
+    {W(0xeb57d7d47d04632d), W(0x15465722ad6d1aaf), W(0x140b9389f965a608),
+     W(0x53e881b353f17841)},
+    0
+  },
+  {
+    {W(0x777c60e6ba9fd67c), W(0x213277f8215812ca), W(0xb8881841475004a0),
+     W(0x7c6e3ce6a9143263)},
+    {W(0x5d400617cd3032b3), W(0x96e690990e21d8c9), W(0x0301a071ef244fd8),
+     W(0x3143924f44816d65)},
+    0
+  },
+  {
+    {W(0xbba904d5163b2d86), W(0xe74447ed095c0bcd), W(0x1c220b9280d2d98b),
+     W(0x9b52627e75fbc2d2)},
+    {W(0x86b5edcb85c1705f), W(0x97556838f2007c43), W(0xa48142956fedbd96),
+     W(0x806ca31684e6795e)},
+    0
+  },
+  {
+    {W(0x17bb9477b7cb6b8e), W(0xcecfc7db184165d8), W(0x8d8f5a3b68df9078),
+     W(0xb4cccfe2bea2d0bb)},
+    {W(0xdbde2943c619f8a3), W(0x3af34fe61710a409), W(0xe2027366b99dccd1),
+     W(0x9f3ccb8bfce42fe7)},
+    0
+  },
+  {
+    {W(0x2e0248247dda3da1), W(0x15c6d5e477497491), W(0x346b50b8683d6d2a),
+     W(0x6ae6a6116a8598c2)},
+    {W(0xb81c06d18104f46c), W(0x4dbd6ce1c80e3fa9), W(0xc840e4af97f9ff47),
+     W(0x271449363d7820ea)},
+    0
+  },
+  {
+    {W(0x5be81076ea15ca76), W(0xa9cecdef94089202), W(0x9203ecd9242702d2),
+     W(0xc80dca32ce135a38)},
+    {W(0xd0154f002508729f), W(0x4f39983276e40970), W(0xc1a53a742a19dfd6),
+     W(0x546f1e0a660c1a3d)},
+    0
+  },
+  {
+    {W(0x681812f41c2d2ffb), W(0x74ed5af66b251947), W(0x8a101db15ff58561),
+     W(0x4d1660dab4705dad)},
+    {W(0x09a64bfd0b022699), W(0xb1b4eebb10af4592), W(0x761066c1a7ebfa01),
+     W(0xe60b16354373ddb4)},
+    0
+  },
+  {
+    {W(0x7b4c09eef597381f), W(0xe2535dd0dc58501e), W(0xe74969ccdee26bc6),
+     W(0xa7a0969d99f441d5)},
+    {W(0xffb131ab9be6a709), W(0x11525223cc79a1e6), W(0x463086b0d6c3fd44),
+     W(0x386c761afd3a119a)},
+    0
+  },
+  {
+    {W(0x6e91343b85660669), W(0x078616d95689fa4e), W(0x95eaba3b9fa5d40a),
+     W(0xc80a195a9d78d884)},
+    {W(0xb97e229f2ac856ba), W(0xff5b74f19ac10674), W(0x068d50dd1371ffa3),
+     W(0xe612dc006f2001d9)},
+    0
+  },
+  {
+    {W(0x91ca6fdda4cf7e48), W(0xd4dcee2d98f0b886), W(0xdee3d16e455d0561),
+     W(0x21edc773fbe84dbf)},
+    {W(0x29b68580b311c8ea), W(0x0d3cc6d4ded5e2db), W(0xd45c89ff3e8cd517),
+     W(0xd5381a1612f123af)},
+    0
+  },
+  {
+    {W(0xf78d91f4d95111ce), W(0x66b9e734e371e906), W(0xa7aa1e6e3c6f2326),
+     W(0x6b648bb21f8cf84a)},
+    {W(0xce5aba67f192d807), W(0xa00908bf52936969), W(0x99c03189c06cbdf6),
+     W(0x7f778f9ba5aac7b9)},
+    0
+  },
+  {
+    {W(0x9a92ddb921921e56), W(0xa8042de3ee273e61), W(0x30934c0824baa9bd),
+     W(0x56f970a06a07056d)},
+    {W(0x402f6edacf3ba661), W(0x2873e393596e1e10), W(0x9c8a42341377d3b1),
+     W(0xa37a10f05d6e2a29)},
+    0
+  },
+  {
+    {W(0xe01c5db3590f17b9), W(0x49145c150e39160e), W(0xd8d97ec4db4c8b39),
+     W(0x173bb4fd0309890a)},
+    {W(0xe475d9af8235232a), W(0x2471a123de27c483), W(0x2491b405907d0e88),
+     W(0x5cb5eaade702a730)},
+    0
+  },
+  {
+    {W(0xeb2fe09f828b1453), W(0x6b02906351a8d3e1), W(0xbbbb78fe868265a9),
+     W(0xcf63698a11744eb2)},
+    {W(0x63cbb68ecc43b370), W(0xf5ac41ad2d239eff), W(0xda90d229206dd3f2),
+     W(0xe1dee6d959201b6f)},
+    0
+  },
+  {
+    {W(0x073e45227b4e832e), W(0xc4b54f5e5a27576e), W(0xa374d401cfe09350),
+     W(0xbd7214834dd9826a)},
+    {W(0xca232ac00106f368), W(0x985caec1fac28989), W(0xd89ba17262c8d73a),
+     W(0x61f5cd8f74a32b72)},
+    0
+  },
+  {
+    {W(0x56d8322750d26ad2), W(0x2be8f0044bedf456), W(0x8c1fa92ce4305f2a),
+     W(0x1cec9a9de3ed9e1b)},
+    {W(0xfdeaeb41b97eaccc), W(0x6edc91c10ee2bd72), W(0xd230ec38e67b2410),
+     W(0x2c09c7d0c99e8eae)},
+    0
+  },
+  {
+    {W(0x41def9966db49e41), W(0xdab190ba2a47d2fa), W(0xcbd7c54c9176d656),
+     W(0x4e19a18fdffcebdd)},
+    {W(0x972ad6436089449f), W(0xe9cd91f4e342d65c), W(0xddb2333db13bfd94),
+     W(0xb2a293054b3128b3)},
+    0
+  },
+  {
+    {W(0xbdd90c217e9c1009), W(0x4d98f18e589fa674), W(0x19d2afc929f1e47c),
+     W(0xcdfb8e0b7631252b)},
+    {W(0x5737cb67d7626f16), W(0xa61137410c0c7574), W(0xa68bbf5d2fbc1a78),
+     W(0x26626cb679f6d887)},
+    0
+  },
+  {
+    {W(0xeb5548d05713ccc7), W(0xbf6c8d3d65ddf7e4), W(0x6ddcfb85d3d37486),
+     W(0x3328a1bf53910db5)},
+    {W(0xa6c7e9c893afa317), W(0xa5761e68f600c1e6), W(0x219b19c3ac982eb4),
+     W(0x7063bfed1e5c9154)},
+    0
+  },
+  {
+    {W(0x52f6c427ac5f2144), W(0xc7fe5284fa280dff), W(0x9639b5d92955cdc6),
+     W(0x6b1f5a1f8408ef6b)},
+    {W(0xfd80cf89ce581c0a), W(0x77bfc572dfa372f1), W(0x3505486cb1c9c0b0),
+     W(0xf1d241278a5efdcd)},
+    0
+  },
+  {
+    {W(0xdc28bb65c4ab7f97), W(0xaafa8591db6686a9), W(0x0b1131fd0c72d24f),
+     W(0x1153d9eae962e03b)},
+    {W(0x537e8c356d292e26), W(0x1ed934d43c6b9824), W(0x8beafee331a0b454),
+     W(0x0c61ee9714da6494)},
+    0
+  },
+  {
+    {W(0xa7527f28aee95c2b), W(0x558b335d6f713c48), W(0xab20bb76244db24c),
+     W(0x8370a4f5d913e6d2)},
+    {W(0xad45103ec1297a0b), W(0x0e43914b98a70a7f), W(0x68468bbe3a0847ef),
+     W(0x78ae6feb9c6caa17)},
+    0
+  },
+  {
+    {W(0x10cfee1126297027), W(0x6c67ce071a39a45c), W(0x1b731796d2c5394d),
+     W(0x38dbbec53729f0b7)},
+    {W(0xe006e85810fc4b11), W(0xf6d0e7c70872fedc), W(0x0f87c3c4dca842c0),
+     W(0xdb452ded5c7ea627)},
+    0
+  },
+  {
+    {W(0x2cd124fb5390caa3), W(0x52ae78346566f0a2), W(0x5188643a7a10245d),
+     W(0xc889d6bf934dbd26)},
+    {W(0x6b7325b69fc602b8), W(0xff2534c2fe696a7e), W(0xef3aa5668bb7e006),
+     W(0x445ec6cbdc1d0948)},
+    0
+  },
+  {
+    {W(0xd2bbddd6706b22ea), W(0x5f175d10e23274f3), W(0x616f892f9160e329),
+     W(0xb697c905d3e65e86)},
+    {W(0xd5dbf219fb594ddd), W(0x32efdd80d4ee90c7), W(0x21d4990e33804b52),
+     W(0x87da9a896ac424f6)},
+    0
+  },
+  {
+    {W(0xaed48f80053bf8ab), W(0x4b1834a50a48324c), W(0x976e9bdc2e213017),
+     W(0x907044619a07f95d)},
+    {W(0x10b5821e17d59d65), W(0x8a7ff5de33455c1a), W(0x697a16185e0d37f8),
+     W(0x38278800dd5f5b07)},
+    0
+  },
+  {
+    {W(0x48673098a0a1d5c7), W(0xf1351d0dde18cbf2), W(0xd9d6da755d32efca),
+     W(0xd94e6fa18cbec0e3)},
+    {W(0x812a4270851001d1), W(0x1973f545791600a0), W(0xeeb0103ec458d0b6),
+     W(0x43cc58fce318ad71)},
+    0
+  },
+  {
+    {W(0x951befe0405ba999), W(0x321bd67d429f6ebb), W(0x0e455b06e215bd4d),
+     W(0xcd8ed5cbae5db93c)},
+    {W(0x4967a6bd559bfe55), W(0x0556e51833d8eb8c), W(0x89df4b6bbefb024c),
+     W(0xced003387db9bb4e)},
+    0
+  },
+  {
+    {W(0x81bf78de36464829), W(0x8b79e9e0bd7f1652), W(0x7fe12fb04bae2f70),
+     W(0x735bd3354db1771c)},
+    {W(0xd8e188df7e4ddc5e), W(0xa5ce6462527be377), W(0x7f7b0f6f631e456e),
+     W(0x750f689b9be71e1e)},
+    0
+  },
+  {
+    {W(0x55f6f0b80a142ac0), W(0xe49d5e5f38ee10bd), W(0x3a062b24fc037b2e),
+     W(0xe4b25ac6791946dd)},
+    {W(0x8a4dbfe328c42281), W(0xfa2e87b5674eace5), W(0xe637229fa00db40a),
+     W(0xee328dc32f340a33)},
+    0
+  },
+  {
+    {W(0x2e1db60115271ecd), W(0x6ba1dc4a2af1317e), W(0xb832fd4562bb60c9),
+     W(0x5a13dd4eac7047bb)},
+    {W(0x94f6790c5487390f), W(0xe3b1bfec5b1ad87c), W(0x91f20a2cdddfc3fc),
+     W(0x095aecabdc7a8ae6)},
+    0
+  },
+  {
+    {W(0x198e1d7bff6d24e3), W(0x5d3c5fe37aa2df47), W(0x2d9232f328ba5384),
+     W(0x12d2b0f8088e7308)},
+    {W(0xd2789cb6c030e133), W(0xff104752c666ccde), W(0xac31a84da558e560),
+     W(0xa20a76102d5c3b30)},
+    0
+  },
+  {
+    {W(0x28f145a29deb2e69), W(0x67fae2bd5d361772), W(0xfea58015d81f3ca5),
+     W(0x3098ff0dd48a3836)},
+    {W(0x7ba84f17bcb92878), W(0x17a3b5ac7d8ffd62), W(0x4559b657be4b36ef),
+     W(0x5b99faa804f523b8)},
+    0
+  },
+  {
+    {W(0x56e6ec030c01edae), W(0x364ba4723afbda47), W(0xb13ba56e593b7e03),
+     W(0x1970b29f9afac5c8)},
+    {W(0xa58135a6a8c0e759), W(0x5c9c48eec1fdc0cb), W(0x243924c32cb4c4c4),
+     W(0x8994bd1d8fe26ea1)},
+    0
+  },
+  {
+    {W(0x71421621286fbf2d), W(0x61bf89b21841647f), W(0xab051a7bae62918f),
+     W(0x69150ab9567d04e8)},
+    {W(0x263e0c72054c0e26), W(0x6b785ec6efac7ac0), W(0x74c82cd6750e1a7f),
+     W(0x78282fb37f3eef42)},
+    0
+  },
+  {
+    {W(0xc8f8a984d075a2b5), W(0xec5cb3edc42cdc80), W(0x88b84a7e4b078d98),
+     W(0xe74d3b638e10ebfe)},
+    {W(0x4ca9ac689ebbafc0), W(0x4a76a04d12135e3a), W(0xba88ced8c7bed8b0),
+     W(0xf2c017c003cd9bb4)},
+    0
+  },
+  {
+    {W(0x5fba6ff0f7ff4cc4), W(0x3d318a1a3bc972b9), W(0x2044e0941a4c005c),
+     W(0x600dc3dbd901066d)},
+    {W(0xe1e73087f6824da6), W(0x28f0fc4f5794d6eb), W(0x2b04c419a96245d1),
+     W(0x447dee2d41e3c4ba)},
+    0
+  },
+  {
+    {W(0x2d53e7007fef8848), W(0xacafd0b1081f9826), W(0xc47a3d9cc1e7b04a),
+     W(0x121b82a523bada9b)},
+    {W(0x842708599e1b0259), W(0xe6f35275532ad405), W(0xf23dc37315f31a7e),
+     W(0xe7b7e887f6b005b6)},
+    0
+  },
+  {
+    {W(0x839a957b5d8c09b3), W(0x087f74a024310060), W(0x3072fca7b3377ee2),
+     W(0xaa810f185bc362a7)},
+    {W(0x8d1455cc21534644), W(0xd1afbc7b032c25fd), W(0x02528439533eb26e),
+     W(0x3e273f729fbe5dc6)},
+    0
+  },
+  {
+    {W(0xfc520bbd9a80b2e7), W(0xd4d7fa39580baeff), W(0x735973a6cf722dca),
+     W(0x5c3daba95feb16f0)},
+    {W(0x0db07a266cc7818d), W(0x59a5bf5bcf8a7a89), W(0x3fd5d51f01892e6c),
+     W(0xd35cd4e3397ff8fd)},
+    0
+  },
+  {
+    {W(0x0f22721255349d43), W(0xd038bb64b24f5bcb), W(0xa16d0eef04995431),
+     W(0x5cd65e661fdb1664)},
+    {W(0x9e43d2d93865b003), W(0x9799cfde3a8c00ad), W(0x77e701ce6726410f),
+     W(0x93a4fb49fc504c86)},
+    0
+  },
+  {
+    {W(0x447a0b141b660d5c), W(0xee71107b3176305b), W(0xe90c07c8cfd9d6de),
+     W(0x01e4da0e6caf1990)},
+    {W(0x91a86071c0fb0095), W(0x937b6a60950be845), W(0x871ff2ebb5f89bd9),
+     W(0x59171d5cfe5dbc93)},
+    0
+  },
+  {
+    {W(0x2852bcd66ac87117), W(0xe3fe509fc582bff6), W(0x2de9620dc065e80c),
+     W(0xca5cd0fc3918fac9)},
+    {W(0x4458d5afaf4c5bd3), W(0x88b0d2c2d20b4180), W(0xc61d9762e378b9f9),
+     W(0xb9692fa1cd1c7017)},
+    0
+  },
+  {
+    {W(0x5f9f4b43dea9e0c5), W(0x6e14b856f937e614), W(0xa7d9d5accdcbc119),
+     W(0x4787c38acaf7b7de)},
+    {W(0xbccdaae9a3221265), W(0xe1ae995550d7b639), W(0x354e50bc892224b3),
+     W(0xac05261033614c31)},
+    0
+  },
+  {
+    {W(0x7aaa3d6c8bf669c3), W(0x7d6192ad69e8a043), W(0x46fcec3b5da4b397),
+     W(0x214d681aa1301260)},
+    {W(0xc842eeeed80a35c6), W(0xbf36cb2a5296e7d3), W(0xb4159c6efc62142c),
+     W(0xf23ff8f30c63890c)},
+    0
+  },
+  {
+    {W(0x66abec02a0a10ab0), W(0xd3cc72ddee13b345), W(0xd67564973c22df41),
+     W(0x241013f247529276)},
+    {W(0x5c8f5ed347a447b3), W(0x4a52b452c4fb8881), W(0xa4b9e34d5ae8831b),
+     W(0xab7e28be6c068f5a)},
+    0
+  },
+  {
+    {W(0x6290679f0b3158c1), W(0x5fc72525e2255fbe), W(0xb3229ae463302846),
+     W(0xcfec7630bde3b9f5)},
+    {W(0x6015fecdf6b68f68), W(0xc72e25975c9e8f12), W(0x67d4964be3a84952),
+     W(0xc9422784e1cc7f69)},
+    0
+  },
+  {
+    {W(0x20784c76f5a74364), W(0x4fc890731e1e9164), W(0xba5f0e9f8fa91eac),
+     W(0x0d4bba13def9c8f7)},
+    {W(0x390e5aab58097821), W(0xce7a85c46ca38f7a), W(0x5bd8bbbe4630790c),
+     W(0x2d3f3e39765f8997)},
+    0
+  },
+  {
+    {W(0x48e283fc5219cd5e), W(0x185a54e5cb6048af), W(0x5f75c14015148ec1),
+     W(0x8325c2013f3dc1b9)},
+    {W(0x06fcb13ccd46a59e), W(0x62c2915faa26f03e), W(0xa2d2e3b788454aec),
+     W(0xc79589b75e2a741b)},
+    0
+  },
+  {
+    {W(0x9398171458cd08a3), W(0xc902aeb676dc30fe), W(0xce692d33a935333d),
+     W(0x48fa20c7f867b3a5)},
+    {W(0x0b396ce45386ab88), W(0x98264bbb59cb1666), W(0xd46992287072a0f8),
+     W(0xd4eeea2ff35ebf90)},
+    0
+  },
+  {
+    {W(0x05a83cbba7f73d5d), W(0xa54956d6818a27a7), W(0xfdc94ce5eba9eecd),
+     W(0x118b4b70f7615a1e)},
+    {W(0x9fbbf352bd259457), W(0xbc1cd2e35a2c5db6), W(0x9b5c13d8ff050d8f),
+     W(0x72e1dc91472c843e)},
+    0
+  },
+  {
+    {W(0xc9644cd4be728d01), W(0x25a44b1dfb6d52e9), W(0x56797707ee9cead6),
+     W(0x685c601dcc6793cc)},
+    {W(0xa560c8392dbdb017), W(0x0b7547b7b3a7df17), W(0xb263a3f28266aae6),
+     W(0xa147907c7d00ddb3)},
+    0
+  },
+  {
+    {W(0x7007c8569a6f4392), W(0xd06dd5b84dc5855a), W(0xd73a86b356ca68d1),
+     W(0xe74b02eb0d37300f)},
+    {W(0x5496968210cbffd5), W(0x3be43193399b5cb9), W(0xad6e15cd401376f7),
+     W(0x12f0b9cf2c775c06)},
+    0
+  },
+  {
+    {W(0xe87ccf12c02faca1), W(0x98418a6aad933559), W(0xa1634480ad4c4b9a),
+     W(0xde6dc13beb78e5f7)},
+    {W(0x0e477a43ebca0438), W(0x358b5dde080d1e42), W(0x4c3c8a621227ab57),
+     W(0xa7c479262828b83e)},
+    0
+  },
+  {
+    {W(0xd29632bf297ed12c), W(0x1dc5d296ec468446), W(0x42e5bc4bc536cd27),
+     W(0x25df205aa2d646b1)},
+    {W(0x4d5a33a29b2f3d79), W(0x6eb956f0bb4dc5d5), W(0x50d87392b0f84623),
+     W(0xafb9161f52eac9bb)},
+    0
+  },
+  {
+    {W(0xccbdbaff1a5978ed), W(0xcc6775a63943e7c9), W(0xeea73499e5be51a8),
+     W(0x7f253a20517209d4)},
+    {W(0x316440cad060432a), W(0x2d0a3b0ecff07b05), W(0x994527396a0ac55b),
+     W(0x1de4654acf09cd1f)},
+    0
+  },
+  {
+    {W(0xb4c186c849907f6d), W(0x6bfb5024c7593e46), W(0x978ba4bd0b58c384),
+     W(0x37e6f302a19670fb)},
+    {W(0xd8a882e3c7396e7b), W(0x27dee1964ba0e894), W(0x7d81741db015291c),
+     W(0xad7d6910ec2f1db6)},
+    0
+  },
+  {
+    {W(0xfdcbc5d0f4cc8f07), W(0x112288469ac9518d), W(0x2437640ca12194f1),
+     W(0x1c7da079c6aedbc5)},
+    {W(0xc94e7ba10979bfcc), W(0xa4d9baca8808401e), W(0x3b0b7af94a08fe97),
+     W(0x939c26bcb5c40b1e)},
+    0
+  },
+  {
+    {W(0xa8b3dee9b64b6a80), W(0xbb805caeca873131), W(0x72fe521cd5e4d63e),
+     W(0x326b69acbd532cae)},
+    {W(0x868519f9026635eb), W(0x62575321306918a0), W(0x2b1d0f0868c31ab5),
+     W(0x292708ee45b17f7b)},
+    0
+  },
+  {
+    {W(0x0aafb61a2d544e15), W(0x0c604e455fc5c379), W(0x63a74332eea9659f),
+     W(0x95d7b801049d8073)},
+    {W(0x40d278f804d1b50f), W(0x637db477bb1a2b7b), W(0x273c3b9849f1e11a),
+     W(0xf458b7e7ac0b699d)},
+    0
+  },
+  {
+    {W(0xa4b8398aae4d8f4e), W(0xa1d1930dc98c3c7e), W(0xb4d8a767c4fa260b),
+     W(0x0fbd892c7e42b583)},
+    {W(0x53e26ad07a256031), W(0x54429e910ef77243), W(0x9902f4a545426fa5),
+     W(0xe5537b1ea1d05a06)},
+    0
+  },
+  {
+    {W(0x4678698298a043fa), W(0x95aaea1c89582a6c), W(0x6c5ced44ecc997a0),
+     W(0xb6e435eedcfe5cce)},
+    {W(0xd3ede4eddab17326), W(0xb4d177ed150eb377), W(0x4ccdd37071cab7bf),
+     W(0x57da19e15b4e5b09)},
+    0
+  },
+  {
+    {W(0x86f1f60443202e69), W(0xa3f1d318b1fa18ff), W(0x9a6e6a29c6feb7c3),
+     W(0xc31839026d7df40d)},
+    {W(0x7b9ebf365e259d42), W(0x0afd956784ae0879), W(0x113584675ad852aa),
+     W(0x60536e4ecf458401)},
+    0
+  },
+  {
+    {W(0xcd129585cf3ab2f5), W(0x23ee13aee73bd6e1), W(0x55e69bcbe08e28d7),
+     W(0x8c64de0d7376e45b)},
+    {W(0x961ab2f93454f4e3), W(0xd765c146f964d335), W(0xb2948566749592ea),
+     W(0xeaa3d5cadbf88219)},
+    0
+  },
+  {
+    {W(0x1492a2d36b362bf2), W(0x931848bb19c44c97), W(0xace3126f1fd0236b),
+     W(0x64b5a6453a7ad2d9)},
+    {W(0x23465661ce20fabe), W(0x5b81691952dfaac5), W(0x99ef579311dd09e9),
+     W(0xeef3e530a3bc564f)},
+    0
+  },
+  {
+    {W(0xad5baa79eb3b94b4), W(0x6d82c6a3f8ef8920), W(0xbdeec69a18d1aa31),
+     W(0x9f1c12d443e09613)},
+    {W(0x607a1294065049de), W(0x57b705db99cd1f0f), W(0x0e5ece7c086c0217),
+     W(0x4b2ce4bc7ac3f4e4)},
+    0
+  },
+  {
+    {W(0x46042011706fd04a), W(0xdd2566b9b91a66a1), W(0x815b41cb7ecb435f),
+     W(0xc5de7ec7695196cf)},
+    {W(0xa8b6beb32c38133f), W(0x45db952c009f264f), W(0xb4e64ca346b91ef1),
+     W(0xcb611c085d1e7727)},
+    0
+  },
+  {
+    {W(0x907bc2f86f6d58b9), W(0x028acd715a2ed801), W(0x0bc51aefb2ef12d7),
+     W(0x5b2705e06c962c5d)},
+    {W(0x9fa38793a6b00f73), W(0x5e0683158a2e2299), W(0x649c9dcaaa8162cb),
+     W(0x74b294b2771f2fec)},
+    0
+  },
+  {
+    {W(0x80a629d6291c8f2d), W(0xbc8561d98f240e54), W(0xd4ddb8907e09ad47),
+     W(0x53e335998d1e1db9)},
+    {W(0xf6ec398145f2fc77), W(0x402bcfb74a10358b), W(0xc723ff58cd7aeef6),
+     W(0xadaa0a4c3643df26)},
+    0
+  },
+  {
+    {W(0xfbe54b15951d5d41), W(0x774f4d622b4564a3), W(0xacc37a25a8c19b89),
+     W(0xd42a55ab2d8dec02)},
+    {W(0xa3ca91d2705f4491), W(0xce013649a48f847c), W(0xdcfcb1ff1e7a929b),
+     W(0xc8d1f08e7284b8ef)},
+    0
+  },
+  {
+    {W(0x068574b90b4abb4b), W(0x24572808f5f24bb2), W(0x523c99a10dd1b1ca),
+     W(0x558a4b6b90c5a6b8)},
+    {W(0x1bfe4a2933385bb3), W(0x5b8a5c8fc1dc42a8), W(0x7cfa93d2e7c22e56),
+     W(0x49d880cd614f905f)},
+    0
+  },
+  {
+    {W(0x662654f5d72af329), W(0xff7c0b853abd343a), W(0x8fde366576f1595e),
+     W(0x4ce702c4fb3d4a7a)},
+    {W(0x96e66fd00ffeeed3), W(0x095755e868efc48f), W(0xcedcecb59c3748ca),
+     W(0xacfb2d776e67111f)},
+    0
+  },
+  {
+    {W(0x3ab4a6b01a391f8d), W(0x41de55854861e61e), W(0x55336caab1eb69b4),
+     W(0xc17fc72602140087)},
+    {W(0x0ea7c45972b57e6a), W(0xcc549b9978dfeb1c), W(0x61db1dc78d0680d0),
+     W(0x4629cb0d44ba4a5d)},
+    0
+  },
+  {
+    {W(0xd34819e6ba17e0c5), W(0xda435eb2e84b972f), W(0x8342b166c1213eb1),
+     W(0x194d0b620e94b903)},
+    {W(0xf44abcc99677f3d7), W(0x88007ff33958fd87), W(0x6dcc6265e136b527),
+     W(0x8eedf28862f96f92)},
+    0
+  },
+  {
+    {W(0x75867d8efc9b6d90), W(0xbbbc7769470a38a9), W(0x8964a918b62c8873),
+     W(0x1b242d937c047c75)},
+    {W(0x76e51d132639e0d2), W(0xa83ee52dd8825abd), W(0xdfe79b9cffd03d28),
+     W(0x15e4450bd2d375bd)},
+    0
+  },
+  {
+    {W(0xaf53636e7d64ba22), W(0x61dc3838eb67eece), W(0x909b7c885ee80bad),
+     W(0x89923ee54087a780)},
+    {W(0x9ab66a9300b2b434), W(0x7c011e20231ada46), W(0x69616614cae2b702),
+     W(0xc45efa34fb920de7)},
+    0
+  },
+  {
+    {W(0xaccdd19d7a077e12), W(0xabc4364897bc17d2), W(0xee9fff156cff4ae9),
+     W(0x158038b034cb772f)},
+    {W(0xb529bc876d5241ac), W(0x2fcbf1638f8c0d9f), W(0x99f5f1835fb429f9),
+     W(0xa9310d1beda3ce37)},
+    0
+  },
+  {
+    {W(0x43e3e16abc734ebc), W(0x908bd7e5fc92e0d2), W(0xfa73e2bf6de4e674),
+     W(0x16022d1af8433112)},
+    {W(0x03ae33f37a399543), W(0xde28e2bf4961f752), W(0x71fae6260f23b8cf),
+     W(0x22296acadafb0f49)},
+    0
+  },
+  {
+    {W(0x128c893991e63df3), W(0xbca45fea5d73db84), W(0x80ac4e47deab6cb2),
+     W(0x21d6761bb42d3b2a)},
+    {W(0xc200bb6645e7136e), W(0x20e4a103716aef21), W(0x30c8e9dbe84af92e),
+     W(0x7bd43f3bf1feb83e)},
+    0
+  },
+  {
+    {W(0xb5aae7a2ed1b2a51), W(0xf349d14d1ef3d3be), W(0x5eab25db863f3664),
+     W(0x58589df00cd9b5a2)},
+    {W(0x652892cb5b68ae62), W(0x0834d06837266a62), W(0xc32b733adc232bd8),
+     W(0x10c17bd8fa0116d6)},
+    0
+  },
+  {
+    {W(0xe6d1ccd042ac027e), W(0x6db716bce4facc4b), W(0x44132b701e70d682),
+     W(0xe50caea665808aa6)},
+    {W(0x8443cf352bfa4bce), W(0xc51073865f4d998a), W(0x726572fe4cb27772),
+     W(0x3db9020382ea7c90)},
+    0
+  },
+  {
+    {W(0x761c25e29d3827ea), W(0x59fb65b5fc6a8ed6), W(0x4c935a7fb5ba1637),
+     W(0x43c4ff6cecfd045a)},
+    {W(0x14f2f33d5778321f), W(0xbf6c19f1ddc46143), W(0x34867bf818002f8f),
+     W(0xba50610f4b18d224)},
+    0
+  },
+  {
+    {W(0x206068e3d94dd306), W(0xd5effdef573839bc), W(0x397db384bb49d9fb),
+     W(0x6e5e24cfa23a43f0)},
+    {W(0x8f05ddc1fb1ab5b0), W(0x34e0cd340301a1c3), W(0xfb041df305b2da97),
+     W(0xe7e307eac54d6481)},
+    0
+  },
+  {
+    {W(0xe009a9e2018b19e0), W(0x4c24212de78cbbd6), W(0x8c48871dd9c5808e),
+     W(0xaf59dbeb1033a33f)},
+    {W(0xb4fb849554714920), W(0x8010828c55d3f36a), W(0xee28a9ecabdfb0bd),
+     W(0xed572bbdd191ab02)},
+    0
+  },
+  {
+    {W(0xa241c2e3e66610f3), W(0x1e0061fbaadfac23), W(0x94a1936219cc2338),
+     W(0xbf30560c31fc93ca)},
+    {W(0xe75b10785db8cd06), W(0x92ed39a2d6734293), W(0xea1193e6727f9044),
+     W(0x9ea79050d8bd249b)},
+    0
+  },
+  {
+    {W(0x50f74a9411c15c25), W(0xb78233b1096a7ed8), W(0xf48f5695f054fbd5),
+     W(0xf4fd835bebd988fb)},
+    {W(0x60ed298ecd7a2a54), W(0x64f3df27f5b4ba31), W(0xe7270f333237d023),
+     W(0xaca3b2eca74d0383)},
+    0
+  },
+  {
+    {W(0xe80ce47455010a99), W(0x1841372e0cf23fbc), W(0xf7b0c5fe3361d538),
+     W(0x317e1a2b7e66d326)},
+    {W(0x764503db35c77bf4), W(0xa5da0b812721ca23), W(0x87814785345dd08f),
+     W(0xdfcaa72cc8a1248b)},
+    0
+  },
+  {
+    {W(0xc1aad905552159e2), W(0x54cd107f2b6c7134), W(0xad5f25b0ff7355ac),
+     W(0xb5ed0f14acf7886f)},
+    {W(0xebb730411bedd2c2), W(0xfa3d7246cddae883), W(0x8191c445b6f51583),
+     W(0xbc89735d8e588407)},
+    0
+  },
+  {
+    {W(0x43e382880b187c4b), W(0xcabac24389c24474), W(0x1f5e5644f068e791),
+     W(0x2cd2fb305dbc88e7)},
+    {W(0xed7942411941f749), W(0x69df1093ff27d39e), W(0x37db81fed1c4cfd2),
+     W(0xed064323597329e6)},
+    0
+  },
+  {
+    {W(0x702ce0572ba12185), W(0xfa3e51e5da9543f6), W(0x5ae449eda3aa0f56),
+     W(0x19c528cfce933f22)},
+    {W(0xa8046043493ed418), W(0x27258325b7a7c684), W(0xd358756e8c58e4fa),
+     W(0x55ce2ed7fe05c284)},
+    0
+  },
+  {
+    {W(0x693e7c45062ff0aa), W(0x6d3685df913187cd), W(0x2c4810e4ac29d5ea),
+     W(0x0d4022d6d002e870)},
+    {W(0xb8b688a13817a2b3), W(0x6ba3fe9603f2be70), W(0x680dad8b084a3be4),
+     W(0xec676e2da783217b)},
+    0
+  },
+  {
+    {W(0xb4defa71be2ed232), W(0x10f7f9b191b0bd1b), W(0xe80b50d7e80a6c63),
+     W(0x836cb7dd08224f4b)},
+    {W(0x427e614d226c3919), W(0x9ea5036a2c7cd68b), W(0x27bb3c93524ab740),
+     W(0x64e3d98d902c0a5a)},
+    0
+  },
+  {
+    {W(0x2003fac33e48cd0e), W(0x7816c51b99230f96), W(0x919e03caa2747474),
+     W(0x8ceaa3422623259e)},
+    {W(0x69e522f00cd61154), W(0xa2b25ad1ae217c55), W(0x8c831284c35735b8),
+     W(0x736507ba71740797)},
+    0
+  },
+  {
+    {W(0x669f116c22fc8f94), W(0x668a11bf063725c1), W(0xfe1796bdc2f53a48),
+     W(0x9255e6761b511088)},
+    {W(0xcbf1b9900b283b7b), W(0x9fb7b9ba8b0e65bf), W(0xcd8e524d4d583167),
+     W(0x51500121a80830b8)},
+    0
+  },
+  {
+    {W(0xc6c9719161b5deb4), W(0x739cb98b5a4c7368), W(0xbc56cfe378972f75),
+     W(0xf539aa1632ef1fa1)},
+    {W(0x9e4c2f938d1d0db3), W(0x7cfdf5ffa98ac593), W(0xde2711e4480f0aea),
+     W(0xd85e9e5d9d2b5c17)},
+    0
+  },
+  {
+    {W(0x4e414c73196d1d5e), W(0xf1df21d2cbe992bb), W(0xd318047d72ca7a30),
+     W(0xdaceaf9e581200c9)},
+    {W(0x540f809a04d31634), W(0xc45a5017315459da), W(0x27a120502c866af7),
+     W(0x3b913be02a11aa54)},
+    0
+  },
+  {
+    {W(0xae526c914252a05b), W(0x0b1ca2d64c83ffb3), W(0xbd8300860b246460),
+     W(0x5b3d54b649cefc9a)},
+    {W(0xef1535e60fcd23d9), W(0x29d72bd63ad6343d), W(0x10d0bfaa0fbfbc86),
+     W(0x193a5d324fafa436)},
+    0
+  },
+  {
+    {W(0x4d2de7881cd737d9), W(0x2dd5e6f5d785b7ab), W(0xae55dcc257432d91),
+     W(0x49c028063fa4525d)},
+    {W(0x2f97d2a9081e36b1), W(0x0eeb8f48c4223399), W(0x383daedd03a9c3a8),
+     W(0x0c6d23f0e5e3f5c1)},
+    0
+  }
+};
+
+static const wei_tables_t tables_p256 = {
+  p256_wnd_fixed,
+  p256_wnd_naf,
+  NULL
+};
+
+#undef W
@@ -0,0 +1,17747 @@
+/* Autogenerated: scripts/gen-tables.c p384 */
+/* machine_wordsize = 64 */
+/* fixed window = 4, naf window = 12 */
+
+#define W UINT64_C
+
+static const wge_t p384_wnd_fixed[1536] = {
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3dd0756649c0b528), W(0x20e378e2a0d6ce38), W(0x879c3afc541b4d6e),
+     W(0x6454868459a30eff), W(0x812ff723614ede2b), W(0x4d3aadc2299e1513)},
+    {W(0x23043dad4b03a4fe), W(0xa1bfa8bf7bb4a9ac), W(0x8bade7562e83b050),
+     W(0xc6c3521968f4ffd9), W(0xdd8002263969a840), W(0x2b78abc25a15c5e9)},
+    0
+  },
+  {
+    {W(0xc8229e55783dde91), W(0x8e6c8f2e022b53f0), W(0x3504e6f0ff9d48a1),
+     W(0xda821495f0687f50), W(0x9c90a4fd2de4b506), W(0xdb93b776427460c3)},
+    {W(0x42ea84633140bfda), W(0xe8e8e4a8c2aaccd8), W(0x15e4f18bdc588258),
+     W(0x09f1fe415172bad9), W(0x070d430900b0e684), W(0xe34947f7123df0c2)},
+    0
+  },
+  {
+    {W(0x05e4dbe6c1dc4073), W(0xc54ea9fff04f779c), W(0x6b2034e9a170ccf0),
+     W(0x3a48d732d51c6c3e), W(0xe36f7e2d263aa470), W(0xd283fe68e7c1c3ac)},
+    {W(0x7e284821c04ee157), W(0x92d789a77ae0e36d), W(0x132663c04ef67446),
+     W(0x68012d5ad2e1d0b4), W(0xf6db68b15102b339), W(0x465465fc983292af)},
+    0
+  },
+  {
+    {W(0x0aae8477ebb68f2c), W(0x30594ccbee0421e3), W(0x2e4f153b0aecac46),
+     W(0x078358d4736400ad), W(0xfb40f647d685d979), W(0xcfeee6dd34179228)},
+    {W(0x54f3e8e79b3a03b2), W(0xe74bb7f17bfec97e), W(0x8e3e61a34c542ad1),
+     W(0x147162d30418c693), W(0xe607b9e33820017d), W(0x50946875303df319)},
+    0
+  },
+  {
+    {W(0xbb595eba68f1f0df), W(0xc185c0cbcc873466), W(0x7f1eb1b5293c703b),
+     W(0x60db2cf5aacc05e6), W(0xc676b987e2e8e4c6), W(0xe1bb26b11d178ffb)},
+    {W(0x2b694ba07073fa21), W(0x22c16e2e72f34566), W(0x80b61b3101c35b99),
+     W(0x4b237faf982c0411), W(0xe6c5944024de236d), W(0x4db1c9d6e209e4a3)},
+    0
+  },
+  {
+    {W(0x7eb5c9317d56dad8), W(0xcb2454b339d3413a), W(0xec52930f580d57f2),
+     W(0x2a33f6661bdf6015), W(0x4f0f6a962b02d33b), W(0xc482e189f0430c40)},
+    {W(0x3f62b16ea7b08203), W(0x739ac69d5b3d4dce), W(0x8bd4bffcb79e33b0),
+     W(0x93c9e5f61b546f05), W(0x586d8ededf21559a), W(0xc9962152af2a9eba)},
+    0
+  },
+  {
+    {W(0xdf13b9d17d69222b), W(0x4ce6415f874774b1), W(0x731edcf8211faa95),
+     W(0x5f4215d1659753ed), W(0xf893db589db2df55), W(0x932c9f811c89025b)},
+    {W(0x0996b2207706a61e), W(0x135349d5a8641c79), W(0x65aad76f50130844),
+     W(0x0ff37c0401fff780), W(0xf57f238e693b0706), W(0xd90a16b6af6c9b3e)},
+    0
+  },
+  {
+    {W(0x23f60a05dd9bcbba), W(0x9e336de5ae9b587a), W(0x1c5c2e7193d7e30f),
+     W(0x1d9aebd64f3ddb37), W(0x1c7b5fe116b66423), W(0x5db4f184349cd9b1)},
+    {W(0x0d2cfe83e6655a44), W(0x836dbb36b7e55e87), W(0x701754bf7d8686e4),
+     W(0xe9923263a42dbba2), W(0x7008d943c48ecf0e), W(0x3c0c6dd70d27ef61)},
+    0
+  },
+  {
+    {W(0x2f5d200e2353b92f), W(0xe35d87293fd7e4f9), W(0x26094833a96d745d),
+     W(0xdc351dc13cbfff3f), W(0x26d464c6dad54d6a), W(0x5cab1d1d53636c6a)},
+    {W(0xf2813072b18ec0b0), W(0x3777e270d742aa2f), W(0x27f061c7033ca7c2),
+     W(0xa6ecaccc68ead0d8), W(0x7d9429f4ee69a754), W(0xe770633431e8f5c6)},
+    0
+  },
+  {
+    {W(0x845539d3c8d99c02), W(0x2a15a9a6e58d6787), W(0xe9f6368eab225fa3),
+     W(0x54a612d7eb32cabe), W(0xc2f646025c4845ec), W(0xa91a5280db1c212e)},
+    {W(0xbb971f78e67b5fce), W(0x03a530eb13b9e85c), W(0x592ac0ba794eabfd),
+     W(0x81961b8ccfd7fd1d), W(0x3e03370a47a9b8aa), W(0x6eb995bec80174e8)},
+    0
+  },
+  {
+    {W(0xc7708b19b68b8c7d), W(0x4532077c44377aba), W(0x0dcc67706cdad64f),
+     W(0x01b8bf56147b6602), W(0xf8d89885f0561d79), W(0x9c19e9fc7ba9c437)},
+    {W(0x764eb146bdc4ba25), W(0x604fe46bac144b83), W(0x3ce813298a77e780),
+     W(0x2e070f36fe9e682e), W(0x41821d0c3a53287a), W(0x9aa62f9f3533f918)},
+    0
+  },
+  {
+    {W(0x3db8477270313de0), W(0xd4258cc55d970420), W(0x03aced26c8edfee1),
+     W(0xf67eb42235d77d83), W(0x523c40dbcf9ab45c), W(0x627b415f9c35b26d)},
+    {W(0xfacc45e48be55ed8), W(0x80d60af627aa651a), W(0x8c79848fd0e102ac),
+     W(0x40c64a4e66bed5af), W(0x0329eab1f7942f0e), W(0x0c6e430ef9c4af3d)},
+    0
+  },
+  {
+    {W(0x9b7aeb7e75ccbdfb), W(0xb25e28c5f6749a95), W(0x8a7a8e4633b7d4ae),
+     W(0xdb5203a8d9c1bd56), W(0xd2657265ed22df97), W(0xb51c56e18cf23c94)},
+    {W(0xf4d394596c3d812d), W(0xd8e88f1a87cae0c2), W(0x789a2a48cf4d0fe3),
+     W(0xb7feac2dfec38d60), W(0x81fdbd1c3b490ec3), W(0x4617adb7cc6979e1)},
+    0
+  },
+  {
+    {W(0x5865e5018f75244c), W(0xd02225fb01ec909f), W(0xca6b1af8b1f85c2a),
+     W(0x44ce05ff88957166), W(0x8058994c5710c0c9), W(0x46d227c432f6b1ba)},
+    {W(0xbe4b4a9003cb68e5), W(0x540b8b82730a99d1), W(0x1ecc8585e11dbbbf),
+     W(0x72445345d9c3b691), W(0x647d24db13690a74), W(0x4429839ddefbadf5)},
+    0
+  },
+  {
+    {W(0x446ad8884709f4a9), W(0x2b7210e2ec3dabd8), W(0x83ccf19550e07b34),
+     W(0x59500917789b3075), W(0x0fc01fd4eb085993), W(0xfb62d26f4903026b)},
+    {W(0x2309cc9d6fe989bb), W(0x61609cbd144bd586), W(0x4b23d3a0de06610c),
+     W(0xdddc2866d898f470), W(0x8733fc41400c5797), W(0x5a68c6fed0bc2716)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xda6e8a7f7c33ed91), W(0x992afb5b0ecdd2d8), W(0x37cf65517917652a),
+     W(0x317b63ea2887d5ff), W(0x37065f5313bdc3fa), W(0xa10896aa435abaa1)},
+    {W(0x9b21615fefabca26), W(0xeb07ddea230cf00d), W(0x914871dc154d410f),
+     W(0xb333bdfbc88ee148), W(0x51c305c6a72d1967), W(0x659db48181ef2513)},
+    0
+  },
+  {
+    {W(0xad852b878c0a64a4), W(0x0d784cf208f779d5), W(0x1896b9fcc651b1dd),
+     W(0xba8953d612e8dc87), W(0x3a9865baa631cfb0), W(0x5dd2a4a0626b3d79)},
+    {W(0x1148bc72687c20bb), W(0xa372dfc2f2a52bfd), W(0x77315f9e9448fd08),
+     W(0x4bcb06f00a2377b6), W(0x73b42725b35b4ff0), W(0xc510ad93aabca99f)},
+    0
+  },
+  {
+    {W(0x3ccf806ab35bf6cf), W(0x2d368d48e7f30c2b), W(0x4f504e06ea52bef9),
+     W(0x40d01ff53a7d2f3c), W(0x62e5c5d3e73a1bc9), W(0x66e4794bae7d7400)},
+    {W(0x3d30625e5ffef312), W(0x4580609da766ddf1), W(0x5c3ca10d04bab985),
+     W(0x2605ca009da2a2ca), W(0x48eab00eb5c9462c), W(0x271e42a12624a583)},
+    0
+  },
+  {
+    {W(0xed4de4f88e89b258), W(0x957c980f297a9a37), W(0xe04b3d30f8a0580d),
+     W(0xa309199dca57b7bd), W(0xfc8e87cf3be44d56), W(0x4f5d5ab6d1b30e5c)},
+    {W(0xb213c6a030a9325b), W(0x0fd1c52df091bc01), W(0xfe51bbbf1090fede),
+     W(0x6d97cabc301fe259), W(0x3ee127895ecd3fe8), W(0x888b708b9404ca51)},
+    0
+  },
+  {
+    {W(0x194924b4ad0a415d), W(0x23e5c6b90e42d1f9), W(0x49066428b1213609),
+     W(0xdd2ec6d351fea1dc), W(0x20fe8c27a715ace6), W(0x1e8568cca4463246)},
+    {W(0x00c213bbfcce7e6a), W(0x98e97f1cd9236377), W(0xbc7a903c6484641d),
+     W(0x2413063a1378e68f), W(0xb960b5efeecd8ae4), W(0x530abb420614a6f9)},
+    0
+  },
+  {
+    {W(0xdc5293851d15bba7), W(0x8fd61e31148840d4), W(0xee21597e52ce08f6),
+     W(0x26de4c6581998af2), W(0xcb4aa43c9741eb42), W(0x8bf3dccc39c18b96)},
+    {W(0x66e1d5dad872984e), W(0x507e24057dd87c39), W(0x8545396f305ee4f0),
+     W(0xf9d19ea0c831254b), W(0xcee0842f5d5680b8), W(0xb257fb6c5a4434a4)},
+    0
+  },
+  {
+    {W(0x2e20654839d6e2af), W(0x0d20370a5d66455a), W(0x2b5609d5504c8129),
+     W(0xfb25e37c9710b70b), W(0x83f2fd2cd8296a52), W(0xb4a6714762f45dce)},
+    {W(0xa818b9bea15c6a6c), W(0x16a71ccc0b6c4c64), W(0x3e7ee43a2ec76a17),
+     W(0x473e6877caa84688), W(0xb9a19eb57c182141), W(0xf82bb94445ed204d)},
+    0
+  },
+  {
+    {W(0xe484fd9f8258030f), W(0x0f4fa5eff21af80a), W(0xc0dd449e7c1c3984),
+     W(0xf313389118eb5195), W(0x0336aab8777a16d2), W(0xa6661cc4c241720a)},
+    {W(0x678db970a7efacd0), W(0x228968656461e382), W(0x5d85a0e4a022c7a4),
+     W(0xb01f1e0434a02a6b), W(0x2657eedda5791ce3), W(0x239dcab2a277ac5b)},
+    0
+  },
+  {
+    {W(0x640dda7e5b2f56f0), W(0x5fe5fb500f5345b7), W(0xea78a271c6fb17f5),
+     W(0x0f6ab9dcebc620db), W(0x0aaba99cd594a4b8), W(0x47e07c825350be72)},
+    {W(0xd0cf3790f43ba9f0), W(0xad51391a2c3bbfe9), W(0x7b496c636a1c4b66),
+     W(0x6c70806571a54fed), W(0xf49e4d9354c76de5), W(0xc4b33e3b6ef897d6)},
+    0
+  },
+  {
+    {W(0x7f74672d0b3db49f), W(0x026275e9adc8418d), W(0x18866523fe7cc4ee),
+     W(0x3546317bbbf36aca), W(0x282313fa80caf049), W(0x08275c9c9a49d91c)},
+    {W(0xe41f92ecab71c2a8), W(0xb56746981dd95aae), W(0x82347685a8c4dc57),
+     W(0xf78b23d6a847fd1e), W(0x8194f070b692f868), W(0xfe0dee06a5f2ad03)},
+    0
+  },
+  {
+    {W(0xc52787142dc7641a), W(0xd23f2cc27c8503ef), W(0x2a73aafa9c5f66ce),
+     W(0x68d5c0d83e3cb044), W(0x0bc7c1dc4e885f0b), W(0xf143ce97ff89cfc7)},
+    {W(0x54429afd12ca88bf), W(0xca9ca6cb62edea72), W(0xc4cf4705bfc41fa9),
+     W(0xbcb50ee62f6be55e), W(0x0aecde91327ab728), W(0x71135378c2788fae)},
+    0
+  },
+  {
+    {W(0x61361c0622abee22), W(0xe82123bc2f42a470), W(0x2c97dda13c6ceff4),
+     W(0xc2eea21fadcb0453), W(0xdf2a4407c78ec9ff), W(0x54557c559625c735)},
+    {W(0xc693c9857c440c0a), W(0x918e7324e56622c1), W(0x8f990d2ba5f0900f),
+     W(0xa5b7d193c6aeeaef), W(0x9f053d95450456e3), W(0xdf783b1cad418ef1)},
+    0
+  },
+  {
+    {W(0x4c25ef8069addd4f), W(0x4499ac1e75de842e), W(0x28a467d8b8300365),
+     W(0xa3b2d42eec8fc88a), W(0xd8c066302bcbcee0), W(0x9f1882168f24c0bc)},
+    {W(0xbab83d560d38c6d0), W(0xab82e08ef742812e), W(0x6e2ae593553e0a4a),
+     W(0x77771da5a7fb202c), W(0x052cda7a176d7689), W(0x0bff5361522fdaa8)},
+    0
+  },
+  {
+    {W(0x08d2ce13be6c3221), W(0x0f53824c9c0624ea), W(0xad3ca7445da25412),
+     W(0xecb38a4193fea7cc), W(0x8ae838d8cba623c4), W(0xa75c8da541d85222)},
+    {W(0x9f48b828290807c8), W(0x4df75f0922f4ab6a), W(0x02511a3e7cab82a9),
+     W(0xcc052dc321da354e), W(0x7db6c1f303ca73e9), W(0xca1d4279cb99244e)},
+    0
+  },
+  {
+    {W(0x4ae25207d270686d), W(0x3222511ce435844b), W(0xf5605f7cfe7a5b7f),
+     W(0x2fba786683b492b4), W(0xbf3e941b04c96afc), W(0x0342f836141a7373)},
+    {W(0x2a1804a3829e62b0), W(0x1c5edab705bf0633), W(0x1caa5fb469b1dcf6),
+     W(0xf97313050ec4e6c6), W(0xc4c08f6d80993f17), W(0x36f8d2f4dffc55c5)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9a7a5b426ae54da1), W(0xcfcadaab7040b022), W(0x7539438e3d9f0e61),
+     W(0x013c6719e328c2e2), W(0x7f4a706ccccbf891), W(0xa335ab82735a2d28)},
+    {W(0x46694ef03d984124), W(0x0e0bdfabc166b337), W(0x9d54ed8b423d47e4),
+     W(0x8075a8cbf44c9180), W(0xd4f5b184abe9b384), W(0x424dd00b41abdc75)},
+    0
+  },
+  {
+    {W(0x5e2cb07fd7801edf), W(0xf9fa2c0b3adc065a), W(0xa296c53fd4de1f25),
+     W(0xd408060c838f7169), W(0x68e19d7b2e8a6ce7), W(0x2cc6e06c94b58671)},
+    {W(0x93d02a07c1cb6151), W(0xa10fb4cf35003126), W(0x6aa069f51aa3bc4e),
+     W(0x0e44fbf0dd09b142), W(0xe264f343832e5945), W(0x5dca2adc1fc166ac)},
+    0
+  },
+  {
+    {W(0x9ee4f522b0f6c604), W(0x5b8a689d52736e58), W(0x0d5f396db7edb07c),
+     W(0x09b3457c2e829063), W(0xf1d28188f83495da), W(0xba2511e6cce559b8)},
+    {W(0x17cbaf57d8f90669), W(0x3ba19a1c514eacf0), W(0x298208995145b8fd),
+     W(0x92cb5da81a33b1a7), W(0xca49fe334c5149e9), W(0x5c499b661772b4c0)},
+    0
+  },
+  {
+    {W(0x56ad7582a0eb176a), W(0x085b5a366e19aa00), W(0x85f2c6ffe2c8b036),
+     W(0x55c6d357fcd7336b), W(0xb1ecc56d22a46acd), W(0x8e0f976736277ac7)},
+    {W(0xa4ed11e901878921), W(0xd38355667f4fb650), W(0x5fdaba45266158aa),
+     W(0x6f0b27fd89e0dff0), W(0x32ef7ae2eb6b02d0), W(0x2f145871cc1b46e1)},
+    0
+  },
+  {
+    {W(0xc112733b9d4075dc), W(0x349281c187737549), W(0xbb7d8e0181009785),
+     W(0x7640a3e2bfe16c4f), W(0x4e34813ec1d9f810), W(0x61985fbc8d2605d7)},
+    {W(0x2a544cd8e3f66442), W(0x48879af56a7c9e94), W(0x9e6157bacec18a7e),
+     W(0xa555fc9511b882d6), W(0x4305a4dd04f86563), W(0xc58ed7631d0fd96e)},
+    0
+  },
+  {
+    {W(0xf04145e82d2696b3), W(0xaffb66acf4fb2928), W(0x9ffcba4e12aa299f),
+     W(0xcc5ec24991b3b517), W(0x9edcd4616f81c747), W(0x0a96090a77a883eb)},
+    {W(0x9b0bab58a2aa4bad), W(0x76359a5e8f9b84e7), W(0xfe8cd81e438a9d43),
+     W(0xf40e2b5e25ca8b3c), W(0x4254030067bc720c), W(0x883002a46b2446a3)},
+    0
+  },
+  {
+    {W(0x80e1cd16c496089a), W(0x7a59f4c06ec2000f), W(0x67a019d509ddce06),
+     W(0x52573e3e70c4b032), W(0x16d253e14d3ba57e), W(0xa43c6d42162504f7)},
+    {W(0xa237bbf952ff95e4), W(0x81187e659acb7273), W(0x4b13531a1f384dae),
+     W(0x39067f3398125165), W(0xe98fb141672dccc1), W(0x594baca0a75e27b5)},
+    0
+  },
+  {
+    {W(0xe65245cef6e9f82c), W(0x9e234dfff6da7b5a), W(0x5677c121bad2c806),
+     W(0xc52dec32060fcf24), W(0x78d070675d78ccca), W(0x630002ea1bc8b6fb)},
+    {W(0xc5cb86beeb2e99ae), W(0xf13981e78551d16f), W(0xfbb7cdf2c92a70d7),
+     W(0x5a9ff1f1f53cd2a1), W(0xfdbe6b7a984f1139), W(0x4403d046a470a9f1)},
+    0
+  },
+  {
+    {W(0x52c9b94decd84cac), W(0x34c2d0ad446dc59b), W(0x5563701d951878ce),
+     W(0x92e2fc1c843c9b1c), W(0x2309a5f13dfc7a98), W(0xdaf117dc0c57a156)},
+    {W(0x5739190d359fb843), W(0xd433e9bb4b88e3a8), W(0x4d6bb0e2c47a1f45),
+     W(0x511eaa33d7b59627), W(0x42ef82c5e389e532), W(0x641a0bdcd75f4c08)},
+    0
+  },
+  {
+    {W(0x19821469d678d1a3), W(0xf9fa42e60df2f58d), W(0x1177daf49f284ba0),
+     W(0x6dd2ad3d2a201daf), W(0x667b0e383d427075), W(0x39b76d1d4212b65a)},
+    {W(0xc6720ae0bf3612fc), W(0x72559d98775f8137), W(0x466e8e4476c48a09),
+     W(0xa05f8eb07fb5428a), W(0x7fa1fbce5e36b7d3), W(0x13bab84f8d1fdcd1)},
+    0
+  },
+  {
+    {W(0x6a35f6efdca1ce69), W(0x04216d3184de3658), W(0x3c3010df732f31b1),
+     W(0xe4421a872c1444b8), W(0x17c987a3c59c1ccb), W(0xd67159dba297df1b)},
+    {W(0xd13aa7a0bc96041d), W(0x686d7b77f44c3d8f), W(0x6c2e505f09b2b933),
+     W(0x8c04eb8256161b34), W(0x61785cb4b344bec6), W(0x60b4d06cbf8b0b45)},
+    0
+  },
+  {
+    {W(0xb5b16cd48d040c69), W(0xfdaba315f95a2dc4), W(0xc9fef34961ce4704),
+     W(0x5fe87a0ddbb53ed6), W(0x3f0ccc7973d70f93), W(0x4601d1bc46724a1a)},
+    {W(0x5c4a15ae24f08565), W(0x5eda1e8aaa577320), W(0xe31ebb35bb32d307),
+     W(0xcdc6f13bdc770a0e), W(0xbe3ae514c434c2f8), W(0x57c7fdf63a0ef0d1)},
+    0
+  },
+  {
+    {W(0x04c3d9e162ccecd4), W(0x6050bc1221cb59a1), W(0xb33847543cbb7e07),
+     W(0xef2201ac4cf1be50), W(0x99c3dda42d2ac886), W(0xad19cb0ab776eff3)},
+    {W(0xd326dd7f5a3d9036), W(0x9fe56af2e5b27667), W(0x3d849fc072cea4d1),
+     W(0x262a0cbcd6aa9e3c), W(0x8286211885401b09), W(0x8ec71d4b98fe8047)},
+    0
+  },
+  {
+    {W(0x8fc0cfa6e51d078a), W(0x431d9dd5744ca779), W(0x37a4f3120e96e887),
+     W(0x9c3624fa03ea5144), W(0x47d5ecda0b1127f4), W(0x018ad424807cf96d)},
+    {W(0x58ba530f586b16b9), W(0xec7271ed72f47883), W(0x8d2918da0281ac88),
+     W(0x6d0f14ef002330c9), W(0x1a90a01591dc35ca), W(0xeb8e71e9c81607dc)},
+    0
+  },
+  {
+    {W(0x8e5785629aa664e0), W(0xf3a1cfc329a97c9b), W(0x91ce3b404037bd09),
+     W(0x34c447b07f9f2482), W(0xebe360164010c2a6), W(0x7b8b9b3afdc0a861)},
+    {W(0x0e60c49199c4ff9f), W(0xf1cf53b1053e703b), W(0xabeae550dd974a16),
+     W(0x28ac5a34994ea50e), W(0x9384617d27329793), W(0xd04db83ddad0aec7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xeb06571c0f547eba), W(0xf292c38d6246c0dc), W(0xa185966726eed224),
+     W(0x8d9e56e46100e387), W(0x470506b9dc6298d1), W(0xb19e084cf3350ad0)},
+    {W(0x83eb62a812abd898), W(0x70f152cc2222342c), W(0xb089e880e1bd4a82),
+     W(0xd4d1e70fcaf3b3fc), W(0xd0b1ec6395ffd65c), W(0x79f27f3a9b184ebb)},
+    0
+  },
+  {
+    {W(0xd42777314c14ee0e), W(0xda8146d15e881c3f), W(0x6b0746b099f1867c),
+     W(0x1ec73d72602dd4cc), W(0x27fae51538081120), W(0x6a677bdc2f8b2f2d)},
+    {W(0xb924af64d60544e9), W(0x1439e183dcfc6b16), W(0x4e88e9ae068565ac),
+     W(0x8a3dbd25a9a4f146), W(0xdb4a3e483f93f734), W(0xb1971c058f1d33bc)},
+    0
+  },
+  {
+    {W(0xd1de964bd1066e5a), W(0x26ccad6b749909df), W(0xbc4b55af0de9eb07),
+     W(0x9f11b995a60289bf), W(0x3e59000c52392c61), W(0x2128c46a5ccff4fc)},
+    {W(0xb28b306bea1e0d5e), W(0x5f6ef5d5f5cfa47d), W(0x59b0542ce3f824fa),
+     W(0x70f097b22f52b71c), W(0x4483b72604c6d263), W(0x48720be734d93e5b)},
+    0
+  },
+  {
+    {W(0x721bb8363a7f43c3), W(0xab5b3108c12dca0f), W(0x9cc9a78934853870),
+     W(0x78b604a7af598c4f), W(0xd370375e476f27c8), W(0x9f0415b80b15cba5)},
+    {W(0x2bcfd9a4d400dc1f), W(0x2a6fe03b4bc62ddd), W(0xb05a6464a211b19f),
+     W(0xce059d419990b504), W(0x011c5f87d94951d3), W(0x13cec08900d9c7b0)},
+    0
+  },
+  {
+    {W(0x64e84c289cd2120b), W(0x76a90d13d4d80afd), W(0xb77ed9ed9fbf23cc),
+     W(0x155fd45f5b93118b), W(0x1e9f6d7d9c6255cf), W(0x1c8fbed1c4f64894)},
+    {W(0x4bc3a5036f9664b6), W(0xbbe65d0d7290c964), W(0xc7df5548d3c86241),
+     W(0x9dbfc084030f713c), W(0xf3623326ad785cbf), W(0xc725e2b1dd3ad637)},
+    0
+  },
+  {
+    {W(0xd8b8b37ae157f9e2), W(0x85df958eeddc772a), W(0x8ac7684bd17d58a8),
+     W(0x5f9557e2032fda40), W(0x7fe128e6ed4b4964), W(0xba12bfa4ed02e109)},
+    {W(0x0052d88f0d52d40a), W(0x4b93356fbe7fcbe1), W(0xbf4610798446a4f6),
+     W(0x3bc43917c99ad35f), W(0xda18234dda090607), W(0x56c35dab5164f8aa)},
+    0
+  },
+  {
+    {W(0x02c16c78fb789762), W(0x745f05a49c998f3c), W(0x3abebbc0795486ae),
+     W(0xad858cc70427332d), W(0x9a1d4b6aa35d3cab), W(0x95892612e208c19c)},
+    {W(0xfcc1427730b07419), W(0xb6e3abe329503f45), W(0x00277cb4e7706b5b),
+     W(0xc01ed42e479e2c75), W(0xff1759604d7ad688), W(0x420318c5c045f626)},
+    0
+  },
+  {
+    {W(0xf365419f9b280fd9), W(0x13e3b12746365672), W(0x8a91c165c41880aa),
+     W(0x3eb27a97f9712fbd), W(0xa6587aec76c55678), W(0x7c3a04b702cd79cf)},
+    {W(0xfc878f9cda712eb8), W(0x076e61170fca3e02), W(0x09a184d8caf6df5e),
+     W(0xd32bf232aabcde75), W(0xf601d0de03de597a), W(0x85d2b5fcc5da2858)},
+    0
+  },
+  {
+    {W(0x479c68847513afed), W(0xe4796218ab7b2adc), W(0x92e4bce45f1fbb6f),
+     W(0x0262892809986a7d), W(0xa0b4228956874df8), W(0x90487af084dcbe10)},
+    {W(0x1aaec8fa1d9bdf73), W(0x338c307784951a05), W(0xceff2cc47ead3595),
+     W(0x29eff3253f88ea3c), W(0x754846b5aa375301), W(0x264da57dbd3441f6)},
+    0
+  },
+  {
+    {W(0x1d1aa7f2699057fe), W(0x192eebe1c9a051a0), W(0x8d2429ec872d1a85),
+     W(0xdd6cf173c5aad325), W(0x3d7bd6b7dd8e469a), W(0xcada7e78caa49f52)},
+    {W(0x604253139a786aa4), W(0x1c41360b542fb966), W(0x91503d3d913a36a5),
+     W(0x3f2d453e30b990b5), W(0x69e8fc198fb689e5), W(0x61144c18a6c4ee6f)},
+    0
+  },
+  {
+    {W(0xa9351ed08a15fc65), W(0xe16d8725cd7e3c92), W(0x2de59cbb703d17b0),
+     W(0x3f7455a5b1b22f30), W(0x0fee7bbf06a9dce8), W(0x69588cecac730251)},
+    {W(0x0a304b8f7e24f70a), W(0xb5102d3ad118a6c1), W(0xfe54a0ad3db79714),
+     W(0x5bff141b6c80979b), W(0x64eb1d0499a95e6d), W(0x5bde566a91335f47)},
+    0
+  },
+  {
+    {W(0x3075a7636c888df8), W(0x6305c20472e21527), W(0x6b1d683e8798aad9),
+     W(0x0d09624680706369), W(0x91db5e7f7b854739), W(0x0e63cc6e02d72332)},
+    {W(0xe929e3ea1f7ff6cc), W(0xd53a18a145595925), W(0x867916cb93af8be1),
+     W(0x757e9f56c5c305ee), W(0x3f9071c75c83063c), W(0xccc0f92d7f6d5bb7)},
+    0
+  },
+  {
+    {W(0xc593c3a724786088), W(0xa4ccf0f49733006f), W(0x7faa92f70228ede8),
+     W(0xec10b68f6b2854fd), W(0x13e02ac6e8714ef4), W(0x647b0e699000b7e1)},
+    {W(0x80d354fbaabd7abe), W(0x7beb3db9baa36216), W(0xa241786f79c85e32),
+     W(0xbbc16d1b95caf318), W(0x9db580465c9ec3bc), W(0xe2a14c042087492b)},
+    0
+  },
+  {
+    {W(0xd0d88feb0c475a7b), W(0x8a73a233abf6fc18), W(0x46aa1a8ea950478c),
+     W(0xa562ab7453d6a36e), W(0xfd7743a00c9c6f2a), W(0x7cbbcf04a2d32a00)},
+    {W(0xba6bbfa2e55ca2dc), W(0x0121ae5328535112), W(0x6db672f6b665eb13),
+     W(0x66befec45389ba6c), W(0x8370e9cc714ce66a), W(0xcbbc69a3a744eb9d)},
+    0
+  },
+  {
+    {W(0x226cd629658d656e), W(0x942b2f3b1c5555b1), W(0xd38ab9db855b60c6),
+     W(0x3ad8866c3a23c160), W(0xaeea40153733e4b8), W(0x67b57be15ffe607a)},
+    {W(0x25622dd444532235), W(0xf3debfc7408785dd), W(0xb60fa79bb306863a),
+     W(0x632780bb713e63cf), W(0xf10f555a029e0875), W(0xd0e091af36398837)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb6029961ae899afa), W(0x8eedd66e681b6e1b), W(0x82db693b4df3e5b1),
+     W(0xb5131488a0c3e357), W(0xbfb01ff3ccb2f577), W(0x28ea947027a72cc3)},
+    {W(0x26170928e39e325e), W(0x42d4876b84f80188), W(0x0bec6a634c872d76),
+     W(0xa0a7cc90b14d9c9f), W(0x8a32d2c44f6c7778), W(0xe7cd346e3b889a4c)},
+    0
+  },
+  {
+    {W(0x860ef794609683ac), W(0xf0631ad39af1c522), W(0x322c83662ee7f522),
+     W(0x58ccd95f54122af0), W(0x7454880c2bbb2d80), W(0xea173d8286d8d577)},
+    {W(0xd5a3057cea1cc801), W(0xfd08d482bbb2a189), W(0x26aac99ec3c512f8),
+     W(0xc3eac036556d891e), W(0x866c3aa7bf9f6112), W(0x7c4c8fb9c144f7e9)},
+    0
+  },
+  {
+    {W(0xad0d24c7b617206b), W(0xb8be483f9dd13f59), W(0xa55134ff7655aa29),
+     W(0xa3d103857a5e217e), W(0xfbb9eeb53a21b295), W(0x1de71555c84a136d)},
+    {W(0x7579398e0b7487b3), W(0xc6ca9575a14dce87), W(0x99b32e1e46452257),
+     W(0x99d54955479d8f2c), W(0xc2a8a6a1930b80ef), W(0x58d9db81656c850b)},
+    0
+  },
+  {
+    {W(0x171898aa8f7782b6), W(0x8b7a706b499b3a81), W(0xbc0e835ffdb2c1ba),
+     W(0x4ee30281591f5aaf), W(0xfd71de3bcc272c6a), W(0x532800c46e93f68a)},
+    {W(0x35ee08048365c576), W(0x6c2bcc94cd4c0221), W(0x49f37ff5957b2ff6),
+     W(0x315d8e7e5ec029c0), W(0x33230602ef324c12), W(0xf5847f9b966b2578)},
+    0
+  },
+  {
+    {W(0x86283e21f9daa551), W(0x47fd23f81f696f1b), W(0x7d029b1bb9784a9a),
+     W(0x7c7798bea0c0acb5), W(0x41241c716d7c682b), W(0x11c6c1131d33c2b0)},
+    {W(0x5d469ca23565cf32), W(0xa949f022bad4bdbf), W(0x3d054cc2a13cf4cd),
+     W(0x13bd21669e3ce279), W(0x01bc70e68a4beafc), W(0xb39e351d8aba087e)},
+    0
+  },
+  {
+    {W(0x84aa863ea4ee10a1), W(0x24d805a687919ccd), W(0x553f3206b5c399b2),
+     W(0x775b92173cc109bd), W(0x25c01263fe384088), W(0xa3c4418bd5f743cf)},
+    {W(0x3d69705ddf91f1f0), W(0x547d46269ebddad1), W(0x0198ab1a2626cebd),
+     W(0xaf8320f285b1afe8), W(0xb9c0968ce17e6efd), W(0xfedc75c290215bb6)},
+    0
+  },
+  {
+    {W(0x3ee52d8f5fe63bd4), W(0x09f8405c7a7da77c), W(0x35ce95c61881a757),
+     W(0x0a8cf9d9c13e3707), W(0xe71258d548d2d3f6), W(0xcf4fd6910bbe7c0d)},
+    {W(0xbd6496e1fb9479f1), W(0x711c669aab8cb3a2), W(0xcbe8501358cfdfb4),
+     W(0x655c902b59275b4a), W(0x7e0ff05b20f722ba), W(0xcb00031d42b17aad)},
+    0
+  },
+  {
+    {W(0xda643272ed068028), W(0x86b52135a91fb87f), W(0x23865a7c35b43943),
+     W(0x6ac015884606bbf2), W(0x9660ab721559fb9a), W(0x1fcb09e73ce2f1a5)},
+    {W(0x62af29ab793d2f0c), W(0xad5aaef53aee7efc), W(0xee9f29b744c11037),
+     W(0xb2a19cf1d36c2571), W(0xb87d88e265b552b7), W(0xd8b4f172beb253d4)},
+    0
+  },
+  {
+    {W(0x9292138a3acde05f), W(0x7b23f51a50f9e7f0), W(0x6ad891a1af59b585),
+     W(0xbd394db79654da39), W(0xcb8c47315f7c6edb), W(0x367bbb5d6d2d6e5a)},
+    {W(0x8df2c759f51dd55e), W(0xce0924d8e6c3517d), W(0x49c46188097a8072),
+     W(0x47169f40980170a7), W(0x56198937b96df7eb), W(0x09572534531fb3b6)},
+    0
+  },
+  {
+    {W(0xbfe63081596eecd6), W(0x20eb6fb0a3a194fb), W(0x4497ec2b8751a73e),
+     W(0xf90e9e4cf88ba0e5), W(0xd5a9c5d55974eca2), W(0x9fc120ade4f3e171)},
+    {W(0x9ae058a633330640), W(0xbda3227855bc8aaa), W(0x7851cdbc1c9688a9),
+     W(0xf68d7d9e1d950edf), W(0xc89c645074e06425), W(0x62406f3b6116d386)},
+    0
+  },
+  {
+    {W(0x6f7e7259c6334c8c), W(0xe34cba49b4f2333b), W(0x157bf099211d08c5),
+     W(0x9e39c5442988a4da), W(0x796ed9f17a998311), W(0x3f4da896d8d349e6)},
+    {W(0x8ab75656fab28aca), W(0x3e215d5342d14b21), W(0x50008fd7bec23301),
+     W(0xd6ee4853446e2c56), W(0x203ff1c880da14bc), W(0x27a4bfbbc333ba74)},
+    0
+  },
+  {
+    {W(0xa0096d10b7f8286a), W(0x493e88563015be8d), W(0xa221d57c17f70125),
+     W(0x4f932f4fe425eb77), W(0xf0fa00df78ddfe95), W(0x68165f257866f01f)},
+    {W(0x01345af4b1693425), W(0x3fc8d3a6bad5603f), W(0x4269006f0bf46cf5),
+     W(0x96e3b6b77e340ce9), W(0x2a4bda69df7c68b7), W(0x9649d8b91b6574c2)},
+    0
+  },
+  {
+    {W(0xe745ee2c36cc8b1b), W(0xb40c94e6e328c813), W(0x4144aecd8bd107b9),
+     W(0xc35567890ea88fd2), W(0x017460e30492a810), W(0x0c63cd4410b8bea1)},
+    {W(0x9123e9a3c890f74c), W(0x940fe6590cea499c), W(0xbe306232c82e1bde),
+     W(0x40544f6bc041d7ec), W(0x46de1f3b477a7daf), W(0x336551f6951f1295)},
+    0
+  },
+  {
+    {W(0x26301455e5488ace), W(0xdf39099881a20dc7), W(0xac7d6049ee06c7f3),
+     W(0x547e8df33f248fe7), W(0x5fc4b74213743dce), W(0xa97721bc4c398630)},
+    {W(0x6b7877cc258aea47), W(0x1cedce562d5c28d6), W(0x7e930e419428d66e),
+     W(0x42c80757b97faf54), W(0x091fe5ab3812e632), W(0x2c29fd42e2e359bb)},
+    0
+  },
+  {
+    {W(0x7981826070ececc7), W(0x8cc0b6e071cfc0e1), W(0x998df6590276a6bc),
+     W(0xffb5bec11a43be05), W(0xb93b1543f2beb640), W(0x337703d456f3719b)},
+    {W(0xce74c17cd40a7375), W(0x6aef79cab1aece94), W(0xc5bdfb388876d218),
+     W(0xf71ce9cccea91445), W(0x471cdbd1ed6e5f5d), W(0xe0cc79cf10e56c08)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x31bdb48372876ae8), W(0xe3325d98961ed1bf), W(0x18c042469b6fc64d),
+     W(0x0dcc15fa15786b8c), W(0x81acdb068e63da4a), W(0xd3a4b643dada70fb)},
+    {W(0x46361afedea424eb), W(0xdc2d2cae89b92970), W(0xf389b61b615694e6),
+     W(0x7036def1872951d2), W(0x40fd3bdad93badc7), W(0x45ab6321380a68d3)},
+    0
+  },
+  {
+    {W(0xc5cf8997ce0b5b72), W(0x350adde19d7154ba), W(0x8139681e307b254a),
+     W(0xcc87fb5775cd94d7), W(0x90e7027478684954), W(0xc4fdf4c095ceb991)},
+    {W(0x91bbc0ab8762c84c), W(0x5e09e226ce09e8ad), W(0x1cb83d704b93d45f),
+     W(0xe2299024f541da1f), W(0x3eef7ce14b7ffd10), W(0x53ee63bbb3fc1b9a)},
+    0
+  },
+  {
+    {W(0x23c1f74481a2703a), W(0x1a5d075cb9859136), W(0xa4f82c9d5afd1bfd),
+     W(0xa3d1e9a4f89d76fe), W(0x964f705075702f80), W(0x182bf349f56c089d)},
+    {W(0xe205fa8fbe0da6e1), W(0x32905eb90a40f8f3), W(0x331a1004356d4395),
+     W(0x58b78901fdbbdfde), W(0xa52a15979ba00e71), W(0xe0092e1f55497a30)},
+    0
+  },
+  {
+    {W(0xe5004e8003682f59), W(0xccdb9cb7f642ac0f), W(0x405f50d1bd869f77),
+     W(0xecffa54de7ebea2c), W(0x3354dc22d87620ba), W(0x01bb2988b1c01ff4)},
+    {W(0xd9370076e16477fd), W(0x45303d2a2e71ba4b), W(0xc0de76273291e5c5),
+     W(0x5cfebd87f0a7ca55), W(0xde1162809e592a30), W(0xdd26e577a78ebce4)},
+    0
+  },
+  {
+    {W(0x5562a85670ee8f39), W(0x86b0c11764e52a9c), W(0xc19f317409c75b8c),
+     W(0x21c7cc3124923f80), W(0xe63fe47f8f5b291e), W(0x3d6d3c050dc08b05)},
+    {W(0x58ae455eee0c39a1), W(0x78bea4310ad97942), W(0x42c7c97f3ee3989c),
+     W(0xc1b03af5f38759ae), W(0x1a673c75bcf46899), W(0x4831b7d38d508c7d)},
+    0
+  },
+  {
+    {W(0x1e9b23b9ff1735a8), W(0xc3bf3d5b2b0e4b7b), W(0xd4cc00fe59b7721c),
+     W(0xd5c36f9c9e2f4ceb), W(0xdeca06bac90af70e), W(0x42676f12416ee799)},
+    {W(0x0d7afe1b6f748c6f), W(0x0b7a6de539c39d55), W(0x11e43d6ee6eaed18),
+     W(0x5baf8602496087e0), W(0xf833634fb1a3a66e), W(0x25098c8a79398677)},
+    0
+  },
+  {
+    {W(0x76512d1bc552e354), W(0x2b7eb6df273020fd), W(0xd1c73aa8025a5f25),
+     W(0x2aba19295cbd2a40), W(0xb53cadc3c88d61c6), W(0x7e66a95e098290f3)},
+    {W(0x72800ecbaf4c5073), W(0x81f2725e9dc63faf), W(0x14bf92a7282ba9d1),
+     W(0x90629672bd5f1bb2), W(0x362f68eba97c6c96), W(0xb1d3bb8b7ea9d601)},
+    0
+  },
+  {
+    {W(0xe141e763d4720770), W(0xb9739e70ddb3b450), W(0x46e6cde496131446),
+     W(0x0458a5d5cb6c2ef7), W(0xb7747634532f9fd8), W(0xf62d372116544457)},
+    {W(0xbfacb4ded3100854), W(0x70788a31b39d3f62), W(0x9b543220f22d92e4),
+     W(0xaa4590f655723258), W(0xc7b6730e01ddb8bc), W(0xae252cf869e1e7bd)},
+    0
+  },
+  {
+    {W(0x73878f7fa9c94429), W(0xb35c3bc8456ca6d8), W(0xd96f0b3cf721923a),
+     W(0x28d8f06ce6d44fa1), W(0x94efdcdcd5cd671a), W(0x0299ab933f97d481)},
+    {W(0xb7ced6ea2fd1d324), W(0xbd6832087e932ec2), W(0x24ed31fbcb755a6e),
+     W(0xa636098ee48781d2), W(0x8687c63cf0a4f297), W(0xbb52344007478526)},
+    0
+  },
+  {
+    {W(0xc618cf0ddd4b8d8d), W(0x471cda8640dcfbfb), W(0xba0dd7ac08882ce6),
+     W(0x58e5d2f56cd336e7), W(0xcdda8301af096540), W(0xf6d268463cf31600)},
+    {W(0x6150cd982197efd5), W(0x4440fbfa55fb0877), W(0xca31871c90757f1d),
+     W(0xc4a1faacbdd756c8), W(0xc9d4ac1bcbb8421e), W(0x3c0c2914b17c43be)},
+    0
+  },
+  {
+    {W(0x2e5f741934124b56), W(0x1f223ae14b3f02ca), W(0x6345b427e8336c7e),
+     W(0x92123e16f5d0e3d0), W(0xdaf0d14d45e79f3a), W(0x6aca67656f3bd0c6)},
+    {W(0xf6169fab403813f4), W(0x31dc39c0334a4c59), W(0x74c46753d589866d),
+     W(0x5741511d984c6a5d), W(0xf263128797fed2d3), W(0x5687ca1b11614886)},
+    0
+  },
+  {
+    {W(0x46fdb65caa6fe9ea), W(0xe0d48e5e05494cd9), W(0x5adef5704afbf837),
+     W(0xc96ba4b91c9e2cad), W(0x1e8158f7054a158c), W(0x47be73209e38b88d)},
+    {W(0x9b99971e6d2993ec), W(0xac9b0bfadf980ecc), W(0x9da09642d96ca391),
+     W(0xd67105369bf4305c), W(0x40cc1adfa0dfafae), W(0xe27e32f8a209699b)},
+    0
+  },
+  {
+    {W(0x076d902a33836d4b), W(0xec6c5c4324afb557), W(0xa0fe2d1ca0516a0f),
+     W(0x6fb8d73700d22ecc), W(0xf1de9077daf1d7b3), W(0xe4695f77d4c0c1eb)},
+    {W(0x5f0fd8a8b4375573), W(0x762383595e50944f), W(0x65ea2f28635cd76f),
+     W(0x0854776925fde7b0), W(0xb2345a2e51944304), W(0x86efa2f7a16c980d)},
+    0
+  },
+  {
+    {W(0xeaaddeb836e87d82), W(0xc12587a71ffd7210), W(0xf93d2f5c731f6838),
+     W(0xb96594e8f7097a65), W(0x08d6717ab016e8d3), W(0x9c378de81984d825)},
+    {W(0x627d41e7cb2a0c26), W(0x1f447501c697ceb1), W(0x8dc40831c760550b),
+     W(0x70ad48707fac97b0), W(0x5ac7f22e7021c170), W(0xa6f730e4929d5931)},
+    0
+  },
+  {
+    {W(0x4ccbe2d0bf4d1d63), W(0x32e33401397366d5), W(0xc83afdde71bda2ce),
+     W(0x8dace2ac478ed9e6), W(0x3ac6a559763fdd9e), W(0x0ffdb04cb398558f)},
+    {W(0x6c1b99b2afb9d6b8), W(0x572ba39c27f815dd), W(0x9de73ee70dbcf842),
+     W(0x2a3ed58929267b88), W(0xd46a7fd315ebbbb3), W(0xd1d01863e29400c7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x7d27d71fd186cb09), W(0x67cb7f4e3bc213c7), W(0x418cafeb6075b2cf),
+     W(0xc0d691e6d93a06f7), W(0xc16a95259dd001b9), W(0xa0583230026f17b9)},
+    {W(0x4c1041b07845900b), W(0x2874079147a22aae), W(0x8d08efd62c1758e9),
+     W(0x9cc6f207e6c3229a), W(0xec69e902082d8924), W(0x9cfa1deaf331dfe7)},
+    0
+  },
+  {
+    {W(0x8ec4335fabe7c60e), W(0x01f198c10a6a9fb5), W(0x3ff96de001141ab6),
+     W(0xb21acc2c2eca98a1), W(0x6154849010fdf648), W(0x2c01a99cd1403e8b)},
+    {W(0xf1a35f306fa509d7), W(0xf7715fe3e3f08e9f), W(0x89c26c077fc9a752),
+     W(0x8d2535fe420d48a0), W(0x80ec5ddd52fe2e73), W(0x041b8df071704f39)},
+    0
+  },
+  {
+    {W(0x20aa15d97ab838e6), W(0x6cefdd5a0c827ed1), W(0xe2f205caef579e8f),
+     W(0xad27e38b325981bf), W(0x087b8284c3438be8), W(0x2095dfcf422360d9)},
+    {W(0x87cdf5ad76d096bf), W(0xf1b97ce1e022adc3), W(0xa71240c189104665),
+     W(0xeb5a175c9c1578e8), W(0xbd66910ad150ffa2), W(0xac277af811459a28)},
+    0
+  },
+  {
+    {W(0x498808edc65fafce), W(0x3676a7cc4e806bc3), W(0x796e25f176c6b964),
+     W(0x1aced64bac474261), W(0xa62470fc29a460c1), W(0x77501dce5e751e48)},
+    {W(0xcc00053b6d9e3641), W(0x2b5bc4ae9a3f5a0b), W(0xddaccc2e3f9ca178),
+     W(0xad33f34a0b80d1b0), W(0x6a76df9364642225), W(0xc145f36f778e761b)},
+    0
+  },
+  {
+    {W(0xd30302352679072f), W(0x73dfdc0f95dad4c8), W(0x53649b575c4630f1),
+     W(0x60197fc08d098d74), W(0x9c295d54647f5cbc), W(0xfa5f1bc6c0813efc)},
+    {W(0xf6e08007d2e49417), W(0x4f7d4b3dab579569), W(0x7af3e08e11d9b388),
+     W(0x073ec38a5db61c65), W(0x9b480cb89db4dc4d), W(0x9be2ce7e372fa82a)},
+    0
+  },
+  {
+    {W(0xdffb03aec10b43ae), W(0x39b1266e9433a54b), W(0x4c262521b19fe0db),
+     W(0x0ec1e54f3d5c7fee), W(0x2856510b05e68e1e), W(0x49382c1edc80b8a6)},
+    {W(0x80a509312471bdd5), W(0xe8cde18581974aa9), W(0xca6112ee28235c52),
+     W(0xd28a0eb8301f9653), W(0x22b11e26e11fcdf8), W(0x97e6fc5de4d735f3)},
+    0
+  },
+  {
+    {W(0x46a2a08be26d822e), W(0x63537bc689d6d6de), W(0x28c556a2b3df9fbc),
+     W(0x81d3161eb121d512), W(0x4e27ce0b123bc86c), W(0x1ebadb85bfb240d1)},
+    {W(0x86edb71a1156314d), W(0xf8ac56fd113961bd), W(0x2f6bc6d8067f586f),
+     W(0xf558b8833fe8e532), W(0xe9433e2321a7997f), W(0xb86f039c87e53b9b)},
+    0
+  },
+  {
+    {W(0x9c66a32becc5f6da), W(0xe4ff40431719ba2c), W(0x8c6cfab721e716ef),
+     W(0x32c8fccb96ed74e6), W(0x475890dd0b110c83), W(0xdfada95f5cb4eefe)},
+    {W(0x9d7b89a693240fe1), W(0x6afdb2d0210b776f), W(0xc3f0b55bca7a7d52),
+     W(0xa6e56a0655d04585), W(0x818e221c4257acc5), W(0x05207b63fcb8d39e)},
+    0
+  },
+  {
+    {W(0x15ff8b9194734836), W(0x059dc0ae503ba821), W(0x9ed24c97b4b67335),
+     W(0x50eb0e845147fdf1), W(0xaa61c10296870563), W(0x93b1239cfde1feb9)},
+    {W(0xbf69643c002a2551), W(0x56273fa22c49813e), W(0xda1f586360b9409d),
+     W(0x6c87e398fea2f06e), W(0xc7b0510c23b03455), W(0x771ad3b5f0357ebe)},
+    0
+  },
+  {
+    {W(0x00fc2cfeac993097), W(0x4d3532b176b4508c), W(0x0887cb17a24c9add),
+     W(0x2698a3e01a9972dd), W(0xa6f0258b26352346), W(0xf67915993132792c)},
+    {W(0x2c3d2ebb92f39495), W(0xf84058943f9e744c), W(0xba22030154833968),
+     W(0xa0c5454eb7936d27), W(0xdd9078e1b0ca30ec), W(0xfa5e78ae5a80ec29)},
+    0
+  },
+  {
+    {W(0x4b0419e196fc4c42), W(0xcb8ba18d80fc1d65), W(0xace4ca17ed16c957),
+     W(0x98c4e443643ee45f), W(0xca5dcd5a8fbcbd0b), W(0xefd85948ed499067)},
+    {W(0xc55ef933c6add97c), W(0x98c789a96f7bbddc), W(0xa4061e15d7e8f029),
+     W(0xfbac20d42ad7071c), W(0xb6ac497cb513dcdc), W(0x6845909ac345c9cc)},
+    0
+  },
+  {
+    {W(0xc948333be68b9c0c), W(0x96e30042265cb56b), W(0x957516bd3c12bd22),
+     W(0x0d3284730033e495), W(0x23ff9704c9e2117d), W(0x81693f98e3d28a72)},
+    {W(0x7a0ba6c9f8066b56), W(0x0e2e2242332bdbe8), W(0x885d3c00e9f4ce83),
+     W(0x3145e5ec8ae96eae), W(0x8d4b26d491e3d14c), W(0x17b5782aa9ad6fe2)},
+    0
+  },
+  {
+    {W(0x1d579732db1bac08), W(0x7ea68523d364c724), W(0xe1eeef5970165ccd),
+     W(0xb8592235c6009040), W(0x2d1f1d3c5424487f), W(0xc8ff75946be2c093)},
+    {W(0x92b9f7c0f85690e3), W(0x77d14b075c2f3e29), W(0x5b6ec994840d8e05),
+     W(0x15d0b4bbeb560729), W(0x76320c854dfd7496), W(0xa18aad857cdcae8e)},
+    0
+  },
+  {
+    {W(0x39062094cabd9b94), W(0x20b3910bc68dc31e), W(0x7d78a0430b708450),
+     W(0xe113da29522bd0d5), W(0xc46fa10af7f27be8), W(0x8258b2ce295393a0)},
+    {W(0xf69dc62228d958d8), W(0x97b796c0991261e9), W(0xaedea55e36482f74),
+     W(0x6e4f2e3ceec962cd), W(0x782f495a2a06b626), W(0x41e32a4dfe23dd4b)},
+    0
+  },
+  {
+    {W(0x7686290bc8f0043e), W(0x3245d9b0001c690b), W(0xe713b344aa0641e1),
+     W(0x9bcc2d1f3b77b9c6), W(0x414cdd960c7eedbb), W(0xab0c06436e2e076b)},
+    {W(0xd8c255611b462815), W(0x7776f52a36b2b315), W(0x1e05bcc891566efc),
+     W(0xda8159fa353a78de), W(0x4948fc25c16eb16e), W(0xef2b18052b927e40)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0a74da82d8ada6cc), W(0xc6b98a3cbea55457), W(0x896c26bb57c2f5ac),
+     W(0x981e2f72845d45e4), W(0xca152b877e9a7d36), W(0x49666d457b582e8f)},
+    {W(0xea3b9bda49fc20b9), W(0x5bcbc84a7c71f153), W(0xd346fc5d5748a654),
+     W(0x7ac2f217622665ee), W(0xbb5efe7fb6f16e27), W(0xb1810a70644c9dc8)},
+    0
+  },
+  {
+    {W(0x98d089819bc5917b), W(0x9f90885d187fac5d), W(0x651b18287cfc13db),
+     W(0x2d606e4c8655a658), W(0xba64d3c563c91b71), W(0x36c7d7d8b82a5090)},
+    {W(0x2d1dff02cab1d598), W(0xa95788d7be78f90d), W(0x1ac2ee6b0ea1fe01),
+     W(0xc100b60cd5c1273c), W(0x4496084ceae603e7), W(0x7fcaaf5f77c2fdfb)},
+    0
+  },
+  {
+    {W(0xa93fec0861b06e05), W(0x0bebc26b7dfe6802), W(0xc00b45a5cce5662f),
+     W(0x2e8a0a7f83a9a4a9), W(0x6e0cdebbc0bbeb63), W(0xc56a20fe63ccd80f)},
+    {W(0xfc10fa08b51f1f89), W(0x4848392020ad9243), W(0xfda69cc66bf53af8),
+     W(0x474b7440f10bb6c9), W(0xcda9db3b1e7625e1), W(0xe2f62c1e1dc7f3cb)},
+    0
+  },
+  {
+    {W(0xe8e3225a6abdd842), W(0x8c85f18f3b367b02), W(0xf147a4219f42edb9),
+     W(0x6d4bc00d0d411d4d), W(0xa1a13a2770014bb4), W(0xb896d97bfa10166f)},
+    {W(0xb2a1dfa70c302c6d), W(0x0a24bd5d808a63a4), W(0x8409a3a2f88c7359),
+     W(0x071f3838347726a0), W(0xd18a551c27507bb9), W(0xe0c4cc34b359b167)},
+    0
+  },
+  {
+    {W(0xeaaaf4602a44610f), W(0x94d330b10392ac47), W(0x989b9b673fe123f1),
+     W(0xe2ca56ddd8fd0129), W(0x77d6d0cd624982a4), W(0x55d4b2c371e1fec7)},
+    {W(0x3e9a04a0360e013c), W(0x1d227ea9c9cde585), W(0xac2b08e24fed8f86),
+     W(0xa1d1357ce199e8db), W(0x7cf06ec8e99cc964), W(0xd9bc3a7fd85ec63b)},
+    0
+  },
+  {
+    {W(0x7d111c67017c633c), W(0xadd9e9bd7d128a9c), W(0x4cd8730c6db857e9),
+     W(0x3c9c03e9f4b46d12), W(0xd42f0242a78472dc), W(0x3fc0bcb2260841bb)},
+    {W(0x6332b11a8783f828), W(0x65229d2af7be37dd), W(0x402f28eee7e8944a),
+     W(0x3d1bab505ab28372), W(0x6944e82cad5e1ff3), W(0x65a94c0de8c75729)},
+    0
+  },
+  {
+    {W(0xa151dcbc2f7f3633), W(0x4305312a98969226), W(0x947afc00604d46e1),
+     W(0xc3c9d57572f3e28c), W(0xce4c1cbd14b1cd1d), W(0x8fe9a81df80dea45)},
+    {W(0x50920f3a9685f603), W(0x51d380f00b80d89e), W(0x19978ba13f798e32),
+     W(0x1294aaa6c5edde47), W(0x280002c2be714a1e), W(0xd998669ef212603c)},
+    0
+  },
+  {
+    {W(0xa44f6ef880e9d9f3), W(0xaa7621e91d14d618), W(0xcb0e4ed80eaf6671),
+     W(0x2bf485f8181514a2), W(0x74670e180a2927ea), W(0xe1b5461612c14645)},
+    {W(0x4068c0742a67ed61), W(0xd10c7a57739063ca), W(0x391b651d698b2816),
+     W(0xf310d1696da14fa8), W(0xa089be6bd8a578b1), W(0xa314b3a844389ad7)},
+    0
+  },
+  {
+    {W(0x688ce85068fd73ec), W(0x2cfb41040db1f500), W(0x5d943b8d5b9bbc41),
+     W(0x861867f5403f3973), W(0xc331110a2c766363), W(0xb28a6bc153aaceee)},
+    {W(0x2ab6e7aaadbee7a4), W(0x316ca45c2f2b9569), W(0xcac646e561d2428a),
+     W(0x6fd28dadc7cb6291), W(0x2e28f68741e20ff4), W(0x8cfe90eebd189d34)},
+    0
+  },
+  {
+    {W(0x09b8ed53339da6ad), W(0xe40727af26f54b8e), W(0xc4a105979990fdb2),
+     W(0xb808656b5108236a), W(0xb4411363aa4bd584), W(0x19e90149288a0328)},
+    {W(0x5795d8a8fb0592f8), W(0x313c68833213c929), W(0x62eecb5b48f79d47),
+     W(0x3afcfdbab29ca224), W(0x0072847d40075b08), W(0x078eef3dd1fe0c8f)},
+    0
+  },
+  {
+    {W(0x719b51f20ca20aae), W(0x01ad630824b47b92), W(0xd32460c2d3c807de),
+     W(0x8497786b0a1785f5), W(0x8bd521355d714ee5), W(0xc267724ed00f741e)},
+    {W(0xe5578dca9c266820), W(0x97ff60085b62d484), W(0x84c70e92e3bd1869),
+     W(0x412759e34dfa679f), W(0x6bccc33fce497e18), W(0xfb92405669056198)},
+    0
+  },
+  {
+    {W(0x664ff05368ed0760), W(0xc3cdc99138fae9fe), W(0x3fe057aaf1f30a86),
+     W(0xbae990222d08c72a), W(0x4f5faf3f6f09e13f), W(0x44461a4413d26b29)},
+    {W(0xc2504c1bf95418ed), W(0x12766ea7db3ff26c), W(0x2f956e9507a22399),
+     W(0x2716e70f5a00cdd3), W(0x80c020140e9fba99), W(0xbe587ac30519875d)},
+    0
+  },
+  {
+    {W(0x5e4bb6b83b23d2a1), W(0x819a7c7705c9888c), W(0x59e4c48ad0fec7f7),
+     W(0x4b212b21d6bb71ab), W(0x370cb90bcbf213f2), W(0xf1ea07e0817549b0)},
+    {W(0x20e3115351a37b92), W(0x30f9e70158d444c0), W(0x7ac3a37b0b791ab7),
+     W(0xe456fd475265e4cf), W(0x3e3f27ca29580ae8), W(0x5d68a40daa2a1654)},
+    0
+  },
+  {
+    {W(0x14203d8720cbb917), W(0x284e0c9db2a7424e), W(0x99eb2911cefe7139),
+     W(0xa709c50f42925411), W(0xa5a7543e5c79a13a), W(0xe262025c6f45f023)},
+    {W(0x3966fd18828b9f40), W(0xc660846913693115), W(0xd7dfbcf644373027),
+     W(0x8e73fe6bbade7645), W(0x88267c7b1de0dbd8), W(0x1231ac99ce4e8c9e)},
+    0
+  },
+  {
+    {W(0xfd928bd90ba99806), W(0x799ac97d1a864172), W(0x5436a8cd129682b9),
+     W(0x4bcacda54e96fecb), W(0x453af995c5db1451), W(0x8fd382e07073b98f)},
+    {W(0x17165b8a644a7bbd), W(0xd17d2d80b6118620), W(0x2a4bf1b2c8cd1bcf),
+     W(0xdc7aad959ccc119a), W(0x6d34084c3bcdbead), W(0xcbc5c5557e0663c8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xba86aec170128295), W(0x83a09b65c12f35ce), W(0x8978ff0789df2f80),
+     W(0x85750cfd97a773d5), W(0x806bb730fc3f35f6), W(0x04503422fed868c9)},
+    {W(0xdc0fcde086ffdbae), W(0x8f4297e11860f43b), W(0xfefb7d028d3ad6cd),
+     W(0x5c652b5997293550), W(0x32e12942ed5cfbba), W(0x06192aaf98800d22)},
+    0
+  },
+  {
+    {W(0x162cdf342efffd95), W(0x92111fdad59086e8), W(0x4478d114454eb977),
+     W(0x8ce403d8dea38a67), W(0xd459633b7435728a), W(0x3a7be4e3a63b0504)},
+    {W(0x0c74066b335dba3e), W(0x4e8fb1d7c6ea6ee5), W(0x3398b588a99690ed),
+     W(0x4949517c3ad77562), W(0xf9824f09cbbb60ee), W(0x9fdcafdf85660bec)},
+    0
+  },
+  {
+    {W(0x2daddb11a406d4d7), W(0xb02b5da5a2a33d81), W(0xb73ce82721a6aa89),
+     W(0x10919587467506de), W(0x0927724c428d8daa), W(0x0ede991f7c17adfd)},
+    {W(0x8518dab1bf7ddb3d), W(0x04b091c42a54e1b8), W(0x5943c37f89e7a398),
+     W(0x8e63f5e8e273f6f3), W(0xc6d0352b83143d22), W(0x30e43182ebd1628e)},
+    0
+  },
+  {
+    {W(0x4074ee27978029bb), W(0xa9394bdabae0d0c0), W(0xaa01d53972cecb4b),
+     W(0x4b0cf1279a7dd9c4), W(0x3e3e3f165bc787cf), W(0xdf48f7e1942de53f)},
+    {W(0x0cc69719567b9d0e), W(0x631e33158d0d2750), W(0x9fedc1e292314a09),
+     W(0x7547d22614a1adcb), W(0x405561a48662b86a), W(0x149fa2b1f5480b7d)},
+    0
+  },
+  {
+    {W(0xc4e59f302f7c4436), W(0x9d757708e3d65feb), W(0xfbc80d824464bbbb),
+     W(0x3bacfa2016f9540d), W(0x1954efb613595b5d), W(0x3af05d977a5cd80d)},
+    {W(0x926a54d05221ad91), W(0xa55b7fab74a320f6), W(0x0677167ccb5c8d4b),
+     W(0xc994d22ff9a21ce2), W(0x3a25ff6b422df8cd), W(0xd9d7e6b6f68e9908)},
+    0
+  },
+  {
+    {W(0xe544b89abf4a5b9b), W(0x59e6df7e0d4e8b88), W(0xa6a90da69a73104b),
+     W(0x5c2602167274b105), W(0x8f9705cf60c61bb6), W(0x079052653c4d1506)},
+    {W(0xab5a27ad4b2c9b2d), W(0xbe6ded26a82e5f5a), W(0xe68f36d15a36afad),
+     W(0x79004b195c455916), W(0x16ffe6249bb5d1fa), W(0x7f9dc5c649338489)},
+    0
+  },
+  {
+    {W(0x941be86ea175105c), W(0x105c5901c3c6aeb2), W(0x658f95b469d75ec8),
+     W(0x3fa79d53db0d4374), W(0x85da635c6afc7705), W(0x914a9a598e7e8128)},
+    {W(0x558cfa8fb104ae34), W(0xcd0a92444de51d53), W(0x104f98b96a32e883),
+     W(0x68237efe3c45ce1a), W(0x5c820dc22d85de02), W(0xc3e56baf7459ede3)},
+    0
+  },
+  {
+    {W(0x923d0b44bda4aaa7), W(0xced14ce4fee29f7b), W(0x1656be009cf5b87d),
+     W(0x13a37d0d1d61103d), W(0x1d705880fb652393), W(0x870a31bbed712ed8)},
+    {W(0x15ad02e6ad7c21e3), W(0xf004e447c36c2831), W(0x56aa376cba2b3ffd),
+     W(0xc3be2b2f9745443c), W(0x47c8a870eb903660), W(0x976c303e6c6c192d)},
+    0
+  },
+  {
+    {W(0x397dfb3d2bd2f544), W(0x2f09d455ab811850), W(0x94309688c9469b47),
+     W(0x9b7804fb30070b8f), W(0x81276994ad8780e0), W(0xaa75d9833a44fc44)},
+    {W(0x7cf182a9d0b023f7), W(0xc6de85c9b703b1ba), W(0x8ccc693cdff6be4f),
+     W(0xe6cdce5d4c9caa7f), W(0x584b57ae29e822ce), W(0x045e598ddc6d4aab)},
+    0
+  },
+  {
+    {W(0xa2a9b47331bda218), W(0x067701e5759d8e4a), W(0x350b9b0db6ab50b1),
+     W(0xd30e77b02bfc3929), W(0x99fb931c05b1af7c), W(0x59bd662b9f96aa9f)},
+    {W(0x8b3a8510ca245252), W(0xc7b2679108d6310a), W(0x6794f0ce99691562),
+     W(0x846032bc65fbdb96), W(0x21c17cf34ba29e9a), W(0x2d8fee5adf890da7)},
+    0
+  },
+  {
+    {W(0xb170b049454c1e0d), W(0xe50c76010d74bc0e), W(0xff2d46a15abf8018),
+     W(0x9f9d9dd30fcf1f46), W(0xf236512d8ed1e9c0), W(0x0102c89ddc49938b)},
+    {W(0x8f7f63b971d181dd), W(0xffb4a8300e16a589), W(0x2f0cb154bb8646fd),
+     W(0x0171f9e470169a64), W(0xc7b1eb1165bf3da0), W(0xb6fc4a3d000797b0)},
+    0
+  },
+  {
+    {W(0xb511640116f6e877), W(0xb55ed17656d5fd4a), W(0xc7d8f9e513ca0d39),
+     W(0x28cd9a84c5cf42a2), W(0x303db2df47f75576), W(0x383e32e551820ed3)},
+    {W(0x328393ffd7557c05), W(0x2ed1c7736e9e9ab3), W(0x52a343d239531ce4),
+     W(0xa992b668143d54dd), W(0xcceef739aa192e41), W(0x42ae5cbcfe845a85)},
+    0
+  },
+  {
+    {W(0x4fb45e5b093c02cc), W(0x2f3a7ec4b1d962b8), W(0x3d873da3d81bec5d),
+     W(0xc0c641f95d3716d8), W(0x909902c6e8c932d4), W(0x27ae72d76bd37252)},
+    {W(0x7953d5bc2ebaa511), W(0xbfb2c0134453d335), W(0xc0f6641fe11050cf),
+     W(0xe69264d3497f2221), W(0xbe3a5124e6563e82), W(0x16cc899d5fd9d668)},
+    0
+  },
+  {
+    {W(0xc2aacbee626367f5), W(0x17de15aac68a357f), W(0xff9b10437ee4b32c),
+     W(0x33a3691bbafe9416), W(0x085ca2b39439ed4f), W(0x07cc289f262dd8ce)},
+    {W(0xb084ae7ea6a6f936), W(0x97c1778f1e3b1e41), W(0x19c4a31d5122ff07),
+     W(0x9e39c73d5ae7dcda), W(0xe7252b9e31127224), W(0xe872c38fd936fe8c)},
+    0
+  },
+  {
+    {W(0x41ddc2e89bca4378), W(0xe0c378efefba2a00), W(0x73a018d72df7d4a4),
+     W(0x07c79114884f3a0d), W(0xa7d72b90f88bc8e4), W(0xeb07f2129f2e152d)},
+    {W(0x8358bb8639f73837), W(0x8bc7f49b9a95f024), W(0xc16cebb69a0ec255),
+     W(0x4088ff45188d19a9), W(0x6da801db29700c93), W(0x527dc6660e9be4b7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x148bd39cf4fb80d4), W(0x469b208cfff04e65), W(0xf397fbe2ce548415),
+     W(0x441e5c2c87fdde9f), W(0x6366b49ffee9c179), W(0x38d02bd32938dc71)},
+    {W(0x26d450fac49c5444), W(0x4569f95d2b23d3d7), W(0x5f68bf4d298fd876),
+     W(0xe86df047544768b6), W(0x40b69a32f8491267), W(0xcbf3adf9f917c71a)},
+    0
+  },
+  {
+    {W(0xa66c703529aa3150), W(0xd038a5ab479e61fc), W(0xdee33e96b5ab5410),
+     W(0xd068929c7c57d123), W(0x0839a208f1d6ad37), W(0x8f523dab123f8178)},
+    {W(0xb3e5e524a67d3840), W(0x88bda75e52eb59df), W(0x513a0ab7389f2dd3),
+     W(0x3197a145890bba6f), W(0x61add75b6f66bf09), W(0x5c9dfc154eef1722)},
+    0
+  },
+  {
+    {W(0x810b6ab36df1199d), W(0xc229308bb4f293b7), W(0x3cf838dd89897750),
+     W(0x3e391e4e7a336c9a), W(0x70148337176f89c0), W(0x54b15bacbc4f1e22)},
+    {W(0x32b104f92c0f2885), W(0x2c39cefa67034f2a), W(0xb8310437bf178ac1),
+     W(0x722299f5c99370d5), W(0x0a493cf0332b93a8), W(0x00e0ab41a420f719)},
+    0
+  },
+  {
+    {W(0x21feb7fc21c34c2b), W(0xab6a553addb0140e), W(0x03a6557624b04e6f),
+     W(0x2531f186342cb0ad), W(0x088c4d54a24f6426), W(0x9a0ee15c06a873ea)},
+    {W(0xdbe0253fd33bc748), W(0xdad3339f5db8ac9e), W(0xeaaf368173e65901),
+     W(0x71f1fab2ccbfa504), W(0xb7b845224b0e163e), W(0xe0fca8373c779f3b)},
+    0
+  },
+  {
+    {W(0xcd7b3c42bcbe922d), W(0x2fe02b3b95dd1a5c), W(0xeb66bcbd24ef5c38),
+     W(0x7edcc21ce579c309), W(0x7b19d49116f6c900), W(0x36019ecdb6317c2c)},
+    {W(0x554ba55391d9001c), W(0xa5e30b9814f31e44), W(0x3d1fe33bffda4032),
+     W(0x5dfec4782306675c), W(0xbe59305e000c91e7), W(0x3c4e52a325a6b879)},
+    0
+  },
+  {
+    {W(0xa35802f5d62cd9f9), W(0x0ca9c15d4148436e), W(0x261a991d472b9d21),
+     W(0xd81a1ed6a2f8e875), W(0x942f213a699b6d63), W(0x041a12fc0ae57758)},
+    {W(0x61191c82bd70aabb), W(0x3776eb8bee4c23b3), W(0xabe23e8652511222),
+     W(0x66dd967d30dabb91), W(0x77650c597ed27424), W(0x08ea2ebdab25a050)},
+    0
+  },
+  {
+    {W(0xa624ab3759a8bc95), W(0x4b7e3fa61c971228), W(0xe8229c4273aa694b),
+     W(0x0cc31029779288ab), W(0xf8eff30f57575e0e), W(0xee5e01947d52803e)},
+    {W(0x32d87e558a78f632), W(0x48a06031e454904e), W(0xaa2cb8dd16c6e626),
+     W(0xadd098ac2c140452), W(0xd25f285d2d3031b1), W(0xfb5fbbe175b59543)},
+    0
+  },
+  {
+    {W(0x520b0bb905c755e4), W(0xa2c2c59bf89f0048), W(0x85c1c73a73c23975),
+     W(0x6e4dec49783aabba), W(0x69f0c69bb0463155), W(0x61a42b949c97b17b)},
+    {W(0x55af24a945d331a3), W(0x4b0e63f8f5fe81fd), W(0x4034283d708671c4),
+     W(0x200ddab35fd9001a), W(0xe45f28e4342eaf3b), W(0x3e8375b41ba936c4)},
+    0
+  },
+  {
+    {W(0x7db497e17da2f887), W(0x0995648b683f3507), W(0x50e3ff74f5935bd2),
+     W(0xdec083e2708c88dc), W(0xbcc3bc3125129bcc), W(0x7a3fd7a80a407b41)},
+    {W(0x46ab826c25e0ab93), W(0x28e891ec54944cfc), W(0x637be168f55c6cbf),
+     W(0xfa34e9942a65216e), W(0xd23e99afe3a43c84), W(0x6d09d189e6fd958b)},
+    0
+  },
+  {
+    {W(0xa2f9b4e4bac5d14b), W(0x9f904a3eb8699164), W(0x63585978fec79b4f),
+     W(0xbcc9b60ebff45cd8), W(0x2e515592a5d63de5), W(0xc47a048c3bcc637a)},
+    {W(0x0523810643aba777), W(0xf6818e4c77e67aac), W(0x9d5827d238f962b3),
+     W(0x28a904c6a003988d), W(0xc06bc833551f4575), W(0x61f6bcc2221cffef)},
+    0
+  },
+  {
+    {W(0x60c7d148bafa9cc9), W(0x0afc5fe2516b87fb), W(0x02e20acff795ff60),
+     W(0xd1ba069151f32975), W(0x8547e7f757be2399), W(0x4bdf6abfa0d1b33e)},
+    {W(0xc793832fa06077f9), W(0xad55cccb2d874993), W(0x5e217b27314387d8),
+     W(0x744d7b06e7f2ec4c), W(0x761aa86d24fa58b1), W(0x41400d9657dd313d)},
+    0
+  },
+  {
+    {W(0xf58e05c53178468f), W(0xa17c8b868328a2ef), W(0x1bb22cb44ce0c2f8),
+     W(0x1ab807b51aab9089), W(0x2aafa8c91e76fafd), W(0x58cdf95fb4801546)},
+    {W(0x2c1e4ef8d5d699f1), W(0x1583a2aa4cd433bd), W(0x571dcaec7f4f9b10),
+     W(0xf62b696b27156c5e), W(0x77d2443448820bb9), W(0x94e4cfcc11dd3e55)},
+    0
+  },
+  {
+    {W(0xbc923fdfaf54b58b), W(0x2aef31d88767acde), W(0xfbebb8f07f28a3d4),
+     W(0xce5feafe694fe977), W(0x606afb0ac9da1ee5), W(0x559866a0b74f7c42)},
+    {W(0xd935191fdc85f22c), W(0x5c3002d7c8ce3240), W(0xecd278c198452214),
+     W(0x665b3176821a3606), W(0xce05a914baf26fb7), W(0xa178860b60e4e8b8)},
+    0
+  },
+  {
+    {W(0x3832cfd59093efca), W(0x3fda8380ed8b34d7), W(0x874ec122e2bd4004),
+     W(0x3761e9c44270b9cc), W(0x6eb2fb1166e640d5), W(0x2a45ad23e6dfd0fd)},
+    {W(0xdcb3272bf8dd082c), W(0x7d84341f17486485), W(0x0f46b1fda4ca2644),
+     W(0x81a1ab1e82baf37d), W(0xbb1d72713b322f65), W(0x1571e326f4038252)},
+    0
+  },
+  {
+    {W(0x1c3df0914085f0b6), W(0xc60c47f5cede211b), W(0x7bdead8650b6e857),
+     W(0xc68645be2cf9aad6), W(0x8d970a94d01540f6), W(0x9346f253782ec6a1)},
+    {W(0x3da31263c1b23981), W(0x53076158dbabfb68), W(0x22947b9f743dfba4),
+     W(0x872e60061c56f47a), W(0xe973d81c2b3b8417), W(0xb98216184b1fed56)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb083ba6aec074aea), W(0x46fac5ef7f0b505b), W(0x95367a21fc82dc03),
+     W(0x227be26a9d3679d8), W(0xc70f6d6c7e9724c0), W(0xcd68c757f9ebec0f)},
+    {W(0x29dde03e8ff321b2), W(0xf84ad7bb031939dc), W(0xdaf590c90f602f4b),
+     W(0x17c5288849722bc4), W(0xa8df99f0089b22b6), W(0xc21bc5d4e59b9b90)},
+    0
+  },
+  {
+    {W(0x6f57752951c2bb65), W(0x4a0c1c284b874bdb), W(0x19a1842778b96c6d),
+     W(0xa674f9922f593505), W(0x5abeeec46b7209d6), W(0x42d15d0147cf5fff)},
+    {W(0xe24509b7b49e3b4e), W(0x81be939c639ee6e8), W(0x7f7daf595761e8e3),
+     W(0xed5cfcb8d420a288), W(0x365b29eb7a0ff696), W(0x7d14680599a1ac8f)},
+    0
+  },
+  {
+    {W(0x4936c6a08a31973f), W(0x54d442fa83b8c205), W(0x03aee8b45714f2c6),
+     W(0x139bd6923f5ac25a), W(0x6a2e42bab5b33794), W(0x50fa11643ff7bba9)},
+    {W(0xb61d8643f7e2c099), W(0x2366c993bd5c6637), W(0x62110e1472eb77fa),
+     W(0x3d5b96f13b99c635), W(0x956ecf64f674c9f2), W(0xc56f7e51ef2ba250)},
+    0
+  },
+  {
+    {W(0x9ee1ec3aadcdaa68), W(0xd98c498fdcbb6548), W(0x32b9737588102ac0),
+     W(0xdd296cf9c08527f4), W(0xb74f8145fae3dfbe), W(0x84131eb96cd7cc4f)},
+    {W(0xa0f2fe7a927ff15b), W(0x6b0ade4deee1a4b4), W(0x6e7df2d40eeb90a7),
+     W(0xe2f46e20be4de684), W(0xcd28feba3fdd06bc), W(0x8e4205aee6d6d9f6)},
+    0
+  },
+  {
+    {W(0x246ffcb6ff602c1b), W(0x1e1a1d746e1258e0), W(0xb4b43ae2250e6676),
+     W(0x95c1b5f0924ce5fa), W(0x2555795bebd8c776), W(0x4c1e03dcacd9d9d0)},
+    {W(0xe1d74aa69ce90c61), W(0xa88c0769a9c4b9f9), W(0xdf74df2795af56de),
+     W(0x24b10c5fb331b6f4), W(0xb0a6df9a6559e137), W(0x6acc1b8fc06637f2)},
+    0
+  },
+  {
+    {W(0x9ad73168f4a59550), W(0x2a488d698409d7af), W(0x9e946c2d30b3a5f4),
+     W(0x7bc4ced7c89723d5), W(0x79f514a1bd31f607), W(0x7d493f593a274341)},
+    {W(0x7eb01027d45d55d1), W(0x63f7690914735d1e), W(0x718d760f35be21cb),
+     W(0xba58160b7c793331), W(0xfbc0ce1f8d30d29e), W(0x4645c0c2c6f4b03a)},
+    0
+  },
+  {
+    {W(0xbd8c086834b4e381), W(0x278cacc730dff271), W(0x87ed12de02459389),
+     W(0x3f7d98ffdef840b6), W(0x71eee0cb5f0b56e1), W(0x462b5c9bd8d9be87)},
+    {W(0xe6b50b5a98094c0f), W(0x26f3b274508c67ce), W(0x418b1bd17cb1f992),
+     W(0x607818ed4ff11827), W(0xe630d93a9b042c63), W(0x38b9eff38c779ae3)},
+    0
+  },
+  {
+    {W(0x35d47426f78d33ef), W(0x4af25db28440c42c), W(0xbd6a15e22e91bf5e),
+     W(0xe366a84cc08b6b1a), W(0x759c122f55b97de8), W(0xecec558f08a03f29)},
+    {W(0xdcc9fca2ea9d2060), W(0xb3e49b8e9f361fe1), W(0xdeae39029b59cd04),
+     W(0xf532ede06f5e5bd4), W(0x84fbeeb936099f4d), W(0x73576b1f088d2052)},
+    0
+  },
+  {
+    {W(0xe8767d36729c5431), W(0xa8bd07c0bb94642c), W(0x0c11fc8e58f2e5b2),
+     W(0xd8912d48547533fe), W(0xaae14f5e230d91fb), W(0xc122051a676dfba0)},
+    {W(0x9ed4501f5ea93078), W(0x2758515cbd4bee0a), W(0x97733c6c94d21f52),
+     W(0x139bcd6d4ad306a2), W(0x0aaecbdc298123cc), W(0x102b8a311cb7c7c9)},
+    0
+  },
+  {
+    {W(0x2b85dd03139a9f83), W(0x02740ec2f55cbff9), W(0xdca3616adc3bd5f6),
+     W(0x52843de5a5da9b2c), W(0x7ee7890a1e22c1cb), W(0xd5cf15114aee5c76)},
+    {W(0x86d70af0c7234c24), W(0x1735378b6b6a709f), W(0x9989ed21423f32e5),
+     W(0x4675a4ffe739b1fd), W(0x873edb62304ce529), W(0x60b6624a7f1db13e)},
+    0
+  },
+  {
+    {W(0x22a28e59faf46675), W(0x1075730810a31e7d), W(0xc7eeac842b4c2f4f),
+     W(0xba370148b5ef5184), W(0x4a5a28668732e055), W(0x14b8dcdcb887c36f)},
+    {W(0xdba8c85c433f093d), W(0x73df549d1c9a201c), W(0x69aa0d7b70f927d8),
+     W(0xfa3a8685d7d2493a), W(0x6f48a2550a7f4013), W(0xd20c8bf9dd393067)},
+    0
+  },
+  {
+    {W(0xee43828c6b512bc6), W(0xf73dc9f550b91e60), W(0x68f23f30f5dbde6b),
+     W(0xaf2fe9e3ddd15e00), W(0xfbf34dae86578d49), W(0x689796556c130010)},
+    {W(0x137a5fc309942897), W(0xff1f0bfe9959f06d), W(0x2dd0a04abd7ee14b),
+     W(0x59c46072e54e2161), W(0xf470bdaeea7518ad), W(0xce556e4340c471cd)},
+    0
+  },
+  {
+    {W(0x4ec874ea81625e78), W(0x8b8d8b5a3fbe9267), W(0xa3d9d1649421ec2f),
+     W(0x490e92d9880ea295), W(0x745d1edcd8f3b6da), W(0x0116628b8f18ba03)},
+    {W(0x0ff6bce0834eadce), W(0x464697f2000827f7), W(0x08dccf84498d724e),
+     W(0x7896d3651e88304c), W(0xe63ebcce135e3622), W(0xfb942e8edc007521)},
+    0
+  },
+  {
+    {W(0x6b97dae4829ee0c7), W(0xcaaad7e3f274bc7d), W(0x87bee424512f7d86),
+     W(0xb5a03e5b3f7b0dde), W(0xc29db9c1f9fca5a8), W(0x538a6f8bede64af8)},
+    {W(0x0e518ba88b3c715f), W(0xc1cb4c313cb5b861), W(0x5cd61604c76dbfa0),
+     W(0xc557e50dffdac22e), W(0x7892fc51f67b53e8), W(0xa42f85c1ea7c141c)},
+    0
+  },
+  {
+    {W(0xbb155a66a3688621), W(0xed2fd7cdf91b52a3), W(0x52798f5dea20cb88),
+     W(0x069ce105373f7dd8), W(0xf9392ec78ca78f6b), W(0xb3013e256b335169)},
+    {W(0x1d92f8006b11715c), W(0xadd4050eff9dc464), W(0x2ac226598465b84a),
+     W(0x2729d646465b2bd6), W(0x6202344ae4eff9dd), W(0x51f3198fcd9b90b9)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x2ba8c79022b25f2e), W(0xf4670a511af0f4a8), W(0x6842f36a2fc2451e),
+     W(0xfc5c9558bb91e1e3), W(0x035d1dfcc3ead762), W(0x3d0721cb031e5556)},
+    {W(0x3af0cc813af18a2e), W(0x7888cee2bd11a363), W(0x80c3de0a6ade1d12),
+     W(0xe8c3a5bd93b2dcb5), W(0xe3adbd7c90a2214d), W(0xfe8646d51192948d)},
+    0
+  },
+  {
+    {W(0x65026297ba958101), W(0xbeb4adf98eef151d), W(0x623763a460c8bbf7),
+     W(0xfa8f5ad78b2a7120), W(0xfd744bdf085497e7), W(0xf9b6f97e2ba35618)},
+    {W(0x0cebfe9df8a15e86), W(0x47a6d01329576088), W(0x655817a3fcf19627),
+     W(0x30ab44f7c2f11261), W(0xbb001c9dddf2c850), W(0xb45c7eff073260c3)},
+    0
+  },
+  {
+    {W(0xb08fb1175cf3e702), W(0x7379b1978023df0a), W(0x73aefc7b6f954966),
+     W(0xc0fb886f76bd243c), W(0x871eacc5ce09d5a8), W(0x9f55b0a4e773f049)},
+    {W(0x92945c84415d725d), W(0xcd57391f0112ad84), W(0x4762bc1d0509d73f),
+     W(0x15cf97f10f1af175), W(0x1f855695328c160f), W(0x32cb87263b439f0c)},
+    0
+  },
+  {
+    {W(0xfa7d1236e2319f38), W(0x9ba1a1c0a551d3fe), W(0x9ea27288beb1282b),
+     W(0x1c069efa07fee8a9), W(0x5749c7b55870fee9), W(0xbedca76fafcec6fa)},
+    {W(0xa3f8f1b14c63c5e2), W(0xaa1bb15694758ac3), W(0x753329a9b59dc06e),
+     W(0xfa8e5f5b98a92c38), W(0x6b6f46fd3c2b4662), W(0x716f41a1ec04c6c6)},
+    0
+  },
+  {
+    {W(0xaa16c27a84a3d033), W(0xc207a4990c11c9ca), W(0x7ae2d193aae87c9c),
+     W(0x125ab459916d634e), W(0x02ded714cfa65b4b), W(0x6efe84944e212e22)},
+    {W(0x97c48a1888766168), W(0x663ccc9dd9c85b9a), W(0x6fe8b77b2652f501),
+     W(0x1daa602d078efd38), W(0x35885364dbcb8299), W(0x25bd1826b8240626)},
+    0
+  },
+  {
+    {W(0x0430af7759b11c7a), W(0xf71cc5b1d4f47aca), W(0xe1a7905f12e9190f),
+     W(0x1c689b7012db9e14), W(0x6bdd3dc90abaeeac), W(0x97f1c244504f0319)},
+    {W(0x874afd61a7a54b51), W(0xd4604ecbe3d979b8), W(0x0d33eee1ebf4aab1),
+     W(0xa3631cac1aa49fe6), W(0x0d8340fbf2217cfd), W(0xf6373284423b7e77)},
+    0
+  },
+  {
+    {W(0xf8c07373078a045e), W(0x998b2d52a81724d2), W(0x2b97faf1a6305a28),
+     W(0x5bc61f67f3e0f93d), W(0x7238583cd7aeb8c1), W(0x851ecc4b39f5f24b)},
+    {W(0x1cc8b4689992c20c), W(0x73168a863c8553db), W(0x1b9a5f95ba2641ad),
+     W(0x87a0c362ce9d565b), W(0x07fb51b2e1eedc62), W(0xdb300ac6a973903d)},
+    0
+  },
+  {
+    {W(0x78a53b5a9563e3bb), W(0x19c75eb286af355c), W(0x3520f427019a6f8e),
+     W(0xde6fcad6dc3ad0ba), W(0xfec96e4f79745b7c), W(0x5e566bbdb133f2dc)},
+    {W(0x50088a2b26561be7), W(0x16275b4cc5fddfc7), W(0xf21332ff23ae4b9d),
+     W(0x8cbc659e85246712), W(0x27fa9c8df50b515e), W(0x25ecf745494ac8b7)},
+    0
+  },
+  {
+    {W(0x33a2194f40175152), W(0x0f7ddc1dbb13f08b), W(0x7c08860850b54274),
+     W(0x7ebb2c11e41f0795), W(0xf915683fbe20d37f), W(0xcbcc14889daacec5)},
+    {W(0xfb02c20fea459050), W(0xe964d76ad5815aa3), W(0x0e009be9496bbf2d),
+     W(0x8233690eb42d0f7f), W(0x98ee83d49168eb0e), W(0x34c3b6f3621fa292)},
+    0
+  },
+  {
+    {W(0x437b7224641e3bd1), W(0x84e39f7980a58460), W(0x68e5292709759523),
+     W(0x0176a3ace77f5904), W(0xde92fb15e151e242), W(0x79965c9aeb1438d4)},
+    {W(0x318a810a596700b9), W(0xa8a6ec57c2198cbe), W(0xd7709aaabf030fd2),
+     W(0xb432023472f5d326), W(0xc9945214b03bce50), W(0x0bc06d9bd4ecba09)},
+    0
+  },
+  {
+    {W(0xdfb0508345c0a2ac), W(0xd13790035eacfb2f), W(0xe9872d766a2e126c),
+     W(0xd2a89cbd39a02d27), W(0xf45baf72d754b7c2), W(0x37985ef8c6c61baf)},
+    {W(0xbbcd3ef2da1c46b1), W(0x5af5dda43a355d83), W(0x9f7ce4281d67a984),
+     W(0xf19526926fa33654), W(0x2abccb55567b3b71), W(0x1b3704f3300cf29f)},
+    0
+  },
+  {
+    {W(0xa1972c2196fffb94), W(0xbe04093099d7633b), W(0xb116ff407e23d66e),
+     W(0xcb12b2bb949a19f1), W(0x75df10ee79e49e91), W(0xa3bf90764890bcf4)},
+    {W(0xcbaa76a609a30252), W(0x17c224a90ee5728e), W(0xcbc56e5cf4f3f4cb),
+     W(0x8a07110f4fe868a5), W(0x23289f2125e110a2), W(0x0289c12bd7693c45)},
+    0
+  },
+  {
+    {W(0xa82ac9983a4bc15b), W(0x28697435c930e4f1), W(0x191ebdb6b0c9cef3),
+     W(0xff05f8e875748872), W(0x5b86940237343b20), W(0xa7bce94beedfe44f)},
+    {W(0xfc271e2778f4e1fd), W(0x652c5a187734db66), W(0x108f61c87efc9a9c),
+     W(0x01db328970ed1dc1), W(0x2bc509afd249f61c), W(0x0d2e6b4cfeed393d)},
+    0
+  },
+  {
+    {W(0x06ba6db1f184c91f), W(0x3c0a348a45fd0382), W(0x0d535b6e4434b527),
+     W(0x7bbfa2c8692bae0b), W(0x5c59a08ebe7fe51c), W(0xbaa7d2be36e80cb8)},
+    {W(0x8a42d8d1bed3cae8), W(0xd9e0bc0d15ff4962), W(0xe51fce93644c75ff),
+     W(0x40222561b9392d63), W(0x8ab1d286023b4787), W(0xfa85c220a1b3190d)},
+    0
+  },
+  {
+    {W(0xbbcfa42d21fe8f67), W(0x82983012de2be980), W(0x88bb9704aa8e17a0),
+     W(0x100ad5e784772203), W(0x2867168965479d29), W(0x0334f9c5c2d9d5d3)},
+    {W(0x49032c1a83a6cf83), W(0xc257b0901dad479a), W(0xf64177dea7e3636c),
+     W(0xb2b5747874a315ab), W(0x210b11cda170ccbc), W(0x80509b7480d80177)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x298647532b0c535b), W(0x90dd695370506296), W(0x038cd6b4216ab9ac),
+     W(0x3df9b7b7be12d76a), W(0x13f4d9785f347bdb), W(0x222c5c9c13e94489)},
+    {W(0x5f8e796f2680dc64), W(0x120e7cb758352417), W(0x254b5d8ad10740b8),
+     W(0xc38b8efb5337dee6), W(0xf688c2e194f02247), W(0x7b5c75f36c25bc4c)},
+    0
+  },
+  {
+    {W(0x36c9dbbefda8520e), W(0x573507ce6ae3ea98), W(0x1ab38db696a8f9f1),
+     W(0xe031d2356b01e6bc), W(0x10466ae68afc4ada), W(0x3b35df41ed9c44e4)},
+    {W(0x61272c12c7bd99e8), W(0x6a4ae7b4805afd79), W(0xf4c47a910ecc49eb),
+     W(0xeb95dfeccbe84d5c), W(0x43f3b71c8ee497d7), W(0x2547af524c6fece4)},
+    0
+  },
+  {
+    {W(0x82e5d818a497f262), W(0x63ac3a94a36d18d8), W(0x6b0244261daa2e22),
+     W(0xb86a3580e46f3257), W(0xacf145bd7669db38), W(0x4d5518894df2727e)},
+    {W(0x03d9391e77c1a880), W(0x75c4dc4ae2ae57e9), W(0xefb77845ec38fa9a),
+     W(0xdd40660a265ad6bb), W(0xa22d98861854a1b2), W(0x52047cd9737ea499)},
+    0
+  },
+  {
+    {W(0xe323ed0cced45039), W(0x04ce0b67a90aa713), W(0x9c092f06e8d68e4e),
+     W(0xd8f5555ad0742e5d), W(0xe2d175bf00d3df92), W(0x8ca55f154f71aeab)},
+    {W(0xd1762d72642d391d), W(0x0dfdd3c2aec466bd), W(0x2caacb4c6281f2a7),
+     W(0x635ba4703603e53a), W(0x94a9811d49fecf29), W(0x3a42cf09466bf361)},
+    0
+  },
+  {
+    {W(0x4737236d0ade4e7f), W(0x01344b0070da7903), W(0x9da970306da6e06f),
+     W(0x30279bd6f3838f56), W(0xfb328c8b94431887), W(0x048451fabe90e5d0)},
+    {W(0x3334a6718cc0381c), W(0x180595ca197b7969), W(0x34937b6e38904b73),
+     W(0x91e227c296b588a5), W(0xa599b21544577ae3), W(0x6f87df1b214a0c7d)},
+    0
+  },
+  {
+    {W(0xe63fbb10b5356889), W(0x5995a0a92e73aba2), W(0x5cea30677afd4bf7),
+     W(0x4494e39dfd37120d), W(0x8c572c7249d718a7), W(0xfe159c275fa305fb)},
+    {W(0x751c217fc276c40f), W(0x44d0643c45e40857), W(0x9a996e6efe7a6486),
+     W(0x1a4f6d10f53b0e47), W(0x651390ecd15fd593), W(0xe0c1181d739ee9ee)},
+    0
+  },
+  {
+    {W(0x0b6d3744d228491a), W(0xf0771d3dc45e5d9e), W(0x12bbc94fa109847c),
+     W(0x74c0d53044944c77), W(0x0d280b18eb5a31b8), W(0x677a21517ef42592)},
+    {W(0xf11030c84623455d), W(0x763e8166ceb7acce), W(0xd5e02d013d22f1af),
+     W(0xb6d66c9cd93ee54d), W(0x80b4154faa41d4b1), W(0xca373d80acf8f6ed)},
+    0
+  },
+  {
+    {W(0x0f05710b11bccf2f), W(0x7113085a7aec1bc6), W(0x137da67a46b8d0e2),
+     W(0x454b89fc698b78cc), W(0xf2a6e1de258a9393), W(0x5f1804e716488e69)},
+    {W(0x7c6c550215b3bf35), W(0x3b0e09a5b05c2ec1), W(0x4b9de30e92f15247),
+     W(0x09d4ca9327e70a0a), W(0x9c8b16340d149363), W(0x54a8287cce642137)},
+    0
+  },
+  {
+    {W(0x08ae46d1af31fd54), W(0x2a3035e9c2e9f53e), W(0x05ccd7522973f8f1),
+     W(0xed37ddbb49d30f57), W(0xb7b3f22327397c54), W(0x2014fceda7fefbb9)},
+    {W(0x6f1a839f68143d6d), W(0x59eb6aa9504f5cd3), W(0xc9fe8f0f1d4956b6),
+     W(0x6495b0f5891aed65), W(0x13135a761476000f), W(0x9bcfe26fd585bf2a)},
+    0
+  },
+  {
+    {W(0x3a05e7d5ca2af43f), W(0x068953f975009801), W(0xd6c8a76c06740141),
+     W(0x7e1df1038a831fa9), W(0xfe06e2bae39046f3), W(0xda5264a0e1807c29)},
+    {W(0x1be4ffedff5d4808), W(0x299d6537c52be83c), W(0x1b38adba11834a9c),
+     W(0x6074a60b1248fd42), W(0xd9a0bd2e041b5430), W(0xf222ba84a7b76b03)},
+    0
+  },
+  {
+    {W(0xa3519ab823a6c5b9), W(0x6a1bc2102a05ded1), W(0xe1389295517550e6),
+     W(0x1839f5eb3f60e606), W(0xa2abd3e3da4704bb), W(0x64f2157eb8709093)},
+    {W(0x72b6d3646b94574b), W(0xda1ec71efa2ba6f5), W(0xc3d996421ff59f2c),
+     W(0xf83efd934677c1fb), W(0xb870303eb4c6d4af), W(0xf61d4c037bc6e941)},
+    0
+  },
+  {
+    {W(0x49ecd6f3346a764e), W(0xe46847f14105e657), W(0xce9cb2b57550f608),
+     W(0x45f1a1f7f4cf062e), W(0xcdb19a112c27d38a), W(0x36d375b284e50b19)},
+    {W(0xf43691540dba6405), W(0x4c9dc863040354dc), W(0x7229e70ea24d09cf),
+     W(0xe72aa86c7cf6831b), W(0x487fb68425392838), W(0xe88bed04430b9b47)},
+    0
+  },
+  {
+    {W(0x084f9ca9029ecf08), W(0x5caa05050c63bf85), W(0xac1b43eabe8f2269),
+     W(0x89ae6d4d6eff727b), W(0xbf85d4c458bff099), W(0x86b82a1afb12e60b)},
+    {W(0x2cbc1d7fcd46f3d8), W(0x32666dc64513c0e1), W(0x9da21844e25f38fa),
+     W(0x341ab45fab56bca6), W(0x179d2fde6480af4a), W(0x5227d4425b1dc7fb)},
+    0
+  },
+  {
+    {W(0x9f77b8c5d1164788), W(0x45bcd4c1d7b5c5dc), W(0xed22ecf3d88c2357),
+     W(0x330272ad07de1cf8), W(0xd9749f7f4ca13a48), W(0x4964ce5d1383ce08)},
+    {W(0xc033d516b0d0dbb3), W(0x056ae73bf51943c3), W(0x495cf7e057105e88),
+     W(0x08ced52e56462560), W(0xe9578aa713ca1a7d), W(0xe9b045c5a9717f7e)},
+    0
+  },
+  {
+    {W(0x4afcac5a1a526b9d), W(0x01bce075eb5e657e), W(0xe0d2940b9103b563),
+     W(0x1084e8c6f6bd51e1), W(0xd32f0da54445eaec), W(0x23c98b9ae631ea9a)},
+    {W(0xbb022e2b2cb26ab6), W(0x5929bef3045da752), W(0xc4f0e8f8ab4d3aec),
+     W(0x51bdd2c198257461), W(0x28bf621d1872d594), W(0xf2ae848286aab24a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf8a8499b666fa8a8), W(0xd0f9401571bba84a), W(0xb85e1b1d515e1328),
+     W(0x88a2636ba941e788), W(0xa045241d2b5dd8d8), W(0x161be476332f0350)},
+    {W(0x96c4b205a18fac6b), W(0x5cbe8d5e73fc5337), W(0x6fc33fc6d00b6029),
+     W(0x07a914ee89aa3b79), W(0x35353eb7a4d4dd00), W(0xc026bdc0673e8956)},
+    0
+  },
+  {
+    {W(0xf36e8398eaddf274), W(0xe41553a16a5e4ddb), W(0x36ab07464efc5b0c),
+     W(0xb211e59ad316c434), W(0x2515ec9f16ccf839), W(0x6ecb746503dc6a07)},
+    {W(0x842b7275c65c1b07), W(0xf7ceeec535750ab6), W(0x967d711ccef5255d),
+     W(0xcd3bfb075108cb92), W(0xe50c0d8aec1b9740), W(0x9e8d56611a9e6308)},
+    0
+  },
+  {
+    {W(0x283eec26d71543a6), W(0x98fa08bea7627841), W(0x269a83b827ad302d),
+     W(0x225f2f12bde3fdd0), W(0x046fcf380130b3a6), W(0xea733c1ac3ed9043)},
+    {W(0xf870f14d70aa08d1), W(0x643d18b834391e0b), W(0xf3e1d5f4847be772),
+     W(0xa9498223d0ed73a0), W(0x6933ccf014b3babb), W(0xc2439ae437f08f70)},
+    0
+  },
+  {
+    {W(0x1afa6aa6206add5d), W(0x66cfbbae150ea4c9), W(0x07fb920b5d36da4f),
+     W(0x144d51f9291e774f), W(0x26c2c134f40d87a8), W(0xc8cf3524a932f1a0)},
+    {W(0x35bb2a425aeb0bde), W(0x5cfcc1dac4be960a), W(0x5c40cabfaa1838ed),
+     W(0xea0c05ffe2855f1f), W(0x931ebb02fd525934), W(0x31a7b78f16246fd4)},
+    0
+  },
+  {
+    {W(0xecfabd2742dbb68a), W(0xad43a2c43eb546d1), W(0xcf4e64ccfe2691c9),
+     W(0xe3889e258347566a), W(0x48da354885b8c733), W(0xcb7fe0679d9c9f57)},
+    {W(0x8c26a8d668223280), W(0xc1e8ff623065705a), W(0x181ca70a3f8db9f8),
+     W(0x25aa6450e758213e), W(0xa4898f9169b2653e), W(0x5e5c9fb4ccd8303a)},
+    0
+  },
+  {
+    {W(0x517d13b1784d0621), W(0x2db4ef27d77b84be), W(0x6e2e26866d752aaa),
+     W(0x95da9fa1cab02667), W(0xbe8d91ad423163c3), W(0x8f3d59dba69953c9)},
+    {W(0xf728b1d2d6e635ae), W(0x5c4c177deeea663e), W(0x97a900a82e75d9c2),
+     W(0x136c6b1e3ad09def), W(0x4bab14a6dd8a2be8), W(0xa4ee903025cf1447)},
+    0
+  },
+  {
+    {W(0x11b59f3e92acd14c), W(0x188c1bb1d7aea098), W(0x5cadf0a19365958f),
+     W(0x8fef04fcca0b1b0e), W(0xbcb4d9fb0c274a5e), W(0xe97eb41cba78427e)},
+    {W(0xc49f0bc55cf06378), W(0x2681f12a281b669d), W(0x200e9e583f796b81),
+     W(0x5bbea92b17964262), W(0x86b3c15756db0039), W(0xe4477c5eead482ba)},
+    0
+  },
+  {
+    {W(0xcd92906c6d6ae962), W(0x628356159807d881), W(0x0d6929781fdc1915),
+     W(0x45d01a8c269d611e), W(0xe7bd1e709665b00a), W(0x086385349bcaa388)},
+    {W(0x8f189e882dd24299), W(0x5f643392b82fb270), W(0xca65bf16c633b111),
+     W(0xc6adc9c9d6f1dac8), W(0x0df2c293a3c3381d), W(0xdd6ae97d8388cd12)},
+    0
+  },
+  {
+    {W(0x9b3450debc4040ce), W(0x7b4ab8c2f3c33976), W(0xe4dfa0a79e1406d2),
+     W(0xe42a3961f3a2dbf0), W(0x67ada3754aa6398b), W(0x872861d2accc66a8)},
+    {W(0x8fe9ab8dbc378044), W(0x09701f0dd7ce2c16), W(0x695aa775e698fde1),
+     W(0x329660432bd13cc3), W(0x208432e5e013765e), W(0xae79062b10698494)},
+    0
+  },
+  {
+    {W(0x6859a224c4d82249), W(0x32784c753b4942ab), W(0x47022912708e3298),
+     W(0xbaabdf1fb729a2e8), W(0x1a524d4f55c27d92), W(0x46b72ed2e65bbc91)},
+    {W(0x71e88b92b367e9f2), W(0x53de6545be984f32), W(0x6a31b0bae4255e97),
+     W(0x6ba8ba156fbf7ab1), W(0x546799bd22082324), W(0x2098909371bb3d6c)},
+    0
+  },
+  {
+    {W(0x62fdf14a0d8bfaf8), W(0xfbf6bcebf5da945b), W(0x73fdfe5e5da5cc92),
+     W(0x0faf26bd51854786), W(0x1f4298ca21e503ad), W(0x00be9987001fdcf0)},
+    {W(0x5dee655f8d5c71f0), W(0x8d73c70fe6f8dffd), W(0xafbe3bd91cb33b3c),
+     W(0x887a95085b9dedc9), W(0x1c48b057270d5cee), W(0xbdbb3b00eea4c397)},
+    0
+  },
+  {
+    {W(0x39ec801027ca8688), W(0xa12a8c3905f43854), W(0xac9d7f1022a9de91),
+     W(0xc9f844ac8803578d), W(0xa84436e18d528d92), W(0xaab59dc65bcc28b5)},
+    {W(0x88069aaf85c65637), W(0xdd5da6eadbd061ea), W(0xbedf91f2fc8755f3),
+     W(0x7c32d616f560409c), W(0xaab522ae0b1d1cb0), W(0x0ba890f9310cb054)},
+    0
+  },
+  {
+    {W(0x514d7dc61a9f4ed0), W(0x2f680ceb40c620b0), W(0xe82807bb868a75dd),
+     W(0x6276e552ea3c9f10), W(0x853fbecb6aab3e3f), W(0xbb637bc72f59c4d3)},
+    {W(0x778ea78e1ae5bea1), W(0x5a43307aeb00953e), W(0x474c6cb8ea64b120),
+     W(0xb54716ee4d64ba1f), W(0x404823f1b2f31569), W(0xc319a0145d282aaa)},
+    0
+  },
+  {
+    {W(0x16fe6ebae683b836), W(0xf9cb6f3310758a67), W(0x18f994101ed4dc79),
+     W(0x6b4f631953af4f71), W(0x96e7caf94b8e8961), W(0x30a9aea57dab7207)},
+    {W(0xdde5ccda1bde1edf), W(0xe4b2d7b3e07e6faf), W(0x1bc661373b3c3901),
+     W(0x0bb62b0fce35c3c2), W(0x2cffebecca0502e0), W(0x75a82c3df3e6cb84)},
+    0
+  },
+  {
+    {W(0x7aa181a8a59d17ae), W(0x90b2a55b2dbc9f49), W(0xd0439daeaa57a024),
+     W(0x0458e6700c7c5ffd), W(0x9bf63fa50d65929f), W(0x85a2488b184110da)},
+    {W(0x0dc9d65c18ee06ab), W(0xd89929a9789788ae), W(0xd2d9a66063efb412),
+     W(0xc21eb1b1bcb3879d), W(0x7b575aa6295e232a), W(0x51bbc8e4f9f76fa8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xffdbd0eb3863db02), W(0x8b8256832f57e10f), W(0xc11acead35e7a3a2),
+     W(0x4998cf8c67833028), W(0x8f3a346b844c7976), W(0x0a9d872cdb9b1a1c)},
+    {W(0x8735dabcb98d445d), W(0x93790d80305fa0a9), W(0x7c0add49d267a01a),
+     W(0x2b46c913ffa20d11), W(0xf2acef26d8ab2d4a), W(0x71b701b93d926080)},
+    0
+  },
+  {
+    {W(0xe9d2a98a5133de8e), W(0x37083b60b81b8b00), W(0xf399325dceaf86ae),
+     W(0x03b17c888f161525), W(0xd8ac35c984211b9d), W(0x220837849050ca48)},
+    {W(0xa818c44bc9fab832), W(0x8882bccee5aea7da), W(0x633aaf35f8715b04),
+     W(0x5463e1b99d8829a9), W(0xb18df52d84a820f1), W(0x9d5ef891d096675d)},
+    0
+  },
+  {
+    {W(0xd54e2c7cac60496d), W(0xc06d5e5d04cd50a4), W(0xcb4105e8e60f7f59),
+     W(0x705db308427483ad), W(0xf73ba98bf2bff383), W(0xa945611a0220e6e9)},
+    {W(0xc01c46b8d957e12b), W(0x458897b7acb1f371), W(0xf738dc0bfa3403e6),
+     W(0x098bc687d2202896), W(0xec0c217a5f882e5e), W(0x8f25af77a1f4eb13)},
+    0
+  },
+  {
+    {W(0x2615c78259ee4124), W(0x4dc2824c76532b4b), W(0x9c3b1d771c84a04b),
+     W(0xb6fc203fcb9f9e34), W(0xbed65464c64f7846), W(0x04f520a2eb004248)},
+    {W(0x5c0177274a58fd22), W(0x25958482c10d9472), W(0xb78c6666aceb0e3a),
+     W(0x18d3c188fc046f0a), W(0x7f3e2f301baa9595), W(0xa574f8cd8a2844e8)},
+    0
+  },
+  {
+    {W(0xc899eba381c2d81f), W(0xb27267d6f3f0a431), W(0x607c8629da55568e),
+     W(0x6b5472282b1dc1d9), W(0x23232311c9c001ff), W(0x207a2eb2488f8b85)},
+    {W(0x3867ac9adac37a28), W(0xa36d14d32584a5f0), W(0x7398c647a74488ff),
+     W(0xf6ed920fbe087640), W(0x72beddc76319a571), W(0x55c2cd826a244aeb)},
+    0
+  },
+  {
+    {W(0xb7da79c625f8a53b), W(0x6b950bdfd331ad8e), W(0x3481b7b54aa36d18),
+     W(0x6efeaf88ed0e3091), W(0xeb017bddc993074c), W(0x8431a6d6529dd654)},
+    {W(0xf5177231bd069585), W(0x6d753b103ce85096), W(0x194d82d34ca26741),
+     W(0xeaeffe15adcd1650), W(0x4dcec3d9af7758b7), W(0xf5fdf6664cc2c819)},
+    0
+  },
+  {
+    {W(0x94bdc7f4a9810744), W(0x464195daf045d859), W(0x27e2dab0d654cb57),
+     W(0x1d4e1e537a491956), W(0xa1ef570c31d5d099), W(0x01cd21ee295f3de7)},
+    {W(0x8681b00db8249038), W(0x17c31bce93781b71), W(0x4324e90c6a1b5748),
+     W(0x44f9324c1222e554), W(0xe30ba10fffd53dd0), W(0x2e5817a8b48eeef0)},
+    0
+  },
+  {
+    {W(0xa349bb66c8fccaa9), W(0x7888755f31a53ee7), W(0xa6e1d891c18d3750),
+     W(0x9985aa4dae8d2bfb), W(0x8baec9ae31b33078), W(0xee68295a98750e94)},
+    {W(0x0d834bf8d6ddf305), W(0xab33dff39762126c), W(0x0c22faaa0c51d098),
+     W(0x32404042b887a10f), W(0x31f6a614248bed32), W(0x311f86301ce0d662)},
+    0
+  },
+  {
+    {W(0x5c95cf080d844b0d), W(0xe09a8352c98650c9), W(0xc1b106c5d089058e),
+     W(0x2b3cf101eb0c6107), W(0x1993fdba3ce6ee18), W(0x7234eb6425fc4d24)},
+    {W(0x8345acfe05f46dfe), W(0x07fccf68a2d87d38), W(0x14494cea85da7852),
+     W(0x8737500acecdd9f1), W(0x72b1490ca39068ff), W(0xce28271acfa4469a)},
+    0
+  },
+  {
+    {W(0xc872326f55c6c00a), W(0x6a5f0fa3f912deca), W(0xf4ef0ca5a7d1bdb1),
+     W(0x1dee685b37dc6beb), W(0xdad4cf52f1b09b88), W(0xc7199f0277f1db84)},
+    {W(0x7099ef00a3f00491), W(0xd8fbbbfa6d8804e3), W(0x2a00b8e50ae1e360),
+     W(0x8a8c9d03fe9be5df), W(0x06e0585b8b1faf6f), W(0x19542ee7ae29c502)},
+    0
+  },
+  {
+    {W(0x36cad867e2aa1c5e), W(0x7ef21e51317f9078), W(0x68efbb84c82e925f),
+     W(0x973b36769fe751e0), W(0x09c4e0c1177d36a7), W(0x9c0b7e048a753c5e)},
+    {W(0x8414cdab15ccad5c), W(0xeea2134ed50c1678), W(0xd9c1dae8f6585d5f),
+     W(0x82fd04ab4e5c3d96), W(0x868cddf7da3812d3), W(0x32a65aeafda07e68)},
+    0
+  },
+  {
+    {W(0x73292e6a60720858), W(0xe046a79953160855), W(0xf74d56c9ed3b94c1),
+     W(0x0e371167c67863e1), W(0x19b3a9f43f6636cf), W(0xe624798d898a25b0)},
+    {W(0x2ed1fc4dfde2cd6e), W(0xd9a7ab519fd15ee5), W(0xb6b8d551c487b1cd),
+     W(0x9fec705ae8936c54), W(0x4b779dde1a50e094), W(0xfb5100c2c3a4ef5b)},
+    0
+  },
+  {
+    {W(0xb35a7b102704c525), W(0x8a77fa5b44276cbc), W(0xb4a9cd235ff1a12c),
+     W(0xc74a017c88a37997), W(0x84e26eea9af37476), W(0x8a6b8c0e7bbf737b)},
+    {W(0x90ab7c948f05bd3e), W(0x31749075464f3a2c), W(0x32f7873c1dcfbd25),
+     W(0xc0af73d343bc2054), W(0x556c4798171d825e), W(0x2c84b5b6081542f8)},
+    0
+  },
+  {
+    {W(0xa5907e5c59ab2507), W(0x12b86e04cf7df60e), W(0x0a14bed18af4bc50),
+     W(0x462863b20c11bac5), W(0x98dde284126958dc), W(0x8877e7695625eb29)},
+    {W(0x869f7214f4fe19e5), W(0x29867e51ec0f8c1a), W(0xbf498bc078b85f03),
+     W(0x9dda400e8973a94e), W(0x8d8b998ae6e51b1a), W(0xedb0957c557ac00e)},
+    0
+  },
+  {
+    {W(0x84b6d5143b7d43f2), W(0xcb84c823afb7a2b9), W(0x892e8c4c56d2b161),
+     W(0x52ea7426214fdc0a), W(0x07f3d57679763557), W(0x9f95fd585a828bb3)},
+    {W(0x2c7f03d550e14019), W(0xab723de7d7eae7b3), W(0x4c08189317f4ea6e),
+     W(0x64cc5bc0ec367246), W(0x73077b5ddf11c3b7), W(0xfa34b540e08eb4bb)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xac6dbdf6edc9ce62), W(0xa58f5b440f9c006e), W(0x16694de3dc28e1b0),
+     W(0x2d039cf2a6647711), W(0xa13bbe6fc5b08b4b), W(0xe44da93010ebd8ce)},
+    {W(0xcd47208719649a16), W(0xe18f4e44683e5df1), W(0xb3f66303929bfa28),
+     W(0x7c378e43818249bf), W(0x76068c80847f7cd9), W(0xee3db6d1987eba16)},
+    0
+  },
+  {
+    {W(0x1238e097ae658422), W(0xb4631ddb568df55f), W(0x451254e7f74c5c50),
+     W(0x238b16d28805813b), W(0x23987b28925e7a6e), W(0x93b72e2d2a1a10bc)},
+    {W(0x944c784d05e44b7f), W(0x7d70fd098c8e3120), W(0x6bf1ab2aead45716),
+     W(0xd5f8f0e631c04205), W(0xac062526a10b8881), W(0xa1a83cf0fe5505a8)},
+    0
+  },
+  {
+    {W(0xcbbd8576c42a2f52), W(0x9acc6f709d2b06bb), W(0xe5cb56202e6b72a4),
+     W(0x5738ea0e7c024443), W(0x8ed06170b55368f3), W(0xe54c99bb1aeed44f)},
+    {W(0x3d90a6b2e2e0d8b2), W(0x21718977cf7b2856), W(0x089093dcc5612aec),
+     W(0xc272ef6f99c1bacc), W(0x47db3b43dc43eaad), W(0x730f30e40832d891)},
+    0
+  },
+  {
+    {W(0xac92ee1537d83369), W(0xc968c187fecec65c), W(0x29a7ca876e7a3265),
+     W(0x0f2b7e7a8456c9af), W(0x7471824e9754326f), W(0x498687bf364d2ec8)},
+    {W(0x86d8aacd3c6ee351), W(0x01ee6823f6f41e85), W(0x9805fc881d79f7eb),
+     W(0x377ac3a40040547d), W(0xd39215d461b4e90b), W(0x2547416e4c5fd81b)},
+    0
+  },
+  {
+    {W(0x9ffe55630c7fecdb), W(0x55cc67b6f88101e5), W(0x3039f981cbefa3c7),
+     W(0x2ab06883667bfd64), W(0x9007a2574340e3df), W(0x1ac3f3fa5a3a49ca)},
+    {W(0x9c7be629c97e20fd), W(0xf61823d3a3dae003), W(0xffe7ff39e7380dba),
+     W(0x620bb9b59facc3b8), W(0x2ddcb8cd31ae422c), W(0x1de3bcfad12c3c43)},
+    0
+  },
+  {
+    {W(0x03621d34f6e10789), W(0xc72143b8410c4004), W(0x886d00f66ca2933a),
+     W(0xd0a22382de1494a2), W(0xb8656c4d0bdcdf82), W(0x5199d9d3c4a58832)},
+    {W(0xa982c1aae1c0f449), W(0xe9cefb905a922bdb), W(0xfc268de431390c6d),
+     W(0xea4160e18c4fe595), W(0x6c427a636790d82f), W(0xaceb0154fc519907)},
+    0
+  },
+  {
+    {W(0x8c074946d6e0f9a9), W(0x662fa99551c3b05b), W(0x6cdae96904bb2048),
+     W(0x6dec9594d6dc8b60), W(0x8d26586954438bbc), W(0x88e983e31b0e95a5)},
+    {W(0x8189f11460cbf838), W(0x77190697771dc46b), W(0x775775a227f8ec1a),
+     W(0x7a125240607e3739), W(0xafae84e74f793e4e), W(0x44fa17f35bf5baf4)},
+    0
+  },
+  {
+    {W(0xa10292b907a6fbf8), W(0x292c1a203fa6235b), W(0x7a36f18f73ad7a1f),
+     W(0x8b2c7b0c5897b11f), W(0xf7b9a272cb664c61), W(0xb6d366af8f81e22c)},
+    {W(0x3b99b2118e342bba), W(0x03ce158bb06ced2b), W(0x3af1175d001db74b),
+     W(0x526f08467159cb8a), W(0x6a3c6e1febde4601), W(0xfad5963b8c232eac)},
+    0
+  },
+  {
+    {W(0xa21e69a5d03ac439), W(0x2069c5fc88aa8094), W(0xb041eea78c08f206),
+     W(0x55b9d4613d65b8ed), W(0x951ea25cd392c7c4), W(0x4b9a1cec9d166232)},
+    {W(0xc184fcd8fcf931a4), W(0xba59ad44063ad374), W(0x1868ad2a1aa9796f),
+     W(0x38a34018dff29832), W(0x01fc880103df8070), W(0x1282cce048dd334a)},
+    0
+  },
+  {
+    {W(0x21387e8a42a993b1), W(0xbcb6553368b1f2a0), W(0x3161d87aa5f7e4b9),
+     W(0x927b41301bce0a84), W(0x3aabd32787be0ae9), W(0x0163c6aa0aed169d)},
+    {W(0xad1e0f0e11584051), W(0x1ba4630274093225), W(0xed0456180a6a1f01),
+     W(0x15d07c636da060ed), W(0xa4584f72b7e003ae), W(0xf6e6b7c4a02ec136)},
+    0
+  },
+  {
+    {W(0x76aa955726d8503c), W(0xbe962b636bc3e3d0), W(0xf5ca93e597de8841),
+     W(0x1561b05eaf3f2c16), W(0x34be00aad34bff98), W(0xea21e6e9d23d2925)},
+    {W(0x55713230394c3afb), W(0xeaf0529bd6c8beca), W(0xff38a743202b9a11),
+     W(0xa13e39fc6d3a398b), W(0x8cbd644b86e2615a), W(0x92063988191057ec)},
+    0
+  },
+  {
+    {W(0x7150321974962b2e), W(0x3beeaf81e1db7ec7), W(0x702784cc445c4e88),
+     W(0x7aa583159baad7ed), W(0x72b76e2fd044b38a), W(0x35a2bb8f6a7f2101)},
+    {W(0x5e6ae263a14c2bf2), W(0x8fb614c034bb719d), W(0x7949eeca5dcd7c65),
+     W(0xb198be587670aeb1), W(0xb2238dfc93cabf25), W(0x6a6d45551a422b95)},
+    0
+  },
+  {
+    {W(0x787835ce13f89146), W(0x7fcd42cc69446c3f), W(0x0da2aa98840e679d),
+     W(0x44f2052318779a1b), W(0xe3a3b34fefbf5935), W(0xa5d2cfd0b9947b70)},
+    {W(0xae2af4ef27f4e16f), W(0xa7fa70d2b9d21322), W(0x68084919b3fd566b),
+     W(0xf04d71c8d7aad6ab), W(0xdbea21e410bc4260), W(0xaa7dc6658d949b42)},
+    0
+  },
+  {
+    {W(0x3ddea6d9f7848707), W(0xc11260d06dbcf13a), W(0x62c5ee60a16508f0),
+     W(0x4bdfa38fcb56535c), W(0xd391e7864fa5a6b0), W(0x173c3d702d4cd296)},
+    {W(0x9c5c596f5fa3f53c), W(0x77d395141ddd3732), W(0xca1bb91da5bf4edc),
+     W(0xb23afd381cd98b09), W(0x198248ed60bdfa0f), W(0x559dd99cfb69a4b1)},
+    0
+  },
+  {
+    {W(0xd8e958a06ccb8213), W(0x118d9db991900b54), W(0x09bb9d4985e8ced6),
+     W(0x410e9fb524019281), W(0x3b31b4e16d74c86e), W(0x52bc0252020bb77d)},
+    {W(0x5616a26f27092ce4), W(0x67774dbca08f65cd), W(0x560ad494c08bd569),
+     W(0xbe26da36ad498783), W(0x0276c8ab7f019c91), W(0x09843ada5248266e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa54768dab1b43eef), W(0x13e41f47e14fda22), W(0x774df203faef6863),
+     W(0xf795a034bd7471b3), W(0xf0958718b47de2e9), W(0xc92f7888e1160cff)},
+    {W(0x86ded97b0146c790), W(0x015918f5480a4b7b), W(0x05588920424e8459),
+     W(0x37455914eecf8b2b), W(0xe7d3df1fb968a6fa), W(0x07a0ffd6bad0719f)},
+    0
+  },
+  {
+    {W(0x2566021f98d23f6f), W(0xfb883e1234ca97ca), W(0x34e047a5d9f51b69),
+     W(0x0b50d91df8efa646), W(0xc2bbcbb2971f584f), W(0x4136f0e40907c91c)},
+    {W(0xa7ebeb0de735cc48), W(0xa7d1bedce113c8fa), W(0xc04d9a073f5c962a),
+     W(0x95c155e53ff74a2f), W(0x923c65a53df0749d), W(0x10d5f81227ae35d0)},
+    0
+  },
+  {
+    {W(0x4d37c2663e7a369a), W(0x092dc32c3ae62c55), W(0x566da2e928ca9d67),
+     W(0xa9771c1a79beb236), W(0xaf6b97a976f801e7), W(0x3afd62e771259358)},
+    {W(0xc23a5e32cd541e77), W(0xae4c90a301660ff9), W(0x3f3a233b1911ccf2),
+     W(0x93e4664cfa3b3ace), W(0x4bdc14832d4c5f5c), W(0xfe03d3c36abf13c0)},
+    0
+  },
+  {
+    {W(0xd5469c7becee6e87), W(0x056180bc33a4c917), W(0xf881ca21a16caa7a),
+     W(0x221de182e6cc7f39), W(0x10d61ab531378723), W(0xfb763bd9520c9660)},
+    {W(0x145214cd0d6b1541), W(0xd9f7ff2dd70223e7), W(0x9fce59e30cb1fe69),
+     W(0x2e6e77fa3e299fe7), W(0x3a0cf652d5af78cf), W(0x50cc42c53e852159)},
+    0
+  },
+  {
+    {W(0xebbe18b7ed31faba), W(0x046e248dd74971d3), W(0x3ddf5a2a0b24f97b),
+     W(0xf9a400c262fc6124), W(0x9ad9b0bc6b03b73a), W(0x9fa97c56153c8fde)},
+    {W(0x1b6477da00b73ea7), W(0xec59f64a21b2f3f3), W(0x4428712895306955),
+     W(0x4b5db01db9e77579), W(0x237edf0bde05e0d1), W(0xac904b01855332f5)},
+    0
+  },
+  {
+    {W(0x0791dfa1df764716), W(0x31bf68768c66da07), W(0x49f25b77ccedf4f3),
+     W(0x05170ccd5d965c05), W(0x37d9521bd49e6727), W(0x1548251286a00176)},
+    {W(0xdab444936c00eb48), W(0x102c6b95e00c5c5d), W(0x43660c3e4c2506ba),
+     W(0xb2fb26165ec6f132), W(0xccc4221a99ac7691), W(0x05b29758a576deb5)},
+    0
+  },
+  {
+    {W(0x3a17f86d48341ba2), W(0x558ef6e8ba6375bc), W(0xa86ea3f0927935e2),
+     W(0x2f43742ac04d4fb0), W(0x32a30bce38769421), W(0x5a6d6a62d8d3912f)},
+    {W(0x34154b19c20e3fd9), W(0xe95d3843fc85f907), W(0x26cfbe0f9f7a13c0),
+     W(0x50d50b3a531736e5), W(0x81849773b2cfa2c2), W(0xc81523e63ba8ae5f)},
+    0
+  },
+  {
+    {W(0x4a873076ad8c49b7), W(0x891598ce7146575f), W(0xc1d3042f427ea198),
+     W(0xdc592111ed259219), W(0x0abdbd16234850ca), W(0x26b9412643b6fe8d)},
+    {W(0xd3c79d1736a1cfe9), W(0x576386219a2b3baf), W(0xa736535d5a98bf65),
+     W(0xacb3b7ddab2cdb2b), W(0x37d3743adaaf89ee), W(0xf19d9aba0b348532)},
+    0
+  },
+  {
+    {W(0x30539655b29eff74), W(0x7ba206ebe723167c), W(0xe20c3ce488110a02),
+     W(0x52b406b97c124481), W(0x050111c68c74a728), W(0x3d594a6bc57cd9fe)},
+    {W(0xd4b2a271e5f952d9), W(0x7e52d63b080da0c9), W(0xa6463d65f53a6cff),
+     W(0x9ebcffcfcc678e26), W(0xa657f27b2f2b9424), W(0x850bd2b871da5c9a)},
+    0
+  },
+  {
+    {W(0xafad01a0d93c54b2), W(0x659bff9695536c49), W(0x7b91aac2b9734c15),
+     W(0x55c7f08224e02f59), W(0xebcb71e73a26e551), W(0x5b7225f76c6343eb)},
+    {W(0x021c48fb17d5e775), W(0x57536a42bd859c87), W(0x24852cc0ae2b63e9),
+     W(0x21515020c0ce0ef1), W(0x2ac7336c8fed825e), W(0x4bc87feea0152819)},
+    0
+  },
+  {
+    {W(0xde6973e22683ad60), W(0x35fe4650eebceb58), W(0xbcdbbabf7c719a33),
+     W(0x8bce8111c076ca95), W(0x8f7176deeb6bd711), W(0xd04e9769d240a56f)},
+    {W(0xdef7d8fac8e218da), W(0x04cff5976df28152), W(0x2a1af6e24bd1cca2),
+     W(0x9397014edcb911e2), W(0xa251339038677b96), W(0x0dc48a8fb61b462d)},
+    0
+  },
+  {
+    {W(0xe7c396d64654712c), W(0x1fa5ea507a26e994), W(0xaa98768709012b83),
+     W(0xf1ef9792e9b17e98), W(0x2c22bcb06dc2db10), W(0xae42ddf6ed4be80e)},
+    {W(0x672080f62e743405), W(0xa15a7f975b7821d1), W(0x0cd912f247adbf07),
+     W(0x6919c0dcb6c4ae8f), W(0x62b13edd14c6253c), W(0x66f35919f8032287)},
+    0
+  },
+  {
+    {W(0xdfcb3255fa371ffb), W(0x3fb4a22c92bb6b01), W(0xd96efc1605396353),
+     W(0x2ce2228ce5d2bc25), W(0x59483843212c7eec), W(0xdca7173882996047)},
+    {W(0x44dad56d8de87b1d), W(0x622f88910b6222d5), W(0x1abbc501d5d3a9cc),
+     W(0xdbed73a5ebe52e80), W(0xa7f785b1c98c56ef), W(0xa32471d3d343aeac)},
+    0
+  },
+  {
+    {W(0x2713b58c9d628e1d), W(0x3729960afaa8ba1e), W(0xc3438130ab53bc93),
+     W(0xcef9eda5e9c165e7), W(0x9bacd1c3fd02650b), W(0xbb300334540ece72)},
+    {W(0x21f5a5d3d9c4f0ed), W(0x1ba32e4ff7c19269), W(0x8f073beb2cf320fb),
+     W(0xb49766c45599646f), W(0x68180d6649e4f200), W(0x8203d8aeeaeddb36)},
+    0
+  },
+  {
+    {W(0xe6d78b7f60085b20), W(0x0aa1d62bf318d226), W(0xaaa4391df6461e64),
+     W(0xb15ee4a7213c949b), W(0x183f043be4bd3dbb), W(0xa1a87996ca49f456)},
+    {W(0x6030ed2ef6ed22bb), W(0xa2002784fab7f7a2), W(0xfc40914dd850cdba),
+     W(0xe63edc4c7df80ba3), W(0x8fa35ab57b27ddfb), W(0x3bdaec795096ea04)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa68295da2caf088b), W(0x23d6439a5c8709fe), W(0x8deba0cffe0c3df0),
+     W(0x5b4d037b3cd00a1a), W(0xe9edc429aa0f9088), W(0x6f5827e35847def7)},
+    {W(0x9739d03d306ad966), W(0x7c6b18afaed51d04), W(0xdc3d34ff1759060a),
+     W(0x029e9aa9a7e94dbb), W(0x2a3cdfa0f7e8b7f3), W(0x42f87bf0bbd8f6f4)},
+    0
+  },
+  {
+    {W(0xcd8c2ec9378ef62b), W(0x7f4a3c5491a7c4b9), W(0xe12386d4db83e1ab),
+     W(0x9a792032bb549bb5), W(0xaf81cba62807c0f1), W(0xd4ad7d87abf2008e)},
+    {W(0x9d7a72307e9ad6cd), W(0xb30636b08b517b2a), W(0x47c324daec900516),
+     W(0x408cd0d37193eb30), W(0x8f0bcce2d315c655), W(0x540ad4e0869d6c22)},
+    0
+  },
+  {
+    {W(0x7192a26eb9c88c30), W(0x3d121a50953c7295), W(0x8938195620aeab11),
+     W(0xebe39dd57c232849), W(0x5787970e4f79bc39), W(0xc88a38dc143e4092)},
+    {W(0x5f6030358b19220e), W(0x748fc0703664752b), W(0x7ec4b3a2f1856e61),
+     W(0xbef7dc4bbf77d65c), W(0xb444d5067011058f), W(0x286241f3c33cb945)},
+    0
+  },
+  {
+    {W(0x4b5e753ddae0ff8b), W(0xe55c83e4da3d97b5), W(0x4034d75f42fa905b),
+     W(0x89b85edac33e462b), W(0x31f413c3058de3bb), W(0x66c01c806ba75391)},
+    {W(0x3f500202373e28de), W(0x5090b33b4b9be739), W(0x7297aa10efa2addd),
+     W(0x3e8ccdbe1a6566aa), W(0x4dfda07fd7b4f214), W(0xa659bd1e7cb1cae7)},
+    0
+  },
+  {
+    {W(0x49d1cfcc6c38cd07), W(0x4367ffb5bb42b74a), W(0x8cd5d285d2ab0a99),
+     W(0x9c5cff671df5b6cb), W(0x19f4095a3003fadd), W(0x259001d3aa463c00)},
+    {W(0xf86673b0b737ef63), W(0x34afa100b820c7f8), W(0xb37675b44cc2cd5e),
+     W(0x71d52620b0342517), W(0x3af1f31657817cd7), W(0xa3652c8f79199618)},
+    0
+  },
+  {
+    {W(0x5600fee087ff00f0), W(0xa4a3dcb256e7845f), W(0x8f1262674cb08e4d),
+     W(0xfab0c1f52e9ab52d), W(0x090b1ac94c5686ad), W(0x8afe9a22bb10de4e)},
+    {W(0x3383f485ac08eac5), W(0xaf434c2a51a6cb93), W(0xc5ab92fe500058ef),
+     W(0xf03c7c97f4ce508a), W(0x525ac2cea77a5166), W(0x650cbaa8996efd66)},
+    0
+  },
+  {
+    {W(0x22daed9f0949fbcd), W(0xd3366ca3485dad37), W(0x65937daa46ec2755),
+     W(0x4c58eeb4df0f7a07), W(0xeb972393fa6036c1), W(0x55870dbe4d17faa5)},
+    {W(0xde29c31f3c2ca62c), W(0x3b529e064e1206c3), W(0xac00952e2c563ddb),
+     W(0x03a767fe5d6b0b57), W(0xe858fdf3a6c47282), W(0xb91701e0a5213d56)},
+    0
+  },
+  {
+    {W(0x31796c2387d11691), W(0x02991ea2a9de506c), W(0x4ff0cb716cb0c301),
+     W(0xdd0cdbd7d1702ca9), W(0x470a26c8e1a02a90), W(0xb705b7bad7054625)},
+    {W(0xfadc2e86d4a1a268), W(0x0fd9764668e9f923), W(0x042b5ebb2951a8fe),
+     W(0xe4af9d0364197a76), W(0xdd2c6bb3249c1b5d), W(0x60af89bdf01932b1)},
+    0
+  },
+  {
+    {W(0xbbc64a6c21497f72), W(0xe13fcf51b39c3dda), W(0x6e78570367ce28ee),
+     W(0x7be85bc8eba6ffba), W(0x3ba28f050752d6f5), W(0xfaf62f87bf79fd61)},
+    {W(0x88d09fa0830c5f0d), W(0x927550c259b05397), W(0xac119e346e4de2a9),
+     W(0x1e1a191616b7488c), W(0xdda5e0e86afecdff), W(0x0f24781f301fba53)},
+    0
+  },
+  {
+    {W(0x865ad2f2653a173f), W(0x3aae1b24883e17a2), W(0x8db6729d449f45ea),
+     W(0x1793adb133ef0dd4), W(0xf712536711c3d28c), W(0x8f15f52feb554f24)},
+    {W(0xc3d7df384e0cbdbc), W(0x241bfc9bc67645c8), W(0x5d68094f528a0970),
+     W(0x0cb857961688f34f), W(0x360d459a94d42403), W(0xc3fc13efa1bcf074)},
+    0
+  },
+  {
+    {W(0x045338f9ec64bc48), W(0x20d88adb14a0e2c5), W(0x753a56c49f54e859),
+     W(0xb2819384433442ec), W(0x96fa126686d5b985), W(0x368d1ef2b798e75b)},
+    {W(0xca67bfb2df10f66a), W(0x33b8e5b018646979), W(0x0b577d84c561fbdf),
+     W(0x01de649d41e8d54d), W(0xe1c5d94dde88e29e), W(0x04ee2aa6be471cf5)},
+    0
+  },
+  {
+    {W(0x4374145d41afcd64), W(0x98b72d6049d21198), W(0xc0ff394bdfde8a41),
+     W(0xed1112e5ee1ff7a5), W(0x87a920e8cb5036fc), W(0x437123f62deb225e)},
+    {W(0x37e527afb9ad8c58), W(0x3e3c9998abfaef38), W(0xb656bcc550b2b4e2),
+     W(0xfacc8a193bf5699d), W(0x98cec74fe616307a), W(0x34af333dd3ef8bab)},
+    0
+  },
+  {
+    {W(0xc196018335431b6f), W(0xc2495c2f23872bfe), W(0x41af97b7469e71b6),
+     W(0x16978e7f1be3ea60), W(0xec05886a3059f74f), W(0xbf5ab6bbd0f01224)},
+    {W(0x5ca55d960d359059), W(0x85bd8a8e587b9766), W(0xd821e829be0dcdbc),
+     W(0x2839964c3205b222), W(0x9330444d951863b5), W(0xfdf8c865f31469f6)},
+    0
+  },
+  {
+    {W(0x7d301a31d4555a80), W(0x178eca9df7c9a528), W(0x9731877e9b7fa7e6),
+     W(0xd682c10b3391a751), W(0xe35da5aeb0500ddb), W(0xfa755b64d79ca474)},
+    {W(0x54c371df430eb9fd), W(0xef4cf3ce3357dd5d), W(0xb9e691abb88edc8b),
+     W(0x12f0c53b4388f99c), W(0xe102b11ee438529c), W(0xf5805832a860c84e)},
+    0
+  },
+  {
+    {W(0x23004546977c369e), W(0x33f10680af8b5b75), W(0xe4f9f3dcc1c1d410),
+     W(0xb0cfcfc4b8368664), W(0x1b7cfbe5a423b865), W(0xb253421a2f030d12)},
+    {W(0xb3854ff6b8b5a0c2), W(0x0127ad98e21d2f30), W(0xd9dfa31e87e3cac1),
+     W(0x9bc8f00e917bc92f), W(0x24c625dcadd765f9), W(0x0ca78f3101816ea8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9ded9b0d744ec273), W(0x5bdfe5472e79e4d5), W(0x94f3aaf539393728),
+     W(0x22136862a438413e), W(0x449286da373c7de3), W(0xa709d85d29aa1540)},
+    {W(0x1bd13e410284a4f6), W(0x37b54d69f0799c8b), W(0xd43b558f6bcd0cb2),
+     W(0xf5757c0e9e610369), W(0x15c80b23c16e0651), W(0xacb2cf64001820aa)},
+    0
+  },
+  {
+    {W(0x10a8aabd2352478c), W(0x599d9dfa1364c40f), W(0xa009df1a076945a2),
+     W(0xf869152c03861f02), W(0xc405226e9f866a3c), W(0x93bd737d8b41ecbb)},
+    {W(0xb5c9ed1033901eed), W(0x90e4ce8f99312b80), W(0x1a9ef22e57589279),
+     W(0x83ef607d7fe2d6aa), W(0xf2da84543473dbfa), W(0x14f36d3a57879066)},
+    0
+  },
+  {
+    {W(0x3df98ea9a81cc26a), W(0x982ed56883b2c6f3), W(0xc9cbd1b5ea6d6976),
+     W(0x3f9f23197e25ffbc), W(0xbca8e0567da6280e), W(0x7abd316635cda713)},
+    {W(0x46ef321d740ae011), W(0xb17f6c75db214a33), W(0x37b73b4b51de4044),
+     W(0x5bccf3ccccd9ba8d), W(0xa2ca080dd0f7045b), W(0x79caf90668cf4dcc)},
+    0
+  },
+  {
+    {W(0x3499b44bc77488cc), W(0xde000e01aa8f3c10), W(0x30140406c1f517d7),
+     W(0xd4b3c8eb82a174e8), W(0xc8835b13af2c9b3a), W(0x2cd7626e443716f4)},
+    {W(0x336c4f4b9c22de71), W(0x9dd2b277f2529f60), W(0x6ffba2dc828c34d3),
+     W(0x257a345c34d0d1f7), W(0xbc1eff056ca4fbce), W(0x05b335620768349f)},
+    0
+  },
+  {
+    {W(0x5ebdc79cd41b2401), W(0xf0cd8598c498e0f1), W(0x93f6efe79c8b7f7d),
+     W(0xb2f1e40ac469aa57), W(0x882f0e943433c455), W(0x0add72adaea0712a)},
+    {W(0xb13578c399af96d0), W(0x43c28dc621177663), W(0x83aca2d854e09133),
+     W(0xae03943cc6ad8532), W(0xce0a61917104f75c), W(0x7dec8786f9838c37)},
+    0
+  },
+  {
+    {W(0x9db114e3715aa8da), W(0x596c2dc25c2fee22), W(0x04df016bd2f3080e),
+     W(0x0cb3f7cfb9b72037), W(0xadb877c7814fe2ab), W(0xb2d5ec5c37761ec1)},
+    {W(0xb5d6068e55d45831), W(0x5fab1dffb7c52c04), W(0x39b4aa5457d36d41),
+     W(0xec1de467423cc8cb), W(0x280e02dafda6566d), W(0xc70c3c383ca55f55)},
+    0
+  },
+  {
+    {W(0x340d77c2f3b6cbc6), W(0xe09ae22c80f4f690), W(0x3e915b028b74d32c),
+     W(0xae7101ca3cc1117e), W(0x3c36152b526c5939), W(0xdad8aedbd3ec0caa)},
+    {W(0x34de058e351bde13), W(0x2fa75fd4582726d1), W(0x27c030efc214ac0e),
+     W(0x2a216d1cc7100acb), W(0x3b730043309097b7), W(0x162ada747afd8aaf)},
+    0
+  },
+  {
+    {W(0x5d7afe9a10fa53ce), W(0xe2415b501ff49021), W(0xe39a067dc6523492),
+     W(0x3458527527557f5d), W(0x756b8d86930e9f9d), W(0x88df6219040d52d8)},
+    {W(0x606eb60b5362b045), W(0xd179818c9e383cbe), W(0xa6215748e068d293),
+     W(0x73fbdca22fce158d), W(0x9cfee07dcb183c8f), W(0xc0bf2beba5e03c98)},
+    0
+  },
+  {
+    {W(0x76b242b31cf2ab8e), W(0xceb190e697edb12b), W(0xd39b41b7089fc439),
+     W(0x6ee54e750892be51), W(0x128fbcfcde414849), W(0x4462539007fce5fa)},
+    {W(0x9d12e04513709b9b), W(0xc2c49737d95b22a3), W(0x0bcd670be4b34d6c),
+     W(0x78d7b8cd768d7c8a), W(0x7cf9382e16a0f402), W(0x9b84311d17238fa2)},
+    0
+  },
+  {
+    {W(0xa29d231edda802ba), W(0xde8d0d510ec3c1e2), W(0x0ee56eae117033bd),
+     W(0x4dc9491998bf860c), W(0xa08919cd775cd56f), W(0x609a30dc1332bfc2)},
+    {W(0x2c337f181a41db0d), W(0x27fb0072c974824b), W(0x34292c1bfaf28976),
+     W(0x242fcd73ef8c4fcc), W(0x553723b27473c603), W(0xb2191ee9a06a0bc1)},
+    0
+  },
+  {
+    {W(0x228437506ce71a1f), W(0x39c6fd9abf0956a5), W(0xd34a4be8c8d29ce5),
+     W(0x41dc15356fbf8fb0), W(0xdce277034c950de0), W(0x1ad7192f90c75c28)},
+    {W(0x5b3df71e27766767), W(0xba85ec629ca80b5f), W(0xfadae6e5095938d8),
+     W(0x5ce3ffc24d286159), W(0x60f771fdc7b977e5), W(0x7a764991b38c0c70)},
+    0
+  },
+  {
+    {W(0x0934812574503f05), W(0xcd6a64b217bf8ab4), W(0x791e72fa1fd4057d),
+     W(0x033abed8f0697964), W(0x1085ac930d58690c), W(0x8acd49d69c8874cf)},
+    {W(0x929e4c39ff1a5286), W(0x9704e80ff28395ab), W(0xfa69fce54c3d9f8d),
+     W(0xdeb56555fc83a6c4), W(0xd375fa037dc04c5e), W(0xab2f12f156a58cdc)},
+    0
+  },
+  {
+    {W(0x3ec1874496d87afb), W(0xb02425b5aeea74b1), W(0x47cfacea954bb89e),
+     W(0xd8d6ff40cd26918a), W(0xf2dbcbb19fd4dea6), W(0xc481a4fe370fea30)},
+    {W(0x60df9f99a334a5a1), W(0xeacebd61e6fbc823), W(0x21932e6ba0140a5c),
+     W(0x6504deb051206cce), W(0xaa4b43a350560eec), W(0xaf965e7b6535123b)},
+    0
+  },
+  {
+    {W(0x2afba531c0b9171a), W(0x687dbe4cf2d75c55), W(0x7c1c73f7fa17ba3d),
+     W(0x7886dd45063787ea), W(0x14f59a18abd0a109), W(0x1819df3c873bb66c)},
+    {W(0x76c969dfe01183f5), W(0x486a120b1a78b6bc), W(0xdfd702fac5686aa4),
+     W(0x2f74157bf3457569), W(0x66c8c73e01964800), W(0x0a2f6114def25ca0)},
+    0
+  },
+  {
+    {W(0x461bb6e1d118ef5c), W(0x277e378d1f4bf653), W(0x3b4138849ccaab1c),
+     W(0xa5979a3ecea9c61f), W(0xdc2a23c09dbfe67d), W(0x5f7e32f5335cb2d7)},
+    {W(0xeefe71a87accbd69), W(0x65d961341df58e12), W(0x17bafa56538145d8),
+     W(0x2a723472695df807), W(0x132b5320394ec082), W(0x96219e617d0ed426)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x86230934f14a99d9), W(0x1cf9c66e97c1c092), W(0x01e186ba6f595ed3),
+     W(0xd3291c3de2284a58), W(0x03dee2311b9e5e25), W(0xf2e9b4ad15cc9f53)},
+    {W(0x4fba15679770c29d), W(0xbf7d673650c4ae2f), W(0x86901eb92532d015),
+     W(0x4396fd784e7455de), W(0x2fbcea8fbcf811c9), W(0x3981ad15ae952b37)},
+    0
+  },
+  {
+    {W(0x6bd2c54d4cb89afa), W(0xe78c8bfa36527751), W(0x27f52654e3eee747),
+     W(0x56f205839598d907), W(0x5f91c2d027cb3712), W(0xc501819fa3e33c5b)},
+    {W(0x248490aa4eded738), W(0xde7ac94427789065), W(0x20138b3d74f7d38b),
+     W(0xae791f602fb60214), W(0x6b4fb300bd033d4e), W(0xc69c25d9bdfd1f17)},
+    0
+  },
+  {
+    {W(0x9bd2b68dbe832a0c), W(0x0efa6b60f1e49e28), W(0x67e7f35989586da1),
+     W(0xbc04c8aafd0944ca), W(0xb8db5424f0569b5a), W(0xc27dd1250cc5546e)},
+    {W(0x8f0ef9dfad67b577), W(0x1b5d40689824cbc2), W(0x2ec1eb644e7329b8),
+     W(0x3e0e7f37e6896b04), W(0xad2bff11c118b6bf), W(0xe17ec8dc40f93fa6)},
+    0
+  },
+  {
+    {W(0x0c3d2056be21a890), W(0x1c1ffbfb8fcfba99), W(0x1b68a98b1fbf56ca),
+     W(0x56fd85ff396e31cd), W(0xd2ca58444382c03b), W(0xc442030a7d3ef917)},
+    {W(0x4129a731426afafa), W(0xacff17ff5eaae9c6), W(0x9e854180653f3b23),
+     W(0xe65a1a149ee066bd), W(0x3420084e362ea5fe), W(0x6fe58801c7911e2e)},
+    0
+  },
+  {
+    {W(0x4c3f4f4905a95afb), W(0xd53a1d3af5db9d6b), W(0x0fbd9bad1844be86),
+     W(0x6b3b80ee272afc14), W(0xd727b0b6aa40a738), W(0x8a21bf454d809a37)},
+    {W(0x09fb064070767232), W(0xa671a2cc45bf5d89), W(0xa7e5ff8ad73a211b),
+     W(0xccdbf621d9a6b97d), W(0x38448e2cc89e8f56), W(0x07e4e9c32126da09)},
+    0
+  },
+  {
+    {W(0x43f0ae676c4be6a0), W(0xabc6a17a504bffeb), W(0xd5be6c25dbb4492e),
+     W(0x7efc9ee884bff97f), W(0x54fbd9d7062da2e2), W(0x1befeb61c6d2ac32)},
+    {W(0x14cf6dc0cbafef5b), W(0x8e640e4771d12192), W(0xd0566543d9a16800),
+     W(0x9cc2ade9beb1e28d), W(0xcbfeb45038e65833), W(0x3852eaacd0f5acb2)},
+    0
+  },
+  {
+    {W(0x4f10299a6c50f6a1), W(0xa51c677469a1caf7), W(0x024b18bc0cbede41),
+     W(0x7883c01e6b03ac7d), W(0xa7b99e741c5213be), W(0x529fad7a85a97540)},
+    {W(0x0b6fe59d03125409), W(0xf158167976275b90), W(0xcaa0969d6ad18919),
+     W(0xc47afe13ee7761dc), W(0xcae681fcdfb12539), W(0x58dabc7602ea65f4)},
+    0
+  },
+  {
+    {W(0x5e930d65c4650b85), W(0xbe96b2ae6350da54), W(0xcfac4f7efa08bd49),
+     W(0x277e8456a6e10f64), W(0x41be3067407ac162), W(0xcfd1d03252a9b68b)},
+    {W(0x8d8d216a9c337e0b), W(0xace044dc4e1b9cf5), W(0xad9a4102c60d54c3),
+     W(0xb09420f028815187), W(0x881179c60b3b8e59), W(0x872685ed5b09aba1)},
+    0
+  },
+  {
+    {W(0xb403638c7fbe6887), W(0x5872a71239aeb5b3), W(0xcf5724fcd5fbd285),
+     W(0x54052c9947f5602a), W(0xe1b0c622963e7ca4), W(0xa2e655519d320b2c)},
+    {W(0x5c506cb23b4b89e8), W(0x03c73b987f7a0fa2), W(0xe8e886d367dfd98f),
+     W(0x022f78aebac5c23e), W(0x876bf84fc7d7d24f), W(0x3423e4be3e9f7f49)},
+    0
+  },
+  {
+    {W(0x26d43085ee64924e), W(0x5eb54d1c4bd6a77f), W(0x69a69ccfd1ca022f),
+     W(0xaad92723a3342720), W(0x51e27b54421d836c), W(0x15e83917fc72a1ad)},
+    {W(0x183e75d14ddea73e), W(0x73fe3b9fbafcecfe), W(0x0197e0925daefd64),
+     W(0x2fa89f60f85b8249), W(0x95411aafd23cd465), W(0xb7dbe7485d9a459e)},
+    0
+  },
+  {
+    {W(0x8fe21f74d9ab2955), W(0xb74fd6444efbc23f), W(0x3f1745d04edf7c41),
+     W(0x8b74cfed0f0c4bb9), W(0xbeafacc2ae4248fd), W(0x36162b5f9daef91a)},
+    {W(0x3d5a3d427ec55dbe), W(0x3f7e485416651be5), W(0x7eadde97c04a1dd2),
+     W(0x14eab65fe9f4b7be), W(0xa4c085c6c71f35d9), W(0x0a26a8acb754ccc5)},
+    0
+  },
+  {
+    {W(0xab146c207dfc66ee), W(0xa7250dcebb6869ef), W(0xaeba44439d7ad5f8),
+     W(0x919f877ec48059f0), W(0x780ecd232c6b5c11), W(0x586daa8e38625f8d)},
+    {W(0x46a46c789911c031), W(0xf56f74fc65303d34), W(0x825bb06d4f384eab),
+     W(0xd147719ad6aa2bc2), W(0x745fd7460750e1ac), W(0x2ef411494b3ec757)},
+    0
+  },
+  {
+    {W(0xca751550abf63534), W(0xfd9c52a97bb9da37), W(0x6a30ffc8d88b7fa4),
+     W(0x671233a25dbac358), W(0x6bf2250aabca76e1), W(0xeac2f181a88d25a5)},
+    {W(0x21955e6c0bca831e), W(0x7aebf7e7c92616b3), W(0x9f06a54438f8729f),
+     W(0x763caec766d26237), W(0x7c39d08305b21687), W(0x9fbbdde5a2901db3)},
+    0
+  },
+  {
+    {W(0xdb24cd1af10ea702), W(0xf393de57461f8ebd), W(0xf56f414e5cfaefec),
+     W(0x758c8d854690230c), W(0x6740c974433d2594), W(0x69d92a620aa6bb20)},
+    {W(0x17be342e9b0bb191), W(0xc1cd309fdbf5c97b), W(0x089134df8998140a),
+     W(0x33809a7e82afcb85), W(0x409d2a481db47b21), W(0x1d54e86ccdb1bccf)},
+    0
+  },
+  {
+    {W(0x1de809dcf71581e5), W(0xa49c062c14023f6b), W(0x3b181a57237f8915),
+     W(0x56c8ba95240e648d), W(0xdcca82f0e5135b46), W(0x149346f03cf0154c)},
+    {W(0x8e5f344c34b4b958), W(0x44bac9b21590c71c), W(0x4fcc16a0a4ebdd94),
+     W(0x85ef7e0fd2cd0eb9), W(0xcfda54cf4689248c), W(0xc272ff12db96e5d6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x22313dee5852b59b), W(0x6f56c8e8b6a0b37f), W(0x43d6eeaea76ec380),
+     W(0xa16551360275ad36), W(0xe5c1b65adf095bda), W(0xbd1ffa8d367c44b0)},
+    {W(0xe2b419c26b48af2b), W(0x57bbbd973da194c8), W(0xb5fbe51fa2baff05),
+     W(0xa0594d706269b5d0), W(0x0b07b70523e8d667), W(0xae1976b563e016e7)},
+    0
+  },
+  {
+    {W(0x022aa09d236b71dc), W(0xb1ce6a0ea65a7640), W(0x317344c5b38b417a),
+     W(0x29a74cdb436451ec), W(0xd898eb6ca8b1c876), W(0xf0134f99b74eeffd)},
+    {W(0x0d9eab64225d71f7), W(0x9679b453ceb3cc2d), W(0x37c894ce14dbff2f),
+     W(0x3704d34927065280), W(0x9ee435d8ba29a0cd), W(0x675bea1409c11c4f)},
+    0
+  },
+  {
+    {W(0x2fde4893fbecaaae), W(0x444346de30332229), W(0x157b8a5b09456ed5),
+     W(0x73606a7925797c6c), W(0xa9d0f47c33c14c06), W(0x7bc8962cfaf971ca)},
+    {W(0x6e763c5165909dfd), W(0x1bbbe41b14a9bf42), W(0xd95b7ecbc49e9efc),
+     W(0x0c317927b38f2b59), W(0x97912b53b3c397db), W(0xcb3879aa45c7abc7)},
+    0
+  },
+  {
+    {W(0x8b3269a2714a10e8), W(0x64cef040a4a2727e), W(0xbc5ac714e428865c),
+     W(0x531dd17ffdaba094), W(0x86d2405718d657f2), W(0xe807b0d92f99dbbf)},
+    {W(0xc428a80f6848ef88), W(0xb3ef0709d0b73ce5), W(0xa752691922a5d255),
+     W(0xbfe6392318a18586), W(0x28a0c772fcf633b3), W(0xad22b4ec3f3c5298)},
+    0
+  },
+  {
+    {W(0xcd81bdcf24359b81), W(0x6fd326e2db4c321c), W(0x4cb0228bf8ebe39c),
+     W(0x496a9dceb2cdd852), W(0x0f115a1ad0e9b3af), W(0xaa08bf36d8eeef8a)},
+    {W(0x5232a51506e5e739), W(0x21fae9d58407a551), W(0x289d18b08994b4e8),
+     W(0xb4e346a809097a52), W(0xc641510f324621d0), W(0xc567fd4a95a41ab8)},
+    0
+  },
+  {
+    {W(0xc8c9b0ae7176dd90), W(0xa95604542917d487), W(0xb03b7946e62c508e),
+     W(0x60425926e9fe2321), W(0x73b10bba80c1d136), W(0xc30a847d9d218c9c)},
+    {W(0x6ed0c8ef2073859f), W(0xa176eabf432dd97f), W(0x3078096ab9e96167),
+     W(0xb28f0e6cc473e377), W(0xb44e4995683a3bc8), W(0x483512eed3523796)},
+    0
+  },
+  {
+    {W(0x261578c7d57c8de9), W(0xb9bc491f3836c5c8), W(0x993266b414c8038f),
+     W(0xbacad755faa7cc39), W(0x418c4defd69b7e27), W(0x53fdc5cdae751533)},
+    {W(0x6f3bd329c3eea63a), W(0xa7a22091e53dd29e), W(0xb7164f73dc4c54ec),
+     W(0xca66290d44d3d74e), W(0xf77c62424c9ea511), W(0x34337f551f714c49)},
+    0
+  },
+  {
+    {W(0x93a62e7cfa43699c), W(0xdad738901bc422d9), W(0x265e3cbb10cc9544),
+     W(0x28cceb062f37154c), W(0x6b79b0713bf2e08b), W(0x88e025df3ab39091)},
+    {W(0x50a8d04d126522bd), W(0xeabbc1b7b779bacf), W(0x3db4336ac21cc62e),
+     W(0x4747f0a36fc00450), W(0x067cbf1c544b2d95), W(0x2480b7d8fd2be7a7)},
+    0
+  },
+  {
+    {W(0x5ed2b216a64b6c4b), W(0x1c38794f3aae640d), W(0x30bbaee08905794f),
+     W(0x0d9ee41ec8699cfb), W(0xaf38daf2cf7b7c29), W(0x0d6a05ca43e53513)},
+    {W(0xbe96c6442606ab56), W(0x13e7a072e9eb9734), W(0xf96694455ff50cd7),
+     W(0x68ef26b547da6f1d), W(0xf002873823687cb7), W(0x5ed9c8766217c1ce)},
+    0
+  },
+  {
+    {W(0x21965f08b6ba9a0d), W(0xa744f06806cab532), W(0xd15d5fa45d4b9a92),
+     W(0xc79fc89b955ee1f4), W(0x6367e8b27b2775f6), W(0x2076cd8be2294382)},
+    {W(0xe5c20cedc9089d2e), W(0xe6097605d76d6424), W(0xa69f79eb02b41ca6),
+     W(0x9738d39d63e07498), W(0x35c14a6a92974776), W(0x3a000a517270fd02)},
+    0
+  },
+  {
+    {W(0x423ba5130a3a9691), W(0xf421b1e7b3179296), W(0x6b51bcdb1a871e1b),
+     W(0x6e3bb5b5464e4300), W(0x24171e2efc6c54cc), W(0xa9dfa947d3e58dc2)},
+    {W(0x175b33099de9cfa7), W(0x707b25292d1015da), W(0xcbb95f17993ea65a),
+     W(0x935150630447450d), W(0x0f47b2051b2753c9), W(0x4a0bab14e7d427cf)},
+    0
+  },
+  {
+    {W(0x2724c53558e996c5), W(0x24010322d7453876), W(0x3532b79c74818d0b),
+     W(0x1984146eb27b07e9), W(0x948b0c4f471646df), W(0x551b1c6132ef8e08)},
+    {W(0x22c0843425f892bb), W(0x8fd873a84853c594), W(0xff0bdf02ffdf802e),
+     W(0x527d69938239b779), W(0xed66f25c27ace140), W(0x7389d738a1a846a0)},
+    0
+  },
+  {
+    {W(0xa39def39b5aa7ca1), W(0x591cb173c47c33df), W(0xa09dac796bbab872),
+     W(0x3ef9d7cf7208ba2f), W(0x3cc189317a0a34fc), W(0xae31c62bbcc3380f)},
+    {W(0xd72a67940287c0b4), W(0x3373382c68e334f1), W(0xd0310ca8bd20c6a6),
+     W(0xa2734b8742c033fd), W(0xa5d390f18dce4509), W(0xfc84e74b3e1afcb5)},
+    0
+  },
+  {
+    {W(0xd605097e12e471f2), W(0x8cff86ab2bb4aa64), W(0x4a878412ea65a755),
+     W(0xfa790b772f2b55fb), W(0xd13fb9b35098a08f), W(0x39e474d7b359117d)},
+    {W(0xc37499c1e8e5a3d5), W(0x5abf6859c7586167), W(0x13143ba8310fec8a),
+     W(0x3543979f75918fc2), W(0xf55a9b62cbb0bde9), W(0xd6c1d00029359b93)},
+    0
+  },
+  {
+    {W(0xb028334df2cd8a9c), W(0xb8719291570f76f6), W(0x662a386e01065a2d),
+     W(0xdf1634cb53d940ae), W(0x625a7b838f5b41f9), W(0xa033e4feee6aa1b4)},
+    {W(0x51e9d4631e42babb), W(0x660bc2e40d388468), W(0x3f702189fcbb114a),
+     W(0x6b46fe35b414ca78), W(0x328f6cf24a57316b), W(0x917423b5381ad156)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0233e423d52eb122), W(0xc28483521154b0c9), W(0x2ca09cef6349e35b),
+     W(0x3b70afc3ded2ec54), W(0xc813474d52dded3d), W(0x2d3f21bf12f00ee0)},
+    {W(0xa0908f7692f215c6), W(0xb97d60e94e9c0440), W(0x84ad10c134b6a8e0),
+     W(0x6f37fd956e7c163e), W(0x7caae8c8d057e0c3), W(0x534f52c2553721a2)},
+    0
+  },
+  {
+    {W(0xa354c1de72a041b2), W(0xe83df25929d1330a), W(0x676610999d532bbd),
+     W(0xb7c2f4cf52011751), W(0x6945d34ff659e35e), W(0x6217d20ba1303b7b)},
+    {W(0xa200ddba25751bad), W(0xa74a729001d3566d), W(0x3018445faa82b46f),
+     W(0xc3e6a3acfccedc1b), W(0xe86ae8703353e29f), W(0x1c8085bbfd7e8547)},
+    0
+  },
+  {
+    {W(0x728c8e145d1a678f), W(0xf944da572ac89a2d), W(0x3016c2da4796df72),
+     W(0xf6d79e4e00a55efc), W(0x4fced269526b1cb8), W(0x4a93e47791f165a9)},
+    {W(0x528b8572f84f90d3), W(0x3b30376e5e725561), W(0x4f903520e07bb990),
+     W(0x07ddb97f4ea8ae6b), W(0x29c01e70b3b735bb), W(0x825c7f6e5000dd4a)},
+    0
+  },
+  {
+    {W(0x306b63e3b4dcea78), W(0x4b10209213636935), W(0x36bb68898bdeddea),
+     W(0x9331655d67a329ac), W(0x14c7fe26ba92ccce), W(0x4e7d6929be0519b4)},
+    {W(0x0dc39dbd164d50e2), W(0xd4c430a0b1679cc5), W(0xc7f78818fa8682ba),
+     W(0x43396eadb60aad97), W(0x751784d7ff2c64cc), W(0xd37928be866af43e)},
+    0
+  },
+  {
+    {W(0x3742b61e0475f547), W(0x48b2a2c2477722ac), W(0xf52c6787abce3401),
+     W(0x4749711ea4cb41b4), W(0x7ce0dfb03fca817e), W(0x1c1e3bf996e85048)},
+    {W(0xcd65250e40faa8e9), W(0xa8edce7017d9b93a), W(0x73523cb2b4dd5619),
+     W(0x15ba773abb5379f5), W(0xcc5e62d6c0a847ba), W(0x7efe5c7c04d852de)},
+    0
+  },
+  {
+    {W(0xf0a69e685a91c9aa), W(0x0304d20105c13197), W(0x773a3ab7cd14af1d),
+     W(0xc0b88edd558d555d), W(0xeb12d197d2e63dd6), W(0x4a8e849fbcd9cdb3)},
+    {W(0x06432985965eaa14), W(0x453d93861a5a6f43), W(0xbd28f6164171b9bc),
+     W(0x37781639bbfcf90a), W(0x1f93898f3a36084d), W(0x1fefd8b7dd00ca75)},
+    0
+  },
+  {
+    {W(0x3b8d8e495e456124), W(0x967ed511967c17b7), W(0x1d72430c2aad8c67),
+     W(0xe8c5d506b82c1673), W(0x989978868a0fb41d), W(0xa9d478f70f81234f)},
+    {W(0xa0c941cf44cc0614), W(0xc033c99024ad30f5), W(0xaa7de296101f89ae),
+     W(0x4cadd8e3ca6a3227), W(0x3b4db51f2764ec0c), W(0xcbfe70fc09256db4)},
+    0
+  },
+  {
+    {W(0xb9207dbc2b2f1bcc), W(0x6afd6871a3e83ef7), W(0x49924e5534ba150b),
+     W(0x2935ebf1dfec9972), W(0x34bf5e94b76f870d), W(0x22d0f32b4c20385c)},
+    {W(0xc78ac1728ccc8e72), W(0x7b45b8220ccecb0a), W(0x76c67ee4cfb4b8ba),
+     W(0xecfaefb2cd8724b6), W(0xe9bc3d67340bc1ef), W(0xed40b2b9ca5541b5)},
+    0
+  },
+  {
+    {W(0x5d1bd16518f8e17d), W(0x754986b7405f822b), W(0x420b1b24d8753faf),
+     W(0xab038e0608ff680c), W(0x33621a0fa3649f49), W(0xe24b84db78918eb6)},
+    {W(0x0e669672c8bf4168), W(0xcb7fab33171eab20), W(0xa097d2cc4808be42),
+     W(0x4f4e395f5842b80b), W(0xddcb1e51a579145c), W(0xa635d0cdf330ae0c)},
+    0
+  },
+  {
+    {W(0x9b8a3eb3069e6432), W(0x43aaa7fc721397f7), W(0x46e23c6ca7e83a71),
+     W(0x71b261d593fa3c25), W(0x4a47a1050f523a72), W(0x31919e898dcad752)},
+    {W(0x4c8b06e70c5dd2ad), W(0x677ec5f38bdc55e7), W(0x4372d55dcb1b5828),
+     W(0x7bf054c1f04dd321), W(0x4e8c1a992e44584e), W(0x6807803751d35d78)},
+    0
+  },
+  {
+    {W(0xa6d78a3d754377fe), W(0xcc17c26ac72ae5e6), W(0x2f0ab93b1c05fc24),
+     W(0x1645c369d64c9d40), W(0x7c37b12c563e7e9b), W(0xb70d292d58b477cb)},
+    {W(0xc283aca993a2d5a6), W(0x759e9118354c183f), W(0x8a031f6fdd8f4125),
+     W(0xfa8b17ad56edbe3a), W(0x6e0f96eb63c651ff), W(0x40361942b5085541)},
+    0
+  },
+  {
+    {W(0x25ae349981d311b3), W(0x8640f52a3b16037b), W(0xac0839941d947065),
+     W(0x3723c75ee2e693d2), W(0x65040a51b66f429e), W(0x7f582b0b035a3a53)},
+    {W(0x20eca9e10a166da6), W(0x45b37e202c4cc565), W(0xeab882957a8a96e3),
+     W(0x99e771dab60a1a1b), W(0x2cdd778c23b03965), W(0x8d4d7a7291052478)},
+    0
+  },
+  {
+    {W(0xb57b345e4ff33506), W(0xc1a3092a31d23fc3), W(0xc16b501e905e1f58),
+     W(0xa36a3b1f29067b85), W(0x7cfabd23c214dd5a), W(0xbd5f7ab726ad949e)},
+    {W(0x8f64595987363816), W(0x49c1a3e679d12d59), W(0xcc8f3e2c32d771ab),
+     W(0x008d900e6bde16d1), W(0x60428a0f60165966), W(0xd4f8d9eda7383ab9)},
+    0
+  },
+  {
+    {W(0xa52d3c2d7e8f73b5), W(0x86d8063351842657), W(0x58f01253b3949eba),
+     W(0x97689f15e79367d0), W(0x918bf9a30d820328), W(0x2d4bc99441c959df)},
+    {W(0x37392f6e8c16ee54), W(0x9f726d58e6f0849b), W(0x497de1e4b8208f08),
+     W(0x60c51233d51a29b3), W(0x0f61fb03c9e1d465), W(0x09494bd0fbe2613c)},
+    0
+  },
+  {
+    {W(0x100ef5d0a2bd7bd4), W(0x89efecf5f45e2a66), W(0x63bc210b653786bb),
+     W(0xc7748dba0a0e47c4), W(0xaf8122ae110d1ba0), W(0x6695bfbf797c78bf)},
+    {W(0x9b0e6fb1d7dbff69), W(0x106799703f53040e), W(0x22d9ed52fcaf4ed1),
+     W(0x1e27bafdcc1b2d4c), W(0x839f9c019f1c88e6), W(0x1112fe541321ad66)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4f293478154d0f99), W(0x1b82320dd07a24b3), W(0x1bf7c94f64d55f6f),
+     W(0x4489b57d725c5125), W(0x3aa4d43ab1b6a091), W(0x054842bdcf7a60fa)},
+    {W(0xaa918a4d2aeb4cb6), W(0xcbdaff99ac7d317b), W(0xed0e00a16812a03c),
+     W(0xb09acf270b0a1e4b), W(0xc73a41f7ac28386b), W(0x43134dbdf4cd1321)},
+    0
+  },
+  {
+    {W(0x10a53b90754d15e9), W(0x6cde9a0c5f4c7218), W(0x740d513fabef2b96),
+     W(0xff6cc47cd3f802fd), W(0x1be6825beb0627af), W(0xdb21ede55886c2dc)},
+    {W(0xb6cfb2c6f5daaed7), W(0x68b61aa8fae29a9c), W(0x7a1e16f53a5a485b),
+     W(0x16b60b92e7b2223e), W(0x332f33d836a13a9b), W(0x4567c313876cd1a2)},
+    0
+  },
+  {
+    {W(0x802f495cee46f99b), W(0x0f3ad0ee43b91cbb), W(0xeaf3b294e9b3f0f6),
+     W(0x82cc760033cbdcd1), W(0x1a5642278e83fce5), W(0xcf1b2edaffa0e4cc)},
+    {W(0x7d93e9769b1f5706), W(0xe4eb843cf873d68e), W(0xcb53dd79eafe5f35),
+     W(0xcbbed8f0fcaafabb), W(0x570472705f053efe), W(0x2c71a95f1ebfeb7a)},
+    0
+  },
+  {
+    {W(0xa896d28e4aea3fa2), W(0xc6137a456db06ee9), W(0x1bbafe8c06fb15cc),
+     W(0x2daab2961cdffdad), W(0x984defc8e1119b3a), W(0x9cd44c3cde2a25a3)},
+    {W(0xa7f54ece54ed6d73), W(0xd283017f50907054), W(0x69130efc6a3b9442),
+     W(0x5d17f1276785163b), W(0xc019911b172b1d0a), W(0xa19c745f7e3e093c)},
+    0
+  },
+  {
+    {W(0xd307d427b9ae75a8), W(0x15305d6400ba6da5), W(0xfff778371531d626),
+     W(0xfdd61b08b42639ec), W(0xca9462e7be99fb76), W(0x1e69d5e07c3f2f0e)},
+    {W(0x5c07066cbf7d1250), W(0x85596c415b01fbfe), W(0xb6d31387d93ff492),
+     W(0x2fd7d67b864eed19), W(0x67b707ff5afad638), W(0xf3641bfad0206fe6)},
+    0
+  },
+  {
+    {W(0x23545529fd3ea94b), W(0x15643155af8670c6), W(0xac836d10c75720aa),
+     W(0xea2c5389f6a0df88), W(0xdfbf31519e5a9c96), W(0xa2a2f3e38cad47be)},
+    {W(0xdbd5de983f0f393f), W(0x4e0191652de505f7), W(0xa2bdfef6324ba923),
+     W(0x8b0f981e8f14a2f5), W(0x590de1c45f880ade), W(0x1091ce3f107f3d4a)},
+    0
+  },
+  {
+    {W(0xb03d47627a53f5e8), W(0x0eea351c51a0deac), W(0x9da9ca72548723c5),
+     W(0xa12e40d7c944e384), W(0x403dbcf2cc947973), W(0x5ebad75dc6ef41ea)},
+    {W(0x4ccc2857501f0c38), W(0x4aabcf6587c0e38f), W(0x701a7f7e43ee1576),
+     W(0x7f061c1a0a894961), W(0x56059fb88f396f6e), W(0x966fef481a91fca9)},
+    0
+  },
+  {
+    {W(0xe185bdc2ab83d932), W(0x0a75845dd7c4e754), W(0x1f6f3397c3fe5695),
+     W(0x6c9f3a5f61f6a04f), W(0x3c0f9d4bb390a92b), W(0x9e3336b74793b454)},
+    {W(0x91ad0c341472f06b), W(0x4110047a892cbdd7), W(0xfa24d90565d53c83),
+     W(0xd63e58334176007d), W(0x741089fd2cd1623c), W(0x6b3d92022685d345)},
+    0
+  },
+  {
+    {W(0xab83ea356ec01946), W(0x2160de07702343ff), W(0x0fb3f3f68abedbb3),
+     W(0x4ba583c32d518e9c), W(0x5c854bc1225f9b11), W(0x51420c813137359d)},
+    {W(0x93fb0b5ead07ee0d), W(0x43d3859aa5d04c9f), W(0x1fe529d924639d79),
+     W(0x4ec573435842dcc4), W(0xa53b7e00779ac71e), W(0x84b663ec59356897)},
+    0
+  },
+  {
+    {W(0xce031c4d69080762), W(0xb7d6a9b60197dd66), W(0xd653d554b79a20ab),
+     W(0xf423060cbef1be96), W(0xcd849139f188ddfe), W(0xcf4e758379664181)},
+    {W(0xfdde3d22361acc6f), W(0x2eb3d9988a357403), W(0xf3968d98f7c4fb4e),
+     W(0xef2f364e4036684d), W(0x789ba6430bcdf323), W(0xb51bea71a602971c)},
+    0
+  },
+  {
+    {W(0xdaf187c8f01a71ce), W(0xce2060b09ae80b17), W(0xacacd2ed786921d8),
+     W(0xe120d476488bccea), W(0x12b7cb5399d1fe66), W(0xfe61cfeeb374b985)},
+    {W(0x410560a8f1a2b9a6), W(0xf4a97e2255bad158), W(0x0f42df7aff6889da),
+     W(0x4f620cfb4779061e), W(0x7978b05f50d2f2bc), W(0xaf98e73f9a2408a4)},
+    0
+  },
+  {
+    {W(0x1ac37f313586c802), W(0x70daca37a9cb8662), W(0x6e57d6a78d9c7bf6),
+     W(0x27069e2ce97eec9b), W(0x16284ceb4e877a82), W(0x30856e26774f6288)},
+    {W(0x88e53ea7fa33820f), W(0xbfe3b89f715ced07), W(0x6cf55589743b11c6),
+     W(0x020f8a092edd201e), W(0xc80afc2cb15c27e0), W(0x56557371cc53751a)},
+    0
+  },
+  {
+    {W(0x8dfecd32c79da132), W(0x590c14c6b498fcb6), W(0x05f3f9defeb5f688),
+     W(0x4b8bce12b27bc171), W(0x5a6ba3b9e4e00477), W(0x67b2442e59f3106c)},
+    {W(0x384213ec1b717aa5), W(0x88c9c69bcb6ca5ce), W(0x7a3d533f6febfd81),
+     W(0x307fca76ed38651c), W(0xb61c7353e4785803), W(0x1605281228b6565b)},
+    0
+  },
+  {
+    {W(0x56e16f28299a6f05), W(0xce16ff7ba0be22d6), W(0xd84a7ec52b78979b),
+     W(0x62377e7ec3a38253), W(0x7477dc32b74492f6), W(0x06281044d3f16505)},
+    {W(0xa41a1bed2a833936), W(0xab02298447ea58e2), W(0x639079b4bf7ca8bf),
+     W(0xfc28c948454ee739), W(0x12c9becca038d15f), W(0x93a2924b7150c6f2)},
+    0
+  },
+  {
+    {W(0x422403a6b7d4810c), W(0x7411c8e8dae5453b), W(0x9ce0d0c29891cbdf),
+     W(0xc8902c49014574b9), W(0xcd95dce9646da11b), W(0xa67e4f181f5129ad)},
+    {W(0x597cdc9b28a7ed93), W(0x08d38c5e75c34e00), W(0x866e7c7cbd8255fc),
+     W(0x85a9028ca091947a), W(0x7070f49a759f6740), W(0x2c431eebca7ccf9f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1d510157c9cb7f6d), W(0x532a077346ab7372), W(0x2ea07e2fc6dde9e2),
+     W(0xceed9ad937d5bb1f), W(0x3121994b98cc6e28), W(0x67d2fbb567ad8fc4)},
+    {W(0x34707fb3dc9f195d), W(0x6a601f481fd5a013), W(0xfe939b8d81ef6cb5),
+     W(0x5c51e8ab1223a9a1), W(0x8f6d7993db74cf37), W(0x0b81c5b7972808e1)},
+    0
+  },
+  {
+    {W(0x0db33228010c0754), W(0x10635ffa8eca7c59), W(0x6efd85380e8a38fa),
+     W(0xc1812ea5769360d8), W(0x505723dc76f27ef5), W(0xd0358e02f35af2e8)},
+    {W(0x9f7bb7fed99419ee), W(0x87c66e83430a0e2d), W(0x01187549773eaf7f),
+     W(0x05bbbba489d51bda), W(0x52cabb06640ccde6), W(0x0d5cb557e7ff387d)},
+    0
+  },
+  {
+    {W(0x70187dfbc39c1cef), W(0xa785216e0c50c71e), W(0x30188b816a6c0d60),
+     W(0xeaeda67d6a27e97b), W(0x4a5192826ba389aa), W(0xb96c7c7ea2bf1273)},
+    {W(0x8ff10657267fe714), W(0xdff4a271996d91b7), W(0xe34ba3e11dc7aed4),
+     W(0xc457048b38853d61), W(0xe89825db1ccbf658), W(0x68c7b4556b255edd)},
+    0
+  },
+  {
+    {W(0xc377b373bb20fabf), W(0x68d3aa52f986b847), W(0xd9c2f2adf39b6894),
+     W(0x1bbff106bd6da22e), W(0x3f7e5b8e7e09678e), W(0xad6a87897ed3ee78)},
+    {W(0x689e6b31af9807b9), W(0xeca87778bd1f6ef2), W(0x17d3277edda78c54),
+     W(0xe686caccefb65cb7), W(0x758aa1ab19a30f0c), W(0xb40df97fb11f071e)},
+    0
+  },
+  {
+    {W(0x0bef2d2517da64c9), W(0xb94dfc85470bbc15), W(0x2c2417cedd4af7ae),
+     W(0x52b5b3bbc8e88ca4), W(0xc00328c44f20d154), W(0x024290f730af5d4b)},
+    {W(0xe8bacbebeefc7350), W(0x89eed6ebb72abd15), W(0xb67d1da61d9e7030),
+     W(0x2ddefcbc0e70a331), W(0x7d09bc6d61e32577), W(0xc2073cc95b52e979)},
+    0
+  },
+  {
+    {W(0xd40f36e6276f2576), W(0xd37455c46405cfe4), W(0xe34094d7cc51dbae),
+     W(0x20f93f0f0edf8bf9), W(0x534b75aa23b5e165), W(0x438e4dd1dc1b73a8)},
+    {W(0x9dd48c413bddb435), W(0xc49867a0996b4932), W(0x4212f8a2a9ffa0da),
+     W(0x8d5236c4d94ed9bd), W(0x81bec489f169cb19), W(0x71cc1d7e6104edfc)},
+    0
+  },
+  {
+    {W(0x9cb21b57012eaba3), W(0xcfce54821347a83a), W(0xe3f3a67100d7b34b),
+     W(0xd4bcb3d1a6c1b0c3), W(0x6ebd26fb9f3c3e31), W(0xd01746532dc79be8)},
+    {W(0xe7cf9a0ad4156cfd), W(0x2757cb0416face21), W(0x8b0e320e69e1f08b),
+     W(0x2a8caf9b946f83d7), W(0x6daff0ba98a399ad), W(0xb4dfea0938ed6086)},
+    0
+  },
+  {
+    {W(0x16f3708b953b9223), W(0x0d3780f8770e7cf3), W(0x97a615b227bb71a8),
+     W(0xa8b9a864162f8b55), W(0x80ee8362d91e3fb9), W(0xb2009a09f83a4ff6)},
+    {W(0x07a7873ac1696281), W(0x17ff00c223095ddc), W(0x427f683d860d60ba),
+     W(0xea9959271f87d32a), W(0xb2ac69faa050319d), W(0x30c362b9d2d0b9ce)},
+    0
+  },
+  {
+    {W(0x71e663c234938279), W(0x9a8f5ccdb05630f4), W(0xd91ead12aad70096),
+     W(0x2b19b27e9e46cf72), W(0x93348c7038e3932d), W(0xeab6c03a5c7617b4)},
+    {W(0x57c13a97538eab27), W(0x2624d17b2f5872f7), W(0x77b63d9104b00f8e),
+     W(0x2e0582473c89db0f), W(0x5d367277937d0d8a), W(0x28c19068df60c252)},
+    0
+  },
+  {
+    {W(0xd648dd79ee45d4b1), W(0x0ceeaa64c2bc2f0a), W(0x695f3a3f491a2862),
+     W(0x4c07e2e0ce497e3d), W(0x5c53879969c766c2), W(0x3f856a2e4c4a7c14)},
+    {W(0xbf8a6d81038032a9), W(0xbeaadd7f45b7c960), W(0x78b22e85d50b9d26),
+     W(0xac1c56fa7eaefe26), W(0x21fbce54fc69f13d), W(0x37be1b47512a3708)},
+    0
+  },
+  {
+    {W(0x0ce992198c9e7869), W(0x653006be525c4ada), W(0x783620e4330c402d),
+     W(0x185a6ac833b728b5), W(0xa297c4a99d390886), W(0x547d1db5db4b8123)},
+    {W(0xccf12f071acdb039), W(0xe89c5866078ddc28), W(0x3460cbb1e52c383f),
+     W(0x7a4d1beaad25b82c), W(0x21e243fdb429be1b), W(0x5aa85c25bdc0d798)},
+    0
+  },
+  {
+    {W(0xc983afb64cb8d897), W(0x7f05e954b14cc152), W(0x587fe71e0f4d02f5),
+     W(0xaaa43167531b0cd8), W(0xf69452727a26def9), W(0x7ecf1e563bab50e2)},
+    {W(0x04b6f5c94c6f20ab), W(0xbc6cec2b893b497b), W(0x79e89567c9dc548a),
+     W(0xa39a0a567a40b749), W(0xf1531e2644bd4efa), W(0x14cdd759057c7c70)},
+    0
+  },
+  {
+    {W(0x5fb02929811d42bd), W(0xd7d1b956289929b4), W(0xfd3546947e531627),
+     W(0xa37c9b1e58c2b2e2), W(0xf30ed0f902bf499b), W(0x3fe80d240eb6df36)},
+    {W(0xf96270e57b148672), W(0x47362483647f48d8), W(0xc279ece6c29bc59c),
+     W(0xc05c1d9ffdd7e628), W(0xef8fc92e17568a7e), W(0xd65fe5a9ec0e7f00)},
+    0
+  },
+  {
+    {W(0x8041f112afefdee1), W(0x8cab3c86b891f668), W(0x1f18774e2b61e754),
+     W(0xf0d81b2459df567c), W(0x2cc25da41c95e1ec), W(0x315b1b1ac735d39e)},
+    {W(0xd0a9b9fb010734cf), W(0xeefc0398c79386da), W(0x49ce859b11fb1917),
+     W(0x3d66fd6baf167239), W(0x2522b0ef1fea6175), W(0x1a27657d3ec4a52d)},
+    0
+  },
+  {
+    {W(0x48dc23534ded5b58), W(0x1b69590756e707ca), W(0xbbcb73927ec7794f),
+     W(0x3714dfa6e50dbcc8), W(0x4f8083c8f27ec5d7), W(0x6358d2273bc8c3e4)},
+    {W(0xe0c2a0e7656cf184), W(0x3996e0a24244d801), W(0xa46767b54e543c01),
+     W(0xbf55776d965f1e2f), W(0xeb66845e6bc872ee), W(0x6a73fef1b441895c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x24480c57f26feef9), W(0xc31a26943a0e1240), W(0x735002c3273e2bc7),
+     W(0x8c42e9c53ef1ed4c), W(0x028babf67f4948e8), W(0x6a502f438a978632)},
+    {W(0xf5f13a46b74536fe), W(0x1d218babd8a9f0eb), W(0x30f36bcc37232768),
+     W(0xc5317b31576e8c18), W(0xef1d57a69bbcb766), W(0x917c4930b3e3d4dc)},
+    0
+  },
+  {
+    {W(0x53ebbaaeb475d8f3), W(0x3d6ea31cff76beda), W(0x3c15f25d340986b4),
+     W(0xc5925d2e3365312a), W(0xc35d3ee251641f96), W(0x11eb2f75984128e4)},
+    {W(0xb41a21a83d04bc99), W(0xf2d286006436c3d0), W(0x4ffcf4c0faf5663c),
+     W(0x889d285a0a62c9dc), W(0x0908665acb2d60c5), W(0xe2f19c590a131be5)},
+    0
+  },
+  {
+    {W(0x318feb4c22319bfb), W(0xfd0a1331a1ee9625), W(0x1e4a786d5b238661),
+     W(0x88e04305a722c591), W(0x38eb062af406cb01), W(0x21caa381e7216364)},
+    {W(0x450c1d29f0e1f665), W(0x369af7bf207a1320), W(0xfe46a53a6f6c0680),
+     W(0x4553199a25eac032), W(0x41fa659affc49722), W(0xfb9e0c73bbcb7a29)},
+    0
+  },
+  {
+    {W(0xc0de60f5091354ff), W(0xd7cc38bba1bd1975), W(0xf4122aa8e734e2df),
+     W(0x08f40f63ef773db6), W(0x0a7e9484ce2d71c5), W(0xcc79173378a3f825)},
+    {W(0x0cac7a5bb47beec9), W(0x1cbea0e4a3f7b5b6), W(0xecf19a90d3e18145),
+     W(0x0d1b062a0aadf689), W(0x42299f1ff3f0acf7), W(0x63a645395ac252b9)},
+    0
+  },
+  {
+    {W(0xa4bfe1515bd11a42), W(0x38920da20ea6729b), W(0x41e28260a0ee708f),
+     W(0xff4fdff4abc9d5f5), W(0x6ed92241ffaae99e), W(0x6075ce0dc04fe4d9)},
+    {W(0xf10a173e5db066f5), W(0xa2edee12e75ef129), W(0xd2a0823f8ed02e85),
+     W(0xffa78cf42e522dc1), W(0x07041e4600c939fd), W(0x3369357f3a9a8bba)},
+    0
+  },
+  {
+    {W(0xa1fc20f7ba264fa8), W(0x0f6254154105e64a), W(0x2e5581c28e2e8e16),
+     W(0x912c80fa4c456234), W(0x7fd61fb9e9e31ad4), W(0xa5de4e7d1c19e811)},
+    {W(0x6a7ab2cc2961b64d), W(0xbf06db255bb2da03), W(0x33f76a85ab06af4d),
+     W(0xda387e544866378d), W(0xbb71deb856826f8c), W(0xbbe3ce38eb64ecb6)},
+    0
+  },
+  {
+    {W(0x0e935934fd5d084c), W(0x7cd4992a9121a6e0), W(0xab773dba8e15d863),
+     W(0x9cea4a51cab64644), W(0x516754d72efff061), W(0xd8af89dacd3a36a4)},
+    {W(0xc7d352ac4615774e), W(0xd1bb914b21ae0d27), W(0x8a8aed979199938e),
+     W(0xeb06789acd6f3495), W(0xc51d7766775f93ee), W(0x7eb6909f0a8af851)},
+    0
+  },
+  {
+    {W(0x44bfd1665c1d4586), W(0x46434e198d1d86d6), W(0xe50fcf81c3936683),
+     W(0xc9b4eb068b08680f), W(0xf90882c52832aab0), W(0x42823cefecbf5dda)},
+    {W(0xfd4d51c744ae08f0), W(0xb54a08f1bbd21c1c), W(0xb72953dbfb187c34),
+     W(0x166f7f26f8ed037f), W(0xd2b1077a097bad45), W(0x47794cdc790dd808)},
+    0
+  },
+  {
+    {W(0x4e0ee07d5601372b), W(0x22067004277071ae), W(0xb7c0947adb611822),
+     W(0x0c890b17b836eb90), W(0x99bdb977b2c6177b), W(0x64c60f944e04aabe)},
+    {W(0x875810cd5eecd182), W(0x66822d84875602f6), W(0xcd4b6d85d7e1914f),
+     W(0x46a4ebc42f2fa580), W(0xd4741ea8e0af11d6), W(0x70d64a3181238cf9)},
+    0
+  },
+  {
+    {W(0x6003a0460ebd4969), W(0x73f86c4d20728f2f), W(0xfb56a3a6fb65c157),
+     W(0x37009c9867bfacbd), W(0x60f8c78fcee7620e), W(0x2963de2c378137af)},
+    {W(0xafd451f11d7b49dc), W(0xaf3b027490be28d5), W(0x7d283fd7fcd724f9),
+     W(0x86fbd155974248a3), W(0x9d143af87fb4e414), W(0xc2a34ce0b79b399e)},
+    0
+  },
+  {
+    {W(0xf2ef682072003c04), W(0x627b8095e34ff1af), W(0xdd00cb34ca23be89),
+     W(0xe19d30e9e738d179), W(0x44feed7853b55da9), W(0x20380e9bdc3ee8ee)},
+    {W(0xf42be18f5d62dc68), W(0x407fa31b10b7feef), W(0x362433eb7c25bc6f),
+     W(0xe292a4a4c864e045), W(0x5ecd7f8022841295), W(0x08b637ea32e118a7)},
+    0
+  },
+  {
+    {W(0xfadb2ac4bac8b691), W(0xf0c5a0361579c4d1), W(0xa192474f79019224),
+     W(0x8c7a64574117a323), W(0xe58122dd84d970a9), W(0xc475893c0bf77208)},
+    {W(0x9518412f1bd45c95), W(0x75bd0a72283f7a3b), W(0xa9e871605fb7e6f1),
+     W(0x14d3c944df67aced), W(0xbceea947d0348c22), W(0x5331c192d021aba4)},
+    0
+  },
+  {
+    {W(0x54f7b89895b6dee6), W(0x0dfde1345921f846), W(0xd3a18dcd63520e4e),
+     W(0x46bbd27bec276da8), W(0x981442a19f547286), W(0xc83cd6db5bc53393)},
+    {W(0xec43325eb7898f04), W(0x1b9ca04e347da37a), W(0x3119be87068b8c58),
+     W(0x66041c29f272b77b), W(0xfd0593f2548b165e), W(0x0167e36c5340278d)},
+    0
+  },
+  {
+    {W(0xae08fa6252ed5558), W(0x02e5a4f934c6dc6a), W(0x4fe067b5b386fc24),
+     W(0xbfa9ff21bc897232), W(0x1dc37e53271d76b0), W(0xd88602b8161ee8f7)},
+    {W(0xfc65307de2e81d7a), W(0xefded8f8b3cefacf), W(0x5dee6fbf4736ec63),
+     W(0x8146184dcf9e6f77), W(0xd6ea34f78668893c), W(0x396588fcf3dba6ac)},
+    0
+  },
+  {
+    {W(0x62033f1c278d7e9b), W(0x399b7adfc9bfb27a), W(0xf00abd43b7c62fba),
+     W(0x28cbb4e5a88ca2b9), W(0x943abe9440405b39), W(0x47875050fac3ff45)},
+    {W(0x44db1743e35280f0), W(0x5a8d5b022dcc4892), W(0x8a564967a041bb50),
+     W(0xc592661846bc9d15), W(0xa0ba607373a2f7bb), W(0x9596dae1e66a0f3f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa05c751cd1d1b007), W(0x016c213b0213e478), W(0x9c56e26cf4c98fee),
+     W(0x6084f8b9e7b3a7c7), W(0xa0b042f6decc1646), W(0x4a6f3c1afbf3a0bc)},
+    {W(0x94524c2c51c9f909), W(0xf3b3ad403a6d3748), W(0x18792d6e7ce1f9f5),
+     W(0x8ebc2fd7fc0c34fa), W(0x032a9f41780a1693), W(0x34f9801e56a60019)},
+    0
+  },
+  {
+    {W(0xa4b957d262c36887), W(0xaf15a485fc24cff8), W(0x11575e80a271d9e0),
+     W(0x0fff68d44b9367e5), W(0xf55ba6732279779f), W(0x9d72cca6d4d68f68)},
+    {W(0x01474ab1590ffe4c), W(0xd20f44e1074d634b), W(0x63903a8336111d25),
+     W(0x37342a5fab531cef), W(0xd3c93fe7702ed867), W(0x05d143696279f7e1)},
+    0
+  },
+  {
+    {W(0xb398290cf0db3751), W(0x01170580ba42c976), W(0x3e71aa2956560b89),
+     W(0x80817aac50e6647b), W(0x35c833ada0be42da), W(0xfa3c6148f1baba4e)},
+    {W(0xc57be645cd8f6253), W(0x77cee46bc657ad0d), W(0x830077310defd908),
+     W(0x92fe9bce899cba56), W(0x48450ec4bceffb5a), W(0xe615148df2f5f4bf)},
+    0
+  },
+  {
+    {W(0xdccf68bccbaf4685), W(0xb333e464270a2bcc), W(0xe43ae199254dd3e3),
+     W(0xe8526e26ddce5c84), W(0x52bad815ea0b4258), W(0x67c12c1b094574c4)},
+    {W(0xa5362fcb861545b7), W(0x3e904c35c2b2eb62), W(0x0f9312b5eeffc2cd),
+     W(0x5475657b14de4e5b), W(0x746e67d4f0233fa5), W(0xb5157d7f35471ec2)},
+    0
+  },
+  {
+    {W(0xf55edabb90b86166), W(0x27f7d784075430a2), W(0xf53e822b9bf17161),
+     W(0x4a5b3b93afe808dc), W(0x590bbbded7272f55), W(0x233d63faeaea79a1)},
+    {W(0xd7042beafe1eba07), W(0xd2b9aea010750d7e), W(0xd8d1e69031078aa5),
+     W(0x9e837f187e37bc8b), W(0x9558ff4f85008975), W(0x93edb837421fe867)},
+    0
+  },
+  {
+    {W(0x3503d9371f23a0d8), W(0x64c598a8c321dde0), W(0x67f101ef5b52e0f0),
+     W(0xb6b5b4c2f955b5fa), W(0xb5f03d53880e0569), W(0x121c3ac1c99393ef)},
+    {W(0x90755bd657330666), W(0x70ae5793d4d71d3d), W(0x326ffd519e9ce792),
+     W(0x1b772d7396ccfa14), W(0x652710f4874a22de), W(0x72768469db210342)},
+    0
+  },
+  {
+    {W(0xaa6489df83d55b5a), W(0xea092e4986bf27f7), W(0x4d8943a95fa2efec),
+     W(0xc9baae53720e1a8c), W(0xc055444b95a4f8a3), W(0x93bd01e8a7c1206b)},
+    {W(0xd97765b6714a27df), W(0xd622d954193f1b16), W(0x115cc35af1503b15),
+     W(0x1dd5359fa9fa21f8), W(0x197c32996dfed1f1), W(0xdee8b7c9f77f2679)},
+    0
+  },
+  {
+    {W(0x58d6998e171c1439), W(0xfd4a98f401feedec), W(0x420b2a0165739fce),
+     W(0x5c5db30822f7a073), W(0x016c547805042f00), W(0x5fc73ce2a12413d9)},
+    {W(0x8ceb2d70e932aa17), W(0xb4d66b670537afaf), W(0x2638d012339c146b),
+     W(0x02fbb7b628ac0555), W(0x7fcb0c8162d46e63), W(0xeaa9ff4f066d088e)},
+    0
+  },
+  {
+    {W(0x5405179f394fd855), W(0xc9d6e24449fdfb33), W(0x70ebcab4bd903393),
+     W(0x0d3a3899a2c56780), W(0x012c7256683d1a0a), W(0xc688fc8880a48f3b)},
+    {W(0x180957546f7df527), W(0x9e339b4b71315d16), W(0x90560c28a956bb12),
+     W(0x2becea60d42eee8d), W(0x82aeb9a750632653), W(0xed34353edfa5cd6a)},
+    0
+  },
+  {
+    {W(0x8273db992d189057), W(0x4d1b05fce1b5f8cc), W(0x5fec7c830a7c32d1),
+     W(0x28ddaf28ea9b4d45), W(0xb6bb62aca2fc58be), W(0xfc65b7aa4a41852d)},
+    {W(0x6e7651941c9e6045), W(0x3acabf28fc116257), W(0xc9d5e8054b5a4ba8),
+     W(0x9a072259cbdcf1eb), W(0xc67cf643439fc8fc), W(0x917ef6f8b4333aa8)},
+    0
+  },
+  {
+    {W(0x82154d2c91aecce4), W(0x312c60705041887f), W(0xecf589f3fb9fbd71),
+     W(0x67660a7db524bde4), W(0xe99b029d724acf23), W(0xdf06e4af6d1cd891)},
+    {W(0x07806cb580ee304d), W(0x0c70bb9f7443a8f8), W(0x01ec341408b0830a),
+     W(0xfd7b63c35a81510b), W(0xe90a0a39453b5f93), W(0xab700f8f9bc71725)},
+    0
+  },
+  {
+    {W(0x311ebba2fc37efed), W(0x8a6a42d660cfd6bc), W(0xb4051b3af2a4871e),
+     W(0x66ce77b8c2f0ebf0), W(0x84abc9480ad28477), W(0xc82e5c6263d9d11a)},
+    {W(0x99ffc70c007dcf93), W(0x5e974edfd964c822), W(0x0fee3572513085e3),
+     W(0xbe67a88046ce8444), W(0x136ceeb806d17129), W(0x0da512ae662d86fd)},
+    0
+  },
+  {
+    {W(0x9401aec2b9f00793), W(0x064ec4f4b997f0bf), W(0xdc0cc1fd849240c8),
+     W(0x39a75f37b6e92d72), W(0xaa43ca5d0224a4ab), W(0x9c4d632554614c47)},
+    {W(0x1767366fc6709da3), W(0xa6b482d123479232), W(0x54dc6ddc84d63e85),
+     W(0x0accb5adc99d3b9e), W(0x211716bbe8aa3abf), W(0xd0fe25ad69ec6406)},
+    0
+  },
+  {
+    {W(0xe7acaa8457e0105d), W(0x3c06d3bd3851fd57), W(0x23cf3c612a9c631b),
+     W(0x13888aaa33863bf8), W(0xf2396355717783ee), W(0xf21e1a4836b300e1)},
+    {W(0xa734cb3b9d27b4cb), W(0x0a7effed796e34b6), W(0xfc5864773615cc7a),
+     W(0x1f98ed7788844a21), W(0xd6e289407ad4c7bd), W(0xa00d64ebe9331c7e)},
+    0
+  },
+  {
+    {W(0x0d5c1769df85c705), W(0x7086c93da409dcd1), W(0x9710839d0e8d75d8),
+     W(0x17b7db75ebdd4177), W(0xaf69eb58f649a809), W(0x6ef19ea28a84e220)},
+    {W(0x36eb5c6665c278b2), W(0xd2a1512881ea9d65), W(0x4fcba840769300ad),
+     W(0xc2052ccdc8e536e5), W(0x9caee014ac263b8f), W(0x56f7ed7af9239663)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x17e3d0b8713b8541), W(0xf372b048c6b5e839), W(0xf8ef0261d0bb1848),
+     W(0x9b804ceec71a3bbe), W(0x00b7d171542a88ae), W(0xf2b8ed10e9097b9e)},
+    {W(0xdbad9f122c0a009a), W(0x245fc1e9205fb1bf), W(0xa8a4834fb83debf5),
+     W(0xc3ee226d637e449b), W(0xe3070d93cab82664), W(0x24b8094db37320e8)},
+    0
+  },
+  {
+    {W(0xb506b7b925059699), W(0x349fd83f01ab02e5), W(0x64b729ad3789281e),
+     W(0x69ae8f81f9af4561), W(0x007befe156f91860), W(0xb578c566edc250fb)},
+    {W(0x1c16d75a67ae4801), W(0x04c35a7ea1d3f592), W(0x5dc97da936881f89),
+     W(0xaddb603103a5b1ea), W(0x7eb515b13e153a0f), W(0xdc3a92192b4a1ee2)},
+    0
+  },
+  {
+    {W(0xe6b739c70e14f1a9), W(0x2dabd7c1f07f9416), W(0x14e33acc1b4b4549),
+     W(0xd6704b28f6bad44a), W(0x43cd7e5ddf020972), W(0x06f924bee0d6c335)},
+    {W(0x7d395c3f5b2dae43), W(0x0f893f1ca864c77d), W(0xb6269f21efe4a575),
+     W(0x3f97b374f55ea727), W(0xb689b4de42450c82), W(0x648501394f5ae5d5)},
+    0
+  },
+  {
+    {W(0xe7365f9e512cc92a), W(0x9efdcf8b5172a654), W(0xbfb389ac8e611fc3),
+     W(0xce778fd5699c227d), W(0xdc1f47b63ff2ef17), W(0x2ae0f68302672ed4)},
+    {W(0x51c63806a8e879cb), W(0xd3dfecf03909f526), W(0x375b3d13e00e12a2),
+     W(0x91f9f750bf8df325), W(0xf1ea0e421df5f21a), W(0xaed73e7f32c60584)},
+    0
+  },
+  {
+    {W(0x6d7200511029bee3), W(0x9823fd590ab323fc), W(0x5d1daee6f1c89ce3),
+     W(0x3f7644bb57b2b79d), W(0xb1063f92fcc7ce82), W(0x385d54a6c15a9b0b)},
+    {W(0x65661a5375c1c71e), W(0x853952e517b8b4ec), W(0x0661dc5d42ecede5),
+     W(0xbe586cac8eb0689e), W(0xc86641a02dd7ff77), W(0xe4ed0e8cb9ef4c3b)},
+    0
+  },
+  {
+    {W(0x03b07fb5e0728e6d), W(0x9e0469201012234e), W(0x272e644935637644),
+     W(0x2b6ad1c2a55bcadf), W(0x86c527765c71c6af), W(0xa25bd60bc1678806)},
+    {W(0x0cae829476bb32f8), W(0x389ce4e633e03cb2), W(0x504df8337513dfb6),
+     W(0x4260ee8e1b351dda), W(0xa473c5d9dbaf7cd0), W(0x22cb7cb471e390fd)},
+    0
+  },
+  {
+    {W(0x17544e9882b2820b), W(0xcb9a6aba6fea899a), W(0xe1460e3937af8cf7),
+     W(0x8b4aa2f9a2f308e2), W(0xafa2bdbc3a5060e9), W(0xf8d5e928f84dda7d)},
+    {W(0x3b256b5632d7c0a0), W(0xe218b5b225912248), W(0xc40510d13c8e52ef),
+     W(0x62c1542b38865772), W(0x4755de7ebf416f10), W(0x84232a8d97aa2eb5)},
+    0
+  },
+  {
+    {W(0x1d9aa9fa26caebd8), W(0x6b64686926b7a673), W(0x7ebed6a17f167b47),
+     W(0x324c13f85bd9153d), W(0xe9ea5b734c682ba6), W(0x2961da7d7e3ff6e2)},
+    {W(0x1ed2b05001a83dad), W(0xb232951dc4a2f60a), W(0xafcea5d3d68b8ec6),
+     W(0x21dc058d1c6ce0d2), W(0x0043de75e719410c), W(0x4edd792ce15cf534)},
+    0
+  },
+  {
+    {W(0x26072f610434e9ea), W(0x9367de1cde8417eb), W(0x91d6db0e89f6fa79),
+     W(0x7279490130d32a51), W(0x559c6fe33ee53dbc), W(0xc2f537d77c722809)},
+    {W(0xa07494bc2e58111f), W(0x8d8b7c86ae97ff66), W(0x2ea172507ba02f90),
+     W(0x144e13faf7ac5db3), W(0x60d1f9f0393e9a4a), W(0x1d8ed4b7553bc3e6)},
+    0
+  },
+  {
+    {W(0x0f45245f3babe09e), W(0x0959326fa9f2fac5), W(0x7629e7fb5cc136e5),
+     W(0x208bd5a6e48b7eb0), W(0x637891d6b75a85cb), W(0xf0ad9d8d9f27b57e)},
+    {W(0x437b6944e0454b05), W(0x022c51d702ed3592), W(0x0f79e2bd0dc0a769),
+     W(0x54ace1fdd9b81f9b), W(0x38611d66f95ea8dc), W(0x52443ca8f0e6147b)},
+    0
+  },
+  {
+    {W(0x050dd0c5a48723d3), W(0x6b656d2cd369c1d9), W(0x33b962016f01689e),
+     W(0xf2b34b3145c24571), W(0x76120d64cc1b7024), W(0x6c8b7f79e852648f)},
+    {W(0x2f4860cdcc03ca37), W(0x272934bb972efe35), W(0x62c746746ac46d4d),
+     W(0x261d28975c40e14e), W(0xdf63c827485e1f4f), W(0x062958430c33ddb5)},
+    0
+  },
+  {
+    {W(0x857d68558bc272d0), W(0x4583eeeeb5be2485), W(0xb83586dafe0152ec),
+     W(0x8b0eb223e830294a), W(0x757582b6a5b0e880), W(0x5140c0169cca7fff)},
+    {W(0x07a00782e9228f12), W(0xb96e2b5dd4973080), W(0x3cceb9a6e88efbe6),
+     W(0x9955b63073fcdd25), W(0x04f26ab02805d470), W(0x90b38299424da086)},
+    0
+  },
+  {
+    {W(0xfc61c8e95cf2cab9), W(0x809aa86c6b800edd), W(0x183bcb73acc7f77f),
+     W(0xe22aaa12da961c78), W(0xabb55ceaa4420ffe), W(0x7729637ded953c62)},
+    {W(0x93eef1bea6eddf44), W(0x73a04bd081b6756b), W(0xf247b4add74f46a4),
+     W(0x3662523c60188f72), W(0x97ed83bcf1a21826), W(0x8ac3e5bfa27f6495)},
+    0
+  },
+  {
+    {W(0x73f1ae48f4f6c5b4), W(0xee5af13d4a477f01), W(0x274614a2ddb93d52),
+     W(0x90b0c563c320aaf5), W(0xee2303c8ef990b0b), W(0x00d028e73061f140)},
+    {W(0xff705011cb3d8eaf), W(0xae1d990862594f4c), W(0x22a27cecdafea438),
+     W(0xa78e12d5c5962ea9), W(0x5bbe9d878e65f9cf), W(0xa222580cf47cefa6)},
+    0
+  },
+  {
+    {W(0x2c8cf2ef5e2818c8), W(0xc08f5f370141b503), W(0xa189dd566404691d),
+     W(0x91157ae9edefc1ad), W(0xf8259d81a53eea1f), W(0x66208f8f0f7f5154)},
+    {W(0x4359ba776737cc70), W(0x6eb1a1673a5cf8df), W(0x6ac925abc21b6c74),
+     W(0x53c6e9c014854bef), W(0xc3591aaba1546325), W(0x6513900466f3ecff)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf7aaa732959abb9e), W(0x1222ad0a2ebf80b9), W(0xa1a417372e0c286e),
+     W(0x3b6685025da3472d), W(0xbc0d116b7576f2a2), W(0xfdbcad95a36a27d4)},
+    {W(0xcdb3f4749d54f7ee), W(0xe2e0f5f98a5643a3), W(0xc70d11b969d4f171),
+     W(0xdf96d1366cca4ef7), W(0x570693db2fc6afdf), W(0x5059e67b567504da)},
+    0
+  },
+  {
+    {W(0x02c6b6083b03dcbc), W(0x2b20149e3b9d868a), W(0xaf5ab01d4f57eb0c),
+     W(0x59935b94d750e515), W(0x32721b408f89ad68), W(0x673bd755a7e3ceff)},
+    {W(0xbd462fd8ef3b3393), W(0x991422640e59a120), W(0x4162da619263fa61),
+     W(0x2ed1f2deb6488eb3), W(0xb0bd37a8725680c4), W(0x17218bf029ec27b0)},
+    0
+  },
+  {
+    {W(0x170f8a74e7aba263), W(0x6b4e1d7b986b151a), W(0x5f65bd224b08921a),
+     W(0x1017ae3de6caca3a), W(0x613f36b626cb9d5b), W(0x8a1e2f2ded19d99b)},
+    {W(0x52c915a5c3c519c2), W(0x3c9a33305902fa08), W(0x2cd7f7c206a51a12),
+     W(0xfed60db66e0197ce), W(0x4e5b2bb7d971b04c), W(0xebebeebf2f45ab13)},
+    0
+  },
+  {
+    {W(0xfb09e7564bd044ef), W(0xdbc9fcdfbb964fb3), W(0x451c5b01cdb1f4f5),
+     W(0xb02f9068f1dd1cf0), W(0xd4765e7c0c687e41), W(0x89b64981d1967bd3)},
+    {W(0x06a0e4ecf0439d65), W(0x564c387da5abbcec), W(0xc1e9d01ac651d806),
+     W(0x5e6ebd830618a96c), W(0x9ce1aacec54ad8ce), W(0xe5248a089953f90f)},
+    0
+  },
+  {
+    {W(0xfa4b6697a8352657), W(0xf5696452cad6ec30), W(0x10aaba60986c84ff),
+     W(0x49bdfff4dae014e1), W(0xe2a810bd0abc0e46), W(0x1dc5b81462d1dd5f)},
+    {W(0x15d2f2c723bb4561), W(0x5ac7b6421818e30c), W(0x40c6b6f94c545f5b),
+     W(0x5875b6b2f99241e8), W(0xfa3e88a9d6708293), W(0x1c936920ad6d9344)},
+    0
+  },
+  {
+    {W(0xa8d7901c7c16c09b), W(0x628ff3be42e1948b), W(0xb905d7c504e4bce1),
+     W(0xdfbf9c4e5ab0696f), W(0x0f4e6e2ab6db9cd5), W(0x4857e570482e40fe)},
+    {W(0x5ccd9b421c3beed4), W(0x171b085fae51a947), W(0xcebe0dbe59065754),
+     W(0x4d052d3a461c1620), W(0x396bac422fe541a7), W(0x8e714cdb70bf32d8)},
+    0
+  },
+  {
+    {W(0x03c88a8566d2ee47), W(0xee8e5c34455ee428), W(0xd90a3d393870d90e),
+     W(0x2fd78d14f2fdb976), W(0x9472a6066a312a30), W(0xea68e2283484af2f)},
+    {W(0x7cf25951ac9e5cf2), W(0x024f07ee37a28e95), W(0x5d479379e563a2bd),
+     W(0xe87b50a4b46e93d8), W(0x9128fc11f137285c), W(0xe46efdf77c67d7e6)},
+    0
+  },
+  {
+    {W(0xda2b0725bb296c27), W(0x1f22ffa4d341171b), W(0xc721e35a5b132756),
+     W(0xe5695e84fadb6907), W(0xbc5a3bf4c283f546), W(0x9182cb3edde128ae)},
+    {W(0x179c7fa66592e05e), W(0x1e604790f38e8586), W(0xaf7e83bea16bad55),
+     W(0x6f41231e9137ecd8), W(0xac87543d8f30d1ab), W(0x630a9d87b1ee0ee8)},
+    0
+  },
+  {
+    {W(0x2a64506fd4e8e49d), W(0x3625bd2440254b07), W(0xa13df5aa9ae61c67),
+     W(0x9054570c7bcdc0d3), W(0xa201084ee174d5d5), W(0x464b6cda2330b0ba)},
+    {W(0xc92e46a857b03524), W(0xa008a28183d0de55), W(0xc8e141ab34cf7125),
+     W(0x6af385eb8a68c966), W(0x5b2e4deffc3a932e), W(0x6a0ff4e9cde4b675)},
+    0
+  },
+  {
+    {W(0x6adb6d54ae326dfb), W(0xbadf77920cb25ab8), W(0x5e687e0b9af51ca0),
+     W(0xf910db02b2bd3e14), W(0x0589e194d66a35c6), W(0x1ee8cb6093870751)},
+    {W(0x6dd344d9c2579fb8), W(0x4f441d7919deaf25), W(0xe72064b243bc0e2e),
+     W(0x16153751caf0121c), W(0xbf4e611f1a34aaef), W(0x4ed947311749dd7d)},
+    0
+  },
+  {
+    {W(0xc67e421d3b2abbf6), W(0x22d7e4bbf4529f60), W(0xbb5db8cb37b679c8),
+     W(0xc24a35fce53fd47f), W(0x53d23aa75b5f6f9d), W(0x6828ff1addb8b466)},
+    {W(0xfd4763a4a71b0309), W(0x4727eb612407c77c), W(0xc333843cb5f3f282),
+     W(0x9ae2ae7be7d4e10b), W(0xd9c95842a46743fd), W(0xef2abd5bd8743134)},
+    0
+  },
+  {
+    {W(0xd8ccf5500850b471), W(0xea8f73d2f7ebfcd8), W(0xfb374f997f138136),
+     W(0x6b3a1ab86cd70e73), W(0xc4577c1342f40008), W(0xb23800f9a0517e75)},
+    {W(0x79deaa457088a19b), W(0xa8410f51702183ed), W(0xe2761fa12c9f6594),
+     W(0xed1d011252868276), W(0x9e9805d7c22157a4), W(0xbe4aa213ac7653e9)},
+    0
+  },
+  {
+    {W(0x5cb75e4acfd9b2be), W(0xf3fbaf1396fd790b), W(0xe8d74c7927618c3e),
+     W(0x4be88b91de489e11), W(0xebca8f25cb150785), W(0xe40af7c5a23a69b0)},
+    {W(0xe358987cc1698215), W(0xe1816ef67082e069), W(0x0af3e7fabf305ef9),
+     W(0x4d80242699149abb), W(0xccda621a63d938d4), W(0xc9cb8926e1de03cf)},
+    0
+  },
+  {
+    {W(0x83cb9eee338f4b49), W(0x592d4c1a32e88a54), W(0xa96953caa3b8cc66),
+     W(0x67395e46e222e2b2), W(0x09aaf73c179fe75b), W(0x39aaf720e39cc21d)},
+    {W(0x945d69d102ad0540), W(0x1486990ac4fa45ac), W(0xc04149ecc2be9d9a),
+     W(0x0aba169ea15f9a46), W(0xe5c595f9341be304), W(0xba09e4e5636d9916)},
+    0
+  },
+  {
+    {W(0xa909706ae5b95b2a), W(0x237255bd6f5369c5), W(0xdbaaa839c7dd5cd6),
+     W(0xb9c5b314e8290bbc), W(0xf819073bb68b8fa1), W(0xeccbf5500edb8d52)},
+    {W(0xca26a506414d3fa5), W(0x483c19ce399d76d4), W(0xd3dd7a32b1df04b5),
+     W(0x978ddf8e45a22a24), W(0x5f2078083b6e650a), W(0x42ef7dfdd1759a68)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x359cbfa05e4f1914), W(0x6992cd48d922176a), W(0x2fd5e90f630cbcb5),
+     W(0x2b0f61306ddbf238), W(0x5070970a3af753e6), W(0x433d009441727016)},
+    {W(0x2eb15b3b9dca97e2), W(0x3a7379cd00d96875), W(0x0d4374aee930a75c),
+     W(0x3cd36046849e7727), W(0x9ac3117e336a19ff), W(0x2d1373c9433ddc04)},
+    0
+  },
+  {
+    {W(0x985dcb43e4362d67), W(0xecb860c2a939bea4), W(0x40597f3055fbf1d5),
+     W(0xb6d166bf43fcd98a), W(0x5932570915ec99ca), W(0xe05ae3b9c5bdd370)},
+    {W(0xc18f78270c7b943b), W(0x84bde9c64dd572cc), W(0x5d50a89df478e56b),
+     W(0x242c2f4864d29053), W(0xcda12c6161cf7e0e), W(0xf8b6890eac8d1d40)},
+    0
+  },
+  {
+    {W(0x7a9a9dd7b6b11af8), W(0xac4c50dd16a42f8f), W(0x1550267b6726c324),
+     W(0x12cfb2fd7f841afb), W(0xa41b19052f046430), W(0x8f5f5373b7d786cb)},
+    {W(0x7b61b39c729e09fb), W(0x07a5415f2626da4c), W(0x65d6efb84a348905),
+     W(0xf377862cf2e864b9), W(0x3c94000dab96cdb2), W(0x2176321a8efef0f6)},
+    0
+  },
+  {
+    {W(0x8c558000c1c1bc68), W(0x9e48a67a83fd6ca6), W(0xacf0d75ceb7a35cb),
+     W(0x0fbdce4cf0a93110), W(0x82b2d13a9cc50c85), W(0x696fd259cef70d6f)},
+    {W(0x1cc9be2e457b88c2), W(0x0d58b34b1f04c0bc), W(0x52bd479f195a532b),
+     W(0x769fe6ca1ab3605c), W(0xba6a63e48a24c1e0), W(0x86dea46299da5d7a)},
+    0
+  },
+  {
+    {W(0xdf2a6cecd24790f3), W(0x37bfbba7b87ca06d), W(0x7c8a7e4c0de8a6aa),
+     W(0x5c806b94be7b8f5d), W(0xccca1c714fda3e7e), W(0x3c1cbaf9cff788e5)},
+    {W(0x17a081a9565d0464), W(0xc4eb995713ed1b82), W(0x0d7c90549e4cfac7),
+     W(0x6fb74c629d53a200), W(0x65b9ed6d5f977a8b), W(0xe2279cec0ba2e7c4)},
+    0
+  },
+  {
+    {W(0x8435e2962d4412dc), W(0xa36cbfef972350d8), W(0xe2fe6e6fece5cb15),
+     W(0x6f249b095336f7ff), W(0x5801feb9908ee267), W(0x7649a837fc8f217b)},
+    {W(0xfc1adc3ea0ebc808), W(0x1ef06bec94f08075), W(0x4afb5404cc1d9b72),
+     W(0x75cabd61a1f2c5a4), W(0x2bd797e1cd08f195), W(0x4f1b5cdecbea0f49)},
+    0
+  },
+  {
+    {W(0xe9759aa9e7aa87e2), W(0x2d54a5fbe5909f55), W(0xe49a59aa2c80bb61),
+     W(0xdb89e21230c9b328), W(0xf42b9adb004ebffc), W(0x4471b983479678e4)},
+    {W(0x0dde5b0e97709e2d), W(0x2f35c653a12bdb85), W(0x9f8d7a5cd8c8285c),
+     W(0xd7cde5971d156206), W(0xdbe765d7a8e126bc), W(0x2e645b6de3f4e60b)},
+    0
+  },
+  {
+    {W(0x509abccb65682820), W(0xfbfa1d094ff86137), W(0x1ae371bd640bc2f6),
+     W(0xa155c2978f546c68), W(0x8858cadcc08b8cbf), W(0xafac5b0a1d96948b)},
+    {W(0x919cb22682e25016), W(0xd147df4ab064ffc3), W(0x25dd0f1ab4abe560),
+     W(0xc6bbe6369cb75bd1), W(0xbb367cf947a778e4), W(0x5714aa4dbde524b3)},
+    0
+  },
+  {
+    {W(0xce3c8218e61b1439), W(0x8be5a9cb67f79d28), W(0xb1bd1386d5164b35),
+     W(0x0bc24d96b9adbac7), W(0xbcee4f0ec7482414), W(0xac15b5b66ca5d49d)},
+    {W(0x79caa999f20f9a50), W(0x89bfd652a911308c), W(0x972fe26d15245a7d),
+     W(0xd44d0f6e1d0d2939), W(0x6749beaedd439057), W(0x02627a6ad4b6f416)},
+    0
+  },
+  {
+    {W(0x7e882e8cb437b791), W(0x9afde25afbe334cf), W(0x60184381da52f9fb),
+     W(0x935d33a1001df73c), W(0x38f303df080682e5), W(0xd9cf2c1f4e9a29b2)},
+    {W(0x889d265e00d9208e), W(0xfc1cc2221fd8e817), W(0xdd14f1a2ec71428a),
+     W(0xe81cc4f9d9e973aa), W(0x26a154963696468c), W(0x0620fe6409d546ac)},
+    0
+  },
+  {
+    {W(0x06ed3e64166be92f), W(0xe1da6e27c51ea53e), W(0x784f2514acb2b245),
+     W(0xc544e50f8e24077f), W(0xad449938c5c01787), W(0x5d9ef8d527d41dd7)},
+    {W(0x37114064e15d4a96), W(0x7f0c92aa1dd45321), W(0xc1f11d56b9c72ee5),
+     W(0x91f3b3f7a78e6d3a), W(0x0cf440b0c9488cf7), W(0x14d3defd93df403a)},
+    0
+  },
+  {
+    {W(0x3fa4ea0225aa1d44), W(0x22c68e17f74a6a3a), W(0x351bcb80f489e72d),
+     W(0xdabdf118be0268ed), W(0xa3bf9e1984d2cd16), W(0x318506a2d67393a4)},
+    {W(0xb0c6b2d8615ed517), W(0x42ac507c3dcba0f9), W(0x60570dfb51235e30),
+     W(0xc677628dedb033e4), W(0x0290c22766e61f76), W(0x1d8450d09888943f)},
+    0
+  },
+  {
+    {W(0x1b8f5ed7155a3dae), W(0xc9d2433aa46ed72b), W(0xe99c7fe38ca361fb),
+     W(0x606b08c19626fe7b), W(0xe6447257c0ea792a), W(0x5839e2c62e1156f3)},
+    {W(0xb73135dd5eab6d41), W(0x200f2e488ef63584), W(0x4c73885ddda1c49e),
+     W(0x8d606a75b5428ee9), W(0x2a73cc7aa62699dc), W(0x484a58941c6c8de5)},
+    0
+  },
+  {
+    {W(0x2365b4150decae0c), W(0x9c8567ece8583741), W(0x35d6cfae6d8842a7),
+     W(0x4e6c98e6dd0db8e4), W(0x584524e767b34d02), W(0x786ea52f554c6117)},
+    {W(0x8952ce169320725f), W(0x8eb7f91854c4c8f2), W(0xdd34f77afc799251),
+     W(0x76b8c3173e05d37f), W(0x664cbddcebb4d365), W(0x31ba98b90dfa1a98)},
+    0
+  },
+  {
+    {W(0xf113a7bd651c186f), W(0x417bd7373737a50a), W(0xddb40d201b858249),
+     W(0x62a60745345f5b45), W(0xf0a03f5c2d4e221e), W(0xcafde67cc64621a2)},
+    {W(0xbbbfaebcbc3c06c3), W(0xadaf9a16b8383dc0), W(0xcd21aa308f343ea2),
+     W(0x64cefec0d890128d), W(0x2ed9b8f763b44054), W(0xc0a49e2917c0ffcf)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc6307399166915df), W(0xb35545bc5da8a26e), W(0x8e0126aae3a99321),
+     W(0x0fbfdf76da9308d1), W(0x2163ed6b6168e505), W(0x71f3d0087500d8bd)},
+    {W(0xf57159605ac13f65), W(0xc1cd9a6755172d5b), W(0x6b225f7e53d84c65),
+     W(0x9c031269025029da), W(0x54c1edfa17d89aed), W(0x5b0238786b435150)},
+    0
+  },
+  {
+    {W(0x009ef80aae238fa1), W(0xb41d9b24486af6b5), W(0xab4455ed685add95),
+     W(0x18f323f672c7dac8), W(0xe7009790e372f168), W(0x4d5bcba6067bea99)},
+    {W(0xf15bdbcc51a2a9a9), W(0xde7e4f742fac9169), W(0x2fd62c304bdbec36),
+     W(0x8b3ea93d1b3ac6c7), W(0xce1c8e5c9c293889), W(0x19664dda11564f8b)},
+    0
+  },
+  {
+    {W(0x77faac22bd366155), W(0x13cc4038282f11b5), W(0x31ad1dd45fbd35ab),
+     W(0x7e0de9da45d6d40e), W(0xa16c5f1939749ef6), W(0x761cd6cf85691cf2)},
+    {W(0x156536ad4d59b802), W(0xee98dc4187c4b11d), W(0x165a1eacd35088fc),
+     W(0xce8a733538fb995c), W(0x34d0d3313293b3a5), W(0xfcf548ca8b570e79)},
+    0
+  },
+  {
+    {W(0x6a3a23279af0a75c), W(0xf832a8159f1f250d), W(0x17030c3322a82d3f),
+     W(0x24bf18ea14cbc835), W(0x319dc4cab2da2727), W(0x481df3606d020d4a)},
+    {W(0xaeebdd8a7fc22ba5), W(0xbd0515c6a91e28ab), W(0xfc8a2978595f361d),
+     W(0xe60dd96c1ae8fa3c), W(0x19c2109aa5341575), W(0xfd6e92bb06a0ee48)},
+    0
+  },
+  {
+    {W(0x443deaab03c87a20), W(0x57dbd224bb817740), W(0xf88918ded51d6acd),
+     W(0x48c9b2f17d4ec9be), W(0x78b41104dfc48a69), W(0x44a8144378827f54)},
+    {W(0x74ed794916a22495), W(0x6b9e9128ea92d3e6), W(0x6fe6449b0d9fe252),
+     W(0x31743d06c14e825a), W(0xd9d4ad8c08690f00), W(0x562e2f600e65f748)},
+    0
+  },
+  {
+    {W(0x92501ff88b7f8cb2), W(0xcdaa6c93578a4cfd), W(0x95b99a05e5303846),
+     W(0x30a72fdc2543d1a9), W(0x6648126b11808771), W(0x6980dd99eefb8145)},
+    {W(0xd9a87f83f1949aad), W(0x3b4f208df7b8ab95), W(0x3341e118c40122e4),
+     W(0xe513567f853b291e), W(0xd4f1bbb73b565bad), W(0x86207b43a7658f77)},
+    0
+  },
+  {
+    {W(0xbab37a639bece059), W(0x5a60ec877fa28fc3), W(0x69e1086c1d4a8f5b),
+     W(0x3a87384465814282), W(0xb642dc162676cc7d), W(0x8d152bb997e423a0)},
+    {W(0x66ac1b37160ff40b), W(0x7410ba67f657547a), W(0x8f47debbadcc6823),
+     W(0x44e9bf64b1536fa1), W(0x1cfdd504939e5461), W(0xba5729e143bb3b90)},
+    0
+  },
+  {
+    {W(0x2e32f896cde5e785), W(0xcd55ae7ab9db8f31), W(0x278db1ad8f832885),
+     W(0x271d9078adcbd933), W(0x2208fae34a64f863), W(0x974046e039c89365)},
+    {W(0xcb46f272b3cd0cd3), W(0x31f34e1a74e59edc), W(0x3421d316edd50418),
+     W(0xb1d8a064cabe36ed), W(0xdb13e560362efcda), W(0x567c2b6cc71eb3ee)},
+    0
+  },
+  {
+    {W(0x94a765bdf2344408), W(0x3705e9bb00bfc07a), W(0x2402d42ee297ce90),
+     W(0x682488ef1dc35441), W(0x55a6c2601d55361f), W(0xb1ba4f57ec342517)},
+    {W(0x56a030e165c1a390), W(0xa30474903940353a), W(0xe694e3077d0f48d7),
+     W(0x01531eff0c33de74), W(0x58baafa0b1289871), W(0x69b8ca4f4fd806a8)},
+    0
+  },
+  {
+    {W(0x89d1d96e21f11b87), W(0x0ef3953a94f0e06f), W(0x218b1918e96c1061),
+     W(0x968db8c43f2c2f87), W(0x64c1dc4abcf5a5ad), W(0xc43fbb851ee6854f)},
+    {W(0x6cac68c371b67ee0), W(0x7d1fff9f918b8f9c), W(0x9caf5c53bf47edd4),
+     W(0xccb42489bffbea53), W(0xcc350f10659aa2cb), W(0x13dfeb5cd86e58f0)},
+    0
+  },
+  {
+    {W(0xf20e59c446e62272), W(0x792a0db904322a9a), W(0x50c3416ce65b9668),
+     W(0x57bbf1dc04eb6159), W(0x0b9dea3306d3b039), W(0xd5dc64bf7bd9dace)},
+    {W(0xe9df4db1c1f40965), W(0x7bc1eac0d080953e), W(0xc677766cb95b11e2),
+     W(0xd5064c7e85b15c50), W(0x16806a89790ba72d), W(0xc0c159d055cbc9a2)},
+    0
+  },
+  {
+    {W(0x7bbd65e76823329b), W(0x16d8cf8c3e49382e), W(0xe6d5eaca90594580),
+     W(0x1b5ab73de209e692), W(0xc3107eed0608e4c4), W(0xc1a94325f77ea8a5)},
+    {W(0xb44eed7592c39d45), W(0x1b1963e6d1586e57), W(0x52568e1fdce96afd),
+     W(0x31d36619b9bfe2ec), W(0xfb490fb8feaa7152), W(0x4907f154de5d0585)},
+    0
+  },
+  {
+    {W(0x785b8012367dae6a), W(0x2fa3658816cbcc7b), W(0x6e14747c43e19364),
+     W(0x81c3acda17c1a5c8), W(0x8a16326614f6f403), W(0x2ef9731cd7d25766)},
+    {W(0x9c66591645f8f2cd), W(0x5626c2e9eaea2718), W(0xab1a638b73c842fd),
+     W(0x982c04ef752de411), W(0x015b1d4c04164055), W(0x9121023700466671)},
+    0
+  },
+  {
+    {W(0xabb14d0ad586f6ce), W(0x1614a226be18d91b), W(0x7389cbf8bdba8633),
+     W(0x9ecb4458f2c3e129), W(0x96ed33d189bb7143), W(0x67f8938746a62063)},
+    {W(0xef4fe2b931f25e39), W(0x83efef5453014d63), W(0x82b0da76a26120bb),
+     W(0x3ae5ad69d8a572e5), W(0x998cead31ce3534b), W(0xee1e8adf130b0e1a)},
+    0
+  },
+  {
+    {W(0x4c93a9caf4b19994), W(0x393aecafb00679ec), W(0x0d1994362506fbcc),
+     W(0x545b35baad80bb5f), W(0xb77841845534bc54), W(0x2c303d5755a56c60)},
+    {W(0xabf9c659d5962dca), W(0x2bf92ab114a8ff8c), W(0x04db83bfb79532b9),
+     W(0x270d369b4cc25f97), W(0x99f363562dd10a6f), W(0x5b91453707f623fd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x2af8ed8170d4d7bc), W(0xabc3e15fb632435c), W(0x4c0e726f78219356),
+     W(0x8c1962a1b87254c4), W(0x30796a71c9e7691a), W(0xd453ef19a75a12ee)},
+    {W(0x535f42c213ae4964), W(0x86831c3c0da9586a), W(0xb7f1ef35e39a7a58),
+     W(0xa2789ae2d459b91a), W(0xeadbca7f02fd429d), W(0x94f215d465290f57)},
+    0
+  },
+  {
+    {W(0xc08550024b950889), W(0xee99dbfe8ce24da0), W(0xdda71d964318e860),
+     W(0x01d3d39604fe9b85), W(0xda4bc065e25e7e20), W(0xd3a50b87e076c81c)},
+    {W(0x5b9f821931e5f494), W(0x6a140527a6a1b821), W(0xf52683e4d8dd159b),
+     W(0xca9c888720b18043), W(0x73c040fa08a0d8f5), W(0x92e482e8179525c4)},
+    0
+  },
+  {
+    {W(0x37ed2be51cfb79ac), W(0x801946f3e7af84c3), W(0xb061ad8ae77c2f00),
+     W(0xe87e1a9a44de16a8), W(0xdf4f57c87ee490ff), W(0x4e793b49005993ed)},
+    {W(0xe1036387bccb593f), W(0xf174941195e09b80), W(0x59cb20d15ab42f91),
+     W(0xa738a18dac0ff033), W(0xda501a2e2ac1e7f4), W(0x1b67eda084d8a6e0)},
+    0
+  },
+  {
+    {W(0x3a828904a4d2313e), W(0xbf4946b192e66888), W(0xc574898ae5fa19d2),
+     W(0x0b13dbb65e1c5fa4), W(0xf11343ba7c390fc2), W(0x35b1418fd7d32187)},
+    {W(0xc92cb1bb83e7fe7b), W(0x0b969455d78365c4), W(0xda69dfe5672f2af7),
+     W(0x9c62d7b430932441), W(0x165672ad94af02d6), W(0xd2cc734dcde81c22)},
+    0
+  },
+  {
+    {W(0x1d27efce1080e90b), W(0xa28152463fd01dc6), W(0x99a3fb83caa26d18),
+     W(0xd27e6133b82babbe), W(0x61030dfdd783dd60), W(0x295a291373c78cb8)},
+    {W(0x8707a2cf68be6a92), W(0xc9c2fb98eeb3474a), W(0x7c3fd412a2b176b8),
+     W(0xd5b52e2fc7202101), W(0x24a63030f0a6d536), W(0x05842de304648ec0)},
+    0
+  },
+  {
+    {W(0xd45e350133f4d416), W(0xbb40233a4bf9131e), W(0x1532a088e302483a),
+     W(0x3475e8b82c2485c0), W(0x08f9ea56969cdbe6), W(0x31928645253cd738)},
+    {W(0x1cf323a4ac9836be), W(0xdf647ccf02b6e4de), W(0x9a31e84fc06f3d09),
+     W(0xd326b86e39efe6d9), W(0x77e3e1df14ac4dec), W(0xf2d5917af3e0c582)},
+    0
+  },
+  {
+    {W(0x67477cdc30577ac9), W(0x51dd9775244f92a8), W(0x31fd60b9917eec66),
+     W(0xacd95bd4d66c5c1d), W(0x2e0551f3bf9508ba), W(0x121168e1688cb243)},
+    {W(0x8c0397404540d230), W(0xc4ed3cf6009ecdf9), W(0x191825e144db62af),
+     W(0x3ee8acabc4a030da), W(0x8ab154a894081504), W(0x1fe09e4b486c9cd0)},
+    0
+  },
+  {
+    {W(0xe92b56c002cf37fd), W(0xa75bbcb0f71b34de), W(0x7754d0ef50f5c482),
+     W(0x850a9ef611fa89fe), W(0x97d74b1bba4ea7d8), W(0xfc757c25aab7ba2e)},
+    {W(0x06f30ab0f2a67fdd), W(0xb10aba1412e72af8), W(0x47580bca7a2e053d),
+     W(0x85795598dcf0e14c), W(0xc3596781d6f55310), W(0x8ab251b74c9b7e18)},
+    0
+  },
+  {
+    {W(0x512f82f9d113450b), W(0x5878c9012dbc9197), W(0xdb87412be13f355b),
+     W(0x0a0a4a9b935b8a5e), W(0x818587bdf25a5351), W(0xe807931031e3d9c7)},
+    {W(0x8b1d47c7611bc1b1), W(0x51722b5872a823f2), W(0x6f97ee8a53b36b3e),
+     W(0x6e085aac946dd453), W(0x2ec5057de65e6533), W(0xf82d9d714bb18801)},
+    0
+  },
+  {
+    {W(0x4ab138504dbb8798), W(0x0e7980d772d04cd2), W(0x1755c5660b3271c6),
+     W(0x8414efb09d9d1468), W(0x61a586301795ce66), W(0xb6a8b393232924a1)},
+    {W(0xa992f0ceae031bd6), W(0x6747fb5f2915acc1), W(0x03daa26693e9c0d2),
+     W(0xc18fa3645400d554), W(0xaf04ff8d9497e895), W(0x86c3cfc250b6b339)},
+    0
+  },
+  {
+    {W(0xad81fa938ba5aa8e), W(0x723e628e8f7aa69e), W(0x0ba7c2deef35937c),
+     W(0x83a43ec56decfb40), W(0xf520f849e60c4f2d), W(0x8260e8ae457e3b5e)},
+    {W(0x7ce874f0bf1d9ed7), W(0x5fde35537f1a5466), W(0x5a63777c0c162dbb),
+     W(0x0fd04f8cdad87289), W(0xca2d9e0e640761d5), W(0x4615cff838501adb)},
+    0
+  },
+  {
+    {W(0x376b2a7f04e1e6e3), W(0xea0dcb70a31774b4), W(0xfc7fe4cc5cbdec2e),
+     W(0x8568499df03f459e), W(0xe9fd8fb28b78900e), W(0xd33c6e30e431bf97)},
+    {W(0xd904b8f5c896e766), W(0xa8f577cf82748cef), W(0x93dd921b87e044b3),
+     W(0x23d79837f76eebe9), W(0x5e0a7493e569feeb), W(0xd0797549414dddb6)},
+    0
+  },
+  {
+    {W(0x9422789b110b4a25), W(0x5c26779f70ad8cc1), W(0x4ee6a748ec4f1e14),
+     W(0xfb584a0d5c7ab5e0), W(0xed1dcb0bfb21ee66), W(0xdbed1f0011c6863c)},
+    {W(0xd2969269b1b1d187), W(0xf7d0c3f2afe964e6), W(0xe05ee93f12bb865e),
+     W(0x1afb7beeed79118e), W(0x220af1380f0fe453), W(0x1463aa1a52782ab9)},
+    0
+  },
+  {
+    {W(0xfd9e3542bfe5b1a7), W(0xb42d2a4175938cea), W(0x74688a153befb760),
+     W(0x8daeeaa22e33dbe7), W(0xc9c1ea083e677801), W(0x68ecf4e434effe1e)},
+    {W(0x927700ccd294c321), W(0x9e2e723de940afc5), W(0xbcfac07a7cf6cd43),
+     W(0xa009ef94d1006bc3), W(0xa02016b0373d13e3), W(0x4e097adbabae5822)},
+    0
+  },
+  {
+    {W(0x7c139d56d7dbe5f9), W(0xfc16e6110b83685b), W(0xfa723c029018463c),
+     W(0xc472458c840bf5d7), W(0x4d8093590af07591), W(0x418d88303308dfd9)},
+    {W(0x9b381e040c365ae3), W(0x3780bf33f8190fd1), W(0x45397418dd03e854),
+     W(0xa95d030f4e51e491), W(0x87c8c686e3286cea), W(0x01c773bf900b5f83)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8db8b78cc898b8bc), W(0x686896da502940cd), W(0x67e50f022dde2e3c),
+     W(0x2e2461f38cbf406c), W(0x32182781e1f7ff60), W(0x26934b05e30e2688)},
+    {W(0x95adc204fc4494f6), W(0x4c7f30c5161b7499), W(0xd5caf060b7341737),
+     W(0xed93187fd128d46c), W(0x3f2819cb20fc1e04), W(0x48c4086f2b7f70a1)},
+    0
+  },
+  {
+    {W(0xd74d09c10ece13ae), W(0x5e59d9e057a6bd95), W(0xdb1ccfdce132b940),
+     W(0xa0e5309c843d3c66), W(0x1fbd03a5f9cb3ef4), W(0xcdc9ef0a00ea5177)},
+    {W(0x1ebf5a15cb784a6b), W(0xa67382af8a0d109a), W(0x3256c37aa0d34d15),
+     W(0xee40efa50fca43af), W(0xc299bbd4b9841bde), W(0x6df68f603bef4a0b)},
+    0
+  },
+  {
+    {W(0x5bbf8bfeb73f4a19), W(0xfa4b654ca6e6d126), W(0xabd2718bfd3fb74a),
+     W(0x03c015015a085196), W(0x147474dc4ddba2ea), W(0xe87d4c69eaa2c8bc)},
+    {W(0xbc3dc5c3c51d5bee), W(0x388b9f36351be1e1), W(0x0276e98325d34140),
+     W(0x9372694406fcbc8e), W(0x8c4b7f2ca324ebab), W(0xcbd2f4087dc3a50b)},
+    0
+  },
+  {
+    {W(0xe01295fdd9d7c50a), W(0xaf31b4ea67f8ef0d), W(0x2ec9689f9eaf8eb7),
+     W(0x327b96c5c622acc5), W(0xae918f81b2757f2a), W(0x74927d684fd6606e)},
+    {W(0x09bb7fce18574215), W(0xfea383bce8e68b72), W(0xdf2a6f125fb47511),
+     W(0xbe88faa18e399520), W(0x0166d57e3fb1c3a2), W(0x5907ef2fe525f81f)},
+    0
+  },
+  {
+    {W(0x0c64cec7195d6a4f), W(0x87bb5c51eee11a49), W(0xc27a43ae5a8027b0),
+     W(0x1c5729c7d0a7406a), W(0x445fc7d34e2bfeed), W(0xf5b85725809bc357)},
+    {W(0x0598626bc1fae7a4), W(0x1e173143b62b7ec2), W(0x21519b314294839a),
+     W(0x66282da93ab9bc66), W(0x84c422c25cab5974), W(0x577b04e171c0f12e)},
+    0
+  },
+  {
+    {W(0xf24fab9b57797e5c), W(0xd85009873add682c), W(0x75e370e733ac4fb5),
+     W(0xd8d61642c8a69765), W(0xf057f10a5e30aa0e), W(0xaf9530874f1e8637)},
+    {W(0x887f06b3701cd1a0), W(0xd7c6a9c68a200082), W(0x4319f7eb6e6483a0),
+     W(0x44f1aaff475d4bfd), W(0xa8ee73b50f811fc7), W(0xbb67bcdc82916f8b)},
+    0
+  },
+  {
+    {W(0x96495c1f0ae22ade), W(0xfeea50a587de9f82), W(0x6806c858fe6e84fe),
+     W(0x5c215e8b0b189be2), W(0xac61577e8058a768), W(0xb3371c1388e0d202)},
+    {W(0x70322e16e738b743), W(0x4f1ff7a829db3844), W(0x88631f014d701ab8),
+     W(0x889f10d4a61df25f), W(0xaffec5a9bbf6dbeb), W(0x9a53c49a934ee168)},
+    0
+  },
+  {
+    {W(0xdefe3a7b8a37f660), W(0x7898db8c858f5765), W(0x7366c26a73d1f9b4),
+     W(0x35d5d718237ae8b7), W(0x3efb20feb4478259), W(0xccd0fed7aa545ee3)},
+    {W(0x750edd05ed22d152), W(0x4f8020f9ee20d4c6), W(0x16e60f370a9e29dc),
+     W(0x9cf0a136bfbec7f6), W(0xb430a34b2e47e143), W(0x2e2560bbc6cdd1a9)},
+    0
+  },
+  {
+    {W(0x241133e8785271d9), W(0xc4d6c8e86bf185f6), W(0x0284ba5a342b0f9f),
+     W(0xcb21d023652ad0ee), W(0xfcc27da15b03c785), W(0xe6632375d6d95415)},
+    {W(0xa1eafc8f671bf593), W(0xc378aebde822b766), W(0xe80e9b8c7a11ea59),
+     W(0xc937e524a5f93b78), W(0xb256dc9c2f03982f), W(0x29739a199b9f10ef)},
+    0
+  },
+  {
+    {W(0x2cb5625c2a9af85a), W(0x9ba19601fea96b60), W(0x25dd6acad7549809),
+     W(0x9c02e6135b4c31e9), W(0x40c4baeae09dbb63), W(0x38455db7f49beece)},
+    {W(0xe9846d0d5b848716), W(0x9c63043dd2ebce35), W(0xedee8e86bc26a79e),
+     W(0x70c46f940869c85f), W(0x34b059347bc49e34), W(0x737fe693a80d7d8e)},
+    0
+  },
+  {
+    {W(0xf7c1de1bb4bc665d), W(0xd84ee259efe95e1e), W(0x249ee32f569c21fb),
+     W(0x5b3231c709a0406b), W(0xef3b65fcb2c30627), W(0x5b5f133770c0d9bf)},
+    {W(0x049c20aa86d1ce5b), W(0xb98829ee604b440a), W(0x0021aa4925e750a9),
+     W(0x0c4f5a0ffde73446), W(0x24ea05495eb08060), W(0x86d7ed18ac51a5af)},
+    0
+  },
+  {
+    {W(0x799352dae4161a65), W(0xe5cf7ad856253ce6), W(0xf606bf796de32775),
+     W(0xddc0f3a357fce8db), W(0x1075fc2316cf4a47), W(0x078f0e04b27c5ad8)},
+    {W(0x9fc477953f7100aa), W(0x3ac489254673ffa2), W(0xb8263f42f9cd8348),
+     W(0x5bdfde3068cc92d5), W(0x2250927b1ac37f9c), W(0x26ec8328b33da359)},
+    0
+  },
+  {
+    {W(0xdd0bf2bb346a3205), W(0x0e821244029b879a), W(0x670c3ef2e8797513),
+     W(0xe45e6b3f31517b42), W(0x4c8c9ab8cae6af8e), W(0x398c2ce08422ca2f)},
+    {W(0x47257c9a7b7f14f6), W(0xd92d417f682e2806), W(0x706932e4bdd26ea6),
+     W(0x5251165fb09f980b), W(0x9861a3021b46fd71), W(0x5eb77ee4d930f68a)},
+    0
+  },
+  {
+    {W(0x76923635236eaa28), W(0x5acc650b657d0640), W(0x2652ec7ec20a58ab),
+     W(0x93385f9f1a5459f9), W(0x45952d39306e2091), W(0xb31f5a4234cef2f2)},
+    {W(0x0d9b04841f3c055f), W(0x6c5ef8eeae3b1f4d), W(0xd3fdb464bd24becd),
+     W(0x49b11a10a2210148), W(0x73de28551472893a), W(0x99435b576ee531f7)},
+    0
+  },
+  {
+    {W(0x8ce640a81f762218), W(0x7bd10753b2c9bf89), W(0xc34d5ee93b45174a),
+     W(0x691c46dccbfcfc81), W(0x79544e2129b2001b), W(0x326f19adb4e85acc)},
+    {W(0xe109113f860dd72e), W(0x579d1aadd3ac1da0), W(0xd55b855303d1712e),
+     W(0xde644a70f7c2ad2d), W(0x44de1f0a66bcb384), W(0x212af9ae4a82bfcf)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf186d6bcc88d568a), W(0x872bc4c7528535dd), W(0xc9e7432edfe64dc3),
+     W(0xd9fc4832d795ea57), W(0xf4ffdb81c845af2b), W(0x66d7e7882b670517)},
+    {W(0xa7c1be04d7b7a1c6), W(0xbed88479d5b2a249), W(0x62ff8aba03f2ef6d),
+     W(0x60ecaac420dc701d), W(0x9f4b559f4ff10119), W(0x0582c9313cd54fd0)},
+    0
+  },
+  {
+    {W(0x31954a5679d05497), W(0xc12520b6fe76d4d8), W(0x8c433ec5e37ef1d2),
+     W(0xcd0f203575bc3b66), W(0x3723f145249cd98b), W(0x1356e0d2ea3b42a3)},
+    {W(0xf607fee0f174c7b5), W(0x318afc5e0127be39), W(0xd47b5d74cea5417f),
+     W(0x6891940a10fca22b), W(0x5cea41332b635e8b), W(0x93db2ed6b5934fef)},
+    0
+  },
+  {
+    {W(0x365a4a431630b133), W(0x9ecef631068d7863), W(0xa330c8b4b7205a6f),
+     W(0x4858eab357df815c), W(0x6e522afaf1a92674), W(0xa7cff3d9f41365d7)},
+    {W(0x00dd34615a0e4626), W(0xa695feff48f9d094), W(0xf427103f7c082301),
+     W(0x14a2a1876b092b71), W(0x210f632130037a33), W(0x21cca09639340e14)},
+    0
+  },
+  {
+    {W(0xb1f4fead41b959b5), W(0x6edb53a9e71890c0), W(0x48b47efe2e28aa2a),
+     W(0x70dad2e9b3151d67), W(0x87a8178b436a3460), W(0x0f86f9f5801f7af7)},
+    {W(0xfab462e3a982fc14), W(0xe29126bacb03e978), W(0xb4696b3fe6681282),
+     W(0x3bd9910a6a3fdc1d), W(0x4409128449e37dac), W(0x3b4bfabccf605fb3)},
+    0
+  },
+  {
+    {W(0x59470e49c37acc2e), W(0xc9e0f73611b85596), W(0x47613c1e0fb30ecc),
+     W(0x1fbeffa3b62892f1), W(0xddfeef49f8eefa16), W(0x6f82acd9daeff719)},
+    {W(0xff1872cdacb41007), W(0x06fe556c82d64c6d), W(0x52a63a387695218a),
+     W(0xa0d413a720802b88), W(0x233f1f3118f4a473), W(0x22ef7d6fc9d7da4a)},
+    0
+  },
+  {
+    {W(0x867379134a2965f5), W(0x34724dcde67b3546), W(0x2efe185ee92c712d),
+     W(0x8b908f86c201e327), W(0x3ab5528894f6b078), W(0xb9b2b784ce0a5bf3)},
+    {W(0x5eab37ac879f6a41), W(0x74271f672f2360f3), W(0xf3a3edff304f1cf9),
+     W(0x8992ecd8f6fd3e90), W(0xff24d7c69f16e5ed), W(0x0844ab25def9a5c4)},
+    0
+  },
+  {
+    {W(0x2edaaaaaacaf1f3f), W(0x9e3af72c80ebcc10), W(0x3542fc42bcb1618f),
+     W(0x6c04ec246709d851), W(0x5fe9768ea9af4ce0), W(0xe739d50eeb6ebe2e)},
+    {W(0x7b7da4ac876586e0), W(0xb0869f1d64f5f956), W(0x7f691c51fd563c80),
+     W(0xea990d6926c775e1), W(0x2cd96f1321b58889), W(0xbc8074720f1aac2c)},
+    0
+  },
+  {
+    {W(0x57edf71edf9a9f18), W(0xbf834240627a0b79), W(0xb37aba1aa6934160),
+     W(0xd45b3d2c5e639a54), W(0x62c6b9ad70bce957), W(0x16bc35a75d7e87f3)},
+    {W(0xb021698266b4a982), W(0xb56050dd0e51c9bc), W(0x15aa692b478e4b91),
+     W(0xdd67cf29be3fe25a), W(0xf1ef75b006bdd4a8), W(0xf71a285b41df627a)},
+    0
+  },
+  {
+    {W(0xcdd18aee24e6df19), W(0xa08ab968bbb3303e), W(0xd5eb039cbab4f1a3),
+     W(0x040d03a8fa7a48d1), W(0x767c0ed23d66628b), W(0x0c6bd388b1a6809a)},
+    {W(0x793aff3f029eeb91), W(0x6db32d13bca798a8), W(0x6aef5c1cc3816cf7),
+     W(0xcfb25ea45fd2cd2a), W(0x0715a7899f8e3312), W(0x4a9ad4782a6b1a6b)},
+    0
+  },
+  {
+    {W(0xc2885af90fe0f372), W(0x2c756bef5fa6b808), W(0x52b7f7b6068926bf),
+     W(0xc9399c1ddb143b68), W(0x0e77c689e4c61211), W(0x7d01e37f15ad7fa0)},
+    {W(0x712fc61f188b2a01), W(0x103685ec55a4100e), W(0x721f9c02e5fdce96),
+     W(0x61c8a0c5e784397b), W(0x34d478351c686ed2), W(0xc697c89cd155bbe9)},
+    0
+  },
+  {
+    {W(0xfb33b987b0be5055), W(0x9864f903bcce94db), W(0x99b8da36aea9d09b),
+     W(0x19e326113b622d3d), W(0x6abde501dc38f903), W(0xb1fe3f1867cb2161)},
+    {W(0xb053ec831e08cd7c), W(0xba503b563298d32f), W(0x220e98c8c2a79e86),
+     W(0x66ac99511e1cba68), W(0xf9520e1e644ab527), W(0x3f222b9b4eb8abf3)},
+    0
+  },
+  {
+    {W(0x3176a43ab7a3ce87), W(0x9fa09e975f130e73), W(0x971cc37b9368e156),
+     W(0x2cabf535b8981792), W(0xaec2862e4d0f0bc0), W(0xa1a48c183ce8c100)},
+    {W(0x288f4e694af2eae9), W(0x778845f21f9339bd), W(0x1ef5fdfd17dfaa6a),
+     W(0xc784117e3483a6fc), W(0xe8c82f05f3c5c19e), W(0xf39b3c1d1da87ab6)},
+    0
+  },
+  {
+    {W(0xb2fff4035b43e58f), W(0xe80bd5740727be41), W(0x048a59cbf9b52541),
+     W(0xb79084e7f38d0b47), W(0x763b0c95938935d7), W(0x7cfc6180336b8735)},
+    {W(0x118d2a6f929b0200), W(0x7e5789775a31948c), W(0x9085999326009509),
+     W(0x330533a33ad633c6), W(0x28bdb910733f4c3e), W(0x82c88f148fdca27c)},
+    0
+  },
+  {
+    {W(0x209fa6e68ca7ec95), W(0x17808b0c107a1047), W(0x99bbeb5edfd270cb),
+     W(0xe3d57c1dc25e2d6e), W(0xb90b0c107ba1237a), W(0xa7e1b8dc4a0d6856)},
+    {W(0x97d5b46136a9a07e), W(0x931251e9125ea29c), W(0x4177fd10fc8868a8),
+     W(0x1d3538b7b7cdcdf4), W(0x889008c8ed3ff9df), W(0x30573ad2229b9413)},
+    0
+  },
+  {
+    {W(0x422ad88e57fd35fe), W(0xd4564b96b99a11cb), W(0x78939992238baebb),
+     W(0xe66ddcaf4b30a709), W(0x00873d5f7812ea50), W(0x7317f9dc6784aabc)},
+    {W(0xf94afbdbe0608ba4), W(0xfff893618896d745), W(0xa3348af5cad62808),
+     W(0x13ed4507f349f51b), W(0xa73d4bec1186324e), W(0xf0b48189a20022d2)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa58a27c58a541be6), W(0xaf66949954fd7683), W(0x2431826600079a25),
+     W(0x113f6fcf2606caf5), W(0xf6ff2be316cb28c8), W(0x8f7fc60e3c17caa6)},
+    {W(0x8ea577e07d35e26c), W(0xc3e744c0f0628903), W(0x4b28eff4592a57ee),
+     W(0x76e1f87c5e3f67b2), W(0x40d7a676fb008902), W(0x68a9dc764b6e6b7e)},
+    0
+  },
+  {
+    {W(0x76e2751a12575913), W(0x2c6059914a5f8c4a), W(0x58322dfb71fba662),
+     W(0x228aec085e0886af), W(0x8d83b6276aee544c), W(0x338f5fb6e29f9639)},
+    {W(0x1ba4cfe0bf5e19fa), W(0x2eea84c5b9e4f8f6), W(0x7e0eed58cee95d92),
+     W(0x2d29282abe535540), W(0x866638b607a9a1f4), W(0x915999776ab8dc82)},
+    0
+  },
+  {
+    {W(0x599ece96f9612455), W(0xe1c6eb81c725cba4), W(0x2afc5ba86373ccee),
+     W(0xe4556833c64f7261), W(0xf29ad540414ce1ab), W(0x7094e0673ee82a77)},
+    {W(0xfa26eaa0dc9716fa), W(0x340da4be9ceb36af), W(0x9570ade54e1c94bd),
+     W(0xf4a86d8e20b0ddbe), W(0x967ab653dc6eff6f), W(0x48890be5e8bab7a4)},
+    0
+  },
+  {
+    {W(0xa16c79cfaf4d260b), W(0xfe853f6cfab3c3c8), W(0xb8bd6aa0c2f47e68),
+     W(0x277d590f2c9b4914), W(0xb6d1c810097242a8), W(0xcf2f3d8e45f75512)},
+    {W(0x2176162b74a20c3b), W(0xeee8bcb82b2bcdda), W(0xfcf8c0d1a503aee7),
+     W(0x5d1f94a57af4dd78), W(0x8f0bc1a62ab43be4), W(0xd22dbf16ba9e071b)},
+    0
+  },
+  {
+    {W(0x9a2dc376ce1a398a), W(0x0f1960f0cd582664), W(0x8e70e5cf7c076520),
+     W(0xc0dbb4ac4063c353), W(0x3f4550566abaec46), W(0x6bef5a3df93561ad)},
+    {W(0xd0bc6d922aad4857), W(0xcaedeacda705eda7), W(0x62a733424b80c021),
+     W(0x6e1d5467af5e458c), W(0x6922574f70bfde58), W(0x2e3f32aed19f052c)},
+    0
+  },
+  {
+    {W(0xbf87f30e3790b47c), W(0xd3d3f1e25ab52ae8), W(0xd5fd32bd50ec0ba3),
+     W(0x7de8fe0ae60d1e72), W(0x52d77fe0e14ff2d3), W(0x9b6937db55ca47e4)},
+    {W(0x39e3d19f53e94fa3), W(0x8d962a4fbd7827e4), W(0x3bd70c7afe92c6cf),
+     W(0xa3fbc06869a82904), W(0xe263f00ed96d1d9e), W(0xe6c9781f75c0c24b)},
+    0
+  },
+  {
+    {W(0xa1d1a8f0d7b02db5), W(0x10c385da9a9acc7a), W(0x9db2c39b84ee41fc),
+     W(0xad292a02e4a01909), W(0xee6b26ddfca66c12), W(0x4e7dcc16f04f70f6)},
+    {W(0x01e66789614433a8), W(0x218795bb054c90ba), W(0x3e7ce4542595d5a6),
+     W(0xf894a64bdce965cc), W(0x12e46952d9ec7931), W(0xa8161ac5fb65b5be)},
+    0
+  },
+  {
+    {W(0x705bfe37b4e814b3), W(0x22f0de61702013c6), W(0x811e77a9bc456797),
+     W(0x4f52c4e617081a2f), W(0x87405d819fe1640e), W(0x53fa82b7707711d7)},
+    {W(0xdc6fff830ee4aea6), W(0x8413e22ffd60373d), W(0x0ecb66bea9cf3ead),
+     W(0x7418372e87139b8b), W(0x6aaccf295e42b4d7), W(0xb6dc592531fc932e)},
+    0
+  },
+  {
+    {W(0x4b97fcf162913c13), W(0xdaf099c5ef226978), W(0xd347125cfe7d8309),
+     W(0xe42d26521aef1b3d), W(0x7a4ef285bedb8ea6), W(0x95d560101de4bc16)},
+    {W(0xd5252a203f9ae24f), W(0x5c54af99f2c3cc8a), W(0xfd59d3ec51d20b61),
+     W(0x859623c2d9c713a2), W(0x575e4c93c6225fea), W(0xb1d78640464d1bf1)},
+    0
+  },
+  {
+    {W(0xf1c8d00de460fe00), W(0x5692bfee528da7c6), W(0x9e4dd700ac8620df),
+     W(0xcc43e73d9d6fe740), W(0xc94060d3e76dcba2), W(0xfcdf8ba6d398914f)},
+    {W(0x540942e7502f8587), W(0x5def85040de058fb), W(0x63e0c7855292b0c8),
+     W(0xe90405282e558983), W(0xe25727a16baf4a31), W(0xb9bf28f0acf64d7c)},
+    0
+  },
+  {
+    {W(0xc3633a5abad65b1a), W(0x6e690d8f9f1ffd55), W(0x59bbd84c1a99c5ab),
+     W(0x6c14eb4872664ebb), W(0x5659af9d146d5669), W(0x439a2a880c9fac8c)},
+    {W(0xe763b90fb9b2c173), W(0xbbf608b40897f0ee), W(0x6664392ae7879ec3),
+     W(0x5d16c1d930d609b7), W(0xabc5e7b44c8bcaec), W(0xf0c05ff08bb0cde4)},
+    0
+  },
+  {
+    {W(0xc7c8364f09d26382), W(0xe16988737bf32d9f), W(0x97bac2feb726391c),
+     W(0x521426364a7c0b57), W(0xe3e596482cdec222), W(0x4ee7238cf44e0a98)},
+    {W(0xa6d05a21f61cfea8), W(0xa1059fb7efe6a26f), W(0x482a65b342416fa4),
+     W(0xdc5727e1c71e7a94), W(0xe6b0fb6ec4767f1e), W(0x3d0d626d6510599e)},
+    0
+  },
+  {
+    {W(0x0e2617b7c1374fc4), W(0x5611b6b7c6aaaa09), W(0x1e717f32b52102ed),
+     W(0xf78d849fdc325b99), W(0xf2c7efa0ef3e0de5), W(0x19f5c9c2b2941df6)},
+    {W(0x9f6444f9e0b57212), W(0x5fc5cb818f8d4602), W(0x805d6bfa673a17d7),
+     W(0x8a05946154d39763), W(0x1fbfd73154dade38), W(0xd916c3eaa938adf7)},
+    0
+  },
+  {
+    {W(0x59f5df1b2a8f9f78), W(0x6bb161d992257e60), W(0x2cf060beb7b2eb14),
+     W(0x98e72799aec169b0), W(0xdde683927045fdb9), W(0xee5e0aaf461b27e8)},
+    {W(0x80250c744c0ee047), W(0xdd3881f597f0677b), W(0x0ea56921a4459b6c),
+     W(0xf7793cee26df8d7d), W(0x33bfa09be42d1913), W(0x9f0636f74ccf5139)},
+    0
+  },
+  {
+    {W(0x712deeb99b014111), W(0x3aea069f87b112dd), W(0x66aa2795813c09b8),
+     W(0xabc06d45a9120253), W(0x5d5dff53b1957721), W(0x445a058c6f129da0)},
+    {W(0xb3ce50dc278d5989), W(0x692aa1ca8d1adf81), W(0xc2aec03f66a1ff4e),
+     W(0xb2eea9663bcced9d), W(0xd066c0f611fbcd11), W(0x36da0c93e2aaae07)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfa3b4c8eb88ee8f9), W(0x1f288e60b521ab57), W(0x06aa39562e8c4d8c),
+     W(0x4981c3e5cf89935b), W(0xbdbd0c4745fa071e), W(0xa78f831c496073be)},
+    {W(0x09a72986a4e5c001), W(0xac527731709cb728), W(0x9a64b5b3988f2781),
+     W(0x6ac9440d73b1719d), W(0x58ad54c7e3d2e807), W(0x1c1574488f06742b)},
+    0
+  },
+  {
+    {W(0x33952177a98cf218), W(0x841d9e1f579ee53a), W(0x1084d61e0a285bd5),
+     W(0x3935a84e71171b1c), W(0x8ac2433cf29b29f9), W(0x5dd868b56dd1e9bd)},
+    {W(0x88da04788d102390), W(0x1140735a657400d1), W(0xa792a25f9d5b19e1),
+     W(0x9ee015cb6a27fa79), W(0xea3bf8b57ba16a8e), W(0xc5f0cc26c15fde67)},
+    0
+  },
+  {
+    {W(0x37f50e43892c8eec), W(0xf06a2f047d85a7e2), W(0x3916af85e1d11150),
+     W(0xf56e852f6785ae1c), W(0xbf8c72adae6ada8c), W(0x1fcd53e3e13285b2)},
+    {W(0x5327920cbd56d348), W(0x82a394fb445658a8), W(0xa71328573caf3792),
+     W(0xb15ab34b550ffe1c), W(0x818980666a5d4e4f), W(0x0bda153b2f854f9d)},
+    0
+  },
+  {
+    {W(0x3b62315064ef6a95), W(0x97645381aaa5b792), W(0x4bc2c31c56471100),
+     W(0x4a0e73bb1bae8d2a), W(0xbfc0770a8df1f76a), W(0x5089916fa7bb16ca)},
+    {W(0x2afe5b1cf31fe82e), W(0x0b06831df0119977), W(0x97caa333a1af2a82),
+     W(0x93cb92c5dafed6cd), W(0x09553e7e92c3b2e3), W(0x3d9c4b7d61af2956)},
+    0
+  },
+  {
+    {W(0x5559dd31e67145b6), W(0xf2d905b45b2427e7), W(0x0d840fabcaf57d0c),
+     W(0x9625866578742ab6), W(0xc85482ad409c1c8e), W(0xdca2a058adaa6167)},
+    {W(0xec26ad9a0c8885fd), W(0x1b93b8a22a600cb2), W(0x340aa7fc2539986b),
+     W(0xd7674876a23dee41), W(0xa948a9292e1a9837), W(0x9ae67d2a71438da9)},
+    0
+  },
+  {
+    {W(0x39038863f7f35053), W(0x421a17f3328787d2), W(0x38aa682ef3d8310f),
+     W(0xb52d41e8f4123153), W(0x4fbef3dd7026310b), W(0x0c6bd7adf6ff5692)},
+    {W(0x3831c6b2a9be5d0c), W(0xb5c9ae85e8d328b8), W(0x76d26abc6516bba4),
+     W(0xc237f9a5446d35a8), W(0xb2b16c0ff012a8d0), W(0xddf2b7fe0ee0315b)},
+    0
+  },
+  {
+    {W(0x817d77b106a9ad54), W(0x3a999d7d89a25eca), W(0xd3ac4107da68b768),
+     W(0x6904bcddbebc4c4d), W(0xb0d2103ca53d39e9), W(0xdba86bd230a5e950)},
+    {W(0xb09256804f52208e), W(0x37c3156a28495b2c), W(0x2389ab34c15855ae),
+     W(0xc14dfd963017194f), W(0x420e07191146b838), W(0x1a9f909b8fb4b6fc)},
+    0
+  },
+  {
+    {W(0x13722ab079ed523a), W(0x33b29bec249d5624), W(0xd3d0f467f76fdaf7),
+     W(0x7ce072f912ddfd9a), W(0xce918a5747bdefd3), W(0x14d38ab4750e5315)},
+    {W(0x08bbb20e3346f647), W(0x428b917f05b26894), W(0xc8fb5c21ca865ba6),
+     W(0xee6e41e02e6e8e6f), W(0xd00ae6214c608b60), W(0x659756396ff685cd)},
+    0
+  },
+  {
+    {W(0x34334253b52fc0d6), W(0x7f73ef48535f1d9c), W(0xf079480ab64c79fb),
+     W(0xf8ec1fd9ab0efbb8), W(0x44cde8422b67ca02), W(0xff17eb8f7a48c24c)},
+    {W(0x1c0dff40edd049ea), W(0xfddfc9b10fcd6618), W(0x0b3360e43bf5f55e),
+     W(0x946a062868419e83), W(0xa974d721612a4d5f), W(0xc479ba8843a411a0)},
+    0
+  },
+  {
+    {W(0x728b484c38798b8e), W(0x18442877206401de), W(0xd1bf073ebf3bc268),
+     W(0x88afc3605e1802d6), W(0x81c95b2d4bb3a324), W(0xafecda2ab70cb6f4)},
+    {W(0xdcccefdc57f2b237), W(0xfe2fee84a776cd55), W(0xd5cf12908ac80959),
+     W(0xc3f56606894714f5), W(0x8e0c5495980d696f), W(0x861b4e700e27c238)},
+    0
+  },
+  {
+    {W(0xf3ca216a296ea9ff), W(0x7125667580df6624), W(0xbb5060e888b6e503),
+     W(0x8168fc8d877c784b), W(0x19c0f575f47ae24a), W(0xf0d334a1212fa942)},
+    {W(0xe0f7af4b005956e2), W(0x1bae68328336419b), W(0x4e16670804d3d61b),
+     W(0x4db20b4872a30bb6), W(0xc06d282cfbfbc5db), W(0xcb37c2f2c7c56f2f)},
+    0
+  },
+  {
+    {W(0x5a39763642772d93), W(0xa8fc5c272f3d5b2e), W(0xa6747ff3133783f5),
+     W(0xdf3dff113b82db58), W(0x5e1cfb598c02fc00), W(0x6b8d7b0e9ea0d481)},
+    {W(0x64dc4e1a49a18462), W(0x91fb6e2dfca8bb99), W(0xac73e778363e95eb),
+     W(0xea98b8a1fb737b0d), W(0x85fe940a4101c638), W(0x7cfd0410e973e6ec)},
+    0
+  },
+  {
+    {W(0x210716e07f7a1f3a), W(0x687cb183a282cb09), W(0xf313936fd94da2bd),
+     W(0xa66c5b2de9b30a4a), W(0x890902f4e08d5aad), W(0x85671974f430174c)},
+    {W(0x791c8a775f7dafeb), W(0xa1b3e6af76ee383e), W(0xc6b216ef3a1a89a8),
+     W(0x633611d70c66ca9e), W(0x9fbbab89893a90cc), W(0x0359b78e1c16cb4b)},
+    0
+  },
+  {
+    {W(0x36ed65d8f2fbbb1f), W(0xcafaadbb9f22939d), W(0x7c74f7ff99c71563),
+     W(0xfe0f0635c94054cc), W(0xd58fdc3d742556ee), W(0x68dd1678076dc794)},
+    {W(0x274770b1fe29562c), W(0x535d7b7d0a405656), W(0x502b7be3f836c977),
+     W(0xf1a1b75fa189a0f7), W(0xb3b3a225dcd8e33b), W(0x9360b62407a22fc9)},
+    0
+  },
+  {
+    {W(0xfa128d79edb2f0a5), W(0x784afca90f4cb057), W(0x4a6420dafe29d22c),
+     W(0x078408798a5396bf), W(0xf6ea41eaea5d2574), W(0x9e03bccf2670e2d7)},
+    {W(0xc589f801dae266fc), W(0xa0bc7b0d98ced652), W(0xb49d8305e10df5f9),
+     W(0x325d314b0583ecdf), W(0xcc8d1776452ec9a1), W(0x8f16c48471d4ab64)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbbccce39a368eff6), W(0xd8caabdf8ceb5c43), W(0x9eae35a5d2252fda),
+     W(0xa8f4f20954e7dd49), W(0xa56d72a6295100fd), W(0x20fc1fe856767727)},
+    {W(0xbf60b2480bbaa5ab), W(0xa4f3ce5a313911f2), W(0xc2a67ad4b93dab9c),
+     W(0x18cd0ed022d71f39), W(0x04380c425f304db2), W(0x26420cbb6729c821)},
+    0
+  },
+  {
+    {W(0xca07923c0eb008c8), W(0xab79402d9985912e), W(0x41e379e83cb02510),
+     W(0xfabac005beb383ef), W(0x24d12d9a1076dd0d), W(0x95afd46fb208f127)},
+    {W(0x9cc38a60b1031e46), W(0x93e21e977009f6bc), W(0x6f6360d98ac219ef),
+     W(0x1edaab3faf284c80), W(0x9c3b5281019e366a), W(0x6475c579bc9e9726)},
+    0
+  },
+  {
+    {W(0x26bd07d6bdfbcae8), W(0x10b5173fdf01a80a), W(0xd831c5466798b96c),
+     W(0x1d6b41081d3f3859), W(0x501d38ec991b9ec7), W(0x26319283d78431a9)},
+    {W(0x8b85baf7118b343c), W(0x4696cddd58def7d0), W(0xefc7c1107acdcf58),
+     W(0xd9af415c848d5842), W(0x6b5a06bc0ac7fdac), W(0x7d623e0da344319b)},
+    0
+  },
+  {
+    {W(0x8410d8298d85a25a), W(0x48ee01354af81a14), W(0xae460d0d18c25348),
+     W(0x5d0279a07eb035a3), W(0x87e7c1289a114414), W(0x17c08a8ec0744f79)},
+    {W(0xb7b2b4f1025cdbe3), W(0x9a74f15d82d1af60), W(0x124a7395b51ee685),
+     W(0xf2937c4bf6122422), W(0xb4ec133207f1a7ff), W(0xad801112f886032e)},
+    0
+  },
+  {
+    {W(0x4c0d78060c9d3547), W(0x993f048dcf2aed47), W(0x5217c453e4b57e22),
+     W(0xb4669e35f4172b28), W(0x509a3cd049f999f8), W(0xd19f863287c69d41)},
+    {W(0xe14d01e84c8fded0), W(0x342880fdeafd9e1c), W(0x0e17bff270dc2bf0),
+     W(0x46560b7bc0186400), W(0xe28c7b9c49a4dd34), W(0x182119160f325d06)},
+    0
+  },
+  {
+    {W(0xdd4eb3d07bb5346e), W(0x9a46ad01382e7db7), W(0x1200285ddc1973c7),
+     W(0xfd342beaa0046b98), W(0xd19173491219a7fc), W(0x5383d319b7caffe5)},
+    {W(0xea5a0c4e2e0fa118), W(0x1cc2de3ca5457b28), W(0x5b2a16dc6046eeea),
+     W(0x1755e1fecc8e64b1), W(0x51e4946e9e7fadda), W(0xf805422ffcbf4ec2)},
+    0
+  },
+  {
+    {W(0x46d70888d7e02e18), W(0x7c806954d9f11fd9), W(0xe4948fca4fbea271),
+     W(0x7d6c7765bd80a9df), W(0x1b470ea6f3871c71), W(0xd62de2448330a570)},
+    {W(0xdaecddc1c659c3a7), W(0x8621e513077f7afc), W(0x56c7cd84caeeef13),
+     W(0xc60c910fc685a356), W(0xe68bc5c59dd93ddc), W(0xd904e89ffeb64895)},
+    0
+  },
+  {
+    {W(0xf877e8c6bd08ffaf), W(0x24718fefaf23012f), W(0x19ff269f2b004cfe),
+     W(0x8adc5d7795450f8b), W(0x688ce8bce2a7d458), W(0x74d7445b97bd7fdc)},
+    {W(0x1b9f4ad641e6abad), W(0x6652ed05f00e4bf5), W(0xabee1f7e71d83d86),
+     W(0xe693c76d25ffc219), W(0x1c9a84afc873f553), W(0x84d2718766d77a55)},
+    0
+  },
+  {
+    {W(0x75d874fb8ba7917a), W(0x18fa7f53fd043bd4), W(0x212a0ad71fc3979e),
+     W(0x5703a7d95d6eac0e), W(0x222f7188017dead5), W(0x1ec687b70f6c1817)},
+    {W(0x23412fc3238bacb6), W(0xb85d70e954ced154), W(0xd4e06722bda674d0),
+     W(0x3ea5f17836f5a0c2), W(0x7e7d79cff5c6d2ca), W(0x1fff94643dbb3c73)},
+    0
+  },
+  {
+    {W(0xe566dc057e5f7121), W(0xccac74e22ed07bc3), W(0xaabfdfcdc70401b4),
+     W(0xac9fc4496254e0db), W(0x358d885f11c7de05), W(0xb8e6a4a9d60772b4)},
+    {W(0x884272a5cfe917ce), W(0xdfbe98689a3d347a), W(0x06b90848c9d1bacc),
+     W(0xc4ccedb6db8c6288), W(0x892878b979e5683e), W(0x1b521829243273e3)},
+    0
+  },
+  {
+    {W(0x916e19d0f163e4a8), W(0x1e6740e71489df17), W(0x1eaf9723339f3a47),
+     W(0x22f0ed1a124b8dad), W(0x39c9166c49c3dd04), W(0x628e7fd4ce1e9acc)},
+    {W(0x124ddf2740031676), W(0x002569391eddb9be), W(0xd39e25e7d360b0da),
+     W(0x6e3015a84aa6c4c9), W(0xc6a2f643623eda09), W(0xbeff2d1250aa99fb)},
+    0
+  },
+  {
+    {W(0x099369c4bf0c6fbe), W(0x976f78b2fe7d5727), W(0x32feb503d18267a9),
+     W(0x162c41501a7dd0fe), W(0x3141e37726b8e969), W(0x50497a643b53a94a)},
+    {W(0x96159f41607b4cfc), W(0x1999b7042f111bab), W(0x3254987c760f2eae),
+     W(0x5308075b841014fa), W(0xc634127e4e7adad8), W(0x32a70a6059ffbfe6)},
+    0
+  },
+  {
+    {W(0x1feef7ce93ee8089), W(0xc6b180bc252dd7bd), W(0xa16fb20b1788f051),
+     W(0xd86fd392e046ed39), W(0xda0a36119378ce1d), W(0x121ef3e7a5f7a61d)},
+    {W(0x94d2206192d13cae), W(0x5076046a77c72e08), W(0xf18bc2337d2308b9),
+     W(0x004db3c517f977b1), W(0xd05ae3990471c11d), W(0x86a2a55785cd1726)},
+    0
+  },
+  {
+    {W(0x7279c369a1f857e6), W(0x029d30ef27fb373a), W(0xe82cbc806827358b),
+     W(0x2bfe09aaa18f57ab), W(0x63bf3145e5503492), W(0x7ea15beafb28ee43)},
+    {W(0x8e6d428f5eec91b8), W(0x215e03e9611b1799), W(0xb995737161d476de),
+     W(0x2320c764e76726a5), W(0xc5de88178e5e26f5), W(0x24aae0699161e0b7)},
+    0
+  },
+  {
+    {W(0xb8d9b28672107804), W(0xb5a7c4133303b79b), W(0x927eef785fa37ded),
+     W(0xa1c5cf1ead67daba), W(0xaa5e3fb27360e7c7), W(0x8354e61a0a0c0993)},
+    {W(0x2ec73af97f5458cc), W(0xde4cb48848474325), W(0x2dd134c77209bc69),
+     W(0xb70c5567451a2abe), W(0x2cd1b2008e293018), W(0x15f8da7ad33c0d72)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x5584cbb3893b9a2d), W(0x820c660b00850c5d), W(0x4126d8267df2d43d),
+     W(0xdd5bbbf00109e801), W(0x85b92ee338172f1c), W(0x609d4f93f31430d9)},
+    {W(0x1e059a07eadaf9d6), W(0x70e6536c0f125fb0), W(0xd6220751560f20e7),
+     W(0xa59489ae7aaf3a9a), W(0x7b70e2f664bae14e), W(0x0dd0370176d08249)},
+    0
+  },
+  {
+    {W(0xaff4782231cb94c9), W(0xf1b5a0b7803c1af4), W(0xbeb85f8d2ef696a9),
+     W(0x8ce5baab4fa94fca), W(0x0a32f96200d41a43), W(0x0f69ad5774f6e772)},
+    {W(0xbe0221af6ccb5157), W(0xcb83969a2a4f91ff), W(0x78ff85d6a7e49f39),
+     W(0x63006589cb5d3c63), W(0xe8e4383596eb65f5), W(0x79f59da9ff8adbdf)},
+    0
+  },
+  {
+    {W(0xf6fd26cc487925bd), W(0xd9b751eef5ef44e9), W(0x694a788be372817e),
+     W(0x85f3dc1ae8c90c31), W(0x8c90c6bf15aa0ce5), W(0xb52a5d83f01bb223)},
+    {W(0xbdae01dddf9c3315), W(0x941fa6b663ddfc56), W(0x50ddff4ec2548f24),
+     W(0x54a49868d12802a7), W(0xcd922fb6404d9240), W(0x88d7f41f957f6d1a)},
+    0
+  },
+  {
+    {W(0x082ea61d10eeed24), W(0x7c9d5ade143fd59d), W(0x7d33df962e54f5cf),
+     W(0x340b0d36e39dc6ab), W(0xd97a8b848d179b13), W(0x88184bb0288d388c)},
+    {W(0x2237e507e116ae6d), W(0x3e97b063211b2cf0), W(0x645f8bcb42be7459),
+     W(0xce2b0f54de2176b6), W(0xaf570a09d1e2f09c), W(0x110adf5657fdc001)},
+    0
+  },
+  {
+    {W(0x7dd81467fc6b62fa), W(0xaf1ead6e676c6716), W(0xa2ae4e832d2e9fbf),
+     W(0x0f127f661c9d9c7c), W(0xf06c5a57e6f27f14), W(0x087acee61f30329e)},
+    {W(0xa1b2b82f94c21c2a), W(0xa52a4d00b0db4727), W(0x1cf0cb8b039f12bb),
+     W(0x06ce433902b92d6b), W(0xcb5e826869f649e6), W(0x1206d910e93096ec)},
+    0
+  },
+  {
+    {W(0x9d21c740842e4246), W(0x30f474c44ab098a5), W(0x57f8b1a3aae5d701),
+     W(0x477e4f8891978d15), W(0x2913ffb40fb85b1e), W(0x80aedb2258489fb4)},
+    {W(0x0e1ab2670912d86a), W(0xea5e6a4182933f3a), W(0xf578ccb657ab8d86),
+     W(0x339fd796547f64bd), W(0x904693943f3e497e), W(0x2cde596c1d864706)},
+    0
+  },
+  {
+    {W(0xda92e4832c8b7221), W(0xf684caabbeb8f993), W(0x8763ebb3639c7870),
+     W(0x3bf71779d77aac3c), W(0x92a5420d3f2769a4), W(0x54e1979dd092eeda)},
+    {W(0xd7bd8d8fc885a766), W(0xef421ab92cbf100c), W(0xa5eafa3ed6b0cf86),
+     W(0x5255afc40490a771), W(0xd40bb0fd15ff3722), W(0x3a0254a979294cdb)},
+    0
+  },
+  {
+    {W(0x158bfe27bcb6db29), W(0x967212410054d963), W(0xf07b153b8e71aca1),
+     W(0x5e67698171b11643), W(0x77b7dd7dd04e2f90), W(0x07814aa6f0dcf109)},
+    {W(0xd3bab2a4fe1d0b1e), W(0x50abba31be69e691), W(0x54fe99afc6f53cd9),
+     W(0x071f2a4f628039e4), W(0xf1f44181b183aa16), W(0xdf0138e05010f6f9)},
+    0
+  },
+  {
+    {W(0x726a4d4b29c5b6bb), W(0x35b02ccfedf367ae), W(0x1de3864273faac6a),
+     W(0x608f3320ee080bad), W(0x06f28e1d6c6214fd), W(0x1131375cae498d17)},
+    {W(0x8546739a18e3234a), W(0x036ceb43f9b86dda), W(0x26adb7f4d93000f5),
+     W(0x363997b382b1f000), W(0xc6313d6ad8009577), W(0x0d0a91d93a667511)},
+    0
+  },
+  {
+    {W(0x5737f903aff45947), W(0xe576f8ff62c5dfd1), W(0x2a7d4f18e1e379a2),
+     W(0x8596ffaff2f26f8c), W(0x12f49653fab86608), W(0xcc6184973aab1eaf)},
+    {W(0x7b5d029f865d9611), W(0x87af2d58bf6861f5), W(0xb765364631b2d7cf),
+     W(0x60f47e058be46ef9), W(0xa21106a9b1c175ce), W(0x21cb0e27deb065b6)},
+    0
+  },
+  {
+    {W(0x90482c7c86234144), W(0xec0a464f81698fea), W(0x57af7fea72cdd803),
+     W(0x6c46a03205b50064), W(0x4d5d035b0bd4f07f), W(0xe365fc35043c9071)},
+    {W(0x9a872f42e455bc19), W(0xaf6cbeaecccc7b18), W(0x0fe926fe35805c4d),
+     W(0x2b0d67544ad87603), W(0x38d7dfb0ede808c0), W(0xf092db024140474d)},
+    0
+  },
+  {
+    {W(0xb287e26db340f4eb), W(0xa397cfd1b34c2948), W(0x0d91d7639a7ead15),
+     W(0xd71901b966e88f14), W(0x02447ad3b4884ac2), W(0x5e6f7545d006f448)},
+    {W(0x2af6bfeeec5744e3), W(0x643f46b1f55cd6ab), W(0x13400bc487b2c127),
+     W(0xd1dddff44629859b), W(0x9710cae020feecb9), W(0x594bc27cd02d4300)},
+    0
+  },
+  {
+    {W(0x5c56efeb35de80cf), W(0x7f3de4d3958b32cd), W(0x1d3526a9d1704992),
+     W(0x726a32c994865e27), W(0xbe2d5f70a09a803e), W(0x720d4a8a575841cd)},
+    {W(0x63c48fc478ef6729), W(0x4f00b6de0a50c522), W(0x5efbba81738a7e87),
+     W(0xf365cda558c49da2), W(0x23cbe36138d169d9), W(0x1fe2f1216bec897d)},
+    0
+  },
+  {
+    {W(0xb0233c4daa331700), W(0x3bf63a6130b3a854), W(0xc269d68b49b806e2),
+     W(0x4a079274da8ddca6), W(0x256bc0090db04d76), W(0x7395c11c1f47dfee)},
+    {W(0x51bbcc9513886ec2), W(0x9d5377eb244d1f0d), W(0xa6e0f054ff9e6b3a),
+     W(0x307f9e93204e5258), W(0x8069c01d8d34d97b), W(0x30f785ce43c24997)},
+    0
+  },
+  {
+    {W(0xaf892752ec8bb9f6), W(0x1ccb1cfaf72813be), W(0x734db45b36bc8bdc),
+     W(0xdb227ac1bf6c5b42), W(0x055f14e0cd4f7228), W(0x98879f70b3f6f2d5)},
+    {W(0xdd9fbb21375c98a0), W(0xbefec3f7754d5160), W(0xb2575c27b9984b98),
+     W(0x42f6eaabdae403df), W(0x21c24629e4111908), W(0x816fed38128c3570)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb1e365019c77ca60), W(0xfe084a2301018e14), W(0xbf451d2ca4bfdcec),
+     W(0xd210892fb29cdcfe), W(0x5b12bcd894514871), W(0xd03ca18c1809b1e3)},
+    {W(0x09b243115858e4ea), W(0x37b30d50e57524b4), W(0xcef0a16b5de334b5),
+     W(0xfe0bd1e20b116076), W(0x54e4b48289ae2bf4), W(0xfbcc5e1a68c8a937)},
+    0
+  },
+  {
+    {W(0x309b1eb33ef5a413), W(0xa7607981a81f43fb), W(0x87c2b81ebf8a894c),
+     W(0x27a40bce0d293293), W(0x7f4c315be4bf3714), W(0x03fdc14e01236895)},
+    {W(0x319c88f8dff053fe), W(0x146bb448ea3fa121), W(0xfcc2a05df0dd1380),
+     W(0xc8d55b024acba9fa), W(0x871358de5927313e), W(0xfd1d81d317ce294a)},
+    0
+  },
+  {
+    {W(0x10777189c1a21254), W(0x7d8d3966ca593a6c), W(0x261ab515120380e6),
+     W(0x453c858fe13577d1), W(0xb1f6bb58f3862db1), W(0xf8ff48b8b9529e1c)},
+    {W(0x03f63a417b60b400), W(0xdc248d96bba66b3b), W(0x8423048b756e5af2),
+     W(0x4d978ed31c984bef), W(0xa06242995ba00f3e), W(0x0bed7b454f4d19e7)},
+    0
+  },
+  {
+    {W(0xd3797831ff63ae69), W(0xa753de02ce4c7eaf), W(0x2ff7a6a611a4e339),
+     W(0x904f86f05328043a), W(0xe29d31c012e9f7dd), W(0x8825a639c0a51904)},
+    {W(0x070c2696ebfc2cc7), W(0xc03ce643c5f7a943), W(0x5b970d0c12c8a1f5),
+     W(0x572aaaa1ab352a83), W(0x63df45a90c5eb0c7), W(0x95c951e1d4977599)},
+    0
+  },
+  {
+    {W(0xe35daffe2e4c6299), W(0x1f9e33935915cd16), W(0x93f05a40f009a48a),
+     W(0xa4a801fd308a81c6), W(0x75e5dc467e885426), W(0xf0bc7d5d4629ff05)},
+    {W(0x356b879bdbd812c2), W(0xdb5eb60001629849), W(0x11c9856eec2dd55a),
+     W(0x20f0443880f0c804), W(0xc0b5e3e21801b217), W(0x7ceba67d6ea097b8)},
+    0
+  },
+  {
+    {W(0x01c2df8d3bb02d0e), W(0x874e43afe26f388d), W(0xe198341c8360fa6a),
+     W(0xe67f8092c52bb2d6), W(0xf944dc63a02efba5), W(0x9a9c02d92c12332a)},
+    {W(0x39684f6ca8cb6bd5), W(0xbcc1828e26bc9535), W(0xb7fb8eb646594725),
+     W(0xbb4f5f05793c32dd), W(0x3ef3c33845f94b55), W(0x228e0e7d09eac277)},
+    0
+  },
+  {
+    {W(0xefd26dca727cacde), W(0x6290fedb5fcdb147), W(0x9f108a89e1830a96),
+     W(0x7e8e36813e039a02), W(0x1747b3e9256fbb3b), W(0x5aa0ebffabb3b2f1)},
+    {W(0xcac5818c9fbb9b49), W(0x037d66114a94b74e), W(0x4081fd4d7a548536),
+     W(0xfe2d8e79aa364507), W(0xe86ce00ea81a5f81), W(0x77b95e9477a9bdb4)},
+    0
+  },
+  {
+    {W(0x2c5b0e42bca07a42), W(0xbe57f3597a0dffa1), W(0xace485959aa90727),
+     W(0x32be886af658699b), W(0xce75d6c6da3b18e6), W(0x9d563e4f69caf667)},
+    {W(0xc17c66cf065eb772), W(0xfbe123814df9f6ef), W(0xceb80041623db4ef),
+     W(0xe75615b2c74762e1), W(0xade8a5438671c52f), W(0xb713c401cacaf2ec)},
+    0
+  },
+  {
+    {W(0xc45064dbd71a7744), W(0x1900bb8f04a6f3cb), W(0xd592585a76c2dd6c),
+     W(0xabbbd6d862b95d26), W(0xb0db482b1d2e180a), W(0xf459430184c9dea5)},
+    {W(0xd30b162a6e5ec460), W(0x90838e57e4b35476), W(0xab4b7c80f9356687),
+     W(0x72c2c009719f347a), W(0xd5d01fcf920d187d), W(0x47426f1e0afe06ab)},
+    0
+  },
+  {
+    {W(0xdc7e39ee0ae2a7ca), W(0xcdd3c235e6b7dee9), W(0xf9624c299368c8a3),
+     W(0x2086bc904b21951f), W(0xf7990a1f57e0e6a3), W(0xf170dd75e686da8c)},
+    {W(0x4a82719a06da9714), W(0x3a78e35e24274685), W(0x1c3965e1c67712f8),
+     W(0xc6c26eb62f164e3a), W(0x1129a467381fb91f), W(0x896022108443ffdd)},
+    0
+  },
+  {
+    {W(0x0057f60756a0b6bb), W(0x46a6e9949c1e24da), W(0x1c283f859baaf618),
+     W(0xd75e731be878a354), W(0xf9db13388bf2ca71), W(0x0f14adeea9022f59)},
+    {W(0x309f04aa6c14666f), W(0xe6cec2aa552d2da7), W(0x9f27eaba218d8659),
+     W(0x9b3165d3c268561e), W(0xc7e3afcb90ae19ef), W(0xb840170bcb329e68)},
+    0
+  },
+  {
+    {W(0xe6d039ef467eb167), W(0xa7e0959d74696cf9), W(0xf3a19b9d7078d8a0),
+     W(0x5d4ec99c07cdc6f6), W(0x4842d0f98386eed8), W(0x48f5ab80545fc0d5)},
+    {W(0x8906fc626d39c2f7), W(0x1c050d691bf5366a), W(0xac506c579f54d0d6),
+     W(0x9a356a6ef9e4b94c), W(0x62632c5108a75e61), W(0xfc1b9fa5c6951dc2)},
+    0
+  },
+  {
+    {W(0x917747f99ee0628b), W(0x5d711303566cf048), W(0x206d53f15b77f58d),
+     W(0xe104bc12667a86dd), W(0x158f8d253505380f), W(0xf5b32ad4616e821e)},
+    {W(0xdb67191a3cdfe797), W(0x61b58589147e1756), W(0xb7927e12625d0efc),
+     W(0x48d999d008bca937), W(0x335c6f5b7b02689b), W(0x4f0994a9d8149b7e)},
+    0
+  },
+  {
+    {W(0x125951a52e6d5433), W(0x7d672aee6a6013d4), W(0x6ed23f2560831997),
+     W(0xb0e219ae438c75c3), W(0x6851dd4bace91d00), W(0x84704f7d30f19991)},
+    {W(0xd744cb32d0107170), W(0x15f51a63b0cb6796), W(0xe14712cf5a5807d8),
+     W(0xff89f0c5dbfd612c), W(0x0c314718bd021483), W(0xf9ccd3b11b4b76d5)},
+    0
+  },
+  {
+    {W(0x00b75b851871749c), W(0x063b748ea00faa20), W(0xa516e09f90257503),
+     W(0x9ffc43981c800098), W(0x49f011f871b00fa1), W(0x6fc80517443268bf)},
+    {W(0x2802e2bf24a24aca), W(0x96fdc71edde88ab9), W(0xe3eff1f997e661a4),
+     W(0xae5c34e13cb321f8), W(0xf863263e301c8ba0), W(0x3c3eeb7b093e186c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa933aaf7a4886619), W(0x9ec1915f4af13c7f), W(0x25a9dff8854de496),
+     W(0xa8b31d9b247bec15), W(0x468a25c84661e58d), W(0x8989c046786a0707)},
+    {W(0x282db8cabb66922e), W(0x73bf240d45ca29ff), W(0xa2c40faaeaeda06e),
+     W(0x69632929add94b47), W(0xc72354f6b0069076), W(0x8d197fbf7878e92c)},
+    0
+  },
+  {
+    {W(0x854b05846150771a), W(0x35fdd9b4d9ca9868), W(0xec8293894c32fc71),
+     W(0x882fad4c9ec8f90d), W(0x2d39990dc6c7b9c0), W(0x7fbc201bd71a25e5)},
+    {W(0x6b852e655166da7d), W(0xc6bde23a3d8c6e36), W(0x370011545857f048),
+     W(0x746621fc1ccb9bc8), W(0x97e44e63612bb853), W(0xabc3b450758da4ed)},
+    0
+  },
+  {
+    {W(0x587758578fb415b7), W(0xab580f159e88dca3), W(0x86a12e3da62265d2),
+     W(0x8ec4278672d98b08), W(0xb9da8016f61e9c85), W(0xa895aedb800994ce)},
+    {W(0x63d0878ce38ef526), W(0xa081d7141efb6575), W(0x780b9e126a1c1efa),
+     W(0xeed68d0eebd0497a), W(0xbfeee3d29265231e), W(0x46f751da80e03127)},
+    0
+  },
+  {
+    {W(0xd25f650804926a41), W(0x7236b475514045da), W(0x0b36031108b9b08b),
+     W(0x16477aff3fe92e91), W(0x6e5f6cb103189ddc), W(0x81ff008ec698a38f)},
+    {W(0x02a09218c93adb23), W(0x71fcecd3445d8fae), W(0x55a15eac8fd6b76c),
+     W(0x1e37ec3611ef96b4), W(0xd1b3b3fc30e433b5), W(0x4951873351d174c3)},
+    0
+  },
+  {
+    {W(0xe67813ddabc63005), W(0x28a1a4cd0198a946), W(0x74ea7b634c8cf164),
+     W(0xf1bde0bfa3556b46), W(0x5343f260c1db03df), W(0x55e9f108e0a1d6b4)},
+    {W(0xaf56bed0febb0a19), W(0x6ee39a0763a77859), W(0x04e0c5892c72fa7f),
+     W(0x812e2596a49486e5), W(0xd5e0bddb2ef78943), W(0xaa85b25cacdba431)},
+    0
+  },
+  {
+    {W(0xb6e954955da030f1), W(0x89faed5ef3d745b8), W(0x474112ee2183ce10),
+     W(0x4180ec40cc01d143), W(0xdc5f8f7b8dd0d25f), W(0xb41a7e30974a616d)},
+    {W(0xb9a7f0a9d97b778c), W(0x58bac4f6abd66271), W(0x50eb0b82bc5671a8),
+     W(0xfa5866700466ffaf), W(0xa75ff5aab9fdc348), W(0x6ee62d017f784299)},
+    0
+  },
+  {
+    {W(0x24b18ccfeebb98da), W(0x8ac81e23c54a72fd), W(0x043a977c532d340b),
+     W(0xa2de526191002448), W(0x1e11027870960397), W(0xb9a555920164e34e)},
+    {W(0xcc5f572982330806), W(0xe6674beaac7d293e), W(0x3b1520963266aaec),
+     W(0xfaea30f2c3ccd59f), W(0x1da2e1fbc9a6dd5d), W(0xf30da4d6ceda835a)},
+    0
+  },
+  {
+    {W(0x7914213db8c9f82e), W(0x7a3e4e38fc038e90), W(0x6edae5a126a34238),
+     W(0xe566bf50701ce8c7), W(0x3562e87555656e02), W(0x48325ebfb4e8efbf)},
+    {W(0x5f10a50466505ec3), W(0xd8b9834b8da78aec), W(0x49d1fc25cc2f2e40),
+     W(0xe973bb1caf5718c1), W(0x9b8825dad2d6b890), W(0x7de7885ee2f00f12)},
+    0
+  },
+  {
+    {W(0x42790e88e13ab355), W(0x292ffee4bfec4882), W(0x45f0abae70dff822),
+     W(0xb4c0def8d2a4fe92), W(0xbbcea5654842264c), W(0x81b7f0513126a11d)},
+    {W(0x75173b4ff6907d3b), W(0x6778644cd15e7916), W(0x37411cbe37f9797c),
+     W(0xefd7ce17707b3122), W(0xb50fb5db6e7448d1), W(0x0ca5548307b91619)},
+    0
+  },
+  {
+    {W(0xc5e67e5496d4b407), W(0xfa5505f97f2217bb), W(0xd2c41cc83a389bd5),
+     W(0x5ddab27afe934bdb), W(0x558c6996426f2dd7), W(0x27044f71d9b15661)},
+    {W(0xf61f62cdd946bf77), W(0xc97487d50a9dc477), W(0x836a2de7cad7d0d9),
+     W(0xc1b6776e68acf6e0), W(0xc6a55abcc7f0232b), W(0x0b644ae830733d82)},
+    0
+  },
+  {
+    {W(0x3fc1d5a34b9970e8), W(0x91f06350adef6651), W(0x85b35b7f1c7c8d47),
+     W(0xb1cd1e2a402fb0fd), W(0x165f271c81147cdc), W(0x92cfef69dfd0f7dc)},
+    {W(0x953da92567a3f28e), W(0x3200eb1bc7bf9012), W(0x8a756d2e96775836),
+     W(0xb3464db9d131e2ba), W(0x6c90cc9f5c37c379), W(0x81f68736e4607631)},
+    0
+  },
+  {
+    {W(0xfb0fa0e6494fe64f), W(0x4ea468b59a907f37), W(0x9bb6d672cbabb7cc),
+     W(0x523c7c6ea5be2b38), W(0x4065adbb361c2e41), W(0xffa1299925c13172)},
+    {W(0x0eb29793f80d5e2d), W(0x862fe1ae8e4efeff), W(0xd485483e948895c4),
+     W(0x513977300d80d5bf), W(0xb4731ffc348782f2), W(0x42543c76e1a7f6aa)},
+    0
+  },
+  {
+    {W(0x0359e03c52c8cb21), W(0x7706754ace60910b), W(0x0321ad51ea305282),
+     W(0xac9518598781b1e7), W(0xb762cf45cb5d07b0), W(0xb600a7a4b2134dd4)},
+    {W(0xe13ab835c218d19c), W(0xf3832f48d9abab70), W(0x253431f8925ae2c5),
+     W(0x81465e5eb8096e55), W(0xc54111f893c82260), W(0xe9e3e69f386a20c4)},
+    0
+  },
+  {
+    {W(0x81650139b0d5c907), W(0xd38a83cfc82e0a4a), W(0xe2bcb1af4cc0086e),
+     W(0xb1c59ea70403bcf2), W(0xa67e81aebe4e5c31), W(0x81d311ffa54ca329)},
+    {W(0x7a70b6926e84d40b), W(0x178144fec644af41), W(0x33bc8b360b06dc27),
+     W(0x4f3b2c4874e286f2), W(0xafa4b46bddef21fa), W(0xb30eca0af5a7686d)},
+    0
+  },
+  {
+    {W(0xcab77a5ff08b25e7), W(0x6a78b90290acfe26), W(0x9f7150ed4553ccb4),
+     W(0x890a176e7a967e2b), W(0x7650cbd6a86ca8e7), W(0xbc243c9dcbb1b4e3)},
+    {W(0x98d13a581ed646b7), W(0x49406e826528e56b), W(0x1080cc6b146ea2a3),
+     W(0xd396b90a453bdc0a), W(0x4ddc6aa8857dfa72), W(0x08ed728f3ccbbd3a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe37211be7ef79898), W(0xa810387721344d16), W(0xfdcd7e26a1b9f8b4),
+     W(0x5641e45d7d7f72d5), W(0x5377c1bec449c920), W(0xd3edcb0cefc7b2a1)},
+    {W(0xc657a9ffe14b42fc), W(0xc8f858c800831b07), W(0x6bfcd1bcd020eaa8),
+     W(0x17534b0a3f6860c7), W(0x8ce5722284c7c806), W(0xa1d40eaf2bd7456b)},
+    0
+  },
+  {
+    {W(0xaed02b6b4e623856), W(0x7a6d2bef3e1d74cb), W(0x82226ec4654e7c30),
+     W(0x008ac003e7034bfd), W(0xe343c5407fd6b555), W(0xca1b29071b429d44)},
+    {W(0xe0702a339c3ceea2), W(0x48079aa9732694c3), W(0x7e6d72f6d4652401),
+     W(0xd92655ed35f60043), W(0xa0dbaac6273e8cc4), W(0x0bb8f0f93c3ffb40)},
+    0
+  },
+  {
+    {W(0xbc06ecab3de4ba2e), W(0xf51ca0639e491bcd), W(0xa6fc6fa0453c94be),
+     W(0x5460f943ed1a6731), W(0xeb11656a4ec3f1fb), W(0x2fcb2cabff1e7d4e)},
+    {W(0x595264678fea2286), W(0x838117a34e0bee38), W(0x7bdf588824fd2ce5),
+     W(0x13df0c839f2c2925), W(0x1bf621e6dee97f30), W(0xb43b2558ebea6641)},
+    0
+  },
+  {
+    {W(0x5906a35c1cfb991f), W(0xb62a4f80740a7744), W(0x65c8ac9136f84763),
+     W(0xf73b3debbe0f1dd3), W(0x40358868a2d26c21), W(0xd907e90a76792ae7)},
+    {W(0x3ecea167668c3d5f), W(0x731068f26754b49c), W(0x6db891090e006243),
+     W(0xd29106e6dd94681b), W(0xb40b8694a85a3de2), W(0xc80c7bf1936b86cc)},
+    0
+  },
+  {
+    {W(0x28d33e79e08c180f), W(0x768c7794f6aec9ce), W(0x5a749f3bce683c5b),
+     W(0x717629d98371fe75), W(0x5e828fc057712c1d), W(0xb46c6ed17e4c61aa)},
+    {W(0x5d927bad5bccf95c), W(0x55d6fc80d72f68ec), W(0x560a99a398591dc2),
+     W(0xc885fe8a4836664c), W(0xd18acd4226d79298), W(0x05e4cd17185df1d7)},
+    0
+  },
+  {
+    {W(0x9d8a925b60dec308), W(0xb72e3efa6b3ea363), W(0x4f53ca6ddfb534b8),
+     W(0x4e64874c6dd78a32), W(0x336e5b46c2a146d5), W(0x07c76d6398395201)},
+    {W(0xa4c095228fe3e815), W(0x887e659d3221cc26), W(0x0ff92f64c36286ec),
+     W(0x57b1b903c3ebb08c), W(0xc6bdc9b665f00c30), W(0x826242269a46d36e)},
+    0
+  },
+  {
+    {W(0xd67dc92b85653dc8), W(0x8e0970af0bc93ab9), W(0xb6f09baa8b87c0af),
+     W(0x5a8a903052760ef4), W(0x2e2ae7561047bf85), W(0xd049078f85bd4e74)},
+    {W(0xced11ff83729f708), W(0xdd21cbebd91068a6), W(0x83d488ff24b3e911),
+     W(0x6e166fda1afd2196), W(0x66a912114f0d2128), W(0xd11078ed05c9f39c)},
+    0
+  },
+  {
+    {W(0x913f92075f8ab132), W(0xd5b6792c5c14080f), W(0xefab4e2c787c3594),
+     W(0xa55d465fe7b7b7dd), W(0x921aaad834e28e6a), W(0xc4f3a35e12d6a7bc)},
+    {W(0x109803c46115a5ae), W(0xc023098ce709f9a1), W(0x1a8c8bdb99c5bb66),
+     W(0x1cd1c2b6bc7c2da7), W(0x50189c975f927eef), W(0x493823d1229f9410)},
+    0
+  },
+  {
+    {W(0xa0f2da0c78a2cbf7), W(0xd1611acbd163d80d), W(0x1af6ee1bf2cd3795),
+     W(0xc4993e08307d6105), W(0x84c3b8f8560b5f12), W(0x4f52c56347869733)},
+    {W(0x8fd9e3f728d28bc6), W(0xdbf34576e5d44bd9), W(0xf7e3a6da10d14cb5),
+     W(0xb93870990fe051ff), W(0xf6363a48f15d43d5), W(0x4bc358fcf434d1ac)},
+    0
+  },
+  {
+    {W(0xa29978fc62a8b8b4), W(0x4cc216310fa130a9), W(0xe4b51c6bf15e04c8),
+     W(0x453cf4d23f815420), W(0x1257c751c6282b9d), W(0xcd15b03c8af1af36)},
+    {W(0xe3596240514ef6e8), W(0x72a6691708ab83d9), W(0xca0a62d710e44b2d),
+     W(0xcde068128a9b8a8d), W(0xd492b261ba470875), W(0x5c7ea67cc6d7aeb8)},
+    0
+  },
+  {
+    {W(0x5049a7d3f758b1b2), W(0x60beb74f14ab97b8), W(0xdfc47828a9ff8ad3),
+     W(0x303a0cde8bb99766), W(0x53f4b45a43b9a7a6), W(0xe467aec8ca6e8c43)},
+    {W(0xb8e7db7b3f573855), W(0x5fee5a5481e760f1), W(0xe928b23385b0fed4),
+     W(0x72f02728ebae0b7c), W(0xe32abf70bb5897d3), W(0x103e8b859c572995)},
+    0
+  },
+  {
+    {W(0x87c0ef84172784bd), W(0x023128267a5f2d07), W(0xeae5c0cec9901fa3),
+     W(0x6ea74133a11144e5), W(0x740c3d2ed8e89bee), W(0x88e06131f9bb1801)},
+    {W(0x47f253754356fd51), W(0x8e2ca6ce38e45ea1), W(0xf0afe990c2ef8066),
+     W(0x91b7263d8ea03d0f), W(0x37b01664880ca591), W(0x61306f09790c8ed7)},
+    0
+  },
+  {
+    {W(0xb1d6cb737337af87), W(0x09a59a6908638c3c), W(0x4ecc3fd25d94c727),
+     W(0xa7b57269e274ba87), W(0x909cd824a61a0590), W(0xcbe63cfe3c11751d)},
+    {W(0x9574de8347c46efa), W(0xee334cda539b7e03), W(0x245bc6a2e3ef3599),
+     W(0x13a570fee88d0da7), W(0x88ede26d90ef4a21), W(0xa0c5953b01fccebc)},
+    0
+  },
+  {
+    {W(0xc8dc34f36b3bcbdf), W(0x952d337b24d72806), W(0x28b8ec817e56e8c8),
+     W(0x98e78abdbe861aeb), W(0x521773ddcf3bd040), W(0x582ffcb2b7ca45d2)},
+    {W(0x70962c0a04202ac8), W(0x31b6ac909f29381f), W(0x3b4cd403355715a7),
+     W(0xffbbd1a7399a071c), W(0xac669b08e50f02d7), W(0x0f568c89b2cf0565)},
+    0
+  },
+  {
+    {W(0xedb3abb1fe36eed2), W(0xbb2cc1e6a038298a), W(0xfa0ac06fe5adc3be),
+     W(0x7cbcef3eae73ebe1), W(0x41596590cd676b87), W(0x6cc8c0ae214391d7)},
+    {W(0x826e2e16fcb3f244), W(0x1ed7837e1be22058), W(0x83052d0d1a9912b3),
+     W(0xa2cb410c8ac3dbf5), W(0x279d555a7faa6bc7), W(0x870e7132f52b439c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x11a8fde5f0ce2df4), W(0xbc70ca3efa8d26df), W(0x6818c275c74dfe82),
+     W(0x2b0294ac38373a50), W(0x584c4061e8e5f88f), W(0x1c05c1ca7342383a)},
+    {W(0x263895b3911430ec), W(0xef9b0032a5171453), W(0x144359da84da7f0c),
+     W(0x76e3095a924a09f2), W(0x612986e3d69ad835), W(0x70e03ada392122af)},
+    0
+  },
+  {
+    {W(0x3ee0a31c6754f492), W(0x02636c6b96769ff5), W(0x90a64f4ff0fbfa96),
+     W(0x513f054efafea65a), W(0x796ba7479cf4b9f9), W(0x3198c068932a9590)},
+    {W(0x93af8a65549ee095), W(0xb8b6f72ca212760f), W(0x23bc71e9c1a46c8f),
+     W(0x000643af4c9bca72), W(0xb6d967c7848cea30), W(0xe06b6b4e73312ec2)},
+    0
+  },
+  {
+    {W(0xfeb707ee67aad17b), W(0xbb21b28783042995), W(0x26de16459a0d32ba),
+     W(0x9a2ff38a1ffb9266), W(0x4e5ad96d8f578b4a), W(0x26cc0655883e7443)},
+    {W(0x1d8eecab2ee9367a), W(0x42b84337881de2f8), W(0xe49b2faed758ae41),
+     W(0x6a9a22904a85d867), W(0x2fb89dcee68cba86), W(0xbc2526357f09a982)},
+    0
+  },
+  {
+    {W(0x52ec99561d85a725), W(0x0f9be000f3208012), W(0xe881337c6dcc7816),
+     W(0xe4e7b6d9791f7cf1), W(0xfaa717aa59885a42), W(0xb1bbb5c7f9c01e41)},
+    {W(0xcf208d58a0361880), W(0x24426e4020afa350), W(0x7261871b264ce04a),
+     W(0x66be4a86cd42026a), W(0xc5397b77829f99fe), W(0xffe4a6bc24578e2b)},
+    0
+  },
+  {
+    {W(0xadc794368c61aaac), W(0x24c7fd135e926563), W(0xef9faaa40406c129),
+     W(0xf4e6388c8b658d3c), W(0x7262beb41e435baf), W(0x3bf622ccfdaeac99)},
+    {W(0xd359f7d84e1aeddc), W(0x05dc4f8cd78c17b7), W(0xb18cf03229498ba5),
+     W(0xc67388ca85bf35ad), W(0x8a7a6aa262aa4bc8), W(0x0b8f458e72f4627a)},
+    0
+  },
+  {
+    {W(0x0733667af822d5f9), W(0xd7f81b9e18339700), W(0x7ca29b27a7bc265f),
+     W(0x9fefa698eb4f0c7a), W(0x7b6f351301f27630), W(0x72f0f152fcfb1133)},
+    {W(0x9928d9d05c81eb14), W(0xa16ac36bed8ff6cb), W(0x7fbd1acbe041bef3),
+     W(0x7d25159af8d99854), W(0x2ec3a7d8db5a0dc5), W(0xd86fc4cc87e3e933)},
+    0
+  },
+  {
+    {W(0x3fb812eec68e4488), W(0x53c5eaa460ef7281), W(0xe57241838fbefbe4),
+     W(0x2b7d49f4a4b24a05), W(0x23b138d0710c0a43), W(0x16a5b4c1a85ec1db)},
+    {W(0x7cc1f3d7305feb02), W(0x52f7947d5b6c1b54), W(0x1bda23128f56981c),
+     W(0x68663eaeb4080a01), W(0x8dd7ba7e9f999b7f), W(0xd8768d19b686580c)},
+    0
+  },
+  {
+    {W(0xba8418f34c20e15f), W(0x7eed2494fb54404e), W(0x4e6438d7bce1e82d),
+     W(0x9e489b3eb397915b), W(0xa9baea9ffb4cf659), W(0x8bc5b2ba42ef4aff)},
+    {W(0xae3fb5337e62a188), W(0xcd648493496e8e35), W(0x89728e28defe047b),
+     W(0x63a8c679d24e60fe), W(0xadacbf92470f710c), W(0xd470aeb95e198d3c)},
+    0
+  },
+  {
+    {W(0xbcd0e0ad7afdda94), W(0x95a0dbbe34a30687), W(0xbbe3c3df8c5e2665),
+     W(0x742becd8ebf2bc16), W(0x300ceb483fa163a6), W(0x0c5d02ee4663354b)},
+    {W(0xe4fb9ad6b5e606a4), W(0x93f507b8cf49ff95), W(0x9406a90c585c193b),
+     W(0xad1440c14ecf9517), W(0x184cb4759cea53f1), W(0x6855c4748ef11302)},
+    0
+  },
+  {
+    {W(0x8e3807dd7a3e874a), W(0xc4edb45b89ac3a99), W(0x9ba9cdaf4bfd77d2),
+     W(0x31d33f59b540fffc), W(0x404c87790c60028b), W(0x7f89da7189688c81)},
+    {W(0xdd3390e5504b862b), W(0xdf1e721be937efe3), W(0x5833d0df63e6036f),
+     W(0x7712527a385fbab4), W(0x6347236bd210c0d4), W(0x12d7733c8d238e2d)},
+    0
+  },
+  {
+    {W(0x00ecb523edcafa52), W(0x0da0ae0e086f69d3), W(0xc384de15c242f347),
+     W(0xfb050e6e848c12b7), W(0x22f6765464e015ce), W(0xcbdc2a487ca122f2)},
+    {W(0xa940d973445fb02c), W(0x00f31e783767d89d), W(0x2b65a237613dabdd),
+     W(0x2be0ab05c875ae09), W(0xb22e54fdba204f8e), W(0x65e2029d0f7687b9)},
+    0
+  },
+  {
+    {W(0x0ecb0723302e943f), W(0xd180ca1e4a443e78), W(0x39e7891123dd2c9e),
+     W(0xfa2a440401fe50bb), W(0x4678e7ed154d39d1), W(0x64ddaee1af513e01)},
+    {W(0x6d4c615a634904da), W(0x937c6326ba5c900c), W(0x70658f5feb6c8582),
+     W(0x2a04fd51f3d65166), W(0xcefe7472b676eb47), W(0xd3565a71f597d887)},
+    0
+  },
+  {
+    {W(0xffd825381855a71c), W(0x26a330b3438bd8d8), W(0x89628311f9d8c5f9),
+     W(0x8d5fb9cf953738a0), W(0xcb7159c9edfcd4e5), W(0xd64e52302064c7c2)},
+    {W(0xf858ed80689f3cfe), W(0x4830e30956128b67), W(0x2e1692dae0e90688),
+     W(0xab818913ca9cc232), W(0xe2e30c23a5d229a6), W(0xa544e8b10e740e23)},
+    0
+  },
+  {
+    {W(0x299520f4e5dcba80), W(0x522ad4b52b758045), W(0x54eabe27193b36d4),
+     W(0xda4d3bff45e9e442), W(0x44cb9252637311f3), W(0x4cd620a971338ebf)},
+    {W(0xec908157cc9524fb), W(0x2731a11ba8c955d7), W(0x72a5e0545cb94009),
+     W(0x7eee8f3b9126cfe8), W(0xc71e29203dd5d5ce), W(0xe886f91a22069494)},
+    0
+  },
+  {
+    {W(0x1c15e569dc61e6cc), W(0x8fd7296758fc7800), W(0xe61e7db737a9dfc5),
+     W(0x3f34a9c65afd7822), W(0x0a11274219e80773), W(0xa353460c4760fc58)},
+    {W(0x2fb7deebb3124c71), W(0x484636272d4009cc), W(0x399d1933c3a10370),
+     W(0x7eb1945054388dbd), W(0x8ecce6397c2a006a), W(0x3d565daf55c932a0)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x294d29550db962c0), W(0xd6994ef46d523ab0), W(0xfa1a7f9158f95037),
+     W(0xb137981164420c94), W(0x2b686e1e093caea8), W(0xdef10944f9e1c340)},
+    {W(0xcd1beecf611d9bf5), W(0x34696c50a1b5267b), W(0xcecbc7192dfc2b16),
+     W(0x2cdb955dcee7e854), W(0x9fefc321f2635cc8), W(0x276d2e4f2936f7d3)},
+    0
+  },
+  {
+    {W(0x4962c02167141724), W(0x5f81eabeabe7762f), W(0x78549a79dd189c3f),
+     W(0x47675cdd6ce517a7), W(0x5102294e32d6bb97), W(0xb19500c66ed1a029)},
+    {W(0x3efb54e8b16a206c), W(0x7dbdcc250dc135b8), W(0x955bc2948967fb04),
+     W(0x373615c9be04e909), W(0xf1fcf820111efad6), W(0x8530f97d6fd2e97a)},
+    0
+  },
+  {
+    {W(0x85e1e4abd5281f9b), W(0xc7e517ddc653b0c8), W(0xc0b84da1a717e034),
+     W(0xf1a63b280f1bf3df), W(0x47b74201aba6fd41), W(0x9cf3da633518fcab)},
+    {W(0xe12511fb23bb6e77), W(0x13b2cb4438679d79), W(0x20e0fb10db5665c0),
+     W(0xb5448a33b99f4d5a), W(0xcb1847ad46b7dbce), W(0x41f156b8fdcadb87)},
+    0
+  },
+  {
+    {W(0x3f2b5bd4b4805410), W(0x201ca7a9f96c5ee7), W(0x532ef2db94256fe1),
+     W(0xacbfc459318ddb03), W(0x2375f9fd5f24c8e1), W(0xd27c479b370783db)},
+    {W(0x1bd461e856541ae6), W(0x78f054a77f7ea49a), W(0xc9f8777d8845f315),
+     W(0x81aed29697fc92c7), W(0x9f2f8d7949929540), W(0x7531e78bff5ebfe0)},
+    0
+  },
+  {
+    {W(0x397049f4c785c7ba), W(0xa87db27da1decf9d), W(0xce6d5ec1e7862c0c),
+     W(0x17a98db834350bf1), W(0x6ceccd8030ec8d74), W(0x4790cc07bcab4aa8)},
+    {W(0x4378b1feb4f771a8), W(0x3c54588b404dfcbb), W(0xbddf0faa8d60f86d),
+     W(0x987583da3573271a), W(0xb0afe4ec4b8f8032), W(0xb5c44605b69d03f6)},
+    0
+  },
+  {
+    {W(0xbd9a66d6543b3e41), W(0x2948c0a62ae73774), W(0xa75151dfef38e9b3),
+     W(0xa3348ae5754fb3fb), W(0x1218fa8f13069b72), W(0x532bb0510835dfaf)},
+    {W(0x2121a98edf2be3c6), W(0x85980de69e5199bc), W(0x1b23a4be1a1eb6ee),
+     W(0xb5c48b92adeb3ae5), W(0xeebd305dedea2b45), W(0x20543f04c37198ea)},
+    0
+  },
+  {
+    {W(0xf73471b5ef349ec5), W(0x014dae75565aa6c7), W(0x57cb497dae082cef),
+     W(0xdfcbf2b5c3e563bc), W(0x22149c0fd1125f95), W(0x529f419b425bc019)},
+    {W(0x049476deaee2094c), W(0x3490c0490cbbb583), W(0x56c5c62d1256424f),
+     W(0x0a118ee541bc66fa), W(0x0d8e9ff8296ada14), W(0x34356e8b0134f8c5)},
+    0
+  },
+  {
+    {W(0xd0960bd80fab968c), W(0x6899e4faae028db0), W(0x975ccc77a9850916),
+     W(0xb41bd531e5f81554), W(0xbdf8ab57c8cff2c8), W(0xea306a01f5822be3)},
+    {W(0x1f0ac0e7befbdbbe), W(0x72f4b0e960519f87), W(0x22bd8b82e3cc86ab),
+     W(0xc43bde8d2b2beaee), W(0x8168781e412617ff), W(0xc5610627b7ee7096)},
+    0
+  },
+  {
+    {W(0x33f7a6d88d29b7c0), W(0xa34f2a838df5b613), W(0x0fe81538055d3829),
+     W(0x4e1e2d1bd4633e59), W(0x0cc0bb7311bd0dac), W(0xdd282d75e32f5298)},
+    {W(0x5bc6aba3d35a57ae), W(0xa1621c8d79deefb7), W(0x960d5cc043672e7d),
+     W(0xfc1cd0b4f7e40305), W(0x518bc48ced6837f9), W(0xe259d985f34692b6)},
+    0
+  },
+  {
+    {W(0xc408553840671bd2), W(0xccb74902599f8eba), W(0x477a4a098d65e832),
+     W(0xc620c314f1241626), W(0x05f2f152e7344054), W(0x2483a2d96d83320d)},
+    {W(0x167439d70e344da8), W(0xa0c02b1b1002fb36), W(0x46cb4a7030afbda2),
+     W(0xe74e3488229d4efe), W(0xd371dce21cef3aec), W(0x96e0592c7c3f2521)},
+    0
+  },
+  {
+    {W(0x675c3c18dfc821e7), W(0x033aadce1ea24dc0), W(0xc07b73b4c2ff6bbc),
+     W(0x49f8891165965b99), W(0xce4d221ac2b10c05), W(0x174ff6b937a02e69)},
+    {W(0xba6b09a493e737a2), W(0x4e7d7b64638d8662), W(0xf3d3c9dc04a28bda),
+     W(0xad7ceefb3468901e), W(0xb29d2c5f559f7dc2), W(0x2951e62cd0abca44)},
+    0
+  },
+  {
+    {W(0xdec0e091cc5f4a6e), W(0x055ff295201108d0), W(0x2b371998dc202800),
+     W(0x1b650d830d5f5f9d), W(0x29be5503a0226262), W(0x0f3681ac185bf3f1)},
+    {W(0x4f5c44b48c3e2c4f), W(0xcfe74a51717814fd), W(0xb0ce41837b52a561),
+     W(0xde143e3aee634895), W(0x08f8310048d46b2f), W(0x34b79d556386486d)},
+    0
+  },
+  {
+    {W(0x2c110020b03cda8b), W(0xe7367150841a98b8), W(0x53655e88cd0771e2),
+     W(0x6a8f335f830dc7a9), W(0x81270424299a60d7), W(0x89e15f8a2133090c)},
+    {W(0xa06a51aae8cde604), W(0xe94af745980f9025), W(0xf2bb41a3db59d630),
+     W(0xef857356533c1d76), W(0xd3fac2e4af6c83d0), W(0x7cab81eeaebcf3d4)},
+    0
+  },
+  {
+    {W(0xa60659c4ee1388ba), W(0x475a4d067eca29dd), W(0xf1ef88c166470e08),
+     W(0x71cac87a687c716a), W(0x994fb1ee86f43fff), W(0x53ded2ef43384658)},
+    {W(0x317d902456c41587), W(0x6807f0ad9dea0f26), W(0xfee8beaaa0b0d53b),
+     W(0x15c06a1fb0288c94), W(0x4b9eab0347028bce), W(0x6d2144351446bc6e)},
+    0
+  },
+  {
+    {W(0x25d25811f0c1a2e7), W(0x22a926c1f1c6831e), W(0x710ae02e44ecaa97),
+     W(0xeaa99aa0ad05c094), W(0x1c8599f059b36104), W(0x2184e304b2e94c9f)},
+    {W(0x83beaebb0aed8248), W(0xe1292640d1cff679), W(0x6a38fe1a9487c079),
+     W(0xdcccac90359fdbc3), W(0x6901e22cb4b8ef24), W(0x05715bd5a9ae0656)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0869457a01a8eb44), W(0x522239857a7bedd7), W(0x2c04b0c600057505),
+     W(0x468be6e80b09adeb), W(0x2f3bf32b6f81474f), W(0xf54f949da712ccce)},
+    {W(0x292cee424cdd8f2a), W(0x3d9fdf6b9c221be1), W(0xe54da66156f47b2a),
+     W(0x2ca76835840b5d1b), W(0xb52adb6a8a6e8cf6), W(0x8b416a6bdade153e)},
+    0
+  },
+  {
+    {W(0x65f7d2c18565afc9), W(0x764c897170fa7b82), W(0xe268634c986436f2),
+     W(0x6334d8d133356165), W(0xf17164269ec7957d), W(0xae834331b8093983)},
+    {W(0xedb1fe5cd2dfcce7), W(0x6195b86368463e5c), W(0x746e5f4da691b665),
+     W(0x61171291e1e2727e), W(0xbb4aa8f16f27b029), W(0x1037657d7f42c197)},
+    0
+  },
+  {
+    {W(0x2af8bdfa970f96ad), W(0x19d09a6dd0c86e6d), W(0xd57fd5ced7046d2e),
+     W(0x5ea025f7d545fd33), W(0xe2ccb6f43161ffd7), W(0x3ca5286209406242)},
+    {W(0xf3536d60b5c90905), W(0xd086e3b9d5b290f6), W(0xfd15b06a5cc55444),
+     W(0x61b0febf9a9e2a66), W(0xdc3c0576653dfd02), W(0x357774230a8ab51f)},
+    0
+  },
+  {
+    {W(0xfe19901b0d5b855a), W(0x5facb9552f745022), W(0x92fd012556c4ce5c),
+     W(0x23172d65938c89ab), W(0xa71f8a33aaa587b1), W(0x511a3745b55c9c50)},
+    {W(0xec005f6a7185086e), W(0x6dfc2761f894c6ab), W(0x98a4d67f9e26361f),
+     W(0x7f0a2b2321389c25), W(0xd158820795ffbcee), W(0x4d6b29ab9f36a888)},
+    0
+  },
+  {
+    {W(0x5ffec1d78c04bc6e), W(0x35f052d16ca0dde2), W(0xfbe3844c649c850b),
+     W(0x450263e610fa337d), W(0x44f7c8f40280773d), W(0x27de5d3ce896966c)},
+    {W(0x2587f47598d0378d), W(0xbd49c97f4e4f6e49), W(0x9e902f667071543a),
+     W(0x03398aae06577b74), W(0x030926d6910bee13), W(0x5576575bffa92cec)},
+    0
+  },
+  {
+    {W(0xe4ee33460562cd7e), W(0xd1d385a3f01ba45e), W(0xd817ca667ce11848),
+     W(0xda222cddcb69c7ea), W(0x74ac74709d680afe), W(0x3770357cd9596ca8)},
+    {W(0xdff57da7f7759bd6), W(0x090426be20d5c726), W(0x71c0ba28b7fbc1b0),
+     W(0x60faab1c13d4ed0f), W(0x6fbe3567ea3a2ef2), W(0x0dd3835c4e577dff)},
+    0
+  },
+  {
+    {W(0x9b758b512ce27e38), W(0xe4148475a39855e3), W(0x4669b3c39ee88a77),
+     W(0x3f36a671105e1ec0), W(0xd0f30e5d9e88ea13), W(0x6346df15baecbaad)},
+    {W(0xec65be65cf4c6510), W(0x843efca194e1989f), W(0xf7195d29942ce52b),
+     W(0x12201877d3ce28d4), W(0x9c962aa1a97fc904), W(0xc4fedb3465c5a55e)},
+    0
+  },
+  {
+    {W(0xeccb421ed0a701a5), W(0xad4cb9a5b60cd286), W(0xd344da9e05a53972),
+     W(0x3a8035e07bc99fea), W(0xe0214485c0f77bf5), W(0x50ada30ee54df78a)},
+    {W(0xdef45af64ec2d576), W(0xa05d61845f9a8678), W(0xa9b17db1c337e017),
+     W(0x026a4f66b84671d5), W(0x606142343b7d696d), W(0x71ed9aaf81cfd22a)},
+    0
+  },
+  {
+    {W(0x62805305695a3f30), W(0x6ce27626e28e8fe0), W(0x507386af6a54f410),
+     W(0xf8c5f738cd5c7eff), W(0x3ab2db9e347e85d7), W(0xf5b635b0b2161b68)},
+    {W(0x99009791be2e80ca), W(0x6dff3030c13910dd), W(0x2beeca057ee8700a),
+     W(0x12616fb11ac7e09d), W(0x38c9ef9f9037c2e4), W(0x39181fbf9c140344)},
+    0
+  },
+  {
+    {W(0xcdd6aee47aa54433), W(0xf5ecb432b80336f5), W(0x690bb949a1380829),
+     W(0x219d659ca9c9d720), W(0x74abf2dd7e5a3260), W(0x405ee136025c55d1)},
+    {W(0xc5c592cb1cc878a8), W(0x119a38be88b31ecf), W(0x4fb00f82e94e39e7),
+     W(0x66bf72e59412c068), W(0x9337c8f30821142a), W(0x477216340c24ab67)},
+    0
+  },
+  {
+    {W(0xa6c7953457fe953e), W(0xd70d3d2f3c76ae58), W(0xe1e047b52c531c84),
+     W(0xc71f3a9973735602), W(0xd70bdb0f7ba0628e), W(0x280fdd4e0e3e3c0c)},
+    {W(0xb5a3f5823e414e26), W(0x55b2eda8f44dee7e), W(0x8e1d024b2f5dd828),
+     W(0x21f054eb3b1bfdf9), W(0x3d3ae74cc554e1cf), W(0xa0a5863ffc42ec16)},
+    0
+  },
+  {
+    {W(0x1b76a3c5439ada39), W(0x818829cf89236ae5), W(0x2277cb7a750f8129),
+     W(0x44aa462a4d46502b), W(0x7a12e1e164f06dc8), W(0xb9a3300dba5630cf)},
+    {W(0xd2cc8d9c55b05f4b), W(0x6d0b0b88a700be7a), W(0xa7be99699617500c),
+     W(0x2b5b8deac03f8a50), W(0x712f703e785b3dfd), W(0x96a5a60accf93950)},
+    0
+  },
+  {
+    {W(0x9838155fbf9f72c6), W(0x3ab3cb602c10e57d), W(0x7ac228ef14bcd75e),
+     W(0x2c167e15027923fc), W(0x678869d1267471c7), W(0xeba35e857ec3582c)},
+    {W(0x22d290a9a3478eb3), W(0x542092ca1309aa14), W(0x8bb5c69be2e5d3ac),
+     W(0xf83c5a0a81652736), W(0x9cc576227280cd6d), W(0x6653436f3b0f49a1)},
+    0
+  },
+  {
+    {W(0x7ad1f1bab497d900), W(0x9d0512236c9dd5d7), W(0x0ed27e5bffed3df8),
+     W(0x659028a775d2fa72), W(0x69bd68154581f377), W(0x142c2088e2faf671)},
+    {W(0xf9c1b8a499b000ff), W(0xf31d01b18f408d3a), W(0xa7aa142f42b9d35b),
+     W(0xeb8aa74ba0495da2), W(0x824cc32a59a1da45), W(0x3f1fbe0ff5173374)},
+    0
+  },
+  {
+    {W(0xec9071a634238c30), W(0x6dd6c38b88a0f423), W(0x3adace72992e7977),
+     W(0xc90b941b1ae5166e), W(0x052aa3e9e3e43a68), W(0xe9b1976da733a950)},
+    {W(0x0e1ca28e5ff6c9db), W(0xd1bd4350387409a2), W(0x5943cc7089155117),
+     W(0x8e85794f5feae20c), W(0x0d118fd669768ccb), W(0xc647179d53120895)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfeb984b3ee828fba), W(0x8273f830e2bd188c), W(0x177ef97e3ca0a99f),
+     W(0x76d4796dacc000ac), W(0xbad0fa6eb140f51a), W(0xb275656706ebc810)},
+    {W(0xf89eb78fa18cb32f), W(0xcfc37eaea65285b0), W(0xe2b29cfbb25e9d1b),
+     W(0x9388ea8fb4e7aef3), W(0xee606c12e267e845), W(0x6b103c549f5806d7)},
+    0
+  },
+  {
+    {W(0xcf947c0644ba39e6), W(0xf5d5216cedfe78d7), W(0xd00115c05f1835c9),
+     W(0xdf084152d8c79d90), W(0xc0c3a6846db5f791), W(0x40514451749b18cd)},
+    {W(0xd314b7d5734df3f1), W(0xbccdd3f07f541415), W(0x97ed5af06855a942),
+     W(0xea84ae9ee9d02ab9), W(0xb87e90343238a5d0), W(0xd12d25c3650a0eab)},
+    0
+  },
+  {
+    {W(0x357540ab903ff177), W(0x225280b8276af514), W(0x33d273ac14d7fed3),
+     W(0xfef6b9ffd186ee3d), W(0xa94c207101a7b1d9), W(0x4ea3627450bc8bc2)},
+    {W(0xc68959c9fa98a918), W(0x8f5ecceec7bdc262), W(0x7a73a4fce6861310),
+     W(0x19bcac90c828330f), W(0x73e3b66f7ef74fdb), W(0x60f7698352d8f2f4)},
+    0
+  },
+  {
+    {W(0x58225208ecbafb80), W(0x4f212035aa73d6de), W(0x1224e45562fe86db),
+     W(0xa8c8a4782dc5b2f1), W(0x8a957b8dc3096555), W(0x6a3248b0b1591452)},
+    {W(0x1e563c58cb604c18), W(0x32808cb59bf1045e), W(0xf8f62de99462e7a2),
+     W(0x6b3dfe91c2489214), W(0x6c1d8fc42174639c), W(0xdfca11b8ef88d4b5)},
+    0
+  },
+  {
+    {W(0x6eda384fccc0df0e), W(0xd3ca97ae8c928257), W(0xc441e6af10e01b57),
+     W(0xac962bcae1175185), W(0x72d34d676f0dfcc6), W(0xee09bff3a94121b4)},
+    {W(0x77dea1468d53b73d), W(0xc2e6d3da2b057130), W(0x625ac09dd5d17db1),
+     W(0x579edeadb45a6e94), W(0xa659282a841f8caf), W(0x43747e7dc11a7b8e)},
+    0
+  },
+  {
+    {W(0x7d0850b43fc385de), W(0xf95de545b7015155), W(0x68cef1f891cb7556),
+     W(0x27a6ba789d3b6afe), W(0xf220f9c1f83b46e4), W(0x64d3e9ebf526e059)},
+    {W(0xedf3cccadc02f0d3), W(0x5e4785e6167294ef), W(0xcc09d9e98cc78d3e),
+     W(0x391bc40b5fa48469), W(0x22bcdcd522686001), W(0x159b9fa57c59973a)},
+    0
+  },
+  {
+    {W(0x9de8555c1eee5e8d), W(0x5abc844fbadce139), W(0xf17f0285de654b80),
+     W(0x33998d88802be80b), W(0x4095923d5ad823bf), W(0x71dbb084e848f6b6)},
+    {W(0xc6e950187d1e5e9a), W(0xf2bba340161a1c1d), W(0x0c3f1be7a7055874),
+     W(0xb6526718441da477), W(0xaba3b06f9c48d4c2), W(0xa1ce91f8086f18de)},
+    0
+  },
+  {
+    {W(0x5a4a5ce418690ad0), W(0xd0f788e0fe27f51a), W(0xd459388e4efe9a30),
+     W(0x3a45c11aef9d074b), W(0xf68ab50b93ab9cb0), W(0x62fbc397ecd9a566)},
+    {W(0xbfb79b7fcc587a7e), W(0xfcf4d66f92870bae), W(0x4f31aa21877390f0),
+     W(0x2de0c645e314cfb5), W(0x56d904f6238eab12), W(0x4d104a42ccb4d4f6)},
+    0
+  },
+  {
+    {W(0x26085c2f306f4ea7), W(0x774bbfc6c539a76a), W(0xd3e446e52f70ab0d),
+     W(0x3d6118141f59e806), W(0xdfc6daa0177fdf9d), W(0xe999fd515ea94e45)},
+    {W(0xd6334e9373f188bb), W(0x686e0232f1d0673a), W(0x8e0bc6572e58289f),
+     W(0x7ca7736260f9adca), W(0x00d9b65772f829ba), W(0x20d536331fef5939)},
+    0
+  },
+  {
+    {W(0xb699135818990d90), W(0xd1d6bd49379da594), W(0x7b9ccef26f99a3c0),
+     W(0x873a6d42aed3dd08), W(0xb0bcbaf229a664b7), W(0x89dcac3b9e0a21e6)},
+    {W(0xe80473d33a1d4dcc), W(0x05b20c65164d49a1), W(0x5507b308a726f5e3),
+     W(0xbd8cbfa1a21a953a), W(0xcd682268ac9512c6), W(0xe01cc26acc86d344)},
+    0
+  },
+  {
+    {W(0xdb4ddd9f9de9995b), W(0xf6696265bba63bd0), W(0xf699ffca6fa21da5),
+     W(0x6d0c39c2319f3470), W(0x02eac01297228222), W(0x183c70098bacf07e)},
+    {W(0x851017dd6e933387), W(0xe2b48b8b4f5e8cb7), W(0xb9acd8e165ece333),
+     W(0xb70b7af9c5d7053f), W(0xd276824c0293d1fa), W(0xdfb27c00a75c0053)},
+    0
+  },
+  {
+    {W(0xc654e6708251a424), W(0xa905ef0d99f354d3), W(0x15d842ae5ff1c543),
+     W(0xf4b99fbf4f5885b1), W(0x7b35641a016f3f1b), W(0xf55428a617a9fba7)},
+    {W(0xd870c6ea41786632), W(0x55de685e853ed8f3), W(0x34b7c1d8fd65f8a0),
+     W(0x4198645e00ef9244), W(0x4fd36fe1c94ff23c), W(0xa8a382bebc6cc034)},
+    0
+  },
+  {
+    {W(0x239d438317634e42), W(0x68de209fa3f82d52), W(0x2200bd17fe96242e),
+     W(0x47057ebc8a11efbc), W(0x8228544ffaa95495), W(0x5ab74220e4c8b6f9)},
+    {W(0x6cdeeb72b8ccb0f0), W(0xf63ad9c7b5886c26), W(0xcc89c80275d26eb6),
+     W(0xb1eede6678ef5e7f), W(0xf38848375b111ead), W(0x900c04dee8a8f341)},
+    0
+  },
+  {
+    {W(0x813e4f8f81d5b453), W(0xa6b477595ba2471d), W(0xd56cd6cff584da33),
+     W(0xa68bc7ddd94def83), W(0xecc50499093e76e9), W(0x852bd5d178d7fcab)},
+    {W(0x9f292b400ad4745b), W(0xd4d6cb49a0ed85ff), W(0x129cbb08cd578e09),
+     W(0xdbcdc96a10438ce0), W(0x9e7655b695fcd652), W(0x524fa6452563e3f0)},
+    0
+  },
+  {
+    {W(0x3943c2cbcb6d76dc), W(0xbcf349f73cbef2cf), W(0x087797a1c5fa646b),
+     W(0x65755583262c2097), W(0x84b667fbb5f7da52), W(0x475214ca5f3f3d96)},
+    {W(0xe414031ec231089b), W(0x7b3ac53022a53dd3), W(0x96dbc6a0b9730020),
+     W(0x8fa86922c0edc961), W(0x2541dcded528233d), W(0xb14e7570973bfe22)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3eb83a8729358cd3), W(0xad741295b9c6d430), W(0x57b8c77a53abe4e9),
+     W(0x0a14673ebb9feb82), W(0xc0a6cbf7f26f922e), W(0x213de299a32e526c)},
+    {W(0xca417e677b6ca858), W(0x8d6ae0f7fc2e0900), W(0x2bae0e7a62e135dd),
+     W(0x962bdcaea7ee82c7), W(0x573d7f6ae5776c74), W(0x9c4de6496ffbefeb)},
+    0
+  },
+  {
+    {W(0xcbc0bb1968916917), W(0x0bbb9f921094bf88), W(0xf62cb350d3806442),
+     W(0xe4d2f1cc397a7602), W(0xa54bd48e43987d82), W(0x77b6f8314f0a19fa)},
+    {W(0xfa0c9a456e766443), W(0x995ae0fff51ba70b), W(0x8e242c5b9cbd8d33),
+     W(0x1671eb0813d97956), W(0xccae388f40da55fa), W(0x97cc48faf376dce5)},
+    0
+  },
+  {
+    {W(0xe54d92cdef01fc5f), W(0xc46c2ab8dda2e25a), W(0x7c907fd2849f6142),
+     W(0xbb11dd2dacd0202d), W(0xa4913a701d92d19a), W(0xe9a26ae0cf610677)},
+    {W(0xfff1e1d5538943c5), W(0x5943dcc4a47b2204), W(0xcafcf33a92cabf71),
+     W(0xd571e13ce329d1ad), W(0x7626ad237a9a0e4c), W(0xf0aa0d9f130d7f86)},
+    0
+  },
+  {
+    {W(0x8a89daefebc5557c), W(0x7ca71403275e1649), W(0x48d923775b80bb4a),
+     W(0x0a587c52a45b3626), W(0xdaff503cc75bfe91), W(0xd845d3e6116d07d7)},
+    {W(0x6b5a4715a51eeca2), W(0x34ac02bd74481991), W(0x8f076cfc595abf8d),
+     W(0xc9de4ce9ed0391ce), W(0xaaaad03ae1fcabd3), W(0x8d48ec0087b199ed)},
+    0
+  },
+  {
+    {W(0xb0641d09bc9b2654), W(0xf9fcc2e68aa8fa35), W(0xd12a5b4b00d5ec6e),
+     W(0x9be1a1115569d89a), W(0x9c0566deffac7208), W(0x7a9fd4ff7034edf1)},
+    {W(0x636aeb6b9571c375), W(0x60d05aec55cdf187), W(0xf4e2f898734e9d2f),
+     W(0xdaf742195ccdc6bc), W(0x9d39249f608a4f28), W(0xb5f1bb5e8820e2c3)},
+    0
+  },
+  {
+    {W(0x62024812603dc3dc), W(0x25dc5337efd67b57), W(0x86b3eb38d7f033fd),
+     W(0xee3226b232646d6f), W(0x8c4825f6f1dae596), W(0xd2303055a5bcb8e5)},
+    {W(0x904a53493c0baa76), W(0xe60f6125e08646a7), W(0xaf6a329f21d45f89),
+     W(0xf20ad88a06605546), W(0xcf7a0e9619a93d14), W(0xf1eabcc891c97174)},
+    0
+  },
+  {
+    {W(0x59edd2640f3e541f), W(0x318674b582b76ba8), W(0xbf4a0d304e7f0716),
+     W(0x36fc0e4119b88200), W(0x91db560240da801e), W(0x638371ad2c72c2c7)},
+    {W(0xfe960c25d5822da7), W(0x7a7571d14a7415e1), W(0x5a6480febccc1576),
+     W(0x72f4e5e5c3c88f47), W(0x224e7e749a7bd8ec), W(0x3ebbf52c7631455e)},
+    0
+  },
+  {
+    {W(0x42c9fad511a224e6), W(0x6b6aeb8b69b2ac26), W(0x0cf4c7fdb149854b),
+     W(0x4a7d90002fc359eb), W(0x9ff0c3ea29ec8603), W(0x157ae7859b24ee14)},
+    {W(0x638c809a8979e9bb), W(0x347dfb2e7869d8c5), W(0x2fb1e0f8a07ea547),
+     W(0x1e580d32aecdec3f), W(0xbbf895730f74025b), W(0xeb94d71bdd529164)},
+    0
+  },
+  {
+    {W(0xdc5909e3f1687d4c), W(0x4fe3be46d431c5a7), W(0x28c41a035f9807be),
+     W(0x2c4203fd12f1f8da), W(0x13f12da450a19620), W(0xc32f881eae2e9835)},
+    {W(0x56328ef7622587d0), W(0xcf785f038f209f66), W(0xb562ea70a2697748),
+     W(0xa762289055598769), W(0x9842bfa8fbf41fd3), W(0x304c3057fa401ba0)},
+    0
+  },
+  {
+    {W(0xc995b0171552c477), W(0x6f92a95252351781), W(0xa9d4bb6c4da25daf),
+     W(0x2b02828e3cf6aab7), W(0x5f4febed11fa4d0b), W(0x42f0e61ea12d9d37)},
+    {W(0x1ceef875d24610d0), W(0xa7c85c485d4eecee), W(0x33fcfa3b79340a49),
+     W(0x3671e563b00b3491), W(0x871f74e493eade0f), W(0x1ed095182c546f3e)},
+    0
+  },
+  {
+    {W(0xa70aa6781250954b), W(0xe4a2f7cf2930f3ed), W(0x3e3dd26666fd719a),
+     W(0x500166cf792ff463), W(0xeccd32cd75cf00a6), W(0xb65f46a5c4526e56)},
+    {W(0xfc3a99c360aa8cd7), W(0xe04a18b31290b20f), W(0x957139a218cb9326),
+     W(0xf6b352ce11fc04a5), W(0x9314b80778534e64), W(0xd4a265c52d8f5015)},
+    0
+  },
+  {
+    {W(0x9dafbe96491ddae9), W(0x92c60b897741da5f), W(0x1185b001b866ab14),
+     W(0x7a43b9cfca7f2f81), W(0xaaeb5efc6ee8fdfc), W(0x1f7cc70022beba9d)},
+    {W(0xa212724722e3e7cf), W(0xb98dde1e9e723477), W(0x87832183ac89706b),
+     W(0xdfb92ac1ff72f1d5), W(0x5877fe6daade3804), W(0x7ddde4a79170b9ac)},
+    0
+  },
+  {
+    {W(0x239cccd8179fac91), W(0xffa076063829d42e), W(0x75b8589cbd42a0ec),
+     W(0x012f5e80d7f2292c), W(0xdcee7efd99c14665), W(0x4925256d23650737)},
+    {W(0x847c86ecf3cc64af), W(0xdd34a75feabc04fc), W(0xc2f73b3ac6a1f710),
+     W(0xe16e317565cbf6fc), W(0x9cccffee351461d9), W(0xe3d635543b4fe4b9)},
+    0
+  },
+  {
+    {W(0xf3a1a9797aeefd73), W(0x3fb166a09537abf7), W(0x39e8c469d4c37607),
+     W(0x3efc85650e3f034e), W(0xc955c2dff9c25655), W(0xd6ce96ec260fa449)},
+    {W(0x5383a8b831d8e6d4), W(0x3aed2e761a3595db), W(0xbd269c39e22a0f45),
+     W(0x4c82238694a7a83c), W(0x362f08055731bd0c), W(0x7dc1e7ee0527be95)},
+    0
+  },
+  {
+    {W(0xda8f7878c715abf4), W(0xc62292a5a5830c4d), W(0xfcd30f7e4b46acb9),
+     W(0xb931f1ee39a73db2), W(0xf838a5c84ee1afb0), W(0x15609b57c202a921)},
+    {W(0x2e21871620bbba58), W(0xe1d2fa14ae2615cd), W(0x0a4dcf3543946185),
+     W(0x2e80d804730d2490), W(0x5e43dc17794246b6), W(0x7b3588c8dcb3be9b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfa2db51a8d688e31), W(0x225b696ca09c88d4), W(0x9f88af1d6059171f),
+     W(0x1c5fea5e782a0993), W(0xe0fb15884ec710d3), W(0xfaf372e5d32ce365)},
+    {W(0xd9f896ab26506f45), W(0x8d3503388373c724), W(0x1b76992dca6e7342),
+     W(0x76338fca6fd0c08b), W(0xc3ea4c65a00f5c23), W(0xdfab29b3b316b35b)},
+    0
+  },
+  {
+    {W(0x14f962e404a8313d), W(0xc6e3e7c45f1f5a26), W(0x2c0e11c079e777be),
+     W(0xa1705efb4657c31b), W(0x02688fd23c494de3), W(0x75664a84412a8718)},
+    {W(0x878fc7ad7a422f8a), W(0xe5d581df7419bd0a), W(0x7c813c4c704b70c0),
+     W(0x98553da87323c008), W(0x4f63cec663089f1a), W(0x9626d6fa9655d291)},
+    0
+  },
+  {
+    {W(0x84e5541f483aebf9), W(0x8adff7dc49165772), W(0xe0a43ad69beaad3c),
+     W(0x97dd1820f51c2714), W(0xac2b4cb457ea5b0c), W(0x87dbd011d11767ca)},
+    {W(0x18ccf36cbfc7957a), W(0xd4a088411bc79227), W(0x9811ce43d8d292a8),
+     W(0x72c5fc68d58c4ee7), W(0x5bc0f0bed35c65a7), W(0x0b446dbccbbf9669)},
+    0
+  },
+  {
+    {W(0x10586ea7507f8b27), W(0x1510deb9a261f7d7), W(0xa42fc4d7dfbfa352),
+     W(0xbf38c3821e1c2291), W(0x46e40ef60e11760a), W(0xc24f6061dcb974d7)},
+    {W(0x755b105ba7619027), W(0x8004bf09b8ffa759), W(0xa630d0b00945db60),
+     W(0xa160ac9cf2809e1c), W(0x38fc1113dc6c95c5), W(0x01f540985d52574f)},
+    0
+  },
+  {
+    {W(0x7eba3da69cee9bce), W(0x3e2c1248d5377750), W(0x8c917d982b93d8b2),
+     W(0xca8fc6ac7cad1f75), W(0x5f581f19a0ff150a), W(0x872cc14ae08327fa)},
+    {W(0xc774f187e9333188), W(0x528ed4ac497af7e8), W(0xce036e9b8ad72b10),
+     W(0x463f9ebb917986cf), W(0xbe5163281325cf9b), W(0xd28d5c50dd7e5fea)},
+    0
+  },
+  {
+    {W(0xa4e9f29f0b237b7b), W(0x8ed65b094270ee2d), W(0x0e2184e42993359d),
+     W(0x4f96ce7f224d5aa3), W(0x0862e2003a132c48), W(0x5bbc6ad80f015f5f)},
+    {W(0xab9d5149d7162f5c), W(0xfe6577291267e5d2), W(0x4865e671c1fd96e2),
+     W(0x7baf4dbe71a703b2), W(0x83dd6cf9142add10), W(0xab4fc1aa98461d30)},
+    0
+  },
+  {
+    {W(0x714c1d1bdd58bbe3), W(0x85ba01ae039afd0f), W(0x7f23ea3a6951ac80),
+     W(0x5c599290ac00c837), W(0xf6efa2b3bf24cc1b), W(0x393d8e421e84462b)},
+    {W(0x9bda627df8b89453), W(0xe66fff2eb23e0d1b), W(0xd1ee7089c3b94ec2),
+     W(0xf75dba6e3031699a), W(0x8ff75f79242b2453), W(0xe721edeb289bfed4)},
+    0
+  },
+  {
+    {W(0xcda68a7e698ee21c), W(0xc7414d196a5e725e), W(0x483be2dadce20b91),
+     W(0x7de1601cfc69dca6), W(0x4bec17aaac4f9891), W(0xe8741dd18d479a56)},
+    {W(0xc623cb8dac23a286), W(0xe20a96b5166133f0), W(0xda9bb7c030dcde61),
+     W(0xf84ea3273a1733fd), W(0xd7afb6c3e82fac31), W(0x37ea7d35d3897449)},
+    0
+  },
+  {
+    {W(0x083215a1c1390fa8), W(0x901d686a6dce8ce0), W(0x4ab1ba62837073ff),
+     W(0x10c287aa34beaba5), W(0xb4931af446985239), W(0x07639899b053c4dc)},
+    {W(0x29e7f44de721eecd), W(0x6581718257b3ff48), W(0x198542e25054e2e0),
+     W(0x923c9e1584616de8), W(0x2a9c15e1ad465bb9), W(0xd8d4efc716319245)},
+    0
+  },
+  {
+    {W(0xed85257efd028642), W(0x93657f45b96a2068), W(0xfef64edaa13ac381),
+     W(0x108f6ff256c557a3), W(0xe690d92b9204e3f7), W(0x902a3e3803ef8640)},
+    {W(0xaefd49226416f50e), W(0x9b272152b7eae8f0), W(0xa911921f29d93d8d),
+     W(0x7c6bc4995eeeea56), W(0xbd3439d83ca7c720), W(0x2f8cf2e3c39b208d)},
+    0
+  },
+  {
+    {W(0x72dc79439961a674), W(0x839a0a52a0e13668), W(0xd7a53fa9334945ea),
+     W(0xdb21db77e7aa25db), W(0xb6675a7d66e96da3), W(0x2c31c406e66f33c0)},
+    {W(0x45020b626ec7b9cb), W(0xff46e9cd0391f267), W(0x7dabd7440fa2f221),
+     W(0x9a32364b9d4a2a3e), W(0xf0f84ae852d2e47a), W(0xd0b872bb888f488a)},
+    0
+  },
+  {
+    {W(0x120649b20370327b), W(0x0e76555acd48cdc6), W(0x4ed54decca01db03),
+     W(0x7be21319ac601d22), W(0xf711661901b6576e), W(0x7839fa064e73537f)},
+    {W(0x169d43ace46e860a), W(0xde6d658c3078eed9), W(0x8df731395032142b),
+     W(0x6be199b09b3c76c7), W(0xc2f385f6f8bbffe5), W(0x848df7f3d5ffd28c)},
+    0
+  },
+  {
+    {W(0x531e4cefc9790eef), W(0xf7b5735e2b8d1a58), W(0xb8882f1eef568511),
+     W(0xafb08d1c86a86db3), W(0x88cb9df2f54de8c7), W(0xa44234f19a683282)},
+    {W(0xbc1b3d3aa6e9ab2e), W(0xefa071fb87fc99ee), W(0xfa3c737da102dc0f),
+     W(0xdf3248a6d6a0cbd2), W(0x6e62a4ff1ecc1bf4), W(0xf718f940c8f1bc17)},
+    0
+  },
+  {
+    {W(0xa342bf65f874628f), W(0x18de3f8ac71a57bd), W(0xb4d12a1771fc321b),
+     W(0x96716602a25ebf10), W(0x744f68201a286d80), W(0xd60bad1de3cf63b8)},
+    {W(0x0c0b1ac44368da09), W(0x53afeae373a6d3be), W(0x4d2e6ce2a90af331),
+     W(0xd797224f88bc0638), W(0x10c60b2d9396d893), W(0xae3b0c11fe45e1a8)},
+    0
+  },
+  {
+    {W(0x2c8b0aad4f63f026), W(0x2aff623850b253cc), W(0xcab3e94210c4d122),
+     W(0x52b59f0407cd2816), W(0x22322803982c41fc), W(0x38844e668cf50b19)},
+    {W(0x42a959f7be3264cd), W(0xbddc24bd6c983524), W(0xa489eb0c462b8640),
+     W(0xb7c0509298029be7), W(0xd5546b5fa1addc64), W(0xe7cac1fca0c655af)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa189f30fc6a6d6d1), W(0xdd674d3669665ab8), W(0x307c9ec37d8da76d),
+     W(0xb3e1d006c1ea7c10), W(0xc15e20b3b88c62d4), W(0xb0000ec50bff3b3a)},
+    {W(0x9e330eb19ff9aa5c), W(0x8663f9fddf578877), W(0x157d3cb002e1eb2a),
+     W(0x638f297bf525e4d4), W(0xa20f833234a3dff1), W(0x748ea86b45a9c051)},
+    0
+  },
+  {
+    {W(0xfe9fdde8bc266ee3), W(0x91668688ba18e6c7), W(0xa65349acddde6f6e),
+     W(0xc53c29c97e54356c), W(0xee15ad945709f73c), W(0x033b3940e5429277)},
+    {W(0xf52035cdd0c3475a), W(0x9c5bef4d93f1f1f0), W(0x26e0b0ceca319bd4),
+     W(0x4e7eb67b6951fd8d), W(0xac3a6f4395c34d6f), W(0x1f2769e600f60b59)},
+    0
+  },
+  {
+    {W(0x2c47010d18e30ee3), W(0xb7d4b1dbfdd5f040), W(0x5c8abe509d930f6d),
+     W(0x6bcf875d5f56cf04), W(0x1f6456c0062f1fc1), W(0xc79597805304d710)},
+    {W(0xd76452e4db85dcec), W(0xd531f73fa0cbf90c), W(0xb5ae9fc89021bde6),
+     W(0x505c6b9f4babfae0), W(0x99d943c17ea61fd6), W(0x6ef4766159bf125a)},
+    0
+  },
+  {
+    {W(0xbd10b8bffb787270), W(0x4f0b1566e43aaab6), W(0x9a18be5ec0c90781),
+     W(0x3677f4c71ad167ce), W(0xccb254e2a68c1c56), W(0x392493e6e2c4d275)},
+    {W(0x44958cb1d5b63617), W(0x178f141a4caa4e7c), W(0x7445a767a2ffdbd5),
+     W(0x0e789c99b0b6c22d), W(0x3ff8b6565dc92b2e), W(0x1623e5c3eca98782)},
+    0
+  },
+  {
+    {W(0x6618fcae534f6370), W(0x1635580da1a864a2), W(0x90ad39947d7ce552),
+     W(0xbf8c45895257f24b), W(0x5a9499202098768c), W(0xec1eb621bb6d8830)},
+    {W(0xfae8f161f1f9ac16), W(0xfc9184ca35704c99), W(0xa72b1ea9139ea04f),
+     W(0x82229a912e39e1d8), W(0x4153bf3e479c7bc2), W(0x83325be4c5541825)},
+    0
+  },
+  {
+    {W(0xfadf9be978207cef), W(0x97d5ba569cb5718e), W(0xcbad24ec2f995393),
+     W(0x6236a26861203303), W(0xe4bafc336589a4be), W(0x6cba77185e23fa82)},
+    {W(0x8ccbc5774583e65a), W(0xe5d88bca4bc2f415), W(0xe6bc2d5841df8dd1),
+     W(0xec24e1d914d31fcd), W(0xacaaf13efc26010b), W(0x7e1da447e01b92f3)},
+    0
+  },
+  {
+    {W(0xc52789bbf2d3bdc6), W(0xd38673fc3b23d7a0), W(0x8b6df95aacafbbfa),
+     W(0x37afdcbdc7f6eb6d), W(0x57775bdd6cb4c9d7), W(0xc34e5a2711007453)},
+    {W(0x903e5ba1b5faf98e), W(0x811e142a9d4a8a45), W(0x046d18932d7ac9e4),
+     W(0xe2fe9d1543ce66a8), W(0x44b5beb4d4956410), W(0x7c5f1b9ebb147f72)},
+    0
+  },
+  {
+    {W(0x6f6a6104899ef333), W(0x95496f6d39067165), W(0x42fd9a6ab51989e5),
+     W(0x1b60ce0f68f5b168), W(0x97324d8756f7fe67), W(0x443812f7676815a8)},
+    {W(0x265ee994685a7260), W(0x342c7b2f6c6515f0), W(0xe909232334b4adb0),
+     W(0xddcd233e1e5a8d18), W(0x3dc5b27c5f4f6456), W(0x9664533a7f421d9b)},
+    0
+  },
+  {
+    {W(0x1a57d3e1b3fe597e), W(0x1a3ad06d18d1b6f0), W(0xf70f27b32e4a4617),
+     W(0x55e8a0479a75b4ad), W(0x0b24d5beede15d86), W(0x2b3c41d0fb2f56b5)},
+    {W(0xf6cf36aab1d36456), W(0x418a72fe1d8ff434), W(0x64149a0d156746bb),
+     W(0xae65897c4e3a26d6), W(0xb75e87d21e68eefd), W(0x5b81e0b01cb27c91)},
+    0
+  },
+  {
+    {W(0xc48bc829ff7543c0), W(0xc0bda14c4d72bfaa), W(0x2f470ec703be0af1),
+     W(0xc70f1e8e92d37eb4), W(0x08abdd98418f410f), W(0xe38c74ab35386176)},
+    {W(0x9c07cfdd8c00426c), W(0xba74c310a998f1ad), W(0x76b45140b7d2dda8),
+     W(0xa52b5e584948330e), W(0x9b7332348d8efb26), W(0x5d1763735d19a312)},
+    0
+  },
+  {
+    {W(0x80bba9170319fec4), W(0x4ba44600aaef6deb), W(0x83285b613594f325),
+     W(0x8879183753b5765a), W(0x651b4c6adaf1b02d), W(0xccc17578825f609a)},
+    {W(0x0b4076b39fddc6ff), W(0x286e2daddf2fa874), W(0x46c45233c413b648),
+     W(0x4fa46969b7cfe0ab), W(0x835786f3e04f5e5b), W(0x526292a90ce3f707)},
+    0
+  },
+  {
+    {W(0x43b58def987cf64a), W(0xc95b16c63d4bcd4e), W(0x5d1b1373bcd9b923),
+     W(0xaf560542522e052b), W(0xc2ff8f7583800352), W(0x11723aa17fe2a4ea)},
+    {W(0x28de7668e94bd9bd), W(0x0ce80e0f874018a5), W(0x0fe3755d8d43e726),
+     W(0xa78296acf9b075c5), W(0x76d58d9882207423), W(0x5c5bc6971db99205)},
+    0
+  },
+  {
+    {W(0x283d5bb63e052e69), W(0x149ac3d01bd300e4), W(0xb4c7b96ce0582cca),
+     W(0x66102883428cb7d7), W(0xd3eea16b500958df), W(0xe1b6a74f74674893)},
+    {W(0xe3b284be3fb0522b), W(0x74b0fe2dea983a60), W(0xd4328e5c81e465d8),
+     W(0xecb534c7403173b3), W(0x1721e22774144d34), W(0xb7273c6aa88a5141)},
+    0
+  },
+  {
+    {W(0x583ee7dfe3b7e746), W(0x0b6659e4a4fab3a8), W(0x34ee02751946db5d),
+     W(0x5ae3c0ba1a12eeca), W(0x36756ed44ccb83e7), W(0x973b0861a80eaf3a)},
+    {W(0x969e38f46982ca90), W(0x9a9bcd10018d01fc), W(0xb540e9533272476a),
+     W(0xcf91dd0a75ab7002), W(0x2c7d363f39ceb983), W(0x4369c221974747c7)},
+    0
+  },
+  {
+    {W(0x9a8857568bc1783e), W(0xb373e5a0a7cf2ee3), W(0xdeb162fde46cc503),
+     W(0xd5d334601074ef35), W(0x0030f98eea159a90), W(0xc5ffbdde64e50d98)},
+    {W(0x85a6486a48195b26), W(0xdbf56597b1b9f2d6), W(0x5df2352ab8613aeb),
+     W(0xc425807ebd0189a9), W(0xcf5a34d4fa1f4f7b), W(0x233e26c7628fd2ce)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbfc40c30f893a2ca), W(0xdf96980e0623bad1), W(0x4fd7b54dc027511c),
+     W(0xf4799284cf3484ce), W(0x655ab811069beea5), W(0x52588bc87392e280)},
+    {W(0x522e7b404f0c17cb), W(0xc0d88acac705e9b2), W(0x9cf1b95877f3913f),
+     W(0x3e06b9267dd52514), W(0x992e920e2908cbca), W(0x13baced26d6ed529)},
+    0
+  },
+  {
+    {W(0x8a46c911bfc6c637), W(0x8dc3d699e4fa4fe6), W(0xd4ba64f15cf8e4c9),
+     W(0x01b3908a01cb3488), W(0x69b1fa5d38bd7ded), W(0x92ad483818b2eae1)},
+    {W(0x619324beb33955b6), W(0xc7f373355c8a6df7), W(0xa397f42e925b3f69),
+     W(0x32169a495f7e4d11), W(0xc0fa9a548d0d9f01), W(0xf52a1f2289d8f2e5)},
+    0
+  },
+  {
+    {W(0x240239aef73f8d88), W(0x9d6506a5a2730313), W(0xf9ab7151f58ec53d),
+     W(0xd397862cc080d59f), W(0x73eee88536f782f4), W(0xaf0f7c2d6c1d8d58)},
+    {W(0x58bed3e5ddbd3133), W(0x670cee4a388a85c3), W(0x9044c8ab8a482af8),
+     W(0x00658589e746a854), W(0x2538d1b926a0548e), W(0x2c611b2f07cdda49)},
+    0
+  },
+  {
+    {W(0x9c0d5231ba8e0a52), W(0x94d0509e93e465d7), W(0x67df90dd98515454),
+     W(0x223e8b9c8dbfb46a), W(0xf39529a36d757ce3), W(0xffec9175b4648296)},
+    {W(0x330749e8f78aae7b), W(0x19e5549645f93cc3), W(0x8c320b3494083aa8),
+     W(0x1161f5a321e321c6), W(0x0980deedde3e7892), W(0x605aa9196ad76ccc)},
+    0
+  },
+  {
+    {W(0xaf9a69ea3ffde9dc), W(0x0fdabcd390311309), W(0x2dffa77f3e52375c),
+     W(0xac655699a019a593), W(0xd402f5c4df238091), W(0xda5a777dd3518085)},
+    {W(0xdcee2db5272d9e6f), W(0x94d8dd167c08330a), W(0x9cb15b6121bc4998),
+     W(0x40b34f9e68b9808d), W(0x98de63590bd6ac5b), W(0x71e8fafd39766b8a)},
+    0
+  },
+  {
+    {W(0x71191262062312e3), W(0x84c82a94691f46fa), W(0xad4b344bdda57f44),
+     W(0x674b758ac4f0cfd2), W(0x3bc058a077543efd), W(0x3d7c765756618d06)},
+    {W(0x95107c744dba9e44), W(0xe59c3180cfdf1923), W(0x5dbeaf35e3f1d63c),
+     W(0x012029c643ab8726), W(0x4f588a4ea256c6fd), W(0x14a01b7a3e5d2e30)},
+    0
+  },
+  {
+    {W(0x847622b5682cac2f), W(0x9575e1055f1c2f34), W(0x14da9da7b82c435c),
+     W(0x99c8c4325b73e011), W(0xb978fe55ec8b37b3), W(0x46b48f0f337d6dda)},
+    {W(0xe0d4ffda28147516), W(0xa2bb0950c1a2cb4c), W(0x2a7d62872913cddb),
+     W(0x229afd04f67405be), W(0xe372202e49a31060), W(0x114129259fc219d6)},
+    0
+  },
+  {
+    {W(0x73fa3508180660f7), W(0x4cae013e2d24936f), W(0xf64a549f58493d98),
+     W(0xd9ceae0adc79f602), W(0x6569e37bd1512b84), W(0x11e4c022151c9151)},
+    {W(0x075678c2b55c5813), W(0xb26cdb5809d3cb16), W(0x6334dca3a57fb969),
+     W(0x0ed90820223dc3ce), W(0x74f9c3aebd11e277), W(0xaeefed3679c0b8e2)},
+    0
+  },
+  {
+    {W(0x2283a8c280b6aa9f), W(0x09d22af8b9d2ea62), W(0xba761843bfbfca8c),
+     W(0x9551071d1c446828), W(0x9b5ba358f3b2cdfa), W(0x6183512b9265272a)},
+    {W(0x8568dad716eb985c), W(0x3dfec4574f336bb5), W(0x193e4689e8f94dd0),
+     W(0xbe7105bf9cbbcd4f), W(0x675c377419413262), W(0xa03c86a02a707b70)},
+    0
+  },
+  {
+    {W(0x22195e48e57ac6a0), W(0xba77c58214bd1913), W(0x265f96b4323349b5),
+     W(0xc183196ea124d497), W(0x99f1f78d2466d82e), W(0x185a18bfc6263afc)},
+    {W(0x29a3d5b686cf8908), W(0x81f3bc00f680511d), W(0x5f6ffc81661d015a),
+     W(0x31c2ff64cd5eb082), W(0xc3c37ad672776042), W(0x49438769d9c6ac75)},
+    0
+  },
+  {
+    {W(0x96105430790a189e), W(0x0a25cdc8947fc21e), W(0xd36b2d1b6eb7a029),
+     W(0x835f10c0f3b84225), W(0xb69f2c0e3a3d24c4), W(0x4f93e841aaef9fe0)},
+    {W(0x4d0d03ab49e87941), W(0x7007fe38687b4b19), W(0xe7ad46f883942d56),
+     W(0x5edfe6689cad5b88), W(0x9bdea1f0c8bbb8cf), W(0xfa74144471442473)},
+    0
+  },
+  {
+    {W(0x0e2fc74c2a24c385), W(0x836a474034679278), W(0x25518f16817e2c41),
+     W(0x8b573a8eb4b7d3c1), W(0x012797f94ab56adf), W(0x9e0e56d0fa2ab690)},
+    {W(0x009ba1ee1c9f6f08), W(0x8ebf4aac2f412e9e), W(0xb143122a1cfb4e02),
+     W(0x988cf0eccbf2b783), W(0x44a7ed9657f5be97), W(0xbdcad87251804147)},
+    0
+  },
+  {
+    {W(0xbb0a0c432b20b34f), W(0x8b557b843b22ee0a), W(0x66c448a080692993),
+     W(0x80b53b0c7616a406), W(0xc69476f7fcae7ffa), W(0x2309899eea4da4f3)},
+    {W(0x322fff0c17a71844), W(0xbc7bd051c09d7b49), W(0xc9cb096edc1b9a85),
+     W(0x2ce181ea51f21b24), W(0xd4e7d816d4268167), W(0x3528e58d0beba314)},
+    0
+  },
+  {
+    {W(0x969fcd982f60d1a0), W(0xf0f4c9b2ef06b3eb), W(0x8c6438cb49ec8f92),
+     W(0x746107773f1653da), W(0xf7cbc899b574576a), W(0x758de9008494795c)},
+    {W(0x73045065ab22cf9f), W(0x9893653c9ff13e98), W(0x6e8860264a58d64d),
+     W(0x387d6cc34e3bf554), W(0x82a49da4a42b0008), W(0xb28bd9b71b0b1c47)},
+    0
+  },
+  {
+    {W(0x4420e52f56fad362), W(0x9791c53e33d7887c), W(0x8d1acfc8770c262a),
+     W(0x57f66e9e60e494fa), W(0x2a756c4fbde50c17), W(0x4b93ab0bab82930f)},
+    {W(0x1cddb4e7e509707c), W(0x0dcbe02342c192dd), W(0xa493a9f90f8a585c),
+     W(0x43261ed1b42f354d), W(0x63d5b9af1170d3a3), W(0xc274e97d2f651c65)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x378205de2f9fbe67), W(0xc4afcb837f728e44), W(0xdbcec06c682e00f1),
+     W(0xf2a145c3114d5423), W(0xa01d98747a52463e), W(0xfc0935b17d717b0a)},
+    {W(0x9653bc4fd4d01f95), W(0x9aa83ea89560ad34), W(0xf77943dcaf8e3f3f),
+     W(0x70774a10e86fe16e), W(0x6b62e6f1bf9ffdcf), W(0x8a72f39e588745c9)},
+    0
+  },
+  {
+    {W(0x2a5f8ecf06616d0d), W(0xca9b1cb8c7deb373), W(0x9de31cedc59c4301),
+     W(0x1e0f40b10111d998), W(0xd29d229f960d5b95), W(0x10563249d1dabab8)},
+    {W(0x7b225cc9a05ecac9), W(0xb02e689678f3b8a0), W(0x009b52a1f5fb06b2),
+     W(0x8a575d3f842b9081), W(0xfddb48afe9272512), W(0xd39b8f1d0b452cb7)},
+    0
+  },
+  {
+    {W(0xae10069e808dc4b1), W(0x64df30e18fb3ba73), W(0xbbe4caf27ebaad0b),
+     W(0x5907bf373dd6119c), W(0x0a723dff9dfceefe), W(0x59bff4ddf7cffc7e)},
+    {W(0x7bc95fa26a6f43c2), W(0x9001d1d53ca0e2b3), W(0x316a7ecd27b3335b),
+     W(0xbf08e6727b8d7d49), W(0x4b209f93c619058f), W(0x4c0ca01e59d8f9ea)},
+    0
+  },
+  {
+    {W(0x167ec88a51b3f1ce), W(0x19756ee0420024c8), W(0x10f2e2443877e634),
+     W(0x6321bf2603462cb3), W(0x1dbd10ee9d3afcee), W(0x0726f5f22ca17dcd)},
+    {W(0x094652660bacf018), W(0xc92a9f2de1feb969), W(0x0043b0f95e1c5912),
+     W(0xa09b94d1757d3a63), W(0x533956529fdef1e0), W(0x9826886cd4fedd41)},
+    0
+  },
+  {
+    {W(0x34590975ed424438), W(0x7c03ce744d11a200), W(0xcc939a286ec406ee),
+     W(0x8d214276fee5454d), W(0x66a0e1a56b257f70), W(0x93761a8a006fb85e)},
+    {W(0xc44f9df2aa70b65a), W(0x1dac524f91d9e2e8), W(0x5894a8224fca1a81),
+     W(0x8586e418f3ed85bf), W(0xd494dfb202899b5b), W(0x7ea9f222ecb8e371)},
+    0
+  },
+  {
+    {W(0x690c0cfeb449d1e2), W(0x4a5e150b1b8e1577), W(0x22508042204d98a6),
+     W(0xc87a97f5bad2eb08), W(0xd307c59ed25823ee), W(0x6ed083580df8b3f6)},
+    {W(0x280ae344314e7016), W(0x6a55be876ef4e889), W(0xea930e5a24d04e38),
+     W(0x0269d9a7309830fc), W(0x41dc8f0ae4afeebc), W(0xfd1bc660f14ee02d)},
+    0
+  },
+  {
+    {W(0xefca7f7ba6c53c1b), W(0xcb4bb33c524457a0), W(0xc9eab87fe57d08df),
+     W(0x48c01c2a7d9a1967), W(0x11c97ed97dc27492), W(0xd8c644861cf1f639)},
+    {W(0x541f8c0d8156576c), W(0xdf5c8dff2384e299), W(0x9806935ba6be190d),
+     W(0xec6c5de764494b4e), W(0xf04e2d4cb83c00b6), W(0x379af438c0b84f15)},
+    0
+  },
+  {
+    {W(0x2e75a26eec65b53e), W(0xfeb630b270552fb3), W(0x53dfd057ee7d8e4a),
+     W(0xb959110d8994f449), W(0xb4a16596bb538367), W(0xa70917bdef82f29c)},
+    {W(0x5a76430043bba6ae), W(0xee207476cfbc194a), W(0xc7eab23803a4184b),
+     W(0x60c67ef20f7fcd62), W(0x41e05799dfa8a0c6), W(0x5d7d05e604d352b0)},
+    0
+  },
+  {
+    {W(0x941134bbe5faddf8), W(0x211b3ed996b16dbe), W(0x4ef0655cc344367a),
+     W(0x4b6308427293deb9), W(0xafd911af5ea7f0bc), W(0x6bb4d3bcf21e5957)},
+    {W(0x7c99ddc240c0d43e), W(0x75dae60afd07610a), W(0xe6f9531a0377d66a),
+     W(0xcb9a8037e4890176), W(0x3c8f4b0972dcd77c), W(0x820b21848837e34d)},
+    0
+  },
+  {
+    {W(0xb8b9d942e5f05504), W(0x852c1d18975d24fd), W(0x5476b1e60315888d),
+     W(0x5bcd84e91299103c), W(0x62b29a7af4d373de), W(0xa209292b52fc4c43)},
+    {W(0xdd037e6ab0da9898), W(0x15834038bdb30f9c), W(0xffad1fad2137fb90),
+     W(0x1f0e4a055af27223), W(0xfeb7e9bbeeca6cae), W(0x4b7af4dfe12b8310)},
+    0
+  },
+  {
+    {W(0x3ff4efe13eed22af), W(0xd13021e7723ba845), W(0x513120d0a7b5f0f8),
+     W(0xee67c079da534d87), W(0x7fa3e19ab512175e), W(0x14ed4af4c3b73cfb)},
+    {W(0x8fe345c3b2cc8287), W(0x20c19a55bf4c5331), W(0x52c11852e3a8d1ed),
+     W(0x3afe2791d495344d), W(0xdf1fb43ae0e0f34b), W(0x4360bd179a549162)},
+    0
+  },
+  {
+    {W(0x1e9507193c677bcc), W(0x8c8ea2caf31c202b), W(0x431b74ed8f541eba),
+     W(0x652411bad0537871), W(0xfabf56644a6f98d7), W(0xf07967a9f6e8a15d)},
+    {W(0x4f611b1f9bf20fae), W(0x5d1d2d0f51c2aa74), W(0x496fe7d9b40a10fe),
+     W(0x95b75aaeab1e0b3b), W(0x9070d512303138e5), W(0xf21311d9fbc3b66b)},
+    0
+  },
+  {
+    {W(0x2e613a44195d5eb9), W(0xe779731baa4cfa01), W(0xa722b2b522e25a03),
+     W(0x1d5cf443bb638b1f), W(0x641665fe2d2a16c5), W(0x83086a5aa7b3b23e)},
+    {W(0x6d58cc3168470250), W(0x12593caf82900e21), W(0x151a1b94ab808471),
+     W(0x8e628aca767067d3), W(0x2ebfd96ca6a089af), W(0x3984e8e2a831ade8)},
+    0
+  },
+  {
+    {W(0x01b7556a17674df4), W(0xf07dd620df1aa3ba), W(0x1d54d64f1316f22c),
+     W(0x0bc186c72e8f86e5), W(0x8a23f6587ea629b1), W(0xd7fc710bfe221428)},
+    {W(0x0e715188d60d25cb), W(0x8d672ca14045f096), W(0x37a5a2bd2993f8bd),
+     W(0x1adfca34c4c7216e), W(0x7b25d5d2f5ec782b), W(0xa6a8d1d368ddb5c9)},
+    0
+  },
+  {
+    {W(0xf634f0313ebc453c), W(0x22249e7eb40cb97b), W(0x0ee2375bba748de0),
+     W(0xa4f20574e3718502), W(0x03d2e6a177a91e79), W(0x3e8882306ce30e34)},
+    {W(0x455bceea7ffc5783), W(0x6e8e2260d061c521), W(0xa93c60e2f6904c4e),
+     W(0x6a374fe87d7c4f11), W(0xcd2aafa02e18a779), W(0xb44f66cefd3bc024)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc97c01eb436b59f5), W(0x1d15aca7ef1848ab), W(0xdba1ce807fa7d3c2),
+     W(0x69e6f96e81060874), W(0x6e3e0df74d7eeead), W(0x8a3b5e85b0c87f3d)},
+    {W(0xc55ae3dbc8a23914), W(0x5cdc2a92bf6d27d9), W(0xa6008c591de7860a),
+     W(0x8202f8b66e546731), W(0x652f2d07aa1e45d4), W(0x146f214f6df5415a)},
+    0
+  },
+  {
+    {W(0x041c706cce5fb4d9), W(0xddc78cb3b22a79a7), W(0x7dc4cd27839e9d5a),
+     W(0xdfc9db83bf3c4c06), W(0x85b8094138b7bd22), W(0x1007dea2d0f4c2da)},
+    {W(0xd7b34006c633fba0), W(0xa8880acf4476e55f), W(0xa340b2c275236685),
+     W(0x5ddd05510113a85f), W(0x7dfc7ab29cb32704), W(0x9a334a33dabf22ff)},
+    0
+  },
+  {
+    {W(0x2fbce9bed7d1146b), W(0xcec9e5d8b3980bd2), W(0x48ea45939f4cbaf0),
+     W(0x56c540092574a3bd), W(0x84a39630e792c39a), W(0xe5c690f8eef81343)},
+    {W(0xf996760f17655bc9), W(0x6009c2156c0c191c), W(0xa0ca12e6966d7027),
+     W(0x92a6d5d52e6f7c63), W(0x46809d269bd13ead), W(0x3c11fa7967aac681)},
+    0
+  },
+  {
+    {W(0x3fc9b3cfabe2cc87), W(0xfd8d64e3514e77fe), W(0x2003a58afe1ad535),
+     W(0xcec4be38cb39149f), W(0x4d578c99bdedf470), W(0xcd35d7a33a356519)},
+    {W(0x7a762f278b078d6b), W(0x3b6891ed31ae2701), W(0xdc0e817f270c508e),
+     W(0x5a7be2049fdb29c8), W(0xfa1a0be3cb2711d3), W(0x5865f55f3786a0c2)},
+    0
+  },
+  {
+    {W(0x1d0af6b52f641cff), W(0xa932adeb3648c4a0), W(0x67641951b1ea8fc4),
+     W(0xc0b90064b1fae482), W(0x7012642f6623477b), W(0x1cddc0245bf019ce)},
+    {W(0xca1f4675c2c32737), W(0x11525a5e97d6b18c), W(0x9c034ef2d3868de9),
+     W(0x0533d921044e0c18), W(0xba6cf14ecb5e38c3), W(0x438309f3509d7053)},
+    0
+  },
+  {
+    {W(0xe164268ec4ff9f0b), W(0x6c8e9349e6c36e63), W(0x734f979478ab17f3),
+     W(0x46d468de0179ed0e), W(0x7e68f006dfa26867), W(0xe4d4a85de3d0485d)},
+    {W(0x0913a1d7f84c0f8f), W(0x4095c8c025a9c9cd), W(0xeeb1a79e49eadd08),
+     W(0x433f5e417dd8f954), W(0x70a6281430bb26d0), W(0xad94d8f6ff5e8e29)},
+    0
+  },
+  {
+    {W(0x6a352b579e32c0a4), W(0x5274a08277ec7a40), W(0xee1f7c7a240e6dc5),
+     W(0x85d5be62d313b4a9), W(0x1522c5d25c01a405), W(0xcfa08aab960afd5a)},
+    {W(0xa3cb77f38e8a93dc), W(0xaacb16766d1c98c7), W(0x84090c7d3b93fa9d),
+     W(0xc77f1ee13c0383ad), W(0x461c93b776f7a220), W(0x66d63a1d04ac0bfc)},
+    0
+  },
+  {
+    {W(0x3c7d6b644751207f), W(0x65e1f96ae440c1a2), W(0x8ed15d20aa0eaa1e),
+     W(0xe944ad2fc0eab490), W(0x71525aa1f6d9f260), W(0x5cd14c8816146ba3)},
+    {W(0xf940190814a41275), W(0x3bb7ea742288618d), W(0x6a4e1c37cab1060a),
+     W(0x357fe4d0c8cac96f), W(0x97a8b8ab6a2466ec), W(0xb6e83fdb9c01be70)},
+    0
+  },
+  {
+    {W(0xa55a7142cb09a69c), W(0x0a39fa12896a9c24), W(0xa7131a001f6c9c82),
+     W(0xdacbfae97509c912), W(0x3793d4ef4232eb57), W(0xb63d9fc0da02ac15)},
+    {W(0xf1ce48a09ab37492), W(0xa388dbb5cf9ddedb), W(0x7224ef47fd7b2aa4),
+     W(0xdfe18be82fd35ae0), W(0x2286ae7b90a2e98d), W(0xd06cfd71e0d3c2da)},
+    0
+  },
+  {
+    {W(0x7825df5c948663a4), W(0xc8c093adeb4ec9dd), W(0x677c51ebc1505989),
+     W(0x8c28421524041f43), W(0x0f63f15ac9ef610b), W(0xcb98841d257678c5)},
+    {W(0xc0560066c52c64ac), W(0xaf7417db954180e4), W(0x935c08876fe1f0e7),
+     W(0x8fe556ba46d03a88), W(0xec44271484a0c4a7), W(0x431f8e8395be9544)},
+    0
+  },
+  {
+    {W(0xc1fc18cb3101ce6c), W(0xff753902048e52fc), W(0x768299554e58e21e),
+     W(0xac990acc32856d44), W(0xaac4d5dc9f8a9da8), W(0xca1740fdd4be9e8a)},
+    {W(0x59250846892d8bda), W(0x45f45cad19c97c71), W(0xf29e2724e6ba5c87),
+     W(0xe441134473f6a778), W(0x9f4f9027a0f278fa), W(0x11bb7ce02bdcef71)},
+    0
+  },
+  {
+    {W(0x0cc553bb9b3fd7ce), W(0x2e0ff43ce103b562), W(0x96c01f0328222a3f),
+     W(0x7dcc5593c10171c0), W(0xc677366a4b3e5858), W(0x872d4396bde4eebd)},
+    {W(0x5d0c5f3a7f83c0b6), W(0xbf4274dcf7ba33d9), W(0x1df6e4811a635f83),
+     W(0x24e2e8347d807292), W(0x792203a8eee1e676), W(0x20475f907ef4e8a4)},
+    0
+  },
+  {
+    {W(0x1b4db0579e37cd0d), W(0x61b95bc9ebccdf79), W(0x7d98d8537a57d7ad),
+     W(0x58a3d639709b0194), W(0x45fbd4417ce5bc31), W(0x7684b71b5b3c856a)},
+    {W(0xb311f8f85bb6bd1a), W(0xaeb8e44711eda59b), W(0x1ad5b35fbf269cff),
+     W(0xc69651b4a0e2a640), W(0x3713803bd83ad8b2), W(0x613ca3af0e4b353c)},
+    0
+  },
+  {
+    {W(0x3ac59b1fff8cf495), W(0x3f3726866b04c4dc), W(0x2cdddf90da325f0c),
+     W(0x3ae79666444cabe5), W(0x8222f6d6c7484b1f), W(0x61fb08929ae328b9)},
+    {W(0x279aae392c575c0e), W(0xac694019948508bf), W(0x4931cc55b84056f1),
+     W(0x75927a688b50ad1d), W(0x47ba72e945584371), W(0xbea7e62ea79fe5e5)},
+    0
+  },
+  {
+    {W(0x990a6767faddc25d), W(0xcd7650eb114eaf17), W(0xf9d1d6409a44cda3),
+     W(0x70996b6871fb091a), W(0x630ae9754ff80816), W(0x59a9dc2f987b20e7)},
+    {W(0x9a39588ef65fbbc7), W(0x71f4c8e598e7c78c), W(0xad2f5a0138cd40ac),
+     W(0x3c68fe575a837332), W(0x7af44087155e6b4a), W(0xd66f4cf8e99e31f2)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x5b0b5d692a7aeced), W(0x4c03450c01dc545f), W(0x72ad0a4a404a3458),
+     W(0x1de8e2559f467b60), W(0xa4b3570590634809), W(0x76f30205706f0178)},
+    {W(0x588d21ab4454f0e5), W(0xd22df54964134928), W(0xf4e7e73d241bcd90),
+     W(0xb8d8a1d22facc7cc), W(0x483c35a71d25d2a0), W(0x7f8d25451ef9f608)},
+    0
+  },
+  {
+    {W(0xa704016022ec7edd), W(0x19124972cc9c8ee8), W(0x697f301f2ccb9417),
+     W(0x3ee877646f00d8aa), W(0x2b5afaf88138a017), W(0xf152b14c832d7543)},
+    {W(0x27c27ce2383052f9), W(0x4746c5b5e1dae11b), W(0x92dc5ac75b752008),
+     W(0xcf382e01e84fe5f1), W(0x90e034197d5929ce), W(0xafee3abb15ca3ffa)},
+    0
+  },
+  {
+    {W(0xcb51f03954ebc926), W(0xe235d356b8d4a7bb), W(0x93c8fafab41fe1a6),
+     W(0x6297701da719f254), W(0x6e9165bc644f5cde), W(0x6506329d0c11c542)},
+    {W(0xa2564809a92b4250), W(0x0e9ac173889c2e3e), W(0x286a592622b1d1be),
+     W(0x86a3d7526ecdd041), W(0x4b867e0a649f9524), W(0x1fe7d95a0629cb0f)},
+    0
+  },
+  {
+    {W(0x11dd860e1c6d03b0), W(0x30c1700809eec660), W(0xd4f8aff635c0192f),
+     W(0x96a727b1e3a4a900), W(0x1426daffde78c8ba), W(0xfacaa9bd8d1527c4)},
+    {W(0x0c0d5234cd072989), W(0x1936c20d918550b5), W(0x4828bee43d914fb3),
+     W(0x8324ea38f3ba26a6), W(0x027590f3a94eb26f), W(0xfd354295acd957bf)},
+    0
+  },
+  {
+    {W(0xf4f66843ca5baf54), W(0x298db357efe7db78), W(0xf607e86e7365712f),
+     W(0xd58822988a822bc0), W(0x2cfbd63ac61299b3), W(0x6f713d9b67167b1a)},
+    {W(0x750f673fde0b077a), W(0x07482708ee2178da), W(0x5e6d5bd169123c75),
+     W(0x6a93d1b6eab99b37), W(0x6ef4f7e68caec6a3), W(0x7be411d6cf3ed818)},
+    0
+  },
+  {
+    {W(0x959353be3dfb423c), W(0x8458e85836d41cc8), W(0x6a4826f799d7a4f4),
+     W(0xab146ece52fe4b65), W(0x94fc21d735038573), W(0x26f50135f4d56e84)},
+    {W(0xe15ca04d3162d92d), W(0x8f652fcd34ed4e84), W(0xef7e79244f21a910),
+     W(0x2eecb7e9dcc76132), W(0x5b484745dbe89048), W(0xbf8c490f6e43a2c5)},
+    0
+  },
+  {
+    {W(0xf92b307363a0a7d2), W(0x32da431c881dc8cf), W(0xe51bd5edc578e3a3),
+     W(0xefda70d29587fa22), W(0xcfec17089b2eba85), W(0x6ab51a4baf7ba530)},
+    {W(0x5ac155ae98174812), W(0xcaf07a71ccb076e3), W(0x280e86c2c38718a7),
+     W(0x9d12de73d63745b7), W(0x0e8ea855bf8a79aa), W(0x5eb2bed8bd705bf7)},
+    0
+  },
+  {
+    {W(0x3ede2484da756624), W(0xb22da2ab73b13062), W(0x56069e93962a667b),
+     W(0xc931266b130f2cea), W(0x4bd6a6fca7366a66), W(0x23f30563aa5ac3b1)},
+    {W(0xa025d0efd7c2b26f), W(0x597ce7d862129bc7), W(0x4809927f2b3057f2),
+     W(0xb001c10a1499f884), W(0x309d141c30b9a653), W(0xadddce7dbf659d05)},
+    0
+  },
+  {
+    {W(0x33fe9578ae16de53), W(0x3ae85eb510bec902), W(0xc4f4965844af850e),
+     W(0x6ea222b3087dd658), W(0xb255e6fda51f1447), W(0xb35e4997117e3f48)},
+    {W(0x562e813b05616ca1), W(0xdf5925d68a61e156), W(0xb2fa8125571c728b),
+     W(0x00864805a2f2d1cf), W(0x2dc26f411bccb6ff), W(0xebd5e09363ae37dd)},
+    0
+  },
+  {
+    {W(0xe448127c9303b5b0), W(0x6ac656817a74ec27), W(0x05128a5286f0e7ec),
+     W(0x9d9f32c17603a73c), W(0xb5a799bf556c51ea), W(0xea94f169a9a9a416)},
+    {W(0xebb3e549aebde511), W(0x9037046af9cccd3f), W(0x2a9343a8f08a8254),
+     W(0xc5cc43f6d40c7f26), W(0xe1146cdcb39677d2), W(0x6cbfec8bbe66d4b6)},
+    0
+  },
+  {
+    {W(0xd2d68bb30a285611), W(0x3eae7596dc8378f2), W(0x2dc6ccc66cc688a3),
+     W(0xc45e5713011f5dfb), W(0x6b9c4f6c62d34487), W(0xfad6f0771fc65551)},
+    {W(0x5e3266e062b23b52), W(0xf1daf319e98f4715), W(0x064d12ea3ed0ae83),
+     W(0x5ccf9326564125cb), W(0x09057022c63c1e9f), W(0x7171972cdc9b5d2e)},
+    0
+  },
+  {
+    {W(0x10867369b0a219fd), W(0xe7efac975ab56581), W(0xde3372e87813f6f5),
+     W(0x3bbe59771d4b8ed3), W(0xf17f61e553376573), W(0xf719d06d97964b90)},
+    {W(0xb1e8c483b24d2e4a), W(0x53709647184379eb), W(0xb739eb828a8fcb83),
+     W(0x5d2f3a4d60163017), W(0xccedf4f4f823b4af), W(0xa6e166a1ff315eae)},
+    0
+  },
+  {
+    {W(0x2364fd9aeabd21b2), W(0x3ce5f4bb9174ad6d), W(0xa4d6d5d0b38688c0),
+     W(0x2292a2d26d87fd7d), W(0x2a7d1b534ca02e54), W(0x7bee6e7eb4185715)},
+    {W(0x73e546098fc63acd), W(0xf4d93a124064e09d), W(0xd20e157a2b92daa5),
+     W(0x90d125dbc4b81a00), W(0xcb951c9e7682de13), W(0x1abe58f427987545)},
+    0
+  },
+  {
+    {W(0x76452ac1e1c01fab), W(0x167d73266bd32f0c), W(0x72d209c14a283a42),
+     W(0xd26859b648ea0ba9), W(0x7b3e5c466369309b), W(0x474a962593c9a0b9)},
+    {W(0x676ea3e4c76e25dc), W(0xb0c9ccf771400c71), W(0xc429587036f83518),
+     W(0xb86c1b39267f0c25), W(0x8a3e352428884a80), W(0xea182c4543ba8e28)},
+    0
+  },
+  {
+    {W(0x6d35164030c70c8d), W(0x8047d811ce2361b8), W(0x3f8b3d4fdf8e2c81),
+     W(0x5d59547733fa1f6c), W(0xf769fe5ae29b8a91), W(0x26f0e606d737b2a2)},
+    {W(0x70cbfa5db8b31c6a), W(0x0f883b4a863d3aea), W(0x156a4479e386ae2f),
+     W(0xa17a2fcdade8a684), W(0x78bdf958e2a7e335), W(0xd1b4e6733b9e3041)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa6c32900af2825c1), W(0xb37c46c1d223a04e), W(0x691e7d39063de7ea),
+     W(0x998df4e710daf9bd), W(0xc7085b9e718b5d7a), W(0xd41abcc816b3d4b8)},
+    {W(0x4dfce693f9bc4041), W(0x383677ed659ec7a8), W(0x2c1904bf4491fb34),
+     W(0x7c1bf1114552451c), W(0x6562cc2c3c5e5e40), W(0x1ecaa2a1fe0e4372)},
+    0
+  },
+  {
+    {W(0x84c3630bf3087bc8), W(0x152691e674be6e26), W(0x5abd125ff61af001),
+     W(0x69bca56fbfea3525), W(0x384af19900e0cb6e), W(0xb0b13cfed00475a6)},
+    {W(0xedafde495e394049), W(0xd988b558daf2add6), W(0xf14cf97a6c8ffcc9),
+     W(0x4d6cec23e5a9cc5c), W(0xb0d678f88a104e05), W(0x80a7fcba9fb527c1)},
+    0
+  },
+  {
+    {W(0x8618ffa79e30f8a0), W(0x9961390cd12699bb), W(0x5b1b0d744f61edfe),
+     W(0x33df67d9eb7a476f), W(0x7f1a767ea92ee99b), W(0xfab400e32223a2cc)},
+    {W(0x16f376f2f534dc3d), W(0x6f36eaefcec17905), W(0x8dc1516ca58765de),
+     W(0x893408262260ed6b), W(0x060eb0afcf4b29ba), W(0x9cd0a9f11d252bba)},
+    0
+  },
+  {
+    {W(0x0d6cadbfc22137d2), W(0xb5db59d3628a3298), W(0x3b433c734ab19507),
+     W(0x4fc53405660086b3), W(0x770ae903a1eb0f43), W(0x31b5857ef6b5b58d)},
+    {W(0xe206e141d392868e), W(0x8be6956f4b31de04), W(0xcfbfca2f47449e07),
+     W(0xebaef25639fef8e1), W(0x959e37b8c16fc80c), W(0x8bb4bdd2e911d61b)},
+    0
+  },
+  {
+    {W(0x014a0907e51c6673), W(0x28118ccd3e6e6a91), W(0xdbbb7c4dc999acc0),
+     W(0x01b771075e7ab1e3), W(0xa33fefbfcd8fb11e), W(0x1df5b61fc0b8a5c2)},
+    {W(0x774dc2674478c5c6), W(0xbfe1add422fb91a1), W(0x5ac4dc694d9c8461),
+     W(0xbf6e002a1e772c5f), W(0x4922120e0b83fe91), W(0xa7747f4b3efbadce)},
+    0
+  },
+  {
+    {W(0xc483d4b24343bbf8), W(0x42aca2e18a0fc95e), W(0x5165df6fcbab1fb0),
+     W(0xeb284370f6cdfc0c), W(0xab565c00994320fc), W(0xc0d157fd62133e80)},
+    {W(0x7850cda55b69644a), W(0xe37ae76a806ec8b8), W(0xd14b805cc2c82edd),
+     W(0xcb5468b6cf244539), W(0x97d43ee825dbe92d), W(0x1442243689fb8f1e)},
+    0
+  },
+  {
+    {W(0x421afbe0431cb760), W(0x9ae9ff985203e69b), W(0x56cacf4db1a2705a),
+     W(0x6a3a4136d128bcd5), W(0x2411c4b866191ad8), W(0x39f26e1a15b45d24)},
+    {W(0x4cc82459c64ed153), W(0x5c7a0dd58195b452), W(0x9c88bb1c69f6298d),
+     W(0xfe567b031933fdb5), W(0x8a6aea71881308c3), W(0xc1268b55a2f0adfa)},
+    0
+  },
+  {
+    {W(0xd7bf2ac6a0a85236), W(0x2921b55c7194c46d), W(0x162fabaa9afa9762),
+     W(0x7b7f1664b62b36ab), W(0x77b9f797296a84e9), W(0xfcc1ad657dbd843d)},
+    {W(0xc6e9c1e1cd77b7f6), W(0x9cf0e272917067c9), W(0xfa7fa93d3bfa90bf),
+     W(0x55846fe9d050e46a), W(0x473b9a0d35c56256), W(0xadd29e332b656a65)},
+    0
+  },
+  {
+    {W(0xa4fc828ab18f9bb1), W(0x06de4c9da27a787a), W(0xfbb7c7d7b1b3a12b),
+     W(0xa7052b94b8583128), W(0x173ec2d2e7b02fd8), W(0x4b724682c776c664)},
+    {W(0x46ed9be5673183e5), W(0x312191e83bd17c60), W(0xe3ed6326efd56a9e),
+     W(0xb3ebc44c943a2278), W(0x7ef62ba9ec9cf589), W(0x754be6d389832cd7)},
+    0
+  },
+  {
+    {W(0x926c2552ebc69b0b), W(0x953a850fd4c7432e), W(0x0ee85e14b9359035),
+     W(0x8b10b01abde090a5), W(0xb2878dcaec423943), W(0x2571a178f70bde20)},
+    {W(0x24ed159af5ebeee5), W(0x60c202af043f6539), W(0xdaaa76f4c8d4ffc3),
+     W(0x2fc1f1ba06eda10f), W(0xddf159ee88ded556), W(0xcfa71782e67b1ec4)},
+    0
+  },
+  {
+    {W(0x3c58c5ea9b037c66), W(0x08d0648e0d5c6ec5), W(0x1bf90c53a4fa3f5a),
+     W(0x660cf61740381205), W(0x63fd03081d44af3f), W(0xe22b9c1a77175de7)},
+    {W(0x0b6044fc3556fc9d), W(0xaefb6804fb55318e), W(0x77045bce5c46e1eb),
+     W(0x29c4a3bc76e8f93a), W(0xdf8aec699d697f5d), W(0x5bd9552845a89080)},
+    0
+  },
+  {
+    {W(0x31521f66d5d826b0), W(0x0a63695240787844), W(0xc0a3bd059c8f934e),
+     W(0x12c57dd42f0ce835), W(0x847f6a9967064213), W(0x1c9e1a7aa88bd71a)},
+    {W(0xc4060eb2171e8407), W(0xdf78d8dfed106780), W(0xa3d28ceb0d704729),
+     W(0x4f8e523246ca3912), W(0x09e9f852017791f4), W(0x594006631e6ea97d)},
+    0
+  },
+  {
+    {W(0xeaa3426b8eb929aa), W(0x090924f2327bb35d), W(0x4d23ba1276da394f),
+     W(0x05d98e56adecd43f), W(0x83c7169f6b4af795), W(0xc22560a7c8f26ae8)},
+    {W(0xb43aecc2d01ab5d8), W(0xe7bcdc1f7257d7d1), W(0x6f32d77650de3318),
+     W(0x6d736b279bf02c0a), W(0x9534fa5865319235), W(0x5a6a38493cfbeb3c)},
+    0
+  },
+  {
+    {W(0x547b0d9583939224), W(0x3a0823ff1e026769), W(0x6016671525bd43ac),
+     W(0xb6cf475e18ba5f64), W(0xa22f9c92c8b6d09d), W(0x730553683ccf50ab)},
+    {W(0xa6de248eee6deefe), W(0x32aaf8b2acc3ca20), W(0x0e254c5bad44e674),
+     W(0x8aa73e6535f95f98), W(0xe622600160a2dc1e), W(0xdf9482109109020a)},
+    0
+  },
+  {
+    {W(0x4c4d454849d77b8e), W(0x431f942f6a4c982d), W(0xc8633d051cb39ce8),
+     W(0x23421f8caf516f9b), W(0xc9db25d2aac876fb), W(0x9f2669c5d882760e)},
+    {W(0x59dc4bf4c47d4bfa), W(0x99ed0024c475f93c), W(0x269d1ca4ebe07d37),
+     W(0x49ce3bdbbf88b1fa), W(0x515044053361e4cc), W(0x207f0048735b3c96)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x372798f02893f2f7), W(0x4f62bfac9e5030ca), W(0x5e64f9a98a1e2567),
+     W(0x5870254ce70391c8), W(0x2def81a341f02458), W(0x25d4e4dc1d087bed)},
+    {W(0x3557d07d4fe24a13), W(0x6da49186dc3112bc), W(0x08c8c5675f73ba50),
+     W(0x5309050b9c7c6706), W(0x2ab67da3bd985072), W(0x9bafa8b1e5df4e96)},
+    0
+  },
+  {
+    {W(0x7be81fb126882c6c), W(0xe2d5a251ecd25498), W(0xbb3d40e27a8d1678),
+     W(0x1806c67ad520811e), W(0xadd4bb6686f65d23), W(0x3a62b1b3e20e23d7)},
+    {W(0x208b47006548b3eb), W(0x0497f09ab7ec2809), W(0xbd3964f8121c37e2),
+     W(0xd35ef301a598efbb), W(0xbd76a276c5eef966), W(0x64700a7f0af64e46)},
+    0
+  },
+  {
+    {W(0x3f40494a92d99eea), W(0xc8d6023bfb6d3127), W(0xacc33360c9e634b1),
+     W(0x6cf72ff96ab166bb), W(0x477d8f2db9fdb67e), W(0x2901e630cb644736)},
+    {W(0x49454e1b03734d13), W(0x96042bcc5e7cb27d), W(0x80425f0be8e7b06e),
+     W(0x862df5247dc40b49), W(0x8ca7d7c812ed620b), W(0x2e82caf83c45ba64)},
+    0
+  },
+  {
+    {W(0x169474a2d3812087), W(0x9de300da6698ca7a), W(0x8589de922ede425b),
+     W(0x50e03fea6df8a890), W(0x0d8a5c1c4ba8b8e3), W(0xf273aa673fffb91a)},
+    {W(0x21cf054475fc8236), W(0x6ceafacf9799c242), W(0xc3237eaed0962c81),
+     W(0x43d6ac34213f6004), W(0x45e619b2d4148b6b), W(0xfafa18b5ea5fb80a)},
+    0
+  },
+  {
+    {W(0x314ea2181e4ae20d), W(0x5a1e2e5733ad7bc2), W(0x0902fb46a63ea8fb),
+     W(0x925a6dc890d84e5b), W(0xe2e74f9c14e49b8a), W(0xf5f99aa507d45be5)},
+    {W(0x7b768d07c2e81088), W(0x415fc7ed87c408f6), W(0x75db223360d5b216),
+     W(0xb132b6780a7386f4), W(0x7f933fd580c47746), W(0x673b6270fbaa631d)},
+    0
+  },
+  {
+    {W(0xaba967ac50eb2b96), W(0xb45d6d1b8df1224c), W(0xe033c601ef5f681d),
+     W(0x5c34f77ffddc580f), W(0xd30f5b66f37572d8), W(0x08cc45e3da20d4d0)},
+    {W(0xdb231027fb257ac1), W(0xa2023af932e2d053), W(0x1ccea33f7899cd7e),
+     W(0x0f4e0a7fda29c382), W(0xc6d7c5f32be14ecf), W(0xbcc549d9d9caa839)},
+    0
+  },
+  {
+    {W(0xa884edf212a02e41), W(0xc4e92741986a918f), W(0x66d004152d7852a1),
+     W(0x34732d77f26efb4c), W(0x18b3ef8e2922f8cb), W(0xb28c2fec18bccff5)},
+    {W(0xa219cb1e9f50d92b), W(0x5486903ce2bf3fa3), W(0xf0af99e1d90760eb),
+     W(0xe6fe19478a94df2e), W(0x64b5dfcd04058f89), W(0xb3e2146123d21d97)},
+    0
+  },
+  {
+    {W(0x9a8580aa2f063b51), W(0xa83c8ff71c216613), W(0xb4da0970be07f781),
+     W(0x0ac2a260712f7b7c), W(0xc9b8ee84436a7b97), W(0xd758c20d11fb2f62)},
+    {W(0x5daabed9f170b799), W(0x018d2fddc46bc387), W(0x82d6b5b7d96cfb8e),
+     W(0x4d7d0d9344d9e843), W(0xfa2a9ea991e7da3c), W(0x8230c1a3d531b253)},
+    0
+  },
+  {
+    {W(0x8f6aaff1f0129d28), W(0xc6a573d865320626), W(0x0c949e3cfd04d418),
+     W(0xf9ff819877680346), W(0x228c7899a62019d6), W(0xd71322dcc07794d0)},
+    {W(0xe74fc1805bd4d676), W(0xb92d8a84e36bb0c7), W(0x97957b79468cdcd6),
+     W(0xf4ca22a36f941f44), W(0x5622157b29c9af9d), W(0x09bbccfada99fff4)},
+    0
+  },
+  {
+    {W(0x65a11e5185708aca), W(0xa1121fa3a40b83a5), W(0x6b6cd60d40c7aa59),
+     W(0x5e04549cd2f0482f), W(0x3969d037787f2981), W(0xe443414e469d08b0)},
+    {W(0x1f692c4249fa50b4), W(0xc219be08d7590b3e), W(0xb0c2226dd9fbdec7),
+     W(0x1ddcdd17234f3c7b), W(0x14834caf54c87e94), W(0xb72318e0f8b851f6)},
+    0
+  },
+  {
+    {W(0x421c6c1919fdd62d), W(0x74c468af76410845), W(0x3de3dde0a0342a33),
+     W(0x8975b9067acdffc1), W(0x6b4f2630a5b717e4), W(0x49da256c578d0797)},
+    {W(0xfb7e34f3490d1e99), W(0x30511688f031167b), W(0x90fa6da16781a157),
+     W(0x6ac44e57369b378e), W(0xed5fa5386b261f92), W(0x88c575d0fda86085)},
+    0
+  },
+  {
+    {W(0x82412f525ec31754), W(0x42f462c89d32e890), W(0x1e7b58cece897ff2),
+     W(0xcfef785241164628), W(0x34ee0422d8bb22ef), W(0x6e0d44ac7d32f01b)},
+    {W(0x968251655a3cc196), W(0xa26724dc99eb23d3), W(0xdb575fafa75f7252),
+     W(0x778e333062a3e5b1), W(0x8689884e84cccc80), W(0x9883cd19b645502d)},
+    0
+  },
+  {
+    {W(0x3fc4118f5ca50299), W(0x238f47b60f013005), W(0xd0dd07503ed0c464),
+     W(0xef57884a7be2f91e), W(0xe014998bd67d3f99), W(0x2ad6a992c93dbad6)},
+    {W(0x10588a94d94fc2d4), W(0xadfb79a23b3ef2d3), W(0xb747ad98d0936314),
+     W(0x7857524df8656dd3), W(0xa97c8fc17360494b), W(0x004908412c6c97c6)},
+    0
+  },
+  {
+    {W(0x929f808f679bf554), W(0x4e177ca50b5f6351), W(0x258af8e4deffd1d8),
+     W(0x9a1d235d263d38b9), W(0xe933b176f2a29872), W(0xc6b93bd6894c978e)},
+    {W(0x7fa6a22770a02fb7), W(0x980299cca5d0472c), W(0x3f49af18f9523ed9),
+     W(0x0a818e8666428aff), W(0x8526af721fc8ea2c), W(0xe7a98736e5cee49a)},
+    0
+  },
+  {
+    {W(0xe4d7554bb18e2be4), W(0x5ac0a8f1bc3a8a77), W(0x47b0b9540ba528b1),
+     W(0xb475a26951ce5739), W(0x8b6e6a79ee510407), W(0x41259ddbb891d763)},
+    {W(0x948b489e6907572b), W(0xd7e2e2e3b9d1c06a), W(0xf41881c2bf851697),
+     W(0x369beff28f0f96d5), W(0xf5abe35b6d4f83b0), W(0x763e09693f0223ed)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4cc41f2834220e26), W(0xb5937c6da49749c4), W(0x705366640fa1ca24),
+     W(0xeeb40f3b91e5edaf), W(0xcdf98235f1d3de14), W(0xa65e5b7eff018c43)},
+    {W(0xaa3228e7acee3a6e), W(0xb63a6289e08f4ff1), W(0x90e90425650b2daa),
+     W(0xe4a8cad26d875f17), W(0xc212029c9ce8a46e), W(0xce0512835ed7cfb5)},
+    0
+  },
+  {
+    {W(0xadb5966fcff05ada), W(0x8ed26c025c57284e), W(0xa76e73e244693a95),
+     W(0x14da74355982bbd3), W(0x46e982cd5d2ca132), W(0x8f39074024938e76)},
+    {W(0x749206b30a89b09a), W(0x429653c793b4a1e5), W(0xbee3d1567025bb7c),
+     W(0xe23f0e1e19555c9e), W(0x0dec3837751639ba), W(0xb36cb84405d43bd0)},
+    0
+  },
+  {
+    {W(0xe4e52e865b28f7da), W(0xeb43a6809a58683f), W(0x73b951bfb49f2b38),
+     W(0x7b6cb7db3f8097cf), W(0x9dfb8d0b328fbf05), W(0x491635a5ebce6211)},
+    {W(0xa31a152390fdd577), W(0x334120df1cd2f39c), W(0x1d22834e6b563876),
+     W(0xfd91b30d10ee5a28), W(0x3d7a282d59aee4ea), W(0x36814c6b73300a76)},
+    0
+  },
+  {
+    {W(0x78b5c14c0acb5935), W(0xd9ec715c4311d3be), W(0xffa22ab209e1759e),
+     W(0x5a86263db4b2f68c), W(0x71e77c516b5be7f4), W(0xfb5bea3a19844f6d)},
+    {W(0x2519d0060890ffab), W(0x426a03f0f0329ef0), W(0x2c6d74a685b3c2a9),
+     W(0x9306f68fc294f449), W(0x552e77c22c69fb46), W(0x7c7337ad10bb9886)},
+    0
+  },
+  {
+    {W(0xeba7daad2b14da6f), W(0x8274d1a8cee90515), W(0x985c18f885bdbc82),
+     W(0x86555ff094d43909), W(0xb0b1b2b6539e108b), W(0xa4f32c66c0bf1313)},
+    {W(0xbd4777c162080e0b), W(0x73039da8dadfb23d), W(0x85bc57374a27f1dd),
+     W(0x9a8ae24eeaaa58ab), W(0x161cb2f5e876fac2), W(0x54d457e46636e377)},
+    0
+  },
+  {
+    {W(0x1674b959cfe7bceb), W(0x62e1279fe7b66a28), W(0x3962a32dc67c3648),
+     W(0x4949617368d720a6), W(0x4e81df85a957a5b2), W(0x28b5c45753123c0f)},
+    {W(0x5091dd347e239c67), W(0x10b9c3f6160ef925), W(0x5e7720f52c119dbe),
+     W(0xd584ae76c94d609a), W(0x476c63ba86dccd1f), W(0x70103a1a32508c6e)},
+    0
+  },
+  {
+    {W(0x6bbf77cb5a508291), W(0x2af81442d35db82c), W(0x357feb1a2b9febf8),
+     W(0x74240a81a25330ce), W(0x7a9ab575b4917998), W(0xa60288d5eda3ef5c)},
+    {W(0x360410d30aea9569), W(0xef66acb5b9bf8c16), W(0x7baeb466cc381b57),
+     W(0x024a98b8247a4904), W(0x6e70b4c3e3c58130), W(0x276e2420ae8a56d2)},
+    0
+  },
+  {
+    {W(0x3313a9d544b133d9), W(0xdb85c25d2da910dd), W(0xc0fdef915e4dd5cd),
+     W(0x902a2a93c565dd67), W(0xd8eba4dc7fed05ac), W(0xd453995ce157dae9)},
+    {W(0xd655d0b3f250cb55), W(0x4194a09e86119222), W(0x5b7e525a0652872b),
+     W(0xaf7968efe68c0ddb), W(0x2ec02930f51cb31c), W(0x237f3ae4f2be071e)},
+    0
+  },
+  {
+    {W(0x794593303801b021), W(0xb19bb405c9a4cde4), W(0xe20091667f9cdee9),
+     W(0x762c684f7636d30e), W(0xbf2b29f20c215831), W(0x4c0d1b651853fe90)},
+    {W(0x196ccb3157defc94), W(0x9f3d66b7f6b9cc44), W(0xb2328a0eea439dee),
+     W(0x82b3808d7b140e5b), W(0x986210dd88e4a35c), W(0x9b171fc838a2b7a7)},
+    0
+  },
+  {
+    {W(0xa6f8b354666eb2f0), W(0x7fbf6d91f9c7b16e), W(0x9b360814161b5e0b),
+     W(0x13726fbd921511a4), W(0x37aa1b8013833a11), W(0x53f01183407b9889)},
+    {W(0x8a83ea3fd147da9f), W(0x25279241db0ad0b1), W(0x78353bccd1a8d9ae),
+     W(0x1e33c10e271f7f0e), W(0x136d9e7e9e67adc5), W(0x11dcef95cc56ff8d)},
+    0
+  },
+  {
+    {W(0xd0051ab940ee5098), W(0x4861b2461d8311de), W(0x6b7796e0f31e860f),
+     W(0xde8b243acfd543e3), W(0xef9d0957a0161843), W(0x70fd43ecefefcbae)},
+    {W(0xd47392541931a5a6), W(0x42e253300342623a), W(0x90b33edd52ffbf5f),
+     W(0x0affda4ca015a550), W(0x8716376b77e59672), W(0x39d84b33fc0e9448)},
+    0
+  },
+  {
+    {W(0xd1b2af2f2bca651b), W(0x2211e4f97404bc78), W(0x787b1cc8fc5068f2),
+     W(0x73d6da299fcbb3f5), W(0x6867fb7707d2142f), W(0x36f277ae116ad6bd)},
+    {W(0x81c86073a7534943), W(0x67188488c4033c7a), W(0x13a8415ccc568123),
+     W(0xbc01db07f3f475de), W(0x90b8af2e3aaeee1a), W(0x320c4880175fa55b)},
+    0
+  },
+  {
+    {W(0x51e05f7d450535fb), W(0xa5f5181effbe389f), W(0xdf178fffaa2d5514),
+     W(0x89358810e51da035), W(0x206e324f664d399c), W(0xc148ae74c4477d4e)},
+    {W(0xe0c8d4377d6f38d5), W(0x327aad6d8c8133e9), W(0xa685a889d21cac4d),
+     W(0x1217c68d0ceb5770), W(0xa4a09612d21f1d50), W(0xab64b4dd889676af)},
+    0
+  },
+  {
+    {W(0xa54436b6ba3403ff), W(0x1fe4b1ecdcbc4822), W(0xb3b351004c6846e2),
+     W(0x360278048d1cac7c), W(0x9eff87327e86d5d1), W(0x7f435326ba21993a)},
+    {W(0xb51a9da5adc24224), W(0x111c19fcc8c14a71), W(0x05aa2c86ab77e011),
+     W(0x81edc338ce72744d), W(0x20fa8f528d882bc3), W(0xc61c3e639d1696f3)},
+    0
+  },
+  {
+    {W(0xbf7fea3aee1fee16), W(0x31fb342ce0cde85b), W(0x9a232ea51575924b),
+     W(0xc3132e6cbcc4cf26), W(0xbc5b7a7102499a58), W(0x3064a3b904d99836)},
+    {W(0x6f17475ff8b3bad1), W(0xaeeb90c429271790), W(0x7f442a13f8eca53d),
+     W(0x6d641eea08882274), W(0x8dff43bf88ffaeba), W(0xaa92827f5840b198)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9b23ab4e94d0864f), W(0x46356266009c9fc1), W(0xdbe99e51e798edf9),
+     W(0x38547449307675c7), W(0x23ffaf55628c0fb6), W(0x56ccd2a31698c372)},
+    {W(0x39f45a578347ce95), W(0xe0aaec744f2c6118), W(0x2a89079e4af138fc),
+     W(0xb86371ea2ee4ecc0), W(0x076d256a06bbf92f), W(0x9073adb8ae3c4c51)},
+    0
+  },
+  {
+    {W(0xba2e9543743c15d9), W(0x7d5812db1c99c984), W(0xf94db95145bdc19e),
+     W(0x951d00ae382e77bd), W(0x9940a5fbb220b29a), W(0x6908d50e58fc91f1)},
+    {W(0x682e42eadd0940fe), W(0x2124e23aa1d32009), W(0xbe15810016294d05),
+     W(0xaea13fe32e326d68), W(0xc0dfe1ef15e64fce), W(0x32dbc0b5b8237a8a)},
+    0
+  },
+  {
+    {W(0xe59b80020bc28725), W(0xc6f8fa54149f8991), W(0x8799172a5af5b47e),
+     W(0xf72c9780160d7e8d), W(0x1d1ce972b2f9a549), W(0x8fce3f164857b44a)},
+    {W(0x2545bdd71ed5e0e5), W(0x222c33a7c259176a), W(0x5a60343a4e23c064),
+     W(0x986779f91d1fd9cd), W(0x5bd5611b3570b5b3), W(0x2758caeaf9d765a3)},
+    0
+  },
+  {
+    {W(0x6ee65a08c36d3f25), W(0x7b6c811fe393e4d4), W(0xc4a2cc382876e523),
+     W(0xab7aba26d3bf53aa), W(0x5bf00871db7f290c), W(0x3cb1cd131ee6d5bd)},
+    {W(0x4cafb218de998ada), W(0xa1ecf36af6319101), W(0xa1fe785520b281cc),
+     W(0xe457198e64d9c65e), W(0xa3d1a6d0c5a0e67b), W(0x69ddbc3290cc468a)},
+    0
+  },
+  {
+    {W(0xcb0a3657a1fd057d), W(0xad79ae60b4aa013b), W(0x0b85210997ed887a),
+     W(0x5fec3e1f30d9b297), W(0x4ce4149f10fb9c74), W(0x4e08b4d98cbff785)},
+    {W(0x81b0d7b42f07cbae), W(0x08bc321e495230ae), W(0xaec221de2b841eb8),
+     W(0x62c7d86ad83c22e6), W(0x5504dcf885affe91), W(0x785a06f1f445481d)},
+    0
+  },
+  {
+    {W(0xd4ee3f7f6dadc46f), W(0xa1f3dc925d7febd6), W(0x4c0bee1363ebab5b),
+     W(0x70e32d77005ec237), W(0x302fc73dc52fb006), W(0x1af84c0a8f159899)},
+    {W(0x42a5478f0686232a), W(0xb4fc56348a308687), W(0x042c4970c8378f0d),
+     W(0x70c195758e2c86c5), W(0x61a95e6884c7c767), W(0xd96a8216d6fb43a8)},
+    0
+  },
+  {
+    {W(0xeaf237a8ee49a1bf), W(0x78bf04bf4ea1da86), W(0x5fbffa473f251ad5),
+     W(0xc40570f6d828578e), W(0x5cc65c0dd4e118ad), W(0x9e18ff965da48548)},
+    {W(0xe27fc2e7ef7e714b), W(0x19ff3f7c13df7524), W(0x35a32fa55e27fb12),
+     W(0x7fcfd72810003fae), W(0xc74b50a3f49800c1), W(0xbf0732ebdbafb2e6)},
+    0
+  },
+  {
+    {W(0x0c62fd2d543c1255), W(0x71ea9c6fef361a27), W(0x76b0933dcef3f9e3),
+     W(0x51b1ec2d9889ffa2), W(0x9e84b2ba9a3c88d2), W(0xc8996b961913e52f)},
+    {W(0xbafc5e94cee43e36), W(0xd9898d2470c658b7), W(0x4e9bcc41bed17108),
+     W(0x0db5b7336c7a41c8), W(0xd4be07a7795369cd), W(0xb899f92f7bd3a934)},
+    0
+  },
+  {
+    {W(0xa4089bcdcf53cae7), W(0x5d1f815a5312f7ff), W(0x0a622537e78b6e80),
+     W(0x9cea9d355a98fe2f), W(0xeedf9dceacd16a4b), W(0xba487776a36c65ea)},
+    {W(0x89dcd623f6a2125d), W(0xa790bc4240dee109), W(0x5c05da5456e54df2),
+     W(0xecb3a86e491809d6), W(0x76f2551f35638be3), W(0x34b0e31ab6a93a1a)},
+    0
+  },
+  {
+    {W(0x1fffcbc010e15faf), W(0x8447bdb8910245ac), W(0x857d521e86476901),
+     W(0xcd1d5f87369ccfe9), W(0x560b3277b3f1dbf1), W(0x4ac02a1a47ea4266)},
+    {W(0x29ac98b6a8a929ee), W(0x020ec6db5e5e70c0), W(0xb0be38ba21291be6),
+     W(0xcbe9d362bdba40de), W(0xc585450571535a89), W(0xc21839de3d7a3235)},
+    0
+  },
+  {
+    {W(0xc01a0a722d033ed1), W(0xd5fb941e0bba736f), W(0xe780d8ca57b2a6cd),
+     W(0x85f71ea14b254b75), W(0x1843d5fff46e8fc1), W(0xdf2e74b40d18ddf4)},
+    {W(0xe0d22a28c48c8194), W(0xe7341fc1d89a2db7), W(0xe01a82e7cbef09c0),
+     W(0x0fa85cc37e00e288), W(0xa15df54989fe9608), W(0x385f7b0a772809e7)},
+    0
+  },
+  {
+    {W(0x831541b39805497a), W(0x2ceb5ac879c414cb), W(0x86601fa616d2eb82),
+     W(0x373d19079338ce8e), W(0x98151a90c1f5c87a), W(0x966ebde6048a538c)},
+    {W(0x5c4a8c5ae180ff7c), W(0x6d9065dff996d994), W(0x4e0dd86e2460ab91),
+     W(0xfbe8b3ff309a8f5e), W(0x33d7cb35856f7218), W(0x62b2200a1ac59f2a)},
+    0
+  },
+  {
+    {W(0x97a3697e44122de2), W(0x36886fc39b81a35d), W(0xb592a42a8a5ac720),
+     W(0x6990bda7b4f6899c), W(0x14d0d1a8d91d314d), W(0x2337c098e77d8b2a)},
+    {W(0xe050b30aaeb15f55), W(0xad55fe4432f87e83), W(0x39eaece428798322),
+     W(0x8657e12924e5f9f9), W(0x5fb87189c391c614), W(0x1908ad8babab0810)},
+    0
+  },
+  {
+    {W(0xb36ad750a460e53f), W(0x727006d60df0f7b0), W(0x6ca3ac348ee96a11),
+     W(0xb04f6ae930e75d1b), W(0x9957738a3a24e9ee), W(0xc0117a7d16521e18)},
+    {W(0x79fcea8872ad7e27), W(0xcbe2c2d37281e3b5), W(0x31915f1cc391fc60),
+     W(0x1c1c0082a13a92e1), W(0x362663cc7ddca7ac), W(0x8021aad689689d35)},
+    0
+  },
+  {
+    {W(0xeec5543ef134a90b), W(0xdbcf554128c03636), W(0x4854d7d93fa1ea58),
+     W(0xe7b66746025c1cdf), W(0xbe612a218a65556b), W(0xf71ea86b57c0d7b5)},
+    {W(0xa65e144b40f2c343), W(0xb261b35d80412529), W(0xbbb22b32a088f637),
+     W(0x94184246d19f3c59), W(0xefccb5d5c0cc2292), W(0x420888636cb47b95)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3f2eff53de1e4e55), W(0x6b749943e4d3ecc4), W(0xaf10b18a0dde190d),
+     W(0xf491b98da26b0409), W(0x66080782a2b1d944), W(0x59277dc697e8c541)},
+    {W(0xfdbfc5f6006f18aa), W(0x435d165bfadd8be1), W(0x8e5d263857645ef4),
+     W(0x31bcfda6a0258363), W(0xf5330ab8d35d2503), W(0xb71369f0c7cab285)},
+    0
+  },
+  {
+    {W(0xf16938f514c5969b), W(0xde2e3cf0944b2271), W(0x2d5095530b6490d6),
+     W(0x8432fef1a28a296a), W(0x6f254dd08d26415c), W(0x3780eeadd50c2865)},
+    {W(0x4f5bc455665b8794), W(0xef31fb9e56cb7018), W(0xbab8dd6e65e59340),
+     W(0x676baca2a56dc2ea), W(0x38eea06beaa90e05), W(0x26e64224174bada0)},
+    0
+  },
+  {
+    {W(0xe6a19dcc40acc5a8), W(0x1c3a1ff1dbc6dbf8), W(0xb4d89b9fc6455613),
+     W(0x6cb0fe44a7390d0e), W(0xade197a459ea135a), W(0xda6aa86520680982)},
+    {W(0x03db9be95a442c1b), W(0x221a2d732bfb93f2), W(0x44dee8d4753c196c),
+     W(0x59adcc700b7c6ff5), W(0xc6260ec24ca1b142), W(0x4c3cb5c646cbd4f2)},
+    0
+  },
+  {
+    {W(0xa35e411c2cb40964), W(0xdd7d4f4cc331a3d6), W(0x7c7c859e89a66f2b),
+     W(0x9908c37e0def8ecd), W(0x8274124e344947b7), W(0x0d279f7b568b0ce8)},
+    {W(0xe5291961866091ec), W(0xb056e3bf3a08acc7), W(0x60fb39e156bd3a7d),
+     W(0xe56a34d6268f8562), W(0xb3a1fe1613fd8293), W(0x6a41e1a967537fcb)},
+    0
+  },
+  {
+    {W(0x8a15d6fea417111f), W(0xfe4a16bd71d93fcc), W(0x7a7ee38c55bbe732),
+     W(0xeff146a51ff94a9d), W(0xe572d13edd585ab5), W(0xd879790e06491a5d)},
+    {W(0x9c84e1c52a58cb2e), W(0xd79d13746c938630), W(0xdb12cd9b385f06c7),
+     W(0x0c93eb977a7759c3), W(0xf1f5b0fe683bd706), W(0x541e4f7285ec3d50)},
+    0
+  },
+  {
+    {W(0x89e48d8bc6bb5e5f), W(0x0880ede01ea95a10), W(0x60f033d7302c0daa),
+     W(0x15e4578a048eefe3), W(0xfd6dec89b0a72244), W(0x1f7cd75e309489cd)},
+    {W(0x7cdcc2a0e9aba7fd), W(0xd18dc5c7f28ba00f), W(0xa6300a455812b55f),
+     W(0x8fa5c4152ca31d8c), W(0x36aa3c234f3a5b5a), W(0xd128739ec86cf4e0)},
+    0
+  },
+  {
+    {W(0x9a0e153581833608), W(0x5cce871e6e2833ac), W(0xc17059eafb29777c),
+     W(0x7e40e5fae354cafd), W(0x9cf594054d07c371), W(0x64ce36b2a71c3945)},
+    {W(0x69309e9656caf487), W(0x3d719e9f1ae3454b), W(0xf2164070e25823b6),
+     W(0xead851bd0bc27359), W(0x3d21bfe8b0925094), W(0xa783b1e934a97f4e)},
+    0
+  },
+  {
+    {W(0xd927283013575004), W(0x01a330d620b2275e), W(0x58b9207f450db713),
+     W(0xae95338423e16d95), W(0x4f10c6d4e60e349c), W(0x541d03ecfeb122bc)},
+    {W(0x22548cd22c648211), W(0x5c2dc84cd01354f5), W(0xa1c6f912b6167b3c),
+     W(0x6967bab27902d2ba), W(0xebbe0b0836de34ba), W(0x6985b33a4b79625e)},
+    0
+  },
+  {
+    {W(0x406b0c269546491a), W(0x9e5e15e2f293c4e5), W(0xc60d641315b164db),
+     W(0x0da46f530c75a78e), W(0x7c599bb7ea0c656b), W(0x0f07a5121b1a8122)},
+    {W(0x14c7204a15172686), W(0x8faedff85165625d), W(0x20f260ce37aede40),
+     W(0xc81f771e8f357ffe), W(0x25499197b0912557), W(0x736197dc4c739c74)},
+    0
+  },
+  {
+    {W(0xf2d015bdaefdd5e1), W(0x33b4e21c4bf9edae), W(0x4860aadc64b35fcc),
+     W(0x77b657e9f13f8112), W(0x65f2862590dc84fe), W(0x4eabfd22d66be036)},
+    {W(0xb02131236ff05dd0), W(0xa104d4aaa9fe5d11), W(0xdc7efe3b9b8ae390),
+     W(0x46918b54eb87fb5c), W(0xf5771d7172b7172a), W(0x41e49e4713587bf0)},
+    0
+  },
+  {
+    {W(0x6151bab1381b3462), W(0x27e5a07843dbd344), W(0x2cb05bd6a1c3e9fb),
+     W(0x2a75976027cf2a11), W(0x0adcf9dbff43e702), W(0x4bbf03e21f484146)},
+    {W(0x0e74997f55b6521a), W(0x15629231ade17086), W(0x7f143e867493fc58),
+     W(0x60869095af8b9670), W(0x482cfcd77e524869), W(0x9e8060c31d454756)},
+    0
+  },
+  {
+    {W(0x3ec55ddc9004b845), W(0x5101127cbe7b06eb), W(0xdddafd57fc4176e9),
+     W(0xd8cb31c0e4a31ddc), W(0x94e83a89d42feabb), W(0xd4401def2f74ec68)},
+    {W(0x9c9defb65adb654d), W(0x9a3513f05053eeda), W(0xceab2dec7cdb455e),
+     W(0x9954280859d24f59), W(0x22ead45231d30504), W(0xe9df48f90521a229)},
+    0
+  },
+  {
+    {W(0xe495747ac88b4d3b), W(0xb7559835ae8a948f), W(0x67eef3a9deb56853),
+     W(0x0e20e2699dee5adf), W(0x9031af6761f0a1aa), W(0x76669d32683402bc)},
+    {W(0x90bd231306718b16), W(0xe1b22a21864efdac), W(0xe4ffe9096620089f),
+     W(0xb84c842e3428e2d9), W(0x0e28c880fe3871fc), W(0x8932f6983f21c200)},
+    0
+  },
+  {
+    {W(0x36dd28ea441d0806), W(0x6680c72c21518207), W(0xc5d40e280a484dbc),
+     W(0xdb1170c6a3a2ba6e), W(0x07290fd140a91c7d), W(0xdd12571695ee9ca2)},
+    {W(0x595dad6307876188), W(0x6fcf18c0499d4827), W(0xdcd946a3206e617d),
+     W(0x6cf08f51e7bceaef), W(0x7a85c02db19a06ac), W(0xf1365fc67140a7df)},
+    0
+  },
+  {
+    {W(0x603f00ce6c90ea5d), W(0x6473930740a2f693), W(0xaf65148b2174e517),
+     W(0x162fc2caf784ae74), W(0x0d9a88254d5f6458), W(0x0c2d586143aace93)},
+    {W(0xbf1eadde9f73cbfc), W(0xde9c34c09c68bbca), W(0x6d95602d67ef8a1a),
+     W(0x0af2581ba791b241), W(0x14f7736112cad604), W(0x19f2354de2acd1ad)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9e857f33771560ab), W(0x4ae1ba22250f109d), W(0xf8538d68ff4f6566),
+     W(0x35380f15ac339148), W(0xfef0bfdd5ddfc12f), W(0xf706c6bf1387d93e)},
+    {W(0x618ce77d5357e131), W(0xf0921744236478c4), W(0x24eaf06e00dc0da5),
+     W(0x049113be07603cc7), W(0x5cf489088f6963c7), W(0xbe5eb9e6ede4a300)},
+    0
+  },
+  {
+    {W(0x77e486f85d066c15), W(0x0c05b6c24ed5307d), W(0x322b28ab7df36628),
+     W(0x2d14d1316704dcd6), W(0xd359977af29a3567), W(0xc29bb132ec96d3b6)},
+    {W(0xfd6e400ae6bfa701), W(0x03db99244c7e5101), W(0x62d81c7d9b8533af),
+     W(0xefa638c28de66eb8), W(0x7405a9d7e86784ee), W(0xafaa74efa6c22223)},
+    0
+  },
+  {
+    {W(0x6909994f0572e536), W(0x9d22f9157fed8954), W(0x1505ca05884aaca9),
+     W(0xe4b6530996995a98), W(0x30e00a5ed02c000e), W(0xb9032350236e7b09)},
+    {W(0xe696f09e14f6c7bf), W(0x2126b6277dc18d06), W(0xa9ada7b401e1e2a4),
+     W(0x9630acb69d2d025a), W(0x9fab2c6ed84ffeb1), W(0xc1d0db26ab7584f6)},
+    0
+  },
+  {
+    {W(0xf9b2dba4b9d36e91), W(0x5fb4f6cefda9b2c4), W(0x7692a4f33b8104ee),
+     W(0x5da885b0e4e1896e), W(0xc2a30fec73d2aa36), W(0x7d06e6af86f60bca)},
+    {W(0xbc8bf16d87287887), W(0x6c3dd86a3d701bec), W(0x8e79e2f37e35610a),
+     W(0x981139f482f9d71c), W(0xf8997ec424e62733), W(0x330d989aa3518061)},
+    0
+  },
+  {
+    {W(0x6cf0e6ef9b7e3cc9), W(0xb465be6b0320acbd), W(0x02777783856111dc),
+     W(0x3a1d36f0c0e9f2b0), W(0xfcf4f6365e7fe507), W(0x36bf41827fa7c8f1)},
+    {W(0x09a02de8b0f4ce56), W(0xa0bbf65ca9cdb353), W(0x7211a9654b7f4e35),
+     W(0xa6b2ba79805b58bd), W(0x418302c20957860c), W(0x3c17ec02f99f9d58)},
+    0
+  },
+  {
+    {W(0x4e6ef410ca89fbad), W(0xe0fc53ba53933b78), W(0xa4f03403fd41d143),
+     W(0x3a507177e0774c37), W(0x078e8c568ec7484a), W(0xfb73c6b6fbb3f66b)},
+    {W(0x169c94753bfbdff6), W(0x44d286060a232243), W(0x3e8e968508303114),
+     W(0x7a9797b8fad0def2), W(0x0ad14404efc1c8da), W(0x6daae4e921ced721)},
+    0
+  },
+  {
+    {W(0xfde0d1b4cbfd18ab), W(0xa3c9917595850f83), W(0x16d3ad79c9eb9de3),
+     W(0x2707ec8b0ffbcdac), W(0xd7e6750fa220287c), W(0xe51baf059c2e155a)},
+    {W(0x3018c309871e10fa), W(0x074f08e3f23221c2), W(0x1aa323aecf15a4af),
+     W(0xf085d69cc1b8cca0), W(0x47a3eaccb143a969), W(0x56a04522f3a98430)},
+    0
+  },
+  {
+    {W(0xc7e9ddef88dd2dc2), W(0x2c21a99819a0c0b5), W(0x6bc0746db239bb82),
+     W(0xc811a8eb28ea1341), W(0x5f714ca71d1309b0), W(0x79eabd20d4eb9b34)},
+    {W(0xe0e5afdcdf0fb30f), W(0x1b01a16d8c0814c6), W(0x670e1e7b84334366),
+     W(0xc8c38f9a0eed1116), W(0xf914fae2619bbd50), W(0x1ed062cb51c1995a)},
+    0
+  },
+  {
+    {W(0xce64d065b711b4e9), W(0x32760c2eefc4d25e), W(0x9e5916caa6292c7b),
+     W(0xa90d40bff2a47dee), W(0x90dc6681604933d2), W(0x707270c60115cf42)},
+    {W(0x55b601ff6fe583ab), W(0xdd2fe842a039dafe), W(0x602d8de34c2d3357),
+     W(0x7cc979bca7ab9014), W(0x4b8dcf7e60118797), W(0x7f1f2a04cbfaad32)},
+    0
+  },
+  {
+    {W(0xd4e60e15cb583422), W(0xc6b1ef90320f296f), W(0x0714bad0d9bfc834),
+     W(0x5ee2ca8c9050e2c2), W(0x074a8ca824f7cf1d), W(0xb975024910df8516)},
+    {W(0xecee8ab7c2636d2c), W(0x308e5af13b4b7bbd), W(0xfed4f27eee2ae021),
+     W(0x7cd4bb192065253b), W(0x6b21a3f84de525b4), W(0x0f10e7bdac27fddb)},
+    0
+  },
+  {
+    {W(0xb4f02d9dbb3bf37a), W(0x69590395978aacc1), W(0xdf99b1309c3def3f),
+     W(0x5c66391e12be0bce), W(0x30ab382cb5eaf100), W(0x9b84b2b4e0352249)},
+    {W(0x0c22e4e1af14e85a), W(0xc29d3c592286ea0c), W(0x6c7f8b6a40758aeb),
+     W(0x7a91adccde68fd0b), W(0x4d8554fec8e8fd4a), W(0x9fa863d5bb5621e5)},
+    0
+  },
+  {
+    {W(0xd5068487870e29cb), W(0xf9420b85fc52d5cb), W(0x50c3265a496d000d),
+     W(0xe605414a166bd6b4), W(0x4de8d724c62b2a6c), W(0x16af06f2a1a11048)},
+    {W(0x5406bde945f43c4c), W(0x5e15bf6c751ad18e), W(0xa846e665b6a59587),
+     W(0xcdb28a7d1816ac55), W(0x899b3551819b73f8), W(0x2d46297bbc848d08)},
+    0
+  },
+  {
+    {W(0x76f5aedd44af60a1), W(0xf7bd3b4651d1efd8), W(0xdfbf3c6439a9721e),
+     W(0xf927fbf0ee9d2ab3), W(0x628e9258c7e0779d), W(0x062cb2fe4cf1dccf)},
+    {W(0xb2ff57dde2278f00), W(0x3f0e140a2d199ca3), W(0xe7161304342c0a9c),
+     W(0xe7ca734f0bdbe131), W(0x7d070270870057d8), W(0xf6f1a65daaa55860)},
+    0
+  },
+  {
+    {W(0xdc4cc720299127be), W(0x5b34e762faab8165), W(0x2289b2f7b39c120d),
+     W(0x687a78d06e52b913), W(0xd2a091dd2a3ea6a5), W(0xc61eced638eab329)},
+    {W(0x652231ea7887ff2b), W(0x77a568750479db4e), W(0x1ef471c8d43c5722),
+     W(0xf82bf436f3764c34), W(0x962af4050445cafe), W(0xed8b227f5ff47259)},
+    0
+  },
+  {
+    {W(0x30e045f4a73c3da0), W(0x13d2527df36c6346), W(0x3dffe56d3836fb9b),
+     W(0x9518276617c5d2bf), W(0xa0ef38724dd0b240), W(0xb45e19ebc39c675a)},
+    {W(0x65202bc603e95445), W(0x41e2f0d19a2ec9dc), W(0x51c719cf2a0d762b),
+     W(0x3bfb9729ecc6b9f8), W(0xda8271705a261640), W(0x65c2bbbcaeee5f3f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xde849cd1d89594ab), W(0x00e2d2b10ec4fb3a), W(0x3fbd9e3dabe92fba),
+     W(0x785414d43324900a), W(0xdaead1abde20904e), W(0xb493e121aa5f1ba8)},
+    {W(0xd60a4f2d6eaea0dc), W(0x394746b56fca8596), W(0x163dc78934efa243),
+     W(0x3067dccf216a8d8c), W(0x116b6534a901617b), W(0x8c4bd099bbabe51e)},
+    0
+  },
+  {
+    {W(0x929454f6b3952db4), W(0x412142ec4d3f69f5), W(0xf5b0a7c5ee25c0b0),
+     W(0x7d3372ff2e752295), W(0xd6dadc7d6eacac68), W(0x5f0076cca96a8e3c)},
+    {W(0xea831db671725b3a), W(0x4a286c89c29ab454), W(0x5ff817e572e3c00c),
+     W(0xb022e25d2a5fb6ba), W(0xb611c5bcbb392476), W(0x062c14dc190485a0)},
+    0
+  },
+  {
+    {W(0xefda99d9ce11b02e), W(0x9017bd4a3f820083), W(0x8b9e6cd1ad14ac6f),
+     W(0x1239ee331f413880), W(0xd98e93d993dd7fb9), W(0xc280d252894fcb12)},
+    {W(0x33a9201a5230b5ee), W(0xc6aeee256e41de26), W(0x845051280d0a320a),
+     W(0xc20551db4b607b53), W(0x6e63c766ea228c2e), W(0x883321aeac48f25c)},
+    0
+  },
+  {
+    {W(0x0372678dc419b0aa), W(0xf95031d8c13fdf17), W(0xebaebca4b79594c3),
+     W(0xe587850baf3b75cf), W(0x534183ac2c1e09c6), W(0x3f5b0bfdc08204cd)},
+    {W(0xdac2cf06e297cc77), W(0x5e47d9c6d0487084), W(0xf6f509f490b0f6c2),
+     W(0x3ffc3cd6c2c62207), W(0xbb21eb1132ff1887), W(0x2116a023e62ccc6f)},
+    0
+  },
+  {
+    {W(0x1ca74a318dc4478b), W(0x97997086ff132482), W(0x370949038d6b4aff),
+     W(0x12ba86e02f7906ee), W(0xaa76f77adc452bbb), W(0xc64a35cdf9837039)},
+    {W(0x41fe307085138702), W(0xcfa3811bd0942b41), W(0xcffa24ccaa7d44b1),
+     W(0x22bae395d86900f9), W(0xe7a138782e3ecfa0), W(0xfd430ed786d28980)},
+    0
+  },
+  {
+    {W(0x91b8b685e2a0a7d3), W(0xcaae1cf6866978c7), W(0xcdb0d69ea7d99319),
+     W(0x3c8441dc7632a26b), W(0xf11a365c62ba170f), W(0x5b0c1e4234e748ad)},
+    {W(0x523ca2d80ab534a3), W(0xabd7ec7de06a0f67), W(0x71afc7771d07308b),
+     W(0x73588d77c291c2ef), W(0x29baa3b0aab40d17), W(0x2f87f536eea9f156)},
+    0
+  },
+  {
+    {W(0x0ae9143ac92452de), W(0x34bfffdfd93b53c3), W(0x23dff7a7f3b4b882),
+     W(0xb178e73de22d9b99), W(0xa83861afaa4f02b1), W(0xa249bd36b9064c2f)},
+    {W(0x142eb294ae8a5508), W(0xafb8eefbc91e3fee), W(0xd589717fe649a8b6),
+     W(0xa925c47cad53c9bb), W(0xc339b11a09ecd8f7), W(0x573c6d341bbf1142)},
+    0
+  },
+  {
+    {W(0x406a7e2116960728), W(0xd03923f85597d8c4), W(0xd4402eff020748ee),
+     W(0x7827442af39b58db), W(0x77e3f2768d8cfb04), W(0xf6eb49c8e45a978f)},
+    {W(0x9db0829949247f6a), W(0xce71a74706669fe5), W(0xe434ce47b82775f5),
+     W(0xe84995ef63910016), W(0xa35e8b971e47792f), W(0xc779cb3d7c6aaeb9)},
+    0
+  },
+  {
+    {W(0x6768f197f0c64dff), W(0x097eedddfecdc37c), W(0xd5b1e563d1716c49),
+     W(0x9cc29f59848f58ab), W(0xbf76ba49d8ba77d9), W(0x2441433f10b28c49)},
+    {W(0x64d7173632c5b6f7), W(0xf7f60750bb04f254), W(0x4b8f79a894dbc860),
+     W(0x04f6a706acf62628), W(0xd278b8bca0dac11d), W(0x2f1df94acaa52852)},
+    0
+  },
+  {
+    {W(0x83f92da42c7bdb9d), W(0x7ee9e6fe5c8f7d11), W(0xb49db5948449d043),
+     W(0x3cf6b2acf6f0cc94), W(0x9dd82966aa9bf685), W(0xdfef4cc8efc028c6)},
+    {W(0xd9205648ea992e20), W(0xcdf4cd802e7c6cfd), W(0x2eaa0d3f4778d448),
+     W(0xd66c02561d550b91), W(0x31e91a94f794c9f0), W(0x3d48c21065083703)},
+    0
+  },
+  {
+    {W(0x060f90e0593133bf), W(0xb53203c95141a2f0), W(0xdd482f7b905c8fef),
+     W(0x5a881c5c5893f33d), W(0x882671cbd443956b), W(0x88ab5f5891a9153f)},
+    {W(0xe9842fa07416ef26), W(0x0334cf6565aeb914), W(0xe0be1149bdd0c07d),
+     W(0x2e5e1c70b04fa082), W(0x63e59b927fcf56bb), W(0x68126a82fc899d02)},
+    0
+  },
+  {
+    {W(0x66428800ff381db7), W(0xa9b9d01955574ac6), W(0x30cdc21fbdf4a86c),
+     W(0x2ec38d35741c4a26), W(0x35496c230b6be057), W(0xaecc67e601656b1f)},
+    {W(0x781af00ff7d70324), W(0xac0e65795d7ee71e), W(0x60a35c6ca6b14e3a),
+     W(0xacd6813b0e6c1c3a), W(0xd7f770241faeef73), W(0xd2254b8f23eddf05)},
+    0
+  },
+  {
+    {W(0x7aa6351ace143fe6), W(0xb841832e859b5d1c), W(0xebde9ea13228d945),
+     W(0xd073cea6016f2c6a), W(0x638837977fdb8b11), W(0x7591671b27360f69)},
+    {W(0x99526333b70b371c), W(0x17e624d76b9e1ab8), W(0xe960e128405bbc48),
+     W(0x04872c85d1326d01), W(0xe13125e43b9af083), W(0xa08d435376e98678)},
+    0
+  },
+  {
+    {W(0x755b3ee8120cf932), W(0xe633ec494d1789b9), W(0xcf1157822acdc57c),
+     W(0xa87c488a6351076b), W(0x281e9dfdc2080e74), W(0xa9fcbc48b4a18bbe)},
+    {W(0x083a323b5f3fedfc), W(0x84f4c12dc3cfea0f), W(0x5e6c9deed5dddc3a),
+     W(0x32df1ebceaf6c15b), W(0x76047e26afcf6348), W(0xa889777104b5d271)},
+    0
+  },
+  {
+    {W(0x523020fc2fb9d83a), W(0xcde5c38a36a06b18), W(0x728aa50e4da499f7),
+     W(0x6722723a9e702b6d), W(0x689a2f624167cc75), W(0x5ad53627fb4c99a7)},
+    {W(0x4263ae5f0aa0ef3c), W(0x7736269f7617b95a), W(0x1553f642e665616e),
+     W(0x76893424849d4718), W(0x045ed86577472177), W(0x1c2aaa88c9583e7e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1fa064cfaf31ea1d), W(0x2a9547a848e8d974), W(0xda8102a1fa9d9453),
+     W(0x786aecabdc6bd7ea), W(0xcaf91e3bca2f6044), W(0x67d86ea78573f208)},
+    {W(0xd309fce9c505ae24), W(0x67ddc5b17f86eb8e), W(0x57791ae0f3d53056),
+     W(0x26b053f00d1fd61e), W(0x91c962c0045ebfa6), W(0xe95246de076ed979)},
+    0
+  },
+  {
+    {W(0x49f24994e7c03ce4), W(0x274a8c132aed9ba3), W(0x897b9103d5e91bc0),
+     W(0x63db1efbcb404f68), W(0x70efd9d842f7fc02), W(0xd6e02921c6a230af)},
+    {W(0x8d5b199f11ae0a56), W(0xc98287dece33da6a), W(0xde583d34504dd889),
+     W(0x03756001f823686f), W(0xf19ab86f95fc73dc), W(0x300406c693f12f42)},
+    0
+  },
+  {
+    {W(0x3f896ca9fa4dd561), W(0x4b9a98abd2de2ecb), W(0xd0741632600e4e2a),
+     W(0x87c7db5f69e702d5), W(0x1f5a3b8053e0df2b), W(0xe1e24b49f443dfba)},
+    {W(0xeb90e2305eef3a1d), W(0x8f3fc8a6d38f73fc), W(0xfb1e8299a5aa335a),
+     W(0xd78504cd4197b32a), W(0x0e7a79cc6755918e), W(0xc7c98ae2883b1c72)},
+    0
+  },
+  {
+    {W(0xbf66baa5b44b1d0c), W(0xbbed18eda44f8eda), W(0x80bc32abeaaa466c),
+     W(0x605b7897e5f2733b), W(0xe9e7e3a1a2531afa), W(0x25d66db33deb8369)},
+    {W(0x36212ea3b2f25d10), W(0x52d6b3f4a08d303e), W(0xefa54b31444e9e9f),
+     W(0x9c2229a169530c1b), W(0x68feb9854b79bdd1), W(0xd570e84f8b984cc3)},
+    0
+  },
+  {
+    {W(0x1df8d98c57b168fd), W(0x042fd731b45da94e), W(0xa54d64f91703e143),
+     W(0xa12198be9de0ab4c), W(0x160e06241ddc4e0f), W(0x15cae64a6695891f)},
+    {W(0x808565e70c2b2081), W(0x6de4a393cc65040c), W(0x6682cd934bac1768),
+     W(0x62e7ac2ca5be965f), W(0xd33f6f8ad7a38e90), W(0x9cafc4635b8b516e)},
+    0
+  },
+  {
+    {W(0xf041e421aa44f3e2), W(0x47ed9e8eae6fd2b7), W(0x4fea93751128ed62),
+     W(0x041a1c1acec6eae6), W(0x1f32359415a65dae), W(0x741fea0a0154e8e8)},
+    {W(0x309e9f289c32e224), W(0x457d4ffa902ce57b), W(0x7bb54dd5692420c2),
+     W(0x193a41aec4fa1a6a), W(0x35f5f3b43d779e77), W(0x31e84371046ebb8c)},
+    0
+  },
+  {
+    {W(0x3a5a366ea1554376), W(0x0e1687c052a6ed9d), W(0x3e16e4aafe5355be),
+     W(0x6d8bac03ced67666), W(0x403eb33ed9344003), W(0xd7b9ec0d333ab20c)},
+    {W(0x9fce1986d64c272c), W(0x9d52d64bb1e23843), W(0x8e689611921a58e5),
+     W(0x8f5f115620d5c61a), W(0xb17f612fadc81b4e), W(0x36e2db30e562f779)},
+    0
+  },
+  {
+    {W(0xd6a4d25c845f26e4), W(0x71e554ce1b039dff), W(0x942059731cdedfc0),
+     W(0x0c4e385603d6502f), W(0x981a4fc5e15ce8c8), W(0x85d1b0f17aca30b7)},
+    {W(0xf2037ef777bb9e43), W(0xc52804f4e87ae187), W(0x9c98a23c71f3e4e3),
+     W(0xa73c8b89f47b504b), W(0xb9e33f54023233aa), W(0xf2bcfc17f92c9f68)},
+    0
+  },
+  {
+    {W(0x9120912bb3081e59), W(0x6c73c4a2f908b364), W(0x408af8c94de763d6),
+     W(0x3d9e83084000add2), W(0x65d197fddcb5a5a2), W(0xbfd29f0b2bd82bb0)},
+    {W(0xa1243e63bdfe09e7), W(0x91d90b54d556188c), W(0x977dd4a18bc872fc),
+     W(0xa8e6e7bef4ea7805), W(0x12c53bd80a467365), W(0x9d7abca493b7f0a4)},
+    0
+  },
+  {
+    {W(0x663ca92723ca903a), W(0x8a64a4dec7681937), W(0xe3ec0966a2baa42f),
+     W(0x688328d7a2906226), W(0xc2821e9c94790fd8), W(0x7a295b62157501cd)},
+    {W(0x032cd57d3675c2f3), W(0x91d66a57f42e6f95), W(0xd75056961e97dcd0),
+     W(0x7e8ba3ed7d8b6f52), W(0x8ddb72c420b0dcca), W(0xe09e53bb6aea2d55)},
+    0
+  },
+  {
+    {W(0xe932d1aaaffc47eb), W(0x75c9d4d8513f85a3), W(0x50886fcdf9419cb0),
+     W(0x756a7d7d49081e9e), W(0xe45fff1fe14aff77), W(0x022b4ac339846230)},
+    {W(0xefc3e8dbe89adc78), W(0x921bb1538c09ccec), W(0xe4dc6aa17826d461),
+     W(0xa53aa6cefac8f0f4), W(0x5d4e4d53954192c5), W(0xda721828c722780f)},
+    0
+  },
+  {
+    {W(0xd55a3eaf0a9a8ba4), W(0x13b1406b2a8cd215), W(0xcb44589a93943e1a),
+     W(0x91b5e3493a671a47), W(0x488654f8efbe0256), W(0x448bee4b392ba5e8)},
+    {W(0x228f478137e762ca), W(0xe21a2ca7e71b6c47), W(0x0e809fe94900fcef),
+     W(0xb05e1db2815f6c76), W(0x8cdf28815fa6fa0c), W(0x2ed55c1c586fec8f)},
+    0
+  },
+  {
+    {W(0x5a049c8f94af3a35), W(0x9ae89160d8b75bbc), W(0x8b026d867ff40c5e),
+     W(0x90e54aa4fbddfd06), W(0xc85349e7ee418640), W(0xbf71e454beb7801b)},
+    {W(0x63f5e068ad912e83), W(0x6252a4a4ada5341b), W(0x25114b87b44529ab),
+     W(0x9b80bea9eadb4f13), W(0x7f071c0cfe050052), W(0x4c9cd33418612061)},
+    0
+  },
+  {
+    {W(0x04df415ea6d4b6c2), W(0xb8e33e71d254d2d4), W(0x179df4f48b84c588),
+     W(0x8a2a0683d435793a), W(0x6147a5a911eecec0), W(0x0b8389793a0196cc)},
+    {W(0x855059ce81805693), W(0x37babf9f3b27872f), W(0xa2ac78b1769be5c3),
+     W(0x16260f0c0a8d267b), W(0x31f48c42388266c1), W(0x58fee495ead1f238)},
+    0
+  },
+  {
+    {W(0x047b0f0124b240a1), W(0x959915dd46cecf58), W(0xedf2e74b72980ca1),
+     W(0x6b7b7b4ef2cad32a), W(0xf9f01c9d0b9ded1c), W(0x009d3a5825e77e0a)},
+    {W(0x62314ab411a39c1c), W(0xb3b0c5b2ad557b74), W(0x6dbb75dd961619fc),
+     W(0xb8f2d198c934e1e0), W(0x4401507542eb7fd5), W(0x3a8552efea1be435)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xba03ba3b7b3b336d), W(0xe57ce50928c9c55d), W(0xf96b8cfe4f0f60b2),
+     W(0xb908d77e6fcccd96), W(0x7208ef7de79dd17a), W(0x739095333ec3d048)},
+    {W(0x9c5ad2da1163fe78), W(0x4e2a8685cd4a15c2), W(0xac999449470eb938),
+     W(0xfaaf27fbee7d772f), W(0xfbe402abd0b7ad09), W(0x704d4f0e57db00a9)},
+    0
+  },
+  {
+    {W(0x10c082a63fc14a85), W(0x59389ebc1c0b14c4), W(0x785d935b4cb291a7),
+     W(0xfc2ae15313e9ce08), W(0x3146fabf4df6f1c4), W(0xa2a4a457c87dd24c)},
+    {W(0x85fdd8771deb49bb), W(0x2b7843709b055934), W(0xc81d05013e7e0297),
+     W(0xb56ddd1fb92df904), W(0x4612df9f295ddccb), W(0xc24bd4cf0e27cf1d)},
+    0
+  },
+  {
+    {W(0x86d9b06018674f49), W(0x81b0648697bb1a7d), W(0x9b6e8e7c27d9d64c),
+     W(0x79bd66baba04e6ad), W(0x77e4d0b0828abbbe), W(0xae7548accc540d04)},
+    {W(0xf5d8a46f869cbebf), W(0x99fb1a6338a6cc83), W(0xb93bb852563fe6b4),
+     W(0x06bb3ae997cdd04f), W(0x07f011d48b7de47d), W(0x8d90e2e4de78f61c)},
+    0
+  },
+  {
+    {W(0x7830460fd1944d1b), W(0xc56f08e784350af2), W(0x73bee2aa307d9c78),
+     W(0x1b02af1b5aad8b6c), W(0x5e31882703848db5), W(0x4785958bf230f476)},
+    {W(0x4ea6535d4f80e25d), W(0x9958c9c7d23c7f72), W(0x4c197b332fd33cab),
+     W(0x24c7b0b1c566914f), W(0x956ce3c371952d3b), W(0x8735694bfabae5f2)},
+    0
+  },
+  {
+    {W(0x8a95e5c1fddc9fdd), W(0x679d4e0f5adab0c3), W(0x1859df6acda40bc0),
+     W(0xf9097aa58234471d), W(0xaddc0c9b783c0100), W(0x55388dc8feb7067c)},
+    {W(0xe3805fd180a2eac7), W(0xf800a75cec886879), W(0xa45999921943a0a0),
+     W(0xb47f06191dfe627e), W(0x313d4f09da06515f), W(0xde26052d1f54a73e)},
+    0
+  },
+  {
+    {W(0x0db87bc3d8bb43ec), W(0xbf71d27c13a7b669), W(0xea81e9c4a3fd2a60),
+     W(0x190c9c71c9f017e5), W(0x21864180bcc75768), W(0x137bd61543dbcde6)},
+    {W(0x5b090c715d468ff5), W(0x3a622b60126c6bc6), W(0xfef3d268a918bf24),
+     W(0xe10c52c8ae204f49), W(0xf4be898d86d7c356), W(0x8276da182fdb5a17)},
+    0
+  },
+  {
+    {W(0x0079c69d41af8c08), W(0x7dcfa4f4acbe515e), W(0xb8d1866601396859),
+     W(0x08590ca4946fbedd), W(0x7fecd9b9641aace4), W(0xaad5cc442936a1b6)},
+    {W(0x925b6235f92c5958), W(0x7b1442f182d6231e), W(0x971e663d8c6fb34a),
+     W(0x543146dc2fc1c10d), W(0x6e4053c70642b822), W(0x4a49f247492e524d)},
+    0
+  },
+  {
+    {W(0xca9872e1597bd10e), W(0x6725cc9a4aed951f), W(0x96b17cb84e05b280),
+     W(0x97987146fa234d45), W(0xba78949ebb35a7d8), W(0xb82e9b9f6fc59384)},
+    {W(0xa303e54a70f165c7), W(0xfd6bb0dcb9c2cad9), W(0xe57e2de8ee722045),
+     W(0xa05c106563e27035), W(0xaa38e86602d2fe6f), W(0x78e02fa8ee2f6aad)},
+    0
+  },
+  {
+    {W(0x844f6287af063a72), W(0x372097e759471dd0), W(0x7fd05de1259345b7),
+     W(0x64daab8ebac7c993), W(0xbf1bbaa31116ac27), W(0xc3b3e9b5296e5399)},
+    {W(0xb081b097e5510145), W(0x7c2bf53e1e344ccc), W(0xc344a44ad73aba33),
+     W(0x07736caf573b7da2), W(0xda88b0988462201c), W(0xfc9460a80b22d67a)},
+    0
+  },
+  {
+    {W(0x623704a346c19270), W(0x5e14b1cb884c553a), W(0x915e55a8d7aaebe3),
+     W(0x5ea67f0e8aeb1da6), W(0x0019c673243c4e31), W(0xadaae610b86c1873)},
+    {W(0x647ed720acd9f24b), W(0x59c2007fe3443b7b), W(0x3400ab718d59618c),
+     W(0xe8be4f38eba7884a), W(0xed1a596ee9ecb440), W(0x7ee3e905f35437fe)},
+    0
+  },
+  {
+    {W(0x0407858e4ea47aaf), W(0xd6aa4ae9a9177ca3), W(0x092a3db3f0d9ad84),
+     W(0x1214105d4755c7ee), W(0xe6f3af1bdb8c46e4), W(0xbe9f26eb3ebcb89e)},
+    {W(0x5b009200c8787072), W(0xf7ab609a59fc4da1), W(0x8050f69ebd2bf3ba),
+     W(0x5fa192bfb79cc80d), W(0x58d932dc0df8548e), W(0x8f7836ace6b932ea)},
+    0
+  },
+  {
+    {W(0xd6256e7c62c627c2), W(0x5571edfc3cbb10df), W(0xfedec45771cca8f4),
+     W(0x2e26ac5f8483eed6), W(0x8e8c0671173508c2), W(0xfd9f25d50f39bf76)},
+    {W(0x1cb080c3094cc1b1), W(0xd367ca8c113e6552), W(0x4ae2ca36bedb511c),
+     W(0x0de0c3e34707eeb6), W(0x204cc610239d3097), W(0xb235dbf0adb00383)},
+    0
+  },
+  {
+    {W(0x2efb2ec0e7e879dc), W(0x086a83a78aa3117f), W(0xb4e14699fc337856),
+     W(0x21da570bfb53ed2c), W(0xfd4f833492a72eae), W(0xdfb89f5301a1cd54)},
+    {W(0xd25a8c7801bb01aa), W(0x3a823a8157501e2c), W(0x59e28ff3cde7c4f7),
+     W(0x4934b82f8ba1279e), W(0xf23a1dd93d7cf9b7), W(0xec4f88a93a9646a1)},
+    0
+  },
+  {
+    {W(0x77f854d449b62d17), W(0x685e350f34a3fb86), W(0x824242aa479042db),
+     W(0x87c11c5386573406), W(0x3f8a1594d3b9743c), W(0x396929cd7f287f26)},
+    {W(0xa681fd8dc1ccdca5), W(0x9979a997760d52aa), W(0xaa48a0140822ae4b),
+     W(0x2212b43cf0ae660a), W(0x857d8ccb8bde3ac3), W(0x54e3f21ab078a069)},
+    0
+  },
+  {
+    {W(0x2c524b59d0ae5dd2), W(0x8cb9b52da6202e9e), W(0x439775d1d19685ff),
+     W(0x08d8b0c6882226ed), W(0xcc21228d10ba9643), W(0xb717e293aa76e1a4)},
+    {W(0xf8f3b8bcc596123d), W(0xdbc2d69b4f60fb94), W(0xe34a836d8d02ebe2),
+     W(0xb54abace05344c88), W(0x70530ccf65015d97), W(0xc8d2162d18489200)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc0426b775e3c647b), W(0xbfcbd9398cf05348), W(0x31d312e3172c0d3d),
+     W(0x5f49fde6ee754737), W(0x895530f06da7ee61), W(0xcf281b0ae8b3a5fb)},
+    {W(0xfd14973541b8a543), W(0x41a625a73080dd30), W(0xe2baae07653908cf),
+     W(0xc3d01436ba02a278), W(0xa0d0222e7b21b8f8), W(0xfdc270e9d7ec1297)},
+    0
+  },
+  {
+    {W(0x4f120aa7e2a07891), W(0x9158bab3a25d3225), W(0xc96bac5ecfe5f7a8),
+     W(0xd4e73d59bbf3cec6), W(0xed8d233560361cd5), W(0x9b1a252c562f444c)},
+    {W(0xbd37d3cfc70f23c2), W(0xf13b3b6ea52ea19e), W(0x7e35535a3d2f41ed),
+     W(0x0353b52ee8b1743e), W(0x31d89dfd7b5a2765), W(0x2b7ac6848d9ea8b8)},
+    0
+  },
+  {
+    {W(0x06a67bd29f101e64), W(0xcb6e0ac7e1733a4a), W(0xee0b5d5197bc62d2),
+     W(0x52b1703924c51874), W(0xfed1f42382a1a0d5), W(0x55d90569db6270ac)},
+    {W(0x36be4a9c5d73d533), W(0xbe9266d6976ed4d5), W(0xc17436d3b8f8074b),
+     W(0x3bb4d399718545c6), W(0x8e1ea3555c757d21), W(0xf7edbc978c474366)},
+    0
+  },
+  {
+    {W(0x73457010c46db855), W(0xccb68c43dd579fb8), W(0x705b0e8c9c25fe5b),
+     W(0x40f36ea182dd0485), W(0x3d55bc8527ac2805), W(0x15177c6fad921b92)},
+    {W(0x51586cd55ab18cab), W(0xf51b5296cbb4488c), W(0xbb4e605e84f0abca),
+     W(0x354ef8e3772dd0da), W(0x7f1a8f795e4e1d41), W(0x93461f09de5d8491)},
+    0
+  },
+  {
+    {W(0xec72c6506ea83242), W(0xf7de7be51b2d237f), W(0x3c5e22001819efb0),
+     W(0xdf5ab6d68cdde870), W(0x75a44e9d92a87aee), W(0xbddc46f4bcf77f19)},
+    {W(0x8191efbd669b674d), W(0x52884df9ed71768f), W(0xe62be58265cf242c),
+     W(0xae99a3b180b1d17b), W(0x48cbb44692de59a9), W(0xd3c226cf2dcb3ce2)},
+    0
+  },
+  {
+    {W(0xf38995589311182c), W(0x1bee4c4bb657a7b7), W(0x0b1c4fd32df8d1a7),
+     W(0xf16bcc2376d3fbbf), W(0xd5888916f4fd52bc), W(0x3de6cfb4d5cde1f0)},
+    {W(0x764ffffdd4a07dfd), W(0x5e674426e2642182), W(0x34f64762ccd57b85),
+     W(0x2233a4c329351062), W(0xdf076095d9c642f3), W(0xac917a2c59f0df34)},
+    0
+  },
+  {
+    {W(0x9580cdfb9fd94ec4), W(0xed273a6c28631ad9), W(0x5d3d5f77c327f3e7),
+     W(0x05d5339c35353c5f), W(0xc56fb5fe5c258eb1), W(0xeff8425eedce1f79)},
+    {W(0xab7aa141cf83cf9c), W(0xbd2a690a207d6d4f), W(0xe1241491458d9e52),
+     W(0xdd2448ccaa7f0f31), W(0xec58d3c7f0fda7ab), W(0x7b6e122dc91bba4d)},
+    0
+  },
+  {
+    {W(0x3bd258d8775f516f), W(0x4bedebd5c715927f), W(0x5b432512e3f966a0),
+     W(0x338bfca7709d0c2d), W(0xd142cc1049658259), W(0xfabc6138636b8023)},
+    {W(0xa9ef94014d4ef14d), W(0xd5917ac1c54c570c), W(0xfd2f63c55cb64487),
+     W(0xbae949b11cea475b), W(0xa45446031e67a25f), W(0xa547abc1dc6a7a6a)},
+    0
+  },
+  {
+    {W(0x2a2dedafb1b48156), W(0xa0a2c63abb93db87), W(0xc655907808acd99e),
+     W(0x03ea42affe4ac331), W(0x43d2c14aeb180ed6), W(0xc2f293ddb1156a1a)},
+    {W(0x1fafabf5a9d81249), W(0x39addead9a8eee87), W(0x21e206f2119e2e92),
+     W(0xbc5dcc2ed74dceb6), W(0x86647fa30a73a358), W(0xead8bea42f53f642)},
+    0
+  },
+  {
+    {W(0x158d814db12c4bb1), W(0xe52f75d22f0cf4fa), W(0xf106023e6141b59c),
+     W(0x5eb8b8ebbeb9d941), W(0x1dd3972990cf579c), W(0xb273252e69ee6efa)},
+    {W(0xe43a3c593e9947a0), W(0xd605124f6c19dd01), W(0x8090fdbd05c578b0),
+     W(0x8e6c535a622ff18c), W(0x3600b0c257d12071), W(0x6d026e5c78d001d7)},
+    0
+  },
+  {
+    {W(0x636225f591c09091), W(0xccf5070a71bdcfdf), W(0x0ef8d625b9668ee2),
+     W(0x57bdf6cdb5e04e4f), W(0xfc6ab0a67c75ea43), W(0xeb6b8afbf7fd6ef3)},
+    {W(0x5b2aeef02a3df404), W(0x31fd3b48b9823197), W(0x56226db683a7eb23),
+     W(0x3772c21e5bb1ed2f), W(0x3e833624cd1aba6a), W(0xbae58ffaac672dad)},
+    0
+  },
+  {
+    {W(0x00e0a003daff1807), W(0xcb9d155992c94fd0), W(0x3c2b5c3dcebbf905),
+     W(0x9c799ec7d338afa9), W(0x60b9908c4e2cfccc), W(0x4bfe1a57ae3c6f92)},
+    {W(0x480d310efb116150), W(0xa1ed6c31e3e7888e), W(0x841a11d9720b5196),
+     W(0xcc337d178adff37d), W(0x08c668265faa86c5), W(0x945c90d49dfcc7ad)},
+    0
+  },
+  {
+    {W(0xce92224d31ba1705), W(0x022c6ed2f0197f63), W(0x21f18d99a4dc1113),
+     W(0x5cd04de803616bf1), W(0x6f9006799ff12e08), W(0xf59a331548e61ddf)},
+    {W(0x9474d42cb51bd024), W(0x11a0a4139051e49d), W(0x79c92705dce70edb),
+     W(0x113ce27834198426), W(0x8978396fea8616d2), W(0x9a2a14d0ea894c36)},
+    0
+  },
+  {
+    {W(0x9f9ac9608e2941a6), W(0x43e7ff902fc4fe1e), W(0x5ec413596033e041),
+     W(0x5ce791c46f6ff0f3), W(0x8d134b899d907343), W(0x7bd15c7786304df2)},
+    {W(0x2cd2ebc777c4a913), W(0xcd86a39d45f07153), W(0xe7e12d2e88bc423b),
+     W(0x478e814b0b3163f4), W(0x78bd9c8abe8ec766), W(0x6a5763e87709ce48)},
+    0
+  },
+  {
+    {W(0x4f1e1254604f6e4a), W(0x4513b0880187d585), W(0x9022f25719e0f482),
+     W(0x51fb2a80e2239dbf), W(0x49940d9e998ed9d5), W(0x0583d2416c932c5d)},
+    {W(0x1188cec8f25b73f7), W(0xa28788cb3b3d06cd), W(0xdea194eca083db5a),
+     W(0xd93a4f7e22df4272), W(0x8d84e4bf6a009c49), W(0x893d8dd93e3e4a9e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd699ea2d8d095606), W(0x3cd080c51e0ddd3a), W(0x46604bad66a8b35b),
+     W(0x0c779b624233fccb), W(0x578458acbfd3cf0c), W(0x6820f66596bf57af)},
+    {W(0xa9724245bf1f302c), W(0xbbde24da277a6c3e), W(0x0980a5b8c6be8c14),
+     W(0x6230e3ec774d62c4), W(0xda1467d84fbde24b), W(0xd9d68d07cc862204)},
+    0
+  },
+  {
+    {W(0x67c516347378f90d), W(0xbc201a7966647082), W(0x77fcc8dc9ee450cf),
+     W(0x8dd2b318b41a3e2f), W(0xdf6a935e93bf0689), W(0x75edabf3a92e5464)},
+    {W(0x49afcd9f604d208a), W(0x372f0ea7d465ca48), W(0xcdbd8ad2c7ea7810),
+     W(0xfe61571e550822b2), W(0x744a4f9386606adc), W(0x6beb3c9cd9d4e110)},
+    0
+  },
+  {
+    {W(0xf108427779064777), W(0x9dbdd99d817fa6fb), W(0x3752dcf5bfb42839),
+     W(0xf6b2214db74017eb), W(0xfc1cdf724578fcf8), W(0xac15d7831226539a)},
+    {W(0xcc079668c4d1ea93), W(0xa680255004d3e8fb), W(0x20273a9a504cf7d5),
+     W(0x0c7b7e53c93ed593), W(0xaaf9c36866303f1b), W(0xb7858cd2cb0136a4)},
+    0
+  },
+  {
+    {W(0x1fef389ce700b9f2), W(0x63029466425bc8ab), W(0xbd770a1437f04a33),
+     W(0xc7438e29d0169369), W(0x6b265742e2377cc3), W(0xdf24bf96c369fa4f)},
+    {W(0xdfdbcf470ad94e08), W(0xd101b8617f75a7dc), W(0x5574a0b82a9c483c),
+     W(0x0563fe942de43228), W(0x58ca0e8aead1fabe), W(0xdc3d9a8466023966)},
+    0
+  },
+  {
+    {W(0x746325d15e39d9f0), W(0xac10ad136b8e10d1), W(0xd9f21c2866c39319),
+     W(0xc12880ea783a73e7), W(0x382e1ce28bd82d13), W(0xcd3ede36ac02310e)},
+    {W(0x9802d0623d83dbaf), W(0x044412c0189e2a72), W(0x38b4367efd4cf75a),
+     W(0x765cdee0e8f2f6ed), W(0xe0b4d72b35e72ff4), W(0x09a40144947d470a)},
+    0
+  },
+  {
+    {W(0x383bda07c3fd20e5), W(0x9619b1df5c29449b), W(0x6f3c717d369f39bf),
+     W(0x1bb593d11a5a3900), W(0xd0f07ecc2aec6c2b), W(0x9d72eb2a4240b202)},
+    {W(0x35342f6cc50e4a0c), W(0x701b46626b93bf61), W(0xfcd6eb09ccb6a888),
+     W(0xabb7a6f785aa42c5), W(0x952f8824aa4e5895), W(0x49860db85c406582)},
+    0
+  },
+  {
+    {W(0x59d6e053c5e5120d), W(0x17a6f9c03a1126e6), W(0x0459d07d7907cc88),
+     W(0x67d720ddc4ce5d80), W(0x3262028eed04f402), W(0xf8433a5dd78812a8)},
+    {W(0xf735fd6dd03a5d82), W(0xb97bc1edc48235d3), W(0x328c06e8e19a43f1),
+     W(0xb97ef65f19592b76), W(0x81325f3db8b836f7), W(0xd844fe29d6e6ca99)},
+    0
+  },
+  {
+    {W(0x3667a7203955812b), W(0x0d73483b284d1dac), W(0xe084535efc62f791),
+     W(0x5bc1652b389faf7f), W(0x40cf51683a71b7f6), W(0x8a4b19fad4f39703)},
+    {W(0x823e754a2a8eff13), W(0xf01b2021bffa5afc), W(0x5639ee027225b319),
+     W(0x7533bc86fc282f16), W(0x710009d2c69f61ae), W(0xe30c499dbf65e803)},
+    0
+  },
+  {
+    {W(0x491441edbce3b45f), W(0x453ce628c09ea871), W(0x6b14d7d652aa8d58),
+     W(0x0813ad0e28505d63), W(0x1abed905c8cf837e), W(0xe81ecb0464acab67)},
+    {W(0xbcdab22744fe9425), W(0xe3779cec418f46ce), W(0x1c7555718504e778),
+     W(0xa4e05a4ee3bb2929), W(0x9e75399ac9516459), W(0x55f358bd8d015fa3)},
+    0
+  },
+  {
+    {W(0x0da7ac1b734b4ec3), W(0xf47fc1d012a2afbe), W(0xbbbc99be87dce4a2),
+     W(0xf7264b4edd5c6378), W(0xe9409305f618ffdc), W(0xafadda9bd1846ac1)},
+    {W(0xe734f9d0a21850d4), W(0x199cb44f8722a316), W(0xcfe8704b38cae89f),
+     W(0x2db1e56b6b151b57), W(0x116ca5cf69ce7b2c), W(0xe9b8625f57de97c8)},
+    0
+  },
+  {
+    {W(0x24fd34becb7b50f1), W(0x952e88f5e82790c2), W(0xc8f377b078f3ba74),
+     W(0x7076486a80cf84ae), W(0x3b9274a1e6137bb5), W(0xf10868a8a6213993)},
+    {W(0x77c2afd012d5c5e3), W(0xda12426903a1281f), W(0x135044f65832f0a3),
+     W(0xeed5d994bc936dc7), W(0xe38d2f9b6982880d), W(0x52f5fd97ed350861)},
+    0
+  },
+  {
+    {W(0x18811bd5af247c49), W(0xbc180793e124dbda), W(0xed978d3a21234fc4),
+     W(0x516dd9a70616ae15), W(0x8f80677774e430b8), W(0x9094256906e8fc49)},
+    {W(0x4ca03fb5a4e61235), W(0xb91de709b617f361), W(0x0898d82d0ed08bc3),
+     W(0x2bd712368cb08146), W(0x45b92d45e213176d), W(0x05894791f2bf5b9c)},
+    0
+  },
+  {
+    {W(0xbe2c907139e28f1a), W(0x431c7706773af486), W(0xc0343550bf090093),
+     W(0x12f7053583084eec), W(0xf1883dce5bf74b39), W(0x473341670afd352e)},
+    {W(0x552b77a799927e23), W(0xf5ddf3cfb0f3321e), W(0xdfea93a181cfce45),
+     W(0xa816b8962388ea03), W(0x68b69a62d7ba7c74), W(0xbfbf0b850a6d7780)},
+    0
+  },
+  {
+    {W(0x0d79cb892695ea2b), W(0x2cb0f8dfc88e538a), W(0xc1b8dc3da80f36fe),
+     W(0xd756fa6684f00cc2), W(0xa6f1cdec9cb9efb2), W(0x5c3f15a8a6a21818)},
+    {W(0x9a7ee3516995d09f), W(0x88885463d70434bf), W(0x18cecc6d4f7d5d33),
+     W(0x3f0138866b353bd1), W(0x53bf798b0d9ad368), W(0xeffd465a28dbc3ee)},
+    0
+  },
+  {
+    {W(0xf3d776a94395f643), W(0x71fc6615622811f5), W(0xd866452a5f87dddb),
+     W(0x35d515fca4fa4e3d), W(0xba6dbcefa8641e4e), W(0x3a70e9d1cd1e70ab)},
+    {W(0xf8e30a07ce83d3a3), W(0x95bdeded1d716dd9), W(0x3a65a5eb6194cb97),
+     W(0xaf41281a15e9fecb), W(0x2e611cbe7900be8f), W(0x56de2bd1dfc7707f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xeb29e44cb5d98ac1), W(0xe47e57f80e227a4f), W(0xd09c04943d2bf688),
+     W(0x3ab7799a47428dd2), W(0xdc558d6be9aafac8), W(0xc042c4cd87f9f6e0)},
+    {W(0x93842bcd89fb4693), W(0x62dbc82f7068fbf7), W(0x164552687e6d47b5),
+     W(0xab304b7a4c37eeee), W(0xdbb3d4e13fc412ce), W(0x4f65dad0a726a2c8)},
+    0
+  },
+  {
+    {W(0x79d88e004516234a), W(0x98dd3cb931f9ceda), W(0xb528000fce7d606e),
+     W(0xc773557e2fa27fd3), W(0x55b53dd3e19436af), W(0x675084b3e10b64c7)},
+    {W(0xe583266556d56374), W(0xf8f7fd2a307e2e60), W(0x7b93bf537af3e3dc),
+     W(0x94fafa2cf47d298c), W(0x94c2ff9a21121369), W(0xa41de95f33468ff6)},
+    0
+  },
+  {
+    {W(0x91e8c992044637f0), W(0x01f7838827ee8e8f), W(0x7c5e3f6dd095f5b9),
+     W(0xed7522fcddf3cad2), W(0x80bb87056c57aacf), W(0x495480b00cc5ff51)},
+    {W(0x964def7f04da2565), W(0x8b0d0fe3afa72140), W(0xcc75192584de66a1),
+     W(0x9acaf7fe075f07c5), W(0x6505c2f81eeade93), W(0xa2f35aa00e3cf58f)},
+    0
+  },
+  {
+    {W(0xbe45d81a1b270599), W(0x50696e7d97d6c603), W(0x63c5a516b078ea89),
+     W(0x9f3efe41b4464764), W(0x84580e24101e5232), W(0x00850a1ac8ae8220)},
+    {W(0xbff4077ded55c404), W(0xd74de734f2e7bf50), W(0x4df4eef207e1c03d),
+     W(0x4ab3d0396e654d58), W(0xb20056cd086f1596), W(0xe4d08a278acd7cd5)},
+    0
+  },
+  {
+    {W(0x8caa623d408b62b7), W(0xa58aa0b0c0272b41), W(0x089af856ee285bfd),
+     W(0x77b461f6d0674ecd), W(0xbaa9d9b38d6f6612), W(0xa8f26e12590669f8)},
+    {W(0xb164340c5ebb5e28), W(0xfdc11f7401ea89a8), W(0x73c03b9176e4346e),
+     W(0x6a678eb17caad5fc), W(0x103ff0790a87803d), W(0x25d6fd2af7430a94)},
+    0
+  },
+  {
+    {W(0x517075af5faa0cb7), W(0x400a22c1efaf68f4), W(0x320ce9493b86f639),
+     W(0x511565717f296bf4), W(0x0919607a96108276), W(0x4fcc39a02f035900)},
+    {W(0x5d13de7cefb73f3f), W(0x19d725c5081c38e3), W(0xf1b28089c0f58697),
+     W(0x2adcd1a30ca7ca20), W(0x96c07f42c21e1be5), W(0x94d28cacbaa0aba0)},
+    0
+  },
+  {
+    {W(0x3027c1698d6f8572), W(0x89326850111e64d7), W(0xe6eb6cd31b8b0179),
+     W(0x0d2d27ea6dd5a4a7), W(0x41682c0007c82f11), W(0x5a01c54c81075022)},
+    {W(0xf3903f51fe7220d0), W(0x75daeaba1f8e66b2), W(0x1b625eed470bd3b2),
+     W(0xa46398a7e85a6293), W(0x8ff6ef8c805ad640), W(0xb3430f6795bfa3a5)},
+    0
+  },
+  {
+    {W(0x8cd6c9f7c90b13f5), W(0xec0c187d52a9d469), W(0x9c0db0f589b8ad2b),
+     W(0x692a8db70d9c999d), W(0xa407fd03c9f84ab4), W(0xa5742fd1cc9a906c)},
+    {W(0x4813a765c8e72867), W(0x9c65943de2e9a10f), W(0xca6bf2934fa0a23e),
+     W(0x1dfa3af7cb1f8d7a), W(0x28036f5498d10c53), W(0x7bfbcaf20e012c13)},
+    0
+  },
+  {
+    {W(0x6ae0704d5d2a7b5b), W(0x0b4b6d4be0dadd4d), W(0xd4fa001b89462e1b),
+     W(0x4043ec4b7bb99726), W(0xe09cc8450eb02723), W(0xf7656e6c769eadb9)},
+    {W(0x74977f9ba4a5c075), W(0x851e3d68beab0f58), W(0x6ba9f8ed1c92d3c7),
+     W(0xc898e46a2daac468), W(0x6e6a5cbbc197c168), W(0x6ccadc5c589d183d)},
+    0
+  },
+  {
+    {W(0x805fe47e6603e741), W(0x98bd4a88ae269e41), W(0xc8a71716aa2235a1),
+     W(0x81691d759530e13a), W(0x398490ca1d8f96e1), W(0xd0ed33dd96366ced)},
+    {W(0x9efe29a25dab23a1), W(0xe1de921a152dde8c), W(0xf7778f37924c639d),
+     W(0x15366d8da17f3534), W(0x8e9b0643402d4f9b), W(0xd6d13f61e0811cf7)},
+    0
+  },
+  {
+    {W(0xca907c195ffd807b), W(0xcec9e2adb420d7fa), W(0xdffd24b7ae2c0677),
+     W(0xb14082d9ddbf2d58), W(0x778c7a6a304baf4e), W(0x5de8de4d57a4f244)},
+    {W(0x2dd0003e1978ca3a), W(0x0266227feef38b23), W(0x48df5054cdf44895),
+     W(0x2bedd8b3885bd765), W(0x44cf9053ab7e7fd0), W(0xaf2038bb0953fab2)},
+    0
+  },
+  {
+    {W(0x2d9513a9893e8032), W(0x49257f7af4688db4), W(0x73d8b12c3af4d9ac),
+     W(0x903dc9fa48a13c4d), W(0x6190753e60709433), W(0xa093364e49387d24)},
+    {W(0x0436949e3b261e16), W(0x96db3b274a3055b6), W(0x514eacc7e85dfe23),
+     W(0x1538b25c5d8805c9), W(0xd4c6b75b664a20f6), W(0xd1984f214753292d)},
+    0
+  },
+  {
+    {W(0x84dee3a42fd773d8), W(0x1713dcf2fc94f921), W(0x192360f4e1f621c6),
+     W(0xce7a00ff54efc88f), W(0xc16804fd92f12ce5), W(0x20721ac6b180e592)},
+    {W(0x43b157c36c495a96), W(0x059f378c1330ea5e), W(0xc56a55e6894c3117),
+     W(0xd7e3e7fdfa8333ef), W(0xbc1376f8e9f85a65), W(0xb603b8bd63ba8f26)},
+    0
+  },
+  {
+    {W(0x71453679719d13ec), W(0xa1d0d3c67cbb1002), W(0x0286686e68e64631),
+     W(0xb44347e50b30f37e), W(0x386ecd43c1498dce), W(0x1af428551bdfb4a6)},
+    {W(0xad433b9d1a7d891b), W(0x4085edc9cc67a8fa), W(0x742d5ebefc6aa0a6),
+     W(0xffedb73c3d39a0a9), W(0x20a68d74fddca9ae), W(0xc1f454ba49167e98)},
+    0
+  },
+  {
+    {W(0x3565c6e479ba4ee0), W(0xe3af8040b12df888), W(0xad0abb6c1f5e3edb),
+     W(0xcf5dd5fd71247693), W(0x89dbd0febda11311), W(0x138e2209fc9c7a31)},
+    {W(0x3198976e0cea05d8), W(0xa2cc55410f922776), W(0x6486a4fdc54e303f),
+     W(0x1e0fc769eaac2992), W(0x56b660c5ce156883), W(0x72b3777a6631c703)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa53f1a104ec177f6), W(0x4a2ef9aa3faa5ca8), W(0x30efed8532976d13),
+     W(0xcf5ada165ee692d1), W(0x3ceda69d259e7cc1), W(0x2aae29e99baab472)},
+    {W(0x7ee5baef737cc8bc), W(0x1717af747fe68ded), W(0x9e5c8ddacfdaff63),
+     W(0x575c8db9cec07693), W(0x9afc8ae0fdfb509d), W(0x27836d3685651697)},
+    0
+  },
+  {
+    {W(0xa7342f9517eb9264), W(0x9264a6a00a8a6eef), W(0x50e48bf07471c384),
+     W(0x729e5ab130827f34), W(0x17199191ea779c23), W(0xd13ab8539fa9fd58)},
+    {W(0x7d5799373b1d773e), W(0x65f8e7c6d196c3df), W(0x253f7d51e8541725),
+     W(0x107a793dec720355), W(0x1c14d0566aa16268), W(0x9dc5fca38bbb231b)},
+    0
+  },
+  {
+    {W(0xf5689c5e12b09f53), W(0xc1da32e19e87ff7d), W(0x1af879d012eaa533),
+     W(0xdba775e6d9271e94), W(0x60f8507310e63c34), W(0x445f3e21a686a24b)},
+    {W(0xed5ca8fa15bc277e), W(0x9839198a364ab7ab), W(0xe2ee39426d90a7d4),
+     W(0xe5b3e4cbccd37e76), W(0x9013bd08f1412e0f), W(0x82f5c532ce999048)},
+    0
+  },
+  {
+    {W(0x61d0e01bf3fe3441), W(0x674e52332af47609), W(0xd4a4e224b362902d),
+     W(0x45923c129e0a5d16), W(0x4fc2bdd495e580e9), W(0x6d1d974ca8c3d954)},
+    {W(0xaeff1135d0bbeaaa), W(0x013ab5b31baafc9e), W(0x80907d3eab8f9f31),
+     W(0xaf2c12166d566c15), W(0x0082daba952e6fa7), W(0xa46710032df9e03a)},
+    0
+  },
+  {
+    {W(0x91b379c63223d561), W(0x8cb7b8cce203417c), W(0xd0f44208176b3b81),
+     W(0xd18c2118aaba5cd3), W(0x4aed5c9770794f9f), W(0xfc540dc4f4c33894)},
+    {W(0xb8e6798a0153a8a8), W(0x6537dcdf43c4b0c0), W(0x1b7eef39ab557397),
+     W(0x175e3934b7103105), W(0x943abf4a82ac89e4), W(0xeb1a61f957ffcdb8)},
+    0
+  },
+  {
+    {W(0x99c2b4cd66476227), W(0x576a4b0662850cd3), W(0x067bb66b5a352b7a),
+     W(0x3c7d6fc43ec757ed), W(0x2f69291cb9d36adc), W(0xc7c0f3257c9143a4)},
+    {W(0x768c3c400627fee2), W(0xc214d81da8fde577), W(0xd86e4b025299ea1a),
+     W(0xbe46b7e91a2d4005), W(0xaf865a169317fa60), W(0xfbc3268fcdce2fbe)},
+    0
+  },
+  {
+    {W(0x66fcba52d8fbe900), W(0x9f16434c861b3e33), W(0xa371b97241b4305f),
+     W(0xb2d858ce25b6af89), W(0xbab07d53275f9e8c), W(0x3b5951f8d525bef8)},
+    {W(0xebf79e3ca1755b0a), W(0x4e6256e7b467b1c2), W(0x7dbd8b66cba1a659),
+     W(0x88ea40138b1eb8b6), W(0x210ac1b38fa6436a), W(0xe93e22c23df40e33)},
+    0
+  },
+  {
+    {W(0x5f79f0df1fd64063), W(0xd2d39dd381e118ec), W(0xd631a68e11571c5b),
+     W(0x6d072b4e2474faf7), W(0x5e043a6d862a924a), W(0xcae58bd8b0fc8d7a)},
+    {W(0xf54bb7f3b1351f28), W(0x4588b6280413275e), W(0x81459f4c5909ec04),
+     W(0xd28cda25abd16460), W(0xbb676d018db1c69e), W(0xc0056e2dac5036f4)},
+    0
+  },
+  {
+    {W(0x1ce187bf323169ba), W(0x1dfaef8661ab5073), W(0x1893dc7b2ae468b5),
+     W(0x0748ec86123848d4), W(0x0d2877b46a96eb12), W(0xb6063e75e9322495)},
+    {W(0x1cb17189d7d1828f), W(0xde41f11944d1b318), W(0x7ce0f87610f0b74d),
+     W(0x2c7c91ee7a98f86b), W(0xb641418e750f3ea1), W(0xae2cd2e280094054)},
+    0
+  },
+  {
+    {W(0x9f6c6ed598d8e086), W(0xa9ad63ca2d3fad85), W(0x055b8323fe016926),
+     W(0x039fbe287b3a8d68), W(0x544a8bf5fb6b315a), W(0x04b122fb647fed85)},
+    {W(0x1e9807fa98085b1a), W(0xb78a36a771c12696), W(0x4ccc1a2cdc22f95b),
+     W(0x6ff4997d54d1e818), W(0xecb5bdc2f08c22dc), W(0x6e07e2c146a27762)},
+    0
+  },
+  {
+    {W(0x602077aceaaec565), W(0x9dacf68224568aee), W(0xa490fc1e9cfcce26),
+     W(0xb2ac94b3303218ba), W(0xc0208604ab33f9ae), W(0x801663b6e39a6668)},
+    {W(0x1defbb42961b0927), W(0x688b445e83e318b3), W(0x34fe2830c11648e8),
+     W(0xed56e99360066dfa), W(0xa5f30f9a07671ecc), W(0x02c40260a3222e8d)},
+    0
+  },
+  {
+    {W(0xfb2a11b4ea347db9), W(0x2360667e03350681), W(0x1aa6e720a02a1261),
+     W(0xac2bd2eba110bb21), W(0x8ab2f9063c9b4568), W(0x5f46263d5ace1f17)},
+    {W(0x97067801eae704c8), W(0x35d2637ea715d313), W(0x24cdc3d0c77573da),
+     W(0x6f97cd07e2562b2a), W(0x27bcd62d5afb29e4), W(0xc38ac1c55d29f5d3)},
+    0
+  },
+  {
+    {W(0xd9c38ba47c88f46a), W(0xdd07c4d79946ebe4), W(0x908731dcce0e5417),
+     W(0x43088d11e145839b), W(0x9d37419d07b61543), W(0x440cdbcd2c3c7c4c)},
+    {W(0xa6a6fed673216db4), W(0x15ce171a198cd32b), W(0x198c256974e6a085),
+     W(0x5fec853f3dc2a714), W(0x329250bdd5923068), W(0x1d82373c9f6195ca)},
+    0
+  },
+  {
+    {W(0xa8e17be53777b2ae), W(0x534e3a3bcc284224), W(0x7f34ce458192cfa1),
+     W(0x0009a72966d0e03a), W(0xc42053ba524ce1fc), W(0x834e98fe6d092e58)},
+    {W(0x400c65a1c8b0f751), W(0x268bfe6f107965eb), W(0x0f141c0332e0bc69),
+     W(0x33bc6e64597a2264), W(0x039a4ae9454a0d6b), W(0x2cb0bf550b07ddaa)},
+    0
+  },
+  {
+    {W(0x69056cbe63769bb3), W(0x710a67d385044d35), W(0x971ccbdeea855332),
+     W(0xd655163a0fd0d210), W(0x619c3f9adbb8a8b9), W(0xd156f73d49a014e2)},
+    {W(0xd04ea0a5a129a598), W(0xc9c04da6fa2f12ea), W(0xc0ed654ae98b3187),
+     W(0xa254eef6a82f9ec4), W(0xe537695fa386a72f), W(0x170f1ed4a74eb453)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xdbe04c3044ce3ad8), W(0x995fbb1b4ce8aad5), W(0xdbf8b54670911457),
+     W(0x9e683b5b3f7a1757), W(0x7b89a08a9c7bd62c), W(0x448865a40b3fc97e)},
+    {W(0x0ac9abfc3bb01e94), W(0xa07760421e756124), W(0x0aa6c335d9deed97),
+     W(0xe270580f72603e08), W(0x70857a946c783bb2), W(0xa0047774caa929ae)},
+    0
+  },
+  {
+    {W(0xf071c9878fa06859), W(0x0083e5311a52390b), W(0x845eb12a61483bc2),
+     W(0x17471d801caf6dd6), W(0x7b603616ddc21b92), W(0xd38fe0f6b992536d)},
+    {W(0x433f0652297c25a4), W(0x03d4d8fcb1c4bf41), W(0xdf617386a9adf49b),
+     W(0x4bfeb3992cb2944f), W(0xbf288427b3d9c076), W(0x17818c3e965b4576)},
+    0
+  },
+  {
+    {W(0xce23a19aa17e560c), W(0x6491b95f62550e2b), W(0xc72000121d15a005),
+     W(0x15fde735f4355a1f), W(0x3849761f607f7807), W(0xcbe322d018204691)},
+    {W(0x75756e4ea95e8e91), W(0x365959fe817a9b8e), W(0x631232763d4ce3dc),
+     W(0xa769d2fef1d66e00), W(0x8624ddbac28829e6), W(0x03274297d2df06ef)},
+    0
+  },
+  {
+    {W(0x9ec1159727a28f9d), W(0x96f2c44bb847cd83), W(0xacf794e131fca111),
+     W(0x438b917896076f45), W(0xad71035b51732588), W(0x2db32f32a5d910da)},
+    {W(0xefaad0e8fe1cc184), W(0x6f0360b52e00bbed), W(0x99402426474ce326),
+     W(0xd53b687a2aa270da), W(0x96c8bb78d78fa6eb), W(0xd07f3bba6e699411)},
+    0
+  },
+  {
+    {W(0x2dfc39e6efe1757b), W(0xab52fbf3b5d2cb93), W(0x1cf12123313aa477),
+     W(0x785b025b9c6acbd1), W(0xb4aeb5b8e4d54177), W(0xde3d28f8d943c1ea)},
+    {W(0x7892db855b0b1921), W(0xc09ff90358caff2d), W(0xbdee13c61cbd3231),
+     W(0x873e0a7700b6c34e), W(0xb279505ae23de32b), W(0xf056ffdcc5a03302)},
+    0
+  },
+  {
+    {W(0x430b669fe1f833e0), W(0x1797ac3a6d8127bd), W(0x01ad730c4c33493e),
+     W(0x8c882c1fca00ed39), W(0xab2e9c89d24a5516), W(0x21a49e0af5d0327d)},
+    {W(0x46488bd858a280d1), W(0xfc4a1e8a772ed759), W(0xf9f60e90aecfac7c),
+     W(0x4afd1f5fac6a9e8c), W(0x57a20bf8c98bcda8), W(0xa1107ea08b46b998)},
+    0
+  },
+  {
+    {W(0x1f2f6c1f0db0c9c0), W(0xca4e1964ac770b5f), W(0x20dce4a6569c090b),
+     W(0xe4f7401adb3986d0), W(0x1389799485f553ea), W(0x119ad50d09026bff)},
+    {W(0x88067aa7e265a0a9), W(0x209c62b47f749167), W(0x84165019459bf269),
+     W(0xec125bd58b6e76f6), W(0xd636f9321f0d2434), W(0xf6023a4c8e05e0b0)},
+    0
+  },
+  {
+    {W(0xfe1f11ad389283ba), W(0xc87e20b60cd91b22), W(0x99d0015a3c5babf8),
+     W(0x7e795b4d5929ea0a), W(0xc9cf68331dfb7b7e), W(0xc1c07346a64992e8)},
+    {W(0x0b7e0dd89889746d), W(0xa89d7b461c43ea4a), W(0x64023cf034f02b96),
+     W(0xf7dd410a5662f0c8), W(0xa3bb6088a1058cca), W(0xedb25dc34e7801ed)},
+    0
+  },
+  {
+    {W(0x5607e6737b55dd53), W(0x61c4974fd9352b4d), W(0xc2426754b2c56d51),
+     W(0x03d80dd519cf9695), W(0xfa779603c11fe650), W(0xe4daceb7dc8c189b)},
+    {W(0x7678150a2e911291), W(0x365343c4df37b405), W(0xe521c4bf11d07c86),
+     W(0x36ac82fc675d71cb), W(0x2c1ca40c8fc17812), W(0xad3b6dd69526d44a)},
+    0
+  },
+  {
+    {W(0x5e9de448b01240ad), W(0x4b87007150055499), W(0x2415dcf74b3151b8),
+     W(0x0c4a712109d97d45), W(0xa2605ade57cd7f4a), W(0xb458ec5b4b5f3371)},
+    {W(0xb1aec6c604bf0035), W(0xf771ec543cc8b475), W(0x81321a889bee0a44),
+     W(0x5cb666f40c56ee50), W(0xe73b9284d3cf50f9), W(0x4c608eb0a0fb885e)},
+    0
+  },
+  {
+    {W(0x7d388639963bf5d3), W(0xd4379e98286c68a6), W(0xb9bae5ea58f15881),
+     W(0xf42e0f17d262bb94), W(0x7e77cb5298e09ee6), W(0x6094a7f756cb82f4)},
+    {W(0x467fc7d992855cc6), W(0x5aa7d2fb670d9994), W(0x34d58596db03a43b),
+     W(0x71401d1c84d0b976), W(0x5ec6dfe5cdd3bea2), W(0x839f5094671c2dbd)},
+    0
+  },
+  {
+    {W(0x8ded829779e4b3da), W(0x78a75587ec7b6d20), W(0x3bad63e52028cc8b),
+     W(0xa8295b0957e5e56f), W(0xc03f834c0cb6fb38), W(0xe28f0b94211782b3)},
+    {W(0x2d84929d4f9c5a98), W(0xf510e6cb2add7a81), W(0x593daed52d1e4f56),
+     W(0x9a138acccb131106), W(0x12c209a93a0600d2), W(0x10088d4a541d7081)},
+    0
+  },
+  {
+    {W(0xf59702a4e65f1f78), W(0xcc14e8f433368e03), W(0xb59c2ac13b8a5c8e),
+     W(0x71411700ba4382aa), W(0xabd1b0f1b0365d40), W(0x013292d9438754a8)},
+    {W(0xff2be8de3a8ee811), W(0x051705a3383d90fd), W(0x58061872edcd91bf),
+     W(0x8dbec776bf77a6b7), W(0x249a24373656197e), W(0xc615d3ddce2d3eea)},
+    0
+  },
+  {
+    {W(0xecb0fdcfe0a3382d), W(0x47064e61ffb898b9), W(0x6b973978bae4923a),
+     W(0x4f5b43a5cfdb175d), W(0x9ded886becb6d136), W(0x5596c3c6c3795491)},
+    {W(0x1db21f852c39223c), W(0xd49761b35c93fa02), W(0x40e78e5dafa331d6),
+     W(0x9930a22b86a5dd90), W(0x8c0dea6dd2ffd42d), W(0xc6e79398ec3aa83f)},
+    0
+  },
+  {
+    {W(0x8eb72ca7b7d09933), W(0xae8336f1a8954ed0), W(0xd980915f23872560),
+     W(0xae60e7549bc6585b), W(0xdfab01dcaf50d7b8), W(0xbc092d0c196deb3f)},
+    {W(0x6e026171153d5bed), W(0xb6d9195f416dbe1e), W(0x10cf4168abea18bc),
+     W(0xdc71b0042e01d600), W(0x32a9f6be6581f5f0), W(0xafd9f24de320fb1d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x140a0f9fdd93d50a), W(0x4799ffde83b7abac), W(0x78ff7c2304a1f742),
+     W(0xc0568f51195ba34e), W(0xe97183603b7f78b4), W(0x9cfd1ff1f9efaa53)},
+    {W(0xe924d2c5bb06022e), W(0x9987fa86faa2af6d), W(0x4b12e73f6ee37e0f),
+     W(0x1836fdfa5e5a1dde), W(0x7f1b92259dcd6416), W(0xcb2c1b4d677544d8)},
+    0
+  },
+  {
+    {W(0x279fd119da1c29ab), W(0xbd0688022b30d40c), W(0xd8f57da4da44105d),
+     W(0xb1814b7a28223fe1), W(0xcf2fd241e06f2d2e), W(0x99003a0201dfde06)},
+    {W(0x876a31affded7e4b), W(0x1efaf8272f725094), W(0x5117d608493a6a0a),
+     W(0xdcec8088a88c03e7), W(0xeae1d352ea916897), W(0x8cdc28106e8b2c57)},
+    0
+  },
+  {
+    {W(0x0254486d9c213d95), W(0x68a9db56cb2f6e94), W(0xfb5858ba000f5491),
+     W(0x1315bdd934009fb6), W(0xb18a8e0ac42bde30), W(0xfdcf93d1f1070358)},
+    {W(0xbeb1db753022937e), W(0x9b9eca7acac20db4), W(0x152214d4e4122b20),
+     W(0xd3e673f2aabccc7b), W(0x94c50f64aed07571), W(0xd767059ae66b4f17)},
+    0
+  },
+  {
+    {W(0x09f8bb0654e93c1e), W(0xb0045884ad81e27c), W(0x26ebc7b6076e13eb),
+     W(0xbda0b5535d5ac07f), W(0xbcb8132248ab69e6), W(0xd3847d2e1c0f21fa)},
+    {W(0x7a466528c834d740), W(0x6c67a79ae0823ff2), W(0x85dd11864c1d7cb8),
+     W(0x096f849f2d081301), W(0xb4f503dd8a5ea0f0), W(0x71ee0889d1bf69b2)},
+    0
+  },
+  {
+    {W(0x40336b12dcd6d14b), W(0xf6bcff5de3b4919c), W(0xc337048d9c841f0c),
+     W(0x4ce6d0251d617f50), W(0x00fef2198117d379), W(0x18b7c4e9f95be243)},
+    {W(0x98de119e38df08ff), W(0xdfd803bd8d772d20), W(0x94125b720f9678bd),
+     W(0xfc5b57cd334ace30), W(0x09486527b7e86e04), W(0xfe9f8bcc6e552039)},
+    0
+  },
+  {
+    {W(0x4ab7a22c02a2d1e6), W(0x967e19a31371d5a4), W(0x20f59f95078de336),
+     W(0xfd28fa36f7869245), W(0x1de42581cbf1d96f), W(0x2e0127d7366e1f0f)},
+    {W(0xbc65fa9d2258c741), W(0x1f2f3356dd6d65f8), W(0x06384f3a4a0822a9),
+     W(0x1c81332bfd05a0aa), W(0xbfb12361d95ee3ce), W(0x180aaf0642016d00)},
+    0
+  },
+  {
+    {W(0x3b75c45bd6f5a10e), W(0xfd4680f4c1c35f38), W(0x5450227df8e0a113),
+     W(0x5e69f1ae73ddba24), W(0x2007b80e57f24645), W(0xc63695dc3d159741)},
+    {W(0xcbe54d294530f623), W(0x986ad5732869586b), W(0xe19f70594cc39f73),
+     W(0x80f00ab32b1b8da9), W(0xb765aaf973f68d26), W(0xbc79a394e993f829)},
+    0
+  },
+  {
+    {W(0x0a159f6295b3287d), W(0xb18f875948cecad0), W(0x6d1ab8ee1661a23f),
+     W(0xcae7f40ec95c41b3), W(0xbc3d20407c51eb56), W(0xa7527283e8754250)},
+    {W(0x815610561f9e668a), W(0xb8aa7296900f5912), W(0xabdbc1bf6af2a00c),
+     W(0xe9a942542d0a56c0), W(0x4774a7b77bc8959e), W(0x0a837ff019cef2f3)},
+    0
+  },
+  {
+    {W(0x9c441043f310d2a0), W(0x2865ee58dc5eb106), W(0x71a959229cb8065c),
+     W(0x8eb3a733a052af0f), W(0x56009f42b09d716e), W(0xa7f923c5abcbe6ad)},
+    {W(0x263b7669fa375c01), W(0x641c47e521ef27a2), W(0xa89b474eb08ffd25),
+     W(0x5be8ec3ff0a239f3), W(0x0e79957a242a6c5a), W(0x1dfb26d00c6c75f5)},
+    0
+  },
+  {
+    {W(0x36f3a3d8a084fae6), W(0x759835899a9b0d95), W(0x70722186cc80fcb6),
+     W(0xf28ed0c796d84c04), W(0x95a32263ffb63f90), W(0xdd7d60a098766034)},
+    {W(0xe193a31f1d5c387c), W(0x6c5eca7eb8310f8b), W(0xfe61d523c083ff47),
+     W(0x90c832dbcb2944e9), W(0xa9f3f293593334b7), W(0xe6cde2e12d7d1c33)},
+    0
+  },
+  {
+    {W(0x2fd97b9b9dfbf22a), W(0xdec16cc85643532d), W(0xdf0e6e3960fee7c3),
+     W(0xd09ad7b6545860c8), W(0xcc16e98473fc3b7c), W(0x6ce734c10d4e1555)},
+    {W(0xc6efe68b4b5f6032), W(0x3a64f34c14f54073), W(0x25da689cac44dc95),
+     W(0x990c477e5358ad8a), W(0x00e958a5f36da7de), W(0x902b7360c9b6f161)},
+    0
+  },
+  {
+    {W(0xbd079cf1f144b6cc), W(0x7f86e29bb4f4a764), W(0x5b08b290f21f9cbf),
+     W(0xada0c85b75e3aeb9), W(0xd0789f8b6666c2df), W(0xcf5d8a8cd71ec2ec)},
+    {W(0x6f7780c3e7e4364b), W(0xdd9a652985d2eb75), W(0x8222f66bd952a38e),
+     W(0x9dd5f7eb27260a29), W(0xce49b34457947178), W(0xaa215f82cdda7e39)},
+    0
+  },
+  {
+    {W(0x454ab42c9347b90a), W(0xcaebe64aa698b02b), W(0x119cdc69fb86fa40),
+     W(0x2e5cb7adc3109281), W(0x67bb1ec5cd0c3d00), W(0x5d430bc783f25bbf)},
+    {W(0x69fd84a85cde0abb), W(0x69da263e9816b688), W(0xe52d93df0e53cbb8),
+     W(0x42cf6f25add2d5a7), W(0x227ba59dc87ca88f), W(0x7a1ca876da738554)},
+    0
+  },
+  {
+    {W(0xaa44b2863004db31), W(0x86f43d7ad43e4430), W(0xdc4874cdb0b0240d),
+     W(0x79986a23adc45a06), W(0xbb275b443cee4631), W(0x21daee8a63a217aa)},
+    {W(0x1e7c5397d7b25c02), W(0xe677d3cbc5e668fa), W(0xc7c84e28ed51b4bf),
+     W(0x7ca19e99923e5408), W(0xc6f8a595c3f832e7), W(0x2d0a789c5fb049a3)},
+    0
+  },
+  {
+    {W(0x3fa5c1051cac82c4), W(0x23c760878a78c9be), W(0xe98cdad61c5cfa42),
+     W(0x09c302520a6c0421), W(0x149bac7c42fc61b9), W(0x3a1c22ac3004a3e2)},
+    {W(0xde6b0d6e202c7fed), W(0xb2457377e7e63052), W(0x31725fd43706b3ef),
+     W(0xe16a347d2b1afdbf), W(0xbe4850c48c29cf66), W(0x8f51cc4d2939f23c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x114a25c844922386), W(0xdd084d446d4e8b57), W(0xc49b68411e7bd7de),
+     W(0x5b0359fad6da54db), W(0xa6e6e5f93f0da321), W(0xb65ec55cd640a87e)},
+    {W(0xc1a4f6ceae64020e), W(0x91e29cd2088e1337), W(0xf44ceb8e3c0a631c),
+     W(0x0205b11db756445f), W(0x04844e845bc8880e), W(0xb630ddc0b85e00d3)},
+    0
+  },
+  {
+    {W(0xe76894c3ae7ce296), W(0x87737ee2a6cafc34), W(0x566dfcfbe55cd1e6),
+     W(0x5421a9f23a7ad5b9), W(0xa005838a4687a4ef), W(0x3837219a23a2c423)},
+    {W(0x4b7800128a82cd1b), W(0x401c07bec728b588), W(0x2b5f69e937ced8f3),
+     W(0x306b621d8c1e1eaa), W(0x8acbbe71d389cc4d), W(0x922fa665f4ab7774)},
+    0
+  },
+  {
+    {W(0xe557e7c7297bccec), W(0x9c82875e19db959f), W(0xb9b0efa4b42b3ab4),
+     W(0x9d71dc4d8e53b32d), W(0xe3a93e4e11b1bfbd), W(0x217d418f9901bd3f)},
+    {W(0x5f3a53053ba3b69c), W(0x3c5aecc39bdb5d97), W(0xf4157a7bef469e91),
+     W(0xf03282f278f160dc), W(0x97e4b7f4c89189a9), W(0x5b79f71ca967ef21)},
+    0
+  },
+  {
+    {W(0x2df6f242d35c2d80), W(0xf65a99a93493ce97), W(0x9e80232b372bcc87),
+     W(0x26ba13b86e428cc5), W(0x2526ef1f13a1b763), W(0xcef3edcddc97c5f3)},
+    {W(0x4954867fbde16b73), W(0x9817813d368ff6cb), W(0x7e39fa69be143027),
+     W(0x12329463cf54f28b), W(0xcf0991dc7597c2da), W(0x0cda396952e07099)},
+    0
+  },
+  {
+    {W(0xbdfea748e32f3add), W(0xaacfe4f6b611caa7), W(0xd5a65675aaba398f),
+     W(0x22506486a12be348), W(0x766dd428e818ac5d), W(0x6e3a80b8fff9b6f9)},
+    {W(0x4b3b10f3c6171d2a), W(0xdfbfe7641cbaa58c), W(0x2a6111ed5c9e36be),
+     W(0xa99a302364cdfcdd), W(0xdbfbbe7a59462f54), W(0x1b07248bcc266b5f)},
+    0
+  },
+  {
+    {W(0xdc9daeefee993749), W(0xd40c8a547ff3d775), W(0x206d2271ca53d53d),
+     W(0xb05463354d1aa50b), W(0x52bca91088001e99), W(0x25c117c217fb7aa4)},
+    {W(0xfff3af9542685945), W(0x083fd4de8f4ce0fb), W(0xaac004be24753989),
+     W(0x4a5de2b6e90950c6), W(0xb46af0ab738efe5b), W(0xcf80a17fdb4459f9)},
+    0
+  },
+  {
+    {W(0x5bdb6d4041b673c5), W(0x30df661e4e6bdfa2), W(0xab5008a96ddd9e23),
+     W(0xac1e9748467e7577), W(0xe74e35b6017555ed), W(0xb2aa222f9d04fd57)},
+    {W(0x8585c6fd24cc867f), W(0x48466aeeeb267e96), W(0x2739d1e80b684dd1),
+     W(0xe1ba7889edbaddcc), W(0x464f42059dc57660), W(0xcb147efaa7cf289a)},
+    0
+  },
+  {
+    {W(0x412f64a3f303955d), W(0xe92bdca9bd692593), W(0xfbe6cdc2c2e964e0),
+     W(0xe9a3b1fd0011cb01), W(0x6c30762dcf228f23), W(0x1270b84abe9199a1)},
+    {W(0x732711dfe3c9cbb1), W(0xa3aabe37d91d9513), W(0x8ee08ba0c6eceba7),
+     W(0xb1711531f3c3d31d), W(0x65060b633c716948), W(0x046b4ea12ff2cadd)},
+    0
+  },
+  {
+    {W(0xec48c6d96f1eb1c9), W(0x07d929ef6af3d0d7), W(0x8454e9122e54bf71),
+     W(0x535d825100d6e6bb), W(0x4ecf7f6c2e7d09de), W(0x8a38c308a0c756da)},
+    {W(0xe1690d4ec57fb884), W(0x3f8474643baa2004), W(0x3d1cc2031da6afe7),
+     W(0xb3327aa5090f9c2d), W(0x41c5fb363e6912c7), W(0x0ffadf653d1a6a1e)},
+    0
+  },
+  {
+    {W(0xdeb7a462961719fe), W(0x5e22796d76ba6ed7), W(0x5907daf225d22208),
+     W(0xd98260a72c21c04c), W(0x56b24923e090f349), W(0xb5960ad9a31a8f95)},
+    {W(0xb6ac57cef8b1da62), W(0xe47d09959f14f70f), W(0x0ba6eb0104dba20b),
+     W(0x41ca71c846b60e27), W(0x2bbfdb306bf5eeef), W(0x58e16788f075b238)},
+    0
+  },
+  {
+    {W(0x2ae9d0b948d97d04), W(0xd4c58b763abccd5e), W(0xfdd4d168d6d246ab),
+     W(0x723d5da184fa1724), W(0x66b25f8c176c4b95), W(0x74b908ba4723aa3b)},
+    {W(0x7eafe0e14e542cd5), W(0x34a91efe12f9b2fc), W(0x3b7e086e485ede8f),
+     W(0xd4cf53bb96f3a615), W(0xcd4f9db2c6c3f287), W(0x5fb14986f4d72830)},
+    0
+  },
+  {
+    {W(0x25d1124fbab220c6), W(0xcd1423c861524e3e), W(0x75e4f45f0434fb51),
+     W(0xb5180a8f5180ab2b), W(0x144e214e5b22e388), W(0x6b16dad192263054)},
+    {W(0x3ea7590740863566), W(0x372d5abddada3b46), W(0xb3ff5a3a893d210f),
+     W(0x39f8d1ce5e29f3dc), W(0x559186ce68200e82), W(0xf48764541202cb66)},
+    0
+  },
+  {
+    {W(0x1838bd798137d317), W(0x34a33de5c6be6f98), W(0x4ad4d53bcc1addc2),
+     W(0xb1e56978b2ca17b3), W(0xa7d16fa55f881dd9), W(0x23c9e86a33a46efd)},
+    {W(0x2694fe9a7bc57b11), W(0x4b045609bcb847f7), W(0xd4222b254fc37d6a),
+     W(0x28d2edd89f85ac53), W(0x831bc01164bd25be), W(0x3f47b0a6a3330b67)},
+    0
+  },
+  {
+    {W(0x699c2db9eaf4f2a1), W(0x8cd3322761c0c17c), W(0x971b50d464f16a56),
+     W(0xcd00d42b102bbe10), W(0x928d0ae2b05f3cac), W(0x245dbe3814bcf472)},
+    {W(0x43d29526947c0184), W(0x240899684612a4ea), W(0xbc763fcd6c2b4541),
+     W(0xb4e7ae0ff82448fa), W(0x94f1fa15b02b6459), W(0xbcafa1ec67d39bbd)},
+    0
+  },
+  {
+    {W(0xe503f9fd82cf994a), W(0x5e8ef7a95fbb7256), W(0x0c03048501e4ce91),
+     W(0xff720287c1ef6099), W(0x00f9885cd075fb6c), W(0x4ce445c0b749b199)},
+    {W(0x99418f63a78ea5dc), W(0x010d4e8aee5b0e88), W(0x312f45708f87d309),
+     W(0x77782641b483acdb), W(0x4971473507c8e358), W(0x1bbb1be2d7652a45)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6f178dbf8b540904), W(0x0264bccd8720472a), W(0xa6e8b4b459b46611),
+     W(0xafce8267c72b4a58), W(0x21142175a45985ad), W(0xd23401dfe649d733)},
+    {W(0x6bf42fe085dc7720), W(0xc5c8ab9440e3f2f5), W(0xb0c8a58acd029197),
+     W(0xa73ff329215492e1), W(0x895c545eb1b5a5f0), W(0x6dbc24456fcaf49b)},
+    0
+  },
+  {
+    {W(0x8baef5df0a02b0fb), W(0x58a2b06bc2b92b02), W(0x268558d754c8267a),
+     W(0xf924f795ccf70393), W(0xe3763f30f68ee021), W(0xc1e856f05c01ba4b)},
+    {W(0xcc01a3e9722b6bff), W(0xd2be4623ed5b3b02), W(0x1ab3512e6c45e33f),
+     W(0xa978fe484ef433f6), W(0x23e2ea018e21f5af), W(0x49647d8811524a40)},
+    0
+  },
+  {
+    {W(0x92a7fbcdac3ce531), W(0xeb85f7f059498d99), W(0x8e45db2d02a8feb5),
+     W(0x176c0cb2728cecbe), W(0x33fcfbb0d1837662), W(0x426e192dd6f2882c)},
+    {W(0x75a0f3450a2c9899), W(0xd815dc6066148f9d), W(0xf4ea90cefa0453af),
+     W(0x5108858ff54c96fb), W(0x86b46b5731f77afc), W(0x59df021f6bf7e2fc)},
+    0
+  },
+  {
+    {W(0xe1d42d94d087b788), W(0xfbfb221aba0e176a), W(0x5f6698e783686966),
+     W(0xbb5e159474a30dbf), W(0xef86bb5bcfd20230), W(0xf055a1c5403b8f8b)},
+    {W(0xf249aac8d9d85ea7), W(0x7318f7bc3d200198), W(0x3b80960cefca9a90),
+     W(0xf28e33888f449c4b), W(0x0cdfc61bf0cfe09e), W(0x3b169c638b22cd26)},
+    0
+  },
+  {
+    {W(0x7013d596831f464a), W(0xe57185fdd3cf6ca2), W(0xbba7898e35915f51),
+     W(0x9fbe5f139fd967d4), W(0x0aba8344d173558f), W(0x4c0dd30dffeb6bea)},
+    {W(0x928f68cc5110e40f), W(0x1589a327a58b6d60), W(0x09b5c4e06abb0ac9),
+     W(0x01ef3f8a68957627), W(0x55dbe9f79f4045a4), W(0x91976aeeef178ac3)},
+    0
+  },
+  {
+    {W(0x7f89c2c40c9f23ea), W(0x8fb025d4d6ec2b2a), W(0xbe70e48b12d9f811),
+     W(0x703ac1bdc7a43dd0), W(0xa4309a2c2118ca3a), W(0x5a95d7b301943012)},
+    {W(0xd9597d87811f6c73), W(0xf82e801596079992), W(0xfcf8760df1561aa9),
+     W(0xe1e0306e2d91ee39), W(0x99979031e0bbcb6d), W(0x49259e54cfcc8746)},
+    0
+  },
+  {
+    {W(0x4073f246d9915433), W(0xc0149d5672e06203), W(0x0abb06c18fcec6a1),
+     W(0x3a7d1295d75a73f1), W(0x65fd8700f18c9488), W(0xc3cc0b27732f7741)},
+    {W(0xd15d8c8025a261ca), W(0x518233510dc1fee5), W(0x981607c7120e1266),
+     W(0x0e486b11f42cc9fd), W(0xe606c16c01a888cf), W(0x079dd0b31ea23249)},
+    0
+  },
+  {
+    {W(0x923e948c203bb368), W(0x58e37a2b231a80e0), W(0x345a011a6df27deb),
+     W(0xba6784c1d57f4ca2), W(0xf01b3703114196e9), W(0x981a63eb1aab426d)},
+    {W(0x2ffdc97851770c1c), W(0xddd19da6efa722fc), W(0x5ca1c01216f09c1e),
+     W(0x612021de5b9cc0b6), W(0x910e10e95e150569), W(0xacace9dce2ab93ea)},
+    0
+  },
+  {
+    {W(0x583a3272230be37e), W(0x4d3298951c55f593), W(0x3b3a2d8a350f0334),
+     W(0xec830170b25498ab), W(0xd65847d9b3a01571), W(0x4605e739663f86fc)},
+    {W(0x971b8e115c4bf502), W(0x651d179571a892b0), W(0x57930832d2d1a4f9),
+     W(0xf97010745b09a4c4), W(0x76b023e55ec2d1a6), W(0x8648b8bcf49e1329)},
+    0
+  },
+  {
+    {W(0x473bdac887cb6ae0), W(0xbd3001b3f155c32b), W(0x109643c20026e8a5),
+     W(0xc4f5f6cc188a568e), W(0x630aecf64d2758e0), W(0x4549949955b91872)},
+    {W(0xb10f19d4b6a09df6), W(0xc537a4bb37f26d01), W(0xd29f505c4d19a293),
+     W(0xf388a5d2cbb09b17), W(0x462efffc6811a49b), W(0x8a1cbc40b2f3aef2)},
+    0
+  },
+  {
+    {W(0xdf224cea1eed2b0b), W(0x10205f438814572b), W(0x8b99d85c02eb9b6c),
+     W(0x7a8a3d146c63a672), W(0xc8822c6c96f45695), W(0x0530f619c7f532f5)},
+    {W(0xb981e182310f8355), W(0x49318290f201444c), W(0xeaa4c406f9b76d19),
+     W(0x960fa2c7534a91c1), W(0xf98966d1522b7d9d), W(0x66912542c757dbd6)},
+    0
+  },
+  {
+    {W(0x0cdd83725070e0a9), W(0x7c5ad562ec550783), W(0x9652b8474f3b8d2b),
+     W(0xfdd60d93e6e98d73), W(0xd51cae2ca3479d0b), W(0x11b93b6dee05c006)},
+    {W(0x9d72b82d8a3b40d5), W(0xc6e996fea7d24855), W(0x420672f7398603de),
+     W(0xd551b34a9a1af2ce), W(0xdeb8c1d913bdce0c), W(0x56ca926debbeba7a)},
+    0
+  },
+  {
+    {W(0xbb91877acfc74bb0), W(0xbe742182a060a71e), W(0x116e5a626ed7786c),
+     W(0x0a496b1bea669e56), W(0x3a012174b8f02e6e), W(0x6add760c106174f4)},
+    {W(0xaf2606e05e0292cb), W(0x7800a495c7b7bad0), W(0xca02c9320a1c5954),
+     W(0x904f23c6b245ad57), W(0x28d6cc2172934de5), W(0xbb7ed903283752cd)},
+    0
+  },
+  {
+    {W(0x80d7ef8598100f17), W(0xb9795c7112db3f3a), W(0x44473659296a7c44),
+     W(0xa46810f21e5bf539), W(0x5621241814ee1e3b), W(0xea8284e209931822)},
+    {W(0x424c613e42ac1e42), W(0xe84a80afbccf9466), W(0x21a8cdcc45132204),
+     W(0x9505a4148d58da62), W(0x773e09837b3f47aa), W(0x0ad0cc91e109bc6d)},
+    0
+  },
+  {
+    {W(0xafa9338759769f77), W(0xe6c710cb49e502b3), W(0xe6fd7b8d1514da98),
+     W(0xb5924c63aedf93ca), W(0x4cc36795c112b37b), W(0x0ee30ce3231def42)},
+    {W(0xe1f436e7daf8a37e), W(0xed54b7f56efa184a), W(0x09ad65752c0dfe63),
+     W(0x5ed9da43ca530b38), W(0xea2fa192ae156274), W(0xbf096c54a4429eda)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xac58c9e09db9ca19), W(0xd308ea5d390054d0), W(0x32ef4afc2cc42529),
+     W(0x08bd48b397c2bdf9), W(0xac8a7803a849e19a), W(0xcd51c0da75c31496)},
+    {W(0x733dc7def0e2d49f), W(0x7c9caad1b44b8cc5), W(0x6d9c5b0847be21a8),
+     W(0xfab0fdc55ebf426f), W(0xd60748caf94e9e5b), W(0x3072e59269366089)},
+    0
+  },
+  {
+    {W(0xb06c17a3f0ef77c5), W(0xc144e7846df6bf59), W(0x2440ae990038aeb2),
+     W(0x83bf711b58b402ca), W(0xb8763e00b577732a), W(0x509e91eff651a932)},
+    {W(0xbe02ab9d00ac109e), W(0xfbcb426c8dfd78f1), W(0x7ed272f64283f80f),
+     W(0x098cf0572365da5e), W(0xd90e6f1805dc6beb), W(0x09ef177fcf7b9d72)},
+    0
+  },
+  {
+    {W(0x89b2edbae3e1aee9), W(0x33533137e55e4aca), W(0x1dded9ce8943fce4),
+     W(0xaaf07ff45a2ff996), W(0x69e60f92c96e87fe), W(0xc2e5c1d5b9ee808c)},
+    {W(0x79d6d8c6be466616), W(0x897f6c2fdffe4e28), W(0xc8a65267350b7fc9),
+     W(0xe9fcb46d8a2abab0), W(0x57c3bfc62c4faf7c), W(0x41a8cc2aa8207c8a)},
+    0
+  },
+  {
+    {W(0x6f101762eeb791c4), W(0x0d942184df261eff), W(0x2c58e2aaac1dc827),
+     W(0x51410e89f835a1b6), W(0x981333a7629915a4), W(0x371891b60c14148d)},
+    {W(0x4d20b3d3c0904446), W(0xdda7ecc8949776d8), W(0xa664b68c2a2645f7),
+     W(0x7a6bc857add082ea), W(0xe7467dc63e5ff206), W(0x40a6c34004e2dfcc)},
+    0
+  },
+  {
+    {W(0x57fe04db1eac292f), W(0xec2d8ecd3c20366c), W(0x5128bd40e0a341e9),
+     W(0x1adf3cbb9c24fdba), W(0xb1ce8520f4c1dea8), W(0x5d6b5960db22eef2)},
+    {W(0xe9f05f28e020073c), W(0xd11d46fc080c539b), W(0xa2ad52d3f63bfadd),
+     W(0x1b4357506cbcc395), W(0xfd1d7e0666714bd8), W(0x6ee6f617a40eaca6)},
+    0
+  },
+  {
+    {W(0x3d0efae3106ba1a1), W(0x9c717ca192d7be5a), W(0xa5cb5a253f00eeee),
+     W(0xc2f9258cd86161ce), W(0xd2b0865f5c4a389a), W(0x8c06d7689b1f2159)},
+    {W(0x5a758a612753107f), W(0x5ab6449d0a539c19), W(0x88655a4949d301c8),
+     W(0x129647e61c4bb89b), W(0x06f0665ec360259c), W(0xcdba2f0b066197d1)},
+    0
+  },
+  {
+    {W(0x0262c90c3fedd636), W(0x4c37c1ba54d2bf3f), W(0x6514f8fb1577634a),
+     W(0x4678d634597668ad), W(0x90213b637cff6ecf), W(0x407127c87518cdfc)},
+    {W(0xd006db902447637e), W(0x7984642b9654a88c), W(0xacc73aeadf635672),
+     W(0xaeaa4faf1a366456), W(0x0df51aea1ce73aea), W(0x9ad1c0e59a8e4a48)},
+    0
+  },
+  {
+    {W(0xa235456903744726), W(0xd2169e6dd8d275ac), W(0xab0c247b132c5689),
+     W(0x129a5c9dcc4760bb), W(0x03eba46726ae821b), W(0x67a33fda3df1cf83)},
+    {W(0x010813cfb8421b7a), W(0x7b0f507098cd6d76), W(0x907320b31fe4b600),
+     W(0xda3bfeb398dd3239), W(0x23f1ed1641abb34c), W(0x01b30f29946f85f1)},
+    0
+  },
+  {
+    {W(0xdc8e04ff0029161e), W(0x51465ae680b2b4b2), W(0x5f675943dc4a18dd),
+     W(0xfa116cee6f33b013), W(0x546aef06bcac419c), W(0x02fd58fa3bcf3a63)},
+    {W(0x119a578d697e01b4), W(0xc53f6923a7362814), W(0x9a6888eba7d6e22e),
+     W(0x88e82da4736de788), W(0xa16e2edb6fc1bcd4), W(0xd2968acc639d21b9)},
+    0
+  },
+  {
+    {W(0x97c5f1c7d3970d9f), W(0xd051c518ac8e6227), W(0x3f67b3958e87edac),
+     W(0x3a5cbd287b9e4c17), W(0x58c009e65671841d), W(0x7bc5bddb518b3b39)},
+    {W(0xe7a8a6335e74a614), W(0xf92e4c226ed89a92), W(0xd0d6e80a118e663d),
+     W(0x33dba4f9dcbb4aec), W(0x1d4cb3141f917417), W(0xd8b17bfa3b0c5859)},
+    0
+  },
+  {
+    {W(0x794525aeacaff9de), W(0x2f8c88356c3c4c54), W(0x09fceefd76f894a6),
+     W(0x9867cbeb07c96792), W(0x801ac9e03b9c215b), W(0x96a19a41b89ba105)},
+    {W(0x1b387d46105627ff), W(0x9eeb3c3586c5823e), W(0x6ab28743e5841b81),
+     W(0x47619a2ab04bff71), W(0x7fe46b1a74622bee), W(0x6de0891a7f546b50)},
+    0
+  },
+  {
+    {W(0xc0fa0d21a093c3e0), W(0xad34c41439e902a2), W(0x81c8cd7599bc928b),
+     W(0xf7f8be14cdbbe4d8), W(0xe46268b5c2339529), W(0xcdc54e348283ba7d)},
+    {W(0x4c5cf62778904fe1), W(0x056678c11b45e4d2), W(0xb555ad6ad265abc2),
+     W(0xb8f8ca3f830306ef), W(0x48c8764681c20e1d), W(0x5bb0a529737a7944)},
+    0
+  },
+  {
+    {W(0x75cd6d6dc1008f7a), W(0x4f2ab3392c4c5269), W(0xcea7d925f836011b),
+     W(0xcff8acfd8a9d21fa), W(0x711d18538523ae8b), W(0xb7c5779fb33a8e73)},
+    {W(0x3436f8ae015a4f52), W(0x589c8af0e4f8f268), W(0xa3a42fe3c76c3179),
+     W(0x71fb9ec408e7800b), W(0x0dcf59812e60b941), W(0x7662203f165e2dd6)},
+    0
+  },
+  {
+    {W(0xbd4c2bfc9cf6fc5f), W(0x888885140577af66), W(0xb5aa2f05f9e3f7c5),
+     W(0xbd477bae64de6007), W(0x1da5dcc9747e1224), W(0xc2293d1732a15f5d)},
+    {W(0x4dd9daed029d6cba), W(0xf51362d62cf299c7), W(0xe1a4b5c4279cd1e1),
+     W(0x4b129a5ea89acfff), W(0x8292228ece1c8744), W(0x5a440fa04fd12c86)},
+    0
+  },
+  {
+    {W(0x50ef592309408a7f), W(0xb47907882a5f45e2), W(0xbc5e9477dd0e89a0),
+     W(0x6b47726664e5af30), W(0xa26ad1763e630e4d), W(0xbe517f313311630a)},
+    {W(0xd210521cc4488b7b), W(0x5c5e67f4e09f007d), W(0x92dcb39a50c358a6),
+     W(0x1f1ed347a7199215), W(0x086c863dc9c0af82), W(0xb3e712180d07112a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x285248309666f8ea), W(0xd579b3dfeff6502b), W(0x3a66fa9900e4f78a),
+     W(0xfd8a65bb54a3f7a3), W(0x505d3f631965a79a), W(0x9524972c1891469a)},
+    {W(0x78367cbc3354da3a), W(0xbfe1fe3de4941c6e), W(0xe41bb3f6f5af173e),
+     W(0x57cb03ca5ca36597), W(0x27f86cb87b99f795), W(0x5cae6514ad4dcef1)},
+    0
+  },
+  {
+    {W(0x38a49bf555f0ad9f), W(0x1a84c6b8f3618639), W(0x5f709eca01b2f7c2),
+     W(0xc479a6505be8359f), W(0x6b6a22bfd6646b3f), W(0xcce78878cc5b711b)},
+    {W(0x8e7dbc63b446cc63), W(0x231bd027218f800f), W(0x2d3a7e04030271eb),
+     W(0xb08b5978e22fb3c7), W(0x860d62789be0d46c), W(0x253a31c21d49a915)},
+    0
+  },
+  {
+    {W(0x56d6515604dc109c), W(0xcd740cc809c1d307), W(0xef9e049f10dfaead),
+     W(0x19750b3ae30b70b8), W(0x11ed860015c6a562), W(0x53bdf97e12097026)},
+    {W(0x79559d056c0d908f), W(0x8f1d75bab506d527), W(0xd6fd7323ae8fb3c4),
+     W(0x834639c9a4111f88), W(0xfc69a029a310a683), W(0xa4467bbb255f2e9a)},
+    0
+  },
+  {
+    {W(0x66797f56bbe4bdda), W(0xb92a369eda51b1a2), W(0x18eef4a531adb034),
+     W(0xcf1cb5ee5d185cfc), W(0xf596a59bbd53c27b), W(0x1e1dd6f569002569)},
+    {W(0xd9433e797687e48a), W(0x7d8d24c20cbcb9ce), W(0x233cd7ed65d68ecd),
+     W(0x201bbe09fb2aded8), W(0x987f4975ac9b750e), W(0x949da385337f7f25)},
+    0
+  },
+  {
+    {W(0x6fb6b7bc0410ca0b), W(0x0e16eed2b3c13935), W(0x98ad89d8316ff531),
+     W(0x4800ee179894d65f), W(0x034ea3c448280170), W(0x8126d12dc30be537)},
+    {W(0x43c2d27e5120e525), W(0x96a5d498ee65df90), W(0x654540105eaef29a),
+     W(0x1d8f07a17b678fc7), W(0x54bc6f737b301270), W(0xe58a8102e9473365)},
+    0
+  },
+  {
+    {W(0x3561b3fea329deb1), W(0xfdca0e34f1c3c3e4), W(0x4374831347fb79d6),
+     W(0xa7f497e1c48002ed), W(0x86221cce2c44dcb0), W(0x65e3f04643785e06)},
+    {W(0x9ee9061fdf4cf461), W(0xc7479e8cf022d27a), W(0x1d8de85b76f7f52b),
+     W(0x39a713c90fd6c65f), W(0xf74ca067711f8a39), W(0xad1119ad8ebc640a)},
+    0
+  },
+  {
+    {W(0x1942c2ffcd74009d), W(0x71c4d5f5e9c286a4), W(0xf3c152b5771a5972),
+     W(0x4cfb1e74363c2048), W(0xcd2ce8249ddb8da2), W(0x5d97c8e0a5ee443d)},
+    {W(0x6fa84b3d68d7b3d5), W(0x97eaa76d9ce14ec3), W(0x2e4571368e13869d),
+     W(0x39ac6a0c96f0f8a1), W(0xe24458ac42d93dc0), W(0x7eb3689d5f60bec9)},
+    0
+  },
+  {
+    {W(0x514cc1dcb08d2d0e), W(0x4e6b379e30e93536), W(0xf0e422ac2fc9230f),
+     W(0xaa50a1ad92e23e21), W(0x70ac46d8676d1ac0), W(0x698b9991f9f54493)},
+    {W(0x59a6b86a8649519f), W(0xc1f11ad6e3511da4), W(0xd3d9cff13192968c),
+     W(0x13e700b40b342dd8), W(0xfd5dc7bb3b1da441), W(0x02426e7c2c883760)},
+    0
+  },
+  {
+    {W(0x205d8189543c154f), W(0x19ecff03b39886d3), W(0x94559d8cbdb4dbea),
+     W(0x3ef1955ba82b6746), W(0x4d23741b1d54f0ed), W(0xb24852bd4f3c2829)},
+    {W(0x8d4fcd7032e50c59), W(0x8de9ea74b10a7740), W(0x5c3ff62873245719),
+     W(0xc143f74460e90cb3), W(0xe437ee7b650b064a), W(0xac749b6411081d8f)},
+    0
+  },
+  {
+    {W(0x6593942dc14267be), W(0xeff544b5a10b5d22), W(0xbddb096802bede45),
+     W(0x82e4d609fc69257c), W(0x85fa15af7ff7eb14), W(0x9ba7b18fd88c3f1d)},
+    {W(0x4c0f307d4502ade4), W(0xaa335fd7829750d8), W(0x08bc4a8e73c6d954),
+     W(0xc0be4eefbbfb8f75), W(0x5306eab3e26411db), W(0x3f7ec3a42c2d19a1)},
+    0
+  },
+  {
+    {W(0x8152a36171985881), W(0x35ed729aff81c44f), W(0x85e01d7a26f5acd2),
+     W(0xfd715c88cb1aac66), W(0x323d4bd37b5a84e3), W(0xff2fdebfffe1c248)},
+    {W(0x1a92996499f3492e), W(0x876b69258352bdac), W(0xff9b5f77ad8a35c0),
+     W(0xb2f83b0e6d11268b), W(0x97212d63451ed73e), W(0x329b662168d9b9ba)},
+    0
+  },
+  {
+    {W(0x65960f781390adb5), W(0x12168abccabb1082), W(0x134820c97c5896d9),
+     W(0x26a45bcabaf61f6a), W(0xad89df2454b476b3), W(0x3aac9d8e939a6bbd)},
+    {W(0xa786f57dce35aa2a), W(0x263b8aff5552ba81), W(0x99d68e77c1728fd4),
+     W(0x0289125d974285ae), W(0x800eafbe01a14d48), W(0x9368ded23bae405c)},
+    0
+  },
+  {
+    {W(0x5654d123f7fd2a16), W(0xb79a36e47534bc7d), W(0xe3e2c7da2a3c301e),
+     W(0x3aad1efab3a7c2f9), W(0x93cc13df43d3b3fc), W(0xcfd12ae0c480dbe1)},
+    {W(0x1d228622faecedde), W(0xf3ec2c6994a005d0), W(0x9dff56815a1b4f45),
+     W(0x5e4a6db641e68049), W(0x3c2be32692c112e8), W(0x871392cbc51e6a52)},
+    0
+  },
+  {
+    {W(0x185b878c43e9515c), W(0xd39b65ef6b20a3f3), W(0x4fa21c1da660f121),
+     W(0x9c874cf8421f82cd), W(0x3b8a8689bcc89467), W(0xc75c30f903550b3e)},
+    {W(0x6530fc60c3ed4f84), W(0xa3ef64a021e3a0fa), W(0x00ab8ea1ad646b37),
+     W(0x111dfc0bebc2484b), W(0xb6f2b63ea326ec59), W(0x2a8fd98af38946f0)},
+    0
+  },
+  {
+    {W(0x806390827c115437), W(0x982a553d660a4af4), W(0xffeeb41e2e0b335b),
+     W(0x956a642153ee5755), W(0x1c7f8358598dc209), W(0x0f8cfd60dc6431c0)},
+    {W(0xb694e1bee8b774b7), W(0x83ad62fd21790818), W(0x068a220f61f49213),
+     W(0xe8299baf7ac1b9af), W(0x5efa25b5f17df71b), W(0x0cf0f8da958c0c41)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9e9af3151c4c9d90), W(0x8665c5a9d12e0a89), W(0x204abd9258286493),
+     W(0x79959889b2e09205), W(0x0c727a3dfe56b101), W(0xf366244c8b657f26)},
+    {W(0xde35d954cca65be2), W(0x52ee1230b0fd41ce), W(0xfa03261f36019fee),
+     W(0xafda42d966511d8f), W(0xf63211dd821148b9), W(0x7b56af7e6f13a3e1)},
+    0
+  },
+  {
+    {W(0x3997900ecc8998d6), W(0x8fa564b7baa60da1), W(0x71bf5b0a661f3c57),
+     W(0x44b13388aab1292b), W(0xcbe80cb9d4d993f2), W(0x0b19b4c92203f966)},
+    {W(0xbc82a6520080f259), W(0x870ebc08ad96dea3), W(0xa388c7e7502f0003),
+     W(0x9c704ef056a38f73), W(0x93cde8a73487d9b0), W(0x5e9148b0ec11a1f3)},
+    0
+  },
+  {
+    {W(0x47fe47995913e184), W(0x5bbe584c82145900), W(0xb76cfa8b9a867173),
+     W(0x9bc87bf0514bf471), W(0x37392dce71dcf1fc), W(0xec3efae03ad1efa8)},
+    {W(0xbbea5a3414876451), W(0x96e5f5436217090f), W(0x5b3d4ecd9b1665a9),
+     W(0xe7b0df26e329df22), W(0x18fb438e0baa808d), W(0x90757ebfdd516faf)},
+    0
+  },
+  {
+    {W(0x63f27a25a748b8f5), W(0x68c8f3ec2cd246c4), W(0x5d317cd965f9ce38),
+     W(0x162c92e0635ba300), W(0x5259f64ffe343662), W(0x4a6b2b668e614ac8)},
+    {W(0x97fb55bb01177c3b), W(0xfb586c21a705cb01), W(0xa57e732578061824),
+     W(0x892f6b386c1e6306), W(0xf12e4c072367b14c), W(0x580d5fe2c83a48c5)},
+    0
+  },
+  {
+    {W(0x1e6f9a95d5a98d68), W(0x759ea7df849da828), W(0x365d56256e8b4198),
+     W(0xe1b9c53b7a4a53f9), W(0x55dc1d50e32b9b16), W(0xa4657ebbbb6d5701)},
+    {W(0x4c270249eacc76e2), W(0xbe49ec75162b1cc7), W(0x19a95b610689902b),
+     W(0xdd5706bfa4cfc5a8), W(0xd33bdb7314e5b424), W(0x21311bd1e69eba87)},
+    0
+  },
+  {
+    {W(0x6897401cea2bafb3), W(0x7b96ecc215c56fe4), W(0xe511b32939e2b43b),
+     W(0x39522861bf809331), W(0x815f6c1dc958f8f4), W(0x2abbdf6bc213e727)},
+    {W(0xeb09ae59c39bc01f), W(0xffe3b831676b56a5), W(0x8f4815a2a20f86c6),
+     W(0x748a17669aa30807), W(0xf1f46a211b758878), W(0xbd421fe76f6fc3d7)},
+    0
+  },
+  {
+    {W(0x75ba2f9b72a21acc), W(0x356688d4a28edb4c), W(0x3c339e0b610d080f),
+     W(0x614ac29333a99c2f), W(0xa5e23af2aa580aff), W(0xa6bcb860e1fdba3a)},
+    {W(0xaa603365b43f9425), W(0xae8d7126f7ee4635), W(0xa2b2524456330a32),
+     W(0xc396b5bb9e025aa3), W(0xabbf77faf8a0d5cf), W(0xb322ee30ea31c83b)},
+    0
+  },
+  {
+    {W(0x300b04840d6ded89), W(0x0b1092cbc3ab55ed), W(0x17d9c5420cc10a74),
+     W(0x7f637e84eff9d010), W(0xd732aa1e27aa1285), W(0xedb97340e2a77114)},
+    {W(0x62acf1585ef4dfb0), W(0x1e94fc6eba1d7b81), W(0x88bec5d22e6eb2db),
+     W(0xaec272028d18263d), W(0x4b687353e4bbd6ac), W(0x031be3510ff7e4c0)},
+    0
+  },
+  {
+    {W(0x048813847890e234), W(0x387f1159672e70c6), W(0x1468a6147b307f75),
+     W(0x56335b52ed85ec96), W(0xda1bb60fd45bcae9), W(0x4d94f3f0f9faeadd)},
+    {W(0x6c6a7183fc78d86b), W(0xa425b5c73018dec6), W(0xb1549c332d877399),
+     W(0x6c41c50c92b2bc37), W(0x3a9f380c83ee0ddb), W(0xded5feb6c4599e73)},
+    0
+  },
+  {
+    {W(0x6c00f388f086d06c), W(0x17ee45035add0cf4), W(0xf96984c707caf89c),
+     W(0x9d49d667648ed5e9), W(0x3ef95015a0164881), W(0x39e28e447d9c651f)},
+    {W(0xb13ad24059f37780), W(0x08cee349b9522225), W(0x9245ee6f2ba1b214),
+     W(0x12bedaa9a886d8d2), W(0xe139ae08fcb8186f), W(0x99203fb6fc2ef864)},
+    0
+  },
+  {
+    {W(0x14d34c210b7f8354), W(0x1475a1cd9177ce45), W(0x9f5f764a9b926e4b),
+     W(0x77260d1e05dd21fe), W(0x3c882480c4b937f7), W(0xc92dcd39722372f2)},
+    {W(0xf636a1beec6f657e), W(0xb0e6c3121d30dd35), W(0xfe4b0528e4654efe),
+     W(0x1c4a682021d230d2), W(0x615d2e4898fa45ab), W(0x1f35d6d801fdbabf)},
+    0
+  },
+  {
+    {W(0x3c29284764c9323d), W(0x40115a890491f77d), W(0xec141ade2d7a05f5),
+     W(0x0c35e4d9222a5f9f), W(0x5ea51791442a3e9b), W(0x17e68ecee51b841e)},
+    {W(0x415c0f6cd6ae9174), W(0xe6df85f89ffd7595), W(0x65fc694f8dedf59c),
+     W(0xc609503efee92718), W(0x57d2592e97d565ae), W(0xb761bf157e20862b)},
+    0
+  },
+  {
+    {W(0xa636eeb83a7b10d1), W(0x4e1ae352f4a29e73), W(0x01704f5fe6bb1ec7),
+     W(0x75c04f720ef020ae), W(0x448d8cee5a31e6a6), W(0xe40a9c29208f994b)},
+    {W(0x69e09a30fd8f9d5d), W(0xe6a5f7eb449bab7e), W(0xf25bc18a2aa1768b),
+     W(0x9449e4043c841234), W(0x7a3bf43e016a7bef), W(0xf25803e82a150b60)},
+    0
+  },
+  {
+    {W(0xd443b26582376117), W(0xb91087c11a1beb0d), W(0x3fe62a6545cc5951),
+     W(0x49c754bce6e472d5), W(0x7e60bb8177c424eb), W(0xbcd4088e830cbb97)},
+    {W(0x3da5c94eba26df7b), W(0x508b4f55f72b4338), W(0x409c5c7469ad7784),
+     W(0x82e5f1b0fdf44d6a), W(0x10654a1ceed2766f), W(0xef1e65faa6e83f4a)},
+    0
+  },
+  {
+    {W(0xe44a2a57b215f9e0), W(0x38b34dce19066f0a), W(0x8bb91dad40bb1bfb),
+     W(0x64c9f775e67735fc), W(0xde14241788d613cd), W(0xc5014ff51901d88d)},
+    {W(0xa250341df38116b0), W(0xf96b9dd49d6cbcb2), W(0x15ec6c7276b3fac2),
+     W(0x88f1952f8124c1e9), W(0x6b72f8ea975be4f5), W(0x23d288ff061f7530)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa6e19d0a5f56dc3c), W(0xe387e2690b88326a), W(0xef7380950ee527a4),
+     W(0x78b7174b7c4278a6), W(0xc133d867e70798ff), W(0x9d0fef759e9230ca)},
+    {W(0x7431eef01a955ab9), W(0x3772e7038868d922), W(0xf7a4306a8d6af3f7),
+     W(0x633bb5a0bbec076a), W(0x6d07623e7a257ca3), W(0xffb5e16521c00663)},
+    0
+  },
+  {
+    {W(0x35ae891bbb71e9b0), W(0x1f6ce6ca522b77f0), W(0xc2dab3cae63745c4),
+     W(0x55b8c185f218d139), W(0x6ab039c889f3b0e2), W(0xd9e25bfdc644c3fa)},
+    {W(0xc8496f203e2ed47b), W(0xc395ec028d67e17c), W(0x5c67839292114918),
+     W(0xe962e52fef73f345), W(0x3818baf354fcfb22), W(0x4d75d65d9d4bc911)},
+    0
+  },
+  {
+    {W(0x3a35938779493f3d), W(0x128301a91f06a9c0), W(0xfcce0f82899d204c),
+     W(0x4ca41589158780b5), W(0xc28f1bb73c4edd4f), W(0xe08e48a87a6aec34)},
+    {W(0x6d4783dfd447c55e), W(0xe7c2ecc857803027), W(0xb7b8c2bcdf6d7f91),
+     W(0xf0a8d4700f356ca3), W(0x229894bfdeb8e964), W(0x555c9d40d3aa70e1)},
+    0
+  },
+  {
+    {W(0x7f1f985c022ea83a), W(0x90a22662a7584e7f), W(0xb40a930a5188fcf6),
+     W(0x3fad79aba3a82904), W(0x7bee8d22f3151027), W(0x79a1a838c2c3e17b)},
+    {W(0x1fbe06e933cc3509), W(0x629c56aa9abd5cca), W(0xfff290ec2d9cf7a5),
+     W(0x5d0dedaa9bd062c5), W(0x080344abd7d35381), W(0x0848373af5cf9eda)},
+    0
+  },
+  {
+    {W(0x0935262335ea14d3), W(0xe1faf9e06e40b6c6), W(0x9a62d26ee94c9abd),
+     W(0x425b86b3a20b5267), W(0x8164f9c8e73d5fa4), W(0xfb28e7523b12cfc6)},
+    {W(0x6cc34bad781478c0), W(0x5c326a9feed2bcfc), W(0xf80ff50970e4963c),
+     W(0xe403ccccf0813b31), W(0xa72ab5f584f1ab8e), W(0x565db2c270f15b92)},
+    0
+  },
+  {
+    {W(0x170098dea1b31832), W(0xc6876bf92cd8c540), W(0x35b1b04b8660d773),
+     W(0x8b4b6c4b5152ad1e), W(0x0b0bd1c24a8e92aa), W(0xd814f6f488172f4e)},
+    {W(0x13a7689941ac83d1), W(0x355933b4f1d80357), W(0x4b394f973dc17e72),
+     W(0x1b0cd1660a7124b2), W(0x7549880cce8a372c), W(0x79f53f7ee712603b)},
+    0
+  },
+  {
+    {W(0xc14a3abbf709faa8), W(0x652f71c20f2ae889), W(0xe49bf1828a4be08c),
+     W(0xe6e7bf89deca5a89), W(0xa7326cf88efbb36b), W(0x5f74a004c7f6ae57)},
+    {W(0xceced37b9f67943b), W(0x99133f1f038b9f43), W(0xa7e65b3fb62a62e4),
+     W(0x82cb79a793e5c0e1), W(0x14c9a99461b8d773), W(0x2d19f21a0b05f2f0)},
+    0
+  },
+  {
+    {W(0x31d31f7a7a0c0bc0), W(0x7a37a84ab251d2bf), W(0x1793362e52f04d67),
+     W(0x5808e70921c7b651), W(0x33fe9123ed6f47f6), W(0xdeb1dde958f71405)},
+    {W(0x821d3045ae56b472), W(0x9f61f761e02043ad), W(0x932ddb145b2048a9),
+     W(0x17d989fed7811330), W(0x032ae4cb128fd85f), W(0x8f1956b47d1ef434)},
+    0
+  },
+  {
+    {W(0xbb4f169b6147c95e), W(0x826b8e3ce336d59d), W(0x124c66b828593afe),
+     W(0xd55bd9e8b0bba150), W(0xf5e0f44dbca78178), W(0x4799d4a9a941c7ad)},
+    {W(0xb9578cfe74f42704), W(0x85db470c2c51a9cc), W(0xd82f9951e8400541),
+     W(0xef0a80ce08facd56), W(0x061d289966ebd641), W(0x305f4aaf4b565031)},
+    0
+  },
+  {
+    {W(0x30cc44e0ce1d819c), W(0x3c2c4f0415a3a414), W(0x7f06d2c2665b634b),
+     W(0xf609fe647df0bd69), W(0x4b0c8c366a0dbf94), W(0xd0a3a75246e9b487)},
+    {W(0x7407e1579578a83f), W(0xc46ffa4ffe0f975f), W(0xb086f1991efaeccf),
+     W(0xf984b69d64796c18), W(0x14de44fa8ebfb97d), W(0x47bcb675f5245ba6)},
+    0
+  },
+  {
+    {W(0xa8cb95f1eca5a477), W(0x3ac20a42a924f597), W(0xee495cb76b3eef7a),
+     W(0x3ae2805ab9fa237b), W(0xe69068f62e363381), W(0x5bade9a33b149977)},
+    {W(0xa39d31cefa36b021), W(0x0dd606c0bd2c9c22), W(0x609edda62ab55053),
+     W(0x4508c5826d4fb90c), W(0x973be0c42535e1ee), W(0x9898622c5b564015)},
+    0
+  },
+  {
+    {W(0xed58c1ab0dbafc49), W(0x41995a5a6fa8b473), W(0x3af3853d85450ccb),
+     W(0x18d1a7be601fe529), W(0xd196520fdab2d926), W(0xd1f2c1e956213ae9)},
+    {W(0x3721825577ded01d), W(0x366c552da7905433), W(0x023d03737d9430d1),
+     W(0x65d70cb69ddf69ea), W(0x6321df7ad4d3fa24), W(0x77b1c2bfb91084c3)},
+    0
+  },
+  {
+    {W(0x57df950e998d54fa), W(0xc5741d4ffd048adf), W(0x28e5fb50e3339c2d),
+     W(0xa360f5dc76fe2b08), W(0x679b7795be061474), W(0xc6501cc3c4d6e8d9)},
+    {W(0x474085ec4b83d9c0), W(0xf50872d9bc495d81), W(0xe9e5dc3698f7f534),
+     W(0x219bf2f43cb1c662), W(0xd60e6e47f5d64258), W(0x6ed82c9bfaa73f56)},
+    0
+  },
+  {
+    {W(0x2434dbdf0aef0ff7), W(0xca74413e9cc3d2ba), W(0x0aee0d653dcbaeb9),
+     W(0x895680764184a72e), W(0x3d7e4f61be7d4e0f), W(0x284a8608ae441b4c)},
+    {W(0x7274fd926a67283c), W(0xa222be15c06e0b84), W(0xa0713cd7e4623e88),
+     W(0x0ff4a3174710aa33), W(0xc9a35a65044dcecd), W(0x7bae1ecade77a24b)},
+    0
+  },
+  {
+    {W(0xb17c236407d158aa), W(0x5e17ab0ae856603b), W(0x7a443472194b84d6),
+     W(0xba9b7ae451264846), W(0x641e9d7df113b932), W(0xc8a7295ac067d9af)},
+    {W(0xd8b4160f369de92c), W(0xef582ddce49830cb), W(0x5f9f6fac34b9b10f),
+     W(0x222ae9b4726150ff), W(0xc71fd37852dfe5b0), W(0x4a24e1379929694a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x070d34e116973cf4), W(0x20aee08b7e4f34f7), W(0x269af9b95eb8ad29),
+     W(0xdde0a036a6a45dda), W(0xa18b528e63df41e0), W(0x03cc71b2a260df2a)},
+    {W(0x24a6770aa06b1dd7), W(0x5bfa9c119d2675d3), W(0x73c1e2a196844432),
+     W(0x3660558d131a6cf0), W(0xb0289c832ee79454), W(0xa6aefb01c6d8ddcd)},
+    0
+  },
+  {
+    {W(0x0ed1082f89e4e449), W(0xdb1fb471833f2378), W(0xa35fef0eece77352),
+     W(0x76adaa464bf0c426), W(0xfbab929aa011b2fb), W(0x6f475d5b9d8cc4d3)},
+    {W(0xbe6d7f2174351480), W(0x2d1362d193e4a7ae), W(0xc7e2cba5106ceaab),
+     W(0xfe94528a45258697), W(0x7109b17d075945b0), W(0xfd395b2ccae17f7a)},
+    0
+  },
+  {
+    {W(0x68550299845e12c9), W(0x979b5406361d027f), W(0xf601d2b4a8e92e70),
+     W(0xfd02799f0cc9fca9), W(0x89f99ca013bc2e96), W(0x22a12c0bff9db9b8)},
+    {W(0x6ae7084a32efcea8), W(0x5ddd3ee9a24b9376), W(0x394d92a4e0945e8f),
+     W(0xddab6752ecea36f6), W(0x650b74d60d18a069), W(0x37f91cebad650860)},
+    0
+  },
+  {
+    {W(0xfc1faedc310404a8), W(0xea339148d3bcb128), W(0xf00485456416defd),
+     W(0x75de7770c58653e7), W(0xdd2dcbebe2f6f99e), W(0xa4380ef4d159ac07)},
+    {W(0x45dd713ce4173608), W(0x44919b61446a6789), W(0x3f73756b6b962b38),
+     W(0x3cb9f53bbffd3f0c), W(0xd723c40b7f08ebae), W(0x998a9b170c3cddba)},
+    0
+  },
+  {
+    {W(0xa804b2f089ef2489), W(0x06a2a805fb22f7d6), W(0x31baf4fd353970be),
+     W(0x3481c8b712854a91), W(0xb0424eecf3971398), W(0x748ef3820f4ed94a)},
+    {W(0x92b74ad026722164), W(0x23f71d5831b1302f), W(0x6741b28070a5f0c9),
+     W(0x46c12cfb9f5101ca), W(0xe7014d7901d0f81e), W(0x129bd87ad758c288)},
+    0
+  },
+  {
+    {W(0x6a565269a3e0c5b3), W(0xaab7ec7104c6ae54), W(0x0bda11a7d8c6ddb8),
+     W(0xb7ebfafb2332347b), W(0xcf791881e99dff48), W(0x81600214dc357c83)},
+    {W(0x2a264f8931d7495b), W(0x8ca430004ec885a7), W(0x6d478260bb47d417),
+     W(0x544de4ec3d817032), W(0xac7150a9dc05f901), W(0xffef225775c0963c)},
+    0
+  },
+  {
+    {W(0x58805ca8d2eaf294), W(0x910d085ed7d5abb8), W(0xf9cbc9a1349cfecf),
+     W(0x67bc7b417800a980), W(0xe7e6dbc0f6847e9d), W(0x7a0f22c4af379c48)},
+    {W(0x80b6fc04b1d2822f), W(0xa1cae656d8517a70), W(0xd2d11ed14e9dc24b),
+     W(0x48d74f173fab87e6), W(0x1feca5af50c630ae), W(0x263e04cc62d0620a)},
+    0
+  },
+  {
+    {W(0xf6377e3bf6ba1469), W(0xc334fb6c09c832d3), W(0x7f85ac42c21c0cf1),
+     W(0x7a3e31c9857d8edb), W(0x2eb1076327b77ed6), W(0x2bfbbdbc38dae10b)},
+    {W(0xed7c6fb17bae3b4f), W(0xc5911d9f36d04e6f), W(0x4dc435504569e72f),
+     W(0xaa82fb97bedae3ab), W(0x06d37bef4f27e463), W(0xd0dbce6df0c35a11)},
+    0
+  },
+  {
+    {W(0x23c14c43d8f6e236), W(0xb14be0d28ee39386), W(0xd3c55814262dd390),
+     W(0xa1b40401e1f23d0b), W(0x1377b07c61534375), W(0xfe4e3eb116f6d95e)},
+    {W(0x17b1af0040b4386c), W(0x2dc657a837ca3851), W(0x6862ca92ef976731),
+     W(0x9f0c380ba4118d3b), W(0x23bf793977c1aa94), W(0xaadee0612bc27d4b)},
+    0
+  },
+  {
+    {W(0x0573d9963ab4c707), W(0xee5d87691420fdf1), W(0x41873aa55e2b9c12),
+     W(0xe09290456810bf08), W(0x4ff4143fccbe4bbf), W(0xd0e5a74969328301)},
+    {W(0xab5912621c4b73be), W(0x550ea0633f3edf99), W(0x8a77633734c93db1),
+     W(0x5c51d3f832b21521), W(0xcee9f604713feea0), W(0x0d6f8a5a7bf4268e)},
+    0
+  },
+  {
+    {W(0xb87d5ce2722f405f), W(0x24d1f993d7c6a322), W(0x09d837291e0d8113),
+     W(0x70b5cdbf89a6cbc3), W(0xdfb3ee16fb2c9607), W(0xf0acc1163465c7c6)},
+    {W(0x10cef4b707e6659b), W(0xc280c4331fde9940), W(0xc8b5e9819a2d3f25),
+     W(0xc36faa763f7f68c1), W(0x17878bfa8d54e281), W(0x8fda8b359c42c5a2)},
+    0
+  },
+  {
+    {W(0x43c78835661019ec), W(0x68e916b124e66d29), W(0x02c0f3a224094671),
+     W(0xab6f1c05d0f17d86), W(0x6d3bac72a22d4264), W(0xd7b8f152f6e5fafe)},
+    {W(0x95627c6339447eb3), W(0xfd15901879e1ff93), W(0x39277c835ad80806),
+     W(0x758aafc90d7c7b74), W(0x605ad8ca4cb8bec9), W(0x6a90085c5741828a)},
+    0
+  },
+  {
+    {W(0x7d8ddca252aa7ff2), W(0x0985e47d6953b9a2), W(0xed328993dfff63cc),
+     W(0xbfeca5327cfa6ee5), W(0x7535a871b1e6a010), W(0xb0052764303c2ec5)},
+    {W(0xd39c72102fedb0da), W(0x7ee2b384e1001505), W(0xb638a1b1c82a7e1c),
+     W(0x1b94a47b4573fd7d), W(0xef2bca7792cb2b88), W(0x49ad6e97a75b21ef)},
+    0
+  },
+  {
+    {W(0x9ac777993acb39dd), W(0xd1d3ecddbb7c6a8a), W(0xa5271c9e7a75159c),
+     W(0xa6ffb41f2c276e4d), W(0xc526556e0bb9a955), W(0xa32e1352233b7774)},
+    {W(0x103f124bc2cf09aa), W(0x1816d1eff10bae5a), W(0xc5f9197ee8837629),
+     W(0x064d5dcb13b1b76b), W(0x109c70748d0fe0b1), W(0xbb4e9743fce5f6e1)},
+    0
+  },
+  {
+    {W(0x1b403c4f1470433e), W(0x6f8cb19257e53eec), W(0x87b5b93df0cce4f5),
+     W(0xfefaa5008c566f77), W(0xf6aa8066db71517b), W(0x9f01b036d67f5952)},
+    {W(0x9524306faaeb40df), W(0x5cb2e8e1421350a6), W(0xa57d05ea3d69040c),
+     W(0xd0ff12a1b9bbdcd8), W(0xed64d3259e3e19bb), W(0x29509c0fed0a490d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6edf5561ff8b1fbe), W(0x614b788ef6eac0c0), W(0x7699ae56d8d66d29),
+     W(0x5f81602ae9d58eb2), W(0xd0c04874faf9176d), W(0x4b3a0046523153b1)},
+    {W(0x9690930ff6315883), W(0xa81c0b44a60ca92d), W(0x2d0e725873bcba90),
+     W(0x57efe72de902e329), W(0x3fcd598676bc27b9), W(0x492adf0393940c09)},
+    0
+  },
+  {
+    {W(0xc68b641ec795a2c7), W(0x4fe559b15a4d6647), W(0xeda98cbad89ce668),
+     W(0x15f84dc06c269d8e), W(0xf0eb685ecbf34023), W(0x3668c530c032634a)},
+    {W(0x2e3d7fffe4531f59), W(0xe627030685494d06), W(0xf02cabcfa3e050df),
+     W(0xccd2da67c001dcd9), W(0x50aa3723066d2d52), W(0xdb0756507224a41f)},
+    0
+  },
+  {
+    {W(0x4b1f8698e1aa5953), W(0x94af5c0cbf0a531c), W(0xba1c49f56536e156),
+     W(0x31c3163109c95a75), W(0x268a308f0a6d9af1), W(0x185b9762fa9ca8b7)},
+    {W(0xc3b1cbcd65035840), W(0x17b276c6b429c82a), W(0x1b4ec7b334396850),
+     W(0x42f21d5a048a6943), W(0x0bf948f55b5820bf), W(0xac944487b48dca58)},
+    0
+  },
+  {
+    {W(0x04418b5965b55050), W(0xa8a797c3d324aa67), W(0x5f87e22c7c65a6d9),
+     W(0xaac710651dbeffe4), W(0xff619d64bd3cc05c), W(0x9a29c966e65c92c4)},
+    {W(0x23af2b21dad7fcbd), W(0x4950a767153b817f), W(0xc34a7efac6478c55),
+     W(0x57cde95af6cd140e), W(0x64b74575f5a0db2e), W(0xd4b5ea5275d7fb76)},
+    0
+  },
+  {
+    {W(0xa9532cb28a0cb213), W(0x1f73762a2631b8dc), W(0x74ea067545b1733a),
+     W(0x7f37f024cc6e65dd), W(0x6612b1425c6ff2aa), W(0x2345257c3037479e)},
+    {W(0xe512bca5f64949d3), W(0x5b5a6a560c81668b), W(0x5b97bd29a259d650),
+     W(0x215eb6577373034f), W(0x79da0fc4885aa640), W(0xf7aa2f0c7e4358b7)},
+    0
+  },
+  {
+    {W(0xce3cc51439c38ce7), W(0x42c005139348efd0), W(0xa9e6d981efc9f71a),
+     W(0xc01ded6a20bea9ba), W(0xc4b7e6424fef7c1f), W(0xc6ef7a53f9deca5c)},
+    {W(0xa0a43d0a609dc954), W(0x1758e10de6f11d77), W(0x97cea173b5d57bbf),
+     W(0x3c3f30f562999781), W(0x69a7820a8eca2bb1), W(0x22b474b30ff692e0)},
+    0
+  },
+  {
+    {W(0xaca3f998378a2704), W(0xc147f6507fcce9dd), W(0xe031dbd63d82750b),
+     W(0xfb2552a2faa3400b), W(0x74e9b5d3655fd54b), W(0x201c384c35894303)},
+    {W(0x5a575a42480a2d93), W(0x2f0c46b9a5a597af), W(0xca6fada596e1e117),
+     W(0x126e9afd0f305dc3), W(0x91da8d73058d7af5), W(0x2661f3f2d8353693)},
+    0
+  },
+  {
+    {W(0x284050628e72aafb), W(0x655bf3538ea8bf00), W(0x789d944405547f7b),
+     W(0x7fa445ed3441e472), W(0xfeb198254a44ce87), W(0xccb5f12c129aed14)},
+    {W(0x22b05de3af94fb34), W(0x7422a040d3f03199), W(0xfba252caa83f7f08),
+     W(0x0f6ad6e6cefaa757), W(0xe1ad18716517d806), W(0xd16dc8ed8e9d97ad)},
+    0
+  },
+  {
+    {W(0x517903a2c51ad2c5), W(0x34fa92220e789e56), W(0x946dd276caed4c19),
+     W(0xe8eec882c709d6d9), W(0x02563af6bc07c5eb), W(0xff92ac101dd276c1)},
+    {W(0xbb3eeaae7a8a40cb), W(0xdbbeb42406a13c61), W(0xd9f5686ed46ee388),
+     W(0x21477515636e520e), W(0xad082752ee7bfe41), W(0xc22a3539201bc779)},
+    0
+  },
+  {
+    {W(0x39dd3e478816525b), W(0x37b8eca1f732815b), W(0xa9823d0e2b20ebe6),
+     W(0xdebd557037793546), W(0x26a56b99d1de71e6), W(0xf16aa413427b813c)},
+    {W(0xb23ee8053131421d), W(0x0521e7d730c32264), W(0xa20f72a2023e5f9b),
+     W(0x5c2c411b0ed3b585), W(0x7e6a038ca443a74f), W(0x425c165bc11d5fd7)},
+    0
+  },
+  {
+    {W(0x1351bb06dd5b70e9), W(0x5c55555a0edb1c6b), W(0x72a60a735d5dd487),
+     W(0xecfcee6036f848c2), W(0xa9829f0f0fbb4944), W(0x719042ee26ad7973)},
+    {W(0x642fa7d93151f1c2), W(0xc045b50a6fa86dc7), W(0x00bba71f21b31fd6),
+     W(0xcf9ad9e35eeb8754), W(0x40c1d57d1c6216d6), W(0x074e245d22e10f8b)},
+    0
+  },
+  {
+    {W(0x0208092a0e3dca68), W(0x9a49bdccd1a09971), W(0xe5194181aefab9c1),
+     W(0xc1c9690a0076f47c), W(0xd7499e95b486c2fb), W(0x83a69e43d4b72e00)},
+    {W(0x75f2838a2d1a6c2b), W(0x57a24c69751f6366), W(0xd956ee08626cc684),
+     W(0x434cadd7e6ce3249), W(0x3d4eaececfe289bf), W(0xbbd53b961b8aafdd)},
+    0
+  },
+  {
+    {W(0xc495cc34700fdaea), W(0xbe0b3c493241c66d), W(0xa8186ee80def5c8b),
+     W(0xbb574ae88b956716), W(0x908d1717ce551b16), W(0x312ce893b3156795)},
+    {W(0x386e339224bb0698), W(0x5b2ac3bbca53b7be), W(0x056256310965844d),
+     W(0x03bf9eb1c7b202d1), W(0xe2e38b041b17cdfd), W(0xac9e7b36922e1024)},
+    0
+  },
+  {
+    {W(0x0825964b952ace1f), W(0x60445c0c1a241b84), W(0xe8d0cde4e9bbcd10),
+     W(0x8ea0868ffd21f8f9), W(0xcb4de2f74688a66b), W(0xd0e02114519be9cc)},
+    {W(0x7310028b53898e89), W(0x848bf9e8db313058), W(0x5ca69d3cd7ec0c87),
+     W(0x5f66aed3b0a66867), W(0xccb6c8351ed51781), W(0x7d4f7b6898752b3b)},
+    0
+  },
+  {
+    {W(0xc83b78c4ae47adfb), W(0x89807cbd466418cb), W(0x2f4475c7e3e9ff0c),
+     W(0x9e08b2748f7fe2c6), W(0x298e11a7653f9be0), W(0xe4db64582c6ef722)},
+    {W(0x9d9598e0ebecf05d), W(0x0a73866f6e75e7fa), W(0x307cf6079dbf4307),
+     W(0x797ddf2a1ff0e25a), W(0x8df8c5032c49d11d), W(0x77461c1fdec55018)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xcbb99194a3736eb6), W(0xdd5161cd36dcf470), W(0xd50b24aab6ab6c03),
+     W(0x419d2810bc41f4b7), W(0xe2e88d7a295496cf), W(0x350713f2f2457ac0)},
+    {W(0x838e4a360427e2ae), W(0x7631472a4d974e5a), W(0x9fa3ab1c7a5c5fdc),
+     W(0x324798cdde34cb8d), W(0xbfa5a9d0889105fe), W(0xd05dad34fd0df249)},
+    0
+  },
+  {
+    {W(0x9974759c581f9d3c), W(0x9e76a970e5cb1973), W(0x8afec58ec64941ca),
+     W(0x2d7c57fa01d05575), W(0xc07c74cc5c448db5), W(0xa52474ce01bb1440)},
+    {W(0x93162d9700115bbb), W(0x483b6147fd7480f9), W(0x4f28c57e6af18ded),
+     W(0x36faed8f174a3089), W(0x702dbd64a3dd6265), W(0x86a9c43f6adc0d7b)},
+    0
+  },
+  {
+    {W(0x4981be690c5bbd3e), W(0xb047df0a185fdb55), W(0x3168e05074cff00c),
+     W(0x111150a1b52c7f9c), W(0x0db2ed84a51c7986), W(0x7d991630e61272ad)},
+    {W(0x7443d93628de14dd), W(0xfdf31f41a5daed5f), W(0x71e0ef4e866b5e40),
+     W(0x05c57a45b965a670), W(0x85bdb58c70e1aa77), W(0xe4d1fe2a9df3ce32)},
+    0
+  },
+  {
+    {W(0xc41e4aedf5c3af59), W(0xa0284ad06de9a78a), W(0xf5eaab7b8ed812d2),
+     W(0x7801fbb81afb58b8), W(0xbe5cdba671efcc3a), W(0xe31a0e3ccd10cb91)},
+    {W(0x882e821e85dc0bc6), W(0xd3ad070fbb32e506), W(0x3afede2bd8a0f038),
+     W(0xe20a117c857fd3a0), W(0xebaa2aa43060f767), W(0x6524aa0d2b9d1da1)},
+    0
+  },
+  {
+    {W(0x70e478fb9346df25), W(0x01dc0c2eb4a4ada5), W(0xaec82b005be36ea7),
+     W(0x82618b8f6717e06a), W(0x2db1f6d4008f1977), W(0x4e493f3b16b390d1)},
+    {W(0xfe86fd4d990a75eb), W(0xa1cf7f99783f6076), W(0x6cbb23e70c049158),
+     W(0xd05be7e5ed456235), W(0x601374069bd836ef), W(0x94ec964432e5f604)},
+    0
+  },
+  {
+    {W(0x09db138d18f2470c), W(0x63bd2290f613658f), W(0x0bb647794feebab9),
+     W(0xfce4aee17fdb1e71), W(0x7d5c0c61a7f1f65d), W(0x46405b618d02d6cd)},
+    {W(0x7cac04856fdcb0d0), W(0x85224c4b2f8ec5af), W(0xb5879a59db0aa864),
+     W(0x75f391b8ff94f8b5), W(0xa6c994ae49c97f8e), W(0x4d968fadd690b232)},
+    0
+  },
+  {
+    {W(0x07c60c7522ea5f1c), W(0x35beae34a36bee4f), W(0xa8b00a09dcba8997),
+     W(0xa77f1f3a802ce50c), W(0x6c4050df2a2144b0), W(0xf79bfa96ab1b10db)},
+    {W(0x9025d470433a9b1c), W(0xaf3e391790d9eec8), W(0xbcad2d629ae2d535),
+     W(0x7a152829eff0f6a9), W(0xe87345cd925fa5a0), W(0x6ce007200e84039c)},
+    0
+  },
+  {
+    {W(0x5017e145db81146d), W(0xc7d2086d45c54db8), W(0x2541059dfa98234a),
+     W(0x4bf344d99985af98), W(0x39737ed67b5b7b1c), W(0x8e24691987c411ad)},
+    {W(0x2fad8cedb877a75f), W(0xe42352df17e60ee2), W(0x1a53d856404043f7),
+     W(0x6c1f07a5863927a1), W(0x38d3a4f4b6892121), W(0xf4c1092001976c8f)},
+    0
+  },
+  {
+    {W(0x99d37ade6b65e17a), W(0x61ca538e38ce217c), W(0xd3ea83f68ebb89ed),
+     W(0xce6611eb4b02964e), W(0x0ec7cc2f5c0a8e44), W(0xa985b0c2974240a4)},
+    {W(0x7a3abb6c42ee5b0f), W(0x55f049a0cb2eddad), W(0x69348b027c44a60c),
+     W(0xcabc65191974a8c7), W(0xd9def4bc07b91a35), W(0x684a2d71b93b34c3)},
+    0
+  },
+  {
+    {W(0x5d573a3a0b6320aa), W(0xf9ac8ccf289b6700), W(0x8bad05cd8f28dd72),
+     W(0xe2eabd446b62c306), W(0x60f70353906ef302), W(0x147cdd0c367a768e)},
+    {W(0xea9d871635a9e846), W(0xdd71e80aa8684430), W(0xa56a5ccd530768a8),
+     W(0x59d241270a3e42f6), W(0x707cbaf0faa367d1), W(0x5419b14f52a0cbd0)},
+    0
+  },
+  {
+    {W(0x3cfe2987d10542b1), W(0x5935e0dc29f5b006), W(0xce5932d6d83344f2),
+     W(0x67aab7ad9800a6d5), W(0x3ef2b0e765073619), W(0xc381a99454aa9cca)},
+    {W(0xbf069577d4011571), W(0x33b70c5d4d1ce997), W(0x801ba41c758c9b1b),
+     W(0x6c2dd5ec36968958), W(0x31820ca087921665), W(0x0b7f0d337ca55668)},
+    0
+  },
+  {
+    {W(0x31cb896b57dfc732), W(0xc6b74a1edc323e91), W(0xd24a41d0f11b04f6),
+     W(0xb609a26dab8f7159), W(0x96d84b372adbec34), W(0x154f5307d24ae7f6)},
+    {W(0x36dd3243e10eb34c), W(0x055d3b714f6dbbd3), W(0x30b1efde36d0c561),
+     W(0x3846925ce9bffd15), W(0xaf401286aa99ba07), W(0x3a191267fd48b839)},
+    0
+  },
+  {
+    {W(0x2fc83aa3afabd13d), W(0x521b745f53c45a27), W(0xc6f345a660c18225),
+     W(0x9609076eb5faa47a), W(0x8bdd97fd535388fb), W(0x8f5f3bd6e7fd7e87)},
+    {W(0x6de4454c1c8e1d5a), W(0x8d61ca3b2b35e823), W(0x93b66fce4672d30e),
+     W(0xcb9d601721d09ec5), W(0xef98137fb1de06ea), W(0x45e212758b051877)},
+    0
+  },
+  {
+    {W(0x3104e59e6b843647), W(0x4eccb42720bad138), W(0xa575b8e150efd6a9),
+     W(0x68a6b7055a6e4729), W(0x670306798f5b2a22), W(0xb2cfcf81df9253bf)},
+    {W(0x9c3eeb19b8f81c39), W(0x082ca86c986b4dfe), W(0x1f64eca250250d8e),
+     W(0xbf26bcfb67f0c713), W(0xbc5d0e2a49b609cd), W(0x175acb34e6aa3c76)},
+    0
+  },
+  {
+    {W(0x32e678b4c1ba956b), W(0x9e8b137248f32982), W(0x9b380a118a8f262a),
+     W(0x5c2d6ce0807f6d1a), W(0xe99c2e909f1b3fa2), W(0x6a0c9e4a7c4bb836)},
+    {W(0x30d80329ee8dac83), W(0xabcf7b76b60bd5fb), W(0xc589a0c8c14d56d4),
+     W(0x9e40af665de24d43), W(0x932f4070230f8331), W(0x96bba1c19b87948d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbcc88422c2ec3731), W(0x78a3e4d410dc4ec2), W(0x745da1ef2571d6b1),
+     W(0xf01c2921739a956e), W(0xeffd8065e4bffc16), W(0x6efe62a1f36fe72c)},
+    {W(0xf49e90d20f4629a4), W(0xadd1dcc78ce646f4), W(0xcb78b583b7240d91),
+     W(0x2e1a7c3c03f8387f), W(0x16566c223200f2d9), W(0x2361b14baaf80a84)},
+    0
+  },
+  {
+    {W(0x7a1a522b246dc690), W(0xb563cbe14b61ab70), W(0x41bb4abe3d4ac4ab),
+     W(0xc52950b337f996e8), W(0x01d991e679727761), W(0x35de93bd978fd7d2)},
+    {W(0x86bad5e65706d336), W(0x10844155e7f26c20), W(0x58ffeb7705757453),
+     W(0xbb1861293939df77), W(0xbfdd394a6a78ea0f), W(0x907ff0546e33e1d3)},
+    0
+  },
+  {
+    {W(0xdb1cffd2b5733309), W(0x24bc250b0f9dd939), W(0xa4181e5aa3c1db85),
+     W(0xe5183e51ac55d391), W(0x2793d5efefd270d0), W(0x7d56f63dc0631546)},
+    {W(0xecb40a590c1ee59d), W(0xe613a9e4bb5bfa2c), W(0xa89b14ab6c5830f9),
+     W(0x4dc477dca03f201e), W(0x5604f5dac88c54f6), W(0xd49264dc2acfc66e)},
+    0
+  },
+  {
+    {W(0xa7f295320df93b34), W(0x855934f25c14df30), W(0xd2f54ce9efae348c),
+     W(0x5acb931cac52758d), W(0x287b3e18d22961a4), W(0x42a5516d748f8fe1)},
+    {W(0x1b62b341877224ca), W(0xaff58db3d30a4aa7), W(0xbad78dadbe8da847),
+     W(0x85fa710954f18276), W(0xe2cc9d287c4bfdad), W(0xbb131f762c75f237)},
+    0
+  },
+  {
+    {W(0x283dd7f01c4dfa95), W(0xb898cc2c62c0b160), W(0xba08c095870282aa),
+     W(0xb02b00d8f4e36324), W(0x53aaddc0604cecf2), W(0xf1f927d384ddd24e)},
+    {W(0x34bc00a0e2abc9e1), W(0x2da1227d60289f88), W(0x5228eaaacef68f74),
+     W(0x40a790d23c029351), W(0xe0e9af5c8442e3b7), W(0xa3214142a9f141e0)},
+    0
+  },
+  {
+    {W(0xcdcdd7d703844670), W(0x79ec59afb4a23f91), W(0x5923c569c00ce5c3),
+     W(0x099c17ffc589d0c7), W(0x0335eeea89fa6fe6), W(0x916bcacaa4e868c4)},
+    {W(0xb7037325fb687bd5), W(0x57d6bca79853b564), W(0xdf3132efd5e26d28),
+     W(0x7ed994b8de919cbe), W(0x12df67cd6fbbb18d), W(0x516e07c06baff508)},
+    0
+  },
+  {
+    {W(0x72f4949ef9a58e3d), W(0x738c700ba48660a6), W(0x71b04726092a5805),
+     W(0xad5c3c110f5cdb72), W(0xd4951f9e554bfc49), W(0xee594ee56131ebe7)},
+    {W(0x37da59f33c1af0a9), W(0xd7afc73bcb040a63), W(0xd020962a4d89fa65),
+     W(0x2610c61e71d824f5), W(0x9c917da73c050e31), W(0x3840f92fe6e7ebfb)},
+    0
+  },
+  {
+    {W(0xf2ec9ef597e833e4), W(0x97bdef9734ec7e41), W(0x90e2b2387d2ac6e3),
+     W(0xcf682b120318a3b7), W(0x7fe76089ea84a7a0), W(0x85c489f916546d05)},
+    {W(0xf987118f6abdda05), W(0x675cf998aa4b95fc), W(0x544c7774888a7e8c),
+     W(0xbd2647ba63ec5831), W(0xb479cea3fd2fe985), W(0xa042134528d163e8)},
+    0
+  },
+  {
+    {W(0x50fbd7fe8d8b8ced), W(0xc7282f7547d240ae), W(0x79646a471930ff73),
+     W(0x2e0bac4e2f7f5a77), W(0x0ee44fa526127e0b), W(0x678881b782bc2aa7)},
+    {W(0xb9e5d38467f5f497), W(0x8f94a7d4a9b7106b), W(0xbf7e0b079d329f68),
+     W(0x169b93ea45d192fb), W(0xccaa946720dbe8c0), W(0xd4513a50938f9574)},
+    0
+  },
+  {
+    {W(0xd93506a4e5947c6f), W(0x4340d76a39b81d08), W(0x741aee5917930d30),
+     W(0xfea3d99a18fdb81c), W(0x1088ff6b289bcb07), W(0xc6b45602b7c082c6)},
+    {W(0x50e2baab453d8d69), W(0xda9bf561e893e183), W(0x0af25f86b29a284d),
+     W(0x0e92e67473e01380), W(0xe173a0e32be00e59), W(0x402d2f3dada8954a)},
+    0
+  },
+  {
+    {W(0x841c96b4054cb874), W(0xd75b1af1a3c26834), W(0x7237169dee6575f0),
+     W(0xd71fc7e50322aadc), W(0xd7a23f1e949e3a8e), W(0x77e2d102dd31d8c7)},
+    {W(0x5ad69d09d10f5a1f), W(0x526c9cb4b99d9a0b), W(0x521bb10b972b237d),
+     W(0x1e4cd42fa326f342), W(0x5bb6db27f0f126ca), W(0x587af22ca4a515ad)},
+    0
+  },
+  {
+    {W(0xca9cb3890399721d), W(0x03ad9f4aa3291479), W(0xd85b5df56dee003d),
+     W(0xe1fa7b0264a4f83a), W(0x01c4cbfdb73f7324), W(0x707010d45cf2ddf4)},
+    {W(0x3c6df430b12e02f8), W(0x921a290185531489), W(0x302fc77c91d1022c),
+     W(0xc3733ec0342d8f3f), W(0xb83bc75f6195a665), W(0x4a14b9e7a79f8027)},
+    0
+  },
+  {
+    {W(0x1123a531b12e542f), W(0x1d01a64db9eb2811), W(0xa4a3515bf2d70f87),
+     W(0xfa205234b4bd0270), W(0x74b818305eda26b9), W(0x9305d6e656578e75)},
+    {W(0xf38e69de9f11be19), W(0x1e2a5c2344dbe89f), W(0x1077e7bcfd286654),
+     W(0xd36698940fca4741), W(0x893bf904278f8497), W(0xd6ac5f83eb3e14f4)},
+    0
+  },
+  {
+    {W(0x9f0e5428e2a57359), W(0xc690a3c714998c16), W(0xd73c3ca2de37e07e),
+     W(0x2ddf91b8dba0bc0d), W(0x69d834b27570ae71), W(0x2ac8bed4735195a6)},
+    {W(0xcd8c51ff3b1fcc5c), W(0x7aa8cf4e1ba6863f), W(0xebb69e72ae70f428),
+     W(0xa29409dfaa9e936d), W(0x43f6ee805a332b9b), W(0x0de49efac2eab0a9)},
+    0
+  },
+  {
+    {W(0x327b9dab488f5f74), W(0x2b44f4b8cab7364f), W(0xb4a6d22d19b6c6bd),
+     W(0xa087e613fc77cd3e), W(0x4558e327b0b49bc7), W(0x188805becd835d35)},
+    {W(0x592f293cc1dc1007), W(0xfaee660f6af02b44), W(0x5bfbb3bf904035f2),
+     W(0xd7c9ae6079c07e70), W(0xc5287dd4234896c2), W(0xc4ce4523cb0e4121)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x04baa1762310333e), W(0xdc75e35f7b9bad46), W(0xc4a6031dc6cd6108),
+     W(0xba2534d030bf87a5), W(0x7ebc6e2131e497cc), W(0x8a2a82b4851fd665)},
+    {W(0x9ecae0116d5faf40), W(0xfa3a6d7f96956ecb), W(0x39e8a9c22fa52782),
+     W(0x74c93801236d442e), W(0x8b21ba23b1c289ce), W(0x7f3e221b25c769cf)},
+    0
+  },
+  {
+    {W(0x761e10e2ca114c4a), W(0xe39d121d894301b3), W(0xa0870ff43dbc6fca),
+     W(0x97651286cbe0ba8a), W(0x47d46075c0f1ff6a), W(0x18669c843abeb5b6)},
+    {W(0x1234c80ead8d9309), W(0x1ccbe4d51f6f97ff), W(0x399a2d41d82ab780),
+     W(0x8a03afafde426e50), W(0xa2bcb109ca6dde77), W(0x840e13b00618f5ec)},
+    0
+  },
+  {
+    {W(0x0d27500f9ebe3c40), W(0xeb9ac1022b700fcf), W(0xee7578f8610763e3),
+     W(0x6e56078f47ef08fe), W(0xa8d03a7f047d04c0), W(0x2143606f27cc8aa3)},
+    {W(0x6b08eb383b004721), W(0x1f505c0dc4e36bb6), W(0x6f9b869ae3f10ba9),
+     W(0x3bfb9833e500e846), W(0x6d975557b9171b1a), W(0x7af9cf4f18fa0045)},
+    0
+  },
+  {
+    {W(0x15d47e52ec645a62), W(0xabe0ddb38d6d4423), W(0x51226a3070cddb11),
+     W(0x63a253d32b5a8db7), W(0xe8be4d1fbef37d65), W(0x41e625d9c0920b91)},
+    {W(0x08b713a8d9d040ec), W(0x467fb08dc450cdba), W(0xa8975877917ee393),
+     W(0x294792e91528cd12), W(0x4512dc8c37daf6aa), W(0xa83becc9197a99b9)},
+    0
+  },
+  {
+    {W(0xcfebe027ca0a98d5), W(0x946b0d9aa8914697), W(0x00f89d16725ebd08),
+     W(0x94c6f2b07a584e8d), W(0x095ac9cc911cab58), W(0xfc9c3b499c4073c8)},
+    {W(0x265919b0c7233aa8), W(0xe6c0c7f474be5217), W(0x6db597f1815a70a9),
+     W(0xdd9e4a101c5fd35a), W(0x38b8e35112d52a8b), W(0x5d0ed83f2ef20fab)},
+    0
+  },
+  {
+    {W(0x3b21dc1f538d92d8), W(0xc80b22b3c005aa86), W(0xf536e5d30da87d65),
+     W(0x4ce10edf0cd999a0), W(0x8949181450e08f5d), W(0x77fd8f2e526647e6)},
+    {W(0xcb207ee9250099fd), W(0x03c7d1abfd6aa078), W(0x7d4940d225e0cf15),
+     W(0xb688b311067fa052), W(0x89308326a98b2e21), W(0x3ee4cc2b72311eab)},
+    0
+  },
+  {
+    {W(0x2a62804172fb61e9), W(0xa9bfa73ab13d053f), W(0x4a2cdaa3c647fcb9),
+     W(0xe1a9e91f4952d3a4), W(0xbc1b3d8011e2e2c3), W(0xe58ef59c18e4340e)},
+    {W(0xeb8696ff1cf859b8), W(0x5b0f5cc4ee918cf4), W(0xa471d6ce6c1e905c),
+     W(0x4e13d6091ed2e8cb), W(0x52951509c77c8c91), W(0x0926dad8e234884e)},
+    0
+  },
+  {
+    {W(0x37be5d3f68d7dfcf), W(0x97bdbd49b945e6f2), W(0x165a24b59d1569e7),
+     W(0x254aaf59b4e293ab), W(0x3c751fbd6fb7c0a4), W(0x14eda4ba5018cb18)},
+    {W(0xacb3b8971b5f6aed), W(0x6d10be441e4b6b78), W(0x245d7258621df6d7),
+     W(0x2af0e283185f0e2a), W(0x1e7edc818fddbd81), W(0xbd1e6c72c538d02a)},
+    0
+  },
+  {
+    {W(0x9d161de7564f3cf8), W(0x50197e2cc8874b33), W(0xfc5891ff6baf759e),
+     W(0xca66bc21ac16f9a1), W(0x71c2b5b6b386ac40), W(0x14c5393158725bb6)},
+    {W(0x688de57cbb89d731), W(0xf899746b4c04d6a8), W(0x8c50df2fab7ff8f5),
+     W(0xaecd3ce93c01ca7f), W(0x7458457a630a5325), W(0x91462c745543f8f3)},
+    0
+  },
+  {
+    {W(0x12014812aa006a4f), W(0xf84aa1a283374604), W(0x9f8475d90ee4a8ae),
+     W(0x37a1b21d135811df), W(0x341431711166af52), W(0x204dd449f5a33016)},
+    {W(0xc838d3d5372b6edd), W(0x314f30533987611c), W(0x819adbe0d112605c),
+     W(0x45da01aef6b32c5c), W(0x3deb30187e3b13a9), W(0x0e78a3a279058926)},
+    0
+  },
+  {
+    {W(0x494f8d09329263a9), W(0x02f6d5cb5368e128), W(0x5133f3be0b4c314a),
+     W(0x64577cd3c11cb3e2), W(0x467428011f752bd3), W(0xd94ad8c999749d7d)},
+    {W(0x26f11aa7184c2ef9), W(0xb8eec9db8a4c56b0), W(0x9b8a56bb4839c058),
+     W(0xe880c85940eceef5), W(0xa37c8bb63f85c437), W(0x01a06d10acfef243)},
+    0
+  },
+  {
+    {W(0xaab5f0c742adface), W(0x50d9f53fcb580132), W(0x68a3c689b5fd6ebf),
+     W(0xdea2f2ee9cde184a), W(0x8c174c4413a98466), W(0x8c4e2ae1cb4d921b)},
+    {W(0xba973c6c2d4c6d5a), W(0xc615071461d2ec5f), W(0x2aba1375666d8bf9),
+     W(0x2fa2768fd41272cd), W(0x49f3b8d7a0bc34bf), W(0x61118166ca45e5fc)},
+    0
+  },
+  {
+    {W(0xa6935bb70cd9f86e), W(0x9019561600e49b27), W(0xd762cf1dc4054a62),
+     W(0x053e230cc04717d7), W(0xcf6042b7eafb52ea), W(0x98d8582a068a05cf)},
+    {W(0x64598e9d84635a69), W(0x963b3d61dd32aa75), W(0x61ab60a78a463b4a),
+     W(0x7c84372cd57926f1), W(0x116698a5f63725e7), W(0x56f79c2f4e9cb5df)},
+    0
+  },
+  {
+    {W(0x92f565ea2665ae2e), W(0xaaa91acf1aefd472), W(0x3878c718fbb062aa),
+     W(0xde46e7d87de3c64d), W(0xff9900a4bd506a76), W(0x4e30ed723daa73b9)},
+    {W(0xd6be94467cbaff42), W(0x26fe63055dd691f4), W(0x64ef093c6d393800),
+     W(0x2448c67a7bb8f155), W(0x9da6e75fe5d732d7), W(0xe837a60250b080e0)},
+    0
+  },
+  {
+    {W(0xc2b190823af13ca7), W(0x72f48e36cf29bb38), W(0x99fbb567c2871fc0),
+     W(0xed27e10d21c9acba), W(0xf381ee2d864be12f), W(0x4e488d51c1155beb)},
+    {W(0x6232e74aafeb4cf6), W(0x1f5377e32c3a2041), W(0x4f0ee920f17330e6),
+     W(0x2024b51efba836b7), W(0xf5ce3a90dff637b6), W(0x050d96acffc50017)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6858b674844626a2), W(0x610cd40f0cbba6a6), W(0x324e674e29d9194d),
+     W(0x2dc6fdf6dcb30a51), W(0x3f3ecb77528aa549), W(0x0721f8f923ffaa92)},
+    {W(0xd8efcbd627a77538), W(0xf4e642bfd6162c9c), W(0x04f2b0b74cf4a16f),
+     W(0xbc0bb49fbbf335fd), W(0xc6b6e5bd5a928c36), W(0x981b01f4d893dd45)},
+    0
+  },
+  {
+    {W(0xfb083c2af810465b), W(0xb66a8de902ce0dee), W(0x6e4130e747a81b95),
+     W(0xcd704dc658a98737), W(0x842ae329592829c9), W(0x99bedc34be20dd63)},
+    {W(0xabee8e55d53b2df4), W(0x6ce657586010b37c), W(0x781f39b2467112b9),
+     W(0x6f06058fbe341038), W(0x5effdca512a2f8be), W(0xaa9bdad7af34466e)},
+    0
+  },
+  {
+    {W(0x3933b4c1575782aa), W(0x610d3ba25c66e501), W(0x52fd3c0f0b7e019d),
+     W(0x7f8e5ddfa48715d6), W(0x0879c5defa39be53), W(0xe32c886c56f01cdc)},
+    {W(0x71b2dcbb1726779c), W(0x6caaff052c6aa84c), W(0x6af94846640b2d74),
+     W(0x78a10710049a2cbe), W(0x41a1ce67ac2ab0f1), W(0xd160b7faa76d8438)},
+    0
+  },
+  {
+    {W(0xab86639e9c216137), W(0x45a12fb882b18d64), W(0xb5734418d763f0bb),
+     W(0xd2cc332211a9802c), W(0xe41d7db881269b8a), W(0x91072fc12ecfa355)},
+    {W(0x59d6912504ce306f), W(0x916d9d4da131b86d), W(0x84478b6b8a739738),
+     W(0xe86ad7d91cc83ae3), W(0xbc9b2084797ccd97), W(0xc1e94af4694944c6)},
+    0
+  },
+  {
+    {W(0xbbb6725b5c82c857), W(0x72c66c3f140b561e), W(0xab65dd0664bcb2d5),
+     W(0x755e848a780d5c1b), W(0x84e6f686a3a61e6e), W(0xd84bf486bd100b4b)},
+    {W(0xb34fdf846354e899), W(0xcbc312da55ec5654), W(0x3c2cc881f9a125f0),
+     W(0xb1fcce564aeadf8e), W(0xbdfc54c0c46bf0c2), W(0x11d7ea4f09d281be)},
+    0
+  },
+  {
+    {W(0xe1aa844b1601940e), W(0xd22221821797e84f), W(0x3025aba65ddcb5d1),
+     W(0xac8cdaba38009c6a), W(0xb9ee07b46e261ee5), W(0x84069bc106ab8430)},
+    {W(0x7a36b46278b9b112), W(0x2d91ed2c08e77879), W(0xae4ef469341275a1),
+     W(0xf7cb393f1c7cf858), W(0x83c00eafd192af3d), W(0xa81697a7a1e15176)},
+    0
+  },
+  {
+    {W(0x687d0980f9bfd795), W(0x9a7539377ad882bc), W(0x641407fabbcde5b3),
+     W(0x12ec9d216ed103a5), W(0xf858c7851fa6ee22), W(0x329b61bc818f2c11)},
+    {W(0x4720d42ad9d48b30), W(0x3f61c66082a66766), W(0x99aff25533723e4e),
+     W(0xd6c67ce3d3260b62), W(0x63a6fc9d86391c33), W(0xc002433a31de2381)},
+    0
+  },
+  {
+    {W(0x585edee3895c0318), W(0x775e142f45e8205b), W(0x3bd7924fd85ad31f),
+     W(0x2e7d8f919124bffa), W(0x885397c044c62868), W(0xc0c2dff47fda9f5d)},
+    {W(0xd302582ec14e693d), W(0x53d6e33a6cec31ba), W(0xb0216b5b63653c06),
+     W(0x8f08a1ad9c70dad4), W(0xccf014aaffbba93d), W(0x900b0d2ca33f12b7)},
+    0
+  },
+  {
+    {W(0x4960ccb6e9824c45), W(0x3c5a9b74c7e4cd06), W(0x1e78cdfe37cfec62),
+     W(0x8cd49ca80da56a05), W(0x5ba51217dca05707), W(0x0d1f6e459d66c960)},
+    {W(0x7178089467f9c82b), W(0x342e4a5b18974c55), W(0x16263f18f9b32fda),
+     W(0x844b5a02935b3636), W(0x9c5abd51c139ea58), W(0xf54c69428beef953)},
+    0
+  },
+  {
+    {W(0xbe51552d6d2dedd1), W(0x6bc86dc1cd997093), W(0xc9b600c4418f03b8),
+     W(0x4ea4e857e7a9208a), W(0x7aac3d96883b639b), W(0x4127ed0735d2f4bf)},
+    {W(0xf5f6310d76bd792a), W(0x3da9b6a5fa223d0c), W(0xd75f88075a041b79),
+     W(0xf3261457e4dd58f6), W(0x4f0f5b18b0d9a51b), W(0xf5aeedc1b8c84f9f)},
+    0
+  },
+  {
+    {W(0x1e08d6a81375620e), W(0xed9a4fbae1f62c24), W(0x0d3bb90381ab5de2),
+     W(0x885781f0df1b6a13), W(0xc3fb9f97e1c7de7e), W(0xf12e4bcf9372b033)},
+    {W(0x9bc3cf4dd5868448), W(0x89465649552016ad), W(0xeea40cf92a8b2c23),
+     W(0x57d720ee3af98886), W(0x97b14c0b72db853d), W(0x65d10f42f23504de)},
+    0
+  },
+  {
+    {W(0x0dd2395e9b8cfa41), W(0x50e203abd4f92a44), W(0x7280aff16630023b),
+     W(0xfcce59dc07de820e), W(0xa686be05bc8189ad), W(0xac4b59bfaac70b7e)},
+    {W(0xd2c0070e7a3c71ac), W(0x1d550add35ac1c47), W(0xd42b6389fb881c1b),
+     W(0x57ca3fccd0dafd42), W(0x909e8284be26ccc9), W(0x1abe7595a002235c)},
+    0
+  },
+  {
+    {W(0x02562f1c6b1878da), W(0x52a2cd069fce0ee6), W(0xf25b35bdeb16199a),
+     W(0x0320c326a75fb01e), W(0x2006d7587de2d46a), W(0x6f9d0e256842b459)},
+    {W(0x70a89562a68b5482), W(0x9653726e1ab35865), W(0xbda3cebbd8f849ad),
+     W(0xe2f8d9e60b6fc51d), W(0x9c3fd51246104400), W(0xbbd260c9bab5d34e)},
+    0
+  },
+  {
+    {W(0x1f5094703cbc1df1), W(0x9f752a663f962634), W(0x98089d2ca2435048),
+     W(0x05256acb0e755318), W(0x91a21f707f3845f4), W(0x473ac1e0d68c8fcf)},
+    {W(0x57ee51417f2ff0c9), W(0x959a84f32013c48b), W(0xe701f13c4c111ee5),
+     W(0x70219eee86db5763), W(0x385f890cdb0782e5), W(0x81fb64b2fea04d2e)},
+    0
+  },
+  {
+    {W(0x61b4bf7eeaa07bd9), W(0x49832879afe544c0), W(0xf788e97f54eb4d80),
+     W(0x78351b41338af327), W(0x3a631bba77cb8057), W(0xeb9a6f23f218e4ce)},
+    {W(0xbd4a0dcf025b6453), W(0x2aad6a467b876222), W(0xaee94361215c42cf),
+     W(0xf8d1fd5de496cdde), W(0x3c3af08022d0fe06), W(0xb3d5dde0d09cc3f7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1e34781aa6a1913d), W(0x9a8f32287d0adc38), W(0xfc185ccc28af85ba),
+     W(0xc923d78b3ae9ba11), W(0x7d494d7ea7bdb313), W(0xf774dfa5af8f8b87)},
+    {W(0xc178ccc116e863b8), W(0x2d472f2aa8899691), W(0x608747cc80a50372),
+     W(0x8147aa90e6f90197), W(0x4683d4c978c2f216), W(0x8323652c552f3b51)},
+    0
+  },
+  {
+    {W(0x29d81538037bebad), W(0x76e52c73d9e0b78c), W(0xaa4ace6e8783d1fd),
+     W(0x9c14ebddf0e3c126), W(0x0eb1c08d6eca4b71), W(0xd10c6b961c91df35)},
+    {W(0xdb8119bbe81bb84a), W(0xf784d3c117e3ceef), W(0x053c916835436f81),
+     W(0xeb41ccbb9b18d212), W(0x93b3fb43b1bc3497), W(0xd85a7c758c1ced81)},
+    0
+  },
+  {
+    {W(0x521f4af73ed03d5f), W(0xe3461f66eaf9064c), W(0xad099ab7ae03777f),
+     W(0x541cadcdb65f73ff), W(0x53430463a86059b9), W(0x8ff88fe5043e9f82)},
+    {W(0xd515f4c7e42cde45), W(0xf7f3dec3f41c3269), W(0x7bed53567ef1b8ff),
+     W(0x8782b45f1295b5fe), W(0xab54ebaa03917627), W(0x8516beb28787ed9f)},
+    0
+  },
+  {
+    {W(0x5255508c11c92f34), W(0x9a346cf3a294d382), W(0xd9765eea3095205b),
+     W(0xfea2ed702c470ef7), W(0xf5e8a0fc9c40bf0a), W(0xb572390ee4137a16)},
+    {W(0xb91753712bf2f545), W(0x2c2d0f4c58cd9cc7), W(0xbea6bce902385486),
+     W(0x46208408a8bc3a94), W(0x64a87a2a3ac45044), W(0xe40da33c7df70151)},
+    0
+  },
+  {
+    {W(0xc38d0727176213be), W(0xf348a582bbc7f937), W(0xabde1d8f300e953d),
+     W(0xb98b23d40a7dce63), W(0x63e51543fc425847), W(0x0b0520cd43a2161b)},
+    {W(0x2650a1d67f0180c1), W(0xcb77d8601af17815), W(0xc15db7048bd9bd77),
+     W(0xbad1dbadf89e86bd), W(0xd7d4845024579426), W(0xecf42bd9287bf5f8)},
+    0
+  },
+  {
+    {W(0x5fb0530402065087), W(0xf89b21bbfb73a972), W(0x7a0a0fa47d92132c),
+     W(0xe993faf8994564bf), W(0xbf3025251729e066), W(0x107f85efd4260574)},
+    {W(0xf1eecc3df133dfe8), W(0x12e36d7cd2531ef0), W(0x15fd1cf1d1dd8873),
+     W(0x7ce882a3b6f1aae1), W(0x7efb7ec6da9344b9), W(0x5caa4f19cc5b59ca)},
+    0
+  },
+  {
+    {W(0x8bcbf6ce3341e2bb), W(0x995730dc0d44678c), W(0x4ee8febf92ebe1bc),
+     W(0x784782919af24c2e), W(0x618760b094a861d5), W(0x64de20386bae27ec)},
+    {W(0x77c174bac7d9fbfc), W(0x3f1100bc8aa89b13), W(0xdb9e4f6a58a0062b),
+     W(0x3480c9b47781acd1), W(0x2d7c628ef56d86b0), W(0xe64c1ae9b3e2eef5)},
+    0
+  },
+  {
+    {W(0xee9e25d939161b8a), W(0x8763f2a2e2eead91), W(0xd2fc1157d2d91300),
+     W(0xe7597e2fffcbe50f), W(0x4be3814fe11d376e), W(0x1eab3d7edbf14562)},
+    {W(0x38a107c0c0ad183a), W(0x829766267c753bbf), W(0x18014e09caebd481),
+     W(0xb28c331bf9ace60d), W(0xe8fba04f211cb8e7), W(0x41c4b797e42dc65e)},
+    0
+  },
+  {
+    {W(0xc2b8f444ffdd4b9f), W(0xc0d3020d7ea86e32), W(0xcc4c95aab2884937),
+     W(0x23af7261208b2d43), W(0xedd29753dd383024), W(0xad48508fe06b5def)},
+    {W(0xcf6a84ba004811cc), W(0x3c1f08c71a2b6927), W(0x31a589b6ebc1bb81),
+     W(0x95791dfee7415802), W(0xc055abbe3813e770), W(0x125c86e9f1311b70)},
+    0
+  },
+  {
+    {W(0x42b2cfec88b7f446), W(0x29cf8ba3b23d849f), W(0x30195bf47b774318),
+     W(0x74201a6623cba876), W(0x68a93e94e95fcfec), W(0xd27b6e3f1a6e2fa9)},
+    {W(0x7980ad9fda0fe338), W(0xd647db4a71d61301), W(0x5ea9b12bd5a45838),
+     W(0xbc790bd3e5d8fc70), W(0xc0c171a4dd78b753), W(0x77a7d50b03b882ef)},
+    0
+  },
+  {
+    {W(0x7c1fbb18d4b48d5c), W(0x5aca6441d74c72a6), W(0x38f63631c73773ed),
+     W(0x0d4603be7acaf5cc), W(0x12cf217800f6d413), W(0x15e00446aa737ba1)},
+    {W(0xca49b8711e06b8a9), W(0xb4178b271c72a110), W(0x7b44d931ffd1bd0d),
+     W(0x554d16c20497daa5), W(0x3a7abadd80868454), W(0x4f86d469723153e3)},
+    0
+  },
+  {
+    {W(0x6b57de875ce04aa0), W(0xbf2490cf17852365), W(0xa3a3539e74ddaea4),
+     W(0x355b5724a8d14c7d), W(0x11d3fa817c3a98c7), W(0x882d426384daf4ea)},
+    {W(0x670585b9c74a9f4e), W(0x7dc6e2125e6260da), W(0xd9635188308b3720),
+     W(0xa92b3d42b3baee4b), W(0xd802f137aeb4a1ff), W(0x2d76fea5a00ad143)},
+    0
+  },
+  {
+    {W(0xbda03349d675e8db), W(0xb299fe04c8da2f7d), W(0xa14cd11ca3902d64),
+     W(0x77b8331019df5cfa), W(0x8b7fdfe8d99c081e), W(0x1168e7caf7c0e42c)},
+    {W(0x33e18714b0fc16f3), W(0x8c914e34b1543b54), W(0x900baccfd0915abd),
+     W(0xdf3ce427c87ab7bc), W(0x0ddf6705cc44994c), W(0x51bf3fb669ff2d51)},
+    0
+  },
+  {
+    {W(0x4bd67c4f83741146), W(0xe8dcb9b520684c6f), W(0xe05eeb6bf514d735),
+     W(0x14d273c6f28e79bd), W(0xb1106fe6306a05dd), W(0x791c4ea1d1e970e2)},
+    {W(0xec3dfa0ef640e92e), W(0x367c8aee2d4ba8cf), W(0x27a89fa516065414),
+     W(0x2ed9f329cb0f0451), W(0x65925d5f5138c1d2), W(0x53016e982b330d15)},
+    0
+  },
+  {
+    {W(0x8330297d15ac48ae), W(0x75917cd9bdf67658), W(0x5dc2b47c18f937a6),
+     W(0x3efafcacf95abdf6), W(0x3097f3b78ed0aaf8), W(0xa52da2662912d10d)},
+    {W(0x09b2bea9a4020b6c), W(0x737b640c8c46e402), W(0x225b52ec22e9729c),
+     W(0xc1d1fb6407a4d84c), W(0x14bf9e2323724766), W(0x80593bf755bae90c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x009dc2f4c3e88580), W(0x4a405be899db1fb5), W(0xc89bfaa2ec5d91fe),
+     W(0x461be9a0f160afcb), W(0xfdd084bb7d7566b5), W(0x795275e8e48099a2)},
+    {W(0x1b461fc9fe9815db), W(0x576214cd73627bbc), W(0x3246332d9f09a206),
+     W(0xbde4c0c36941d6ef), W(0x44ef03fdf387f5f6), W(0x99c8ac0157b63400)},
+    0
+  },
+  {
+    {W(0x7e4851599598f49a), W(0xbdac3d5e9629305b), W(0x20de0dafa6fbabfb),
+     W(0x04f015838f09fff7), W(0x5a0562976a06994f), W(0xf51dac8f6e3ccd33)},
+    {W(0xc087ef9c3af507b8), W(0x525ab76e6a5c6663), W(0x4fc04814d916ee93),
+     W(0x3369c978d23d140b), W(0xb0fcd70f1662028f), W(0x2ca77de2e1e28adb)},
+    0
+  },
+  {
+    {W(0xe3ccfe8e37627e56), W(0x00733a867b6b21a6), W(0x3f13e2cbb605c427),
+     W(0x5ee12395b0d80992), W(0x4dcaea94b9991381), W(0x4cfed7ee8c4c4b6e)},
+    {W(0xd7aad54b7f7f45df), W(0x2229407fb3809bf8), W(0x6eb31eee68048fd9),
+     W(0x693842dfd57225fc), W(0x3e62cd85a88dfd3f), W(0xc6307d53d5462cf1)},
+    0
+  },
+  {
+    {W(0x99b5f150493c1d64), W(0x3422b656fb74075e), W(0xe7493900ff19bf24),
+     W(0xc82e5b80260925ed), W(0x3398d340c0ea1eaf), W(0xe7de2ba11287121e)},
+    {W(0xea6dfb0b87847031), W(0x73bed0a1566af2f2), W(0xe26678bf12012999),
+     W(0xb5369e4d32e5cebc), W(0x2304eac86d181e32), W(0xafdbd9543d364add)},
+    0
+  },
+  {
+    {W(0xf55f868e702f640d), W(0xe459aa9b1dedda11), W(0xbec0ff9bbb5ba193),
+     W(0xf7325c4957724703), W(0x5ab8f06323e0e4fb), W(0xfbf02e91ecb0fd7c)},
+    {W(0xcc72e8daa2e5fa31), W(0x47de252832cb53cf), W(0xbfa646e64252763c),
+     W(0x7a769efeb8d81de3), W(0xf5ec70031e772f00), W(0x049bea9a2729aa5e)},
+    0
+  },
+  {
+    {W(0x51f19bb3fda072db), W(0xa815459fe3f7e0a2), W(0x5f7cde2f987112ca),
+     W(0xdc51d948759de2cb), W(0x9d05c410ed49bd98), W(0xf063ab99364341fd)},
+    {W(0xd7869d68d1aa0a11), W(0xc20291065d862d01), W(0x7f258180c2591073),
+     W(0x7b90fc7a6ebc4ebc), W(0x5565390f3dda1d68), W(0xae77fca8a44e4493)},
+    0
+  },
+  {
+    {W(0xb4a2742dcfd9295e), W(0x9cd36774ae929cd0), W(0xb15fadccdd7fcf4f),
+     W(0x0b1fa2b337d4fcc6), W(0x242c7b26f01c7ab7), W(0x2be8131b50574cc9)},
+    {W(0x6ee50f42bd89a03c), W(0xc7f6ff8f005e7765), W(0x04d13af18420501b),
+     W(0xc22e092b1b6e7d2a), W(0xa393be7ee9516f80), W(0xa2593652b80bb5b5)},
+    0
+  },
+  {
+    {W(0x9e41b9b70f74808f), W(0x2d835dae0c061bdb), W(0x67e50c8cf272346c),
+     W(0xc98a5ef5def57493), W(0xc2dea8afa02676fc), W(0x59508de26ace4659)},
+    {W(0xc2b707aada6cd733), W(0x6c1f226a4be7bfb9), W(0x5b580fa2a778c20b),
+     W(0x272c3a1d57af166b), W(0xe47a64a9ca78ce62), W(0xd12db7d771d35087)},
+    0
+  },
+  {
+    {W(0x2f4abaff356f4ca1), W(0xa2e419422d13be2b), W(0x58d72e2f3d7db731),
+     W(0xafc2f505cd455649), W(0x8a0794cd1583705c), W(0x4a43066288ffe8e7)},
+    {W(0x2c0c031d135c8e7c), W(0x8ecd9ed76b371b41), W(0x17cc1ad9563843ea),
+     W(0x9603987cfc6b810f), W(0x6e291ed7f0d9498d), W(0x8c69ae62e1a4058d)},
+    0
+  },
+  {
+    {W(0xe14dd3708ba8a3df), W(0x49c1fc3750a645b6), W(0x3f0db6a32252ff87),
+     W(0xea2ac3c4a34ad040), W(0x97a37936decf9f0f), W(0x810f02326f7f92ff)},
+    {W(0xd96c2641184e9c88), W(0x08c4cd333d5ab12e), W(0xa938d8c3eda80fdf),
+     W(0xf2dded68bfccc054), W(0x4b3da61ede36ac9c), W(0x2c266df8347ef904)},
+    0
+  },
+  {
+    {W(0x88eac51c8e376fe4), W(0x096e70c49ef465b6), W(0xb35265852004969e),
+     W(0xbd581669d29cc63d), W(0x88094298745b6919), W(0x317e386c12e7d67f)},
+    {W(0x33848bb2e3d6f4da), W(0xbace887f2a0ca785), W(0x83b32feb197e67a7),
+     W(0x2b58535ade9c851b), W(0x3e428b19c38beaa9), W(0x784aa3d174f26de1)},
+    0
+  },
+  {
+    {W(0x98c3a697c0909659), W(0x35c3b0f297d847ae), W(0x67d9f71273a7a5a8),
+     W(0x28e83651b47bed08), W(0xfca9e849567b3410), W(0x5fa9a6ded291fe1f)},
+    {W(0xd79682421976a995), W(0xcff5bb36a0261383), W(0x34166ef962e9922b),
+     W(0xd816b0342d433139), W(0x3b62d3589c4b99c3), W(0x8521f917104f7cc4)},
+    0
+  },
+  {
+    {W(0x7761d8fc6f7b6eaf), W(0xdc439bfdcc0575e5), W(0x33853d91f1ff4383),
+     W(0x6da20e4b75dc1254), W(0x25a53b581969a1d3), W(0xb40df56723311968)},
+    {W(0xac150a297dd6aaeb), W(0xfe6865ce2a3ba337), W(0xea05d97cf71013fe),
+     W(0x0ab3cf008053c65a), W(0x7cd38b647bab4869), W(0x788cb867204cc6a5)},
+    0
+  },
+  {
+    {W(0x52732a0a4b0fc112), W(0xe654744e9d125ddd), W(0x9f76cf7e269beee7),
+     W(0x2fb8bf32ff80a2f0), W(0x1bcef16262b7153b), W(0xdedc255a43a4201e)},
+    {W(0xb1b30b91acbd8a37), W(0x147fae6f240adc8f), W(0x5558702cb39bf39b),
+     W(0x171e58803e1eb997), W(0x095bf301ed7c79b4), W(0x29f1dbffeef752f4)},
+    0
+  },
+  {
+    {W(0xaf8ca08b20492da0), W(0x37b1fa1547508667), W(0xc9fc925b96077958),
+     W(0xb78c83c19ecac8b4), W(0xd9d953a17c05a67f), W(0x970ee229b9ebcaaa)},
+    {W(0x689cad7f55dc989e), W(0xf02f05bc66c941fc), W(0x8d00516281e23d8b),
+     W(0xfe603ffc8caebcc3), W(0x592860bff303153b), W(0x9ec1d5ab3344e524)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc20fb9111a42e5e7), W(0x075a678b81d12863), W(0x12bcbc6a5cc0aa89),
+     W(0x5279c6ab4fb9f01e), W(0xbc8e178911ae1b89), W(0xae74a706c290003c)},
+    {W(0x9949d6ec79df3f45), W(0xba18e26296c8d37f), W(0x68de6ee2dd2275bf),
+     W(0xa9e4fff8c419f1d5), W(0xbc759ca4a52b5a40), W(0xff18cbd863b0996d)},
+    0
+  },
+  {
+    {W(0xf6827150844eefc5), W(0x002e82c44515ef68), W(0xa46c8f55c51916c4),
+     W(0x98c3524b61ee081f), W(0x5ab7f2c2ad64872a), W(0x0b503ff07e555faa)},
+    {W(0x802e0d23b4c58d29), W(0x122890402fd917fe), W(0xb56d19087af20d26),
+     W(0x8d619e216be50784), W(0x10fdbb721372b851), W(0xf2c1673e4935576e)},
+    0
+  },
+  {
+    {W(0x73c57fded7dd47e5), W(0xb0fe5479d49a7f5d), W(0xd25c71f1cfb9821e),
+     W(0x9427e209cf6a1d68), W(0xbf3c3916acd24e64), W(0x7e9f5583bda7b8b5)},
+    {W(0xe7c5f7c8cf971e11), W(0xec16d5d73c7f035e), W(0x818dc472e66b277c),
+     W(0x4413fd47b2816f1e), W(0x40f262af48383c6d), W(0xfb0575844f190537)},
+    0
+  },
+  {
+    {W(0xd97a9b1451a135f6), W(0x6d16aaf597b4df14), W(0xc57160c254818818),
+     W(0x4dbdeab61d59be44), W(0xb93a9dad81f2b247), W(0xe2868cf5ecbcab33)},
+    {W(0x5e1ce82883a86711), W(0x29a9ca2f29c55428), W(0xe716273a2d82b0df),
+     W(0xb017f5f6ac8ff52f), W(0x7563e79970ea7ccd), W(0x5fedf0a63f0e674b)},
+    0
+  },
+  {
+    {W(0x487edc0708962f6b), W(0x6002f1e7190a7e55), W(0x7fc62bea10fdba0c),
+     W(0xc836bbc52c3dbf33), W(0x4fdfb5c34f7d2a46), W(0x824654dedca0df71)},
+    {W(0x30a076760c23902b), W(0x7f1ebb9377fbbf37), W(0xd307d49dfacc13db),
+     W(0x148d673aae1a261a), W(0xe008f95b52d98650), W(0xc76144409f558fde)},
+    0
+  },
+  {
+    {W(0xd084564baf907da2), W(0x5b2ae48751d4997a), W(0x24bd4bf63bc7206d),
+     W(0xdd37b4effc3d5772), W(0x8156d6f635c4924f), W(0x21e067c31d1d396e)},
+    {W(0x977b3b39d40c7db8), W(0x7ea4ecb4f5ad63bc), W(0xe581f9c4ae811d70),
+     W(0xe5441d5ca06c7f0d), W(0x0275c92b1949d87f), W(0x511fd3e1780469bb)},
+    0
+  },
+  {
+    {W(0x17cd6af69cb16650), W(0x86cc27c169f4eebe), W(0x7e495b1d78822432),
+     W(0xfed338e31b974525), W(0x527743d386f3ce21), W(0x87948ad3b515c896)},
+    {W(0x9fde7039b17f2fb8), W(0xa2fa9a5fd9b89d96), W(0x5d46600b36ff74dc),
+     W(0x8ea74b048302c3c9), W(0xd560f570f744b5eb), W(0xc921023bfe762402)},
+    0
+  },
+  {
+    {W(0xa7f8501488d7b3fb), W(0x3b5ec513ec78386e), W(0xc6586b8a2ad5053d),
+     W(0x88c09a43fbcebe43), W(0xde7f2a4a20054f16), W(0x63daba80bbbb147f)},
+    {W(0x087e48f37d352b55), W(0x997e32a08317ab79), W(0x8ae802ff7f27cac7),
+     W(0xb01a131c37b1f6e1), W(0x3f0d4c2e9a6d1dea), W(0xe06114fce7ceef80)},
+    0
+  },
+  {
+    {W(0xa35ab657fff4c8ed), W(0x017c61248a5fabd7), W(0x5646302509acda28),
+     W(0x6038d36114cf238a), W(0x1428b1b6af1b9f07), W(0x5827ff447482e95c)},
+    {W(0xcb997e18780ff362), W(0x2b89d702e0bcac1e), W(0xc632a0b5a837ddc8),
+     W(0xf3efcf1f59762647), W(0xe9ba309a38b0d60a), W(0x05deabdd20b5fb37)},
+    0
+  },
+  {
+    {W(0x1e2a4fb1e5ea795b), W(0x862616a289ef6c3d), W(0x24617f4ff69e2f1d),
+     W(0xe0be24feffa0eb28), W(0x0ffb092f4b76a8ad), W(0x215490903a0dc9e8)},
+    {W(0xf255fe06e9080e04), W(0xd270d25e39228e7f), W(0x198e45db5d6c6f1c),
+     W(0x6c9060ad4373044c), W(0x3af9346461a8cc25), W(0x1945bf59f22bbaa3)},
+    0
+  },
+  {
+    {W(0xd44e5dbacb8af047), W(0x15400cb4943cfe82), W(0xdbd695759df88b67),
+     W(0x8299db2bb2405a7d), W(0x46e3bf770b1d80cd), W(0xc50cf66ce82ba3d9)},
+    {W(0xb2910a07f2f747a9), W(0xf6b669db5adc89c1), W(0x3b5ef1a09052b081),
+     W(0x0f5d5ed3b594ace2), W(0xda30b8d5d5f01320), W(0x0d688c5eaafcd58f)},
+    0
+  },
+  {
+    {W(0x311df84c359590bf), W(0xf907d69ddf6ca4b4), W(0x876fd36782f22c64),
+     W(0x64c4d14d9713e68c), W(0xd431858d6b07f539), W(0x39dfea3384990283)},
+    {W(0x6afb8cf080cf6498), W(0x327056bcde060e9e), W(0x5103ce4a49a71086),
+     W(0xfc94be75cdf853ab), W(0x2bfb105f8ca579cd), W(0x02d19c3a50454b41)},
+    0
+  },
+  {
+    {W(0x5eee3a312a161074), W(0x6baaae56efe2be37), W(0xf9787f61e3d78698),
+     W(0xc6836b2650630a30), W(0x7445b85d1445def1), W(0xd72016a2d568a6a5)},
+    {W(0x9dd6f533e355614f), W(0x637e7e5f91e04588), W(0x42e142f3b9fb1391),
+     W(0x0d07c05c41afe5da), W(0xd7cd25c81394edf1), W(0xebe6a0fcb99288ee)},
+    0
+  },
+  {
+    {W(0xd9e2c5ee7d4867b7), W(0x2c5602e087873152), W(0xb3358aa62c06b73a),
+     W(0x967aec3909063076), W(0x94dec534d2f654fc), W(0x119aa4edd69f485e)},
+    {W(0xb7c597b835bc085d), W(0x8781396dbdbe0d0c), W(0xba68892922f92ef5),
+     W(0xeece3d4ed438f5ec), W(0x4ead06f844faac8b), W(0x86a01ba99ef7c5f1)},
+    0
+  },
+  {
+    {W(0xb8e63b7bbabbad86), W(0x63226a9f90d66766), W(0x263818365cf26666),
+     W(0xccbd142d4cadd0bf), W(0xa070965e9ac29470), W(0x6bdca26025ff23ed)},
+    {W(0xd4e00fd487dca7b3), W(0xa50978339e0e8734), W(0xf73f162e048173a4),
+     W(0xd23f91969c3c2fa2), W(0x9ab98b45e4ac397a), W(0x2baa0300543f2d4b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xaa03b474cde121c7), W(0x74a648cb55e52c76), W(0xb286ef86f37b57bc),
+     W(0x95b797eb2a6371d2), W(0xa489ef894077ccbd), W(0xf46ade048e99ca6d)},
+    {W(0x5cf9e23723242d03), W(0x33c7d32acb708390), W(0x329523b6ba7ba477),
+     W(0xd406ab8757de30bf), W(0xaa10e4a21536ca01), W(0xdcec94f4dfa7aac5)},
+    0
+  },
+  {
+    {W(0x762a5eec1f5a9609), W(0xfe4f5f6a765b337f), W(0x0fd534aeaa4f964a),
+     W(0xcf46648ed6526f01), W(0xbc62a54a18d71d72), W(0x48d94f2a4f8488ea)},
+    {W(0x62c40de7a0c72a86), W(0xd73ac51a725dd2ef), W(0x3a51d7466ab19096),
+     W(0xf07bea4b2dd1ad3d), W(0x2a0ec4672ef88078), W(0x92598cb3664e435d)},
+    0
+  },
+  {
+    {W(0x17c563be1cac0b58), W(0x889cfcecb8491347), W(0x591d49ac4cd1bfc0),
+     W(0xd4465510d4e53d3b), W(0xca95ccf6ad079a6e), W(0xce391389b5ea6eb4)},
+    {W(0x600ccc9ca48b6447), W(0x20d0c7dbc20d56a8), W(0x5f27edc569c6c6e7),
+     W(0xb3fc0f4a586abcdc), W(0xdbfdf3f985dbc5b6), W(0xfba1cf254ea80fe0)},
+    0
+  },
+  {
+    {W(0xee6e7006b515fff5), W(0xaedf6e3913258ed5), W(0x373adf7dfc45111b),
+     W(0x0c7535b1875c23c8), W(0x2a7e04f897039d49), W(0xd76787ae9afd1a06)},
+    {W(0x049dd38591b6dc89), W(0x8f0c8ad0932dab78), W(0xdce057b9925498c2),
+     W(0x7b9c9bd2da25daa3), W(0x6d0b70a3d4decb7d), W(0x099a218303df76ef)},
+    0
+  },
+  {
+    {W(0xff54e8bc8acd597b), W(0xdae781e94682b8c6), W(0xb2265bc4ed1fae2d),
+     W(0xa5e23c29ea983db1), W(0x4af5f55909851454), W(0xffe9538836eb4506)},
+    {W(0x4c72b2d1c2247b8f), W(0xb179573331a67505), W(0xb1aa8ad4e19c9c25),
+     W(0xb9cfea953e8b8004), W(0x07782d788ac747fd), W(0xe23e547fce9d9e41)},
+    0
+  },
+  {
+    {W(0x779905b6d8948f95), W(0x3c7085b591cd0206), W(0xce9af0aa679096db),
+     W(0xfdf04f10f558913c), W(0x05300cb06f24a2e2), W(0xf9d9a2f25d581b35)},
+    {W(0x855c8de96a713751), W(0xc9ac24bc0e0c0dfb), W(0x67612a4197740d65),
+     W(0x7588a52744c9360d), W(0x928ac910325cc880), W(0xa74abdafacdd3188)},
+    0
+  },
+  {
+    {W(0x3774af36ba6aca8a), W(0x562fcfb1340e6a03), W(0xde45205ec1187539),
+     W(0xf3b114418799c22e), W(0xfd53f681e8b0842e), W(0x45a0039066d36d64)},
+    {W(0xa2c3391d353eb1e7), W(0xf9d9fcc55840edda), W(0x4df1fa4a6ab8ab4a),
+     W(0x2b0cd34bd841a623), W(0x52441d79b10b189a), W(0xfd86d3c2fa025da7)},
+    0
+  },
+  {
+    {W(0x3c6c5618b9d926c2), W(0x7e14c3ae4a9099f9), W(0xb3259c90ae2fb830),
+     W(0xf7cc6e43ec31a504), W(0x83bb13c6126230bd), W(0x5a1f4313ff1dae3a)},
+    {W(0x0cc6c1a549b0b65b), W(0x67fa836a274a84c2), W(0xd454c75fe604a58d),
+     W(0xceadfd912491f872), W(0x6c5575da9ce116a5), W(0xfaa4903fb24a4481)},
+    0
+  },
+  {
+    {W(0x9b21ef6c16cdcfea), W(0x233be0c3694edecf), W(0x110243df7c49c931),
+     W(0x03a59a2ea3113ed1), W(0x6470f721023c9a77), W(0x7d1640c88e9ff099)},
+    {W(0xc21488316f2c7b37), W(0x9e1c9e1dac6eebc7), W(0x6af65a671109ca9c),
+     W(0x8379fdd9cc6f80d9), W(0x33f74ade7e666a4f), W(0x07ac728b7be081a5)},
+    0
+  },
+  {
+    {W(0x7a8a898d5a4703aa), W(0xc59933ea1cd6f9d6), W(0x703265f5d28124cd),
+     W(0xe1c1bee10178d1fe), W(0x9ff31cd4241262e9), W(0x9174a939a3c9f80f)},
+    {W(0x0f7a3d2dbc2a62ee), W(0x0454051c62f1b3ac), W(0x83502c9ea2421254),
+     W(0xb4fa51fcb684199b), W(0x257e9e2bc5e36a44), W(0x14efeed597d8647f)},
+    0
+  },
+  {
+    {W(0xfdb13b31be970eba), W(0x119b1c08b0bfadc2), W(0xed62f35e21875542),
+     W(0x73c8f9b0349a6d12), W(0x8c35d8f8bd1622c0), W(0x501b9d288b6521a0)},
+    {W(0x377f8fa1c918b2d5), W(0xe2a9580cd0239ef9), W(0xee24f4f0371d7beb),
+     W(0x4cc697a669231b47), W(0xa55193c8dc4c5a07), W(0xd4e51e1db0ab8507)},
+    0
+  },
+  {
+    {W(0x6e96a8195cecb21f), W(0x3a58d8b2d8beecae), W(0x93c3cbb0c0c715a8),
+     W(0xfb06f977541759b7), W(0xf25ba095771c3d2c), W(0x7560446ea3bfd322)},
+    {W(0x7cd99f35a015cb4f), W(0xa0e541960786f235), W(0x0f868f768b8e291a),
+     W(0xc8260b0b2f95050b), W(0xaf38376ef4c0a462), W(0x2b3c0f3b98a3395d)},
+    0
+  },
+  {
+    {W(0xbb5a95f6293cc00f), W(0xb202a82a65fb729e), W(0x819c26aa12e35774),
+     W(0x70cd5237c2b3f0b2), W(0xa752224a89b2c5cc), W(0x71c09cbd0ec89df5)},
+    {W(0xb849e352bab45d24), W(0x290f0307d313f461), W(0xf083031cee885e9d),
+     W(0xdf42a973a60bf2fa), W(0xe39f2118d4842999), W(0x8b54cf1d0508febe)},
+    0
+  },
+  {
+    {W(0x0952b888b9d0bdf0), W(0x3973763c8ce32fb7), W(0x221f0ba56dd860c7),
+     W(0xbb7a27feb16ac501), W(0xf113b194bc8fe58f), W(0x18f3297a65839ffb)},
+    {W(0xa2d4eb7c8dc30003), W(0x3fb4b4878e334479), W(0xa4f32c651a8310e3),
+     W(0x944cd644f78f46ac), W(0x14e40c4af96fb91f), W(0xc31402bd4ddf6e72)},
+    0
+  },
+  {
+    {W(0xdb2a2ac9a63f6f62), W(0x4c0d2da695f20639), W(0xa485a6adb475e177),
+     W(0xf6dad8b5aa93055f), W(0xafcc1e954974bc52), W(0x6686940224fcf32f)},
+    {W(0x10c138bfc103b013), W(0xe74ea82bc6faba1b), W(0xddb399c581824de5),
+     W(0xae797b70cdaad079), W(0xc648e7ad6ea955e2), W(0xd07c5c919be79db6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc5ad791eb45a8002), W(0x4a23fd68ba2d7a40), W(0x673b9e4998544bc4),
+     W(0x934d8f55d273c360), W(0x7fb48d0768a75a8c), W(0x2e6201055e0fac97)},
+    {W(0xbe01655ff10ed580), W(0xd21d52ae9e96731f), W(0x74f830de53325138),
+     W(0xa7240331de9f3fc5), W(0x96b25206a7e01fa5), W(0x3fcfedee07eda4b4)},
+    0
+  },
+  {
+    {W(0x3e6e93818d5c039f), W(0x809494228a8d2cc9), W(0xf2d7c8b4b843ec06),
+     W(0x0055d882af8a23f1), W(0xe848010ed3792335), W(0x9b41a55f55e08e74)},
+    {W(0x956ea8e95de83059), W(0xf159a9973263678e), W(0x5f7b9271cca1b548),
+     W(0xd41d2281f1d0b7f1), W(0xb187047b5c9963fb), W(0x213ff6af02536cd8)},
+    0
+  },
+  {
+    {W(0x7138a03f5b5a9e16), W(0x68b928abc6748de5), W(0xa29c41fd2a7cbcc1),
+     W(0x60143495f6073ecb), W(0x98b46d380504fa08), W(0x10008718401f9532)},
+    {W(0x08cc4abc7b65d335), W(0x9d8e6d2f2e5e6eb2), W(0x6eb2c8faa75d9af1),
+     W(0x6f50198fc2e5592d), W(0x773b9d55c0468e66), W(0x178aa1e61a2a9fc3)},
+    0
+  },
+  {
+    {W(0xe51a95700d0fa76c), W(0x67c7890e4d2e9c8e), W(0xc6160fa2f974d2cb),
+     W(0xe00474f74c6a78de), W(0xee916e510ac89d11), W(0x1adad97af826f133)},
+    {W(0x3fc65d3f8d2d77f3), W(0xda9420750ba6c300), W(0x5237a82e0b9196b1),
+     W(0x4975e680a572b6f5), W(0x41ea8b92b9bed2bc), W(0xbe0ad7109826825e)},
+    0
+  },
+  {
+    {W(0xe352fb9cd58599d4), W(0x01796885eb1fb827), W(0xf9ffce6fafcb7de1),
+     W(0x0e574cf4f694cad0), W(0xadb4671cb761d611), W(0xbf39d0d3c8aa05d8)},
+    {W(0x87cd7873887da2be), W(0x87f808f82cc52e63), W(0x1c41531ec2cb43e1),
+     W(0x62fc3104b9e6b89f), W(0x7f406a0dc4e5d4d2), W(0xa9127846df3f61dd)},
+    0
+  },
+  {
+    {W(0x06f721d30a9ec81f), W(0xf0359222034f3e78), W(0xc5ca6b7a5a44ffd9),
+     W(0xc53e328915764390), W(0x7f16917459747d7d), W(0xc3a9981461f79122)},
+    {W(0x099f4e3a97aa46f7), W(0xcb0570c9d70458a6), W(0x270a43576b72f327),
+     W(0x9d6bb26cc33695bd), W(0x60f9202126224902), W(0x8eb0e108e1b0a51f)},
+    0
+  },
+  {
+    {W(0x265d4eff3cff2fb8), W(0x042d5b43ab72a903), W(0xc3995c996be6ce25),
+     W(0x6fd43e596b6056ee), W(0xd328c28f28a00726), W(0x3cd33783f719afb1)},
+    {W(0x75dcabd32dd1d2ee), W(0x526685004e451137), W(0x67c6a522d764ab7e),
+     W(0x9458c96dcf8a4872), W(0xaf1af61b78810a44), W(0x3462b4c473902786)},
+    0
+  },
+  {
+    {W(0x8a390dca9fcaba39), W(0x3879f0b4278d22b3), W(0x77bbea69bc5e82f1),
+     W(0x71f02e2d4628d6f1), W(0x6260790cf968e240), W(0x1c7f3df5665270ee)},
+    {W(0x336395451a87b1c8), W(0x2011fd214ffd9fb8), W(0x69060f867807ed55),
+     W(0x1b0ac0119dfa452c), W(0xbbdb25fe06d27c0d), W(0x5c25d23aa60ef90c)},
+    0
+  },
+  {
+    {W(0xd4453acf990cc170), W(0x31ad47d69c5c5233), W(0x84ddf8178d247a2a),
+     W(0x4453575fc516719a), W(0x2cad79f48e31edab), W(0x459b1f5ccb4d9930)},
+    {W(0x3fc0cfa71eaeb4c2), W(0x363e219358fddac6), W(0x0d48f5ca9a057836),
+     W(0xd4a25e16e679097c), W(0x6c65c5e194a1597a), W(0x10f2dd614bb89bf8)},
+    0
+  },
+  {
+    {W(0xc08dc153d9f75d6b), W(0x5c1f07e7a0330237), W(0xb3e6fb677d67a5c9),
+     W(0xca949ed098f9fadd), W(0x48b16b2dd7720835), W(0xfdb1b735fee4d341)},
+    {W(0x1a6b37b1debf3207), W(0x5b3eeb1e3218c63a), W(0xc19b57b504c23b30),
+     W(0x178bd3bb40669e2d), W(0x74e57b26fb6b162c), W(0xc3626931a0932b58)},
+    0
+  },
+  {
+    {W(0x30d0bc4661fc6147), W(0x96133904eaa065e5), W(0xfda444e6e5cbcc30),
+     W(0xbd03bbd11e36888a), W(0x032e45753d97b0a4), W(0xdf42ae56c6ee1398)},
+    {W(0xb96518834e60f314), W(0xfd9920016e17356b), W(0xd663898ea4ecdbc6),
+     W(0xb2038ff91da3c968), W(0xe83359720f8bace8), W(0xcd1268d60ae3ace2)},
+    0
+  },
+  {
+    {W(0xd3eb69e4734b2e9c), W(0x1c2754e2c35ff1b3), W(0xa26681e69f3e8c51),
+     W(0x7892ad11a2cae737), W(0x88b1da43cbd8bda6), W(0x8a576942419d21c4)},
+    {W(0x7c124343c90f4545), W(0xa5a8d93b26453bae), W(0x9a4c08fd76ae72e8),
+     W(0xa08b82d97b064e94), W(0x4f803ba083725330), W(0x33672455865235f3)},
+    0
+  },
+  {
+    {W(0xa1b4609464cab4e3), W(0xf8878eb15e8075fc), W(0xf1c49b970d7d978a),
+     W(0x83b3d34d339ad99f), W(0xa8b4aa60de646582), W(0x6dcf4dec68f1561c)},
+    {W(0xac11dcf9c8b9abca), W(0xd3fdff1f63152fd3), W(0x3d55e73ddf380bba),
+     W(0xe3e3c0960f5e897b), W(0x2211518946ce08c3), W(0xf163061c4cc77014)},
+    0
+  },
+  {
+    {W(0xf7a5e2f0a51e695f), W(0x3099bf9484adf10b), W(0xb2a03c0f22a3ff04),
+     W(0x30303a910acec674), W(0xaccb2f3ca59522f8), W(0x00ff4d88f273ba94)},
+    {W(0xf0056b4210e735eb), W(0x3337279a7786e93b), W(0xfecc77c44bb3c31d),
+     W(0x3385bf5be0e26a05), W(0xa9454ab85f45fcbf), W(0x41a4158346edb553)},
+    0
+  },
+  {
+    {W(0x792aef49738dd72e), W(0x65220ab65299793e), W(0xfb01506d7e682cba),
+     W(0x73ade87aa23a4b56), W(0x695a1babe4cba1f7), W(0x7a0cdd74f0d4a1b2)},
+    {W(0x2b5e4b9718e0a6ad), W(0x3b6194f32492749d), W(0xe5ed98d4dafd286d),
+     W(0x3e5ecfc88d6d99ce), W(0xb123ce4a1bfb9798), W(0xd5daf5431df6db6d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1877dfd0c8110f1f), W(0xea88f59d18db27c2), W(0x9d089536c78e295e),
+     W(0xcbb5d55374a04cc5), W(0xe3666006827f75ed), W(0x8557b81a61e7378c)},
+    {W(0x74170170ed223f48), W(0x84197a6ed86ee829), W(0xd75a30f8ac1c4a0f),
+     W(0xd7e7be0d3cd92824), W(0x5ea0abdb1b5e86d4), W(0x41146ae1b3b615ef)},
+    0
+  },
+  {
+    {W(0x618ca06b8956146c), W(0xd51f1e6f552cdecf), W(0x981372cca3b6ce7d),
+     W(0xb44a68ee5f14bb57), W(0xfc1167e96373abbb), W(0x3d621f8b767d4c0a)},
+    {W(0xc6dcdfebf6ecc778), W(0xddda926282d1fbdd), W(0x477501aabfcbf2f7),
+     W(0x0be7228a67aa8277), W(0x5de7b8331daab9cd), W(0xb88a4f9a262feb4a)},
+    0
+  },
+  {
+    {W(0x7a9623b653fd1a04), W(0x13bd35bf3a3b8500), W(0xf8a5dec9e0f8e530),
+     W(0x88bcbe291d65dcd4), W(0x09fe38036739541c), W(0xebd04b7fe716a97a)},
+    {W(0xbd8e34df1e5ef7cb), W(0xddfc4243d7c4fd6c), W(0x0183d9053519411f),
+     W(0x63450996f7a3c483), W(0x18283cea01355739), W(0x8c1d72cf9aaa72f7)},
+    0
+  },
+  {
+    {W(0x7b7da028e19763dd), W(0x662f54df8b98ff78), W(0xc056d83c51f3dbd9),
+     W(0xe2f4d46fa91d085a), W(0x31759c9ceb35262d), W(0x624d0cf20c9dd29e)},
+    {W(0x108cf9bb1624b02d), W(0xa241444e345531d6), W(0xf69816b273d372b2),
+     W(0x126575a7d5415e53), W(0x546bb4c1306b8b0e), W(0x82bb0c124d54ea5e)},
+    0
+  },
+  {
+    {W(0x81dd074e4398751e), W(0x87b11b480a3f3ebc), W(0xb5afe1f0352b58f5),
+     W(0x6d2d94829c390eef), W(0xd073f9a0f36a8d23), W(0xa7c5abec466ebbe5)},
+    {W(0x968c04a60539f145), W(0x52a3ad0c93f4d3d3), W(0x98e196bb15c0970b),
+     W(0x2af28ea370ab8dda), W(0xb912fbda7a039fa9), W(0x3dd8d87acbd02ff6)},
+    0
+  },
+  {
+    {W(0x5bcf287864e60ac2), W(0xf70e78a455d53345), W(0x88685de6707a7138),
+     W(0xa77646dcfb2041a4), W(0x8608695289db3060), W(0x08b7c4d8e27a1690)},
+    {W(0x4148d9373ca7fd81), W(0x58c7440bff7698a8), W(0x9d722d4db0391d14),
+     W(0x5683112462b0373f), W(0x87b0363be9a9992c), W(0x51870cd18853db84)},
+    0
+  },
+  {
+    {W(0x6c8e5a261d99492c), W(0x6e5bab8e77f916a3), W(0x9b014aad50ad6f39),
+     W(0x2a3933c51f107e26), W(0x4b04395cc951bf73), W(0xf8f683b4b0ef56df)},
+    {W(0x28c9fcdd1905c84f), W(0xb03604f14141feac), W(0xb546f58e53ace23d),
+     W(0xee5fec4efe688f02), W(0xd8b43f6d2e91406d), W(0x75e44b21261764d9)},
+    0
+  },
+  {
+    {W(0xdaa7fcc9f9474bb7), W(0x3c82e74bafa5db2a), W(0xfbf918c59894edce),
+     W(0x470c45eda9ac29a7), W(0xdfd44f6fbc372f2c), W(0x73a4790aa1e38d3f)},
+    {W(0x23d2400ba9674837), W(0x3dad71bc136a92da), W(0xc76a488148baa4ab),
+     W(0x73227e4ebc26e6b0), W(0xe732edcfe8ef5662), W(0xfe96aa5f0c5662bb)},
+    0
+  },
+  {
+    {W(0x4208cbbf4e6f0ed1), W(0xa2255da8ec41c28b), W(0x0728efb6f5628ea7),
+     W(0x33436bc9c0166ed3), W(0x12837f014c7cc986), W(0x896fd10942ca7822)},
+    {W(0x55da2c7bc15a2c0e), W(0x7df76ad1c27aa051), W(0x1f7fed70bdba4496),
+     W(0x5105c850dfb76f25), W(0xd8d60ee84e2e43c3), W(0x47cdcc9747bc0f77)},
+    0
+  },
+  {
+    {W(0xb51bd4e05626ad67), W(0xe87cdf7b02bcc4bf), W(0xe6104952cd32307c),
+     W(0xcd3aae4cafceca6f), W(0x31016a8030cbb7c3), W(0x9106d99a21569af5)},
+    {W(0x1f1a81d793074428), W(0x52ba91d02708bc6e), W(0xec2e05bbefc8de78),
+     W(0x4123d0fdaf895152), W(0x18858bdb11584ce4), W(0xabd5d00f5d20e6c9)},
+    0
+  },
+  {
+    {W(0xc4e127b931f309ca), W(0xdcf45d0df87b9494), W(0x172faf702610c5ff),
+     W(0x92ad644e1c588f5f), W(0x793c35e0dd30d05d), W(0x424ee515ef5ffa55)},
+    {W(0xa9bae2950f1e988a), W(0x4168015749650b4d), W(0xeeba4a076444860b),
+     W(0x09d98773077f8419), W(0xa63185bcdf05f342), W(0xed9f6202e0703ebc)},
+    0
+  },
+  {
+    {W(0xfdff09598c3ad51d), W(0x62af3d124651f884), W(0xc17c0c8d46e06210),
+     W(0x4f035f3e8d45a905), W(0xafd02f65389ba85f), W(0xaa23769e64acdf71)},
+    {W(0x835fbfe53a87220f), W(0x9fc2c376aee30a8e), W(0x289cd6c6385a0696),
+     W(0xb68941e3d8f2a415), W(0xa16b696eafab0336), W(0xe4a68e4c68fb1988)},
+    0
+  },
+  {
+    {W(0x34d53b3ca3a64a26), W(0xfb7a695aee6c1715), W(0x5fd01116f6ef7eab),
+     W(0x7670e85591cce8c9), W(0x63669bcc9c94f4c3), W(0x7a65a84b494fd80c)},
+    {W(0x061b9d359792349f), W(0x59b1ec6c96191c28), W(0x0798688dcb20442f),
+     W(0xe349c80447dedc13), W(0xbd7c0edb75b98ff7), W(0x9fe5d18bdb5b401b)},
+    0
+  },
+  {
+    {W(0x51aeb0011354a53c), W(0xcc745013d74ccacf), W(0x7e9bd76c452b1a12),
+     W(0x63c36c7a30f2efb8), W(0x9ffb4f789be161fc), W(0xe9db9964bcca8367)},
+    {W(0xe95ea34c493d799d), W(0x9acfd44a5acc701b), W(0xaf3216c1d17fbfae),
+     W(0xe645ea955c92e191), W(0xd34501986cd442d2), W(0x64f0be8430c6967b)},
+    0
+  },
+  {
+    {W(0x4e4b4953c803127f), W(0x3a8363a6321cd0d9), W(0x2e5ed79875f1a875),
+     W(0x4b90a84c106961c3), W(0x4fa5f092b39c321b), W(0xc93d1a82230147e1)},
+    {W(0xa4776474dadfc4f2), W(0x7c3e24d3a335833f), W(0xe021558ce998f6f5),
+     W(0xc6285d4e67ff2c91), W(0x8f3470a1b27fd770), W(0xf9b896851a49e7a2)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x87c7dd7d139b3239), W(0x8b57824e4d833bae), W(0xbcbc48789fff0015),
+     W(0x8ffcef8b909eaf1a), W(0x9905f4eef1443a78), W(0x020dd4a2e15cbfed)},
+    {W(0xca2969eca306d695), W(0xdf940cadb93caf60), W(0x67f7fab787ea6e39),
+     W(0x0d0ee10ff98c4fe5), W(0xc646879ac19cb91e), W(0x4b4ea50c7d1d7ab4)},
+    0
+  },
+  {
+    {W(0xcfbcbc4a7db62b5a), W(0x2919bf514ab45dde), W(0x735de05622322f91),
+     W(0xd2590bda7662ae23), W(0x63d468fed82be7a6), W(0xc84d0435695ea172)},
+    {W(0xc50f494120a6fccd), W(0x2d613990620f44f1), W(0x680ccd041fd25778),
+     W(0x25ddac444a3d0808), W(0x41d8b738c4684cba), W(0x2611645f53963888)},
+    0
+  },
+  {
+    {W(0xb05cb834b0279be5), W(0x2de7d0ebf08c5f93), W(0xf023b5aaefa9e4f0),
+     W(0xb8061e5d9bd075ec), W(0x7d2ba50f1aa41bfb), W(0x8963f3e390865d96)},
+    {W(0x7f221a794713ec7a), W(0xc83bc5178500b4c3), W(0x085feb6af6ab1540),
+     W(0xfd141024dc87cd93), W(0x3e196fdb3239dbf6), W(0xb7cf3e16dbcd5364)},
+    0
+  },
+  {
+    {W(0x1466c9f5e03a2fb4), W(0xb866c006862a58a2), W(0x291e8c75b5865550),
+     W(0x1ddb7154e65862cc), W(0x285153bc2b997167), W(0xe2fce0e7954b6c19)},
+    {W(0x985d450616dc2937), W(0xf7f14216ee41d9c3), W(0x39e098dafa5fe5e5),
+     W(0x3fc26046f90f231d), W(0xde5d5ced32afd0b5), W(0xad688b1d60c09c18)},
+    0
+  },
+  {
+    {W(0x3720b1720f806b59), W(0x1f696d47f224597b), W(0x03c46e315b54eefc),
+     W(0x387e466472b0edaa), W(0xfc59b03dee77476e), W(0x86854e54607a7259)},
+    {W(0x1478bcee3e9320dc), W(0x4aa825a88c9d87e4), W(0x71272f72cf272ee0),
+     W(0x19e3a4a38bd885cd), W(0x9af6415b376ba31c), W(0x6394b5a7807b2b36)},
+    0
+  },
+  {
+    {W(0xdbfcfa75e572e06d), W(0xafa019d08b7d5653), W(0xcc6c851d67a19b60),
+     W(0xace88bf431ae1a67), W(0x74554a6193d1e135), W(0x51ba2cdd4211890a)},
+    {W(0x7cb326899e8d1f02), W(0x29a6b8258b66ab99), W(0x0a672c21766e72f3),
+     W(0x24bb718a880642e3), W(0x425dc41d184d2b36), W(0x96a1468e891024ab)},
+    0
+  },
+  {
+    {W(0x3180789c26df7050), W(0xe375a43e96cdfd31), W(0x7951b895e99e922d),
+     W(0x987ea2503d0bbe80), W(0x6d2f49f0e2fe79c0), W(0xc9c2c636c2b18d2a)},
+    {W(0x707798f3d8c8620c), W(0xc2d603dad5c6a0ee), W(0x46cf1e32bc447940),
+     W(0x4dfc145938a845f3), W(0x210083fe455e5d92), W(0x6be989eaa1fedc3f)},
+    0
+  },
+  {
+    {W(0x72fc8198dacc038c), W(0x5fdae1d9f1077bbd), W(0x369198bbd99e3036),
+     W(0x6b68390a0efddfca), W(0x8c35f3e4f0914741), W(0xd2bc54ecca7d7807)},
+    {W(0x564d991e3a8695d1), W(0x5e1e14c81b0d937d), W(0x51f30dab5d635893),
+     W(0x0427e346f944e49a), W(0x1e0bf1b56a233bc0), W(0x75b0ee6c617bf93e)},
+    0
+  },
+  {
+    {W(0xcd2db6797b1bbd75), W(0x1ce5acecaac388b1), W(0x715ab9f634c1fa9c),
+     W(0xa531e1b8e0815643), W(0xa64511c692de769b), W(0x8425126b785b8bc0)},
+    {W(0xc8d9320de72e155b), W(0x9cf36dcd5600a04b), W(0xbea8b0f4c6e1f7fd),
+     W(0x6f9af6349767d85b), W(0xc3ea9fa4c403ecb8), W(0x0af7be1ed60a0e70)},
+    0
+  },
+  {
+    {W(0x180afdcc20928729), W(0xec2e90f436bce72b), W(0xa8a8c54d8f48e48c),
+     W(0x9d0c6a355248109b), W(0x8bdd819baa6c3ae3), W(0x95e221a6dc0bebc1)},
+    {W(0x83e568eceb113737), W(0xaa6d29c8a1a3a0a8), W(0x0ebd5015c54fbda4),
+     W(0x692a84832a5c8b17), W(0xa08e384b51836490), W(0xf1904bfc37ded786)},
+    0
+  },
+  {
+    {W(0x2093335463919940), W(0x34e4f27397ea3359), W(0xbe64c5584d4156a5),
+     W(0x368a6c980497cf92), W(0x59931a502288b8cf), W(0x67d70ff8c36cf906)},
+    {W(0x4175562a8886126f), W(0x46ecdd1d55114ffe), W(0xd12876f94efde702),
+     W(0xb0c9333fc046d908), W(0x8358b04a2cd6c180), W(0xcbaf4612336d3c84)},
+    0
+  },
+  {
+    {W(0xd77d9cd4fe8dee55), W(0x7a0f60c12e43fc84), W(0xecc5cd746d5da126),
+     W(0xb5ac6fee2382a984), W(0xd9db83e26ccd0fee), W(0xaa4dbcba350717d4)},
+    {W(0xb3c0562c812ead77), W(0xf7a995eea96cdd07), W(0xd5419bf1ffeb4e67),
+     W(0xba0aa22e1226df29), W(0xb8d0d7f4c1e333d1), W(0x86fecca60a27388c)},
+    0
+  },
+  {
+    {W(0x9ea1d715dc579084), W(0xc1e715dd0b1cf2a4), W(0x624fa6e4926bf7d5),
+     W(0x5034c9d34f7b4e51), W(0xc1b0ed7aba3a42a6), W(0xd1847c28b73cdb77)},
+    {W(0xa4794bc36ae49ff0), W(0x50b2d908b9144fa5), W(0xad112c778f073479),
+     W(0x040499dd4b98f590), W(0xd415d273152b5e30), W(0xd3f4ff3f39054cab)},
+    0
+  },
+  {
+    {W(0x1e0318d5fff93451), W(0x40b91fa9283e197e), W(0xdebc5a28089ac579),
+     W(0xcf25f527e9d98537), W(0x73f7818d4ae08f51), W(0x397f2cb6a956c875)},
+    {W(0xb7d74ac57515436d), W(0xc29a2ffd830664ab), W(0x02e273563cabe01b),
+     W(0x418417c103c78924), W(0xd12994116535005e), W(0x53fc391258f66295)},
+    0
+  },
+  {
+    {W(0x6b1fceac4d87dff4), W(0xd31aef70f262f722), W(0x894361782612da01),
+     W(0x1d3bdfa9963bc230), W(0x9a46505ba7afa565), W(0x662c2fc7a31db4ff)},
+    {W(0x33983a9ae5ef30c0), W(0xb8c874ee723f085a), W(0xfb5fbc860f279c05),
+     W(0xcd9cc376ad0a380c), W(0xcb19d881fdfad736), W(0x1c3d9734585167dd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd23658c8d2e15a8c), W(0x23f93df716ba28ca), W(0x6dab10ec082210f1),
+     W(0xfb1add91bfc36490), W(0xeda8b02f9a4f2d14), W(0x9060318c56560443)},
+    {W(0x6c01479e64711ab2), W(0x41446fc7e337eb85), W(0x4dcf3c1d71888397),
+     W(0x87a9c04e13c34fd2), W(0xfe0e08ec510c15ac), W(0xfc0d0413c0f495d2)},
+    0
+  },
+  {
+    {W(0xb097b2c5c4e81268), W(0x7ef175521d50ca8c), W(0x638266e942099644),
+     W(0x43d059deff729073), W(0xeebb5fe1148c3940), W(0xb82e73d1daa8e925)},
+    {W(0xf43c78d8254380fd), W(0x2beabc58fce37fa0), W(0xcdd5a7d66b636357),
+     W(0x8b70a2ebe096a954), W(0x011d5419d0afa2fc), W(0x3e49eb6704fb095a)},
+    0
+  },
+  {
+    {W(0xeb05c516156636c2), W(0x2f613aba090e93fc), W(0xcfd573cd489576f5),
+     W(0xe6535380535a8d57), W(0x13947314671436c4), W(0x1172fb0c5f0a122d)},
+    {W(0xaecc7ec1c12f58f6), W(0xfe42f9578e41afd2), W(0xdf96f6523d4221aa),
+     W(0xfef5649f2851996b), W(0x46fb9f26d5cfb67e), W(0xb047bfc7ef5c4052)},
+    0
+  },
+  {
+    {W(0x88e7ac8e168d5e60), W(0x53abd5696188a98f), W(0x3b96d52918be419a),
+     W(0x7e75e354c057621c), W(0xcb1b709f5ce57e59), W(0xe78befa2844f2463)},
+    {W(0x536081993276d4a0), W(0x92636ade157f2024), W(0x6dd0d348e0411414),
+     W(0x5b28e9504d73eeae), W(0x08439232690ed85e), W(0xdde1a3496da14b58)},
+    0
+  },
+  {
+    {W(0x5cbdc442f4484374), W(0x6b156957f92452ef), W(0x58a26886c118d02a),
+     W(0x87ff74e675aaf276), W(0xb133be95f65f6ec1), W(0xa89b62844b1b8d32)},
+    {W(0xdd8a8ef309c81004), W(0x7f8225db0cf21991), W(0xd525a6db26623faf),
+     W(0xf2368d40bae15453), W(0x55d6a84d84f89fc9), W(0xaf38358a86021a3e)},
+    0
+  },
+  {
+    {W(0x10520b2733c12f53), W(0x97d4ef439286a1f5), W(0x12468ef88948f78b),
+     W(0x40a9d27550ad452e), W(0x5e382347c1c48470), W(0x5cd739fd33e73ace)},
+    {W(0x7d83d02f1041f8f3), W(0x32642eb0e314ad92), W(0x6716d448885679e6),
+     W(0x0e12bdd5fc95919c), W(0x7da4420492c2194a), W(0x78956db115ffcd2d)},
+    0
+  },
+  {
+    {W(0xbd048bdcff52e280), W(0x8a51d0b2526a1795), W(0x40aaa758a985ac0f),
+     W(0x6039bcdcf2c7ace9), W(0x712092cc6aec347d), W(0x7976d0906b5acab7)},
+    {W(0x1ebcf80d6eed9617), W(0xb3a63149b0f404a4), W(0x3fdd3d1ad0b610ef),
+     W(0xdd3f6f9498c28ac7), W(0x650b77943a59750f), W(0xec59bab12d3991ac)},
+    0
+  },
+  {
+    {W(0x6cbd275739ed9ec9), W(0x5db68a68fe5d4aa8), W(0x177eaa0be4c58c7b),
+     W(0x603551ef0e488784), W(0xc8eba131df916b0f), W(0xd0dbceda159732e2)},
+    {W(0x55acca84b0834afa), W(0xdbe98440b59ffbf5), W(0x162a2c703bd3b202),
+     W(0x4c5e5d256ddd8eba), W(0x66e7844a77b1d93d), W(0x1292bc0e110b9dcf)},
+    0
+  },
+  {
+    {W(0x01f40e882e552766), W(0x1fe3d50966f5354f), W(0x0e46d006b3a8ea7f),
+     W(0xf75ab629f831cd6a), W(0xdad808d791465119), W(0x442405af17ef9b10)},
+    {W(0xd5fe0a96672bdfcb), W(0xa9dfa422355dbdec), W(0xfdb79aa179b25636),
+     W(0xe7f26ffdeece8aec), W(0xb59255507edd5aa2), W(0x2c8f6ff08eb3a6c2)},
+    0
+  },
+  {
+    {W(0x34a4632c9341a2e0), W(0x05ca421bc525bc5a), W(0x441cf2eb4ae3284a),
+     W(0x1a57684e146012ab), W(0x23a52ee330acfd0e), W(0xc3f4d94a7d29e389)},
+    {W(0xfbd4d48eb4154640), W(0x2352e791af9ec396), W(0x45813e8e7327caee),
+     W(0x977f7a08d9db7e81), W(0xbe55b6305f53d15d), W(0xee182ac66a23f0dc)},
+    0
+  },
+  {
+    {W(0x88887756757d6136), W(0xad9ac18388b92e72), W(0x92cb2fc48785d3eb),
+     W(0xd1a542fe9319764b), W(0xaf4cc78f626a62f8), W(0x7f3f5fc926bffaae)},
+    {W(0x0a203d4340ae2231), W(0xa8bfd9e0387898e8), W(0x1a0c379c474b7ddd),
+     W(0x03855e0a34fd49ea), W(0x02b26223b3ef4ae1), W(0x804bd8cfe399e0a3)},
+    0
+  },
+  {
+    {W(0x22723fa37cdc2211), W(0x1d33923231ddb2bd), W(0x63f354c146626fe6),
+     W(0xd0f68526f67a4257), W(0x79aa889b8d3d00b6), W(0xca5fc8a70de4c413)},
+    {W(0xe311a966d2879266), W(0xc8d982fe5f21e1dd), W(0xc51f1604cbb159ff),
+     W(0xb449deb8092d83ce), W(0x4a5f68f8644fd0be), W(0xeef3fa4dbffb0088)},
+    0
+  },
+  {
+    {W(0x11a9f3d0de865713), W(0x81e36b6bbde98821), W(0x324996c86aa891d0),
+     W(0x7b95bdc1395682b5), W(0x47bf2219c1600563), W(0x7a473f50643e38b4)},
+    {W(0x0911f50af5738288), W(0xdf947a706f9c415b), W(0xbdb994f267a067f6),
+     W(0x3f4bec1b88be96cd), W(0x9820e931e56dd6d9), W(0xb138f14f0a80f419)},
+    0
+  },
+  {
+    {W(0x2b4056a43b32932e), W(0x1c74deb6bd8a1cb8), W(0x09601843b181b5a0),
+     W(0x50a92353dc6a92d8), W(0xe86c022c2d6f4331), W(0x0d9671dc3a3ae821)},
+    {W(0x3d618a20c8228d82), W(0x20e809c1a5292169), W(0x3b2fe5e73803f840),
+     W(0x1f2978e9416eb670), W(0x44dcc410c35b795c), W(0xbf5065c0503ce975)},
+    0
+  },
+  {
+    {W(0xa11a1a8f0429077a), W(0x2bb1e33d10351c68), W(0x3c25abfe89459a27),
+     W(0x2d0091b86b8ac774), W(0xdafc78533b2415d9), W(0xde713cf19201680d)},
+    {W(0x8e5f445d68889d57), W(0x608b209c60eabf5b), W(0x10ec0accf9cfa408),
+     W(0xd5256b9d4d1ee754), W(0xff866bab0aa6c18d), W(0x9d196db8acb90a45)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1b66faabf9e89bea), W(0xc81c5ddc3a441284), W(0x1a82f3a0a675f7c8),
+     W(0x82884a2f30313a71), W(0x7ac5d7b058aea9e6), W(0x1954f075cd5ff05d)},
+    {W(0x7c29638d6178d270), W(0x6af7f8ba19381929), W(0xe85e3c47a17ae3a7),
+     W(0x91b107c77009e38a), W(0xf3b777d8f1f9c52e), W(0x5b7b74ff11b688a0)},
+    0
+  },
+  {
+    {W(0x4ae3d232c0385874), W(0x83bda9e6cbf96d2a), W(0xba73c769ec62fd6a),
+     W(0xd586ba7f62a4720c), W(0x6497cd140cc1f491), W(0x8b012b707b2ac571)},
+    {W(0xa65eabb6268fd705), W(0x8caf100a1431873d), W(0x25b31b84231457d7),
+     W(0xcab62f75901645c5), W(0x2377d74db2f7b656), W(0x4008277c2d33c95c)},
+    0
+  },
+  {
+    {W(0x10105dfd101d2433), W(0x64e009b58ab6d664), W(0x122e68324e80fc07),
+     W(0x3b26e76287dc7da6), W(0x7bc183de6d4728cf), W(0xebfecf4f8bcdc129)},
+    {W(0x8b995cec265c66f5), W(0x080572d7c4b0e942), W(0x612e9e6b4da5b77d),
+     W(0x8ec048a96caf9161), W(0xe3628ee2c7f45eb6), W(0x0190b71bd85650e9)},
+    0
+  },
+  {
+    {W(0xaae2f448ed001c43), W(0x08ad1d9bcf4be493), W(0x3262b2f482c1f372),
+     W(0x5521febd351a5f7f), W(0xf8ec9190916c75a8), W(0xf3c258c72728dfb8)},
+    {W(0x5dd4ff4f8af19574), W(0xefddf5795d076b1c), W(0x318b5b98ba8b777a),
+     W(0xd971d426fb7f8409), W(0xed1465e8b0fd31db), W(0x80d24d4300f66347)},
+    0
+  },
+  {
+    {W(0xcea0374a69ca5051), W(0x19e060ad5294ae7a), W(0xf6ce02361bb01f47),
+     W(0x2a5b28ba8c328b8b), W(0x6991b1d8b253d630), W(0x360afd40859455d8)},
+    {W(0xf5c6e1427c1f5946), W(0x1eab83084cc8c391), W(0x4eb4032f67e76ecd),
+     W(0x5bf14aa233898059), W(0x0804a7c00e001b76), W(0xe3866a93734cd134)},
+    0
+  },
+  {
+    {W(0x5ba5288c1ae586a2), W(0x044f1fc61b715821), W(0xc1a9a997602f3c65),
+     W(0xc5c7512fe08c0223), W(0x48a19c3c367e6f1d), W(0xa9f2195dfb241597)},
+    {W(0x9f674a5fb5ba32a6), W(0x275a060f0a312742), W(0x5aeb8c4303d6f13e),
+     W(0x0fed575d917433fb), W(0xe4a5ef9a59f53490), W(0xa9f86145f315e616)},
+    0
+  },
+  {
+    {W(0x7059c58669a03980), W(0x91f2dfe4e88e1287), W(0x96dcd9318d9633cc),
+     W(0xb2abc44f37bda148), W(0xe31adb3feb8964dc), W(0x7b07e015e316876c)},
+    {W(0x31732880ababd240), W(0x5c37a667e95854a1), W(0xb5b334c91d6f69ad),
+     W(0xe613e5622c34e118), W(0x8bbdbf5c5f5984ed), W(0x82ecfd95cf4f63a1)},
+    0
+  },
+  {
+    {W(0x315ad7a47e5a59f4), W(0x1c615bfc543c8b00), W(0xe12f97a8baa56473),
+     W(0xf263db4446edcfcb), W(0x47cf91d53c1a968e), W(0x1a1165b4c15db875)},
+    {W(0x5d35e53a3479616a), W(0x649f87b45c59958f), W(0x5d3d11ea246da3d3),
+     W(0xc1ddfcc653f06820), W(0x8169d7116610c00f), W(0x15f16ba54bddc8c7)},
+    0
+  },
+  {
+    {W(0xf80ed61a30fa7e86), W(0xf2e5f324a15ec5d9), W(0x139ca085ecba2d64),
+     W(0xd164ee5ff3f5cfd1), W(0x758c0008e5cc3cc5), W(0xd180c463ce8fa1f9)},
+    {W(0xe5dd27054adc6e61), W(0x061e0c3c592c39e5), W(0xec5a8d4a4e437781),
+     W(0x9e4c6f461e6d4540), W(0x33ab232e2526e6ee), W(0x3c551685ea282d9c)},
+    0
+  },
+  {
+    {W(0xcf19fb2a1e548ef0), W(0x8bb6dfa0cc694171), W(0xeb1668ca5c5e390f),
+     W(0xf5a3485be1975263), W(0x4edfc596442cc850), W(0x9901f447f9627d74)},
+    {W(0x3a6b85c984d0413a), W(0x1466366167de639c), W(0x9fc9fdcf11705bbb),
+     W(0x6d066e2bbff2cf80), W(0x38dedc2fdc3026fd), W(0xad533a981b828538)},
+    0
+  },
+  {
+    {W(0xed9f434e5216636c), W(0x242bd09bc5c1668f), W(0x8bb747bd804f3d6e),
+     W(0xd66d8753c7c83dd2), W(0xa71016c2584540b8), W(0xd8b16210fdd41a90)},
+    {W(0x5eb5947e1b65be60), W(0x1bf995e7616dbdc2), W(0x71b7099abb7dbdd8),
+     W(0x53650d29079eec24), W(0x6bdd1b0e8ebd86c8), W(0x0a9658ed9a31624a)},
+    0
+  },
+  {
+    {W(0x6c75bc93b7bfa29e), W(0xf86f22b218ef6d69), W(0x90ce6a1536dcadf2),
+     W(0xf11f711c7ce50921), W(0x0739ceda38a479e3), W(0x840b825e6ec3dbc6)},
+    {W(0x7c36c0a59fa23481), W(0xceb61fd170cb186d), W(0xac6f7d3c26e4754d),
+     W(0x4076d3b5f317b385), W(0x52f1bd723fd9e9c7), W(0x6649d8b6bf316043)},
+    0
+  },
+  {
+    {W(0xf352e28b54a8ffaa), W(0xa8317f089ce68b6e), W(0x7deb148770cad820),
+     W(0x2411b382b2c3579d), W(0x20b21ed214d36e66), W(0xe7331bec353b9ff5)},
+    {W(0x5692636840dff0b3), W(0x13356f7b646eff07), W(0x1e6e6e4508c64091),
+     W(0x913b83f2ea0b920e), W(0xb69e5f839f713aa1), W(0x8e59d3794632a60d)},
+    0
+  },
+  {
+    {W(0xdc2870f8243cfbd5), W(0x000b71b31ab496f3), W(0x53511a3f708f4507),
+     W(0xbd7bd0381949d835), W(0x723a007d938f4db6), W(0x5bc8679e2d04e9fd)},
+    {W(0x51ca5fd176ec7fc4), W(0x86c4205c988f354e), W(0x9042e76b2a0a4a90),
+     W(0x368f52a84ad44d2d), W(0xddc2cab8912edfb7), W(0xde74ccf5cde80199)},
+    0
+  },
+  {
+    {W(0x29871ce22855a74e), W(0x5418f0dc98696474), W(0xd8bc07d6b90d0498),
+     W(0x391012a79fdc0ea2), W(0x271396949b09f60a), W(0xa0a43dbf3371f0d7)},
+    {W(0xab5849422af8d992), W(0x64cbd121409eb3fa), W(0xd36faf01766864fc),
+     W(0x69189faea2a83417), W(0x3c24d85e3733b772), W(0x125a915d2ee497ad)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8002f4583e455a61), W(0xafbafd375bea205a), W(0xa8ced112fb93f735),
+     W(0x27cb6292196e3084), W(0x72395bdd77e8c744), W(0x02e018d8ee71f5ff)},
+    {W(0x7cfc14d9c1337a1d), W(0x94e14c0ad7b4d86e), W(0x66e50129d213738e),
+     W(0x7a905d91bc0b5ea3), W(0x92cb630afca06700), W(0x65e06d5cbf3a0821)},
+    0
+  },
+  {
+    {W(0xe96c4aebe5f5b545), W(0x10a85a002d4c43b0), W(0xf86ad2f632f9151d),
+     W(0x05daf874302b99e2), W(0x4299dbfa14fd3171), W(0x27cbedd6812cfc62)},
+    {W(0x42e61536b8772164), W(0x52eecef76a5423ef), W(0xc34c6c70548fffa3),
+     W(0x1fbed7777b6db825), W(0x850bded44ef2989e), W(0x3b8a542c815463ee)},
+    0
+  },
+  {
+    {W(0x352e143797466956), W(0x6846fd53da29feb5), W(0x64d5d9395a7b7719),
+     W(0x4d5197bb8544328b), W(0x5220626522f9c593), W(0x7d2dac1974d6a45e)},
+    {W(0xf52c9eec4c26755e), W(0xce154c22f464471c), W(0xe606b3bfc9ed3933),
+     W(0xfc5046d7a14c3d70), W(0x81cd053e5edb5876), W(0xc567a2e7a30347a1)},
+    0
+  },
+  {
+    {W(0x9decf2173079fe2f), W(0xc32ec5707c817f6d), W(0xd5649ce8aeb36b92),
+     W(0xab9f77d158fb4dc8), W(0x66b11fb6b52d60cf), W(0xe217941deaaa4619)},
+    {W(0xf3522a9a1607c412), W(0xea2eba4fc2a3d8c9), W(0x267997c625e38722),
+     W(0xed5047b72d4595ee), W(0xaaa41e5f55e5456c), W(0x891e3d1278cfc6fe)},
+    0
+  },
+  {
+    {W(0x3fd7557aaf0e4061), W(0xb8c664b085912525), W(0x4c8276854d208bb6),
+     W(0x941aeb9ac1c9512f), W(0x6ce0bed5a181e9f3), W(0xb75381103744a339)},
+    {W(0x80eaff7a280ffad3), W(0x99c7508e1f8da457), W(0xf16e7c1b0f8e7fd8),
+     W(0x56bddddaaf499630), W(0xe8c112df1180a168), W(0x23f4230a2987f12b)},
+    0
+  },
+  {
+    {W(0x0ce9ab136fa4d1c2), W(0x7fea01e574e308e6), W(0xf031b3b69a1753a9),
+     W(0x32160ba02bae5685), W(0xdfde9ae80cd3c066), W(0x7989cfc0a180cf5c)},
+    {W(0xe2c194168a742d6a), W(0xeeff5e800cf725f3), W(0x67eae7d12ea20321),
+     W(0x3eb507b07968c7ff), W(0xeb300ff9ce27bab9), W(0xff152330975756ea)},
+    0
+  },
+  {
+    {W(0x325de656dbedb636), W(0xc5eb4ac5f9481983), W(0xa90926ad89e4c34a),
+     W(0x8e61adb0ec5a615f), W(0x5a2233d43fc770ac), W(0xec924484cbb23f8a)},
+    {W(0xa7e6c58621e9c23d), W(0x90069c5c442c377f), W(0xb0f340be697e7dc0),
+     W(0x783a7d0eb6f29135), W(0x412469b007e89899), W(0x04f612251bfaaf55)},
+    0
+  },
+  {
+    {W(0xa438634ed7357a51), W(0x918f14cd18c04d59), W(0x2ab4dedfac40dd56),
+     W(0x758e95ee4956a5de), W(0xfc11e3945113f84d), W(0x6d71b6736059f16c)},
+    {W(0xfd8e2236fb357c3f), W(0xd7c8681232dca873), W(0x02aeb1538ea13b44),
+     W(0xde1275d3013d3827), W(0x470a7b7e659ca201), W(0x862c83c55c77b351)},
+    0
+  },
+  {
+    {W(0x7d573aef557e70f9), W(0x035eaa0bd2b88d7c), W(0xfd2845747b83dc4e),
+     W(0xc00f86aa0eef67a8), W(0x845cad004aebebe2), W(0x2533f92e4a1b1de2)},
+    {W(0x0fd50f59f09b15ef), W(0x7fef38fe75306e3d), W(0x48606b4839175e6d),
+     W(0x7e15279c67aa4bf6), W(0xcbbdab04c0bfef5b), W(0x5acdb75f42e02123)},
+    0
+  },
+  {
+    {W(0xb13da5e4c8fd5101), W(0x7778a5ac8064a149), W(0x994de6276991a830),
+     W(0x1d2e7b1c37b3aed9), W(0xc9d754a98a78bf91), W(0xf70fea5f374a7782)},
+    {W(0xe93fc3697d67e33e), W(0x490ef096f17d0ab8), W(0xfda9ffca6efa93ed),
+     W(0x4f7344d776b263ce), W(0x10dbdea4258a83a2), W(0x969f62f0def3c33d)},
+    0
+  },
+  {
+    {W(0xe0fda9c88bdfdcda), W(0x150f595c39ea1aec), W(0x43cf3fab4a4b3d41),
+     W(0x10d2c9716b46dce0), W(0xa432a608c353d4aa), W(0x6b17a41c3a4085df)},
+    {W(0xf005f3fa5caa032d), W(0xba516f93921d7b87), W(0xda9044e0c2be4f33),
+     W(0x655c726b744bbad2), W(0xc93501a32e946a0b), W(0x5993068258e48ae4)},
+    0
+  },
+  {
+    {W(0xfc9b800f05084cfb), W(0x1c4d4510496f23fc), W(0xfea0003cc1d08465),
+     W(0xf0281da09af48a41), W(0xa5c0d97144d32eed), W(0x2613b73e023a2e31)},
+    {W(0x455013c87dc8ac1a), W(0x581b13195958b3da), W(0xd293f2f22290aaea),
+     W(0xa068256496f6223b), W(0x38fd18fa69410ef6), W(0x74eaf35f2b2cf629)},
+    0
+  },
+  {
+    {W(0x90ab727135bb4da1), W(0xf1aa4a49a1674004), W(0x09cbb310ed59b97e),
+     W(0x5fbc6cf1622e1cea), W(0x02061ebcfc3b484f), W(0x27bc4277397d6ac2)},
+    {W(0xb22204674ad7229a), W(0x1b2ca0201970a4d2), W(0x03e561bed019a8d9),
+     W(0x547a19a067fb8aaf), W(0x3b3178c90a5cfc1c), W(0x779f23effdd12eb6)},
+    0
+  },
+  {
+    {W(0x4f8e469804dbfe15), W(0x81565ebc7a81e636), W(0x75aa10c3a7477771),
+     W(0xf19200eff3882f1d), W(0xc2e7da12b6717e8a), W(0x51183cd68dda292a)},
+    {W(0xf7f1fac59e6c8947), W(0x5a50e794b4b4488b), W(0x7ee63b4d7a3b9220),
+     W(0x2cf965023c1cefc7), W(0x48f6ac834b564303), W(0xc0843e5a5962a658)},
+    0
+  },
+  {
+    {W(0xb089392dd474187c), W(0x5e0c9eeb5718d28d), W(0x9f16994b6f035ff6),
+     W(0xef69e31b3dae93ab), W(0x5beef7944f8f6536), W(0x9b39b1278874d57a)},
+    {W(0xa9b0bf1ef0a2eba0), W(0x57c59b7fe0754754), W(0x838b28729b59e2bc),
+     W(0xb21f44f0c4629820), W(0x5985c3f419837981), W(0x4f1ae6bfc046d737)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x281f6e58c7ff5b50), W(0xbc67791ecf9cd114), W(0xe29fa41afd89abd8),
+     W(0xfcb0b0b07984feef), W(0x0b0928a6d9d20a64), W(0x2fd385c46979ccd5)},
+    {W(0xce9c34c81fbe72e4), W(0x69364344aad0135f), W(0xd464635250946a5b),
+     W(0xb09a97c6f39f53b9), W(0x1d47bc20dcbc8b64), W(0xcda5c7bdd458b0d6)},
+    0
+  },
+  {
+    {W(0x763e3664295c4db2), W(0x632fd676dbbaa92d), W(0x62ab11a8c66b40e9),
+     W(0x06244698f384b708), W(0xe7cdf3bd69197876), W(0x9cc79c48064f8837)},
+    {W(0x95900a229486589e), W(0x7953f6e72ff01639), W(0x3f65fbbddd3e6e46),
+     W(0x84f52e06baa2e2a0), W(0x1dc462a8e3852824), W(0x9be69c3f7e4c032c)},
+    0
+  },
+  {
+    {W(0xcc580ea73b24e776), W(0x0f3a8b189d721d6e), W(0x8665604fb23480cf),
+     W(0x95787cba34414689), W(0x425d7c6f4d10a945), W(0xb5ec2626b2f1cc78)},
+    {W(0x55da88858658de6b), W(0xb50919d1e9aba03e), W(0xc64881d7d99e417e),
+     W(0x1eeba5aabf28fba2), W(0x20feb7b3504eff80), W(0x9f5f9db650debfb7)},
+    0
+  },
+  {
+    {W(0x20ebf79ce8a2e8f0), W(0xec040d0daca418a2), W(0x016c07e78d630d2a),
+     W(0x20021d57fa605dcb), W(0x6190f3e942d04705), W(0x4e000df58974b7e6)},
+    {W(0x6710da6c5abcedac), W(0xf31aa4965f95d37c), W(0x192c4b8ba5830899),
+     W(0x171ab8c4ea7dbcdd), W(0x715f60818cdf1097), W(0x0e0135bf205d10ed)},
+    0
+  },
+  {
+    {W(0x4a6226f9f7092423), W(0xfe6b7a6dec945231), W(0xb44e2e60a1193cab),
+     W(0x2ce6393543dda270), W(0x1a9e8a2138d64738), W(0x863d151a9d843675)},
+    {W(0x98a1222ee2b14443), W(0xbf8b32712826846f), W(0x80475be555508801),
+     W(0xc39ccd917b38f064), W(0xea31304de8e249f5), W(0xa3b6891b4d42db74)},
+    0
+  },
+  {
+    {W(0x39a689bc281548ba), W(0x11aacfca138eabbe), W(0xcf33108a8d29457b),
+     W(0x312612e014ed4b4d), W(0xcbb21f345115625f), W(0x4e7217de303a363b)},
+    {W(0xaeb0c8c0d137f67b), W(0x4ff84a937bf78dfe), W(0x7a022604683b37dc),
+     W(0xfa4ced77862b0847), W(0x5a49bdc136d69390), W(0x6d9dff06c0215314)},
+    0
+  },
+  {
+    {W(0x544874b71477473c), W(0x253a455a3907385f), W(0xb303afd631411ba1),
+     W(0x30047aa0466d6415), W(0x3a1b676594d4c2de), W(0xc265f1912860c7b1)},
+    {W(0xfe140a73688e7975), W(0xf08a652bf37ce7de), W(0x6c9f6df9f46f144e),
+     W(0xf7e7b95bc0defbc4), W(0xfbc9a9697824c075), W(0x9745d768d7773c39)},
+    0
+  },
+  {
+    {W(0xd2db4d35c8d2bf7b), W(0x52105d0981571d06), W(0x447565cc723a57bf),
+     W(0xd98c3597d8ded62c), W(0x0aeac6d9de2f1a9e), W(0xd363b0b70a98d3b2)},
+    {W(0xd9708f0702ad9933), W(0x9334677564f5809d), W(0x499332cf49cda010),
+     W(0x546df74a858467e2), W(0x8b84a55093748e8e), W(0x9e88ef9706f09073)},
+    0
+  },
+  {
+    {W(0xbb7742f370fcad48), W(0x6dcce7ff57d444ac), W(0xfc338485b6abc122),
+     W(0x03c1118caaf9060b), W(0x095dc123cb997905), W(0x2dfe24453dd9bee4)},
+    {W(0x9bffbbf9d45cdcdf), W(0xc5b50babb4b26fe5), W(0xe985754e87d31873),
+     W(0xb5b007f5a503d2e0), W(0xe25c4eb620bb8357), W(0xb6f00e50803fa8dd)},
+    0
+  },
+  {
+    {W(0xcd42d2391be93e28), W(0x93c11fcae2ea0d1c), W(0x8acd0b17345984ef),
+     W(0x3e3feaf350905d0d), W(0x4124e89a6f35b49c), W(0xafdd8d27a2bae979)},
+    {W(0xce1e814015ad5661), W(0xb0f9296dde281bc6), W(0x11e93935c31ea529),
+     W(0x1c4c3bd7ebb898ff), W(0x7cb73fc76ccc32c2), W(0x69e5307da3ac9b8b)},
+    0
+  },
+  {
+    {W(0x364e7371c7d996d5), W(0x053390bf8cc483aa), W(0x69c23cf281e948d1),
+     W(0x65e45d618e822ec6), W(0x9240ee412ed94568), W(0xe0f33912510a84cb)},
+    {W(0xad42eb0f6ecabdad), W(0xb35afdb4bc7e39f6), W(0x4ee63cb10cb50316),
+     W(0x7ccfa14a2a27dc3f), W(0x584328f0b4141347), W(0x361b2614a23cd89f)},
+    0
+  },
+  {
+    {W(0x0eeb9dc702ed3c24), W(0xe7cb624dfb39fc44), W(0xded105f581d4ccee),
+     W(0xaa675d0c46465cc3), W(0x313f4fc99af0a81b), W(0xd129819f227e6a72)},
+    {W(0xaa6b690340b16103), W(0x3dba75b2fb4c2fdf), W(0xc9feeea1e7c79c2a),
+     W(0x14f503104e024e75), W(0x3704aaa8b5729449), W(0x39ac6b0c24b86acc)},
+    0
+  },
+  {
+    {W(0x93c2cf3e53ead820), W(0xfca3b3564f4444e1), W(0xeb6d82bfaac7a37d),
+     W(0x9c0915d4cf49947c), W(0x771f9f7cc7edadaa), W(0x51418e487b2df679)},
+    {W(0xad1b249173f28cf8), W(0x8fe4fb7baecacd2a), W(0x539764bdb20d0b77),
+     W(0xb0073685a6a4f808), W(0x4c6f5602cf909196), W(0x1ae89342d45e9e7d)},
+    0
+  },
+  {
+    {W(0xc040412c754b8669), W(0xbda7e0cde2c1d3b4), W(0x2ac3b3d5ba29b9be),
+     W(0x98a415e3f63bf3ab), W(0x25aee93ed1776a16), W(0x46db7347ec3bc968)},
+    {W(0x8e44180a02612d2b), W(0x4e3dc4e82db990ff), W(0x2050f58f5f7705df),
+     W(0x7b41f5892672d845), W(0xeb301603c96e4fec), W(0x66ecd24e6cb16a6e)},
+    0
+  },
+  {
+    {W(0x72f5a0f70ad3bb67), W(0xabb15e3dce6396d8), W(0x2ae94788463efba7),
+     W(0xe77b53b41fd4c512), W(0x09921a1ca88606cd), W(0x1b86b75608e980ea)},
+    {W(0x2def667af3d22731), W(0xadebd3a39641b175), W(0xc0f35509045da920),
+     W(0x8fbf85e4952b7ca9), W(0x4ee7565023517a65), W(0xd31eeea30e75a4a4)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc0a40cac52133095), W(0xfe1b22fd93c162bb), W(0x8625898c34018741),
+     W(0x69c9f3f636d9e57a), W(0x69d9d7f3378aa211), W(0x6b03f897e7dca168)},
+    {W(0x24d49aebf997a48f), W(0x1d984c67c149ac40), W(0x667c1d01576f533f),
+     W(0x372eee199ef82ece), W(0x577723c0c207c14d), W(0x4225907a0eed37f6)},
+    0
+  },
+  {
+    {W(0xc61db977bc0e0903), W(0xbaf6e4da645c32fb), W(0xce89b8ca060b1adb),
+     W(0x41db448188e2c178), W(0xba6339f3923bdd3c), W(0xff25b818d29db42c)},
+    {W(0x3521116ee6d6b35d), W(0x4e1bd283b22f16ac), W(0x9357c984bd79fe5d),
+     W(0x2eda73be9d45eee4), W(0x1a50c59f6288e01f), W(0x37baf64975018873)},
+    0
+  },
+  {
+    {W(0xf323953b750261dc), W(0xb8563bf138552a8c), W(0x2937dfd9bd32cb8c),
+     W(0x07c4e5637ecf3538), W(0xb573960eb6399415), W(0xc1ced6c1dd1a4a06)},
+    {W(0xc625f400787ddf7a), W(0xd998c28b1ce6778f), W(0x66c51e5b6220f24d),
+     W(0x9f97d75827d01c6f), W(0x60b157240412372d), W(0x2253abc104d55048)},
+    0
+  },
+  {
+    {W(0xc552c6c6097f322f), W(0xdf59a3028bc06287), W(0xc9ed375c19610b0c),
+     W(0xf0e7b4ebb051dad5), W(0x7267a304c6556643), W(0x0044f6d8c96dc1d8)},
+    {W(0xf0ed5f9af4fc3725), W(0xbbaf9f2c9de8e1ff), W(0xef5d66f4af5a4b4b),
+     W(0x0b5bed3d20644cf2), W(0xf7e4543a75ae23c0), W(0x696f60dc41325b66)},
+    0
+  },
+  {
+    {W(0x04ef7ad5aaa48cd8), W(0xb97a65018a8ac319), W(0x9ae38a6a47591d88),
+     W(0x27d912546902edb4), W(0x5dae3d83812b143a), W(0x02ee135393a2fdf6)},
+    {W(0x07a0038972410377), W(0xa2fbd34356e10c82), W(0x3fd6c17172b1bcb9),
+     W(0xa8d70f932d0033c7), W(0x9ea9eea32916c28a), W(0xecb7e486423edad7)},
+    0
+  },
+  {
+    {W(0x9949b33d2c20f868), W(0xdb3aa790b5706250), W(0x88ce71e788e17f2b),
+     W(0xd851baf2da9c0881), W(0xe869c5ba86d8c9e9), W(0x1af68d65a01425b6)},
+    {W(0xeae8b1c69bbd3963), W(0xf34900b1ec087425), W(0x14942910c374bb96),
+     W(0x3e13c45705487483), W(0xe0e6fad435bc6ee1), W(0xc7c38dc7b54d247b)},
+    0
+  },
+  {
+    {W(0x9c85e50ab9bd0afb), W(0x2b66a1c0d26ac425), W(0xcb78ce81807f33db),
+     W(0x9d337d8a3db81e06), W(0xe223eae472638d70), W(0x7f9ea2176bf2ebab)},
+    {W(0x2804b59c9b634059), W(0x1043fbf4f3dc8d46), W(0x321eca1e7bc6949c),
+     W(0xbf2906c08f051155), W(0xb802a3289c539f40), W(0x08bcca20073cd808)},
+    0
+  },
+  {
+    {W(0x6d34bdf6ab463fa6), W(0x7bb127b60093b9cb), W(0x61d051135a3bfdd0),
+     W(0x4abab575f1296bdd), W(0x72da68494d2e9a7c), W(0x90267bca8d11f03d)},
+    {W(0x478111223e9b310b), W(0x8ffe91d31b1920cd), W(0xec293ec67521898e),
+     W(0xf0cf026996c1da75), W(0xb0dbd4c380f2c7b3), W(0xe528175534e4baf8)},
+    0
+  },
+  {
+    {W(0xb836ce8884585ddd), W(0xb5a36a356a36ca89), W(0x5a0cf5f16056b2c8),
+     W(0xa8dcda7250da0461), W(0x3830acf60b418c0e), W(0x8b5d78aef9cb8072)},
+    {W(0xebc8bd66b3419e5e), W(0xa1ae72bbb56f09a4), W(0x04ab8aff6ad862c8),
+     W(0x4e032db995902119), W(0xe1341b3a10425152), W(0x174128408a24159d)},
+    0
+  },
+  {
+    {W(0x7ce1ce36189e2f1b), W(0x36ca8fe3fa84ca41), W(0x54cc2c13a6a568e4),
+     W(0x1967d9ed25a6d223), W(0xf8d20c88537252af), W(0x5a58936cac3d697c)},
+    {W(0xa2659671b0084ffe), W(0x08a9e041ec25bb0e), W(0x6bd405ed4074cced),
+     W(0xaeebb470dacb5503), W(0x6f18e32bd5448d3e), W(0x0412973ba94cd45d)},
+    0
+  },
+  {
+    {W(0x362403b8c0122c36), W(0x702ffdc8e0002a4a), W(0xb51089854bfe13da),
+     W(0x8b174f2c331218da), W(0xdeffff943512a9cf), W(0x90a57c38760bf998)},
+    {W(0x5941922561deb280), W(0x6132542e93db596f), W(0x0a6ef9c8ca207fd1),
+     W(0xbaa1ceb408eec964), W(0xee262d1952271dc5), W(0x031cceecb3e57fcf)},
+    0
+  },
+  {
+    {W(0xd72fcc3742fb1cd7), W(0xadfb8967c49c359d), W(0x6dc988a55935bb0d),
+     W(0x3fb10981e3080802), W(0x12c4494f3be161ce), W(0x5a0e22d44b649dd0)},
+    {W(0x5c57cbfd62a85259), W(0x7ad55b3c0e5ab7a2), W(0xcd53564928de30e7),
+     W(0xce35e6e76867e6a7), W(0x626810562f6716fb), W(0xd8b4ff26a88d3bf8)},
+    0
+  },
+  {
+    {W(0xbb50eed23d9a5bea), W(0x0ac73bae6658e50e), W(0x3073d34eee73f0a0),
+     W(0xe9c96f51001df029), W(0xbc41d02cdcbde9de), W(0xe8a032735498b190)},
+    {W(0xaf9f55127141ec8e), W(0xd4f607d27a54251f), W(0x3d1d7d8c490219ff),
+     W(0xf7c22bfeb4f7a927), W(0xc3e3c38076b1bf22), W(0x43727daa177b62ef)},
+    0
+  },
+  {
+    {W(0x5949ddfa53abe7a9), W(0x944a2ae0716f63a6), W(0x90961922675d1f43),
+     W(0x36c41c12f5b55722), W(0x85b8250f7782775e), W(0x89a3a733748663be)},
+    {W(0xd4358450475d2d88), W(0x4183f45e1beef8ad), W(0xee3bfe8b06ec8d58),
+     W(0x2e462b1609cc4d82), W(0xf9cc307ec6148e1d), W(0x70d3b2f77b1281a3)},
+    0
+  },
+  {
+    {W(0x5c0008001738c3c6), W(0x4a0baca8536b95cf), W(0xa890c7c4bbf47185),
+     W(0x7c85cb5427323e94), W(0xc9ffa5a262cae5ce), W(0x0df06e735b7a220b)},
+    {W(0x53b79826c8a254dd), W(0xd80d080d4dbbb56a), W(0x7c33aefa43af2a7f),
+     W(0x3f088527b3e88a3e), W(0x6b6b174f7c69900a), W(0xe739b9937aae86ec)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc32730e8dd14d47e), W(0xcdc1fd42c0f01e0f), W(0x2bacfdbf3f5cd846),
+     W(0x45f364167272d4dd), W(0xdd813a795eb75776), W(0xb57885e450997be2)},
+    {W(0xda054e2bdb8c9829), W(0x4161d820aab5a594), W(0x4c428f31026116a3),
+     W(0x372af9a0dcd85e91), W(0xfda6e903673adc2d), W(0x4526b8aca8db59e6)},
+    0
+  },
+  {
+    {W(0x51a033a5cecb916f), W(0x2ac62f638d7de61c), W(0x92eece49a42a266e),
+     W(0x87e037db82c4d11e), W(0x875be1416fbae08a), W(0xf348fe26c539478c)},
+    {W(0x51f8b907ff94c01e), W(0xc46cc0e019695a9d), W(0x2c74bd666c51b9c2),
+     W(0x635d3d24ee565de8), W(0x6bd656638982c8c3), W(0x5c345b79daf6a93c)},
+    0
+  },
+  {
+    {W(0x68fe359de23a8472), W(0x43eb12bd4ce3c101), W(0x0ec652c3fc704935),
+     W(0x1eeff1f952e4e22d), W(0xba6777cb083e3ada), W(0xab52d7dc8befc871)},
+    {W(0x4ede689f497cbd59), W(0xc8ae42b927577dd9), W(0xe0f080517ab83c27),
+     W(0x1f3d5f252c8c1f48), W(0x57991607af241aac), W(0xc4458b0ab8a337e0)},
+    0
+  },
+  {
+    {W(0x179c59cf210c3144), W(0xfb613c5733eebbc4), W(0xdda75cfdba0cf384),
+     W(0x94081a5b3a8fbafa), W(0xb91de90a33384e0b), W(0x7d1f8f4027aa2a45)},
+    {W(0x0747bcc162031148), W(0xd2db8e39f324160b), W(0x9c1ce3e9722484f0),
+     W(0x13a7ee5da62d1dda), W(0x77fd79343a963bce), W(0xcd3d871783d2f21b)},
+    0
+  },
+  {
+    {W(0x3dbb3fa651dd1ba9), W(0xe53c1c4d545e960b), W(0x35ac6574793ce803),
+     W(0xb2697dc783dbce4f), W(0xe35c5bf2e13cf6b0), W(0x35034280b0c4a164)},
+    {W(0xaa490908d9c0d3c1), W(0x2cce614dcb4d2e90), W(0xf646e96c54d504e4),
+     W(0xd74e7541b73310a3), W(0xead7159618bde5da), W(0x96e7f4a8aa09aef7)},
+    0
+  },
+  {
+    {W(0x609deb162d8bcd6e), W(0xe42f23a92591750d), W(0x4a9f3132b378305c),
+     W(0xf101799869275f5e), W(0x14be746761b089b5), W(0x05f620d20c81b0c5)},
+    {W(0xca90a9c06cb8412e), W(0xfe0f6a8915b1b0d5), W(0x1b25ac9620c71988),
+     W(0xb971b61a390aedd0), W(0x995214d779d8cd39), W(0xd7fa135b65c6e11a)},
+    0
+  },
+  {
+    {W(0xa8393a245d6e5f48), W(0x2c8d7ea2f9175ce8), W(0xd8824e0255a20268),
+     W(0x9dd9a272a446bcc6), W(0xc929cded5351499b), W(0xea5ad9eccfe76535)},
+    {W(0x26f3d7d9dc32d001), W(0x51c3be8343eb9689), W(0x91fdcc06759e6ddb),
+     W(0xac2e1904e302b891), W(0xad25c645c207e1f7), W(0x28a70f0dab3deb4a)},
+    0
+  },
+  {
+    {W(0xa13f19b40f3ff12d), W(0x57ee08b1019564aa), W(0x00ec0c997044a6f4),
+     W(0xaf5665f8dca1075c), W(0xded5ca3f0620ab0c), W(0x9b2cb8c7a896deff)},
+    {W(0x032ab2b307df2345), W(0x964d109ef1da3f88), W(0x2286b6f725133304),
+     W(0x0d16d531977a4567), W(0x00a66036f1abae4f), W(0x5debab1d95f0103b)},
+    0
+  },
+  {
+    {W(0x922d7f9703bea8f1), W(0x3ad820d4584570be), W(0x0ce0a8503cd46b43),
+     W(0x4c07911fae66743d), W(0x66519eb9fda60023), W(0x7f83004bec2acd9c)},
+    {W(0x001e0b80c3117ead), W(0xbb72d5410722ba25), W(0x3af7db966e9a5078),
+     W(0x86c5774e701b6b4c), W(0xbd2c0e8e37824db5), W(0x3ae3028cbfac286d)},
+    0
+  },
+  {
+    {W(0xfd1b413f5fb7c5a8), W(0x6152b9de0206cba1), W(0x487f8e3ad8f51960),
+     W(0xac34a23c033ca1bc), W(0x90bba98f60258d55), W(0x30421acfbd9098f2)},
+    {W(0xd9c601f989c0ce44), W(0x621bda832f2f1af1), W(0x14fa7ef638c45441),
+     W(0xbd5dc10fe47faa31), W(0x9dce0dcb74eeb6a1), W(0x2cca3e6606346849)},
+    0
+  },
+  {
+    {W(0x83d4d4a8a33e071b), W(0x881c0a9261444bb5), W(0xeea1e292520e3bc3),
+     W(0x5a5f4c3c2aaab729), W(0x0b766c5ee63c7c94), W(0x62bb8a9fbb2cc79c)},
+    {W(0x97adc7d2aa5dc49d), W(0x30cc26b331718681), W(0xac86e6ff56e86ede),
+     W(0x37bca7a2cd52f7f2), W(0x734d2c949ce6d87f), W(0x06a71d71c2f7e0ca)},
+    0
+  },
+  {
+    {W(0xcdb67ea920066faf), W(0x929b4d2ac7fb7154), W(0x5842d9687fdeb411),
+     W(0x2ddf764aafe55cb9), W(0x608bf76f47df3cf4), W(0x1862463b5984e339)},
+    {W(0x7feea86f944d22a2), W(0xf8562c30281f2b84), W(0x332a54d2bd358ea4),
+     W(0xa54dec9fe7fe1ede), W(0x9c8e52a4932264d4), W(0x428acd1a89817f5b)},
+    0
+  },
+  {
+    {W(0x559dcf75c6357d33), W(0x4616d940652517de), W(0x3d576b981ccf207b),
+     W(0x51e2d1ef1979f631), W(0x57517ddd06ae8296), W(0x309a3d7fd6e7151f)},
+    {W(0xba2a23e60e3a6fe5), W(0x76cf674ad28b22c3), W(0xd235ad07f8b808c3),
+     W(0x7bbf4c586b71213a), W(0x0676792e93271ebb), W(0x2cfd2c7605b1fc31)},
+    0
+  },
+  {
+    {W(0x42aeebc4eda2fa8f), W(0xda91ada3e77a9c5b), W(0x29b9d55fc585a572),
+     W(0xb0e52414a256353d), W(0x1d0e7d5f29adbd21), W(0x7ee5ff9cd057d175)},
+    {W(0x0bf76fcfc9097bf9), W(0x023170f8fe09f5b3), W(0x8a67c1240799f989),
+     W(0x4ce28eebc6a20819), W(0xfc1d7c9179502d13), W(0x7922d2d9de43f895)},
+    0
+  },
+  {
+    {W(0x4258e5c037a450f5), W(0xc3245f1b52d2b118), W(0x6df7b48482bc5963),
+     W(0xe520da4d9c273d1e), W(0xed78e0122c3010e5), W(0x112229483c1d4c05)},
+    {W(0xe3dae5afc692b490), W(0x3272bd10c197f793), W(0xf7eae411e709acaa),
+     W(0x00b0c95f778270a6), W(0x4da76ee1220d4350), W(0x521e1461ab71e308)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf2cdae3196230a58), W(0x47cf36b4f304e1ea), W(0x9d14f25ad750b29b),
+     W(0x931b9c65dba15f3e), W(0x34db169ebf9fe2dd), W(0x8a89e47c52663433)},
+    {W(0x8859a4f8026ec31f), W(0xeeb703eaa913ceea), W(0x74638d6a67ac4db7),
+     W(0x5c8ea7b2be25d755), W(0x8a0f0a8738db10ee), W(0x96a26bace890bcd3)},
+    0
+  },
+  {
+    {W(0x883533af64a5e869), W(0xaaa778c26973ec23), W(0x8f0b5fb546d0fcf3),
+     W(0x7e6b0a0a4ab05da7), W(0xcd91a869c67b6614), W(0x7de9f2ff6c6f7cf2)},
+    {W(0xc072a106d1ec14c3), W(0x3f4b960642a128ee), W(0x7378192c8f0ce946),
+     W(0xdf2e7b9fd1149441), W(0x4fa17cb614ccf45a), W(0x575680e945f03568)},
+    0
+  },
+  {
+    {W(0x0f4ca7803374f910), W(0x5948ae98fedc5b5b), W(0x4873625b4ef805af),
+     W(0xbddba22fc015c586), W(0x7091b50aa41a8c93), W(0x721dd3384c005f42)},
+    {W(0xf43d37462065f41d), W(0xd16bae3e172512b3), W(0x3efca10c8277068f),
+     W(0xd0c25d7b77513f00), W(0xc0015cc12dc3af9b), W(0xdf11a4ec94c6cada)},
+    0
+  },
+  {
+    {W(0x8b70e94f8f458c68), W(0x292726544160ecc7), W(0xe22219ba4d3ef22f),
+     W(0x7f8a712a1999f948), W(0x25575e96abfe7302), W(0x21c6ffc6564a1af0)},
+    {W(0x045e9c667e8500da), W(0xef7c3cf704ef8ea6), W(0xdd23b825c3db161a),
+     W(0x05fb173aba33a906), W(0x9a8b5ecb870e41f2), W(0xf3d9db0bccc30d1d)},
+    0
+  },
+  {
+    {W(0xbed7d94ca1bf2c8c), W(0xbb7f437cb8b719dd), W(0x65416af6106834bf),
+     W(0xdade8a144c4f7448), W(0x62227a1d881dfc06), W(0x37bc7de58dc2b7bc)},
+    {W(0x4f11541712ce030b), W(0x72439d8ac2a9e0d6), W(0x98cc53aba0f1b961),
+     W(0x2f68011d48b0ec8e), W(0x4bbc34679c72d034), W(0x0320c1469c576e38)},
+    0
+  },
+  {
+    {W(0xd9243926e873ff0f), W(0x2e2a5ab6f20b0e49), W(0xa1bcfeee0e35f201),
+     W(0xd25be5f3196f23f3), W(0x298c67f2ffc1d068), W(0x77dae55c0c3d950b)},
+    {W(0x5e15ab998822c996), W(0x52de2e6d83f60a98), W(0xa9f82ec947a7e269),
+     W(0xf02af9a22ac22e49), W(0xdfb3103fa706f090), W(0x125599623cf8dcb0)},
+    0
+  },
+  {
+    {W(0x9f5f44fa666e278f), W(0x53c88803f5582c78), W(0xd7e8f258f9627f9c),
+     W(0x22499dc938fd51bd), W(0xa9d7497c846a4a79), W(0x791b8ead026ae250)},
+    {W(0x84d47d19db15ff63), W(0xb58a82c0267b44b5), W(0x9b2f138806a52e30),
+     W(0x3fc8da027f08953f), W(0x22d074d292fcac08), W(0xb9c7c3db701d73fc)},
+    0
+  },
+  {
+    {W(0xb7b8562588ad12b2), W(0x81f5958b1e44b254), W(0xb4ebddd5c91b8ffd),
+     W(0xef815ae155d38511), W(0x98587d551b0da525), W(0x1d41817734a9ebbd)},
+    {W(0x844811fb1e6057d7), W(0x0c16977176e5976d), W(0x4b268bb4f623789b),
+     W(0xb26ae5be40498058), W(0xb47a5ded3c2b435a), W(0xe15a684b8fceceb3)},
+    0
+  },
+  {
+    {W(0xd55407583353db48), W(0x0e334ccac0c0b5e9), W(0x679a935f270c48d3),
+     W(0x170693e436ef0e90), W(0xc72fb12f9de59023), W(0xaae13a0e9371697c)},
+    {W(0xe98ed704d8d56e4d), W(0xc6de5384eb71f091), W(0xba63adccc6d905a8),
+     W(0xc84e614d66e40dd4), W(0x15dcf1a3fa0f55e3), W(0x4e26ee3af157c7a1)},
+    0
+  },
+  {
+    {W(0x122a3eedd09dc3c8), W(0x6a19907faefe0819), W(0x057aafa1da325339),
+     W(0x138033bdd42a5345), W(0x8ac206af1a065ebe), W(0x0a46f5ae25c31ed6)},
+    {W(0x7fc577a9d7e379db), W(0xc6df694369dcee54), W(0x4c167ba2a8336bc1),
+     W(0x0fbd9708f3a1339c), W(0xc6b8c01f226f612f), W(0x5d4ed789d51332e1)},
+    0
+  },
+  {
+    {W(0x67ead4e0f6a40814), W(0x42fe051ca2ec9ae1), W(0xc09f84395eba62cd),
+     W(0x7bb5ba0c9d8e7305), W(0x85962d0db46f81ab), W(0xc7183752628b18eb)},
+    {W(0x7a1f023edf58ec0c), W(0xf21bfdbaab6535df), W(0x12add590801d2481),
+     W(0x1fccd1e37a11520a), W(0xf83caddd6fa8f8e2), W(0x99e7256c24e58433)},
+    0
+  },
+  {
+    {W(0x26aa2c2e5a1abcd8), W(0x2b16a12e9609d9d8), W(0xe485a551a2bee00c),
+     W(0xfa28c30bf4f2292e), W(0x99abef78b7358f1b), W(0xda6b3cdf10a276a1)},
+    {W(0xbd3858b747c03f71), W(0x4f0bf5f0b22d05d1), W(0x2d80f5d28250f760),
+     W(0x060f9b278cd9666c), W(0x6a6c40b0b1b014a9), W(0x44537af38c440a9e)},
+    0
+  },
+  {
+    {W(0xce1c070a2275263d), W(0x2723b3d149cea971), W(0xedca02f5817001b6),
+     W(0x5c160e9349c946e4), W(0x273b4952458a5265), W(0xc7bcd7c610385173)},
+    {W(0x22cddfd17fb08b14), W(0x959d5dfe10f73d01), W(0x900f5f348e387351),
+     W(0x6d7381dfdadb8695), W(0x8dff2b193aeafba6), W(0xe4a8d6bd8adadc36)},
+    0
+  },
+  {
+    {W(0xb564cfd676faaca5), W(0x8a6e3925920dd223), W(0xee59a140a590a383),
+     W(0x9e29b552a1922ad9), W(0x604367de60a0da63), W(0xc498aca592c35fd0)},
+    {W(0x74135082250ed8a0), W(0x5d109d1a6c7c3e77), W(0xf9e2d84dc63dff94),
+     W(0xca50f5e4f7aa2b0e), W(0x7cba9e87d543d389), W(0xaf5fbbefd8fd1292)},
+    0
+  },
+  {
+    {W(0x3163e2e895bcc345), W(0x4ceaaf2d80d9a931), W(0x4d2dc44b2f621612),
+     W(0x2a5f60b86cc8ffd0), W(0xf49038cf7e8c9434), W(0xb580b8c508015b8f)},
+    {W(0x4283ec01d52af80b), W(0xac9dc35f99076245), W(0x38785f7bd64c3dd8),
+     W(0xca19c17623bf8915), W(0xd778291370478260), W(0xc1e48e6816e34149)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x707656834fc11c3a), W(0x53a9403166aac4d1), W(0x2a935ef0a6db6169),
+     W(0x002927612032d599), W(0xb5babb2d3a6f1316), W(0x601a7dfadb26af51)},
+    {W(0x00c340131322d983), W(0x45b062ec2bb507c5), W(0xa1bbe2ed0f9b3656),
+     W(0xe17a5d4934031d18), W(0xe3661047f8fe1224), W(0x0e4f3b3d623c6cf5)},
+    0
+  },
+  {
+    {W(0x59367582bd27be7b), W(0x92bf5bbc1ab2c596), W(0x5d96351af6a27741),
+     W(0xeab94db87f929e0d), W(0x865ba011043f1afb), W(0x43acea125fb631dd)},
+    {W(0x192e0652b2fd1436), W(0x44f22ff17b38d121), W(0x7bcc228db7cae5f6),
+     W(0x02eaeccd6a828b03), W(0x7c48a2ea91f301aa), W(0x1e090717f5eb1a07)},
+    0
+  },
+  {
+    {W(0x4dd3bd842446fc6a), W(0x4654b82ef25ab510), W(0x1ad46998ba066896),
+     W(0xb7c679acad713bbd), W(0xef9389aff7ca4fa5), W(0x1b864105d68b6a1c)},
+    {W(0x3acfff604b6f5ea4), W(0x81ef58f7b9e5a475), W(0x5e2f6441c66ad734),
+     W(0x49f144c42fd3eb16), W(0xbd7f22082e4e2117), W(0x30865994417911a3)},
+    0
+  },
+  {
+    {W(0xdf0ae8df941948e3), W(0x123fee901d010bcd), W(0xde3717ca1dd28691),
+     W(0x0c1db879709b678e), W(0x0288959a400acdc6), W(0x66c691815ca2d03a)},
+    {W(0xe52534b3dbbb75de), W(0xe914938c3de927cf), W(0x1a9a34f873eece30),
+     W(0x0fb0c7bd642a6799), W(0x375cc0cfeaa7e8a8), W(0x75fb9eb5d00ec238)},
+    0
+  },
+  {
+    {W(0xb67d88fbcb4066b7), W(0x934c1c1397f3e492), W(0xc26e433ede791078),
+     W(0x0ed8fc0a20ec085c), W(0x2684a901b30eefb3), W(0x81bac32be855e8c2)},
+    {W(0x3d31d6c99ed8b5d5), W(0xeea95076c1c14ce2), W(0xd938380e755f1af0),
+     W(0x6a8e434a6c985ecf), W(0x53bec9c1cb65084e), W(0x82a535c070309ec6)},
+    0
+  },
+  {
+    {W(0x9a2461c2f9f10ab7), W(0xe20b1e1ddab4d5fe), W(0x2265bfea0ae15fcf),
+     W(0xd817b3527ac4d98f), W(0x9788aa4511831902), W(0xc3a6f1f6d46161fe)},
+    {W(0x2a7cac2fdcf43c95), W(0x9dcf884e2b48bdfb), W(0x71a648d211070e2e),
+     W(0x6050d8bab7699265), W(0xcf8f24a040aea155), W(0x95df86423522b411)},
+    0
+  },
+  {
+    {W(0x45d4ed64461c147b), W(0xfa22150ccef0a525), W(0x76be29022b267f58),
+     W(0x791c22afc8446afe), W(0xd6ce8b88594d6f50), W(0x8de1a709e3f1f77e)},
+    {W(0x1a72b17007a3676c), W(0x5ea9a5af0d0af559), W(0x6a1c743e1cad2e77),
+     W(0x29ff0a541e0e640d), W(0x4cd519be4b746485), W(0xfb32c5144584f1fb)},
+    0
+  },
+  {
+    {W(0x9ca8cc9db72958eb), W(0x3c8cd0db1014f562), W(0x72115d53059b2bba),
+     W(0x8fe7ac30730e5dc3), W(0x4e67ef69841d8998), W(0xfb6439ffc8ed37a5)},
+    {W(0x48164b3e26df84c4), W(0x37d492ad365bc99e), W(0xb7fd4643beed38ce),
+     W(0x993cfa9fa3e30b3d), W(0xdcc5e7af01ddd484), W(0x5edf3ac06840175d)},
+    0
+  },
+  {
+    {W(0x769e3de6517145ac), W(0x610208cf57239b3e), W(0xf82ec2aa98d55d06),
+     W(0x3c18124695eb2c66), W(0x59d2b24633c8c3f2), W(0x70d97dbd7ffddcef)},
+    {W(0x166be28a434019b6), W(0xf5aba2d2a0906915), W(0x7d776ff4a0b49f2d),
+     W(0x64a95d23885c4257), W(0x23d10b5f38ca72b7), W(0x0d4908600b497caf)},
+    0
+  },
+  {
+    {W(0xae2b1485f73b87a3), W(0xe7d8e42d84474d80), W(0x09ba66d0f465c8c8),
+     W(0x454613624af1b459), W(0xcb2a540daef42e3c), W(0x376146ef170d544f)},
+    {W(0x1df66bc5074ea8c6), W(0xc66a2ac9b0520cfd), W(0x38773e3d3d63908b),
+     W(0xa44887517ade25a2), W(0x12204bb6e67e7950), W(0x771b87fb5d6a30c3)},
+    0
+  },
+  {
+    {W(0x76f6a5bdd4f9410c), W(0x66744d17843b44cf), W(0x34b60fdcfc2b63ea),
+     W(0x6b2475942d739623), W(0x6e683a3344ea1971), W(0x9057bfe5a5632eb2)},
+    {W(0xadfb51f925c79be7), W(0x109e470bd0e83560), W(0x6e70e58f958007ef),
+     W(0x685154a7c6a35513), W(0x5e2e9ce942210e93), W(0x921de0fdd0e88b2c)},
+    0
+  },
+  {
+    {W(0x3ee87e540c19c625), W(0xe4ae611ff4a10f9a), W(0x27d655120aec21e5),
+     W(0x737578f58bea1b16), W(0x6e2b6bf75fb7a3a2), W(0xecc5925114f65000)},
+    {W(0x53e1167cb8dd544c), W(0xee60e60fc5862fdc), W(0xc86582cf6cccabeb),
+     W(0x849fc15d8b4d37c6), W(0xaa7960ad8f4a87bc), W(0x17fe10823b7f0a6d)},
+    0
+  },
+  {
+    {W(0x514736ee4934d0cb), W(0xfc4c8866b7e868d2), W(0xbdaa123003a43746),
+     W(0x8a47ac91acbe1fe5), W(0x92a9c6dde1d1f9f6), W(0x95d16c843e5c2fb5)},
+    {W(0x8ed426385afc73e3), W(0x17b1a6c43c8dc270), W(0x9585d00ce4cc9a48),
+     W(0x7267e4398dc22bb6), W(0x889860e6e6e443bf), W(0x8d64f090ffa82577)},
+    0
+  },
+  {
+    {W(0xb3673b4d65881286), W(0xa8c11817b5af96a1), W(0xdebbd1951def53c1),
+     W(0x9acbb31917ebd057), W(0x237025cc20593968), W(0x1486bd3c291c396d)},
+    {W(0x571bc05d1a40a062), W(0x1913d2dc11abf2e1), W(0x4a1465b9f263c142),
+     W(0xbc05fbe282f8cbda), W(0x03ce731ce8d119f4), W(0x3b26921debada047)},
+    0
+  },
+  {
+    {W(0x22503013417a95ba), W(0xedd4f27ab8ed0598), W(0xb76627a5cca95470),
+     W(0xcb00f645794c13ef), W(0x97a91c65fd9f4ef1), W(0x6c6e4beb32f8bf4a)},
+    {W(0xbabe69afa4221fc8), W(0xb5e97e80c32d4649), W(0x4665c49abb8d4f65),
+     W(0xbd289c430e20104b), W(0x9081b98169eeb8ea), W(0xd10493772150981d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x79768e9f51d33c11), W(0xeec34505a4b24889), W(0xc194821bbe0c67d7),
+     W(0x537a6a4a6909fdfc), W(0xae6d705195ccdda7), W(0xed4b722292b3926c)},
+    {W(0x2c5dd6af6b24a3d4), W(0x9282ec39e4386095), W(0xdd3c7388397a3bd3),
+     W(0x9d176c6a8baf59c2), W(0xd5c6219e380ec958), W(0x194fc11654e8e315)},
+    0
+  },
+  {
+    {W(0x0683349e463a8251), W(0x97dc4f475103e72c), W(0x47c7181050663b9e),
+     W(0xf327d1499733dac6), W(0x03f55e4a292137c5), W(0xccc6232ada59e1c7)},
+    {W(0xbaa8b4ddadc59cb8), W(0x45370d35fe7486e4), W(0x99a88c1db0322df9),
+     W(0x394440a7fd69954f), W(0x9060473da5a29889), W(0xc8ca43e32f04864a)},
+    0
+  },
+  {
+    {W(0x90762c1f5827fe2c), W(0x20160f7aeaffda88), W(0x7420849f5c47c645),
+     W(0xb08231956d72e748), W(0xaeac683b8ee11773), W(0x8c2a0a79fb5c550e)},
+    {W(0x6d986d696c07cc1e), W(0x57269140ba8398b9), W(0xd13e136fd94d5223),
+     W(0x1aa75419ed5b01c6), W(0x7c2014b1408fcdcc), W(0x0680a985cffde5ee)},
+    0
+  },
+  {
+    {W(0xc7d0abb2edee15a5), W(0x72dc0105228cc4a1), W(0xeb67defca80767de),
+     W(0x6fa174d871820908), W(0x3215df485674d19a), W(0xf944531a960a081a)},
+    {W(0x93ed7180ef2cce62), W(0xb318edbfc8bcfc0d), W(0x0909d56efe787e58),
+     W(0x5ae74fc98fe8b96f), W(0x8fc342c435ab6811), W(0x6fc6cc5c0b991e0c)},
+    0
+  },
+  {
+    {W(0xc600dd57354416d9), W(0x6f5840991f829d6b), W(0x2d7b0a27de43c1d6),
+     W(0x21bf3a9e616bdb16), W(0x33ce767c96297953), W(0x99bf97b69e4398b2)},
+    {W(0x4069cced8d441287), W(0x52e0edd6bf01017d), W(0x9981bf89c5394236),
+     W(0x07d9c079acb24e38), W(0xd2e5e904a2da4735), W(0x4c3c12162f1b6cd9)},
+    0
+  },
+  {
+    {W(0xfeecc6e83be5ba68), W(0x3293dbda40445158), W(0x48454e20e81879ca),
+     W(0xd0ea9cb89c4a2712), W(0xba8b6f33540749c3), W(0x95e6d6e3e971df93)},
+    {W(0x4c2a1b13478a2eb5), W(0x8b5f9af330b92170), W(0xe6c60b5343573986),
+     W(0xb9f56a6a57040c00), W(0x6de6489f6291a7b4), W(0xa9a7784653bc3246)},
+    0
+  },
+  {
+    {W(0x828a9dbe67154a02), W(0x57a3af981866aadf), W(0x1558428089faa581),
+     W(0x2da092202dba2a1d), W(0xa225f631df197ae6), W(0x0abff5cf8f4ebabb)},
+    {W(0xbbadc9b3b98e5e4e), W(0x7c7cc36e4509f98f), W(0x072a6cc2759413f6),
+     W(0x7b39ea4121dd1222), W(0xd6baf9e196ac2c73), W(0xee38818c75d46296)},
+    0
+  },
+  {
+    {W(0x55671129542f4e90), W(0x43bedccf0623d4cd), W(0x7e21207ce99ca16b),
+     W(0x785fa1057c7a26b9), W(0x33c28658c2c3ab00), W(0xcce42a48d79cd59f)},
+    {W(0x9a674db4b8c3bc75), W(0xea701d156904e3fe), W(0x990e722166bf2c6c),
+     W(0xba29affabd4c3791), W(0xd98510cf20696ee1), W(0x722ed471f93d26a5)},
+    0
+  },
+  {
+    {W(0x37c70bdf7db1c03f), W(0xd9368612964632ab), W(0xcf6368d742530338),
+     W(0xe56beecbb1d9522e), W(0xb1caaf16bb6fba3a), W(0xb7bd485ac8384d26)},
+    {W(0x4ba13818528d4372), W(0x95c469bab9c5e8f6), W(0x4e5cef0c4a370695),
+     W(0xb87c97ca663f9b07), W(0xa9e1b388e5f3b79a), W(0xc0416bb84c845a1b)},
+    0
+  },
+  {
+    {W(0x3921332a6b393648), W(0x49ec6df649584f38), W(0xa0fc013dce243a6c),
+     W(0xde5b16b5f8da8a00), W(0xabcd0c0471ab1c9a), W(0xff6594bc78b83305)},
+    {W(0x3546004b76c1900b), W(0x87428fa236fb3186), W(0xd2e464ce59cdeb49),
+     W(0x1260bd28faf6ec08), W(0x1ada2f08d0c9d098), W(0xe0b66299dea06396)},
+    0
+  },
+  {
+    {W(0x5006c3a00848d6b7), W(0x726b8648b28285ae), W(0x7162e3c0277c5a87),
+     W(0x567f7ab02019c20a), W(0x490c858fa551d5ef), W(0x0029a108d134a2bb)},
+    {W(0xa9e19284ef0aca3c), W(0xbc399dc16e414f83), W(0x5bdf85f86efa5a8e),
+     W(0x5291e1a674fe7c5f), W(0x249ddf2acd7091df), W(0x71d4cb4c2e29fcf6)},
+    0
+  },
+  {
+    {W(0xedd3291c9dac47a9), W(0x02d64634fb5d396d), W(0x2ce21bf163264c51),
+     W(0x0fdcc68e092c4724), W(0x653acb286e3e4c2f), W(0x2f9c77f12f1fa1ed)},
+    {W(0xd91d4c3aa58afea2), W(0x5a91b2ba7b0d8092), W(0xd47e0f61f10a15fd),
+     W(0x01652d86f9c86ede), W(0x1cc1b668d6006dae), W(0x2763e36d24af68be)},
+    0
+  },
+  {
+    {W(0x35a2685bbb77f5dc), W(0x1b5b79bbc08efa67), W(0x4ebec6e6ea5f411e),
+     W(0x1800a21988c57793), W(0x8d7397f2cbb13c96), W(0xbc13ac35dc0327f4)},
+    {W(0x53ac05a6fd94b150), W(0xd898fa600423e787), W(0x802aad2c2a66b97f),
+     W(0xb604ac0692c62b03), W(0x9f395d3a45911e7d), W(0x5d38164128ae56b6)},
+    0
+  },
+  {
+    {W(0xdf0f79524130138b), W(0x117e4628934c58af), W(0x227be6867b6a4087),
+     W(0xe73fb2f3b8d298a3), W(0xe32e89fda9bacb9d), W(0xdd3be6130e9ea7e3)},
+    {W(0xd3d655ead4da2d1e), W(0x153cce647833bb3d), W(0x4a32a9f0b36da20c),
+     W(0x025768e5a69c4b27), W(0xb0b5da379cf1fcec), W(0xd0ecaba23aa3b99e)},
+    0
+  },
+  {
+    {W(0x79d624c7a7b92932), W(0xcd086bd7cc75e7a8), W(0x3cddc1bbb48eab26),
+     W(0x10282df1f6791cfd), W(0xffedb4fb1048f114), W(0x937ed0e7c092d899)},
+    {W(0x045e4f60b84b6d20), W(0xdd67bd36877ed915), W(0x9bf8fede97617aa9),
+     W(0xa7ff9b0789cb8e1a), W(0xc49e310e74f4e7d6), W(0x12dde0fb3f62eafe)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe7cf5bacbc579793), W(0x11db7ddfd73f881c), W(0x9c1a531d04fa8473),
+     W(0x399e84845780efda), W(0x6e9c12be4f62cb5a), W(0xf21bdc4994a5df3b)},
+    {W(0x3c15fe1211da2a4f), W(0xdea123bb23e631d1), W(0x3ef76da4be294c90),
+     W(0x5cf21d5aa99b8398), W(0x50679cf8751b9f6a), W(0x4b3f3b9c54d0b7bf)},
+    0
+  },
+  {
+    {W(0xc84f917203bdf6d6), W(0xcfc4718769f60e03), W(0xcdc4753ba05068ea),
+     W(0xa177ad14077777ef), W(0x0b7f54eb7e4cf44a), W(0x4ee443f91860144e)},
+    {W(0x1279ed4d42bb6a93), W(0x511137d7436c1b54), W(0xebc958fab8cdb6ce),
+     W(0xbc4f93f4a0c7614a), W(0xc5bd6cde7b2c6d8e), W(0xecff7dd78d65f38a)},
+    0
+  },
+  {
+    {W(0x4da7d63abbaae09b), W(0xcae05f370783fab2), W(0x1e8c001668841d1e),
+     W(0x0688f485b10366f6), W(0x38ee34b005b121e9), W(0x2779f00914e0dc1e)},
+    {W(0x83c1d44edbff60ce), W(0x63fbcf824105c8c2), W(0x6b73274453715349),
+     W(0x5065bdcdc5ca18f6), W(0x677313cf2def86e3), W(0x6c54d22433ebff5d)},
+    0
+  },
+  {
+    {W(0xffec6674f65de0f5), W(0x4043079cd23ad193), W(0x31811365ee61bc95),
+     W(0x358bbd6e8948b6e2), W(0x1cd9c342e31644be), W(0xbab3aa8c60a8a7a7)},
+    {W(0xe065519fa375beb6), W(0xf7d0b0414439990c), W(0x8957c03b8517ae8a),
+     W(0xc96a040173750d6e), W(0x4eb2e364b2aee6d7), W(0x813054feed099114)},
+    0
+  },
+  {
+    {W(0x71714896caada268), W(0xbb3d05dcfd0e302c), W(0xb0785f33fe56d08f),
+     W(0xdd43e0f638a1b2ef), W(0x2df35cfb360fc15a), W(0x97173f0f90b3ed36)},
+    {W(0xd4970bddb720544e), W(0xb6075f7694a01944), W(0xc99e8a3e4a43c4f3),
+     W(0x8013609fd9cb4808), W(0xf3fef0eaecc3d094), W(0x3829fac78642d223)},
+    0
+  },
+  {
+    {W(0xffe3104b684456b1), W(0x37ba0db6f0f49278), W(0x15aaed42cca2f150),
+     W(0x8618aa02c421c694), W(0x4d6a091dfab87b36), W(0x304eaea00e786d5f)},
+    {W(0x0be977472c114074), W(0xf57e3a19ad387a8d), W(0x6094823b7a70d421),
+     W(0x5928791809de860f), W(0x7f7fca496dcf6020), W(0x57580c615f46086e)},
+    0
+  },
+  {
+    {W(0xb509f702f0cb1370), W(0xbdfcf4a0c658441f), W(0x853d832a7f07f328),
+     W(0x074fdecd8fbdcb83), W(0x80ed8de9d6a4650d), W(0x61c39ce8a5d68720)},
+    {W(0xe66666d23177feb4), W(0xdbf3fc57afacf38b), W(0x7e2d99510da620fb),
+     W(0x901145ffdf866f77), W(0x442a37e5db045beb), W(0x0cb0600fbeb1b008)},
+    0
+  },
+  {
+    {W(0xbb39a17a7c34f095), W(0x7be330a822fbbe61), W(0x6be6abe3b91f1482),
+     W(0xf972804fbd39a2bc), W(0x06737e54f91d813e), W(0xbd6066681a87cd4a)},
+    {W(0xbf88b2e5f538d56e), W(0xb8206a8134afd68f), W(0x7a93aedfa58af042),
+     W(0x8853cdf6ac0511b0), W(0x9d7f416d067e2c19), W(0x5d0bc923f9671d8a)},
+    0
+  },
+  {
+    {W(0x7a195a158c27dd52), W(0x253cf1348c54461f), W(0x3b9f296a19afdb9b),
+     W(0x6e4b35c215641f74), W(0xb4d6fa1bfd7e465f), W(0x63f4e6c421b1c78e)},
+    {W(0xbf8cb9f4c6af5bf3), W(0xf6409e560caa8c67), W(0x762ed1fc7150aa46),
+     W(0xdf03548e5bc6b266), W(0x8e0a807b165f83c9), W(0xd57a6fa90fa61f11)},
+    0
+  },
+  {
+    {W(0x9468777a2b389b27), W(0x19eda013c543171e), W(0x2822598ac5d6878a),
+     W(0x5caacb6256583c44), W(0xc3bf31d408595dea), W(0xf20e5b8a6c7e9f94)},
+    {W(0x254897370ba8a1c8), W(0x73ae5d0d2939aa75), W(0x2bd47584bd688e01),
+     W(0x481a5a2f7cdc0d7c), W(0xb8c0d1352cbdaf23), W(0xd0afdf5b9d883c58)},
+    0
+  },
+  {
+    {W(0x36fa495c0c6c7f54), W(0x0c78a007192887ea), W(0xccbbd37c2633510f),
+     W(0x93dda2bd4cd8133a), W(0x56d9a2c7752a7628), W(0xf077798ee29266ca)},
+    {W(0x4c6e900ce0309304), W(0x0bb671da84e15169), W(0xce872028241614d3),
+     W(0xe42c6b62e204374a), W(0x9cfe7f34a07f256d), W(0x304989a059066548)},
+    0
+  },
+  {
+    {W(0xf3b6fd79dd3532a7), W(0xf60262b5dbbb9e4c), W(0xbf75bb57da4d6ac4),
+     W(0xf016adf1c094b38c), W(0x9114cdd012def474), W(0xdc74d638c785f143)},
+    {W(0xdea060d6a8d90bbb), W(0x1f141878cbcd0d4c), W(0x552685b79ddee1f5),
+     W(0x381dfc0c636ea6b6), W(0x8c601615cb08f34f), W(0x5b843830271041ee)},
+    0
+  },
+  {
+    {W(0xcccb20bc0e1c72c0), W(0x3f5a67bb94b5fa45), W(0x87eb0c29f1b24eba),
+     W(0x824b67d8775a9b70), W(0x6f1e6d7616deb581), W(0x72646b5fe6a123ba)},
+    {W(0xdb3ebe7ba7177c68), W(0x5c8b914b19b5018d), W(0xe412850a1d8daa1e),
+     W(0x320b7a7ca538fa24), W(0xd7f6c4fad8670d30), W(0x209ba7ea1154842b)},
+    0
+  },
+  {
+    {W(0x2d268da9b28bdac2), W(0xae3ecda2761b94ba), W(0x535ee486e03c0851),
+     W(0x49a6481891dc89ff), W(0xb9e0718a467f042b), W(0x7b81ecddcfc2ca46)},
+    {W(0x3ae95ed0c166648d), W(0xd44a2420aebbab8f), W(0xe4dbf739c7625e9b),
+     W(0x382e3fee338270c7), W(0xb98c3dc02b382474), W(0x89104b6e85bbff54)},
+    0
+  },
+  {
+    {W(0x4acfb0cf74bb38c9), W(0xeb0ea804caf48595), W(0x6a960ee5f606523e),
+     W(0xa881f33907b133ea), W(0xc58602e03358e396), W(0x095361faa1feb92c)},
+    {W(0x25873ac3a2bf539b), W(0x7bb0ede6f59f542b), W(0xd1400282f743e22c),
+     W(0x428eca096b048a8b), W(0xa1ac3f12a933842a), W(0xa58feb09f6a487e7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x2e7d0a16204be028), W(0x4f1d082ed0e41851), W(0x15f1ddc63eb317f9),
+     W(0xf02750715adf71d7), W(0x2ce33c2eee858bc3), W(0xa24c76d1da73b71a)},
+    {W(0x9ef6a70a6c70c483), W(0xefcf170505cf9612), W(0x9f5bf5a67502de64),
+     W(0xd11122a1a4701973), W(0x82cfaac2a2ea7b24), W(0x6cad67cc0a4582e1)},
+    0
+  },
+  {
+    {W(0x96a1e74f51e4de5e), W(0x72913696e37f5006), W(0x12449c4fbe35109c),
+     W(0x1fad8b304521d7e6), W(0xc85eb23d57d00293), W(0x4ebd334b35f68229)},
+    {W(0x7c5b86682df5acf1), W(0xc2b4da6e5463de2e), W(0x067b0456757cd570),
+     W(0xeaab81be3a1c866b), W(0x72a6af75bbba88c0), W(0xaed4dbde0ef567dc)},
+    0
+  },
+  {
+    {W(0x597a26ffb4dc8600), W(0x264a09f3f9288555), W(0x0b06aff65c27f5f6),
+     W(0xce5ab665d8d544e6), W(0x92f031be99275c32), W(0xaf51c5bbf42e0e7c)},
+    {W(0x5bb28b061e37b36d), W(0x583fba6a8473543a), W(0xe73fd299f93fb7dc),
+     W(0xfcd999a86e2ccad9), W(0xb8c8a6df334d4f57), W(0x5adb28dd9a2acc9b)},
+    0
+  },
+  {
+    {W(0x3afdee277d221ab6), W(0xecf10abc47bb619e), W(0x340c8ee3ba4a3301),
+     W(0x1a6ea51a2a883b7f), W(0x64f27976d5d7412b), W(0x7fcf0ecc91251b6e)},
+    {W(0x5f3f8f41365b18b7), W(0x38e48b96e2e13e58), W(0xde3b73d6ad61b2cb),
+     W(0xf08398d5d542676d), W(0xd373931e8e7d712b), W(0x89325d7a7f96e023)},
+    0
+  },
+  {
+    {W(0x5adf3d9a111792b9), W(0x1c77a3054f1e0d09), W(0xf9fbce33a82d3736),
+     W(0xf307823e718c8aa3), W(0x860578cf416ccf69), W(0xb942add81ef8465b)},
+    {W(0x9ee0cf97cd9472e1), W(0xe6792eefb01528a8), W(0xf99b9a8dc09da90b),
+     W(0x1f521c2dcbf3ccb8), W(0x6bf6694891a62632), W(0xcc7a9ceb854fe9da)},
+    0
+  },
+  {
+    {W(0xe44e3f864b3759cf), W(0x90cab0eb9d74e3f6), W(0x1004254501c4e171),
+     W(0xc12df68cce52defb), W(0xb1fae2fbf363100a), W(0x5016c8533573235f)},
+    {W(0x8d4deb661d922e9b), W(0x8a20d42317f84ef2), W(0x324985835a4e118e),
+     W(0x5abfa961308772e9), W(0x41c7611ff54e4876), W(0xc1da40d31f5867b2)},
+    0
+  },
+  {
+    {W(0x46303171491ccb92), W(0xa80a8c0d2771235b), W(0xd8e497fff172c7cf),
+     W(0x7f7009d735b193cf), W(0x6b9fd3f7f19df4bc), W(0xada548c3b46f1e37)},
+    {W(0x87c6eaa9c7a20270), W(0xef2245d6ae78ef99), W(0x2a121042539eab95),
+     W(0x29a6d5d779b8f5cc), W(0x33803a10b77840dc), W(0xfedd3a7011a6a30f)},
+    0
+  },
+  {
+    {W(0x3c90a59f85adde98), W(0x35414174e5269140), W(0x9aca885c1a0d58e2),
+     W(0x77b9b6dd6816b009), W(0x8e5c12139ee4718f), W(0x60ad991e4e4eac45)},
+    {W(0xc00c35694d71f624), W(0xacbf4eb25bc5fd2a), W(0xcba1ffc75eaf3eaa),
+     W(0x5f99092d42a87e32), W(0x2e7b49c76f7a882f), W(0x5e9bfc5c29040512)},
+    0
+  },
+  {
+    {W(0xfa070e22142403d1), W(0x68ff316015c6f7f5), W(0xe09f04e6223a0ce8),
+     W(0x22bbd01853e14183), W(0x35d9fafccf45b75b), W(0x3a34819d7eceec88)},
+    {W(0xd9cf7568d33262d2), W(0x431036d5841d1505), W(0x0c8005659eb2a79a),
+     W(0x8e77d9f05f7edc6a), W(0x19e12d0565e800aa), W(0x335c8d36b7784e7c)},
+    0
+  },
+  {
+    {W(0x75cba9d530a3ada1), W(0xb69e308bf8ae9565), W(0x990e3425ca7b8369),
+     W(0x9f67567fe0a7ad0b), W(0x76ed6fe718bd01b7), W(0x282358aa2ff95cfe)},
+    {W(0x28d2ea41410f8841), W(0x89d1533fccd67c81), W(0x969bb272b6a7b8f9),
+     W(0x54f8664c26330782), W(0xb89f3ae81dcd9164), W(0x54d845b93d962c14)},
+    0
+  },
+  {
+    {W(0x8b2fc4e96484fd40), W(0xee702764a35d24ea), W(0x15b28ac7b871c3f3),
+     W(0x805b4048e097047f), W(0xd6f1b8df647cad2f), W(0xf1d5b458dc7dd67f)},
+    {W(0x324c529c25148803), W(0xf6185ebe21274faf), W(0xaf14751e95148b55),
+     W(0x283ed89d28f284f4), W(0x93ad20e74cbebf1a), W(0x5f6ec65d882935e1)},
+    0
+  },
+  {
+    {W(0xb3984b176c0f3509), W(0xf9fa4483d8b4d6bc), W(0xf4ac2b677dec20d2),
+     W(0x67ef024eb3dbe034), W(0x2dcc51180f94f4d7), W(0x024cdcfd74a51393)},
+    {W(0xf1c0fead20e7abcb), W(0xffc18f81d3a7414f), W(0xb00ce5567062cb0b),
+     W(0xeccb0521817bc8d1), W(0xa0c0fe6040411c15), W(0x053113221defbe00)},
+    0
+  },
+  {
+    {W(0xe222eba4a4dcefe9), W(0x63ad235fec1ceb74), W(0x2e0bf749e05b18e7),
+     W(0x547bd050b48bdd87), W(0x0490c970f5aa2fc4), W(0xced5e4cf2b431390)},
+    {W(0x07d8270451d2898e), W(0x44b72442083b57d4), W(0xa4ada2305037fce8),
+     W(0x55f7905e50510da6), W(0xd8ee724f8d890a98), W(0x925a8e7c11b85640)},
+    0
+  },
+  {
+    {W(0xda828fe556467257), W(0x5e9abf67d640c2a1), W(0x0eed233cc25c696a),
+     W(0x72483dc5b3e1d84f), W(0x30bf1ee34f114abc), W(0xf58b321ed1f9bce8)},
+    {W(0xcb26564c97524f33), W(0xdc2f105e1e453229), W(0x9da43ceb72a982dd),
+     W(0xecf5649dfeef8862), W(0xd8afda341fa2f06d), W(0xf0d0ced355035432)},
+    0
+  },
+  {
+    {W(0x5bfa10cd1ca459ed), W(0x593f085a6dcf56bf), W(0xe6f0ad9bc0579c3e),
+     W(0xc11c95a22527c1ad), W(0x7cfa71e1cf1cb8b3), W(0xedcff8331d6dc79d)},
+    {W(0x581c4bbe432521c9), W(0xbf620096144e11a0), W(0x54c38b71be3a107b),
+     W(0xed555e37e2606ec0), W(0x3fb148b8d721d034), W(0x79d53dad0091bc90)},
+    0
+  }
+};
+
+static const wge_t p384_wnd_naf[1024] = {
+  {
+    {W(0x3dd0756649c0b528), W(0x20e378e2a0d6ce38), W(0x879c3afc541b4d6e),
+     W(0x6454868459a30eff), W(0x812ff723614ede2b), W(0x4d3aadc2299e1513)},
+    {W(0x23043dad4b03a4fe), W(0xa1bfa8bf7bb4a9ac), W(0x8bade7562e83b050),
+     W(0xc6c3521968f4ffd9), W(0xdd8002263969a840), W(0x2b78abc25a15c5e9)},
+    0
+  },
+  {
+    {W(0x05e4dbe6c1dc4073), W(0xc54ea9fff04f779c), W(0x6b2034e9a170ccf0),
+     W(0x3a48d732d51c6c3e), W(0xe36f7e2d263aa470), W(0xd283fe68e7c1c3ac)},
+    {W(0x7e284821c04ee157), W(0x92d789a77ae0e36d), W(0x132663c04ef67446),
+     W(0x68012d5ad2e1d0b4), W(0xf6db68b15102b339), W(0x465465fc983292af)},
+    0
+  },
+  {
+    {W(0xbb595eba68f1f0df), W(0xc185c0cbcc873466), W(0x7f1eb1b5293c703b),
+     W(0x60db2cf5aacc05e6), W(0xc676b987e2e8e4c6), W(0xe1bb26b11d178ffb)},
+    {W(0x2b694ba07073fa21), W(0x22c16e2e72f34566), W(0x80b61b3101c35b99),
+     W(0x4b237faf982c0411), W(0xe6c5944024de236d), W(0x4db1c9d6e209e4a3)},
+    0
+  },
+  {
+    {W(0xdf13b9d17d69222b), W(0x4ce6415f874774b1), W(0x731edcf8211faa95),
+     W(0x5f4215d1659753ed), W(0xf893db589db2df55), W(0x932c9f811c89025b)},
+    {W(0x0996b2207706a61e), W(0x135349d5a8641c79), W(0x65aad76f50130844),
+     W(0x0ff37c0401fff780), W(0xf57f238e693b0706), W(0xd90a16b6af6c9b3e)},
+    0
+  },
+  {
+    {W(0x2f5d200e2353b92f), W(0xe35d87293fd7e4f9), W(0x26094833a96d745d),
+     W(0xdc351dc13cbfff3f), W(0x26d464c6dad54d6a), W(0x5cab1d1d53636c6a)},
+    {W(0xf2813072b18ec0b0), W(0x3777e270d742aa2f), W(0x27f061c7033ca7c2),
+     W(0xa6ecaccc68ead0d8), W(0x7d9429f4ee69a754), W(0xe770633431e8f5c6)},
+    0
+  },
+  {
+    {W(0xc7708b19b68b8c7d), W(0x4532077c44377aba), W(0x0dcc67706cdad64f),
+     W(0x01b8bf56147b6602), W(0xf8d89885f0561d79), W(0x9c19e9fc7ba9c437)},
+    {W(0x764eb146bdc4ba25), W(0x604fe46bac144b83), W(0x3ce813298a77e780),
+     W(0x2e070f36fe9e682e), W(0x41821d0c3a53287a), W(0x9aa62f9f3533f918)},
+    0
+  },
+  {
+    {W(0x9b7aeb7e75ccbdfb), W(0xb25e28c5f6749a95), W(0x8a7a8e4633b7d4ae),
+     W(0xdb5203a8d9c1bd56), W(0xd2657265ed22df97), W(0xb51c56e18cf23c94)},
+    {W(0xf4d394596c3d812d), W(0xd8e88f1a87cae0c2), W(0x789a2a48cf4d0fe3),
+     W(0xb7feac2dfec38d60), W(0x81fdbd1c3b490ec3), W(0x4617adb7cc6979e1)},
+    0
+  },
+  {
+    {W(0x446ad8884709f4a9), W(0x2b7210e2ec3dabd8), W(0x83ccf19550e07b34),
+     W(0x59500917789b3075), W(0x0fc01fd4eb085993), W(0xfb62d26f4903026b)},
+    {W(0x2309cc9d6fe989bb), W(0x61609cbd144bd586), W(0x4b23d3a0de06610c),
+     W(0xdddc2866d898f470), W(0x8733fc41400c5797), W(0x5a68c6fed0bc2716)},
+    0
+  },
+  {
+    {W(0x8903e1304b4a3cd0), W(0x3ea4ea4c8ff1f43e), W(0xe6fc3f2af655a10d),
+     W(0x7be3737d524ffefc), W(0x9f6928555330455e), W(0x524f166ee475ce70)},
+    {W(0x3fcc69cd6c12f055), W(0x4e23b6ffd5b9c0da), W(0x49ce6993336bf183),
+     W(0xf87d6d854a54504a), W(0x25eb5df1b3c2677a), W(0xac37986f55b164c9)},
+    0
+  },
+  {
+    {W(0x82a2ed4abaa84c08), W(0x22c4cc5f41a8c912), W(0xca109c3b154aad5e),
+     W(0x23891298fc38538e), W(0xb3b6639c539802ae), W(0xfa0f1f450390d706)},
+    {W(0x46b78e5db0dc21d0), W(0xa8c72d3cc3da2eac), W(0x9170b3786ff2f643),
+     W(0x3f5a799bb67f30c3), W(0x15d1dc778264b672), W(0xa1d47b23e9577764)},
+    0
+  },
+  {
+    {W(0x08265e510422ce2f), W(0x88e0d496dd2f9e21), W(0x30128aa06177f75d),
+     W(0x2e59ab62bd9ebe69), W(0x1b1a0f6c5df0e537), W(0xab16c626dac012b5)},
+    {W(0x8014214b008c5de7), W(0xaa740a9e38f17bea), W(0x262ebb498a149098),
+     W(0xb454111e8527cd59), W(0x266ad15aacea5817), W(0x21824f411353ccba)},
+    0
+  },
+  {
+    {W(0xd1b4e74d12e3683b), W(0x990ed20b569b8ef6), W(0xb9d3dd25429c0a18),
+     W(0x1c75b8ab2a351783), W(0x61e4ca2b905432f0), W(0x80826a69eea8f224)},
+    {W(0x7fc33a6bec52abad), W(0x0bcca3f0a65e4813), W(0x7ad8a132a527cebe),
+     W(0xf0138950eaf22c7e), W(0x282d2437566718c1), W(0x9dfccb0de2212559)},
+    0
+  },
+  {
+    {W(0x1e93722758ce3b83), W(0xbb280dfa3cb3fb36), W(0x57d0f3d2e2be174a),
+     W(0x9bd51b99208abe1e), W(0x3809ab50de248024), W(0xc29c6e2ca5bb7331)},
+    {W(0x9944fd2e61124f05), W(0x83ccbc4e9009e391), W(0x01628f059424a3cc),
+     W(0xd6a2f51dea8e4344), W(0xda3e1a3d4cebc96e), W(0x1fe6fb42e97809dc)},
+    0
+  },
+  {
+    {W(0xa04482d2467d66e4), W(0xcf1912934d78291d), W(0x8e0d4168482396f9),
+     W(0x7228e2d5d18f14d0), W(0x2f7e8d509c6a58fe), W(0xe8ca780e373e5aec)},
+    {W(0x42aad1d61b68e9f8), W(0x58a6d7f569e2f8f4), W(0xd779adfe31da1bea),
+     W(0x7d26540638c85a85), W(0x67e67195d44d3cdf), W(0x17820a0bc5134ed7)},
+    0
+  },
+  {
+    {W(0x019d6ac5d3021470), W(0x25846b66780443d6), W(0xce3c15ed55c97647),
+     W(0x3dc22d490e3feb0f), W(0x2065b7cba7df26e4), W(0xc8b00ae8187cea1f)},
+    {W(0x1a5284a0865dded3), W(0x293c164920c83de2), W(0xab178d26cce851b3),
+     W(0x8e6db10b404505fb), W(0xf6f57e7190c82033), W(0x1d2a1c015977f16c)},
+    0
+  },
+  {
+    {W(0xa39c89317c8906a4), W(0xb6e7ecdd9e821ee6), W(0x2ecf8340f0df4fe6),
+     W(0xd42f7dc953c14965), W(0x1afb51a3e3ba8285), W(0x6c07c4040a3305d1)},
+    {W(0xdab83288127fc1da), W(0xbc0a699b374c4b08), W(0x402a9bab42eb20dd),
+     W(0xd7dd464f045a7a1c), W(0x5b3d0d6d36beecc4), W(0x475a3e756398a19d)},
+    0
+  },
+  {
+    {W(0x61333a382fb3ba63), W(0xdf330d9d5b943c86), W(0xbbc7c7ee955ef3af),
+     W(0xda631fc160f09efb), W(0x68af622641d5c400), W(0xcc9e97a46c833e9d)},
+    {W(0x7fd73e8e3a625e76), W(0x13bf6124c209e55e), W(0x08467cea48b90b91),
+     W(0x8a416eb9bb6f0aba), W(0x6fcc93a1b8c31072), W(0xa7fd2b619057dad7)},
+    0
+  },
+  {
+    {W(0x58a5b5433720ec9b), W(0xbb3800d52d7c2fb4), W(0x4a508620dde6bd0a),
+     W(0x65f16273a02583fd), W(0x832bd8e34fc78523), W(0xd6149f75e9417bc6)},
+    {W(0xfeb026e93deeb52a), W(0x0ce18088a55e0956), W(0x50018998988092a2),
+     W(0x22f19fab28f35eee), W(0xac8a877f52ccd35c), W(0xb13a8ad830e23f26)},
+    0
+  },
+  {
+    {W(0x0202d57de44f61a3), W(0x4027704bb5630ef2), W(0xa129e2dff5b54a5d),
+     W(0xacb60a7597482b86), W(0x9261ede87ef27114), W(0x1eba28f3defc58b5)},
+    {W(0x6c91c0c98be5589e), W(0x2f1643d514594bee), W(0x2ea912435d2ca034),
+     W(0xb50649a894047d1f), W(0x284fcbb5638ca337), W(0xfa0e07b7fe85bf85)},
+    0
+  },
+  {
+    {W(0x7d894f80506e0e42), W(0xd984244a8e3d2c46), W(0x6d7edf642b7f006f),
+     W(0x36a1cd6dde9b6230), W(0xc9985040b76c0665), W(0x587df4d6b89b1fc2)},
+    {W(0x4c0638476a71ae7a), W(0x7b2b0ab3e8294747), W(0x345c553ab53153b8),
+     W(0xb646e453436d9fe2), W(0x1a95355f1cd60340), W(0x2d7bc128074968fb)},
+    0
+  },
+  {
+    {W(0xad148e87bca6d14c), W(0x41dfd24d456a201e), W(0x73a82933a80d68f3),
+     W(0x89746c8d852ca035), W(0xe3bc778895fd71ae), W(0x8764cd2cda92245d)},
+    {W(0xa2fe2c4782eb23e2), W(0x5ac762e00f3c9d6e), W(0x57860ce121646f31),
+     W(0xbdc9d6c34f9f589a), W(0x679952c7d193272e), W(0x82ea702eeb18f1c5)},
+    0
+  },
+  {
+    {W(0x37fa935500846d44), W(0x09112fc50578bc8c), W(0xdad9f5b239c4943d),
+     W(0x7314f5f0416dbd86), W(0x5cf095a901fefb56), W(0x35178bad22dab393)},
+    {W(0xcf79fc1b36baf1a7), W(0x1b7ee42d749e5498), W(0xbce78aa9ede314bb),
+     W(0xaaf8e0f6bd0628df), W(0xa974b09415cbf948), W(0x8f3f1f63c9632b78)},
+    0
+  },
+  {
+    {W(0xd4c411564fddda5b), W(0xd4af65c673ad9112), W(0xffe8e0bb39eb8f59),
+     W(0xb0040c0e8d6fcf13), W(0x99e1c0c61f2bb599), W(0x9c94c858b2ac3405)},
+    {W(0x8f8878d76eeed85d), W(0x62b2f54351fcca3f), W(0xeb3b44a9e5b56918),
+     W(0x16f96676b7234e93), W(0x17477722bd2af19e), W(0x42eb2979db83a485)},
+    0
+  },
+  {
+    {W(0x6f888f7df0c668ca), W(0x65c788785f0dc66c), W(0xbfb185125f5b07a0),
+     W(0x780abff7d878acd0), W(0x504f21b1570cf950), W(0xea5b37c5da233371)},
+    {W(0x487ae8bd22437ed1), W(0x9c701758249cf9b7), W(0xf86562a898fb34ff),
+     W(0xdfeea1a265e0fc91), W(0xeef006912e20fc23), W(0xac9dfec7dfa72a8b)},
+    0
+  },
+  {
+    {W(0xfa5c3aef697136c6), W(0x8ea5af63a5ea6fb8), W(0xa669156542e365a4),
+     W(0x47c56c115b6e3386), W(0x1197832bcea03f56), W(0x0b470bb250e4ea9e)},
+    {W(0x3113c74313b25712), W(0x8d6c174ed2497d48), W(0xfc4486ee49c9ebe8),
+     W(0x2487edd57f82bdd3), W(0x771e64415b57be2f), W(0x2d1cc518e28b2bdb)},
+    0
+  },
+  {
+    {W(0x2c4ccac72070ac8d), W(0x1947c0caec4a22b8), W(0xa5e0fb598c5a78d9),
+     W(0x464ae8d241a84de7), W(0x3dba16e9daaabc27), W(0x16634a504f35cb3c)},
+    {W(0xadc18bf9b16ec84f), W(0x324d067e7359dd35), W(0xdaeac0c3570543f0),
+     W(0x0b2240003c887d36), W(0xc69489e2373f1a0d), W(0x518b047dcbaa0d97)},
+    0
+  },
+  {
+    {W(0x3b1bddc6fbde49ef), W(0xdaed7c268a0915cc), W(0x0b0110610f0422a2),
+     W(0xcf485c74a7c54b16), W(0x642ec4e615c3aae2), W(0xa8ba8f10e0f383ea)},
+    {W(0x2a2054b495618501), W(0xebec6442089efa8b), W(0x5786a19a4e2fa83e),
+     W(0xd2c71ad139069963), W(0xadc93d9a481765e2), W(0xedf2e3eb7ecc9485)},
+    0
+  },
+  {
+    {W(0xbcab5f60069f3367), W(0xfd6622bc1718ec3c), W(0xa4fb7867e3a142d6),
+     W(0x6078d8bf085faeb3), W(0xfa5cbfda60f4554f), W(0xb3fcd5d1690cd408)},
+    {W(0x4ebdee7d281f7884), W(0x82af23aa180a63a7), W(0x8de3107c3d079f61),
+     W(0x17c6b5cbbe2334f8), W(0x6a91e73997d0fa06), W(0x7460257314ceeed4)},
+    0
+  },
+  {
+    {W(0xb14ba61cf97f865c), W(0x73bae4c1694b8b0d), W(0xa14967dfac4bbf62),
+     W(0x1e9dd1509bf446e0), W(0xc052f3eb1c99ceef), W(0x814d7fa07a78c189)},
+    {W(0xa101a483ab74b05d), W(0x7788c258a1737b65), W(0x0d60bab7e809a13c),
+     W(0x8f427bc473c81d5b), W(0xd2e130552952c1fc), W(0x0a823b9a4b26df63)},
+    0
+  },
+  {
+    {W(0xaf467ce227bf64c9), W(0xdfca6897f929974c), W(0x64473b595c322738),
+     W(0x96a917cf1ed0e315), W(0x3703435b0de64db9), W(0x9ba039679267b646)},
+    {W(0xdf0c2aae3a522fbe), W(0x41bdb741b335eff0), W(0xaccf2edd7b059703),
+     W(0x6fb34b3028463cce), W(0x96d9ba0bd9e3ca19), W(0xff336f12504655c1)},
+    0
+  },
+  {
+    {W(0x48da1fd3fc60a6e0), W(0x54fb5a34222241e8), W(0x6035e34f772ae080),
+     W(0x5ff77ff2332982d0), W(0x2366467300fe51fd), W(0xc93ea049ef6ba006)},
+    {W(0x6640f1177d381266), W(0x394d32cd6ae9f4ac), W(0xe6a7885370d303eb),
+     W(0x0dda19ffe5275767), W(0xb0a6c77201466d23), W(0xc4cc11451fc69829)},
+    0
+  },
+  {
+    {W(0xc5c0e6d7aaed89c0), W(0x6ce8ead6149a1896), W(0x7a50f7458c949f8f),
+     W(0xcd7e35f76e2b71aa), W(0xf6159e519a049f7a), W(0x1c9bf0b0f1e52d1e)},
+    {W(0x3bb6c1f518202c80), W(0x8d3a5f621ecd7b1a), W(0x3bb034e888d17f19),
+     W(0xdc89bd4997d4048d), W(0xf5af7b8e3735df22), W(0x52bb3712a0a689e8)},
+    0
+  },
+  {
+    {W(0x8e469454839b9679), W(0xbecda43b0d1d279f), W(0xcf9edc15edb63c80),
+     W(0x4597ec8abdd5f002), W(0x8b0350b2650b2253), W(0xb84c3a6a5fd4266f)},
+    {W(0x0e16d83d30fc79f9), W(0xb6a487833ad995d3), W(0xab784b2cde2bc266),
+     W(0x19763d6d889d66dd), W(0xa2866c24c8f9f087), W(0xea6f2528a55bb1c9)},
+    0
+  },
+  {
+    {W(0x6efc5cbc8b1772ca), W(0xeac7dd3b0b634f68), W(0x65d75edaa55d6185),
+     W(0x556e637e6ef3d8f7), W(0xf9af3e4d90909d25), W(0xe462ca48e153035a)},
+    {W(0x52763b7b0a109ed1), W(0x104ab1a642785d06), W(0x1a7e35ed3f59e4bc),
+     W(0x5990b746c6ebc003), W(0x096a6bf01362c5f9), W(0x8322cb8aac794994)},
+    0
+  },
+  {
+    {W(0xf8d3df74670c2752), W(0x5ccb2859a1115e28), W(0xcc66c8aa0f19981b),
+     W(0xd4bcc8b125abfd65), W(0x2c86ee164fdd3cca), W(0x59d65d78a3f735f4)},
+    {W(0x035ade287c0c55ce), W(0x57769d6245d3994d), W(0xd13ae4892bd423a4),
+     W(0x0aceee4882ed66bc), W(0x6f2c9e8b73167a32), W(0xfbcd0100271dbd7a)},
+    0
+  },
+  {
+    {W(0xc42ece45effefcb1), W(0xbf5731b3abb11441), W(0x93ba15cfe58d0a92),
+     W(0x27bbde143508ac54), W(0x2b123738fe255dda), W(0x0b4faa5a537ecd70)},
+    {W(0x6a44d084ddec83c6), W(0x86793c4d0801523d), W(0x154f285025b3e319),
+     W(0x2144daf1ce64373a), W(0xbdb924ee07139566), W(0xf9a7ea28732ad01c)},
+    0
+  },
+  {
+    {W(0x43385c32d851a702), W(0xa9c2a9b11de8963b), W(0x5b8d230bdf8b9b24),
+     W(0x9029a9252d3731c2), W(0xb08db04de8caa7d2), W(0xb89d83e72bf4673c)},
+    {W(0xa8fd39bfe1f24424), W(0x9f89b6d6e1e8d616), W(0xaf9fc87b4f1d216e),
+     W(0x04e21e0392265a59), W(0x0b15740387b86373), W(0x6f65af3b7c98a162)},
+    0
+  },
+  {
+    {W(0x6b5d4014867303de), W(0xc8cbc40a420ab7ef), W(0x5b28cf8991549a96),
+     W(0x5d4631b4392f8f66), W(0x4a7ee23df367b5c8), W(0xa1e0ae0fe6ca7a15)},
+    {W(0x2a655ee1139fa27c), W(0xa531c2c450fab901), W(0x6762ab69430aed71),
+     W(0x64e239e3f0402e1d), W(0xd7870042957fe445), W(0xfd42d862417d6562)},
+    0
+  },
+  {
+    {W(0x9f2134c12a501a3f), W(0x114a9b40334793a7), W(0x27ccb6c0212a6125),
+     W(0x0ca930b998ce78a3), W(0x742e060b28a12627), W(0x63d23607fa5c9816)},
+    {W(0x774dcba4ec1f91dc), W(0x34cd7e2ef34d1d23), W(0x1500850e49fd3c3d),
+     W(0xdd03950030c9cfb2), W(0xce61c3e5572941a6), W(0xd44b1075302cfd2e)},
+    0
+  },
+  {
+    {W(0xca11d9d4e9a6c224), W(0x2cdac248c3b74585), W(0xe58901a204ca5571),
+     W(0x491c312dd15d01f0), W(0xb3cc818a7069cb7c), W(0x23b245a5d53912da)},
+    {W(0x30f7838ba6b0b163), W(0xa052eb3e32775552), W(0x403243e9eeb95ec1),
+     W(0x617b301b08632eb3), W(0x941c66c9f30281f9), W(0x4b9728f81d7ab255)},
+    0
+  },
+  {
+    {W(0x3cbdd3cbdb06f682), W(0xde45473e86c08785), W(0xd8cb3560e07b1bfb),
+     W(0xf2c3118feaf138af), W(0x11238a859f436faf), W(0x0984c2e37cdf344f)},
+    {W(0xe1083c17c382584f), W(0x959a14d4736fa240), W(0x56add2f018f2637d),
+     W(0x01047a5ee5dd278d), W(0x5de38d63ae2706a7), W(0x9dd7b7609745b87e)},
+    0
+  },
+  {
+    {W(0x8e61f0bf44e94071), W(0x44cf847ed2f05eb4), W(0x8487aa0d4a6694eb),
+     W(0xeeb88ca1c7a4aab5), W(0xc25baa03520a8926), W(0xa075b16ac03d7805)},
+    {W(0xc357a48a13d970c3), W(0x4e3c13706009643e), W(0xcf21a95749e60429),
+     W(0x0aa262ba2251bcda), W(0xb72a7cd0563c78e4), W(0x773dfeda69ce1cf9)},
+    0
+  },
+  {
+    {W(0x935d2cdf9b06762d), W(0x2148bbb88207255a), W(0x7bbdcadd053153d8),
+     W(0xd953aaff73256a57), W(0xb0a08fe1114e6f01), W(0xc835025446e64d4d)},
+    {W(0xe7cfbad800dbc157), W(0x392aae0271fbe969), W(0x7422a72a0bebe314),
+     W(0xc3d455d22caf52f2), W(0xa231839fe2895195), W(0x6c218d92c993f213)},
+    0
+  },
+  {
+    {W(0x4f11a02e4aa0372e), W(0x5942473010967775), W(0xdf0ec1ba8b809195),
+     W(0xf30a928d9a3c3af1), W(0xc4840320387b6b2e), W(0x1c1b3417a500bb22)},
+    {W(0x690ee6c7bf3266f2), W(0x18246d74a7909681), W(0xdedf2454f984a88f),
+     W(0x31944175e7559f09), W(0xbdac81880e7b4db7), W(0x9f046faee996fe68)},
+    0
+  },
+  {
+    {W(0x0c62094b2d71d4ac), W(0x18a49fdc4bf163e0), W(0x463df30b0096721f),
+     W(0x67d3644ac8e55b7b), W(0xd63dd29d19e0e2b6), W(0xd0d105de164b7361)},
+    {W(0xe5865c4e0217188e), W(0x7861b71b2093cf7e), W(0x65ccf0512daa253c),
+     W(0x147701090b4de4c0), W(0x1d28243540b962d9), W(0x01c7e939b8df37f3)},
+    0
+  },
+  {
+    {W(0x5dea409c9cba0858), W(0x35c2421b14ae3f63), W(0xa4f6e534bbc2618a),
+     W(0xb04b977d42d74f5f), W(0xe7e7382759dc3eb7), W(0xeb0f52348bf223b0)},
+    {W(0x991c51670fc75158), W(0xd012811a3fde2c6d), W(0x09d0b3319236343d),
+     W(0xcb78e0c863a2cba0), W(0x0b09b3bd9ab88478), W(0x47cac703f116c6e2)},
+    0
+  },
+  {
+    {W(0xebd14d71e32d80af), W(0x1b1cc24f5380675e), W(0x1c634764b16142cd),
+     W(0x7a3545de7cfdb00e), W(0x2df91689cfd15154), W(0x813355b3430aa2d7)},
+    {W(0x16dce2c985f2ca7e), W(0xd9e303f7e03abb79), W(0xfe7ca8103cb06698),
+     W(0x572a425b71670dcb), W(0xc71b395490a268e5), W(0xc071f38f66bf9d09)},
+    0
+  },
+  {
+    {W(0x0fc0f2630dbc3c91), W(0x9f74ca169bc0cbb1), W(0x4a607b9d0ef98977),
+     W(0x0be90befa27d2b79), W(0x257b0bb5ad7f23e1), W(0xb8f42fe52fead1e4)},
+    {W(0xde78e4315f93b592), W(0x505fe7ebfd79617d), W(0x45cc3f14dd99f9fb),
+     W(0x8c0f64e83bc7b591), W(0x65364ded55ab93f9), W(0xbb6d4ba542df286e)},
+    0
+  },
+  {
+    {W(0x7cd2035d7f5c54e2), W(0xc1f0db004a49492c), W(0x8f273e3065278f98),
+     W(0x10241ed16fef9d9d), W(0x87b1e51bac069616), W(0x8c081acd170d807f)},
+    {W(0x005051ea1c73b598), W(0xe4eb5512d6865bf4), W(0xd7d24ef430e05dd3),
+     W(0xcb47e4ed7889a39e), W(0x4c3e2491c4f56964), W(0x83c6b78ec4f03006)},
+    0
+  },
+  {
+    {W(0x6e3835a9b05f84a1), W(0xbb4f9e0f41aa174e), W(0x1b41177c708ba469),
+     W(0xb9b2e6b479c8f8bd), W(0xd49cae0982d9d6bd), W(0x648c5f00bb28223a)},
+    {W(0x04f485765d8cc4a5), W(0xfe3096dd81a0a38d), W(0x6675138f708247e1),
+     W(0xd6f759d8d1a0ea08), W(0x1f7493b176190d98), W(0x03e1698b322d63bd)},
+    0
+  },
+  {
+    {W(0x8e66c6f69b8adeac), W(0xb539f5fe50c66d70), W(0x73ddcd2c2eccfb1a),
+     W(0xd73b1fad8b8b5cfc), W(0x9cdd943547a18710), W(0x7e2392bf7bc814db)},
+    {W(0x914193c06c8f74e8), W(0xffeddc211d67c04d), W(0x1fef41850ad68693),
+     W(0xa73e1d9af53e8054), W(0x909b656f420ec104), W(0x73872d361702e1de)},
+    0
+  },
+  {
+    {W(0xd24cabaa21355d5f), W(0xddcbb10eafd402bd), W(0xd3f0d14329c21de1),
+     W(0x1ad95a94f23d84fc), W(0x113a7902e3da530d), W(0x590da88e64671048)},
+    {W(0xf4a58282925bf0da), W(0x1a52e4e7e62e6e0b), W(0x97ebbb4ed86f4dfd),
+     W(0x601bd1c358fad1c3), W(0xd6e2d5a62de40552), W(0x0c9e71377273dbed)},
+    0
+  },
+  {
+    {W(0xe6e91985e5802845), W(0xc367d6aea6e201bc), W(0x077f30e5dd2c23be),
+     W(0x862ef39c275075e3), W(0x022c75441a806542), W(0xd0ab3e3a99ebd09c)},
+    {W(0x7d67ef60d99028b8), W(0xa5cf364fa9ad136b), W(0x372c23a9a91fff8c),
+     W(0xd3d57a9547202560), W(0xcebaf145152f1923), W(0xcc3ae72c6d8973a5)},
+    0
+  },
+  {
+    {W(0xd718e8e1f4363f23), W(0x73c21e204f761490), W(0x27c6ec25a0075d46),
+     W(0xccd4f456753f40d0), W(0x50994c4960a91622), W(0x77964d793f740b48)},
+    {W(0xf4c955e2f647ed02), W(0x844fc79ae4193d79), W(0x488374d1a27f3f9f),
+     W(0x95d6ad45b8659463), W(0xe1d99f78c7438e39), W(0x5182a7172afcedf2)},
+    0
+  },
+  {
+    {W(0x0efc2e27b2deb1fa), W(0x9c7d35833cc1184b), W(0x5841c5f8a8dcbdc8),
+     W(0xa911a58af0d93abb), W(0x3cd18c33b9cff887), W(0x6e3c27bbf13f2403)},
+    {W(0x5b391712ea533ae6), W(0x35cdd90b54294c05), W(0x2db57fb4f560daf4),
+     W(0x75ad33caf5a1411d), W(0x87e19a4e7f7c7568), W(0xf4c46c56198c7705)},
+    0
+  },
+  {
+    {W(0x8db3b74805be74b8), W(0x08e0805000765fab), W(0x6744720b50447fd9),
+     W(0x27552012c727be03), W(0xc3907b518b02667f), W(0xa158aabcb9bdef14)},
+    {W(0xaaddfa03f49cc56f), W(0x1095bee4e305fb96), W(0xa2ff54bc93c32619),
+     W(0xccf8e1f94aeb2685), W(0xc64b47b82300d9fe), W(0x09ca776808279da9)},
+    0
+  },
+  {
+    {W(0xf85b86b79b0bda12), W(0xd2c616d1bbe33572), W(0xe72215ef852bd27f),
+     W(0xe9815b09139b7fc5), W(0x4a5bdb048d7fa0c2), W(0x869fcd17ff86a986)},
+    {W(0x3278521791daf6be), W(0xb9c007f1d6664d04), W(0x6998722ae7b12029),
+     W(0xbf7fded9fc31bb67), W(0x3d0ed17c31b87757), W(0xa10b3df255f7944b)},
+    0
+  },
+  {
+    {W(0xaa4e673b34498f56), W(0x9120f7b3a043456d), W(0x33e868f326a48826),
+     W(0xa97accf432406bfd), W(0x84442a4123c50746), W(0x274c69657350982d)},
+    {W(0x3106b7fb95dc9eaa), W(0x3ebf1db1ec7ae241), W(0x00dc39b8848a5b86),
+     W(0xdf9a343af6312ec6), W(0x75029e32cf121f03), W(0xc0c5bdf6cf5a11db)},
+    0
+  },
+  {
+    {W(0xfdcce7a80723559a), W(0x9532b30ea229d070), W(0x613e5294fe857961),
+     W(0xad9e749a9aea738d), W(0x517a6bae23acba53), W(0xf26774cd7823568b)},
+    {W(0x940767a1ae53114d), W(0xc6cb3a4beb8c057b), W(0x6d99c05f06aef600),
+     W(0xa6729b8db2798481), W(0x7a546582bff1585b), W(0x70509ab082b09773)},
+    0
+  },
+  {
+    {W(0x732595ac7329d8d1), W(0x59f9078dab73bcc4), W(0xcd55e7b421cf9dde),
+     W(0xa4630ba1875fab27), W(0x13167fb8ec9cf4cd), W(0xd2fc5c57998b0577)},
+    {W(0x761360c15ff51b6f), W(0xb2db96f206cf9ceb), W(0xd677a64899dc8f46),
+     W(0xeb9ecabc9109b7e5), W(0x9a1bb1ac9221b7a3), W(0xb16536288a40a5cd)},
+    0
+  },
+  {
+    {W(0x5198ba40189dfa8d), W(0x8c9a16e3a896ab1e), W(0x6c33d5d6ba6744e4),
+     W(0xc29afbd47772778a), W(0x65df3c959329f7e0), W(0x79cd3f1e3891db81)},
+    {W(0xcaaa8f0bd784019b), W(0xf5404f6be9028e62), W(0x95507a54ae4d8985),
+     W(0x9c1d39a8b716f21b), W(0x473d0df9f8265b7e), W(0x11aeeda1c64d0916)},
+    0
+  },
+  {
+    {W(0x151198480c4c0b80), W(0x46b07d4a2a1018fe), W(0x14a9c3ebea80907b),
+     W(0x4b3d05ee42954405), W(0xd4d6fd78550418d2), W(0x8e4a4f6321dc82a6)},
+    {W(0x1be4d7f7a178b9d9), W(0x83c6ba0470788c9f), W(0x5a82af3e9f30f7e8),
+     W(0x8a86ab0f498f447b), W(0x03babcecc25ccf33), W(0x74c462ed1a798add)},
+    0
+  },
+  {
+    {W(0x9612b8bc3cfb44bb), W(0x70f25677719d6ada), W(0x50ea65aa46f614e2),
+     W(0x9436a8cf3450356d), W(0x7ad6ebad036703ac), W(0x03b2dab245cf48ae)},
+    {W(0x21953d2a4117061e), W(0xdf3fb730ed4f55a4), W(0xecf53641e119ab8e),
+     W(0x551f41bc219187aa), W(0x7cd5a74bb0095802), W(0x8933bff572f35ccb)},
+    0
+  },
+  {
+    {W(0xf7753246eca101ec), W(0x2aacfa4c569604af), W(0xeef28f34522c6279),
+     W(0x96fde63874231e0f), W(0xa92bb11bd6e0f09d), W(0xbbe34e740f395db4)},
+    {W(0xaa6e59ddbf943cf9), W(0x5698bdbe018ad5aa), W(0x88d22a44a467c519),
+     W(0x9e29e339ad180b0e), W(0xf3d6832e367b2f94), W(0xc7e92a61e3948069)},
+    0
+  },
+  {
+    {W(0xeee8335e163a51c9), W(0xb03a96452eb70aef), W(0xd18e25b7ad533989),
+     W(0x47523daecc5fed5d), W(0xf454b6bb154115ce), W(0x82d82a1a361691ce)},
+    {W(0xb13a0ff3efbcec2e), W(0xc31e84252875016b), W(0xba0fe39f0177da65),
+     W(0x874c85e98941eaab), W(0x427aa964b7d4237d), W(0x35cc6572b93530be)},
+    0
+  },
+  {
+    {W(0x94fc3433b73b8759), W(0x9386a96cad0aa86c), W(0x563daed2fa9f07d2),
+     W(0x2ed7babee79bf57f), W(0x82e51c992ef17de8), W(0xf9641b42d329f00d)},
+    {W(0x54930462e051406e), W(0x895558ee0621cd33), W(0x1ec5e4350e3868c9),
+     W(0x1fc7979bb69b1e3c), W(0xef606ed9e795fe84), W(0x02eba456ab1630df)},
+    0
+  },
+  {
+    {W(0xdbdf2c1c3d2c9e1a), W(0x78776317c0c09fa4), W(0x9b0e1f697afa10e0),
+     W(0x2dcd75581ec85470), W(0x7972eda49254c0a8), W(0x2970976ed90389b2)},
+    {W(0x831f328b50be46f9), W(0x9958265d342f125e), W(0x8a242d43b510abb6),
+     W(0x78a76951e4a85df4), W(0xcafb03673b0fa9ba), W(0xd397dcd0883fddb1)},
+    0
+  },
+  {
+    {W(0x58f8a7b937c0bf05), W(0xd9e005f73609a18c), W(0x624d66761d970be3),
+     W(0x96cbdc7bd272693b), W(0x3be53bbe0afc5d61), W(0x0739417abc87c165)},
+    {W(0x323292bc8104b9b3), W(0x43259a88ffa50302), W(0xf3e9aaf3325896f5),
+     W(0xb710a261cc0a5bcb), W(0xe0b4d79832294b78), W(0x18cc561e724ac89a)},
+    0
+  },
+  {
+    {W(0xdb3e725355e5c099), W(0x86bea02abe5f5e71), W(0x3eef6117b5d7ce33),
+     W(0x028b35d5d2b0fe4f), W(0x9269a5089729068f), W(0xbcd43ba32688a48c)},
+    {W(0xaa58b180cc8f4452), W(0x9a330388ba5ae34f), W(0x049b46509544ccf6),
+     W(0x521ba1b9664bbdbf), W(0x936d0f6cb0841b28), W(0xf961887c40d7317d)},
+    0
+  },
+  {
+    {W(0x34fb5e5aa23811d3), W(0x146472164c271cb8), W(0x484cea76f5441e2a),
+     W(0xb70dfc92010186c0), W(0xd2d3ec4de1ba2256), W(0x8f89ed26d25256b2)},
+    {W(0x568a4d21ecac5d09), W(0x84f1a8ec2a64e4db), W(0xec1a94522bc35933),
+     W(0x8889deb320e6dfca), W(0x8351f7ecff174b6d), W(0x4c9a168a58cca7eb)},
+    0
+  },
+  {
+    {W(0x13ceae19d7ab39b7), W(0x68481c6e5819b5f4), W(0x294905ecab03845c),
+     W(0x4c5f9e02fa32c341), W(0xa1049a61e848a86c), W(0x3814278e8036dbfd)},
+    {W(0x51686ec2bc0ffabc), W(0x87ddd46118d7de7e), W(0x6081044adedf3951),
+     W(0xfdc94631f33460b1), W(0x012170fed6216618), W(0x1f411a1150289e5b)},
+    0
+  },
+  {
+    {W(0xf49676217363ff35), W(0x532c612d3420e1a6), W(0xd29754b02879534c),
+     W(0xd0f803eddf8a40ff), W(0x0a12a28096eb8246), W(0xf862699c2ce2c16f)},
+    {W(0xfbfccbe838ed829b), W(0xc639950847a9d721), W(0xe8e09bf0ac1a0bab),
+     W(0x1f56fa64ee27dc9e), W(0xa33a0fd4c0055689), W(0x7a59b60bb931f9bc)},
+    0
+  },
+  {
+    {W(0xf2267044e312855a), W(0x18f899edf23cb231), W(0x5eed1666b4a84498),
+     W(0x8bb4347ab6cd63c8), W(0xf53b45630c3fe243), W(0xdc8fc422ea55ce52)},
+    {W(0x309a546d609beb36), W(0x481e4f6ceaf4ea74), W(0x3a3367bcb085332d),
+     W(0xcf10ed12b447a867), W(0x1d2204fb53e0f303), W(0xf39e8291a79b5911)},
+    0
+  },
+  {
+    {W(0xaf2b5381d057948b), W(0xe83777c8f7135e4e), W(0x3cc71eb812c63801),
+     W(0xc8acecd30ce5a8e7), W(0x59843678d7240917), W(0x47124975d169675d)},
+    {W(0xbbc48fba4e2fb168), W(0xa970abbf0977ca59), W(0xba4c1d90cb625dc9),
+     W(0x5b0f146c03718ab1), W(0x38d6d2a1a7cb1d77), W(0x80c500d71f854c45)},
+    0
+  },
+  {
+    {W(0xd6e2b8fdb8935627), W(0x9ab464b4a4f0f0cf), W(0x80c2df7b3f0f08fc),
+     W(0x73f0447038630b7d), W(0xc69f13dde4a7f190), W(0x0adfc8dd58b8f080)},
+    {W(0x5f62b6508fd678fa), W(0xdd2c0eee014f69bd), W(0x6485054df1005de8),
+     W(0xa334a1698de0cbc8), W(0x3833e7d9f6268d12), W(0x969cebfb86d8f862)},
+    0
+  },
+  {
+    {W(0x8ba4e56cbc2cd692), W(0xf3c175a330fbad5b), W(0x6b99178d4a33896b),
+     W(0xcf47edff9b098a71), W(0x3cc9d506eaa0035c), W(0xf5f35ece375ba7f1)},
+    {W(0xcac1f4847654a1ac), W(0x448fce2c199dfcfc), W(0x6548a3624c1fca58),
+     W(0x03db09c949755abd), W(0x303fb03d5cb34d4b), W(0x58542b8d719c59c2)},
+    0
+  },
+  {
+    {W(0x78f6e0686ab8b7e3), W(0x5b8be3159c7f2c7b), W(0x9e53424b03caafe8),
+     W(0xeeb5342ffe0ca023), W(0x7e6e66066eb1b850), W(0xbe56e084786a7d0b)},
+    {W(0xdf65888d0eb58b01), W(0xdd2c44710e4c18bd), W(0x6fa914a5443306a4),
+     W(0xb8dd3e48c7df4273), W(0x71aae87dab84d3f0), W(0x7d393641b13454d3)},
+    0
+  },
+  {
+    {W(0xacbbe1f2a0af8e32), W(0x36e8f31e9c42aaf3), W(0x48c80c8226732a7a),
+     W(0x8b59e0522d95e53a), W(0xe7fe39639bfd59ab), W(0x645e544acf3a60d4)},
+    {W(0x665a70045cf26942), W(0x4a91869ee67025d8), W(0xd06f64cdafc88e5a),
+     W(0xc315c8e4a0480435), W(0x3ce3d2696d9507a1), W(0x503dac2d66b00fdf)},
+    0
+  },
+  {
+    {W(0x8d794d776301f483), W(0x5e6829c541aeb7e1), W(0xdc2e9194c83f14b7),
+     W(0xaedc4f6f6df2e8e1), W(0xb5ad10ad941b6f3f), W(0x933f7fa3f1a5eca7)},
+    {W(0xc57fe7e70f0ef712), W(0xc6c01eff1063afe4), W(0x55dd078eb8e77707),
+     W(0x64b335673ec9c855), W(0x3f45788d408f2ede), W(0xdcec122240175fcb)},
+    0
+  },
+  {
+    {W(0x3488d91f6f83b88b), W(0xa730333c627950a8), W(0x662c440507ea48c4),
+     W(0x7e9bb950eb106d3a), W(0x97fab7c5f64aeb4c), W(0x4c4ac0656bfe8863)},
+    {W(0x38294f452a9bf5ce), W(0x9797d0aec8fc98d4), W(0xadfd291c46cccfbf),
+     W(0x5dad959e9a515eea), W(0x77c9f26a56109bde), W(0x9e64321360c34fd5)},
+    0
+  },
+  {
+    {W(0xd7596afdc83340c0), W(0x5dba602611a6e30e), W(0xc7fd603f4a08aa9e),
+     W(0xe928f5ad1307991f), W(0x940a40ba77fea278), W(0xac50886c28d8c989)},
+    {W(0xde580b4afb19dcdb), W(0xc1bb2ca0c9d680b1), W(0xc7d0e3d5184f0454),
+     W(0xec4c1b81883e4d29), W(0x1aed77e46e6b1b17), W(0x7161357300f3cd57)},
+    0
+  },
+  {
+    {W(0xc951083c1d43f4f3), W(0xab39ac878c342d1b), W(0xf7f16665974d7019),
+     W(0x6e857e701af8a8e8), W(0x3180ff5fdce08167), W(0x9453fc99514f9b11)},
+    {W(0x1583bb3e68a5bf67), W(0x1fcfa7a0f225c056), W(0xddb1678de6055d69),
+     W(0x94a0af0066df490e), W(0xc1ab4aeeb58ead49), W(0x25da56e05f24fa6f)},
+    0
+  },
+  {
+    {W(0x91c1f241d3d29568), W(0x1e452ce3bdb62aaa), W(0xdc8eef2ca9a04dcc),
+     W(0x46755701537781dd), W(0xb38604d68ea54c61), W(0x5b9cb627f0548ebe)},
+    {W(0x5e587379f08028e0), W(0x4026f660ad1c5c96), W(0x9ef063e101f9570a),
+     W(0x0038e8986da7db0c), W(0x69c510c17ec9fd9d), W(0x54c677a6d528b9f0)},
+    0
+  },
+  {
+    {W(0xb25a64aeed1b5b54), W(0x0f60e5946388754f), W(0x9735c40349c1cde9),
+     W(0x6915c169603de58c), W(0xcd74b10f8e306744), W(0xa79541a78d945bdb)},
+    {W(0xbd6a58ca4f81e741), W(0xe5e051b16ba116b9), W(0xaa7f5688b97e97fc),
+     W(0xe1bae7a2fe08d3f7), W(0xede064cb9dfa1a3e), W(0x2998a3d14be2cc1b)},
+    0
+  },
+  {
+    {W(0x692287f47171c5d8), W(0x323e86c1de55fd17), W(0xcc68cad154fb0171),
+     W(0x0844144a70f71ecd), W(0x66f1c6c5447f17c7), W(0x1388230788312179)},
+    {W(0x5ef2d2e841443a0a), W(0x87035280ffacc59c), W(0x5762b66651c8db12),
+     W(0x11eead09b15e9304), W(0x8901b8a22270a807), W(0xb84951a216a32c3c)},
+    0
+  },
+  {
+    {W(0xcdb32df1db571212), W(0x39ea03d4bc2a11a4), W(0x483af9527f24062b),
+     W(0x6569c698e323d800), W(0x3842b548df0167f4), W(0x6196f8bdc2d02055)},
+    {W(0x6b5be09dbdda0b2f), W(0x183e2400ebdd8f53), W(0xb16edc919a6494d3),
+     W(0xdcca89829f4f6041), W(0x922946ac1ad22cab), W(0x1526d8b4e7d59ac6)},
+    0
+  },
+  {
+    {W(0xa208bf3f064d8a5e), W(0xd4851ef3c5d95b7d), W(0x7e790af79e79d914),
+     W(0x42dc925817bb0fac), W(0xf77e284e226669d2), W(0x7b5dcb4736c11049)},
+    {W(0x0f6ccd1ccf8b48d5), W(0x8f0bee7420119e96), W(0xa1e2422b2478028d),
+     W(0x85ee0d639a1fc29f), W(0xce8b167be3c01111), W(0x288ae546ab046524)},
+    0
+  },
+  {
+    {W(0xa6fba79cacfe07a7), W(0xa201c93a597b80f7), W(0x350f3be6a56debb7),
+     W(0x8b6ac8456174baa5), W(0x2eadc12d72098379), W(0xe9ec3ba67c1ee921)},
+    {W(0x1036098b082f4091), W(0xa2dacaf15ad84d3b), W(0xa6e0ea404ddf9b1f),
+     W(0x39b1e0e9356fe0d4), W(0xccb31f7438bf034e), W(0xb195b1bdea910b43)},
+    0
+  },
+  {
+    {W(0xc1eb3a6156550247), W(0x57e2ba727f668f13), W(0xe28442e2912527c0),
+     W(0x5feaa9c8a5f14d7b), W(0x4987d03208acd9a7), W(0x38d50b7e0ce0e9d3)},
+    {W(0x2081fcf315da0b85), W(0x00db98799a4e371d), W(0xd5f028aea16005a5),
+     W(0x394d5658c21de8c0), W(0xb3b4aff4dead76cc), W(0xd293a7d6a44302fb)},
+    0
+  },
+  {
+    {W(0x93d5b656d78edaf4), W(0x2aa37a8f7c7f1cf3), W(0xaac3e8a9aecec6d5),
+     W(0xfadbf8e9ef69729b), W(0xbf9c0cab3b2befa5), W(0x121b11a8e9101569)},
+    {W(0x42e1e39f1e957db6), W(0x5b905b7d08539469), W(0x1ba59118cc80ab45),
+     W(0xaa947cbe1e02eaea), W(0x30316da0f5939d77), W(0xc808dc5eff3193d0)},
+    0
+  },
+  {
+    {W(0x43f56fe2b1d6d47e), W(0x395eba9bc81aa3ae), W(0x027fabb85c9854bb),
+     W(0xe3fdc098ae4421d2), W(0x345e97503e5f7036), W(0xdb2eac19e9b2ab7f)},
+    {W(0x6b2cc639cd2ddfd8), W(0xb2aa081fa4850570), W(0xdc1c27e8a760d4f6),
+     W(0x9fcca0eda24ffd82), W(0x50996c1f1b88ff9e), W(0xe12a7304298cc06f)},
+    0
+  },
+  {
+    {W(0x024d8e074e88648b), W(0x25aec2ef4e586c3d), W(0xe851ca6cc058b13c),
+     W(0xb420775eecba5eb7), W(0x51827b0174ad41b3), W(0x102da8fc955acfa0)},
+    {W(0xb1bde21374702c39), W(0x5c129c8f7b79274e), W(0xd6726e388a491707),
+     W(0xc5f25b8f2456886f), W(0x881581ed278731c8), W(0x879674f2a578d209)},
+    0
+  },
+  {
+    {W(0xc851b2899d9dd23f), W(0xd167107219338f63), W(0x7bb439b532a93cfb),
+     W(0x77a8443bfcb011bd), W(0x9abc30ca48222613), W(0xd1120ae0dd8db072)},
+    {W(0x6189f7409271dd73), W(0x4adca4f99b93d6cb), W(0x007ad23ca747d83a),
+     W(0xb04d0fd13000283d), W(0x896f1123f37b2297), W(0x72b3c482bcbe883a)},
+    0
+  },
+  {
+    {W(0xcecb8ae952d296e6), W(0x55f1145e448d7c02), W(0x599e77d95f2aded6),
+     W(0xe4479bb6a75f1c84), W(0xc47380c274fc19b6), W(0x1e47c7a0cb3137a7)},
+    {W(0x62fcb1531975ef0a), W(0x97e9b40ae038062d), W(0x0d8997ccbfe35c03),
+     W(0x350d87b44c9ab1d6), W(0x7162a89c655f73d3), W(0xec90c840097fc8b4)},
+    0
+  },
+  {
+    {W(0xa1c561a4dd5553d1), W(0x081fcfecd7853c85), W(0xbae0701e7b99ddf1),
+     W(0x32b8feded9d054ea), W(0x2cc3959fb4151022), W(0x7a4e2e5a44fffd03)},
+    {W(0x338eae73bd1df1e0), W(0x1f77bbaee8f3e3ed), W(0x79469fb80f5f6869),
+     W(0x39aef67a73d8a4e2), W(0xdaa74e65741434db), W(0x4760ee91ced65c02)},
+    0
+  },
+  {
+    {W(0xb5464096825b4417), W(0x01cae0333c05babb), W(0x0c54d91623a519d2),
+     W(0x151f0a8ded221cdb), W(0x8aa972b9d06ded85), W(0x4719f1ea6ee0f587)},
+    {W(0x05940f89522b2a56), W(0x938e952bd60d5e25), W(0xe1bb59c7d70d4161),
+     W(0x85dd60ed9f718067), W(0x5dcf616a9887d77a), W(0x0f9a17278c47786f)},
+    0
+  },
+  {
+    {W(0xf36724be79df95c4), W(0xf1a9d2935a661ee5), W(0x2662aab6d1b40fc1),
+     W(0x6da7d51a241b6a2f), W(0x4bdb7729cd4fa4b0), W(0x16cb76a941433eac)},
+    {W(0x7d6047476b745cca), W(0x45eb60d371a7fa09), W(0x603896faec4d0588),
+     W(0xc728bdbed11769bd), W(0xef85925a53625167), W(0xf48581cd2ad721e9)},
+    0
+  },
+  {
+    {W(0xc3cd3d0d27049568), W(0x1e4def694e3265ce), W(0x69afdee97e6abbcf),
+     W(0xce378659d261699e), W(0x6ff5c1ff6dbbfd47), W(0xb51fed9bfdc4fe66)},
+    {W(0x982ab72b2ce7e93c), W(0x15e5d49d9866589c), W(0xdb05f68d93bd2ab9),
+     W(0x538723535ec451e6), W(0x64b4c8c1bf129671), W(0x2d699291594fcb7c)},
+    0
+  },
+  {
+    {W(0xbac159abb52ee6ca), W(0x22d75a944e236963), W(0xc275721d1f94c37f),
+     W(0x665efbb1808de783), W(0x7cac96f4018692f0), W(0xc5b55cf9e6f62d42)},
+    {W(0x4a13413e024d35c7), W(0x91f427d0689b2421), W(0x48f43273283aa805),
+     W(0x2fb861f1a9de58a0), W(0xfbca79c5aff2406d), W(0x5775e7e6f58d61e2)},
+    0
+  },
+  {
+    {W(0x6b899e1f8564f17f), W(0x5fa6dc0119fa792c), W(0x4c2c9f9d67008353),
+     W(0xf63f48b6440c8b36), W(0x9eef6381f1200fc6), W(0xeb50d59dbf018b35)},
+    {W(0x7ea3a5b721182b39), W(0x10c3f68ab45aedcc), W(0x9e7aac429effa2ee),
+     W(0xbcce8b6bccbc3b1e), W(0x65773262d02eebb1), W(0xcc69faef5fd393a0)},
+    0
+  },
+  {
+    {W(0x9bf416072cec6ac4), W(0x75078339a976479d), W(0xbd74ae9b598b1a2e),
+     W(0x868f2a856ccd49e3), W(0xdb225687f56e1c38), W(0x4b1bcf38e07a72fa)},
+    {W(0xbbf44544e5a76f4f), W(0x1292ab1a38ca380e), W(0x066380d44e0051bd),
+     W(0x9e52ef30d8510c66), W(0xff1072bdf5585d25), W(0x3e82d7ef5a147ee3)},
+    0
+  },
+  {
+    {W(0xc3d5441d62bd4276), W(0x677c1372a6dffc6b), W(0xe64c6de5634be4d4),
+     W(0xcb08158152d5964b), W(0x0c9878d89cb0f534), W(0x80b906471d229d50)},
+    {W(0xf9d97362ee09d573), W(0x4b8cb030de7cab81), W(0x8aa337bb687ee647),
+     W(0x3e88e869bc0b321e), W(0x4138f63bb1ba79de), W(0x8ba5c4bc49efcf32)},
+    0
+  },
+  {
+    {W(0xdbd15ac11633ca73), W(0x96a76fe07a7b274f), W(0xe51fc8ea0104ea36),
+     W(0x34fe9f7bb891423c), W(0x74d08893157023cd), W(0xb66ecb2b6f73657e)},
+    {W(0x3e502582584904a5), W(0x475ffbf325035f4c), W(0x7432c46bb6877de4),
+     W(0x1bfa5c983cddfe1e), W(0xf765765cd97b0926), W(0xf603586a5b62baa1)},
+    0
+  },
+  {
+    {W(0xa8d85f7af498e387), W(0x843f2f4834e6b9d2), W(0x3c9a4b217e9314d8),
+     W(0x19c01780d3a107cf), W(0xf013f66bc3d752cd), W(0x940467ad849d7c9a)},
+    {W(0x5e3e47e0f2b9f184), W(0x03821af797bf73af), W(0x85dcc555ba1b87ee),
+     W(0x078ab72e9d0808a9), W(0xc7290f0c7fc7dc08), W(0x4278cbbdf17990de)},
+    0
+  },
+  {
+    {W(0xce4ad7e340d85fe4), W(0x58348265c610afab), W(0x2a6b9085f02993a1),
+     W(0x220be82bdde02d3b), W(0xaa3a3abf4f5127e4), W(0xa3f6da6e256afd0b)},
+    {W(0x07432ad3df9aea5c), W(0x9f385db6b1f5f52e), W(0xc6bfebdb2ed43c64),
+     W(0xa6d6230104595d1e), W(0xcf3fb7ba206b85c0), W(0xf4a22b2e0f130186)},
+    0
+  },
+  {
+    {W(0x55c4131e6fcc1c33), W(0x299707f5a46780d3), W(0x895ffd327ec2d443),
+     W(0x42ed8089862fde16), W(0xd93fc8b05c25a2fd), W(0x0b576a4d3a3cb423)},
+    {W(0x72ff64665fcbeebb), W(0x14aec8f879855bd1), W(0xdaa053b74f338667),
+     W(0xb3b5f3780f775895), W(0xc884c3b0a0ed2e9c), W(0xf700bf67d4b7aca7)},
+    0
+  },
+  {
+    {W(0x5bf9d8658ce05181), W(0x181f74c0ec816c66), W(0xf269d6f48d270d94),
+     W(0x3f5e8c0a9a7a6aa3), W(0x142487efdb27c5aa), W(0xc6522706f9685ae9)},
+    {W(0xc405eede295a3775), W(0x723039e993081cd4), W(0x445c6142dc70d449),
+     W(0x4e83ea6d35153812), W(0xae28a772af4a1860), W(0xf905d66ecf4c994b)},
+    0
+  },
+  {
+    {W(0xb1008b1b12243a93), W(0xc683a41acbbce85d), W(0xa1e5d2f6c021099b),
+     W(0xad9c15e9f7294861), W(0x12af1460c28a14c4), W(0xed3c37d8e2f474d5)},
+    {W(0x64aa655ef90449f4), W(0x7d323df417dff802), W(0x3973a51a2ad72917),
+     W(0x523726b5ffc7d59d), W(0xfb19650bebec16e1), W(0x223d6d6a774afc84)},
+    0
+  },
+  {
+    {W(0x666def0a1e46cf9d), W(0xda83ddf248d1508c), W(0xf25b87e28e9358c9),
+     W(0x70d42eabc1dc0814), W(0xab78912692d2c106), W(0x61042111cedb99e6)},
+    {W(0xfd741df03c4a59f2), W(0xba37479a03fc3cb4), W(0x5934bf3c8ed95b94),
+     W(0x23c84ddc5e6080c2), W(0xd3b84e687a17c348), W(0x66e1b52d8ea1d457)},
+    0
+  },
+  {
+    {W(0xe943e693bba61868), W(0x67e51c8773430ecd), W(0xba4baca1eba53d49),
+     W(0x9a33415bf69bb3ac), W(0xf521a228c41872ea), W(0x1994582f096a9dc6)},
+    {W(0xf87f8e58bdc4c62b), W(0x856feb5222f1d576), W(0x1e3df1ec12c00a07),
+     W(0xe2aa3ec69ce0c083), W(0x91e3bc9f1e788309), W(0x25d5086fbba64792)},
+    0
+  },
+  {
+    {W(0xd772c688ab07dc89), W(0x7daef0b36c431aa4), W(0xf8710ca1068317de),
+     W(0x8f612a802180207b), W(0x594a851a180d3527), W(0x25a16d9050d8fe83)},
+    {W(0x3e4be67a42f516e5), W(0x239d754c36a0ac8e), W(0x9964c3c58bd041e7),
+     W(0x60ae569d94b84e26), W(0x488e4039e253237e), W(0xdfc2ad7b292a2f13)},
+    0
+  },
+  {
+    {W(0x31fef0e83e4f7c55), W(0xeefd8fd4fd0a09c6), W(0x63e2e35cd50b197d),
+     W(0x447155dd9bbac63b), W(0x73205ec10687d0bf), W(0x15a5c2e49036f39a)},
+    {W(0xaaaf8cc845e8044a), W(0xe07fb7d185be3a4a), W(0x3508ec805ea241c5),
+     W(0xf6264aaa8c9284c8), W(0x5dcff78155b10354), W(0xb8eb87cd076efd3c)},
+    0
+  },
+  {
+    {W(0xa0746b4ea070591a), W(0xccb4a46def70d887), W(0xe1949863c50a8462),
+     W(0xfc0f59e1e328e98d), W(0x4eff392479c443f8), W(0xb7c298f907e6c5b9)},
+    {W(0xd058dcb40afb26f9), W(0x8b1f262192e53e4e), W(0xce9a3347e72a69fd),
+     W(0x3fb0828a3717a477), W(0x9bbf765aedbe5e13), W(0xf307ba9ff83e2660)},
+    0
+  },
+  {
+    {W(0x5f2b9c1f9dace13a), W(0x89db5d62e8aa099a), W(0x36c001343e633c52),
+     W(0xedb4f314f724cf9a), W(0x11067c93b0744975), W(0xaecfbb68016cff97)},
+    {W(0xb72a8ffaac3b5928), W(0xe1c3951dd07c5f9a), W(0xb0f38adc8881d26d),
+     W(0xc9c2ba1f6cab639b), W(0xab1a1173ceb72def), W(0x86e5b992671b740d)},
+    0
+  },
+  {
+    {W(0xc5fd2c53e02b8a9e), W(0x2fdea8a3506d0714), W(0x6c2ed7102eba03f0),
+     W(0x584dd7949a7f2bcb), W(0x1886952cc15a50a5), W(0x829b337d516981af)},
+    {W(0x793acb2ec8947603), W(0x0e14e1f17abc913f), W(0x589b9f099c56b1eb),
+     W(0x211266253fee0666), W(0x78cc18e2ba68a4fc), W(0x7eef7490a0e28151)},
+    0
+  },
+  {
+    {W(0x20bf17ef906163ba), W(0xa662743dac1d8fa3), W(0x8a62f8a544db35d3),
+     W(0x41c1f0adb34e6031), W(0xf3653bee291b0cec), W(0xbcb7354f0b7dc2e2)},
+    {W(0x69161c6c2258323b), W(0x287a9f08a1f0e3b5), W(0x6efde11aa952a7ee),
+     W(0x34900c74780792a1), W(0xbb1320b1349d9f25), W(0xdeca1b39ff8421d4)},
+    0
+  },
+  {
+    {W(0xa25bc5c5b0980097), W(0x13f507e2b6e24557), W(0x152c4a849b7cbea9),
+     W(0x0f562109fb92b8e1), W(0x74ed24a3769f8e2d), W(0x6c0bb62f4bfd9fbf)},
+    {W(0x4b31d3b0a82a5a96), W(0x26fcdb1da3f9c2a4), W(0xab5c55fbcf1c5a89),
+     W(0xc8359cd0644212d7), W(0x8da7fe85c9d1fb95), W(0xe0b2257979c0560d)},
+    0
+  },
+  {
+    {W(0xa04db2ccca70dd22), W(0x7114696b552c736b), W(0x9a78fabeb9de56c3),
+     W(0xc41b44882e7c657d), W(0xf9ca29170d02dc7a), W(0xbb2902f8a663f22a)},
+    {W(0x471a54a6732a2b1e), W(0x81ee4f0bd3ae864e), W(0xdafafe1a31894904),
+     W(0xa9f289be2f25434a), W(0x74985e36f256d52b), W(0xa82de1745b7bb125)},
+    0
+  },
+  {
+    {W(0x921b67b55015224a), W(0xb1107e1ce1c038c6), W(0x0583c474276bfd6a),
+     W(0x5175c987788c6373), W(0xec46cb66b4e91535), W(0xcb87413cc517d787)},
+    {W(0x24234cbc99352e76), W(0xa3b813d05e4a1d56), W(0xccdb94bba1cdce1f),
+     W(0xd309af601a84463e), W(0xcfb41874e34e466a), W(0x60897593284534c0)},
+    0
+  },
+  {
+    {W(0xfbdf18976fb0b03a), W(0x3c645e6bd5d12aa4), W(0xd6e8d55eb77dec98),
+     W(0xb3056dcefc700120), W(0x33fce68143e29fa6), W(0xef82568eed99b2f4)},
+    {W(0x35975432a6b9a7f8), W(0x31499f4799596fb5), W(0xd96767828750ed23),
+     W(0xa1939be63c65c172), W(0x70013c29b9215972), W(0x624906b380cbcf3a)},
+    0
+  },
+  {
+    {W(0x9970b346fe911960), W(0x98153e739fb65bc8), W(0x90784b0039506657),
+     W(0x82f805c51ed2faaa), W(0x332f5b4fc62c7638), W(0xc5bb0d4b3652167f)},
+    {W(0x56e83fcc2da92f45), W(0x489288b6d4e01f15), W(0x4ceacc1a7ad29ad2),
+     W(0x4602fc81cf57b6be), W(0x044ebed04418a820), W(0x10f84094222b3356)},
+    0
+  },
+  {
+    {W(0xdb0b5d4bbd1aebf6), W(0x2c0eca56f4ec9ff3), W(0x8208d01c8e9bc666),
+     W(0x38e43701fcd55ce6), W(0xce69c8e055332285), W(0x9fddbd54a5158518)},
+    {W(0x1a6a429e4310f893), W(0x06123520eadbd2a7), W(0x6f6eeca65a38186d),
+     W(0x91ed7a711cfec4ff), W(0x20ce4a16b6e81ad7), W(0xcf05ca6891683ec7)},
+    0
+  },
+  {
+    {W(0x4384fafa8731d43a), W(0x902cf8af5d0bb60f), W(0x4d7ba85103ef79b2),
+     W(0x2b8e508b62db1252), W(0x21d83776daa2b118), W(0xfe6a5ce14ca34420)},
+    {W(0x52626112ef90bd26), W(0xe00874577032baf8), W(0x4c15fde56dbaf37c),
+     W(0x66fd0e59d34b03f3), W(0xbfc392aa1ac1ec0f), W(0x73c70c9cda71b077)},
+    0
+  },
+  {
+    {W(0xcb9ceb9c018bda65), W(0xddb6b49e4d5199a0), W(0x73004d576f38714f),
+     W(0xd945047b815eba25), W(0x09e846ff0145d74d), W(0xa29d1e08290111ab)},
+    {W(0xd0be52ddc67fdcbd), W(0x4562441381d76913), W(0x69051c60a5099262),
+     W(0x614f5aa9ad689da4), W(0x71d3002ec20e31f7), W(0x5a0d740e1a6c2c94)},
+    0
+  },
+  {
+    {W(0x0dc48efad469edc4), W(0x7d9d6c32e61f340f), W(0x786c908e8078904c),
+     W(0x1226d57b0b4e1ee1), W(0x3def390d509dcdcb), W(0xf3e997be51c760ec)},
+    {W(0x1f88ac4d7d246199), W(0x2029ec6de153db4a), W(0x0b473eabbf014563),
+     W(0x61ab7e39e24df110), W(0xef50bdec68ba1b9c), W(0xe2768c96d0f5639e)},
+    0
+  },
+  {
+    {W(0xc58221e88f2dac21), W(0x1b1b395c6cbb191e), W(0x5fdc1e7f44599c0b),
+     W(0x7fbfa1c3b7eccfbc), W(0x8e209d1aa6452cbf), W(0xee2454d1a163fda6)},
+    {W(0x40313b4fa3642b42), W(0x82269c45c576efc2), W(0xd2b75a8f256b9d09),
+     W(0x03e439f2e4401a64), W(0x5d90e13d3a95ea4b), W(0x3100c8a224f2fde3)},
+    0
+  },
+  {
+    {W(0x1bea6c3a3653e918), W(0x792eb6aceac89979), W(0x9272fc300a1758a5),
+     W(0x64554d3a0423b882), W(0x15071b3583159a4c), W(0x7cd9e98b6ccf41a3)},
+    {W(0x6ba64837d70f0a06), W(0x20e981baae6111fa), W(0x7197f219fe369a0d),
+     W(0x886c5693f5c41148), W(0xcda8ef5366cad968), W(0x1bcd54bea3255fef)},
+    0
+  },
+  {
+    {W(0xa171d386ef753ac0), W(0xcf38b0899dd8d1c0), W(0xfa42f731d4190e18),
+     W(0x03b5504794c37e1f), W(0x040f8a437d2d6121), W(0x71a38bb7afbd62ae)},
+    {W(0x6d8b5236f18c8b35), W(0xcf3c188637cd6eff), W(0x376f3cf6b4b0eb02),
+     W(0x55a90c66b359a90d), W(0xc423584091dfcf52), W(0x331f0cf84db2384d)},
+    0
+  },
+  {
+    {W(0xedb7f551217df35f), W(0xd70d5501376441d1), W(0x68973ae0613d07a1),
+     W(0xd09779cb32d24c51), W(0x7126d60d4ea39347), W(0x6240406ee27f58df)},
+    {W(0x6551966d95196423), W(0x82956b3aa7dd77c2), W(0xae7e03951a696ea1),
+     W(0x0180a7679473c497), W(0x963c6d0bdf8bf5d7), W(0xeefc16f0a13993bb)},
+    0
+  },
+  {
+    {W(0x99eeff5f079abda8), W(0x1e60c33b6b1801f8), W(0xf6e5b0f43cadaf6a),
+     W(0xad21ac39f5b8527d), W(0xe73a1cf3207db637), W(0xac191cb960e04b1c)},
+    {W(0x758734fe256b78ea), W(0x7610a916cd0a1eee), W(0xc27745af201fdd13),
+     W(0x0452373d02f99cf1), W(0xc023c9b46792ff55), W(0xb380af3ade8f4d08)},
+    0
+  },
+  {
+    {W(0xaba2e8a8faf77697), W(0xbbd2553ae8091636), W(0xe96be1ce3e7de60e),
+     W(0x5a2c6915577d0f6e), W(0x3f7099fe9f20e64d), W(0x7aa00cb0be869120)},
+    {W(0x1ba329545fae875f), W(0xdcc61bd801132399), W(0x9e8130e4c017d17a),
+     W(0x702efbdc186124b3), W(0x20aa233be8dc64e7), W(0x3c167b9150e38306)},
+    0
+  },
+  {
+    {W(0x2e792330e918c84c), W(0xcda540b98046d82f), W(0xd888bdd631af98c5),
+     W(0x0e8673012b445597), W(0x5738fde8305000f1), W(0x79b26f85cf6db1fc)},
+    {W(0x9e251ad0bde2b13c), W(0x19bc1e93c9bc6daa), W(0xbe02b3a671ff4f7c),
+     W(0xa2726022e116a2b5), W(0x5d7771ce0082ae47), W(0xd738da6f071393d6)},
+    0
+  },
+  {
+    {W(0x35865b0f80a5b5b4), W(0x60766034fc07f8e1), W(0xc1f413b2da2e778d),
+     W(0xfcad2892762bf853), W(0x6eabe8dbd295938b), W(0xebff7fd57d60d8b6)},
+    {W(0x22d21841dcc8b412), W(0x4dcb5f850b74d294), W(0xadc67a3410ce5088),
+     W(0x3c86aeff6d28971b), W(0xba3dee490e17d7f2), W(0x53bdd351f67ac69f)},
+    0
+  },
+  {
+    {W(0x439bc2368bff3397), W(0x45dbb6ded36cc1ef), W(0x373c4642c546ddc2),
+     W(0x55cbb7470c7942cc), W(0xab0c543ccb00b2ee), W(0x54142eb89ad504a1)},
+    {W(0xfc1871b64fe32213), W(0x649d4491b7aac964), W(0x41e360481729f620),
+     W(0xfc05cd189cfbbf67), W(0x10fd3a135166889e), W(0xf8cccd95f1e5c3d6)},
+    0
+  },
+  {
+    {W(0x39b01dce03b2b1e7), W(0x8eef10ac2ce6e69c), W(0x355af544f76f3ac8),
+     W(0xbce992458ddd2c65), W(0x7566c82a73c99c84), W(0x4264fb861e53ed02)},
+    {W(0xa01c2b54853eb997), W(0xe2018eed9db8a008), W(0xb764a58d8233af71),
+     W(0x9bae36fbd4b89eb0), W(0x0ff091904827880a), W(0x49b27187841c1ac2)},
+    0
+  },
+  {
+    {W(0x44107cb9fda8b276), W(0xe6ef238c052e0e7e), W(0x1474032946729fc2),
+     W(0x6986439e0493be67), W(0x72482152b0ca6a96), W(0xad39ca3e4b74d302)},
+    {W(0x82525c0d5772d25f), W(0x37d84d085ce16982), W(0x3f2b1b4f8b4c9fce),
+     W(0x6a4833fb5af146f8), W(0x2ef1b53217b64494), W(0xaf03ddb16f7f9231)},
+    0
+  },
+  {
+    {W(0x0304caf177ff8ae7), W(0xca10ded4ee6ba90a), W(0x06fab59960f14792),
+     W(0xf385d8423a2808aa), W(0x443facea5d4f29ae), W(0x2c32c6e28bbdb614)},
+    {W(0x100eed3ea052a55b), W(0x579a2f1ab81d039d), W(0x208b8ddf0e4a5419),
+     W(0xce50e01bef9d201d), W(0x1d78ffbf5dffacf7), W(0xd48fdee90364cf2c)},
+    0
+  },
+  {
+    {W(0xfecb5be0682d1907), W(0xe6dfe29166cfbb02), W(0x4ad881ec14f69295),
+     W(0xb4055626e12fb9fd), W(0x40e9e4e879dbedbc), W(0x4698ad1d2ed352a2)},
+    {W(0xe9d8f20f1a6760c8), W(0x36b765b04330b63c), W(0xe14c648adcd35a67),
+     W(0x46a954a11ccfeee9), W(0x1265aa74abc1fc8c), W(0x256d4f3e0f28b307)},
+    0
+  },
+  {
+    {W(0x136aed1a17f8a57a), W(0xc0bd9f82a9b13650), W(0x56f0ea5a605a23c6),
+     W(0x41167baa5be84a4a), W(0x5b36f0f4d1321d65), W(0xf01796f92a5317cc)},
+    {W(0x1a1a8c7c46c89ce7), W(0x43c4d66a90e653cc), W(0x4f2466f9445cd3ae),
+     W(0x8d5ad98879831bb2), W(0x19d213f6c558bfa7), W(0x1d3e82a9b73ff57d)},
+    0
+  },
+  {
+    {W(0x656592509bf65536), W(0x9b3bfbce258d7b82), W(0x0cbbab2802017ca4),
+     W(0x856d8b342a14ca27), W(0x791a81e48f7486f4), W(0x2abf2eacafcc5496)},
+    {W(0x77153a741317720e), W(0x79d32e34f0e86e91), W(0xb0a8aebdcdde0a80),
+     W(0xb51123f0f9fc3670), W(0x4e838e9b99efeeeb), W(0xb1dc5a695bbd32bc)},
+    0
+  },
+  {
+    {W(0x93689fd8141269da), W(0x14e7759e06808808), W(0x1d768512848454c8),
+     W(0xdb49b15a8a6f1020), W(0x802de54dac8c6198), W(0x7451842645cf778c)},
+    {W(0x989e72d8e0a73953), W(0xa59b2c50522f3805), W(0x8fe6903737f07a61),
+     W(0xa10cb3a616fa517d), W(0xe7f806bdc87de440), W(0xb0f67271953bf7ff)},
+    0
+  },
+  {
+    {W(0x742756c272af2b16), W(0x9b86826cbc4c7a91), W(0x1c35ca412d297853),
+     W(0x80f6021162d3b0b3), W(0xbd542fbd2792533c), W(0xb4cbb78069a55e0a)},
+    {W(0x6c89f11caea01254), W(0x8c0c3288f9e7f25d), W(0x7902cfb793510a1b),
+     W(0x8215c75a34d0478f), W(0x460d053dfcb09d73), W(0x18438fd9d0bf0c2f)},
+    0
+  },
+  {
+    {W(0x7e576c976f28ea64), W(0x99084b59e83d2032), W(0x4360476af638ce17),
+     W(0x95d6b71946c4ee7a), W(0x5952cc56b68d84e5), W(0xbe5b29416f8e5c8c)},
+    {W(0x6ad1a9b7d132838c), W(0x1761f3e8e741b7b0), W(0xf2adf0da4d8abaa6),
+     W(0xd33fe32bf0a8912e), W(0x9cb86c24a28d01d5), W(0x20b187ca3b292944)},
+    0
+  },
+  {
+    {W(0x698aeb4646397c11), W(0x5056010d65f030b7), W(0xe971961cbe108576),
+     W(0x07053f88dd4c4135), W(0xb8d52181cda04f64), W(0xfb88d04856600d11)},
+    {W(0x17b29ac300f17425), W(0xc2f4ca026a2f3a3b), W(0x868e18cfe923c320),
+     W(0xc44199297fc5e6ce), W(0x784b9280ba30962b), W(0x31262d3d3266da06)},
+    0
+  },
+  {
+    {W(0x01857e531667a5f5), W(0x4d4b607d13797cd5), W(0x97c49d9c04af0886),
+     W(0x0f4ce6d4f668df62), W(0x1e1bffc915885a22), W(0x748e55284d575d1b)},
+    {W(0x325faa64957c930d), W(0x6c6f0d305ed6abd6), W(0x73b29c7360c5aae8),
+     W(0x7a9001d10005793a), W(0x3cad6869e3bc46fe), W(0xa07e30b57a03b07f)},
+    0
+  },
+  {
+    {W(0xa056e197033643f9), W(0xc6244ce89d6660ae), W(0x3f450b900626d59f),
+     W(0x67d01130caba40f2), W(0xa765b617637a11bc), W(0x9c110590ff52f4d7)},
+    {W(0x444686a08fad23e3), W(0x5c0d6ac492b88cb2), W(0x402fa7fd6a5a303a),
+     W(0x83b45a74bf3b30c5), W(0xb7220cd91bcfe001), W(0xa8ba78b6b933418f)},
+    0
+  },
+  {
+    {W(0x85e88b7fda94ca00), W(0x3842ba2e56910206), W(0xeb626b1641c95058),
+     W(0x1dcffe397a1264ce), W(0xb60fd0e1379de556), W(0xd4ca91e02754c4c3)},
+    {W(0x57bdcb221dbe1900), W(0x6b8b6c81dc9e67b6), W(0x16a59a101070daa8),
+     W(0xd3ed88a39809921a), W(0xdde20409c0d919ce), W(0xe56a3e36e19b94a9)},
+    0
+  },
+  {
+    {W(0xab8d948b7b23a36c), W(0xab2473fb11d17435), W(0x5783c12c127b5c80),
+     W(0xe2d0e437425cdbd3), W(0xa565886ff5de1f5a), W(0xa0ad233e8dbbfcae)},
+    {W(0x90cc7cdc08a326ab), W(0x5831119df7e3fdda), W(0xb50728f1705198ab),
+     W(0xdc2a56f0a1886df7), W(0x7b936d2b865b097b), W(0xea889d584790b7d2)},
+    0
+  },
+  {
+    {W(0xd5f7075187700395), W(0x7535a6a385d8bfb9), W(0xcc3caf1986203eff),
+     W(0x01fef378e26e3796), W(0xce2ddeba11917d28), W(0xde81bb0a6efd3f8d)},
+    {W(0xafe17b319cadfed6), W(0xb8e42d94e5f0b877), W(0x8d73b89644f89e2a),
+     W(0x9ae0ed8b0e63892b), W(0x107c2555d6843615), W(0x45829da2e640a553)},
+    0
+  },
+  {
+    {W(0xd499dbe33f0a955f), W(0x91bdb1817de3fa59), W(0x65fc16d54d14187c),
+     W(0x7817212715449191), W(0x7795803b206b0515), W(0x263b82ce25889b47)},
+    {W(0x90c6e754e825e689), W(0xc226157981366b3d), W(0x550a740952d2b820),
+     W(0x03dd82c8006be1e4), W(0xa2fb04546dc93eae), W(0xa99ac9957a8bf59b)},
+    0
+  },
+  {
+    {W(0xd5f9ea270f96c111), W(0xb4136b9fea8eff8d), W(0x0e6d1251fe90d5e7),
+     W(0x21c9e1061db43805), W(0xe3088277749d1751), W(0x7c7dd04eef3eb8ac)},
+    {W(0xc78380576b0501c5), W(0x764cd042a7be3d9b), W(0x90fbbb3b0e10dd2e),
+     W(0x664c3a5f8320ce5f), W(0x1be9d2e41e83abcd), W(0xae6375ae5ce5d304)},
+    0
+  },
+  {
+    {W(0x6991a51b0084abd5), W(0xe75b2b5f8e5eb295), W(0xf37dbe63620d7106),
+     W(0x0a4d23268fdad919), W(0x1ea538dbf8a85ce2), W(0x6427263340a744d7)},
+    {W(0xa22da261c3546183), W(0x6338d144ec41c6fa), W(0x898467e485edaaf9),
+     W(0xa93f41b6314e6d0c), W(0x6324bfe2c5e5d46a), W(0x693c996300791642)},
+    0
+  },
+  {
+    {W(0xfdc0d14c7feaad09), W(0x4b4372aaca88299e), W(0x0a7f9f5dab473f10),
+     W(0x949f7ef190696ce7), W(0x2b0c1a383fea427c), W(0x57bc637b4f8c8221)},
+    {W(0xd1cd25b988f450f6), W(0x642198175423b0a1), W(0x3e8a0a6dc268605f),
+     W(0x29077ad26bf80781), W(0x40893641c5994163), W(0x59a97c7cd8748174)},
+    0
+  },
+  {
+    {W(0x16b8e8857c9bbef2), W(0xf93ab69acae24c9b), W(0xc552840d78665ea1),
+     W(0xc09bccd053d3de89), W(0xaa99dc2f140df137), W(0x562b44a6e8166978)},
+    {W(0x0176ca6f00f39539), W(0xa08467fa014205e1), W(0xa29b84c5a551bdfc),
+     W(0xa28a64015a86ade2), W(0x9003a6d149cb6798), W(0x8daab84c1e113bd1)},
+    0
+  },
+  {
+    {W(0xa67b686c4dd8b775), W(0x5fe690eed203ab3b), W(0xeea4c1976cc3bf19),
+     W(0xb2c43c80d223e1da), W(0x11ca30ace3dd3260), W(0x5df3ffb9a11c625a)},
+    {W(0x63b9cd15fe4af4ff), W(0xa7bab9d88afb23e7), W(0x3eea1399c1a0afa7),
+     W(0xd8bf54ea8c054610), W(0xd853e660e6ac8181), W(0x6a6c85dedb0a464a)},
+    0
+  },
+  {
+    {W(0x068807cb0dd939b2), W(0xb73d721010e9bfa0), W(0x781dde1ae7894ee5),
+     W(0x2d08b782cd7418f5), W(0xcc9f94e50da43a4b), W(0xfa6f18f4aa82f22d)},
+    {W(0xd8bfc1aa68d43276), W(0x1a894f0c53474e97), W(0x195f94f45b35f12e),
+     W(0x12bd8503aa9ed041), W(0x678433f4059ad980), W(0x52791eb9fb238d0e)},
+    0
+  },
+  {
+    {W(0x97a2f3384bc98d68), W(0x84989e6f3236c2bf), W(0x18aac1c96cefc3bb),
+     W(0x02503d161de3d821), W(0xf004c73b98983634), W(0x7779d55f7a694735)},
+    {W(0x4890ecf45a3d6e71), W(0xee69820a7130e318), W(0xc4b9dc8f5e930edb),
+     W(0x92c040e3148101de), W(0x76b62563a00b518b), W(0xe12eb6c523c6771c)},
+    0
+  },
+  {
+    {W(0xad18fbb33e19b76f), W(0x652706404e0bc88c), W(0x1f7ec040be0152b3),
+     W(0x5950921840d4f3ff), W(0xba6e1bfe597ff285), W(0xb757b67dcf39f762)},
+    {W(0xc0b658551702db56), W(0xd66a57059ee04579), W(0x884ffba430abbf43),
+     W(0x0492dde2e7c4ba84), W(0x33eb4b3f0bd1c3dd), W(0x670d03def6307a2e)},
+    0
+  },
+  {
+    {W(0x4d842c0f1fe92891), W(0x1c7c7443d6025b6c), W(0x7b66bb8e932fd014),
+     W(0x9fffb899ca8008d3), W(0xb2ad53e1c0582b82), W(0x9a53ce4954358754)},
+    {W(0x8da37fc114225c0e), W(0xad202c6ace5adc0d), W(0x324b3f962c7a99be),
+     W(0xe70d74da3924be11), W(0x3d32daf40d28fdda), W(0x408ab04aed9656e4)},
+    0
+  },
+  {
+    {W(0x22c5a722936d2bf8), W(0x19d204c2caa9c5f2), W(0xe41c681c831253a7),
+     W(0xed28e1378fa4b933), W(0x31a178838874d4aa), W(0x5ec3b81e70245776)},
+    {W(0xcd827c110cb430bf), W(0x3b431d60083a4fb5), W(0xd977823b96585531),
+     W(0xc19ee40cdaa321ac), W(0x99790a5e8e9c0600), W(0xecac1814cc528c03)},
+    0
+  },
+  {
+    {W(0x72821c596d3d6a9e), W(0x4c8f5d37b153b547), W(0xc52c0e520c3447e9),
+     W(0xc7422d84d4d7c412), W(0xdbd231992b274214), W(0xe4b4a71e56cd38bc)},
+    {W(0x7d9936adc6818439), W(0x182ef292c0e6053b), W(0x7bd2e0a1d2f6c950),
+     W(0xae654f32c9af2d4b), W(0x65c98ef5d7de194b), W(0x575bfcc6ce88871f)},
+    0
+  },
+  {
+    {W(0x7082b2917d26b496), W(0xbc921415d6a233da), W(0xd6458baf86c3c34f),
+     W(0xc441961cdeb5e3e2), W(0x082e83a35d25be9a), W(0x5d6de094b6ff52aa)},
+    {W(0x7121e79baf146184), W(0xfa800c04ae282c0a), W(0xaf4d7ddf5cf8710e),
+     W(0x974a638dc4f1982f), W(0xee2ff2f49829e192), W(0xaa821bd8ea1e5f1a)},
+    0
+  },
+  {
+    {W(0xbcbd1e955d2326f3), W(0x51b7be4b56a0615b), W(0x7f261ca52f2d7e55),
+     W(0xbfb86dd8e617d7f3), W(0x3fd28f2654497998), W(0x7443aa4949541ff0)},
+    {W(0xb1cd993695357540), W(0x88a199bf044c265b), W(0xc540f462d9b0086d),
+     W(0xd77f070cd8ad83d7), W(0xa400f06147bf794e), W(0x6455c5f454b1b736)},
+    0
+  },
+  {
+    {W(0x4dbfe089b8ff4507), W(0x73f6dbe8bf5db4a1), W(0x8270f4148dba0821),
+     W(0xe4f5e0313b9c3446), W(0x09892e907bca5109), W(0x84c1ffc6c25be976)},
+    {W(0xee1ecc08b76bbdac), W(0x5bfc9e62a50ff0e9), W(0x20f7a5e66dc03e89),
+     W(0x7e821fbf2900a8f6), W(0x6833d295beb317be), W(0x4ce90e68736918dc)},
+    0
+  },
+  {
+    {W(0x86398b50875d5d08), W(0x8c447295fe5c4746), W(0xfc08b801bcb72631),
+     W(0x4f4dd396001d2c86), W(0xffcc6424e2e5a32b), W(0x59b669f3ffbdb134)},
+    {W(0x9e849a8f84a96a81), W(0x4985b206e356b62f), W(0x40032eb6034efee9),
+     W(0x4ba2ef8caf6f2c5a), W(0x435c36ccf38d17c4), W(0x4dd57ce622b6dfbb)},
+    0
+  },
+  {
+    {W(0xa1c50e22fffca772), W(0x826a8c5d2d9489ed), W(0xa9e13a0915968618),
+     W(0xc692af5e9de1fb32), W(0xf3a1494d8e78347a), W(0x35046245321c28b9)},
+    {W(0x3573160bf05896f0), W(0x90891c4122f4f0da), W(0x06321836da328d4e),
+     W(0x3d85150ad5ce1e1c), W(0x0773988f4adf9324), W(0xaec7b16da0492c4b)},
+    0
+  },
+  {
+    {W(0x3c70a967d36a134b), W(0xc484a12a209f779a), W(0x006413a17f6fa274),
+     W(0x5a4f19bd54fa3845), W(0x696d43374ac3e730), W(0x66a2cf392ad057aa)},
+    {W(0x917296b9e432f9d3), W(0x092e37ae6b2c4f21), W(0x41b9314b32b98ff1),
+     W(0x0337bdcb026f373b), W(0x928043627964060f), W(0xd503e1038942a3b6)},
+    0
+  },
+  {
+    {W(0x3fb6cf5abf1404b4), W(0xd35fcded0d15d48d), W(0x8ddb8d7cf3bfb835),
+     W(0x0a8432e615313e4a), W(0xdcb0a063e5051df0), W(0x1ca7f66dd3be792f)},
+    {W(0x5d469d3024247fea), W(0x8019949aa7177a4f), W(0x9a20861a810fbc5a),
+     W(0xc17da7b573f5180e), W(0x87f14a74759d94e9), W(0x011d931b9a6b59f1)},
+    0
+  },
+  {
+    {W(0xf035412e56e53c27), W(0x7d3235daac626e5c), W(0x13a34042549d67d9),
+     W(0xdc82afab19def5fe), W(0x2fc7713f26679d33), W(0x2ec02c6c35aba60c)},
+    {W(0x492344ca1e62a610), W(0x1802df5a37e9b18b), W(0xd293c94065ef0c7d),
+     W(0x73b83b5edb31d2a4), W(0x3ac30cb29082b007), W(0x96b5bf10a7904a47)},
+    0
+  },
+  {
+    {W(0xdb138d61585b25ca), W(0xecc552ebdb95e8ed), W(0xe205e4a46e225dfe),
+     W(0x1649551c12ad2c96), W(0x684a736b8fae0e22), W(0x46b7ecbf7b1ee20a)},
+    {W(0x50191869de536fd7), W(0x17415ac73f09e0ca), W(0xb1657c63b9d49810),
+     W(0x1fd0909c2cbfd8c7), W(0xdcc679368b67c9ca), W(0x044f38a85623c1b6)},
+    0
+  },
+  {
+    {W(0x4ca4177e89f43949), W(0xa887fe4e1c17df09), W(0x4f1f97abcf6d4122),
+     W(0xa8edf84c49ccae40), W(0x5876352896bc6d30), W(0x75ff9762c085236e)},
+    {W(0x6708b7378a2b12ca), W(0xf71b738d212745c9), W(0x36c4535b01aab58c),
+     W(0x3bb5915eba435910), W(0x1bc6b737f3b270a9), W(0x83735616bedc7d80)},
+    0
+  },
+  {
+    {W(0x9612934e1b15c221), W(0x3eee1c74c09d2a38), W(0xe758847c5ed56d07),
+     W(0xa077da64006cab3e), W(0xbe8a1a1069e829f6), W(0x52237d804649d8d9)},
+    {W(0xedf39aecebbfd183), W(0x97344c8deabf46cd), W(0xffb4e53c08441603),
+     W(0x3d6690677f62a5e1), W(0x278e83ad8ca79041), W(0xb6a7c3b964abcea7)},
+    0
+  },
+  {
+    {W(0xcca64f4e1425543b), W(0xaab46e4178a26399), W(0x3006009e42e6eb52),
+     W(0x8d1a9800dcbfe43e), W(0xfbb2b1b7cb9b4535), W(0xc816e504c521def9)},
+    {W(0xecd5831eda6c9073), W(0xe54df14c5feaefea), W(0x0b55a4412accd00a),
+     W(0xf04d272902c46c52), W(0x4269d55daa964a08), W(0x5f787346c3e524e6)},
+    0
+  },
+  {
+    {W(0x496059634db13361), W(0x8954fe876a4337f2), W(0x34f3e4ca189de7f1),
+     W(0x3fda41803be60d5a), W(0xd30e94fe746bbb6b), W(0xf21090d12657cc27)},
+    {W(0x02a9323bb2e8bfa7), W(0x3b1a1176ff720f22), W(0x8a7e962d1fa3381e),
+     W(0xd0a4937f777713f3), W(0x97bf86dd0f45cf1f), W(0xf00e2f9f0d88659b)},
+    0
+  },
+  {
+    {W(0x684c3a25a0446585), W(0xba574b5e5f5243dc), W(0x4c894158a12b3665),
+     W(0x7aed92189363b54f), W(0xe186b656d6c072f0), W(0x5c07921111cd9116)},
+    {W(0x74b9ae2e25b5e7ad), W(0x90d4131a9279b14d), W(0x4958a78c9b1d3b91),
+     W(0x08539e66d520fddd), W(0xe3f70829edf632ca), W(0x22f18a60fe906d31)},
+    0
+  },
+  {
+    {W(0xf367e5bc9b247777), W(0xe9cb94034f66d09f), W(0xfdd22b8a6fcba128),
+     W(0x5f8eb768a3c2d057), W(0xf6eb35764294c79a), W(0xe218dd911ca0d6ff)},
+    {W(0x1941a2f6f7571710), W(0x435d8a087f66804f), W(0x2f1a0315714b9fdb),
+     W(0x9ba4ec7356e4465f), W(0x03057d8518aaa999), W(0x275398f1989916c4)},
+    0
+  },
+  {
+    {W(0xfc350fbd04a7c859), W(0x7525222e897eac81), W(0xabef6d565bee2137),
+     W(0xd3399117d3f01bc8), W(0x6d53dfdd4bada2ab), W(0x724063ea4a71d3d6)},
+    {W(0x4fa801c775266e5b), W(0x56cea23f49f60974), W(0x7eb75a48433112fb),
+     W(0xe97a1c4192372932), W(0x7ca3d80331551b3f), W(0x3ff0af1356a97406)},
+    0
+  },
+  {
+    {W(0xbbad328758519121), W(0xcc83ec6b5141c709), W(0xadfef82228440bea),
+     W(0xd7c35ae931a14515), W(0xf707138cbbbcd887), W(0x0441aebd099aa04b)},
+    {W(0x6c8510bb5060a593), W(0xb477532b7f55551e), W(0xc7f4a8835ca41a32),
+     W(0x600b79ba4ffc9699), W(0xabd3fd3dd88f4062), W(0xb9c46364cf556284)},
+    0
+  },
+  {
+    {W(0x143e7ed09c3f906a), W(0xe73433f1333d06fd), W(0x5704054e4ab133a1),
+     W(0xb04c0c7df92476f3), W(0x8acf3281fc8d9203), W(0x856a85d489b02af5)},
+    {W(0x3e12e8df5ac63a0a), W(0x69a43dbf9c6cebb2), W(0x0e7bab167bd17a1d),
+     W(0x6b3cdbbc176e065d), W(0x715e55ba450bebbf), W(0xf7b4e33e0b9bb96e)},
+    0
+  },
+  {
+    {W(0x110e907fce8b89f3), W(0xb81971a46a101aba), W(0x53e023de65596ae9),
+     W(0xafe0b51456940c13), W(0x70e917dc3378b5c3), W(0x29ad1ca89a166a0e)},
+    {W(0xb9203415f23cdc09), W(0x989fc0801d5a064f), W(0x8ccdbbb29a5613f0),
+     W(0x5c1ce8f6e5bb2ca1), W(0x361f917b38b61c47), W(0xfc5134602c21d44a)},
+    0
+  },
+  {
+    {W(0xe98ced8ab190f225), W(0x9ce63ed4acafb019), W(0xc47c3118cf83659e),
+     W(0x99b542c055fa6dcc), W(0xd33059428e92f4e7), W(0x81de1ab0650b5787)},
+    {W(0xbec653307447acc1), W(0x6c40762dd539158d), W(0x8158c2ae5471ed90),
+     W(0x511c6a1576ef0222), W(0x590fb197bfe6b59c), W(0xf5e0b05376d32763)},
+    0
+  },
+  {
+    {W(0xc43d015a002fc720), W(0xa6e4e0af23dff2c8), W(0x9676b1eebcfc9dff),
+     W(0x9341ef31b93323e8), W(0x900e14c18d265958), W(0xe12bd78c99efd94e)},
+    {W(0x500c0a1daa8c7154), W(0x2602429cad3e1e27), W(0xedbd765c9749f9ce),
+     W(0x46301f888576112d), W(0x27a231e0d5f732f5), W(0xba60d9bf3052ed09)},
+    0
+  },
+  {
+    {W(0xe9a928f48ca8d862), W(0x5ce0f3a8c9cdee25), W(0x2fd9c3fa744c7943),
+     W(0x3894dedbfc1d0805), W(0xc6ef5ecd7e654784), W(0x541a66d3e62c7679)},
+    {W(0xe1c424402035ff5d), W(0xddd21fe198474d9f), W(0x210018a439d6a32b),
+     W(0xff9fdf842b64227f), W(0x0bad2e3029491701), W(0xbea7a24f3853d491)},
+    0
+  },
+  {
+    {W(0x4ee7c2709e4fd0a7), W(0x891002401e1807cf), W(0x2f62c27c3b0f046f),
+     W(0x7f1503b541cf6c8b), W(0x7c1b2e9bcdfce685), W(0xd2166fc62834bd34)},
+    {W(0xbc14a34214bec510), W(0x12a9615ad7c34ca2), W(0x3a50afd97058bec2),
+     W(0x7e65e5e0c9e62ddb), W(0xb3d5dcc3ea84db71), W(0xb15b57bd166586c9)},
+    0
+  },
+  {
+    {W(0x4364d0c8f365b4e5), W(0x9f9673a7a0136e18), W(0x7e1d8c46f1728021),
+     W(0x7cc7acef60081647), W(0x8f209151e14d1a45), W(0x80414228f02f4d0a)},
+    {W(0x756f0ebcff891f54), W(0x4434ed847b87675a), W(0x3a1dca56b00ed0ec),
+     W(0xfe644e1e8b535acb), W(0x0d5f6f0ac82c32e8), W(0xa2e3c118404cc3a8)},
+    0
+  },
+  {
+    {W(0x28da96f2f5b82696), W(0x3344c826f92cbcab), W(0x2fbe12de9bd4a021),
+     W(0x97b5940d7786e888), W(0x8d5a4e3fa4765059), W(0xbce1814dedb7b8b7)},
+    {W(0x74ee442476a705dd), W(0xc50706a33f8a3df9), W(0xd79387c934dfba94),
+     W(0x23a4a44a39303e39), W(0x57c5e866b3a6dbf3), W(0xaa31208550b8437a)},
+    0
+  },
+  {
+    {W(0x7d9152ec7aa8e75c), W(0x0a29eb1508e29f7a), W(0x1adf429986e0f3db),
+     W(0xb9d2b66948287b71), W(0xcb0f1b5b6265365a), W(0xd41f86ffc770882c)},
+    {W(0x5be1b237d53e2d8c), W(0x1ee39d45fc68b335), W(0x9e834d9f890e65b4),
+     W(0x1aba1f09cbcd8ec1), W(0x0ae42238544883ec), W(0xfd07d9e358a909be)},
+    0
+  },
+  {
+    {W(0xecd9135e7bf58ab8), W(0xae874514658b4b56), W(0x3c1eeb4513d98caa),
+     W(0x2c75b312023268da), W(0xf763c4b78279de70), W(0xd5cc0bf7a9c74fc6)},
+    {W(0x95d117fca7154fd2), W(0x6cf2c2707c7cc3af), W(0x756de73cdcfd3d2e),
+     W(0x226a14f54cd4b880), W(0x27cfaac5cc9767eb), W(0x1bf08c4fc1ff4338)},
+    0
+  },
+  {
+    {W(0x9d9e96b4616b25e3), W(0x4ce2c41e0264566b), W(0x369a4eb35081d3b1),
+     W(0xf80a19e2be6e3214), W(0x0ef240665b4fba63), W(0xfd7a749b724f3fd5)},
+    {W(0x80d141b6bb655a62), W(0x805e07b5a96f0eb1), W(0xbf994802c75d240c),
+     W(0x72102f6fac4d9318), W(0x50728c1cdabfd72a), W(0x6ce0789f1c13413c)},
+    0
+  },
+  {
+    {W(0xf46bd96359e484a8), W(0x8c9adc9604f96390), W(0x0d6bbf2769a41cc5),
+     W(0xbc21bb08a5a37592), W(0x5262e92e417d0bb7), W(0x3a6f9a98f96dd120)},
+    {W(0x644f488bb36cc174), W(0xdd1a6f0348eb6f36), W(0x67a0975934273671),
+     W(0xc588eeec808d208c), W(0x94d2571161a4b013), W(0xdece83bbafd5da01)},
+    0
+  },
+  {
+    {W(0xf66a7418ec502661), W(0x57fcf74922892e9e), W(0xc160994a6951839b),
+     W(0x1d950090a91151bd), W(0x97eef625c88969b5), W(0x25e2074b073346f5)},
+    {W(0x01d1a3f5a777f5f2), W(0x817ea1391aef5be5), W(0xec7059b1fa48b98d),
+     W(0x1f1332e9ba7dbc63), W(0xbf289087be97386b), W(0xa5b97668fdeeb380)},
+    0
+  },
+  {
+    {W(0xd578e42d2a03ce77), W(0x019e165c3ba83b17), W(0xbe6ca9fe236fc0a2),
+     W(0x6ed0f6f25108699c), W(0x443085992ac0cdce), W(0x5d1fdae1ca14df33)},
+    {W(0x5d1e8c1b051015ff), W(0x5bc67f2665f0cdbb), W(0x2d54288cb97bf64c),
+     W(0xaebfb8dc89fbd5c8), W(0x10b9d7573c9605a5), W(0x9199c83b1a80d7d5)},
+    0
+  },
+  {
+    {W(0xae4b05b7a539c59f), W(0x58f38744cbd02232), W(0xd66533b2e73252fc),
+     W(0x55d5d684f7f60455), W(0x940a583493cac9b1), W(0xb64b82fadec1596c)},
+    {W(0x7f1eedfc10327fee), W(0x7d3a2e0f2a2564e7), W(0x296be723e9d6f57e),
+     W(0xefa55376a9c0ce88), W(0x5d3b90d3a30e71e5), W(0x070a2ad1810eba11)},
+    0
+  },
+  {
+    {W(0x2e0788f6678f4eb1), W(0xcc34e35652a6a55d), W(0xf2529d38bb85446a),
+     W(0x7f0b21063b01bc0f), W(0x9c353e84817fdec2), W(0x1fbc1cd53f57a268)},
+    {W(0xd6955f15fd42f72f), W(0xe5db7f44db765086), W(0x9fe6674ebb02255a),
+     W(0x0b7d2ceb1e6b14d5), W(0x103c0c61828737b5), W(0x4809e7ed6bffa8a1)},
+    0
+  },
+  {
+    {W(0xe2faf0c90dd4b6f3), W(0x2daa1d52539aa67d), W(0xe2b6bf43cd6c78f0),
+     W(0x6a3a0a5e2554072f), W(0xa635ac4157cee83a), W(0x3be057a360c18f29)},
+    {W(0x8e839b1305590512), W(0xe7c925d225997649), W(0xbed293d960234e54),
+     W(0x7d5df547b978b9a5), W(0x3de7be921e386961), W(0xc8ff80250182eaf1)},
+    0
+  },
+  {
+    {W(0xb897b18c65199f22), W(0x424a0dc175c44885), W(0x604e1d73c33928bc),
+     W(0x5412d2b8a947c1b9), W(0x944025da230067cc), W(0x2f93f9969a0c1700)},
+    {W(0x71c95e9ac21575c7), W(0x9cd981d0943e0ed8), W(0xdcfb0e3b5f9fbaae),
+     W(0x799db5f1063a1377), W(0xbb7af05ba04e21ee), W(0xa9659742caf81c55)},
+    0
+  },
+  {
+    {W(0xfbb2276306889fc8), W(0x1b79ea9220cd6b78), W(0xcf3f9aa051e43202),
+     W(0xf2defc6dfc722c06), W(0x6ac7c739c7f370d3), W(0xe775e0c75f12adbe)},
+    {W(0x6889b745c693b6db), W(0x9091bfc8bbb7b729), W(0xd4dda0fc351cef08),
+     W(0x03e48fc4b40545de), W(0xb8113c0aadcde5a2), W(0x3182346af745c1d9)},
+    0
+  },
+  {
+    {W(0x81a839f9da4a78c2), W(0x5e65697071a953bb), W(0xb50a2fa142d7f2f0),
+     W(0xc22924ed17496c48), W(0x153db090eec03f70), W(0x88878c689aab5a6f)},
+    {W(0x0ba056bc3a9b99f0), W(0x405145290333e8bd), W(0xdfc38138c0362dd3),
+     W(0xf4608ca7cb66f703), W(0x34ea3869223c7ae1), W(0x05401e819356b74e)},
+    0
+  },
+  {
+    {W(0xe440ad7b1d0e3326), W(0x58a8ba3cf0d32650), W(0x112e0f1c43cbc70f),
+     W(0xb851efa3e532ef2b), W(0x085f25f735129fca), W(0xd7c9614e6980c0aa)},
+    {W(0x51797a56ce9d0ee0), W(0x929c589bbfaa6e41), W(0x8867c30f6c00ec72),
+     W(0xa4324dd821b92cec), W(0x0ce66a98128a0f94), W(0xcf206d11261bcd23)},
+    0
+  },
+  {
+    {W(0x4cbd2a40c06b4342), W(0x6011bf1eea064bb7), W(0xba6ec39dc73d3f7b),
+     W(0x8ce18fb1413e70a3), W(0x8fde87cea9f79ad1), W(0x64caf8ac60919e1d)},
+    {W(0x3676898bc749c46a), W(0x649cf2f60297e453), W(0x06f0d8106e9e8182),
+     W(0x1a2d9cb818799c52), W(0xd1325f1ed0971c21), W(0xde0361ac3bc7509d)},
+    0
+  },
+  {
+    {W(0x191da96ef4b91aff), W(0xec19c326557f3c36), W(0x40a12cdc87c6beb0),
+     W(0x7f30cc4d764c5946), W(0xe1568b43d179252a), W(0xa6e806977007be72)},
+    {W(0x34a12da89b7cf3a5), W(0x7e0e50995d493fdc), W(0xc3dc9257b525e9fe),
+     W(0xa37e08459a572147), W(0xf0c8dafc57d1c70d), W(0x1dc91449352ad7e1)},
+    0
+  },
+  {
+    {W(0xfa04e43e4372ed6d), W(0x16112f2cdbae33a0), W(0x578dd6e502bc5c71),
+     W(0x11f8a9df71ea0f7d), W(0x7e1a220640248784), W(0x1fceab435bc1646e)},
+    {W(0x0c0051f6463c0c28), W(0x7a27563e197a1e7f), W(0x0c95de0612f4afcb),
+     W(0x45ef38e749accc46), W(0x0762edc1ecdabab8), W(0x34679c9b93531181)},
+    0
+  },
+  {
+    {W(0xa40487a0cb4cd847), W(0x0184ea61fbd7c359), W(0x71897bdbb3a6a476),
+     W(0xf578cfcddb2af722), W(0x3d6abb9ba40a2516), W(0x605a9e6cc2409d5c)},
+    {W(0x8574b9770ec159db), W(0x85ca5d1018d7907d), W(0x26859068e81769b8),
+     W(0x3cd8647869e11f44), W(0x589203c6e5d6ce4f), W(0x69f9a6aaa45e0f72)},
+    0
+  },
+  {
+    {W(0xe172db3354a3175e), W(0x3868592b3cab3a81), W(0xb980fb268a4b1305),
+     W(0x69697fb3e0ed75af), W(0x3261362453a55f53), W(0xffacbc8905dee8f3)},
+    {W(0xc4c92f83a72e580f), W(0xb5e2164b88d6bbe0), W(0xce2abe945d457c7a),
+     W(0xb379ce7afcfe1ce1), W(0x4b81c11cac709ed5), W(0xe4afdc0587dbc999)},
+    0
+  },
+  {
+    {W(0x170ea9ce9018b1a0), W(0xbb3e67e0bdf5ab23), W(0x623cc0020f7bb17d),
+     W(0xba6954035a7e47eb), W(0x3538285242326a18), W(0xd1e4cfcd11298569)},
+    {W(0xa949e232eb6b4efe), W(0xe159305e2b0018f7), W(0x51f9eaf736fa513c),
+     W(0xd1c7661188b6a346), W(0x318389e4a0ca5870), W(0x06bdfdd31e9257e7)},
+    0
+  },
+  {
+    {W(0x5e4283789ea61741), W(0x4e0a313aaf9daf6e), W(0x1f9b6c6457b52c7f),
+     W(0xfc2d5c7e22b2ab86), W(0x56af895ea1719ae5), W(0xac85d567516a37ee)},
+    {W(0x83f3a58ccc05f511), W(0xe19c4622bd589ade), W(0x105e0f715e097f17),
+     W(0x5a433f61f1e382c2), W(0x1e700a45a1d65de1), W(0x58e1ee5677840a03)},
+    0
+  },
+  {
+    {W(0xc8ce00a3f11f1995), W(0x62f94796b2a40370), W(0xe00adbc0f1cc317a),
+     W(0xa960c2f02382a80b), W(0x82fef40c542a9f3f), W(0x7ebfe54115c4a5ee)},
+    {W(0x3cd773bee78247b7), W(0x6112f79095a062c2), W(0x79b5166d37532e05),
+     W(0x3e6d32cb287fd4db), W(0x8891efc878cb07dc), W(0xfacb3b286223fa48)},
+    0
+  },
+  {
+    {W(0xc3406c21e7d7a18f), W(0x868c807b19ac7fa7), W(0xc2fad6f2cd1f1846),
+     W(0x43c101642d5c86ad), W(0x31e73fdec6b94081), W(0x74f3b246c2f77861)},
+    {W(0xb6f1f890941ed399), W(0x07978581f1023c9c), W(0x449452cd1211e1a7),
+     W(0xf951c4dcb54d6917), W(0x769b40e70589badc), W(0x1033db00b3336b9e)},
+    0
+  },
+  {
+    {W(0xebaaedcf2accbbeb), W(0x15fa80413a8094f8), W(0x0652f6e683135652),
+     W(0xa1795c8997ed48cf), W(0x8c4f3b9bd193de5e), W(0x381d0b3abab143d8)},
+    {W(0xdcd7269d62e99f39), W(0x1fa03e56af390602), W(0x1e00365b8601ec79),
+     W(0xc34bef74edc0355b), W(0x0ddc00a2be384f8c), W(0x2d83cf8d1bcbd256)},
+    0
+  },
+  {
+    {W(0x55fa77032d48d170), W(0xb53ca82dbe10a3ae), W(0x5cddb022646e0510),
+     W(0x3cddee0d19453284), W(0x300dad168347abf6), W(0x86009c2da1d43b24)},
+    {W(0xd450f782d4522d94), W(0x53d3b26a24eb102a), W(0xe83923e7e82f1007),
+     W(0xa3c5d4cc69fb9126), W(0x358a8671739a0efc), W(0x4c8900bde67e76c0)},
+    0
+  },
+  {
+    {W(0x2c0ab8be4fece4b5), W(0xcf2af5b2d02a808d), W(0x7193becf80b7e29b),
+     W(0x6cd3cfc8970036c7), W(0x3d818d8647da3a0b), W(0x4ef961a8bd0e878d)},
+    {W(0xce76c8cd10cdae51), W(0x589ec89ec9769100), W(0xb67ceb12cb6d5f3e),
+     W(0x76224cbc1840aa38), W(0x8866a443838499cc), W(0xcb694a97266d00da)},
+    0
+  },
+  {
+    {W(0x98152ee35dcd1865), W(0x1d8cfa0fd9f97f0f), W(0xd0132b48a9e99a1a),
+     W(0xa5b7706dee7bfd42), W(0xeb103c4c323ab5e7), W(0x4add6f97ea345193)},
+    {W(0x579a05e83ccddb5d), W(0x8dc60bcfada0aae7), W(0x2dbe50eee1aff0d9),
+     W(0x8d5cc07831a46bc5), W(0xeb6bab9fc24ead6e), W(0x988fd0373b6c1b04)},
+    0
+  },
+  {
+    {W(0xa967c505b53b7118), W(0x2041adc6466ed4e2), W(0xf22b6f55302bdbe8),
+     W(0x4158bb6511a8e74a), W(0xda5b44c378eb4663), W(0xbdea990f8ca485fa)},
+    {W(0xcb46c288f6ded6d5), W(0xa8704643f93ef0fd), W(0xc0f7075e02960d48),
+     W(0xba25a5d39ac80e44), W(0x8f36d3a9631ea57a), W(0xd91ad162e0bdd891)},
+    0
+  },
+  {
+    {W(0x3619a0bfa4a25070), W(0xe90b66041ffe718b), W(0x6f213f532a23908e),
+     W(0x90a70f9c95bcf858), W(0x54b9f90c89840596), W(0xfdba5adc99e9c43a)},
+    {W(0x610f961e68576e52), W(0xfea0e2a4fc2a34c8), W(0x9a14880cdaa1ecd1),
+     W(0x4f86a1673ec42136), W(0x7bb6068175df3c78), W(0xa4a5ec230798cbcf)},
+    0
+  },
+  {
+    {W(0x64cbb930ed1eac07), W(0x55e280d9c12866db), W(0xc028723c3bbe7ee0),
+     W(0x3d9496ce5065aa87), W(0x0911a4c0dbea5e30), W(0xf47cbe940c7e1b6b)},
+    {W(0x1bc31afa42ec6c69), W(0xc56b9a63076272ff), W(0xb61b2715f1e15062),
+     W(0xf81a1bccd6d65f2e), W(0x29a623081ecf5213), W(0x1f53443f4448dcc6)},
+    0
+  },
+  {
+    {W(0x648cebba35627155), W(0x20850acb98a394a3), W(0x4bf61e74c8254d84),
+     W(0xd25346e4ac5dee56), W(0xf29e550b072508e0), W(0xd066329556af626f)},
+    {W(0x604a97eb73875ca1), W(0xc817e81bfddeaffa), W(0x0f130e9df73fd8a6),
+     W(0xd488737e2d04272f), W(0x04fd5f324cf63915), W(0xdecfdcfd9db8239d)},
+    0
+  },
+  {
+    {W(0x7cfb454bd7b173c1), W(0xc57e4a3854f73625), W(0xbdc6658f10937e13),
+     W(0xac106106a8484166), W(0x73a95fa1d9bf0dea), W(0x24a5a6e433015bc2)},
+    {W(0xf0b20368a408b7da), W(0x71d65c02d2af791e), W(0x8098084570090587),
+     W(0x5f02131fab6bff01), W(0x9065e806fb5550b8), W(0xc37192b24e8a349c)},
+    0
+  },
+  {
+    {W(0x96f5604b010326a1), W(0x900e623b29dd43d5), W(0x344215f76e814413),
+     W(0x3b40633956281787), W(0x951d291361205522), W(0xd971222e2924ce85)},
+    {W(0xb4084e9157248b3b), W(0xdad20e6bd18d9f94), W(0x5ece890546f679fc),
+     W(0xa1f63368fa5f38a7), W(0x486bc0a9c93a7309), W(0x763078f48af08217)},
+    0
+  },
+  {
+    {W(0x53ba15a2c6741fc7), W(0xaab301f81aaed7d0), W(0xa32160023dd29204),
+     W(0x27da9e1f30be357d), W(0xbc5b5b1c2f67bae8), W(0x54a25b224c417e89)},
+    {W(0xeeb9ffe28a801190), W(0xecc5c951f44c8002), W(0xc94d55ab9e9273c6),
+     W(0xf14bb57a75f7458d), W(0x5bb8a99280b29691), W(0x1a7cc778dc580d94)},
+    0
+  },
+  {
+    {W(0x10b8cea647c7dc61), W(0x1c51867ca89f1373), W(0xbff36b0c7ca6b07b),
+     W(0x802843197294146d), W(0xb20def8775e274b7), W(0x8642d4eebcf5634b)},
+    {W(0x2838ba7e93fd872b), W(0x099e81b81a116308), W(0xec05459b3de946c5),
+     W(0x01fadbc2efef056e), W(0x110338b26b17f9d7), W(0x839ce2d97040bec4)},
+    0
+  },
+  {
+    {W(0x0f1e164e2b524b0c), W(0xf69c2811d118a950), W(0xc6dfc17af07d767a),
+     W(0x852fe21cfb3cb14c), W(0x53de069516ab0204), W(0x5cbc4c795e1d15b1)},
+    {W(0x28d599b5d471bee5), W(0x1e98b82d01118ed2), W(0xbe949bd7952da3c9),
+     W(0xe88ca840184535e4), W(0xd2926e82f41cfd26), W(0xafb8ae42de244668)},
+    0
+  },
+  {
+    {W(0xea6a1837952282f1), W(0x2c940f9c483adab1), W(0xa05f53c050e60994),
+     W(0x4d5c0ee6dbc4674d), W(0x828dd741022b53df), W(0xab69eacd12d94242)},
+    {W(0xa20d6c2cc35673e8), W(0x352c1a611e887dce), W(0xb1247a3528ef98cc),
+     W(0x7f86d5d85ff81498), W(0x079d3aea6be72584), W(0xf1f3a4548408168a)},
+    0
+  },
+  {
+    {W(0x7197f7d4fb0a42e7), W(0xdfe18f90b1915c77), W(0x0874112a944edce9),
+     W(0x3e0a3adfb35d05af), W(0x2b8341825af9f428), W(0x15ae362fb5d73af7)},
+    {W(0x881a0c1126643a53), W(0x4fd65277bf5ac98a), W(0x42ddb7e9398f870e),
+     W(0xaa7e134eb72755ad), W(0xc0784cf50dc88b91), W(0xe12453263dd6640a)},
+    0
+  },
+  {
+    {W(0x14b5e323e26635dc), W(0x0fb95d35fbc182ce), W(0xe736960033223455),
+     W(0xd1f172693368eb19), W(0x43552e6779d9e48d), W(0x7f4c7086ecb56d57)},
+    {W(0xd866ea13c3e2698b), W(0x58efbda24f00dcc7), W(0x89fc0a2731055b16),
+     W(0x8e556b3b2177c58b), W(0xd7aa0114fe202dfa), W(0x0a90328dfad4c918)},
+    0
+  },
+  {
+    {W(0xe2fa5a15a78dfd1d), W(0x13f5863c541cf3fa), W(0x6ab24a3c8419d90b),
+     W(0x741f6823a05ccd5e), W(0x1c3116c02c5c6fb9), W(0x053ba84dd9a69353)},
+    {W(0x40ff0ad7aaa91c14), W(0x4900762c76091ed3), W(0x354f6e6c9dd2e8e3),
+     W(0x63fe37208934b077), W(0x7e7d6564e262949e), W(0x9179a08caa40e82d)},
+    0
+  },
+  {
+    {W(0x26ce3dd8c0ccdae7), W(0x7519e41f2827e4a1), W(0x6363f60103b61f75),
+     W(0x704bb386a6796d3b), W(0x2178aedab7af24eb), W(0xde9259258216b1d2)},
+    {W(0xd50342ff526b8e8b), W(0x37f0c6d1fa810605), W(0x31725d2d715b1451),
+     W(0x8b764757de307eb6), W(0x6d70988660102bf1), W(0x7c0615a77e9946ed)},
+    0
+  },
+  {
+    {W(0xea28ab089a6542f4), W(0x54b534db6974c50c), W(0x5c0fe9f00584f2a3),
+     W(0x7fb76da44914ecb3), W(0x15fcfc06199e7a56), W(0x098b9caf99252e5f)},
+    {W(0x02fd4c1a6900c911), W(0xfe14ada2d5f7485d), W(0x90989d92f1153403),
+     W(0x04c7b132a15a4bd2), W(0x3e599fcee6e31035), W(0xc236da1275ef33e1)},
+    0
+  },
+  {
+    {W(0x095f13cf2528f0b3), W(0x8c01724332df54dd), W(0xd9b110104b4e7430),
+     W(0x84af81eec352360f), W(0x667a7f7b95aa886a), W(0xfccf5525097291db)},
+    {W(0x7cc595ebbbf15f15), W(0xb0bf84154c1d01e3), W(0xa3f488395b1df0d9),
+     W(0x351ea0c8023689c0), W(0xb48bdc5b75093947), W(0x0c745c51ce46dc06)},
+    0
+  },
+  {
+    {W(0x51ca881bf284ca5b), W(0x562cf487988e59b6), W(0x863888358d2a0e0d),
+     W(0x92e2c30d3924dafa), W(0xbd0d0530876d1ea7), W(0x9cb47ee78623440d)},
+    {W(0x7ab996980a345f23), W(0x3cf0e994328744d2), W(0xb36256219ba347ca),
+     W(0x7385183ec63dc0fe), W(0xa91006d5f287f6cc), W(0x98ccb2858f364a95)},
+    0
+  },
+  {
+    {W(0xfdee81744ad3dc93), W(0x6c1edac1fc371bcc), W(0x00aa52a0808ea6fa),
+     W(0x754b4305b9f03558), W(0xd04c0ac139468276), W(0xd77b08b2ab909d84)},
+    {W(0x4bf628429d858866), W(0x7aab3d3b75fb6925), W(0xdbf4eaa0ba826274),
+     W(0x9b6b8961b11b2a27), W(0xf23cc2fdf335267e), W(0xe8c2ff3ab5ed5837)},
+    0
+  },
+  {
+    {W(0xa02967d24ba2bf0c), W(0x3bab81d643747de3), W(0x0b114f1b5ba2224a),
+     W(0x679864c5e2e27d92), W(0xfe027d203ab337e5), W(0x4b12d60979071a2b)},
+    {W(0x3417d157eac045cc), W(0x476c084a811355f4), W(0xc7ca56b93a640eda),
+     W(0xbfc505cb27c6ced8), W(0x7d6a4ec5f2ff000d), W(0xa39e07c3d2b14e99)},
+    0
+  },
+  {
+    {W(0x7b1ec8b9d1a7f109), W(0xb05c6c8b4aa75f05), W(0x575905229e940675),
+     W(0xd87f8cf6af7eb42e), W(0x106d92852383dde6), W(0x967ff620c86c3659)},
+    {W(0xe4608749ccf1494e), W(0xa3e937297f3ecf5f), W(0xd7a1ba7e1b4a4f5b),
+     W(0x26f5758d1d3c1e45), W(0xa23590411812d941), W(0x5507b403a410135a)},
+    0
+  },
+  {
+    {W(0xb6e8a6827b017f40), W(0x3ee03b9ccd2108d4), W(0x959ee5a6453043b4),
+     W(0x5cd35e643017a0ca), W(0xca10981a7ef2a371), W(0x506eefec2216b0db)},
+    {W(0x6e6fa1175f2ac399), W(0xaf9c0b4e3ab071f0), W(0x0f31d04760a0ccc7),
+     W(0xda5eb5634ecd6943), W(0xddff08c84c54898f), W(0xebdbc6ab5b8049a3)},
+    0
+  },
+  {
+    {W(0xf50e12cdc35355b6), W(0x1a9c0e3adb3b30d0), W(0x8cb883f0e7c2f44b),
+     W(0x301e23809383d4ae), W(0x9e28a94012ec76ac), W(0xa3783afc4dc26d5e)},
+    {W(0x0a0ce6c4f3d2b524), W(0xb2e0c62d96111d44), W(0x0376e4e8db3ae12e),
+     W(0xed94bba725e92693), W(0xcd5c6afee5496859), W(0xe29cfa3caddd59db)},
+    0
+  },
+  {
+    {W(0x31e5e182dd179507), W(0xac1c1ac6141faf45), W(0x097e2cf6cd8731ad),
+     W(0xc3e3da4c52c6c88e), W(0xed7d66d09ac92204), W(0x9cc5f2ef29d6be74)},
+    {W(0xc367020c32ed2f54), W(0x1ad70a2f7e1d1f9a), W(0x0fcf384678fef4db),
+     W(0x88a9ce68a3b42cd1), W(0xe23fc55a8df5295d), W(0xcd9ac9a2406ccc9c)},
+    0
+  },
+  {
+    {W(0x9a274394a4035dc8), W(0xd6456dacabb5f5ac), W(0x2e1badcb945f7876),
+     W(0x15c3a108ac7c0bf9), W(0x49e953d1c4a6a84d), W(0xd13329a08755aec8)},
+    {W(0x4413889366539f21), W(0x362ddd2cb6f4aaa9), W(0x1be9071150af210f),
+     W(0xe30cbec4b0a5efdb), W(0x9c697e8aa74dd421), W(0xf8cfeae090a31c74)},
+    0
+  },
+  {
+    {W(0x1fd6312dba310442), W(0x1c726a4b397686ba), W(0xf0b8821db9e4ccfd),
+     W(0xea9969665ba0db54), W(0x050f484aa2ef7c74), W(0xeaf6a1092cfde37b)},
+    {W(0x5eccf99d89f49729), W(0xdc8d478c5ff91388), W(0xb7a67213e1a01f09),
+     W(0x740aac6cc291ece4), W(0x6dfa6b7636800719), W(0x37b9e0f7181f5ede)},
+    0
+  },
+  {
+    {W(0xa80460e5c77bb6ef), W(0xd7634d9091d92415), W(0xd8850c89995da135),
+     W(0x9599136ac4f40268), W(0x03b6d6124ff507aa), W(0xe03ee837c0f642a9)},
+    {W(0xb4a56cda7a8f5898), W(0x616f75b0de9cff07), W(0xb807363ae229480f),
+     W(0x854f08fd7d432752), W(0x3275ff62c5019803), W(0x0984104fa3dd52b5)},
+    0
+  },
+  {
+    {W(0x3b2f1e0741d82285), W(0x2a14827acb69fa46), W(0x7c1b70a87039b21e),
+     W(0x8c9a4bfbe0bfa55d), W(0x0f21d28ef48a22e0), W(0x213bb1dcd496c68c)},
+    {W(0x39b17adc183c379a), W(0x60e2545018c39654), W(0x134b3689846fa366),
+     W(0x12d3fdfea90ffd90), W(0xee4c6547818082b7), W(0x8cf520a556269c9e)},
+    0
+  },
+  {
+    {W(0x0b36cf86d525e44e), W(0x9297d033423b03da), W(0xdaf1549e993d94a0),
+     W(0x7c4e09b1a7052451), W(0x13e931f01fb4a90b), W(0xee70e3bf54bf49f7)},
+    {W(0x42ed87a2f0eaf8f6), W(0x8084bf5e713e1a64), W(0x03042c425d9b0c0c),
+     W(0x8e6fba5c5f28c6ed), W(0xc85450e8cc5ba09b), W(0x91d18baf24fe4d15)},
+    0
+  },
+  {
+    {W(0x530857f0d60112d8), W(0xc93e2b2050bccd96), W(0x2c4a87ec50571f0a),
+     W(0x58473f2f861861ce), W(0x9d89f063a34fbe0a), W(0x87687360df162ad4)},
+    {W(0x152c0c8bbb09182b), W(0x4ac00f1c0b858896), W(0x80855a60fb02b389),
+     W(0xfa43c988ab49456d), W(0xf985a6064da81a34), W(0x52ab9a076e6c9a84)},
+    0
+  },
+  {
+    {W(0x5e522adbafcd7999), W(0xf6fbaef3331a7dbe), W(0xa3acb742d70c8ce6),
+     W(0x7ba8d820b52f15a3), W(0x9c2aa76d6d7a439d), W(0x71be02e4954dc3e8)},
+    {W(0x24f0b9a7c635bd74), W(0x29e30b6cc3472a83), W(0xdd839045449ced6c),
+     W(0x12916bea2ca992b7), W(0x0053656ecf64c1e1), W(0xf50797b93bd1ad28)},
+    0
+  },
+  {
+    {W(0x98f42a946a128a12), W(0x5afb5839e0438a65), W(0xc26e959a0a287dfc),
+     W(0x6036bcfb29cf2c93), W(0x9fb44a755bdccc64), W(0x5cd8a3ab08ab629b)},
+    {W(0x599df329211b2a80), W(0x389b8c9b3d691df6), W(0x16285f0d1244ee9c),
+     W(0x1e77a5c90e9d0389), W(0xaff3af04ef85eae2), W(0xd26bf9b4fea59a1f)},
+    0
+  },
+  {
+    {W(0x40834ef60a21110f), W(0x97dd7417cbd7c80a), W(0x6856dfac544a3604),
+     W(0x6f96d5dcc5bbc951), W(0x02e6be1a106ed5ae), W(0x3b9e5c5aca6de3ac)},
+    {W(0x63eb0b048327c102), W(0x82d256176459d7c3), W(0x7d718c4f1d1d0869),
+     W(0x4026b976abc8d124), W(0x1820c7840240da4d), W(0x0021c7f26ca93dcc)},
+    0
+  },
+  {
+    {W(0xaf431545ee0edea0), W(0x0bbbb9ac35caa142), W(0xafa43daf2de7a5b0),
+     W(0xf31b7bf32f6defdd), W(0x1badc29c177bd7d2), W(0xb693ceaae501b8bf)},
+    {W(0xeaf848de5b097b90), W(0x9d0b71df47cb783c), W(0x6cf2a947bd4cdd11),
+     W(0x375ac6e1d4a90e07), W(0x860b878fcbb0538c), W(0x0496dad5c8af7ead)},
+    0
+  },
+  {
+    {W(0x1c5ebc7a3392fe93), W(0x27e077aeab267d7c), W(0x5000f8403afa0303),
+     W(0x55225af7c193c111), W(0x4d22d909a98bd8ca), W(0xbdac467872771bed)},
+    {W(0x4e194fa07e6331c5), W(0xa2bf16ec97a247bc), W(0x089dcca183de3504),
+     W(0xe8f9bb3ab41f5f49), W(0xf62453a874d3937d), W(0xa4840257aa70536c)},
+    0
+  },
+  {
+    {W(0x25c8e26d312c1a95), W(0xaf11a7b94e05874e), W(0x7f2ea9291b8e28fc),
+     W(0x36aa5c85971e4c77), W(0x5daab2986290c4e3), W(0x0e10cf1e290ac5b1)},
+    {W(0x530fc9d0a9a5bda0), W(0x4cdc275b0b5489d5), W(0x19244eefaa4b7d88),
+     W(0xc19d925fe5833fbb), W(0xbdfa6ad8b552edae), W(0xf22915d9f9e8925d)},
+    0
+  },
+  {
+    {W(0xc1c76e1e46f6599a), W(0x7d3cb8349e79a4f2), W(0xb5de0b0bce88d4ff),
+     W(0x79b1b7a512e57611), W(0x96279221c317ac6e), W(0xb7ebef7944985aca)},
+    {W(0x9caf8de3fc2dfde7), W(0x3fa0a0b699200c92), W(0xce76501026d422ce),
+     W(0x2c8c69077cad1537), W(0xb24ed0ee1d867fd7), W(0x1570333703600731)},
+    0
+  },
+  {
+    {W(0x43b0446641a562ce), W(0xf06de542b1d2b64f), W(0x616ae3f1395084fc),
+     W(0x9ee4f7d517be9921), W(0x53c78dbbaa6dd7e0), W(0xaaa5e45e56c6ce20)},
+    {W(0x4770dfe8fac960f8), W(0xf06249fe68e1cc38), W(0xd8538371d283ee1a),
+     W(0x13c9696db6e81f5d), W(0x931504c645634168), W(0xaf0298317ae6ecf8)},
+    0
+  },
+  {
+    {W(0xf1a6a99cc1265360), W(0x6c650b38e3a1de8c), W(0x185b88c39398127a),
+     W(0x2f290493a768bb83), W(0x887b309263e7f6dc), W(0xdb8206cf4a59dd07)},
+    {W(0x073a96fe1a960dda), W(0x2e94a6abe32c34aa), W(0xadface447ec60c56),
+     W(0x2fedcfe63095081b), W(0xd6a4d162e824ae9b), W(0xc1c28382ffed0899)},
+    0
+  },
+  {
+    {W(0xdd624fe9f36de712), W(0x4f977bb19c79f926), W(0x15e863490dbb940c),
+     W(0xcb0eb961baee62db), W(0x4d79d44c3b937bf7), W(0x00add33fcd06f2d3)},
+    {W(0xf4948f11ce3d0451), W(0x83c075dff94372f8), W(0x37feff4992e41108),
+     W(0xd58f75660f776d7e), W(0x534c996eb5cbefb5), W(0xf9039c35876c1de4)},
+    0
+  },
+  {
+    {W(0x17cf5629c8e2d138), W(0x964704e94bfb6e75), W(0xaeee0932b36f624e),
+     W(0x70cc282324f298a2), W(0xb3831dd15e18e0a5), W(0x520ba31e8706eab5)},
+    {W(0xf8bb9800fc068a02), W(0xebb2b7de86ff91ca), W(0xf118f18943f1afe0),
+     W(0x3150b70def49b73a), W(0x43849a3954d40301), W(0x5e743857f28f0e00)},
+    0
+  },
+  {
+    {W(0x0e1c4355034ddd7e), W(0x2da9dcaa89d8bc29), W(0x189bf6e83361a74e),
+     W(0x1149d7e514af6026), W(0x057d15799139e036), W(0x01fb36e873d74bc3)},
+    {W(0x79ceed81d0562af9), W(0x181a7ff83705768c), W(0x119dd596b8318e25),
+     W(0x86337c568d64358d), W(0x3fa6366422da15e7), W(0x4eb37202df0c7f51)},
+    0
+  },
+  {
+    {W(0xa2312c2f9ea38d5c), W(0x9680a1d9c06d045f), W(0x45d7497fa98c711a),
+     W(0x0df98da276f42ec6), W(0x379b76451e3ee377), W(0xfbf912292fe301d0)},
+    {W(0xd078f5f745185b7c), W(0x84dad88d21ca0a4f), W(0x71316167400aa8f4),
+     W(0x30dd92aae4659d14), W(0x52f5ccf5288682ce), W(0xc54499e7facdc20a)},
+    0
+  },
+  {
+    {W(0x876c1e49f0041f0e), W(0x3e52caf189d96352), W(0x70dfa7a56984c5e5),
+     W(0xec6157befe38794f), W(0x4954aaba8ec70de5), W(0xb7a83123d036dfa0)},
+    {W(0x39b23cb120ded7df), W(0xf0594895a6ed65d7), W(0xd96a0bfd0824b957),
+     W(0x3b30f0a641f70ed4), W(0xd2bfda7fd06c478c), W(0x992c9836fde59c7a)},
+    0
+  },
+  {
+    {W(0x54a4fa0fabb6b0d4), W(0x7cd7a6f13dc5cb1c), W(0xa473440a66fe1bdf),
+     W(0xd16b2a9116c8e63d), W(0xfe56d3bcc247f3b7), W(0xc9b856a904f13c6d)},
+    {W(0x37b041eaccbab5a9), W(0x981110fd986b469d), W(0x1e2674c0f5e48d67),
+     W(0x74ad2d0712c11846), W(0xd51395f15123413f), W(0xdd13c11bcda6a11f)},
+    0
+  },
+  {
+    {W(0xb6f801b5903f4414), W(0xf4799caa752117be), W(0xb28a57b07448c8a6),
+     W(0x329b83785f7ad7f6), W(0x895bbf6840d26731), W(0x36e3cbe9781c61ae)},
+    {W(0xe07c1d9ceb8a8abd), W(0x427b78b992fdae14), W(0xfc2cda044152e558),
+     W(0x5ce72f1cb249ac02), W(0x772be19ee340bac9), W(0x98260d18bb2b8d70)},
+    0
+  },
+  {
+    {W(0xad34803230b1b320), W(0x9b265c225c725341), W(0x3f3e7f28de51409d),
+     W(0x6e88b364245c40b9), W(0x3288e133aa690511), W(0xe5ed376d88e68df0)},
+    {W(0x87dff1ed8759f386), W(0x24824432e3893c40), W(0xc907586261a4d19b),
+     W(0x72e8ac2ca3bb499c), W(0xec8affb39e5f5178), W(0x25b6ba80f3d9a07d)},
+    0
+  },
+  {
+    {W(0x12b9c3aec16324c7), W(0xe7a0903794961aca), W(0xd56cf081fbf9d42f),
+     W(0x180c2abd76bcdefe), W(0x73a567fbcb1307a2), W(0xf7620152860c6b7a)},
+    {W(0x86ee9ebebc13d012), W(0x18f22a910cc524e3), W(0x6b6c85e609734cc4),
+     W(0xf82e1336679dd6cc), W(0x71e9f1dc626bea5c), W(0x2cce25182bc49773)},
+    0
+  },
+  {
+    {W(0x4bf0a5aa2b32718c), W(0xb25010f65df34dcf), W(0x9bd6b6b1bddf00d0),
+     W(0x004efdbc01bcaa2e), W(0x519ce093949e5dce), W(0xcc450ac647ba141c)},
+    {W(0x5e8a141bff4aba33), W(0x15a9f2e82f806ff0), W(0xdadbf22d4c71c765),
+     W(0xccfc6751c0e29088), W(0x32392ea12fb24ee7), W(0x6dfcd65a1e5f3c39)},
+    0
+  },
+  {
+    {W(0xf11e1bc0a0094354), W(0x6e82e2393d2e9d5e), W(0xb72197e761c7f52c),
+     W(0xbe95232c98b5abde), W(0x4b984dd805bf4d2a), W(0xa4af768609534ffb)},
+    {W(0xacd90ab526e76fa2), W(0xc6f642d0e5fbba24), W(0x011c4c92753d1d52),
+     W(0xfcd2442add73d323), W(0xd0d70ac48636d606), W(0xc55725a286bcc7ac)},
+    0
+  },
+  {
+    {W(0xcfde5f0f78e7baf7), W(0x680fb0e71cac6f23), W(0x6481d528a994f2bc),
+     W(0x317d3ecae5dfb882), W(0xeacba61f29e70ad7), W(0x4c9984aba16c3b48)},
+    {W(0xfb4c53b22118e1ee), W(0xf0bed8823ee88d7c), W(0x13f914c504d44704),
+     W(0xb00a64c305a2223f), W(0xebb46ccef890d25e), W(0x3c99dd2de0c6eb01)},
+    0
+  },
+  {
+    {W(0xca914308718c90ba), W(0xa75dfdded7fdbc7a), W(0x63e464c1b8fc94df),
+     W(0xd912d21c0eb00dd7), W(0xd0c0ee4ed63ae1cd), W(0x3144f7436acc8593)},
+    {W(0xb020d905cf2f3d74), W(0x73311416d625c619), W(0x33ebbabff2307e43),
+     W(0xb4156f61cf22b36c), W(0x9dad0ca5bef9f79a), W(0x1368222f2ba27a8e)},
+    0
+  },
+  {
+    {W(0x3348fb7ad9218fd3), W(0x9d84fa8f62ccc722), W(0x1d5ce9c49b768625),
+     W(0x6171cb014e849da4), W(0x60eaa65a67543d41), W(0xc3876a0f9441acbf)},
+    {W(0x6ee7724aadce88b1), W(0xde291f7a027fec28), W(0xf8100f31870db18a),
+     W(0xb7a040c48d2b6521), W(0x458685732609754b), W(0xba12af9b4b3f1c82)},
+    0
+  },
+  {
+    {W(0x571214c7ef8d487d), W(0x79fd28696a967440), W(0xd2a807239ba9d2b3),
+     W(0x49d74b2c9e1bc02c), W(0x989ae02191c225be), W(0x9d2c6faea7c49882)},
+    {W(0x579d33d7ed0c94e5), W(0x3fce7bc4d1157761), W(0x7a03219b8eb2055a),
+     W(0xfbf16c70be81afa8), W(0x0a46d7cb7898327a), W(0x3c47dab54cec518e)},
+    0
+  },
+  {
+    {W(0x1cc2252f191db0b2), W(0x8585ca8aa5aee83c), W(0x740e466bc92f1918),
+     W(0x3e659bd8e971d409), W(0x1a00c3f5ab1f54e2), W(0xfb3cfc0a12998a68)},
+    {W(0xde0b815e30c02de3), W(0x3cad4758c676a203), W(0xc70b0da5e729d4bb),
+     W(0x3fc3699b5443ef98), W(0xeb18511571b7b49e), W(0xdf4fc3182eb25849)},
+    0
+  },
+  {
+    {W(0x59c6712bae3bf04b), W(0x05998a13fa450928), W(0xa3bd421900e3945f),
+     W(0xbdf037bfb65f9a9f), W(0xac8cf7a1e83734aa), W(0x94cbf8d0c77ea2cc)},
+    {W(0xe5bf027fb9698c2f), W(0x54de57d6d68325b5), W(0x42e4aa9b3cd95169),
+     W(0xbe45292277950b15), W(0xe845b6fe32d3e902), W(0xc36a33cc22f0738b)},
+    0
+  },
+  {
+    {W(0xdb32b61833692046), W(0xc89a0c139f831628), W(0x5ed11971603232be),
+     W(0xc1c3edb56397a1ad), W(0x6533b9c72a1f827a), W(0xb037c7a238c11cb4)},
+    {W(0xdaf559670a6b25d3), W(0xa00ce8c24356a056), W(0xf704acb495395b07),
+     W(0xe813711f68a53df9), W(0x272c6b5c80e71290), W(0x46b3fc5ee0b50ff0)},
+    0
+  },
+  {
+    {W(0x3a6547b17b9d3560), W(0xf1ab9fd7954e2fc1), W(0x1aca62988d4e2e3a),
+     W(0xc4735e97a80e5212), W(0xf4e81a252c6496b0), W(0x499cdb3a4fe5d8f2)},
+    {W(0xeb3db2c46840da68), W(0x3d689f6f89fb5c80), W(0xb2dbc28f60223f4d),
+     W(0x7d7948d9338386a2), W(0x731cab93b204b48e), W(0xd5933472a6815b23)},
+    0
+  },
+  {
+    {W(0x49728febe801c8ef), W(0x85b888a83468085d), W(0x4d5e26fa0332bca8),
+     W(0x168594b4686592a7), W(0x380888a3716fcf88), W(0xc940f76424968052)},
+    {W(0x8bc859a4eee18230), W(0x6e925e19219ad9be), W(0xdfb82d4db3e799fb),
+     W(0xb506c20b8ef96773), W(0x1db11d80111513d1), W(0x1c350356eea39fd8)},
+    0
+  },
+  {
+    {W(0xd7f963fb3e1e1beb), W(0x0d079f70de5052ca), W(0x5a73a4e7e3fbe253),
+     W(0x68a7fdc70ec7d280), W(0x6583e240ae31f94b), W(0x12e0195ddcb88d98)},
+    {W(0x5abb545b88ac9177), W(0xb2d33fc2ba54be52), W(0x307c717b0357140e),
+     W(0x88a8dfa80f5f3da0), W(0x48f72eaecf876b38), W(0x0c800971980331c0)},
+    0
+  },
+  {
+    {W(0xaaf727d9189e43a3), W(0x1ee12c54de8b12ef), W(0x1efd7570a329437f),
+     W(0x3a7b828cf6977f4b), W(0x57f989ec82aa39a6), W(0xe278ea51007c841b)},
+    {W(0x8c0ceff27f0b8720), W(0x96e7a49cba20a74a), W(0x44761c7b8d36b2cb),
+     W(0xc2bcd1d4166e89f1), W(0x415ef46fe4c4eff0), W(0x692c187ee07e9964)},
+    0
+  },
+  {
+    {W(0x90695b3f08cb1209), W(0x699a0e20548a596a), W(0x108a5e67d4dd87fa),
+     W(0x58ea5d63a5882295), W(0x9028aa863bbd8444), W(0x5d8a0825baa113fc)},
+    {W(0xfbd597f8a0f93825), W(0xd9c086687cb2b828), W(0x4645b3d316901f13),
+     W(0x35335f91f77ae9d7), W(0x66eca6570f6a8ffb), W(0x51233ceaeab99f04)},
+    0
+  },
+  {
+    {W(0xf73c45ce39cb9bef), W(0x8c40ce1912edf4d3), W(0xac32946231fcc722),
+     W(0xd8aaea8d3749ab4d), W(0x9324f54025fb7074), W(0x3cafff5d96e1e568)},
+    {W(0x20dbdad6642a08b0), W(0xfddb91854a1d0ca0), W(0x17077c6320297ce4),
+     W(0xddd4bb5c95ef2fc0), W(0xe41512d74bafb224), W(0x810da5bfc21de297)},
+    0
+  },
+  {
+    {W(0x04d30626f5da3dfc), W(0xaa879c44c6713e7a), W(0x0498fb1c13867d9e),
+     W(0xd0bc15c81fe9df7c), W(0xc6e75fdefd9df8cc), W(0xd6acf4a8675e114c)},
+    {W(0xfe96b560169da322), W(0x565e6cfdacba3a69), W(0xbd9263c67a592018),
+     W(0x526639b3bac80e53), W(0x7ca88359f3a2e1e0), W(0x462527709d4d8c3e)},
+    0
+  },
+  {
+    {W(0x56fbc251fe1afa01), W(0x7b0016be58f8b2c1), W(0x32ff79cf8b5233b7),
+     W(0xd0486d0301874fea), W(0x6cf67f27a4586e33), W(0x2e5e0ddfe16ea6f1)},
+    {W(0x84e4a092b5a70429), W(0xc923b2e5f8ce9fde), W(0x382382ae5fe8851e),
+     W(0xc571f53009281e8f), W(0xae7eb2eb85abde61), W(0xc610c96d48cc218f)},
+    0
+  },
+  {
+    {W(0xf0cd3455a2911974), W(0xc929289236ab817f), W(0x31c6036cd3d559e4),
+     W(0xd6ad8be427bb592f), W(0x426157d4f8553b26), W(0x3365034e9824a2e6)},
+    {W(0xa38946c14e21b707), W(0xadfc934677b36ecd), W(0xc6827e02e5d0482a),
+     W(0x4e1b276bb0264bb7), W(0x3e47eccef09b867e), W(0x22b24b1bbb350a54)},
+    0
+  },
+  {
+    {W(0x07350e1dd7123e85), W(0x64842e11c1579f85), W(0xedfda78748c142af),
+     W(0x942715b6ef686a43), W(0x25c059c08c9a6edc), W(0x6127abe4ee136c72)},
+    {W(0x90ed266100718bfe), W(0xb67d5f18bbbf66ff), W(0x94fad1a07ec4503c),
+     W(0x21908b593e4fbdee), W(0xa93f249af83f3a3e), W(0xdd8d493951d68996)},
+    0
+  },
+  {
+    {W(0xbcdc34c86c959e5b), W(0x1e3d58d1bd4a0d97), W(0xf096a803a1c789c6),
+     W(0x21a72a3918946c0d), W(0xac1824818eaf56cc), W(0x5a5cd2d5229fa1a7)},
+    {W(0x63beb0f9698d705f), W(0x103afb033a4828bc), W(0xe5d450b7c844f9bf),
+     W(0x248e6095b788022f), W(0x58ddf7d80f305a3d), W(0x213e98720c99de05)},
+    0
+  },
+  {
+    {W(0x033f87f56ef15cdc), W(0x77725872ea714777), W(0xec55dab2d6409cb1),
+     W(0xac303ab0df920681), W(0xc45ccd8fe9623b20), W(0xab5c377c1cc90c4e)},
+    {W(0xcc4853619229dc73), W(0x3dbb15ea21197a5f), W(0x4ea3e6532a41bb6d),
+     W(0xe432224efe65f8fd), W(0xca4321e5750ddfdf), W(0x5c8cbeddaabbaab1)},
+    0
+  },
+  {
+    {W(0x7ae5a511e9bb4e4c), W(0x40dc6933a8da2d85), W(0x7838f1a51c2ec73c),
+     W(0x23cca5147e7c4f89), W(0x882748bb979fcd25), W(0x3c9ac9d12adb844e)},
+    {W(0xcaa7efe53e4bc3cd), W(0x247ac81013d10462), W(0xb3c9770a033dcf10),
+     W(0xfdc4fcae5e1a3b50), W(0xf71fca0fcdefc31e), W(0xb279ff88ca78045f)},
+    0
+  },
+  {
+    {W(0xf4a3ec617d57c8d0), W(0x1a7211c55cffb8d7), W(0xe96b10f3b1e150f6),
+     W(0x980655563511c38e), W(0xe7511230c1dbf60c), W(0xa74939f041da5f3e)},
+    {W(0xa5d158f69575aa2c), W(0xf8fdbc922c0cb0ec), W(0x92e1a244a913dfa8),
+     W(0x38fc4e81c4c00c38), W(0x71d1fe78c8077d34), W(0x8adc4a6b04ef6f82)},
+    0
+  },
+  {
+    {W(0x137e4662f9f9fb46), W(0xa48d2b55f3f84a8f), W(0x683403fdc6ba24fc),
+     W(0x068cca231f425a51), W(0x076690392f9fb0b3), W(0x06549a77959925ac)},
+    {W(0x23829dfd27b162bf), W(0x677976647c0b974b), W(0x81767c6b94e45a20),
+     W(0xc1c49cd576d54345), W(0x38d3fb4aff838c73), W(0xb60b6429a784bf8e)},
+    0
+  },
+  {
+    {W(0x390a08133db9d15f), W(0x3027c5834870efe3), W(0xec46d1d74b9962e8),
+     W(0x3be93c218ec1c3bc), W(0x0f672c442dcb88e4), W(0x52e85c372dc7865d)},
+    {W(0x011ede4397949d31), W(0x618204c2e73857d1), W(0x0fb5530011f1ba4b),
+     W(0xa46a030f7148e63c), W(0x5419bd00831e3767), W(0xcf783949b1002eab)},
+    0
+  },
+  {
+    {W(0xf5623a7fd74af409), W(0xbef5976f18c39d55), W(0x52bbddb169f485c2),
+     W(0x4c71df068d05488a), W(0x889a1b3d183d51d7), W(0x71bb7376687d3d77)},
+    {W(0xe9f16e524755cb6f), W(0x73b41b1241ac91cb), W(0xdd1c4597a48924a7),
+     W(0xfc05bd8ed8a763cb), W(0x1d08b6581a81f28b), W(0x3e3357bdbdbffb3b)},
+    0
+  },
+  {
+    {W(0x99355075a1cc8335), W(0xbd753c02d554f187), W(0xbf8673828daa21e9),
+     W(0x99a273c92de8bf18), W(0x963dd6099a0864e5), W(0x94c0cacf21428510)},
+    {W(0x5231961faeb6ddf9), W(0xcdd93b157895a771), W(0x446c677de82a427d),
+     W(0x6eae9a026c19f486), W(0xf30f8c4ff0924438), W(0xb15fdaeddf7a8f1c)},
+    0
+  },
+  {
+    {W(0xb8158f3badd381fd), W(0xb73511b4dfa2f54f), W(0x509579f4bc380f4c),
+     W(0x76e5a600ae272380), W(0x71cf62147cb7efad), W(0xb49f1c0d890b1a5c)},
+    {W(0x23f7af1893d2262e), W(0xcc53a9a45db481e3), W(0x56f90f3f54cebf8f),
+     W(0xa7ce2d6d8faa9070), W(0x0eea041d97165a4e), W(0x5833a465d9540328)},
+    0
+  },
+  {
+    {W(0x819db2d37806548e), W(0x1e8611168c518bfa), W(0x7ff171cecc29cb74),
+     W(0x09e6d04e354a1e77), W(0x3b43b75011b430ff), W(0xfb95250d019d89c9)},
+    {W(0xaca87a0235e96f53), W(0x867b129a5d07dadb), W(0x71f927acd185e5b3),
+     W(0x3e4b2d59e4fdc02a), W(0x2489e6b25e949d9c), W(0xe57f125dbedacf3a)},
+    0
+  },
+  {
+    {W(0x927d7a131a2a7b19), W(0xfeec3d05a3d734a0), W(0xd2a24c81a3cc9c9e),
+     W(0x8509b7e2e8cda84c), W(0xda4d33bb6da7dc23), W(0xf7ab675e99bf701b)},
+    {W(0x506fe6ea2231b105), W(0x5bcb455e8ca5af27), W(0xabf2c3d39e1976f6),
+     W(0x5cb2e415a7883b5b), W(0xca52db04ab0f6a75), W(0xfddc079c8b3f11fb)},
+    0
+  },
+  {
+    {W(0xad07448369a37db5), W(0xbf27aa798cee75f2), W(0x64e493633a92af29),
+     W(0x96aecc7b66e61faa), W(0x604a47683364b980), W(0x8cf7a9730a5c5e8c)},
+    {W(0xdc8cb34e40e0e2b1), W(0xc54726ba7680f209), W(0x27ef964bb5987d01),
+     W(0xe2a7d78ecd98a90e), W(0x57b4c8be039a2fd1), W(0x3cec3385357ee389)},
+    0
+  },
+  {
+    {W(0x65cd357963ff25ae), W(0x6a8e30cc1aaf2e3d), W(0x6324d9db4a4d73cf),
+     W(0x90dd40151acaebfa), W(0x1d591a8aeaa29fc0), W(0xcd837f867939f29d)},
+    {W(0xbbc2ca7746b82846), W(0x2ce20ce207f05f4c), W(0x8cf8bc5340273ec8),
+     W(0x748e8e48eb4d1620), W(0xf4aacc21fb5d4e8b), W(0xf0446ddcefd0aea1)},
+    0
+  },
+  {
+    {W(0xa24d7aac4cb9f702), W(0x31f6c2509dc3e451), W(0xb3c9a607601f3978),
+     W(0xcc4b96f86227e8d1), W(0xfb6038224f8b6f3d), W(0xf04c529cf945c388)},
+    {W(0x8bae5bbe5f2d14dc), W(0x9ab2d5db967daada), W(0x004ec335fba6899b),
+     W(0xe32274da118b8a9f), W(0x95f57dcbeefd7499), W(0xbc32e334a1f8dfaf)},
+    0
+  },
+  {
+    {W(0xe97f92e42a4df800), W(0x3a8a7e9c3a9d92ee), W(0xc2266916b2e5e40c),
+     W(0xf21ece9311fbc802), W(0xa216533374d6ef3d), W(0xedc05efbea996c1a)},
+    {W(0x23a6aea6c6bb8222), W(0x1ea9c446173e9562), W(0xeb3d7580930eae45),
+     W(0xe07e6877488487cd), W(0x1c0a6c69577a74e0), W(0x852727bcccec6038)},
+    0
+  },
+  {
+    {W(0x531ef098de1b6fa9), W(0x6cd9a408b68f9790), W(0x0d5cea4300a6e359),
+     W(0xe6a306f5930e3715), W(0x75a7b8545c1aac24), W(0x6228533f514c1a60)},
+    {W(0x43d42a273a758941), W(0x3476233ce67a0a7b), W(0x9d1197d7cb8905ed),
+     W(0x7e8dcf543e46c56b), W(0x53c8855c5e15b3f8), W(0xd3b85c9fe84b03bf)},
+    0
+  },
+  {
+    {W(0xa4afce084cb6979e), W(0x39ab825af6abd1b5), W(0x04f0578834c0f5ae),
+     W(0xb39ef5dc8285fae3), W(0xc8687f40536d0013), W(0x9dcb85bd9e0063bb)},
+    {W(0x79b9bcb59cc01fe2), W(0xb0a29697d1d26fa0), W(0x5de805ed49808dbd),
+     W(0xc32967525c28ac7e), W(0xc84a12b68b051e4d), W(0xdad4e2483e4ba5df)},
+    0
+  },
+  {
+    {W(0x4f6bb1a6a52523a4), W(0x939a0c0eea40d089), W(0xa01116d3605b9a81),
+     W(0x3ffa9edc5262f662), W(0x334c7698c0926e5c), W(0xeb48831c61d5e9f5)},
+    {W(0x10d289db13ee818c), W(0x373dba8d67b09034), W(0xaec37187f21ecae2),
+     W(0xef9e466692980c00), W(0x769af13eddd3d3bb), W(0x3dfd59a0d85d4e50)},
+    0
+  },
+  {
+    {W(0x76f520e34957c80b), W(0x8c686aeded1fb2bb), W(0x4ad55cf19fcd09ea),
+     W(0x632bd55ad40248aa), W(0x7f2b86adf08bba4a), W(0x0b798fce07b6e922)},
+    {W(0x3fd97acc9c70299c), W(0x14d93524b4de3e7d), W(0x3181f9b5a7b768a2),
+     W(0x72fa78508d4c4a97), W(0x7e1fed2d55af6985), W(0xd84faed4fc585124)},
+    0
+  },
+  {
+    {W(0x91fceeb27aa02496), W(0xf3db3a86d4007244), W(0xdd5d4e06b6cb1dd7),
+     W(0xa6ce9dfceee1bed0), W(0x24325107ce366a18), W(0xd19fbaa6ad4fabbb)},
+    {W(0x2ef98e73a08162a1), W(0x1496ab1a98f50125), W(0xe8c6ae5c17f930b1),
+     W(0x54ae0699dc98947d), W(0x99058d8eff99666f), W(0x9bc9a1fb8cc0d369)},
+    0
+  },
+  {
+    {W(0x54f1945e5efb6ab1), W(0xd5d609c7fb9b21e2), W(0x0209d196bbc3b2e5),
+     W(0x25da6baf462e66f8), W(0x2de3e77088a39e8c), W(0x6bd4d500a7fe130c)},
+    {W(0x1c97c43419cdc0cb), W(0x21408c57717e6a8f), W(0x8e5efd767447e3f4),
+     W(0x4ee5bb076094c191), W(0x8e51a17340304896), W(0x7b67a5fc402c7f5d)},
+    0
+  },
+  {
+    {W(0xa7bc505e91d58fe0), W(0xe0b44bc4571a4b8e), W(0x68a153dd4087fdb9),
+     W(0xd7685b6684d273af), W(0xcab75c9f205c0951), W(0x43ebadd4a7352166)},
+    {W(0xb05a1b56078dc377), W(0xeeaaa81d667415d0), W(0xb850f91e54a76269),
+     W(0xd97b6ed55e285dd8), W(0xe14a5c7a74b3484f), W(0x8b686a21cf40ad75)},
+    0
+  },
+  {
+    {W(0xb196445ecd4efcf1), W(0x376e4e13ee72944b), W(0x9897c37e03b7d9c3),
+     W(0xf0c9d50d0b9e5399), W(0x32e12d24ab608da3), W(0x9c7bb1f69d5798f7)},
+    {W(0x14054994843792aa), W(0xe68842387b2bc611), W(0x4afb82257d878b1a),
+     W(0xcd086acc7a545b56), W(0x220c7871e88ed467), W(0x367a6553f27332a5)},
+    0
+  },
+  {
+    {W(0xe7f897958fcc9d1c), W(0xb949eaa88eb63875), W(0xb1b8fd6b2267b33d),
+     W(0x90b3f5a007185f5d), W(0xd26c139e971912e0), W(0xa02fab671f449ac2)},
+    {W(0x82dc862e9399828c), W(0x92ae123a579a0d5f), W(0xb84881354feb4f8e),
+     W(0x027098fb7f7b452f), W(0x9b5e0fbe845280a4), W(0x66b1a399ac57e3ed)},
+    0
+  },
+  {
+    {W(0xf3a6124fe8d05b92), W(0x770ea0c51436fade), W(0x53698fae832e528e),
+     W(0xca9ef8bc536cbab7), W(0x92578c763b691192), W(0xd85d3d33176b8573)},
+    {W(0x44a9d4ed00efbd87), W(0x33a9f5b5da62d7d4), W(0xc61735e2af2f4137),
+     W(0x34a734f9b6dcd00e), W(0x9cc6558a497712f5), W(0xa4d04f885718dff2)},
+    0
+  },
+  {
+    {W(0x6416f0b9c604fbbc), W(0xd5f4dc3e7683199f), W(0x6dc899f6eb673b7c),
+     W(0x19f0db158db14290), W(0xfe6aba5da24516ee), W(0xa32731e0fda74632)},
+    {W(0xa02d6110a0de2563), W(0xef7d5b773c54b2f7), W(0x3234da6aa19190af),
+     W(0x0f900057e378ea4f), W(0xfb930085d233c605), W(0x4b9bcde80003ad2d)},
+    0
+  },
+  {
+    {W(0x6dbe24f45475317b), W(0x15a7d3f9b498a323), W(0xa8f677f0b0eb632e),
+     W(0xd3bf764b31c182c0), W(0xeb9ef2f50884b22e), W(0x81e2e78cc2382ff2)},
+    {W(0x8c9d3637e3b50729), W(0xa74616c8ff0b1ade), W(0xae34756c18fda42f),
+     W(0x3f23562983565a56), W(0xcb7922d3cda5c6e9), W(0xe32424dc1a9acfb6)},
+    0
+  },
+  {
+    {W(0xfb86769202ce0769), W(0x7e78829b04e1596b), W(0x6b322468b1731fc5),
+     W(0xfcf9e3b1e52ea3ed), W(0xa90f1d58305ce89b), W(0x406f694ccb6a6470)},
+    {W(0x3c1d727869a2f4a7), W(0xa899b325e3304d91), W(0x7e9edb93a5f409ac),
+     W(0x7c033579216b2c5a), W(0xa769fccbc6a62f91), W(0xd4a94ff5a2fee2bb)},
+    0
+  },
+  {
+    {W(0x54d4c375b2984585), W(0x5278a8f2068f02a8), W(0x759b8011cd4afc8a),
+     W(0xc0bad24546b93236), W(0x38d946e084cd9457), W(0xef400267e7c2cf37)},
+    {W(0xdd2314af0ec94750), W(0x475351ff58ded119), W(0x62bd2539b5fde7ef),
+     W(0x357a02b7a0fb2bbd), W(0xf1d5d59d72d422e6), W(0xc1355573f69d5ca8)},
+    0
+  },
+  {
+    {W(0x9900a2c0253db207), W(0x1c32cb44316e03f5), W(0x8c7312b32d4c934a),
+     W(0xec67f14f18304972), W(0x680d1263189ad1e8), W(0xb807f8c56490b148)},
+    {W(0xddaeb4bd251a0644), W(0x24b740484bdb3243), W(0x8659e9764ce41836),
+     W(0x2da805bf43882e30), W(0xe939307a97dacc0b), W(0x9ba3b521da016f67)},
+    0
+  },
+  {
+    {W(0x1155bb024266c035), W(0x4e5b3be8e523754a), W(0x53e44e8ad4d2ceed),
+     W(0xb8a030f95bf9f66c), W(0x9e5c650ee1fa9499), W(0x66e4a12af1b0dd1b)},
+    {W(0x68ad536d0b64babf), W(0x6cf4c8c68dd27318), W(0x5df5b56a678192fe),
+     W(0xea532821f5c55990), W(0x2ba52afbf54612f9), W(0x655ff1b62cb59092)},
+    0
+  },
+  {
+    {W(0x3c1219e67d7071fc), W(0xdcddb659265c022f), W(0xee6c98cf40fcf9e8),
+     W(0x7b36d20a46e42f85), W(0x6a4f6b7fd82ad511), W(0x6a7f9c3f0102566b)},
+    {W(0x00cae79f5c5afe63), W(0xa11f408f7e4f81f9), W(0x227a0db1ab96dad2),
+     W(0x732f7623e6c9ddc9), W(0x5b4da89d45785ed7), W(0xc61c72b9c4af8d2e)},
+    0
+  },
+  {
+    {W(0x603f1c8fca4d3237), W(0xa0a4b58bb5309c03), W(0x184ec5ba2578ec70),
+     W(0x4401d76c39e2e13c), W(0x4167be32ef8d766b), W(0xc55c56cf46a9fac4)},
+    {W(0xcaa3cc499ea31b23), W(0x43393897642b27d6), W(0x983bf6d8df315a33),
+     W(0x781aaea2fa2ef72c), W(0x8323bc62f2ac93f1), W(0x425f68d7f9e044c9)},
+    0
+  },
+  {
+    {W(0x8ee9807cdb3f5a73), W(0x747601d004dcc55e), W(0xc3e1fa4b5830a8db),
+     W(0x6684717c25f1b42d), W(0x728b00eb19a65060), W(0x6527b4eda1d7ad7e)},
+    {W(0x7bc16e41857f3466), W(0x11f2543da63f0013), W(0xa049164c3a53007e),
+     W(0x490dab0311081b91), W(0x6f8d95fb3d4822e5), W(0xf6186cc44870a19d)},
+    0
+  },
+  {
+    {W(0x3613b9389e517eaa), W(0x792e1725f35f45da), W(0x76c4e35daabddaf5),
+     W(0xca5a2a8f5fb94e1a), W(0x33f4b3cee44dfde6), W(0xd48f8ecc4ab1125d)},
+    {W(0x141f782a42dc8c56), W(0x2466ae628c11a681), W(0xff6566218810adf5),
+     W(0x8cc12c05d559cdf0), W(0x07db9e4cee22f73a), W(0x07bf4a5d6e894419)},
+    0
+  },
+  {
+    {W(0x378929d2a3261010), W(0xdabb4911b6ecb0b4), W(0x366a97d068a1debf),
+     W(0xa9e5e644d2c55937), W(0x6a1d099685ba91b2), W(0x16a994a42e972cf0)},
+    {W(0x19770f5b31bd8fbe), W(0x74ae2f9de0381549), W(0x17d197c3451a39cb),
+     W(0x1d5666c917b3c48b), W(0x2f662c855eea9cc4), W(0x3381bc48b7acc2e1)},
+    0
+  },
+  {
+    {W(0x96cd5f916643591f), W(0x7a69c8db5a89a740), W(0x48f65eccd9820e36),
+     W(0xf57bafd0408c06b4), W(0x917e31927fdc460a), W(0x9caacfcffd4d4ce4)},
+    {W(0x37b22541b6f3d57c), W(0xc61cb4ea0aa6791a), W(0x8068cf55861af69f),
+     W(0xb0ba856ada1fab7c), W(0xa9d9ece6686b0f5a), W(0x6218258afc43b1e5)},
+    0
+  },
+  {
+    {W(0xaea7ac0f47682434), W(0x4083d82794c8b23a), W(0xe89eff51067f8faa),
+     W(0x63453293203752fc), W(0x52e3a71220886819), W(0x81bc1bd93acba5b4)},
+    {W(0x61368ee5a12b6944), W(0x409ba95196a98ba1), W(0x52db596f2e7f8661),
+     W(0x27357d580722222d), W(0xad607ee064712dbf), W(0xa135b1c5200bce5a)},
+    0
+  },
+  {
+    {W(0xf4387651ab8ba4fa), W(0xc69223dfbba9f2e5), W(0xaf02fdcf736773e1),
+     W(0xf3dce2f2a5f9a6e5), W(0xb2aa0566c2d44bc1), W(0x28d31bee3924df56)},
+    {W(0x29c4e95cf4d6a5c2), W(0xabcf292833be07c6), W(0xbb0b74d76768f5da),
+     W(0xf1ab154312b79f26), W(0x60473f7ba4d88d00), W(0x095d0477ac9f7ddf)},
+    0
+  },
+  {
+    {W(0x15a4f2d157c54da3), W(0x19756b21f783b0d2), W(0xa8f73ff27faf7332),
+     W(0xe7287a7635d9a6ed), W(0xb3a4dacc5e0ac82e), W(0x7ecf9a85c2fcd164)},
+    {W(0xda3299b67b32d5c6), W(0x740060170045a77e), W(0x99fb2b7fc170e0dd),
+     W(0x7a88117b64d20a6d), W(0xa67285fef7e867ae), W(0xda9731370a8f2ea8)},
+    0
+  },
+  {
+    {W(0x47bbcbadcaecb2e8), W(0x779bb7ca25d11f02), W(0xc9531447ed22d491),
+     W(0x9697697f28835694), W(0xc0a631f53d6d0a5a), W(0x2f6b6d8e5b96dfc2)},
+    {W(0xfd480cf07d22f8f1), W(0x06b7c801ca8841c2), W(0xfc6c694b70a03902),
+     W(0x8e0759be36ca1e6e), W(0x8ddf6e5260f07274), W(0x206f248fd4e04c73)},
+    0
+  },
+  {
+    {W(0xf6541532885cfc59), W(0xd42bdd05930bcca1), W(0x72a6db7351678028),
+     W(0x76fa787f4dcda8d9), W(0x244b432d86bec3c8), W(0x7af28079a558b95d)},
+    {W(0x6c5b13cca19001e5), W(0xdf9a64cd8e34ab2f), W(0xdb6bdc173a00d624),
+     W(0x366a87fb19fe45f9), W(0x716c1394f53a8757), W(0x8eef13332ae68953)},
+    0
+  },
+  {
+    {W(0x422d6c8aa01c046b), W(0x27597bfa086ccc40), W(0x330b6b87804580ad),
+     W(0x416fab1a40078b6f), W(0x4ebe9805915976fb), W(0x54d7350284ccdd1b)},
+    {W(0xb53e8284549e4fe2), W(0x42631969d7efb4be), W(0x5b36ed5bf4c9d327),
+     W(0x3737e5939032ece3), W(0x31d3f50c061ea409), W(0x4c09d09c8815ace1)},
+    0
+  },
+  {
+    {W(0x77e6093ae1d77a14), W(0xa2c8422565b8ff15), W(0x578f5e49e366cb50),
+     W(0x8a93b6d785c243c5), W(0xfd8af123b32b238d), W(0xbcfc50a01bcc1161)},
+    {W(0x0b460407522b3fa8), W(0xae481be03651b31a), W(0x8ba24058417a640a),
+     W(0x2fd36c5541787b0a), W(0xe686867d0d872355), W(0x71ac36db6a87ebc1)},
+    0
+  },
+  {
+    {W(0x04f4a82617619788), W(0x49b6923122730b62), W(0xd30e4c145fbee01d),
+     W(0x76253536affc8dd1), W(0x05da5573611a64bd), W(0x88f37b5929fd7b11)},
+    {W(0xed11cf0ea6c717d7), W(0x7a106cfbbd9daf7b), W(0xf0ad247c61e3f76a),
+     W(0x73df2c502b1baaa3), W(0x67a7d7db4684a6df), W(0x8ad2ac3dc802ea8b)},
+    0
+  },
+  {
+    {W(0x9ca71131cfec0d5a), W(0x0a9287955ea86974), W(0xa88f96cf120be323),
+     W(0x90519bda4a20b148), W(0x8eb88480e7c59526), W(0x8f84a2940f5682ce)},
+    {W(0x80be0a553068cecb), W(0xa93c5daa85a4d8c4), W(0x489992a2c6fbf96e),
+     W(0xb3210b98393351cc), W(0x4b80a9d8e055732a), W(0x148d72325f1cf105)},
+    0
+  },
+  {
+    {W(0x419db0d5ff7ac92d), W(0x3357c6c83619f460), W(0x8d6e72d086653e75),
+     W(0x483f5c3a83805bc9), W(0xd9761a097eaf9297), W(0x2319abfab91fb01a)},
+    {W(0x6dd3bfa358c0b9bc), W(0xccedab824823d523), W(0xf450acf9ab9c78de),
+     W(0xa0fe662737a7be65), W(0x7d3229bb13ba5358), W(0x7232d0a6286e70e7)},
+    0
+  },
+  {
+    {W(0x013b36d0585ad133), W(0x5eaba33486b80457), W(0x2b31a26384c4fc76),
+     W(0xc6d265f20567a165), W(0x5ac02127156f12b3), W(0xc5a3d0b85e114ce6)},
+    {W(0xcf750f0ce7e1a34c), W(0x4cc5e7e03795439d), W(0x651ebbdc988e87a9),
+     W(0x7859b8b017c3f3ee), W(0x3f6aa58da71648f7), W(0x3444538e22ac9cdd)},
+    0
+  },
+  {
+    {W(0xca48f72b9ea5eefa), W(0xc93ce82930db9127), W(0x7ca70db4ebdd5b34),
+     W(0xd19cb8e23f4faaa4), W(0x4d0e3126fd386aa1), W(0xea99aef9e5a226db)},
+    {W(0xbf89bf4bbdd355a9), W(0x6e0f975f612c5e54), W(0x5f5150e519830450),
+     W(0x45dfeca214bed8be), W(0x4ebfa1443c3fe01e), W(0x5ab258b74fb03eff)},
+    0
+  },
+  {
+    {W(0x5443ba99051aa91c), W(0x1ad7207a4d490ee5), W(0x30da4ed11afb50ab),
+     W(0x7643723ab580ac23), W(0xecab48b11bb807cd), W(0x22ee85acc3e6ea4d)},
+    {W(0x463febcb7fd3e0b4), W(0x1f2832c5e0ced796), W(0x4b639d9c522c3f1c),
+     W(0xc7be38726d303723), W(0xf559ec2bcdbea2a1), W(0x6cb368ae76d99fa6)},
+    0
+  },
+  {
+    {W(0xf09acb887a0c59a7), W(0xd89c43ef92923912), W(0x724c4b54692e2af9),
+     W(0x36257a9f73de2ca3), W(0x2d9efde573e76616), W(0x5c412fca9f9ececf)},
+    {W(0x7d39f90288d48b1f), W(0xd06589e3de7b702a), W(0x2a1c7416ec4c9a98),
+     W(0x8806573e0afc2605), W(0x08cb74b72388b571), W(0x8e085b41eb9e9bcc)},
+    0
+  },
+  {
+    {W(0xc99a8e1231207902), W(0x7a059ded66291e14), W(0x97e9b89a2becff99),
+     W(0x6e498d7b2962f0e4), W(0x30c69717c2a4f666), W(0x82240ba5ee9fb85d)},
+    {W(0xf7dc18058117025e), W(0x161b452ae00ef1f4), W(0x145f9529cd4e0ce0),
+     W(0x3411144ba9fdf26a), W(0x742b933fa7c98981), W(0x13c160c5cafc4a15)},
+    0
+  },
+  {
+    {W(0xea662401f7c8f786), W(0x59b8e35e95ffa3e5), W(0xa262f3bf8814daa1),
+     W(0x89ec464845b92c6b), W(0x806ce35d1d5257ed), W(0x2d8c900bd28b846c)},
+    {W(0xaf5bc03a6fc65a6f), W(0x26f77cdd34227358), W(0x99050b77a0e208e3),
+     W(0x1727c79327930466), W(0x608c23ebc7b0287b), W(0xf767fc6e833d6a9f)},
+    0
+  },
+  {
+    {W(0xc2c202e59f292033), W(0x224322916a9827cc), W(0x806057f17744827a),
+     W(0x4f7032dd533bf57d), W(0x6a619a40dd43d69c), W(0x46dfc6309b15d461)},
+    {W(0x44e26c31fbd3b848), W(0x709f636adf5ab13b), W(0x6a1709fe130c2689),
+     W(0xf7928e7bca8cbdc1), W(0xaebbb44b0a5f5b7c), W(0x13294b6151653957)},
+    0
+  },
+  {
+    {W(0xd26c2fa50eabd1d8), W(0xc398769c8af1ee94), W(0xeb75ec1632674983),
+     W(0x3c6e0fd9db8082d2), W(0xcfbe2c8647c55f72), W(0xdd5bd9efd017ff07)},
+    {W(0x40f2e5ded71d19a3), W(0xdc228dac2de86491), W(0xed68f94bab6de358),
+     W(0x4e61764b0316f87f), W(0x7134474447cb48ab), W(0x09baf2931620c6b0)},
+    0
+  },
+  {
+    {W(0x7bd169bc1a33c280), W(0x0d555a553314bf8c), W(0x703c3ae318f4a72b),
+     W(0x9a437ea8d3ce75d5), W(0x79b6cd46815823ae), W(0xff90175907e1452e)},
+    {W(0x14a86ba9df25fb39), W(0x0c8f4c7c60c53325), W(0x7ef7dd293565f031),
+     W(0xa6eb1c8d4dedb256), W(0x1f92c21d2bbfbbc7), W(0xb17e0bc722b28b1e)},
+    0
+  },
+  {
+    {W(0x0979b86428be7c25), W(0x2197afa9f0a24e51), W(0x72e2601e1335136f),
+     W(0x95c07eefe8df91f5), W(0xc466036f89d8feec), W(0xaee987f9b94f1f07)},
+    {W(0xfef60ee27e6ab7d1), W(0x84a937536b5c8b15), W(0xc5b553dd89f17f5e),
+     W(0x68887de3304e6a0f), W(0xe65ea6700e9dc579), W(0x56ebe73a20a90575)},
+    0
+  },
+  {
+    {W(0xb0c84c00a679adaa), W(0x7dd1017d43096eb6), W(0x847e430e071a83bf),
+     W(0xd03df5331ada2a24), W(0x3b9530a477917a6b), W(0xd6bdc9217711048d)},
+    {W(0x1882292cc496f2b8), W(0xaa2bc1c8392f86b3), W(0x7b2a70764a0492c8),
+     W(0x62d2a6060b2db15e), W(0x3c14f419b93e693f), W(0x528ad9e931db8c64)},
+    0
+  },
+  {
+    {W(0x82e79cf58ffe3759), W(0xf82722013729e2ec), W(0x08219a1437df8458),
+     W(0x49ec777863ac05c0), W(0x57b322d13e38b7c4), W(0x93de36af75f0c981)},
+    {W(0xe8cb310c029ef9af), W(0x62f3f362015f2b0f), W(0x4946f16bed3b344a),
+     W(0x67cb18d613c8dea0), W(0x59e2a9a253881078), W(0x71174fb1468da68a)},
+    0
+  },
+  {
+    {W(0x89ce8891cab5eeff), W(0x900e532ddf15ddf4), W(0x2571b429ce1735c2),
+     W(0xd51b066f6a31b027), W(0x6aeb9713fbe485c2), W(0xc8db724106bdae72)},
+    {W(0x3be071eb6e711388), W(0xe045f1003c468d06), W(0x592d8a5c986bcbcb),
+     W(0x4bbc4f805e0f3d8e), W(0xb82ab9566f8a5240), W(0xb55aad2ab7d0af77)},
+    0
+  },
+  {
+    {W(0x54bf287511b92159), W(0xdb4c0f96a38cbc2b), W(0x723d820604032857),
+     W(0x340b77503a3cb08f), W(0xecd400db75033388), W(0xa7e71c2e9b605f9b)},
+    {W(0xce1c7f5fc4c45259), W(0x6f4684011a392ef2), W(0x42366ada525211d5),
+     W(0xa92e4031d4f4e163), W(0xdca54c1a34e20fa2), W(0x14c87ec1bd18e905)},
+    0
+  },
+  {
+    {W(0xb7c8dd2b4a3ff23d), W(0xd49387f68e22a2e0), W(0x0ba2b763e5695d34),
+     W(0x27631c73185ddeb8), W(0xaf065ffa4d9fc71b), W(0x8efcf91922852d97)},
+    {W(0xf0c3d1327eb48bc2), W(0x0dd7ca6c4affc1c4), W(0xfcd192bebf9fcd7f),
+     W(0x51d44be99151237e), W(0xce5b0a05c88dfbf0), W(0x0ff37d8d35a9df94)},
+    0
+  },
+  {
+    {W(0x1905767f0c60125c), W(0xd11b647e9c1b56f2), W(0x69027ed6c93926b3),
+     W(0x0a23520eee4e66be), W(0xc39de3a4c9dc138c), W(0xbfef455f1dc38e66)},
+    {W(0xfc8b76023810af11), W(0x08e5647396a4c138), W(0x5e3ee5e182f1b4fb),
+     W(0x434fa604605705fd), W(0x8b20a4ac8da8630d), W(0xf551ba407773029b)},
+    0
+  },
+  {
+    {W(0xa0ff5db3d6c5e538), W(0xcb6200bab8f8fd2c), W(0xf8a0efff8eececd8),
+     W(0xbda8ae6a04dc1dc0), W(0x3082fab6c22ed871), W(0xf05d97f9de30d2ec)},
+    {W(0x50efd5fd57adbe72), W(0x69b11efd5dd21350), W(0xa8cd158044fc749c),
+     W(0xe3d4703f0f27d425), W(0xbba56a2d8c23c342), W(0x63d4dfb9b38831e3)},
+    0
+  },
+  {
+    {W(0xd85033f59c846770), W(0xdbf2fd53900a781d), W(0xff64d90f9bc5258e),
+     W(0x96c6857440fe68ee), W(0x331793f403a77e17), W(0x02cd965f1f477fe1)},
+    {W(0xd7a7e0164efe6c59), W(0x6e066fb0b97f7b6d), W(0x0d0020d8af2fe266),
+     W(0x951bbf95975b3df1), W(0xb298b67538f30631), W(0x761d3280d3fd753f)},
+    0
+  },
+  {
+    {W(0xa12c9a54a1e14851), W(0x0a4cd821cc2fea50), W(0xe9467e19a7b9c35c),
+     W(0x350be5ba56ffee09), W(0x947b1383347881b5), W(0xef479e95555f460c)},
+    {W(0x6245d26b6fa57fce), W(0x409aaf52fa906f6d), W(0x2f8c6f1094408050),
+     W(0x41b9508b58f54c66), W(0x9545b08ae22987a1), W(0x5a341bd057439e0c)},
+    0
+  },
+  {
+    {W(0x5a7bbb013c091983), W(0x044f8de890f04e8f), W(0x25414be1320a4751),
+     W(0x4cdb0d5ac3a69a50), W(0xa76566b0a27901d2), W(0x1412d892d0e306fd)},
+    {W(0x70e0d4fbdb2ccdaa), W(0x46a11ee1de2f0d01), W(0xc8eda2e1e09d3531),
+     W(0x89bbf6b4d2177d5c), W(0xc94d54aeb95696d6), W(0x5dc7b0d65a97e071)},
+    0
+  },
+  {
+    {W(0xf47b9082b4b47e4a), W(0x936d018bacdead1b), W(0xcf871ecf01026b67),
+     W(0x9ff04ef44fa72648), W(0x6968aad026b79ced), W(0x5d4402e703d5b9a4)},
+    {W(0x45c71a5facb8a932), W(0x6defa43f50ba295d), W(0x437589f282149f90),
+     W(0xf7c226334a236116), W(0xf16de4ba6e50935b), W(0xd4c17f198339733d)},
+    0
+  },
+  {
+    {W(0x72a171a3c3facf0b), W(0x870a4c5cb0602ffe), W(0x7b546d9c609590e4),
+     W(0xd5a8df433c7d51ce), W(0x9cd861a8ab061f46), W(0x0b3f013883e4ad74)},
+    {W(0x77a9a547ad75f87a), W(0x4180e2be0b9ac8ea), W(0x7f80bf4a9ed38c58),
+     W(0x2654e1f9a4136361), W(0x8d70d4cdb9fe80ce), W(0x24930f15e11306c5)},
+    0
+  },
+  {
+    {W(0x897ef637e74bd9fa), W(0x5d0b68fe1bbe51e1), W(0xf6ac23e1d40d84d4),
+     W(0x9dbe50af3d8b39af), W(0xfb3ceabb611406ef), W(0xd3afb824b3cfd506)},
+    {W(0x691801503bf779f0), W(0x8d812be8721a7df5), W(0x97005b507d8fea81),
+     W(0x5234b8937fb6c82e), W(0xa8daa3d53d388110), W(0x9414d597cb79901a)},
+    0
+  },
+  {
+    {W(0x0365262ebbfba2c6), W(0xa2313b4a172f0eb6), W(0x0a31712c79d08813),
+     W(0x0aeab5421fde891d), W(0xbd4f6ca002e62f21), W(0x35cf64bb6b9bf204)},
+    {W(0xbcd81e623ef1825e), W(0xd7ef0f26adbcd37b), W(0x63270c88538657ec),
+     W(0x8569c6fc18f0c76d), W(0xbfacf921d1122333), W(0xd4806453641323a7)},
+    0
+  },
+  {
+    {W(0x1cf55971ef840d61), W(0x526fd9a418bed7fc), W(0x6af81dc997fc6678),
+     W(0x46d6c45da039f25f), W(0x911fe2061e3a13d6), W(0x48a85cf8ffaa04f4)},
+    {W(0x0cb71be6e18eefd3), W(0xe9ac1ad7ace7a9ed), W(0xea92931f01c1daba),
+     W(0x9164dca51365009b), W(0x0cde9be561dbe100), W(0x6b56c3e4c1ead841)},
+    0
+  },
+  {
+    {W(0x4ee4f97bcac0b7bb), W(0x66ce461c0d218466), W(0x63834dbce33711c5),
+     W(0x274498667dfa83d5), W(0x809e79ce152667e3), W(0x6f7b4a8b6e96fc7b)},
+    {W(0x1d0be5dcb4ff6fb7), W(0x567f7986716bbeb2), W(0xd7ad80fe3ecc76ea),
+     W(0x741baca3b07daff0), W(0x1c14ed6ea701a41c), W(0xb7126de7ef394b52)},
+    0
+  },
+  {
+    {W(0xd15bcffcfb8e2ec3), W(0x3bc6798bceca88a4), W(0xe6c39ccfd540593a),
+     W(0x1bb56675eb730171), W(0xdcd05a080969f9b8), W(0xf5d4af25fd0bb35d)},
+    {W(0xbdfeee95a3eda6b8), W(0xc9e150ddfa22690e), W(0x8d35ccc80012d25e),
+     W(0x17311dbf2cb5e88b), W(0x79c45ea2b8ef9d60), W(0x22b699e87906bf50)},
+    0
+  },
+  {
+    {W(0xd0b5ffa5c8cb5247), W(0x02b28039ed2454e7), W(0x3ad3e15c9cecc11a),
+     W(0xc5a8825b107296f1), W(0xa10a55d673848dba), W(0xeb805ce4760f8746)},
+    {W(0xde46ad3e6a3568b7), W(0xee309fe100154a73), W(0x1b784cbe857918fe),
+     W(0x77cda6bfddbec6cf), W(0x12498ba32b263d46), W(0x35b23e7074aafe3a)},
+    0
+  },
+  {
+    {W(0xfa443655193135db), W(0x6440965d9f4145b2), W(0x9381a85cec6be081),
+     W(0x99dff22549cba7ce), W(0xb3b07dee3db51daf), W(0x972aff3ef8f46cb6)},
+    {W(0x1d4a70e426d20442), W(0x4059fc66e599d6f0), W(0x0d42b0cc36cebb22),
+     W(0x82f181d63bb10971), W(0xe872f0e3eeec9849), W(0x93aa374b6d6087fb)},
+    0
+  },
+  {
+    {W(0x9dc5252a37121749), W(0x00948237ec2326c2), W(0xad9da3dc76865edc),
+     W(0x8913b45fe73d9cd3), W(0x6678155ca359232d), W(0x3e5a3f8b738723df)},
+    {W(0x6c5da2850bb7e05a), W(0xda6c604495301998), W(0xc73687d90c62c4f3),
+     W(0x121e64ea3bc6b901), W(0xe43a3e1e80f9c02d), W(0xf3467b70da695280)},
+    0
+  },
+  {
+    {W(0xb4f5408a0a0e4343), W(0xc90b37f77826fef4), W(0xe60f9f176e19fb04),
+     W(0x4211e2bb99a670e9), W(0xd97f7ab7d22947a3), W(0x4512e652994bd820)},
+    {W(0xf27916a559af75f5), W(0xcd6bc6e02fe35431), W(0xaaff5ec60ec722b5),
+     W(0x7c1feed5216af9ce), W(0xf94e37accaf5dc5c), W(0x51b1101d445d053e)},
+    0
+  },
+  {
+    {W(0xcb3744a014c40e35), W(0x9a9b860322757b72), W(0x06a215234134e14a),
+     W(0xccca8e13660ddd96), W(0x53b73659bffb34cd), W(0x0cebf25cd84c1bee)},
+    {W(0x5b638484c94bea03), W(0x886bfe41534926e2), W(0x3823199f30546244),
+     W(0x3721cd9aed8d25fb), W(0x0a45718c8595c7dd), W(0x680e4975d20b8709)},
+    0
+  },
+  {
+    {W(0x5d4438dc32467a8d), W(0xe77d22f643270d55), W(0xbbb6be5c57bf047a),
+     W(0x191916a08275ca21), W(0xf60855097e8bab64), W(0x2776a5fc9f135876)},
+    {W(0xcdcf5e50a87c6c1e), W(0x4d96df83218f79ed), W(0x21dbc544566010cc),
+     W(0x2d160f129fda41f0), W(0x7c67daa09d2e1805), W(0x1e6f684030b605b4)},
+    0
+  },
+  {
+    {W(0xa351ac34381642b1), W(0x837365ca4540b2b9), W(0x7770ffe9c3944e11),
+     W(0xb652223adddf90ec), W(0xcbd3cf46fd153a39), W(0xddc461e76b6559ce)},
+    {W(0xea934bbaf1c54eaf), W(0xf24fe50157a7efd4), W(0x11d9679782433e41),
+     W(0x41a32ab240fb0296), W(0x409cf3c280214a84), W(0x025a96b0529097cb)},
+    0
+  },
+  {
+    {W(0xb816e1d97aeedc4e), W(0xf48262ec83b6f80e), W(0x55355d401c7399dd),
+     W(0x67714a023f391112), W(0xfaf8f4e6498e353b), W(0x2fa465371f88fbed)},
+    {W(0xb28cf611a3e2245d), W(0xa336142c625c51de), W(0x074a3e3fbd9fad3d),
+     W(0x9b192d3577467285), W(0x1abd81249ec2e9fd), W(0x420a49972a540ae9)},
+    0
+  },
+  {
+    {W(0xade3401201aabfbb), W(0x5caae0f7e4df8b2b), W(0x1025c76dfa747132),
+     W(0x61771b20ca9a51f7), W(0x1648a0ffc632951b), W(0x2bd9393298955d7f)},
+    {W(0x540e6bdb93891107), W(0x845b6c0bdd8f1f43), W(0xacd4dc58aa8dddcf),
+     W(0xa97b0674154673fc), W(0x5c2691ad607fdc60), W(0xb1afeb572d74ed32)},
+    0
+  },
+  {
+    {W(0x8cd39053b3f1d0b0), W(0x04fe643808e5f3f8), W(0xb2cf4c4f74a7e31c),
+     W(0x64c29f0e5b90edc3), W(0xedfdcbacb6e7cc7e), W(0xcbeebdeec4ec9ac4)},
+    {W(0xc99aff97616a9600), W(0x5371488ea13e9e4c), W(0xf68f1db89e233088),
+     W(0xf18cc7a42ddcf4d3), W(0xdd4c1a775c48a06e), W(0x08b61c15dc1dcaed)},
+    0
+  },
+  {
+    {W(0x9a5b9bcd11f1ee18), W(0xbcedcdd1e580afd1), W(0xafb9c4f22a3c3e75),
+     W(0xde7e712443d8e30a), W(0x8f2ab879cd5b387f), W(0xe3149b6974be11f3)},
+    {W(0x107f5f4d60b37485), W(0xe2949aa7e5e9c853), W(0x2cfe4017a5277356),
+     W(0x5b5468552c7ceb6b), W(0x902ad6e75285d4b6), W(0xa69a78641fa6ae75)},
+    0
+  },
+  {
+    {W(0x29b1b05b68eb4163), W(0x4e9609da89dba7c2), W(0xb905161509dc995d),
+     W(0x59f32f0238bc3719), W(0x5c8649d0a1dd224a), W(0xb5d833d8fb45e38b)},
+    {W(0x1ab2990af0dbd231), W(0x453c90bcc7b49f7e), W(0xcef032e075946e20),
+     W(0xadbfc9f4acf0bf92), W(0x84cb13dcb241399f), W(0xc50755cb42995147)},
+    0
+  },
+  {
+    {W(0x356c19e8104069eb), W(0xd273a63fdb02457c), W(0xc8ea3176a9e7ba90),
+     W(0xc2cfd4245108a6d8), W(0x123ff686583ab247), W(0xbcc9b2f6e4d92101)},
+    {W(0x623d9ebb53758bb5), W(0x4a2e76f441a6af0f), W(0xfe5384d540f81839),
+     W(0x16ad0246de1eb79c), W(0x36bda12fd6839270), W(0x7c2ff93751850ac5)},
+    0
+  },
+  {
+    {W(0xcd26dfa1be340386), W(0x0cf43b2e522207ec), W(0x34b2201404635f27),
+     W(0x3e857c177578b414), W(0xe0fa9b2171fd1638), W(0x0a2b8a32accafa9d)},
+    {W(0x730fb8429757b31f), W(0x9f4eddd3e8d248de), W(0xff7811c2a68077f2),
+     W(0x49bfec66d88251d5), W(0xac68882adf884464), W(0x9bf23e8316df807a)},
+    0
+  },
+  {
+    {W(0xa562845a18e082ed), W(0x8e9d9b5061e8941b), W(0xbe63714d770f601b),
+     W(0x927074ae114dde1b), W(0x2fa46e0e469ffb24), W(0x0fcb4f9b078a56bb)},
+    {W(0x863efb01395d5086), W(0x2257f694c405df75), W(0x6dea200348e13e52),
+     W(0x86c5b753f6b1b9eb), W(0xc8da8b40debd7d35), W(0x5ec7eb24d2157001)},
+    0
+  },
+  {
+    {W(0x0b8b22fd6aece32c), W(0x4fcc34be80f9abd4), W(0x9ff6a606daa38e3b),
+     W(0x7becd27c1daf4957), W(0x0982ca6dcb964fcd), W(0xbeb0875d6c2c0a6c)},
+    {W(0x71d8064238460197), W(0x4d3ee2a1b1e39080), W(0x284a824857c537a2),
+     W(0x32b1e7dc807f8234), W(0xdd99526c747afe8b), W(0x1aa20f5c9b1beaea)},
+    0
+  },
+  {
+    {W(0x97af3f9bda5872bb), W(0x2d9f03020f3ad27e), W(0x2ef62a89d72a4584),
+     W(0xee6a356e57067b63), W(0x960d7bde9923085b), W(0x53fa585438384323)},
+    {W(0x728a32d8eca3bad5), W(0x02b1b6d2a919d5f5), W(0xce4c17fad924f5d7),
+     W(0xd49b032afeb5bf51), W(0x1f55abce34ca7452), W(0x5b8fd88d07906ec3)},
+    0
+  },
+  {
+    {W(0x99ef5c0229e6cf50), W(0xaa1dec0c19c44137), W(0x0cf39495e108beb6),
+     W(0x7b98c66ff92b2622), W(0x07a6d2d15929d576), W(0x505384948b8e7607)},
+    {W(0x67c5798465d705b4), W(0x39e5f58baef77969), W(0x66431e7c79eac077),
+     W(0xede5b6edbd9f39a6), W(0xacd544e0598cb818), W(0x292b61a3c251cb4b)},
+    0
+  },
+  {
+    {W(0x72a75761d7ecc663), W(0xb313e56170673657), W(0x7d5baf24d95679af),
+     W(0x3305043f57c97a2d), W(0x0e3d4b2d98e3383c), W(0xc0d8cf18b6b134ec)},
+    {W(0x69480fc6f269dc24), W(0x246396be68a55fa8), W(0x1637d0db0c9edd82),
+     W(0x16f9318af24b37d6), W(0xb7d3505ad4ce19d0), W(0xede4528de76a6788)},
+    0
+  },
+  {
+    {W(0x32795dc77ee4a89c), W(0x09618ebea32ba356), W(0x28cc02a3d3699842),
+     W(0xfb835c713e786f79), W(0xc618786de80d1438), W(0x7eb4276000b5909c)},
+    {W(0x46f75d29a20f6f3c), W(0x1734ab26c9bfac7e), W(0x6f6249f5ca4f0910),
+     W(0x7019f86f60015da9), W(0x2e8adcef28995d67), W(0x98b245626ceb2f4f)},
+    0
+  },
+  {
+    {W(0xe3cb8f39ee2366a8), W(0xbac1377402805ad2), W(0xa93af8bab413bf35),
+     W(0x5d939765064c0d00), W(0xd6c594cf29c14c53), W(0x33bbcd276dc9d4e9)},
+    {W(0x0c96150584dac0b5), W(0xb3a611a81865e289), W(0x0a7c04e2e675daad),
+     W(0x9fc70c2866ab881c), W(0x669bb2cae370659a), W(0xcdf96a64d683f7e1)},
+    0
+  },
+  {
+    {W(0xf1b833a6017efc7c), W(0x41e1ccd23cdb2ad8), W(0x649e121f80874d84),
+     W(0xdb26f7447335d606), W(0x47b86e261dd34054), W(0x733129cf26a7bfc5)},
+    {W(0x69d2a3a86937cab1), W(0x774b843d4a8cb29a), W(0x9a14005fae641bc2),
+     W(0x18d3fba27655d114), W(0x1b4d54eabd832ada), W(0xf5dfaa73b87f3279)},
+    0
+  },
+  {
+    {W(0x2b01c4f960fb63f2), W(0x6be6f60041a49a27), W(0xff7a9693f54749a4),
+     W(0xa414e31811aad466), W(0xdb3e607c06269ca5), W(0x5df1f048e8bb47e7)},
+    {W(0x58c50ae8c37753d5), W(0x8d504fd3f130081a), W(0xe739621fb8a07002),
+     W(0xd0bd8b411576d653), W(0x34131d0a8bf30175), W(0xafc111d4ccb2bf15)},
+    0
+  },
+  {
+    {W(0xa8c63ff4e7a7c03b), W(0x73794ead1bd7fb37), W(0x243cfe5d75dc6ac5),
+     W(0x4de3fc23a762ae1b), W(0xf76cc8a8cf8b3d55), W(0x9e895b9963884db5)},
+    {W(0x3a17569a81507b0b), W(0xe04b334ad774f399), W(0xd78b67e38aadc560),
+     W(0xd5ffd09a108bf03f), W(0xeeddad1411d90abf), W(0x0c40e058839980a7)},
+    0
+  },
+  {
+    {W(0x4e7c30d736568fee), W(0x9cd65b25329092ac), W(0xe6a72e9451b1b9f8),
+     W(0x36ac6800444d3b98), W(0x639fdea4dc0bf381), W(0xc4d73e2f3b4977b5)},
+    {W(0x3973261c2810dca3), W(0x509852ca7232d65d), W(0xd25524967dd43eb0),
+     W(0x28d34c0d6b98d0fc), W(0x640ba7f82ef6117a), W(0xe250ff6c9f6d7783)},
+    0
+  },
+  {
+    {W(0x7a2169703a44ddf9), W(0xa448c951e8c252c1), W(0x0b78604d89b42a56),
+     W(0x1770fcf59cad5f05), W(0x213a0c0b75ce4b93), W(0x8b66a05d3133e6e7)},
+    {W(0x685d3903ecbd8df8), W(0x8d13752d7c40f617), W(0xe1c59b8f0e1f0a5a),
+     W(0x9619aceebb0d2a22), W(0x30bb8b4c080ca485), W(0x72f97f35360a6aa2)},
+    0
+  },
+  {
+    {W(0x22e9a46a7f85635c), W(0x48ee4a03ec12844f), W(0x0893c7ec8fe959d0),
+     W(0xc5e1e78dec176d2a), W(0x23a326b4b439914d), W(0x7c5d8be7bcd8231a)},
+    {W(0x13529332de0d275b), W(0x3d8f1e06f9660cee), W(0xe094c916d023c7fc),
+     W(0xc261fe4f3b1408a8), W(0xc3cb2253b267968a), W(0x6c06acdf283e2c5b)},
+    0
+  },
+  {
+    {W(0x08e34a899aa09169), W(0x76b080344798dad0), W(0x99b2cc2b3311f6b6),
+     W(0xc07ac5834cf64e6e), W(0xb9d99c416f3c174f), W(0x8d0adb097c872d10)},
+    {W(0x23d09c0f87ab625b), W(0x90e1d4dff624e630), W(0x6f911eba50628f3c),
+     W(0x3cc60e21d5b1e5e6), W(0x7d45737c4d5a3fba), W(0xbc1bc65fc7c8a7f7)},
+    0
+  },
+  {
+    {W(0xe12754a64a873405), W(0x7af675114c694cbc), W(0xb7adf26ee04152c9),
+     W(0xe995076ae7044472), W(0xca9175e00084dcfe), W(0x30eb0104e7d3ed23)},
+    {W(0xefb4f26e5e790fe5), W(0x4de851a09338b2c1), W(0xc844862e9a3d2802),
+     W(0x2f59313061bae7d0), W(0xbb0ee261cf5f0bb2), W(0x1a398985f6e83cef)},
+    0
+  },
+  {
+    {W(0x48824d3d660af6f9), W(0x2551aedeb92fe793), W(0x2585058f7774c2e8),
+     W(0x4f8481a35ea6c179), W(0xda90e27a981bcc99), W(0xc5692422c7b76d85)},
+    {W(0x5c82f954cb2a3494), W(0x7319450aab618efb), W(0x23160a00796086cb),
+     W(0xcad5af57122d111f), W(0x3ed733d6d5542e7d), W(0xb8ac9023db295ff8)},
+    0
+  },
+  {
+    {W(0xeb6a431b88c4103d), W(0x4b96dc623eb058d9), W(0x6589e6754e0a9a90),
+     W(0xcac9359a0b6d537d), W(0xa44e550e63d47eed), W(0x329e0d892f7ff023)},
+    {W(0xcd29de287e3ac33b), W(0x83e56411f93d13ef), W(0xd1637b311135a3f7),
+     W(0x12d208d57d621260), W(0x08c416a5b6226fa0), W(0xd7901a1f17765523)},
+    0
+  },
+  {
+    {W(0x3b16fa4ba2513c01), W(0xed4759649d412d45), W(0x8c9f99b11c820bcc),
+     W(0x81e06ae623d06197), W(0x8353e707a6fc9ade), W(0x2530ebae4eef084f)},
+    {W(0xbb29db7d1beb6c4c), W(0xeb753607d748e7f1), W(0x6963422a7ad35a6f),
+     W(0x23e471436f668e8e), W(0x4d9efedbd465f23e), W(0x003f07c2ea5db46d)},
+    0
+  },
+  {
+    {W(0x0c7307b84af6d23f), W(0x8f4a5ae198d82af0), W(0x3a82f15a112be5c3),
+     W(0x45253eb33738e716), W(0x707cf9104950dfee), W(0x1b06173d356b3275)},
+    {W(0x238fecedeca5f766), W(0xa9eb2866339f0506), W(0x86ea562dfc8225d9),
+     W(0x7974f0ec690b0b89), W(0xd8f2da1603ad5c38), W(0xc84e135f97ae5f31)},
+    0
+  },
+  {
+    {W(0xab342c67f20cd545), W(0x5fe9bedef0dca471), W(0x8888b3a5fea7838f),
+     W(0x561bfd5879e51e00), W(0xb91b346cdc8fb6f5), W(0xda53a6ae33f9795c)},
+    {W(0x3ebba074f4c703b0), W(0x4396ccb680a32d2a), W(0x25aea71cea2614e0),
+     W(0x50037cdb23ae0d12), W(0x42ba09eb903d1760), W(0x33b8ed286807f0ed)},
+    0
+  },
+  {
+    {W(0xd16a72fe96f1f5a5), W(0x5bf1a0f60ce6129c), W(0xe858ea52ce808115),
+     W(0x246ecdc0945e0198), W(0x1c8d3bfe48620786), W(0x9e0b7aab6eaba9b0)},
+    {W(0xa45c170a04c5002f), W(0xc8fef491173998d7), W(0x83c075b67d548911),
+     W(0xab4f60ae8e4bd1a1), W(0xb406e582d488a83e), W(0xc58284fea25f18be)},
+    0
+  },
+  {
+    {W(0x3e9767e5d446686b), W(0xf85efed7f173a315), W(0x62d9d1f8037b07d1),
+     W(0xd993c6ff80589aa9), W(0x6dcb21ac4b8dd0d0), W(0xc4e35f606916c6b2)},
+    {W(0xba216d8cc30ec45d), W(0xd4f43a19999fc1b9), W(0xd11e866cf3ea0a33),
+     W(0xcc1dbfe389c5ca5c), W(0x9d63d9754c40701b), W(0x30c5f2b0d6df413a)},
+    0
+  },
+  {
+    {W(0xb38720f51da33216), W(0x2339d412e3e284fb), W(0xf72741e7dbe1913d),
+     W(0xd0862c30ff053a38), W(0x2d04ef417dfec4f0), W(0xf5156915ca022872)},
+    {W(0x5c9608b56600a057), W(0x289b8172e2f2bf5c), W(0x881a963da7fd2c39),
+     W(0xac560a3d3f904bf0), W(0xdc13a0a22ffd7a8e), W(0xbe11555c166bae38)},
+    0
+  },
+  {
+    {W(0xd2ec3a301141dc74), W(0x58224e335bf310d2), W(0x5015a14fe3f52f2c),
+     W(0x3f9ffd959ebde5f2), W(0xc5746dbb61f4a043), W(0xd7673521c5721c7f)},
+    {W(0xf88b7f19e2c43153), W(0x8cc5e1f7beb209f5), W(0x7ae5b094a5133da5),
+     W(0x65566b94f4a08c05), W(0x555312a4474c9f16), W(0x04f87fea4f2d4972)},
+    0
+  },
+  {
+    {W(0x65f59adc7316e6c4), W(0x7f26252a62ba853e), W(0x8024e7def0b2fb17),
+     W(0xcb18630ea9bf475f), W(0xc4b5d117adfaf3e0), W(0xcbd9c5202fc17dc7)},
+    {W(0xaaee01fa3bb279cd), W(0x7a3754355f1302e1), W(0x31c2debd769fbf94),
+     W(0x563428c0a905c24d), W(0x6d7c712749d067cc), W(0xf8aedeaba7a09873)},
+    0
+  },
+  {
+    {W(0x54816428d91cbef0), W(0x07075d717b15359c), W(0x61666ddce0aa36ad),
+     W(0xb8143b0bb587cf38), W(0x4e9571269fd35a3a), W(0x69659ac47e9bf62e)},
+    {W(0x054285a063e1c7d3), W(0x5b99b06ba6ad7d45), W(0x3437b00aa1fae6cb),
+     W(0x28a8b0331eb38339), W(0x0af4c066832490bd), W(0x15f5f71965b5c245)},
+    0
+  },
+  {
+    {W(0xc53b8a129b8012ea), W(0xd57983124d1803e2), W(0x61dbb3230be0d3a5),
+     W(0xb58022579b6f740b), W(0xccbc165fb8738ac9), W(0x7c4d47b76147e1dd)},
+    {W(0xeee17ab42911c9bd), W(0xb6c7801dca93b784), W(0x69923fdde305056f),
+     W(0xdd491bd6f5234cfc), W(0x65a2017e6cac4c30), W(0xbeab555c3c3d69cc)},
+    0
+  },
+  {
+    {W(0x6d50e8c9881f05c7), W(0x8896ac644a9d09f7), W(0xd85c706d00174913),
+     W(0xc4a41abfa03c0991), W(0x338c9eff98b1956a), W(0x052a5e3410a20fb2)},
+    {W(0xa1075c6b679bf7ef), W(0x95a9854619094384), W(0xd5ae2cadea078864),
+     W(0x48cef3879bb84dc1), W(0xc4bfaa3bc000e947), W(0x6e78574a76186c5a)},
+    0
+  },
+  {
+    {W(0x6ad9f072185be2d8), W(0x2d8643eca80c0574), W(0xbf02ab7e43c69546),
+     W(0xbb9da34196f09f8e), W(0x54968aa48d5e8e9d), W(0x9ac474faf81a6ef1)},
+    {W(0x6ca4b96976d93bd7), W(0x33e31e1fb9427aa8), W(0x145d39450ae69ae4),
+     W(0xcc2d878a25cdca17), W(0x7868435734d77011), W(0x61879b9140d4a497)},
+    0
+  },
+  {
+    {W(0x554d7d5008024f32), W(0xd181b43b46c5feb4), W(0x75087c8527889ee4),
+     W(0xe4be48bf12fc670d), W(0xe092572317eddc14), W(0x00a5f8c121ffad9f)},
+    {W(0x5539eaf961b3aca4), W(0x4b903329a690e06d), W(0x7cdffb06f1efabd6),
+     W(0xae75c3c28c69c99a), W(0xaaa958cbff918a8d), W(0xcabcb8f02cec7e3c)},
+    0
+  },
+  {
+    {W(0x3705b7612871c512), W(0x4f7687fd4a6d6271), W(0x3c168896486c6c28),
+     W(0xdd7f545044eac297), W(0xba78cf40a2714150), W(0x2c0248607f4b6a40)},
+    {W(0x3b4799e8a08601da), W(0x667fd439ebb6860e), W(0x64607cbf12eed56f),
+     W(0x1574ef04383e27fe), W(0x752c5c60b1200daa), W(0xb8214600ca98922d)},
+    0
+  },
+  {
+    {W(0x230886757d20adb4), W(0xe5a29203b57d38cf), W(0x376ded16c017893c),
+     W(0x3e4207058dcdf3f5), W(0xaac61a8361b6b31e), W(0xe9a624ba42277f55)},
+    {W(0xf730cd55aa765d25), W(0x8d9637ee4db792de), W(0x50e7818268afd7ae),
+     W(0x7f79eaac2b39b7b5), W(0x167b71e915d3a0bc), W(0x55a97edbba740420)},
+    0
+  },
+  {
+    {W(0x73624b89bd7c6082), W(0x1910c0f69a7814fb), W(0xa48ba95fef675b1e),
+     W(0xa7466074ce5b4bd7), W(0x3b645ff68bd3d8fa), W(0x3d1bc5fbbfb3c3fd)},
+    {W(0x01cd436eecfea40a), W(0xab12f07ec3db79b7), W(0xd1fbc8dd9f644762),
+     W(0xf8fdf8310a933fc6), W(0x6b479854b92f0a97), W(0x12d6225e860778ea)},
+    0
+  },
+  {
+    {W(0xb2b5bff059622014), W(0x9a132a6eea8da811), W(0xc995ef9c14002992),
+     W(0x120e09e527dbf40b), W(0xa0252746cee7ce05), W(0xb3f5c8253692a6de)},
+    {W(0xc7a5dd2629845e7a), W(0x9e66582f2f4d83af), W(0x2705d260b81de47f),
+     W(0x61a9ca40fd726224), W(0x4a5974b415e870e3), W(0x34c7f6c8a9271c15)},
+    0
+  },
+  {
+    {W(0xa15a956cb0d7b618), W(0xc80e48ec72384d74), W(0x88dc3a2b4c9565a9),
+     W(0xdf2dc37aebabddbd), W(0x72986ff9872f85a3), W(0xb5d3372780225d3d)},
+    {W(0x55941ab31feb1e3d), W(0x57db225c0ff6d920), W(0xa2ebc141bad5553a),
+     W(0xb04770fa14ab011f), W(0x0c8e4f65fa25d94f), W(0x4a765adf7aa64b74)},
+    0
+  },
+  {
+    {W(0x151af91f17e5c341), W(0xab0d3034ab9ded36), W(0xc6b6a1233775df81),
+     W(0xb7c991fe38b878d0), W(0x0e4dacfaa368beb7), W(0x2139b315511eb652)},
+    {W(0x53c333e45d9b3ca3), W(0x4f66ffba3ba91152), W(0xd75efd3483f90158),
+     W(0x64de08151cdc8c67), W(0x07398e4f887d329f), W(0x83ac8bbc80045f86)},
+    0
+  },
+  {
+    {W(0x7c12110ed6b5e2f7), W(0x9c0a000af35969ef), W(0x68949f99b2d38443),
+     W(0xcc1f66665e38c484), W(0x86c9cfbaddfd1c84), W(0x4f8ac97ad53ec5f5)},
+    {W(0x01d8ebc7626cec40), W(0x7566becee3b05f3f), W(0x0a02e28fa943a53b),
+     W(0xd1399b9b8bf0d2a6), W(0x66f74349c333215d), W(0x08383f1a4b1d6f3d)},
+    0
+  },
+  {
+    {W(0x0ec17b6020651079), W(0x8e951106fad56a06), W(0x49dc6e6ec4ae7023),
+     W(0xff8ab57397e09879), W(0x3c23ea01e9dd35c3), W(0xfc89ef3cd40b3cf9)},
+    {W(0xcadc595434709e71), W(0xe339a26b74d56bba), W(0x6766e6637023b8d9),
+     W(0x81845f39329f419e), W(0x5aa80bc63ceebc0f), W(0xef3d655a6d7acb19)},
+    0
+  },
+  {
+    {W(0xf47d9cd1962f6952), W(0xaccc9cb247369316), W(0xaa39bceb54049109),
+     W(0xbe87f64ef0d4ab81), W(0x1d18a660b9f9122e), W(0xeb40d5708b3d42aa)},
+    {W(0x6af83298c93c8e63), W(0x6ebf5ee45a1902be), W(0x2488b265e09a28c5),
+     W(0x88ad97a4d8492195), W(0x06e8d760ac2320d4), W(0xaf04f1a96eb26e24)},
+    0
+  },
+  {
+    {W(0x29f887048a92876c), W(0xc6956a2482662a8f), W(0x1230139108fc0523),
+     W(0xb065b548847d7e44), W(0x8b755f0a56b9521e), W(0xb79f3682834ce61f)},
+    {W(0x40b76342e315f3a2), W(0x052247efc55035f9), W(0x043b03410ec4e2de),
+     W(0x25ea0f7a34b9cdf5), W(0x4ceac91610ef30f7), W(0xcba7b02d186a47da)},
+    0
+  },
+  {
+    {W(0x24cbd63fcc3ff8ef), W(0xca88caf911f979dd), W(0x35051be8b6971a91),
+     W(0x432572d6b3a3eff7), W(0xf77b2d46b775a7de), W(0xcee87ab24935e669)},
+    {W(0x4df05de7c910ab07), W(0x27f7d933f44c90be), W(0xe04ef941f58fb1d4),
+     W(0xf1a995908b4e9951), W(0xfdbee5abf2709547), W(0x43d44a467ef91f4d)},
+    0
+  },
+  {
+    {W(0x5d3bf81428c36259), W(0xf6a3f5c497c69612), W(0x22f7261dbd915bf2),
+     W(0xc8cc59bd9281d9fd), W(0x16c94eb9b1cec531), W(0x106daed8414b773a)},
+    {W(0x2a3ce6082e16a463), W(0xb0ab74d128787965), W(0x01ab77429bf908a5),
+     W(0x4985bc1d92171239), W(0x43d2e176282063c0), W(0x4d57667c84583f0f)},
+    0
+  },
+  {
+    {W(0xdff11563111a41ad), W(0xe3ec293bd49096e4), W(0x2439c31b66b89b6f),
+     W(0xf7ad0f41a1dddf10), W(0xf6f30a7f999f6bb6), W(0x9bd9bb4231b20967)},
+    {W(0xe9f6ba4c1d144c25), W(0x7139e1c9854eae50), W(0xf50be870292c96f2),
+     W(0xf396d245737f1a8f), W(0x3d54abe679fb1023), W(0x9791d935523eafa5)},
+    0
+  },
+  {
+    {W(0x6441ea3ec2c7ba97), W(0x85eeec64fac322e9), W(0x994f1a9823044f1f),
+     W(0x721eb9bd2c4a5f8a), W(0xd1ee17a84a056716), W(0x43308f9faf749ff9)},
+    {W(0x766db0906914ad11), W(0x1e71b3c9a36b26fe), W(0x01919e4136a59b91),
+     W(0xb3c0cd7e82cdbb32), W(0x3ad92766b2031859), W(0xf7fb925ea6540da1)},
+    0
+  },
+  {
+    {W(0x2f94ee4b547a6a72), W(0x02a394adead84c6c), W(0xfd99bd43d179cd3c),
+     W(0xb34de9bf62388c76), W(0x031b18acfbf8ec20), W(0x99b61a784714c285)},
+    {W(0x84ba640b5e466543), W(0x9b391600249146d5), W(0x4c9ba308ff28227c),
+     W(0x4ec9ffd58095cf3b), W(0x5ec8a80dcbae5130), W(0xe47803e9cdde8185)},
+    0
+  },
+  {
+    {W(0x3ca9b14b6f17466c), W(0x9847420469530b97), W(0xf2f5c463d6813bc9),
+     W(0x52c16b764a91a81a), W(0xd644949a3c58dce7), W(0xb3597ed9aacdc0a4)},
+    {W(0x1595b0c6c964c8ec), W(0x32cce81466504f5d), W(0xf253283dfc61ae78),
+     W(0x70f579ef314ac619), W(0x313d5a48487c0ce6), W(0x5f86624e776b4976)},
+    0
+  },
+  {
+    {W(0x72855532aa94a8f9), W(0x351f6858f1e68c2c), W(0x9bec4d7645b2925f),
+     W(0x310eb6abe49524fa), W(0x6449c31d9a63b902), W(0x78fb80a687569711)},
+    {W(0xfd36d8efe8630a93), W(0x4746611389d26f3f), W(0xa3324945f8a45921),
+     W(0xab76afb020520ba6), W(0x3e4af4ffeba31453), W(0x90891517b2301798)},
+    0
+  },
+  {
+    {W(0x4341924e36aae009), W(0xb73e4fb26c43405f), W(0xe743c183e3d4f88e),
+     W(0xa82fb65e07802450), W(0xc45c39b83f0e3a57), W(0x9fb721743464a215)},
+    {W(0x5b8d5520fffa0fc0), W(0x971abefc98134b9f), W(0xad6416ec3e8fc849),
+     W(0x4287a22226c5ef75), W(0x3df304224168350a), W(0xa6842051f92a67ce)},
+    0
+  },
+  {
+    {W(0x2366c7e4d2a5c9f9), W(0x785bf755e5d77fc1), W(0x3fddefadf0638cd2),
+     W(0x0969950c92490f48), W(0xa42556bbad71f47d), W(0xfd951c3cbd25e237)},
+    {W(0x58a5c4e7de49f37d), W(0x79ec35f96a05950c), W(0x00a22e4d816a3ef8),
+     W(0xbdf10f12909b82d9), W(0xdf27821170aa4ab8), W(0x01a6137a59de45be)},
+    0
+  },
+  {
+    {W(0xc9f150855b3fc1b6), W(0x4597f4746193295e), W(0xe350d499ceefe1fd),
+     W(0x6c39b6b3905fc083), W(0x74f439a34f8ebd12), W(0x677441169688ee6d)},
+    {W(0xc12e69dd780201a3), W(0xf72e5163f58f44d2), W(0x7aa4725b41eca139),
+     W(0x81bb08a40f5d49e6), W(0x6951c7aed13d21c0), W(0x19bfa78b09521810)},
+    0
+  },
+  {
+    {W(0x164b797c25073224), W(0xf3e910e0a5859984), W(0xeaf266825b72c9e1),
+     W(0x51c065bb060c4370), W(0xc9ad44a8cb473537), W(0x56efb9df07c28b71)},
+    {W(0x3c78cfc6aaba36ba), W(0xa40fa8a7dcd2e46a), W(0x028febb887eba145),
+     W(0x891eb136c710d9af), W(0x4815d6101c2b9b50), W(0xab0ce8ad548d0ba1)},
+    0
+  },
+  {
+    {W(0x5ee8728bc55b7259), W(0x2c0bba977990fb97), W(0xf07e50b1fc2735c6),
+     W(0xc66e409f8b3f4392), W(0x9ed7cb93f42dbf3a), W(0x39f0be6b5c58711b)},
+    {W(0x3e086a14c0014519), W(0x7ac468508f143f46), W(0xea81f1d3ebc48b5d),
+     W(0x4baef1ba4d58bc8b), W(0x18af305348f13f33), W(0x2f3e1bf7bb45e0dd)},
+    0
+  },
+  {
+    {W(0x174ef15e72b560a9), W(0x439440820b389778), W(0xa65d0b7c50f2a317),
+     W(0xab691102820ed5c8), W(0x990a61b77ab76c99), W(0x45aa4b9f35eeb89e)},
+    {W(0x66d23ecf282bae66), W(0x33d62372e6496f26), W(0xabe8309abc7289ef),
+     W(0x6f148a0e6e006035), W(0x54e0446c989030e1), W(0xa63b7e8690d8721b)},
+    0
+  },
+  {
+    {W(0x0fb45c7459f39d74), W(0x0f6558bba20ea5fc), W(0x9cdb49dd9c38f840),
+     W(0x4193da01f4f0460f), W(0x6132a43cbf97362a), W(0x5c91cbd934c4be8e)},
+    {W(0xcd92bb1ae81f3af6), W(0x84a5cdc2f7166677), W(0x0c322f047fde721c),
+     W(0x55455a2b0c92a932), W(0x471dd893227559c2), W(0x8810cb6e1852d2ed)},
+    0
+  },
+  {
+    {W(0x11207480db8a92f0), W(0x89779cf7335615ec), W(0x446e30fa5908432f),
+     W(0x7fdcb6ebcd95e5cb), W(0xd72aff494a121e2f), W(0xd5a50a71a784e3f8)},
+    {W(0xa1c87aade3a93bf7), W(0xffdd4fde343525db), W(0xd638d7554145f9b0),
+     W(0x3f7abd4619233666), W(0x9e67c021b054761d), W(0x4723150853507c3d)},
+    0
+  },
+  {
+    {W(0xe4c3fb3201eda89d), W(0xe22f3df0b9b8a94d), W(0xe5ca26d34085fb51),
+     W(0x64b76cd245693a74), W(0x11e02fd1bc6bb7af), W(0x52ac5f5909658cfb)},
+    {W(0xd62ec733982169b5), W(0xe26d0125ca72fa82), W(0x7c52b020b340b2cc),
+     W(0x956614051a67b050), W(0xe9b0d0f11827a9e3), W(0x48fe26c22ece7c07)},
+    0
+  },
+  {
+    {W(0x51f7de29c14e091f), W(0xf331a99037ad1eb5), W(0xf3e699f2eca79903),
+     W(0x164a8870b8e9c9ec), W(0x36ec2b2624ab20db), W(0x5dcbbba9733d1bb2)},
+    {W(0x57b756c3f2cc55a8), W(0x75cba4589a6df980), W(0x87bf4868a7dd7788),
+     W(0xeff9eb4e2bb5e1fe), W(0x2dcb5d15056a3f1c), W(0x37df1a920ab9aa16)},
+    0
+  },
+  {
+    {W(0xde37dcfd6474b4e9), W(0xe49d38f710d7a981), W(0x6de69a1c329efc50),
+     W(0xf37abc31e28b8b18), W(0x3b8745dd26905dac), W(0x7150d0ae9cf9f4a1)},
+    {W(0xeafce20388729cbb), W(0x60c785fa88812357), W(0x8e01a3a2c67e739c),
+     W(0x987503405d96cc31), W(0x179f3afc06c77ac9), W(0x35f0666cd8c4a243)},
+    0
+  },
+  {
+    {W(0xd8fa12394d4823b2), W(0x4435fb39af8d189c), W(0x68236ca55d58a485),
+     W(0x1ab4b58c9655a9d5), W(0xfc63065db1638fd4), W(0x84a393f247c346d7)},
+    {W(0x802de1a6e1ff6753), W(0xd79ecf03b798631b), W(0xf8d34e37907cfcdc),
+     W(0x16e2d2f770269afb), W(0x935317d549752879), W(0x652747a778f38c34)},
+    0
+  },
+  {
+    {W(0x2407c0e811ab9afd), W(0x9bdce4c5d57bfddc), W(0xb983a3ffffe42ae9),
+     W(0x440cf8e04d78df69), W(0xcc89c4f0d1a5fe1e), W(0xdcff4c34ddc8c225)},
+    {W(0x73f6172ea436d7d2), W(0x50bba242a490584f), W(0x055cb85cabe0de55),
+     W(0x3f992d1f544d9355), W(0xb18bd07fec5a88ac), W(0xedb98923077f6ce2)},
+    0
+  },
+  {
+    {W(0x91c3dc3c3938cc06), W(0x0903ae558b7553d4), W(0x7b86f68412739dc0),
+     W(0xf81a88529954bca2), W(0xa72d515f3c806c59), W(0xcb50b4b51966cf98)},
+    {W(0x9bf91c4fc9454850), W(0x57e0c46b4ce1f25a), W(0x606da4cf2c533029),
+     W(0xc84a87dd9a058edf), W(0xf82021ac732df1f0), W(0x1b1b303669c3681a)},
+    0
+  },
+  {
+    {W(0x634ec730bc55602c), W(0xcd4f9976cbc44c23), W(0x3945715a80e911f1),
+     W(0x85cb335ffe18eef7), W(0x0c349820b7f1ad06), W(0x924ab65e4e4e84f5)},
+    {W(0x99c7062f3ced7927), W(0x8ab085d2d5f88ed8), W(0xf9170548adbf9221),
+     W(0x765891b2a6a9db22), W(0xfb537189639282e0), W(0x2b8f48d46a635559)},
+    0
+  },
+  {
+    {W(0xd43eb0c578d62fe8), W(0x5bb7a79bfd8f1af1), W(0xe5f8bde63484fe1e),
+     W(0x8ee4c0a11434bb86), W(0x150fe8191d04c4f0), W(0x5118ee8ad93a86b1)},
+    {W(0x83da448df18e8e1e), W(0xbab84e2d30c34c26), W(0x84ae73c00f84d087),
+     W(0xfd85446476e393e9), W(0xcf047ad11c4c5349), W(0x3020c3d0bcc9b21c)},
+    0
+  },
+  {
+    {W(0xfc1375011706c983), W(0x63bbadb7382c4233), W(0x9bee63ae88eb9759),
+     W(0x53a2f4d0199249a2), W(0x7ba6cf85b223332d), W(0x786c70a5569f3431)},
+    {W(0x5fbf94eb718c51e4), W(0x0dec4ddb7b863a95), W(0x7f5969d7bdf9ac27),
+     W(0x0e44f1531bcd128e), W(0x88bf07795a1023db), W(0x67094b7dd4464f6e)},
+    0
+  },
+  {
+    {W(0x5c7b3c1ddef19f3a), W(0x489448e93df81d76), W(0x2c3afd8a061d567d),
+     W(0xd3bf6b8232a6cb1d), W(0xc8434337d1d02714), W(0x5790fb1895dfc36b)},
+    {W(0x17539161af8f3165), W(0x0a9c6f62cfb835f9), W(0xe393fd7e2f9c84e6),
+     W(0x878bf90cb6f190b3), W(0x15236748c92300f8), W(0xfc7589aa3e195f31)},
+    0
+  },
+  {
+    {W(0x0e3e853b445b5170), W(0xd87b2261976d7a42), W(0xffe3a2680d55bfb9),
+     W(0x064ac16a84e9423b), W(0x0253f6fbba39a709), W(0xa0cd7426215e4142)},
+    {W(0xb2a4eaf3a22b25a8), W(0x08c469b2d976dae7), W(0xdb79a8724f20af18),
+     W(0x4ffdaff9218faa2c), W(0x6c8ba0cc5690b264), W(0x31e5dcf9e996cb29)},
+    0
+  },
+  {
+    {W(0x97804ad86a89f1b8), W(0xc7afcf47e50cf5dd), W(0xcced7f9d84cd93cb),
+     W(0x0390bf7bd7b782a2), W(0x2620301e3e5a0191), W(0x4f196c67fc62dd20)},
+    {W(0x47f8fde9747cc40e), W(0x513b13b7e61452a6), W(0xb150e533e47ad2dd),
+     W(0x585154ce43375398), W(0xfb52e56277a67f2e), W(0x6d93fbe72dc6e0a6)},
+    0
+  },
+  {
+    {W(0x45a2b697eb6b7de4), W(0x6df6fbc68116fe1d), W(0x99db01dc94de9c0a),
+     W(0xeaf2627d85c17d14), W(0xe436a6473814e1f1), W(0xaf1279cb5fdc073f)},
+    {W(0xc82997b1756943cd), W(0x7aec4f5e0efa5584), W(0x8ff64fa91ac288ea),
+     W(0x22632503b439bb13), W(0x376016e1118b6376), W(0xc492ed25a8b88d3e)},
+    0
+  },
+  {
+    {W(0x1dfc36c11ea9ff38), W(0x0e6317861d42678f), W(0x59a6990940bde994),
+     W(0xfef192ec2482432b), W(0xfdb9a6eb975a8117), W(0xaeab5d0039f3e119)},
+    {W(0xbb08c22f66921ac4), W(0x2cc6c3da747d9e28), W(0x2670f8bff1d4b83c),
+     W(0x18bf8e72b4ad98b8), W(0x024d13328d9e446b), W(0x720ecfaba454b24f)},
+    0
+  },
+  {
+    {W(0x226e6c612a71a4c2), W(0x08204d0a76ad55f6), W(0x018d717f73d5b467),
+     W(0xdfd268cc24c1598c), W(0x3cd9914f9f81ebb1), W(0x8329e562f82c3d89)},
+    {W(0x24cd5b74edf1a9fd), W(0xcc49cc0a34a23335), W(0xbe66a9ba2bbdcec8),
+     W(0x58864cf438e76959), W(0x62118369a2871d0c), W(0x5b7d326d43cbcee7)},
+    0
+  },
+  {
+    {W(0xa356052d9636f962), W(0xe838f4690345379b), W(0x376535517e108014),
+     W(0x2c9dfd7e0bad3b59), W(0xf9f9db0d0acfd0a8), W(0xc5cc3f5fe328b67e)},
+    {W(0xaf64e0945413684a), W(0x5b35ee2452e60041), W(0xf59c145d8df0647f),
+     W(0x0f60629a34e022ca), W(0xd9fa9922dc688feb), W(0x77e3252c01700e95)},
+    0
+  },
+  {
+    {W(0xe6c65c44608b952e), W(0xabf24155f461907b), W(0xac5d79f0b2361bb4),
+     W(0xfd5550cc5003694e), W(0xbdfd8f9c2c18f6a9), W(0x3675b57bd32d5075)},
+    {W(0x41293634e7f79cc8), W(0xea2cfd99e927a167), W(0x19977d6ebe943bdb),
+     W(0xe94826aea5cc7bfa), W(0xd307426256a0c1c2), W(0xa48fdbf94701f712)},
+    0
+  },
+  {
+    {W(0xa3ef83d33d26d325), W(0xf02d27268d453ae0), W(0xce134d850c6adc5e),
+     W(0x3d8712241153294a), W(0x0231c58afc011f72), W(0xc29161eb477b5aa4)},
+    {W(0x8d5e37aecc40f1ac), W(0xafd96514ce2abaa7), W(0x3114af9612c20f31),
+     W(0x0f8f1c1fe504027e), W(0xdc34d2682e6006b0), W(0x5298a876e3a2a082)},
+    0
+  },
+  {
+    {W(0x58c09f023feb719c), W(0x260a5c2d35538941), W(0x4706d285ccf0eb71),
+     W(0xf2f92cc5ab856a99), W(0x7bbc1bdd0bb2c08f), W(0x1146f96808143bd2)},
+    {W(0x619dffdab2563159), W(0x95022fe0bf72b917), W(0xb3ff2fbd48c88b9d),
+     W(0x977e86df21df4296), W(0x6600d71b897cec72), W(0x08ce6a2f0363377d)},
+    0
+  },
+  {
+    {W(0x5a73326af04263ba), W(0xb74d2c2e5eb385ff), W(0xf9ebb7844128a442),
+     W(0x274492c361b41140), W(0x5f922c0a00806c3b), W(0xfb37982a1b2288c3)},
+    {W(0x5625747d50b67e3b), W(0xae8617294c8fbc86), W(0xb3eb31a6e1d51325),
+     W(0xdb1b9a5e69ed52fd), W(0x568f17e4ee7a6fd3), W(0x375d3804eb14d9fa)},
+    0
+  },
+  {
+    {W(0xf2ee9e642ddd8780), W(0xb5147df5eb467fe4), W(0xe272d102102822c0),
+     W(0x4fdc04b1973a8aaf), W(0x9c10f067d39ce4e8), W(0x4850163081015b28)},
+    {W(0xa65be92d149ca01d), W(0xc277d00faba3cf62), W(0xceeca9b270bb8094),
+     W(0x19ba43813a7c6043), W(0xd86c74c9ef2d7daa), W(0x9e5c9a025254cf1d)},
+    0
+  },
+  {
+    {W(0x858993f4715576f4), W(0xe57550bc89336459), W(0x73d50f839441b46b),
+     W(0xcf5262fb73d50b00), W(0x77a860e51985ecc6), W(0xceb0270042525dc8)},
+    {W(0xf67d8a8367c6f851), W(0x027c27066c036395), W(0x9f469f4bc016fc22),
+     W(0x595a34ebf46c7583), W(0x1b041fabef81fd15), W(0xc4e16db7c7fd97bc)},
+    0
+  },
+  {
+    {W(0x5b65e9eef0c30200), W(0xef899751209216d8), W(0xf4cafb68897bb954),
+     W(0x21cf722bbfd17722), W(0x7a0238c747162860), W(0x08da54037e455e72)},
+    {W(0x8647f1ee4dfbe219), W(0x7ff5d85c456d2a5b), W(0xfd1837c38d21c7a7),
+     W(0x7c4ce7183e5672d4), W(0xf86ac332c99d22f4), W(0x7ab2325c6f3b8e17)},
+    0
+  },
+  {
+    {W(0x88dc605df1cc2979), W(0xe579cf8f50f0d8ea), W(0x9e71c3883034f1be),
+     W(0xcd3642a13c7c95c8), W(0xce5f559668678cb7), W(0x26f70fe273e7d168)},
+    {W(0xb1d451a4c0c77783), W(0xe2a78c65d5d0064b), W(0xd2c3b23eabea53c2),
+     W(0x412e45de2db76cd7), W(0xe30e07ba61571505), W(0xba5278d16ba0ca10)},
+    0
+  },
+  {
+    {W(0x53019d8a853e5b7f), W(0xb0fe22c3fdf1ffca), W(0x51e189fe1fea085f),
+     W(0x32b720f202ff54c0), W(0xc0b917f15ed23795), W(0x68a2be4f714964ee)},
+    {W(0xf8e45ca5758dd4a3), W(0x4963ac454e814aec), W(0x27a596dc5dcac06b),
+     W(0x4c8191902e572edd), W(0xd0b1cdf8241c33c7), W(0x566acdad6320d8d0)},
+    0
+  },
+  {
+    {W(0x6b0446272cdafe4d), W(0xdd46d1dbede1b96b), W(0xcad63456fad3855f),
+     W(0x99015114d357493d), W(0xae98f124d1e544b5), W(0xf99c7c9355b3737c)},
+    {W(0xd90eaf1408d8ee8d), W(0x390b980c3fed33c1), W(0x8e917ee225710a0d),
+     W(0xb7d6bd86a73ab0db), W(0x6a0530843503a0cb), W(0xe0f05a11e6b21bbe)},
+    0
+  },
+  {
+    {W(0x0e85d473347448df), W(0xd091eac6c001643a), W(0x87e6862423a74d8f),
+     W(0x03de5686b4ddae5a), W(0xd94a21b3cbafd989), W(0x937f48a29791712e)},
+    {W(0x2331a052bda8c124), W(0x96a07372b39b847e), W(0xe11e9fa462211038),
+     W(0xfe7aa9a5ab4b25b2), W(0x99e0bf0025c89597), W(0x97a2db27de03a4e8)},
+    0
+  },
+  {
+    {W(0xc49e00b92579d809), W(0x4d5a7248175caeb7), W(0x9a8d6cea83a20727),
+     W(0x700eee4a0e6eb842), W(0x705e1c8f6a732dd4), W(0x16deb915d4a61cea)},
+    {W(0x1e459145187eb378), W(0x4e83f3b093b84a63), W(0x3f36a5548f5cf186),
+     W(0x2178b0dc62947868), W(0x0357235421eb4d9a), W(0x4ba1a3671780a656)},
+    0
+  },
+  {
+    {W(0x47bbe25bed41ee7f), W(0x0d3a064e9bc5c68e), W(0xc33d2d1e085eb26a),
+     W(0xfa5822efc9abda72), W(0x07366713d1ef20bb), W(0x23de3509b1f3b592)},
+    {W(0x61c0cd20a03f1d4c), W(0x1506967c41417add), W(0xc85250ac6888d7ab),
+     W(0xbcbadd959749413c), W(0x8ab04a97344568c7), W(0xb014769db6b3e85e)},
+    0
+  },
+  {
+    {W(0xf9f4c8b165b3a95b), W(0x6f5b05551fb0cb0c), W(0x8a44c5d778cb3470),
+     W(0x59d1d13c8913dd3d), W(0xbf918571d2e5682c), W(0xdfa3be61bef61247)},
+    {W(0x5ac1f92471f81c90), W(0xeebdb44ab7c6a2de), W(0xfe3cb3b03d9e0124),
+     W(0x48fc389120bab6dc), W(0x4a1ab55249a27c76), W(0xabb46d2352ba956e)},
+    0
+  },
+  {
+    {W(0x09a326f996933da0), W(0x88a5ce64d3a5c292), W(0x49c9a7a75f44a80d),
+     W(0x8d631bc1e6c5e421), W(0xd0c99ff3292781ce), W(0x01df2c1d8da41b5f)},
+    {W(0x6c0f140b4b6e2c1a), W(0xe04cff3cf86c7662), W(0xcd06ef37f1bc5588),
+     W(0xd98d21c84fe7ae19), W(0xf0dc79663254cb68), W(0xfefe2fae5b2ebf53)},
+    0
+  },
+  {
+    {W(0x164483e8762df3ce), W(0x5d7c5e42a7a31b60), W(0x5d03227bce0b60bb),
+     W(0xa8480d982825112f), W(0xb06f73bb1abb51ec), W(0x9dd099a2d18c2852)},
+    {W(0x414e901f361c2476), W(0x1c03e547336b775e), W(0xb427edf50dc1e307),
+     W(0xb5581bb636104284), W(0xa8f79f7aa74de9f8), W(0x3455dafbc2839670)},
+    0
+  },
+  {
+    {W(0xde1aa65ff5ac4bd1), W(0xb1432a9cab9400c8), W(0x144676cd2d88488f),
+     W(0xe288d02f77b03bec), W(0xf2f5fe87e797f4b2), W(0x61dd779edc2b86be)},
+    {W(0x722d518c6a9d5dad), W(0x05695dcc1097ca9b), W(0x57b61a8140586e8e),
+     W(0x479601ee912de763), W(0x22475af8bcd79496), W(0x76a127f10407d977)},
+    0
+  },
+  {
+    {W(0x8bb93803440df0a7), W(0x8f32d755a1e203bd), W(0x1d8cfabec6baafb7),
+     W(0x830c64d885407685), W(0x4d33a879a4c9ad48), W(0xae4eedba60bc96d0)},
+    {W(0xe039916e108381b6), W(0xed85297c73b9bf16), W(0x64fa11d21ec7fbba),
+     W(0x01339161e4de268c), W(0x5dd51fcdedb969ee), W(0x03e43254ec1c0761)},
+    0
+  },
+  {
+    {W(0x1988f05b727c10d1), W(0x4768c1c8b5795dde), W(0x2d48eae3f6f4bbb2),
+     W(0x8d1115ca1922e829), W(0xfc7239be4ad75c43), W(0x9aa1b7cf5e8cf36b)},
+    {W(0xaf7bc1d21bfd4849), W(0x6839aac711ecd02e), W(0x558ba3d1f1301d9d),
+     W(0xe73abc6af65db176), W(0x7117d53c19c87d0f), W(0x636eb5ff1903bea4)},
+    0
+  },
+  {
+    {W(0x2a572a1827d8e40a), W(0x553d163b19607ad5), W(0xeeb3208c250a0921),
+     W(0xf3f1e011f238579a), W(0x860ceaeaa8eddf52), W(0x2f4ad9e63cba373c)},
+    {W(0x7e5e0c517018cd33), W(0xeeeeae4bff9171c1), W(0x0fb592a2fdb041d6),
+     W(0x7e9bf004f391f581), W(0xb0461b0d4ab5112e), W(0xb5e41ffe4a4399ba)},
+    0
+  },
+  {
+    {W(0x4a3551692280ca5f), W(0x0f748153a4ca39cd), W(0xf2e1fba5e17ed132),
+     W(0x519c8372ac129d29), W(0x8ca67830f9b9cd27), W(0xc7b3529c297a88da)},
+    {W(0x0eafd6dff7b0b348), W(0x4c62f6de709c38c5), W(0x83036063e260ef7f),
+     W(0xc7f07b8f0f7dac3a), W(0x28ad0a2312d9ccbf), W(0x7dfe8edc9c6468be)},
+    0
+  },
+  {
+    {W(0x9231e3f1a9cfe7d1), W(0x4a7c73ccba907970), W(0xe0a3fee49585b149),
+     W(0x7c3e97dda4b30d95), W(0x168b554d41b871d3), W(0xbc131549b89b97a1)},
+    {W(0x56baa3896ec5ebba), W(0x517e0595c5d4bbb5), W(0x7501f6acf23fd5b7),
+     W(0x8a3a208920382e2d), W(0x8395bfbff5016497), W(0x7722e6fc8ad5f95f)},
+    0
+  },
+  {
+    {W(0xab5df438350c9804), W(0x3711f50c31b66e90), W(0x8ef4f3ccbeddc3a5),
+     W(0xfe69f0a40fa79cf9), W(0x1b57ded4eb8acb30), W(0xd63a4786f5dcffbe)},
+    {W(0x166b780150b213de), W(0xff21d5863d1f5341), W(0x637d813da4482d43),
+     W(0x1ee3c4dc01754f94), W(0x2a8f3bf466133e76), W(0x397ff4e49b7fd071)},
+    0
+  },
+  {
+    {W(0xa6a9e67b4c5922f1), W(0x47624ee278a959a7), W(0xd81ca20ccb44bae7),
+     W(0x3d54efaf83a5c83d), W(0xe0ddfd325adb12dc), W(0xb12c7588b3ef4234)},
+    {W(0x9c2c22415a5dd27e), W(0x1cdf6eb4f262e94e), W(0x3dd46c9fef9f479b),
+     W(0x5a77a27e06ceb843), W(0x6c458ee38f5429d6), W(0x815fe4f62cbaccd2)},
+    0
+  },
+  {
+    {W(0x62a516fa6e8fdaa9), W(0xf391c25cb4b981fe), W(0x073b4fcf2b484b97),
+     W(0xde23f66fc1926b98), W(0x0a2600caf77ef7c4), W(0xf7a209653633b8c9)},
+    {W(0x211463f31e8b5d77), W(0x38a1d4c2d3a8d2ff), W(0x351e9823a7336573),
+     W(0x0032958d2b0845d4), W(0xf293522ef05153ba), W(0x02150430d3121642)},
+    0
+  },
+  {
+    {W(0xb9ae629db1f317e2), W(0x72fab2f4481ff4d9), W(0xb6c91c01a862c3a8),
+     W(0x36dbd5cecdaf78b5), W(0x64cf7da9d5c925b0), W(0x727b3c0e00f9bed9)},
+    {W(0xaf0dc3f6a0bd6b41), W(0xbf9df66b112d9573), W(0x01b95f0c6b11c71c),
+     W(0x42180ec6296f7790), W(0x53ae3b2a11f288c2), W(0xd3f6ba33cf25ea4e)},
+    0
+  },
+  {
+    {W(0xaea2285f79d6a54f), W(0x6e37e7ecedf40fb9), W(0x9f39858b820a6f3c),
+     W(0x610eb148afddd892), W(0x5024caadd703a690), W(0x1dcc4c92678c370a)},
+    {W(0x769719fc49ceaee8), W(0x391ab22f93695508), W(0x3a6dd14917343d6c),
+     W(0x04c7e4b18d0147eb), W(0xa9fdf53a639c42d3), W(0xeb2f8d64b6d65f39)},
+    0
+  },
+  {
+    {W(0xd941739b70d667a1), W(0x9e972317261c5a4f), W(0x95df60e6737d80d2),
+     W(0xcd3ecf1b88f14ada), W(0xd0d50aa80472ad46), W(0x00b690231e5387a0)},
+    {W(0xa385e0fa67048a3e), W(0xdb1314ba5b978385), W(0xff2fac99595b15bd),
+     W(0xe50414b6c525aba7), W(0xe0e53fd0a69165b4), W(0xa3f84e0d862ed4f4)},
+    0
+  },
+  {
+    {W(0x353974f9b4f36852), W(0x219e594564742c1a), W(0xc31f1ac70ee24d7f),
+     W(0x4b60890554d08b37), W(0x0baff39d8a9b2845), W(0x9014ec9e3503437a)},
+    {W(0x01c8ff211e430dfb), W(0x4cb619a9d715c672), W(0x72149cc12b67b9cf),
+     W(0x24f612580dfc75b3), W(0x4e3c4f2d425582cd), W(0x34a7eeaa6c78edcb)},
+    0
+  },
+  {
+    {W(0x46fb17d03b65e5bb), W(0xff96b8fa4f33c7f9), W(0xedb67579712905d5),
+     W(0x17ccb67962329e64), W(0x4aa0a86fe74c2ce1), W(0x7a44612c69a82951)},
+    {W(0x09ea9768a7662754), W(0x91be12cc5fe58c35), W(0x3574362637652a69),
+     W(0x1e6f1f7f49eac524), W(0xc293f35c9cea5064), W(0x9cc4b178f7350e3b)},
+    0
+  },
+  {
+    {W(0x0c2d8c4c4c420dc7), W(0xcfedbb1c75774f02), W(0xc351aaf10c8ad3d3),
+     W(0x539053de178a3535), W(0x57185a8d9259b16f), W(0xb210155650b7a27b)},
+    {W(0x6d57056f961afcf0), W(0x21397e3fb6026965), W(0x49302c8294aadd4f),
+     W(0xa4bded9f13bd204b), W(0xab5a1b7fc3d78440), W(0x7ff51bc510746dfb)},
+    0
+  },
+  {
+    {W(0xf95517004f8d1746), W(0x6f8a5c299ef7f227), W(0x203a5e87714ee433),
+     W(0xe44ab269e7cff2b0), W(0x6df1dc5c6949c2be), W(0x73997d68b5af4ef5)},
+    {W(0x2584a62d34e35f6a), W(0x7ddedc88d64a69c3), W(0xc25a16d605f35fed),
+     W(0x851312640367a83b), W(0x7ad3e3991fc8818f), W(0x3a38a09599607f20)},
+    0
+  },
+  {
+    {W(0x85f1b212bdf7d25a), W(0xa4539ffe492847c7), W(0x4178219399437096),
+     W(0x98f4856fdb49e5f2), W(0xcf9864fdc569e78e), W(0xdb98c7b005f0b705)},
+    {W(0x8fae01e2e80c3fc7), W(0x9fce0b33f53d9f36), W(0xca5fd2127a7817c6),
+     W(0x031fa9b6f2c42279), W(0x62b5e24e9973c1f3), W(0x0f995ffa4c4b77e1)},
+    0
+  },
+  {
+    {W(0x17bee70d4ca51551), W(0x69953881b228329a), W(0x69d0529d8b8cb874),
+     W(0xab3fa47e1e8d2946), W(0x25b554ee0d67f5e8), W(0x7b09b6e7ff46ba7c)},
+    {W(0x23a228e0d94f57f6), W(0x5fb67a50fcc7ec54), W(0xdcffdd9854ee8708),
+     W(0x1f60277920187270), W(0xddb5991c8e27c522), W(0xf523a10be7160669)},
+    0
+  },
+  {
+    {W(0xc832c9d0bc5494db), W(0xb0a290971fce2b71), W(0x5af12925ebf8071d),
+     W(0x390edc8d22028b2c), W(0xd3573576c2d354bc), W(0x476e12168ce8c486)},
+    {W(0xae4b7be608a0645a), W(0x8c66c4040e2ec519), W(0xd54e7378d266383a),
+     W(0x53039cb848359986), W(0x45506eca0832ae1e), W(0x5a4fae11ccb3061b)},
+    0
+  },
+  {
+    {W(0xa0a010d377b3a22a), W(0x5dff597dc5d514d9), W(0x8d1c5abde8980f14),
+     W(0x2a46f1d93d0f3b19), W(0x7248fc18b3e6d5e5), W(0x339c73bbadc47367)},
+    {W(0xbf58187d5f0341f2), W(0x5ccc32221429c2f5), W(0xbb9305a9b6ace7a0),
+     W(0xb6d9f22685b38cba), W(0xefdbf7507b7ad483), W(0xd32fabebde1f83ff)},
+    0
+  },
+  {
+    {W(0x0d0f59c4e1d64a08), W(0xfe80fbb85ba172a6), W(0xb12b959bec5d3c40),
+     W(0xe383074ff8add837), W(0xefdd7ccfdcebd864), W(0x9b2e4e61c73b8812)},
+    {W(0x533f10ff19215003), W(0xfcda53791e9bdf0e), W(0x488906ae5cd297ad),
+     W(0x61da21a47ea28966), W(0xca5a031a5f75f13e), W(0x6454ca96edad6c4d)},
+    0
+  },
+  {
+    {W(0x51f6151072e2d854), W(0x0ac78f89a1991ac3), W(0x43e64784830875f9),
+     W(0x9b3ff48aef01b568), W(0x5984620a78e3940b), W(0xba7a041d1c9b13d1)},
+    {W(0x7d4eb555a801e28b), W(0x6c4bc5e7cd173601), W(0x10f627567db529e2),
+     W(0x0b2ff6937e031281), W(0x1d1af7e4a3750f13), W(0x7dcb838492661dbe)},
+    0
+  },
+  {
+    {W(0xa8bb30afb73c673b), W(0x47a640d1d4bdb405), W(0x5c13260de3a170fc),
+     W(0x35a126e286c77f21), W(0x10f6bc7df4596e95), W(0xa75e116752cc4dae)},
+    {W(0x77fc555fdf7c8ffd), W(0x6c4056b9832e03cd), W(0x11ade7f4f9584dd0),
+     W(0x0a0e712690a08106), W(0x632ee480fc787261), W(0x7f5361e9d59f78b3)},
+    0
+  },
+  {
+    {W(0x37d9a6e79f55028f), W(0xc0e352ecda21f074), W(0xdc112f6623d75b15),
+     W(0xb628800dd4d6818c), W(0x70c926ffaa6c25f2), W(0x7894b039b7ef80b4)},
+    {W(0x1deda641a329a9e6), W(0x6b3aa731282a9dae), W(0xd571188e7138d514),
+     W(0x1979cd455723e843), W(0xc5fb5c636f8be6de), W(0xda6854e699271516)},
+    0
+  },
+  {
+    {W(0x9248ad9992f8ebbf), W(0x176402f0cdbcf48c), W(0x72efa2a7d60e21ec),
+     W(0xc1bcc718061f0905), W(0xce2190b52b45f511), W(0x02e3cec349292cfd)},
+    {W(0x43584a3e1ccf46d4), W(0xadb2d6e55db6d056), W(0xee620d1ab0185946),
+     W(0x6116a7750188699f), W(0x350b33269ab55ded), W(0xfa429ae5d38eeed0)},
+    0
+  },
+  {
+    {W(0x6e9d0fdaae761d45), W(0x12607cddb49544f4), W(0x187e384a074817c7),
+     W(0xf68cc4812d398b41), W(0xe018fb5b8eb69a1f), W(0x8ff7781cc4d16dbd)},
+    {W(0x51ae2bbf5644448d), W(0x1917e73ec5c89dc6), W(0xe10a3c2eb948e676),
+     W(0x40c7cd013cff7e80), W(0x2a6493687bb91a1f), W(0x5e01d8b66ae0c7f3)},
+    0
+  },
+  {
+    {W(0x970518592d511c67), W(0xb533d62b46c0be11), W(0x92fe5ec169cdd7c5),
+     W(0x5a7904565ab9deac), W(0x70492d1664269fc4), W(0x7467c7acea38c262)},
+    {W(0x84d6b6c74e15bc49), W(0x59ff35e9451c828d), W(0x3850ff9aab39a951),
+     W(0xe31297cc1af72765), W(0x4155c8dbfb893408), W(0x09036472ec659294)},
+    0
+  },
+  {
+    {W(0xb58b6f1efeb0b435), W(0xb643ff4392260272), W(0xd9208c7084b1c454),
+     W(0xfee5dd2f5489c29f), W(0x6df4a23c512f7a09), W(0x53dd06787b05f95f)},
+    {W(0x5367afcb519deda1), W(0xa0c10e4f92f92c9b), W(0x8e10ffa53c173611),
+     W(0x4ac8d8fd151c8071), W(0x6c4d703dab8dc33b), W(0x141fce06da4eb351)},
+    0
+  },
+  {
+    {W(0x69dca79868720a58), W(0x0ec82637d2394f6f), W(0xd7b18f9fe4210dbc),
+     W(0xc5da51b4891894ff), W(0xfb03a7447f751a74), W(0xab9e0642c9ddef20)},
+    {W(0x067285b01c7dc216), W(0x3c96c865cc1262f7), W(0x5d2f19031260f7de),
+     W(0x397772ea1ffb406f), W(0x29cd2c1c10fe96a8), W(0xec4530299dc9ce9b)},
+    0
+  },
+  {
+    {W(0xf195a9b6e3bcecc7), W(0xf2d69a9f69a29e90), W(0x3cb0005457134a61),
+     W(0xfcccc58d9bfca194), W(0xe32a19ec33af7bc1), W(0xf0acd16941248036)},
+    {W(0xbbc70ea8334587f6), W(0x873bb72a089a1219), W(0x3da2f19fac37a15a),
+     W(0x4497edc5852c476f), W(0x092c395365af2c02), W(0xa0c1e157807e803b)},
+    0
+  },
+  {
+    {W(0x670008cd76a4586c), W(0x1c81f5dee2da2f3c), W(0x2b500c3cb3068402),
+     W(0xc428b503bf3d0b6c), W(0xa1c89532a1eb81bb), W(0x04abe1263fbdc3d2)},
+    {W(0x40e3106b88fb993f), W(0x496a5c8b78a579b6), W(0xbeee3c54812bc695),
+     W(0x1e64b80b2b4c7fc0), W(0x753c2e58fced3577), W(0x42e06a8c3ceef8fb)},
+    0
+  },
+  {
+    {W(0x65c0dfdeeeef3299), W(0xa86ae674da130e6d), W(0x8388be567a7d0f66),
+     W(0x8c6f444191374a71), W(0x0bf26e97878c0a3e), W(0x24ae8b37eb49e5d2)},
+    {W(0xcd75d0ee7faf8c13), W(0xd1cc65390af14679), W(0x5db3fe3e01920bcd),
+     W(0x7f1169af7e4cdd09), W(0xc119d5df25342bbc), W(0x4a3967637f824402)},
+    0
+  },
+  {
+    {W(0x305b6d3639af1bc3), W(0x2a65432a5d11e347), W(0xe6932aa2531c78c5),
+     W(0xde6abc4f0fde6a8a), W(0x9d70dbcd80270594), W(0xb14fdeaaf85a1e54)},
+    {W(0x503e1f227329e3ef), W(0xbaad93b036a72777), W(0xe0c85a3c780addf0),
+     W(0x432fb4ef68800472), W(0x54efe1073a51851a), W(0xd90d526e4f64407a)},
+    0
+  },
+  {
+    {W(0xe994ff4ba53b0a52), W(0x2652d4a7e75728db), W(0xf05541512bc4deaf),
+     W(0xed7ee69fe0821c51), W(0x4e23723007814719), W(0xd5db6bf744f1dd9f)},
+    {W(0x60332d7b9d377c70), W(0x190614fabe00970e), W(0xf090acc8e0a308be),
+     W(0x53cd39200be790ea), W(0x683e9983a7e53fae), W(0xa646186910b4bab2)},
+    0
+  },
+  {
+    {W(0xb016b6b3b634ce9e), W(0x23e2de6d34530a97), W(0x16980b89a728285c),
+     W(0x31cdbb7b4ba7f293), W(0x979558b3845b7956), W(0x0231861182ea2e40)},
+    {W(0xc30e739ba451b885), W(0xc3f5b5668bf3bb2f), W(0x8f4ce00491b4cba0),
+     W(0xd11d0615f598ea55), W(0xdcde1015cc364887), W(0x14cd7fd73313d0ce)},
+    0
+  },
+  {
+    {W(0xf56d8ed25a991b95), W(0xed36d81e22a05d3f), W(0xc752ef66418ba8f2),
+     W(0x4ef5097f0c098a34), W(0x1e433058bdcf2bc4), W(0x9f99bd6c119675cd)},
+    {W(0x3221cafc550a40f6), W(0x2534038a491342ea), W(0x60d4249a4d048df9),
+     W(0xd07211cc6d0df832), W(0x95b784fcc09a6b5d), W(0x3972f1d2387fd7e6)},
+    0
+  },
+  {
+    {W(0x28c56b8b196fec0c), W(0xd12605d62b2912e1), W(0xc00455d15a669139),
+     W(0x0f8571fade16e0b3), W(0x91683a863edf8cb6), W(0x5fccadeac68cced2)},
+    {W(0xa660aaabd94348ab), W(0xc85707cf33b58ea2), W(0x5d27e1bf9215049a),
+     W(0x8efebe1cda989568), W(0x3b71fcc7f356edc1), W(0xc3fb4322d768f923)},
+    0
+  },
+  {
+    {W(0x333f77ec780e3c29), W(0xe75527525d77d19a), W(0x26dcda7036ae414c),
+     W(0x4d460461dd1ead54), W(0xdff898fc566ffbf0), W(0xea485d61f694ba8f)},
+    {W(0xa189805a8163677f), W(0x30efb97a22161e93), W(0x1c457a9f993e62a8),
+     W(0x308561c140e2c6c1), W(0x44d6260f3e37edff), W(0xfa166cf8b14600cb)},
+    0
+  },
+  {
+    {W(0x672849d0cf17ae50), W(0x5d7dfccd487699f9), W(0xf877ecda59ee1d72),
+     W(0xdfbe8171af88f21d), W(0x7e448333cca2e743), W(0x02999c73b096f629)},
+    {W(0x0533c8cea89bd141), W(0xe6ef4a1b999de09f), W(0x5761a3cd77a5e767),
+     W(0xb9e0fd7bac166055), W(0x06be693df4d3020b), W(0x7ebb8af4e5182186)},
+    0
+  },
+  {
+    {W(0x7d37577942782dec), W(0xf1df7d7aac8e0576), W(0xd3dcf24b618b8396),
+     W(0x8dfcfa126c6fb027), W(0x585bb290a98fc35f), W(0xae8cb7d54e313e1c)},
+    {W(0xec33f1ccc263d36c), W(0x3296d25287a31acd), W(0x3d6b897b6bbffb7c),
+     W(0x353323325860d04a), W(0xa6d83fa6f51c1614), W(0xfd98acb132f6a8ad)},
+    0
+  },
+  {
+    {W(0xf0c78ec0babae66b), W(0xe553fea4e9867d2c), W(0xec0b4772d30dd536),
+     W(0xc0247e167e91dafe), W(0x3453b11d0c87ed20), W(0x85f01d83ccae83f6)},
+    {W(0x0da9f35d4a214e16), W(0xde686450fa992589), W(0xb8a62f5d227095a1),
+     W(0x93225695a944a2b6), W(0x1398a0fa0e4cd6cf), W(0x4db40bc4e36e5de3)},
+    0
+  },
+  {
+    {W(0xf669e7521f2de353), W(0x9d261e56b92fb8b0), W(0x951b4da27706050f),
+     W(0x1b63d67a62a22c1e), W(0xe27b4c4ef36f0ca1), W(0xaa8b906a1962f554)},
+    {W(0xebf2d2577bc0d495), W(0x8c7bf085c09863d5), W(0x2c1b25f99cf0c9e1),
+     W(0xcc0bdacf0043f61d), W(0x02732d41d6b125aa), W(0x864cd17345739115)},
+    0
+  },
+  {
+    {W(0x88f76f2760c99172), W(0x31d018f4c71f41cb), W(0xa3cee3b8f58a1433),
+     W(0x182ae46a164ea930), W(0x2f3d7dc433c458ab), W(0xb53a037594cd12e8)},
+    {W(0x1a211781755fe6bb), W(0x5afdb4f55f29f46b), W(0x36bc6aa6759709f8),
+     W(0x35427fad5f3470d4), W(0x0abeb7245b85e7aa), W(0x62dfb3219cf180af)},
+    0
+  },
+  {
+    {W(0x02cc40550bde84d5), W(0x41874b8508949315), W(0xf7156b1b35676995),
+     W(0x0d580249deb545b3), W(0x2376d49bd02ed4e5), W(0x09d1ca80aa6d5e51)},
+    {W(0xffd81b7ae9dbc424), W(0x971e8bb451fb2783), W(0x12905a3efc0ac734),
+     W(0x86cb482656a130e7), W(0x5052332e9bae2cca), W(0xa1bc4d1ba2051b05)},
+    0
+  },
+  {
+    {W(0x0c55c8d2d292836f), W(0x93e0e147ffce03d8), W(0xfc78387b855f146a),
+     W(0x34555dee3e698d19), W(0xa1f48219efd7edb4), W(0x886153f9a5dff411)},
+    {W(0x00613487e06ac304), W(0xbefeb2be8bf96d3c), W(0xbd31ce21fafb1453),
+     W(0xcf5f3642399911a9), W(0x3a8f3271ce6eb5b6), W(0xe4162ddb3399b35e)},
+    0
+  },
+  {
+    {W(0x95d24c0f04e88125), W(0x292104e548541c83), W(0x6ff997d8ca4fac5d),
+     W(0xe99596ef2a36620b), W(0x32acc8a0260c0c74), W(0xe0d101324f2969fd)},
+    {W(0xb3591827c00f39b7), W(0xc2c061627434b7ad), W(0x599f32f6bb958f26),
+     W(0x8f59a580d8c0917a), W(0xf44b4e1340db03cf), W(0xb85308dab223a03d)},
+    0
+  },
+  {
+    {W(0xb8505af1728b7625), W(0xb930017c5bff3c54), W(0xf70fd8d8b08ae288),
+     W(0x16b331004411f9cf), W(0x0ffea3476d18dede), W(0xb1441b818192660e)},
+    {W(0x402869570f5b52fd), W(0xb43ceb8162e2edac), W(0x8e7de57a4cffdfa9),
+     W(0xecf37a0b79bab0dd), W(0x0f012e5787629640), W(0x37aa693dd43ad581)},
+    0
+  },
+  {
+    {W(0x2cfb402db8f9d0bd), W(0x69f68430d53dfc82), W(0x003ee11317e59672),
+     W(0x5b16b015e8e1f279), W(0x2cbc3350edaa68e6), W(0x45b904060caaf7d6)},
+    {W(0x63fe6103c0e7ae78), W(0x28a0b337ced41ade), W(0x58b3876bb76a4393),
+     W(0x9c8009d8e68268b5), W(0x0f6c29ac91f50ead), W(0x03c2a28b04024e0f)},
+    0
+  },
+  {
+    {W(0x1cfb3e5192836a10), W(0x1853bf3cd59414cf), W(0xc1aec222e9c1cb40),
+     W(0xf22d37d7ccf5539e), W(0x021b18287052c3ca), W(0x64ea0e992e452783)},
+    {W(0xd743209e83c4698d), W(0xdbe83ed3a5a1f6ff), W(0x83fc13fb589f2444),
+     W(0x91e354cfa0c7f1fd), W(0x418a1f53ac182a5a), W(0x33b134afa893580f)},
+    0
+  },
+  {
+    {W(0x97290e3d0fb679c7), W(0x18f5bb917ca1a3ab), W(0x43e9fee66cfc6a12),
+     W(0x1d8ffc7c1f149e32), W(0x104e5afc7ac2dc40), W(0xf4765a235f96cc0b)},
+    {W(0x8a11a313bbcc4d01), W(0xb9b5e32354811f6a), W(0x878387efcbccdfdd),
+     W(0xf3c0a62601ccea82), W(0xcf7c58b428bcc168), W(0xa886e490a9fea63d)},
+    0
+  },
+  {
+    {W(0xffe6218c645cc206), W(0xc04470d7bc7f03cf), W(0xea4e7812204c3e84),
+     W(0x8913dee0d29e2dcd), W(0xafa57dfe7fb428d3), W(0x99cb379b11e97418)},
+    {W(0xc5657cadceb967c4), W(0x7221fb6c42476fb8), W(0x921d03f9cbf01a5f),
+     W(0xdaa06affa9f426fa), W(0x85ddd49803e1ab33), W(0x92ecd1fe6e936e2b)},
+    0
+  },
+  {
+    {W(0x5ca49aa1af7d15c1), W(0x6078b63f0be96bca), W(0xaa13ffcba29e21c6),
+     W(0xe8832ca029a32c6c), W(0x6e34da27c83d8fab), W(0x3c01a936e0dec939)},
+    {W(0x408f0e5f9bd8ffea), W(0xbb02d36c384ff9ec), W(0x1fd038eb4bc88bb1),
+     W(0x1026256cdeaa8f1a), W(0x877ba03893962011), W(0x969210c1bc8abef3)},
+    0
+  },
+  {
+    {W(0x6f340700d74e002f), W(0x6ff2eaecab891deb), W(0x2f3b5b444bb25c72),
+     W(0x489fc564331d65e8), W(0x82a7cd599e4a2168), W(0x593f8085deb0cedf)},
+    {W(0x90b61360b409e55a), W(0x86af2a1b1adc6cca), W(0xc131383b6854b270),
+     W(0x6647d57c0a93d3ba), W(0xef691da05e79280a), W(0xf55ab4bfbebf625c)},
+    0
+  },
+  {
+    {W(0xb77b593f41675712), W(0x1349e1b2a135934f), W(0xc2927e2e0085b488),
+     W(0xcb7b5f60faa6ae31), W(0xb1121fe0243c4259), W(0x5e19a1f76c097bcd)},
+    {W(0x334c61e8c1f0cc8a), W(0xa369fc4f0fc491a6), W(0x23c7ec841c6b6db8),
+     W(0x5f7f4f2ac98ed90f), W(0x4daffff5e2fa7b39), W(0x882fd746f13bf556)},
+    0
+  },
+  {
+    {W(0x42fad2bdab9fdb13), W(0x22fc93e544e98f63), W(0xe72c6c3a5a192d44),
+     W(0xf28e409c6a5d2a4e), W(0xf672156b520a545a), W(0x9449279e399ca90f)},
+    {W(0x8641dc04e3833b95), W(0x935d71246ff5f2d7), W(0xa06733df72eff4df),
+     W(0x694b61b81e26b489), W(0x58bf70a702bca133), W(0xa6ffc0c0c81590fe)},
+    0
+  },
+  {
+    {W(0x895c497324b7dbc2), W(0xa6139685915ce84c), W(0xe4614ca01858fab2),
+     W(0x52ec7a236fab8800), W(0x5db0db087a26837d), W(0x37e6aeb6d5b68ac0)},
+    {W(0x83db427ff8d7e60a), W(0xb4116e8467c39c90), W(0x121f97bed9177332),
+     W(0x0f82f719ae292c2f), W(0xb32566003535ca9e), W(0xfa322503cf2dc881)},
+    0
+  },
+  {
+    {W(0x67b84873def8e392), W(0xb170b9bf7c51c982), W(0x8eb409ff28f02f23),
+     W(0xa38f13a6b847ec69), W(0xc8952ef8aee3b661), W(0x3bd4891a0b4bdbbb)},
+    {W(0x331db77e03a6a322), W(0xd6855f8efcd34752), W(0x8d77916d88cc31d3),
+     W(0x10b66bccc862944b), W(0x89f4dd2055c08963), W(0x5132604235a0bbd0)},
+    0
+  },
+  {
+    {W(0x26a054df4cf267a6), W(0xb85d85012175c7c1), W(0xf65afae1a4dcb157),
+     W(0x59a17d15bc81092b), W(0x895bb0cb0faa2c53), W(0xc415943f182c9e85)},
+    {W(0xd18a93298ea97c70), W(0xf855529c1a1fa147), W(0xbef1d886ff26be7d),
+     W(0xb295c3dccb6b5a5a), W(0xc1a921aaf365ca6a), W(0xdb7dec483107d89e)},
+    0
+  },
+  {
+    {W(0xfa5d6f240730f4e9), W(0xf842da81fb79f26e), W(0x76224fd84cabbdd9),
+     W(0x8204b8bc10f26090), W(0x405baab8926eb08f), W(0x4113f788b79af2c1)},
+    {W(0x523bfcc7e8f7e685), W(0xded835b2c05eb46a), W(0xdc387dd3baf7ea65),
+     W(0x59af3238bf9a49ef), W(0x90dbda3ecbb8b94f), W(0xd8ee0a6f9ff5f6fc)},
+    0
+  },
+  {
+    {W(0x1915d345f244740b), W(0xf86cb020b30846eb), W(0x0c864246ed670412),
+     W(0x09c747581ac54b8c), W(0x6f329c16eac8845b), W(0x38c8076bff5fd267)},
+    {W(0xa45e58a0af4ea350), W(0x165f2f839615dd4a), W(0xa0dd83c3e0a5751d),
+     W(0x6e47fd3ae45696e6), W(0x9bbde3319539b2de), W(0x000217d8cfcb0eed)},
+    0
+  },
+  {
+    {W(0x9649d083334b2d96), W(0x1b0a96ed3efca62d), W(0xf4c74ec145c76536),
+     W(0xf91ed365e397cafd), W(0x8fcb66db90ff64c1), W(0x7e52794381f518a0)},
+    {W(0x6eb22e194663be0c), W(0xd4ed707c2cf12fc8), W(0xc8db768c15fd7d5a),
+     W(0x9f71c4e55fced7cd), W(0x94d9d5bba687958b), W(0xcd14117af8f11ada)},
+    0
+  },
+  {
+    {W(0xb0690a9cb9424fd8), W(0xc8546362127cd535), W(0x40ce53d7d628005f),
+     W(0x607a429774a17c52), W(0xbfb8a3297d5226f6), W(0x8cf571bbb2015e46)},
+    {W(0x5fde3b261d93da93), W(0x9b75c0696e386f36), W(0xecc1f9de98cad1ae),
+     W(0xd0b103ac39c6c6ba), W(0x9d0f0c9705f36aed), W(0x2580b005634af47c)},
+    0
+  },
+  {
+    {W(0x35238019f59cdbcc), W(0x3a61eadef37a62b5), W(0x9fce13f292301aa4),
+     W(0xae5e7edeaf474dbe), W(0x5b4f4cb9d81a2e31), W(0xf6ab36a9ff490046)},
+    {W(0x050ecbd100f43588), W(0x3384c65d2a239f35), W(0x0b8b2f21cc8bc570),
+     W(0xa0de1720d3d8b840), W(0xca8006104e42bba1), W(0xffbf379519669546)},
+    0
+  },
+  {
+    {W(0xa8da455c4a623db9), W(0x52d65cfa651d09ae), W(0x94d436faf8f865d4),
+     W(0x9a37c84abdea1cde), W(0xb76161aee3b13c0f), W(0xd933dafe0ea433bb)},
+    {W(0xc90d2c805aa8d2e7), W(0xb60ff66a18a2176c), W(0x669c664cf9ac6d7d),
+     W(0x403fb9908767d2be), W(0xc46da54b7e032937), W(0xfd873c439e6fafc1)},
+    0
+  },
+  {
+    {W(0xe1904e3790ecd26f), W(0x41523095c2255cf2), W(0xc96f336babd1f68f),
+     W(0x5f5677dc9dc23f00), W(0x98f4168eb0efad6e), W(0xcd92ed7c748a7e6f)},
+    {W(0x637b90153fcfc5b9), W(0x30a4ef78b79f9ab1), W(0xb908d03f6eac993e),
+     W(0x0893afd6decf4470), W(0x20184cda7b24984e), W(0xc6623b82d1f8f2e5)},
+    0
+  },
+  {
+    {W(0x4d65deba38d6a864), W(0x3d3f70d858784620), W(0x229170528eea4207),
+     W(0xa56fcbf549d51448), W(0x527eab66827f8fbe), W(0x8f4d5ede14007025)},
+    {W(0x8f352211a26b18d0), W(0x3c2e3666236afd65), W(0xdc3e153bbde61f6e),
+     W(0xbf73b641ad5cad10), W(0xa250bb369a77e749), W(0x835798bd061c8f17)},
+    0
+  },
+  {
+    {W(0xe6266975137d2a02), W(0xc16972f3f3f94823), W(0xc0f771ec9f2315f6),
+     W(0xf15a72811d1cf345), W(0x18e53f782a2ee8bd), W(0x6de18cd2b382a68e)},
+    {W(0x5a1a5f0b95c4a9dc), W(0x1dc22ecb63e8d393), W(0x9232b82f2d6b15e7),
+     W(0x0bda20bf7d8919a4), W(0xdc9dc0420509ff52), W(0x09b17c5498ddca0f)},
+    0
+  },
+  {
+    {W(0xb9098df053031e61), W(0x10eb45ffce104157), W(0x9711e1e9c21eb8cc),
+     W(0x7e52410978837ecd), W(0xb59f82299bc4f8c4), W(0x9c0860e2cc709bbd)},
+    {W(0x4723ea54dce9807c), W(0x0362a4336aa83326), W(0x9b707bcd332c2b96),
+     W(0xda728dd34d70511b), W(0x474b6db34b995787), W(0x85dbbec04fa87485)},
+    0
+  },
+  {
+    {W(0x2a9a6a7153836958), W(0xb1dde2f7a27aaeb3), W(0x0c1d52d525d83a29),
+     W(0x232a5312aee0b18a), W(0x051c1eb82c417ee5), W(0x4d2782acc0c98847)},
+    {W(0xb6d476d424ea623d), W(0x839b42814b7c159f), W(0x9053e99678d5c3a3),
+     W(0x4310bd2628340dd9), W(0x24d5f148f070cf07), W(0xdd1fba8dd93d832a)},
+    0
+  },
+  {
+    {W(0x633f2a947429d81a), W(0x4253baefa252755c), W(0xf74b769e03f464b4),
+     W(0xdbb9cc942f7a9793), W(0x5c620c73e91727a8), W(0x487213d311de4c5d)},
+    {W(0xd3e4619b153ac643), W(0xa209323d97d28460), W(0x02f066771623aef7),
+     W(0xe7aa53a8cc5271ff), W(0xb369b72cf55c4343), W(0xd7c81084e10fe2fd)},
+    0
+  },
+  {
+    {W(0x96dd5e1ee67e37cb), W(0xbbf39ebb5f56eaa6), W(0x1734ad06dad55817),
+     W(0x807e0c5273900371), W(0xdffc00f60a78e60f), W(0x25015c204b8be576)},
+    {W(0x23b38f6c9825f157), W(0xeadf4c2b48b63bc0), W(0xc0513c15a98648b7),
+     W(0x9cd62385857c86e0), W(0xf0d64eea3c282a45), W(0x79c2ce1892c7f9ea)},
+    0
+  },
+  {
+    {W(0xd2fe52cbdcfb7bce), W(0xfd3ca61d829ca635), W(0xb854ec472231f525),
+     W(0x50afa0d76ad2c2cd), W(0xec0ed93bcc3b014d), W(0xaf0806c52844ff5d)},
+    {W(0xedda76a3fd904a46), W(0x864ff5af697abc5f), W(0x1683b9439f055539),
+     W(0x5739ecb69ef19534), W(0x3189625aa6c660d9), W(0x2fba1f105ff265e0)},
+    0
+  },
+  {
+    {W(0xb9806d596b9e544c), W(0xa6d894165ff9157a), W(0x3943c2c17be27fea),
+     W(0x08b6a4f052ccd631), W(0x2837e1c55507eb6c), W(0xed7a31e1bc0b126b)},
+    {W(0x95dc81bb3c66451e), W(0x6acf9fe07334ae1e), W(0xeec5542955dd17b9),
+     W(0xc97b35073bdc6524), W(0x90610b28a7bad04a), W(0x60fe3dc2614196b6)},
+    0
+  },
+  {
+    {W(0x1840f08019d38293), W(0x45a86e4783ecb374), W(0xa768053a9cd14e0e),
+     W(0x946ca13c16440e06), W(0xc63b4d3b987388cc), W(0xaad4f7df69d07a71)},
+    {W(0x3e5aebe208874a6d), W(0x384c273045d9a2f7), W(0x480022458e6c8cb6),
+     W(0xb3761cb9669577b9), W(0xdb63b60a0a374e8d), W(0xe75695cbbb6359bb)},
+    0
+  },
+  {
+    {W(0x30e683912873fc86), W(0xd2f49b842dda3ccb), W(0x1f09b34154239857),
+     W(0x261ea5d38008cd15), W(0x720cb3afe1bb0e4c), W(0x2f647f3c32aa5d00)},
+    {W(0x311e25805ae29f22), W(0x6776de8d64134f6c), W(0xed907f6d0dc9c239),
+     W(0xce463356f219681e), W(0x6bd0b840c4d3ea74), W(0x9757597bcb07e74c)},
+    0
+  },
+  {
+    {W(0x37d249dcf877b771), W(0x40ec062f53ddae00), W(0xbf8024249fa1b7d0),
+     W(0x95730de194ad8080), W(0x3b5c072488ad6926), W(0x1dcd39f53f3d3bcd)},
+    {W(0x88aa26daf4e617b7), W(0x65c67ba5c3a3e865), W(0xbc30425656c66ef1),
+     W(0x7daebbaef8aed198), W(0x957a80f6b5f307f3), W(0x4d03d508fcb613e1)},
+    0
+  },
+  {
+    {W(0xdd44ca2aaee12d25), W(0x5fbf54be032440e6), W(0xdec8a437e32bcdea),
+     W(0xb4b7cfcb5fc86183), W(0xaa69be7106dad630), W(0x911f73a4f9b0fd19)},
+    {W(0x31714785d8f6b842), W(0x94da5923618f4936), W(0x46a1747c46728970),
+     W(0xa41aa90e8b64dfff), W(0x4b5407c6faec43b6), W(0xef607127ad0514df)},
+    0
+  },
+  {
+    {W(0x015b7fca66b3c50d), W(0xe2b97cdb2750c116), W(0x6bc925bc458f2f36),
+     W(0xb4969eeb5d74c97d), W(0x74db24ce31621c22), W(0x80a93833f92872ba)},
+    {W(0x8a0f9b81e1f9b20a), W(0x6ee6be2198fccd66), W(0xfd09d3e76247451c),
+     W(0xb3cc3921776254f7), W(0xad5965dfdc9217e2), W(0x574709c0156605af)},
+    0
+  },
+  {
+    {W(0x2fa0bcf21ede4762), W(0x2b9bf77d82af3fd5), W(0x9a8f585e84dab34b),
+     W(0x3c07e109075047e1), W(0x94f88f794f8ddf5b), W(0x2130c5dff0ce96e3)},
+    {W(0xbec6a739b8ad50a0), W(0xdb56f4343309cb9a), W(0x4e0cb260b4665db9),
+     W(0x75848bdede09b7f3), W(0x701660f8ad84b37c), W(0x54091da432f7728a)},
+    0
+  },
+  {
+    {W(0xa90dadb8d68fbd6e), W(0x0c8d80939bc6efcb), W(0xbe053d12366868c0),
+     W(0x2bae527a51dea2e4), W(0xb8e975562fdb72c5), W(0x101fbabf868bcd29)},
+    {W(0xc5c0443e1eefe6b8), W(0xe7beb4b39165c675), W(0xdf0a334b2668951b),
+     W(0x0261193dd2c1e3d9), W(0x0f2e75459e4307db), W(0x91b6deced01ad7ef)},
+    0
+  },
+  {
+    {W(0x3ed52e3ee56f02f9), W(0xf41967b42c0917aa), W(0x6d6e751984c67ba9),
+     W(0x649be529a3032289), W(0x384f1126182baaca), W(0xbcb8991956dcf7d5)},
+    {W(0x9fe33ebaf19e0048), W(0x542c7861b8caeadf), W(0xc7f7326701df8b9d),
+     W(0x1f72ab628eab8eb2), W(0xd52ec75804b2a822), W(0x3404293523d92680)},
+    0
+  },
+  {
+    {W(0x318a5cdada88ff6b), W(0x1f4b49cfb4e51791), W(0x00ba2f6555d85f59),
+     W(0xcf839845757c2079), W(0xaba54a03664d8940), W(0x276dcfcaddae271e)},
+    {W(0x3da2a529e0230e95), W(0x0b9f1361ad68c004), W(0x7c57a27f6d3c28d3),
+     W(0xd25542ca369ae2b1), W(0x972ad701084e93b4), W(0x3d9b3df4c7c58e57)},
+    0
+  },
+  {
+    {W(0xddc71336b1c8a0e8), W(0x2e3c5f296a4f5b4c), W(0xa82ba8af848f25b3),
+     W(0x48512ae2470498cb), W(0xc3f0b52721d1195b), W(0x9f5b4ebf6c92862b)},
+    {W(0x605d70a8fe201fa6), W(0x989561e47aa50b96), W(0x104608ea2958d028),
+     W(0x476a9e94aaf007dd), W(0x5c0068cad9f8186f), W(0x54cf3c88e537d4a7)},
+    0
+  },
+  {
+    {W(0x2b4a99d906be6e8c), W(0x020a3767391e666e), W(0x3254b1a83d0611e9),
+     W(0xd1530f2a4af98840), W(0xa018411d38db3874), W(0xfccf79c24c62ffc4)},
+    {W(0x7a994a80b5e7aacb), W(0x88ca2d854e515aa2), W(0x1f5fa49e3a678e02),
+     W(0x04406cf3acf21626), W(0xfd6cf94dd98a7eb5), W(0xb472f263babcdfc7)},
+    0
+  },
+  {
+    {W(0xebb023badf761fd0), W(0xe93fad0cd241986e), W(0x02cbd418c6e7540c),
+     W(0xc0533e29a733af81), W(0x805d1c56f5055bf7), W(0xdff6a6e0098775e9)},
+    {W(0x0c6aa8c34a8b0405), W(0x1cf6dc08dc15d03e), W(0x7318b2317b5eae27),
+     W(0xe518c4661e577e5b), W(0xe4ceb8baa0c907f4), W(0x8e3ea86c6c1f0fdd)},
+    0
+  },
+  {
+    {W(0x0f294337828131a6), W(0x523961563c52f225), W(0x870660911c8835a7),
+     W(0x7dacc70c4f673561), W(0x369b68836d0e0364), W(0xc1e504768edae6d0)},
+    {W(0xbd018805fb49cfeb), W(0xd77a968f77e719f5), W(0x9e8846ac4775c9fd),
+     W(0x724d322ad132cbdf), W(0xe76b698418783d84), W(0x3c445ca090ed95df)},
+    0
+  },
+  {
+    {W(0xc25ad3790c85cc0b), W(0x5e553ba475a3df69), W(0x49055f9894c53300),
+     W(0x6b5a17c15dc55135), W(0xc88289499fb7d706), W(0x36c787ae97ab6822)},
+    {W(0x56c2449c46fd5679), W(0x79e9c80a9a556670), W(0xab1becd8fd595275),
+     W(0x44a5dfcbc905a3cd), W(0xbcd7665e3fa0ce96), W(0x9766c9f17473a4f1)},
+    0
+  },
+  {
+    {W(0x1529a56ed363f819), W(0xbd6b71680c663d9d), W(0xb393e652d53ddd5d),
+     W(0x3523b254f6f9f7fa), W(0x278d7220124883ea), W(0x65fbdeaa55b5837e)},
+    {W(0xb61bfa8d90ca7f94), W(0x3f9bbe76cd7cacec), W(0x265017e4626b4866),
+     W(0xfe9bce93165ff031), W(0xd19feb151ae72f7b), W(0xf49bb9b4420f3256)},
+    0
+  },
+  {
+    {W(0x5c65e17f0ea5dd7a), W(0x558c34118ce823c7), W(0xf317f5d0c314df9a),
+     W(0xa028bb4f32ddb855), W(0xb059c77fa85c57a7), W(0xadfbb525ea3a7e96)},
+    {W(0xaadc51e931325bcf), W(0x793cbb9163feed5c), W(0x33fe351efa2062b3),
+     W(0x77bafff2a14ba190), W(0xb2e0a8d07296386b), W(0xd9a1bb9f6dbdcaf1)},
+    0
+  },
+  {
+    {W(0xeb0b61d1282d6b60), W(0xbbacda5f7e00c3d2), W(0xe7cec1aa5a379266),
+     W(0x5b7d68333d4a0bb0), W(0x7947537a7da6d92c), W(0x44de64f800666c0b)},
+    {W(0x233634bb90aa0fc5), W(0x9c72f3055debe659), W(0xa764d98378292f2b),
+     W(0xa971f390bae33403), W(0x75ffe5382a1c6b06), W(0x79313d58a061a106)},
+    0
+  },
+  {
+    {W(0x5d42ff6c4cdf4cca), W(0xafd349423f0834d7), W(0xebd61116aee837b7),
+     W(0x7db40d15f651f0d5), W(0xb8bd2709efba9697), W(0x6d2f84c8acd68f76)},
+    {W(0xfa149b746caa29c3), W(0x904e35621eeae9c1), W(0xb1215232a7bbaf90),
+     W(0x9b6b1db109081c70), W(0x19e05c1a3ea094d1), W(0xb289c14310458002)},
+    0
+  },
+  {
+    {W(0xc1b2b62b6c2e7df7), W(0xc7c9832aaf068df3), W(0x4de3689dcc838e49),
+     W(0xddc0fddd21ce2040), W(0x5ca2e4bd868e1344), W(0x39cc8cba2b2aa615)},
+    {W(0x2ac03ac08f298f72), W(0x96e198bed7533f57), W(0x910e1919f695554c),
+     W(0x0e2ef0f587593d9f), W(0xcbdb72f2014c65b0), W(0x8818d97dc646b159)},
+    0
+  },
+  {
+    {W(0xc77d188bdb520c60), W(0x2e6621fafc8e6386), W(0x967025a58b1a9cb7),
+     W(0x2712b7e9bc2af3a9), W(0xef8f5b005f067891), W(0x85d51f88322656c1)},
+    {W(0x674dc625b4f34caf), W(0xcd53ab715e46fe67), W(0x56dfbdd11e92d105),
+     W(0x86576713344e8fa7), W(0xb964e3062a839b6c), W(0xc2225bed98ada539)},
+    0
+  },
+  {
+    {W(0x9e18f96b7498ee7e), W(0x0c7c71c1f71a3e81), W(0xf2a078d0d1e5bd36),
+     W(0xd3c1c5882c7f486d), W(0xb42b8bc0343116b3), W(0x582aeb9973c3bb40)},
+    {W(0xe928a4114d4fba7f), W(0x3c271d039fccd6f3), W(0xa81c8b390b9acd49),
+     W(0x2625134a951f0831), W(0x5184819d3c7b29b3), W(0x4c9e8cee1ff40f46)},
+    0
+  },
+  {
+    {W(0xf84c3952b62196ca), W(0x337539183c8a404b), W(0xadfab083583b3952),
+     W(0x41c916fd371beaee), W(0x06b8ac001650d1b8), W(0x3345233b66e32185)},
+    {W(0xb2af32014f635660), W(0xd968faea6c872dc2), W(0xa0aae3f28da07139),
+     W(0x190093c1330ab8ea), W(0x6353fbdf89f9a4ec), W(0xd91c993ada3cc562)},
+    0
+  },
+  {
+    {W(0xeec0489b8307fac3), W(0xf57dbeebf88e3597), W(0xc5b80318247ba91b),
+     W(0x8360b2b30e194c65), W(0x22c5579522841b45), W(0xa1a5a285f38fbd57)},
+    {W(0xc691ef17060673d9), W(0x710921521d4b200e), W(0x70e14d88c69b75ba),
+     W(0x0b01c024b01acc17), W(0x693492bdaa56d092), W(0x3e98eac9f17cfccb)},
+    0
+  },
+  {
+    {W(0x9422cd4e09b9007f), W(0x779f055bdcbe43e5), W(0xa710a8b38e9b2230),
+     W(0x2a1ac2aca086c845), W(0x01b48481adba24b8), W(0x1d320fc2736afcb2)},
+    {W(0x566387138e554e0d), W(0x8223cb1258625be8), W(0x8cfed3c817a49bd2),
+     W(0x364968b509272188), W(0x3a06c02ac255eb01), W(0x77c418b453968b91)},
+    0
+  },
+  {
+    {W(0x7c173cf8aeca99de), W(0xc165605b7c5fa972), W(0x6633ce5ca1865697),
+     W(0xc222a8f39b5de006), W(0x31be1f23f19615b6), W(0x40db7f98b5597631)},
+    {W(0x0ec0c7268ab0711e), W(0x958a6d1b25218129), W(0x60fe268ed9336eb3),
+     W(0x9e157d108e512c11), W(0x635c8b0e265f9cc6), W(0xea0c79c3ce61cf6b)},
+    0
+  },
+  {
+    {W(0x37dd01034fdecb3b), W(0x25cc9fe79b6517c7), W(0x6d3964fd7014fc65),
+     W(0x896b5a3a5fab8c4f), W(0x81b3e998018a3dce), W(0x584281f770347f45)},
+    {W(0x14683e318d9e06a0), W(0x2975ed8842582139), W(0x04de7dec0a2d3fae),
+     W(0x10b0c7784ca459bf), W(0x6e2e022bcdb55785), W(0xfabdd9fb315e0838)},
+    0
+  },
+  {
+    {W(0x41ec1d46e8c2de7c), W(0x31a61cf8e7ccebc7), W(0xe55eededfa4eb0dc),
+     W(0x51c8b6aad06f5519), W(0x0f77ab527f19245f), W(0x84514b39db4d6310)},
+    {W(0x2817ae881cf2ea4e), W(0xe91f4032f830e2bd), W(0x57ec50007ca2d12e),
+     W(0x84729d460b77887c), W(0xac5afbe26641b9d3), W(0x30daf3b7a9fc5a1b)},
+    0
+  },
+  {
+    {W(0x242148b5fde84e2e), W(0xbec416c284943bc1), W(0x57104e128a63a120),
+     W(0x03ad18037a85728e), W(0x372170e7d8c2b02f), W(0xe55922c6bc719dae)},
+    {W(0x2eb04f66daf2a764), W(0xb221da1a32dfcf7c), W(0x0b4c67b973b0c183),
+     W(0x8984a42d9a510001), W(0xf62b957fd4a857c9), W(0x124c293b741df80c)},
+    0
+  },
+  {
+    {W(0x66e78368ff9df422), W(0xceecafb9ca14478e), W(0xade12082a5728aa9),
+     W(0x849559c1266c2f30), W(0x5d4da3de13516e24), W(0xe52b6d651fa6f682)},
+    {W(0x5935fcb13a012bb0), W(0xa0fe9d002c50d89b), W(0x2a432cfcf7eed1e6),
+     W(0x32827bc16467e33d), W(0x6545b57b1ba441a9), W(0x3e5e5ad5901a67d8)},
+    0
+  },
+  {
+    {W(0xeb95c8333d2f9059), W(0x3aebf6dd0572f239), W(0xe038053555a00226),
+     W(0x6e3cd09d4099a1c9), W(0x5eb7824e0d770c01), W(0x545ee446877d45fb)},
+    {W(0xe39cccff596a8653), W(0xdc48adc2f8f389fe), W(0x8dafb41d3af5fe35),
+     W(0x93ce46a415e650bf), W(0x204829ae93110a0c), W(0x9b18e99fdf1b7a4d)},
+    0
+  },
+  {
+    {W(0x025418e266fdf8e6), W(0x361773e95ddf1c45), W(0x14608d6cafe08d8e),
+     W(0x5442d4804805fa8f), W(0xee2a53617e090d92), W(0x43251cf4503076bf)},
+    {W(0x3154d536cae71c04), W(0x36e50eb8f3237c44), W(0x47b0bb3548c7bd9a),
+     W(0x08c7c33f009e69b0), W(0x834f90bc53174922), W(0xa6d80306962a1992)},
+    0
+  },
+  {
+    {W(0xa7fa2a0817df8356), W(0x25545c66140f9bc9), W(0x7518a3b06a2b924d),
+     W(0x5baf918f93e5ef25), W(0xc0d134cc8c6fba4a), W(0xd822ced9503dda65)},
+    {W(0xdcba25ed51192317), W(0x12dc0ee368e19666), W(0x271e1c6bccd1aa92),
+     W(0x23a3981667a67c56), W(0xfb1dad36d2a7a14a), W(0x2f1bc250b978cf84)},
+    0
+  },
+  {
+    {W(0x786f1da541a03408), W(0xceee2903085b02a6), W(0x0f9762af331547cd),
+     W(0x35f945845914d4e1), W(0xf6d2e2055292bf96), W(0xdd492220e05cdd05)},
+    {W(0x7c63661dee5b9053), W(0x49b9199593e53ad0), W(0x7f5f38dd8a32d5c7),
+     W(0x2d0e64075090ccb2), W(0x1642d3157fdce95e), W(0x148509039c17df0e)},
+    0
+  },
+  {
+    {W(0x6f2f8a39a30dfba4), W(0x66777f5dfb8a632a), W(0x3799f87266c7d059),
+     W(0x3534c2acd04077b6), W(0xe7c9c96e9594ff81), W(0xe46df6a2190a78e9)},
+    {W(0x56effc75c5113a56), W(0x685b13c87b9b034d), W(0x57de8953253aba23),
+     W(0x14e92287cd51dfcb), W(0xb5ed9de18e2d049f), W(0x6c4dac31565cb51c)},
+    0
+  },
+  {
+    {W(0x77940a191dcb32b8), W(0xc0fa98d4217822f8), W(0xb875bc08ac3f6077),
+     W(0xd0aade476a06e460), W(0x127c2d3baee4341e), W(0x955c27a8d266b6bf)},
+    {W(0xe1a807f008f32fed), W(0xc4b05fc993682ad4), W(0xe4b016a00890adb8),
+     W(0x2e09201044787f70), W(0x8d708fe8f0caa0e8), W(0xe2a3c35e98de4dbc)},
+    0
+  },
+  {
+    {W(0xc009d00f24aa3ec6), W(0x4e13d26e9a84ae67), W(0x96167edea40b3f0f),
+     W(0x54866c1af9d684cb), W(0x603b5da861a95366), W(0xadb4978e55b03a0f)},
+    {W(0x291673c3de7589fd), W(0x79c396a0420929bd), W(0x7b453bb521087132),
+     W(0x5ec16703c85cca09), W(0x5abf8a58c0e0a05a), W(0x6b05bad48924b5c1)},
+    0
+  },
+  {
+    {W(0xdcd7511ac94d9a0e), W(0x7e8a8b3e5bfa86f5), W(0x65c9d79a709f71c5),
+     W(0x7c72fad825c2683c), W(0x7c4209dd8fbe77c7), W(0xd637c67a9487bd1d)},
+    {W(0x63bfc868ffe52a4e), W(0x27bc46b21e88fbb7), W(0xffa4b0e76068d348),
+     W(0xbe0e28c253f644d2), W(0x551c3c94c6b1e53f), W(0x979c47da0ecf6fac)},
+    0
+  },
+  {
+    {W(0x680203a3f2878ebb), W(0xe8ee3eca25b12893), W(0xd224cb0e507ca239),
+     W(0x1524dd1957552238), W(0x0080c59111305c6d), W(0xce29b3c692027ae0)},
+    {W(0x151cbfb4a87d62bb), W(0x5e3c8e91f8226e18), W(0x2eab13ca02b52976),
+     W(0x2c59a7f83eecdfeb), W(0x9850c1ddcb2947d3), W(0xc70a8d60f3bbcab3)},
+    0
+  },
+  {
+    {W(0x03b473b9e61fa848), W(0xad60359ee4874c1e), W(0x34da04791467d2d1),
+     W(0x8ff293c1dec71fa5), W(0x27d1d2a66e1a9742), W(0x3ac1c5a8aa56dfef)},
+    {W(0x1087c4fa31e5dbea), W(0xf3d1ec6f4ada4508), W(0xa0b197817e20eb6d),
+     W(0x518142f14de4f749), W(0x3f71eb94d2b3df38), W(0x0a8c7709dce5a2a5)},
+    0
+  },
+  {
+    {W(0x2148ed59fbbb9edb), W(0xd8c51bc42247071d), W(0x3ab0c29d272d668e),
+     W(0x436ccbaa22e30f11), W(0xf00c93734a502e61), W(0x953c0ad926825924)},
+    {W(0xfdef9aedf324207e), W(0xc987ec274fb72039), W(0xd36df557dc3ac14c),
+     W(0x66cf36b88ae79daa), W(0xfea482faab7173c8), W(0x40934a707989cad3)},
+    0
+  },
+  {
+    {W(0x5311344618224645), W(0xb6e68190e33cffb8), W(0xc9c3a9dfdac68629),
+     W(0x5c04d32b6031bcfa), W(0x1a4bfebc02897896), W(0x95a9c6ae22b6b91f)},
+    {W(0x46f76c7edc50a7dc), W(0x7412a89e22aa7f82), W(0x9d8f4f02701401c0),
+     W(0xc4a6cb48815f6a4c), W(0xeb1855fa611b71ec), W(0xcb4eecfaed5abbb8)},
+    0
+  },
+  {
+    {W(0x18d432104d37196f), W(0xf0f496b8d404bdde), W(0x5b89424a3f5e21f0),
+     W(0x1f6b0eeba4d0aa1b), W(0x5b934869a44b37f4), W(0xa976fd658104b484)},
+    {W(0x7d86812a04f6bfaa), W(0xbeaa1614c64544f5), W(0xd767da93212357f8),
+     W(0xa0f80ffbdfc47fa3), W(0xf5da6f84e6b74359), W(0x612c315e5a885fc2)},
+    0
+  },
+  {
+    {W(0x622fd0edcdeb187a), W(0x71fb8f34f1ae4aa0), W(0xac1decfbf5b7a22d),
+     W(0x6e792493f003db2f), W(0x597b4b353fb842e6), W(0xf06dcf23aefad76d)},
+    {W(0x1cf2d62e3aa8cfc1), W(0xbb8113cea30bbd0e), W(0xb307aacf3355eded),
+     W(0xdc06c8077041a77f), W(0x63309f6ab61dda22), W(0xea502cdea487c9ca)},
+    0
+  },
+  {
+    {W(0xe5aac89ce9764fa1), W(0x0126e621f527aa2a), W(0xe6118e5165aa7cbf),
+     W(0xeb331ba44f6dbfd9), W(0x80d2edacf3b64a9a), W(0x1b05150a43b04428)},
+    {W(0xcb91cba400feff13), W(0x75df6cab611bdaee), W(0xc8036c044c4e30d4),
+     W(0x4ed91f54a426b5e9), W(0x698a80d5a8429800), W(0x6846cac3cd6e9ac2)},
+    0
+  },
+  {
+    {W(0xfab601ee58706de7), W(0xa1650a25b0b2654a), W(0xb51258c012a7ddc2),
+     W(0xc79e3451e0186ca7), W(0x6b2ea198e9443431), W(0x290646a494242556)},
+    {W(0x9ef3186237a36a8d), W(0x9d2499afe68391cd), W(0xd95a592cae4cf535),
+     W(0x8bfb73df0e8ff7a5), W(0xc781c612449a5ec5), W(0x87fce31de5700d87)},
+    0
+  },
+  {
+    {W(0x54cfe3879c5deae6), W(0x0ed19b4950240af5), W(0x6d0e7ee37ced63df),
+     W(0x5ab1fd69905bfa3a), W(0x4a6c2dcdf21fed9b), W(0x9519128fee77ad7c)},
+    {W(0x146db34e9a029ce3), W(0x35a5139784af51b1), W(0x407a05ed7d2d0d27),
+     W(0xad359537488eb59d), W(0x902ecf96dd2402e7), W(0xc53b5784b7319e8b)},
+    0
+  },
+  {
+    {W(0xa48d1d3cfb3a3e06), W(0xb1801e11331fea6a), W(0x2bd62f64e1b13389),
+     W(0x7c41407d49f26334), W(0xe1abc1265aadfb1f), W(0xab72fe13eded239b)},
+    {W(0x9dc7fea2e38511fe), W(0xdde6e831f13a993c), W(0x4ba8518df25a839c),
+     W(0x2506ba5b8ef781c7), W(0x03c9dcb61b47c639), W(0x5edb09c4e95828bf)},
+    0
+  },
+  {
+    {W(0x8afea4988c35b46d), W(0x46de870ecb461c03), W(0x3cac51a950881687),
+     W(0xa0687dca745f3311), W(0x6738206157be090a), W(0x426074188f31b40c)},
+    {W(0x1cfdf7ec7c578d5a), W(0x2af6ec4518543abd), W(0x716e6fe7b16103ea),
+     W(0x98516581af295a70), W(0x095d1e1a72459266), W(0xfa7a1cf631c40c55)},
+    0
+  },
+  {
+    {W(0x99d4fc83d9453db6), W(0x2c4f1bf074bd3b91), W(0x6ed7d30151fba1de),
+     W(0x7ed1875f85f31557), W(0xfbc3801da227c747), W(0x2231511435797ae4)},
+    {W(0xe85222c873b95f20), W(0x58cc7d5b0627d849), W(0x8d03739179a71c0f),
+     W(0xc0e865b4da5c6018), W(0xcfb1800a2ab99201), W(0xc2cd738d5841c3af)},
+    0
+  },
+  {
+    {W(0xaa2e6a264b9ab32f), W(0x17d92404de3e9158), W(0x19fd543b89ebdb45),
+     W(0x9410a8241467a717), W(0x5ff09511e796c415), W(0x284d19a51f4a758f)},
+    {W(0xb8cef214916b92fb), W(0x1a025646dd78a799), W(0xddf570aad9768647),
+     W(0x9c7016366cea453b), W(0x762fa02444ae2819), W(0x36ff91a7c825da8e)},
+    0
+  },
+  {
+    {W(0x732d9605a27fa687), W(0x5eebcfef76a66953), W(0xa764063f0286e8eb),
+     W(0x339a2401f5171491), W(0x4a1d5b1ea0ff1750), W(0xd97d24ebdff4f11d)},
+    {W(0xe52a7edf7bbf38f5), W(0x657cc47110d9360b), W(0x5c2a1aefedb46f29),
+     W(0x351f4de883757ff8), W(0xe81bea383cd76072), W(0xa1ef67235cf5bfbf)},
+    0
+  },
+  {
+    {W(0xc8c5d4eab2df481a), W(0xc848e7e331d3cd46), W(0xeaaa5ce7b5339730),
+     W(0xc7a31e398401f138), W(0xfd26b8aa6a201b1b), W(0x5801b505acc4c746)},
+    {W(0xf5b107cbe27941e7), W(0x4cab322540c48ce2), W(0x7f7b1b3dc50f3fcd),
+     W(0xbcb743d2a9e92135), W(0x44cf19f3512d2714), W(0xd9ee8bd45441bca9)},
+    0
+  },
+  {
+    {W(0xf938ef8bccbf917e), W(0xdea1b5516e45c950), W(0x84e06905261a4927),
+     W(0x3dd4bffdace7f665), W(0xc6a7b880f5eee1b0), W(0xb7d68d82a82df25e)},
+    {W(0x917cff4c64bd3658), W(0x0dc58db5b258ce61), W(0x886765e91aa812c3),
+     W(0x24e22527b5a0f5c6), W(0x5b30d32edff286ae), W(0xd42ed0713161dd5f)},
+    0
+  },
+  {
+    {W(0xfb9eff3d5c639ee3), W(0x443e82b7bf28537d), W(0xcec0cf0045d9beaf),
+     W(0x6dd2ee7b0357e871), W(0xb59806adb1798b81), W(0x6b4c256496ad29d9)},
+    {W(0x296341d9e34e187d), W(0x968980e26ae6b667), W(0x5bb215e3ee41827f),
+     W(0xa8a2fa604456a4a9), W(0x7c9d3ea54bc03ef1), W(0x73cc765312fb0611)},
+    0
+  },
+  {
+    {W(0x15ba66fbc81f97eb), W(0x8540f4a7062ccae1), W(0xc75530a9c51a937c),
+     W(0x6ebe50c83a3e5bde), W(0x0937420daa6068f2), W(0xdcee7de964f8e69c)},
+    {W(0xd04fc8e88ffbd330), W(0x952a3a01a2536865), W(0x11c29ad0db1d1b42),
+     W(0x5b62479d02b1183c), W(0x7e00ce514d8a770c), W(0x8894b9400b414580)},
+    0
+  },
+  {
+    {W(0x2f6335168f963f71), W(0xa1c04c17e85cb994), W(0x7308c99bb72d7e55),
+     W(0xbec8cc3d0caa69d1), W(0xe12be9b09f653055), W(0xb2754a8fba0b6ccf)},
+    {W(0xe2e5857f49cb332f), W(0xd79d669476e79474), W(0xcb3f7d07ab1e5f33),
+     W(0x216e139c75276251), W(0x4c54bce49c3d6210), W(0x7932131bb4d04c4f)},
+    0
+  },
+  {
+    {W(0x748a81c255cfbfa8), W(0x5bd21f5a7c7a1418), W(0x166b8da8a185dc7f),
+     W(0xc441011c75e4c92a), W(0x7fe3ce9c00b1fe10), W(0x4092ca428fb98939)},
+    {W(0x78e44232d52f5b26), W(0x5b16eb5c01e48b7c), W(0x9669d96c68e8d3f6),
+     W(0x9fdf4b61c30380e8), W(0xd2f861acc4c6dac6), W(0xa4919a4424cd069f)},
+    0
+  },
+  {
+    {W(0x49c71634927d2737), W(0x096568423d045c45), W(0xba21c4117473dced),
+     W(0x591ed34c9262c5ea), W(0x42733a9d0e42f380), W(0xe79d06957f5c4950)},
+    {W(0xc040aa3dbdb74844), W(0x8216c181626050bd), W(0xb1681a088150f10b),
+     W(0xc1728297c2de3a61), W(0x8e34445d20581fe5), W(0xa858d7ac1c180385)},
+    0
+  },
+  {
+    {W(0xd0a9bf7decd0c531), W(0xec83de2d0d033ae3), W(0x958256be00b69685),
+     W(0xcada36c02ff798a8), W(0x06b510c8b69527ba), W(0x05d3dda9b7580cdf)},
+    {W(0xc92b76fc0dc83e07), W(0x2b40d8ff8230ffb0), W(0x68cf779a873579d0),
+     W(0x33989e9de5aea3a1), W(0x469f8a0f71f30bef), W(0x89ffe127a0871453)},
+    0
+  },
+  {
+    {W(0x829cebe6962c0568), W(0x5945448a37507da7), W(0xe4379dba52cf7560),
+     W(0xaab884d86b264561), W(0x068f43a025c03a00), W(0x51a73dc8a790a1d5)},
+    {W(0xd22a4e2449121f2f), W(0xab930448e2383812), W(0xcb7258ba36b9d335),
+     W(0x5b951903e9215498), W(0xa11bddad2d45cfe4), W(0x0000a61a6e55e314)},
+    0
+  },
+  {
+    {W(0x4203b758e3f99652), W(0x856e7bd5b4f62435), W(0x9ea6ea0a991d4891),
+     W(0xda82a083683cca32), W(0x40039a13f0ea82bf), W(0xc7095d99d76c5796)},
+    {W(0x360d212bf02b116e), W(0x0ec14db9d88e3db1), W(0x949f4ded51188e31),
+     W(0xb74d7715d3898306), W(0x51be6b046ee149df), W(0xeae1098493a0d6b0)},
+    0
+  },
+  {
+    {W(0x914294ec4582fc98), W(0xb9e75548c3e79e98), W(0xb02503db6659a8b2),
+     W(0xac2f8ecc8e88220c), W(0x2b7e4386890ab091), W(0xa94375f49c1fca85)},
+    {W(0xec99f44bb1e1b8fc), W(0x82d48857696cf2ec), W(0xa0db887de801856d),
+     W(0x3fb0e4b0fa713026), W(0x16326e4e39ac3731), W(0x670c7ac496d82ddc)},
+    0
+  },
+  {
+    {W(0xcce33d800307d3ba), W(0x92cde2a9b66a214a), W(0xae87197f6cd96a73),
+     W(0x3def92aa7c2031a4), W(0xa23b5e0f7d6ac8e7), W(0xd88fc8b693d8e588)},
+    {W(0x9f77c13b5ee4ffca), W(0x5896a7a7bbb04efd), W(0x1b233087af8a01ca),
+     W(0xd58b401de9974c16), W(0xeb01ced5f0a9932f), W(0x050c491cd2542905)},
+    0
+  },
+  {
+    {W(0x6197146ceb8537c0), W(0x401ede0f49b80fa0), W(0x3c0c336e80c42add),
+     W(0x9eb0407eb1c6244c), W(0xda955bfee1701f9e), W(0x8330ce227ffec107)},
+    {W(0xdcf82c5ff7beabc4), W(0x376514258a453257), W(0x801ea01245b238e5),
+     W(0xe18a8d4039e3e010), W(0x71af169eb5c99f9b), W(0x93c88809bfebb46a)},
+    0
+  },
+  {
+    {W(0x584b68da7ebcd229), W(0xed0073688ac61a4e), W(0x26991da0456e82b0),
+     W(0x24de2256206bdaa5), W(0x233fc395019b1fe4), W(0x66df7d22826ab449)},
+    {W(0x6c4743a30b4d884f), W(0xc68575e9c6557bc4), W(0xbfa048060a2859c2),
+     W(0xf5783612fde6c5ac), W(0x293a38bbdceebe65), W(0x677a3546837ddcd1)},
+    0
+  },
+  {
+    {W(0xbd75d02094192cc6), W(0x707cd9ae143b5411), W(0x57b0e563fa280c28),
+     W(0x3208416bd6be87b5), W(0x0e658b8802e6787c), W(0x0ac77f35edaf7690)},
+    {W(0x5a0388fb48aa0b1f), W(0xc6ea923fd1575cae), W(0x58b18afa17a1a33e),
+     W(0x7e3cb3ef225b413f), W(0xdff2ffb531c21300), W(0xf0c1493f11d47ce5)},
+    0
+  },
+  {
+    {W(0xfa540aea186f2925), W(0x5eab42c873b61a33), W(0xeb367cabe49fb3c9),
+     W(0x783b855e426a309a), W(0x6a5d441fe12d39f2), W(0x0d71c27a41e63df3)},
+    {W(0x5e9d6ffd1744151f), W(0x3d705838e314b080), W(0xdaa34c2d0331692b),
+     W(0xc53143559ed7aa91), W(0xd2c02648c176676c), W(0x1fcfae0fde72f708)},
+    0
+  },
+  {
+    {W(0x1a34a1dcd1569488), W(0x4f5fa7a36acf23b8), W(0x8486964bc5b7bac2),
+     W(0x03a7035376115f44), W(0x2b101ead1f5edd87), W(0x29e921204f12c3c0)},
+    {W(0xfc1ec472be46e0a9), W(0x7d2238c1f809067d), W(0xaf2eaab5bb848f7f),
+     W(0xea985b715ce9001f), W(0xb9bdf5cf61eb197a), W(0x9bd8aba91a381d70)},
+    0
+  },
+  {
+    {W(0x5e8ecdb55b3a0101), W(0x02a253bc763e5d69), W(0x7bb5aefae51fca0e),
+     W(0xed4f5154f50676ab), W(0xf09ff7832fa9d52b), W(0x1255ea331927e38a)},
+    {W(0x80cb639a8ff34c57), W(0x89bae407535e3584), W(0x7524aa6c1113d1ce),
+     W(0xe4145baf6d15fe93), W(0x369e6fc09352ab73), W(0x66dc5278afe35c68)},
+    0
+  },
+  {
+    {W(0x8759f935b8e94e78), W(0xbf048ac95c09126f), W(0x8dd1c6111fd08535),
+     W(0x9bdd8e1e8e4fc624), W(0x47732faeadb1d075), W(0x0fe517ecb774a277)},
+    {W(0x36627a3934607ec8), W(0x88558326a94ded64), W(0x2c233c3439869dd9),
+     W(0xa243cce9aa66b493), W(0x240f6393a1f50b53), W(0x586b895df9598c33)},
+    0
+  },
+  {
+    {W(0x3114232ee95bff3c), W(0x9ee10cfdac5677a2), W(0xe29e943c2bcdd749),
+     W(0xe20ea10f2698012b), W(0x6c84729b3fb26ca8), W(0x7fe43b72e4459447)},
+    {W(0xd489272f09707ace), W(0x1ee41e841a040a60), W(0xec7ae6cafa30b643),
+     W(0x93d92206c87ee56d), W(0x87ff1675390f57df), W(0xadbfb2eefc479fd6)},
+    0
+  },
+  {
+    {W(0x5e1744dfeec1db4c), W(0x635763d43c4eb3af), W(0xa3e70abf8c825bf1),
+     W(0x23a2cbdb9a60522d), W(0x8df4d2ffddb92e6a), W(0x4c57218173d367e0)},
+    {W(0x68469ff09a8127a4), W(0xb5feb31c8430af3e), W(0xd7328f299404a07e),
+     W(0x083828f5cf56b24b), W(0x2372b3ed12aaa348), W(0xe86ca467335e21e3)},
+    0
+  },
+  {
+    {W(0x97bdd8b320f60394), W(0xfc338b5b135d87d1), W(0x3d05ce6e3488e53f),
+     W(0x5e63a880a1f91a22), W(0x2cc663dd4a6cb7a7), W(0x8350418875ca9723)},
+    {W(0x6d9eb03bca1f3661), W(0x6b162d0fd9b2af96), W(0xc73dc68d7052ccbf),
+     W(0x424569e4ea2a80e6), W(0x261e5675f9c1241c), W(0xcaf6385077efacd2)},
+    0
+  },
+  {
+    {W(0x6b9d6c65967b4f8c), W(0x07d4ac4b273d4823), W(0x298834118a553430),
+     W(0x49257ad7785070da), W(0x368061eaff4c5490), W(0xd6355c9dd94f8df1)},
+    {W(0x9f99493d244aa1af), W(0x1cb48b93bce6e64e), W(0x0aea76191f5a9511),
+     W(0x5858c859c0b2f9f0), W(0x258ca7a112745db9), W(0x079610ff591f3fe1)},
+    0
+  },
+  {
+    {W(0x8832f1d23e9a3076), W(0xc746f0189f5082d3), W(0x792dbcca76bc673e),
+     W(0xfecdf2f4b1567abe), W(0x91dc67fb508b091c), W(0x5b7145d53a4d0563)},
+    {W(0x542fbeec0ad38196), W(0xeb1c9dc562091fb5), W(0x51276c4fd702f646),
+     W(0x0741d236aa2ddf93), W(0x3c1ce2bcd7e6bc2c), W(0x42b1eca924bb80c3)},
+    0
+  },
+  {
+    {W(0xcb37555063cd6bfa), W(0xe5e7b7ff73c69837), W(0xa00769389d0d1669),
+     W(0xe28eb0062e36d984), W(0xb312772c690d9b7e), W(0xe25f09275d448542)},
+    {W(0xc3b4383476a06c6d), W(0xb5bda096edbd99d0), W(0x88fb4899c2c163f1),
+     W(0xe9399de55e84956a), W(0x35b7a5412125ac09), W(0x516536b4ce3fa3d0)},
+    0
+  },
+  {
+    {W(0x09f74245682369e1), W(0x6d95450b862ce795), W(0x9e2fe24ea5af777e),
+     W(0x131d41cc0aa0e95b), W(0xd7dfc588e8375bb6), W(0x013ca1cf2a07cdbe)},
+    {W(0x398200cd4866fd01), W(0x858f0eb83315bbfd), W(0xf25c6d746a0f5d78),
+     W(0x3c143c122df905c4), W(0x7446d3d7a6499712), W(0xf53c4ef6172ea5fa)},
+    0
+  },
+  {
+    {W(0xc4ee7c44958a092d), W(0x731c2534fe20ac33), W(0xc55be869f6b69861),
+     W(0x331b0a65464789b2), W(0x7da3a9fa381dd2a1), W(0xf1f2d0a18385f19f)},
+    {W(0xdcfa60d2ca14e09f), W(0xf819f24fc208c926), W(0x4554c789c74594bc),
+     W(0x7ebe6cee7dd31aaf), W(0x23da85259b23f138), W(0x0885e7fec8b0f268)},
+    0
+  },
+  {
+    {W(0xda06bc0c57ad4fbf), W(0x41122b484ea3995b), W(0x34ede1d5599b7a1a),
+     W(0xa5bf53aa0700ff66), W(0x80e23a63accccc21), W(0x4f0c7c2a73b061c4)},
+    {W(0xb05fd8b5a4d0a030), W(0xc068a9a4edbfcf5c), W(0x5e16a55e25145f29),
+     W(0x7a491392de8484db), W(0xe914b610f4fb9ab9), W(0x34c3b777fdb70f6d)},
+    0
+  },
+  {
+    {W(0xe948aaaa43a524ae), W(0x5f688178333f5268), W(0x6ce15317ae3ec62b),
+     W(0xbe516e8fc4f8cda5), W(0xa105011b49c6731f), W(0x1a61f8100ebb57de)},
+    {W(0xca89b8befe665b95), W(0xa84d9f2003782b6c), W(0x5a82ce4a0a28ce2e),
+     W(0xced32d8c1044f554), W(0x3d9be9df466417ce), W(0xe9fa11ef25e4445b)},
+    0
+  },
+  {
+    {W(0xd79061ae45051c83), W(0x6cd9c09a9f16304a), W(0xc04bb61dd667f39b),
+     W(0x8651a69aa832b968), W(0x14aef5a77f211be2), W(0xe88baa97b98700f1)},
+    {W(0x25891001d4ec624e), W(0xc15c0693271b1aa2), W(0x169f12502a832bdb),
+     W(0x08f84f437671e114), W(0x0500c2d8f976b380), W(0x5876ed0fb678310f)},
+    0
+  },
+  {
+    {W(0x2dd15887bb494962), W(0x690645e585955501), W(0xf76ba6a757faecff),
+     W(0xda03ba65051181a4), W(0x0f9fe84ac5e7f18c), W(0xb1b42ea95c526f6b)},
+    {W(0x743fa5d5ab5ba5dc), W(0x183a248d238691c1), W(0xa8f0311386d0f6d4),
+     W(0x00fdc37daf59a4b7), W(0xd9697b3bb02e4311), W(0x1c793330eb70a95d)},
+    0
+  },
+  {
+    {W(0xa4d376c34aa31823), W(0xeea6dcbb846b7905), W(0x6476eceaad208b5a),
+     W(0x4f7138171fcbd0d2), W(0x4cc38b283a4d9ad2), W(0x6bca5606fc413909)},
+    {W(0x105246e3eb4e199a), W(0x4d868e52be278c45), W(0xbb368cfd5e34f0b8),
+     W(0x0f9edd844772a2a8), W(0x118ae471136e8195), W(0x1d9848d0c8d683be)},
+    0
+  },
+  {
+    {W(0x8d5881c25b68f7bd), W(0xb5b375ce87271a85), W(0xf2dfd66fee605af6),
+     W(0xc265ae927d334206), W(0xbd4adbdfd6907f79), W(0xfd84d7759a4ef719)},
+    {W(0xb2c46ffe836b7bcd), W(0x2eb1001c274a9ec3), W(0xae08f84e4d37d15c),
+     W(0xadad0fabd805ef80), W(0x69df95eb30923fa3), W(0xb0ad67a3464067f5)},
+    0
+  },
+  {
+    {W(0x1367a05576bea1c9), W(0x2b4202e2d5f2cfac), W(0xb8eec2895d7212f0),
+     W(0xf3e4776621715179), W(0xdcf5194a535f4439), W(0xe266f9ac703dc7f9)},
+    {W(0xdeba35a89dd71542), W(0x56f8b5576d91b5ec), W(0xebd01b410b0b6ece),
+     W(0xab5e629429a39071), W(0x10a42cb7336832de), W(0xdbe685694ce4ea7e)},
+    0
+  },
+  {
+    {W(0x1f1c5a04a48cfdf4), W(0x64384250d13cd5f1), W(0x9355b268bbac6e18),
+     W(0x11c1016d7848840f), W(0x69eb9cd33199e2b2), W(0xf5aaeb438be39764)},
+    {W(0xe3faa59df7d9a42a), W(0x2b433e8bfb8afe07), W(0x4d6a05d0b8afa396),
+     W(0x948bf162d6171c24), W(0xa9f7bafbf2250f0f), W(0x7002fcf6fc15fa93)},
+    0
+  },
+  {
+    {W(0x7ea6b0a4aea8b1e2), W(0x55712fb8390890f6), W(0xb9ec41989a5adc41),
+     W(0xdc1b46ab282a0cbe), W(0xf276b7052fa9c98f), W(0xa9cc7ce8e0ff51cc)},
+    {W(0x6b7c9c45c337f8a1), W(0x82eead5c08b9e9dc), W(0xb26e73bf8ea1c0aa),
+     W(0x1802ad81ca8df16a), W(0xa52260db63ab91d0), W(0x9eae502e83ba673a)},
+    0
+  },
+  {
+    {W(0x43defa59996558b1), W(0xb620a868627ad00f), W(0xcda225251b436231),
+     W(0xf2d81c20d3492719), W(0x555b988a9c546463), W(0x222b04af5e5326bb)},
+    {W(0x633a965f1b4d4062), W(0xc12d1b2ba7f60cff), W(0x9efd48fe9c693f79),
+     W(0x0b59680f10f995db), W(0xe871acf73cb13ce4), W(0x938acc6c7945f4b3)},
+    0
+  },
+  {
+    {W(0x9c02d64fd025c8e9), W(0x48b1606a4118a5b7), W(0xe6152296a5aeb889),
+     W(0x8294dd20410e8fbf), W(0x2972397e50901e2e), W(0x8574194eeb4011ae)},
+    {W(0xb5244c59d5c7f01c), W(0xfc91bfd094df6420), W(0x27b6d39050cbe126),
+     W(0x29c7b1c65d7bad31), W(0xf0d1405e1efe7f1e), W(0x2d5b933383877e06)},
+    0
+  },
+  {
+    {W(0x059bd2f078f4c9cb), W(0xf315d99a3471123e), W(0x7e8bda092f8a4c5e),
+     W(0x9759085058647e14), W(0x1ec5289d8aa73534), W(0x591dd6cf068a5ea3)},
+    {W(0x24e81dfbd165033d), W(0xb9ffd73f366ffbe9), W(0x7b89e6e8da9e44fb),
+     W(0xb33c973c0ac43cfb), W(0x071e6491f95a453e), W(0xccfb30e1e6193e46)},
+    0
+  },
+  {
+    {W(0x806a2c60683092e2), W(0xee0bf06aa47e6b94), W(0x213fdf6f539d6795),
+     W(0x08a52b019909593a), W(0x76961b68dfea865f), W(0xcbc0e79170087ef8)},
+    {W(0xa3f0892a2221cc55), W(0x902867a584172b77), W(0x54aa77b74094bff9),
+     W(0xb71052e7fd081dbe), W(0x9aace190e4c429aa), W(0x6ee8c7e186c3dbec)},
+    0
+  },
+  {
+    {W(0x6182d86a24a2caaf), W(0xd27e4a54fb16eac3), W(0x924d93ef356e01e5),
+     W(0x0dc76eb0425ed55b), W(0x4bb41248b52a18d2), W(0xb3848a7caa3f1ad1)},
+    {W(0x6ffd9259105485ce), W(0xd4a318a0bafc120d), W(0x278d1edc8962c0c0),
+     W(0x15615306dbcf49ac), W(0x724d7ac7877702ea), W(0xf21b2e8cf348a977)},
+    0
+  },
+  {
+    {W(0x86e7e06f2ee3b0a2), W(0xa3c5911c02775ec5), W(0xad9227dc6359053d),
+     W(0xda9c82fc67ae2cf5), W(0xadd667d40e3a209b), W(0x9187bdff0f61458f)},
+    {W(0x417f9dd94d7dc34c), W(0xb15435fd7510848e), W(0xbe533ae40737e25b),
+     W(0x323512dc86638ba7), W(0x433e113532719852), W(0x4b3ae1c2e821193f)},
+    0
+  },
+  {
+    {W(0xa210f9432313bf6a), W(0xe1841358d5a2b78b), W(0xef7ef2286a0968e4),
+     W(0x551582c5819f614f), W(0x4fe195f46983747c), W(0x15f2c43481aa7991)},
+    {W(0xd2c27ca275d29cd3), W(0x934a516b9c2bb063), W(0x418bc43b25f7508a),
+     W(0x47fa3d8711e0f086), W(0xb9994494270b117e), W(0x1b5fbeca1c4f1de2)},
+    0
+  },
+  {
+    {W(0xf42f9f0d32fda6ee), W(0x229d78973c54448a), W(0xc31fbaf4ab15604b),
+     W(0xb5f27fafc450ccc3), W(0xdbed35b9dcbf94be), W(0x8b79cf2aa378f1b9)},
+    {W(0x9ce48b57f5004ba8), W(0x86be709c26d9fa2d), W(0x72a59710d8ec64f3),
+     W(0xdc8b4141f6437a04), W(0x59f678f555084f74), W(0xcfa6e2759ca88202)},
+    0
+  },
+  {
+    {W(0x1e9ebfc1be001fe6), W(0x8849a5afbf7af49e), W(0x926a4337ed138971),
+     W(0x8c0c8d7dc0f2e717), W(0x8fdc02546b72be6f), W(0x7b067aa6753c42ed)},
+    {W(0x217b5174a1767d34), W(0x46cb00bf82390e25), W(0x03e96ee9a27926cb),
+     W(0x111ad401beb3932a), W(0x83f167d5fd33373e), W(0xb7f9add9aedcb145)},
+    0
+  },
+  {
+    {W(0xe076a3bc556b41ac), W(0xdf1b6f09daa3a398), W(0x93fc534116ee82c9),
+     W(0x7282ca9d22f6e798), W(0xe7f1484055707b6f), W(0x80507b4dc2997982)},
+    {W(0x753cf37a120b9d42), W(0x739c4720b5365085), W(0xa0aa9505d25679f8),
+     W(0x5b0197e7d3e4374c), W(0xac65c8ac7bbd5244), W(0xd225bb6e609e65b7)},
+    0
+  },
+  {
+    {W(0x2d705e2c49b6cf16), W(0xb9492be855972ac1), W(0xb43756414aed795f),
+     W(0x20f5acbc926a3ea1), W(0x52c6524ce96b16fa), W(0x6ac6a8f95d906509)},
+    {W(0x701b64a7ff20ffe4), W(0x66bb9e82767867c7), W(0xf9e13f7a6a5c1e7c),
+     W(0x17426454f79fbb44), W(0x89373b6efecc0ffb), W(0x325bd1d8ff7e5171)},
+    0
+  },
+  {
+    {W(0x33e109cc68e72f04), W(0xa8824165ab39fa6f), W(0xcd58724862030e93),
+     W(0x6026f47b77eaaa35), W(0x9bcc5b557017032d), W(0x4978b51347c25a4a)},
+    {W(0xecb351447d0d4fcf), W(0x7c5e3483a6e6c987), W(0x91bff8bab141c1a9),
+     W(0xfbd795b1aa9314de), W(0x1b8c05bce8f6d0ff), W(0x946972a1af93ebbe)},
+    0
+  },
+  {
+    {W(0xde28eedbbfe1cad1), W(0x9e011613c2a2be9f), W(0x551084c6d083a91f),
+     W(0xd7b4ac8a8d366c4b), W(0xa6ef44e4b0b55bed), W(0x878681868052fda5)},
+    {W(0xf93a94570a8c1ed1), W(0x6e8fa92a4a4ac5d8), W(0x57aa657d00af30c5),
+     W(0x4258261b17cf18a6), W(0x48d672c6e0fd126b), W(0xee93e4d6b4f058f7)},
+    0
+  },
+  {
+    {W(0x70f55eb6d33697a1), W(0x7c0622ded3ad2a96), W(0x4961c8ef4f7a1dc0),
+     W(0x96a18890eb528dae), W(0xa79287be2955b61e), W(0xffb77e5d8fe080c4)},
+    {W(0xba8967af449ea0ce), W(0x29c03b8da3200a0f), W(0xf0f250b3338d5f1d),
+     W(0x257bfd11608d719b), W(0x4581bd3fabb9eb43), W(0x4750376ecdfcc8e7)},
+    0
+  },
+  {
+    {W(0xeb190995ab3dd998), W(0x9992d8c12c0e03cf), W(0x0fc08ba97d2ceb84),
+     W(0x1c37bb92c38c0122), W(0x8c0d2400c6e9c346), W(0xacd09f25a3d27852)},
+    {W(0x8eac190f0f26eed9), W(0x69b39327a06f8402), W(0x9788cb4ca429d6fa),
+     W(0x3ba24ed2d08477cf), W(0xb3214fbdbb4890d6), W(0xf7cc70a48281e5c7)},
+    0
+  },
+  {
+    {W(0x5e3eb0dc23392837), W(0x3bbe841fd097001b), W(0xa40646c4b152a685),
+     W(0xed058cbf96be9741), W(0x625ad22c5eddc6ad), W(0x4b84c963d86c22d2)},
+    {W(0x4d82babf312cfa81), W(0x83a254a3228fbb44), W(0xa4107027d2ce2315),
+     W(0x12ef3e3d717e00be), W(0x7e3e6d7c50045fd6), W(0xe1c63371c21d291d)},
+    0
+  },
+  {
+    {W(0xa6bb89b715f1a04c), W(0x629f3e258fae1fe8), W(0xca9e5a4c4d89c7e4),
+     W(0x35a7091c35563af1), W(0x89332ddc23ee310b), W(0x12be67f6cc31ea3e)},
+    {W(0xdf01ee617e9bd747), W(0xbadac716bb6afec5), W(0xcd07156cbf04a963),
+     W(0x6c493dadf4c692ea), W(0x440fa16febb942ff), W(0xacafc552fe7218de)},
+    0
+  },
+  {
+    {W(0x8332ae3acc1cdddd), W(0xe7f4a2ffb6290380), W(0x6b72cdd5f5277124),
+     W(0x092696d279e4a76e), W(0xc3a813ee585ba500), W(0xb32f642994f1b3fe)},
+    {W(0xee09b1ab6a0da47d), W(0x076861d86d4c83bb), W(0xd6c8668094d707c6),
+     W(0xf2956070a2f82e9c), W(0x70aaf0cf9a764ad4), W(0x2a1a19663190ef15)},
+    0
+  },
+  {
+    {W(0xfccf3389dbbfc31e), W(0x6116868e35559f94), W(0xeb34d3f2ea30b5fd),
+     W(0x52adf10cb7049e30), W(0xd741e2a1ea34f6e8), W(0x9273ac2b5a9fe829)},
+    {W(0xe0c9675758d10a01), W(0x5cf4b5b8f9509a66), W(0x911137b4d6d520ff),
+     W(0x1b28eac27eafc55b), W(0xc7c453d981cdeefc), W(0x1d62c49ca61ced7a)},
+    0
+  },
+  {
+    {W(0x5f03dd1f43ddbb3c), W(0x5b48aea1c5218038), W(0xbc25dfb2ca6e5c20),
+     W(0x8fbee69ddba8efb1), W(0x78c6d905c58c2ef8), W(0xff8674edeeac7d0b)},
+    {W(0x15a2eb711f66eda8), W(0x6620360019345955), W(0xe017b86879592258),
+     W(0x46c7b2c50efb7759), W(0x1bb44691d7dc3eda), W(0x24ebe533207cc560)},
+    0
+  },
+  {
+    {W(0xde264f8a85613ca3), W(0x9c7a0ba1c71c32b9), W(0xbe755b7074a4acca),
+     W(0xeecaa9295e190712), W(0x17a499d84cadffd2), W(0x9a68ee8cc56f83b8)},
+    {W(0x2433c0f774967141), W(0x3d99bbb4942a0b79), W(0x7624daa6135ef214),
+     W(0xb302f75cc9576354), W(0xeec2c0ec422b7588), W(0x9eb8c890793228db)},
+    0
+  },
+  {
+    {W(0xfcfa6283cf391e83), W(0xde5acbb9175ff902), W(0x0eaecab69157faed),
+     W(0xbc533c41a1519cc7), W(0xa4f6ea2b01133de0), W(0x0284ed4c2ce3d5eb)},
+    {W(0x0c99ec7225295ee8), W(0x63687d75b9fc2a6f), W(0xd62d41d7a0cbdcce),
+     W(0xddac45f77195374a), W(0xb4c2b569a916be81), W(0x03fa508899e1f62c)},
+    0
+  },
+  {
+    {W(0xe2b93e7a826cfe2d), W(0x58aff4339cacf425), W(0x688e23653433a742),
+     W(0xc4dbbaf42574235e), W(0xff96bdce0dbe88bb), W(0x8a4717b288d7079c)},
+    {W(0x1b952e0ae92cf7d1), W(0xc5da38ef3e47fc98), W(0x72c72b42d4a550e1),
+     W(0x14734a7cb8a89e25), W(0x14f072a6e35936a9), W(0x2619d17f1d2ec847)},
+    0
+  },
+  {
+    {W(0x2e20bcc37c61466f), W(0xf070809d53340aa6), W(0x292c0c53eb989955),
+     W(0x3caf43dc49244b18), W(0xf02799864c8c1a98), W(0x08f5c5ceab390f7a)},
+    {W(0x44ad317f451c49b5), W(0x81ef04c1caefc457), W(0xb6c5ba38278d7a43),
+     W(0xfd2ee0dfae1ec2f0), W(0x0e0d01c851c22724), W(0x9b0e524156aba963)},
+    0
+  },
+  {
+    {W(0xab14959d23ffb71f), W(0xdadefdc49e9df5c9), W(0xab5014b5bd62b929),
+     W(0xe5e433e2dabbeb28), W(0xc3da585eec2640dc), W(0xa5fb1e77dac11e4d)},
+    {W(0xe84f63ffca50210e), W(0xd68f4103001fbc17), W(0xf9fdae4053038336),
+     W(0xbafd9f7da7ce03a0), W(0xa44c9d2773262628), W(0xc4f8c3aae92945be)},
+    0
+  },
+  {
+    {W(0xeac4101bd1c2393f), W(0x03b09c2fe5816257), W(0x6e3e2d00172417e1),
+     W(0x0bdc21ce0e8865fc), W(0x398837b79881f312), W(0x01c565a3fd923081)},
+    {W(0x45f26385a6dece8b), W(0xe11bd0a48d7c6f25), W(0xcb1668da558bdeb2),
+     W(0xc35fd7e496da685d), W(0xa85c3b66528fc7ac), W(0xde8ef19affa8eda4)},
+    0
+  },
+  {
+    {W(0xff7337c0217aa76e), W(0xb4265dea64d9503b), W(0xa5c76ea492753ace),
+     W(0xab563c9da56c88b5), W(0x19f89a49c618f251), W(0xfb2a017efa96c428)},
+    {W(0xe010c4b56becc098), W(0xb88b894986316484), W(0x5f672a6a4a46d764),
+     W(0xf110c2c12d46cb87), W(0xb92ef92e50ea64a5), W(0x6974c93c20e86e76)},
+    0
+  },
+  {
+    {W(0xebfc834a38b8bfa0), W(0x0e355443b49fbfcc), W(0xcc96a76ab932b5a3),
+     W(0x5c02ba79de45380c), W(0xb428055fee30d710), W(0x6c2eed3e39256cba)},
+    {W(0xdf063e946c2a16dc), W(0x42fdf59780ab0cf8), W(0x85fe767e03cc6e1e),
+     W(0x646bf58650b2e2cc), W(0xca6093f80dc101d6), W(0x82279abd5e914b66)},
+    0
+  },
+  {
+    {W(0x4fab35cd0c10c6ef), W(0x31d554236772facf), W(0x7dfcaf48ca92c7a4),
+     W(0x3a8de1f1ff98c2fc), W(0xfa910a5a3be0cbfa), W(0x4bf8d0d1efd2c2b1)},
+    {W(0x3b2a6ddc1962bdc7), W(0x9f3569df25bbf7de), W(0x1f3abfc06e99c9a4),
+     W(0x46a28d6a79afd402), W(0x71bee8af17c448c4), W(0x5b4499705210526f)},
+    0
+  },
+  {
+    {W(0x92858a02e0b6f8a9), W(0x95fe40d312ccb320), W(0xab517bb6b7273284),
+     W(0x258bb0263f519b69), W(0xad95f82f2ba87506), W(0x984a95e265736f07)},
+    {W(0x88ed47d31adb242a), W(0xd03ca822da239f8b), W(0x49a46dd73fff22f7),
+     W(0x592449d41e7ff80a), W(0xcc59130caa09f579), W(0x0a95f9c90a6d73f9)},
+    0
+  },
+  {
+    {W(0xa7bd9e81c61d9000), W(0x21a33b4539c5a8cd), W(0x6855f7c6574ce7b0),
+     W(0xc4f97f7935b0c358), W(0x9985eef4a09ad244), W(0x30fd00d7c7bfb059)},
+    {W(0x9c456f9d4b8a3b68), W(0x15b394a0fa2ad24b), W(0x15b0a16a031ad2a7),
+     W(0x68513f7c706d9ff4), W(0x032c2e635ff2866c), W(0x540b1ca31564a0f3)},
+    0
+  },
+  {
+    {W(0x5b3cf90f8dbd9b85), W(0x52d0120909519f8b), W(0x28c0a0cf8bb574a0),
+     W(0xa88a0d96a02e924a), W(0x9d165962c0e225af), W(0x3a31ca5c7a0b9d6f)},
+    {W(0xbfdd63d60044089b), W(0x13843451eccf8db1), W(0xda8258e9760ef26c),
+     W(0x83b854774131825f), W(0xea124a193f030ac7), W(0x4ce350591d9771d4)},
+    0
+  },
+  {
+    {W(0x1552f34b16144a47), W(0xd5085eeee302564d), W(0xcf79b83f4631a874),
+     W(0xdf7430365ae55106), W(0xa13df553b64bb54f), W(0x743ef4a83f40c1b0)},
+    {W(0x79203765f56b8cab), W(0x2a160e6c88c9b72e), W(0x0ff4f041e8dccaa8),
+     W(0xb8cf5a830f0e9119), W(0xe2249d5f35cafb74), W(0x00caaae84bb57914)},
+    0
+  },
+  {
+    {W(0xbe1596d7b4321231), W(0xd90e660158c860e7), W(0x6d35bcea45491c9b),
+     W(0x5e21c0cb4d2b2d92), W(0x8ff8024b4f94fc40), W(0xecb6a7167ad59efc)},
+    {W(0x0bea67e563c4839a), W(0xab3382d8b2751327), W(0x356214858e8f3879),
+     W(0x5ff2e3c0ae79c996), W(0x42098cb8b193ea38), W(0x1f55933b84a6a4f2)},
+    0
+  },
+  {
+    {W(0x54213cbc3d7a4ef3), W(0x03732f28021c15a8), W(0x05fc886a36c0d4df),
+     W(0x8a52fd3b3e36b8cc), W(0x686624d6e1a526c1), W(0x3c4deabf47e5b263)},
+    {W(0x17c79a7665c54028), W(0xdf9aa00cbe5b6b22), W(0x704dce77bbda4e13),
+     W(0x2d2216fafde8709d), W(0x987d295519dea88a), W(0x0d53a38059239bf5)},
+    0
+  },
+  {
+    {W(0xf4932c34be007eaf), W(0xd33f2ddcb7f65181), W(0x60a1e684a9b80bdf),
+     W(0x139bf43b49f6a57a), W(0xa1229acbfe105488), W(0xd8acb3438d394974)},
+    {W(0xb4c92567582b966d), W(0xedfea1137a21881e), W(0x20d3ddadb5a713f3),
+     W(0x015966d17f93d7d3), W(0x93a0c4d00186c4ac), W(0x60457b98b73f2d70)},
+    0
+  },
+  {
+    {W(0x56f1ea4b867a729f), W(0xbfef948b32aa7125), W(0x5444491ded7d40c8),
+     W(0x9bb2038aed906bca), W(0x7f0edb1a970fe22e), W(0x9267d6a3eb67cd07)},
+    {W(0x71a52c066e285c8c), W(0xcc065aedcc0836ac), W(0x14a33a6e0f1c1636),
+     W(0x5c43cafd8d78267f), W(0x730c9d4883a22d61), W(0x4dd05fbb102a4c28)},
+    0
+  },
+  {
+    {W(0x9e0b18cfaa660159), W(0x51bb0cfe945219e1), W(0x6ffb1e04f433b05d),
+     W(0xaaf754f9d709a1b4), W(0xb656ee3276e43a12), W(0x5733ed3ba1100f9b)},
+    {W(0x72f1b4777b4f10b4), W(0xc4c594481c499461), W(0xb3e112feed079efc),
+     W(0x92f5196df0f0a0a3), W(0x95be7f94f2dcd1a4), W(0xb313dc6c6d29e53b)},
+    0
+  },
+  {
+    {W(0x38b29f20e7e35a8a), W(0x84a58e6231962704), W(0x2c6ff23101945047),
+     W(0x0279a747f2737032), W(0x72fd7709b9b80b35), W(0x02824457c90725b6)},
+    {W(0x5f05d51496151d87), W(0x64d3a450df55cbdc), W(0x5a1143f20c07e128),
+     W(0xd2ff53721e91a62b), W(0xd8931752f293ec89), W(0x7c13410da30d1e67)},
+    0
+  },
+  {
+    {W(0x430d9adb0503a863), W(0xf148b90970458078), W(0xa087fec20f1ceb45),
+     W(0xaffaea4c1d967d1a), W(0xd1f60125d4b5348b), W(0x84f1ea119f7c0cf7)},
+    {W(0xc8993ed91d7e4516), W(0xfb5b0fefc16cbef8), W(0x67ae2e2840df65dd),
+     W(0xb6e2c085635101d1), W(0x48999a621df5b5f7), W(0x48c5045386576eb5)},
+    0
+  },
+  {
+    {W(0xf664e38d32a07b73), W(0xd929adf8bee60df4), W(0x0e69d2c3927fed95),
+     W(0x1e68e0ac5f436787), W(0x15d5c723949abcf8), W(0x0a2a817f73403241)},
+    {W(0xe5d06c04ec5c5384), W(0x36e9a459e928d312), W(0xb73e38e508be30ef),
+     W(0xb51be98801dbae5c), W(0xefa7a8086cf44cfd), W(0x34872db0f9665d88)},
+    0
+  },
+  {
+    {W(0x9b743b88c3f9f59b), W(0x864a282e62a0c1b2), W(0xb35b7c4e516eac51),
+     W(0x6b269303045245ae), W(0x939570df86a87af6), W(0x932432d25b25db9a)},
+    {W(0xcdbd31d54253a89e), W(0x0d917cde21a31504), W(0xc2a5e02798b3bb04),
+     W(0xb6f554a3e2472f5e), W(0x5f14638d77dfb07a), W(0x92d3c12bbf1744df)},
+    0
+  },
+  {
+    {W(0x85fd116c16988337), W(0xd3e9c81016b8d176), W(0xeea42705e1c7e61d),
+     W(0xd1cfba248a6d08cd), W(0x644675eabb67650d), W(0xdfc5734a624bf407)},
+    {W(0xbb0513df81f10f62), W(0x6558581071e1ba80), W(0x477a8f8544ecae77),
+     W(0x466352790bfb5694), W(0x830bde34aea0a6e0), W(0x20dc7ac661f1f08a)},
+    0
+  },
+  {
+    {W(0x4994386e46fbe4d0), W(0x501cd3eb9dbad091), W(0xed05f3c916968b5f),
+     W(0x4d73d031c74cfa8c), W(0xb89c9695dd0ad0e9), W(0xcc3b3cfabb555574)},
+    {W(0xcb1be6a040bf04f8), W(0x6c0c3f1cbf9a857a), W(0x55f74371dce01f64),
+     W(0xcda814685c55326f), W(0x580f869b67287d06), W(0x3c0803d7e4cb95fb)},
+    0
+  },
+  {
+    {W(0xf830ed4003619eff), W(0x3566fa379ec87166), W(0x0e1dc1130dece1c9),
+     W(0x877d2dbdfb33a9ec), W(0xec1210ed2eec9c4f), W(0xda12eb16d264aa19)},
+    {W(0xeab52cd8bf8b8878), W(0xfbf726590bf1ce78), W(0x3d3141a4934f04d1),
+     W(0x22914116ca781721), W(0xd85f143d382b49d5), W(0x976d2e4b77f80bfd)},
+    0
+  },
+  {
+    {W(0xa64fe0d4ab9ec39b), W(0xa9027d958d56d89a), W(0x48220022d3bc7a3a),
+     W(0x86ea46fb46b9a7b8), W(0xc8ef7ca71338671c), W(0xdec0fe3c5ab3f570)},
+    {W(0x6093f9a08b3b0b76), W(0xa69d65b0ebf75519), W(0x156dafb1cc75ba6a),
+     W(0xcc998e95fe9edc13), W(0xdad765b7ec9e3c1d), W(0x607d674615987e5e)},
+    0
+  },
+  {
+    {W(0xa55b834246a538d7), W(0xb8676cc1425eea29), W(0x778bda0d71880e8f),
+     W(0x9437d7c959d509b2), W(0x935305824726f4c7), W(0x39247266e2e3540e)},
+    {W(0xf02652cce6b85cd3), W(0x32e099e8fcb0bb64), W(0xa8b5376ee27a70f5),
+     W(0x6c0969432462e7a0), W(0xf9455834d1d1a6e0), W(0xeb9431140f569209)},
+    0
+  },
+  {
+    {W(0x38db5eed1ad25f91), W(0xafd46c9ff20841af), W(0x1d7f7123107c3de7),
+     W(0x5b2de1fcb63f0339), W(0xaa4fade8c112722f), W(0xb8424c327f8e07f0)},
+    {W(0x510df8bb93cde5f6), W(0xa27b1b11b0ce2915), W(0x4dbe7634663e0cae),
+     W(0xb63a1a6058c06e0a), W(0x25d02709722c912b), W(0x12d1b88f35520086)},
+    0
+  },
+  {
+    {W(0xe8e622486ed715b0), W(0x2fe3266f4d583693), W(0x5ec23a3ae7041ec4),
+     W(0xcbdc8e3fb67b0024), W(0x67c2680b9b65b0e3), W(0xcf1309fb930b43ff)},
+    {W(0x17e70eff91222177), W(0x1eddc03a4b485901), W(0xc0d7d3c1afda2ed1),
+     W(0x7297ad438d172ccc), W(0x1b861c0aec14471b), W(0x774122e4eb0e28c9)},
+    0
+  },
+  {
+    {W(0x48558456b197aef6), W(0x2811979449e839b8), W(0x427453076f2e8937),
+     W(0x0c28eea0518496e8), W(0x4fcd201b4ab300a6), W(0x0fd2d521a3445327)},
+    {W(0xe4d8598486368d53), W(0x564dcad31789072e), W(0x2ebf80e4215966c3),
+     W(0xbfbb96e007a35c79), W(0xed6bb90fb754388c), W(0x985f738c47dc9480)},
+    0
+  },
+  {
+    {W(0x483a1b9cc1b5e052), W(0x48a7e04dd45416f1), W(0x256cbfc66986de35),
+     W(0x46adda352b554cbe), W(0x80f02f0bd89f4b71), W(0x5fc090f4b1c86833)},
+    {W(0x27f92cc40d297327), W(0xb806c055ba5b18c8), W(0xbe833184c1b2f975),
+     W(0xe186b748ed99e1d0), W(0xfd47a675776332e2), W(0x68ea67c3f5f679aa)},
+    0
+  },
+  {
+    {W(0x76738b3cfbebe5c7), W(0x994764445a7e46e0), W(0xdb8ad3852899354f),
+     W(0x333ff180a3e23e49), W(0xd40fb39ac2f5c383), W(0xbf4aafcbbaf2904e)},
+    {W(0x616451dca48ad44f), W(0xff02d2c86547a86f), W(0x6770cd0e7b9c953f),
+     W(0xdec512c86e4dd193), W(0x632bd7826138b930), W(0xc5524432a9d32853)},
+    0
+  },
+  {
+    {W(0x00f60ed9c38fbd12), W(0x6f48850abab7765a), W(0xd5a4f29e040f568f),
+     W(0xdbf02dc2c334833b), W(0x4ebb452365ded2b2), W(0xe9fffb764de84232)},
+    {W(0x025fe5a26ebd13c6), W(0xf270150c52abe51c), W(0x846ad3a9d4af8ba4),
+     W(0xeed8d125bb37b973), W(0x3994c0c7c4e88f75), W(0x67c49b78898e688b)},
+    0
+  },
+  {
+    {W(0x641d7e36ceac5e02), W(0x41eae0d00a82568e), W(0x55a53f2baa17913e),
+     W(0xcfd33f3a30fe773c), W(0xf78890eecb47aba3), W(0x358054f9c9ae9f9a)},
+    {W(0x854af4cec049ea27), W(0x192051da474fc3ad), W(0x7e39b75d4472fb5a),
+     W(0x646e348ade404be2), W(0x0f53ba1a59b752e7), W(0xfbda641f67c70729)},
+    0
+  },
+  {
+    {W(0x354edf84c60f68c0), W(0x657e741e284cb39a), W(0x50b1a2fdb58bb3d0),
+     W(0xf33e1458ff72e589), W(0x2d427fb5ed52900c), W(0x8ac1448c30a1c7a0)},
+    {W(0x6985ae9aa4c2085a), W(0xb474a734e1a15e08), W(0x05edb45088aad455),
+     W(0x3a20872c60124398), W(0x74cbceb2700bf372), W(0x84a7265b5d2983c2)},
+    0
+  },
+  {
+    {W(0x16ee8e46f61921d9), W(0x5febe6fa8222c455), W(0x2c09a40d6c69bae8),
+     W(0xaadbf268545b3295), W(0x8d12593df03514e2), W(0x7c594032e6f92d12)},
+    {W(0xe113f9807012ccc0), W(0xedd1a25968eea1ba), W(0x355312dec912cbe6),
+     W(0x647e808375662d6c), W(0xa2810a2b34a8e188), W(0x8a81a783ea5188ea)},
+    0
+  },
+  {
+    {W(0x69363c2cbf7726e6), W(0xdb7771dc070ad13c), W(0x37f001107a1a138a),
+     W(0x41794efa67c79ab8), W(0x06a6b8f58c826009), W(0x9be4fc9979b3f4b9)},
+    {W(0x7f8cdb1bfcccaf83), W(0xd765b4663c9e33ae), W(0xff89a235df4d75bf),
+     W(0x6ac419933372f11f), W(0xf3368f95e63a688a), W(0x141d8e82aa7277a5)},
+    0
+  },
+  {
+    {W(0x31ab37b54fb27875), W(0x1753a3dddc1d5d30), W(0x0cb37223726c5a5c),
+     W(0xd3ec2db19eabc1e1), W(0xe9c4bca9129c85f2), W(0x489849bfc76d50a0)},
+    {W(0x2a16be9f1710df9c), W(0x2e92399c3ff489e8), W(0xe6acceb024103102),
+     W(0x437ca23997659f94), W(0x8db9c8c61884ef24), W(0xe3e0da3a36fd6012)},
+    0
+  },
+  {
+    {W(0x643c3583b3462e80), W(0xd5db81a866d84da7), W(0x7aeac573b9fec6be),
+     W(0x03bac6d8d8c03d05), W(0x52bec8d515293178), W(0x9dc629d4fafcc412)},
+    {W(0x9d12e47a17696b9a), W(0xc60a56f8d3f31e6e), W(0x8a7b6b1e8c6e58ae),
+     W(0x3420edb04264fd92), W(0x439611193b434352), W(0x9ba251bb05ef106f)},
+    0
+  },
+  {
+    {W(0x8b705460f95687f4), W(0x92c5acfaebdf6b5e), W(0xcbface42ddfa9b26),
+     W(0x20e6cbfda99f3528), W(0xb7f88ae93dd48576), W(0x6690517c96029d97)},
+    {W(0xbec9fc4494c3a7b7), W(0xf960f810b4ef6f21), W(0xf4ba570d2edd3c5c),
+     W(0xa8e700b5dfdbc09e), W(0x8a53ead8afccf214), W(0x27f3f9ca40942f89)},
+    0
+  },
+  {
+    {W(0x6430ac0272b23298), W(0x9eaf1fe5be1cfaed), W(0xe3252c1844604082),
+     W(0x3c187b14027ce643), W(0xf59e52a13e5fb39b), W(0x1d80289be4868ce2)},
+    {W(0x5f23ee9d322ca175), W(0x7ad45311a658c7d6), W(0xf1ff2b7c375129b7),
+     W(0xf1e68b9736ab34db), W(0x764626d2efd4e87d), W(0x22e150edfd869b3a)},
+    0
+  },
+  {
+    {W(0xf33aec6c8a619e53), W(0x0c292651fb8e80c5), W(0x5a30f7c8c5ab2810),
+     W(0xc414a47b7f813af1), W(0x1e8359f4a1a8c7db), W(0xe94612dca4627507)},
+    {W(0x65d0f24a15faaf1d), W(0x01e2a27d8b84fc50), W(0x40a5082f54541f4d),
+     W(0x9b5da8123b51a956), W(0x5d9327a584b9692a), W(0xc672f124818e4943)},
+    0
+  },
+  {
+    {W(0xbd36161e57fff63c), W(0x8ab7ae6a4c2a88b0), W(0xd429a8d80684ab09),
+     W(0x0edc2c230a1a4b04), W(0x96664708916e99b3), W(0x86bb71a6b5416b57)},
+    {W(0x8e3e26f4a806234f), W(0x2a45c7acfbcd95b7), W(0x0daa0908093d4f2e),
+     W(0x6e05d66481dc26a8), W(0x6693283535bfb40b), W(0x0ef84d4e5b02fff1)},
+    0
+  },
+  {
+    {W(0x15e1a861fc22ba3b), W(0xffd3670585ac1fd8), W(0x2be62997db5e6a25),
+     W(0x1c284ee19d1ff928), W(0xff4b6876159dad42), W(0x825d93485f6819db)},
+    {W(0x38122714832335b2), W(0xa96d010b376c66d6), W(0x24df83ba5ef7fbd2),
+     W(0x9049e309d3dbd395), W(0x72eb0b9f5c0fe8d8), W(0x32a9482686168b2a)},
+    0
+  },
+  {
+    {W(0xad1d166161aaa760), W(0x53ebace94f915aba), W(0x4e23e5bbb8b3f095),
+     W(0x12943fc2eb4808a2), W(0xea9225896aa80065), W(0xe4d417a9ee19597f)},
+    {W(0xd627771165937c3e), W(0xb90ef34cd7f39d27), W(0xb2f12187c834e9cc),
+     W(0xad6c7d6100ce8a68), W(0xc312bdd9f231410a), W(0x0cb9899463832fe8)},
+    0
+  },
+  {
+    {W(0x7f7d64ff21da91c3), W(0xb2629526a954758b), W(0xd275f93b6608e6d8),
+     W(0xc71347d72b5bfcf6), W(0x9b935400edda2975), W(0x0d67fe7c8325132a)},
+    {W(0x9def4498600292ad), W(0xaba2e931d6fd3df7), W(0x5519915bdb0efc6a),
+     W(0x2de2b1306ac0b2ed), W(0x01b1ac6f0e867ba7), W(0x3d16eec0f8213880)},
+    0
+  },
+  {
+    {W(0x589be797f4280299), W(0xd80214408e653521), W(0x0798d2d0535bf3c0),
+     W(0x88217f8e13cf423f), W(0x7b95fa14e20d1350), W(0xd040e7b65eae1f90)},
+    {W(0xe6bd0a3b522ac961), W(0xe320169e1ee66366), W(0x8b9bd507f7dced71),
+     W(0x7153ca26d84723a7), W(0xb6041071395ea47c), W(0x1f04732dbf35180b)},
+    0
+  },
+  {
+    {W(0xe2638bd54abb727e), W(0x8bc4d370019ac69a), W(0xd5761f8e17e14e3f),
+     W(0xb17abcdef4d04157), W(0x75d4ddc998d50fed), W(0x219afc0d0f4f4e3c)},
+    {W(0x7b252019202b8ae8), W(0x90fc3c563e36c026), W(0xe001af96bf4d1dd8),
+     W(0xfdabc7febbbbbfe7), W(0xde1d1ee454c30811), W(0x3ff621a97088a764)},
+    0
+  },
+  {
+    {W(0xe9272dfde3b270b6), W(0xd5ea71a574cb5142), W(0x5f916e1e7c93933b),
+     W(0x59b42f8d7d021018), W(0x2b5070e368741645), W(0x88a087bae4e12146)},
+    {W(0x11dd73be03a6623c), W(0x738f270a86e39300), W(0x7cf611f423a324f5),
+     W(0xbafc9abff1626e39), W(0x83e3dc3446da2656), W(0x0644d0abc64d1597)},
+    0
+  },
+  {
+    {W(0xf83d810735faea2b), W(0xe248ea414618893e), W(0x78880fd132b1105c),
+     W(0x0889595319e8db98), W(0x6f6f9343fdc6daf4), W(0x48f223a1725f30cd)},
+    {W(0xca4d359be20ae332), W(0x2862cd0e5544ea42), W(0xe3375a49815cd96b),
+     W(0x07ea4fd476f21a9c), W(0xa5184f884f92298b), W(0x2e0ff5fc910350cb)},
+    0
+  },
+  {
+    {W(0xb1874073764cbb30), W(0xa81f2ec3521fa979), W(0x7cfffbabc33d695d),
+     W(0xa67bb5c90f677844), W(0xffe2b1ef0dd81731), W(0x525b2e219926f8cf)},
+    {W(0x466b9eb22d88927c), W(0xb0aea14efd93eb60), W(0xe2bea2d03cc6f13a),
+     W(0xead6ae1a9c6cdfdd), W(0x2fbf95ce35c92b8d), W(0x1459657fc78fabd4)},
+    0
+  },
+  {
+    {W(0xb283c3e1e98eadc7), W(0x5c1c1c2a35468650), W(0xbc30556f5e7ebc35),
+     W(0x12119ae0d58292b0), W(0xb5b4f4f844c65a5f), W(0x44e065d4ebc81492)},
+    {W(0x63887c83a76ba4ea), W(0x58ce65328b7614b3), W(0x6c90b82adc2ae4ed),
+     W(0x5c64ab578e2e99a9), W(0xa029e4df3ace49b9), W(0x2839daa711918652)},
+    0
+  },
+  {
+    {W(0xe5d6912c968b368d), W(0x668963b67549e504), W(0x4b1ed95b7e733e74),
+     W(0xf11a39b086e50670), W(0x069a66968a893dc6), W(0x5ab1facb15211fcc)},
+    {W(0x1baed8fcc992ab03), W(0x6f3bd2eff0eee710), W(0x0525caa1a7640628),
+     W(0x5abcf37737d4546f), W(0x5566b571a169d2d1), W(0x7b99721966b10e00)},
+    0
+  },
+  {
+    {W(0xab0cdb933dbd313e), W(0xba5579c7ded701be), W(0x41f370d7d2ae6a46),
+     W(0xb102156f649530ac), W(0xc5dc2e82ff4acdbb), W(0x7f2a376949f9777e)},
+    {W(0x158d66a2aecf0f37), W(0x84febc1cfcb38ad9), W(0x55636961e2a70ef0),
+     W(0xebceb7db06067a2c), W(0xb44097066cb552bb), W(0x844f970484b1859c)},
+    0
+  },
+  {
+    {W(0x04b6062ca5c29624), W(0x623473c1e61c4ebc), W(0x5deb4b265dc795fd),
+     W(0x6aee68a8c9f862c4), W(0x6a106730bcd656f6), W(0xba347a4f85dc5613)},
+    {W(0x773f1b9f94cab5b3), W(0xedbe06b63102f9d1), W(0x458aa069f6888872),
+     W(0x8988c9e99c96cacf), W(0x2844801cd470b544), W(0x6905e81f9a37959c)},
+    0
+  },
+  {
+    {W(0x2a9461afafa3ac17), W(0x0aad77f88a6b1702), W(0x8abe4aacf9725139),
+     W(0xbdb414c257e660f4), W(0xe3bf3c04fa513855), W(0x05d3ef33d8cf4a37)},
+    {W(0xddc081fc795491f7), W(0xb3f467871f5e8511), W(0x2e9a7ac24bc6173a),
+     W(0x988d5ddfc7d0b408), W(0x5229210185cca94d), W(0xc6ab92a47a2aa3cd)},
+    0
+  },
+  {
+    {W(0x2687de9f9d054e79), W(0x7e76435601cc609a), W(0x2bc6d6c056d81cff),
+     W(0xe97f1328c4517f22), W(0x4222b09626ea2216), W(0x533677913a0fe4f9)},
+    {W(0xf0a188b336836402), W(0x66886500e38e000f), W(0x30170905b43bcf65),
+     W(0x628f7390d00c348f), W(0x6c1b86ebe6a789a0), W(0xf1c190ff3c52c0d9)},
+    0
+  },
+  {
+    {W(0x3e7235856822a151), W(0x20f21eb2d55c6daf), W(0xa0e96254ba423d42),
+     W(0x757fc573f1dc8737), W(0x07a009b549a3066d), W(0x4e279747c92567dc)},
+    {W(0x6ad805217657caab), W(0x49410ecee02064ab), W(0xffb47d8d122c93b7),
+     W(0x2d0886f23707dafe), W(0x67eab89b6b8e7ba3), W(0x96a3ca4708613e94)},
+    0
+  },
+  {
+    {W(0x6cf3928b82a5df26), W(0xb94defdd83ef7fed), W(0x3dd33710a4cfddaa),
+     W(0xd7f6591f6f27d83f), W(0xa80d6109ba13768a), W(0x37c4eac5e68de740)},
+    {W(0xddb18a813e4674d6), W(0x1c811da5303b6318), W(0xeb6c52cd62038122),
+     W(0xd2aec71a987afa6f), W(0x4e854f268a27456f), W(0xac3cff9fff0c3e04)},
+    0
+  },
+  {
+    {W(0xd3fb8c432c7a5a17), W(0x0411bf35c085ffb8), W(0xbb91e0d409835631),
+     W(0x02678b64d45ba093), W(0x73a4cc83503738a3), W(0xade9f9ee5006d46b)},
+    {W(0x7c5e4042374e3c73), W(0x3a353a3130eee580), W(0x6b29002b4c5e5543),
+     W(0x27b93a7f679e7abd), W(0x3a04c487c22db89c), W(0x93e4bcac060592a3)},
+    0
+  },
+  {
+    {W(0x39e0696dc830e7f6), W(0xa61d4db502d5413b), W(0xdea05475d5b50153),
+     W(0x42bdfb3ffdcf46ea), W(0x11eae8389983b099), W(0x40c1b14b98496265)},
+    {W(0x11a4cef51961240c), W(0x4e2f5ccdba1df5af), W(0x5cc8ccf83b3e8dd4),
+     W(0x6cb28fee26bac01b), W(0x894d632546e07e17), W(0xcb2b7bd8d5812b9d)},
+    0
+  },
+  {
+    {W(0xa0daec981982a97d), W(0x171e243769243517), W(0x9e2032d675764ae9),
+     W(0x7e510c9f8bde0681), W(0x451b29381ca12def), W(0xacb396f0937e1f94)},
+    {W(0xd5c5d917bf71c505), W(0xde0442800aa1c790), W(0xb9e9c1d3cd527101),
+     W(0x354a3c239a6297d0), W(0xecb9ec52254a9763), W(0x51c1ca7b26a66905)},
+    0
+  },
+  {
+    {W(0x7a38c8241f23c3a0), W(0x9fabe8e29f7fefb4), W(0xd75b9357b8155fd4),
+     W(0x2eb0617d7f4bc152), W(0x1c492960a49afe8a), W(0x917e155093f29f0a)},
+    {W(0x5b1d5af0622e0457), W(0x7f63cb429491adca), W(0xc8b691496a4fc453),
+     W(0x780277191d671c25), W(0xe2aa5b68eaed39e7), W(0xa8e6d25dab698753)},
+    0
+  },
+  {
+    {W(0x20f6137634c6d428), W(0x2b6bd26433ff1422), W(0x6e026734343693b8),
+     W(0x5ff23d3aeb512c85), W(0x85fbd8ca21463f19), W(0x60ea0e183d24f2fd)},
+    {W(0x9f90190a5d887bf5), W(0xf48032dbbb9b3f00), W(0x0d0f87452dd5e7da),
+     W(0x660e3b1720c66cae), W(0x0a126385ac08c6e3), W(0x670caf0cbd086f26)},
+    0
+  },
+  {
+    {W(0x882e07bb692990e0), W(0x76fca7de968d235a), W(0x9159855696f74c89),
+     W(0x687b4652940c4a4a), W(0x846cfd5f5bae0595), W(0x5e49b928374ed30d)},
+    {W(0xe2aad618f41f8b79), W(0xd5370e2583ed0e0b), W(0x2db76dc314fc3ac2),
+     W(0x1ac368f0f3002aae), W(0xe16712f60e6152fc), W(0x63fa1850d86f541a)},
+    0
+  },
+  {
+    {W(0x28ccb61cd7c5356e), W(0x74b17bbee9ed4125), W(0x85761d49b4d091d1),
+     W(0x1cec96a5121bd13c), W(0xaade3a9d6e0db24f), W(0x4bbff1d987c42cd4)},
+    {W(0x9720c45616f4945d), W(0xe26d17e979d4a4cc), W(0xfc8aa2f2329d6030),
+     W(0xfa62e1d648c150dd), W(0x4c703dc592ea172d), W(0x87bcc7a8c2a22252)},
+    0
+  },
+  {
+    {W(0x0abdcfcc20d69ef0), W(0x73117d78662d3d9e), W(0xd633b48ff3361e12),
+     W(0x1d3e8d3d75db85ff), W(0x2fb203b6274489d4), W(0x7965aa44c3c1d8b7)},
+    {W(0x038da07e95c6a26f), W(0x3293de194ea17106), W(0x9f91f5e3a1d6404c),
+     W(0xf43adaf313299416), W(0x5065da0a2160cbb5), W(0xf7dad5dff05f8788)},
+    0
+  },
+  {
+    {W(0xa410b9d3fb8b6d55), W(0xa9c43d12294abecf), W(0x965638701ab2afb6),
+     W(0x616df3901f4d31b1), W(0xbc4282e2d12c584d), W(0x3b3a62d76247cb3d)},
+    {W(0xa7ee870e67d907cf), W(0xf078cf31483fd74a), W(0x72504156e3b3cd7a),
+     W(0x91ee82b72d9dc844), W(0x312c4177d1be179c), W(0xe0eaa8140b198c8e)},
+    0
+  },
+  {
+    {W(0x414b1d4e9703eaba), W(0x27cc67f239844033), W(0xcb6a13adc59bad92),
+     W(0x40803fe9a76ba68c), W(0x9521d3d7a3d72a6a), W(0xe0214ee6e30e0471)},
+    {W(0xd56776bc71c0bf8a), W(0x9c7ce85d0c072210), W(0x0225cb80d61e8db7),
+     W(0x335beb7997a872c5), W(0x679767d8e5a153f6), W(0xa298f3eb2b134672)},
+    0
+  },
+  {
+    {W(0xa3372e8bb67fe99e), W(0xf3a96111c1355a05), W(0xda47773f1547860c),
+     W(0x6c9bd2f0eb4ab799), W(0x76607e9bbaa3874e), W(0x9c334188228348b9)},
+    {W(0x5e675e8e55addd3e), W(0x16ddd8a74c720d5f), W(0x6fecf9f8d53b3ea2),
+     W(0x3c3fce5926868c03), W(0x8a11b977a5c2c0c6), W(0x26e7a234f929fa46)},
+    0
+  },
+  {
+    {W(0xb1ac431f2b2309c6), W(0xa4d413580037e319), W(0xb8d3157a4278f94a),
+     W(0x456ada3fe4d4f02c), W(0x339c07b094e564d3), W(0x7e7f1074b65ae422)},
+    {W(0xf437cf28ccadbb50), W(0x0cff520d4faada5e), W(0xdebecbc452cdc517),
+     W(0x118301a01b419705), W(0x2af98a5827702c86), W(0xee3a1dc6eb390939)},
+    0
+  },
+  {
+    {W(0x6777a39533327bde), W(0x2cb53a37c7c92e8b), W(0x403838685da4445d),
+     W(0xaed1477d1ca715f5), W(0xc351a3e03113a1df), W(0x09c9c4f3b1bf67c8)},
+    {W(0xe4cedf4b5ee2537f), W(0xe35ac73636eeab44), W(0xddb1c0c1f7c4725e),
+     W(0x008982dbe1204caa), W(0x12e5a02012dc6b0f), W(0x5e95f2526aaee397)},
+    0
+  },
+  {
+    {W(0x1220eb82bdd60d74), W(0xeeb767bd86acc832), W(0x7c49cc1d3d303ac3),
+     W(0xba028825c74252cd), W(0x8a9d1dece4ce6b12), W(0xb7e76b7e17483d2b)},
+    {W(0x4ea0083b87fe6b46), W(0xcd154c2cb6d8d7ce), W(0xa20c015735cffb16),
+     W(0x659b26bbf5b902a3), W(0x64ab43239a08860d), W(0x86f34ed73c5095e3)},
+    0
+  },
+  {
+    {W(0xe62bfe06be98a54f), W(0x1ce19fc4cbf4f3f7), W(0x7cfab3ab15b286df),
+     W(0xd5995069342123c9), W(0xe55ba9338498da26), W(0xdb153d36885c51e0)},
+    {W(0x6a9cb0db35cc047a), W(0x54f7a45ed4058066), W(0x49f7af0193c9bf93),
+     W(0x0738ebc7f147276f), W(0x54156291ecc77caa), W(0x429d4c2d6866e8c9)},
+    0
+  },
+  {
+    {W(0x6a395681d987f693), W(0xdb8fd79c7b0c3741), W(0x177f80dad2b752cb),
+     W(0xf38fa2aa6a12184d), W(0x9900935ce7595a53), W(0xa245db74d2c5a1ec)},
+    {W(0x1e09d7cb299a3654), W(0x4484b7efbd0e421b), W(0x3036de71ebcf090d),
+     W(0xc3430bb09a6d4b6b), W(0x4e462781f7f441a7), W(0x27b175fdba7b1018)},
+    0
+  },
+  {
+    {W(0xc89c511f0b188cea), W(0xd60fbf1e6f5e59d3), W(0x28a57bf950481e58),
+     W(0xa76bce039c36333d), W(0xe8e7bba6324bb1a6), W(0x23cc480409ae39a3)},
+    {W(0xe54c0ce959f8b4ec), W(0xdd24986efa7f1795), W(0x4aa452006bd2c204),
+     W(0x7bbb6efb9222fc5c), W(0x027dbceae4c77b0a), W(0xa7ed402d67975d12)},
+    0
+  },
+  {
+    {W(0x11180af8a4fa7dd1), W(0xae97b9e65303a58c), W(0xce45e3b1c328b011),
+     W(0x064e2ae42a152cd1), W(0x40dd4a45c8818a72), W(0x82f94f949e2ba841)},
+    {W(0x96337eba5b9e1a30), W(0x147f7bc5dcb956e9), W(0xf98423f359a668ad),
+     W(0x92e4c955363ada59), W(0x5bdde54f0d214cca), W(0xb601daf5dc142fff)},
+    0
+  },
+  {
+    {W(0x1958186b994fb43e), W(0x200f78e839e1cd93), W(0x6df1e9d3b7e32d30),
+     W(0x6e3017964dfda0ec), W(0x38223423152d77c6), W(0x20c70396b1ac5678)},
+    {W(0x49d864fafa8134cc), W(0x66f0bed3c002bfb2), W(0x105c6fd72160f88e),
+     W(0x462650a99b03f365), W(0xb5f241d41d9404d2), W(0xbae3c6b04bba575f)},
+    0
+  },
+  {
+    {W(0x832feef12a8b44df), W(0x56fc81f0bb71e2b4), W(0x88c980652da5d329),
+     W(0x1ea7d26d3c137284), W(0x6bfab6cfc6df83f0), W(0xb93aea872e6fdf76)},
+    {W(0x00b9736284f1d4ef), W(0x053d09e83533a5aa), W(0x99656d2270a01620),
+     W(0x6935eabae9f3e9d9), W(0xf0c0f2291fd43dc8), W(0xb34fabe0379981b2)},
+    0
+  },
+  {
+    {W(0x4f0e35f08a5c9cd6), W(0x708226ea03447d69), W(0x2ecbc766c3fcb3e9),
+     W(0x424164bf8fcdf748), W(0xa65297bebd530f5c), W(0x9a3488211c6ff6b8)},
+    {W(0x2d2ef370fb6f5b88), W(0x4d18f62c42f6eac5), W(0x5800cc0205db0150),
+     W(0x8fd5eea1984cca97), W(0x243b76eb44b55e6d), W(0x7d987de6719a9fda)},
+    0
+  },
+  {
+    {W(0xa2b8afd14ccc19f6), W(0x57852a4e1f5f14d9), W(0xa3b35e1bed27847d),
+     W(0x7ca2fdffbacd1365), W(0x26af9dc74ecf4fe6), W(0x06711854243a2d67)},
+    {W(0x851a0d7e759cebc7), W(0xbdaaf0a32ffa6a03), W(0xc375f0b9c7f7feed),
+     W(0xcc2fc8e24a99a1b3), W(0xa8d40c27b8769817), W(0xd0cf731abf134bd7)},
+    0
+  },
+  {
+    {W(0xefa4bbfee63532ab), W(0x19aecd57efa83beb), W(0xb33d36df8aec7b6d),
+     W(0x080eaca77d1720ac), W(0x4cf9729f1fd032c5), W(0x71d851eac88e7956)},
+    {W(0x8a989ef9fd95a181), W(0x9ef335000f1a2034), W(0x2d45695126df08ad),
+     W(0x554b4f52aaed012c), W(0x887d8a955db3e57d), W(0xafcfce770825eb76)},
+    0
+  },
+  {
+    {W(0xc65dd868950bde2d), W(0x8bb713b1f3c557e9), W(0xcc47cdaf68afdb0c),
+     W(0x2e66a98dbab526c2), W(0x35a8ea34b4f2b250), W(0x291cf7348bd72957)},
+    {W(0x36ccabac17b8680d), W(0x11f4d5ca36457e9f), W(0xec244865ecabb359),
+     W(0x4281cc5e5e497cfc), W(0xecbd7ed23c458ff5), W(0x7a9498f729f26acb)},
+    0
+  },
+  {
+    {W(0x906c9aea8cc13934), W(0x82b3de8d537e6a41), W(0x5988f7aadee2fb21),
+     W(0x2f8e98a4a7471dd7), W(0xa6ef2634bc2edceb), W(0x279f8469a514ad7c)},
+    {W(0x0cfd209a0971ebdd), W(0xe292fb8a4e2a53c9), W(0x3d80d6e723ad5359),
+     W(0xef6fd766c8798c39), W(0x01770676ae38c0e4), W(0x749b54d3102b369e)},
+    0
+  },
+  {
+    {W(0x1dff955ee122a4b8), W(0x7fb6ad46e52b3385), W(0x81011399143ae947),
+     W(0x0c710ee3c74fe563), W(0xd2f16b8eaad93944), W(0xbe390192650bbbc5)},
+    {W(0xf2a5fa4885000bd8), W(0xd6066e33840919ac), W(0xbedc87b5b8556647),
+     W(0x45c81455ca3eb4e0), W(0x63458b42f2b62ad3), W(0xe9653d045e40aed3)},
+    0
+  },
+  {
+    {W(0xbf0150666b5be3d8), W(0x5c384feaaff1ada6), W(0x9a1c029a871bb528),
+     W(0x3c176702f4aec110), W(0x88f5257e43dd8adf), W(0xc7fbadde3bbac5ab)},
+    {W(0xd32035e5f1dc506a), W(0x15d3c0c2ea303469), W(0x4cab4ace7f4a5365),
+     W(0x455c20ac9687fb71), W(0x3e035e09b6f87f7e), W(0xc6650983fa712150)},
+    0
+  },
+  {
+    {W(0x3b07ab3096d51eda), W(0x33658354a1a42d24), W(0x6317ce5f7fac5d56),
+     W(0xe7ab6049065e5eb4), W(0x8507f571b6c392e8), W(0xe7a493991e886b08)},
+    {W(0xc9770a846aa76e1a), W(0x6e497f1a41235d86), W(0x810f9c01b7a51cbf),
+     W(0x86ff46b6e61e6d94), W(0xf52810f78af3817d), W(0xa2ad202c1e6ca6da)},
+    0
+  },
+  {
+    {W(0xd31f370914edf048), W(0xf8a66a884884be87), W(0xd8e6c25f424568d4),
+     W(0xd418bc15b5d27374), W(0xc524f87a0d84197c), W(0x124248cea48f6e19)},
+    {W(0xc76c98a2b9789710), W(0xac5de460ddaa73ff), W(0xe14909083ba59792),
+     W(0x02ea30982b5321b4), W(0x76496ba5b0151581), W(0xcb0323856f54674f)},
+    0
+  },
+  {
+    {W(0x8481ae27427d6147), W(0xccead1adc5af2be7), W(0xfc7372bffc3387d5),
+     W(0x610c36039a46a9ed), W(0x93981e8e8b782eaa), W(0x35212c2b96b4597b)},
+    {W(0x288a49a4a11bd854), W(0x0f87d37a85543a43), W(0x16346b1280cb5b5a),
+     W(0x9f9bb5fdd3fe9908), W(0x7ea710ff4a28f28d), W(0xea9f8e09eb3ad815)},
+    0
+  },
+  {
+    {W(0xf40e0efac07d5fa0), W(0xe4b85c1ba817f4ec), W(0x93667ec3cc49c8de),
+     W(0x13eaaf536fc6f8d1), W(0xaa0961fba1a4b2e5), W(0xb4e661ba81e73250)},
+    {W(0x4a26f31d172d5f3d), W(0x4741e7d8c47b448f), W(0xce960a3a0c77c7a9),
+     W(0xc89ac99072088b02), W(0xe7b298f2f777fe3a), W(0x75810d529c0a4daa)},
+    0
+  },
+  {
+    {W(0xdd0bb2ee55bb6f96), W(0x92988cd50e6b1dfd), W(0x7fc7f9a3b52a1765),
+     W(0xa38ef95599623001), W(0x2eeed4ff69a1cd9c), W(0x80cf78ff7f147d51)},
+    {W(0x808cc747da4d6d32), W(0x6c9c10a435a90328), W(0xd5ba70a9a7e821b7),
+     W(0xa30e467d55f2f9ad), W(0xb0ecf4f80f8dc311), W(0xce40517ae78f3cf9)},
+    0
+  },
+  {
+    {W(0x9f0381bf0a7c2c87), W(0x3eca6cc1378fe6c3), W(0x9d295027802f315c),
+     W(0xb17047280413fe31), W(0xa6e7030e70e0d4ed), W(0x00a520d441f872de)},
+    {W(0x98bdff078eb08d5c), W(0xc239fcceccd7ff20), W(0x2ff3188fea3d2c84),
+     W(0x67a3f18e84078d45), W(0x4814be9027eccc45), W(0xf57e2d375c3745d1)},
+    0
+  },
+  {
+    {W(0x75e2242757ce86ef), W(0x8430f3ca192b78fd), W(0x863da71e45132484),
+     W(0xcbabbed9131e20cb), W(0x8cb7435d9a643a13), W(0x9e9df535ec7aea1a)},
+    {W(0x54b5facdbf6c2b9d), W(0xbdad0338e5dffc65), W(0x9e3e5073b2f77c9f),
+     W(0xa44218fc9a106eb9), W(0x556c68d050dbf167), W(0x408ce510e42360d6)},
+    0
+  },
+  {
+    {W(0x76f8501f5320fc1b), W(0x0a190e446d3168bc), W(0x21c47a461897a72c),
+     W(0xe4334774bea719c9), W(0xc489b782f3ee1201), W(0x5b1dd0c9cd73991b)},
+    {W(0xb26d798aa083bcb6), W(0x1acbfa4ea3e76162), W(0x05bf655a4801e505),
+     W(0x464b84689d93a0cc), W(0x1dcf561686a2980b), W(0x8002f11cbe42c548)},
+    0
+  },
+  {
+    {W(0x86f91fcac1e094d2), W(0xa9227028ac3456bf), W(0xebe9b8330e6412e3),
+     W(0xe1982576fc7cd8d2), W(0xd78320f0d17724b2), W(0xf12974ed29c1dcd9)},
+    {W(0x339e05c4f3823567), W(0xf64bf8f8c396898c), W(0x89a950ca0e18d919),
+     W(0x71bab9db7a99ed57), W(0x751c7ea46b217d7c), W(0xcb40272cbd02d5b1)},
+    0
+  },
+  {
+    {W(0xcc83573d1cfddd53), W(0x37121ec7b289b4a4), W(0x1e7be7049c39b323),
+     W(0x26313cfa8a19cc60), W(0xb461455d2b647f72), W(0x868a6ae2e79f326f)},
+    {W(0x3cc1efa038295103), W(0xf550f97bc2dbf22e), W(0x3db9b2b3290b3d18),
+     W(0x765972f0186bdd85), W(0xb2254e43c87da337), W(0x0d0412fb3f24b69a)},
+    0
+  },
+  {
+    {W(0x50538dff7c1c7c8c), W(0xb50fee9588d05f0e), W(0x701e3f0aaa837fd9),
+     W(0x346def465cff3ff1), W(0x1e557ec3044fcb3a), W(0xd9a7eb6670d9f337)},
+    {W(0x8dbd660b8f953f9c), W(0x77489afe9a2423a0), W(0x478585711f6e0fdf),
+     W(0x3b2afa829b88b6d0), W(0x9ba090c90e8ac3d2), W(0xbe88d0568b36d554)},
+    0
+  },
+  {
+    {W(0x3e464f67a4634197), W(0x3772ce2ec42bfc7d), W(0x0268cc22db46c390),
+     W(0x4591dda3ae842ce7), W(0xe1e45a59db9d444b), W(0xc231747fef9bc55d)},
+    {W(0x6ec3089cfcf744f3), W(0xa0435e93a8d69369), W(0x349a3788997b66cb),
+     W(0xe2b672404877be3d), W(0xdae65ddb98fbe116), W(0x7c45b66563ca6dae)},
+    0
+  },
+  {
+    {W(0x5fc42aa153be0c00), W(0x110d5b4dcee33f3b), W(0x17f617e2e1836207),
+     W(0x4d9745a48d083208), W(0xbb9cf6d7940e9ee7), W(0x7b1fe13d4fa9d347)},
+    {W(0xdaa98a976af180e7), W(0x630a42116de6d4a0), W(0x75b527618747e9de),
+     W(0xbc9d3e2ef0a6c11c), W(0x5f00a01f0403f724), W(0x80b34207984202a0)},
+    0
+  },
+  {
+    {W(0xeb30b5213b3bdde4), W(0xceea21f87557efa2), W(0xc6b0cbef9d9dedf4),
+     W(0xeaec3895f3a18510), W(0x52b5464073900a9b), W(0xc32da3233d2af793)},
+    {W(0x72414eb21f4c0335), W(0x4653c8d05a6f59ff), W(0x068e4d02e7a44d67),
+     W(0xd0827574a32e983f), W(0x6009f7f3a89e8147), W(0xad52812162818298)},
+    0
+  },
+  {
+    {W(0xf5591f998a17d695), W(0xc444e2c99d78ee8e), W(0x4c7612a9baf4e2fa),
+     W(0xf5b1e5b5f5eb794b), W(0xd2a74370d74ccafc), W(0xc9d97eb751d38047)},
+    {W(0xe3d63a55bef59381), W(0x8b44d96e58c4ca5f), W(0xbf1d0be6afb573e7),
+     W(0x48595b09e1c153c6), W(0xab290b73b96eb3d4), W(0x787ae96b43556a38)},
+    0
+  },
+  {
+    {W(0x892c09de5066313f), W(0x18a662d64be1561f), W(0x7acf418bae456353),
+     W(0xcb22406088ca267d), W(0x912f26673b270a46), W(0x06a214e654966e77)},
+    {W(0xa6f5b8d0bdd83bfc), W(0xb76980c50d3af6b9), W(0x1c0c6b9cd0e4857d),
+     W(0xcfa937ec9126e26b), W(0x0b1476d4e472726b), W(0x35e73c58265059c9)},
+    0
+  },
+  {
+    {W(0x73247445183fe95c), W(0x6f4fe6cf8382b502), W(0x8187d8ea13e60c00),
+     W(0xa946a60264c307d8), W(0x4d10a7ca8a6d77ac), W(0xd50f1918b591355d)},
+    {W(0x7e106c2b6f0365f3), W(0x586a5bda565c4458), W(0xbb717900543bb6d0),
+     W(0x1409eb00e2ff46d9), W(0xd9946aca9fe829bd), W(0x9a8c3237c92f59ae)},
+    0
+  },
+  {
+    {W(0xa6fbca06e0a53ba2), W(0x8c93ea2174195974), W(0x62fd7c77215435ed),
+     W(0x831a12696ed9a04f), W(0xf1a509d6618c5c47), W(0x2a57ddb204a3f7fc)},
+    {W(0x23e70043aee4ff7e), W(0x0be38591777e1685), W(0x33eebfa14b5b6e60),
+     W(0x0622cd60439e4b45), W(0xa3d18a1142c93720), W(0xda93420449e41bb2)},
+    0
+  },
+  {
+    {W(0xb5c0d35783839e6d), W(0x98f562bcdffd99fd), W(0xa7ee9f262c39e72e),
+     W(0x8c91cd3435a58b14), W(0xc69a5a524c223251), W(0x0fc269d8b514a737)},
+    {W(0xea1f96180b4bb92c), W(0x27551c22d1b26aef), W(0x75aeac5275a26fe8),
+     W(0x8e2bb6842e546fa5), W(0x469893aa938e611a), W(0x5f7a95e6c59ca5bf)},
+    0
+  },
+  {
+    {W(0xae9238f51430dfc9), W(0x747821a8be2c9e7b), W(0xe96ab9d35507c951),
+     W(0x43fb2a8074c9a289), W(0xce157ea210b75c82), W(0xf7488a7b1f33e638)},
+    {W(0x830843a4088b73cd), W(0xdd60811c0e2ebdb6), W(0xbed24302c5199648),
+     W(0xff1d831a4cc40d0d), W(0x4beeec607530fea7), W(0xef1cc35db18d5006)},
+    0
+  },
+  {
+    {W(0xde754b7a213cec89), W(0xb018101170ef0ee0), W(0x6f01c3817f99e234),
+     W(0xa618be3c74923501), W(0x0da31f3532868d77), W(0xd06dacb50fdf4c0e)},
+    {W(0xe61698e27d9cf0ee), W(0x1eb04d8ba2462fc4), W(0x5d19647706cdda05),
+     W(0x8257894dea81abdd), W(0x434d7585a0968b3c), W(0x1f70aa5c8cef875a)},
+    0
+  },
+  {
+    {W(0xfdfe0f94b4e383fb), W(0x40bec6697e234813), W(0xb25ddae378a8c238),
+     W(0x5e7aff05ec451d58), W(0x707682bbcea3b84a), W(0x3341bd121c42cada)},
+    {W(0x144c1f14413c2667), W(0xa59bf0659c6a88a7), W(0xb15f1a3a5eb59cea),
+     W(0x04b856189792b9a2), W(0x7e79491c4dd54650), W(0xd76f894f9329967b)},
+    0
+  },
+  {
+    {W(0xfde8f18d6bbcd09c), W(0xa518467b41fe5404), W(0xe69623231f0d7186),
+     W(0xb0101cddf044ad10), W(0x091d17094b5c6a07), W(0xdf99e68ff01490e4)},
+    {W(0x9ec9a7fcaea81a21), W(0xac8370be166e54db), W(0x955e098dd232e0d7),
+     W(0x677a5fd915ba5a14), W(0xf4fda402b4cd090a), W(0xf588680da0498017)},
+    0
+  },
+  {
+    {W(0xdf85e88eea048f7c), W(0x894d539f484dc31d), W(0xb8ebe2fb4e9f1c53),
+     W(0xf6038ea595ed02f8), W(0x4a75f57f2cc17744), W(0xc1d16d487c7a59a5)},
+    {W(0x2f47d07bc478ff56), W(0x416ed452a46e17e4), W(0x7d133ac52ecfff35),
+     W(0x32186addf4869cec), W(0x3dc0c0c5f2a5c8e8), W(0x45179b3e3bea26ce)},
+    0
+  },
+  {
+    {W(0x04a0ca51d32a03f2), W(0x57c4237952bcfd10), W(0x87ededf13d4e5341),
+     W(0x18a7ab9016d00e62), W(0x63727e8d65ad8760), W(0xa3c62fbcbceb7714)},
+    {W(0x01c653a818aa4ca8), W(0xe36422d7774859af), W(0x6fe71635ddc79f9e),
+     W(0x702806a93577068c), W(0x3f26f283c2bd7dfd), W(0xce6e7559e99732f8)},
+    0
+  },
+  {
+    {W(0xb08a8cc59c99a2b1), W(0x323ceffe171c4ad0), W(0x22fbfb1070cbe57d),
+     W(0xc5241063ded62f3a), W(0x5538a79f7fe669f3), W(0xbb40f4ad488d0fe5)},
+    {W(0xfb23b5f1d4c4793d), W(0x3600d5aa49214661), W(0xfbf9e542255e2188),
+     W(0xac884a7e6cdeec30), W(0x15caa4db7ddd411a), W(0xbf2b9dc02bfabc40)},
+    0
+  },
+  {
+    {W(0x7a039a6f1e6663bd), W(0x06c2241cba32ec52), W(0x0a990556a183ac6b),
+     W(0x67d7b0c32c8abf7d), W(0xc8b184039541aa42), W(0xa7fe686fa8855100)},
+    {W(0xb01883b5b583b425), W(0x4426c72eb918fc26), W(0x0f5b8a4ab9d71538),
+     W(0x4d54f37d69055ef8), W(0x5b95542289d24fb1), W(0x03268bf5771d781b)},
+    0
+  },
+  {
+    {W(0x3e6cf2f5610e60b5), W(0x935b873223040924), W(0x1b99daefadafddd9),
+     W(0xebc6334303f37ccf), W(0x156a35637c9846fd), W(0x0a40ef3c6387518a)},
+    {W(0x4d8043d7ba768ab7), W(0x3863805d2c08b596), W(0x2a7ac392fe51428e),
+     W(0x08ed1b60e84ce3e5), W(0x3ab2a209b69507b7), W(0xa0e6d50f51dad26e)},
+    0
+  },
+  {
+    {W(0x5ede1c70e0b129bf), W(0x963cdeb96f4f652e), W(0x3222552030020e9f),
+     W(0x281d745a5ab45d33), W(0xf2aac5e6a79a5e20), W(0x6c1e371a894e57b2)},
+    {W(0xe7258c929535d200), W(0x9f4c0beef9096785), W(0xf16ca14652c875cc),
+     W(0x4fc5b651beaebc19), W(0x01f127849ddc82de), W(0xc2d34f8aef1eee45)},
+    0
+  },
+  {
+    {W(0x308d0460a40253a1), W(0xda5c2b45ec8cdec1), W(0x5056b0ae8f79f200),
+     W(0x77262bd2d7f7c0b7), W(0xc8fa921038366d98), W(0xeb518066c52358a6)},
+    {W(0xfdad6f1d73e78222), W(0xce4834dd1c2c09d9), W(0x3841922507e97443),
+     W(0x20ef7d3b9a31bda1), W(0xd8c0bb6b4176b043), W(0x186dbc10cd942acb)},
+    0
+  },
+  {
+    {W(0xa1683a932c3512d1), W(0xd4519dea21a79724), W(0xff24b11fb1e87f98),
+     W(0xa1a48479310918cf), W(0x25842bb1f4638b19), W(0xe9e40dbf60582cc1)},
+    {W(0xff38c017e8cfd879), W(0xe598b71d279b5ced), W(0x641e3f1559ead339),
+     W(0xbed8fb5d31c5c281), W(0xf3b8bc95e73f3c6e), W(0xb622a1cd3ab07ce1)},
+    0
+  },
+  {
+    {W(0xa85def47d3766238), W(0x7d1f6daaf4018098), W(0x3fe03efa68c94ddc),
+     W(0xa24e256842922578), W(0xa84c03a8e79deeb3), W(0x72c7068e23995d14)},
+    {W(0x7a5279d794b5d359), W(0x5adf24e5ba7713f7), W(0x8828079682b5d1d9),
+     W(0xeaef7bde645b73d0), W(0xfbfb1cddcb1206ee), W(0x47aa467f9ef315ab)},
+    0
+  },
+  {
+    {W(0x384bbc0ac2fd201a), W(0x8b81155db6ed9529), W(0x65de043cef2cfd06),
+     W(0x7430704b37fbd69d), W(0x64c33c4cd3273949), W(0x525b4ae91967b3e0)},
+    {W(0x64800da9bcbcf5db), W(0xe4175af1d98c55e3), W(0xcb52aa31532bb09d),
+     W(0x1233d5bc14bbbc23), W(0xc647ec73a2e7f5cd), W(0xb88ed9aaabb98a12)},
+    0
+  },
+  {
+    {W(0x7ce63ce9b40c6514), W(0x4d5cbd6427ddf150), W(0xec631cac3a2f4b7c),
+     W(0xce89b0ab659331ec), W(0x8277930059bb7a30), W(0xe969d0b1e001c780)},
+    {W(0xbb1e8f2d5ea25dfe), W(0xf5e55284e6c411d9), W(0x16fa1c4e1e7069ed),
+     W(0xc19261bdfb391bab), W(0xe24143f152dc08bf), W(0x7fcd516125d9b7f3)},
+    0
+  },
+  {
+    {W(0x88bce2b686187c30), W(0x20a518de8f85b272), W(0x5de5e62af8335787),
+     W(0x3a044628f8eb8f86), W(0xa71195d8b4e2d556), W(0xc444e68faade7635)},
+    {W(0xc989990d4fc60b45), W(0x4741513513dd232d), W(0x008c09fd921b6a67),
+     W(0x60d801009d981dc1), W(0x8ce2cbdb2954ad97), W(0x8f49ebe8456340da)},
+    0
+  },
+  {
+    {W(0x0ffcc05fa8254152), W(0xb567da8b3578f5b9), W(0xde9ea3ccdda6f4e4),
+     W(0x0395b61b376a0933), W(0xa67641d56dcf60ad), W(0xb9c3dab80e649387)},
+    {W(0x62c771dc15035af0), W(0x4b8b7001915aa6e7), W(0xba28fa9b56adcba9),
+     W(0x768b509bde1150a4), W(0x0062a8ec791bdbab), W(0x5f70cd0469ac9b06)},
+    0
+  },
+  {
+    {W(0x29983028c2c2b734), W(0x9261c66f477ec729), W(0x859175d6f216fac1),
+     W(0xf6c47cf545cff7d8), W(0xed3e4dfe455cd493), W(0xe816ab741a2df775)},
+    {W(0x17e0695134a2085d), W(0xfde490372de782d0), W(0x172bb0a9d4e46992),
+     W(0x2441f2a5e7f08fce), W(0x544fea1360af462b), W(0xb872d51814041350)},
+    0
+  },
+  {
+    {W(0xe0b55ae107ad1918), W(0x59d283f044ab05af), W(0xeeddb7d3a28aecc6),
+     W(0x34f3485293c97556), W(0xcd321a6bfc561e0d), W(0x94943c483183222f)},
+    {W(0xbe509a48e2842fb0), W(0xafc52653b362c5de), W(0x97e4dc4fced3971c),
+     W(0x8f8b2d42cabf401b), W(0x19c23b9ba1f8d246), W(0xfbaa37cc99312266)},
+    0
+  },
+  {
+    {W(0x0bb96d0ca2b429e8), W(0x15a2b44e02df768c), W(0x6477e5c707189833),
+     W(0xfdf83b7a71ff600a), W(0x9795728c4baea77a), W(0x7cd55a44ce9137b5)},
+    {W(0x239c2354891f1b34), W(0xcc3f8d762a055077), W(0x7c0eee9dcbb2b58d),
+     W(0xa5b644758294a335), W(0x86202becd56e3f35), W(0xb810fd23bc0aa618)},
+    0
+  },
+  {
+    {W(0x5a5c5bd3cfda8708), W(0xe2db418321444df1), W(0x4ff5f39c06c07f50),
+     W(0x0cb810ff28ef2182), W(0x4f25425b79cfe062), W(0xbe6ef342e77b9607)},
+    {W(0x19cdaff643ed40aa), W(0xa538ec10dd5c77ee), W(0x4d16805d4c2344fa),
+     W(0xfd079f7cafd5aa34), W(0x523edc39012eb020), W(0xfd3dd53e22a65f9a)},
+    0
+  },
+  {
+    {W(0x3ee4cbbb28780533), W(0xf56284a08bfec70e), W(0xd3b0c776aa6569d8),
+     W(0x7af42e0067ec24ef), W(0xbe845cd1c52be2ca), W(0x04b43674423db741)},
+    {W(0x8063f7e246398403), W(0xef26eb1a25563ead), W(0x28fc04ce4e4191ce),
+     W(0x3d5cc6fbb67e2f85), W(0xb16bfdbfa7f5f9cd), W(0xa8b75de0140e0897)},
+    0
+  },
+  {
+    {W(0xa5bc07e855882ae3), W(0x561513c3f468e28b), W(0x365e26f33f5ca0b4),
+     W(0x10ac6dfd284bcb46), W(0x616783ee7cea7379), W(0x1242b97f7c84d533)},
+    {W(0x004b285ba5106229), W(0x999e7e587ba36d89), W(0x04b43203e9642ca4),
+     W(0x47643e73c1043094), W(0xb39b944a3d1accae), W(0x57891965cec4b37b)},
+    0
+  },
+  {
+    {W(0xd68857e9a897abfb), W(0x6249172b5aa31569), W(0x46d99de8b3ce20a4),
+     W(0x2c64306ef48fc2e5), W(0x09677b90488640d7), W(0x057db7f9ab3094ca)},
+    {W(0x8dd6acced24e268b), W(0x35864b936322d17c), W(0x5e8d9e60c4dd5b69),
+     W(0xcfb5bf81e1901c8f), W(0xca55198b8098232b), W(0xbee1b4a42194eb70)},
+    0
+  },
+  {
+    {W(0x382dc67e6ffb60a1), W(0x6168c0a035628341), W(0x643d3fcf331b025f),
+     W(0x9d7ab871fd1e4e0e), W(0x115b1160199fa746), W(0xbb78097ff2134159)},
+    {W(0xfab2b952bd3b9029), W(0x6f5b61cf18e4f8dc), W(0xd2fa0997c4259292),
+     W(0x8857a058d9bfcb02), W(0xef74418a3dce79d7), W(0xdf355f710561af71)},
+    0
+  },
+  {
+    {W(0x471915d55a2095eb), W(0xe88a9a00f44f5e66), W(0x75b2b46392a78456),
+     W(0x4d1b89232d0378a3), W(0xa775003b1344c3ac), W(0x23e244eae6752666)},
+    {W(0x887ffe96dad131d2), W(0xe71a6b7623bef544), W(0x10ebdadb9a359c0e),
+     W(0xfb36e725f6dc27d1), W(0x55ea273a5787c172), W(0x97c045ec87069428)},
+    0
+  },
+  {
+    {W(0xd2f1a8f8379880f7), W(0x9a2ea8693289768d), W(0x7d18a3a98fef89e3),
+     W(0xfc128a5b2777c84d), W(0x27bbefd40b1758cb), W(0x57b29b3fbfaab3a9)},
+    {W(0x819281acb35adc2b), W(0x825fb0ea7e07960e), W(0xfc6044d1769e4740),
+     W(0xdc45d57186fceaa8), W(0x045b257f677a374a), W(0x7ebefd0c44398355)},
+    0
+  },
+  {
+    {W(0x42986caf2c0e084c), W(0x603f1defe93e1198), W(0x48b3f3649ab7075c),
+     W(0xca835deebd6e8427), W(0x0027e591a6016eba), W(0x53c1711dadf457fe)},
+    {W(0x149cd156dc2ff10a), W(0xc5ef1c693fb95d70), W(0xff1cc1c66d337f12),
+     W(0xddeb82aab4668fa4), W(0x8f3b41459671667a), W(0x00ab7f3c90e7926c)},
+    0
+  },
+  {
+    {W(0x1009c5e05d956c37), W(0xcac6ccb7f72d65b1), W(0x3046596469c66045),
+     W(0xb75eba74361a8433), W(0x9469061a0602f007), W(0x35eaa1c446ce88a1)},
+    {W(0xa1757a5e2ee88cb0), W(0x115123cee5e1a433), W(0x7c8dc01bf3856d67),
+     W(0xb057127b9f8f5125), W(0x4e4cd4db26b860a3), W(0x8823fff94d16c7f9)},
+    0
+  },
+  {
+    {W(0x77fe78294d8dbc30), W(0x409ab808f0902b0c), W(0x625f8041d4fb4275),
+     W(0xf40624dafcec3b45), W(0xd79731d71a659ebb), W(0x49882767361fa205)},
+    {W(0xbac5983b4afe0d7e), W(0x97e63ec19ac3b8a9), W(0x02247e67535aeaba),
+     W(0x3ff4c586a72f1aab), W(0xaf20a41724bb6aee), W(0x006d4efcdad3569b)},
+    0
+  },
+  {
+    {W(0xdbcffeffd3328a7f), W(0x04341cb5bc3f9b15), W(0xd2ce7ec823092117),
+     W(0x63c665c84fd2d9ba), W(0xb197b27ebc2a8219), W(0xa26732435cd2d192)},
+    {W(0x563ef518aed49f1e), W(0x884949924a4e66da), W(0x21b72bb2330baccc),
+     W(0xcdaf97df7b8f4b03), W(0x94e76d1ba9d7afb4), W(0x8bc0734085147082)},
+    0
+  },
+  {
+    {W(0x1547cebb0c9e0417), W(0x6c264204c767d4f9), W(0xa8240a2d58a2f852),
+     W(0x93f70f6f7a8fcd4c), W(0xba72e368526b4984), W(0x3534ac95ff306623)},
+    {W(0xe3bac4039597191e), W(0x46918de236e4b5ca), W(0x085cd145251a9b0b),
+     W(0x0d3ecccc1ed083a0), W(0x2c1e24c1546a14f9), W(0x01d9b532be16300e)},
+    0
+  },
+  {
+    {W(0x4812898dfeab4237), W(0xafd62a4a6c988242), W(0x53e0f4757d0a63f4),
+     W(0xe36869908c8c77c9), W(0x983443e80512783d), W(0x2e8106875f94466f)},
+    {W(0x8f74edb6896c90a0), W(0xe9ee86ff6f5b7b40), W(0x76874c40706eb14e),
+     W(0xc71428336e7c1d9f), W(0x82b83b9416c9f10b), W(0xde10fd1b3d29be7e)},
+    0
+  },
+  {
+    {W(0x0b21add4f7ae79d9), W(0x710a859c3a34d7aa), W(0xae3dea52833c9e76),
+     W(0x875e2c61f56bae43), W(0x7ea00758703a0192), W(0xf71dfc40ea716fac)},
+    {W(0x140ac1179b5f28f8), W(0x7e67bee203d019af), W(0xfa684b40e4ae7bb5),
+     W(0xec3a7eb03b99c7c0), W(0xd302f13b7c5baae7), W(0x76d73d6460a0be12)},
+    0
+  },
+  {
+    {W(0x89a9e6a56a8957e8), W(0xd62578857db0bef3), W(0xdfd990916d2e091c),
+     W(0x418036c7d7d23ee1), W(0x6cb27089d21734c1), W(0x68add56479bd2a90)},
+    {W(0xec1f6f31858d6dc8), W(0x264957c0309d9a42), W(0x867ff668406d5baa),
+     W(0xd541d0fe057b092a), W(0xe479ac43523f6250), W(0x4beb6509242f0683)},
+    0
+  },
+  {
+    {W(0xf3d5772673dad997), W(0xd44b39595c9712b5), W(0x3755584b05db1b4c),
+     W(0xc8077fa73c7c0430), W(0x9bbe9e24292a6c72), W(0xf1d1c894c71d4a23)},
+    {W(0x10ef5bd88caf3609), W(0x0c66630b562eb9ca), W(0x6502c93448a1df59),
+     W(0xe9744a7c5fce0760), W(0x2c5ba4da8c109fa6), W(0xfc9873221dcba834)},
+    0
+  },
+  {
+    {W(0xbf704ccbe2211b8c), W(0x9bb32984be92fab7), W(0x239cb3c6f8427e2b),
+     W(0x604e9ee00ab6695a), W(0xe87cc73253154db4), W(0xfc40d7929d113a3b)},
+    {W(0x782446a243701ecb), W(0xe3168024efda5e17), W(0xeb02d26b951ee1c0),
+     W(0xe5956f3d1f8a9d0a), W(0x5782ef49dab7507a), W(0x211cbff1c22a1f4a)},
+    0
+  },
+  {
+    {W(0x9d7b8cfc6a6c2d80), W(0xbb39241e88ef3774), W(0xb98184b897b77cab),
+     W(0xab23a85764d4c119), W(0xed18d21643724850), W(0x98afa901d036973a)},
+    {W(0xf0528c886979c74b), W(0x3023c60bb2e9d921), W(0x1e6c54e0a6f476e8),
+     W(0x367b4c330eebe37b), W(0xcb183414b7dcd796), W(0x440344a85d549b4a)},
+    0
+  },
+  {
+    {W(0xf12a753a87dd78ad), W(0x5965de269302aabb), W(0x61f7f8c6ff799b89),
+     W(0xcf7c64914fa7411d), W(0x3c013535ad9b2c9c), W(0xb36074bd04e38bf1)},
+    {W(0x48463a01c58257f2), W(0x4e96f14249d40f14), W(0xb1328a57afec9b6e),
+     W(0xe1cc19019ca218a5), W(0x90e4f6efab84fb75), W(0x091e3279c2ad86b5)},
+    0
+  },
+  {
+    {W(0x5bd5ab5effe321fe), W(0xb8685401bf0d044c), W(0x4d7086ae3f4fd506),
+     W(0x7ba4f3dbfe2b91e7), W(0x2bfe305ee3a38365), W(0xd1bfa58c52adf367)},
+    {W(0xfdf759ad77bf8774), W(0x0f644727c296af44), W(0x7099f1b3b1612439),
+     W(0xb13d4d1d23137eb6), W(0xc9a29c8a1ee53b79), W(0xb41cd474a7bf2514)},
+    0
+  },
+  {
+    {W(0x1a40396d7f14cc3d), W(0x22421695068eedc9), W(0xf989287fabd56dfb),
+     W(0x09f2757bbb6b2317), W(0x5f562abd7e56f0eb), W(0xa83563b667334f91)},
+    {W(0x84bcd2ef4799ccfc), W(0xf2584b4b12bca66c), W(0x8d153744b3165cc3),
+     W(0x716389fcdb2704d1), W(0x36913fe195f9620e), W(0x8cd8e0ef6abcab4d)},
+    0
+  },
+  {
+    {W(0xb7531dc893dedfa3), W(0x320ce03b6261c92a), W(0xf7171f70ee94e301),
+     W(0x76a8aebc27402a5e), W(0x427ef05be892f69f), W(0x7c66950ee1f6879f)},
+    {W(0x0ecc04d97fc4117d), W(0x4e44cacab1a4cba7), W(0xa60a724fa21a4a11),
+     W(0x55db596741652da1), W(0x210fd5373fab0ba4), W(0xd666295c435f29b3)},
+    0
+  },
+  {
+    {W(0x031b2e7d52e218b6), W(0xd3dea17a578f438f), W(0xdd5f588db3129724),
+     W(0x288eae7b28751b6e), W(0xcb63f15b8ed56c43), W(0xabc3eedcf12f05ea)},
+    {W(0x80fb9a6cae05fb7f), W(0x966edf5a1109ff06), W(0xcdf62b2e3db2fe1d),
+     W(0x53da3e7f69cf2927), W(0xdbec0f1cd66cfc4e), W(0x797088c814c73ca1)},
+    0
+  },
+  {
+    {W(0x1942d5d4a6eefc76), W(0x74b10e8ce90baa2d), W(0x0576a381ce52fd4b),
+     W(0xce780055df63ab21), W(0xf924402473aa0367), W(0xe292168367e25614)},
+    {W(0xf3103e2d4814e9c2), W(0xf7b28bd38ee41446), W(0x197ba3977445cbea),
+     W(0x13e83af1d3c12612), W(0x7fc1cda9df9b2f21), W(0x6b83c849eb84fa98)},
+    0
+  },
+  {
+    {W(0xbf4df38c9d776a7f), W(0x87129f319b28dafd), W(0x80f36f693b845a30),
+     W(0x91e7c23aea46606b), W(0x89d821b89b4fcbc3), W(0x96ddaef2f627c8ac)},
+    {W(0x4a515f0a565b9bac), W(0x88fee0a31cf274be), W(0x1e10785a1c3e5f10),
+     W(0x438380fe00417c4f), W(0xac9ae8864104f2f3), W(0x2c858d04f8d34c83)},
+    0
+  },
+  {
+    {W(0xddf17326ae7062ca), W(0x25755820461eb483), W(0x0acdaf613c2138ac),
+     W(0x4a77e7aaa381aa12), W(0xae2621338bcf1c83), W(0x80886ae2501d16a2)},
+    {W(0x14d18eb4529dcc89), W(0xa1763fb32965dfeb), W(0xe48b583fa98ab8f8),
+     W(0x55310a5bbc40db9a), W(0x489149e29dc9aec1), W(0x2bf081226e118e97)},
+    0
+  },
+  {
+    {W(0x0cd98bb0743c4dca), W(0x64efcea9d5da0a90), W(0xe6fbfcf6a70073bd),
+     W(0x773c2f92b85b685d), W(0xf04fe26cc3becda4), W(0x1e26a0e04bbb5db6)},
+    {W(0xf76f454cb38a8ae8), W(0xfec0e3c3d1857b05), W(0xaa274af89702468a),
+     W(0xa579a3ff3ed4d9cc), W(0x826fc50994137827), W(0xd307d7b7da98b561)},
+    0
+  },
+  {
+    {W(0xa5f5b2b581a8f1b7), W(0x9bfec00a00ee85c1), W(0x6c1694528bb6e401),
+     W(0xb23bdb6cbfc3b13c), W(0x459ef29501901d99), W(0xe94a20a5d46ae5ce)},
+    {W(0xd44c591f662586ab), W(0xa6d01e7ecb8f2796), W(0x294643d383a37a49),
+     W(0x225a65ac0766f5af), W(0xd55cdf3120e3ed40), W(0x1ffe3e6882dd1c78)},
+    0
+  },
+  {
+    {W(0x012a4cada07a0855), W(0xfc8dddc7a462c41c), W(0x3ddb7163bab14fa3),
+     W(0x1d74bd64a50f3fb7), W(0x0df6ce2259ce4522), W(0x22ec7b8e5e687a85)},
+    {W(0xb976d95ac923c6b2), W(0xede0f7ced69df701), W(0x43e493911f6038f2),
+     W(0x499fa941683fb06e), W(0xed4ed85848576a0c), W(0xc7ece1a6a49c662c)},
+    0
+  },
+  {
+    {W(0xec5b672df97554c4), W(0xe00e88983d0b0fec), W(0xa3e01389f8389f25),
+     W(0xca097ee51cd6e820), W(0xea53193f90b6f78d), W(0xa4e70e0d3851831f)},
+    {W(0x686cfe5b9cba0838), W(0x408c2d99d0cc3535), W(0x2aa94af59fd5ad7d),
+     W(0x90704baf3a6b32f4), W(0xaa6d0ba0aca57f56), W(0xa7b6bccf244509ae)},
+    0
+  },
+  {
+    {W(0xc8a96b3f8c82d53d), W(0x4ba7d5ff739857db), W(0xad20b4327bd3f1c8),
+     W(0x9141d37c6da0d815), W(0x7b5d28cdd38ccee2), W(0xaa645485aa05578a)},
+    {W(0xe8c0b79f210162da), W(0x71537eb6ccd95006), W(0x9016cc8a3e9b78f8),
+     W(0xe489e8492ff40592), W(0x039cfa0912d265cd), W(0x99542a7c759e1133)},
+    0
+  },
+  {
+    {W(0x511cd0875997aeeb), W(0x4f25b872ac03d3e4), W(0x6868a2383e46d91a),
+     W(0x3194b442b95649d3), W(0x48b9852113f783f9), W(0x97788b62d7e9f072)},
+    {W(0x47400729a9ff379e), W(0x74ffc13b400cc50d), W(0xa4c906ef58b2c1b1),
+     W(0xec5e2044158678c9), W(0x0c594444b815ac5d), W(0x6ccb6f02f420584d)},
+    0
+  },
+  {
+    {W(0x55788e504b4ac5f6), W(0x4d04f3b1c1017992), W(0xa73687d7be319555),
+     W(0x6e487351079afd00), W(0x1a56a0d7cb2c9eb9), W(0xbaebd88a4bf01c15)},
+    {W(0xf8b4c0958295d4d5), W(0x4e1fd029d512d70a), W(0xf89dabb33502bc0c),
+     W(0xe2c2041ea27ea55b), W(0x5181dc7e227ce74d), W(0x505cbc5196855fe9)},
+    0
+  },
+  {
+    {W(0x2547cfacc5493d10), W(0x2274865aa56b061a), W(0x37ba7c3280d976ae),
+     W(0x506c1dda12d16c56), W(0x31e16b8710c765be), W(0x11f935677e7a634b)},
+    {W(0xde3163a89a739aae), W(0x858394a89d2cbcf6), W(0xac0dad8debbc5b23),
+     W(0x50299032d6860e53), W(0xf4e186a2e46e7b03), W(0x5b8735e0624673e7)},
+    0
+  },
+  {
+    {W(0xaf31e035e2dec696), W(0x1efcd25df9966b38), W(0x0a326333754b9432),
+     W(0xc85f480c33ecae1f), W(0xcdd769ff2293810d), W(0xd4b36b555b9cf4d6)},
+    {W(0xfb6b7cbcdbcc2821), W(0x7033c9d924890865), W(0xdcbd38ed8c8f8f65),
+     W(0xe80a99e667145dc1), W(0x32121dfbfae1c9e1), W(0xdcb086129e223992)},
+    0
+  },
+  {
+    {W(0xcaf381bbe2335108), W(0x027e8452abbfc84a), W(0xc56879a70e279d18),
+     W(0x5a1af7c70bfc38c2), W(0x35659f3ffd433dd4), W(0x815f83eb8e30e528)},
+    {W(0xd93a15bafc588c05), W(0x01e8266b6143ab53), W(0xd7d63659191a5463),
+     W(0xbf33c0e6a78d667d), W(0x064ec2e7dfcf56e3), W(0xe7a8d7e4b751ddda)},
+    0
+  },
+  {
+    {W(0xe09edd7dd6f4a614), W(0xdae00d0f7738b593), W(0x8699324d3398b6f9),
+     W(0xb49edbfe6f7f5bba), W(0xffaae2be201c28b0), W(0x959f8cf95b7b1c66)},
+    {W(0x766b4fcedd37bbf1), W(0xd4fb3e6342bac923), W(0xd322d2eeba7148da),
+     W(0x4c9cec6de89f8432), W(0xfc1032a0036de698), W(0x4b880863195d9146)},
+    0
+  },
+  {
+    {W(0xdfdb789abc9b476f), W(0xb1ea86110fd65a74), W(0xaff6b143395ef935),
+     W(0x56642a39d67dda05), W(0x429416128e664dbc), W(0x6df8a6c95e48793f)},
+    {W(0x03c00d5522fb3e23), W(0xbd3738027745b5f2), W(0xc8c77cc5e0c1bf38),
+     W(0x532ca0e53c44a934), W(0x9fa26246eedcfee5), W(0x015e0c634f7cb031)},
+    0
+  },
+  {
+    {W(0x9f28704393bbb315), W(0x5326a516e34d0f0c), W(0x2de8aed3bb367c51),
+     W(0x041bf998e51fc44b), W(0x52ce58ab3f6d0d97), W(0x1f6cb8e1f13ef61a)},
+    {W(0xa2a9688833200f92), W(0xf553bb4d359a5115), W(0x4a06110aa29fb515),
+     W(0xe16890b4d1688526), W(0xe3851df6ed83b1f9), W(0xd6816f4cb01fb0e3)},
+    0
+  },
+  {
+    {W(0x0c19082d30ee7467), W(0x5fbddd8d3e4c0a08), W(0xb4cbfd515690ec35),
+     W(0x001fe6af97a604b5), W(0xe99c202a3a93b7aa), W(0x164ad261dee50525)},
+    {W(0xa47bd2b4bcb8d438), W(0xe698f3c2b520792c), W(0xb19c2196e54d5820),
+     W(0x5afd6b4b123097d5), W(0x174ecb4f0b9150e9), W(0x6b11934290627878)},
+    0
+  },
+  {
+    {W(0xd0060a0cc18e6a55), W(0xcc519bf7523d5ac6), W(0x28373b7b519204d1),
+     W(0x3e05252f74ab4eea), W(0x437b5d684b83717d), W(0xaba697b5d894518b)},
+    {W(0xcdc1b6e2ad936550), W(0x87a516709db859c3), W(0x685f2c7fe39cde77),
+     W(0x46be721470e1186f), W(0xbd21fba380ba6196), W(0x649c06074b3c06cc)},
+    0
+  },
+  {
+    {W(0x028bbb0ae2b3ff58), W(0xd930d2ec46b58965), W(0xfe251aa69d164eed),
+     W(0xd98432414c229a66), W(0x08fd5b14a81daadd), W(0x07c3d8d9b69af910)},
+    {W(0x194f71a3562f25d1), W(0xb3fa93a80298e1e3), W(0x5e4f5f9c8529a60f),
+     W(0x105f3de4111b5a48), W(0x0cc2449a8c26b7ca), W(0x95d0b9691def5acf)},
+    0
+  },
+  {
+    {W(0xec978cb8addf4512), W(0x28f35447b7ddf18c), W(0x03746064c4b8abca),
+     W(0x1c84081a4d2b3c83), W(0x4972251267fccf27), W(0x1ff13c438a260292)},
+    {W(0x1482510dfbbf98de), W(0x9b72507fe212c6c3), W(0x1bd25ec1f0339e96),
+     W(0xa9036ad2fb807a29), W(0xc3365fedb9248cc0), W(0xd3a8c62e0ab922ba)},
+    0
+  },
+  {
+    {W(0x1b9349fe4cfda2df), W(0x19eb3c4e020874b5), W(0x0907e0d97d68bcfa),
+     W(0x5487219a18829f44), W(0x30122c125ff224c8), W(0xcb28ad77440df5c1)},
+    {W(0x9bf41fa24272285c), W(0x0e59d72120c1bd99), W(0x76f81690763bba16),
+     W(0xf934caf5550999f9), W(0x9d5c1dea76306ec5), W(0xff86d04da8a9b868)},
+    0
+  },
+  {
+    {W(0x42806155b3a29524), W(0x719a5d56ebaa78e8), W(0x7851caa9602b9cc8),
+     W(0xab2637383e568f98), W(0xb59639bb925f2b2c), W(0x33deb832a33f50ef)},
+    {W(0xad57200ffafd8e73), W(0x8282e5842474802d), W(0x7817b1b0fa47a66d),
+     W(0x0b01db2c9d7a7540), W(0x714a5f6a636a242f), W(0x115e620954d9d30b)},
+    0
+  },
+  {
+    {W(0xb33d9e5bebc66553), W(0x358eadde4cb0abf0), W(0x51374a2b62cee718),
+     W(0x23d6280a92fdeae9), W(0x063f8979126cfbfd), W(0xf8066763f2045724)},
+    {W(0xe2f7395a21f58f25), W(0xf4cfd8302c4d3cf2), W(0x277070fac2657573),
+     W(0x090026cbf76f0122), W(0x3e4078f02662501c), W(0x6aca5d46b043978b)},
+    0
+  },
+  {
+    {W(0xa8489e1808b68382), W(0x925b7152166e3c48), W(0x0751daa94189f445),
+     W(0xeac257558b9ce6a1), W(0x21d59e875809bfcf), W(0x27534b96890477d8)},
+    {W(0xb3341bfa537dc71d), W(0xe8f253f645061fa3), W(0xd160422abbb5c149),
+     W(0xc78dc2682acbd350), W(0x040591d2d23d42ed), W(0x25a6c3674a967422)},
+    0
+  },
+  {
+    {W(0x543e99549024321c), W(0x4d60bf904b4242df), W(0xa49393e9c2616ef2),
+     W(0x1d7e4888365d016e), W(0xa785f924099861cc), W(0x317b85342ee24ce7)},
+    {W(0xa2e1747be3b27dc8), W(0x0f24686ccea21240), W(0x8aa9485fdabee51b),
+     W(0x7c4dad54c2550665), W(0xc53872caf5b98c1b), W(0xacaebce6694cdd18)},
+    0
+  },
+  {
+    {W(0xa1976cb0d8d94281), W(0xe18be492b10352c2), W(0xbba2495d6ad016d3),
+     W(0xfffa2bd82c7ef4e2), W(0x7efe74177a4bee64), W(0x4b773edd05e6607a)},
+    {W(0x7e56882646e33bc0), W(0xa23f84a7fad16d41), W(0xf0616af9aee7216d),
+     W(0xeac441a233887fa9), W(0xc9d0e020090f7229), W(0xc34145891f73ca94)},
+    0
+  },
+  {
+    {W(0xcf3c60f09ba8a7f3), W(0x3bf22219fad7919f), W(0xfa7991a6587b715d),
+     W(0xa04a1a7cceb687ac), W(0xec54a20350b0ef5c), W(0x0f15d967e55115bd)},
+    {W(0xfec530434cefda3d), W(0xbc77dd03b0f2d9e3), W(0x2406d193f66bb3bf),
+     W(0x12d96e0c501a7391), W(0x01802a63c8668400), W(0xd0561073999a7d12)},
+    0
+  },
+  {
+    {W(0x97de0992aa3cbeaf), W(0x40f135b8b4348134), W(0x8b9e15af9686dd5e),
+     W(0x3594c0540ea9d124), W(0xb69651b81bc45830), W(0x6b712ed024eb9967)},
+    {W(0xddfee4fa532cb1f7), W(0xe0f68cd2c4392db4), W(0x84143072ebe56d2b),
+     W(0xfbf7b4fecbc290f2), W(0x94134dfeec291fef), W(0x3fe76f115f8b545f)},
+    0
+  },
+  {
+    {W(0xaa9fb0d4aba80c67), W(0xa6bf9def08a6cd63), W(0x48b235ad605f7505),
+     W(0x350f5138fb7450b4), W(0x82d3aca13ace3e04), W(0x04de72a440238d13)},
+    {W(0xb8569570e8caf229), W(0x7424d779d123238f), W(0x56ad96b83d5af0a3),
+     W(0x10b0c80a26d57e71), W(0xdf7143db3c44ac77), W(0x4815fd9b2d276d62)},
+    0
+  },
+  {
+    {W(0x51f103ef3e128fdf), W(0xe13b0bfdd62e041e), W(0x49c8818a8e15f4b5),
+     W(0x531f1441d6a61bf2), W(0x5d5ac96525f9b44d), W(0x1a7da2a2cbc0d34a)},
+    {W(0x279bdb451d6702a6), W(0x945b3eed4b2200af), W(0x168fa9f2cbd37913),
+     W(0x2e9d1fe0a79dccec), W(0xed6748bd9d2cfeb5), W(0xbea7f5505db70b93)},
+    0
+  },
+  {
+    {W(0x8f4af263a499f406), W(0xcc77dd9e5409dbb3), W(0xe10c62f8f9428a58),
+     W(0x8756d37353f0a946), W(0xf70c6bd5346401e3), W(0xb42e98999e0e72aa)},
+    {W(0x757b22d535088055), W(0xfb07c737c7e44c73), W(0x0bc50413c2522303),
+     W(0x473fbb70b1f171b2), W(0xc62b07a8588217b4), W(0x37d0a2fd228fe595)},
+    0
+  },
+  {
+    {W(0x850221221379956c), W(0x52520e4863747d84), W(0x2200998cb4c999f6),
+     W(0x15f5116354f783ee), W(0x33005c13ce3bf3d5), W(0xf7abb011a9b60294)},
+    {W(0x74518c2520a5b969), W(0x1b08adc044c0db84), W(0xe1cc26a3ca5e76a6),
+     W(0xe3c766baa88fab95), W(0xbfc32b683d70becd), W(0xfde0b16f0a59014b)},
+    0
+  },
+  {
+    {W(0xb5b58f1136d00e76), W(0xd93ac5f67ed2c9ed), W(0x47950588cab13551),
+     W(0x05ed0aa54c0ebde7), W(0xe04c93e9f642a49f), W(0x7358b9376a161017)},
+    {W(0x19b3b6e3e58ca34f), W(0x84f96f0bed919cad), W(0x7cbbc778e5c9f2e0),
+     W(0xbf4eaa3b56ad7577), W(0x9baf2e877d1eca46), W(0xd7e34146fad0eeb9)},
+    0
+  },
+  {
+    {W(0x1545ce1ec2d04b77), W(0xcf2fb4e5f491c02b), W(0x47a4645ad1c9c956),
+     W(0x6bdfae1c309da4c9), W(0x5e1cdc8d91d34d58), W(0x9cc192664f5c276a)},
+    {W(0x1c25207f16910404), W(0x9f332281dd8cfbc3), W(0x4c5b23db04f4b8b6),
+     W(0xe3315550d3fc5493), W(0x4a4f29e41f07d89b), W(0xd0fee27c60c5f180)},
+    0
+  },
+  {
+    {W(0xe8b48081f9d2000d), W(0xa08e3f98628403ba), W(0xe527f34e0d1c5e3c),
+     W(0xbe4e1fb9b986f40d), W(0x3fbfa36e1ba53537), W(0xace7cd7b57f60bc1)},
+    {W(0xd286e29866170285), W(0x7b03804d272fdf50), W(0x3ea3f3bae4f6345d),
+     W(0x816be21e96ecf9d1), W(0x49658f57050e6961), W(0xdf25fe411bcb1fbe)},
+    0
+  },
+  {
+    {W(0xbcd11cb34317d4d0), W(0x1ec80229ab8a8e6e), W(0xbc0c26a24c39d91d),
+     W(0x8ac59b51d7160436), W(0x9f3a08c5b3e6845b), W(0xf1beb306df501b6b)},
+    {W(0x796520134af6f5d7), W(0xd90ea260eb49abd9), W(0x55258dfc3820e327),
+     W(0x3efd00d68cad16ac), W(0x1da93a9e3012a279), W(0x59d346fc7bd4702a)},
+    0
+  },
+  {
+    {W(0x099ca16cb89f3b9f), W(0xe6506c574f1bd752), W(0x70ebc9122d56c4b4),
+     W(0x75cf2b0475ee45c0), W(0xdb0691e8234cc3e9), W(0x17f076b0a0160297)},
+    {W(0x91a33fa856188155), W(0xa9b072bec4bed159), W(0x8c957566813602fb),
+     W(0xd9427888dfb35b2e), W(0xbd31f6d844483951), W(0x6ef09210f7998779)},
+    0
+  },
+  {
+    {W(0x7133e2a3b25a92f1), W(0x540e5d9bc415e9fd), W(0x3a2d7055833cd1ca),
+     W(0x51f240e28eadbfc7), W(0x3136079462a2df6e), W(0x9c8c4dc42316c286)},
+    {W(0x9abe61d5fd8fc238), W(0x7f36c0d809f3270b), W(0xd3d4f9d7576947e9),
+     W(0xb2671502d8a4bc27), W(0xb898e93398e0e306), W(0xa549801a2272527a)},
+    0
+  },
+  {
+    {W(0x4173c3846301e99a), W(0x72c5402bf683e952), W(0xddbac71ffaa45bbd),
+     W(0x226768f4eb41e478), W(0x0975ebcc3ca8801d), W(0xf7926bb2e33dd38b)},
+    {W(0x449f440dec5fcb72), W(0xdd6f9f23af504cdb), W(0xfcd8d1dbd3d71159),
+     W(0xd4ddfee7f5e059d0), W(0xe2ea8b88c0905a5a), W(0xdd606454c0de371a)},
+    0
+  },
+  {
+    {W(0x18d71a2241293ebf), W(0x2ed7baf25fdc6d72), W(0xf22b3f504f3424fe),
+     W(0x02e86774e28a78af), W(0x534876b1cb306078), W(0xfc17c01841a19a96)},
+    {W(0x51a0c2fab32d0c65), W(0xf7972df2f8e12dee), W(0x0cd3313410b4a666),
+     W(0x74aff2d8b6004d81), W(0x823e690f1a1c175e), W(0xfb00b86df0b1b31b)},
+    0
+  },
+  {
+    {W(0x42f8bd1f19aab542), W(0x7a8254c0bcf77c33), W(0xcb4f2ab7a2c3184f),
+     W(0xb1b60a02db6da90b), W(0x6b3f3f39b81d1946), W(0x9f6222372be94d56)},
+    {W(0xaf9259234e84e27f), W(0xbe090c7b4e0efd58), W(0x7ab5e4bfc16cb472),
+     W(0xb256d87223c60720), W(0x0f3213d659e574f2), W(0xf44af9d06271633d)},
+    0
+  },
+  {
+    {W(0xae05ca0e73172a6c), W(0xb55d5149d3b64207), W(0x88a7f7cc15d160d6),
+     W(0xd0eb57cdc996e258), W(0x439c944840c08d55), W(0xd3e769cd557dab8b)},
+    {W(0x4325f3ab41114a37), W(0x29fdb03d57514b6f), W(0xf2f6108848ea2c67),
+     W(0x426ec8d465f0c5de), W(0xe4c1a245bea70d80), W(0x507c78d4305d1462)},
+    0
+  },
+  {
+    {W(0xe9faad33427b1e79), W(0xee7fadf24d25e036), W(0x786d7dcbf1f41a5d),
+     W(0xb55c5bb6b669b1f9), W(0xb6eb096b3d700bb7), W(0x2859c7684ce13381)},
+    {W(0x26571ab5184815c6), W(0xd79a249ff81afd69), W(0x09d97c10d51dd5de),
+     W(0x3bea367ad292c69f), W(0x63ab5b13efa7cab4), W(0x148bff51cd9e50a8)},
+    0
+  },
+  {
+    {W(0xd5f53419e97ae375), W(0x41e7748ff68e3ab0), W(0xe071f84bdd0441a2),
+     W(0x63544b605f6cb7e6), W(0x333d1c68b69fcaef), W(0x30be2e43ade4702d)},
+    {W(0xcdec903f18e1cc16), W(0x853e9dd375eddadf), W(0x0a480bb3faba5d7a),
+     W(0x7b84b370dd0b6714), W(0x0b3cfdb48e369aa1), W(0xdf866151e987c05e)},
+    0
+  },
+  {
+    {W(0xff7135fcff679e2c), W(0xe22f7ffa45a948b3), W(0x301d6350adda1f0d),
+     W(0x3f7baed7e7bcfc41), W(0x6a609f8fa1a4f28a), W(0x68fa9f301776f3b5)},
+    {W(0x05c4b28ab00cb852), W(0x28f6e820c2cf9f92), W(0xab01c8ed8ef8c29a),
+     W(0x57344797a99072a8), W(0x891c54fbcbaf3668), W(0xeb7002e08d3a8a75)},
+    0
+  },
+  {
+    {W(0xd4e43a65587d62e3), W(0xb4437db68cbd8d62), W(0x392f68b63b007a7d),
+     W(0x7d89c468aca1f0d4), W(0xdc271c7415f0fceb), W(0xedd6663b5cda9735)},
+    {W(0xd2f720ae332a10d1), W(0x430e70f09284294e), W(0x5d1ae876a73ab7e9),
+     W(0xd071894874ad67b0), W(0x51954d9fb282d455), W(0xc9c05c06ffb83bcf)},
+    0
+  },
+  {
+    {W(0x903137360efd2c5d), W(0x7cc9942714040f00), W(0xcf433a8f3ec99e5d),
+     W(0x1804aa7bcec89f0a), W(0xefb0b1c248a79e32), W(0x518b4c86c657cbc1)},
+    {W(0xa38691f4a2d9882a), W(0x1f06ccb9cb49e108), W(0xc497b2f3af10e9a8),
+     W(0x3da7881c1b204fec), W(0x938d0d1ac9e320ae), W(0x76c2735c1a0f8a5e)},
+    0
+  },
+  {
+    {W(0x796844f897f0b8c8), W(0x023c6bfa9ec283f2), W(0xfd289d09660e6c4f),
+     W(0x2632402706f802f5), W(0x4fdd04d45809f892), W(0xf491d61751c353d0)},
+    {W(0x15cbdaaeeac9b588), W(0xfa79c2564f2d53f8), W(0x2f8a9667b612e0a8),
+     W(0xef711e5af91eb532), W(0xf57850d34a5fef2c), W(0x444d96976cd36e9f)},
+    0
+  },
+  {
+    {W(0x6dae3e425d4de359), W(0x4a99e651a470ba56), W(0xd650808dab0632ad),
+     W(0x0d8ba8d347aa8e84), W(0x52051ae3fceb9087), W(0xa2854e2a71580181)},
+    {W(0x1f3e15aa8c210d88), W(0xcf1d4301f20c927a), W(0xcbad31830e11b78e),
+     W(0xe964c42ccc6c39a6), W(0xbb4d24b586921e5b), W(0x54ecc7474e2b2a29)},
+    0
+  },
+  {
+    {W(0x4b22587c8e6d811c), W(0x2ba9e00b212dad2e), W(0x3129d8c5007cf22e),
+     W(0xe2b713e9f543b6e8), W(0x9a95d6fcff9b0a56), W(0x28515f7139d060c8)},
+    {W(0x4efb0262957e6fcb), W(0x724b43d9b91d9377), W(0x373bbc2833d66b43),
+     W(0xbd4511ec717aaa53), W(0xc92fd1e5b5de7b1c), W(0x63bc269820e98aed)},
+    0
+  },
+  {
+    {W(0xd7fb36aaaef54c9a), W(0x4a89338945f3f00c), W(0x9fc6311770dbed43),
+     W(0x87f9f7feb9d4b803), W(0x410be557d2110aa9), W(0xabc464bf9da0e262)},
+    {W(0x9fc7eb57865c6c95), W(0x885187660aa5ab90), W(0x1b7cdfbcefc0bc1b),
+     W(0x8ecdd4fd36ee2079), W(0xb5d689639740dba3), W(0xc8d0abc6beee6dfd)},
+    0
+  },
+  {
+    {W(0x6632ca413f6ba419), W(0x637b531fbbe67e33), W(0xc72fad58e95a2de2),
+     W(0x4142addcdcdd8c97), W(0xd60c61c38eb2c33f), W(0xc8dca26ff1c49a6e)},
+    {W(0x0303614f281423e2), W(0x808007639ceacd78), W(0x3ba50164996608ee),
+     W(0x4327bbfc7d251c8d), W(0x3e861083b19b0b6d), W(0x47da0d4a37895254)},
+    0
+  },
+  {
+    {W(0x462b6cb70a983285), W(0xc38830dc8cc11631), W(0xb4198a84483289dd),
+     W(0x1d85b70c4149d491), W(0x4fb319f3602eaa69), W(0x0d7f9b97f96e356d)},
+    {W(0xa349eb4f12980548), W(0x4bdbedcbe78b711d), W(0x97e2cd6a8fe2af4a),
+     W(0x17c6d9f86672b784), W(0x8c21e7c9dbe6c5b2), W(0x5fb122cf7a3e2db4)},
+    0
+  },
+  {
+    {W(0x54bc0b4d76ea9d0d), W(0x73db744dbd08b736), W(0x391a9eb3805cd354),
+     W(0x287d21d5ac8f2a6b), W(0x9195361b51f57d67), W(0x8d21915a89dbb705)},
+    {W(0xf894a3b5e3733b03), W(0xbdbf2934301c9122), W(0xd662bbf093972421),
+     W(0x5108c44a99046d74), W(0xd45956edc821a3db), W(0x43f061396f7c2ad9)},
+    0
+  },
+  {
+    {W(0xd8fe661b85a86b57), W(0x2bc4ba313d835f11), W(0x7ec72c5ce753410c),
+     W(0xa3d5971fb0333470), W(0x7c480190ca4936bb), W(0xc17fe9936456e861)},
+    {W(0x91bdb98b6a9c3a56), W(0x35f1af12e914ea86), W(0x07206f19a0e74539),
+     W(0xd282e6c9a51a451e), W(0xc077048f5302a237), W(0x2e44df4f0229ddbb)},
+    0
+  },
+  {
+    {W(0x9593e1ca6c09a0f0), W(0xa9f5529de56a7a1a), W(0xf7bfe454bb7c96f4),
+     W(0x14753e16ab020d26), W(0x985a366c01b46c74), W(0x3f30ec9719df7629)},
+    {W(0x1992c258ce50d42c), W(0x98b793e1dc6f25dc), W(0xb6240c8d0ad1cf20),
+     W(0x45fa3957f8b50875), W(0xf52ba2f56264cf84), W(0x48a3d41badc6997d)},
+    0
+  },
+  {
+    {W(0x1e1a23bb872a356b), W(0x1051e2a3d9f117fe), W(0x6586d85bd47629c0),
+     W(0x1b3d80bdf9980db5), W(0x8c1f877b13091c65), W(0x461aed7bdc6412e1)},
+    {W(0x7fcd1c421efa2bbb), W(0xb5d06ee3436086b3), W(0x142af22bb1aa21b1),
+     W(0x4f36cb5a9b6546d3), W(0xf5ca7c1b98324f70), W(0x0db8f2da42b9b5ce)},
+    0
+  },
+  {
+    {W(0x55520615a71b14a6), W(0x4fb6b4e907ef6673), W(0x46539eb1be3bb66d),
+     W(0xa3bbf97e000b647b), W(0x3cc74ea5ec32242b), W(0x4cc8314b2dfb1baa)},
+    {W(0x25aeaae23b07b018), W(0xd00d493db6d6583c), W(0xfed54e65d3907ddf),
+     W(0xda82e5b7273ce139), W(0x4062e9345d276f83), W(0xfc40765c5a92883b)},
+    0
+  },
+  {
+    {W(0x3b16b11ecdf54823), W(0x56eec7e202a1993b), W(0x07bc8995f217ff3d),
+     W(0x4f4dca7548f63709), W(0xae67e88e5e19e3ca), W(0x035dc1f661ea2e35)},
+    {W(0x9acdf65dc906e134), W(0x06028b26b216a38f), W(0x8d2aa477dddfe57d),
+     W(0xa97e845b11d20de0), W(0x5eb7d9422b0e2209), W(0x65ac1878278d5810)},
+    0
+  },
+  {
+    {W(0xb60af293106e7661), W(0xbb4528a68cd66821), W(0x1f16a9f6926e7ac9),
+     W(0xb9c8a42990460750), W(0x4cc346c3110f33ba), W(0x8da04eb6bed9667e)},
+    {W(0x5478a8976342f4df), W(0xb9c5ace958e25bee), W(0x208370e451046331),
+     W(0x182d83c7230926e0), W(0xfb76ba1b16b70bae), W(0x6bb9ac79499f1826)},
+    0
+  },
+  {
+    {W(0x508f21afdd7f4e89), W(0xd0fe470fe55d7ba1), W(0x75b1e876f800f7c2),
+     W(0xab96b0d77c11ebfa), W(0x5c38a4b685ac005b), W(0x4e62eb072a767f02)},
+    {W(0x4565df38d529cb6f), W(0x70e72f5a92237b51), W(0xa418b5015f0c8e6b),
+     W(0x2e5be7c7a59a95e4), W(0x8966793d94ed5a68), W(0x41248ffaf3933aeb)},
+    0
+  },
+  {
+    {W(0x369c13ea742e2614), W(0x0c2832e2a62c35f3), W(0xc4e10eca16a40535),
+     W(0x85565650d33b4e6a), W(0x31e09fd5ca9b1809), W(0xc31910acf770955a)},
+    {W(0x351eb52f38604402), W(0xbe6928ab5e8cf992), W(0x20c9c0fd763a0d68),
+     W(0xbeb81fd705cf2226), W(0x0c4df9ad20015095), W(0xda78b3f8ca3d5990)},
+    0
+  },
+  {
+    {W(0xb9e0138102a113e3), W(0x9d35e4149a5043cc), W(0xef83b2484647d619),
+     W(0x5e936b8d201e17f0), W(0xe433dcba1c00bfbf), W(0x8d412b17aea85ecc)},
+    {W(0x34e2439c1376cece), W(0x0057b3699105e1a6), W(0x8675546db40ee4ce),
+     W(0xe2291cc2c2e7b950), W(0xa85ea733979d0dd5), W(0xefc57a54b6611876)},
+    0
+  },
+  {
+    {W(0xc575eed2438d012b), W(0x752b88dfdb34f693), W(0xdd6a12ccb9f3edf3),
+     W(0xfe4b75b486278556), W(0x4ceff3773d7bf30a), W(0x5d0cb8f0be248e68)},
+    {W(0x3a0ccc0bc30dc56e), W(0xaf15ed264165f88d), W(0xd351dfa3464bd3f5),
+     W(0xe62aea6a6a0ef273), W(0x127668c7ef8b5e45), W(0x4e66b9b746fc0973)},
+    0
+  },
+  {
+    {W(0xeaf7e8249ef47c4a), W(0x12e1a24885216f4c), W(0xe2c028e901c89038),
+     W(0xc3be98edc503650c), W(0xfe29895df732e6b0), W(0x2660c31fc5cd3f2c)},
+    {W(0xe1e500d0ff16afd9), W(0x6923c7c356663cde), W(0x5ffaabec9262ba40),
+     W(0xabba482c3c11b7ec), W(0x014006749d07fa49), W(0x93a3c15e0391f935)},
+    0
+  },
+  {
+    {W(0x6c8b75cae2ecd4a3), W(0x86d344beccf30ee8), W(0x89d45abcbcd3846d),
+     W(0xa302b8eec4849a4f), W(0x9d3537ef336313da), W(0xe3255b2b00340eae)},
+    {W(0x565ca72341ace098), W(0x8d8fea20ff938764), W(0xd1cc7b073a2fc426),
+     W(0xb1db539eec84afb9), W(0xce88591da6bd2bc1), W(0x74cb0059f25c604d)},
+    0
+  },
+  {
+    {W(0xc5a2a14419f38546), W(0x31db46420cc10247), W(0xe2ce290c106da6ba),
+     W(0x67d49e0908228746), W(0x88e4ea97301c9000), W(0xd6914cacd8b6b6e8)},
+    {W(0x8c5cc09813bac4e8), W(0x3a7d1d0f3604c131), W(0x29ce4fbeb668a199),
+     W(0xd5014de58b0e204a), W(0xd4d1ead7949c248c), W(0xca864699cd3bc6cb)},
+    0
+  },
+  {
+    {W(0x1a4a199a6c803c1b), W(0xb4c27ba98462d9d0), W(0x1bcb0fca6a9d0756),
+     W(0xb3af7da700f08384), W(0x5ca54126d65904bc), W(0x6f28a0d1025367e3)},
+    {W(0x74d5ca2bc64e76bd), W(0xc9541ed854731dd5), W(0xd826b96883378e93),
+     W(0x39e1e0beffcf1afd), W(0xb1c31b94678a06c6), W(0x24b62e9ad46a70d5)},
+    0
+  },
+  {
+    {W(0x7d0fa51e29ee131a), W(0x93b0060a7974e40c), W(0xb48ad794145317bf),
+     W(0x1a7618a9af0e349b), W(0x64c8de0088c74766), W(0xa8dc049983cccd94)},
+    {W(0xa745d173d3901bda), W(0xd2fc7390407ae364), W(0xd29a8704101ac045),
+     W(0x2897e1931efecb9f), W(0x52e271857df33076), W(0xd13e5fd028efe961)},
+    0
+  },
+  {
+    {W(0xc86f373ce6064ec4), W(0xc045bc432724fb2d), W(0xd9327d028be486f7),
+     W(0x8729949c8daa1df1), W(0xef12f9ff1670f09d), W(0x11920b144c5ac586)},
+    {W(0x6383900c9cbd4fb9), W(0x8228523041cd95e8), W(0x863043a3725593d3),
+     W(0x2f8827fc2a13e784), W(0x20ca54301943133b), W(0xb752620e57af711e)},
+    0
+  },
+  {
+    {W(0x3ab2882637f1e2a8), W(0x3a05b8a887370947), W(0x75e13b789f230701),
+     W(0x7cc16a71b1f07b07), W(0xc687a1028e87fa09), W(0x825a9415ec9b7e75)},
+    {W(0x91b7613c1f049bae), W(0x51eddf1002ce5aff), W(0x2466cf6c80df9ae2),
+     W(0xcaf397f1f96a96a3), W(0xb7f0da5b18f14b62), W(0x411d7b4bdbfad7f5)},
+    0
+  },
+  {
+    {W(0x7a4bb63b87306d57), W(0x3bcde4c8800732fd), W(0xd0e7a57a53decbc8),
+     W(0xa55ebfcb7739d9fe), W(0xb4c70dae431fa54f), W(0x4dd851c4cbc8240b)},
+    {W(0xc464920c8742c06e), W(0x5980df4e213a5311), W(0x1ac9e2e53dac11ec),
+     W(0xcbb948f8278fd23c), W(0xc7eb845769e01013), W(0x353aa9d3d22ca96b)},
+    0
+  },
+  {
+    {W(0x23044e6ec9fafaaf), W(0xf97b0673f8d3068f), W(0x0db2d0044593cff9),
+     W(0xbe537ac02b55a782), W(0xaa6f29292229f782), W(0x6f4263eba1a7e956)},
+    {W(0x776e0afa9757d13b), W(0x11c91462302ef8c9), W(0x1c300e423ef292ae),
+     W(0x92a30c34a81d87c5), W(0x4beb6080ee611a5e), W(0xac4bf5d3f97427d5)},
+    0
+  },
+  {
+    {W(0x37f38443e416d214), W(0xae5a1fc4bd53a37a), W(0x1f9b4b3fec4913c1),
+     W(0xbcdfc77d1f9cf92f), W(0x34f4a834840efec6), W(0x11e4f69b3b78b28b)},
+    {W(0x930c645ff249a94e), W(0xe8bd4f9a6b976daf), W(0x174b2d28eced836a),
+     W(0x2c04dbdfdd3eae42), W(0x20b9835c10ffa82b), W(0x78cdb60d508e70bd)},
+    0
+  },
+  {
+    {W(0x0e20fe46e1d7701a), W(0xe84821e07d980ebf), W(0x77dfa7bf2d558142),
+     W(0x6acc3afcf04caa94), W(0x280d9f6a3f165f2d), W(0xd8782de2aaabebd8)},
+    {W(0xf2493678576549d2), W(0xbd203c37d3ff8f4a), W(0x16298d7ae557ccee),
+     W(0xf2c83592fe47a466), W(0x875e8eec93d6952f), W(0xe25b61aa131c7a71)},
+    0
+  },
+  {
+    {W(0x8bfeea8a5db5bcf2), W(0x47ea4d3cc560ba49), W(0x6143a7c7f56048da),
+     W(0xcfe5e1983bd32c7b), W(0xaaf43c3c6f8e4050), W(0x86a048f8c575692f)},
+    {W(0x8f0d31f68b3aec6a), W(0x73ada95ba2cf08b4), W(0x55bfec3ebd8bbdd0),
+     W(0x903b0ddf822a1fc0), W(0xa488b6323baf8766), W(0x1fe3db94aade2cdb)},
+    0
+  },
+  {
+    {W(0xe3126e1f8ca012d9), W(0x2a1f0e0db2b34c75), W(0x8ad49639ec093bf3),
+     W(0xa0e3501e6c5e9f4a), W(0x41c3e53b1c13bc85), W(0xfac483f26638c9fa)},
+    {W(0x9a7b0ae0628bf4b4), W(0x4680c8bf20d9a509), W(0x509efc75913e9cb1),
+     W(0x2c49e3156a6f6e69), W(0xfab4f1e04d8bce3a), W(0x0b1f2cfdb87f4c49)},
+    0
+  },
+  {
+    {W(0x274419aa254482dc), W(0xc102642abc4bd0b1), W(0x0c1ce275e93b4b3d),
+     W(0x0c33e137b4731c6c), W(0xfd639e004a2fdeac), W(0xf86a89034fb7b181)},
+    {W(0x2c07dc60868c02ad), W(0xb4fed90d06a3171e), W(0x23cd99cd1eeb3aa7),
+     W(0x548a2f1a99b37848), W(0xefaa1e165f805fa9), W(0x0df653fb6a35b4b8)},
+    0
+  },
+  {
+    {W(0x0809e7d8eb569472), W(0xb3164044f7401f06), W(0xbccea3d4127f1f8a),
+     W(0xd431d4ad3f7c8add), W(0x51cb08d484aa2446), W(0x6429ffc0ee6b322f)},
+    {W(0x1bc3b9bea9b15306), W(0x6e6c090e964165b2), W(0x64d9e5c80d15cbaa),
+     W(0xc0254911f908300a), W(0x97b8839bba65fb12), W(0x361559e0c452b433)},
+    0
+  },
+  {
+    {W(0x661d2d8bb3eb66a8), W(0x6095513d2c52e807), W(0x24dd944fbcc5e314),
+     W(0xcc0840c62a55c8a3), W(0xd1aa43830adc6420), W(0xcd4b0cf9989a51b6)},
+    {W(0xd6cda75b026ca908), W(0xbaaf23d3b5a6a294), W(0x9b40133c96a3d895),
+     W(0x1f7ec43e2e3ad93c), W(0x1f7b27f6040312c7), W(0x5a8008a1411b9ee4)},
+    0
+  },
+  {
+    {W(0x5b5fe55fbf3f046b), W(0xbdaaf972d580bef5), W(0xbc6a963476243ea9),
+     W(0x7110d349cd51a501), W(0x4ad1effe4aff1c50), W(0x4705a29e9abb24b1)},
+    {W(0xc7f7e4030bea5fbd), W(0xd816b41f45062bd2), W(0xcec76a440c9f18cd),
+     W(0xc75939b4ad454e12), W(0xead1f485987ff237), W(0x3617317d2068c25d)},
+    0
+  },
+  {
+    {W(0x0baff22a4c61c964), W(0x17f717a9cd34fbc3), W(0xbc2258d418d0912c),
+     W(0x30cae9d569d020b0), W(0x8524187e6189883b), W(0x450d9af48cfbc1b4)},
+    {W(0xd6bb2886f35be42c), W(0x034481e21643e212), W(0x27d92e91fd725137),
+     W(0x5e9d3507392b96b6), W(0x79b9340ff0c394be), W(0x0830063594ce78c0)},
+    0
+  },
+  {
+    {W(0xb66811b77f029649), W(0xbac365a58828dbb3), W(0x09a57cb691d1e0aa),
+     W(0x6bb94f9cc962cff5), W(0x67416fa1970d1077), W(0xf2c146b420d4d3bf)},
+    {W(0x8c05b85e7046bfa8), W(0x6a66490bbd7fba28), W(0x72d6b6d802626532),
+     W(0x833f903e299d394e), W(0xcfffb2c0e65d598a), W(0x91d5cb20150d08fe)},
+    0
+  },
+  {
+    {W(0xb29473a9709182d1), W(0x84b19b8facc223d1), W(0x53dd704352798f10),
+     W(0x128d8d13a1593e73), W(0x1efdaa7514f5d874), W(0x78df2e72fec1d742)},
+    {W(0xc6081bdf4dc17bc1), W(0x93f05d5753386a0d), W(0x29b0429fd3bccc5a),
+     W(0xa54e7b1b46ac8365), W(0x834fb9384009e9af), W(0x4b3696bdcb792fd1)},
+    0
+  },
+  {
+    {W(0x3ced8492fe5412e1), W(0xd60be12451505dfc), W(0x4a873f12dda14aac),
+     W(0xb321b434479b97fb), W(0x4f2af8e46e871a21), W(0x61ac86264f7e492d)},
+    {W(0x0c969f0bbfe27748), W(0x8a4a2b75ace1eec9), W(0x8757ac37666a8e07),
+     W(0x3b60e97d05446941), W(0xf8c09ddff5e5ccd8), W(0x2290e9f99300e6be)},
+    0
+  },
+  {
+    {W(0x5de8b4c1221b2040), W(0xf703a1f0864d75aa), W(0xd27e572da709baad),
+     W(0xcb31fedaf1c30c9c), W(0x91b80ff4c223426d), W(0x475dc4d09d1255ed)},
+    {W(0xd3607c9c67ee588e), W(0x612d50423fdb5ba7), W(0x7042bbec49c29a8d),
+     W(0x4ad006956371cf01), W(0x6bf95a7f1fa63352), W(0xe7d7b26977a15abe)},
+    0
+  },
+  {
+    {W(0x304393033345d4b4), W(0x182c9a0bfb95b4ec), W(0xadcf5aa31c4db782),
+     W(0x830ead7495bd827f), W(0xbaff3f42c763ca58), W(0xfaf69b5218f3d09c)},
+    {W(0x5aaac6df37d60bb1), W(0x9d1d67d58f8a2e6e), W(0xfd890af175bd9e28),
+     W(0xc1ab8408b615a15b), W(0xbdb1a0a3df73b055), W(0xfffdb219f2f25d84)},
+    0
+  },
+  {
+    {W(0xfbfe5f1bd7f439a9), W(0x2dab60ad27089415), W(0x18a0d96e0b98a232),
+     W(0x254b68bbd07eb258), W(0x6b654eddc34f76fa), W(0x1d15f0169d3a9c2d)},
+    {W(0xf6f9b4c85fef6a29), W(0xe3b30a409f99bcbe), W(0xddfd9fbc4f9803b1),
+     W(0x25d119ebfa5d93fd), W(0x4726024aa37e02c8), W(0xd9cef74a43cce621)},
+    0
+  },
+  {
+    {W(0xcb18bd470f4cd47f), W(0xfa1975d2a273d61b), W(0x8462ded3a72e792a),
+     W(0x1125794d0a576f93), W(0xd0a4de19481e8e82), W(0xdce782b411ee060d)},
+    {W(0x1c7834286dcbeaa8), W(0x29e0c751bf3d1f65), W(0x6efae1a1518c2c94),
+     W(0xed637b77535cef22), W(0x4b8ca7f7f7c2e200), W(0xcb2d2dde456cfbbe)},
+    0
+  },
+  {
+    {W(0xaaca43f47060fafd), W(0x6a50159f28165fc0), W(0xed3693657498fb47),
+     W(0x8b97a4954bb3b9c0), W(0x0aa839640cb0d2c2), W(0x57e239958ade3361)},
+    {W(0x842a4f01229a9b99), W(0x1ae9b7b6b2bf2420), W(0x44e87cc52e1b7ef9),
+     W(0x16a0e8076989b113), W(0xcb34ad802db259b7), W(0x7f1b7534d54a3bb3)},
+    0
+  },
+  {
+    {W(0x948121f9715deef5), W(0x29c094c940180d1e), W(0x008dc162a7cc65c6),
+     W(0x44642bfe582807ed), W(0x6e7cd0ffa011d645), W(0x47e058c2458d0733)},
+    {W(0xcf8f38614169dfe6), W(0xbfe0088b4ed42796), W(0x12252f7b3e66cb07),
+     W(0x52e2d6b0d5995e11), W(0x5f665be0e4628c75), W(0x60ed5e4c127a0ee2)},
+    0
+  },
+  {
+    {W(0xb463cdb1462e89a8), W(0x3e7cddb82309a132), W(0x67a472c20bc730cf),
+     W(0x382e66d7761aa7bc), W(0x207355dbbf7052ae), W(0x31dd94e65b3182cc)},
+    {W(0xf2b3d9842852f7e9), W(0xe7b7666d4784801b), W(0xe19728e75155a9c6),
+     W(0x7075a02cec8f3007), W(0xc398087c573744cc), W(0x3b4a960a0ee555d2)},
+    0
+  },
+  {
+    {W(0xd9ab908468e4c0ec), W(0x347e5d1bf05a9147), W(0x6446204abfdc5c77),
+     W(0x8dcc8ba64deffb8e), W(0x5199d0d78dd05d17), W(0xc1b27330132cae12)},
+    {W(0xfb468312e59897b0), W(0x749d62bda95212df), W(0x5b7ca8675a46ae1e),
+     W(0x5838f155c8586cc1), W(0xd7ac9761146c62a6), W(0x57561a05a9a0373f)},
+    0
+  },
+  {
+    {W(0x83784a3e1b7465d3), W(0x7d83406743e9f4f4), W(0x88f46ba393b92a57),
+     W(0xc1abe977c810c738), W(0x2eeba2277deb0073), W(0x162323a6cb6cf19a)},
+    {W(0x91564517faf63fe1), W(0x552528ce9d28f3af), W(0xfe7a1d8e19039ff9),
+     W(0xeb3e188664718cee), W(0xd996ab193ef721e3), W(0xd0f434fbbc10652c)},
+    0
+  },
+  {
+    {W(0xcbba17071a302daf), W(0x216386bdd4cf5684), W(0xe194fcda741663e1),
+     W(0x47e7583d10757537), W(0xcdf07ee8baea83c5), W(0x13ad5566a222debe)},
+    {W(0x8b508db20ceba615), W(0x14ceacec20699a53), W(0x70a3cdf26c200e90),
+     W(0x928c9d251d7eddf0), W(0x5633afc32748c798), W(0xdaf1da15ae524f8b)},
+    0
+  },
+  {
+    {W(0xbb7a97b513f4ebe3), W(0xe33cc092e6f6c0f3), W(0x0e66005bfe813e7c),
+     W(0x436e98b1fc7928b0), W(0x8c8d90f0a103e7a1), W(0x589e6ae4dc4c6801)},
+    {W(0xf57b28ff0568039f), W(0xeacb506f0d642a40), W(0xfe11dac8b5a78dae),
+     W(0x886e3cb7cce0464d), W(0x9d2ccba05a73469b), W(0xbc0122f8e775294d)},
+    0
+  },
+  {
+    {W(0x081de42dcfafe9f5), W(0x119f81e786b39909), W(0x4793c00a399f02c8),
+     W(0x30968e21cb62f408), W(0xfffde7c1a2f42c78), W(0x3632bd6c395a82ab)},
+    {W(0x95bfe2e0686cb97f), W(0x714caa54c311c958), W(0x98f82c93ff489775),
+     W(0xf38a05e28c43c337), W(0xefb135ce0b15be4e), W(0xff9a13a82fa9930e)},
+    0
+  },
+  {
+    {W(0xe09e752a2db0909a), W(0x1d358a5f63f70d36), W(0x9c0161e28d384a0f),
+     W(0x3a9554287cf45db0), W(0x1475f581fdec5060), W(0xe4bc9fb6f8b3f296)},
+    {W(0x1903d0aad4415c19), W(0x2d0bb06c8b50393d), W(0x58ed21f506215aa8),
+     W(0xf610c34a4678c3a8), W(0xbb507fc500c6cdad), W(0xe3b094213ea3cd8f)},
+    0
+  },
+  {
+    {W(0x9f8a26f97a948b0e), W(0x0a2ea154d6c6c273), W(0x4ecae396394a8609),
+     W(0x4d0b99a28d64a7df), W(0x8593ef6711e62590), W(0x2494e5be98e5ae67)},
+    {W(0x3e4bfa6378f1b2fe), W(0xb32ac497cec1aa15), W(0x8efdc8fbbd0e51f8),
+     W(0x2f4ad0586dc0cb57), W(0x6f1b73e758dbba0f), W(0xf42bf201de96448c)},
+    0
+  },
+  {
+    {W(0xf14f246046ad2517), W(0xd31197fec34990b6), W(0x37bf5edcdc927c1f),
+     W(0x79fa81333a6e3941), W(0xea6b08337f902a67), W(0xb1356aee62d8c190)},
+    {W(0xcc1684a1b1c6d9dc), W(0xadb51af6220d0b4c), W(0x734bc6433389c7e5),
+     W(0x7bd007c8a35ed82f), W(0x925df37fa6343e94), W(0x8ce0d88ab4457079)},
+    0
+  },
+  {
+    {W(0xb367f45135930f80), W(0x971b4a6211acd965), W(0x9876d3c774440d28),
+     W(0xdb078ac005e74d51), W(0x70d9b0858cc2b9c1), W(0xbda78b4e0b781b76)},
+    {W(0x507d4adfa7249147), W(0x3ebab36d83605f75), W(0x2e58e644def8372d),
+     W(0xd1076c2b83e6e92b), W(0x7fc3050fc60b444b), W(0x359588526dd83a63)},
+    0
+  },
+  {
+    {W(0xd7def7910b9a36e1), W(0x40af1d81058e8e14), W(0x8c301cd80c42ea97),
+     W(0x591ec9750e2571a2), W(0xee99c8bc0f9ca91c), W(0xc02baabd7c9d171e)},
+    {W(0xba122fff47a6bff4), W(0xc72e16ace5cc46a0), W(0x72a8b2d8a91d31bf),
+     W(0x8f73887e1b82399f), W(0xdf6650c024f75acf), W(0x8f2746a58cdb4261)},
+    0
+  },
+  {
+    {W(0x9f9c0f3c6d82b5af), W(0x93c959a6bbb03763), W(0x3420a928b1b9bb89),
+     W(0x834b440fcb0cac85), W(0x0a037061af40cc5c), W(0x8bd5bb0527e8f4ad)},
+    {W(0xce9b62b1223af21f), W(0x78f00a28af698d21), W(0xb4dce6f50fc934e5),
+     W(0xef039da8478e2272), W(0x60fa0c643d83fbcd), W(0xcd414282feb9377b)},
+    0
+  },
+  {
+    {W(0xd5feef6c013c99cd), W(0xff1035ce4d5cbd8c), W(0xf70b580d72c85529),
+     W(0x28d503908e4cbe4a), W(0xba4f9bc41944970f), W(0x257c0dfd07a4e9a2)},
+    {W(0xf3cc7f20df62f404), W(0x638bbb0512bc6ebe), W(0x0e2ca202ffb312ab),
+     W(0x6e7e3bfcf5724850), W(0xc7b30327efd2026a), W(0x95d6a389cc2e5da4)},
+    0
+  },
+  {
+    {W(0x97256878aaaaabd3), W(0x052b2a46fe8e7d59), W(0x5d89ee4b274fc833),
+     W(0x5581168513cbd207), W(0x71acf9a80ca41e93), W(0x229ef0bfd50f9ddb)},
+    {W(0xe90810b0026102da), W(0xdb6588e7fa775841), W(0xf4f9f30620a547bc),
+     W(0xf58573d932046712), W(0x6d4722c621905105), W(0x0a202a8300ee4a0e)},
+    0
+  },
+  {
+    {W(0x1e4ba5721b9fb00e), W(0xec280a7b91d23cce), W(0xa1400c6ece44dfa0),
+     W(0x95be9425f762d390), W(0x53eb7025ede1c95d), W(0x29d8492498d360c1)},
+    {W(0xdc590a6aa785fede), W(0xbf49039cabeaaa61), W(0xa5d1a425d89d1e95),
+     W(0xcb02bc03e0eb7ee1), W(0x9a9e9cc1ec1aa3e3), W(0x8c7f3c7a1d7b7856)},
+    0
+  },
+  {
+    {W(0xa3b775a7db586b39), W(0x60c7902267f3d885), W(0x918bfe0d61a93ef5),
+     W(0xea34e7fe38b0a48e), W(0x1bec1530f1877dd0), W(0xeafc899ba456e27f)},
+    {W(0xbbb929b351ea45db), W(0x7d36d83bc9d9a148), W(0xc25033c3ab45ddc1),
+     W(0x34245463fb12fd9f), W(0xe5384f1c19245970), W(0x77bf38c6c750ad36)},
+    0
+  },
+  {
+    {W(0xe6e173914afe45de), W(0x5eb15f32d29aa558), W(0x976b4f8049848373),
+     W(0xf115e50a8a84f17a), W(0x32f7478241a4e907), W(0xfad67edb10b87138)},
+    {W(0x0030a2a49341e7a5), W(0x2d8a4497da6fedb3), W(0xa0290b1d52da8fc2),
+     W(0xfdb134061f99db83), W(0x095e567650df4cbe), W(0x46e4f2a7eebf5290)},
+    0
+  },
+  {
+    {W(0x740c2803c9d33f36), W(0x187fc83dbdb33474), W(0xad2a1d4ed83e3d68),
+     W(0xe817ca34844e48d7), W(0x23ffba58c368e8c6), W(0xfdc9361641b7d39f)},
+    {W(0x201319cb2c7c92b3), W(0xe531ab222cf2e835), W(0xe9c6b2c1c22c9492),
+     W(0xc72be67e62bf36c8), W(0xe7441caf1a33966a), W(0x6456b5a8bd222ea3)},
+    0
+  },
+  {
+    {W(0x2d731222b9c2db0e), W(0xbd0124e52bd93f70), W(0x2222f83332172296),
+     W(0xe37da8df2096e414), W(0x77fc58eed77ec999), W(0x66035991d846c96c)},
+    {W(0xc3fa1513e2f54f31), W(0x1bb39b5d1bbfa994), W(0xc873227ecf4e88e6),
+     W(0x73bcad9109070d7a), W(0xbf73b3c550078683), W(0x72cb35853bd6d880)},
+    0
+  },
+  {
+    {W(0xc7bf993d3f3bf907), W(0xd8ffeef875377d92), W(0x7ceea15801c68ec2),
+     W(0xfdfdb9241a6a1559), W(0x97389977ad13931e), W(0xe9409180522c6404)},
+    {W(0xb349095601b3b746), W(0xbd8dcb80bf6ee512), W(0xc5cb1948064415cd),
+     W(0xc5db72aedbaf2806), W(0xee6cc4959093da74), W(0x9666daea4b85edec)},
+    0
+  },
+  {
+    {W(0xdb8ed347ada4eb59), W(0xff9a0eae4505ec14), W(0x4c66664615568412),
+     W(0x8d35b650944b46d3), W(0xebb3a855990d4bd0), W(0x86e188097e5e5ad9)},
+    {W(0x438edb354627f197), W(0xc30f9cc2be150ec0), W(0xc50a0d62045c8c1e),
+     W(0xc3c441bd291509a3), W(0xe39201280ad16775), W(0x311558973d0746b9)},
+    0
+  },
+  {
+    {W(0x1ec2e44b8695303c), W(0x77d25e42df147459), W(0x941a46f5b858b98b),
+     W(0x61c14c59cc818763), W(0x800b324002c7ecfd), W(0xb75304d9777d2ce6)},
+    {W(0xeac3d1ec536cd2d7), W(0x78f19ab9d8a48703), W(0x457f3bf456d1a61d),
+     W(0x0b378b0059055fd7), W(0x5379c48202d41f80), W(0x9ff48d3502bece65)},
+    0
+  },
+  {
+    {W(0xbce13377802e44ec), W(0x7c7f4dd1794f4b55), W(0x6e78d0fdeb4b1716),
+     W(0xd7311bb6d56c0b0c), W(0x9bb91e62d658647a), W(0x41d865cd1b60e73f)},
+    {W(0x78252cbe5f0dcf61), W(0xa9dab83d60d7c6aa), W(0xfcf0b3e08e658b22),
+     W(0xcc526841abde8c65), W(0x9ebe19a173e2412a), W(0x286d3b1c54ae9973)},
+    0
+  },
+  {
+    {W(0x4c61900908dd5dae), W(0x50081b2ebef0cbe2), W(0xc9a2ca5db7fa5df2),
+     W(0xc8b33b01dc796d55), W(0xda1d9247bfcbd35a), W(0x9d82ca2bac267bc7)},
+    {W(0xa60e147c222a39a5), W(0x644564b0dfbd6de8), W(0xcee536f939e655c8),
+     W(0x9b62154e14a6fcba), W(0x165ccb4681988dd6), W(0x9fb55fa624d04fe4)},
+    0
+  },
+  {
+    {W(0xdee779b680e6d023), W(0xdecd700cb1318632), W(0xdaeba918443299ec),
+     W(0xb9ee509bc0e23e9f), W(0x5bca692c0af198ab), W(0x523a6411136dfd2f)},
+    {W(0xb6970a6d133077b3), W(0xd2778f53feeb69a9), W(0xa89ec95353a8de3d),
+     W(0x2f7419a3c7631cd2), W(0x79a50eaad36f8d3a), W(0xc9da73eaa6d581ec)},
+    0
+  },
+  {
+    {W(0xfe83c72d73fa42b5), W(0x1bc8257af1235900), W(0x8e5cf8512abd0b63),
+     W(0xe6f7f2bade4af459), W(0x407ad121c711f412), W(0x040f0a512530b44f)},
+    {W(0x5ba014e4dac9099b), W(0xd3f7211040fead56), W(0x01e504b15db29776),
+     W(0x4bc9d78c2cd560a1), W(0x4be797e1c369fb49), W(0x75ef74b874b53bd0)},
+    0
+  },
+  {
+    {W(0x579630ef1dc7f385), W(0x65e32e1497f78bf2), W(0x627e50d157a431cc),
+     W(0xa3b35898df904858), W(0x5407751795548ee6), W(0xb0e08b4d4fdba0be)},
+    {W(0x29c43518584502d7), W(0x5a5b482ec58fc0f0), W(0xb76ccebcced2fa70),
+     W(0x3e718b8e0822fbee), W(0xa66c1731ec44318a), W(0xefeb9e48e2d2ee3f)},
+    0
+  },
+  {
+    {W(0x3845e9353635d61e), W(0x50a20908a5ae9068), W(0xc849bbee3160a461),
+     W(0xb83fcd17cc97e4c6), W(0xbe62f5cae4c93a3f), W(0xf33304dee982e261)},
+    {W(0xb208638db06aa847), W(0x404c744cf1aa7ecf), W(0xdc32d13c755d2235),
+     W(0x903b6143c3b7bf3d), W(0x8f3b8882bb2e4b23), W(0xebc574e6010f3fbc)},
+    0
+  },
+  {
+    {W(0xc212f38e73a3ad61), W(0xd27640773cb4c5ab), W(0x8ada66faaf1490d0),
+     W(0xb40cabd724e9a1f3), W(0x658a30fe2f2c6618), W(0x50aec6c61f6859c7)},
+    {W(0xc065b4f2158f08c0), W(0x2987cd8255e20798), W(0x53c3b59866070797),
+     W(0xece268aec1847254), W(0x2511d9f7cecfebbd), W(0x2ad66d39cd1d7f1f)},
+    0
+  },
+  {
+    {W(0xc932cb847f46dbde), W(0x2e38e8df68357679), W(0xd4dadea687970453),
+     W(0x784b7e3a391c34e3), W(0xb9b83312eedc4595), W(0x0bb99229a07abd90)},
+    {W(0xe8c216d05222c8b7), W(0xea5c320d5c03a8d8), W(0x59c3ff6ba297e50a),
+     W(0x00879aef408f53b3), W(0x8e094f3ca3acb9f8), W(0x0ffa61a66ec0102c)},
+    0
+  },
+  {
+    {W(0x0dad1a3b47a4c1d7), W(0x42e757684eec196f), W(0x443f3d1de620fcf5),
+     W(0xd27a4f75a611d6a4), W(0xd4dc44f1b6b8e4fd), W(0x4a27dbee6247b013)},
+    {W(0xb7431505d03377a1), W(0x8240a6a23d55e01d), W(0x370eca87f9defe89),
+     W(0x95701a5633d0966c), W(0x477bcbd7eeb5deab), W(0x727d8b36b28f426f)},
+    0
+  },
+  {
+    {W(0xc9719f9c5eb56f19), W(0x7fe4b7d26dada006), W(0x8c50e6264a68ffb3),
+     W(0xe0d283b8f82f5f38), W(0x3c96fe9c154dfce5), W(0xa427c940a66b31a4)},
+    {W(0x10bfa2ad83c50220), W(0xa0c1242f8e7166fe), W(0x5672e92a7d1a6b2e),
+     W(0x7f5760a422114e30), W(0xf99e1cdf4d074c2b), W(0x8a7c9a1d0498c1f7)},
+    0
+  },
+  {
+    {W(0x43a17e8b1362f2ae), W(0x54e882a10126e054), W(0x66ca74d92bf4b1fb),
+     W(0x3f8451e1d2e44ce0), W(0xc2124215410c95ed), W(0x34feaa82452128db)},
+    {W(0xc6d9ccd560379c86), W(0x5f47280c16b7a5bf), W(0x8ea23a07b459c799),
+     W(0x69479ae07433e667), W(0xf15655bec018f2f8), W(0x9c0ff90a6a6cac61)},
+    0
+  },
+  {
+    {W(0x22d0ae58d7ed2c0c), W(0x0599c881ade92bf3), W(0x6415dbd3d65f551e),
+     W(0xe70ba703f3cbf696), W(0xbd31a97e0e67bba5), W(0x9949b0fd7beb4a0a)},
+    {W(0x084d5024a7eab0c6), W(0xb10c6a7f3bcb8143), W(0xafc00f162dc4bfe2),
+     W(0x8919385d3a94c29a), W(0xe5665354219fe8e1), W(0x7bba62741bd8b10e)},
+    0
+  },
+  {
+    {W(0x8177d452807fb3be), W(0xe8f798c43251798e), W(0x0d7e5f98861993a2),
+     W(0x0a1179046c782e23), W(0x2d6f1aad940c2189), W(0x240715ba918b0eec)},
+    {W(0xf8cd1eb4dbab2562), W(0x5ee1d0ef8db9e0a0), W(0xbfa853229fe6245d),
+     W(0x7c68199cfa324a4c), W(0xf2356c11fe06f6d2), W(0x4d22d4347aad8800)},
+    0
+  },
+  {
+    {W(0x1c5523af74b3cbe8), W(0xc6e19af1cdcafc64), W(0xcd7d356646966c63),
+     W(0xb877a05c9015c706), W(0x12842a6ea3ec83c0), W(0xd6e65b2cfad73c20)},
+    {W(0x9269279f2683fc74), W(0x90bec18b3e71fec9), W(0xe2e3e22d636d239e),
+     W(0x029ce3ed31668111), W(0x64aa249320c47bf1), W(0xb8f48e2fb22d153c)},
+    0
+  },
+  {
+    {W(0xaabbc444ba9a49cb), W(0xf00d0cf2aac83bc9), W(0x1bf5b83dc09ede5a),
+     W(0xea8ccaf3e74a95b7), W(0xd3d8c56fd1f055ea), W(0x942cd3a2edd52068)},
+    {W(0x2f124875bfc5edd8), W(0x1814e4b3a3bd2e49), W(0x6b24a422087718e4),
+     W(0x2a4970e49bfef5a8), W(0x18c073b79e0de583), W(0x83597df20c597bb2)},
+    0
+  },
+  {
+    {W(0x0db37a320199cbb1), W(0xe155fd97f25b52dd), W(0x89453132c6350c79),
+     W(0x4367ded59af04ee2), W(0xd1ee721d95752ee2), W(0xf3b05bdac16657f0)},
+    {W(0xa2e4e6c7a47c257e), W(0xf5cbb28f713c0272), W(0xd9fd3ae9d815adbf),
+     W(0xbeb774a0161abe27), W(0xacecf71dbc2a1ec9), W(0x1915017711075a6e)},
+    0
+  },
+  {
+    {W(0x03306e5671a89c2e), W(0x5b3e321a7f8fb76f), W(0x508c577f2312bc9e),
+     W(0x9c06cd20ec59c69a), W(0x307f502012ab3625), W(0x45aea7f793e0a233)},
+    {W(0xaba810b874abff47), W(0xae664405a94f1582), W(0x20bd45f0c581cd29),
+     W(0xada2b548ec7bcb1c), W(0x980d3dc621a37dc2), W(0x9ec18a791c28002b)},
+    0
+  },
+  {
+    {W(0x78076e93b284aa5d), W(0xe004524ceeb271a5), W(0x929b020392ab9376),
+     W(0xc9757286627abee4), W(0x2b92f57911416f89), W(0x183d4f71235b24c7)},
+    {W(0xf18e1d6a943e50d8), W(0xd5ea94addba3417f), W(0x5af6382531d076c8),
+     W(0xd5ca300da531af6d), W(0x1bac75c58b6598bf), W(0x4c789a1bfd2da7e9)},
+    0
+  },
+  {
+    {W(0x5304accaff551720), W(0xb9d97c523d1c79d9), W(0x04313df29b932920),
+     W(0x1e8a2fe3330ed14e), W(0xea6cfde8602ad3a8), W(0xf4d7003f401c55c1)},
+    {W(0x2240cfa9d73a3fe5), W(0x662d8ec7c1550ae7), W(0xbfeb14412349b435),
+     W(0x86774594c5d50602), W(0x6160f2135433914a), W(0xe9c271016adb23fd)},
+    0
+  },
+  {
+    {W(0xfdee87ffbae90f53), W(0x9c766384a93ac34d), W(0xea00e8fb2367f263),
+     W(0x9ebccfebee5aa664), W(0x3283e95a48d5087b), W(0xd24b461d096dfb06)},
+    {W(0x536bb7f944d303fa), W(0x49fedec5c13576d8), W(0x71a52ff73ac9cc01),
+     W(0x01bcee024609f416), W(0x056c4a2a92a5641d), W(0x9eed5498bb15cafa)},
+    0
+  },
+  {
+    {W(0xe8d0c516ca32c00c), W(0x35f9d9268d78d055), W(0xdf68393e89d8a49c),
+     W(0xc62cbb65fc8ee5a7), W(0x1f746fdf057e7180), W(0xff26af88f8ea63cc)},
+    {W(0x7e1e3c4c6e2c3be2), W(0x6f142346f663f2e7), W(0x21e07ae0bf0afb4e),
+     W(0xf7ee13a14147cfee), W(0x3a8767e6eccbe63d), W(0xb4757130888430e7)},
+    0
+  },
+  {
+    {W(0x2753c5248e9a980f), W(0xee49f53eefc04f0d), W(0x9c9b980bece5b94d),
+     W(0xc19c1a8669815d77), W(0x67ea9e4950e108c2), W(0x25582f9ea8a65b31)},
+    {W(0xf33eabc81bd2e52e), W(0x3ff81c8a6d1fef91), W(0x401479432da2fd9f),
+     W(0x273d6d11ad8e9598), W(0x104d5216503ec80f), W(0x47cacd27a8c08a1b)},
+    0
+  },
+  {
+    {W(0xae1aeffc965ebd7e), W(0xa4c04516efddf689), W(0x39bdb05d7439931b),
+     W(0x63011ed4985f22e3), W(0x5c44fcbe168c4adb), W(0xeef2b568d0c0bf59)},
+    {W(0x82adc32b2b308ddc), W(0x7ffdcf2f476b34bd), W(0x34c448df044dd04e),
+     W(0xf2f13da0e145ca71), W(0xbe85f67edcfc6089), W(0xa81ad3a4faa27ecc)},
+    0
+  },
+  {
+    {W(0x4a18f9204f0a2c4e), W(0xaf037150f853dd37), W(0xff241bc346ec9635),
+     W(0xa2fd106e18808ea1), W(0xb20c3f0054f5478d), W(0x29a1b415a8747b99)},
+    {W(0x748404f08ba73b65), W(0x58ed488dde5e3402), W(0xd37df9151db08614),
+     W(0x68c6e48e510d71e3), W(0x8225de224b49b0e3), W(0x2531424f7711682c)},
+    0
+  },
+  {
+    {W(0x05fc6ebc4af4a479), W(0x860f81a57145b49a), W(0xd3958414b847df6d),
+     W(0x10389458c63f1a4c), W(0x48aec21aad30d7c5), W(0x466e2d4f2f09514b)},
+    {W(0x2ea63bb99338d643), W(0x34559b65bd89910d), W(0x74c9fa05903e5335),
+     W(0x6b5515be11e4901e), W(0xdc748b6192ecd567), W(0xb105db2e2641d70e)},
+    0
+  },
+  {
+    {W(0x454f22d58bda3828), W(0x440a70a521d2ba07), W(0x5d77d3e4505f793f),
+     W(0x5b2192cf937694a4), W(0xced9d2f38ab1a993), W(0x3f91c32cf92accd8)},
+    {W(0xb853af86507de2a8), W(0xeaf8bfa5cbe26d8d), W(0xd10c6339add144b1),
+     W(0x4145d9744293d72e), W(0xe3f87e06e5ee546a), W(0x51462cf9951f3086)},
+    0
+  },
+  {
+    {W(0x33575d0217692215), W(0x3b5454ff427c02e2), W(0x3d2d43a4a87267a1),
+     W(0x3fec9cee7fa93ed8), W(0x65fa76e3cebf5a37), W(0xaa435166bce60a78)},
+    {W(0xa424dca643a12aca), W(0x6c1432127590ae1b), W(0x006f838335a23e95),
+     W(0xeac46792949e3d6d), W(0x862294dde4feaff3), W(0x61dfa681f5b02e69)},
+    0
+  },
+  {
+    {W(0x35f1f88a9ab11631), W(0xabf869d1e91bf5fd), W(0x2b4edc63bb24f912),
+     W(0x5f686437b55cd8c4), W(0x2e82ec8119029404), W(0xf51c79773f1ce9b2)},
+    {W(0xc7b7201919dee0eb), W(0x03502fa4a051f42d), W(0xcedd05bdea9d9123),
+     W(0x104f17f2c012f639), W(0xfb0fbb9fca1f9a39), W(0xfd570fca4e5eefa4)},
+    0
+  },
+  {
+    {W(0x6ec8d71c4268fb8e), W(0x71554047a0a8cba2), W(0x00258f750588bd2e),
+     W(0x6d60c7a41ed0630a), W(0xaa370e7506656d56), W(0x214328670a6e4c42)},
+    {W(0x0d6515905546ac2c), W(0x6f84ef7d895b29b6), W(0xf1410b3cf655cc54),
+     W(0xb7381c5cb62d6be6), W(0xce68c0c5da68b495), W(0xe0e4ded89e23ffde)},
+    0
+  },
+  {
+    {W(0x7d7a977d09f74aed), W(0x9511672d61a841de), W(0xa49574d87afc3e18),
+     W(0x3c3d8264a43f4042), W(0x6024df18999606d5), W(0x9019225ed6959184)},
+    {W(0x421eb3cfd5ace6c6), W(0xbea73279ec266aac), W(0x7c027efdd986c5ad),
+     W(0xc10a0affba9d1b6d), W(0x848dbb5b094e3511), W(0x4a9bd0377c9c065d)},
+    0
+  },
+  {
+    {W(0x7ed69fbdbb3c770e), W(0xb08c5bf67d9f192f), W(0x3b901f3c34019f51),
+     W(0x919fc167354e9700), W(0x072d65bb1dbfdf9b), W(0xf341162bcc66e0d2)},
+    {W(0xdddc28bc9cc565d5), W(0xf06584744a8cdf4e), W(0xf4c4a727077ed168),
+     W(0x72d7e32e80f89ab3), W(0xe37e8462c3127c9f), W(0x6339431dad88750a)},
+    0
+  },
+  {
+    {W(0x791ee8510bcb37b8), W(0xde1b47600d2d744d), W(0x3d17170d784b9678),
+     W(0x747aed2fc328c06e), W(0x496635b335247d06), W(0x151a1826ef0d4f2c)},
+    {W(0xa0a1b2fd99ebfaec), W(0xeb8fe187933b8832), W(0x8f6e46240b9e8141),
+     W(0x28cf40c8fd318640), W(0x41a824c62dbf4069), W(0x5d2fb147632dd73f)},
+    0
+  },
+  {
+    {W(0xe06b878fc8a34e62), W(0x9ada9708f92dff92), W(0x7b290f3f5d0e9622),
+     W(0x094e87c4ee5b7b4c), W(0x7368b4ed7bdb8282), W(0x63223b60fdd3f353)},
+    {W(0x71f662d2a2040bb9), W(0x9304bf7f3a07b3b3), W(0xf25f291d44cd9f40),
+     W(0xcb994ae37218626b), W(0xb9b6a29cde345aa3), W(0xe99d708bbf4c9777)},
+    0
+  },
+  {
+    {W(0x1336e74344f1918e), W(0x13608f49de09a49b), W(0x2c55bc7e6a5ddb00),
+     W(0x414b8530624860d5), W(0x6facfaa9a8f7d7ff), W(0x270316a0223554b9)},
+    {W(0x0924b8efc47b4748), W(0xc70231edfa244524), W(0xa525e2a68e9e25e9),
+     W(0xd0b6301a11edde21), W(0x44eec48354cc6210), W(0xb086c4764e1edf21)},
+    0
+  },
+  {
+    {W(0xd1f9119157038e7f), W(0x759baf82ac0c0ca1), W(0x486ac3be24a990f9),
+     W(0x0a0fe85aa0c6815f), W(0xd87bf5de2c1d66af), W(0x9becefc5ef8657c5)},
+    {W(0xf27f20b93bc5f391), W(0xb56066e31ff94190), W(0x9eafa40bb18cde76),
+     W(0x6996196b93ebecdd), W(0x4b6f506fa1c70421), W(0x5ac0015f965e1ec3)},
+    0
+  },
+  {
+    {W(0x12e879013d091d3a), W(0x828af504cc05a668), W(0x7267734e1142a91c),
+     W(0xe017c26b426dcc8b), W(0xcbbaf78ffd499e10), W(0xe2920e3538480ec2)},
+    {W(0xb4121d9889da4e30), W(0x4362283e93c70f73), W(0xb793d5ced93dc2d4),
+     W(0x96dfb5146b4107d4), W(0x96a54dffea0e349b), W(0xb786afcc65aaff8f)},
+    0
+  },
+  {
+    {W(0x7c49fa0d56ce1342), W(0x8ad55ad96a567f95), W(0x7256bb84c00c1c86),
+     W(0xb454996c24f49dbd), W(0x0bf75dadf4e32358), W(0xcbd1c049e59d17b3)},
+    {W(0xa5c79dcafeb8ac4a), W(0x5b17e056e757d8f5), W(0xd754e6851da5ed4f),
+     W(0x22ce5ca4184c6604), W(0x488e7fdb5f1375ae), W(0xd4e234305fdd6e90)},
+    0
+  },
+  {
+    {W(0xee06f4e8c712775b), W(0x7f7b2b0bf660b68e), W(0xf721c40460d81dd3),
+     W(0x95d9f6d7355b3756), W(0x792bdac898bbca7f), W(0xd75d38f7e9f4c1e7)},
+    {W(0x1bbe0ee671d7c2b2), W(0x152be7aec1d6dc38), W(0x258c4d5bacf2a874),
+     W(0x87252b35f1a078cd), W(0x135e934c638f0715), W(0x6ba9280ec348a1c1)},
+    0
+  },
+  {
+    {W(0x4ac25c553f24c5b1), W(0xc0b8caca204920fc), W(0xbea8d40c8aaaf318),
+     W(0x6135fe33668f63e4), W(0xb00ed5af92b03415), W(0x6a62a9d49a1a9d2f)},
+    {W(0x36f7ec8d96889f77), W(0xbd0d2dbb67f5cbfb), W(0xdadcffd8576c3736),
+     W(0x153f909a20fcf95e), W(0x83f2f4d62ad7709b), W(0xc2dd7c0bffa74f34)},
+    0
+  },
+  {
+    {W(0xda32fef6e8cc5b28), W(0x4722d93ed7845604), W(0xa8e703eea6e8e0a5),
+     W(0x3e21e30697b6679d), W(0xa7ea8a73ba8300ac), W(0x20c8f0fb97cfa873)},
+    {W(0xba9cec74e67e6ab1), W(0x0f90e83447483b2b), W(0x2698808daa33eab3),
+     W(0x7d1a8c5289ef8f8a), W(0x286cbc326982cf10), W(0x28a430e95085c58c)},
+    0
+  },
+  {
+    {W(0xf06074cc753ab6a5), W(0x276894721d7da3fe), W(0xa8b03eec8f8da1ab),
+     W(0xb20bff68490e651e), W(0x3e0d6fe9e0a14374), W(0x4b5e0f57c9a77fa8)},
+    {W(0x2dbfc7365d7da8be), W(0x2ffef51403a49dff), W(0x7990e50c08e20069),
+     W(0x379a463ade50be8f), W(0x827f9aeda49cb917), W(0x016c293347a27e8f)},
+    0
+  },
+  {
+    {W(0x03e01514ac924c0b), W(0x05143e2406bfd461), W(0xf06dc8720e3155ea),
+     W(0x5da594a837f28198), W(0x22f97dde0d6ba49c), W(0xfe857d968029b9a5)},
+    {W(0xa1227cf7295acb93), W(0x434a3bb911d23a37), W(0x0f181f85667e3cb7),
+     W(0x3254aa0308c91b43), W(0xc05f8a48d21be098), W(0xd4b220553ac41851)},
+    0
+  },
+  {
+    {W(0xdf0318f97bd24548), W(0x7c015fd79c0335f0), W(0x3a088edcf382ff60),
+     W(0xcbac85a479c3222c), W(0x8b6ed3e4c269ec5a), W(0x7140de1437f63297)},
+    {W(0xe2553885abcff900), W(0x0940d6e44b7a2d30), W(0x492b878d5ddc6473),
+     W(0x11fb3782e233eeed), W(0xc76b5f8190fdec8c), W(0xdf082d57b843d63c)},
+    0
+  },
+  {
+    {W(0x49031acbdf1cda6e), W(0x8e66218adb62f4ab), W(0x7e4b15f7e7d9be93),
+     W(0xe54431fefb2a716c), W(0x327afb43d9d0ffa1), W(0x173371113d8d5c22)},
+    {W(0xa256b7ac446e89ce), W(0x3884a09806beb137), W(0x6f64020220548bd9),
+     W(0x008ee01850db6aa0), W(0xe59e4e9a5133e14d), W(0xe8ba7c1ab9c01dbb)},
+    0
+  },
+  {
+    {W(0xa10937e4e7c119a7), W(0x4bd4b3ccd82ca345), W(0x543b58002aabe6ec),
+     W(0xfcd5d2cf7d47f1f4), W(0x0d35a1837f30a245), W(0xd8119965253a5118)},
+    {W(0x31a4b625ef99b411), W(0x00c1b2f4f29357ee), W(0x1a05ea448d28715e),
+     W(0x3063ebbb3a92ba2e), W(0x079a207699b9df0e), W(0x073eb92cf2b98c82)},
+    0
+  },
+  {
+    {W(0x6232e7fc5c42dcd5), W(0x8003a601b74805d0), W(0x9109dbd51aa4ded4),
+     W(0x1ef1e7d34ffa24d5), W(0x94f1053f8c554cdd), W(0xda2a41a25b1784d1)},
+    {W(0xc0813a9ccfc62aee), W(0xbb050ee1ce476641), W(0x0643f495f0f84295),
+     W(0x4bb2a0cd8af90aee), W(0x6b957dc4372b6814), W(0xc114e56e0245772e)},
+    0
+  },
+  {
+    {W(0x223936a4e5c4dd31), W(0xdedcbb887d7b21c3), W(0x8c67f4e87c5bf2c3),
+     W(0x5a565bee66744449), W(0xf8d90b0d708d70e8), W(0x158e13326c6fa03e)},
+    {W(0xa6a3238280bfdb4d), W(0x61bc727dadb6f527), W(0x486d20f4dc88c895),
+     W(0xf518cc47827a33db), W(0xf5b4077737ee2af3), W(0x992dbb681e26716f)},
+    0
+  },
+  {
+    {W(0x8960f6837923f6cf), W(0xde57a4d6fb75b3a6), W(0x05f915eb350465dc),
+     W(0xeabe35415fc1c259), W(0x26aaee4c12bd5082), W(0xbdc7d345fb83592a)},
+    {W(0xe4070f9c31275ed7), W(0x8acdbfb3be1ffe4f), W(0xc7df76b30a2ffdc8),
+     W(0x73f62f63f633f056), W(0x2c2a5b16151808eb), W(0x970cddd381b34ec6)},
+    0
+  },
+  {
+    {W(0x3dd7006ec048d4a9), W(0xfa50b13af898e3ac), W(0x01cbce090fe11394),
+     W(0xa4bc6ad679330f7a), W(0x65d17dbba66d0c8f), W(0x2967ad2edef138e9)},
+    {W(0xc2729561350444cd), W(0x1dd025493818487e), W(0x36688316087ce76f),
+     W(0xb81f09c3b6078dda), W(0x3d7e104e1962540b), W(0x5f9b89815bedbd9d)},
+    0
+  },
+  {
+    {W(0x2511bd6c9c401e38), W(0xd77ddbcc97dd45a8), W(0x4b149dd53d6a01fb),
+     W(0x3d236a50cb600fb3), W(0xcbcb43e56ec807be), W(0x46daf3f2928bdf1d)},
+    {W(0x20c9add5b89d2dfe), W(0x7c48be8cb94909de), W(0x5d43196101523fa2),
+     W(0x3e02b727561ea0f2), W(0xda9bd0a32a6e41c2), W(0x8f369fe63d73990f)},
+    0
+  },
+  {
+    {W(0xb427e7893b66735a), W(0xa9ddfd5ebb718422), W(0xe7c141d0759bdc2c),
+     W(0x3c56cb6ec56eea72), W(0x50936f32e5e525e6), W(0x50707542dc9be0a5)},
+    {W(0xaf729e45494ac9b6), W(0xdb8733a29c4a1861), W(0x42864e7a4a4a36b6),
+     W(0x690f4b018243d3a4), W(0xde07f9fc417b4b07), W(0x1b4c7fda5cf952c4)},
+    0
+  },
+  {
+    {W(0x5e4631e873aff52b), W(0x6e8de65775517037), W(0x38b9acb935ea6b5e),
+     W(0x2d6da5aad0e3ffdb), W(0xf71f686b222475e6), W(0x1d92970ffc663761)},
+    {W(0x8e907ce8506c641f), W(0x5f47fe790e7e82ec), W(0xe47828ddba31a0a0),
+     W(0xd12baeb62a688150), W(0xd76c2a9a55d923e7), W(0x864e1573a5c53e88)},
+    0
+  },
+  {
+    {W(0xcb9db553647400d6), W(0xf6d6c1200df62c2e), W(0x661fd4acbe1d7c2e),
+     W(0xbe24993ed8b2f5c6), W(0x3c8f1b05acf21fe9), W(0x7f8efaa19712486b)},
+    {W(0x96d053ee4f88eda3), W(0x6daf50c73ee54a01), W(0xbb677bdb4bd5628e),
+     W(0x89e2bede821898aa), W(0x7b468dd7c7abd616), W(0x51e1b7d330f777f8)},
+    0
+  },
+  {
+    {W(0x5d3e325dfe360ad0), W(0x81d8521f3e66882a), W(0x9ce4f2b6d2920e5c),
+     W(0x4059e646d200d309), W(0xbd01d258ce05513f), W(0x39950394d649f242)},
+    {W(0xdc1d8ee16f15a3fe), W(0x688b25657b4fb3dd), W(0xae99a0f6fac868b1),
+     W(0x9fe545ea8078e83a), W(0xe3e63175a9f59606), W(0x8b51f2bac357bdfe)},
+    0
+  },
+  {
+    {W(0x9fa5bd9ed5da1249), W(0x02cf5fea6488c75f), W(0x81bfdf33d04d5277),
+     W(0x590f2ada8b1f3150), W(0x678876759b74c7d0), W(0xb7f0ded68c74a445)},
+    {W(0xe1e74e4d013a357f), W(0x48f8e886fa86863d), W(0xb9a04d91b3d85c67),
+     W(0x425013a3e0130b8f), W(0xbc55385905bd45ce), W(0xe1168c1699c6989b)},
+    0
+  },
+  {
+    {W(0x0a2c0c1804fd34df), W(0x455df69af3edf8d9), W(0x59f86e5f9ae30968),
+     W(0xa944402d84f4a6a9), W(0x66c95eafac31edf1), W(0xb25937ce7a3696c1)},
+    {W(0xd8819659f525cea3), W(0x054fdb2b6b73ef7e), W(0x2094769f4a75d04f),
+     W(0xd23ae4171806341d), W(0x6a771f1d7b4dd243), W(0x99a9e00902fb752c)},
+    0
+  },
+  {
+    {W(0x8d01cc439b5ad288), W(0x35d8b3e27ee63156), W(0x5b61608af7b651e0),
+     W(0x41b162d6e416bd34), W(0xe943cb8a594d4002), W(0x8e99c1a9c66c8300)},
+    {W(0x20d978f435684b65), W(0x280660af117ff441), W(0x7c7e506839d7fa32),
+     W(0x46e128ce6111916d), W(0x7596b6452f962953), W(0xf25790978269a0ef)},
+    0
+  },
+  {
+    {W(0x84c7b5fd263de315), W(0x5c4f87ad3c05428f), W(0x4594d18e3f4cc652),
+     W(0x7e893d889754d543), W(0x240457a224973ce7), W(0xab81683c6045a7ba)},
+    {W(0xe26c3489f5952da4), W(0x1914903201000cd7), W(0xcfdcc114339b207d),
+     W(0xbc26d48486ae5320), W(0x5612e08530451ece), W(0x985d485e6db5175f)},
+    0
+  },
+  {
+    {W(0x982da10dc415c660), W(0x3f618be99b8cd164), W(0xf514e93c1f52669a),
+     W(0x7e885c4948d72376), W(0xd7cac87d82c0a603), W(0xff20e5a8289ed21c)},
+    {W(0x9be0c7bbcb09b1b2), W(0xc40d56890fe0c893), W(0xa3c5ee5ea15e1fbc),
+     W(0x07481430f7a1e447), W(0x1aa0db0003e62f78), W(0xfe1698f5dfd59ade)},
+    0
+  },
+  {
+    {W(0x88db9210a0453873), W(0x9f875933a5e5ce3c), W(0x8fd2aac76ffce9ec),
+     W(0x13eb0209841698c0), W(0x7c1af21fc44c59ef), W(0xdf6baf640bb6f65a)},
+    {W(0x6561f1e2cc0132fa), W(0x70854f37b3d608d8), W(0x941aa4df52cb6d74),
+     W(0xe9d53139fb42bbcc), W(0x512a112435cf8ff2), W(0x69aca6d97dc7f50a)},
+    0
+  },
+  {
+    {W(0x16fea309a97b6752), W(0x00a18c4f2e9945de), W(0x0c77d050ff752ca8),
+     W(0x04c67b401b2100fd), W(0xc033fdaa02a361b7), W(0x89b8f9bf246eac4f)},
+    {W(0x527fb3e0e2a992a1), W(0x03fd9b5e9503bfa7), W(0x5f9164aeb3fb9203),
+     W(0x45c35576eb330a74), W(0x9a217c62a9fbd259), W(0x08f8afb19a6a56ed)},
+    0
+  },
+  {
+    {W(0x2b4fd27564cbd5bc), W(0x5b218720264b9746), W(0x2b530c8e307933f4),
+     W(0xf19c80f7f6a5791a), W(0xea362ac2b3c132ca), W(0x48113417f3312154)},
+    {W(0x6b42ed3a5b4ca93e), W(0x1a6652c4f41b7955), W(0x12bf3f57bb9b6eec),
+     W(0x14b39eeeb7d14966), W(0x27cc9a7361807f72), W(0xe735e336062e1e95)},
+    0
+  },
+  {
+    {W(0x6e54d6bb1dfc87a3), W(0x1ebc0cd81747f380), W(0xf14f47a4a0e98992),
+     W(0x2b2974b72d27dc7f), W(0x154532311ba4c82d), W(0xe8ad9fbbc749f15d)},
+    {W(0xf8103839f7b7a67d), W(0x25b43ce6c012e3f9), W(0xf3bca763a042f9d7),
+     W(0x8f6f3070daf71ebe), W(0x112bace5628ca518), W(0x0e3a523ebb8c2eb0)},
+    0
+  },
+  {
+    {W(0xf262bb3cd5e0efe1), W(0xe9b0b81a0c88f658), W(0x6aff040ccd7d1fba),
+     W(0x8960cf50845188a3), W(0x1c7cba7cba12ecea), W(0x0327d3a42354b88c)},
+    {W(0xa7cfd0832da6d7b5), W(0x81d5eb73b0b54261), W(0x498984bd92e5cd37),
+     W(0xa4fb990f28d672e9), W(0x9f489343cd1ed8c3), W(0x4a5d7dac31788ddb)},
+    0
+  },
+  {
+    {W(0x250297af54240a5d), W(0x1dca9e18bd9a3735), W(0x96a0e56cd499409d),
+     W(0xc1d3d435c7f9f1aa), W(0x778b643bf824d2dd), W(0x25f677ba3057fbbd)},
+    {W(0x6790dad6ff9f5ee5), W(0x782423729a4cd7c5), W(0xc8e38e6596c693fe),
+     W(0x3406cdee1b14b90a), W(0x51bc2c38244ebbc0), W(0x2fd8f0e663b60b2e)},
+    0
+  },
+  {
+    {W(0x176fd2cb652caa54), W(0xee73e7fb7bb0c11b), W(0x14a765d4cbd96310),
+     W(0x3334a991f98ad52f), W(0x8d9a600b981e51a4), W(0x32b2049653762256)},
+    {W(0x8be2e3dbaa9eaa58), W(0xfd7a5dde7ef4f4e3), W(0xe78f3ca185e117fb),
+     W(0xb6afc7a44a90f0c5), W(0xc663ff856b9b5cc1), W(0xbaf8713696a6cd0b)},
+    0
+  },
+  {
+    {W(0xc10782b9cd914ad4), W(0x3a332435311285c6), W(0xa054037fdcb22f99),
+     W(0x7f79204607f67aef), W(0x619014c81b0d13cd), W(0xff58f4a097745023)},
+    {W(0xaebf97ad8c37f5d9), W(0xc6416972c11a6d1e), W(0x3c69164d6f89cc53),
+     W(0x64ac18cc1e4da9ee), W(0xf619d8e124076ecc), W(0x57e8c7e458a3848f)},
+    0
+  },
+  {
+    {W(0xeda282445edea081), W(0x8d8198920bc2651f), W(0xa16eec5c1d4a5536),
+     W(0x4082fcfeb4224baa), W(0x1bd17b938044a5f3), W(0x9acdf9b4f726adce)},
+    {W(0xcf181361f564c1c0), W(0x4ac7a6fcede59098), W(0x6b12272133b3d19c),
+     W(0x1f73bbc203b18300), W(0xeded1fb9ebf5d6bf), W(0xfb5dc06c72a964d1)},
+    0
+  },
+  {
+    {W(0x2a5b720ff42bba3f), W(0x9fba22f1cdcf4aff), W(0x087f7d4cd815a968),
+     W(0xd866b1e25058582e), W(0x43e239cd0f1bebbe), W(0x32518d5c063a2ab5)},
+    {W(0xa8d29258719ed632), W(0xd812e33d52ef62a0), W(0x3e42586b9c1101d2),
+     W(0x1ad171a9a4ff1912), W(0x4a4b45ff2f622b4e), W(0xbf4d64da02d00e07)},
+    0
+  },
+  {
+    {W(0x830c63e008088a84), W(0x003129eb5245c65b), W(0xfdbcf895558f894c),
+     W(0x713f111756df6d95), W(0xf746a9dd563dff67), W(0xf94943c070a13a10)},
+    {W(0x588d635ad3a8d1e4), W(0x157aeea3624e9ad6), W(0x527a98d6ce95bdb4),
+     W(0x8f1e758f15223f90), W(0xbcd7d3f4ffa8e642), W(0x39825cc6637324e8)},
+    0
+  },
+  {
+    {W(0xfef9ec6dcb71e7f3), W(0xf931ad088cc347bd), W(0x3ff3d77346168c0c),
+     W(0x67ff54328b916a32), W(0x77cb94e47912d448), W(0x71cf26e7c4ae5d93)},
+    {W(0x9e21cd67adff5ec1), W(0x8ac3597a4c959cf4), W(0xb9a45909439d289e),
+     W(0x67972bc970c436aa), W(0x5f7a0c12a91ea340), W(0x782272ec02365f20)},
+    0
+  },
+  {
+    {W(0x7f26d85fc2a9337e), W(0xb5581d841e5e7b18), W(0x07ed6a5d6292448d),
+     W(0xc1d9a1e6d22273fc), W(0x62309f69c1aab147), W(0x534680487633728c)},
+    {W(0x7d09c34ea4f0fdee), W(0xb5a6b75d37f3cb8d), W(0x80dd4696904275d2),
+     W(0xa50645f6f9bc9026), W(0x5fd9cd8150aaff23), W(0x3bb08732117b604f)},
+    0
+  },
+  {
+    {W(0xaeb28c4c831e5b11), W(0x0883c0fe022be2d1), W(0x2e825ced962d46ea),
+     W(0x506379562a706ece), W(0x9e6308332e169788), W(0xcc966510566069d7)},
+    {W(0x73df14dbbf025f97), W(0x8fe9556493037687), W(0x7cecf91a44aacf38),
+     W(0x11a2ed0ea2c5cae8), W(0xe116c1bcd23da430), W(0x9d822fbcd985c4a1)},
+    0
+  },
+  {
+    {W(0xd58be132b4604c52), W(0x908e021cb022717f), W(0x3fe081e80ca0da48),
+     W(0xd16b883deb629f36), W(0xdab456fc6994e933), W(0x4408f3017db36e96)},
+    {W(0xe42d56cab9e0eaf0), W(0x8911bb0f76a26ae3), W(0xa0727e34f0396463),
+     W(0x9fab5e851f4a725c), W(0x6b1a5a62d649198f), W(0xdf8098815a7df2db)},
+    0
+  },
+  {
+    {W(0x63ddaea7a32b0805), W(0x05739c19f70cbe8a), W(0x7553b0fbdd340827),
+     W(0x1e5fec5f15c14d08), W(0xc5cc16e412b354b4), W(0x96e870db2603a9e7)},
+    {W(0x65499f7653394784), W(0xe16f1713c103d56f), W(0x6769243174860d49),
+     W(0x89d0f42c444aa8d1), W(0xd067a0387b520179), W(0xbbb6e718bd49cd79)},
+    0
+  },
+  {
+    {W(0xa936053c24634767), W(0xbc4b35bf1d5ada19), W(0x29b8e767f892c3d3),
+     W(0x913e20f6d4e0cd40), W(0x89d9fdca5ab693e2), W(0x1226c22a94bb197a)},
+    {W(0xb0fec5190f1fed26), W(0x399467cdf54ef2f5), W(0x968bac5f8ec16d5c),
+     W(0xa8ff814feba50ca1), W(0x645d3f73fc7a0179), W(0x8c99ae29890a8e01)},
+    0
+  },
+  {
+    {W(0x739edafc33351491), W(0x4f82f32ce3edbaea), W(0xf4c64614c53faf9b),
+     W(0x8364dcf751cca643), W(0x1402bfdbf2172c9d), W(0x7226195f6075ec09)},
+    {W(0xa08d21fc68ed86bd), W(0x99fa0820493fbe68), W(0x6d0b17f34b5de173),
+     W(0x1bd3ed0af4fae8bf), W(0x30bda024e521b1e4), W(0x65d5fa40c3344aaf)},
+    0
+  },
+  {
+    {W(0xfc3cf43764afc5ba), W(0x20fdf0c446db6c37), W(0x72449941a490b250),
+     W(0x616b7b5659d384ea), W(0xde2ca854f9a26e97), W(0x8251f599298e59d2)},
+    {W(0x501fc2fb98b0a758), W(0x75e3eb249c8f3b3f), W(0xeea5df39a8262c89),
+     W(0x794bc47f94a964b5), W(0xdad262076fde5e04), W(0x95e43109b1af4103)},
+    0
+  },
+  {
+    {W(0xf7a5954f692e4b5b), W(0x943eb4beeb866a42), W(0x30d5116c1179547c),
+     W(0xf281d80ff8f2f737), W(0x450114f9d3fa9252), W(0x6a4a601937889066)},
+    {W(0x2475536ec99a008e), W(0xacede37c400f7845), W(0x1e52cae9ccf187c6),
+     W(0x004c569bf6e0bc6f), W(0x3373f721c29106e9), W(0x29923e8f34dee4ab)},
+    0
+  },
+  {
+    {W(0x392616d58b91a64a), W(0x45b170547dd5059b), W(0x20b250a69a8c2c8f),
+     W(0x0a2a53fc13f050a0), W(0xbd0098886d547cd8), W(0x3537a9fe8f428d70)},
+    {W(0x7e52c94fb9f1b14d), W(0x6e6f745badd8608d), W(0x3f9a87cb18a7c196),
+     W(0xb675443a9d53a6ed), W(0x5874d4fd2455c92f), W(0x6d2777c231708fa1)},
+    0
+  },
+  {
+    {W(0xfb86e446856fee56), W(0xf3cb00cd037cc6cb), W(0x4f18e25a3a82e380),
+     W(0x4f3037dd2d8f0935), W(0x91c913d7e69ffe74), W(0xe437958ab7a58906)},
+    {W(0x7a4d4b6ac9c479ff), W(0x9476e3f4ea28aa2f), W(0x84981433fc08522c),
+     W(0x010bf483eacc845f), W(0x0781ae77f11cc336), W(0xae18f4f6f70b2260)},
+    0
+  },
+  {
+    {W(0x5920ccb449cc71c5), W(0xfabf74449b417bae), W(0xe2099bd3af86e240),
+     W(0x2b126390999336b3), W(0xcdbed6d2052c27ce), W(0x829ddc3a7b905395)},
+    {W(0x0817662b60979420), W(0xd502fbcd65af344a), W(0x07248df0b3927b5e),
+     W(0x4a17863362807302), W(0x077d3ba9e345597a), W(0x2f6ba6663db1fc22)},
+    0
+  },
+  {
+    {W(0x3de8037d4edc03b6), W(0x2ae496e9bc6cd56d), W(0x801416eb64b1c151),
+     W(0x8c2d67e5b5c1f0a7), W(0x26580772a0794f5c), W(0xe6fd4426ce7505e5)},
+    {W(0xa079fd02c5da13c6), W(0x84cd7e76102a5b35), W(0xd24f11dfcd6ab522),
+     W(0xc5efaf6eaa125a5b), W(0x348a803f64808d70), W(0x621dec8fc3a9bbf1)},
+    0
+  },
+  {
+    {W(0x4f35f997a329a088), W(0x8c637fb219c1381c), W(0xf3a83fc0244176e1),
+     W(0xf208e50b0bb85561), W(0x23fa4303de7c271c), W(0x25094e79272cbd0d)},
+    {W(0x8140c6884b1c59ad), W(0xf2f1f6517067e111), W(0x41f957c08d665bcf),
+     W(0x45ffb8cd1e60fa5d), W(0xebf9b1f2669e6433), W(0x511f847ecc49d0a7)},
+    0
+  },
+  {
+    {W(0xd124c7df2605ef87), W(0x8f2a47617b7d4d49), W(0x29061ee7e1d4441d),
+     W(0xa1a5857f85e07478), W(0x96f82dc324ac7a6b), W(0x4e56704ff336a31a)},
+    {W(0xad54926e4beafdf2), W(0x4a94ec7e51958238), W(0x5dbd880c4325f783),
+     W(0xf92fdc09951688ec), W(0x490390b7147124c3), W(0x3cfdf0d49a6bd8be)},
+    0
+  },
+  {
+    {W(0x3367487ec2454a77), W(0xb2c9080290df415d), W(0xc3bd8f5c139321b1),
+     W(0xe2377bf2edbd5694), W(0x993d47bf3756e452), W(0xd3f30c6387bdfe01)},
+    {W(0xaaafd7930c5c59b5), W(0x6f508298511d2456), W(0x98005e25a1fe4918),
+     W(0xe835d97e4ba18dfe), W(0x0d3a5945f65f5adb), W(0xf3e1a661cd0cb418)},
+    0
+  },
+  {
+    {W(0x1a91810aa0dcefa5), W(0x47501d2f4ec34c85), W(0x1ab3ad8623a3b54f),
+     W(0x4628a17f27f151b7), W(0xf0dd2d89c8d75535), W(0x60e4032f06d549ac)},
+    {W(0x0406b9d5e0b51ba6), W(0xe749cc0c786028df), W(0xb2f4fd95e5469691),
+     W(0xbe839e2d30efb9a2), W(0x5a0f0ad857d9780c), W(0x6b1a35c1b38618a0)},
+    0
+  },
+  {
+    {W(0xe78a4e2e25b21d63), W(0xbcd4937b9e3f8b8a), W(0x3513414a825af7b5),
+     W(0x6179d0f8a8d66d15), W(0xc0a13c61705c3df0), W(0xf8a0e4e3626859e1)},
+    {W(0x4e59b97e791a0764), W(0x796d1eea6c7301b3), W(0xc629a2f444af6798),
+     W(0xc64dca756bcc254c), W(0x9812a0dcb8564ff2), W(0xcbb231b2932ec9a9)},
+    0
+  },
+  {
+    {W(0x1fcaddab04089984), W(0x806df0bf7b28d01c), W(0x866ccbcc774a3247),
+     W(0xd2cd5ff7e518fb64), W(0xd5e44eba2d896d69), W(0x5c19c9a147f18c49)},
+    {W(0xbe9f29d7f8af847c), W(0x6b9277006b5d036d), W(0x403393ccf4dd64a5),
+     W(0xd91b0c4ec72736bd), W(0x079767308126b120), W(0xfc1a9b1d60476a2c)},
+    0
+  },
+  {
+    {W(0x054ec8c210ad11fc), W(0x88778968d9514260), W(0xc93a24ad2525cb6a),
+     W(0x20d500cabd960fdf), W(0xe4ded7508d12ea39), W(0x2685a096ce652933)},
+    {W(0xc365d6f4bd02a9bd), W(0xdd1524108bf5785a), W(0x531f0a26bc4b512d),
+     W(0xa80c2ba957976777), W(0xbff002b9fd7f9338), W(0x5fcfcd9c6600db37)},
+    0
+  },
+  {
+    {W(0x76da1a3f22d8f588), W(0x471c270ec6369048), W(0x11f07f1d7acf7248),
+     W(0x9f4db17b80b8ecc0), W(0x6b3b0245b85860dd), W(0x6b370b4251f203db)},
+    {W(0x451e347a874414db), W(0x1b7a715a18280f54), W(0x8fd4adb5df6a5f96),
+     W(0x0fb6c99406835345), W(0x06b3afb1dd03f20d), W(0x688ef4308bf8e49c)},
+    0
+  },
+  {
+    {W(0x238b3dcd47fbef6d), W(0x53f71dda92a2d745), W(0x51cd986bd430ae11),
+     W(0x6003260a724c593d), W(0x0f4b48dd77c7bdea), W(0xd8f06907dc71bd85)},
+    {W(0x3c98f161726bb28d), W(0x4790106f937d9ece), W(0x340d6e6190e3a78c),
+     W(0x183af9c7bedd1f07), W(0x91863310672e5025), W(0x4495ed8c52bda6df)},
+    0
+  },
+  {
+    {W(0x452eaccd598e3f95), W(0x983fce3d76ba7c31), W(0xc0ecf2779fd2010e),
+     W(0x7995c5d2af9428d4), W(0xd7ce2153df0ed407), W(0xdea7070268226af2)},
+    {W(0x4ac2a5b79627443c), W(0xa96175f55499e54a), W(0xad990ce13771162a),
+     W(0xa0e7f2592aefa968), W(0x01224774d1006717), W(0x9e6a4f0d510daf72)},
+    0
+  },
+  {
+    {W(0x82baa37779bcbeb3), W(0xb31fb2a9aca8d3f2), W(0x34b3d920085fd84c),
+     W(0xc6b665c64da8e3de), W(0x680f30da48141746), W(0xa3a0463d75df57f9)},
+    {W(0x53b6fa7830ab362c), W(0x58d928cb2dd88bc9), W(0x47d8171b60e131e6),
+     W(0x3dd1c13622644e54), W(0x19e504f64bdec655), W(0x8099e1c7782abedd)},
+    0
+  },
+  {
+    {W(0x5877e9bf2ff0ddc5), W(0x7b11ed02d792d5c5), W(0xdacf3ac8aba82343),
+     W(0xcaea109a61bc27f5), W(0xb17132bc9aacba42), W(0x5865b33b1408a608)},
+    {W(0xa69733ed5e2b71da), W(0xb6ea289a353f2de5), W(0xd0ee5f5cfe35764d),
+     W(0x7abbdd88858f5128), W(0xf473457caff1272f), W(0x45aca252a371940b)},
+    0
+  },
+  {
+    {W(0xa02ef061d4014883), W(0x524cca65cc9cd939), W(0xc5a974364817d4ea),
+     W(0x1858c10b0cf1950a), W(0x2d476a315c032103), W(0xd03acd7e52083ab9)},
+    {W(0x44ad6754eb0dc4e9), W(0x99f27ea2f7a3b7bc), W(0x25fe819e6f840244),
+     W(0xc60b01fbd46bb0e1), W(0xb53740fe8e1d4ce2), W(0xcb61915c5438e9de)},
+    0
+  },
+  {
+    {W(0xc4fcaeddb2b687ed), W(0x47e107bb99cae659), W(0x218ca61e912f8198),
+     W(0x842a96469031ee48), W(0x7c814a6543cb90cf), W(0x2d7d0edd972ee3eb)},
+    {W(0x93335ffa10c5d943), W(0xc1d6fd842956c336), W(0x03e538a5f57f5f90),
+     W(0x40a1cc21ee4986dc), W(0x6d64b8db06483dd3), W(0x9772f60ac2f8e398)},
+    0
+  },
+  {
+    {W(0x8f40da0e7cc8bcf6), W(0x2fec51b32cc199ab), W(0x9769cc70c1223b5b),
+     W(0xce1c6b143c7a0425), W(0xe4d0a6ca82ae5b8a), W(0x0913e0104d5b3373)},
+    {W(0x399bb924d6de8e5f), W(0xff5f2bd2c7fd7f62), W(0xa21c9fb844af273a),
+     W(0xda5748648954ba56), W(0x9a34bc9792da6f65), W(0xbccaed92ae629707)},
+    0
+  },
+  {
+    {W(0x77af5534a4561ef3), W(0x972b27b10dee2576), W(0x70f75f6ba7a1f029),
+     W(0x5f31612c28d2fe40), W(0x532a421ee193ee5e), W(0xbbc3a919a30ccef6)},
+    {W(0x4c2f69af3fed391d), W(0x97d1de29003661e5), W(0x41df40a7b3b74a2a),
+     W(0xea41b60701f3bc1a), W(0xb5d79c450cb8e7c7), W(0xd8cbc6bef16d20a8)},
+    0
+  },
+  {
+    {W(0x70436d0193e56e98), W(0x206edbca8e1fdc36), W(0x91f0752dbef6d46e),
+     W(0x10921f2d2f87e2bf), W(0x07fa6531d46f055e), W(0xe736a2790629e7e6)},
+    {W(0xe2d83cdc1233fcda), W(0xc23166b5d3026c97), W(0x389a332ab4722aa3),
+     W(0x5f60adbf1fc77f1b), W(0x313e789ee7dea0a3), W(0x33074cab87e59235)},
+    0
+  },
+  {
+    {W(0x6c0d92940a9fc857), W(0xce83cf2f8fe98282), W(0x935a68b82cba883a),
+     W(0x3d5e66d7c6c57a5f), W(0xd22176dc37d1c778), W(0x8c635fdbc6818a8a)},
+    {W(0x04048784f50190f6), W(0x3a90a505e5014eaa), W(0xd8d75957416c2bb9),
+     W(0x29494e197d0165c5), W(0x76f122f970bae723), W(0xae8c0307beeefba1)},
+    0
+  },
+  {
+    {W(0x62582755695ac1cd), W(0x2155f5181bc98eb3), W(0x610c2df3801e8950),
+     W(0x92d7f8f45350fbce), W(0x1f3bcf8a3add0dcf), W(0x759ce727fab98899)},
+    {W(0x92b2f257e6141193), W(0x1a2885af55276225), W(0x1b0864d4488cdfef),
+     W(0x100346e59d4365ad), W(0x4ac2932bd189907d), W(0x401b4ceeac5c48cf)},
+    0
+  },
+  {
+    {W(0xdf964c73129c1404), W(0x7e276b30a132cc21), W(0x20f66200b053f86a),
+     W(0x2e595c2a864633cd), W(0xc6c208121d844714), W(0xe7405e78fb4b9eec)},
+    {W(0xc3ce8ad44c84ff94), W(0xdcb31849b03350e6), W(0x2c0061c9dda5ab38),
+     W(0xabb209e4f2f635cc), W(0xba0e4b36f0d79229), W(0x04d55ac6b51bdded)},
+    0
+  },
+  {
+    {W(0x96c730f0bb012c82), W(0x0b58e912a204af5f), W(0x5ca10747c83bd2d8),
+     W(0x3eb93b83fa92090a), W(0xffec0c62089b029c), W(0x51c6e897a17207aa)},
+    {W(0x88029d52188a9e62), W(0x60f0fd9c87a83d20), W(0x5c75088a848e53c7),
+     W(0x99185f7d1497f8b6), W(0x78c91f5de74f8d80), W(0x60c202119d4a174c)},
+    0
+  },
+  {
+    {W(0xa31906862164c42c), W(0x4a08ae33521f8baf), W(0xace5f397dd120003),
+     W(0xfbe211c1b5b82fe1), W(0x4fece208791f542a), W(0xf6662cadb02d6910)},
+    {W(0x5a80dac1834a3a62), W(0x554d6a8bbaf43414), W(0x6b358410010d4acb),
+     W(0x5f427bdf5ea84660), W(0x7dd52140f9b91592), W(0xafccabaf9d52a07b)},
+    0
+  },
+  {
+    {W(0xdd21c2d701b1559c), W(0x350f1cbeff23b6da), W(0x15fd8898222c3f37),
+     W(0x22db458a01ed5ed6), W(0x420f922fa2386f61), W(0x2d9e31cfac092fc8)},
+    {W(0x689ce0cce732cf1f), W(0x4c9b793d78409842), W(0xf793441dee1b842c),
+     W(0x3d1fe432f928d5c9), W(0x39ca68527001a20a), W(0x138aed42b6db65cc)},
+    0
+  },
+  {
+    {W(0x44bb930b03233d94), W(0xfcb40441352b1a49), W(0x91659d26b59857de),
+     W(0x4d0e061877f8a248), W(0x6023ef4cef752ddb), W(0xf2a1719b005eadb1)},
+    {W(0x2ae6dcb3af850088), W(0x4404239d6eccb938), W(0x62dc6cfc6886d6f3),
+     W(0xc335eef29b5f0cfb), W(0xe94a658dfe66cb6a), W(0xa7c4ad993efb7a70)},
+    0
+  },
+  {
+    {W(0x2fbd9645f84aa7e8), W(0x4b5c83808fd1a601), W(0xae674a10f0916b3d),
+     W(0x35c96fb1aefe47d6), W(0x75a0baf907e98f5d), W(0x10ca2d996bcfea1d)},
+    {W(0x7726110faaeec21b), W(0x81cfe4cbadb055cd), W(0x277b4a883feaa817),
+     W(0x5e3ffd90c4ab06b6), W(0xc9704012bf114d83), W(0x49e00ee2257e4bd6)},
+    0
+  },
+  {
+    {W(0x9509db6cb707405c), W(0xec0762669699a0b1), W(0x34629a7f25eda2c2),
+     W(0x99def0288f9ed210), W(0x002927dc736cfcc8), W(0xbdafda1a5834f17a)},
+    {W(0x9d67a1415b163d68), W(0x1fba20fe88ec9531), W(0x917cfa347ac69217),
+     W(0xafc9e36521949593), W(0x35b851660e1a2cb2), W(0x1c742a656c4c41e7)},
+    0
+  },
+  {
+    {W(0xa3da4fde09fea78b), W(0x798b929a437900f0), W(0x2d00ac7adf336a89),
+     W(0xa9c3552a27849250), W(0xcbc6458991abd7b4), W(0xc60e2e8113312479)},
+    {W(0xee675f1403f5fb4f), W(0xb640afb7bf5cd11b), W(0xc46b3fc8629c9138),
+     W(0x1ed56268b9c58f31), W(0x4e75b4391ea67a7c), W(0x149dd8b570619450)},
+    0
+  },
+  {
+    {W(0xae3544d6c3ed676a), W(0x7e0f208578fcbe66), W(0x2be2cf62288ee491),
+     W(0x6c1a5dc8c1f2d88e), W(0x577f5e9bdac5839d), W(0x3de0e2f24261badc)},
+    {W(0x42e43853976c1570), W(0x15d648cc4872e693), W(0x5763dd2a26639b90),
+     W(0xf684ab57450f708f), W(0x62855c737aca0ca5), W(0x9754ec04ae9b0860)},
+    0
+  },
+  {
+    {W(0x9dc89f4d54bd9da7), W(0x60b5276d58c6d4a1), W(0xee293e9e524ac608),
+     W(0xd928f710332930ef), W(0x274c9b62ecd66308), W(0x08f8ee7eef55a71f)},
+    {W(0x17fd5d81cc775c25), W(0xac990518326d453e), W(0xa039d7832e1c4830),
+     W(0x0c3036489b8de750), W(0xd4ee812920ad4214), W(0x14437bf72a4f4401)},
+    0
+  },
+  {
+    {W(0x6d171b9e501525b5), W(0xb7c14110420a022c), W(0x0c671f4531304b39),
+     W(0xbc28994ede88f3ae), W(0xa25cc7044a4a025a), W(0xc3418addab269a38)},
+    {W(0x445e466506c272f9), W(0xb00d0778646c46c0), W(0x684d9e564cca0a87),
+     W(0x6b13bacdb2006b6a), W(0xffaaf4b8e143da4d), W(0xd5a4d6c5c24bd45e)},
+    0
+  },
+  {
+    {W(0x92772b0dcf7230f2), W(0xd40d81fe0fd984e3), W(0xd564e157bd506719),
+     W(0x20fe6f49526a00cc), W(0xa2c2f2c1da6fe105), W(0xf258597742e282c4)},
+    {W(0xfb0a3527be470799), W(0x1fa973cce2620a0c), W(0x2efac0962cd4e364),
+     W(0x362c93febd830901), W(0xab4a8bdaf97f39d0), W(0x6350600ffa5812e5)},
+    0
+  },
+  {
+    {W(0x357ba7ca3bba5706), W(0x78bb352a9ed3e0e0), W(0x055a156f09f731d6),
+     W(0x79dffdfbbcc97063), W(0x9505807b705a8110), W(0x4da74d2e07028088)},
+    {W(0x39d519f69337bf54), W(0xf49a682dac11687a), W(0x5fd65a25474222d3),
+     W(0x39586a15452f93c6), W(0xc01301cdc85f389a), W(0x6fd68b9bb4308e84)},
+    0
+  },
+  {
+    {W(0x29a8a7aec17b47b8), W(0x1632236923532137), W(0x7fe80f0dd7cb3ba8),
+     W(0x6b1339aecbc6a569), W(0x7f6ac9504750a0e9), W(0x5336386e48c788e6)},
+    {W(0x9ceaed6ffb829f06), W(0xa276ea71acd3bf22), W(0x9e8a2365cad76498),
+     W(0x22c22f6404cc944f), W(0xe65cf5f66cbbcb8a), W(0xa2487a2fed4d51dd)},
+    0
+  },
+  {
+    {W(0x350edc9719d268f0), W(0x29af258829525a8e), W(0x3a0292e298213929),
+     W(0x994c0830e8b0e4a2), W(0x797718fc57dd3445), W(0x6bf1651754748f16)},
+    {W(0x0d533258a6721c92), W(0x6a8569e3326fdba6), W(0x02abbb4dbb22bee3),
+     W(0x37cc940c56ea825a), W(0x44856b0395f939dd), W(0xed7401ec6cd6e747)},
+    0
+  },
+  {
+    {W(0xa34ee27c9bc69bb4), W(0xdb97d8fa48cd6ac0), W(0xd1fe2f2f9ccc1d6f),
+     W(0x0a59e49d1ed93343), W(0x331476808a24b184), W(0x752160ad94950607)},
+    {W(0x752cf3fc480b70bc), W(0x6f69e31243b1d0d3), W(0x71307d507d89a9f5),
+     W(0x206c1c13c6890d0e), W(0x816e60d07627741b), W(0xa3b053d7796c9f90)},
+    0
+  },
+  {
+    {W(0xe6440108115937ed), W(0x71c1c3799624df47), W(0x25be871d1f555e70),
+     W(0x31c4cb265cf53e9d), W(0x6889f4940e26b30c), W(0x928aa3cb39d3d711)},
+    {W(0x8d12da1b62e366a3), W(0x5c8a02a866d1c723), W(0x43c46196c9c44d24),
+     W(0xb0ad77f093ff4217), W(0x3c82ac916fefd600), W(0x26a8ebed4e747557)},
+    0
+  },
+  {
+    {W(0x521d0d32535cbfe0), W(0xad51c6a6d2adb406), W(0xf2475999885dcec1),
+     W(0xba43340cf3d9850d), W(0xf8913c8999c1120f), W(0x60db9a62d2740a92)},
+    {W(0x37e171097aff9784), W(0xc83a33d67f4b22cc), W(0x466351b86248f2a2),
+     W(0xeaa2774c19cbefce), W(0x27d5daba621323cc), W(0x59e1c18c0a5cab0e)},
+    0
+  },
+  {
+    {W(0x361c7745361df0e0), W(0xf334e07223c9fb0e), W(0xc72fadff23d16088),
+     W(0xf06498fcfb9fd7a0), W(0x11a1e93aefeebc1f), W(0x4b15a2d8e8b854c2)},
+    {W(0xf47633d769fac78c), W(0x3ac6bc026cfab5be), W(0x23faa756ecdfd348),
+     W(0xae0c0257050fb4ea), W(0xb13b4eabe6b3b0d8), W(0x1aa824863b59e414)},
+    0
+  },
+  {
+    {W(0x00be551150759f1d), W(0x21559148f380fc59), W(0x44793600f8ced3fc),
+     W(0x7d778feae25cc174), W(0x4aad6a5657af90c7), W(0xae7c566235ee811d)},
+    {W(0xc5964dbf660e2927), W(0xbe355e4094786fe6), W(0xb0507ddad0bbd3f4),
+     W(0xd5c2e5e767b9dcbf), W(0xead6a352e2a9c6f7), W(0x45104f2403fe7daa)},
+    0
+  },
+  {
+    {W(0xccfff06978ad33d5), W(0x5ff8a248a374d3b8), W(0xfc64f4cc26fbb8bf),
+     W(0x7db9ba5d7f7fa5a5), W(0x3c1d1daa67a5ded6), W(0xc478e1c1b0e7ce84)},
+    {W(0x801bf7209ca2202e), W(0x6ed8155868c35efe), W(0x19bbe3092972b70b),
+     W(0x044ead8771739a65), W(0xf9924d71b36f803b), W(0x5e75b948dccc8c8a)},
+    0
+  },
+  {
+    {W(0xd2f6c516b6d80f6a), W(0x6a7e89f2f1323e21), W(0xf2f29f2c66844726),
+     W(0x48b0b0cfedce8f94), W(0x89e66fb9b2134eda), W(0xfe6472aab2b29956)},
+    {W(0x8c950332cbb2d3a5), W(0x9a641a74a0ba656a), W(0x12ff93ba190d88dd),
+     W(0x3228c6afa4c1218b), W(0xf1977564067c3660), W(0xfb3c5f502f0dc1b1)},
+    0
+  },
+  {
+    {W(0x7b3d076f6faf9ca9), W(0xa9df21459085a6a2), W(0x8ba99a6424e82f9a),
+     W(0x51385e10c7b3d2d3), W(0xd9d8849e141fd60c), W(0x25b54a1f620210e0)},
+    {W(0xce861edf79be6a20), W(0x3f85342e32033575), W(0xf5ae8591ffc17c02),
+     W(0x9cd1bf9451dd36a9), W(0x9fac365649f481fc), W(0xb9b39ef08b60628e)},
+    0
+  },
+  {
+    {W(0xc7b307544fd3c521), W(0x0b2f623873faa720), W(0x1054949f86c7ea94),
+     W(0x7d862873b2d43f10), W(0xa8e9fc126d76807d), W(0xbfdcc559d4466574)},
+    {W(0x89af779e783280da), W(0xd5174ad23811da06), W(0x9c35dd1e6ce41fe1),
+     W(0x3fa626d2673f93f6), W(0x325cb7b858f1842a), W(0xfd5bd06bf7d05f48)},
+    0
+  },
+  {
+    {W(0x7f443f80daf0df9d), W(0xf2362e95eaa56a16), W(0x511823d3638dca88),
+     W(0xb15b07d8e941b567), W(0x653a9c475dd7bfb8), W(0x82f6bc66354b271a)},
+    {W(0xc8de8e5991c443d8), W(0xf7307f60d9fa41f4), W(0x592ed0a4064df09c),
+     W(0xb8247cec726dff9a), W(0x51109742d9a7cf1d), W(0x16b73499d9ca00e5)},
+    0
+  },
+  {
+    {W(0x35d4f894e94cb4fc), W(0xcd25aaa4e8d07af4), W(0xea2c97f0f8960e91),
+     W(0x8f07946ee6a8f7b2), W(0xfa15c74f11786380), W(0x10373f2749ea27eb)},
+    {W(0x10510c446aea2f3a), W(0x126d9c884ca18416), W(0xcaf2553bb6fb13bb),
+     W(0xd20bc32482a6e99e), W(0x273b8f7646638c63), W(0xc2a043d48ffb0001)},
+    0
+  },
+  {
+    {W(0x45cd98db958f984d), W(0x00c545042d131e71), W(0x1553ff650015a7cf),
+     W(0xfa4442e47c052f8f), W(0x013ae48f7081f021), W(0x088b444520bedbfc)},
+    {W(0xb7f6009033df2f38), W(0xb7c106d098dd7124), W(0xea51d1562b3d13be),
+     W(0xdbcfb93353b5e8ae), W(0x9eb305d233bbc83b), W(0x2a5547c071ecdce9)},
+    0
+  },
+  {
+    {W(0x90f4c9f52d95e172), W(0x72d0456d86153643), W(0xfb790b8c08e5bc4c),
+     W(0xc7902d46c47a4e93), W(0x5a9bd9280f0346da), W(0x653eb6fc8da8b5bb)},
+    {W(0xee51252c3b16c55a), W(0xd9db9bed8e496920), W(0x5ecde863ca5d3e12),
+     W(0x7588b2d781a9ff76), W(0x1d715177f85ff3ed), W(0xdd3b093a69fefa4f)},
+    0
+  }
+};
+
+static const wei_tables_t tables_p384 = {
+  p384_wnd_fixed,
+  p384_wnd_naf,
+  NULL
+};
+
+#undef W
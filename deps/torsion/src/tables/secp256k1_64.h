@@ -0,0 +1,21398 @@
+/* Autogenerated: scripts/gen-tables.c secp256k1 */
+/* machine_wordsize = 64 */
+/* fixed window = 4, naf window = 12 */
+
+#define W UINT64_C
+
+static const wge_t secp256k1_wnd_fixed[1024] = {
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd7362e5a487e2097), W(0x231e295329bc66db), W(0x979f48c033fd129c),
+     W(0x9981e643e9089f48)},
+    {W(0xb15ea6d2d3dbabe2), W(0x8dfc5d5d1f1dc64d), W(0x70b6b59aac19c136),
+     W(0xcf3f851fd4a582d6)},
+    0
+  },
+  {
+    {W(0x4e0640c981048d2c), W(0x71354afc88b285a0), W(0xce0b62e1e0140404),
+     W(0xf918623ccba0ee23)},
+    {W(0x7d12d622ffaccfbf), W(0x84fd25167dc75ce1), W(0x4b3a0f64bda2cc65),
+     W(0x3c7f7712157b9313)},
+    0
+  },
+  {
+    {W(0x2379d4bbd5fea781), W(0x066ceafb22eb7bc4), W(0x5940d07385985972),
+     W(0x9497730fcdf4c0ad)},
+    {W(0xaf18b0b0613f55a9), W(0xac4964cdc5a1f91f), W(0xcc6048bd84885650),
+     W(0x3ec28dcd9215ec76)},
+    0
+  },
+  {
+    {W(0x3daa13e8af6a0bfd), W(0x37571e4d3b9b132f), W(0xde9fbe79f9b379e0),
+     W(0x1957e6951ca769b7)},
+    {W(0x1372e87e5bf5eae9), W(0x746dd1bf9400d136), W(0xc3e5bac23d6a1839),
+     W(0x4c9a2dbb209e02b9)},
+    0
+  },
+  {
+    {W(0x212347fcbea19bc6), W(0x58d7334ddc284cda), W(0x20ce358572dd41dd),
+     W(0x8ed284d3aae7f96f)},
+    {W(0x9e5e784800dfd9e7), W(0x59aaa8d8aad35cc5), W(0x011d0b107f8dbfd2),
+     W(0x1fd437ae583630c0)},
+    0
+  },
+  {
+    {W(0xd409e08fe568f5bc), W(0x534e4de75355fe43), W(0x5d84dcf301b5b366),
+     W(0x5c8088490f91fa73)},
+    {W(0x5dee0bf9c6a6b4ca), W(0x7ba780ad82ae93be), W(0xb9a0411797c737a7),
+     W(0x0175b14f2060a9c3)},
+    0
+  },
+  {
+    {W(0x07ece566caa4cb22), W(0xca934f8716c087c4), W(0x4da362224e1d6bd5),
+     W(0x5f402433d73866e0)},
+    {W(0x4777d1124a77d752), W(0x879d7639f1097263), W(0xf2fd13d87291ab04),
+     W(0xc8043a670ba1a73b)},
+    0
+  },
+  {
+    {W(0xf23162063e0b48a5), W(0x7a060c0bfa606728), W(0x376af358ab408c8b),
+     W(0xc3088630cfa83a8c)},
+    {W(0xceb03c71452c2cfb), W(0x7b292c94ece7dd34), W(0x75193c47f1ea48b2),
+     W(0x85b43f9979490860)},
+    0
+  },
+  {
+    {W(0x46cc6d26eafd5a74), W(0x6edd9e7f1ed7f74c), W(0x8cec72c7f64b253d),
+     W(0x87d71c6bf4d02a72)},
+    {W(0xb2a0d4ae268d25a4), W(0xaec108c659794d80), W(0xf0176bede6793574),
+     W(0x0156339094cef97c)},
+    0
+  },
+  {
+    {W(0x55ca2987f7784248), W(0x8c5126a2be40abcd), W(0x70b8c02edea2464f),
+     W(0xe8cf0172cea73b48)},
+    {W(0x6136fd68e49bc235), W(0x466360215d4daacc), W(0x60333362dddeea91),
+     W(0x0d3a934a99eddb2e)},
+    0
+  },
+  {
+    {W(0x04f0c78f94a7a0aa), W(0x349ebdf993493bb8), W(0xd28558b5bb49a3c1),
+     W(0x9d888be8bce5a953)},
+    {W(0x434322e37beacf4c), W(0x755db980f899acaa), W(0x7cb76bd27b41572a),
+     W(0x0e92c06d7705fac8)},
+    0
+  },
+  {
+    {W(0xb915e5812095e799), W(0x5b0037a9b5f4abae), W(0x5cc8065afd6bde73),
+     W(0x5a1ba91650a32c5e)},
+    {W(0x0c75cf5be50a193d), W(0x2a531f7e16ce529f), W(0xc11a025902c73651),
+     W(0x61aa286044355c42)},
+    0
+  },
+  {
+    {W(0xd59a06c4f5989088), W(0xd35438e646aec93f), W(0x5b370e50a02a9988),
+     W(0x7065f32baff18f7b)},
+    {W(0x14817536a5d44558), W(0x0f73d052948a3b41), W(0xdb37e3a6c013f5af),
+     W(0x595e4c3399b24984)},
+    0
+  },
+  {
+    {W(0x1e9cce5fd119938b), W(0xf82a3045078e2e49), W(0x15e738ff050c28c8),
+     W(0x8482dda73ed47ea2)},
+    {W(0xdfeaa54cac7e1635), W(0x9df244f15309b645), W(0xccaac1084b900c72),
+     W(0x875e4a09819b112e)},
+    0
+  },
+  {
+    {W(0xd51e8da318620cd4), W(0xa9b174243ff3bffd), W(0x8fe0d087f9180a0e),
+     W(0x329cf6f36a78a2b1)},
+    {W(0x364e94e68cf9083a), W(0xd97359fb5ca29845), W(0x1442e0ed9e703fc8),
+     W(0xf384d03b4965bc3e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x41a38518efe247fb), W(0x78d77162cf43dec5), W(0x952ed69488f3f45a),
+     W(0xb7f2007d526d9948)},
+    {W(0xb252bfb837528726), W(0x35538b908855c928), W(0xe6e1d02ce631ad75),
+     W(0xa46b9ec0f2e973c0)},
+    0
+  },
+  {
+    {W(0x7c2cd2b54d6a3d31), W(0xacc8229d708ed243), W(0x93e19cc4fe000a29),
+     W(0x98d1c0e47be6cf23)},
+    {W(0x7d04a29f553f37ee), W(0x7674374a341f8cab), W(0x408bc0f94e530eb0),
+     W(0xbd734a1a4359aeab)},
+    0
+  },
+  {
+    {W(0x44e9157911b93177), W(0x4f830ca098772e8e), W(0xe27a77c09f7a0825),
+     W(0x67f338a8324f752b)},
+    {W(0x8300d9846306576a), W(0xae2754732a87a305), W(0xd265a3edae4252b8),
+     W(0x63d34ea8c4e44cf4)},
+    0
+  },
+  {
+    {W(0xd8c0c00badc5e138), W(0xad6f0e400a1a959c), W(0x317b23fa350f79dc),
+     W(0xa48bbcf71f86167c)},
+    {W(0x8a4e4fb7038d6070), W(0xdba32df911f6a91f), W(0x9117a04bde169768),
+     W(0x8c5413fb65165458)},
+    0
+  },
+  {
+    {W(0xb60595c235d5ce17), W(0xe4a5fe5a9280f7f1), W(0x4b3e3ac460642368),
+     W(0xa1a594a4a994892e)},
+    {W(0xa4b899744fd8366a), W(0xaacb39b44ee22d9a), W(0x3a722da52edfdd0d),
+     W(0x8a77303602abface)},
+    0
+  },
+  {
+    {W(0xa37e927a6e4c9409), W(0xd6319c71881700b0), W(0x84de75918f77ce38),
+     W(0x1a9f59404c9d6ee7)},
+    {W(0x7a765936b90dba8e), W(0x4fba6879ad8cc1ce), W(0xadab7d4fbff4a396),
+     W(0x6cea78b7010744e2)},
+    0
+  },
+  {
+    {W(0xead24668d54ea7af), W(0x781c3762b14b8fc2), W(0xa2b4919e0b751eb1),
+     W(0x5485450751ec1669)},
+    {W(0x23d46eed8f211747), W(0x28a1007c8d715faa), W(0x8d49d1804e6d9864),
+     W(0x96f44616b752226e)},
+    0
+  },
+  {
+    {W(0xeda00fa5ec3affbc), W(0x24baa6dda27cf329), W(0x4de65a27831fe184),
+     W(0x45530b36ceacef82)},
+    {W(0xbee2fc9a32b46bb1), W(0xa15e982da1c18ac5), W(0x8cdaad292cd58757),
+     W(0x7e92c43520968b2f)},
+    0
+  },
+  {
+    {W(0x0877cb65355ae258), W(0xf75e95b5c7a3923c), W(0x9367681882fc7713),
+     W(0x9e7839d2cc2ae7d0)},
+    {W(0x9b15e116eef23dc1), W(0x7a29ba8ef1dd4cb2), W(0x6f03c5f2f0b19cdb),
+     W(0xb49fee6b7d4c2bde)},
+    0
+  },
+  {
+    {W(0x1ca6bbf4fcc8ba77), W(0x297a549f9fd3e8ff), W(0xa3af418d1e5c10dd),
+     W(0xb576c83701f621ec)},
+    {W(0xcba9877bdee66671), W(0x6e540d0f546ef420), W(0x2b507234cbc68c59),
+     W(0xf055a8081117dddb)},
+    0
+  },
+  {
+    {W(0x34bf289e44ef19a8), W(0x4e550582a246c073), W(0x3e72fb70693fe2e2),
+     W(0x9d888ee514524363)},
+    {W(0xe6f72818c4421b5f), W(0x403a54c28b28ba99), W(0x8dd204f0e31704e5),
+     W(0xeb71a7990a1341d5)},
+    0
+  },
+  {
+    {W(0x3e0af784a2748eb1), W(0x65b9dacd5d8f9da0), W(0xd9ae2acd662f0215),
+     W(0xbcff1327c2cf5196)},
+    {W(0x20dff0fc27a5da5e), W(0x13397b48f47d8ce7), W(0xb4a3ab4fac5b864b),
+     W(0x5f86489fe0dbd503)},
+    0
+  },
+  {
+    {W(0x48cee8aece53a54c), W(0xa77e4484b4c77ca5), W(0x1b61e14e683c1612),
+     W(0x640b6ff781009d64)},
+    {W(0xc1453db37a343879), W(0x5b05c31697f7c457), W(0xc435bddcd5be62a3),
+     W(0x32df090cdd706d03)},
+    0
+  },
+  {
+    {W(0x2a084128f4035078), W(0x96a481e9b798aba3), W(0x0702c88181f3fb6b),
+     W(0x50a3ae2e34779284)},
+    {W(0x98569421b780e26a), W(0x849cef67e700e068), W(0x412ab74f9435433f),
+     W(0x66f340ab76df5333)},
+    0
+  },
+  {
+    {W(0x191c60906ab835a9), W(0xb85ef16988e319d2), W(0xa3d4459fe03010ad),
+     W(0x5de8650898c491f9)},
+    {W(0xf92fa57793ae1f28), W(0x033a1c66b13f3ca6), W(0xc97e4c99efd24452),
+     W(0xfe5ed687c76d4ea5)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4cfcb4bd9f1074ec), W(0x1835086b7c2024c9), W(0xc31c9d2f4edff79f),
+     W(0x2579cef38ff606e4)},
+    {W(0xb48c82cecc1b198d), W(0x627c2be007e10df3), W(0xe023b6f049955153),
+     W(0x1b512c3a42dfcd74)},
+    0
+  },
+  {
+    {W(0x0bfe04a84c547dfb), W(0x4aad02f81775f100), W(0x867081c61d838e77),
+     W(0xec18b94b4713f604)},
+    {W(0xe154230eaa749885), W(0x0be67ab5ef0dd49e), W(0x7fe3818474c34d95),
+     W(0x331b6e9b27763e71)},
+    0
+  },
+  {
+    {W(0xe5cdf281731bf60b), W(0xe7736e570acfb943), W(0x961e71aafc924055),
+     W(0x8b925240cdb7af38)},
+    {W(0xde5e8553370ffeb3), W(0xec3404bfa011c79e), W(0xd87083b4d90833f5),
+     W(0xc3d9a1f2ff6b0b65)},
+    0
+  },
+  {
+    {W(0xadb47b9d5bb2a131), W(0x18668fe168ddbbea), W(0x9cb9f68786a0679a),
+     W(0xc00f5a0f4033b7e8)},
+    {W(0xc215ebe6edce153c), W(0x4f227ec0293549dd), W(0xb6190f9094db5f97),
+     W(0xe50530cc3e4dc133)},
+    0
+  },
+  {
+    {W(0xe8486f409825134b), W(0x29c1817fb3565685), W(0x2f5059ff04327ce7),
+     W(0x78240cc1296f9fed)},
+    {W(0x40ed9b4c92b4e0c2), W(0xe4bf2e4cafdd2fc1), W(0x700cdd31694f5d7c),
+     W(0x44dbc200f313bb4a)},
+    0
+  },
+  {
+    {W(0x0fe439c71e2e0e15), W(0x8bc9648752e9093b), W(0x0629be5fee097557),
+     W(0xc272bf6c8b81090b)},
+    {W(0xce4b3357a661a982), W(0x54cd9970a42ebead), W(0x155d69406af0d229),
+     W(0x7f041ba0cdc01d62)},
+    0
+  },
+  {
+    {W(0x8535f0e3a605868f), W(0xe4e8eac15fdbec4d), W(0x6d4045636c51d587),
+     W(0xf84c0d829385abc5)},
+    {W(0xc8ed7566b4db1764), W(0xfe5ee68c50dc9c90), W(0x8a43ae933cf20ad3),
+     W(0x97e50af19f57e898)},
+    0
+  },
+  {
+    {W(0x7de2cebd0f9832c2), W(0x6d395846aaadd62f), W(0xa908234a2b3f4371),
+     W(0xf8c2f19024b2b7b7)},
+    {W(0x52b723950f9a0344), W(0xe11536a3d7adab7e), W(0x22a165029cbf6ea0),
+     W(0x22dc4b14168e68f1)},
+    0
+  },
+  {
+    {W(0x55c46a74d2977b83), W(0x7da3c9d99d84ad92), W(0x87d5ec576802a6bc),
+     W(0x997ca047f6da5450)},
+    {W(0xd642202388465d09), W(0x50a6c9f9c883afee), W(0x81927b1eef961766),
+     W(0x42c814ccdaf862ab)},
+    0
+  },
+  {
+    {W(0x069900d3a6175798), W(0x9d02340b14842a70), W(0xfd9ade613bdbc6d9),
+     W(0xd50e6a99b3617f76)},
+    {W(0xe70f1c756b88a08d), W(0x9e0d19cbe3a50b73), W(0xeb78ee59b8ef976e),
+     W(0x5d703426b9a7e043)},
+    0
+  },
+  {
+    {W(0x0652cbd33366927a), W(0xf39ebdc53801b7e2), W(0x06944ca3eddf2543),
+     W(0xae53ad45a18bf780)},
+    {W(0x6831c64d902d2324), W(0x2cf7f99e1995eb04), W(0x096aabccaa308bd0),
+     W(0x0a945d6f782c6188)},
+    0
+  },
+  {
+    {W(0xdc772f167ab0a263), W(0x46f341f68dd11538), W(0x07660582686bd6fc),
+     W(0xddcbd7c1390fc89f)},
+    {W(0x634a8d7f29ba2017), W(0x198ef17d6745bf3f), W(0x2a4751270347fc10),
+     W(0xdd0ac964a7944c7c)},
+    0
+  },
+  {
+    {W(0x4d1a5a68c4a6d040), W(0xe0ba752d5490b248), W(0xdd2b2e45e80857f9),
+     W(0x4c518a1a61ec3176)},
+    {W(0xded34ca642d2e8ae), W(0x9caa1812e40b2886), W(0x491b8586b196b0fc),
+     W(0xbc053a1255f1d9f9)},
+    0
+  },
+  {
+    {W(0x3616a439d7899f73), W(0x0ef5cba3aa208133), W(0x41308bff332b556a),
+     W(0x10af73a60feb3c55)},
+    {W(0x296c716e74b55b68), W(0x051c0d419da31010), W(0x0fa1656ea1e4fa21),
+     W(0xc3a651278f763afe)},
+    0
+  },
+  {
+    {W(0x0dd071a88bad8a89), W(0x5bb712ce0cdf3bee), W(0xce52ee247c350ccf),
+     W(0x53f9baf1fce9ec01)},
+    {W(0xf87978530ed8f2e9), W(0x3b644d6da58cb68a), W(0x8655babf6ac9c87c),
+     W(0x65be63eb396d37ab)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x116c7687bbc21801), W(0xa001a156834431ed), W(0x919bd70b4a6e9f8a),
+     W(0xa09c0bde99755bf7)},
+    {W(0x4714b6ca7b90f619), W(0xfe233422662644c3), W(0x9658dc8daad44dab),
+     W(0x14307be489bce3f5)},
+    0
+  },
+  {
+    {W(0x80ffeb19b3f0aae1), W(0xc03325d7b4b720bd), W(0x663940c4be7b2361),
+     W(0xc35df455e6f0c5c9)},
+    {W(0x6ca7dfd92d3f13e6), W(0x980cd80bf0a4cc8a), W(0x861e5afbf991aaed),
+     W(0x5172f60db0067652)},
+    0
+  },
+  {
+    {W(0xd2965cc49dd74772), W(0xaadc7538cfc88200), W(0xa20229b9925becda),
+     W(0xdb3983e0b4c6696a)},
+    {W(0x65a740eb134f8de3), W(0xac2363e8469ca3d6), W(0xa5f569990b4f669c),
+     W(0x574e83f1845c5e5e)},
+    0
+  },
+  {
+    {W(0x749f73b06b2ac5d0), W(0x28d321824861c6c0), W(0x6c39f5e0f89a609f),
+     W(0xfd624ceaeda196b0)},
+    {W(0x875485b037a47e15), W(0x324cd765629f2067), W(0x3ab968eb37aae611),
+     W(0x6c2e7ce8d09ae889)},
+    0
+  },
+  {
+    {W(0xfe19c066362fd421), W(0xa6e4f62754d3f89e), W(0x1957d786832b3fce),
+     W(0x1ccacfeb34d49328)},
+    {W(0xbf010c37d54ca3e6), W(0x47f2fe70dd752bd4), W(0xa56a150fbc280c5a),
+     W(0x7f3ff6f939d33a53)},
+    0
+  },
+  {
+    {W(0x8a68b090d49ad892), W(0x0b4a9c4e4c81e66e), W(0xc74a426bc437aaad),
+     W(0x6206eceda6e13178)},
+    {W(0x0dd2eb6459b72466), W(0x0d2baab12022e7a3), W(0x19d578e637442fc5),
+     W(0x3453ab80532d7fcb)},
+    0
+  },
+  {
+    {W(0x45052713a24ab7dc), W(0x53e10dc0c0014470), W(0x395f135e59003e6a),
+     W(0xa1fdd1999fe6bff3)},
+    {W(0x0984ed314a931687), W(0x128e93ad5e573574), W(0x17944ece879e143d),
+     W(0x009b476325df68ce)},
+    0
+  },
+  {
+    {W(0x6b260bbfa6757d7a), W(0x993ff46b1930d6a4), W(0xc8e8a1edb3e5216e),
+     W(0x00d4c6a641ee668c)},
+    {W(0x273938faae8088d8), W(0x68b15374a4b5047f), W(0xfe18ecda874d8d54),
+     W(0x508f9f7804862d3e)},
+    0
+  },
+  {
+    {W(0x4d7ecf13cdc4bd5e), W(0xae2d4acfda05aa1d), W(0x3ef7b90559e0d6e1),
+     W(0x6b7f26d906e5a36a)},
+    {W(0x95172969ff783655), W(0xf1189ac790ce32b9), W(0xe360812974e4745d),
+     W(0xd12fcfc965f07599)},
+    0
+  },
+  {
+    {W(0x13f053a7d088fe56), W(0xd3beee7a096ff404), W(0x40c4ace35e8bc489),
+     W(0x27610744ea156cf6)},
+    {W(0xf510e8ca82ab398c), W(0x5b9dad6342e23c07), W(0x7b4050eb532596a6),
+     W(0x69fb119968c69e14)},
+    0
+  },
+  {
+    {W(0x678532c725dc7b8c), W(0x0ed82bbcef243db8), W(0x368ad63580633278),
+     W(0x644e3ccf79d510b0)},
+    {W(0x84bf9656b6980c88), W(0x10097ab7bb88a5e8), W(0x6ab992fdab043362),
+     W(0x7eac11a68a6a956d)},
+    0
+  },
+  {
+    {W(0xd66c54606f804ea7), W(0xbe3f93eda5af01f0), W(0x6fca63ef2b55e53b),
+     W(0xaa6b856f8b33de78)},
+    {W(0x0fa28a94632b0a94), W(0xb15698c05a2781fc), W(0x4a4c2248f2686609),
+     W(0x291fd2c96a385ee7)},
+    0
+  },
+  {
+    {W(0xa7be42a207bdec5f), W(0xf835c591f3a7e774), W(0x04cc2b13e33a5fd2),
+     W(0xfbd98e7091242b11)},
+    {W(0xc5fbcf181286e52c), W(0xb5e5c16966a3ccd1), W(0x0e3e0cf32874a0de),
+     W(0xf8a42e96789633a1)},
+    0
+  },
+  {
+    {W(0x1d0eba5434e783d2), W(0x019a17593c9c1661), W(0x3c07d9d1ac46845b),
+     W(0x41a317a0ede972bd)},
+    {W(0xb67a42965e191696), W(0xbf647cb6101cb900), W(0x3b4a8d1f6db29b5b),
+     W(0x2542f1ec55cd3572)},
+    0
+  },
+  {
+    {W(0xbdbe965708f9a447), W(0xe5df1a35162c4913), W(0xea96ac603a20d150),
+     W(0xb6f200f25e38e163)},
+    {W(0x72249c89b26be910), W(0xc148e805b74403db), W(0x3acef7643acd5afd),
+     W(0x92a01345b0fb9c92)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x472e3968c233e953), W(0x1c45ee21fc87d728), W(0xb3e4b0ac7afd029c),
+     W(0x48a5c6c230aecdac)},
+    {W(0x43b7f34f5de465f9), W(0x21a5ec7a4bc742b0), W(0x1f22f9382ceb7a9b),
+     W(0xa0ae9d2208a0867e)},
+    0
+  },
+  {
+    {W(0x1d910ba68477c0ea), W(0xa39fa521b63549ad), W(0x097ddc650598761b),
+     W(0x62eb1f6c1fd6a297)},
+    {W(0x8a2ea43e0cf8b987), W(0xc6b0f39b86090af1), W(0x4d8e8d733ff90728),
+     W(0x6295e1cf76e99c7a)},
+    0
+  },
+  {
+    {W(0x8134a9bb81551783), W(0x416d384f588330c0), W(0x94876f60637f2c44),
+     W(0xd0bc50d23e297d5a)},
+    {W(0xb0c308c846755d74), W(0xb9d36414b95404bd), W(0xfe21d7cfdc18beb9),
+     W(0xfee4f74a02e57fc2)},
+    0
+  },
+  {
+    {W(0x4198dc4fadd553da), W(0xb2573c15b709812c), W(0x45eef966d467dd29),
+     W(0xbde3321a23315592)},
+    {W(0x57f5392e557d2333), W(0x9615d43ea05e9a82), W(0xa647d9ca97e16953),
+     W(0xbbd3daf8a9add060)},
+    0
+  },
+  {
+    {W(0x978b53855b298d61), W(0x7cd10a2a10acbfde), W(0xe225eb45328d5f02),
+     W(0x09fa229a17114557)},
+    {W(0x1ee45919c753e8be), W(0x6cf8504518337823), W(0xb63b8bfa6da4b3cd),
+     W(0x0e08994c46dd396b)},
+    0
+  },
+  {
+    {W(0x6d4aeea4056d818d), W(0xda936f4529e743c1), W(0x6ad0fce13a3b0275),
+     W(0x2253dc6329b4e7da)},
+    {W(0xc4d5301622c8e826), W(0x569c4620865f6313), W(0x6e4f8d02c5e341d9),
+     W(0x8170c527f14f776d)},
+    0
+  },
+  {
+    {W(0x7f7dcb2989b86cac), W(0x26856130cf34fe91), W(0x22065842d82cb82c),
+     W(0x71992d80b4adceb6)},
+    {W(0xfece4806f9d88870), W(0x7a0a1c353e7065a8), W(0x513318471f77bc2a),
+     W(0xdb49c8ea5e8ab62f)},
+    0
+  },
+  {
+    {W(0x95cdc2c6faa8508d), W(0x46e632ebddc4127d), W(0xb3f1ca5e1840794d),
+     W(0x0cc561e9c579b1bd)},
+    {W(0xca6f7ed0867f4afa), W(0x70d106284f4631f6), W(0x13a5eeac1b63f977),
+     W(0xa74227aa0ec7c8ff)},
+    0
+  },
+  {
+    {W(0x1f1783c82eb67a1a), W(0x1654f8c81eecd75d), W(0x53c71934e21a0157),
+     W(0xefaabf6bd7dfb719)},
+    {W(0xfaca5796d8c18a37), W(0x80638fb7e104c284), W(0x58fe6abeaf950e1b),
+     W(0x1f7c81c6e4f9cde5)},
+    0
+  },
+  {
+    {W(0xa342fe058ce0bfb5), W(0x2ab3f0b2bf70983b), W(0xadebf0bba39e1b63),
+     W(0x181f848b830c314d)},
+    {W(0x69befa44be52acc2), W(0x663630b4279c5209), W(0x4d629adb55964574),
+     W(0xed2284b7125986d6)},
+    0
+  },
+  {
+    {W(0x536f3593c4365e3f), W(0x230ecb18a24aa8b0), W(0xf3eda832732d6b28),
+     W(0xc4a2f4ac5000a3b5)},
+    {W(0xe4a33d971349ff18), W(0x5bf1614f721e411c), W(0x4c50900cca5a0557),
+     W(0x755ee1e14142afb9)},
+    0
+  },
+  {
+    {W(0x45a7dabb826b934e), W(0xa8e60675121b67c1), W(0xcca72e57106259d9),
+     W(0x095f6686616241ab)},
+    {W(0x82d2799988994f90), W(0xfd24b80d669146fc), W(0x2aea5542bc792ff6),
+     W(0xd436ea2ee2332d15)},
+    0
+  },
+  {
+    {W(0xe212c702666575d9), W(0x63b9c02fa61d79e5), W(0xb5b7b5137b568f9c),
+     W(0x33ddced3e4e3c92b)},
+    {W(0x69827e76dc608186), W(0x41c04a50dfcd0d03), W(0x878c0cdcb054605e),
+     W(0x20ac8958a0551aac)},
+    0
+  },
+  {
+    {W(0xcc0cbeb2ee742774), W(0xb1d0068625b12e2b), W(0x3f21afda70620919),
+     W(0x3b63172b7a1f5fdb)},
+    {W(0x1d0e802b05230bbd), W(0xc963d68b56e0af8b), W(0x911ae793a4550a4f),
+     W(0xee3817f502c2ac0c)},
+    0
+  },
+  {
+    {W(0xdd8ccd6963b01c33), W(0xd5d0241f56f9f077), W(0xdb1f6b5ad59daffa),
+     W(0x847fdd74a24893e8)},
+    {W(0x1703e8d378ebb3ca), W(0x0cc8e4f142365233), W(0xa9e74aab6845a28b),
+     W(0xb36433edbec4023e)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd53d5d0472ed7345), W(0xbcff12d439515ff5), W(0x7a4d9d08b3b5828c),
+     W(0xf899a71b1bac7deb)},
+    {W(0x6137eef2ba436c62), W(0x0d85465e5e7f89ab), W(0x1ed24e35f6d34352),
+     W(0x6737dbe3c1601124)},
+    0
+  },
+  {
+    {W(0xd063ff04eb09f91b), W(0x1fdccac2a7c4e3d6), W(0x70c880eaa01dd4b0),
+     W(0x8d6116f0fede8ed9)},
+    {W(0x4f9b552ca0ac9df8), W(0x4c40f2a9a609996d), W(0x34e1c988a732a8bf),
+     W(0xe3bf0f02c1dad6a6)},
+    0
+  },
+  {
+    {W(0x723b7c7964727d73), W(0x273acebab21a366a), W(0x52bb492250cd2cfb),
+     W(0xa24b55fa0b64b761)},
+    {W(0x4aed6807266f7bb5), W(0x7e232c20cf67241b), W(0x21fe3578b3b76cc0),
+     W(0x3df4119582ec9a9d)},
+    0
+  },
+  {
+    {W(0xd0c2419f6d86153c), W(0x231930a8b707ee22), W(0x4bd3094f73b0e729),
+     W(0x6598e204dd2d59c1)},
+    {W(0x3fc65a239d72d2d3), W(0xd5d9825428f01f75), W(0x57c84a68fe361ea7),
+     W(0xbfae09c8c8340d90)},
+    0
+  },
+  {
+    {W(0x06908e0dd7025992), W(0x5a83405c2c613728), W(0x30f4abf4c704b367),
+     W(0x6070e00379c4a4f5)},
+    {W(0x126ce1f0f02ba458), W(0x4cd496dd5cb90f5f), W(0xfb4884dc6ee31cc4),
+     W(0x2df0bffb185e0f36)},
+    0
+  },
+  {
+    {W(0x8484bd224d510690), W(0x7e9df071ed07d3e9), W(0xee65b114e46df4e5),
+     W(0xd0a82236612542cb)},
+    {W(0xe0c848c21c024c5e), W(0xf781cd2fdf509289), W(0x6da514062f137399),
+     W(0xa62e8b007042ee56)},
+    0
+  },
+  {
+    {W(0x84f73c281235ff02), W(0x82ad64d428e0d879), W(0x0695cf5441feb6fc),
+     W(0x0d1b80f501b30f63)},
+    {W(0x14823ec46200c5fa), W(0x55f3a7c79489b1db), W(0x26dc42caf32a660e),
+     W(0x9a8f9a716b59093a)},
+    0
+  },
+  {
+    {W(0x078f84b0ff02af5f), W(0x1cc32b8e0f98986b), W(0x37122fcda4748fbd),
+     W(0x5284c6248b822a9a)},
+    {W(0x4477515f51bb2de8), W(0x768b4d3857450169), W(0x9f1b455c8ea94210),
+     W(0xe1e3dfab25acf4eb)},
+    0
+  },
+  {
+    {W(0x2a5e192aa7358cd9), W(0xe65c68fd3920b3fb), W(0xca019f567d733d8c),
+     W(0xea4e59541b1f3740)},
+    {W(0xcc4019c23d2b3e78), W(0x5c01628738246b34), W(0x5a2e1c763701a79c),
+     W(0x578d7c7744e2e24e)},
+    0
+  },
+  {
+    {W(0xde3e3f25a0e48c92), W(0xca9d2fbe9a9fb7a4), W(0x90adca97e27e7e74),
+     W(0xfaf15167150140af)},
+    {W(0xcdfe168e368a1127), W(0x9388282d750a1d24), W(0x1c4699c25eabec7f),
+     W(0x25b2ba8ee2c684ea)},
+    0
+  },
+  {
+    {W(0x8399142c5978e10c), W(0xcd7ae5e6031f1df4), W(0xbea538dbab4575be),
+     W(0x327a46cae11bfd96)},
+    {W(0xa85f0725366bf920), W(0x42cb6de93832fdc4), W(0x54fda13ea50f7b4a),
+     W(0x7dad8bf55b443c4d)},
+    0
+  },
+  {
+    {W(0x621e43608666b5a2), W(0xd27395930a5661a1), W(0x31c1edba743c82a5),
+     W(0x0fdde662270b8b80)},
+    {W(0x1b206e3b6a464324), W(0xd1000e09b1faf7bb), W(0x614b449f1a253721),
+     W(0x81c3c9fe3f5944a8)},
+    0
+  },
+  {
+    {W(0x9a509da001571197), W(0x8566b4916cdab45b), W(0x761cd707da6682d0),
+     W(0x02be866cad99dff7)},
+    {W(0xefb393ac87328d26), W(0x253c3f161bae26cb), W(0xc2619e0a0cac62e9),
+     W(0xc6f788c595be5a85)},
+    0
+  },
+  {
+    {W(0x7314e0625af87971), W(0xea6b992d003f5706), W(0xb8fd1401eb1336bc),
+     W(0xdd02dd8301344a4d)},
+    {W(0xc4f774534777a0a0), W(0xb4a9da241fa473dd), W(0x0736f80dee9e619f),
+     W(0x2a68896e09e1ae0e)},
+    0
+  },
+  {
+    {W(0xaef4ddeb1ce167b3), W(0x43bb8c25c91926c1), W(0xcaff0648785102c6),
+     W(0xeae000f94ec7d940)},
+    {W(0xd805c63cee85e592), W(0x20752d503cd2ebf6), W(0x5323bf052c0d121f),
+     W(0xac71d5e4ac16f19d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf1f30e53ae61cf74), W(0x1108822731948505), W(0x172e66b4dffb9e31),
+     W(0xdf9ff060a70bfc59)},
+    {W(0x4e514b1e987f9994), W(0xae3d6b90b7bcb26d), W(0xffbd8d2b1faa21c5),
+     W(0x46508fb2b42b5e11)},
+    0
+  },
+  {
+    {W(0xdac9fedfc8fdb1ca), W(0x4e2372d71c023806), W(0xb6209e17ed781195),
+     W(0xdd19cbb4be645868)},
+    {W(0xd00d02b22367ec3e), W(0x1f15380220f5184e), W(0xd08bdaa15fe86666),
+     W(0xa0aa7d33db261a6c)},
+    0
+  },
+  {
+    {W(0xafb219d24955d9f7), W(0xc8cd02e1f8b61ab0), W(0x0653b5e2656b7953),
+     W(0x663fc69153963a49)},
+    {W(0x4cdd8ec89698c7f7), W(0xf8bf910554d0e85d), W(0x09358777b91448ed),
+     W(0x12d14331d1b78395)},
+    0
+  },
+  {
+    {W(0x807c4992441083ca), W(0x2c48e9c9271f3aa8), W(0x6c14a14278e145c6),
+     W(0x91360a8ac855f8ec)},
+    {W(0x5aca2af76bc35034), W(0x3e4db0f1fe99621f), W(0x103d39c73b8a239a),
+     W(0x81c6b8dadc0b1203)},
+    0
+  },
+  {
+    {W(0xcf94d8d4b16672e6), W(0xf5a613b6fee90949), W(0x00174a1e081078e0),
+     W(0x47d2d003ae9b8e33)},
+    {W(0x136df2a0056210c6), W(0x0ff481c0d39bf6d1), W(0x282a83010dbbd8cc),
+     W(0x52a2d3558533b8d6)},
+    0
+  },
+  {
+    {W(0xe6e6cc85515be081), W(0x815d6368837404be), W(0x7c65f6afaf5874e7),
+     W(0x5ebadcd57b41e998)},
+    {W(0x281acd43ee87df45), W(0xbc2e5f49a7104d2a), W(0xccecd64135af9348),
+     W(0xeda934800d76730a)},
+    0
+  },
+  {
+    {W(0x8d2db8dd3cf5c5d7), W(0xb69668614a1868ea), W(0xcedc1996643a45f9),
+     W(0xdbf0258715d60e5e)},
+    {W(0x1935ec86f0fdbd28), W(0x56e2e4d29d928044), W(0x65f6b107837f5585),
+     W(0xf2315214f6c91fd5)},
+    0
+  },
+  {
+    {W(0xac9e378ee1d4cd32), W(0x422d0c1be5c66fad), W(0x58ddd8297a2176cc),
+     W(0xd9ced3f21f2c9af3)},
+    {W(0x6a271698017fac80), W(0xe2b707f1c785fadf), W(0x604ac7f2998a199c),
+     W(0xd292efdae73a0fdc)},
+    0
+  },
+  {
+    {W(0xd1c0a4a63a62aca8), W(0x2e900d788b82406f), W(0xae44ba3794871d86),
+     W(0xdf685d5ba46d7e58)},
+    {W(0xba44709151b937a8), W(0xd20840b4a674f42a), W(0x8a57d5f28f90098a),
+     W(0x2ed7540bd0eab4eb)},
+    0
+  },
+  {
+    {W(0x95c8569d89fadab2), W(0xd6ed9b2a87ca9424), W(0xe157748bef5a96e7),
+     W(0x40f517b2dbb9cabe)},
+    {W(0x99629d5fdde00f3d), W(0x60023760c930ef7a), W(0x6f5ff3a3da31ea0b),
+     W(0x725610f70837b73d)},
+    0
+  },
+  {
+    {W(0x56407a7338c5aa3b), W(0x04c3d709aab932d9), W(0x6ba4af2900f305d6),
+     W(0x9600aba7072596ab)},
+    {W(0x7bc3838f6bbfa8c3), W(0xae5d573b91a5fcc7), W(0x8940ba77864dd811),
+     W(0x402dd4619de8895f)},
+    0
+  },
+  {
+    {W(0x4ec6a654cc1cf3c3), W(0x41a611d24b4f06dd), W(0xdebca5f03275e5fc),
+     W(0x9f3de2f5e14f6f16)},
+    {W(0x35e53dbf345edbd1), W(0x7c2a2738734d6ecb), W(0xe1f08c8f9b0019c1),
+     W(0x012ef5b5f716b2ee)},
+    0
+  },
+  {
+    {W(0x4c6e5adb1e0940cb), W(0xd8be0214d99a1f74), W(0x63ef8e847832085a),
+     W(0x71257be3cd3d63e3)},
+    {W(0xc71d38d77ab9f33c), W(0x0534b5d7a995221e), W(0x93f4d26ca8fe9119),
+     W(0xfd356d15a8f9c1a9)},
+    0
+  },
+  {
+    {W(0x494c57629cf8cdbc), W(0xa0eb9ec374d93202), W(0x05bea396f4cff749),
+     W(0x89c365635d3a77cd)},
+    {W(0x7092d54676103c80), W(0x08fdaa391c663a5b), W(0xf24bc0b1f05c68c6),
+     W(0xc1ab707bae1d4d8f)},
+    0
+  },
+  {
+    {W(0x1554514dc4e7e2c0), W(0xf89b4e0839e11770), W(0x27ae3f2e81cc125b),
+     W(0x7bd047a3170ae2f3)},
+    {W(0x74ee9c7fae0cddee), W(0x773a620a086dc997), W(0x67456b09f0c1861b),
+     W(0xf3be1a7e4e6d1426)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf4f0250d77b6e2ed), W(0xa1dcd50a06ad9e0a), W(0x5ae11d44a2d18bfa),
+     W(0xbd22cee0955924a7)},
+    {W(0x7336db5e3d232d71), W(0xca473ec3798d3edc), W(0x38aa2a3125fdaf3f),
+     W(0xd1e1ad45e9f40c01)},
+    0
+  },
+  {
+    {W(0xae863d1a3eb2dbca), W(0x119280b9c05e6183), W(0xb3636741b29a523f),
+     W(0xcba31d0483ee9338)},
+    {W(0xa782e9dabfc6a5d2), W(0xd3266e189203414c), W(0xb69c6b48740fdc53),
+     W(0xbec0d59743bc15ed)},
+    0
+  },
+  {
+    {W(0x0e9b3d080e61e1cc), W(0xe3adfcfd3ffb2a93), W(0x555be66fb800d5a0),
+     W(0xc910b56dde7ffe34)},
+    {W(0xc1f653583e7d150e), W(0x958defcb3364f59d), W(0x14d6aee093d82602),
+     W(0x64e6859087abe6a9)},
+    0
+  },
+  {
+    {W(0xb097726a22376827), W(0xe6b946d4af1ba09a), W(0xc023d28604cc2dad),
+     W(0x4991ddae7912926a)},
+    {W(0x564db45ec7f90d00), W(0xf810acca720ddc70), W(0xff8ef73cb4f4f9e3),
+     W(0x4e72ab52a6474b56)},
+    0
+  },
+  {
+    {W(0xb441a838cb76d5ee), W(0x08b557fa448db7e9), W(0x95d983ead7644ed9),
+     W(0x6e22a4a079bd26ae)},
+    {W(0xe8e925afcb50cc6f), W(0xf127bd3b8ad75730), W(0x837e036bf06da637),
+     W(0x4bb795a7f414f78f)},
+    0
+  },
+  {
+    {W(0xfad5aa9ad43b07a9), W(0x84fc5084f7c2d583), W(0x1018af0120f4c9e8),
+     W(0xf628df2a3ff473ac)},
+    {W(0x7a4c4c246d5cee38), W(0xa568ff06751e2f4d), W(0x3cbee46e4a906a53),
+     W(0xf40507eefc9f0fb3)},
+    0
+  },
+  {
+    {W(0x40c42c0bf4ee70c8), W(0x531c6c04d3bf850c), W(0xdafa10595fbdd774),
+     W(0x6c89465c12b24339)},
+    {W(0xa98c6b4259d4b3d5), W(0x91e58b84379c9f4e), W(0x2140a3549fc6e446),
+     W(0x6d557c9c66dfbdee)},
+    0
+  },
+  {
+    {W(0xb4028f921e7b0132), W(0x15c3ebada129b871), W(0x00e771b626da4ac2),
+     W(0xc4ba5efd9a10d361)},
+    {W(0x93982e79e44b597c), W(0x2cd7fec6334b9d0e), W(0xa9030fc62e29b81b),
+     W(0xa51325161d621df1)},
+    0
+  },
+  {
+    {W(0x2f6143d74857bc23), W(0x2abde260f85db276), W(0x7fb2b52dd66a4ebe),
+     W(0xc8d2b0230777e4bd)},
+    {W(0xdaf82eab085bf4ef), W(0xca44f3aee20e88c0), W(0x86c2179521e10f35),
+     W(0xde4595ad93b3d6e9)},
+    0
+  },
+  {
+    {W(0x661052cad1a00d3e), W(0x87909aaebd3c1d85), W(0xc102cb31ae5f74f1),
+     W(0x64a0760010c56533)},
+    {W(0xd28db59d9dd4aa57), W(0x92cfabc3f4437a7a), W(0xb60cd7e7bf7e3509),
+     W(0x8f3575479b2d201b)},
+    0
+  },
+  {
+    {W(0xa138f51e1573de27), W(0xb0587b9f798a17ff), W(0x52904df34a235422),
+     W(0xa7b4aba8739d2f59)},
+    {W(0x86e69ac84b2c145b), W(0x92a3bfeae1deab99), W(0xaa8e3efa041ef0a2),
+     W(0xddb0d630c37e2f3d)},
+    0
+  },
+  {
+    {W(0x1ac9edb0722e27ca), W(0x9b55c43e2a77e573), W(0xe68ad58b33cf218a),
+     W(0xb7810094ff2682c9)},
+    {W(0x64e8cf9c108dba84), W(0x7904cce9554f1c61), W(0x433ba21cd5494562),
+     W(0x0368f033e605f805)},
+    0
+  },
+  {
+    {W(0x81e89fd668ca671e), W(0x13967993230cccf6), W(0x9f5da8cd09ab9f6f),
+     W(0x0a54b236c579dd11)},
+    {W(0xfb9f06352c735611), W(0x9446a3cb147eb2ad), W(0x3dd6598c6086eb02),
+     W(0xfa2c647de8909e3e)},
+    0
+  },
+  {
+    {W(0xf5b6395d543658c1), W(0x93d708266384e5e2), W(0x4fcb96030ae795eb),
+     W(0x9b357d91917bedcf)},
+    {W(0x687c881bcabfe05d), W(0xfba48ea53d806bd6), W(0x80fe04a92502c1d9),
+     W(0xfe506e75dc49d988)},
+    0
+  },
+  {
+    {W(0x271635d9c37a49ef), W(0xc4d01fab6c6ad4e1), W(0x3f72c832641f5ea0),
+     W(0xe1b7de3443fbf052)},
+    {W(0x50a77b0fb4f626b7), W(0xa2e0b7e48f220318), W(0x0df86ef9b87b4f2c),
+     W(0xb694c402dc89ca4f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9f30222b47476977), W(0xaf4095525fe1d2dd), W(0x9ef9133702cd5d56),
+     W(0xb3b436f386109b4e)},
+    {W(0x0b4f8ebaac8dc00c), W(0x349b5f127619927f), W(0x98f120c4a670b81d),
+     W(0x2f2479a7c394b509)},
+    0
+  },
+  {
+    {W(0xf9065b1817fb2c3f), W(0xbaa506d8bb30cff5), W(0x4cc3fc6e16e0251d),
+     W(0x3f1d3f188bff86c2)},
+    {W(0xd33d0391b78b064b), W(0xc63f14011a233126), W(0x0aa7081db3b87f92),
+     W(0x62f17da77f000171)},
+    0
+  },
+  {
+    {W(0xc7155e11fc3ee5c2), W(0x36e8efe11ae69f50), W(0x498e34dbf80108da),
+     W(0xdb5dcc909d6ace8d)},
+    {W(0x177d4c2716e08e66), W(0x867cbd65a22d77dc), W(0x42383b71d75a980c),
+     W(0x3651d4a0fd9485cf)},
+    0
+  },
+  {
+    {W(0xc7829ea4baf20e49), W(0x53842d74695921e6), W(0xaa34cc99e731d4c3),
+     W(0x6b3672681533aaa6)},
+    {W(0xc620d219da5709a1), W(0xa8dcb67db62f9483), W(0x651aed2de269adbe),
+     W(0x5df6563844506fc9)},
+    0
+  },
+  {
+    {W(0x1d2efd2e8575f04b), W(0xe0d550b82c63fb78), W(0x8792b2790492c198),
+     W(0x7dea745b805e85cc)},
+    {W(0x34a03e6d0c5a24f5), W(0x5131b06cbcf27dc5), W(0x74b716f934562966),
+     W(0x0ff2cc3cbd33346b)},
+    0
+  },
+  {
+    {W(0xe85f02743fe87d71), W(0x1a9310410f31c2b7), W(0x5cbef65b047a83b3),
+     W(0xe0eed60786dda041)},
+    {W(0xe1154e9dabd857e5), W(0xb02f7430eeb28618), W(0xce95e9043de0541c),
+     W(0x5f4393a66c622d33)},
+    0
+  },
+  {
+    {W(0x7ae64bdd58931210), W(0x11c83d9116bb3c63), W(0x9a59df143feff2a8),
+     W(0xedb4899e63846539)},
+    {W(0x568f71ca6bdebcb5), W(0x301608c3e16a0a89), W(0x74412ac455c86cb8),
+     W(0x99dec8fa9584483c)},
+    0
+  },
+  {
+    {W(0x257cbb5a8a920b0c), W(0x4f80e557b4613386), W(0x51f71ff256f595a0),
+     W(0x7e17e81a4530aacd)},
+    {W(0x4750d6def98a3685), W(0xabd27708d3065a36), W(0x791e48de6b1e9af8),
+     W(0x76af6ee9bca94409)},
+    0
+  },
+  {
+    {W(0x2adf83b80f85d558), W(0x94bfadc9b1b87f4a), W(0xce69c8c8b5468146),
+     W(0x420b6d16a4378315)},
+    {W(0x5df3280f23ae71d5), W(0x5ade360316b8fffd), W(0xe5d43bb3c39a69a4),
+     W(0x15cefeeb0a50b93c)},
+    0
+  },
+  {
+    {W(0x3481672e9410832b), W(0xdbc93bd4e7ac5e9f), W(0xa9d38d66eb641e10),
+     W(0x5895ae7f6d12dd12)},
+    {W(0x67cebc5afa61354b), W(0xc4038c8fb3a22a95), W(0x895d514005588808),
+     W(0xcc4ca42e91603c7d)},
+    0
+  },
+  {
+    {W(0xbde02e4fe009df84), W(0x6abaa813cab86d45), W(0xff52fbfa978e9485),
+     W(0xd9173cc82faf7541)},
+    {W(0x430384a1413e5e3b), W(0xad73a6c6920c215a), W(0x0f8f3cea3b0e9832),
+     W(0xbd2a6f41a8c1250b)},
+    0
+  },
+  {
+    {W(0x24a6806a55914584), W(0x9847a488ebc8109c), W(0x282d3023eaea7d52),
+     W(0xb4bbfb6e24b12417)},
+    {W(0x4bad400c88438663), W(0x2b113f3b959ef3ba), W(0xf6a97bc5f8116c4a),
+     W(0x7df89f36915ad88b)},
+    0
+  },
+  {
+    {W(0x3c771963f9bc94a6), W(0xac3da318201f2537), W(0xfdde3151fcf67cd1),
+     W(0x4a6644c1577d9e03)},
+    {W(0xb9b4119bd4b5f340), W(0xc13b745b11de5394), W(0x53a2121079d42c74),
+     W(0x8a8df15505a5171f)},
+    0
+  },
+  {
+    {W(0xa8d29c3a0c5b07af), W(0xa33e7e7e9055bebb), W(0x91d891a3f03086c8),
+     W(0xfc52039781889c0b)},
+    {W(0x04d46912d2d351fe), W(0x34c1d2bd772628e4), W(0x9d315340493ba21e),
+     W(0xada4dd606f64ec8f)},
+    0
+  },
+  {
+    {W(0x0516b67896aa0f16), W(0x34b4d1a0554c1816), W(0x7850578c869054c7),
+     W(0xdb91452fc5c18d2a)},
+    {W(0xe631905933bb4be6), W(0xdc6d375636f6db67), W(0x4a66906fd4b3bd57),
+     W(0x4fe0b161ba240858)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc3f3edf57c24708a), W(0xa2bdd58a729aed26), W(0xf6a154cc23a0a78a),
+     W(0x1fa558161ac906f6)},
+    {W(0x43a53c18f8862578), W(0x609b54e610b5662f), W(0x799f90a5a917fb59),
+     W(0x6324a09c39ec4c70)},
+    0
+  },
+  {
+    {W(0xc27978605119187e), W(0x90d6557dfaf02439), W(0xcfd8ae5fe0adbbe8),
+     W(0x437a7bd0b087b69c)},
+    {W(0x02c7ad93784da25a), W(0x608be925a7ee1047), W(0xc1b14459e07b67ae),
+     W(0x5ff419a334d84e59)},
+    0
+  },
+  {
+    {W(0xdaecb8e704543248), W(0x26480e25ed25202e), W(0xfa2edfa8d76790ad),
+     W(0xbf541c55b6d0d99b)},
+    {W(0x66f006521b13a756), W(0xb223a80ee52f23d2), W(0xae65cadebd112873),
+     W(0xd5493e1122a5f935)},
+    0
+  },
+  {
+    {W(0xd65476fd3861e021), W(0x52f846d64c46858a), W(0xc05647c3d28aaff0),
+     W(0x7619286cd8c4e5a5)},
+    {W(0x5a07a707bde4c525), W(0xada62460ae488084), W(0xc8a026c48b282577),
+     W(0x6f22abba66be4dc0)},
+    0
+  },
+  {
+    {W(0xb7802c7ad055c424), W(0x16d2f41d8f65ad90), W(0x67950df3c768af4d),
+     W(0x77830c6fe0ad0bcd)},
+    {W(0x2336e106bf8d2412), W(0xb98e8dfc85ca88ac), W(0x0e7e9545e95e2f7c),
+     W(0xb5e79cf57b53597f)},
+    0
+  },
+  {
+    {W(0xea5525c767da8c11), W(0x22b0b25454055c34), W(0x615376d8709cb9f2),
+     W(0x1249adf4f5dde98b)},
+    {W(0xdc249fa134ee5d1c), W(0xb28e9180e1fe0af2), W(0xa7c011009f7a7eb0),
+     W(0x021b8666585e14bb)},
+    0
+  },
+  {
+    {W(0x7c035129bc6e166f), W(0x15ed999ddb0b7458), W(0xa6cf86ebbd5bbeb3),
+     W(0xad43e5029ff12f47)},
+    {W(0x4327f71455132772), W(0x3a2092de532bffb0), W(0xe504269c17e79a40),
+     W(0xa7fa7a66fe6212c8)},
+    0
+  },
+  {
+    {W(0x5410fd7d904f8ff3), W(0xf41e2341c2ea9b82), W(0x3cf9d9868a8e0a61),
+     W(0x88cee032905523d5)},
+    {W(0x99e18cbf90500e56), W(0xc8f503a954b36dc8), W(0x3e47846c9acbd7c3),
+     W(0x3d12d02d59044ba5)},
+    0
+  },
+  {
+    {W(0xd61eb9d1015056bb), W(0x29101d3cf8acd638), W(0x058a3cbaa07c09c0),
+     W(0x22de329c916c41a2)},
+    {W(0xce6bf1195862d74e), W(0x22bc1ca824eae9b0), W(0x36879b92f72e5022),
+     W(0x568c3af2b536ed27)},
+    0
+  },
+  {
+    {W(0xc167be85536aeaed), W(0x25d2afd6eef97e50), W(0x283bcd9f285ca29c),
+     W(0x0596a697bfe761bd)},
+    {W(0x1c0494421ec9182b), W(0xb80baa624d0dabc6), W(0x5f9d00ace4d6088b),
+     W(0x00bf17f4a4e5af1e)},
+    0
+  },
+  {
+    {W(0x6afb2a53d8a0dc6d), W(0x1437013d11662463), W(0xc6085e3e2aab43b2),
+     W(0xc3ff31e9d6e62578)},
+    {W(0xd042bcb566265960), W(0x1c2ca8ce2b150ead), W(0xf2acb89a6be6cdf6),
+     W(0x1575836656f43da8)},
+    0
+  },
+  {
+    {W(0x6d5afe2c3e05354f), W(0x5bf4c9b6832fa658), W(0x7d727b20845ac8f3),
+     W(0x19e7b62e19495772)},
+    {W(0xa4b68a51240a3c8b), W(0x92a8d7a12eeeb1b0), W(0xbf29d7cd80c40190),
+     W(0xea17c9c6b9bac35d)},
+    0
+  },
+  {
+    {W(0xd8dbe4d474f01d08), W(0xf07093261b137185), W(0x1e3f3d78817848dc),
+     W(0x641187be35563dd4)},
+    {W(0x22ef5851234c98ff), W(0xb194c00d61f60864), W(0x6b33175304014749),
+     W(0x68d483162bff96c5)},
+    0
+  },
+  {
+    {W(0x5d275a58b0b3ba23), W(0x753b56a9f999dacf), W(0x57ccb6d05610258d),
+     W(0xd6d84a916f7c35c3)},
+    {W(0x5b1483f138a8fa09), W(0x383e18db53ddeb68), W(0x86fd396dff16f025),
+     W(0x4cb9cfc08cd9a8bf)},
+    0
+  },
+  {
+    {W(0x41d015aa1c25a996), W(0x21a2188f316eb548), W(0x995b61fc7103a1fc),
+     W(0x861df51c1e0bd855)},
+    {W(0x40238ef01c956a76), W(0xd5c7d20f26d626b7), W(0x318eb19dc6933d63),
+     W(0x86b5fcf73320cafd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb4cbe1f9a31d9e68), W(0x753e44ad81a39a40), W(0x24942a08955bbf75),
+     W(0x237e206f5f040b8b)},
+    {W(0x463c8a168a3e0d60), W(0x51296c3fb66b0f39), W(0x1436c2e876ca47b8),
+     W(0x67b2db2a4267c78e)},
+    0
+  },
+  {
+    {W(0xd768a66cea5908bf), W(0x7cb5e512eb0d786a), W(0x32f9b0b1ebcd49f6),
+     W(0xf806f94a4503f651)},
+    {W(0x054b98043cdbdb9d), W(0xb57ec65d9f86dc68), W(0xdfc7db252b5d1585),
+     W(0xd5db3f73bd703bc2)},
+    0
+  },
+  {
+    {W(0x82dc87c968b5d6e5), W(0x767ad90fc0d5b00e), W(0xa22fc4a2f430d85f),
+     W(0xf767ae2a44eddded)},
+    {W(0x6534930e6aa4ae2c), W(0x0fd06a4f83835e85), W(0xd45fa9d45fc5dcbd),
+     W(0x180b43dc52e5003d)},
+    0
+  },
+  {
+    {W(0x7ab495bc4129572c), W(0x4289b0a50d5137d9), W(0x53ccf567db487d1a),
+     W(0x09f113c2e1db2c41)},
+    {W(0xb690faa57ed1e6db), W(0x5a1d2e66fa691934), W(0x137b2a603dbac5ba),
+     W(0x6db7f694c0f893f4)},
+    0
+  },
+  {
+    {W(0x8aaa5564147e2901), W(0xf35d4745ac0ba42f), W(0x5369599784d90619),
+     W(0xd47482a0390da26a)},
+    {W(0xce0c2719a551b4fe), W(0xe7a7ed5003889a62), W(0x28e6b681e6f268d3),
+     W(0x75843cc225af46d8)},
+    0
+  },
+  {
+    {W(0x03835c3aa7bd271b), W(0x25e569eafe290d5f), W(0x1174b814836289ab),
+     W(0xecc76c1c932bd1cf)},
+    {W(0xd491daef26ecccb2), W(0x87b565cdfbfcbdb9), W(0x491913215146a17a),
+     W(0xa7e1c1f260b28130)},
+    0
+  },
+  {
+    {W(0xc415db9e2cf3f659), W(0xb199014d8992a840), W(0xc0000d26f4b0b18a),
+     W(0xc964b8c966e954d3)},
+    {W(0x2794cb2cec7da8f2), W(0xcb22251cdc3377dc), W(0xf82a51c46ff18f63),
+     W(0x57b660ec9020be85)},
+    0
+  },
+  {
+    {W(0x5c205af8814121a8), W(0x9d4309f36eca3cf1), W(0x4c8277be19c46f7f),
+     W(0x9e8f6db65f603436)},
+    {W(0x852871efd2402997), W(0x322f8a8b8eaf049d), W(0x83eb828b2aee808e),
+     W(0x879cff57869396af)},
+    0
+  },
+  {
+    {W(0xd7731817a4bbe4b7), W(0x84ee0e6a5f40b3ed), W(0xb70fba5f8fcadfa7),
+     W(0x054709dce7152792)},
+    {W(0x3bb24b69a1228915), W(0xcc7a1eb4fdcdfba4), W(0x50e63e748f210079),
+     W(0xb812e59dc1e2fb3e)},
+    0
+  },
+  {
+    {W(0x011b1f56bb154035), W(0x74de5e4103b5bbfc), W(0xd4da3637878a0926),
+     W(0x94528dfd056078f5)},
+    {W(0xed23bdbc66356137), W(0x2a7b95ac85ec2bd3), W(0x76679342a3d0ab0f),
+     W(0x581a8acdeb4d8f3d)},
+    0
+  },
+  {
+    {W(0x8669273829f88b93), W(0x0f7359bba7c0ae0c), W(0x39f73caa9184e302),
+     W(0x2278855450e49e86)},
+    {W(0xdbd59cdec874d7e0), W(0xaf483075d420fdde), W(0x8950699d97c0ba77),
+     W(0x3590eb117e19757f)},
+    0
+  },
+  {
+    {W(0x6caac6a8aeda1784), W(0xb99124269fcf9a7f), W(0x33d3e59eecc76665),
+     W(0x64fc79328002731f)},
+    {W(0x07df21dee8f1804c), W(0x4a226dc179446a7e), W(0x13b4056581395930),
+     W(0xfc942decca8f9f00)},
+    0
+  },
+  {
+    {W(0x54d9e0ea3b6724e1), W(0xbc36bf06f13c9b20), W(0xf1e6d4702605d1e7),
+     W(0x9844b73d7ddfa99a)},
+    {W(0xb8b997e452ed79d6), W(0xf89a4a377a85f0e9), W(0x473ea7bb15c0a1a6),
+     W(0xd0dc04649a03c92a)},
+    0
+  },
+  {
+    {W(0x675c73252c9c304f), W(0xf257c980713598c8), W(0x875246803ff1a60f),
+     W(0x803b5de34c02b1e3)},
+    {W(0x4da1a83581508d46), W(0xa080a607521810df), W(0xeb8332f612fd66df),
+     W(0xef351498540e8642)},
+    0
+  },
+  {
+    {W(0x2872a5b4c57210cd), W(0xb9f47934c752f0a4), W(0x15706795c8c6da09),
+     W(0x6164580b4c286c02)},
+    {W(0x3a4b59e02c860b9f), W(0x19f4d685199571dc), W(0x29aa5c58becf297b),
+     W(0x7a046a57b7768952)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfbb078b09cf3a610), W(0x6885d7d5b186da90), W(0x95ed09e995203846),
+     W(0x16a106b326026494)},
+    {W(0x5197f54b47bbfbe4), W(0x41056d98b63c5137), W(0xa2490613ccfa9b0c),
+     W(0x660bd8145ee9146f)},
+    0
+  },
+  {
+    {W(0x91018dec677fa8a8), W(0x1b96f6d669473bdf), W(0x18fe61276df7a88c),
+     W(0x058b1bdb750e7dac)},
+    {W(0x7fb0ce1ba31a3108), W(0x55ed7c610dbc3ff8), W(0xe29b0dbc4b1a54fe),
+     W(0x69c554ac610987cf)},
+    0
+  },
+  {
+    {W(0x29665eafd74adf62), W(0xabf7ebd2b5e65a35), W(0xfa7349729b28897c),
+     W(0x1fb7be6494cc53de)},
+    {W(0x2c965c9aa046f0cd), W(0x30d20759b7825d93), W(0x9ad6fab17f202308),
+     W(0xac4e7e7d6687e64f)},
+    0
+  },
+  {
+    {W(0x8ab509c1f753150a), W(0xb5738e4c08453c11), W(0xe75bc57f39433bd4),
+     W(0x25c1b8e06b323296)},
+    {W(0x5fe6c386aa3bb357), W(0xe59d1de93c447acf), W(0xe8a4304ae166ace1),
+     W(0x28f397f3f3697af9)},
+    0
+  },
+  {
+    {W(0x772e609d9d13cd7c), W(0x0078c6ee692b094c), W(0xa65bebccf636431a),
+     W(0xc3f33c627a004bc8)},
+    {W(0xc8f7d02ebb2873ba), W(0xf94713c3decdae1b), W(0x0788445a9365469d),
+     W(0x5bb3af6b49976891)},
+    0
+  },
+  {
+    {W(0xdb82a8b4517bb70d), W(0x0adffb8ca3f57688), W(0x8b2132ee3083273e),
+     W(0x2cd8715b9e916271)},
+    {W(0xa55491d0624769dd), W(0xa9d03db69fea3ea5), W(0xaa784140ccf844b5),
+     W(0x10fb3e5aaae950d4)},
+    0
+  },
+  {
+    {W(0xc170b473322b782f), W(0xd6702d75bb4963fc), W(0x045b497d9cae193d),
+     W(0x401505f604bf304e)},
+    {W(0x1c381826089992c9), W(0x07658a7cff88b6d0), W(0x3450ca8762377637),
+     W(0xd762c36dde142ea4)},
+    0
+  },
+  {
+    {W(0x29a703acfe9879e5), W(0xcc7f5c07e0fbd943), W(0xf2531ea132b77e29),
+     W(0x312735ee32f4295f)},
+    {W(0xdc2a8357a2e525a9), W(0xf720f228ecbc8ab4), W(0x381526cbcbd8796d),
+     W(0x7c76ac3d75e0e134)},
+    0
+  },
+  {
+    {W(0x0c0ff02c7d31afc9), W(0xf21771c07831c4a7), W(0x4831ba08de7440d6),
+     W(0x0b325f053c1571b9)},
+    {W(0xbc5f7dad72a0395d), W(0xe3edb5d401de0d58), W(0x7905874ce22d1c48),
+     W(0x1a3caac52a4e8c36)},
+    0
+  },
+  {
+    {W(0x790622b79a883a4f), W(0x98f730335c7151f8), W(0xf0a15c6ec190ef08),
+     W(0x9a43c8b9ba984245)},
+    {W(0xab1ab5b42b894790), W(0x23d7b8be2785e0b6), W(0x4d355dfe640d9e3f),
+     W(0x857a426393028d3e)},
+    0
+  },
+  {
+    {W(0x991965171ffeb124), W(0xcfdfb46a893c67de), W(0x94282f971f2d8b44),
+     W(0xf5a361800849ae43)},
+    {W(0xdf92ff7462c16233), W(0xc3285b08c4c4cb29), W(0x022b33bf2d099609),
+     W(0xdf54ff5c8ce7bf89)},
+    0
+  },
+  {
+    {W(0x46adfead624f3df9), W(0x7d652daa9a18c5ae), W(0x570e49a23570aea4),
+     W(0x43c34264bbae014e)},
+    {W(0xa2b26e2d605b1595), W(0xf6eef9ecf51ab652), W(0x8a7805fc1d0b3d2f),
+     W(0xe4c51946a7aacdaf)},
+    0
+  },
+  {
+    {W(0x550305cd159d47de), W(0x600b6d7515551043), W(0xed06ca2c5ce891fd),
+     W(0x47a06f87f3c1c2c7)},
+    {W(0x4220561079a6aef7), W(0xe176143923a822b7), W(0x3205bddafcda81a8),
+     W(0x6450547c8ad98044)},
+    0
+  },
+  {
+    {W(0xb06f0c1c59c428b6), W(0xc708bc99e26a6ca3), W(0xed6abbbb20ac9eb7),
+     W(0x206a4e1eee3becf0)},
+    {W(0x4255481ecff40448), W(0x88a699a5ccc9a772), W(0x9309d5be2b9decbc),
+     W(0xd83dfb6c4bf4166f)},
+    0
+  },
+  {
+    {W(0xfdb802a20fc158cc), W(0xf3c4be0272cccc0c), W(0x871023935fdacee3),
+     W(0xd6771b0f2e08a3b4)},
+    {W(0xf84ede0f42c1e1ff), W(0xa2eccbce0608cf05), W(0xe9b2382c94773c55),
+     W(0xe5d11c4e69ef96de)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb6be30d6f8690928), W(0x88b68810434ea2e8), W(0x3bd453bf4619fa9d),
+     W(0xf4f354d265a85a7d)},
+    {W(0x91c6edb76254c4d6), W(0xae770d165317107e), W(0xccadedeaa81c00a8),
+     W(0xe646640ced889ed1)},
+    0
+  },
+  {
+    {W(0x4fe0a88b7435f8be), W(0x9e51a80bd00a39ab), W(0x17895b4053ae3439),
+     W(0xe5b769ac63177687)},
+    {W(0xb24d8149b4419d5a), W(0xaf3cdff35e863840), W(0xb5e37ee83a65e949),
+     W(0x9404d7901ddc8491)},
+    0
+  },
+  {
+    {W(0x8244d9921bcf53a5), W(0xc895dce20f4b77c7), W(0xa04260ba53778ceb),
+     W(0x0e309d31c9eaaaa3)},
+    {W(0x240597499194ea30), W(0xfc23cf5034d6dd6e), W(0x82ef6c7b810daad0),
+     W(0xc55aba338ed9675b)},
+    0
+  },
+  {
+    {W(0x51950cbb40c47099), W(0x90ad3d8a0a9b4a87), W(0x544c3e23ae1eb361),
+     W(0x1269b5afa18ce64f)},
+    {W(0x584bed44da9ac0af), W(0xce3beee93d717c65), W(0x63f33d45f1a3d771),
+     W(0x79542c046baf45dc)},
+    0
+  },
+  {
+    {W(0x2f836f4bae9711a4), W(0x4827e23c946948d4), W(0x731a8af3a2f3bfb2),
+     W(0xaeb7decb048b4fef)},
+    {W(0xa80f051deda16508), W(0x9f0473b70732396e), W(0x00c30d117f6d74fc),
+     W(0x2d2c25ffae9bed5f)},
+    0
+  },
+  {
+    {W(0xce7206d4c2eacdc5), W(0xb5d6b7a46e04b447), W(0x4a93a8b89334c66d),
+     W(0xbb1eb0ecef6cc8f6)},
+    {W(0x05a64f57f126dfce), W(0x523f2dd704e0a471), W(0x2d0d6a542efecb7d),
+     W(0xe24a7ab958f33498)},
+    0
+  },
+  {
+    {W(0x577e5ced3e899cbb), W(0x3d6888b5a8588455), W(0x83de9e9fec08f299),
+     W(0x1a56e5f18cac68fb)},
+    {W(0x61651b669fb95ffe), W(0x8859922459bb331b), W(0x033488c0785fd724),
+     W(0xa06ea37368415cfe)},
+    0
+  },
+  {
+    {W(0xb30d3154c5c27031), W(0x46dd0e3f756cd6c6), W(0x1f04aa20bf0d1086),
+     W(0x5e033931af490e76)},
+    {W(0x133ef88978b15ef9), W(0x23e9249eaf1407a4), W(0xae3d0578336fc35b),
+     W(0xb2036a029abea7bc)},
+    0
+  },
+  {
+    {W(0xede9eb372d4a2918), W(0x89096f0ffc6c223e), W(0xd7264a9b3aea7573),
+     W(0x3fb7e07aa89d09cd)},
+    {W(0x6e4cb09cdeb0ad5e), W(0x93e07bc92ae9dd26), W(0x570dcaf4764864a8),
+     W(0xd8fb757c0e643a34)},
+    0
+  },
+  {
+    {W(0xc3c23c34d5f2bc0c), W(0x35121b131407a7f1), W(0xac79382a8d09441e),
+     W(0x085a457b03c8ff09)},
+    {W(0x5dd9159d9ae0a63a), W(0xb2f63cd2c59e756b), W(0x9fdde1fffa6940d1),
+     W(0x3707701aade72f1f)},
+    0
+  },
+  {
+    {W(0x0363ae60ae25492d), W(0x3390c418a1a306fc), W(0x7202d60d20835f2c),
+     W(0x5796d9103e9b3b75)},
+    {W(0x530f8bdbf1273816), W(0x3f52ce7811d3a2a4), W(0x77f4965707ccf581),
+     W(0x336db2fc21faed0c)},
+    0
+  },
+  {
+    {W(0x48b6feac382fb0b0), W(0x41ec48142cbb9b65), W(0x9788c2dc3ef55415),
+     W(0x39839e637765b527)},
+    {W(0xa3eebf02c7a481de), W(0x24b2923b0f4533cd), W(0xcade127d734d205b),
+     W(0xb9e273783a82bead)},
+    0
+  },
+  {
+    {W(0xadbd97e7fd5b282d), W(0xa0e356ad3ed65c04), W(0x099c1d5c70d733e7),
+     W(0x1d7525077779e3dc)},
+    {W(0x184277a0eaa4ee89), W(0xe530fe6bb0ea46c1), W(0x8976c76d80b21c77),
+     W(0x4a30f9d6e06af5ba)},
+    0
+  },
+  {
+    {W(0xe47e83264ab5830d), W(0xc243d39ca3b38910), W(0x807d9eb3dc0fd5c5),
+     W(0x3a54f2e08f9ce5ce)},
+    {W(0xde4c778dc53f085f), W(0xe28299b8734867ca), W(0x237c3a81b6b9b82c),
+     W(0x5ce51d42c95db863)},
+    0
+  },
+  {
+    {W(0x218e4cf6ddd920e2), W(0xb7ab6168e33fe3fc), W(0xaf59936a70c73d92),
+     W(0xce6f2ebf7765e7d2)},
+    {W(0x0fac7ca4af78310e), W(0x28f2746f29c82141), W(0x19acbb1fd3023fb1),
+     W(0x82c14fe3b020efd5)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9ff47ea65a491212), W(0xb73df5ee9b99db72), W(0xfc2b420f22c654eb),
+     W(0x99d30dc90a3c3c7f)},
+    {W(0xdc38d58aff60c8b4), W(0x88840754a82c9b1e), W(0xec5a5d57cc17b854),
+     W(0xf66af64fc944a199)},
+    0
+  },
+  {
+    {W(0x6f4ef69900ff6bc0), W(0x49f1efed5253ccec), W(0x01591591b6aeff80),
+     W(0x68df46c894c45f30)},
+    {W(0x7bfafb219a914825), W(0x096f8e5eb11e3ae4), W(0x79a8615e29be22f6),
+     W(0x27ba8d9ac64b3624)},
+    0
+  },
+  {
+    {W(0x6a5541d8a7653ea3), W(0x852c403e2001defc), W(0xc00a872a1f9919f8),
+     W(0x7ad62f633597fa24)},
+    {W(0xf17c9c39036b7112), W(0x2b286a2f9fcbc34a), W(0x798f8b80f0371dd4),
+     W(0xb15fd6ac8468d228)},
+    0
+  },
+  {
+    {W(0x7409cadfe38d8467), W(0xaf089305f874c06d), W(0xe237f9af86274217),
+     W(0x333526281ec3e3d8)},
+    {W(0x5e1d7ec5c3fd78d8), W(0x54bf72f7e36af166), W(0xfa21fdc1cabe1ab2),
+     W(0x59327c5fa48ff343)},
+    0
+  },
+  {
+    {W(0x63519941e1e8d2b2), W(0xfef2e524a670a757), W(0xa02b171049240195),
+     W(0x5094d956ed9fd86c)},
+    {W(0x30604e4fffdc3267), W(0x848862b462251341), W(0xdc91bee3b4ac8dd3),
+     W(0x87c719672d86d787)},
+    0
+  },
+  {
+    {W(0xfd16541251f4ac49), W(0x8de303977f3d4d43), W(0x15dc38680c2ca7c6),
+     W(0x4babcd3a13eced29)},
+    {W(0x2de9b7325dff92cc), W(0xa1b5dec8a941985d), W(0x04a117a2db3553f4),
+     W(0x0940b4a5e44549d6)},
+    0
+  },
+  {
+    {W(0x542160568a23e947), W(0xcd8e9278c6410a9e), W(0xb699eeace97ef6e6),
+     W(0xc550df2c63752ed0)},
+    {W(0x26ff4f36c3d5c820), W(0x3b65ce72c2370faf), W(0x86097526c50931b7),
+     W(0xaddfa2f22a05c84d)},
+    0
+  },
+  {
+    {W(0x5c92d1957d292089), W(0xb2d11755973362e2), W(0xe02d49fad3feb4c4),
+     W(0xfd9a00270c215642)},
+    {W(0xd06976a21eccfa9c), W(0x3090e7cdb8e81d80), W(0xebc4ede69daa9002),
+     W(0xf3525b9be537c812)},
+    0
+  },
+  {
+    {W(0x848f79d0af34298f), W(0x694bcc76262bb89b), W(0x0bd64c2535e9fce3),
+     W(0x685d11f02b0b0f27)},
+    {W(0xc4f1fff635882f07), W(0xb1b33c6fb533a916), W(0x94ca7dc9b48a6dec),
+     W(0xf067c25d0305de8d)},
+    0
+  },
+  {
+    {W(0x61cf806e4cf48aec), W(0x7e30744c1152aaa5), W(0x4223b219e42a3a77),
+     W(0x96a3ae0f8d837531)},
+    {W(0xed50c760b8cdba4d), W(0x1070d9762bbf2c47), W(0x2f6c2e71d637e1a2),
+     W(0xf08c01fb6dcde448)},
+    0
+  },
+  {
+    {W(0xe63edabdc0fb926c), W(0x03cd4ccff5144c26), W(0xcdf2ba2f0d9b0dc4),
+     W(0x3bd8d517d0c05a52)},
+    {W(0xf7af463a8e73586b), W(0x69f055afa8effdac), W(0xb79d67543bce1a3d),
+     W(0xfd1f8e2eb9ba1d44)},
+    0
+  },
+  {
+    {W(0xdeb8dec32ca3a943), W(0x5ba03eb6c7ba6c60), W(0x8934ee00db5978e0),
+     W(0xfbb8bdc1aa448587)},
+    {W(0x1ea444fd75c5de42), W(0xea501d92d44a4ecb), W(0xed2646a287537a1b),
+     W(0x57f8dad951e79aeb)},
+    0
+  },
+  {
+    {W(0x7f485f8af333555a), W(0x323e27c06c15d51b), W(0xfe239e42160824f1),
+     W(0xf343db17c0637b36)},
+    {W(0x3dc6ab30c2b402c6), W(0x2d119dc0b88c9f9a), W(0xbe8e57144451893e),
+     W(0x264a65db58ffafed)},
+    0
+  },
+  {
+    {W(0x49b73653932d768c), W(0xbcd305ca1c29632f), W(0x707ccc660b1189e2),
+     W(0x3b3f474a51af6dcf)},
+    {W(0xc6a29a246d80d60c), W(0xeb5b1858e0c5ce22), W(0xa45bfd6803fdc78e),
+     W(0x7702f253ab9b01f9)},
+    0
+  },
+  {
+    {W(0x8e93fd4f34936d28), W(0x1d67d413b43d3b28), W(0x17b6e1cc1f2d8785),
+     W(0x15a1ec367fb5b02b)},
+    {W(0x9252e13624cab1fb), W(0x82699dfb4f5a1803), W(0x4765c9963dedbea9),
+     W(0x56f6f99cfc1f08cf)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf459f7b3f825a5fd), W(0x4595b420413a74f6), W(0x6b766e52094a50e1),
+     W(0xe415457989fb31e8)},
+    {W(0x45e46b7fd180dfb0), W(0x33e40fb4e2f5450f), W(0x080c953d28afd08c),
+     W(0x7598eaa14c9519a8)},
+    0
+  },
+  {
+    {W(0x02479b1e16e9e6d2), W(0xb1d6219dbcade03d), W(0xdc6acf7b90e35bf5),
+     W(0xbf0735f36e783aa3)},
+    {W(0x393fc398c5baa77d), W(0x5d3dc1be5897d9aa), W(0x3ba028b995846d7a),
+     W(0x986fd6412ea0ecf1)},
+    0
+  },
+  {
+    {W(0xf68bb6adcf253d88), W(0x7232fc8ff8a6b0fe), W(0x40000163e2d39fb4),
+     W(0x6f29fb8d9ca0725f)},
+    {W(0x59d669a40614d077), W(0xe115da8d4b6d578a), W(0x3313523283a272b5),
+     W(0x9a6f2b25155c59ec)},
+    0
+  },
+  {
+    {W(0xa519bf551b42ef1d), W(0x06d8b643c27da179), W(0x3897633b13c66d44),
+     W(0x0f05909eb601f991)},
+    {W(0x2c6a65365dc3f8f6), W(0xd33124163ed0a6ea), W(0x6845bb2299fc2341),
+     W(0xce5e37dbb00980d7)},
+    0
+  },
+  {
+    {W(0x75ccac9015cfcddc), W(0x8d4cf698f1d0b218), W(0x13d8056d70bef9e8),
+     W(0x657278197f4701be)},
+    {W(0x7a91f372eaedc832), W(0xebb63c41a0784147), W(0x96f1754c919dbd15),
+     W(0x6a19841df72a4718)},
+    0
+  },
+  {
+    {W(0x4e112715aeb6af41), W(0x7d3ed2fb6c5205fd), W(0xed2c26850511a84e),
+     W(0x4d8f50fc6d870d63)},
+    {W(0xd563122f5e7f3eee), W(0x305bbec20de61125), W(0x6bd9ff85bec29080),
+     W(0x76e821fa069e573f)},
+    0
+  },
+  {
+    {W(0xe2630698563e5ef7), W(0xc39a5d58372aaa98), W(0xedba16a107476b7b),
+     W(0x4f76607822dde27b)},
+    {W(0x9a40f350e70b447d), W(0x1932fa393ae1a820), W(0x098fa4853043b4c6),
+     W(0x85ad1d78b0c2a84e)},
+    0
+  },
+  {
+    {W(0x6dd33d862efaa7c4), W(0xc6a9cff570e0b486), W(0xc8385ff71007fe8c),
+     W(0x149d2919cc47f615)},
+    {W(0x9c32c8ef1da795bb), W(0x52baf59e82d6827f), W(0xf0ac589583e96d6f),
+     W(0x8a6ccf8f65643257)},
+    0
+  },
+  {
+    {W(0xd0359cbea9e83f0b), W(0x8310d496c1676be7), W(0xa32d348a8749b896),
+     W(0xa572ff3bee4f94c3)},
+    {W(0xab2db5eb6bed3340), W(0x4305c1a664e55915), W(0x46fbd6afb99b81f1),
+     W(0xcd56b2f1a20a7451)},
+    0
+  },
+  {
+    {W(0x4e5f8028182b9a72), W(0xc413a16243c5b55a), W(0x811131e009aa4b1f),
+     W(0x76b86086dc4c8ab7)},
+    {W(0x3443574cb148a0b5), W(0xbd20d4ebb08011de), W(0x65c3e6c5466ebe95),
+     W(0x32c59465b3fae13e)},
+    0
+  },
+  {
+    {W(0x22da76aa8fdc4e7c), W(0xdfd7a8b8658d5551), W(0xa69edf831053b09b),
+     W(0x2d75bf75e2213496)},
+    {W(0xb6c748bd4413a9fa), W(0xd5b7233b79361648), W(0x202070353e2b11b5),
+     W(0xb345c3c0df2d630c)},
+    0
+  },
+  {
+    {W(0x05069a5194e3f739), W(0x1b434d08b70c1ddf), W(0x935c65d794f0d520),
+     W(0x60e410f591431648)},
+    {W(0xa29110d41976ffe8), W(0xcdd61aae5f356ed1), W(0x580be703bd986d13),
+     W(0xa69e05820a2e3d21)},
+    0
+  },
+  {
+    {W(0x10d092a91c96fb4d), W(0xd045cf78be91a9db), W(0xcaaa84089adea1f1),
+     W(0x31a1195f1e4c1662)},
+    {W(0xd2d443f6961151fe), W(0x4201c97a8e271369), W(0x7bce18d8bcc2a908),
+     W(0x12dab83ea71adacc)},
+    0
+  },
+  {
+    {W(0x0813fef3aaf44aac), W(0xe1d2959db4bfdb49), W(0xcffcfff788d4df9f),
+     W(0x67c3ff5ac527240c)},
+    {W(0x29e12cb692a14638), W(0x7dbb65a80ae9604b), W(0x525e720a21c75958),
+     W(0x0185fb81c0ccf2a2)},
+    0
+  },
+  {
+    {W(0xf983737f91121999), W(0x737359cadd3638c8), W(0xd9eb40d51522f1c7),
+     W(0xe943c0b60e39c2a8)},
+    {W(0x77605aafd14ba9a7), W(0x2abf7ab14ad86db0), W(0x4ea157fbdfda8f69),
+     W(0xba84eba4450e0acd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8b651ce58f8cfac9), W(0xe7688f8881beda93), W(0xef334ff50d656e1e),
+     W(0xa374d8d85ec25f80)},
+    {W(0x9e13eae379c03819), W(0xaf5831c18d4dab3c), W(0x88deb51df6e90c26),
+     W(0x87a61f17823f5310)},
+    0
+  },
+  {
+    {W(0x6db7491f33e3eb81), W(0xfab69b8d1d01759d), W(0xa8b52594b17c9bae),
+     W(0x36210cb3f6efb30c)},
+    {W(0xc5545b121f950168), W(0x5ee71cdb2df60ba8), W(0xe7642e69c7f87caa),
+     W(0x54e006bf8999648f)},
+    0
+  },
+  {
+    {W(0x0426236497239c58), W(0x124db7c09181765b), W(0xa7b5d21a8bdc8297),
+     W(0x1998f669684f23c3)},
+    {W(0xf27a606339fd52b8), W(0xb234c77af77c78a1), W(0x768c0fb078f05350),
+     W(0xfdd391801b5e5d18)},
+    0
+  },
+  {
+    {W(0x866ea46d69f216fb), W(0x64a5d28a4ac99446), W(0x8c3ea2e0055dbf41),
+     W(0xe38acecbbddaa65f)},
+    {W(0xf1802eee26632b9a), W(0x626bb951bc3f0465), W(0x82e6ac2da26eadf6),
+     W(0x5c6d543ce3874052)},
+    0
+  },
+  {
+    {W(0xf15adfe1951ab7ad), W(0xd760a27091f8be57), W(0x974f7ecbe2da421e),
+     W(0x6b41a29883e7bbe0)},
+    {W(0xaaf40bb40467e682), W(0x735ed4b61bf34e2d), W(0x8d7cec0f40689777),
+     W(0xf8ef58a59a20cfb3)},
+    0
+  },
+  {
+    {W(0x6e9dad0056971658), W(0x819335e2bede65eb), W(0xf4eb7d2714a1fb14),
+     W(0x5d41fb1941c61598)},
+    {W(0x60e4f57eed7181ca), W(0x539f5dd22420d5a6), W(0xdf3b3e2f9051939c),
+     W(0x8f27e6ceab63b01c)},
+    0
+  },
+  {
+    {W(0x33be69093a134039), W(0x84255b1df04dd006), W(0xbe2da53dfb23fde9),
+     W(0xaa9227621d7272b0)},
+    {W(0x4512e3ba9d836751), W(0xb204522cea4d6dad), W(0x87df6050aa016939),
+     W(0xb90072212f7d3b93)},
+    0
+  },
+  {
+    {W(0x5752669cfec4f694), W(0x350bc0e9d6931168), W(0x2439a6d5c8ddb9cf),
+     W(0xf63a69558ae0bb1d)},
+    {W(0xcbe2cbc340d3e479), W(0x96658df6eb98b4ee), W(0xdd94fc99243a2f9f),
+     W(0xef71178186192cb2)},
+    0
+  },
+  {
+    {W(0x25f2a39335485cdf), W(0xbadd4a893dd4547e), W(0xa1e69bda2f69714d),
+     W(0xe7803aa48624204f)},
+    {W(0x187016ef19344722), W(0xb9b81e43a10d5d54), W(0x85514fd9d0a58dd7),
+     W(0xff291f5e939945ec)},
+    0
+  },
+  {
+    {W(0x402f57bf0e2ebcaa), W(0xbfe4a6c73ce95779), W(0xe6b86e8ca59589b2),
+     W(0xabc813d079198214)},
+    {W(0xb6aa580f9f7126e2), W(0xf945e6aded9e6f93), W(0x7759bbc37a0822c6),
+     W(0x097a05e87d09c673)},
+    0
+  },
+  {
+    {W(0x098e11b1ec8630ff), W(0xc7cb1e86b49dbf4b), W(0x28acef09c8d03872),
+     W(0x306cc71ed3432f5d)},
+    {W(0xae45e3e975be7d37), W(0x5c20c374166fa905), W(0x3f31f05177fdb46d),
+     W(0xb9d61e480bd1dcbc)},
+    0
+  },
+  {
+    {W(0x8f1f2f291597b3c8), W(0xcf73521ed18a72cc), W(0x013c4b3b4355fce6),
+     W(0xa83418766286938e)},
+    {W(0x81264a5b4d1a8c0b), W(0x83597193a7b577e4), W(0x108dcd7a33f1576b),
+     W(0x8cbb1f66bae0148a)},
+    0
+  },
+  {
+    {W(0xf3ff066a3a7854a6), W(0x01fdba6379d9c31c), W(0x7f93ef7fcc8220e2),
+     W(0xa70e18f24844b55a)},
+    {W(0x3addf8414bc3c084), W(0xd4405377dc378009), W(0xb3c0dcf6ded5eae7),
+     W(0x9c8d2ee199ba8d32)},
+    0
+  },
+  {
+    {W(0xe78a5dfde22ea12d), W(0x68f392f04846e8f2), W(0x93ae422426e68c73),
+     W(0x04aacaabe4bfb573)},
+    {W(0x5865286089b0513f), W(0xcb4f97681900da7e), W(0xd9be4368b8873565),
+     W(0x4ee727f168f54a73)},
+    0
+  },
+  {
+    {W(0xa2a1ca13d09d724e), W(0x410f5c9c03c89d26), W(0x061a88d921497e67),
+     W(0xa83f216c5eefec86)},
+    {W(0xe3c61b9a3b0ed3bd), W(0xa0bf9448a8b7bf87), W(0x4ea60d494720c8e3),
+     W(0xcecb54b625bf7b91)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb6b50eda272e9751), W(0x3fe27c6a195edbf5), W(0x9cdd9c462ef8a9cf),
+     W(0x4c276680ccc851a3)},
+    {W(0xc8e079a46f0a9ef3), W(0x614800006b0ba84c), W(0xdced315c48b8fa3e),
+     W(0x911a49b77f23719c)},
+    0
+  },
+  {
+    {W(0x9c2dc74a062cc6de), W(0xad363af24d4b0c6f), W(0xefd5d6f24cc5d6e0),
+     W(0xff4ee6847710d86d)},
+    {W(0xac77740b35836984), W(0x3d90a19d760b044f), W(0x7ee58462dd69d798),
+     W(0xd5bccfdc730e783a)},
+    0
+  },
+  {
+    {W(0x58a746cc23eb95d8), W(0xb295913233a5c0b2), W(0x33af25d495c8c842),
+     W(0xc1d584228d5372f1)},
+    {W(0x035f6c6815b3cace), W(0x68986e01cb068d90), W(0xd1672698fea468a7),
+     W(0x398ca3be948fe35e)},
+    0
+  },
+  {
+    {W(0x0772382206fc124e), W(0x2072d143f676d4e4), W(0x19642255cbc34659),
+     W(0xf94542a637260eae)},
+    {W(0x78312ef5520a49b3), W(0x3127e5f14c89f1e7), W(0x88ae06b995c11918),
+     W(0xbef471e116ea53bf)},
+    0
+  },
+  {
+    {W(0x24d6f33af48c02a0), W(0x38fa7d939a6b055d), W(0xd71eb4495b7699f8),
+     W(0xef56b91d50db0390)},
+    {W(0x8925a9d4de66789c), W(0x0466f30a7cf94e94), W(0x229a97c5309b9776),
+     W(0xd18fded84d0efc80)},
+    0
+  },
+  {
+    {W(0x083723ac6a132af9), W(0xd20d67b749464656), W(0xd2da033f4cbd8c79),
+     W(0x115354034e39bdbc)},
+    {W(0x374ca955d2493265), W(0x5596dbf65baa52a1), W(0x1f9ec6e2d7134f01),
+     W(0x57e391327aad335f)},
+    0
+  },
+  {
+    {W(0xff9ba069f3c5a5ae), W(0x477a8745983ef82f), W(0x2c76ffbefc6dff89),
+     W(0xa46d7ac0bc0581c9)},
+    {W(0x330b695a3812e747), W(0x1127b1201ef269ea), W(0x671abdc3268fc9ee),
+     W(0xb79b5cd6292c037d)},
+    0
+  },
+  {
+    {W(0xa8ad36555ecbbda2), W(0xd2dfe2626d02cbaa), W(0xcc3adc4f0caa7d42),
+     W(0xb7d4037b60c19a0e)},
+    {W(0xf348a376940f5e53), W(0x36af5ad4db28bfda), W(0xbccfa0820e1184f3),
+     W(0x01b52933cd943161)},
+    0
+  },
+  {
+    {W(0xef32ca294b05ddfe), W(0xf0a1d65555f1e45d), W(0x73334086c4c07e40),
+     W(0xd94cedad7d37650a)},
+    {W(0x68fc0478e77f62f3), W(0x778538df6f86d927), W(0x535477983e88f10b),
+     W(0x202e147ac69c79f7)},
+    0
+  },
+  {
+    {W(0xc358664fbcde2353), W(0x92273ab79e568d49), W(0x170b988f5b8afad0),
+     W(0x30eca57b8f3d6f5c)},
+    {W(0xd8333654e4a2341f), W(0x159f23867820dc37), W(0x1cb1ede90cdb7b53),
+     W(0x60835025dfe03258)},
+    0
+  },
+  {
+    {W(0x352c193f55af1ec4), W(0xd7c55bbc93ef8e8e), W(0x125861f9d64b2035),
+     W(0x3608cefde6d5f30d)},
+    {W(0xb51ae2f4ad9f900d), W(0x750511253f5e7e65), W(0x13666cccdb369bcb),
+     W(0x4b860a203d293bdc)},
+    0
+  },
+  {
+    {W(0x8d34cc5a35235567), W(0x4d1dca6bc96f0460), W(0x0f9dece3b0138158),
+     W(0xff537811ff7d1100)},
+    {W(0xfdb6c1c1fc094a31), W(0xfc1caa8ecd2587b7), W(0x929b517348451fc1),
+     W(0x3a2721a041226af9)},
+    0
+  },
+  {
+    {W(0x8324de532528eb1d), W(0x3e0bd21e01bc884f), W(0x52e759fde7033a75),
+     W(0x02b650e94b4dd9a8)},
+    {W(0x54d8ac61043e9841), W(0x72593a53db242bbf), W(0x3758f4ae5cab882c),
+     W(0xc90e0e6f2561c6bd)},
+    0
+  },
+  {
+    {W(0xcf239c304b75949f), W(0x6395491a5ac11681), W(0x6a27ed1b163539cf),
+     W(0x493f2f5804039ca6)},
+    {W(0x9f5199c87f69a5c2), W(0x8c18d82fae2d0cee), W(0xf62a341fa219813f),
+     W(0x26c64ef5f4361434)},
+    0
+  },
+  {
+    {W(0x93d3cae18fe51d76), W(0xe1ca5c0f0d3ef578), W(0x8895d6f162d4a204),
+     W(0x40f1d4b8b4b41b5f)},
+    {W(0x57aa8c6527f2892a), W(0x61656212900e284b), W(0x539e37efbeac4ac5),
+     W(0xa44657e422defd99)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8906b35938caee8d), W(0x1361f201978659cd), W(0xc3cdb311d3b2a63e),
+     W(0x4ca18196426f1eae)},
+    {W(0x9fc1bb4223f6680b), W(0x41341af13c7eced2), W(0x88285a2c7a68e765),
+     W(0xaa750ed2b0d1d8f2)},
+    0
+  },
+  {
+    {W(0x70082bfe92b19e2e), W(0x1885861059bbcc7c), W(0x0e5951245e4be779),
+     W(0x5c3337d6265e61a3)},
+    {W(0x991c276b0bbc7265), W(0x4f5363e112257611), W(0xfc84e2840ac9ca06),
+     W(0x322debe0b554e5b3)},
+    0
+  },
+  {
+    {W(0x5296fb6cfe7fc97b), W(0x70129ca0769d949a), W(0x54ca864591146f57),
+     W(0x436846db3244b026)},
+    {W(0x678472122e1e9467), W(0x6eef627d8566bc1c), W(0x456264301f261530),
+     W(0x57907f1da9b23161)},
+    0
+  },
+  {
+    {W(0x60c5ef28a8c46e18), W(0xbdd078523400758e), W(0x13c3796cc6066192),
+     W(0x56ac699d5c131aa2)},
+    {W(0x9eb3fa4aec5d028c), W(0xdbd7486c1b30f5e0), W(0x0929ab49a82244a3),
+     W(0xa6498df131a1d3d3)},
+    0
+  },
+  {
+    {W(0xee1d6321d13174b7), W(0x5b0279697cd42b53), W(0xc23ae92a96937683),
+     W(0xe4680034f364fb47)},
+    {W(0x621a5fd5e1fea17a), W(0x52a8c1df0bb943a5), W(0xdf0b7316b1bd7ad1),
+     W(0x6159dd8b1d2fbb52)},
+    0
+  },
+  {
+    {W(0x18aa5d1f871875ca), W(0x1ea0c3517b3fe97e), W(0xf7fb4fa3a1e5587a),
+     W(0xcad10d661de0eea8)},
+    {W(0x0150c180dbdf364b), W(0x81fafdd1cda347e7), W(0xd8c7d93d916538a7),
+     W(0x85176b6cf32c03f6)},
+    0
+  },
+  {
+    {W(0x54679b5540c29d6f), W(0x59a270ebe729423b), W(0x31f68f4b8aabaae9),
+     W(0x639fafc0339757e9)},
+    {W(0x76a34f6705268c54), W(0x329d7cbe5d13f3f4), W(0x5e693a26e590dca7),
+     W(0xb1f63479362aa355)},
+    0
+  },
+  {
+    {W(0x4886cbe596198bc9), W(0x42d4373e7366aabf), W(0xde65db0ab3204b5d),
+     W(0xcb3f63051a8cd005)},
+    {W(0xdd738b59376af5de), W(0x2265e993b4a71f08), W(0x73a4816f3785c519),
+     W(0xc98eef27aa50fe89)},
+    0
+  },
+  {
+    {W(0xb8bce38aab6b5910), W(0x42d20ad7c711ea88), W(0x5045c7ce8c47b71b),
+     W(0x29cb8a3aed74dd12)},
+    {W(0x6d9f0e17022c7b33), W(0x0675915233e424a3), W(0xdaf25e763fda0ddf),
+     W(0x276389040e677766)},
+    0
+  },
+  {
+    {W(0x6fab0bd8847aa69d), W(0x2084033d4e40b88f), W(0x7cc6d9f35966ac78),
+     W(0xe06e0d00875452f0)},
+    {W(0x5cf538a53a5cf667), W(0xdc8624c6fd43ce62), W(0xb6c16500472e3a7a),
+     W(0x5a0ac052669fba23)},
+    0
+  },
+  {
+    {W(0xc32d6f4cdef5a74a), W(0xb10e4da0c18584b1), W(0x08e2616d794512b8),
+     W(0x65d7678674707709)},
+    {W(0x99ae1279158edeae), W(0x7e5ce355e8243ad3), W(0x52f02f8e980a48ce),
+     W(0x82904bd703c4d0a2)},
+    0
+  },
+  {
+    {W(0xa24df2f2a3fcd07d), W(0x72c1a0e4ed81efaf), W(0xd1dbf5e4d724648e),
+     W(0x624ddf85191ce28c)},
+    {W(0x628169f3fac1edfa), W(0xe35b42a7babd8cb9), W(0x658c4aa44748893d),
+     W(0xb68832c2fc093f18)},
+    0
+  },
+  {
+    {W(0x604e6df26b30676f), W(0x499d5980787bc18e), W(0xc7614650eb8a0166),
+     W(0xc08d6b6bd202ebb5)},
+    {W(0xdc83d78c7241d69a), W(0x87602e593b3bbe03), W(0xa0d8f6ebe91336f3),
+     W(0x2974213cfcc6da1a)},
+    0
+  },
+  {
+    {W(0x12d9bf4e728f7c9b), W(0x48196fb3d47495f3), W(0xc56a82cc7e20f51c),
+     W(0x6052905771c114ff)},
+    {W(0xa1c031421c12f5f3), W(0xddac7d1bcd458406), W(0x40323dda254729fe),
+     W(0x6063c8832950dc2a)},
+    0
+  },
+  {
+    {W(0xc5cf370e64709766), W(0x5ca00657492408f0), W(0x4431c9001a78b2b4),
+     W(0xbf7fe456972784fd)},
+    {W(0x8564085e756acf41), W(0xe6f7ee24f967230f), W(0xadbecff781caf4d1),
+     W(0x880cb83392817b3f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xd6903021ca8bd10e), W(0x7c2c8213c6272451), W(0x067cc69da5b14d82),
+     W(0x09bc62745779456e)},
+    {W(0x491003cf90e5bedd), W(0xf0272347ca2bc9d3), W(0x07dbe881f77b27f5),
+     W(0xa7f8657ee1acc935)},
+    0
+  },
+  {
+    {W(0xd48ee6e72fcc27dc), W(0x9459b268a8f8a441), W(0x621709d51e0e6b59),
+     W(0x767d2ab7a53f5c0f)},
+    {W(0x30c51859f7dae3dd), W(0x79371372eb941438), W(0xfef0469d2a9e82a3),
+     W(0xa901d3e43d3817bd)},
+    0
+  },
+  {
+    {W(0x57fb2f5c28e31933), W(0x4f941a25488f0307), W(0xce6521c1cffbd305),
+     W(0xd6823f0bf98c249e)},
+    {W(0x5bc9ae16852bb3c2), W(0x4c0bf11d27e55cfb), W(0x3ae61532af6b40c2),
+     W(0x7cb8966dd556097d)},
+    0
+  },
+  {
+    {W(0x06359300f69f4a41), W(0xf6289d15365b855b), W(0xcf892307f20caebf),
+     W(0x53050f46037867b0)},
+    {W(0xcd9f8831bc01018d), W(0x9f5a7cff0c764963), W(0x896bc119ccc8c6db),
+     W(0x3aeaa17e87266395)},
+    0
+  },
+  {
+    {W(0xae4db078d7f02d26), W(0xc65f85baac26d942), W(0x70877b6f6f87f2a5),
+     W(0x267d15bc94e6606f)},
+    {W(0xb15671344a99bbd5), W(0x6e1378ce1fb1dab6), W(0xb1bdca31f7bdc295),
+     W(0x8ccec147d557a617)},
+    0
+  },
+  {
+    {W(0x545cc067a023701f), W(0x73c0795b5db8696a), W(0xb6782e7463513fb1),
+     W(0xb803a3d1ced829da)},
+    {W(0xe41f645262ad7df8), W(0x28f7c9bb4820b510), W(0x53fb148e51bb26ed),
+     W(0x060a3a0f7379da10)},
+    0
+  },
+  {
+    {W(0x7e398389f773e8ab), W(0x16f66b2cdc861bf6), W(0xe790a84f0f4896d0),
+     W(0xb622b3e7bfc0d884)},
+    {W(0x45b873ed68b5a0db), W(0xf1489f00568e591e), W(0x56c1ccc729ead459),
+     W(0x413c29c3a9e27e80)},
+    0
+  },
+  {
+    {W(0x34a74e3424d59b3b), W(0xaaefcbd5dc8f7797), W(0x5c1a421b7ee6678e),
+     W(0xdb0ff59f0a9009a4)},
+    {W(0xd34b5f90ec8032b4), W(0xa18f977731f0fcc3), W(0xa261f6f3284db8df),
+     W(0xa2424c986e792bb2)},
+    0
+  },
+  {
+    {W(0x25cfa04190eb1b2a), W(0xc5bc28cba27d8c4f), W(0x3580377c0a904a49),
+     W(0xb6b90b444a8ee409)},
+    {W(0xf844d59101a9abd8), W(0xbca41e86d6ff4e82), W(0x03947e3c7fe7b749),
+     W(0x439aedaeaec7ad54)},
+    0
+  },
+  {
+    {W(0xb510f6ef9478441a), W(0x9bc72e40f0846ba6), W(0x5b91d09693f54c84),
+     W(0x19c5b6f8be53e825)},
+    {W(0xe44535edc7a99964), W(0xb985ed801ca8d56d), W(0x134456f8e7c569f1),
+     W(0x99d2a276ee3cc596)},
+    0
+  },
+  {
+    {W(0x73aacde36e1ee4f4), W(0x7d38933beed613ee), W(0xf9f1c12aa3f45f5d),
+     W(0x5cb401143cf1f194)},
+    {W(0xf3b4187c90b00266), W(0xae1eecbf3ff2bc05), W(0x68485897b9ec7510),
+     W(0xaad799379dfa7e47)},
+    0
+  },
+  {
+    {W(0x8a5186c934f22c3d), W(0x6f3b06205d4dea4e), W(0x699a1fae8d142a58),
+     W(0xe6ef9a2763b6f85d)},
+    {W(0xe328ed2fe7619098), W(0x6a711e28cd5e2a62), W(0x6e6603288df04df9),
+     W(0x20408abdbfca294c)},
+    0
+  },
+  {
+    {W(0xfbdaf4c81e167589), W(0x92f4e0223a40ad21), W(0x7dde5491b20a6100),
+     W(0xd3e318a636882e26)},
+    {W(0x8b429db5ec661377), W(0x50f3d163263bfc94), W(0x440b1e5a8cf1ea61),
+     W(0x7ac91a81a4acdb9c)},
+    0
+  },
+  {
+    {W(0xad58c2d41dfd0324), W(0x81d98a8a21b01d36), W(0x6383fbdd52796b39),
+     W(0xc51ce7184277574a)},
+    {W(0xa27e6287644767c1), W(0x33f732a81133f3eb), W(0xa07314672866847b),
+     W(0xe9c31be3a56177ca)},
+    0
+  },
+  {
+    {W(0x5ee23e3a58f3dde4), W(0x28ee28495798d8e3), W(0x745549fe7cd8b4fd),
+     W(0xc421a726b6c43b2f)},
+    {W(0x09ec1c5728b388c8), W(0xede0ec869a6ae145), W(0xa8a3ba8eac1c2b81),
+     W(0x1e2ae3932a8ccc9a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x69d5655ffb74773e), W(0x6080c2cb1b650072), W(0x87eb0a1d7c124c10),
+     W(0xb98c157dd0a53741)},
+    {W(0x8236452d2dd5e610), W(0x4ff17b1579ac2691), W(0x6480c758a8d2c252),
+     W(0x99e48336bf5a070b)},
+    0
+  },
+  {
+    {W(0x0122b6faae718ee3), W(0xfbd125de0953c76a), W(0x228dad14acc8df2b),
+     W(0x194624803b6a34d1)},
+    {W(0x101d6700a6dada25), W(0xa9d7f08bb2ace072), W(0xa3890cf028c9e6d3),
+     W(0x75441fd9ff0ec046)},
+    0
+  },
+  {
+    {W(0xa052f7a3b0467630), W(0xb34aec57b3e85c7a), W(0xd453e9c08e4983ed),
+     W(0x59b94f7c747d8153)},
+    {W(0x574b89e34935f9f5), W(0x29f53fdb168605ad), W(0xc687eb4e417b773d),
+     W(0x5e136b3d13f2ebd9)},
+    0
+  },
+  {
+    {W(0xf441a4d5e7e99abe), W(0x613b633ccffebd31), W(0x38f79232c9225e84),
+     W(0x77e71551a8d50c76)},
+    {W(0x4eaaa476adb6dbc9), W(0x0c05d4d6e874dfff), W(0xe90b60842a79f78c),
+     W(0xfc2440eae5b044ef)},
+    0
+  },
+  {
+    {W(0x0ca7d2dbac33b4dc), W(0x2275c7cd66970a62), W(0x5eeb53b6ed3e1570),
+     W(0xd42cea4362b6c1b0)},
+    {W(0x28c35398b6293d0f), W(0xe82c76d315f4621f), W(0x9ba32c86a901b3e0),
+     W(0xc4fd1666d4d4a581)},
+    0
+  },
+  {
+    {W(0x0bfe00991f7791b2), W(0x824319b6ec7118c0), W(0x5488021a26ff0e91),
+     W(0x4b99be59e519662c)},
+    {W(0x5664279861454f0e), W(0xe3d52fc5f8964409), W(0x803474b5cfa269e8),
+     W(0x440988329dca4b46)},
+    0
+  },
+  {
+    {W(0xa755fa8f67b53abc), W(0x3170e3aadd5efe0e), W(0xbb57ef60bcebfbc1),
+     W(0x0ae27966af119f1b)},
+    {W(0x7367d50ee3442fff), W(0x5b00d0efbd1428c0), W(0x368f7f3fa6ef1590),
+     W(0xbf7239cc15b0ca61)},
+    0
+  },
+  {
+    {W(0x0d8d30149d5489fa), W(0x7e6ea0c173075ec5), W(0x690b57339915c0c5),
+     W(0xeb43bd659b1b8d24)},
+    {W(0x0f314caadb8c3a67), W(0xf4b15edb0c43866c), W(0x8a449724da747467),
+     W(0x1db819879b6aa0a7)},
+    0
+  },
+  {
+    {W(0xdb2ae1e356f99384), W(0x256651712769667b), W(0xe570733a84a29ca2),
+     W(0xc8f5263989761e3d)},
+    {W(0x09b2d5bfcbc507d3), W(0xb33b1619fab52435), W(0x7048ab68a4db971b),
+     W(0xc6da3b8263841410)},
+    0
+  },
+  {
+    {W(0x845ea4759e5334f6), W(0xfc1f543f8c1b666c), W(0xa8b04080597c9568),
+     W(0x63ca9bd3be874b25)},
+    {W(0x2e3bea45fd68ad96), W(0x986ac26f8a532537), W(0x09b96c53c0d261c7),
+     W(0xb2736c316edbc81f)},
+    0
+  },
+  {
+    {W(0xd718828bdebb7ea9), W(0x5479a19a1db5da61), W(0xbdb112cd9482e536),
+     W(0x39aa0b1f4c3a4a3c)},
+    {W(0xfc82348ccd9bb84b), W(0xbbeafaf445db7098), W(0x492f3cb60a06f372),
+     W(0x6f39f223704fff0d)},
+    0
+  },
+  {
+    {W(0x4ed28ebd8f1a81e1), W(0xb665265d4dad2297), W(0x7c893c7eb7cc92a2),
+     W(0x411cb60acbd014f0)},
+    {W(0x2a6daa7387d1b3ea), W(0x75685393f72e7ed4), W(0x653ba282d9716123),
+     W(0x36f16d3807bf8981)},
+    0
+  },
+  {
+    {W(0xb09ca547f821c453), W(0xdbc0b013fd924971), W(0x92a1cbf0c1a95379),
+     W(0x12aa8d966180232a)},
+    {W(0x83d7c7f5f97f495e), W(0x77c57b02bfdbfa60), W(0x1b15cc7bc6a94319),
+     W(0xe64634ff2ded2701)},
+    0
+  },
+  {
+    {W(0x87ac6925ccb72a2b), W(0x72291b6718a91aef), W(0xb643d054b9d3a9b9),
+     W(0x64f5e88f7432556c)},
+    {W(0xa0e75f2d6c0cd513), W(0x0fd98813b274ba66), W(0x0ede318ef4611841),
+     W(0x62174ebc14ccb0f0)},
+    0
+  },
+  {
+    {W(0x12e42069b8d07b32), W(0x43c69cd4a2359eef), W(0x7ca5bcbab7cbb0ce),
+     W(0xe00000a4d9b2bb94)},
+    {W(0xfa7e8e679cffa99b), W(0xfb10abe89a95d5c0), W(0x427e7890440c0720),
+     W(0xfce6a596c9383130)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbe0b2578f8023127), W(0xa95ccd098a8b68de), W(0x0dc602351925e578),
+     W(0xb2153f53004fca40)},
+    {W(0xb025456b72665f8e), W(0xa5327909a0246bee), W(0xfcfc4ef6f075a443),
+     W(0xb013b77bfbf58688)},
+    0
+  },
+  {
+    {W(0x0cee8957f3b482cc), W(0x3944f9e5f65ccbab), W(0x3270f90a66c91c05),
+     W(0x74116505d1db396f)},
+    {W(0xb862a96db20c1646), W(0x35b467d8a3b158f9), W(0xd41b157b1e52b2cd),
+     W(0x638d24c5a774015f)},
+    0
+  },
+  {
+    {W(0x7dc23489e31d4659), W(0xa9e52e03cb43db1c), W(0xc0ea0d9fefff5157),
+     W(0x39049ef851c0fc54)},
+    {W(0xce36f42f87926762), W(0x9592667aba4686f9), W(0xc10ac0af2e18e003),
+     W(0xd8331f211d5b8020)},
+    0
+  },
+  {
+    {W(0xffe0dfed77805fff), W(0x5fa794be31e71c1a), W(0xc4aaf9dc9c96d5d3),
+     W(0x1d61fad6321904c5)},
+    {W(0x219a652405a93813), W(0x7e1fd96e570ba1d3), W(0x9010f1829c1da550),
+     W(0xedc0e2f1b7e78a0f)},
+    0
+  },
+  {
+    {W(0x9da2838d27ab3b85), W(0x28cb26b3a5619978), W(0x83856b951c50fc16),
+     W(0xfbaefd9066b521a6)},
+    {W(0xea3368d4b120ca34), W(0x035416c27a2fd88d), W(0xc5138982682644b8),
+     W(0xfcab1a3b402255f2)},
+    0
+  },
+  {
+    {W(0xece9fe9c8ad2d673), W(0x415e5d82f6bb7e34), W(0x60f58fe475890270),
+     W(0x45ce114b75167d2b)},
+    {W(0xf8b2d5e0d0aef54b), W(0xdd88e616a7f615b2), W(0x8ae85e4971dcb6de),
+     W(0x05bf0c2e6058688f)},
+    0
+  },
+  {
+    {W(0x84e0dcd6aeabbaf7), W(0x50d114cd7cfd0130), W(0x08d645a7160841fc),
+     W(0x0b3484d484787649)},
+    {W(0x887546e0b36d4cd3), W(0x3ea2dcbfe57d6c61), W(0x5ac69355ccf12537),
+     W(0x2c0738718d9ea7e8)},
+    0
+  },
+  {
+    {W(0x654b904b38a2f85b), W(0x29c45d0695d9900d), W(0xc735fc201b8c060c),
+     W(0x0c1ae127ac2f427b)},
+    {W(0xc8ef4afaed135b93), W(0xe67e9e310eb1664f), W(0x7b37a5ef62585591),
+     W(0x749f646a59ea850c)},
+    0
+  },
+  {
+    {W(0x28fcd9b5d37d6a85), W(0xac6df3753e25a01b), W(0x3a88d67c09581c8d),
+     W(0x3de489a2c91e80c1)},
+    {W(0x6698cf2cfef28d61), W(0xfb519fc67ec55f12), W(0xbc25cc567d0a60f7),
+     W(0x3815b5781fc0d1ef)},
+    0
+  },
+  {
+    {W(0x653dfa3d3728f924), W(0xc7421fde53c05bb9), W(0x06fcf66dfdca3acf),
+     W(0xec06a16367d19113)},
+    {W(0x53e7a8f4419e9491), W(0x7d1d98b46b40a5d6), W(0x5901c25c0db651cf),
+     W(0x8023ec401c2f2977)},
+    0
+  },
+  {
+    {W(0x987fbf19f6bc53d1), W(0x463f62647640ccdc), W(0x906c6ca16d77f958),
+     W(0x401557217e034231)},
+    {W(0x6a97b3c91d5bed33), W(0xfede82365523bff1), W(0x5fe71bc71b99bd54),
+     W(0x090b2bdaefc4797c)},
+    0
+  },
+  {
+    {W(0x3dea1da1ec633bde), W(0x1bcb08c7f56a41b6), W(0x66d5d3423d06e3ef),
+     W(0x0ab8fc449708b1be)},
+    {W(0x1e849844a6919644), W(0xfa369ceaa89948e2), W(0x8a57172f8d5dcd5a),
+     W(0x92600cfeec1c6a13)},
+    0
+  },
+  {
+    {W(0x35630afec5d95f3e), W(0x90562d89d1d2c22d), W(0x4ce69fe4ea7241d3),
+     W(0xdfe26ef1c1f398f7)},
+    {W(0xa3b354054cc07afb), W(0xc4dc0af8068d5928), W(0x35124e9d341e982c),
+     W(0x7bd8b508adf07afc)},
+    0
+  },
+  {
+    {W(0xcb2381ca52bcaa18), W(0xf283de16714620c9), W(0xadd628d66647b17e),
+     W(0xf430e93ac0fd0a9b)},
+    {W(0x4a9587371c8c57c8), W(0xcaacd3eebe796020), W(0x9fe45d6489a850c2),
+     W(0x649a1b1fd1e28cd4)},
+    0
+  },
+  {
+    {W(0xc61223801bde66ec), W(0x0fd726077ea38576), W(0xe10000e4804a44e6),
+     W(0x89c6d7fc3607bf1b)},
+    {W(0x2444766156fbbe3c), W(0x7a6e60be34e83784), W(0x01c2e35c65ac0d58),
+     W(0x5eabf057f66df727)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfb5b141a44c39c8e), W(0xd655b14e47fefa01), W(0x13486a950061cf3a),
+     W(0x502abd039449df46)},
+    {W(0xc7b8ea6efcafda35), W(0x21f47a9b2794ab12), W(0xcb745d746cd72bf9),
+     W(0x7e7e2382eb6d9157)},
+    0
+  },
+  {
+    {W(0xd073880dc1f69662), W(0xfc612134a33914a9), W(0xc89c449c188d13e7),
+     W(0xa0ba1305ef6c3c44)},
+    {W(0x2aad7b739e20febe), W(0x870828aae44e4ed3), W(0x20de0c62e1f50810),
+     W(0x8c3d0f2edb549828)},
+    0
+  },
+  {
+    {W(0xf64eaef7ddaa15da), W(0x0f51c82117ca284a), W(0xa5e39406e921b63a),
+     W(0xc8d46bc5b0033a00)},
+    {W(0x2776e63581595010), W(0xbaf9990bec850f7f), W(0xb9d9b6ad00d52ffe),
+     W(0xc0ee70c21618b2ae)},
+    0
+  },
+  {
+    {W(0x3669804a6c6617fe), W(0x40accf21880aaabd), W(0x9b50ee21d60ef870),
+     W(0xf515a660e05e7cfc)},
+    {W(0xa8a0f63356fc218a), W(0xfa4a50cf38f949ac), W(0xdf340f723f2dff04),
+     W(0xc4de8964f3dbb6ff)},
+    0
+  },
+  {
+    {W(0xb5f066a6ce20f6fa), W(0x1d3412fc4519386c), W(0xc7a567a4be777e31),
+     W(0xe50763bd6bb8c48a)},
+    {W(0xfc5f123fe9ec4225), W(0xe3d4fa836fbc674f), W(0xbe82bc9b12f046bd),
+     W(0x3fa463754540d099)},
+    0
+  },
+  {
+    {W(0x71cb19f16bdb6cb9), W(0xc4dc2bfd4d3bbc75), W(0x1e6189714dff7a52),
+     W(0x50418b1a4dcfc02e)},
+    {W(0x87c1b9603f450b5c), W(0xb98290c2d6b40b2b), W(0x09c471d193cac03c),
+     W(0x237866687b893f24)},
+    0
+  },
+  {
+    {W(0x7ea2cea246ce0310), W(0x63f33c18e0f2b29a), W(0xaaa381ca49e533f3),
+     W(0x626bfea285f9675f)},
+    {W(0xeb24e2c7dbe236ee), W(0x52b928571cbce751), W(0x5fdec6b66eba8b03),
+     W(0xaa502258bdd16591)},
+    0
+  },
+  {
+    {W(0x2204dc49bd72b510), W(0x7294b18121ff1030), W(0x562447d234887455),
+     W(0x4d950690d755a273)},
+    {W(0x5ae7245c22123177), W(0x793b9c068739e6b3), W(0x3c546f47ac40622e),
+     W(0x72834781f22f4e26)},
+    0
+  },
+  {
+    {W(0x071fa53bb160dcda), W(0x02544f12f54418d7), W(0x67a2ecf32a197f70),
+     W(0xd5ace75c36087521)},
+    {W(0x92890d17c60dfebe), W(0x0a8ef231b3461ca3), W(0x5dd9122d7d153dcb),
+     W(0x6f0feb39bbf95bf9)},
+    0
+  },
+  {
+    {W(0x1cb225e7249cf014), W(0x15ab8af8a16c6161), W(0x4da5b14e347cd4d5),
+     W(0xb979be3480f11fb5)},
+    {W(0xbf342d1611c041f1), W(0xbf26ece605a6412f), W(0xdb32d2cba7178a54),
+     W(0xb231db90d746e1cd)},
+    0
+  },
+  {
+    {W(0xf21fcd9bf9e32933), W(0x90a851892323b8ca), W(0x85de5968333fede3),
+     W(0xe972778cd57b801b)},
+    {W(0x880b0f7f605a4d84), W(0xba935d4807a62b41), W(0x6f2aa487b6fa51db),
+     W(0x47453b5ed4c57fd8)},
+    0
+  },
+  {
+    {W(0x330e35cfa0ab5e27), W(0x7ea7d48c986091d0), W(0x014c117475665091),
+     W(0x5bb7d7b27dfcc05a)},
+    {W(0x25db5166320be704), W(0x901e8aae57f9ef04), W(0xb3e6acfbfd9d683e),
+     W(0xaaad945613d0f253)},
+    0
+  },
+  {
+    {W(0x8d844af85c1fe5ec), W(0x673c41082d221ff6), W(0xc5fab7c5e1d216a9),
+     W(0x441b61798af662b9)},
+    {W(0x455c9dac964f18a1), W(0x7ab722a2944d9182), W(0x867dab4f2b9f811a),
+     W(0x56456edc6ea11fc8)},
+    0
+  },
+  {
+    {W(0xd53befa13bda5b5f), W(0x6c7732d7f7692e9f), W(0x21682b608ee3da8e),
+     W(0xfe58b938040cd10f)},
+    {W(0x2892c85b0bcd2c3f), W(0x26316f54d34b6293), W(0xe8084f60c54f4076),
+     W(0x7a884399bcf0ab1a)},
+    0
+  },
+  {
+    {W(0xe3c393a8963f7e1f), W(0x0cf0632135c11e73), W(0xf0948e67b14f247a),
+     W(0xbe0da54b6ffca9ee)},
+    {W(0x3cec00f6acc8daf7), W(0xf162a218360e49eb), W(0x5fe0f3786a24ffec),
+     W(0xbfbc4124368a7a32)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc75fed65ee77b584), W(0xca523f5334696a94), W(0xd0aa44b2d1d46db1),
+     W(0x34a51ef6a4e00e0f)},
+    {W(0x2d9a298b01dd25ad), W(0xb2677993d9612c49), W(0xdf72f6017cfbea50),
+     W(0x3875caa651aee201)},
+    0
+  },
+  {
+    {W(0x373614fbaf315be9), W(0x652c421b3cfe5b5b), W(0x6393a17f86c0b714),
+     W(0x76b51b91e9f04024)},
+    {W(0x7983229abafa3f5f), W(0x8bd01fbc257b708f), W(0xfbac8e5d738e1e9f),
+     W(0xc7e657c40475a25f)},
+    0
+  },
+  {
+    {W(0xc77a9c6b624659ce), W(0x4cfa45ddc11c66ed), W(0x6cd2f0abf721fa98),
+     W(0xc319d2a105773a00)},
+    {W(0x7b529c2b03780ee8), W(0x39d800dc53fcd20a), W(0x95cbe5b727bb1801),
+     W(0x7cf7b69bfd2baff9)},
+    0
+  },
+  {
+    {W(0xd8c2b1740daf895d), W(0x73d108a66ff59370), W(0xfd0bfceffc35a5c0),
+     W(0xbf3c7a7e72534cb1)},
+    {W(0x87848d09214c9cfc), W(0xadf4bb553c07f690), W(0x5e0ab41c85b373fd),
+     W(0x7d70b14681f666da)},
+    0
+  },
+  {
+    {W(0xa550a0a2fc87d410), W(0x48019c7d5acbf6d3), W(0xaf32aa39c93622b0),
+     W(0xab6589ed59d6edca)},
+    {W(0xe86eedc88727b261), W(0xc3cb4218aa9a2ae1), W(0x57dbb2f52c522a86),
+     W(0x4f56615cd3c40d35)},
+    0
+  },
+  {
+    {W(0x9bfb8f5a320336dc), W(0xe1fbfc73921df07d), W(0xa9995b8cd8620a99),
+     W(0x39b7ce65398fe11a)},
+    {W(0x3272bb2aadc4739d), W(0x27f5075b4771092c), W(0xaf03aedb8380e6e5),
+     W(0xa62264c761f85788)},
+    0
+  },
+  {
+    {W(0x90ca72ea4e7eb613), W(0xa068b04e98bd5c24), W(0x1779efc7898da088),
+     W(0x9e8f97d8408a4fd2)},
+    {W(0xe3b7965ecbd997d0), W(0x94bae95406d9755a), W(0xa536f68ce8d351c2),
+     W(0x4484bc1814e695af)},
+    0
+  },
+  {
+    {W(0xc2fdd8ed4307832d), W(0xf9224c4eca47906f), W(0x4f27eac0017cbd0d),
+     W(0x4541317b21d17bcb)},
+    {W(0x4917023b3ad282d7), W(0x22428dedddf12ac2), W(0xeda22a3ea8a0aacd),
+     W(0x26a134d357d24e9b)},
+    0
+  },
+  {
+    {W(0xbc87b3dfdcad0ebe), W(0x4ae7fededa81ffd7), W(0x7f3024b390435fc2),
+     W(0xc7e6261214b3ebf6)},
+    {W(0x78806f9dd72621b5), W(0xe484812ca13cd8aa), W(0x9e3af36759a799ae),
+     W(0x8491639027a10934)},
+    0
+  },
+  {
+    {W(0x083f6589bb0524bb), W(0x0cc54de006359184), W(0x06503432ad96fdc1),
+     W(0xd0407b8d088e0c87)},
+    {W(0x2a01fb2d3e45147b), W(0xe311e4dd6dd6da93), W(0xb9d65e567824b285),
+     W(0x0e1b4192e89d6c0a)},
+    0
+  },
+  {
+    {W(0x25fd3cb0d4e49372), W(0x5a904ca2326e5a35), W(0x98497e6428969561),
+     W(0x924aa10c7a9c337e)},
+    {W(0x905b3954551a2f87), W(0xce4163f43b81453a), W(0x78209c94775ed9c0),
+     W(0x01b340e442987d7a)},
+    0
+  },
+  {
+    {W(0x6269aee1f02fad0e), W(0x40f14a5e9be76f26), W(0x0f93df26fd6ccf45),
+     W(0xa3aaafc6b81bab74)},
+    {W(0xe7871c96cc898ec4), W(0xc8d4f25300e38c87), W(0x009c4b82b16abb26),
+     W(0x38a2e5a6461decce)},
+    0
+  },
+  {
+    {W(0xf040681337a39dc9), W(0xf1fa5887ee8394ab), W(0x963184c5181f59ba),
+     W(0x3f3529787f70de09)},
+    {W(0x0d7781174c64ca0f), W(0x1638cd4d54263c81), W(0xef5c3c9d5306f0f6),
+     W(0x437fdc7c67297725)},
+    0
+  },
+  {
+    {W(0x2e6691e25614df18), W(0xe95741bd5144e875), W(0x613f1c8c1adfd5db),
+     W(0xb126bf7ab39a8451)},
+    {W(0x2a8ef8e1399ac5d0), W(0xa3450806a108cb36), W(0x3a5632d1e17a4c29),
+     W(0x8fd940e8e077c1a1)},
+    0
+  },
+  {
+    {W(0xa95adbc29ae2a8c8), W(0xfe3bdc02c300d5b5), W(0xaa7e3fcfccdfd05f),
+     W(0x6ff3608df0d5a9f7)},
+    {W(0x9433b6c694de21c0), W(0xea2e6e0a2bfe3cd6), W(0xec9cb2e9e1185402),
+     W(0x18bad7a227f53ff7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x52e23a0ad0eeba32), W(0x25d126e5221d753f), W(0x8e1ed8f091e24d08),
+     W(0x02c62c6dcd9be21d)},
+    {W(0xbca978019532a9c5), W(0xaf2fa26481a6c714), W(0xc9aa988de1b7e65c),
+     W(0xf0a62b0d64c72a93)},
+    0
+  },
+  {
+    {W(0x78945abfdf286b2a), W(0xeb6d71757fa67e5f), W(0x6375c396202f3505),
+     W(0x2580efd26b0950f1)},
+    {W(0x6b00f83cf29e4788), W(0x87919d890b14828f), W(0xea5a49bcc7405444),
+     W(0x016c63a02c32843d)},
+    0
+  },
+  {
+    {W(0xd3dc474e2b9273e7), W(0x61c1874fb1b23abd), W(0xd5f8a93bf4d5e153),
+     W(0xc6bbaacc86060309)},
+    {W(0x8b2695aa0e88984b), W(0x7ac50027de72f96f), W(0x677e0f8c7465f84f),
+     W(0x82a918365ae1aff7)},
+    0
+  },
+  {
+    {W(0x572866930d221223), W(0xf86063c3c4e1ac66), W(0x300bb0767ed8dac6),
+     W(0x316d94219df22d27)},
+    {W(0xf057605d1e931ca3), W(0xeb8fc052a44243a9), W(0x0052ca94258bdee7),
+     W(0x641a364a3b41de91)},
+    0
+  },
+  {
+    {W(0x7a39f2907a3dcb16), W(0x839da77ae47879d3), W(0x56b02f74e1fc739b),
+     W(0xa9383776a82334a6)},
+    {W(0x4d21266657987dd1), W(0x29adcc7195fce842), W(0x14267589595782c6),
+     W(0x510e9d3b85e654e6)},
+    0
+  },
+  {
+    {W(0x3ae6c701bf34e8b0), W(0x0bf3a93422847064), W(0xe1e0e74c8ea2de26),
+     W(0x86c2f8bbfeaac5a4)},
+    {W(0x2a480d20e3bef03c), W(0x52cb289d5e46b6dd), W(0xde8249787fc4e6ce),
+     W(0x5efd6cc3efe0e9e4)},
+    0
+  },
+  {
+    {W(0xde285cf64e6d130f), W(0x167651d4ed016125), W(0x2ed14ab9844b0dd4),
+     W(0x0828637701af3bcc)},
+    {W(0x3452c1a99a1249c4), W(0xe2dca2b51988564a), W(0xc39b0bc45ea96643),
+     W(0x9263c877c77a9547)},
+    0
+  },
+  {
+    {W(0x08288caff10e80bf), W(0x4a8b3c0600eadbeb), W(0x9b6f29e51c980713),
+     W(0x4c18fab47f841d75)},
+    {W(0x2a00bcabff139676), W(0xc1b37d3acdcdb20e), W(0x5793df5594ff5b39),
+     W(0x2e7903dd0d803ccd)},
+    0
+  },
+  {
+    {W(0x3e00e4170b7da037), W(0x4b497db65d31b0fd), W(0x341f41399ca99d57),
+     W(0xe3c943e1b670fb81)},
+    {W(0x8641a057b2fc6843), W(0x0da67fe8e1b928b2), W(0xbf28578be6088242),
+     W(0xfce468146faf8d61)},
+    0
+  },
+  {
+    {W(0x8a696ba44f001484), W(0xc67dae2430830cab), W(0xceaaa4aea3cb20bf),
+     W(0xd9efc2f16950872f)},
+    {W(0x28bd2977f8e8e09a), W(0x9e53b2da4b09a7f6), W(0x5157fcc4b1b8ad8e),
+     W(0x94a61702ddfa7a9b)},
+    0
+  },
+  {
+    {W(0xaa20b748fe9fce9c), W(0x16e1c9f4075e72bf), W(0x5829a00039174d3c),
+     W(0x5f71d4f6bb63dafd)},
+    {W(0xec6ed47db0f5f8fe), W(0xc358df524c49b832), W(0xc4f8ad779e63d51e),
+     W(0x796d7fc3dfa39206)},
+    0
+  },
+  {
+    {W(0x5e8b7e581dab2dc4), W(0x8cd8071f7a91f5c5), W(0x84cd8b47e6138f99),
+     W(0x20e7f052af2654eb)},
+    {W(0xc54e9259d51922f5), W(0xd871c9d38167a771), W(0xd5dd924ae383d00e),
+     W(0xb450e57e388eca67)},
+    0
+  },
+  {
+    {W(0xe12a71b854845463), W(0x7ebaa1c24ba1de87), W(0xbbe2acbba4156d1a),
+     W(0xfaa06d81038a2712)},
+    {W(0x29e92c24ce7c96c0), W(0xd23ae78c11328e74), W(0xd4b93bc8d227878d),
+     W(0xea666248303e4a61)},
+    0
+  },
+  {
+    {W(0x5895a4229065c44e), W(0x05729d73f1719046), W(0xd0a441cedeae310c),
+     W(0xb84e8d5cd79e64af)},
+    {W(0x3745796c683fe2fa), W(0x4074c32afe78bd6b), W(0x5f6e61f64308574e),
+     W(0x5aa5e088ed8b9ff9)},
+    0
+  },
+  {
+    {W(0x2f2be78e0b5d6726), W(0x310a8dded2656800), W(0x86ca2ff9d7e3058f),
+     W(0x5b0d798f25b36732)},
+    {W(0x46a2f1d1cb6dac22), W(0x1670f4f2be986817), W(0xf30e647da0722d78),
+     W(0xbd60229d506e9f18)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0f65f52adb12a1ef), W(0xd9fc7c9e500a563f), W(0x0dd2b85686ed4060),
+     W(0x9af924bef72c1af9)},
+    {W(0x3fdab0955c6b1f4e), W(0xe2efbf13a963708b), W(0xb54ab5de579f69b4),
+     W(0x7db04144323a9634)},
+    0
+  },
+  {
+    {W(0x0a3018af436f2a16), W(0xd5770b8da078c184), W(0x1e65799b83cda41e),
+     W(0xe3118dff45dc5163)},
+    {W(0xe18d705df3b464b8), W(0xf3b38f0a86665941), W(0xd2472de2cf9f0b18),
+     W(0xa30756e323d6f219)},
+    0
+  },
+  {
+    {W(0x5a75dcaf2ef3ab9c), W(0xe3eb3970c9f8fea2), W(0x888298f4275ef099),
+     W(0x39b5629a3919b926)},
+    {W(0xd1a85310132a7427), W(0x67db8173e961db2f), W(0x21ae8020a5f83d89),
+     W(0x65d14eac095ad814)},
+    0
+  },
+  {
+    {W(0xeceaf1b70a3259f7), W(0xda8fd3b8227c64b6), W(0x0a3b75b370092b54),
+     W(0x9d36569d63730368)},
+    {W(0xf9985c2d63101412), W(0x2138ce37bfc61362), W(0xadd1bc16975e576e),
+     W(0x47414e463067353f)},
+    0
+  },
+  {
+    {W(0x9e8d5543464bbe95), W(0xc99b0f4186c44436), W(0x73460bd9d3806666),
+     W(0x0af5b4800db32b4d)},
+    {W(0xd99f0a3f1fbf96d0), W(0x6f2e66dffdac684f), W(0xf8e795df0d9b9303),
+     W(0xecf4204fb6ccf56c)},
+    0
+  },
+  {
+    {W(0x5c7969b5ad27043d), W(0xc783c146b0820d0c), W(0x312e489a5db6a8a9),
+     W(0xce74dd3ef328cd18)},
+    {W(0x612c839a9634cf4e), W(0x34e1d9417d616f90), W(0xe39c32412d00bbc4),
+     W(0xf2f9e6e3593b7803)},
+    0
+  },
+  {
+    {W(0xa07c36c55dc2426c), W(0x6f3615ed5263a34d), W(0x1c63d414f7633eb5),
+     W(0x4950a79dd19ae4cb)},
+    {W(0x96a299ae672ae1f3), W(0xcc6482be5aeace07), W(0xa3b5b0fc8d1550ad),
+     W(0x76e77f688d9feace)},
+    0
+  },
+  {
+    {W(0x91ee3f95f718b957), W(0x1b48c768c393de8f), W(0xc5844342f0442712),
+     W(0x9bbdb56f09f55c62)},
+    {W(0xacd5821fb04eff9a), W(0xd28455a84c3833af), W(0xe434d5f8fd2accce),
+     W(0x17b5475d1f338db2)},
+    0
+  },
+  {
+    {W(0x278a8b27827a4b26), W(0xaa6ee0bb3f4deac1), W(0xa39ca7a65cceeb32),
+     W(0x27b7fd62a96d2118)},
+    {W(0xccc16c7fc167fa4b), W(0x02ff5f64f11d9e9e), W(0xc7495f453b8a69ad),
+     W(0x7beaddb6075e76c6)},
+    0
+  },
+  {
+    {W(0xbbbae67edb656be0), W(0xb4e943a3e212a9a3), W(0x513f51d6e5f64dc2),
+     W(0x7d8ed0e4efaf48df)},
+    {W(0x479404bcb61ca305), W(0xf1a8c09b3dd37732), W(0x168aa5decb527bc9),
+     W(0x03a8c00576cd4e9a)},
+    0
+  },
+  {
+    {W(0x33a135218a63dfa3), W(0x639b3dc015aa2956), W(0x05ce0f7a3fd393bd),
+     W(0x7e638dd3459faf81)},
+    {W(0x6f8bafb0e2d06864), W(0xb1267d5cb09fafef), W(0x1e4ce6f84d8001ba),
+     W(0xb32951e40d63cade)},
+    0
+  },
+  {
+    {W(0xb4c5bf431c428191), W(0x3c545ca69c73c297), W(0x9e2c3a961192e414),
+     W(0x78cbd84ad9f030b2)},
+    {W(0x8f240c83be1e840d), W(0x2cdfdc6e58aa9743), W(0x020b7c7e9957d3af),
+     W(0x427e485ab671986d)},
+    0
+  },
+  {
+    {W(0x72d9a7bbc9a716c4), W(0xc28a3647d59cd1df), W(0x4f04026b081d6565),
+     W(0xb4971b39b21292db)},
+    {W(0xd3d1d39901e2f94b), W(0xa83fa4fb0fa4d729), W(0x6d418b4a286d91dc),
+     W(0x325adb2b9c57e140)},
+    0
+  },
+  {
+    {W(0xd8b3f4674dd248ad), W(0xc6213514edcf27bd), W(0xba9f87c04c36b53c),
+     W(0x2e848a999a27364b)},
+    {W(0x7842e976dd7d6442), W(0xc29ab74b678a67f6), W(0x43ded27e23b9f226),
+     W(0x16cdb93f4faae2ef)},
+    0
+  },
+  {
+    {W(0x3bc31c6043090b1c), W(0xe5b847abe62f65a5), W(0x254dab158f2f1725),
+     W(0xfea985c050c7961a)},
+    {W(0x13896ecfd5dbbea7), W(0x0ef2c5a5c971aba3), W(0xddc95c1b07a93585),
+     W(0x9a5c8f97cb4830c7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x5e0570b6606235b2), W(0xe340c4ae29207af9), W(0xd527a2c607bdef0d),
+     W(0xbb362c3dafdf8bba)},
+    {W(0x7b4fc2a9bd5f0bee), W(0x147ce7591a2956b1), W(0xba7a6b7334124a7d),
+     W(0x3c40c279d15a2323)},
+    0
+  },
+  {
+    {W(0x3f2f49141cd40e31), W(0x90642c13a80c38d0), W(0xd59b1b55c689dc73),
+     W(0x1e39c20628722591)},
+    {W(0x3044180f75b5c993), W(0x1c107c2720d89f98), W(0x132eb88f8aa0f8d4),
+     W(0x7514b4d76462c2e0)},
+    0
+  },
+  {
+    {W(0x033f132c7ccee136), W(0xd7d54ca5101e7655), W(0xae7ede54697b4bd0),
+     W(0x74da46f914b44112)},
+    {W(0x2fc256607e4cbb3a), W(0x3672acd242e4cc85), W(0xa6660e0279c09849),
+     W(0x9185150c485fb022)},
+    0
+  },
+  {
+    {W(0xdd15e68a45daf470), W(0x28b9929d3e223774), W(0xd1b0fcfeabd465cc),
+     W(0x4396df4f311cee67)},
+    {W(0xecb3aff369325ad4), W(0x8a90bd15b33b5d1f), W(0x8fe2c6bce68a4d52),
+     W(0xac51e8b48edf3a99)},
+    0
+  },
+  {
+    {W(0x0fa5c09e956ce121), W(0x833695baa6e78e8b), W(0xce82270fde600687),
+     W(0x6e390c25ad9331c3)},
+    {W(0xb05d89da246a3d4f), W(0xae711914838c1eef), W(0xd8cae58cf1d67085),
+     W(0x325a0777fdade743)},
+    0
+  },
+  {
+    {W(0x5696e8c7523ef0cf), W(0xa4430e1205a39fcc), W(0x8bcef6a8fa2f40a3),
+     W(0x79f892540dda969b)},
+    {W(0xac525965de97dd75), W(0x9d0344ccd23737e3), W(0x1d7b9481cdb0dbab),
+     W(0x572e9e094afd6e49)},
+    0
+  },
+  {
+    {W(0x5854321e4fa3e53a), W(0x2763474348595cfe), W(0x86ad6ff764ee4cbe),
+     W(0xa1ba68170a265250)},
+    {W(0xd2b611926bcae29d), W(0x6c25bfd44e251346), W(0x9c3684cb2e7169ab),
+     W(0xd32f1f6e44563d91)},
+    0
+  },
+  {
+    {W(0x6368c53afa1ab835), W(0xcdbe7bae9c37e6d8), W(0x712d06cc258387e7),
+     W(0xf4fd477a7c975ea7)},
+    {W(0xee2e034badd2c656), W(0xf75a9d1b5a77b165), W(0x78677aec9096a77e),
+     W(0x97454f467baa67e3)},
+    0
+  },
+  {
+    {W(0x542cc6ee1b06f603), W(0x639699ed08d99442), W(0x3e9bd04ee0650c3a),
+     W(0x882e3ba19e1454d5)},
+    {W(0x140a8911fcbee463), W(0xf3dd8bf85027a6a3), W(0xd78a2c36d9bc64b7),
+     W(0x1d84024c699b4ef7)},
+    0
+  },
+  {
+    {W(0x330448124b4b17fa), W(0x7aa817dfb88b97d8), W(0xc17134c9cab7b062),
+     W(0xba623b9a1ac6fc19)},
+    {W(0x34f6ec38eed1be76), W(0xbbd53e1073b90899), W(0x405b7cb568e8f6fc),
+     W(0xe7eb561354632f58)},
+    0
+  },
+  {
+    {W(0x2ae948c40dd84ad7), W(0x089e36da906543f5), W(0x353cfc758e063d82),
+     W(0x63c085334f1290b8)},
+    {W(0xacd53165346a0166), W(0x7e16ce42278522c8), W(0x94cbe8a356ce3dd5),
+     W(0x3454c4616e4a5a49)},
+    0
+  },
+  {
+    {W(0xd60b024383c7d7e5), W(0xa4913c9bbcec1e9d), W(0xd34a09cd81ceb7e2),
+     W(0xbc306a4e4c501249)},
+    {W(0xa9aa2d8611807e4a), W(0x4e774fbeb647cec5), W(0x8a181f7e16835626),
+     W(0x8e87a45b192d3af1)},
+    0
+  },
+  {
+    {W(0x9e30249ae02d0f81), W(0xa4b5e0b44714bb75), W(0x97fd77b5a4a7e91f),
+     W(0xde3fc9c6ba6bee5c)},
+    {W(0x8841e605cbcd5591), W(0x1e55914ce1f7c4c8), W(0x8435358d208c68af),
+     W(0x6591dbe4cd2a63ef)},
+    0
+  },
+  {
+    {W(0x8bd28b3c658beff2), W(0x65f86dd409a6e1ec), W(0x3545dfde8b384cda),
+     W(0xe44b513aa89f3eeb)},
+    {W(0x692b8be6d3cd60e4), W(0x7e0fb256c38cb203), W(0x7e8e6fcccb5357ab),
+     W(0x6ca28e072bc72acd)},
+    0
+  },
+  {
+    {W(0x5af4a5820d446bf3), W(0x772b7fe4d7fed553), W(0x7fcb944e927e6152),
+     W(0x121d2455434d663a)},
+    {W(0x510a3c91d335d051), W(0x500685e2c5ac34c3), W(0xf5884686ab79eaba),
+     W(0xe0e0ac1793db2eb9)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf1b75df774302334), W(0x7a5774f4ddc19852), W(0x75512520360fd321),
+     W(0x535c194b050a14d1)},
+    {W(0x2c3ec10ed2e00af7), W(0x56af0fd3fb80ae6e), W(0x0d232cdcc9ecc58b),
+     W(0x613e63848ace3fd8)},
+    0
+  },
+  {
+    {W(0x9446ad09cf8508ef), W(0x9f3d8f0837e532ea), W(0x83ac877e0a93983d),
+     W(0xfe6d31426bfc58ea)},
+    {W(0x8ce87afbf24093f6), W(0x7f9f78281fdb0cee), W(0xc7cc8678449327e3),
+     W(0xc037dc1eed053dec)},
+    0
+  },
+  {
+    {W(0x7c9cdfddd1e14785), W(0x1734ff74eda6d15c), W(0xd2598eda4ec17f82),
+     W(0xa7b6290e24847d08)},
+    {W(0x20029789888b8374), W(0x8ba68bba60793982), W(0x5f2b4a1f28c7ed7f),
+     W(0x6eaca9dfe4788952)},
+    0
+  },
+  {
+    {W(0x648a1ff57f556fb4), W(0x572b70b9b594c351), W(0x626ccdb80144de37),
+     W(0x1fdcf48dc2535365)},
+    {W(0x27b7119979e3898b), W(0xebbd6857df5f36b0), W(0xfac3bee45d6a2534),
+     W(0xdc3afd8d641e93ad)},
+    0
+  },
+  {
+    {W(0x6d3ba179f587a2d1), W(0xf8271d796751654e), W(0x45eb84409e7e469d),
+     W(0x278da075eda5bbaa)},
+    {W(0xdfe234132f838e96), W(0x1b8c3a067d48204d), W(0xa256ffcbe44a15b5),
+     W(0xadf9ca81957539c6)},
+    0
+  },
+  {
+    {W(0x16c1b01fc60f3afb), W(0xbb27fdd3831def7f), W(0x9486213acbdd9bde),
+     W(0x7476902c02e3d553)},
+    {W(0x753b903efec8f10d), W(0x2dd38f3525630cca), W(0xdae709e3de02aa03),
+     W(0x086fe69b8b105ef7)},
+    0
+  },
+  {
+    {W(0x775d5a99b815e649), W(0x2731a85463d814f8), W(0xeba3db5762b86a4f),
+     W(0xbc4f225f0c54b865)},
+    {W(0x8ab6f7eec121c635), W(0x8fd78ae4ff0b7903), W(0x3b9d5c6ab9664272),
+     W(0x80bef78a7a38b38d)},
+    0
+  },
+  {
+    {W(0x5397bda4808ebc1f), W(0xf9729be33ce8a2f9), W(0x729dcc0533db00fc),
+     W(0x4b78d0dced390630)},
+    {W(0xa136eeef2cf2137f), W(0x9c502dd58b4d49cb), W(0xaf4a7dbfcf029110),
+     W(0xdaa35ce16cbe8a02)},
+    0
+  },
+  {
+    {W(0x1221a0f1e3d62d31), W(0xcf9c9ccdb0fa6500), W(0xcf1c43616bbf0c95),
+     W(0x144ea9d460e55ffd)},
+    {W(0xeff1b80d3e5d4ed8), W(0xe606eb5cf481d628), W(0xa3def48acb475098),
+     W(0xd46166a99a10eb39)},
+    0
+  },
+  {
+    {W(0x1571eb4f370c2467), W(0xe4335bb07fb82b75), W(0x51d5ab7a5a6c898a),
+     W(0xd247f964841a9e58)},
+    {W(0x796a7f54fbffd479), W(0x2e8c589884fff2fa), W(0x1f238f4098f8541d),
+     W(0x36eb1876088bdcac)},
+    0
+  },
+  {
+    {W(0x24ffa743b032d40b), W(0x4b7a495bed43fbce), W(0x9ea931e49eca7333),
+     W(0xd8bd79538a8c1a20)},
+    {W(0x3c52825300b723dd), W(0x718155082696afb5), W(0xb3a99babbc8bf2dd),
+     W(0x7d6e0570884316b3)},
+    0
+  },
+  {
+    {W(0xc13ae27aaaf5633b), W(0x8f7e5e9da97a9627), W(0xc319f3b048edec55),
+     W(0x3c779bf765ed3dfd)},
+    {W(0x1caedeb0bdc31f74), W(0xeccf737af9d802fc), W(0xd0dafb3ee8627ded),
+     W(0x3d1a3fcc0bdc1f60)},
+    0
+  },
+  {
+    {W(0x9eb68c225738a959), W(0x8c1e973e56417978), W(0xa8802bcb2acfd06b),
+     W(0x909d78c15030287a)},
+    {W(0xdd5bfdfe045de934), W(0x1d349b1b9efc7285), W(0x29100ff54df8747f),
+     W(0xe9ad3f634b3122c2)},
+    0
+  },
+  {
+    {W(0xe664d3e3809394af), W(0x7a0033d6b7de44be), W(0x1ac5d6d248e7cdda),
+     W(0x30ae5ee15c51a8f0)},
+    {W(0xc74af296fad7f3cb), W(0xc6f4638108e21cae), W(0xc38eecd1d8329029),
+     W(0xb8edbf3f36eb5bdb)},
+    0
+  },
+  {
+    {W(0xd30f2d7442c8d324), W(0xb07dfdc2d2480b5e), W(0x95fc13f3a22c7f1f),
+     W(0x11efef43b26236e0)},
+    {W(0x84f7cebf2d874b5f), W(0xe42975239cbd71c3), W(0x8367ff7f3c9311bc),
+     W(0x64a471131968bad6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfa7a7ca447e0830a), W(0x10ca4982bf923c8c), W(0x7f341b264eb89fa7),
+     W(0xdad2e00c62580214)},
+    {W(0xf4431edc05dc8064), W(0x9cadff5b3572b257), W(0x4ba505d1846d4e4a),
+     W(0x2c352204d3ee3dcb)},
+    0
+  },
+  {
+    {W(0xaabac3a01ae81229), W(0x090dbd12148e1882), W(0xa85ecbe331cb7aa0),
+     W(0x609b647a128bb31f)},
+    {W(0xbac0683a6630df86), W(0x6464115f1b018227), W(0x3656bcbc355a4889),
+     W(0x016544e2bf83cfa9)},
+    0
+  },
+  {
+    {W(0x1695386addaf95d7), W(0x1c987ab7809ae02f), W(0x891cf742c451d3e7),
+     W(0x86849e365768b696)},
+    {W(0x0696cd51cbbfd204), W(0xbb53a371fed897b8), W(0xe0fe223d8aa620e3),
+     W(0x1b5ee8d952a8f25b)},
+    0
+  },
+  {
+    {W(0x66f8ab1f49b34898), W(0x8abcdb14639542c2), W(0x2bb1c7d369f1d26f),
+     W(0x5f81d57eb38a33df)},
+    {W(0x09ac2fe3b93b7f35), W(0x04fb8aa50495e23a), W(0x1eee24aa827c7e3f),
+     W(0x7abea15264764e0f)},
+    0
+  },
+  {
+    {W(0xcb0aaa027fb566cb), W(0x1a6619850a7ce78f), W(0x4da4e27ff37c5adf),
+     W(0x7681e6730cc939f3)},
+    {W(0xc7f2e4f0c454574e), W(0x9de8a32aa8537580), W(0xe6a9c10210def8ae),
+     W(0xae78232c464719e0)},
+    0
+  },
+  {
+    {W(0xbb1be472ca60070b), W(0xda7cb863e8528806), W(0x1db15b4c118e6553),
+     W(0xa025fdbb65c5d88c)},
+    {W(0xa39d8ef43a386e61), W(0x6d3ec0acdfcfdddf), W(0x2796b244b71d31e6),
+     W(0x2573307ccf115f67)},
+    0
+  },
+  {
+    {W(0xa11cf832253844a2), W(0xdf87f03b693d4fd2), W(0xb61f06996b0eb704),
+     W(0x080a5bd3ac59d2a2)},
+    {W(0x73f596981643cbbe), W(0x10a57d7f4b7ba290), W(0xe4b82c9bd0447972),
+     W(0x404dd6842f43f859)},
+    0
+  },
+  {
+    {W(0xdc0933f40f154082), W(0x827e9dc538f58e69), W(0x2a0d7f9268dec2a0),
+     W(0xd63fb894bd1ad785)},
+    {W(0x98514af51f28a56a), W(0x2da1b2527bc9a0dc), W(0xa9ac1d6954e93581),
+     W(0xc88393292baaaa7a)},
+    0
+  },
+  {
+    {W(0x866e464c37128320), W(0x2f7410a94670c146), W(0x26fb84e49ca05fbb),
+     W(0xe8fd2018b0526efe)},
+    {W(0xdb933b386e1e5a4e), W(0x4661ecfae4857180), W(0x0b96e259fd92f9d4),
+     W(0xaae1c5a00a6796e9)},
+    0
+  },
+  {
+    {W(0xd808e697a0f21b2f), W(0xbef8f782b72f02c4), W(0x4059418811a44d71),
+     W(0xc5cf3ae6825b7a73)},
+    {W(0x4b5d0918505b982f), W(0x317914241c219032), W(0x1cb2e23d65ae9bf0),
+     W(0x6ae5378e54d15666)},
+    0
+  },
+  {
+    {W(0x2fb9d9180fb08a0c), W(0x209a7aecf916a056), W(0x84b5167e076927d9),
+     W(0xa875a4e46f4481c2)},
+    {W(0x85fe4ed8aaa0c8e5), W(0xf40f02087a2920f6), W(0xc1a153c7feb99327),
+     W(0x872694cf8291e9d4)},
+    0
+  },
+  {
+    {W(0x4db17f2a4823dbf0), W(0xe9bc82f52b5f5bcd), W(0xaed897506badbb25),
+     W(0x6cedff2d7deee5ad)},
+    {W(0x1ef06eb64d7752ce), W(0x2e4239e8556ae461), W(0xeee4f80e1349fdf3),
+     W(0x73e89c3da9607518)},
+    0
+  },
+  {
+    {W(0xbf71cfe62f2e46ef), W(0xed32b17f4deedd90), W(0x3342eb359c3f300e),
+     W(0xbf1c02f9ae5f78bf)},
+    {W(0x31096dd26868c4fe), W(0x1ffca07e3f11e10a), W(0x6c691d78cb22c86a),
+     W(0x10e3d71ce8de5687)},
+    0
+  },
+  {
+    {W(0x654909abd4dff547), W(0x8c66403ec419fa66), W(0x2124b18687afb88e),
+     W(0xeb7952f48bdaff11)},
+    {W(0xce66a6b90c15fa2e), W(0x8d022c23703cefc8), W(0x99404ad6f672a2c2),
+     W(0x77afad22609fa85e)},
+    0
+  },
+  {
+    {W(0xc5984c1f0d09997d), W(0xe93728043dc346af), W(0x513bb8d59f952f49),
+     W(0xa9ea747c800feefc)},
+    {W(0x62abfffaf57927b9), W(0xc93e985b4af82d90), W(0x7d0babd934260fef),
+     W(0xc468c8fca0c2dc0f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf18e7aed83f43b77), W(0x920f9627c2aa04da), W(0x6cdbef514a82737d),
+     W(0xa4c4552e6f73484c)},
+    {W(0xd5746e8131d71064), W(0xd3dc3b6a879a4556), W(0xfe97658c8195822d),
+     W(0x029f23dbb5487724)},
+    0
+  },
+  {
+    {W(0x930cc9f740cd9210), W(0x2503f6ab850d3b04), W(0xec506ec3a7ae15b3),
+     W(0xbbc07d6dea31b3d7)},
+    {W(0x7a3b5c0928537f3a), W(0x422e43faf88fc051), W(0xe3124491719b38fa),
+     W(0xceb14c768d876920)},
+    0
+  },
+  {
+    {W(0x38d4bbc00e9a20f3), W(0x894e9aacfd2e38f0), W(0x2da01f5ecd9b4b2a),
+     W(0x16a3865f318c4485)},
+    {W(0xaf5b433bbfa19d23), W(0x25a7b72f4364d1fb), W(0xc95fb6617560aff9),
+     W(0x45f88a2f46c4ad73)},
+    0
+  },
+  {
+    {W(0xa6e7de7cbff4117a), W(0x76f3b8206a0a77d1), W(0xc5d05f86c7a61f94),
+     W(0x203e53eec43c20e1)},
+    {W(0xa0cfb1f92b3123e3), W(0xb9df4a57cd1e0306), W(0xe16f372a0ecfc4e5),
+     W(0x7a4890e1fe4b90f2)},
+    0
+  },
+  {
+    {W(0x06215553f63ab511), W(0x33aa9936bf0024f2), W(0xa6976aa3fe9443de),
+     W(0xbb3a3f6b9cfd96c8)},
+    {W(0x07685d1a5a01db04), W(0x719b19431aff9ee0), W(0x78b18d3336b9d144),
+     W(0xe053504883314c11)},
+    0
+  },
+  {
+    {W(0x7ac6f818ab46baa1), W(0x1a7e6e33612e7294), W(0xe75d4bd784f7970a),
+     W(0x01f7477d109b6bc8)},
+    {W(0x6eaa6485f4f82041), W(0x15bcf8e47253a748), W(0xbdf0ff850e25199f),
+     W(0x7c04d155d38a3a51)},
+    0
+  },
+  {
+    {W(0x4d42e7cade493b9e), W(0x20d44d8bd50a2e6f), W(0x776744dda136cacf),
+     W(0x7076da71b7c9a92b)},
+    {W(0xabbf894e623f74a4), W(0x97a82645198a20d0), W(0xe7cf94a93afc2cbc),
+     W(0x321d0eaeaf78625c)},
+    0
+  },
+  {
+    {W(0x087707925c3cc91d), W(0x046988d7a90cc9ca), W(0xeffafc6704b7b23c),
+     W(0x40bd30de5442d455)},
+    {W(0x0fb45dd1894fa50f), W(0x21d1d9d41d94ffa0), W(0xe173942e9b86eaa8),
+     W(0xce014737fd5c7b97)},
+    0
+  },
+  {
+    {W(0xc32ef561bdba221b), W(0x7337f9d2f1977fa6), W(0xed39e4b6df87c904),
+     W(0x33d38bed4e4b42a7)},
+    {W(0xba067411ac1d51b7), W(0x557fd8cc839580df), W(0xb78c9d10e811e09a),
+     W(0xc88f41c6503fba95)},
+    0
+  },
+  {
+    {W(0x9a5a8a55a5e384f8), W(0xdae2cd6de3f2e164), W(0x1aeca7077fe4a566),
+     W(0x1b4bc003f1246767)},
+    {W(0x0e9b3777efa657bf), W(0x8eab6fe531e2f70b), W(0xbdad590311c1204f),
+     W(0x2e44375b91532b47)},
+    0
+  },
+  {
+    {W(0x1114778d36ff3e85), W(0x20c0ae5934666923), W(0xd26327050cd3fbad),
+     W(0x8425117a0fe20d2d)},
+    {W(0x6357f5265d9c1135), W(0x15d71312ce4a2395), W(0x039e9cb25e9c2710),
+     W(0x52fdb2b344b60831)},
+    0
+  },
+  {
+    {W(0x9db65fd6274b92be), W(0x42e75c225a4e03c4), W(0x44d3dbfd71b5eafb),
+     W(0x88d0b648103fc758)},
+    {W(0xabfd2e781fddcb14), W(0x97dcfaa2495cdc3e), W(0x40bb734cb2df3ef2),
+     W(0x31b480bd09534fd4)},
+    0
+  },
+  {
+    {W(0x2c71da306b86a3b3), W(0x1e12a3a99a09fed7), W(0x0a2db3dcc7384cdc),
+     W(0xc02178255e36f8a6)},
+    {W(0xe24dbd758ede307f), W(0x2facc912ebe9f510), W(0xb61be98796182ac0),
+     W(0xb620848e02763251)},
+    0
+  },
+  {
+    {W(0x07d39023c0cc511f), W(0xf7d258717edd108a), W(0xc8c5e7c964c9384f),
+     W(0xd757e952fd2a3cd7)},
+    {W(0xfdf4cdce5dc5a281), W(0x44eb15e5ef172b0d), W(0x4ae215cd3a527fa8),
+     W(0x894e93fc799d07b9)},
+    0
+  },
+  {
+    {W(0xf1b7e242cd4f3698), W(0x1a6bf1730f5938c1), W(0x3b63b49081993de2),
+     W(0x85339f495142c9bc)},
+    {W(0xe26a056d2cd76fda), W(0xb256a6e96fcc0a94), W(0xd16bfc926f3e73af),
+     W(0x7803a77f888c44e8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xf39b64b8d7ddf9c6), W(0xd45385b45d569f45), W(0x664a3cc47bee2c10),
+     W(0xe8dc0a927a85dcf2)},
+    {W(0xc52cb3b7fb9f2d66), W(0xbdbfd7c69b383fd9), W(0x2e68030445354223),
+     W(0xd28024a20f793d28)},
+    0
+  },
+  {
+    {W(0xb3b41b05ea3c920c), W(0xd89b5c9779d9852f), W(0x9d28072a5b5e3864),
+     W(0x42da1975f844faa6)},
+    {W(0xe79c488fcb8fddba), W(0x1f657cd648a7736b), W(0x886b0cf6f97fb64f),
+     W(0x5149b5a476a28a3c)},
+    0
+  },
+  {
+    {W(0x2d5227d97ae039d4), W(0x568b6907cf8809fe), W(0x8aad94e4c236afe2),
+     W(0x6425f1df73349590)},
+    {W(0x651576fa705c1877), W(0xbd33cd65a5863955), W(0xad74a1422da96aa8),
+     W(0xf6b257b859cfe828)},
+    0
+  },
+  {
+    {W(0xdb79ed3709e7162c), W(0x44616839210d92c6), W(0x5b031f2263dcb460),
+     W(0x3973c3a21f0a91f9)},
+    {W(0xe3a171c34fd105a2), W(0x90e8b6d77415e7ba), W(0x85b1245085cb608f),
+     W(0x1c34558c6cef3a42)},
+    0
+  },
+  {
+    {W(0x0b3517a5c0818eb0), W(0xb2542758494eacb4), W(0x29e41540cfe65976),
+     W(0xef748f19e9e754e0)},
+    {W(0x408c7c005404417d), W(0xe9e1e58324a02cfb), W(0xdf4d2a8c389b9621),
+     W(0xb0567d0c5aedafdb)},
+    0
+  },
+  {
+    {W(0xa51a11b8209724ed), W(0x00a8bff0e207e04e), W(0x638f380782fa05aa),
+     W(0x9b4c5fc6d78566da)},
+    {W(0x0cc03a3846eeca00), W(0x9fa888d2fbb8afd2), W(0xeb5fb433c79f1b26),
+     W(0x6d14808f9e129651)},
+    0
+  },
+  {
+    {W(0x4094addea105287b), W(0x9e6c509d8357e768), W(0x1aca32cf66b37f54),
+     W(0xe9d461b68101b4bb)},
+    {W(0xf7872c9e5c20b957), W(0x9c3b467f7c9a4e10), W(0xff264216a2f3f3b2),
+     W(0x543fb55a685cb72e)},
+    0
+  },
+  {
+    {W(0xba072db16bfb7d2b), W(0x47d37598cd530741), W(0x436511603c42d1f7),
+     W(0x56246f5ddf7ad0f0)},
+    {W(0x8fb015ac61e482bc), W(0x0d85d7a7349deadc), W(0xd1c9cb04dbe87257),
+     W(0x7fafce4d991f4753)},
+    0
+  },
+  {
+    {W(0x62ae7a24d78f26d7), W(0x6c113b30f2d15d50), W(0x482071bfd19ca3ff),
+     W(0xb3a5e1bd41df09e5)},
+    {W(0x4a81f89b67bda76c), W(0xfcc0df033996e5ec), W(0xa9074b203e7e78f9),
+     W(0x6918bfa8c14701cc)},
+    0
+  },
+  {
+    {W(0xd978d0fa08fd44f2), W(0xc9b85d56fef8db02), W(0x682e9f40eb26f6bf),
+     W(0xff56e0628fc0101b)},
+    {W(0x355d60b86712e47b), W(0x170e53e08d4fed80), W(0xdb981baf59920715),
+     W(0x7ebd402e1bb558e7)},
+    0
+  },
+  {
+    {W(0x4a7075e3fff6db9c), W(0x79be71ba291f63f2), W(0x825ed7df28ffde18),
+     W(0x720ce45b7629e39e)},
+    {W(0xecc156384ff254fc), W(0x3a4a57a9231889a3), W(0xf446a63cafd5e6ab),
+     W(0xd76d53c0f1551759)},
+    0
+  },
+  {
+    {W(0xe23614236091bd5e), W(0xb40c49439279b066), W(0x22c5bfa73970101f),
+     W(0xae8f4627c1b6c2d1)},
+    {W(0xcade5d9f40ba3a82), W(0x61d1595c27d25efc), W(0xa97a8005a8fd2f0b),
+     W(0x70dd16ea357d24c9)},
+    0
+  },
+  {
+    {W(0x6a72479107c2246a), W(0x916d9461023e343e), W(0xd059e73a40c1b036),
+     W(0xf1ba286c57004d40)},
+    {W(0x156b21387c58f851), W(0xbf7b05c613bb40e1), W(0x98d7b806b5a5b826),
+     W(0x11887fdf350fea85)},
+    0
+  },
+  {
+    {W(0x4cf55c568cb3f2cb), W(0x026e01948d4ac7fa), W(0x1747c0c79041ea3c),
+     W(0x8d767d890a8a8271)},
+    {W(0xc2aec1b478e39cae), W(0x5df7d2eb703aac8f), W(0x7b709ab064cfaceb),
+     W(0xf99ac4ba5425d71d)},
+    0
+  },
+  {
+    {W(0xe8d689cd372ccbbe), W(0xa89c217d8dc0214b), W(0x6a3630f111b7de70),
+     W(0xa327890802ba3d87)},
+    {W(0x406961ac6fcf2edf), W(0xedb38547dd915b4d), W(0x89809c4c78b37704),
+     W(0xe4ea50739460e5bd)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb37b0a32788ddfa9), W(0x195e96ff22de8830), W(0x6746a7a8e9970a54),
+     W(0xf831020432c3b8e3)},
+    {W(0x8f88c4e569d78b56), W(0x552d969932e19cb5), W(0x0992234575856adb),
+     W(0x8d8e9c907f98d51e)},
+    0
+  },
+  {
+    {W(0xf71b570de7d2dd53), W(0x1b3f2bfae66c00b0), W(0x79966be0e0035164),
+     W(0x34973c74f446dc7d)},
+    {W(0xf5d6eb2511f54954), W(0xbf2b50ccfa3d438f), W(0xb2ec85c56c64c70f),
+     W(0xf393648b48be0622)},
+    0
+  },
+  {
+    {W(0x9d6900342e08da84), W(0xf5b19b0f5910338b), W(0x3fc4466e1fa0bc39),
+     W(0xca53dc42f1112f63)},
+    {W(0x92aca6d663a3dc0a), W(0x8dcedb909419064c), W(0xf9fa275d3a91d432),
+     W(0x7e0a58c7eaa0d1d8)},
+    0
+  },
+  {
+    {W(0xddd3edb4b676803b), W(0xdb1c89891f133225), W(0xd126568de0d8bab5),
+     W(0xb5ac5b4fecdc8566)},
+    {W(0x722ff7a08f3d8f23), W(0x36c915e9f10be28c), W(0x2fbb05c2aafa221f),
+     W(0x68ff90a1023ccb2a)},
+    0
+  },
+  {
+    {W(0x0ad176718b8e24e8), W(0xe32d77d002b1cea8), W(0xe0d299e160bd4d38),
+     W(0x1bfba2ba6c91ec2e)},
+    {W(0xc088dd8b70d20a36), W(0xfdbf6f481229f50b), W(0x92c76498be6c6296),
+     W(0xe683842b9dc37f91)},
+    0
+  },
+  {
+    {W(0x8afc20fc4d476783), W(0x9d537b0c4f4a4105), W(0x2777c5b3d4909288),
+     W(0x4c171ecbd86b966d)},
+    {W(0x78434d758aecd3b1), W(0x42ff5d513c3c750f), W(0x694d185fd09948b7),
+     W(0xf04ac838f3b49dae)},
+    0
+  },
+  {
+    {W(0xd22f6193557c6f06), W(0x1e63aab135632c35), W(0xe29bf3051937f1c0),
+     W(0x0b4663637a50026a)},
+    {W(0x366f11b217981c5a), W(0xd6ee7b2f519754dc), W(0x5a97284a307d0e67),
+     W(0xa557ad4464b277a0)},
+    0
+  },
+  {
+    {W(0x5eb45bc6bd99aa45), W(0xa6d3f368897f9d2f), W(0xb0d510790ef0a6d5),
+     W(0x61824a1596060347)},
+    {W(0xca274dc3f4aafaad), W(0x18f0d11430c72081), W(0xc5655c7887c9b89c),
+     W(0x1aa6ec7c35cd57c7)},
+    0
+  },
+  {
+    {W(0x46bd9fa7cdda4e80), W(0x70370d7dcbc0f2a4), W(0x3973fb1ceb29a60c),
+     W(0x7981116c6231d5c7)},
+    {W(0x85103428d602afb6), W(0x81f0c2085cd4ac6c), W(0x4f8b17d315c1b416),
+     W(0x44b41162ab6f98d9)},
+    0
+  },
+  {
+    {W(0x294be79ff259bad6), W(0xcb398d5c1436d2c9), W(0x1027daf9fd5cf185),
+     W(0xf8d453573d66e1be)},
+    {W(0xf2eb11cc5e06a15c), W(0x9622cbb6d7b022e9), W(0x10ec7a69ec51a8b6),
+     W(0x8fb4fc2e2edb94f0)},
+    0
+  },
+  {
+    {W(0x2453a284d07a0e64), W(0x9213658c2cfdc2ef), W(0x9a244f4a9d01ad31),
+     W(0xc425bb80c8b15211)},
+    {W(0x9b8002cc4fa2620b), W(0x28bbf261c7507557), W(0x0073dbd35c049d63),
+     W(0x3ab8e2b848d8b4f1)},
+    0
+  },
+  {
+    {W(0xb92fa4115e83de5d), W(0x3b033c3a2e415b4a), W(0x8937cdd2a212891f),
+     W(0x87ab5784e004d4e6)},
+    {W(0x76bd5e58c88a1067), W(0x47e43f3d7f7e532d), W(0x7d5ac06afcd17d34),
+     W(0xffd5cb79692ef144)},
+    0
+  },
+  {
+    {W(0xcd4ea6efe7159cf5), W(0xc905c7d3dda7e74a), W(0x404f325c9f7845c9),
+     W(0xdd3f6793045d2825)},
+    {W(0xa169aecaf3b8412e), W(0xdc57caa3d9b038dc), W(0xac53fe9d0ba059d8),
+     W(0x417db31d2d5104e5)},
+    0
+  },
+  {
+    {W(0x58073626985b3451), W(0xfc95b82722c94e35), W(0x59c0f6c327395e42),
+     W(0x9df08ee60943d33d)},
+    {W(0x448e23a0e8a08922), W(0x7086aff372281cde), W(0x72d0e7c0cdf01d2b),
+     W(0xb43c3a98e51b1b9a)},
+    0
+  },
+  {
+    {W(0x106ca52153d02dec), W(0xcc64e77f981875aa), W(0x9eebc562a7dd017f),
+     W(0x4995637fe6b5a1b0)},
+    {W(0xb9443e490a4ca9cd), W(0x0c2cb41c17946d86), W(0xd5c01d6429c7ecd1),
+     W(0x9b98317002f0168c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x3fec6c68362051df), W(0xa47f4d3c459344fc), W(0x2b2dce3d4600aeae),
+     W(0xb011fb6752b87527)},
+    {W(0x32935ec3038a287c), W(0x3a4d78bdb04b4e6e), W(0xea091adecf457bd2),
+     W(0xc1c5eaf4400262a9)},
+    0
+  },
+  {
+    {W(0x2c44142027bd7f11), W(0x6a81357ffb60b0c4), W(0x9aec5c76435c0494),
+     W(0x81de8d9b6c5a26e0)},
+    {W(0x4ee94721c0994fd6), W(0x0a064d0834a8f772), W(0xce0a4697d0d19c37),
+     W(0x17e69edf17fee1a0)},
+    0
+  },
+  {
+    {W(0x8cef90eaaa0712c8), W(0x63f22ec88a21e8a1), W(0xf91ecb5e6d353500),
+     W(0x71ca73c87c42683d)},
+    {W(0x75137bac9f32ee95), W(0x41ffd6176513060f), W(0x7262be928ede1944),
+     W(0x828d85ece00a0f74)},
+    0
+  },
+  {
+    {W(0x607d9ff50d97e720), W(0xb2f45187d58ded63), W(0xc3c9a473cebddda5),
+     W(0x158c5ffa9f2a826a)},
+    {W(0xb013c632c9926a4c), W(0xb77ff183fd9cdcdf), W(0x10522cf960f2a870),
+     W(0xec9cb27b8b785dd2)},
+    0
+  },
+  {
+    {W(0xd2b1abd0725375f2), W(0x1fa635f446c867b1), W(0xb3304871863a1cea),
+     W(0xa265d18509b7d3ab)},
+    {W(0x0fa39fb356664e8d), W(0x43d06fec9e0f7724), W(0x1b37713b04fe4f51),
+     W(0x50577d0658b84388)},
+    0
+  },
+  {
+    {W(0x31acbe45d6454f35), W(0x1960fc7c612f9278), W(0xbc92c2e18787406f),
+     W(0xb7a68eefbb7fd664)},
+    {W(0x0310bf1eccd10dad), W(0x9cbbaeaa8dcfcd2d), W(0xf0a24cc778d1cb8f),
+     W(0x52d8544bb29ae8dc)},
+    0
+  },
+  {
+    {W(0x734b6f6dca73317b), W(0x12cb5e5ba4babd91), W(0xa91030a54a88b5ed),
+     W(0x72cc58e9f88e727e)},
+    {W(0x2c7212c27360895a), W(0x0d9342f2dc9680f5), W(0x666f125b8d92b570),
+     W(0x7ed1dcb3c8b4cced)},
+    0
+  },
+  {
+    {W(0xb61c560c093e7b88), W(0x1a071d2c7836b6af), W(0xefff0cb78744e2ba),
+     W(0x64e682411d98c1b4)},
+    {W(0xcd6960eb255b2058), W(0x49ab8da44fbea5d6), W(0x187e10633be9fc79),
+     W(0x8a1b1e05608c2ed2)},
+    0
+  },
+  {
+    {W(0xc4a9572864d35a6f), W(0x47fb99664fe25244), W(0x090bbd8ec12d6b52),
+     W(0x678b1b04865d10e7)},
+    {W(0x8469317db1d4a5a5), W(0xcb72065c89ac0529), W(0x8d8a65b58f79da1c),
+     W(0x7e1f21747903d2ef)},
+    0
+  },
+  {
+    {W(0x247528a8739e28c6), W(0xa6e7c34321fb9be3), W(0x66cfb9784ae78090),
+     W(0x130b27eb47b9f9e9)},
+    {W(0x961078842e90efa8), W(0xcdf572bce0d55cb9), W(0x9460c05ee9b4ec4f),
+     W(0x7b6edd7aaabd2370)},
+    0
+  },
+  {
+    {W(0xe1be3a1befbaaff6), W(0xf9a721df8b217761), W(0xc644df888ee90a60),
+     W(0x2f1f20901e3c3b7b)},
+    {W(0xad2354e3b2bb7c42), W(0x616d44e274079b6d), W(0x2c87c557f6404357),
+     W(0x7a524ba26cf04635)},
+    0
+  },
+  {
+    {W(0xcec02d4ad37a3508), W(0x4c782e5b74c5ba0a), W(0xb8af8ee57791431a),
+     W(0x1ce27b63b026ec5d)},
+    {W(0x555b20ca3700700b), W(0xcba9b26aedc5d245), W(0x0b7b9673b6c8475f),
+     W(0x42c8378bac0e1f8d)},
+    0
+  },
+  {
+    {W(0xbcdcd457b36902db), W(0x9ac2f6e2929db6b7), W(0x6feb05bf57b0f53c),
+     W(0x7f07dc50d79f05b6)},
+    {W(0x7ea8c6242dabc701), W(0x83eb09c44c0d0a3d), W(0x2bcb706858813cb0),
+     W(0xd19a77b526db3866)},
+    0
+  },
+  {
+    {W(0x11b7982b249c2548), W(0xceb2f933f0e890bb), W(0x2d5af7004c6f241e),
+     W(0xabdede02532c453e)},
+    {W(0x98e7ad32ec558f2d), W(0xeeef115096611dc3), W(0x9859a023c18eb9fc),
+     W(0x9898d696ee6cf71c)},
+    0
+  },
+  {
+    {W(0xb1f2b4a173116cd7), W(0x521336e169d4635a), W(0xf7441e7e69fb4a28),
+     W(0x7e1b856228649715)},
+    {W(0x197986811e5e60f2), W(0x88d44bc0d50c0b67), W(0xbaf10ef323f8170a),
+     W(0xd950263f5d81ae92)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x0f9d275d3b9955d0), W(0xf1d4a4e11c8821fb), W(0xa68b3db0772fff7d),
+     W(0x44e88d514ad0157e)},
+    {W(0x30215fb5b2cd6a45), W(0xbe06c395cc8b83a3), W(0x65939879278783b8),
+     W(0xa2afb709cfdf1c78)},
+    0
+  },
+  {
+    {W(0x59e0e25e9f786bba), W(0x84ccee5ef569f776), W(0xdb3cfdd8c65e8e91),
+     W(0x6e8356b1204b9083)},
+    {W(0x542586a51d352666), W(0x85dffa611efe1b23), W(0x55cb76cd08e848ae),
+     W(0xc0a2e3458cdf60c7)},
+    0
+  },
+  {
+    {W(0x03b3ed03d60ac5ee), W(0xd7ff1d19774f226b), W(0xf3023f78974fce02),
+     W(0xbc7a21f14d58863a)},
+    {W(0x11f20287afa49904), W(0x38eeb5cacb652fc9), W(0x36f83dba60968927),
+     W(0xa277fb42b1f816e3)},
+    0
+  },
+  {
+    {W(0x4ded7eea33fa7cc4), W(0x46d343384878a57e), W(0x3886e71d3ca03752),
+     W(0x89b88f81fb64fd08)},
+    {W(0x63b59d57d01cfcc7), W(0x59b5489f92395b98), W(0xfac7723385f9b49c),
+     W(0xfafc41aa5278f731)},
+    0
+  },
+  {
+    {W(0xf15ee76e586fdd0c), W(0x0312aad9c3e7e467), W(0xade1974dc8f701b0),
+     W(0x0ed28eb1ed1cd6f5)},
+    {W(0x38294a8eae84c01d), W(0xf92455fed18640de), W(0xbcbb94b2012248dd),
+     W(0x1501fcac56144cf7)},
+    0
+  },
+  {
+    {W(0x3b5f167b0998809f), W(0xc3e839432a2f571d), W(0x8549ba82e7b0d324),
+     W(0x7b06a63a696a7f38)},
+    {W(0xced578da35449b93), W(0x4ea9415e3cc159fa), W(0xc3ddbda557b90f18),
+     W(0x24fdf0788700badc)},
+    0
+  },
+  {
+    {W(0x2f290b5f6b36ad4f), W(0xe6f761905cb095e2), W(0x293954833b554ff7),
+     W(0x8554594099764874)},
+    {W(0xff1214b87450a88f), W(0xbc9cb6de59e88b1a), W(0xa9e067ad8bfdd7a8),
+     W(0x78aa457fb28f7d79)},
+    0
+  },
+  {
+    {W(0xbca63e99d1b71f70), W(0xc32ead3445b80826), W(0x40cdb35ef22ca374),
+     W(0xf3345d52e3eca583)},
+    {W(0xb7ac8953eec9a46e), W(0xa53937d5f9e6d29e), W(0x6f368183e1f8a6fb),
+     W(0x9d8c3243806a8abf)},
+    0
+  },
+  {
+    {W(0x00e9d75158105d71), W(0xe344d48e3e96afb8), W(0x623e0712c908733a),
+     W(0xaa6414f426d8fec7)},
+    {W(0xfc5796594cd83aed), W(0x157c367514f9fefa), W(0xef32812472010716),
+     W(0x07462442f2d6917f)},
+    0
+  },
+  {
+    {W(0xaa14fb9bacebf496), W(0x58f2f880cbe699c0), W(0x105528cd6bf89e82),
+     W(0xda7b7322d55b006f)},
+    {W(0xa3cef58682c3dacf), W(0x2ff1545670a1273d), W(0x58cd4d4f638a7b71),
+     W(0xc4b57b876658d510)},
+    0
+  },
+  {
+    {W(0x82700fc746f5d5f2), W(0x4b0e04c304989cd2), W(0xd639b5216f5af46a),
+     W(0x44ea1ef20fc2691f)},
+    {W(0xf13e00fd0714f7f7), W(0x633c40d671d85df3), W(0x6f6f7238dee21d7a),
+     W(0x6290f02e59028409)},
+    0
+  },
+  {
+    {W(0x7a082dab949a818a), W(0xabeae732df117a78), W(0xaad6b6a4125cf9d5),
+     W(0x6f2239aa64782727)},
+    {W(0x713d2218085f79e7), W(0xd41f57ffac131fac), W(0x284f357ab3ae0e8a),
+     W(0xc0d1edaf38dcc8d4)},
+    0
+  },
+  {
+    {W(0xa8eebd56b2e7248f), W(0xcd19c75b3c58b696), W(0x07e73d524547a82e),
+     W(0xd071257288fb8706)},
+    {W(0x40cdc6df31ea9870), W(0x495d9a1f162e376a), W(0x8949aa22887ac539),
+     W(0x29df13d59bc583d6)},
+    0
+  },
+  {
+    {W(0xae79957a68ca18ef), W(0x6de025259ab6c63e), W(0xda98b352b420e61d),
+     W(0x1ce29a57a1886a2b)},
+    {W(0x770ac62b298eb07a), W(0x77240b6cbe0e4efe), W(0x014fc42dce345bd8),
+     W(0xbbfadb415a088737)},
+    0
+  },
+  {
+    {W(0x3b282d579292a792), W(0x1f707c79c6eb072b), W(0xd003564d9c377f4b),
+     W(0x5c24640f0d238b8c)},
+    {W(0x5d6b2907c761f342), W(0x3d2ca5e5c9410e62), W(0xd6460004828d9724),
+     W(0x5f4534a9c6bd3f16)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8143df731033b53c), W(0x68a707c066e26976), W(0x6137bbb39f632135),
+     W(0x3dd0766c53d7671d)},
+    {W(0x5911dd901ae41b8a), W(0xf03b9577d36dda61), W(0x54b05a758124e895),
+     W(0xca3d029377ae9102)},
+    0
+  },
+  {
+    {W(0x7ebb859b31374f15), W(0xa0c99e14ef252dad), W(0x1e7986cf67ece5e9),
+     W(0x5da0ead591977b66)},
+    {W(0xa649c74409327227), W(0x872a712d54749258), W(0x726afe793200c5f4),
+     W(0x0e2bb0c1afc17f8c)},
+    0
+  },
+  {
+    {W(0x0a7aadacaee278cd), W(0x0bd37337e72ce5b4), W(0x35c08cbd8d21921d),
+     W(0x7d701cd28d87ed78)},
+    {W(0xd5c6546c0d2a3e10), W(0x37a50ed407beebb1), W(0x00da46ca081d9414),
+     W(0xd36cb2d608750cc1)},
+    0
+  },
+  {
+    {W(0x9cd93b4fa7c105f2), W(0x3f726d9dda99164a), W(0xc712c46bbf4a949c),
+     W(0xe59e6eacc37256b6)},
+    {W(0x15cd9bb1690f6301), W(0x4651e3ee12731855), W(0x1b89ff18afef0287),
+     W(0x828f05f38cf8ef33)},
+    0
+  },
+  {
+    {W(0x6d751750a19f5ecc), W(0xf746551a2ffb4cd5), W(0x5575864fdb08923f),
+     W(0x3f2f7c398665e82f)},
+    {W(0x65043ac6442974f8), W(0x0391f9f5bcb68cad), W(0xda680e7fba87e2b8),
+     W(0x2afd930342e930ba)},
+    0
+  },
+  {
+    {W(0x99581231d6a50dfd), W(0x04685a7ce0417fb3), W(0xa008475d208b5fe3),
+     W(0x2c4c429b6410c058)},
+    {W(0x79e4fd13310092c3), W(0x7427d01f6d1a521e), W(0x147eccdc3df97d1a),
+     W(0x47855f0183dfbd77)},
+    0
+  },
+  {
+    {W(0x1152001b9e88441b), W(0x30591910c44d3b26), W(0xcfc94cb496a352e1),
+     W(0x2cc7dec2bd6c3797)},
+    {W(0x54a07dc35e2ff1c4), W(0x49a8ee2dc85cca42), W(0x697ef96d7193b71d),
+     W(0x9d45f02afe87cd2a)},
+    0
+  },
+  {
+    {W(0xe94fe04233a02c72), W(0xdae4fcc28fae1141), W(0xe72a038a3f2e6273),
+     W(0x9a1ce36d6a25d515)},
+    {W(0x8153e8a1fd073863), W(0xf2211bd25172d501), W(0xc124656ac53b5a95),
+     W(0xc8053ff736f92d75)},
+    0
+  },
+  {
+    {W(0x067b7b108febcf5e), W(0xeb3fcce7208bfa77), W(0xc0e0175d67af65be),
+     W(0x5eb9d84e164d8ea7)},
+    {W(0x0169066714a9e76e), W(0x57f5f68474c61d59), W(0x198f2e48eb94a610),
+     W(0x0b88d51791158c30)},
+    0
+  },
+  {
+    {W(0x33355d5a5cb0881c), W(0x5fc4d9d6d5273f5a), W(0xc453efa62d9b2d7c),
+     W(0xcdb8ebf231188a46)},
+    {W(0x6a704b59e5518189), W(0x429234b8063e64cc), W(0x40cffa7b14ef1233),
+     W(0x0aa0f353690fdb56)},
+    0
+  },
+  {
+    {W(0x3f8cde8e2521ce45), W(0x510b6a8bec4942ff), W(0xbbb39f04afce2ccb),
+     W(0x960703d0559020ed)},
+    {W(0xd4651a4ae1b12708), W(0x5809038d24706ea0), W(0x7f27695a6aa6c339),
+     W(0xe4de213cba5bee29)},
+    0
+  },
+  {
+    {W(0xd942b5c3a7aeff39), W(0xbffa3ee2468e22d2), W(0xf4775f870ddcc978),
+     W(0x96e78a1d8f0844a9)},
+    {W(0x612366d2ad39cf64), W(0xdb6c2d0eec0b0759), W(0x0e1bf6810cdb5a23),
+     W(0x7f66d1d9c8f61745)},
+    0
+  },
+  {
+    {W(0x0d44c23c478869f0), W(0xdc0d8e26d04d4d92), W(0x5b7c791a4ae8df21),
+     W(0x9fbc3ad13253089c)},
+    {W(0x8250a7aea664c343), W(0xf3bad3bf54188afc), W(0x5a9a8eec1816f0e8),
+     W(0x4452fefefaa16a39)},
+    0
+  },
+  {
+    {W(0x7c9a86ef341e8e52), W(0x699c4badc6c0c9f4), W(0x4c05825e5891e000),
+     W(0x58018554964c8893)},
+    {W(0x7de94fef851ab0dd), W(0x6a7d4201b95cc821), W(0x4049097dd78e9023),
+     W(0x643d2c221ae13d00)},
+    0
+  },
+  {
+    {W(0x0f774c69b768532c), W(0x97d315b041c22b98), W(0x45205b150cab032b),
+     W(0xa0100aa07867cbd2)},
+    {W(0x0d3e88f5777e3715), W(0x43b2b9f0f610f80e), W(0xe346310874a98059),
+     W(0x404842048e59c2ce)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x627d47f0f02f3c7f), W(0x90ef4f98de1836bd), W(0xbc213bc1037ab96c),
+     W(0x68a85d1c081136bb)},
+    {W(0x118d9406b2416e55), W(0xa141225e9cc314d0), W(0x789a1ba17b11b196),
+     W(0x913dc0847e118e33)},
+    0
+  },
+  {
+    {W(0x72b4f8211fc992a2), W(0x978e8dffa6b4a84a), W(0x5675e4b46c376e65),
+     W(0xea7ecdd912adfa1c)},
+    {W(0x2716fbfa015c63ca), W(0x5cf2d9d8ffc2525d), W(0x0486116b65982e03),
+     W(0xb1efea6ea4391e19)},
+    0
+  },
+  {
+    {W(0x0cc5027987732723), W(0xb9c6bb3e558feefa), W(0x1bcc46caff0b193a),
+     W(0xcdc0a8c8cbd69b3e)},
+    {W(0x41eed8caea79f2da), W(0xe8ace5f3255e53b7), W(0x395a8fe488ccf86b),
+     W(0xd216328b20ed30ef)},
+    0
+  },
+  {
+    {W(0x6182edd77bb8f7eb), W(0x0c8ff597fd42abaa), W(0x5a70613f2509587d),
+     W(0xf1021c86c3065d12)},
+    {W(0xc2f6f6f1a4400c71), W(0xc223cd9bb1534643), W(0xeb80c17347a2a271),
+     W(0x819f5c66085c5509)},
+    0
+  },
+  {
+    {W(0xbcc615ec0f9ab359), W(0x1aa2882db2c6164b), W(0xfb149a32f655391c),
+     W(0x7ca3089ff65236d5)},
+    {W(0x7c4cfe2716c28f40), W(0xf79da06c0fa0b7c2), W(0x94f42fa6034e0a16),
+     W(0x7ab3f95fe38de64b)},
+    0
+  },
+  {
+    {W(0xe12cd1411ae39054), W(0xfa03dec7ec48169b), W(0x9a7e5f54ffd4e32f),
+     W(0x9fca095195d1e91d)},
+    {W(0x4926b7f3e9d89d35), W(0x8482378f78d87706), W(0x01fbb845037c6654),
+     W(0xdf0a2f7c23e2f8e9)},
+    0
+  },
+  {
+    {W(0xd78c87b6eb8cbf0a), W(0x58159265f83dab15), W(0x9514e9e33151f64a),
+     W(0x1c88c3f00f1b5bb6)},
+    {W(0xdc4aca8597b858c7), W(0x10ae8cd30edd4865), W(0x1936de9d1bc6cc91),
+     W(0x00e1ce30e20418f8)},
+    0
+  },
+  {
+    {W(0xe389017f4f09f267), W(0x486a41c6685428b5), W(0x41b004a9df51c763),
+     W(0xf870a9d5d14d921d)},
+    {W(0xca0b73a41a697050), W(0xdc946697782140cd), W(0x9d1b51dd70307904),
+     W(0x6a63bc331d479e44)},
+    0
+  },
+  {
+    {W(0x8842b93f198b70ec), W(0x8456d8d35e6b08d9), W(0x6cb1d7d31572c484),
+     W(0x7000349567431265)},
+    {W(0x18ed2b855ee22eba), W(0xdf67a5b06c2ee3b1), W(0xdeac1b5a3a2e397b),
+     W(0x283c0ba2fdcf35e6)},
+    0
+  },
+  {
+    {W(0xa59fc3a2b6459b3a), W(0xe250959bbef1b229), W(0xc026742da3bed517),
+     W(0x7d7553df798445d2)},
+    {W(0x02e2fd2d2f2502ce), W(0x29b8d8a840b659a1), W(0x8d613221c69db053),
+     W(0x8aacd4bd303c282b)},
+    0
+  },
+  {
+    {W(0xbde916be42b99184), W(0xb86814e936d83c83), W(0xa8815bdbb98f04d1),
+     W(0x2fe27ab62741cf5a)},
+    {W(0x37ccc18a0b8928b2), W(0xc07788038bf92293), W(0xf456826ef6ad6188),
+     W(0x38387da1c111ca80)},
+    0
+  },
+  {
+    {W(0xb84605c1fc96195b), W(0x1510c32a6b60662e), W(0x203bb849d95ae656),
+     W(0x70d8b6368a7f5261)},
+    {W(0x9c7d9a8aeb5338a6), W(0xee034423db562921), W(0x24efc20a0f7927c2),
+     W(0x92764b1a5b9cdcc0)},
+    0
+  },
+  {
+    {W(0xfb37d42b12709631), W(0x7284becc0b0537f4), W(0x870cf112deae338a),
+     W(0x1f460716868360d4)},
+    {W(0x9ada319498ba9f68), W(0xf155dd61cf159d2f), W(0xdca84018f7368ced),
+     W(0x1070801323ca2c4f)},
+    0
+  },
+  {
+    {W(0x1b5fcd38eec5048b), W(0x59d5c7666450c68a), W(0x1dbafcbd3934a305),
+     W(0x75bc816b14707a6d)},
+    {W(0xf1dab80c9f40f37c), W(0x577ac7014517271e), W(0x0a78f9477c1d8445),
+     W(0x2b7b719487601b71)},
+    0
+  },
+  {
+    {W(0x4511f6874a134df6), W(0x8c835a4393c100ef), W(0x3a7c190c5aa7d715),
+     W(0xf2ad3f7b1226211e)},
+    {W(0xc1867e675b297f67), W(0xe91880f159bfe89e), W(0x04ae72b75306f2eb),
+     W(0xd00eb602287ca44a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x196be23c6a975d8b), W(0x6d7848f8de2aef07), W(0x880e9c1b88971bdf),
+     W(0xa0b61ebf9617507c)},
+    {W(0x7881e1ccb558d193), W(0x8e3eb39e27efe5db), W(0x78bc5008a94fbc74),
+     W(0x1a4b3db705b737b4)},
+    0
+  },
+  {
+    {W(0x7c5160a69495b5d5), W(0xdcacde01f28742c9), W(0xecb43151c36ab664),
+     W(0x0f12d8b71c4951b8)},
+    {W(0x074e467a6cf69608), W(0xc1fca494e511db0c), W(0x9e7f32d75e9d0611),
+     W(0xe175a733bfeb842e)},
+    0
+  },
+  {
+    {W(0xf131a5b1fa650f2e), W(0x3caa49a520da5a45), W(0x24fed3b9c2438f2b),
+     W(0x2cc1dd26da6b04ef)},
+    {W(0x2a127b3bf4e712ba), W(0x0b70938a68312cb3), W(0x6ad2ea017b0fbdee),
+     W(0x3acad928be454e4d)},
+    0
+  },
+  {
+    {W(0x311570c20073091f), W(0x647e3c94424de0f4), W(0xde2d71b08c1a63a2),
+     W(0xdf945b97f86636ed)},
+    {W(0x0baf127b03e3fe9b), W(0x92f831226b52aae3), W(0xd9ee0e78153e74ab),
+     W(0x9dc9515440be2c16)},
+    0
+  },
+  {
+    {W(0x439ee637ff55ee27), W(0x4582af544197b103), W(0x9eb0314aa4f51df0),
+     W(0xc36d22488ea0aff9)},
+    {W(0xced232862fb634db), W(0x7e6dc894717de21d), W(0x26790435bddeaa23),
+     W(0x85e9b4c1c60f5f3d)},
+    0
+  },
+  {
+    {W(0x682cbf3ccdde20bb), W(0xa47c3fba6a732b9c), W(0xacec43170ce1c418),
+     W(0x01918f433590c160)},
+    {W(0x75b33494c9a8e4b8), W(0x2eeeb35e768b6247), W(0x7cd0c3cd4bc33c58),
+     W(0x3bcf455ba7072e53)},
+    0
+  },
+  {
+    {W(0xa711ef88d5636ab2), W(0xffb5a3a829744971), W(0x771631a07367f41d),
+     W(0xbfb67bfa6406b576)},
+    {W(0x131d115927651342), W(0xac7e214a46e3f66a), W(0x0aac82c63eb4550e),
+     W(0x8559e605223b5174)},
+    0
+  },
+  {
+    {W(0x4edab17198a9bc05), W(0x595ab16187f2da64), W(0x979ec870a2f9ed58),
+     W(0x86d5088e821939e4)},
+    {W(0x3ef8e783a7e275ed), W(0xd3ee8fa2597b7d0e), W(0xfa9feacae37c7a09),
+     W(0x5c99fe2a1bf492b4)},
+    0
+  },
+  {
+    {W(0x2aab71e06752e22d), W(0x4d5f19578d49ece1), W(0x0aa0ec0f6bee4aad),
+     W(0x39370e735f7cd806)},
+    {W(0x58fd71fc632cfcdd), W(0x3d4620c7ba368b2b), W(0x04f4292a0d8cfec7),
+     W(0x636550483958af0f)},
+    0
+  },
+  {
+    {W(0x02c15d27e3e75827), W(0x67689774f97df6c8), W(0xd97051208af8f2c4),
+     W(0x32da611b380a0ea8)},
+    {W(0x3307681acc720f86), W(0x4bf885c15b47a369), W(0xcbddf1a01975e918),
+     W(0x31f853c3a1c00961)},
+    0
+  },
+  {
+    {W(0x962c22eef61e86b5), W(0x374a3d0a8d14b7ab), W(0x474d0c8acc9088b5),
+     W(0x860d72769410ef17)},
+    {W(0x3ecbf75e189a1251), W(0xe84818ede8b9b799), W(0xab271286b53eca19),
+     W(0x027357ec3a839b17)},
+    0
+  },
+  {
+    {W(0x0b462f27581331b1), W(0x5f7ffadca256d027), W(0x56bac41e406f7c16),
+     W(0xa7f4c4cb1381101b)},
+    {W(0x099d3d6a0c610852), W(0xaa9b1599fb0030af), W(0x6473c362d84033fb),
+     W(0xb986d38dbe5a1780)},
+    0
+  },
+  {
+    {W(0xf53ade08cd174988), W(0x31b0cf0a07be5624), W(0xb6b01faced030fa9),
+     W(0x1f5be6be33788dfb)},
+    {W(0x422f2d64149e8bcc), W(0x547566e3756ebbb8), W(0x3db92d1bf6901e1e),
+     W(0xcb4f29336a0d05bc)},
+    0
+  },
+  {
+    {W(0x1e217e900da0fa19), W(0x099a14f77b368488), W(0xe8ea90d556f03a02),
+     W(0xa8e0de5b4f15c7cb)},
+    {W(0xaa71fdd1af2b26fb), W(0xfebf13a8b360ef3c), W(0xb51da724c746e5d7),
+     W(0xcd04472e9f7a3430)},
+    0
+  },
+  {
+    {W(0xcec6fe54d88d80ba), W(0xf72b99a2f46bd447), W(0x9257670101395763),
+     W(0x222e4583fcf5cb52)},
+    {W(0xe9be9305b7a7a29c), W(0x851409f02de6ac68), W(0x356a9d64f623bf59),
+     W(0x728c1b45f17991c6)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x2ea0d0e07801a3c5), W(0xc83d3ba418b8af1c), W(0x60f8e2afd51c0a1d),
+     W(0x8316659aab2dcd2c)},
+    {W(0xb17fe8ddad4913ea), W(0xfaa00a431ebaf2b4), W(0xd9b384153f6b097e),
+     W(0xc834b7856a966271)},
+    0
+  },
+  {
+    {W(0x0e56c67b932f4e0d), W(0x5f679c3e13ec96e5), W(0x4ce06b7e2b0f5e32),
+     W(0x0a533bb6fedc75e4)},
+    {W(0xa0dd19b0b380df09), W(0xf4929faf3a6ddb00), W(0x1915c83409f7c1a0),
+     W(0x472b336b851c1a2b)},
+    0
+  },
+  {
+    {W(0x5b22d4d6bf331b58), W(0x06be0082db31aff6), W(0x045ed6353d46956c),
+     W(0xb2d277ea2295f501)},
+    {W(0x782075e70fb9bba2), W(0xa9b510b085282daa), W(0x047c7ccce55149a5),
+     W(0xc4c8909dfce1fc7b)},
+    0
+  },
+  {
+    {W(0x1b28f46c8d196a53), W(0xcbbf4f19cdbd9fe4), W(0x8f50d741659aec4a),
+     W(0x7a3f13c4a1fe4731)},
+    {W(0x8b08f67d9c48ea03), W(0xb6b1f23a30bfbbc2), W(0x506bcd04be1922ca),
+     W(0x776a01d887d25258)},
+    0
+  },
+  {
+    {W(0x3b849b79b3d4a304), W(0xdc5f46bbdac38135), W(0xad6202bba079ffa2),
+     W(0xe64eff16bbf8a18f)},
+    {W(0x62fee364edc489a5), W(0x7b03a27ec8dc8966), W(0x7532af3af2a6bb96),
+     W(0xa3ab2011e2367625)},
+    0
+  },
+  {
+    {W(0x14a5ff03eb8df1e9), W(0x874ca421bb0729d6), W(0x21056f6e031a01f9),
+     W(0x56b6f8f7851b754d)},
+    {W(0x739ec41beb81b5fb), W(0x86d5f3687ed84d45), W(0x3a38b5b3af1f7071),
+     W(0xb04778c01ae4348f)},
+    0
+  },
+  {
+    {W(0xeadb25c68f9cd24e), W(0x3624fcb55d2510f7), W(0x7b5eb00b73a7f8f9),
+     W(0x9c9b025297c891e2)},
+    {W(0x24f93b39ccd9c707), W(0x040c35615c2dd795), W(0xc03216bb232b47cb),
+     W(0xb83559bdc1248bdc)},
+    0
+  },
+  {
+    {W(0x5e18dec9ea7b5d4c), W(0xdf68b68a54824cab), W(0x95e83fd319b979a4),
+     W(0xae23018b47583451)},
+    {W(0x6d542ccee4b1ada0), W(0xda343eaaea7dd7f3), W(0xeb3f361051c6410f),
+     W(0x07b1d023c31d99f5)},
+    0
+  },
+  {
+    {W(0xf8f334697a0521ed), W(0x0e628017884d147f), W(0xb3dfc60e7d21dd45),
+     W(0x58f95627b661e428)},
+    {W(0xeff7ca1863a665ab), W(0x2de800bc3376a61d), W(0xc2040574aa82e9a5),
+     W(0x98044a0b1bc8e63c)},
+    0
+  },
+  {
+    {W(0x60f6fc92d9104e96), W(0xd36afcc7732a361d), W(0xf0ed2e114bd4c81f),
+     W(0x548ab02a027933cb)},
+    {W(0x4d4d60974b6ca1a2), W(0xb7af5aab8a3e5e8d), W(0x8516120e2bf902b0),
+     W(0x06de62dcf5fcead2)},
+    0
+  },
+  {
+    {W(0x9ac58e53605ff3b1), W(0xccd3168e6d1a602f), W(0xb6b37c0c9288c1be),
+     W(0x20dbea33fe05e154)},
+    {W(0xe28b0db9569b3005), W(0x5f9a518db45fae90), W(0xd4bcd91ca73a5b01),
+     W(0x3d8e6e894cc5412f)},
+    0
+  },
+  {
+    {W(0x15f452ea6a3ef19d), W(0x0908826f8b747438), W(0x9c73b975e5892ac9),
+     W(0xcb59d941ce48a6ad)},
+    {W(0x12119f1a4a16b658), W(0x90c219c83e764542), W(0xc6d98661aadcf2dd),
+     W(0x4ace353009a3ddc7)},
+    0
+  },
+  {
+    {W(0x08681728e59a0284), W(0xedade5d34c7d11ee), W(0xda59cd355f939cf1),
+     W(0xb4edda6dbcabaa7f)},
+    {W(0x2a209bd76241b6af), W(0xf0b02b124b2cb085), W(0xab4d41d2d68ffb1b),
+     W(0x838b7e7f946a7784)},
+    0
+  },
+  {
+    {W(0x1fb3023726553468), W(0x8beb9ffd123e3016), W(0x542470f87c1e25a6),
+     W(0x67ac1d673eb637f4)},
+    {W(0x3cefdb23f362ec5d), W(0x391295b11578447b), W(0xb289dff04854b459),
+     W(0xffd5919d0d8d9028)},
+    0
+  },
+  {
+    {W(0x43c5fe0c5447c836), W(0x84fb1a64202a12b3), W(0x0c84257a3889dfde),
+     W(0x85cbcd2566b014aa)},
+    {W(0xbc89f4250dbad660), W(0xb083ab05d67f26f8), W(0xdbc584e556c829f1),
+     W(0x1e6072ba9456ad54)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9e286677f15dd582), W(0xd38c0a2e76af5d63), W(0x9a2a033020458bc9),
+     W(0xeea134214dec62b8)},
+    {W(0xe3a33849844ebf75), W(0xfa8ab7e4293f553e), W(0x62645cb5251f1165),
+     W(0xd4b950a4f5129f90)},
+    0
+  },
+  {
+    {W(0x50f96b2981faa9d2), W(0x64012727d6f02f65), W(0x2cd2e3facdb1d3cc),
+     W(0xbdfad5a529c0a50e)},
+    {W(0x39985ce152aaf132), W(0x5b4af6d8e85b9cef), W(0x77e7be862cdd9e5c),
+     W(0x571f80ae6900c97a)},
+    0
+  },
+  {
+    {W(0xf94e72a6013d56f2), W(0x773009fbdd7b9d90), W(0xa91e3a3b4bf59897),
+     W(0x6e933bcfe142e1ac)},
+    {W(0xda3d9e96b87e1ab1), W(0xe11afcf988f9e836), W(0x5e6a5f0e0375c534),
+     W(0x51e6f8e1b6ffb25d)},
+    0
+  },
+  {
+    {W(0xf3282b6ac9740c53), W(0x03eacc2d41dbe39f), W(0xe8b03a5067a8efcd),
+     W(0xffbd4db75ae21e0c)},
+    {W(0x54cf603d44d0d734), W(0x0f18661e6cb67a47), W(0x2c0fab457b5ee4a9),
+     W(0x6b1e81db39e2058d)},
+    0
+  },
+  {
+    {W(0x43829b93c83f6068), W(0xbff91371af0dde53), W(0xa32c2616b855c3b4),
+     W(0x02d833da93d815cf)},
+    {W(0x1572834608c13120), W(0x7f3066d09585e921), W(0x75bb92674a82ab0a),
+     W(0x9e2a57bda49befd9)},
+    0
+  },
+  {
+    {W(0x146c53c684b84724), W(0x3a2c632f31e1ed23), W(0x81b05b752945924b),
+     W(0x467d88eef18e1eb1)},
+    {W(0x48b2094135217d7a), W(0x44c0d0e6889300e1), W(0xfe5ac61d6ddf17e2),
+     W(0x7463b946bc48c8c1)},
+    0
+  },
+  {
+    {W(0x9b34abbc1bf71499), W(0x54ad175d396a8d2f), W(0xd24c5d09c21e26e3),
+     W(0xac40d8502459a577)},
+    {W(0xc39c86d9c44333c6), W(0xa8611e31fd90ecc9), W(0x0b0b75b48c4c4c53),
+     W(0xe7cb9387e63d2143)},
+    0
+  },
+  {
+    {W(0x3a5c3e5ba14022a8), W(0x767f663bbd4408d9), W(0xbb9e99f2e3dd2388),
+     W(0xb74aa12bcdd212fc)},
+    {W(0x0fa6c246f1a3e558), W(0x3438d0006ab750b0), W(0x3ecbcddfa8878152),
+     W(0xb7cfd45e4a0c9ae0)},
+    0
+  },
+  {
+    {W(0xcab6f40a6f8388f9), W(0x2d28c986c1036d40), W(0x1c34c2806c48899c),
+     W(0xae5adb314e7ab6bb)},
+    {W(0x177be27743cbfdb2), W(0x2dcd89fddaefbc6a), W(0x50142a1dc781fdb3),
+     W(0x509a4fc5d2b6736c)},
+    0
+  },
+  {
+    {W(0xf85701037aab9cbb), W(0xfe9e4b29b3744c03), W(0x49e2232d1fc33ea1),
+     W(0xcd48a6ee2de54ad0)},
+    {W(0xb86ec33b5bdd1bc6), W(0xaf526bb0bac3b893), W(0xb04c837d870e2bf6),
+     W(0x28ff889950dab80a)},
+    0
+  },
+  {
+    {W(0x37bd1f32ee9c5ef2), W(0xbafcaec45b8fb46a), W(0x3df41b8c2af1a097),
+     W(0x964b842d61dc7aea)},
+    {W(0x52398a6f1bad072f), W(0xbb0c080b5635f531), W(0xcb28ce88ebf3ad33),
+     W(0x90b71f6ec3a8f497)},
+    0
+  },
+  {
+    {W(0x6b4b3c046dd39c2f), W(0xfd4f3af2855cd4de), W(0xa36566b3e5a53210),
+     W(0x6c0673096a98e15e)},
+    {W(0x081baaa6ee980506), W(0x9a07bd110c6a1b26), W(0xd456c89e79b09922),
+     W(0x9b5fab01b09f5ba1)},
+    0
+  },
+  {
+    {W(0x3e6594ece0d8b3d4), W(0x0164b70efa71a933), W(0x40e3b984af271f1e),
+     W(0xbe32ad159ae69547)},
+    {W(0x262589be5a427993), W(0x4b3e3bca6c3e1a7c), W(0x627292f3f845374f),
+     W(0xdd2045a91fa30be8)},
+    0
+  },
+  {
+    {W(0x72ebaff3cdc5d60c), W(0x9014e8e98a3405fb), W(0x9bf9c97fad9afdf3),
+     W(0xbb13b772f3c1e5f4)},
+    {W(0x4aa551f9b09d5bc0), W(0x3d4ac2ddb940c311), W(0x31df7ada8de44bb4),
+     W(0x6a4472f034efaaed)},
+    0
+  },
+  {
+    {W(0xfacbd02bbe0b183c), W(0xbc7bf32b86d62744), W(0x72534d2f974d6e93),
+     W(0xb6d4702cea3feee9)},
+    {W(0x3c809d2ce3e499ea), W(0x21396e6211f80fc3), W(0x4c062ed78caf3e29),
+     W(0xf616386e76e7abd3)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x6fc1807f6cfe66ba), W(0x30916eab29707210), W(0xca1f8047f86680a6),
+     W(0xe650ddfb89e17f8e)},
+    {W(0x24d3b7f8b7f54f4b), W(0x660582f137aecea1), W(0xd5fbc8dd1844b7eb),
+     W(0x282f82f45c3dc6ba)},
+    0
+  },
+  {
+    {W(0xaeb3ade54f815779), W(0xd9e995a72017c755), W(0x55e3665c327b5f6c),
+     W(0x744b60ec1388c7bf)},
+    {W(0x121ecdca5044e755), W(0xc400e8ef4d345685), W(0xc82145145f33d488),
+     W(0xca13189759d03f59)},
+    0
+  },
+  {
+    {W(0x54cb632ea4c7c464), W(0x85d2e1139a1d5930), W(0xa00f9f106c28c7e9),
+     W(0xb1589cdbcf5c0853)},
+    {W(0x915b865ee8098217), W(0x2f0bc5b4cccc11d2), W(0x4750d394a41ec418),
+     W(0xa973399f58fdf73e)},
+    0
+  },
+  {
+    {W(0x501fc8eb25bdaaa0), W(0x7c8a5680c87a9bb4), W(0x853bbeb02f062926),
+     W(0xb3c57893b9eeda56)},
+    {W(0x68cd4a7e9bca1c9f), W(0x59048816f5cc222c), W(0x2536745e215d6d0c),
+     W(0xe5877a3a1bbb6a21)},
+    0
+  },
+  {
+    {W(0x5ed591d9f6eecd8b), W(0x4c097a281e41f37b), W(0x7e265be21a42797d),
+     W(0x8e25d3c9d71325a6)},
+    {W(0x40b64461415c693e), W(0x7cb31dd96bf67744), W(0x31fb79264659ecd4),
+     W(0xdb2e3702cc9455d9)},
+    0
+  },
+  {
+    {W(0x5e774c72a34d501f), W(0x71fe9ad757d141a3), W(0x36504add9ea8ab37),
+     W(0x5b2b9fdb40107294)},
+    {W(0x2eb43994d4d62ae5), W(0x6f28b3714e6dd33e), W(0x8b0934312382bfd8),
+     W(0x27bede11a1b95fd8)},
+    0
+  },
+  {
+    {W(0x6aecc846ab7406cf), W(0x52fadb5899fd9d5f), W(0x187b3be746d9c5f3),
+     W(0x79011cc53c1f4a64)},
+    {W(0x055fc1c290e3ad74), W(0x8d1fc64508aa819e), W(0xfd7137ebdfb275a7),
+     W(0xad980bf3bf5dd11b)},
+    0
+  },
+  {
+    {W(0xadf5f9e66f848fa9), W(0xa71c274738cde737), W(0x4393cae367cb8c57),
+     W(0xbd92c017d7b63131)},
+    {W(0xa0a5af5dfb22fe46), W(0xb583899cf50a93ba), W(0x6d0c15bc9faccd59),
+     W(0xf6523175538403ee)},
+    0
+  },
+  {
+    {W(0x0288df44907f22b5), W(0x92f09b4485662e06), W(0xe73f774c019ec18d),
+     W(0xf08f767c0fbe68d2)},
+    {W(0x5bd61189c9dcf974), W(0x79fa83bbafe73014), W(0x56235dadb5378d10),
+     W(0xbba26915a01afe98)},
+    0
+  },
+  {
+    {W(0xdfd42ba2876374f6), W(0x3d02efba3d2dbcde), W(0x47c9c5861315756e),
+     W(0xcaf06626f198862e)},
+    {W(0x359c1f89581300ad), W(0xefec52b05526abd4), W(0x1e9a1874f803e95d),
+     W(0x17c2e22d3ec6e497)},
+    0
+  },
+  {
+    {W(0xe77b30ac254acf95), W(0x982cfd636c3e2a6e), W(0x5214f3d31e3c3ea5),
+     W(0xa4ec8c3aa4f7e9a8)},
+    {W(0x85ddd661034dcf3c), W(0x58602b6286edd95a), W(0x840ad521a2ed1b40),
+     W(0x976ca9e8f7a0be6c)},
+    0
+  },
+  {
+    {W(0x6564f5ac07dd5639), W(0xca41f9a4f7878cb6), W(0xfaa4635f8c64ae2a),
+     W(0xcdf8b59a9a0b9349)},
+    {W(0x4f5241dae4a60e1d), W(0x78137c87b39bdb4b), W(0x8be930f1150dec4d),
+     W(0x657b26abba887987)},
+    0
+  },
+  {
+    {W(0x7bbde1a58b04d6a0), W(0xc0a3ee4cdb390593), W(0xa9f60a497d98d6bd),
+     W(0x81e627853d00694c)},
+    {W(0x61067ccd920226d8), W(0xac68c302eae655cd), W(0x445f22bd9372f2b2),
+     W(0x21e7f2f28f803345)},
+    0
+  },
+  {
+    {W(0x57f43bc8f3b900db), W(0xf7fd48b3efb26720), W(0x25c1d8f67988b86c),
+     W(0xd7a76810041fe442)},
+    {W(0x8fb3318a32a34eba), W(0x91e3b79415ad1455), W(0xd6507694b410a4a5),
+     W(0x682821075898e2b5)},
+    0
+  },
+  {
+    {W(0xf36d81e1528ff71d), W(0xfabb0efc54fcd037), W(0x0ccdb6899dec2810),
+     W(0x9709d07dbb7ebe54)},
+    {W(0x3b2554ec1c93d1fa), W(0x531c315a1a793966), W(0xca84d66bb78836c8),
+     W(0x7d0875dbe776bed1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4ea10dda37685d88), W(0xe3230237d731c69c), W(0x1b763c15b08f5466),
+     W(0xaff88e1ae81d1dcc)},
+    {W(0x80727f9ad59ee10e), W(0xb4874044fd0a4b08), W(0x73341f148080c797),
+     W(0xd6f8686c0bca447d)},
+    0
+  },
+  {
+    {W(0xc120e21c6024b146), W(0x6ec12670897c7c4c), W(0x93d66405cdc3bfd9),
+     W(0x11a4bf0951291a43)},
+    {W(0xe03be947c1d3f866), W(0xe8fb0d9b0b8e9b95), W(0x086e8f4381a53ce3),
+     W(0x31638c025dbc7df2)},
+    0
+  },
+  {
+    {W(0xd35b1e984b309591), W(0x42b1807b5ee94c5f), W(0x83956e4ce0047093),
+     W(0x8085ee1554694578)},
+    {W(0x3c90c78881783d8c), W(0x8a90901de0237c6f), W(0x0c99ffffbaff3de1),
+     W(0x2137ceaf02fe131e)},
+    0
+  },
+  {
+    {W(0x46b86f3e48333fcd), W(0xf599454e879bafd4), W(0xb66f9bbbb1032834),
+     W(0x35e2b02ad88eddbb)},
+    {W(0xae5260e67577639f), W(0x717980e5c6833313), W(0x8810257b76486e82),
+     W(0x341eabd8e2be33f0)},
+    0
+  },
+  {
+    {W(0xf45195a635acc43e), W(0x98f0e92a278df575), W(0xac58e78cf9c913c9),
+     W(0x87f366413c2f5603)},
+    {W(0x4cbfca59fdc7ba99), W(0x38cea97bb414b408), W(0x8866af438e9a95c8),
+     W(0x002826f26e89f54c)},
+    0
+  },
+  {
+    {W(0x49f11dd054e913c5), W(0x7ffa161d20a72d19), W(0x95ffbf1d009c1e3b),
+     W(0x4b1b21d7629d0ead)},
+    {W(0x13c8ce43fe044400), W(0xbc674bb97a2aa524), W(0x4b24e77b05ee2f53),
+     W(0x932c88e00b0e6b0b)},
+    0
+  },
+  {
+    {W(0x247c0c4baedd8467), W(0xa5461b8d13cbeddc), W(0x5534be46769c62a9),
+     W(0x233a8a3fe48d8c1f)},
+    {W(0xc36b4212ec479241), W(0x05d56e03032c47cc), W(0x550734e93535933e),
+     W(0xd15e49f8d72acafc)},
+    0
+  },
+  {
+    {W(0xacd537a1907a0923), W(0x5d02cd7db0d1bce9), W(0x36039ed5e9be2652),
+     W(0x87c4e3514fb0ff86)},
+    {W(0x9a081ba8a7751b13), W(0x3458a46204f13df9), W(0x46766072b55e569a),
+     W(0x13aff2f4ef1d851d)},
+    0
+  },
+  {
+    {W(0x748078634ae35baa), W(0x223fbd61ce0b26f5), W(0xe26cd1e5639eeaa4),
+     W(0xed83e5de99a11537)},
+    {W(0xda5ba49ffd8f6b2a), W(0x06d0bae301c7e980), W(0xefbbbd81ce2282b3),
+     W(0xcc23bbbc7e10755c)},
+    0
+  },
+  {
+    {W(0x1c6877b60f8501e6), W(0xda5aac7fb7dae4f4), W(0x3ef6cb3cc196b602),
+     W(0xe40ceb428cb84512)},
+    {W(0x0ea50c35abef859c), W(0x420f02c8c63900de), W(0x5cfb1d84aa0cc011),
+     W(0xf50f6f4654f83f0f)},
+    0
+  },
+  {
+    {W(0xaac78e61240aedbb), W(0xd4db7ac2828256ff), W(0x28b1d15ef0f4571d),
+     W(0x360a20df580a4882)},
+    {W(0xcdd5dffff5791b48), W(0x811a740c658adde2), W(0xbeb78afa098481a4),
+     W(0xca53eda04ea07bff)},
+    0
+  },
+  {
+    {W(0xfeebcf9f21bb7ea5), W(0x5c12eb00d7633c0e), W(0x4b181ddbdabe211c),
+     W(0x4ef450e3cbf62b41)},
+    {W(0x574675668c1a7558), W(0x69d86a57cfc8998f), W(0x93774831e081a1c9),
+     W(0x41df86f806f261c9)},
+    0
+  },
+  {
+    {W(0x062c6977cf1a8f8d), W(0x1024e4506549b48e), W(0x526ac91888bcc389),
+     W(0x63d2fef3b7eec98b)},
+    {W(0xf2d14ff6e7d0ac71), W(0x5976bfd252b5f573), W(0x12bddfc8c8f25c97),
+     W(0x163e5a3cdb3daf40)},
+    0
+  },
+  {
+    {W(0x895f5deeba0073db), W(0x38d579c94021cd4c), W(0x73cc60225745def0),
+     W(0x7d8a4371f93437c2)},
+    {W(0x3140c9266fb8e762), W(0xc8419a52e33db57b), W(0xfe8425d140ca01cb),
+     W(0xe945aa5e339f928e)},
+    0
+  },
+  {
+    {W(0x0e5d1925c7e4ce10), W(0xf041fd8145521d8f), W(0x531486ff227dd083),
+     W(0x576ff7e2a8528e6d)},
+    {W(0x4c90cec840c9838c), W(0x51091b67514a6ca3), W(0x2ae64b87dbd753eb),
+     W(0xb2c74beade249a3d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc75f9df61a89f319), W(0x07fdf0458db72e5b), W(0xc1545deb23496830),
+     W(0x803233b474f901c9)},
+    {W(0xb2f97be80384551a), W(0x39bc7f2b6b2116a1), W(0xf7f04c199421e72f),
+     W(0x76b396b1eb78bea3)},
+    0
+  },
+  {
+    {W(0xb503d27b46a2512e), W(0x305bb293ddc1d56c), W(0xff6e7a8cf18ee2ba),
+     W(0xd565ad5853e08dcf)},
+    {W(0x865c7f6a7a3b543f), W(0x65ba01fa6c260230), W(0x48893aaace8ac62f),
+     W(0xdf701299d0b136da)},
+    0
+  },
+  {
+    {W(0xdbeed2ee54a54506), W(0x1cc37b4aed654872), W(0xcabde41c05725001),
+     W(0x07998d888e15ff9d)},
+    {W(0x4a7ee1b54c8ea30f), W(0x35b50e88c81206a0), W(0xc8d752c148d21bb4),
+     W(0xe2dd8ebb054153bf)},
+    0
+  },
+  {
+    {W(0x1f6ffbf4b9334e9b), W(0xf3dd5292b8fab993), W(0xa009aa6f5e22e2be),
+     W(0x98917cac1f4c264d)},
+    {W(0xfe34e303fdbcead8), W(0xa9894e9c5df57243), W(0xe471e05925d35b50),
+     W(0x337f6278c1b1805a)},
+    0
+  },
+  {
+    {W(0x3fda8bf81a6e9ecb), W(0xe8b7627b8c8afeb4), W(0x4f3738bd352045ab),
+     W(0xba146059883837af)},
+    {W(0xcca601548a65c868), W(0x98aa1b1c5c236043), W(0xe86b595e1753be75),
+     W(0x17860787df64426a)},
+    0
+  },
+  {
+    {W(0x5daf6d7097b49209), W(0xdd2d9b9281974bde), W(0xe91e4a38ab548f82),
+     W(0x53c3424251121eee)},
+    {W(0x115fbb265e963f61), W(0xe988b4ca0520ca29), W(0xe16ec5e1254ad17b),
+     W(0xa3651c70003b6214)},
+    0
+  },
+  {
+    {W(0x5da07c157bb4c52f), W(0x1f3c67520970789b), W(0x18e074bf99d8f959),
+     W(0x93c81fa3fccaac3e)},
+    {W(0xf9a197da9503412a), W(0x62455a7601155a83), W(0x9392808b994227b2),
+     W(0x1e9928db8301d617)},
+    0
+  },
+  {
+    {W(0xaf9463c23e10d4ac), W(0x7d476867fd36f051), W(0xff605874da6dec1b),
+     W(0xf767bf939d3f6d97)},
+    {W(0x9996d4bae0a9bcc9), W(0xda0189436ca4de3b), W(0xbc7ed87e251d0394),
+     W(0xb50387503bbfd259)},
+    0
+  },
+  {
+    {W(0xcefe14077b2d98bb), W(0x00e0e4b01cfe8f0c), W(0x66442ef765c29e1e),
+     W(0x75c83934f80d6e95)},
+    {W(0x68dad1167ad1e682), W(0xcf2ff1950fbd8665), W(0x1cb46859c17aaac5),
+     W(0xcea040f64ec1b813)},
+    0
+  },
+  {
+    {W(0x029456df36551c03), W(0xdb9d1013ebd0d948), W(0x465554b30a0d8a50),
+     W(0xba0c4d395d63bb6b)},
+    {W(0xccb8336fa806a8dd), W(0x7dcb930511f840b2), W(0x353db4adf55b4cec),
+     W(0x89364db16fd1e493)},
+    0
+  },
+  {
+    {W(0x90ad76b99f74f401), W(0x068eb7b6018a2a87), W(0xb306df7aea441683),
+     W(0x898f94fffa440f23)},
+    {W(0xb44b6ad20b95c15a), W(0xd2ef1f05a6723374), W(0xca8437b8bc2f82cf),
+     W(0x83e415954587beba)},
+    0
+  },
+  {
+    {W(0x761826be812e7603), W(0x8cc5203964292bfd), W(0x53dfe70972456302),
+     W(0x152130aa41e2eddf)},
+    {W(0x8e0535d4b37b8cc7), W(0x3b225d32837532f1), W(0x037a7209c8c97d38),
+     W(0x53e7f24116e48ee3)},
+    0
+  },
+  {
+    {W(0x97f97295d300e8a6), W(0x284693b1e37011a7), W(0x0b6bc62ec40d4060),
+     W(0x9d63ca238cdbe471)},
+    {W(0x88205ee29c012014), W(0xa1d127308cc90a4d), W(0xf00d10685b20acb8),
+     W(0x12042eec6bc43c57)},
+    0
+  },
+  {
+    {W(0x7d1db455c1ad13df), W(0x6e1f043e1fea3929), W(0x57040e49e429a9a4),
+     W(0xe3faaab83d37cf6c)},
+    {W(0x50fc7f5db5556188), W(0x847a0bddd78e636d), W(0x2391ec3c64b922d9),
+     W(0x1136d3a15e916aaf)},
+    0
+  },
+  {
+    {W(0xadecfe9afae1979a), W(0xa29c402d62b16c81), W(0xeedcc83dda57b92e),
+     W(0x33a0eca5650fe00d)},
+    {W(0x64ce5337494a141a), W(0xcd127af489a596e4), W(0x6c2ce6d846fbd62a),
+     W(0x72859daa94c1012b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x79c7aa3c52b47c8f), W(0x485a4d3b01ae5805), W(0x92d92ed45ce8fb12),
+     W(0xca30214c59381354)},
+    {W(0x7060e77cb1db1e86), W(0x9b3f0cd1e63f4f80), W(0x72b4780b5f9b5bca),
+     W(0x8b3ae0efcd768829)},
+    0
+  },
+  {
+    {W(0xcd5ea3b9ba7eecae), W(0x5a181aae98fb3e01), W(0xeef18e17ebae2976),
+     W(0x4dfcf8557bde6ebb)},
+    {W(0x3bd9233a67efcb7b), W(0xe239f907508636c5), W(0x55fa5bd0fc7d80d0),
+     W(0x7dff3697add84e62)},
+    0
+  },
+  {
+    {W(0xce4c98cf764e7cfa), W(0xe092319c737681ad), W(0xcad0dfab076aa02d),
+     W(0x9b3fef504aba2cab)},
+    {W(0x0e5be68ec335cc06), W(0xe9b4a0be2df69968), W(0x99a6281d9b6aac31),
+     W(0x8ad6fcbf9fbea2d5)},
+    0
+  },
+  {
+    {W(0xb9ef2df192216e10), W(0x41617a46544c138e), W(0x3c18dc9e6146ffa7),
+     W(0x65971a58a123f0a7)},
+    {W(0x8742256cb7236fbc), W(0xb6b01d5d89e7d9fa), W(0xb89fc499591520f9),
+     W(0x8b7e518e868d093a)},
+    0
+  },
+  {
+    {W(0x24406c10569acd7e), W(0x848f9239a43a1a15), W(0x0ed7507ab59cb0f7),
+     W(0xb1cae5e3db5d2780)},
+    {W(0x8498b35de36b3d8a), W(0xa70017acb0e03087), W(0xa30085ce5dd40f22),
+     W(0x9cabbb995e9f036e)},
+    0
+  },
+  {
+    {W(0x1059d04edc26e82e), W(0x555d746358883851), W(0x587d2fa7bcc8c9b8),
+     W(0xccd249e9a70f9438)},
+    {W(0xecd1410f3f042899), W(0xab2197cbd7b60032), W(0x7a882b686e13fcc8),
+     W(0x2b254e906069d3c6)},
+    0
+  },
+  {
+    {W(0x3a0a5e80744273a9), W(0xb90f0618f8aebce0), W(0x26097e15719925fd),
+     W(0x1dec5b447a3558f4)},
+    {W(0xdf2b0d02fa7716f5), W(0x694c2162135ffdfe), W(0x4c4326d0924109b5),
+     W(0x015ed4fbb70e0343)},
+    0
+  },
+  {
+    {W(0x0b3b54a2c8de583d), W(0xab82996e18eb3ab1), W(0xb3c54da2ab894b9a),
+     W(0x8461043c282f693e)},
+    {W(0x76fdff0a2144fe99), W(0xdcd2cf19ee262747), W(0x7d5d465450aa1526),
+     W(0xd51f0acb18a7ec6a)},
+    0
+  },
+  {
+    {W(0x370e3110258225c3), W(0xa23a29365403b946), W(0x2f223800113939f3),
+     W(0x2dca5a4089b1a7d0)},
+    {W(0x6af938089a7bd75d), W(0x714e78aae16c4052), W(0xf49449f1163c5e40),
+     W(0x71790f4ee9881535)},
+    0
+  },
+  {
+    {W(0xa6f88301ade1442e), W(0x451cc703dd3db5cb), W(0x8ad141526529aa1a),
+     W(0xfaf6efab6aa96ffd)},
+    {W(0xaac15c1c2e468698), W(0x14c80807af3569ec), W(0x1c8c56e40c3685b1),
+     W(0xba0c77f12a735d67)},
+    0
+  },
+  {
+    {W(0xf374f2582a98e312), W(0xdd60e76b64c0a15c), W(0x6ef46844bcc783ca),
+     W(0xbb2ea2a087627c16)},
+    {W(0x36c9f583c7df2400), W(0x2ee5f3ddcc7d5bd1), W(0x8187952ce5722243),
+     W(0xdee274909635eee0)},
+    0
+  },
+  {
+    {W(0x555a4bb6b629b398), W(0xa54d912fa44faa4b), W(0xedd2c7942ce02de0),
+     W(0x3b3aa5f90b571d0b)},
+    {W(0x289c8e48a4e9dc77), W(0x718074e508fa41eb), W(0x10a35ba569b325fd),
+     W(0x27a9f8c3f0845a8e)},
+    0
+  },
+  {
+    {W(0xed76cbc77a80162f), W(0x11daa36a583b312e), W(0xc048cb140b9e7de8),
+     W(0xaa4fe587db58109e)},
+    {W(0x428a73a42f3fa91c), W(0x9cc2f56d0308c8a9), W(0x495e1cfb5f3bf898),
+     W(0x7e6ce98c5c3ad806)},
+    0
+  },
+  {
+    {W(0xd03616eeb8b1bb26), W(0x332ed137593b8e53), W(0xe11c6d0ddc1ec90d),
+     W(0xf44e3d2b6e59bbc2)},
+    {W(0x2bda92d574063f7d), W(0xadc0d121b5e713a5), W(0x61078cf70fdc8ae1),
+     W(0xfea476b3ae7c814e)},
+    0
+  },
+  {
+    {W(0xe5718539e06b0f6c), W(0x18f8e325d2df49c5), W(0xc57a362337cb8827),
+     W(0x8ad66831a3951cf5)},
+    {W(0x481d7747968cbfe1), W(0xc34a6db6a7f711fc), W(0xee084afd6669f06b),
+     W(0x1055789627f788e8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x8ef75e07e9bafc5b), W(0x3d9a8f7e350ded97), W(0x80bd9f33be5a617f),
+     W(0x9e4bb18739ac3f81)},
+    {W(0x862f676d16d6010f), W(0x57e26af2431fad0c), W(0xa4eabe7751b31194),
+     W(0xa3c5ad45e6688201)},
+    0
+  },
+  {
+    {W(0x98578a3e0a870b65), W(0x4c3c18627bf17a8e), W(0x91d83ced4c3c451a),
+     W(0x53345fce55e87cf3)},
+    {W(0x9fc74ceb07bfc06e), W(0x98f43f1963c9c166), W(0xd0323a57064a11a9),
+     W(0x062daf419f9ab838)},
+    0
+  },
+  {
+    {W(0x78f3382ec79e075a), W(0x513fa60d18a421c7), W(0xcc3072f29c5819af),
+     W(0xd7e13b43fa1bb510)},
+    {W(0x9fcde704fa5a4c87), W(0x8abcd0ea1b99a2a3), W(0x475f27a99bd447bd),
+     W(0xd76a8d293e59c3d9)},
+    0
+  },
+  {
+    {W(0x816a7516053928d8), W(0x7e94f13642ae7264), W(0x23232c2fce07ce23),
+     W(0x01e4a0f24817d6ec)},
+    {W(0x441a9b63cc20ad14), W(0xfb48322f0d21ecee), W(0x3731da85e18282f9),
+     W(0xc8b9bce3bebac026)},
+    0
+  },
+  {
+    {W(0xaf8cc1eafb40f6eb), W(0x6323b09e46da720b), W(0x88ffe8de1d38f39c),
+     W(0xe83c64778130b24a)},
+    {W(0x742c9a22eb2d34f5), W(0x1e6d6cedb5a748cc), W(0xd404e103fd9beb10),
+     W(0x2961fe889afe95be)},
+    0
+  },
+  {
+    {W(0xeaebea1b715ec3d8), W(0x041b6a8f0a12419c), W(0x62dc7c817c938a34),
+     W(0x82487751cdc5fff7)},
+    {W(0xa6b66a49e1af59ec), W(0xc3a4bcd39477d26e), W(0xf1a11d023814db8c),
+     W(0x54eee4f868db15d3)},
+    0
+  },
+  {
+    {W(0x6bf7ca4cbd1e9747), W(0xb1b6ad5443ccc4bc), W(0xc69f28848da84a61),
+     W(0x0091c7f7f9711542)},
+    {W(0xc4e6f225453047f6), W(0xc596da1b97c7e3e9), W(0xfb13d165a8f52b67),
+     W(0x196372851a9c488f)},
+    0
+  },
+  {
+    {W(0xbc71da828f55569f), W(0x994f22aafcfa8eac), W(0x7898ca3ed125a428),
+     W(0x515a1546d0b7b7a6)},
+    {W(0x5a2683b5b69bf491), W(0x6ba81619a42a807f), W(0xc0fd26c3c94d5215),
+     W(0x62a45aa718530846)},
+    0
+  },
+  {
+    {W(0x44f318de37273183), W(0xbaf347bcd8838e64), W(0xf4eda6e2c10bd132),
+     W(0x83c7ede98dc1ad93)},
+    {W(0xe80c62d58cf4ff03), W(0x11a7a0a02f07b4ee), W(0xb80b9b6bd98392c8),
+     W(0x204f1d499a0aa80b)},
+    0
+  },
+  {
+    {W(0xfdb5cca8f82e970d), W(0xecf378a7776acfe7), W(0x3531fa798a831ce6),
+     W(0x5700c73709b0801a)},
+    {W(0xec42ff0d535d31b1), W(0xb6b3971eb33efb8b), W(0xfda59073aea18334),
+     W(0x4140f7a238f2fe85)},
+    0
+  },
+  {
+    {W(0xe49d626a7f94d561), W(0xf96582da13d1f34a), W(0x3febeb070359aae4),
+     W(0x6650f2c5aeec7460)},
+    {W(0xbbe0c788e9cd375a), W(0x89dd5fc06bdaba35), W(0x28372a1ce55ea70e),
+     W(0x7b0783c7165f93c8)},
+    0
+  },
+  {
+    {W(0x02504fe7864c3071), W(0x36f81f1a605cfda0), W(0x24e29169bc696d66),
+     W(0xa5825793cae8bfe3)},
+    {W(0xa83c143111284998), W(0x65c63d28664b7288), W(0x27886c93f3d9324b),
+     W(0xc1113df3543e57e3)},
+    0
+  },
+  {
+    {W(0xb0445233ce01b683), W(0x24346ceb7461c4fd), W(0x7d041f7c21de75bf),
+     W(0x9011fb7190bb1906)},
+    {W(0x08e319c55a328ef2), W(0x6ff65b331efefad4), W(0xfbd3b5de7d65c69f),
+     W(0xd4334974d3217d60)},
+    0
+  },
+  {
+    {W(0x839d82137a26a34a), W(0x286f5ba1c274ec2d), W(0x70b11e5d549d467a),
+     W(0x32abb599bab21acb)},
+    {W(0x1749ff5056050248), W(0xae09381dab6e3518), W(0x130f2230b7c7cbaa),
+     W(0x95bd021258ad63c8)},
+    0
+  },
+  {
+    {W(0x89df17fcd818b029), W(0x3adfa8eaadcead52), W(0xa053996e5e5e6bac),
+     W(0xe0520b75bb513548)},
+    {W(0x48a308ab83619988), W(0xe670a46edb876ff9), W(0x9fa01e90eb25b46a),
+     W(0x216a79ed3ec94540)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb7ff1e3c63ec25d5), W(0x34eb853ddb0e0ecd), W(0x6abf274e8585f678),
+     W(0x1c5631cb042f940f)},
+    {W(0x9316062ed878876e), W(0xe33fb504f646f4da), W(0xbe768e51e8325e17),
+     W(0xa149fd9f34669720)},
+    0
+  },
+  {
+    {W(0xcca2d240253fc4d8), W(0x665bd37c6bbce9fd), W(0x068259351894ef09),
+     W(0xb778698de1e94d49)},
+    {W(0xf7375453d000ae5b), W(0xff480ab33cf25ac5), W(0x7e9c73cd5bd55565),
+     W(0x8b94ccdb9e93c4dd)},
+    0
+  },
+  {
+    {W(0x9d14350691113dde), W(0x96cf601ffaa36cd3), W(0x5c3e3e3484c9ad57),
+     W(0x23bfe8fa40d2a664)},
+    {W(0x6aa979c80b0e3449), W(0xd6826281512709f7), W(0x0b325140dddcf6f8),
+     W(0xfe84573c3b96457c)},
+    0
+  },
+  {
+    {W(0xc41f39152bc3aae2), W(0x647c4281b3e50c95), W(0xad4c2ad6f96fb010),
+     W(0x7226aecf177625fc)},
+    {W(0x37ba555d84607f8c), W(0xa03071cbb543a91d), W(0x3d211ac9053d0710),
+     W(0x164fa46a5c2a1d89)},
+    0
+  },
+  {
+    {W(0x6ba16f01aab60c4a), W(0x6a49482b30fc6d9e), W(0xdb8b259e2c53529e),
+     W(0x8b7c86ff2d84e640)},
+    {W(0xe00db5ab172d799b), W(0x757c12d8515f7b43), W(0xb4cb0db24f670d61),
+     W(0xd3d0ce6cdb7851ef)},
+    0
+  },
+  {
+    {W(0x901148b82601a0f9), W(0xd159b7b51c2f6728), W(0x5e68fc11cc954a0a),
+     W(0x41ae292b39fb7506)},
+    {W(0x22cd6ac6d3f431e6), W(0xbffb87b485600b52), W(0xdccd3777df10ecaf),
+     W(0xbf2802da49156937)},
+    0
+  },
+  {
+    {W(0xad138ad6ac56a0ec), W(0x91c0ff9d3e323ab2), W(0x1bf49907010cd90e),
+     W(0x06c2f2da79984b29)},
+    {W(0x853bbd616f121efb), W(0x9de9a724af023e33), W(0x2d68acbee264e3f7),
+     W(0x5bcea7a453567079)},
+    0
+  },
+  {
+    {W(0xc04700aa4e52ea93), W(0xfabef0f2045fc580), W(0x5dc7a6697576a121),
+     W(0xc9fb39cb4199b106)},
+    {W(0xd32e50b582a264e5), W(0x74602584bfb73909), W(0x302beabc5a6d6668),
+     W(0x36a212c71d9d4cb8)},
+    0
+  },
+  {
+    {W(0xdc56ad12a684c4cc), W(0xcd01513525ca322d), W(0x5518f85156c6c0b1),
+     W(0x91c41e08ef99bae5)},
+    {W(0x2e1cc3ecaf2ee072), W(0x6da5f7b842e5c30c), W(0xbb15196deb7dda7f),
+     W(0x4ad3a5ed8ae54b09)},
+    0
+  },
+  {
+    {W(0x5129d490e5903999), W(0x71bbed7cdfe67b88), W(0xcbc3fb6a661b6308),
+     W(0x042d4851642607c5)},
+    {W(0x5c6dd6fc8bf032cb), W(0x3985768c366e6ac4), W(0x3d974b3f93858656),
+     W(0x830cd9ad70b4cf73)},
+    0
+  },
+  {
+    {W(0xf989040f95fae260), W(0xeb7555917133fd09), W(0x2da8b8bf9bb584f7),
+     W(0x8d837f26a9434925)},
+    {W(0x228462c1d29ab546), W(0xda5fbf208cb0b0f4), W(0xeddda0ca7e82456a),
+     W(0xe649eaded65cf460)},
+    0
+  },
+  {
+    {W(0xc8a7cd45d56f17d9), W(0x4ec8f9f44c17b422), W(0x93d2d99c0fd73313),
+     W(0xa760d4b6dc005772)},
+    {W(0x05476c8ed6d851d6), W(0x1de4bcc67f44fefc), W(0xad3dedbae70e7035),
+     W(0x0c1ab0af31c02e8c)},
+    0
+  },
+  {
+    {W(0x2f218de51109b6fa), W(0xe6eb7a5cc24ff1ca), W(0xbe3e261c1f049b46),
+     W(0xf11cc182d73c3539)},
+    {W(0xb0ed4779d8a731e5), W(0x20210d1b23b76c75), W(0x0e5483bbb89a26f7),
+     W(0x3305563cdc945cbe)},
+    0
+  },
+  {
+    {W(0x568126919606719e), W(0x733d80a22554f583), W(0xafe5560a9037a50b),
+     W(0xdc48cb05f356ce48)},
+    {W(0x9604073a01870bb6), W(0x697860a076eb4ea1), W(0x3f60bde607a9b184),
+     W(0x991fe17ef4cecb16)},
+    0
+  },
+  {
+    {W(0x99c35fa2f8920f1c), W(0x7b427b6a748e65d1), W(0x6140795503a654a4),
+     W(0xa8168b57138186a9)},
+    {W(0xa37cc85195a32e4b), W(0xea01a3e95590a3d7), W(0xf16011605fcc0d10),
+     W(0xf61d3770eb50613b)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x1e41e6c6161994bd), W(0x826e3e7d3bbe1a5a), W(0x96eef1a91959a233),
+     W(0xda19b770fddbccd2)},
+    {W(0x4ef2d04b043ecc44), W(0xfe0a70e2717959f3), W(0x9cb08894e4d35ace),
+     W(0xe7f33491e624edd2)},
+    0
+  },
+  {
+    {W(0x30050eab22a925ab), W(0x04ca1b18c17fa9c3), W(0x65cefeab2e78c658),
+     W(0xc41fad727438db43)},
+    {W(0x325ed5fdd4e767c2), W(0xf8f234322f231c8c), W(0x4113b363461be3ba),
+     W(0xdb7f3ed1f05d9065)},
+    0
+  },
+  {
+    {W(0x48f3da8261a84855), W(0xaba0fd9e0f833d73), W(0xb394fc65ca2a4697),
+     W(0x6d1396d7235b671b)},
+    {W(0xd0e4f469d30eadfc), W(0x7793c845bbba35d9), W(0x8a1df169e6720c17),
+     W(0x61a6ad6c692513d6)},
+    0
+  },
+  {
+    {W(0x11a6c189db30b8e4), W(0x05c8c37f86e86078), W(0x49e7b2a2c1d86e41),
+     W(0xe2d5caf25b7ec203)},
+    {W(0x9b2d14c86e0bc3f6), W(0xbccfc175fb1996c3), W(0x656d73419146034d),
+     W(0x1b52695f4ee15b9e)},
+    0
+  },
+  {
+    {W(0xb5f6d463806b9289), W(0x3ea598cc3a6b0c34), W(0x15f45b42584f7281),
+     W(0xe1d5c601bc7ae6a1)},
+    {W(0x54e77c12c047baf7), W(0x8a28dacd8d094856), W(0xf97a4708c966a377),
+     W(0xab6d968d1194bcb1)},
+    0
+  },
+  {
+    {W(0xa1a419c0dd66df72), W(0x3d6163e1220d437b), W(0x66f4ab9648f65b65),
+     W(0x7bf2e16624c1b07a)},
+    {W(0xa5f752daf7d59ed7), W(0x822a36a7397002b2), W(0x2217d8ba95a0eef2),
+     W(0xc638e2ff112130cf)},
+    0
+  },
+  {
+    {W(0xf54e8f53fee7400a), W(0xcbf23a535440ecb8), W(0x671454fee144a499),
+     W(0xe4271d4cc2f2417b)},
+    {W(0x9959256a1192e312), W(0xb6047a30f136183b), W(0xdab5ac051401c327),
+     W(0x6e6be56ef2165db9)},
+    0
+  },
+  {
+    {W(0x129991cc8d50f5e5), W(0x8bd33e4c9bb3eb63), W(0x265d11e855237dc7),
+     W(0x1b18a622097c7dd8)},
+    {W(0xa70c971bdc82b2f0), W(0x8a327174b46475dd), W(0xc691c628a02937bf),
+     W(0xe0116a1ab25bf0c1)},
+    0
+  },
+  {
+    {W(0x0eadd7ba1e68ac58), W(0x6963f5e705e7a8c0), W(0x62bc8e20a92975ec),
+     W(0x7d3d6a2652212edb)},
+    {W(0xb7f552ba9382fac9), W(0xc30f74eaa173d279), W(0x39f4255cf689bf28),
+     W(0xd4c1031c043f8c73)},
+    0
+  },
+  {
+    {W(0xecc2e3bfc3f6f6eb), W(0x8c6233d22e4fd949), W(0x9ff84df08c19dfda),
+     W(0xc3684199c904b53b)},
+    {W(0xad9167402ed805a0), W(0x86d86fecbb9bc118), W(0x877592ca831e2f8d),
+     W(0x937979a737c00fd1)},
+    0
+  },
+  {
+    {W(0x5a04432de0658781), W(0x4f203a2ebe1929aa), W(0xebb4daec3f6f221f),
+     W(0xff4411db35d1aeef)},
+    {W(0xe0a08abf44ba9de5), W(0xd9d3fc157ea89691), W(0xcd46c3ec30688617),
+     W(0x373f16f48a0734ee)},
+    0
+  },
+  {
+    {W(0x5660e8b7ce187425), W(0x561d2ba55cd84819), W(0xf9d5e4cd70e054c9),
+     W(0xf675f65cd22f695d)},
+    {W(0x795c01d5c9bb644e), W(0x672e2eb49b850e12), W(0x2ab5d236ca1ea12f),
+     W(0xe35e8cf29beb4af0)},
+    0
+  },
+  {
+    {W(0x21ff71d726b755d6), W(0x0a54a557a6bc1bf1), W(0xeada3cf2c3c6ae77),
+     W(0x6bad9c4f37e04bcc)},
+    {W(0x8f73c6d79a23232a), W(0xe5c6d4a4b5dfa064), W(0x309fe482f0fa7ca0),
+     W(0x4301332acdda03ee)},
+    0
+  },
+  {
+    {W(0xd91e4b879b95abef), W(0xcf26629615d527b6), W(0x220c63debe77897a),
+     W(0xe2e9aaefe1db621e)},
+    {W(0x6ff70ca7ef78abe9), W(0xcbac3b6d606c6691), W(0x853c8652c1b3edb0),
+     W(0xe9991ca76c950049)},
+    0
+  },
+  {
+    {W(0x572e50e16e606237), W(0xc353ebf6b5c36fd1), W(0xbb424ace8f336b04),
+     W(0x41070a8d7a1a3f2c)},
+    {W(0xba899da744d216fb), W(0xc3c67a0cd9ae60d2), W(0x4239c94c7b0adfe6),
+     W(0x31707fcecb9113de)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x4ce5f7dfbe92a7b3), W(0x47b3ae5b73b3343e), W(0x50f4f84e5b420387),
+     W(0x9f0ab1f288310928)},
+    {W(0x74ebb140b12d1d1c), W(0x0ae6cedd31ac2cba), W(0x32723384c21bdd1e),
+     W(0x6f96281ad5c6c2ca)},
+    0
+  },
+  {
+    {W(0x8abe2721439eb333), W(0xa25898fb5ef06c04), W(0xc0457e1209e8a2b3),
+     W(0x42a82291d3db51ae)},
+    {W(0xfa5694d6bb8b6574), W(0x96c9d0d7821a7c54), W(0x6ca9c8709c7307f1),
+     W(0xdf986b010b61315b)},
+    0
+  },
+  {
+    {W(0x6803bfa3dcd19554), W(0x4234c6c0bf57cdb0), W(0xc945ec0c997d12fe),
+     W(0xa17edb0e9c54da30)},
+    {W(0x5cc6ef69fc237636), W(0xe62ba95836b02a53), W(0x4432e65a132e449a),
+     W(0xecff6fe025c1d9fc)},
+    0
+  },
+  {
+    {W(0x00956ae72414cc1f), W(0xddcca61c9269a256), W(0xb6b0b7a898debc25),
+     W(0x8d22f26d6219098c)},
+    {W(0xe6886816155b0f5a), W(0x98bf1dcaa6bbf8ab), W(0xad753cfba7a5125c),
+     W(0x2776abcbd035cdd4)},
+    0
+  },
+  {
+    {W(0xe810f115a340af20), W(0x43bfba7d89260e53), W(0x0476496ee1e0f019),
+     W(0xa348f9d5d2180fd0)},
+    {W(0x0dd877a0aaa7d4ac), W(0xd423cc00f2fdff1b), W(0xe389d8f487fa9ca9),
+     W(0xb7632e789b779eeb)},
+    0
+  },
+  {
+    {W(0xc0035bff51e4cf6f), W(0xe0d8236c65a85cff), W(0x63c065c989908d00),
+     W(0xb0c43bcef6e3d3fa)},
+    {W(0xf341bec461495900), W(0x8f433c32addd4456), W(0x2c72bc13b2438297),
+     W(0xd87de714a2792ad3)},
+    0
+  },
+  {
+    {W(0xfa966958c2beeeaa), W(0x0c86aebb7dca9eab), W(0xf9fe0d01dec1e2ed),
+     W(0x52b056f464a2c031)},
+    {W(0xef9c4fca3265fef6), W(0x2b72b0cd399397bb), W(0xaebab534bdf4f8da),
+     W(0xfe2ff212d912b515)},
+    0
+  },
+  {
+    {W(0x7ca7b84653dec3c7), W(0x687e1823f496bdba), W(0xc80b3eb2c3dcb9e2),
+     W(0xacc353e384225ce8)},
+    {W(0xe05e65dc0d095866), W(0xf0e672bbad3cabcb), W(0xd41d56846418c792),
+     W(0xbf3a93c17e054eae)},
+    0
+  },
+  {
+    {W(0x9adb8e39b490b135), W(0x3385307cd6225d98), W(0xf6321e232d072108),
+     W(0xc601dcfa58541ee0)},
+    {W(0xa2c38fe7f3d24845), W(0x4557c44dd9965a2a), W(0xfbd66b3745eb8668),
+     W(0x9d8efd41929b4677)},
+    0
+  },
+  {
+    {W(0xdd60ec50c6a521cf), W(0x88d5c83066bafaea), W(0x036e93ae90c753c5),
+     W(0x1d660e7782fc62d0)},
+    {W(0xe9bbed58ae1e484b), W(0xf7f0568bebdcf72c), W(0x960adc2afeb619f5),
+     W(0x810262c0ee7551ce)},
+    0
+  },
+  {
+    {W(0x979305e8e024336c), W(0xac7aa44c972119e1), W(0x8d836f4945b83078),
+     W(0x25a9109c4edefc45)},
+    {W(0x3a257a862a833e9b), W(0x55c65b049a5adeed), W(0xdf61cb751f0319d5),
+     W(0x1cc7716b72226d0e)},
+    0
+  },
+  {
+    {W(0xb1ee1e1e660806af), W(0x8034391858d6f28c), W(0xc45fd605e65147a9),
+     W(0xd2549da2b6350936)},
+    {W(0xe911e5cf327f65fe), W(0xa67ab2212e6a8798), W(0x1e65bff2877d719f),
+     W(0x0c442e6202eed54f)},
+    0
+  },
+  {
+    {W(0x8ae22d4304403982), W(0xfa823ff4d536fad4), W(0xb48754f6900c62a8),
+     W(0xdd769a75d83bedf6)},
+    {W(0x12c896b1f594eb9f), W(0xc4059242501f6c2e), W(0xc70706002b3b5866),
+     W(0xb8816c0d61f47fdc)},
+    0
+  },
+  {
+    {W(0x60bf7a8571bef7bf), W(0xca4541bb499f05dd), W(0x7bb29d185935aa50),
+     W(0x67720fca71d663d7)},
+    {W(0x44e3e79992db1dfe), W(0x508c209b675546ec), W(0x1266ef62be501e4f),
+     W(0xb8edd0eb730ade56)},
+    0
+  },
+  {
+    {W(0xd07bbc7415c01622), W(0x2a1b8c7e700f7410), W(0x03288c225e26f445),
+     W(0x9f677c264c981a6c)},
+    {W(0x529ad175dc6b7767), W(0x331b6fbb0cb6a4db), W(0x74759cea5518c5bb),
+     W(0xf531ddcc03ff7788)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x43f65311b9849d3a), W(0xcf67262bf1c8ddd6), W(0xaa685dfc0bd30c3e),
+     W(0x6b3e8009982c272e)},
+    {W(0x5f17349c58c77cad), W(0xedff544c6bae8b87), W(0xa4f3c6167756877f),
+     W(0x773e0a1e1c1efc86)},
+    0
+  },
+  {
+    {W(0xad976b8287b9fb99), W(0x3573fd74da3bee6b), W(0x45918654903689fd),
+     W(0xcb9f0686d7972b58)},
+    {W(0x650da92bde558c9b), W(0xd1952ba06ec49cc0), W(0x8c0d5c2035f28ce4),
+     W(0x9dcfe8e11ec23e29)},
+    0
+  },
+  {
+    {W(0x3cf0e50a7dcf8453), W(0x04f6ec5156d291c0), W(0xa661543cf0f18428),
+     W(0xf97d4d621accb2b7)},
+    {W(0xf1761c6be61d301d), W(0x596e5601e448c129), W(0xcb03c52272a0f666),
+     W(0xa7e1472725e7a1f3)},
+    0
+  },
+  {
+    {W(0x6db16b9f52976cf3), W(0xe529ce99619d4735), W(0xca300a12e78d3b8b),
+     W(0x0102c5de950758de)},
+    {W(0xf5c942ad2d07d024), W(0x39845b0864391219), W(0x903010b3a3a15fea),
+     W(0xc43a27b3e4a6ee10)},
+    0
+  },
+  {
+    {W(0xb1d944fe97c20835), W(0x491c326683dcc0a5), W(0x05844f68ffcbae26),
+     W(0xed986ff4df3dddf1)},
+    {W(0xf43354536e99c870), W(0x1bdac226504d4bd8), W(0x83d0daac0c6f81f5),
+     W(0x38a38b11e8bc390a)},
+    0
+  },
+  {
+    {W(0xe0ea95e93707a48e), W(0x92dce89f25b9ce83), W(0x50f98c4598fddec9),
+     W(0xf855c25e9611499c)},
+    {W(0xa2ac4b6e6bc5c7e1), W(0x1d785c06eac603dc), W(0xf1ea511dbcd0f392),
+     W(0xe65e53d0a3d9c63b)},
+    0
+  },
+  {
+    {W(0x278d5506694b252b), W(0xcf1f2fa2a19b908b), W(0xd7017566593f6309),
+     W(0xb59db87a94446be7)},
+    {W(0xefb133555dabd5a1), W(0xdb181ec13ad29b54), W(0x9c922273493660a1),
+     W(0x6417e2ddaee2937d)},
+    0
+  },
+  {
+    {W(0x8cfefdef55aad0c0), W(0x7333fdd0abd08b50), W(0xf7a4cba66cc6cbbe),
+     W(0x33d19dd74b6cab8f)},
+    {W(0xa68ae7fb251a53d9), W(0x899359f8cb4027a0), W(0xebb3b4fa51545d57),
+     W(0xaf9911070c22d827)},
+    0
+  },
+  {
+    {W(0x38f691c9af4d3447), W(0xb5f699abb3e917ea), W(0x86f167192b1deace),
+     W(0x9ec95fbd84cbe734)},
+    {W(0xf02cc3f66eba1abf), W(0x461a5e589aa8180c), W(0x4dc2a0c8a3ccea6a),
+     W(0x5c69a75d0798909b)},
+    0
+  },
+  {
+    {W(0x3f3c4e32ce934ce5), W(0xb28527e39ff4b9b4), W(0xe9061fe7c72002f6),
+     W(0x607f2bb5b9769e95)},
+    {W(0xbaa8cc5ec32000f7), W(0x01e614c3bd48efd7), W(0xd9b34d2dc14632b1),
+     W(0x1ae81a22768a21ca)},
+    0
+  },
+  {
+    {W(0x829a0c65b447793d), W(0x30acd0984e25d120), W(0x9ea332ff0d303f6f),
+     W(0xd3fb28a422ed4ded)},
+    {W(0x810ce8f56903e164), W(0x808b461f1833c609), W(0x4072c30972522af8),
+     W(0xd2d8211274db90db)},
+    0
+  },
+  {
+    {W(0xc2a3ab6b99daa475), W(0x90b14d1b4becfede), W(0xce429c023d9d0afd),
+     W(0x06808d581c8b2aba)},
+    {W(0x0d93617a80ad39ef), W(0xf74bec7f8a43be32), W(0x289165a860a05c2e),
+     W(0xf0af33242362cf24)},
+    0
+  },
+  {
+    {W(0xe001376273ac46e8), W(0x206b18365af4d4f2), W(0xb03c0b4889a8f1d1),
+     W(0x95e3e1cf640bf665)},
+    {W(0x297e499e86fb997f), W(0x81bd727cf60d8eb1), W(0xc515f493720f096b),
+     W(0xf7597cf286a94d0c)},
+    0
+  },
+  {
+    {W(0xae0f278fb6b44a5c), W(0xe68726a1c515289a), W(0x898b63052b40e5c7),
+     W(0xde7299f81ada5a90)},
+    {W(0xa2c88f5ff9d08f93), W(0xfc2bd7291e63009f), W(0x0807272cbea2b729),
+     W(0x9a63b1b9218dd90b)},
+    0
+  },
+  {
+    {W(0xa020d4e63d1419e5), W(0x242ac140ac6abc2b), W(0x788495c8106b1d87),
+     W(0xab200ac1ce9b245e)},
+    {W(0xa20dce3d4e5f20eb), W(0x565aeb303bf92e6f), W(0x3356cb1aa755073a),
+     W(0x48ea9c5f85fe856a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xa9ac0ba8cd18f7c7), W(0x2f247995f810659f), W(0x5237e1a8ef7b847f),
+     W(0xbb6494b59726b24e)},
+    {W(0x409fe17bd6365612), W(0xe6b1746962524003), W(0x96d999ebfbeae701),
+     W(0x1e07052422a68973)},
+    0
+  },
+  {
+    {W(0x8804d814bd6f5691), W(0x87d7cbf247626e7a), W(0xa306c2a10cae3517),
+     W(0x28db9e3945bd18c1)},
+    {W(0xa5fea55121ef3e76), W(0x25be281aab15c554), W(0x142afa423a800191),
+     W(0x3423e674c00648a8)},
+    0
+  },
+  {
+    {W(0x1c928fa4c0ddffc6), W(0x919ca89dd9d3114e), W(0xb325bd1ff9b68b1a),
+     W(0x3a728dc4b541c336)},
+    {W(0x91106d3900a2090b), W(0xb436f896ee24897d), W(0x875f54e5cc998753),
+     W(0x12c516e344100fed)},
+    0
+  },
+  {
+    {W(0xb924c20953187aa5), W(0xf48b71be71fef056), W(0x6dbe2bb164d96d4e),
+     W(0x39431f9dd6243d76)},
+    {W(0xa16ad31970b0fb54), W(0xe0dbfa7e24947691), W(0x79f5e35026fa488c),
+     W(0x1d4bef31cb7bbfc3)},
+    0
+  },
+  {
+    {W(0x51eaa60284884068), W(0x0f131d01ccbe805a), W(0xc59453570eaf545d),
+     W(0x8a956a593e013664)},
+    {W(0xb988b97eebc31ec2), W(0x0c605e1b663721b0), W(0x61ceedc7fd67f2e0),
+     W(0xa492935643185618)},
+    0
+  },
+  {
+    {W(0x6b48dad85ce13b46), W(0xccf1d742b24cf98c), W(0xd23cb1e2cb13352a),
+     W(0xcf631d5fd6afe639)},
+    {W(0x4efc3e7f3eaff993), W(0x6d964ec95b696cba), W(0xcd83e6d8c084c309),
+     W(0x6dd4d00f83222c44)},
+    0
+  },
+  {
+    {W(0xe877b9cf36a6cfc8), W(0x550b377a0e2c810a), W(0x6002de3991c3d04c),
+     W(0x846fcbfa2cbdac05)},
+    {W(0x53bd87abdaad1910), W(0x33b0d12eb2f1e5f3), W(0x838b0f7b9747569a),
+     W(0x9b222ecad49fcc87)},
+    0
+  },
+  {
+    {W(0xb578242b66dd92a2), W(0x1dc43436f7c1d9cc), W(0x19de13396209be19),
+     W(0x8345aaab0f752c70)},
+    {W(0x321363554bef76eb), W(0x14d1bf6f5027b622), W(0x6e02958c49589ecf),
+     W(0xaa815119e8204c6d)},
+    0
+  },
+  {
+    {W(0xfb22ea29c9985be6), W(0x3a053872ce865b90), W(0x97c2d10d5a5bbe43),
+     W(0x16244ebbc0fae4ca)},
+    {W(0x77e5454ee7c85368), W(0xdda535fadcbee930), W(0xfc72a74df5a09625),
+     W(0x36673757712b75c2)},
+    0
+  },
+  {
+    {W(0x0b71993ed6bff7c5), W(0x73a97052854b4268), W(0x14142e0f9384c1f3),
+     W(0x9ddadde330e24766)},
+    {W(0x94ea466e5f7d31dc), W(0x4958d0fd27b4de48), W(0x886b1340e9f4c8b5),
+     W(0xdb81ec195cac9a87)},
+    0
+  },
+  {
+    {W(0xeddf5baee498e241), W(0x7e22f9b03642a092), W(0xbddec893822c6bb6),
+     W(0x1f6cb38dd6116178)},
+    {W(0x44524365dfd7e550), W(0xcf9d7cc3ee327cc9), W(0x8b95b8385f50d793),
+     W(0x51d362e198951b41)},
+    0
+  },
+  {
+    {W(0x98d1d434ba302229), W(0xd69b84d54752fc22), W(0xdf64ababfc89b366),
+     W(0xcad34a781ffa5a86)},
+    {W(0xcb182ef789fecf33), W(0xf584eac7fad468fe), W(0xbce50a6712192df7),
+     W(0xa0af7e142c674c0a)},
+    0
+  },
+  {
+    {W(0xb1e1a5f96cd4e85f), W(0xffb7e7a820e434f6), W(0x2015801707a942d4),
+     W(0x2b9200a4d7e430fc)},
+    {W(0x32fbec95c2d5db50), W(0xa2795aa209941cd8), W(0x1e56fd3fc6c09b62),
+     W(0x9fa492ee65b508f3)},
+    0
+  },
+  {
+    {W(0x4dd64f567d7d01eb), W(0xf773875b3340308b), W(0x9da860b3fefe56c2),
+     W(0x68dc178e8c082d57)},
+    {W(0x1d4b80544f2dcbc1), W(0xae29efa3372bb57f), W(0xd1305864e9c6c1c2),
+     W(0x074c05eaeda23e9b)},
+    0
+  },
+  {
+    {W(0x118a865693b209b3), W(0x4fc40a13b66ed360), W(0x77adfe614a07f5a7),
+     W(0xb89a10202aeafe5e)},
+    {W(0x647b8ff0997d4ee2), W(0xa2901e7de6cc87d7), W(0x2014ed6c90537889),
+     W(0x5c9c8f97e19e6942)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x9d45c63bf32eb964), W(0x6ce89abe40eb2caa), W(0xba22b299f7897292),
+     W(0xa3f1f2c46eb36131)},
+    {W(0x5f6431b213653600), W(0x3e890c6787cb87da), W(0x8c1fdf17e9f9dae6),
+     W(0x3a5f0315dde61148)},
+    0
+  },
+  {
+    {W(0x6453ec21f0e363fc), W(0x32d9097d2f563f00), W(0xd9138da021c6c3c2),
+     W(0x5ede72e9a4af14d8)},
+    {W(0xf28778075f7e0f3a), W(0x902a6718a1d8cb76), W(0x3f5995b00aa1055b),
+     W(0xc042ae09bd39ac08)},
+    0
+  },
+  {
+    {W(0x875a1a800f385e25), W(0xc9af3f656c64cefb), W(0xf04533d4940d0d3d),
+     W(0xf4ba7908ed037857)},
+    {W(0x87c8d282e0a65f64), W(0x330d4fce8d36e063), W(0x63be53d3e7d8a190),
+     W(0x21d8b8eda50f4421)},
+    0
+  },
+  {
+    {W(0xe4560927384f7eac), W(0xbd99f62269c875ff), W(0x7410097328964fdc),
+     W(0x50cbf1258054bcea)},
+    {W(0x353f31b706a058ac), W(0xd3b877ff26a946c9), W(0x498a5c1f5eb0be15),
+     W(0x05b58fe0eb747a39)},
+    0
+  },
+  {
+    {W(0x4114da9c2ff08571), W(0x9e6efc68f77f1ec6), W(0xc743c435626d49b7),
+     W(0x222a8f20d72e683e)},
+    {W(0xf864ad6f986cfcb9), W(0x52eeb7d21fbe2e80), W(0xb337c8e52f6e6e3b),
+     W(0xe3b1fae9194b512f)},
+    0
+  },
+  {
+    {W(0x8803a02945bd053b), W(0x74ac8dbed710ab22), W(0x85ec80192decdf50),
+     W(0x5dbd78f27cfcaff8)},
+    {W(0xe1cf9cfe9cd975f5), W(0x877f64f7f3c8cb17), W(0x7f4a8e85e2af3650),
+     W(0xa9f64e73db0df0b4)},
+    0
+  },
+  {
+    {W(0xd97a96f108daebe5), W(0xd922cf879d8999dd), W(0x897c7d847936f3f9),
+     W(0x27b549ab4e7b7181)},
+    {W(0xed0ee3614e5b0ad7), W(0xbdff6d60da8f8e55), W(0xe956c0944c048c02),
+     W(0xd24779a03143822a)},
+    0
+  },
+  {
+    {W(0xfd2ee3a75c85a96d), W(0xd2522a65500a7de4), W(0xf8fd6e88302acaab),
+     W(0x7650501b5091d4db)},
+    {W(0xed696481bece48fc), W(0xed0f758f7c607061), W(0xa50c5f12777a784e),
+     W(0x277930ac644bb580)},
+    0
+  },
+  {
+    {W(0xd7ea5eb8f4b02df7), W(0x826b8171133b9067), W(0x2e56754405b4586b),
+     W(0xc87d043652e52090)},
+    {W(0x6c7a5fb3cf553d33), W(0x75fc9e60ab2bc72b), W(0xbc9736610d51e204),
+     W(0x2e7cb72a458fcb99)},
+    0
+  },
+  {
+    {W(0x5a08776a2d9ec63f), W(0x22614813776568af), W(0x8e197657a145ba7c),
+     W(0x3468be07a372b8e6)},
+    {W(0xf5a8d6ac98a3aa4e), W(0xb58009d092fbd5be), W(0x2ad89b86f5a94b3a),
+     W(0xc04ce48813d60079)},
+    0
+  },
+  {
+    {W(0x3b745d057a82db50), W(0x377938c4ceddc596), W(0xe70be50e28257693),
+     W(0x9421e7ccd0c1ece9)},
+    {W(0x3c6f491522a30b1f), W(0xa15983e2cb4bf4a6), W(0x52bb7d0b2c1ab6c3),
+     W(0xe0b506d4b76c66ce)},
+    0
+  },
+  {
+    {W(0x4080c1a3d5e1267f), W(0x3fc805f362f6d0bc), W(0x24a0634b317c2d71),
+     W(0xba5b5bca1f1f1948)},
+    {W(0xcbf9325f145e1df2), W(0x52b2eb5d61b9b08c), W(0x74d406c1eceac0fe),
+     W(0x4aa6d72ddce9e7da)},
+    0
+  },
+  {
+    {W(0xda65d855ac3f9a8f), W(0xa7c356e540086414), W(0x0579402df71fbb22),
+     W(0x1bbac46b236615d7)},
+    {W(0xee71254bffe77253), W(0xaef4d509df039d82), W(0x7af91970a3a5157d),
+     W(0xf55d2acd748ae6ea)},
+    0
+  },
+  {
+    {W(0x7e5d186c21fd51c9), W(0xc491f2fbca9ae443), W(0x510b2cb913b64f79),
+     W(0x7dcb143840167346)},
+    {W(0x7d359f0fd5faa5b1), W(0x13c5efdeb5752266), W(0x8d3cedf298c89a58),
+     W(0x09f219d09bc55541)},
+    0
+  },
+  {
+    {W(0xd705e8312b03d345), W(0x3cd03b52793eeff7), W(0x68e178b49eb93fda),
+     W(0x0922f392ccb349b1)},
+    {W(0x27c4ec4b97da1948), W(0x0765fe47c345c861), W(0xed606516f2164813),
+     W(0xb40a9925e83d5c11)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc3e688615a345feb), W(0x947326319e673ee1), W(0x1ca9e16a919dd1e0),
+     W(0x5c5fd6437ee72ece)},
+    {W(0x6cb9289e44132d93), W(0x13ce88849e412dd2), W(0xc591ca98e5575763),
+     W(0x54d16b233d95dba6)},
+    0
+  },
+  {
+    {W(0x5d14b945cd23150d), W(0x4c629bdd7073aca6), W(0x8b490f102ae90a54),
+     W(0x90ac92731b954905)},
+    {W(0x60d66e57cc859916), W(0x8efc0c934623ec12), W(0x7cf43e52ee6446d9),
+     W(0x52f0ed703b876c0e)},
+    0
+  },
+  {
+    {W(0x8e2f513b408b21aa), W(0xc032914949c93f2b), W(0x3fa20bb801763c25),
+     W(0x79a4e37244f03ae8)},
+    {W(0x62c001669e656f07), W(0xf60e4ef8d4f7d001), W(0x53f418362fb833e1),
+     W(0xebd0505344306f46)},
+    0
+  },
+  {
+    {W(0x7e129f0cbabc0ced), W(0xdc3779d2387a00e5), W(0x565b9104fd877781),
+     W(0xbd0a82a0b9b0b6cd)},
+    {W(0x8d3441c17100e5f6), W(0xacb6ff06ac644c87), W(0x3c225d8b53338b8e),
+     W(0xceb3d5a18c1af351)},
+    0
+  },
+  {
+    {W(0xc1d3bb339a5a0468), W(0xc03b516e61982d21), W(0xa9048cd2b291fef9),
+     W(0x980ad516a8804afd)},
+    {W(0x70f6be8cd0e79a72), W(0xb6d54735f4732024), W(0x806a101883e1ab7b),
+     W(0x9778043e3990d8c7)},
+    0
+  },
+  {
+    {W(0x077699bf93866048), W(0x65f55949ff9227d9), W(0x16fb1b59cfcda703),
+     W(0x2e6c84dd21900a7d)},
+    {W(0x64e516ee135d0e83), W(0x0b23f59a3468b0c5), W(0x82c7503f28ab03cf),
+     W(0x996c402c16e205fc)},
+    0
+  },
+  {
+    {W(0x50df5a9a419e91be), W(0xe87107c6de5e495a), W(0xe97947445d5e19e0),
+     W(0x4dafa96a72da213e)},
+    {W(0x0e6e8b4fc3fa8e86), W(0x1b8f7cd1b6d77ca7), W(0xf8d828b3706df6a6),
+     W(0xcdf6af0e53d87715)},
+    0
+  },
+  {
+    {W(0x6cf10c241a9c897e), W(0x0dd8e724916a1205), W(0xcc7064c5fa0d3140),
+     W(0x6c86ed3684dfd5aa)},
+    {W(0x76dce975577c7929), W(0x52f906bc5bd6ed9d), W(0xf3ea668d7c6192a4),
+     W(0xe17f070a6029320a)},
+    0
+  },
+  {
+    {W(0x1eac24b37469061a), W(0x3dabd22c4316c77f), W(0x8482ceddff89a312),
+     W(0x55fcf94b2c1f6053)},
+    {W(0x33ec6f788fd0d21d), W(0x69c11b6c73659d64), W(0x526daf7156a3a2bd),
+     W(0xbca687e9fa361075)},
+    0
+  },
+  {
+    {W(0x2e4789e8933bf0bb), W(0xf116229a966d990d), W(0xeab882fd533d663b),
+     W(0xb80458371a8dd311)},
+    {W(0x81653c5a4de2017d), W(0x8fb93d7872913079), W(0x7fabbd5b9a881d4b),
+     W(0x412c455c6917a675)},
+    0
+  },
+  {
+    {W(0xcc2edabb6f141551), W(0xb7abf17c37da30a4), W(0x6ba126be5a5a4ae5),
+     W(0x62d57539f16420fe)},
+    {W(0x0d0f184d60120f8f), W(0xfc476acdea0e3002), W(0x44abf2f75c72feca),
+     W(0x9475f1b27dc4f7d8)},
+    0
+  },
+  {
+    {W(0x73ab9d738ee523b9), W(0xbab23db2284aee1f), W(0xbd5ba3273ac14546),
+     W(0xa23fac5b608f0ba3)},
+    {W(0xaa9572b721d0ef28), W(0xceb5ef644298486d), W(0xa04e77a79ef8dcf6),
+     W(0x97f09c3d19c0045b)},
+    0
+  },
+  {
+    {W(0x7ed8b79c30ba26c1), W(0xb42be53ea98102e4), W(0x949b3df7f4b43279),
+     W(0x255d269f9567fee0)},
+    {W(0x403cb2bf7a243517), W(0x2a4c65d6e2ad23fc), W(0x94f1825ff908566a),
+     W(0xe069a98bfe213455)},
+    0
+  },
+  {
+    {W(0x4545362e30ea65dd), W(0x34f4dacbadb85796), W(0x90ad12a0b6a4ecb8),
+     W(0x447b03fac28967d6)},
+    {W(0x59838c20d19110b4), W(0x87b82f628a435879), W(0x8142a72943e29bdb),
+     W(0x8d0b0f183dfdc8b1)},
+    0
+  },
+  {
+    {W(0xca762e34fb979b3a), W(0x397bdcb5c18bbf21), W(0x96fa7329f6c2b420),
+     W(0xbf1704a8cddef320)},
+    {W(0xf6b4158c18d004e2), W(0x152f3bb6937442a6), W(0xa09c23c5d5761c0c),
+     W(0xed2f886fb41aee95)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb173531f2f5fdc0d), W(0x8e20f42294545d45), W(0x93670135f89feb01),
+     W(0xaf918dc69ab69a17)},
+    {W(0xf51bc727506fefff), W(0x422f1da2a4265311), W(0xe51daab5e7bc3d42),
+     W(0xf84e403f18c5efa9)},
+    0
+  },
+  {
+    {W(0xd42fcabc0252bb27), W(0xd31640b0232d58c7), W(0x8ed36735d668bec1),
+     W(0xda05206ec9ffdbb3)},
+    {W(0x74a5690dc2cc7511), W(0xd9f700b79307e6c6), W(0x4314cbbfddd1f6c5),
+     W(0x684e5fe3f6a56335)},
+    0
+  },
+  {
+    {W(0x8fabb8b58d74d480), W(0x5d5e811fa79780e4), W(0xab5d60561a913e41),
+     W(0x25752259c20fe5f7)},
+    {W(0x90e0ae01cc886df1), W(0x6ae21693a9b62a8c), W(0x8b0916178eb63740),
+     W(0xf606d236fa4582e1)},
+    0
+  },
+  {
+    {W(0xb8f9172790e060dc), W(0x851f6196af6c0a26), W(0x6d263d0a41f539ad),
+     W(0xdce679ec6f4d2c1a)},
+    {W(0x7fc664e2e2b72cc9), W(0x615b7e94d3b330cf), W(0x2b34720a203bea7f),
+     W(0xa8b5b403b60243e3)},
+    0
+  },
+  {
+    {W(0x7685371112a7274d), W(0x5dd7d95c7d831725), W(0xdbc498e2f83f65da),
+     W(0xe323328632c7c02c)},
+    {W(0x9de9f6df663c0e96), W(0x1add83b5090a516e), W(0xa5e6f88227746833),
+     W(0x97eb65ef35c40f7e)},
+    0
+  },
+  {
+    {W(0x2db9a12ebb9f4c25), W(0x009bff073203989b), W(0xf5d1a8e76515cf07),
+     W(0x078b67184158ebce)},
+    {W(0x399b1ca68d9d196b), W(0xedb679ec6ba0e82e), W(0xaf937a447aff2e61),
+     W(0xa090a90d76bc5ac9)},
+    0
+  },
+  {
+    {W(0xb86cfbfcd8c7aca5), W(0xccba70366f3aca13), W(0x09270e7b773eded2),
+     W(0x9c43b38f9a23bc52)},
+    {W(0x3e17e2578521005c), W(0xa42903e290627f29), W(0x507af91ed9399bcc),
+     W(0x017720184e4c7b9c)},
+    0
+  },
+  {
+    {W(0x73e4881f43948fd9), W(0x59a9232030366891), W(0x4bbabbc84ba4834a),
+     W(0x1c497968c82c07ab)},
+    {W(0xd0cd7131071532ef), W(0x98cc656baf7707f8), W(0x215b5613e243b3b6),
+     W(0x934a9326e6768fb1)},
+    0
+  },
+  {
+    {W(0x45631565b3122c04), W(0x48ebf151e01a0448), W(0x7a7c2caea7c20146),
+     W(0xfabf60d716d538de)},
+    {W(0xf9a06a3a1c97aa24), W(0xdc3a9e61aa8ee3bb), W(0xaced24dff81d967d),
+     W(0x1cff0126a06c9381)},
+    0
+  },
+  {
+    {W(0x0e065ea2d8bb1ccf), W(0x9d0c2fb882a00490), W(0x748cb0a16fd7a63a),
+     W(0xe24d7df5cf03ec9e)},
+    {W(0xae84d0a4ccaa20fb), W(0x690017a7ee89d9d1), W(0x6696973a805addc2),
+     W(0x07d78a3d6891f29a)},
+    0
+  },
+  {
+    {W(0xd8b3e5eeae9bb942), W(0xf7ab50d5e30b9a21), W(0x13338fc694cc4eae),
+     W(0xabefebf9c30cb7de)},
+    {W(0x72bfad006fb3eb24), W(0x4b22da33ea140094), W(0x76f8acc65f506970),
+     W(0x2f120a7405756f3e)},
+    0
+  },
+  {
+    {W(0x6f2127eee3e7b7ca), W(0x89a7e0a945de20da), W(0x0288d379ffcde936),
+     W(0x53d5b9790eb45390)},
+    {W(0x87e426db39aad520), W(0x990fa861b23f661a), W(0xc4ab17c9d6c44789),
+     W(0xeb462d154e12da8b)},
+    0
+  },
+  {
+    {W(0xe6040f91d869cad0), W(0x056e2d65177e259b), W(0x9505a12cf774d09f),
+     W(0x7286e7206a1bab13)},
+    {W(0x7c5e2822ffaad5bd), W(0xe9ad20469350f33d), W(0x74f184bf112ed8a2),
+     W(0xabc754c0ce5aea10)},
+    0
+  },
+  {
+    {W(0x733fb23f28499622), W(0xbd209811675fd0ec), W(0x9266af242338127e),
+     W(0x1c77dbffba9e4c22)},
+    {W(0x1d8fb5bda3017faa), W(0xf4f627d7d3f0d4bd), W(0xc39398fd30dcf029),
+     W(0x02da1f87705918a7)},
+    0
+  },
+  {
+    {W(0x75c8c1a99905d9a8), W(0x5cfeadbcec9a21e4), W(0x227d7a65c43a36e1),
+     W(0x3e8081873467e226)},
+    {W(0x223c5dabb250b4fb), W(0xa0b9af8cb3ed6a96), W(0x033055d460d1c260),
+     W(0x5cb09441546af3d7)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xbceffd5c86981a47), W(0x73f3fba7fd7b3c8a), W(0x68e7c94ceb8dbfff),
+     W(0xeeb9498c5ef58c7f)},
+    {W(0x6a3030c54682cc17), W(0xe489153411fa7606), W(0xee5f63177f67ec7c),
+     W(0xb54667fac1044c1e)},
+    0
+  },
+  {
+    {W(0x5a4eac4a4de9a577), W(0x90cc24f8f6fe9c02), W(0x8a0f6f18f8a905cb),
+     W(0xbe9e8262e4f1762b)},
+    {W(0x35576bfdecdf087a), W(0xba3e03880a6bc78c), W(0xb4e8192fa17c0a34),
+     W(0x4570ba905a880efb)},
+    0
+  },
+  {
+    {W(0x83a1d51ae1a62a2a), W(0xe87e402c7e853d0b), W(0xfe9a6035c4e90530),
+     W(0x54b5cebc4abefaca)},
+    {W(0x156199491d5169b5), W(0xc0f00556d73c1c4a), W(0x18e43a453cbecf5f),
+     W(0xeb01b421166de9cd)},
+    0
+  },
+  {
+    {W(0x90dc63e2aaf92685), W(0x3e04d9725dbb9cb4), W(0xce4fc96831e8c6ee),
+     W(0x1e97a81aa0c59074)},
+    {W(0xb01552343c304572), W(0xebb53fa6f8eb4b73), W(0x7215aa0e9805090a),
+     W(0xda3638f689850a7c)},
+    0
+  },
+  {
+    {W(0x19a86a03234e22ae), W(0xf68ea83728df8a46), W(0x084906506963bccf),
+     W(0x6456066c7b0290d9)},
+    {W(0xe88db82346499926), W(0x89286a637f1dee4b), W(0xc7c89dc492056fe8),
+     W(0xf2199a1559305ba7)},
+    0
+  },
+  {
+    {W(0x9abdd2e0ed296c83), W(0xfd1b5fb505520143), W(0x41fdc147081b3399),
+     W(0x1857f5435f1513b7)},
+    {W(0x3c8336ed9660f655), W(0xfce431ac0f10bfdb), W(0x0ea84745ca805a94),
+     W(0x6b90c9a51028dc9e)},
+    0
+  },
+  {
+    {W(0xc2b356691e8dfc9c), W(0x6821eccd0c63dd17), W(0x04ac5aa75d08af0e),
+     W(0x205d4f2ff22bb6d8)},
+    {W(0x410f9432150b9f08), W(0x030a14aa438ba36c), W(0x877bdbd322d085c4),
+     W(0x73fca18fe57bdbc0)},
+    0
+  },
+  {
+    {W(0x4036f60a99436a93), W(0xb8345c33d6fc4c47), W(0xd92e66ad6bf5efa3),
+     W(0x93ff4e742f182c67)},
+    {W(0x99ff20f6a2cafa21), W(0xd3fd11ac27c3cc55), W(0x2db290d6495f26f8),
+     W(0x6f5230bd7308f762)},
+    0
+  },
+  {
+    {W(0xed5954e3330469a7), W(0xc7a47e05e6eb7d66), W(0x9cba7e17fe1788d8),
+     W(0x649ed415f5891c9f)},
+    {W(0x95d927e9bfbfa732), W(0xe49b7cddd0ad1ab6), W(0x5428cd4be810c89b),
+     W(0x8531f1f1bef210fd)},
+    0
+  },
+  {
+    {W(0x7e69d33b7092fcd9), W(0x62caba849ce5d034), W(0x8f76c8914f9d8e2a),
+     W(0x80453491b5402c13)},
+    {W(0x3b12029cba158686), W(0x68c3037479e5f710), W(0x0172c08813379967),
+     W(0x815a7cd666c1bec3)},
+    0
+  },
+  {
+    {W(0x1b1f7153510fb2c6), W(0x926281d9a8dd49b5), W(0x95b18e64e19aed6e),
+     W(0xb2fd0487147dbc34)},
+    {W(0xe24c19cb78ea2218), W(0x29d82c2f41c97ecb), W(0xa25e240e2189b254),
+     W(0xc091b10b7d30325a)},
+    0
+  },
+  {
+    {W(0x7113c7744c9f94eb), W(0xe46378ff73cec3fc), W(0x9afcf2e201f758cf),
+     W(0x107d86374fd204c5)},
+    {W(0xaddf03f002eb7e91), W(0x3e9a53c42c323958), W(0x7704e522b8873b00),
+     W(0x66df134f932ee5dc)},
+    0
+  },
+  {
+    {W(0x064f86c481ca1f1b), W(0x9f293ddc084acda8), W(0x8342b1a4b6175db8),
+     W(0xe5fe5f9cea2ff365)},
+    {W(0xf32619149d38449e), W(0x0ab18c019bad5bab), W(0x33e27bfcf7f413b0),
+     W(0x28cd4f57a97eeaa0)},
+    0
+  },
+  {
+    {W(0x8f6b833cc231e8a6), W(0x27b25935a929692b), W(0x7a5b6ad3448acf72),
+     W(0x8dcaa5f3af16bdb0)},
+    {W(0xdff06c323374f7e6), W(0xd60546c0539a3701), W(0xea6c8be1b54f29a0),
+     W(0x4f4d05d1ae9283bb)},
+    0
+  },
+  {
+    {W(0x57f580da0aef0604), W(0x077a2a8d320045d7), W(0x26f0145d066f356b),
+     W(0x53cf17cbd4f8e96a)},
+    {W(0x5d676a61e5f65a1e), W(0x5b90c19b2d47c1ef), W(0x3191c793e8e38fb0),
+     W(0x693b12eca9d2327a)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xedaaadeb3b4eabca), W(0xb76de7e3c2e27942), W(0xd90f73232b75c3ec),
+     W(0x6b535135b06a598c)},
+    {W(0x734cecd5f2d7d8cd), W(0xf12326b5bfe66081), W(0x34911c450f34c8a5),
+     W(0x7951bf638df7353b)},
+    0
+  },
+  {
+    {W(0x17c0461e8e8a4752), W(0x61b2514bd3bb4e8e), W(0xffb211a0027b825a),
+     W(0x7233b0a2d04f4da7)},
+    {W(0x5a916ae05d790a25), W(0x6ae299b066164ce8), W(0x38d3eb339253f696),
+     W(0x367499360c8ff333)},
+    0
+  },
+  {
+    {W(0x56aec67d7b6f885e), W(0x0297e9bc9cdf6760), W(0x05cfd2dd710f055e),
+     W(0x1c7a571951cee715)},
+    {W(0x7a6db1593df0b3ef), W(0x64b1c4f9b19599ad), W(0xad40d544e0eff64a),
+     W(0x222e8bacec90ea28)},
+    0
+  },
+  {
+    {W(0xdc325eb780cdc998), W(0xeaeb3ea4451072d2), W(0xfbe4a77a63f4814e),
+     W(0xaf7196535cf7300b)},
+    {W(0xa5961c0caf79157b), W(0xd6bd64fac1b1eff8), W(0xd53c7278209c1192),
+     W(0xd49a6edf11867896)},
+    0
+  },
+  {
+    {W(0x009c08d04ab178f7), W(0xcd2fb91260452e7c), W(0xd6c4a2e06a857014),
+     W(0x00da08a2300446d4)},
+    {W(0x267da3453782dcde), W(0x0bfa97618a01163d), W(0x2b5cae32874c63ff),
+     W(0xd272ece363f28714)},
+    0
+  },
+  {
+    {W(0x5c7a2d5aec53361d), W(0x1bf3cb4ebf7ef20c), W(0x04796bc056f2c73b),
+     W(0x8f6a2541f81cf5c4)},
+    {W(0xbf5e88bb42e45f66), W(0x7cc17bed95498b23), W(0xfce87f10ce9ae644),
+     W(0xea9eddb50c643b92)},
+    0
+  },
+  {
+    {W(0x6be140a00ee83c6d), W(0xa9628d8a0cd734be), W(0xeed633c30fb50b9d),
+     W(0x2991c3d2a3e39c2f)},
+    {W(0x2bea88ef0e53351e), W(0x81a0b9e78ecb4b51), W(0x5de33066262b937c),
+     W(0x72875741a9ba3577)},
+    0
+  },
+  {
+    {W(0x1ba0afe653b69982), W(0x457c5a6154894dcc), W(0xe9c42a0ac615ab9c),
+     W(0x22d4f20138499dbf)},
+    {W(0xb1ec2a6d58d094a6), W(0x25d12924866be1ba), W(0x1417e1e6a5513025),
+     W(0x46a7be0eab039206)},
+    0
+  },
+  {
+    {W(0x3562f72eff48f01c), W(0xf6beffb64647b58e), W(0xeadd09109309bf6e),
+     W(0xc1fa18ee066434c3)},
+    {W(0x74d1122f79ac2474), W(0xd224532f12b5af63), W(0xddcaf7bc632c8420),
+     W(0x2a7bef073685397e)},
+    0
+  },
+  {
+    {W(0xf17b5e736474b638), W(0x67a667dced527919), W(0x1dc1950db9c8b8b7),
+     W(0xba3472782a4d4cff)},
+    {W(0xb1de2d44a85a1743), W(0xcb40c44e63ad4917), W(0x5149550778fa4e77),
+     W(0x4a552c7f1d4bf915)},
+    0
+  },
+  {
+    {W(0x1c6a392d736ebb6f), W(0x5ba8ee487dac040b), W(0xa185386ad3895625),
+     W(0x79e691241772ef81)},
+    {W(0x63e38c45a93cb9b5), W(0x5f86b251c8a730f8), W(0xae513480c03ad655),
+     W(0xe12efc16ee43a85c)},
+    0
+  },
+  {
+    {W(0x702df5a9ab8f5570), W(0x8465e1b6c4b1ef0b), W(0x2824394dc3f6ddef),
+     W(0x8d94a8aff9af33e5)},
+    {W(0xc80d44363598996c), W(0x19843a6e03e27975), W(0xf3b68ae98976fb0c),
+     W(0x4baabfbef594fced)},
+    0
+  },
+  {
+    {W(0xe2b5d0cb2304080c), W(0x858a56902b596eca), W(0xbf02bd0dd89f4341),
+     W(0x0029ff462bd46507)},
+    {W(0x35dbf5f1e9f3430e), W(0x6ea9e393bbf7dc85), W(0x93ff71f9349a8c7e),
+     W(0x397899295da8c287)},
+    0
+  },
+  {
+    {W(0x6cd4ccc93de53166), W(0x9e74bc5beee9b471), W(0x415188c4bfd922bd),
+     W(0xec84136e97f9c0bd)},
+    {W(0x4eb0f91cb8310db6), W(0xebe4b803dae9b22c), W(0x9cce32df009f6ac6),
+     W(0xc06a0e4d1de6c015)},
+    0
+  },
+  {
+    {W(0xafe41f36a9e251b9), W(0xdb3c305fe0ea3cc0), W(0x370ff3bb262a0248),
+     W(0x51c020c95ea71c79)},
+    {W(0x83106694a684f315), W(0xcb04b34617755a73), W(0xc27ee5e725740c1d),
+     W(0x27e0d35456373bd8)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xe70ccf9911f87843), W(0xaa750516bf750a24), W(0x7718717c31a6eefb),
+     W(0x349467e64f1b3cf2)},
+    {W(0x7e8543cc13e06789), W(0x96a8b796a7d9be3c), W(0x094ce7cf9733549a),
+     W(0x1d488ec1fe62445e)},
+    0
+  },
+  {
+    {W(0xd0f1da3b48f7b419), W(0xe49b74861ab412f4), W(0x2b86b881b18ada64),
+     W(0x83b6cf6d33a6e0cf)},
+    {W(0x3a954c94b21355f1), W(0x6fc89f6ce49a6dd9), W(0xbac706ffc059f9ef),
+     W(0x23b21e1bae2685a0)},
+    0
+  },
+  {
+    {W(0x3d9da6d921a372f5), W(0x6f1ae40b64d7385d), W(0x7cda6a9208a21016),
+     W(0x2f70ed61fba7e2ed)},
+    {W(0x7e00445192f2ed9a), W(0x5eabaf90e155958a), W(0xb2ccd9f27dc71ee2),
+     W(0x5b451f60619586ab)},
+    0
+  },
+  {
+    {W(0xb23f24e47b8ff683), W(0x04c77af98427bfe0), W(0x478310bc3a5735c6),
+     W(0x7779bd08eb1d4e91)},
+    {W(0x549b94f484d65c69), W(0x061b9beb214867a7), W(0xbfdbf8ae6b043b58),
+     W(0x43a4a64dcf6e237c)},
+    0
+  },
+  {
+    {W(0x040ff0809441342b), W(0x2f0905c1edff16ff), W(0xb58b665b3cc77b3e),
+     W(0x332f2daee03f98e8)},
+    {W(0xf6533e4878f9bb87), W(0xb4ea475837255bba), W(0xd8360086e594b600),
+     W(0x5b4c0c9c808b7682)},
+    0
+  },
+  {
+    {W(0x5eee3ca4f4b0761c), W(0x90622c9b49c05683), W(0x1d767ea57b96cab1),
+     W(0x29c2c08fb0283e92)},
+    {W(0x496d62603c2764c5), W(0x3d1f37e2c11ee301), W(0x9b1f652deb3f2c9c),
+     W(0xbba690976c171bec)},
+    0
+  },
+  {
+    {W(0x93045d9eee5f9472), W(0x34b36e9dfd721f98), W(0x51ea1d879dc0f7ec),
+     W(0x6bd8f9770c11edda)},
+    {W(0xfe8c621c94c4b895), W(0x0eb93181d53b731e), W(0x378fa7d410d82811),
+     W(0x6e82fdb28e39bcb2)},
+    0
+  },
+  {
+    {W(0xe18c97feec5dd4f1), W(0xe7db08e9728cdf90), W(0x49e3bdd1313b1e13),
+     W(0x1bd415283339d502)},
+    {W(0x7da926deb1e8de3a), W(0x9e0e414d05d4cd42), W(0x171040895828d725),
+     W(0xa81d3b0adcee4df2)},
+    0
+  },
+  {
+    {W(0xd0a089e1a84e7e79), W(0x8517a795f6e18472), W(0x82d3426fec5f50ea),
+     W(0xc17db8ad8c71adca)},
+    {W(0x2cf7de22b6487626), W(0x16dbf2cc3893a44a), W(0xebfbfe16b910e48c),
+     W(0xbae37636a1a848ed)},
+    0
+  },
+  {
+    {W(0x484d59228cecabda), W(0x9bdbb41f73e60445), W(0xf0462726fd7b16ee),
+     W(0xce7c19c8e8d105fa)},
+    {W(0xa23ea861761a976c), W(0x4fe4957e46ca5a54), W(0x9d9ff39b66cfe860),
+     W(0xf17dc1608c790570)},
+    0
+  },
+  {
+    {W(0xb7513ebfc6f8cabc), W(0x04606528a408108a), W(0xa692835f0dddb33a),
+     W(0x2542be991edf7940)},
+    {W(0x7710728d4fe8b0e0), W(0x596f1bd86f906286), W(0x2c349d2749332bf2),
+     W(0x88776630691d2287)},
+    0
+  },
+  {
+    {W(0x56316cdc6caed476), W(0xab580067a2b81e98), W(0x6ed0d1cecfbade9b),
+     W(0x437b4a26ee035b72)},
+    {W(0x3e5ec22c68e4bcf2), W(0x450c8cbcef47783d), W(0x44bbb1119f191485),
+     W(0x9739f7734cc6740b)},
+    0
+  },
+  {
+    {W(0x7c91b8f0d7475c78), W(0xe50da5d4b9354bca), W(0x5d5d1ea469c8feba),
+     W(0x2317c0a2c7b7f865)},
+    {W(0x94d00f1e03d9baf5), W(0xd3b67465b56ac4c6), W(0x9446625f87de998f),
+     W(0x3856dc73e1f64a2d)},
+    0
+  },
+  {
+    {W(0x9bdf46334bc91ded), W(0x772e030c09576539), W(0x7a86797a4cbc303c),
+     W(0xd67b470075bcd9ac)},
+    {W(0xbac8a0cbe75c067b), W(0xe9d8b1b44648496f), W(0x1223ec7d03cab28e),
+     W(0x02724154de7adaea)},
+    0
+  },
+  {
+    {W(0x61461106164db1ad), W(0xbe99700635b8fff6), W(0x50f52bc4206afe91),
+     W(0x5091b009db6dbf1c)},
+    {W(0x478880e40c5e1362), W(0x534134db5e01291a), W(0x6dbf0a65375ea421),
+     W(0xa9ccdb5a4e7b933d)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xb96cf87d3d8f7f76), W(0x24e222eb568545e9), W(0x4ef1b7f743b7b477),
+     W(0x950cf5ef7e760cdc)},
+    {W(0x712b377a77589cae), W(0x574113a96c0055fd), W(0xb5f5aae063eec85a),
+     W(0x7dcabe71879e8025)},
+    0
+  },
+  {
+    {W(0x44c0d48453e5b6ee), W(0x6bb8f04b30b7b45e), W(0x1e86f74d28e9ea10),
+     W(0xc3c4b5c334d18744)},
+    {W(0xbf544b3b21b9b77d), W(0x2fc9c9243d1fe201), W(0xf579e7ec06f9e225),
+     W(0xb315d26f594d6567)},
+    0
+  },
+  {
+    {W(0x9317122245430c83), W(0x5b4a5f2acb721733), W(0x972be7c19e8331a4),
+     W(0x5d8d8c491c907b76)},
+    {W(0xf955e3fd3044ac6f), W(0x76d4416b7cbc51d0), W(0x84e7aa3e25925da1),
+     W(0x433332c09664131b)},
+    0
+  },
+  {
+    {W(0x58eff1160bd15805), W(0x68297f87875e499f), W(0xd35eae635ea5a87b),
+     W(0x0a971eba12c4e5ab)},
+    {W(0x42881be9e74578d6), W(0xebc94b224f2f393b), W(0x2c050b87970992eb),
+     W(0x8d161987d76aeab3)},
+    0
+  },
+  {
+    {W(0x3bfa418b0aeef189), W(0x9f6e61f76d827a91), W(0xe845258a17d815da),
+     W(0x86185a478f922c5b)},
+    {W(0x7ad8d7b15b3466c5), W(0xd249bc4b999c8380), W(0x81cb0c5edba2c922),
+     W(0x8cc4ac4242d870ec)},
+    0
+  },
+  {
+    {W(0xf70303cdf5aa086b), W(0xd08a96b9eace7f47), W(0xc2d80ba5a3d9fbe8),
+     W(0x92ae00b4dd0d65ab)},
+    {W(0x47343b4e92720eb7), W(0x7d02d6cbb11bb102), W(0x108463dfdff8e215),
+     W(0x337ed8ee34932c5e)},
+    0
+  },
+  {
+    {W(0x04244873d5a1af63), W(0xfbb26c61edc20d5e), W(0xda370b0eaa8c09a8),
+     W(0x2ba84cf24c9fc539)},
+    {W(0x686b19a7866aba73), W(0x6d2f5b97457e7fde), W(0x11bbab786b1a1324),
+     W(0x1048ba5a85bfb04d)},
+    0
+  },
+  {
+    {W(0x9019c6cc38c91c7b), W(0x53a4b37ea8b7191b), W(0x32def0137cda3696),
+     W(0xff7560d80b1b1951)},
+    {W(0xda8812672fca0e94), W(0x4fa496b7f3de6f3a), W(0x55d3bb737df69264),
+     W(0x13a3375cac528da8)},
+    0
+  },
+  {
+    {W(0xecb148483fe819d9), W(0x57434d3710e4ab5b), W(0x1cd00dc8bfd4d961),
+     W(0x6c77015100c80c7b)},
+    {W(0x94e70c323edba1f5), W(0x28fa068fb43e5427), W(0x752f93bac633254d),
+     W(0x6395c723da22687d)},
+    0
+  },
+  {
+    {W(0x77d8b8fa093254e4), W(0xb7e15f0dc72589e3), W(0x015f37c444e0f1bd),
+     W(0x2a76ab0a7995b9bf)},
+    {W(0xa40df9327234a6e9), W(0x3b83307648131689), W(0xb6bffdd95d6086ec),
+     W(0xe41a22c2686ec539)},
+    0
+  },
+  {
+    {W(0xf30fad94c7e48489), W(0xf87754dac91c0fd8), W(0xa5a603d1eaaba24d),
+     W(0xe39e44fa2f55e468)},
+    {W(0xcadc6ffe638612e9), W(0x7edf85756ce2bb51), W(0x65b7078f5a54f15f),
+     W(0x0fe6536fe63b38c4)},
+    0
+  },
+  {
+    {W(0x6cc6dde10af4e9a2), W(0xddba172321f8c9d4), W(0x00a3a943442d8a6d),
+     W(0x6bed88aa232cb20f)},
+    {W(0xe97212608a71a6f5), W(0x8cd12061205ba144), W(0xf80e0a91d3f2f387),
+     W(0xec89f182c3af4314)},
+    0
+  },
+  {
+    {W(0x9c780317984aa438), W(0x8ccb6d829bdbbfd4), W(0x38b7952adc85a3c5),
+     W(0xf28fde3874cafddc)},
+    {W(0x00b86cd78e185b9c), W(0x31f1a335424923d9), W(0x6e1e1ce3131c68d7),
+     W(0xc973914f3db128d8)},
+    0
+  },
+  {
+    {W(0xfc76277deee198ca), W(0xb8a8fcc5c7460487), W(0x4a22c9ce4e492c16),
+     W(0x4c8d90e81a4b790d)},
+    {W(0xc5fc4986c67a35fb), W(0x2c25684aff6cb4af), W(0x4ed8e8e0782bcc19),
+     W(0x5929b9bd01a81cd7)},
+    0
+  },
+  {
+    {W(0x336bc9ca93e48534), W(0x2c8db8f292233f32), W(0xfae3583d5ddea5f8),
+     W(0xb2eb77b169756a99)},
+    {W(0xfc89718632cdf326), W(0x3031bc3c426baa9b), W(0xb92d69ffe1e8b7d7),
+     W(0xfaf210fb4928cdd1)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xfdba1119362c4aee), W(0x9475450fd149e823), W(0x0308651061e240df),
+     W(0xac4c0d91b2797e52)},
+    {W(0x07a9f04e94e2e738), W(0xc9f2500993dfaa57), W(0xe28d8a1e631bf262),
+     W(0x3a5e0c8db6c3c6a3)},
+    0
+  },
+  {
+    {W(0x995172ec89e9fd58), W(0xdcaadeb5d4b6b6bc), W(0x194b5bbc58f8274e),
+     W(0x27bc618bdd36196f)},
+    {W(0x2bf616d091f96509), W(0x042750f110369df1), W(0x2deb4dd4cc6235cb),
+     W(0x2827be701a87b1ec)},
+    0
+  },
+  {
+    {W(0x1f89310dbad34d69), W(0x90164c592d46c9a7), W(0x9da649c290bea726),
+     W(0xf9e3c93f712b3c99)},
+    {W(0x567997209595fcbd), W(0x9df889af7ff73c8a), W(0xb84ab58821d4b858),
+     W(0xc4d8d79275f8d5ed)},
+    0
+  },
+  {
+    {W(0xf307596774d0d696), W(0x4b5d7ec5f93bccb7), W(0xaffebff2c634df50),
+     W(0xf5f106769e4de7ec)},
+    {W(0x0d7283b839e65a52), W(0x7cdeb6b7340b7891), W(0xc0f088fd430f523a),
+     W(0x230d7f4ce56c557e)},
+    0
+  },
+  {
+    {W(0x9eec2896172273dd), W(0xd9884cba970c1d17), W(0xe5c167dc18301645),
+     W(0xe5dda586530e5772)},
+    {W(0xdeeaf7092dd0f27b), W(0xc601f20a41dfb251), W(0x5f480c1d42217e9b),
+     W(0x0d75797db337bfb1)},
+    0
+  },
+  {
+    {W(0xbd1f51166037a8ad), W(0xd9fc3a2ab87116ab), W(0xa8453cffe7d895a1),
+     W(0x16cfa41cfddb9459)},
+    {W(0x0ec95efeb58e8ada), W(0x75ada3cbc5babbea), W(0xf5b7d0f700c666ea),
+     W(0x76ae31649f7d801b)},
+    0
+  },
+  {
+    {W(0xacb8abcaab76ef88), W(0x34ab9ab60d715487), W(0x75d466b09fad30d7),
+     W(0x626eb0d470d43609)},
+    {W(0x5e7f91f7ca4f4152), W(0x0cd7bf19180b857b), W(0x1f02dd96888784e5),
+     W(0xd814b697179f78da)},
+    0
+  },
+  {
+    {W(0x7121a1bcf9e1028c), W(0xc73d0d0f7d0d8fb9), W(0xced27f1438308151),
+     W(0xc3a91403e806a5e9)},
+    {W(0x61f97d94591e02d5), W(0x560bdc675660a6ac), W(0x48e5d2d78daa09b3),
+     W(0x11a532856d060cfd)},
+    0
+  },
+  {
+    {W(0x350fd825a224ed18), W(0xf938205920aed265), W(0x36a20a2f4f050462),
+     W(0x2fdd04df8ef3ae9c)},
+    {W(0x31d87f6ba5e419c1), W(0xdae49976f10cbec1), W(0x15b93eb0e6b6030b),
+     W(0xb1c8aeadabb9ecbe)},
+    0
+  },
+  {
+    {W(0x513b199e8f8b93fb), W(0xfb4dfd660ae9496f), W(0x0bce29b7581c1e74),
+     W(0x7b1e0e1a1e7f3fc0)},
+    {W(0xf0916724c023dbdd), W(0xe7c133e396a9f6e6), W(0x5ac4d24c30411380),
+     W(0xdac2cdde1e3d920c)},
+    0
+  },
+  {
+    {W(0xf69e090a5d63da84), W(0x62243127d238680b), W(0x5ade38ee4f961216),
+     W(0x727798d0ca3a0d0f)},
+    {W(0x8e73b0505c9ed783), W(0x02ebeb13fac6a9cd), W(0xc82afd1478a6a6c4),
+     W(0x8f5dea731475800a)},
+    0
+  },
+  {
+    {W(0x71b234da19310333), W(0x92cb45ace1d28b70), W(0xb7dd0c5598a55163),
+     W(0xb319eb41585b9b56)},
+    {W(0x0c0d2ad0ebf34963), W(0x0ca27c419fdd7171), W(0x00785a7304b5e8ca),
+     W(0xe9ef08945df23da1)},
+    0
+  },
+  {
+    {W(0xb9f1e6467d0dfd06), W(0xa6b2d78338302acd), W(0x242baa32b80fe945),
+     W(0x0d772c77d9e62215)},
+    {W(0xdae890c00fe3501c), W(0x5860479af791a0b9), W(0xdeec9228658e920c),
+     W(0x47f181529e665ccc)},
+    0
+  },
+  {
+    {W(0x7ed9002f7cc63d44), W(0xbe3a32cf4ac2f4bb), W(0x05d1c45b135c1f93),
+     W(0xeaca9e256b948e99)},
+    {W(0xee6c39bbbe627f82), W(0x56072d92851ccf7d), W(0xcd6954f881697ea5),
+     W(0x71d83fc0bd3f210a)},
+    0
+  },
+  {
+    {W(0x94e95e6d22982870), W(0x80ff175831b9b86f), W(0x6295ebe52faf1581),
+     W(0x025c90bf970663fb)},
+    {W(0xfbb6a13c5ff2e753), W(0x9817c6b78e2c5eb7), W(0xda10c2dd0b21c29c),
+     W(0xd8bab5abe1ab7c88)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x62def7ed6d8c664c), W(0xa18cdcd5d7c445c6), W(0xafef1fffeb247a53),
+     W(0xf18532d4a7bcaff3)},
+    {W(0x9d6b98be8228f8b6), W(0xa6d78326df5bae09), W(0x2a14242f2df3ef7d),
+     W(0xf8e6318f7c9186ec)},
+    0
+  },
+  {
+    {W(0x24e7be564195ea3b), W(0xc83ca2fbe9004927), W(0x1f714602fe22b55d),
+     W(0x46a812c11300d585)},
+    {W(0x6d1c150949a4326f), W(0x809cd7eb0ed826f8), W(0xd7bfc2088af9df29),
+     W(0xa2de76ad255a91bd)},
+    0
+  },
+  {
+    {W(0x0f8239b316fd9964), W(0xf665d70cf2610a4c), W(0x171cbd7297d2ea7e),
+     W(0x73b4471861abaab8)},
+    {W(0x7cf5112759fe8da0), W(0x0f4f41e5b07df47e), W(0xffa8f0274a372433),
+     W(0xd81f30a627f74cbd)},
+    0
+  },
+  {
+    {W(0xeead2ca76c1f0a26), W(0x2e01d56c13682a88), W(0xc8a80826a462087b),
+     W(0xfc58f34328cba4b2)},
+    {W(0x8dd7c9f6f29a3c5e), W(0x850dbfa79ad618d8), W(0xf50863c39b6b61a2),
+     W(0x002a661a7d05ee45)},
+    0
+  },
+  {
+    {W(0x14010c4e27d3b8be), W(0xedbeaaf5e3a443f4), W(0x490345b0b8292acb),
+     W(0xc7e668d325ba42a7)},
+    {W(0xc19660d1e0537626), W(0xd66fd1cd18fae412), W(0x9fcd223a6da0faff),
+     W(0xd7ce345098936cec)},
+    0
+  },
+  {
+    {W(0xf034f9aea560c149), W(0xe5890a29989c20eb), W(0x458f2ae45b53f4cd),
+     W(0xef29ced5ee3acab9)},
+    {W(0x76ccef1d3b955c96), W(0x962e7cc3b56b6ec7), W(0x875d647d07d6bce5),
+     W(0x8c23b3bf74c21890)},
+    0
+  },
+  {
+    {W(0xcedb11ede03cb9d5), W(0x47738de304764b76), W(0x6f7ce6e850bb6ded),
+     W(0x5e608149f8ed3511)},
+    {W(0x356e84cdb59509fa), W(0x5bf4f3164380a777), W(0xc01ee4584b247fc2),
+     W(0x78f1f2bb21904864)},
+    0
+  },
+  {
+    {W(0x1238b582d5f746f5), W(0xc57efeb9cb88cc2b), W(0xf68eca6d745003a1),
+     W(0x07a970b0bfc8f384)},
+    {W(0x0bee944d22cc2470), W(0x3443464d8b1f2c1c), W(0x4994b3e813feac55),
+     W(0x4b765986f3956a55)},
+    0
+  },
+  {
+    {W(0x59edf0fb55e67c31), W(0xd4b5d5c379b1c829), W(0x07a06f000de5bcca),
+     W(0x341a88ad330c2c72)},
+    {W(0x7397271d698d32f6), W(0x3a4cec92cdf83234), W(0x0470e9b374b01d96),
+     W(0x7dda11e533348365)},
+    0
+  },
+  {
+    {W(0x443113bc1a6f8daf), W(0x4aabc18922f23db6), W(0xe49e44cfacd9f3db),
+     W(0xd4f1bb7e8cd17297)},
+    {W(0xb04fbb934a913f53), W(0x4f7006b56c86105e), W(0x4c5fbb786b149fb7),
+     W(0x6e51cd68c560a223)},
+    0
+  },
+  {
+    {W(0xa774b7b2f43dad1c), W(0x752bda11e2e54684), W(0x5e8c42b031fd1051),
+     W(0x3433f8e66d626024)},
+    {W(0x0bbf388b81222cde), W(0x6e36dba45a01b9c6), W(0xd40b53bc8bb96798),
+     W(0x0996b81167edebee)},
+    0
+  },
+  {
+    {W(0x337d2f7fe03cee8f), W(0x9fee11b7e3340395), W(0x5e692755ff28b894),
+     W(0x26b7ccb1818df733)},
+    {W(0xfdba70df3f856c08), W(0xada7e84cb9b68dff), W(0xe21bc7113d94be82),
+     W(0x8cf9aa56f414ad42)},
+    0
+  },
+  {
+    {W(0xa4fb8515cf5fc878), W(0x4ded5af0f5e272e6), W(0x84ac8c43544c3b52),
+     W(0xef87db088176bb65)},
+    {W(0xcb0a1362ee817f3b), W(0xc66294de80c18e65), W(0xdc309d6ee785aafe),
+     W(0xbc120cab067e5029)},
+    0
+  },
+  {
+    {W(0x3381cbb86192fb13), W(0x224b42c1f4453db7), W(0xf350cb015c3f5df8),
+     W(0xe2f6a112c92c2b90)},
+    {W(0x98ad6583c5ec296d), W(0x3d40647e7052182e), W(0xe8ef7f969b9518fb),
+     W(0xc6b20f21e0db0384)},
+    0
+  },
+  {
+    {W(0x28db3783a4252be8), W(0x4cdffa95dd35941f), W(0x420fe5b82a39d8ed),
+     W(0xf1bb1ba6d36d9cb8)},
+    {W(0x2ee7a26959e9350f), W(0x2fcfc8cc281715c0), W(0x18eff4b8f1f6f5c5),
+     W(0x7116619c07dafab5)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x5110960e0c373dd5), W(0x473288436a66bc95), W(0xfacc5c9636fe8309),
+     W(0x9aa4ac3fd8f96a7c)},
+    {W(0x25f9d0eb667a4056), W(0x8682792202dc4791), W(0x439c22a22fd413a8),
+     W(0x7a042220fdd26609)},
+    0
+  },
+  {
+    {W(0x5eb13209141575ff), W(0xbddd09757eb9e721), W(0x65663fa76831b938),
+     W(0xd4b7c42755f6cb48)},
+    {W(0x4b49a85d96d2060f), W(0x3ed79c3ada925c2e), W(0x1d4451f68e82d785),
+     W(0x6d98f3a7ba6a5e46)},
+    0
+  },
+  {
+    {W(0x7ea7f2679ceb342d), W(0xb0aeba904f7050c2), W(0x1975255c36a48ee4),
+     W(0x51e8f00afb0cbbcb)},
+    {W(0x4db8c88372cd1726), W(0xb7cefa6e21884b56), W(0xb3d992165a8b51e6),
+     W(0xe8874be817432c34)},
+    0
+  },
+  {
+    {W(0x31997616b4d7985c), W(0x179ce767ec57c2a4), W(0x5f0cf0323f526d15),
+     W(0x264738dedb4bfa47)},
+    {W(0x25f639cd9f8ded60), W(0xdf159b4bb5d53ef3), W(0x03d62f07af518a12),
+     W(0x6555dc2e31b4f561)},
+    0
+  },
+  {
+    {W(0xbcf70c6180f8cec9), W(0x5a1cb8ee7fdbc85c), W(0x63b4e05baf124288),
+     W(0xe1194240d8dae0df)},
+    {W(0xb5a18a21addbe46c), W(0xe90fbfffa40cad66), W(0xa66ec75c3e5ed63e),
+     W(0x95190b6733bc24ec)},
+    0
+  },
+  {
+    {W(0x4b2926c235e9bdea), W(0x93765a1566ea67d6), W(0xbecb7f0ddb1e8b45),
+     W(0x92da4ab9fe438cd3)},
+    {W(0x3b26a5850e616cb6), W(0xb839d504412b5c02), W(0x913335d8b0a1106a),
+     W(0x24281c27ba76ccd2)},
+    0
+  },
+  {
+    {W(0xcde4440c6698fed0), W(0xdf0621e5ef201bad), W(0xc2c8fde2bcdf274d),
+     W(0x62b01cbd1aaa4904)},
+    {W(0x900ade529c61e404), W(0xc8ccc9968a3c2467), W(0xbc42abda7d124d52),
+     W(0x544a1e20a4daa07c)},
+    0
+  },
+  {
+    {W(0xd2e9b318d21a8cc9), W(0xdd1451322ca3021c), W(0x50809c23662a1d49),
+     W(0xd2d88e2edb9a43a7)},
+    {W(0xfcb9c78dd8f5ae76), W(0x43c24579cc9eaa64), W(0x0ec952544c77b841),
+     W(0x81bf40c79fd1a16b)},
+    0
+  },
+  {
+    {W(0x32c65a51f7111683), W(0xdcfb5322d9683882), W(0x33f7ec51ec69d094),
+     W(0x503800048076b81e)},
+    {W(0xa0ffa8ccbfbae888), W(0xefe0c79b6fa98fa5), W(0xf6361acec28f3f8f),
+     W(0x9bd4c1440bd46796)},
+    0
+  },
+  {
+    {W(0xcf4035b05ed6fe1e), W(0x543fa6f5e9bc510b), W(0x35d7be26240ac418),
+     W(0x886a4ed911241ea6)},
+    {W(0x67afd2bd589c9167), W(0xbe278f6aaa97d365), W(0x6ddcff2c89f3be5f),
+     W(0x7949b53115c7d63b)},
+    0
+  },
+  {
+    {W(0xe3135443ec36d077), W(0x6f52e15cd3a80e27), W(0x5cea3b26f96104c7),
+     W(0xb1ac0e75d35a918c)},
+    {W(0x8a71f5fe694e5c33), W(0x9fbfc2cc27d4a775), W(0xad48406d4f34ad79),
+     W(0xd0903647fcac332d)},
+    0
+  },
+  {
+    {W(0x9169bdafa16519b6), W(0xb931ab1eb4a8c593), W(0xcbedadcb40411d0d),
+     W(0xa80be8557a97fb49)},
+    {W(0xb5ecca90d3562dff), W(0xfd3b9c4c6a8441c9), W(0x089505f123d875c4),
+     W(0x642b253acbde3c66)},
+    0
+  },
+  {
+    {W(0xc4120a3c1acd9f1d), W(0x22da5be382ecaf29), W(0x3921b1a4c3a1f815),
+     W(0x2abf5cd4d41ff453)},
+    {W(0x046963d61fc62f8d), W(0x91146249107e2ea0), W(0x059638287af36e00),
+     W(0xeae78a0226ae9dc2)},
+    0
+  },
+  {
+    {W(0xd9ce04d5a771c1a2), W(0x33bc44d87b9e671f), W(0x739e470903874bf9),
+     W(0x8152e9af0f1326df)},
+    {W(0x4ec4463baefeaec3), W(0xbc39ac5839a0e0fb), W(0x260d4804944da6d2),
+     W(0x10098d0b70c28ada)},
+    0
+  },
+  {
+    {W(0x5dda280a55714f85), W(0x057944c129dd77ac), W(0xadac8eb345928207),
+     W(0xb0ca4ac2da4b7470)},
+    {W(0x5e85199512771c56), W(0x751125cb06401c8e), W(0xba42e73bf136eea7),
+     W(0x08b5ab2aca10062c)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x003f5ad086deb025), W(0x2679509ec67cd0e7), W(0xf5ea14340bf55abe),
+     W(0x2b008316e55ab6f7)},
+    {W(0xf024a0faf74f6d2d), W(0x6a6aee85bc0354d2), W(0x9585855763655ba8),
+     W(0x4a498fa22e5ae080)},
+    0
+  },
+  {
+    {W(0x50a1938b6c5ad1de), W(0x582af3d3bbbcfbb2), W(0x52d4caa6616dc98c),
+     W(0x0358ee8f6436993f)},
+    {W(0x1726fb3fa8a225da), W(0x19963274ba153234), W(0x2faa07b27dd63a79),
+     W(0xfa61479103af0155)},
+    0
+  },
+  {
+    {W(0xb64cc68f38d649c9), W(0xba386af2eb0b32b3), W(0x46203d6bc7e04a43),
+     W(0xe7119d35ac933a18)},
+    {W(0xb49945b82d8e2319), W(0x50803fb2ebc198c1), W(0xbba9b72254e1965f),
+     W(0xef99e5556a2f6ce3)},
+    0
+  },
+  {
+    {W(0x1b67ab9fa76e0551), W(0x9cd8980380103930), W(0xa44ada9e1e3f0b7d),
+     W(0xd8b9e12dab068051)},
+    {W(0x4b173f876c9b9264), W(0xf690324aed83fccc), W(0xbcf11c37cbf26ab6),
+     W(0x756e686cbb5a5124)},
+    0
+  },
+  {
+    {W(0x6e7438ad72201d51), W(0x21575ff72f9c5f1e), W(0xa79e730de9e69ca5),
+     W(0x8c4b76ef181dc1e6)},
+    {W(0xee49b48136fd5dcd), W(0xe2b0abbf9b98a9e7), W(0x158bf19f56d73e2f),
+     W(0x57f48600171dbdaf)},
+    0
+  },
+  {
+    {W(0x52be199a4c06054c), W(0xfb672e766bc131fe), W(0x18456f9875727a3d),
+     W(0x582bb4310b54e514)},
+    {W(0x423b2d26342db765), W(0xb9f61c88410dd3af), W(0x982ed8e5591372c6),
+     W(0x164d3dcfa254d7de)},
+    0
+  },
+  {
+    {W(0xd002c66947aaf362), W(0x2c617eeabe3d6cf1), W(0xc675e4722696c156),
+     W(0x30a327a9300de521)},
+    {W(0x4c302013b2c1271f), W(0x1e33aefc9f200a8d), W(0x96b0439d570430d1),
+     W(0x81f0a2a7a3b38fda)},
+    0
+  },
+  {
+    {W(0xc733bd99649297e4), W(0x05838cadabce43a2), W(0xfa436f8ce4e80fe3),
+     W(0xb96752300d5f0144)},
+    {W(0x2e032b531623b566), W(0xeaa63a6b474d46f4), W(0x5fb45d1d5d26c59d),
+     W(0x42bb533dc33009a6)},
+    0
+  },
+  {
+    {W(0xd1db3bebec03eab8), W(0xa9fa27f5e8d69476), W(0x0e12d824ff635334),
+     W(0x6492e0d2cc398c6e)},
+    {W(0xc7e10809f9b8e95d), W(0x0f223d83359220ac), W(0xe3fa8632838d57d0),
+     W(0x69f397207eceadf9)},
+    0
+  },
+  {
+    {W(0x843c1b8d906ceba5), W(0xb3cdbcfeeff68580), W(0x23070ee720b5374e),
+     W(0x3c002942b3bad308)},
+    {W(0xdd8c5903eea0ac36), W(0x895f9e33c795e0a6), W(0x1aa78ee4cb480e18),
+     W(0x496f868bf098b228)},
+    0
+  },
+  {
+    {W(0xefdc6436071f409c), W(0xd365854cbe3b67ef), W(0x8c77935816464a6e),
+     W(0x203ddcc9df8e1457)},
+    {W(0x79a5d81d053d5161), W(0x400fcf59a138a9ad), W(0xb1b49a8219e41dc1),
+     W(0xb22d8be7e83ef0ae)},
+    0
+  },
+  {
+    {W(0x158c314019975b92), W(0xc56ae293af6ba885), W(0xaca56c2bdbaeb71b),
+     W(0x055af6c5f839c5b1)},
+    {W(0x9151b965d952602f), W(0x9f932eb6f5fb8767), W(0x62c939aded6b41a2),
+     W(0x9b6b927bf23d4066)},
+    0
+  },
+  {
+    {W(0x63235b41f33bc446), W(0x87c169ee821ccc03), W(0x0cf2348f673af66e),
+     W(0x8599e2ab0c7948f9)},
+    {W(0xf5adfa96aabc3b75), W(0x9795a274483124da), W(0xedf6495a4d9c0140),
+     W(0x0c9f7c82dd3c77fa)},
+    0
+  },
+  {
+    {W(0xdeec8e6c4eae8274), W(0xb492fb0541239341), W(0xf2954f06d976486b),
+     W(0x1e047c68087ce2a2)},
+    {W(0xb73c8c29bb89d375), W(0x49385696701a0875), W(0x31bc7a8d64aa976f),
+     W(0x18e78816b7a3d9c3)},
+    0
+  },
+  {
+    {W(0xfb07bcfec4cd4c75), W(0xce3f599783af4ac6), W(0x5ead7a634f240b5f),
+     W(0x2022a1d70dbf8af0)},
+    {W(0x92b20fbcf2209edd), W(0xfce72a0810a7ecc9), W(0x7cc3caf6263d2b5d),
+     W(0x8100ef90580fc070)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xc282d4de2ae9a2d2), W(0x29f78296ac52c9e0), W(0x7f0d2cb23df2f4c6),
+     W(0x980a7fcf41039d16)},
+    {W(0x4db1b8c45b06b724), W(0xe320e3fe1a1b85bc), W(0xcc8d9f847360d0d3),
+     W(0x007988f09f48ed5a)},
+    0
+  },
+  {
+    {W(0xfc5b776fbdc5ad71), W(0x65542b91985eb32a), W(0xcacf2e0c0572e1ce),
+     W(0xd22452adc36bab49)},
+    {W(0x26cd44db4fe83e32), W(0xf3e0468c310d6ee6), W(0xc3bd373ceeff57dd),
+     W(0xfd62daae90b4bba6)},
+    0
+  },
+  {
+    {W(0x6d7e41987ebba3af), W(0x31b82b57b9594c53), W(0x202472e5f7e90a67),
+     W(0xbae47c177ecd9d60)},
+    {W(0x8b00deb97afa5a52), W(0x33cf329fb7baa490), W(0xc238e1aa5eab4c84),
+     W(0x30e7aa2e47f854e8)},
+    0
+  },
+  {
+    {W(0xf864e88b532a6ea6), W(0xfee47ad73b673480), W(0xb04a05b54df42da4),
+     W(0x37b535107da26163)},
+    {W(0x012aa5dcbdd06aef), W(0x70a2fa71142e67ae), W(0x3600dc14ea7ddb62),
+     W(0x014f4f019a751d6c)},
+    0
+  },
+  {
+    {W(0xebaa0c848f2803fb), W(0x037062a411063d6b), W(0xac6f4632067b1edb),
+     W(0x5405ce0b8c4780f5)},
+    {W(0xed5b2284b5aee22c), W(0x5779e1a903e5ce17), W(0x19ab0c2421ae0f74),
+     W(0xc0fd201ee6fdf6a8)},
+    0
+  },
+  {
+    {W(0x3917737f2522c787), W(0x7ae68169cd5a286d), W(0xe113a3484734b0ff),
+     W(0xf5515a258e2a7e2c)},
+    {W(0x1ca9c156adcc3054), W(0x824e49f002e3142e), W(0x5701bb3bec044d6d),
+     W(0x69cca7f0a2800195)},
+    0
+  },
+  {
+    {W(0x5606a38c967e1348), W(0x9fd57b0c6120b33a), W(0x985ccf77e070661b),
+     W(0x79192e40c9d1cd73)},
+    {W(0x363b83865950129f), W(0x7ebff26d86776532), W(0x862fd966f85915d1),
+     W(0x3184a214e27e9295)},
+    0
+  },
+  {
+    {W(0xc1dbd304adb5844f), W(0xe262b782f6d15bb7), W(0xa0f75234f56a39fd),
+     W(0x21f4b899d1952cd7)},
+    {W(0xa39cc4e795bb73ec), W(0xf970466be5531d05), W(0x54bcd9baac6f43ce),
+     W(0xdb6a18bbc9d0eaf8)},
+    0
+  },
+  {
+    {W(0x6b6381e7dc997b71), W(0x831afa99de11f56d), W(0x933faf006efd2326),
+     W(0xb23474fc919aaf24)},
+    {W(0xccfedd4d29987870), W(0x60d35af5ea1dd98e), W(0x5cb2a2e53a41b40c),
+     W(0xa364e99428bf7efe)},
+    0
+  },
+  {
+    {W(0xa9d250560d0d9299), W(0xb332aa4446a5c2dd), W(0x6410e81f9cb4e18b),
+     W(0xeb8bacc031b8a255)},
+    {W(0xab4332c695cc2ea3), W(0x50bf7cbff1cd49a1), W(0x478e4235f8302376),
+     W(0x6bc19c5036dd3435)},
+    0
+  },
+  {
+    {W(0xa3c9b5004c394c14), W(0xd1e1fbcad9f5f971), W(0x7336eec846bfe625),
+     W(0x4889ede9f172ada4)},
+    {W(0xc7ed7c09412f4761), W(0x2ba0d5395df941fa), W(0x55ff7139dc2fe6e7),
+     W(0x9db349142923991e)},
+    0
+  },
+  {
+    {W(0x6924560ee7d563f4), W(0xa860f687e25c978e), W(0x810bbf5201f1634d),
+     W(0xc81ca33372801ead)},
+    {W(0x32382043ff26ee9b), W(0x3d13f63ce8c9f307), W(0x365c5313144c2b15),
+     W(0xd8de8b17ffca4f87)},
+    0
+  },
+  {
+    {W(0x1cf74cefde7ca3e6), W(0x8f05e4990dc3efc5), W(0x30b06697ef647565),
+     W(0xe4af021a4ef2e32c)},
+    {W(0x6916e0c3273b2229), W(0x01e735a767ab9e5c), W(0x8f5f041f93df7bd6),
+     W(0xa004c5cb97fd25c7)},
+    0
+  },
+  {
+    {W(0x2e28b2c7169c42c8), W(0x80086dff3979c458), W(0xede3e329aaad09a8),
+     W(0x5e08c0bf95cf703a)},
+    {W(0x2d6956208a43ed00), W(0x6745418fd6143228), W(0x84257b9bfe1a698e),
+     W(0xdf46f8d80f721fe1)},
+    0
+  },
+  {
+    {W(0x0dac02ade58b4c4e), W(0x836d23496530dc34), W(0xe7099bfb357ece1c),
+     W(0x02b6686d0099a761)},
+    {W(0xeb5703af93d76f4a), W(0x59a79b64304515d6), W(0x8fed119e5d18a35c),
+     W(0x546e5d9d1395d00f)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x2d63d36358a8aecc), W(0x393a5462676a1840), W(0xa2f08a934368ae8f),
+     W(0x36c2bb30a611c3dd)},
+    {W(0x701f8653e44f6d6a), W(0x846ec4780fa19833), W(0x54ab2b7e1921b4a8),
+     W(0x92d19021a6b88446)},
+    0
+  },
+  {
+    {W(0xb97f1163dd09da64), W(0x22a4e399855f07e6), W(0x4810731cf028904a),
+     W(0xf5d6732748a80513)},
+    {W(0xec9ac3e0f139875e), W(0x92011af04d56af2f), W(0x6db7c2d15e3b93de),
+     W(0x30763ea7455bebe0)},
+    0
+  },
+  {
+    {W(0x5551b17cdbc895f4), W(0x7f5ecb2f8a21f081), W(0x520715fae2b4f569),
+     W(0xc7051b37f7dcd9d2)},
+    {W(0x76181b8827c8e319), W(0xfb6baad8e4fc1a12), W(0x8f81106c61cfce76),
+     W(0xa021837d35008866)},
+    0
+  },
+  {
+    {W(0x65a09e59c4f8fcf1), W(0xffbd761d272ecd9c), W(0x6a5115a1452e0fc2),
+     W(0xf069fcc756818b68)},
+    {W(0xd59b3e61899fe72d), W(0x0435d4fe3a361043), W(0xdc258d16e6ef01a6),
+     W(0x2630d853c6e9e195)},
+    0
+  },
+  {
+    {W(0x1cdf62df302513da), W(0x64605506e4dc1668), W(0xdee53189972be654),
+     W(0x1519d30a948afbf7)},
+    {W(0x5b6cb34a423acbe9), W(0xcbd96d42495866f3), W(0x8af8c97eb27a8c3f),
+     W(0xf4b8706502405022)},
+    0
+  },
+  {
+    {W(0x96106aaacb98810e), W(0x40ba6754f5e4b4b3), W(0x5c711b3ee92ec5a1),
+     W(0xb78ce790441a876e)},
+    {W(0x1f0544b6a49c603d), W(0x3715dcecf545894f), W(0x243454e354ba6c95),
+     W(0x2342ae4f54895e73)},
+    0
+  },
+  {
+    {W(0x31e248108e0376ec), W(0x3abd9b67e5d7a816), W(0xa7fc938a5e189d01),
+     W(0xeee2e9f62fe13886)},
+    {W(0x9d96c9e34bc5b96c), W(0x11b750f4a5b490d2), W(0x63366b8b3b718de7),
+     W(0x3b2921b67b2b7291)},
+    0
+  },
+  {
+    {W(0x5e6469a5a87b66ce), W(0x75a2f4b1946d2536), W(0x71ef918327b5e5a1),
+     W(0xc2f01d4629e52df0)},
+    {W(0x0f28729f19f3e19f), W(0xa5e2d300058097f7), W(0xfefc21c624c2a91f),
+     W(0xe57907eb62ea2c7f)},
+    0
+  },
+  {
+    {W(0x8d04c59c233829cb), W(0x2831d2bf5d690f43), W(0xec32e4c3f1b6c60e),
+     W(0x8726e1015f6578e5)},
+    {W(0xb23be8ee0d56e78e), W(0xec2542ddd8e3987f), W(0xe9ba8b163980ad13),
+     W(0x1b37ba598942d6fb)},
+    0
+  },
+  {
+    {W(0x74c01d24d983b098), W(0x1a7866300a50802f), W(0xa66706953e4628fa),
+     W(0xf60a387d061784bd)},
+    {W(0x83be3a980488905d), W(0x726b85f2f94ea0ba), W(0xd573238d5a3593d5),
+     W(0x8c214cc9a10d6a8a)},
+    0
+  },
+  {
+    {W(0x24d786a1f0f2c574), W(0x6ec3d98ce189f236), W(0x4e8f0a0092daa6df),
+     W(0x32f4bdd0a328ca87)},
+    {W(0x2ba38aef647422f5), W(0x442461a5bc7d339c), W(0xd32855e28d5cdf0c),
+     W(0x8e226c9f575accb1)},
+    0
+  },
+  {
+    {W(0x9d8c4912241cf49f), W(0x2e73a107d0e8364c), W(0xdea119c8c1290135),
+     W(0xf74817f8ff1f541e)},
+    {W(0x29041d139ba8c4af), W(0x39c95c0f17aede57), W(0xb8588aad5fa832a0),
+     W(0x9f373a3909d81fb4)},
+    0
+  },
+  {
+    {W(0xef3bd7107f550cff), W(0xf90b7237f6716f3d), W(0x071fff8932233cdb),
+     W(0x4c048cea40d58724)},
+    {W(0x20bfb31065e86924), W(0x94b7297bc48da998), W(0xc983b5f154f64297),
+     W(0x0f21384d4277ea8d)},
+    0
+  },
+  {
+    {W(0x03c4bcca3e5c0fe5), W(0xca7ec821ed057398), W(0x8e1a4e6dbe8c6d75),
+     W(0xc130eaa8034a9a99)},
+    {W(0x80ba14d0bf2c1aef), W(0x80a7045f0553b0ae), W(0xf79815370f73a937),
+     W(0x50861fe958d30d97)},
+    0
+  },
+  {
+    {W(0x1c32326c09a677dd), W(0x04007199acf84219), W(0x927df40236e0128b),
+     W(0x86054b7683459cf4)},
+    {W(0x28de82c148e0560b), W(0x2cf5c21d4bc4f69c), W(0x22c15353e420c01a),
+     W(0x34c2f7d34c1545fe)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x14a623434d63744a), W(0xee299d67ea69d91c), W(0x173ca9800a87b7b8),
+     W(0x4fd8d4ee4e3c52e9)},
+    {W(0x3f63f285cb5e964d), W(0xf84535bd33c29892), W(0x871517ad9796c762),
+     W(0xeac1b195d1906b6a)},
+    0
+  },
+  {
+    {W(0x25682ef122e6d938), W(0x930697aacdaf0c39), W(0xfab5a955cee93bc7),
+     W(0x0c6c00c2a20132b1)},
+    {W(0x9eec6ca49b7cf9cf), W(0x4a111c6231ce8ad6), W(0xe04520c3a987713e),
+     W(0x8d0700f390518566)},
+    0
+  },
+  {
+    {W(0x76244513acdb1996), W(0x28534c94f854401a), W(0xe607908c0de6deb8),
+     W(0x518180d7947515fb)},
+    {W(0xef95a29375d618ff), W(0x76133680ea691683), W(0xf7d9db72228f229f),
+     W(0x4571f5c2c21652b9)},
+    0
+  },
+  {
+    {W(0x41c22ed6792ce794), W(0xdc1a8163e2df1d86), W(0xc8dfe2a5effd19e7),
+     W(0xd1852be6cd7f0d80)},
+    {W(0xa1d23f5449f4005b), W(0xb5a8237a4c6b2d55), W(0xd5e6c50632d62eff),
+     W(0x661f40955be6c80e)},
+    0
+  },
+  {
+    {W(0xe381ef40d205c729), W(0x84951bc4e1d5ea8a), W(0x5fc6a8f17adae535),
+     W(0xf110ff498d5f9698)},
+    {W(0xc0d8c71097809982), W(0x6e79c46c14a30d86), W(0x030dbff4d10250d1),
+     W(0xddbc7a97db917c3a)},
+    0
+  },
+  {
+    {W(0x48fe1bcbcab64f0a), W(0xdcfca529ada33f60), W(0x232f18b884ff9455),
+     W(0xc095688e5d06a595)},
+    {W(0x186b93778b935daf), W(0x0fee16e44e0b7932), W(0x8827fdd64d5e5305),
+     W(0xaf507d126288a7cb)},
+    0
+  },
+  {
+    {W(0x6a24e08102283142), W(0x14f6d967c4f2d47d), W(0xe8c2518f9a0e70bc),
+     W(0x03a2b4206c062aac)},
+    {W(0xe57579e4f6978ba1), W(0xdd58e46ef1aae477), W(0x78dd32ccfdbceb6a),
+     W(0x380235dcdb4279d2)},
+    0
+  },
+  {
+    {W(0x2a5f69e9f47de484), W(0x7aba671efbb82355), W(0x3c06b9436f252895),
+     W(0xa6c3e44fa0cd8361)},
+    {W(0xc6f187be73fff468), W(0x0b11ad5682f838d0), W(0x75e9f54eadcfaeb8),
+     W(0x654296a00a4a149d)},
+    0
+  },
+  {
+    {W(0xaa2904304f0b2d06), W(0xbf976afdaa579917), W(0x940adf83d3b54115),
+     W(0xcdb3ba05ed355d15)},
+    {W(0x86229367e84c874f), W(0xe3e9bceab848ed17), W(0xa9f18ff10e68cff3),
+     W(0x8b675d5fa3ac074a)},
+    0
+  },
+  {
+    {W(0xb3176f9346bb8350), W(0x293d1fda49afcd10), W(0x972b8bb2c057bf81),
+     W(0x53a89e2944ff6cf3)},
+    {W(0x8daa9652853b7c36), W(0x4204e8235037af7f), W(0x519b97d854d74683),
+     W(0x28c1b190fcdd0240)},
+    0
+  },
+  {
+    {W(0x381d96d73f782787), W(0x8fd9f25e167ac5e2), W(0x8c8e1088caa4d63b),
+     W(0x842966383ee032a2)},
+    {W(0x541d6d190e0e53d0), W(0x1c48267addcc4629), W(0xc68b14f76293debe),
+     W(0x834ab70fdd3243ae)},
+    0
+  },
+  {
+    {W(0xa8c759aecad2b066), W(0x4e3c8061c9fcf99a), W(0x89200ecdafe1b2ef),
+     W(0x75a01a44d7bda93c)},
+    {W(0x5ff6ec0c9fa217c2), W(0xf1135c710347b200), W(0x18d51c296920b125),
+     W(0x8d04cfa8f090f8cc)},
+    0
+  },
+  {
+    {W(0x076cf81c9a8d2d89), W(0xa94959dcb7c9e323), W(0xa711587df32de232),
+     W(0x8ee71dc792dfcc30)},
+    {W(0x0dfaa70721fd4a9a), W(0xe541a6f235956d09), W(0xbd94727fb11989dc),
+     W(0xc95d8c5e34fc5c7e)},
+    0
+  },
+  {
+    {W(0x62de39846ffbcc06), W(0xdfcc464eeaabc933), W(0x3959acab095d790e),
+     W(0x58d16a20646db65b)},
+    {W(0x21e4ba3edcf586d6), W(0x54b2197e0849520c), W(0x97de0f3d86d4a46e),
+     W(0x97c49494fa6d1ddf)},
+    0
+  },
+  {
+    {W(0x47aa09f60f0466cf), W(0xd9d64bd950c03719), W(0x19df3a25597e12b5),
+     W(0xc4a4c18abe572c68)},
+    {W(0xe52e278bdf560875), W(0xabf9f8828200404b), W(0xdaf4a2de0f9a5fcd),
+     W(0x3bd0ea1322db79ca)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0x337059fc9c2d5cfc), W(0xe3544a1ef5d4355d), W(0xf137ac1878ac2a02),
+     W(0xdf585ddee8cbe756)},
+    {W(0xbd1cf0bffb7d309c), W(0x52af123d6110ef25), W(0x2bc7ddc6a603c7a0),
+     W(0x515411d502f740ca)},
+    0
+  },
+  {
+    {W(0xcc9237949b4306d6), W(0x6f09b405b6570363), W(0x52cc6c39f0f61a26),
+     W(0x2b5537c9b8e4b1a6)},
+    {W(0x20c368bccc3d02f1), W(0x77717d8f13658089), W(0x9e9fae855878301b),
+     W(0x5af0fcfbe1e19026)},
+    0
+  },
+  {
+    {W(0x331f8e671eed0ac1), W(0x3aa82b930a3ae515), W(0xd35f3448b60277d6),
+     W(0x16c4f000f7caaa28)},
+    {W(0x93c754e13a9ac023), W(0x291d518230543f9f), W(0x7bf2bc2d7842c791),
+     W(0xa76c303441224319)},
+    0
+  },
+  {
+    {W(0xa5ce7fe8f441ac64), W(0xce4b9a6ff8cbe95b), W(0x1a2bd334b4cf46a4),
+     W(0x125ea7171204ca96)},
+    {W(0x4b514210251c6124), W(0x60bc1ca40639deb7), W(0x716c7eb1d4951a8a),
+     W(0xf052592f46c9f47a)},
+    0
+  },
+  {
+    {W(0xbf40d0a04b2ee342), W(0x3ad10b433444890b), W(0x8c121e4445f9d798),
+     W(0xacc46a050500fe8e)},
+    {W(0xe4d0a241be33f5b8), W(0xdea400e9ac35dd20), W(0x10f7698c587d8930),
+     W(0xc332c0a12a7bed84)},
+    0
+  },
+  {
+    {W(0x6d713a08734323f3), W(0xfc73ff28593efbc0), W(0xae2a6b564d774a67),
+     W(0x3dd5bdf896682f80)},
+    {W(0x698fb54321bd018b), W(0x64e57462a6527853), W(0x6e06421960f4399d),
+     W(0x4cc6c512d11d2a9f)},
+    0
+  },
+  {
+    {W(0x70c1ab626da23d4f), W(0x59b0ecd7fecdf2e8), W(0xe648e7cc26d72b4f),
+     W(0x390c880a9ac57eaf)},
+    {W(0x2b264f03a3320960), W(0xe08a1b3cb4bc6ed3), W(0x6c4f448c5f74a2d9),
+     W(0x512ba20c02a5d6df)},
+    0
+  },
+  {
+    {W(0xfbb2e41682e814fd), W(0x6ffeb2aca380f2ec), W(0xa8a674c2e61dfa89),
+     W(0x18ec5df2808e4168)},
+    {W(0x180fe9f2f26b9ade), W(0x981de86cb8222fe2), W(0x38393ffb008395c5),
+     W(0xc79260276af46d92)},
+    0
+  },
+  {
+    {W(0xe8576b1c700082c6), W(0xc475d4105a6d612e), W(0x926a3af9bc56242d),
+     W(0x9eec656fbf64d4a2)},
+    {W(0x1a4695df68673fc6), W(0x08fb2e0820687b8f), W(0x0016397f54282ff7),
+     W(0x88baee3135bc0537)},
+    0
+  },
+  {
+    {W(0xcd6035a4bfcc2e84), W(0x9d4afc4fd249552a), W(0xda7a70758ed2bb60),
+     W(0xfff5c2c6dccb00da)},
+    {W(0x18270ad5d8fe235c), W(0x9bebac3daa50b797), W(0x615b5e006b377146),
+     W(0x94ac1d03ade549dd)},
+    0
+  },
+  {
+    {W(0xc90748b90907e7ee), W(0x563907e6ca14559e), W(0xc62de37dd5d1aabb),
+     W(0xf2210c47e4bb9415)},
+    {W(0x4ea14630b84a5aad), W(0x2b4e699c5cd61140), W(0xce98607ed239b104),
+     W(0x1fe35dababdfadf2)},
+    0
+  },
+  {
+    {W(0x9c1b5e5377c8fea4), W(0x0f5d3cc7678ec92a), W(0x203713cb864c4032),
+     W(0x5b82c803d405b6d4)},
+    {W(0xff7ec24fe9464605), W(0xd71241d3a5eccb23), W(0xef890204ac2543f8),
+     W(0xe810d87b11c9801f)},
+    0
+  },
+  {
+    {W(0xeeff623e1ba17f02), W(0x33b23628872f2aff), W(0xfe70d55d2925e912),
+     W(0xc44a938b880997e8)},
+    {W(0x4c3ef280f8ac6ccb), W(0xbbf6bc2cd941b8cb), W(0xea43811b1886c5b3),
+     W(0x04bdac33d48f1a22)},
+    0
+  },
+  {
+    {W(0xfc7f893dd8fcba60), W(0x3ae15a9ceb9370c4), W(0xf8160a07b34769cf),
+     W(0x4a0d897fadc3d140)},
+    {W(0xde7fbb2fe1fa2679), W(0x95127837b8de5375), W(0x9dbacd0236d65bf6),
+     W(0x220d9e23c30fd3b8)},
+    0
+  },
+  {
+    {W(0x4dc165aef35e1ddd), W(0xc247f84805507a5e), W(0xebd357ff57bc0ed4),
+     W(0xaa7376594130ad27)},
+    {W(0x68580b749252d8ed), W(0xcdb362e8cae9b99a), W(0x1c542251601861b6),
+     W(0xd457164fc4a56261)},
+    0
+  },
+  {
+    {0},
+    {0},
+    1
+  },
+  {
+    {W(0xdf617ce3e9babde8), W(0x6991275be3abb00d), W(0x2dac072dd6bba665),
+     W(0x1add23397e19efda)},
+    {W(0x7219993721f58b27), W(0x9e4ec35e49552723), W(0xa91d33635c4f8e12),
+     W(0x04190e2cb733468e)},
+    0
+  },
+  {
+    {W(0xd73c1384675ce6d9), W(0x8e4b2cc114885193), W(0xf37f3a36cf8d48c2),
+     W(0x442c90ddcb9979bd)},
+    {W(0xa2287ab00b286749), W(0x26e48da7765ffe2b), W(0x76b296fde82ed040),
+     W(0xfda3336af807aab9)},
+    0
+  },
+  {
+    {W(0x01eae63744045c30), W(0x7bdfec375439aa4a), W(0x1b01503ed1cf4fb6),
+     W(0x83cc4aa31a5d2286)},
+    {W(0x107653f1e5ca2320), W(0xd0fbf683ca8f71ec), W(0xf033315afb588b56),
+     W(0x7099c199d412ab93)},
+    0
+  },
+  {
+    {W(0x8e3f45354392a7d1), W(0xd44a38a7262757f6), W(0xe7e34de04ac50c17),
+     W(0xe3ea52f14e4bc0b3)},
+    {W(0x3d0a8a548cac974f), W(0xdcf1b089238cb42c), W(0x34b7f17cd2bc7851),
+     W(0xe9085ab6f117a3c5)},
+    0
+  },
+  {
+    {W(0xe563669dbcb24585), W(0x838ec0b8d378e8bc), W(0x0a621868f4781453),
+     W(0xfc88da2a21ca7890)},
+    {W(0xe6b0e6c731781b8b), W(0x8ef44a5641f9cbb3), W(0xc1f1f5548f49b992),
+     W(0xe194c930a07ea702)},
+    0
+  },
+  {
+    {W(0x3eed7556f5290f0c), W(0x86196f2faedd3748), W(0xfa01beca698a1d1d),
+     W(0xa6571d2b56e44533)},
+    {W(0x36224aac73505201), W(0xcb2871405c2388c6), W(0x2a173c5fee50c656),
+     W(0xc7f071d72e008dc4)},
+    0
+  },
+  {
+    {W(0x0388d7f65d673b40), W(0xe27359e970261ca1), W(0xe824439e04484dbe),
+     W(0xd21998355bad7a6f)},
+    {W(0x69d07609e6352079), W(0x104a00b9dfb14a4e), W(0x78f9f1fde6d4e000),
+     W(0xbaa5f28a188d7b77)},
+    0
+  },
+  {
+    {W(0x2bcf5baeaaf86fd0), W(0x68f2776f6d23b3b0), W(0xeb4ca6bc43bfaf72),
+     W(0x51f540a6aecddc61)},
+    {W(0xafbedc2b926b683a), W(0x6fa1b2db83105534), W(0x3fa241d7d1f855a4),
+     W(0x6fc22ed7802414cc)},
+    0
+  },
+  {
+    {W(0x2f2be7f609c18bfe), W(0xe294b72eee966ca8), W(0x653a405ab65a8914),
+     W(0x059110331ec6e377)},
+    {W(0x24cd460aafe3f2ed), W(0x7b609f9941b992db), W(0xf86d0f6458dd9d7d),
+     W(0x92f15255c5f35088)},
+    0
+  },
+  {
+    {W(0x49730856d0ad8c1e), W(0x2a00388d76d810ca), W(0x67bb315d41a1ae7b),
+     W(0x0f10237ea7dfbd9d)},
+    {W(0xb6a286d28d38b294), W(0x7c8cbd7f9f84585c), W(0xacf1edb683019709),
+     W(0x7463a5a172501074)},
+    0
+  },
+  {
+    {W(0x0ea0522dfcfb9509), W(0x1667f8bad3538edf), W(0x674992f3b64b5664),
+     W(0x1f9db6e5d21a4bf9)},
+    {W(0xa3994bd8ad55b8f8), W(0x32ae31ea503b3186), W(0xe822c8e548da6e07),
+     W(0xfa2a9b719da91666)},
+    0
+  },
+  {
+    {W(0x55366e447c21d61a), W(0xf448452dcd3c4944), W(0x2de786c9d19e65e7),
+     W(0x9cfb92cbff755124)},
+    {W(0x153850c77d0ab9f9), W(0xb9b2e33fd6038658), W(0x9f2d573e7ed4a9d6),
+     W(0x2993179f4bac7ec7)},
+    0
+  },
+  {
+    {W(0xd32602709a88f3ea), W(0xa1bc39623f7dd0ce), W(0x69bd1187ae3daeed),
+     W(0x2ef9aa44234fddc6)},
+    {W(0xebf81537334aed4d), W(0x0204c4fe9f9ef01b), W(0xb63909fe1711f6e7),
+     W(0x21a679d295b12979)},
+    0
+  },
+  {
+    {W(0x34266e2b5668c217), W(0x0be323a97e6d056a), W(0x2957b356994f8c84),
+     W(0xd723bae1e70236c2)},
+    {W(0x13c8d45b943c0879), W(0x4e819700acc3c557), W(0x0035eabdb3cedd71),
+     W(0xa1b77b4329677c6e)},
+    0
+  },
+  {
+    {W(0x8842ddc36d184454), W(0x92cce4d16c2fa3fa), W(0x77f35495607ec08b),
+     W(0x68344cb3365d8550)},
+    {W(0xb62dfe08e5181795), W(0x1257e67fecc02a1c), W(0x3b1fad4210aedcf5),
+     W(0x1808bd76d3f47808)},
+    0
+  }
+};
+
+static const wge_t secp256k1_wnd_naf[1024] = {
+  {
+    {W(0xd7362e5a487e2097), W(0x231e295329bc66db), W(0x979f48c033fd129c),
+     W(0x9981e643e9089f48)},
+    {W(0xb15ea6d2d3dbabe2), W(0x8dfc5d5d1f1dc64d), W(0x70b6b59aac19c136),
+     W(0xcf3f851fd4a582d6)},
+    0
+  },
+  {
+    {W(0x2379d4bbd5fea781), W(0x066ceafb22eb7bc4), W(0x5940d07385985972),
+     W(0x9497730fcdf4c0ad)},
+    {W(0xaf18b0b0613f55a9), W(0xac4964cdc5a1f91f), W(0xcc6048bd84885650),
+     W(0x3ec28dcd9215ec76)},
+    0
+  },
+  {
+    {W(0x212347fcbea19bc6), W(0x58d7334ddc284cda), W(0x20ce358572dd41dd),
+     W(0x8ed284d3aae7f96f)},
+    {W(0x9e5e784800dfd9e7), W(0x59aaa8d8aad35cc5), W(0x011d0b107f8dbfd2),
+     W(0x1fd437ae583630c0)},
+    0
+  },
+  {
+    {W(0x07ece566caa4cb22), W(0xca934f8716c087c4), W(0x4da362224e1d6bd5),
+     W(0x5f402433d73866e0)},
+    {W(0x4777d1124a77d752), W(0x879d7639f1097263), W(0xf2fd13d87291ab04),
+     W(0xc8043a670ba1a73b)},
+    0
+  },
+  {
+    {W(0x46cc6d26eafd5a74), W(0x6edd9e7f1ed7f74c), W(0x8cec72c7f64b253d),
+     W(0x87d71c6bf4d02a72)},
+    {W(0xb2a0d4ae268d25a4), W(0xaec108c659794d80), W(0xf0176bede6793574),
+     W(0x0156339094cef97c)},
+    0
+  },
+  {
+    {W(0x04f0c78f94a7a0aa), W(0x349ebdf993493bb8), W(0xd28558b5bb49a3c1),
+     W(0x9d888be8bce5a953)},
+    {W(0x434322e37beacf4c), W(0x755db980f899acaa), W(0x7cb76bd27b41572a),
+     W(0x0e92c06d7705fac8)},
+    0
+  },
+  {
+    {W(0xd59a06c4f5989088), W(0xd35438e646aec93f), W(0x5b370e50a02a9988),
+     W(0x7065f32baff18f7b)},
+    {W(0x14817536a5d44558), W(0x0f73d052948a3b41), W(0xdb37e3a6c013f5af),
+     W(0x595e4c3399b24984)},
+    0
+  },
+  {
+    {W(0xd51e8da318620cd4), W(0xa9b174243ff3bffd), W(0x8fe0d087f9180a0e),
+     W(0x329cf6f36a78a2b1)},
+    {W(0x364e94e68cf9083a), W(0xd97359fb5ca29845), W(0x1442e0ed9e703fc8),
+     W(0xf384d03b4965bc3e)},
+    0
+  },
+  {
+    {W(0xd90bb8e11df00c43), W(0x9b182865f3b25560), W(0x69d7a2a822b91922),
+     W(0xe272a6a1f9ff59aa)},
+    {W(0x85352ea76f2a14c9), W(0x99dc58b3753707e5), W(0x4e936ddcc6b65cc3),
+     W(0xb9d1058538a1624e)},
+    0
+  },
+  {
+    {W(0xd78ee564d62a7a38), W(0x5f8bf03a727df8f4), W(0xd8d133ada3023a4a),
+     W(0xdeb7636c4dd633a5)},
+    {W(0xdf15c738e0d36289), W(0x91a29c6198b88bdc), W(0x7ceef09600dda4f2),
+     W(0x444ec627d07c28ea)},
+    0
+  },
+  {
+    {W(0x7287d563f76ce60a), W(0x6ddb2dc674eacc1d), W(0xe0a1107e6cb12ea3),
+     W(0x38d21ce5a746f598)},
+    {W(0xead831a434cae6f2), W(0x439ddfdc4c4c0573), W(0xd69265aeb8025098),
+     W(0x9a760529af0be6c8)},
+    0
+  },
+  {
+    {W(0x710c24917d7868e2), W(0xb7018dcca66fa9a0), W(0xb2bb768f928ba6aa),
+     W(0x34b9089136060918)},
+    {W(0x1bb37e7d5a765cfa), W(0x04e41eb805d5c130), W(0xfabc5a81934fc6c9),
+     W(0x1ada75eb956c455f)},
+    0
+  },
+  {
+    {W(0x43a8673a528eab6d), W(0xcc7c3aff84257eee), W(0x826674bbf7fb2c09),
+     W(0x4f13fd3db6487c5a)},
+    {W(0x1af88d5c37027b74), W(0xd788f352bb5bb569), W(0x315a735beaaa2d4c),
+     W(0xdaaf22e5b81ac1bd)},
+    0
+  },
+  {
+    {W(0x4065de4bdf096d18), W(0xf732d13664c270e8), W(0x4a77f053b730aeba),
+     W(0x6753e5a765719926)},
+    {W(0xca06688145d3e40b), W(0x5987c3f8ac9dcfb6), W(0xfbfcc60cd3304a23),
+     W(0x5dace33180153d3b)},
+    0
+  },
+  {
+    {W(0x78393cc1bc66aebf), W(0x66de27b31124aa09), W(0x8c4c7f2072cecebe),
+     W(0x30822abdd5a92b77)},
+    {W(0xa8c8e083f7cbcb31), W(0xcb952fa172bd2977), W(0x0cdb3ab31afa8c27),
+     W(0x210ec24f6535ce88)},
+    0
+  },
+  {
+    {W(0x3eeec4b21af2746f), W(0x016f76f7b2686256), W(0x730d41a484012e67),
+     W(0xf12c7e23f74ec811)},
+    {W(0xe5694678a89357dc), W(0x10ac2b51ca2335dd), W(0x5e0eda4ce149b499),
+     W(0x27964839bfa868aa)},
+    0
+  },
+  {
+    {W(0xc789b0d904462042), W(0x83266b6f7948d55c), W(0x87e088c16ce63ae1),
+     W(0x37b49275a8134188)},
+    {W(0x55856bfe2b18110c), W(0xf698b243c499bb93), W(0x03dbb3810cef8e10),
+     W(0x79fb211f777f178a)},
+    0
+  },
+  {
+    {W(0x8cc030b523eacd0a), W(0xaf885b4de6947cc4), W(0xa06b283acf667258),
+     W(0x581042a66f6f64c8)},
+    {W(0x3a31e3d79265f180), W(0x4dc9de4c5eab6ebe), W(0xbd0a4fadaeabe161),
+     W(0xc7ec3e2d5b411868)},
+    0
+  },
+  {
+    {W(0x574d374d611e5431), W(0x85755869ed7e7a80), W(0x198bd86cd6081a8f),
+     W(0x621a29ddb92d0518)},
+    {W(0xf231989edd9866d8), W(0xc1be6826da9fddb4), W(0x8985db78e11526fa),
+     W(0xce9b6976d67d796d)},
+    0
+  },
+  {
+    {W(0x0abb6b74931ab84a), W(0x8c686ce20af3d47a), W(0x5e723a3d524477f9),
+     W(0x77de6bba5c326551)},
+    {W(0xfc5b9ec5929b6f64), W(0xaeb7c6cde49d0496), W(0xf5482095c7aafa37),
+     W(0xcf35e3ebf5a3d880)},
+    0
+  },
+  {
+    {W(0x0ae480b9f53d193c), W(0x86f719df0dc5b44e), W(0x146dbbc189c1812d),
+     W(0x2e2bc80567214653)},
+    {W(0xfcbb7632be39d872), W(0x4ba332cb7d576c11), W(0x18e6c1b219f23c9b),
+     W(0xc00969e9383240ea)},
+    0
+  },
+  {
+    {W(0x5f294ba4f83f38d0), W(0x3cc9b7d466f160b7), W(0xa93c93521597f957),
+     W(0x37c6a02e65a48803)},
+    {W(0xbe0809ba4c8dde97), W(0xd90d585c5b5ad049), W(0xf3df54f6d45360dc),
+     W(0x962e84ea6bea9faa)},
+    0
+  },
+  {
+    {W(0xba3684679efa4969), W(0xc20713edd5081d8f), W(0x83c92f9d42552668),
+     W(0x2ca518ad5320b144)},
+    {W(0x5afa94ed90e0c05c), W(0x3b30690ebe289c86), W(0x854ec8102c544b3d),
+     W(0x578756f29e6ffca5)},
+    0
+  },
+  {
+    {W(0x16a6d6de472adca1), W(0x86ae5c96ae5cb8cf), W(0x49cb06514d1fb544),
+     W(0x3233ef661cbf1211)},
+    {W(0x3b47757649e7e82b), W(0x4fc6f53994c7e45a), W(0xe4bc5f988ae74268),
+     W(0x3f188c560425b0d4)},
+    0
+  },
+  {
+    {W(0xdef9f1d0d939d060), W(0x7ee70afdde7df977), W(0x6c08f60d4e310ef5),
+     W(0xa1482a269bb97205)},
+    {W(0xcdd9f40c80d483ec), W(0xba1f50ed769367ab), W(0x33364421d8a95257),
+     W(0x6db77a1a2e1da593)},
+    0
+  },
+  {
+    {W(0x4fba1057d6d499e6), W(0xc36b65f01919ed5f), W(0xead948d305d0d2e9),
+     W(0x6e3c4f4ff2d3984e)},
+    {W(0x02b72b3fd133daef), W(0xc22c7b5f8a4f8771), W(0xd266f00b330ddbf7),
+     W(0x73f7d2d32d273a4b)},
+    0
+  },
+  {
+    {W(0x29aba0f99b4ad7c2), W(0xe5fd9e62f139f8c5), W(0xde7b34cf7d19e5a2),
+     W(0xaf6ceb12f4eb9bb7)},
+    {W(0x980e43acd79eb786), W(0x55c8772e06865b9b), W(0x83dadee963e0338d),
+     W(0xf2edddf9b0e45726)},
+    0
+  },
+  {
+    {W(0x51666ffc2e9be15e), W(0x2483921e02fad43d), W(0x8f1c07dc6c8c357e),
+     W(0xc7b06ee96985fced)},
+    {W(0xcc6e1536c6b46c3e), W(0x5528e849bbb2db21), W(0xf26df73f7be3572a),
+     W(0xba398de3910b0743)},
+    0
+  },
+  {
+    {W(0x117a547cc70c9cbc), W(0xb47a5180e1e6e3e4), W(0xe4be3476e040dc88),
+     W(0x3130c25b4b0d1b30)},
+    {W(0x040d4f07cf2a1cef), W(0x1bdbea3650d3fb9a), W(0x877f57ddfe4216bc),
+     W(0xc6ea984d4b832e71)},
+    0
+  },
+  {
+    {W(0x8fefc57423cf448a), W(0xa154e2bd7761b2b0), W(0x9500ddd625037408),
+     W(0xfb31e37630f720ed)},
+    {W(0xd1b658150b2b3069), W(0x9c4d7e1a6b6d0049), W(0x4c8df8bb5b38bc15),
+     W(0xcad37dfaab3dfe73)},
+    0
+  },
+  {
+    {W(0x3b75bb5de9b540e1), W(0x7f125440b549b012), W(0x83f9faf08450e538),
+     W(0xa2930635cd40829a)},
+    {W(0x73f89d79daed83c2), W(0x398e268e4889b425), W(0x367fdcf5e6112ff9),
+     W(0x866090e27c885dc0)},
+    0
+  },
+  {
+    {W(0xa4d44416639300be), W(0xdea61ae4b9f7c408), W(0xffda5b3f839c0518),
+     W(0x3539752caa4356f4)},
+    {W(0x037c0abf13bb54b7), W(0xb3c48ffee367f08f), W(0x56e45762d943dd47),
+     W(0x4f07938a8c07e9ee)},
+    0
+  },
+  {
+    {W(0x02a1ea133e571a95), W(0x3cd68054d7432e3d), W(0x2f3b47013b4e2977),
+     W(0x36d8b419d044bd24)},
+    {W(0x0db0b2a21cddfc71), W(0x3a26e050b3a10161), W(0x070da8f43bf78dad),
+     W(0x2ace7645b103ccfc)},
+    0
+  },
+  {
+    {W(0x5af0b2c7cd050b2b), W(0x4a8ac3f656a949f1), W(0x79d45a495e901a26),
+     W(0x2162592f52a01c5d)},
+    {W(0xd0cabb103ef1f86e), W(0xee78f4f6ca315bf9), W(0xeccf83a888e26c35),
+     W(0xbed6c8e5df026741)},
+    0
+  },
+  {
+    {W(0xef95483192b2a69f), W(0x59d66d12801eedae), W(0x4a9a5c4ddb48ea55),
+     W(0x4720e9c27e14e2c8)},
+    {W(0xb7d8c06ee6dccf08), W(0x48fe4ee540fd95d2), W(0xda45a64aeed33d72),
+     W(0x75778bf12a856a1b)},
+    0
+  },
+  {
+    {W(0x6bf4b50dcd619869), W(0xcf2905d4ec378a7d), W(0x6afa04b405dec19c),
+     W(0x4c45674a8097a072)},
+    {W(0x23030d37b66b5b0c), W(0xc5821b2cd8d01bf2), W(0x29bac38a5180b6dd),
+     W(0x3ce0002df92866f4)},
+    0
+  },
+  {
+    {W(0xfba2d68a0cf9eadc), W(0xde1e413624cecc2b), W(0xc68bd2c0720a9dc7),
+     W(0x5ad2b748ea1a0526)},
+    {W(0x760527a416a9f536), W(0xbf584a933ae7420d), W(0xe1031ca78ea83ce4),
+     W(0x8a88d38b1d1488e8)},
+    0
+  },
+  {
+    {W(0x22da94d0491da122), W(0x1f0287d4a2765a7b), W(0x2b1581dfc9405465),
+     W(0xc9fc1ec837b143ef)},
+    {W(0x5a5930b01f459de4), W(0x91fabe0c608dc9af), W(0xaa6f106d582ac2df),
+     W(0xbd490355a1f4e1e9)},
+    0
+  },
+  {
+    {W(0xd1980100bf850344), W(0x72b08d754fd1c352), W(0xc000041d285f3d50),
+     W(0x7d04535324a74eb8)},
+    {W(0xcea2c0d9c12ac942), W(0x6f00aa15029703f2), W(0xcfada34ddae63039),
+     W(0xb568fd0d43abda38)},
+    0
+  },
+  {
+    {W(0xc2e91568b53cdef5), W(0x071c74e32c4544b5), W(0x0d38d1e50d11e6e6),
+     W(0xb1d8781a266290be)},
+    {W(0x3e1ff57629dc100c), W(0x3d6da92752e2efc0), W(0xb5445599b834f17e),
+     W(0xd5f3c5076d99980a)},
+    0
+  },
+  {
+    {W(0x96a35fdeec8f107d), W(0xc5e6771cdfb516ac), W(0xbc394e810578790c),
+     W(0x78d17d21ed00b113)},
+    {W(0x0ff26c9bb087a082), W(0x9c153535d1a0f801), W(0x129a08ee3a004269),
+     W(0xf88e3c1357eab421)},
+    0
+  },
+  {
+    {W(0xeeee8bae04bf455f), W(0xad393cc8cdfdc187), W(0x0c34d882645d0d22),
+     W(0x4ab41ead7c206a26)},
+    {W(0xb95e05bf250636fb), W(0xf6d418c3cbe3122a), W(0x2d332583e9e06179),
+     W(0x87ca57a26b14c2a9)},
+    0
+  },
+  {
+    {W(0xe7c17621e806af1e), W(0x19f3afab09e7f65b), W(0x552b03e72849ce9b),
+     W(0x90c281ced2db3693)},
+    {W(0xac1af46c276d98f3), W(0x042659e2c1855f2a), W(0x30849fc24718b1a6),
+     W(0x006d1dd3e13bd64a)},
+    0
+  },
+  {
+    {W(0x688d0fccfe354ecc), W(0xf5f07f1da60ea45f), W(0x217823351a90d091),
+     W(0xc60a9e1562f0943f)},
+    {W(0x8893c0d324340ec3), W(0x52bea81a88b310ff), W(0xd1b308203b2381a7),
+     W(0x4e4c97ab192c6d66)},
+    0
+  },
+  {
+    {W(0x66dc74f1f42749c4), W(0x0b4301ad10412432), W(0xab4949b0165535b9),
+     W(0xb98e04223652a1fe)},
+    {W(0x6570ecca88d46bfa), W(0x2faa12590bf86d7f), W(0x5be618f033f0f556),
+     W(0x271d56887733dce9)},
+    0
+  },
+  {
+    {W(0x54f465e4b0253e6c), W(0x727e03d88ea4a784), W(0x5a999d23ada1755d),
+     W(0x031091420599926f)},
+    {W(0x12b3997eca9dd88d), W(0x8fe184671b8b04f7), W(0x133370b5f4bd91eb),
+     W(0x20be2540e134c14d)},
+    0
+  },
+  {
+    {W(0x815cc34b4e8c2de9), W(0xaa341e7083a7ad9b), W(0xf7888c9462fad69a),
+     W(0x74c744c5a8eb5d28)},
+    {W(0xf4e8fc85a66b8af0), W(0x345214d358cd95a5), W(0xae5bee6620ecc7fb),
+     W(0xd8c600bc83893aac)},
+    0
+  },
+  {
+    {W(0x7c4822ed051aa891), W(0x82a7de7292d69f74), W(0x1e79560f5c5b19e4),
+     W(0xb6c11a599920ecee)},
+    {W(0x5606e84110c45826), W(0x948a8f75061c6142), W(0x8f079b9be579d8e2),
+     W(0xf4bf8cfefa096557)},
+    0
+  },
+  {
+    {W(0x28c35b0a0fae4b5c), W(0xf816773e7f3fbaf5), W(0x37e33557a9ea73be),
+     W(0x7b33418ebcae9aaa)},
+    {W(0x970cc5fc873b8c15), W(0x323d6c800833bd7f), W(0xfbeaf192d21716b5),
+     W(0x702286eae41f1fcb)},
+    0
+  },
+  {
+    {W(0x799fd863c0f6ed34), W(0x677d88baba8d6d14), W(0x51e35439319c0197),
+     W(0xf8e3fdd0b579184d)},
+    {W(0x949e5265f2348129), W(0x4e91a3d8fcb122c9), W(0x57014d8db1ae79dc),
+     W(0xd44fb03d2801167c)},
+    0
+  },
+  {
+    {W(0xdb4114d67ec61a3b), W(0x7b3f833f49cccd6d), W(0x8a8e8d234bf4595a),
+     W(0xd89d979498b9fb2e)},
+    {W(0xc85f800fd546a62c), W(0xfc5f363ccc3eb519), W(0xd8f669316d6c66d9),
+     W(0x13200ef558081196)},
+    0
+  },
+  {
+    {W(0x87c574bbce02bd3d), W(0x3cb798c5c460de78), W(0x61d2ef2f3b902020),
+     W(0x2b585df2fcc42fc7)},
+    {W(0x57e3d988e591d247), W(0x7ea4af3cbd6d8815), W(0x967316955e3eff33),
+     W(0x3b9940696390a6e3)},
+    0
+  },
+  {
+    {W(0x2467d5648a9bca1c), W(0x25f57d6b640cd8a6), W(0x81234ebbd5a18a10),
+     W(0x603bdea2b954b9a2)},
+    {W(0xcb5fd9b02ba1b6dd), W(0xdd7d81d238fc069d), W(0xd4cb6c6b0eea0a62),
+     W(0xb79b392e48fed7b3)},
+    0
+  },
+  {
+    {W(0x23991abc654f38ee), W(0x2f42e36868518861), W(0xbd1317141ddf24d8),
+     W(0xbb9beaa6eadefa4c)},
+    {W(0x68a5bdd85fac2cf8), W(0x562a7e9961f74832), W(0x2fdf74f6c3db010a),
+     W(0x0b3f2c1bc829db1c)},
+    0
+  },
+  {
+    {W(0x85c4a823b3657f13), W(0x4737b28a88874213), W(0xf51db69e5f32d986),
+     W(0x273dcd867ad654ba)},
+    {W(0xa0ca5f701cdb4a91), W(0x9fb6b207450dc02c), W(0x81017cf618d49e49),
+     W(0xd013d1f3f509d822)},
+    0
+  },
+  {
+    {W(0xe526ae3bafdd5a82), W(0x40cef62f53e4a596), W(0xaf33fd74b96a578c),
+     W(0xbb1cc791ef1a0fca)},
+    {W(0xc2f393887c9e895a), W(0x276064dbc55691e7), W(0x145b768acbcf433c),
+     W(0x591d2068862bda78)},
+    0
+  },
+  {
+    {W(0x325735da9c1009cd), W(0xec4149175095d723), W(0x2a123a290da52157),
+     W(0x88f7843dbaf5d1e1)},
+    {W(0xe096a6d01b558075), W(0xe1b8b574fee10332), W(0x642a3b5e43d58ee3),
+     W(0xb23e72459088b620)},
+    0
+  },
+  {
+    {W(0xb416f805b08aedf0), W(0xb39cadcc8763ab35), W(0x2aad70dae2a1b547),
+     W(0xc4ccee26c41ea02d)},
+    {W(0x8cc4e0aea020e819), W(0xce19c4d24e8b094e), W(0x12a6e6fed741ccd5),
+     W(0xd8444c9cb8a9a505)},
+    0
+  },
+  {
+    {W(0x1856a2bb3d3521e9), W(0x4e7286a3e2cb5e49), W(0xa9e0559a3507ef2d),
+     W(0x45b32b55a59aed58)},
+    {W(0xafb3864137badba6), W(0xff34658f35c9ae57), W(0xfbe7c81afc793937),
+     W(0x6b1f08433b40d522)},
+    0
+  },
+  {
+    {W(0xd37d07b988c56185), W(0xe1707d162054717f), W(0x75ed1e208b5200c2),
+     W(0x23cbb12b1a7a32f4)},
+    {W(0x42dc3583000c2768), W(0xcf27eae176c2ddcf), W(0x2deb8f4d0a420bfa),
+     W(0x2488c77b116cd158)},
+    0
+  },
+  {
+    {W(0x4eb9db8ad19b3efe), W(0x5ccaa869b6fa2796), W(0x83f018b81b84d2b5),
+     W(0xe1424153e8ccdaff)},
+    {W(0xd505efc2a6f0261e), W(0xb0afd5d46995d247), W(0xaef5854988024c31),
+     W(0xfe8a2e986226d446)},
+    0
+  },
+  {
+    {W(0x13389b4d916d8b30), W(0xbb61066c53e3adaf), W(0x6a64de9c52a6e0a6),
+     W(0x09400c138587e8bc)},
+    {W(0x67167bcafd32b065), W(0xb16e835c28fb7a84), W(0x3dca95231cb482eb),
+     W(0xc421c2c93315ef83)},
+    0
+  },
+  {
+    {W(0xc294ff9490c7d409), W(0x541de59d4be862ff), W(0xe6dc7a29b54c6637),
+     W(0xbe78f0cd4d69ad6e)},
+    {W(0x325caf3871246227), W(0xfad6104ff566b8b4), W(0xe4144a47c2fba04d),
+     W(0xacca6a353a3edee6)},
+    0
+  },
+  {
+    {W(0xb4e72b874372f19c), W(0x803f6f9b3471ddbd), W(0x0820f4df9ae4ba4d),
+     W(0xd9a3d69212937055)},
+    {W(0x287c1dc5e3d59a75), W(0xc8fa4b0ebe05bab0), W(0x4350e9029e89c05c),
+     W(0x2a4b1a408d421869)},
+    0
+  },
+  {
+    {W(0xf4281818b6603327), W(0x56084dc1e18f722a), W(0x57cfa9daf3062579),
+     W(0x93d8f8a9c26dd14d)},
+    {W(0xc07125d74ff1b1f8), W(0xcc36e7e737feaa96), W(0xab17f143b67142f9),
+     W(0x8d8c46fef938adeb)},
+    0
+  },
+  {
+    {W(0x5759a604ae790921), W(0x51b162e37afa74f0), W(0xda9177440f8ee77c),
+     W(0xd136984d70bc8963)},
+    {W(0x07e24ef24be65089), W(0xf328fe6d0d374881), W(0x78432342ed8e1368),
+     W(0x89bef129268c943d)},
+    0
+  },
+  {
+    {W(0x63e30dafe8deb050), W(0x9a894589ad43b8dc), W(0x67c47306178d8ac6),
+     W(0xea2608b0c37ce61d)},
+    {W(0x6bb4f64c6225a4cc), W(0x230105a312ac93bd), W(0x2d98fb669385cae4),
+     W(0x818060fbb011a990)},
+    0
+  },
+  {
+    {W(0xfbd16a22ef883fe6), W(0x2a9e318390a7c06e), W(0xdd0df01905feb3f7),
+     W(0x455c45eff234d24f)},
+    {W(0xe56288ad74b23aa2), W(0x78602da303768fbb), W(0xe92d4328afeb716d),
+     W(0xdd23159884d88855)},
+    0
+  },
+  {
+    {W(0xc0f78aa66fd4150e), W(0x4cb315540f4fd639), W(0xa70498b69e5dd8d5),
+     W(0x8b0704dca93dd161)},
+    {W(0x90319c78a7661e92), W(0x9edbf0cbbec1ed93), W(0x84f6df4accf71dd5),
+     W(0x7c260a4fd4d1d843)},
+    0
+  },
+  {
+    {W(0x8086e4954064f0cc), W(0xa8130eba45e44d91), W(0x0b07547ef0208d2e),
+     W(0x06199d0226907fd4)},
+    {W(0x0eb86d501bc56e19), W(0xf04b4107a3001f5e), W(0xe42eace07eca4b10),
+     W(0xe3c6e7bb57e2b946)},
+    0
+  },
+  {
+    {W(0x09b698a8914ac70e), W(0x0df51828ba21ce34), W(0x1a01ac6ee89f1310),
+     W(0x5c0ee8ba0b804e30)},
+    {W(0x2ce20006004e128f), W(0x8b7c3a26af55bc5f), W(0x9356b85bcba035f6),
+     W(0xbab454ee91ad7266)},
+    0
+  },
+  {
+    {W(0x5d7b6b3aa4ac1f47), W(0x7275ca4eb4a923eb), W(0x085ee25cb7d68d08),
+     W(0xb191c6f2c30e04f5)},
+    {W(0xcd747e5406cdca1d), W(0x460247476466a84b), W(0xe2444811ae653ba0),
+     W(0xfc892586b8acc636)},
+    0
+  },
+  {
+    {W(0x82ebebbdd7af6d57), W(0xf151fb163c84b186), W(0xde085e4e8a67bd09),
+     W(0x7630b644ee7b2038)},
+    {W(0x423288eb244b8ca4), W(0xed5223079660edc4), W(0x86446027c9baf32f),
+     W(0x0b376473ab65c68e)},
+    0
+  },
+  {
+    {W(0x533b0a7e01c4c3cd), W(0xf714ee4db21ae1d0), W(0x0409b482a9404e17),
+     W(0xd5527761aefdb5c2)},
+    {W(0x5dcdc6b6be9abf86), W(0x4b709c3b22a14ea0), W(0xad8f1b1316eb0626),
+     W(0x7baca8a0de0d78c2)},
+    0
+  },
+  {
+    {W(0xabfbf644df46b2ab), W(0x2184bfb2b49b272f), W(0x72debd16306279ed),
+     W(0x89ad933a5d2287c8)},
+    {W(0xed58ef440f17496d), W(0x53adf12222ca3c31), W(0xd2fa9b37ded97d66),
+     W(0x02626e58d2ea3832)},
+    0
+  },
+  {
+    {W(0xc64dbd719bcd3c3c), W(0x752824099d996e1a), W(0x0526912fa6af8387),
+     W(0x1c5e631f0d1614ad)},
+    {W(0x919e420c2f02c5e6), W(0x31f0bd1ad3f945c6), W(0x2735d066338c0d6f),
+     W(0x33a4253b1d8d8b55)},
+    0
+  },
+  {
+    {W(0x176d3c5159715bb5), W(0x0021f729b252e7a6), W(0x9a3bd25ac058a8cb),
+     W(0xd941dbc56a99a713)},
+    {W(0x0694a078d21198a6), W(0x8d1311d99b1033b9), W(0x3522d3c122e1ecad),
+     W(0x0f1250e72757a42d)},
+    0
+  },
+  {
+    {W(0x4cf90598a58d361f), W(0x070299ee139ab88d), W(0x87f0c11e809ff54d),
+     W(0x501f3193090d35c0)},
+    {W(0xc62b4fc1d66f6133), W(0xb7ed92a3c272a5f7), W(0x168d92f9254a4d5d),
+     W(0x3f8ca4aa6cc5cc0f)},
+    0
+  },
+  {
+    {W(0xfabf4775d48eae0b), W(0x9298753e921c90a3), W(0x28198aa3ce1ef4d1),
+     W(0xb9cf9176f572cfa6)},
+    {W(0xc6a5bb1e826a6a76), W(0x41fb31fc5f845000), W(0xa83c51977ec3e695),
+     W(0xce4ee4388f82c89f)},
+    0
+  },
+  {
+    {W(0x720df6c099e2be3c), W(0x97991a86acf8ba10), W(0x59fc53c6009a2d6c),
+     W(0x032a0d92f7b3db25)},
+    {W(0x5c40eaff9ddd90f8), W(0x6dc6ec8164096261), W(0x0c610fdb47b5e213),
+     W(0x84ffe6f53b18b4af)},
+    0
+  },
+  {
+    {W(0x9236ab41402e1e05), W(0x85b903f80fa78397), W(0x3439592183d1baa3),
+     W(0x355312a15008ca02)},
+    {W(0x69ac99d95a445bf1), W(0x631d73bc68d03cc7), W(0xfad280d386f0803d),
+     W(0x767054de03f4d6d9)},
+    0
+  },
+  {
+    {W(0x3f44cd955096cdaf), W(0x05baf1466e5542e4), W(0xfbbce2872eb11be6),
+     W(0x85922bd0d4736886)},
+    {W(0x238bd327f5d8bbf9), W(0x35e439ed44a6fd18), W(0x9f3063ba9cf5463c),
+     W(0x8ba8af9102a2c352)},
+    0
+  },
+  {
+    {W(0xcd60919500886923), W(0x6fb191c021ff10b2), W(0x40abe80d21b73b52),
+     W(0xe8bc940e45d021e7)},
+    {W(0x0e1de44955612e23), W(0x49df0178042a5a38), W(0x022001e0724e9c62),
+     W(0xc58f7d0dd5af3e4f)},
+    0
+  },
+  {
+    {W(0xd21d05a5b3ae139f), W(0xc31d055c1f55f771), W(0xb98a16edbea0738b),
+     W(0xfb69e8300bdb5fa2)},
+    {W(0xaab693b48c1b428b), W(0x3be881ee26546d9e), W(0x65b422498848c9f8),
+     W(0x70bdc45cd0a7bbcd)},
+    0
+  },
+  {
+    {W(0x64d97d038270a5ba), W(0x11e02214695a8487), W(0xd088640ca802b42a),
+     W(0x5573d1ec7c0af81c)},
+    {W(0xa75868c8d8713c0b), W(0xce173f4c60f16f32), W(0xf0c784eb9b22d9df),
+     W(0x824375ed6d9597b8)},
+    0
+  },
+  {
+    {W(0x55455a489c20eb0d), W(0xadf9862a325e5740), W(0x1ae0a14beaecc822),
+     W(0x949d2fa78d6652d4)},
+    {W(0xef90cbd6cbaeca09), W(0x462c3aabe602dc0c), W(0xb0f5d904e88a358f),
+     W(0x07fae25ac82d6830)},
+    0
+  },
+  {
+    {W(0x8c2068155ff04a19), W(0x99cd5d7f29fae837), W(0x84b4d269712548b0),
+     W(0xbcca3094d2b71330)},
+    {W(0xee67065facd6ccca), W(0x1b6c7ca14f53347f), W(0x239151dffab958b1),
+     W(0xcf07c09952c79405)},
+    0
+  },
+  {
+    {W(0x14d24185055e8e69), W(0xee7b1c3980ba5564), W(0xec63d45f54fab82d),
+     W(0x2faa6637f04f3436)},
+    {W(0x68b6064eaa5bd826), W(0x986cb453d9f8af63), W(0xe24c33b82704becc),
+     W(0x1d57afadf748cdeb)},
+    0
+  },
+  {
+    {W(0xe3164cee083f698e), W(0xb6ada22d54739ef1), W(0xd17951855f69ee13),
+     W(0x31cfb375cbbfdfe1)},
+    {W(0x3fce2621b9058ce5), W(0x8069c4486899c8ff), W(0xc24e73fbe895b2bd),
+     W(0x1709c860f2f90792)},
+    0
+  },
+  {
+    {W(0xb2db5da2629dbaeb), W(0x7dfdc6be18b18054), W(0xb2d14fd2a0e8db14),
+     W(0x0ef5a308458e7bc1)},
+    {W(0x98a41b88d6706186), W(0xcc78212eed1ed694), W(0xf4e9fbaf33e5042a),
+     W(0xb13c11ce8066739d)},
+    0
+  },
+  {
+    {W(0xfda278a2e69798c2), W(0x17d08a86c9c70e4d), W(0x6609e6055facac74),
+     W(0xb78018a52bb80e23)},
+    {W(0x1a61bbe9098719e9), W(0x320932366875d0f7), W(0x0579f0484b96ed74),
+     W(0x51509c3f17f0da5d)},
+    0
+  },
+  {
+    {W(0x37c88fd8046e79a3), W(0x1ff648fe5f5376c7), W(0x9080ffd49b999584),
+     W(0xe32088c91c8b6b3e)},
+    {W(0xf02032a01debf614), W(0x3f1e68ff0be43459), W(0x280b521e2b5e8035),
+     W(0xf8a28c0881af4df8)},
+    0
+  },
+  {
+    {W(0x59ee1a166cb5c9bc), W(0x6608297673c6293f), W(0x031b4ce872601afd),
+     W(0x5323b6aead471495)},
+    {W(0x85526d241df67b81), W(0xede0aa526a85e3d8), W(0x1c2f050a94c5975d),
+     W(0xe9e5cf446ccdcab7)},
+    0
+  },
+  {
+    {W(0x88ff17979ddca799), W(0x3c7226cad29a3aa7), W(0x78ad0591e5930d04),
+     W(0x1fee9bb13f9d3e83)},
+    {W(0xff9e9fac731e12d6), W(0xa6b07db572b85566), W(0x7e761c36d7dba091),
+     W(0x3ab59b8f6a46eb44)},
+    0
+  },
+  {
+    {W(0x45f0e802d722706c), W(0x5b0c19bf459a3465), W(0x2aebff65aff98b14),
+     W(0x56cf7377c4bd8a12)},
+    {W(0x5d50df92fe85fc82), W(0xf0835bb12ff36669), W(0xf98449d898076a01),
+     W(0x99d0e08526af7cc8)},
+    0
+  },
+  {
+    {W(0x6c478753bdde7617), W(0x82b1f38962665ec5), W(0xa8ea1aeb29c88388),
+     W(0x704ee9b0d35f21a3)},
+    {W(0x85683ee2ce2b6193), W(0x64ebb121c5f4b207), W(0x2d0136020756f4f5),
+     W(0x9edc58fe17d69d73)},
+    0
+  },
+  {
+    {W(0xd48dd0e72b9e15fe), W(0x946087357d2f5125), W(0x06846fb986db2ac5),
+     W(0x6ceb7b029fc56289)},
+    {W(0x40e58f1538fe09a4), W(0xb47880fbfd893563), W(0xe81c8cc6a1bca70f),
+     W(0x5e28e52b59252043)},
+    0
+  },
+  {
+    {W(0x34865cf0788f8990), W(0x7471bde9f6322842), W(0x0f531b639ed0f01a),
+     W(0x77c28954621e6d7e)},
+    {W(0x294c8794ee545cc4), W(0x7b4b503040b6f1c1), W(0x52318f1d82663c70),
+     W(0x87cfaf6e9bfbfc42)},
+    0
+  },
+  {
+    {W(0x8f469cac6f73be8d), W(0x4ee37de3b823d8de), W(0x5713481fb10acb56),
+     W(0x8cab346317fb8541)},
+    {W(0xbd1e8ac31bee9cd7), W(0x98d97390cdd1dc9e), W(0x575b276e3d727677),
+     W(0x66a644e9def76eab)},
+    0
+  },
+  {
+    {W(0x9157725122667198), W(0x45fb657f3a96470d), W(0x544ae14e991d0542),
+     W(0x7d67b5bb6036e01f)},
+    {W(0x601c20035395ce29), W(0xb72f89bc73fbd6af), W(0xfdb63e80db2a273a),
+     W(0x86cd760df84e0454)},
+    0
+  },
+  {
+    {W(0x6a43c4c63e27dbdb), W(0xcfd34c070f6abca9), W(0xad1b815bbb5645e4),
+     W(0xd7f49627eebc9620)},
+    {W(0x00af40ddef5e43df), W(0xc98a401dfd4e9a16), W(0x30c7e531bd27bc71),
+     W(0xa40a9f688f7e894f)},
+    0
+  },
+  {
+    {W(0xa725f78b6720d5b2), W(0xb7388ff04ffa223d), W(0x1fa263ae8ba2a630),
+     W(0xf980b20296425e2d)},
+    {W(0xc2b00315f1255007), W(0x375199b3966ca58a), W(0x87cd0912aff25f34),
+     W(0xed49b28f7049742c)},
+    0
+  },
+  {
+    {W(0x12da67fa41b38292), W(0xae01e81ebb4a676a), W(0x4ed1f129045aae46),
+     W(0xbad5f8c3d991d963)},
+    {W(0x56003c75f3795720), W(0xa73d59c851352844), W(0xbd54061a7f432a42),
+     W(0xb483abf471c6ce03)},
+    0
+  },
+  {
+    {W(0x890b59e7607af021), W(0x3ad8ad9d1e250336), W(0xdb8d33a607ca9f2d),
+     W(0x4f6b1a5ea9b52485)},
+    {W(0xd30dde1f6d1b44ba), W(0x80fc4b71312a91cd), W(0xb5cdab3a4cc4e9fb),
+     W(0xaef67fea0b924fa7)},
+    0
+  },
+  {
+    {W(0x46a89081c092e05c), W(0xc04c1e0afe499895), W(0xf3222684a33b5fc5),
+     W(0xe0612edd98e2a3f6)},
+    {W(0x3f1ad273fc1bc4d5), W(0x4417620429ee3004), W(0xdb60170fe416d933),
+     W(0x06a19c084b167487)},
+    0
+  },
+  {
+    {W(0x9cdb629e43b6cf21), W(0xfcd935f882e7ff0f), W(0x6aef5d9b87623bb3),
+     W(0xb584b6ea52c123f3)},
+    {W(0x80e432e0f83aac35), W(0x85c400c44e0d4d6e), W(0x9605fe1f8bfc54d5),
+     W(0xe844a541d99b325e)},
+    0
+  },
+  {
+    {W(0x01bdf66d320f9a47), W(0xf2966e35ecd8235a), W(0xd803ab31f64160b4),
+     W(0x786d7db4390d1ee5)},
+    {W(0xa7af21a87bc7334d), W(0x2976e9c49daf5837), W(0x3ebc1e0f5af4b5da),
+     W(0xbe91b23406bddc9d)},
+    0
+  },
+  {
+    {W(0x50c5b630b0f2f536), W(0xb3abc5a22ac46ed3), W(0x3dad171f32989d20),
+     W(0x67081c938cc68e8a)},
+    {W(0x34a79b862e934042), W(0xefe92f843c27f4ea), W(0x3a8c11875675b175),
+     W(0xe91a9518b0b1dc3d)},
+    0
+  },
+  {
+    {W(0xba61ab8865539df6), W(0xfa8252f57b2ce15b), W(0xd8e5e58729679a7a),
+     W(0x01921bcc4d2788f5)},
+    {W(0xad4bfc1439ff35c7), W(0x0ab5873083cf4c72), W(0xb5e3604c8feecbfa),
+     W(0x7550cefce00f6d1b)},
+    0
+  },
+  {
+    {W(0x6a6bbc1345446c00), W(0x8adc2234af285ccb), W(0xa2bebf1c93db6510),
+     W(0x42c11fcc0833fc33)},
+    {W(0xc8546e450811bc02), W(0xcd4bee73341319a6), W(0x2edc4b7f111be0ec),
+     W(0x9e1aecef18202b59)},
+    0
+  },
+  {
+    {W(0x61ac02895f506058), W(0x17ef7b87e90c82bb), W(0xd29aa637eba0cc90),
+     W(0x50df00819911a508)},
+    {W(0xc633081669933943), W(0x62d5212bf395f7a4), W(0x6565f3f1fa487987),
+     W(0xa33c98715472e27a)},
+    0
+  },
+  {
+    {W(0x83f74a78f919a605), W(0x645616c84ca93e5b), W(0x2d0e1eab05076399),
+     W(0xe810826e6b5db5c7)},
+    {W(0x062ffddd012633cd), W(0xc032697e37ba05c9), W(0x911a11ebf16f5b83),
+     W(0x11eddbf5f0288cd4)},
+    0
+  },
+  {
+    {W(0x87c590373262687a), W(0x52c6f7a4dadf7e71), W(0x72f3e6c19d4f93b7),
+     W(0x4265c87e7316c4b4)},
+    {W(0x4fdbaff43269ef81), W(0xb315247841619420), W(0x23b8574b9837875f),
+     W(0xd2cd0ab1031716b0)},
+    0
+  },
+  {
+    {W(0xd0205700ffb85120), W(0x6167807b6a15e422), W(0x35d0a824439de51f),
+     W(0xdce6f7c660191161)},
+    {W(0x12d4858cc1033c65), W(0x09c25e946dc08ded), W(0x206f12cd5a3449df),
+     W(0x3d4a3705fbf6c8ce)},
+    0
+  },
+  {
+    {W(0x949957b1b3ae832c), W(0x4af9f4bc1565209a), W(0x0492d6f558d53844),
+     W(0xd5e7cf1638946c45)},
+    {W(0xbb6b6ba22a03d0d6), W(0x053bba57af7e16a5), W(0xc3efeabdc36bfd9c),
+     W(0xfd0f4e9f280fc769)},
+    0
+  },
+  {
+    {W(0xf7d9306ce5e270fe), W(0x62a79720e97e628f), W(0x7964f5abdb545a8f),
+     W(0xfd3b5145a1f8da5b)},
+    {W(0xdf673c3881048ce6), W(0xd04b38e526e2d0ae), W(0xa54becb8c06a4b74),
+     W(0xe128f660e9a1f1e9)},
+    0
+  },
+  {
+    {W(0x06d1360dfe8e14d0), W(0x01071ab6fff133ec), W(0x6b7cdf1b8db66b99),
+     W(0x5337544fdeb5a8a5)},
+    {W(0xd73bba043d9277d6), W(0xbd75ceea56e88cfe), W(0xfde5a6f2ade574c9),
+     W(0x1ec3863b84041799)},
+    0
+  },
+  {
+    {W(0x639eede9dd4d5f1c), W(0xe5aa295fd9a791d0), W(0x8c9b84edf6087167),
+     W(0xc6348a529bb8e9c5)},
+    {W(0x9cb34757a19509b6), W(0x4a4fcdac40a8e402), W(0x61d35ed6ec8d5a7d),
+     W(0xa04646fba10547f0)},
+    0
+  },
+  {
+    {W(0x25dec82bb1533b97), W(0x4227928307bcfa00), W(0x43a948984ba3459b),
+     W(0x59ddec2aa2499123)},
+    {W(0x0998887ce48c9389), W(0x38945f3b833f3965), W(0xbebc6ed033b6b182),
+     W(0x60de4737ec567322)},
+    0
+  },
+  {
+    {W(0xc8f3bf149e208114), W(0x1b29acd2259c87dc), W(0x6c586faf32afe0f2),
+     W(0xebba4d6653b36a6d)},
+    {W(0x8fff389fb1696816), W(0xc030b6faa37138ac), W(0x81f36c9d4a0d9710),
+     W(0x900fbfd9b063a7f5)},
+    0
+  },
+  {
+    {W(0x8e9d290a5668fa53), W(0x5036a7ae49e86efc), W(0x09586d8d813e0018),
+     W(0xdada583b5245dfd0)},
+    {W(0xcaf699d7b6a3f6dd), W(0xfbe05c3d66f9309b), W(0x18e887edfde46c27),
+     W(0x391d7bcb93db790e)},
+    0
+  },
+  {
+    {W(0x0198dcc2dd4363e1), W(0x73e35829f7780ae3), W(0xaee3610e2e79f542),
+     W(0x7c7dba650797d16b)},
+    {W(0xfb0d1ebee9b02173), W(0xd9f074515b1891a9), W(0x796f810d46208a2b),
+     W(0x184a5dba7026cbb0)},
+    0
+  },
+  {
+    {W(0xa8656082c48da86c), W(0x53fe1204758d38e7), W(0x170b17e66d7d26dd),
+     W(0x2dbcf2f237394647)},
+    {W(0x44495e2ae3aedc74), W(0x1c49d1b92e4b9562), W(0x41add14e09976d20),
+     W(0x01c9a6707ad9e9a0)},
+    0
+  },
+  {
+    {W(0x0432a63a3897d813), W(0xc4e533d104326ac6), W(0xefbb8a4903e060f4),
+     W(0x55054519d328141e)},
+    {W(0xe44c01287a6d185b), W(0x89c295df5980aad1), W(0xbd899c6f6e17847f),
+     W(0x1b075bc6c1d3fc5d)},
+    0
+  },
+  {
+    {W(0x41984dea4a1333d8), W(0xeb427a9274f1864a), W(0x6d132e992f8083b6),
+     W(0x05a51634a859351e)},
+    {W(0x891d982c59e61dad), W(0x9c32c46ab5bb6a71), W(0x1ade5356db8e68ff),
+     W(0xe1781f765822eb5d)},
+    0
+  },
+  {
+    {W(0x471bcfa7d2d1aae8), W(0x9ac25b90ffee6043), W(0x8b08f883e8122a2d),
+     W(0x5332b83c4246dbf7)},
+    {W(0x8e9191e33432aed7), W(0x6b384f4125bca487), W(0xe437d49acefb7a41),
+     W(0xeb1c27ed191fae8b)},
+    0
+  },
+  {
+    {W(0xc840909b90eaea72), W(0x259664b0794c9ac7), W(0x002fdd5cb1416319),
+     W(0x499ba5948833594b)},
+    {W(0x30e42d151f8ed0cf), W(0x458e76393023d9e8), W(0x276c4a15ce32fe09),
+     W(0x209302e10bad6897)},
+    0
+  },
+  {
+    {W(0x7aa8d567e1d473c2), W(0xfd0cffcc742d4254), W(0x6f1ebab3e09549de),
+     W(0x26d65f7252841192)},
+    {W(0x38ac6c58aefb6167), W(0x678e932ed7a43b8a), W(0xa18b1737f41c0b6a),
+     W(0x434787bf03e4e0eb)},
+    0
+  },
+  {
+    {W(0x9e5edec1c65332d1), W(0xface4147cde79f2c), W(0xa5cabb59a6dae9f6),
+     W(0xfc85a2b623a4e718)},
+    {W(0xd2bdf0f3e3435655), W(0x91d18fab82b7da3e), W(0xacb67effe894ed77),
+     W(0x0365cd9e131fee69)},
+    0
+  },
+  {
+    {W(0xdcf9fcb7e068a3e6), W(0x90817e9e255896b8), W(0xf2a4746eec95e061),
+     W(0xa8f3917bfa9c12a5)},
+    {W(0xe436de1d42f1aae3), W(0xa59e8dc277b74601), W(0xdb031719fca1a725),
+     W(0xd232fe14a7151bad)},
+    0
+  },
+  {
+    {W(0xdb29f1c268a5507e), W(0x961633744d12b3b2), W(0x36f6b4424f78a402),
+     W(0x53e357cdafe3f200)},
+    {W(0x797f65d7d5c0a322), W(0xd6b551b1c91562e9), W(0x696d6f8f829c586c),
+     W(0x1c75692c1eff5491)},
+    0
+  },
+  {
+    {W(0x27e1b633cecb00a7), W(0x92f23032fcce9a35), W(0x979a333bbff7b454),
+     W(0xa32ef1f890218e80)},
+    {W(0x59c96051dca62256), W(0x66446219aaf3827e), W(0x318eb027e80ebe7f),
+     W(0xff9ab12d6268535e)},
+    0
+  },
+  {
+    {W(0x2e6adf5b1b66e943), W(0x13f7dab718c51f61), W(0x9114b730b03490a2),
+     W(0x76538e82afc29c4a)},
+    {W(0xe6ba88a3dbe4afb5), W(0xbfa5e2344babb1fb), W(0xe2337979ba0291d1),
+     W(0xeb6c25b8a8f1a628)},
+    0
+  },
+  {
+    {W(0x598469cae6aa89fd), W(0x4d44ba96d8ff4c67), W(0x4c4c8e1f537e0202),
+     W(0xf7781ac0292da2a6)},
+    {W(0xf999f6eb61a21587), W(0x8f49c5a28a9aea20), W(0x282f9f5ff1b63c91),
+     W(0xc9803b79faedde81)},
+    0
+  },
+  {
+    {W(0x160d40683e643551), W(0x59aafd133395e59d), W(0xa847a12b2cef2287),
+     W(0x2d3c90e3d50864bf)},
+    {W(0xf045c3bbf3350184), W(0x6d5fd2fd47cc961a), W(0x4c8d36d154163005),
+     W(0x77d732064381201c)},
+    0
+  },
+  {
+    {W(0xd25b275e7f43000e), W(0x1c27e97b65225348), W(0xc5f684e4e23d2f42),
+     W(0x0eba5db6cbcc5578)},
+    {W(0xb519fcbb74ba15c9), W(0x0a17e84ea0a24a11), W(0xefa7f4558bbb4872),
+     W(0x4b135aad82294839)},
+    0
+  },
+  {
+    {W(0xc26213f1c7db66e0), W(0x913c522f643ec987), W(0xb383aa73a8c61857),
+     W(0xa0e7c26e6efc880f)},
+    {W(0x69f52a96ef21eac5), W(0x67a37ffe49daa72b), W(0x1c9508f1a1cb4a6b),
+     W(0xfb301e21f5622fc1)},
+    0
+  },
+  {
+    {W(0xaf861b941e2c5560), W(0x05f5938171e4876b), W(0x988f7d382ef23a82),
+     W(0xbd5396d21b8029c7)},
+    {W(0x01cc17832e8dcffa), W(0x2d38e578232d4b2f), W(0x4998f85ad3e798ef),
+     W(0x4b34d0972f85e6df)},
+    0
+  },
+  {
+    {W(0x59e43c0478a788be), W(0x8d1f47395e672c13), W(0xe8057f2f02811c1f),
+     W(0x40516d29caaf27f5)},
+    {W(0xd78f43843a8c5263), W(0x271748093f88bf5e), W(0xd33480e6b1a7e273),
+     W(0x7bc600e9ef27dcf1)},
+    0
+  },
+  {
+    {W(0xca4a972d7166c09a), W(0xb1d39ff4e3ccffb4), W(0x802925ec8e52192f),
+     W(0x76485a3626fc19c4)},
+    {W(0xa4047b2f3b31795d), W(0x775f6ae80b4fadc5), W(0x1f3cbe3126d4ccf1),
+     W(0x8ecb816636af0b97)},
+    0
+  },
+  {
+    {W(0x8f2c16b56dfeb140), W(0xe7f3ed1275cac8a3), W(0x60bf7298f094c469),
+     W(0xe81f20701d45908c)},
+    {W(0x748f70dd9cd98a9f), W(0x82fe920f28fd6438), W(0xe8993b76169c5335),
+     W(0x8a9b0e07d052b3aa)},
+    0
+  },
+  {
+    {W(0x580a24ada6d03062), W(0xd9cdf9f556bb21ea), W(0x6b1c2ff903729b84),
+     W(0x37e12ff600d3ecb5)},
+    {W(0x66a697ec335c8546), W(0xe0fdc41bfd4e9b9d), W(0x456eb1a8d3a71e23),
+     W(0xb0720556709cba16)},
+    0
+  },
+  {
+    {W(0xe8417945eb0345d3), W(0x2d314c8f29aa4d26), W(0xd3c59e8160cf6d91),
+     W(0x07009ee5d1807559)},
+    {W(0x6aec95b97ced5518), W(0x9542a3946cb7dc92), W(0x7cd1a06fba2a26c8),
+     W(0xfc3d2373fc6dd33a)},
+    0
+  },
+  {
+    {W(0x8992c2bc67401fe0), W(0xe1660b1ff2751593), W(0x77aea98b6d2a798f),
+     W(0xacd4dad4899c2a96)},
+    {W(0x9fb1d6c6300704b5), W(0x01ea031ad7a1631b), W(0xfff37bbe02bfcbbb),
+     W(0x07d97592c03691a8)},
+    0
+  },
+  {
+    {W(0x3ed19aedec745e42), W(0xac0d446c8c97ebde), W(0xd99fa4b1de1effc3),
+     W(0xf845f10d86ff1478)},
+    {W(0xdad77cd6273a598d), W(0x9a333e09d79f40d5), W(0x378a2d6d676b7570),
+     W(0x18dece4b3a21db4b)},
+    0
+  },
+  {
+    {W(0x1bc7b25b5f57537d), W(0x8bb34791526e0b39), W(0xb5f5e0cc684329d9),
+     W(0x863c53253bd8ad3a)},
+    {W(0x641aa7e9abedceb7), W(0xeb6f63331f92bfd3), W(0x13b9d0ac867b33cf),
+     W(0x0ba7b477d3f7ce60)},
+    0
+  },
+  {
+    {W(0x0aefe54a06b5eb33), W(0x758fb08df8270a7a), W(0xd2d846d37ee39e60),
+     W(0x410a72b3b703f793)},
+    {W(0xde50f948400df5a1), W(0x5a13b788c95c2029), W(0x8b8797155584476c),
+     W(0x1afd300c802a2fa5)},
+    0
+  },
+  {
+    {W(0xfd405fd8e922502c), W(0xeb9843fa03003e9a), W(0x6a5274326aae3c5c),
+     W(0x35666368c4b1b2b5)},
+    {W(0x0424132e1b631e09), W(0x782a4f24328b5033), W(0xd49c5cf9a1dbc4dd),
+     W(0x10e958c137e843a6)},
+    0
+  },
+  {
+    {W(0xd42c4eaa64f6e178), W(0xcc28c3e215cc79a5), W(0x9ab60bbfb1217fed),
+     W(0xf6b14aed9db7d032)},
+    {W(0x23d4b765c665ba48), W(0xbb50b32f97938ccc), W(0x31525ef506582c15),
+     W(0x8f440e883c73e5f7)},
+    0
+  },
+  {
+    {W(0xce5ad6cbb2c704da), W(0xb55c63b878412cac), W(0x2de7c1cc6f039e29),
+     W(0x56e369e34dea7721)},
+    {W(0xa9fa60ab3a89f483), W(0xd1bc992da8530183), W(0x861863b7c941cf4d),
+     W(0xbfba67e33c47c20f)},
+    0
+  },
+  {
+    {W(0xa91cd1439a505b41), W(0xbbfc8d2cf10231db), W(0xbd58d3419462f0b8),
+     W(0x6d7bfd5410d2318b)},
+    {W(0x68f0f07eb9fa43b6), W(0xb7e31de7137d02b4), W(0x1c2bf9cece1db2c7),
+     W(0xb342f09e24b9b010)},
+    0
+  },
+  {
+    {W(0x6bea9792c3cb3987), W(0x5ddcc3344fd24684), W(0xd703ea19741ac5e8),
+     W(0x13504b167112f4c0)},
+    {W(0xd890bbe3838ccccb), W(0x31977e0d2b4a2d30), W(0x5094d2f725e8dd03),
+     W(0x54eaaa1bd326c45f)},
+    0
+  },
+  {
+    {W(0x289e6bb768025b36), W(0x2dfce6072e914da4), W(0x9189e3c3786a1e1c),
+     W(0x911f5ae41338baae)},
+    {W(0xe4e5352a6ccdf0ec), W(0x30a021e93f2e7e6a), W(0xa765cda2b3113620),
+     W(0xdcaa3c1198268c91)},
+    0
+  },
+  {
+    {W(0xd6153da1bd14a709), W(0xacd2a1d5977e159d), W(0x1a64198566611b67),
+     W(0xca6ff5a33bd0fb90)},
+    {W(0x483e537addb5fe22), W(0xdf04f923df33dc64), W(0x8632af29a42cbcf0),
+     W(0xa304f34c0882aff4)},
+    0
+  },
+  {
+    {W(0xb3fd5c62c4c85b79), W(0x184e47923f63b1ae), W(0x6130d5d36fdd8990),
+     W(0x14bf112741a6640f)},
+    {W(0xf936d61e0e99a44f), W(0x746e8f343c9ac493), W(0x6dfcfa2d0cfe2dd9),
+     W(0xbf94145ef663e84a)},
+    0
+  },
+  {
+    {W(0x7a37c34cfd737f83), W(0x4e9e544f28358afc), W(0x810bd731e0d3d55a),
+     W(0xd3b8ccfa2e82bfa0)},
+    {W(0x8a2161c4acf954ca), W(0xc19243c65c9b70f0), W(0xe141ed1ea99e451b),
+     W(0x58c2e5150f709b13)},
+    0
+  },
+  {
+    {W(0xdbb7033d95d230c1), W(0xf64ec15c0b7eceb9), W(0x4429b87e15c9e742),
+     W(0x0388b79bc06f11c5)},
+    {W(0xfcd7b86080cb078a), W(0x2726ced3d0015af3), W(0x46cd503081f15acb),
+     W(0xea75954dfd0c5924)},
+    0
+  },
+  {
+    {W(0xfdb4b0b6270e6121), W(0x0d4cdc2a66e11670), W(0xd300afb397cfb755),
+     W(0x6d6f4a5257a1b4bb)},
+    {W(0x844e19ad81057e2a), W(0x2cae744a887b11e9), W(0x5c398385efd57219),
+     W(0x4c7427ab564c7d53)},
+    0
+  },
+  {
+    {W(0xfad53270d441e3ae), W(0x04baf23a4f8e1b07), W(0xbca9fddaded59475),
+     W(0xbe9f6cde5b5f9897)},
+    {W(0x3f31295d0016c00d), W(0x5c85574d08cc3427), W(0xeedac1b503ae6348),
+     W(0x24a61416006c7e85)},
+    0
+  },
+  {
+    {W(0x4e58b527dadaf5d9), W(0x6b42397d9e910d36), W(0xbea334b068d606be),
+     W(0x3069ad4c6db7f2c0)},
+    {W(0xcd6de35de2f073d4), W(0x1e270039b1d4a36c), W(0x061756ea0254c1be),
+     W(0x0775516cc1d5712b)},
+    0
+  },
+  {
+    {W(0x19f3321b0e17449a), W(0xf052a0e85fc7a24e), W(0x9349b6ab407851a0),
+     W(0xa33be6a3e9df55ec)},
+    {W(0xafd599b9db689f23), W(0xfbe666f36f01c5f6), W(0x66d0ab1ccdf05efc),
+     W(0xef005aaeb172c093)},
+    0
+  },
+  {
+    {W(0xe264395a4097a948), W(0xb3b937fb5875fb3f), W(0xb6ca38298fdeb64e),
+     W(0x930feebfb1a5680f)},
+    {W(0x14ebb16f54af081d), W(0xfcc5943c5c5eb2af), W(0x5733a3da79782d2b),
+     W(0x39d4c423d4eb9833)},
+    0
+  },
+  {
+    {W(0x995e83f7f5150b4f), W(0x9a4039e72e66192e), W(0x7425997eafa238cd),
+     W(0x213b9b674448cd74)},
+    {W(0x077c7dd9c3a56e62), W(0xf895f99ebd9fd8e7), W(0xbc6147f02e669c65),
+     W(0x2aba3b1d4dbb57a0)},
+    0
+  },
+  {
+    {W(0xcaab90fe8264050a), W(0x59feefdc2f929492), W(0x66d3e21409ba9b6f),
+     W(0xb9bc890a9dd3c446)},
+    {W(0x76f059cb47dd15c4), W(0x9f73c8deb7fbdf86), W(0x78a9c0dadee06b0a),
+     W(0xac73d63a25a6d41c)},
+    0
+  },
+  {
+    {W(0x8c762c0a61176cb0), W(0xb838ed305061ca58), W(0x30d3d6973e04c4c1),
+     W(0x36d85dfdc11d7a80)},
+    {W(0x4bea1079996124c9), W(0xbc2aa46e8e83dbe0), W(0xd53c15bba9a2ec34),
+     W(0xaeafe507f11ce2b0)},
+    0
+  },
+  {
+    {W(0xaf8baa24f87df665), W(0x64ae3cfbf1838457), W(0xb4bef96c5bb304f2),
+     W(0x9c255f15f69ec17b)},
+    {W(0x112f51cb15158797), W(0x0d36de91ae091c4b), W(0x8373a392e7a93d0c),
+     W(0xbb5137116d219c51)},
+    0
+  },
+  {
+    {W(0x69b7add641d51cd9), W(0xfeb80cbc9947bdf2), W(0xc93c44c0f8b7aa65),
+     W(0x0a0fd51e9399b5d3)},
+    {W(0x5a385d66330a4fe5), W(0x41b70d468e983a7f), W(0x9f454fc6573c7502),
+     W(0x032aa907d3a1e465)},
+    0
+  },
+  {
+    {W(0x87cb93e90f1b82c8), W(0xe63f777c91d08be0), W(0x3bb855475bbe689b),
+     W(0x14c5a0cfdbdb01f7)},
+    {W(0x467eb2fba444f46e), W(0x3adfacb1b0fbe459), W(0xd02758b2e8f6867a),
+     W(0x33eb91139ea3085b)},
+    0
+  },
+  {
+    {W(0xc38db4dd19413bb1), W(0x32b0ab3afe9bfcc8), W(0x7ff73bc3643f0cfb),
+     W(0x62d5dc953a6aaac5)},
+    {W(0x382eac10fccd6c68), W(0xcbcf20f8e35825da), W(0x55875e82c50e9b24),
+     W(0x25a1267816c93703)},
+    0
+  },
+  {
+    {W(0x9b2d90e84287e2c1), W(0x7c9176c2268c3667), W(0x177f23d2d1a72f25),
+     W(0x760fe3b2ad3a6f20)},
+    {W(0xd547e65769d91876), W(0x67fc427d115e27a2), W(0xde9a0e2dc260c9eb),
+     W(0xc74c22928d4b51e1)},
+    0
+  },
+  {
+    {W(0x3b70712ba37de64e), W(0x8008178afc3d5d3e), W(0xf6ad718b935c0389),
+     W(0x2073ebac50b07984)},
+    {W(0xc3ce61a5840a7988), W(0xf5f7e3f3727ff517), W(0x23c40555b0cca70b),
+     W(0x92164aae2dc82a14)},
+    0
+  },
+  {
+    {W(0x5adbd25474d1c1e7), W(0x5a6e2cb4d75c5a94), W(0xf902a1609134e385),
+     W(0xd973314c9cb162f2)},
+    {W(0x6b138492ffd64417), W(0xeadea5e3870eeb78), W(0x6d337455cb55787d),
+     W(0x80b28b49dd62f908)},
+    0
+  },
+  {
+    {W(0xd057f75d91d237c6), W(0xb4f212db88ecb090), W(0xe200609afb03515a),
+     W(0x4dac5149d358b0d5)},
+    {W(0x9ffc82bf1781ceca), W(0x6184abfc42e16168), W(0x2e52039e1e057622),
+     W(0xc567b8ee622a8e9c)},
+    0
+  },
+  {
+    {W(0x6e5e294cc985b9a2), W(0x70e40c95a842fe69), W(0xf3a7b11c2f346623),
+     W(0x5f3b656975610660)},
+    {W(0xa07ac312bcae0252), W(0x225962f10cefa8b2), W(0x030ac6cec417d4fd),
+     W(0x03b5eb4a6c72c67a)},
+    0
+  },
+  {
+    {W(0xa22fefabc00318b9), W(0xf8bfeb37b1e3bfb0), W(0x22f30f6d04b166c0),
+     W(0xc6323abfff99f34b)},
+    {W(0x144a788934f5f756), W(0xb4bfcda85c8e7b3e), W(0xb8574a51d605db06),
+     W(0x4a7d2122571c4180)},
+    0
+  },
+  {
+    {W(0x09b02fac36dd6d20), W(0x1c7412be498b47e1), W(0x4060dece941aa5d9),
+     W(0x948ec592931afc02)},
+    {W(0x79bfa03d8a6b5d5a), W(0xfeae35a4fb361377), W(0xaa9c21b0b596a13f),
+     W(0x5f6e08da86cb5065)},
+    0
+  },
+  {
+    {W(0x48ea1708ce5109ff), W(0x56f11623bbb17ecc), W(0x134ce6cb6f6941fb),
+     W(0xb1367f212c4875d4)},
+    {W(0xd354f499ed2c06dc), W(0xd081d005c069a42a), W(0xa5026720a311e06a),
+     W(0xcfcff2347c876687)},
+    0
+  },
+  {
+    {W(0xc9e92b9ec73d087e), W(0x0d4bcf40eb9a7a13), W(0x81f2eb51cc42a418),
+     W(0xc4a4fead753c8d76)},
+    {W(0xe010875e79592089), W(0x63a6ab98fe3cd8b4), W(0x08f69bc4bc3a89df),
+     W(0x9ac4578e7c94b79d)},
+    0
+  },
+  {
+    {W(0x269c3df3397b929d), W(0x503ecdecfa6caba1), W(0x9dff08b29b39acbe),
+     W(0x8d620c31138b6367)},
+    {W(0xe572d6c79243a5e7), W(0x9c9fcf0fd2490716), W(0xc45753b2e43dad1a),
+     W(0xa706f741ea9f4482)},
+    0
+  },
+  {
+    {W(0xd817c6d6772350c7), W(0x98f1d44ba74776de), W(0x9786940c73963ee6),
+     W(0xa3261d4924d1400c)},
+    {W(0x917ff88304d9dbae), W(0x97b4bb837d5a9b4b), W(0x70ea5fe1687b47b6),
+     W(0x353dccffd581b3dc)},
+    0
+  },
+  {
+    {W(0xba2c996d03f8b126), W(0x25aac14c904d454b), W(0xd4ce11036c52c68d),
+     W(0xa92bf0220d188c17)},
+    {W(0x4b51c8b8e8ee905e), W(0xfa9d815d0b733198), W(0x1323685bf9dc2942),
+     W(0xddac2ca09340aee7)},
+    0
+  },
+  {
+    {W(0x615040b9a5aed5b5), W(0x725f4c7244541c42), W(0xd5ca30e241c84851),
+     W(0x11d12d0ad8172376)},
+    {W(0x967d9049f3627301), W(0x09f2f54fc356ce66), W(0x5e3c33e7af0ef19c),
+     W(0x7c1c4c5402f2f203)},
+    0
+  },
+  {
+    {W(0x38f500331a374129), W(0xddfaf574bf67248e), W(0x1fbf029cf647af3f),
+     W(0x87379c59ba3ec0df)},
+    {W(0x694e91fc65d4da87), W(0x4e44c2c47d7b36a8), W(0xf6965bef72a46c46),
+     W(0x0c76fe6db5bbe873)},
+    0
+  },
+  {
+    {W(0x027d1779829bc87f), W(0x15030132c569a683), W(0xe36307b00df6afb1),
+     W(0x476dd583c02901a8)},
+    {W(0x0cc1da976c4ee707), W(0xbe9bb10f32089b41), W(0x619f344312dfa7eb),
+     W(0xf16cae5e4f279950)},
+    0
+  },
+  {
+    {W(0x5970e009b398ba52), W(0x4d5bdd3a063ba554), W(0xbb777f39d4a9fa1d),
+     W(0x3f22b1720652e879)},
+    {W(0xde5a8fbbfd9ebe97), W(0x5b9211d7ff94917b), W(0x990ae5d8cffe3544),
+     W(0x8fe5026366c6decd)},
+    0
+  },
+  {
+    {W(0xb10fa62a16753685), W(0x941657abd75f371c), W(0x2f459ec2dbe08545),
+     W(0x8415a82054f65d1d)},
+    {W(0x36a6647fa0d13d66), W(0x759df3bf9ae4f471), W(0xd9810b66f71aff9f),
+     W(0x28bb2a186fbb8952)},
+    0
+  },
+  {
+    {W(0x85a8bc899d6250c0), W(0xe1c7fb6c93c7214a), W(0x35a963d6ce440e78),
+     W(0x974608c88e2c0be0)},
+    {W(0xcd72e0f67e7beaa3), W(0x0b32dd7c9ac090f6), W(0xd6b380f0422eb22f),
+     W(0xfec45b8e15c84366)},
+    0
+  },
+  {
+    {W(0x2f517ea3200a6b55), W(0x713da921dd097c59), W(0xf605159f830756af),
+     W(0x4d096fe4894b1c9a)},
+    {W(0x059b25814e9b1453), W(0x50a18c01603865a6), W(0xbdafc8ab8214803c),
+     W(0x84a4dab2ba0a2a5d)},
+    0
+  },
+  {
+    {W(0x09d9b005e891782d), W(0x4a52eb6a58bd079e), W(0xce3567d1b8a5c5b9),
+     W(0x8e776b53f5f8895c)},
+    {W(0x7a5ae9604084f033), W(0x38fbab60c755e439), W(0x750d9dbaa8b6d578),
+     W(0xf310389c27e77cb8)},
+    0
+  },
+  {
+    {W(0xb810b5514a7ad12c), W(0x51a0aff7f5b57645), W(0x13f680fe6813389f),
+     W(0xfb7ecda7012392fe)},
+    {W(0x867b4f38e3d281db), W(0xcb420a9ca0f1b505), W(0x2caab7ddf281187f),
+     W(0x05668c449f04e8db)},
+    0
+  },
+  {
+    {W(0x16e09437b48e6502), W(0xd0f8e181ef2dd4fc), W(0x3150b5b5a0595ec1),
+     W(0x172374f7a9140ff8)},
+    {W(0x7ac60e55be2ca178), W(0x9ff9f692feb01f83), W(0xa503491065acdfd8),
+     W(0x41710463bb86df19)},
+    0
+  },
+  {
+    {W(0x80eabe7b71b50868), W(0x8294cdc25ec776e9), W(0x4b758a9c5d702653),
+     W(0x95b41421dd944734)},
+    {W(0xd0ccf3b6fc7dfa2d), W(0x38793fb3a5ddaa99), W(0xc4943d56e571658d),
+     W(0x18920375fb058fed)},
+    0
+  },
+  {
+    {W(0x69249ad086c76410), W(0x7f6ec3d2148e7678), W(0xa19fac0a15a33cc7),
+     W(0x18f06d5e9b985aff)},
+    {W(0x0ee511bdef5a0c92), W(0x61edede02586da4b), W(0xce39b990b193b182),
+     W(0x11660e6d1372af8f)},
+    0
+  },
+  {
+    {W(0x9369b6f88c3dbabe), W(0x726dea1f6c064bf7), W(0x994399763f3cf41d),
+     W(0x95003a58cd0c1a1a)},
+    {W(0x8c424771ce216d0f), W(0xae301d96375a9521), W(0x8e61c6acfa2eeba9),
+     W(0xdd427b2d37e95cb6)},
+    0
+  },
+  {
+    {W(0x4bce7b4cba78ae5f), W(0x4d14f75de1799e6e), W(0xad5fe403c3598abf),
+     W(0x5d603cee79e66c43)},
+    {W(0xf9f210a784759ca0), W(0x2f5e6a22223169dd), W(0x977669853d97acf5),
+     W(0x190affe0c42502c5)},
+    0
+  },
+  {
+    {W(0x740c3b00de3033d8), W(0x9fd442e95c76fc28), W(0xee7324b1f44cdb5a),
+     W(0x7e4862e0e6bcd560)},
+    {W(0x7c65850d75fae85a), W(0x5a007c532e5bdde4), W(0x520afc1a66244861),
+     W(0x00014a7d12c57cfd)},
+    0
+  },
+  {
+    {W(0x83f8f66069f837f0), W(0xa47a162f460e890a), W(0x5a93e70161bc8311),
+     W(0xbefaac062b2048f7)},
+    {W(0xd91497f669b6234c), W(0x53a0f75345cc75ea), W(0x70f72dee0284beca),
+     W(0x9906a5d1269f8f56)},
+    0
+  },
+  {
+    {W(0xd6f59e29ca1d9d2c), W(0x46543d7bdd1ac2c1), W(0x337d903e5fa70f2c),
+     W(0xecf6c7f4a64ff5b3)},
+    {W(0x22a3128cc5a27171), W(0x0b2f7a112fe18f85), W(0x888a965b9bb19cef),
+     W(0x3caf9d593d2b0239)},
+    0
+  },
+  {
+    {W(0xbe1003b52da24cb5), W(0xd739834a99ba60ee), W(0x7f0bc419faf2663c),
+     W(0x7580037fae34a3a5)},
+    {W(0x0b8a5d975ba51a76), W(0x88a1ec9ff4cf4358), W(0xd6c99ae36442745f),
+     W(0xe21b57b193381d46)},
+    0
+  },
+  {
+    {W(0x0424ea4d4ad91f81), W(0xc7c86e5fa214b52a), W(0x47f5dee622523794),
+     W(0xc69d1e33108d3b42)},
+    {W(0x2c8ae442f3d86b10), W(0x410cf84d17ed0426), W(0xcddc126ea5a3a0c7),
+     W(0xb624539d11abd601)},
+    0
+  },
+  {
+    {W(0xbc827de28e27a3ef), W(0xe8d9219e3185370d), W(0x5176d5180d0136b7),
+     W(0xd63e99714d31d763)},
+    {W(0xe817f8642f400bf9), W(0x2154f0e7cd481927), W(0x5995ca903376aec0),
+     W(0xce00092f958c4ab1)},
+    0
+  },
+  {
+    {W(0x62cb4a8f71b20550), W(0x0f9b0e06a4f8865a), W(0x7381d46e5bdd0b21),
+     W(0x17d47570b4f8b90e)},
+    {W(0x71d7f3d11677e55d), W(0x2d112890a7c62a39), W(0xd32535b97c5f2dd8),
+     W(0x0b673a27361b6a23)},
+    0
+  },
+  {
+    {W(0x23874da9082fc853), W(0x76b51448649610d7), W(0x0c2c1d8d7ba945d8),
+     W(0x005f2deb8ae948e4)},
+    {W(0xf283cff948830506), W(0x01b0de0856e1dfd0), W(0xf70a903cd3f644db),
+     W(0x9de040cc196b32e5)},
+    0
+  },
+  {
+    {W(0xb7530fd9cceb632e), W(0x169637a07d2701de), W(0x313c41b4a34eb11a),
+     W(0x5e869cd5cdbea6ba)},
+    {W(0xa4934fa469bae4a1), W(0x249d7e2a0ef12bc3), W(0xd62c17f881a6b22a),
+     W(0xe6318123bcf06b34)},
+    0
+  },
+  {
+    {W(0xa8afb8371be96ab6), W(0x462a9c01eefc3a7f), W(0xc7e11c693e0d7715),
+     W(0x10e0e56a3ba1ddfd)},
+    {W(0xf2adf021374bcc35), W(0xea4e2bc5dff5ec51), W(0xe47ef889bc9ec4a5),
+     W(0x661eda889efc4f16)},
+    0
+  },
+  {
+    {W(0xc0cd28ffee12a301), W(0x651f8395ebf12fc0), W(0x6ec7ac4042355528),
+     W(0xfb47fe1c57f9595d)},
+    {W(0x73e497e854ac3e3a), W(0xc0e2f8682460feab), W(0x384cae2f852f9011),
+     W(0x0a01edeebdc5a0f2)},
+    0
+  },
+  {
+    {W(0xcef5c7038815b118), W(0x9d48bf3420cff77a), W(0x277fbc8f8c10bf6b),
+     W(0x3bb5f3b9b770c33f)},
+    {W(0xae24dd3226f434db), W(0x06ed25497199f355), W(0xafc1658be596e071),
+     W(0x305dc4710d20f235)},
+    0
+  },
+  {
+    {W(0x2d9a9938d0877d43), W(0xb56ab303d6c34c18), W(0xfa9337997672e545),
+     W(0x0cca9e59c48b0910)},
+    {W(0x8e0d4ef015af8987), W(0x81211e850e933cd0), W(0x743e035754c41858),
+     W(0x9a870a741bd6c3ae)},
+    0
+  },
+  {
+    {W(0x3ff11fc8d7d05f7c), W(0xff531a550935dc63), W(0x8cff2aefd8e79592),
+     W(0xc5fd9f9198332c67)},
+    {W(0x2b9e7cb5a2e37a41), W(0xb5e1dd9c7315f7b4), W(0x60b288a35b4025af),
+     W(0x3f0d76f9a3ff82f4)},
+    0
+  },
+  {
+    {W(0x77825ab9cfbd9c67), W(0xfdb0d5f9e2e10b9d), W(0x6f5cf120cc51096a),
+     W(0xe12dc8a02a0d15f6)},
+    {W(0xff5485be25af29ef), W(0x1235c0f94428218b), W(0x2e6f1f13849f685b),
+     W(0x13cb98d4d8060bf8)},
+    0
+  },
+  {
+    {W(0xc0fbbdebf0c14b7b), W(0x4aeccf5ce25306ac), W(0xfbab8c6a6abc3d3c),
+     W(0x53d1d5f96d944ca4)},
+    {W(0x42c933d6b745648e), W(0x7514fd327b789083), W(0x8514efa574d2b55b),
+     W(0x2cf975d01c278d67)},
+    0
+  },
+  {
+    {W(0xbe29ccc38c8f7112), W(0xcb35d020944742ec), W(0xf8b0dbed4e59c93b),
+     W(0xad336cfb3f425160)},
+    {W(0x4f71720020c55bb9), W(0x51490df50d1819c5), W(0xa99562cc2d2f0853),
+     W(0xd1f454d69c39b407)},
+    0
+  },
+  {
+    {W(0x6b4cfa949bd9d900), W(0x313678783c636d36), W(0x33ae16a32fe00b06),
+     W(0xe31c876c46dfcbf3)},
+    {W(0x8afd53a8f0ceaf1e), W(0x49964e26af9944b0), W(0x243c5ca66e814009),
+     W(0x86f940369b0d4fe7)},
+    0
+  },
+  {
+    {W(0x689ff7c2835adf82), W(0xd0471ffc31e87ea1), W(0x5e77adefafb1dd57),
+     W(0x2600ed155bb38ca1)},
+    {W(0x1776baad1a4a569c), W(0x1110c05cdb1c21db), W(0x50ce4694e5ca0d55),
+     W(0x1668f0cecccf8cc4)},
+    0
+  },
+  {
+    {W(0x059d030fc7738393), W(0xd944bfe34f8bde24), W(0x9e21de1d74ad790a),
+     W(0xbf1894ee235cf5b8)},
+    {W(0xb62f888fe1f0cc34), W(0x85dd20d0316d3b0f), W(0x93026ce9cba59c1c),
+     W(0xc207dcf3834d83cb)},
+    0
+  },
+  {
+    {W(0x175f7186cc306c59), W(0x92235fe2eae8e0d6), W(0xde783badf7acdb8b),
+     W(0x227f6725aed63cda)},
+    {W(0xbe0ed0f0611281b9), W(0x74c12688e73f3926), W(0x73ee3a2038fa0d37),
+     W(0x83ee3d572788e6a7)},
+    0
+  },
+  {
+    {W(0xa8db0c4514d9fa24), W(0x403ae66a5d5f93e7), W(0xaf06d5bcf7afb89f),
+     W(0x4947ceebd204f704)},
+    {W(0x04f2e9da86ec9fbb), W(0x39b40bf015272374), W(0x89bc5759cd91245a),
+     W(0x6d75dfaa65d4cb48)},
+    0
+  },
+  {
+    {W(0x509c18dd5316d90f), W(0x657cf09354a3497d), W(0xf90d4c0b91559074),
+     W(0x11e9844eb51bfc86)},
+    {W(0x12115f071f0cb4c3), W(0x9ca5541fa17917c6), W(0x41d720333c294b35),
+     W(0x486b361b3f6cbdc9)},
+    0
+  },
+  {
+    {W(0xa6b5529a870bb3d7), W(0x8075448dad79aecb), W(0xfd45d84768907f89),
+     W(0xc90ba0b14dbfe48b)},
+    {W(0xbb0fa12a36f67a4a), W(0xb9c4c6a07dbe4a04), W(0x07eeec28d5e04748),
+     W(0x54e4addff7d98e63)},
+    0
+  },
+  {
+    {W(0xce3762962ef6750a), W(0x22ebf5abedeca5d7), W(0x5e37f21e96cc32c2),
+     W(0xd995d4558b3737b8)},
+    {W(0x33532df0564be340), W(0xc2f34f4b8741055e), W(0xe71f81415bd21f46),
+     W(0x0de446a6579fb9e3)},
+    0
+  },
+  {
+    {W(0x13bffb08e585afb3), W(0x255eebb135c9292e), W(0x95fd129ac19ac40f),
+     W(0x43155586015bbf7c)},
+    {W(0x181ee7ec2ac7d773), W(0xc660e5cb9e743936), W(0x95233d5573c0b8bf),
+     W(0x35584a8ab3070150)},
+    0
+  },
+  {
+    {W(0x3339afac56d1944c), W(0xb609d54d1ab55fb2), W(0x0dd96f702905d2b4),
+     W(0x2319acc3142e3f88)},
+    {W(0xa7b70bbacea33da0), W(0xe9ec5da508223bc0), W(0x9e2dcbf0c51e01e5),
+     W(0x653c8903ad566ca2)},
+    0
+  },
+  {
+    {W(0x51934d11a58ee4ef), W(0xecf5aa4ed1b73c76), W(0xa8fed271a4297220),
+     W(0x62e354e8ba03ba6a)},
+    {W(0x59e2a8947609c5e5), W(0x8e3c6225f7266eca), W(0x499a4036ab333acd),
+     W(0xd051386699accab5)},
+    0
+  },
+  {
+    {W(0xacbbe2754ee39daa), W(0x7523bbef020a73c2), W(0xc58b9613dc358025),
+     W(0xd902dab4df411a4b)},
+    {W(0xee27c0db3b5d88b8), W(0xe1819ec6e3b50702), W(0x23d9f67af7307eda),
+     W(0x1559f23fbf412ff2)},
+    0
+  },
+  {
+    {W(0xefcdc2fc361de3c1), W(0xcbe12b592d290340), W(0x2a5559f4897f99f5),
+     W(0xeaddee436162d4f2)},
+    {W(0x5e325f9cb8a2e7a4), W(0x97ff2336ac930b5b), W(0xeab744a7a35de938),
+     W(0x8253824688de23f9)},
+    0
+  },
+  {
+    {W(0x4e72c2fd3000aeff), W(0x4e2ba9e26abcbba3), W(0x61064a6d4023abd4),
+     W(0xa6bdf4920279075c)},
+    {W(0x4f82d76f4e2e4fac), W(0x39b5a1308b2abc25), W(0x2512eed9a4b7a406),
+     W(0x228a5fd52da2a972)},
+    0
+  },
+  {
+    {W(0x1065ba29e5488267), W(0x1be775a2819162ce), W(0xe1006257b18fa532),
+     W(0xd473d7d37c7a6438)},
+    {W(0x51a6afd750e24f62), W(0xdf867634994da52b), W(0xd38af69814aab079),
+     W(0x639970aa162b964e)},
+    0
+  },
+  {
+    {W(0x33ddfd91b425f04d), W(0xc675ec3a4eee87bc), W(0x31694f8c1961eb93),
+     W(0x886d0b90aef863cd)},
+    {W(0xb04585cbdfd1a19d), W(0xfed7895798bc9de3), W(0x3ca2ef99ca9a1ae0),
+     W(0x34e70cd79f973f93)},
+    0
+  },
+  {
+    {W(0xa05e84eb3bef3e95), W(0xe962ff5238b773b3), W(0x36020e1ccd0846f9),
+     W(0xfd3840b84b72291a)},
+    {W(0x4ee9ad673d7e5dbf), W(0x84397bffb167ef70), W(0x36ba6661b20d4d18),
+     W(0x4760c8b2c95e1a2f)},
+    0
+  },
+  {
+    {W(0x854b917d73f066b2), W(0x8c013d59b7307362), W(0x1e6f696ddf1c4378),
+     W(0x70e49400ae55ea29)},
+    {W(0xd8ff807cbdb79040), W(0xe117fb4554e9b191), W(0x19e0497096a5383d),
+     W(0xb366056dce8f6247)},
+    0
+  },
+  {
+    {W(0x6268682da50a5f06), W(0x5bb96ebb81fc6972), W(0x1262bf73306b52bc),
+     W(0xe7c60ec034b6f9f0)},
+    {W(0xe560f0d7eae01238), W(0xc61c75abac8aaaa7), W(0xf3f1fbc3ecbc6c9b),
+     W(0x0b9beff77234c967)},
+    0
+  },
+  {
+    {W(0x21adb1484a717fba), W(0xbbd1e75d1cd88f48), W(0x18a625e7aa7a6f75),
+     W(0xcb517a2c5e4a3898)},
+    {W(0x9cee3ef2a810b103), W(0xfa243393b4e007ff), W(0x6ad213a6e9f01a7e),
+     W(0x99ae81545157c8e9)},
+    0
+  },
+  {
+    {W(0x83966c89da1f3d07), W(0x4c62502bb34bfe2f), W(0xbbe3b8654b03e7a5),
+     W(0x8192b5c03b94ef46)},
+    {W(0x9b83a6c971956d91), W(0x1a95e455ca840e15), W(0x175c5430fce1e05e),
+     W(0x4c9dfcedd2840448)},
+    0
+  },
+  {
+    {W(0x3e6cb38eef7302a9), W(0x3a5e4877a82dcc87), W(0xc537d06d95462f68),
+     W(0xea065aa19cd6c5fd)},
+    {W(0x2dcd29f0246a015f), W(0x0ae7ffa6b1a8755c), W(0x447a4f010bd4adf4),
+     W(0xdf478b27148144d4)},
+    0
+  },
+  {
+    {W(0x416801d0d6ab6394), W(0xee2be9217980a275), W(0x3b22b418cae7009a),
+     W(0xd38d82f867413d70)},
+    {W(0x98bcd4482984c794), W(0xbd16460b33843053), W(0x2bea650c1288e163),
+     W(0x45bd269a6db487c1)},
+    0
+  },
+  {
+    {W(0x875f1ed4190eb071), W(0x1936517ecc37259a), W(0xb4d063d00c1fdd02),
+     W(0xfde42479c5b9dd70)},
+    {W(0x99c3637faf8403e3), W(0x8452747ec07cd398), W(0x038dd1e3ed749d87),
+     W(0x8cd7a921bf142893)},
+    0
+  },
+  {
+    {W(0x4b4dcf7884987014), W(0x097a18611be66465), W(0x2dc3481ee75c230f),
+     W(0x08b4586ef5e619de)},
+    {W(0x99b898d7f4cb8548), W(0xae6b72f2cbd2339b), W(0xa2494f41f794f8e7),
+     W(0xdb02234ee0e3f1bc)},
+    0
+  },
+  {
+    {W(0x8d4733c0b9f0e3fb), W(0x9eed3b92d522e64a), W(0x1f6b79ee7b23b193),
+     W(0xc9a300e42954b3bd)},
+    {W(0x99dd3dd45515e064), W(0x7be51b47de4a0a5c), W(0xe466e7bcdad04a48),
+     W(0xdeb94e9653c65952)},
+    0
+  },
+  {
+    {W(0x0962f3140c0e4d6d), W(0x475d2229a8d97cf9), W(0x477408dea5968560),
+     W(0xcd3517f585753afa)},
+    {W(0x5f6de71cf337b0c6), W(0x6bc071ba1adbfbe4), W(0xcb2d074d46f07328),
+     W(0x509347e6ce9be949)},
+    0
+  },
+  {
+    {W(0xfa55ee67139f7e2b), W(0x489a9d9dcc1aa7da), W(0x122417354e1720a8),
+     W(0xe3bd42801d4062d7)},
+    {W(0x744ca5cdc2e8f2fa), W(0xbaeb6c219ab75a6b), W(0x1aa47c1d27f37daf),
+     W(0x47093c671a341028)},
+    0
+  },
+  {
+    {W(0x3378998db04bdd27), W(0x8855f1ea7ace7eeb), W(0x4e57380dd5b7eba8),
+     W(0x9848676d2df5edb4)},
+    {W(0xa98a6bef32ea24b1), W(0x5658692db9a7a05f), W(0x6da7a4157d70a080),
+     W(0x2d573c7d7470113f)},
+    0
+  },
+  {
+    {W(0x15d40821652b34c2), W(0x9e40d502b87058ad), W(0x64bf2524eb9d8322),
+     W(0xd419fa6c7091317f)},
+    {W(0xb60715e4f26db958), W(0xddc47d010b2bb40a), W(0x96972392ef79f54c),
+     W(0x5702bcb10c56de9e)},
+    0
+  },
+  {
+    {W(0x2953496854ff9d80), W(0x9e647438970a5a66), W(0x1d55dbd5b411d6cf),
+     W(0xe5a3be1dce3add08)},
+    {W(0x2cd6765d3d330ed6), W(0xb0eeaeacd4cde983), W(0x1927869e25a27c41),
+     W(0xde44d3555acd0ede)},
+    0
+  },
+  {
+    {W(0xfeefaa3ee9c3de5d), W(0x4721332fc62308f8), W(0x56bd7b477f1a96a5),
+     W(0xc2df1e2b46c26acb)},
+    {W(0x69e47466e6e7bfeb), W(0x378fc827418a2c53), W(0xfac7c8d4077b9f80),
+     W(0x210d788d4e2db54d)},
+    0
+  },
+  {
+    {W(0xb7fa4c85787c293b), W(0x295dff01f0d0df69), W(0xe21b9c1d9616f668),
+     W(0xf75cbe7e461476ab)},
+    {W(0x76e2e548026bbda9), W(0x01fc3e1c6ef9a36f), W(0x5b42d24b3285eb7b),
+     W(0xad26f3393c224bb9)},
+    0
+  },
+  {
+    {W(0x40d70c6b66966790), W(0x3236f679e3bca2a8), W(0x03d82a8d9a0d9669),
+     W(0x11217c48222ffc70)},
+    {W(0x1645f31a81f4da5f), W(0xe37803d7f9f5764a), W(0xfb116d7d24543932),
+     W(0x95891a88825aaae2)},
+    0
+  },
+  {
+    {W(0x2ebf8aeb9e238006), W(0x147cef63b5c06f37), W(0x64d28b3179f88c3a),
+     W(0x827a8f594427c13a)},
+    {W(0x44f9f8f77930c336), W(0x188c38f09d2a5677), W(0x5d9b5053a37118e8),
+     W(0x093e316a2e37788a)},
+    0
+  },
+  {
+    {W(0x7d45e6c348857345), W(0x95d5e6e50d452751), W(0x51392704b1192754),
+     W(0xc97df53e273470af)},
+    {W(0x57c041b42f685410), W(0xba6d09fa09b2e7b5), W(0x77348bef6e739120),
+     W(0xaf11f0e1c01f7066)},
+    0
+  },
+  {
+    {W(0x01d903ad92f168f6), W(0x9f4bc9266361ef6f), W(0x10c1b0365e37a3bf),
+     W(0x08b886461dd0a447)},
+    {W(0x21d29322bf6ce22b), W(0x050585a36386648c), W(0xc6337e433bb0e856),
+     W(0xf4e82f14de1e6f57)},
+    0
+  },
+  {
+    {W(0xb5e5e54217e451e6), W(0xebc6305bab9c8568), W(0xfa16117f26c9305b),
+     W(0x5ffc711b776cf28b)},
+    {W(0x7483a805bc754a40), W(0x347f51343277caf5), W(0xc48dba25dd399ec8),
+     W(0x21808a83f745b61a)},
+    0
+  },
+  {
+    {W(0xf19e7913f3487516), W(0x0dca5995417a3f27), W(0xfcc637dd822272bc),
+     W(0x1ccb672c7bbd0703)},
+    {W(0x5549c2a207e94581), W(0xd8f7a491cb3f61b1), W(0xb87f39c034a7b7d8),
+     W(0x2b333ff9a4a1bdfc)},
+    0
+  },
+  {
+    {W(0x15daa149d00c23ba), W(0xb5f6299b8dd6be90), W(0x295779d9e87f199b),
+     W(0x5dae413ababe60ce)},
+    {W(0x2a3446587cb7073f), W(0xdbf02172133baec7), W(0xf5d470976d462a47),
+     W(0x07ca2c79feae5a28)},
+    0
+  },
+  {
+    {W(0xe381f1572dcddc48), W(0xea74f7e4aed12d5d), W(0xd8ef456d695536ce),
+     W(0x840f139f871e4549)},
+    {W(0x9cac75dda4d99cf9), W(0xcb5ba1cef173a243), W(0x6e5e57f7efce8ee3),
+     W(0xabed41ece903aec8)},
+    0
+  },
+  {
+    {W(0x338e0ab43df5c34c), W(0xccdb4e12180d64c0), W(0x11e691d10858a5e9),
+     W(0xf43200b3c6176c9a)},
+    {W(0x83731fb18e485894), W(0xbb3ba3da8a0c8d9a), W(0xe282f2a753feeab5),
+     W(0xe660b4ce92695d5c)},
+    0
+  },
+  {
+    {W(0x69ec7eb0aad4894f), W(0xb356b560c8294be1), W(0xcf2fdcbb95d82e28),
+     W(0x837623d69e85ab2d)},
+    {W(0xe52736958f693c7b), W(0x7ce316741c102c5a), W(0xcb73291da640a8b2),
+     W(0xfa4f11b3130ebef1)},
+    0
+  },
+  {
+    {W(0xe20e99bb64ba0f3f), W(0x05c277dcf48d172d), W(0x4d513fe2d3faad6d),
+     W(0x765e6e2858835298)},
+    {W(0x603a0995fdc7e5df), W(0xd68119bd8918e963), W(0x40c9a2fc6ac54a10),
+     W(0x7e6f2f825578fe13)},
+    0
+  },
+  {
+    {W(0xc45536492ee70cd2), W(0xe555839b6920e650), W(0x7b441f4eb0ed70cf),
+     W(0x4dd930197c2c4a28)},
+    {W(0x09f12eb38d84e6ae), W(0x433fb2acededd829), W(0xddd276a73cc6930b),
+     W(0x444d4c524dda3d78)},
+    0
+  },
+  {
+    {W(0x9220e0f1c2f212ab), W(0xf1c6a6a5d1aac669), W(0x5241174078e5eaf0),
+     W(0xda1d42a743034a26)},
+    {W(0x3953024cb8dedc57), W(0xe74c6a12ff9975d2), W(0x16c0c081504a576a),
+     W(0xfc43aa49a77557fb)},
+    0
+  },
+  {
+    {W(0x297e3ac974fa376b), W(0x5864c13f553c745b), W(0x0075cb605d8021a7),
+     W(0x398124cb708dd2e3)},
+    {W(0x009acffe3bce8f48), W(0xb97dbdabf0311afd), W(0x5318d1c04f375085),
+     W(0xadadb7c5a492829d)},
+    0
+  },
+  {
+    {W(0x4c77bb4bc26e6659), W(0xe74d10ec1bba62ae), W(0x5cc063ef7c441877),
+     W(0x95ce1ebc9e1309d6)},
+    {W(0x142ab847924ade8b), W(0xc7fbb28f8e9c6340), W(0x24e491e45a0481ec),
+     W(0xca8168d64eebb4e7)},
+    0
+  },
+  {
+    {W(0xee559b3b2d45d402), W(0x231dfdedf91c411c), W(0x87796ceb9d4e59d5),
+     W(0x98286255f3a2d3de)},
+    {W(0x561d79f31f785a3f), W(0x6a8dee621a7ca0fa), W(0x90524357eada9f69),
+     W(0x26e7d8b0fee8929b)},
+    0
+  },
+  {
+    {W(0x2d68559462c66df3), W(0x2432ab89592cdac6), W(0x3357f97ae99fe594),
+     W(0x620d7f6efdce240e)},
+    {W(0x467b7a802f9752cc), W(0xd7d94236f9a7e26c), W(0x6180120785a2f725),
+     W(0x21dd69473085cdc6)},
+    0
+  },
+  {
+    {W(0x2bf661f77a343016), W(0xb3589ead28578959), W(0xcb20fa41596d5756),
+     W(0x50092cc15c0272d6)},
+    {W(0x531e0ace183ef78a), W(0x7ac6da33661c2c23), W(0xe7a0b7f5547fc60f),
+     W(0x588f404e3a574094)},
+    0
+  },
+  {
+    {W(0x895dc228437ac4ce), W(0xc4ced04be683f766), W(0x3036244f79c4d91a),
+     W(0x5b06f6bcd585cdc6)},
+    {W(0x8cc5ad56bf9531af), W(0xf5f7af375dfb04ec), W(0xa7ab03a16683b331),
+     W(0xd4de4fbe4464acbe)},
+    0
+  },
+  {
+    {W(0x35949a178ba01dc2), W(0x9534e523eaee2837), W(0x871c25be116233a2),
+     W(0x2ab3ac8eb7581cb0)},
+    {W(0x029d37810de76621), W(0xf422d40e1eff7c68), W(0xd6574154792e0c7e),
+     W(0x2d2af9562af4d500)},
+    0
+  },
+  {
+    {W(0x3a47404f3e197ee1), W(0x283c04a6b6cc8bcd), W(0x25fe698b6c1d1af6),
+     W(0x410e09947bf15d8a)},
+    {W(0xd5c0c030de27d88d), W(0x893f8419e4bae97a), W(0xdaf5ea2d29d4313e),
+     W(0x79613f89b399969d)},
+    0
+  },
+  {
+    {W(0xc42a589f7bfab7bd), W(0xd85f89e096c36567), W(0xa8cc48f26fc4e28e),
+     W(0x0f4d2cd1797bec9e)},
+    {W(0xd7c87970371d9009), W(0x535504f25275d516), W(0xdf9ae796e320a0a5),
+     W(0x69f1f3e595d538df)},
+    0
+  },
+  {
+    {W(0xcaed2e4f91a9ca41), W(0xd482f5ca7f6cf4e5), W(0x009d26e041e4c18c),
+     W(0xa7ae8f5a5169900e)},
+    {W(0x786b897351464f70), W(0x537471162959a414), W(0x7501c61f0bc67137),
+     W(0xdd0bf2dabe426f31)},
+    0
+  },
+  {
+    {W(0x12d49aa8ed4784bc), W(0x458c47a1f4b12b0a), W(0x16e4b3e1fad011ec),
+     W(0x3417cac0fce44383)},
+    {W(0xcc335265a45e6c59), W(0x12fead23bcbff8ba), W(0xe4d5805c974e1e2b),
+     W(0x038b2af61b37ebaa)},
+    0
+  },
+  {
+    {W(0x7714bc87c9a16ca8), W(0x9fd1c6ef40580942), W(0x3b0c1c3ca6009279),
+     W(0xd489772ad99697de)},
+    {W(0xa7406a12ad27733f), W(0xe7b891417dc996a5), W(0x581839aa7a78b8ee),
+     W(0x380a0a44e119bf71)},
+    0
+  },
+  {
+    {W(0xdb3b864bd2e1be7d), W(0x9795d4e4a1979dd0), W(0x7922f5a2472771ce),
+     W(0x1b7deee0e71b4730)},
+    {W(0x2072700098c6ff44), W(0xb6affd4423607f96), W(0xfa1c686c5866e7bc),
+     W(0x9151a9c9d3ce04dd)},
+    0
+  },
+  {
+    {W(0xe6e80f26d48b87cb), W(0xf68992ff07c5207e), W(0xbec7865f0177e726),
+     W(0x00ef9945a37fed12)},
+    {W(0x1da2b6e2e52cde66), W(0x8c6663808d78b8f1), W(0xc82e6a638e1650ff),
+     W(0x531b5cd7ea2bda97)},
+    0
+  },
+  {
+    {W(0xc6f3777b3ff51610), W(0xb9daeb84e2eaa076), W(0x556bcaa487f90189),
+     W(0xffb72dd118aa336d)},
+    {W(0x1777345408f64b04), W(0xf8d36b9b4ce2b4a9), W(0x092f453dea2214af),
+     W(0x084b459b774cdc65)},
+    0
+  },
+  {
+    {W(0x3d60e51a68143104), W(0xf6ca58d6cb032074), W(0xb97a0fb377a0968f),
+     W(0x202ac46b4646e87f)},
+    {W(0x38d254330bded4d9), W(0xf4af7eb2191dc7ae), W(0xa09f50b4991a0ddd),
+     W(0x8f2891fe93e4ae08)},
+    0
+  },
+  {
+    {W(0x444e5325a929d61f), W(0x1220d053549d6c97), W(0x268b6e840a4fe9e4),
+     W(0x70a1ad22d41c1cd0)},
+    {W(0x76afbc15e34e3515), W(0x59eb1f6431d94b49), W(0x45a65d69797a66e9),
+     W(0x6452a414dbcfc8c7)},
+    0
+  },
+  {
+    {W(0x747152092cec9ab3), W(0x68814d2b024061e7), W(0x9c068b1a2b0784e3),
+     W(0x0fb8e563a3e503fc)},
+    {W(0x64051b2e588eef7c), W(0x1999960cdeeb5eb3), W(0x28b3be870763a67e),
+     W(0x532c0e14e03eb778)},
+    0
+  },
+  {
+    {W(0xf2a3a9a2c4be294d), W(0x3e1a43f0ec6c35ce), W(0x28bb090afd265a88),
+     W(0xfc0ebefa570f2e4d)},
+    {W(0xdc54aad239e4ec91), W(0xcc82dbef6c78da98), W(0x30d9d2ce092d1f9b),
+     W(0xfad58933da2b788a)},
+    0
+  },
+  {
+    {W(0x5c9b8117a9840735), W(0xf63c2264b1f25b0f), W(0x023028d63383f95c),
+     W(0xce578833da34215c)},
+    {W(0x7cd40e1bcbfb0232), W(0x86f3ea3faf10f82d), W(0xcd83abde18962f78),
+     W(0x6eb62294aea25857)},
+    0
+  },
+  {
+    {W(0x9b8198596829012f), W(0x080b1b920daddb4e), W(0x9690031fd774b28e),
+     W(0x3b1997f9151d5591)},
+    {W(0x0bab9d9b8ffabf20), W(0x594b029ce428bffa), W(0x1d0a2e038b4eeb79),
+     W(0x5b3625f403458781)},
+    0
+  },
+  {
+    {W(0xbb3c2db77f00699a), W(0xe57b576cb351a8c3), W(0xb2dcf33889bbaa99),
+     W(0x12fb011368168409)},
+    {W(0x88697f69bfecfbc0), W(0xa820cf00d62635c4), W(0x32b368962bf3a920),
+     W(0x1869b7965aa31b51)},
+    0
+  },
+  {
+    {W(0xb062b0b4cb98f799), W(0x3f71b138f60b177c), W(0x073f4c2fd08b4dfe),
+     W(0xe90aea557b9e9991)},
+    {W(0x80925b7d5192ea9c), W(0x5c642513dbda4331), W(0x858e1dfabf4acbd4),
+     W(0x35de10aede734df0)},
+    0
+  },
+  {
+    {W(0x9f19e4e313ad4919), W(0x1530984bcca59bcb), W(0xe8ee4c2f8b57258f),
+     W(0xc62a082efdc34662)},
+    {W(0x8a6f718922b433f8), W(0xa355938cab0405fc), W(0xe8d02790e32bedf3),
+     W(0x90a8936e610abf4a)},
+    0
+  },
+  {
+    {W(0xc6daec93fcd15c88), W(0x70290430704f50d6), W(0x41efe194ea06e497),
+     W(0xd490081105762680)},
+    {W(0x1c6e8743f3a2d400), W(0x926994e708faa0e2), W(0x8ee46a60907b6565),
+     W(0x2a662620d2c3b466)},
+    0
+  },
+  {
+    {W(0x74a00080fed83fa7), W(0x0939ffadb9e6d561), W(0x80887c6a8fcf3798),
+     W(0x7b48633e4af318ff)},
+    {W(0x7459037cfa2fead9), W(0x2a2d04f1f93a94ce), W(0x77219e280a8e6d55),
+     W(0x0057a7a9e2809dda)},
+    0
+  },
+  {
+    {W(0x48ee578663735dbc), W(0x43a2c1175f74955e), W(0x0118af6347a0029e),
+     W(0x58eb78de2a896e76)},
+    {W(0x6567e87a5d597497), W(0x274f7ca17e6c6075), W(0x58cf0b9af1b87ff1),
+     W(0x48a3659ba4e1071c)},
+    0
+  },
+  {
+    {W(0xdb4724ccf4391b36), W(0x43f890e9b6a05b02), W(0x7686eb910ab71d00),
+     W(0x28b218ef044fa501)},
+    {W(0x3d12fcbfe2e8c94b), W(0x091cfb78209af61d), W(0x3d9cde1849e74eb7),
+     W(0x58cbc3eb80adecf7)},
+    0
+  },
+  {
+    {W(0xa084c089cea76503), W(0x82e98081328786ee), W(0xf7c4f41760b7cdf7),
+     W(0xd880a99c2732fc8c)},
+    {W(0xc3bac2f2491c7c61), W(0xf08f764601373c28), W(0x17637adb1594f285),
+     W(0xf1fe51740c59b6ec)},
+    0
+  },
+  {
+    {W(0x97273fbb9dc1eae9), W(0xcd828930e28ff261), W(0xdfa989aba54798bc),
+     W(0xd28ebadd51c94db7)},
+    {W(0x87a687b638bb611b), W(0xa6fdf4bc42442ad0), W(0x5566fc674c9845a3),
+     W(0x0aa05b31996f2e13)},
+    0
+  },
+  {
+    {W(0x405236c8f357cb1f), W(0xf2be5ed0e1e6f01d), W(0xaadb02ad2eceaa1a),
+     W(0x7d770d37e85e3bea)},
+    {W(0x67bd15b3d6f7f175), W(0xe01fd11d039da758), W(0x9971fef0aba5304d),
+     W(0x0c1d95ef58d9f2f8)},
+    0
+  },
+  {
+    {W(0x7926616dfb5ed4ac), W(0xbc415e2e8beb13ef), W(0xc8d9bc3e479d533e),
+     W(0x4d0d191e15bc0596)},
+    {W(0x1f3a3c309be233f6), W(0x53eeb30eff143f28), W(0x7a90f975c06d8bad),
+     W(0xedab3a96ce8709f5)},
+    0
+  },
+  {
+    {W(0x1e0196d17dc4b226), W(0x2d8d658fc41c54c7), W(0xf7faa90143916ad4),
+     W(0x3e0e487a06642e97)},
+    {W(0xa71fac631a52740c), W(0x753bd8d0b51a477c), W(0xca0b682a8d7ec363),
+     W(0x16fca8690372ab76)},
+    0
+  },
+  {
+    {W(0xbe4850bb455138f3), W(0x78068614a47026d6), W(0x964e3d1c613f61e8),
+     W(0x028b127f1a95138b)},
+    {W(0xab68b595cdc2a9bd), W(0xa9e0b3e020a5ed51), W(0xc4ce0c4b51cdfde1),
+     W(0xe751e840892a56ed)},
+    0
+  },
+  {
+    {W(0x0b8436c2e69d9d12), W(0x23074710fe0933c0), W(0xaa6d07c1c8fb8f85),
+     W(0xbdc35518c8ba828c)},
+    {W(0x3905a33698267c6b), W(0x4c4aec1628bf1209), W(0xb09bc4ca3b28785c),
+     W(0xbc93803b89d34bcf)},
+    0
+  },
+  {
+    {W(0x212b9d9893f02dcd), W(0xc35024a8280f60c7), W(0xfcc4a42299231844),
+     W(0x347e991e7d65af99)},
+    {W(0x5069dc06e1ab87ab), W(0x1957e96296e6a8e0), W(0x32749ddfdbdb5ab3),
+     W(0x8c7f00092776885e)},
+    0
+  },
+  {
+    {W(0xf49b340821d4c597), W(0xe458ada1de98eabd), W(0x7f224aabd539388b),
+     W(0xb1b380b2414b33ed)},
+    {W(0xc66215a5a3862878), W(0xba3247cea1d04f33), W(0xfd08da75adca1786),
+     W(0x06f658cf75836cf4)},
+    0
+  },
+  {
+    {W(0x6e50a29ccd6e2348), W(0x3cecfb0419a5b6ee), W(0x868d4da695fa8f59),
+     W(0x3f6dc2cb605c279e)},
+    {W(0x4911ed3cd07fd39d), W(0x346f65f4958e7ec8), W(0xb78da2c140bb5cc1),
+     W(0xb6226fc00871ffed)},
+    0
+  },
+  {
+    {W(0xb38067ca21321fbf), W(0xfb61a83980a26d1b), W(0xb74a932c57580dff),
+     W(0xadf5d13cf2812ab8)},
+    {W(0x38f3e09cd08d78fb), W(0x295a2298bc6e2902), W(0x1463de5698e76416),
+     W(0xa5255a33c1a16c55)},
+    0
+  },
+  {
+    {W(0xba2956c456948acf), W(0x89b7303bcf5e2ad6), W(0xcb051501e2fdd71d),
+     W(0x07de30a50d4c74b5)},
+    {W(0x0ce473cca487d786), W(0x2eb793fb920a5181), W(0x864e88f9587110d0),
+     W(0xf744dafebe630831)},
+    0
+  },
+  {
+    {W(0xc8f0423184ca138f), W(0x3b75c73087779d63), W(0x31f1901b9db3f8d6),
+     W(0x39111d3c35814c16)},
+    {W(0x60d09769abaeacb2), W(0xecd2003b2de8ffbf), W(0xe4a0a60288185556),
+     W(0x796f64e7eacfaaf0)},
+    0
+  },
+  {
+    {W(0x40c24a43f9fdf657), W(0x082d592ddeedd06e), W(0x88a25354550b9e5e),
+     W(0x8434bc67bd53c588)},
+    {W(0xcfd331d34c3a7470), W(0x4fb3218a473241c9), W(0x8a0ef43031f88662),
+     W(0x3d98459ca4cfb743)},
+    0
+  },
+  {
+    {W(0x3be44c17da64e9b8), W(0xb4d71ea0a2c26965), W(0x708eb5412e58a5bb),
+     W(0x1eeec89f7cbd5433)},
+    {W(0xdc98836e58dadc5f), W(0xdb823d3793e7ec25), W(0x9a834f070d8cc3a9),
+     W(0xfdbebc7974519301)},
+    0
+  },
+  {
+    {W(0x2011b98736ef26a2), W(0xd9770344b585da3c), W(0x8ab007efea6c14f6),
+     W(0xab72ef824721e512)},
+    {W(0x72ba9b2b53480b3a), W(0x861341ced519aebb), W(0xcb09419644c109b6),
+     W(0x82e76b397913c3ef)},
+    0
+  },
+  {
+    {W(0xc7a4e62b54529997), W(0x2d95da2ae9a46965), W(0x6efa2f8f823e3312),
+     W(0x2f187a62b8264c50)},
+    {W(0x22a84e32a6da71dc), W(0x94a66871db7b38d3), W(0x967034f9ab0d72a1),
+     W(0x04426d81651eb70f)},
+    0
+  },
+  {
+    {W(0xe4e2ca6ee021c89c), W(0xf7665ee789f9f457), W(0xa63b2b2302393f47),
+     W(0xb2a3f3e8a3b8b59c)},
+    {W(0x11f68930b889d1a8), W(0x52a3fb4ad0d5ba2d), W(0x5db5b5f00304cc54),
+     W(0xd5892e25a8afc0bd)},
+    0
+  },
+  {
+    {W(0x5fc24431470b90d2), W(0x836f5775eeb99d24), W(0x3e4eb1fc0ea21460),
+     W(0x992a7e0e88da268d)},
+    {W(0x28be9de606de9f6e), W(0xa088ffa73d69c01d), W(0x2c03b245327c95bd),
+     W(0xe15d84ffdbc492c3)},
+    0
+  },
+  {
+    {W(0xf8847b7be8e39387), W(0x6da83fa149f30ad6), W(0x420ab6086495454b),
+     W(0xc4a7c31eeb07c778)},
+    {W(0x65d450283057fe8c), W(0x7d2759c8595947b6), W(0x2a4ab1396c6831bb),
+     W(0xd3789591f1f0885a)},
+    0
+  },
+  {
+    {W(0x4b2617490df77bda), W(0xe832648947490501), W(0xa84fccb57ea6cdfc),
+     W(0x65c6abbc39998846)},
+    {W(0x314f9014ec58e0ff), W(0x4d6ce750d979ada3), W(0x1e6d3b54d1086088),
+     W(0xd4e686b89d52f655)},
+    0
+  },
+  {
+    {W(0xc17773f2ee89607f), W(0x9db6721664ca9c18), W(0x0b0ceb2629293872),
+     W(0xc204c7f120ff784f)},
+    {W(0xf177c0095ff9d38d), W(0x567612ce2482d581), W(0x2a29775528255689),
+     W(0x07048277c77488cd)},
+    0
+  },
+  {
+    {W(0x4a6550144cacb675), W(0x23be2c27b3ac4336), W(0x1f8cd0db4870e971),
+     W(0x33ed79987954899d)},
+    {W(0x1dcf8428d6a1596f), W(0xd7ade87735369fda), W(0x95256d4b425dcafd),
+     W(0xc6ac34ca424fa1b9)},
+    0
+  },
+  {
+    {W(0xb5f0729b5dcc2b8d), W(0x9987bdeaf21269bf), W(0xb07ce138bd912699),
+     W(0xc50c9725325efb20)},
+    {W(0xf4f672b430f08b22), W(0x10ed24e796949b5c), W(0xb44395e5bf98f258),
+     W(0x4782bad17837c25d)},
+    0
+  },
+  {
+    {W(0x83ae3d6d063204d2), W(0xf547e9247ed61178), W(0xd0812b6ac042c80a),
+     W(0xfacf28f322bd1e01)},
+    {W(0x605f48fbe6adac2f), W(0x8460704e40f74444), W(0x45cef5608b4a7192),
+     W(0x7278ad0e10b9a139)},
+    0
+  },
+  {
+    {W(0xeedcaca2dc8cc9ed), W(0x8929d7d89c80a574), W(0x4c66477ad90ac0e9),
+     W(0x92555b75a614d913)},
+    {W(0x49732616a503e3f7), W(0x5c67c979fdfdb0bd), W(0x83481df395e36572),
+     W(0x2061906a4eda6984)},
+    0
+  },
+  {
+    {W(0x1ee3bb06382982f2), W(0x118ac484fcea7ada), W(0x8ca7182f2c11e10f),
+     W(0x505d979df402d516)},
+    {W(0xba3423ada76b0435), W(0xba475ef30eeb71a4), W(0xe7611d349293d997),
+     W(0xb7211fb8c8fee0de)},
+    0
+  },
+  {
+    {W(0x6d8d2fe21e550bef), W(0x5a8d51ccaf5e8dfb), W(0xfe7c382608382227),
+     W(0x858137d7a9b52ca0)},
+    {W(0xec0a66653ca682e6), W(0xf0ad98a8a5bd6e9e), W(0x3cbf80f6558d72bc),
+     W(0x103ea3345436f53c)},
+    0
+  },
+  {
+    {W(0xdf0505f91e61efa2), W(0xb73ac20a5dd85243), W(0x73474cf0e00e391e),
+     W(0x6feaab65bf218ce9)},
+    {W(0xd7d26f2bc3fca056), W(0xf846343844a575df), W(0x047577d2135c3934),
+     W(0xfa2e39019f1fa180)},
+    0
+  },
+  {
+    {W(0x6ddf7fafb8596d76), W(0x6ae289203d0b389c), W(0x2bf9346a62ef2ca6),
+     W(0xa59af83c4e4eb2c7)},
+    {W(0xe684f3871b699849), W(0x7fc71d9a6b8121ad), W(0x50ce6880b3afe6bf),
+     W(0x9b2b29dfcb8452a0)},
+    0
+  },
+  {
+    {W(0xbeec15bd2847799c), W(0x4e3baff0995d03ef), W(0x69b6b544f00d004e),
+     W(0x2cf2bee2d49b11e6)},
+    {W(0x6ed36ee944c15f5f), W(0x55918b735986ab2a), W(0x8573bf8ba6a73ec6),
+     W(0x7590a5a5b92b3477)},
+    0
+  },
+  {
+    {W(0xba5a4d567b7347fc), W(0x4242423b81a73226), W(0x10fc379eaf671bf7),
+     W(0x91421c1e655e8af8)},
+    {W(0x4ba1cf0c6d94f61e), W(0x28bb24809c297411), W(0x29fa592936726381),
+     W(0x0b2eb63e9544ca61)},
+    0
+  },
+  {
+    {W(0xf5db09266213ea0b), W(0xb73ef66c225524ce), W(0x489ee683baa044da),
+     W(0xc0ce3dd8c80ebe35)},
+    {W(0x2f966e94899041fe), W(0xc08c28550a8e016f), W(0xe09ecf2473e5a437),
+     W(0xe170475c9d877ad1)},
+    0
+  },
+  {
+    {W(0x699988a91caff731), W(0x2ab494c2822a2528), W(0xd098908eeedf2f08),
+     W(0x94c98a99e461d047)},
+    {W(0x3542b0facbc0270c), W(0xf206ded4386a0d45), W(0x49c629067ca9ccf4),
+     W(0xa69d1910713c92fd)},
+    0
+  },
+  {
+    {W(0x76fb56a9fb16504b), W(0xf4c2fd34a7294e8a), W(0x9e88ee5a1a6499da),
+     W(0x8377ff8d58ce9d58)},
+    {W(0x1ef99489b83801a4), W(0x0e23feffbafaede5), W(0x650e69cec5b08bd5),
+     W(0xfd947624cdf1853c)},
+    0
+  },
+  {
+    {W(0xac4b80f1c0fcafd6), W(0xa20cb0960e9c3edf), W(0x469d2029b1424566),
+     W(0xc8665af8b73b2751)},
+    {W(0x9a4a94c5a3131aea), W(0xdeb3dcadbced1664), W(0xd72d2e7f99f5a735),
+     W(0x610ccfe86831c614)},
+    0
+  },
+  {
+    {W(0x113dff995c802acc), W(0x64261550ffe4ac79), W(0x928b8c782a8a1f0d),
+     W(0x965f9a76c5a544f4)},
+    {W(0x64274c44bef2fa8a), W(0x43800c5edb165a57), W(0xa8a813ebefc74f2e),
+     W(0x213570bb1f2fb595)},
+    0
+  },
+  {
+    {W(0x2de5fa394593bdcd), W(0xe06f06b086966278), W(0xd12c9722399562e4),
+     W(0x80c351ea5ac7ec60)},
+    {W(0x6dc7e646643df50f), W(0xd5f5a80603a5c627), W(0x0d5d202253acc9dc),
+     W(0x69af3d5da5ec56da)},
+    0
+  },
+  {
+    {W(0xbc81d2d57ddde1c2), W(0xd59699663f1f4867), W(0xafca648c4c98b332),
+     W(0x992da78571c4af47)},
+    {W(0x1293e01ef60f9029), W(0x0646f5d1e0f31783), W(0xc32464afedba8936),
+     W(0x6d2ca1e03c9aa17e)},
+    0
+  },
+  {
+    {W(0x84db87292f9b62a1), W(0x8f37494ed4b52489), W(0x43525734e3c96a60),
+     W(0x02255f53a3d7d13e)},
+    {W(0xcce47fd4532f322b), W(0x23488020f5e8f430), W(0x97c33c0c721e7d64),
+     W(0x684f6b4ff18376cc)},
+    0
+  },
+  {
+    {W(0xde7cbae65d7c200b), W(0x228f813e30da3c3f), W(0x6574c9879775bb42),
+     W(0x06b25d4476d79611)},
+    {W(0xe1fa652b7c40633c), W(0xa9a38d666849fe18), W(0x88d13d3d04899855),
+     W(0x31e1de10c97513eb)},
+    0
+  },
+  {
+    {W(0xe804d34253876012), W(0x3a48830c6765880d), W(0x640eaf5562e62f51),
+     W(0x085c81dee396b9e6)},
+    {W(0x8cb80786b7b52067), W(0xad5611e7ef1bc3dc), W(0x113e6476bf08e648),
+     W(0x43f50c3acf69c964)},
+    0
+  },
+  {
+    {W(0x939f71be7f1b19db), W(0x453a97b431db947f), W(0x69f3979005be4f37),
+     W(0x1b86cb56e95105cb)},
+    {W(0x28365a1c25bc44c3), W(0x758a5d2a34cbf943), W(0x1edbc5462efb22f7),
+     W(0x6aeee71e07d0bfca)},
+    0
+  },
+  {
+    {W(0x13d5a880de5b0d87), W(0xa92a45e41b204789), W(0x29a77aae9af7e553),
+     W(0xf23747bb4e31b923)},
+    {W(0x9840e41d5e2a7f21), W(0xd29a97b81167c3c3), W(0xe2427aa265419be3),
+     W(0x831db3fe03400f00)},
+    0
+  },
+  {
+    {W(0x664c6af7583c78f9), W(0xa59f70d7628fda5f), W(0xd78cd52d400ee78b),
+     W(0x66599939c964729d)},
+    {W(0xebb26bad55c69f0f), W(0x8ce8811c2bb08fc9), W(0xf7e82b800d20a40e),
+     W(0x160dec3c1bc7598c)},
+    0
+  },
+  {
+    {W(0x922c5b286988a7fd), W(0x9e442f538abf039a), W(0xd4a0c067dcc86750),
+     W(0x3504adffa2de4ffc)},
+    {W(0xda6386e2a9980086), W(0xf9ed38971dad52ec), W(0x0d6a6784144991b8),
+     W(0xfc1b31fb0e2634d9)},
+    0
+  },
+  {
+    {W(0x85d1fa70eacc9506), W(0x4a078a15804ccbc4), W(0xa25b63917692394d),
+     W(0x64b423a326f52b73)},
+    {W(0x98fdf63208bda3bf), W(0x47c4bf98dbd4caa4), W(0xf1c5bc8dff67edf1),
+     W(0x1c20f26f0023bc93)},
+    0
+  },
+  {
+    {W(0x6d2a76c76f6a335c), W(0x43716cd8ab0b1e4a), W(0xfb3d00aa7b7a34fe),
+     W(0x76b3729e42643b87)},
+    {W(0x72207d4825a25e9c), W(0xcb3c4af4d4584503), W(0xf393d5881eda1e04),
+     W(0xd08120b46f57f196)},
+    0
+  },
+  {
+    {W(0x86d85ea7098e4243), W(0xbe5bd5bc5a43e490), W(0x31cc112ccf18566a),
+     W(0x51c94f1d4d09f223)},
+    {W(0x9cbf2ead0f45408a), W(0xf6bb3e8a032715a8), W(0x584fec33a2c50656),
+     W(0x244ac87531e5fdff)},
+    0
+  },
+  {
+    {W(0x7cb8898512dd8b03), W(0x26320179785e9378), W(0xab95dbf04dbb63bc),
+     W(0x43096b1cb12a7a23)},
+    {W(0x19c66ecac2132298), W(0xdc0f2fbe9ba13472), W(0x0535b54cf39a1a19),
+     W(0x5cba22c6ff0cff19)},
+    0
+  },
+  {
+    {W(0x9fcd29ef1de63273), W(0x5b465bb71a8a2285), W(0x742d2a2d37a26984),
+     W(0xd8a69d65d2f1bf59)},
+    {W(0x9b5ff6a8dad150f1), W(0x1893746fd87ac695), W(0x52f7fe0c10db5440),
+     W(0x12d724e69b69875a)},
+    0
+  },
+  {
+    {W(0x81e597c4644e6c62), W(0x4767f8e0f2b3113b), W(0xaf770a881e2b174b),
+     W(0x4c93fd7b9575501e)},
+    {W(0x0908dfb51bb73ae7), W(0x39bd7f4100f41ad8), W(0x3a6cd7148184e74f),
+     W(0x0bcaf390aa47b224)},
+    0
+  },
+  {
+    {W(0xa9eed4302f08f9c5), W(0x683a98470df4a1f8), W(0x26ab8a1df1f8b0c6),
+     W(0xe4bf59d215a687f7)},
+    {W(0x84eb46d88f6c031a), W(0x8a132e64bf83fa11), W(0x416f288ee9286fd9),
+     W(0x4c6c0ec4cbfaf53e)},
+    0
+  },
+  {
+    {W(0x2ad0c4aa9367b075), W(0x4df75345add53ed6), W(0x63b5d7ddcb5e5b67),
+     W(0x13bf81cb7d09268b)},
+    {W(0x43cee2c9b1368bec), W(0x7163a7d5be3bdbf5), W(0x8518996b6a9fdcdd),
+     W(0x8f10b6ba268ae7f8)},
+    0
+  },
+  {
+    {W(0x0d661a051f4ede04), W(0x0b303624b9ba2bc2), W(0xfa79b51563ba0232),
+     W(0xf8900b6404f8163d)},
+    {W(0x5d878ff2b737add0), W(0xac33fbfa28e53d09), W(0x15536b21919964a2),
+     W(0x83391b957f3cc7a3)},
+    0
+  },
+  {
+    {W(0x670b26b1fc842ec1), W(0x3dd8491011b90c1c), W(0xfe5595fbb3216ccc),
+     W(0x5087aaf1661b7911)},
+    {W(0xf4a81e778e203d65), W(0x9b41b2ac152165e8), W(0x7bff882acb571be7),
+     W(0xe4f26cbad7bb8212)},
+    0
+  },
+  {
+    {W(0x72bb7d9f0dd3af05), W(0x94ba71b4dd43d6e3), W(0xa991f464496f6fab),
+     W(0xc4cf7d2f620adb2f)},
+    {W(0xf1bc837c0d60965d), W(0xe4048795cae96c97), W(0xdfabc6ee231c5eaa),
+     W(0xdcbcd8dbf0200bd9)},
+    0
+  },
+  {
+    {W(0xddc81e36d1d01d82), W(0xa5e0c12f3323fbda), W(0x16b740820bea9c1d),
+     W(0xaa88588efbcaab7f)},
+    {W(0x7bfcd7c090acb00a), W(0xe50f04363ad74bbd), W(0xbe951b89093ce419),
+     W(0x96d67063b2fcf816)},
+    0
+  },
+  {
+    {W(0xbba9c02b6f992e87), W(0xbc6548e6fe6a7f13), W(0xac26f343d0a56a5c),
+     W(0x4aee16a538834ad8)},
+    {W(0x6f936d714586d124), W(0x0113d01aafe3d24f), W(0xdc12a9037dc15700),
+     W(0x6b85472cb84338a2)},
+    0
+  },
+  {
+    {W(0xb2d76adec0110d82), W(0x15ff964a323d6e11), W(0x448e887efdc5447a),
+     W(0xe7e9913502e1cd89)},
+    {W(0xcad5fe1dcde29027), W(0xa92e49255a2e335a), W(0xf04b84c9848c4116),
+     W(0xbea03723602fc631)},
+    0
+  },
+  {
+    {W(0xd2c15a9016fb1501), W(0x041544d314180b5b), W(0xdffca4ca06a8a188),
+     W(0x7d20684f47c9bb36)},
+    {W(0x76f0f983726ad5af), W(0x90b03ee2623846ee), W(0x18a46591433d397d),
+     W(0xef49a5720d6da99a)},
+    0
+  },
+  {
+    {W(0xc58b5fcf6682fdcd), W(0xeace3327769231d9), W(0x5bebfb80839a5656),
+     W(0x4e6d911523e685a5)},
+    {W(0x014161548e9d290a), W(0xa2501ce1e5764a95), W(0x800bfa4414f0129c),
+     W(0xaa3bc4ec35e1da3a)},
+    0
+  },
+  {
+    {W(0x76013e6e65ef8b03), W(0x94a358f5d7d33d85), W(0x7d5861cb3f66980c),
+     W(0xc1a56a86e3963c43)},
+    {W(0x1a8139cfccc1ce03), W(0x7a60fe0f858e37ec), W(0x82841b0785ed7709),
+     W(0xa3ee2fabc0020918)},
+    0
+  },
+  {
+    {W(0x0884f49f78168ccf), W(0x89e80222b44f2d38), W(0xbd493cc1efc043c4),
+     W(0x8625216bdd83cc0c)},
+    {W(0xf21a523a1b0e70dd), W(0xa50d1a23d1269139), W(0x252bfcfb042570cf),
+     W(0x234bedb7e2894417)},
+    0
+  },
+  {
+    {W(0x1b6923ba8fb1a9ec), W(0x6516e09c41b47c45), W(0x5dfc805182a4593e),
+     W(0x0581631322048520)},
+    {W(0xfd68e2feb23c4f80), W(0x3479424f4f9b83e5), W(0x76f25cf14d6ac824),
+     W(0xcd586628b7524b8d)},
+    0
+  },
+  {
+    {W(0xa1c367157df7052e), W(0x2d2bc4e87e1d79cd), W(0x3e2aa93fe2647e9b),
+     W(0x54d0eba7b8e4a99b)},
+    {W(0xae14dfd1c80ffbfd), W(0x3c8ebdae25f2ddd3), W(0xa94db66501ca601d),
+     W(0xe61c7a87f3ab60de)},
+    0
+  },
+  {
+    {W(0xad2595983613598b), W(0x28de65fad6fd93d6), W(0xbee03a728d409a39),
+     W(0x3ab9825d541543c5)},
+    {W(0xf2351390d8a453f1), W(0x7a739bb4152b1948), W(0x6783e76a332da6c8),
+     W(0x44eb14e0ebc27eee)},
+    0
+  },
+  {
+    {W(0x9fcac0dfdc7cd11c), W(0x29d7af12a3c02ff8), W(0xd8eb8142976a886b),
+     W(0x2b9bf7170d123887)},
+    {W(0x185fab2b37c4b585), W(0x18fde172eb852a0c), W(0xb585c23c6c36c771),
+     W(0x1f75bbb0b20a93b5)},
+    0
+  },
+  {
+    {W(0xd64d008928302717), W(0x8fdebb9cbe1c3aaa), W(0xa169a4ce2515666e),
+     W(0x4c0ac5059aaa6761)},
+    {W(0x73e2a165e0827413), W(0xdaa2e5fe51023bb6), W(0x30aeb3160f5f8914),
+     W(0xb40257bc2ef01e8d)},
+    0
+  },
+  {
+    {W(0xab05b609daaf0e54), W(0xaf4d8ea745f9a515), W(0x4d58636428c4e4a2),
+     W(0x03a8a16b8c3eda6e)},
+    {W(0x35c4117f908d86e3), W(0xed3f402e1bdd8b9b), W(0x32a39fb619feb3e5),
+     W(0x2bdbd3d46d366518)},
+    0
+  },
+  {
+    {W(0x8a45671b2244a244), W(0xca955aa48e2ae95d), W(0x9281e33ee981d49f),
+     W(0x78bf276b74e5e8a6)},
+    {W(0xabe9c47684198c20), W(0x54122567754f5378), W(0x75598d36860c138a),
+     W(0xa453e89656972dd5)},
+    0
+  },
+  {
+    {W(0x2f39c5f6beee428c), W(0xa975aa7547137710), W(0xdbb7c3cc26de0675),
+     W(0xa14fab710f014ee5)},
+    {W(0x3dd38c2e95381e42), W(0x2be9f2962083e01b), W(0x59aff09f5bab393a),
+     W(0x2e5069297ebe626c)},
+    0
+  },
+  {
+    {W(0xa33c50761a57baed), W(0x85d81d956356ce2b), W(0x13eb6629e3fe033f),
+     W(0xd0e48e9e4fe83e1c)},
+    {W(0x1f6c9216098a8969), W(0x9f0ac8a7e5257fba), W(0xb96b3e1b4d6a4dc1),
+     W(0x935741801195854d)},
+    0
+  },
+  {
+    {W(0xbccb318272722af8), W(0x94407d6483dee009), W(0xb99bbace76ffdb1c),
+     W(0xc088e3c4d3c78877)},
+    {W(0x5143929b3f174c32), W(0x89e5d600fc1559f2), W(0xf4d9e0807ceddda8),
+     W(0xd4d0d9640e81d8b1)},
+    0
+  },
+  {
+    {W(0x55e56d7e34e2e85d), W(0x40aa0667a8ee2130), W(0x705ef64b4363b678),
+     W(0xc02618f2d250f09e)},
+    {W(0x14e1edf08e966e29), W(0x026317ee07529301), W(0xa961c867ff8bc92c),
+     W(0x411d9fa272d6f449)},
+    0
+  },
+  {
+    {W(0x30e9a81e9d953dac), W(0xbaf4a1338df219f5), W(0x9feea7ecdcc33eef),
+     W(0xa246096cc059a9cb)},
+    {W(0xbbce79727fa9dcb6), W(0xd3ba4be21076c1f1), W(0xe28e0e1296efff14),
+     W(0x0cd17e3798a5b399)},
+    0
+  },
+  {
+    {W(0x5a37c173f8f3fdac), W(0xeb0d3184289f8996), W(0x28f79e527ba2ccda),
+     W(0x674454ca8f384a26)},
+    {W(0xd4d0307843ab9eff), W(0xba8dccda050a4c05), W(0x6d5d382ce609252a),
+     W(0x041680d1bc6b7eb0)},
+    0
+  },
+  {
+    {W(0xc5081293efc8341c), W(0x3f79917dcada1282), W(0xaaefaab99a4de317),
+     W(0x2bf7802b8031608b)},
+    {W(0x07d034c7a6327400), W(0xb3da3184c1d2969a), W(0x9b762a5a029c84ac),
+     W(0xb56b2d0242ef1679)},
+    0
+  },
+  {
+    {W(0x9f644ee9a47f77e6), W(0x60583648209e12b0), W(0xad7276c84c1f9e91),
+     W(0x6afd05657244bb98)},
+    {W(0x6a892643a8607d43), W(0x284d389609087d05), W(0x5937e5a450b39037),
+     W(0x58acda3302c325df)},
+    0
+  },
+  {
+    {W(0x56f8a3c102b67d10), W(0xad522db9534bea3a), W(0x145164717c5c3ec7),
+     W(0x6bff0f12d6afca39)},
+    {W(0x98477c8b8945fc4d), W(0x497015e4c2ab085a), W(0xf643a4ba9644018f),
+     W(0x69fc22f148694e2b)},
+    0
+  },
+  {
+    {W(0x223c01a6e0551d86), W(0xa58444fe9462b393), W(0xadc571fe46e81eec),
+     W(0x43faf5d696528439)},
+    {W(0x66de9f42df217c6d), W(0x27d2f7aeacce9a5a), W(0xfa19a4c1d097cfe5),
+     W(0xd0225740fce3e9db)},
+    0
+  },
+  {
+    {W(0x858b6e2b3e2cfd35), W(0xa9b87c741b81bf93), W(0xdd68ba89fdeb4bae),
+     W(0x7676c7fa14dca971)},
+    {W(0x1b6cda5e9d98dab8), W(0x93c05001785e7b99), W(0x21fa5d28f024a6e6),
+     W(0x0d111cafa96bb3e4)},
+    0
+  },
+  {
+    {W(0x329c32553da5d257), W(0x600e2417dcce8655), W(0x2bb4313fc5c764c9),
+     W(0xbd14b00c884b2b13)},
+    {W(0x2803be1655ebce5e), W(0x515db89b7f63cc7a), W(0x21a0c7f9175ce5a4),
+     W(0x3c654efcfd001a46)},
+    0
+  },
+  {
+    {W(0x0e1da874f8791409), W(0x9848c48ab5a1d4b1), W(0x65955eb862207ef3),
+     W(0x687b196b0f2766f6)},
+    {W(0xc3457c2dab578c73), W(0x871d8fb007660001), W(0x3ca0039af86e9346),
+     W(0xd48c860bf60e7b2b)},
+    0
+  },
+  {
+    {W(0x37e89b0e6fd9befe), W(0xb0469cdc3e3147a0), W(0xdea0be9df8c0a854),
+     W(0xc03e72d0f70ed861)},
+    {W(0x11a4b08dca5d3f05), W(0xd2c4051b51480c88), W(0x7c1e366363bb8096),
+     W(0x3ca3f3143f4afc48)},
+    0
+  },
+  {
+    {W(0x096a8e78875d86d0), W(0x90490c7ccd4cdc1e), W(0x3d48f33d5faef1ae),
+     W(0x84ac3969fd090254)},
+    {W(0xc386f24d9e9cbc51), W(0x330bb85d870d6e11), W(0xa534d22092af07b0),
+     W(0x50573302f9f1e1a2)},
+    0
+  },
+  {
+    {W(0x6f261e038ee4f64c), W(0x1dea145620e178da), W(0x393821f737b9f13f),
+     W(0xcf053941dda07346)},
+    {W(0x43b2c73d8081da5a), W(0xf0d87c0952a1cbe2), W(0xb4ea6874d6cefd78),
+     W(0x5d15dda9001edc7b)},
+    0
+  },
+  {
+    {W(0xd810c1e91066bddc), W(0xbef017e7682575cf), W(0x026fb3c6ac17f83f),
+     W(0x895d7d9d7bb88f09)},
+    {W(0xeef072f7467fbd87), W(0x914d5a903e42f277), W(0x9add3cd875e6f73f),
+     W(0x0b8339d8ccb2f67a)},
+    0
+  },
+  {
+    {W(0xf239d54e30e5334a), W(0x8567d4b9b540adc0), W(0xd2632a2182524ddc),
+     W(0xc554d261c5bcecf9)},
+    {W(0x284eaee1d687da93), W(0x79be0a3bb63b67fd), W(0xa053def70d9279d1),
+     W(0x5903f240bad17c12)},
+    0
+  },
+  {
+    {W(0xc883d438c4c7c002), W(0xaaf4e2aeecc7bd96), W(0x77041d0eb89488cc),
+     W(0xd6ef3d1e9eece53b)},
+    {W(0xa2c547cd39ed16a6), W(0x20cd63e8c9c856fb), W(0xa70485f47c4b35aa),
+     W(0xebc9cce7ce38dac1)},
+    0
+  },
+  {
+    {W(0x10f2236d7e0fbf51), W(0x69ff7ea50c40025b), W(0xb96d34b25fb3b963),
+     W(0x60ebb0f7ffc1ec86)},
+    {W(0xfc5b4275045ba5db), W(0x85afc0e46fa9917e), W(0xf85e9616c08191b6),
+     W(0xdca9becbe65d7a06)},
+    0
+  },
+  {
+    {W(0xc868adcfc620feaa), W(0xff6525fa13d4df9b), W(0x427d6e2a16acd802),
+     W(0xcf126a77a9e4de10)},
+    {W(0xbba4f7fe93a2546d), W(0x25ba64f5fac1e125), W(0x3314e8c2b37ccc27),
+     W(0xb881aac90cd8e44d)},
+    0
+  },
+  {
+    {W(0x8f3268ef05758b60), W(0x4c59a505cc01f44d), W(0x488261ce95994590),
+     W(0x6404cbbe0c42c42c)},
+    {W(0x6f77b47ce12b54ce), W(0x134d52306287cd34), W(0xeff81a1f1e51127c),
+     W(0xbc6e9ecbb185064a)},
+    0
+  },
+  {
+    {W(0x9b0079e97dae9007), W(0xe7172fac1fd196c5), W(0x98f876fd7f7442d0),
+     W(0x934c56387ab5cbcb)},
+    {W(0xd32029feb5419513), W(0x4460643755894422), W(0x9a53a14509f89d07),
+     W(0x2ebc410c729e3b36)},
+    0
+  },
+  {
+    {W(0xe102ebd0008272be), W(0x327337894151dcb5), W(0xd4507753c95d7002),
+     W(0x4e27715845325e1d)},
+    {W(0xd74b2ea00366f855), W(0xe9afcecda84be71f), W(0x051c2c62f43d4224),
+     W(0xbfdd613672382da1)},
+    0
+  },
+  {
+    {W(0x5616bf7ec833af01), W(0x3b83626c163c162b), W(0xadee870203614132),
+     W(0xf0f1ba6506a40b83)},
+    {W(0x7fb743fff13e08b2), W(0xea3c02e9e37fe689), W(0x8bed1ebbd55d4f70),
+     W(0xfc621d97fd3c2907)},
+    0
+  },
+  {
+    {W(0x5c8005abd59b3b81), W(0xbc378f5744c56256), W(0x0b921fec58de6292),
+     W(0xb4eab2fb9ab6bcc8)},
+    {W(0x6f20893fb2641514), W(0xcf4eaaf5069cbef6), W(0x8ae6d138fe7da0f3),
+     W(0xbcb47f6d2cf78464)},
+    0
+  },
+  {
+    {W(0xa95ab1387e755e61), W(0x1766abb0304fc754), W(0x5f9d1f8eb93873d2),
+     W(0xcd0908b9d79ec303)},
+    {W(0x5ad495789aceebd8), W(0x52f49472ed64ac70), W(0x67af02cc52da9c13),
+     W(0xb977c1ac97f56731)},
+    0
+  },
+  {
+    {W(0xae398a3b29890d1a), W(0x7d475017f4430dad), W(0x6f64a98010671bd1),
+     W(0x33516b204285dcb6)},
+    {W(0x69c1c5989e0fc167), W(0x68a58dda5dea8f95), W(0xf0d2f42191ec97f2),
+     W(0x06cdb4fc0ea95a7c)},
+    0
+  },
+  {
+    {W(0x9e13a4f8668c77ee), W(0xa3601fcf15bfe30f), W(0xe3815f8e2b185277),
+     W(0xf9f19e99e3a8782b)},
+    {W(0x1c01b9edfff7c347), W(0xf432ba2fac3e7355), W(0xe43194650c56f24a),
+     W(0xdc7ef91711d26c6d)},
+    0
+  },
+  {
+    {W(0xf50472bcd662120c), W(0x739866318f0e19b2), W(0x7887776e856ad008),
+     W(0x6e64a8c323557fea)},
+    {W(0x73184c162147ae74), W(0x4946bf502d79c594), W(0x2a2e3273fe374154),
+     W(0x2dd044d9b7f93f1d)},
+    0
+  },
+  {
+    {W(0xfee688862e1e8646), W(0x76fb39287a5f6dd3), W(0x68ca5892c4ea0c75),
+     W(0xd46d8e9122b1dfd0)},
+    {W(0x81f931affa174637), W(0xe72a30726429ef69), W(0xf90c0131508ec9da),
+     W(0xc01e08f40d91e632)},
+    0
+  },
+  {
+    {W(0xf70e78df576b8ad3), W(0xce6755781d44c6bb), W(0x91a1738ecd373f0d),
+     W(0xafbaccd55696d24e)},
+    {W(0xc1c5d274e2d7abbf), W(0x1c58331526ecdcf7), W(0xfc193ae2ead42f0b),
+     W(0xc39aea054ac3b7d6)},
+    0
+  },
+  {
+    {W(0xe6681f52c8962117), W(0xd9e070fcf1226703), W(0xa3b0b8139833345b),
+     W(0x93121135a15b8061)},
+    {W(0x474da982107d9380), W(0x20c99349c23e2ac8), W(0xf9b6b3e373cfcc90),
+     W(0x679d979ca9fd8c43)},
+    0
+  },
+  {
+    {W(0xf3118f4a3764f1ed), W(0x5524562876bdddc5), W(0x648c4a4c6ee913db),
+     W(0x4ebdb0cf7c309bc6)},
+    {W(0xb6f56e67f6ad6e6d), W(0x796b2b2b39e85cd1), W(0x4fa8cbccebf527e3),
+     W(0x2b9bc1839f248d3f)},
+    0
+  },
+  {
+    {W(0x5ca72b0f520c746d), W(0xf5881753cc7de8a9), W(0x9a052112b19b43b4),
+     W(0xe35e00bc1609ab43)},
+    {W(0xcca4e149d4b066d6), W(0x097bc3c690368862), W(0xd1542ab509986a10),
+     W(0x82a9f26c9e77ba1c)},
+    0
+  },
+  {
+    {W(0x2c0093426bbc8272), W(0x17ca28dfe6716d1c), W(0x2b3aeae20b54342b),
+     W(0x8d82159037daaf8b)},
+    {W(0xe9fe5ff9ff0c70aa), W(0x2475cc3fbd91736f), W(0xd042a99de89ff28f),
+     W(0xf1a1d042f6cd0b7b)},
+    0
+  },
+  {
+    {W(0x945bc0dbfcb119e2), W(0xd906ec755e1bb61d), W(0x3e4aa65d48c1c547),
+     W(0x59fc17b2f7656bcb)},
+    {W(0x66fa6c9d2c17f539), W(0x46d3016f7a393363), W(0x844efc4c813f688b),
+     W(0x4026a5d19e7d8dec)},
+    0
+  },
+  {
+    {W(0x3352ffdad37fde2e), W(0x0d3921eed94af4bd), W(0x7c6f3242cd47579c),
+     W(0x145844e0f68e9b57)},
+    {W(0xb4d0f690322adca5), W(0x09c7ad900dd9e661), W(0x0c8eedd2e8a620f9),
+     W(0xd00063cf2a74c96f)},
+    0
+  },
+  {
+    {W(0x9e714fb1c4cb083f), W(0xe3c1a35748426051), W(0xd6e840e706020ded),
+     W(0xe5c66bb468d95f52)},
+    {W(0x800044d93a9eda0d), W(0xb579214f480c4bdd), W(0xc7ac59633d6d4849),
+     W(0x3070ad8122a90c58)},
+    0
+  },
+  {
+    {W(0x5132d0c7e1e7c902), W(0xd5c9f3e118d91a84), W(0xa24acc51be959887),
+     W(0xf8908cb606f845a1)},
+    {W(0x74062f0ce29c3e14), W(0xa5ce84877192dfd5), W(0x7e352fad7a98b73b),
+     W(0x12bbbc060fca0613)},
+    0
+  },
+  {
+    {W(0x18adf172d2897adb), W(0xa3cfcb454496f283), W(0x41bb26c87eaff62d),
+     W(0xcdda691df4595c54)},
+    {W(0xbc8273321adb7f3e), W(0x320c014ab06489b2), W(0xa5edeaf598a6f3e4),
+     W(0x8182d29c79a3406f)},
+    0
+  },
+  {
+    {W(0x6a9c07435af34f9a), W(0xcb448223d20b8f40), W(0x96d3a91ee82b5ac8),
+     W(0x56d79de283771803)},
+    {W(0x3c50f496f461ebc4), W(0x3957e73ba745c48d), W(0x6720dc2f8c456daf),
+     W(0x4254e35e479ccadb)},
+    0
+  },
+  {
+    {W(0xb53e75705c9aa87d), W(0xf277faf1e38a8353), W(0xd9ee8dbcd3ccc19e),
+     W(0x7532d77692a7e909)},
+    {W(0x9ab8533722269836), W(0xeb91a6a3b8c3488c), W(0x689aef080000f0ac),
+     W(0x4975c5f45c99f849)},
+    0
+  },
+  {
+    {W(0x28cbb2017b3d089f), W(0x90cb829ca87fc985), W(0xdbc10b1ef96122ac),
+     W(0x224cc1816c269995)},
+    {W(0x318913f5fa7d782b), W(0x49da5b574903f88f), W(0xcda99deb2e03bef7),
+     W(0xc01a351a26fca5f5)},
+    0
+  },
+  {
+    {W(0x622156ad3e7525dc), W(0x0e6f1aa989e99eb7), W(0x3580d55b218521f5),
+     W(0x6cecd6419abd6e0a)},
+    {W(0xb769bfa14a1f4bf3), W(0xe73aad7f40605ab4), W(0x1fbdd9d278dbf427),
+     W(0x257f1a2796ebffd4)},
+    0
+  },
+  {
+    {W(0x77e16880d8225857), W(0xd5c0cb870f39c02d), W(0x4ad9fd10070a9e5e),
+     W(0xb36a3bc9dd68c6b4)},
+    {W(0xe8a0a726cd5b066a), W(0xa0ba4720de0dad69), W(0xdbaf8654b4405ad8),
+     W(0xcbd53c8e295bbe0c)},
+    0
+  },
+  {
+    {W(0x0f965b2d4a90fc8b), W(0x749a4a78505a6b88), W(0xd74e3b93eec435c2),
+     W(0x264059c0cf7da676)},
+    {W(0x09b50ee83656ab62), W(0x1d43805715c8bab9), W(0xc2527d479c5b4b92),
+     W(0x2b82725aaacf317e)},
+    0
+  },
+  {
+    {W(0xa2b6fe501c9682e0), W(0x911f799e5f7b572f), W(0xa3bb7409c53144f7),
+     W(0x6adf6605196deba7)},
+    {W(0x24d57669f5b2dfe4), W(0x811124088e18c03a), W(0x64b6d00b99817cf6),
+     W(0x6a9ac4139ba22b53)},
+    0
+  },
+  {
+    {W(0x9755f5a5917bc5b3), W(0xfd5729d855e159cc), W(0xfa090d0b1584e72c),
+     W(0xb1ddd306d16709aa)},
+    {W(0xffa20253c0e86133), W(0x9969c5157832299e), W(0x5b9ec93d80d065d9),
+     W(0xd18b5994ccad46a1)},
+    0
+  },
+  {
+    {W(0x6ff6e7b304d97c08), W(0xf86bc76a48ab26da), W(0x3a4da971c8e91669),
+     W(0x47a5908ba72a8822)},
+    {W(0xca51e63f1439d8f1), W(0xef26fd582ab95b6d), W(0xd54446af1b87eaca),
+     W(0xbb361a72330255b5)},
+    0
+  },
+  {
+    {W(0xb04f1a3d5d586aa1), W(0xa15c9a998dcd48a7), W(0x0f6862faed4f49b9),
+     W(0x435e3495eb3d0ff7)},
+    {W(0xa95bbc4e838f6605), W(0x56cd71b32c9d3c79), W(0x2dbbf4c7158c4843),
+     W(0x801fc47296fb540d)},
+    0
+  },
+  {
+    {W(0x7c99a65ecb28cd54), W(0xadc1342814fb5169), W(0x463c5d53dc0d85a6),
+     W(0x52931925390e413c)},
+    {W(0xd49f85c92f0140c7), W(0x1f4eff42d9faaacd), W(0x3bd1a7268e5f8175),
+     W(0x3a9ed57e90a35286)},
+    0
+  },
+  {
+    {W(0x917e207fa3f888f1), W(0x2776a423c3d6acd7), W(0xc51f86807c135992),
+     W(0x75054c5a905905b3)},
+    {W(0xb0a7207b52dca772), W(0x013000cc6b2880dc), W(0x184e26652756f457),
+     W(0xe9683db818c79736)},
+    0
+  },
+  {
+    {W(0xe257ac202f66dad4), W(0x0a2bf3da1f6066be), W(0x69476cab13b60e99),
+     W(0x740ee36d38817283)},
+    {W(0x9b10ccf9c5fe7b7f), W(0xbf0e1b8a9d81229d), W(0x1eabd56dbcb3b804),
+     W(0xdb560d10ecd5e6a3)},
+    0
+  },
+  {
+    {W(0x7cf9f50dbb119e8e), W(0x4bd36debbda9e06d), W(0x5260fd96041879cc),
+     W(0xedf953f80e60ea7a)},
+    {W(0xa4dee4f72d0ebbb9), W(0x98834bfd74294b6b), W(0xee84235832b27134),
+     W(0xd11642f13554b8f4)},
+    0
+  },
+  {
+    {W(0x556ada5f5a8ac345), W(0x3b2e063c747599a9), W(0x9e0e703e4af09dbe),
+     W(0x6bd184ff5587530e)},
+    {W(0x4ba6eccaa485ce3a), W(0xf8d08865e0c02083), W(0xdd25f327d488e4fd),
+     W(0x16f01c82626875dd)},
+    0
+  },
+  {
+    {W(0xe9a9b85a22ce4284), W(0x0ad01aae1bbd86bf), W(0x9fbaaeaaec792008),
+     W(0xbbf45cc9ee3a093f)},
+    {W(0x6e69565f91ca34d6), W(0xe4cf3f217d7f35fd), W(0x926a015185339acc),
+     W(0x6603a89232bcab92)},
+    0
+  },
+  {
+    {W(0x4b9f4af36e78a066), W(0x501034d203993f4d), W(0x22007d51afefaad8),
+     W(0xf2fd0dce781befc0)},
+    {W(0xd2a1f7310ce23bc8), W(0x611ac5d8f099f936), W(0x14dbcf8282cfc61c),
+     W(0x771ae2ea61400d66)},
+    0
+  },
+  {
+    {W(0xf3057d6d333de416), W(0x7ca39965ea8b088b), W(0x17ca017df4e76fcc),
+     W(0x5ca77dae034901f0)},
+    {W(0xbde16781bd513d1e), W(0xfd31414d6c6d6324), W(0xa4e09394681bb810),
+     W(0xc11ee2afae68d6b6)},
+    0
+  },
+  {
+    {W(0x465d15b9a96a8d70), W(0x1b32e1686a3ded40), W(0x94329e9abc833c9c),
+     W(0x588aab3dde4a5d42)},
+    {W(0xecd64c2819572b2f), W(0x37bcae010ff3cd9d), W(0xab0b73d8dd18065a),
+     W(0xfc8da6954d141fad)},
+    0
+  },
+  {
+    {W(0xaf35241f0efbd0a5), W(0xaddebe3139f54e1f), W(0x43067ec448108a77),
+     W(0xa1f625645fb8a53a)},
+    {W(0xf1c6ed7187e79e4c), W(0x1f4a1d692d691820), W(0xa2c2f98d90c06b87),
+     W(0x19e36b76d6806ee3)},
+    0
+  },
+  {
+    {W(0x45e1f6b8bef3f499), W(0xfc3134c21745c843), W(0x9b3c667ca6206437),
+     W(0x132127afdf574c3d)},
+    {W(0x9f9bf721800bf0b1), W(0x565e09f9da546d81), W(0x5cf40fbf508febef),
+     W(0x1c18b95eabf8fc78)},
+    0
+  },
+  {
+    {W(0xc1675a4580b2996e), W(0x1f9b1ae3de4068a9), W(0x22f761c45e6ee973),
+     W(0x13f0f77316abc22f)},
+    {W(0x3b67a6bc819d0049), W(0xc37235f3c557301d), W(0xa16a2045bf4a550f),
+     W(0x939b898152c54c25)},
+    0
+  },
+  {
+    {W(0x46c664e81efdb981), W(0xd26290a9fb51eb04), W(0x28cdd240674b0572),
+     W(0x7675c5672d49806a)},
+    {W(0x66f8d4f09d8e59b5), W(0x4c5831695b4a310e), W(0x58bac120107d97dc),
+     W(0x28c6c69ec87cca8d)},
+    0
+  },
+  {
+    {W(0x716b1e6f8dbca3af), W(0x197db87452b04334), W(0xf483aaa86b499140),
+     W(0x812e1cffa7fe9ce9)},
+    {W(0x1b39a66bd4cd68f4), W(0x6bcb044438a8b20e), W(0x9dceba05d487b152),
+     W(0xe2a7b06b778bb5fc)},
+    0
+  },
+  {
+    {W(0x21130cb1e4b5a8d7), W(0x421162016134ca81), W(0x7bc8b9e7241b3b4a),
+     W(0xc812680377b5bfd9)},
+    {W(0xb8aaba5454a5b9e7), W(0x56e4141ed9bd4643), W(0xbacc6e66df2a96da),
+     W(0x42f4ad2372c46406)},
+    0
+  },
+  {
+    {W(0xf2bfb01e121c1b91), W(0xc27f2ff48b62a7a9), W(0xe32335e36d7b75ee),
+     W(0x283806393ee686fa)},
+    {W(0x4aa897314228eab8), W(0xda8967d7d2a4c93f), W(0xfbabe58aab244533),
+     W(0x3c165c4376feb619)},
+    0
+  },
+  {
+    {W(0x63ce78db7102c5ae), W(0xa4c7a263c4fb7ef6), W(0x9292dfcc54fd7a76),
+     W(0x58264e4be59cdab7)},
+    {W(0xcf581fe33561f3c7), W(0x977b93d782f082fa), W(0x1af7cf6c34cf985f),
+     W(0x8663066bd78d6f36)},
+    0
+  },
+  {
+    {W(0xa7d6d54f2fb7fb7b), W(0xb1c2d2802c4815ae), W(0x51eed402d97e04df),
+     W(0x50f3514ad013b108)},
+    {W(0xe4f7026c324242a6), W(0xc547afc9816ab033), W(0xc046fbed72da4240),
+     W(0x2e128e54ad3604fe)},
+    0
+  },
+  {
+    {W(0x5279244000e643b3), W(0x7c4621a2a4464245), W(0x83b99a42365e1ea0),
+     W(0x337138039ad0122c)},
+    {W(0x4e2b994085638502), W(0xef2aed725018d43d), W(0x7e5f3ce843ff982c),
+     W(0x02054a98cfcace4b)},
+    0
+  },
+  {
+    {W(0xc4f9a99c40c1c787), W(0x04d5ccd926248632), W(0x4110ab7a4227aea9),
+     W(0x06363552f454fc3a)},
+    {W(0xd173383fcdabd7a2), W(0xd57281f5e548c986), W(0xc8885ba344a25726),
+     W(0x77fa208d3a8300ae)},
+    0
+  },
+  {
+    {W(0xe4098156c53779bc), W(0x1535c81339df8b72), W(0xf65c2dbea8800cea),
+     W(0x525832f6d20b5ac6)},
+    {W(0x4f489ff1e0009eb8), W(0xe5f72adad218555c), W(0xcba608292a7d630a),
+     W(0x3ea3bcc2849c8eea)},
+    0
+  },
+  {
+    {W(0xc91a51ccc112c0e7), W(0x8739640c60a894af), W(0x5338f911574038d6),
+     W(0xf2b1295833cccb01)},
+    {W(0x47ad5e1f9c19e187), W(0x06678ae1d343a93d), W(0x43379601d950c388),
+     W(0x544c687cbdac3844)},
+    0
+  },
+  {
+    {W(0xb1653e1b7c05a57d), W(0xe95b6f93c5b402d3), W(0x96f9b34121a09a40),
+     W(0xe9bfd4d35bc8a78c)},
+    {W(0x3ea7ae5063924bfe), W(0x6926bb8feceff97d), W(0x650df2c9bdf61fe5),
+     W(0x0f666a18fb60ca0c)},
+    0
+  },
+  {
+    {W(0x97004a116e59d514), W(0xf3cf8e9f40d300d4), W(0x590eef31742fa6b2),
+     W(0xd918d0edfc4913ae)},
+    {W(0xdcc3b4e36babfc67), W(0xa046019cb9c23346), W(0x3f06084c145e0819),
+     W(0xd96e00bd73c5d82f)},
+    0
+  },
+  {
+    {W(0xf15f267185b9eddf), W(0x72641bf34f8c0e76), W(0xc45b09515e51d4a0),
+     W(0x4f7044406aac561a)},
+    {W(0x091d573a45677386), W(0x12c9bab243718fcf), W(0x76885ba55c3f2622),
+     W(0xaf7568c1a29a559f)},
+    0
+  },
+  {
+    {W(0x3742d680f86cafd3), W(0x214e277c928c826d), W(0x49b866ce8e665469),
+     W(0x5f8a7ad68bb27f0c)},
+    {W(0x17dc474b0d9374b8), W(0x37c1666708a8ca1d), W(0x1a4dd8acb065b191),
+     W(0x9d6a010589f4e978)},
+    0
+  },
+  {
+    {W(0x95f55a8ad788d7a5), W(0xf2899ce8e1d4646b), W(0x9a3b1fb05b9a5b51),
+     W(0x5a8be47df54c5604)},
+    {W(0x03211b95ad8a122a), W(0x18eaa3ad54d1f837), W(0xe1d5049debb4bee1),
+     W(0xea0919095360ee90)},
+    0
+  },
+  {
+    {W(0xee8b1a0b572d26d4), W(0x77e0602d37e9c33a), W(0x1b627d1b009fc46e),
+     W(0xb35bd82f01c3e82e)},
+    {W(0x540ce1864724aab4), W(0x8e4c8c01b4294385), W(0xb4ed7eabc8b8f995),
+     W(0x6caf648cc386013a)},
+    0
+  },
+  {
+    {W(0xdbace10cca756b0c), W(0x510ae1d716e1fafe), W(0x784313c9ae4a1b0d),
+     W(0xbf76c4813a2da692)},
+    {W(0x121c860fedaffeb5), W(0xb0e7295765a55986), W(0x2b6ee1d1012270ac),
+     W(0xea869e5584545f49)},
+    0
+  },
+  {
+    {W(0xdfc23624984a7f34), W(0xf9a1aba85c46c9d2), W(0x75963d623a8fe6d6),
+     W(0x953f0db83f857587)},
+    {W(0x1f3e457327f6e3c9), W(0x36d0cfefc6bae6cf), W(0x0d2858c6410ec87f),
+     W(0xfe2dbb6de89a96e3)},
+    0
+  },
+  {
+    {W(0xc9fea3d90964b009), W(0xbc1dbcddd7308042), W(0x3aeacfbace0d88b9),
+     W(0x307dea33b9653e84)},
+    {W(0x2bedc087cccc0116), W(0x0894a8b21126cfc4), W(0x850f67dc8a484bd0),
+     W(0x26d4c28a62296159)},
+    0
+  },
+  {
+    {W(0x45dd988b563f436b), W(0x7b03a33093d5fa7a), W(0x456c04c0f3a6a5e3),
+     W(0x0394bac62946729d)},
+    {W(0xb238018af74bbc80), W(0xbb4f74e58f113793), W(0x458c9675cbf0ca8a),
+     W(0xde71794728906be8)},
+    0
+  },
+  {
+    {W(0x20256aa77ceeae99), W(0x558e24680762e1f5), W(0x943aa99fe17f346e),
+     W(0xb6132017c28c9eb3)},
+    {W(0xb5f4f7fa5451499a), W(0xb8c582564dfd7867), W(0xafbfbe2f3c805e01),
+     W(0xf2741b2e697575aa)},
+    0
+  },
+  {
+    {W(0x7eb65021c61051f3), W(0xf3a9ac4bb2f84e64), W(0x06fbd2730b70d6b1),
+     W(0xac4c6ebac1806df3)},
+    {W(0xb9467c67d84c81cd), W(0x04a436a20f646717), W(0xc526f2159905981b),
+     W(0xe368ed4292411381)},
+    0
+  },
+  {
+    {W(0x4b652521ac6f2143), W(0x3cffc6f494b6d368), W(0x1f755e3cf1bfabe2),
+     W(0x738f2821eb61ec4a)},
+    {W(0xcd8c92d2f1efff93), W(0x750d2d9822b390d1), W(0xd2c6744ec6c9b38b),
+     W(0x5bc33340095cca62)},
+    0
+  },
+  {
+    {W(0x538bbff42f6a7f8c), W(0x96b25c1fd40676e0), W(0xab2248fdcba0859a),
+     W(0x57eeb1839f55da5e)},
+    {W(0xc47c61d5fccf8890), W(0x391f82189db15b89), W(0xd40ffc859d2b0df5),
+     W(0x328a01e23ee79157)},
+    0
+  },
+  {
+    {W(0xc1b7b44956c6d12c), W(0xe367425b85c58a7a), W(0x9c5a8b5849078d49),
+     W(0x20b527e956dbd4ff)},
+    {W(0x3d74f26d4f01ce50), W(0x15c7de969145245f), W(0xe8e9533cebc2d795),
+     W(0xaf5e253f31eecfc4)},
+    0
+  },
+  {
+    {W(0x0b5f94a8b9c3221f), W(0x03b8dcaccb8091ab), W(0x650e2e33973a23b6),
+     W(0xc6d8aeeb5317c5b8)},
+    {W(0x2b62b3fd5d353bcf), W(0x0cebcf0c7bcd79ff), W(0x347cf21eb88521d8),
+     W(0xdb7fe03c2b5bf195)},
+    0
+  },
+  {
+    {W(0xef518c0337f74782), W(0xf7189a4d84b1b74f), W(0xec426353f1b35bc8),
+     W(0x285be0fb723a90fa)},
+    {W(0x6a1856a3051d2b8f), W(0x5ca7a7289cd174b0), W(0x45e896376ac16420),
+     W(0xccc0b0089c0166aa)},
+    0
+  },
+  {
+    {W(0xf879bfa23df2539b), W(0xa7f36a14da98bcf0), W(0xdf5caea5e099d151),
+     W(0xf379ffd335303ca7)},
+    {W(0xb78857c741f6c890), W(0x0501eb92587e0050), W(0xf4f7858888d2ab9d),
+     W(0x57be0e9c48ae8703)},
+    0
+  },
+  {
+    {W(0xd42b4dca1b3190fb), W(0xd95f11bbaac8fc49), W(0x946907dffa556ecd),
+     W(0x52882edd5b549ea3)},
+    {W(0x00da6ea1f25049d1), W(0x4a3b3d30e5586a4f), W(0xcb9ea6e451be578f),
+     W(0xfbbcf24131c62f16)},
+    0
+  },
+  {
+    {W(0x718990c7fbb585f0), W(0x346d93cf441cc6c7), W(0x1ea3085a88607e59),
+     W(0xdd3a73bbac693348)},
+    {W(0xd1fd7220aaca96f1), W(0x359b3cb9288e7654), W(0x857dc879abdb4b42),
+     W(0x136628ff129e3428)},
+    0
+  },
+  {
+    {W(0x6e7a91cc94b978cc), W(0x43aadd311c9aabc6), W(0xceed69fe5e18acf1),
+     W(0x35fc143652704f86)},
+    {W(0xab7b533394a9f155), W(0xca58519c3998fc6e), W(0x27b4d03548e5a422),
+     W(0x417d8e332f33e09d)},
+    0
+  },
+  {
+    {W(0xb00c78fcba217dee), W(0xc9da2835a4e5bf39), W(0x70915ea84da13b33),
+     W(0x2fd71036f35d7937)},
+    {W(0x745a25c02358f11e), W(0x4a7dcb8079152ebd), W(0xac791ea086947a48),
+     W(0x7a6a359392d29710)},
+    0
+  },
+  {
+    {W(0xb2e34cd03acd4416), W(0x29bec21ee6928c74), W(0x31a2b081f4084c13),
+     W(0xab80748075f15750)},
+    {W(0x3f5436ab9297de99), W(0x8e107f4a34a16cd0), W(0x126e93ec9f50a2e7),
+     W(0x3349e072a3c8a199)},
+    0
+  },
+  {
+    {W(0x2afee0712eb26c40), W(0xd08172c3068fbaa9), W(0x2f3ff49c6c1485bb),
+     W(0xe93309e67611d915)},
+    {W(0x8f1c805301fdbc77), W(0xafe0d59a99ff0f04), W(0x98ecd0a2b41975b9),
+     W(0xce22493c15ae1cc8)},
+    0
+  },
+  {
+    {W(0x3fdb898466205804), W(0xd78de25219f82fbe), W(0x71fab3f7df9526dd),
+     W(0x5930db9cb289c2b4)},
+    {W(0xe2b39b18f15a9fa2), W(0x4c20064d00975eb6), W(0x354fb944fe5892f7),
+     W(0x2082968d0788c444)},
+    0
+  },
+  {
+    {W(0x8f1648c6a77e02a7), W(0xb70317ca007a250a), W(0x5e2a1b7ed1faa8f8),
+     W(0xb8f4487b7b66e977)},
+    {W(0x00ac02faa8c2c736), W(0xc8124fe309219ee9), W(0x2206013962a3bff1),
+     W(0x0c3a2e445d73999b)},
+    0
+  },
+  {
+    {W(0x744cef4858010125), W(0x93580eb20f73899d), W(0x8261a7097a7b6e27),
+     W(0x929827926ba2713b)},
+    {W(0xa3fa04ad5c6a87d4), W(0x7e78ef765b57e553), W(0xd6d5a5f168eae624),
+     W(0x78447af8b3be30b1)},
+    0
+  },
+  {
+    {W(0xdf489b79398da08f), W(0x252534a396c622ca), W(0xcfdc180b5caddc5d),
+     W(0x64de524d7748b91e)},
+    {W(0xc7fecb35193e5610), W(0x24bd6912ad583126), W(0xf4f5486f0cef9a70),
+     W(0x3e361fe2c93ffab5)},
+    0
+  },
+  {
+    {W(0x13dfb5acf701990b), W(0x6cc35b152395bd56), W(0xf147afb0cf106291),
+     W(0x2024b589c80b87f6)},
+    {W(0x688af79e4013a602), W(0x0f9074b61d17f96e), W(0x92f72bc9d3b3f0d6),
+     W(0xd84fff063ce4ed1b)},
+    0
+  },
+  {
+    {W(0xf6b38a7135b530e8), W(0x48895ef5a6ed7eb7), W(0xad67f735664b8bb6),
+     W(0x8335a2f55052d2e4)},
+    {W(0x12379516790839e2), W(0x839c33fd08504f94), W(0xf043b13f160189a0),
+     W(0x7611b6718ed512b8)},
+    0
+  },
+  {
+    {W(0xe0cb30ff974a5a0c), W(0xbb36a97e0ddfda9c), W(0x6ed9273211f26421),
+     W(0xcc527b551ca871cc)},
+    {W(0xe8e996f9087eabd6), W(0xee25ff4bdb155dcc), W(0x24de2b949b9a5504),
+     W(0x4ec8e109294367cc)},
+    0
+  },
+  {
+    {W(0x45a665b2e1937786), W(0xe0aadc871cc495bf), W(0x77cd57b9fd4b6f62),
+     W(0x8e1894ce26e28ca0)},
+    {W(0x2e7687a8e290e8dc), W(0xe9c4b8487da87562), W(0x50f4705a50ff9aa2),
+     W(0x02616605f69f36f5)},
+    0
+  },
+  {
+    {W(0xdc5d7e2773400d8e), W(0x22576b089ef31f31), W(0x4b08099340ca0bac),
+     W(0xdc5d5e250cca0e8f)},
+    {W(0x71561e46237810df), W(0x8d2c7880028cc785), W(0x4f8b85d2383b8adf),
+     W(0x930c9880b4952048)},
+    0
+  },
+  {
+    {W(0x65327face65823d5), W(0x12cdea5317e1c23a), W(0xad68f7e63143d08d),
+     W(0x9117a3a5fe617f2a)},
+    {W(0x039f9db0600c223b), W(0x39d15c7961b2bfcb), W(0xbbd936ad0bc98a88),
+     W(0xc567232d8a32e122)},
+    0
+  },
+  {
+    {W(0x03367f423e49d24f), W(0x1a1c3b2178f73411), W(0x065fce09b384fedf),
+     W(0x7eca14e711eaf480)},
+    {W(0xd1fc4fb2a9b94cbd), W(0x05259585e5ee7576), W(0x03ed408726232cff),
+     W(0x5350f8c2fa535caf)},
+    0
+  },
+  {
+    {W(0x2f1fcae613d2dded), W(0x150454daa4cddc70), W(0x15ffb60f6fba86e5),
+     W(0xb987311dd8f04b50)},
+    {W(0x024ebdd230b54022), W(0x9f834ab2ecc5eeb9), W(0x5d8e9f853528ec4b),
+     W(0xb6fcb5975f5775d8)},
+    0
+  },
+  {
+    {W(0x8b74d1ca43cdb6c2), W(0xce9faf45e56ac112), W(0x86ab126eb37cfd0d),
+     W(0x82e5a076b80682b1)},
+    {W(0x942b5611c0707eb1), W(0x0224a025f3c00619), W(0x881ab42706c07366),
+     W(0x91088d4f3506972d)},
+    0
+  },
+  {
+    {W(0x75153f6c4f59c0df), W(0x3d8f24096088c10b), W(0xac16a31061768cb4),
+     W(0xedf047547967e98c)},
+    {W(0x7405b0b3acbc314f), W(0xbc31d1b1e458cb45), W(0xc8b819006a6a6be6),
+     W(0xcbf2281f2b7245d7)},
+    0
+  },
+  {
+    {W(0x13dd96eb1b20a538), W(0x9c634c03e21a938a), W(0x0542a81257520373),
+     W(0x822604c61d6c85de)},
+    {W(0x2e4435b61b3361ea), W(0xd3008ca580a0725d), W(0x2b6e019f5d2e6f36),
+     W(0xb1cd929d77da49a2)},
+    0
+  },
+  {
+    {W(0xc75eb85691fdaf14), W(0x6f9f2d1bfa481673), W(0xe2aabc7bbaf75552),
+     W(0xa5730824fc4f1cdd)},
+    {W(0x8892d602312290e2), W(0xf59d116c04e91afe), W(0x7e69352d84a10154),
+     W(0x0fe0a6c2e9257427)},
+    0
+  },
+  {
+    {W(0x32bb823eeed6d4a1), W(0x67b13db2f213671b), W(0x1c49ec2c97121c74),
+     W(0x2fb7d2c5c4bd05ec)},
+    {W(0x3aba30f9eb82452f), W(0x8c6167c991bd164c), W(0x3699fe8b59768b0e),
+     W(0x771a39a5e56f7227)},
+    0
+  },
+  {
+    {W(0x59d00b5c82701492), W(0xf3be7fa51f745087), W(0xce54ca705979209a),
+     W(0xba2ed77c969fb946)},
+    {W(0xc868c0dbbe41d6ee), W(0x5a189185812569fb), W(0xcd844ebc413818a8),
+     W(0xc5539928320ce118)},
+    0
+  },
+  {
+    {W(0x29dd946fe009cbdf), W(0xfb703debc96dbbc3), W(0x6aa9b0bdd27ef15b),
+     W(0x06948c27de022c93)},
+    {W(0x8a801484f85cbeb8), W(0x5bbef97c87c8b70d), W(0x332b303a53dbde87),
+     W(0x6bb0be66d09920c9)},
+    0
+  },
+  {
+    {W(0x7bc5cadea17f386d), W(0x3516a959df71d161), W(0x77ed3df7fb36ddb5),
+     W(0xef066de368cf5d76)},
+    {W(0xa51408ef505dbc7b), W(0x347d1e7f848e168f), W(0x6f291126402c17bf),
+     W(0xd51df5f06978ca90)},
+    0
+  },
+  {
+    {W(0x2309e545478fbb00), W(0x663ccc24f9532ade), W(0x32ead32f6d358b68),
+     W(0xeae60c62f9f18b06)},
+    {W(0xe183580012773efd), W(0x950623f73fe953a1), W(0xc8608c773d7ad95d),
+     W(0x51cbc8cd999812fc)},
+    0
+  },
+  {
+    {W(0x427b169a6b829083), W(0xa4da4461097e32b5), W(0xcd64f70014a21626),
+     W(0x6ded3e4d62f411ba)},
+    {W(0x6b17472e1cee5b91), W(0xbe94bbf64e34e322), W(0xb62becb68189e5af),
+     W(0x160d460f03c9edbe)},
+    0
+  },
+  {
+    {W(0xab9e1b2015d34780), W(0x9e624bb9acb0a9be), W(0x3556351418cdf573),
+     W(0x24a35d915e266441)},
+    {W(0xa93cdaf0e2f2d521), W(0xc53dbfd4edba268b), W(0xc0ce4392bde35457),
+     W(0x481016cc2516c5b5)},
+    0
+  },
+  {
+    {W(0x34bad85824eb65f6), W(0xbf59570d9c94f0d8), W(0x7d05b6fa278fc114),
+     W(0x5cc1ae2797537a85)},
+    {W(0xd2d3839e127986ea), W(0x43b08df7097de450), W(0xfdcb193c89857bd0),
+     W(0x48155b03a3e5b49b)},
+    0
+  },
+  {
+    {W(0x04d392d5e0fd6b67), W(0xca65f4bb797840cf), W(0xc3721573b57f8808),
+     W(0xbcc73d39044e4f24)},
+    {W(0x6a914f3904d211bd), W(0x318be63143f23731), W(0xf3f710efa4ead8e0),
+     W(0x578ca15a4e61e994)},
+    0
+  },
+  {
+    {W(0xb7a4284b081a5616), W(0xed625b0871d311c9), W(0x861a0c913549e2e7),
+     W(0xa20ee2634212da9e)},
+    {W(0x931dbf2994ada535), W(0x9ff8a760391e4e78), W(0x8798bf94c23ee1a6),
+     W(0x5e97a6d668600188)},
+    0
+  },
+  {
+    {W(0x53a6122dbcb6caae), W(0xfec95f8f93b1c6cc), W(0x461364bb03d8a556),
+     W(0x494a32e49e612bb1)},
+    {W(0xba4eddc37c3a3bfb), W(0xcacddfe7bceb4118), W(0x8c59d663ca10076e),
+     W(0x8d10da00e4df192e)},
+    0
+  },
+  {
+    {W(0x2a6eefd6fcadc5dc), W(0x8de7a1d81d60853e), W(0x235d3cb584e7118b),
+     W(0x7f74e7e6a3ea4036)},
+    {W(0xe7e42391944cbbf9), W(0x97b86608fb56eb56), W(0x980dbc3a9c3006eb),
+     W(0xee67391f7890de67)},
+    0
+  },
+  {
+    {W(0x8d009787f018f1a8), W(0x0d3d5d00db5de878), W(0xc09b9973f14ce872),
+     W(0x4e03b9203296de0b)},
+    {W(0x430a45bea33b6ba5), W(0x9a31fe1a66c7386a), W(0xf3dc3a95e8be2e6e),
+     W(0xf6100cbabc900d35)},
+    0
+  },
+  {
+    {W(0x1bf5564cc1172b0a), W(0xc20ce54534482990), W(0xf0f90edad013e657),
+     W(0xcbef1ce02b72a9c4)},
+    {W(0x8650f44fc42e6503), W(0xfffaae54160800be), W(0xab8fe5a6ce583b85),
+     W(0x1c678d3f638fc931)},
+    0
+  },
+  {
+    {W(0xf3e96d0f45e2523a), W(0xc0a77902418c7afd), W(0xd46342688b81c9b2),
+     W(0xf8161925c037fc25)},
+    {W(0x9f3d2aa0a3aee9b1), W(0x9199bf6492591507), W(0xda4adad86aeadb5f),
+     W(0x8eb124e5b4494791)},
+    0
+  },
+  {
+    {W(0xf47d6152e59ecab0), W(0x18e06906e63d591a), W(0x55da177988bb73e4),
+     W(0xeedbbc685730f95a)},
+    {W(0x78bb1803ef44358d), W(0xb637608bf95a4996), W(0x971ff5e463c2e5fc),
+     W(0x2c1da9f34a5f63d7)},
+    0
+  },
+  {
+    {W(0x82a7d8f396329790), W(0xe2f1431049d861cf), W(0xe2402485302766e5),
+     W(0x060c5402d4ce718c)},
+    {W(0x8728aa81b690e6b5), W(0x300519de91c29aee), W(0xd9e5532d8d529196),
+     W(0x3ae77b021d2998e5)},
+    0
+  },
+  {
+    {W(0x741187eacc74b749), W(0x46b30d374603721c), W(0x338ff4286eb5b0f3),
+     W(0x55af3c1aaf6276d2)},
+    {W(0x94e7c935a06d58f4), W(0x380ac15b9ee3b76e), W(0x8cce63cc96d100c0),
+     W(0xb2143390b158e6bb)},
+    0
+  },
+  {
+    {W(0xc3b79b50c178d121), W(0xa1966a4d53588a87), W(0xd9f96eb946cefff5),
+     W(0x59880b597c747431)},
+    {W(0x6348b3b35a075d0d), W(0xc81d642664c33758), W(0x40c7b8235f93569a),
+     W(0x579f15f5ed860b80)},
+    0
+  },
+  {
+    {W(0x2d7e70b1be3f3cf5), W(0x0bfb1b13a312731f), W(0x438cbe7acb7fbd7e),
+     W(0xbfe21528ad5e0059)},
+    {W(0x4a4a7d779e129cfa), W(0x40a48a5e8986fede), W(0x3e98f73a00b81cf3),
+     W(0x9b4b87c7d5141fc5)},
+    0
+  },
+  {
+    {W(0xd02c293030147f30), W(0x6dac39183dbed59e), W(0x90da130f42514961),
+     W(0xafc2c73b676504d7)},
+    {W(0x204e07423c79de30), W(0x87097d11e5b4b8f9), W(0xa1bf0e80a30840d6),
+     W(0xfa260f1288231270)},
+    0
+  },
+  {
+    {W(0x7026a5bb71283c5c), W(0x9f61defeebaf5839), W(0x5f33dae1ab56f564),
+     W(0x8477431b40818586)},
+    {W(0x1add8d295105f941), W(0x7f4a0c5e1a2bbd28), W(0x3de8afb223b59162),
+     W(0x007090a4d5ee4a62)},
+    0
+  },
+  {
+    {W(0xb98db65739d683f5), W(0x127f433305274175), W(0x9b98dca6e27605eb),
+     W(0x94da34d5064bd21c)},
+    {W(0xd323da3c275acf32), W(0xfa4da6888402a06c), W(0x9fbee21de99ce631),
+     W(0xc205936b453db956)},
+    0
+  },
+  {
+    {W(0x8c0f1fbaa8b006b2), W(0xe4be353e9aadebc9), W(0xed2af555481a9a89),
+     W(0x62eaddff2eaa3c40)},
+    {W(0xec901f0f42e0299b), W(0x2e7fa31d3a6a8d1d), W(0xce2024fa308316a6),
+     W(0xa0ec7a6de184b4e7)},
+    0
+  },
+  {
+    {W(0x4cd45a6d43e416dc), W(0xd24281009a5f68a7), W(0x74c80847d996b147),
+     W(0xdf809b8362ecd095)},
+    {W(0xf6afd00bd605cfc1), W(0xa991a04b96db7300), W(0xe52970e248f33de5),
+     W(0x5cf405b38d396da4)},
+    0
+  },
+  {
+    {W(0x581fc7085d957f73), W(0xb235d1e037eda67c), W(0x3db30191e3432c6a),
+     W(0x14900d8cfdd114c4)},
+    {W(0x91c2b1022802ae56), W(0x40e96ac5b0b70c76), W(0x223609bde786a6bb),
+     W(0xbeca1e2af194daa8)},
+    0
+  },
+  {
+    {W(0xbbc07902c7b891c5), W(0x1f174c61439b0af0), W(0xc1512b903f0d07e5),
+     W(0xb97a87c6cadec97a)},
+    {W(0xe5df88b48f5a5f3a), W(0x86df69221fd7aec7), W(0x3993cbc7725000aa),
+     W(0x5b70b55bb840e7b0)},
+    0
+  },
+  {
+    {W(0x91d0a895dc71ff5b), W(0x7b875f4943c51314), W(0x7b7f1ad11490dd51),
+     W(0x4874976d82ab95f7)},
+    {W(0x1ebb7313f833b54f), W(0x6304a4b30a7a9815), W(0xb55598aeff285471),
+     W(0x9ffbda4e3ad11913)},
+    0
+  },
+  {
+    {W(0x311db5121d7b5137), W(0x979a7092b10d3a92), W(0x81f12a7c37ac058d),
+     W(0x39790938e13e66b2)},
+    {W(0xcefb6694caabf1cc), W(0x41c62197e3e7edea), W(0x17ac3d73cb7ed275),
+     W(0x59fa27bbf1cf7df8)},
+    0
+  },
+  {
+    {W(0xc75e8245432ae6c0), W(0x6ac1898c6341346e), W(0x9d689f2f325cc99f),
+     W(0x71dd15de4693531c)},
+    {W(0x766617cb0b34c04d), W(0x1e68cbee4258494b), W(0xf8313ab3dc6a740e),
+     W(0x7d1c52cdbcf7ab3d)},
+    0
+  },
+  {
+    {W(0x3c60d83db3fa04cc), W(0xa6d6a1d2c022f36c), W(0x205fc77bce2f0038),
+     W(0x325a76ad77cfb4f6)},
+    {W(0xd4253e8312ab9a6b), W(0x7976ffba2dd98947), W(0xd49c7c9be75d2d51),
+     W(0x58cb4e50ba0e8b49)},
+    0
+  },
+  {
+    {W(0x70aef56bdeb644f0), W(0x72f2d4242596df57), W(0x8b8b707c1d383b27),
+     W(0xa04420c48e3221c6)},
+    {W(0x68540ebae8904b7a), W(0x67f17e3dc60a090f), W(0xbbbb43e2bc32915a),
+     W(0x7cffa699fc9a7e55)},
+    0
+  },
+  {
+    {W(0x912c121775070171), W(0x0cb93bcb3260bf94), W(0x4ec4d2751f6f5294),
+     W(0xbab42111a88b34e3)},
+    {W(0x59bf4269ad75952b), W(0xec5178bf20b9cdd3), W(0x7c433179df17101c),
+     W(0xcb5fa345192654c6)},
+    0
+  },
+  {
+    {W(0xe7a8ddbba1523735), W(0x068d8543799fcbcf), W(0x5b07e0a696e13758),
+     W(0x1dd29be659de1909)},
+    {W(0xf51e1b6e363e5cd2), W(0xfbbf93dac4457063), W(0xe04424c63e5ebe36),
+     W(0x81542a5848248898)},
+    0
+  },
+  {
+    {W(0x4f7afabae7a4b08c), W(0x2f2fb1d9faab646e), W(0xde59d3aa3d397c27),
+     W(0x928060080dba4e4a)},
+    {W(0x9ea9e7738dfb275f), W(0x89ddeaa224f6d99b), W(0x729909f960bf02c0),
+     W(0x67ad8e24b2e2b20f)},
+    0
+  },
+  {
+    {W(0x4e28ff3b705bf93c), W(0x86b60adc69d132c2), W(0x8da6e85bc958c65f),
+     W(0x18bf26cf448a8599)},
+    {W(0xe0b7cdd9a5511cd9), W(0x46e585a6bebe5d33), W(0x1e700b7c314d3f64),
+     W(0xf3526be3b396db6f)},
+    0
+  },
+  {
+    {W(0x8278617f7de451a9), W(0xae2b1ebe750c17d7), W(0x711896fb3aa0f30b),
+     W(0x5867ea513f567858)},
+    {W(0x695d98a9374fa619), W(0x2d4de4cd14b9b5b1), W(0x3517de4958d293bc),
+     W(0x144d8c7712d9f37b)},
+    0
+  },
+  {
+    {W(0x60f93edcadb75954), W(0x2fe5970e66484cd8), W(0xd18b382993d04b73),
+     W(0x162d749a7851e929)},
+    {W(0xad94dd6cd51221a3), W(0x84a6b78ead5514c2), W(0x6af708d5fc429e1c),
+     W(0x304d6026f6cdd505)},
+    0
+  },
+  {
+    {W(0xd63517ea5ad6d97e), W(0x8d8b0733379fa46d), W(0x925aede7d2e6016d),
+     W(0xd7b89dad4b54bc38)},
+    {W(0x7ccea0f96e346e91), W(0xd23aa8a510253d33), W(0x371c142dae338e08),
+     W(0x15b25a47bc198621)},
+    0
+  },
+  {
+    {W(0x163ef4ba78a1a3ad), W(0x54fe5e125a41a5cb), W(0x626d68abea911b47),
+     W(0xe80ffcb7b6558f14)},
+    {W(0x9b44a0443b733902), W(0x7abada7743500f6c), W(0x967a94599eec9b4b),
+     W(0xffcd5a2734d6db44)},
+    0
+  },
+  {
+    {W(0x60861e52b6c4ef16), W(0xc7655269ebef0bc6), W(0x7dc4c0d0f57add02),
+     W(0x23bde5a3d5966814)},
+    {W(0x9bf1afa65c600b1f), W(0x01f9cc5fa0f85753), W(0x379d2177b67e3466),
+     W(0x7bae266604921870)},
+    0
+  },
+  {
+    {W(0x1107a94dfcc17ca8), W(0xfd8dd50b9bccbc27), W(0x6159a6f39fe20afe),
+     W(0x5178da88a5d17f3b)},
+    {W(0xe70a6d5a1159c8cd), W(0x2473ecf3ed04588b), W(0x79dd09847c9af4ec),
+     W(0x08254eeaed372d8f)},
+    0
+  },
+  {
+    {W(0x4ab857039eca0971), W(0x9e25ef63c38b3948), W(0xb600ff031b45393c),
+     W(0x85b7be8ed7314634)},
+    {W(0xd309e6de0418b337), W(0x8ba21ce3dc519d8b), W(0x8de40f8b238809f0),
+     W(0xf76b9d9595db2fdf)},
+    0
+  },
+  {
+    {W(0x35f505c6ccdd1f7a), W(0x443fc0c34a78529f), W(0xfa179e7f02037a78),
+     W(0x8f5f1a7d7bf04e3c)},
+    {W(0x5db2c4ca5f24671c), W(0xe61aef9c2e2361f2), W(0x304e1bc272066205),
+     W(0x62b4c8418f8e6583)},
+    0
+  },
+  {
+    {W(0x50cf900a3f3d02aa), W(0x6b22b5f93c6aa988), W(0x3622908685e2ed83),
+     W(0xaa9686d455cb0263)},
+    {W(0x7f8f568d8cd02560), W(0x71a78c2c59e4d368), W(0x1453f83fbdbcc2d7),
+     W(0x580ea515d38d88c7)},
+    0
+  },
+  {
+    {W(0xabae0ee0cfd2ca3c), W(0xc5d0b9f1869b35d8), W(0xaaca56d1302f073e),
+     W(0xa6d33297d940468c)},
+    {W(0x50add543dd7f2f31), W(0x1040ad9ad0ee874b), W(0x7de9751f2c380fe6),
+     W(0x737537a0debd770a)},
+    0
+  },
+  {
+    {W(0xb68522dbceda8f13), W(0x82ac2dc6736b72c8), W(0xe5fe75e25cbbd23a),
+     W(0x33705506a7d6dae0)},
+    {W(0x93473800c884e845), W(0x60ff04173dbc7eb8), W(0xf4fb64714f661c29),
+     W(0x91e207c9ff10a257)},
+    0
+  },
+  {
+    {W(0x5283d80d83797fca), W(0x8d996387ea80a7fc), W(0x45c67fe14b08c67e),
+     W(0xe84ac72da43afb7e)},
+    {W(0x791e90dd52ab50b7), W(0x3c80212b3c83e04a), W(0xeac1f546fbe76f88),
+     W(0x5184314eef32291d)},
+    0
+  },
+  {
+    {W(0x943b8f29ec254cbf), W(0xe1a97c35891407e3), W(0x34da908ae7a1943c),
+     W(0x9901e826c2e46c8f)},
+    {W(0x9b8cf2f5e32777de), W(0x44ab0a4088e2d387), W(0xccee1bd0af4671fd),
+     W(0xa5021e05d44f0ee8)},
+    0
+  },
+  {
+    {W(0x6556eb72fe5de6bb), W(0x96af795f41189998), W(0xc281f8889f3d439b),
+     W(0x1c3079022c274f87)},
+    {W(0x5da3834739e17770), W(0xa8de935808bd8c48), W(0x127258a4c3bfcf68),
+     W(0x8b5c8c54edd0d1df)},
+    0
+  },
+  {
+    {W(0x62a158d222158f2f), W(0x70c57d3b50bf99bb), W(0xd694516592086f04),
+     W(0xba07b493ad9258c2)},
+    {W(0x7c3f87d62eba2a37), W(0xc570900d2c253797), W(0x169e58d87381cadf),
+     W(0x71d5b42f9897b5fa)},
+    0
+  },
+  {
+    {W(0x6c4225e452c600f5), W(0x947ab7bd76542400), W(0x0f322f855b67afc3),
+     W(0xfd26978e90c0ede5)},
+    {W(0x0d17b68af7e25951), W(0x0db9cdde1364b7ee), W(0xec106bedeec5d943),
+     W(0x204583177df112be)},
+    0
+  },
+  {
+    {W(0x7d58d515d38b0921), W(0xaaed79c3548e8198), W(0x42306b813213b9d0),
+     W(0xe8a7623acda5a493)},
+    {W(0x6e777106f60bd52c), W(0xb5e0365c13d3ebef), W(0x2c8894c2c43ac951),
+     W(0x1c2740a47be90972)},
+    0
+  },
+  {
+    {W(0xf23727f91b1d0d1e), W(0x12985da14d15d180), W(0x5b3de231d86efc07),
+     W(0x0b34d02ea0b0710f)},
+    {W(0xb6e481180dce2db9), W(0xba4e4216180552ce), W(0x38b8f3eb49eda83b),
+     W(0x8453a01f308e4ea4)},
+    0
+  },
+  {
+    {W(0x570f63e40848eb7e), W(0x6809d9fc9b66550a), W(0x02e31ce60182b198),
+     W(0xb3a42fe1ea8fe45e)},
+    {W(0x6a6d6b59ddaff8f0), W(0x3924085fa8d7ef24), W(0x50494dc37ec8d0c7),
+     W(0x1dfce2df5c8e2b8b)},
+    0
+  },
+  {
+    {W(0x29d573272ec0738f), W(0x8d946558d1f1e768), W(0x2292953a90b4f385),
+     W(0xd48cbe5cdfdb57e1)},
+    {W(0xeae2c07b60161638), W(0x52b064eafb6525c9), W(0x3d2e47570a8c18a2),
+     W(0x2c6b99cc6f5af1dc)},
+    0
+  },
+  {
+    {W(0x69cb98a46f11b973), W(0xa266dd82d549e970), W(0x69c3eeafe33722a4),
+     W(0xfedd4f240ac04b55)},
+    {W(0x6540c829d931b59c), W(0xa5bf9c6daa67032c), W(0xb891cf7a6abaccdb),
+     W(0xf912b380ba05d35e)},
+    0
+  },
+  {
+    {W(0xb33d06514c58e44d), W(0xc7adb5f1cae338e3), W(0x4abbd856c6fcc7cb),
+     W(0xd8967d1a5f92fdd6)},
+    {W(0xa2189e2d2ca6ccb3), W(0xa3c9c8eaef9c6e8e), W(0x2df415089e2b440c),
+     W(0xa6c228b979cae4b4)},
+    0
+  },
+  {
+    {W(0xcf03bc10e61080d4), W(0x60ae0753a6ef3f9b), W(0x0ee9ff8857ffaf54),
+     W(0x8f9fbfc5739df747)},
+    {W(0x38a52b1fe6532e9c), W(0x4025e47abb509ee5), W(0x4115491c7234b664),
+     W(0x8413391b9754a28a)},
+    0
+  },
+  {
+    {W(0x10613f43aef0617a), W(0x661721c8aa855bcc), W(0x400a3c93e7b33ea0),
+     W(0xe2e071e51b2d3de6)},
+    {W(0xc4d37eec74d5f49a), W(0xc166cfc6826f5817), W(0xa1f3f03d3e05e5fe),
+     W(0x12e763c4aa42ec83)},
+    0
+  },
+  {
+    {W(0x9807d95c2e1a3619), W(0xf5b56032b43bc059), W(0x0e8d70c06e110c77),
+     W(0x2f44fe2f472e601e)},
+    {W(0x43e81c5eb843b635), W(0x0676eb64167a313d), W(0x5810d87c9da107d9),
+     W(0xba6485b69926e27d)},
+    0
+  },
+  {
+    {W(0x2e915b66c0943d78), W(0xa47c95deca4bb1bd), W(0x4faaecfc37121033),
+     W(0x2153e576dc5e1e6c)},
+    {W(0x9cb3b370841417c2), W(0xc4bcf31ae994ba8e), W(0x57bd8f68b2646ff2),
+     W(0x32c73c11679f75a1)},
+    0
+  },
+  {
+    {W(0x14cf048507864156), W(0x9233e672f52ccfe9), W(0xee2e0071c80dbc0d),
+     W(0x0b5ffab96cac64d6)},
+    {W(0x7847b1e82edc642e), W(0x0a1dda104044fd2c), W(0xae43294de21ba64c),
+     W(0x80e0cb1c350875c7)},
+    0
+  },
+  {
+    {W(0x03c274731771cc43), W(0xfa374d09c1b6c002), W(0xe802c84c770fc1f1),
+     W(0x7549cae10a032484)},
+    {W(0x10a32884200df347), W(0x3b14d50a60fdc885), W(0xc4595fc2801dffe6),
+     W(0x3988e873471693fb)},
+    0
+  },
+  {
+    {W(0x75f2d81553d5f099), W(0x494522581f86f30a), W(0xc8cee9592e20d0f5),
+     W(0xa01be042aa423d6f)},
+    {W(0x7e22c640726a1f19), W(0x6d60a16c6a8c8d05), W(0x0aef1c44da944d34),
+     W(0xfc0a965ce68afe03)},
+    0
+  },
+  {
+    {W(0xfeb6be0dc69575f3), W(0xb3b5d7becd196875), W(0x4a98b6e188e09335),
+     W(0x9249b0f23d77fac2)},
+    {W(0x8b0c4b5d5cd89fde), W(0x64b5faf171f2b461), W(0x198967b8befcc1b1),
+     W(0x11d73f6489f9c997)},
+    0
+  },
+  {
+    {W(0x344227643913efd1), W(0x8b4e63f40dc0b4ea), W(0x1adf69914df61b17),
+     W(0xc49f2f6fca6889a4)},
+    {W(0x88a8dde872014c71), W(0xde43270459d0111a), W(0xda55d4f4b7181dcf),
+     W(0x3e6f8f41092377f1)},
+    0
+  },
+  {
+    {W(0x1e8467e2b494715e), W(0x369f7ff0e9cf4960), W(0xefcd254f3baa1269),
+     W(0x32ac7a8edbdf02d7)},
+    {W(0x1fd447ec5b753c4b), W(0xe563036ca43cefd9), W(0x8b128805939035d9),
+     W(0xaa4007e45869e306)},
+    0
+  },
+  {
+    {W(0x4e4991c257bc2384), W(0x44745661cfd1f7ec), W(0x8ac664da57bba329),
+     W(0x963465638510e0b2)},
+    {W(0xd760c1f66115d983), W(0x0a482c6d2ed9cc39), W(0xc2cc05a569e27c53),
+     W(0x90242afc80ae7043)},
+    0
+  },
+  {
+    {W(0xfca8a982de206732), W(0x2be6e118803fda4b), W(0x60a25a3a1c8b2929),
+     W(0xf33f8eb5d31c234a)},
+    {W(0x0b641d424250ad6b), W(0x606537b2b5356d35), W(0x9798153f7ddf2530),
+     W(0x67b0deb308e93f9c)},
+    0
+  },
+  {
+    {W(0xf76d18cdf4e0e7ba), W(0x6b385fe18f1cd201), W(0xbf14f5bd4503383b),
+     W(0xe814837852ce229f)},
+    {W(0xb4874d23a0a841ff), W(0x308c48a44cae7906), W(0x725dead67384ca18),
+     W(0xfab3a82e37225f27)},
+    0
+  },
+  {
+    {W(0x038239f0950731fe), W(0xefb063c48e39c1b7), W(0x39af02bf1c4909b1),
+     W(0xf56cf2216e48fecf)},
+    {W(0x0c7927aff61c8b77), W(0xd9a2cd58fa911eac), W(0x351fdf3bffb345ed),
+     W(0xaf998d6ebf3d7ee4)},
+    0
+  },
+  {
+    {W(0xb1fdd10c3d58a480), W(0x54f007be921658c6), W(0xfb38c578c1ec4f16),
+     W(0xf2c36936e0944567)},
+    {W(0x856d184b5c67b0e0), W(0x1beb19194c4c6afa), W(0x23c3b3d6ad4e5d9b),
+     W(0xe2e353b74cd36ee4)},
+    0
+  },
+  {
+    {W(0x67d2aaa854f14ce8), W(0x907c2090a9773761), W(0x642b1c4d2175f773),
+     W(0x4c274af59a32df3c)},
+    {W(0x4f9aa1b0a560c3ed), W(0x429dbc5e6b1d200a), W(0xf8105698b30082f3),
+     W(0x70ef3906e9a2621a)},
+    0
+  },
+  {
+    {W(0x35b5404a348852e6), W(0x2bb2578285d01dc7), W(0xe2e79dadb982cafe),
+     W(0x1055ee72c6ea8867)},
+    {W(0xeef798e0df32f1e5), W(0x31dae56f72bae1b3), W(0x70ce301542a2b5a4),
+     W(0xb9ca30db842d8d58)},
+    0
+  },
+  {
+    {W(0x6f67e20ab52bfb13), W(0x50d648384c313577), W(0x92aadbab5639d211),
+     W(0x1aaee3fb11f3c5b6)},
+    {W(0x2b69e1c60316f59f), W(0xd36aa8a16cf84857), W(0x52fe81bb65f7e640),
+     W(0x885af72a3dbed043)},
+    0
+  },
+  {
+    {W(0xe28ebd158946ff08), W(0x9d9f73fe917b30c6), W(0xa3092ca1f1f01b19),
+     W(0xb18195958e453c16)},
+    {W(0x9b33aa3f7396eab0), W(0x969db62ceddbaaad), W(0x42717eee37ab80ef),
+     W(0x247294e1bda35299)},
+    0
+  },
+  {
+    {W(0x353c25a4afb5f4c0), W(0xf4ebe8cf0d21e3fa), W(0x1f45ccbcf8410baa),
+     W(0x554f6a291c1ade74)},
+    {W(0x617857fe67c6d011), W(0xaad3a3625440a663), W(0xdefb426def964716),
+     W(0x02a1f482e7ca8b74)},
+    0
+  },
+  {
+    {W(0x1cb8bbd73f135a33), W(0x64d745f2f645cfd2), W(0x0b5d0bc8fff7fc4b),
+     W(0x81498ce4417ce1fb)},
+    {W(0x0a54587738fe3157), W(0x2f78120070defc76), W(0x043672b9cee69198),
+     W(0x32dfff49d1c769f2)},
+    0
+  },
+  {
+    {W(0x091b66bbd5f53692), W(0x3164ca0006abddea), W(0x7f80959a7400573e),
+     W(0x94a4b820668cf68e)},
+    {W(0x523a6b7ae21b4777), W(0x3de4d9d93cc938a5), W(0x6d51c496a4c29e8c),
+     W(0xdc65ad0aa6078c76)},
+    0
+  },
+  {
+    {W(0x3e8c5a6e95fb2f95), W(0x5dbf5185dc7f4109), W(0x0961f2f35725834a),
+     W(0x9ff054b00ad437cf)},
+    {W(0xdd00d8b3dca4ebb1), W(0xd0e868d65b612304), W(0xb6102bfa96dc4e53),
+     W(0x683134931a0c8b0a)},
+    0
+  },
+  {
+    {W(0xc24d0a7501b827a1), W(0x92cc6add3a5a2d23), W(0x47e3556d71e1d253),
+     W(0x5745c93c487edca5)},
+    {W(0x11ad89a9af08bd8e), W(0xa787e5c66eca1fbf), W(0x5a8cde5f7222ef47),
+     W(0x1110ca2edb3a8e04)},
+    0
+  },
+  {
+    {W(0xee7a81c8f9a98914), W(0x10f1671bb401229f), W(0x83d8b997dc4b8c22),
+     W(0xf2c9a7d4b9872fd2)},
+    {W(0x53b109aa1fc7412f), W(0x52621da8ba6d1442), W(0x7d4c0cd90e84e26d),
+     W(0x80e182c1faa6c986)},
+    0
+  },
+  {
+    {W(0x2079db240f1acb6a), W(0x32c535055b9c472f), W(0x4fbbd18434f7e34f),
+     W(0xb5cad63882a45adb)},
+    {W(0x507cd1177e7d332d), W(0xfaa6760af1d1af44), W(0x6e33072902085730),
+     W(0x3f63cef679bd18a6)},
+    0
+  },
+  {
+    {W(0x1f9b78e53039f4e0), W(0xc071fc5357491069), W(0xee134cc873622922),
+     W(0x5e7afeab84b8da3e)},
+    {W(0x6dc81b22ff8c9180), W(0x251abe34d65032e1), W(0xefd4dc4f0bfdce6c),
+     W(0xccbb872883ca3f13)},
+    0
+  },
+  {
+    {W(0xd059ce6f1fa00eb0), W(0x9d0b14c317ee4bd2), W(0x3d69ac92a69aca8d),
+     W(0x7f7d62cf95d0e788)},
+    {W(0xfd392f4fb1ae52f8), W(0x235095b580af9297), W(0x4f6381e0f0ab963e),
+     W(0xb63c6dd3f17a3d5d)},
+    0
+  },
+  {
+    {W(0x5b1360ab4a405122), W(0xc543890d7acaa686), W(0x155f6d6e7d0f31bc),
+     W(0xc7d6012fa3259a46)},
+    {W(0x6209760c0232f68b), W(0xe0c0587ec461fff7), W(0xf5e924ab286b1c35),
+     W(0x078222abe41a710c)},
+    0
+  },
+  {
+    {W(0x9f47b144a84d8387), W(0xc4322b1b94be3037), W(0x39d47d1bf80e5a4c),
+     W(0x7eef66c7eb41d8ce)},
+    {W(0x96e355f573208f03), W(0xc1c19efe8ec09e86), W(0x70f873ecff87421a),
+     W(0x0d057dafc141d81d)},
+    0
+  },
+  {
+    {W(0xb34d554bdaa6c6e7), W(0xc9ca8b122e073b33), W(0xf8233cd7af898d6f),
+     W(0xe4a31a101c9709ec)},
+    {W(0x3b1cbf84191ce942), W(0x35f8d5c172770653), W(0xcffd6c59395d352b),
+     W(0x8de45bc30385d4ce)},
+    0
+  },
+  {
+    {W(0x3c253aec6196e60c), W(0x34e13ae1cfa7e7a8), W(0x7cb4828460386189),
+     W(0x16b65e28c3f68178)},
+    {W(0x982168581b55d317), W(0x3ab21467daf206cc), W(0xbc9003e43423f663),
+     W(0x0a49ff8220d2c431)},
+    0
+  },
+  {
+    {W(0xf039ed4b67c35df4), W(0xb27c40c47bc78a2b), W(0xe8f8a0baf4367636),
+     W(0xd7b0a440fc3d86e2)},
+    {W(0x2dab476cc7cf0582), W(0x14dbef60d9ad9203), W(0x8b4154e9f590468c),
+     W(0x823f1dd14fae141e)},
+    0
+  },
+  {
+    {W(0xc7301ee255d9cbed), W(0x29f851fc809dc150), W(0x4f35bc25300fd8c1),
+     W(0x5d0c8bd8775d6ab9)},
+    {W(0x10c2eabed1e2ee38), W(0x66be5dbea55482e8), W(0x879b44acd773dde6),
+     W(0x5681aa907112ef8a)},
+    0
+  },
+  {
+    {W(0x37e7cc02737cec9d), W(0x95db4c5d20619cb1), W(0x07e72a7ee71d8c07),
+     W(0x7dfe96e99c16e91e)},
+    {W(0x331360bd4537947a), W(0x3d4ef7f17c7b20f4), W(0xb530987c4ef88988),
+     W(0xa497e1f923c96f2b)},
+    0
+  },
+  {
+    {W(0x6d52402bf64cdfcf), W(0xc82b5b9583092f6f), W(0x00b0a4cfb3149306),
+     W(0xb0f3ad396f0f80e6)},
+    {W(0x0eb98cbc61efaa78), W(0xb66bbbf64143b46f), W(0xe7475aa18cbba3b2),
+     W(0x457968cea4b9a680)},
+    0
+  },
+  {
+    {W(0xcf16f79f84557108), W(0xb907c48726d56b2b), W(0xe19e36bc192be635),
+     W(0x071e58133172045f)},
+    {W(0x2ef334cbe4eec9de), W(0xc78f702c235edc26), W(0xbb1987c9035322e4),
+     W(0xa026ffb1edd6bbee)},
+    0
+  },
+  {
+    {W(0x4bca00f1e582707c), W(0x569c37e2a0fc52e6), W(0xc62beafdf63145af),
+     W(0xf5ffa25d6445d29d)},
+    {W(0x44094e2282f47d50), W(0x0f698b49095ca2a3), W(0x8b2fc87f1cd5a980),
+     W(0xb15ee19bbcd685f2)},
+    0
+  },
+  {
+    {W(0x19d948e907cb52f1), W(0x1919a775f409a395), W(0x870c30d6574604c0),
+     W(0x3c4fcbdb9d2d6ce0)},
+    {W(0xeb459cea4619844d), W(0x426232a58e6c438a), W(0x76b64f16eb59d3fb),
+     W(0xe8430365983d0901)},
+    0
+  },
+  {
+    {W(0x7a398086d5e8287e), W(0x7a9d8f948141f828), W(0x42d1afdc3e5b232b),
+     W(0xb0f9b3a4d2cc4482)},
+    {W(0x2e743eb601bd2004), W(0x06b34c724a46c41b), W(0xeff183a7e23cc26b),
+     W(0xb05512e3b1f913e1)},
+    0
+  },
+  {
+    {W(0x826c14dbbd8a7114), W(0x9d84da8ed90ce085), W(0xd41b1dca87e1ef85),
+     W(0x56aa348612453b07)},
+    {W(0x0fd0797dc4566fbf), W(0x177a938014c61f1b), W(0x7fee35f236946351),
+     W(0x8c6a4d6a777c1a18)},
+    0
+  },
+  {
+    {W(0x47d40d68af75b68e), W(0xfd4731f47165c0f3), W(0x3019f84c78dddfa0),
+     W(0x92fd488ea74c71a0)},
+    {W(0xf174ddafd10f08aa), W(0x76f56159610553c8), W(0xf276a96bc2ab4142),
+     W(0x630ebc88869d347a)},
+    0
+  },
+  {
+    {W(0x5aa0b808acc0b0a3), W(0x354c5a5e7a6642dd), W(0x279cc244ab44603c),
+     W(0x9f75439c9c210142)},
+    {W(0x72dbdea185bbde8a), W(0xb2d5e6736e88855a), W(0xedf7d7fad81cc9f9),
+     W(0x21a19edd834170e5)},
+    0
+  },
+  {
+    {W(0x5b7102c63dc32508), W(0x2ba9e6959b1267ec), W(0x6dbfedc758c72fe6),
+     W(0xb719c7915e8566ba)},
+    {W(0x00788abaf3ed3d57), W(0x9756b52fbf3c8498), W(0x7b915056cc31a6c5),
+     W(0x01ed4cd1b5ff1552)},
+    0
+  },
+  {
+    {W(0x88a935412668725e), W(0x31a2b142919fb4e1), W(0x10d6ce590e96aeed),
+     W(0xed183924177baf13)},
+    {W(0x257e8d12d42fb4e4), W(0xa91e5bb50939d685), W(0x54868e51df4bc981),
+     W(0x7dfb109d96f9c79e)},
+    0
+  },
+  {
+    {W(0xaf54a65a8a200741), W(0x6d13076b238d10a6), W(0x5b2ab30ffa724c9f),
+     W(0xa3a17416805391a1)},
+    {W(0x690bab4161e271bc), W(0xaeb024d3ffd779a2), W(0x9295f69b23fd363c),
+     W(0x9b9e8991d923558f)},
+    0
+  },
+  {
+    {W(0x3108da24002dd7dd), W(0x1a30754aabc992aa), W(0x192b0d61d0c0ed34),
+     W(0x4ff528828780ff94)},
+    {W(0x4578eae6b82c5ca3), W(0x554a5a3982bdbce8), W(0xb669b00b78299c98),
+     W(0x9092ccdece27cce3)},
+    0
+  },
+  {
+    {W(0xab796ae73b76d164), W(0xef43af97ebcac1c8), W(0x6f737bf339bc76c2),
+     W(0x8f24363604a9fcbe)},
+    {W(0xdacbc502a3e0c498), W(0x5b9f296bc567704e), W(0x9fe6f28a1bd163c3),
+     W(0xfabfa6c647ca8afd)},
+    0
+  },
+  {
+    {W(0xf1f6c2f2ebdad680), W(0xfd5bc6c6d499fed0), W(0x31cd27a61236988d),
+     W(0x1403d67260512895)},
+    {W(0xb63cb8f5eaa5cc10), W(0x8e91aaab67ccbc66), W(0xa9ce97ce9e160fdd),
+     W(0xeb9e0fa1b79afb85)},
+    0
+  },
+  {
+    {W(0x998db76dfddfe58d), W(0x5f15ca667e2ea363), W(0xe3ba523e83a188d7),
+     W(0xcb7394f0f282b185)},
+    {W(0x0228f3db94c4d079), W(0x2d920056584115f6), W(0x4bc8e28dfa4289ea),
+     W(0x339fa65722612dd1)},
+    0
+  },
+  {
+    {W(0xdfcc559a2989d78f), W(0xe05674da2db113fc), W(0x5390d4ae4dee535a),
+     W(0x34e8ff68e6366084)},
+    {W(0x5181947c5ddc5b63), W(0x58a8ead58bcae1fd), W(0xa5f5eb2d27021c4a),
+     W(0x0c7a50d4a096654f)},
+    0
+  },
+  {
+    {W(0x548eb9aba191233f), W(0x2a693f4ce8a7267c), W(0x8fa86ae6558d4339),
+     W(0x94b8f2597bbcb115)},
+    {W(0xe845dade2bc44a6b), W(0xcfa51a40b0347dea), W(0xfb49c1580f88ee55),
+     W(0x34697733d9b25978)},
+    0
+  },
+  {
+    {W(0x543fe2caf5b0a4d9), W(0x0485d12bb44c4711), W(0x5f0bf73521602fb1),
+     W(0xcbab35a39e17ee17)},
+    {W(0xc3d067838e89f47b), W(0xec5e6f95d939cef8), W(0x94394c5438c9a460),
+     W(0xf36bdea1eb141cda)},
+    0
+  },
+  {
+    {W(0xa2b55a443574cc18), W(0x752837a381362914), W(0xd921c5260c3f9612),
+     W(0x82062a269ae382dd)},
+    {W(0xf49f48668a42ee8d), W(0x28bf255e865144dd), W(0x65163b9e78902b30),
+     W(0x374d0df0510d8617)},
+    0
+  },
+  {
+    {W(0x334bf381bd5dc5e7), W(0x8672d6a414b9cf3f), W(0x4a6ce1298057fc75),
+     W(0x8f7f130a83552b9e)},
+    {W(0x3c0128690e5b3e39), W(0x1790ea967c292103), W(0x14eaf9d47d89f87b),
+     W(0xec7030d930ebf7c4)},
+    0
+  },
+  {
+    {W(0x8cc35f89c2ab7648), W(0xaf6388c20172452c), W(0x9b4fa1417aa9910d),
+     W(0x1ab8ce7205e553d0)},
+    {W(0xc0afbe5e3a1078e3), W(0xa8d915f4568bdc8e), W(0xa0ddfc4a9453110b),
+     W(0xd336861c26d87e08)},
+    0
+  },
+  {
+    {W(0x1a613a47f1e046a6), W(0xb3e8ade30335dcfd), W(0x202a0979839e9d99),
+     W(0x84ff0da43fa2a786)},
+    {W(0x5524dd618760f2a7), W(0xb8687c4196fb1db7), W(0x76f2bd48def6145e),
+     W(0x541e7e05f6c5735f)},
+    0
+  },
+  {
+    {W(0x13a31b5690b72de6), W(0x36c978763dc73b43), W(0x1a358a1696bb6c91),
+     W(0xffeda0073d591c86)},
+    {W(0xb90c4d3b36d14928), W(0xf700c29266ad5729), W(0xac5cba7cd8b9513c),
+     W(0x99730d05a8cedf23)},
+    0
+  },
+  {
+    {W(0xda713c20e6800661), W(0x42a4e6bd9c5b70f8), W(0x1e91488ef5d29516),
+     W(0x6f5e3745b17ed8c2)},
+    {W(0x89df5d215abb6e69), W(0x3d75275eb6360e02), W(0x51c8ce06a820cc52),
+     W(0x8c388da021371e30)},
+    0
+  },
+  {
+    {W(0x9ae4cf02cebee761), W(0x0f2430d8ed0a47f1), W(0x29a267f72aa922f3),
+     W(0x78e2ff027a610670)},
+    {W(0x04884c3dc571a8e7), W(0xac8140af68bf15b0), W(0xf1ad60ed0134f861),
+     W(0xf59b6a0f62bed74a)},
+    0
+  },
+  {
+    {W(0x4b4a5b9b7e228425), W(0x21570ee703c85650), W(0x513ec90f277788a2),
+     W(0xb0a277896d0ff22d)},
+    {W(0xb5cc32d60293ec2d), W(0x73671ccdaf99b729), W(0x486fcf241d40fbbf),
+     W(0x1b78fd59d81f0c8c)},
+    0
+  },
+  {
+    {W(0xf714ff108c52740d), W(0x119ca1532b095607), W(0x2af597246952a575),
+     W(0x4257a4ba6b4acc1e)},
+    {W(0x9e097f47c939899b), W(0xbf6026b473ffd046), W(0x6f9cf75254fb4258),
+     W(0x0e50de6b56f4ef81)},
+    0
+  },
+  {
+    {W(0xb81e6965bffa6060), W(0xf1bf96b878086520), W(0x55ba2df024335ad1),
+     W(0xd9ae43609d404933)},
+    {W(0x93ab450a2178fcee), W(0x03dc5b5c6255a989), W(0x05e39862f30fcc09),
+     W(0xdf9568df7b565615)},
+    0
+  },
+  {
+    {W(0x8265839b78209282), W(0xe2b6dc8c975995c9), W(0xd716834b928e552c),
+     W(0x4304405ed578e6c7)},
+    {W(0x13e12ff433c125c8), W(0x415ab1f67529a337), W(0x538314f62ccd59da),
+     W(0x9d9a5aacf951f240)},
+    0
+  },
+  {
+    {W(0x8e7aaa4b3655cdb7), W(0x856432ed3cb99d9d), W(0x4cdfa8b9e6927f75),
+     W(0xc651eb1e5d431de8)},
+    {W(0x13620134b5678219), W(0x54b3756d796dd962), W(0x38efba9cc17ba517),
+     W(0x43ea2ea97a3c6e4a)},
+    0
+  },
+  {
+    {W(0xdf857b109a045b2d), W(0x469a44b8549e2c16), W(0xc758b56774980288),
+     W(0xa012a1bcb00ffaa5)},
+    {W(0xa1b8a7a652386b12), W(0xa8cc8417d31f1025), W(0x7f8f07bc93f4f765),
+     W(0x2597c0ccb4fc9684)},
+    0
+  },
+  {
+    {W(0xa75eab7f24d7e5b9), W(0x60ca0e0e240c4365), W(0x352ef74b2d2a9cb0),
+     W(0x267a3fc609a86e97)},
+    {W(0xaef30f4ba9515919), W(0x2117cd9ffca556d2), W(0x0ac0a4679198cbc7),
+     W(0xb1e8c5b5a7b74bd7)},
+    0
+  },
+  {
+    {W(0xf7f7ae54edbb0cf1), W(0x4c77aafbba880d3a), W(0x9b51b93e2c2336d9),
+     W(0x9281c7ae88c7f71c)},
+    {W(0x570b0154bb66d0dc), W(0x4502f60627a3e0b6), W(0x1ab1b7996fb689e4),
+     W(0x2f706b91dbdd4b26)},
+    0
+  },
+  {
+    {W(0xd6ef3fc685939bab), W(0x20627f6a73e761b4), W(0x64f567602ff97164),
+     W(0xb5fba4c080b04f38)},
+    {W(0x0e8d138cd22a7b99), W(0x381a9ee926748935), W(0x7c65d58fc445ca37),
+     W(0xf727d3ffbfe23101)},
+    0
+  },
+  {
+    {W(0x46e68313ac973836), W(0x6e9fbce62e501d2d), W(0x42a10f9839e7b61b),
+     W(0x51b91480d7ac336b)},
+    {W(0x0178780e4b15ae85), W(0xe1f1ae5d9365d69a), W(0xb763e1dd10249d53),
+     W(0xabc6cf0ecfb9902e)},
+    0
+  },
+  {
+    {W(0xff0be74e22a127d5), W(0x54c79c703ca92089), W(0x6085d08ba625974d),
+     W(0x874d9b761513815c)},
+    {W(0x9247dc670b0dc043), W(0x0e8321e5b70dcbba), W(0xe8a73146d2d96145),
+     W(0xaf0e8d21513ada38)},
+    0
+  },
+  {
+    {W(0x0dc457c8c6201c15), W(0xcc55aaaf939ee66e), W(0xfc5c336305cb80d5),
+     W(0x72dd9eb1de53c822)},
+    {W(0x2439a87be66fd2f4), W(0x890b40e44b0bb44c), W(0x6895ab3686b68b34),
+     W(0xfbb4c7240a01d57b)},
+    0
+  },
+  {
+    {W(0xd52c4981642efcfb), W(0x1cd938b9db8ba021), W(0x4b95675f54408c87),
+     W(0x8ff5d80d17293188)},
+    {W(0xce988659afdb86e2), W(0xbdf253db211f7996), W(0xcdfe312ec0ab1d97),
+     W(0xb6083ce3f7f19170)},
+    0
+  },
+  {
+    {W(0x270c251dbb53220e), W(0x59f715e9c06e34b4), W(0x8151462231a00181),
+     W(0x34a8b3c3095d0845)},
+    {W(0x88a81c06b006a0b9), W(0x3deae1e11cfbeb05), W(0xd78145d89087286b),
+     W(0xc8e7272dbc565554)},
+    0
+  },
+  {
+    {W(0xdeab72039c273af6), W(0x956db3055949d5d7), W(0x6e24bc23649751ad),
+     W(0x3cb82e93a81866ac)},
+    {W(0xf0b1f99c052447eb), W(0x2b8d49bb19175a85), W(0xd8e0d944fa7ababc),
+     W(0x828ed64314f6202a)},
+    0
+  },
+  {
+    {W(0xa604847d6fd1b9ff), W(0xaba82a298b0bcac9), W(0x83718cf5015290e8),
+     W(0x1bbf4733091a36a4)},
+    {W(0xaae83384f94b2b92), W(0x5ef340ad3c9e57e2), W(0xbb85da007d67dad1),
+     W(0x2985e9d49c794677)},
+    0
+  },
+  {
+    {W(0x72068616003c0ac7), W(0x64e84a391e23a8cd), W(0x2a277625aa140215),
+     W(0x46f18a0e1b2aad7e)},
+    {W(0xfc62f207d0480c8c), W(0x7a238d631166677b), W(0x318f4240a4575cbe),
+     W(0x94811a4f63b9e3d9)},
+    0
+  },
+  {
+    {W(0xed0c5ea33cf5dd9a), W(0x850c255d5f233d12), W(0x5ee78f70a8a8280d),
+     W(0x03f42d9342774e2f)},
+    {W(0x2ed1227b60cf72e7), W(0xef69becaa0c75dc7), W(0x95ef0e9734bf5958),
+     W(0x8730a4d2e172ba6a)},
+    0
+  },
+  {
+    {W(0x5b17f53372508d33), W(0xcad28473a14b8917), W(0x3cd4fcc6cfc9e7d5),
+     W(0x614a87f317446060)},
+    {W(0x1428f917957e6c85), W(0xb741db9ab7435f4d), W(0x0f205abad646c27c),
+     W(0x57aee76f876ce2b8)},
+    0
+  },
+  {
+    {W(0x1620ddb158bf6e61), W(0xc0d16e37aea520a2), W(0x292f9ff1ac9cdaa1),
+     W(0xa000096766e4b607)},
+    {W(0x6c57ced0769c720e), W(0x9db27e4ace56db6b), W(0xe8a70cb31d03b11b),
+     W(0xfc72f5a8d84aec5c)},
+    0
+  },
+  {
+    {W(0xa1f62191b46164df), W(0x7ed851b070f786af), W(0x669a4de44afb7129),
+     W(0x7e16b0e0efe1c7b6)},
+    {W(0xf1b055b845bbd7a0), W(0x31ba72134b0df4e3), W(0x6b2d2551e8a970f2),
+     W(0x9c419976f66d5048)},
+    0
+  },
+  {
+    {W(0x8dbbaeabc674605b), W(0x402cebd6723dce87), W(0x85eebce5144d7cfa),
+     W(0xf4bef109e811b352)},
+    {W(0xa767a8376c0d9601), W(0x2c76ee9e58a01f46), W(0x8cae0cc02009effa),
+     W(0x2325413a938c75c4)},
+    0
+  },
+  {
+    {W(0xc5c4ac22baeb2261), W(0xef6272c8b1b0862b), W(0xad36d3c43645a48c),
+     W(0x779a918ac81714ee)},
+    {W(0x99eecd43c2010c5e), W(0x409a9986ece52f68), W(0x45ca7c996741cb57),
+     W(0x0b76e005a59b9b5e)},
+    0
+  },
+  {
+    {W(0x5579a1961a86d71b), W(0x6901f2d32e8dcf4d), W(0x32f3d46b6b4e6498),
+     W(0x929469f0927db0a7)},
+    {W(0x6fa13ae1b2b73241), W(0x0e32c93d24381650), W(0xad7bc7472fe122b9),
+     W(0x790faedeb4961ec0)},
+    0
+  },
+  {
+    {W(0x0039b816d21c8f8e), W(0x47c368de5a28bbed), W(0x2f5f34451089121e),
+     W(0xde0af8fa730401a0)},
+    {W(0x109a9d2ab68ec1c7), W(0x29a3b4b308f15117), W(0xdef2c432cdebd90c),
+     W(0xc8d111e4ac3852ed)},
+    0
+  },
+  {
+    {W(0x1e7b398d366d50de), W(0x6b2a0a948b4aee5b), W(0x01cf8c4127404805),
+     W(0x2dd58ae8348dd3bd)},
+    {W(0xe491e4f96414b6ed), W(0xeb951d91f2d055c8), W(0xec9bf4593430bcc6),
+     W(0xbce360ccf8634439)},
+    0
+  },
+  {
+    {W(0x94bd1f859320074e), W(0x7f00289bf255d61f), W(0x24a7e7ac48d075f1),
+     W(0x72c46b750738156c)},
+    {W(0xed55a4e4b0fab5e0), W(0x44bcd7081994057a), W(0x65206954cffc1ac9),
+     W(0x41410ee033fb4f40)},
+    0
+  },
+  {
+    {W(0x04ce50253f43a4f0), W(0x7419f1a92930911f), W(0xf48796476ca67ba7),
+     W(0xe4fcaf019cbe9983)},
+    {W(0xa837974adc9fd510), W(0xbeead4f22d6ba608), W(0xc9556689d883026a),
+     W(0xd66689e8b66ec0ad)},
+    0
+  },
+  {
+    {W(0xd679ecd17319790a), W(0x6d9238aa1eb3bee4), W(0xd5a35c53200ba06f),
+     W(0xe844229d544faf27)},
+    {W(0x58d91f02f7b463b2), W(0xb5d0826a32c69ac8), W(0xa7a9e45828a174ef),
+     W(0xc59b801e661a952f)},
+    0
+  },
+  {
+    {W(0x16db0f81248b8ad5), W(0x4abb67f2b2309497), W(0xbbc3f3bef63b7d5e),
+     W(0xf26273213ce6be2e)},
+    {W(0xff59e96797bdafa4), W(0x86cfc85033b36f66), W(0xefc1fafdfee89e95),
+     W(0x08a6769d9baf2be0)},
+    0
+  },
+  {
+    {W(0xcd6432456732a7d2), W(0xb6465399276785ec), W(0xce0c1a82af13d4ce),
+     W(0xc21d4cac0f782cde)},
+    {W(0xe198b5afce0a2e50), W(0x247e74893f83a54b), W(0xbe80812c44d7f585),
+     W(0x938997ef0a846f90)},
+    0
+  },
+  {
+    {W(0xf8f792de866a1f2e), W(0x397471e76db04ecf), W(0x9c81da19dfe053dc),
+     W(0x42aed1b89a2f2dfe)},
+    {W(0x45f1bbca045ec593), W(0xdf577ba1a5210fc6), W(0x183eaac5e515c2ff),
+     W(0x0d5d2b2a37476f88)},
+    0
+  },
+  {
+    {W(0x268deb1755882dfd), W(0x059457ad2805415d), W(0x079c8dda8c481ca3),
+     W(0x91fcdc8511d34bf7)},
+    {W(0xa338f11b7b9b2316), W(0x71fae02c164d1348), W(0xfa58287d03aaf859),
+     W(0x6c9a5f8bcfcb5a97)},
+    0
+  },
+  {
+    {W(0x977d0b02f4e077d9), W(0x66c4cac9dd3d2437), W(0x8d66f4b81ca2102b),
+     W(0xb8e8f6718be8fff2)},
+    {W(0x903cc76ef850a105), W(0xc0817cf29503f154), W(0x445e7cc3fc0dc587),
+     W(0x6dd93627e8aebc58)},
+    0
+  },
+  {
+    {W(0x01356e7d8fa92582), W(0xd21d7cd2f3d757db), W(0x970d5433e840bbe8),
+     W(0xed6571a17b668126)},
+    {W(0x5c36bd68129d9e2b), W(0xdb59dc64540f2acf), W(0xd287cc83e14cc97c),
+     W(0x657894cabf3cdcdc)},
+    0
+  },
+  {
+    {W(0x1591c1e5606645c8), W(0xb8c48af0af436d48), W(0xca6b120df46526e9),
+     W(0xa330bd28e14963f3)},
+    {W(0x3888247dc6181dbf), W(0x549b80266bbdc594), W(0x4820f0f4d1a4215d),
+     W(0xd8414f80e08e7d7f)},
+    0
+  },
+  {
+    {W(0xbc2e30f4722895f6), W(0x0ad4793d8cf89b5f), W(0xdbaa77062477dfcf),
+     W(0x78950c9c30bdf518)},
+    {W(0x821cccfbc2c338f7), W(0xe24a9f2db95e836d), W(0xe9f336c89c80358b),
+     W(0x693df74861e4b045)},
+    0
+  },
+  {
+    {W(0xf04705662bcd202d), W(0x7d6a19aafa446888), W(0x93b6a5af14a1bd6d),
+     W(0xe2591aa345b47d38)},
+    {W(0x8118089c398b489d), W(0x4d1f0446be437443), W(0x243135196d9f2eb3),
+     W(0x5204746e73faf467)},
+    0
+  },
+  {
+    {W(0x8d72e3d7cd821c87), W(0x12afb5d19b7fd36d), W(0xc4af605b6f7de811),
+     W(0xb1f4b8336aacb159)},
+    {W(0x74b56fd8bb621761), W(0x1f26c955f045a58f), W(0x91f3cab962fec96d),
+     W(0x1007d6a5938b3a7f)},
+    0
+  },
+  {
+    {W(0x802537a8271483b7), W(0x7ffb6192b6c3f036), W(0x1fa7e944b47e19c5),
+     W(0xc25c72fe9e2cb3ff)},
+    {W(0xcaa0264a857775b8), W(0xa7ccafd173d8e192), W(0x0525f66dfde56f8c),
+     W(0xb9a990af7b78b238)},
+    0
+  },
+  {
+    {W(0x81055775a762b500), W(0x2044d4106ca3959b), W(0xc42bf26c95eb90ed),
+     W(0x9bae24eb55aed151)},
+    {W(0x79d39db98c0ca6f4), W(0x584c7590649ca3cb), W(0x3ec195534bab8729),
+     W(0x5e76634b27299623)},
+    0
+  },
+  {
+    {W(0x9daca5a22cf31dab), W(0x60921b5c04e8884b), W(0x7116a5f0f53113fb),
+     W(0x2b75fbb3d6f216a9)},
+    {W(0xfe5089aaf6ce3154), W(0x1fd99dc91a567253), W(0x1942f86582f74f3c),
+     W(0xe9c491c014b51682)},
+    0
+  },
+  {
+    {W(0x2917234aa27c85db), W(0x8511737174fc8062), W(0xa1fb1d8efb1a6f43),
+     W(0x09fafcd0a087cc8d)},
+    {W(0x46511b7349499ba1), W(0xda5fedd50bc6eecf), W(0x2c5ee45c8416803a),
+     W(0x5c17084170a0fbcd)},
+    0
+  },
+  {
+    {W(0xf16290e1aa532615), W(0xe4fa817c4e90677c), W(0x7c00b9c568c617d6),
+     W(0x84a964c0b160a536)},
+    {W(0x0134260e1d1e11ef), W(0x4f7949fc7d72465e), W(0x6aed7dadb0f439f4),
+     W(0xda8d0c94be67fb75)},
+    0
+  },
+  {
+    {W(0x9934a7d0ef26178f), W(0x7ebbdf0bd1eecc2b), W(0x903378a1ca5e7856),
+     W(0xdc726009eefb70b8)},
+    {W(0x7ffb6615418ff0e8), W(0xac9dc752aa719603), W(0x17156269bfb46f4e),
+     W(0x319af0cb6c7908e9)},
+    0
+  },
+  {
+    {W(0x24c96a9c0b2ffc82), W(0x03526e3ae18c3369), W(0x623dd48e4f86834d),
+     W(0x86ad1a4ebd03414d)},
+    {W(0x8114543e076935d0), W(0xac4ac56e603f80c9), W(0x64f26cb06e1a9f49),
+     W(0xb0b239cd4a46e4d3)},
+    0
+  },
+  {
+    {W(0x29aea4baf546b813), W(0xe33755636fe5a6d9), W(0xeb07f568f9212067),
+     W(0xd2174e1f81cf9685)},
+    {W(0x5cb8fa8a4e10a859), W(0x1080773e52d6a77e), W(0x62ccd52e4ec9f418),
+     W(0x1e2aa75c3dd196ed)},
+    0
+  },
+  {
+    {W(0x2e99f2430b09ca86), W(0x074da34929f9c495), W(0xb01b7aaa91ef7adf),
+     W(0x05e9970b9e870156)},
+    {W(0x7c452b62e91dd71d), W(0xea39ebb828e17a11), W(0x90b56363db13882b),
+     W(0x0382f928ac970753)},
+    0
+  },
+  {
+    {W(0x1cf8e14369d03370), W(0xd7bf9f2530784d0e), W(0xc7fbd92c484bcec9),
+     W(0x1f27f1d0d7d82717)},
+    {W(0x454c73f9ac8ba942), W(0xbd46e68d6d736bf1), W(0xdadcc441be7e8dff),
+     W(0xeccb149e6fc91b34)},
+    0
+  },
+  {
+    {W(0x203c155f97acdb53), W(0x657f4da73e05eb88), W(0x8c280b0d3aad540d),
+     W(0x2adee09587d26fdc)},
+    {W(0x2efbbfb8f22c4e90), W(0xb0edb439a61c8d8d), W(0x9cf1726c370ce89a),
+     W(0xf89146f7c1ec7760)},
+    0
+  },
+  {
+    {W(0x3e36b76c61c1853c), W(0x8eae21ed6ac08212), W(0xc6daafbac5b54922),
+     W(0xb1a3d53b68b3da4f)},
+    {W(0xf6fbf50b991fdea0), W(0x85cccc8f566be7a0), W(0x6fa77c8dae63a795),
+     W(0x9eb0b38b8dc530fa)},
+    0
+  },
+  {
+    {W(0x2fb030e9c6cb78d8), W(0xb23560401d254724), W(0x5fcefb2bc1ae64fc),
+     W(0x33513bac4d8616ac)},
+    {W(0x7a8b923001ed230d), W(0x14134a5cdcc30d2e), W(0x50e79b7f2ccaee9e),
+     W(0x25481c3ca34d0ff7)},
+    0
+  },
+  {
+    {W(0x5f5dd7036102a440), W(0x6f221b175c292afd), W(0x709a9d106341c70c),
+     W(0xd2e7ba7a48db6174)},
+    {W(0xd3d5db5417677a28), W(0x372689e3d328aaad), W(0x0ef45e71a2c2e7c5),
+     W(0x8054cee8295c2d73)},
+    0
+  },
+  {
+    {W(0xe6b24a8ca082b45c), W(0x8665977d6472b3be), W(0xb3bae5d1b7eaf971),
+     W(0x4065dc52f8bc073d)},
+    {W(0x33c16e86d24df7db), W(0x11bb3062bfc3a2b5), W(0x5d4c1be91ca66366),
+     W(0x25f67ad66eca5dba)},
+    0
+  },
+  {
+    {W(0xc7df04543ab37e61), W(0x5a2ca09a3ee852ec), W(0x7f474a9566c92e83),
+     W(0x7db67148c5172493)},
+    {W(0x4ffad5bd9a92d4d4), W(0x2456c70ae124d036), W(0x0cc79ebe1e0cf84e),
+     W(0x744591ae9687aafc)},
+    0
+  },
+  {
+    {W(0xc2f3e53775fb171b), W(0x7370873cc5dc43de), W(0x9c65edac08463995),
+     W(0x74b5fa8fee603b03)},
+    {W(0xdb8f419b6402e5e9), W(0x7907cf2125c1da10), W(0xf0dd91ab45e27d0c),
+     W(0x1b68267a7df0d256)},
+    0
+  },
+  {
+    {W(0x4cd93405f2107868), W(0x12a28e83354dd357), W(0xa67a2e5fb3a4988c),
+     W(0xa6710a7c2c3d959f)},
+    {W(0x4584b74e2cae2396), W(0xb87e7f5793364701), W(0xf0f8380cdb99a7c0),
+     W(0x4cde0779e0683143)},
+    0
+  },
+  {
+    {W(0x06ae0f2773e86933), W(0x72ad59752b97cd3c), W(0x6bf951e06829bbce),
+     W(0xe392304fbfa234e5)},
+    {W(0xf509953289464b1e), W(0x897dcd47622a26ec), W(0x75a42a75fe75def4),
+     W(0xe4afec76a3d6bbee)},
+    0
+  },
+  {
+    {W(0x71918939197c919e), W(0x429a03fa0a966da9), W(0xfd9a94524895a006),
+     W(0x4e714f5c07edd7b6)},
+    {W(0x66b12096566f9e21), W(0xb929dbd26c791c1b), W(0x04876a396ac64574),
+     W(0xd0613f1fad8de16f)},
+    0
+  },
+  {
+    {W(0x3bcac4eadf6992fa), W(0x122320fd4dcff126), W(0xeb9cb0cae83955a8),
+     W(0xdeee0a41eab9ef35)},
+    {W(0xbc7c70e319a93fe1), W(0xd9a8a4b95ad348ff), W(0x585f9d6c7639c6cb),
+     W(0x76563c43e475b807)},
+    0
+  },
+  {
+    {W(0x17533713d0874d0e), W(0xe6257dcaa0ff326f), W(0x3750def843e0bc7c),
+     W(0xbf01f9dff63d740d)},
+    {W(0x4206a077ceb40055), W(0x8ef9f22414165e26), W(0xc8e226854d3761d7),
+     W(0x3c8df56a92f75380)},
+    0
+  },
+  {
+    {W(0x6d6ac3930a1b09b4), W(0x374806dca2e71f88), W(0x07e29b430834b35e),
+     W(0xce9525e489929d8d)},
+    {W(0x3345450752f3235e), W(0xa366efabdb52bf12), W(0x05d0cc33be1cc549),
+     W(0xda60c4c09e0e8fc7)},
+    0
+  },
+  {
+    {W(0xfaebc8d443faa76a), W(0x0828ee89cb6fcfe6), W(0x0d8f0c2799461178),
+     W(0xe976943a9a93ec46)},
+    {W(0x4f9ebc7b4d53dde6), W(0x76de394afbdd6b45), W(0xfc68681a94870c90),
+     W(0x873660428cab16fa)},
+    0
+  },
+  {
+    {W(0xc6b96f7a497222dd), W(0xc952a028ccbcc262), W(0x10e5e48fc504c8c1),
+     W(0x50842c1383a1d840)},
+    {W(0x46b6286af3b5d71f), W(0xe2bcfd5cad32d7d6), W(0x887aeb0a3989006c),
+     W(0x62e1c9db2a475cc4)},
+    0
+  },
+  {
+    {W(0xc9e596122e8cbc06), W(0x3504dddcc04a4d6a), W(0x28392d59a17fb977),
+     W(0x8518c406d425184c)},
+    {W(0x206510b47107e901), W(0x1631fd8d9952b97d), W(0xf59b53227818b8fc),
+     W(0x8b8639a2760e29a3)},
+    0
+  },
+  {
+    {W(0x27533c536645d09b), W(0xceab88e72789cf86), W(0xf708635c2c0e9c53),
+     W(0xf2179474c44caa09)},
+    {W(0x15080d0199305603), W(0x29b1abc17ceeb3ab), W(0x8080c25e435c306c),
+     W(0x6c84fecc94e10ea7)},
+    0
+  },
+  {
+    {W(0x5b8889005c651441), W(0xcd2551df8022b75a), W(0x232fc33711a20199),
+     W(0xe5a74738a9b10efa)},
+    {W(0x1c17d5ecef645245), W(0xc1883bb1e5260620), W(0x758e3a422e8dd5df),
+     W(0x3e7a22c40392cf52)},
+    0
+  },
+  {
+    {W(0xca41ba56a3ef3d59), W(0xbc3bdf240539e169), W(0x29081d4b708ff846),
+     W(0x88503133b97ba0ef)},
+    {W(0x6a5a107662ddc188), W(0x47a24a4cae278848), W(0x3572d3523bebdc77),
+     W(0x0259d20b71ac8824)},
+    0
+  },
+  {
+    {W(0x45d5d68c18e8dbad), W(0x6564362211439ad7), W(0x6ac023d155b1dcfa),
+     W(0xace21b1efa8c8b23)},
+    {W(0xf80ba78a1b21f307), W(0x706e0c6bed1a23dd), W(0xfd9e28d0b2574dea),
+     W(0xd25e57a8077a918c)},
+    0
+  },
+  {
+    {W(0xe0e963be2ea19722), W(0x843527170a13eded), W(0xee36745a56a0c6c3),
+     W(0x66a7f71c1e7920bf)},
+    {W(0x858555b3ce363a9f), W(0xa304f474d291e1c2), W(0xdfdf0e7bd6504eeb),
+     W(0x98ce7be231c9fdfb)},
+    0
+  },
+  {
+    {W(0xd20290301d74045a), W(0x87c784efe580096c), W(0x9a8a7ac17889130f),
+     W(0x76644100acb6e655)},
+    {W(0xba9a7d25114d3543), W(0x3460f8988497ed0c), W(0x15500960220e7352),
+     W(0x0f845d7a9e61e502)},
+    0
+  },
+  {
+    {W(0x4c7af31d11377d10), W(0xc9167eafd4fc1660), W(0x46088fee10223733),
+     W(0xd926117ddfd178e4)},
+    {W(0x0823741b5cf99bc8), W(0x9b3946e8dc28101f), W(0x06c571b688bea5cf),
+     W(0x667c8eedcb3c9b9a)},
+    0
+  },
+  {
+    {W(0x78492430d6f4ba19), W(0xa221342734b6b77d), W(0x759510e3ca28215a),
+     W(0xb8ee312a3a6e9b76)},
+    {W(0x7f8ea27e512dbb15), W(0xa3e6656f36d289ec), W(0x92e729a0707823b7),
+     W(0xe30c658a1920f3db)},
+    0
+  },
+  {
+    {W(0x4cb0e1593d41bce4), W(0xe19aef66f4c82e82), W(0x0208627366299ba9),
+     W(0xaca173e7ca42364a)},
+    {W(0x8ed2468994e1a04a), W(0x3cd407ecba25813d), W(0x00adfbf90c017078),
+     W(0x2f8a9548490e5718)},
+    0
+  },
+  {
+    {W(0x7f7f37390eff25c5), W(0x0e5330d6f26efc05), W(0x2b9dfdf958e88d78),
+     W(0x6c807eb3f7d421ab)},
+    {W(0xbd84c9251d7b4410), W(0x882440aa24ec71c1), W(0x9454486ed88187d2),
+     W(0x901fd91e1f7c7f73)},
+    0
+  },
+  {
+    {W(0xd2577fa27a9ec753), W(0x1a2d8dd9e6e87720), W(0x79f108dd38dd3446),
+     W(0xb30e1556daa45da7)},
+    {W(0xa7db58cc6495f476), W(0x0b1c5fb4f7dd6977), W(0xbfe3a189fcafe0b9),
+     W(0xa954a46b82bc87f5)},
+    0
+  },
+  {
+    {W(0x88d2dcdd4a7ac14b), W(0xe8db4999aa6deaa0), W(0x93985416041769e3),
+     W(0x6f4fa5c31b3e83ac)},
+    {W(0xcab941796a1b1320), W(0x6f6c29953ca06d53), W(0x8ba9638937c752e4),
+     W(0x19caf5c84a0c5f2c)},
+    0
+  },
+  {
+    {W(0x77ca815418f910c0), W(0xedc724aac742276f), W(0x430fe52456417c2d),
+     W(0x5bdf540240b1c06f)},
+    {W(0x136698125c8b3b5b), W(0xd2661dc06ff218e7), W(0x893887c872f12df1),
+     W(0x0f4ee968f3369ad7)},
+    0
+  },
+  {
+    {W(0xdbb921e6647c797b), W(0xd2640da776f8fa47), W(0xbd639fba251d6bd8),
+     W(0x92fbdbdcafe1e5fa)},
+    {W(0x19261f7261cc6b54), W(0x495478d53077dea0), W(0xac01ece1a8a59120),
+     W(0x0bd8537183ff3757)},
+    0
+  },
+  {
+    {W(0xbecef9a001b66d6b), W(0x4265bd5a20934b44), W(0x375d17704c4e5779),
+     W(0x7aa3ecbf25487a61)},
+    {W(0x5e3406a080558b5f), W(0xf50f06cc2bbd1936), W(0x0c23d50bc2b9dce7),
+     W(0x231b15df41c3fdb5)},
+    0
+  },
+  {
+    {W(0xabf09c15ab653dd6), W(0x0a0975dfe55b06c9), W(0x5aebaae98ee8d545),
+     W(0x5d4e6d9d25ab88d2)},
+    {W(0x4289e2814c9f50df), W(0x0bba8032c0f28773), W(0xf1fcacd3474712c0),
+     W(0x6c33a1cdc2dada8c)},
+    0
+  },
+  {
+    {W(0xc323403866820d6d), W(0x19909216c53e7bf8), W(0x51371300b1054b59),
+     W(0x87a816b0fcbafdd1)},
+    {W(0x8132052cdf066740), W(0x9754f9cb8993ad69), W(0x2c46615ae5427576),
+     W(0x057d7dc7235bd700)},
+    0
+  },
+  {
+    {W(0xa150ab622ea5a3a9), W(0x4bc953996e2bcb40), W(0x81655dc57f059076),
+     W(0x4ac83d7f37507aaa)},
+    {W(0xa1be8dfb70516b95), W(0x68717199e19b0096), W(0x24dcd88fd00ea9b5),
+     W(0x4600de976dfb4f53)},
+    0
+  },
+  {
+    {W(0x94fa87b6aa5e4496), W(0x932d51c1ae66ffad), W(0xf6eefb53f0a76958),
+     W(0x03ebe08d32d8c47c)},
+    {W(0x8dda04beba44e4ee), W(0x955c3a35a713fc7e), W(0x3ba2d662351cee7c),
+     W(0xde6867a124d2648a)},
+    0
+  },
+  {
+    {W(0x71e0fbc95602ef20), W(0x58c459aa4fa9ac5d), W(0x35a77b0622ab05d1),
+     W(0x5d2c1bc65ee254a7)},
+    {W(0x9a66cb6cfd11cbba), W(0x461a1e01bbfc3807), W(0xf796e4ff6c8c829d),
+     W(0x85233b7f916ad75c)},
+    0
+  },
+  {
+    {W(0x527c8e0aab2302af), W(0xf0a46f7ba022af27), W(0x7a99dc452d4c0b59),
+     W(0xeb1e66fc3a6df635)},
+    {W(0x2cbab3ac09c90882), W(0x968ac3fa03829c84), W(0x35c7852439924621),
+     W(0x65e2d7db2204ce47)},
+    0
+  },
+  {
+    {W(0xf60ff5a62e3ff9a8), W(0xc96c89b2a47b0ec3), W(0xaafba0bbeeab82d5),
+     W(0x9034f963119de11a)},
+    {W(0x330121d7ceb76811), W(0x01e479e4168d831a), W(0xd7f6e1529938c3b3),
+     W(0x9ff2fd6a32908348)},
+    0
+  },
+  {
+    {W(0xc294f9cc436b2527), W(0x4598cee010844d06), W(0x2e8acc2032d0f1d6),
+     W(0x47279df043c12f4a)},
+    {W(0x49dbbfd995bc4884), W(0x8371fafbe83fbe06), W(0x378efcc32704e35f),
+     W(0xa38fd57ef6dfc27a)},
+    0
+  },
+  {
+    {W(0xfcc841882dcc713a), W(0xcf927ad9a255271d), W(0x5943b072a660f791),
+     W(0x40b1f76e077e1c60)},
+    {W(0x6025ace76471309b), W(0x2e21a216780f22a1), W(0xfc37c0d3880033ce),
+     W(0xfeb45014376973eb)},
+    0
+  },
+  {
+    {W(0xa35704d797e8aede), W(0x9d83af24a0821db8), W(0xeb04ad4ee437f004),
+     W(0x670737e9067e23c9)},
+    {W(0x3f8cf785ee08ec57), W(0xfe31d58cd2b2ff02), W(0xb4ceddee35e4f3a9),
+     W(0x8aa8f1219c728396)},
+    0
+  },
+  {
+    {W(0x3ac7b5e229d167d4), W(0xed6b211da4d4a902), W(0x0f870a448a7c0751),
+     W(0x33fb8a57ef3513aa)},
+    {W(0x99a3f848a7587990), W(0xde459e51074801e1), W(0xd3c67afde3600917),
+     W(0xbaebb5062105066a)},
+    0
+  },
+  {
+    {W(0xa9e00a074e9a2458), W(0xb7c20bca084b5f31), W(0x0f4b9231fa57eb95),
+     W(0x93988eb89fdd4829)},
+    {W(0x4602ec5cbe4ba673), W(0x44f1bd60c5fc0eea), W(0x08991183c3c26646),
+     W(0x74912b8c05e8d990)},
+    0
+  },
+  {
+    {W(0xd14fd84daee1a0aa), W(0xd01ae50abf89280d), W(0x32810c866129ea4a),
+     W(0xa9f5da0a6b7c45f4)},
+    {W(0x49389da79beb6477), W(0x0a100e26425763db), W(0xd368dd393e8d9101),
+     W(0x27f255e85f2581fc)},
+    0
+  },
+  {
+    {W(0xcd7c9baceffe3a89), W(0x4375ffa39fbbe6ad), W(0x2c37423cd16cd213),
+     W(0x03933337d19d7953)},
+    {W(0x664e0f20371ad98b), W(0x984de66dbd3d9599), W(0x796e04f6b440b8c9),
+     W(0x2eb9e2c13a68432d)},
+    0
+  },
+  {
+    {W(0xc783690c781249c2), W(0xc84d31ea85dd0b9a), W(0x59cf45c9a48dfce7),
+     W(0x6281b01f652421c3)},
+    {W(0xe0ace29f0b599a5a), W(0x427ad7c409c724bd), W(0x81f31f0c8ca4a6f4),
+     W(0xda25eb631b7f8d6e)},
+    0
+  },
+  {
+    {W(0x64facfbfbfd748e1), W(0xecbe558ef83d767d), W(0xdc1e9766d9e10b75),
+     W(0x44e7407670293cd0)},
+    {W(0x7c3a2ba6124f49c5), W(0x479caaf05808db87), W(0xf85746aff047df4a),
+     W(0x36917158cb645387)},
+    0
+  },
+  {
+    {W(0xd86ca36649a90ed1), W(0x2c3afe5ddeca2bdc), W(0xea7950026e3f9996),
+     W(0x72385621e2519129)},
+    {W(0xa10323cf1ccebe85), W(0x303da7a5dab82409), W(0x49937afc61ac1e02),
+     W(0xbc14bf98bdef0225)},
+    0
+  },
+  {
+    {W(0x489c6badc8fcf308), W(0x0de94b467c290486), W(0xcfac23ec9c40e429),
+     W(0x69a8120d106f9eb4)},
+    {W(0xba801b359222da02), W(0x6bd22c71036157c8), W(0x30356aac94eb8062),
+     W(0x4c02312a77fe41bf)},
+    0
+  },
+  {
+    {W(0xd685f570c4116643), W(0x936385bbc5ec01ba), W(0x4e07937f47db637a),
+     W(0xbcb7f903faecd1d6)},
+    {W(0x6363b92955cf606a), W(0x30160979e92ee055), W(0xb70c7da293c785ed),
+     W(0x6184e4454144b8cc)},
+    0
+  },
+  {
+    {W(0x34462704ea190b7d), W(0xdffccc5f41b2f1d7), W(0x2e1b19eb3c89da01),
+     W(0x74522d9ecd177d63)},
+    {W(0xb457ffdfd04d9d04), W(0xfdf06a435ccd04b3), W(0x68147e281e7cdb94),
+     W(0xc3167997fff79cce)},
+    0
+  },
+  {
+    {W(0x94b8c051d3801f5c), W(0xfc8aaec260dfb14f), W(0x1738729b917ab790),
+     W(0x6c00cdd7c7f3bded)},
+    {W(0x34a5c6db282ac25e), W(0x445172fb798a4c46), W(0x7da9137aee2fa730),
+     W(0x01df4bd98c3c27d9)},
+    0
+  },
+  {
+    {W(0x0400f56c433955a0), W(0x8968011a9d237a96), W(0xd8b27c2bf462ff71),
+     W(0x27a70ea45a75af8b)},
+    {W(0x372cb50bc6912c8b), W(0x8826212dd87e0b63), W(0x4a80f1a4788e0092),
+     W(0x864ac23b009ba862)},
+    0
+  },
+  {
+    {W(0xb08a9fc1960239ae), W(0xfb1ad214fe345c71), W(0x442f38bca2192dd1),
+     W(0x5aabe896e567111f)},
+    {W(0x19151defaf252e82), W(0x6a0cda0ee86e0fa7), W(0x799dd56d4ef3e8f8),
+     W(0xf4202de283c67f54)},
+    0
+  },
+  {
+    {W(0xa400e97e14eb22d4), W(0x2fecc8fcf490a2b2), W(0x7264c2971ce9171d),
+     W(0xd5dafbf5c3e38c3e)},
+    {W(0x0eb250de51c837ff), W(0x0aea2e495870329c), W(0xe4921e57aae12b6d),
+     W(0x2f0103f1a4de35de)},
+    0
+  },
+  {
+    {W(0x5ec299daf632fa24), W(0x0e55c0d7ee54907a), W(0x62b922bf8670db59),
+     W(0x2e8aff01cbda5dc1)},
+    {W(0xe8d5a8891d7a2a51), W(0x920a7c02d379f78d), W(0x66810d132f29add1),
+     W(0x720e93ed4d84d169)},
+    0
+  },
+  {
+    {W(0x831563bb796d796e), W(0x6e5cb3caa1ac8344), W(0xf001d7de095b9d65),
+     W(0x238a571e9830af2d)},
+    {W(0x019c414abbf1fdb9), W(0x1536d0d89aa7c62e), W(0xb0f89000884108d1),
+     W(0xff885dcd25577f5c)},
+    0
+  },
+  {
+    {W(0xb99f43c5dfe289f8), W(0xffb6e4e65525cd8b), W(0x49f9a00141d84b0a),
+     W(0x2992557039b64803)},
+    {W(0x0d9dd5ca2e9fc1be), W(0x0ae634cb129ff7a3), W(0x908e96d566b35033),
+     W(0xb6a9cc7ba9da358a)},
+    0
+  },
+  {
+    {W(0x81aeb34f902cb610), W(0x3038872e64883eca), W(0x91a6ecbf995ba795),
+     W(0x8d894a9ab0ff406f)},
+    {W(0xc86e86ff7332d6f4), W(0x69186bd6c7bfa5f5), W(0x30ad389a8e213871),
+     W(0x643b85b232536e7c)},
+    0
+  },
+  {
+    {W(0x607d26a3def101d7), W(0xa286865ea4030a57), W(0x88fe597eccc68288),
+     W(0xdd9e9a250f0d48d7)},
+    {W(0x31503f8c38590371), W(0xc2685e9eb2471881), W(0x2bedcf495325f858),
+     W(0xf2f7a8567ee29da7)},
+    0
+  },
+  {
+    {W(0x235cb693648f5d5d), W(0x463f18976d64f0a0), W(0x16ba02b59a85e95f),
+     W(0x43a6598398673de4)},
+    {W(0xa3acc7cbfaf445bd), W(0xb658dee266e610b6), W(0x7a8c13cf1b741190),
+     W(0xb39cc176e064e371)},
+    0
+  },
+  {
+    {W(0x1cddd588a10b6e0d), W(0xa0fab99c8f744b14), W(0xb3fc886c5522e343),
+     W(0xa2d83ce3897f7428)},
+    {W(0xd12544ff9d5da214), W(0xfc16585aa5e01a76), W(0xdf2257ecb2350c17),
+     W(0x20fee84ef47bb365)},
+    0
+  },
+  {
+    {W(0x595d08de0f597bf7), W(0x7908c616da858238), W(0x7a0aeede5cb09d3c),
+     W(0x13432dfd11f13183)},
+    {W(0xc1174982bb99722b), W(0xdcd14a9d1c5c6b47), W(0xe4ab550b5565c782),
+     W(0x0f45b6e85fa0fa63)},
+    0
+  },
+  {
+    {W(0x6672f2fc4eb83822), W(0x8436fe69782ad0ed), W(0x41b68ebcfae9b4e2),
+     W(0xe9e5a2bf2c2413de)},
+    {W(0xd4a4653939070ae6), W(0x5ea8ef40afe5932a), W(0xc954ecf3ea5cccbb),
+     W(0x10c957c652a95ba8)},
+    0
+  },
+  {
+    {W(0xd377f523fabe9dd9), W(0xcb8c9d185ca3cc31), W(0xed269c46d989de93),
+     W(0x99712cac9d60107a)},
+    {W(0x19c0dc0be0b59c12), W(0xaa4ae14aad115387), W(0xbde31537077d2a90),
+     W(0x2e889d520a5c0c8c)},
+    0
+  },
+  {
+    {W(0x66c1bac7959e286a), W(0x7bcc3ddc85e064db), W(0x498389df004aedd8),
+     W(0xf1396afddb1f5764)},
+    {W(0x289c111689488dc7), W(0x279773d837e24e82), W(0x273c6f419dedc3b7),
+     W(0x2ebcbafa4d7e1295)},
+    0
+  },
+  {
+    {W(0xb8b479e4ad9a3426), W(0x949d31e5eac5cae9), W(0x5c8327dfed3e6acb),
+     W(0xd514191e48cdc446)},
+    {W(0xecdc67f585fccd0b), W(0xbe3bf7ed6123e406), W(0x308ca254a186b827),
+     W(0xa11da9dd1d94114c)},
+    0
+  },
+  {
+    {W(0x8ab3a7f95a92e698), W(0xac3e25be4054787b), W(0xa38854f4c8377608),
+     W(0xbe3844c53e6a0818)},
+    {W(0xf8d9ccc486050b4e), W(0x36ea9e12c2aa26f8), W(0x12c43077f19722fa),
+     W(0xdd57eef4500ea5e6)},
+    0
+  },
+  {
+    {W(0xcda4be121eb460d8), W(0x7af4a109c25328bb), W(0xbf800a020b3872a3),
+     W(0xe7d1c0e08f7e20e1)},
+    {W(0xc388a1cc077addad), W(0x8560b6f3e7a886e9), W(0x96bbc6519bff234b),
+     W(0x9ae0dd81bca090e7)},
+    0
+  },
+  {
+    {W(0x3d07344d4728e24f), W(0x7ca76eaae4193bb5), W(0x6288b1ba86fc0960),
+     W(0x4e0d03d37949a6fa)},
+    {W(0xcb1b6c56cb79d64b), W(0x5404e092b28dc734), W(0x2c73d19182b2e81f),
+     W(0x6c898fac5727f5e4)},
+    0
+  },
+  {
+    {W(0xd616a30a7233cc86), W(0x0b95ba031d3c1c59), W(0x9478cd72f024576f),
+     W(0x5d67736c9eb514ba)},
+    {W(0xd13c2d392ee3c069), W(0xad5a2f619303d007), W(0xb7ce0b6b513e3a54),
+     W(0xf5ff40e4d708db26)},
+    0
+  },
+  {
+    {W(0x2a9cda717db7b784), W(0x8aa873e6fcdaac00), W(0x8d36a3d2be968d91),
+     W(0xaee0391e678b7019)},
+    {W(0x86a1459e2807a842), W(0x6ed7586e1362791c), W(0x77e58da7aa95ee02),
+     W(0x695749b95f1e104f)},
+    0
+  },
+  {
+    {W(0x34c08549a1820b7f), W(0xa9a8f78b02afd065), W(0x829f34b1275c616c),
+     W(0x1763b374c49cfe2a)},
+    {W(0x214afa74d1eb5621), W(0x9b1452b3a97682a0), W(0x692e7e1c4193b2a6),
+     W(0xaae7ac2dc8dbba4b)},
+    0
+  },
+  {
+    {W(0x775107cd9ce68a06), W(0xad56e78ee53bc39a), W(0xec16b096a51b741f),
+     W(0x39ff90590bed86c9)},
+    {W(0x091e5855e6936584), W(0x1d74c3b78869b570), W(0xcf58a1a29b009ac4),
+     W(0x7d5fe9f27d252778)},
+    0
+  },
+  {
+    {W(0x3b146346232a92db), W(0xda80628e4fed3804), W(0x28ff70184813b05f),
+     W(0xafc0dbcae873fe51)},
+    {W(0x828c99110fac79ba), W(0x3def65b2c0e368cb), W(0x3159cf35b31b8e1e),
+     W(0x0880bc829e203754)},
+    0
+  },
+  {
+    {W(0x103fb661ae62edb2), W(0x6ef9d7427fa6b0e3), W(0x6d90efc3d851088f),
+     W(0xbe80a81f530a94c2)},
+    {W(0x9c34760e9d4252e0), W(0xbc3a91e88abbbeec), W(0x8044559331492070),
+     W(0xb8c801b90afcb14d)},
+    0
+  },
+  {
+    {W(0x1be3bbf1568de3c2), W(0xcba80d54b80edc17), W(0xd12f54ea87a32a58),
+     W(0x45100c61ed5f1fdb)},
+    {W(0x2766cbfaf0c589ad), W(0xffbaf63f4727d514), W(0x58907296e0547405),
+     W(0x7a761bd6c26c892a)},
+    0
+  },
+  {
+    {W(0x3aa02a19e84a7178), W(0xc88ff0b97e39de7a), W(0xd0f6314cfd7fbe03),
+     W(0x347b69f3b6c9fdd0)},
+    {W(0x284a9b94911bda84), W(0x7726f2b26fe369a0), W(0xd640519a590ce8fa),
+     W(0x3ff3bfbfddc19236)},
+    0
+  },
+  {
+    {W(0x95a19a3ea2c193e5), W(0x4e22a8f18619df93), W(0x066a81e402e82cd5),
+     W(0xaff841bfaae753ba)},
+    {W(0x0caa1d5bdf8bce87), W(0xc750d01982c9fa00), W(0x4a22129ca9531693),
+     W(0xd6d169c16d1d2d53)},
+    0
+  },
+  {
+    {W(0xb3e9c87c0d0cfb79), W(0x377823a048473379), W(0x8737f2b3d7a57082),
+     W(0xc8b360729d28055a)},
+    {W(0x347dfd9f5fa8bbba), W(0x5208903083e9d4d5), W(0xe8f4117c469e5940),
+     W(0x0b8e98f9de387d79)},
+    0
+  },
+  {
+    {W(0xb5e93d457fae4fc6), W(0x2f1014c2f3dae18d), W(0x12c770e71e0ac5b6),
+     W(0xda210c1d9716c6e5)},
+    {W(0xa2145e77ee9c9657), W(0xf26ac2bd8f3333ed), W(0x9b04ccc709551d99),
+     W(0xb211b002e018f630)},
+    0
+  },
+  {
+    {W(0xbbc2938086759c63), W(0x2763425249f1d7c0), W(0x030f80ce7cda31e9),
+     W(0x24c1e54bf5abe868)},
+    {W(0x43e85508f3217af1), W(0xfd39f962aa62ab51), W(0x875a9f80fe87b146),
+     W(0xfc76fb02f775364e)},
+    0
+  },
+  {
+    {W(0xcf2c33ac7bcdecb0), W(0x0186d965d39f36a9), W(0x343f0e9ceff48386),
+     W(0x3faa322a15c7eac6)},
+    {W(0xda464a20c6548b25), W(0x5d54e4a89fa2d364), W(0x3ab89ca41d347b20),
+     W(0x77922efb37548069)},
+    0
+  },
+  {
+    {W(0x847ccde6cd28c9a9), W(0x3e8681e6bd315edb), W(0xf2656e663a82d8f6),
+     W(0xd49cffbbbe2e7307)},
+    {W(0x3489a26da912cf39), W(0x7e40d5bd683d0e6a), W(0x81eed8be06a87ca4),
+     W(0xa78f592a37388bdc)},
+    0
+  },
+  {
+    {W(0x2c54b8e438439228), W(0xa5c1b5cf5f86a1f0), W(0x9b384c4aaa832c91),
+     W(0x0e5b04064c3af413)},
+    {W(0xdd98c42d6750f894), W(0xd58e167713e78512), W(0x29329fd9acccd0c6),
+     W(0xf076dca0c931060e)},
+    0
+  },
+  {
+    {W(0x1e48fa1886b54e66), W(0x32cbd8d6c7b0eba1), W(0x5717914144185004),
+     W(0xef97fba13a430ff3)},
+    {W(0x90ec376208111ee1), W(0xd5c83fb453efd84c), W(0xfcd0a93247856f0b),
+     W(0xcb7317fe0ac9fca4)},
+    0
+  },
+  {
+    {W(0x50d82b0f101578b1), W(0xf87b6da9744a315b), W(0x10dc023c01920eb0),
+     W(0xa3aac09aab58a7e5)},
+    {W(0x20a618dbcaa23bc2), W(0xb24e77be7a55e6ab), W(0x01916d3f04b487eb),
+     W(0xc5aa2d773f82cd47)},
+    0
+  },
+  {
+    {W(0xaa31cc5b53a5126b), W(0xcdb6f8bf94ddcc35), W(0xa6542d4ff4d5c195),
+     W(0xbd80c3aae13dccbc)},
+    {W(0xb9d5a2f297555ab6), W(0xac9b99563f015cda), W(0x2d32d87d1c2d5b39),
+     W(0x2a4127035c9e0282)},
+    0
+  },
+  {
+    {W(0xc2b2d588667bcaed), W(0xdef7efc82cae77d0), W(0x6838d3763b3db10e),
+     W(0x8d88dd7261adafa6)},
+    {W(0x8db82d0ce3f4f033), W(0x3fae187db5b88884), W(0x146e4f64c26dd780),
+     W(0xfe9f5325d1637676)},
+    0
+  },
+  {
+    {W(0xf84b4dfb24fc66a1), W(0x7b93762b936d6341), W(0x07325a496e173395),
+     W(0x3eaa2ca11c1b1ef5)},
+    {W(0xda9258d5eb56f621), W(0x57028af9e8e1c3ce), W(0x8d7318a90597ce28),
+     W(0x202d70b13e810be2)},
+    0
+  },
+  {
+    {W(0x45c577cbabec5877), W(0x617b5cb906a54ff6), W(0x38e2eb1c4d9d2adc),
+     W(0x0b72c41edf2e83f1)},
+    {W(0xfdb34337ea3fd34f), W(0x0c1cd835f9b49d4d), W(0xea5f3bd60acd7a7b),
+     W(0x1f8d42dd306dae17)},
+    0
+  },
+  {
+    {W(0x00e4ee3b42b67f98), W(0x19605508d32b6c81), W(0x1dc0f17a61aaf7c1),
+     W(0x44a8b464ce341591)},
+    {W(0x21d297c912eb304a), W(0xf8c76f9e3c4a5c98), W(0xcae33abe852e96cb),
+     W(0x5a3a4ec6c1871650)},
+    0
+  },
+  {
+    {W(0x0765504e08d8539d), W(0x18402c69788869e1), W(0xf59d00de1cb76298),
+     W(0x4f06bf3625d2df52)},
+    {W(0xc0ba23fab899db68), W(0x9772aefea837a956), W(0x323211e539c74b6c),
+     W(0x9675718258e1d05d)},
+    0
+  },
+  {
+    {W(0x2a15f0d770471687), W(0x5cad5013e8129d28), W(0x60d775fabcdbd3c3),
+     W(0x44aa65764306ce00)},
+    {W(0x15c01c199a51f30c), W(0x79fa0db5e07794d4), W(0xd1c34bfe11b2bed0),
+     W(0x90caf46903d5f76f)},
+    0
+  },
+  {
+    {W(0x825bb3759dea6450), W(0x2a65979bc41e18a7), W(0x4918835deb8d8cd1),
+     W(0x5d2ae66a5080f8a6)},
+    {W(0x9ea870cf92776f52), W(0xce13ba04c4fe57d2), W(0xce1695515374b494),
+     W(0xbd14ce0895224f2d)},
+    0
+  },
+  {
+    {W(0x916c8dedebefa528), W(0xf6f8e1d9313fe62e), W(0xb16742d4e89eb5b1),
+     W(0xfc8302f42be83b44)},
+    {W(0xfd7e353620bca984), W(0x2de62a21ad24b472), W(0x456a9dee8de2e35a),
+     W(0x874a4aaee80deb36)},
+    0
+  },
+  {
+    {W(0xdac608ae5963f67d), W(0x06d97a53d64f1bb8), W(0x50add6bfe5c305c8),
+     W(0x1596c6cd2e24f88b)},
+    {W(0x3ee074b7b2e9c640), W(0x8039c621e6d11644), W(0xaf5e440c0f1900ac),
+     W(0x1b94dabfbed5a67c)},
+    0
+  },
+  {
+    {W(0xd3620019baf6f570), W(0x2c26e34b6051e08e), W(0x36a9406074dec726),
+     W(0x7d50481989be4502)},
+    {W(0x71962950fc57f489), W(0xbbb60cf5a5ebb779), W(0xf9af2897b58190b6),
+     W(0x1db5317a30f87c9f)},
+    0
+  },
+  {
+    {W(0xe08af9c80e9dbc5a), W(0x24ff3cdcf9385890), W(0x61af5453c7d93820),
+     W(0x8afbdc5d14a43d28)},
+    {W(0xd4e838d2100624d9), W(0xac7c300eb5eaa22c), W(0xc15eaa8696f10199),
+     W(0xa68ac38cc9538d04)},
+    0
+  },
+  {
+    {W(0x7508e0ffd1edde40), W(0x0aaa923dd9e31e98), W(0x736711e84f8b59b6),
+     W(0xc6bc7d717a91818e)},
+    {W(0x85554ce5468e645d), W(0x4ee97bcf5b43b8aa), W(0x7aadbab08c563108),
+     W(0xb85b7c795b317b56)},
+    0
+  },
+  {
+    {W(0x65cd96e1916b42ce), W(0x0799b4f0ceb7a44f), W(0x6bbb9629253b5fdd),
+     W(0xfaf781183e8411ed)},
+    {W(0x897c33a30a7448fe), W(0xb12b513adb0952d2), W(0xee8a19bddeeda090),
+     W(0xf3b37031d0acbcbe)},
+    0
+  },
+  {
+    {W(0x8e7f0f2da06a5365), W(0xb9d132ff4a3c1e65), W(0xe7629396256d2a77),
+     W(0xd3bb26a5439fa057)},
+    {W(0xd369249f6be9cf9b), W(0xb0e9a9319f74ecde), W(0x4acdf9923271cada),
+     W(0x2411f3215323b456)},
+    0
+  },
+  {
+    {W(0x19d2afe4accef3f2), W(0xe91417af29f7ed97), W(0xd3b1a180d7d1ae3f),
+     W(0xed2209040c72fed3)},
+    {W(0xe5dac27ee4c6d0c3), W(0x76d00d4b28f831fa), W(0x280f1ad861bd04c2),
+     W(0xc92bf9b018db1d29)},
+    0
+  },
+  {
+    {W(0xcef6f38cb18a34c6), W(0xe01f9b313473a782), W(0x80fd8b84c8edcca6),
+     W(0x2c1d2fd09177afce)},
+    {W(0x2a7b2e5ecc897e48), W(0x4026c1a9c700f787), W(0x7f9aeaed9f5191ec),
+     W(0xd669f29f2f0ae042)},
+    0
+  },
+  {
+    {W(0x093444b96c73b0c4), W(0xdb258a30608604df), W(0x65369d51bea34120),
+     W(0xb5e79ca12b3a1d5e)},
+    {W(0xa5e2ecf61ac26651), W(0xa1559f1792351026), W(0xf353c60cd1e0caa8),
+     W(0x8588e54fcfc349e9)},
+    0
+  },
+  {
+    {W(0x50e5a89013459355), W(0xdfef605da80144fd), W(0x1bc0c82654e82a43),
+     W(0x7de9fb01ede931e2)},
+    {W(0xc06ece273d295383), W(0x2fc6de16a66443a7), W(0xbe6ded0c7fe6a09e),
+     W(0xad5f0228842abaec)},
+    0
+  },
+  {
+    {W(0x39a7dbb8f09a7fe3), W(0xbf879f8a6190dcdf), W(0x952e1b50c74fc772),
+     W(0x1983c58213d8b01f)},
+    {W(0xcf5addf8816bc994), W(0x76c94c9c18876d82), W(0xcbaebcf64814e47c),
+     W(0xaf2c938c26e9a250)},
+    0
+  },
+  {
+    {W(0x73856906c0ffb58c), W(0xd318e272aadd2bd9), W(0xb0b7b6d6957cc145),
+     W(0x26f5b3eee83e586d)},
+    {W(0xf504bac25bf9c79a), W(0x4cdf7a7b7b0b8f49), W(0x6057bb416222c9ef),
+     W(0x0af581794326c1c2)},
+    0
+  },
+  {
+    {W(0x717be47ab3639bed), W(0x78a84dc711f01dbb), W(0x82e3b0e14f87fdf8),
+     W(0x4e2b9c4fb01ca542)},
+    {W(0x2a9a75e062fb102d), W(0x1260cd3c2b324988), W(0x3419704054de2a2c),
+     W(0xafc331ecd916d05b)},
+    0
+  },
+  {
+    {W(0xa2206d8f630996a1), W(0x4b63db3226922317), W(0xdf6552353716aefa),
+     W(0x5408714ac266900b)},
+    {W(0x8172ea76723dba93), W(0xd0853363c0d287f0), W(0x8da136640207eb95),
+     W(0xcc2966ca1a519c4b)},
+    0
+  },
+  {
+    {W(0xed0baee512a707a8), W(0x45592d282d21db7c), W(0x63a6ae089287ba9e),
+     W(0x3f08df1b6dbdafb3)},
+    {W(0x261e23c8364af6aa), W(0xec3b830299ab8bd9), W(0xfbd155ffe2adf918),
+     W(0xbf99f3cc837fbd83)},
+    0
+  },
+  {
+    {W(0x51ba223e721cda44), W(0x10456dfe74f12a3f), W(0x7ab83dc42eeefecf),
+     W(0x7301517cfb042d92)},
+    {W(0x8ef289099d215feb), W(0x832e23c4e14532ea), W(0xc7e96934844f9f8f),
+     W(0xfc953f472e08b938)},
+    0
+  },
+  {
+    {W(0xd0de1d1cc2c4b626), W(0x2c4197b3efd757e5), W(0x115310a7ba964415),
+     W(0xa334243657b0b5d5)},
+    {W(0xbf298ad52c9596b2), W(0x40cf05ae5fb2563f), W(0x878e286bc3dd499e),
+     W(0xe88589ff703c1e2c)},
+    0
+  },
+  {
+    {W(0xe1fb2f6c0c893f26), W(0x568cd15ecb05fe80), W(0xc573750808e05cfd),
+     W(0xb9a2a9da6a2bf6b3)},
+    {W(0x43dceeb3f5f4ade9), W(0x1b96c0d4daa057bd), W(0xe9c435976b8e25e4),
+     W(0xe8b4e7655d3e3eb9)},
+    0
+  },
+  {
+    {W(0x9b3431885aa80c63), W(0xf7a2f97f8349c7a6), W(0x09b07ffda99553aa),
+     W(0xa4bcc749903cdd05)},
+    {W(0xa5a1312edefa2d07), W(0x6fd5f898c4f73d62), W(0x3f23762f40a67d6c),
+     W(0x43b85ce5fd62ffe5)},
+    0
+  },
+  {
+    {W(0xa1f5b66830f7849f), W(0xf78e683d8b3095d7), W(0xfb0fe022d0cc5750),
+     W(0x78e227ab73db3f97)},
+    {W(0x90a42c4e338ce230), W(0x0647f8069ea5963a), W(0x4927cf5b71e7179b),
+     W(0xf2f3bf529a2dc3ff)},
+    0
+  },
+  {
+    {W(0x4d29fd62e349da1e), W(0xab02c4ba58156a14), W(0x63d9a5eb7bbe2b99),
+     W(0x2455b37cdabe4e12)},
+    {W(0xeb6718dfdcee4535), W(0xd7615738104756e2), W(0x3cd03295b61752e5),
+     W(0xf4f4006a45e36227)},
+    0
+  },
+  {
+    {W(0x642d1e656ff26c9b), W(0xa980f12db36f17f4), W(0xd2c304a5b63d458b),
+     W(0xe36096b5155da308)},
+    {W(0x43e5b8453c04f8cd), W(0xc8304a8d357ad9f7), W(0xf0f56cecc6cb6f4c),
+     W(0xba88832d1cecbc40)},
+    0
+  },
+  {
+    {W(0x6167df3e6ca0ba7b), W(0x95aa334f1d9e1808), W(0x5748b6a96e24de11),
+     W(0x724e2aee7f69589d)},
+    {W(0x3b2feb2524cefc4e), W(0x2c16dcf92b72cdc4), W(0x06f3189b127aad13),
+     W(0x401bf41eee2bc326)},
+    0
+  },
+  {
+    {W(0xaf3dcc02f600df6d), W(0xe34ba6d81ed45001), W(0x4b04bb1f98178559),
+     W(0xa79ebde1e8813fc7)},
+    {W(0xcb101063af54aa48), W(0xbe5fc06ea070c563), W(0xd379ee30ae10721c),
+     W(0x9f0026f8a1605f2e)},
+    0
+  },
+  {
+    {W(0xddd6b4076daa99c1), W(0xb8c0b195e17bb83e), W(0x8010d1e6351da387),
+     W(0x4c1fd67d19dad6c0)},
+    {W(0x6182685750497dc0), W(0xc9a93cf2f2dc764d), W(0x8a7927068bde03a5),
+     W(0x4c9c2166fcad6dad)},
+    0
+  },
+  {
+    {W(0x212f10aa341af0f1), W(0x42f70317133e201b), W(0xa9518b47491565b0),
+     W(0x146458914be5eea4)},
+    {W(0xaad926d1daac5276), W(0x3cd9ad2951f93ad0), W(0xff92ec4ce195348d),
+     W(0x6a097c0d08d13459)},
+    0
+  },
+  {
+    {W(0x57c9be8b4c00c8d4), W(0xa9f69ff6ce0cd5b8), W(0x43b58e85af94d993),
+     W(0xaed259b91af8ea7f)},
+    {W(0x206bf9cb33debac4), W(0x6d1244f3d7d020de), W(0xd3f45d8cff3fcedb),
+     W(0x39240c693b508a65)},
+    0
+  },
+  {
+    {W(0x16b4be0886ccded3), W(0xa3d1d954eb4057e0), W(0x4345a25b7e08c27c),
+     W(0x921a08fb47dbe0c1)},
+    {W(0x331af909591dc8ab), W(0x637e11a1cc515567), W(0xfe5f1660c7726f88),
+     W(0xc63bacbf891ce818)},
+    0
+  },
+  {
+    {W(0x5b7f1cfabca84b13), W(0x7d78a8ab2c53b552), W(0xddd6f2c9918306a7),
+     W(0x75e783514246a061)},
+    {W(0x453f82522627ad5d), W(0xd50f7edd1ab685e0), W(0x33a5e028aed945d6),
+     W(0x7cd87ff5d1be411e)},
+    0
+  },
+  {
+    {W(0xbfb14c616697bce7), W(0x9d2e0347fbabf856), W(0x912d4ed48639e00c),
+     W(0x8901ad01ec96e4d8)},
+    {W(0x6ac088294092739d), W(0xdc5bef7b4726f7e5), W(0x780fc0bb321deae2),
+     W(0xe3eda2fb1b043654)},
+    0
+  },
+  {
+    {W(0x2887ca9e5e3d7465), W(0x8bb4e3496823fc76), W(0x45a030520cba14ac),
+     W(0x1be4e43e8c637437)},
+    {W(0x26787be201f4fd55), W(0xda3c8614ceedfc36), W(0xc1888ed4fc9c7174),
+     W(0x8d12fb0ff04e0c70)},
+    0
+  },
+  {
+    {W(0x8d0a3e0fe66c39fc), W(0xd1e360d5e5a755ed), W(0x06298bc4b025f806),
+     W(0x1ca4d28be178f80e)},
+    {W(0x26283386cb1a5dd7), W(0xea850de65c3079fb), W(0x76e09fd7813c7b30),
+     W(0x60c09db654dd0630)},
+    0
+  },
+  {
+    {W(0xc64914395cbe9d49), W(0xde4873f1307c2566), W(0xcb4b4584a5a2d8b8),
+     W(0x4e03aff1563f1ac8)},
+    {W(0x9a58a7da3412143e), W(0x4d2abb95327992ba), W(0x9ea559cb18e2121c),
+     W(0x6be88b58737837a3)},
+    0
+  },
+  {
+    {W(0x391de28636c0d67d), W(0xc35ca792a707fea0), W(0x4b3911cf0fade4b2),
+     W(0x250cb4772a220e58)},
+    {W(0xa4610c0126b21e8a), W(0x655ba9c0dffab5a4), W(0x4dd28a25a1c95491),
+     W(0x1e6c91adcb578ca3)},
+    0
+  },
+  {
+    {W(0xb0840f1b9f9a9a29), W(0x62ee1ef5ee1b3952), W(0x85c29b25f37b981a),
+     W(0x9e694637802dc824)},
+    {W(0x1c3eef2fb0ff11ec), W(0x392f3565a80d51e4), W(0x228522142972394c),
+     W(0x2846ce8c682022e1)},
+    0
+  },
+  {
+    {W(0x249e46f406f94d16), W(0xb6c92d8aa20c8132), W(0xf6ce8d249420051e),
+     W(0x734d8d2dcbbb5838)},
+    {W(0x27d1896d8fd528e9), W(0xd547019656e44bd7), W(0x736d2d2a6959d3b7),
+     W(0x68f4d7910536cd3d)},
+    0
+  },
+  {
+    {W(0xabe4fbe4b52ca7e1), W(0x2cbe9dace2b98857), W(0x6f8ad1e841b70677),
+     W(0x44f51133cdd56063)},
+    {W(0xe59cbfce8474496e), W(0x55970dafda781aa8), W(0x9a5dcf4f2c6be02e),
+     W(0x7f004c063754822f)},
+    0
+  },
+  {
+    {W(0xea3eb9e9dc30702d), W(0x1c534e5e0c7b0280), W(0x67c2ffb01bc98d3e),
+     W(0xa20e0c80d797554c)},
+    {W(0x0628d51fe8ed4c42), W(0x382a9be059341a2d), W(0x82658f35445543fc),
+     W(0xa9377861784520f6)},
+    0
+  },
+  {
+    {W(0x365434cd36cc4b55), W(0x2002e3ba95742032), W(0x8f53889981f3e596),
+     W(0xc7d32363a3a70a83)},
+    {W(0x7ee98a24cdea4335), W(0x702ecb92001867e7), W(0xe5a3993e3dbaad75),
+     W(0xbac6dfd6798d4c4a)},
+    0
+  },
+  {
+    {W(0xa3422c9bed8f6fae), W(0xf8b887bdb0c0b0d9), W(0x118772654725b967),
+     W(0xa55cb23b49dea3e0)},
+    {W(0xed2888271d43abfe), W(0xe08dfb5dcf910bc9), W(0x3fd698e1fe556c4d),
+     W(0xe501043b882dae38)},
+    0
+  },
+  {
+    {W(0x2dc20d0c22f6a358), W(0x82c973a6d3de9e5f), W(0xa49c76b8fa2352c0),
+     W(0xf498b5c84f430e31)},
+    {W(0x2e102ca3ff633c01), W(0x5eccb2b69954b4e3), W(0x0b5690d80437e125),
+     W(0x7fd36c6d406685ff)},
+    0
+  },
+  {
+    {W(0x6edfaa210cfa42a0), W(0x9a6d0c34955ddc11), W(0x97e5bf17104124e6),
+     W(0xb957ae98ac88875e)},
+    {W(0x385558eac73c7ddf), W(0xe5c2665c7e4d2408), W(0x12dd013462550f80),
+     W(0x351dd9916416f866)},
+    0
+  },
+  {
+    {W(0xb6a2f8ec5b0f978c), W(0xcdfaf58fae7954fe), W(0xcb491dc680ad72be),
+     W(0x56180472a63830cf)},
+    {W(0x0c24613006e4cdcd), W(0x23e66fb6c2adfc24), W(0x7e1f06282f78fa82),
+     W(0xf175b27ca543d29e)},
+    0
+  },
+  {
+    {W(0xd2dcc5a07c5ed24d), W(0x8cac09938ca96506), W(0x25211ee55a950dfd),
+     W(0xa171cebbd89363d5)},
+    {W(0x412ba3e10b44ef61), W(0xf8c249d5ce521753), W(0xffc020ba4926cfcc),
+     W(0x300062c611c9a90c)},
+    0
+  },
+  {
+    {W(0xf31b11b102a00736), W(0x9b943bec312fb9ba), W(0xc5acbf724a441d9b),
+     W(0xe93b937d1cfced2f)},
+    {W(0x39702158474aa2fb), W(0x5df66aae31f6c2b8), W(0xcd580f20d0fb7f86),
+     W(0x0b4c49259ca9d4fb)},
+    0
+  },
+  {
+    {W(0x00f300907d5d493f), W(0xeddda75f4055d6b8), W(0x1df6bb91ec9354f6),
+     W(0xf177ec1ce51feba8)},
+    {W(0x416ea559ae68e9f9), W(0x3cb0780cb71de654), W(0x78c70f2815b280e1),
+     W(0x9d2b513b903f50c8)},
+    0
+  },
+  {
+    {W(0x6e82991fb585be13), W(0xf9526f64f2aaf17d), W(0xd7699ac71abd6d62),
+     W(0xd6b0b3ce4453b2b7)},
+    {W(0x08e8ea988a188e21), W(0x71e83941321d52ae), W(0x281466612ef3473d),
+     W(0x195e8ea921284609)},
+    0
+  },
+  {
+    {W(0xd5306a3582c71bd0), W(0xeb84eea2e22d3a78), W(0x2816072f49449804),
+     W(0x0c5a2264f6d36045)},
+    {W(0x8a57741b898deab5), W(0x95418dea4f96398a), W(0x6a2df2f6141de96b),
+     W(0x8a163a64e9ec0425)},
+    0
+  },
+  {
+    {W(0x8aef3cd423e7ca4e), W(0xc0c3beb289f63f7c), W(0xce69e5594785b63d),
+     W(0xe4bde9024933471b)},
+    {W(0xe48c4d8bb6b0f81f), W(0xa85dc2bc37c9ad88), W(0xae7a7e8731bbd04f),
+     W(0x5b9089d6bb7ef3b1)},
+    0
+  },
+  {
+    {W(0xf517111437cd70e1), W(0x31d9c9bc9cc67f1c), W(0xab5b6eb62f22ec70),
+     W(0x3c6aae873d370bad)},
+    {W(0x6bcabb2230ab1471), W(0xc2b70ea716367432), W(0x92541d0fbd9c8cbc),
+     W(0x0a13651d83305530)},
+    0
+  },
+  {
+    {W(0xe9a70438abb3d7a0), W(0x4f7b5ea2fb203644), W(0x90b8258bfd21a036),
+     W(0x6831c85e14694f33)},
+    {W(0xc78a94f245019ad1), W(0x621b9bae45f5192c), W(0x7f5a9b5f13719203),
+     W(0xdc49291c5a872a41)},
+    0
+  },
+  {
+    {W(0x175eaebb8da044bb), W(0xf77a50b2fb9712a1), W(0xab4db314cb74c6ff),
+     W(0x018d99d6f7157225)},
+    {W(0x79601461b5f15dae), W(0x8d968c7a6a98a258), W(0x950954448c66cf56),
+     W(0xd2a2a571395a2d46)},
+    0
+  },
+  {
+    {W(0xcae8fbbca0a21fd2), W(0x467dc199f1a1ef0e), W(0x42af8bda51f28dc2),
+     W(0xd53f93bc870053ce)},
+    {W(0xb6d73ec979d4a1c1), W(0x232d0f60af5111cd), W(0x5e3cbf23daf7eced),
+     W(0xd1988c9efc7a5f50)},
+    0
+  },
+  {
+    {W(0x3136c3a43e01aec1), W(0x013e3d37d216c81b), W(0xb90e206c9cb7780c),
+     W(0xc9162a7d4c4943e3)},
+    {W(0x9222c05755031a06), W(0x532c85ed0df34e0b), W(0xe69119cb9df07500),
+     W(0x50977385ed7c1c46)},
+    0
+  },
+  {
+    {W(0x1b2d1e6bb3d24d2e), W(0xb43f28113ea5e033), W(0x016b394a0ce13a55),
+     W(0xbb1abc7bc10a5e0d)},
+    {W(0x3f9979425f926a8c), W(0x46a667a158969268), W(0xdeed9137335d88af),
+     W(0x950efe1146066968)},
+    0
+  },
+  {
+    {W(0x4a8a47b3bc409ed4), W(0x2161e69ade4604b0), W(0x9f3be3009741dfa8),
+     W(0x440273a7c2892105)},
+    {W(0x79f79c976dd3d3c0), W(0xd4a6916a5884bd2a), W(0xae20ae9a20898d57),
+     W(0x2a413a7ee6e9a2d0)},
+    0
+  },
+  {
+    {W(0xfc0deb6fe89f0145), W(0x909b06633f0f74c0), W(0x287970fa698b2c03),
+     W(0x6608387a92bbd2a7)},
+    {W(0x103467916e9578a2), W(0x8ae5a9661f1601ae), W(0x4bf58041fd0e0c9b),
+     W(0xd3bfea18b3754779)},
+    0
+  },
+  {
+    {W(0x0d3eb1b8438105ba), W(0x41c4a762fc8bddcd), W(0xf3b2c2dd8f80da75),
+     W(0x995a5df964977f8b)},
+    {W(0x5056b8df033abf2b), W(0x87c97fd8a391191b), W(0xf15e64abf6fbe7c0),
+     W(0x185a2dcb309eb277)},
+    0
+  },
+  {
+    {W(0xf5f8ee0fd9ea582d), W(0xa52a82336fdf45aa), W(0xed6c52fc6dccb863),
+     W(0x8a0201cd36d2c79d)},
+    {W(0xadac99bb4b91724e), W(0xd65d714db491bd3b), W(0x2b172c42f2dbfe83),
+     W(0x11f75c24d4825483)},
+    0
+  },
+  {
+    {W(0xa267d32d30de6c62), W(0x781a9ee029de5739), W(0x8742bd43e1706bbc),
+     W(0x4d2d95af64ab9d1c)},
+    {W(0xfaa8351dbe115918), W(0x995885ffd401f442), W(0x441ffd51ee98ac00),
+     W(0x59f316f89d0e424c)},
+    0
+  },
+  {
+    {W(0x13d1dc967fc23f2e), W(0xa91e671ec5e8f21f), W(0x731906aa1459df77),
+     W(0x232a74070e22bbf0)},
+    {W(0xb594dd36d615064e), W(0xffd4185713a33d67), W(0x1d615b8b3a58ca8a),
+     W(0x3fd7e765ebe14323)},
+    0
+  },
+  {
+    {W(0x29e63d10f58b1a31), W(0x75225c3b0fbfeed4), W(0xffba7297d74eee5a),
+     W(0xe30d094c2f0a286b)},
+    {W(0x7f03743b57b43658), W(0x5f36e7495f9a88d6), W(0x33e9d08193029a74),
+     W(0xc97b38babf8b7d36)},
+    0
+  },
+  {
+    {W(0x2056daf7860256aa), W(0xa56caab15a230260), W(0xeba74f5b1f828bf9),
+     W(0x94ff5eda94b054d1)},
+    {W(0x7e14468288446a54), W(0xa48fca37eace5c0a), W(0x1e3dc4fd15a5f2a4),
+     W(0x1cb1f15ad1839362)},
+    0
+  },
+  {
+    {W(0x1fdd7337e2712541), W(0xf92cf28db19541e6), W(0x9315f742626b1afe),
+     W(0x491a8028b79ed368)},
+    {W(0xbb3d53802055db92), W(0x1eef23e9426f2185), W(0xb090e5adb5733468),
+     W(0x9a97b043f62afa76)},
+    0
+  },
+  {
+    {W(0xd5f26041e0b732b2), W(0xfe5dbc28511fe028), W(0x9c6fefe41faa66fe),
+     W(0x1373145d19449e64)},
+    {W(0x9e6f41b2301fa19b), W(0x4fed203f548e5927), W(0xd1007e37fb3cd4dd),
+     W(0x6e648b11b28c2497)},
+    0
+  },
+  {
+    {W(0x8280ce9217eb1da3), W(0x085b30e98bb2d533), W(0x9d2effa19910afcf),
+     W(0xf49380a93750eabc)},
+    {W(0x20c9ee8ad47446b7), W(0x6bec05025803abd1), W(0xe8918defd2e8e5b9),
+     W(0xd98bf4f6d28121cd)},
+    0
+  },
+  {
+    {W(0x5c734f2be96ae396), W(0x5a28c57241f2b221), W(0x07f719d2e6b7d0a6),
+     W(0x7117b0445e4bb95e)},
+    {W(0x6d7b92475988f38a), W(0xbebe67889ff93adc), W(0x928aff16c6c6fe4f),
+     W(0xddcd3338686a12ea)},
+    0
+  },
+  {
+    {W(0xe27ff2ffe7f608f3), W(0x43b85df9baaf29a1), W(0x62c60d018767ebbc),
+     W(0x61f22c8b5038ab7b)},
+    {W(0x390e6e276097d0bf), W(0x9d2c53aff193cb8f), W(0xeeef02b60e6946a0),
+     W(0xc31f5a6e8adc2b71)},
+    0
+  },
+  {
+    {W(0x983f5865e4fdda0c), W(0xc21c411e5554ada8), W(0xbd795af1f307be3d),
+     W(0x9f175d054768eb49)},
+    {W(0x7f8b794652caab05), W(0x7d608fee658e6cd5), W(0x1e4d325aab30f384),
+     W(0x4a642ab1da143617)},
+    0
+  },
+  {
+    {W(0xf0c511518109aea9), W(0xfb5e92a4246cf89e), W(0xd40c9de54b129170),
+     W(0x23370e5212f2ee5a)},
+    {W(0xa35922fe18dd0b2e), W(0x3f0129655c7373e2), W(0xef9b78a3160f4a9f),
+     W(0x07157b958735a06b)},
+    0
+  },
+  {
+    {W(0x428286da40bc02a0), W(0x8bb5545c2cdaca51), W(0x959f07f725f3bca6),
+     W(0x86025dabef27404a)},
+    {W(0xac50d38ebfa46f61), W(0xef508a6c784c39bc), W(0x74f10ea4b2ecb723),
+     W(0x0a46bb3b0d7b24d7)},
+    0
+  },
+  {
+    {W(0x4bde523ba7600b17), W(0x2dcecfdadaa7dd65), W(0x85a687bb459e6a7f),
+     W(0x90dfbb8477a3625d)},
+    {W(0xdbe7e4dadd345c96), W(0x36adc5d45a461010), W(0xdf10d3e9f3f3f2b2),
+     W(0x28c1f39be0598691)},
+    0
+  },
+  {
+    {W(0x982b8e348734f2ba), W(0xb33977bcae5528eb), W(0x90cb9a09316aa5b4),
+     W(0xf7d506b4b01d06b0)},
+    {W(0x3854a9883d14e21d), W(0x5b568ca40af20eac), W(0x91bafeb2fdcc7c80),
+     W(0x5ae0cb0ce61d750e)},
+    0
+  },
+  {
+    {W(0xd65989b3accbebd2), W(0xc08209367b440dbd), W(0x859ff392986b161e),
+     W(0x89ffc789df13a549)},
+    {W(0xfa4de58e4d47e77c), W(0x3d5772fb14bb36e9), W(0xd0f35e4df750eff1),
+     W(0x549f19e5dc2750c5)},
+    0
+  },
+  {
+    {W(0x277f5735c7ba54a5), W(0xec476621373f7ae7), W(0x1ed26e3ff1fc1aff),
+     W(0xc45f5fc8b54850b2)},
+    {W(0x3a6058c4564fb3c9), W(0x2cb5cd63b0903832), W(0xf51fa0879be674c5),
+     W(0x3e973b57dd1b80e3)},
+    0
+  },
+  {
+    {W(0xd2a16cb5ed8c72ad), W(0xa9dba3406871f03e), W(0x454878b0c7d34042),
+     W(0x1b74a85d8e192153)},
+    {W(0xfe4eb0187d3859af), W(0x7e5240ae1e850b60), W(0x3c24375f30c409ab),
+     W(0xaea73de53cdb7d04)},
+    0
+  },
+  {
+    {W(0x7a3332c2fe2f1549), W(0x79f0d76b21030431), W(0x105a603b5542a985),
+     W(0xd57e942528bceb34)},
+    {W(0xf08194b332bf47d1), W(0x85528ccb8efe13a0), W(0x1cd2739c8c25f306),
+     W(0x631cdc0b77b69281)},
+    0
+  },
+  {
+    {W(0x46482f0582b80653), W(0x4028ae8a27b15922), W(0x8208c64dab396580),
+     W(0xa16d5555499be37b)},
+    {W(0x5ffcf6196150d5d5), W(0xffbc0595e1d7ba3e), W(0xfe53b40a7b0ede8b),
+     W(0x3665cf9aec426348)},
+    0
+  },
+  {
+    {W(0xd7e7b1c045f56223), W(0x0d2d4018193ab1dc), W(0x75f7f314ca79c420),
+     W(0xe6c8b3697b57203f)},
+    {W(0xaab3691b3f310cab), W(0xa7bce8da22d1fbc8), W(0x7e5b26752300598a),
+     W(0xa8bd925158e2c66b)},
+    0
+  },
+  {
+    {W(0x85bc31ae11b4298a), W(0x4c8e29aec451aa89), W(0xb7066c9ae9a8ab80),
+     W(0x10b47d0332d9ccfe)},
+    {W(0xbbb510d472d65430), W(0x1884e76038127546), W(0x4c4763b489632d42),
+     W(0x2ef296624e4096da)},
+    0
+  },
+  {
+    {W(0x5e9d448441bfc738), W(0x5e661807320ab342), W(0xef5d48db22cd735a),
+     W(0xb74f9c6339e50558)},
+    {W(0x99918c022ea1ef8a), W(0x5a47f57a7011cb60), W(0x6afb8d304eb5b8ff),
+     W(0x88605e16693c95a7)},
+    0
+  },
+  {
+    {W(0xde6644111d894624), W(0x3aae414620ed488f), W(0x8f31ee193e4873a2),
+     W(0x1e7377e6f28b151d)},
+    {W(0x2c4210f01536a9a0), W(0xd4a71979d8bcb738), W(0x59e7c97c7b0bb6f4),
+     W(0x0378233a45a167e9)},
+    0
+  },
+  {
+    {W(0x4099161eaa5fd194), W(0x76266a3ef41b5c27), W(0x86fc802a7b900ab2),
+     W(0x133e08c87e91ecc4)},
+    {W(0x99162e49ae3876aa), W(0xd1e54d3c18713143), W(0xff9cd71368eab2f5),
+     W(0x67c98184625efef4)},
+    0
+  },
+  {
+    {W(0x98b936fe9b21d1e4), W(0x3976e61bece82cfa), W(0x7b4e7f399199e8ed),
+     W(0x96d86b0573d0b2c5)},
+    {W(0x8c9600c0a5a5c275), W(0x62ae791b69f392b8), W(0x70a00a27803f080b),
+     W(0x84a07b8f6e6624b6)},
+    0
+  },
+  {
+    {W(0x10e4e5ac3c7772ae), W(0xf8c6c0fddc16758d), W(0x8ee38caa75c490ae),
+     W(0xdd0569b980601b97)},
+    {W(0xae2391f4185dcfe3), W(0x8634e74f39bae154), W(0xbe315f1f52dba606),
+     W(0x39b979db34c2a942)},
+    0
+  },
+  {
+    {W(0x45915b7bdae122e7), W(0x553281f1011ed498), W(0xc11639930b499676),
+     W(0x60f32fef05034b59)},
+    {W(0x7e3d2b635671643a), W(0xd289bf70ba1c9ad8), W(0xa60487135de3771d),
+     W(0xc5dc5c1a23bb54de)},
+    0
+  },
+  {
+    {W(0x33dc8d65434e1a50), W(0x13831d99c1aa2a3b), W(0x6b4ea350c152eb5b),
+     W(0xc88ebf445e5ab9e4)},
+    {W(0xc53d7fcb7d7e77c2), W(0xc585ac12b8c1aa0f), W(0x7b2330d114b75172),
+     W(0x92ec2e0f3400bf4c)},
+    0
+  },
+  {
+    {W(0xdbbb6e2cf362590e), W(0x2a7cb6575652ae2b), W(0x5514f069d0fe4a3e),
+     W(0xc30a72ef303f7c10)},
+    {W(0x744aaf1331e18335), W(0x1571ecc9a1956eb0), W(0x0cd4107f526e5d2f),
+     W(0xc7acf95bd8f2b6c0)},
+    0
+  },
+  {
+    {W(0xe26e9cb426eebdf0), W(0x4d6d3e4e88153cf1), W(0x3fc2741383f8591e),
+     W(0x639a45fffc4d1843)},
+    {W(0x75c8a9f0c0a11cd6), W(0xf8c0858afe20a6b8), W(0x8e7f27f890f67366),
+     W(0xb2b886af95ab0932)},
+    0
+  },
+  {
+    {W(0xde6f44149696e98f), W(0xf79565d4badb3334), W(0x02076e2ee329bd93),
+     W(0xd06926f222b41005)},
+    {W(0x6ed10a261efd9b54), W(0x9c18dd1d02953dd5), W(0x8fdd9a4c2f82e31a),
+     W(0x1d9831855937de7f)},
+    0
+  },
+  {
+    {W(0x61144e9af0b19d67), W(0x75e1751a1fa2a429), W(0x583953d9fb00321a),
+     W(0x01e0bf565a703f80)},
+    {W(0xc1df904493a06dad), W(0xdd10a9e998833cad), W(0x4b2775f64d9c1195),
+     W(0x2a273e27ca7261bd)},
+    0
+  },
+  {
+    {W(0x4ba96bda7e669c06), W(0x8894f86bc36c78a3), W(0x97b9e429f5b734ae),
+     W(0xab84cc5fd1c6b681)},
+    {W(0x23c97e91048eb5e8), W(0xaad5345ad0aa038d), W(0x4142bfe5d0a27b6a),
+     W(0x2f0046d2226d9f93)},
+    0
+  },
+  {
+    {W(0x9f4382930534379b), W(0x21d5fa5c09289734), W(0xfe64c579ebcc3c5a),
+     W(0xe5fe8c531f2c647b)},
+    {W(0x57422e1572ec209c), W(0x8b6c1a741bf0b882), W(0x714909ba4ef219b4),
+     W(0xc05f4309b8a5e640)},
+    0
+  },
+  {
+    {W(0x1706a2e85eda0179), W(0x1b5fe4bab72324a3), W(0x8e34098c9310ce96),
+     W(0x4a53873a12af9666)},
+    {W(0xd95f696394b4928c), W(0xba71ef081857402a), W(0x1f350e8418c6e4f7),
+     W(0x957f8dc63db52230)},
+    0
+  },
+  {
+    {W(0x17c0ba48e218bd4b), W(0xe1d755e5e2d5d5a5), W(0xd2c8a9f6e4f09d5d),
+     W(0x5d5b8905587b5e20)},
+    {W(0xfc435461936d8e98), W(0x95605fc8acb2e1bf), W(0x556d58f37adbb01d),
+     W(0x647ec3e0422a639a)},
+    0
+  },
+  {
+    {W(0xaea311d0a8050efb), W(0x157980fffd55801c), W(0xf3359e8defa86f38),
+     W(0x07e76309093925f4)},
+    {W(0x40033fb006a4ca63), W(0x4783a735b0188303), W(0xd2f76b1e8749034a),
+     W(0x1277c387c56dfd21)},
+    0
+  },
+  {
+    {W(0x3029ab30a0cbe2ab), W(0x103c60dcc92cf9f1), W(0x633714066f1dd8b8),
+     W(0x19f64d02a7e16870)},
+    {W(0xcc1518c2bf8226b6), W(0xfcb7dd251aac8155), W(0xff95126de3e12f29),
+     W(0x1751ec24ac3ff91f)},
+    0
+  },
+  {
+    {W(0xd859a8f5d1694826), W(0x3f44abb02b57ca29), W(0xd340811c0569f468),
+     W(0xe394c8428a976cc9)},
+    {W(0x9a04404bf7ebc369), W(0xf4c38b193346e76c), W(0xc373061ef170b474),
+     W(0x269bbe54c243df84)},
+    0
+  },
+  {
+    {W(0x665f84ceaefdc9d3), W(0x109a6040a6081fe5), W(0xc6e710fe91378eb1),
+     W(0x3d98fe95cd923579)},
+    {W(0xfa4c342a4713ed44), W(0xea33a7b6e9ed2aa3), W(0xe460508cad1a7d9c),
+     W(0x47983505862d9cdd)},
+    0
+  },
+  {
+    {W(0x5869aa24430183b2), W(0x88480a0d686ec0d2), W(0x8acb9db5528c18ba),
+     W(0x63e1d27eba662e5a)},
+    {W(0xfe87bdb5e2c8aaa6), W(0xcb487b05730709c7), W(0xc08c70549e80a074),
+     W(0x346bba1c7ba515cc)},
+    0
+  },
+  {
+    {W(0xd00688d58339b6ff), W(0x6ed0edb44a899b3a), W(0x6db6d22aaa411652),
+     W(0xcf5fa67a2d2018b3)},
+    {W(0x11055ca7ac647af4), W(0x5aa8dc67c2e312ee), W(0x20cfcd166ac21386),
+     W(0xc58b6919a61b41b4)},
+    0
+  },
+  {
+    {W(0x026e383f57420403), W(0x8cd226219c393125), W(0xb9336ababcab5f8f),
+     W(0xbce99c170831dab4)},
+    {W(0xa85c36ead6e72338), W(0xe22309f3849361fe), W(0xf1165156e53cc6be),
+     W(0xd48ce36f97fa3554)},
+    0
+  },
+  {
+    {W(0x60bc1aecbf97e2f6), W(0x4b98a5d660b548cf), W(0x121ee76513aa361a),
+     W(0xcf464d4528c99a8f)},
+    {W(0xf61f233c7b38f2c3), W(0x96cb62589750d75e), W(0x3888ab62dc58990b),
+     W(0x6ea03944a4deabf1)},
+    0
+  },
+  {
+    {W(0xe32e878c2ef6309e), W(0x8ecf2f6fcc853d27), W(0x1f23ef81907b576e),
+     W(0x0920b8011a916e84)},
+    {W(0xcf24c0eb74f94a63), W(0x65c57f4b5f0b0578), W(0x542bacdb9e3e57db),
+     W(0x78f897e799a81b9f)},
+    0
+  },
+  {
+    {W(0x498a22c205c20420), W(0x177fb6b6fa1bf464), W(0xd05e8e54cbb502fb),
+     W(0x7aa0004e3a7c8088)},
+    {W(0x0a73f511e7d94dee), W(0xf1f57351cdd2024e), W(0xcf8464dc7e129fed),
+     W(0x1c903dc0213943af)},
+    0
+  },
+  {
+    {W(0xaffab4ec2a83d406), W(0xfca2574144aa7da5), W(0xfa037029d5b8b559),
+     W(0x7ec041ca66dfd897)},
+    {W(0x655adf7359a9fd98), W(0x0a939bfb38f4e66e), W(0x6a1d0deb64f18ce2),
+     W(0xbd1a7494aaacf6ba)},
+    0
+  },
+  {
+    {W(0x09fc83dc98656635), W(0xed16c4c9f15b9894), W(0x24dfeb6fbd6d38ed),
+     W(0xd4281091ac7d9568)},
+    {W(0xb4ebaa466edbd865), W(0xfaf656c603c056a6), W(0xc4ad5fdb6fd706c8),
+     W(0x1c228ac0c7e865d8)},
+    0
+  },
+  {
+    {W(0xfee3d06b26425743), W(0x2e49ed4a1a8984ed), W(0x2d40ee32226eb2f9),
+     W(0x137e935ef99f9f13)},
+    {W(0x44fdd7a574f34354), W(0xfdc85fa52e9f0782), W(0x0c16cb66e23b750a),
+     W(0x2802bcdce7195af5)},
+    0
+  },
+  {
+    {W(0x72d1d1fc39055c44), W(0x27f2b910e5c29e35), W(0x0b80b3107284f295),
+     W(0xf1730339944a9efb)},
+    {W(0xce6ed64197db8014), W(0x3b1d1a3c867be3e7), W(0xf35b600694936dca),
+     W(0xfc6e1a3c27daa4ee)},
+    0
+  },
+  {
+    {W(0x11172b3f88075dfe), W(0x02a01b3d0a5f7209), W(0x0a2754852cbdf9fa),
+     W(0x632482a5395b144d)},
+    {W(0xfb0941fef3c18d36), W(0xde533a142a66c0d0), W(0x815f532d82604bde),
+     W(0xac4140bd83354f79)},
+    0
+  },
+  {
+    {W(0x87c3d48ac3559979), W(0x57d8245b66311320), W(0x219818c0636d9c4a),
+     W(0x571578b27b7d778c)},
+    {W(0x57941b7a1a063125), W(0x79ab2e1ab629ad35), W(0xe667a9cad05bca0c),
+     W(0x65a8e894162b86e2)},
+    0
+  },
+  {
+    {W(0x69289e6fc435712d), W(0x015aadbe2a78632f), W(0xf984ca7c1154a7e4),
+     W(0x280721401690586b)},
+    {W(0xb413ba8981adbcd3), W(0x843227edd0388959), W(0x4b997b0935c26492),
+     W(0xdea0cfde7cdd781f)},
+    0
+  },
+  {
+    {W(0x729f7323e6451f96), W(0x405534437bd3a1d2), W(0x08b061c6c46656f1),
+     W(0x04d2cd9fd6fff3a8)},
+    {W(0x2baa937ffa1cccdd), W(0xeec383a3b95e64e4), W(0x523b97d2de5e816f),
+     W(0x491eab9683cd58c8)},
+    0
+  },
+  {
+    {W(0xb61fd57aa2e0e06b), W(0x23dd8cfce80bfcd1), W(0x974416bec1e03324),
+     W(0x4bcbe333b8bc7d7b)},
+    {W(0xc52acbe39190219a), W(0xe8c50d3d619d70e5), W(0x2def6e9440a75057),
+     W(0xddbd10499310b5ca)},
+    0
+  },
+  {
+    {W(0x7c428b5e54688ff6), W(0x1dbcd4be30852767), W(0x9906ca5bca4945a7),
+     W(0x4fb977e1193174ec)},
+    {W(0xc8a21a33f2578597), W(0x769459e900268b82), W(0x4caf6427d1516597),
+     W(0x7633c296a19e5fb8)},
+    0
+  },
+  {
+    {W(0xb542e9ed7a56c683), W(0xe9bb2706fcd41332), W(0x42ca3ac911ae2dcf),
+     W(0x93e2160dfd4a2ad5)},
+    {W(0xb17e3d4365ca413b), W(0x373050e724a2d20f), W(0xb082d6e01d59c624),
+     W(0xdda83f31081a886d)},
+    0
+  },
+  {
+    {W(0x33cd6cc04db11856), W(0xa1bbf63c9169bef2), W(0xb5aee394e000dc22),
+     W(0x52d54870a38ffa0a)},
+    {W(0x014fdd222971cff2), W(0xa5c680bf039bbb63), W(0xaa4d37389e9fa0f6),
+     W(0xae08abb75d7cdda0)},
+    0
+  },
+  {
+    {W(0x7df97e28dcdc93de), W(0xaca1042a8ace0209), W(0xd12ddea84529be23),
+     W(0xb7c6d7e4dadc2de1)},
+    {W(0x5c05a8f5eda375be), W(0x7c64925be6243262), W(0xdbbcb6cb1b138edf),
+     W(0xd10ae0ec46a8dfdd)},
+    0
+  },
+  {
+    {W(0x6c06ef581c3304f3), W(0x02dd6f86b9efa24e), W(0x0fd071eb5a4c464c),
+     W(0xe22f0e825fec2d85)},
+    {W(0xaed749682f5103a2), W(0x05a00c9ab7a8c6ad), W(0x8b1d752e51bea391),
+     W(0x54e200ec2a3757bb)},
+    0
+  },
+  {
+    {W(0x01492e47503b332a), W(0x9eb562d7243551cc), W(0xaa93c1c3d7af4c4a),
+     W(0x81fcf33d33663cef)},
+    {W(0x4bd5eb6232d99362), W(0x3c9202a8af01d134), W(0x2d0026af0e64b37d),
+     W(0x141eafae69f094ff)},
+    0
+  },
+  {
+    {W(0xda25be2f62676bfa), W(0xf405d29ffdafb9b4), W(0x43a71ce23f121296),
+     W(0xbee52f14ea38cd29)},
+    {W(0x60853c71db502609), W(0x565a1940f5e4d56b), W(0x2efb1f4c2c91bde3),
+     W(0xb9be5f3677abad7e)},
+    0
+  },
+  {
+    {W(0x5a78bc041b9739b7), W(0xc6729d6de89f951b), W(0x3113552d14d7b926),
+     W(0x278782363a224202)},
+    {W(0xd131e116504fd29a), W(0xdc23a5cff58545b8), W(0x65a1185c9e73e0c8),
+     W(0xb300c6a7d9598a02)},
+    0
+  },
+  {
+    {W(0xe18ffa13dc64cac8), W(0xf42b877b512e16b4), W(0xd79994e31ec28232),
+     W(0x167251addaf18f03)},
+    {W(0x594a2bf98a7b306e), W(0xf14af5306d7c6003), W(0x63daa23b91cc571f),
+     W(0x8b6c7770e131e19c)},
+    0
+  },
+  {
+    {W(0xf14210176267bff2), W(0x5a16ed73c1076c04), W(0x92c9745eb9916af4),
+     W(0x150fd0f25040b130)},
+    {W(0xfcbafeaca0c2cfa3), W(0x1143f4d65a6f5fca), W(0x2b0f6a74b081d06f),
+     W(0xed26aa65cebd97b7)},
+    0
+  },
+  {
+    {W(0x3a69629c1c500f93), W(0xfb28352e5ec1e2f9), W(0xe802a2280bb07d9e),
+     W(0x19874f5dc72dcbfc)},
+    {W(0xd24de9f274e594b3), W(0x729ac9fd53aed23d), W(0xf45d3eaa4ec5883e),
+     W(0x4ed6bc3011284450)},
+    0
+  },
+  {
+    {W(0x8a990a4d37e71faf), W(0xf80925b26b8feec0), W(0xbb3c4f5c2d28e782),
+     W(0x9a73e00dfcf5b825)},
+    {W(0x73b1316723af6209), W(0xbfad3fe1706ad55a), W(0x3d99ceaffe0e9463),
+     W(0xcafaced262536f9e)},
+    0
+  },
+  {
+    {W(0xd67c8aef169d91c0), W(0xca0ec545840704ac), W(0x1c64500c39572d17),
+     W(0x21eb96e5dc112bd3)},
+    {W(0xe344569953a13a10), W(0xb287e3fd27aa853f), W(0xedf18ae76b9e7fb1),
+     W(0xafa260e07a9b65f0)},
+    0
+  },
+  {
+    {W(0x44e10e8e44778df9), W(0x17ffe739f2583227), W(0xa35313665b7bfd0f),
+     W(0xedf170b856667602)},
+    {W(0x30ad9f62c9c88d7a), W(0x01aa2af8c42797e8), W(0x358a97b2838b5a2b),
+     W(0x61a59b76c887485d)},
+    0
+  },
+  {
+    {W(0x8dc6831f6ff730bf), W(0x2de03a56c8423aff), W(0x5fee5d3ab238bd7f),
+     W(0xf168b80f55f66a4c)},
+    {W(0x0f41fe5c36648e62), W(0xaac1837fb616b05d), W(0x00887e358466e63f),
+     W(0x8e339835e6c18f8d)},
+    0
+  },
+  {
+    {W(0x744e69f982084099), W(0x2aaeec6d03a748a0), W(0x924d4a8bcf4265bf),
+     W(0xa531e39aa1921529)},
+    {W(0x6470282665e5f0de), W(0x8f6ed076a243ce8f), W(0xb0bb6ae0488d2c34),
+     W(0x6893dcafa69e8816)},
+    0
+  },
+  {
+    {W(0x5317319ba6dabe33), W(0x57fee53d62219ca1), W(0xb8a916af4a17bd9e),
+     W(0xbbaabe1c1a151c2b)},
+    {W(0xba3ec760f81ae5a2), W(0xd57834300d6ebb58), W(0xf80fb9b328c1a21a),
+     W(0x956c8ab327c426b3)},
+    0
+  },
+  {
+    {W(0x1a001d2503dc3071), W(0x8ddc0371704d0727), W(0x7e6ea31e7ed6f3b6),
+     W(0xade2e5b8dd213629)},
+    {W(0x65a1420349bc54b3), W(0x034f8544d03eb75c), W(0xd540901dd95a9195),
+     W(0xe616fb1bbe4af947)},
+    0
+  },
+  {
+    {W(0x1c2be5a1f000dcb5), W(0x2e8892ebb75d56dd), W(0x69f01fd241c06fb3),
+     W(0x8259131e265b4f90)},
+    {W(0x4e984952a7b09b9b), W(0x27a3a2a7e5182e46), W(0xe0e0e2a5ef7d106a),
+     W(0x91119a811cc5f911)},
+    0
+  },
+  {
+    {W(0x205b46ee9f7d39e5), W(0x8ede4117d721db54), W(0xfee7104c282cf85b),
+     W(0xbb2fa8f232211f56)},
+    {W(0x93716cdddb1a2dcc), W(0x7601ef00a27632a3), W(0x10a06fba64472118),
+     W(0xfc045283097572d5)},
+    0
+  },
+  {
+    {W(0x4fb6327c3141c202), W(0x6e6ae3e378b2d500), W(0x8c6092efdb8f5531),
+     W(0x38b46705282561bf)},
+    {W(0xa1e36bf8c32e64bc), W(0xee283c86bbe048f5), W(0x0e4d0b0f26d917d7),
+     W(0xf2390f05e20b153c)},
+    0
+  },
+  {
+    {W(0x4acfac55ecc757fc), W(0xd2eb6ca9fac4396f), W(0x969817993da0a05c),
+     W(0x26b6220acacf752a)},
+    {W(0x65181771b871c99c), W(0x9b38e71d7e9b6498), W(0xabad72db52405fdf),
+     W(0xb7442c97b3d5389d)},
+    0
+  },
+  {
+    {W(0x4ef4b9721075d074), W(0x4de0f0c1e0470414), W(0x44fc503e6aa7c27e),
+     W(0x89be11f90c9321cb)},
+    {W(0x1fb5b206bac5be4c), W(0xfb6677c1d66208d5), W(0x190f28b4d948a49f),
+     W(0x347816b9c16c58c1)},
+    0
+  },
+  {
+    {W(0xbb2590bfa0c6b2a3), W(0x49f27da534994d89), W(0x60dc4fc4b68e9fe6),
+     W(0x16c80cd581486ec3)},
+    {W(0x4dd7e2fe172a6095), W(0x256800a5f813263b), W(0xfcca52afcc47c0ab),
+     W(0x583ea48885311a22)},
+    0
+  },
+  {
+    {W(0x85bcddc126bc4bf3), W(0x7f281f295e4b0a35), W(0xb5c051442b5a3263),
+     W(0x2b8f7b5fc485b25a)},
+    {W(0xa91349dfda47dd50), W(0x77171c5597049e4b), W(0xb34c6474b14aeefa),
+     W(0x053e3747f3e452cd)},
+    0
+  },
+  {
+    {W(0xa7d0b171a7ad4d6c), W(0x60c6a35d708c10dc), W(0x58a8c830f46735cc),
+     W(0x3891e4c655981e80)},
+    {W(0x5d0633a18dfd65c4), W(0x508f4ab3106a7e91), W(0x4a9e4c8f43664bd5),
+     W(0xb71bd7fa97116dc8)},
+    0
+  },
+  {
+    {W(0x32cec4dd0928044f), W(0x00e5b34b69901264), W(0xdc63f020ae64a867),
+     W(0x06960f084c580118)},
+    {W(0x8bf1906c759b462d), W(0x163764b1567de1ac), W(0x6e29f6ee112dfa51),
+     W(0xc5a45326b90fa578)},
+    0
+  },
+  {
+    {W(0xa11efe4c156ce40f), W(0xb4c9ae2fa0fd86ad), W(0xe4efbfce4bebb324),
+     W(0x24f30ed1b3d640ef)},
+    {W(0xbdb2b2bf045fa933), W(0x688712d5996cbc68), W(0xc8d45343b6d5ed19),
+     W(0xa0c757986a25008d)},
+    0
+  },
+  {
+    {W(0x6b596de6bd351f46), W(0xb45faac79f98f4ad), W(0x84954c49cdbc5107),
+     W(0x05781a6331c56f8e)},
+    {W(0x35630ff503ddc2c7), W(0x3c32d5fbdbe69bbc), W(0xc66024a2cdaf0c9b),
+     W(0x16b4a823aa0ed390)},
+    0
+  },
+  {
+    {W(0xdeed697f26eb3e9e), W(0xf4c07faa82d03778), W(0xb14a6926ff132184),
+     W(0x970c19793fe9362d)},
+    {W(0x018717a02221b94e), W(0x95c84b7942baf031), W(0x22f90c2669cbbe40),
+     W(0x57593d4f1938e374)},
+    0
+  },
+  {
+    {W(0xd3dfaef895f28eee), W(0xac476011058a96de), W(0x37275030a309797b),
+     W(0x04c6abf9ab00ff2e)},
+    {W(0x16c81b3d1ea14971), W(0xfa0b84183f381928), W(0xfeffa4364ffd15c9),
+     W(0x4d0aa58071d2601e)},
+    0
+  },
+  {
+    {W(0xfaeb87b56d366db7), W(0xe4423a01845c4599), W(0x0b44b790bdf78405),
+     W(0xe358c8f4ef41e6ce)},
+    {W(0xdb78cc475fcfb995), W(0x8298657ea8562056), W(0x7b901568814ea28a),
+     W(0x3984bf9f94c5fa34)},
+    0
+  },
+  {
+    {W(0xa957a68dafd6aa10), W(0xc7e612a48dbded37), W(0xf2f67d7800a1c61e),
+     W(0xe7c1773524959964)},
+    {W(0xfea0fbff41b6f712), W(0x037d4aa507b45891), W(0x2ee96d2b59a1ae49),
+     W(0x9abfe2c6bfe1b12b)},
+    0
+  },
+  {
+    {W(0xcd648f5dcdb21a09), W(0xdc2a50debe46398c), W(0x62d6490cbe53e500),
+     W(0x0d5c06be7c419aa0)},
+    {W(0xe1b0d394f0528dd1), W(0x121fdee00164355e), W(0x3a88f95c9c51f50d),
+     W(0x3c9e7c6a2fb046ed)},
+    0
+  },
+  {
+    {W(0x35353cce0d129e60), W(0x7317c54f95dd5042), W(0xc1634ba907a95f3c),
+     W(0xacbf1872bb3eefc0)},
+    {W(0x4a2cd94dfc467e75), W(0x4e26dbd3d1054145), W(0x5ee399ec980169d5),
+     W(0xb24d91ff43dff55d)},
+    0
+  },
+  {
+    {W(0xe062abbb1cd097a3), W(0x650395e4d6402744), W(0xd62532f059cdfa8f),
+     W(0x4c5ead5749e606b1)},
+    {W(0xabbc2b919135d0ba), W(0xbef4c7bbb7842b9b), W(0x05e6924f553cd718),
+     W(0xdd3621c949c3d1bb)},
+    0
+  },
+  {
+    {W(0x1db7d2df5c487a62), W(0xf333c2798dbc7143), W(0x3c9fe566fc76582e),
+     W(0x0dd8bec72697debb)},
+    {W(0x7a725acfc9057f32), W(0x74fa6425b5891c08), W(0x2bb36a366e787c27),
+     W(0xb4889669fa964656)},
+    0
+  },
+  {
+    {W(0x7020700ae563a661), W(0xa98fe02567e67dcf), W(0x255ea5bcd2c3c3f4),
+     W(0xb9831c1bffc1d559)},
+    {W(0xfd4161e745d46613), W(0x80f71d03e527698f), W(0xd5f31da276d6b1a1),
+     W(0x7e79b6869996a694)},
+    0
+  },
+  {
+    {W(0x6a2c1539ab6a1af2), W(0x033a49af5dd46d64), W(0x53a491fe59835652),
+     W(0xd0d0da29c96b89c6)},
+    {W(0xa868b73a5d080f06), W(0x689c45a8a717ceab), W(0x81fce132b973f7d1),
+     W(0xeb0bd8bfda870ade)},
+    0
+  },
+  {
+    {W(0xb2afcba4841fb00d), W(0x9169873dd250d737), W(0x48790f5fc7370e4d),
+     W(0x24d460698d6b8cfc)},
+    {W(0x04b9f292761e94f4), W(0x0862baa50c7d4143), W(0x30729d0c5abe4048),
+     W(0xd1ee2ee5ee7ca4c0)},
+    0
+  },
+  {
+    {W(0x1a55c27fdbbb5403), W(0xc16642e850e29589), W(0x3e302fbc9c0e812b),
+     W(0x281c86041cc25c50)},
+    {W(0x1396b32871c93c05), W(0x690f14a87e8955e3), W(0xd7ba016136301737),
+     W(0x769affd4bebdd08a)},
+    0
+  },
+  {
+    {W(0xb96928451b1df36b), W(0x5de0a2c9af69e36e), W(0x5e7b52a62fa6a063),
+     W(0xa86a545764e9bdce)},
+    {W(0xe28d122f5ed9264a), W(0x19596294b8d738f1), W(0x5835d431519f19ab),
+     W(0x5597b635aa7cc0c5)},
+    0
+  },
+  {
+    {W(0x2a851c39ad535c19), W(0x41a39beaaf07b69f), W(0x19be3faee8a3126d),
+     W(0x97907146f7ff4297)},
+    {W(0x9249dfbea17bdbd7), W(0x8b11c6a10fa173b2), W(0x7329f75bf47768c5),
+     W(0x0ae8446d0a8837a5)},
+    0
+  },
+  {
+    {W(0x3a44d4777901a64a), W(0x2afcd5ef939ea590), W(0x3ef956ba58f8e92c),
+     W(0x18398befa0b8fe31)},
+    {W(0x304440af97256ca3), W(0x67aed0bdaecba8cd), W(0x5f1c03a770fd8299),
+     W(0xca6a7e0004f8285f)},
+    0
+  },
+  {
+    {W(0xc494cb5707074759), W(0x947310f292cff2c7), W(0x13623abb5136c912),
+     W(0xaf619428f5458309)},
+    {W(0x44372d89a0ead23f), W(0x30d13373555bd6b6), W(0x1830f9a75ffbc0e6),
+     W(0x1b3fe0f03a500beb)},
+    0
+  },
+  {
+    {W(0xaa95c49998177b8d), W(0xfebb534ae824edd2), W(0xe90ec2d223b277a3),
+     W(0x3b3d7a24dc23e2dd)},
+    {W(0x3f4b665a122d7025), W(0xb9cb2216255a7e1e), W(0x84379502fc913258),
+     W(0x373abdefbb34ed46)},
+    0
+  },
+  {
+    {W(0xc1fb0dcf9ed1ccb1), W(0x5660985d3c8a4320), W(0xcf372cc3d817e2bb),
+     W(0x461fab9e36d2ab11)},
+    {W(0xb0691219842991ed), W(0x7b16a33ee984848b), W(0x9ac1a4f13b5258d8),
+     W(0xa4f8a5d27acf074b)},
+    0
+  },
+  {
+    {W(0x28bee015e466a158), W(0x7767bdb35d9a0ffb), W(0x467065dd728572b8),
+     W(0x5829a54b9d774645)},
+    {W(0x25167bdab2ed314f), W(0xa234900cf2e54574), W(0x3128f3987037c48a),
+     W(0x2001ee048d2d621e)},
+    0
+  },
+  {
+    {W(0xed60d4884bce5a1b), W(0x6b467714ae70107a), W(0x1f7192aa181e2a6d),
+     W(0x5414109057ade49e)},
+    {W(0x32d0c3e073c90883), W(0x8265e53e4b56ef6f), W(0xb552feb09f1a8e60),
+     W(0xca3b4c4139376077)},
+    0
+  },
+  {
+    {W(0x8422758bdffa9a08), W(0xebbe6dee88415c68), W(0x3639794793d9dd59),
+     W(0x3fc98cde74c25ac1)},
+    {W(0x7dd337aa70d648c7), W(0x2fccd18ff4b4eb3a), W(0x7dc3baade372d090),
+     W(0x3ccbf749d9fb6237)},
+    0
+  },
+  {
+    {W(0x4640af058d08868a), W(0x866d8f8eea32e495), W(0xa8b467b09a376640),
+     W(0xa5f1ba4de53c9a7f)},
+    {W(0xb57861f16a87efbe), W(0xa1b3a6df268438a7), W(0xf356a98fb6f7d60c),
+     W(0x316b42a6bdf97de8)},
+    0
+  },
+  {
+    {W(0x6ad2bffec8d0ddc6), W(0x9e4320f1603225e6), W(0x3d9dbd6ac25ac1b6),
+     W(0x112bdd8846c7054e)},
+    {W(0x8f333cf3175d94af), W(0x297c14baa1e1a496), W(0x89c86f656d9df740),
+     W(0x641f16c36c9e3c4f)},
+    0
+  },
+  {
+    {W(0x085e6baa31f2883c), W(0x7125f8c6e2f3fb12), W(0x07a8794bb8e243cb),
+     W(0x16a8a3d5bb211166)},
+    {W(0xa35aaccbdcdb6a35), W(0x6ba203404e140c50), W(0xfc24711815803e21),
+     W(0xdc68b525ee57a665)},
+    0
+  },
+  {
+    {W(0x87c9ce3728f2aa5c), W(0xd05d6a777a9f48f8), W(0xe2b8277430a69375),
+     W(0xa81a6478a8ef00e9)},
+    {W(0xea5ec5c991b6f0e2), W(0xb58e939d11f9f651), W(0x220aae06942fc194),
+     W(0xfae94f986408bf2f)},
+    0
+  },
+  {
+    {W(0xe056871db1577685), W(0x3701f211c4592db1), W(0x5e95e44f3e2b986e),
+     W(0xf87bbd283fb02695)},
+    {W(0x1cd685eaed22c11f), W(0x8079cba1cdf556b0), W(0xf3ee58013623bba4),
+     W(0xfcd5dec6496bc71e)},
+    0
+  },
+  {
+    {W(0x19a613cff8dfd9ad), W(0xe079f7f4ed33f212), W(0xc1a2084782bd1c20),
+     W(0xd7458e54fcd3a776)},
+    {W(0x634102832072acdb), W(0x1a10b0f8694f866f), W(0xa02c9a74997d32f6),
+     W(0x13b2f1d5d8b15a41)},
+    0
+  },
+  {
+    {W(0xaaabda3f8a1872c6), W(0x5a7af7d64f519e98), W(0xe444f69ae7c15960),
+     W(0x839e4af55d8d2a8f)},
+    {W(0xc1516ebbb8be21cc), W(0x944c59f4e6482208), W(0xe6a8314e990a3705),
+     W(0xc331884563df2c51)},
+    0
+  },
+  {
+    {W(0x5f88b237685e9fc7), W(0xbbb354923ac9c0c4), W(0x1214bf55b8fd2caa),
+     W(0x48c8b52d01021c87)},
+    {W(0xa4b0233a71d2c12a), W(0xcdf26da12aa7a71e), W(0xe8879e55be549400),
+     W(0xd4756005479edfa3)},
+    0
+  },
+  {
+    {W(0xeac02494fc975ebf), W(0x50cbf9659a83f7a9), W(0x6d21dfe03a226534),
+     W(0x78c3f7890f9912b7)},
+    {W(0x9ad192d7587533a5), W(0xf59489ef03f7c359), W(0x34fa0c36e62c4d09),
+     W(0xd8eb8b4d33cb749d)},
+    0
+  },
+  {
+    {W(0xe029ca27b0878f5b), W(0xd080dc08c8e49288), W(0xdb50d2dec8abe923),
+     W(0x3a086b1fac26da08)},
+    {W(0x0de3ce02dee0ee9b), W(0x6750e9902fafe84f), W(0xc596c31612780a2d),
+     W(0xdcd58dcf7701ea8f)},
+    0
+  },
+  {
+    {W(0x0f8226597d49929d), W(0x1646202bb1eff3e4), W(0x01a10ad44c3f3d61),
+     W(0xf8eeb7a65c5b54d6)},
+    {W(0x190a19956a3b00dd), W(0xc63c1e8b5f45feea), W(0x6accb0c12d39b7b9),
+     W(0x79df8308f9fc2810)},
+    0
+  },
+  {
+    {W(0xee50d59ea13483f0), W(0xbbda2f1ec57d3ad5), W(0x492830e17e9c8c29),
+     W(0xfd5cf10110cb6a24)},
+    {W(0xc5bb8aa7c170f397), W(0xb450bd89e7aa1f57), W(0x5f7486c261633229),
+     W(0xf4a02377fc35b833)},
+    0
+  },
+  {
+    {W(0x879652c33699e722), W(0xd73b891f9eeafe92), W(0xe5b371a62dc5fa6a),
+     W(0x79145e4794d6b57d)},
+    {W(0xe6bf3dcd042729fc), W(0x4e04b6c75bddda0d), W(0xfcbfafbfdb293973),
+     W(0x18e4caa10777bef1)},
+    0
+  },
+  {
+    {W(0x8a44b9a253c358d3), W(0x3fd927ec0311625b), W(0xaa681c90708cc542),
+     W(0xb600c3612dc8c73b)},
+    {W(0x49871c4cba6d5ebf), W(0x40a02538e73518b3), W(0x6283db92a21f7f0d),
+     W(0xf430c31b4937b569)},
+    0
+  },
+  {
+    {W(0x6ad1116b48ee411d), W(0xd5e91c9f1131561f), W(0xdb8dc46dbef8a7d2),
+     W(0x595d16fa0c3403d3)},
+    {W(0xcce66c291316e431), W(0x2c28480de2aac5cf), W(0xf62ae1b300112b87),
+     W(0x340cd1c4f61b64b3)},
+    0
+  },
+  {
+    {W(0xed2cf4be1bf44e47), W(0xad70693d99471f9e), W(0xa8a836448bb3964e),
+     W(0x64648251268ee0a0)},
+    {W(0xbfe3f77e364b3992), W(0x7a119d05e5e77bab), W(0xac71c21a1c28ca6e),
+     W(0x96748c6899eaa223)},
+    0
+  },
+  {
+    {W(0xd5aed49bc7b4b60b), W(0x7f806f8f03fca923), W(0x4e4c1944aedfcdbb),
+     W(0x5ea45be13d69ef8d)},
+    {W(0x47b4c41ef07bf529), W(0x24bb2930eeb1a671), W(0x3fcdda8a5ed96254),
+     W(0xfdf24e1cf6b0b9d9)},
+    0
+  },
+  {
+    {W(0x25fb29e7d5804d84), W(0xe179a37618275c4b), W(0xf709a78848477a06),
+     W(0x2866e96efa7e6993)},
+    {W(0xc3bf20c57392e89e), W(0xdee102c466ff3486), W(0x0b5229cb8bee2451),
+     W(0x1b8d8b74dfd662f2)},
+    0
+  },
+  {
+    {W(0xfffdebc71ddc75f6), W(0x98da2aea958e0e04), W(0x30d3b1010fdde86a),
+     W(0xd1105fbf335a83ed)},
+    {W(0xba8c0fdd2fada142), W(0x4c7097db50414c76), W(0x96bea564bf17f7f0),
+     W(0x5ae53cc54bd50597)},
+    0
+  },
+  {
+    {W(0x040e73d9bbb95cf2), W(0x2d8305939469bf40), W(0xd10029e29f608ed5),
+     W(0x006778ab0636e07e)},
+    {W(0xae6a31b08b9fc64f), W(0xedf3b6487e2f521b), W(0x4749d6bede2b30d3),
+     W(0x34a9dd89ae3e2ca9)},
+    0
+  },
+  {
+    {W(0xbd7903ffc8e99eb6), W(0x1ef3573ef41969a6), W(0xa1d592e5bb9a7c20),
+     W(0x39615adf94c1e5b4)},
+    {W(0x8644070e50b88c51), W(0xf80f5c5420a3b1c1), W(0xf9f8bc4ea2f69160),
+     W(0x1140ebec63d39e5b)},
+    0
+  },
+  {
+    {W(0x18e9f9857d37ccea), W(0xe8c1ce92b6e57a52), W(0x18a19ac254821c6d),
+     W(0xdd8ab306582ec693)},
+    {W(0xeae18bf0f2ac54cd), W(0xcb2881d0703d2d20), W(0x95be65d93f6f7dad),
+     W(0x13fc45ff5f90a6a5)},
+    0
+  },
+  {
+    {W(0xcbb07b1f029d7c8e), W(0x5610bebcba60b11b), W(0x2fd204e4f8d2d814),
+     W(0x03082e9fd412cf8f)},
+    {W(0x3c1c544ca6af5967), W(0xe6429cc64c47a4d6), W(0x4b89f6dfaf8b6184),
+     W(0x00f56eaaad844605)},
+    0
+  },
+  {
+    {W(0x2979497a386786e8), W(0x25190b5afaee8968), W(0x2de994a8eee429a4),
+     W(0x932385b7799d0c02)},
+    {W(0x7340d25112b8201c), W(0xc8a014ab442b845b), W(0x881727b4c132b91c),
+     W(0xe56f1c5b90329876)},
+    0
+  },
+  {
+    {W(0xf110b6ff4ecf471c), W(0xea107ad62b288d8b), W(0x65d35cf40728739b),
+     W(0x0a1222fc9c890001)},
+    {W(0xe4e34e2e62f7c172), W(0x7e9113e2149c4b1b), W(0xfd0310559b3f65d5),
+     W(0xc41bdc86bb5d3c9b)},
+    0
+  },
+  {
+    {W(0xddb707a3bf181da0), W(0xcc126c832f436d20), W(0xa802b0c4afd555e6),
+     W(0xb52b9ea5d07e77f4)},
+    {W(0xa5901f2f9231bb89), W(0x916cc350c8d9b78b), W(0x33cb42aca3470d00),
+     W(0x04baf157a83aaf25)},
+    0
+  },
+  {
+    {W(0x796955b20ff863e6), W(0xa97937b9e02ae8c4), W(0xa7ed6a8c14663dd4),
+     W(0x5f75486962e2149b)},
+    {W(0xda532a8078840ea0), W(0x355f67aa05633be5), W(0x5dc00d4d0487732f),
+     W(0x16098374b6f45f36)},
+    0
+  },
+  {
+    {W(0x09dd20a7a32e2da4), W(0x929bfd924566fafd), W(0x750849f3cf3fc3ef),
+     W(0x0c069ad113f1bbff)},
+    {W(0x78ab65e26f695876), W(0xdcf8170b518c50b2), W(0xc22623aa26a6afcc),
+     W(0xe0b55556c49e56ac)},
+    0
+  },
+  {
+    {W(0x587c5d998ee52f81), W(0x71d51910ad59ff29), W(0x2ad84433e4b32f23),
+     W(0x23ccbe73b87ba242)},
+    {W(0xa5d8e67bd98f09e3), W(0xd072ccfc7749d098), W(0x812f5b6f246192ee),
+     W(0x96e2c6a3bd80e68f)},
+    0
+  },
+  {
+    {W(0xc83198a38ee5509b), W(0xdfb0ca2e5fa421b2), W(0x64989f0798f333f2),
+     W(0x0f06a14c9e1b2284)},
+    {W(0xabe4b8b1133e13a7), W(0x9136e7c32dbbfc16), W(0x1145d2775e597f75),
+     W(0xca335fa33e6c85a7)},
+    0
+  },
+  {
+    {W(0x5eaf9c0906496c9f), W(0xc413b0d3d9117758), W(0xef89b19ce7ff44a5),
+     W(0x95f6e1b1f84eafb3)},
+    {W(0x7206f8f23ae0fcc8), W(0x16df028d6310f952), W(0x02a1647c2227a995),
+     W(0xb0fd3ae282d37210)},
+    0
+  },
+  {
+    {W(0x00b1a5e049aa9b04), W(0x773597b96e5c2f18), W(0x8b09e6920c1a7ee8),
+     W(0xe3ae6974e388ba86)},
+    {W(0xa53829e845910c37), W(0x00c599ebb44f9464), W(0xdb32f5975e3573f3),
+     W(0x8f1cd16d71ef1595)},
+    0
+  },
+  {
+    {W(0x71f0369c6b1e447b), W(0xf8060baf3923e151), W(0x1952232234e07cf5),
+     W(0x50220d5b3f78dc5a)},
+    {W(0x8d1f81779d4ea936), W(0x7d4b4ce8a63a92e1), W(0x7736726575fe1d31),
+     W(0xd7d18794faa90e06)},
+    0
+  },
+  {
+    {W(0xc871cc224a019dc3), W(0x0502e9a84e662bde), W(0xd18e979c7c152a4c),
+     W(0x35bafa8e653a60f5)},
+    {W(0xc0697d2ee84a589c), W(0x91b42a4a1b61a5ad), W(0x344eb353f8386b2d),
+     W(0xf5876eff5c17ec96)},
+    0
+  },
+  {
+    {W(0x01b2c74c39516671), W(0x28e8bf1226c48ea1), W(0x3a9ab19b972d9d57),
+     W(0xd81c76137ee93f20)},
+    {W(0x0c0d0183c49177dd), W(0xb1df02ecdbaf224f), W(0x6feee3e9d3e963da),
+     W(0xf071b890f872598d)},
+    0
+  },
+  {
+    {W(0x304abeed1d52f137), W(0x4d16b4d49a023ba2), W(0x8ba1d3e8bb914d6d),
+     W(0x217c0542fe63f9de)},
+    {W(0x420deba512fc8aff), W(0x0f14eb6b272fc49a), W(0xe0a76f84669d378d),
+     W(0x91e8183aacf035ce)},
+    0
+  },
+  {
+    {W(0x682e64a9711a4fd6), W(0xa8d2d5235e621ee0), W(0x7943788ba32d7c9b),
+     W(0xd788ff30fe545d27)},
+    {W(0x540d4fe05c1d56a0), W(0xe35a61b17ea66b8f), W(0x7a545b93f365bcc9),
+     W(0x99dcb938d12dd7ea)},
+    0
+  },
+  {
+    {W(0x7dc0a719e2c56fc3), W(0xdc2d8edce09c6795), W(0x4d60a71ca8f91fb3),
+     W(0xfabda6af45c9ff29)},
+    {W(0xa6201e80f4df300e), W(0x9ce9a1fe15c508e0), W(0x45543166d8208f35),
+     W(0xe5f155fb38e66666)},
+    0
+  },
+  {
+    {W(0x68bfe658ec9aeb5d), W(0xd04211d2cc23525d), W(0xc68ec45bc3bce382),
+     W(0x5a4576146de4699a)},
+    {W(0xd692cdfaacd16cff), W(0x38f91e9be115a7f3), W(0x10a15c9999e4549a),
+     W(0xb48ac7178fb16fc4)},
+    0
+  },
+  {
+    {W(0xe3462368ab00f469), W(0x070a5f7b15aa4803), W(0xde176688b631ce52),
+     W(0x2f96d869f03b8ea3)},
+    {W(0x335c3a925c77706f), W(0x3264a08e4764ff1a), W(0x198276f17602ba50),
+     W(0xd8a04e91b80c46a9)},
+    0
+  },
+  {
+    {W(0xa26bd4dfcf75b7c2), W(0x72654ae5e0b5b4f8), W(0xc7beef8fef8de9ea),
+     W(0xd4e036b912dc029b)},
+    {W(0x9345b49951975f3a), W(0xf81c44bbb7746017), W(0xc7f8670d04dfc5f4),
+     W(0x0a542afd1f0daa8e)},
+    0
+  },
+  {
+    {W(0xb960833e62cd8572), W(0xee34bfc53e09e799), W(0x53abbb07942c3632),
+     W(0x723e1332ecb567e7)},
+    {W(0x894d44f6ff10cc15), W(0xd9e1d5efbf8220fe), W(0x4f4428f615977748),
+     W(0x410bae1d748d3ccc)},
+    0
+  },
+  {
+    {W(0x286de206e74eaa21), W(0x122b843d109413ed), W(0xed2da0b2e9dd98aa),
+     W(0x5f29afe6b24df781)},
+    {W(0xe6c9412a7c1eb34c), W(0x92f9cdcd2cee6fd1), W(0x69aa3eda824fc6ff),
+     W(0xe7cd7f402ba512e8)},
+    0
+  },
+  {
+    {W(0x9bedebad9dea75ea), W(0x4baf9c4d7afd72d9), W(0x48e6bdf4adb74334),
+     W(0xa3a2a07721aabafc)},
+    {W(0xe6c90cf2727e2597), W(0x4b38a5aeb69867a4), W(0x91b00243622305ef),
+     W(0xfdc9ffcaaf596d88)},
+    0
+  },
+  {
+    {W(0x542da1fc9589858c), W(0xdafae16fb921801e), W(0x811752a3a059e1a0),
+     W(0x1bf992db101553cf)},
+    {W(0x7b35f8e3b13d2520), W(0x6ad71ea762b25cfb), W(0xd8936b86a8c3fe48),
+     W(0x3f69d0bf1dc3ee5a)},
+    0
+  },
+  {
+    {W(0x3908a5274cff454e), W(0xb247d2e2f319f8ab), W(0x1a2a28d763b8edad),
+     W(0xe0475f356456044a)},
+    {W(0xa277dfaee57cbd2d), W(0xe76193d30f0d4443), W(0x940f4671c6ff6380),
+     W(0xa14b455fab9a1246)},
+    0
+  },
+  {
+    {W(0x79854df9e45ece65), W(0xbbdaa8bcd7c54323), W(0x978cf2797d477432),
+     W(0xc319a41b71e75650)},
+    {W(0xd5aa751c9c41955c), W(0xafcc70e72d12e27a), W(0x62ec70c2d8c9c62b),
+     W(0xcb1d3af72187aa9f)},
+    0
+  },
+  {
+    {W(0xc1bc562c3e5fa556), W(0x0e9f3bf32d421697), W(0xed285e39b477e478),
+     W(0x83b6a27fe8f1a7d6)},
+    {W(0x410d57ff39500df5), W(0x9fa4e970640cf63a), W(0xe4669f632a21f8e7),
+     W(0x5cb103016d09e705)},
+    0
+  },
+  {
+    {W(0x12b637e8a43c46dc), W(0x4cfa54975bde9095), W(0xde2f4effa987a7ba),
+     W(0x084e89c69c18e63c)},
+    {W(0xeed8f4204227306b), W(0xfb3d55737e6a5971), W(0x98dfcbbb45c0510f),
+     W(0xe7632dd9f408f72b)},
+    0
+  },
+  {
+    {W(0x3b0de608b101d63b), W(0x3e4c38fa47d9ff89), W(0x5d0f2ca8650f6e5e),
+     W(0x6e941ab277d24659)},
+    {W(0x2435648229353d61), W(0x174ca55971c94c20), W(0x7a9d16525c58b332),
+     W(0x379fa72ec56896e5)},
+    0
+  },
+  {
+    {W(0xc6b832d7d1c94bef), W(0x2fbb332e423a3f5c), W(0x2d40cf1dcb5c2247),
+     W(0x3a2ef983417d7f9e)},
+    {W(0x44b6258d049b5630), W(0x48e5cd48df1fbeae), W(0x2edc7ebc5aed08ef),
+     W(0x36117266c0d8d0ba)},
+    0
+  },
+  {
+    {W(0x2ecea3e0cf2d129f), W(0x35f44666e1448374), W(0x41f51f0122b94b08),
+     W(0xfae2347c9ff8251e)},
+    {W(0xcb7cfa165449ff91), W(0xe14f4a39dc356e3a), W(0x5a45b3b9e076ffac),
+     W(0x987099477ef5ba5e)},
+    0
+  },
+  {
+    {W(0x4ede8e2d8c02275f), W(0x92728992d7efb51b), W(0x562a160b830dd332),
+     W(0x89a2917e27512701)},
+    {W(0x9af5c65fe734cc73), W(0xc314a25c270e8775), W(0x0e36e164fe49f251),
+     W(0x22acdaeb208c57eb)},
+    0
+  },
+  {
+    {W(0xf9d739e125b69850), W(0x97058963e415070e), W(0x3ced7cdfe5f777cb),
+     W(0x9f01792df1981ea3)},
+    {W(0xbed733866911cffd), W(0x7d648c2c96f4a145), W(0xad00f182647e1461),
+     W(0xf8a7ebf7d6a7bb3c)},
+    0
+  },
+  {
+    {W(0x0711f05b0b591b77), W(0xeb0767b2d707199c), W(0xfbf51009a89f6974),
+     W(0x07fd3593c3335b1c)},
+    {W(0x7ff8601c426b4eda), W(0x561755caf5a3b431), W(0xde3f82ed6fece20a),
+     W(0xa74a9b115d1f2230)},
+    0
+  },
+  {
+    {W(0x057df7a367c7accd), W(0x7ed05370e81f1e15), W(0xdd14a2a538e5bfdf),
+     W(0x10f8689c5ef2b5fd)},
+    {W(0x5ff1e1ae4336a35a), W(0x3f1d9d68a2941c24), W(0x57728882c1b33a79),
+     W(0x6865829b82757937)},
+    0
+  },
+  {
+    {W(0xc0c831f63204aab9), W(0x62c1dbbbd4f052cc), W(0x53b5a2ff4c4771bf),
+     W(0xe20693f80e0f0f8a)},
+    {W(0x848abf077438f22e), W(0xaf584f3b802cc31b), W(0x7f502cfbcbc6a7e6),
+     W(0xec0f0aaa494a32af)},
+    0
+  },
+  {
+    {W(0x884f4c9ea3c06eab), W(0x19a6657806bf23bf), W(0xc69cd88a06aa707f),
+     W(0x1959ee4b80446e64)},
+    {W(0x38903f6048ded513), W(0x67f32ca28ae95e50), W(0xdc5050e6a3bbfb7d),
+     W(0xf8e1ca15efbcf0e9)},
+    0
+  },
+  {
+    {W(0xef6d5d359ac4a2bb), W(0x66665ad6f7d468c1), W(0xfe72f3807bead60f),
+     W(0xad4ae84fb850cae4)},
+    {W(0x94f86c3dcdc2ca96), W(0xac91baadc6d3e0ff), W(0xd71b5b5a44817495),
+     W(0x0fc69394181dae06)},
+    0
+  },
+  {
+    {W(0x5cb1da947b8c7805), W(0x8a7a2f7776157e17), W(0xe58825e4eabd4c51),
+     W(0x06ece4481937c32c)},
+    {W(0x7b9cabd902de2e3c), W(0x7d02dbe2f78a7225), W(0x8908ce5958790ff7),
+     W(0x62be687c16155395)},
+    0
+  },
+  {
+    {W(0xb953e6e8ffa89f93), W(0x17920663376b81db), W(0x2665a9ca283d861c),
+     W(0xd9382794808bb351)},
+    {W(0xb0e046da7ca81caa), W(0x0958e0a30831d76e), W(0xb28543ccecdb747f),
+     W(0xe9f548f88d4d26cb)},
+    0
+  },
+  {
+    {W(0x9208b90564fc5938), W(0x0f476697c963674b), W(0xeb4ce87951d96d25),
+     W(0xb16f5d12587dbfe8)},
+    {W(0x3ce49ec13e4bf806), W(0xd9b875695681c650), W(0x9a901a49498e5bb6),
+     W(0x58854d89ccc03f9f)},
+    0
+  },
+  {
+    {W(0xbd95e9da00363b81), W(0x903bc297fc7359d1), W(0x6f2ea0f2750cec43),
+     W(0x05fb620812bb946d)},
+    {W(0xbf1a8871e10c114f), W(0x417541ca9e6546e0), W(0x122a5c0334ec4f31),
+     W(0xe101a6e5e0952915)},
+    0
+  },
+  {
+    {W(0xd675e888cfe9353c), W(0x251f96b1c32429f8), W(0x3e193e836cae1341),
+     W(0xeacbd4662dac7f76)},
+    {W(0x9a211f19ab346944), W(0xe3ac5f1c36e4d8bc), W(0x3f2c33a255a4ac37),
+     W(0x8ef91117f04adb3b)},
+    0
+  },
+  {
+    {W(0x9c61b139e836beea), W(0x99ae4f2f96f0214c), W(0xd2fd94442bc76019),
+     W(0xf4fb054b1f3ab08e)},
+    {W(0x9b47f1a4f98ad1d1), W(0xa4252478978d8d5a), W(0xb4b111fbe24a840c),
+     W(0x7f666ec8d3b13486)},
+    0
+  },
+  {
+    {W(0x3565dc4b1dd54902), W(0x2a75edac5768386e), W(0xcfc1bd3a8f5b90a0),
+     W(0x0ecd8db2fbe73fc2)},
+    {W(0x090e15aef59eef69), W(0x3364940e28e89f9b), W(0x4937c35d0c1386e6),
+     W(0x5c4b2cec47cad931)},
+    0
+  },
+  {
+    {W(0xb57b0253a3a38547), W(0x408f67e70c497b91), W(0x2ed3da92d64a29d2),
+     W(0xe35a38bffb32b6ec)},
+    {W(0x22c2089977464f82), W(0x580a32a2e33d5971), W(0xcc2c382b3f2db214),
+     W(0xd9f333b727c3f139)},
+    0
+  },
+  {
+    {W(0xa626b6dba3b505f2), W(0x1f7a6f806ebe3b49), W(0xbf12fe81625b1032),
+     W(0xbf43998780c31009)},
+    {W(0xd558a8f0f2bac9dc), W(0xbf517092b4a3eeeb), W(0x01f11c27fb67c829),
+     W(0x445b91bfd72aca86)},
+    0
+  },
+  {
+    {W(0x64eddad7d7bff90e), W(0x7aa954301ec9eb2f), W(0x1490355128841be6),
+     W(0xd921a998174b0d97)},
+    {W(0x19d5a17f27078ca8), W(0xd7eac5ea3b2fa140), W(0x99dba46056148d8d),
+     W(0xa60d112942530169)},
+    0
+  },
+  {
+    {W(0x4c57988e19cf8439), W(0xd047e233e827aa0c), W(0x34720993bd525c7f),
+     W(0xae6e120fc8260e9a)},
+    {W(0xcaeb4a7a4190eb59), W(0x9d0d466c0bd651a1), W(0x01e8d838bf61e100),
+     W(0x789bf253425d8cc9)},
+    0
+  },
+  {
+    {W(0xa5fe83a6af7dc09a), W(0x1063b8672f37fa36), W(0xd06701a3856d3c2a),
+     W(0x8f6cbac8f624acb9)},
+    {W(0x38a1a20c1835cf5e), W(0xc1f8e0d4f1f5d293), W(0x94bc08699a0ac5f9),
+     W(0xd7dcc7283d92b02c)},
+    0
+  },
+  {
+    {W(0xd5529eee86852a8a), W(0x501b35ed17e3db70), W(0xeb1a8fc0c06be97f),
+     W(0x5b43dd2c761b544a)},
+    {W(0xc74f16211a3074dd), W(0xb97c4c4f9760a04d), W(0xb2d5f8f1654372ef),
+     W(0x2b42b3a30e0625a3)},
+    0
+  },
+  {
+    {W(0x6604ecda7b366422), W(0xe8e05f54029c0d46), W(0xfa5f12cbb13d0c98),
+     W(0xb214954f2f716219)},
+    {W(0xefbea617de2a2c86), W(0xff8b45590d5bc92f), W(0x2b321d02a999352d),
+     W(0x0831f4ccc7bc4e2b)},
+    0
+  },
+  {
+    {W(0xa7af0f96cef03c19), W(0x933bee84024da511), W(0xf772834c7ce0f059),
+     W(0x552fd6c96e6e62c5)},
+    {W(0x2c0df25f96c8fe01), W(0xd1392c34878521f5), W(0xc2fbc0b2fea780ce),
+     W(0x0e773fbce28ec024)},
+    0
+  },
+  {
+    {W(0x7c2852b11a3a6b0d), W(0xa3af63e919181925), W(0x288f2d116fd46dcd),
+     W(0x96ae008e144c61b4)},
+    {W(0x719ccc52e9d836dd), W(0x9282859bac94830c), W(0xc600d91bef897d98),
+     W(0xfe4fa0e607e35c9a)},
+    0
+  },
+  {
+    {W(0x7fcc71e726755a78), W(0xe8b20af630a474fe), W(0x16b6aab8e0dc4b1a),
+     W(0x691f7a671d7cf9cb)},
+    {W(0xe37514de7f8eb401), W(0x3eb952bde629f740), W(0x6e8a897c31819a33),
+     W(0xafee99930ebf6bf0)},
+    0
+  },
+  {
+    {W(0x14b10eb4ed8ac4e0), W(0x55966ca7d791aa37), W(0xee24d8fb41c8f2cb),
+     W(0x280c8159244234f5)},
+    {W(0xbff7b1a10c601356), W(0x54a2250c2de506dc), W(0x8c1185d6818cfa63),
+     W(0xee0099a9d6b84961)},
+    0
+  },
+  {
+    {W(0x3d19d9b238d1ad25), W(0xea8b085ff781361d), W(0x873fb3cec3231904),
+     W(0x5212aaa5314df067)},
+    {W(0xf3c6260d08a6a1a5), W(0x7fa51cabd0ea8d64), W(0xdc86259593ce7ebe),
+     W(0x174c43e021605feb)},
+    0
+  },
+  {
+    {W(0x8a84364910fd48c4), W(0x654d30cb41164bde), W(0x42dcfc66ad5b2875),
+     W(0x704a6277a9d55943)},
+    {W(0x1f1f2df9b41b5bce), W(0x51dba091f2b41d9c), W(0x307320a7023df20b),
+     W(0xba04bace517729fa)},
+    0
+  },
+  {
+    {W(0xbbda40d90f5c285d), W(0x9ca92ecc4f2e93af), W(0x65a8ef8055ac9f42),
+     W(0xf69f27fafceab090)},
+    {W(0xce76a5d7930cda1f), W(0x2fa56f99c1531e56), W(0x8bfb3d7c7587bd07),
+     W(0x17798569b2c7ab3f)},
+    0
+  },
+  {
+    {W(0x2fc89cfa9201ee1c), W(0xa6e3de7859085554), W(0x0a02f77fdb042436),
+     W(0x7921f62bd654a9a1)},
+    {W(0xeccf90ed74fbafca), W(0xfe8b78edb232f41f), W(0x7b5d273ef7b30b86),
+     W(0xbb8fc385dfc414ec)},
+    0
+  },
+  {
+    {W(0x1fef23bb3ea62337), W(0xbf5be24b3f2f6c7e), W(0xee4abd44d6e09eb6),
+     W(0x9dd50d4558265122)},
+    {W(0x75f9210eb19e2222), W(0x657e774578da14d1), W(0x22f3e04f43b0ecf7),
+     W(0xb4480c77eb5c0220)},
+    0
+  },
+  {
+    {W(0x7f23d49c940e1679), W(0xaef492a1628bb577), W(0x50230eb2d46ea5f6),
+     W(0x2277ed91a8de1d02)},
+    {W(0x0a3c45608f282415), W(0xff5e00e0f682af18), W(0x6d795dc4d6acc3b6),
+     W(0xe86df58fe301149e)},
+    0
+  },
+  {
+    {W(0x12a78ab0b2de48eb), W(0x5743b0754dbc268d), W(0x288fd6db6e42413e),
+     W(0x8f8aa991f4b30c2c)},
+    {W(0xfb3973d1d8b09d7c), W(0x0aad9d298b24bd77), W(0xf7e8df6069d30159),
+     W(0x3d7cdc62e2c8a3dc)},
+    0
+  },
+  {
+    {W(0xf125df30e4270765), W(0x2ecda54ffdb48e02), W(0x64b7c921fd3ad894),
+     W(0x7826dfd66026019b)},
+    {W(0x87e5af9be5a7725c), W(0xa37a79d8bad605f4), W(0xbbaae31a44d6c650),
+     W(0x63dba66335322614)},
+    0
+  },
+  {
+    {W(0x650dc2623c34bb34), W(0xd87ee3667a1d5728), W(0x81822b45f6d51afc),
+     W(0x2b644c0e9948ef27)},
+    {W(0x938eea7857a8119a), W(0x90604d339e3cc1fb), W(0x0227094fa4b6d913),
+     W(0x5b1c25146df9ac5a)},
+    0
+  },
+  {
+    {W(0x05e4a9c39fe77eaa), W(0x696cba35c81a9270), W(0x2d8f34838cddd169),
+     W(0x0853eb67bd96bb4e)},
+    {W(0xe7679dee4f778534), W(0x3d96f7404e328409), W(0x3a8eccd0a5566d67),
+     W(0x0972d510f97efec2)},
+    0
+  },
+  {
+    {W(0xdb4f34a44aaebd96), W(0x272b59d011429890), W(0x96af85e5ad84cb1a),
+     W(0x3fc7421e35b77730)},
+    {W(0x07fa689ca98e4232), W(0x7112261d42c5c044), W(0xe2f6ab7c32445edb),
+     W(0xc66eb1f56da76ba6)},
+    0
+  },
+  {
+    {W(0x59fe143f52021b2b), W(0xca270caf80e25ade), W(0xeb40d9a20037597a),
+     W(0x86cc64fa59bc1fa4)},
+    {W(0xde14292bb60adae4), W(0x8f5e9b115a691bc5), W(0xdc28a6f014243827),
+     W(0x9c2466b38fdc01a6)},
+    0
+  },
+  {
+    {W(0x8d690c9a469f47e1), W(0x700aee57838d304f), W(0x8f8b938da53c14e2),
+     W(0x1c98b75bdfa1888b)},
+    {W(0xcca9230c3f36360b), W(0x5157d7a31d41c1d8), W(0x9a213cae5c7f87b7),
+     W(0x93523788499ea8d6)},
+    0
+  },
+  {
+    {W(0xfcc09fcee6d706de), W(0xbecf181f40eea686), W(0x9c0c2f0844de7595),
+     W(0x7f3dcca78d748839)},
+    {W(0x7b9cd9be0af8fb8f), W(0x78cfc396368ec7e1), W(0x9d4138de208862bc),
+     W(0x2ebc67d6b827592c)},
+    0
+  },
+  {
+    {W(0xea7aebc980b97ab2), W(0x6223456678e84763), W(0x6f1872d7c9389fc0),
+     W(0xc10866c30804a480)},
+    {W(0x24f99af26184d2f2), W(0x3eb610f9ee6c2293), W(0xae513b0c51e380a7),
+     W(0x364e005b6192f201)},
+    0
+  },
+  {
+    {W(0x87a4b133f2630503), W(0x668bcee571796a46), W(0xe6837fc7e4ae30a5),
+     W(0x6e3689edf0c8c3e9)},
+    {W(0x94830c9e5c868f8c), W(0x9bde35af3be173b8), W(0x1fb5084fe74024c5),
+     W(0xb639b677275326dd)},
+    0
+  },
+  {
+    {W(0x34930f65b1fa0751), W(0xdc35cf5b338af16f), W(0x64b8a894cc6610ba),
+     W(0x597babe3d8906459)},
+    {W(0x1dcfdea896c09270), W(0xaa89448648184877), W(0x18f583bcc78acaba),
+     W(0x1bcbc3fc9e3569c3)},
+    0
+  },
+  {
+    {W(0x8f6b253dc6b0992c), W(0xd19c34fc5396fee7), W(0x314feb6c1e97e1f9),
+     W(0x8c9d13295790896e)},
+    {W(0x93ef0229c4e17b45), W(0x4f1c1572f6149f87), W(0xc36cf99e18090322),
+     W(0x2b2e65859f393571)},
+    0
+  },
+  {
+    {W(0x0fd9c489e073c928), W(0xf2975375abec71ee), W(0x5eb7554919e48797),
+     W(0xf637675bf705d1fe)},
+    {W(0x385197780c1cf5bc), W(0x8a7fe4e414221d85), W(0xcd648aec27eca4e3),
+     W(0xd92ca4c39c0f3f24)},
+    0
+  },
+  {
+    {W(0x7b2cefb2c49dc519), W(0x5b8e0312b2011450), W(0x0c0e02f4feb6837a),
+     W(0xbb4df4c09c95c1f6)},
+    {W(0xb673a8691acab24d), W(0x24327cd2c3059a1f), W(0xd302992aea01f40a),
+     W(0xb4ce7f003a0eba64)},
+    0
+  },
+  {
+    {W(0xcd3e181f6e18aab3), W(0x636c8d2b804ddbd9), W(0x0233f375ac3db583),
+     W(0xeb3a89fc02b9915d)},
+    {W(0x25b0735f4f122066), W(0xc508f3a6a03e530e), W(0xc097e1d17934bbd4),
+     W(0x446e906564b05e39)},
+    0
+  },
+  {
+    {W(0xf65cc25b05987948), W(0x49e024c36265fd23), W(0x2d0a7ecd40a44b1b),
+     W(0xa094ba630c8f8630)},
+    {W(0xf891801445705909), W(0x38ea98649cd83271), W(0xbcdc45a78599f47a),
+     W(0x38375d661a6dfe45)},
+    0
+  },
+  {
+    {W(0x58a1069cc0b2746f), W(0x787b99d972bf3964), W(0xaec4e706b3583893),
+     W(0xb579d8e2b58e3bc2)},
+    {W(0x4b53a421f0a150c6), W(0xbf80ebe805ba71c8), W(0xd28208be1145c0ff),
+     W(0x5464c631a297cf15)},
+    0
+  },
+  {
+    {W(0x9457d37a1674a359), W(0x9c9aed0f8aa72d1e), W(0x75adfb749c99119b),
+     W(0x630f5bdf334cbb4c)},
+    {W(0x0147de55b2311b80), W(0x7155f10762ce8951), W(0x402bdfe0b589d2b8),
+     W(0x77fc2e0cfdcbbae8)},
+    0
+  },
+  {
+    {W(0x182fe6a15fc02b03), W(0x7c3430d37d93c8e1), W(0x4320cc74593ff013),
+     W(0x6cd41bca2cb9b52a)},
+    {W(0xfe03a9eb4f567a11), W(0x33fb1d8a9452cb69), W(0xbbf1ea4d0640b742),
+     W(0x85e37df221dd0b56)},
+    0
+  },
+  {
+    {W(0xf22fa1ef1102adf4), W(0x7c888c24f8e5a9e1), W(0xf04cb58336d13ce4),
+     W(0xcdbd0d52b040022f)},
+    {W(0xea97f448cd3d9b44), W(0x161055c9d8f53bf5), W(0x2a46c8d0bfa74051),
+     W(0xe02b1f7fa198f95d)},
+    0
+  },
+  {
+    {W(0x51d4f9f0d281979a), W(0xd445e5d9813c8532), W(0x9fae93b1aaf07b5f),
+     W(0x666660de1ed8e13d)},
+    {W(0x40edcf6212089ef9), W(0x760e5f844ffb286d), W(0xcdd684bde1bcdebe),
+     W(0xf26006b8282aeae0)},
+    0
+  },
+  {
+    {W(0xb25e4b7b7d147bf8), W(0x3c12cf967aaf839c), W(0x34de8647b51fb951),
+     W(0xb92ca34c0adc5f05)},
+    {W(0x928ab30df4eb46f6), W(0x4240c312314fa9ce), W(0x8b9608ed06aaa2e9),
+     W(0xf275ac2d5741a81d)},
+    0
+  },
+  {
+    {W(0xeba831cd56d87882), W(0x58bf47455ae33dad), W(0x5558af7dc8edb147),
+     W(0x3a668a6d0f28322c)},
+    {W(0x3e8d3dba3d498a00), W(0xa2f7982069b131e7), W(0x8541432be41c4f2f),
+     W(0x3350be760036942c)},
+    0
+  },
+  {
+    {W(0x2c9a9016de0faa21), W(0xbe46ddade84c7be4), W(0xfeeb008352cf776f),
+     W(0x8a59fde5102a64c9)},
+    {W(0xf9ef9eeb2bb901a8), W(0x1cc5b2ab338a484e), W(0x6af76c39f0f937f7),
+     W(0xd06c70d8e898bd3e)},
+    0
+  },
+  {
+    {W(0x04101431b40f74d1), W(0x2be5e5ed5e2046de), W(0x775f7cabe74dcf3e),
+     W(0xc747341787a69a4b)},
+    {W(0xac599b84883dac30), W(0xe296ef32b0a0c2b9), W(0x78b286fcf901ed0c),
+     W(0xddd0517f086af1d4)},
+    0
+  },
+  {
+    {W(0x7b09b2125207a43e), W(0x0d7b5ee3a13412a8), W(0xbe3104f93b5c25c3),
+     W(0xa7975d6de42b4933)},
+    {W(0x5cde1f5747cd2033), W(0x762473d7d13a1c44), W(0x1ea53ca3cf59a03a),
+     W(0x020dc47ef714800d)},
+    0
+  },
+  {
+    {W(0x4f0b554e2f0493c0), W(0x1cc92f221abe998a), W(0x7496c182682b1cac),
+     W(0xd3d63ddd28f1c99d)},
+    {W(0xe430e5574b313cfd), W(0x4f7f3765df908fe5), W(0xadc2d898faed8fb7),
+     W(0x7ca09ad447a47bb8)},
+    0
+  },
+  {
+    {W(0x83f1d74dfaba896e), W(0x9bc3ccb406422454), W(0x82a449a4e6496292),
+     W(0xf758e279fd814fc4)},
+    {W(0xe50758ab3cabf36e), W(0xdbc04ed1d905d6b0), W(0xf900dab84e27147c),
+     W(0x15397309b7fdf10e)},
+    0
+  },
+  {
+    {W(0xd7a198db7d9df3d0), W(0xccf646c7b5daad0f), W(0xb2bf205170122f28),
+     W(0x735cb6b239ed9867)},
+    {W(0xa4c7cdc1ae4bcfea), W(0x6d16484b09e923e5), W(0x49eb190444d2c94c),
+     W(0x69995f3265ca7e08)},
+    0
+  },
+  {
+    {W(0xab5f84aebd52502b), W(0x9cc2d27259a99f99), W(0x444a899b30c8fe50),
+     W(0x5c1884f406c8ade0)},
+    {W(0xa8fcab35266d902d), W(0xb1004894b13e251c), W(0x7c4b44c65925135d),
+     W(0x4bfac5dc40fc58ec)},
+    0
+  },
+  {
+    {W(0xc795f4235f42aaad), W(0x24aa123f3708ce89), W(0x33990b59d0868ce5),
+     W(0xc38366a5a3533b22)},
+    {W(0x00aef4a599071a6d), W(0x137b64d7e365d8b3), W(0xe73c09f10b24d7de),
+     W(0xe31f3946686826fe)},
+    0
+  },
+  {
+    {W(0xbcde6cb67a22b7aa), W(0x194865f17306bcdc), W(0xa14650df163d6b40),
+     W(0xab2decaca5ebe64f)},
+    {W(0xbc02378432b34ef2), W(0xf3871f60e54ecc5b), W(0x07f7982dc39e1d90),
+     W(0x7b8530d5a73f469e)},
+    0
+  },
+  {
+    {W(0xee6172a41cbf8120), W(0xe4adee5c1ea4ce83), W(0x93e4028a2ac203c2),
+     W(0x40d08cbaff0dd606)},
+    {W(0xb775e597d20b7d90), W(0xe381a950f5c54472), W(0xabab8da4a9b3ce62),
+     W(0x31d812dae23bceb1)},
+    0
+  },
+  {
+    {W(0xf8b7000fd4f57d66), W(0xbea6a9a7321119de), W(0x837759151bc1ba60),
+     W(0x489e080a632ded6b)},
+    {W(0xb867d54259674fd8), W(0x380f9f051f256aa5), W(0x13e3368259c8db33),
+     W(0x01bffd806be6771d)},
+    0
+  },
+  {
+    {W(0xe72e398b59316b1b), W(0x349f0444a4f0447c), W(0x5f25c5ae83205abd),
+     W(0xf088763a08cf8a1e)},
+    {W(0xf9b85dbd4c426560), W(0x1ea8ad214899fc65), W(0xe6bcadf7266a4835),
+     W(0x8c1d05b50b822f57)},
+    0
+  },
+  {
+    {W(0xd05938d9de0d8aac), W(0x99c40d3119e5f292), W(0xcdbaec1768ebaebc),
+     W(0x6f2cd0a4b57e0392)},
+    {W(0x27a20143170c52db), W(0x06c58438e7b4a1c3), W(0x4eabba716aed7a84),
+     W(0x17b549d3f6172493)},
+    0
+  },
+  {
+    {W(0x2bdd45d7df08fc7f), W(0x1abbc9896e2d6bfb), W(0xc8d17fa92bbed625),
+     W(0xba622f4a3632d53c)},
+    {W(0x71f31a471fbd6112), W(0x163e86de2cb69d42), W(0x86a56ea709e9b933),
+     W(0x20d7b34c08fb9c49)},
+    0
+  },
+  {
+    {W(0x1fa6cb14dad63dba), W(0xb6c1caf67e9d5889), W(0x6c4a2657c3fd519d),
+     W(0xe64ce3d62a59e153)},
+    {W(0xa9ed6eb6bbf80d6a), W(0x96d088cb104eff7e), W(0x52ca3d63fc30133c),
+     W(0x7b646d01ac584183)},
+    0
+  },
+  {
+    {W(0xc0940ee46937b95d), W(0x4503becfac3bd722), W(0x89192d9425dfca97),
+     W(0x3ab1f8caef2c6670)},
+    {W(0x9c3dc47eeac90826), W(0x837370dfd8608d47), W(0x8f98f361e8f8ab05),
+     W(0x0c9d1ed7d9d2d2ee)},
+    0
+  },
+  {
+    {W(0x60b289046ff1c7ed), W(0xceb19bffb62ed997), W(0xf0e843d8039de91a),
+     W(0x944a58f22f79a944)},
+    {W(0x3c76ad5885e308fb), W(0xfb7dfe1a8aca0cec), W(0x29df27fe342d5826),
+     W(0x071bb1d7c3c1502a)},
+    0
+  },
+  {
+    {W(0x2df0fe6945fecc1c), W(0x121aa083521dba53), W(0x2da3e0e66574a0b9),
+     W(0xee37cc40f446cd05)},
+    {W(0x0bbbd4fc7a201f4c), W(0xeafa745cc137ee32), W(0xa204c3126c083522),
+     W(0xe9f2a35f3fd4e3c6)},
+    0
+  },
+  {
+    {W(0x604c00578d585696), W(0x771d0e006c7c800a), W(0x8c96403366c9e817),
+     W(0x14407aae051e4873)},
+    {W(0x7da3535ab5eb107c), W(0x5ceedbd58c3f72d3), W(0x4157551c46f3b968),
+     W(0xd0f3d0e33c3db6b4)},
+    0
+  },
+  {
+    {W(0x95dcc231d206ec19), W(0x16ada0ab47f12813), W(0x4441b9f650bf6ac0),
+     W(0x6b05b5cb366b760b)},
+    {W(0xe783b07b4c6e8a32), W(0x711d4d374d22d8cd), W(0x5cb08b44a7b71513),
+     W(0x0a578acc2393927a)},
+    0
+  },
+  {
+    {W(0xfc73520441072300), W(0x755907ab47b80a0c), W(0x9dbcc2ac7ca1f369),
+     W(0x38331edbf4d81995)},
+    {W(0xc03da07e64045193), W(0x690510fda64796d6), W(0xec09edc21ea58d1c),
+     W(0x8d70a112bd6b7ddc)},
+    0
+  }
+};
+
+static const wge_t secp256k1_wnd_endo[1024] = {
+  {
+    {W(0xe0741bdad0357cc4), W(0x4fc18658aa5bf5e1), W(0x356b7dfa233e663f),
+     W(0xad6e161a3afea07a)},
+    {W(0xb15ea6d2d3dbabe2), W(0x8dfc5d5d1f1dc64d), W(0x70b6b59aac19c136),
+     W(0xcf3f851fd4a582d6)},
+    0
+  },
+  {
+    {W(0x93347aee58e6e037), W(0x0bf4f2d5e7aacf1b), W(0x57a32dcf7154af94),
+     W(0x2940b775e96d3927)},
+    {W(0xaf18b0b0613f55a9), W(0xac4964cdc5a1f91f), W(0xcc6048bd84885650),
+     W(0x3ec28dcd9215ec76)},
+    0
+  },
+  {
+    {W(0x64015135a0a1e710), W(0x89b740c40f9fbb1d), W(0xd3cc9b69ef5b40e3),
+     W(0x2681a0c6a4b344bb)},
+    {W(0x9e5e784800dfd9e7), W(0x59aaa8d8aad35cc5), W(0x011d0b107f8dbfd2),
+     W(0x1fd437ae583630c0)},
+    0
+  },
+  {
+    {W(0x7ad8b89a0dcb5f65), W(0x8e57f96818778c1c), W(0x70e2e4ee08be84e2),
+     W(0x6c21991e5d34886e)},
+    {W(0x4777d1124a77d752), W(0x879d7639f1097263), W(0xf2fd13d87291ab04),
+     W(0xc8043a670ba1a73b)},
+    0
+  },
+  {
+    {W(0x1dd05472948e9b4b), W(0x38f44c77e0d1705d), W(0xda202285b3cae5ca),
+     W(0x6448396e605f21ef)},
+    {W(0xb2a0d4ae268d25a4), W(0xaec108c659794d80), W(0xf0176bede6793574),
+     W(0x0156339094cef97c)},
+    0
+  },
+  {
+    {W(0xb044ef66eed7d4f0), W(0xd2473bb32f399648), W(0xe872510f70d8688c),
+     W(0xde7a0d16c5c7590a)},
+    {W(0x434322e37beacf4c), W(0x755db980f899acaa), W(0x7cb76bd27b41572a),
+     W(0x0e92c06d7705fac8)},
+    0
+  },
+  {
+    {W(0x2504f97b4c82c4c8), W(0x43b11904b38c7ade), W(0x40ddad5dee1758c3),
+     W(0x33e63baa026466a2)},
+    {W(0x14817536a5d44558), W(0x0f73d052948a3b41), W(0xdb37e3a6c013f5af),
+     W(0x595e4c3399b24984)},
+    0
+  },
+  {
+    {W(0x2b42dc0ad2061413), W(0xe230d335aafb0476), W(0x2749bfb2cc7907a7),
+     W(0xe0c93d09ca6cb7c5)},
+    {W(0x364e94e68cf9083a), W(0xd97359fb5ca29845), W(0x1442e0ed9e703fc8),
+     W(0xf384d03b4965bc3e)},
+    0
+  },
+  {
+    {W(0x56158511b32fea34), W(0xf156e7750bbdce02), W(0x55e01270ea7bf7c0),
+     W(0x7e7aeaffe609e71a)},
+    {W(0x85352ea76f2a14c9), W(0x99dc58b3753707e5), W(0x4e936ddcc6b65cc3),
+     W(0xb9d1058538a1624e)},
+    0
+  },
+  {
+    {W(0x231cda86ff80d7fc), W(0xa8276688059e0054), W(0x44f5935e34210849),
+     W(0x95d60e0e477063c4)},
+    {W(0xdf15c738e0d36289), W(0x91a29c6198b88bdc), W(0x7ceef09600dda4f2),
+     W(0x444ec627d07c28ea)},
+    0
+  },
+  {
+    {W(0x82a3e1a1e2b7d1a1), W(0xd0b76b180f4bb520), W(0x7a745ae5fe4c0a0d),
+     W(0xbba6e7bf13236d82)},
+    {W(0xead831a434cae6f2), W(0x439ddfdc4c4c0573), W(0xd69265aeb8025098),
+     W(0x9a760529af0be6c8)},
+    0
+  },
+  {
+    {W(0x76026b93358240d0), W(0x1c43eb2e8f606c8d), W(0x9616b3252b6a8605),
+     W(0x483d6abf1c598587)},
+    {W(0x1bb37e7d5a765cfa), W(0x04e41eb805d5c130), W(0xfabc5a81934fc6c9),
+     W(0x1ada75eb956c455f)},
+    0
+  },
+  {
+    {W(0xc42be0b3c8dc4cfc), W(0x91fe985354005639), W(0x3c14d7f780e368e1),
+     W(0x40fa89a143589b59)},
+    {W(0x1af88d5c37027b74), W(0xd788f352bb5bb569), W(0x315a735beaaa2d4c),
+     W(0xdaaf22e5b81ac1bd)},
+    0
+  },
+  {
+    {W(0x480e813311ab45e1), W(0x21705d836491bbc9), W(0x68c58706876b1de9),
+     W(0xb77c57ff848ba5e7)},
+    {W(0xca06688145d3e40b), W(0x5987c3f8ac9dcfb6), W(0xfbfcc60cd3304a23),
+     W(0x5dace33180153d3b)},
+    0
+  },
+  {
+    {W(0x80195f11ea58552b), W(0x700b7984f9851d31), W(0xb68f5ae1552dcf69),
+     W(0x95705451a7090660)},
+    {W(0xa8c8e083f7cbcb31), W(0xcb952fa172bd2977), W(0x0cdb3ab31afa8c27),
+     W(0x210ec24f6535ce88)},
+    0
+  },
+  {
+    {W(0x3db3ad0f4279380d), W(0x4051406c43570af1), W(0x1224a851b987e7d8),
+     W(0xad7bf1ba4cd9e62a)},
+    {W(0xe5694678a89357dc), W(0x10ac2b51ca2335dd), W(0x5e0eda4ce149b499),
+     W(0x27964839bfa868aa)},
+    0
+  },
+  {
+    {W(0x557a6848d5fae7fa), W(0x9575a525ae6f1c58), W(0x7c8e35a978110c12),
+     W(0x3eaa65d90b966112)},
+    {W(0x55856bfe2b18110c), W(0xf698b243c499bb93), W(0x03dbb3810cef8e10),
+     W(0x79fb211f777f178a)},
+    0
+  },
+  {
+    {W(0xc23d12efaf34f532), W(0xf20095ed7eb5738a), W(0x43ba880e63678e9a),
+     W(0xaba389740ae220a6)},
+    {W(0x3a31e3d79265f180), W(0x4dc9de4c5eab6ebe), W(0xbd0a4fadaeabe161),
+     W(0xc7ec3e2d5b411868)},
+    0
+  },
+  {
+    {W(0xa5d51b5e4911c97b), W(0x35d6b8c9d6c6f0b2), W(0x1f53e97e0f56c2ff),
+     W(0x8f73f6d1f59c1451)},
+    {W(0xf231989edd9866d8), W(0xc1be6826da9fddb4), W(0x8985db78e11526fa),
+     W(0xce9b6976d67d796d)},
+    0
+  },
+  {
+    {W(0x9df2677186033f3e), W(0x6a7097196099feee), W(0x3ba1e152f87be89b),
+     W(0x0024fa3040415405)},
+    {W(0xfc5b9ec5929b6f64), W(0xaeb7c6cde49d0496), W(0xf5482095c7aafa37),
+     W(0xcf35e3ebf5a3d880)},
+    0
+  },
+  {
+    {W(0xcd5f7ee1c662490f), W(0x5dda21a9f7e373e5), W(0x55f37b211c1c8fcc),
+     W(0x91bca2bf684a15dd)},
+    {W(0xfcbb7632be39d872), W(0x4ba332cb7d576c11), W(0x18e6c1b219f23c9b),
+     W(0xc00969e9383240ea)},
+    0
+  },
+  {
+    {W(0x507d0f5ecda0157d), W(0xc673b1a7fdcc940e), W(0xa6796c53fc66bfdd),
+     W(0x319c3920b019ce6e)},
+    {W(0xbe0809ba4c8dde97), W(0xd90d585c5b5ad049), W(0xf3df54f6d45360dc),
+     W(0x962e84ea6bea9faa)},
+    0
+  },
+  {
+    {W(0x4f05ac12df8ca20f), W(0x9489a469f9c158b2), W(0xe0a0c47025a638a1),
+     W(0x671020b40cc23485)},
+    {W(0x5afa94ed90e0c05c), W(0x3b30690ebe289c86), W(0x854ec8102c544b3d),
+     W(0x578756f29e6ffca5)},
+    0
+  },
+  {
+    {W(0x3f51a07f08cc2d41), W(0x3bbafdb9d5291e1c), W(0xb888dd82d2096fac),
+     W(0xe1b19ca1d686b39f)},
+    {W(0x3b47757649e7e82b), W(0x4fc6f53994c7e45a), W(0xe4bc5f988ae74268),
+     W(0x3f188c560425b0d4)},
+    0
+  },
+  {
+    {W(0xa09fecf7fff61108), W(0xcf10b7a5c749c30b), W(0x00e2c3ac270dfb6c),
+     W(0x5c473954dad70810)},
+    {W(0xcdd9f40c80d483ec), W(0xba1f50ed769367ab), W(0x33364421d8a95257),
+     W(0x6db77a1a2e1da593)},
+    0
+  },
+  {
+    {W(0xf726033e543b11d6), W(0xea90353354041e02), W(0x41ef87e9c1e45910),
+     W(0x1cd50f6e4ad301e3)},
+    {W(0x02b72b3fd133daef), W(0xc22c7b5f8a4f8771), W(0xd266f00b330ddbf7),
+     W(0x73f7d2d32d273a4b)},
+    0
+  },
+  {
+    {W(0x44b688f67ded4af3), W(0xb107d82f9b8e0cca), W(0x9f496bf279e9dbbb),
+     W(0x969efd6f7aafbcfc)},
+    {W(0x980e43acd79eb786), W(0x55c8772e06865b9b), W(0x83dadee963e0338d),
+     W(0xf2edddf9b0e45726)},
+    0
+  },
+  {
+    {W(0x220e91f6a7de4c24), W(0xa4b1ed77abd599c4), W(0xcc08f4dfaae85213),
+     W(0xa35d8a437916f6b8)},
+    {W(0xcc6e1536c6b46c3e), W(0x5528e849bbb2db21), W(0xf26df73f7be3572a),
+     W(0xba398de3910b0743)},
+    0
+  },
+  {
+    {W(0x750ef08ebd9364fa), W(0xdbce2651d9db4878), W(0xb6e8f5293ca7d1e8),
+     W(0x56bf0c581969f50d)},
+    {W(0x040d4f07cf2a1cef), W(0x1bdbea3650d3fb9a), W(0x877f57ddfe4216bc),
+     W(0xc6ea984d4b832e71)},
+    0
+  },
+  {
+    {W(0x7e346ea91ae0edae), W(0xd5567e21b9665510), W(0x2578185d8dbb59f6),
+     W(0xe05be711de7339a3)},
+    {W(0xd1b658150b2b3069), W(0x9c4d7e1a6b6d0049), W(0x4c8df8bb5b38bc15),
+     W(0xcad37dfaab3dfe73)},
+    0
+  },
+  {
+    {W(0x2fa2534ca45c66f3), W(0xe5b73b27addfbd23), W(0x6e3e7dfa4c092d8f),
+     W(0x4fc5d1ffb697d616)},
+    {W(0x73f89d79daed83c2), W(0x398e268e4889b425), W(0x367fdcf5e6112ff9),
+     W(0x866090e27c885dc0)},
+    0
+  },
+  {
+    {W(0x5b290f4b014275fb), W(0x37c807aea8d76df0), W(0x188c1a75456cfdf4),
+     W(0x26c3a18f8eef8c55)},
+    {W(0x037c0abf13bb54b7), W(0xb3c48ffee367f08f), W(0x56e45762d943dd47),
+     W(0x4f07938a8c07e9ee)},
+    0
+  },
+  {
+    {W(0x73f1381daebe2584), W(0x3950fad6273a0b86), W(0x91386794b03e97df),
+     W(0xff9a46298008ec2b)},
+    {W(0x0db0b2a21cddfc71), W(0x3a26e050b3a10161), W(0x070da8f43bf78dad),
+     W(0x2ace7645b103ccfc)},
+    0
+  },
+  {
+    {W(0x8e28872b96971e3d), W(0x3b735db108c874cb), W(0xc181b83c76ad5929),
+     W(0x42cb99eeb43b7f04)},
+    {W(0xd0cabb103ef1f86e), W(0xee78f4f6ca315bf9), W(0xeccf83a888e26c35),
+     W(0xbed6c8e5df026741)},
+    0
+  },
+  {
+    {W(0xeacd6e64c35feb68), W(0x4e86aa255ce597a2), W(0x137d0f01ff55a11f),
+     W(0x60456165c50fdf0a)},
+    {W(0xb7d8c06ee6dccf08), W(0x48fe4ee540fd95d2), W(0xda45a64aeed33d72),
+     W(0x75778bf12a856a1b)},
+    0
+  },
+  {
+    {W(0x9ade1611d1648905), W(0x757c2cef3a1b70af), W(0x0b901739b74c2e3f),
+     W(0x363b9e2fb35b7a62)},
+    {W(0x23030d37b66b5b0c), W(0xc5821b2cd8d01bf2), W(0x29bac38a5180b6dd),
+     W(0x3ce0002df92866f4)},
+    0
+  },
+  {
+    {W(0xc7aefd50c007beea), W(0x6fb9b2ea89f7875a), W(0x18ed24c2218f680a),
+     W(0xa6155be9e67f071c)},
+    {W(0x760527a416a9f536), W(0xbf584a933ae7420d), W(0xe1031ca78ea83ce4),
+     W(0x8a88d38b1d1488e8)},
+    0
+  },
+  {
+    {W(0x5a3d681c8adc3f6c), W(0x1868e8655bce7fed), W(0x2822cdf77cb13250),
+     W(0x32085553d80e17c3)},
+    {W(0x5a5930b01f459de4), W(0x91fabe0c608dc9af), W(0xaa6f106d582ac2df),
+     W(0xbd490355a1f4e1e9)},
+    0
+  },
+  {
+    {W(0x4190ff2c7fcc6ef7), W(0x50823c529d92cb04), W(0xd85e3a20a9d2348e),
+     W(0xba6851fbb90c0a9b)},
+    {W(0xcea2c0d9c12ac942), W(0x6f00aa15029703f2), W(0xcfada34ddae63039),
+     W(0xb568fd0d43abda38)},
+    0
+  },
+  {
+    {W(0x9db080d0f2b8acad), W(0x2d68a949ef9d328d), W(0x6f3e8687598ca30e),
+     W(0x9ee08ce1e2a52c59)},
+    {W(0x3e1ff57629dc100c), W(0x3d6da92752e2efc0), W(0xb5445599b834f17e),
+     W(0xd5f3c5076d99980a)},
+    0
+  },
+  {
+    {W(0x3191eb21720bcaa6), W(0xbdc85c2e90f73bcf), W(0x259bfdb9e95f635f),
+     W(0x708358759e4e853b)},
+    {W(0x0ff26c9bb087a082), W(0x9c153535d1a0f801), W(0x129a08ee3a004269),
+     W(0xf88e3c1357eab421)},
+    0
+  },
+  {
+    {W(0x93933aa4204fed1f), W(0x338228340380d166), W(0x80ff2f138362c5bc),
+     W(0x8e3e45b90ff77093)},
+    {W(0xb95e05bf250636fb), W(0xf6d418c3cbe3122a), W(0x2d332583e9e06179),
+     W(0x87ca57a26b14c2a9)},
+    0
+  },
+  {
+    {W(0x5d8223de8b9ae10f), W(0xf5ff63d55a9b7f33), W(0x9fdd3e4a32e9bfec),
+     W(0xced7684816e13d8b)},
+    {W(0xac1af46c276d98f3), W(0x042659e2c1855f2a), W(0x30849fc24718b1a6),
+     W(0x006d1dd3e13bd64a)},
+    0
+  },
+  {
+    {W(0xccfdeca22b79ed6a), W(0xebf587f46fef14b6), W(0xa40733cafe392e4b),
+     W(0x04f88a0e3a8207ab)},
+    {W(0x8893c0d324340ec3), W(0x52bea81a88b310ff), W(0xd1b308203b2381a7),
+     W(0x4e4c97ab192c6d66)},
+    0
+  },
+  {
+    {W(0x32d378976942ec0f), W(0x3f39c62b6199e152), W(0x84e65c4381165420),
+     W(0x83c957235c67926b)},
+    {W(0x6570ecca88d46bfa), W(0x2faa12590bf86d7f), W(0x5be618f033f0f556),
+     W(0x271d56887733dce9)},
+    0
+  },
+  {
+    {W(0x658c289fd53b45ea), W(0xaf5fb4a6b19bb4fb), W(0xcc1b5d59947938be),
+     W(0xa309d213c2b7ba1c)},
+    {W(0x12b3997eca9dd88d), W(0x8fe184671b8b04f7), W(0x133370b5f4bd91eb),
+     W(0x20be2540e134c14d)},
+    0
+  },
+  {
+    {W(0x3013437499c0bed0), W(0xf8eeb300b9e61add), W(0xc6b9f1fe429173cf),
+     W(0xff8077ebc0b24493)},
+    {W(0xf4e8fc85a66b8af0), W(0x345214d358cd95a5), W(0xae5bee6620ecc7fb),
+     W(0xd8c600bc83893aac)},
+    0
+  },
+  {
+    {W(0x66ca8cbf60b518a3), W(0x5c1ba705b0d9d141), W(0xd445cdf9e23fde07),
+     W(0x342a069a4ab4a836)},
+    {W(0x5606e84110c45826), W(0x948a8f75061c6142), W(0x8f079b9be579d8e2),
+     W(0xf4bf8cfefa096557)},
+    0
+  },
+  {
+    {W(0xf085ffa95179ca52), W(0x91f92f8e94f0798e), W(0x28cc47ac0cf3674a),
+     W(0x6e7a5020aff60b59)},
+    {W(0x970cc5fc873b8c15), W(0x323d6c800833bd7f), W(0xfbeaf192d21716b5),
+     W(0x702286eae41f1fcb)},
+    0
+  },
+  {
+    {W(0x33f6df136c6a72c3), W(0xf0ffa42aee3474c9), W(0x04c233bb2e538d74),
+     W(0x6be91e1feecda121)},
+    {W(0x949e5265f2348129), W(0x4e91a3d8fcb122c9), W(0x57014d8db1ae79dc),
+     W(0xd44fb03d2801167c)},
+    0
+  },
+  {
+    {W(0xc07c6d049ed592a5), W(0xa68155874ae9de64), W(0x34e87e4c5907d6c8),
+     W(0x2cce0bd677a4ff49)},
+    {W(0xc85f800fd546a62c), W(0xfc5f363ccc3eb519), W(0xd8f669316d6c66d9),
+     W(0x13200ef558081196)},
+    0
+  },
+  {
+    {W(0xbbd6a27650cc3e9e), W(0x140daadc0603eb8b), W(0xa83bb87edfd58b3e),
+     W(0x621d9637efb13590)},
+    {W(0x57e3d988e591d247), W(0x7ea4af3cbd6d8815), W(0x967316955e3eff33),
+     W(0x3b9940696390a6e3)},
+    0
+  },
+  {
+    {W(0x78de4efcc145e1c8), W(0x1a5a7732be6e4d79), W(0xffa4ff2c6b1f3751),
+     W(0x76f2c5ea67e20ba7)},
+    {W(0xcb5fd9b02ba1b6dd), W(0xdd7d81d238fc069d), W(0xd4cb6c6b0eea0a62),
+     W(0xb79b392e48fed7b3)},
+    0
+  },
+  {
+    {W(0xb2341936d6949975), W(0xf503f272c579ed62), W(0xd8afd271f1af2e34),
+     W(0xe6c74b577cb03a1b)},
+    {W(0x68a5bdd85fac2cf8), W(0x562a7e9961f74832), W(0x2fdf74f6c3db010a),
+     W(0x0b3f2c1bc829db1c)},
+    0
+  },
+  {
+    {W(0xc851bbf03628a8d6), W(0x4ba25883184e64b3), W(0x5f42cc2b81a80e5d),
+     W(0x414a4556a1216106)},
+    {W(0xa0ca5f701cdb4a91), W(0x9fb6b207450dc02c), W(0x81017cf618d49e49),
+     W(0xd013d1f3f509d822)},
+    0
+  },
+  {
+    {W(0x5725ca35ac694760), W(0xdd06947da73f9399), W(0xff00d79e409a1057),
+     W(0x8ec1e7fe604dfbe9)},
+    {W(0xc2f393887c9e895a), W(0x276064dbc55691e7), W(0x145b768acbcf433c),
+     W(0x591d2068862bda78)},
+    0
+  },
+  {
+    {W(0x51af411e03e1e6a4), W(0x5b538d8e37f061b5), W(0x5abb3369c369d4a7),
+     W(0xeb224476c38d4433)},
+    {W(0xe096a6d01b558075), W(0xe1b8b574fee10332), W(0x642a3b5e43d58ee3),
+     W(0xb23e72459088b620)},
+    0
+  },
+  {
+    {W(0x2736746908807249), W(0xcad46220df9f8c7a), W(0x476c2b287662b8e9),
+     W(0xc31f4602f782dd4f)},
+    {W(0x8cc4e0aea020e819), W(0xce19c4d24e8b094e), W(0x12a6e6fed741ccd5),
+     W(0xd8444c9cb8a9a505)},
+    0
+  },
+  {
+    {W(0xcd076234b69aa65c), W(0x8d3e637f1fdce8c4), W(0x6174226b34d2c906),
+     W(0xf6c126b52f78a304)},
+    {W(0xafb3864137badba6), W(0xff34658f35c9ae57), W(0xfbe7c81afc793937),
+     W(0x6b1f08433b40d522)},
+    0
+  },
+  {
+    {W(0xd28b0a410dd87cbe), W(0x1ca42f262a4b1b0e), W(0x922beda966afc027),
+     W(0xe325ca8652a09b72)},
+    {W(0x42dc3583000c2768), W(0xcf27eae176c2ddcf), W(0x2deb8f4d0a420bfa),
+     W(0x2488c77b116cd158)},
+    0
+  },
+  {
+    {W(0x1c5d7febd98121a1), W(0x35b52ecafd1c06e4), W(0x781c6ecfd4738cde),
+     W(0x57080a29cec2a323)},
+    {W(0xd505efc2a6f0261e), W(0xb0afd5d46995d247), W(0xaef5854988024c31),
+     W(0xfe8a2e986226d446)},
+    0
+  },
+  {
+    {W(0xc2d0684882acaef8), W(0x3c06556fbb648fff), W(0xd5eeca24a3ef2f8f),
+     W(0xaa3f993372dc90e5)},
+    {W(0x67167bcafd32b065), W(0xb16e835c28fb7a84), W(0x3dca95231cb482eb),
+     W(0xc421c2c93315ef83)},
+    0
+  },
+  {
+    {W(0x2912b2749bc4179d), W(0x8a340d1296ab782b), W(0xed1dbf80db94a5e4),
+     W(0xd07af135910ba80e)},
+    {W(0x325caf3871246227), W(0xfad6104ff566b8b4), W(0xe4144a47c2fba04d),
+     W(0xacca6a353a3edee6)},
+    0
+  },
+  {
+    {W(0xfa541a9c0503ad12), W(0x508449389da3cdfc), W(0x7fbf7d7a54b8a5dd),
+     W(0x389dfae626622837)},
+    {W(0x287c1dc5e3d59a75), W(0xc8fa4b0ebe05bab0), W(0x4350e9029e89c05c),
+     W(0x2a4b1a408d421869)},
+    0
+  },
+  {
+    {W(0x8816a554594bf213), W(0x0dec731b296abb21), W(0xacb9595ae4aa5afd),
+     W(0x300d2038e434c2c2)},
+    {W(0xc07125d74ff1b1f8), W(0xcc36e7e737feaa96), W(0xab17f143b67142f9),
+     W(0x8d8c46fef938adeb)},
+    0
+  },
+  {
+    {W(0xaa1bff458ab884d4), W(0x7ca47e290bdcf6d3), W(0x6b88d37bb053b131),
+     W(0x6495107bc85d64e3)},
+    {W(0x07e24ef24be65089), W(0xf328fe6d0d374881), W(0x78432342ed8e1368),
+     W(0x89bef129268c943d)},
+    0
+  },
+  {
+    {W(0xdd8eb668f1fd12d5), W(0x8634a02078140133), W(0x9e434a6d836b337c),
+     W(0xabe45e6a8331d6cd)},
+    {W(0x6bb4f64c6225a4cc), W(0x230105a312ac93bd), W(0x2d98fb669385cae4),
+     W(0x818060fbb011a990)},
+    0
+  },
+  {
+    {W(0x4728f4a006235c88), W(0xf50c53c31b970fe4), W(0x675133b9ea7d2575),
+     W(0x2a636e57412179f6)},
+    {W(0xe56288ad74b23aa2), W(0x78602da303768fbb), W(0xe92d4328afeb716d),
+     W(0xdd23159884d88855)},
+    0
+  },
+  {
+    {W(0xe730c0ef4d8c6776), W(0x9a4bb5d081703c4e), W(0xc0cf37d222b5acc5),
+     W(0x4ff54ff70e4f34f3)},
+    {W(0x90319c78a7661e92), W(0x9edbf0cbbec1ed93), W(0x84f6df4accf71dd5),
+     W(0x7c260a4fd4d1d843)},
+    0
+  },
+  {
+    {W(0xe2205306c04fb0ae), W(0x6734bc8eb3be6050), W(0x1a8dff990a1346fb),
+     W(0xb0b2346cc94bdecb)},
+    {W(0x0eb86d501bc56e19), W(0xf04b4107a3001f5e), W(0xe42eace07eca4b10),
+     W(0xe3c6e7bb57e2b946)},
+    0
+  },
+  {
+    {W(0x1be2236d1fc533b5), W(0x6ebb9ac5880793a4), W(0xf9a23f23d2d1ba8e),
+     W(0x200b1fe65d41c1f8)},
+    {W(0x2ce20006004e128f), W(0x8b7c3a26af55bc5f), W(0x9356b85bcba035f6),
+     W(0xbab454ee91ad7266)},
+    0
+  },
+  {
+    {W(0x9ea7b8832daa2bde), W(0x5ed49c91a58000a2), W(0x8981bfaca08776f0),
+     W(0xfa1c2a99ba6eeef1)},
+    {W(0xcd747e5406cdca1d), W(0x460247476466a84b), W(0xe2444811ae653ba0),
+     W(0xfc892586b8acc636)},
+    0
+  },
+  {
+    {W(0x269ebd22e27e6991), W(0x262e24c67134f1e9), W(0xde180e05da79d836),
+     W(0x0cd5e93d90e910e6)},
+    {W(0x423288eb244b8ca4), W(0xed5223079660edc4), W(0x86446027c9baf32f),
+     W(0x0b376473ab65c68e)},
+    0
+  },
+  {
+    {W(0x3bba6bee03b2119d), W(0xf54ba2f10fc5e2b8), W(0x41d8a9637d31600f),
+     W(0xe1ede9711b3d6542)},
+    {W(0x5dcdc6b6be9abf86), W(0x4b709c3b22a14ea0), W(0xad8f1b1316eb0626),
+     W(0x7baca8a0de0d78c2)},
+    0
+  },
+  {
+    {W(0x0281ad0899c56402), W(0x44658fa41aecf6b5), W(0x4e8c19efbf8d0998),
+     W(0x3b46d1ff393c1f4b)},
+    {W(0xed58ef440f17496d), W(0x53adf12222ca3c31), W(0xd2fa9b37ded97d66),
+     W(0x02626e58d2ea3832)},
+    0
+  },
+  {
+    {W(0x7e272da3beddf2df), W(0x88e5de7450f9506a), W(0xb7520828c3e49f09),
+     W(0x05292b143422fd20)},
+    {W(0x919e420c2f02c5e6), W(0x31f0bd1ad3f945c6), W(0x2735d066338c0d6f),
+     W(0x33a4253b1d8d8b55)},
+    0
+  },
+  {
+    {W(0xd997185995eb2d79), W(0xebc220fbcc92a7df), W(0x05a30414f32a9374),
+     W(0x42a6b4cde0dfab63)},
+    {W(0x0694a078d21198a6), W(0x8d1311d99b1033b9), W(0x3522d3c122e1ecad),
+     W(0x0f1250e72757a42d)},
+    0
+  },
+  {
+    {W(0xd6deae7c65543942), W(0xdcde994d96b169f2), W(0x55515869224896a1),
+     W(0x05de06b62182fb85)},
+    {W(0xc62b4fc1d66f6133), W(0xb7ed92a3c272a5f7), W(0x168d92f9254a4d5d),
+     W(0x3f8ca4aa6cc5cc0f)},
+    0
+  },
+  {
+    {W(0xba5e59eea12dd9b1), W(0x023f53625e5f912d), W(0xa5ea12583e848d30),
+     W(0x3a3abc2ad178385d)},
+    {W(0xc6a5bb1e826a6a76), W(0x41fb31fc5f845000), W(0xa83c51977ec3e695),
+     W(0xce4ee4388f82c89f)},
+    0
+  },
+  {
+    {W(0x2c5b3ad380393958), W(0x8f013642c04a5e2c), W(0xe9d7ec79a3a2b05d),
+     W(0xfb8f9aac484bf2c5)},
+    {W(0x5c40eaff9ddd90f8), W(0x6dc6ec8164096261), W(0x0c610fdb47b5e213),
+     W(0x84ffe6f53b18b4af)},
+    0
+  },
+  {
+    {W(0x32b79db0f553c547), W(0x221d1c4877f26a51), W(0x86351bac06230f53),
+     W(0x845520240d92faac)},
+    {W(0x69ac99d95a445bf1), W(0x631d73bc68d03cc7), W(0xfad280d386f0803d),
+     W(0x767054de03f4d6d9)},
+    0
+  },
+  {
+    {W(0x7be8c96d0bc076f3), W(0x1791f8e9f673567c), W(0x085be8ead8b2dfb7),
+     W(0x1bbf9f4513bb8e3b)},
+    {W(0x238bd327f5d8bbf9), W(0x35e439ed44a6fd18), W(0x9f3063ba9cf5463c),
+     W(0x8ba8af9102a2c352)},
+    0
+  },
+  {
+    {W(0xeeb197a4a375c2e0), W(0x9d5f50f2059209a5), W(0x3dea90b2842b6762),
+     W(0x1a1be84bb029d33a)},
+    {W(0x0e1de44955612e23), W(0x49df0178042a5a38), W(0x022001e0724e9c62),
+     W(0xc58f7d0dd5af3e4f)},
+    0
+  },
+  {
+    {W(0x9f96dd28c8e6f54b), W(0x07ecd65ca5ab8495), W(0x143bf5c3cf6a1b06),
+     W(0x4c6896dbf92480ce)},
+    {W(0xaab693b48c1b428b), W(0x3be881ee26546d9e), W(0x65b422498848c9f8),
+     W(0x70bdc45cd0a7bbcd)},
+    0
+  },
+  {
+    {W(0x5fe54ea9879652a5), W(0xc167483011537fbc), W(0x07cd6bdd15c6e45a),
+     W(0x0d22ca2fcb4a29c9)},
+    {W(0xa75868c8d8713c0b), W(0xce173f4c60f16f32), W(0xf0c784eb9b22d9df),
+     W(0x824375ed6d9597b8)},
+    0
+  },
+  {
+    {W(0xe3d6870bae389113), W(0x1f929e6cb7ffdcd2), W(0xe1ded18c75a10434),
+     W(0x4cee05c029e9c1d5)},
+    {W(0xef90cbd6cbaeca09), W(0x462c3aabe602dc0c), W(0xb0f5d904e88a358f),
+     W(0x07fae25ac82d6830)},
+    0
+  },
+  {
+    {W(0xa8c6cea62e3d179e), W(0x84b6acc7173873a0), W(0x8c310992685a89eb),
+     W(0xa1a5bb9bf2fd14c9)},
+    {W(0xee67065facd6ccca), W(0x1b6c7ca14f53347f), W(0x239151dffab958b1),
+     W(0xcf07c09952c79405)},
+    0
+  },
+  {
+    {W(0x5663e799acd9499c), W(0xa058efe8d4260850), W(0x0b18c44f3b06c552),
+     W(0xaca98653ee87b3b3)},
+    {W(0x68b6064eaa5bd826), W(0x986cb453d9f8af63), W(0xe24c33b82704becc),
+     W(0x1d57afadf748cdeb)},
+    0
+  },
+  {
+    {W(0xf5f8501006c5e157), W(0x8781024881449b3d), W(0xfa56fc1d4ceaab0d),
+     W(0x688400fb45a7a65c)},
+    {W(0x3fce2621b9058ce5), W(0x8069c4486899c8ff), W(0xc24e73fbe895b2bd),
+     W(0x1709c860f2f90792)},
+    0
+  },
+  {
+    {W(0x4a1e89d57a3c1ecc), W(0xfd8430fad65954d7), W(0x0e01baf1cd3e5217),
+     W(0xf5179bc202f64fa3)},
+    {W(0x98a41b88d6706186), W(0xcc78212eed1ed694), W(0xf4e9fbaf33e5042a),
+     W(0xb13c11ce8066739d)},
+    0
+  },
+  {
+    {W(0x76f07d2947e4ec36), W(0x51b4a7f2e466bc02), W(0x19942da0c3df899d),
+     W(0x5752cdb2f3c3e423)},
+    {W(0x1a61bbe9098719e9), W(0x320932366875d0f7), W(0x0579f0484b96ed74),
+     W(0x51509c3f17f0da5d)},
+    0
+  },
+  {
+    {W(0xfa590d70dd10ddb5), W(0x1dc88ce9b3873b55), W(0xbd4083737363dea7),
+     W(0x94d560279363f4a9)},
+    {W(0xf02032a01debf614), W(0x3f1e68ff0be43459), W(0x280b521e2b5e8035),
+     W(0xf8a28c0881af4df8)},
+    0
+  },
+  {
+    {W(0xa498f6116bc5c5ca), W(0xbdb6ac4e74dc45e1), W(0x7bdf7e69fe124018),
+     W(0xf8fa5e45cec3256f)},
+    {W(0x85526d241df67b81), W(0xede0aa526a85e3d8), W(0x1c2f050a94c5975d),
+     W(0xe9e5cf446ccdcab7)},
+    0
+  },
+  {
+    {W(0x51426b59e25d1126), W(0x7fd2c0fa7fc2d7ff), W(0x6d11222adfe62057),
+     W(0xdee417198c479980)},
+    {W(0xff9e9fac731e12d6), W(0xa6b07db572b85566), W(0x7e761c36d7dba091),
+     W(0x3ab59b8f6a46eb44)},
+    0
+  },
+  {
+    {W(0x9bdf173c89e405c8), W(0x60b59e903eafcae2), W(0xd9f39f253ba97848),
+     W(0x3a8c0b357a032ac7)},
+    {W(0x5d50df92fe85fc82), W(0xf0835bb12ff36669), W(0xf98449d898076a01),
+     W(0x99d0e08526af7cc8)},
+    0
+  },
+  {
+    {W(0x7b56e7fc9b207029), W(0x331103d82070ebd3), W(0xceeca23b2f1da631),
+     W(0x8e12e9039b64b3b5)},
+    {W(0x85683ee2ce2b6193), W(0x64ebb121c5f4b207), W(0x2d0136020756f4f5),
+     W(0x9edc58fe17d69d73)},
+    0
+  },
+  {
+    {W(0xb7c5a7af363d703d), W(0xe7cf5c03552cb920), W(0xa3e3dbc365f10d5d),
+     W(0x3b5f66f3f80e3b12)},
+    {W(0x40e58f1538fe09a4), W(0xb47880fbfd893563), W(0xe81c8cc6a1bca70f),
+     W(0x5e28e52b59252043)},
+    0
+  },
+  {
+    {W(0xc66738648969ffce), W(0x5780d0ac4a6e851b), W(0x32fae85b3ad91a17),
+     W(0x9a0c1b89eec4e4f3)},
+    {W(0x294c8794ee545cc4), W(0x7b4b503040b6f1c1), W(0x52318f1d82663c70),
+     W(0x87cfaf6e9bfbfc42)},
+    0
+  },
+  {
+    {W(0xd84a2c2352729a6c), W(0x58ba9921c5e1cb91), W(0x3a052a3a492385cd),
+     W(0xec00433e6d2720df)},
+    {W(0xbd1e8ac31bee9cd7), W(0x98d97390cdd1dc9e), W(0x575b276e3d727677),
+     W(0x66a644e9def76eab)},
+    0
+  },
+  {
+    {W(0x54ce0a93ce6acbd6), W(0x84c1b114267a8bdf), W(0xc11a3e48f01cf6dc),
+     W(0xe1d84ea9ff5143a2)},
+    {W(0x601c20035395ce29), W(0xb72f89bc73fbd6af), W(0xfdb63e80db2a273a),
+     W(0x86cd760df84e0454)},
+    0
+  },
+  {
+    {W(0x7cfc1db23068a292), W(0x8b76cbc83acc9e3e), W(0xafe721ec0650e3b7),
+     W(0x2952db8575c3960d)},
+    {W(0x00af40ddef5e43df), W(0xc98a401dfd4e9a16), W(0x30c7e531bd27bc71),
+     W(0xa40a9f688f7e894f)},
+    0
+  },
+  {
+    {W(0xbb161ae9af45c558), W(0xfa783b43d2304303), W(0x986d415121c434ba),
+     W(0x8997f2d8a97f9c1f)},
+    {W(0xc2b00315f1255007), W(0x375199b3966ca58a), W(0x87cd0912aff25f34),
+     W(0xed49b28f7049742c)},
+    0
+  },
+  {
+    {W(0x2b15169232b24d97), W(0x9ad9013a1c290528), W(0xb1570f78678a8557),
+     W(0xf12e59aaa0981720)},
+    {W(0x56003c75f3795720), W(0xa73d59c851352844), W(0xbd54061a7f432a42),
+     W(0xb483abf471c6ce03)},
+    0
+  },
+  {
+    {W(0x6aeb58a05027d7f1), W(0x7e33947ec89fe0ad), W(0x93533e5b25f1c162),
+     W(0x755402414654b761)},
+    {W(0xd30dde1f6d1b44ba), W(0x80fc4b71312a91cd), W(0xb5cdab3a4cc4e9fb),
+     W(0xaef67fea0b924fa7)},
+    0
+  },
+  {
+    {W(0x4047fae6ac735c5b), W(0x46ceb691f6d75fc2), W(0x8bb9d491a4a9b1ca),
+     W(0x3ac8a13dd40e0228)},
+    {W(0x3f1ad273fc1bc4d5), W(0x4417620429ee3004), W(0xdb60170fe416d933),
+     W(0x06a19c084b167487)},
+    0
+  },
+  {
+    {W(0x7753e2d24f177cec), W(0xccf9ea39b9275a9c), W(0x090d57ac9b6eea9a),
+     W(0xf6137bb58375e415)},
+    {W(0x80e432e0f83aac35), W(0x85c400c44e0d4d6e), W(0x9605fe1f8bfc54d5),
+     W(0xe844a541d99b325e)},
+    0
+  },
+  {
+    {W(0xbe0520115558f731), W(0x2fced72268f066df), W(0xea078038097fb5f6),
+     W(0x06edd7cc38faf25f)},
+    {W(0xa7af21a87bc7334d), W(0x2976e9c49daf5837), W(0x3ebc1e0f5af4b5da),
+     W(0xbe91b23406bddc9d)},
+    0
+  },
+  {
+    {W(0x14414a0503b66d13), W(0x6826cc4c8da407c2), W(0xf83b61eafe26bc59),
+     W(0x9a9aa928d3413a66)},
+    {W(0x34a79b862e934042), W(0xefe92f843c27f4ea), W(0x3a8c11875675b175),
+     W(0xe91a9518b0b1dc3d)},
+    0
+  },
+  {
+    {W(0x7a305095c9a36d6b), W(0xa88b4dbabeebbe29), W(0x27968c19e583ac3b),
+     W(0xfaf7994262cbe4ad)},
+    {W(0xad4bfc1439ff35c7), W(0x0ab5873083cf4c72), W(0xb5e3604c8feecbfa),
+     W(0x7550cefce00f6d1b)},
+    0
+  },
+  {
+    {W(0xed733d0eed353883), W(0xb5c83c5a64bdc6b4), W(0xfa100d8b15c6181d),
+     W(0x1632c0deeff000f5)},
+    {W(0xc8546e450811bc02), W(0xcd4bee73341319a6), W(0x2edc4b7f111be0ec),
+     W(0x9e1aecef18202b59)},
+    0
+  },
+  {
+    {W(0xc6beee7aa4a5af4a), W(0xdbf4d8f7244bdb8b), W(0xa08cf8f2cde88ae6),
+     W(0x1d92512d41667a37)},
+    {W(0xc633081669933943), W(0x62d5212bf395f7a4), W(0x6565f3f1fa487987),
+     W(0xa33c98715472e27a)},
+    0
+  },
+  {
+    {W(0x4440dd4373c3514a), W(0xeb523c2f86de96a1), W(0x7c50c15133f3c331),
+     W(0x416f528aa3e470d3)},
+    {W(0x062ffddd012633cd), W(0xc032697e37ba05c9), W(0x911a11ebf16f5b83),
+     W(0x11eddbf5f0288cd4)},
+    0
+  },
+  {
+    {W(0x460bef2e1b622702), W(0x680c40a151747d71), W(0xb4d473ceaa88016b),
+     W(0x90656f65746ebd50)},
+    {W(0x4fdbaff43269ef81), W(0xb315247841619420), W(0x23b8574b9837875f),
+     W(0xd2cd0ab1031716b0)},
+    0
+  },
+  {
+    {W(0xcd0e221e670abac4), W(0x3aff8e644408916d), W(0x4d202c1d7b3cf974),
+     W(0x1b82545898734c5d)},
+    {W(0x12d4858cc1033c65), W(0x09c25e946dc08ded), W(0x206f12cd5a3449df),
+     W(0x3d4a3705fbf6c8ce)},
+    0
+  },
+  {
+    {W(0xc168e83457043cde), W(0xae6c01efa3abcc8c), W(0xd0027c391714f6c6),
+     W(0x5180c3bfdc5a8f36)},
+    {W(0xbb6b6ba22a03d0d6), W(0x053bba57af7e16a5), W(0xc3efeabdc36bfd9c),
+     W(0xfd0f4e9f280fc769)},
+    0
+  },
+  {
+    {W(0xd6bf05ddb59d5f6d), W(0x2dd83ccc3a160939), W(0xe9a99492d60d165b),
+     W(0xf474e08eb833a2d1)},
+    {W(0xdf673c3881048ce6), W(0xd04b38e526e2d0ae), W(0xa54becb8c06a4b74),
+     W(0xe128f660e9a1f1e9)},
+    0
+  },
+  {
+    {W(0x6c5b48c2a6436da5), W(0xd2ee7838848c1ce4), W(0xe8f7204682cdeab3),
+     W(0x779ea908fd2e954c)},
+    {W(0xd73bba043d9277d6), W(0xbd75ceea56e88cfe), W(0xfde5a6f2ade574c9),
+     W(0x1ec3863b84041799)},
+    0
+  },
+  {
+    {W(0xd7a8973d59418458), W(0x059884f72fe1493c), W(0xc6c4133c785b5468),
+     W(0xf854806a096863d0)},
+    {W(0x9cb34757a19509b6), W(0x4a4fcdac40a8e402), W(0x61d35ed6ec8d5a7d),
+     W(0xa04646fba10547f0)},
+    0
+  },
+  {
+    {W(0x66c50a9dc0cab9cc), W(0x96b88a46fd072817), W(0x8adbead74ab3e7d2),
+     W(0x3f44a32abbf1f0e6)},
+    {W(0x0998887ce48c9389), W(0x38945f3b833f3965), W(0xbebc6ed033b6b182),
+     W(0x60de4737ec567322)},
+    0
+  },
+  {
+    {W(0xa839bb493b38e502), W(0x8636045650b75587), W(0x5b675940abe580cf),
+     W(0xa19c2aee9171cf7c)},
+    {W(0x8fff389fb1696816), W(0xc030b6faa37138ac), W(0x81f36c9d4a0d9710),
+     W(0x900fbfd9b063a7f5)},
+    0
+  },
+  {
+    {W(0xbeec7ba88d4a947f), W(0x4dd08dbe22dc4afe), W(0x502f95e6abb21b9a),
+     W(0xee66b640269ae08b)},
+    {W(0xcaf699d7b6a3f6dd), W(0xfbe05c3d66f9309b), W(0x18e887edfde46c27),
+     W(0x391d7bcb93db790e)},
+    0
+  },
+  {
+    {W(0x9a9693bdf7b0f283), W(0x1b7563b1101cad06), W(0x60e33124826989bd),
+     W(0x19e160d35e185afc)},
+    {W(0xfb0d1ebee9b02173), W(0xd9f074515b1891a9), W(0x796f810d46208a2b),
+     W(0x184a5dba7026cbb0)},
+    0
+  },
+  {
+    {W(0xe2b07b01e30ddaf0), W(0x6058a6eb0a4a42ac), W(0xf839122e6ef0be91),
+     W(0xae947c01fa29bf74)},
+    {W(0x44495e2ae3aedc74), W(0x1c49d1b92e4b9562), W(0x41add14e09976d20),
+     W(0x01c9a6707ad9e9a0)},
+    0
+  },
+  {
+    {W(0xc061cfa957856229), W(0x7d7c54f80dcd14b1), W(0xd00621f6dac93129),
+     W(0x7670ad367d121ddc)},
+    {W(0xe44c01287a6d185b), W(0x89c295df5980aad1), W(0xbd899c6f6e17847f),
+     W(0x1b075bc6c1d3fc5d)},
+    0
+  },
+  {
+    {W(0x7872e19d7cde453b), W(0xed6d77c9f8a08a61), W(0x54f6fb9bfb8511aa),
+     W(0x8e2822c3d5682770)},
+    {W(0x891d982c59e61dad), W(0x9c32c46ab5bb6a71), W(0x1ade5356db8e68ff),
+     W(0xe1781f765822eb5d)},
+    0
+  },
+  {
+    {W(0xede3ff2b9a2e6464), W(0xb83c2e5a16329899), W(0x911fbc9c61dec5ca),
+     W(0xdda504b7e34e1ca9)},
+    {W(0x8e9191e33432aed7), W(0x6b384f4125bca487), W(0xe437d49acefb7a41),
+     W(0xeb1c27ed191fae8b)},
+    0
+  },
+  {
+    {W(0x2dd37dd0d875df68), W(0x699a7dd94f2448ba), W(0x2c355281fcd03275),
+     W(0xd47610adf0021fbb)},
+    {W(0x30e42d151f8ed0cf), W(0x458e76393023d9e8), W(0x276c4a15ce32fe09),
+     W(0x209302e10bad6897)},
+    0
+  },
+  {
+    {W(0x352caa0885890fad), W(0x05901d4dcbbe29af), W(0x171d6047c0f4ed0f),
+     W(0xa2f1d3e3dd2e8143)},
+    {W(0x38ac6c58aefb6167), W(0x678e932ed7a43b8a), W(0xa18b1737f41c0b6a),
+     W(0x434787bf03e4e0eb)},
+    0
+  },
+  {
+    {W(0x0f36bdb7abe0b71d), W(0x2b97082f90b18d77), W(0x500b705021091332),
+     W(0x392eaf5eb8136996)},
+    {W(0xd2bdf0f3e3435655), W(0x91d18fab82b7da3e), W(0xacb67effe894ed77),
+     W(0x0365cd9e131fee69)},
+    0
+  },
+  {
+    {W(0x596fc3232aa63729), W(0x6a747489c35cba38), W(0x86735e7b6627217b),
+     W(0x87742b4019d1dbcd)},
+    {W(0xe436de1d42f1aae3), W(0xa59e8dc277b74601), W(0xdb031719fca1a725),
+     W(0xd232fe14a7151bad)},
+    0
+  },
+  {
+    {W(0x08c70a91ec1f66f5), W(0xb6095acb2c5a4e5f), W(0xbf7b084d9c2fb8df),
+     W(0x353c6ead8a84ab87)},
+    {W(0x797f65d7d5c0a322), W(0xd6b551b1c91562e9), W(0x696d6f8f829c586c),
+     W(0x1c75692c1eff5491)},
+    0
+  },
+  {
+    {W(0x7c4a96d3e29b5638), W(0x904dba1998727dfd), W(0xffa928e204c73e83),
+     W(0x462ddd81922bc5de)},
+    {W(0x59c96051dca62256), W(0x66446219aaf3827e), W(0x318eb027e80ebe7f),
+     W(0xff9ab12d6268535e)},
+    0
+  },
+  {
+    {W(0xce1375199723de5d), W(0xc119d57d6e5ad4e3), W(0x654068d41f27cfa7),
+     W(0x7eb7679781e66ce8)},
+    {W(0xe6ba88a3dbe4afb5), W(0xbfa5e2344babb1fb), W(0xe2337979ba0291d1),
+     W(0xeb6c25b8a8f1a628)},
+    0
+  },
+  {
+    {W(0xa5d2f50543b3955a), W(0xcc1cbb7bf4c53a8d), W(0x0d9c947dde5af9ba),
+     W(0xc8f64909855a6198)},
+    {W(0xf999f6eb61a21587), W(0x8f49c5a28a9aea20), W(0x282f9f5ff1b63c91),
+     W(0xc9803b79faedde81)},
+    0
+  },
+  {
+    {W(0xab8dd3e38edb6ecc), W(0x60378de4eab05fd8), W(0x8649f54deef5c7cc),
+     W(0x9388da8b95de9faa)},
+    {W(0xf045c3bbf3350184), W(0x6d5fd2fd47cc961a), W(0x4c8d36d154163005),
+     W(0x77d732064381201c)},
+    0
+  },
+  {
+    {W(0x9ce90f0bfe849f0c), W(0xb4750565898b7d1b), W(0xb8a20a0860ec60ac),
+     W(0x5bf4d12271f9ce60)},
+    {W(0xb519fcbb74ba15c9), W(0x0a17e84ea0a24a11), W(0xefa7f4558bbb4872),
+     W(0x4b135aad82294839)},
+    0
+  },
+  {
+    {W(0x92594795c1c36560), W(0xb4fea0014e5f54c9), W(0xa6c5d37e5b42ffee),
+     W(0x16b152f954e840ae)},
+    {W(0x69f52a96ef21eac5), W(0x67a37ffe49daa72b), W(0x1c9508f1a1cb4a6b),
+     W(0xfb301e21f5622fc1)},
+    0
+  },
+  {
+    {W(0x03fb574ede19eba3), W(0x8bb25ff1bd75dfe0), W(0xee0a8acc6efce890),
+     W(0x6917c01d1d60ffd5)},
+    {W(0x01cc17832e8dcffa), W(0x2d38e578232d4b2f), W(0x4998f85ad3e798ef),
+     W(0x4b34d0972f85e6df)},
+    0
+  },
+  {
+    {W(0x23f9b3608e73d9ce), W(0x9b5be4d2e9bc3a2b), W(0x618fffb4beef33b9),
+     W(0xceb866e961dd3800)},
+    {W(0xd78f43843a8c5263), W(0x271748093f88bf5e), W(0xd33480e6b1a7e273),
+     W(0x7bc600e9ef27dcf1)},
+    0
+  },
+  {
+    {W(0x8394caff0a32282b), W(0xc6257cd37063bb61), W(0x3d84de44e9a4f6ed),
+     W(0x516ed6fdf345ac54)},
+    {W(0xa4047b2f3b31795d), W(0x775f6ae80b4fadc5), W(0x1f3cbe3126d4ccf1),
+     W(0x8ecb816636af0b97)},
+    0
+  },
+  {
+    {W(0xe6492f88fe6d5ada), W(0xaf827520bba3d94b), W(0xcfe13554b35977d6),
+     W(0x4adcba64715a3648)},
+    {W(0x748f70dd9cd98a9f), W(0x82fe920f28fd6438), W(0xe8993b76169c5335),
+     W(0x8a9b0e07d052b3aa)},
+    0
+  },
+  {
+    {W(0x30f68acadee7f546), W(0xa39f706844524631), W(0x5585a0994872af03),
+     W(0x45727e60c5c61224)},
+    {W(0x66a697ec335c8546), W(0xe0fdc41bfd4e9b9d), W(0x456eb1a8d3a71e23),
+     W(0xb0720556709cba16)},
+    0
+  },
+  {
+    {W(0x7254ed12528cc93f), W(0x65dfd5ca385d2981), W(0x284ccda3ba5796ef),
+     W(0x47b70ba8ed789496)},
+    {W(0x6aec95b97ced5518), W(0x9542a3946cb7dc92), W(0x7cd1a06fba2a26c8),
+     W(0xfc3d2373fc6dd33a)},
+    0
+  },
+  {
+    {W(0x7d4746d743200f21), W(0x3d6da5ec9370e04c), W(0x5c5b6b1c5e05290a),
+     W(0xdfdcc6ae1e3ecd91)},
+    {W(0x9fb1d6c6300704b5), W(0x01ea031ad7a1631b), W(0xfff37bbe02bfcbbb),
+     W(0x07d97592c03691a8)},
+    0
+  },
+  {
+    {W(0x7df278012da3495a), W(0x80c0cff3552cb538), W(0xb95e7fd8600cc96e),
+     W(0x831b325f89a274ee)},
+    {W(0xdad77cd6273a598d), W(0x9a333e09d79f40d5), W(0x378a2d6d676b7570),
+     W(0x18dece4b3a21db4b)},
+    0
+  },
+  {
+    {W(0x95648ffbce423555), W(0xd92b1c32f2a3911c), W(0x006fa0f33e5bdbc8),
+     W(0x9b7eac51e9afe8b6)},
+    {W(0x641aa7e9abedceb7), W(0xeb6f63331f92bfd3), W(0x13b9d0ac867b33cf),
+     W(0x0ba7b477d3f7ce60)},
+    0
+  },
+  {
+    {W(0x1eb7ccaf7cd65f86), W(0x619cae2b52546eda), W(0xfeca4b0f4254db75),
+     W(0x90d01db688f9ff7f)},
+    {W(0xde50f948400df5a1), W(0x5a13b788c95c2029), W(0x8b8797155584476c),
+     W(0x1afd300c802a2fa5)},
+    0
+  },
+  {
+    {W(0xb74baed04ad23a7a), W(0xd6498950297e78d1), W(0x4715a4155cb2ce91),
+     W(0x88d6a137a8f293ea)},
+    {W(0x0424132e1b631e09), W(0x782a4f24328b5033), W(0xd49c5cf9a1dbc4dd),
+     W(0x10e958c137e843a6)},
+    0
+  },
+  {
+    {W(0x50877032dfabb7ac), W(0x979318724202ca15), W(0x72a5bd1c4ce687c7),
+     W(0x9258c1749f375260)},
+    {W(0x23d4b765c665ba48), W(0xbb50b32f97938ccc), W(0x31525ef506582c15),
+     W(0x8f440e883c73e5f7)},
+    0
+  },
+  {
+    {W(0x6b5c4fa3a9981786), W(0x49794b36bd6157c9), W(0x5c75ae920d85739f),
+     W(0xac09d2abb9f64b85)},
+    {W(0xa9fa60ab3a89f483), W(0xd1bc992da8530183), W(0x861863b7c941cf4d),
+     W(0xbfba67e33c47c20f)},
+    0
+  },
+  {
+    {W(0x4ae96262a6a0804b), W(0xc5f7c30ebc2fd3b2), W(0x0656d3a1b4d9f081),
+     W(0x9051a9ecc4112fa0)},
+    {W(0x68f0f07eb9fa43b6), W(0xb7e31de7137d02b4), W(0x1c2bf9cece1db2c7),
+     W(0xb342f09e24b9b010)},
+    0
+  },
+  {
+    {W(0x557816fbe808d82f), W(0x32c8e19a2ee261e4), W(0xb3712e9e9609c14b),
+     W(0x956af0566857f9f2)},
+    {W(0xd890bbe3838ccccb), W(0x31977e0d2b4a2d30), W(0x5094d2f725e8dd03),
+     W(0x54eaaa1bd326c45f)},
+    0
+  },
+  {
+    {W(0xbd151a42711b8f9d), W(0x1c5f2f2fde5e91cb), W(0x39b50861d6a811e3),
+     W(0xd70a7ac8339dcaae)},
+    {W(0xe4e5352a6ccdf0ec), W(0x30a021e93f2e7e6a), W(0xa765cda2b3113620),
+     W(0xdcaa3c1198268c91)},
+    0
+  },
+  {
+    {W(0xbfd963b9188b9a9f), W(0xce5d5d871e75ea9e), W(0x2d0efb42622f6a3f),
+     W(0x5319ca73cf36805d)},
+    {W(0x483e537addb5fe22), W(0xdf04f923df33dc64), W(0x8632af29a42cbcf0),
+     W(0xa304f34c0882aff4)},
+    0
+  },
+  {
+    {W(0x145c512de308ade7), W(0x0154eff0d53e83fe), W(0x95aa06e161d5180d),
+     W(0xd004015a753a97cc)},
+    {W(0xf936d61e0e99a44f), W(0x746e8f343c9ac493), W(0x6dfcfa2d0cfe2dd9),
+     W(0xbf94145ef663e84a)},
+    0
+  },
+  {
+    {W(0xc57fb0d8ebc010ff), W(0x555bac2a4a5aa2fb), W(0x11f116fea87883a9),
+     W(0x21f37d99016338f0)},
+    {W(0x8a2161c4acf954ca), W(0xc19243c65c9b70f0), W(0xe141ed1ea99e451b),
+     W(0x58c2e5150f709b13)},
+    0
+  },
+  {
+    {W(0xb48d00a39d32fbda), W(0x7e9114468b639b72), W(0xc3d5cfbe47e839bf),
+     W(0xf519d440efb8e995)},
+    {W(0xfcd7b86080cb078a), W(0x2726ced3d0015af3), W(0x46cd503081f15acb),
+     W(0xea75954dfd0c5924)},
+    0
+  },
+  {
+    {W(0x417eac87a42e826e), W(0xbed532fab33ed07c), W(0x279b727e6e72d64b),
+     W(0xea475d880504224d)},
+    {W(0x844e19ad81057e2a), W(0x2cae744a887b11e9), W(0x5c398385efd57219),
+     W(0x4c7427ab564c7d53)},
+    0
+  },
+  {
+    {W(0xcd25cd158e7c78dc), W(0x512b6cb4d7fb3c21), W(0x27c22c58623dbbc6),
+     W(0x0ba6bf472eb54f94)},
+    {W(0x3f31295d0016c00d), W(0x5c85574d08cc3427), W(0xeedac1b503ae6348),
+     W(0x24a61416006c7e85)},
+    0
+  },
+  {
+    {W(0xd7380189f9d57a55), W(0x61126a63aa7df5c2), W(0x352d092c688c4417),
+     W(0x850581969ffc4738)},
+    {W(0xcd6de35de2f073d4), W(0x1e270039b1d4a36c), W(0x061756ea0254c1be),
+     W(0x0775516cc1d5712b)},
+    0
+  },
+  {
+    {W(0x8f212181f6353b5d), W(0x44915a81fcdf8d5b), W(0x2144cf44943d32bf),
+     W(0xa9b986da2b4d0b92)},
+    {W(0xafd599b9db689f23), W(0xfbe666f36f01c5f6), W(0x66d0ab1ccdf05efc),
+     W(0xef005aaeb172c093)},
+    0
+  },
+  {
+    {W(0x8c98bd4713325a8b), W(0xa9fd3d4d606ed224), W(0xfb81f23336127ae9),
+     W(0xa3e81e505d92e871)},
+    {W(0x14ebb16f54af081d), W(0xfcc5943c5c5eb2af), W(0x5733a3da79782d2b),
+     W(0x39d4c423d4eb9833)},
+    0
+  },
+  {
+    {W(0xedc0f2e9c0150a5b), W(0x10f3e0a6e889768b), W(0xc4c09511992c7d41),
+     W(0xa05eeff3c5d569e5)},
+    {W(0x077c7dd9c3a56e62), W(0xf895f99ebd9fd8e7), W(0xbc6147f02e669c65),
+     W(0x2aba3b1d4dbb57a0)},
+    0
+  },
+  {
+    {W(0x4ab2464ce7996eb7), W(0x516bbbbe0770ea5e), W(0xb568a7cc60a19a04),
+     W(0xb51de33551cec021)},
+    {W(0x76f059cb47dd15c4), W(0x9f73c8deb7fbdf86), W(0x78a9c0dadee06b0a),
+     W(0xac73d63a25a6d41c)},
+    0
+  },
+  {
+    {W(0x3363eb6ac8bde210), W(0x4217bda358f84887), W(0x5b19900c6342e884),
+     W(0xe09cccb1e0dc2ef5)},
+    {W(0x4bea1079996124c9), W(0xbc2aa46e8e83dbe0), W(0xd53c15bba9a2ec34),
+     W(0xaeafe507f11ce2b0)},
+    0
+  },
+  {
+    {W(0x9ec16d8a991ddc1e), W(0xf67d8d0353a5f872), W(0x34c1bd2c007521ee),
+     W(0xf93c411fe00758eb)},
+    {W(0x112f51cb15158797), W(0x0d36de91ae091c4b), W(0x8373a392e7a93d0c),
+     W(0xbb5137116d219c51)},
+    0
+  },
+  {
+    {W(0xfd07990c300bcfd9), W(0x21f2bd3e8618f828), W(0xa6a908604b2536d4),
+     W(0xaa186c6bbbc94416)},
+    {W(0x5a385d66330a4fe5), W(0x41b70d468e983a7f), W(0x9f454fc6573c7502),
+     W(0x032aa907d3a1e465)},
+    0
+  },
+  {
+    {W(0x681b1e0641b131d8), W(0xdb1dadc54117e6a7), W(0x00a31e35efabe4b0),
+     W(0x77817c66efc9d792)},
+    {W(0x467eb2fba444f46e), W(0x3adfacb1b0fbe459), W(0xd02758b2e8f6867a),
+     W(0x33eb91139ea3085b)},
+    0
+  },
+  {
+    {W(0xc223fba6f6f80703), W(0x9acc2842e6a7d748), W(0x71fb69d0345a9159),
+     W(0xcb5693eed11ecc14)},
+    {W(0x382eac10fccd6c68), W(0xcbcf20f8e35825da), W(0x55875e82c50e9b24),
+     W(0x25a1267816c93703)},
+    0
+  },
+  {
+    {W(0x260f989cabe24ed1), W(0x7092ecc3caf8a922), W(0x2b485f1e81c4283d),
+     W(0x0dc4b9e789f1f0b8)},
+    {W(0xd547e65769d91876), W(0x67fc427d115e27a2), W(0xde9a0e2dc260c9eb),
+     W(0xc74c22928d4b51e1)},
+    0
+  },
+  {
+    {W(0x89753eb3a77e7560), W(0xb7b444384c1833a9), W(0x5f7ade8dda8adeb0),
+     W(0xc191ee61df611707)},
+    {W(0xc3ce61a5840a7988), W(0xf5f7e3f3727ff517), W(0x23c40555b0cca70b),
+     W(0x92164aae2dc82a14)},
+    0
+  },
+  {
+    {W(0x559ad3a57f6a6e38), W(0xfdae9b545c95df61), W(0xe63a4502367d2bc4),
+     W(0x7941e01a5d0224b9)},
+    {W(0x6b138492ffd64417), W(0xeadea5e3870eeb78), W(0x6d337455cb55787d),
+     W(0x80b28b49dd62f908)},
+    0
+  },
+  {
+    {W(0x0b4a8a93bb0c2bf7), W(0xd729fd4120544416), W(0x506ea598d2496940),
+     W(0x841393194b24b6ae)},
+    {W(0x9ffc82bf1781ceca), W(0x6184abfc42e16168), W(0x2e52039e1e057622),
+     W(0xc567b8ee622a8e9c)},
+    0
+  },
+  {
+    {W(0x11dbff4fce79023e), W(0xaede261b598b330f), W(0x73d588f5108734e4),
+     W(0x4478b0d1a4610dee)},
+    {W(0xa07ac312bcae0252), W(0x225962f10cefa8b2), W(0x030ac6cec417d4fd),
+     W(0x03b5eb4a6c72c67a)},
+    0
+  },
+  {
+    {W(0xb85b546c855333bb), W(0xc30c3e5104cf1eba), W(0x4b2e35b47b27a2eb),
+     W(0xf2e31cb94430bd05)},
+    {W(0x144a788934f5f756), W(0xb4bfcda85c8e7b3e), W(0xb8574a51d605db06),
+     W(0x4a7d2122571c4180)},
+    0
+  },
+  {
+    {W(0xc4eeaf96c43401f6), W(0x755a15cab1ee6de1), W(0xfd026f04ef5a1343),
+     W(0xb797d380a7b60ca3)},
+    {W(0x79bfa03d8a6b5d5a), W(0xfeae35a4fb361377), W(0xaa9c21b0b596a13f),
+     W(0x5f6e08da86cb5065)},
+    0
+  },
+  {
+    {W(0x7aeecf2353c995f8), W(0x4907d11a60838130), W(0x895907ce657c38c9),
+     W(0xf9a080e7eac6d081)},
+    {W(0xd354f499ed2c06dc), W(0xd081d005c069a42a), W(0xa5026720a311e06a),
+     W(0xcfcff2347c876687)},
+    0
+  },
+  {
+    {W(0x7050968a899f1148), W(0xf6a3a6cd46b660c3), W(0xb62754a238db42f9),
+     W(0xc892fe830c77c654)},
+    {W(0xe010875e79592089), W(0x63a6ab98fe3cd8b4), W(0x08f69bc4bc3a89df),
+     W(0x9ac4578e7c94b79d)},
+    0
+  },
+  {
+    {W(0x53a002f762da271e), W(0x09ddae06ec71b0e8), W(0x6156610874ceadcb),
+     W(0xffbac3edd45a08b1)},
+    {W(0xe572d6c79243a5e7), W(0x9c9fcf0fd2490716), W(0xc45753b2e43dad1a),
+     W(0xa706f741ea9f4482)},
+    0
+  },
+  {
+    {W(0x27291fe0abe83783), W(0x746c74eb811f60ba), W(0x92c6d0176f8c429f),
+     W(0x5f64ebe288db0d14)},
+    {W(0x917ff88304d9dbae), W(0x97b4bb837d5a9b4b), W(0x70ea5fe1687b47b6),
+     W(0x353dccffd581b3dc)},
+    0
+  },
+  {
+    {W(0x3a707c405b1a87b4), W(0x5d9ef78e45ee33ca), W(0x87ac8e9ba9d3c77f),
+     W(0x4dcf89d66f92fcfe)},
+    {W(0x4b51c8b8e8ee905e), W(0xfa9d815d0b733198), W(0x1323685bf9dc2942),
+     W(0xddac2ca09340aee7)},
+    0
+  },
+  {
+    {W(0xee84f44d9764b521), W(0x1e03124afbe4bb06), W(0xa08dc854dc9b4ceb),
+     W(0x72ac9b9097791ae6)},
+    {W(0x967d9049f3627301), W(0x09f2f54fc356ce66), W(0x5e3c33e7af0ef19c),
+     W(0x7c1c4c5402f2f203)},
+    0
+  },
+  {
+    {W(0x14b5989209cd8750), W(0x818855d100e21103), W(0x5729a17dd361fdaa),
+     W(0x93e55f5548560d39)},
+    {W(0x694e91fc65d4da87), W(0x4e44c2c47d7b36a8), W(0xf6965bef72a46c46),
+     W(0x0c76fe6db5bbe873)},
+    0
+  },
+  {
+    {W(0x17e761e4484e04a1), W(0xadcb88fbde1c31f7), W(0xb2e24b089a0c3631),
+     W(0x3357a3fe4a7ed1ad)},
+    {W(0x0cc1da976c4ee707), W(0xbe9bb10f32089b41), W(0x619f344312dfa7eb),
+     W(0xf16cae5e4f279950)},
+    0
+  },
+  {
+    {W(0x8c8b423aba5811db), W(0x721301113bd0d5dd), W(0xf7215cf07dbefd05),
+     W(0xb8ad2aea369fa88b)},
+    {W(0xde5a8fbbfd9ebe97), W(0x5b9211d7ff94917b), W(0x990ae5d8cffe3544),
+     W(0x8fe5026366c6decd)},
+    0
+  },
+  {
+    {W(0xea15c197448784c1), W(0xcaf737ded9d32d1c), W(0x328c0eee7ce8e84f),
+     W(0xb3a7c10fd34f3ab2)},
+    {W(0x36a6647fa0d13d66), W(0x759df3bf9ae4f471), W(0xd9810b66f71aff9f),
+     W(0x28bb2a186fbb8952)},
+    0
+  },
+  {
+    {W(0x3617ed7310da1a11), W(0x8f3b11095bebf233), W(0x7210408265c8c1bb),
+     W(0x2fa7982cc86a7b7d)},
+    {W(0xcd72e0f67e7beaa3), W(0x0b32dd7c9ac090f6), W(0xd6b380f0422eb22f),
+     W(0xfec45b8e15c84366)},
+    0
+  },
+  {
+    {W(0x60367322c891b9f0), W(0x9b2c8a7e4d72b090), W(0xf0739461b95036bb),
+     W(0x4525fafb8670d6e0)},
+    {W(0x059b25814e9b1453), W(0x50a18c01603865a6), W(0xbdafc8ab8214803c),
+     W(0x84a4dab2ba0a2a5d)},
+    0
+  },
+  {
+    {W(0xf6847331c2e1f81f), W(0x34873c5abdc8b7b6), W(0x8fb4e985d92109f5),
+     W(0x62b0fe6fca410131)},
+    {W(0x7a5ae9604084f033), W(0x38fbab60c755e439), W(0x750d9dbaa8b6d578),
+     W(0xf310389c27e77cb8)},
+    0
+  },
+  {
+    {W(0xf085b02c9650a99d), W(0x492adc4a09ff438f), W(0xd1d533fe29fc03eb),
+     W(0xfbfa93775a8b2035)},
+    {W(0x867b4f38e3d281db), W(0xcb420a9ca0f1b505), W(0x2caab7ddf281187f),
+     W(0x05668c449f04e8db)},
+    0
+  },
+  {
+    {W(0x68bfb35d130ca9d8), W(0xfddcb5ec8d778afd), W(0x1fecc3cc7f1c6068),
+     W(0x95116d1ef36dad02)},
+    {W(0x7ac60e55be2ca178), W(0x9ff9f692feb01f83), W(0xa503491065acdfd8),
+     W(0x41710463bb86df19)},
+    0
+  },
+  {
+    {W(0x20c5f2d0e93d4f7e), W(0x9d422cbc8e49de78), W(0x25a7778a0a422192),
+     W(0x7832745d25f87573)},
+    {W(0xd0ccf3b6fc7dfa2d), W(0x38793fb3a5ddaa99), W(0xc4943d56e571658d),
+     W(0x18920375fb058fed)},
+    0
+  },
+  {
+    {W(0x8e584938770e1831), W(0x8f46e42deda01caf), W(0x78e4f499b7e546c4),
+     W(0x6e0571b7e5b1e50e)},
+    {W(0x0ee511bdef5a0c92), W(0x61edede02586da4b), W(0xce39b990b193b182),
+     W(0x11660e6d1372af8f)},
+    0
+  },
+  {
+    {W(0xca6b12f12b3f8a73), W(0xe272bab2a49d2ad8), W(0xe063c87a6bfd6d92),
+     W(0x2bbe356e14356859)},
+    {W(0x8c424771ce216d0f), W(0xae301d96375a9521), W(0x8e61c6acfa2eeba9),
+     W(0xdd427b2d37e95cb6)},
+    0
+  },
+  {
+    {W(0x84b522262a9de8ea), W(0xb62b6f23310cce91), W(0x3fb79ab736ae5e39),
+     W(0xe8b2acd2078c258e)},
+    {W(0xf9f210a784759ca0), W(0x2f5e6a22223169dd), W(0x977669853d97acf5),
+     W(0x190affe0c42502c5)},
+    0
+  },
+  {
+    {W(0x2afcc32282b65d82), W(0xf6699fc3fefd64aa), W(0xb772958a3d7257a7),
+     W(0x10229b5c841f59ae)},
+    {W(0x7c65850d75fae85a), W(0x5a007c532e5bdde4), W(0x520afc1a66244861),
+     W(0x00014a7d12c57cfd)},
+    0
+  },
+  {
+    {W(0xd9ee53233fb1a3e5), W(0x4b045d8706623567), W(0x7e6f555e4bdfc7ad),
+     W(0x8fe42f23b87937e2)},
+    {W(0xd91497f669b6234c), W(0x53a0f75345cc75ea), W(0x70f72dee0284beca),
+     W(0x9906a5d1269f8f56)},
+    0
+  },
+  {
+    {W(0x70640a9357face2a), W(0xad49f5e92eac34f9), W(0x8d5ab2cd4d73ba35),
+     W(0x045936f0120c2834)},
+    {W(0x22a3128cc5a27171), W(0x0b2f7a112fe18f85), W(0x888a965b9bb19cef),
+     W(0x3caf9d593d2b0239)},
+    0
+  },
+  {
+    {W(0xd810eb3aaf9c91b7), W(0xdabf5f545a4df12d), W(0x162e552ae48af6cb),
+     W(0x6a500ee59740e4d9)},
+    {W(0x0b8a5d975ba51a76), W(0x88a1ec9ff4cf4358), W(0xd6c99ae36442745f),
+     W(0xe21b57b193381d46)},
+    0
+  },
+  {
+    {W(0xe9a455f56dbe77f3), W(0x65a734c4ff0351e5), W(0x3616bd6dbb5f8d31),
+     W(0xbff70ca58fd4a8e7)},
+    {W(0x2c8ae442f3d86b10), W(0x410cf84d17ed0426), W(0xcddc126ea5a3a0c7),
+     W(0xb624539d11abd601)},
+    0
+  },
+  {
+    {W(0x19d3451cc6cf16f2), W(0xe5a31d002d127280), W(0xc601c65e0775dc8a),
+     W(0x97c864b8d35c8c78)},
+    {W(0xe817f8642f400bf9), W(0x2154f0e7cd481927), W(0x5995ca903376aec0),
+     W(0xce00092f958c4ab1)},
+    0
+  },
+  {
+    {W(0xbdaf480373d57879), W(0xe2f954824388cc20), W(0xcaeee174f5bf5bf4),
+     W(0x53098857c52d6b7e)},
+    {W(0x71d7f3d11677e55d), W(0x2d112890a7c62a39), W(0xd32535b97c5f2dd8),
+     W(0x0b673a27361b6a23)},
+    0
+  },
+  {
+    {W(0x023f066f48d63cf4), W(0x4c6ff28e2fdbfea2), W(0xc849f3f35220d50f),
+     W(0x8f83b2b5da5c58d9)},
+    {W(0xf283cff948830506), W(0x01b0de0856e1dfd0), W(0xf70a903cd3f644db),
+     W(0x9de040cc196b32e5)},
+    0
+  },
+  {
+    {W(0x9a18e13d0cf0a980), W(0x8ea27413120ba12c), W(0x257d3186d9a38b21),
+     W(0x547a1946110492be)},
+    {W(0xa4934fa469bae4a1), W(0x249d7e2a0ef12bc3), W(0xd62c17f881a6b22a),
+     W(0xe6318123bcf06b34)},
+    0
+  },
+  {
+    {W(0x0bdbe2461c91871c), W(0x18e9ace541dfc10f), W(0x7fa0b61b411c964f),
+     W(0x10cac48d4a14227e)},
+    {W(0xf2adf021374bcc35), W(0xea4e2bc5dff5ec51), W(0xe47ef889bc9ec4a5),
+     W(0x661eda889efc4f16)},
+    0
+  },
+  {
+    {W(0x7c322c1984c3770d), W(0x8ea5fe0b8e4c8ff8), W(0xb8c1336d435cd731),
+     W(0xbfe507b3fae36845)},
+    {W(0x73e497e854ac3e3a), W(0xc0e2f8682460feab), W(0x384cae2f852f9011),
+     W(0x0a01edeebdc5a0f2)},
+    0
+  },
+  {
+    {W(0xdf08c5809e87554a), W(0xfbc7e3be66cecf32), W(0x2d024409e2f684c8),
+     W(0x5fd9df5284b816d4)},
+    {W(0xae24dd3226f434db), W(0x06ed25497199f355), W(0xafc1658be596e071),
+     W(0x305dc4710d20f235)},
+    0
+  },
+  {
+    {W(0xe190aacb8be8ba8f), W(0xd4ba653679e08b62), W(0x28d86f555738d978),
+     W(0x586b7f849fb3032f)},
+    {W(0x8e0d4ef015af8987), W(0x81211e850e933cd0), W(0x743e035754c41858),
+     W(0x9a870a741bd6c3ae)},
+    0
+  },
+  {
+    {W(0x82c0a26e83c12aa6), W(0x7485937558d38f1f), W(0x096249ebdb8d3948),
+     W(0xea5c9d8d8eb05130)},
+    {W(0x2b9e7cb5a2e37a41), W(0xb5e1dd9c7315f7b4), W(0x60b288a35b4025af),
+     W(0x3f0d76f9a3ff82f4)},
+    0
+  },
+  {
+    {W(0xbf90edf3072769c9), W(0x8320594737c5d106), W(0xfec56fe93ce250fb),
+     W(0x8353cee28d95cd09)},
+    {W(0xff5485be25af29ef), W(0x1235c0f94428218b), W(0x2e6f1f13849f685b),
+     W(0x13cb98d4d8060bf8)},
+    0
+  },
+  {
+    {W(0xb48d81ff3cb8bcb4), W(0x38363693bf554983), W(0x4da9c58b91809546),
+     W(0xc2f38ee2e482782d)},
+    {W(0x42c933d6b745648e), W(0x7514fd327b789083), W(0x8514efa574d2b55b),
+     W(0x2cf975d01c278d67)},
+    0
+  },
+  {
+    {W(0x002e51581f7d29cb), W(0x11feacfd41000aaa), W(0x0edb526ea22f46de),
+     W(0xb32ac1766ac810db)},
+    {W(0x4f71720020c55bb9), W(0x51490df50d1819c5), W(0xa99562cc2d2f0853),
+     W(0xd1f454d69c39b407)},
+    0
+  },
+  {
+    {W(0xd8a98fcf64e1889e), W(0x61bc94fba7e1612f), W(0x4b98da502ad85735),
+     W(0x65604e1c23bd36c2)},
+    {W(0x8afd53a8f0ceaf1e), W(0x49964e26af9944b0), W(0x243c5ca66e814009),
+     W(0x86f940369b0d4fe7)},
+    0
+  },
+  {
+    {W(0xccee97accafe8ad8), W(0x32ce95dbdf3d3bf2), W(0x9f6e1108615165e2),
+     W(0x653ac17d28eba4fb)},
+    {W(0x1776baad1a4a569c), W(0x1110c05cdb1c21db), W(0x50ce4694e5ca0d55),
+     W(0x1668f0cecccf8cc4)},
+    0
+  },
+  {
+    {W(0xefa220711380c031), W(0x3a9732cd79fe3d4c), W(0x90ad490aafdbf6dd),
+     W(0xafb377bb8c2d5537)},
+    {W(0xb62f888fe1f0cc34), W(0x85dd20d0316d3b0f), W(0x93026ce9cba59c1c),
+     W(0xc207dcf3834d83cb)},
+    0
+  },
+  {
+    {W(0x79566125d8b3c6ac), W(0x991b3de92d1dfc4e), W(0x24654900cc0af8a9),
+     W(0xd1c69f5cb45c7bc3)},
+    {W(0xbe0ed0f0611281b9), W(0x74c12688e73f3926), W(0x73ee3a2038fa0d37),
+     W(0x83ee3d572788e6a7)},
+    0
+  },
+  {
+    {W(0xb181fa7e6d585276), W(0x9ceb325efb78dc49), W(0x30431a8b27e8161c),
+     W(0xcb0681e82373a31b)},
+    {W(0x04f2e9da86ec9fbb), W(0x39b40bf015272374), W(0x89bc5759cd91245a),
+     W(0x6d75dfaa65d4cb48)},
+    0
+  },
+  {
+    {W(0xb269d54c5c64ddda), W(0x36c12839a91df525), W(0x03f74da68c523bb8),
+     W(0x314edba09efc2ee9)},
+    {W(0x12115f071f0cb4c3), W(0x9ca5541fa17917c6), W(0x41d720333c294b35),
+     W(0x486b361b3f6cbdc9)},
+    0
+  },
+  {
+    {W(0x91a40d92c3b609f0), W(0x9d6096b45ced18e0), W(0xaf12b91a95debe09),
+     W(0xeefe9eef5497cb98)},
+    {W(0xbb0fa12a36f67a4a), W(0xb9c4c6a07dbe4a04), W(0x07eeec28d5e04748),
+     W(0x54e4addff7d98e63)},
+    0
+  },
+  {
+    {W(0xdbeaa8c00c1aa0f4), W(0x7cd71a499565f8e3), W(0x9f75f9a47f3924cb),
+     W(0xbd2fe290c7c2d4bb)},
+    {W(0x33532df0564be340), W(0xc2f34f4b8741055e), W(0xe71f81415bd21f46),
+     W(0x0de446a6579fb9e3)},
+    0
+  },
+  {
+    {W(0x5487428aa41b71de), W(0xf3696eb56ef2d237), W(0x0782419b53769b78),
+     W(0x9255307acc628d08)},
+    {W(0x181ee7ec2ac7d773), W(0xc660e5cb9e743936), W(0x95233d5573c0b8bf),
+     W(0x35584a8ab3070150)},
+    0
+  },
+  {
+    {W(0x4d814ed4550c31de), W(0x89e0f4370e9d83f0), W(0x994a05948ef7b9d0),
+     W(0xdffd33449443c4fc)},
+    {W(0xa7b70bbacea33da0), W(0xe9ec5da508223bc0), W(0x9e2dcbf0c51e01e5),
+     W(0x653c8903ad566ca2)},
+    0
+  },
+  {
+    {W(0x4957a67c73cc8918), W(0xe155bae3c9c88c7e), W(0x34cdb6478c3bc907),
+     W(0x52ddea18741cb6aa)},
+    {W(0x59e2a8947609c5e5), W(0x8e3c6225f7266eca), W(0x499a4036ab333acd),
+     W(0xd051386699accab5)},
+    0
+  },
+  {
+    {W(0x1b41c8ea015eb7a5), W(0xfdc332792e6f4f40), W(0x54bdd2f2e4d1bff5),
+     W(0x3a720f9275763969)},
+    {W(0xee27c0db3b5d88b8), W(0xe1819ec6e3b50702), W(0x23d9f67af7307eda),
+     W(0x1559f23fbf412ff2)},
+    0
+  },
+  {
+    {W(0xefdc6d24e26be66c), W(0x4f4a20d84bcf7698), W(0x561e1891c502a6cf),
+     W(0x40f28ce219a65f34)},
+    {W(0x5e325f9cb8a2e7a4), W(0x97ff2336ac930b5b), W(0xeab744a7a35de938),
+     W(0x8253824688de23f9)},
+    0
+  },
+  {
+    {W(0xdcdb82fb847fe177), W(0xa791dd6ff7adf24c), W(0x616a71daeb9d5457),
+     W(0x788311aea64acd46)},
+    {W(0x4f82d76f4e2e4fac), W(0x39b5a1308b2abc25), W(0x2512eed9a4b7a406),
+     W(0x228a5fd52da2a972)},
+    0
+  },
+  {
+    {W(0x80e3d814855d1066), W(0x581247a626a70eec), W(0x9b14052baeba5336),
+     W(0x680a260c9a47894b)},
+    {W(0x51a6afd750e24f62), W(0xdf867634994da52b), W(0xd38af69814aab079),
+     W(0x639970aa162b964e)},
+    0
+  },
+  {
+    {W(0xe2106d7830287b30), W(0xc05c74dda8e2d155), W(0xcb847b34bbd4438e),
+     W(0xa83cc4ea92c147a6)},
+    {W(0xb04585cbdfd1a19d), W(0xfed7895798bc9de3), W(0x3ca2ef99ca9a1ae0),
+     W(0x34e70cd79f973f93)},
+    0
+  },
+  {
+    {W(0x6e758ac98b7ccb42), W(0x137e7a0c3142dba3), W(0x459ae68d2cdaba54),
+     W(0x341241f2d1d8821b)},
+    {W(0x4ee9ad673d7e5dbf), W(0x84397bffb167ef70), W(0x36ba6661b20d4d18),
+     W(0x4760c8b2c95e1a2f)},
+    0
+  },
+  {
+    {W(0xc4b74f38af63af7e), W(0x91df542924d17e09), W(0xde5ee8b7bf070218),
+     W(0x491488e7c60d4b2e)},
+    {W(0xd8ff807cbdb79040), W(0xe117fb4554e9b191), W(0x19e0497096a5383d),
+     W(0xb366056dce8f6247)},
+    0
+  },
+  {
+    {W(0xa240bab0f71975b4), W(0x9661ac703499cc07), W(0xd0b69abc5b05dfeb),
+     W(0xbd334f89d8c8b3ba)},
+    {W(0xe560f0d7eae01238), W(0xc61c75abac8aaaa7), W(0xf3f1fbc3ecbc6c9b),
+     W(0x0b9beff77234c967)},
+    0
+  },
+  {
+    {W(0x396b6e817602521c), W(0xf3649f048cabe617), W(0xdbc143bf9802659f),
+     W(0xef89942aeadfd5bd)},
+    {W(0x9cee3ef2a810b103), W(0xfa243393b4e007ff), W(0x6ad213a6e9f01a7e),
+     W(0x99ae81545157c8e9)},
+    0
+  },
+  {
+    {W(0x853a43bffe6345a6), W(0xa27c6f12d0f9c23d), W(0x60a0e76b8ef3c320),
+     W(0x0750e2c7859a68be)},
+    {W(0x9b83a6c971956d91), W(0x1a95e455ca840e15), W(0x175c5430fce1e05e),
+     W(0x4c9dfcedd2840448)},
+    0
+  },
+  {
+    {W(0x52b6b6c454516757), W(0x4af7e71131d2bb9d), W(0x0d04ac0e841c1b7a),
+     W(0xca165e80fa9105ce)},
+    {W(0x2dcd29f0246a015f), W(0x0ae7ffa6b1a8755c), W(0x447a4f010bd4adf4),
+     W(0xdf478b27148144d4)},
+    0
+  },
+  {
+    {W(0x7bf11354d34c280d), W(0x0bec70d14164ada4), W(0x26482e5bc6e03393),
+     W(0xd87419aa097b4655)},
+    {W(0x98bcd4482984c794), W(0xbd16460b33843053), W(0x2bea650c1288e163),
+     W(0x45bd269a6db487c1)},
+    0
+  },
+  {
+    {W(0x25a5d3852a824704), W(0x9bf2c4973eaae85f), W(0x5a170775e9482c5b),
+     W(0x03503eca313ec08d)},
+    {W(0x99c3637faf8403e3), W(0x8452747ec07cd398), W(0x038dd1e3ed749d87),
+     W(0x8cd7a921bf142893)},
+    0
+  },
+  {
+    {W(0xea83a10bb968838f), W(0xb6a34b3d59ee2028), W(0x0b4153d14ad4af1d),
+     W(0x23a54c205e05e09d)},
+    {W(0x99b898d7f4cb8548), W(0xae6b72f2cbd2339b), W(0xa2494f41f794f8e7),
+     W(0xdb02234ee0e3f1bc)},
+    0
+  },
+  {
+    {W(0xfa90b586c38d4ff7), W(0xeab0f0bd8e693c99), W(0x349527c347aa4801),
+     W(0xbd8f6721c8eea0b1)},
+    {W(0x99dd3dd45515e064), W(0x7be51b47de4a0a5c), W(0xe466e7bcdad04a48),
+     W(0xdeb94e9653c65952)},
+    0
+  },
+  {
+    {W(0x09bed7767880e898), W(0x96f18504cabb0463), W(0xb82ddd06d32a7199),
+     W(0xa09eb6c4d65e1809)},
+    {W(0x5f6de71cf337b0c6), W(0x6bc071ba1adbfbe4), W(0xcb2d074d46f07328),
+     W(0x509347e6ce9be949)},
+    0
+  },
+  {
+    {W(0xfd5f48cacd6026f7), W(0x4d8fb52902b80820), W(0x98f82743d00f51eb),
+     W(0x14fc6c27845f63fa)},
+    {W(0x744ca5cdc2e8f2fa), W(0xbaeb6c219ab75a6b), W(0x1aa47c1d27f37daf),
+     W(0x47093c671a341028)},
+    0
+  },
+  {
+    {W(0x4f68c553b9711175), W(0x86882ab62e5eb598), W(0xe93931cf40b6c206),
+     W(0x4b5a8e21a5e4632e)},
+    {W(0xa98a6bef32ea24b1), W(0x5658692db9a7a05f), W(0x6da7a4157d70a080),
+     W(0x2d573c7d7470113f)},
+    0
+  },
+  {
+    {W(0xce54d527327a4ec5), W(0x4660d90e7857f648), W(0x9dfc6f96de8ce3c8),
+     W(0x6a5724c30220c35c)},
+    {W(0xb60715e4f26db958), W(0xddc47d010b2bb40a), W(0x96972392ef79f54c),
+     W(0x5702bcb10c56de9e)},
+    0
+  },
+  {
+    {W(0xda6068dac0be4964), W(0x58279c7dd498aa16), W(0x0fe1889fe9785c2a),
+     W(0x5878e7a027e7ea54)},
+    {W(0x2cd6765d3d330ed6), W(0xb0eeaeacd4cde983), W(0x1927869e25a27c41),
+     W(0xde44d3555acd0ede)},
+    0
+  },
+  {
+    {W(0x52a24826a0aaafad), W(0x64c136f8ee1668ed), W(0x19ad05ecafb7f3f5),
+     W(0x44545ee13332c6b6)},
+    {W(0x69e47466e6e7bfeb), W(0x378fc827418a2c53), W(0xfac7c8d4077b9f80),
+     W(0x210d788d4e2db54d)},
+    0
+  },
+  {
+    {W(0xac92c292ea9c6545), W(0xb864ce980fcce253), W(0xb7eea329e8f9af34),
+     W(0x9faa2d1491b5b816)},
+    {W(0x76e2e548026bbda9), W(0x01fc3e1c6ef9a36f), W(0x5b42d24b3285eb7b),
+     W(0xad26f3393c224bb9)},
+    0
+  },
+  {
+    {W(0xf15d7e113665561f), W(0x973135c5738a819c), W(0x7dd9b6f6be490ae7),
+     W(0x5ecea6cbe5a21a26)},
+    {W(0x1645f31a81f4da5f), W(0xe37803d7f9f5764a), W(0xfb116d7d24543932),
+     W(0x95891a88825aaae2)},
+    0
+  },
+  {
+    {W(0xe2e7104fbee0571a), W(0x71da86b5e0615eb2), W(0xd43ba5deb19e5fd8),
+     W(0xf5f8f8c458913854)},
+    {W(0x44f9f8f77930c336), W(0x188c38f09d2a5677), W(0x5d9b5053a37118e8),
+     W(0x093e316a2e37788a)},
+    0
+  },
+  {
+    {W(0x081455a67eb72480), W(0x7ac47de880f3b35f), W(0xb6bed101e6cfbb9c),
+     W(0x1002d147ff22a736)},
+    {W(0x57c041b42f685410), W(0xba6d09fa09b2e7b5), W(0x77348bef6e739120),
+     W(0xaf11f0e1c01f7066)},
+    0
+  },
+  {
+    {W(0xf6ee019acda48731), W(0xd918101b079d0dd7), W(0x77d0c0515062e6d6),
+     W(0xcdce979a5b7504c4)},
+    {W(0x21d29322bf6ce22b), W(0x050585a36386648c), W(0xc6337e433bb0e856),
+     W(0xf4e82f14de1e6f57)},
+    0
+  },
+  {
+    {W(0x7092276df5c898dc), W(0xc1cc4b258ea81157), W(0x357c8efd5892b729),
+     W(0xb90dbc1c8c5d1e43)},
+    {W(0x7483a805bc754a40), W(0x347f51343277caf5), W(0xc48dba25dd399ec8),
+     W(0x21808a83f745b61a)},
+    0
+  },
+  {
+    {W(0x41035333a2457cbc), W(0x7e881db438144eaf), W(0x8c6dfce13bd21dde),
+     W(0xb6e041d68ca50127)},
+    {W(0x5549c2a207e94581), W(0xd8f7a491cb3f61b1), W(0xb87f39c034a7b7d8),
+     W(0x2b333ff9a4a1bdfc)},
+    0
+  },
+  {
+    {W(0x3816a9e3f322205f), W(0x5e9206312cd794e9), W(0x246f0e69273d6be1),
+     W(0x23ff7da6bddcff55)},
+    {W(0x2a3446587cb7073f), W(0xdbf02172133baec7), W(0xf5d470976d462a47),
+     W(0x07ca2c79feae5a28)},
+    0
+  },
+  {
+    {W(0x9d24fbdebeb3eda0), W(0xc95257318204b7c5), W(0x1e011f960d4cd481),
+     W(0x6ea0295857573e0e)},
+    {W(0x9cac75dda4d99cf9), W(0xcb5ba1cef173a243), W(0x6e5e57f7efce8ee3),
+     W(0xabed41ece903aec8)},
+    0
+  },
+  {
+    {W(0xe7894875fbef2db8), W(0x899f9939654ad899), W(0x81fbf2a2fc13a831),
+     W(0x3c80f4a2fb6dc884)},
+    {W(0x83731fb18e485894), W(0xbb3ba3da8a0c8d9a), W(0xe282f2a753feeab5),
+     W(0xe660b4ce92695d5c)},
+    0
+  },
+  {
+    {W(0x1950882cbae2cc7b), W(0x94d9e08cf81ec788), W(0x3aa128c15b7c12e3),
+     W(0x94496529ce4fb6d2)},
+    {W(0xe52736958f693c7b), W(0x7ce316741c102c5a), W(0xcb73291da640a8b2),
+     W(0xfa4f11b3130ebef1)},
+    0
+  },
+  {
+    {W(0xe2e1616e877105dd), W(0xe9f1e3c2c174438f), W(0x74816b21fd0a7337),
+     W(0x73171d1471af655d)},
+    {W(0x603a0995fdc7e5df), W(0xd68119bd8918e963), W(0x40c9a2fc6ac54a10),
+     W(0x7e6f2f825578fe13)},
+    0
+  },
+  {
+    {W(0x260ec6f147322d0e), W(0x283a9b41cba80500), W(0xfd7df843b85ef134),
+     W(0xfc1d66d581be3be6)},
+    {W(0x09f12eb38d84e6ae), W(0x433fb2acededd829), W(0xddd276a73cc6930b),
+     W(0x444d4c524dda3d78)},
+    0
+  },
+  {
+    {W(0x87dedaa60e1841ae), W(0xf0cb6fee0c89c825), W(0xf586292b546485c4),
+     W(0x6df364a363372f5d)},
+    {W(0x3953024cb8dedc57), W(0xe74c6a12ff9975d2), W(0x16c0c081504a576a),
+     W(0xfc43aa49a77557fb)},
+    0
+  },
+  {
+    {W(0x62ef9bf0e63ffbe9), W(0x07a4ae5d9542427f), W(0xd28bf21d24d657a6),
+     W(0xa4ea033dd2f4afdb)},
+    {W(0x009acffe3bce8f48), W(0xb97dbdabf0311afd), W(0x5318d1c04f375085),
+     W(0xadadb7c5a492829d)},
+    0
+  },
+  {
+    {W(0x80deceab3290608b), W(0x3367dbeed8b9ef73), W(0xb1379920aa4b3d24),
+     W(0x96ea1fcdc14c4fb1)},
+    {W(0x142ab847924ade8b), W(0xc7fbb28f8e9c6340), W(0x24e491e45a0481ec),
+     W(0xca8168d64eebb4e7)},
+    0
+  },
+  {
+    {W(0x6fc9556d38eef468), W(0x6e2ff6f2cdfdcd7e), W(0xe9c1670b33a0f756),
+     W(0x6cea07a1acfbce79)},
+    {W(0x561d79f31f785a3f), W(0x6a8dee621a7ca0fa), W(0x90524357eada9f69),
+     W(0x26e7d8b0fee8929b)},
+    0
+  },
+  {
+    {W(0x74cd0efde3962598), W(0x305d4ee84b354e55), W(0x96e9c98e1e73eee1),
+     W(0x7e962bd0584a3c67)},
+    {W(0x467b7a802f9752cc), W(0xd7d94236f9a7e26c), W(0x6180120785a2f725),
+     W(0x21dd69473085cdc6)},
+    0
+  },
+  {
+    {W(0xa972567743b3d2cc), W(0xc7385748e3700db0), W(0xab95fe1e95a43be8),
+     W(0x4ddf62c095c67b14)},
+    {W(0x531e0ace183ef78a), W(0x7ac6da33661c2c23), W(0xe7a0b7f5547fc60f),
+     W(0x588f404e3a574094)},
+    0
+  },
+  {
+    {W(0x5387af77338a1951), W(0x8cf5bf4a9b73610d), W(0x4744053a73ab772d),
+     W(0xe354f77ef105a77a)},
+    {W(0x8cc5ad56bf9531af), W(0xf5f7af375dfb04ec), W(0xa7ab03a16683b331),
+     W(0xd4de4fbe4464acbe)},
+    0
+  },
+  {
+    {W(0xcdb2e580f68ba765), W(0xef967eae179c44d9), W(0x22cbe2b1208781d3),
+     W(0x04331ef20fc06d17)},
+    {W(0x029d37810de76621), W(0xf422d40e1eff7c68), W(0xd6574154792e0c7e),
+     W(0x2d2af9562af4d500)},
+    0
+  },
+  {
+    {W(0xfda2ec6be83d6b2b), W(0xac00924b975c1268), W(0xccd8c46f6256b83d),
+     W(0x392cc18425b55b70)},
+    {W(0xd5c0c030de27d88d), W(0x893f8419e4bae97a), W(0xdaf5ea2d29d4313e),
+     W(0x79613f89b399969d)},
+    0
+  },
+  {
+    {W(0x877f0bb608ca9714), W(0xd777c2fe2092f04c), W(0xbc9a65cfc2adf8b8),
+     W(0xd40b27d3673c9b02)},
+    {W(0xd7c87970371d9009), W(0x535504f25275d516), W(0xdf9ae796e320a0a5),
+     W(0x69f1f3e595d538df)},
+    0
+  },
+  {
+    {W(0x5e7e2f1b4b5af3cb), W(0x4169ad54d24aa694), W(0xd098bf2df581d444),
+     W(0x5f16defe6e3ea7df)},
+    {W(0x786b897351464f70), W(0x537471162959a414), W(0x7501c61f0bc67137),
+     W(0xdd0bf2dabe426f31)},
+    0
+  },
+  {
+    {W(0xc31ea69c430efef1), W(0xac3db20894cbb197), W(0xb3b76048d44c6cda),
+     W(0x6a4b65b2c95a6f6c)},
+    {W(0xcc335265a45e6c59), W(0x12fead23bcbff8ba), W(0xe4d5805c974e1e2b),
+     W(0x038b2af61b37ebaa)},
+    0
+  },
+  {
+    {W(0xffecca74d7a2c92f), W(0x16378731ab9a1f2a), W(0xf382e93043a6a6e3),
+     W(0x42a50b8c4476430b)},
+    {W(0xa7406a12ad27733f), W(0xe7b891417dc996a5), W(0x581839aa7a78b8ee),
+     W(0x380a0a44e119bf71)},
+    0
+  },
+  {
+    {W(0x3229e3ab184b0e81), W(0x0f202e2497780b46), W(0x52522d6d7784e1ff),
+     W(0xc45b82d6648d465b)},
+    {W(0x2072700098c6ff44), W(0xb6affd4423607f96), W(0xfa1c686c5866e7bc),
+     W(0x9151a9c9d3ce04dd)},
+    0
+  },
+  {
+    {W(0xcea399035dfe0112), W(0xca31ad29c9ba9198), W(0xab69b7fdfa2ca5e4),
+     W(0xd6941cda285e61e9)},
+    {W(0x1da2b6e2e52cde66), W(0x8c6663808d78b8f1), W(0xc82e6a638e1650ff),
+     W(0x531b5cd7ea2bda97)},
+    0
+  },
+  {
+    {W(0x073249c3140b4d8d), W(0x55c415db9bfe2eea), W(0x6e78a1a59832e9b9),
+     W(0x967d07047c643373)},
+    {W(0x1777345408f64b04), W(0xf8d36b9b4ce2b4a9), W(0x092f453dea2214af),
+     W(0x084b459b774cdc65)},
+    0
+  },
+  {
+    {W(0xd6077c9e504b3edc), W(0x47221f9eed241580), W(0x63d08e321a87cb1a),
+     W(0x1186fd3860988208)},
+    {W(0x38d254330bded4d9), W(0xf4af7eb2191dc7ae), W(0xa09f50b4991a0ddd),
+     W(0x8f2891fe93e4ae08)},
+    0
+  },
+  {
+    {W(0x6a003e724ff62fe0), W(0x564e44e52a777913), W(0xf056b12203fe4cac),
+     W(0xfda97e7a1e1f7747)},
+    {W(0x76afbc15e34e3515), W(0x59eb1f6431d94b49), W(0x45a65d69797a66e9),
+     W(0x6452a414dbcfc8c7)},
+    0
+  },
+  {
+    {W(0x054e3d589f71163e), W(0x4e109c0cca3fcda2), W(0x2e4c0aa90e915cf7),
+     W(0x2e3a1af5249cbbf2)},
+    {W(0x64051b2e588eef7c), W(0x1999960cdeeb5eb3), W(0x28b3be870763a67e),
+     W(0x532c0e14e03eb778)},
+    0
+  },
+  {
+    {W(0x41bd71c69b6de228), W(0xe5ec8c03c5048185), W(0xace5acc50b2d123d),
+     W(0x9a60eae3627b7715)},
+    {W(0xdc54aad239e4ec91), W(0xcc82dbef6c78da98), W(0x30d9d2ce092d1f9b),
+     W(0xfad58933da2b788a)},
+    0
+  },
+  {
+    {W(0x35136d6afd49ed26), W(0x0f17da48e076cf5c), W(0xd46bd438c5a4f61b),
+     W(0x0b71b8207fa6180f)},
+    {W(0x7cd40e1bcbfb0232), W(0x86f3ea3faf10f82d), W(0xcd83abde18962f78),
+     W(0x6eb62294aea25857)},
+    0
+  },
+  {
+    {W(0x28f21549e7484b8a), W(0x35d8c58aa90ae4f8), W(0xca759dc4f49d4a95),
+     W(0x2cdcdc44f0455e53)},
+    {W(0x0bab9d9b8ffabf20), W(0x594b029ce428bffa), W(0x1d0a2e038b4eeb79),
+     W(0x5b3625f403458781)},
+    0
+  },
+  {
+    {W(0xe7eb0741621eacc6), W(0xdd58f91560c6aa42), W(0xffdbdca1a02e7242),
+     W(0xac5aea9b0492c548)},
+    {W(0x88697f69bfecfbc0), W(0xa820cf00d62635c4), W(0x32b368962bf3a920),
+     W(0x1869b7965aa31b51)},
+    0
+  },
+  {
+    {W(0x50cfb1a303719c68), W(0x7fae9e065c7f9f7b), W(0x20fea9103da00021),
+     W(0x5325604208acd99e)},
+    {W(0x80925b7d5192ea9c), W(0x5c642513dbda4331), W(0x858e1dfabf4acbd4),
+     W(0x35de10aede734df0)},
+    0
+  },
+  {
+    {W(0x249f8e885f36cb0d), W(0x25f139d11efb1951), W(0xb6501ed7f9d43705),
+     W(0x9f9fc240b6afe536)},
+    {W(0x8a6f718922b433f8), W(0xa355938cab0405fc), W(0xe8d02790e32bedf3),
+     W(0x90a8936e610abf4a)},
+    0
+  },
+  {
+    {W(0x30c4b35d6a2862e7), W(0x01d888bb4b58854d), W(0x7efe4fb351d0211b),
+     W(0x274338ecb4ac32c5)},
+    {W(0x1c6e8743f3a2d400), W(0x926994e708faa0e2), W(0x8ee46a60907b6565),
+     W(0x2a662620d2c3b466)},
+    0
+  },
+  {
+    {W(0x0fd174c6c1e06e22), W(0x1aded4fcd8fce4f0), W(0xf1dfd227ae58fb60),
+     W(0xe0ceaa30c83374ab)},
+    {W(0x7459037cfa2fead9), W(0x2a2d04f1f93a94ce), W(0x77219e280a8e6d55),
+     W(0x0057a7a9e2809dda)},
+    0
+  },
+  {
+    {W(0x5026fe2ac358a770), W(0xd0b11b46fd07f54d), W(0xa7a34e6ae250629e),
+     W(0x0a094719a8c07815)},
+    {W(0x6567e87a5d597497), W(0x274f7ca17e6c6075), W(0x58cf0b9af1b87ff1),
+     W(0x48a3659ba4e1071c)},
+    0
+  },
+  {
+    {W(0xee7b9d8df304e016), W(0x0421f8f576de6dd0), W(0x181e0bc25e06e523),
+     W(0x0e401a3b6af5139a)},
+    {W(0x3d12fcbfe2e8c94b), W(0x091cfb78209af61d), W(0x3d9cde1849e74eb7),
+     W(0x58cbc3eb80adecf7)},
+    0
+  },
+  {
+    {W(0xce2753ecb1db449a), W(0xaf6fcdeebbdde5ae), W(0x3074c8e30fa79afb),
+     W(0x9f84cf058388dfe7)},
+    {W(0xc3bac2f2491c7c61), W(0xf08f764601373c28), W(0x17637adb1594f285),
+     W(0xf1fe51740c59b6ec)},
+    0
+  },
+  {
+    {W(0xd781b8eb05df532c), W(0x01932e8cffc8b682), W(0xd121a87e29f07c7e),
+     W(0x2ae74cf5ad28232a)},
+    {W(0x87a687b638bb611b), W(0xa6fdf4bc42442ad0), W(0x5566fc674c9845a3),
+     W(0x0aa05b31996f2e13)},
+    0
+  },
+  {
+    {W(0xdcb15abb97391953), W(0xe342f75f0fe70ac1), W(0x2a3c903f865773fc),
+     W(0x8a1571d1cb4d8f27)},
+    {W(0x67bd15b3d6f7f175), W(0xe01fd11d039da758), W(0x9971fef0aba5304d),
+     W(0x0c1d95ef58d9f2f8)},
+    0
+  },
+  {
+    {W(0xd8e27e24de0c721c), W(0xb223a3478e5d0575), W(0x5e266e06a59f77c2),
+     W(0x66e2298252b7c765)},
+    {W(0x1f3a3c309be233f6), W(0x53eeb30eff143f28), W(0x7a90f975c06d8bad),
+     W(0xedab3a96ce8709f5)},
+    0
+  },
+  {
+    {W(0xab207128aedc8342), W(0xb02070cf96a2cfb6), W(0x134468020b9e765e),
+     W(0xc764237019efcdbb)},
+    {W(0xa71fac631a52740c), W(0x753bd8d0b51a477c), W(0xca0b682a8d7ec363),
+     W(0x16fca8690372ab76)},
+    0
+  },
+  {
+    {W(0xacad02225561eba7), W(0x67289cd1fe8d0963), W(0x62bf6473ff100cdc),
+     W(0xc63fef15a93d4fc0)},
+    {W(0xab68b595cdc2a9bd), W(0xa9e0b3e020a5ed51), W(0xc4ce0c4b51cdfde1),
+     W(0xe751e840892a56ed)},
+    0
+  },
+  {
+    {W(0xa7c8ff57d8f2afde), W(0xc574ff3ded5bf6f7), W(0x3153980e77a38d3d),
+     W(0x463d60ca5eae662a)},
+    {W(0x3905a33698267c6b), W(0x4c4aec1628bf1209), W(0xb09bc4ca3b28785c),
+     W(0xbc93803b89d34bcf)},
+    0
+  },
+  {
+    {W(0x1bd1dc1329a36014), W(0x6e7cb34fde09ee91), W(0x89e37ea7c0203eb6),
+     W(0xc808a64132b29b79)},
+    {W(0x5069dc06e1ab87ab), W(0x1957e96296e6a8e0), W(0x32749ddfdbdb5ab3),
+     W(0x8c7f00092776885e)},
+    0
+  },
+  {
+    {W(0x1b88e984bacfb8d2), W(0x69d6616df77bd282), W(0x1a66ebb641a720a3),
+     W(0x9a6a134dcb4c8de9)},
+    {W(0xc66215a5a3862878), W(0xba3247cea1d04f33), W(0xfd08da75adca1786),
+     W(0x06f658cf75836cf4)},
+    0
+  },
+  {
+    {W(0x478a2ef80ef5c6f9), W(0xae6d0cdfba8cb3a1), W(0xb4dfa374ccae36be),
+     W(0x776e136ccc02c6f5)},
+    {W(0x4911ed3cd07fd39d), W(0x346f65f4958e7ec8), W(0xb78da2c140bb5cc1),
+     W(0xb6226fc00871ffed)},
+    0
+  },
+  {
+    {W(0xdb7fce9c697b5408), W(0x5fd946898cc81caf), W(0x26ae604eb054c641),
+     W(0x23d584ecd7924865)},
+    {W(0x38f3e09cd08d78fb), W(0x295a2298bc6e2902), W(0x1463de5698e76416),
+     W(0xa5255a33c1a16c55)},
+    0
+  },
+  {
+    {W(0x2c41a9ba0acf210c), W(0xc967c669cd379aa1), W(0xe1c315723fb57d99),
+     W(0x4019bc2875655ae2)},
+    {W(0x0ce473cca487d786), W(0x2eb793fb920a5181), W(0x864e88f9587110d0),
+     W(0xf744dafebe630831)},
+    0
+  },
+  {
+    {W(0x44aac03f4f08c723), W(0xdb8325a14c9ce58a), W(0x4904ed43f1b47221),
+     W(0x40b7b51f854efe51)},
+    {W(0x60d09769abaeacb2), W(0xecd2003b2de8ffbf), W(0xe4a0a60288185556),
+     W(0x796f64e7eacfaaf0)},
+    0
+  },
+  {
+    {W(0x4d028438894d3d43), W(0xaa0f8eb7e9aa939d), W(0xe3f2e88445f7c1b4),
+     W(0xbbbb87b505d54620)},
+    {W(0xcfd331d34c3a7470), W(0x4fb3218a473241c9), W(0x8a0ef43031f88662),
+     W(0x3d98459ca4cfb743)},
+    0
+  },
+  {
+    {W(0xf6edd0f107e72e01), W(0x77f965801f8bcbb3), W(0xdbccc5863d34965b),
+     W(0xe880be4b8cc1480c)},
+    {W(0xdc98836e58dadc5f), W(0xdb823d3793e7ec25), W(0x9a834f070d8cc3a9),
+     W(0xfdbebc7974519301)},
+    0
+  },
+  {
+    {W(0x05f89150feb63de1), W(0x8134460e3e60e232), W(0x99c27cacf5f866b3),
+     W(0xf16c795888d84813)},
+    {W(0x72ba9b2b53480b3a), W(0x861341ced519aebb), W(0xcb09419644c109b6),
+     W(0x82e76b397913c3ef)},
+    0
+  },
+  {
+    {W(0xc3fb4d2b5ff5369c), W(0x9ffd159490492af7), W(0xd052be61b249ba63),
+     W(0xdf40fc16ee5534a3)},
+    {W(0x22a84e32a6da71dc), W(0x94a66871db7b38d3), W(0x967034f9ab0d72a1),
+     W(0x04426d81651eb70f)},
+    0
+  },
+  {
+    {W(0x908b4dc2a56c5626), W(0xa23dc2f0941e6f96), W(0x1adb071d6df69e32),
+     W(0xd4d0b73ced466312)},
+    {W(0x11f68930b889d1a8), W(0x52a3fb4ad0d5ba2d), W(0x5db5b5f00304cc54),
+     W(0xd5892e25a8afc0bd)},
+    0
+  },
+  {
+    {W(0x553485ebe2ea5e16), W(0x23510823419fc2c0), W(0x01e0345af800751d),
+     W(0x6a17ac84ded095ee)},
+    {W(0x28be9de606de9f6e), W(0xa088ffa73d69c01d), W(0x2c03b245327c95bd),
+     W(0xe15d84ffdbc492c3)},
+    0
+  },
+  {
+    {W(0xee1f402d4c8a9a40), W(0x31be731903fc4b2c), W(0xa2505a9ca55bb21d),
+     W(0x6a167116cbdd0437)},
+    {W(0x65d450283057fe8c), W(0x7d2759c8595947b6), W(0x2a4ab1396c6831bb),
+     W(0xd3789591f1f0885a)},
+    0
+  },
+  {
+    {W(0xf5ee3b1afed50f52), W(0x422435105a564e84), W(0x56c9daadecf7572c),
+     W(0x1bf381283148813c)},
+    {W(0x314f9014ec58e0ff), W(0x4d6ce750d979ada3), W(0x1e6d3b54d1086088),
+     W(0xd4e686b89d52f655)},
+    0
+  },
+  {
+    {W(0x3a0bedfd45eec9ef), W(0x67504a59f01f4096), W(0x53e57228218d773e),
+     W(0xafe7c8afbeea2529)},
+    {W(0xf177c0095ff9d38d), W(0x567612ce2482d581), W(0x2a29775528255689),
+     W(0x07048277c77488cd)},
+    0
+  },
+  {
+    {W(0xf7d4000cd57268d6), W(0x716266fb0a342803), W(0xc1c8fe205cba3214),
+     W(0x399de5c5b5913d8f)},
+    {W(0x1dcf8428d6a1596f), W(0xd7ade87735369fda), W(0x95256d4b425dcafd),
+     W(0xc6ac34ca424fa1b9)},
+    0
+  },
+  {
+    {W(0x1e37dba8f52dc846), W(0xfd16250f06938a09), W(0xcd14e66d2edd5320),
+     W(0xd3208410a2507bba)},
+    {W(0xf4f672b430f08b22), W(0x10ed24e796949b5c), W(0xb44395e5bf98f258),
+     W(0x4782bad17837c25d)},
+    0
+  },
+  {
+    {W(0xa0ced3c7667d6ecc), W(0xa67c52f87f3e6e26), W(0x53530eea2a38099b),
+     W(0x0a282cab2cbfeb72)},
+    {W(0x605f48fbe6adac2f), W(0x8460704e40f74444), W(0x45cef5608b4a7192),
+     W(0x7278ad0e10b9a139)},
+    0
+  },
+  {
+    {W(0xfc78d0120a0b7936), W(0x09212de36cbf2e60), W(0x7420e3098914d929),
+     W(0x360f0cebc07994f8)},
+    {W(0x49732616a503e3f7), W(0x5c67c979fdfdb0bd), W(0x83481df395e36572),
+     W(0x2061906a4eda6984)},
+    0
+  },
+  {
+    {W(0xade802239e1a48b0), W(0x54101f4b82432b66), W(0xb1a4a5406954ff9e),
+     W(0x7a0b807f33842d44)},
+    {W(0xba3423ada76b0435), W(0xba475ef30eeb71a4), W(0xe7611d349293d997),
+     W(0xb7211fb8c8fee0de)},
+    0
+  },
+  {
+    {W(0x20547e6cc996ff1d), W(0x99728d9bc6c9074c), W(0x808fc9048215bc68),
+     W(0x1cf4d9abd6b3d345)},
+    {W(0xec0a66653ca682e6), W(0xf0ad98a8a5bd6e9e), W(0x3cbf80f6558d72bc),
+     W(0x103ea3345436f53c)},
+    0
+  },
+  {
+    {W(0xb461fc4a854e00e4), W(0x8277def88cfd6bb1), W(0x2a3ab8ccac42cd17),
+     W(0xc8a04bb880e197d5)},
+    {W(0xd7d26f2bc3fca056), W(0xf846343844a575df), W(0x047577d2135c3934),
+     W(0xfa2e39019f1fa180)},
+    0
+  },
+  {
+    {W(0x64424fb4c870a888), W(0x0a26e10e9a24e580), W(0xc9ecb429f8e2f63c),
+     W(0xa69d4510d5e8583b)},
+    {W(0xe684f3871b699849), W(0x7fc71d9a6b8121ad), W(0x50ce6880b3afe6bf),
+     W(0x9b2b29dfcb8452a0)},
+    0
+  },
+  {
+    {W(0x052712b06a1e1aa3), W(0xa2f1a8b743775b88), W(0x5bf36bb9014b460c),
+     W(0x5688ba1c2aa375b0)},
+    {W(0x6ed36ee944c15f5f), W(0x55918b735986ab2a), W(0x8573bf8ba6a73ec6),
+     W(0x7590a5a5b92b3477)},
+    0
+  },
+  {
+    {W(0x93622144a145265c), W(0x88365d5f30eefa03), W(0x5ae41070949cccbd),
+     W(0x50db7a76133a0916)},
+    {W(0x4ba1cf0c6d94f61e), W(0x28bb24809c297411), W(0x29fa592936726381),
+     W(0x0b2eb63e9544ca61)},
+    0
+  },
+  {
+    {W(0x3ad54087daa87f89), W(0xb6587ce45024583c), W(0xc745c165994d4f4e),
+     W(0x023849a49c0b0112)},
+    {W(0x2f966e94899041fe), W(0xc08c28550a8e016f), W(0xe09ecf2473e5a437),
+     W(0xe170475c9d877ad1)},
+    0
+  },
+  {
+    {W(0x84ef870a91d6b8ce), W(0xea2e7e6c5e0cf7c9), W(0x99f72fffb89a08eb),
+     W(0x631297c75358f3c9)},
+    {W(0x3542b0facbc0270c), W(0xf206ded4386a0d45), W(0x49c629067ca9ccf4),
+     W(0xa69d1910713c92fd)},
+    0
+  },
+  {
+    {W(0x5a41deafb96b5e6a), W(0x81edbec8779375f3), W(0xbce9eb1dc4711925),
+     W(0x85454f8c99807f09)},
+    {W(0x1ef99489b83801a4), W(0x0e23feffbafaede5), W(0x650e69cec5b08bd5),
+     W(0xfd947624cdf1853c)},
+    0
+  },
+  {
+    {W(0x6ebf2a909251082c), W(0xd1fdc011a5b69266), W(0x608060f62ed02058),
+     W(0xddb05d7b0dce8593)},
+    {W(0x9a4a94c5a3131aea), W(0xdeb3dcadbced1664), W(0xd72d2e7f99f5a735),
+     W(0x610ccfe86831c614)},
+    0
+  },
+  {
+    {W(0x6c00370e72ba2b32), W(0xc91ac43fa5b6c458), W(0xfe7e7b61252b88ef),
+     W(0xda8d6b3c55adb584)},
+    {W(0x64274c44bef2fa8a), W(0x43800c5edb165a57), W(0xa8a813ebefc74f2e),
+     W(0x213570bb1f2fb595)},
+    0
+  },
+  {
+    {W(0xef71d0670ef744d5), W(0xefe55366febd63c9), W(0xc7c0ca9fc082386f),
+     W(0x4d8cdbd53f06f4b6)},
+    {W(0x6dc7e646643df50f), W(0xd5f5a80603a5c627), W(0x0d5d202253acc9dc),
+     W(0x69af3d5da5ec56da)},
+    0
+  },
+  {
+    {W(0xed799d5fc204bc2c), W(0xbc9fec39ffc58b00), W(0xeca387c242e60a65),
+     W(0xa33851799d44997a)},
+    {W(0x1293e01ef60f9029), W(0x0646f5d1e0f31783), W(0xc32464afedba8936),
+     W(0x6d2ca1e03c9aa17e)},
+    0
+  },
+  {
+    {W(0xc1407b82872c091a), W(0x2e0247987e2f3296), W(0x786ceb356c40d4eb),
+     W(0xd2165ae1f5b00333)},
+    {W(0xcce47fd4532f322b), W(0x23488020f5e8f430), W(0x97c33c0c721e7d64),
+     W(0x684f6b4ff18376cc)},
+    0
+  },
+  {
+    {W(0xaedc61740423f36d), W(0x4d5da2dcaf4fc49d), W(0x073d8205afbec507),
+     W(0x639f3ad7eb8fd94b)},
+    {W(0xe1fa652b7c40633c), W(0xa9a38d666849fe18), W(0x88d13d3d04899855),
+     W(0x31e1de10c97513eb)},
+    0
+  },
+  {
+    {W(0x633da21448b40982), W(0xdb14c97abcfedb65), W(0x36a4624cd25843d6),
+     W(0x751ded702d49ddae)},
+    {W(0x8cb80786b7b52067), W(0xad5611e7ef1bc3dc), W(0x113e6476bf08e648),
+     W(0x43f50c3acf69c964)},
+    0
+  },
+  {
+    {W(0xfbbb8c38b4c311f6), W(0xb24a93eac104416d), W(0xbe6e3aca21835f0c),
+     W(0x292ba1e932f30fb5)},
+    {W(0x28365a1c25bc44c3), W(0x758a5d2a34cbf943), W(0x1edbc5462efb22f7),
+     W(0x6aeee71e07d0bfca)},
+    0
+  },
+  {
+    {W(0x49c15ae925365391), W(0xd1defef1f2ef2bc2), W(0x0aed3d359950d73c),
+     W(0xea4bf2e862b0870d)},
+    {W(0x9840e41d5e2a7f21), W(0xd29a97b81167c3c3), W(0xe2427aa265419be3),
+     W(0x831db3fe03400f00)},
+    0
+  },
+  {
+    {W(0x8d421a7b22bdea5f), W(0xe486779f3057a839), W(0xa4f5beaf44b09083),
+     W(0x8e8d2940d79d9f73)},
+    {W(0xebb26bad55c69f0f), W(0x8ce8811c2bb08fc9), W(0xf7e82b800d20a40e),
+     W(0x160dec3c1bc7598c)},
+    0
+  },
+  {
+    {W(0xb9ddd107c34c976f), W(0x9d88dd3ffafe83e3), W(0x3f3f13077c4d1541),
+     W(0xe687b97905f1dfca)},
+    {W(0xda6386e2a9980086), W(0xf9ed38971dad52ec), W(0x0d6a6784144991b8),
+     W(0xfc1b31fb0e2634d9)},
+    0
+  },
+  {
+    {W(0xecdb99112826e555), W(0x922f5dde164888fe), W(0x9afe6a574eabc89b),
+     W(0xfd0266d2040d13af)},
+    {W(0x98fdf63208bda3bf), W(0x47c4bf98dbd4caa4), W(0xf1c5bc8dff67edf1),
+     W(0x1c20f26f0023bc93)},
+    0
+  },
+  {
+    {W(0x4e8febe88a8b55a5), W(0xf73215bc31a67d2f), W(0xab2c8adda06c64c3),
+     W(0x2bd8fcefa30b9f21)},
+    {W(0x72207d4825a25e9c), W(0xcb3c4af4d4584503), W(0xf393d5881eda1e04),
+     W(0xd08120b46f57f196)},
+    0
+  },
+  {
+    {W(0xdf6ddf0d27c76b72), W(0x52a2054f080b7975), W(0x7a116e1f9b1cf1d7),
+     W(0x9a614403a9be926e)},
+    {W(0x9cbf2ead0f45408a), W(0xf6bb3e8a032715a8), W(0x584fec33a2c50656),
+     W(0x244ac87531e5fdff)},
+    0
+  },
+  {
+    {W(0x4500678753dcb905), W(0xf1dafbba7b207bf7), W(0x366252382bc0bc64),
+     W(0x6c65e93c25e7a7ed)},
+    {W(0x19c66ecac2132298), W(0xdc0f2fbe9ba13472), W(0x0535b54cf39a1a19),
+     W(0x5cba22c6ff0cff19)},
+    0
+  },
+  {
+    {W(0x6b9944d62d7ef0e2), W(0x8da98702506fd3d2), W(0x72b0f6861641c8bf),
+     W(0xa9405233faca7200)},
+    {W(0x9b5ff6a8dad150f1), W(0x1893746fd87ac695), W(0x52f7fe0c10db5440),
+     W(0x12d724e69b69875a)},
+    0
+  },
+  {
+    {W(0x7426457a69e3d0cd), W(0xc29dacb79977bbea), W(0x13af5b58724150dc),
+     W(0xbd6dcd579c4300d7)},
+    {W(0x0908dfb51bb73ae7), W(0x39bd7f4100f41ad8), W(0x3a6cd7148184e74f),
+     W(0x0bcaf390aa47b224)},
+    0
+  },
+  {
+    {W(0xbe18165517eccd16), W(0xe47f215c05b2b3e2), W(0x571c50a85d580866),
+     W(0x3355eeeb89129d9c)},
+    {W(0x84eb46d88f6c031a), W(0x8a132e64bf83fa11), W(0x416f288ee9286fd9),
+     W(0x4c6c0ec4cbfaf53e)},
+    0
+  },
+  {
+    {W(0xcb24a87545b119f1), W(0x6a2999c3776f787a), W(0x5d8000c02e9e3f3f),
+     W(0x6ec4863c26d1618a)},
+    {W(0x43cee2c9b1368bec), W(0x7163a7d5be3bdbf5), W(0x8518996b6a9fdcdd),
+     W(0x8f10b6ba268ae7f8)},
+    0
+  },
+  {
+    {W(0x3e5531f56c4afaca), W(0x713acecc5749d3fc), W(0x5caedf03dba4f3b4),
+     W(0x3c2828a4c74b7aef)},
+    {W(0x5d878ff2b737add0), W(0xac33fbfa28e53d09), W(0x15536b21919964a2),
+     W(0x83391b957f3cc7a3)},
+    0
+  },
+  {
+    {W(0xded57f123bbffbe1), W(0x0140684d04874bca), W(0x38718e1c42c8449a),
+     W(0xe41612626ed1b808)},
+    {W(0xf4a81e778e203d65), W(0x9b41b2ac152165e8), W(0x7bff882acb571be7),
+     W(0xe4f26cbad7bb8212)},
+    0
+  },
+  {
+    {W(0x0e2c9049d08fd35c), W(0x12bfee2bffc50a0e), W(0x88496049f8a33a40),
+     W(0x65b5aa9013cf939f)},
+    {W(0xf1bc837c0d60965d), W(0xe4048795cae96c97), W(0xdfabc6ee231c5eaa),
+     W(0xdcbcd8dbf0200bd9)},
+    0
+  },
+  {
+    {W(0x04d410ea260530c6), W(0xcdf8023e404d334e), W(0x1952237b76442a87),
+     W(0x77b7fbd30f177142)},
+    {W(0x7bfcd7c090acb00a), W(0xe50f04363ad74bbd), W(0xbe951b89093ce419),
+     W(0x96d67063b2fcf816)},
+    0
+  },
+  {
+    {W(0xd7f2a004a639c4af), W(0x5e4f02228552d06a), W(0xc37328833761ee5c),
+     W(0x6a62e0e484d81e17)},
+    {W(0x6f936d714586d124), W(0x0113d01aafe3d24f), W(0xdc12a9037dc15700),
+     W(0x6b85472cb84338a2)},
+    0
+  },
+  {
+    {W(0xff7050ac4df3742e), W(0x47bf120b2c83c3ea), W(0x5f46a1bf443d34c7),
+     W(0x99af495713f42f25)},
+    {W(0xcad5fe1dcde29027), W(0xa92e49255a2e335a), W(0xf04b84c9848c4116),
+     W(0xbea03723602fc631)},
+    0
+  },
+  {
+    {W(0x7766c34451eb6cf3), W(0xda3b3eb4b890a715), W(0x82fb5924d6eb57cc),
+     W(0x7c9d8698837f1958)},
+    {W(0x76f0f983726ad5af), W(0x90b03ee2623846ee), W(0x18a46591433d397d),
+     W(0xef49a5720d6da99a)},
+    0
+  },
+  {
+    {W(0xc3a224720e067eab), W(0xbee24c85b3f091df), W(0x394bd55c35de6c4d),
+     W(0x4ab1a0e23c4b6f84)},
+    {W(0x014161548e9d290a), W(0xa2501ce1e5764a95), W(0x800bfa4414f0129c),
+     W(0xaa3bc4ec35e1da3a)},
+    0
+  },
+  {
+    {W(0xf5de5721ca088a5e), W(0xf82467d22bb8770a), W(0xa4e815ebb9f12186),
+     W(0xc4989b7b53502373)},
+    {W(0x1a8139cfccc1ce03), W(0x7a60fe0f858e37ec), W(0x82841b0785ed7709),
+     W(0xa3ee2fabc0020918)},
+    0
+  },
+  {
+    {W(0xe40a8f2b0da8dce4), W(0x2e28db167fca1060), W(0xebae655094e250f3),
+     W(0x054c52eb93ce1489)},
+    {W(0xf21a523a1b0e70dd), W(0xa50d1a23d1269139), W(0x252bfcfb042570cf),
+     W(0x234bedb7e2894417)},
+    0
+  },
+  {
+    {W(0x795f87e8bccdb972), W(0xdb368a993f0d3004), W(0xabfd59a525b4ba56),
+     W(0xf1dd2afbd70c9618)},
+    {W(0xfd68e2feb23c4f80), W(0x3479424f4f9b83e5), W(0x76f25cf14d6ac824),
+     W(0xcd586628b7524b8d)},
+    0
+  },
+  {
+    {W(0xfee91161947b81fb), W(0x08f54d8dacafa17f), W(0x525ee3fb65e49166),
+     W(0xaf89a5d7eed0831c)},
+    {W(0xae14dfd1c80ffbfd), W(0x3c8ebdae25f2ddd3), W(0xa94db66501ca601d),
+     W(0xe61c7a87f3ab60de)},
+    0
+  },
+  {
+    {W(0x81474bd0ae64ee27), W(0x70832997e28f88cc), W(0x18addd3312cc2359),
+     W(0x7a4be5e6b445abb6)},
+    {W(0xf2351390d8a453f1), W(0x7a739bb4152b1948), W(0x6783e76a332da6c8),
+     W(0x44eb14e0ebc27eee)},
+    0
+  },
+  {
+    {W(0xf3a8335629220e99), W(0x795c7a5cb5f3d756), W(0xcb07e628b2133739),
+     W(0xa6dd1d026704c658)},
+    {W(0x185fab2b37c4b585), W(0x18fde172eb852a0c), W(0xb585c23c6c36c771),
+     W(0x1f75bbb0b20a93b5)},
+    0
+  },
+  {
+    {W(0x6d49bd4e46fea67b), W(0x42689dcf17f06e5b), W(0x02e44d8233cd9292),
+     W(0x965bf5b47fc65d9d)},
+    {W(0x73e2a165e0827413), W(0xdaa2e5fe51023bb6), W(0x30aeb3160f5f8914),
+     W(0xb40257bc2ef01e8d)},
+    0
+  },
+  {
+    {W(0x662c5de517fb9812), W(0xf3cb4cac66066f2e), W(0xeee354af397b0cac),
+     W(0xdabe5206178e6e75)},
+    {W(0x35c4117f908d86e3), W(0xed3f402e1bdd8b9b), W(0x32a39fb619feb3e5),
+     W(0x2bdbd3d46d366518)},
+    0
+  },
+  {
+    {W(0x5452ff861aff1d84), W(0xaa1501f041c289d4), W(0xed0f0e4eacaff0d8),
+     W(0x4162140590671447)},
+    {W(0xabe9c47684198c20), W(0x54122567754f5378), W(0x75598d36860c138a),
+     W(0xa453e89656972dd5)},
+    0
+  },
+  {
+    {W(0xfcb7f76e71c94eb0), W(0xbf89f0efc4a57547), W(0x3ad7c5595e6a7ac5),
+     W(0x6a772eb642ea00af)},
+    {W(0x3dd38c2e95381e42), W(0x2be9f2962083e01b), W(0x59aff09f5bab393a),
+     W(0x2e5069297ebe626c)},
+    0
+  },
+  {
+    {W(0x74f46cc6e2655096), W(0x658d9d67362f645b), W(0x773f97216b4e438a),
+     W(0x336d06fd9b4c3a32)},
+    {W(0x1f6c9216098a8969), W(0x9f0ac8a7e5257fba), W(0xb96b3e1b4d6a4dc1),
+     W(0x935741801195854d)},
+    0
+  },
+  {
+    {W(0xaf43ed2498e541b0), W(0x7c3792e9b473e2e4), W(0x5b7c7e101b76227a),
+     W(0x7caa2c89a6fbce72)},
+    {W(0x5143929b3f174c32), W(0x89e5d600fc1559f2), W(0xf4d9e0807ceddda8),
+     W(0xd4d0d9640e81d8b1)},
+    0
+  },
+  {
+    {W(0x817f280c25a2a6ed), W(0x476d4b5086d18e78), W(0xf7f1733552360d1d),
+     W(0xacd7dce86b5e46ca)},
+    {W(0x14e1edf08e966e29), W(0x026317ee07529301), W(0xa961c867ff8bc92c),
+     W(0x411d9fa272d6f449)},
+    0
+  },
+  {
+    {W(0xeacf72f61110b0c2), W(0x54d39165e2461123), W(0xfe1fc1e19f376e5c),
+     W(0xb5e21955ae91788a)},
+    {W(0xbbce79727fa9dcb6), W(0xd3ba4be21076c1f1), W(0xe28e0e1296efff14),
+     W(0x0cd17e3798a5b399)},
+    0
+  },
+  {
+    {W(0x79d9af420fac0ee4), W(0xce2bc3933200463c), W(0x01f3a5986a2df056),
+     W(0xacfa10a28f255bc3)},
+    {W(0xd4d0307843ab9eff), W(0xba8dccda050a4c05), W(0x6d5d382ce609252a),
+     W(0x041680d1bc6b7eb0)},
+    0
+  },
+  {
+    {W(0x1fe4c509b15f3a4e), W(0x20c3aed3773ad589), W(0x326cef501c4c729c),
+     W(0xa44f18c7619b8c69)},
+    {W(0x07d034c7a6327400), W(0xb3da3184c1d2969a), W(0x9b762a5a029c84ac),
+     W(0xb56b2d0242ef1679)},
+    0
+  },
+  {
+    {W(0xa1f0adbcd78daa4a), W(0xa69c2a79c0cbe59c), W(0xa71c7c34b5052570),
+     W(0xd570e2cf380ed1aa)},
+    {W(0x6a892643a8607d43), W(0x284d389609087d05), W(0x5937e5a450b39037),
+     W(0x58acda3302c325df)},
+    0
+  },
+  {
+    {W(0x05235f3d3fade17a), W(0xdc55155c663aa805), W(0x49da355305d8ffb2),
+     W(0x5cb944a2c905b859)},
+    {W(0x98477c8b8945fc4d), W(0x497015e4c2ab085a), W(0xf643a4ba9644018f),
+     W(0x69fc22f148694e2b)},
+    0
+  },
+  {
+    {W(0xaa335de3e79d3c42), W(0xe8aa1a4c79b01a4c), W(0xfcc9aeef37cf2e49),
+     W(0xc564ed12501d6726)},
+    {W(0x66de9f42df217c6d), W(0x27d2f7aeacce9a5a), W(0xfa19a4c1d097cfe5),
+     W(0xd0225740fce3e9db)},
+    0
+  },
+  {
+    {W(0x2229605fb28b6ae3), W(0x3db4cfc56207c2f8), W(0x78ff186d389fbe27),
+     W(0x4906f63ac96d5721)},
+    {W(0x1b6cda5e9d98dab8), W(0x93c05001785e7b99), W(0x21fa5d28f024a6e6),
+     W(0x0d111cafa96bb3e4)},
+    0
+  },
+  {
+    {W(0xa3a75e7e77793385), W(0x415724fb28f71929), W(0xb987fa210b4bbe85),
+     W(0xccdb8bdb6678ab37)},
+    {W(0x2803be1655ebce5e), W(0x515db89b7f63cc7a), W(0x21a0c7f9175ce5a4),
+     W(0x3c654efcfd001a46)},
+    0
+  },
+  {
+    {W(0xa1f818235f756b6b), W(0x9c8671ed6dbe835d), W(0x5e159d5388b7e5ab),
+     W(0x5985112d078fd265)},
+    {W(0xc3457c2dab578c73), W(0x871d8fb007660001), W(0x3ca0039af86e9346),
+     W(0xd48c860bf60e7b2b)},
+    0
+  },
+  {
+    {W(0xb28016da70680b79), W(0xf72d909cb217a1d8), W(0x998c1763afc82c36),
+     W(0xcf01e96134cabd9a)},
+    {W(0x11a4b08dca5d3f05), W(0xd2c4051b51480c88), W(0x7c1e366363bb8096),
+     W(0x3ca3f3143f4afc48)},
+    0
+  },
+  {
+    {W(0x7907a6118284bef6), W(0x2112ceaf42e4a00a), W(0x674284190c6bace2),
+     W(0x7305e1ca9eab43ee)},
+    {W(0xc386f24d9e9cbc51), W(0x330bb85d870d6e11), W(0xa534d22092af07b0),
+     W(0x50573302f9f1e1a2)},
+    0
+  },
+  {
+    {W(0xfcdbe5c8faf72d5f), W(0x8942ae0dc31a3acf), W(0xaa48adc1e1998d1e),
+     W(0x0c506361e955da65)},
+    {W(0x43b2c73d8081da5a), W(0xf0d87c0952a1cbe2), W(0xb4ea6874d6cefd78),
+     W(0x5d15dda9001edc7b)},
+    0
+  },
+  {
+    {W(0xdf4edadd6375ec21), W(0xe01b7284ed8de03c), W(0xb31527dd66b44675),
+     W(0x8cec6f762238aa12)},
+    {W(0xeef072f7467fbd87), W(0x914d5a903e42f277), W(0x9add3cd875e6f73f),
+     W(0x0b8339d8ccb2f67a)},
+    0
+  },
+  {
+    {W(0x5de71b7158684a91), W(0x98d9e62bc7aa3340), W(0x99ca725a490a954f),
+     W(0xf5a8cc86822d3b33)},
+    {W(0x284eaee1d687da93), W(0x79be0a3bb63b67fd), W(0xa053def70d9279d1),
+     W(0x5903f240bad17c12)},
+    0
+  },
+  {
+    {W(0x61eb053499a9de93), W(0xfc4a764f52dd3e49), W(0x9965459bce224f28),
+     W(0x22db8714f5697d19)},
+    {W(0xa2c547cd39ed16a6), W(0x20cd63e8c9c856fb), W(0xa70485f47c4b35aa),
+     W(0xebc9cce7ce38dac1)},
+    0
+  },
+  {
+    {W(0x66c566cb3c21f9d5), W(0x77ee203ecc4d8601), W(0xc9ff16b5b18f6af0),
+     W(0xe5f8eae293ba88d7)},
+    {W(0xfc5b4275045ba5db), W(0x85afc0e46fa9917e), W(0xf85e9616c08191b6),
+     W(0xdca9becbe65d7a06)},
+    0
+  },
+  {
+    {W(0xf593217600d23505), W(0xdad777f88483c43a), W(0x469298eb72c9c9ad),
+     W(0x0c07010c73e8e5ef)},
+    {W(0xbba4f7fe93a2546d), W(0x25ba64f5fac1e125), W(0x3314e8c2b37ccc27),
+     W(0xb881aac90cd8e44d)},
+    0
+  },
+  {
+    {W(0x53bd473cab8cd6cf), W(0x9c77a9e880f6f038), W(0x60c230798a4b2d76),
+     W(0x259dd6b0200ab901)},
+    {W(0x6f77b47ce12b54ce), W(0x134d52306287cd34), W(0xeff81a1f1e51127c),
+     W(0xbc6e9ecbb185064a)},
+    0
+  },
+  {
+    {W(0xc95a7087a729e8ee), W(0x9043c2c82973bcc3), W(0x0626e28496b1ad89),
+     W(0xa12f6e12f6cdd713)},
+    {W(0xd32029feb5419513), W(0x4460643755894422), W(0x9a53a14509f89d07),
+     W(0x2ebc410c729e3b36)},
+    0
+  },
+  {
+    {W(0x05978447e87b17c7), W(0x7f8ff6cdf592d119), W(0x973fd59b3323008e),
+     W(0xb9949efe8becacc7)},
+    {W(0xd74b2ea00366f855), W(0xe9afcecda84be71f), W(0x051c2c62f43d4224),
+     W(0xbfdd613672382da1)},
+    0
+  },
+  {
+    {W(0xa2c7df3a70a4f8ca), W(0x25c33cc9e253af8b), W(0xa96c24c272ae3712),
+     W(0x455898448d2fe5cb)},
+    {W(0x7fb743fff13e08b2), W(0xea3c02e9e37fe689), W(0x8bed1ebbd55d4f70),
+     W(0xfc621d97fd3c2907)},
+    0
+  },
+  {
+    {W(0xbb87977b7fa32e77), W(0x51490dc9e1c498af), W(0xb9cca2e3b1e3b263),
+     W(0x3f4ec036d0e4ebc8)},
+    {W(0x6f20893fb2641514), W(0xcf4eaaf5069cbef6), W(0x8ae6d138fe7da0f3),
+     W(0xbcb47f6d2cf78464)},
+    0
+  },
+  {
+    {W(0x411cc0637b59e5aa), W(0x70c54424458b3f96), W(0x54ac3e9d18e921a2),
+     W(0x2cfeb91ab1e4c265)},
+    {W(0x5ad495789aceebd8), W(0x52f49472ed64ac70), W(0x67af02cc52da9c13),
+     W(0xb977c1ac97f56731)},
+    0
+  },
+  {
+    {W(0x1da2bb08895ed2a0), W(0x62207ba024dbad0c), W(0x5234084680cdf6ef),
+     W(0x0b07065df939017a)},
+    {W(0x69c1c5989e0fc167), W(0x68a58dda5dea8f95), W(0xf0d2f42191ec97f2),
+     W(0x06cdb4fc0ea95a7c)},
+    0
+  },
+  {
+    {W(0x40db301c729d206f), W(0x603ea8e2f694d096), W(0xcc8ca05a4d7945f1),
+     W(0x3bcc84fbaada696e)},
+    {W(0x1c01b9edfff7c347), W(0xf432ba2fac3e7355), W(0xe43194650c56f24a),
+     W(0xdc7ef91711d26c6d)},
+    0
+  },
+  {
+    {W(0xa457b8aa7d89cb19), W(0x00ec490416178094), W(0x065b8b9f918c3e66),
+     W(0x759935d8eae97d86)},
+    {W(0x73184c162147ae74), W(0x4946bf502d79c594), W(0x2a2e3273fe374154),
+     W(0x2dd044d9b7f93f1d)},
+    0
+  },
+  {
+    {W(0x0aa283ef9c93535c), W(0x72b908caf40896cf), W(0xa47bf1a19c682949),
+     W(0xa6dd57184e40e8f1)},
+    {W(0x81f931affa174637), W(0xe72a30726429ef69), W(0xf90c0131508ec9da),
+     W(0xc01e08f40d91e632)},
+    0
+  },
+  {
+    {W(0xe08503c0517101f0), W(0x6a6db036e01f4f92), W(0x6d391d8d6a4adddf),
+     W(0xe02c34266c9dd667)},
+    {W(0xc1c5d274e2d7abbf), W(0x1c58331526ecdcf7), W(0xfc193ae2ead42f0b),
+     W(0xc39aea054ac3b7d6)},
+    0
+  },
+  {
+    {W(0x4c1acb7bbdd3d02e), W(0xed00bec4e5ccf8d7), W(0x63606d4b5d9f6ce5),
+     W(0x4f9038469e74e73d)},
+    {W(0x474da982107d9380), W(0x20c99349c23e2ac8), W(0xf9b6b3e373cfcc90),
+     W(0x679d979ca9fd8c43)},
+    0
+  },
+  {
+    {W(0x844797595d6ba743), W(0xbb33433f0ea54b83), W(0x0344439f3f950dab),
+     W(0xdfe3571c4a4f0d79)},
+    {W(0xb6f56e67f6ad6e6d), W(0x796b2b2b39e85cd1), W(0x4fa8cbccebf527e3),
+     W(0x2b9bc1839f248d3f)},
+    0
+  },
+  {
+    {W(0x148b2e0fee1d841f), W(0x54625c8e396fb7a9), W(0x6607942f38e96a3d),
+     W(0xcee2ea9947394048)},
+    {W(0xcca4e149d4b066d6), W(0x097bc3c690368862), W(0xd1542ab509986a10),
+     W(0x82a9f26c9e77ba1c)},
+    0
+  },
+  {
+    {W(0x504c69f15f7c623f), W(0xb0146af1870a36fb), W(0x5582c6fafa59322d),
+     W(0xdd54ca743e13b248)},
+    {W(0xe9fe5ff9ff0c70aa), W(0x2475cc3fbd91736f), W(0xd042a99de89ff28f),
+     W(0xf1a1d042f6cd0b7b)},
+    0
+  },
+  {
+    {W(0xf34a6d5790865dcc), W(0x6a99e9aa0ca5209b), W(0xdae45b63a2282205),
+     W(0x2a29d3fb8e8dd08c)},
+    {W(0x66fa6c9d2c17f539), W(0x46d3016f7a393363), W(0x844efc4c813f688b),
+     W(0x4026a5d19e7d8dec)},
+    0
+  },
+  {
+    {W(0x42bb2ba1400d2efc), W(0x51e6ef63071198ca), W(0x3ec1b83a722ac208),
+     W(0x559feadbba4e0359)},
+    {W(0xb4d0f690322adca5), W(0x09c7ad900dd9e661), W(0x0c8eedd2e8a620f9),
+     W(0xd00063cf2a74c96f)},
+    0
+  },
+  {
+    {W(0x9f0951fd83b88d1f), W(0x01a91d7e65d34f01), W(0x5d88e57849becb11),
+     W(0x3f8bff6baa0c5504)},
+    {W(0x800044d93a9eda0d), W(0xb579214f480c4bdd), W(0xc7ac59633d6d4849),
+     W(0x3070ad8122a90c58)},
+    0
+  },
+  {
+    {W(0xd4c26c2925e27ac1), W(0xb5aba5662ebc8b80), W(0x1e6ee3dd43824546),
+     W(0x120fe18bf30a3fc1)},
+    {W(0x74062f0ce29c3e14), W(0xa5ce84877192dfd5), W(0x7e352fad7a98b73b),
+     W(0x12bbbc060fca0613)},
+    0
+  },
+  {
+    {W(0x4278c479237f3aa4), W(0x12b9d4e84c55733b), W(0xd1c008220373bd06),
+     W(0xca52683e954027bd)},
+    {W(0xbc8273321adb7f3e), W(0x320c014ab06489b2), W(0xa5edeaf598a6f3e4),
+     W(0x8182d29c79a3406f)},
+    0
+  },
+  {
+    {W(0x2a5ab9d39369378d), W(0x4bfa1231c5375459), W(0x1eb06d092d0948d1),
+     W(0xe0fbf3b53962719c)},
+    {W(0x3c50f496f461ebc4), W(0x3957e73ba745c48d), W(0x6720dc2f8c456daf),
+     W(0x4254e35e479ccadb)},
+    0
+  },
+  {
+    {W(0xa701ba0c53f7f8f0), W(0x99907bf35d119d6f), W(0x4e51c293d2b6e4e0),
+     W(0xacb7de80305e7452)},
+    {W(0x9ab8533722269836), W(0xeb91a6a3b8c3488c), W(0x689aef080000f0ac),
+     W(0x4975c5f45c99f849)},
+    0
+  },
+  {
+    {W(0x92f236461cfeb3c6), W(0xc0fee7e4b330e8e6), W(0xbd3b1cccaf131fe7),
+     W(0xb6c02873f337f6a5)},
+    {W(0x318913f5fa7d782b), W(0x49da5b574903f88f), W(0xcda99deb2e03bef7),
+     W(0xc01a351a26fca5f5)},
+    0
+  },
+  {
+    {W(0x3d5af829b3f25d3f), W(0x58947835a0bc9595), W(0xed2591984e5f00f4),
+     W(0x150e29a35cdad9d7)},
+    {W(0xb769bfa14a1f4bf3), W(0xe73aad7f40605ab4), W(0x1fbdd9d278dbf427),
+     W(0x257f1a2796ebffd4)},
+    0
+  },
+  {
+    {W(0x4c2ad3268d4f308f), W(0x5140c54855a685c9), W(0xc56b3ac048989146),
+     W(0x365523f21e8fe06b)},
+    {W(0xe8a0a726cd5b066a), W(0xa0ba4720de0dad69), W(0xdbaf8654b4405ad8),
+     W(0xcbd53c8e295bbe0c)},
+    0
+  },
+  {
+    {W(0x039120a52da45961), W(0x3eb44c8b620bdb18), W(0xd6aeac322b67ef16),
+     W(0xf46a23804d9a2225)},
+    {W(0x09b50ee83656ab62), W(0x1d43805715c8bab9), W(0xc2527d479c5b4b92),
+     W(0x2b82725aaacf317e)},
+    0
+  },
+  {
+    {W(0x7af03edcb9f4a9dd), W(0x42074216fb8c40da), W(0xb4ac1ead3b2d151e),
+     W(0x09f151327dc109be)},
+    {W(0x24d57669f5b2dfe4), W(0x811124088e18c03a), W(0x64b6d00b99817cf6),
+     W(0x6a9ac4139ba22b53)},
+    0
+  },
+  {
+    {W(0x513d1c2560b3d61b), W(0x4cb6b5e5daa18dd9), W(0xc89b9d70ab1b6978),
+     W(0xb671ba741cffd557)},
+    {W(0xffa20253c0e86133), W(0x9969c5157832299e), W(0x5b9ec93d80d065d9),
+     W(0xd18b5994ccad46a1)},
+    0
+  },
+  {
+    {W(0xf6b6c8cbd1cf3e4a), W(0x387dbaea742e2da4), W(0x42ef7b976e1ce508),
+     W(0x47295de13ec4ee33)},
+    {W(0xca51e63f1439d8f1), W(0xef26fd582ab95b6d), W(0xd54446af1b87eaca),
+     W(0xbb361a72330255b5)},
+    0
+  },
+  {
+    {W(0xeea93b4ef4ea38e6), W(0x63f3fe565eaa7403), W(0xd0b1a79bc365fd7d),
+     W(0x17e3d0ea468c4353)},
+    {W(0xa95bbc4e838f6605), W(0x56cd71b32c9d3c79), W(0x2dbbf4c7158c4843),
+     W(0x801fc47296fb540d)},
+    0
+  },
+  {
+    {W(0x0dc372b7c3438a79), W(0xd9afb441af156a7e), W(0x2d6e9515ffbc78cd),
+     W(0x6dd8ee9c9929564e)},
+    {W(0xd49f85c92f0140c7), W(0x1f4eff42d9faaacd), W(0x3bd1a7268e5f8175),
+     W(0x3a9ed57e90a35286)},
+    0
+  },
+  {
+    {W(0x89a8178b4f668bd5), W(0xd8ba13b66e62416c), W(0xe9d27399fa6c510e),
+     W(0x62cf81a9731fedc0)},
+    {W(0xb0a7207b52dca772), W(0x013000cc6b2880dc), W(0x184e26652756f457),
+     W(0xe9683db818c79736)},
+    0
+  },
+  {
+    {W(0x739ad70d92167c1c), W(0x382fff78a6d47d5b), W(0xc63c55cb5b411caa),
+     W(0x5f10178a267adfbd)},
+    {W(0x9b10ccf9c5fe7b7f), W(0xbf0e1b8a9d81229d), W(0x1eabd56dbcb3b804),
+     W(0xdb560d10ecd5e6a3)},
+    0
+  },
+  {
+    {W(0xd39c3979ac0a4c80), W(0x83ee2c3495f3d9cc), W(0x78e4535b117a0335),
+     W(0x0cea5c4f1653f70b)},
+    {W(0xa4dee4f72d0ebbb9), W(0x98834bfd74294b6b), W(0xee84235832b27134),
+     W(0xd11642f13554b8f4)},
+    0
+  },
+  {
+    {W(0x441d8b750d446836), W(0x825c8fac0c8a5710), W(0x96006ab1cb76a04a),
+     W(0xf3ffa4197bd6c407)},
+    {W(0x4ba6eccaa485ce3a), W(0xf8d08865e0c02083), W(0xdd25f327d488e4fd),
+     W(0x16f01c82626875dd)},
+    0
+  },
+  {
+    {W(0x9004faa49909ee3e), W(0xc0d01dcf0e936568), W(0xd9228fca024a3dd7),
+     W(0x61e6a3f5044308f0)},
+    {W(0x6e69565f91ca34d6), W(0xe4cf3f217d7f35fd), W(0x926a015185339acc),
+     W(0x6603a89232bcab92)},
+    0
+  },
+  {
+    {W(0xf4e0caed2f9d01ea), W(0x4162d240751c3a17), W(0x1969d48e4ce4b84f),
+     W(0xab9d3b5274aa562b)},
+    {W(0xd2a1f7310ce23bc8), W(0x611ac5d8f099f936), W(0x14dbcf8282cfc61c),
+     W(0x771ae2ea61400d66)},
+    0
+  },
+  {
+    {W(0x24765a2ed9ee1004), W(0xa071c267043ad997), W(0x23681cb3060716a3),
+     W(0xd196d44fbfc6792b)},
+    {W(0xbde16781bd513d1e), W(0xfd31414d6c6d6324), W(0xa4e09394681bb810),
+     W(0xc11ee2afae68d6b6)},
+    0
+  },
+  {
+    {W(0x93c82c72073b1d5b), W(0xc8c96dae3904a74e), W(0xa265fea5aa999911),
+     W(0xea838403eed882c2)},
+    {W(0xecd64c2819572b2f), W(0x37bcae010ff3cd9d), W(0xab0b73d8dd18065a),
+     W(0xfc8da6954d141fad)},
+    0
+  },
+  {
+    {W(0x87369ff679dab98a), W(0x96615ad08c170c7f), W(0xe004d37e38cefd8b),
+     W(0xcab975483b43d37f)},
+    {W(0xf1c6ed7187e79e4c), W(0x1f4a1d692d691820), W(0xa2c2f98d90c06b87),
+     W(0x19e36b76d6806ee3)},
+    0
+  },
+  {
+    {W(0x144b0210800bb5dc), W(0x91520de4e1661c78), W(0x8c676d0978b914f9),
+     W(0x9212b0f82170093f)},
+    {W(0x9f9bf721800bf0b1), W(0x565e09f9da546d81), W(0x5cf40fbf508febef),
+     W(0x1c18b95eabf8fc78)},
+    0
+  },
+  {
+    {W(0xc4862a2301266890), W(0x7aba078f63f7b972), W(0xa72e219910451271),
+     W(0x23d7fea7bf15a10c)},
+    {W(0x3b67a6bc819d0049), W(0xc37235f3c557301d), W(0xa16a2045bf4a550f),
+     W(0x939b898152c54c25)},
+    0
+  },
+  {
+    {W(0x890bf10e6f771915), W(0xbd83cdb25793dbdc), W(0x2f650a90d98a6959),
+     W(0x409353d477fe8989)},
+    {W(0x66f8d4f09d8e59b5), W(0x4c5831695b4a310e), W(0x58bac120107d97dc),
+     W(0x28c6c69ec87cca8d)},
+    0
+  },
+  {
+    {W(0x47f0fec2b8fbd252), W(0x2ab6506fa38132e9), W(0x07cd0404c41a92cf),
+     W(0x3a571f0fcedfa4fd)},
+    {W(0x1b39a66bd4cd68f4), W(0x6bcb044438a8b20e), W(0x9dceba05d487b152),
+     W(0xe2a7b06b778bb5fc)},
+    0
+  },
+  {
+    {W(0x9998bfe5a6ca3ec8), W(0x7c70e41b5ad2bea4), W(0x6577996354a4a971),
+     W(0xcf2c4bb3e8c9ccad)},
+    {W(0xb8aaba5454a5b9e7), W(0x56e4141ed9bd4643), W(0xbacc6e66df2a96da),
+     W(0x42f4ad2372c46406)},
+    0
+  },
+  {
+    {W(0x857c63dcacd19821), W(0x4a7f9e8f6c8b4c49), W(0xb8e5bb2c3285b524),
+     W(0x9bcb7d2864af5465)},
+    {W(0x4aa897314228eab8), W(0xda8967d7d2a4c93f), W(0xfbabe58aab244533),
+     W(0x3c165c4376feb619)},
+    0
+  },
+  {
+    {W(0xdc4f40f77e4d19ab), W(0x2aeef95c93e95fc0), W(0x6f0c0af0f5786472),
+     W(0x13114e277776ca62)},
+    {W(0xcf581fe33561f3c7), W(0x977b93d782f082fa), W(0x1af7cf6c34cf985f),
+     W(0x8663066bd78d6f36)},
+    0
+  },
+  {
+    {W(0xb2e7d365dc9bdfe2), W(0x7047c4bdbeda1338), W(0x85b24d9c371fced6),
+     W(0x0528512882d0717c)},
+    {W(0xe4f7026c324242a6), W(0xc547afc9816ab033), W(0xc046fbed72da4240),
+     W(0x2e128e54ad3604fe)},
+    0
+  },
+  {
+    {W(0x933e2c4f6a2f6aab), W(0x07b69bf19b769bf3), W(0x3f9b3ac7ffaa7446),
+     W(0xc626a4f7599fa10a)},
+    {W(0x4e2b994085638502), W(0xef2aed725018d43d), W(0x7e5f3ce843ff982c),
+     W(0x02054a98cfcace4b)},
+    0
+  },
+  {
+    {W(0x8779bef6b6e49c92), W(0x76cd5260110a0e7b), W(0xcdc03e9013a4c476),
+     W(0xb7006b4ca5e833e0)},
+    {W(0xd173383fcdabd7a2), W(0xd57281f5e548c986), W(0xc8885ba344a25726),
+     W(0x77fa208d3a8300ae)},
+    0
+  },
+  {
+    {W(0x73272bf8a4ebc144), W(0x1d9506ea3aa23edd), W(0x61fd1218d8e7c999),
+     W(0x1bf821a32dbb8e64)},
+    {W(0x4f489ff1e0009eb8), W(0xe5f72adad218555c), W(0xcba608292a7d630a),
+     W(0x3ea3bcc2849c8eea)},
+    0
+  },
+  {
+    {W(0x49738d70f0c2cb90), W(0xa43f695472e116cd), W(0x2c12d76732db29f5),
+     W(0x853985f43c9b5e7e)},
+    {W(0x47ad5e1f9c19e187), W(0x06678ae1d343a93d), W(0x43379601d950c388),
+     W(0x544c687cbdac3844)},
+    0
+  },
+  {
+    {W(0x89ce4e6fb6bcbfbe), W(0x54b94d7fcaa78760), W(0x4724d5930250a4ff),
+     W(0x58df1fb6752215bc)},
+    {W(0x3ea7ae5063924bfe), W(0x6926bb8feceff97d), W(0x650df2c9bdf61fe5),
+     W(0x0f666a18fb60ca0c)},
+    0
+  },
+  {
+    {W(0x5afc890a2cacdafc), W(0xa1c6fe1e2da695a5), W(0xd4b9fc7034b99cbf),
+     W(0xf8afd40eafb2b912)},
+    {W(0xdcc3b4e36babfc67), W(0xa046019cb9c23346), W(0x3f06084c145e0819),
+     W(0xd96e00bd73c5d82f)},
+    0
+  },
+  {
+    {W(0xfd0e669b222c482f), W(0x8b7d58808530a24a), W(0x3983904d090d78d8),
+     W(0x50072ea1b390c7f4)},
+    {W(0x091d573a45677386), W(0x12c9bab243718fcf), W(0x76885ba55c3f2622),
+     W(0xaf7568c1a29a559f)},
+    0
+  },
+  {
+    {W(0xa9c8a36a108a6e88), W(0x71470594c2f5e39f), W(0xe3d65d789ce6ba90),
+     W(0x6e71d54aa6c27a55)},
+    {W(0x17dc474b0d9374b8), W(0x37c1666708a8ca1d), W(0x1a4dd8acb065b191),
+     W(0x9d6a010589f4e978)},
+    0
+  },
+  {
+    {W(0xd361d20487528f2f), W(0x84c30433e9a877c7), W(0x8d800d113f70c670),
+     W(0x7924f3ce83299214)},
+    {W(0x03211b95ad8a122a), W(0x18eaa3ad54d1f837), W(0xe1d5049debb4bee1),
+     W(0xea0919095360ee90)},
+    0
+  },
+  {
+    {W(0xa10457c5f5f57a32), W(0x56bc37d1034e7ff5), W(0x3bef5841ba92d982),
+     W(0xee8201514927c82a)},
+    {W(0x540ce1864724aab4), W(0x8e4c8c01b4294385), W(0xb4ed7eabc8b8f995),
+     W(0x6caf648cc386013a)},
+    0
+  },
+  {
+    {W(0x3e691524f1cc1710), W(0x30fea67df1ef3899), W(0xe009692951090a54),
+     W(0xe8b117a76615a6cb)},
+    {W(0x121c860fedaffeb5), W(0xb0e7295765a55986), W(0x2b6ee1d1012270ac),
+     W(0xea869e5584545f49)},
+    0
+  },
+  {
+    {W(0xc247994fa3129265), W(0xe8adfc6519bf5c72), W(0xec730fbeb5737bff),
+     W(0xb63faa556ee92ceb)},
+    {W(0x1f3e457327f6e3c9), W(0x36d0cfefc6bae6cf), W(0x0d2858c6410ec87f),
+     W(0xfe2dbb6de89a96e3)},
+    0
+  },
+  {
+    {W(0x68c8afbd13be0c88), W(0x8acccf285ca12567), W(0xe8d2442585c293c1),
+     W(0x671610a4a062ffd1)},
+    {W(0x2bedc087cccc0116), W(0x0894a8b21126cfc4), W(0x850f67dc8a484bd0),
+     W(0x26d4c28a62296159)},
+    0
+  },
+  {
+    {W(0x973baadbe783cd71), W(0x41a6c6382ebc8625), W(0x788a9c24515a2e0b),
+     W(0xa724675ea0dcc885)},
+    {W(0xb238018af74bbc80), W(0xbb4f74e58f113793), W(0x458c9675cbf0ca8a),
+     W(0xde71794728906be8)},
+    0
+  },
+  {
+    {W(0x885fc2656971fb69), W(0x791642aa3d1561fb), W(0x0a999e10e1e7af08),
+     W(0xe20133ec75322a46)},
+    {W(0xb5f4f7fa5451499a), W(0xb8c582564dfd7867), W(0xafbfbe2f3c805e01),
+     W(0xf2741b2e697575aa)},
+    0
+  },
+  {
+    {W(0x16d8bff8b1bed3d2), W(0xa6640856659ab321), W(0x5ed241fe4ad7830f),
+     W(0xf5845eb1905bf6a2)},
+    {W(0xb9467c67d84c81cd), W(0x04a436a20f646717), W(0xc526f2159905981b),
+     W(0xe368ed4292411381)},
+    0
+  },
+  {
+    {W(0xba1bebe7947e1b18), W(0x05b46d6b162223e8), W(0xf66c40f8434cef46),
+     W(0xfabcc2f3d75998cd)},
+    {W(0xcd8c92d2f1efff93), W(0x750d2d9822b390d1), W(0xd2c6744ec6c9b38b),
+     W(0x5bc33340095cca62)},
+    0
+  },
+  {
+    {W(0xcc7dfe40bba60b9e), W(0x199911cdd1539501), W(0xd4ba167f3dc97db5),
+     W(0x7fca8460900c099f)},
+    {W(0xc47c61d5fccf8890), W(0x391f82189db15b89), W(0xd40ffc859d2b0df5),
+     W(0x328a01e23ee79157)},
+    0
+  },
+  {
+    {W(0xe7c076ff1315c722), W(0xceaada7c078b5f66), W(0x556d6cecbd53c47a),
+     W(0x951a7ff91a18465f)},
+    {W(0x3d74f26d4f01ce50), W(0x15c7de969145245f), W(0xe8e9533cebc2d795),
+     W(0xaf5e253f31eecfc4)},
+    0
+  },
+  {
+    {W(0x0097b0f9d23b3510), W(0xc1ead4afb3c64d13), W(0x3ae40dac875e7c5b),
+     W(0x28e30d831eb5de21)},
+    {W(0x2b62b3fd5d353bcf), W(0x0cebcf0c7bcd79ff), W(0x347cf21eb88521d8),
+     W(0xdb7fe03c2b5bf195)},
+    0
+  },
+  {
+    {W(0x496652d4e43e358d), W(0xd4ff3b0b1ba011ec), W(0x1277cfe69f9aaea8),
+     W(0xf15a5e95cc4d627e)},
+    {W(0x6a1856a3051d2b8f), W(0x5ca7a7289cd174b0), W(0x45e896376ac16420),
+     W(0xccc0b0089c0166aa)},
+    0
+  },
+  {
+    {W(0xaf055643995038d3), W(0xe26b84ed798a6efd), W(0xe0e506e1020e1046),
+     W(0xe768d6769b400355)},
+    {W(0xb78857c741f6c890), W(0x0501eb92587e0050), W(0xf4f7858888d2ab9d),
+     W(0x57be0e9c48ae8703)},
+    0
+  },
+  {
+    {W(0x69c5cb6ce51545cb), W(0x34f1e72cf39c17d4), W(0x1143f059931ac1eb),
+     W(0x5d41c69903cccfd0)},
+    {W(0x00da6ea1f25049d1), W(0x4a3b3d30e5586a4f), W(0xcb9ea6e451be578f),
+     W(0xfbbcf24131c62f16)},
+    0
+  },
+  {
+    {W(0x5d5558fdcf61c9de), W(0x4d25610123303d61), W(0xe79769b05137ebb7),
+     W(0x617569562fd686ea)},
+    {W(0xd1fd7220aaca96f1), W(0x359b3cb9288e7654), W(0x857dc879abdb4b42),
+     W(0x136628ff129e3428)},
+    0
+  },
+  {
+    {W(0xb93bcda41f14d880), W(0x4c80edd1142c104e), W(0xb776866138b7eb32),
+     W(0xed8ec0a9f32e6c6a)},
+    {W(0xab7b533394a9f155), W(0xca58519c3998fc6e), W(0x27b4d03548e5a422),
+     W(0x417d8e332f33e09d)},
+    0
+  },
+  {
+    {W(0x8478ab78f566e3a1), W(0xeb08eb0ecd88813d), W(0xf2acbb4ca587326e),
+     W(0x50b79b32f8e4e1c8)},
+    {W(0x745a25c02358f11e), W(0x4a7dcb8079152ebd), W(0xac791ea086947a48),
+     W(0x7a6a359392d29710)},
+    0
+  },
+  {
+    {W(0xae1c80abcfb75089), W(0x8e7777fc1286c902), W(0xfef470c22c11dbca),
+     W(0x3f74096b62698e7f)},
+    {W(0x3f5436ab9297de99), W(0x8e107f4a34a16cd0), W(0x126e93ec9f50a2e7),
+     W(0x3349e072a3c8a199)},
+    0
+  },
+  {
+    {W(0x1514771556abbc38), W(0xe7401afec8aa5cab), W(0x88ca0073d510e5be),
+     W(0x2daaa1239aa82f6f)},
+    {W(0x8f1c805301fdbc77), W(0xafe0d59a99ff0f04), W(0x98ecd0a2b41975b9),
+     W(0xce22493c15ae1cc8)},
+    0
+  },
+  {
+    {W(0xec678c71741cef80), W(0x89abb9f7f13198fc), W(0x6dad50752fe5ddc1),
+     W(0x259a5763905e48fe)},
+    {W(0xe2b39b18f15a9fa2), W(0x4c20064d00975eb6), W(0x354fb944fe5892f7),
+     W(0x2082968d0788c444)},
+    0
+  },
+  {
+    {W(0x4878182e5845b7a0), W(0xebfc9a2e9f666010), W(0x8b6971d323903240),
+     W(0xe401bc86faf1a484)},
+    {W(0x00ac02faa8c2c736), W(0xc8124fe309219ee9), W(0x2206013962a3bff1),
+     W(0x0c3a2e445d73999b)},
+    0
+  },
+  {
+    {W(0xc5c687b0fd009d55), W(0xddbf213ab02a30e9), W(0xac0c784bcf5096c6),
+     W(0xc102cd7c02548fc5)},
+    {W(0xa3fa04ad5c6a87d4), W(0x7e78ef765b57e553), W(0xd6d5a5f168eae624),
+     W(0x78447af8b3be30b1)},
+    0
+  },
+  {
+    {W(0xadb556b7cb67b2ea), W(0x4b20f39bf69a72ca), W(0x16a1f7c1199216ca),
+     W(0x94805ab4678216c6)},
+    {W(0xc7fecb35193e5610), W(0x24bd6912ad583126), W(0xf4f5486f0cef9a70),
+     W(0x3e361fe2c93ffab5)},
+    0
+  },
+  {
+    {W(0x56e078e7be5be48e), W(0x01c37951e108ec9e), W(0x177aa686f3417980),
+     W(0x4f368546d0b3b44d)},
+    {W(0x688af79e4013a602), W(0x0f9074b61d17f96e), W(0x92f72bc9d3b3f0d6),
+     W(0xd84fff063ce4ed1b)},
+    0
+  },
+  {
+    {W(0x7e925f86e0114f46), W(0xf0c376ec2ed7ff1d), W(0xf6ba1deb70d1706d),
+     W(0x66ac23a90d3c3172)},
+    {W(0x12379516790839e2), W(0x839c33fd08504f94), W(0xf043b13f160189a0),
+     W(0x7611b6718ed512b8)},
+    0
+  },
+  {
+    {W(0xdb9cd3004cac7b4f), W(0x558cfa8486fb6cdd), W(0x3ccc75034a6b6c6d),
+     W(0x411aaf4458d83e3e)},
+    {W(0xe8e996f9087eabd6), W(0xee25ff4bdb155dcc), W(0x24de2b949b9a5504),
+     W(0x4ec8e109294367cc)},
+    0
+  },
+  {
+    {W(0xf76160ba7bae14c1), W(0x46fbf0e90e4b8e40), W(0x6af0d6d8e4fd4195),
+     W(0xb8ead5b8c78f84e7)},
+    {W(0x2e7687a8e290e8dc), W(0xe9c4b8487da87562), W(0x50f4705a50ff9aa2),
+     W(0x02616605f69f36f5)},
+    0
+  },
+  {
+    {W(0x2bef90bd09624439), W(0x72e1877483f7e7df), W(0x00062261561e4dad),
+     W(0x2ad37ae15b3f6e50)},
+    {W(0x71561e46237810df), W(0x8d2c7880028cc785), W(0x4f8b85d2383b8adf),
+     W(0x930c9880b4952048)},
+    0
+  },
+  {
+    {W(0x776e80a2c591f85a), W(0xf4b89760b11a32e8), W(0x42a1d1508873cce4),
+     W(0xca352493b320123f)},
+    {W(0x039f9db0600c223b), W(0x39d15c7961b2bfcb), W(0xbbd936ad0bc98a88),
+     W(0xc567232d8a32e122)},
+    0
+  },
+  {
+    {W(0x47a5e29b4212bf25), W(0x6f16c3b9e6908892), W(0xdf9fdd46e8c44d5a),
+     W(0x79f71c929cc8bebc)},
+    {W(0xd1fc4fb2a9b94cbd), W(0x05259585e5ee7576), W(0x03ed408726232cff),
+     W(0x5350f8c2fa535caf)},
+    0
+  },
+  {
+    {W(0xc741afad91294efb), W(0x8034e3a7b13bb5e2), W(0x90b79faaaf6d04df),
+     W(0x7e378ae2a19bb765)},
+    {W(0x024ebdd230b54022), W(0x9f834ab2ecc5eeb9), W(0x5d8e9f853528ec4b),
+     W(0xb6fcb5975f5775d8)},
+    0
+  },
+  {
+    {W(0x3b5df9c9f11932ed), W(0x7673ae813af67a53), W(0x5d464340e4607200),
+     W(0x9531cbbf2b6ef035)},
+    {W(0x942b5611c0707eb1), W(0x0224a025f3c00619), W(0x881ab42706c07366),
+     W(0x91088d4f3506972d)},
+    0
+  },
+  {
+    {W(0x1709c53c88a5d7ce), W(0x7a4143b59862bcad), W(0x1604bc555b3557f4),
+     W(0x9a53594f988cbfd4)},
+    {W(0x7405b0b3acbc314f), W(0xbc31d1b1e458cb45), W(0xc8b819006a6a6be6),
+     W(0xcbf2281f2b7245d7)},
+    0
+  },
+  {
+    {W(0x38ce41d1e2b116a6), W(0x31f388d36d016fca), W(0xdc0359cc0a6561a3),
+     W(0x9255b801dc6349dd)},
+    {W(0x2e4435b61b3361ea), W(0xd3008ca580a0725d), W(0x2b6e019f5d2e6f36),
+     W(0xb1cd929d77da49a2)},
+    0
+  },
+  {
+    {W(0x940a70d4e24e3464), W(0x15754229319d612d), W(0x9aa13d6ced81dbe3),
+     W(0x1ad6d8f25355d2ec)},
+    {W(0x8892d602312290e2), W(0xf59d116c04e91afe), W(0x7e69352d84a10154),
+     W(0x0fe0a6c2e9257427)},
+    0
+  },
+  {
+    {W(0x30980412e2751526), W(0xa99852e76a7e9965), W(0x69022efaa90615f8),
+     W(0x04fccdae2fe547d8)},
+    {W(0x3aba30f9eb82452f), W(0x8c6167c991bd164c), W(0x3699fe8b59768b0e),
+     W(0x771a39a5e56f7227)},
+    0
+  },
+  {
+    {W(0x45ce6078609cf746), W(0xfc218a0b36213cd5), W(0xb98a8cac79339603),
+     W(0x00310b7493ce96af)},
+    {W(0xc868c0dbbe41d6ee), W(0x5a189185812569fb), W(0xcd844ebc413818a8),
+     W(0xc5539928320ce118)},
+    0
+  },
+  {
+    {W(0x1872791b13c4fa02), W(0x8ad85f359c32630f), W(0x10dba357a40e2f63),
+     W(0xba34585b0304c934)},
+    {W(0x8a801484f85cbeb8), W(0x5bbef97c87c8b70d), W(0x332b303a53dbde87),
+     W(0x6bb0be66d09920c9)},
+    0
+  },
+  {
+    {W(0xfaa4a260d923592b), W(0x79ad2b3762771baf), W(0xcdaa5da1d398ac89),
+     W(0x8e4584e68196e1db)},
+    {W(0xa51408ef505dbc7b), W(0x347d1e7f848e168f), W(0x6f291126402c17bf),
+     W(0xd51df5f06978ca90)},
+    0
+  },
+  {
+    {W(0x8a403e9a36358353), W(0x199dbed811296638), W(0x49c95803523a0341),
+     W(0x5dee973e2b6df03f)},
+    {W(0xe183580012773efd), W(0x950623f73fe953a1), W(0xc8608c773d7ad95d),
+     W(0x51cbc8cd999812fc)},
+    0
+  },
+  {
+    {W(0x5e7f67dcc20f9e44), W(0x05b39a184cd25838), W(0x91cf62fd04cf3538),
+     W(0x0d016878ba00e6a2)},
+    {W(0x6b17472e1cee5b91), W(0xbe94bbf64e34e322), W(0xb62becb68189e5af),
+     W(0x160d460f03c9edbe)},
+    0
+  },
+  {
+    {W(0x382a4cc611c36cbc), W(0x650848165a53f658), W(0x09fb0ab1c6a9a8b0),
+     W(0x4d7713141dac5d08)},
+    {W(0xa93cdaf0e2f2d521), W(0xc53dbfd4edba268b), W(0xc0ce4392bde35457),
+     W(0x481016cc2516c5b5)},
+    0
+  },
+  {
+    {W(0x632095240834fe1e), W(0xb0f2db840d1a666a), W(0xe675b42c4cdb5d41),
+     W(0xddc75e072be74e11)},
+    {W(0xd2d3839e127986ea), W(0x43b08df7097de450), W(0xfdcb193c89857bd0),
+     W(0x48155b03a3e5b49b)},
+    0
+  },
+  {
+    {W(0x4c8a373b6b2e63bd), W(0x26b2be7ce920b02c), W(0x25ba386bc7fb24a6),
+     W(0x736b64d15f378d70)},
+    {W(0x6a914f3904d211bd), W(0x318be63143f23731), W(0xf3f710efa4ead8e0),
+     W(0x578ca15a4e61e994)},
+    0
+  },
+  {
+    {W(0x0e289f5b8b61b56b), W(0xc67ee469388579ce), W(0x11ac659f8048dcbe),
+     W(0x353eee8d05f46fab)},
+    {W(0x931dbf2994ada535), W(0x9ff8a760391e4e78), W(0x8798bf94c23ee1a6),
+     W(0x5e97a6d668600188)},
+    0
+  },
+  {
+    {W(0x6bf03626e509ca89), W(0x6716a92d39f07970), W(0xeac0b3e7870d95fc),
+     W(0x0bb6305c2ae4176e)},
+    {W(0xba4eddc37c3a3bfb), W(0xcacddfe7bceb4118), W(0x8c59d663ca10076e),
+     W(0x8d10da00e4df192e)},
+    0
+  },
+  {
+    {W(0x7a307f54c03e67ca), W(0x403364ca1364f3fd), W(0x72ea152e7c2af0b7),
+     W(0x391ded2bcba5ba95)},
+    {W(0xe7e42391944cbbf9), W(0x97b86608fb56eb56), W(0x980dbc3a9c3006eb),
+     W(0xee67391f7890de67)},
+    0
+  },
+  {
+    {W(0x13e369b74475023d), W(0x8723bdd3e2853dc7), W(0x448be3e2e9c4b242),
+     W(0x79777fa4b3d7b1d9)},
+    {W(0x430a45bea33b6ba5), W(0x9a31fe1a66c7386a), W(0xf3dc3a95e8be2e6e),
+     W(0xf6100cbabc900d35)},
+    0
+  },
+  {
+    {W(0xd620700040347934), W(0x8b218a21f40eb8b1), W(0x29be02590d57f855),
+     W(0xac702b54faa564fe)},
+    {W(0x8650f44fc42e6503), W(0xfffaae54160800be), W(0xab8fe5a6ce583b85),
+     W(0x1c678d3f638fc931)},
+    0
+  },
+  {
+    {W(0xe31deb2a25c835ee), W(0x4d5482d8dca8a7ca), W(0xad55574d7457e04e),
+     W(0xe2e913e6d4d7de41)},
+    {W(0x9f3d2aa0a3aee9b1), W(0x9199bf6492591507), W(0xda4adad86aeadb5f),
+     W(0x8eb124e5b4494791)},
+    0
+  },
+  {
+    {W(0x71505edd87c0ab47), W(0x44e40f7c104b6dec), W(0x6f2a8ed9ae2298e5),
+     W(0x1b0901b97b993a8f)},
+    {W(0x78bb1803ef44358d), W(0xb637608bf95a4996), W(0x971ff5e463c2e5fc),
+     W(0x2c1da9f34a5f63d7)},
+    0
+  },
+  {
+    {W(0xbe2d6f078e9f274b), W(0x1b2e97c33867043b), W(0xfacea96d0ee5e870),
+     W(0x95ad792bf23fa6be)},
+    {W(0x8728aa81b690e6b5), W(0x300519de91c29aee), W(0xd9e5532d8d529196),
+     W(0x3ae77b021d2998e5)},
+    0
+  },
+  {
+    {W(0x2c80f1c9606a228f), W(0xd265412ed66ddf4d), W(0x2df5007bc8ab60cd),
+     W(0x93d80971b97dc9ad)},
+    {W(0x94e7c935a06d58f4), W(0x380ac15b9ee3b76e), W(0x8cce63cc96d100c0),
+     W(0xb2143390b158e6bb)},
+    0
+  },
+  {
+    {W(0xe0082cc530190adb), W(0x5f16392bb154d8e1), W(0xb03ee00db6cb3fd0),
+     W(0x5e0e5f0287f31721)},
+    {W(0x6348b3b35a075d0d), W(0xc81d642664c33758), W(0x40c7b8235f93569a),
+     W(0x579f15f5ed860b80)},
+    0
+  },
+  {
+    {W(0x135427fb9624e958), W(0xfa580b62d5fd9d44), W(0xd68a37dc72126f91),
+     W(0x9f87f5d30a28dec6)},
+    {W(0x4a4a7d779e129cfa), W(0x40a48a5e8986fede), W(0x3e98f73a00b81cf3),
+     W(0x9b4b87c7d5141fc5)},
+    0
+  },
+  {
+    {W(0x265fd92f3888d462), W(0xa8b40531f4869ce7), W(0x39f1002f1b90a18d),
+     W(0x9e5a8869fad0075f)},
+    {W(0x204e07423c79de30), W(0x87097d11e5b4b8f9), W(0xa1bf0e80a30840d6),
+     W(0xfa260f1288231270)},
+    0
+  },
+  {
+    {W(0xc83a7c47dab4571f), W(0x10e82fad60cca48e), W(0x8e0787fdc0e896b3),
+     W(0x8f1201ec30cf97ce)},
+    {W(0x1add8d295105f941), W(0x7f4a0c5e1a2bbd28), W(0x3de8afb223b59162),
+     W(0x007090a4d5ee4a62)},
+    0
+  },
+  {
+    {W(0xf36adc541b960d2e), W(0xfcae442961f7a7c5), W(0x26547c1dacab4da0),
+     W(0xf1398c5dbac9f767)},
+    {W(0xd323da3c275acf32), W(0xfa4da6888402a06c), W(0x9fbee21de99ce631),
+     W(0xc205936b453db956)},
+    0
+  },
+  {
+    {W(0xfc97e5fa580cf4ad), W(0xd6f2340754600d05), W(0xd7f5b90c6889f46f),
+     W(0xd53e4f8d71ef1c42)},
+    {W(0xec901f0f42e0299b), W(0x2e7fa31d3a6a8d1d), W(0xce2024fa308316a6),
+     W(0xa0ec7a6de184b4e7)},
+    0
+  },
+  {
+    {W(0x71ef8d9007b03136), W(0xb9398c566a3fb8ec), W(0xbf947ff962fadf52),
+     W(0x7dd7ff55fd24fef5)},
+    {W(0xf6afd00bd605cfc1), W(0xa991a04b96db7300), W(0xe52970e248f33de5),
+     W(0x5cf405b38d396da4)},
+    0
+  },
+  {
+    {W(0x623d3a213b026bf6), W(0x57c3b29b5a60cec1), W(0x21a93b03bddb4cc3),
+     W(0x87215b12b06d9250)},
+    {W(0x91c2b1022802ae56), W(0x40e96ac5b0b70c76), W(0x223609bde786a6bb),
+     W(0xbeca1e2af194daa8)},
+    0
+  },
+  {
+    {W(0x44e4680fcc5cc458), W(0x2eba0751265e5593), W(0x6944c8b761d9e8ad),
+     W(0x0c8bdc3dc3b973b8)},
+    {W(0xe5df88b48f5a5f3a), W(0x86df69221fd7aec7), W(0x3993cbc7725000aa),
+     W(0x5b70b55bb840e7b0)},
+    0
+  },
+  {
+    {W(0xdbd2379f95ce931d), W(0x9cabb32a77722d5b), W(0xa06a2726d3deab2a),
+     W(0x687e8625199ddcbc)},
+    {W(0x1ebb7313f833b54f), W(0x6304a4b30a7a9815), W(0xb55598aeff285471),
+     W(0x9ffbda4e3ad11913)},
+    0
+  },
+  {
+    {W(0x779ec0e63302cc4a), W(0x9147d10a139de813), W(0x72d0670956337959),
+     W(0x60fa456f06da021c)},
+    {W(0xcefb6694caabf1cc), W(0x41c62197e3e7edea), W(0x17ac3d73cb7ed275),
+     W(0x59fa27bbf1cf7df8)},
+    0
+  },
+  {
+    {W(0xc6c9e724c551e515), W(0xa2b0d3d2cbdd5e29), W(0x41d32ac1a285c8e2),
+     W(0x3f1122d210ce9ed4)},
+    {W(0x766617cb0b34c04d), W(0x1e68cbee4258494b), W(0xf8313ab3dc6a740e),
+     W(0x7d1c52cdbcf7ab3d)},
+    0
+  },
+  {
+    {W(0x9f302b295ad730a0), W(0x88241faf92854ece), W(0x8f3db2ce38fa7680),
+     W(0xa944ad268408e2d2)},
+    {W(0xd4253e8312ab9a6b), W(0x7976ffba2dd98947), W(0xd49c7c9be75d2d51),
+     W(0x58cb4e50ba0e8b49)},
+    0
+  },
+  {
+    {W(0x14143a5042c5df8f), W(0x59393658a99e3450), W(0x8cf0eba4f49d3e66),
+     W(0xbfa717d7c5431833)},
+    {W(0x68540ebae8904b7a), W(0x67f17e3dc60a090f), W(0xbbbb43e2bc32915a),
+     W(0x7cffa699fc9a7e55)},
+    0
+  },
+  {
+    {W(0x438b4aa4558469a9), W(0xe358e95f4b0424ca), W(0xe4f767266609dc1d),
+     W(0x71d6b8374542a83f)},
+    {W(0x59bf4269ad75952b), W(0xec5178bf20b9cdd3), W(0x7c433179df17101c),
+     W(0xcb5fa345192654c6)},
+    0
+  },
+  {
+    {W(0x2fdf0eb45c0545af), W(0xd43316fee87cef33), W(0xbf2f9b014cb354b9),
+     W(0x22f5576c03c46872)},
+    {W(0xf51e1b6e363e5cd2), W(0xfbbf93dac4457063), W(0xe04424c63e5ebe36),
+     W(0x81542a5848248898)},
+    0
+  },
+  {
+    {W(0x4067f80fc9a71b1d), W(0x18599f84714f714e), W(0xa7f0605d8d7c598f),
+     W(0x39fd55f5c09bd717)},
+    {W(0x9ea9e7738dfb275f), W(0x89ddeaa224f6d99b), W(0x729909f960bf02c0),
+     W(0x67ad8e24b2e2b20f)},
+    0
+  },
+  {
+    {W(0xb0b46de06a96fcdf), W(0xdb46996823cbe6d0), W(0xa19b5adfc61c9f9b),
+     W(0x66e18d846325e4ed)},
+    {W(0xe0b7cdd9a5511cd9), W(0x46e585a6bebe5d33), W(0x1e700b7c314d3f64),
+     W(0xf3526be3b396db6f)},
+    0
+  },
+  {
+    {W(0x035224af11ca185b), W(0x137dfe1a7d7453be), W(0x67c19fcdb4952573),
+     W(0xff921aa073670696)},
+    {W(0x695d98a9374fa619), W(0x2d4de4cd14b9b5b1), W(0x3517de4958d293bc),
+     W(0x144d8c7712d9f37b)},
+    0
+  },
+  {
+    {W(0x055d0bc590647694), W(0x7f487c2d682bd8f7), W(0x568c2008f0afc33d),
+     W(0x33704815616dc655)},
+    {W(0xad94dd6cd51221a3), W(0x84a6b78ead5514c2), W(0x6af708d5fc429e1c),
+     W(0x304d6026f6cdd505)},
+    0
+  },
+  {
+    {W(0x26d228a7736c3ee9), W(0xca0f0a5f701a1740), W(0x3c7d5bc18c2e80c5),
+     W(0xf98fab8e43e5464a)},
+    {W(0x7ccea0f96e346e91), W(0xd23aa8a510253d33), W(0x371c142dae338e08),
+     W(0x15b25a47bc198621)},
+    0
+  },
+  {
+    {W(0xc15b7bafc9fcb304), W(0x0af29429ccce9ce3), W(0xf7c1091a87041217),
+     W(0x7f160bf80cd95f28)},
+    {W(0x9b44a0443b733902), W(0x7abada7743500f6c), W(0x967a94599eec9b4b),
+     W(0xffcd5a2734d6db44)},
+    0
+  },
+  {
+    {W(0xdbd501bc75fb20a6), W(0x21f530ef09bed12c), W(0x1fe073d103770273),
+     W(0x9232901659d9bd65)},
+    {W(0x9bf1afa65c600b1f), W(0x01f9cc5fa0f85753), W(0x379d2177b67e3466),
+     W(0x7bae266604921870)},
+    0
+  },
+  {
+    {W(0xbad0c63ea4023306), W(0xffb370900e53e1f2), W(0x4df7a280e5cd60da),
+     W(0x0f8b2e7e7c3ba481)},
+    {W(0xe70a6d5a1159c8cd), W(0x2473ecf3ed04588b), W(0x79dd09847c9af4ec),
+     W(0x08254eeaed372d8f)},
+    0
+  },
+  {
+    {W(0x65de47d8c532d996), W(0x7e565d79b70d3e0f), W(0xdb85001d18904e14),
+     W(0xb0d7c0757bad9309)},
+    {W(0xd309e6de0418b337), W(0x8ba21ce3dc519d8b), W(0x8de40f8b238809f0),
+     W(0xf76b9d9595db2fdf)},
+    0
+  },
+  {
+    {W(0x2fe8941ff3777377), W(0x285ec47e772e145f), W(0x28495767f39ff789),
+     W(0x403b113fa71c0a74)},
+    {W(0x5db2c4ca5f24671c), W(0xe61aef9c2e2361f2), W(0x304e1bc272066205),
+     W(0x62b4c8418f8e6583)},
+    0
+  },
+  {
+    {W(0x634fc4e2e69c1deb), W(0xcb05df065fcbea8b), W(0xb1e6830660812847),
+     W(0x6e1dadd9da353ddd)},
+    {W(0x7f8f568d8cd02560), W(0x71a78c2c59e4d368), W(0x1453f83fbdbcc2d7),
+     W(0x580ea515d38d88c7)},
+    0
+  },
+  {
+    {W(0x5bd659330761d095), W(0xf3aadde721695f40), W(0x3bccaf8953c85e3f),
+     W(0xfa8d651ece5cdfd2)},
+    {W(0x50add543dd7f2f31), W(0x1040ad9ad0ee874b), W(0x7de9751f2c380fe6),
+     W(0x737537a0debd770a)},
+    0
+  },
+  {
+    {W(0x5f6773f189f6ee86), W(0xacc57ab627c17d2a), W(0x87bc0cce6e8787a4),
+     W(0x2ba72a792b95db75)},
+    {W(0x93473800c884e845), W(0x60ff04173dbc7eb8), W(0xf4fb64714f661c29),
+     W(0x91e207c9ff10a257)},
+    0
+  },
+  {
+    {W(0x6ecd54786e9a1abe), W(0xe38748a92aff8fa0), W(0xd7700399ca48ae82),
+     W(0xe154676579c25d9c)},
+    {W(0x791e90dd52ab50b7), W(0x3c80212b3c83e04a), W(0xeac1f546fbe76f88),
+     W(0x5184314eef32291d)},
+    0
+  },
+  {
+    {W(0x4e0c8098d747bb11), W(0x9d4d9a1608997d0e), W(0x237450b723bc982a),
+     W(0xefc45a1e3ea5c109)},
+    {W(0x9b8cf2f5e32777de), W(0x44ab0a4088e2d387), W(0xccee1bd0af4671fd),
+     W(0xa5021e05d44f0ee8)},
+    0
+  },
+  {
+    {W(0xb52bdaed14d665a5), W(0x7398683d621d7de1), W(0xe21e7bdd8ba09b41),
+     W(0x70b176e5d8c1d3ec)},
+    {W(0x5da3834739e17770), W(0xa8de935808bd8c48), W(0x127258a4c3bfcf68),
+     W(0x8b5c8c54edd0d1df)},
+    0
+  },
+  {
+    {W(0x04b3e7200d12f395), W(0x8b585e8396c9f58f), W(0x75494c1d66b3c7a1),
+     W(0xcf3736e932dd883c)},
+    {W(0x7c3f87d62eba2a37), W(0xc570900d2c253797), W(0x169e58d87381cadf),
+     W(0x71d5b42f9897b5fa)},
+    0
+  },
+  {
+    {W(0x0288e2fa522a0015), W(0x9ade7efca0e76810), W(0x242861cfaa6d0c72),
+     W(0xa09e2518b50915a9)},
+    {W(0x0d17b68af7e25951), W(0x0db9cdde1364b7ee), W(0xec106bedeec5d943),
+     W(0x204583177df112be)},
+    0
+  },
+  {
+    {W(0x6f9952f5660ef102), W(0xa0d245c5ad0229a7), W(0x163c700cda2ff696),
+     W(0x5e073ec3180cee3a)},
+    {W(0x6e777106f60bd52c), W(0xb5e0365c13d3ebef), W(0x2c8894c2c43ac951),
+     W(0x1c2740a47be90972)},
+    0
+  },
+  {
+    {W(0x4d6992e80f847c56), W(0x45ecc2d9af02e0b9), W(0x40bf60a64ca61592),
+     W(0x44f9a1dacb8ca093)},
+    {W(0xb6e481180dce2db9), W(0xba4e4216180552ce), W(0x38b8f3eb49eda83b),
+     W(0x8453a01f308e4ea4)},
+    0
+  },
+  {
+    {W(0x5f03c7c9b895b970), W(0xb0a3b85f1b907614), W(0xc16e11ea683b3099),
+     W(0x5dc00a89268621c8)},
+    {W(0x6a6d6b59ddaff8f0), W(0x3924085fa8d7ef24), W(0x50494dc37ec8d0c7),
+     W(0x1dfce2df5c8e2b8b)},
+    0
+  },
+  {
+    {W(0x82cd79d4b959b292), W(0x06fa415e3628012e), W(0xd961051ff4b4904b),
+     W(0x9b3527dc465b22d3)},
+    {W(0xeae2c07b60161638), W(0x52b064eafb6525c9), W(0x3d2e47570a8c18a2),
+     W(0x2c6b99cc6f5af1dc)},
+    0
+  },
+  {
+    {W(0xbcbe9f09f768825e), W(0xa63cd2c3ae8c8f32), W(0x0eebd17d5d52e75c),
+     W(0x2fead37780906a73)},
+    {W(0x6540c829d931b59c), W(0xa5bf9c6daa67032c), W(0xb891cf7a6abaccdb),
+     W(0xf912b380ba05d35e)},
+    0
+  },
+  {
+    {W(0x82c4dc1fde77670a), W(0xd111544913cbb3d2), W(0x4d0dd5cbf4b5a30e),
+     W(0x48b4f1559065616a)},
+    {W(0xa2189e2d2ca6ccb3), W(0xa3c9c8eaef9c6e8e), W(0x2df415089e2b440c),
+     W(0xa6c228b979cae4b4)},
+    0
+  },
+  {
+    {W(0x0e6a1f54c3eff9b4), W(0xbe5679c2b1fd5570), W(0xd8a9e85503aca766),
+     W(0x4da59c1eed9131ca)},
+    {W(0x38a52b1fe6532e9c), W(0x4025e47abb509ee5), W(0x4115491c7234b664),
+     W(0x8413391b9754a28a)},
+    0
+  },
+  {
+    {W(0xc31b7207518b9f53), W(0xf53d76b8bea76f18), W(0x7933f8f3b69fc465),
+     W(0x58d06946dbc3fdfc)},
+    {W(0xc4d37eec74d5f49a), W(0xc166cfc6826f5817), W(0xa1f3f03d3e05e5fe),
+     W(0x12e763c4aa42ec83)},
+    0
+  },
+  {
+    {W(0x65285ba9dccce551), W(0x9caeb7af7688996b), W(0x8baa0f65ae553d7b),
+     W(0x0bca752a2c072962)},
+    {W(0x43e81c5eb843b635), W(0x0676eb64167a313d), W(0x5810d87c9da107d9),
+     W(0xba6485b69926e27d)},
+    0
+  },
+  {
+    {W(0x7083ee299f754dd4), W(0x5562ec7c284b4617), W(0x2631a0186a9d6c54),
+     W(0x79e7b84c4ea965b6)},
+    {W(0x9cb3b370841417c2), W(0xc4bcf31ae994ba8e), W(0x57bd8f68b2646ff2),
+     W(0x32c73c11679f75a1)},
+    0
+  },
+  {
+    {W(0x6f863048f6c2df66), W(0xdde98427f6ee4d03), W(0xee1add1ffff55ec2),
+     W(0x4d3ae2d4f9e6f4cd)},
+    {W(0x7847b1e82edc642e), W(0x0a1dda104044fd2c), W(0xae43294de21ba64c),
+     W(0x80e0cb1c350875c7)},
+    0
+  },
+  {
+    {W(0xcd18c921c889b6a0), W(0x5e491b6e2dbdf403), W(0xbb9653fe23d59134),
+     W(0x8a2c7a22e810b108)},
+    {W(0x10a32884200df347), W(0x3b14d50a60fdc885), W(0xc4595fc2801dffe6),
+     W(0x3988e873471693fb)},
+    0
+  },
+  {
+    {W(0x900e43776849dc21), W(0xc6b65354bc209ac5), W(0x8a1739a2cb74be3c),
+     W(0x4009958358d05908)},
+    {W(0x7e22c640726a1f19), W(0x6d60a16c6a8c8d05), W(0x0aef1c44da944d34),
+     W(0xfc0a965ce68afe03)},
+    0
+  },
+  {
+    {W(0x846078480e894ee2), W(0x338eab500d98cc8c), W(0x7bcaef48feffe5ef),
+     W(0x682ea2ee7da3be4d)},
+    {W(0x8b0c4b5d5cd89fde), W(0x64b5faf171f2b461), W(0x198967b8befcc1b1),
+     W(0x11d73f6489f9c997)},
+    0
+  },
+  {
+    {W(0x535d7c9ead181479), W(0x56aa62973af4a193), W(0x98039d9537164665),
+     W(0x15d5189fa6b658c0)},
+    {W(0x88a8dde872014c71), W(0xde43270459d0111a), W(0xda55d4f4b7181dcf),
+     W(0x3e6f8f41092377f1)},
+    0
+  },
+  {
+    {W(0x88c7b59f0b1af3f4), W(0x95ee0449a4f7417d), W(0xce164f8edb068679),
+     W(0x17aea5b69c191ed5)},
+    {W(0x1fd447ec5b753c4b), W(0xe563036ca43cefd9), W(0x8b128805939035d9),
+     W(0xaa4007e45869e306)},
+    0
+  },
+  {
+    {W(0xba1267ae9f4e0ceb), W(0xbc5d30f5eefdfe90), W(0xe47bd746fae73e1b),
+     W(0x155b803d6b8b6915)},
+    {W(0xd760c1f66115d983), W(0x0a482c6d2ed9cc39), W(0xc2cc05a569e27c53),
+     W(0x90242afc80ae7043)},
+    0
+  },
+  {
+    {W(0x525d7b590578d6a8), W(0x7022647cd02959d2), W(0x9598458a8ff4fc72),
+     W(0xb9080713fc4b651d)},
+    {W(0x0b641d424250ad6b), W(0x606537b2b5356d35), W(0x9798153f7ddf2530),
+     W(0x67b0deb308e93f9c)},
+    0
+  },
+  {
+    {W(0xba3872ce7007479b), W(0x540f296417e03537), W(0x6653c50322d78681),
+     W(0xb1ea39e4de57b37e)},
+    {W(0xb4874d23a0a841ff), W(0x308c48a44cae7906), W(0x725dead67384ca18),
+     W(0xfab3a82e37225f27)},
+    0
+  },
+  {
+    {W(0x9ff10dc5e7f9c201), W(0x00538d6c3f41f52d), W(0x5efaf6825473af28),
+     W(0x4e504f0e3ac976d9)},
+    {W(0x0c7927aff61c8b77), W(0xd9a2cd58fa911eac), W(0x351fdf3bffb345ed),
+     W(0xaf998d6ebf3d7ee4)},
+    0
+  },
+  {
+    {W(0x719cc58fa3d94bb3), W(0xb5acbde5c6fedf3e), W(0xaa530f555033bfc4),
+     W(0x07462ed7853d58b7)},
+    {W(0x856d184b5c67b0e0), W(0x1beb19194c4c6afa), W(0x23c3b3d6ad4e5d9b),
+     W(0xe2e353b74cd36ee4)},
+    0
+  },
+  {
+    {W(0x4d46a9d78c35a47a), W(0x4806060a2c9c50d1), W(0xc0054e08e1e5ba18),
+     W(0xb910a334d5d626b4)},
+    {W(0x4f9aa1b0a560c3ed), W(0x429dbc5e6b1d200a), W(0xf8105698b30082f3),
+     W(0x70ef3906e9a2621a)},
+    0
+  },
+  {
+    {W(0xa29e86c9f31ef01e), W(0x5626da3087f5276b), W(0xe4d802585cb93660),
+     W(0x29f819e8a350c8bf)},
+    {W(0xeef798e0df32f1e5), W(0x31dae56f72bae1b3), W(0x70ce301542a2b5a4),
+     W(0xb9ca30db842d8d58)},
+    0
+  },
+  {
+    {W(0x8d6bc1d614a63744), W(0xb5a5bea016292663), W(0x68083846b4b73955),
+     W(0xf725df3ad7a604f2)},
+    {W(0x2b69e1c60316f59f), W(0xd36aa8a16cf84857), W(0x52fe81bb65f7e640),
+     W(0x885af72a3dbed043)},
+    0
+  },
+  {
+    {W(0x595fb5fdb4dc16a5), W(0x2c65689dd74b936c), W(0xeac7683a50e205c0),
+     W(0x51d36b16b39dff0b)},
+    {W(0x9b33aa3f7396eab0), W(0x969db62ceddbaaad), W(0x42717eee37ab80ef),
+     W(0x247294e1bda35299)},
+    0
+  },
+  {
+    {W(0x2e5bbd47556fe7b1), W(0x84ca293fdf883dd6), W(0x8c9bd6cd8e8423d8),
+     W(0xbea81b7b6530fb6b)},
+    {W(0x617857fe67c6d011), W(0xaad3a3625440a663), W(0xdefb426def964716),
+     W(0x02a1f482e7ca8b74)},
+    0
+  },
+  {
+    {W(0x4986af0ff545d47b), W(0x34d36b5cb45f2b2e), W(0x566524e69e804e76),
+     W(0x8c557a6989fec669)},
+    {W(0x0a54587738fe3157), W(0x2f78120070defc76), W(0x043672b9cee69198),
+     W(0x32dfff49d1c769f2)},
+    0
+  },
+  {
+    {W(0x499b423e739361f2), W(0x6cfa191de87ae5db), W(0x90f864b128c2fa82),
+     W(0x310682329d6ba694)},
+    {W(0x523a6b7ae21b4777), W(0x3de4d9d93cc938a5), W(0x6d51c496a4c29e8c),
+     W(0xdc65ad0aa6078c76)},
+    0
+  },
+  {
+    {W(0x578857d2b2f09c31), W(0x23e4ded25d40314e), W(0xdd701b44d7785b47),
+     W(0x967122fdd051e418)},
+    {W(0xdd00d8b3dca4ebb1), W(0xd0e868d65b612304), W(0xb6102bfa96dc4e53),
+     W(0x683134931a0c8b0a)},
+    0
+  },
+  {
+    {W(0xe32d9c29e92e5640), W(0x743ccbba6d53f598), W(0xc117402f6334595c),
+     W(0x074aeda70b2b5235)},
+    {W(0x11ad89a9af08bd8e), W(0xa787e5c66eca1fbf), W(0x5a8cde5f7222ef47),
+     W(0x1110ca2edb3a8e04)},
+    0
+  },
+  {
+    {W(0x4d3a716f6d0b34c6), W(0xe0710d9651be4529), W(0x67beea5d0670d0cc),
+     W(0x003849e136f80b20)},
+    {W(0x53b109aa1fc7412f), W(0x52621da8ba6d1442), W(0x7d4c0cd90e84e26d),
+     W(0x80e182c1faa6c986)},
+    0
+  },
+  {
+    {W(0x2ed67987de75c314), W(0xfef328a7af44810e), W(0x5bfc636c2ae2877d),
+     W(0x2683290a4a531569)},
+    {W(0x507cd1177e7d332d), W(0xfaa6760af1d1af44), W(0x6e33072902085730),
+     W(0x3f63cef679bd18a6)},
+    0
+  },
+  {
+    {W(0x8aa7ae6b79f0634f), W(0xa6288f580190567e), W(0xa80c8fc2e342ea1b),
+     W(0xbfc963105656c5a7)},
+    {W(0x6dc81b22ff8c9180), W(0x251abe34d65032e1), W(0xefd4dc4f0bfdce6c),
+     W(0xccbb872883ca3f13)},
+    0
+  },
+  {
+    {W(0x50bdec8ac22e6fd8), W(0x0a79a77cd1dc62b4), W(0x9587e7090afad586),
+     W(0xe05df306d174c4d9)},
+    {W(0xfd392f4fb1ae52f8), W(0x235095b580af9297), W(0x4f6381e0f0ab963e),
+     W(0xb63c6dd3f17a3d5d)},
+    0
+  },
+  {
+    {W(0x22548e76bfe01539), W(0xc05957dfa067b0e0), W(0x3f63f5c71c6d86c5),
+     W(0x2c4628180fcccdb2)},
+    {W(0x6209760c0232f68b), W(0xe0c0587ec461fff7), W(0xf5e924ab286b1c35),
+     W(0x078222abe41a710c)},
+    0
+  },
+  {
+    {W(0x7e70b44e765b26ff), W(0xa3dc884f31feacff), W(0xaeeeecd6d1271678),
+     W(0xef65f5551cb22489)},
+    {W(0x96e355f573208f03), W(0xc1c19efe8ec09e86), W(0x70f873ecff87421a),
+     W(0x0d057dafc141d81d)},
+    0
+  },
+  {
+    {W(0x69fe6fd302070027), W(0x73dc9f3f42b227b8), W(0x31b800ad387783a2),
+     W(0x7dc72b35fd4d75cb)},
+    {W(0x3b1cbf84191ce942), W(0x35f8d5c172770653), W(0xcffd6c59395d352b),
+     W(0x8de45bc30385d4ce)},
+    0
+  },
+  {
+    {W(0x6704d442e0d6ef54), W(0xc261e53bf1c1cb12), W(0xea9bc3fdf96aba13),
+     W(0x203885cd092aa846)},
+    {W(0x982168581b55d317), W(0x3ab21467daf206cc), W(0xbc9003e43423f663),
+     W(0x0a49ff8220d2c431)},
+    0
+  },
+  {
+    {W(0xc1e8237819eb6c8f), W(0x332752008426b36a), W(0xb361a68672a212c6),
+     W(0x216631d2c1850d5f)},
+    {W(0x2dab476cc7cf0582), W(0x14dbef60d9ad9203), W(0x8b4154e9f590468c),
+     W(0x823f1dd14fae141e)},
+    0
+  },
+  {
+    {W(0x963bbb5aa37b5e95), W(0xbe16efbdf2b3f7ce), W(0x2bedbc94a83261c8),
+     W(0x580e93d4de860cda)},
+    {W(0x10c2eabed1e2ee38), W(0x66be5dbea55482e8), W(0x879b44acd773dde6),
+     W(0x5681aa907112ef8a)},
+    0
+  },
+  {
+    {W(0x674779c419e3d1cb), W(0xd4e677eccd268750), W(0x2952a4e11c4335e0),
+     W(0x35d390d9fe974a65)},
+    {W(0x331360bd4537947a), W(0x3d4ef7f17c7b20f4), W(0xb530987c4ef88988),
+     W(0xa497e1f923c96f2b)},
+    0
+  },
+  {
+    {W(0x1a4d93c12b813922), W(0x0202e939cb02ecd2), W(0xa1cd335afbf7c390),
+     W(0xae3462248cad25a4)},
+    {W(0x0eb98cbc61efaa78), W(0xb66bbbf64143b46f), W(0xe7475aa18cbba3b2),
+     W(0x457968cea4b9a680)},
+    0
+  },
+  {
+    {W(0xf8c8421ebe6250f4), W(0x362df20d168379ca), W(0x1534bfa540be9a65),
+     W(0x276cb47c67cb4f49)},
+    {W(0x2ef334cbe4eec9de), W(0xc78f702c235edc26), W(0xbb1987c9035322e4),
+     W(0xa026ffb1edd6bbee)},
+    0
+  },
+  {
+    {W(0xc73802c61481c0d8), W(0x626576822007c196), W(0x356ea178cd0a4bad),
+     W(0x5cec6331b0840e7c)},
+    {W(0x44094e2282f47d50), W(0x0f698b49095ca2a3), W(0x8b2fc87f1cd5a980),
+     W(0xb15ee19bbcd685f2)},
+    0
+  },
+  {
+    {W(0xd31ba2338707ba2b), W(0x7b14783879ac48fd), W(0xe5b6ab19263a75af),
+     W(0xb82e4e04ec73ed99)},
+    {W(0xeb459cea4619844d), W(0x426232a58e6c438a), W(0x76b64f16eb59d3fb),
+     W(0xe8430365983d0901)},
+    0
+  },
+  {
+    {W(0xc33d4ad18de19f9e), W(0xcf49d9cb40b01bc6), W(0x961dbf15bc48a8bd),
+     W(0x8903145ede2d5d21)},
+    {W(0x2e743eb601bd2004), W(0x06b34c724a46c41b), W(0xeff183a7e23cc26b),
+     W(0xb05512e3b1f913e1)},
+    0
+  },
+  {
+    {W(0x6ed2fac95162efa9), W(0x451259a51c224811), W(0xbae2cf9bfeff94e4),
+     W(0xd183b384057b6cc4)},
+    {W(0x0fd0797dc4566fbf), W(0x177a938014c61f1b), W(0x7fee35f236946351),
+     W(0x8c6a4d6a777c1a18)},
+    0
+  },
+  {
+    {W(0xe268322c48f6b30d), W(0x6e71cd2867f4b07e), W(0xc05bea1ef17bc88c),
+     W(0x371b73ae999dca9e)},
+    {W(0xf174ddafd10f08aa), W(0x76f56159610553c8), W(0xf276a96bc2ab4142),
+     W(0x630ebc88869d347a)},
+    0
+  },
+  {
+    {W(0x92d75e6c65142944), W(0x9281d405654fe3e2), W(0xa963b58891ebca52),
+     W(0xd67df0167b08d6e2)},
+    {W(0x72dbdea185bbde8a), W(0xb2d5e6736e88855a), W(0xedf7d7fad81cc9f9),
+     W(0x21a19edd834170e5)},
+    0
+  },
+  {
+    {W(0xf1c0349e1d9e1d0e), W(0xd2544cced937f5c8), W(0x81f357d9f5834922),
+     W(0x965d4c2dfdf1d041)},
+    {W(0x00788abaf3ed3d57), W(0x9756b52fbf3c8498), W(0x7b915056cc31a6c5),
+     W(0x01ed4cd1b5ff1552)},
+    0
+  },
+  {
+    {W(0xb8dbca537b67dde3), W(0xaaa9b395d33804d5), W(0x651c03b64226424b),
+     W(0x64ea154557bf3203)},
+    {W(0x257e8d12d42fb4e4), W(0xa91e5bb50939d685), W(0x54868e51df4bc981),
+     W(0x7dfb109d96f9c79e)},
+    0
+  },
+  {
+    {W(0xa05bad472cad3819), W(0xb72ed065ed0be6f8), W(0xf698db491b94c49a),
+     W(0x5028a7d9222ce727)},
+    {W(0x690bab4161e271bc), W(0xaeb024d3ffd779a2), W(0x9295f69b23fd363c),
+     W(0x9b9e8991d923558f)},
+    0
+  },
+  {
+    {W(0x4d3d9eedbf7651f7), W(0x4c065ef793805236), W(0x5d312da55df7ab88),
+     W(0x35fca7e5c4b557d4)},
+    {W(0x4578eae6b82c5ca3), W(0x554a5a3982bdbce8), W(0xb669b00b78299c98),
+     W(0x9092ccdece27cce3)},
+    0
+  },
+  {
+    {W(0x583e99f6d49e99ac), W(0x69a619304b0acf1b), W(0x9ca4b4e1012a39bb),
+     W(0x96b691ffa53a4d92)},
+    {W(0xdacbc502a3e0c498), W(0x5b9f296bc567704e), W(0x9fe6f28a1bd163c3),
+     W(0xfabfa6c647ca8afd)},
+    0
+  },
+  {
+    {W(0x0e7ee6b1b73ecea4), W(0x66fa3787c0455f91), W(0xfd47643bc0bdd636),
+     W(0xf2e0007c93e7b1c6)},
+    {W(0xb63cb8f5eaa5cc10), W(0x8e91aaab67ccbc66), W(0xa9ce97ce9e160fdd),
+     W(0xeb9e0fa1b79afb85)},
+    0
+  },
+  {
+    {W(0x620771755d51b720), W(0x3d54aa3dc3681cb4), W(0xbf3fb241f68ef360),
+     W(0x581873d7eec7dcc0)},
+    {W(0x0228f3db94c4d079), W(0x2d920056584115f6), W(0x4bc8e28dfa4289ea),
+     W(0x339fa65722612dd1)},
+    0
+  },
+  {
+    {W(0xdd09ab2748523c1c), W(0x8c1ad651376d7519), W(0xcbc891fc5ac4a38f),
+     W(0x362026a39bf48587)},
+    {W(0x5181947c5ddc5b63), W(0x58a8ead58bcae1fd), W(0xa5f5eb2d27021c4a),
+     W(0x0c7a50d4a096654f)},
+    0
+  },
+  {
+    {W(0x20b1534eda70815c), W(0x71032a2dde27c0e3), W(0xd5dab2e08ee6dd5c),
+     W(0x41f1a9bc08e692ce)},
+    {W(0xe845dade2bc44a6b), W(0xcfa51a40b0347dea), W(0xfb49c1580f88ee55),
+     W(0x34697733d9b25978)},
+    0
+  },
+  {
+    {W(0xbabd48ff3290d35e), W(0xf7df0bed43e14976), W(0x92cf228a2087ccea),
+     W(0x30437be649134863)},
+    {W(0xc3d067838e89f47b), W(0xec5e6f95d939cef8), W(0x94394c5438c9a460),
+     W(0xf36bdea1eb141cda)},
+    0
+  },
+  {
+    {W(0x0a4d5499ac4072cd), W(0x17b78ffe6458458a), W(0x0e3d1338a45a48f2),
+     W(0x110b501508633769)},
+    {W(0xf49f48668a42ee8d), W(0x28bf255e865144dd), W(0x65163b9e78902b30),
+     W(0x374d0df0510d8617)},
+    0
+  },
+  {
+    {W(0x4f21ce5131d6e3ec), W(0x86b1d8fe5fb117c2), W(0xfe36d72481b8e336),
+     W(0x9d302a5e399bcc68)},
+    {W(0x3c0128690e5b3e39), W(0x1790ea967c292103), W(0x14eaf9d47d89f87b),
+     W(0xec7030d930ebf7c4)},
+    0
+  },
+  {
+    {W(0xf1b5ad69e03b0f75), W(0x521cd6a7d7bed840), W(0x6dade489ac0e01ef),
+     W(0xbd461af196efb861)},
+    {W(0xc0afbe5e3a1078e3), W(0xa8d915f4568bdc8e), W(0xa0ddfc4a9453110b),
+     W(0xd336861c26d87e08)},
+    0
+  },
+  {
+    {W(0x645f7aa4f6e4ba0d), W(0x73d1092b40c26a24), W(0x049eb5b68d5b679c),
+     W(0xe77850618adffe7e)},
+    {W(0x5524dd618760f2a7), W(0xb8687c4196fb1db7), W(0x76f2bd48def6145e),
+     W(0x541e7e05f6c5735f)},
+    0
+  },
+  {
+    {W(0xd0b4d17afb65c286), W(0x2b5a454b07f09735), W(0x090d2b6c404a3f8c),
+     W(0x96e64f594d340b3b)},
+    {W(0xb90c4d3b36d14928), W(0xf700c29266ad5729), W(0xac5cba7cd8b9513c),
+     W(0x99730d05a8cedf23)},
+    0
+  },
+  {
+    {W(0x7293709ca8e052ec), W(0xb598c2eba0e5949c), W(0x78a826f4c203dcac),
+     W(0xe2e765a8409802dd)},
+    {W(0x89df5d215abb6e69), W(0x3d75275eb6360e02), W(0x51c8ce06a820cc52),
+     W(0x8c388da021371e30)},
+    0
+  },
+  {
+    {W(0xf3098ca43c44356f), W(0xbb0a8d6e4e2ad5bf), W(0xd95680358ad69023),
+     W(0x832b6b19f23b61f8)},
+    {W(0x04884c3dc571a8e7), W(0xac8140af68bf15b0), W(0xf1ad60ed0134f861),
+     W(0xf59b6a0f62bed74a)},
+    0
+  },
+  {
+    {W(0x0ad3e48f1a2884c5), W(0x36f945e9e833c513), W(0x47d89ded86e25888),
+     W(0xb6474ced0f47ae07)},
+    {W(0xb5cc32d60293ec2d), W(0x73671ccdaf99b729), W(0x486fcf241d40fbbf),
+     W(0x1b78fd59d81f0c8c)},
+    0
+  },
+  {
+    {W(0xb831dfb6602070f2), W(0x12769bcf2b866e65), W(0x76a4522b6382e6a8),
+     W(0xa7d3fe92972e1b4a)},
+    {W(0x9e097f47c939899b), W(0xbf6026b473ffd046), W(0x6f9cf75254fb4258),
+     W(0x0e50de6b56f4ef81)},
+    0
+  },
+  {
+    {W(0xd289ad4fb4e378dd), W(0x71f97149f61f7514), W(0xbdd8181f5eec3c4b),
+     W(0xf062a18fe50fa61d)},
+    {W(0x93ab450a2178fcee), W(0x03dc5b5c6255a989), W(0x05e39862f30fcc09),
+     W(0xdf9568df7b565615)},
+    0
+  },
+  {
+    {W(0xca3a5667df4529e0), W(0xcecd6a95b4ef6441), W(0x41e26eb5b7947b67),
+     W(0xcd7853ce1c628986)},
+    {W(0x13e12ff433c125c8), W(0x415ab1f67529a337), W(0x538314f62ccd59da),
+     W(0x9d9a5aacf951f240)},
+    0
+  },
+  {
+    {W(0x40bfc8d26b444eb7), W(0x05d341baa5b5d944), W(0x9fba4fca393f8bd5),
+     W(0x80f9e3313d6d27e8)},
+    {W(0x13620134b5678219), W(0x54b3756d796dd962), W(0x38efba9cc17ba517),
+     W(0x43ea2ea97a3c6e4a)},
+    0
+  },
+  {
+    {W(0xc4a29499ae3fca5a), W(0xcc4e7e17ea99a3c9), W(0xe8d5d52ec913a331),
+     W(0x809c426609adf0f5)},
+    {W(0xa1b8a7a652386b12), W(0xa8cc8417d31f1025), W(0x7f8f07bc93f4f765),
+     W(0x2597c0ccb4fc9684)},
+    0
+  },
+  {
+    {W(0x4f5503fc74952128), W(0x8636c388a82c75f5), W(0xec92346e39269c57),
+     W(0x81d002f04600bb80)},
+    {W(0xaef30f4ba9515919), W(0x2117cd9ffca556d2), W(0x0ac0a4679198cbc7),
+     W(0xb1e8c5b5a7b74bd7)},
+    0
+  },
+  {
+    {W(0x374318e45efe527b), W(0xb8de01d66e051f02), W(0xa6b3f4e7c8e70869),
+     W(0x709a40c1e01d2f25)},
+    {W(0x570b0154bb66d0dc), W(0x4502f60627a3e0b6), W(0x1ab1b7996fb689e4),
+     W(0x2f706b91dbdd4b26)},
+    0
+  },
+  {
+    {W(0x08ca5fb9842f338b), W(0x36f560665a2eb484), W(0x20a582031211400b),
+     W(0x69f150deaedf0167)},
+    {W(0x0e8d138cd22a7b99), W(0x381a9ee926748935), W(0x7c65d58fc445ca37),
+     W(0xf727d3ffbfe23101)},
+    0
+  },
+  {
+    {W(0x99e760144554541e), W(0x00c7d1a808282fc9), W(0x9150300ad14ac1e0),
+     W(0x5657a047b76af2bc)},
+    {W(0x0178780e4b15ae85), W(0xe1f1ae5d9365d69a), W(0xb763e1dd10249d53),
+     W(0xabc6cf0ecfb9902e)},
+    0
+  },
+  {
+    {W(0x218f46a1eebe0d68), W(0xd9fe2d289c31c6cf), W(0x6a4b5d676ba089ea),
+     W(0xedb4150320613b89)},
+    {W(0x9247dc670b0dc043), W(0x0e8321e5b70dcbba), W(0xe8a73146d2d96145),
+     W(0xaf0e8d21513ada38)},
+    0
+  },
+  {
+    {W(0xde82f7166990b63e), W(0x81999ce3dbcb7f7d), W(0x145300824c8ee755),
+     W(0x2c2e3836d1737b88)},
+    {W(0x2439a87be66fd2f4), W(0x890b40e44b0bb44c), W(0x6895ab3686b68b34),
+     W(0xfbb4c7240a01d57b)},
+    0
+  },
+  {
+    {W(0x3ab33c80c05a7026), W(0x03d05957382f4293), W(0xd58a0983c24cb880),
+     W(0xf7fcd9b17b82505a)},
+    {W(0xce988659afdb86e2), W(0xbdf253db211f7996), W(0xcdfe312ec0ab1d97),
+     W(0xb6083ce3f7f19170)},
+    0
+  },
+  {
+    {W(0xd668a40e66c25cf1), W(0x71111b2cac8f805e), W(0x919b70dc3f301ae4),
+     W(0xe0a1eea26944b4c6)},
+    {W(0x88a81c06b006a0b9), W(0x3deae1e11cfbeb05), W(0xd78145d89087286b),
+     W(0xc8e7272dbc565554)},
+    0
+  },
+  {
+    {W(0x2c47adf505cfcede), W(0xfa6db3269212f05e), W(0xb8e5aea88f73f145),
+     W(0xf8c544eb627b2dc3)},
+    {W(0xf0b1f99c052447eb), W(0x2b8d49bb19175a85), W(0xd8e0d944fa7ababc),
+     W(0x828ed64314f6202a)},
+    0
+  },
+  {
+    {W(0x61e259e490030a99), W(0xe40bcb8574fee8f0), W(0x47c71881e2a1c5a5),
+     W(0xa6e2173190bc0df4)},
+    {W(0xaae83384f94b2b92), W(0x5ef340ad3c9e57e2), W(0xbb85da007d67dad1),
+     W(0x2985e9d49c794677)},
+    0
+  },
+  {
+    {W(0x9898a5afd05fe285), W(0x3f0358fca436733b), W(0x5d92fb633dfcf00c),
+     W(0x5758410768bf4019)},
+    {W(0xfc62f207d0480c8c), W(0x7a238d631166677b), W(0x318f4240a4575cbe),
+     W(0x94811a4f63b9e3d9)},
+    0
+  },
+  {
+    {W(0x082d3e0bc80b3c66), W(0x0e131a21f3c8ce92), W(0x694fdf253c6a5254),
+     W(0xbd2f37d0aa71d113)},
+    {W(0x2ed1227b60cf72e7), W(0xef69becaa0c75dc7), W(0x95ef0e9734bf5958),
+     W(0x8730a4d2e172ba6a)},
+    0
+  },
+  {
+    {W(0x922917f5b302c7d9), W(0xb43caa0e6abba7bd), W(0x8f6f9e11ba3a3af5),
+     W(0x25d10ac34294d137)},
+    {W(0x1428f917957e6c85), W(0xb741db9ab7435f4d), W(0x0f205abad646c27c),
+     W(0x57aee76f876ce2b8)},
+    0
+  },
+  {
+    {W(0x0c28ea709fd27ff4), W(0x100df389fdccd57c), W(0xfef418830ff0526b),
+     W(0x7dec1b9306aa71f6)},
+    {W(0x6c57ced0769c720e), W(0x9db27e4ace56db6b), W(0xe8a70cb31d03b11b),
+     W(0xfc72f5a8d84aec5c)},
+    0
+  },
+  {
+    {W(0x35055a00bc0438d5), W(0x47224c194724bd9b), W(0x01ea8355c3007494),
+     W(0xc64bd21db640c096)},
+    {W(0xf1b055b845bbd7a0), W(0x31ba72134b0df4e3), W(0x6b2d2551e8a970f2),
+     W(0x9c419976f66d5048)},
+    0
+  },
+  {
+    {W(0xba3ac5600d5e2641), W(0xa52e9215dfec23ce), W(0x2e20f5bf942c191c),
+     W(0x9dc565dd73c171cf)},
+    {W(0xa767a8376c0d9601), W(0x2c76ee9e58a01f46), W(0x8cae0cc02009effa),
+     W(0x2325413a938c75c4)},
+    0
+  },
+  {
+    {W(0xbb03354b557a4314), W(0xd854ba305ee11f10), W(0x1de1898f47135227),
+     W(0xce36db849637763d)},
+    {W(0x99eecd43c2010c5e), W(0x409a9986ece52f68), W(0x45ca7c996741cb57),
+     W(0x0b76e005a59b9b5e)},
+    0
+  },
+  {
+    {W(0x8e24b18ee6f0c020), W(0xe5f3977b90b41069), W(0x63739f618ecdea41),
+     W(0x116710e4584f4b4a)},
+    {W(0x6fa13ae1b2b73241), W(0x0e32c93d24381650), W(0xad7bc7472fe122b9),
+     W(0x790faedeb4961ec0)},
+    0
+  },
+  {
+    {W(0x249228785d04d958), W(0xe626fcad41ad88e8), W(0x6d34fb50e842e8e7),
+     W(0x50bf42c36d98cd3e)},
+    {W(0x109a9d2ab68ec1c7), W(0x29a3b4b308f15117), W(0xdef2c432cdebd90c),
+     W(0xc8d111e4ac3852ed)},
+    0
+  },
+  {
+    {W(0x61884ceb97be35ea), W(0x0dbe56f3731b52e7), W(0x08087a5e69cdb112),
+     W(0x77c6a27eeb97ec10)},
+    {W(0xe491e4f96414b6ed), W(0xeb951d91f2d055c8), W(0xec9bf4593430bcc6),
+     W(0xbce360ccf8634439)},
+    0
+  },
+  {
+    {W(0xe07c5ce92ccdd7d4), W(0xde79e9714fe26cef), W(0x76f6948990a9c019),
+     W(0x58afbf258064a2e2)},
+    {W(0xed55a4e4b0fab5e0), W(0x44bcd7081994057a), W(0x65206954cffc1ac9),
+     W(0x41410ee033fb4f40)},
+    0
+  },
+  {
+    {W(0x8d3abf9dda629519), W(0xf6e8d1b6abf8026a), W(0x69b0c988373d443a),
+     W(0x17211b90da6be2f4)},
+    {W(0xa837974adc9fd510), W(0xbeead4f22d6ba608), W(0xc9556689d883026a),
+     W(0xd66689e8b66ec0ad)},
+    0
+  },
+  {
+    {W(0x7c04beda73356960), W(0xb744776be72d4332), W(0x415e29f61cbf53b8),
+     W(0x57b9d8aa9bea80e0)},
+    {W(0x58d91f02f7b463b2), W(0xb5d0826a32c69ac8), W(0xa7a9e45828a174ef),
+     W(0xc59b801e661a952f)},
+    0
+  },
+  {
+    {W(0x108aad2f07271ff4), W(0x19365a4330a8af67), W(0x973a398cc7456e78),
+     W(0x23228da95d1ee011)},
+    {W(0xff59e96797bdafa4), W(0x86cfc85033b36f66), W(0xefc1fafdfee89e95),
+     W(0x08a6769d9baf2be0)},
+    0
+  },
+  {
+    {W(0xd3c558ba05cfd290), W(0x5bdd694d9c9f581e), W(0xc33d202681c5055d),
+     W(0x71e6f86b8dca65bb)},
+    {W(0xe198b5afce0a2e50), W(0x247e74893f83a54b), W(0xbe80812c44d7f585),
+     W(0x938997ef0a846f90)},
+    0
+  },
+  {
+    {W(0xf52605dc6ed668f9), W(0x71774e1f4b1aad32), W(0x9d757f0e9fa5c240),
+     W(0xc8779abfb3ac4821)},
+    {W(0x45f1bbca045ec593), W(0xdf577ba1a5210fc6), W(0x183eaac5e515c2ff),
+     W(0x0d5d2b2a37476f88)},
+    0
+  },
+  {
+    {W(0xce01658272c4ece7), W(0xcf8964bf38261a85), W(0x178a6cd4fd9f3462),
+     W(0xc598bbf4972ad768)},
+    {W(0xa338f11b7b9b2316), W(0x71fae02c164d1348), W(0xfa58287d03aaf859),
+     W(0x6c9a5f8bcfcb5a97)},
+    0
+  },
+  {
+    {W(0xe19f67245cc8a37c), W(0x818f4804a39ceff8), W(0xc007394b34e0131c),
+     W(0xb354269bdb0e63cd)},
+    {W(0x903cc76ef850a105), W(0xc0817cf29503f154), W(0x445e7cc3fc0dc587),
+     W(0x6dd93627e8aebc58)},
+    0
+  },
+  {
+    {W(0xd5077e433fe66410), W(0x9ec07cfa36b67ac6), W(0x1a28ed07294f5dd1),
+     W(0x3ff29fc24b931c91)},
+    {W(0x5c36bd68129d9e2b), W(0xdb59dc64540f2acf), W(0xd287cc83e14cc97c),
+     W(0x657894cabf3cdcdc)},
+    0
+  },
+  {
+    {W(0x00d4eef8b4ca2b59), W(0xef0aa0a4331a2cde), W(0x62d65d3f547ea9d2),
+     W(0x4270b63fad7eec42)},
+    {W(0x3888247dc6181dbf), W(0x549b80266bbdc594), W(0x4820f0f4d1a4215d),
+     W(0xd8414f80e08e7d7f)},
+    0
+  },
+  {
+    {W(0xec9a41f8d8f57008), W(0x447899d41ca0b499), W(0xa3253c388b781bb8),
+     W(0xf8b9cc4882846d49)},
+    {W(0x821cccfbc2c338f7), W(0xe24a9f2db95e836d), W(0xe9f336c89c80358b),
+     W(0x693df74861e4b045)},
+    0
+  },
+  {
+    {W(0xbe0e4e17e51359d6), W(0xa97d9ecf92fbfcbe), W(0x0ee1fd22a026fc9a),
+     W(0x3f9a6e3d3f9b5669)},
+    {W(0x8118089c398b489d), W(0x4d1f0446be437443), W(0x243135196d9f2eb3),
+     W(0x5204746e73faf467)},
+    0
+  },
+  {
+    {W(0x603cb25fb1e3cbeb), W(0x2bded851ca48b1f1), W(0xde604ce8f10cbefa),
+     W(0x3f56795c823cbd79)},
+    {W(0x74b56fd8bb621761), W(0x1f26c955f045a58f), W(0x91f3cab962fec96d),
+     W(0x1007d6a5938b3a7f)},
+    0
+  },
+  {
+    {W(0xa9270587831f0169), W(0x551cce99499fd099), W(0x52a5cd2c4218af88),
+     W(0xddfe612b3ddd09c9)},
+    {W(0xcaa0264a857775b8), W(0xa7ccafd173d8e192), W(0x0525f66dfde56f8c),
+     W(0xb9a990af7b78b238)},
+    0
+  },
+  {
+    {W(0x97a3bc2d25ec3711), W(0x1d817e588ba2165c), W(0x0c33611093c67a53),
+     W(0xef38e048df5e178c)},
+    {W(0x79d39db98c0ca6f4), W(0x584c7590649ca3cb), W(0x3ec195534bab8729),
+     W(0x5e76634b27299623)},
+    0
+  },
+  {
+    {W(0xf26563caa9d71c46), W(0xd6cbeeb9172b3902), W(0x345171970aa61146),
+     W(0x45a0a074793bf718)},
+    {W(0xfe5089aaf6ce3154), W(0x1fd99dc91a567253), W(0x1942f86582f74f3c),
+     W(0xe9c491c014b51682)},
+    0
+  },
+  {
+    {W(0x3a2682b0b5bcc731), W(0xd6025821cc6a8ee0), W(0xcb6b81955e6e0306),
+     W(0x1104478e1ac6ace3)},
+    {W(0x46511b7349499ba1), W(0xda5fedd50bc6eecf), W(0x2c5ee45c8416803a),
+     W(0x5c17084170a0fbcd)},
+    0
+  },
+  {
+    {W(0xd0b0974f6cf5ecbc), W(0x7798bccd45c17af1), W(0x032567ba07e07841),
+     W(0xa52896c12e9750a9)},
+    {W(0x0134260e1d1e11ef), W(0x4f7949fc7d72465e), W(0x6aed7dadb0f439f4),
+     W(0xda8d0c94be67fb75)},
+    0
+  },
+  {
+    {W(0x64d053347dfa44b0), W(0xea269edc98d00883), W(0x07f72043bf2b0368),
+     W(0xb3211c3c1332080e)},
+    {W(0x7ffb6615418ff0e8), W(0xac9dc752aa719603), W(0x17156269bfb46f4e),
+     W(0x319af0cb6c7908e9)},
+    0
+  },
+  {
+    {W(0x39ecf08655df1a36), W(0xd5965cad44fc0721), W(0xecc25715e26b2ed5),
+     W(0x8281451783aab214)},
+    {W(0x8114543e076935d0), W(0xac4ac56e603f80c9), W(0x64f26cb06e1a9f49),
+     W(0xb0b239cd4a46e4d3)},
+    0
+  },
+  {
+    {W(0xbd0db07a7c1c3595), W(0xed97351a5a0941c8), W(0x699ec8c9b312aa58),
+     W(0x3390f8d3c275923d)},
+    {W(0x5cb8fa8a4e10a859), W(0x1080773e52d6a77e), W(0x62ccd52e4ec9f418),
+     W(0x1e2aa75c3dd196ed)},
+    0
+  },
+  {
+    {W(0x356d34ceff173416), W(0xbffba8c59384ad84), W(0xc0032e3d33c24ad2),
+     W(0xe7773f7f6569ea21)},
+    {W(0x7c452b62e91dd71d), W(0xea39ebb828e17a11), W(0x90b56363db13882b),
+     W(0x0382f928ac970753)},
+    0
+  },
+  {
+    {W(0x3861896de935e1e9), W(0xb226770fc5f306a3), W(0x9e1da4196356e919),
+     W(0x516ab27c07df2f85)},
+    {W(0x454c73f9ac8ba942), W(0xbd46e68d6d736bf1), W(0xdadcc441be7e8dff),
+     W(0xeccb149e6fc91b34)},
+    0
+  },
+  {
+    {W(0x1142658ac66641b9), W(0x1323c3dbe0177940), W(0x58ab455db98e3e50),
+     W(0xdbb842cfbf57dd73)},
+    {W(0x2efbbfb8f22c4e90), W(0xb0edb439a61c8d8d), W(0x9cf1726c370ce89a),
+     W(0xf89146f7c1ec7760)},
+    0
+  },
+  {
+    {W(0xf0c46edb2afc1c56), W(0x246b3cbece7d25f8), W(0x12b770b9dadeedff),
+     W(0xa97d5564239f8b43)},
+    {W(0xf6fbf50b991fdea0), W(0x85cccc8f566be7a0), W(0x6fa77c8dae63a795),
+     W(0x9eb0b38b8dc530fa)},
+    0
+  },
+  {
+    {W(0xc9cd7d77cabf1654), W(0xf0896cd692cc131b), W(0xedb0ff07538f7a7b),
+     W(0xce257f7fdd038245)},
+    {W(0x7a8b923001ed230d), W(0x14134a5cdcc30d2e), W(0x50e79b7f2ccaee9e),
+     W(0x25481c3ca34d0ff7)},
+    0
+  },
+  {
+    {W(0x5a1b338af7bbf1df), W(0x71969b8b4ab0ef87), W(0xe47af9cc997c5589),
+     W(0xbee7323796b45b6b)},
+    {W(0xd3d5db5417677a28), W(0x372689e3d328aaad), W(0x0ef45e71a2c2e7c5),
+     W(0x8054cee8295c2d73)},
+    0
+  },
+  {
+    {W(0x29f0a3023bf66974), W(0x168c6d4e778de0b7), W(0x8f1a7dfba5717b2e),
+     W(0x02dea9a617df5b32)},
+    {W(0x33c16e86d24df7db), W(0x11bb3062bfc3a2b5), W(0x5d4c1be91ca66366),
+     W(0x25f67ad66eca5dba)},
+    0
+  },
+  {
+    {W(0x3cfe9501cb563606), W(0x8c431c52489b208c), W(0xbb5156617f570131),
+     W(0xc78cb9e840651301)},
+    {W(0x4ffad5bd9a92d4d4), W(0x2456c70ae124d036), W(0x0cc79ebe1e0cf84e),
+     W(0x744591ae9687aafc)},
+    0
+  },
+  {
+    {W(0x5f13e79b7c569097), W(0x137eace221a1e8e8), W(0xdc3eabacc5091ece),
+     W(0x0588918176ce8425)},
+    {W(0xdb8f419b6402e5e9), W(0x7907cf2125c1da10), W(0xf0dd91ab45e27d0c),
+     W(0x1b68267a7df0d256)},
+    0
+  },
+  {
+    {W(0x1a4a195ccb39c5d3), W(0x1562bab2b641e984), W(0x586dbb02568c819c),
+     W(0xbb1c042329ffea31)},
+    {W(0x4584b74e2cae2396), W(0xb87e7f5793364701), W(0xf0f8380cdb99a7c0),
+     W(0x4cde0779e0683143)},
+    0
+  },
+  {
+    {W(0xe1442d51edb8f1b8), W(0x592dcb73ebef4099), W(0x10ca6bd989b49ade),
+     W(0xb86e125b288b3821)},
+    {W(0xf509953289464b1e), W(0x897dcd47622a26ec), W(0x75a42a75fe75def4),
+     W(0xe4afec76a3d6bbee)},
+    0
+  },
+  {
+    {W(0xd380cad11e799ad0), W(0xe719a2cedabe55d1), W(0x40964cbf6a3b00db),
+     W(0xe5b30d4dc8b17e8c)},
+    {W(0x66b12096566f9e21), W(0xb929dbd26c791c1b), W(0x04876a396ac64574),
+     W(0xd0613f1fad8de16f)},
+    0
+  },
+  {
+    {W(0xa94d58c2e613e276), W(0x86c4cc074f56318f), W(0xd2b758977000b9ea),
+     W(0xdc8649617615ae24)},
+    {W(0xbc7c70e319a93fe1), W(0xd9a8a4b95ad348ff), W(0x585f9d6c7639c6cb),
+     W(0x76563c43e475b807)},
+    0
+  },
+  {
+    {W(0xfe8b862a3882bbb0), W(0x0ad6cf2c3f83dd1f), W(0x44c2d02902154ad6),
+     W(0x1c56513349b0ab70)},
+    {W(0x4206a077ceb40055), W(0x8ef9f22414165e26), W(0xc8e226854d3761d7),
+     W(0x3c8df56a92f75380)},
+    0
+  },
+  {
+    {W(0xb6817d8fbda23591), W(0x7830f9abf15dd2c7), W(0x072d0541be9133fa),
+     W(0xb5ffc38d3122fb27)},
+    {W(0x3345450752f3235e), W(0xa366efabdb52bf12), W(0x05d0cc33be1cc549),
+     W(0xda60c4c09e0e8fc7)},
+    0
+  },
+  {
+    {W(0xc574f8d05e658687), W(0xae7bf22258cd9246), W(0x3d8be5c89ef1041f),
+     W(0x65a2d9bbd16ef15d)},
+    {W(0x4f9ebc7b4d53dde6), W(0x76de394afbdd6b45), W(0xfc68681a94870c90),
+     W(0x873660428cab16fa)},
+    0
+  },
+  {
+    {W(0x2019c564f02ff5ed), W(0xe5dced165a48d639), W(0x943eff37726db1ae),
+     W(0x1c80e1fca261110c)},
+    {W(0x46b6286af3b5d71f), W(0xe2bcfd5cad32d7d6), W(0x887aeb0a3989006c),
+     W(0x62e1c9db2a475cc4)},
+    0
+  },
+  {
+    {W(0x61dde849acbf20b1), W(0xa3e3769ec6e9d0f5), W(0xfcec17e87436e0eb),
+     W(0x463e25481d8a4269)},
+    {W(0x206510b47107e901), W(0x1631fd8d9952b97d), W(0xf59b53227818b8fc),
+     W(0x8b8639a2760e29a3)},
+    0
+  },
+  {
+    {W(0x853ec756e514378d), W(0x87cf23253c33d6ef), W(0x74632e125281575a),
+     W(0x7fa677449a8fec2f)},
+    {W(0x15080d0199305603), W(0x29b1abc17ceeb3ab), W(0x8080c25e435c306c),
+     W(0x6c84fecc94e10ea7)},
+    0
+  },
+  {
+    {W(0xf1718dbca4b58098), W(0x447fd2799a34cd39), W(0x3a95cc866a40e05b),
+     W(0xc86889bfb02097e9)},
+    {W(0x1c17d5ecef645245), W(0xc1883bb1e5260620), W(0x758e3a422e8dd5df),
+     W(0x3e7a22c40392cf52)},
+    0
+  },
+  {
+    {W(0x3bd0a2491d093baf), W(0xf6fd283e10186574), W(0x7dd92dbfb7aa0ff9),
+     W(0xc025f53349a9c71a)},
+    {W(0x6a5a107662ddc188), W(0x47a24a4cae278848), W(0x3572d3523bebdc77),
+     W(0x0259d20b71ac8824)},
+    0
+  },
+  {
+    {W(0x6cce4cb64c18b10a), W(0x05e1378efa8025be), W(0x6ac23c7a7d0596e2),
+     W(0x3eb9a16ad8729e8b)},
+    {W(0xf80ba78a1b21f307), W(0x706e0c6bed1a23dd), W(0xfd9e28d0b2574dea),
+     W(0xd25e57a8077a918c)},
+    0
+  },
+  {
+    {W(0x7f043dbdb2f9f121), W(0x3939805b23445d7b), W(0x63306d03e95e393b),
+     W(0xb10d74e6be6f9081)},
+    {W(0x858555b3ce363a9f), W(0xa304f474d291e1c2), W(0xdfdf0e7bd6504eeb),
+     W(0x98ce7be231c9fdfb)},
+    0
+  },
+  {
+    {W(0x52ddeb8c2560a27d), W(0x1c6ae0b4f7b32391), W(0x85b54228a437e005),
+     W(0xf3c134be099b212c)},
+    {W(0xba9a7d25114d3543), W(0x3460f8988497ed0c), W(0x15500960220e7352),
+     W(0x0f845d7a9e61e502)},
+    0
+  },
+  {
+    {W(0xc14694ee87c3c69b), W(0xc1e4e718a108490d), W(0xb6cfbf018d46bcb3),
+     W(0x66d16e3487e233a9)},
+    {W(0x0823741b5cf99bc8), W(0x9b3946e8dc28101f), W(0x06c571b688bea5cf),
+     W(0x667c8eedcb3c9b9a)},
+    0
+  },
+  {
+    {W(0x1d16b1e39fb6806e), W(0xfffd637927545339), W(0x19ac28bbedb4f132),
+     W(0x5862f398ec2ef349)},
+    {W(0x7f8ea27e512dbb15), W(0xa3e6656f36d289ec), W(0x92e729a0707823b7),
+     W(0xe30c658a1920f3db)},
+    0
+  },
+  {
+    {W(0xb542934b10229a02), W(0x113e051bb8675aa6), W(0xba01060a65c96cee),
+     W(0x28c0db1e334d3e30)},
+    {W(0x8ed2468994e1a04a), W(0x3cd407ecba25813d), W(0x00adfbf90c017078),
+     W(0x2f8a9548490e5718)},
+    0
+  },
+  {
+    {W(0x6e65038774fed585), W(0x01fa650caeb252f7), W(0xc2f09150f48478c1),
+     W(0xb39cf92ecbad8461)},
+    {W(0xbd84c9251d7b4410), W(0x882440aa24ec71c1), W(0x9454486ed88187d2),
+     W(0x901fd91e1f7c7f73)},
+    0
+  },
+  {
+    {W(0x6e31446500571d12), W(0x266de58855de62d7), W(0x5ce4ff7252617af3),
+     W(0x7a0996d7d441fe69)},
+    {W(0xa7db58cc6495f476), W(0x0b1c5fb4f7dd6977), W(0xbfe3a189fcafe0b9),
+     W(0xa954a46b82bc87f5)},
+    0
+  },
+  {
+    {W(0x6bc34821a39302c6), W(0x8a50b94c1fc660a9), W(0x56bf45a1db23610f),
+     W(0xd7cf11428444b6f5)},
+    {W(0xcab941796a1b1320), W(0x6f6c29953ca06d53), W(0x8ba9638937c752e4),
+     W(0x19caf5c84a0c5f2c)},
+    0
+  },
+  {
+    {W(0x9987700c05ab77bc), W(0xc3775d435245cdb1), W(0x9f0e8661e3837687),
+     W(0x69adf13bcad1f79f)},
+    {W(0x136698125c8b3b5b), W(0xd2661dc06ff218e7), W(0x893887c872f12df1),
+     W(0x0f4ee968f3369ad7)},
+    0
+  },
+  {
+    {W(0x43bc4fd531ea7fc1), W(0x7a041a3f5baf316e), W(0x366be26e89853968),
+     W(0xdccf84944e4bde29)},
+    {W(0x19261f7261cc6b54), W(0x495478d53077dea0), W(0xac01ece1a8a59120),
+     W(0x0bd8537183ff3757)},
+    0
+  },
+  {
+    {W(0x9fe94efe9432a1e6), W(0x75ff0b4bc278862d), W(0x3ec90015a2264e59),
+     W(0x3e2eba03280b8d0d)},
+    {W(0x5e3406a080558b5f), W(0xf50f06cc2bbd1936), W(0x0c23d50bc2b9dce7),
+     W(0x231b15df41c3fdb5)},
+    0
+  },
+  {
+    {W(0xa30d61b814d716c4), W(0x1f3246aef82ef3b3), W(0xd7063b8d75e8107b),
+     W(0x2d10617df8aa49a5)},
+    {W(0x4289e2814c9f50df), W(0x0bba8032c0f28773), W(0xf1fcacd3474712c0),
+     W(0x6c33a1cdc2dada8c)},
+    0
+  },
+  {
+    {W(0xc22c22c99a98859c), W(0x2a545804deb71138), W(0xca217a9cf0bf3f48),
+     W(0x0803c5e69f103811)},
+    {W(0x8132052cdf066740), W(0x9754f9cb8993ad69), W(0x2c46615ae5427576),
+     W(0x057d7dc7235bd700)},
+    0
+  },
+  {
+    {W(0xcc95d3ad3ce6db9d), W(0xf4f762b5f15950e8), W(0xc7a4a22e92deaa78),
+     W(0x77ebd0ce6db54968)},
+    {W(0xa1be8dfb70516b95), W(0x68717199e19b0096), W(0x24dcd88fd00ea9b5),
+     W(0x4600de976dfb4f53)},
+    0
+  },
+  {
+    {W(0xa593b6759450e0c9), W(0x8db5a7fa349f2936), W(0x5cb38d13f49b98b0),
+     W(0xb884223a188abe24)},
+    {W(0x8dda04beba44e4ee), W(0x955c3a35a713fc7e), W(0x3ba2d662351cee7c),
+     W(0xde6867a124d2648a)},
+    0
+  },
+  {
+    {W(0xeb78385e4e0b32fd), W(0xf5777cbe03509a1f), W(0x3241228431bf508a),
+     W(0x3d0a46bb87189607)},
+    {W(0x9a66cb6cfd11cbba), W(0x461a1e01bbfc3807), W(0xf796e4ff6c8c829d),
+     W(0x85233b7f916ad75c)},
+    0
+  },
+  {
+    {W(0x7c01753750b18e33), W(0x9d4fb5a50fa7dee7), W(0x396b504a056c8a55),
+     W(0x9804c03808b60b02)},
+    {W(0x2cbab3ac09c90882), W(0x968ac3fa03829c84), W(0x35c7852439924621),
+     W(0x65e2d7db2204ce47)},
+    0
+  },
+  {
+    {W(0xc61899860a9237f4), W(0x395d4a8fa22ec93d), W(0x3e8db1b5c3512e4a),
+     W(0x962101cdfe842252)},
+    {W(0x330121d7ceb76811), W(0x01e479e4168d831a), W(0xd7f6e1529938c3b3),
+     W(0x9ff2fd6a32908348)},
+    0
+  },
+  {
+    {W(0xeccd0a221f59221d), W(0x901e93396ab340ec), W(0xfab38820370f7323),
+     W(0xbf381f23b0948d28)},
+    {W(0x49dbbfd995bc4884), W(0x8371fafbe83fbe06), W(0x378efcc32704e35f),
+     W(0xa38fd57ef6dfc27a)},
+    0
+  },
+  {
+    {W(0xf019583566663f45), W(0x059bfb9f9d308912), W(0x741d4caad7ef5fd0),
+     W(0xf12d3887a93a0ce0)},
+    {W(0x6025ace76471309b), W(0x2e21a216780f22a1), W(0xfc37c0d3880033ce),
+     W(0xfeb45014376973eb)},
+    0
+  },
+  {
+    {W(0x837aa3aa7c5376ad), W(0xc4dc609eebcdcde1), W(0x1cc4135c56a4c0df),
+     W(0xcbbd789166001c56)},
+    {W(0x3f8cf785ee08ec57), W(0xfe31d58cd2b2ff02), W(0xb4ceddee35e4f3a9),
+     W(0x8aa8f1219c728396)},
+    0
+  },
+  {
+    {W(0x1e5d102f6f19999a), W(0x292e09a0396ddd79), W(0x3cb155d6fd57a5e1),
+     W(0x571a19d75b06fcbb)},
+    {W(0x99a3f848a7587990), W(0xde459e51074801e1), W(0xd3c67afde3600917),
+     W(0xbaebb5062105066a)},
+    0
+  },
+  {
+    {W(0x99b3a901a55bd847), W(0xa0d028d55dc9655b), W(0xbd9869ec0b71977d),
+     W(0x7a2f6d3528525c68)},
+    {W(0x4602ec5cbe4ba673), W(0x44f1bd60c5fc0eea), W(0x08991183c3c26646),
+     W(0x74912b8c05e8d990)},
+    0
+  },
+  {
+    {W(0x783a3399d889e8b5), W(0x41e64fa2dbaabdf6), W(0xc400a5cc70ff02b8),
+     W(0x8000a62f02bc0826)},
+    {W(0x49389da79beb6477), W(0x0a100e26425763db), W(0xd368dd393e8d9101),
+     W(0x27f255e85f2581fc)},
+    0
+  },
+  {
+    {W(0x112ec298732c0004), W(0xe609adf67ce03ed0), W(0x1f64f4a344239a3b),
+     W(0xba35d7e973a1ddc9)},
+    {W(0x664e0f20371ad98b), W(0x984de66dbd3d9599), W(0x796e04f6b440b8c9),
+     W(0x2eb9e2c13a68432d)},
+    0
+  },
+  {
+    {W(0x8b3690362f5ddc5b), W(0x39b34608448e9c09), W(0xb4ff0819cc086bfa),
+     W(0x7fca450250989d11)},
+    {W(0xe0ace29f0b599a5a), W(0x427ad7c409c724bd), W(0x81f31f0c8ca4a6f4),
+     W(0xda25eb631b7f8d6e)},
+    0
+  },
+  {
+    {W(0x97f57cf311dd63d0), W(0x527d6440e2c3f32c), W(0x76947639903cba71),
+     W(0xd2c5feec2cd8ffbe)},
+    {W(0x7c3a2ba6124f49c5), W(0x479caaf05808db87), W(0xf85746aff047df4a),
+     W(0x36917158cb645387)},
+    0
+  },
+  {
+    {W(0x736cfe777e18eaed), W(0xdbd66c80e0c554a9), W(0xd12312438e91fdc2),
+     W(0xe90ffd7282c74a5d)},
+    {W(0xa10323cf1ccebe85), W(0x303da7a5dab82409), W(0x49937afc61ac1e02),
+     W(0xbc14bf98bdef0225)},
+    0
+  },
+  {
+    {W(0xcd85469537f84a00), W(0x58eae1954abdff18), W(0x7b3a54c059f1f8f3),
+     W(0x47ebf673272124da)},
+    {W(0xba801b359222da02), W(0x6bd22c71036157c8), W(0x30356aac94eb8062),
+     W(0x4c02312a77fe41bf)},
+    0
+  },
+  {
+    {W(0xa35837ff9ef1a759), W(0xe4de40a9663f3a3d), W(0x0373f7af0aec838b),
+     W(0x8b9c2393c6c436d9)},
+    {W(0x6363b92955cf606a), W(0x30160979e92ee055), W(0xb70c7da293c785ed),
+     W(0x6184e4454144b8cc)},
+    0
+  },
+  {
+    {W(0xc0b44016318789e0), W(0xcb9b48c293244700), W(0xad12f077e64efb3a),
+     W(0x9d886d8c2e162eaa)},
+    {W(0xb457ffdfd04d9d04), W(0xfdf06a435ccd04b3), W(0x68147e281e7cdb94),
+     W(0xc3167997fff79cce)},
+    0
+  },
+  {
+    {W(0xb88f4ff535d4672d), W(0x1ab7755854c6387f), W(0x771fe0495532f3ee),
+     W(0xb736e8a9464c2029)},
+    {W(0x34a5c6db282ac25e), W(0x445172fb798a4c46), W(0x7da9137aee2fa730),
+     W(0x01df4bd98c3c27d9)},
+    0
+  },
+  {
+    {W(0x86698ba8152a343c), W(0xada77932a99a21a8), W(0x45a7200a5616938e),
+     W(0xc9186e06205a6131)},
+    {W(0x372cb50bc6912c8b), W(0x8826212dd87e0b63), W(0x4a80f1a4788e0092),
+     W(0x864ac23b009ba862)},
+    0
+  },
+  {
+    {W(0x3ab5b551729ade20), W(0x9c16c955171d854a), W(0xa665ee1b5e90a24c),
+     W(0xeacdaa95e531a7a4)},
+    {W(0x19151defaf252e82), W(0x6a0cda0ee86e0fa7), W(0x799dd56d4ef3e8f8),
+     W(0xf4202de283c67f54)},
+    0
+  },
+  {
+    {W(0x44bacd43779aa7a7), W(0x9bbac4ac09082324), W(0x359b8f9f58136c13),
+     W(0x05df90b23ae26b31)},
+    {W(0x0eb250de51c837ff), W(0x0aea2e495870329c), W(0xe4921e57aae12b6d),
+     W(0x2f0103f1a4de35de)},
+    0
+  },
+  {
+    {W(0x137a386b3055b2d8), W(0x025bbf322402408c), W(0x2c2ad64a46e8afe3),
+     W(0xdce8e6d1e3834dc9)},
+    {W(0xe8d5a8891d7a2a51), W(0x920a7c02d379f78d), W(0x66810d132f29add1),
+     W(0x720e93ed4d84d169)},
+    0
+  },
+  {
+    {W(0xcf4e4410ac31404c), W(0x1aa99693b130be51), W(0x6078f78de2aa732a),
+     W(0xb3c79076e86eeeef)},
+    {W(0x019c414abbf1fdb9), W(0x1536d0d89aa7c62e), W(0xb0f89000884108d1),
+     W(0xff885dcd25577f5c)},
+    0
+  },
+  {
+    {W(0x23cc5411225ff4ea), W(0x3deeaa71b637d991), W(0xe1bd66709a8b166d),
+     W(0x2fbc180d2594b090)},
+    {W(0x0d9dd5ca2e9fc1be), W(0x0ae634cb129ff7a3), W(0x908e96d566b35033),
+     W(0xb6a9cc7ba9da358a)},
+    0
+  },
+  {
+    {W(0x8befcc6eee67a432), W(0xc4476d09c7e9f090), W(0x06734b51b9ad4d5d),
+     W(0x63def971c71767fe)},
+    {W(0xc86e86ff7332d6f4), W(0x69186bd6c7bfa5f5), W(0x30ad389a8e213871),
+     W(0x643b85b232536e7c)},
+    0
+  },
+  {
+    {W(0x5e43c6db2902208b), W(0xfb69e8a24713f6a2), W(0xdaf99e7979868a28),
+     W(0xe8883f3850f4d9fe)},
+    {W(0x31503f8c38590371), W(0xc2685e9eb2471881), W(0x2bedcf495325f858),
+     W(0xf2f7a8567ee29da7)},
+    0
+  },
+  {
+    {W(0x066ad9b62de39ec5), W(0xb66d95c178a4bd72), W(0x7d25b3702766469f),
+     W(0xcb775e0ab0d70488)},
+    {W(0xa3acc7cbfaf445bd), W(0xb658dee266e610b6), W(0x7a8c13cf1b741190),
+     W(0xb39cc176e064e371)},
+    0
+  },
+  {
+    {W(0x8424ad8b7aa20181), W(0xbef8b248d76acd94), W(0xd64c780c254f38f1),
+     W(0xf4c1da237c60d005)},
+    {W(0xd12544ff9d5da214), W(0xfc16585aa5e01a76), W(0xdf2257ecb2350c17),
+     W(0x20fee84ef47bb365)},
+    0
+  },
+  {
+    {W(0x2208dff36c256f12), W(0x8de5f394b58fdbfe), W(0xd73b550f4ea79cf7),
+     W(0x012b5904615f81e5)},
+    {W(0xc1174982bb99722b), W(0xdcd14a9d1c5c6b47), W(0xe4ab550b5565c782),
+     W(0x0f45b6e85fa0fa63)},
+    0
+  },
+  {
+    {W(0x8b41961af5f87ed1), W(0x0128561cc0b73969), W(0xc119279d563e485b),
+     W(0x280e5166e57d258e)},
+    {W(0xd4a4653939070ae6), W(0x5ea8ef40afe5932a), W(0xc954ecf3ea5cccbb),
+     W(0x10c957c652a95ba8)},
+    0
+  },
+  {
+    {W(0x53e1bbb35645b21e), W(0xcf75b2c684c78107), W(0x8184770d77957398),
+     W(0xd78d130387f23d22)},
+    {W(0x19c0dc0be0b59c12), W(0xaa4ae14aad115387), W(0xbde31537077d2a90),
+     W(0x2e889d520a5c0c8c)},
+    0
+  },
+  {
+    {W(0xec29982e7b597539), W(0x3b1fc8d8d9ffa221), W(0x89fd4fc9ac2d9660),
+     W(0xda17652192ad18d3)},
+    {W(0x289c111689488dc7), W(0x279773d837e24e82), W(0x273c6f419dedc3b7),
+     W(0x2ebcbafa4d7e1295)},
+    0
+  },
+  {
+    {W(0xb097c70c6837d13b), W(0x3e9570d8c17393a7), W(0xad3913996b5b0233),
+     W(0x2e3a272f9c28f7e9)},
+    {W(0xecdc67f585fccd0b), W(0xbe3bf7ed6123e406), W(0x308ca254a186b827),
+     W(0xa11da9dd1d94114c)},
+    0
+  },
+  {
+    {W(0x10b7c3e44e50fe72), W(0xefa2fd66be958dd7), W(0xf6f51dc8eb6376ec),
+     W(0x756d8dfb3e5edc20)},
+    {W(0xf8d9ccc486050b4e), W(0x36ea9e12c2aa26f8), W(0x12c43077f19722fa),
+     W(0xdd57eef4500ea5e6)},
+    0
+  },
+  {
+    {W(0xd6e62fbd72ec3338), W(0x78f4dbac55398a1f), W(0x38dfd42fc2083836),
+     W(0x58d1df620295e552)},
+    {W(0xc388a1cc077addad), W(0x8560b6f3e7a886e9), W(0x96bbc6519bff234b),
+     W(0x9ae0dd81bca090e7)},
+    0
+  },
+  {
+    {W(0x8f5764486b478328), W(0x6cd0c0c21cf38326), W(0xf472f8223d5dc181),
+     W(0xfdb413d761245df1)},
+    {W(0xcb1b6c56cb79d64b), W(0x5404e092b28dc734), W(0x2c73d19182b2e81f),
+     W(0x6c898fac5727f5e4)},
+    0
+  },
+  {
+    {W(0xd4dd578c224ce644), W(0x062e8b6a7750aba3), W(0xc63b4e091c2f0b42),
+     W(0xf2ca5a291b7de4a4)},
+    {W(0xd13c2d392ee3c069), W(0xad5a2f619303d007), W(0xb7ce0b6b513e3a54),
+     W(0xf5ff40e4d708db26)},
+    0
+  },
+  {
+    {W(0x37635979e4d35c22), W(0xfc285d5ffe374c2f), W(0xb7615a4b32552ced),
+     W(0x00af8cfae3cb9f3a)},
+    {W(0x86a1459e2807a842), W(0x6ed7586e1362791c), W(0x77e58da7aa95ee02),
+     W(0x695749b95f1e104f)},
+    0
+  },
+  {
+    {W(0x9c23b5dc706da6c7), W(0x03fb642051548401), W(0xaf9b69eac7b13774),
+     W(0xa8ffe7147ee8169b)},
+    {W(0x214afa74d1eb5621), W(0x9b1452b3a97682a0), W(0x692e7e1c4193b2a6),
+     W(0xaae7ac2dc8dbba4b)},
+    0
+  },
+  {
+    {W(0x274bf70638313062), W(0xb3149a050159a156), W(0xa3456ae0125e650d),
+     W(0x0f029b432c5627ce)},
+    {W(0x091e5855e6936584), W(0x1d74c3b78869b570), W(0xcf58a1a29b009ac4),
+     W(0x7d5fe9f27d252778)},
+    0
+  },
+  {
+    {W(0xaca6bd97fd82a3d4), W(0xdbe9f9f298220af3), W(0x0324f79597c2dedb),
+     W(0xfb3e58ec7e52cea0)},
+    {W(0x828c99110fac79ba), W(0x3def65b2c0e368cb), W(0x3159cf35b31b8e1e),
+     W(0x0880bc829e203754)},
+    0
+  },
+  {
+    {W(0x54fc97ccd0f36d70), W(0x2c11f21e1dfbf91a), W(0x4d8d46f217a883b3),
+     W(0xdf7d557e67710bf1)},
+    {W(0x9c34760e9d4252e0), W(0xbc3a91e88abbbeec), W(0x8044559331492070),
+     W(0xb8c801b90afcb14d)},
+    0
+  },
+  {
+    {W(0x289f99dce3749209), W(0x1281d4238f7157ac), W(0xdd630cd37234e168),
+     W(0xbf06240438963a17)},
+    {W(0x2766cbfaf0c589ad), W(0xffbaf63f4727d514), W(0x58907296e0547405),
+     W(0x7a761bd6c26c892a)},
+    0
+  },
+  {
+    {W(0xa7825511fdd043d7), W(0x7aba68d413498244), W(0xe71c0dbcdce03c12),
+     W(0x525fb599f7b47604)},
+    {W(0x284a9b94911bda84), W(0x7726f2b26fe369a0), W(0xd640519a590ce8fa),
+     W(0x3ff3bfbfddc19236)},
+    0
+  },
+  {
+    {W(0xe4d8263ab76732e0), W(0x6fa42ac894172dd8), W(0xbe061bad65c706d5),
+     W(0x59dc9c645526a4a7)},
+    {W(0x0caa1d5bdf8bce87), W(0xc750d01982c9fa00), W(0x4a22129ca9531693),
+     W(0xd6d169c16d1d2d53)},
+    0
+  },
+  {
+    {W(0x2fa412c45d7f93e3), W(0xb2667fc97edc8389), W(0x860f467ac3e5f255),
+     W(0xd86f706d2a36d02b)},
+    {W(0x347dfd9f5fa8bbba), W(0x5208903083e9d4d5), W(0xe8f4117c469e5940),
+     W(0x0b8e98f9de387d79)},
+    0
+  },
+  {
+    {W(0xcb4dbcac14c9e3fd), W(0x0bdca1fcfad35e17), W(0x80dfed7b8e723cf6),
+     W(0xcb69371b7a9021f8)},
+    {W(0xa2145e77ee9c9657), W(0xf26ac2bd8f3333ed), W(0x9b04ccc709551d99),
+     W(0xb211b002e018f630)},
+    0
+  },
+  {
+    {W(0xfb484d734c9159d3), W(0xf1c362015067cdcf), W(0xe8c8f40367cb22ff),
+     W(0x5af6375ccad65ab5)},
+    {W(0x43e85508f3217af1), W(0xfd39f962aa62ab51), W(0x875a9f80fe87b146),
+     W(0xfc76fb02f775364e)},
+    0
+  },
+  {
+    {W(0x5da45b7baeae9305), W(0x1420abe920648a02), W(0x2bbb4b0733641f8f),
+     W(0x44e1eae7bab91488)},
+    {W(0xda464a20c6548b25), W(0x5d54e4a89fa2d364), W(0x3ab89ca41d347b20),
+     W(0x77922efb37548069)},
+    0
+  },
+  {
+    {W(0x1db0abf2bbc8f03c), W(0x9a089cd3f8e316d6), W(0xa8db39d4bf908cc9),
+     W(0xe1b675ba17c12b12)},
+    {W(0x3489a26da912cf39), W(0x7e40d5bd683d0e6a), W(0x81eed8be06a87ca4),
+     W(0xa78f592a37388bdc)},
+    0
+  },
+  {
+    {W(0xf1343c1a2b74427e), W(0x91d91fb15c2c7de1), W(0x9c74d685926d527f),
+     W(0xda29e81c66ce161d)},
+    {W(0xdd98c42d6750f894), W(0xd58e167713e78512), W(0x29329fd9acccd0c6),
+     W(0xf076dca0c931060e)},
+    0
+  },
+  {
+    {W(0x5fcdccbb280ffa80), W(0xd21e8d9033da2465), W(0x8003dec1d73ae100),
+     W(0x44907021c0b95219)},
+    {W(0x90ec376208111ee1), W(0xd5c83fb453efd84c), W(0xfcd0a93247856f0b),
+     W(0xcb7317fe0ac9fca4)},
+    0
+  },
+  {
+    {W(0xf676fe8dfa8aa543), W(0x941f17b6ea19e45b), W(0x084f7d0b1d60f723),
+     W(0x7889b3a2e1d679e7)},
+    {W(0x20a618dbcaa23bc2), W(0xb24e77be7a55e6ab), W(0x01916d3f04b487eb),
+     W(0xc5aa2d773f82cd47)},
+    0
+  },
+  {
+    {W(0xaeed1361edac4bdf), W(0x382037da280095db), W(0x846627290e3a77c1),
+     W(0xc5b09c0d7cb3eab6)},
+    {W(0xb9d5a2f297555ab6), W(0xac9b99563f015cda), W(0x2d32d87d1c2d5b39),
+     W(0x2a4127035c9e0282)},
+    0
+  },
+  {
+    {W(0xbb8b33ffa678066a), W(0xca9477a5dee70896), W(0xf1e659f513476ed2),
+     W(0x859c19798b8301b0)},
+    {W(0x8db82d0ce3f4f033), W(0x3fae187db5b88884), W(0x146e4f64c26dd780),
+     W(0xfe9f5325d1637676)},
+    0
+  },
+  {
+    {W(0x1fc8455f8ffb702d), W(0xaf0cb7591aae6acd), W(0xc6f7851934f051d8),
+     W(0x4f2799e50c6d8fb7)},
+    {W(0xda9258d5eb56f621), W(0x57028af9e8e1c3ce), W(0x8d7318a90597ce28),
+     W(0x202d70b13e810be2)},
+    0
+  },
+  {
+    {W(0x785e143c0d040d3d), W(0x078d34166557f827), W(0xed1b34402124459b),
+     W(0x9aec83bb07a0aea0)},
+    {W(0xfdb34337ea3fd34f), W(0x0c1cd835f9b49d4d), W(0xea5f3bd60acd7a7b),
+     W(0x1f8d42dd306dae17)},
+    0
+  },
+  {
+    {W(0xe972b62c30ab1270), W(0x3dce8c35ae8a14c6), W(0xaf90076af0550d89),
+     W(0xffe759ee691534e8)},
+    {W(0x21d297c912eb304a), W(0xf8c76f9e3c4a5c98), W(0xcae33abe852e96cb),
+     W(0x5a3a4ec6c1871650)},
+    0
+  },
+  {
+    {W(0xd6f9d84a222fc24a), W(0xce04951e989ddc49), W(0x7acbbda6c74708fd),
+     W(0xc7a0ec98d29d67ef)},
+    {W(0xc0ba23fab899db68), W(0x9772aefea837a956), W(0x323211e539c74b6c),
+     W(0x9675718258e1d05d)},
+    0
+  },
+  {
+    {W(0xf7f82c02cc2b9dbc), W(0x94e1f5e576faad5f), W(0xa3e905a627986cc4),
+     W(0x045012cc7b7c1997)},
+    {W(0x15c01c199a51f30c), W(0x79fa0db5e07794d4), W(0xd1c34bfe11b2bed0),
+     W(0x90caf46903d5f76f)},
+    0
+  },
+  {
+    {W(0x3875b76f9dd26733), W(0xe82784b8f8f7c12e), W(0xaf613d2f989a83da),
+     W(0x542b079f02b8965c)},
+    {W(0x9ea870cf92776f52), W(0xce13ba04c4fe57d2), W(0xce1695515374b494),
+     W(0xbd14ce0895224f2d)},
+    0
+  },
+  {
+    {W(0xbec0de5804add470), W(0x3f3ecce52be9e40a), W(0x55fdb77fa25e1288),
+     W(0x45eecba632a2077f)},
+    {W(0xfd7e353620bca984), W(0x2de62a21ad24b472), W(0x456a9dee8de2e35a),
+     W(0x874a4aaee80deb36)},
+    0
+  },
+  {
+    {W(0xc01bd4231142b0a7), W(0x09f683202a531d42), W(0xcf99c4f78e991e37),
+     W(0xdf02d2f57850ccf3)},
+    {W(0x3ee074b7b2e9c640), W(0x8039c621e6d11644), W(0xaf5e440c0f1900ac),
+     W(0x1b94dabfbed5a67c)},
+    0
+  },
+  {
+    {W(0xba394115cdf56a8c), W(0x4f68412d9312c03d), W(0x05aa7e89f94844d9),
+     W(0x1d80b9457b6b1324)},
+    {W(0x71962950fc57f489), W(0xbbb60cf5a5ebb779), W(0xf9af2897b58190b6),
+     W(0x1db5317a30f87c9f)},
+    0
+  },
+  {
+    {W(0xd11beab01bc8b802), W(0xcdb45833e380044e), W(0x4979ec4ba78e223f),
+     W(0xcaadba13d85739b9)},
+    {W(0xd4e838d2100624d9), W(0xac7c300eb5eaa22c), W(0xc15eaa8696f10199),
+     W(0xa68ac38cc9538d04)},
+    0
+  },
+  {
+    {W(0x76b6b7e2944d0e14), W(0x1ecb8a1611483df9), W(0x7aebf83f4ebf888b),
+     W(0xff8dbee4589671b8)},
+    {W(0x85554ce5468e645d), W(0x4ee97bcf5b43b8aa), W(0x7aadbab08c563108),
+     W(0xb85b7c795b317b56)},
+    0
+  },
+  {
+    {W(0xfa9762bafc57f947), W(0x25dc24a022a6fac5), W(0x90c349322df6046c),
+     W(0x1b8e2d16cbf0df06)},
+    {W(0x897c33a30a7448fe), W(0xb12b513adb0952d2), W(0xee8a19bddeeda090),
+     W(0xf3b37031d0acbcbe)},
+    0
+  },
+  {
+    {W(0x6967c7be0744855a), W(0x3b3be0219fd6ad64), W(0x4e7fd5ea546a6432),
+     W(0xa705dbf0d121f5b6)},
+    {W(0xd369249f6be9cf9b), W(0xb0e9a9319f74ecde), W(0x4acdf9923271cada),
+     W(0x2411f3215323b456)},
+    0
+  },
+  {
+    {W(0xfa6f06bb74d597b8), W(0xa765e700c4ed3f2d), W(0xbcc0fa9e5ec2ead6),
+     W(0x121579d4f9d0e59f)},
+    {W(0xe5dac27ee4c6d0c3), W(0x76d00d4b28f831fa), W(0x280f1ad861bd04c2),
+     W(0xc92bf9b018db1d29)},
+    0
+  },
+  {
+    {W(0x3fe48a14e0dcb027), W(0x8a7cc2acceec6ac3), W(0x18d586dc90c3d84f),
+     W(0xe0e0c9591c8d3b13)},
+    {W(0x2a7b2e5ecc897e48), W(0x4026c1a9c700f787), W(0x7f9aeaed9f5191ec),
+     W(0xd669f29f2f0ae042)},
+    0
+  },
+  {
+    {W(0xfd47709f37f57c19), W(0x1337b028228cb7d0), W(0xbd824ba0da53d7eb),
+     W(0xe9d8937361270d84)},
+    {W(0xa5e2ecf61ac26651), W(0xa1559f1792351026), W(0xf353c60cd1e0caa8),
+     W(0x8588e54fcfc349e9)},
+    0
+  },
+  {
+    {W(0xb246c693f47c6772), W(0x8a38372b48d01d18), W(0x71522db34cdb70c3),
+     W(0x2d2e105209da45fd)},
+    {W(0xc06ece273d295383), W(0x2fc6de16a66443a7), W(0xbe6ded0c7fe6a09e),
+     W(0xad5f0228842abaec)},
+    0
+  },
+  {
+    {W(0x4ee7ac2bbe8cee52), W(0x16404975a45c7717), W(0x71b87a541f63bcda),
+     W(0x00d3362991c3e2e7)},
+    {W(0xcf5addf8816bc994), W(0x76c94c9c18876d82), W(0xcbaebcf64814e47c),
+     W(0xaf2c938c26e9a250)},
+    0
+  },
+  {
+    {W(0xd2db3bef149bb4f4), W(0x24865341a74f45a6), W(0xff28382853d1a2da),
+     W(0xcf109eb0484f42b0)},
+    {W(0xf504bac25bf9c79a), W(0x4cdf7a7b7b0b8f49), W(0x6057bb416222c9ef),
+     W(0x0af581794326c1c2)},
+    0
+  },
+  {
+    {W(0x86a30bdb1d3e8b28), W(0x08d374fb64c93ad2), W(0xe622bc7cfbf32f84),
+     W(0x4a3c84486cf62381)},
+    {W(0x2a9a75e062fb102d), W(0x1260cd3c2b324988), W(0x3419704054de2a2c),
+     W(0xafc331ecd916d05b)},
+    0
+  },
+  {
+    {W(0x4cf7a0bbeff8fa8e), W(0x0a57cdada092d43f), W(0x3ece3fc6e6c2eeea),
+     W(0x801d9aee46159f63)},
+    {W(0x8172ea76723dba93), W(0xd0853363c0d287f0), W(0x8da136640207eb95),
+     W(0xcc2966ca1a519c4b)},
+    0
+  },
+  {
+    {W(0x0a9a4b9dee888bd1), W(0xc95be2d46fea28e2), W(0xdd7de97aa2d83e75),
+     W(0x2b99c791473e1a53)},
+    {W(0x261e23c8364af6aa), W(0xec3b830299ab8bd9), W(0xfbd155ffe2adf918),
+     W(0xbf99f3cc837fbd83)},
+    0
+  },
+  {
+    {W(0x18994009c36c30cc), W(0xe33732b852ed50ea), W(0xd246f1f546a69b2b),
+     W(0xc336a6ed67194f6d)},
+    {W(0x8ef289099d215feb), W(0x832e23c4e14532ea), W(0xc7e96934844f9f8f),
+     W(0xfc953f472e08b938)},
+    0
+  },
+  {
+    {W(0xd14972573c930c7c), W(0x33ca6b7286fc5d36), W(0x20f8563b639192e6),
+     W(0x6e95f09620715167)},
+    {W(0xbf298ad52c9596b2), W(0x40cf05ae5fb2563f), W(0x878e286bc3dd499e),
+     W(0xe88589ff703c1e2c)},
+    0
+  },
+  {
+    {W(0x20b97f0d0ffdf826), W(0xcfb417b53809f847), W(0x25fd8831269f3da4),
+     W(0x12086357c1796cb0)},
+    {W(0x43dceeb3f5f4ade9), W(0x1b96c0d4daa057bd), W(0xe9c435976b8e25e4),
+     W(0xe8b4e7655d3e3eb9)},
+    0
+  },
+  {
+    {W(0x28981611b024a540), W(0xae4186eba9ddf942), W(0x19d072c366d8987d),
+     W(0x304c9dfc8a7df6d4)},
+    {W(0xa5a1312edefa2d07), W(0x6fd5f898c4f73d62), W(0x3f23762f40a67d6c),
+     W(0x43b85ce5fd62ffe5)},
+    0
+  },
+  {
+    {W(0x7b09d0fa0e9e7de3), W(0x11871ccee48d19ef), W(0x3a6feb7e66bf6e4f),
+     W(0x1e080fd5d9960673)},
+    {W(0x90a42c4e338ce230), W(0x0647f8069ea5963a), W(0x4927cf5b71e7179b),
+     W(0xf2f3bf529a2dc3ff)},
+    0
+  },
+  {
+    {W(0xce8a1d579dd9b8e1), W(0x33f6da623bf9a3ae), W(0xc372633874afcf3d),
+     W(0xdb2538df58aba61e)},
+    {W(0xeb6718dfdcee4535), W(0xd7615738104756e2), W(0x3cd03295b61752e5),
+     W(0xf4f4006a45e36227)},
+    0
+  },
+  {
+    {W(0x6cbdf822b19d68ca), W(0x9e588e4875162a3f), W(0x2f88076bec2f0e3c),
+     W(0x44c1459945e78558)},
+    {W(0x43e5b8453c04f8cd), W(0xc8304a8d357ad9f7), W(0xf0f56cecc6cb6f4c),
+     W(0xba88832d1cecbc40)},
+    0
+  },
+  {
+    {W(0x888cb9b72fbb5b6d), W(0x60965fe37406f0bc), W(0x30862da5982d9c3f),
+     W(0xf96d7639b0e3f9e8)},
+    {W(0x3b2feb2524cefc4e), W(0x2c16dcf92b72cdc4), W(0x06f3189b127aad13),
+     W(0x401bf41eee2bc326)},
+    0
+  },
+  {
+    {W(0x9e95987dfca36785), W(0x0fbe17de488e6dfc), W(0x3971afb122ffbad5),
+     W(0x19c72bc4054c713e)},
+    {W(0xcb101063af54aa48), W(0xbe5fc06ea070c563), W(0xd379ee30ae10721c),
+     W(0x9f0026f8a1605f2e)},
+    0
+  },
+  {
+    {W(0xa1af929ee6ef9fda), W(0xbdf4eb594fbedaea), W(0x88205ef0e5e72df8),
+     W(0x64fc607e3a991312)},
+    {W(0x6182685750497dc0), W(0xc9a93cf2f2dc764d), W(0x8a7927068bde03a5),
+     W(0x4c9c2166fcad6dad)},
+    0
+  },
+  {
+    {W(0xa15e4e5c29e62c70), W(0xbf92cb9c064b66b0), W(0x9b403506f7ea0c37),
+     W(0x54876409cce4b6fa)},
+    {W(0xaad926d1daac5276), W(0x3cd9ad2951f93ad0), W(0xff92ec4ce195348d),
+     W(0x6a097c0d08d13459)},
+    0
+  },
+  {
+    {W(0xba7d63b3faa92609), W(0xef6517d06035b582), W(0x94209aff3c97a4fb),
+     W(0x51bbec27b0e2c22d)},
+    {W(0x206bf9cb33debac4), W(0x6d1244f3d7d020de), W(0xd3f45d8cff3fcedb),
+     W(0x39240c693b508a65)},
+    0
+  },
+  {
+    {W(0x05480694a2914fb6), W(0x1f6c9d575a644e22), W(0x7736ee8f1ac164e4),
+     W(0xcafde494c4d32332)},
+    {W(0x331af909591dc8ab), W(0x637e11a1cc515567), W(0xfe5f1660c7726f88),
+     W(0xc63bacbf891ce818)},
+    0
+  },
+  {
+    {W(0x5d90073120975147), W(0x48214a044634cb44), W(0xa352cca8313fef01),
+     W(0x1e10e338e66ea9e1)},
+    {W(0x453f82522627ad5d), W(0xd50f7edd1ab685e0), W(0x33a5e028aed945d6),
+     W(0x7cd87ff5d1be411e)},
+    0
+  },
+  {
+    {W(0x2db7ee7693afc8b2), W(0xdd038dfd4d28176d), W(0xd432e6b887ffbac2),
+     W(0xe725e7e03f1f415b)},
+    {W(0x6ac088294092739d), W(0xdc5bef7b4726f7e5), W(0x780fc0bb321deae2),
+     W(0xe3eda2fb1b043654)},
+    0
+  },
+  {
+    {W(0x483d770862c0d578), W(0xda5173718bc4b8de), W(0xaa3b69e384aefb09),
+     W(0xcc11cf32c88a4033)},
+    {W(0x26787be201f4fd55), W(0xda3c8614ceedfc36), W(0xc1888ed4fc9c7174),
+     W(0x8d12fb0ff04e0c70)},
+    0
+  },
+  {
+    {W(0x19ce7350aa082ca5), W(0x51101b9430000151), W(0x3c580466684a0fff),
+     W(0x22ed47d05d3720a2)},
+    {W(0x26283386cb1a5dd7), W(0xea850de65c3079fb), W(0x76e09fd7813c7b30),
+     W(0x60c09db654dd0630)},
+    0
+  },
+  {
+    {W(0x53bce775c79eb94f), W(0x20a5b20de4ec1e8f), W(0x8aa65b1ba7d05fab),
+     W(0x381dc8414f30ffb4)},
+    {W(0x9a58a7da3412143e), W(0x4d2abb95327992ba), W(0x9ea559cb18e2121c),
+     W(0x6be88b58737837a3)},
+    0
+  },
+  {
+    {W(0x11b9c98a97fb81d2), W(0x80b4b4ae184def97), W(0xe6fec6b84f11fb39),
+     W(0x09a2c9835ee5215a)},
+    {W(0xa4610c0126b21e8a), W(0x655ba9c0dffab5a4), W(0x4dd28a25a1c95491),
+     W(0x1e6c91adcb578ca3)},
+    0
+  },
+  {
+    {W(0xf79f1184ec96b2f9), W(0xe2d1be167b2e4dcd), W(0x9eb2d4f33b82cb83),
+     W(0xcc085c1e30b1360f)},
+    {W(0x1c3eef2fb0ff11ec), W(0x392f3565a80d51e4), W(0x228522142972394c),
+     W(0x2846ce8c682022e1)},
+    0
+  },
+  {
+    {W(0xede18e0efc32856e), W(0x185a897f8653d5fa), W(0xc774069d4386fb7c),
+     W(0x32332ed94d78840a)},
+    {W(0x27d1896d8fd528e9), W(0xd547019656e44bd7), W(0x736d2d2a6959d3b7),
+     W(0x68f4d7910536cd3d)},
+    0
+  },
+  {
+    {W(0x690e0ad76a33b0d1), W(0x91de718338376af6), W(0xeae51a5370b7de45),
+     W(0xe3c0b03ed9e456d5)},
+    {W(0xe59cbfce8474496e), W(0x55970dafda781aa8), W(0x9a5dcf4f2c6be02e),
+     W(0x7f004c063754822f)},
+    0
+  },
+  {
+    {W(0xb1910b88daf0e9bb), W(0xf1c825fd1e7f6750), W(0xcc5e5c39fabaffee),
+     W(0x86147c5fd61b940c)},
+    {W(0x0628d51fe8ed4c42), W(0x382a9be059341a2d), W(0x82658f35445543fc),
+     W(0xa9377861784520f6)},
+    0
+  },
+  {
+    {W(0x203103ccabe9eeba), W(0xc0bd3303ca604ae7), W(0x2c0c24be2bb6e835),
+     W(0x3cebc864d9d34087)},
+    {W(0x7ee98a24cdea4335), W(0x702ecb92001867e7), W(0xe5a3993e3dbaad75),
+     W(0xbac6dfd6798d4c4a)},
+    0
+  },
+  {
+    {W(0x84a114dba3715471), W(0x91394c7d575597d1), W(0x47cb77a672191c43),
+     W(0x85c2058b4d1fcf6b)},
+    {W(0xed2888271d43abfe), W(0xe08dfb5dcf910bc9), W(0x3fd698e1fe556c4d),
+     W(0xe501043b882dae38)},
+    0
+  },
+  {
+    {W(0x67059b3acfe80e33), W(0x9ea8d2de754b693a), W(0x0bef27cb10003660),
+     W(0x66300b239e5d4733)},
+    {W(0x2e102ca3ff633c01), W(0x5eccb2b69954b4e3), W(0x0b5690d80437e125),
+     W(0x7fd36c6d406685ff)},
+    0
+  },
+  {
+    {W(0x511bc66127d63a0e), W(0x692d2ff35c91eb66), W(0xf3bd3ffdd25c84fc),
+     W(0x089685adcc2bdbc3)},
+    {W(0x385558eac73c7ddf), W(0xe5c2665c7e4d2408), W(0x12dd013462550f80),
+     W(0x351dd9916416f866)},
+    0
+  },
+  {
+    {W(0xc321a049003f2078), W(0x9698b37762e32f5d), W(0xf08605c8ce8a1a2c),
+     W(0x7823404d6c529695)},
+    {W(0x0c24613006e4cdcd), W(0x23e66fb6c2adfc24), W(0x7e1f06282f78fa82),
+     W(0xf175b27ca543d29e)},
+    0
+  },
+  {
+    {W(0xf41d3af832ee3d8b), W(0xefb28137bcb8811b), W(0x4c9ea004b414021d),
+     W(0x07cee4f266d8cd39)},
+    {W(0x412ba3e10b44ef61), W(0xf8c249d5ce521753), W(0xffc020ba4926cfcc),
+     W(0x300062c611c9a90c)},
+    0
+  },
+  {
+    {W(0x62ab05532eb49eea), W(0xa4b9fd42d848e333), W(0x239d4ab14e9371d5),
+     W(0xb78a684715e85f74)},
+    {W(0x39702158474aa2fb), W(0x5df66aae31f6c2b8), W(0xcd580f20d0fb7f86),
+     W(0x0b4c49259ca9d4fb)},
+    0
+  },
+  {
+    {W(0x9a0e252ee87edd1f), W(0xb796bf8d7c132a08), W(0xba14208cf24eb423),
+     W(0x2aa39bf797225687)},
+    {W(0x416ea559ae68e9f9), W(0x3cb0780cb71de654), W(0x78c70f2815b280e1),
+     W(0x9d2b513b903f50c8)},
+    0
+  },
+  {
+    {W(0xfdb58a95d6c433d5), W(0x3b3ddd7a7fee3ce1), W(0x36d53a2f9777c22f),
+     W(0xfbdf18d4cc55d867)},
+    {W(0x08e8ea988a188e21), W(0x71e83941321d52ae), W(0x281466612ef3473d),
+     W(0x195e8ea921284609)},
+    0
+  },
+  {
+    {W(0xfdf7e571c3de9ef6), W(0x36d0bd584d1d04b3), W(0xff0100ba451cb25b),
+     W(0x4ee7cd935e43171a)},
+    {W(0x8a57741b898deab5), W(0x95418dea4f96398a), W(0x6a2df2f6141de96b),
+     W(0x8a163a64e9ec0425)},
+    0
+  },
+  {
+    {W(0x023e62fe7b0ae384), W(0x483adcd503af008b), W(0x0c96588058d8c8b5),
+     W(0xd4c32e5668044285)},
+    {W(0xe48c4d8bb6b0f81f), W(0xa85dc2bc37c9ad88), W(0xae7a7e8731bbd04f),
+     W(0x5b9089d6bb7ef3b1)},
+    0
+  },
+  {
+    {W(0x58d191476c1b3008), W(0xd303ba23fcfcaa54), W(0x5f352ade0f03f6b9),
+     W(0x60ca57ca49c5e8dd)},
+    {W(0x6bcabb2230ab1471), W(0xc2b70ea716367432), W(0x92541d0fbd9c8cbc),
+     W(0x0a13651d83305530)},
+    0
+  },
+  {
+    {W(0xf65e083a046ac451), W(0xd1332d3546e758ac), W(0x5faca74db3952d04),
+     W(0x1ad74dcb19138753)},
+    {W(0xc78a94f245019ad1), W(0x621b9bae45f5192c), W(0x7f5a9b5f13719203),
+     W(0xdc49291c5a872a41)},
+    0
+  },
+  {
+    {W(0x892b84b3d53621b8), W(0x1fd39da507a0b796), W(0xf7b59c90c6dfdf26),
+     W(0xf82755f3467d768b)},
+    {W(0x79601461b5f15dae), W(0x8d968c7a6a98a258), W(0x950954448c66cf56),
+     W(0xd2a2a571395a2d46)},
+    0
+  },
+  {
+    {W(0x361e49028bc7c088), W(0x1d3f35bcf6d868c8), W(0xa153fc939ed984c8),
+     W(0x4826bf0045b60176)},
+    {W(0xb6d73ec979d4a1c1), W(0x232d0f60af5111cd), W(0x5e3cbf23daf7eced),
+     W(0xd1988c9efc7a5f50)},
+    0
+  },
+  {
+    {W(0xee074fad019b28bc), W(0xdd6d662fb7549d28), W(0xb8f194b24d0a9c55),
+     W(0x5eb01ca73fd46512)},
+    {W(0x9222c05755031a06), W(0x532c85ed0df34e0b), W(0xe69119cb9df07500),
+     W(0x50977385ed7c1c46)},
+    0
+  },
+  {
+    {W(0xc4faa0d15fa14800), W(0xf7d000250bd40eb2), W(0x5897b9cbe70efa14),
+     W(0x828b2250ea193a7c)},
+    {W(0x3f9979425f926a8c), W(0x46a667a158969268), W(0xdeed9137335d88af),
+     W(0x950efe1146066968)},
+    0
+  },
+  {
+    {W(0x611d6de37a3de54d), W(0x13402e98a2f6c2b2), W(0x044d0784729085ab),
+     W(0x469e7911a731b270)},
+    {W(0x79f79c976dd3d3c0), W(0xd4a6916a5884bd2a), W(0xae20ae9a20898d57),
+     W(0x2a413a7ee6e9a2d0)},
+    0
+  },
+  {
+    {W(0x381572a03074b9e7), W(0xb401048c2b564f94), W(0xa6e7815959882d22),
+     W(0x29ab72f9f18087ea)},
+    {W(0x103467916e9578a2), W(0x8ae5a9661f1601ae), W(0x4bf58041fd0e0c9b),
+     W(0xd3bfea18b3754779)},
+    0
+  },
+  {
+    {W(0xfb88c969c8e2dfc9), W(0x8d3d7782e995e966), W(0x59a06ddbf355dde4),
+     W(0xdb2cbb4ad0ebf975)},
+    {W(0x5056b8df033abf2b), W(0x87c97fd8a391191b), W(0xf15e64abf6fbe7c0),
+     W(0x185a2dcb309eb277)},
+    0
+  },
+  {
+    {W(0x776fa94a4bf73c94), W(0xd442478fb114afc5), W(0xaa64f094ef5df636),
+     W(0xa545dd815cdd0efc)},
+    {W(0xadac99bb4b91724e), W(0xd65d714db491bd3b), W(0x2b172c42f2dbfe83),
+     W(0x11f75c24d4825483)},
+    0
+  },
+  {
+    {W(0x77fe7a7f5da5714e), W(0xffae7f64a8164435), W(0x6eed8e85a15c2d22),
+     W(0x48343017c13c7f18)},
+    {W(0xfaa8351dbe115918), W(0x995885ffd401f442), W(0x441ffd51ee98ac00),
+     W(0x59f316f89d0e424c)},
+    0
+  },
+  {
+    {W(0xfc277c5f51248da6), W(0xccc35a0b2ce4d614), W(0x5a5942b4820811ef),
+     W(0x6c1777dfa42772f9)},
+    {W(0xb594dd36d615064e), W(0xffd4185713a33d67), W(0x1d615b8b3a58ca8a),
+     W(0x3fd7e765ebe14323)},
+    0
+  },
+  {
+    {W(0x5ff906e65523ee22), W(0xd76bd608ee95fa19), W(0x867d4b7b9be201ef),
+     W(0x02867a670fda4976)},
+    {W(0x7f03743b57b43658), W(0x5f36e7495f9a88d6), W(0x33e9d08193029a74),
+     W(0xc97b38babf8b7d36)},
+    0
+  },
+  {
+    {W(0x399b3a77dc7093d3), W(0x0792846cb80bed52), W(0x77bc25abb603f919),
+     W(0x0b1f953e8ec91dbb)},
+    {W(0x7e14468288446a54), W(0xa48fca37eace5c0a), W(0x1e3dc4fd15a5f2a4),
+     W(0x1cb1f15ad1839362)},
+    0
+  },
+  {
+    {W(0x6db4e688aa25635b), W(0x8bd4323a8dbd2e92), W(0x52bfd926d7b62a15),
+     W(0x27f2f8fede7baaee)},
+    {W(0xbb3d53802055db92), W(0x1eef23e9426f2185), W(0xb090e5adb5733468),
+     W(0x9a97b043f62afa76)},
+    0
+  },
+  {
+    {W(0x1cf65530d49ceaa0), W(0x53878972ad72e275), W(0xc97ad2538a231fed),
+     W(0xa1686b1ba54cfb15)},
+    {W(0x9e6f41b2301fa19b), W(0x4fed203f548e5927), W(0xd1007e37fb3cd4dd),
+     W(0x6e648b11b28c2497)},
+    0
+  },
+  {
+    {W(0xaa33c496733182b5), W(0xefd9cedf53f6c4e9), W(0xcbae589892a65ae9),
+     W(0x27aa7b2bd97d95a7)},
+    {W(0x20c9ee8ad47446b7), W(0x6bec05025803abd1), W(0xe8918defd2e8e5b9),
+     W(0xd98bf4f6d28121cd)},
+    0
+  },
+  {
+    {W(0xccc505b36db09b89), W(0x20a00e8ab331fb18), W(0x8f85b9aaddc60d19),
+     W(0x28e1b50c123d84c6)},
+    {W(0x6d7b92475988f38a), W(0xbebe67889ff93adc), W(0x928aff16c6c6fe4f),
+     W(0xddcd3338686a12ea)},
+    0
+  },
+  {
+    {W(0x95b9128dd726a7ce), W(0x09567ddf16b2d455), W(0x2fb628c4f1d90cf6),
+     W(0x51d4994079d58c17)},
+    {W(0x390e6e276097d0bf), W(0x9d2c53aff193cb8f), W(0xeeef02b60e6946a0),
+     W(0xc31f5a6e8adc2b71)},
+    0
+  },
+  {
+    {W(0xbbb92296830bfa74), W(0x9dffa1de119509a0), W(0x58e2c104e964ae0a),
+     W(0x33a5f5d666c6a25c)},
+    {W(0x7f8b794652caab05), W(0x7d608fee658e6cd5), W(0x1e4d325aab30f384),
+     W(0x4a642ab1da143617)},
+    0
+  },
+  {
+    {W(0xde36139af6a6234e), W(0x00d3c26c23ea08ce), W(0x832eb3f36317a691),
+     W(0x838fa244d32adb6e)},
+    {W(0xa35922fe18dd0b2e), W(0x3f0129655c7373e2), W(0xef9b78a3160f4a9f),
+     W(0x07157b958735a06b)},
+    0
+  },
+  {
+    {W(0xbe7fece3d9f222fe), W(0xb91b613d7823d75f), W(0xa9653ba70a6a6a0d),
+     W(0x303b20bdd9acd700)},
+    {W(0xac50d38ebfa46f61), W(0xef508a6c784c39bc), W(0x74f10ea4b2ecb723),
+     W(0x0a46bb3b0d7b24d7)},
+    0
+  },
+  {
+    {W(0x99e18377e5a0d6f6), W(0x1c86a2136ec38d9b), W(0xaa2b69137d4fe3a9),
+     W(0x9277bdeb968d1111)},
+    {W(0xdbe7e4dadd345c96), W(0x36adc5d45a461010), W(0xdf10d3e9f3f3f2b2),
+     W(0x28c1f39be0598691)},
+    0
+  },
+  {
+    {W(0x42e527480268dd11), W(0xaacc72808d702be7), W(0x30408aa5bd402649),
+     W(0x62b9169b3d1ad4e3)},
+    {W(0x3854a9883d14e21d), W(0x5b568ca40af20eac), W(0x91bafeb2fdcc7c80),
+     W(0x5ae0cb0ce61d750e)},
+    0
+  },
+  {
+    {W(0xdce8908ea5b8b5d2), W(0x096b37079dd19de0), W(0x60d82915c7d71391),
+     W(0x33b832b2b4a3c416)},
+    {W(0xfa4de58e4d47e77c), W(0x3d5772fb14bb36e9), W(0xd0f35e4df750eff1),
+     W(0x549f19e5dc2750c5)},
+    0
+  },
+  {
+    {W(0x83ea1d40a12ffc05), W(0xcaa6339bb101abae), W(0x952dbf27b39e5292),
+     W(0x8bc37a1502f39bbe)},
+    {W(0x3a6058c4564fb3c9), W(0x2cb5cd63b0903832), W(0xf51fa0879be674c5),
+     W(0x3e973b57dd1b80e3)},
+    0
+  },
+  {
+    {W(0xb4ce380e3805c9f1), W(0x091fda62327bb29e), W(0xa82c6348ad5c6cd4),
+     W(0x45b1bd2054ec2c1e)},
+    {W(0xfe4eb0187d3859af), W(0x7e5240ae1e850b60), W(0x3c24375f30c409ab),
+     W(0xaea73de53cdb7d04)},
+    0
+  },
+  {
+    {W(0x577d2b7f18760531), W(0x6cd0fb22f3b99583), W(0xbebbd62ad9658c11),
+     W(0xae9fbc65b51bd10a)},
+    {W(0xf08194b332bf47d1), W(0x85528ccb8efe13a0), W(0x1cd2739c8c25f306),
+     W(0x631cdc0b77b69281)},
+    0
+  },
+  {
+    {W(0x6a7dc4fed0807122), W(0x70a4fcb910d6b017), W(0x598fcb2fb97956a8),
+     W(0x15fc0f009e74dd8f)},
+    {W(0x5ffcf6196150d5d5), W(0xffbc0595e1d7ba3e), W(0xfe53b40a7b0ede8b),
+     W(0x3665cf9aec426348)},
+    0
+  },
+  {
+    {W(0xaf7ea5f28015bf2a), W(0x801fd17ad0324e60), W(0xb02d67ea7a576b3b),
+     W(0xe7beb0c10237aaac)},
+    {W(0xaab3691b3f310cab), W(0xa7bce8da22d1fbc8), W(0x7e5b26752300598a),
+     W(0xa8bd925158e2c66b)},
+    0
+  },
+  {
+    {W(0x518c5787b6ea4a53), W(0x5420bd55ad4219fa), W(0xf3f2d3dd5d4934c1),
+     W(0x64c39e697ed649f1)},
+    {W(0xbbb510d472d65430), W(0x1884e76038127546), W(0x4c4763b489632d42),
+     W(0x2ef296624e4096da)},
+    0
+  },
+  {
+    {W(0x3aa5fe2c071c5de6), W(0xda0bd9b2be8d95bc), W(0xd5c6b46b63aeb9cb),
+     W(0xe45346a9f169ce72)},
+    {W(0x99918c022ea1ef8a), W(0x5a47f57a7011cb60), W(0x6afb8d304eb5b8ff),
+     W(0x88605e16693c95a7)},
+    0
+  },
+  {
+    {W(0x60b56c17f10d05bb), W(0xdca837633d7fc818), W(0x2b18c7e3e9ed4b6a),
+     W(0xcbf6cb4f24675cd4)},
+    {W(0x2c4210f01536a9a0), W(0xd4a71979d8bcb738), W(0x59e7c97c7b0bb6f4),
+     W(0x0378233a45a167e9)},
+    0
+  },
+  {
+    {W(0x3d6e7910f682b208), W(0x427269c30c672390), W(0x30b9abbb79e58f5f),
+     W(0x4ff5bee8d8c0791d)},
+    {W(0x99162e49ae3876aa), W(0xd1e54d3c18713143), W(0xff9cd71368eab2f5),
+     W(0x67c98184625efef4)},
+    0
+  },
+  {
+    {W(0x601420f061a846bb), W(0x4155727712661d1c), W(0x73735b0cd55e1aa2),
+     W(0x6651af1d7dedfa76)},
+    {W(0x8c9600c0a5a5c275), W(0x62ae791b69f392b8), W(0x70a00a27803f080b),
+     W(0x84a07b8f6e6624b6)},
+    0
+  },
+  {
+    {W(0xd48789fa09481669), W(0xca24aee343873ff3), W(0xa7a89dde32d73a27),
+     W(0x8669bdf69afae4f3)},
+    {W(0xae2391f4185dcfe3), W(0x8634e74f39bae154), W(0xbe315f1f52dba606),
+     W(0x39b979db34c2a942)},
+    0
+  },
+  {
+    {W(0x0d40fef28e79721d), W(0xf270d9af9d9e6554), W(0xb8e725a857275c16),
+     W(0x9d78420c7f6408c5)},
+    {W(0x7e3d2b635671643a), W(0xd289bf70ba1c9ad8), W(0xa60487135de3771d),
+     W(0xc5dc5c1a23bb54de)},
+    0
+  },
+  {
+    {W(0xa25378352304423f), W(0xcf96d594d624271e), W(0xe3d32e6d76c23ac0),
+     W(0xd93386fd877a7252)},
+    {W(0xc53d7fcb7d7e77c2), W(0xc585ac12b8c1aa0f), W(0x7b2330d114b75172),
+     W(0x92ec2e0f3400bf4c)},
+    0
+  },
+  {
+    {W(0x17c4999ec88a3268), W(0x50a3da73d3d699be), W(0x39710f636f98b677),
+     W(0x5442cde9ff023a5a)},
+    {W(0x744aaf1331e18335), W(0x1571ecc9a1956eb0), W(0x0cd4107f526e5d2f),
+     W(0xc7acf95bd8f2b6c0)},
+    0
+  },
+  {
+    {W(0x79a06447c84f948a), W(0x8ed35e84b82379f1), W(0x16aafb9fa082fa16),
+     W(0x3cbd44a05775491d)},
+    {W(0x75c8a9f0c0a11cd6), W(0xf8c0858afe20a6b8), W(0x8e7f27f890f67366),
+     W(0xb2b886af95ab0932)},
+    0
+  },
+  {
+    {W(0x77e216ea87d67eac), W(0xacb093957c331f67), W(0x6d458fe18a977b56),
+     W(0x3e01f3cb47a11460)},
+    {W(0x6ed10a261efd9b54), W(0x9c18dd1d02953dd5), W(0x8fdd9a4c2f82e31a),
+     W(0x1d9831855937de7f)},
+    0
+  },
+  {
+    {W(0x059f4c826b2b67d6), W(0xa1d2511672fa2b48), W(0x4e9450ceb27320af),
+     W(0x2fa42f2007e0c2e5)},
+    {W(0xc1df904493a06dad), W(0xdd10a9e998833cad), W(0x4b2775f64d9c1195),
+     W(0x2a273e27ca7261bd)},
+    0
+  },
+  {
+    {W(0xa92d5049ba8dbbf6), W(0x64228c2201888472), W(0x21c683bc7cdb3beb),
+     W(0x64111bc7fff20dca)},
+    {W(0x23c97e91048eb5e8), W(0xaad5345ad0aa038d), W(0x4142bfe5d0a27b6a),
+     W(0x2f0046d2226d9f93)},
+    0
+  },
+  {
+    {W(0x8e1450edce1ca4af), W(0x6916b2c1965b1a6e), W(0x93938b5371df1610),
+     W(0x6842fcad403fa94a)},
+    {W(0x57422e1572ec209c), W(0x8b6c1a741bf0b882), W(0x714909ba4ef219b4),
+     W(0xc05f4309b8a5e640)},
+    0
+  },
+  {
+    {W(0xcd42390c47936a0a), W(0x572959b6b623963c), W(0x81c1b73ed126f40f),
+     W(0x5e1c0141bcafbc78)},
+    {W(0xd95f696394b4928c), W(0xba71ef081857402a), W(0x1f350e8418c6e4f7),
+     W(0x957f8dc63db52230)},
+    0
+  },
+  {
+    {W(0xfbd5bed68dfae212), W(0xd0c3b41aac43bc32), W(0xf876cb392dce03a7),
+     W(0xd7f53ae414f8a48f)},
+    {W(0xfc435461936d8e98), W(0x95605fc8acb2e1bf), W(0x556d58f37adbb01d),
+     W(0x647ec3e0422a639a)},
+    0
+  },
+  {
+    {W(0xc0f8baf76ae70f4e), W(0x636b4580b3c87609), W(0x85697f07af52a804),
+     W(0x5b094243a89edfe9)},
+    {W(0x40033fb006a4ca63), W(0x4783a735b0188303), W(0xd2f76b1e8749034a),
+     W(0x1277c387c56dfd21)},
+    0
+  },
+  {
+    {W(0x166270b51e92bb94), W(0x3fe6395156807ff3), W(0xdd2751dc05dc8cae),
+     W(0xa1a1af0f472dae53)},
+    {W(0xcc1518c2bf8226b6), W(0xfcb7dd251aac8155), W(0xff95126de3e12f29),
+     W(0x1751ec24ac3ff91f)},
+    0
+  },
+  {
+    {W(0xdf5d2eb869a36fa7), W(0x0710b56427d0de67), W(0x8586528c325fb28a),
+     W(0xb0b5b9c69f0faaf7)},
+    {W(0x9a04404bf7ebc369), W(0xf4c38b193346e76c), W(0xc373061ef170b474),
+     W(0x269bbe54c243df84)},
+    0
+  },
+  {
+    {W(0x9823f3a39a66a356), W(0xf744391029c7ff6b), W(0x92e70b3ea39a91ce),
+     W(0xbb9624c9a2762771)},
+    {W(0xfa4c342a4713ed44), W(0xea33a7b6e9ed2aa3), W(0xe460508cad1a7d9c),
+     W(0x47983505862d9cdd)},
+    0
+  },
+  {
+    {W(0x0d603b19eefcadc0), W(0x2cf416b08512c201), W(0x1826bd6d79d3ce5e),
+     W(0xb398233ff56fc342)},
+    {W(0xfe87bdb5e2c8aaa6), W(0xcb487b05730709c7), W(0xc08c70549e80a074),
+     W(0x346bba1c7ba515cc)},
+    0
+  },
+  {
+    {W(0xceb60a6f9b1d7188), W(0x0dd01f728c474fcd), W(0x22ae510d3a31dcfb),
+     W(0xb4b07ca9c4578b04)},
+    {W(0x11055ca7ac647af4), W(0x5aa8dc67c2e312ee), W(0x20cfcd166ac21386),
+     W(0xc58b6919a61b41b4)},
+    0
+  },
+  {
+    {W(0x1d89a94ffa976e61), W(0x73b87b6449528645), W(0x3dbea0040e88e8e2),
+     W(0x8aedd91c781a78a1)},
+    {W(0xa85c36ead6e72338), W(0xe22309f3849361fe), W(0xf1165156e53cc6be),
+     W(0xd48ce36f97fa3554)},
+    0
+  },
+  {
+    {W(0x83c323edbdab939b), W(0x9e8feef5478f2bdd), W(0x6d0c1f2acf82681a),
+     W(0xfaf22dc2780e23e4)},
+    {W(0xf61f233c7b38f2c3), W(0x96cb62589750d75e), W(0x3888ab62dc58990b),
+     W(0x6ea03944a4deabf1)},
+    0
+  },
+  {
+    {W(0x2a5cd7a1624c5f25), W(0xb5c5f7c918d1b457), W(0x1b33087e84f16a32),
+     W(0xc9ac85117a33aadc)},
+    {W(0xcf24c0eb74f94a63), W(0x65c57f4b5f0b0578), W(0x542bacdb9e3e57db),
+     W(0x78f897e799a81b9f)},
+    0
+  },
+  {
+    {W(0x652c1e87fc630acf), W(0x6418e80267e2dd44), W(0x259fbeb7884b4699),
+     W(0xbfb6b1a4d3f9c909)},
+    {W(0x0a73f511e7d94dee), W(0xf1f57351cdd2024e), W(0xcf8464dc7e129fed),
+     W(0x1c903dc0213943af)},
+    0
+  },
+  {
+    {W(0x0de4c62b7d0edb8f), W(0x740cffd7b7c3e193), W(0xf5c3dcf976cb5ac8),
+     W(0xb56d08b947f2b922)},
+    {W(0x655adf7359a9fd98), W(0x0a939bfb38f4e66e), W(0x6a1d0deb64f18ce2),
+     W(0xbd1a7494aaacf6ba)},
+    0
+  },
+  {
+    {W(0x0c58c4ccf72bcb6b), W(0xbc7260e4ec0ab030), W(0xa7301084bb8fe20a),
+     W(0x5811579fff6a4468)},
+    {W(0xb4ebaa466edbd865), W(0xfaf656c603c056a6), W(0xc4ad5fdb6fd706c8),
+     W(0x1c228ac0c7e865d8)},
+    0
+  },
+  {
+    {W(0x8240ab33aebf6763), W(0x4f5254d1db32ea16), W(0xa6cff7a1c3fe5541),
+     W(0x58ef47c8f56dd8b9)},
+    {W(0x44fdd7a574f34354), W(0xfdc85fa52e9f0782), W(0x0c16cb66e23b750a),
+     W(0x2802bcdce7195af5)},
+    0
+  },
+  {
+    {W(0x63804c4c42cb21f1), W(0x6b0c447d36276fa0), W(0x9f7d135d0436a816),
+     W(0x00a85aba383113cc)},
+    {W(0xce6ed64197db8014), W(0x3b1d1a3c867be3e7), W(0xf35b600694936dca),
+     W(0xfc6e1a3c27daa4ee)},
+    0
+  },
+  {
+    {W(0xfdae579e8c4ac31f), W(0x64d21a1713166134), W(0x26939d6dbfbe2c1e),
+     W(0x04fe148f319c5ee1)},
+    {W(0xfb0941fef3c18d36), W(0xde533a142a66c0d0), W(0x815f532d82604bde),
+     W(0xac4140bd83354f79)},
+    0
+  },
+  {
+    {W(0x911b5828f2a9ed30), W(0x2d0c7f9821c486b0), W(0x472085896f3ce8d3),
+     W(0x4e55baf4218a3814)},
+    {W(0x57941b7a1a063125), W(0x79ab2e1ab629ad35), W(0xe667a9cad05bca0c),
+     W(0x65a8e894162b86e2)},
+    0
+  },
+  {
+    {W(0x42e173d9cd6cf773), W(0x84bfe6347f9efd3c), W(0x832e2a4bc235297e),
+     W(0xf7ba5df7ef4e79d9)},
+    {W(0xb413ba8981adbcd3), W(0x843227edd0388959), W(0x4b997b0935c26492),
+     W(0xdea0cfde7cdd781f)},
+    0
+  },
+  {
+    {W(0xbb9d278df43b6f46), W(0xa4f312f30071630c), W(0xab8962a39ef0dd9c),
+     W(0x58027a2f9ae38b20)},
+    {W(0x2baa937ffa1cccdd), W(0xeec383a3b95e64e4), W(0x523b97d2de5e816f),
+     W(0x491eab9683cd58c8)},
+    0
+  },
+  {
+    {W(0x9e14190d7dae04a1), W(0x3b3513728e81c735), W(0x0580a6c2bea8e8a8),
+     W(0xf7cffd9da01ced06)},
+    {W(0xc52acbe39190219a), W(0xe8c50d3d619d70e5), W(0x2def6e9440a75057),
+     W(0xddbd10499310b5ca)},
+    0
+  },
+  {
+    {W(0x17d3b862371a1c5b), W(0x376da4c66b4a5ba4), W(0x89a79dbf7def949e),
+     W(0x746658628fcf6935)},
+    {W(0xc8a21a33f2578597), W(0x769459e900268b82), W(0x4caf6427d1516597),
+     W(0x7633c296a19e5fb8)},
+    0
+  },
+  {
+    {W(0x3bc09830be79704d), W(0xadccfc729187146e), W(0x4527a5dd101bfb70),
+     W(0x1c4befe9b5ba9b8f)},
+    {W(0xb17e3d4365ca413b), W(0x373050e724a2d20f), W(0xb082d6e01d59c624),
+     W(0xdda83f31081a886d)},
+    0
+  },
+  {
+    {W(0x8922ad4b0e2ceeec), W(0xd257db19df7e2ed4), W(0x37489e2ffd91f076),
+     W(0xf72815b491783257)},
+    {W(0x014fdd222971cff2), W(0xa5c680bf039bbb63), W(0xaa4d37389e9fa0f6),
+     W(0xae08abb75d7cdda0)},
+    0
+  },
+  {
+    {W(0xa09dc7091caebebf), W(0x055cc2a28afc207a), W(0x6db99662875ccd9a),
+     W(0x098f64cad0cee5a8)},
+    {W(0x5c05a8f5eda375be), W(0x7c64925be6243262), W(0xdbbcb6cb1b138edf),
+     W(0xd10ae0ec46a8dfdd)},
+    0
+  },
+  {
+    {W(0x515b311b4c86510a), W(0x6f5d200e0c64a195), W(0x27c2ac0ffc0e2aaa),
+     W(0x9908a9feb2b5309a)},
+    {W(0xaed749682f5103a2), W(0x05a00c9ab7a8c6ad), W(0x8b1d752e51bea391),
+     W(0x54e200ec2a3757bb)},
+    0
+  },
+  {
+    {W(0x13585d245efd5c2d), W(0x0f42a2e4e56e0869), W(0x67d57e7797b5fd65),
+     W(0x5639aae97aff50cb)},
+    {W(0x4bd5eb6232d99362), W(0x3c9202a8af01d134), W(0x2d0026af0e64b37d),
+     W(0x141eafae69f094ff)},
+    0
+  },
+  {
+    {W(0x03499d435475194a), W(0xa0fa362926764db8), W(0x69d83feae1794d6f),
+     W(0x55ed14a7a9de2a18)},
+    {W(0x60853c71db502609), W(0x565a1940f5e4d56b), W(0x2efb1f4c2c91bde3),
+     W(0xb9be5f3677abad7e)},
+    0
+  },
+  {
+    {W(0x4b01d86eed546133), W(0x259435d271816cfb), W(0x98a363ce715df602),
+     W(0x8520c53fc282ce2a)},
+    {W(0xd131e116504fd29a), W(0xdc23a5cff58545b8), W(0x65a1185c9e73e0c8),
+     W(0xb300c6a7d9598a02)},
+    0
+  },
+  {
+    {W(0xece595d1d0e46a3d), W(0x7bde5211843d4f00), W(0xf21046c6641e0d2e),
+     W(0x3e397983da6e3f82)},
+    {W(0x594a2bf98a7b306e), W(0xf14af5306d7c6003), W(0x63daa23b91cc571f),
+     W(0x8b6c7770e131e19c)},
+    0
+  },
+  {
+    {W(0xcba8eb5dc9c8c1ac), W(0x376335e3da41bab6), W(0x320c9d3ed4951025),
+     W(0xcbce5c2ea8d14663)},
+    {W(0xfcbafeaca0c2cfa3), W(0x1143f4d65a6f5fca), W(0x2b0f6a74b081d06f),
+     W(0xed26aa65cebd97b7)},
+    0
+  },
+  {
+    {W(0x452a273bd0e3275e), W(0xd88848da0e0104a8), W(0x2bd2566c533d981e),
+     W(0xf45709ed0f076480)},
+    {W(0xd24de9f274e594b3), W(0x729ac9fd53aed23d), W(0xf45d3eaa4ec5883e),
+     W(0x4ed6bc3011284450)},
+    0
+  },
+  {
+    {W(0xe851872300eb7c9f), W(0x1af719ea317f456a), W(0x32405985d2396797),
+     W(0xef1090c2be834efe)},
+    {W(0x73b1316723af6209), W(0xbfad3fe1706ad55a), W(0x3d99ceaffe0e9463),
+     W(0xcafaced262536f9e)},
+    0
+  },
+  {
+    {W(0xbc87a412e650d60c), W(0x754917c3b06c4d32), W(0xf510ecbb9b7ffdbb),
+     W(0xf9addee845c0e3ed)},
+    {W(0xe344569953a13a10), W(0xb287e3fd27aa853f), W(0xedf18ae76b9e7fb1),
+     W(0xafa260e07a9b65f0)},
+    0
+  },
+  {
+    {W(0xecf7dbe2f3bf66f0), W(0x88d4621b9c3a9e8c), W(0x663a1ad817117a34),
+     W(0x7f61d54b86480b2e)},
+    {W(0x30ad9f62c9c88d7a), W(0x01aa2af8c42797e8), W(0x358a97b2838b5a2b),
+     W(0x61a59b76c887485d)},
+    0
+  },
+  {
+    {W(0x1a22c35051abb9a2), W(0x25e887c1af01d4e2), W(0xe250b219e19b758f),
+     W(0x67089b58caa45cb2)},
+    {W(0x0f41fe5c36648e62), W(0xaac1837fb616b05d), W(0x00887e358466e63f),
+     W(0x8e339835e6c18f8d)},
+    0
+  },
+  {
+    {W(0x3c03fa2bd097fe0f), W(0x336ab329e6207611), W(0x36c0987490ebf32f),
+     W(0x9e9fa4e0d590ea9e)},
+    {W(0x6470282665e5f0de), W(0x8f6ed076a243ce8f), W(0xb0bb6ae0488d2c34),
+     W(0x6893dcafa69e8816)},
+    0
+  },
+  {
+    {W(0xc553d43dee254cdf), W(0x49ec0a241b5ddeaa), W(0x4aa66caa05207f1b),
+     W(0x72a973aae3b0df7a)},
+    {W(0xba3ec760f81ae5a2), W(0xd57834300d6ebb58), W(0xf80fb9b328c1a21a),
+     W(0x956c8ab327c426b3)},
+    0
+  },
+  {
+    {W(0xd193186c95c6d0d0), W(0xb17f93448e43c35d), W(0xa702f77331635fa8),
+     W(0x1feec73f8bb8cd9b)},
+    {W(0x65a1420349bc54b3), W(0x034f8544d03eb75c), W(0xd540901dd95a9195),
+     W(0xe616fb1bbe4af947)},
+    0
+  },
+  {
+    {W(0xc6428e073aa8cde2), W(0xef4a24d1279cb637), W(0x2e2cc1ea8276c5d1),
+     W(0x15de1f29846ff19c)},
+    {W(0x4e984952a7b09b9b), W(0x27a3a2a7e5182e46), W(0xe0e0e2a5ef7d106a),
+     W(0x91119a811cc5f911)},
+    0
+  },
+  {
+    {W(0xb451f4b55ad55b5d), W(0x97034ca3ada2d4c2), W(0x9a035362f38a4eab),
+     W(0x242c06af9fb69b4e)},
+    {W(0x93716cdddb1a2dcc), W(0x7601ef00a27632a3), W(0x10a06fba64472118),
+     W(0xfc045283097572d5)},
+    0
+  },
+  {
+    {W(0x05d001f70e69996a), W(0x4a5bb92c5b23d364), W(0x8c60eb88034e0487),
+     W(0x9a498d98f7bd525e)},
+    {W(0xa1e36bf8c32e64bc), W(0xee283c86bbe048f5), W(0x0e4d0b0f26d917d7),
+     W(0xf2390f05e20b153c)},
+    0
+  },
+  {
+    {W(0xe956e86966219454), W(0x5003705af9301d58), W(0x656ff59a98a4e9e0),
+     W(0xba4c554cc23114c2)},
+    {W(0x65181771b871c99c), W(0x9b38e71d7e9b6498), W(0xabad72db52405fdf),
+     W(0xb7442c97b3d5389d)},
+    0
+  },
+  {
+    {W(0x31418efd4e5fba75), W(0x6af3b26087dfab1e), W(0xf7f7bfdf60ce887b),
+     W(0xeb2fcd5a06de157d)},
+    {W(0x1fb5b206bac5be4c), W(0xfb6677c1d66208d5), W(0x190f28b4d948a49f),
+     W(0x347816b9c16c58c1)},
+    0
+  },
+  {
+    {W(0x46f1062663b59663), W(0x14d63bbf9654f17e), W(0x47c76652956c623d),
+     W(0x90a2cf64a58c43b3)},
+    {W(0x4dd7e2fe172a6095), W(0x256800a5f813263b), W(0xfcca52afcc47c0ab),
+     W(0x583ea48885311a22)},
+    0
+  },
+  {
+    {W(0x178fd714df0397e3), W(0x7d8f4da82a85b6d6), W(0x3fb13869746ff9d3),
+     W(0x1b882abbec8771d1)},
+    {W(0xa91349dfda47dd50), W(0x77171c5597049e4b), W(0xb34c6474b14aeefa),
+     W(0x053e3747f3e452cd)},
+    0
+  },
+  {
+    {W(0x5c802dff9c98d36b), W(0xf3b05ad27c806238), W(0x004166f68e2e1784),
+     W(0x5eb3d1300e8f311a)},
+    {W(0x5d0633a18dfd65c4), W(0x508f4ab3106a7e91), W(0x4a9e4c8f43664bd5),
+     W(0xb71bd7fa97116dc8)},
+    0
+  },
+  {
+    {W(0x5ff15f65af46512e), W(0x6a3d986edbec66cf), W(0x529fbe0a77d87a7a),
+     W(0x02e0ac81b05feb5e)},
+    {W(0x8bf1906c759b462d), W(0x163764b1567de1ac), W(0x6e29f6ee112dfa51),
+     W(0xc5a45326b90fa578)},
+    0
+  },
+  {
+    {W(0x59ab8f1c1e218859), W(0x5cc22fbc3195629b), W(0x8f018382c34c4327),
+     W(0x7863525e0169b8d4)},
+    {W(0xbdb2b2bf045fa933), W(0x688712d5996cbc68), W(0xc8d45343b6d5ed19),
+     W(0xa0c757986a25008d)},
+    0
+  },
+  {
+    {W(0x23cef27736891071), W(0x72588af78023e54a), W(0x55c585965205e0d6),
+     W(0x1f340d7db9665698)},
+    {W(0x35630ff503ddc2c7), W(0x3c32d5fbdbe69bbc), W(0xc66024a2cdaf0c9b),
+     W(0x16b4a823aa0ed390)},
+    0
+  },
+  {
+    {W(0xc14eaf8c220e42ba), W(0x0d1295e69481d469), W(0x0b316df7fd664402),
+     W(0x4a60f90f51f44bc4)},
+    {W(0x018717a02221b94e), W(0x95c84b7942baf031), W(0x22f90c2669cbbe40),
+     W(0x57593d4f1938e374)},
+    0
+  },
+  {
+    {W(0x8431c61ca83b8bb1), W(0x57025a864ca6b3af), W(0xd0e80ba50dd6c085),
+     W(0x851c5b824a97ea61)},
+    {W(0x16c81b3d1ea14971), W(0xfa0b84183f381928), W(0xfeffa4364ffd15c9),
+     W(0x4d0aa58071d2601e)},
+    0
+  },
+  {
+    {W(0x7302a81df883a75d), W(0x391fa60fb744bfae), W(0xc23a12729d3a32e3),
+     W(0x2f68e9246d3f5653)},
+    {W(0xdb78cc475fcfb995), W(0x8298657ea8562056), W(0x7b901568814ea28a),
+     W(0x3984bf9f94c5fa34)},
+    0
+  },
+  {
+    {W(0x36a624076989a13b), W(0xed895cc47e1617db), W(0x6e652c34ead7e3ed),
+     W(0xe8fc2e2352f157c9)},
+    {W(0xfea0fbff41b6f712), W(0x037d4aa507b45891), W(0x2ee96d2b59a1ae49),
+     W(0x9abfe2c6bfe1b12b)},
+    0
+  },
+  {
+    {W(0x8897e2554ca537f2), W(0xb464331e4ad1cc3b), W(0xa1220b48f28662f6),
+     W(0x6517d26f1cb98bae)},
+    {W(0xe1b0d394f0528dd1), W(0x121fdee00164355e), W(0x3a88f95c9c51f50d),
+     W(0x3c9e7c6a2fb046ed)},
+    0
+  },
+  {
+    {W(0x338deb1cad014b89), W(0x8b1bc54cc0f56f24), W(0x49f6ff68b816a171),
+     W(0xa482656e39b10bed)},
+    {W(0x4a2cd94dfc467e75), W(0x4e26dbd3d1054145), W(0x5ee399ec980169d5),
+     W(0xb24d91ff43dff55d)},
+    0
+  },
+  {
+    {W(0xe44d281a60886b1e), W(0x74733db094903914), W(0x318e0c89efef0cb7),
+     W(0x1a04c6dbcddf6591)},
+    {W(0xabbc2b919135d0ba), W(0xbef4c7bbb7842b9b), W(0x05e6924f553cd718),
+     W(0xdd3621c949c3d1bb)},
+    0
+  },
+  {
+    {W(0x64feca22f11bd60d), W(0x5639368cfd3f7db8), W(0x25e7d89b8e6a59df),
+     W(0x30c30721aaac3dbe)},
+    {W(0x7a725acfc9057f32), W(0x74fa6425b5891c08), W(0x2bb36a366e787c27),
+     W(0xb4889669fa964656)},
+    0
+  },
+  {
+    {W(0x3bf063c6743cab65), W(0x8340cb8d2d0a4f37), W(0x5b83a708aae5da57),
+     W(0x6ebcc8b5c73a83c8)},
+    {W(0xfd4161e745d46613), W(0x80f71d03e527698f), W(0xd5f31da276d6b1a1),
+     W(0x7e79b6869996a694)},
+    0
+  },
+  {
+    {W(0xf192fb475b25b256), W(0xc193f637a12a2996), W(0x59bafdf64f4a15dd),
+     W(0xbb6efe2d0483a770)},
+    {W(0xa868b73a5d080f06), W(0x689c45a8a717ceab), W(0x81fce132b973f7d1),
+     W(0xeb0bd8bfda870ade)},
+    0
+  },
+  {
+    {W(0xc9ae64a320162fe7), W(0x2b88a5a8b3777a8b), W(0xea824b4e85289289),
+     W(0xac5b134eb8800efd)},
+    {W(0x04b9f292761e94f4), W(0x0862baa50c7d4143), W(0x30729d0c5abe4048),
+     W(0xd1ee2ee5ee7ca4c0)},
+    0
+  },
+  {
+    {W(0x03c9037e90b1eebf), W(0x43bfd5e0d83d68d1), W(0xbe38d793cc1ab579),
+     W(0x866b20cbd10a987e)},
+    {W(0x1396b32871c93c05), W(0x690f14a87e8955e3), W(0xd7ba016136301737),
+     W(0x769affd4bebdd08a)},
+    0
+  },
+  {
+    {W(0xa6fd05166a104d33), W(0xfc8f3e9ed947dc53), W(0xc8365a762a98bf54),
+     W(0xdd7008312cb6d74b)},
+    {W(0xe28d122f5ed9264a), W(0x19596294b8d738f1), W(0x5835d431519f19ab),
+     W(0x5597b635aa7cc0c5)},
+    0
+  },
+  {
+    {W(0xc7e7bb93eaabddb4), W(0x315335a1b3f248c8), W(0xb55bbd777c8e0e94),
+     W(0x1346901469e67d59)},
+    {W(0x9249dfbea17bdbd7), W(0x8b11c6a10fa173b2), W(0x7329f75bf47768c5),
+     W(0x0ae8446d0a8837a5)},
+    0
+  },
+  {
+    {W(0x2a5e53d90d7d0e1d), W(0x9b7461ed644a8dfc), W(0x705f419c7ac742d9),
+     W(0xef2af5413f142feb)},
+    {W(0x304440af97256ca3), W(0x67aed0bdaecba8cd), W(0x5f1c03a770fd8299),
+     W(0xca6a7e0004f8285f)},
+    0
+  },
+  {
+    {W(0x6bd70e8e84f1802f), W(0xa6ef97c27cecb6cf), W(0x0d1f4b73aa8be25c),
+     W(0xa947e525b46aed3a)},
+    {W(0x44372d89a0ead23f), W(0x30d13373555bd6b6), W(0x1830f9a75ffbc0e6),
+     W(0x1b3fe0f03a500beb)},
+    0
+  },
+  {
+    {W(0x311eb523ddbb6b66), W(0x8f608d69510794ee), W(0x1ad7843b512c3aa3),
+     W(0x769cf3aca89ac5d8)},
+    {W(0x3f4b665a122d7025), W(0xb9cb2216255a7e1e), W(0x84379502fc913258),
+     W(0x373abdefbb34ed46)},
+    0
+  },
+  {
+    {W(0x65222eb7394c439a), W(0xd63cc59b89ca682f), W(0x68995b0941ee0cf3),
+     W(0xc1309fdbee51b12f)},
+    {W(0xb0691219842991ed), W(0x7b16a33ee984848b), W(0x9ac1a4f13b5258d8),
+     W(0xa4f8a5d27acf074b)},
+    0
+  },
+  {
+    {W(0xc5052a5759226d61), W(0x63b6857f410299a2), W(0x54c2345a8122942a),
+     W(0x530baa390cc015f2)},
+    {W(0x25167bdab2ed314f), W(0xa234900cf2e54574), W(0x3128f3987037c48a),
+     W(0x2001ee048d2d621e)},
+    0
+  },
+  {
+    {W(0x18ae874679e5a14f), W(0xecea750973296119), W(0x1366759a613af647),
+     W(0x06fe5de8b240dda8)},
+    {W(0x32d0c3e073c90883), W(0x8265e53e4b56ef6f), W(0xb552feb09f1a8e60),
+     W(0xca3b4c4139376077)},
+    0
+  },
+  {
+    {W(0xd65632ac0317dfb2), W(0xb02c63e66f00ab0f), W(0x54cb28c8dcc0130c),
+     W(0xf745c87bdb55d0de)},
+    {W(0x7dd337aa70d648c7), W(0x2fccd18ff4b4eb3a), W(0x7dc3baade372d090),
+     W(0x3ccbf749d9fb6237)},
+    0
+  },
+  {
+    {W(0x342d11018e2302df), W(0xfc21efdbaf486fe9), W(0x88baa0c398d8c9eb),
+     W(0x54f3e2a1ab232c48)},
+    {W(0xb57861f16a87efbe), W(0xa1b3a6df268438a7), W(0xf356a98fb6f7d60c),
+     W(0x316b42a6bdf97de8)},
+    0
+  },
+  {
+    {W(0xdfc8fdf920d16279), W(0xda7ed7d2b7dc3a21), W(0xfd0d63bed8f9e72d),
+     W(0x3337ffd85739396e)},
+    {W(0x8f333cf3175d94af), W(0x297c14baa1e1a496), W(0x89c86f656d9df740),
+     W(0x641f16c36c9e3c4f)},
+    0
+  },
+  {
+    {W(0x8611a9fde6f2ae55), W(0xacb67e154fccfd3a), W(0x429afd2aadac28ae),
+     W(0x5c80248554110b63)},
+    {W(0xa35aaccbdcdb6a35), W(0x6ba203404e140c50), W(0xfc24711815803e21),
+     W(0xdc68b525ee57a665)},
+    0
+  },
+  {
+    {W(0x9afd329c0908d207), W(0x3a7d7879a4aefe1a), W(0xb3ef821231ec5b58),
+     W(0x106dde6663f7de3a)},
+    {W(0xea5ec5c991b6f0e2), W(0xb58e939d11f9f651), W(0x220aae06942fc194),
+     W(0xfae94f986408bf2f)},
+    0
+  },
+  {
+    {W(0xca43e53ae8823a60), W(0xef2cc1ec203bd7e8), W(0x8104bcda52eb247c),
+     W(0xa75e43a8a1f8994f)},
+    {W(0x1cd685eaed22c11f), W(0x8079cba1cdf556b0), W(0xf3ee58013623bba4),
+     W(0xfcd5dec6496bc71e)},
+    0
+  },
+  {
+    {W(0x2a27c843c6ea6528), W(0x847737daca61779b), W(0xda0d0688208fa92c),
+     W(0x9d66f7dd70a43afa)},
+    {W(0x634102832072acdb), W(0x1a10b0f8694f866f), W(0xa02c9a74997d32f6),
+     W(0x13b2f1d5d8b15a41)},
+    0
+  },
+  {
+    {W(0x382d61fd31473104), W(0xd355017bec39146e), W(0x51386cda57c34deb),
+     W(0x8b4ef9de1d28b2b7)},
+    {W(0xc1516ebbb8be21cc), W(0x944c59f4e6482208), W(0xe6a8314e990a3705),
+     W(0xc331884563df2c51)},
+    0
+  },
+  {
+    {W(0xb3b76cbbdc8c8b64), W(0x19439973f25994a8), W(0xffcc542b7d1b4707),
+     W(0x0b00c37728368ee4)},
+    {W(0xa4b0233a71d2c12a), W(0xcdf26da12aa7a71e), W(0xe8879e55be549400),
+     W(0xd4756005479edfa3)},
+    0
+  },
+  {
+    {W(0xce8900025a9d9761), W(0x9def4c70d71c1c61), W(0x0219eccc2f025ad7),
+     W(0xcc92beb704860259)},
+    {W(0x9ad192d7587533a5), W(0xf59489ef03f7c359), W(0x34fa0c36e62c4d09),
+     W(0xd8eb8b4d33cb749d)},
+    0
+  },
+  {
+    {W(0xa7f9e15064613ded), W(0xa643ed507b5640a5), W(0x72dd5247e29dbf06),
+     W(0xeae9b3a5f139ea38)},
+    {W(0x0de3ce02dee0ee9b), W(0x6750e9902fafe84f), W(0xc596c31612780a2d),
+     W(0xdcd58dcf7701ea8f)},
+    0
+  },
+  {
+    {W(0x1e8e3570206bbdbc), W(0xc70c6f3332be802a), W(0xa3475d0acdc57bc8),
+     W(0xb6419e0832ce3465)},
+    {W(0x190a19956a3b00dd), W(0xc63c1e8b5f45feea), W(0x6accb0c12d39b7b9),
+     W(0x79df8308f9fc2810)},
+    0
+  },
+  {
+    {W(0x5d833c7a68ede8d3), W(0xba2f99deec3e2ddb), W(0xcdff2a87251bdfd0),
+     W(0x321cbe9287e84495)},
+    {W(0xc5bb8aa7c170f397), W(0xb450bd89e7aa1f57), W(0x5f7486c261633229),
+     W(0xf4a02377fc35b833)},
+    0
+  },
+  {
+    {W(0x0d0812dace655d41), W(0x0a6332f19b0a2fc9), W(0x5b193fb1b314c13f),
+     W(0x580a17f9b473333c)},
+    {W(0xe6bf3dcd042729fc), W(0x4e04b6c75bddda0d), W(0xfcbfafbfdb293973),
+     W(0x18e4caa10777bef1)},
+    0
+  },
+  {
+    {W(0x656e5798e58618a1), W(0x8e72295540740357), W(0x9c44c218728318f2),
+     W(0x4c4d74cc0bb08e8a)},
+    {W(0x49871c4cba6d5ebf), W(0x40a02538e73518b3), W(0x6283db92a21f7f0d),
+     W(0xf430c31b4937b569)},
+    0
+  },
+  {
+    {W(0x15d7be8224104452), W(0xcca98f661b1bd915), W(0x90b29bc130a922e3),
+     W(0xcb613c4a81384bf7)},
+    {W(0xcce66c291316e431), W(0x2c28480de2aac5cf), W(0xf62ae1b300112b87),
+     W(0x340cd1c4f61b64b3)},
+    0
+  },
+  {
+    {W(0x2ee68b1e2ad69dc7), W(0x20b85417eefa9604), W(0xb7b1bb2f9d1cc968),
+     W(0x84ab36c976eb8322)},
+    {W(0xbfe3f77e364b3992), W(0x7a119d05e5e77bab), W(0xac71c21a1c28ca6e),
+     W(0x96748c6899eaa223)},
+    0
+  },
+  {
+    {W(0x511be339c43e31f5), W(0x10f388cdbbcba8f5), W(0x5c40c2e5ef62b590),
+     W(0x1ca9742a3a37bbe8)},
+    {W(0x47b4c41ef07bf529), W(0x24bb2930eeb1a671), W(0x3fcdda8a5ed96254),
+     W(0xfdf24e1cf6b0b9d9)},
+    0
+  },
+  {
+    {W(0xa9d316db8cb705bc), W(0x72c9fb33341c27cf), W(0x49f657ffa59c9700),
+     W(0x26584885c0d713e1)},
+    {W(0xc3bf20c57392e89e), W(0xdee102c466ff3486), W(0x0b5229cb8bee2451),
+     W(0x1b8d8b74dfd662f2)},
+    0
+  },
+  {
+    {W(0x00385a746d5e098b), W(0xb03cd6d39618e765), W(0xc4ee822f2134be46),
+     W(0xc4d0e9837c8eec77)},
+    {W(0xba8c0fdd2fada142), W(0x4c7097db50414c76), W(0x96bea564bf17f7f0),
+     W(0x5ae53cc54bd50597)},
+    0
+  },
+  {
+    {W(0x77f622e12fb210e7), W(0x9e5b28af20794aae), W(0x57b1fe623a4a0bca),
+     W(0x7a6ac5586a89928d)},
+    {W(0xae6a31b08b9fc64f), W(0xedf3b6487e2f521b), W(0x4749d6bede2b30d3),
+     W(0x34a9dd89ae3e2ca9)},
+    0
+  },
+  {
+    {W(0xcdd8ac3ceaf2d8b9), W(0x722c6ed3b8a3b0e8), W(0x37b78c7fb151798c),
+     W(0xfb21ebaf454738a5)},
+    {W(0x8644070e50b88c51), W(0xf80f5c5420a3b1c1), W(0xf9f8bc4ea2f69160),
+     W(0x1140ebec63d39e5b)},
+    0
+  },
+  {
+    {W(0x76d4605e6dcf0ba9), W(0xf9375c317b8997b6), W(0x9f6a82607bad9c1e),
+     W(0xef2507f00af8ccc1)},
+    {W(0xeae18bf0f2ac54cd), W(0xcb2881d0703d2d20), W(0x95be65d93f6f7dad),
+     W(0x13fc45ff5f90a6a5)},
+    0
+  },
+  {
+    {W(0xc75615ad2fbde236), W(0xf756411973dcdaf7), W(0x013454ed61dda3bc),
+     W(0x04ed56ee330144f3)},
+    {W(0x3c1c544ca6af5967), W(0xe6429cc64c47a4d6), W(0x4b89f6dfaf8b6184),
+     W(0x00f56eaaad844605)},
+    0
+  },
+  {
+    {W(0x6a4dec58e9a90456), W(0xa1153fa1783974bf), W(0xad97def6b099224f),
+     W(0x0e7422332eb8c4b3)},
+    {W(0x7340d25112b8201c), W(0xc8a014ab442b845b), W(0x881727b4c132b91c),
+     W(0xe56f1c5b90329876)},
+    0
+  },
+  {
+    {W(0xc9f034ef8025ec63), W(0x01450539cb8fed63), W(0xe0b29ba28c987456),
+     W(0xc24b8204d78df5a0)},
+    {W(0xe4e34e2e62f7c172), W(0x7e9113e2149c4b1b), W(0xfd0310559b3f65d5),
+     W(0xc41bdc86bb5d3c9b)},
+    0
+  },
+  {
+    {W(0x4322a693b842608f), W(0x3abd7a115b89ae4a), W(0xc4c6eb10b6196c9b),
+     W(0xb7f454c628f0370a)},
+    {W(0xa5901f2f9231bb89), W(0x916cc350c8d9b78b), W(0x33cb42aca3470d00),
+     W(0x04baf157a83aaf25)},
+    0
+  },
+  {
+    {W(0xec28f773f215695e), W(0x6b0e6d9c964cfbcb), W(0xdcf72f8f37e9faa2),
+     W(0x095819e9f0cf4cfd)},
+    {W(0xda532a8078840ea0), W(0x355f67aa05633be5), W(0x5dc00d4d0487732f),
+     W(0x16098374b6f45f36)},
+    0
+  },
+  {
+    {W(0x07b989bc0a3e2305), W(0xb46d6b33d297fdd8), W(0x20732fd2474173c0),
+     W(0x78d59def8e674a23)},
+    {W(0x78ab65e26f695876), W(0xdcf8170b518c50b2), W(0xc22623aa26a6afcc),
+     W(0xe0b55556c49e56ac)},
+    0
+  },
+  {
+    {W(0x6e4f190028eb177d), W(0x9cc18c2bdcac8561), W(0xe20a856770047b69),
+     W(0xfb77fc248dc6e70e)},
+    {W(0xa5d8e67bd98f09e3), W(0xd072ccfc7749d098), W(0x812f5b6f246192ee),
+     W(0x96e2c6a3bd80e68f)},
+    0
+  },
+  {
+    {W(0xfb98245a04753e86), W(0x643b456a22773af9), W(0x7a6a5e4299c24cf4),
+     W(0x2e88a19cff7d9e20)},
+    {W(0xabe4b8b1133e13a7), W(0x9136e7c32dbbfc16), W(0x1145d2775e597f75),
+     W(0xca335fa33e6c85a7)},
+    0
+  },
+  {
+    {W(0x9d7fcc2d8f67c0db), W(0xaeab99f1546d0cba), W(0x62cef19e37925c6f),
+     W(0x1f8c48031798dde1)},
+    {W(0x7206f8f23ae0fcc8), W(0x16df028d6310f952), W(0x02a1647c2227a995),
+     W(0xb0fd3ae282d37210)},
+    0
+  },
+  {
+    {W(0x2141de7d6b96bbe8), W(0x9b5f8f7fd2d3d94b), W(0xcb12fc3eba9f85f7),
+     W(0x05746e3f02de1fbc)},
+    {W(0xa53829e845910c37), W(0x00c599ebb44f9464), W(0xdb32f5975e3573f3),
+     W(0x8f1cd16d71ef1595)},
+    0
+  },
+  {
+    {W(0x6aaf060aeab181fc), W(0x1c2cce47bbeab35d), W(0x19b2ee3432f6a57c),
+     W(0x4c434113869fdb33)},
+    {W(0x8d1f81779d4ea936), W(0x7d4b4ce8a63a92e1), W(0x7736726575fe1d31),
+     W(0xd7d18794faa90e06)},
+    0
+  },
+  {
+    {W(0xd98e1f1e15a6b9e3), W(0xd0198ce810ff3249), W(0xe68c04eca103d702),
+     W(0xa8ee84f0e9a336c4)},
+    {W(0xc0697d2ee84a589c), W(0x91b42a4a1b61a5ad), W(0x344eb353f8386b2d),
+     W(0xf5876eff5c17ec96)},
+    0
+  },
+  {
+    {W(0x694eae324cb1673f), W(0xf68dbdd0951939c4), W(0x4a73053aa7ce1177),
+     W(0x84f07dda3fead2b7)},
+    {W(0x0c0d0183c49177dd), W(0xb1df02ecdbaf224f), W(0x6feee3e9d3e963da),
+     W(0xf071b890f872598d)},
+    0
+  },
+  {
+    {W(0xe9e7739874aea290), W(0xa70d8ce0d7acb286), W(0xa74f5fd84675e739),
+     W(0x3296d92042987de7)},
+    {W(0x420deba512fc8aff), W(0x0f14eb6b272fc49a), W(0xe0a76f84669d378d),
+     W(0x91e8183aacf035ce)},
+    0
+  },
+  {
+    {W(0x6c25349028b7d481), W(0x11a16fc9dbcf34bb), W(0x953258ca44679661),
+     W(0x39318c1c7cd1e230)},
+    {W(0x540d4fe05c1d56a0), W(0xe35a61b17ea66b8f), W(0x7a545b93f365bcc9),
+     W(0x99dcb938d12dd7ea)},
+    0
+  },
+  {
+    {W(0x090a80f5191d57eb), W(0x8734a132873bc2f1), W(0xa55372e36a3acc2d),
+     W(0xdc93b3c2a94a7613)},
+    {W(0xa6201e80f4df300e), W(0x9ce9a1fe15c508e0), W(0x45543166d8208f35),
+     W(0xe5f155fb38e66666)},
+    0
+  },
+  {
+    {W(0xdcce8eece77da963), W(0x78e8bb271e1b29d1), W(0x75560c64b021c8b8),
+     W(0x36f2c7e4be94c8a5)},
+    {W(0xd692cdfaacd16cff), W(0x38f91e9be115a7f3), W(0x10a15c9999e4549a),
+     W(0xb48ac7178fb16fc4)},
+    0
+  },
+  {
+    {W(0x7b90e9ed5d6878ab), W(0xb459e08341c378c0), W(0xd6e9350f2bad3b21),
+     W(0x4b22ec2400b70d06)},
+    {W(0x335c3a925c77706f), W(0x3264a08e4764ff1a), W(0x198276f17602ba50),
+     W(0xd8a04e91b80c46a9)},
+    0
+  },
+  {
+    {W(0xccc2faa58af59365), W(0x92db8698101966a7), W(0x95c0ad7f4e34d97b),
+     W(0xd13ce5b4f7f35e60)},
+    {W(0x9345b49951975f3a), W(0xf81c44bbb7746017), W(0xc7f8670d04dfc5f4),
+     W(0x0a542afd1f0daa8e)},
+    0
+  },
+  {
+    {W(0xd10eda7e5bd47db2), W(0x236cb21f7978b903), W(0x93229f6a14ff124b),
+     W(0x0ae544cc2d14e4ae)},
+    {W(0x894d44f6ff10cc15), W(0xd9e1d5efbf8220fe), W(0x4f4428f615977748),
+     W(0x410bae1d748d3ccc)},
+    0
+  },
+  {
+    {W(0x68abbbadfc0390fe), W(0x0a168854f29e6259), W(0xf2b0b2031df49ba0),
+     W(0x1e335ec402c27b90)},
+    {W(0xe6c9412a7c1eb34c), W(0x92f9cdcd2cee6fd1), W(0x69aa3eda824fc6ff),
+     W(0xe7cd7f402ba512e8)},
+    0
+  },
+  {
+    {W(0x51bfd3ef949cb04a), W(0x304370be5a3ae251), W(0xeb7e4e39a93d1d5f),
+     W(0x5095b10366583aef)},
+    {W(0xe6c90cf2727e2597), W(0x4b38a5aeb69867a4), W(0x91b00243622305ef),
+     W(0xfdc9ffcaaf596d88)},
+    0
+  },
+  {
+    {W(0xeefbf9b88d42aad2), W(0x9757535c6a034b38), W(0x9af932a527aedddd),
+     W(0x89fd1493cde7023c)},
+    {W(0x7b35f8e3b13d2520), W(0x6ad71ea762b25cfb), W(0xd8936b86a8c3fe48),
+     W(0x3f69d0bf1dc3ee5a)},
+    0
+  },
+  {
+    {W(0x175d55fcde77760d), W(0x340ab5f089a632a5), W(0x1efe3d4b08ffcc76),
+     W(0x7da8359fa873edc9)},
+    {W(0xa277dfaee57cbd2d), W(0xe76193d30f0d4443), W(0x940f4671c6ff6380),
+     W(0xa14b455fab9a1246)},
+    0
+  },
+  {
+    {W(0x6f8475902f6a2a69), W(0x6be524f31c164efb), W(0x05180887e102dfbc),
+     W(0xeadc6291cf620448)},
+    {W(0xd5aa751c9c41955c), W(0xafcc70e72d12e27a), W(0x62ec70c2d8c9c62b),
+     W(0xcb1d3af72187aa9f)},
+    0
+  },
+  {
+    {W(0x4d0c1e8bef6e575b), W(0x92b7a834553205c3), W(0xc48a7a505bab0b5f),
+     W(0x8183b235128441eb)},
+    {W(0x410d57ff39500df5), W(0x9fa4e970640cf63a), W(0xe4669f632a21f8e7),
+     W(0x5cb103016d09e705)},
+    0
+  },
+  {
+    {W(0x03ae4ecec790b6c5), W(0xd418d2ec0d7f3ff5), W(0xd83f41b7258f817b),
+     W(0xed8270de24183b04)},
+    {W(0xeed8f4204227306b), W(0xfb3d55737e6a5971), W(0x98dfcbbb45c0510f),
+     W(0xe7632dd9f408f72b)},
+    0
+  },
+  {
+    {W(0xcebed96f35c601ab), W(0x8ddb56e1c3e7a038), W(0x4386a6b06e858e43),
+     W(0x92fb43c190ff0c65)},
+    {W(0x2435648229353d61), W(0x174ca55971c94c20), W(0x7a9d16525c58b332),
+     W(0x379fa72ec56896e5)},
+    0
+  },
+  {
+    {W(0x25b7c69df67f8a4c), W(0x2b22e88f06cbab1d), W(0x7d76594796e06116),
+     W(0x555a072d6ade6782)},
+    {W(0x44b6258d049b5630), W(0x48e5cd48df1fbeae), W(0x2edc7ebc5aed08ef),
+     W(0x36117266c0d8d0ba)},
+    0
+  },
+  {
+    {W(0x6871812aaf7ca20e), W(0x64683770b84464f8), W(0xe6711919befca112),
+     W(0x29c898c6c169dde6)},
+    {W(0xcb7cfa165449ff91), W(0xe14f4a39dc356e3a), W(0x5a45b3b9e076ffac),
+     W(0x987099477ef5ba5e)},
+    0
+  },
+  {
+    {W(0x82dedefa481df455), W(0x50f7a2e479e4f248), W(0x2df6c384bc8b5bbe),
+     W(0x6857000d644dfb20)},
+    {W(0x9af5c65fe734cc73), W(0xc314a25c270e8775), W(0x0e36e164fe49f251),
+     W(0x22acdaeb208c57eb)},
+    0
+  },
+  {
+    {W(0x27a7e70d433e528f), W(0xdf1883da912618b8), W(0x1dc41d2358200fc2),
+     W(0xdb05578bd3fcd034)},
+    {W(0xbed733866911cffd), W(0x7d648c2c96f4a145), W(0xad00f182647e1461),
+     W(0xf8a7ebf7d6a7bb3c)},
+    0
+  },
+  {
+    {W(0xdad5508ace60b41c), W(0x08663876e736e145), W(0x7b8d4f1161c873e3),
+     W(0xc1a5aeb989f90ad9)},
+    {W(0x7ff8601c426b4eda), W(0x561755caf5a3b431), W(0xde3f82ed6fece20a),
+     W(0xa74a9b115d1f2230)},
+    0
+  },
+  {
+    {W(0x039b845142f0097e), W(0x6303d544e71c2d4c), W(0xcdaf1cf7a27cfe4a),
+     W(0x73a863d7688aa7cf)},
+    {W(0x5ff1e1ae4336a35a), W(0x3f1d9d68a2941c24), W(0x57728882c1b33a79),
+     W(0x6865829b82757937)},
+    0
+  },
+  {
+    {W(0xd752636bd10bdc37), W(0x5cbaa649e9d06a4b), W(0x850847d76f39ba0d),
+     W(0xc16815f55a122270)},
+    {W(0x848abf077438f22e), W(0xaf584f3b802cc31b), W(0x7f502cfbcbc6a7e6),
+     W(0xec0f0aaa494a32af)},
+    0
+  },
+  {
+    {W(0xa8d619843d32a4a8), W(0xaad9622f586603d0), W(0xae3f3c4c81fdf363),
+     W(0xee0b7e750f8e2dea)},
+    {W(0x38903f6048ded513), W(0x67f32ca28ae95e50), W(0xdc5050e6a3bbfb7d),
+     W(0xf8e1ca15efbcf0e9)},
+    0
+  },
+  {
+    {W(0x34bfb3fbbc6794e4), W(0x85fd58ba3d6ada58), W(0x3d6fd837ec90b7f3),
+     W(0x1936d25ba86f93aa)},
+    {W(0x94f86c3dcdc2ca96), W(0xac91baadc6d3e0ff), W(0xd71b5b5a44817495),
+     W(0x0fc69394181dae06)},
+    0
+  },
+  {
+    {W(0xbd8c060832b6d9d8), W(0xa2683f10d7ce88da), W(0x705b6f6a91a1d3ae),
+     W(0xc406cf71ac41b388)},
+    {W(0x7b9cabd902de2e3c), W(0x7d02dbe2f78a7225), W(0x8908ce5958790ff7),
+     W(0x62be687c16155395)},
+    0
+  },
+  {
+    {W(0x097979c1c1bc0867), W(0x876740f666bcc04d), W(0xf156ab11b3a56ca2),
+     W(0xf333504223e9ff1c)},
+    {W(0xb0e046da7ca81caa), W(0x0958e0a30831d76e), W(0xb28543ccecdb747f),
+     W(0xe9f548f88d4d26cb)},
+    0
+  },
+  {
+    {W(0x972934146715e830), W(0x9d634a6e7d090be1), W(0x387cbf26afc9c894),
+     W(0x7190d998a77641b9)},
+    {W(0x3ce49ec13e4bf806), W(0xd9b875695681c650), W(0x9a901a49498e5bb6),
+     W(0x58854d89ccc03f9f)},
+    0
+  },
+  {
+    {W(0x62250e602cf3c8a3), W(0x68d39047c4cdffd8), W(0xf1b3cc3bcbfbe7db),
+     W(0xed3716e148cdd138)},
+    {W(0xbf1a8871e10c114f), W(0x417541ca9e6546e0), W(0x122a5c0334ec4f31),
+     W(0xe101a6e5e0952915)},
+    0
+  },
+  {
+    {W(0xa255b8ca3450a815), W(0xc10ba56f142c7131), W(0x355c1c67fe784877),
+     W(0x43690f41871bd0ec)},
+    {W(0x9a211f19ab346944), W(0xe3ac5f1c36e4d8bc), W(0x3f2c33a255a4ac37),
+     W(0x8ef91117f04adb3b)},
+    0
+  },
+  {
+    {W(0x6bcacab88057e0cd), W(0x113890aa13dd000b), W(0x6edaa89b25830951),
+     W(0x6f9486d57b3b5b18)},
+    {W(0x9b47f1a4f98ad1d1), W(0xa4252478978d8d5a), W(0xb4b111fbe24a840c),
+     W(0x7f666ec8d3b13486)},
+    0
+  },
+  {
+    {W(0x1896cb9332d7523f), W(0xd069f1765bf4650e), W(0x5f10d9f0951b7c5f),
+     W(0xc7dd047a6d88f4cd)},
+    {W(0x090e15aef59eef69), W(0x3364940e28e89f9b), W(0x4937c35d0c1386e6),
+     W(0x5c4b2cec47cad931)},
+    0
+  },
+  {
+    {W(0x0ecfb6c735240838), W(0x56e068f379eab58a), W(0x9ccbf3b9ac61cc17),
+     W(0x5746051d3b012667)},
+    {W(0x22c2089977464f82), W(0x580a32a2e33d5971), W(0xcc2c382b3f2db214),
+     W(0xd9f333b727c3f139)},
+    0
+  },
+  {
+    {W(0xb04848e0b20ae93c), W(0x9a333cb99d1a0de5), W(0x26d7c8314292e76c),
+     W(0xb0f646352bffa775)},
+    {W(0xd558a8f0f2bac9dc), W(0xbf517092b4a3eeeb), W(0x01f11c27fb67c829),
+     W(0x445b91bfd72aca86)},
+    0
+  },
+  {
+    {W(0xfd42005a40aed691), W(0x881df3143a72974d), W(0x5b24a4fd1e37b282),
+     W(0xef571b3c50b3383e)},
+    {W(0x19d5a17f27078ca8), W(0xd7eac5ea3b2fa140), W(0x99dba46056148d8d),
+     W(0xa60d112942530169)},
+    0
+  },
+  {
+    {W(0x27178b315d635061), W(0xc36ad28cb4a71f19), W(0x06d4b6d1bbeeaf0a),
+     W(0x3adc2d5aaafc249d)},
+    {W(0xcaeb4a7a4190eb59), W(0x9d0d466c0bd651a1), W(0x01e8d838bf61e100),
+     W(0x789bf253425d8cc9)},
+    0
+  },
+  {
+    {W(0xb5b7eb6bbb310703), W(0x2330c607aa16d4b0), W(0xdbbc7ef0f9454031),
+     W(0x2c48c5f3c9856e7b)},
+    {W(0x38a1a20c1835cf5e), W(0xc1f8e0d4f1f5d293), W(0x94bc08699a0ac5f9),
+     W(0xd7dcc7283d92b02c)},
+    0
+  },
+  {
+    {W(0x85b5ba19a123d9a1), W(0x83b4eacb0695af84), W(0x83f33142e308fad8),
+     W(0x19b44584365bf31e)},
+    {W(0xc74f16211a3074dd), W(0xb97c4c4f9760a04d), W(0xb2d5f8f1654372ef),
+     W(0x2b42b3a30e0625a3)},
+    0
+  },
+  {
+    {W(0xa4aaf2fb581dd534), W(0xc0cc9f20a0a4bd55), W(0xa6041632593f83b8),
+     W(0xc92c864fe7118d32)},
+    {W(0xefbea617de2a2c86), W(0xff8b45590d5bc92f), W(0x2b321d02a999352d),
+     W(0x0831f4ccc7bc4e2b)},
+    0
+  },
+  {
+    {W(0xb478de3d9b3647f9), W(0x501d20c3179969f2), W(0x0d93f7cccf3fd1b9),
+     W(0x2c1ba7fa74c69e49)},
+    {W(0x2c0df25f96c8fe01), W(0xd1392c34878521f5), W(0xc2fbc0b2fea780ce),
+     W(0x0e773fbce28ec024)},
+    0
+  },
+  {
+    {W(0xfe5c43df5c6f7bb2), W(0xda85415d70515f79), W(0xcea75f4c9f5b1a65),
+     W(0xd34261a536de31ec)},
+    {W(0x719ccc52e9d836dd), W(0x9282859bac94830c), W(0xc600d91bef897d98),
+     W(0xfe4fa0e607e35c9a)},
+    0
+  },
+  {
+    {W(0xc51b86b551c2143a), W(0x4581e8d6730eadd4), W(0xd4f99b12a2f9b8cd),
+     W(0x40fe30904643c723)},
+    {W(0xe37514de7f8eb401), W(0x3eb952bde629f740), W(0x6e8a897c31819a33),
+     W(0xafee99930ebf6bf0)},
+    0
+  },
+  {
+    {W(0x08aeed1ac78478b5), W(0x7d23bbd1dda93ed6), W(0x00f86124e30cabcc),
+     W(0xa592cea6c5bac714)},
+    {W(0xbff7b1a10c601356), W(0x54a2250c2de506dc), W(0x8c1185d6818cfa63),
+     W(0xee0099a9d6b84961)},
+    0
+  },
+  {
+    {W(0xc1beb0e9957ce350), W(0x67cc250ed47b5a9a), W(0x6da361c23b2014ce),
+     W(0xf88ef31bef4d5a21)},
+    {W(0xf3c6260d08a6a1a5), W(0x7fa51cabd0ea8d64), W(0xdc86259593ce7ebe),
+     W(0x174c43e021605feb)},
+    0
+  },
+  {
+    {W(0xd0fc227b7eee20c9), W(0x77a04e009e2f5f4c), W(0x5fd03cd348056393),
+     W(0x8d0a038a5f1f020d)},
+    {W(0x1f1f2df9b41b5bce), W(0x51dba091f2b41d9c), W(0x307320a7023df20b),
+     W(0xba04bace517729fa)},
+    0
+  },
+  {
+    {W(0x3e39405aa1310ae7), W(0xaca94c38ba4e0278), W(0x19159e84a608e8a3),
+     W(0x9fb644705779be9c)},
+    {W(0xce76a5d7930cda1f), W(0x2fa56f99c1531e56), W(0x8bfb3d7c7587bd07),
+     W(0x17798569b2c7ab3f)},
+    0
+  },
+  {
+    {W(0xe3ac00b01d8cb7dc), W(0xf3e53bc4cd6bdec3), W(0xa157f853e317bd9d),
+     W(0xcefc53811bca96ad)},
+    {W(0xeccf90ed74fbafca), W(0xfe8b78edb232f41f), W(0x7b5d273ef7b30b86),
+     W(0xbb8fc385dfc414ec)},
+    0
+  },
+  {
+    {W(0xef35ab6739e57668), W(0x671c2291bdf6647d), W(0xe52383f085724e51),
+     W(0xfd59344005546fcc)},
+    {W(0x75f9210eb19e2222), W(0x657e774578da14d1), W(0x22f3e04f43b0ecf7),
+     W(0xb4480c77eb5c0220)},
+    0
+  },
+  {
+    {W(0xaeb80b9c0462d3c3), W(0x740b668021f36bcf), W(0x7ac4c654f31e1a92),
+     W(0xb4d451b50e59b381)},
+    {W(0x0a3c45608f282415), W(0xff5e00e0f682af18), W(0x6d795dc4d6acc3b6),
+     W(0xe86df58fe301149e)},
+    0
+  },
+  {
+    {W(0xc9b6d16c698a3616), W(0xe5e1195582a7d742), W(0x5b1d203033c5311c),
+     W(0x5dde86af061d8e43)},
+    {W(0xfb3973d1d8b09d7c), W(0x0aad9d298b24bd77), W(0xf7e8df6069d30159),
+     W(0x3d7cdc62e2c8a3dc)},
+    0
+  },
+  {
+    {W(0x10ce2157efdb4651), W(0x464714478449754c), W(0xd3786e1c412e4203),
+     W(0x7eedcdad652769fd)},
+    {W(0x87e5af9be5a7725c), W(0xa37a79d8bad605f4), W(0xbbaae31a44d6c650),
+     W(0x63dba66335322614)},
+    0
+  },
+  {
+    {W(0x56567671246fe17d), W(0x6bdd5939fb58e108), W(0x6bf494582db0ef78),
+     W(0x961a02fbaff67f8a)},
+    {W(0x938eea7857a8119a), W(0x90604d339e3cc1fb), W(0x0227094fa4b6d913),
+     W(0x5b1c25146df9ac5a)},
+    0
+  },
+  {
+    {W(0x088306025b32d945), W(0xe1815a9cf5c867b7), W(0x53e97bf9bccfed9f),
+     W(0xf2189b72bb6ddcaa)},
+    {W(0xe7679dee4f778534), W(0x3d96f7404e328409), W(0x3a8eccd0a5566d67),
+     W(0x0972d510f97efec2)},
+    0
+  },
+  {
+    {W(0xad2635d12f727351), W(0x29888bd2dcb03b94), W(0xd5f1c028c8fd8c60),
+     W(0xa20c2a1929667b7a)},
+    {W(0x07fa689ca98e4232), W(0x7112261d42c5c044), W(0xe2f6ab7c32445edb),
+     W(0xc66eb1f56da76ba6)},
+    0
+  },
+  {
+    {W(0x8e7696d1c949db76), W(0xea5cba89e694851b), W(0x3eadb441d8e3578f),
+     W(0xc18c7b4468e767dc)},
+    {W(0xde14292bb60adae4), W(0x8f5e9b115a691bc5), W(0xdc28a6f014243827),
+     W(0x9c2466b38fdc01a6)},
+    0
+  },
+  {
+    {W(0x107c58c55091c00d), W(0xb823611eda73e715), W(0x167875bca83e565c),
+     W(0xe648bb40016c8a30)},
+    {W(0xcca9230c3f36360b), W(0x5157d7a31d41c1d8), W(0x9a213cae5c7f87b7),
+     W(0x93523788499ea8d6)},
+    0
+  },
+  {
+    {W(0xe8248bf3f6b5538a), W(0xc95b77d9088e8a3c), W(0x6182706b252f8bff),
+     W(0x4d2a4ec4950f3989)},
+    {W(0x7b9cd9be0af8fb8f), W(0x78cfc396368ec7e1), W(0x9d4138de208862bc),
+     W(0x2ebc67d6b827592c)},
+    0
+  },
+  {
+    {W(0xb42d13cb4da05e5f), W(0x06857f3b1e2c3d63), W(0xc51cec6b7725f913),
+     W(0x5041f07e4837c41e)},
+    {W(0x24f99af26184d2f2), W(0x3eb610f9ee6c2293), W(0xae513b0c51e380a7),
+     W(0x364e005b6192f201)},
+    0
+  },
+  {
+    {W(0xd0d1b746c71749a9), W(0xc2bb032b9af5ca59), W(0xce88a51510bba8aa),
+     W(0x551e80525ea3a39a)},
+    {W(0x94830c9e5c868f8c), W(0x9bde35af3be173b8), W(0x1fb5084fe74024c5),
+     W(0xb639b677275326dd)},
+    0
+  },
+  {
+    {W(0xd51aa3b3cef3baae), W(0x84a66cd3e0bdd546), W(0x1d76080382851b1d),
+     W(0x3b8627eb67627ec7)},
+    {W(0x1dcfdea896c09270), W(0xaa89448648184877), W(0x18f583bcc78acaba),
+     W(0x1bcbc3fc9e3569c3)},
+    0
+  },
+  {
+    {W(0x280745433983fb72), W(0x23cb27facc62b7b0), W(0x2e93aea20dbe278f),
+     W(0x061a056ccdee616e)},
+    {W(0x93ef0229c4e17b45), W(0x4f1c1572f6149f87), W(0xc36cf99e18090322),
+     W(0x2b2e65859f393571)},
+    0
+  },
+  {
+    {W(0xa4ddfaab467a2a45), W(0xc937c41a3e3d5622), W(0x90618710fbac4e7a),
+     W(0x4214832aacd03464)},
+    {W(0x385197780c1cf5bc), W(0x8a7fe4e414221d85), W(0xcd648aec27eca4e3),
+     W(0xd92ca4c39c0f3f24)},
+    0
+  },
+  {
+    {W(0x623c6e4e126f4362), W(0x92af899236e8506e), W(0x8e3780a7f2ddfcc9),
+     W(0x2342d687e20cf972)},
+    {W(0xb673a8691acab24d), W(0x24327cd2c3059a1f), W(0xd302992aea01f40a),
+     W(0xb4ce7f003a0eba64)},
+    0
+  },
+  {
+    {W(0x4cea8692d16fa57c), W(0x6efb6849f1eacacb), W(0xd0a6dd3e79c20402),
+     W(0x11833074a65a670b)},
+    {W(0x25b0735f4f122066), W(0xc508f3a6a03e530e), W(0xc097e1d17934bbd4),
+     W(0x446e906564b05e39)},
+    0
+  },
+  {
+    {W(0xc1cb2f1f1c73c76a), W(0xc0c378e61607474c), W(0x27c7529a23cbfab0),
+     W(0x578a4586a1df41d0)},
+    {W(0xf891801445705909), W(0x38ea98649cd83271), W(0xbcdc45a78599f47a),
+     W(0x38375d661a6dfe45)},
+    0
+  },
+  {
+    {W(0x04cc64b72efd8e63), W(0x2f76481c92f379e2), W(0x84151fb1e98626fd),
+     W(0x72d73b4f574ff827)},
+    {W(0x4b53a421f0a150c6), W(0xbf80ebe805ba71c8), W(0xd28208be1145c0ff),
+     W(0x5464c631a297cf15)},
+    0
+  },
+  {
+    {W(0xb712db587b90400d), W(0xd7088dfb95aeb6c9), W(0xef35767bf34b71d8),
+     W(0x44b48ddc7f7da99e)},
+    {W(0x0147de55b2311b80), W(0x7155f10762ce8951), W(0x402bdfe0b589d2b8),
+     W(0x77fc2e0cfdcbbae8)},
+    0
+  },
+  {
+    {W(0xce5450cb81e7d78c), W(0x93bd1e157ed5b7ca), W(0xc24df622c0b86f01),
+     W(0x7e0965d39855bad1)},
+    {W(0xfe03a9eb4f567a11), W(0x33fb1d8a9452cb69), W(0xbbf1ea4d0640b742),
+     W(0x85e37df221dd0b56)},
+    0
+  },
+  {
+    {W(0xcfa251d9515a37b0), W(0x7edf77b3c33e28fd), W(0xe92a607d4ef8fa17),
+     W(0xea17afe2024f0cad)},
+    {W(0xea97f448cd3d9b44), W(0x161055c9d8f53bf5), W(0x2a46c8d0bfa74051),
+     W(0xe02b1f7fa198f95d)},
+    0
+  },
+  {
+    {W(0x1a26bfcb4ae9da06), W(0xd1faf4290c2de5fc), W(0xd88dfa93d5db490c),
+     W(0x2514e819cbc1b25d)},
+    {W(0x40edcf6212089ef9), W(0x760e5f844ffb286d), W(0xcdd684bde1bcdebe),
+     W(0xf26006b8282aeae0)},
+    0
+  },
+  {
+    {W(0x564343133ae43e46), W(0x32d4380093f7f248), W(0x8a836de339250ffb),
+     W(0x9fe17809d252bcd4)},
+    {W(0x928ab30df4eb46f6), W(0x4240c312314fa9ce), W(0x8b9608ed06aaa2e9),
+     W(0xf275ac2d5741a81d)},
+    0
+  },
+  {
+    {W(0x1036f86b827769c2), W(0xc79986839e5fbd33), W(0x1fa2436e000a891f),
+     W(0xd5206db9f6262ec9)},
+    {W(0x3e8d3dba3d498a00), W(0xa2f7982069b131e7), W(0x8541432be41c4f2f),
+     W(0x3350be760036942c)},
+    0
+  },
+  {
+    {W(0xb7f7a66dd0900f43), W(0xdd6f5db823216606), W(0x62b414a2c767580d),
+     W(0x0e22cb08fe982e01)},
+    {W(0xf9ef9eeb2bb901a8), W(0x1cc5b2ab338a484e), W(0x6af76c39f0f937f7),
+     W(0xd06c70d8e898bd3e)},
+    0
+  },
+  {
+    {W(0xbe7bf1e176172d07), W(0xfc8173c1936e5f36), W(0x9c61e4fc355c7f85),
+     W(0xb0354cd9ae4dc37f)},
+    {W(0xac599b84883dac30), W(0xe296ef32b0a0c2b9), W(0x78b286fcf901ed0c),
+     W(0xddd0517f086af1d4)},
+    0
+  },
+  {
+    {W(0x78933e28ce049ed3), W(0x7828fbb20119aeaf), W(0xe0b788e39d1bb422),
+     W(0x88ecd80ecf3e8e6c)},
+    {W(0x5cde1f5747cd2033), W(0x762473d7d13a1c44), W(0x1ea53ca3cf59a03a),
+     W(0x020dc47ef714800d)},
+    0
+  },
+  {
+    {W(0xfef42246646525a6), W(0xf56a1f47c3b8da13), W(0x43d652f999b80d1a),
+     W(0xf6413e95d11375c8)},
+    {W(0xe430e5574b313cfd), W(0x4f7f3765df908fe5), W(0xadc2d898faed8fb7),
+     W(0x7ca09ad447a47bb8)},
+    0
+  },
+  {
+    {W(0x75ba40d2b78640f1), W(0x339f0a29ed45a779), W(0xc5d69ee60f4f5686),
+     W(0xc854e27f83747790)},
+    {W(0xe50758ab3cabf36e), W(0xdbc04ed1d905d6b0), W(0xf900dab84e27147c),
+     W(0x15397309b7fdf10e)},
+    0
+  },
+  {
+    {W(0x3554ac0dca7157d8), W(0xfddd58f4c1886a6f), W(0x029f8b0dd2d9ae61),
+     W(0x82c7379ebaed4566)},
+    {W(0xa4c7cdc1ae4bcfea), W(0x6d16484b09e923e5), W(0x49eb190444d2c94c),
+     W(0x69995f3265ca7e08)},
+    0
+  },
+  {
+    {W(0x30361b9d26f314a9), W(0x8488f316026752dc), W(0x0da167f2e8f4c9e0),
+     W(0xfe95d8b98f2d0d3c)},
+    {W(0xa8fcab35266d902d), W(0xb1004894b13e251c), W(0x7c4b44c65925135d),
+     W(0x4bfac5dc40fc58ec)},
+    0
+  },
+  {
+    {W(0x6d88529e6c4d3b0b), W(0x1cd9b02ee0e40628), W(0x487360e79a18f123),
+     W(0xf31ff25934b1a4d4)},
+    {W(0x00aef4a599071a6d), W(0x137b64d7e365d8b3), W(0xe73c09f10b24d7de),
+     W(0xe31f3946686826fe)},
+    0
+  },
+  {
+    {W(0x8199a0d6225c6339), W(0x6f46bb4560750b49), W(0x6002cb313bb318fe),
+     W(0x06d5990e14ee373a)},
+    {W(0xbc02378432b34ef2), W(0xf3871f60e54ecc5b), W(0x07f7982dc39e1d90),
+     W(0x7b8530d5a73f469e)},
+    0
+  },
+  {
+    {W(0xb5b66a8ee23f7002), W(0xb89b9a467fa436cb), W(0xfb9598c141ef10c4),
+     W(0x054155f9cf6b8982)},
+    {W(0xb775e597d20b7d90), W(0xe381a950f5c54472), W(0xabab8da4a9b3ce62),
+     W(0x31d812dae23bceb1)},
+    0
+  },
+  {
+    {W(0x3ec88029d1c01eab), W(0xce68664db8a5daa9), W(0x785d32e829be2a23),
+     W(0xb562e0df5601b580)},
+    {W(0xb867d54259674fd8), W(0x380f9f051f256aa5), W(0x13e3368259c8db33),
+     W(0x01bffd806be6771d)},
+    0
+  },
+  {
+    {W(0xd91207613f4c8100), W(0x0429b49fb5ddf02c), W(0x6bd9d8b8516b72dc),
+     W(0x693e1796c9f9d9a0)},
+    {W(0xf9b85dbd4c426560), W(0x1ea8ad214899fc65), W(0xe6bcadf7266a4835),
+     W(0x8c1d05b50b822f57)},
+    0
+  },
+  {
+    {W(0xf3fd6e0315c82f55), W(0x9a495431a0dae71f), W(0x54e1e3f339fb9deb),
+     W(0x860568da9f15d496)},
+    {W(0x27a20143170c52db), W(0x06c58438e7b4a1c3), W(0x4eabba716aed7a84),
+     W(0x17b549d3f6172493)},
+    0
+  },
+  {
+    {W(0x2c87ea85c182ec9a), W(0x03c95dac7df8de38), W(0x1012c7103001f408),
+     W(0xf30c364792eac8c0)},
+    {W(0x71f31a471fbd6112), W(0x163e86de2cb69d42), W(0x86a56ea709e9b933),
+     W(0x20d7b34c08fb9c49)},
+    0
+  },
+  {
+    {W(0xcb29f5c9eadefe03), W(0xb383ca5c9660a626), W(0x369e353865230aa4),
+     W(0xb4d400ec042ae9df)},
+    {W(0xa9ed6eb6bbf80d6a), W(0x96d088cb104eff7e), W(0x52ca3d63fc30133c),
+     W(0x7b646d01ac584183)},
+    0
+  },
+  {
+    {W(0x8babd157bc1e20b6), W(0x125e85f6a35edd7d), W(0xe6298a3820bd5790),
+     W(0x3356bfef55f32850)},
+    {W(0x9c3dc47eeac90826), W(0x837370dfd8608d47), W(0x8f98f361e8f8ab05),
+     W(0x0c9d1ed7d9d2d2ee)},
+    0
+  },
+  {
+    {W(0x14e02823737f4c1e), W(0x533302c5a4a5be76), W(0x3e0f1dba2bbe23d0),
+     W(0x78580e830163f582)},
+    {W(0x3c76ad5885e308fb), W(0xfb7dfe1a8aca0cec), W(0x29df27fe342d5826),
+     W(0x071bb1d7c3c1502a)},
+    0
+  },
+  {
+    {W(0xf8ec73fa27090d8d), W(0x92ea6306021cf7be), W(0x828a6e7ea06de66d),
+     W(0x39519ea392714828)},
+    {W(0x0bbbd4fc7a201f4c), W(0xeafa745cc137ee32), W(0xa204c3126c083522),
+     W(0xe9f2a35f3fd4e3c6)},
+    0
+  },
+  {
+    {W(0xdcf73dd547b5e1c0), W(0x32d6968737543118), W(0x4cea20a3505605de),
+     W(0x7db37c69734b787e)},
+    {W(0x7da3535ab5eb107c), W(0x5ceedbd58c3f72d3), W(0x4157551c46f3b968),
+     W(0xd0f3d0e33c3db6b4)},
+    0
+  },
+  {
+    {W(0x85148dcd3128db48), W(0x9be1b9e72f450e0f), W(0x64983a1fc31bce65),
+     W(0x6a28b2dc3f8bb034)},
+    {W(0xe783b07b4c6e8a32), W(0x711d4d374d22d8cd), W(0x5cb08b44a7b71513),
+     W(0x0a578acc2393927a)},
+    0
+  },
+  {
+    {W(0x33c1ca7eb1dd3e19), W(0x6ead2a755f378af9), W(0x2605294ad319546e),
+     W(0x454f871d2a605b6f)},
+    {W(0xc03da07e64045193), W(0x690510fda64796d6), W(0xec09edc21ea58d1c),
+     W(0x8d70a112bd6b7ddc)},
+    0
+  }
+};
+
+static const wei_tables_t tables_secp256k1 = {
+  secp256k1_wnd_fixed,
+  secp256k1_wnd_naf,
+  secp256k1_wnd_endo
+};
+
+#undef W
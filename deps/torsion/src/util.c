@@ -59,6 +59,51 @@ torsion_memequal(const void *s1, const void *s2, size_t n) {
   return (z - 1) >> 31;
 }
 
+/*
+ * Atomics
+ *
+ * Just enough to share a flag between threads: an
+ * acquire load and a release store on an int. We
+ * use the compiler's builtins where available and
+ * fall back to a full barrier (or, failing that,
+ * a plain volatile access) elsewhere.
+ *
+ * Resources:
+ *   https://gcc.gnu.org/onlinedocs/gcc/_005f_005fatomic-Builtins.html
+ *   https://docs.microsoft.com/en-us/windows/win32/sync/interlocked-variable-access
+ */
+
+int
+torsion_atomic_load(const volatile int *ptr) {
+#if defined(__ATOMIC_ACQUIRE)
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#elif defined(_WIN32)
+  STATIC_ASSERT(sizeof(int) == sizeof(LONG));
+  return InterlockedCompareExchange((volatile LONG *)ptr, 0, 0);
+#elif TORSION_GNUC_PREREQ(4, 1)
+  int val = *ptr;
+  __sync_synchronize();
+  return val;
+#else
+  return *ptr;
+#endif
+}
+
+void
+torsion_atomic_store(volatile int *ptr, int val) {
+#if defined(__ATOMIC_RELEASE)
+  __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+#elif defined(_WIN32)
+  STATIC_ASSERT(sizeof(int) == sizeof(LONG));
+  InterlockedExchange((volatile LONG *)ptr, val);
+#elif TORSION_GNUC_PREREQ(4, 1)
+  __sync_synchronize();
+  *ptr = val;
+#else
+  *ptr = val;
+#endif
+}
+
 /*
  * Murmur3
  *
@@ -0,0 +1,53 @@
+/*!
+ * batch.js - batch verification helpers for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+const assert = require('../internal/assert');
+
+/*
+ * Batch
+ */
+
+function findInvalid(batch, verifyBatch) {
+  assert(Array.isArray(batch));
+  assert(typeof verifyBatch === 'function');
+
+  const out = [];
+
+  // The range is known to contain an invalid
+  // signature. Bisect with sub-batches until
+  // we are down to individual items.
+  const bisect = (start, end) => {
+    if (end - start === 1) {
+      out.push(start);
+      return;
+    }
+
+    const mid = (start + end) >>> 1;
+
+    if (!verifyBatch(batch.slice(start, mid))) {
+      bisect(start, mid);
+
+      // Both halves may contain invalid items.
+      if (verifyBatch(batch.slice(mid, end)))
+        return;
+    }
+
+    bisect(mid, end);
+  };
+
+  if (!verifyBatch(batch))
+    bisect(0, batch.length);
+
+  return out;
+}
+
+/*
+ * Expose
+ */
+
+exports.findInvalid = findInvalid;
@@ -102,6 +102,23 @@ function encode(data) {
   return str;
 }
 
+/**
+ * Encode several base58 strings.
+ * @param {Buffer[]} items
+ * @returns {String[]}
+ */
+
+function encodeBatch(items) {
+  assert(Array.isArray(items));
+
+  const out = new Array(items.length);
+
+  for (let i = 0; i < items.length; i++)
+    out[i] = encode(items[i]);
+
+  return out;
+}
+
 /**
  * Decode a base58 string.
  * @param {String} str
@@ -199,5 +216,6 @@ function test(str) {
 
 exports.native = 0;
 exports.encode = encode;
+exports.encodeBatch = encodeBatch;
 exports.decode = decode;
 exports.test = test;
@@ -232,6 +232,19 @@ async function pbkdfAsync(pass, salt, rounds, size) {
   return pbkdf(pass, salt, rounds, size);
 }
 
+async function pbkdfBatchAsync(items, rounds, size, jobs) {
+  assert(Array.isArray(items));
+
+  const keys = [];
+
+  for (const item of items) {
+    assert(Array.isArray(item) && item.length === 2);
+    keys.push(pbkdf(item[0], item[1], rounds, size));
+  }
+
+  return Buffer.concat(keys, items.length * size);
+}
+
 /*
  * Hashing
  */
@@ -496,3 +509,4 @@ exports.verify = verify;
 exports.hash256 = hash256;
 exports.pbkdf = pbkdf;
 exports.pbkdfAsync = pbkdfAsync;
+exports.pbkdfBatchAsync = pbkdfBatchAsync;
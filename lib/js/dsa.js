@@ -519,10 +519,11 @@ function paramsGenerate(bits) {
 /**
  * Generate params.
  * @param {Number} [bits=2048]
+ * @param {Number} [jobs=1]
  * @returns {Buffer}
  */
 
-async function paramsGenerateAsync(bits) {
+async function paramsGenerateAsync(bits, jobs) {
   return paramsGenerate(bits);
 }
 
@@ -665,11 +666,12 @@ function privateKeyGenerate(bits) {
 /**
  * Generate private key.
  * @param {Number} [bits=2048]
+ * @param {Number} [jobs=1]
  * @returns {Buffer}
  */
 
-async function privateKeyGenerateAsync(bits) {
-  const params = await paramsGenerateAsync(bits);
+async function privateKeyGenerateAsync(bits, jobs) {
+  const params = await paramsGenerateAsync(bits, jobs);
   return privateKeyCreate(params);
 }
 
@@ -79,6 +79,12 @@ class ECDSA {
     return this.curve.fieldBits;
   }
 
+  precompute(width) {
+    // The JS backend has its own tables.
+    assert((width >>> 0) === width);
+    return this;
+  }
+
   privateKeyGenerate() {
     const a = this.curve.randomScalar(rng);
     return this.curve.encodeScalar(a);
@@ -245,6 +251,16 @@ class ECDSA {
     return true;
   }
 
+  publicKeyParse(key) {
+    // The JS backend only caches the decoded point.
+    assert(Buffer.isBuffer(key));
+
+    return {
+      point: this.curve.decodePoint(key),
+      raw: Buffer.from(key)
+    };
+  }
+
   publicKeyExport(key) {
     const {x, y} = this.curve.decodePoint(key);
 
@@ -386,6 +402,10 @@ class ECDSA {
     return this._encodeCompact(r, s);
   }
 
+  async signAsync(msg, key) {
+    return this.sign(msg, key);
+  }
+
   signRecoverable(msg, key) {
     const [r, s, param] = this._sign(msg, key);
     return [this._encodeCompact(r, s), param];
@@ -396,6 +416,10 @@ class ECDSA {
     return this._encodeDER(r, s);
   }
 
+  async signDERAsync(msg, key) {
+    return this.signDER(msg, key);
+  }
+
   signRecoverableDER(msg, key) {
     const [r, s, param] = this._sign(msg, key);
     return [this._encodeDER(r, s), param];
@@ -514,12 +538,16 @@ class ECDSA {
     }
 
     try {
-      return this._verify(msg, r, s, key);
+      return this._verify(msg, r, s, this.curve.decodePoint(key));
     } catch (e) {
       return false;
     }
   }
 
+  async verifyAsync(msg, sig, key) {
+    return this.verify(msg, sig, key);
+  }
+
   verifyDER(msg, sig, key) {
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
@@ -533,13 +561,36 @@ class ECDSA {
     }
 
     try {
-      return this._verify(msg, r, s, key);
+      return this._verify(msg, r, s, this.curve.decodePoint(key));
+    } catch (e) {
+      return false;
+    }
+  }
+
+  async verifyDERAsync(msg, sig, key) {
+    return this.verifyDER(msg, sig, key);
+  }
+
+  verifyParsed(msg, sig, key) {
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(key && key.point && key.point.curve === this.curve);
+
+    let r, s;
+    try {
+      [r, s] = this._decodeCompact(sig);
+    } catch (e) {
+      return false;
+    }
+
+    try {
+      return this._verify(msg, r, s, key.point);
     } catch (e) {
       return false;
     }
   }
 
-  _verify(msg, r, s, key) {
+  _verify(msg, r, s, A) {
     // ECDSA Verification.
     //
     // [SEC1] Page 46, Section 4.1.4.
@@ -573,7 +624,6 @@ class ECDSA {
     const {n} = this.curve;
     const G = this.curve.g;
     const m = this._reduce(msg);
-    const A = this.curve.decodePoint(key);
 
     if (r.isZero() || r.cmp(n) >= 0)
       return false;
@@ -612,6 +662,10 @@ class ECDSA {
     return A.encode(compress);
   }
 
+  async recoverAsync(msg, sig, param, compress) {
+    return this.recover(msg, sig, param, compress);
+  }
+
   recoverDER(msg, sig, param, compress) {
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
@@ -635,6 +689,10 @@ class ECDSA {
     return A.encode(compress);
   }
 
+  async recoverDERAsync(msg, sig, param, compress) {
+    return this.recoverDER(msg, sig, param, compress);
+  }
+
   _recover(msg, r, s, param) {
     // ECDSA Public Key Recovery.
     //
@@ -726,14 +784,34 @@ class ECDSA {
     return this.schnorr.sign(msg, key);
   }
 
+  async schnorrSignAsync(msg, key) {
+    return this.schnorr.sign(msg, key);
+  }
+
   schnorrVerify(msg, sig, key) {
     return this.schnorr.verify(msg, sig, key);
   }
 
+  async schnorrVerifyAsync(msg, sig, key) {
+    return this.schnorr.verify(msg, sig, key);
+  }
+
   schnorrVerifyBatch(batch) {
     return this.schnorr.verifyBatch(batch);
   }
 
+  async schnorrVerifyBatchAsync(batch, jobs) {
+    return this.schnorr.verifyBatch(batch);
+  }
+
+  schnorrFindInvalid(batch) {
+    return this.schnorr.findInvalid(batch);
+  }
+
+  async schnorrFindInvalidAsync(batch, jobs) {
+    return this.schnorr.findInvalid(batch);
+  }
+
   /*
    * Helpers
    */
@@ -81,6 +81,7 @@
 'use strict';
 
 const assert = require('../internal/assert');
+const batchUtil = require('../internal/batch');
 const BatchRNG = require('./batch-rng');
 const BN = require('../bn');
 const elliptic = require('./elliptic');
@@ -151,6 +152,12 @@ class EDDSA {
     return this.curve.fieldBits;
   }
 
+  precompute(width) {
+    // The JS backend has its own tables.
+    assert((width >>> 0) === width);
+    return this;
+  }
+
   hashNonce(prefix, msg, ph, ctx) {
     const hash = new Hash(this);
 
@@ -349,6 +356,19 @@ class EDDSA {
     return true;
   }
 
+  publicKeyParse(key) {
+    // The JS backend only caches the decoded point.
+    assert(Buffer.isBuffer(key));
+
+    if (key.length !== this.curve.adjustedSize)
+      throw new Error('Invalid public key.');
+
+    return {
+      point: this.curve.decodePoint(key),
+      raw: Buffer.from(key)
+    };
+  }
+
   publicKeyIsInfinity(key) {
     assert(Buffer.isBuffer(key));
 
@@ -465,6 +485,27 @@ class EDDSA {
     return P.encode();
   }
 
+  publicKeyMulMulti(keys, tweaks) {
+    assert(Array.isArray(keys));
+    assert(Array.isArray(tweaks));
+    assert(keys.length === tweaks.length);
+
+    const points = [];
+    const coeffs = [];
+
+    for (let i = 0; i < keys.length; i++) {
+      const A = this.curve.decodePoint(keys[i]);
+      const t = this.curve.decodeScalar(tweaks[i]).imod(this.curve.n);
+
+      points.push(A);
+      coeffs.push(t);
+    }
+
+    const P = this.curve.mulAll(points, coeffs);
+
+    return P.encode();
+  }
+
   publicKeyNegate(key) {
     const A = this.curve.decodePoint(key);
     const P = A.neg();
@@ -477,6 +518,10 @@ class EDDSA {
     return this.signWithScalar(msg, key, prefix, ph, ctx);
   }
 
+  async signAsync(msg, secret, ph, ctx) {
+    return this.sign(msg, secret, ph, ctx);
+  }
+
   signWithScalar(msg, scalar, prefix, ph, ctx) {
     // EdDSA Signing.
     //
@@ -562,13 +607,38 @@ class EDDSA {
       return false;
 
     try {
-      return this._verify(msg, sig, key, ph, ctx);
+      const A = this.curve.decodePoint(key);
+      return this._verify(msg, sig, key, A, ph, ctx);
+    } catch (e) {
+      return false;
+    }
+  }
+
+  async verifyAsync(msg, sig, key, ph, ctx) {
+    return this.verify(msg, sig, key, ph, ctx);
+  }
+
+  verifyParsed(msg, sig, key, ph, ctx) {
+    if (ctx == null)
+      ctx = Buffer.alloc(0);
+
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(key && key.point && key.point.curve === this.curve);
+    assert(ph == null || typeof ph === 'boolean');
+    assert(Buffer.isBuffer(ctx));
+
+    if (sig.length !== this.curve.adjustedSize * 2)
+      return false;
+
+    try {
+      return this._verify(msg, sig, key.raw, key.point, ph, ctx);
     } catch (e) {
       return false;
     }
   }
 
-  _verify(msg, sig, key, ph, ctx) {
+  _verify(msg, sig, key, A, ph, ctx) {
     // EdDSA Verification.
     //
     // [EDDSA] Page 15, Section 5.
@@ -599,7 +669,6 @@ class EDDSA {
     const sraw = sig.slice(this.curve.adjustedSize);
     const R = this.curve.decodePoint(Rraw);
     const s = this.curve.decodeAdjusted(sraw);
-    const A = this.curve.decodePoint(key);
 
     if (s.cmp(n) >= 0)
       return false;
@@ -707,6 +776,18 @@ class EDDSA {
     }
   }
 
+  findInvalid(batch, ph, ctx) {
+    return batchUtil.findInvalid(batch, b => this.verifyBatch(b, ph, ctx));
+  }
+
+  async verifyBatchAsync(batch, ph, ctx, jobs) {
+    return this.verifyBatch(batch, ph, ctx);
+  }
+
+  async findInvalidAsync(batch, ph, ctx, jobs) {
+    return this.findInvalid(batch, ph, ctx);
+  }
+
   _verifyBatch(batch, ph, ctx) {
     // EdDSA Batch Verification.
     //
@@ -129,6 +129,29 @@ async function deriveAsync(hash, pass, salt, iter, len) {
   return Buffer.from(out);
 }
 
+/**
+ * Execute pbkdf2 for many credentials asynchronously.
+ * @param {Function} hash
+ * @param {Array[]} items - [pass, salt] pairs.
+ * @param {Number} iter
+ * @param {Number} len
+ * @param {Number} [jobs=1]
+ * @returns {Promise} - Resolves to the concatenated keys.
+ */
+
+async function deriveBatchAsync(hash, items, iter, len, jobs) {
+  assert(Array.isArray(items));
+
+  const keys = [];
+
+  for (const item of items) {
+    assert(Array.isArray(item) && item.length === 2);
+    keys.push(await deriveAsync(hash, item[0], item[1], iter, len));
+  }
+
+  return Buffer.concat(keys, items.length * len);
+}
+
 /*
  * Helpers
  */
@@ -155,3 +178,4 @@ function getHash(hash) {
 exports.native = 0;
 exports.derive = derive;
 exports.deriveAsync = deriveAsync;
+exports.deriveBatchAsync = deriveBatchAsync;
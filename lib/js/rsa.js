@@ -67,6 +67,7 @@ const MAX_EXP = (2 ** 33) - 1;
 const MAX_EXP_BITS = 33;
 const SALT_LENGTH_AUTO = 0;
 const SALT_LENGTH_HASH = -1;
+const BLIND_LIMIT = 32;
 const PREFIX = Buffer.alloc(8, 0x00);
 const EMPTY = Buffer.alloc(0);
 
@@ -218,6 +219,8 @@ class RSAPrivateKey extends RSAPublicKey {
     this.dp = new BN(0);
     this.dq = new BN(0);
     this.qi = new BN(0);
+    this.blinding = null;
+    this.blindUses = 0;
   }
 
   isSane() {
@@ -325,24 +328,8 @@ class RSAPrivateKey extends RSAPublicKey {
     if (c.cmp(n) >= 0)
       throw new Error('Invalid RSA message size.');
 
-    // Generate blinding factor.
-    let b, bi;
-    for (;;) {
-      // s = random integer in [1,n-1]
-      const s = BN.random(rng, 1, n);
-
-      // bi = s^-1 mod n
-      try {
-        bi = s.invert(n);
-      } catch (e) {
-        continue;
-      }
-
-      // b = s^e mod n
-      b = s.powm(e, n);
-
-      break;
-    }
+    // Generate or refresh blinding factor.
+    const [b, bi] = this.blind();
 
     // Blind.
     c.imul(b).imod(n);
@@ -369,6 +356,45 @@ class RSAPrivateKey extends RSAPublicKey {
     return m.encode('be', n.byteLength());
   }
 
+  blind() {
+    // A blinding pair is regenerated every
+    // BLIND_LIMIT uses and squared in between:
+    //
+    //   b = b^2 = (s^2)^e mod n
+    //   bi = bi^2 = (s^2)^-1 mod n
+    const {n, e} = this;
+
+    if (this.blinding && this.blindUses < BLIND_LIMIT) {
+      const [b, bi] = this.blinding;
+
+      this.blinding = [b.sqr().imod(n), bi.sqr().imod(n)];
+      this.blindUses += 1;
+
+      return this.blinding;
+    }
+
+    for (;;) {
+      // s = random integer in [1,n-1]
+      const s = BN.random(rng, 1, n);
+
+      // bi = s^-1 mod n
+      let bi;
+      try {
+        bi = s.invert(n);
+      } catch (e) {
+        continue;
+      }
+
+      // b = s^e mod n
+      const b = s.powm(e, n);
+
+      this.blinding = [b, bi];
+      this.blindUses = 1;
+
+      return this.blinding;
+    }
+  }
+
   generate(bits, exponent) {
     // [RFC8017] Page 9, Section 3.2.
     // [FIPS186] Page 51, Appendix B.3.1
@@ -746,10 +772,11 @@ function privateKeyGenerate(bits, exponent) {
  * Generate a private key.
  * @param {Number} [bits=2048]
  * @param {Number} [exponent=65537]
+ * @param {Number} [jobs=1]
  * @returns {Buffer} Private key.
  */
 
-async function privateKeyGenerateAsync(bits, exponent) {
+async function privateKeyGenerateAsync(bits, exponent, jobs) {
   if (bits == null)
     bits = DEFAULT_BITS;
 
@@ -884,6 +911,21 @@ function privateKeyExport(key) {
   };
 }
 
+/**
+ * Parse and verify a private key for repeated use.
+ * @param {Buffer} key
+ * @returns {RSAPrivateKey}
+ */
+
+function privateKeyParse(key) {
+  const k = RSAPrivateKey.decode(key);
+
+  if (!k.verify())
+    throw new Error('Invalid RSA private key.');
+
+  return k;
+}
+
 /**
  * Create a public key from a private key.
  * @param {Buffer} key
@@ -989,6 +1031,18 @@ function publicKeyExport(key) {
  */
 
 function sign(hash, msg, key) {
+  return signParsed(hash, msg, privateKeyParse(key));
+}
+
+/**
+ * Sign a message with a parsed key (PKCS1v1.5).
+ * @param {Object|String|null} hash
+ * @param {Buffer} msg
+ * @param {RSAPrivateKey} key - Private key.
+ * @returns {Buffer} PKCS#1v1.5-formatted signature.
+ */
+
+function signParsed(hash, msg, key) {
   // [RFC8017] Page 36, Section 8.2.1.
   //           Page 45, Section 9.2.
   if (hash && typeof hash.id === 'string')
@@ -996,6 +1050,7 @@ function sign(hash, msg, key) {
 
   assert(hash == null || typeof hash === 'string');
   assert(Buffer.isBuffer(msg));
+  assert(key instanceof RSAPrivateKey);
 
   const [prefix, hlen] = getDigestInfo(hash, msg);
 
@@ -1005,13 +1060,8 @@ function sign(hash, msg, key) {
   if (msg.length !== hlen)
     throw new Error('Invalid RSA message size.');
 
-  const k = RSAPrivateKey.decode(key);
-
-  if (!k.verify())
-    throw new Error('Invalid RSA private key.');
-
   const tlen = prefix.length + hlen;
-  const klen = k.size();
+  const klen = key.size();
 
   if (klen < tlen + 11)
     throw new Error('Invalid RSA message size.');
@@ -1030,7 +1080,7 @@ function sign(hash, msg, key) {
   prefix.copy(em, klen - tlen);
   msg.copy(em, klen - hlen);
 
-  return k.decrypt(em);
+  return key.decrypt(em);
 }
 
 /**
@@ -1163,15 +1213,22 @@ function encrypt(msg, key) {
  */
 
 function decrypt(msg, key) {
-  // [RFC8017] Page 29, Section 7.2.2.
-  assert(Buffer.isBuffer(msg));
+  return decryptParsed(msg, privateKeyParse(key));
+}
 
-  const k = RSAPrivateKey.decode(key);
+/**
+ * Decrypt a message with a parsed key (PKCS1v1.5).
+ * @param {Buffer} msg
+ * @param {RSAPrivateKey} key
+ * @returns {Buffer}
+ */
 
-  if (!k.verify())
-    throw new Error('Invalid RSA private key.');
+function decryptParsed(msg, key) {
+  // [RFC8017] Page 29, Section 7.2.2.
+  assert(Buffer.isBuffer(msg));
+  assert(key instanceof RSAPrivateKey);
 
-  const klen = k.size();
+  const klen = key.size();
 
   if (klen < 11)
     throw new Error('Invalid RSA private key.');
@@ -1180,7 +1237,7 @@ function decrypt(msg, key) {
     throw new Error('Invalid RSA message size.');
 
   // EM = 0x00 || 0x02 || PS || 0x00 || M
-  const em = k.decrypt(msg);
+  const em = key.decrypt(msg);
   const zero = safeEqualByte(em[0], 0x00);
   const two = safeEqualByte(em[1], 0x02);
 
@@ -1214,23 +1271,32 @@ function decrypt(msg, key) {
  */
 
 function signPSS(hash, msg, key, saltLen) {
+  return signPSSParsed(hash, msg, privateKeyParse(key), saltLen);
+}
+
+/**
+ * Sign a message with a parsed key (PSS).
+ * @param {Object} hash
+ * @param {Buffer} msg
+ * @param {RSAPrivateKey} key - Private key.
+ * @param {Number} [saltLen=SALT_LENGTH_HASH]
+ * @returns {Buffer} PSS-formatted signature.
+ */
+
+function signPSSParsed(hash, msg, key, saltLen) {
   // [RFC8017] Page 33, Section 8.1.1.
   if (saltLen == null)
     saltLen = SALT_LENGTH_HASH;
 
   assert(hash && typeof hash.id === 'string');
   assert(Buffer.isBuffer(msg));
+  assert(key instanceof RSAPrivateKey);
   assert((saltLen | 0) === saltLen);
 
   if (msg.length !== hash.size)
     throw new Error('Invalid RSA message size.');
 
-  const k = RSAPrivateKey.decode(key);
-
-  if (!k.verify())
-    throw new Error('Invalid RSA private key.');
-
-  const bits = k.bits();
+  const bits = key.bits();
   const klen = (bits + 7) >>> 3;
   const emlen = (bits + 6) >>> 3;
 
@@ -1248,7 +1314,7 @@ function signPSS(hash, msg, key, saltLen) {
   // Note that `em` may be one byte less
   // than the modulus size in the case
   // of (bits - 1) mod 8 == 0.
-  return k.decrypt(em);
+  return key.decrypt(em);
 }
 
 /**
@@ -1392,20 +1458,29 @@ function encryptOAEP(hash, msg, key, label) {
  */
 
 function decryptOAEP(hash, msg, key, label) {
+  return decryptOAEPParsed(hash, msg, privateKeyParse(key), label);
+}
+
+/**
+ * Decrypt a message with a parsed key (OAEP).
+ * @param {Object} hash
+ * @param {Buffer} msg
+ * @param {RSAPrivateKey} key
+ * @param {Buffer?} label
+ * @returns {Buffer}
+ */
+
+function decryptOAEPParsed(hash, msg, key, label) {
   // [RFC8017] Page 25, Section 7.1.2.
   if (label == null)
     label = EMPTY;
 
   assert(hash && typeof hash.id === 'string');
   assert(Buffer.isBuffer(msg));
+  assert(key instanceof RSAPrivateKey);
   assert(Buffer.isBuffer(label));
 
-  const k = RSAPrivateKey.decode(key);
-
-  if (!k.verify())
-    throw new Error('Invalid RSA private key.');
-
-  const klen = k.size();
+  const klen = key.size();
   const mlen = msg.length;
   const hlen = hash.size;
 
@@ -1416,7 +1491,7 @@ function decryptOAEP(hash, msg, key, label) {
     throw new Error('Invalid RSA message size.');
 
   // EM = 0x00 || (seed) || (Hash(L) || PS || 0x01 || M)
-  const em = k.decrypt(msg);
+  const em = key.decrypt(msg);
   const expect = hash.digest(label);
   const zero = safeEqualByte(em[0], 0x00);
   const seed = em.slice(1, hlen + 1);
@@ -1708,6 +1783,7 @@ exports.privateKeyBits = privateKeyBits;
 exports.privateKeyVerify = privateKeyVerify;
 exports.privateKeyImport = privateKeyImport;
 exports.privateKeyExport = privateKeyExport;
+exports.privateKeyParse = privateKeyParse;
 exports.publicKeyCreate = publicKeyCreate;
 exports.publicKeyBits = publicKeyBits;
 exports.publicKeyVerify = publicKeyVerify;
@@ -1721,5 +1797,9 @@ exports.signPSS = signPSS;
 exports.verifyPSS = verifyPSS;
 exports.encryptOAEP = encryptOAEP;
 exports.decryptOAEP = decryptOAEP;
+exports.signParsed = signParsed;
+exports.decryptParsed = decryptParsed;
+exports.signPSSParsed = signPSSParsed;
+exports.decryptOAEPParsed = decryptOAEPParsed;
 exports.veil = veil;
 exports.unveil = unveil;
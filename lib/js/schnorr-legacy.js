@@ -32,6 +32,7 @@
 'use strict';
 
 const assert = require('../internal/assert');
+const batchUtil = require('../internal/batch');
 const BatchRNG = require('./batch-rng');
 const BN = require('../bn');
 
@@ -265,6 +266,10 @@ class Schnorr {
     }
   }
 
+  findInvalid(batch) {
+    return batchUtil.findInvalid(batch, b => this.verifyBatch(b));
+  }
+
   _verifyBatch(batch) {
     // Schnorr Batch Verification.
     //
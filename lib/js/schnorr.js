@@ -26,6 +26,7 @@
 'use strict';
 
 const assert = require('../internal/assert');
+const batchUtil = require('../internal/batch');
 const BatchRNG = require('./batch-rng');
 const BN = require('../bn');
 const rng = require('../random');
@@ -310,6 +311,16 @@ class Schnorr {
     return true;
   }
 
+  publicKeyParse(key) {
+    // The JS backend only caches the decoded point.
+    assert(Buffer.isBuffer(key));
+
+    return {
+      point: this.curve.decodeEven(key),
+      raw: Buffer.from(key)
+    };
+  }
+
   publicKeyExport(key) {
     const {x, y} = this.curve.decodeEven(key);
 
@@ -423,6 +434,10 @@ class Schnorr {
     return this._sign(msg, key, aux);
   }
 
+  async signAsync(msg, key, aux) {
+    return this.sign(msg, key, aux);
+  }
+
   _sign(msg, key, aux) {
     // Schnorr Signing.
     //
@@ -497,13 +512,32 @@ class Schnorr {
       return false;
 
     try {
-      return this._verify(msg, sig, key);
+      return this._verify(msg, sig, key, this.curve.decodeEven(key));
     } catch (e) {
       return false;
     }
   }
 
-  _verify(msg, sig, key) {
+  async verifyAsync(msg, sig, key) {
+    return this.verify(msg, sig, key);
+  }
+
+  verifyParsed(msg, sig, key) {
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(key && key.point && key.point.curve === this.curve);
+
+    if (sig.length !== this.curve.fieldSize + this.curve.scalarSize)
+      return false;
+
+    try {
+      return this._verify(msg, sig, key.raw, key.point);
+    } catch (e) {
+      return false;
+    }
+  }
+
+  _verify(msg, sig, key, A) {
     // Schnorr Verification.
     //
     // [BIP340] "Verification".
@@ -548,7 +582,6 @@ class Schnorr {
     const sraw = sig.slice(this.curve.fieldSize);
     const r = this.curve.decodeField(Rraw);
     const s = this.curve.decodeScalar(sraw);
-    const A = this.curve.decodeEven(key);
 
     if (r.cmp(p) >= 0 || s.cmp(n) >= 0)
       return false;
@@ -591,6 +624,18 @@ class Schnorr {
     }
   }
 
+  findInvalid(batch) {
+    return batchUtil.findInvalid(batch, b => this.verifyBatch(b));
+  }
+
+  async verifyBatchAsync(batch, jobs) {
+    return this.verifyBatch(batch);
+  }
+
+  async findInvalidAsync(batch, jobs) {
+    return this.findInvalid(batch);
+  }
+
   _verifyBatch(batch) {
     // Schnorr Batch Verification.
     //
@@ -89,10 +89,11 @@ function derive(passwd, salt, N, r, p, len) {
  * @param {Number} r
  * @param {Number} p
  * @param {Number} len
+ * @param {Number} [jobs=1]
  * @returns {Promise}
  */
 
-async function deriveAsync(passwd, salt, N, r, p, len) {
+async function deriveAsync(passwd, salt, N, r, p, len, jobs) {
   if (typeof passwd === 'string')
     passwd = Buffer.from(passwd, 'utf8');
 
@@ -130,6 +131,30 @@ async function deriveAsync(passwd, salt, N, r, p, len) {
   return pbkdf2.deriveAsync(SHA256, passwd, B, 1, len);
 }
 
+/**
+ * Perform scrypt key derivation for many credentials (async).
+ * @param {Array[]} items - [passwd, salt] pairs.
+ * @param {Number} N
+ * @param {Number} r
+ * @param {Number} p
+ * @param {Number} len
+ * @param {Number} [jobs=1]
+ * @returns {Promise} - Resolves to the concatenated keys.
+ */
+
+async function deriveBatchAsync(items, N, r, p, len, jobs) {
+  assert(Array.isArray(items));
+
+  const keys = [];
+
+  for (const item of items) {
+    assert(Array.isArray(item) && item.length === 2);
+    keys.push(await deriveAsync(item[0], item[1], N, r, p, len));
+  }
+
+  return Buffer.concat(keys, items.length * len);
+}
+
 /*
  * Helpers
  */
@@ -313,3 +338,4 @@ function writeU32(dst, num, off) {
 exports.native = 0;
 exports.derive = derive;
 exports.deriveAsync = deriveAsync;
+exports.deriveBatchAsync = deriveBatchAsync;
@@ -223,6 +223,17 @@ class SHA256 {
     return ctx.final();
   }
 
+  static digestBatch(items) {
+    assert(Array.isArray(items));
+
+    const out = Buffer.alloc(items.length * this.size);
+
+    for (let i = 0; i < items.length; i++)
+      this.digest(items[i]).copy(out, i * this.size);
+
+    return out;
+  }
+
   static mac(data, key) {
     return SHA256.hmac().init(key).update(data).final();
   }
@@ -99,6 +99,17 @@ function createTree(alg, leaves) {
   assert(alg && typeof alg.root === 'function');
   assert(Array.isArray(leaves));
 
+  if (typeof alg.merkleTree === 'function') {
+    const [tree, malleated] = alg.merkleTree(joinNodes(alg, leaves));
+    const nodes = splitNodes(alg, tree);
+
+    // Preserve the caller's leaf objects.
+    for (let i = 0; i < leaves.length; i++)
+      nodes[i] = leaves[i];
+
+    return [nodes, malleated];
+  }
+
   const nodes = new Array(leaves.length);
 
   for (let i = 0; i < leaves.length; i++)
@@ -148,6 +159,9 @@ function createRoot(alg, leaves) {
   assert(alg && typeof alg.root === 'function');
   assert(Array.isArray(leaves));
 
+  if (typeof alg.merkleRoot === 'function')
+    return alg.merkleRoot(joinNodes(alg, leaves));
+
   const [nodes, malleated] = createTree(alg, leaves);
   const root = nodes[nodes.length - 1];
 
@@ -168,6 +182,9 @@ function createBranch(alg, index, leaves) {
   assert(Array.isArray(leaves));
   assert(index < leaves.length);
 
+  if (typeof alg.merkleBranch === 'function')
+    return splitNodes(alg, alg.merkleBranch(index, joinNodes(alg, leaves)));
+
   let size = leaves.length;
 
   const [nodes] = createTree(alg, leaves);
@@ -222,6 +239,36 @@ function deriveRoot(alg, hash, branch, index) {
   return root;
 }
 
+/*
+ * Helpers
+ */
+
+function joinNodes(alg, nodes) {
+  const size = alg.size;
+  const out = Buffer.allocUnsafe(nodes.length * size);
+
+  for (let i = 0; i < nodes.length; i++) {
+    const node = nodes[i];
+
+    assert(Buffer.isBuffer(node));
+    assert(node.length === size);
+
+    node.copy(out, i * size);
+  }
+
+  return out;
+}
+
+function splitNodes(alg, data) {
+  const size = alg.size;
+  const nodes = new Array(data.length / size);
+
+  for (let i = 0; i < nodes.length; i++)
+    nodes[i] = data.slice(i * size, (i + 1) * size);
+
+  return nodes;
+}
+
 /*
  * Expose
  */
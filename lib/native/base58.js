@@ -18,6 +18,15 @@ function encode(data) {
   return binding.base58_encode(data);
 }
 
+function encodeBatch(items) {
+  assert(Array.isArray(items));
+
+  for (const item of items)
+    assert(Buffer.isBuffer(item));
+
+  return binding.base58_encode_batch(items);
+}
+
 function decode(str) {
   assert(typeof str === 'string');
 
@@ -37,5 +46,6 @@ function test(str) {
 
 exports.native = 2;
 exports.encode = encode;
+exports.encodeBatch = encodeBatch;
 exports.decode = decode;
 exports.test = test;
@@ -83,6 +83,16 @@ async function pbkdfAsync(pass, salt, rounds, size) {
   return binding.bcrypt_pbkdf_async(pass, salt, rounds, size);
 }
 
+async function pbkdfBatchAsync(items, rounds, size, jobs = 1) {
+  items = binding.credentials(items);
+
+  assert((rounds >>> 0) === rounds);
+  assert((size >>> 0) === size);
+  assert((jobs >>> 0) === jobs);
+
+  return binding.bcrypt_pbkdf_batch(items, rounds, size, jobs);
+}
+
 function derive(pass, salt, rounds, minor = 'b') {
   if (typeof pass === 'string')
     pass = Buffer.from(pass, 'utf8');
@@ -138,6 +148,7 @@ exports.hash192 = hash192;
 exports.hash256 = hash256;
 exports.pbkdf = pbkdf;
 exports.pbkdfAsync = pbkdfAsync;
+exports.pbkdfBatchAsync = pbkdfBatchAsync;
 exports.derive = derive;
 exports.generate = generate;
 exports.verify = verify;
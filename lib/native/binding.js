@@ -172,6 +172,31 @@ binding.hash = function _hash(hash) {
   return type;
 };
 
+// Normalize [pass, salt] pairs for the KDF batch calls.
+binding.credentials = function credentials(items) {
+  assert(Array.isArray(items));
+
+  return items.map((item) => {
+    assert(Array.isArray(item) && item.length === 2);
+
+    let [pass, salt] = item;
+
+    if (typeof pass === 'string')
+      pass = Buffer.from(pass, 'utf8');
+
+    if (typeof salt === 'string')
+      salt = Buffer.from(salt, 'utf8');
+
+    if (salt == null)
+      salt = binding.NULL;
+
+    assert(Buffer.isBuffer(pass));
+    assert(Buffer.isBuffer(salt));
+
+    return [pass, salt];
+  });
+};
+
 const curveCaches = {
   wei: {
     __proto__: null
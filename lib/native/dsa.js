@@ -41,19 +41,21 @@ function paramsGenerate(bits) {
 /**
  * Generate params.
  * @param {Number} [bits=2048]
+ * @param {Number} [jobs=1] - race up to `jobs` parameter searches.
  * @returns {Buffer}
  */
 
-async function paramsGenerateAsync(bits) {
+async function paramsGenerateAsync(bits, jobs = 1) {
   if (bits == null)
     bits = 2048;
 
   assert((bits >>> 0) === bits);
+  assert((jobs >>> 0) === jobs);
 
   if (bits < 1024 || bits > 3072)
     throw new RangeError('`bits` must range between 1024 and 3072.');
 
-  return binding.dsa_params_generate_async(bits, binding.entropy());
+  return binding.dsa_params_generate_async(bits, binding.entropy(), jobs);
 }
 
 /**
@@ -151,11 +153,12 @@ function privateKeyGenerate(bits) {
 /**
  * Generate private key.
  * @param {Number} [bits=2048]
+ * @param {Number} [jobs=1]
  * @returns {Buffer}
  */
 
-async function privateKeyGenerateAsync(bits) {
-  const params = await paramsGenerateAsync(bits);
+async function privateKeyGenerateAsync(bits, jobs) {
+  const params = await paramsGenerateAsync(bits, jobs);
   return privateKeyCreate(params);
 }
 
@@ -40,6 +40,18 @@ class ECDSA {
     return binding.wei_curve_field_bits(this._handle);
   }
 
+  precompute(width) {
+    // Opt into a wider comb for generator
+    // multiplication (sign, keygen). Throws
+    // while async operations are pending.
+    assert(this instanceof ECDSA);
+    assert((width >>> 0) === width);
+
+    binding.wei_curve_precompute(this._handle, width);
+
+    return this;
+  }
+
   privateKeyGenerate() {
     assert(this instanceof ECDSA);
     return binding.ecdsa_privkey_generate(this._handle, binding.entropy());
@@ -165,6 +177,13 @@ class ECDSA {
     return binding.ecdsa_pubkey_verify(this._handle, key);
   }
 
+  publicKeyParse(key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(key));
+
+    return binding.ecdsa_pubkey_parse(this._handle, key);
+  }
+
   publicKeyExport(key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(key));
@@ -282,6 +301,14 @@ class ECDSA {
     return binding.ecdsa_sign(this._handle, msg, key);
   }
 
+  async signAsync(msg, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(key));
+
+    return binding.ecdsa_sign_async(this._handle, msg, key);
+  }
+
   signRecoverable(msg, key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
@@ -298,6 +325,14 @@ class ECDSA {
     return binding.ecdsa_sign_der(this._handle, msg, key);
   }
 
+  async signDERAsync(msg, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(key));
+
+    return binding.ecdsa_sign_der_async(this._handle, msg, key);
+  }
+
   signRecoverableDER(msg, key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
@@ -315,6 +350,24 @@ class ECDSA {
     return binding.ecdsa_verify(this._handle, msg, sig, key);
   }
 
+  async verifyAsync(msg, sig, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(Buffer.isBuffer(key));
+
+    return binding.ecdsa_verify_async(this._handle, msg, sig, key);
+  }
+
+  verifyParsed(msg, sig, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(key && typeof key === 'object');
+
+    return binding.ecdsa_verify_parsed(this._handle, msg, sig, key);
+  }
+
   verifyDER(msg, sig, key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
@@ -324,6 +377,15 @@ class ECDSA {
     return binding.ecdsa_verify_der(this._handle, msg, sig, key);
   }
 
+  async verifyDERAsync(msg, sig, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(Buffer.isBuffer(key));
+
+    return binding.ecdsa_verify_der_async(this._handle, msg, sig, key);
+  }
+
   recover(msg, sig, param, compress = true) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
@@ -334,6 +396,17 @@ class ECDSA {
     return binding.ecdsa_recover(this._handle, msg, sig, param, compress);
   }
 
+  async recoverAsync(msg, sig, param, compress = true) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert((param >>> 0) === param);
+    assert(typeof compress === 'boolean');
+
+    return binding.ecdsa_recover_async(this._handle, msg, sig,
+                                       param, compress);
+  }
+
   recoverDER(msg, sig, param, compress = true) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
@@ -344,6 +417,17 @@ class ECDSA {
     return binding.ecdsa_recover_der(this._handle, msg, sig, param, compress);
   }
 
+  async recoverDERAsync(msg, sig, param, compress = true) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert((param >>> 0) === param);
+    assert(typeof compress === 'boolean');
+
+    return binding.ecdsa_recover_der_async(this._handle, msg, sig,
+                                           param, compress);
+  }
+
   derive(pub, priv, compress = true) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(pub));
@@ -361,6 +445,14 @@ class ECDSA {
     return binding.schnorr_legacy_sign(this._handle, msg, key);
   }
 
+  async schnorrSignAsync(msg, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(key));
+
+    return binding.schnorr_legacy_sign_async(this._handle, msg, key);
+  }
+
   schnorrVerify(msg, sig, key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
@@ -370,6 +462,15 @@ class ECDSA {
     return binding.schnorr_legacy_verify(this._handle, msg, sig, key);
   }
 
+  async schnorrVerifyAsync(msg, sig, key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(Buffer.isBuffer(key));
+
+    return binding.schnorr_legacy_verify_async(this._handle, msg, sig, key);
+  }
+
   schnorrVerifyBatch(batch) {
     assert(this instanceof ECDSA);
     assert(Array.isArray(batch));
@@ -384,6 +485,59 @@ class ECDSA {
 
     return binding.schnorr_legacy_verify_batch(this._handle, batch);
   }
+
+  async schnorrVerifyBatchAsync(batch, jobs = 1) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(batch));
+    assert((jobs >>> 0) === jobs);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    if (jobs > 1) {
+      return binding.schnorr_legacy_verify_batch_parallel(this._handle, batch,
+                                                          jobs, false);
+    }
+
+    return binding.schnorr_legacy_verify_batch_async(this._handle, batch);
+  }
+
+  schnorrFindInvalid(batch) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(batch));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_legacy_verify_batch_find(this._handle, batch);
+  }
+
+  async schnorrFindInvalidAsync(batch, jobs = 1) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(batch));
+    assert((jobs >>> 0) === jobs);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_legacy_verify_batch_parallel(this._handle, batch,
+                                                        jobs, true);
+  }
 }
 
 /*
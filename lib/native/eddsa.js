@@ -40,6 +40,16 @@ class EDDSA {
     return binding.edwards_curve_field_bits(this._handle);
   }
 
+  precompute(width) {
+    // See ECDSA#precompute.
+    assert(this instanceof EDDSA);
+    assert((width >>> 0) === width);
+
+    binding.edwards_curve_precompute(this._handle, width);
+
+    return this;
+  }
+
   privateKeyGenerate() {
     assert(this instanceof EDDSA);
     return binding.eddsa_privkey_generate(this._handle, binding.entropy());
@@ -213,6 +223,13 @@ class EDDSA {
     return binding.eddsa_pubkey_verify(this._handle, key);
   }
 
+  publicKeyParse(key) {
+    assert(this instanceof EDDSA);
+    assert(Buffer.isBuffer(key));
+
+    return binding.eddsa_pubkey_parse(this._handle, key);
+  }
+
   publicKeyIsInfinity(key) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(key));
@@ -289,6 +306,21 @@ class EDDSA {
     return binding.eddsa_pubkey_combine(this._handle, keys);
   }
 
+  publicKeyMulMulti(keys, tweaks) {
+    assert(this instanceof EDDSA);
+    assert(Array.isArray(keys));
+    assert(Array.isArray(tweaks));
+    assert(keys.length === tweaks.length);
+
+    for (const key of keys)
+      assert(Buffer.isBuffer(key));
+
+    for (const tweak of tweaks)
+      assert(Buffer.isBuffer(tweak));
+
+    return binding.eddsa_pubkey_mul_multi(this._handle, keys, tweaks);
+  }
+
   publicKeyNegate(key) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(key));
@@ -311,6 +343,21 @@ class EDDSA {
     return binding.eddsa_sign(this._handle, msg, secret, ph, ctx);
   }
 
+  async signAsync(msg, secret, ph, ctx) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(secret));
+    assert(Buffer.isBuffer(ctx));
+
+    return binding.eddsa_sign_async(this._handle, msg, secret, ph, ctx);
+  }
+
   signWithScalar(msg, scalar, prefix, ph, ctx) {
     assert(this instanceof EDDSA);
 
@@ -378,6 +425,38 @@ class EDDSA {
     return binding.eddsa_verify(this._handle, msg, sig, key, ph, ctx);
   }
 
+  async verifyAsync(msg, sig, key, ph, ctx) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(Buffer.isBuffer(key));
+    assert(Buffer.isBuffer(ctx));
+
+    return binding.eddsa_verify_async(this._handle, msg, sig, key, ph, ctx);
+  }
+
+  verifyParsed(msg, sig, key, ph, ctx) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(key && typeof key === 'object');
+    assert(Buffer.isBuffer(ctx));
+
+    return binding.eddsa_verify_parsed(this._handle, msg, sig, key, ph, ctx);
+  }
+
   verifySingle(msg, sig, key, ph, ctx) {
     assert(this instanceof EDDSA);
 
@@ -416,6 +495,80 @@ class EDDSA {
     return binding.eddsa_verify_batch(this._handle, batch, ph, ctx);
   }
 
+  async verifyBatchAsync(batch, ph, ctx, jobs = 1) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Array.isArray(batch));
+    assert(Buffer.isBuffer(ctx));
+    assert((jobs >>> 0) === jobs);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    if (jobs > 1) {
+      return binding.eddsa_verify_batch_parallel(this._handle, batch,
+                                                 ph, ctx, jobs, false);
+    }
+
+    return binding.eddsa_verify_batch_async(this._handle, batch, ph, ctx);
+  }
+
+  findInvalid(batch, ph, ctx) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Array.isArray(batch));
+    assert(Buffer.isBuffer(ctx));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.eddsa_verify_batch_find(this._handle, batch, ph, ctx);
+  }
+
+  async findInvalidAsync(batch, ph, ctx, jobs = 1) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Array.isArray(batch));
+    assert(Buffer.isBuffer(ctx));
+    assert((jobs >>> 0) === jobs);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.eddsa_verify_batch_parallel(this._handle, batch,
+                                               ph, ctx, jobs, true);
+  }
+
   derive(pub, secret) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(pub));
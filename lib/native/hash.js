@@ -77,6 +77,28 @@ class Hash {
     return binding.hash_multi(type, x, y, z);
   }
 
+  static merkleRoot(type, leaves) {
+    assert((type >>> 0) === type);
+    assert(Buffer.isBuffer(leaves));
+
+    return binding.merkle_root(type, leaves);
+  }
+
+  static merkleTree(type, leaves) {
+    assert((type >>> 0) === type);
+    assert(Buffer.isBuffer(leaves));
+
+    return binding.merkle_tree(type, leaves);
+  }
+
+  static merkleBranch(type, index, leaves) {
+    assert((type >>> 0) === type);
+    assert((index >>> 0) === index);
+    assert(Buffer.isBuffer(leaves));
+
+    return binding.merkle_branch(type, index, leaves);
+  }
+
   static mac(type, data, key) {
     return HMAC.digest(type, data, key);
   }
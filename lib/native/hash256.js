@@ -6,6 +6,8 @@
 
 'use strict';
 
+const assert = require('../internal/assert');
+const binding = require('./binding');
 const {Hash, HMAC, hashes} = require('./hash');
 
 /*
@@ -37,6 +39,27 @@ class Hash256 extends Hash {
     return Hash.multi(hashes.HASH256, x, y, z);
   }
 
+  static digestBatch(items) {
+    assert(Array.isArray(items));
+
+    for (const item of items)
+      assert(Buffer.isBuffer(item));
+
+    return binding.hash_digest_batch(hashes.HASH256, items);
+  }
+
+  static merkleRoot(leaves) {
+    return Hash.merkleRoot(hashes.HASH256, leaves);
+  }
+
+  static merkleTree(leaves) {
+    return Hash.merkleTree(hashes.HASH256, leaves);
+  }
+
+  static merkleBranch(index, leaves) {
+    return Hash.merkleBranch(hashes.HASH256, index, leaves);
+  }
+
   static mac(data, key) {
     return HMAC.digest(hashes.HASH256, data, key);
   }
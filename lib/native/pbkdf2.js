@@ -65,6 +65,27 @@ async function deriveAsync(hash, pass, salt, iter, len) {
   return binding.pbkdf2_derive_async(binding.hash(hash), pass, salt, iter, len);
 }
 
+/**
+ * Execute pbkdf2 for many credentials asynchronously.
+ * @param {Function} hash
+ * @param {Array[]} items - [pass, salt] pairs.
+ * @param {Number} iter
+ * @param {Number} len
+ * @param {Number} [jobs=1]
+ * @returns {Promise} - Resolves to the concatenated keys.
+ */
+
+async function deriveBatchAsync(hash, items, iter, len, jobs = 1) {
+  items = binding.credentials(items);
+
+  assert((iter >>> 0) === iter);
+  assert((len >>> 0) === len);
+  assert((jobs >>> 0) === jobs);
+
+  return binding.pbkdf2_derive_batch(binding.hash(hash), items,
+                                     iter, len, jobs);
+}
+
 /*
  * Expose
  */
@@ -72,3 +93,4 @@ async function deriveAsync(hash, pass, salt, iter, len) {
 exports.native = 2;
 exports.derive = derive;
 exports.deriveAsync = deriveAsync;
+exports.deriveBatchAsync = deriveBatchAsync;
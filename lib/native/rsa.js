@@ -55,10 +55,11 @@ function privateKeyGenerate(bits, exponent) {
  * Generate a private key.
  * @param {Number} [bits=2048]
  * @param {Number} [exponent=65537]
+ * @param {Number} [jobs=1] - search for primes on up to `jobs` threads.
  * @returns {Buffer} Private key.
  */
 
-async function privateKeyGenerateAsync(bits, exponent) {
+async function privateKeyGenerateAsync(bits, exponent, jobs = 1) {
   if (bits == null)
     bits = DEFAULT_BITS;
 
@@ -67,6 +68,7 @@ async function privateKeyGenerateAsync(bits, exponent) {
 
   assert((bits >>> 0) === bits);
   assert(Number.isSafeInteger(exponent) && exponent >= 0);
+  assert((jobs >>> 0) === jobs);
 
   if (bits < MIN_BITS || bits > MAX_BITS)
     throw new RangeError(`"bits" ranges from ${MIN_BITS} to ${MAX_BITS}.`);
@@ -77,7 +79,8 @@ async function privateKeyGenerateAsync(bits, exponent) {
   if (exponent === 1 || (exponent & 1) === 0)
     throw new RangeError('"exponent" must be odd.');
 
-  return binding.rsa_privkey_generate_async(bits, exponent, binding.entropy());
+  return binding.rsa_privkey_generate_async(bits, exponent,
+                                            binding.entropy(), jobs);
 }
 
 /**
@@ -149,6 +152,17 @@ function privateKeyExport(key) {
   };
 }
 
+/**
+ * Parse and verify a private key for repeated use.
+ * @param {Buffer} key
+ * @returns {Object} Key handle.
+ */
+
+function privateKeyParse(key) {
+  assert(Buffer.isBuffer(key));
+  return binding.rsa_privkey_parse(key, binding.entropy());
+}
+
 /**
  * Create a public key from a private key.
  * @param {Buffer} key
@@ -241,6 +255,30 @@ function sign(hash, msg, key) {
   return binding.rsa_sign(hash, msg, key, binding.entropy());
 }
 
+/**
+ * Sign a message with a parsed key (PKCS1v1.5).
+ * @param {Object|String|null} hash
+ * @param {Buffer} msg
+ * @param {Object} key - Parsed private key.
+ * @returns {Buffer} PKCS#1v1.5-formatted signature.
+ */
+
+function signParsed(hash, msg, key) {
+  if (hash && typeof hash.id === 'string')
+    hash = hash.id;
+
+  if (hash == null)
+    hash = -1;
+  else
+    hash = binding.hashes[hash];
+
+  assert((hash | 0) === hash);
+  assert(Buffer.isBuffer(msg));
+  assert(key && typeof key === 'object');
+
+  return binding.rsa_sign_parsed(hash, msg, key);
+}
+
 /**
  * Verify a signature (PKCS1v1.5).
  * @param {Object|String|null} hash
@@ -294,6 +332,20 @@ function decrypt(msg, key) {
   return binding.rsa_decrypt(msg, key, binding.entropy());
 }
 
+/**
+ * Decrypt a message with a parsed key (PKCS1v1.5).
+ * @param {Buffer} msg
+ * @param {Object} key - Parsed private key.
+ * @returns {Buffer}
+ */
+
+function decryptParsed(msg, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(key && typeof key === 'object');
+
+  return binding.rsa_decrypt_parsed(msg, key);
+}
+
 /**
  * Sign a message (PSS).
  * @param {Object} hash
@@ -315,6 +367,23 @@ function signPSS(hash, msg, key, saltLen = -1) {
                               binding.entropy());
 }
 
+/**
+ * Sign a message with a parsed key (PSS).
+ * @param {Object} hash
+ * @param {Buffer} msg
+ * @param {Object} key - Parsed private key.
+ * @param {Number} [saltLen=SALT_LENGTH_HASH]
+ * @returns {Buffer} PSS-formatted signature.
+ */
+
+function signPSSParsed(hash, msg, key, saltLen = -1) {
+  assert(Buffer.isBuffer(msg));
+  assert(key && typeof key === 'object');
+  assert((saltLen | 0) === saltLen);
+
+  return binding.rsa_sign_pss_parsed(binding.hash(hash), msg, key, saltLen);
+}
+
 /**
  * Verify a signature (PSS).
  * @param {Object} hash
@@ -386,6 +455,26 @@ function decryptOAEP(hash, msg, key, label) {
                                   binding.entropy());
 }
 
+/**
+ * Decrypt a message with a parsed key (OAEP).
+ * @param {Object} hash
+ * @param {Buffer} msg
+ * @param {Object} key - Parsed private key.
+ * @param {Buffer?} label
+ * @returns {Buffer}
+ */
+
+function decryptOAEPParsed(hash, msg, key, label) {
+  if (label == null)
+    label = binding.NULL;
+
+  assert(Buffer.isBuffer(msg));
+  assert(key && typeof key === 'object');
+  assert(Buffer.isBuffer(label));
+
+  return binding.rsa_decrypt_oaep_parsed(binding.hash(hash), msg, key, label);
+}
+
 /**
  * "Veil" an RSA ciphertext to hide the key size.
  * @param {Buffer} msg
@@ -431,6 +520,7 @@ exports.privateKeyBits = privateKeyBits;
 exports.privateKeyVerify = privateKeyVerify;
 exports.privateKeyImport = privateKeyImport;
 exports.privateKeyExport = privateKeyExport;
+exports.privateKeyParse = privateKeyParse;
 exports.publicKeyCreate = publicKeyCreate;
 exports.publicKeyBits = publicKeyBits;
 exports.publicKeyVerify = publicKeyVerify;
@@ -444,5 +534,9 @@ exports.signPSS = signPSS;
 exports.verifyPSS = verifyPSS;
 exports.encryptOAEP = encryptOAEP;
 exports.decryptOAEP = decryptOAEP;
+exports.signParsed = signParsed;
+exports.decryptParsed = decryptParsed;
+exports.signPSSParsed = signPSSParsed;
+exports.decryptOAEPParsed = decryptOAEPParsed;
 exports.veil = veil;
 exports.unveil = unveil;
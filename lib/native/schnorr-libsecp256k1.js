@@ -8,6 +8,7 @@
 'use strict';
 
 const assert = require('../internal/assert');
+const batchUtil = require('../internal/batch');
 const binding = require('./binding');
 const handle = binding.secp256k1;
 
@@ -191,6 +192,17 @@ function publicKeyVerify(key) {
   return binding.secp256k1_xonly_verify(handle(), key);
 }
 
+/**
+ * Parse a public key for repeated verification.
+ * @param {Buffer} key
+ * @returns {Object}
+ */
+
+function publicKeyParse(key) {
+  assert(Buffer.isBuffer(key));
+  return binding.secp256k1_schnorr_pubkey_parse(handle(), key);
+}
+
 /**
  * Export a public key to an object.
  * @param {Buffer} key
@@ -323,6 +335,18 @@ function sign(msg, key, aux = binding.entropy(32)) {
   return binding.secp256k1_schnorr_sign(handle(), msg, key, aux);
 }
 
+/**
+ * Sign a message (async).
+ * @param {Buffer} msg
+ * @param {Buffer} key
+ * @param {Buffer?} aux
+ * @returns {Promise<Buffer>}
+ */
+
+async function signAsync(msg, key, aux) {
+  return sign(msg, key, aux);
+}
+
 /**
  * Verify a signature.
  * @param {Buffer} msg
@@ -339,6 +363,34 @@ function verify(msg, sig, key) {
   return binding.secp256k1_schnorr_verify(handle(), msg, sig, key);
 }
 
+/**
+ * Verify a signature (async).
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Buffer} key
+ * @returns {Promise<Boolean>}
+ */
+
+async function verifyAsync(msg, sig, key) {
+  return verify(msg, sig, key);
+}
+
+/**
+ * Verify a signature against a parsed public key.
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Object} key
+ * @returns {Boolean}
+ */
+
+function verifyParsed(msg, sig, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert(key && typeof key === 'object');
+
+  return binding.secp256k1_schnorr_verify_parsed(handle(), msg, sig, key);
+}
+
 /**
  * Batch verify signatures.
  * @param {Object[]} batch
@@ -359,6 +411,38 @@ function verifyBatch(batch) {
   return binding.secp256k1_schnorr_verify_batch(handle(), batch);
 }
 
+/**
+ * Batch verify signatures (async).
+ * @param {Object[]} batch
+ * @param {Number} [jobs=1]
+ * @returns {Promise<Boolean>}
+ */
+
+async function verifyBatchAsync(batch, jobs) {
+  return verifyBatch(batch);
+}
+
+/**
+ * Find invalid signatures in a batch.
+ * @param {Object[]} batch
+ * @returns {Number[]}
+ */
+
+function findInvalid(batch) {
+  return batchUtil.findInvalid(batch, verifyBatch);
+}
+
+/**
+ * Find invalid signatures in a batch (async).
+ * @param {Object[]} batch
+ * @param {Number} [jobs=1]
+ * @returns {Promise<Number[]>}
+ */
+
+async function findInvalidAsync(batch, jobs) {
+  return findInvalid(batch);
+}
+
 /**
  * Perform an ecdh.
  * @param {Buffer} pub
@@ -397,6 +481,7 @@ exports.publicKeyToUniform = publicKeyToUniform;
 exports.publicKeyFromHash = publicKeyFromHash;
 exports.publicKeyToHash = publicKeyToHash;
 exports.publicKeyVerify = publicKeyVerify;
+exports.publicKeyParse = publicKeyParse;
 exports.publicKeyExport = publicKeyExport;
 exports.publicKeyImport = publicKeyImport;
 exports.publicKeyTweakAdd = publicKeyTweakAdd;
@@ -405,6 +490,12 @@ exports.publicKeyTweakSum = publicKeyTweakSum;
 exports.publicKeyTweakTest = publicKeyTweakTest;
 exports.publicKeyCombine = publicKeyCombine;
 exports.sign = sign;
+exports.signAsync = signAsync;
 exports.verify = verify;
+exports.verifyAsync = verifyAsync;
+exports.verifyParsed = verifyParsed;
 exports.verifyBatch = verifyBatch;
+exports.verifyBatchAsync = verifyBatchAsync;
+exports.findInvalid = findInvalid;
+exports.findInvalidAsync = findInvalidAsync;
 exports.derive = derive;
@@ -142,6 +142,13 @@ class Schnorr {
     return binding.schnorr_pubkey_verify(this._handle, key);
   }
 
+  publicKeyParse(key) {
+    assert(this instanceof Schnorr);
+    assert(Buffer.isBuffer(key));
+
+    return binding.schnorr_pubkey_parse(this._handle, key);
+  }
+
   publicKeyExport(key) {
     assert(this instanceof Schnorr);
     assert(Buffer.isBuffer(key));
@@ -213,6 +220,15 @@ class Schnorr {
     return binding.schnorr_sign(this._handle, msg, key, aux);
   }
 
+  async signAsync(msg, key, aux = binding.entropy(32)) {
+    assert(this instanceof Schnorr);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(key));
+    assert(Buffer.isBuffer(aux));
+
+    return binding.schnorr_sign_async(this._handle, msg, key, aux);
+  }
+
   verify(msg, sig, key) {
     assert(this instanceof Schnorr);
     assert(Buffer.isBuffer(msg));
@@ -222,6 +238,24 @@ class Schnorr {
     return binding.schnorr_verify(this._handle, msg, sig, key);
   }
 
+  async verifyAsync(msg, sig, key) {
+    assert(this instanceof Schnorr);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(Buffer.isBuffer(key));
+
+    return binding.schnorr_verify_async(this._handle, msg, sig, key);
+  }
+
+  verifyParsed(msg, sig, key) {
+    assert(this instanceof Schnorr);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(sig));
+    assert(key && typeof key === 'object');
+
+    return binding.schnorr_verify_parsed(this._handle, msg, sig, key);
+  }
+
   verifyBatch(batch) {
     assert(this instanceof Schnorr);
     assert(Array.isArray(batch));
@@ -237,6 +271,59 @@ class Schnorr {
     return binding.schnorr_verify_batch(this._handle, batch);
   }
 
+  async verifyBatchAsync(batch, jobs = 1) {
+    assert(this instanceof Schnorr);
+    assert(Array.isArray(batch));
+    assert((jobs >>> 0) === jobs);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    if (jobs > 1) {
+      return binding.schnorr_verify_batch_parallel(this._handle, batch,
+                                                   jobs, false);
+    }
+
+    return binding.schnorr_verify_batch_async(this._handle, batch);
+  }
+
+  findInvalid(batch) {
+    assert(this instanceof Schnorr);
+    assert(Array.isArray(batch));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_verify_batch_find(this._handle, batch);
+  }
+
+  async findInvalidAsync(batch, jobs = 1) {
+    assert(this instanceof Schnorr);
+    assert(Array.isArray(batch));
+    assert((jobs >>> 0) === jobs);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_verify_batch_parallel(this._handle, batch,
+                                                 jobs, true);
+  }
+
   derive(pub, priv) {
     assert(this instanceof Schnorr);
     assert(Buffer.isBuffer(pub));
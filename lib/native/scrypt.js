@@ -48,10 +48,11 @@ function derive(passwd, salt, N, r, p, len) {
  * @param {Number} r
  * @param {Number} p
  * @param {Number} len
+ * @param {Number} [jobs=1] - mix up to `jobs` lanes of `p` in parallel.
  * @returns {Promise}
  */
 
-async function deriveAsync(passwd, salt, N, r, p, len) {
+async function deriveAsync(passwd, salt, N, r, p, len, jobs = 1) {
   if (typeof passwd === 'string')
     passwd = Buffer.from(passwd, 'utf8');
 
@@ -67,8 +68,32 @@ async function deriveAsync(passwd, salt, N, r, p, len) {
   assert((r >>> 0) === r);
   assert((p >>> 0) === p);
   assert((len >>> 0) === len);
+  assert((jobs >>> 0) === jobs);
 
-  return binding.scrypt_derive_async(passwd, salt, N, r, p, len);
+  return binding.scrypt_derive_async(passwd, salt, N, r, p, len, jobs);
+}
+
+/**
+ * Perform scrypt key derivation for many credentials (async).
+ * @param {Array[]} items - [passwd, salt] pairs.
+ * @param {Number} N
+ * @param {Number} r
+ * @param {Number} p
+ * @param {Number} len
+ * @param {Number} [jobs=1]
+ * @returns {Promise} - Resolves to the concatenated keys.
+ */
+
+async function deriveBatchAsync(items, N, r, p, len, jobs = 1) {
+  items = binding.credentials(items);
+
+  assert((N >>> 0) === N);
+  assert((r >>> 0) === r);
+  assert((p >>> 0) === p);
+  assert((len >>> 0) === len);
+  assert((jobs >>> 0) === jobs);
+
+  return binding.scrypt_derive_batch(items, N, r, p, len, jobs);
 }
 
 /*
@@ -78,3 +103,4 @@ async function deriveAsync(passwd, salt, N, r, p, len) {
 exports.native = 2;
 exports.derive = derive;
 exports.deriveAsync = deriveAsync;
+exports.deriveBatchAsync = deriveBatchAsync;
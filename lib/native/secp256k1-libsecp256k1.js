@@ -11,6 +11,18 @@ const assert = require('../internal/assert');
 const binding = require('./binding');
 const handle = binding.secp256k1;
 
+/**
+ * Opt into wider generator tables (no-op,
+ * libsecp256k1 has its own).
+ * @param {Number} width
+ * @returns {Object}
+ */
+
+function precompute(width) {
+  assert((width >>> 0) === width);
+  return exports;
+}
+
 /**
  * Generate a private key.
  * @returns {Buffer}
@@ -216,6 +228,17 @@ function publicKeyVerify(key) {
   return binding.secp256k1_pubkey_verify(handle(), key);
 }
 
+/**
+ * Parse a public key for repeated verification.
+ * @param {Buffer} key
+ * @returns {Object}
+ */
+
+function publicKeyParse(key) {
+  assert(Buffer.isBuffer(key));
+  return binding.secp256k1_pubkey_parse(handle(), key);
+}
+
 /**
  * Export a public key to an object.
  * @param {Buffer} key
@@ -400,6 +423,20 @@ function sign(msg, key) {
   return binding.secp256k1_sign(handle(), msg, key);
 }
 
+/**
+ * Sign a message (async).
+ * @param {Buffer} msg
+ * @param {Buffer} key
+ * @returns {Promise<Buffer>}
+ */
+
+async function signAsync(msg, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(key));
+
+  return binding.secp256k1_sign_async(handle(), msg, key);
+}
+
 /**
  * Sign a message.
  * @param {Buffer} msg
@@ -428,6 +465,20 @@ function signDER(msg, key) {
   return binding.secp256k1_sign_der(handle(), msg, key);
 }
 
+/**
+ * Sign a message (async).
+ * @param {Buffer} msg
+ * @param {Buffer} key
+ * @returns {Promise<Buffer>}
+ */
+
+async function signDERAsync(msg, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(key));
+
+  return binding.secp256k1_sign_der_async(handle(), msg, key);
+}
+
 /**
  * Sign a message.
  * @param {Buffer} msg
@@ -458,6 +509,38 @@ function verify(msg, sig, key) {
   return binding.secp256k1_verify(handle(), msg, sig, key);
 }
 
+/**
+ * Verify a signature (async).
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Buffer} key
+ * @returns {Promise<Boolean>}
+ */
+
+async function verifyAsync(msg, sig, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert(Buffer.isBuffer(key));
+
+  return binding.secp256k1_verify_async(handle(), msg, sig, key);
+}
+
+/**
+ * Verify a signature against a parsed public key.
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Object} key
+ * @returns {Boolean}
+ */
+
+function verifyParsed(msg, sig, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert(key && typeof key === 'object');
+
+  return binding.secp256k1_verify_parsed(handle(), msg, sig, key);
+}
+
 /**
  * Verify a signature.
  * @param {Buffer} msg
@@ -474,6 +557,22 @@ function verifyDER(msg, sig, key) {
   return binding.secp256k1_verify_der(handle(), msg, sig, key);
 }
 
+/**
+ * Verify a signature (async).
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Buffer} key
+ * @returns {Promise<Boolean>}
+ */
+
+async function verifyDERAsync(msg, sig, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert(Buffer.isBuffer(key));
+
+  return binding.secp256k1_verify_der_async(handle(), msg, sig, key);
+}
+
 /**
  * Recover a public key.
  * @param {Buffer} msg
@@ -492,6 +591,25 @@ function recover(msg, sig, param, compress = true) {
   return binding.secp256k1_recover(handle(), msg, sig, param, compress);
 }
 
+/**
+ * Recover a public key (async).
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Number} param
+ * @param {Boolean} [compress=true]
+ * @returns {Promise<Buffer|null>}
+ */
+
+async function recoverAsync(msg, sig, param, compress = true) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert((param >>> 0) === param);
+  assert(typeof compress === 'boolean');
+
+  return binding.secp256k1_recover_async(handle(), msg, sig,
+                                         param, compress);
+}
+
 /**
  * Recover a public key.
  * @param {Buffer} msg
@@ -510,6 +628,25 @@ function recoverDER(msg, sig, param, compress = true) {
   return binding.secp256k1_recover_der(handle(), msg, sig, param, compress);
 }
 
+/**
+ * Recover a public key (async).
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Number} param
+ * @param {Boolean} [compress=true]
+ * @returns {Promise<Buffer|null>}
+ */
+
+async function recoverDERAsync(msg, sig, param, compress = true) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert((param >>> 0) === param);
+  assert(typeof compress === 'boolean');
+
+  return binding.secp256k1_recover_der_async(handle(), msg, sig,
+                                             param, compress);
+}
+
 /**
  * Perform an ecdh.
  * @param {Buffer} pub
@@ -540,6 +677,20 @@ function schnorrSign(msg, key) {
   return binding.secp256k1_schnorr_legacy_sign(handle(), msg, key);
 }
 
+/**
+ * Sign a message (schnorr, async).
+ * @param {Buffer} msg
+ * @param {Buffer} key
+ * @returns {Promise<Buffer>}
+ */
+
+async function schnorrSignAsync(msg, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(key));
+
+  return binding.secp256k1_schnorr_legacy_sign_async(handle(), msg, key);
+}
+
 /**
  * Verify a schnorr signature.
  * @param {Buffer} msg
@@ -556,6 +707,23 @@ function schnorrVerify(msg, sig, key) {
   return binding.secp256k1_schnorr_legacy_verify(handle(), msg, sig, key);
 }
 
+/**
+ * Verify a schnorr signature (async).
+ * @param {Buffer} msg
+ * @param {Buffer} sig
+ * @param {Buffer} key
+ * @returns {Promise<Boolean>}
+ */
+
+async function schnorrVerifyAsync(msg, sig, key) {
+  assert(Buffer.isBuffer(msg));
+  assert(Buffer.isBuffer(sig));
+  assert(Buffer.isBuffer(key));
+
+  return binding.secp256k1_schnorr_legacy_verify_async(handle(), msg,
+                                                       sig, key);
+}
+
 /**
  * Batch verify schnorr signatures.
  * @param {Object[]} batch
@@ -576,6 +744,80 @@ function schnorrVerifyBatch(batch) {
   return binding.secp256k1_schnorr_legacy_verify_batch(handle(), batch);
 }
 
+/**
+ * Batch verify schnorr signatures (async).
+ * @param {Object[]} batch
+ * @param {Number} [jobs=1]
+ * @returns {Promise<Boolean>}
+ */
+
+async function schnorrVerifyBatchAsync(batch, jobs = 1) {
+  assert(Array.isArray(batch));
+  assert((jobs >>> 0) === jobs);
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  if (jobs > 1) {
+    return binding.secp256k1_schnorr_legacy_verify_batch_parallel(handle(),
+                                                                  batch,
+                                                                  jobs,
+                                                                  false);
+  }
+
+  return binding.secp256k1_schnorr_legacy_verify_batch_async(handle(), batch);
+}
+
+/**
+ * Find invalid schnorr signatures in a batch.
+ * @param {Object[]} batch
+ * @returns {Number[]}
+ */
+
+function schnorrFindInvalid(batch) {
+  assert(Array.isArray(batch));
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  return binding.secp256k1_schnorr_legacy_verify_batch_find(handle(), batch);
+}
+
+/**
+ * Find invalid schnorr signatures in a batch (async).
+ * @param {Object[]} batch
+ * @param {Number} [jobs=1]
+ * @returns {Promise<Number[]>}
+ */
+
+async function schnorrFindInvalidAsync(batch, jobs = 1) {
+  assert(Array.isArray(batch));
+  assert((jobs >>> 0) === jobs);
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  return binding.secp256k1_schnorr_legacy_verify_batch_parallel(handle(),
+                                                                batch,
+                                                                jobs,
+                                                                true);
+}
+
 /*
  * Expose
  */
@@ -585,6 +827,7 @@ exports.type = 'ecdsa';
 exports.size = 32;
 exports.bits = 256;
 exports.native = 2;
+exports.precompute = precompute;
 exports.privateKeyGenerate = privateKeyGenerate;
 exports.privateKeyVerify = privateKeyVerify;
 exports.privateKeyExport = privateKeyExport;
@@ -601,6 +844,7 @@ exports.publicKeyToUniform = publicKeyToUniform;
 exports.publicKeyFromHash = publicKeyFromHash;
 exports.publicKeyToHash = publicKeyToHash;
 exports.publicKeyVerify = publicKeyVerify;
+exports.publicKeyParse = publicKeyParse;
 exports.publicKeyExport = publicKeyExport;
 exports.publicKeyImport = publicKeyImport;
 exports.publicKeyTweakAdd = publicKeyTweakAdd;
@@ -614,14 +858,26 @@ exports.signatureImport = signatureImport;
 exports.isLowS = isLowS;
 exports.isLowDER = isLowDER;
 exports.sign = sign;
+exports.signAsync = signAsync;
 exports.signRecoverable = signRecoverable;
 exports.signDER = signDER;
+exports.signDERAsync = signDERAsync;
 exports.signRecoverableDER = signRecoverableDER;
 exports.verify = verify;
+exports.verifyAsync = verifyAsync;
+exports.verifyParsed = verifyParsed;
 exports.verifyDER = verifyDER;
+exports.verifyDERAsync = verifyDERAsync;
 exports.recover = recover;
+exports.recoverAsync = recoverAsync;
 exports.recoverDER = recoverDER;
+exports.recoverDERAsync = recoverDERAsync;
 exports.derive = derive;
 exports.schnorrSign = schnorrSign;
+exports.schnorrSignAsync = schnorrSignAsync;
 exports.schnorrVerify = schnorrVerify;
+exports.schnorrVerifyAsync = schnorrVerifyAsync;
 exports.schnorrVerifyBatch = schnorrVerifyBatch;
+exports.schnorrVerifyBatchAsync = schnorrVerifyBatchAsync;
+exports.schnorrFindInvalid = schnorrFindInvalid;
+exports.schnorrFindInvalidAsync = schnorrFindInvalidAsync;
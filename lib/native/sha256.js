@@ -6,6 +6,8 @@
 
 'use strict';
 
+const assert = require('../internal/assert');
+const binding = require('./binding');
 const {Hash, HMAC, hashes} = require('./hash');
 
 /*
@@ -37,6 +39,27 @@ class SHA256 extends Hash {
     return Hash.multi(hashes.SHA256, x, y, z);
   }
 
+  static digestBatch(items) {
+    assert(Array.isArray(items));
+
+    for (const item of items)
+      assert(Buffer.isBuffer(item));
+
+    return binding.hash_digest_batch(hashes.SHA256, items);
+  }
+
+  static merkleRoot(leaves) {
+    return Hash.merkleRoot(hashes.SHA256, leaves);
+  }
+
+  static merkleTree(leaves) {
+    return Hash.merkleTree(hashes.SHA256, leaves);
+  }
+
+  static merkleBranch(index, leaves) {
+    return Hash.merkleBranch(hashes.SHA256, index, leaves);
+  }
+
   static mac(data, key) {
     return HMAC.digest(hashes.SHA256, data, key);
   }
@@ -0,0 +1,270 @@
+/*!
+ * bench-mul.c - multiplication benchmark for libtorsion
+ *
+ * Compares the schoolbook basecase against the
+ * Karatsuba/Toom-3 dispatch in mpn_mul_var and
+ * mpn_sqr_var, checking that both produce the same
+ * result.
+ *
+ * Usage:
+ *
+ *   $ S=deps/torsion/src
+ *   $ cc -O2 -std=c89 -DTORSION_HAVE_CONFIG -DTORSION_HAVE_INT128 \
+ *       -DTORSION_HAVE_ASM -DTORSION_HAVE_ASM_X64 \
+ *       -Ideps/torsion/include -o bench-mul scripts/bench-mul.c \
+ *       $S/internal.c $S/util.c
+ *   $ ./bench-mul         # 1024 to 16384 bits
+ *   $ ./bench-mul tune    # crossover points in limbs
+ *   $ ./bench-mul check   # every size, no timings
+ *
+ * `npm run test-mul` builds and runs the check.
+ *
+ * The thresholds can be overridden for re-tuning by
+ * passing e.g. -DMPN_MUL_TOOM22_THRESHOLD=32.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../deps/torsion/src/mpi.c"
+
+#define MAX_LIMBS 512
+
+typedef void bench_f(mp_ptr, mp_srcptr, mp_srcptr, mp_size_t, mp_ptr);
+
+static mp_limb_t up[MAX_LIMBS];
+static mp_limb_t vp[MAX_LIMBS];
+static mp_limb_t rp[2 * MAX_LIMBS];
+static mp_limb_t xp[2 * MAX_LIMBS];
+static mp_limb_t tp[MPN_MUL_VAR_ITCH(MAX_LIMBS) + 1];
+
+static void
+random_limbs(mp_ptr zp, mp_size_t n) {
+  static uint32_t state = 0x9e3779b9;
+  mp_size_t i;
+  int j;
+
+  for (i = 0; i < n; i++) {
+    zp[i] = 0;
+
+    for (j = 0; j < MP_LIMB_BITS; j += 16) {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      zp[i] |= (mp_limb_t)(state & 0xffff) << j;
+    }
+  }
+}
+
+static void
+mul_basecase(mp_ptr zp, mp_srcptr ap, mp_srcptr bp, mp_size_t n, mp_ptr t) {
+  (void)t;
+
+  if (ap == bp)
+    mpn_sqr_basecase(zp, ap, n);
+  else
+    mpn_mul_basecase(zp, ap, n, bp, n);
+}
+
+static void
+mul_toom22(mp_ptr zp, mp_srcptr ap, mp_srcptr bp, mp_size_t n, mp_ptr t) {
+  mpn_toom22_mul_n(zp, ap, bp, n, t);
+}
+
+static void
+mul_toom33(mp_ptr zp, mp_srcptr ap, mp_srcptr bp, mp_size_t n, mp_ptr t) {
+  mpn_toom33_mul_n(zp, ap, bp, n, t);
+}
+
+static void
+mul_dispatch(mp_ptr zp, mp_srcptr ap, mp_srcptr bp, mp_size_t n, mp_ptr t) {
+  if (ap == bp)
+    mpn_sqr_var(zp, ap, n, t);
+  else
+    mpn_mul_var(zp, ap, n, bp, n, t);
+}
+
+static double
+bench(bench_f *func, mp_size_t n, int sqr) {
+  mp_srcptr bp = sqr ? up : vp;
+  double best = 0;
+  long iters, i;
+  int round;
+
+  /* Aim for roughly 2^26 limb products per round. */
+  iters = (1L << 26) / ((long)n * n);
+
+  if (iters < 16)
+    iters = 16;
+
+  for (round = 0; round < 3; round++) {
+    clock_t start = clock();
+    double us;
+
+    for (i = 0; i < iters; i++)
+      func(rp, up, bp, n, tp);
+
+    us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / iters;
+
+    if (round == 0 || us < best)
+      best = us;
+  }
+
+  return best;
+}
+
+static int
+check(bench_f *func, mp_size_t n, int sqr) {
+  mp_srcptr bp = sqr ? up : vp;
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    random_limbs(up, n);
+    random_limbs(vp, n);
+
+    /* Exercise the carry paths with all-ones limbs. */
+    if (i & 1)
+      memset(up, 0xff, n * sizeof(mp_limb_t));
+
+    if (i & 2)
+      memset(vp, 0xff, (n / 2) * sizeof(mp_limb_t));
+
+    mul_basecase(xp, up, bp, n, tp);
+    func(rp, up, bp, n, tp);
+
+    if (mpn_cmp(rp, xp, 2 * n) != 0)
+      return 0;
+  }
+
+  return 1;
+}
+
+static int
+check_unbalanced(mp_size_t un, mp_size_t vn) {
+  /* A canary past the itch catches scratch overruns. */
+  mp_limb_t *canary = &tp[MPN_MUL_VAR_ITCH(vn)];
+
+  random_limbs(up, un);
+  random_limbs(vp, vn);
+
+  *canary = 0x5a;
+
+  mpn_mul_basecase(xp, up, un, vp, vn);
+  mpn_mul_var(rp, up, un, vp, vn, tp);
+
+  return mpn_cmp(rp, xp, un + vn) == 0 && *canary == 0x5a;
+}
+
+static int
+run_sizes(void) {
+  static const int sizes[] = { 1024, 2048, 4096, 8192, 16384 };
+  size_t i;
+  int sqr;
+
+  /* The leftover recursion follows vn mod rn. */
+  if (!check_unbalanced(MAX_LIMBS, 200) || !check_unbalanced(300, 111)) {
+    fprintf(stderr, "Unbalanced mismatch.\n");
+    return 1;
+  }
+
+  printf("%6s %5s %4s %12s %12s %8s\n",
+         "bits", "limbs", "op", "basecase", "dispatch", "speedup");
+
+  for (i = 0; i < ARRAY_SIZE(sizes); i++) {
+    mp_size_t n = sizes[i] / MP_LIMB_BITS;
+
+    for (sqr = 0; sqr < 2; sqr++) {
+      double base, fast;
+
+      if (!check(mul_dispatch, n, sqr)) {
+        fprintf(stderr, "Mismatch at %ld limbs.\n", (long)n);
+        return 1;
+      }
+
+      base = bench(mul_basecase, n, sqr);
+      fast = bench(mul_dispatch, n, sqr);
+
+      printf("%6d %5ld %4s %10.2fus %10.2fus %7.2fx\n",
+             sizes[i], (long)n, sqr ? "sqr" : "mul",
+             base, fast, base / fast);
+    }
+  }
+
+  return 0;
+}
+
+static int
+run_tune(void) {
+  mp_size_t n;
+  int sqr;
+
+  printf("%5s %4s %12s %12s %12s\n",
+         "limbs", "op", "basecase", "toom22", "toom33");
+
+  for (n = 8; n <= 256; n += 8) {
+    for (sqr = 0; sqr < 2; sqr++) {
+      double base, t22, t33 = 0;
+
+      if (!check(mul_toom22, n, sqr)) {
+        fprintf(stderr, "Mismatch at %ld limbs.\n", (long)n);
+        return 1;
+      }
+
+      base = bench(mul_basecase, n, sqr);
+      t22 = bench(mul_toom22, n, sqr);
+
+      if (n >= 32) {
+        if (!check(mul_toom33, n, sqr)) {
+          fprintf(stderr, "Mismatch at %ld limbs.\n", (long)n);
+          return 1;
+        }
+
+        t33 = bench(mul_toom33, n, sqr);
+      }
+
+      printf("%5ld %4s %10.2fus %10.2fus %10.2fus\n",
+             (long)n, sqr ? "sqr" : "mul", base, t22, t33);
+    }
+  }
+
+  return 0;
+}
+
+static int
+run_check(void) {
+  mp_size_t un, vn;
+  int sqr;
+
+  for (vn = 1; vn <= MAX_LIMBS; vn++) {
+    for (sqr = 0; sqr < 2; sqr++) {
+      if (!check(mul_dispatch, vn, sqr)) {
+        fprintf(stderr, "Mismatch at %ld limbs.\n", (long)vn);
+        return 1;
+      }
+    }
+  }
+
+  for (vn = 1; vn <= MAX_LIMBS; vn += 7) {
+    for (un = vn; un <= MAX_LIMBS; un += 13) {
+      if (!check_unbalanced(un, vn)) {
+        fprintf(stderr, "Mismatch at %ldx%ld limbs.\n", (long)un, (long)vn);
+        return 1;
+      }
+    }
+  }
+
+  printf("OK\n");
+
+  return 0;
+}
+
+int
+main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "tune") == 0)
+    return run_tune();
+
+  if (argc > 1 && strcmp(argv[1], "check") == 0)
+    return run_check();
+
+  return run_sizes();
+}
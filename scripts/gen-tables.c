@@ -0,0 +1,210 @@
+/*!
+ * gen-tables.c - precomputed ecc tables for libtorsion
+ *
+ * Dumps the generator tables for a built-in curve in
+ * the native field representation. The output is only
+ * valid for the word size the generator was built for.
+ *
+ * Usage:
+ *
+ *   $ S=deps/torsion/src
+ *   $ cc -O2 -std=c89 -DTORSION_HAVE_CONFIG -DTORSION_HAVE_INT128 \
+ *       -Ideps/torsion/include -o gen-tables scripts/gen-tables.c \
+ *       $S/asn1.c $S/cipher.c $S/drbg.c $S/entropy/hw.c $S/hash.c \
+ *       $S/internal.c $S/mpi.c $S/util.c
+ *   $ for name in p192 p224 p256 p384 p521 secp256k1 ed25519 ed448; do
+ *       ./gen-tables $name > $S/tables/${name}_64.h
+ *     done
+ */
+
+#include <stdio.h>
+#include "../deps/torsion/src/ecc.c"
+
+static const struct {
+  const char *name;
+  int type;
+  int edwards;
+} curves[] = {
+  { "p192", WEI_CURVE_P192, 0 },
+  { "p224", WEI_CURVE_P224, 0 },
+  { "p256", WEI_CURVE_P256, 0 },
+  { "p384", WEI_CURVE_P384, 0 },
+  { "p521", WEI_CURVE_P521, 0 },
+  { "secp256k1", WEI_CURVE_SECP256K1, 0 },
+  { "ed25519", EDWARDS_CURVE_ED25519, 1 },
+  { "ed448", EDWARDS_CURVE_ED448, 1 }
+};
+
+static void
+print_fe(const prime_field_t *fe, const fe_t x, int last) {
+  size_t words = fe->words;
+  size_t i;
+
+  while (words > 0 && x[words - 1] == 0)
+    words--;
+
+  if (words == 0) {
+    printf("    {0}%s\n", last ? "" : ",");
+    return;
+  }
+
+  printf("    {");
+
+  for (i = 0; i < words; i++) {
+    if (i > 0)
+      printf(i % 3 == 0 ? ",\n     " : ", ");
+
+    printf("W(0x%016llx)", (unsigned long long)x[i]);
+  }
+
+  printf("}%s\n", last ? "" : ",");
+}
+
+static void
+print_wge(const wei_t *ec, const wge_t *p, int last) {
+  printf("  {\n");
+  print_fe(&ec->fe, p->x, 0);
+  print_fe(&ec->fe, p->y, 0);
+  printf("    %d\n", p->inf);
+  printf("  }%s\n", last ? "" : ",");
+}
+
+static void
+print_xge(const edwards_t *ec, const xge_t *p, int last) {
+  const prime_field_t *fe = &ec->fe;
+  xge_t r;
+  fe_t zi;
+
+  /* Normalize so that z = 1. Any
+     representative works for the
+     complete addition formulas. */
+  fe_invert_var(fe, zi, p->z);
+  fe_mul(fe, r.x, p->x, zi);
+  fe_mul(fe, r.y, p->y, zi);
+  fe_set(fe, r.z, fe->one);
+  fe_mul(fe, r.t, r.x, r.y);
+
+  printf("  {\n");
+  print_fe(fe, r.x, 0);
+  print_fe(fe, r.y, 0);
+  print_fe(fe, r.z, 0);
+  print_fe(fe, r.t, 1);
+  printf("  }%s\n", last ? "" : ",");
+}
+
+static void
+print_wge_table(const wei_t *ec, const char *name,
+                const char *kind, const wge_t *wnd, size_t len) {
+  size_t i;
+
+  printf("static const wge_t %s_wnd_%s[%lu] = {\n",
+         name, kind, (unsigned long)len);
+
+  for (i = 0; i < len; i++)
+    print_wge(ec, &wnd[i], i == len - 1);
+
+  printf("};\n\n");
+}
+
+static void
+print_xge_table(const edwards_t *ec, const char *name,
+                const char *kind, const xge_t *wnd, size_t len) {
+  size_t i;
+
+  printf("static const xge_t %s_wnd_%s[%lu] = {\n",
+         name, kind, (unsigned long)len);
+
+  for (i = 0; i < len; i++)
+    print_xge(ec, &wnd[i], i == len - 1);
+
+  printf("};\n\n");
+}
+
+static void
+print_header(const char *name) {
+  printf("/* Autogenerated: scripts/gen-tables.c %s */\n", name);
+  printf("/* machine_wordsize = %d */\n", FIELD_WORD_BITS);
+  printf("/* fixed window = %d, naf window = %d */\n\n",
+         FIXED_WIDTH, NAF_WIDTH_PRE);
+  printf("#define W UINT64_C\n\n");
+}
+
+static void
+print_footer(void) {
+  printf("#undef W\n");
+}
+
+static void
+print_wei(const char *name, int type) {
+  wei_t *ec = wei_curve_create(type);
+  size_t fixed = FIXED_LENGTH(ec->sc.bits);
+
+  print_header(name);
+
+  print_wge_table(ec, name, "fixed", ec->wnd_fixed, fixed);
+  print_wge_table(ec, name, "naf", ec->wnd_naf, NAF_SIZE_PRE);
+
+  if (ec->endo)
+    print_wge_table(ec, name, "endo", ec->wnd_endo, NAF_SIZE_PRE);
+
+  printf("static const wei_tables_t tables_%s = {\n", name);
+  printf("  %s_wnd_fixed,\n", name);
+  printf("  %s_wnd_naf,\n", name);
+
+  if (ec->endo)
+    printf("  %s_wnd_endo\n", name);
+  else
+    printf("  NULL\n");
+
+  printf("};\n\n");
+
+  print_footer();
+
+  wei_curve_destroy(ec);
+}
+
+static void
+print_edwards(const char *name, int type) {
+  edwards_t *ec = edwards_curve_create(type);
+  size_t fixed = FIXED_LENGTH(ec->sc.bits);
+
+  print_header(name);
+
+  print_xge_table(ec, name, "fixed", ec->wnd_fixed, fixed);
+  print_xge_table(ec, name, "naf", ec->wnd_naf, NAF_SIZE_PRE);
+
+  printf("static const edwards_tables_t tables_%s = {\n", name);
+  printf("  %s_wnd_fixed,\n", name);
+  printf("  %s_wnd_naf\n", name);
+  printf("};\n\n");
+
+  print_footer();
+
+  edwards_curve_destroy(ec);
+}
+
+int
+main(int argc, char **argv) {
+  size_t i;
+
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <curve>\n", argv[0]);
+    return 1;
+  }
+
+  for (i = 0; i < ARRAY_SIZE(curves); i++) {
+    if (strcmp(argv[1], curves[i].name) != 0)
+      continue;
+
+    if (curves[i].edwards)
+      print_edwards(curves[i].name, curves[i].type);
+    else
+      print_wei(curves[i].name, curves[i].type);
+
+    return 0;
+  }
+
+  fprintf(stderr, "Unknown curve: %s\n", argv[1]);
+
+  return 1;
+}
@@ -47,6 +47,7 @@
 
 #define ENTROPY_SIZE 32
 #define SCRATCH_SIZE 64
+#define SCRATCH_MAX 4096
 
 #define MAX_BUFFER_LENGTH \
   (sizeof(void *) == 4 ? 0x3ffffffful : 0xfffffffeul)
@@ -160,6 +161,7 @@ typedef struct bcrypto_mont_s {
 typedef struct bcrypto_edwards_s {
   edwards_curve_t *ctx;
   edwards_scratch_t *scratch;
+  size_t scratch_size;
   size_t scalar_size;
   size_t scalar_bits;
   size_t field_size;
@@ -167,8 +169,15 @@ typedef struct bcrypto_edwards_s {
   size_t priv_size;
   size_t pub_size;
   size_t sig_size;
+  size_t workers;
 } bcrypto_edwards_curve_t;
 
+typedef struct bcrypto_edwards_pubkey_s {
+  const char *tag;
+  edwards_pubkey_t *ctx;
+  const bcrypto_edwards_curve_t *ec;
+} bcrypto_edwards_pubkey_t;
+
 typedef struct bcrypto_hash_s {
   hash_t ctx;
   int type;
@@ -208,6 +217,11 @@ typedef struct bcrypto_arc4_s {
   int started;
 } bcrypto_arc4_t;
 
+typedef struct bcrypto_rsa_privkey_s {
+  const char *tag;
+  rsa_privkey_t *ctx;
+} bcrypto_rsa_privkey_t;
+
 typedef struct bcrypto_salsa20_s {
   salsa20_t ctx;
   int started;
@@ -217,12 +231,31 @@ typedef struct bcrypto_salsa20_s {
 typedef struct bcrypto_secp256k1_s {
   secp256k1_context *ctx;
   secp256k1_scratch_space *scratch;
+  size_t workers;
 } bcrypto_secp256k1_t;
+
+typedef struct bcrypto_secp256k1_pubkey_s {
+  const char *tag;
+  secp256k1_pubkey pubkey;
+#ifdef BCRYPTO_USE_SECP256K1_LATEST
+  secp256k1_xonly_pubkey xonly;
+#endif
+  const bcrypto_secp256k1_t *ec;
+} bcrypto_secp256k1_pubkey_t;
+
+typedef struct bcrypto_secp256k1_batch_s {
+  secp256k1_scratch_space *scratch;
+  const secp256k1_schnorrleg **sigs;
+  secp256k1_schnorrleg *sig_data;
+  const secp256k1_pubkey **pubs;
+  secp256k1_pubkey *pub_data;
+} bcrypto_secp256k1_batch_t;
 #endif
 
 typedef struct bcrypto_wei_s {
   wei_curve_t *ctx;
   wei_scratch_t *scratch;
+  size_t scratch_size;
   size_t scalar_size;
   size_t scalar_bits;
   size_t field_size;
@@ -230,8 +263,29 @@ typedef struct bcrypto_wei_s {
   size_t sig_size;
   size_t legacy_size;
   size_t schnorr_size;
+  size_t workers;
 } bcrypto_wei_curve_t;
 
+typedef struct bcrypto_wei_pubkey_s {
+  const char *tag;
+  wei_pubkey_t *ctx;
+  const bcrypto_wei_curve_t *ec;
+} bcrypto_wei_pubkey_t;
+
+/* Parsed keys are handed to JS as externals. Each one
+   begins with the address of the tag for its kind so
+   that a foreign external can be refused. */
+static const char bcrypto_ecdsa_pubkey_tag[] = "ecdsa_pubkey";
+static const char bcrypto_eddsa_pubkey_tag[] = "eddsa_pubkey";
+static const char bcrypto_schnorr_pubkey_tag[] = "schnorr_pubkey";
+static const char bcrypto_rsa_privkey_tag[] = "rsa_privkey";
+#ifdef BCRYPTO_USE_SECP256K1
+static const char bcrypto_secp256k1_pubkey_tag[] = "secp256k1_pubkey";
+#ifdef BCRYPTO_USE_SECP256K1_LATEST
+static const char bcrypto_secp256k1_xonly_tag[] = "secp256k1_xonly";
+#endif
+#endif
+
 /*
  * Assertions
  */
@@ -314,6 +368,109 @@ read_value_string_latin1(napi_env env, napi_value value,
   return napi_ok;
 }
 
+static napi_status
+read_value_external_tagged(napi_env env, napi_value value,
+                           const char *tag, void **result) {
+  napi_status status;
+  void *data;
+
+  status = napi_get_value_external(env, value, &data);
+
+  if (status != napi_ok)
+    return status;
+
+  /* Our externals all point at heap objects
+     at least one pointer in size. */
+  if (data == NULL || *((const char **)data) != tag)
+    return napi_invalid_arg;
+
+  *result = data;
+
+  return napi_ok;
+}
+
+/*
+ * Jobs
+ */
+
+/* A job fans out to several async workers and settles
+   a single promise. Workers are queued and completed
+   on the main thread, so the counters need no locks.
+   Callers allocate every worker before queueing the
+   first so that a failure cannot leave a job half
+   queued. */
+typedef struct bcrypto_job_s {
+  size_t pending;
+  int done;
+  napi_deferred deferred;
+} bcrypto_job_t;
+
+static void
+bcrypto_job_init(bcrypto_job_t *job) {
+  job->pending = 0;
+  job->done = 0;
+  job->deferred = NULL;
+}
+
+static void
+bcrypto_job_queue(napi_env env,
+                  bcrypto_job_t *job,
+                  const char *name,
+                  napi_async_execute_callback execute,
+                  napi_async_complete_callback complete,
+                  void *data,
+                  napi_async_work *work) {
+  napi_value workname;
+
+  CHECK(napi_create_string_latin1(env, name, NAPI_AUTO_LENGTH,
+                                  &workname) == napi_ok);
+
+  CHECK(napi_create_async_work(env,
+                               NULL,
+                               workname,
+                               execute,
+                               complete,
+                               data,
+                               work) == napi_ok);
+
+  CHECK(napi_queue_async_work(env, *work) == napi_ok);
+
+  job->pending += 1;
+}
+
+static int
+bcrypto_job_finish(napi_env env, bcrypto_job_t *job, napi_async_work work) {
+  /* Returns 1 once the last worker has finished. */
+  CHECK(napi_delete_async_work(env, work) == napi_ok);
+
+  CHECK(job->pending > 0);
+
+  job->pending -= 1;
+
+  return job->pending == 0;
+}
+
+static void
+bcrypto_job_settle(napi_env env,
+                   bcrypto_job_t *job,
+                   napi_value result,
+                   const char *error) {
+  napi_value strval, errval;
+
+  CHECK(!job->done);
+
+  job->done = 1;
+
+  if (error == NULL) {
+    CHECK(napi_resolve_deferred(env, job->deferred, result) == napi_ok);
+  } else {
+    CHECK(napi_create_string_latin1(env, error, NAPI_AUTO_LENGTH,
+                                    &strval) == napi_ok);
+    CHECK(napi_create_error(env, NULL, strval, &errval) == napi_ok);
+    CHECK(napi_reject_deferred(env, job->deferred, errval) == napi_ok);
+  }
+}
+
 /*
  * AEAD
  */
@@ -1169,6 +1326,81 @@ fail:
   JS_THROW(JS_ERR_ENCODE);
 }
 
+static napi_value
+bcrypto_base58_encode_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  char *out = NULL;
+  size_t out_len;
+  size_t max_len = 0;
+  const uint8_t **items;
+  size_t *lens;
+  uint32_t i, length;
+  napi_value item, str, result;
+  const char *error = JS_ERR_ALLOC;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_array_length(env, argv[0], &length) == napi_ok);
+
+  items = bcrypto_malloc(length * sizeof(uint8_t *));
+  lens = bcrypto_malloc(length * sizeof(size_t));
+
+  if ((items == NULL || lens == NULL) && length != 0)
+    goto fail;
+
+  /* Elements are read once; a getter could
+     return a larger buffer the second time. */
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[0], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &lens[i]) == napi_ok);
+
+    if (lens[i] > 0x7fffffff) {
+      error = JS_ERR_ENCODE;
+      goto fail;
+    }
+
+    if (lens[i] > max_len)
+      max_len = lens[i];
+  }
+
+  out_len = BASE58_ENCODE_SIZE(max_len);
+
+  if (out_len > MAX_STRING_LENGTH)
+    goto fail;
+
+  out = bcrypto_malloc(out_len + 1);
+
+  if (out == NULL)
+    goto fail;
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  error = JS_ERR_ENCODE;
+
+  for (i = 0; i < length; i++) {
+    if (!base58_encode(out, &out_len, items[i], lens[i]))
+      goto fail;
+
+    if (napi_create_string_latin1(env, out, out_len, &str) != napi_ok)
+      goto fail;
+
+    CHECK(napi_set_element(env, result, i, str) == napi_ok);
+  }
+
+  bcrypto_free((void *)items);
+  bcrypto_free(lens);
+  bcrypto_free(out);
+
+  return result;
+fail:
+  bcrypto_free((void *)items);
+  bcrypto_free(lens);
+  bcrypto_free(out);
+  JS_THROW(error);
+}
+
 static napi_value
 bcrypto_base58_decode(napi_env env, napi_callback_info info) {
   napi_value argv[1];
@@ -1430,6 +1662,320 @@ bcrypto_base64url_test(napi_env env, napi_callback_info info) {
   return result;
 }
 
+/*
+ * KDF Workers
+ */
+
+#define KDF_BCRYPT 0
+#define KDF_PBKDF2 1
+#define KDF_SCRYPT 2
+
+typedef struct bcrypto_kdf_job_s {
+  int kind;
+  uint32_t type;
+  uint32_t iter;
+  int64_t N;
+  uint32_t r;
+  uint32_t p;
+  uint8_t *data;
+  size_t data_len;
+  const uint8_t **passes;
+  size_t *pass_lens;
+  const uint8_t **salts;
+  size_t *salt_lens;
+  size_t length;
+  uint8_t *out;
+  size_t out_len;
+  int ok;
+  bcrypto_job_t base;
+} bcrypto_kdf_job_t;
+
+typedef struct bcrypto_kdf_worker_s {
+  bcrypto_kdf_job_t *job;
+  size_t start;
+  size_t count;
+  int ok;
+  napi_async_work work;
+} bcrypto_kdf_worker_t;
+
+static void
+bcrypto_kdf_job_destroy(bcrypto_kdf_job_t *job) {
+  if (job->data_len > 0)
+    torsion_cleanse(job->data, job->data_len);
+
+  if (job->out != NULL)
+    torsion_cleanse(job->out, job->length * job->out_len);
+
+  bcrypto_free(job->data);
+  bcrypto_free((void *)job->passes);
+  bcrypto_free(job->pass_lens);
+  bcrypto_free((void *)job->salts);
+  bcrypto_free(job->salt_lens);
+  bcrypto_free(job->out);
+  bcrypto_free(job);
+}
+
+static void
+bcrypto_kdf_execute_(napi_env env, void *data) {
+  bcrypto_kdf_worker_t *w = (bcrypto_kdf_worker_t *)data;
+  bcrypto_kdf_job_t *job = w->job;
+  uint8_t *out = job->out;
+  size_t i, j;
+
+  (void)env;
+
+  if (out != NULL)
+    out += w->start * job->out_len;
+
+  w->ok = 1;
+
+  switch (job->kind) {
+    case KDF_BCRYPT: {
+      for (i = 0; i < w->count && w->ok; i++) {
+        j = w->start + i;
+        w->ok = bcrypt_pbkdf(out + i * job->out_len,
+                             job->passes[j], job->pass_lens[j],
+                             job->salts[j], job->salt_lens[j],
+                             job->iter, job->out_len);
+      }
+      break;
+    }
+
+    case KDF_PBKDF2: {
+      /* Several passwords share the SIMD lanes. */
+      w->ok = pbkdf2_derive_multi(out, job->type,
+                                  &job->passes[w->start],
+                                  &job->pass_lens[w->start],
+                                  &job->salts[w->start],
+                                  &job->salt_lens[w->start],
+                                  w->count, job->iter, job->out_len);
+      break;
+    }
+
+    case KDF_SCRYPT: {
+      for (i = 0; i < w->count && w->ok; i++) {
+        j = w->start + i;
+        w->ok = scrypt_derive(out + i * job->out_len,
+                              job->passes[j], job->pass_lens[j],
+                              job->salts[j], job->salt_lens[j],
+                              job->N, job->r, job->p, job->out_len);
+      }
+      break;
+    }
+
+    default: {
+      w->ok = 0;
+      break;
+    }
+  }
+}
+
+static void
+bcrypto_kdf_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_kdf_worker_t *w = (bcrypto_kdf_worker_t *)data;
+  bcrypto_kdf_job_t *job = w->job;
+  napi_value result = NULL;
+  int last;
+
+  if (status != napi_ok || !w->ok)
+    job->ok = 0;
+
+  last = bcrypto_job_finish(env, &job->base, w->work);
+
+  bcrypto_free(w);
+
+  if (!last)
+    return;
+
+  if (job->ok) {
+    status = napi_create_buffer_copy(env, job->length * job->out_len,
+                                     job->out, NULL, &result);
+
+    if (status != napi_ok)
+      job->ok = 0;
+  }
+
+  bcrypto_job_settle(env, &job->base, result, job->ok ? NULL : JS_ERR_DERIVE);
+
+  bcrypto_kdf_job_destroy(job);
+}
+
+static bcrypto_kdf_job_t *
+bcrypto_kdf_job_create(napi_env env,
+                       int kind,
+                       napi_value items,
+                       uint32_t out_len) {
+  bcrypto_kdf_job_t *job = bcrypto_xmalloc(sizeof(bcrypto_kdf_job_t));
+  const uint8_t *pass, *salt;
+  size_t pass_len, salt_len;
+  napi_value item, passval, saltval;
+  uint32_t i, length, item_len;
+  uint8_t *data;
+
+  CHECK(napi_get_array_length(env, items, &length) == napi_ok);
+
+  memset(job, 0, sizeof(*job));
+
+  job->kind = kind;
+  job->length = length;
+  job->out_len = out_len;
+  job->ok = 1;
+
+  bcrypto_job_init(&job->base);
+
+  if (out_len > 0 && length > MAX_BUFFER_LENGTH / out_len)
+    goto fail;
+
+  job->passes = bcrypto_malloc(length * sizeof(uint8_t *));
+  job->pass_lens = bcrypto_malloc(length * sizeof(size_t));
+  job->salts = bcrypto_malloc(length * sizeof(uint8_t *));
+  job->salt_lens = bcrypto_malloc(length * sizeof(size_t));
+  job->out = bcrypto_malloc((size_t)length * out_len);
+
+  if (length > 0 && (job->passes == NULL || job->pass_lens == NULL
+                     || job->salts == NULL || job->salt_lens == NULL)) {
+    goto fail;
+  }
+
+  if (job->out == NULL && length > 0 && out_len > 0)
+    goto fail;
+
+  /* Layout: [pass0, salt0, pass1, salt1, ...]. */
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, items, i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 2);
+    CHECK(napi_get_element(env, item, 0, &passval) == napi_ok);
+    CHECK(napi_get_element(env, item, 1, &saltval) == napi_ok);
+    CHECK(napi_get_buffer_info(env, passval, (void **)&pass,
+                               &pass_len) == napi_ok);
+    CHECK(napi_get_buffer_info(env, saltval, (void **)&salt,
+                               &salt_len) == napi_ok);
+
+    job->passes[i] = pass;
+    job->pass_lens[i] = pass_len;
+    job->salts[i] = salt;
+    job->salt_lens[i] = salt_len;
+
+    if (pass_len > MAX_BUFFER_LENGTH - job->data_len)
+      goto fail;
+
+    job->data_len += pass_len;
+
+    if (salt_len > MAX_BUFFER_LENGTH - job->data_len)
+      goto fail;
+
+    job->data_len += salt_len;
+  }
+
+  job->data = bcrypto_malloc(job->data_len);
+
+  if (job->data == NULL && job->data_len != 0)
+    goto fail;
+
+  data = job->data;
+
+  for (i = 0; i < length; i++) {
+    if (job->pass_lens[i] > 0)
+      memcpy(data, job->passes[i], job->pass_lens[i]);
+
+    job->passes[i] = data;
+
+    data += job->pass_lens[i];
+
+    if (job->salt_lens[i] > 0)
+      memcpy(data, job->salts[i], job->salt_lens[i]);
+
+    job->salts[i] = data;
+
+    data += job->salt_lens[i];
+  }
+
+  return job;
+fail:
+  job->data_len = 0;
+  job->length = 0;
+  bcrypto_kdf_job_destroy(job);
+  return NULL;
+}
+
+static napi_value
+bcrypto_kdf_job_queue(napi_env env,
+                      bcrypto_kdf_job_t *job,
+                      uint32_t jobs,
+                      const char *name) {
+  bcrypto_kdf_worker_t **workers = NULL;
+  size_t i, chunk, start, length = job->length;
+  napi_value result;
+
+  if (jobs > length)
+    jobs = length;
+
+  if (jobs == 0)
+    jobs = 1;
+
+  chunk = (length / jobs) + ((length % jobs) != 0);
+
+  if (chunk == 0)
+    chunk = 1;
+
+  jobs = (length + chunk - 1) / chunk;
+
+  if (jobs == 0) {
+    napi_value empty;
+
+    CHECK(napi_create_promise(env, &job->base.deferred, &result) == napi_ok);
+    CHECK(napi_create_buffer(env, 0, NULL, &empty) == napi_ok);
+
+    bcrypto_job_settle(env, &job->base, empty, NULL);
+
+    bcrypto_kdf_job_destroy(job);
+
+    return result;
+  }
+
+  workers = bcrypto_malloc(jobs * sizeof(bcrypto_kdf_worker_t *));
+
+  if (workers == NULL)
+    goto fail;
+
+  for (i = 0, start = 0; i < jobs; i++, start += chunk) {
+    workers[i] = bcrypto_malloc(sizeof(bcrypto_kdf_worker_t));
+
+    if (workers[i] == NULL)
+      break;
+
+    workers[i]->job = job;
+    workers[i]->start = start;
+    workers[i]->count = length - start < chunk ? length - start : chunk;
+    workers[i]->ok = 0;
+  }
+
+  if (i != jobs) {
+    while (i--)
+      bcrypto_free(workers[i]);
+
+    goto fail;
+  }
+
+  CHECK(napi_create_promise(env, &job->base.deferred, &result) == napi_ok);
+
+  for (i = 0; i < jobs; i++) {
+    bcrypto_job_queue(env, &job->base, name,
+                      bcrypto_kdf_execute_,
+                      bcrypto_kdf_complete_,
+                      workers[i], &workers[i]->work);
+  }
+
+  bcrypto_free(workers);
+
+  return result;
+fail:
+  bcrypto_kdf_job_destroy(job);
+  bcrypto_free(workers);
+  JS_THROW(JS_ERR_ALLOC);
+}
+
 /*
  * Bcrypt
  */
@@ -1643,6 +2189,28 @@ bcrypto_bcrypt_pbkdf_async(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_bcrypt_pbkdf_batch(napi_env env, napi_callback_info info) {
+  bcrypto_kdf_job_t *job;
+  napi_value argv[4];
+  size_t argc = 4;
+  uint32_t rounds, out_len, jobs;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_uint32(env, argv[1], &rounds) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &out_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &jobs) == napi_ok);
+
+  job = bcrypto_kdf_job_create(env, KDF_BCRYPT, argv[0], out_len);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->iter = rounds;
+
+  return bcrypto_kdf_job_queue(env, job, jobs, "bcrypto:bcrypt_pbkdf");
+}
+
 static napi_value
 bcrypto_bcrypt_derive(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -3319,23 +3887,168 @@ bcrypto_dsa_complete_(napi_env env, napi_status status, void *data) {
   bcrypto_free(w);
 }
 
-static napi_value
-bcrypto_dsa_params_generate_async(napi_env env, napi_callback_info info) {
-  bcrypto_dsa_worker_t *worker;
-  napi_value argv[2];
-  size_t argc = 2;
+/* Upper bound on speculative key generation workers. */
+#define KEYGEN_MAX_JOBS 64
+
+typedef struct bcrypto_dsa_job_s {
+  volatile int stop;
+  bcrypto_job_t base;
+} bcrypto_dsa_job_t;
+
+typedef struct bcrypto_dsa_search_s {
+  bcrypto_dsa_job_t *job;
   uint32_t bits;
-  const uint8_t *entropy;
-  size_t entropy_len;
-  napi_value workname, result;
+  uint8_t entropy[ENTROPY_SIZE];
+  uint8_t out[DSA_MAX_PARAMS_SIZE];
+  size_t out_len;
+  int ok;
+  napi_async_work work;
+} bcrypto_dsa_search_t;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_uint32(env, argv[0], &bits) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&entropy,
-                             &entropy_len) == napi_ok);
+static void
+bcrypto_dsa_search_execute_(napi_env env, void *data) {
+  bcrypto_dsa_search_t *w = (bcrypto_dsa_search_t *)data;
 
-  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+  (void)env;
+
+  /* Only the main thread writes the stop flag;
+     the search polls it between candidates. */
+  w->ok = dsa_params_search(w->out, &w->out_len, w->bits,
+                            w->entropy, &w->job->stop);
+
+  torsion_cleanse(w->entropy, ENTROPY_SIZE);
+}
+
+static void
+bcrypto_dsa_search_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_dsa_search_t *w = (bcrypto_dsa_search_t *)data;
+  bcrypto_dsa_job_t *job = w->job;
+  napi_value result = NULL;
+  int last;
+
+  last = bcrypto_job_finish(env, &job->base, w->work);
+
+  /* The first worker to finish settles the promise and
+     stops the rest. A failure that was not caused by the
+     stop flag means the parameters themselves are bad. */
+  if (!job->base.done && (status != napi_ok
+                          || w->ok
+                          || !job->stop)) {
+    job->stop = 1;
+
+    if (status == napi_ok && w->ok) {
+      status = napi_create_buffer_copy(env, w->out_len, w->out,
+                                       NULL, &result);
+    }
+
+    bcrypto_job_settle(env, &job->base, result,
+                       status == napi_ok && w->ok ? NULL : JS_ERR_GENERATE);
+  }
+
+  bcrypto_free(w);
+
+  if (last)
+    bcrypto_free(job);
+}
+
+static napi_value
+bcrypto_dsa_params_generate_parallel(napi_env env,
+                                     uint32_t bits,
+                                     const uint8_t *entropy,
+                                     uint32_t jobs) {
+  bcrypto_dsa_search_t **workers = NULL;
+  bcrypto_dsa_job_t *job = NULL;
+  napi_value result;
+  hmac_drbg_t rng;
+  uint32_t i;
+
+  if (jobs > KEYGEN_MAX_JOBS)
+    jobs = KEYGEN_MAX_JOBS;
+
+  job = bcrypto_malloc(sizeof(bcrypto_dsa_job_t));
+
+  if (job == NULL)
+    goto fail;
+
+  job->stop = 0;
+
+  bcrypto_job_init(&job->base);
+
+  workers = bcrypto_malloc(jobs * sizeof(bcrypto_dsa_search_t *));
+
+  if (workers == NULL)
+    goto fail;
+
+  /* Every worker searches from its own seed. */
+  hmac_drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+
+  for (i = 0; i < jobs; i++) {
+    workers[i] = bcrypto_malloc(sizeof(bcrypto_dsa_search_t));
+
+    if (workers[i] == NULL)
+      break;
+
+    workers[i]->job = job;
+    workers[i]->bits = bits;
+    workers[i]->out_len = DSA_MAX_PARAMS_SIZE;
+    workers[i]->ok = 0;
+
+    hmac_drbg_generate(&rng, workers[i]->entropy, ENTROPY_SIZE, NULL, 0);
+  }
+
+  torsion_cleanse(&rng, sizeof(rng));
+
+  if (i != jobs) {
+    while (i--) {
+      torsion_cleanse(workers[i]->entropy, ENTROPY_SIZE);
+      bcrypto_free(workers[i]);
+    }
+
+    goto fail;
+  }
+
+  CHECK(napi_create_promise(env, &job->base.deferred, &result) == napi_ok);
+
+  for (i = 0; i < jobs; i++) {
+    bcrypto_job_queue(env, &job->base, "bcrypto:dsa_params_generate",
+                      bcrypto_dsa_search_execute_,
+                      bcrypto_dsa_search_complete_,
+                      workers[i], &workers[i]->work);
+  }
+
+  bcrypto_free(workers);
+
+  torsion_cleanse((void *)entropy, ENTROPY_SIZE);
+
+  return result;
+fail:
+  bcrypto_free(job);
+  bcrypto_free(workers);
+
+  JS_THROW(JS_ERR_GENERATE);
+}
+
+static napi_value
+bcrypto_dsa_params_generate_async(napi_env env, napi_callback_info info) {
+  bcrypto_dsa_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  uint32_t bits, jobs;
+  const uint8_t *entropy;
+  size_t entropy_len;
+  napi_value workname, result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[0], &bits) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&entropy,
+                             &entropy_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &jobs) == napi_ok);
+
+  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+
+  if (jobs > 1)
+    return bcrypto_dsa_params_generate_parallel(env, bits, entropy, jobs);
 
   worker = bcrypto_xmalloc(sizeof(bcrypto_dsa_worker_t));
   worker->bits = bits;
@@ -3969,211 +4682,816 @@ fail:
 }
 
 /*
- * ECDH
+ * ECC Scratch
  */
 
-static napi_value
-bcrypto_ecdh_privkey_generate(napi_env env, napi_callback_info info) {
-  napi_value argv[2];
-  size_t argc = 2;
-  const uint8_t *entropy;
-  size_t entropy_len;
-  uint8_t out[ECDH_MAX_PRIV_SIZE];
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
+static size_t
+bcrypto_scratch_size(size_t points) {
+  /* Size the scratch to fit the whole input in a
+     single multiplication, within reason. Batch
+     verification uses two points per signature. */
+  if (points < SCRATCH_SIZE)
+    return SCRATCH_SIZE;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&entropy,
-                             &entropy_len) == napi_ok);
+  if (points > SCRATCH_MAX)
+    return SCRATCH_MAX;
 
-  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+  return points;
+}
 
-  ecdh_privkey_generate(ec->ctx, out, entropy);
+static wei_scratch_t *
+bcrypto_wei_scratch(bcrypto_wei_curve_t *ec, size_t points) {
+  size_t size = bcrypto_scratch_size(points);
 
-  CHECK(napi_create_buffer_copy(env,
-                                ec->scalar_size,
-                                out,
-                                NULL,
-                                &result) == napi_ok);
+  if (ec->scratch != NULL && ec->scratch_size < size) {
+    wei_scratch_destroy(ec->ctx, ec->scratch);
+    ec->scratch = NULL;
+  }
 
-  torsion_cleanse((void *)entropy, entropy_len);
+  if (ec->scratch == NULL) {
+    ec->scratch = wei_scratch_create(ec->ctx, size);
+    ec->scratch_size = size;
+  }
 
-  return result;
+  CHECK(ec->scratch != NULL);
+
+  return ec->scratch;
 }
 
-static napi_value
-bcrypto_ecdh_privkey_verify(napi_env env, napi_callback_info info) {
-  napi_value argv[2];
-  size_t argc = 2;
-  const uint8_t *priv;
-  size_t priv_len;
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
-  int ok;
+static edwards_scratch_t *
+bcrypto_edwards_scratch(bcrypto_edwards_curve_t *ec, size_t points) {
+  size_t size = bcrypto_scratch_size(points);
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
-                             &priv_len) == napi_ok);
+  if (ec->scratch != NULL && ec->scratch_size < size) {
+    edwards_scratch_destroy(ec->ctx, ec->scratch);
+    ec->scratch = NULL;
+  }
 
-  ok = priv_len == ec->scalar_size && ecdh_privkey_verify(ec->ctx, priv);
+  if (ec->scratch == NULL) {
+    ec->scratch = edwards_scratch_create(ec->ctx, size);
+    ec->scratch_size = size;
+  }
 
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+  CHECK(ec->scratch != NULL);
 
-  return result;
+  return ec->scratch;
 }
 
-static napi_value
-bcrypto_ecdh_privkey_export(napi_env env, napi_callback_info info) {
-  napi_value argv[2];
-  size_t argc = 2;
-  uint8_t out[ECDH_MAX_PRIV_SIZE];
-  const uint8_t *priv;
-  size_t priv_len;
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
+/*
+ * ECC Workers
+ */
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
-                             &priv_len) == napi_ok);
+#define ECC_RESULT_BOOL 0
+#define ECC_RESULT_BUFFER 1
+#define ECC_RESULT_NULLABLE 2
 
-  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
-  JS_ASSERT(ecdh_privkey_export(ec->ctx, out, priv), JS_ERR_PRIVKEY);
+typedef struct bcrypto_ecc_worker_s bcrypto_ecc_worker_t;
 
-  CHECK(napi_create_buffer_copy(env,
-                                ec->scalar_size,
-                                out,
-                                NULL,
-                                &result) == napi_ok);
+typedef void bcrypto_ecc_execute_f(bcrypto_ecc_worker_t *w);
 
-  return result;
-}
+typedef int bcrypto_ecc_verify_f(bcrypto_ecc_worker_t *w,
+                                 void *arg,
+                                 size_t start,
+                                 size_t count);
 
-static napi_value
-bcrypto_ecdh_privkey_import(napi_env env, napi_callback_info info) {
-  napi_value argv[2];
-  size_t argc = 2;
-  uint8_t out[ECDH_MAX_PRIV_SIZE];
-  const uint8_t *priv;
-  size_t priv_len;
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
+typedef struct bcrypto_ecc_job_s {
+  int find;
+  uint8_t *invalid;
+  size_t length;
+  int ok;
+  bcrypto_job_t base;
+} bcrypto_ecc_job_t;
+
+struct bcrypto_ecc_worker_s {
+  bcrypto_ecc_execute_f *execute;
+  int kind;
+  void *ec;
+  size_t *workers;
+  napi_ref ref;
+  uint8_t *data;
+  size_t data_len;
+  const uint8_t **ptrs;
+  size_t *lens;
+  size_t count;
+  size_t length;
+  uint32_t param;
+  int32_t flag;
+  uint8_t out[ECDSA_MAX_DER_SIZE];
+  size_t out_len;
+  int ok;
+  const char *error;
+  bcrypto_ecc_job_t *job;
+  uint8_t *invalid;
+  napi_async_work work;
+  napi_deferred deferred;
+};
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
-                             &priv_len) == napi_ok);
+static void
+bcrypto_ecc_worker_destroy(napi_env env, bcrypto_ecc_worker_t *w) {
+  CHECK(*w->workers > 0);
 
-  JS_ASSERT(ecdh_privkey_import(ec->ctx, out, priv, priv_len),
-            JS_ERR_PRIVKEY);
+  *w->workers -= 1;
 
-  CHECK(napi_create_buffer_copy(env,
-                                ec->scalar_size,
-                                out,
-                                NULL,
-                                &result) == napi_ok);
+  CHECK(napi_delete_reference(env, w->ref) == napi_ok);
 
-  return result;
+  if (w->data_len > 0)
+    torsion_cleanse(w->data, w->data_len);
+
+  bcrypto_free(w->data);
+  bcrypto_free((void *)w->ptrs);
+  bcrypto_free(w->lens);
+  bcrypto_free(w);
 }
 
-static napi_value
-bcrypto_ecdh_pubkey_create(napi_env env, napi_callback_info info) {
-  napi_value argv[2];
-  size_t argc = 2;
-  uint8_t out[ECDH_MAX_PUB_SIZE];
-  const uint8_t *priv;
-  size_t priv_len;
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
+static bcrypto_ecc_worker_t *
+bcrypto_ecc_worker_create(napi_env env,
+                          bcrypto_ecc_execute_f *execute,
+                          int kind,
+                          napi_value handle,
+                          void *ec,
+                          size_t *active,
+                          const napi_value *values,
+                          size_t count) {
+  bcrypto_ecc_worker_t *w = bcrypto_xmalloc(sizeof(bcrypto_ecc_worker_t));
+  const uint8_t *ptr;
+  size_t i, len;
+  uint8_t *data;
+
+  w->execute = execute;
+  w->kind = kind;
+  w->ec = ec;
+  w->workers = active;
+  w->data = NULL;
+  w->data_len = 0;
+  w->ptrs = bcrypto_malloc(count * sizeof(uint8_t *));
+  w->lens = bcrypto_malloc(count * sizeof(size_t));
+  w->count = count;
+  w->length = 0;
+  w->param = 0;
+  w->flag = 0;
+  w->out_len = 0;
+  w->ok = 0;
+  w->error = NULL;
+  w->job = NULL;
+  w->invalid = NULL;
+
+  CHECK(napi_create_reference(env, handle, 1, &w->ref) == napi_ok);
+
+  /* Workers are created and destroyed on the main thread.
+     While any are alive the curve may not be modified. */
+  *w->workers += 1;
+
+  if (count > 0 && (w->ptrs == NULL || w->lens == NULL))
+    goto fail;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
-                             &priv_len) == napi_ok);
+  for (i = 0; i < count; i++) {
+    CHECK(napi_get_buffer_info(env, values[i], (void **)&ptr,
+                               &len) == napi_ok);
 
-  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+    w->ptrs[i] = ptr;
+    w->lens[i] = len;
 
-  ecdh_pubkey_create(ec->ctx, out, priv);
+    if (len > MAX_BUFFER_LENGTH - w->data_len)
+      goto fail;
 
-  CHECK(napi_create_buffer_copy(env,
-                                ec->field_size,
-                                out,
-                                NULL,
-                                &result) == napi_ok);
+    w->data_len += len;
+  }
 
-  return result;
-}
+  w->data = bcrypto_malloc(w->data_len);
 
-static napi_value
-bcrypto_ecdh_pubkey_convert(napi_env env, napi_callback_info info) {
-  napi_value argv[3];
-  size_t argc = 3;
-  uint8_t out[EDDSA_MAX_PUB_SIZE];
-  size_t out_len;
-  const uint8_t *pub;
-  size_t pub_len;
-  int32_t sign;
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
+  if (w->data == NULL && w->data_len != 0)
+    goto fail;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 3);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
-  CHECK(napi_get_value_int32(env, argv[2], &sign) == napi_ok);
+  data = w->data;
 
-  JS_ASSERT(pub_len == ec->field_size, JS_ERR_PUBKEY_SIZE);
-  JS_ASSERT(ecdh_pubkey_convert(ec->ctx, out, pub, sign), JS_ERR_PUBKEY);
+  for (i = 0; i < count; i++) {
+    if (w->lens[i] > 0)
+      memcpy(data, w->ptrs[i], w->lens[i]);
 
-  out_len = ec->field_size + ((ec->field_bits & 7) == 0);
+    w->ptrs[i] = data;
 
-  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+    data += w->lens[i];
+  }
 
-  return result;
-}
+  return w;
+fail:
+  w->data_len = 0;
+  bcrypto_ecc_worker_destroy(env, w);
+  return NULL;
+}
+
+static bcrypto_ecc_worker_t *
+bcrypto_ecc_worker_range(napi_env env,
+                         bcrypto_ecc_execute_f *execute,
+                         napi_value handle,
+                         void *ec,
+                         size_t *active,
+                         napi_value batch,
+                         uint32_t start,
+                         uint32_t length,
+                         napi_value extra) {
+  uint32_t i, item_len;
+  bcrypto_ecc_worker_t *w;
+  napi_value item, *values;
+  size_t count;
+
+  count = (size_t)length * 3 + (extra != NULL);
+  values = bcrypto_malloc(count * sizeof(napi_value));
+
+  if (values == NULL && count != 0)
+    return NULL;
 
-static napi_value
-bcrypto_ecdh_pubkey_from_uniform(napi_env env, napi_callback_info info) {
-  napi_value argv[2];
-  size_t argc = 2;
-  uint8_t out[ECDH_MAX_PUB_SIZE];
-  const uint8_t *data;
-  size_t data_len;
-  bcrypto_mont_curve_t *ec;
-  napi_value result;
+  /* Layout: [msgs..., sigs..., pubs..., extra]. */
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, batch, start + i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 3);
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&data,
-                             &data_len) == napi_ok);
+    CHECK(napi_get_element(env, item, 0, &values[length * 0 + i]) == napi_ok);
+    CHECK(napi_get_element(env, item, 1, &values[length * 1 + i]) == napi_ok);
+    CHECK(napi_get_element(env, item, 2, &values[length * 2 + i]) == napi_ok);
+  }
 
-  JS_ASSERT(data_len == ec->field_size, JS_ERR_PREIMAGE_SIZE);
+  if (extra != NULL)
+    values[count - 1] = extra;
 
-  ecdh_pubkey_from_uniform(ec->ctx, out, data);
+  w = bcrypto_ecc_worker_create(env, execute, ECC_RESULT_BOOL,
+                                handle, ec, active, values, count);
 
-  CHECK(napi_create_buffer_copy(env,
-                                ec->field_size,
-                                out,
-                                NULL,
-                                &result) == napi_ok);
+  if (w != NULL)
+    w->length = length;
 
-  return result;
+  bcrypto_free(values);
+
+  return w;
 }
 
-static napi_value
-bcrypto_ecdh_pubkey_to_uniform(napi_env env, napi_callback_info info) {
-  napi_value argv[3];
-  size_t argc = 3;
-  uint8_t out[MONT_MAX_FIELD_SIZE];
-  const uint8_t *pub;
+static bcrypto_ecc_worker_t *
+bcrypto_ecc_worker_batch(napi_env env,
+                         bcrypto_ecc_execute_f *execute,
+                         napi_value handle,
+                         void *ec,
+                         size_t *active,
+                         napi_value batch,
+                         napi_value extra) {
+  uint32_t length;
+
+  CHECK(napi_get_array_length(env, batch, &length) == napi_ok);
+
+  return bcrypto_ecc_worker_range(env, execute, handle, ec, active,
+                                  batch, 0, length, extra);
+}
+
+static void
+bcrypto_ecc_bisect(bcrypto_ecc_worker_t *w,
+                   bcrypto_ecc_verify_f *verify,
+                   void *arg,
+                   size_t start,
+                   size_t count) {
+  /* The range is known to contain at least one invalid
+     signature. If the left half verifies, the failure
+     must be on the right and we can skip verifying it. */
+  size_t half = count / 2;
+
+  if (count == 1) {
+    w->invalid[start] = 1;
+    return;
+  }
+
+  if (!verify(w, arg, start, half)) {
+    bcrypto_ecc_bisect(w, verify, arg, start, half);
+
+    if (verify(w, arg, start + half, count - half))
+      return;
+  }
+
+  bcrypto_ecc_bisect(w, verify, arg, start + half, count - half);
+}
+
+static void
+bcrypto_ecc_verify_batch(bcrypto_ecc_worker_t *w,
+                         bcrypto_ecc_verify_f *verify,
+                         void *arg) {
+  w->ok = verify(w, arg, 0, w->length);
+
+  if (!w->ok && w->invalid != NULL)
+    bcrypto_ecc_bisect(w, verify, arg, 0, w->length);
+}
+
+static void
+bcrypto_ecc_execute_(napi_env env, void *data) {
+  bcrypto_ecc_worker_t *w = (bcrypto_ecc_worker_t *)data;
+
+  (void)env;
+
+  w->execute(w);
+}
+
+static napi_value
+bcrypto_ecc_job_result(napi_env env, bcrypto_ecc_job_t *job) {
+  napi_value result, indexval;
+  uint32_t i, j;
+
+  if (!job->find) {
+    CHECK(napi_get_boolean(env, job->ok, &result) == napi_ok);
+    return result;
+  }
+
+  CHECK(napi_create_array(env, &result) == napi_ok);
+
+  for (i = 0, j = 0; i < job->length; i++) {
+    if (!job->invalid[i])
+      continue;
+
+    CHECK(napi_create_uint32(env, i, &indexval) == napi_ok);
+    CHECK(napi_set_element(env, result, j++, indexval) == napi_ok);
+  }
+
+  return result;
+}
+
+static void
+bcrypto_ecc_job_destroy(bcrypto_ecc_job_t *job) {
+  bcrypto_free(job->invalid);
+  bcrypto_free(job);
+}
+
+static void
+bcrypto_ecc_job_complete_(napi_env env,
+                          napi_status status,
+                          bcrypto_ecc_worker_t *w) {
+  bcrypto_ecc_job_t *job = w->job;
+  int last;
+
+  if (status != napi_ok || w->error != NULL)
+    job->ok = -1;
+  else if (job->ok == 1 && !w->ok)
+    job->ok = 0;
+
+  last = bcrypto_job_finish(env, &job->base, w->work);
+
+  bcrypto_ecc_worker_destroy(env, w);
+
+  if (!last)
+    return;
+
+  if (job->ok == -1)
+    bcrypto_job_settle(env, &job->base, NULL, JS_ERR_ALLOC);
+  else
+    bcrypto_job_settle(env, &job->base, bcrypto_ecc_job_result(env, job), NULL);
+
+  bcrypto_ecc_job_destroy(job);
+}
+
+static void
+bcrypto_ecc_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_ecc_worker_t *w = (bcrypto_ecc_worker_t *)data;
+  napi_value result = NULL;
+  napi_value strval, errval;
+
+  if (w->job != NULL) {
+    bcrypto_ecc_job_complete_(env, status, w);
+    return;
+  }
+
+  if (status == napi_ok) {
+    switch (w->kind) {
+      case ECC_RESULT_BOOL:
+        status = napi_get_boolean(env, w->ok, &result);
+        break;
+      case ECC_RESULT_BUFFER:
+        if (w->ok)
+          status = napi_create_buffer_copy(env, w->out_len, w->out,
+                                           NULL, &result);
+        break;
+      case ECC_RESULT_NULLABLE:
+        if (w->ok)
+          status = napi_create_buffer_copy(env, w->out_len, w->out,
+                                           NULL, &result);
+        else
+          status = napi_get_null(env, &result);
+        break;
+    }
+  }
+
+  if (status != napi_ok)
+    w->error = JS_ERR_ALLOC;
+
+  if (w->kind == ECC_RESULT_BUFFER && !w->ok && w->error == NULL)
+    w->error = JS_ERR_SIGN;
+
+  if (w->error == NULL) {
+    CHECK(napi_resolve_deferred(env, w->deferred, result) == napi_ok);
+  } else {
+    CHECK(napi_create_string_latin1(env, w->error, NAPI_AUTO_LENGTH,
+                                    &strval) == napi_ok);
+    CHECK(napi_create_error(env, NULL, strval, &errval) == napi_ok);
+    CHECK(napi_reject_deferred(env, w->deferred, errval) == napi_ok);
+  }
+
+  CHECK(napi_delete_async_work(env, w->work) == napi_ok);
+
+  torsion_cleanse(w->out, sizeof(w->out));
+
+  bcrypto_ecc_worker_destroy(env, w);
+}
+
+static napi_value
+bcrypto_ecc_worker_queue(napi_env env,
+                         bcrypto_ecc_worker_t *worker,
+                         const char *name) {
+  napi_value workname, result;
+
+  JS_ASSERT(worker != NULL, JS_ERR_ALLOC);
+
+  CHECK(napi_create_string_latin1(env, name, NAPI_AUTO_LENGTH,
+                                  &workname) == napi_ok);
+
+  CHECK(napi_create_promise(env, &worker->deferred, &result) == napi_ok);
+
+  CHECK(napi_create_async_work(env,
+                               NULL,
+                               workname,
+                               bcrypto_ecc_execute_,
+                               bcrypto_ecc_complete_,
+                               worker,
+                               &worker->work) == napi_ok);
+
+  CHECK(napi_queue_async_work(env, worker->work) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecc_verify_find(napi_env env,
+                        bcrypto_ecc_execute_f *execute,
+                        napi_value handle,
+                        void *ec,
+                        size_t *active,
+                        napi_value batch,
+                        napi_value extra,
+                        int32_t flag) {
+  bcrypto_ecc_worker_t *w;
+  bcrypto_ecc_job_t job;
+  const char *error;
+  napi_value result;
+  uint32_t length;
+
+  CHECK(napi_get_array_length(env, batch, &length) == napi_ok);
+
+  job.find = 1;
+  job.invalid = bcrypto_malloc(length);
+  job.length = length;
+  job.ok = 1;
+
+  JS_ASSERT(job.invalid != NULL || length == 0, JS_ERR_ALLOC);
+
+  if (length > 0)
+    memset(job.invalid, 0, length);
+
+  w = bcrypto_ecc_worker_batch(env, execute, handle, ec, active, batch, extra);
+
+  if (w == NULL) {
+    bcrypto_free(job.invalid);
+    JS_THROW(JS_ERR_ALLOC);
+  }
+
+  w->flag = flag;
+  w->invalid = job.invalid;
+
+  w->execute(w);
+
+  error = w->error;
+
+  bcrypto_ecc_worker_destroy(env, w);
+
+  if (error != NULL) {
+    bcrypto_free(job.invalid);
+    JS_THROW(error);
+  }
+
+  result = bcrypto_ecc_job_result(env, &job);
+
+  bcrypto_free(job.invalid);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecc_verify_parallel(napi_env env,
+                            bcrypto_ecc_execute_f *execute,
+                            napi_value handle,
+                            void *ec,
+                            size_t *active,
+                            napi_value batch,
+                            napi_value extra,
+                            int32_t flag,
+                            uint32_t jobs,
+                            bool find,
+                            const char *name) {
+  bcrypto_ecc_worker_t **workers = NULL;
+  bcrypto_ecc_job_t *job = NULL;
+  uint32_t i, length, chunk, start;
+  napi_value result;
+
+  CHECK(napi_get_array_length(env, batch, &length) == napi_ok);
+
+  if (jobs > length)
+    jobs = length;
+
+  if (jobs == 0)
+    jobs = 1;
+
+  chunk = (length / jobs) + ((length % jobs) != 0);
+
+  if (chunk == 0)
+    chunk = 1;
+
+  jobs = (length + chunk - 1) / chunk;
+
+  job = bcrypto_malloc(sizeof(bcrypto_ecc_job_t));
+
+  if (job == NULL)
+    goto fail;
+
+  job->find = find;
+  job->invalid = NULL;
+  job->length = length;
+  job->ok = 1;
+
+  bcrypto_job_init(&job->base);
+
+  workers = bcrypto_malloc(jobs * sizeof(bcrypto_ecc_worker_t *));
+
+  if (workers == NULL && jobs != 0)
+    goto fail;
+
+  if (find && length > 0) {
+    job->invalid = bcrypto_malloc(length);
+
+    if (job->invalid == NULL)
+      goto fail;
+
+    memset(job->invalid, 0, length);
+  }
+
+  for (i = 0, start = 0; i < jobs; i++, start += chunk) {
+    uint32_t size = length - start < chunk ? length - start : chunk;
+
+    workers[i] = bcrypto_ecc_worker_range(env, execute, handle, ec, active,
+                                          batch, start, size, extra);
+
+    if (workers[i] == NULL)
+      break;
+
+    workers[i]->flag = flag;
+    workers[i]->job = job;
+
+    if (job->invalid != NULL)
+      workers[i]->invalid = &job->invalid[start];
+  }
+
+  if (i != jobs) {
+    while (i--)
+      bcrypto_ecc_worker_destroy(env, workers[i]);
+
+    goto fail;
+  }
+
+  CHECK(napi_create_promise(env, &job->base.deferred, &result) == napi_ok);
+
+  if (jobs == 0) {
+    bcrypto_job_settle(env, &job->base, bcrypto_ecc_job_result(env, job), NULL);
+    bcrypto_ecc_job_destroy(job);
+    bcrypto_free(workers);
+    return result;
+  }
+
+  for (i = 0; i < jobs; i++) {
+    bcrypto_job_queue(env, &job->base, name,
+                      bcrypto_ecc_execute_,
+                      bcrypto_ecc_complete_,
+                      workers[i], &workers[i]->work);
+  }
+
+  bcrypto_free(workers);
+
+  return result;
+fail:
+  if (job != NULL)
+    bcrypto_ecc_job_destroy(job);
+
+  bcrypto_free(workers);
+
+  JS_THROW(JS_ERR_ALLOC);
+}
+
+/*
+ * ECDH
+ */
+
+static napi_value
+bcrypto_ecdh_privkey_generate(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *entropy;
+  size_t entropy_len;
+  uint8_t out[ECDH_MAX_PRIV_SIZE];
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&entropy,
+                             &entropy_len) == napi_ok);
+
+  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+
+  ecdh_privkey_generate(ec->ctx, out, entropy);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->scalar_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  torsion_cleanse((void *)entropy, entropy_len);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_privkey_verify(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  ok = priv_len == ec->scalar_size && ecdh_privkey_verify(ec->ctx, priv);
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_privkey_export(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[ECDH_MAX_PRIV_SIZE];
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+  JS_ASSERT(ecdh_privkey_export(ec->ctx, out, priv), JS_ERR_PRIVKEY);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->scalar_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_privkey_import(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[ECDH_MAX_PRIV_SIZE];
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(ecdh_privkey_import(ec->ctx, out, priv, priv_len),
+            JS_ERR_PRIVKEY);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->scalar_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_pubkey_create(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[ECDH_MAX_PUB_SIZE];
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+
+  ecdh_pubkey_create(ec->ctx, out, priv);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->field_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_pubkey_convert(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[EDDSA_MAX_PUB_SIZE];
+  size_t out_len;
+  const uint8_t *pub;
+  size_t pub_len;
+  int32_t sign;
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[2], &sign) == napi_ok);
+
+  JS_ASSERT(pub_len == ec->field_size, JS_ERR_PUBKEY_SIZE);
+  JS_ASSERT(ecdh_pubkey_convert(ec->ctx, out, pub, sign), JS_ERR_PUBKEY);
+
+  out_len = ec->field_size + ((ec->field_bits & 7) == 0);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_pubkey_from_uniform(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[ECDH_MAX_PUB_SIZE];
+  const uint8_t *data;
+  size_t data_len;
+  bcrypto_mont_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&data,
+                             &data_len) == napi_ok);
+
+  JS_ASSERT(data_len == ec->field_size, JS_ERR_PREIMAGE_SIZE);
+
+  ecdh_pubkey_from_uniform(ec->ctx, out, data);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->field_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdh_pubkey_to_uniform(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[MONT_MAX_FIELD_SIZE];
+  const uint8_t *pub;
   size_t pub_len;
   uint32_t hint;
   bcrypto_mont_curve_t *ec;
@@ -5257,6 +6575,38 @@ bcrypto_ecdsa_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_ecdsa_sign_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+
+  w->ok = ecdsa_sign(ec->ctx, w->out, NULL, w->ptrs[0], w->lens[0], w->ptrs[1]);
+  w->out_len = ec->sig_size;
+}
+
+static napi_value
+bcrypto_ecdsa_sign_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_ecdsa_sign_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:ecdsa_sign");
+}
+
 static napi_value
 bcrypto_ecdsa_sign_recoverable(napi_env env, napi_callback_info info) {
   napi_value argv[3];
@@ -5320,6 +6670,39 @@ bcrypto_ecdsa_sign_der(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_ecdsa_sign_der_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+
+  w->out_len = ECDSA_MAX_DER_SIZE;
+  w->ok = ecdsa_sign(ec->ctx, w->out, NULL, w->ptrs[0], w->lens[0], w->ptrs[1])
+       && ecdsa_sig_export(ec->ctx, w->out, &w->out_len, w->out);
+}
+
+static napi_value
+bcrypto_ecdsa_sign_der_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_ecdsa_sign_der_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:ecdsa_sign_der");
+}
+
 static napi_value
 bcrypto_ecdsa_sign_recoverable_der(napi_env env, napi_callback_info info) {
   napi_value argv[3];
@@ -5373,7 +6756,119 @@ bcrypto_ecdsa_verify(napi_env env, napi_callback_info info) {
 
   ok = sig_len == ec->sig_size
     && ecdsa_sig_normalize(ec->ctx, tmp, sig)
-    && ecdsa_verify(ec->ctx, msg, msg_len, tmp, pub, pub_len);
+    && ecdsa_verify(ec->ctx, msg, msg_len, tmp, pub, pub_len);
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static void
+bcrypto_ecdsa_verify_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+
+  w->ok = w->lens[1] == ec->sig_size
+       && ecdsa_sig_normalize(ec->ctx, tmp, w->ptrs[1])
+       && ecdsa_verify(ec->ctx, w->ptrs[0], w->lens[0], tmp,
+                                w->ptrs[2], w->lens[2]);
+}
+
+static napi_value
+bcrypto_ecdsa_verify_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_ecdsa_verify_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:ecdsa_verify");
+}
+
+static void
+bcrypto_wei_pubkey_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_wei_pubkey_t *key = (bcrypto_wei_pubkey_t *)data;
+
+  (void)env;
+  (void)hint;
+
+  wei_pubkey_destroy(key->ctx);
+  bcrypto_free(key);
+}
+
+static napi_value
+bcrypto_wei_pubkey_wrap(napi_env env,
+                        const char *tag,
+                        const bcrypto_wei_curve_t *ec,
+                        wei_pubkey_t *ctx) {
+  bcrypto_wei_pubkey_t *key = bcrypto_xmalloc(sizeof(bcrypto_wei_pubkey_t));
+  napi_value handle;
+
+  key->tag = tag;
+  key->ctx = ctx;
+  key->ec = ec;
+
+  CHECK(napi_create_external(env,
+                             key,
+                             bcrypto_wei_pubkey_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_ecdsa_pubkey_parse(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *pub;
+  size_t pub_len;
+  bcrypto_wei_curve_t *ec;
+  wei_pubkey_t *ctx;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+
+  JS_ASSERT(ctx = ecdsa_pubkey_parse(ec->ctx, pub, pub_len), JS_ERR_PUBKEY);
+
+  return bcrypto_wei_pubkey_wrap(env, bcrypto_ecdsa_pubkey_tag, ec, ctx);
+}
+
+static napi_value
+bcrypto_ecdsa_verify_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pubkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[3], bcrypto_ecdsa_pubkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PUBKEY);
+
+  JS_ASSERT(key->ec == ec, JS_ERR_PUBKEY);
+
+  ok = sig_len == ec->sig_size
+    && ecdsa_sig_normalize(ec->ctx, tmp, sig)
+    && ecdsa_verify_parsed(ec->ctx, msg, msg_len, tmp, key->ctx);
 
   CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
 
@@ -5407,6 +6902,35 @@ bcrypto_ecdsa_verify_der(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_ecdsa_verify_der_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+
+  w->ok = ecdsa_sig_import_lax(ec->ctx, tmp, w->ptrs[1], w->lens[1])
+       && ecdsa_sig_normalize(ec->ctx, tmp, tmp)
+       && ecdsa_verify(ec->ctx, w->ptrs[0], w->lens[0], tmp,
+                                w->ptrs[2], w->lens[2]);
+}
+
+static napi_value
+bcrypto_ecdsa_verify_der_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_ecdsa_verify_der_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:ecdsa_verify_der");
+}
+
 static napi_value
 bcrypto_ecdsa_recover(napi_env env, napi_callback_info info) {
   napi_value argv[5];
@@ -5444,6 +6968,47 @@ bcrypto_ecdsa_recover(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_ecdsa_recover_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+
+  w->out_len = ECDSA_MAX_PUB_SIZE;
+  w->ok = w->lens[1] == ec->sig_size
+       && ecdsa_sig_normalize(ec->ctx, tmp, w->ptrs[1])
+       && ecdsa_recover(ec->ctx, w->out, &w->out_len, w->ptrs[0], w->lens[0],
+                        tmp, w->param, w->flag);
+}
+
+static napi_value
+bcrypto_ecdsa_recover_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[5];
+  size_t argc = 5;
+  uint32_t parm;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+
+  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_ecdsa_recover_execute_,
+                                     ECC_RESULT_NULLABLE, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  if (worker != NULL) {
+    worker->param = parm;
+    worker->flag = compress;
+  }
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:ecdsa_recover");
+}
+
 static napi_value
 bcrypto_ecdsa_recover_der(napi_env env, napi_callback_info info) {
   napi_value argv[5];
@@ -5481,6 +7046,47 @@ bcrypto_ecdsa_recover_der(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_ecdsa_recover_der_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+
+  w->out_len = ECDSA_MAX_PUB_SIZE;
+  w->ok = ecdsa_sig_import_lax(ec->ctx, tmp, w->ptrs[1], w->lens[1])
+       && ecdsa_sig_normalize(ec->ctx, tmp, tmp)
+       && ecdsa_recover(ec->ctx, w->out, &w->out_len, w->ptrs[0], w->lens[0],
+                        tmp, w->param, w->flag);
+}
+
+static napi_value
+bcrypto_ecdsa_recover_der_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[5];
+  size_t argc = 5;
+  uint32_t parm;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+
+  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_ecdsa_recover_der_execute_,
+                                     ECC_RESULT_NULLABLE, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  if (worker != NULL) {
+    worker->param = parm;
+    worker->flag = compress;
+  }
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:ecdsa_recover_der");
+}
+
 static napi_value
 bcrypto_ecdsa_derive(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -6429,6 +8035,62 @@ fail:
   return result;
 }
 
+static napi_value
+bcrypto_eddsa_pubkey_mul_multi(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[EDDSA_MAX_PUB_SIZE];
+  uint32_t i, length, tweaks_len;
+  const uint8_t **pubs, **tweaks;
+  size_t pub_len, tweak_len;
+  bcrypto_edwards_curve_t *ec;
+  napi_value item, result;
+  int ok = 0;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[2], &tweaks_len) == napi_ok);
+  CHECK(tweaks_len == length);
+
+  pubs = bcrypto_malloc(2 * length * sizeof(uint8_t *));
+
+  if (pubs == NULL && length != 0)
+    goto fail;
+
+  tweaks = &pubs[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&pubs[i],
+                               &pub_len) == napi_ok);
+
+    CHECK(napi_get_element(env, argv[2], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&tweaks[i],
+                               &tweak_len) == napi_ok);
+
+    if (pub_len != ec->pub_size || tweak_len != ec->scalar_size)
+      goto fail;
+  }
+
+  ok = edwards_mul_multi(ec->ctx, out, NULL, pubs, tweaks, length,
+                         bcrypto_edwards_scratch(ec, length));
+
+fail:
+  bcrypto_free((void *)pubs);
+
+  JS_ASSERT(ok, JS_ERR_PUBKEY);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->pub_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_eddsa_pubkey_negate(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -6490,6 +8152,51 @@ bcrypto_eddsa_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_eddsa_sign_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_edwards_curve_t *ec = w->ec;
+
+  eddsa_sign(ec->ctx, w->out, w->ptrs[0], w->lens[0], w->ptrs[1],
+                      w->flag, w->ptrs[2], w->lens[2]);
+
+  w->out_len = ec->sig_size;
+  w->ok = 1;
+}
+
+static napi_value
+bcrypto_eddsa_sign_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[5];
+  size_t argc = 5;
+  napi_value values[3];
+  const uint8_t *priv;
+  size_t priv_len;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[3], &ph) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->priv_size, JS_ERR_PRIVKEY_SIZE);
+
+  values[0] = argv[1];
+  values[1] = argv[2];
+  values[2] = argv[4];
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_eddsa_sign_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, values, 3);
+
+  if (worker != NULL)
+    worker->flag = ph;
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:eddsa_sign");
+}
+
 static napi_value
 bcrypto_eddsa_sign_with_scalar(napi_env env, napi_callback_info info) {
   napi_value argv[6];
@@ -6630,6 +8337,123 @@ bcrypto_eddsa_verify(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_eddsa_verify_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_edwards_curve_t *ec = w->ec;
+
+  w->ok = w->lens[1] == ec->sig_size
+       && w->lens[2] == ec->pub_size
+       && eddsa_verify(ec->ctx, w->ptrs[0], w->lens[0], w->ptrs[1],
+                                w->ptrs[2], w->flag, w->ptrs[3], w->lens[3]);
+}
+
+static napi_value
+bcrypto_eddsa_verify_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[6];
+  size_t argc = 6;
+  napi_value values[4];
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 6);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[4], &ph) == napi_ok);
+
+  values[0] = argv[1];
+  values[1] = argv[2];
+  values[2] = argv[3];
+  values[3] = argv[5];
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_eddsa_verify_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     values, 4);
+
+  if (worker != NULL)
+    worker->flag = ph;
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:eddsa_verify");
+}
+
+static void
+bcrypto_edwards_pubkey_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_edwards_pubkey_t *key = (bcrypto_edwards_pubkey_t *)data;
+
+  (void)env;
+  (void)hint;
+
+  edwards_pubkey_destroy(key->ctx);
+  bcrypto_free(key);
+}
+
+static napi_value
+bcrypto_eddsa_pubkey_parse(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *pub;
+  size_t pub_len;
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_pubkey_t *key;
+  edwards_pubkey_t *ctx;
+  napi_value handle;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+
+  JS_ASSERT(pub_len == ec->pub_size, JS_ERR_PUBKEY_SIZE);
+  JS_ASSERT(ctx = eddsa_pubkey_parse(ec->ctx, pub), JS_ERR_PUBKEY);
+
+  key = bcrypto_xmalloc(sizeof(bcrypto_edwards_pubkey_t));
+  key->tag = bcrypto_eddsa_pubkey_tag;
+  key->ctx = ctx;
+  key->ec = ec;
+
+  CHECK(napi_create_external(env,
+                             key,
+                             bcrypto_edwards_pubkey_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_eddsa_verify_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[6];
+  size_t argc = 6;
+  const uint8_t *msg, *sig, *ctx;
+  size_t msg_len, sig_len, ctx_len;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_pubkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 6);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[3], bcrypto_eddsa_pubkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PUBKEY);
+  CHECK(napi_get_value_int32(env, argv[4], &ph) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[5], (void **)&ctx, &ctx_len) == napi_ok);
+
+  JS_ASSERT(key->ec == ec, JS_ERR_PUBKEY);
+
+  ok = sig_len == ec->sig_size
+    && eddsa_verify_parsed(ec->ctx, msg, msg_len, sig,
+                           key->ctx, ph, ctx, ctx_len);
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_eddsa_verify_single(napi_env env, napi_callback_info info) {
   napi_value argv[6];
@@ -6719,22 +8543,121 @@ bcrypto_eddsa_verify_batch(napi_env env, napi_callback_info info) {
       goto fail;
   }
 
-  if (ec->scratch == NULL)
-    ec->scratch = edwards_scratch_create(ec->ctx, SCRATCH_SIZE);
+  ok = eddsa_verify_batch(ec->ctx, msgs, msg_lens, sigs,
+                          pubs, length, ph, ctx, ctx_len,
+                          bcrypto_edwards_scratch(ec, length * 2));
+
+fail:
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  bcrypto_free((void *)ptrs);
+  bcrypto_free(lens);
+
+  return result;
+}
+
+static int
+bcrypto_eddsa_verify_range_(bcrypto_ecc_worker_t *w,
+                            void *arg,
+                            size_t start,
+                            size_t count) {
+  bcrypto_edwards_curve_t *ec = w->ec;
+  size_t i, length = w->length;
+  const uint8_t **msgs = &w->ptrs[length * 0 + start];
+  const uint8_t **sigs = &w->ptrs[length * 1 + start];
+  const uint8_t **pubs = &w->ptrs[length * 2 + start];
+  const size_t *msg_lens = &w->lens[length * 0 + start];
+  const size_t *sig_lens = &w->lens[length * 1 + start];
+  const size_t *pub_lens = &w->lens[length * 2 + start];
+
+  for (i = 0; i < count; i++) {
+    if (sig_lens[i] != ec->sig_size || pub_lens[i] != ec->pub_size)
+      return 0;
+  }
+
+  if (count == 0)
+    return 1;
+
+  return eddsa_verify_batch(ec->ctx, msgs, msg_lens, sigs, pubs, count,
+                            w->flag, w->ptrs[length * 3],
+                            w->lens[length * 3], arg);
+}
+
+static void
+bcrypto_eddsa_verify_batch_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_edwards_curve_t *ec = w->ec;
+  size_t size = bcrypto_scratch_size(w->length * 2);
+  edwards_scratch_t *scratch = edwards_scratch_create(ec->ctx, size);
+
+  CHECK(scratch != NULL);
+
+  bcrypto_ecc_verify_batch(w, bcrypto_eddsa_verify_range_, scratch);
+
+  edwards_scratch_destroy(ec->ctx, scratch);
+}
+
+static napi_value
+bcrypto_eddsa_verify_batch_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
+
+  worker = bcrypto_ecc_worker_batch(env, bcrypto_eddsa_verify_batch_execute_,
+                                    argv[0], ec,
+                                    &ec->workers, argv[1], argv[3]);
+
+  if (worker != NULL)
+    worker->flag = ph;
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:eddsa_verify_batch");
+}
+
+static napi_value
+bcrypto_eddsa_verify_batch_parallel(napi_env env, napi_callback_info info) {
+  napi_value argv[6];
+  size_t argc = 6;
+  int32_t ph;
+  uint32_t jobs;
+  bool find;
+  bcrypto_edwards_curve_t *ec;
 
-  CHECK(ec->scratch != NULL);
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 6);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[4], &jobs) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[5], &find) == napi_ok);
 
-  ok = eddsa_verify_batch(ec->ctx, msgs, msg_lens, sigs,
-                          pubs, length, ph, ctx, ctx_len,
-                          ec->scratch);
+  return bcrypto_ecc_verify_parallel(env,
+                                     bcrypto_eddsa_verify_batch_execute_,
+                                     argv[0], ec,
+                                     &ec->workers, argv[1], argv[3], ph,
+                                     jobs, find,
+                                     "bcrypto:eddsa_verify_batch");
+}
 
-fail:
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+static napi_value
+bcrypto_eddsa_verify_batch_find(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
 
-  bcrypto_free((void *)ptrs);
-  bcrypto_free(lens);
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
 
-  return result;
+  return bcrypto_ecc_verify_find(env, bcrypto_eddsa_verify_batch_execute_,
+                                 argv[0], ec,
+                                 &ec->workers, argv[1], argv[3], ph);
 }
 
 static napi_value
@@ -6831,8 +8754,10 @@ bcrypto_edwards_curve_create(napi_env env, napi_callback_info info) {
   JS_ASSERT(ctx = edwards_curve_create(type), JS_ERR_CONTEXT);
 
   ec = bcrypto_xmalloc(sizeof(bcrypto_edwards_curve_t));
+  ec->workers = 0;
   ec->ctx = ctx;
   ec->scratch = NULL;
+  ec->scratch_size = 0;
   ec->scalar_size = edwards_curve_scalar_size(ec->ctx);
   ec->scalar_bits = edwards_curve_scalar_bits(ec->ctx);
   ec->field_size = edwards_curve_field_size(ec->ctx);
@@ -6895,6 +8820,7 @@ bcrypto_edwards_curve_randomize(napi_env env, napi_callback_info info) {
                              &entropy_len) == napi_ok);
 
   JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+  JS_ASSERT(ec->workers == 0, JS_ERR_STATE);
 
   edwards_curve_randomize(ec->ctx, entropy);
 
@@ -6903,6 +8829,24 @@ bcrypto_edwards_curve_randomize(napi_env env, napi_callback_info info) {
   return argv[0];
 }
 
+static napi_value
+bcrypto_edwards_curve_precompute(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_edwards_curve_t *ec;
+  uint32_t width;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[1], &width) == napi_ok);
+
+  JS_ASSERT(ec->workers == 0, JS_ERR_STATE);
+  JS_ASSERT(edwards_curve_precompute(ec->ctx, width), JS_ERR_ARG);
+
+  return argv[0];
+}
+
 /*
  * Hash
  */
@@ -6942,78 +8886,407 @@ bcrypto_hash_create(napi_env env, napi_callback_info info) {
   return handle;
 }
 
-static napi_value
-bcrypto_hash_init(napi_env env, napi_callback_info info) {
-  napi_value argv[1];
-  size_t argc = 1;
-  bcrypto_hash_t *hash;
+static napi_value
+bcrypto_hash_init(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  bcrypto_hash_t *hash;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+
+  hash_init(&hash->ctx, hash->type);
+  hash->started = 1;
+
+  return argv[0];
+}
+
+static napi_value
+bcrypto_hash_update(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *in;
+  size_t in_len;
+  bcrypto_hash_t *hash;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&in, &in_len) == napi_ok);
+
+  JS_ASSERT(hash->started, JS_ERR_INIT);
+
+  hash_update(&hash->ctx, in, in_len);
+
+  return argv[0];
+}
+
+static napi_value
+bcrypto_hash_final(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  uint8_t out[HASH_MAX_OUTPUT_SIZE];
+  size_t out_len;
+  bcrypto_hash_t *hash;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+
+  JS_ASSERT(hash->started, JS_ERR_INIT);
+
+  out_len = hash_output_size(hash->type);
+
+  hash_final(&hash->ctx, out, out_len);
+  hash->started = 0;
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_hash_digest(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[HASH_MAX_OUTPUT_SIZE];
+  size_t out_len;
+  uint32_t type;
+  const uint8_t *in;
+  size_t in_len;
+  hash_t ctx;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&in, &in_len) == napi_ok);
+
+  JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
+
+  out_len = hash_output_size(type);
+
+  hash_init(&ctx, type);
+  hash_update(&ctx, in, in_len);
+  hash_final(&ctx, out, out_len);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_hash_root(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[HASH_MAX_OUTPUT_SIZE];
+  size_t out_len;
+  uint32_t type;
+  const uint8_t *left, *right;
+  size_t left_len, right_len;
+  hash_t ctx;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&left,
+                             &left_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&right,
+                             &right_len) == napi_ok);
+
+  JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
+
+  out_len = hash_output_size(type);
+
+  JS_ASSERT(left_len == out_len && right_len == out_len, JS_ERR_NODE_SIZE);
+
+  hash_init(&ctx, type);
+  hash_update(&ctx, left, left_len);
+  hash_update(&ctx, right, right_len);
+  hash_final(&ctx, out, out_len);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_hash_multi(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t out[HASH_MAX_OUTPUT_SIZE];
+  size_t out_len;
+  uint32_t type;
+  const uint8_t *x, *y, *z;
+  size_t x_len, y_len, z_len;
+  hash_t ctx;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&x, &x_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&y, &y_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&z, &z_len) == napi_ok);
+
+  JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
+
+  out_len = hash_output_size(type);
+
+  hash_init(&ctx, type);
+  hash_update(&ctx, x, x_len);
+  hash_update(&ctx, y, y_len);
+  hash_update(&ctx, z, z_len);
+  hash_final(&ctx, out, out_len);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_hash_digest_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t *out;
+  size_t out_len;
+  uint32_t i, type, length;
+  const uint8_t **items;
+  size_t *lens;
+  hash_t ctx;
+  napi_value item, result;
+  int ok = 0;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+
+  JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
+
+  out_len = hash_output_size(type);
+
+  JS_ASSERT(length <= MAX_BUFFER_LENGTH / out_len, JS_ERR_ALLOC);
+
+  items = bcrypto_malloc(length * sizeof(uint8_t *));
+  lens = bcrypto_malloc(length * sizeof(size_t));
+
+  if ((items == NULL || lens == NULL) && length != 0)
+    goto fail;
+
+  if (napi_create_buffer(env, length * out_len,
+                         (void **)&out, &result) != napi_ok) {
+    goto fail;
+  }
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &lens[i]) == napi_ok);
+  }
+
+  switch (type) {
+    case HASH_SHA256:
+      sha256_multi(out, items, lens, length);
+      break;
+    case HASH_HASH256:
+      hash256_multi(out, items, lens, length);
+      break;
+    default:
+      for (i = 0; i < length; i++) {
+        hash_init(&ctx, type);
+        hash_update(&ctx, items[i], lens[i]);
+        hash_final(&ctx, out + i * out_len, out_len);
+      }
+      break;
+  }
+
+  ok = 1;
+fail:
+  bcrypto_free((void *)items);
+  bcrypto_free(lens);
+
+  JS_ASSERT(ok, JS_ERR_ALLOC);
+
+  return result;
+}
+
+/*
+ * Merkle
+ */
+
+static int
+merkle_hash_level(uint32_t type,
+                  uint8_t *out,
+                  const uint8_t *in,
+                  size_t size,
+                  size_t node_len,
+                  const uint8_t **items,
+                  size_t *lens) {
+  size_t pairs = size >> 1;
+  size_t i;
+  hash_t ctx;
+
+  switch (type) {
+    case HASH_SHA256:
+    case HASH_HASH256:
+      for (i = 0; i < pairs; i++) {
+        items[i] = in + i * 2 * node_len;
+        lens[i] = 2 * node_len;
+      }
+
+      if (type == HASH_SHA256)
+        sha256_multi(out, items, lens, pairs);
+      else
+        hash256_multi(out, items, lens, pairs);
+
+      break;
+    default:
+      for (i = 0; i < pairs; i++) {
+        hash_init(&ctx, type);
+        hash_update(&ctx, in + i * 2 * node_len, 2 * node_len);
+        hash_final(&ctx, out + i * node_len, node_len);
+      }
+      break;
+  }
+
+  /* Odd nodes are hashed with themselves. */
+  if (size & 1) {
+    const uint8_t *last = in + (size - 1) * node_len;
+
+    hash_init(&ctx, type);
+    hash_update(&ctx, last, node_len);
+    hash_update(&ctx, last, node_len);
+    hash_final(&ctx, out + pairs * node_len, node_len);
+
+    return 0;
+  }
+
+  /* CVE-2012-2459: a duplicated final pair
+     computes the same root as an odd node. */
+  return memcmp(in + (size - 2) * node_len,
+                in + (size - 1) * node_len,
+                node_len) == 0;
+}
+
+static int
+merkle_alloc(const uint8_t ***items,
+             size_t **lens,
+             uint8_t **scratch,
+             size_t size,
+             size_t node_len) {
+  size_t half = (size + 1) >> 1;
+
+  *items = bcrypto_malloc((size >> 1) * sizeof(uint8_t *));
+  *lens = bcrypto_malloc((size >> 1) * sizeof(size_t));
+
+  if (scratch != NULL)
+    *scratch = bcrypto_malloc((half + ((half + 1) >> 1)) * node_len);
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 1);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+  if (*items == NULL || *lens == NULL)
+    return 0;
 
-  hash_init(&hash->ctx, hash->type);
-  hash->started = 1;
+  if (scratch != NULL && *scratch == NULL)
+    return 0;
 
-  return argv[0];
+  return 1;
 }
 
 static napi_value
-bcrypto_hash_update(napi_env env, napi_callback_info info) {
+bcrypto_merkle_root(napi_env env, napi_callback_info info) {
   napi_value argv[2];
   size_t argc = 2;
+  uint8_t root[HASH_MAX_OUTPUT_SIZE];
+  const uint8_t **items = NULL;
+  size_t *lens = NULL;
+  uint8_t *scratch = NULL;
+  uint8_t *out, *alt;
   const uint8_t *in;
-  size_t in_len;
-  bcrypto_hash_t *hash;
+  size_t in_len, node_len, size;
+  uint32_t type;
+  int malleated = 0;
+  int ok = 0;
+  napi_value rootval, malval, result;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 2);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[1], (void **)&in, &in_len) == napi_ok);
 
-  JS_ASSERT(hash->started, JS_ERR_INIT);
+  JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
 
-  hash_update(&hash->ctx, in, in_len);
+  node_len = hash_output_size(type);
 
-  return argv[0];
-}
+  JS_ASSERT(in_len % node_len == 0, JS_ERR_NODE_SIZE);
 
-static napi_value
-bcrypto_hash_final(napi_env env, napi_callback_info info) {
-  napi_value argv[1];
-  size_t argc = 1;
-  uint8_t out[HASH_MAX_OUTPUT_SIZE];
-  size_t out_len;
-  bcrypto_hash_t *hash;
-  napi_value result;
+  size = in_len / node_len;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 1);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+  if (size <= 1) {
+    if (size == 0)
+      memset(root, 0, node_len);
+    else
+      memcpy(root, in, node_len);
 
-  JS_ASSERT(hash->started, JS_ERR_INIT);
+    ok = 1;
+    goto done;
+  }
 
-  out_len = hash_output_size(hash->type);
+  if (!merkle_alloc(&items, &lens, &scratch, size, node_len))
+    goto done;
 
-  hash_final(&hash->ctx, out, out_len);
-  hash->started = 0;
+  out = scratch;
+  alt = scratch + ((size + 1) >> 1) * node_len;
 
-  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+  while (size > 1) {
+    uint8_t *tmp = out;
+
+    malleated |= merkle_hash_level(type, out, in, size,
+                                   node_len, items, lens);
+
+    size = (size + 1) >> 1;
+    in = out;
+    out = alt;
+    alt = tmp;
+  }
+
+  memcpy(root, in, node_len);
+
+  ok = 1;
+done:
+  bcrypto_free((void *)items);
+  bcrypto_free(lens);
+  bcrypto_free(scratch);
+
+  JS_ASSERT(ok, JS_ERR_ALLOC);
+
+  CHECK(napi_create_buffer_copy(env, node_len, root, NULL,
+                                &rootval) == napi_ok);
+
+  CHECK(napi_get_boolean(env, malleated, &malval) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, 2, &result) == napi_ok);
+  CHECK(napi_set_element(env, result, 0, rootval) == napi_ok);
+  CHECK(napi_set_element(env, result, 1, malval) == napi_ok);
 
   return result;
 }
 
 static napi_value
-bcrypto_hash_digest(napi_env env, napi_callback_info info) {
+bcrypto_merkle_tree(napi_env env, napi_callback_info info) {
   napi_value argv[2];
   size_t argc = 2;
-  uint8_t out[HASH_MAX_OUTPUT_SIZE];
-  size_t out_len;
-  uint32_t type;
+  const uint8_t **items = NULL;
+  size_t *lens = NULL;
+  uint8_t *tree;
   const uint8_t *in;
-  size_t in_len;
-  hash_t ctx;
-  napi_value result;
+  size_t in_len, node_len, size, total;
+  uint32_t type;
+  int malleated = 0;
+  int ok = 0;
+  napi_value treeval, malval, result;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 2);
@@ -7022,83 +9295,136 @@ bcrypto_hash_digest(napi_env env, napi_callback_info info) {
 
   JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
 
-  out_len = hash_output_size(type);
+  node_len = hash_output_size(type);
 
-  hash_init(&ctx, type);
-  hash_update(&ctx, in, in_len);
-  hash_final(&ctx, out, out_len);
+  JS_ASSERT(in_len % node_len == 0, JS_ERR_NODE_SIZE);
 
-  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+  size = in_len / node_len;
+  total = size;
+
+  while (size > 1) {
+    size = (size + 1) >> 1;
+    total += size;
+  }
+
+  size = in_len / node_len;
+
+  if (total == 0)
+    total = 1;
+
+  JS_ASSERT(total <= MAX_BUFFER_LENGTH / node_len, JS_ERR_ALLOC);
+
+  if (size > 1 && !merkle_alloc(&items, &lens, NULL, size, node_len))
+    goto fail;
+
+  if (napi_create_buffer(env, total * node_len,
+                         (void **)&tree, &treeval) != napi_ok) {
+    goto fail;
+  }
+
+  if (size == 0)
+    memset(tree, 0, node_len);
+  else
+    memcpy(tree, in, in_len);
+
+  while (size > 1) {
+    malleated |= merkle_hash_level(type, tree + size * node_len, tree,
+                                   size, node_len, items, lens);
+
+    tree += size * node_len;
+    size = (size + 1) >> 1;
+  }
+
+  ok = 1;
+fail:
+  bcrypto_free((void *)items);
+  bcrypto_free(lens);
+
+  JS_ASSERT(ok, JS_ERR_ALLOC);
+
+  CHECK(napi_get_boolean(env, malleated, &malval) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, 2, &result) == napi_ok);
+  CHECK(napi_set_element(env, result, 0, treeval) == napi_ok);
+  CHECK(napi_set_element(env, result, 1, malval) == napi_ok);
 
   return result;
 }
 
 static napi_value
-bcrypto_hash_root(napi_env env, napi_callback_info info) {
+bcrypto_merkle_branch(napi_env env, napi_callback_info info) {
   napi_value argv[3];
   size_t argc = 3;
-  uint8_t out[HASH_MAX_OUTPUT_SIZE];
-  size_t out_len;
-  uint32_t type;
-  const uint8_t *left, *right;
-  size_t left_len, right_len;
-  hash_t ctx;
+  const uint8_t **items = NULL;
+  size_t *lens = NULL;
+  uint8_t *scratch = NULL;
+  uint8_t *branch, *out, *alt;
+  const uint8_t *in;
+  size_t in_len, node_len, size, depth, i, j;
+  uint32_t type, index;
+  int ok = 0;
   napi_value result;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 3);
   CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&left,
-                             &left_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[2], (void **)&right,
-                             &right_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[1], &index) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&in, &in_len) == napi_ok);
 
   JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
 
-  out_len = hash_output_size(type);
+  node_len = hash_output_size(type);
 
-  JS_ASSERT(left_len == out_len && right_len == out_len, JS_ERR_NODE_SIZE);
+  JS_ASSERT(in_len % node_len == 0, JS_ERR_NODE_SIZE);
 
-  hash_init(&ctx, type);
-  hash_update(&ctx, left, left_len);
-  hash_update(&ctx, right, right_len);
-  hash_final(&ctx, out, out_len);
+  size = in_len / node_len;
 
-  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+  JS_ASSERT(index < size, JS_ERR_ARG);
 
-  return result;
-}
+  for (depth = 0, i = size; i > 1; i = (i + 1) >> 1)
+    depth += 1;
 
-static napi_value
-bcrypto_hash_multi(napi_env env, napi_callback_info info) {
-  napi_value argv[4];
-  size_t argc = 4;
-  uint8_t out[HASH_MAX_OUTPUT_SIZE];
-  size_t out_len;
-  uint32_t type;
-  const uint8_t *x, *y, *z;
-  size_t x_len, y_len, z_len;
-  hash_t ctx;
-  napi_value result;
+  if (depth > 0 && !merkle_alloc(&items, &lens, &scratch, size, node_len))
+    goto fail;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 4);
-  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&x, &x_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[2], (void **)&y, &y_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[3], (void **)&z, &z_len) == napi_ok);
+  if (napi_create_buffer(env, depth * node_len,
+                         (void **)&branch, &result) != napi_ok) {
+    goto fail;
+  }
 
-  JS_ASSERT(hash_has_backend(type), JS_ERR_ARG);
+  out = scratch;
+  alt = scratch + ((size + 1) >> 1) * node_len;
 
-  out_len = hash_output_size(type);
+  for (i = 0; i < depth; i++) {
+    uint8_t *tmp = out;
 
-  hash_init(&ctx, type);
-  hash_update(&ctx, x, x_len);
-  hash_update(&ctx, y, y_len);
-  hash_update(&ctx, z, z_len);
-  hash_final(&ctx, out, out_len);
+    j = index ^ 1;
 
-  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+    if (j > size - 1)
+      j = size - 1;
+
+    memcpy(branch + i * node_len, in + j * node_len, node_len);
+
+    /* The root itself is never needed. */
+    if (i == depth - 1)
+      break;
+
+    merkle_hash_level(type, out, in, size, node_len, items, lens);
+
+    index >>= 1;
+    size = (size + 1) >> 1;
+    in = out;
+    out = alt;
+    alt = tmp;
+  }
+
+  ok = 1;
+fail:
+  bcrypto_free((void *)items);
+  bcrypto_free(lens);
+  bcrypto_free(scratch);
+
+  JS_ASSERT(ok, JS_ERR_ALLOC);
 
   return result;
 }
@@ -8022,6 +10348,30 @@ bcrypto_pbkdf2_derive_async(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_pbkdf2_derive_batch(napi_env env, napi_callback_info info) {
+  bcrypto_kdf_job_t *job;
+  napi_value argv[5];
+  size_t argc = 5;
+  uint32_t type, iter, out_len, jobs;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &iter) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &out_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[4], &jobs) == napi_ok);
+
+  job = bcrypto_kdf_job_create(env, KDF_PBKDF2, argv[1], out_len);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->type = type;
+  job->iter = iter;
+
+  return bcrypto_kdf_job_queue(env, job, jobs, "bcrypto:pbkdf2_derive");
+}
+
 /*
  * PGPDF
  */
@@ -8420,26 +10770,256 @@ bcrypto_rsa_complete_(napi_env env, napi_status status, void *data) {
   bcrypto_free(w);
 }
 
+typedef struct bcrypto_rsa_job_s {
+  uint32_t bits;
+  int64_t exp;
+  hmac_drbg_t rng;
+  uint8_t p[RSA_MAX_MOD_SIZE];
+  size_t p_len;
+  uint8_t q[RSA_MAX_MOD_SIZE];
+  size_t q_len;
+  volatile int stop;
+  bcrypto_job_t base;
+} bcrypto_rsa_job_t;
+
+typedef struct bcrypto_rsa_prime_s {
+  bcrypto_rsa_job_t *job;
+  int slot;
+  uint8_t entropy[ENTROPY_SIZE];
+  uint8_t out[RSA_MAX_MOD_SIZE];
+  size_t out_len;
+  int ok;
+  napi_async_work work;
+} bcrypto_rsa_prime_t;
+
+static void
+bcrypto_rsa_job_destroy(bcrypto_rsa_job_t *job) {
+  torsion_cleanse(job, sizeof(bcrypto_rsa_job_t));
+  bcrypto_free(job);
+}
+
+static void
+bcrypto_rsa_prime_execute_(napi_env env, void *data) {
+  bcrypto_rsa_prime_t *w = (bcrypto_rsa_prime_t *)data;
+  bcrypto_rsa_job_t *job = w->job;
+  /* Slot 1 holds the (possibly larger) `p`. */
+  uint32_t bits = (job->bits >> 1) + (job->bits & w->slot & 1);
+
+  (void)env;
+
+  w->ok = rsa_prime_generate(w->out, &w->out_len, bits, job->exp,
+                             w->entropy, &job->stop);
+
+  torsion_cleanse(w->entropy, ENTROPY_SIZE);
+}
+
+static void
+bcrypto_rsa_prime_complete_(napi_env env, napi_status status, void *data);
+
+static void
+bcrypto_rsa_prime_queue(napi_env env, bcrypto_rsa_prime_t *w, int slot) {
+  bcrypto_rsa_job_t *job = w->job;
+
+  w->slot = slot;
+  w->out_len = RSA_MAX_MOD_SIZE;
+  w->ok = 0;
+
+  /* Seeds are drawn on the main thread only. */
+  hmac_drbg_generate(&job->rng, w->entropy, ENTROPY_SIZE, NULL, 0);
+
+  bcrypto_job_queue(env, &job->base, "bcrypto:rsa_privkey_generate",
+                    bcrypto_rsa_prime_execute_,
+                    bcrypto_rsa_prime_complete_,
+                    w, &w->work);
+}
+
+static void
+bcrypto_rsa_prime_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_rsa_prime_t *w = (bcrypto_rsa_prime_t *)data;
+  bcrypto_rsa_job_t *job = w->job;
+  uint8_t out[RSA_MAX_PRIV_SIZE];
+  size_t out_len = RSA_MAX_PRIV_SIZE;
+  uint8_t entropy[ENTROPY_SIZE];
+  napi_value result = NULL;
+  uint8_t *slot;
+  size_t *slot_len;
+  int ok = 0;
+  int last;
+
+  last = bcrypto_job_finish(env, &job->base, w->work);
+
+  if (job->base.done)
+    goto done;
+
+  /* A failure that was not caused by
+     the stop flag means bad arguments. */
+  if (status != napi_ok || !w->ok)
+    goto settle;
+
+  /* With an even modulus size both primes have the
+     same length and either slot will do. */
+  if ((job->bits & 1) == 0 && (w->slot ? job->p_len : job->q_len) != 0)
+    w->slot ^= 1;
+
+  slot = w->slot ? job->p : job->q;
+  slot_len = w->slot ? &job->p_len : &job->q_len;
+
+  if (*slot_len == 0) {
+    memcpy(slot, w->out, w->out_len);
+    *slot_len = w->out_len;
+  }
+
+  torsion_cleanse(w->out, w->out_len);
+
+  if (job->p_len == 0 || job->q_len == 0) {
+    bcrypto_rsa_prime_queue(env, w, job->p_len == 0);
+    return;
+  }
+
+  hmac_drbg_generate(&job->rng, entropy, ENTROPY_SIZE, NULL, 0);
+
+  ok = rsa_privkey_from_primes(out, &out_len, job->bits, job->exp,
+                               job->p, job->p_len, job->q, job->q_len,
+                               entropy);
+
+  torsion_cleanse(entropy, ENTROPY_SIZE);
+
+  if (ok)
+    goto settle;
+
+  /* Unsuitable pair: keep `p` and search for another `q`. */
+  torsion_cleanse(job->q, job->q_len);
+  job->q_len = 0;
+
+  bcrypto_rsa_prime_queue(env, w, 0);
+
+  return;
+settle:
+  job->stop = 1;
+
+  if (ok) {
+    status = napi_create_buffer_copy(env, out_len, out, NULL, &result);
+
+    torsion_cleanse(out, out_len);
+
+    if (status != napi_ok)
+      ok = 0;
+  }
+
+  bcrypto_job_settle(env, &job->base, result, ok ? NULL : JS_ERR_GENERATE);
+done:
+  torsion_cleanse(w->out, sizeof(w->out));
+
+  bcrypto_free(w);
+
+  if (last)
+    bcrypto_rsa_job_destroy(job);
+}
+
+static napi_value
+bcrypto_rsa_privkey_generate_parallel(napi_env env,
+                                      uint32_t bits,
+                                      int64_t exp,
+                                      const uint8_t *entropy,
+                                      uint32_t jobs) {
+  bcrypto_rsa_prime_t **workers = NULL;
+  bcrypto_rsa_job_t *job = NULL;
+  napi_value result;
+  uint32_t i;
+
+  if (jobs > KEYGEN_MAX_JOBS)
+    jobs = KEYGEN_MAX_JOBS;
+
+  job = bcrypto_malloc(sizeof(bcrypto_rsa_job_t));
+
+  if (job == NULL)
+    goto fail;
+
+  job->bits = bits;
+  job->exp = exp;
+  job->p_len = 0;
+  job->q_len = 0;
+  job->stop = 0;
+
+  bcrypto_job_init(&job->base);
+
+  hmac_drbg_init(&job->rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+
+  workers = bcrypto_malloc(jobs * sizeof(bcrypto_rsa_prime_t *));
+
+  if (workers == NULL)
+    goto fail;
+
+  for (i = 0; i < jobs; i++) {
+    workers[i] = bcrypto_malloc(sizeof(bcrypto_rsa_prime_t));
+
+    if (workers[i] == NULL)
+      break;
+
+    workers[i]->job = job;
+  }
+
+  if (i != jobs) {
+    while (i--)
+      bcrypto_free(workers[i]);
+
+    goto fail;
+  }
+
+  CHECK(napi_create_promise(env, &job->base.deferred, &result) == napi_ok);
+
+  /* Workers are pooled: each one searches for a
+     single prime and is requeued for whichever slot
+     is still empty until a key can be assembled. */
+  for (i = 0; i < jobs; i++)
+    bcrypto_rsa_prime_queue(env, workers[i], i & 1);
+
+  bcrypto_free(workers);
+
+  torsion_cleanse((void *)entropy, ENTROPY_SIZE);
+
+  return result;
+fail:
+  if (job != NULL)
+    bcrypto_rsa_job_destroy(job);
+
+  bcrypto_free(workers);
+
+  JS_THROW(JS_ERR_GENERATE);
+}
+
 static napi_value
 bcrypto_rsa_privkey_generate_async(napi_env env, napi_callback_info info) {
   bcrypto_rsa_worker_t *worker;
-  napi_value argv[3];
-  size_t argc = 3;
-  uint32_t bits;
+  napi_value argv[4];
+  size_t argc = 4;
+  uint32_t bits, jobs;
   int64_t exp;
   const uint8_t *entropy;
   size_t entropy_len;
   napi_value workname, result;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 3);
+  CHECK(argc == 4);
   CHECK(napi_get_value_uint32(env, argv[0], &bits) == napi_ok);
   CHECK(napi_get_value_int64(env, argv[1], &exp) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[2], (void **)&entropy,
                              &entropy_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &jobs) == napi_ok);
 
   JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
 
+  /* Invalid arguments take the serial path, which rejects. */
+  if (jobs > 1
+      && bits >= RSA_MIN_MOD_BITS
+      && bits <= RSA_MAX_MOD_BITS
+      && exp >= (int64_t)RSA_MIN_EXP
+      && exp <= (int64_t)RSA_MAX_EXP
+      && (exp & 1) != 0) {
+    return bcrypto_rsa_privkey_generate_parallel(env, bits, exp,
+                                                 entropy, jobs);
+  }
+
   worker = bcrypto_xmalloc(sizeof(bcrypto_rsa_worker_t));
   worker->bits = bits;
   worker->exp = exp;
@@ -8973,6 +11553,176 @@ bcrypto_rsa_unveil(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_rsa_privkey_destroy_(napi_env env, void *data, void *hint) {
+  bcrypto_rsa_privkey_t *key = (bcrypto_rsa_privkey_t *)data;
+
+  (void)env;
+  (void)hint;
+
+  rsa_privkey_destroy(key->ctx);
+  bcrypto_free(key);
+}
+
+static napi_value
+bcrypto_rsa_privkey_parse(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *key, *entropy;
+  size_t key_len, entropy_len;
+  bcrypto_rsa_privkey_t *wrap;
+  rsa_privkey_t *ctx;
+  napi_value handle;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_buffer_info(env, argv[0], (void **)&key, &key_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&entropy,
+                             &entropy_len) == napi_ok);
+
+  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+
+  ctx = rsa_privkey_parse(key, key_len, entropy);
+
+  torsion_cleanse((void *)entropy, entropy_len);
+
+  JS_ASSERT(ctx != NULL, JS_ERR_PRIVKEY);
+
+  wrap = bcrypto_xmalloc(sizeof(bcrypto_rsa_privkey_t));
+  wrap->tag = bcrypto_rsa_privkey_tag;
+  wrap->ctx = ctx;
+
+  CHECK(napi_create_external(env,
+                             wrap,
+                             bcrypto_rsa_privkey_destroy_,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_rsa_sign_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[RSA_MAX_MOD_SIZE];
+  size_t out_len = RSA_MAX_MOD_SIZE;
+  uint32_t type;
+  const uint8_t *msg;
+  size_t msg_len;
+  bcrypto_rsa_privkey_t *key;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[2], bcrypto_rsa_privkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PRIVKEY);
+
+  JS_ASSERT(rsa_sign_parsed(out, &out_len, type, msg, msg_len, key->ctx),
+            JS_ERR_SIGN);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_rsa_decrypt_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[RSA_MAX_MOD_SIZE];
+  size_t out_len = RSA_MAX_MOD_SIZE;
+  const uint8_t *msg;
+  size_t msg_len;
+  bcrypto_rsa_privkey_t *key;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_buffer_info(env, argv[0], (void **)&msg, &msg_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[1], bcrypto_rsa_privkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PRIVKEY);
+
+  JS_ASSERT(rsa_decrypt_parsed(out, &out_len, msg, msg_len, key->ctx),
+            JS_ERR_DECRYPT);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  torsion_cleanse(out, out_len);
+
+  return result;
+}
+
+static napi_value
+bcrypto_rsa_sign_pss_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t out[RSA_MAX_MOD_SIZE];
+  size_t out_len = RSA_MAX_MOD_SIZE;
+  uint32_t type;
+  const uint8_t *msg;
+  size_t msg_len;
+  int32_t salt_len;
+  bcrypto_rsa_privkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[2], bcrypto_rsa_privkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PRIVKEY);
+  CHECK(napi_get_value_int32(env, argv[3], &salt_len) == napi_ok);
+
+  ok = rsa_sign_pss_parsed(out, &out_len, type, msg, msg_len,
+                           key->ctx, salt_len);
+
+  JS_ASSERT(ok, JS_ERR_SIGN);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_rsa_decrypt_oaep_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t out[RSA_MAX_MOD_SIZE];
+  size_t out_len = RSA_MAX_MOD_SIZE;
+  uint32_t type;
+  const uint8_t *msg, *label;
+  size_t msg_len, label_len;
+  bcrypto_rsa_privkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[2], bcrypto_rsa_privkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PRIVKEY);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&label,
+                             &label_len) == napi_ok);
+
+  ok = rsa_decrypt_oaep_parsed(out, &out_len, type, msg, msg_len,
+                               key->ctx, label, label_len);
+
+  JS_ASSERT(ok, JS_ERR_DECRYPT);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
 /*
  * Salsa20
  */
@@ -9771,6 +12521,41 @@ bcrypto_schnorr_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_schnorr_sign_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+
+  w->ok = schnorr_sign(ec->ctx, w->out, w->ptrs[0], w->lens[0],
+                                        w->ptrs[1], w->ptrs[2]);
+  w->out_len = ec->schnorr_size;
+}
+
+static napi_value
+bcrypto_schnorr_sign_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  const uint8_t *priv, *aux;
+  size_t priv_len, aux_len;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&aux, &aux_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+  JS_ASSERT(aux_len == 32, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_schnorr_sign_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:schnorr_sign");
+}
+
 static napi_value
 bcrypto_schnorr_verify(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -9797,6 +12582,84 @@ bcrypto_schnorr_verify(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_schnorr_verify_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+
+  w->ok = w->lens[1] == ec->schnorr_size
+       && w->lens[2] == ec->field_size
+       && schnorr_verify(ec->ctx, w->ptrs[0], w->lens[0],
+                                  w->ptrs[1], w->ptrs[2]);
+}
+
+static napi_value
+bcrypto_schnorr_verify_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_schnorr_verify_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:schnorr_verify");
+}
+
+static napi_value
+bcrypto_schnorr_pubkey_parse(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *pub;
+  size_t pub_len;
+  bcrypto_wei_curve_t *ec;
+  wei_pubkey_t *ctx;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+
+  JS_ASSERT(pub_len == ec->field_size, JS_ERR_PUBKEY_SIZE);
+  JS_ASSERT(ctx = schnorr_pubkey_parse(ec->ctx, pub), JS_ERR_PUBKEY);
+
+  return bcrypto_wei_pubkey_wrap(env, bcrypto_schnorr_pubkey_tag, ec, ctx);
+}
+
+static napi_value
+bcrypto_schnorr_verify_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pubkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[3], bcrypto_schnorr_pubkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PUBKEY);
+
+  JS_ASSERT(key->ec == ec, JS_ERR_PUBKEY);
+
+  ok = sig_len == ec->schnorr_size
+    && schnorr_verify_parsed(ec->ctx, msg, msg_len, sig, key->ctx);
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_schnorr_verify_batch(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -9843,31 +12706,117 @@ bcrypto_schnorr_verify_batch(napi_env env, napi_callback_info info) {
     CHECK(napi_get_buffer_info(env, items[0], (void **)&msgs[i],
                                &msg_lens[i]) == napi_ok);
 
-    CHECK(napi_get_buffer_info(env, items[1], (void **)&sigs[i],
-                               &sig_len) == napi_ok);
+    CHECK(napi_get_buffer_info(env, items[1], (void **)&sigs[i],
+                               &sig_len) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[2], (void **)&pubs[i],
+                               &pub_len) == napi_ok);
+
+    if (sig_len != ec->schnorr_size || pub_len != ec->field_size)
+      goto fail;
+  }
+
+  ok = schnorr_verify_batch(ec->ctx, msgs, msg_lens, sigs, pubs,
+                            length, bcrypto_wei_scratch(ec, length * 2));
+
+fail:
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  bcrypto_free((void *)ptrs);
+  bcrypto_free(lens);
+
+  return result;
+}
+
+static int
+bcrypto_schnorr_verify_range_(bcrypto_ecc_worker_t *w,
+                              void *arg,
+                              size_t start,
+                              size_t count) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  size_t i, length = w->length;
+  const uint8_t **msgs = &w->ptrs[length * 0 + start];
+  const uint8_t **sigs = &w->ptrs[length * 1 + start];
+  const uint8_t **pubs = &w->ptrs[length * 2 + start];
+  const size_t *msg_lens = &w->lens[length * 0 + start];
+  const size_t *sig_lens = &w->lens[length * 1 + start];
+  const size_t *pub_lens = &w->lens[length * 2 + start];
+
+  for (i = 0; i < count; i++) {
+    if (sig_lens[i] != ec->schnorr_size || pub_lens[i] != ec->field_size)
+      return 0;
+  }
+
+  if (count == 0)
+    return 1;
+
+  return schnorr_verify_batch(ec->ctx, msgs, msg_lens, sigs, pubs,
+                              count, arg);
+}
+
+static void
+bcrypto_schnorr_verify_batch_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  size_t size = bcrypto_scratch_size(w->length * 2);
+  wei_scratch_t *scratch = wei_scratch_create(ec->ctx, size);
+
+  CHECK(scratch != NULL);
+
+  bcrypto_ecc_verify_batch(w, bcrypto_schnorr_verify_range_, scratch);
+
+  wei_scratch_destroy(ec->ctx, scratch);
+}
+
+static napi_value
+bcrypto_schnorr_verify_batch_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
 
-    CHECK(napi_get_buffer_info(env, items[2], (void **)&pubs[i],
-                               &pub_len) == napi_ok);
+  worker = bcrypto_ecc_worker_batch(env, bcrypto_schnorr_verify_batch_execute_,
+                                    argv[0], ec, &ec->workers, argv[1], NULL);
 
-    if (sig_len != ec->schnorr_size || pub_len != ec->field_size)
-      goto fail;
-  }
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:schnorr_verify_batch");
+}
 
-  if (ec->scratch == NULL)
-    ec->scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
+static napi_value
+bcrypto_schnorr_verify_batch_parallel(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint32_t jobs;
+  bool find;
+  bcrypto_wei_curve_t *ec;
 
-  CHECK(ec->scratch != NULL);
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &jobs) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[3], &find) == napi_ok);
 
-  ok = schnorr_verify_batch(ec->ctx, msgs, msg_lens, sigs,
-                            pubs, length, ec->scratch);
+  return bcrypto_ecc_verify_parallel(env,
+                                     bcrypto_schnorr_verify_batch_execute_,
+                                     argv[0], ec,
+                                     &ec->workers, argv[1], NULL, 0, jobs, find,
+                                     "bcrypto:schnorr_verify_batch");
+}
 
-fail:
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+static napi_value
+bcrypto_schnorr_verify_batch_find(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_wei_curve_t *ec;
 
-  bcrypto_free((void *)ptrs);
-  bcrypto_free(lens);
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
 
-  return result;
+  return bcrypto_ecc_verify_find(env, bcrypto_schnorr_verify_batch_execute_,
+                                 argv[0], ec, &ec->workers, argv[1], NULL, 0);
 }
 
 static napi_value
@@ -9934,6 +12883,40 @@ bcrypto_schnorr_legacy_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_schnorr_legacy_sign_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+
+  w->ok = schnorr_legacy_sign(ec->ctx, w->out, w->ptrs[0], w->lens[0],
+                                               w->ptrs[1]);
+  w->out_len = ec->legacy_size;
+}
+
+static napi_value
+bcrypto_schnorr_legacy_sign_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(schnorr_legacy_support(ec->ctx), JS_ERR_NO_SCHNORR);
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_schnorr_legacy_sign_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:schnorr_legacy_sign");
+}
+
 static napi_value
 bcrypto_schnorr_legacy_verify(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -9961,6 +12944,36 @@ bcrypto_schnorr_legacy_verify(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_schnorr_legacy_verify_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+
+  w->ok = w->lens[1] == ec->legacy_size
+       && schnorr_legacy_verify(ec->ctx, w->ptrs[0], w->lens[0], w->ptrs[1],
+                                         w->ptrs[2], w->lens[2]);
+}
+
+static napi_value
+bcrypto_schnorr_legacy_verify_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  JS_ASSERT(schnorr_legacy_support(ec->ctx), JS_ERR_NO_SCHNORR);
+
+  worker = bcrypto_ecc_worker_create(env,
+                                     bcrypto_schnorr_legacy_verify_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:schnorr_legacy_verify");
+}
+
 static napi_value
 bcrypto_schnorr_legacy_verify_batch(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -10020,13 +13033,9 @@ bcrypto_schnorr_legacy_verify_batch(napi_env env, napi_callback_info info) {
       goto fail;
   }
 
-  if (ec->scratch == NULL)
-    ec->scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
-
-  CHECK(ec->scratch != NULL);
-
   ok = schnorr_legacy_verify_batch(ec->ctx, msgs, msg_lens, sigs,
-                                   pubs, pub_lens, length, ec->scratch);
+                                   pubs, pub_lens, length,
+                                   bcrypto_wei_scratch(ec, length * 2));
 
 fail:
   CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
@@ -10037,6 +13046,108 @@ fail:
   return result;
 }
 
+static int
+bcrypto_schnorr_legacy_verify_range_(bcrypto_ecc_worker_t *w,
+                                     void *arg,
+                                     size_t start,
+                                     size_t count) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  size_t i, length = w->length;
+  const uint8_t **msgs = &w->ptrs[length * 0 + start];
+  const uint8_t **sigs = &w->ptrs[length * 1 + start];
+  const uint8_t **pubs = &w->ptrs[length * 2 + start];
+  const size_t *msg_lens = &w->lens[length * 0 + start];
+  const size_t *sig_lens = &w->lens[length * 1 + start];
+  const size_t *pub_lens = &w->lens[length * 2 + start];
+
+  for (i = 0; i < count; i++) {
+    if (sig_lens[i] != ec->legacy_size)
+      return 0;
+  }
+
+  if (count == 0)
+    return 1;
+
+  return schnorr_legacy_verify_batch(ec->ctx, msgs, msg_lens, sigs,
+                                     pubs, pub_lens, count, arg);
+}
+
+static void
+bcrypto_schnorr_legacy_verify_batch_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_wei_curve_t *ec = w->ec;
+  size_t size = bcrypto_scratch_size(w->length * 2);
+  wei_scratch_t *scratch = wei_scratch_create(ec->ctx, size);
+
+  CHECK(scratch != NULL);
+
+  bcrypto_ecc_verify_batch(w, bcrypto_schnorr_legacy_verify_range_, scratch);
+
+  wei_scratch_destroy(ec->ctx, scratch);
+}
+
+static napi_value
+bcrypto_schnorr_legacy_verify_batch_async(napi_env env,
+                                          napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  JS_ASSERT(schnorr_legacy_support(ec->ctx), JS_ERR_NO_SCHNORR);
+
+  worker = bcrypto_ecc_worker_batch(env,
+    bcrypto_schnorr_legacy_verify_batch_execute_,
+    argv[0], ec, &ec->workers, argv[1], NULL);
+
+  return bcrypto_ecc_worker_queue(env, worker,
+                                  "bcrypto:schnorr_legacy_verify_batch");
+}
+
+static napi_value
+bcrypto_schnorr_legacy_verify_batch_parallel(napi_env env,
+                                             napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint32_t jobs;
+  bool find;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &jobs) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[3], &find) == napi_ok);
+
+  JS_ASSERT(schnorr_legacy_support(ec->ctx), JS_ERR_NO_SCHNORR);
+
+  return bcrypto_ecc_verify_parallel(env,
+    bcrypto_schnorr_legacy_verify_batch_execute_,
+    argv[0], ec, &ec->workers, argv[1], NULL, 0, jobs, find,
+    "bcrypto:schnorr_legacy_verify_batch");
+}
+
+static napi_value
+bcrypto_schnorr_legacy_verify_batch_find(napi_env env,
+                                         napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_wei_curve_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  JS_ASSERT(schnorr_legacy_support(ec->ctx), JS_ERR_NO_SCHNORR);
+
+  return bcrypto_ecc_verify_find(env,
+                                 bcrypto_schnorr_legacy_verify_batch_execute_,
+                                 argv[0], ec, &ec->workers, argv[1], NULL, 0);
+}
+
 /*
  * Scrypt
  */
@@ -10065,82 +13176,278 @@ bcrypto_scrypt_derive(napi_env env, napi_callback_info info) {
   CHECK(napi_get_value_uint32(env, argv[4], &p) == napi_ok);
   CHECK(napi_get_value_uint32(env, argv[5], &out_len) == napi_ok);
 
-  JS_ASSERT(out_len <= MAX_BUFFER_LENGTH, JS_ERR_ALLOC);
+  JS_ASSERT(out_len <= MAX_BUFFER_LENGTH, JS_ERR_ALLOC);
+
+  JS_CHECK_ALLOC(napi_create_buffer(env, out_len, (void **)&out, &result));
+
+  ok = scrypt_derive(out, pass, pass_len, salt, salt_len, N, r, p, out_len);
+
+  JS_ASSERT(ok, JS_ERR_DERIVE);
+
+  return result;
+}
+
+typedef struct bcrypto_scrypt_worker_s {
+  uint8_t *pass;
+  size_t pass_len;
+  uint8_t *salt;
+  size_t salt_len;
+  int64_t N;
+  uint32_t r;
+  uint32_t p;
+  uint8_t *out;
+  uint32_t out_len;
+  const char *error;
+  napi_async_work work;
+  napi_deferred deferred;
+} bcrypto_scrypt_worker_t;
+
+static void
+bcrypto_scrypt_execute_(napi_env env, void *data) {
+  bcrypto_scrypt_worker_t *w = (bcrypto_scrypt_worker_t *)data;
+
+  (void)env;
+
+  if (!scrypt_derive(w->out, w->pass, w->pass_len,
+                     w->salt, w->salt_len, w->N, w->r, w->p, w->out_len)) {
+    w->error = JS_ERR_DERIVE;
+  }
+
+  torsion_cleanse(w->pass, w->pass_len);
+  torsion_cleanse(w->salt, w->salt_len);
+}
+
+static void
+bcrypto_scrypt_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_scrypt_worker_t *w = (bcrypto_scrypt_worker_t *)data;
+  napi_value result, strval, errval;
+
+  if (w->error == NULL && status == napi_ok)
+    status = napi_create_buffer_copy(env, w->out_len, w->out, NULL, &result);
+
+  if (status != napi_ok)
+    w->error = JS_ERR_DERIVE;
+
+  if (w->error == NULL) {
+    CHECK(napi_resolve_deferred(env, w->deferred, result) == napi_ok);
+  } else {
+    CHECK(napi_create_string_latin1(env, w->error, NAPI_AUTO_LENGTH,
+                                    &strval) == napi_ok);
+    CHECK(napi_create_error(env, NULL, strval, &errval) == napi_ok);
+    CHECK(napi_reject_deferred(env, w->deferred, errval) == napi_ok);
+  }
+
+  CHECK(napi_delete_async_work(env, w->work) == napi_ok);
+
+  bcrypto_free(w->pass);
+  bcrypto_free(w->salt);
+  bcrypto_free(w->out);
+  bcrypto_free(w);
+}
+
+/* Cap on the combined V buffers of a parallel derivation. */
+#define SCRYPT_MAX_PARALLEL_MEMORY ((uint64_t)1 << 30)
+
+typedef struct bcrypto_scrypt_job_s {
+  uint8_t *pass;
+  size_t pass_len;
+  uint8_t *B;
+  size_t B_len;
+  uint32_t r;
+  uint32_t p;
+  uint32_t out_len;
+  int ok;
+  bcrypto_job_t base;
+} bcrypto_scrypt_job_t;
+
+typedef struct bcrypto_scrypt_lane_s {
+  bcrypto_scrypt_job_t *job;
+  uint8_t *B;
+  int64_t N;
+  uint32_t lanes;
+  int ok;
+  napi_async_work work;
+} bcrypto_scrypt_lane_t;
+
+static void
+bcrypto_scrypt_job_destroy(bcrypto_scrypt_job_t *job) {
+  if (job->pass_len > 0)
+    torsion_cleanse(job->pass, job->pass_len);
+
+  if (job->B_len > 0)
+    torsion_cleanse(job->B, job->B_len);
+
+  bcrypto_free(job->pass);
+  bcrypto_free(job->B);
+  bcrypto_free(job);
+}
+
+static void
+bcrypto_scrypt_lane_execute_(napi_env env, void *data) {
+  bcrypto_scrypt_lane_t *w = (bcrypto_scrypt_lane_t *)data;
+
+  (void)env;
+
+  /* Each worker mixes a disjoint range of B. */
+  w->ok = scrypt_mix(w->B, w->N, w->job->r, w->lanes);
+}
+
+static void
+bcrypto_scrypt_lane_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_scrypt_lane_t *w = (bcrypto_scrypt_lane_t *)data;
+  bcrypto_scrypt_job_t *job = w->job;
+  napi_value result = NULL;
+  uint8_t *out;
+  int last;
+
+  if (status != napi_ok || !w->ok)
+    job->ok = 0;
+
+  last = bcrypto_job_finish(env, &job->base, w->work);
+
+  bcrypto_free(w);
+
+  if (!last)
+    return;
+
+  if (job->ok) {
+    status = napi_create_buffer(env, job->out_len, (void **)&out, &result);
+
+    if (status != napi_ok || !scrypt_final(out, job->pass, job->pass_len,
+                                           job->B, job->r, job->p,
+                                           job->out_len)) {
+      job->ok = 0;
+    }
+  }
+
+  bcrypto_job_settle(env, &job->base, result, job->ok ? NULL : JS_ERR_DERIVE);
+
+  bcrypto_scrypt_job_destroy(job);
+}
+
+static napi_value
+bcrypto_scrypt_derive_parallel(napi_env env,
+                               const uint8_t *pass,
+                               size_t pass_len,
+                               const uint8_t *salt,
+                               size_t salt_len,
+                               int64_t N,
+                               uint32_t r,
+                               uint32_t p,
+                               uint32_t out_len,
+                               uint32_t jobs) {
+  bcrypto_scrypt_lane_t **workers = NULL;
+  bcrypto_scrypt_job_t *job = NULL;
+  uint64_t lane_mem, max_jobs;
+  uint32_t i, chunk, start;
+  napi_value result;
+
+  /* Validated again by scrypt_init. */
+  if (N <= 0 || r == 0 || p == 0 || out_len == 0)
+    goto fail;
+
+  /* Every worker holds its own V (128 * r * N bytes). */
+  lane_mem = (uint64_t)r * (uint64_t)N;
+
+  if (lane_mem >= (UINT64_C(1) << 25))
+    goto fail;
+
+  max_jobs = SCRYPT_MAX_PARALLEL_MEMORY / (lane_mem * 128);
+
+  if (jobs > max_jobs)
+    jobs = max_jobs;
+
+  if (jobs > p)
+    jobs = p;
+
+  if (jobs == 0)
+    jobs = 1;
+
+  chunk = (p / jobs) + ((p % jobs) != 0);
+  jobs = (p + chunk - 1) / chunk;
+
+  job = bcrypto_malloc(sizeof(bcrypto_scrypt_job_t));
+
+  if (job == NULL)
+    goto fail;
+
+  job->pass = bcrypto_malloc(pass_len);
+  job->pass_len = pass_len;
+  job->B_len = (size_t)128 * r * p;
+  job->B = bcrypto_malloc(job->B_len);
+  job->r = r;
+  job->p = p;
+  job->out_len = out_len;
+  job->ok = 1;
+
+  bcrypto_job_init(&job->base);
 
-  JS_CHECK_ALLOC(napi_create_buffer(env, out_len, (void **)&out, &result));
+  if ((job->pass == NULL && pass_len != 0) || job->B == NULL) {
+    job->pass_len = 0;
+    job->B_len = 0;
+    goto fail;
+  }
 
-  ok = scrypt_derive(out, pass, pass_len, salt, salt_len, N, r, p, out_len);
+  if (pass_len > 0)
+    memcpy(job->pass, pass, pass_len);
 
-  JS_ASSERT(ok, JS_ERR_DERIVE);
+  /* The initial PBKDF2 pass is a single iteration; run it here. */
+  if (!scrypt_init(job->B, pass, pass_len, salt, salt_len, N, r, p))
+    goto fail;
 
-  return result;
-}
+  workers = bcrypto_malloc(jobs * sizeof(bcrypto_scrypt_lane_t *));
 
-typedef struct bcrypto_scrypt_worker_s {
-  uint8_t *pass;
-  size_t pass_len;
-  uint8_t *salt;
-  size_t salt_len;
-  int64_t N;
-  uint32_t r;
-  uint32_t p;
-  uint8_t *out;
-  uint32_t out_len;
-  const char *error;
-  napi_async_work work;
-  napi_deferred deferred;
-} bcrypto_scrypt_worker_t;
+  if (workers == NULL)
+    goto fail;
 
-static void
-bcrypto_scrypt_execute_(napi_env env, void *data) {
-  bcrypto_scrypt_worker_t *w = (bcrypto_scrypt_worker_t *)data;
+  for (i = 0, start = 0; i < jobs; i++, start += chunk) {
+    workers[i] = bcrypto_malloc(sizeof(bcrypto_scrypt_lane_t));
 
-  (void)env;
+    if (workers[i] == NULL)
+      break;
 
-  if (!scrypt_derive(w->out, w->pass, w->pass_len,
-                     w->salt, w->salt_len, w->N, w->r, w->p, w->out_len)) {
-    w->error = JS_ERR_DERIVE;
+    workers[i]->job = job;
+    workers[i]->B = &job->B[(size_t)start * 128 * r];
+    workers[i]->N = N;
+    workers[i]->lanes = p - start < chunk ? p - start : chunk;
+    workers[i]->ok = 0;
   }
 
-  torsion_cleanse(w->pass, w->pass_len);
-  torsion_cleanse(w->salt, w->salt_len);
-}
-
-static void
-bcrypto_scrypt_complete_(napi_env env, napi_status status, void *data) {
-  bcrypto_scrypt_worker_t *w = (bcrypto_scrypt_worker_t *)data;
-  napi_value result, strval, errval;
+  if (i != jobs) {
+    while (i--)
+      bcrypto_free(workers[i]);
 
-  if (w->error == NULL && status == napi_ok)
-    status = napi_create_buffer_copy(env, w->out_len, w->out, NULL, &result);
+    goto fail;
+  }
 
-  if (status != napi_ok)
-    w->error = JS_ERR_DERIVE;
+  CHECK(napi_create_promise(env, &job->base.deferred, &result) == napi_ok);
 
-  if (w->error == NULL) {
-    CHECK(napi_resolve_deferred(env, w->deferred, result) == napi_ok);
-  } else {
-    CHECK(napi_create_string_latin1(env, w->error, NAPI_AUTO_LENGTH,
-                                    &strval) == napi_ok);
-    CHECK(napi_create_error(env, NULL, strval, &errval) == napi_ok);
-    CHECK(napi_reject_deferred(env, w->deferred, errval) == napi_ok);
+  for (i = 0; i < jobs; i++) {
+    bcrypto_job_queue(env, &job->base, "bcrypto:scrypt_derive",
+                      bcrypto_scrypt_lane_execute_,
+                      bcrypto_scrypt_lane_complete_,
+                      workers[i], &workers[i]->work);
   }
 
-  CHECK(napi_delete_async_work(env, w->work) == napi_ok);
+  bcrypto_free(workers);
 
-  bcrypto_free(w->pass);
-  bcrypto_free(w->salt);
-  bcrypto_free(w->out);
-  bcrypto_free(w);
+  return result;
+fail:
+  if (job != NULL)
+    bcrypto_scrypt_job_destroy(job);
+
+  bcrypto_free(workers);
+
+  JS_THROW(JS_ERR_DERIVE);
 }
 
 static napi_value
 bcrypto_scrypt_derive_async(napi_env env, napi_callback_info info) {
   bcrypto_scrypt_worker_t *worker;
-  napi_value argv[6];
-  size_t argc = 6;
+  napi_value argv[7];
+  size_t argc = 7;
   uint8_t *out;
-  uint32_t out_len;
+  uint32_t out_len, jobs;
   const uint8_t *pass, *salt;
   size_t pass_len, salt_len;
   int64_t N;
@@ -10148,7 +13455,7 @@ bcrypto_scrypt_derive_async(napi_env env, napi_callback_info info) {
   napi_value workname, result;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 6);
+  CHECK(argc == 7);
   CHECK(napi_get_buffer_info(env, argv[0], (void **)&pass,
                              &pass_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[1], (void **)&salt,
@@ -10157,9 +13464,16 @@ bcrypto_scrypt_derive_async(napi_env env, napi_callback_info info) {
   CHECK(napi_get_value_uint32(env, argv[3], &r) == napi_ok);
   CHECK(napi_get_value_uint32(env, argv[4], &p) == napi_ok);
   CHECK(napi_get_value_uint32(env, argv[5], &out_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[6], &jobs) == napi_ok);
 
   JS_ASSERT(out_len <= MAX_BUFFER_LENGTH, JS_ERR_ALLOC);
 
+  if (jobs > 1 && p > 1 && out_len > 0) {
+    return bcrypto_scrypt_derive_parallel(env, pass, pass_len,
+                                          salt, salt_len,
+                                          N, r, p, out_len, jobs);
+  }
+
   out = bcrypto_malloc(out_len);
 
   JS_ASSERT(out != NULL || out_len == 0, JS_ERR_ALLOC);
@@ -10209,6 +13523,42 @@ bcrypto_scrypt_derive_async(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_scrypt_derive_batch(napi_env env, napi_callback_info info) {
+  bcrypto_kdf_job_t *job;
+  napi_value argv[6];
+  size_t argc = 6;
+  uint32_t r, p, out_len, jobs;
+  uint64_t lane_mem;
+  int64_t N;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 6);
+  CHECK(napi_get_value_int64(env, argv[1], &N) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &r) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &p) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[4], &out_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[5], &jobs) == napi_ok);
+
+  /* Every worker holds one V (128 * r * N bytes) at a time. */
+  if (N > 0 && N <= UINT32_MAX && r > 0 && r < (UINT32_C(1) << 24)) {
+    lane_mem = (uint64_t)r * (uint64_t)N * 128;
+
+    if (jobs > SCRYPT_MAX_PARALLEL_MEMORY / lane_mem)
+      jobs = SCRYPT_MAX_PARALLEL_MEMORY / lane_mem;
+  }
+
+  job = bcrypto_kdf_job_create(env, KDF_SCRYPT, argv[0], out_len);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->N = N;
+  job->r = r;
+  job->p = p;
+
+  return bcrypto_kdf_job_queue(env, job, jobs, "bcrypto:scrypt_derive");
+}
+
 /*
  * Secp256k1
  */
@@ -10240,6 +13590,7 @@ bcrypto_secp256k1_context_create(napi_env env, napi_callback_info info) {
   JS_ASSERT(ctx = secp256k1_context_create(flags), JS_ERR_CONTEXT);
 
   ec = bcrypto_xmalloc(sizeof(bcrypto_secp256k1_t));
+  ec->workers = 0;
   ec->ctx = ctx;
   ec->scratch = NULL;
 
@@ -10267,6 +13618,7 @@ bcrypto_secp256k1_context_randomize(napi_env env, napi_callback_info info) {
                              &entropy_len) == napi_ok);
 
   JS_ASSERT(entropy_len == 32, JS_ERR_ENTROPY_SIZE);
+  JS_ASSERT(ec->workers == 0, JS_ERR_STATE);
   JS_ASSERT(secp256k1_context_randomize(ec->ctx, entropy), JS_ERR_RANDOM);
 
   torsion_cleanse((void *)entropy, entropy_len);
@@ -11184,6 +14536,48 @@ bcrypto_secp256k1_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_secp256k1_sign_execute_(bcrypto_ecc_worker_t *w) {
+  secp256k1_nonce_function noncefn = secp256k1_nonce_function_rfc6979;
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_ecdsa_signature sigout;
+  unsigned char msg32[32];
+
+  secp256k1_ecdsa_reduce(ec->ctx, msg32, w->ptrs[0], w->lens[0]);
+
+  w->ok = secp256k1_ecdsa_sign(ec->ctx, &sigout, msg32,
+                               w->ptrs[1], noncefn, NULL);
+
+  if (w->ok) {
+    secp256k1_ecdsa_signature_serialize_compact(ec->ctx, w->out, &sigout);
+    w->out_len = 64;
+  }
+}
+
+static napi_value
+bcrypto_secp256k1_sign_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == 32, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_secp256k1_sign_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:secp256k1_sign");
+}
+
 static napi_value
 bcrypto_secp256k1_sign_recoverable(napi_env env, napi_callback_info info) {
   secp256k1_nonce_function noncefn = secp256k1_nonce_function_rfc6979;
@@ -11263,6 +14657,46 @@ bcrypto_secp256k1_sign_der(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_secp256k1_sign_der_execute_(bcrypto_ecc_worker_t *w) {
+  secp256k1_nonce_function noncefn = secp256k1_nonce_function_rfc6979;
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_ecdsa_signature sigout;
+  unsigned char msg32[32];
+
+  secp256k1_ecdsa_reduce(ec->ctx, msg32, w->ptrs[0], w->lens[0]);
+
+  w->out_len = 72;
+  w->ok = secp256k1_ecdsa_sign(ec->ctx, &sigout, msg32,
+                               w->ptrs[1], noncefn, NULL)
+       && secp256k1_ecdsa_signature_serialize_der(ec->ctx, w->out,
+                                                  &w->out_len, &sigout);
+}
+
+static napi_value
+bcrypto_secp256k1_sign_der_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == 32, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_secp256k1_sign_der_execute_,
+                                     ECC_RESULT_BUFFER, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:secp256k1_sign_der");
+}
+
 static napi_value
 bcrypto_secp256k1_sign_recoverable_der(napi_env env, napi_callback_info info) {
   secp256k1_nonce_function noncefn = secp256k1_nonce_function_rfc6979;
@@ -11349,6 +14783,134 @@ bcrypto_secp256k1_verify(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_secp256k1_verify_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_ecdsa_signature sigin;
+  secp256k1_pubkey pubkey;
+  unsigned char msg32[32];
+
+  w->ok = w->lens[1] == 64 && w->lens[2] > 0
+       && secp256k1_ecdsa_signature_parse_compact(ec->ctx, &sigin, w->ptrs[1])
+       && secp256k1_ec_pubkey_parse(ec->ctx, &pubkey, w->ptrs[2], w->lens[2]);
+
+  if (w->ok) {
+    secp256k1_ecdsa_signature_normalize(ec->ctx, &sigin, &sigin);
+    secp256k1_ecdsa_reduce(ec->ctx, msg32, w->ptrs[0], w->lens[0]);
+
+    w->ok = secp256k1_ecdsa_verify(ec->ctx, &sigin, msg32, &pubkey);
+  }
+}
+
+static napi_value
+bcrypto_secp256k1_verify_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_secp256k1_verify_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:secp256k1_verify");
+}
+
+static void
+bcrypto_secp256k1_pubkey_destroy(napi_env env, void *data, void *hint) {
+  (void)env;
+  (void)hint;
+
+  bcrypto_free(data);
+}
+
+static napi_value
+bcrypto_secp256k1_pubkey_wrap(napi_env env, bcrypto_secp256k1_pubkey_t *key) {
+  napi_value handle;
+
+  CHECK(napi_create_external(env,
+                             key,
+                             bcrypto_secp256k1_pubkey_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_secp256k1_pubkey_parse(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *pub;
+  size_t pub_len;
+  secp256k1_pubkey pubkey;
+  bcrypto_secp256k1_t *ec;
+  bcrypto_secp256k1_pubkey_t *key;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+
+  JS_ASSERT(pub_len > 0, JS_ERR_PUBKEY);
+  JS_ASSERT(secp256k1_ec_pubkey_parse(ec->ctx, &pubkey, pub, pub_len),
+            JS_ERR_PUBKEY);
+
+  key = bcrypto_xmalloc(sizeof(bcrypto_secp256k1_pubkey_t));
+
+  memset(key, 0, sizeof(*key));
+
+  key->tag = bcrypto_secp256k1_pubkey_tag;
+  key->pubkey = pubkey;
+  key->ec = ec;
+
+  return bcrypto_secp256k1_pubkey_wrap(env, key);
+}
+
+static napi_value
+bcrypto_secp256k1_verify_parsed(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  secp256k1_ecdsa_signature sigin;
+  unsigned char msg32[32];
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  bcrypto_secp256k1_t *ec;
+  bcrypto_secp256k1_pubkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[3],
+                                       bcrypto_secp256k1_pubkey_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PUBKEY);
+
+  JS_ASSERT(key->ec == ec, JS_ERR_PUBKEY);
+
+  ok = sig_len == 64
+    && secp256k1_ecdsa_signature_parse_compact(ec->ctx, &sigin, sig);
+
+  if (ok) {
+    secp256k1_ecdsa_signature_normalize(ec->ctx, &sigin, &sigin);
+    secp256k1_ecdsa_reduce(ec->ctx, msg32, msg, msg_len);
+
+    ok = secp256k1_ecdsa_verify(ec->ctx, &sigin, msg32, &key->pubkey);
+  }
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_secp256k1_verify_der(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -11380,9 +14942,48 @@ bcrypto_secp256k1_verify_der(napi_env env, napi_callback_info info) {
     ok = secp256k1_ecdsa_verify(ec->ctx, &sigin, msg32, &pubkey);
   }
 
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static void
+bcrypto_secp256k1_verify_der_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_ecdsa_signature sigin;
+  secp256k1_pubkey pubkey;
+  unsigned char msg32[32];
+
+  w->ok = w->lens[1] > 0 && w->lens[2] > 0
+       && ecdsa_signature_parse_der_lax(ec->ctx, &sigin,
+                                        w->ptrs[1], w->lens[1])
+       && secp256k1_ec_pubkey_parse(ec->ctx, &pubkey, w->ptrs[2], w->lens[2]);
+
+  if (w->ok) {
+    secp256k1_ecdsa_signature_normalize(ec->ctx, &sigin, &sigin);
+    secp256k1_ecdsa_reduce(ec->ctx, msg32, w->ptrs[0], w->lens[0]);
+
+    w->ok = secp256k1_ecdsa_verify(ec->ctx, &sigin, msg32, &pubkey);
+  }
+}
+
+static napi_value
+bcrypto_secp256k1_verify_der_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_create(env,
+                                     bcrypto_secp256k1_verify_der_execute_,
+                                     ECC_RESULT_BOOL, argv[0], ec, &ec->workers,
+                                     &argv[1], 3);
 
-  return result;
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:secp256k1_verify_der");
 }
 
 static napi_value
@@ -11437,6 +15038,65 @@ fail:
   return result;
 }
 
+static void
+bcrypto_secp256k1_recover_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_ecdsa_recoverable_signature sigin;
+  secp256k1_pubkey pubkey;
+  unsigned char msg32[32];
+
+  if (w->lens[1] != 64)
+    return;
+
+  if (!secp256k1_ecdsa_recoverable_signature_parse_compact(ec->ctx,
+                                                           &sigin,
+                                                           w->ptrs[1],
+                                                           w->param)) {
+    return;
+  }
+
+  secp256k1_ecdsa_reduce(ec->ctx, msg32, w->ptrs[0], w->lens[0]);
+
+  if (!secp256k1_ecdsa_recover(ec->ctx, &pubkey, &sigin, msg32))
+    return;
+
+  w->out_len = 65;
+
+  secp256k1_ec_pubkey_serialize(ec->ctx, w->out, &w->out_len, &pubkey,
+    w->flag ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+
+  w->ok = 1;
+}
+
+static napi_value
+bcrypto_secp256k1_recover_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[5];
+  size_t argc = 5;
+  uint32_t parm;
+  bool compress;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+
+  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+
+  worker = bcrypto_ecc_worker_create(env, bcrypto_secp256k1_recover_execute_,
+                                     ECC_RESULT_NULLABLE, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  if (worker != NULL) {
+    worker->param = parm;
+    worker->flag = compress;
+  }
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:secp256k1_recover");
+}
+
 static napi_value
 bcrypto_secp256k1_recover_der(napi_env env, napi_callback_info info) {
   napi_value argv[5];
@@ -11496,6 +15156,73 @@ fail:
   return result;
 }
 
+static void
+bcrypto_secp256k1_recover_der_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_ecdsa_recoverable_signature sigin;
+  secp256k1_pubkey pubkey;
+  secp256k1_ecdsa_signature orig;
+  unsigned char tmp[64];
+  unsigned char msg32[32];
+
+  if (w->lens[1] == 0)
+    return;
+
+  if (!ecdsa_signature_parse_der_lax(ec->ctx, &orig, w->ptrs[1], w->lens[1]))
+    return;
+
+  secp256k1_ecdsa_signature_serialize_compact(ec->ctx, tmp, &orig);
+
+  if (!secp256k1_ecdsa_recoverable_signature_parse_compact(ec->ctx,
+                                                           &sigin,
+                                                           tmp,
+                                                           w->param)) {
+    return;
+  }
+
+  secp256k1_ecdsa_reduce(ec->ctx, msg32, w->ptrs[0], w->lens[0]);
+
+  if (!secp256k1_ecdsa_recover(ec->ctx, &pubkey, &sigin, msg32))
+    return;
+
+  w->out_len = 65;
+
+  secp256k1_ec_pubkey_serialize(ec->ctx, w->out, &w->out_len, &pubkey,
+    w->flag ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED);
+
+  w->ok = 1;
+}
+
+static napi_value
+bcrypto_secp256k1_recover_der_async(napi_env env, napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[5];
+  size_t argc = 5;
+  uint32_t parm;
+  bool compress;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+
+  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+
+  worker = bcrypto_ecc_worker_create(env,
+                                     bcrypto_secp256k1_recover_der_execute_,
+                                     ECC_RESULT_NULLABLE, argv[0], ec,
+                                     &ec->workers, &argv[1], 2);
+
+  if (worker != NULL) {
+    worker->param = parm;
+    worker->flag = compress;
+  }
+
+  return bcrypto_ecc_worker_queue(env, worker, "bcrypto:secp256k1_recover_der");
+}
+
 static int
 ecdh_hash_function_raw(unsigned char *out,
                        const unsigned char *x,
@@ -11586,6 +15313,50 @@ bcrypto_secp256k1_schnorr_legacy_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_secp256k1_schnorr_legacy_sign_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_schnorrleg sigout;
+  const uint8_t *msg = w->ptrs[0];
+
+  if (w->lens[0] == 0)
+    msg = w->out;
+
+  w->ok = secp256k1_schnorrleg_sign(ec->ctx, &sigout, msg,
+                                    w->lens[0], w->ptrs[1]);
+
+  if (w->ok) {
+    secp256k1_schnorrleg_serialize(ec->ctx, w->out, &sigout);
+    w->out_len = 64;
+  }
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_legacy_sign_async(napi_env env,
+                                            napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == 32, JS_ERR_PRIVKEY_SIZE);
+
+  worker = bcrypto_ecc_worker_create(env,
+    bcrypto_secp256k1_schnorr_legacy_sign_execute_,
+    ECC_RESULT_BUFFER, argv[0], ec, &ec->workers, &argv[1], 2);
+
+  return bcrypto_ecc_worker_queue(env, worker,
+                                  "bcrypto:secp256k1_schnorr_legacy_sign");
+}
+
 static napi_value
 bcrypto_secp256k1_schnorr_legacy_verify(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -11618,6 +15389,43 @@ bcrypto_secp256k1_schnorr_legacy_verify(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_secp256k1_schnorr_legacy_verify_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  secp256k1_schnorrleg sigin;
+  secp256k1_pubkey pubkey;
+  const uint8_t *msg = w->ptrs[0];
+
+  if (w->lens[0] == 0)
+    msg = w->ptrs[1];
+
+  w->ok = w->lens[1] == 64 && w->lens[2] > 0
+       && secp256k1_schnorrleg_parse(ec->ctx, &sigin, w->ptrs[1])
+       && secp256k1_ec_pubkey_parse(ec->ctx, &pubkey, w->ptrs[2], w->lens[2])
+       && secp256k1_schnorrleg_verify(ec->ctx, &sigin, msg,
+                                      w->lens[0], &pubkey);
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_legacy_verify_async(napi_env env,
+                                              napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[4];
+  size_t argc = 4;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_create(env,
+    bcrypto_secp256k1_schnorr_legacy_verify_execute_,
+    ECC_RESULT_BOOL, argv[0], ec, &ec->workers, &argv[1], 3);
+
+  return bcrypto_ecc_worker_queue(env, worker,
+                                  "bcrypto:secp256k1_schnorr_legacy_verify");
+}
+
 static napi_value
 bcrypto_secp256k1_schnorr_legacy_verify_batch(napi_env env,
                                               napi_callback_info info) {
@@ -11727,6 +15535,158 @@ fail:
   return result;
 }
 
+static int
+bcrypto_secp256k1_schnorr_legacy_range_(bcrypto_ecc_worker_t *w,
+                                        void *arg,
+                                        size_t start,
+                                        size_t count) {
+  bcrypto_secp256k1_batch_t *b = arg;
+  bcrypto_secp256k1_t *ec = w->ec;
+  size_t i;
+
+  /* Unparseable items are left as NULL. */
+  for (i = start; i < start + count; i++) {
+    if (b->sigs[i] == NULL || b->pubs[i] == NULL)
+      return 0;
+  }
+
+  if (count == 0)
+    return 1;
+
+  return secp256k1_schnorrleg_verify_batch(ec->ctx,
+                                           b->scratch,
+                                           &b->sigs[start],
+                                           &w->ptrs[start],
+                                           &w->lens[start],
+                                           &b->pubs[start],
+                                           count);
+}
+
+static void
+bcrypto_secp256k1_schnorr_legacy_batch_execute_(bcrypto_ecc_worker_t *w) {
+  bcrypto_secp256k1_t *ec = w->ec;
+  size_t i, length = w->length;
+  const uint8_t **msgs = &w->ptrs[length * 0];
+  const uint8_t **sigs = &w->ptrs[length * 1];
+  const uint8_t **pubs = &w->ptrs[length * 2];
+  const size_t *msg_lens = &w->lens[length * 0];
+  const size_t *sig_lens = &w->lens[length * 1];
+  const size_t *pub_lens = &w->lens[length * 2];
+  bcrypto_secp256k1_batch_t b;
+
+  if (length == 0) {
+    w->ok = 1;
+    return;
+  }
+
+  b.scratch = NULL;
+  b.sigs = bcrypto_malloc(length * sizeof(secp256k1_schnorrleg *));
+  b.sig_data = bcrypto_malloc(length * sizeof(secp256k1_schnorrleg));
+  b.pubs = bcrypto_malloc(length * sizeof(secp256k1_pubkey *));
+  b.pub_data = bcrypto_malloc(length * sizeof(secp256k1_pubkey));
+
+  if (b.sigs == NULL || b.sig_data == NULL
+      || b.pubs == NULL || b.pub_data == NULL) {
+    w->error = JS_ERR_ALLOC;
+    goto done;
+  }
+
+  for (i = 0; i < length; i++) {
+    b.sigs[i] = NULL;
+    b.pubs[i] = NULL;
+
+    if (msg_lens[i] == 0)
+      msgs[i] = sigs[i];
+
+    if (sig_lens[i] != 64 || pub_lens[i] == 0)
+      continue;
+
+    if (!secp256k1_schnorrleg_parse(ec->ctx, &b.sig_data[i], sigs[i]))
+      continue;
+
+    if (!secp256k1_ec_pubkey_parse(ec->ctx, &b.pub_data[i],
+                                   pubs[i], pub_lens[i])) {
+      continue;
+    }
+
+    b.sigs[i] = &b.sig_data[i];
+    b.pubs[i] = &b.pub_data[i];
+  }
+
+  b.scratch = secp256k1_scratch_space_create(ec->ctx, 1024 * 1024);
+
+  CHECK(b.scratch != NULL);
+
+  bcrypto_ecc_verify_batch(w, bcrypto_secp256k1_schnorr_legacy_range_, &b);
+
+  secp256k1_scratch_space_destroy(ec->ctx, b.scratch);
+
+done:
+  bcrypto_free((void *)b.sigs);
+  bcrypto_free(b.sig_data);
+  bcrypto_free((void *)b.pubs);
+  bcrypto_free(b.pub_data);
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_legacy_verify_batch_async(napi_env env,
+                                                    napi_callback_info info) {
+  bcrypto_ecc_worker_t *worker;
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  worker = bcrypto_ecc_worker_batch(env,
+    bcrypto_secp256k1_schnorr_legacy_batch_execute_,
+    argv[0], ec, &ec->workers, argv[1], NULL);
+
+  return bcrypto_ecc_worker_queue(env, worker,
+    "bcrypto:secp256k1_schnorr_legacy_verify_batch");
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_legacy_verify_batch_parallel(
+  napi_env env,
+  napi_callback_info info
+) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint32_t jobs;
+  bool find;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &jobs) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[3], &find) == napi_ok);
+
+  return bcrypto_ecc_verify_parallel(env,
+    bcrypto_secp256k1_schnorr_legacy_batch_execute_,
+    argv[0], ec, &ec->workers, argv[1], NULL, 0, jobs, find,
+    "bcrypto:secp256k1_schnorr_legacy_verify_batch");
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_legacy_verify_batch_find(napi_env env,
+                                                   napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_secp256k1_t *ec;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  return bcrypto_ecc_verify_find(env,
+    bcrypto_secp256k1_schnorr_legacy_batch_execute_,
+    argv[0], ec, &ec->workers, argv[1], NULL, 0);
+}
+
 #ifdef BCRYPTO_USE_SECP256K1_LATEST
 static napi_value
 bcrypto_secp256k1_xonly_seckey_export(napi_env env, napi_callback_info info) {
@@ -12324,6 +16284,70 @@ bcrypto_secp256k1_schnorr_verify(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_secp256k1_schnorr_pubkey_parse(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *pub;
+  size_t pub_len;
+  secp256k1_xonly_pubkey pubkey;
+  bcrypto_secp256k1_t *ec;
+  bcrypto_secp256k1_pubkey_t *key;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+
+  JS_ASSERT(pub_len == 32, JS_ERR_PUBKEY_SIZE);
+  JS_ASSERT(secp256k1_xonly_pubkey_parse(ec->ctx, &pubkey, pub),
+            JS_ERR_PUBKEY);
+
+  key = bcrypto_xmalloc(sizeof(bcrypto_secp256k1_pubkey_t));
+
+  memset(key, 0, sizeof(*key));
+
+  key->tag = bcrypto_secp256k1_xonly_tag;
+  key->xonly = pubkey;
+  key->ec = ec;
+
+  return bcrypto_secp256k1_pubkey_wrap(env, key);
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_verify_parsed(napi_env env,
+                                        napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  secp256k1_schnorrsig sigin;
+  bcrypto_secp256k1_t *ec;
+  bcrypto_secp256k1_pubkey_t *key;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  JS_ASSERT(read_value_external_tagged(env, argv[3],
+                                       bcrypto_secp256k1_xonly_tag,
+                                       (void **)&key) == napi_ok,
+            JS_ERR_PUBKEY);
+
+  JS_ASSERT(key->ec == ec, JS_ERR_PUBKEY);
+
+  ok = msg_len == 32 && sig_len == 64
+    && secp256k1_schnorrsig_parse(ec->ctx, &sigin, sig)
+    && secp256k1_schnorrsig_verify(ec->ctx, &sigin, msg, &key->xonly);
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_secp256k1_schnorr_verify_batch(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -12725,8 +16749,10 @@ bcrypto_wei_curve_create(napi_env env, napi_callback_info info) {
   JS_ASSERT(ctx = wei_curve_create(type), JS_ERR_CONTEXT);
 
   ec = bcrypto_xmalloc(sizeof(bcrypto_wei_curve_t));
+  ec->workers = 0;
   ec->ctx = ctx;
   ec->scratch = NULL;
+  ec->scratch_size = 0;
   ec->scalar_size = wei_curve_scalar_size(ec->ctx);
   ec->scalar_bits = wei_curve_scalar_bits(ec->ctx);
   ec->field_size = wei_curve_field_size(ec->ctx);
@@ -12789,6 +16815,7 @@ bcrypto_wei_curve_randomize(napi_env env, napi_callback_info info) {
                              &entropy_len) == napi_ok);
 
   JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+  JS_ASSERT(ec->workers == 0, JS_ERR_STATE);
 
   wei_curve_randomize(ec->ctx, entropy);
 
@@ -12797,6 +16824,24 @@ bcrypto_wei_curve_randomize(napi_env env, napi_callback_info info) {
   return argv[0];
 }
 
+static napi_value
+bcrypto_wei_curve_precompute(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_wei_curve_t *ec;
+  uint32_t width;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[1], &width) == napi_ok);
+
+  JS_ASSERT(ec->workers == 0, JS_ERR_STATE);
+  JS_ASSERT(wei_curve_precompute(ec->ctx, width), JS_ERR_ARG);
+
+  return argv[0];
+}
+
 /*
  * Module
  */
@@ -12858,6 +16903,7 @@ NAPI_MODULE_INIT() {
 
     /* Base58 */
     F(base58_encode),
+    F(base58_encode_batch),
     F(base58_decode),
     F(base58_test),
 
@@ -12876,6 +16922,7 @@ NAPI_MODULE_INIT() {
     F(bcrypt_hash256),
     F(bcrypt_pbkdf),
     F(bcrypt_pbkdf_async),
+    F(bcrypt_pbkdf_batch),
     F(bcrypt_derive),
     F(bcrypt_generate),
     F(bcrypt_generate_with_salt64),
@@ -13028,13 +17075,21 @@ NAPI_MODULE_INIT() {
     F(ecdsa_is_low_s),
     F(ecdsa_is_low_der),
     F(ecdsa_sign),
+    F(ecdsa_sign_async),
     F(ecdsa_sign_recoverable),
     F(ecdsa_sign_der),
+    F(ecdsa_sign_der_async),
     F(ecdsa_sign_recoverable_der),
     F(ecdsa_verify),
+    F(ecdsa_verify_async),
+    F(ecdsa_pubkey_parse),
+    F(ecdsa_verify_parsed),
     F(ecdsa_verify_der),
+    F(ecdsa_verify_der_async),
     F(ecdsa_recover),
+    F(ecdsa_recover_async),
     F(ecdsa_recover_der),
+    F(ecdsa_recover_der_async),
     F(ecdsa_derive),
 
     /* EdDSA */
@@ -13070,14 +17125,22 @@ NAPI_MODULE_INIT() {
     F(eddsa_pubkey_tweak_add),
     F(eddsa_pubkey_tweak_mul),
     F(eddsa_pubkey_combine),
+    F(eddsa_pubkey_mul_multi),
     F(eddsa_pubkey_negate),
     F(eddsa_sign),
+    F(eddsa_sign_async),
     F(eddsa_sign_with_scalar),
     F(eddsa_sign_tweak_add),
     F(eddsa_sign_tweak_mul),
     F(eddsa_verify),
+    F(eddsa_verify_async),
+    F(eddsa_pubkey_parse),
+    F(eddsa_verify_parsed),
     F(eddsa_verify_single),
     F(eddsa_verify_batch),
+    F(eddsa_verify_batch_async),
+    F(eddsa_verify_batch_parallel),
+    F(eddsa_verify_batch_find),
     F(eddsa_derive),
     F(eddsa_derive_with_scalar),
 
@@ -13086,6 +17149,7 @@ NAPI_MODULE_INIT() {
     F(edwards_curve_field_size),
     F(edwards_curve_field_bits),
     F(edwards_curve_randomize),
+    F(edwards_curve_precompute),
 
     /* Hash */
     F(hash_create),
@@ -13095,6 +17159,12 @@ NAPI_MODULE_INIT() {
     F(hash_digest),
     F(hash_root),
     F(hash_multi),
+    F(hash_digest_batch),
+
+    /* Merkle */
+    F(merkle_root),
+    F(merkle_tree),
+    F(merkle_branch),
 
     /* Hash-DRBG */
     F(hash_drbg_create),
@@ -13140,6 +17210,7 @@ NAPI_MODULE_INIT() {
     /* PBKDF2 */
     F(pbkdf2_derive),
     F(pbkdf2_derive_async),
+    F(pbkdf2_derive_batch),
 
     /* PGPDF */
     F(pgpdf_derive_simple),
@@ -13182,6 +17253,11 @@ NAPI_MODULE_INIT() {
     F(rsa_decrypt_oaep),
     F(rsa_veil),
     F(rsa_unveil),
+    F(rsa_privkey_parse),
+    F(rsa_sign_parsed),
+    F(rsa_decrypt_parsed),
+    F(rsa_sign_pss_parsed),
+    F(rsa_decrypt_oaep_parsed),
 
     /* Salsa20 */
     F(salsa20_create),
@@ -13213,18 +17289,31 @@ NAPI_MODULE_INIT() {
     F(schnorr_pubkey_tweak_test),
     F(schnorr_pubkey_combine),
     F(schnorr_sign),
+    F(schnorr_sign_async),
     F(schnorr_verify),
+    F(schnorr_verify_async),
+    F(schnorr_pubkey_parse),
+    F(schnorr_verify_parsed),
     F(schnorr_verify_batch),
+    F(schnorr_verify_batch_async),
+    F(schnorr_verify_batch_parallel),
+    F(schnorr_verify_batch_find),
     F(schnorr_derive),
 
     /* Schnorr Legacy */
     F(schnorr_legacy_sign),
+    F(schnorr_legacy_sign_async),
     F(schnorr_legacy_verify),
+    F(schnorr_legacy_verify_async),
     F(schnorr_legacy_verify_batch),
+    F(schnorr_legacy_verify_batch_async),
+    F(schnorr_legacy_verify_batch_parallel),
+    F(schnorr_legacy_verify_batch_find),
 
     /* Scrypt */
     F(scrypt_derive),
     F(scrypt_derive_async),
+    F(scrypt_derive_batch),
 
 #ifdef BCRYPTO_USE_SECP256K1
     /* Secp256k1 */
@@ -13259,17 +17348,30 @@ NAPI_MODULE_INIT() {
     F(secp256k1_is_low_s),
     F(secp256k1_is_low_der),
     F(secp256k1_sign),
+    F(secp256k1_sign_async),
     F(secp256k1_sign_recoverable),
     F(secp256k1_sign_der),
+    F(secp256k1_sign_der_async),
     F(secp256k1_sign_recoverable_der),
     F(secp256k1_verify),
+    F(secp256k1_verify_async),
+    F(secp256k1_pubkey_parse),
+    F(secp256k1_verify_parsed),
     F(secp256k1_verify_der),
+    F(secp256k1_verify_der_async),
     F(secp256k1_recover),
+    F(secp256k1_recover_async),
     F(secp256k1_recover_der),
+    F(secp256k1_recover_der_async),
     F(secp256k1_derive),
     F(secp256k1_schnorr_legacy_sign),
+    F(secp256k1_schnorr_legacy_sign_async),
     F(secp256k1_schnorr_legacy_verify),
+    F(secp256k1_schnorr_legacy_verify_async),
     F(secp256k1_schnorr_legacy_verify_batch),
+    F(secp256k1_schnorr_legacy_verify_batch_async),
+    F(secp256k1_schnorr_legacy_verify_batch_parallel),
+    F(secp256k1_schnorr_legacy_verify_batch_find),
 #ifdef BCRYPTO_USE_SECP256K1_LATEST
     F(secp256k1_xonly_seckey_export),
     F(secp256k1_xonly_seckey_tweak_add),
@@ -13288,6 +17390,8 @@ NAPI_MODULE_INIT() {
     F(secp256k1_xonly_combine),
     F(secp256k1_schnorr_sign),
     F(secp256k1_schnorr_verify),
+    F(secp256k1_schnorr_pubkey_parse),
+    F(secp256k1_schnorr_verify_parsed),
     F(secp256k1_schnorr_verify_batch),
     F(secp256k1_xonly_derive),
 #endif
@@ -13308,7 +17412,8 @@ NAPI_MODULE_INIT() {
     F(wei_curve_create),
     F(wei_curve_field_size),
     F(wei_curve_field_bits),
-    F(wei_curve_randomize)
+    F(wei_curve_randomize),
+    F(wei_curve_precompute)
 #undef F
   };
 
@@ -80,4 +80,17 @@ describe('Base16', function() {
       assert.bufferEqual(dec, data);
     }
   });
+
+  it('should reject invalid characters in long strings', () => {
+    const str = base16.encode(rng.randomBytes(300));
+
+    for (let i = 0; i < str.length; i += 7) {
+      for (const ch of ['g', 'G', '/', ':', '@', '`', '\x80', '\xc1']) {
+        const hex = str.slice(0, i) + ch + str.slice(i + 1);
+
+        assert.strictEqual(base16.test(hex), false);
+        assert.throws(() => base16.decode(hex));
+      }
+    }
+  });
 });
@@ -38,4 +38,46 @@ describe('Base58', function() {
       assert.bufferEqual(base58.decode(b58), data);
     });
   }
+
+  it('should encode base58 in batch', () => {
+    const items = vectors.map(([hex]) => Buffer.from(hex, 'hex'));
+    const expect = vectors.map(([, b58]) => b58);
+
+    assert.deepStrictEqual(base58.encodeBatch(items), expect);
+    assert.deepStrictEqual(base58.encodeBatch([]), []);
+  });
+
+  it('should read batch items once', () => {
+    const small = Buffer.from([0x61]);
+    const large = Buffer.alloc(1 << 20, 0xff);
+    const items = [];
+
+    let reads = 0;
+
+    Object.defineProperty(items, 0, {
+      enumerable: true,
+      get: () => (reads++ < 2 ? small : large)
+    });
+
+    assert.deepStrictEqual(base58.encodeBatch(items), ['2g']);
+  });
+
+  it('should encode/decode long payloads', () => {
+    for (let size = 0; size < 600; size += 37) {
+      for (let zeroes = 0; zeroes < 3; zeroes++) {
+        const data = Buffer.alloc(zeroes + size);
+
+        for (let i = zeroes; i < data.length; i++)
+          data[i] = (i * 131 + size) & 0xff;
+
+        if (size > 0)
+          data[zeroes] |= 1;
+
+        const str = base58.encode(data);
+
+        assert.strictEqual(str.slice(0, zeroes), '1'.repeat(zeroes));
+        assert.bufferEqual(base58.decode(str), data);
+      }
+    }
+  });
 });
@@ -103,4 +103,17 @@ describe('Base64', function() {
       assert.bufferEqual(dec2, data);
     }
   });
+
+  it('should reject invalid characters in long strings', () => {
+    const str = base64.encode(rng.randomBytes(300));
+
+    for (let i = 0; i < str.length; i += 7) {
+      for (const ch of ['-', '_', '.', ':', '@', '[', '\x80', '\xaf']) {
+        const b64 = str.slice(0, i) + ch + str.slice(i + 1);
+
+        assert.strictEqual(base64.test(b64), false);
+        assert.throws(() => base64.decode(b64));
+      }
+    }
+  });
 });
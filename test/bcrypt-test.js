@@ -117,5 +117,23 @@ describe('Bcrypt', function() {
         assert.bufferEqual(key, expect);
       });
     }
+
+    it('should derive keys in batch (pbkdf)', async () => {
+      const items = pbkdf.map(([pass, salt]) => {
+        return [Buffer.from(pass, 'binary'), Buffer.from(salt, 'hex')];
+      });
+
+      const expect = Buffer.concat(items.map(([pass, salt]) => {
+        return bcrypt.pbkdf(pass, salt, 8, 40);
+      }));
+
+      for (const jobs of [1, 2, 3, 16]) {
+        const keys = await bcrypt.pbkdfBatchAsync(items, 8, 40, jobs);
+        assert.bufferEqual(keys, expect);
+      }
+
+      assert.bufferEqual(await bcrypt.pbkdfBatchAsync([], 8, 40, 2),
+                         Buffer.alloc(0));
+    });
   });
 });
@@ -5,6 +5,7 @@ const fs = require('fs');
 const Path = require('path');
 const bio = require('bufio');
 const dsa = require('../lib/dsa');
+const SHA256 = require('../lib/sha256');
 const asn1 = require('../lib/encoding/asn1');
 const x509 = require('../lib/encoding/x509');
 const params = require('./data/dsa-params.json');
@@ -115,6 +116,23 @@ describe('DSA', function() {
     assert.strictEqual(dsa.verify(msg, sig, pub), false);
   });
 
+  it('should generate params in parallel (async)', async () => {
+    const params = await dsa.paramsGenerateAsync(1024, 3);
+    const priv = dsa.privateKeyCreate(params);
+
+    assert.strictEqual(dsa.paramsVerify(params), true);
+    assert.strictEqual(dsa.paramsBits(params), 1024);
+    assert.strictEqual(dsa.paramsScalarBits(params), 160);
+    assert.strictEqual(dsa.privateKeyVerify(priv), true);
+  });
+
+  it('should cancel losing searches (async)', async () => {
+    const params = await dsa.paramsGenerateAsync(1024, 64);
+
+    assert.strictEqual(dsa.paramsVerify(params), true);
+    assert.strictEqual(dsa.paramsBits(params), 1024);
+  });
+
   it('should do diffie hellman', () => {
     const params = createParams(P1024_160);
     const alice = dsa.privateKeyCreate(params);
@@ -9,6 +9,7 @@ const p256 = require('../lib/p256');
 const p384 = require('../lib/p384');
 const p521 = require('../lib/p521');
 const secp256k1 = require('../lib/secp256k1');
+const ed25519 = require('../lib/ed25519');
 const SHA224 = require('../lib/sha224');
 const SHA256 = require('../lib/sha256');
 const SHA384 = require('../lib/sha384');
@@ -74,6 +75,108 @@ describe('ECDSA', function() {
         }
       });
 
+      it(`should sign with a wider comb (${ec.id})`, () => {
+        const msg = rng.randomBytes(ec.size);
+        const priv = ec.privateKeyGenerate();
+        const pub = ec.publicKeyCreate(priv);
+        const sig = ec.sign(msg, priv);
+
+        try {
+          for (const width of [5, 6, 7, 8]) {
+            ec.precompute(width);
+
+            assert.bufferEqual(ec.publicKeyCreate(priv), pub);
+            assert.bufferEqual(ec.sign(msg, priv), sig);
+          }
+        } finally {
+          ec.precompute(0);
+        }
+
+        assert.bufferEqual(ec.sign(msg, priv), sig);
+      });
+
+      // libsecp256k1 keeps its own tables.
+      if (ec.native === 2 && ec.id !== 'SECP256K1') {
+        it(`should refuse to precompute while busy (${ec.id})`, async () => {
+          const msg = rng.randomBytes(ec.size);
+          const priv = ec.privateKeyGenerate();
+          const sig = ec.sign(msg, priv);
+          const job = ec.signAsync(msg, priv);
+
+          assert.throws(() => ec.precompute(8), /Invalid state/);
+
+          assert.bufferEqual(await job, sig);
+
+          try {
+            ec.precompute(8);
+            assert.bufferEqual(ec.sign(msg, priv), sig);
+          } finally {
+            ec.precompute(0);
+          }
+        });
+      }
+
+      it(`should sign, verify and recover (async) (${ec.id})`, async () => {
+        const msg = rng.randomBytes(ec.size);
+        const priv = ec.privateKeyGenerate();
+        const pub = ec.publicKeyCreate(priv);
+        const [sig, param] = ec.signRecoverable(msg, priv);
+        const der = ec.signatureExport(sig);
+
+        assert.bufferEqual(await ec.signAsync(msg, priv), sig);
+        assert.bufferEqual(await ec.signDERAsync(msg, priv), der);
+
+        assert.strictEqual(await ec.verifyAsync(msg, sig, pub), true);
+        assert.strictEqual(await ec.verifyDERAsync(msg, der, pub), true);
+
+        assert.bufferEqual(await ec.recoverAsync(msg, sig, param), pub);
+        assert.bufferEqual(await ec.recoverDERAsync(msg, der, param), pub);
+
+        msg[0] ^= 1;
+
+        assert.strictEqual(await ec.verifyAsync(msg, sig, pub), false);
+        assert.strictEqual(await ec.verifyDERAsync(msg, der, pub), false);
+
+        await assert.rejects(ec.signAsync(msg, Buffer.alloc(1)));
+      });
+
+      it(`should verify with a parsed key (${ec.id})`, () => {
+        const priv = ec.privateKeyGenerate();
+        const pub = ec.publicKeyCreate(priv);
+        const pubu = ec.publicKeyConvert(pub, false);
+        const key = ec.publicKeyParse(pub);
+        const keyu = ec.publicKeyParse(pubu);
+
+        for (let i = 0; i < 16; i++) {
+          const msg = rng.randomBytes(ec.size);
+          const sig = ec.sign(msg, priv);
+
+          assert.strictEqual(ec.verifyParsed(msg, sig, key), true);
+          assert.strictEqual(ec.verifyParsed(msg, sig, keyu), true);
+
+          sig[i] ^= 1;
+
+          assert.strictEqual(ec.verifyParsed(msg, sig, key), false);
+
+          sig[i] ^= 1;
+          msg[i] ^= 1;
+
+          assert.strictEqual(ec.verifyParsed(msg, sig, key), false);
+        }
+
+        assert.throws(() => ec.publicKeyParse(Buffer.alloc(pub.length)));
+
+        if (ec.native === 2) {
+          const msg = rng.randomBytes(ec.size);
+          const sig = ec.sign(msg, priv);
+          const edpub = ed25519.publicKeyCreate(ed25519.privateKeyGenerate());
+          const other = ed25519.publicKeyParse(edpub);
+
+          assert.throws(() => ec.verifyParsed(msg, sig, other),
+                        /Invalid public key/);
+        }
+      });
+
       it(`should generate keypair and sign RS (${ec.id})`, () => {
         const msg = rng.randomBytes(ec.size);
         const priv = ec.privateKeyGenerate();
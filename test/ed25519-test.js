@@ -35,6 +35,63 @@ describe('Ed25519', function() {
       secret);
   });
 
+  it('should sign and verify (async)', async () => {
+    const batch = [];
+
+    for (let i = 0; i < 4; i++) {
+      const msg = random.randomBytes(i * 16);
+      const secret = ed25519.privateKeyGenerate();
+      const pub = ed25519.publicKeyCreate(secret);
+      const sig = await ed25519.signAsync(msg, secret);
+
+      assert.bufferEqual(sig, ed25519.sign(msg, secret));
+      assert.strictEqual(await ed25519.verifyAsync(msg, sig, pub), true);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    assert.strictEqual(await ed25519.verifyBatchAsync([]), true);
+    assert.strictEqual(await ed25519.verifyBatchAsync(batch), true);
+
+    batch[2][1][0] ^= 1;
+
+    assert.strictEqual(await ed25519.verifyAsync(...batch[2]), false);
+    assert.strictEqual(await ed25519.verifyBatchAsync(batch), false);
+  });
+
+  it('should do parallel batch verification', async () => {
+    const batch = [];
+
+    for (let i = 0; i < 16; i++) {
+      const msg = random.randomBytes(32);
+      const secret = ed25519.privateKeyGenerate();
+      const pub = ed25519.publicKeyCreate(secret);
+      const sig = ed25519.sign(msg, secret);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    for (const jobs of [1, 3, 4]) {
+      const ok = await ed25519.verifyBatchAsync(batch, null, null, jobs);
+
+      assert.strictEqual(ok, true);
+    }
+
+    batch[3][0] = random.randomBytes(32);
+    batch[12][2] = Buffer.alloc(1);
+
+    for (const jobs of [1, 3, 4]) {
+      const ok = await ed25519.verifyBatchAsync(batch, null, null, jobs);
+      const bad = await ed25519.findInvalidAsync(batch, null, null, jobs);
+
+      assert.strictEqual(ok, false);
+      assert.deepStrictEqual(bad, [3, 12]);
+    }
+
+    assert.deepStrictEqual(ed25519.findInvalid(batch), [3, 12]);
+    assert.deepStrictEqual(ed25519.findInvalid(batch.slice(4, 12)), []);
+  });
+
   it('should allow points at infinity', () => {
     // Fun fact about edwards curves: points
     // at infinity can actually be serialized.
@@ -816,6 +873,32 @@ describe('Ed25519', function() {
     assert(ed25519.verify(msg, sig, child));
   });
 
+  it('should do multi-scalar multiplication', () => {
+    const keys = [];
+    const tweaks = [];
+
+    for (let i = 0; i < 150; i++) {
+      keys.push(ed25519.publicKeyCreate(ed25519.privateKeyGenerate()));
+      tweaks.push(ed25519.scalarGenerate());
+    }
+
+    for (const n of [0, 1, 5, 150]) {
+      const points = [];
+
+      for (let i = 0; i < n; i++)
+        points.push(ed25519.publicKeyTweakMul(keys[i], tweaks[i]));
+
+      const expect = ed25519.publicKeyCombine(points);
+      const result = ed25519.publicKeyMulMulti(keys.slice(0, n),
+                                               tweaks.slice(0, n));
+
+      assert.bufferEqual(result, expect);
+    }
+
+    assert.throws(() => ed25519.publicKeyMulMulti([Buffer.alloc(32, 0xff)],
+                                                  [tweaks[0]]));
+  });
+
   it('should modulo scalar', () => {
     const scalar0 = Buffer.alloc(0);
     const mod0 = ed25519.scalarReduce(scalar0);
@@ -6,6 +6,7 @@ const ed25519 = require('../lib/ed25519');
 const x25519 = require('../lib/x25519');
 const ed448 = require('../lib/ed448');
 const x448 = require('../lib/x448');
+const p256 = require('../lib/p256');
 
 const curves = [
   [ed25519, x25519],
@@ -123,23 +124,27 @@ describe('EdDSA', function() {
         it(`should sign and verify (${i}) (${curve.id})`, () => {
           const sig2 = curve.sign(msg, priv, ph);
           const sig3 = curve.signWithScalar(msg, scalar, prefix, ph);
+          const key = curve.publicKeyParse(pub);
 
           assert.bufferEqual(sig2, sig);
           assert.bufferEqual(sig3, sig);
 
           assert(curve.verify(msg, sig, pub, ph));
           assert(curve.verifySingle(msg, sig, pub, ph));
+          assert(curve.verifyParsed(msg, sig, key, ph));
 
           msg[0] ^= 1;
 
           assert(!curve.verify(msg, sig, pub, ph));
           assert(!curve.verifySingle(msg, sig, pub, ph));
+          assert(!curve.verifyParsed(msg, sig, key, ph));
 
           msg[0] ^= 1;
           sig[0] ^= 1;
 
           assert(!curve.verify(msg, sig, pub, ph));
           assert(!curve.verifySingle(msg, sig, pub, ph));
+          assert(!curve.verifyParsed(msg, sig, key, ph));
 
           sig[0] ^= 1;
           pub[0] ^= 1;
@@ -227,6 +232,42 @@ describe('EdDSA', function() {
         });
       }
 
+      if (curve.native === 2) {
+        it(`should refuse foreign parsed keys (${curve.id})`, () => {
+          const msg = Buffer.alloc(32, 0xaa);
+          const priv = curve.privateKeyGenerate();
+          const sig = curve.sign(msg, priv);
+          const pub = p256.publicKeyCreate(p256.privateKeyGenerate());
+          const other = p256.publicKeyParse(pub);
+
+          assert.throws(() => curve.verifyParsed(msg, sig, other),
+                        /Invalid public key/);
+        });
+      }
+
+      it(`should sign with a wider comb (${curve.id})`, () => {
+        const msg = Buffer.alloc(32, 0xaa);
+        const priv = curve.privateKeyGenerate();
+        const pub = curve.publicKeyCreate(priv);
+        const sig = curve.sign(msg, priv);
+
+        try {
+          for (const width of [5, 6, 7, 8]) {
+            curve.precompute(width);
+
+            assert.bufferEqual(curve.publicKeyCreate(priv), pub);
+            assert.bufferEqual(curve.sign(msg, priv), sig);
+          }
+
+          if (curve.native === 2)
+            assert.throws(() => curve.precompute(9));
+        } finally {
+          curve.precompute(0);
+        }
+
+        assert.bufferEqual(curve.sign(msg, priv), sig);
+      });
+
       it(`should batch verify (${curve.id})`, () => {
         const [msg] = batch[0];
 
@@ -163,6 +163,32 @@ describe('Hash', function() {
           });
         }
       }
+
+      if (hash.digestBatch) {
+        it(`should compute ${hash.id} digests in batch`, () => {
+          const items = [];
+          const expect = [];
+
+          for (const [msg_, arg_, key_, expect_] of vectors) {
+            if (arg_ != null || key_ != null)
+              continue;
+
+            items.push(Buffer.from(msg_, 'hex'));
+            expect.push(Buffer.from(expect_, 'hex'));
+          }
+
+          // Mixed sizes to exercise lane refills.
+          for (let i = 0; i < 37; i++) {
+            const msg = rng.randomBytes((i * 97) % 300);
+
+            items.push(msg);
+            expect.push(hash.digest(msg));
+          }
+
+          assert.bufferEqual(hash.digestBatch(items), Buffer.concat(expect));
+          assert.bufferEqual(hash.digestBatch([]), Buffer.alloc(0));
+        });
+      }
     });
   }
 });
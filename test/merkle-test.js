@@ -2,6 +2,7 @@
 
 const assert = require('bsert');
 const SHA256 = require('../lib/sha256');
+const Hash256 = require('../lib/hash256');
 const merkle = require('../lib/merkle');
 
 describe('Merkle', function() {
@@ -249,4 +250,46 @@ describe('Merkle', function() {
     for (let i = 5; i < 9; i++)
       assert.notBufferEqual(merkle.deriveRoot(SHA256, leaves[4], branch, i), root);
   });
+
+  for (const alg of [SHA256, Hash256]) {
+    it(`should match generic construction (${alg.id})`, () => {
+      const generic = {
+        size: alg.size,
+        zero: alg.zero,
+        root: alg.root
+      };
+
+      for (let size = 0; size < 40; size++) {
+        const leaves = [];
+
+        for (let i = 0; i < size; i++)
+          leaves.push(Buffer.alloc(32, i));
+
+        if (size > 2 && (size & 1))
+          leaves.push(leaves[size - 1]);
+
+        const [tree1, mal1] = merkle.createTree(alg, leaves);
+        const [tree2, mal2] = merkle.createTree(generic, leaves);
+        const [root, mal3] = merkle.createRoot(alg, leaves);
+
+        assert.deepStrictEqual(tree1, tree2);
+        assert.strictEqual(mal1, mal2);
+        assert.strictEqual(mal3, mal2);
+        assert.strictEqual(mal1, size > 2 && (size & 1) === 1);
+        assert.bufferEqual(root, tree2[tree2.length - 1]);
+
+        for (let i = 0; i < leaves.length; i++) {
+          const branch1 = merkle.createBranch(alg, i, leaves);
+          const branch2 = merkle.createBranch(generic, i, leaves);
+
+          assert.deepStrictEqual(branch1, branch2);
+
+          if (!mal2) {
+            assert.bufferEqual(merkle.deriveRoot(alg, leaves[i], branch1, i),
+                               root);
+          }
+        }
+      }
+    });
+  }
 });
@@ -2,7 +2,9 @@
 
 const assert = require('bsert');
 const SHA1 = require('../lib/sha1');
+const SHA224 = require('../lib/sha224');
 const SHA256 = require('../lib/sha256');
+const SHA384 = require('../lib/sha384');
 const SHA512 = require('../lib/sha512');
 const SHA3_256 = require('../lib/sha3-256');
 const BLAKE2s256 = require('../lib/blake2s256');
@@ -58,4 +60,65 @@ describe('PBKDF2', function() {
       assert.bufferEqual(key, expect);
     });
   }
+
+  for (const hash of [SHA224, SHA256, SHA384, SHA512]) {
+    it(`should compute long ${hash.id} pbkdf2 outputs`, () => {
+      const passwd = Buffer.from('password');
+      const salt = Buffer.from('salt');
+      const iter = 3;
+
+      // More output blocks than are computed side by side.
+      for (const len of [1, hash.size, hash.size * 3 + 5, hash.size * 19]) {
+        const expect = Buffer.alloc(len);
+
+        for (let i = 0; i * hash.size < len; i++) {
+          const ctr = Buffer.alloc(4);
+
+          ctr.writeUInt32BE(i + 1, 0);
+
+          let u = hash.mac(Buffer.concat([salt, ctr]), passwd);
+
+          const block = Buffer.from(u);
+
+          for (let j = 1; j < iter; j++) {
+            u = hash.mac(u, passwd);
+
+            for (let k = 0; k < u.length; k++)
+              block[k] ^= u[k];
+          }
+
+          block.copy(expect, i * hash.size);
+        }
+
+        const key = pbkdf2.derive(hash, passwd, salt, iter, len);
+
+        assert.bufferEqual(key, expect);
+      }
+    });
+  }
+
+  for (const hash of [SHA1, SHA256, SHA512]) {
+    it(`should compute ${hash.id} pbkdf2 in batch`, async () => {
+      const items = [];
+
+      for (let i = 0; i < 21; i++) {
+        const pass = Buffer.alloc(i * 7, i);
+        const salt = i & 1 ? Buffer.alloc(i, 0xaa) : null;
+
+        items.push([pass, salt]);
+      }
+
+      for (const len of [20, 65]) {
+        const expect = Buffer.concat(items.map(([pass, salt]) => {
+          return pbkdf2.derive(hash, pass, salt, 5, len);
+        }));
+
+        for (const jobs of [1, 4]) {
+          const keys = await pbkdf2.deriveBatchAsync(hash, items, 5, len, jobs);
+
+          assert.bufferEqual(keys, expect);
+        }
+      }
+    });
+  }
 });
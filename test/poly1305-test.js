@@ -57,6 +57,24 @@ describe('Poly1305', function() {
     const tag = Buffer.from(tag_, 'hex');
     const text = key_.slice(0, 32) + '...';
 
+    it(`should perform poly1305 (${text})`, () => {
+      // Single large updates (256 bytes or more) take
+      // the vectorized path where it is available.
+      const poly = new Poly1305();
+
+      poly.init(key);
+      poly.update(msg);
+
+      assert.bufferEqual(poly.final(), tag);
+
+      // Same again, with the bulk starting mid-block.
+      poly.init(key);
+      poly.update(msg.slice(0, 5));
+      poly.update(msg.slice(5));
+
+      assert.bufferEqual(poly.final(), tag);
+    });
+
     it(`should perform incremental poly1305 (${text})`, () => {
       const poly = new Poly1305();
 
@@ -7,6 +7,8 @@ const SHA256 = require('../lib/sha256');
 const BLAKE2b256 = require('../lib/blake2b256');
 const BLAKE2s256 = require('../lib/blake2s256');
 const BN = require('../lib/bn');
+const p256 = require('../lib/p256');
+const ed25519 = require('../lib/ed25519');
 const random = require('../lib/random');
 const rsa = require('../lib/rsa');
 const primes = require('../lib/internal/primes');
@@ -86,6 +88,26 @@ describe('RSA', function() {
     assert.bufferEqual(json.e, Buffer.from('0100000001', 'hex'));
   });
 
+  it('should generate keypair in parallel (async)', async () => {
+    for (const [bits, jobs] of [[1024, 2], [1025, 3], [1024, 4]]) {
+      const priv = await rsa.privateKeyGenerateAsync(bits, 3, jobs);
+      const json = rsa.privateKeyExport(priv);
+
+      assert.strictEqual(rsa.privateKeyVerify(priv), true);
+      assert.strictEqual(rsa.privateKeyBits(priv), bits);
+      assert.bufferEqual(json.e, Buffer.from('03', 'hex'));
+    }
+  });
+
+  it('should cancel losing prime searches (async)', async () => {
+    // Most of the 64 workers lose the race and
+    // must stop at their next candidate.
+    const priv = await rsa.privateKeyGenerateAsync(2048, 65537, 64);
+
+    assert.strictEqual(rsa.privateKeyVerify(priv), true);
+    assert.strictEqual(rsa.privateKeyBits(priv), 2048);
+  });
+
   it('should sign and verify', () => {
     const bits = rsa.native < 2 ? 1024 : 2048;
     const priv = rsa.privateKeyGenerate(bits);
@@ -290,6 +312,59 @@ describe('RSA', function() {
     assert.bufferEqual(pt, msg);
   });
 
+  it('should refresh blinding on a parsed key', () => {
+    const priv = rsa.privateKeyGenerate(1024);
+    const pub = rsa.publicKeyCreate(priv);
+    const key = rsa.privateKeyParse(priv);
+    const sig = rsa.sign(SHA256, msg, priv);
+
+    // Cross the regeneration boundary twice.
+    for (let i = 0; i < 70; i++) {
+      const pt = random.randomBytes(i & 31);
+
+      if (i & 1) {
+        assert.bufferEqual(rsa.signParsed(SHA256, msg, key), sig);
+      } else {
+        const ct = rsa.encrypt(pt, pub);
+
+        assert.bufferEqual(rsa.decryptParsed(ct, key), pt);
+      }
+    }
+
+    const pss = rsa.signPSSParsed(SHA256, msg, key);
+
+    assert(rsa.verifyPSS(SHA256, msg, pss, pub));
+  });
+
+  if (rsa.native === 2) {
+    it('should refuse foreign parsed keys', () => {
+      const priv = rsa.privateKeyGenerate(1024);
+      const pub = rsa.publicKeyCreate(priv);
+      const ct = rsa.encrypt(msg, pub);
+      const ct2 = rsa.encryptOAEP(SHA256, msg, pub);
+      const pub1 = p256.publicKeyCreate(p256.privateKeyGenerate());
+      const pub2 = ed25519.publicKeyCreate(ed25519.privateKeyGenerate());
+
+      // The parsed RSA operations update the key's
+      // blinding state, so a misread handle would be
+      // written through as well.
+      for (const key of [p256.publicKeyParse(pub1),
+                         ed25519.publicKeyParse(pub2)]) {
+        assert.throws(() => rsa.signParsed(SHA256, msg, key),
+                      /Invalid private key/);
+        assert.throws(() => rsa.decryptParsed(ct, key),
+                      /Invalid private key/);
+        assert.throws(() => rsa.signPSSParsed(SHA256, msg, key),
+                      /Invalid private key/);
+        assert.throws(() => rsa.decryptOAEPParsed(SHA256, ct2, key),
+                      /Invalid private key/);
+      }
+
+      assert.bufferEqual(rsa.decryptParsed(ct, rsa.privateKeyParse(priv)),
+                         msg);
+    });
+  }
+
   it('should encrypt and decrypt (OAEP)', () => {
     const priv = rsa.privateKeyGenerate(1024);
     const pub = rsa.publicKeyCreate(priv);
@@ -348,6 +423,29 @@ describe('RSA', function() {
     });
   }
 
+  // Moduli past the Toom-3 thresholds (7168 bits
+  // for products, 10240 bits for squares).
+  for (const vector of require('./data/rsa-large.json')) {
+    const msg = Buffer.from(vector.msg, 'hex');
+    const sig = Buffer.from(vector.sig, 'hex');
+    const key = Buffer.from(vector.pub, 'hex');
+
+    it(`should verify ${vector.bits} bit RSA signature`, () => {
+      const m = SHA256.digest(msg);
+
+      assert(rsa.publicKeyVerify(key));
+      assert.strictEqual(rsa.publicKeyBits(key), vector.bits);
+      assert(rsa.verify(SHA256, m, sig, key));
+
+      sig[sig.length >>> 1] ^= 1;
+      assert(!rsa.verify(SHA256, m, sig, key));
+      sig[sig.length >>> 1] ^= 1;
+
+      m[0] ^= 1;
+      assert(!rsa.verify(SHA256, m, sig, key));
+    });
+  }
+
   {
     const vector = require('./data/rsa-other.json');
     const priv = Buffer.from(vector.priv, 'hex');
@@ -523,5 +621,26 @@ describe('RSA', function() {
       assert.bufferEqual(rsa.decryptOAEP(hash,
         rsa.encryptOAEP(hash, msg, pub, label), priv, label), msg);
     });
+
+    it(`should sign and decrypt with a parsed key (${i})`, () => {
+      const key = rsa.privateKeyParse(priv);
+
+      for (let j = 0; j < 2; j++) {
+        const sig = rsa.signPSSParsed(hash, msg, key, saltLen);
+
+        assert.bufferEqual(rsa.signParsed(hash, msg, key), sig1);
+        assert(rsa.verifyPSS(hash, msg, sig, pub, saltLen));
+        assert.bufferEqual(rsa.decryptParsed(ct1, key), msg);
+        assert.bufferEqual(rsa.decryptOAEPParsed(hash, ct2, key, label), msg);
+      }
+
+      assert.throws(() => rsa.decryptParsed(ct2, key));
+
+      priv[priv.length - 1] ^= 1;
+
+      assert.throws(() => rsa.privateKeyParse(priv));
+
+      priv[priv.length - 1] ^= 1;
+    });
   }
 });
@@ -57,6 +57,42 @@ describe('Secp256k1+Schnorr Legacy', function() {
     }
   });
 
+  it('should do batch verification (async)', async () => {
+    assert.strictEqual(await secp256k1.schnorrVerifyBatchAsync([]), true);
+    assert.strictEqual(await secp256k1.schnorrVerifyBatchAsync(valid), true);
+
+    for (const item of valid)
+      assert.strictEqual(await secp256k1.schnorrVerifyAsync(...item), true);
+
+    for (const item of invalid) {
+      const batch = [...valid, item];
+
+      assert.strictEqual(await secp256k1.schnorrVerifyBatchAsync(batch), false);
+    }
+  });
+
+  it('should do parallel batch verification', async () => {
+    const batch = [...invalid, ...valid, ...invalid];
+    const expect = [];
+
+    for (let i = 0; i < invalid.length; i++)
+      expect.push(i);
+
+    for (let i = 0; i < invalid.length; i++)
+      expect.push(invalid.length + valid.length + i);
+
+    for (const jobs of [1, 2, 5]) {
+      const ok = await secp256k1.schnorrVerifyBatchAsync(valid, jobs);
+      const bad = await secp256k1.schnorrFindInvalidAsync(batch, jobs);
+
+      assert.strictEqual(ok, true);
+      assert.deepStrictEqual(bad, expect);
+    }
+
+    assert.deepStrictEqual(secp256k1.schnorrFindInvalid(valid), []);
+    assert.deepStrictEqual(secp256k1.schnorrFindInvalid(batch), expect);
+  });
+
   it('should handle uncompressed key properly', () => {
     // See: https://github.com/bcoin-org/bcrypto/issues/17
     const msg = Buffer.from(
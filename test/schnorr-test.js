@@ -30,6 +30,27 @@ describe('Schnorr', function() {
       }
 
       assert.strictEqual(schnorr.verify(msg, sig, pub), result);
+
+      if (schnorr.publicKeyVerify(pub)) {
+        const parsed = schnorr.publicKeyParse(pub);
+
+        assert.strictEqual(schnorr.verifyParsed(msg, sig, parsed), result);
+      } else {
+        assert.throws(() => schnorr.publicKeyParse(pub));
+      }
+    });
+  }
+
+  if (schnorr.native === 2) {
+    it('should refuse foreign parsed keys', () => {
+      const priv = schnorr.privateKeyGenerate();
+      const msg = rng.randomBytes(32);
+      const sig = schnorr.sign(msg, priv);
+      const pub = secp256k1.publicKeyCreate(priv);
+      const other = secp256k1.publicKeyParse(pub);
+
+      assert.throws(() => schnorr.verifyParsed(msg, sig, other),
+                    /Invalid public key/);
     });
   }
 
@@ -49,6 +70,87 @@ describe('Schnorr', function() {
     }
   });
 
+  it('should do large batch verification', () => {
+    const batch = [];
+
+    for (let i = 0; i < 80; i++) {
+      const msg = rng.randomBytes(32);
+      const key = schnorr.privateKeyGenerate();
+      const pub = schnorr.publicKeyCreate(key);
+      const sig = schnorr.sign(msg, key);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    assert.strictEqual(schnorr.verifyBatch(batch), true);
+
+    for (const item of invalid) {
+      assert.strictEqual(schnorr.verifyBatch([...batch, item]), false);
+      assert.strictEqual(schnorr.verifyBatch([item, ...batch]), false);
+    }
+  });
+
+  it('should sign and verify (async)', async () => {
+    const msg = rng.randomBytes(32);
+    const key = schnorr.privateKeyGenerate();
+    const pub = schnorr.publicKeyCreate(key);
+    const aux = rng.randomBytes(32);
+    const sig = schnorr.sign(msg, key, aux);
+
+    assert.bufferEqual(await schnorr.signAsync(msg, key, aux), sig);
+    assert.strictEqual(await schnorr.verifyAsync(msg, sig, pub), true);
+
+    assert.strictEqual(await schnorr.verifyBatchAsync([]), true);
+    assert.strictEqual(await schnorr.verifyBatchAsync(valid), true);
+
+    for (const item of invalid) {
+      assert.strictEqual(await schnorr.verifyAsync(...item), false);
+      assert.strictEqual(await schnorr.verifyBatchAsync([item, ...valid]),
+                         false);
+    }
+  });
+
+  it('should do parallel batch verification', async () => {
+    const batch = [...valid, ...invalid, ...valid];
+    const expect = [];
+
+    for (let i = 0; i < invalid.length; i++)
+      expect.push(valid.length + i);
+
+    for (const jobs of [1, 2, 3, 64]) {
+      assert.strictEqual(await schnorr.verifyBatchAsync(valid, jobs), true);
+      assert.strictEqual(await schnorr.verifyBatchAsync(batch, jobs), false);
+      assert.deepStrictEqual(await schnorr.findInvalidAsync(valid, jobs), []);
+      assert.deepStrictEqual(await schnorr.findInvalidAsync(batch, jobs),
+                             expect);
+    }
+
+    assert.strictEqual(await schnorr.verifyBatchAsync([], 4), true);
+    assert.deepStrictEqual(await schnorr.findInvalidAsync([], 4), []);
+  });
+
+  it('should find invalid signatures', () => {
+    assert.deepStrictEqual(schnorr.findInvalid([]), []);
+    assert.deepStrictEqual(schnorr.findInvalid(valid), []);
+
+    for (const item of invalid) {
+      const batch = [...valid, item, ...valid];
+
+      assert.deepStrictEqual(schnorr.findInvalid([item]), [0]);
+      assert.deepStrictEqual(schnorr.findInvalid(batch), [valid.length]);
+    }
+
+    const batch = [...invalid, ...valid, ...invalid];
+    const expect = [];
+
+    for (let i = 0; i < batch.length; i++) {
+      if (i < invalid.length || i >= invalid.length + valid.length)
+        expect.push(i);
+    }
+
+    assert.deepStrictEqual(schnorr.findInvalid(batch), expect);
+  });
+
   it('should do HD derivation (additive)', () => {
     const priv = schnorr.privateKeyGenerate();
     const pub = schnorr.publicKeyCreate(priv);
@@ -90,6 +90,47 @@ describe('Scrypt', function() {
       + '651e40dfcf017b45575887');
   });
 
+  it('should perform scrypt with parallel lanes (async)', async () => {
+    const pass = Buffer.from('password');
+    const salt = Buffer.from('NaCl');
+    const expect = scrypt.derive(pass, salt, 256, 4, 5, 48);
+
+    for (const jobs of [1, 2, 3, 5, 8]) {
+      const result = await scrypt.deriveAsync(pass, salt, 256, 4, 5, 48, jobs);
+
+      assert.bufferEqual(result, expect);
+    }
+
+    const result = await scrypt.deriveAsync(pass, salt, 1024, 8, 16, 64, 4);
+
+    assert.strictEqual(result.toString('hex'), ''
+      + 'fdbabe1c9d3472007856e7190d01e9fe7c6ad7cbc8237830e773'
+      + '76634b3731622eaf30d92e22a3886ff109279d9830dac727afb9'
+      + '4a83ee6d8360cbdfa2cc0640');
+
+    await assert.rejects(scrypt.deriveAsync(pass, salt, 3, 1, 2, 32, 2));
+  });
+
+  it('should perform scrypt in batch (async)', async () => {
+    const items = [
+      [Buffer.from('password'), Buffer.from('NaCl')],
+      [Buffer.from(''), Buffer.from('')],
+      [Buffer.from('pleaseletmein'), Buffer.from('SodiumChloride')]
+    ];
+
+    const expect = Buffer.concat(items.map(([pass, salt]) => {
+      return scrypt.derive(pass, salt, 64, 2, 3, 32);
+    }));
+
+    for (const jobs of [1, 2, 4]) {
+      const keys = await scrypt.deriveBatchAsync(items, 64, 2, 3, 32, jobs);
+
+      assert.bufferEqual(keys, expect);
+    }
+
+    await assert.rejects(scrypt.deriveBatchAsync(items, 3, 2, 3, 32, 2));
+  });
+
   // Only enable if you want to wait a while.
   it.skip('should perform scrypt with N=1048576 (async)', async () => {
     const pass = Buffer.from('pleaseletmein');